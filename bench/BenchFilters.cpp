@@ -0,0 +1,418 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// Benchmarks of neighborhood filters: blurs, morphology, convolutions and image quality metrics.
+// Benchmarks of neighborhood filters: blurs, morphology, convolutions and the SSIM windows, along with PSNR.
+
+#include "BenchUtils.hpp"
+
+#include <cvcuda/OpAverageBlur.hpp>
+#include <cvcuda/OpBilateralFilter.hpp>
+#include <cvcuda/OpBlurRegions.hpp>
+#include <cvcuda/OpConv2D.hpp>
+#include <cvcuda/OpGaussian.hpp>
+#include <cvcuda/OpGuidedFilter.hpp>
+#include <cvcuda/OpJointBilateralFilter.hpp>
+#include <cvcuda/OpLaplacian.hpp>
+#include <cvcuda/OpMedianBlur.hpp>
+#include <cvcuda/OpMorphology.hpp>
+#include <cvcuda/OpPSNR.hpp>
+#include <cvcuda/OpSSIM.hpp>
+
+namespace {
+
+using namespace cvcuda::bench;
+
+nvcv::TensorShape PerSample(int numSamples)
+{
+    return nvcv::TensorShape({numSamples}, "N");
+}
+
+// AverageBlur / Gaussian ----------------------------------------------------
+
+void AverageBlur(benchmark::State &state, nvcv::ImageFormat fmt, int ksize)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, ImageSize(state), fmt);
+
+    cvcuda::AverageBlur op({ksize, ksize}, 0);
+    Run(state, {NumBytes(*in) + NumBytes(*out), ksize * ksize * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, {ksize, ksize}, int2{-1, -1}, NVCV_BORDER_REPLICATE); });
+}
+
+void AverageBlurVarShape(benchmark::State &state, nvcv::ImageFormat fmt, int ksize)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    auto kernelSize   = CreateParam(PerSample(N), nvcv::TYPE_2S32, std::vector<int2>(N, int2{ksize, ksize}));
+    auto kernelAnchor = CreateParam(PerSample(N), nvcv::TYPE_2S32, std::vector<int2>(N, int2{-1, -1}));
+
+    cvcuda::AverageBlur op({ksize, ksize}, N);
+    Run(state, {NumBytes(*in) + NumBytes(*out), ksize * ksize * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, *kernelSize, *kernelAnchor, NVCV_BORDER_REPLICATE); });
+}
+
+void Gaussian(benchmark::State &state, nvcv::ImageFormat fmt, int ksize)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, ImageSize(state), fmt);
+
+    cvcuda::Gaussian op({ksize, ksize}, 0);
+    Run(state, {NumBytes(*in) + NumBytes(*out), FilterFlops(ksize) * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, {ksize, ksize}, double2{1, 1}, NVCV_BORDER_REPLICATE); });
+}
+
+void GaussianVarShape(benchmark::State &state, nvcv::ImageFormat fmt, int ksize)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    auto kernelSize = CreateParam(PerSample(N), nvcv::TYPE_2S32, std::vector<int2>(N, int2{ksize, ksize}));
+    auto sigma      = CreateParam(PerSample(N), nvcv::TYPE_2F64, std::vector<double2>(N, double2{1, 1}));
+
+    cvcuda::Gaussian op({ksize, ksize}, N);
+    Run(state, {NumBytes(*in) + NumBytes(*out), FilterFlops(ksize) * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, *kernelSize, *sigma, NVCV_BORDER_REPLICATE); });
+}
+
+CVCUDA_BENCH(AverageBlur, rgb8_k3, nvcv::FMT_RGB8, 3);
+CVCUDA_BENCH(AverageBlur, rgb8_k7, nvcv::FMT_RGB8, 7);
+CVCUDA_BENCH(AverageBlur, rgbf32_k7, nvcv::FMT_RGBf32, 7);
+CVCUDA_BENCH(AverageBlurVarShape, rgb8_k7, nvcv::FMT_RGB8, 7);
+CVCUDA_BENCH(Gaussian, rgb8_k3, nvcv::FMT_RGB8, 3);
+CVCUDA_BENCH(Gaussian, rgb8_k7, nvcv::FMT_RGB8, 7);
+CVCUDA_BENCH(Gaussian, rgbf32_k7, nvcv::FMT_RGBf32, 7);
+CVCUDA_BENCH(GaussianVarShape, rgb8_k7, nvcv::FMT_RGB8, 7);
+
+// MedianBlur ----------------------------------------------------------------
+
+void MedianBlur(benchmark::State &state, nvcv::ImageFormat fmt, int ksize)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, ImageSize(state), fmt);
+
+    cvcuda::MedianBlur op(0);
+    Run(state, NumBytes(*in) + NumBytes(*out), N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, {ksize, ksize}); });
+}
+
+void MedianBlurVarShape(benchmark::State &state, nvcv::ImageFormat fmt, int ksize)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    auto kernelSize = CreateParam(nvcv::TensorShape({N, 2}, nvcv::TENSOR_NW), nvcv::TYPE_S32,
+                                  std::vector<int>(2 * N, ksize));
+
+    cvcuda::MedianBlur op(N);
+    Run(state, NumBytes(*in) + NumBytes(*out), N, [&](cudaStream_t stream) { op(stream, *in, *out, *kernelSize); });
+}
+
+CVCUDA_BENCH(MedianBlur, rgb8_k3, nvcv::FMT_RGB8, 3);
+CVCUDA_BENCH(MedianBlur, rgb8_k5, nvcv::FMT_RGB8, 5);
+CVCUDA_BENCH(MedianBlur, u8_k7, nvcv::FMT_U8, 7);
+CVCUDA_BENCH(MedianBlurVarShape, rgb8_k5, nvcv::FMT_RGB8, 5);
+
+// Laplacian -----------------------------------------------------------------
+
+void Laplacian(benchmark::State &state, nvcv::ImageFormat fmt, int ksize)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, ImageSize(state), fmt);
+
+    cvcuda::Laplacian op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), FilterFlops(3) * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, ksize, 1.f, NVCV_BORDER_REPLICATE); });
+}
+
+void LaplacianVarShape(benchmark::State &state, nvcv::ImageFormat fmt, int ksize)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    auto kernelSize = CreateParam(PerSample(N), nvcv::TYPE_S32, std::vector<int>(N, ksize));
+    auto scale      = CreateParam(PerSample(N), nvcv::TYPE_F32, std::vector<float>(N, 1.f));
+
+    cvcuda::Laplacian op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), FilterFlops(3) * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, *kernelSize, *scale, NVCV_BORDER_REPLICATE); });
+}
+
+CVCUDA_BENCH(Laplacian, rgb8_k3, nvcv::FMT_RGB8, 3);
+CVCUDA_BENCH(Laplacian, rgbf32_k3, nvcv::FMT_RGBf32, 3);
+CVCUDA_BENCH(LaplacianVarShape, rgb8_k3, nvcv::FMT_RGB8, 3);
+
+// Morphology ----------------------------------------------------------------
+
+void Morphology(benchmark::State &state, nvcv::ImageFormat fmt, NVCVMorphologyType type, int ksize)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, ImageSize(state), fmt);
+
+    cvcuda::Morphology op(0);
+    Run(state, {NumBytes(*in) + NumBytes(*out), ksize * ksize * NumValues(*out)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *out, type, {ksize, ksize}, int2{-1, -1}, 1, NVCV_BORDER_CONSTANT); });
+}
+
+void MorphologyVarShape(benchmark::State &state, nvcv::ImageFormat fmt, NVCVMorphologyType type, int ksize)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    auto masks   = CreateParam(PerSample(N), nvcv::TYPE_2S32, std::vector<int2>(N, int2{ksize, ksize}));
+    auto anchors = CreateParam(PerSample(N), nvcv::TYPE_2S32, std::vector<int2>(N, int2{-1, -1}));
+
+    cvcuda::Morphology op(N);
+    Run(state, {NumBytes(*in) + NumBytes(*out), ksize * ksize * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, type, *masks, *anchors, 1, NVCV_BORDER_CONSTANT); });
+}
+
+CVCUDA_BENCH(Morphology, rgb8_erode_k3, nvcv::FMT_RGB8, NVCV_ERODE, 3);
+CVCUDA_BENCH(Morphology, rgb8_dilate_k7, nvcv::FMT_RGB8, NVCV_DILATE, 7);
+CVCUDA_BENCH(Morphology, u8_erode_k7, nvcv::FMT_U8, NVCV_ERODE, 7);
+CVCUDA_BENCH(MorphologyVarShape, rgb8_erode_k3, nvcv::FMT_RGB8, NVCV_ERODE, 3);
+
+// BilateralFilter / JointBilateralFilter ------------------------------------
+
+constexpr float kSigmaColor = 50;
+constexpr float kSigmaSpace = 2;
+
+// Operations per value and neighbor: color distance, weight and weighted sums, counting the exponential as one
+constexpr int64_t kBilateralTapFlops = 8;
+
+int64_t BilateralFlops(int diameter)
+{
+    return kBilateralTapFlops * diameter * diameter;
+}
+
+void BilateralFilter(benchmark::State &state, nvcv::ImageFormat fmt, int diameter)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, ImageSize(state), fmt);
+
+    cvcuda::BilateralFilter op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), BilateralFlops(diameter) * NumValues(*out)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *out, diameter, kSigmaColor, kSigmaSpace, NVCV_BORDER_REPLICATE); });
+}
+
+void BilateralFilterVarShape(benchmark::State &state, nvcv::ImageFormat fmt, int diameter)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    auto diameters   = CreateParam(PerSample(N), nvcv::TYPE_S32, std::vector<int>(N, diameter));
+    auto sigmaColors = CreateParam(PerSample(N), nvcv::TYPE_F32, std::vector<float>(N, kSigmaColor));
+    auto sigmaSpaces = CreateParam(PerSample(N), nvcv::TYPE_F32, std::vector<float>(N, kSigmaSpace));
+
+    cvcuda::BilateralFilter op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), BilateralFlops(diameter) * NumValues(*out)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *out, *diameters, *sigmaColors, *sigmaSpaces, NVCV_BORDER_REPLICATE); });
+}
+
+void JointBilateralFilter(benchmark::State &state, nvcv::ImageFormat fmt, int diameter)
+{
+    int  N       = BatchSize(state);
+    auto in      = CreateTensor(N, ImageSize(state), fmt);
+    auto inColor = CreateTensor(N, ImageSize(state), fmt);
+    auto out     = CreateTensor(N, ImageSize(state), fmt);
+
+    cvcuda::JointBilateralFilter op;
+    Run(state, {2 * NumBytes(*in) + NumBytes(*out), BilateralFlops(diameter) * NumValues(*out)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *inColor, *out, diameter, kSigmaColor, kSigmaSpace, NVCV_BORDER_REPLICATE); });
+}
+
+void JointBilateralFilterVarShape(benchmark::State &state, nvcv::ImageFormat fmt, int diameter)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt, false);
+    ImageBatch inColor(N, ImageSize(state), fmt, false);
+    ImageBatch out(in.sizes(), fmt);
+
+    auto diameters   = CreateParam(PerSample(N), nvcv::TYPE_S32, std::vector<int>(N, diameter));
+    auto sigmaColors = CreateParam(PerSample(N), nvcv::TYPE_F32, std::vector<float>(N, kSigmaColor));
+    auto sigmaSpaces = CreateParam(PerSample(N), nvcv::TYPE_F32, std::vector<float>(N, kSigmaSpace));
+
+    cvcuda::JointBilateralFilter op;
+    Run(state, {2 * NumBytes(*in) + NumBytes(*out), BilateralFlops(diameter) * NumValues(*out)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *inColor, *out, *diameters, *sigmaColors, *sigmaSpaces, NVCV_BORDER_REPLICATE); });
+}
+
+CVCUDA_BENCH(BilateralFilter, rgb8_d5, nvcv::FMT_RGB8, 5);
+CVCUDA_BENCH(BilateralFilter, u8_d9, nvcv::FMT_U8, 9);
+CVCUDA_BENCH(BilateralFilterVarShape, rgb8_d5, nvcv::FMT_RGB8, 5);
+CVCUDA_BENCH(JointBilateralFilter, u8_d5, nvcv::FMT_U8, 5);
+CVCUDA_BENCH(JointBilateralFilterVarShape, u8_d5, nvcv::FMT_U8, 5);
+
+// GuidedFilter --------------------------------------------------------------
+
+constexpr float kGuidedEps = 0.01f;
+
+// Box means take an addition and a subtraction per plane along each axis, for the means of the guide and input
+// products and the coefficients, all subsampled, then each output value applies its coefficients to the guide.
+int64_t GuidedFilterFlops(int guideChannels, int channels, int subsample)
+{
+    const int64_t planes = guideChannels * (guideChannels + 3) / 2 + 2 * channels * (guideChannels + 1);
+    return 4 * planes / (subsample * subsample) + 2 * guideChannels * channels;
+}
+
+void GuidedFilter(benchmark::State &state, nvcv::ImageFormat fmt, nvcv::ImageFormat guideFmt, int radius,
+                  int subsample)
+{
+    int  N     = BatchSize(state);
+    auto size  = ImageSize(state);
+    auto in    = CreateTensor(N, size, fmt);
+    auto guide = CreateTensor(N, size, guideFmt);
+    auto out   = CreateTensor(N, size, fmt);
+
+    const int64_t pixels = static_cast<int64_t>(N) * size.w * size.h;
+
+    cvcuda::GuidedFilter op(N, size.w, size.h);
+    Run(state,
+        {NumBytes(*in) + NumBytes(*guide) + NumBytes(*out),
+         GuidedFilterFlops(guideFmt.numChannels(), fmt.numChannels(), subsample) * pixels},
+        N, [&](cudaStream_t stream) { op(stream, *in, *guide, *out, radius, kGuidedEps, subsample); });
+}
+
+void GuidedFilterVarShape(benchmark::State &state, nvcv::ImageFormat fmt, nvcv::ImageFormat guideFmt, int radius)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch guide(in.sizes(), guideFmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    auto size = ImageSize(state);
+
+    cvcuda::GuidedFilter op(N, size.w, size.h);
+    Run(state,
+        {NumBytes(*in) + NumBytes(*guide) + NumBytes(*out),
+         GuidedFilterFlops(guideFmt.numChannels(), fmt.numChannels(), 1) * NumValues(*out) / fmt.numChannels()},
+        N, [&](cudaStream_t stream) { op(stream, *in, *guide, *out, radius, kGuidedEps); });
+}
+
+// same radius as the joint bilateral filter above, then large radii where the guided filter cost doesn't grow
+CVCUDA_BENCH(GuidedFilter, u8_gray_r2, nvcv::FMT_U8, nvcv::FMT_U8, 2, 1);
+CVCUDA_BENCH(GuidedFilter, u8_gray_r32, nvcv::FMT_U8, nvcv::FMT_U8, 32, 1);
+CVCUDA_BENCH(GuidedFilter, u8_rgb_r32, nvcv::FMT_U8, nvcv::FMT_RGB8, 32, 1);
+CVCUDA_BENCH(GuidedFilter, u8_rgb_r32_fast4, nvcv::FMT_U8, nvcv::FMT_RGB8, 32, 4);
+CVCUDA_BENCH(GuidedFilterVarShape, u8_rgb_r16, nvcv::FMT_U8, nvcv::FMT_RGB8, 16);
+
+// BlurRegions ---------------------------------------------------------------
+
+// Boxes of 1/8 x 1/8 of the image along its diagonal, 1/8 of the image area in total, e.g. faces in a frame.
+constexpr int kNumBlurBoxes = 8;
+
+void BlurRegions(benchmark::State &state, nvcv::ImageFormat fmt, NVCVBlurRegionType type, int ksize)
+{
+    int  N    = BatchSize(state);
+    auto size = ImageSize(state);
+    auto img  = CreateTensor(N, size, fmt);
+
+    const float2 boxSize{static_cast<float>(size.w) / kNumBlurBoxes, static_cast<float>(size.h) / kNumBlurBoxes};
+
+    std::vector<float4> boxValues;
+    for (int n = 0; n < N; ++n)
+    {
+        for (int i = 0; i < kNumBlurBoxes; ++i)
+        {
+            boxValues.push_back({i * boxSize.x, i * boxSize.y, (i + 1) * boxSize.x, (i + 1) * boxSize.y});
+        }
+    }
+    auto boxes = CreateParam(nvcv::TensorShape({N, 1, kNumBlurBoxes, 4}, nvcv::TENSOR_NHWC), nvcv::TYPE_F32,
+                             boxValues);
+
+    // each pixel of the boxes is read and written once, the Gaussian blur takes two 1D passes
+    const int64_t boxBytes = 2 * NumBytes(*img) / kNumBlurBoxes;
+    const int64_t flops    = (type == NVCV_BLUR_REGION_GAUSSIAN ? 4 * ksize : 1) * NumValues(*img) / kNumBlurBoxes;
+
+    cvcuda::BlurRegions op(N, size.w, size.h);
+    Run(state, {boxBytes, flops}, N, [&](cudaStream_t stream) { op(stream, *img, *boxes, type, ksize); });
+}
+
+// same kernel size as the full-frame Gaussian above
+CVCUDA_BENCH(BlurRegions, rgb8_gaussian_k7, nvcv::FMT_RGB8, NVCV_BLUR_REGION_GAUSSIAN, 7);
+CVCUDA_BENCH(BlurRegions, rgb8_gaussian_k31, nvcv::FMT_RGB8, NVCV_BLUR_REGION_GAUSSIAN, 31);
+CVCUDA_BENCH(BlurRegions, rgb8_pixelate_c16, nvcv::FMT_RGB8, NVCV_BLUR_REGION_PIXELATE, 16);
+
+// PSNR / SSIM ---------------------------------------------------------------
+
+// Scores of decoded frames against their sources, as when monitoring a transcode ladder
+void PSNR(benchmark::State &state, nvcv::ImageFormat fmt)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto ref = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, nvcv::Size2D{1, 1}, nvcv::FMT_F32);
+
+    cvcuda::PSNR op;
+    Run(state, {NumBytes(*in) + NumBytes(*ref), 3 * NumValues(*in)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *ref, *out); });
+}
+
+// The 5 local moments take 2 passes of 11 multiply-adds, plus 3 multiplications before the horizontal pass
+void SSIM(benchmark::State &state, nvcv::ImageFormat fmt)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto ref = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, nvcv::Size2D{1, 1}, nvcv::FMT_F32);
+
+    cvcuda::SSIM op;
+    Run(state, {NumBytes(*in) + NumBytes(*ref), (5 * 2 * 2 * 11 + 3) * NumValues(*in)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *ref, *out); });
+}
+
+CVCUDA_BENCH(PSNR, rgb8, nvcv::FMT_RGB8);
+CVCUDA_BENCH(SSIM, u8_gray, nvcv::FMT_U8);
+CVCUDA_BENCH(SSIM, rgb8, nvcv::FMT_RGB8);
+
+// Conv2D --------------------------------------------------------------------
+
+void Conv2DVarShape(benchmark::State &state, nvcv::ImageFormat fmt, int ksize)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+    ImageBatch kernel(N, {ksize, ksize}, nvcv::FMT_F32, false);
+
+    auto kernelAnchor = CreateParam(PerSample(N), nvcv::TYPE_2S32, std::vector<int2>(N, int2{-1, -1}));
+
+    cvcuda::Conv2D op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), FilterFlops(ksize) * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, *kernel, *kernelAnchor, NVCV_BORDER_REPLICATE); });
+}
+
+CVCUDA_BENCH(Conv2DVarShape, rgb8_k3, nvcv::FMT_RGB8, 3);
+CVCUDA_BENCH(Conv2DVarShape, rgb8_k7, nvcv::FMT_RGB8, 7);
+
+} // namespace
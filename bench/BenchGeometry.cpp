@@ -0,0 +1,745 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmarks of operators that change image geometry: resizes, warps, crops and borders.
+
+#include "BenchUtils.hpp"
+
+#include <cvcuda/OpCenterCrop.hpp>
+#include <cvcuda/OpCopyMakeBorder.hpp>
+#include <cvcuda/OpCropResize.hpp>
+#include <cvcuda/OpCustomCrop.hpp>
+#include <cvcuda/OpMosaic.hpp>
+#include <cvcuda/OpFlip.hpp>
+#include <cvcuda/OpPadAndStack.hpp>
+#include <cvcuda/OpPillowResize.hpp>
+#include <cvcuda/OpRandomParams.hpp>
+#include <cvcuda/OpRemap.hpp>
+#include <cvcuda/OpResize.hpp>
+#include <cvcuda/OpResizeNormalizeReformat.hpp>
+#include <cvcuda/OpRotate.hpp>
+#include <cvcuda/OpWarpAffine.hpp>
+#include <cvcuda/OpWarpPerspective.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using namespace cvcuda::bench;
+
+constexpr int kBorder = 16;
+
+// Resize --------------------------------------------------------------------
+
+void Resize(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp, double scale)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, Scale(ImageSize(state), scale), fmt);
+
+    cvcuda::Resize op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), InterpFlops(interp, scale) * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, interp); });
+}
+
+void ResizeVarShape(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp, double scale)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(N, Scale(ImageSize(state), scale), fmt, false);
+
+    cvcuda::Resize op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), InterpFlops(interp, scale) * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, interp); });
+}
+
+void ResizePyramid(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp, int numLevels)
+{
+    int  N  = BatchSize(state);
+    auto in = CreateTensor(N, ImageSize(state), fmt);
+
+    std::vector<std::unique_ptr<nvcv::Tensor>> levels;
+    std::vector<nvcv::ITensor *>               levelPtrs;
+    Cost                                       cost(NumBytes(*in));
+    for (int l = 1; l <= numLevels; ++l)
+    {
+        levels.push_back(CreateTensor(N, Scale(ImageSize(state), 1.0 / (1 << l)), fmt));
+        levelPtrs.push_back(levels.back().get());
+        cost.bytes += NumBytes(*levels.back());
+        cost.flops += InterpFlops(interp, 0.5) * NumValues(*levels.back());
+    }
+
+    cvcuda::Resize op;
+    Run(state, cost, N,
+        [&](cudaStream_t stream) { op.pyramid(stream, *in, levelPtrs.data(), numLevels, interp); });
+}
+
+// Typical multi-resolution inference inputs: a detector, a classifier and a thumbnail from one frame
+void ResizeMulti(benchmark::State &state, nvcv::ImageFormat fmt)
+{
+    int  N  = BatchSize(state);
+    auto in = CreateTensor(N, ImageSize(state), fmt);
+
+    const double                scales[]         = {0.5, 0.25, 0.125};
+    const NVCVInterpolationType interpolations[] = {NVCV_INTERP_LINEAR, NVCV_INTERP_CUBIC, NVCV_INTERP_AREA};
+
+    std::vector<std::unique_ptr<nvcv::Tensor>> outs;
+    std::vector<nvcv::ITensor *>               outPtrs;
+    Cost                                       cost(NumBytes(*in));
+    for (int i = 0; i < 3; ++i)
+    {
+        outs.push_back(CreateTensor(N, Scale(ImageSize(state), scales[i]), fmt));
+        outPtrs.push_back(outs.back().get());
+        cost.bytes += NumBytes(*outs.back());
+        cost.flops += InterpFlops(interpolations[i], scales[i]) * NumValues(*outs.back());
+    }
+
+    cvcuda::Resize op;
+    Run(state, cost, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, outPtrs.data(), interpolations, static_cast<int32_t>(outPtrs.size())); });
+}
+
+// Mixed batch in a single launch: even samples are upscaled 2x with cubic, odd ones downscaled 8x with
+// antialiasing
+void ResizeVarShapePerSample(benchmark::State &state, nvcv::ImageFormat fmt)
+{
+    int N = BatchSize(state);
+
+    std::vector<nvcv::Size2D> inSizes(N, ImageSize(state)), outSizes;
+    std::vector<int32_t>      interpolations;
+    int64_t                   flops = 0;
+    for (int i = 0; i < N; ++i)
+    {
+        const double                scale  = i % 2 ? 0.125 : 2.0;
+        const NVCVInterpolationType interp = i % 2 ? NVCV_INTERP_LINEAR : NVCV_INTERP_CUBIC;
+        outSizes.push_back(Scale(ImageSize(state), scale));
+        interpolations.push_back(interp);
+        flops += InterpFlops(i % 2 ? NVCV_INTERP_AREA : interp, scale) * outSizes.back().w * outSizes.back().h
+               * fmt.numChannels();
+    }
+
+    ImageBatch in(inSizes, fmt);
+    ImageBatch out(outSizes, fmt);
+    auto       interp = CreateParam(nvcv::TensorShape({N}, "N"), nvcv::TYPE_S32, interpolations);
+
+    cvcuda::Resize op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), flops}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, *interp, true); });
+}
+
+CVCUDA_BENCH(Resize, rgb8_nearest_down, nvcv::FMT_RGB8, NVCV_INTERP_NEAREST, 0.5);
+CVCUDA_BENCH(Resize, rgb8_linear_down, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, 0.5);
+CVCUDA_BENCH(Resize, rgb8_linear_up, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, 2.0);
+CVCUDA_BENCH(Resize, rgb8_cubic_down, nvcv::FMT_RGB8, NVCV_INTERP_CUBIC, 0.5);
+CVCUDA_BENCH(Resize, rgb8_area_down, nvcv::FMT_RGB8, NVCV_INTERP_AREA, 0.5);
+CVCUDA_BENCH(Resize, rgbf32_linear_down, nvcv::FMT_RGBf32, NVCV_INTERP_LINEAR, 0.5);
+// Shared-memory tiles for downscale by up to 2x, the quad and single pixel kernels beyond
+CVCUDA_BENCH(Resize, rgba8_linear_down, nvcv::FMT_RGBA8, NVCV_INTERP_LINEAR, 0.5);
+CVCUDA_BENCH(Resize, rgba8_linear_down_large, nvcv::FMT_RGBA8, NVCV_INTERP_LINEAR, 0.25);
+CVCUDA_BENCH(Resize, rgba8_cubic_down, nvcv::FMT_RGBA8, NVCV_INTERP_CUBIC, 0.5);
+CVCUDA_BENCH(Resize, rgba8_cubic_down_large, nvcv::FMT_RGBA8, NVCV_INTERP_CUBIC, 0.25);
+// Texture cache for upscale of 1 and 4-channel uchar and float, the quad kernel for 3 channels
+CVCUDA_BENCH(Resize, rgba8_linear_up, nvcv::FMT_RGBA8, NVCV_INTERP_LINEAR, 2.0);
+CVCUDA_BENCH(Resize, rgbaf32_linear_up, nvcv::FMT_RGBAf32, NVCV_INTERP_LINEAR, 2.0);
+// Exact 2x and 4x downscale read whole rows of each source block
+CVCUDA_BENCH(Resize, rgba8_area_down, nvcv::FMT_RGBA8, NVCV_INTERP_AREA, 0.5);
+CVCUDA_BENCH(Resize, rgba8_area_down_large, nvcv::FMT_RGBA8, NVCV_INTERP_AREA, 0.25);
+CVCUDA_BENCH(ResizePyramid, rgba8_area_4_levels, nvcv::FMT_RGBA8, NVCV_INTERP_AREA, 4);
+CVCUDA_BENCH(ResizePyramid, rgba8_linear_4_levels, nvcv::FMT_RGBA8, NVCV_INTERP_LINEAR, 4);
+CVCUDA_BENCH(ResizeMulti, rgb8_3_outputs, nvcv::FMT_RGB8);
+CVCUDA_BENCH(ResizeVarShape, rgb8_linear_down, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, 0.5);
+CVCUDA_BENCH(ResizeVarShape, rgb8_cubic_down, nvcv::FMT_RGB8, NVCV_INTERP_CUBIC, 0.5);
+CVCUDA_BENCH(ResizeVarShapePerSample, rgb8_mixed, nvcv::FMT_RGB8);
+
+// CropResize ----------------------------------------------------------------
+
+// Boxes of a quarter of the image laid out on a grid, as the regions of a two-stage detector
+void CropResize(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp, int numBoxes)
+{
+    nvcv::Size2D size = ImageSize(state);
+    auto         in   = CreateTensor(1, size, fmt);
+    auto         out  = CreateTensor(numBoxes, nvcv::Size2D{224, 224}, fmt);
+
+    std::vector<float> boxes;
+    for (int b = 0; b < numBoxes; ++b)
+    {
+        float x = (b % 16) * size.w / 32.f, y = (b / 16 % 16) * size.h / 32.f;
+        boxes.insert(boxes.end(), {x, y, x + size.w / 2.f, y + size.h / 2.f});
+    }
+    auto boxTensor = CreateParam(nvcv::TensorShape({numBoxes, 4}, nvcv::TENSOR_NW), nvcv::TYPE_F32, boxes);
+
+    cvcuda::CropResize op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), InterpFlops(interp) * NumValues(*out)}, numBoxes,
+        [&](cudaStream_t stream) { op(stream, *in, *boxTensor, *out, interp); });
+}
+
+// Random resized crop to 224x224 and random flip of decoded images, as in training data loaders, with the boxes
+// and flip codes drawn on device every batch
+void RandomResizedCrop(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp)
+{
+    int          N = BatchSize(state);
+    nvcv::Size2D dstSize{224, 224};
+    ImageBatch   in(N, ImageSize(state), fmt);
+    auto         out = CreateTensor(N, dstSize, fmt);
+
+    nvcv::Tensor boxes(nvcv::TensorShape({N, 4}, nvcv::TENSOR_NW), nvcv::TYPE_F32);
+    nvcv::Tensor flipCode(nvcv::TensorShape({N}, "N"), nvcv::TYPE_S32);
+
+    cvcuda::RandomParams rng(0);
+    cvcuda::CropResize   op;
+
+    // boxes cover half of the image on average
+    double scale = dstSize.w / (ImageSize(state).w * std::sqrt(0.5));
+    Run(state, {NumBytes(*in) / 2 + NumBytes(*out), InterpFlops(interp, scale) * NumValues(*out)}, N,
+        [&](cudaStream_t stream)
+        {
+            rng.crop(stream, *in, boxes, 0.08f, 1.f, 3.f / 4, 4.f / 3);
+            rng.flipCode(stream, flipCode, 0.5f, 0.f);
+            op(stream, *in, boxes, &flipCode, *out, interp);
+        });
+}
+
+CVCUDA_BENCH(CropResize, rgb8_linear_100_boxes, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, 100);
+CVCUDA_BENCH(CropResize, rgb8_nearest_100_boxes, nvcv::FMT_RGB8, NVCV_INTERP_NEAREST, 100);
+CVCUDA_BENCH(RandomResizedCrop, rgb8_linear, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR);
+CVCUDA_BENCH(RandomResizedCrop, rgb8_area, nvcv::FMT_RGB8, NVCV_INTERP_AREA);
+
+// Mosaic --------------------------------------------------------------------
+
+// Video wall of the decoded streams on a 1080p canvas, in a grid of numCells x numCells cells
+void Mosaic(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp, int numCells)
+{
+    int          N = numCells * numCells;
+    nvcv::Size2D canvasSize{1920, 1080};
+    ImageBatch   in(N, ImageSize(state), fmt, false);
+    auto         out = CreateTensor(1, canvasSize, fmt);
+
+    std::vector<float> rects;
+    for (int i = 0; i < N; ++i)
+    {
+        float w = canvasSize.w / static_cast<float>(numCells), h = canvasSize.h / static_cast<float>(numCells);
+        float x = (i % numCells) * w, y = (i / numCells) * h;
+        rects.insert(rects.end(), {0, x, y, x + w, y + h});
+    }
+    auto rectTensor = CreateParam(nvcv::TensorShape({N, 5}, nvcv::TENSOR_NW), nvcv::TYPE_F32, rects);
+
+    double scale = canvasSize.w / (numCells * static_cast<double>(ImageSize(state).w));
+
+    cvcuda::Mosaic op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), InterpFlops(interp, scale) * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *rectTensor, *out, interp); });
+}
+
+CVCUDA_BENCH(Mosaic, rgb8_linear_4x4, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, 4);
+CVCUDA_BENCH(Mosaic, rgb8_area_4x4, nvcv::FMT_RGB8, NVCV_INTERP_AREA, 4);
+
+// PillowResize --------------------------------------------------------------
+
+// Operations per output value of the horizontal and vertical linear passes, whose support grows when downscaling
+int64_t PillowFlops(double scale)
+{
+    return 2 * 2 * static_cast<int64_t>(std::ceil(2 / std::min(scale, 1.0)));
+}
+
+void PillowResize(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp, double scale)
+{
+    int          N       = BatchSize(state);
+    nvcv::Size2D outSize = Scale(ImageSize(state), scale);
+    auto         in      = CreateTensor(N, ImageSize(state), fmt);
+    auto         out     = CreateTensor(N, outSize, fmt);
+
+    cvcuda::PillowResize op(nvcv::Size2D{std::max(ImageSize(state).w, outSize.w),
+                                         std::max(ImageSize(state).h, outSize.h)},
+                            N, fmt);
+    Run(state, {NumBytes(*in) + NumBytes(*out), PillowFlops(scale) * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, interp); });
+}
+
+void PillowResizeVarShape(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp,
+                          double scale)
+{
+    int          N       = BatchSize(state);
+    nvcv::Size2D outSize = Scale(ImageSize(state), scale);
+    ImageBatch   in(N, ImageSize(state), fmt);
+    ImageBatch   out(N, outSize, fmt, false);
+
+    cvcuda::PillowResize op(nvcv::Size2D{std::max(ImageSize(state).w, outSize.w),
+                                         std::max(ImageSize(state).h, outSize.h)},
+                            N, fmt);
+    Run(state, {NumBytes(*in) + NumBytes(*out), PillowFlops(scale) * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, interp); });
+}
+
+CVCUDA_BENCH(PillowResize, rgb8_linear_down, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, 0.5);
+CVCUDA_BENCH(PillowResize, rgbf32_linear_down, nvcv::FMT_RGBf32, NVCV_INTERP_LINEAR, 0.5);
+CVCUDA_BENCH(PillowResizeVarShape, rgb8_linear_down, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, 0.5);
+
+// ResizeNormalizeReformat ---------------------------------------------------
+
+// Operations per output value of the normalization, and of the color conversion of NV12 inputs
+constexpr int64_t kNormalizeFlops = 4;
+constexpr int64_t kYuvToRgbFlops  = 3;
+
+void ResizeNormalizeReformat(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp,
+                             double scale)
+{
+    int          N       = BatchSize(state);
+    nvcv::Size2D outSize = Scale(ImageSize(state), scale);
+    auto         in      = CreateTensor(N, ImageSize(state), fmt);
+    auto         out     = CreateTensor({{N, fmt.numChannels(), outSize.h, outSize.w}, "NCHW"}, nvcv::TYPE_F32);
+    auto         base    = CreateTensor(1, {1, 1}, nvcv::FMT_RGBf32);
+    auto         stddev  = CreateTensor(1, {1, 1}, nvcv::FMT_RGBf32);
+
+    cvcuda::ResizeNormalizeReformat op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), (InterpFlops(interp, scale) + kNormalizeFlops) * NumValues(*out)}, N,
+        [&](cudaStream_t stream)
+        {
+            op(stream, *in, *base, *stddev, *out, interp, 1 / 255.f, 0, 0, CVCUDA_NORMALIZE_SCALE_IS_STDDEV);
+        });
+}
+
+void ResizeNormalizeReformatVarShape(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp,
+                                     double scale)
+{
+    int          N       = BatchSize(state);
+    nvcv::Size2D outSize = Scale(ImageSize(state), scale);
+    ImageBatch   in(N, ImageSize(state), fmt);
+    auto         out    = CreateTensor({{N, fmt.numChannels(), outSize.h, outSize.w}, "NCHW"}, nvcv::TYPE_F32);
+    auto         base   = CreateTensor(1, {1, 1}, nvcv::FMT_RGBf32);
+    auto         stddev = CreateTensor(1, {1, 1}, nvcv::FMT_RGBf32);
+
+    cvcuda::ResizeNormalizeReformat op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), (InterpFlops(interp, scale) + kNormalizeFlops) * NumValues(*out)}, N,
+        [&](cudaStream_t stream)
+        {
+            op(stream, *in, *base, *stddev, *out, interp, 1 / 255.f, 0, 0, CVCUDA_NORMALIZE_SCALE_IS_STDDEV);
+        });
+}
+
+void ResizeNormalizeReformatNV12(benchmark::State &state, nvcv::DataType dtype, NVCVInterpolationType interp,
+                                 double scale)
+{
+    int          N       = BatchSize(state);
+    nvcv::Size2D inSize  = ImageSize(state);
+    nvcv::Size2D outSize = Scale(inSize, scale);
+    auto         luma    = CreateTensor({{N, inSize.h, inSize.w, 1}, "NHWC"}, dtype);
+    auto         chroma  = CreateTensor({{N, inSize.h / 2, inSize.w / 2, 2}, "NHWC"}, dtype);
+    auto         out     = CreateTensor({{N, 3, outSize.h, outSize.w}, "NCHW"}, nvcv::TYPE_F32);
+    auto         base    = CreateTensor(1, {1, 1}, nvcv::FMT_RGBf32);
+    auto         stddev  = CreateTensor(1, {1, 1}, nvcv::FMT_RGBf32);
+
+    Cost cost(NumBytes(*luma) + NumBytes(*chroma) + NumBytes(*out),
+              (InterpFlops(interp, scale) + kNormalizeFlops + kYuvToRgbFlops) * NumValues(*out));
+
+    cvcuda::ResizeNormalizeReformat op;
+    Run(state, cost, N,
+        [&](cudaStream_t stream)
+        {
+            op(stream, *luma, *chroma, nullptr, *base, *stddev, *out, NVCV_COLOR_YUV2RGB_NV12, interp, 1 / 255.f, 0,
+               0, CVCUDA_NORMALIZE_SCALE_IS_STDDEV);
+        });
+}
+
+CVCUDA_BENCH(ResizeNormalizeReformat, rgb8_linear_down, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, 0.5);
+CVCUDA_BENCH(ResizeNormalizeReformatVarShape, rgb8_linear_down, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, 0.5);
+CVCUDA_BENCH(ResizeNormalizeReformatNV12, nv12_linear_down, nvcv::TYPE_U8, NVCV_INTERP_LINEAR, 0.5);
+CVCUDA_BENCH(ResizeNormalizeReformatNV12, p016_linear_down, nvcv::TYPE_U16, NVCV_INTERP_LINEAR, 0.5);
+
+// Rotate --------------------------------------------------------------------
+
+// Operations per output pixel of the source coordinates of affine and perspective transforms
+constexpr int64_t kAffineFlops      = 8;
+constexpr int64_t kPerspectiveFlops = 13;
+
+template<class Out>
+int64_t WarpFlops(const Out &out, nvcv::ImageFormat fmt, NVCVInterpolationType interp, int64_t coordFlops)
+{
+    return (InterpFlops(interp) + coordFlops / fmt.numChannels()) * NumValues(out);
+}
+
+void Rotate(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp,
+            NVCVCoordinatePrecision precision)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, ImageSize(state), fmt);
+
+    double2 shift{ImageSize(state).w / 4.0, ImageSize(state).h / 4.0};
+
+    cvcuda::Rotate op(0, precision);
+    Run(state, {NumBytes(*in) + NumBytes(*out), WarpFlops(*out, fmt, interp, kAffineFlops)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, 30, shift, interp); });
+}
+
+// EXIF orientation fix, a quarter turn of the whole image into an output of transposed size
+void RotateRightAngle(benchmark::State &state, nvcv::ImageFormat fmt)
+{
+    int          N    = BatchSize(state);
+    nvcv::Size2D size = ImageSize(state);
+    auto         in   = CreateTensor(N, size, fmt);
+    auto         out  = CreateTensor(N, nvcv::Size2D{size.h, size.w}, fmt);
+
+    cvcuda::Rotate op(0);
+    Run(state, NumBytes(*in) + NumBytes(*out), N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, 90, double2{0, size.w - 1.0}, NVCV_INTERP_LINEAR); });
+}
+
+void RotateVarShape(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    std::vector<double> angles(N), shifts(2 * N);
+    for (int i = 0; i < N; ++i)
+    {
+        angles[i]         = 10.0 + i;
+        shifts[2 * i]     = in.sizes()[i].w / 4.0;
+        shifts[2 * i + 1] = in.sizes()[i].h / 4.0;
+    }
+    auto angle = CreateParam(nvcv::TensorShape({N}, "N"), nvcv::TYPE_F64, angles);
+    auto shift = CreateParam(nvcv::TensorShape({N, 2}, nvcv::TENSOR_NW), nvcv::TYPE_F64, shifts);
+
+    cvcuda::Rotate op(N);
+    Run(state, {NumBytes(*in) + NumBytes(*out), WarpFlops(*out, fmt, interp, kAffineFlops)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, *angle, *shift, interp); });
+}
+
+CVCUDA_BENCH(Rotate, rgb8_linear, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, NVCV_COORD_PRECISION_DEFAULT);
+CVCUDA_BENCH(Rotate, rgb8_linear_float, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, NVCV_COORD_PRECISION_FLOAT);
+CVCUDA_BENCH(Rotate, rgb8_linear_double, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, NVCV_COORD_PRECISION_DOUBLE);
+CVCUDA_BENCH(Rotate, rgbf32_linear, nvcv::FMT_RGBf32, NVCV_INTERP_LINEAR, NVCV_COORD_PRECISION_DEFAULT);
+CVCUDA_BENCH(RotateRightAngle, rgb8, nvcv::FMT_RGB8);
+CVCUDA_BENCH(RotateRightAngle, rgba8, nvcv::FMT_RGBA8);
+CVCUDA_BENCH(RotateVarShape, rgb8_linear, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR);
+
+// WarpAffine / WarpPerspective ----------------------------------------------
+
+// Mild rotation with some shearing, so that most of the output is inside the input
+const float kAffine[6]      = {0.95f, 0.1f, 10.f, -0.1f, 0.95f, 20.f};
+const float kPerspective[9] = {0.95f, 0.1f, 10.f, -0.1f, 0.95f, 20.f, 1e-5f, 2e-5f, 1.f};
+
+void WarpAffine(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, ImageSize(state), fmt);
+
+    NVCVAffineTransform xform;
+    std::memcpy(xform, kAffine, sizeof(xform));
+
+    cvcuda::WarpAffine op(0);
+    Run(state, {NumBytes(*in) + NumBytes(*out), WarpFlops(*out, fmt, interp, kAffineFlops)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *out, xform, interp, NVCV_BORDER_CONSTANT, float4{0, 0, 0, 0}); });
+}
+
+void WarpAffineVarShape(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    std::vector<float> xforms;
+    for (int i = 0; i < N; ++i)
+    {
+        xforms.insert(xforms.end(), std::begin(kAffine), std::end(kAffine));
+    }
+    auto xform = CreateParam(nvcv::TensorShape({N, 6}, nvcv::TENSOR_NW), nvcv::TYPE_F32, xforms);
+
+    cvcuda::WarpAffine op(N);
+    Run(state, {NumBytes(*in) + NumBytes(*out), WarpFlops(*out, fmt, interp, kAffineFlops)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *out, *xform, interp, NVCV_BORDER_CONSTANT, float4{0, 0, 0, 0}); });
+}
+
+void WarpPerspective(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, ImageSize(state), fmt);
+
+    NVCVPerspectiveTransform xform;
+    std::memcpy(xform, kPerspective, sizeof(xform));
+
+    cvcuda::WarpPerspective op(0);
+    Run(state, {NumBytes(*in) + NumBytes(*out), WarpFlops(*out, fmt, interp, kPerspectiveFlops)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *out, xform, interp, NVCV_BORDER_CONSTANT, float4{0, 0, 0, 0}); });
+}
+
+void WarpPerspectiveVarShape(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    std::vector<float> xforms;
+    for (int i = 0; i < N; ++i)
+    {
+        xforms.insert(xforms.end(), std::begin(kPerspective), std::end(kPerspective));
+    }
+    auto xform = CreateParam(nvcv::TensorShape({N, 9}, nvcv::TENSOR_NW), nvcv::TYPE_F32, xforms);
+
+    cvcuda::WarpPerspective op(N);
+    Run(state, {NumBytes(*in) + NumBytes(*out), WarpFlops(*out, fmt, interp, kPerspectiveFlops)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *out, *xform, interp, NVCV_BORDER_CONSTANT, float4{0, 0, 0, 0}); });
+}
+
+// OCR text-line rectification, slightly tilted lines of a page, each one straightened to 32 pixels high with a
+// length proportional to its own
+void WarpPerspectiveCrop(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp, int numLines)
+{
+    nvcv::Size2D size = ImageSize(state);
+    ImageBatch   in(1, size, fmt, false);
+
+    std::vector<float>        quads;
+    std::vector<nvcv::Size2D> dstSizes;
+    for (int i = 0; i < numLines; ++i)
+    {
+        float x0 = (i % 2) * size.w / 2.f, w = size.w / (2.f + i % 3), y0 = (i / 2) * 2.f * size.h / numLines;
+        float h = size.h / numLines, tilt = 0.1f * h;
+        quads.insert(quads.end(), {x0, y0 + tilt, x0 + w, y0, x0 + w, y0 + h, x0, y0 + h + tilt});
+        dstSizes.push_back({static_cast<int>(w * 32 / h), 32});
+    }
+    auto       quadTensor = CreateParam(nvcv::TensorShape({numLines, 8}, nvcv::TENSOR_NW), nvcv::TYPE_F32, quads);
+    ImageBatch out(dstSizes, fmt);
+
+    // about as many input bytes are read as output bytes written
+    cvcuda::WarpPerspective op(0);
+    Run(state, {NumBytes(*out) * 2, WarpFlops(*out, fmt, interp, kPerspectiveFlops)}, numLines,
+        [&](cudaStream_t stream)
+        { op.crop(stream, *in, *quadTensor, *out, interp, NVCV_BORDER_REPLICATE, float4{0, 0, 0, 0}); });
+}
+
+CVCUDA_BENCH(WarpAffine, rgb8_linear, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR);
+CVCUDA_BENCH(WarpAffine, rgbf32_linear, nvcv::FMT_RGBf32, NVCV_INTERP_LINEAR);
+CVCUDA_BENCH(WarpAffineVarShape, rgb8_linear, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR);
+CVCUDA_BENCH(WarpPerspective, rgb8_linear, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR);
+CVCUDA_BENCH(WarpPerspective, rgbf32_linear, nvcv::FMT_RGBf32, NVCV_INTERP_LINEAR);
+CVCUDA_BENCH(WarpPerspectiveVarShape, rgb8_linear, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR);
+CVCUDA_BENCH(WarpPerspectiveCrop, rgb8_linear_200_lines, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, 200);
+
+// Remap ---------------------------------------------------------------------
+
+// Lens undistortion: one map with a mild radial distortion shared by the whole batch, as float32 [x, y] or as
+// int16 [x, y, frac] fixed-point coordinates
+std::unique_ptr<nvcv::Tensor> CreateRemapMap(nvcv::Size2D size, bool fixed)
+{
+    std::vector<float>   fmap;
+    std::vector<int16_t> imap;
+    for (int y = 0; y < size.h; ++y)
+    {
+        for (int x = 0; x < size.w; ++x)
+        {
+            float u = 2.f * x / size.w - 1, v = 2.f * y / size.h - 1;
+            float k = 1 + 0.1f * (u * u + v * v);
+            float sx = (u * k + 1) * size.w / 2, sy = (v * k + 1) * size.h / 2;
+
+            int ix = static_cast<int>(sx * 32), iy = static_cast<int>(sy * 32);
+            fmap.insert(fmap.end(), {sx, sy});
+            imap.insert(imap.end(), {static_cast<int16_t>(ix >> 5), static_cast<int16_t>(iy >> 5),
+                                     static_cast<int16_t>(((iy & 31) << 5) | (ix & 31))});
+        }
+    }
+
+    // Rows of the map tensor may be padded, copy them one by one
+    nvcv::TensorShape shape({1, size.h, size.w, fixed ? 3 : 2}, nvcv::TENSOR_NHWC);
+    auto              map  = CreateTensor(shape, fixed ? nvcv::TYPE_S16 : nvcv::TYPE_F32);
+    auto             *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(map->exportData());
+
+    const void *src      = fixed ? static_cast<const void *>(imap.data()) : static_cast<const void *>(fmap.data());
+    size_t      rowBytes = size.w * (fixed ? 3 * sizeof(int16_t) : 2 * sizeof(float));
+    CHECK_CUDA(cudaMemcpy2D(data->basePtr(), data->stride(1), src, rowBytes, rowBytes, size.h,
+                            cudaMemcpyHostToDevice));
+
+    return map;
+}
+
+void Remap(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp, bool fixedMap)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, ImageSize(state), fmt);
+    auto map = CreateRemapMap(ImageSize(state), fixedMap);
+
+    cvcuda::Remap op;
+    Run(state, {NumBytes(*in) + NumBytes(*out) + NumBytes(*map), InterpFlops(interp) * NumValues(*out)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *out, *map, interp, NVCV_REMAP_ABSOLUTE, NVCV_BORDER_CONSTANT, float4{0, 0, 0, 0}); });
+}
+
+void RemapVarShape(benchmark::State &state, nvcv::ImageFormat fmt, NVCVInterpolationType interp, bool fixedMap)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+    auto       map = CreateRemapMap(ImageSize(state), fixedMap);
+
+    cvcuda::Remap op;
+    Run(state, {NumBytes(*in) + NumBytes(*out) + NumBytes(*map), InterpFlops(interp) * NumValues(*out)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *out, *map, interp, NVCV_REMAP_ABSOLUTE, NVCV_BORDER_CONSTANT, float4{0, 0, 0, 0}); });
+}
+
+CVCUDA_BENCH(Remap, rgb8_linear_float_map, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, false);
+CVCUDA_BENCH(Remap, rgb8_linear_fixed_map, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, true);
+CVCUDA_BENCH(Remap, rgb8_nearest_fixed_map, nvcv::FMT_RGB8, NVCV_INTERP_NEAREST, true);
+CVCUDA_BENCH(RemapVarShape, rgb8_linear_fixed_map, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR, true);
+
+// Flip ----------------------------------------------------------------------
+
+void Flip(benchmark::State &state, nvcv::ImageFormat fmt, int flipCode)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, ImageSize(state), fmt);
+
+    cvcuda::Flip op;
+    Run(state, NumBytes(*in) + NumBytes(*out), N, [&](cudaStream_t stream) { op(stream, *in, *out, flipCode); });
+}
+
+void FlipVarShape(benchmark::State &state, nvcv::ImageFormat fmt, int flipCode)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    auto codes = CreateParam(nvcv::TensorShape({N}, "N"), nvcv::TYPE_S32, std::vector<int>(N, flipCode));
+
+    cvcuda::Flip op(N);
+    Run(state, NumBytes(*in) + NumBytes(*out), N, [&](cudaStream_t stream) { op(stream, *in, *out, *codes); });
+}
+
+void FlipVarShapeStack(benchmark::State &state, nvcv::ImageFormat fmt, int flipCode)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt, false);
+    auto       out = CreateTensor(N, ImageSize(state), fmt);
+
+    auto codes = CreateParam(nvcv::TensorShape({N}, "N"), nvcv::TYPE_S32, std::vector<int>(N, flipCode));
+
+    cvcuda::Flip op(N);
+    Run(state, NumBytes(*in) + NumBytes(*out), N, [&](cudaStream_t stream) { op(stream, *in, *out, *codes); });
+}
+
+CVCUDA_BENCH(Flip, rgb8_horizontal, nvcv::FMT_RGB8, 1);
+CVCUDA_BENCH(Flip, rgb8_both, nvcv::FMT_RGB8, -1);
+CVCUDA_BENCH(Flip, rgbf32_horizontal, nvcv::FMT_RGBf32, 1);
+CVCUDA_BENCH(FlipVarShape, rgb8_horizontal, nvcv::FMT_RGB8, 1);
+CVCUDA_BENCH(FlipVarShape, rgba8_horizontal, nvcv::FMT_RGBA8, 1);
+CVCUDA_BENCH(FlipVarShapeStack, rgb8_horizontal, nvcv::FMT_RGB8, 1);
+
+// CenterCrop / CustomCrop ---------------------------------------------------
+
+void CenterCrop(benchmark::State &state, nvcv::ImageFormat fmt, double scale)
+{
+    int          N        = BatchSize(state);
+    nvcv::Size2D cropSize = Scale(ImageSize(state), scale);
+    auto         in       = CreateTensor(N, ImageSize(state), fmt);
+    auto         out      = CreateTensor(N, cropSize, fmt);
+
+    cvcuda::CenterCrop op;
+    Run(state, 2 * NumBytes(*out), N, [&](cudaStream_t stream) { op(stream, *in, *out, cropSize); });
+}
+
+void CustomCrop(benchmark::State &state, nvcv::ImageFormat fmt, double scale)
+{
+    int          N        = BatchSize(state);
+    nvcv::Size2D cropSize = Scale(ImageSize(state), scale);
+    auto         in       = CreateTensor(N, ImageSize(state), fmt);
+    auto         out      = CreateTensor(N, cropSize, fmt);
+
+    NVCVRectI rect{(ImageSize(state).w - cropSize.w) / 3, (ImageSize(state).h - cropSize.h) / 3, cropSize.w,
+                   cropSize.h};
+
+    cvcuda::CustomCrop op;
+    Run(state, 2 * NumBytes(*out), N, [&](cudaStream_t stream) { op(stream, *in, *out, rect); });
+}
+
+CVCUDA_BENCH(CenterCrop, rgb8_half, nvcv::FMT_RGB8, 0.5);
+CVCUDA_BENCH(CustomCrop, rgb8_half, nvcv::FMT_RGB8, 0.5);
+CVCUDA_BENCH(CustomCrop, rgbf32_half, nvcv::FMT_RGBf32, 0.5);
+
+// CopyMakeBorder / PadAndStack ----------------------------------------------
+
+nvcv::Size2D Padded(nvcv::Size2D size)
+{
+    return {size.w + 2 * kBorder, size.h + 2 * kBorder};
+}
+
+void CopyMakeBorder(benchmark::State &state, nvcv::ImageFormat fmt, NVCVBorderType border)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, Padded(ImageSize(state)), fmt);
+
+    cvcuda::CopyMakeBorder op;
+    Run(state, NumBytes(*in) + NumBytes(*out), N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, kBorder, kBorder, border, float4{0, 0, 0, 0}); });
+}
+
+void CopyMakeBorderVarShape(benchmark::State &state, nvcv::ImageFormat fmt, NVCVBorderType border)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+
+    std::vector<nvcv::Size2D> outSizes;
+    for (nvcv::Size2D size : in.sizes())
+    {
+        outSizes.push_back(Padded(size));
+    }
+    ImageBatch out(outSizes, fmt);
+
+    auto top  = CreateParam(nvcv::TensorShape({1, 1, N, 1}, nvcv::TENSOR_NHWC), nvcv::TYPE_S32,
+                            std::vector<int>(N, kBorder));
+    auto left = CreateParam(nvcv::TensorShape({1, 1, N, 1}, nvcv::TENSOR_NHWC), nvcv::TYPE_S32,
+                            std::vector<int>(N, kBorder));
+
+    cvcuda::CopyMakeBorder op;
+    Run(state, NumBytes(*in) + NumBytes(*out), N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, *top, *left, border, float4{0, 0, 0, 0}); });
+}
+
+void PadAndStack(benchmark::State &state, nvcv::ImageFormat fmt, NVCVBorderType border)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    auto       out = CreateTensor(N, Padded(ImageSize(state)), fmt);
+
+    auto top  = CreateParam(nvcv::TensorShape({1, 1, N, 1}, nvcv::TENSOR_NHWC), nvcv::TYPE_S32,
+                            std::vector<int>(N, kBorder));
+    auto left = CreateParam(nvcv::TensorShape({1, 1, N, 1}, nvcv::TENSOR_NHWC), nvcv::TYPE_S32,
+                            std::vector<int>(N, kBorder));
+
+    cvcuda::PadAndStack op;
+    Run(state, NumBytes(*in) + NumBytes(*out), N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, *top, *left, border, 0); });
+}
+
+CVCUDA_BENCH(CopyMakeBorder, rgb8_constant, nvcv::FMT_RGB8, NVCV_BORDER_CONSTANT);
+CVCUDA_BENCH(CopyMakeBorder, rgb8_reflect, nvcv::FMT_RGB8, NVCV_BORDER_REFLECT);
+CVCUDA_BENCH(CopyMakeBorder, rgbf32_constant, nvcv::FMT_RGBf32, NVCV_BORDER_CONSTANT);
+CVCUDA_BENCH(CopyMakeBorderVarShape, rgb8_constant, nvcv::FMT_RGB8, NVCV_BORDER_CONSTANT);
+CVCUDA_BENCH(PadAndStack, rgb8_constant, nvcv::FMT_RGB8, NVCV_BORDER_CONSTANT);
+
+} // namespace
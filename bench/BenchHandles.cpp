@@ -0,0 +1,178 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmarks of the CPU cost of the C API: creating, wrapping and destroying handles, and creating operators.
+// They time host calls only, nothing is submitted to the device. Each benchmark also runs on several threads,
+// each with its own handles, to measure the contention on the shared handle managers and allocators.
+
+#include "BenchUtils.hpp"
+
+#include <cvcuda/OpGaussian.h>
+#include <cvcuda/OpReformat.h>
+#include <cvcuda/OpResize.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Tensor.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+using namespace cvcuda::bench;
+
+// Multithreaded runs report the wall time per call of each thread
+#define CVCUDA_BENCH_HANDLES(func) BENCHMARK(func)->ThreadRange(1, 16)->UseRealTime()
+
+void Check(benchmark::State &state, NVCVStatus status)
+{
+    if (status != NVCV_SUCCESS)
+    {
+        state.SkipWithError(nvcvStatusGetName(status));
+    }
+}
+
+// Tensors --------------------------------------------------------------------
+
+nvcv::Tensor SmallTensor()
+{
+    return nvcv::Tensor(1, {224, 224}, nvcv::FMT_RGB8);
+}
+
+void TensorWrapData(benchmark::State &state)
+{
+    nvcv::Tensor   tensor = SmallTensor();
+    NVCVTensorData data;
+    Check(state, nvcvTensorExportData(tensor.handle(), &data));
+
+    for (auto _ : state)
+    {
+        NVCVTensorHandle handle;
+        Check(state, nvcvTensorWrapDataConstruct(&data, nullptr, nullptr, &handle));
+        Check(state, nvcvTensorDecRef(handle, nullptr));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Includes the allocation and free of the tensor memory by the default allocator
+void TensorConstruct(benchmark::State &state)
+{
+    NVCVTensorRequirements reqs;
+    Check(state, nvcvTensorCalcRequirementsForImages(1, 224, 224, NVCV_IMAGE_FORMAT_RGB8, 0, 0, &reqs));
+
+    for (auto _ : state)
+    {
+        NVCVTensorHandle handle;
+        Check(state, nvcvTensorConstruct(&reqs, nullptr, &handle));
+        Check(state, nvcvTensorDecRef(handle, nullptr));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void TensorRefCount(benchmark::State &state)
+{
+    nvcv::Tensor tensor = SmallTensor();
+
+    for (auto _ : state)
+    {
+        Check(state, nvcvTensorIncRef(tensor.handle(), nullptr));
+        Check(state, nvcvTensorDecRef(tensor.handle(), nullptr));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Handle validation and access to the object, as done by every operator on its arguments
+void TensorGetShape(benchmark::State &state)
+{
+    nvcv::Tensor tensor = SmallTensor();
+
+    for (auto _ : state)
+    {
+        int32_t rank = NVCV_TENSOR_MAX_RANK;
+        int64_t shape[NVCV_TENSOR_MAX_RANK];
+        Check(state, nvcvTensorGetShape(tensor.handle(), &rank, shape));
+        benchmark::DoNotOptimize(shape);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+CVCUDA_BENCH_HANDLES(TensorWrapData);
+CVCUDA_BENCH_HANDLES(TensorConstruct);
+CVCUDA_BENCH_HANDLES(TensorRefCount);
+CVCUDA_BENCH_HANDLES(TensorGetShape);
+
+// ImageBatchVarShape ---------------------------------------------------------
+
+// Pushes state.range(0) images to a batch and clears it, as done for every batch of a varshape pipeline
+void ImageBatchPushImages(benchmark::State &state)
+{
+    const int numImages = static_cast<int>(state.range(0));
+
+    std::vector<std::unique_ptr<nvcv::Image>> images;
+    std::vector<NVCVImageHandle>              handles;
+    for (int i = 0; i < numImages; ++i)
+    {
+        images.push_back(std::make_unique<nvcv::Image>(nvcv::Size2D{64, 64}, nvcv::FMT_RGB8));
+        handles.push_back(images.back()->handle());
+    }
+
+    nvcv::ImageBatchVarShape batch(numImages);
+
+    for (auto _ : state)
+    {
+        Check(state, nvcvImageBatchVarShapePushImages(batch.handle(), handles.data(), numImages));
+        Check(state, nvcvImageBatchVarShapeClear(batch.handle()));
+    }
+    state.SetItemsProcessed(state.iterations() * numImages);
+}
+
+BENCHMARK(ImageBatchPushImages)->ArgName("images")->Arg(1)->Arg(32)->Arg(256)->ThreadRange(1, 16)->UseRealTime();
+
+// Operators ------------------------------------------------------------------
+
+template<class F>
+void OperatorCreate(benchmark::State &state, F &&create)
+{
+    for (auto _ : state)
+    {
+        NVCVOperatorHandle handle;
+        Check(state, create(&handle));
+        nvcvOperatorDestroy(handle);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void ResizeCreate(benchmark::State &state)
+{
+    OperatorCreate(state, [](NVCVOperatorHandle *handle) { return cvcudaResizeCreate(handle); });
+}
+
+void ReformatCreate(benchmark::State &state)
+{
+    OperatorCreate(state, [](NVCVOperatorHandle *handle) { return cvcudaReformatCreate(handle); });
+}
+
+// Allocates device workspace for the kernels of a varshape batch
+void GaussianCreate(benchmark::State &state)
+{
+    OperatorCreate(state, [](NVCVOperatorHandle *handle) { return cvcudaGaussianCreate(handle, 7, 7, 32); });
+}
+
+CVCUDA_BENCH_HANDLES(ResizeCreate);
+CVCUDA_BENCH_HANDLES(ReformatCreate);
+CVCUDA_BENCH_HANDLES(GaussianCreate);
+
+} // namespace
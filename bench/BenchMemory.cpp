@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmarks of operators on mask-like data allocated as compressible memory,
+// against the same data in regular cuda memory.
+
+#include "BenchUtils.hpp"
+
+#include <cvcuda/OpComposite.hpp>
+#include <cvcuda/OpErase.hpp>
+#include <cvcuda/OpMorphology.hpp>
+#include <nvcv/alloc/CompressibleAllocator.hpp>
+
+namespace {
+
+using namespace cvcuda::bench;
+
+// Allocator of the benchmark variant, null for the default one. Variants that
+// ask for compression are skipped on devices that don't support it.
+nvcv::IAllocator *Allocator(benchmark::State &state, bool compressible)
+{
+    if (!compressible)
+    {
+        state.SetLabel("uncompressed");
+        return nullptr;
+    }
+
+    static nvcv::CompressibleAllocator alloc;
+    if (!alloc.compressible())
+    {
+        state.SkipWithError("Device doesn't support compressible memory");
+        return nullptr;
+    }
+    state.SetLabel("compressed");
+    return &alloc;
+}
+
+// Tensor of binary masks: zero, with a filled rectangle over the central
+// quarter of each image, as a segmentation mask or a padded frame would be.
+std::unique_ptr<nvcv::Tensor> CreateMask(int numImages, nvcv::Size2D size, nvcv::ImageFormat fmt,
+                                         nvcv::IAllocator *alloc)
+{
+    auto tensor = std::make_unique<nvcv::Tensor>(numImages, size, fmt, nvcv::MemAlignment{}, alloc);
+
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor->exportData());
+    if (data == nullptr)
+    {
+        throw std::runtime_error("Tensor must be cuda-accessible, pitch-linear");
+    }
+
+    const int64_t pixelBytes = fmt.planePixelStrideBytes(0);
+    const int64_t rowStride  = data->stride(1);
+
+    CHECK_CUDA(cudaMemset(data->basePtr(), 0, data->stride(0) * data->shape(0)));
+    for (int n = 0; n < numImages; ++n)
+    {
+        auto *rect = data->basePtr() + n * data->stride(0) + size.h / 4 * rowStride + size.w / 4 * pixelBytes;
+        CHECK_CUDA(cudaMemset2D(rect, rowStride, 0xFF, size.w / 2 * pixelBytes, size.h / 2));
+    }
+
+    return tensor;
+}
+
+// Composite -----------------------------------------------------------------
+
+void Composite(benchmark::State &state, bool compressible)
+{
+    nvcv::IAllocator *alloc = Allocator(state, compressible);
+    if (state.error_occurred())
+    {
+        return;
+    }
+
+    int  N          = BatchSize(state);
+    auto foreground = CreateTensor(N, ImageSize(state), nvcv::FMT_RGB8, alloc);
+    auto background = CreateMask(N, ImageSize(state), nvcv::FMT_RGB8, alloc);
+    auto mask       = CreateMask(N, ImageSize(state), nvcv::FMT_U8, alloc);
+    auto out        = CreateTensor(N, ImageSize(state), nvcv::FMT_RGB8, alloc);
+
+    cvcuda::Composite op;
+    Run(state, {2 * NumBytes(*foreground) + NumBytes(*mask) + NumBytes(*out), 3 * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *foreground, *background, *mask, *out); });
+}
+
+CVCUDA_BENCH(Composite, rgb8_uncompressed, false);
+CVCUDA_BENCH(Composite, rgb8_compressed, true);
+
+// Morphology ----------------------------------------------------------------
+
+void Morphology(benchmark::State &state, bool compressible)
+{
+    nvcv::IAllocator *alloc = Allocator(state, compressible);
+    if (state.error_occurred())
+    {
+        return;
+    }
+
+    const int ksize = 5;
+
+    int  N   = BatchSize(state);
+    auto in  = CreateMask(N, ImageSize(state), nvcv::FMT_U8, alloc);
+    auto out = CreateMask(N, ImageSize(state), nvcv::FMT_U8, alloc);
+
+    cvcuda::Morphology op(0);
+    Run(state, {NumBytes(*in) + NumBytes(*out), ksize * ksize * NumValues(*out)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *out, NVCV_DILATE, {ksize, ksize}, int2{-1, -1}, 1, NVCV_BORDER_CONSTANT); });
+}
+
+CVCUDA_BENCH(Morphology, u8_mask_dilate_k5_uncompressed, false);
+CVCUDA_BENCH(Morphology, u8_mask_dilate_k5_compressed, true);
+
+// Erase ---------------------------------------------------------------------
+
+void Erase(benchmark::State &state, bool compressible)
+{
+    nvcv::IAllocator *alloc = Allocator(state, compressible);
+    if (state.error_occurred())
+    {
+        return;
+    }
+
+    int          N    = BatchSize(state);
+    nvcv::Size2D size = ImageSize(state);
+    auto         in   = CreateMask(N, size, nvcv::FMT_RGB8, alloc);
+    auto         out  = CreateMask(N, size, nvcv::FMT_RGB8, alloc);
+
+    // one area erased to black over the left half of each image
+    auto anchor  = CreateParam(nvcv::TensorShape({N}, "N"), nvcv::TYPE_2S32, std::vector<int2>(N, int2{0, 0}));
+    auto erasing = CreateParam(nvcv::TensorShape({N}, "N"), nvcv::TYPE_3S32,
+                               std::vector<int3>(N, int3{size.w / 2, size.h, 0x7}));
+    auto values  = CreateParam(nvcv::TensorShape({N}, "N"), nvcv::TYPE_F32, std::vector<float>(N, 0.f));
+
+    std::vector<int> imgIdxVec(N);
+    for (int n = 0; n < N; ++n) imgIdxVec[n] = n;
+    auto imgIdx = CreateParam(nvcv::TensorShape({N}, "N"), nvcv::TYPE_S32, imgIdxVec);
+
+    cvcuda::Erase op(N);
+    Run(state, NumBytes(*in) + NumBytes(*out), N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, *anchor, *erasing, *values, *imgIdx, false, 0); });
+}
+
+CVCUDA_BENCH(Erase, rgb8_mask_uncompressed, false);
+CVCUDA_BENCH(Erase, rgb8_mask_compressed, true);
+
+} // namespace
@@ -0,0 +1,375 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmarks of per-pixel operators: color and type conversions, normalization,
+// layout changes and blending.
+
+#include "BenchUtils.hpp"
+
+#include <cvcuda/OpChannelReorder.hpp>
+#include <cvcuda/OpComposite.hpp>
+#include <cvcuda/OpConvertTo.hpp>
+#include <cvcuda/OpCvtColor.hpp>
+#include <cvcuda/OpErase.hpp>
+#include <cvcuda/OpGammaContrast.hpp>
+#include <cvcuda/OpNormalize.hpp>
+#include <cvcuda/OpOSD.hpp>
+#include <cvcuda/OpReformat.hpp>
+
+namespace {
+
+using namespace cvcuda::bench;
+
+// CvtColor ------------------------------------------------------------------
+
+// Operations per output pixel, channel swaps and alpha changes don't compute anything
+int64_t CvtColorFlops(NVCVColorConversionCode code)
+{
+    switch (code)
+    {
+    case NVCV_COLOR_RGB2GRAY:
+        return 5;
+    case NVCV_COLOR_BGR2HSV:
+        return 20;
+    default:
+        return 0;
+    }
+}
+
+void CvtColor(benchmark::State &state, nvcv::ImageFormat inFmt, nvcv::ImageFormat outFmt,
+              NVCVColorConversionCode code)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), inFmt);
+    auto out = CreateTensor(N, ImageSize(state), outFmt);
+
+    Cost cost(NumBytes(*in) + NumBytes(*out), CvtColorFlops(code) * NumValues(*out) / outFmt.numChannels());
+
+    cvcuda::CvtColor op;
+    Run(state, cost, N, [&](cudaStream_t stream) { op(stream, *in, *out, code); });
+}
+
+void CvtColorVarShape(benchmark::State &state, nvcv::ImageFormat inFmt, nvcv::ImageFormat outFmt,
+                      NVCVColorConversionCode code)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), inFmt, false);
+    ImageBatch out(N, ImageSize(state), outFmt, false);
+
+    Cost cost(NumBytes(*in) + NumBytes(*out), CvtColorFlops(code) * NumValues(*out) / outFmt.numChannels());
+
+    cvcuda::CvtColor op;
+    Run(state, cost, N, [&](cudaStream_t stream) { op(stream, *in, *out, code); });
+}
+
+CVCUDA_BENCH(CvtColor, rgb8_to_bgr8, nvcv::FMT_RGB8, nvcv::FMT_BGR8, NVCV_COLOR_RGB2BGR);
+CVCUDA_BENCH(CvtColor, rgb8_to_gray, nvcv::FMT_RGB8, nvcv::FMT_U8, NVCV_COLOR_RGB2GRAY);
+CVCUDA_BENCH(CvtColor, bgr8_to_hsv8, nvcv::FMT_BGR8, nvcv::FMT_HSV8, NVCV_COLOR_BGR2HSV);
+CVCUDA_BENCH(CvtColor, rgba8_to_bgra8, nvcv::FMT_RGBA8, nvcv::FMT_BGRA8, NVCV_COLOR_RGBA2BGRA);
+CVCUDA_BENCH(CvtColor, rgb8_to_rgba8, nvcv::FMT_RGB8, nvcv::FMT_RGBA8, NVCV_COLOR_RGB2RGBA);
+CVCUDA_BENCH(CvtColorVarShape, rgb8_to_bgr8, nvcv::FMT_RGB8, nvcv::FMT_BGR8, NVCV_COLOR_RGB2BGR);
+
+// ConvertTo -----------------------------------------------------------------
+
+void ConvertTo(benchmark::State &state, nvcv::ImageFormat inFmt, nvcv::ImageFormat outFmt)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), inFmt);
+    auto out = CreateTensor(N, ImageSize(state), outFmt);
+
+    cvcuda::ConvertTo op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), 2 * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, 1 / 255.0, 0); });
+}
+
+CVCUDA_BENCH(ConvertTo, rgb8_to_rgbf32, nvcv::FMT_RGB8, nvcv::FMT_RGBf32);
+CVCUDA_BENCH(ConvertTo, rgbf32_to_rgb8, nvcv::FMT_RGBf32, nvcv::FMT_RGB8);
+
+// Mean/stddev preprocessing into planar float, in a single pass
+void ConvertToPerChannel(benchmark::State &state, nvcv::ImageFormat outFmt)
+{
+    int  N     = BatchSize(state);
+    auto in    = CreateTensor(N, ImageSize(state), nvcv::FMT_RGB8);
+    auto out   = CreateTensor(N, ImageSize(state), outFmt);
+    auto alpha = CreateParam(nvcv::TensorShape({3}, "W"), nvcv::TYPE_F32, std::vector<float>{0.017f, 0.018f, 0.017f});
+    auto beta  = CreateParam(nvcv::TensorShape({3}, "W"), nvcv::TYPE_F32, std::vector<float>{-2.1f, -2.0f, -1.8f});
+
+    cvcuda::ConvertTo op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), 2 * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *in, *out, *alpha, *beta); });
+}
+
+CVCUDA_BENCH(ConvertToPerChannel, rgb8_to_rgbf32, nvcv::FMT_RGBf32);
+CVCUDA_BENCH(ConvertToPerChannel, rgb8_to_rgbf32p, nvcv::FMT_RGBf32p);
+
+// Normalize -----------------------------------------------------------------
+
+// (x - base) * scale * globalScale + shift
+constexpr int64_t kNormalizeFlops = 4;
+
+void Normalize(benchmark::State &state, nvcv::ImageFormat fmt, NVCVSwizzle channelOrder = NVCV_SWIZZLE_XYZW)
+{
+    int  N      = BatchSize(state);
+    auto in     = CreateTensor(N, ImageSize(state), fmt);
+    auto out    = CreateTensor(N, ImageSize(state), fmt);
+    auto base   = CreateTensor(1, {1, 1}, nvcv::FMT_RGBf32);
+    auto stddev = CreateTensor(1, {1, 1}, nvcv::FMT_RGBf32);
+
+    cvcuda::Normalize op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), kNormalizeFlops * NumValues(*out)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *base, *stddev, *out, 1.f, 0.f, 0.f, CVCUDA_NORMALIZE_SCALE_IS_STDDEV, channelOrder); });
+}
+
+void NormalizeVarShape(benchmark::State &state, nvcv::ImageFormat fmt)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt, false);
+    ImageBatch out(N, ImageSize(state), fmt, false);
+
+    auto base   = CreateTensor(1, {1, 1}, nvcv::FMT_RGBf32);
+    auto stddev = CreateTensor(1, {1, 1}, nvcv::FMT_RGBf32);
+
+    cvcuda::Normalize op;
+    Run(state, {NumBytes(*in) + NumBytes(*out), kNormalizeFlops * NumValues(*out)}, N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *base, *stddev, *out, 1.f, 0.f, 0.f, CVCUDA_NORMALIZE_SCALE_IS_STDDEV); });
+}
+
+CVCUDA_BENCH(Normalize, rgb8, nvcv::FMT_RGB8);
+CVCUDA_BENCH(Normalize, rgbf32, nvcv::FMT_RGBf32);
+CVCUDA_BENCH(Normalize, bgr8_to_rgb8, nvcv::FMT_RGB8, NVCV_SWIZZLE_ZYXW);
+CVCUDA_BENCH(NormalizeVarShape, rgb8, nvcv::FMT_RGB8);
+
+// Reformat ------------------------------------------------------------------
+
+void Reformat(benchmark::State &state, nvcv::DataType dtype, bool toPlanar)
+{
+    int          N    = BatchSize(state);
+    nvcv::Size2D size = ImageSize(state);
+
+    nvcv::TensorShape interleaved({N, size.h, size.w, 3}, nvcv::TENSOR_NHWC);
+    nvcv::TensorShape planar({N, 3, size.h, size.w}, nvcv::TENSOR_NCHW);
+
+    auto in  = CreateTensor(toPlanar ? interleaved : planar, dtype);
+    auto out = CreateTensor(toPlanar ? planar : interleaved, dtype);
+
+    cvcuda::Reformat op;
+    Run(state, NumBytes(*in) + NumBytes(*out), N, [&](cudaStream_t stream) { op(stream, *in, *out); });
+}
+
+CVCUDA_BENCH(Reformat, u8_nhwc_to_nchw, nvcv::TYPE_U8, true);
+CVCUDA_BENCH(Reformat, u8_nchw_to_nhwc, nvcv::TYPE_U8, false);
+CVCUDA_BENCH(Reformat, f32_nhwc_to_nchw, nvcv::TYPE_F32, true);
+CVCUDA_BENCH(Reformat, f32_nchw_to_nhwc, nvcv::TYPE_F32, false);
+
+// ChannelReorder ------------------------------------------------------------
+
+void ChannelReorderVarShape(benchmark::State &state, nvcv::ImageFormat fmt)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    int              channels = fmt.numChannels();
+    std::vector<int> orderVec;
+    for (int i = 0; i < N; ++i)
+    {
+        for (int c = 0; c < channels; ++c)
+        {
+            orderVec.push_back(channels - 1 - c);
+        }
+    }
+    auto orders = CreateParam(nvcv::TensorShape({N, channels}, "NC"), nvcv::TYPE_S32, orderVec);
+
+    cvcuda::ChannelReorder op;
+    Run(state, NumBytes(*in) + NumBytes(*out), N, [&](cudaStream_t stream) { op(stream, *in, *out, *orders); });
+}
+
+CVCUDA_BENCH(ChannelReorderVarShape, rgba8_reverse, nvcv::FMT_RGBA8);
+
+// GammaContrast -------------------------------------------------------------
+
+void GammaContrastVarShape(benchmark::State &state, nvcv::ImageFormat fmt)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    auto gamma = CreateParam(nvcv::TensorShape({N * fmt.numChannels()}, "N"), nvcv::TYPE_F32,
+                             std::vector<float>(N * fmt.numChannels(), 0.5f));
+
+    cvcuda::GammaContrast op(N, fmt.numChannels());
+    Run(state, NumBytes(*in) + NumBytes(*out), N, [&](cudaStream_t stream) { op(stream, *in, *out, *gamma); });
+}
+
+CVCUDA_BENCH(GammaContrastVarShape, rgb8, nvcv::FMT_RGB8);
+CVCUDA_BENCH(GammaContrastVarShape, rgbf32, nvcv::FMT_RGBf32);
+
+// Composite -----------------------------------------------------------------
+
+// a * (foreground - background) + background
+constexpr int64_t kCompositeFlops = 3;
+
+void Composite(benchmark::State &state, nvcv::ImageFormat fmt)
+{
+    int  N          = BatchSize(state);
+    auto foreground = CreateTensor(N, ImageSize(state), fmt);
+    auto background = CreateTensor(N, ImageSize(state), fmt);
+    auto mask       = CreateTensor(N, ImageSize(state), nvcv::FMT_U8);
+    auto out        = CreateTensor(N, ImageSize(state), fmt);
+
+    cvcuda::Composite op;
+    Run(state, {2 * NumBytes(*foreground) + NumBytes(*mask) + NumBytes(*out), kCompositeFlops * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *foreground, *background, *mask, *out); });
+}
+
+void CompositeVarShape(benchmark::State &state, nvcv::ImageFormat fmt)
+{
+    int        N = BatchSize(state);
+    ImageBatch foreground(N, ImageSize(state), fmt);
+    ImageBatch background(foreground.sizes(), fmt);
+    ImageBatch mask(foreground.sizes(), nvcv::FMT_U8);
+    ImageBatch out(foreground.sizes(), fmt);
+
+    cvcuda::Composite op;
+    Run(state, {2 * NumBytes(*foreground) + NumBytes(*mask) + NumBytes(*out), kCompositeFlops * NumValues(*out)}, N,
+        [&](cudaStream_t stream) { op(stream, *foreground, *background, *mask, *out); });
+}
+
+CVCUDA_BENCH(Composite, rgb8, nvcv::FMT_RGB8);
+CVCUDA_BENCH(CompositeVarShape, rgb8, nvcv::FMT_RGB8);
+
+// OSD -----------------------------------------------------------------------
+
+// Detections of a frame: boxes of 1/16 x 1/16 of the image outlined 2 pixels thick, each with a label of 8 glyphs of
+// 8x16 pixels above it.
+constexpr int kNumOSDBoxes   = 64;
+constexpr int kNumOSDGlyphs  = 8;
+constexpr int kOSDGlyphW     = 8;
+constexpr int kOSDGlyphH     = 16;
+constexpr int kOSDElementLen = 12;
+
+void OSD(benchmark::State &state, nvcv::ImageFormat fmt)
+{
+    int  N    = BatchSize(state);
+    auto size = ImageSize(state);
+    auto img  = CreateTensor(N, size, fmt);
+
+    const float2 boxSize{static_cast<float>(size.w) / 16, static_cast<float>(size.h) / 16};
+
+    std::vector<float> elementValues;
+    for (int n = 0; n < N; ++n)
+    {
+        for (int i = 0; i < kNumOSDBoxes; ++i)
+        {
+            const float x = (i % 8) * 2 * boxSize.x, y = (i / 8) * 2 * boxSize.y + kOSDGlyphH;
+
+            const float box[kOSDElementLen] = {NVCV_OSD_RECT, 0, 255, 0, 255, x, y, x + boxSize.x, y + boxSize.y, 2};
+            elementValues.insert(elementValues.end(), box, box + kOSDElementLen);
+
+            for (int g = 0; g < kNumOSDGlyphs; ++g)
+            {
+                const float gx = x + g * kOSDGlyphW, gy = y - kOSDGlyphH, index = g;
+
+                const float glyph[kOSDElementLen] = {NVCV_OSD_GLYPH, 255, 255, 255, 255, gx, gy, 1, index};
+                elementValues.insert(elementValues.end(), glyph, glyph + kOSDElementLen);
+            }
+        }
+    }
+
+    const int numElements = kNumOSDBoxes * (1 + kNumOSDGlyphs);
+
+    auto elements = CreateParam(nvcv::TensorShape({N, 1, numElements, kOSDElementLen}, nvcv::TENSOR_NHWC),
+                                nvcv::TYPE_F32, elementValues);
+    auto glyphs   = CreateParam(nvcv::TensorShape({kNumOSDGlyphs, kOSDGlyphH, kOSDGlyphW, 1}, nvcv::TENSOR_NHWC),
+                                nvcv::TYPE_U8, std::vector<uint8_t>(kNumOSDGlyphs * kOSDGlyphH * kOSDGlyphW, 255));
+
+    // each drawn pixel is read and written once
+    const int64_t pixels  = static_cast<int64_t>(N) * size.w * size.h;
+    const int64_t outline = 2 * 2 * static_cast<int64_t>(boxSize.x + boxSize.y);
+    const int64_t drawn   = N * kNumOSDBoxes * (outline + kNumOSDGlyphs * kOSDGlyphW * kOSDGlyphH);
+
+    cvcuda::OSD op(N, numElements);
+    Run(state, {2 * NumBytes(*img) * drawn / pixels, kCompositeFlops * NumValues(*img) * drawn / pixels}, N,
+        [&](cudaStream_t stream) { op(stream, *img, *elements, nullptr, nullptr, glyphs.get()); });
+}
+
+CVCUDA_BENCH(OSD, rgb8_detections, nvcv::FMT_RGB8);
+
+// Erase ---------------------------------------------------------------------
+
+constexpr int kNumErasingAreas = 16;
+
+struct ErasingAreas
+{
+    explicit ErasingAreas(int numImages, nvcv::Size2D size)
+    {
+        std::vector<int2>  anchorVec;
+        std::vector<int3>  erasingVec;
+        std::vector<float> valuesVec;
+        std::vector<int>   imgIdxVec;
+
+        for (int i = 0; i < kNumErasingAreas; ++i)
+        {
+            anchorVec.push_back(int2{(i * size.w) / (2 * kNumErasingAreas), (i * size.h) / (2 * kNumErasingAreas)});
+            erasingVec.push_back(int3{size.w / 4, size.h / 4, 0x7});
+            valuesVec.push_back(static_cast<float>(i));
+            imgIdxVec.push_back(i % numImages);
+        }
+
+        anchor  = CreateParam(nvcv::TensorShape({kNumErasingAreas}, "N"), nvcv::TYPE_2S32, anchorVec);
+        erasing = CreateParam(nvcv::TensorShape({kNumErasingAreas}, "N"), nvcv::TYPE_3S32, erasingVec);
+        values  = CreateParam(nvcv::TensorShape({kNumErasingAreas}, "N"), nvcv::TYPE_F32, valuesVec);
+        imgIdx  = CreateParam(nvcv::TensorShape({kNumErasingAreas}, "N"), nvcv::TYPE_S32, imgIdxVec);
+    }
+
+    std::unique_ptr<nvcv::Tensor> anchor, erasing, values, imgIdx;
+};
+
+void Erase(benchmark::State &state, nvcv::ImageFormat fmt)
+{
+    int  N   = BatchSize(state);
+    auto in  = CreateTensor(N, ImageSize(state), fmt);
+    auto out = CreateTensor(N, ImageSize(state), fmt);
+
+    ErasingAreas areas(N, ImageSize(state));
+
+    cvcuda::Erase op(kNumErasingAreas);
+    Run(state, NumBytes(*in) + NumBytes(*out), N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *out, *areas.anchor, *areas.erasing, *areas.values, *areas.imgIdx, false, 0); });
+}
+
+void EraseVarShape(benchmark::State &state, nvcv::ImageFormat fmt)
+{
+    int        N = BatchSize(state);
+    ImageBatch in(N, ImageSize(state), fmt);
+    ImageBatch out(in.sizes(), fmt);
+
+    ErasingAreas areas(N, Scale(ImageSize(state), 0.5));
+
+    cvcuda::Erase op(kNumErasingAreas);
+    Run(state, NumBytes(*in) + NumBytes(*out), N,
+        [&](cudaStream_t stream)
+        { op(stream, *in, *out, *areas.anchor, *areas.erasing, *areas.values, *areas.imgIdx, false, 0); });
+}
+
+CVCUDA_BENCH(Erase, rgb8, nvcv::FMT_RGB8);
+CVCUDA_BENCH(EraseVarShape, rgb8, nvcv::FMT_RGB8);
+
+} // namespace
@@ -0,0 +1,187 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the startup cost of CV-CUDA, which the benchmarks of cvcuda_bench can't as they run in a single,
+// warmed-up process. Each run is a new process that times the creation of the CUDA context, the first calls of a
+// few operators, which load their CUDA modules, and the same calls once loaded. Runs are done with eager and lazy
+// CUDA module loading, and the medians are reported:
+//   cvcuda_bench_startup [--runs=N]
+
+#include "BenchUtils.hpp"
+
+#include <cvcuda/OpGaussian.hpp>
+#include <cvcuda/OpMedianBlur.hpp>
+#include <cvcuda/OpResize.hpp>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace cvcuda::bench;
+using Clock = std::chrono::steady_clock;
+
+double Ms(Clock::time_point begin, Clock::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+// Timings of one run, in milliseconds, and the device memory used by the first calls in MB.
+struct Sample
+{
+    double process;
+    double context;
+    double firstCall;
+    double nextCall;
+    double deviceMem;
+};
+
+int RunChild()
+{
+    try
+    {
+        auto start = Clock::now();
+        CHECK_CUDA(cudaFree(nullptr));
+        auto context = Clock::now();
+
+        size_t freeBefore, freeAfter, total;
+        CHECK_CUDA(cudaMemGetInfo(&freeBefore, &total));
+
+        nvcv::Size2D size{1920, 1080};
+
+        auto in    = CreateTensor(1, size, nvcv::FMT_RGB8);
+        auto out   = CreateTensor(1, size, nvcv::FMT_RGB8);
+        auto small = CreateTensor(1, Scale(size, 0.5), nvcv::FMT_RGB8);
+
+        cvcuda::Resize     resize;
+        cvcuda::Gaussian   gaussian({5, 5}, 0);
+        cvcuda::MedianBlur median(0);
+
+        cudaStream_t stream = Stream();
+
+        auto pipeline = [&]
+        {
+            resize(stream, *in, *small, NVCV_INTERP_LINEAR);
+            gaussian(stream, *in, *out, {5, 5}, double2{1, 1}, NVCV_BORDER_REPLICATE);
+            median(stream, *in, *out, {3, 3});
+            CHECK_CUDA(cudaStreamSynchronize(stream));
+        };
+
+        auto beforeFirst = Clock::now();
+        pipeline();
+        auto afterFirst = Clock::now();
+        pipeline();
+        auto afterNext = Clock::now();
+
+        CHECK_CUDA(cudaMemGetInfo(&freeAfter, &total));
+
+        std::printf("%f %f %f %f\n", Ms(start, context), Ms(beforeFirst, afterFirst), Ms(afterFirst, afterNext),
+                    static_cast<double>(freeBefore - freeAfter) / (1 << 20));
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Startup run failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+bool RunProcess(const std::string &exe, const char *moduleLoading, Sample &sample)
+{
+    std::string cmd = std::string("CUDA_MODULE_LOADING=") + moduleLoading + " '" + exe + "' --child";
+
+    auto  start = Clock::now();
+    FILE *pipe  = popen(cmd.c_str(), "r");
+    if (pipe == nullptr)
+    {
+        return false;
+    }
+    int read = std::fscanf(pipe, "%lf %lf %lf %lf", &sample.context, &sample.firstCall, &sample.nextCall,
+                           &sample.deviceMem);
+    int status     = pclose(pipe);
+    sample.process = Ms(start, Clock::now());
+
+    return read == 4 && status == 0;
+}
+
+double Median(std::vector<Sample> &samples, double Sample::*field)
+{
+    std::sort(samples.begin(), samples.end(), [&](const Sample &a, const Sample &b) { return a.*field < b.*field; });
+    return samples[samples.size() / 2].*field;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    int runs = 5;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--child") == 0)
+        {
+            return RunChild();
+        }
+        else if (std::strncmp(argv[i], "--runs=", 7) == 0 && std::atoi(argv[i] + 7) > 0)
+        {
+            runs = std::atoi(argv[i] + 7);
+        }
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--runs=N]" << std::endl;
+            return 1;
+        }
+    }
+
+    // the children are started by the shell, whose /proc/self/exe isn't this one
+    char exe[4096];
+    auto len = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+    if (len <= 0)
+    {
+        std::cerr << "Can't find the benchmark executable" << std::endl;
+        return 1;
+    }
+    exe[len] = '\0';
+
+    std::printf("%-8s %12s %12s %14s %13s %14s\n", "loading", "process_ms", "context_ms", "first_call_ms",
+                "next_call_ms", "device_mem_mb");
+
+    for (const char *moduleLoading : {"EAGER", "LAZY"})
+    {
+        std::vector<Sample> samples(runs);
+        for (Sample &sample : samples)
+        {
+            if (!RunProcess(exe, moduleLoading, sample))
+            {
+                std::cerr << "Startup run with " << moduleLoading << " module loading failed" << std::endl;
+                return 1;
+            }
+        }
+
+        std::printf("%-8s %12.1f %12.1f %14.1f %13.1f %14.1f\n", moduleLoading, Median(samples, &Sample::process),
+                    Median(samples, &Sample::context), Median(samples, &Sample::firstCall),
+                    Median(samples, &Sample::nextCall), Median(samples, &Sample::deviceMem));
+    }
+
+    return 0;
+}
@@ -0,0 +1,289 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchUtils.hpp"
+
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <random>
+
+namespace cvcuda::bench {
+
+namespace {
+
+std::default_random_engine &Rng()
+{
+    static std::default_random_engine rng;
+    return rng;
+}
+
+// Fills a device buffer with random values representable in the given data kind,
+// float buffers get values in [0,1] so that operators don't work on NaNs.
+void FillRandom(void *ptr, int64_t size, nvcv::DataKind kind, int bitsPerChannel)
+{
+    std::vector<uint8_t> buf(size);
+
+    if (kind == nvcv::DataKind::FLOAT && bitsPerChannel == 32)
+    {
+        std::uniform_real_distribution<float> rand(0, 1);
+
+        float *fbuf = reinterpret_cast<float *>(buf.data());
+        std::generate(fbuf, fbuf + size / sizeof(float), [&] { return rand(Rng()); });
+    }
+    else if (kind == nvcv::DataKind::FLOAT && bitsPerChannel == 64)
+    {
+        std::uniform_real_distribution<double> rand(0, 1);
+
+        double *dbuf = reinterpret_cast<double *>(buf.data());
+        std::generate(dbuf, dbuf + size / sizeof(double), [&] { return rand(Rng()); });
+    }
+    else
+    {
+        std::uniform_int_distribution<int> rand(0, 255);
+        std::generate(buf.begin(), buf.end(), [&] { return rand(Rng()); });
+    }
+
+    CHECK_CUDA(cudaMemcpy(ptr, buf.data(), size, cudaMemcpyHostToDevice));
+}
+
+// FP32 lanes per multiprocessor, which isn't a device attribute
+int Fp32LanesPerSM(int major, int minor)
+{
+    switch (major)
+    {
+    case 3:
+        return 192;
+    case 6:
+        return minor == 0 ? 64 : 128;
+    case 7:
+        return 64;
+    case 8:
+        return minor == 0 ? 64 : 128;
+    default:
+        return 128;
+    }
+}
+
+DevicePeak QueryPeak()
+{
+    DevicePeak peak{0, 0};
+
+    int device;
+    if (cudaGetDevice(&device) != cudaSuccess)
+    {
+        return peak;
+    }
+
+    // Clock rates are in kHz, memory transfers twice per clock
+    int memClock = 0, busWidth = 0, clock = 0, numSMs = 0, major = 0, minor = 0;
+    if (cudaDeviceGetAttribute(&memClock, cudaDevAttrMemoryClockRate, device) == cudaSuccess
+        && cudaDeviceGetAttribute(&busWidth, cudaDevAttrGlobalMemoryBusWidth, device) == cudaSuccess)
+    {
+        peak.bytesPerSecond = 2.0 * memClock * 1000 * busWidth / 8;
+    }
+    if (cudaDeviceGetAttribute(&clock, cudaDevAttrClockRate, device) == cudaSuccess
+        && cudaDeviceGetAttribute(&numSMs, cudaDevAttrMultiProcessorCount, device) == cudaSuccess
+        && cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor, device) == cudaSuccess
+        && cudaDeviceGetAttribute(&minor, cudaDevAttrComputeCapabilityMinor, device) == cudaSuccess)
+    {
+        peak.flopsPerSecond = 2.0 * Fp32LanesPerSM(major, minor) * numSMs * clock * 1000;
+    }
+
+    // Failed queries leave the peak unknown, their error must not be seen by the benchmarks
+    cudaGetLastError();
+    return peak;
+}
+
+} // namespace
+
+cudaStream_t Stream()
+{
+    static cudaStream_t stream = []
+    {
+        cudaStream_t s;
+        CHECK_CUDA(cudaStreamCreateWithFlags(&s, cudaStreamNonBlocking));
+        return s;
+    }();
+    return stream;
+}
+
+void ImageArgs(benchmark::internal::Benchmark *b)
+{
+    b->ArgNames({"batch", "width", "height"});
+
+    for (int batch : {1, 8, 32})
+    {
+        b->Args({batch, 224, 224});
+        b->Args({batch, 1280, 720});
+        b->Args({batch, 1920, 1080});
+    }
+}
+
+int64_t NumBytes(const nvcv::ITensor &tensor)
+{
+    int64_t size = tensor.dtype().strideBytes();
+    for (int i = 0; i < tensor.rank(); ++i)
+    {
+        size *= tensor.shape()[i];
+    }
+    return size;
+}
+
+int64_t NumBytes(const nvcv::IImageBatchVarShape &batch)
+{
+    int64_t size = 0;
+    for (auto it = batch.begin(); it != batch.end(); ++it)
+    {
+        const nvcv::IImage &img = *it;
+        for (int p = 0; p < img.format().numPlanes(); ++p)
+        {
+            size += static_cast<int64_t>(img.format().planePixelStrideBytes(p)) * img.size().w * img.size().h;
+        }
+    }
+    return size;
+}
+
+int64_t NumValues(const nvcv::ITensor &tensor)
+{
+    return NumBytes(tensor) / tensor.dtype().strideBytes() * tensor.dtype().numChannels();
+}
+
+int64_t NumValues(const nvcv::IImageBatchVarShape &batch)
+{
+    int64_t count = 0;
+    for (auto it = batch.begin(); it != batch.end(); ++it)
+    {
+        const nvcv::IImage &img = *it;
+        count += static_cast<int64_t>(img.format().numChannels()) * img.size().w * img.size().h;
+    }
+    return count;
+}
+
+const DevicePeak &Peak()
+{
+    static const DevicePeak peak = QueryPeak();
+    return peak;
+}
+
+void ReportRoofline(benchmark::State &state, Cost total, double seconds)
+{
+    if (seconds <= 0)
+    {
+        return;
+    }
+
+    const DevicePeak &peak = Peak();
+
+    const double bytesPerSecond = total.bytes / seconds;
+    const double flopsPerSecond = total.flops / seconds;
+
+    state.counters["GB/s"] = bytesPerSecond / 1e9;
+    if (total.flops > 0)
+    {
+        state.counters["GFLOP/s"] = flopsPerSecond / 1e9;
+        state.counters["FLOP/B"]  = total.bytes > 0 ? static_cast<double>(total.flops) / total.bytes : 0;
+    }
+
+    if (peak.bytesPerSecond > 0 && total.bytes > 0)
+    {
+        state.counters["bw%"] = 100 * bytesPerSecond / peak.bytesPerSecond;
+
+        // Bound of the attainable throughput at the operator's arithmetic intensity, whichever of memory and
+        // compute is hit first
+        double bound = 1;
+        if (total.flops > 0 && peak.flopsPerSecond > 0)
+        {
+            const double intensity = static_cast<double>(total.flops) / total.bytes;
+            bound = std::min(1.0, peak.flopsPerSecond / (intensity * peak.bytesPerSecond));
+        }
+        state.counters["roofline%"] = 100 * bytesPerSecond / (bound * peak.bytesPerSecond);
+    }
+}
+
+std::unique_ptr<nvcv::Tensor> CreateTensor(int numImages, nvcv::Size2D size, nvcv::ImageFormat fmt,
+                                           nvcv::IAllocator *alloc)
+{
+    auto tensor = std::make_unique<nvcv::Tensor>(numImages, size, fmt, nvcv::MemAlignment{}, alloc);
+
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor->exportData());
+    if (data == nullptr)
+    {
+        throw std::runtime_error("Tensor must be cuda-accessible, pitch-linear");
+    }
+    FillRandom(data->basePtr(), data->stride(0) * data->shape(0), fmt.dataKind(), fmt.bitsPerChannel()[0]);
+
+    return tensor;
+}
+
+std::unique_ptr<nvcv::Tensor> CreateTensor(const nvcv::TensorShape &shape, nvcv::DataType dtype)
+{
+    auto tensor = std::make_unique<nvcv::Tensor>(shape, dtype);
+
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor->exportData());
+    if (data == nullptr)
+    {
+        throw std::runtime_error("Tensor must be cuda-accessible, pitch-linear");
+    }
+    FillRandom(data->basePtr(), data->stride(0) * data->shape(0), dtype.dataKind(), dtype.bitsPerChannel()[0]);
+
+    return tensor;
+}
+
+ImageBatch::ImageBatch(int numImages, nvcv::Size2D maxSize, nvcv::ImageFormat fmt, bool varSizes)
+    : m_batch(numImages)
+{
+    std::uniform_int_distribution<int> randWidth(std::max(1, maxSize.w / 2), maxSize.w);
+    std::uniform_int_distribution<int> randHeight(std::max(1, maxSize.h / 2), maxSize.h);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        addImage(varSizes ? nvcv::Size2D{randWidth(Rng()), randHeight(Rng())} : maxSize, fmt);
+    }
+
+    m_batch.pushBack(m_images.begin(), m_images.end());
+}
+
+ImageBatch::ImageBatch(const std::vector<nvcv::Size2D> &sizes, nvcv::ImageFormat fmt)
+    : m_batch(sizes.size())
+{
+    for (nvcv::Size2D size : sizes)
+    {
+        addImage(size, fmt);
+    }
+
+    m_batch.pushBack(m_images.begin(), m_images.end());
+}
+
+void ImageBatch::addImage(nvcv::Size2D size, nvcv::ImageFormat fmt)
+{
+    m_images.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+    m_sizes.push_back(size);
+
+    auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(m_images.back()->exportData());
+    if (data == nullptr)
+    {
+        throw std::runtime_error("Image must be cuda-accessible, pitch-linear");
+    }
+    for (int p = 0; p < data->numPlanes(); ++p)
+    {
+        FillRandom(data->plane(p).basePtr, static_cast<int64_t>(data->plane(p).rowStride) * data->plane(p).height,
+                   fmt.dataKind(), fmt.bitsPerChannel()[0]);
+    }
+}
+
+} // namespace cvcuda::bench
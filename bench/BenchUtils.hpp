@@ -0,0 +1,258 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CVCUDA_BENCH_UTILS_HPP
+#define CVCUDA_BENCH_UTILS_HPP
+
+#include <benchmark/benchmark.h>
+#include <cuda_runtime.h>
+#include <cvcuda/Types.h>
+#include <nvcv/Exception.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace cvcuda::bench {
+
+#define CHECK_CUDA(expr)                                                                    \
+    do                                                                                      \
+    {                                                                                       \
+        cudaError_t err = (expr);                                                           \
+        if (err != cudaSuccess)                                                             \
+        {                                                                                   \
+            throw std::runtime_error(std::string(#expr " failed: ") + cudaGetErrorName(err)); \
+        }                                                                                   \
+    }                                                                                       \
+    while (0)
+
+// Stream shared by all benchmarks, created on first use.
+cudaStream_t Stream();
+
+// Registers the batch sizes and image sizes every image benchmark runs with.
+// Arguments are passed as state.range(0) = number of images,
+// state.range(1) = width, state.range(2) = height.
+void ImageArgs(benchmark::internal::Benchmark *b);
+
+inline int BatchSize(const benchmark::State &state)
+{
+    return static_cast<int>(state.range(0));
+}
+
+inline nvcv::Size2D ImageSize(const benchmark::State &state)
+{
+    return {static_cast<int>(state.range(1)), static_cast<int>(state.range(2))};
+}
+
+inline nvcv::Size2D Scale(nvcv::Size2D size, double factor)
+{
+    return {std::max(1, static_cast<int>(size.w * factor)), std::max(1, static_cast<int>(size.h * factor))};
+}
+
+// Number of bytes of the tensor contents, excluding row padding.
+int64_t NumBytes(const nvcv::ITensor &tensor);
+
+// Number of bytes of all images in the batch, excluding row padding.
+int64_t NumBytes(const nvcv::IImageBatchVarShape &batch);
+
+// Number of channel values of the tensor, or of all images in the batch.
+int64_t NumValues(const nvcv::ITensor &tensor);
+int64_t NumValues(const nvcv::IImageBatchVarShape &batch);
+
+// Work done by one operator call: bytes read and written, and arithmetic
+// operations, counting a multiply-add as two. Operators whose arithmetic is
+// negligible, e.g. copies and reorders, only set the bytes.
+struct Cost
+{
+    Cost(int64_t bytes, int64_t flops = 0)
+        : bytes(bytes)
+        , flops(flops)
+    {
+    }
+
+    int64_t bytes;
+    int64_t flops;
+};
+
+// Operations per output value of an interpolation, to resize by the given factor.
+inline int64_t InterpFlops(NVCVInterpolationType interp, double scale = 1)
+{
+    switch (interp)
+    {
+    case NVCV_INTERP_LINEAR:
+        return 2 * 4;
+    case NVCV_INTERP_CUBIC:
+        return 2 * 16;
+    case NVCV_INTERP_AREA:
+        return 2 * std::max<int64_t>(1, static_cast<int64_t>(1 / (scale * scale)));
+    default:
+        return 0;
+    }
+}
+
+// Operations per output value of a direct ksize x ksize filter.
+inline int64_t FilterFlops(int ksize)
+{
+    return 2 * ksize * ksize;
+}
+
+// Peak throughput of the current device, zero when it can't be queried.
+struct DevicePeak
+{
+    double bytesPerSecond;
+    double flopsPerSecond;
+};
+
+const DevicePeak &Peak();
+
+// Reports how close the measured throughput is to the device roofline, given
+// the total work done in the given time: achieved GB/s and GFLOP/s, their
+// percentage of the device peaks, the arithmetic intensity and the
+// percentage of the roofline bound at that intensity.
+void ReportRoofline(benchmark::State &state, Cost total, double seconds);
+
+// Creates a tensor with random contents, allocated by alloc if given.
+std::unique_ptr<nvcv::Tensor> CreateTensor(int numImages, nvcv::Size2D size, nvcv::ImageFormat fmt,
+                                           nvcv::IAllocator *alloc = nullptr);
+std::unique_ptr<nvcv::Tensor> CreateTensor(const nvcv::TensorShape &shape, nvcv::DataType dtype);
+
+// Creates a tensor and fills it with the given values.
+template<class T>
+std::unique_ptr<nvcv::Tensor> CreateParam(const nvcv::TensorShape &shape, nvcv::DataType dtype,
+                                          const std::vector<T> &values)
+{
+    auto tensor = std::make_unique<nvcv::Tensor>(shape, dtype);
+
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor->exportData());
+    if (data == nullptr || static_cast<int64_t>(values.size() * sizeof(T)) > data->stride(0) * data->shape(0))
+    {
+        throw std::invalid_argument("Parameter tensor can't hold the given values");
+    }
+    CHECK_CUDA(cudaMemcpy(data->basePtr(), values.data(), values.size() * sizeof(T), cudaMemcpyHostToDevice));
+
+    return tensor;
+}
+
+// Image batch with random contents. Images have random sizes between half and
+// the whole maximum size, unless all of them are asked to have maximum size.
+class ImageBatch
+{
+public:
+    ImageBatch(int numImages, nvcv::Size2D maxSize, nvcv::ImageFormat fmt, bool varSizes = true);
+
+    // Creates one image for each given size.
+    ImageBatch(const std::vector<nvcv::Size2D> &sizes, nvcv::ImageFormat fmt);
+
+    nvcv::ImageBatchVarShape &operator*()
+    {
+        return m_batch;
+    }
+
+    const std::vector<nvcv::Size2D> &sizes() const
+    {
+        return m_sizes;
+    }
+
+private:
+    void addImage(nvcv::Size2D size, nvcv::ImageFormat fmt);
+
+    std::vector<std::unique_ptr<nvcv::Image>> m_images;
+    std::vector<nvcv::Size2D>                 m_sizes;
+    nvcv::ImageBatchVarShape                  m_batch;
+};
+
+// RAII wrapper of a cuda event
+class Event
+{
+public:
+    Event()
+    {
+        CHECK_CUDA(cudaEventCreate(&m_event));
+    }
+
+    ~Event()
+    {
+        cudaEventDestroy(m_event);
+    }
+
+    Event(const Event &) = delete;
+
+    operator cudaEvent_t() const
+    {
+        return m_event;
+    }
+
+private:
+    cudaEvent_t m_event;
+};
+
+// Times fn on the benchmark stream with CUDA events, one sample per
+// iteration, and reports bytes and images processed per second along with
+// the roofline counters. The benchmark must be registered with
+// UseManualTime(). Errors raised by the operator skip the benchmark instead
+// of aborting the whole run.
+template<class F>
+void Run(benchmark::State &state, Cost costPerIter, int64_t itemsPerIter, F &&fn)
+{
+    try
+    {
+        cudaStream_t stream = Stream();
+
+        Event start, stop;
+
+        // Warm-up, so that one-time setup costs aren't measured.
+        fn(stream);
+        CHECK_CUDA(cudaStreamSynchronize(stream));
+
+        double seconds = 0;
+        for (auto _ : state)
+        {
+            CHECK_CUDA(cudaEventRecord(start, stream));
+            fn(stream);
+            CHECK_CUDA(cudaEventRecord(stop, stream));
+            CHECK_CUDA(cudaEventSynchronize(stop));
+
+            float ms = 0;
+            CHECK_CUDA(cudaEventElapsedTime(&ms, start, stop));
+            state.SetIterationTime(ms / 1000.0);
+            seconds += ms / 1000.0;
+        }
+
+        state.SetBytesProcessed(state.iterations() * costPerIter.bytes);
+        state.SetItemsProcessed(state.iterations() * itemsPerIter);
+        ReportRoofline(state, {state.iterations() * costPerIter.bytes, state.iterations() * costPerIter.flops},
+                       seconds);
+    }
+    catch (const std::exception &e)
+    {
+        state.SkipWithError(e.what());
+    }
+}
+
+} // namespace cvcuda::bench
+
+// Registers a benchmark with the standard image arguments, the extra arguments
+// are passed to func after the benchmark state and name the benchmark variant.
+#define CVCUDA_BENCH(func, name, ...) \
+    BENCHMARK_CAPTURE(func, name, __VA_ARGS__)->Apply(cvcuda::bench::ImageArgs)->UseManualTime()
+
+#endif // CVCUDA_BENCH_UTILS_HPP
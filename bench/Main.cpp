@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchUtils.hpp"
+
+#include <cvcuda/Version.h>
+
+#include <string>
+
+// Runs all registered benchmarks. Results can be saved as JSON with
+//   cvcuda_bench --benchmark_out=results.json --benchmark_out_format=json
+// and compared between releases with google benchmark's compare.py.
+//
+// Besides timings, each benchmark reports the achieved GB/s and GFLOP/s of
+// the operator, estimated from its shapes, as bw% of the device peak
+// bandwidth and as roofline% of the throughput attainable at its FLOP/B
+// intensity. Sorting by roofline% finds the operators with most headroom.
+int main(int argc, char **argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    int            device;
+    cudaDeviceProp prop;
+    if (cudaGetDevice(&device) == cudaSuccess && cudaGetDeviceProperties(&prop, device) == cudaSuccess)
+    {
+        benchmark::AddCustomContext("gpu", prop.name);
+        benchmark::AddCustomContext("gpu_sm", std::to_string(prop.major) + "." + std::to_string(prop.minor));
+    }
+
+    const cvcuda::bench::DevicePeak &peak = cvcuda::bench::Peak();
+    benchmark::AddCustomContext("gpu_peak_GB/s", std::to_string(peak.bytesPerSecond / 1e9));
+    benchmark::AddCustomContext("gpu_peak_GFLOP/s", std::to_string(peak.flopsPerSecond / 1e9));
+
+    int runtimeVersion = 0;
+    cudaRuntimeGetVersion(&runtimeVersion);
+    benchmark::AddCustomContext("cuda_runtime", std::to_string(runtimeVersion));
+    benchmark::AddCustomContext("cvcuda_version", CVCUDA_VERSION_STRING);
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -32,6 +32,10 @@ set(CMAKE_CUDA_STANDARD ${CMAKE_CXX_STANDARD})
 # Compress kernels to generate smaller executables
 set(CMAKE_CUDA_FLAGS "${CMAKE_CUDA_FLAGS} -Xfatbin=--compress-all")
 
+# Each .cu is compiled to its own CUDA module, device linking would merge them into a single one. Keep them
+# separate so that with CUDA_MODULE_LOADING=LAZY only the modules of the operators called are loaded.
+set(CMAKE_CUDA_SEPARABLE_COMPILATION OFF)
+
 if(NOT USE_CMAKE_CUDA_ARCHITECTURES)
     set(CMAKE_CUDA_ARCHITECTURES "$ENV{CUDAARCHS}")
 
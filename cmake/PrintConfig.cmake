@@ -36,6 +36,12 @@ else()
     message(STATUS "    BUILD_TESTS              : off")
 endif()
 
+if(BUILD_BENCH)
+    message(STATUS "    BUILD_BENCH              : ON")
+else()
+    message(STATUS "    BUILD_BENCH              : off")
+endif()
+
 if(BUILD_PYTHON)
     message(STATUS "    BUILD_PYTHON             : ON")
     message(STATUS "        Python versions : ${PYTHON_VERSIONS}")
@@ -49,6 +55,18 @@ else()
     message(STATUS "    ENABLE_SANITIZER         : off")
 endif()
 
+if(ENABLE_NVTX)
+    message(STATUS "    ENABLE_NVTX              : ON")
+else()
+    message(STATUS "    ENABLE_NVTX              : off")
+endif()
+
+if(ENABLE_GDS)
+    message(STATUS "    ENABLE_GDS               : ON")
+else()
+    message(STATUS "    ENABLE_GDS               : off")
+endif()
+
 if(ENABLE_TEGRA)
     message(STATUS "    ENABLE_TEGRA             : ON")
 else()
@@ -99,6 +117,7 @@ message(STATUS "    C Flags      : ${CMAKE_C_FLAGS} ${CMAKE_C_FLAGS_${BUILD_TYPE
 message(STATUS "")
 message(STATUS "    CUDA Compiler : ${CMAKE_CUDA_COMPILER} (${CMAKE_CUDA_COMPILER_VERSION})")
 message(STATUS "    CUDA Arch     : ${CMAKE_CUDA_ARCHITECTURES}")
+message(STATUS "    Kernel variants : ${CVCUDA_KERNEL_VARIANTS}")
 message(STATUS "    CUDA flags    : ${CMAKE_CUDA_FLAGS} ${CMAKE_CUDA_FLAGS_${BUILD_TYPE}}")
 message(STATUS "    CUDA toolkit target dir : ${CUDAToolkit_TARGET_DIR}")
 message(STATUS "")
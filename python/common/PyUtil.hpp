@@ -22,8 +22,19 @@
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
+#include <cstring>
 #include <functional>
 #include <sstream>
+#include <string_view>
+#include <type_traits>
+
+// Our modules don't rely on the GIL to protect their state, they can be used
+// by several threads at once in free-threaded python builds.
+#if PYBIND11_VERSION_HEX >= 0x020D0000
+#    define NVCV_PYBIND11_MODULE(name, variable) PYBIND11_MODULE(name, variable, pybind11::mod_gil_not_used())
+#else
+#    define NVCV_PYBIND11_MODULE(name, variable) PYBIND11_MODULE(name, variable)
+#endif
 
 namespace nvcvpy::util {
 namespace py = pybind11;
@@ -67,6 +78,31 @@ std::string GetFullyQualifiedName(py::handle h);
 py::dtype ToDType(const std::string &str);
 py::dtype ToDType(const py::buffer_info &info);
 
+// Plain struct stored as python bytes, e.g. to be sent to other processes.
+template<class T>
+py::bytes ToBytes(const T &obj)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    return py::bytes(reinterpret_cast<const char *>(&obj), sizeof(T));
+}
+
+template<class T>
+T FromBytes(const py::bytes &bytes)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    std::string_view data = bytes;
+    if (data.size() != sizeof(T))
+    {
+        throw std::invalid_argument("Expected " + std::to_string(sizeof(T)) + " bytes, got "
+                                    + std::to_string(data.size()));
+    }
+
+    T obj;
+    std::memcpy(&obj, data.data(), sizeof(T));
+    return obj;
+}
+
 } // namespace nvcvpy::util
 
 #endif // NVCV_PYTHON_PYUTIL_HPP
@@ -234,6 +234,14 @@ void ExportColorConversionCode(py::module &m)
         .value("RGBA2YUV420sp", NVCV_COLOR_RGBA2YUV420sp)
         .value("BGRA2YUV_NV21", NVCV_COLOR_BGRA2YUV_NV21)
         .value("BGRA2YUV420sp", NVCV_COLOR_BGRA2YUV420sp)
+        .value("YUV2RGB_P010", NVCV_COLOR_YUV2RGB_P010)
+        .value("YUV2BGR_P010", NVCV_COLOR_YUV2BGR_P010)
+        .value("YUV2RGBA_P010", NVCV_COLOR_YUV2RGBA_P010)
+        .value("YUV2BGRA_P010", NVCV_COLOR_YUV2BGRA_P010)
+        .value("YUV2RGB_P016", NVCV_COLOR_YUV2RGB_P016)
+        .value("YUV2BGR_P016", NVCV_COLOR_YUV2BGR_P016)
+        .value("YUV2RGBA_P016", NVCV_COLOR_YUV2RGBA_P016)
+        .value("YUV2BGRA_P016", NVCV_COLOR_YUV2BGRA_P016)
         .value("CVT_MAX", NVCV_COLORCVT_MAX);
 }
 
@@ -15,18 +15,31 @@
  * limitations under the License.
  */
 
+#include "BlurRegionType.hpp"
 #include "BorderType.hpp"
 #include "ColorConversionCode.hpp"
+#include "CornerResponseType.hpp"
+#include "DemosaicType.hpp"
+#include "ImageHashType.hpp"
 #include "InterpolationType.hpp"
 #include "MorphologyType.hpp"
+#include "OSDElementType.hpp"
+#include "OperatorStats.hpp"
 #include "Operators.hpp"
+#include "PyramidType.hpp"
+#include "RawPattern.hpp"
+#include "ReduceOp.hpp"
+#include "RemapMapValueType.hpp"
+#include "TemporalFilterType.hpp"
+#include "ThresholdType.hpp"
 
+#include <common/PyUtil.hpp>
 #include <cvcuda/Version.h>
 #include <pybind11/pybind11.h>
 
 namespace py = pybind11;
 
-PYBIND11_MODULE(cvcuda, m)
+NVCV_PYBIND11_MODULE(cvcuda, m)
 {
     m.doc() = R"pbdoc(
         CV-CUDA Python API reference
@@ -37,6 +50,10 @@ PYBIND11_MODULE(cvcuda, m)
 
     m.attr("__version__") = CVCUDA_VERSION_STRING;
 
+    // Unless chosen otherwise, load the CUDA modules of the operators on their first call instead of all of them
+    // at startup. It only applies if CUDA isn't initialized yet in the process.
+    py::module::import("os").attr("environ").attr("setdefault")("CUDA_MODULE_LOADING", "LAZY");
+
     // Import all public names from nvcv
     auto nvcv = py::module::import("nvcv");
 
@@ -63,6 +80,7 @@ PYBIND11_MODULE(cvcuda, m)
     }
 
     m.add_object("Stream", nvcv.attr("cuda").attr("Stream"));
+    m.add_object("Graph", nvcv.attr("cuda").attr("Graph"));
 
     using namespace cvcudapy;
 
@@ -71,6 +89,19 @@ PYBIND11_MODULE(cvcuda, m)
     ExportBorderType(m);
     ExportMorphologyType(m);
     ExportColorConversionCode(m);
+    ExportRemapMapValueType(m);
+    ExportReduceOp(m);
+    ExportPyramidType(m);
+    ExportTemporalFilterType(m);
+    ExportThresholdType(m);
+    ExportDemosaicType(m);
+    ExportRawPattern(m);
+    ExportImageHashType(m);
+    ExportBlurRegionType(m);
+    ExportOSDElementType(m);
+    ExportCornerResponseType(m);
+
+    ExportOperatorStats(m);
 
     // Operators
     ExportOpReformat(m);
@@ -99,4 +130,39 @@ PYBIND11_MODULE(cvcuda, m)
     ExportOpComposite(m);
     ExportOpGammaContrast(m);
     ExportOpPillowResize(m);
+    ExportOpResizeNormalizeReformat(m);
+    ExportOpCropResize(m);
+    ExportOpRemap(m);
+    ExportOpReduce(m);
+    ExportOpHistogram(m);
+    ExportOpMinMaxLoc(m);
+    ExportOpLetterbox(m);
+    ExportOpBuildPyramid(m);
+    ExportOpArgMax(m);
+    ExportOpMaskOverlay(m);
+    ExportOpTopK(m);
+    ExportOpBoxDecode(m);
+    ExportOpNMS(m);
+    ExportOpAbsDiff(m);
+    ExportOpTemporalFilter(m);
+    ExportOpLUT(m);
+    ExportOpSobel(m);
+    ExportOpCanny(m);
+    ExportOpIntegral(m);
+    ExportOpAdaptiveThreshold(m);
+    ExportOpLabel(m);
+    ExportOpDemosaic(m);
+    ExportOpHistogramEq(m);
+    ExportOpCLAHE(m);
+    ExportOpImageHash(m);
+    ExportOpGuidedFilter(m);
+    ExportOpBlurRegions(m);
+    ExportOpOSD(m);
+    ExportOpMosaic(m);
+    ExportOpPSNR(m);
+    ExportOpSSIM(m);
+    ExportOpMatchTemplate(m);
+    ExportOpFAST(m);
+    ExportOpHarris(m);
+    ExportOpSharpness(m);
 }
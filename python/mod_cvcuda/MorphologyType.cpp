@@ -23,7 +23,14 @@ namespace cvcudapy {
 
 void ExportMorphologyType(py::module &m)
 {
-    py::enum_<NVCVMorphologyType>(m, "MorphologyType").value("ERODE", NVCV_ERODE).value("DILATE", NVCV_DILATE);
+    py::enum_<NVCVMorphologyType>(m, "MorphologyType")
+        .value("ERODE", NVCV_ERODE)
+        .value("DILATE", NVCV_DILATE)
+        .value("OPEN", NVCV_OPEN)
+        .value("CLOSE", NVCV_CLOSE)
+        .value("GRADIENT", NVCV_GRADIENT)
+        .value("TOPHAT", NVCV_TOPHAT)
+        .value("BLACKHAT", NVCV_BLACKHAT);
 }
 
 } // namespace cvcudapy
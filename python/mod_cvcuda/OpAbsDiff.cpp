@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpAbsDiff.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+Tensor AbsDiffInto(Tensor &output, Tensor &input1, Tensor &input2, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto absdiff = CreateOperator<cvcuda::AbsDiff>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input1, input2});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*absdiff});
+
+    absdiff->submit(pstream->cudaHandle(), input1, input2, output);
+
+    return std::move(output);
+}
+
+Tensor AbsDiff(Tensor &input1, Tensor &input2, std::optional<Stream> pstream)
+{
+    Tensor output = Tensor::Create(input1.shape(), input1.dtype());
+
+    return AbsDiffInto(output, input1, input2, pstream);
+}
+
+} // namespace
+
+void ExportOpAbsDiff(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("absdiff", &AbsDiff, "src1"_a, "src2"_a, py::kw_only(), "stream"_a = nullptr);
+    m.def("absdiff_into", &AbsDiffInto, "dst"_a, "src1"_a, "src2"_a, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,80 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpAdaptiveThreshold.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+Tensor AdaptiveThresholdInto(Tensor &output, Tensor &input, double maxValue, NVCVThresholdType type,
+                             int32_t blockSize, double c, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    // The workspace holds the integral image of the input, it's sized by the input
+    auto threshold = CreateOperator<cvcuda::AdaptiveThreshold>(info->numSamples(), info->numCols(), info->numRows());
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_WRITE, {*threshold});
+
+    threshold->submit(pstream->cudaHandle(), input, output, maxValue, type, blockSize, c);
+
+    return output;
+}
+
+Tensor AdaptiveThreshold(Tensor &input, double maxValue, NVCVThresholdType type, int32_t blockSize, double c,
+                         std::optional<Stream> pstream)
+{
+    Tensor output = Tensor::Create(input.shape(), input.dtype());
+
+    return AdaptiveThresholdInto(output, input, maxValue, type, blockSize, c, pstream);
+}
+
+} // namespace
+
+void ExportOpAdaptiveThreshold(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("adaptive_threshold", &AdaptiveThreshold, "src"_a, "max_value"_a, "type"_a, "block_size"_a, "c"_a,
+          py::kw_only(), "stream"_a = nullptr);
+    m.def("adaptive_threshold_into", &AdaptiveThresholdInto, "dst"_a, "src"_a, "max_value"_a, "type"_a,
+          "block_size"_a, "c"_a, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
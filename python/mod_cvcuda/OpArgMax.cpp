@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpArgMax.hpp>
+#include <cvcuda/Types.h>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+Tensor ArgMaxInto(Tensor &output, Tensor &input, NVCVInterpolationType interp, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto argmax = CreateOperator<cvcuda::ArgMax>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*argmax});
+
+    argmax->submit(pstream->cudaHandle(), input, output, interp);
+
+    return std::move(output);
+}
+
+Tensor ArgMax(Tensor &input, std::optional<std::tuple<int, int>> size, NVCVInterpolationType interp,
+              std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImagePlanar::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    // Labels have the input size unless upsampled, and fit in uint8 up to 256 classes
+    nvcv::Size2D outSize = info->size();
+    if (size)
+    {
+        outSize = nvcv::Size2D{std::get<0>(*size), std::get<1>(*size)};
+    }
+    nvcv::DataType dtype = info->numPlanes() <= 256 ? nvcv::TYPE_U8 : nvcv::TYPE_S32;
+
+    nvcv::TensorShape::ShapeType shape{info->numSamples(), outSize.h, outSize.w, 1};
+
+    Tensor output = Tensor::Create(nvcv::TensorShape(shape, nvcv::TENSOR_NHWC), dtype);
+
+    return ArgMaxInto(output, input, interp, pstream);
+}
+
+} // namespace
+
+void ExportOpArgMax(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("argmax", &ArgMax, "src"_a, "size"_a = nullptr, "interp"_a = NVCV_INTERP_NEAREST, py::kw_only(),
+          "stream"_a = nullptr);
+    m.def("argmax_into", &ArgMaxInto, "dst"_a, "src"_a, "interp"_a = NVCV_INTERP_NEAREST, py::kw_only(),
+          "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
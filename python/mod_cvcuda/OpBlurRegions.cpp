@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpBlurRegions.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+// The images are modified in place, only inside the boxes, so there's no variant allocating the output
+Tensor BlurRegionsInto(Tensor &inOut, Tensor &boxes, NVCVBlurRegionType type, int32_t kernelSize,
+                       std::optional<Tensor> numBoxes, double sigma, NVCVBorderType borderMode,
+                       std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto info = nvcv::TensorShapeInfoImage::Create(inOut.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    // The workspace holds a plane of the images, it's sized by the input
+    auto blurRegions = CreateOperator<cvcuda::BlurRegions>(info->numSamples(), info->numCols(), info->numRows());
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {boxes});
+    if (numBoxes)
+    {
+        guard.add(LockMode::LOCK_READ, {*numBoxes});
+    }
+    guard.add(LockMode::LOCK_WRITE, {inOut});
+    guard.add(LockMode::LOCK_WRITE, {*blurRegions});
+
+    if (numBoxes)
+    {
+        blurRegions->submit(pstream->cudaHandle(), inOut, boxes, *numBoxes, type, kernelSize, sigma, borderMode);
+    }
+    else
+    {
+        blurRegions->submit(pstream->cudaHandle(), inOut, boxes, type, kernelSize, sigma, borderMode);
+    }
+
+    return inOut;
+}
+
+} // namespace
+
+void ExportOpBlurRegions(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("blur_regions_into", &BlurRegionsInto, "src"_a, "boxes"_a, "type"_a, "kernel_size"_a,
+          "num_boxes"_a = nullptr, "sigma"_a = 0.0, "border"_a = NVCV_BORDER_REFLECT101, py::kw_only(),
+          "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
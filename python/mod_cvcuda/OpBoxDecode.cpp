@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpBoxDecode.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+Tensor BoxDecodeInto(Tensor &boxes, Tensor &anchors, Tensor &deltas, float varianceXY, float varianceWH,
+                     std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto boxDecode = CreateOperator<cvcuda::BoxDecode>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {anchors, deltas});
+    guard.add(LockMode::LOCK_WRITE, {boxes});
+    guard.add(LockMode::LOCK_NONE, {*boxDecode});
+
+    boxDecode->submit(pstream->cudaHandle(), anchors, deltas, boxes, varianceXY, varianceWH);
+
+    return boxes;
+}
+
+Tensor BoxDecode(Tensor &anchors, Tensor &deltas, float varianceXY, float varianceWH, std::optional<Stream> pstream)
+{
+    Tensor boxes = Tensor::Create(deltas.shape(), deltas.dtype());
+
+    return BoxDecodeInto(boxes, anchors, deltas, varianceXY, varianceWH, pstream);
+}
+
+} // namespace
+
+void ExportOpBoxDecode(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("box_decode", &BoxDecode, "anchors"_a, "deltas"_a, "variance_xy"_a = 1.f, "variance_wh"_a = 1.f,
+          py::kw_only(), "stream"_a = nullptr);
+    m.def("box_decode_into", &BoxDecodeInto, "boxes"_a, "anchors"_a, "deltas"_a, "variance_xy"_a = 1.f,
+          "variance_wh"_a = 1.f, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpBuildPyramid.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/Image.hpp>
+#include <nvcv/python/ImageBatchVarShape.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+#include <algorithm>
+
+namespace cvcudapy {
+
+namespace {
+
+// Image format of the levels of a tensor pyramid, from its data type and number of channels
+nvcv::ImageFormat GetLevelFormat(nvcv::DataType dtype, int32_t numChannels)
+{
+    if (dtype == nvcv::TYPE_U8 || dtype == nvcv::TYPE_F32)
+    {
+        const bool u8 = dtype == nvcv::TYPE_U8;
+        switch (numChannels)
+        {
+        case 1:
+            return u8 ? nvcv::FMT_U8 : nvcv::FMT_F32;
+        case 3:
+            return u8 ? nvcv::FMT_RGB8 : nvcv::FMT_RGBf32;
+        case 4:
+            return u8 ? nvcv::FMT_RGBA8 : nvcv::FMT_RGBAf32;
+        }
+    }
+    else if (numChannels == 1 && (dtype == nvcv::TYPE_U16 || dtype == nvcv::TYPE_S16))
+    {
+        return dtype == nvcv::TYPE_U16 ? nvcv::FMT_U16 : nvcv::FMT_S16;
+    }
+
+    throw std::runtime_error("Unsupported input data type and number of channels, use build_pyramid_into");
+}
+
+// Appends the numLevels images of a pyramid whose level 0 has the given size
+void PushLevels(ImageBatchVarShape &output, nvcv::Size2D size, nvcv::ImageFormat format, int32_t numLevels)
+{
+    for (int32_t l = 0; l < numLevels; ++l)
+    {
+        output.pushBack(Image::Create(size, format));
+        size = nvcv::Size2D{(size.w + 1) / 2, (size.h + 1) / 2};
+    }
+}
+
+ImageBatchVarShape BuildPyramidInto(ImageBatchVarShape &output, Tensor &input, int32_t levels,
+                                    NVCVPyramidType type, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto pyramid = CreateOperator<cvcuda::BuildPyramid>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*pyramid});
+
+    pyramid->submit(pstream->cudaHandle(), input, output, levels, type);
+
+    return output;
+}
+
+ImageBatchVarShape BuildPyramid(Tensor &input, int32_t levels, NVCVPyramidType type, std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    nvcv::ImageFormat format = GetLevelFormat(input.dtype(), info->numChannels());
+
+    ImageBatchVarShape output = ImageBatchVarShape::Create(info->numSamples() * std::max(levels, 0));
+    for (int64_t n = 0; n < info->numSamples(); ++n)
+    {
+        PushLevels(output, info->size(), format, levels);
+    }
+
+    return BuildPyramidInto(output, input, levels, type, pstream);
+}
+
+ImageBatchVarShape BuildPyramidVarShapeInto(ImageBatchVarShape &output, ImageBatchVarShape &input, int32_t levels,
+                                            NVCVPyramidType type, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto pyramid = CreateOperator<cvcuda::BuildPyramid>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*pyramid});
+
+    pyramid->submit(pstream->cudaHandle(), input, output, levels, type);
+
+    return output;
+}
+
+ImageBatchVarShape BuildPyramidVarShape(ImageBatchVarShape &input, int32_t levels, NVCVPyramidType type,
+                                        std::optional<Stream> pstream)
+{
+    ImageBatchVarShape output = ImageBatchVarShape::Create(input.numImages() * std::max(levels, 0));
+    for (int i = 0; i < input.numImages(); ++i)
+    {
+        PushLevels(output, input[i].size(), input[i].format(), levels);
+    }
+
+    return BuildPyramidVarShapeInto(output, input, levels, type, pstream);
+}
+
+} // namespace
+
+void ExportOpBuildPyramid(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("build_pyramid", &BuildPyramid, "src"_a, "levels"_a, "type"_a = NVCV_PYRAMID_GAUSSIAN, py::kw_only(),
+          "stream"_a = nullptr);
+    m.def("build_pyramid_into", &BuildPyramidInto, "dst"_a, "src"_a, "levels"_a, "type"_a = NVCV_PYRAMID_GAUSSIAN,
+          py::kw_only(), "stream"_a = nullptr);
+    m.def("build_pyramid", &BuildPyramidVarShape, "src"_a, "levels"_a, "type"_a = NVCV_PYRAMID_GAUSSIAN,
+          py::kw_only(), "stream"_a = nullptr);
+    m.def("build_pyramid_into", &BuildPyramidVarShapeInto, "dst"_a, "src"_a, "levels"_a,
+          "type"_a = NVCV_PYRAMID_GAUSSIAN, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
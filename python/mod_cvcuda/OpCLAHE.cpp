@@ -0,0 +1,126 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpCLAHE.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ImageBatchVarShape.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+Tensor CLAHEInto(Tensor &output, Tensor &input, float clipLimit, const std::tuple<int, int> &tileGridSize,
+                 std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    auto [tilesX, tilesY] = tileGridSize;
+
+    auto clahe = CreateOperator<cvcuda::CLAHE>(static_cast<int32_t>(info->numSamples()), tilesX, tilesY);
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*clahe});
+
+    clahe->submit(pstream->cudaHandle(), input, output, clipLimit, tilesX, tilesY);
+
+    return output;
+}
+
+Tensor CLAHE(Tensor &input, float clipLimit, const std::tuple<int, int> &tileGridSize, std::optional<Stream> pstream)
+{
+    Tensor output = Tensor::Create(input.shape(), input.dtype());
+
+    return CLAHEInto(output, input, clipLimit, tileGridSize, pstream);
+}
+
+ImageBatchVarShape CLAHEVarShapeInto(ImageBatchVarShape &output, ImageBatchVarShape &input, float clipLimit,
+                                     const std::tuple<int, int> &tileGridSize, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto [tilesX, tilesY] = tileGridSize;
+
+    auto clahe = CreateOperator<cvcuda::CLAHE>(input.capacity(), tilesX, tilesY);
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*clahe});
+
+    clahe->submit(pstream->cudaHandle(), input, output, clipLimit, tilesX, tilesY);
+
+    return output;
+}
+
+ImageBatchVarShape CLAHEVarShape(ImageBatchVarShape &input, float clipLimit, const std::tuple<int, int> &tileGridSize,
+                                 std::optional<Stream> pstream)
+{
+    ImageBatchVarShape output = ImageBatchVarShape::Create(input.capacity());
+
+    for (int i = 0; i < input.numImages(); ++i)
+    {
+        nvcv::ImageFormat format = input[i].format();
+        nvcv::Size2D      size   = input[i].size();
+        auto              image  = Image::Create(size, format);
+        output.pushBack(image);
+    }
+
+    return CLAHEVarShapeInto(output, input, clipLimit, tileGridSize, pstream);
+}
+
+} // namespace
+
+void ExportOpCLAHE(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    // Same defaults as cv::createCLAHE
+    const std::tuple<int, int> defTileGridSize{8, 8};
+
+    m.def("clahe", &CLAHE, "src"_a, "clip_limit"_a = 40.f, "tile_grid_size"_a = defTileGridSize, py::kw_only(),
+          "stream"_a = nullptr);
+    m.def("clahe_into", &CLAHEInto, "dst"_a, "src"_a, "clip_limit"_a = 40.f, "tile_grid_size"_a = defTileGridSize,
+          py::kw_only(), "stream"_a = nullptr);
+    m.def("clahe", &CLAHEVarShape, "src"_a, "clip_limit"_a = 40.f, "tile_grid_size"_a = defTileGridSize,
+          py::kw_only(), "stream"_a = nullptr);
+    m.def("clahe_into", &CLAHEVarShapeInto, "dst"_a, "src"_a, "clip_limit"_a = 40.f,
+          "tile_grid_size"_a = defTileGridSize, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpCanny.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+Tensor CannyInto(Tensor &output, Tensor &input, float thresholdLow, float thresholdHigh, int apertureSize,
+                 bool l2Gradient, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto canny = CreateOperator<cvcuda::Canny>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*canny});
+
+    canny->submit(pstream->cudaHandle(), input, output, thresholdLow, thresholdHigh, apertureSize, l2Gradient);
+
+    return output;
+}
+
+Tensor Canny(Tensor &input, float thresholdLow, float thresholdHigh, int apertureSize, bool l2Gradient,
+             std::optional<Stream> pstream)
+{
+    Tensor output = Tensor::Create(input.shape(), input.dtype());
+
+    return CannyInto(output, input, thresholdLow, thresholdHigh, apertureSize, l2Gradient, pstream);
+}
+
+} // namespace
+
+void ExportOpCanny(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("canny", &Canny, "src"_a, "threshold_low"_a, "threshold_high"_a, "aperture_size"_a = 3,
+          "l2_gradient"_a = false, py::kw_only(), "stream"_a = nullptr);
+    m.def("canny_into", &CannyInto, "dst"_a, "src"_a, "threshold_low"_a, "threshold_high"_a, "aperture_size"_a = 3,
+          "l2_gradient"_a = false, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
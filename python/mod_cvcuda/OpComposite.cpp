@@ -31,7 +31,7 @@
 namespace cvcudapy {
 
 namespace {
-Tensor CompositeInto(Tensor &output, Tensor &foreground, Tensor &background, Tensor &fgMask,
+Tensor CompositeInto(Tensor &output, Tensor &foreground, Tensor &background, Tensor &fgMask, bool premultiplied,
                      std::optional<Stream> pstream)
 {
     if (!pstream)
@@ -46,19 +46,42 @@ Tensor CompositeInto(Tensor &output, Tensor &foreground, Tensor &background, Ten
     guard.add(LockMode::LOCK_WRITE, {output});
     guard.add(LockMode::LOCK_NONE, {*composite});
 
-    composite->submit(pstream->cudaHandle(), foreground, background, fgMask, output);
+    composite->submit(pstream->cudaHandle(), foreground, background, fgMask, output,
+                      premultiplied ? CVCUDA_COMPOSITE_PREMULTIPLIED : 0);
 
     return output;
 }
 
-Tensor Composite(Tensor &foreground, Tensor &background, Tensor &fgMask, int outChannels, std::optional<Stream> pstream)
+Tensor Composite(Tensor &foreground, Tensor &background, Tensor &fgMask, int outChannels, bool premultiplied,
+                 std::optional<Stream> pstream)
 {
     Shape out_shape                 = CreateShape(foreground.shape());
     out_shape[out_shape.size() - 1] = outChannels;
 
     Tensor output = Tensor::Create(out_shape, foreground.dtype(), foreground.layout());
 
-    return CompositeInto(output, foreground, background, fgMask, pstream);
+    return CompositeInto(output, foreground, background, fgMask, premultiplied, pstream);
+}
+
+Tensor CompositeROIInto(Tensor &background, Tensor &foreground, Tensor &fgMask, int offsetX, int offsetY,
+                        bool premultiplied, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto composite = CreateOperator<cvcuda::Composite>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {foreground, fgMask});
+    guard.add(LockMode::LOCK_WRITE, {background});
+    guard.add(LockMode::LOCK_NONE, {*composite});
+
+    composite->submit(pstream->cudaHandle(), foreground, fgMask, background, offsetX, offsetY,
+                      premultiplied ? CVCUDA_COMPOSITE_PREMULTIPLIED : 0);
+
+    return background;
 }
 
 ImageBatchVarShape CompositeVarShapeInto(ImageBatchVarShape &output, ImageBatchVarShape &foreground,
@@ -105,9 +128,11 @@ void ExportOpComposite(py::module &m)
     using namespace pybind11::literals;
 
     m.def("composite", &Composite, "foreground"_a, "background"_a, "fgmask"_a, "outchannels"_a, py::kw_only(),
-          "stream"_a = nullptr);
+          "premultiplied"_a = false, "stream"_a = nullptr);
     m.def("composite_into", &CompositeInto, "dst"_a, "foreground"_a, "background"_a, "fgmask"_a, py::kw_only(),
-          "stream"_a = nullptr);
+          "premultiplied"_a = false, "stream"_a = nullptr);
+    m.def("composite_roi_into", &CompositeROIInto, "dst"_a, "foreground"_a, "fgmask"_a, py::kw_only(),
+          "offset_x"_a = 0, "offset_y"_a = 0, "premultiplied"_a = false, "stream"_a = nullptr);
     m.def("composite", &CompositeVarShape, "foreground"_a, "background"_a, "fgmask"_a, py::kw_only(),
           "stream"_a = nullptr);
     m.def("composite_into", &CompositeVarShapeInto, "dst"_a, "foreground"_a, "background"_a, "fgmask"_a, py::kw_only(),
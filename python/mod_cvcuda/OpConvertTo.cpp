@@ -18,15 +18,22 @@
 #include "Operators.hpp"
 
 #include <common/PyUtil.hpp>
+#include <common/String.hpp>
 #include <cvcuda/OpConvertTo.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
 #include <nvcv/python/ResourceGuard.hpp>
 #include <nvcv/python/Stream.hpp>
 #include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <variant>
 
 namespace cvcudapy {
 
 namespace {
-Tensor ConvertToInto(Tensor &output, Tensor &input, float scale, float offset, std::optional<Stream> pstream)
+Tensor ConvertToInto(Tensor &output, Tensor &input, float scale, float offset,
+                     std::optional<std::vector<int>> channelOrder, std::optional<Stream> pstream)
 {
     if (!pstream)
     {
@@ -40,16 +47,142 @@ Tensor ConvertToInto(Tensor &output, Tensor &input, float scale, float offset, s
     guard.add(LockMode::LOCK_WRITE, {output});
     guard.add(LockMode::LOCK_NONE, {*cvt});
 
-    cvt->submit(pstream->cudaHandle(), input, output, scale, offset);
+    cvt->submit(pstream->cudaHandle(), input, output, scale, offset, ChannelOrderSwizzle(channelOrder));
 
     return std::move(output);
 }
 
-Tensor ConvertTo(Tensor &input, nvcv::DataType dtype, float scale, float offset, std::optional<Stream> pstream)
+Tensor ConvertTo(Tensor &input, nvcv::DataType dtype, float scale, float offset,
+                 std::optional<std::vector<int>> channelOrder, std::optional<Stream> pstream)
 {
     Tensor output = Tensor::Create(input.shape(), dtype);
 
-    return ConvertToInto(output, input, scale, offset, pstream);
+    return ConvertToInto(output, input, scale, offset, channelOrder, pstream);
+}
+
+Tensor ConvertToPerChannelInto(Tensor &output, Tensor &input, Tensor &scale, Tensor &offset,
+                               std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto cvt = CreateOperator<cvcuda::ConvertTo>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, scale, offset});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*cvt});
+
+    cvt->submit(pstream->cudaHandle(), input, output, scale, offset);
+
+    return std::move(output);
+}
+
+Tensor ConvertToPerChannel(Tensor &input, nvcv::DataType dtype, Tensor &scale, Tensor &offset,
+                           std::optional<nvcv::TensorLayout> layout, std::optional<Stream> pstream)
+{
+    nvcv::TensorShape out_shape = layout ? Permute(input.shape(), *layout) : input.shape();
+
+    Tensor output = Tensor::Create(out_shape, dtype);
+
+    return ConvertToPerChannelInto(output, input, scale, offset, pstream);
+}
+
+// Scale or shift of the channels of an output, a single value is used for all of them
+using ChannelValues = std::variant<float, std::vector<float>>;
+
+void GetChannelValues(float (&dst)[4], const ChannelValues &src, int32_t numChannels, const char *name)
+{
+    if (const float *value = std::get_if<float>(&src))
+    {
+        std::fill(dst, dst + 4, *value);
+        return;
+    }
+
+    const std::vector<float> &values = std::get<std::vector<float>>(src);
+    if (values.size() != 1 && static_cast<int32_t>(values.size()) != numChannels)
+    {
+        throw std::invalid_argument(util::FormatString("Each %s must be a single value or one per channel, not %d",
+                                                       name, static_cast<int>(values.size())));
+    }
+    for (int c = 0; c < 4; ++c)
+    {
+        dst[c] = values[std::min<size_t>(c, values.size() - 1)];
+    }
+}
+
+std::vector<Tensor> ConvertToMultiInto(std::vector<Tensor> outputs, Tensor &input,
+                                       std::optional<std::vector<ChannelValues>> scale,
+                                       std::optional<std::vector<ChannelValues>> offset,
+                                       std::optional<std::vector<std::optional<std::vector<int>>>> channelOrder,
+                                       std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    const size_t numOutputs = outputs.size();
+    if ((scale && scale->size() != numOutputs) || (offset && offset->size() != numOutputs)
+        || (channelOrder && channelOrder->size() != numOutputs))
+    {
+        throw std::invalid_argument("Scales, offsets and channel orders must be given for each output");
+    }
+
+    auto    info        = nvcv::TensorShapeInfoImage::Create(input.shape());
+    int32_t numChannels = info ? info->numChannels() : 1;
+
+    std::vector<NVCVConvertToParams> params(numOutputs);
+    std::vector<nvcv::ITensor *>     outPtrs;
+    for (size_t o = 0; o < numOutputs; ++o)
+    {
+        GetChannelValues(params[o].alpha, scale ? (*scale)[o] : ChannelValues{1.f}, numChannels, "scale");
+        GetChannelValues(params[o].beta, offset ? (*offset)[o] : ChannelValues{0.f}, numChannels, "offset");
+        params[o].channelOrder = ChannelOrderSwizzle(channelOrder ? (*channelOrder)[o] : std::nullopt);
+
+        outPtrs.push_back(&outputs[o]);
+    }
+
+    auto cvt = CreateOperator<cvcuda::ConvertTo>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    for (Tensor &output : outputs)
+    {
+        guard.add(LockMode::LOCK_WRITE, {output});
+    }
+    guard.add(LockMode::LOCK_NONE, {*cvt});
+
+    cvt->submit(pstream->cudaHandle(), input, outPtrs.data(), params.data(), static_cast<int32_t>(numOutputs));
+
+    return outputs;
+}
+
+std::vector<Tensor> ConvertToMulti(Tensor &input, std::vector<nvcv::DataType> dtypes,
+                                   std::optional<std::vector<ChannelValues>> scale,
+                                   std::optional<std::vector<ChannelValues>> offset,
+                                   std::optional<std::vector<std::optional<nvcv::TensorLayout>>> layout,
+                                   std::optional<std::vector<std::optional<std::vector<int>>>> channelOrder,
+                                   std::optional<Stream> pstream)
+{
+    if (layout && layout->size() != dtypes.size())
+    {
+        throw std::invalid_argument("Layouts must be given for each output");
+    }
+
+    std::vector<Tensor> outputs;
+    for (size_t o = 0; o < dtypes.size(); ++o)
+    {
+        std::optional<nvcv::TensorLayout> outLayout = layout ? (*layout)[o] : std::nullopt;
+
+        nvcv::TensorShape outShape = outLayout ? Permute(input.shape(), *outLayout) : input.shape();
+        outputs.push_back(Tensor::Create(outShape, dtypes[o]));
+    }
+
+    return ConvertToMultiInto(std::move(outputs), input, std::move(scale), std::move(offset),
+                              std::move(channelOrder), pstream);
 }
 
 } // namespace
@@ -59,9 +192,18 @@ void ExportOpConvertTo(py::module &m)
     using namespace pybind11::literals;
 
     m.def("convertto", &ConvertTo, "src"_a, "dtype"_a, "scale"_a = 1, "offset"_a = 0, py::kw_only(),
-          "stream"_a = nullptr);
+          "channel_order"_a = std::nullopt, "stream"_a = nullptr);
     m.def("convertto_into", &ConvertToInto, "dst"_a, "src"_a, "scale"_a = 1, "offset"_a = 0, py::kw_only(),
+          "channel_order"_a = std::nullopt, "stream"_a = nullptr);
+    m.def("convertto", &ConvertToPerChannel, "src"_a, "dtype"_a, "scale"_a, "offset"_a, py::kw_only(),
+          "layout"_a = std::nullopt, "stream"_a = nullptr);
+    m.def("convertto_into", &ConvertToPerChannelInto, "dst"_a, "src"_a, "scale"_a, "offset"_a, py::kw_only(),
           "stream"_a = nullptr);
+
+    m.def("convertto_multi", &ConvertToMulti, "src"_a, "dtypes"_a, py::kw_only(), "scale"_a = std::nullopt,
+          "offset"_a = std::nullopt, "layout"_a = std::nullopt, "channel_order"_a = std::nullopt, "stream"_a = nullptr);
+    m.def("convertto_multi_into", &ConvertToMultiInto, "dst"_a, "src"_a, py::kw_only(), "scale"_a = std::nullopt,
+          "offset"_a = std::nullopt, "channel_order"_a = std::nullopt, "stream"_a = nullptr);
 }
 
 } // namespace cvcudapy
@@ -79,7 +79,7 @@ Tensor CopyMakeBorder(Tensor &input, NVCVBorderType borderMode, const std::vecto
 
 Tensor VarShapeCopyMakeBorderStackInto(Tensor &output, ImageBatchVarShape &input, NVCVBorderType borderMode,
                                        const std::vector<float> &borderValue, Tensor &top, Tensor &left,
-                                       std::optional<Stream> pstream)
+                                       std::optional<Tensor> borderValues, std::optional<Stream> pstream)
 {
     if (!pstream)
     {
@@ -105,14 +105,22 @@ Tensor VarShapeCopyMakeBorderStackInto(Tensor &output, ImageBatchVarShape &input
     guard.add(LockMode::LOCK_WRITE, {output});
     guard.add(LockMode::LOCK_NONE, {*copyMakeBorder});
 
-    copyMakeBorder->submit(pstream->cudaHandle(), input, output, top, left, borderMode, bValue);
+    if (borderValues)
+    {
+        guard.add(LockMode::LOCK_READ, {*borderValues});
+        copyMakeBorder->submit(pstream->cudaHandle(), input, output, top, left, borderMode, *borderValues);
+    }
+    else
+    {
+        copyMakeBorder->submit(pstream->cudaHandle(), input, output, top, left, borderMode, bValue);
+    }
 
     return output;
 }
 
 Tensor VarShapeCopyMakeBorderStack(ImageBatchVarShape &input, NVCVBorderType borderMode,
                                    const std::vector<float> &borderValue, Tensor &top, Tensor &left, int out_height,
-                                   int out_width, std::optional<Stream> pstream)
+                                   int out_width, std::optional<Tensor> borderValues, std::optional<Stream> pstream)
 {
     auto format = input.uniqueFormat();
     if (!format)
@@ -122,7 +130,7 @@ Tensor VarShapeCopyMakeBorderStack(ImageBatchVarShape &input, NVCVBorderType bor
 
     Tensor output = Tensor::CreateForImageBatch(input.numImages(), {out_width, out_height}, format);
 
-    return VarShapeCopyMakeBorderStackInto(output, input, borderMode, borderValue, top, left, pstream);
+    return VarShapeCopyMakeBorderStackInto(output, input, borderMode, borderValue, top, left, borderValues, pstream);
 }
 
 ImageBatchVarShape VarShapeCopyMakeBorderInto(ImageBatchVarShape &output, ImageBatchVarShape &input,
@@ -205,10 +213,11 @@ void ExportOpCopyMakeBorder(py::module &m)
           py::kw_only(), "top"_a, "left"_a, "stream"_a = nullptr);
     m.def("copymakeborderstack", &VarShapeCopyMakeBorderStack, "src"_a,
           "border_mode"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, "border_value"_a = std::vector<float>(),
-          py::kw_only(), "top"_a, "left"_a, "out_height"_a, "out_width"_a, "stream"_a = nullptr);
+          py::kw_only(), "top"_a, "left"_a, "out_height"_a, "out_width"_a, "border_values"_a = nullptr,
+          "stream"_a = nullptr);
     m.def("copymakeborderstack_into", &VarShapeCopyMakeBorderStackInto, "dst"_a, "src"_a,
           "border_mode"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, "border_value"_a = std::vector<float>(),
-          py::kw_only(), "top"_a, "left"_a, "stream"_a = nullptr);
+          py::kw_only(), "top"_a, "left"_a, "border_values"_a = nullptr, "stream"_a = nullptr);
     m.def("copymakeborder", &VarShapeCopyMakeBorder, "src"_a, "border_mode"_a = NVCVBorderType::NVCV_BORDER_CONSTANT,
           "border_value"_a = std::vector<float>(), py::kw_only(), "top"_a, "left"_a, "out_heights"_a, "out_widths"_a,
           "stream"_a       = nullptr);
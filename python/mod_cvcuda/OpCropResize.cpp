@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <cvcuda/OpCropResize.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ImageBatchVarShape.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+Tensor CropResizeInto(Tensor &output, Tensor &input, Tensor &boxes, NVCVInterpolationType interp,
+                      std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto op = CreateOperator<cvcuda::CropResize>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, boxes});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*op});
+
+    op->submit(pstream->cudaHandle(), input, boxes, output, interp);
+
+    return std::move(output);
+}
+
+Tensor CropResize(Tensor &input, Tensor &boxes, const std::tuple<int, int> &size, NVCVInterpolationType interp,
+                  std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    if (boxes.shape().rank() != 2)
+    {
+        throw std::invalid_argument("Boxes tensor must have shape [N, 4] or [N, 5]");
+    }
+
+    nvcv::TensorShape::ShapeType shape{boxes.shape()[0], std::get<1>(size), std::get<0>(size),
+                                       info->numChannels()};
+
+    Tensor output = Tensor::Create(nvcv::TensorShape(shape, nvcv::TENSOR_NHWC), input.dtype());
+
+    return CropResizeInto(output, input, boxes, interp, pstream);
+}
+
+Tensor CropResizeVarShapeInto(Tensor &output, ImageBatchVarShape &input, Tensor &boxes, NVCVInterpolationType interp,
+                              std::optional<Tensor> flipCode, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto op = CreateOperator<cvcuda::CropResize>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, boxes});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*op});
+    if (flipCode)
+    {
+        guard.add(LockMode::LOCK_READ, {*flipCode});
+    }
+
+    op->submit(pstream->cudaHandle(), input, boxes, flipCode ? &*flipCode : nullptr, output, interp);
+
+    return std::move(output);
+}
+
+Tensor CropResizeVarShape(ImageBatchVarShape &input, Tensor &boxes, const std::tuple<int, int> &size,
+                          NVCVInterpolationType interp, std::optional<Tensor> flipCode, std::optional<Stream> pstream)
+{
+    auto format = input.uniqueFormat();
+    if (!format)
+    {
+        throw std::runtime_error("All images in input must have the same format.");
+    }
+
+    if (boxes.shape().rank() != 2)
+    {
+        throw std::invalid_argument("Boxes tensor must have shape [N, 4] or [N, 5]");
+    }
+
+    Tensor output = Tensor::CreateForImageBatch(boxes.shape()[0], {std::get<0>(size), std::get<1>(size)}, format);
+
+    return CropResizeVarShapeInto(output, input, boxes, interp, flipCode, pstream);
+}
+
+} // namespace
+
+void ExportOpCropResize(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("crop_resize", &CropResize, "src"_a, "boxes"_a, "size"_a, "interp"_a = NVCV_INTERP_LINEAR, py::kw_only(),
+          "stream"_a = nullptr);
+    m.def("crop_resize_into", &CropResizeInto, "dst"_a, "src"_a, "boxes"_a, "interp"_a = NVCV_INTERP_LINEAR,
+          py::kw_only(), "stream"_a = nullptr);
+    m.def("crop_resize", &CropResizeVarShape, "src"_a, "boxes"_a, "size"_a, "interp"_a = NVCV_INTERP_LINEAR,
+          py::kw_only(), "flip_code"_a = nullptr, "stream"_a = nullptr);
+    m.def("crop_resize_into", &CropResizeVarShapeInto, "dst"_a, "src"_a, "boxes"_a, "interp"_a = NVCV_INTERP_LINEAR,
+          py::kw_only(), "flip_code"_a = nullptr, "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
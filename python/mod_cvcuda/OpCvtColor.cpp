@@ -248,7 +248,11 @@ const std::unordered_map<NVCVColorConversionCode, NVCVImageFormat> kOutputFormat
   //NVCV_COLOR_RGBA2YUV420sp
   //NVCV_COLOR_BGRA2YUV_NV21
   //NVCV_COLOR_BGRA2YUV420sp
-  //NVCV_COLORCVT_MAX = 148,
+    { NVCV_COLOR_YUV2RGB_P010,  NVCV_IMAGE_FORMAT_RGB8},
+    { NVCV_COLOR_YUV2BGR_P010,  NVCV_IMAGE_FORMAT_BGR8},
+    {NVCV_COLOR_YUV2RGBA_P010, NVCV_IMAGE_FORMAT_RGBA8},
+    {NVCV_COLOR_YUV2BGRA_P010, NVCV_IMAGE_FORMAT_BGRA8},
+  //NVCV_COLORCVT_MAX = 152,
 };
 
 nvcv::ImageFormat GetOutputFormat(nvcv::DataType in, NVCVColorConversionCode code)
@@ -363,6 +367,42 @@ ImageBatchVarShape CvtColorVarShape(ImageBatchVarShape &input, NVCVColorConversi
     return CvtColorVarShapeInto(output, input, code, pstream);
 }
 
+ImageBatchVarShape CvtColorMixedVarShapeInto(ImageBatchVarShape &output, ImageBatchVarShape &input,
+                                             std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto cvtColor = CreateOperator<cvcuda::CvtColor>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*cvtColor});
+
+    cvtColor->submit(pstream->cudaHandle(), input, output);
+
+    return output;
+}
+
+ImageBatchVarShape CvtColorMixedVarShape(ImageBatchVarShape &input, nvcv::ImageFormat fmt,
+                                         std::optional<Stream> pstream)
+{
+    ImageBatchVarShape output = ImageBatchVarShape::Create(input.capacity());
+
+    for (int i = 0; i < input.numImages(); ++i)
+    {
+        nvcv::Size2D size = input[i].size();
+
+        auto img = Image::Create(size, fmt);
+        output.pushBack(img);
+    }
+
+    return CvtColorMixedVarShapeInto(output, input, pstream);
+}
+
 } // namespace
 
 void ExportOpCvtColor(py::module &m)
@@ -374,6 +414,9 @@ void ExportOpCvtColor(py::module &m)
 
     m.def("cvtcolor", &CvtColorVarShape, "src"_a, "code"_a, py::kw_only(), "stream"_a = nullptr);
     m.def("cvtcolor_into", &CvtColorVarShapeInto, "dst"_a, "src"_a, "code"_a, py::kw_only(), "stream"_a = nullptr);
+
+    m.def("cvtcolor", &CvtColorMixedVarShape, "src"_a, "format"_a, py::kw_only(), "stream"_a = nullptr);
+    m.def("cvtcolor_into", &CvtColorMixedVarShapeInto, "dst"_a, "src"_a, py::kw_only(), "stream"_a = nullptr);
 }
 
 } // namespace cvcudapy
@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpDemosaic.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+#include <algorithm>
+
+namespace cvcudapy {
+
+namespace {
+
+const std::vector<float> kUnitGains{1, 1, 1};
+const std::vector<float> kIdentityCcm{1, 0, 0, 0, 1, 0, 0, 0, 1};
+
+Tensor DemosaicInto(Tensor &output, Tensor &input, NVCVRawPattern pattern, NVCVDemosaicType type,
+                    const std::vector<float> &wbGains, const std::vector<float> &ccm, float gamma,
+                    std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    if (wbGains.size() != 3)
+    {
+        throw std::runtime_error("White balance gains must have 3 values, for red, green and blue");
+    }
+    if (ccm.size() != 9)
+    {
+        throw std::runtime_error("Color correction matrix must have 9 values, in row-major order");
+    }
+
+    NVCVDemosaicParams params;
+    std::copy(wbGains.begin(), wbGains.end(), params.wbGains);
+    std::copy(ccm.begin(), ccm.end(), params.ccm);
+    params.gamma = gamma;
+
+    auto demosaic = CreateOperator<cvcuda::Demosaic>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*demosaic});
+
+    demosaic->submit(pstream->cudaHandle(), input, output, pattern, type, &params);
+
+    return output;
+}
+
+// The output has the layout of the input, with the given number of channels and data type
+Tensor Demosaic(Tensor &input, NVCVRawPattern pattern, NVCVDemosaicType type, const std::vector<float> &wbGains,
+                const std::vector<float> &ccm, float gamma, int32_t channels, nvcv::DataType dtype,
+                std::optional<Stream> pstream)
+{
+    nvcv::TensorShape::ShapeType shape = input.shape().shape();
+
+    const nvcv::TensorLayout &layout = input.shape().layout();
+    if (layout.find('C') < 0 || layout.find('H') < 0 || layout.find('W') < 0)
+    {
+        throw std::runtime_error("Input tensor must have an image layout with channels");
+    }
+    shape[layout.find('C')] = channels;
+
+    Tensor output = Tensor::Create(nvcv::TensorShape(shape, layout), dtype);
+
+    return DemosaicInto(output, input, pattern, type, wbGains, ccm, gamma, pstream);
+}
+
+} // namespace
+
+void ExportOpDemosaic(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("demosaic", &Demosaic, "src"_a, "pattern"_a, "type"_a = NVCV_DEMOSAIC_BILINEAR, py::kw_only(),
+          "wb_gains"_a = kUnitGains, "ccm"_a = kIdentityCcm, "gamma"_a = 1.0f, "channels"_a = 3,
+          "dtype"_a = nvcv::TYPE_U8, "stream"_a = nullptr);
+    m.def("demosaic_into", &DemosaicInto, "dst"_a, "src"_a, "pattern"_a, "type"_a = NVCV_DEMOSAIC_BILINEAR,
+          py::kw_only(), "wb_gains"_a = kUnitGains, "ccm"_a = kIdentityCcm, "gamma"_a = 1.0f, "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -92,6 +92,39 @@ ImageBatchVarShape FlipVarShape(ImageBatchVarShape &input, Tensor &flipCode, std
     return FlipVarShapeInto(output, input, flipCode, pstream);
 }
 
+Tensor FlipVarShapeStackInto(Tensor &output, ImageBatchVarShape &input, Tensor &flipCode,
+                             std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto flip = CreateOperator<cvcuda::Flip>(0);
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, flipCode});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*flip});
+
+    flip->submit(pstream->cudaHandle(), input, output, flipCode);
+
+    return output;
+}
+
+Tensor FlipVarShapeStack(ImageBatchVarShape &input, Tensor &flipCode, std::optional<Stream> pstream)
+{
+    auto format = input.uniqueFormat();
+    if (!format)
+    {
+        throw std::runtime_error("All images in input must have the same format.");
+    }
+
+    Tensor output = Tensor::CreateForImageBatch(input.numImages(), input.maxSize(), format);
+
+    return FlipVarShapeStackInto(output, input, flipCode, pstream);
+}
+
 } // namespace
 
 void ExportOpFlip(py::module &m)
@@ -103,6 +136,10 @@ void ExportOpFlip(py::module &m)
 
     m.def("flip", &FlipVarShape, "src"_a, "flipCode"_a, py::kw_only(), "stream"_a = nullptr);
     m.def("flip_into", &FlipVarShapeInto, "dst"_a, "src"_a, "flipCode"_a, py::kw_only(), "stream"_a = nullptr);
+
+    m.def("flipstack", &FlipVarShapeStack, "src"_a, "flipCode"_a, py::kw_only(), "stream"_a = nullptr);
+    m.def("flipstack_into", &FlipVarShapeStackInto, "dst"_a, "src"_a, "flipCode"_a, py::kw_only(),
+          "stream"_a = nullptr);
 }
 
 } // namespace cvcudapy
@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpGuidedFilter.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ImageBatchVarShape.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+Tensor GuidedFilterInto(Tensor &output, Tensor &input, Tensor &guide, int32_t radius, float eps, int32_t subsample,
+                        std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    // The workspace holds the box sums and coefficients of the input, it's sized by the input
+    auto guidedFilter = CreateOperator<cvcuda::GuidedFilter>(info->numSamples(), info->numCols(), info->numRows());
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, guide});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_WRITE, {*guidedFilter});
+
+    guidedFilter->submit(pstream->cudaHandle(), input, guide, output, radius, eps, subsample);
+
+    return output;
+}
+
+Tensor GuidedFilter(Tensor &input, Tensor &guide, int32_t radius, float eps, int32_t subsample,
+                    std::optional<Stream> pstream)
+{
+    Tensor output = Tensor::Create(input.shape(), input.dtype());
+
+    return GuidedFilterInto(output, input, guide, radius, eps, subsample, pstream);
+}
+
+ImageBatchVarShape VarShapeGuidedFilterInto(ImageBatchVarShape &output, ImageBatchVarShape &input,
+                                            ImageBatchVarShape &guide, int32_t radius, float eps, int32_t subsample,
+                                            std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    nvcv::Size2D maxSize      = input.maxSize();
+    auto         guidedFilter = CreateOperator<cvcuda::GuidedFilter>(input.capacity(), maxSize.w, maxSize.h);
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, guide});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_WRITE, {*guidedFilter});
+
+    guidedFilter->submit(pstream->cudaHandle(), input, guide, output, radius, eps, subsample);
+
+    return output;
+}
+
+ImageBatchVarShape VarShapeGuidedFilter(ImageBatchVarShape &input, ImageBatchVarShape &guide, int32_t radius,
+                                        float eps, int32_t subsample, std::optional<Stream> pstream)
+{
+    ImageBatchVarShape output = ImageBatchVarShape::Create(input.capacity());
+
+    for (int i = 0; i < input.numImages(); ++i)
+    {
+        nvcv::ImageFormat format = input[i].format();
+        nvcv::Size2D      size   = input[i].size();
+        auto              image  = Image::Create(size, format);
+        output.pushBack(image);
+    }
+
+    return VarShapeGuidedFilterInto(output, input, guide, radius, eps, subsample, pstream);
+}
+
+} // namespace
+
+void ExportOpGuidedFilter(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("guided_filter", &GuidedFilter, "src"_a, "guide"_a, "radius"_a, "eps"_a, py::kw_only(), "subsample"_a = 1,
+          "stream"_a = nullptr);
+    m.def("guided_filter_into", &GuidedFilterInto, "dst"_a, "src"_a, "guide"_a, "radius"_a, "eps"_a, py::kw_only(),
+          "subsample"_a = 1, "stream"_a = nullptr);
+
+    m.def("guided_filter", &VarShapeGuidedFilter, "src"_a, "guide"_a, "radius"_a, "eps"_a, py::kw_only(),
+          "subsample"_a = 1, "stream"_a = nullptr);
+    m.def("guided_filter_into", &VarShapeGuidedFilterInto, "dst"_a, "src"_a, "guide"_a, "radius"_a, "eps"_a,
+          py::kw_only(), "subsample"_a = 1, "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <cvcuda/OpHarris.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+#include <tuple>
+
+namespace cvcudapy {
+
+namespace {
+
+using KeypointResult = std::tuple<Tensor, Tensor, Tensor>;
+
+KeypointResult HarrisInto(Tensor &keypoints, Tensor &scores, Tensor &count, Tensor &input, float threshold,
+                          int blockSize, float k, NVCVCornerResponseType type, NVCVBorderType border,
+                          std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto op = CreateOperator<cvcuda::Harris>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {keypoints, scores, count});
+    guard.add(LockMode::LOCK_NONE, {*op});
+
+    op->submit(pstream->cudaHandle(), input, keypoints, scores, count, type, blockSize, k, threshold, border);
+
+    return {keypoints, scores, count};
+}
+
+// Same outputs as FAST, with the corner responses as scores
+KeypointResult Harris(Tensor &input, int capacity, float threshold, int blockSize, float k,
+                      NVCVCornerResponseType type, NVCVBorderType border, std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    Tensor keypoints = Tensor::Create(nvcv::TensorShape({info->numSamples(), 1, capacity, 2}, nvcv::TENSOR_NHWC),
+                                      nvcv::TYPE_S32);
+    Tensor scores
+        = Tensor::Create(nvcv::TensorShape({info->numSamples(), 1, capacity, 1}, nvcv::TENSOR_NHWC), nvcv::TYPE_F32);
+    Tensor count = Tensor::Create(nvcv::TensorShape({info->numSamples(), 1, 1, 1}, nvcv::TENSOR_NHWC), nvcv::TYPE_S32);
+
+    return HarrisInto(keypoints, scores, count, input, threshold, blockSize, k, type, border, pstream);
+}
+
+} // namespace
+
+void ExportOpHarris(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("harris", &Harris, "src"_a, "capacity"_a, "threshold"_a, "block_size"_a = 3, "k"_a = 0.04f,
+          "type"_a = NVCV_CORNER_HARRIS, py::kw_only(), "border"_a = NVCV_BORDER_REFLECT101, "stream"_a = nullptr);
+    m.def("harris_into", &HarrisInto, "keypoints"_a, "scores"_a, "count"_a, "src"_a, "threshold"_a,
+          "block_size"_a = 3, "k"_a = 0.04f, "type"_a = NVCV_CORNER_HARRIS, py::kw_only(),
+          "border"_a = NVCV_BORDER_REFLECT101, "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpHistogramEq.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ImageBatchVarShape.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+Tensor HistogramEqInto(Tensor &output, Tensor &input, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    auto histogramEq = CreateOperator<cvcuda::HistogramEq>(static_cast<int32_t>(info->numSamples()));
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*histogramEq});
+
+    histogramEq->submit(pstream->cudaHandle(), input, output);
+
+    return output;
+}
+
+Tensor HistogramEq(Tensor &input, std::optional<Stream> pstream)
+{
+    Tensor output = Tensor::Create(input.shape(), input.dtype());
+
+    return HistogramEqInto(output, input, pstream);
+}
+
+ImageBatchVarShape HistogramEqVarShapeInto(ImageBatchVarShape &output, ImageBatchVarShape &input,
+                                           std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto histogramEq = CreateOperator<cvcuda::HistogramEq>(input.capacity());
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*histogramEq});
+
+    histogramEq->submit(pstream->cudaHandle(), input, output);
+
+    return output;
+}
+
+ImageBatchVarShape HistogramEqVarShape(ImageBatchVarShape &input, std::optional<Stream> pstream)
+{
+    ImageBatchVarShape output = ImageBatchVarShape::Create(input.capacity());
+
+    for (int i = 0; i < input.numImages(); ++i)
+    {
+        nvcv::ImageFormat format = input[i].format();
+        nvcv::Size2D      size   = input[i].size();
+        auto              image  = Image::Create(size, format);
+        output.pushBack(image);
+    }
+
+    return HistogramEqVarShapeInto(output, input, pstream);
+}
+
+} // namespace
+
+void ExportOpHistogramEq(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("histogram_eq", &HistogramEq, "src"_a, py::kw_only(), "stream"_a = nullptr);
+    m.def("histogram_eq_into", &HistogramEqInto, "dst"_a, "src"_a, py::kw_only(), "stream"_a = nullptr);
+    m.def("histogram_eq", &HistogramEqVarShape, "src"_a, py::kw_only(), "stream"_a = nullptr);
+    m.def("histogram_eq_into", &HistogramEqVarShapeInto, "dst"_a, "src"_a, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
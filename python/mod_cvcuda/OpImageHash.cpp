@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpImageHash.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ImageBatchVarShape.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+Tensor ImageHashInto(Tensor &output, Tensor &input, NVCVImageHashType type, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto imageHash = CreateOperator<cvcuda::ImageHash>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*imageHash});
+
+    imageHash->submit(pstream->cudaHandle(), input, output, type);
+
+    return output;
+}
+
+// Hashes are [N, 1, 1, 1] uint64 tensors
+Tensor CreateImageHashOutput(int64_t numSamples)
+{
+    return Tensor::Create(nvcv::TensorShape({numSamples, 1, 1, 1}, nvcv::TENSOR_NHWC), nvcv::TYPE_U64);
+}
+
+Tensor ImageHash(Tensor &input, NVCVImageHashType type, std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    Tensor output = CreateImageHashOutput(info->numSamples());
+
+    return ImageHashInto(output, input, type, pstream);
+}
+
+Tensor ImageHashVarShapeInto(Tensor &output, ImageBatchVarShape &input, NVCVImageHashType type,
+                             std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto imageHash = CreateOperator<cvcuda::ImageHash>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*imageHash});
+
+    imageHash->submit(pstream->cudaHandle(), input, output, type);
+
+    return output;
+}
+
+Tensor ImageHashVarShape(ImageBatchVarShape &input, NVCVImageHashType type, std::optional<Stream> pstream)
+{
+    Tensor output = CreateImageHashOutput(input.numImages());
+
+    return ImageHashVarShapeInto(output, input, type, pstream);
+}
+
+} // namespace
+
+void ExportOpImageHash(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("image_hash", &ImageHash, "src"_a, "type"_a = NVCV_IMAGE_HASH_EXACT, py::kw_only(), "stream"_a = nullptr);
+    m.def("image_hash_into", &ImageHashInto, "dst"_a, "src"_a, "type"_a = NVCV_IMAGE_HASH_EXACT, py::kw_only(),
+          "stream"_a = nullptr);
+    m.def("image_hash", &ImageHashVarShape, "src"_a, "type"_a = NVCV_IMAGE_HASH_EXACT, py::kw_only(),
+          "stream"_a = nullptr);
+    m.def("image_hash_into", &ImageHashVarShapeInto, "dst"_a, "src"_a, "type"_a = NVCV_IMAGE_HASH_EXACT,
+          py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
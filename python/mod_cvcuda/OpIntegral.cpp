@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpIntegral.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+Tensor IntegralInto(Tensor &sum, Tensor &input, std::optional<Tensor> sqsum, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    // The workspace holds the look-back state of the scans, it's sized by the input
+    auto integral = CreateOperator<cvcuda::Integral>(info->numSamples(), info->numCols(), info->numRows());
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {sum});
+    if (sqsum)
+    {
+        guard.add(LockMode::LOCK_WRITE, {*sqsum});
+    }
+    guard.add(LockMode::LOCK_WRITE, {*integral});
+
+    if (sqsum)
+    {
+        integral->submit(pstream->cudaHandle(), input, sum, *sqsum);
+    }
+    else
+    {
+        integral->submit(pstream->cudaHandle(), input, sum);
+    }
+
+    return sum;
+}
+
+// The sum has one more row and column than the input
+Tensor Integral(Tensor &input, nvcv::DataType dtype, std::optional<Stream> pstream)
+{
+    nvcv::TensorShape::ShapeType shape = input.shape().shape();
+
+    const nvcv::TensorLayout &layout = input.shape().layout();
+    if (layout.find('H') < 0 || layout.find('W') < 0)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+    shape[layout.find('H')] += 1;
+    shape[layout.find('W')] += 1;
+
+    Tensor sum = Tensor::Create(nvcv::TensorShape(shape, layout), dtype);
+
+    return IntegralInto(sum, input, std::nullopt, pstream);
+}
+
+} // namespace
+
+void ExportOpIntegral(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("integral", &Integral, "src"_a, "dtype"_a = nvcv::TYPE_F64, py::kw_only(), "stream"_a = nullptr);
+    m.def("integral_into", &IntegralInto, "dst"_a, "src"_a, "sqsum"_a = nullptr, py::kw_only(),
+          "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpLabel.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+#include <tuple>
+
+namespace cvcudapy {
+
+namespace {
+
+Tensor LabelInto(Tensor &output, Tensor &input, int32_t connectivity, std::optional<Tensor> count,
+                 std::optional<Tensor> stats, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto label = CreateOperator<cvcuda::Label>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    if (count)
+    {
+        guard.add(LockMode::LOCK_WRITE, {*count});
+    }
+    if (stats)
+    {
+        guard.add(LockMode::LOCK_WRITE, {*stats});
+    }
+    guard.add(LockMode::LOCK_NONE, {*label});
+
+    label->submit(pstream->cudaHandle(), input, output, connectivity, count ? &*count : nullptr,
+                  stats ? &*stats : nullptr);
+
+    return output;
+}
+
+using LabelResult = std::tuple<Tensor, Tensor, std::optional<Tensor>>;
+
+// Labels are int32 tensors of the input shape, counts [N, 1, 1, 1] int32 tensors and statistics
+// [N, 1, max_stats, 6] int32 tensors, if any
+LabelResult Label(Tensor &input, int32_t connectivity, int32_t maxStats, std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    Tensor output = Tensor::Create(input.shape(), nvcv::TYPE_S32);
+    Tensor count  = Tensor::Create(nvcv::TensorShape({info->numSamples(), 1, 1, 1}, nvcv::TENSOR_NHWC), nvcv::TYPE_S32);
+
+    std::optional<Tensor> stats;
+    if (maxStats > 0)
+    {
+        stats = Tensor::Create(nvcv::TensorShape({info->numSamples(), 1, maxStats, 6}, nvcv::TENSOR_NHWC),
+                               nvcv::TYPE_S32);
+    }
+
+    LabelInto(output, input, connectivity, count, stats, pstream);
+
+    return {output, count, stats};
+}
+
+} // namespace
+
+void ExportOpLabel(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("label", &Label, "src"_a, "connectivity"_a = 8, "max_stats"_a = 0, py::kw_only(), "stream"_a = nullptr);
+    m.def("label_into", &LabelInto, "dst"_a, "src"_a, "connectivity"_a = 8, "count"_a = nullptr,
+          "stats"_a = nullptr, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
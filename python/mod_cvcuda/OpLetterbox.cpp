@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpLetterbox.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/cuda/TypeTraits.hpp>
+#include <nvcv/python/ImageBatchVarShape.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Shape.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+#include <tuple>
+
+namespace cvcudapy {
+
+namespace {
+
+using LetterboxResult = std::tuple<Tensor, Tensor>;
+
+float4 GetFillValue(const std::vector<float> &fillValue)
+{
+    if (fillValue.size() > 4)
+    {
+        throw std::runtime_error(
+            util::FormatString("Channels of fill_value should <= 4, current is '%lu'", fillValue.size()));
+    }
+
+    float4 value;
+    for (size_t i = 0; i < 4; i++)
+    {
+        nvcv::cuda::GetElement(value, i) = fillValue.size() > i ? fillValue[i] : 0.f;
+    }
+    return value;
+}
+
+// The transform is a [N, 1, 1, 4] float32 tensor holding [scale_x, scale_y, offset_x, offset_y]
+Tensor CreateTransform(int64_t numSamples)
+{
+    return Tensor::Create(nvcv::TensorShape({numSamples, 1, 1, 4}, nvcv::TENSOR_NHWC), nvcv::TYPE_F32);
+}
+
+Tensor LetterboxInto(Tensor &output, Tensor &input, std::optional<Tensor> transform, NVCVInterpolationType interp,
+                     const std::vector<float> &fillValue, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto letterbox = CreateOperator<cvcuda::Letterbox>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*letterbox});
+    if (transform)
+    {
+        guard.add(LockMode::LOCK_WRITE, {*transform});
+    }
+
+    letterbox->submit(pstream->cudaHandle(), input, output, transform ? &*transform : nullptr, interp,
+                      GetFillValue(fillValue));
+
+    return std::move(output);
+}
+
+LetterboxResult Letterbox(Tensor &input, int outHeight, int outWidth, NVCVInterpolationType interp,
+                          const std::vector<float> &fillValue, std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    Shape out_shape     = CreateShape(input.shape());
+    int   cdim          = out_shape.size() - 1;
+    out_shape[cdim - 2] = outHeight;
+    out_shape[cdim - 1] = outWidth;
+
+    Tensor output    = Tensor::Create(out_shape, input.dtype(), input.layout());
+    Tensor transform = CreateTransform(info->numSamples());
+
+    LetterboxInto(output, input, transform, interp, fillValue, pstream);
+
+    return {output, transform};
+}
+
+Tensor LetterboxVarShapeInto(Tensor &output, ImageBatchVarShape &input, std::optional<Tensor> transform,
+                             NVCVInterpolationType interp, const std::vector<float> &fillValue,
+                             std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto letterbox = CreateOperator<cvcuda::Letterbox>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*letterbox});
+    if (transform)
+    {
+        guard.add(LockMode::LOCK_WRITE, {*transform});
+    }
+
+    letterbox->submit(pstream->cudaHandle(), input, output, transform ? &*transform : nullptr, interp,
+                      GetFillValue(fillValue));
+
+    return std::move(output);
+}
+
+LetterboxResult LetterboxVarShape(ImageBatchVarShape &input, int outHeight, int outWidth,
+                                  NVCVInterpolationType interp, const std::vector<float> &fillValue,
+                                  std::optional<Stream> pstream)
+{
+    auto format = input.uniqueFormat();
+    if (!format)
+    {
+        throw std::runtime_error("All images in input must have the same format.");
+    }
+
+    Tensor output    = Tensor::CreateForImageBatch(input.numImages(), {outWidth, outHeight}, format);
+    Tensor transform = CreateTransform(input.numImages());
+
+    LetterboxVarShapeInto(output, input, transform, interp, fillValue, pstream);
+
+    return {output, transform};
+}
+
+} // namespace
+
+void ExportOpLetterbox(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("letterbox", &Letterbox, "src"_a, py::kw_only(), "out_height"_a, "out_width"_a,
+          "interp"_a = NVCV_INTERP_LINEAR, "fill_value"_a = std::vector<float>(), "stream"_a = nullptr);
+    m.def("letterbox_into", &LetterboxInto, "dst"_a, "src"_a, py::kw_only(), "transform"_a = nullptr,
+          "interp"_a = NVCV_INTERP_LINEAR, "fill_value"_a = std::vector<float>(), "stream"_a = nullptr);
+    m.def("letterbox", &LetterboxVarShape, "src"_a, py::kw_only(), "out_height"_a, "out_width"_a,
+          "interp"_a = NVCV_INTERP_LINEAR, "fill_value"_a = std::vector<float>(), "stream"_a = nullptr);
+    m.def("letterbox_into", &LetterboxVarShapeInto, "dst"_a, "src"_a, py::kw_only(), "transform"_a = nullptr,
+          "interp"_a = NVCV_INTERP_LINEAR, "fill_value"_a = std::vector<float>(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpMaskOverlay.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+Tensor MaskOverlayInto(Tensor &output, Tensor &input, Tensor &labels, Tensor &palette, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto overlay = CreateOperator<cvcuda::MaskOverlay>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, labels, palette});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*overlay});
+
+    overlay->submit(pstream->cudaHandle(), input, labels, palette, output);
+
+    return std::move(output);
+}
+
+Tensor MaskOverlay(Tensor &input, Tensor &labels, Tensor &palette, std::optional<Stream> pstream)
+{
+    Tensor output = Tensor::Create(input.shape(), input.dtype());
+
+    return MaskOverlayInto(output, input, labels, palette, pstream);
+}
+
+} // namespace
+
+void ExportOpMaskOverlay(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("mask_overlay", &MaskOverlay, "src"_a, "labels"_a, "palette"_a, py::kw_only(), "stream"_a = nullptr);
+    m.def("mask_overlay_into", &MaskOverlayInto, "dst"_a, "src"_a, "labels"_a, "palette"_a, py::kw_only(),
+          "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <cvcuda/OpMatchTemplate.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+Tensor MatchTemplateInto(Tensor &output, Tensor &input, Tensor &templ, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto op = CreateOperator<cvcuda::MatchTemplate>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, templ});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*op});
+
+    op->submit(pstream->cudaHandle(), input, templ, output);
+
+    return std::move(output);
+}
+
+Tensor MatchTemplate(Tensor &input, Tensor &templ, std::optional<Stream> pstream)
+{
+    auto info      = nvcv::TensorShapeInfoImage::Create(input.shape());
+    auto templInfo = nvcv::TensorShapeInfoImage::Create(templ.shape());
+    if (!info || !templInfo)
+    {
+        throw std::runtime_error("Input and template tensors must have an image layout");
+    }
+
+    // One score per position of the template inside the image
+    nvcv::TensorShape::ShapeType shape{info->numSamples(), info->numRows() - templInfo->numRows() + 1,
+                                       info->numCols() - templInfo->numCols() + 1, 1};
+
+    Tensor output = Tensor::Create(nvcv::TensorShape(shape, nvcv::TENSOR_NHWC), nvcv::TYPE_F32);
+
+    return MatchTemplateInto(output, input, templ, pstream);
+}
+
+} // namespace
+
+void ExportOpMatchTemplate(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("match_template", &MatchTemplate, "src"_a, "templ"_a, py::kw_only(), "stream"_a = nullptr);
+    m.def("match_template_into", &MatchTemplateInto, "dst"_a, "src"_a, "templ"_a, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpMinMaxLoc.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ImageBatchVarShape.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+#include <tuple>
+
+namespace cvcudapy {
+
+namespace {
+
+using MinMaxLocResult = std::tuple<Tensor, Tensor, Tensor, Tensor>;
+
+MinMaxLocResult MinMaxLocInto(Tensor &minVal, Tensor &minLoc, Tensor &maxVal, Tensor &maxLoc, Tensor &input,
+                              std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto minMaxLoc = CreateOperator<cvcuda::MinMaxLoc>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {minVal, minLoc, maxVal, maxLoc});
+    guard.add(LockMode::LOCK_NONE, {*minMaxLoc});
+
+    minMaxLoc->submit(pstream->cudaHandle(), input, minVal, minLoc, maxVal, maxLoc);
+
+    return {minVal, minLoc, maxVal, maxLoc};
+}
+
+// Values are [N, 1, 1, 1] float32 tensors and locations [N, 1, 1, 2] int32 tensors holding [x, y]
+MinMaxLocResult CreateMinMaxLocOutputs(int64_t numSamples)
+{
+    nvcv::TensorShape valShape({numSamples, 1, 1, 1}, nvcv::TENSOR_NHWC);
+    nvcv::TensorShape locShape({numSamples, 1, 1, 2}, nvcv::TENSOR_NHWC);
+
+    return {Tensor::Create(valShape, nvcv::TYPE_F32), Tensor::Create(locShape, nvcv::TYPE_S32),
+            Tensor::Create(valShape, nvcv::TYPE_F32), Tensor::Create(locShape, nvcv::TYPE_S32)};
+}
+
+MinMaxLocResult MinMaxLoc(Tensor &input, std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    auto [minVal, minLoc, maxVal, maxLoc] = CreateMinMaxLocOutputs(info->numSamples());
+
+    return MinMaxLocInto(minVal, minLoc, maxVal, maxLoc, input, pstream);
+}
+
+MinMaxLocResult MinMaxLocVarShapeInto(Tensor &minVal, Tensor &minLoc, Tensor &maxVal, Tensor &maxLoc,
+                                      ImageBatchVarShape &input, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto minMaxLoc = CreateOperator<cvcuda::MinMaxLoc>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {minVal, minLoc, maxVal, maxLoc});
+    guard.add(LockMode::LOCK_NONE, {*minMaxLoc});
+
+    minMaxLoc->submit(pstream->cudaHandle(), input, minVal, minLoc, maxVal, maxLoc);
+
+    return {minVal, minLoc, maxVal, maxLoc};
+}
+
+MinMaxLocResult MinMaxLocVarShape(ImageBatchVarShape &input, std::optional<Stream> pstream)
+{
+    auto [minVal, minLoc, maxVal, maxLoc] = CreateMinMaxLocOutputs(input.numImages());
+
+    return MinMaxLocVarShapeInto(minVal, minLoc, maxVal, maxLoc, input, pstream);
+}
+
+} // namespace
+
+void ExportOpMinMaxLoc(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("min_max_loc", &MinMaxLoc, "src"_a, py::kw_only(), "stream"_a = nullptr);
+    m.def("min_max_loc_into", &MinMaxLocInto, "min_val"_a, "min_loc"_a, "max_val"_a, "max_loc"_a, "src"_a,
+          py::kw_only(), "stream"_a = nullptr);
+    m.def("min_max_loc", &MinMaxLocVarShape, "src"_a, py::kw_only(), "stream"_a = nullptr);
+    m.def("min_max_loc_into", &MinMaxLocVarShapeInto, "min_val"_a, "min_loc"_a, "max_val"_a, "max_loc"_a, "src"_a,
+          py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpNMS.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+#include <tuple>
+
+namespace cvcudapy {
+
+namespace {
+
+using NMSResult = std::tuple<Tensor, Tensor, Tensor>;
+
+NMSResult NMSInto(Tensor &outIndices, Tensor &outScores, Tensor &outCount, Tensor &boxes, Tensor &scores,
+                  float scoreThreshold, float iouThreshold, float softSigma, std::optional<Tensor> classes,
+                  std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto info = nvcv::TensorShapeInfoImage::Create(boxes.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input boxes tensor must have an image layout");
+    }
+
+    // The workspace holds the live scores of each box, it's sized by the input
+    auto nms = CreateOperator<cvcuda::NMS>(info->numSamples(), info->numCols());
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {boxes, scores});
+    if (classes)
+    {
+        guard.add(LockMode::LOCK_READ, {*classes});
+    }
+    guard.add(LockMode::LOCK_WRITE, {outIndices, outScores, outCount});
+    guard.add(LockMode::LOCK_WRITE, {*nms});
+
+    if (classes)
+    {
+        nms->submit(pstream->cudaHandle(), boxes, scores, *classes, outIndices, outScores, outCount, scoreThreshold,
+                    iouThreshold, softSigma);
+    }
+    else
+    {
+        nms->submit(pstream->cudaHandle(), boxes, scores, outIndices, outScores, outCount, scoreThreshold,
+                    iouThreshold, softSigma);
+    }
+
+    return {outIndices, outScores, outCount};
+}
+
+// Indices are [N, 1, max_output, 1] int32 tensors, scores [N, 1, max_output, 1] float32 tensors and
+// counts [N, 1, 1, 1] int32 tensors
+NMSResult NMS(Tensor &boxes, Tensor &scores, int maxOutput, float scoreThreshold, float iouThreshold,
+              float softSigma, std::optional<Tensor> classes, std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(boxes.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input boxes tensor must have an image layout");
+    }
+
+    nvcv::TensorShape shape({info->numSamples(), 1, maxOutput, 1}, nvcv::TENSOR_NHWC);
+    nvcv::TensorShape countShape({info->numSamples(), 1, 1, 1}, nvcv::TENSOR_NHWC);
+
+    Tensor outIndices = Tensor::Create(shape, nvcv::TYPE_S32);
+    Tensor outScores  = Tensor::Create(shape, nvcv::TYPE_F32);
+    Tensor outCount   = Tensor::Create(countShape, nvcv::TYPE_S32);
+
+    return NMSInto(outIndices, outScores, outCount, boxes, scores, scoreThreshold, iouThreshold, softSigma, classes,
+                   pstream);
+}
+
+} // namespace
+
+void ExportOpNMS(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("nms", &NMS, "boxes"_a, "scores"_a, "max_output"_a, "score_threshold"_a, "iou_threshold"_a,
+          "soft_sigma"_a = 0.f, "classes"_a = nullptr, py::kw_only(), "stream"_a = nullptr);
+    m.def("nms_into", &NMSInto, "indices"_a, "out_scores"_a, "count"_a, "boxes"_a, "scores"_a, "score_threshold"_a,
+          "iou_threshold"_a, "soft_sigma"_a = 0.f, "classes"_a = nullptr, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
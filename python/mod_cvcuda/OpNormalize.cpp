@@ -32,14 +32,16 @@ namespace {
 
 enum OpFlags : uint32_t
 {
-    SCALE_IS_STDDEV = CVCUDA_NORMALIZE_SCALE_IS_STDDEV
+    SCALE_IS_STDDEV = CVCUDA_NORMALIZE_SCALE_IS_STDDEV,
+    COMPUTE_STATS   = CVCUDA_NORMALIZE_COMPUTE_STATS
 };
 
 } // namespace
 
 namespace {
 Tensor NormalizeInto(Tensor &output, Tensor &input, Tensor &base, Tensor &scale, std::optional<uint32_t> flags,
-                     float globalScale, float globalShift, float epsilon, std::optional<Stream> pstream)
+                     float globalScale, float globalShift, float epsilon, std::optional<std::vector<int>> channelOrder,
+                     std::optional<Stream> pstream)
 {
     if (!pstream)
     {
@@ -58,22 +60,25 @@ Tensor NormalizeInto(Tensor &output, Tensor &input, Tensor &base, Tensor &scale,
     guard.add(LockMode::LOCK_WRITE, {output});
     guard.add(LockMode::LOCK_NONE, {*normalize});
 
-    normalize->submit(pstream->cudaHandle(), input, base, scale, output, globalScale, globalShift, epsilon, *flags);
+    normalize->submit(pstream->cudaHandle(), input, base, scale, output, globalScale, globalShift, epsilon, *flags,
+                      ChannelOrderSwizzle(channelOrder));
 
     return std::move(output);
 }
 
 Tensor Normalize(Tensor &input, Tensor &base, Tensor &scale, std::optional<uint32_t> flags, float globalScale,
-                 float globalShift, float epsilon, std::optional<Stream> pstream)
+                 float globalShift, float epsilon, std::optional<std::vector<int>> channelOrder,
+                 std::optional<Stream> pstream)
 {
     Tensor output = Tensor::Create(input.shape(), input.dtype());
 
-    return NormalizeInto(output, input, base, scale, flags, globalScale, globalShift, epsilon, pstream);
+    return NormalizeInto(output, input, base, scale, flags, globalScale, globalShift, epsilon, channelOrder, pstream);
 }
 
 ImageBatchVarShape VarShapeNormalizeInto(ImageBatchVarShape &output, ImageBatchVarShape &input, Tensor &base,
                                          Tensor &scale, std::optional<uint32_t> flags, float globalScale,
-                                         float globalShift, float epsilon, std::optional<Stream> pstream)
+                                         float globalShift, float epsilon,
+                                         std::optional<std::vector<int>> channelOrder, std::optional<Stream> pstream)
 {
     if (!pstream)
     {
@@ -92,14 +97,15 @@ ImageBatchVarShape VarShapeNormalizeInto(ImageBatchVarShape &output, ImageBatchV
     guard.add(LockMode::LOCK_WRITE, {output});
     guard.add(LockMode::LOCK_NONE, {*normalize});
 
-    normalize->submit(pstream->cudaHandle(), input, base, scale, output, globalScale, globalShift, epsilon, *flags);
+    normalize->submit(pstream->cudaHandle(), input, base, scale, output, globalScale, globalShift, epsilon, *flags,
+                      ChannelOrderSwizzle(channelOrder));
 
     return output;
 }
 
 ImageBatchVarShape VarShapeNormalize(ImageBatchVarShape &input, Tensor &base, Tensor &scale,
                                      std::optional<uint32_t> flags, float globalScale, float globalShift, float epsilon,
-                                     std::optional<Stream> pstream)
+                                     std::optional<std::vector<int>> channelOrder, std::optional<Stream> pstream)
 {
     ImageBatchVarShape output = ImageBatchVarShape::Create(input.capacity());
 
@@ -108,7 +114,8 @@ ImageBatchVarShape VarShapeNormalize(ImageBatchVarShape &input, Tensor &base, Te
         output.pushBack(Image::Create(input[i].size(), input[i].format()));
     }
 
-    return VarShapeNormalizeInto(output, input, base, scale, flags, globalScale, globalShift, epsilon, pstream);
+    return VarShapeNormalizeInto(output, input, base, scale, flags, globalScale, globalShift, epsilon, channelOrder,
+                                 pstream);
 }
 
 } // namespace
@@ -117,7 +124,9 @@ void ExportOpNormalize(py::module &m)
 {
     using namespace pybind11::literals;
 
-    py::enum_<OpFlags>(m, "NormalizeFlags").value("SCALE_IS_STDDEV", OpFlags::SCALE_IS_STDDEV);
+    py::enum_<OpFlags>(m, "NormalizeFlags")
+        .value("SCALE_IS_STDDEV", OpFlags::SCALE_IS_STDDEV)
+        .value("COMPUTE_STATS", OpFlags::COMPUTE_STATS);
 
     float defGlobalScale = 1;
     float defGlobalShift = 0;
@@ -125,19 +134,19 @@ void ExportOpNormalize(py::module &m)
 
     m.def("normalize", &Normalize, "src"_a, "base"_a, "scale"_a, "flags"_a = std::nullopt, py::kw_only(),
           "globalscale"_a = defGlobalScale, "globalshift"_a = defGlobalShift, "epsilon"_a = defEpsilon,
-          "stream"_a = nullptr);
+          "channel_order"_a = std::nullopt, "stream"_a = nullptr);
 
     m.def("normalize_into", &NormalizeInto, "dst"_a, "src"_a, "base"_a, "scale"_a, "flags"_a = std::nullopt,
           py::kw_only(), "globalscale"_a = defGlobalScale, "globalshift"_a = defGlobalShift, "epsilon"_a = defEpsilon,
-          "stream"_a = nullptr);
+          "channel_order"_a = std::nullopt, "stream"_a = nullptr);
 
     m.def("normalize", &VarShapeNormalize, "src"_a, "base"_a, "scale"_a, "flags"_a = std::nullopt, py::kw_only(),
           "globalscale"_a = defGlobalScale, "globalshift"_a = defGlobalShift, "epsilon"_a = defEpsilon,
-          "stream"_a = nullptr);
+          "channel_order"_a = std::nullopt, "stream"_a = nullptr);
 
     m.def("normalize_into", &VarShapeNormalizeInto, "dst"_a, "src"_a, "base"_a, "scale"_a, "flags"_a = std::nullopt,
           py::kw_only(), "globalscale"_a = defGlobalScale, "globalshift"_a = defGlobalShift, "epsilon"_a = defEpsilon,
-          "stream"_a = nullptr);
+          "channel_order"_a = std::nullopt, "stream"_a = nullptr);
 }
 
 } // namespace cvcudapy
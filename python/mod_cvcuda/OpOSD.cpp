@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpOSD.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+// The frames are drawn over in place, so there's no variant allocating the output
+Tensor OSDInto(Tensor &inOut, Tensor &elements, std::optional<Tensor> numElements, std::optional<Tensor> points,
+               std::optional<Tensor> glyphs, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto info = nvcv::TensorShapeInfoImage::Create(elements.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Elements tensor must have an image layout");
+    }
+
+    // The workspace holds the bounds of the elements, it's sized by the elements tensor
+    auto osd = CreateOperator<cvcuda::OSD>(info->numSamples(), info->numCols());
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {elements});
+    for (const std::optional<Tensor> &input : {numElements, points, glyphs})
+    {
+        if (input)
+        {
+            guard.add(LockMode::LOCK_READ, {*input});
+        }
+    }
+    guard.add(LockMode::LOCK_WRITE, {inOut});
+    guard.add(LockMode::LOCK_WRITE, {*osd});
+
+    osd->submit(pstream->cudaHandle(), inOut, elements, numElements ? &*numElements : nullptr,
+                points ? &*points : nullptr, glyphs ? &*glyphs : nullptr);
+
+    return inOut;
+}
+
+} // namespace
+
+void ExportOpOSD(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("osd_into", &OSDInto, "src"_a, "elements"_a, "num_elements"_a = nullptr, "points"_a = nullptr,
+          "glyphs"_a = nullptr, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
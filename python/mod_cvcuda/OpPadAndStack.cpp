@@ -23,6 +23,7 @@
 #include <nvcv/python/ResourceGuard.hpp>
 #include <nvcv/python/Stream.hpp>
 #include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
 
 namespace cvcudapy {
 
@@ -61,6 +62,63 @@ Tensor PadAndStack(ImageBatchVarShape &input, Tensor &top, Tensor &left, NVCVBor
     return PadAndStackInto(output, input, top, left, border, borderValue, pstream);
 }
 
+Tensor PadAndStackNormalizeInto(Tensor &output, ImageBatchVarShape &input, Tensor &top, Tensor &left, Tensor &base,
+                                Tensor &scale, NVCVBorderType border, float borderValue, std::optional<uint32_t> flags,
+                                float globalScale, float globalShift, float epsilon, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    if (!flags)
+    {
+        flags = 0;
+    }
+
+    auto padstack = CreateOperator<cvcuda::PadAndStack>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, top, left, base, scale});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*padstack});
+
+    padstack->submit(pstream->cudaHandle(), input, output, top, left, border, borderValue, base, scale, globalScale,
+                     globalShift, epsilon, *flags);
+
+    return std::move(output);
+}
+
+Tensor PadAndStackNormalize(ImageBatchVarShape &input, Tensor &top, Tensor &left, Tensor &base, Tensor &scale,
+                            NVCVBorderType border, float borderValue, std::optional<uint32_t> flags, float globalScale,
+                            float globalShift, float epsilon, nvcv::DataType dtype, nvcv::TensorLayout layout,
+                            std::optional<Stream> pstream)
+{
+    nvcv::ImageFormat fmt = input.uniqueFormat();
+    if (fmt == nvcv::FMT_NONE)
+    {
+        throw std::runtime_error("All images in the input must have the same format");
+    }
+
+    if (layout != nvcv::TENSOR_NHWC && layout != nvcv::TENSOR_NCHW)
+    {
+        throw std::runtime_error("Output layout must be NHWC or NCHW");
+    }
+
+    nvcv::Size2D size = input.maxSize();
+
+    nvcv::TensorShape::ShapeType shape = layout == nvcv::TENSOR_NCHW
+                                           ? nvcv::TensorShape::ShapeType{input.numImages(), fmt.numChannels(),
+                                                                          size.h, size.w}
+                                           : nvcv::TensorShape::ShapeType{input.numImages(), size.h, size.w,
+                                                                          fmt.numChannels()};
+
+    Tensor output = Tensor::Create(nvcv::TensorShape(shape, layout), dtype);
+
+    return PadAndStackNormalizeInto(output, input, top, left, base, scale, border, borderValue, flags, globalScale,
+                                    globalShift, epsilon, pstream);
+}
+
 } // namespace
 
 void ExportOpPadAndStack(py::module &m)
@@ -71,6 +129,15 @@ void ExportOpPadAndStack(py::module &m)
           py::kw_only(), "stream"_a = nullptr);
     m.def("padandstack_into", &PadAndStackInto, "dst"_a, "src"_a, "top"_a, "left"_a, "border"_a = NVCV_BORDER_CONSTANT,
           "bvalue"_a = 0, py::kw_only(), "stream"_a = nullptr);
+
+    // Padded values are normalized, converted to dtype and written in the output layout in the same pass
+    m.def("padandstack_normalize", &PadAndStackNormalize, "src"_a, "top"_a, "left"_a, "base"_a, "scale"_a,
+          "border"_a = NVCV_BORDER_CONSTANT, "bvalue"_a = 0, "flags"_a = std::nullopt, py::kw_only(),
+          "globalscale"_a = 1.f, "globalshift"_a = 0.f, "epsilon"_a = 0.f, "dtype"_a = nvcv::TYPE_F32,
+          "layout"_a = nvcv::TENSOR_NCHW, "stream"_a = nullptr);
+    m.def("padandstack_normalize_into", &PadAndStackNormalizeInto, "dst"_a, "src"_a, "top"_a, "left"_a, "base"_a,
+          "scale"_a, "border"_a = NVCV_BORDER_CONSTANT, "bvalue"_a = 0, "flags"_a = std::nullopt, py::kw_only(),
+          "globalscale"_a = 1.f, "globalshift"_a = 0.f, "epsilon"_a = 0.f, "stream"_a = nullptr);
 }
 
 } // namespace cvcudapy
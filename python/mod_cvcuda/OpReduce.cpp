@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpReduce.hpp>
+#include <cvcuda/Types.h>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ImageBatchVarShape.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+// Returns the number of samples and channels of an input tensor
+std::pair<int64_t, int32_t> GetSamplesAndChannels(const Tensor &input)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+    return {info->numSamples(), info->numChannels()};
+}
+
+Tensor ReduceInto(Tensor &output, Tensor &input, NVCVReduceOp op, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto reduce = CreateOperator<cvcuda::Reduce>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*reduce});
+
+    reduce->submit(pstream->cudaHandle(), input, output, op);
+
+    return std::move(output);
+}
+
+Tensor Reduce(Tensor &input, NVCVReduceOp op, bool perChannel, std::optional<Stream> pstream)
+{
+    auto [numSamples, numChannels] = GetSamplesAndChannels(input);
+
+    // One value per sample, and per channel unless all channels are reduced together
+    nvcv::TensorShape::ShapeType shape{numSamples, 1, 1, perChannel ? numChannels : 1};
+
+    Tensor output = Tensor::Create(nvcv::TensorShape(shape, nvcv::TENSOR_NHWC), nvcv::TYPE_F32);
+
+    return ReduceInto(output, input, op, pstream);
+}
+
+Tensor ReduceVarShapeInto(Tensor &output, ImageBatchVarShape &input, NVCVReduceOp op, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto reduce = CreateOperator<cvcuda::Reduce>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*reduce});
+
+    reduce->submit(pstream->cudaHandle(), input, output, op);
+
+    return std::move(output);
+}
+
+Tensor ReduceVarShape(ImageBatchVarShape &input, NVCVReduceOp op, bool perChannel, std::optional<Stream> pstream)
+{
+    nvcv::TensorShape::ShapeType shape{input.numImages(), 1, 1,
+                                       perChannel ? input.uniqueFormat().numChannels() : 1};
+
+    Tensor output = Tensor::Create(nvcv::TensorShape(shape, nvcv::TENSOR_NHWC), nvcv::TYPE_F32);
+
+    return ReduceVarShapeInto(output, input, op, pstream);
+}
+
+} // namespace
+
+void ExportOpReduce(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("reduce", &Reduce, "src"_a, "op"_a, py::kw_only(), "per_channel"_a = true, "stream"_a = nullptr);
+    m.def("reduce_into", &ReduceInto, "dst"_a, "src"_a, "op"_a, py::kw_only(), "stream"_a = nullptr);
+    m.def("reduce", &ReduceVarShape, "src"_a, "op"_a, py::kw_only(), "per_channel"_a = true, "stream"_a = nullptr);
+    m.def("reduce_into", &ReduceVarShapeInto, "dst"_a, "src"_a, "op"_a, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -22,11 +22,13 @@
 #include <nvcv/python/ResourceGuard.hpp>
 #include <nvcv/python/Stream.hpp>
 #include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
 
 namespace cvcudapy {
 
 namespace {
-Tensor ReformatInto(Tensor &output, Tensor &input, std::optional<Stream> pstream)
+Tensor ReformatInto(Tensor &output, Tensor &input, std::optional<std::vector<int>> channelOrder,
+                    std::optional<Stream> pstream)
 {
     if (!pstream)
     {
@@ -40,18 +42,19 @@ Tensor ReformatInto(Tensor &output, Tensor &input, std::optional<Stream> pstream
     guard.add(LockMode::LOCK_WRITE, {output});
     guard.add(LockMode::LOCK_NONE, {*reformat});
 
-    reformat->submit(pstream->cudaHandle(), input, output);
+    reformat->submit(pstream->cudaHandle(), input, output, ChannelOrderSwizzle(channelOrder));
 
     return std::move(output);
 }
 
-Tensor Reformat(Tensor &input, const nvcv::TensorLayout &out_layout, std::optional<Stream> pstream)
+Tensor Reformat(Tensor &input, const nvcv::TensorLayout &out_layout, std::optional<std::vector<int>> channelOrder,
+                std::optional<Stream> pstream)
 {
     nvcv::TensorShape out_shape = Permute(input.shape(), out_layout);
 
     Tensor output = Tensor::Create(out_shape, input.dtype());
 
-    return ReformatInto(output, input, pstream);
+    return ReformatInto(output, input, channelOrder, pstream);
 }
 
 } // namespace
@@ -60,8 +63,10 @@ void ExportOpReformat(py::module &m)
 {
     using namespace pybind11::literals;
 
-    m.def("reformat", &Reformat, "src"_a, "layout"_a, py::kw_only(), "stream"_a = nullptr);
-    m.def("reformat_into", &ReformatInto, "dst"_a, "src"_a, py::kw_only(), "stream"_a = nullptr);
+    m.def("reformat", &Reformat, "src"_a, "layout"_a, py::kw_only(), "channel_order"_a = std::nullopt,
+          "stream"_a = nullptr);
+    m.def("reformat_into", &ReformatInto, "dst"_a, "src"_a, py::kw_only(), "channel_order"_a = std::nullopt,
+          "stream"_a = nullptr);
 }
 
 } // namespace cvcudapy
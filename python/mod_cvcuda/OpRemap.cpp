@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpRemap.hpp>
+#include <cvcuda/Types.h>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/cuda/TypeTraits.hpp>
+#include <nvcv/python/ImageBatchVarShape.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+using pyarray = py::array_t<float, py::array::c_style | py::array::forcecast>;
+
+float4 GetBorderValue(const pyarray &borderValue)
+{
+    size_t bValueSize = borderValue.size();
+    size_t bValueDims = borderValue.ndim();
+    if (bValueSize > 4 || bValueDims != 1)
+    {
+        throw std::runtime_error(util::FormatString(
+            "Channels of borderValue should <= 4 and dimension should be 2, current is '%lu', '%lu' respectively",
+            bValueSize, bValueDims));
+    }
+    float4 bValue;
+    for (size_t i = 0; i < 4; i++)
+    {
+        nvcv::cuda::GetElement(bValue, i) = bValueSize > i ? *borderValue.data(i) : 0.f;
+    }
+    return bValue;
+}
+
+Tensor RemapInto(Tensor &output, Tensor &input, Tensor &map, NVCVInterpolationType interp,
+                 NVCVRemapMapValueType mapValueType, NVCVBorderType borderMode, const pyarray &borderValue,
+                 std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    float4 bValue = GetBorderValue(borderValue);
+
+    auto op = CreateOperator<cvcuda::Remap>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, map});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*op});
+
+    op->submit(pstream->cudaHandle(), input, output, map, interp, mapValueType, borderMode, bValue);
+
+    return std::move(output);
+}
+
+Tensor Remap(Tensor &input, Tensor &map, NVCVInterpolationType interp, NVCVRemapMapValueType mapValueType,
+             NVCVBorderType borderMode, const pyarray &borderValue, std::optional<Stream> pstream)
+{
+    auto mapInfo = nvcv::TensorShapeInfoImage::Create(map.shape());
+    if (!mapInfo)
+    {
+        throw std::runtime_error("Map tensor must have an image layout");
+    }
+
+    // Output has the size of the map
+    nvcv::TensorShape::ShapeType shape = input.shape().shape();
+    if (shape.rank() < 3)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+    shape[shape.rank() - 3] = mapInfo->numRows();
+    shape[shape.rank() - 2] = mapInfo->numCols();
+
+    Tensor output = Tensor::Create(nvcv::TensorShape(shape, input.shape().layout()), input.dtype());
+
+    return RemapInto(output, input, map, interp, mapValueType, borderMode, borderValue, pstream);
+}
+
+ImageBatchVarShape RemapVarShapeInto(ImageBatchVarShape &output, ImageBatchVarShape &input, Tensor &map,
+                                     NVCVInterpolationType interp, NVCVRemapMapValueType mapValueType,
+                                     NVCVBorderType borderMode, const pyarray &borderValue,
+                                     std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    float4 bValue = GetBorderValue(borderValue);
+
+    auto op = CreateOperator<cvcuda::Remap>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, map});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*op});
+
+    op->submit(pstream->cudaHandle(), input, output, map, interp, mapValueType, borderMode, bValue);
+
+    return output;
+}
+
+ImageBatchVarShape RemapVarShape(ImageBatchVarShape &input, Tensor &map, NVCVInterpolationType interp,
+                                 NVCVRemapMapValueType mapValueType, NVCVBorderType borderMode,
+                                 const pyarray &borderValue, std::optional<Stream> pstream)
+{
+    ImageBatchVarShape output = ImageBatchVarShape::Create(input.capacity());
+
+    // Each output image has the size of its input image
+    for (int i = 0; i < input.numImages(); ++i)
+    {
+        nvcv::ImageFormat format = input[i].format();
+        nvcv::Size2D      size   = input[i].size();
+        auto              image  = Image::Create(size, format);
+        output.pushBack(image);
+    }
+
+    return RemapVarShapeInto(output, input, map, interp, mapValueType, borderMode, borderValue, pstream);
+}
+
+} // namespace
+
+void ExportOpRemap(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("remap", &Remap, "src"_a, "map"_a, "interp"_a = NVCV_INTERP_LINEAR, py::kw_only(),
+          "map_value_type"_a = NVCV_REMAP_ABSOLUTE, "border_mode"_a = NVCVBorderType::NVCV_BORDER_CONSTANT,
+          "border_value"_a = 0, "stream"_a = nullptr);
+
+    m.def("remap_into", &RemapInto, "dst"_a, "src"_a, "map"_a, "interp"_a = NVCV_INTERP_LINEAR, py::kw_only(),
+          "map_value_type"_a = NVCV_REMAP_ABSOLUTE, "border_mode"_a = NVCVBorderType::NVCV_BORDER_CONSTANT,
+          "border_value"_a = 0, "stream"_a = nullptr);
+
+    m.def("remap", &RemapVarShape, "src"_a, "map"_a, "interp"_a = NVCV_INTERP_LINEAR, py::kw_only(),
+          "map_value_type"_a = NVCV_REMAP_ABSOLUTE, "border_mode"_a = NVCVBorderType::NVCV_BORDER_CONSTANT,
+          "border_value"_a = 0, "stream"_a = nullptr);
+
+    m.def("remap_into", &RemapVarShapeInto, "dst"_a, "src"_a, "map"_a, "interp"_a = NVCV_INTERP_LINEAR,
+          py::kw_only(), "map_value_type"_a = NVCV_REMAP_ABSOLUTE,
+          "border_mode"_a = NVCVBorderType::NVCV_BORDER_CONSTANT, "border_value"_a = 0, "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -29,7 +29,8 @@
 namespace cvcudapy {
 
 namespace {
-Tensor ResizeInto(Tensor &output, Tensor &input, NVCVInterpolationType interp, std::optional<Stream> pstream)
+Tensor ResizeInto(Tensor &output, Tensor &input, NVCVInterpolationType interp,
+                  std::optional<std::vector<int>> channelOrder, std::optional<Stream> pstream)
 {
     if (!pstream)
     {
@@ -43,16 +44,17 @@ Tensor ResizeInto(Tensor &output, Tensor &input, NVCVInterpolationType interp, s
     guard.add(LockMode::LOCK_WRITE, {output});
     guard.add(LockMode::LOCK_NONE, {*resize});
 
-    resize->submit(pstream->cudaHandle(), input, output, interp);
+    resize->submit(pstream->cudaHandle(), input, output, interp, ChannelOrderSwizzle(channelOrder));
 
     return std::move(output);
 }
 
-Tensor Resize(Tensor &input, const Shape &out_shape, NVCVInterpolationType interp, std::optional<Stream> pstream)
+Tensor Resize(Tensor &input, const Shape &out_shape, NVCVInterpolationType interp,
+              std::optional<std::vector<int>> channelOrder, std::optional<Stream> pstream)
 {
     Tensor output = Tensor::Create(out_shape, input.dtype(), input.shape().layout());
 
-    return ResizeInto(output, input, interp, pstream);
+    return ResizeInto(output, input, interp, channelOrder, pstream);
 }
 
 ImageBatchVarShape ResizeVarShapeInto(ImageBatchVarShape &output, ImageBatchVarShape &input,
@@ -75,8 +77,27 @@ ImageBatchVarShape ResizeVarShapeInto(ImageBatchVarShape &output, ImageBatchVarS
     return output;
 }
 
-ImageBatchVarShape ResizeVarShape(ImageBatchVarShape &input, const std::vector<std::tuple<int, int>> &out_size,
-                                  NVCVInterpolationType interp, std::optional<Stream> pstream)
+ImageBatchVarShape ResizeVarShapePerSampleInto(ImageBatchVarShape &output, ImageBatchVarShape &input, Tensor &interp,
+                                               bool antialias, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto resize = CreateOperator<cvcuda::Resize>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, interp});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*resize});
+
+    resize->submit(pstream->cudaHandle(), input, output, interp, antialias);
+
+    return output;
+}
+
+ImageBatchVarShape CreateResizedBatch(ImageBatchVarShape &input, const std::vector<std::tuple<int, int>> &out_size)
 {
     if (input.numImages() != (int)out_size.size())
     {
@@ -93,23 +114,46 @@ ImageBatchVarShape ResizeVarShape(ImageBatchVarShape &input, const std::vector<s
         output.pushBack(image);
     }
 
+    return output;
+}
+
+ImageBatchVarShape ResizeVarShape(ImageBatchVarShape &input, const std::vector<std::tuple<int, int>> &out_size,
+                                  NVCVInterpolationType interp, std::optional<Stream> pstream)
+{
+    ImageBatchVarShape output = CreateResizedBatch(input, out_size);
+
     return ResizeVarShapeInto(output, input, interp, pstream);
 }
 
+ImageBatchVarShape ResizeVarShapePerSample(ImageBatchVarShape &input, const std::vector<std::tuple<int, int>> &out_size,
+                                           Tensor &interp, bool antialias, std::optional<Stream> pstream)
+{
+    ImageBatchVarShape output = CreateResizedBatch(input, out_size);
+
+    return ResizeVarShapePerSampleInto(output, input, interp, antialias, pstream);
+}
+
 } // namespace
 
 void ExportOpResize(py::module &m)
 {
     using namespace pybind11::literals;
 
-    m.def("resize", &Resize, "src"_a, "shape"_a, "interp"_a = NVCV_INTERP_LINEAR, py::kw_only(), "stream"_a = nullptr);
+    m.def("resize", &Resize, "src"_a, "shape"_a, "interp"_a = NVCV_INTERP_LINEAR, py::kw_only(),
+          "channel_order"_a = std::nullopt, "stream"_a = nullptr);
     m.def("resize_into", &ResizeInto, "dst"_a, "src"_a, "interp"_a = NVCV_INTERP_LINEAR, py::kw_only(),
-          "stream"_a = nullptr);
+          "channel_order"_a = std::nullopt, "stream"_a = nullptr);
 
     m.def("resize", &ResizeVarShape, "src"_a, "sizes"_a, "interp"_a = NVCV_INTERP_LINEAR, py::kw_only(),
           "stream"_a = nullptr);
     m.def("resize_into", &ResizeVarShapeInto, "dst"_a, "src"_a, "interp"_a = NVCV_INTERP_LINEAR, py::kw_only(),
           "stream"_a = nullptr);
+
+    // interp is a tensor with the interpolation of each sample
+    m.def("resize", &ResizeVarShapePerSample, "src"_a, "sizes"_a, "interp"_a, py::kw_only(), "antialias"_a = false,
+          "stream"_a = nullptr);
+    m.def("resize_into", &ResizeVarShapePerSampleInto, "dst"_a, "src"_a, "interp"_a, py::kw_only(),
+          "antialias"_a = false, "stream"_a = nullptr);
 }
 
 } // namespace cvcudapy
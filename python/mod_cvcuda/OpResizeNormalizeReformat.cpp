@@ -0,0 +1,222 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <cvcuda/OpResizeNormalizeReformat.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/Image.hpp>
+#include <nvcv/python/ImageBatchVarShape.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+
+enum OpFlags : uint32_t
+{
+    SCALE_IS_STDDEV = CVCUDA_NORMALIZE_SCALE_IS_STDDEV,
+    SWAP_RB         = CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB
+};
+
+} // namespace
+
+namespace {
+Tensor ResizeNormalizeReformatInto(Tensor &output, Tensor &input, Tensor &base, Tensor &scale,
+                                   NVCVInterpolationType interp, std::optional<uint32_t> flags, float globalScale,
+                                   float globalShift, float epsilon, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    if (!flags)
+    {
+        flags = 0;
+    }
+
+    auto op = CreateOperator<cvcuda::ResizeNormalizeReformat>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, base, scale});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*op});
+
+    op->submit(pstream->cudaHandle(), input, base, scale, output, interp, globalScale, globalShift, epsilon, *flags);
+
+    return std::move(output);
+}
+
+Tensor ResizeNormalizeReformat(Tensor &input, const std::tuple<int, int> &size, Tensor &base, Tensor &scale,
+                               NVCVInterpolationType interp, std::optional<uint32_t> flags, float globalScale,
+                               float globalShift, float epsilon, nvcv::DataType dtype, std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    nvcv::TensorShape::ShapeType shape{info->numSamples(), info->numChannels(), std::get<1>(size),
+                                       std::get<0>(size)};
+
+    Tensor output = Tensor::Create(nvcv::TensorShape(shape, nvcv::TENSOR_NCHW), dtype);
+
+    return ResizeNormalizeReformatInto(output, input, base, scale, interp, flags, globalScale, globalShift, epsilon,
+                                       pstream);
+}
+
+Tensor VarShapeResizeNormalizeReformatInto(Tensor &output, ImageBatchVarShape &input, Tensor &base, Tensor &scale,
+                                           NVCVInterpolationType interp, std::optional<uint32_t> flags,
+                                           float globalScale, float globalShift, float epsilon,
+                                           std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    if (!flags)
+    {
+        flags = 0;
+    }
+
+    auto op = CreateOperator<cvcuda::ResizeNormalizeReformat>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, base, scale});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*op});
+
+    op->submit(pstream->cudaHandle(), input, base, scale, output, interp, globalScale, globalShift, epsilon, *flags);
+
+    return std::move(output);
+}
+
+Tensor VarShapeResizeNormalizeReformat(ImageBatchVarShape &input, const std::tuple<int, int> &size, Tensor &base,
+                                       Tensor &scale, NVCVInterpolationType interp, std::optional<uint32_t> flags,
+                                       float globalScale, float globalShift, float epsilon, nvcv::DataType dtype,
+                                       std::optional<Stream> pstream)
+{
+    nvcv::TensorShape::ShapeType shape{input.numImages(), input.uniqueFormat().numChannels(), std::get<1>(size),
+                                       std::get<0>(size)};
+
+    Tensor output = Tensor::Create(nvcv::TensorShape(shape, nvcv::TENSOR_NCHW), dtype);
+
+    return VarShapeResizeNormalizeReformatInto(output, input, base, scale, interp, flags, globalScale, globalShift,
+                                               epsilon, pstream);
+}
+
+Tensor NV12ResizeNormalizeReformatInto(Tensor &output, Tensor &luma, Tensor &chroma, Tensor &base, Tensor &scale,
+                                       NVCVColorConversionCode code, NVCVInterpolationType interp,
+                                       std::optional<uint32_t> flags, std::optional<NVCVRectI> roi, float globalScale,
+                                       float globalShift, float epsilon, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    if (!flags)
+    {
+        flags = 0;
+    }
+
+    auto op = CreateOperator<cvcuda::ResizeNormalizeReformat>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {luma, chroma, base, scale});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*op});
+
+    op->submit(pstream->cudaHandle(), luma, chroma, roi ? &*roi : nullptr, base, scale, output, code, interp,
+               globalScale, globalShift, epsilon, *flags);
+
+    return std::move(output);
+}
+
+Tensor NV12ResizeNormalizeReformat(Tensor &luma, Tensor &chroma, const std::tuple<int, int> &size, Tensor &base,
+                                   Tensor &scale, NVCVColorConversionCode code, NVCVInterpolationType interp,
+                                   std::optional<uint32_t> flags, std::optional<NVCVRectI> roi, float globalScale,
+                                   float globalShift, float epsilon, nvcv::DataType dtype,
+                                   std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(luma.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Luma tensor must have an image layout");
+    }
+
+    nvcv::TensorShape::ShapeType shape{info->numSamples(), 3, std::get<1>(size), std::get<0>(size)};
+
+    Tensor output = Tensor::Create(nvcv::TensorShape(shape, nvcv::TENSOR_NCHW), dtype);
+
+    return NV12ResizeNormalizeReformatInto(output, luma, chroma, base, scale, code, interp, flags, roi, globalScale,
+                                           globalShift, epsilon, pstream);
+}
+
+} // namespace
+
+void ExportOpResizeNormalizeReformat(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    py::enum_<OpFlags>(m, "ResizeNormalizeReformatFlags", py::arithmetic())
+        .value("SCALE_IS_STDDEV", OpFlags::SCALE_IS_STDDEV)
+        .value("SWAP_RB", OpFlags::SWAP_RB);
+
+    float defGlobalScale = 1;
+    float defGlobalShift = 0;
+    float defEpsilon     = 0;
+
+    // Outputs are float, or 8-bit quantized with the normalization parameters
+    nvcv::DataType defDType = nvcv::TYPE_F32;
+
+    m.def("resize_normalize_reformat", &ResizeNormalizeReformat, "src"_a, "size"_a, "base"_a, "scale"_a,
+          "interp"_a = NVCV_INTERP_LINEAR, "flags"_a = std::nullopt, py::kw_only(), "globalscale"_a = defGlobalScale,
+          "globalshift"_a = defGlobalShift, "epsilon"_a = defEpsilon, "dtype"_a = defDType, "stream"_a = nullptr);
+
+    m.def("resize_normalize_reformat_into", &ResizeNormalizeReformatInto, "dst"_a, "src"_a, "base"_a, "scale"_a,
+          "interp"_a = NVCV_INTERP_LINEAR, "flags"_a = std::nullopt, py::kw_only(), "globalscale"_a = defGlobalScale,
+          "globalshift"_a = defGlobalShift, "epsilon"_a = defEpsilon, "stream"_a = nullptr);
+
+    m.def("resize_normalize_reformat", &VarShapeResizeNormalizeReformat, "src"_a, "size"_a, "base"_a, "scale"_a,
+          "interp"_a = NVCV_INTERP_LINEAR, "flags"_a = std::nullopt, py::kw_only(), "globalscale"_a = defGlobalScale,
+          "globalshift"_a = defGlobalShift, "epsilon"_a = defEpsilon, "dtype"_a = defDType, "stream"_a = nullptr);
+
+    m.def("resize_normalize_reformat_into", &VarShapeResizeNormalizeReformatInto, "dst"_a, "src"_a, "base"_a,
+          "scale"_a, "interp"_a = NVCV_INTERP_LINEAR, "flags"_a = std::nullopt, py::kw_only(),
+          "globalscale"_a = defGlobalScale, "globalshift"_a = defGlobalShift, "epsilon"_a = defEpsilon,
+          "stream"_a = nullptr);
+
+    m.def("resize_normalize_reformat_nv12", &NV12ResizeNormalizeReformat, "luma"_a, "chroma"_a, "size"_a, "base"_a,
+          "scale"_a, "code"_a = NVCV_COLOR_YUV2RGB_NV12, "interp"_a = NVCV_INTERP_LINEAR, "flags"_a = std::nullopt,
+          py::kw_only(), "roi"_a = std::nullopt, "globalscale"_a = defGlobalScale, "globalshift"_a = defGlobalShift,
+          "epsilon"_a = defEpsilon, "dtype"_a = defDType, "stream"_a = nullptr);
+
+    m.def("resize_normalize_reformat_nv12_into", &NV12ResizeNormalizeReformatInto, "dst"_a, "luma"_a, "chroma"_a,
+          "base"_a, "scale"_a, "code"_a = NVCV_COLOR_YUV2RGB_NV12, "interp"_a = NVCV_INTERP_LINEAR,
+          "flags"_a = std::nullopt, py::kw_only(), "roi"_a = std::nullopt, "globalscale"_a = defGlobalScale,
+          "globalshift"_a = defGlobalShift, "epsilon"_a = defEpsilon, "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <cvcuda/OpSSIM.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+namespace cvcudapy {
+
+namespace {
+Tensor SSIMInto(Tensor &output, Tensor &input, Tensor &ref, float maxValue, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto op = CreateOperator<cvcuda::SSIM>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, ref});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*op});
+
+    op->submit(pstream->cudaHandle(), input, ref, output, maxValue);
+
+    return std::move(output);
+}
+
+Tensor SSIM(Tensor &input, Tensor &ref, float maxValue, bool perChannel, std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    // One score per sample, and per channel unless all channels are scored together
+    nvcv::TensorShape::ShapeType shape{info->numSamples(), 1, 1, perChannel ? info->numChannels() : 1};
+
+    Tensor output = Tensor::Create(nvcv::TensorShape(shape, nvcv::TENSOR_NHWC), nvcv::TYPE_F32);
+
+    return SSIMInto(output, input, ref, maxValue, pstream);
+}
+
+} // namespace
+
+void ExportOpSSIM(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("ssim", &SSIM, "src"_a, "ref"_a, "max_value"_a = 0.f, py::kw_only(), "per_channel"_a = false,
+          "stream"_a = nullptr);
+    m.def("ssim_into", &SSIMInto, "dst"_a, "src"_a, "ref"_a, "max_value"_a = 0.f, py::kw_only(),
+          "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpSobel.hpp>
+#include <cvcuda/Types.h>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+#include <tuple>
+
+namespace cvcudapy {
+
+namespace {
+
+using SobelResult = std::tuple<Tensor, Tensor, Tensor>;
+
+void SobelInto(std::optional<Tensor> dx, std::optional<Tensor> dy, std::optional<Tensor> magnitude, Tensor &input,
+               int ksize, float scale, NVCVBorderType border, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto sobel = CreateOperator<cvcuda::Sobel>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_NONE, {*sobel});
+    for (const std::optional<Tensor> &output : {dx, dy, magnitude})
+    {
+        if (output)
+        {
+            guard.add(LockMode::LOCK_WRITE, {*output});
+        }
+    }
+
+    sobel->submit(pstream->cudaHandle(), input, dx ? &*dx : nullptr, dy ? &*dy : nullptr,
+                  magnitude ? &*magnitude : nullptr, ksize, scale, border);
+}
+
+// The derivatives and the magnitude are float32 tensors with the shape of the input
+SobelResult Sobel(Tensor &input, int ksize, float scale, NVCVBorderType border, std::optional<Stream> pstream)
+{
+    Tensor dx        = Tensor::Create(input.shape(), nvcv::TYPE_F32);
+    Tensor dy        = Tensor::Create(input.shape(), nvcv::TYPE_F32);
+    Tensor magnitude = Tensor::Create(input.shape(), nvcv::TYPE_F32);
+
+    SobelInto(dx, dy, magnitude, input, ksize, scale, border, pstream);
+
+    return {dx, dy, magnitude};
+}
+
+} // namespace
+
+void ExportOpSobel(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("sobel", &Sobel, "src"_a, "ksize"_a = 3, "scale"_a = 1.f,
+          "border"_a = NVCVBorderType::NVCV_BORDER_REFLECT101, py::kw_only(), "stream"_a = nullptr);
+    m.def("sobel_into", &SobelInto, "dx"_a, "dy"_a, "magnitude"_a, "src"_a, "ksize"_a = 3, "scale"_a = 1.f,
+          "border"_a = NVCVBorderType::NVCV_BORDER_REFLECT101, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
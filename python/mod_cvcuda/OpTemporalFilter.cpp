@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpTemporalFilter.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+#include <tuple>
+
+namespace cvcudapy {
+
+namespace {
+
+using TemporalFilterResult = std::tuple<Tensor, Tensor>;
+
+void TemporalFilterInto(std::optional<Tensor> output, std::optional<Tensor> mask, Tensor &input, Tensor &state,
+                        NVCVTemporalFilterType type, float alpha, float threshold, bool reset,
+                        std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto filter = CreateOperator<cvcuda::TemporalFilter>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_READWRITE, {state});
+    guard.add(LockMode::LOCK_NONE, {*filter});
+    if (output)
+    {
+        guard.add(LockMode::LOCK_WRITE, {*output});
+    }
+    if (mask)
+    {
+        guard.add(LockMode::LOCK_WRITE, {*mask});
+    }
+
+    filter->submit(pstream->cudaHandle(), input, state, output ? &*output : nullptr, mask ? &*mask : nullptr, type,
+                   alpha, threshold, reset);
+}
+
+// The mask has the samples, height and width of the input with a single uint8 channel
+TemporalFilterResult TemporalFilter(Tensor &input, Tensor &state, NVCVTemporalFilterType type, float alpha,
+                                    float threshold, bool reset, std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    nvcv::TensorShape::ShapeType maskShape{info->numSamples(), info->numRows(), info->numCols(), 1};
+
+    Tensor output = Tensor::Create(input.shape(), input.dtype());
+    Tensor mask   = Tensor::Create(nvcv::TensorShape(maskShape, nvcv::TENSOR_NHWC), nvcv::TYPE_U8);
+
+    TemporalFilterInto(output, mask, input, state, type, alpha, threshold, reset, pstream);
+
+    return {output, mask};
+}
+
+} // namespace
+
+void ExportOpTemporalFilter(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("temporal_filter", &TemporalFilter, "src"_a, "state"_a, "type"_a, "alpha"_a, "threshold"_a,
+          "reset"_a = false, py::kw_only(), "stream"_a = nullptr);
+    m.def("temporal_filter_into", &TemporalFilterInto, "dst"_a, "mask"_a, "src"_a, "state"_a, "type"_a, "alpha"_a,
+          "threshold"_a, "reset"_a = false, py::kw_only(), "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Operators.hpp"
+
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <cvcuda/OpTopK.hpp>
+#include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/python/ResourceGuard.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <nvcv/python/Tensor.hpp>
+#include <pybind11/stl.h>
+
+#include <tuple>
+
+namespace cvcudapy {
+
+namespace {
+
+using TopKResult = std::tuple<Tensor, Tensor>;
+
+TopKResult TopKInto(Tensor &scores, Tensor &indices, Tensor &input, bool softmax, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto topk = CreateOperator<cvcuda::TopK>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input});
+    guard.add(LockMode::LOCK_WRITE, {scores, indices});
+    guard.add(LockMode::LOCK_NONE, {*topk});
+
+    topk->submit(pstream->cudaHandle(), input, scores, indices, softmax);
+
+    return {scores, indices};
+}
+
+// Scores are [N, 1, k, 1] float32 tensors and indices [N, 1, k, 1] int32 tensors
+TopKResult TopK(Tensor &input, int k, bool softmax, std::optional<Stream> pstream)
+{
+    auto info = nvcv::TensorShapeInfoImage::Create(input.shape());
+    if (!info)
+    {
+        throw std::runtime_error("Input tensor must have an image layout");
+    }
+
+    nvcv::TensorShape shape({info->numSamples(), 1, k, 1}, nvcv::TENSOR_NHWC);
+
+    Tensor scores  = Tensor::Create(shape, nvcv::TYPE_F32);
+    Tensor indices = Tensor::Create(shape, nvcv::TYPE_S32);
+
+    return TopKInto(scores, indices, input, softmax, pstream);
+}
+
+} // namespace
+
+void ExportOpTopK(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    m.def("topk", &TopK, "src"_a, "k"_a, "softmax"_a = false, py::kw_only(), "stream"_a = nullptr);
+    m.def("topk_into", &TopKInto, "scores"_a, "indices"_a, "src"_a, "softmax"_a = false, py::kw_only(),
+          "stream"_a = nullptr);
+}
+
+} // namespace cvcudapy
@@ -28,6 +28,9 @@
 #include <nvcv/python/Tensor.hpp>
 #include <pybind11/stl.h>
 
+#include <tuple>
+#include <vector>
+
 namespace cvcudapy {
 
 namespace {
@@ -146,6 +149,65 @@ ImageBatchVarShape WarpPerspectiveVarShape(ImageBatchVarShape &input, Tensor &xf
     return WarpPerspectiveVarShapeInto(output, input, xform, flags, borderMode, borderValue, pstream);
 }
 
+ImageBatchVarShape WarpPerspectiveCropInto(ImageBatchVarShape &output, ImageBatchVarShape &input, Tensor &quads,
+                                           const int32_t flags, const NVCVBorderType borderMode,
+                                           const pyarray &borderValue, std::optional<Stream> pstream)
+{
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    size_t bValueSize = borderValue.size();
+    size_t bValueDims = borderValue.ndim();
+    if (bValueSize > 4 || bValueDims != 1)
+    {
+        throw std::runtime_error(util::FormatString(
+            "Channels of borderValue should <= 4 and dimension should be 2, current is '%lu', '%lu' respectively",
+            bValueSize, bValueDims));
+    }
+    float4 bValue;
+    for (size_t i = 0; i < 4; i++)
+    {
+        nvcv::cuda::GetElement(bValue, i) = bValueSize > i ? *borderValue.data(i) : 0.f;
+    }
+
+    auto warpPerspective = CreateOperator<cvcuda::WarpPerspective>(0);
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, {input, quads});
+    guard.add(LockMode::LOCK_WRITE, {output});
+    guard.add(LockMode::LOCK_NONE, {*warpPerspective});
+
+    warpPerspective->submitWith([&](cvcuda::WarpPerspective &op)
+                                { op.crop(pstream->cudaHandle(), input, quads, output, flags, borderMode, bValue); });
+
+    return output;
+}
+
+ImageBatchVarShape WarpPerspectiveCrop(ImageBatchVarShape &input, Tensor &quads,
+                                       const std::vector<std::tuple<int, int>> &sizes, const int32_t flags,
+                                       const NVCVBorderType borderMode, const pyarray &borderValue,
+                                       std::optional<Stream> pstream)
+{
+    if (input.numImages() == 0)
+    {
+        throw std::runtime_error("Input batch must not be empty");
+    }
+
+    ImageBatchVarShape output = ImageBatchVarShape::Create(sizes.size());
+
+    // Regions are output with the input format, each with its own size
+    nvcv::ImageFormat format = input[0].format();
+    for (const auto &[width, height] : sizes)
+    {
+        auto image = Image::Create({width, height}, format);
+        output.pushBack(image);
+    }
+
+    return WarpPerspectiveCropInto(output, input, quads, flags, borderMode, borderValue, pstream);
+}
+
 } // namespace
 
 void ExportOpWarpPerspective(py::module &m)
@@ -163,6 +225,12 @@ void ExportOpWarpPerspective(py::module &m)
 
     m.def("warp_perspective_into", &WarpPerspectiveVarShapeInto, "dst"_a, "src"_a, "xform"_a, "flags"_a, py::kw_only(),
           "border_mode"_a, "border_value"_a, "stream"_a = nullptr);
+
+    m.def("warp_perspective_crop", &WarpPerspectiveCrop, "src"_a, "quads"_a, "sizes"_a, "flags"_a, py::kw_only(),
+          "border_mode"_a, "border_value"_a, "stream"_a = nullptr);
+
+    m.def("warp_perspective_crop_into", &WarpPerspectiveCropInto, "dst"_a, "src"_a, "quads"_a, "flags"_a,
+          py::kw_only(), "border_mode"_a, "border_value"_a, "stream"_a = nullptr);
 }
 
 } // namespace cvcudapy
@@ -0,0 +1,182 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OperatorStats.hpp"
+
+#include <common/PyUtil.hpp>
+#include <cvcuda/Operator.h>
+#include <nvcv/detail/CheckError.hpp>
+#include <pybind11/stl.h>
+
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace cvcudapy {
+
+namespace util = nvcvpy::util;
+
+namespace {
+
+// Upper bound of each histogram bin in milliseconds, bin 0 holds times below 1 us, bin i times in [2^(i-1), 2^i) us
+std::vector<double> BinBoundsMs()
+{
+    std::vector<double> bounds;
+    for (int i = 0; i < CVCUDA_OPERATOR_STATS_NUM_BINS - 1; ++i)
+    {
+        bounds.push_back(std::ldexp(1.0, i) / 1000.0);
+    }
+    bounds.push_back(std::numeric_limits<double>::infinity());
+    return bounds;
+}
+
+// Percentile estimated from a histogram, interpolated linearly within its bin and clamped to the largest time
+double Percentile(const int64_t *histogram, int64_t count, double maxMs, double q)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    const double rank = q * count;
+
+    int64_t below = 0;
+    for (int i = 0; i < CVCUDA_OPERATOR_STATS_NUM_BINS; ++i)
+    {
+        if (histogram[i] > 0 && below + histogram[i] >= rank)
+        {
+            const double lo = i == 0 ? 0 : std::ldexp(1.0, i - 1) / 1000.0;
+            const double hi = i == CVCUDA_OPERATOR_STATS_NUM_BINS - 1 ? maxMs : std::ldexp(1.0, i) / 1000.0;
+            return std::min(maxMs, lo + (hi - lo) * (rank - below) / histogram[i]);
+        }
+        below += histogram[i];
+    }
+    return maxMs;
+}
+
+py::dict ToDict(const NVCVOperatorStats &s)
+{
+    py::dict d;
+    d["name"]     = s.name;
+    d["count"]    = s.count;
+    d["total_ms"] = s.totalTimeMs;
+    d["min_ms"]   = s.minTimeMs;
+    d["max_ms"]   = s.maxTimeMs;
+    d["p50_ms"]   = Percentile(s.histogram, s.count, s.maxTimeMs, 0.50);
+    d["p99_ms"]   = Percentile(s.histogram, s.count, s.maxTimeMs, 0.99);
+
+    d["histogram"] = std::vector<int64_t>(std::begin(s.histogram), std::end(s.histogram));
+
+    d["total_submit_ms"] = s.totalSubmitTimeMs;
+    d["max_submit_ms"]   = s.maxSubmitTimeMs;
+    d["submit_p50_ms"]   = Percentile(s.submitHistogram, s.count, s.maxSubmitTimeMs, 0.50);
+    d["submit_p99_ms"]   = Percentile(s.submitHistogram, s.count, s.maxSubmitTimeMs, 0.99);
+
+    d["submit_histogram"] = std::vector<int64_t>(std::begin(s.submitHistogram), std::end(s.submitHistogram));
+    return d;
+}
+
+py::list ToList(const NVCVOperatorStats *stats, int32_t numStats)
+{
+    py::list list;
+    for (int32_t i = 0; i < numStats; ++i)
+    {
+        list.append(ToDict(stats[i]));
+    }
+    return list;
+}
+
+py::list GetOperatorStats()
+{
+    int32_t numStats = 0;
+    nvcv::detail::CheckThrow(cvcudaGetOperatorStats(nullptr, &numStats));
+
+    std::vector<NVCVOperatorStats> stats(numStats);
+    nvcv::detail::CheckThrow(cvcudaGetOperatorStats(stats.data(), &numStats));
+
+    return ToList(stats.data(), numStats);
+}
+
+// Python function the stats are pushed to, never destroyed as it may outlive the interpreter
+py::object *g_sink = new py::object();
+
+void SinkCallback(void *, const NVCVOperatorStats *stats, int32_t numStats)
+{
+    py::gil_scoped_acquire gil;
+    try
+    {
+        (*g_sink)(ToList(stats, numStats));
+    }
+    catch (py::error_already_set &e)
+    {
+        // Nobody to raise it to from the sink thread
+        e.discard_as_unraisable("cvcuda operator stats sink");
+    }
+}
+
+void SetOperatorStatsSink(std::optional<py::function> sink, int32_t intervalMs)
+{
+    {
+        // The sink thread might be waiting for the GIL to call the current sink
+        py::gil_scoped_release release;
+        nvcv::detail::CheckThrow(cvcudaSetOperatorStatsSink(nullptr, nullptr, 0));
+    }
+
+    *g_sink = sink ? py::object(*sink) : py::object();
+    if (sink)
+    {
+        nvcv::detail::CheckThrow(cvcudaSetOperatorStatsSink(&SinkCallback, nullptr, intervalMs));
+    }
+}
+
+} // namespace
+
+void ExportOperatorStats(py::module &m)
+{
+    using namespace py::literals;
+
+    m.attr("OPERATOR_STATS_BIN_BOUNDS_MS") = BinBoundsMs();
+
+    m.def(
+        "set_operator_timing",
+        [](bool enabled, int32_t sampleEvery)
+        {
+            nvcv::detail::CheckThrow(cvcudaSetOperatorTimingSampling(sampleEvery));
+            nvcv::detail::CheckThrow(cvcudaSetOperatorTimingEnabled(enabled));
+        },
+        "enabled"_a, "sample_every"_a = 1,
+        "Enables or disables GPU and CPU submit timing of operator executions, timing one execution every "
+        "sample_every of each operator.");
+
+    m.def("operator_stats", &GetOperatorStats,
+          "Returns the stats of the operators timed so far as dicts, with counts, times in milliseconds, p50 and p99 "
+          "estimates and histograms whose bins end at OPERATOR_STATS_BIN_BOUNDS_MS.");
+
+    m.def(
+        "reset_operator_stats", [] { nvcv::detail::CheckThrow(cvcudaResetOperatorStats()); },
+        "Clears the stats of all operators.");
+
+    m.def("set_operator_stats_sink", &SetOperatorStatsSink, "sink"_a, "interval_ms"_a = 1000,
+          "Calls sink with the list of operator stats every interval_ms milliseconds from a background thread, e.g. "
+          "to export them as metrics. None stops the calls.");
+
+    // The sink thread must not call into python once it's gone
+    util::RegisterCleanup(m, [] { SetOperatorStatsSink(std::nullopt, 0); });
+}
+
+} // namespace cvcudapy
@@ -16,6 +16,7 @@
  */
 
 #include <common/Hash.hpp>
+#include <nvcv/DataLayout.hpp>
 #include <nvcv/python/Cache.hpp>
 #include <nvcv/python/Container.hpp>
 #include <nvcv/python/ImageFormat.hpp>
@@ -26,6 +27,10 @@
 
 #include <nvcv/python/Fwd.hpp>
 
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
 namespace nvcvpy::util {
 }
 
@@ -70,6 +75,41 @@ void ExportOpCvtColor(py::module &m);
 void ExportOpComposite(py::module &m);
 void ExportOpGammaContrast(py::module &m);
 void ExportOpPillowResize(py::module &m);
+void ExportOpResizeNormalizeReformat(py::module &m);
+void ExportOpCropResize(py::module &m);
+void ExportOpRemap(py::module &m);
+void ExportOpReduce(py::module &m);
+void ExportOpHistogram(py::module &m);
+void ExportOpMinMaxLoc(py::module &m);
+void ExportOpLetterbox(py::module &m);
+void ExportOpBuildPyramid(py::module &m);
+void ExportOpArgMax(py::module &m);
+void ExportOpMaskOverlay(py::module &m);
+void ExportOpTopK(py::module &m);
+void ExportOpBoxDecode(py::module &m);
+void ExportOpNMS(py::module &m);
+void ExportOpAbsDiff(py::module &m);
+void ExportOpTemporalFilter(py::module &m);
+void ExportOpLUT(py::module &m);
+void ExportOpSobel(py::module &m);
+void ExportOpCanny(py::module &m);
+void ExportOpIntegral(py::module &m);
+void ExportOpAdaptiveThreshold(py::module &m);
+void ExportOpLabel(py::module &m);
+void ExportOpDemosaic(py::module &m);
+void ExportOpHistogramEq(py::module &m);
+void ExportOpCLAHE(py::module &m);
+void ExportOpImageHash(py::module &m);
+void ExportOpGuidedFilter(py::module &m);
+void ExportOpBlurRegions(py::module &m);
+void ExportOpOSD(py::module &m);
+void ExportOpMosaic(py::module &m);
+void ExportOpPSNR(py::module &m);
+void ExportOpSSIM(py::module &m);
+void ExportOpMatchTemplate(py::module &m);
+void ExportOpFAST(py::module &m);
+void ExportOpHarris(py::module &m);
+void ExportOpSharpness(py::module &m);
 
 // Helper class that serves as python-side operator class.
 // OP: native operator class
@@ -84,9 +124,23 @@ public:
     template<class... AA>
     void submit(AA &&...args)
     {
+        // Arguments are native objects at this point, the launch doesn't
+        // touch python objects, and operators might block on the stream.
+        // Let other python threads run in the meantime.
+        py::gil_scoped_release release;
+
         m_op(std::forward<AA>(args)...);
     }
 
+    // Same as submit, for operators with named entry points besides operator().
+    template<class F>
+    void submitWith(F &&fn)
+    {
+        py::gil_scoped_release release;
+
+        fn(m_op);
+    }
+
     py::object container() const override
     {
         return *this;
@@ -173,6 +227,32 @@ std::shared_ptr<PyOperator<OP, void(AA...)>> CreateOperator(AA &&...args)
         return op;
     }
 }
+
+// Returns the swizzle of a channel_order argument, where output channel c is input channel order[c], e.g. [2, 1, 0]
+// turns BGR into RGB.  Channels past the given ones are kept in place, as are all of them without an order.
+inline NVCVSwizzle ChannelOrderSwizzle(const std::optional<std::vector<int>> &order)
+{
+    nvcv::Channel channels[4] = {nvcv::Channel::X, nvcv::Channel::Y, nvcv::Channel::Z, nvcv::Channel::W};
+
+    if (order)
+    {
+        if (order->size() > 4)
+        {
+            throw std::invalid_argument("Channel order must not have more than 4 channels");
+        }
+
+        for (size_t c = 0; c < order->size(); ++c)
+        {
+            if ((*order)[c] < 0 || (*order)[c] >= 4)
+            {
+                throw std::invalid_argument("Channel order values must be between 0 and 3");
+            }
+            channels[c] = static_cast<nvcv::Channel>(static_cast<int>(nvcv::Channel::X) + (*order)[c]);
+        }
+    }
+
+    return static_cast<NVCVSwizzle>(nvcv::MakeSwizzle(channels[0], channels[1], channels[2], channels[3]));
+}
 } // namespace cvcudapy
 
 namespace nvcv {
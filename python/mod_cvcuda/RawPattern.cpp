@@ -0,0 +1,34 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RawPattern.hpp"
+
+#include <nvcv/ColorSpec.h>
+
+namespace cvcudapy {
+
+void ExportRawPattern(py::module &m)
+{
+    // Only the Bayer patterns handled by the demosaic operator
+    py::enum_<NVCVRawPattern>(m, "RawPattern")
+        .value("BAYER_RGGB", NVCV_RAW_BAYER_RGGB)
+        .value("BAYER_BGGR", NVCV_RAW_BAYER_BGGR)
+        .value("BAYER_GRBG", NVCV_RAW_BAYER_GRBG)
+        .value("BAYER_GBRG", NVCV_RAW_BAYER_GBRG);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,33 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ReduceOp.hpp"
+
+#include <cvcuda/Types.h>
+
+namespace cvcudapy {
+
+void ExportReduceOp(py::module &m)
+{
+    py::enum_<NVCVReduceOp>(m, "ReduceOp")
+        .value("SUM", NVCV_REDUCE_SUM)
+        .value("MEAN", NVCV_REDUCE_MEAN)
+        .value("MIN", NVCV_REDUCE_MIN)
+        .value("MAX", NVCV_REDUCE_MAX);
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,288 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Allocator.hpp"
+
+#include "Cache.hpp"
+
+#include <common/CheckError.hpp>
+#include <common/PyUtil.hpp>
+#include <common/String.hpp>
+#include <nvcv/alloc/Allocator.h>
+#include <nvcv/alloc/AllocatorWrapHandle.hpp>
+
+#include <mutex>
+#include <vector>
+
+namespace nvcvpy::priv {
+
+namespace {
+
+// Python objects are created with the default allocator.
+constexpr NVCVAllocatorHandle kDefaultAllocator = nullptr;
+
+const char *ResourceName(NVCVResourceType resType)
+{
+    switch (resType)
+    {
+    case NVCV_RESOURCE_MEM_HOST:
+        return "host";
+    case NVCV_RESOURCE_MEM_CUDA:
+        return "cuda";
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        return "host_pinned";
+    }
+    return "unknown";
+}
+
+py::dict GetStats()
+{
+    py::dict out;
+    for (int i = 0; i < NVCV_NUM_RESOURCE_TYPES; ++i)
+    {
+        auto resType = static_cast<NVCVResourceType>(i);
+
+        NVCVAllocatorStats stats;
+        util::CheckThrow(nvcvAllocatorGetStats(kDefaultAllocator, resType, &stats));
+
+        py::list histogram;
+        for (int64_t count : stats.sizeHistogram)
+        {
+            histogram.append(count);
+        }
+
+        py::dict d;
+        d["bytes_in_use"]      = stats.bytesInUse;
+        d["peak_bytes_in_use"] = stats.peakBytesInUse;
+        d["num_allocs"]        = stats.numAllocs;
+        d["num_frees"]         = stats.numFrees;
+        d["size_histogram"]    = histogram;
+
+        out[ResourceName(resType)] = d;
+    }
+    return out;
+}
+
+// Kept alive while installed, only touched with the GIL held.
+py::object g_traceFn;
+
+void TraceToPython(void *, NVCVAllocatorHandle, const NVCVAllocatorTraceEvent *ev)
+{
+    py::gil_scoped_acquire gil;
+
+    if (!g_traceFn)
+    {
+        return;
+    }
+
+    try
+    {
+        g_traceFn(ev->type == NVCV_ALLOCATOR_TRACE_ALLOC ? "alloc" : "free", ResourceName(ev->resType),
+                  reinterpret_cast<uintptr_t>(ev->ptr), ev->sizeBytes);
+    }
+    catch (py::error_already_set &e)
+    {
+        // Allocations can't fail because of the tracer.
+        e.discard_as_unraisable(__func__);
+    }
+}
+
+void SetTrace(py::object fn)
+{
+    if (fn.is_none())
+    {
+        util::CheckThrow(nvcvAllocatorSetTraceFunc(kDefaultAllocator, nullptr, nullptr));
+        g_traceFn = py::object{};
+    }
+    else
+    {
+        g_traceFn = std::move(fn);
+        util::CheckThrow(nvcvAllocatorSetTraceFunc(kDefaultAllocator, &TraceToPython, nullptr));
+    }
+}
+
+// Python functions cuda memory is allocated with. Allocators are never
+// destroyed, objects allocated with them keep referring to them until freed.
+struct PythonCudaAllocator
+{
+    py::object fnAlloc, fnFree; // only touched with the GIL held
+
+    NVCVAllocatorHandle        handle = nullptr;
+    nvcv::AllocatorWrapHandle *wrapper = nullptr;
+};
+
+std::mutex                         g_allocMtx;
+PythonCudaAllocator               *g_curAllocator = nullptr; // nullptr means the default allocator
+std::vector<PythonCudaAllocator *> g_pyAllocators;
+
+void *AllocFromPython(void *ctx, int64_t sizeBytes, int32_t alignBytes)
+{
+    auto *alloc = static_cast<PythonCudaAllocator *>(ctx);
+
+    py::gil_scoped_acquire gil;
+
+    if (!alloc->fnAlloc)
+    {
+        return nullptr;
+    }
+
+    try
+    {
+        uintptr_t ptr = alloc->fnAlloc(sizeBytes, alignBytes).cast<uintptr_t>();
+        if (ptr % alignBytes != 0)
+        {
+            alloc->fnFree(ptr, sizeBytes);
+            throw std::runtime_error(util::FormatString("Allocated address %p isn't aligned to %d bytes",
+                                                        reinterpret_cast<void *>(ptr), alignBytes));
+        }
+        return reinterpret_cast<void *>(ptr);
+    }
+    catch (py::error_already_set &e)
+    {
+        // Failure is reported as an out of memory error by the caller.
+        e.discard_as_unraisable(__func__);
+    }
+    catch (std::exception &e)
+    {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+        py::error_already_set err;
+        err.discard_as_unraisable(__func__);
+    }
+    return nullptr;
+}
+
+void FreeToPython(void *ctx, void *ptr, int64_t sizeBytes, int32_t alignBytes)
+{
+    auto *alloc = static_cast<PythonCudaAllocator *>(ctx);
+
+    // Objects freed while the interpreter is being torn down leak their memory.
+    if (ptr == nullptr || !Py_IsInitialized())
+    {
+        return;
+    }
+
+    py::gil_scoped_acquire gil;
+
+    if (!alloc->fnFree)
+    {
+        return;
+    }
+
+    try
+    {
+        alloc->fnFree(reinterpret_cast<uintptr_t>(ptr), sizeBytes);
+    }
+    catch (py::error_already_set &e)
+    {
+        e.discard_as_unraisable(__func__);
+    }
+}
+
+void SetCudaAllocator(py::object fnAlloc, py::object fnFree)
+{
+    if (fnAlloc.is_none() != fnFree.is_none())
+    {
+        throw std::invalid_argument("Both alloc and free functions must be given, or none of them");
+    }
+
+    PythonCudaAllocator *alloc = nullptr;
+
+    if (!fnAlloc.is_none())
+    {
+        alloc          = new PythonCudaAllocator();
+        alloc->fnAlloc = std::move(fnAlloc);
+        alloc->fnFree  = std::move(fnFree);
+
+        NVCVCustomAllocator custom = {};
+        custom.ctx                 = alloc;
+        custom.resType             = NVCV_RESOURCE_MEM_CUDA;
+        custom.res.mem.fnAlloc     = &AllocFromPython;
+        custom.res.mem.fnFree      = &FreeToPython;
+
+        NVCVStatus status = nvcvAllocatorConstructCustom(&custom, 1, &alloc->handle);
+        if (status != NVCV_SUCCESS)
+        {
+            delete alloc;
+            util::CheckThrow(status);
+        }
+        alloc->wrapper = new nvcv::AllocatorWrapHandle(alloc->handle);
+    }
+
+    {
+        std::unique_lock<std::mutex> lk(g_allocMtx);
+        if (alloc)
+        {
+            g_pyAllocators.push_back(alloc);
+        }
+        g_curAllocator = alloc;
+    }
+
+    // Cached objects not in use would otherwise keep memory of the previous
+    // allocator, and be reused instead of allocating new ones.
+    Cache::Instance().removeAllNotInUse();
+}
+
+} // namespace
+
+nvcv::IAllocator *CurrentAllocator()
+{
+    std::unique_lock<std::mutex> lk(g_allocMtx);
+    return g_curAllocator ? g_curAllocator->wrapper : nullptr;
+}
+
+void ExportAllocator(py::module &m)
+{
+    using namespace py::literals;
+
+    m.def("allocator_stats", &GetStats,
+          "Get the memory usage counters of the allocator used by nvcv objects, for each of the 'host', 'cuda' and "
+          "'host_pinned' memory types: bytes in use and its peak, allocation and free counts, and the histogram of "
+          "allocation sizes, bucket 0 counting allocations below 1 KiB and each following one a power of two.");
+
+    m.def(
+        "reset_allocator_stats", [] { util::CheckThrow(nvcvAllocatorResetStats(kDefaultAllocator)); },
+        "Reset the allocation and free counts and the size histogram, and set the peak to the bytes in use.");
+
+    m.def("set_allocator_trace", &SetTrace, "fn"_a,
+          "Set a function called as fn(event, mem_type, ptr, size) on each allocation and free done by nvcv "
+          "objects, where event is 'alloc' or 'free'. It's called by the allocating thread, so memory can be "
+          "attributed to the operator or object being created. Pass None to stop tracing.");
+
+    m.def("set_cuda_allocator", &SetCudaAllocator, "alloc"_a, "free"_a,
+          "Set the functions cuda memory of nvcv objects created from now on, e.g. operator outputs, is allocated "
+          "with. They're called as alloc(size, alignment) -> address and free(address, size), addresses being "
+          "ints. Allows sharing a memory pool with another library, e.g. with alloc=lambda size, align: "
+          "torch.cuda.caching_allocator_alloc(size) and free=lambda ptr, size: "
+          "torch.cuda.caching_allocator_delete(ptr). Pass None to both to get back to the default allocator.");
+
+    util::RegisterCleanup(m,
+                          []
+                          {
+                              // Objects might still be freed after the interpreter is gone.
+                              nvcvAllocatorSetTraceFunc(kDefaultAllocator, nullptr, nullptr);
+                              g_traceFn = py::object{};
+
+                              std::unique_lock<std::mutex> lk(g_allocMtx);
+                              for (PythonCudaAllocator *alloc : g_pyAllocators)
+                              {
+                                  alloc->fnAlloc = py::object{};
+                                  alloc->fnFree  = py::object{};
+                              }
+                          });
+}
+
+} // namespace nvcvpy::priv
@@ -133,7 +133,9 @@ extern "C" void ImplStream_HoldResources(PyObject *stream, PyObject *resourceLis
 
 extern "C" PyObject *ImplStream_GetCurrent()
 {
-    return py::cast(Stream::Current().shared_from_this()).ptr();
+    // The stream already has its python object, it's looked up without
+    // copying its shared_ptr.
+    return py::cast(&Stream::Current(), py::return_value_policy::reference).ptr();
 }
 
 extern "C" cudaStream_t ImplStream_GetCudaHandle(PyObject *stream)
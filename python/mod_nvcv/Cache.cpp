@@ -19,8 +19,13 @@
 
 #include <common/Assert.hpp>
 #include <common/PyUtil.hpp>
+#include <pybind11/stl.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <mutex>
+#include <optional>
 #include <thread>
 #include <unordered_map>
 
@@ -47,7 +52,7 @@ struct KeyEqual
 
 CacheItem::CacheItem()
 {
-    static uint64_t idnext = 0;
+    static std::atomic<uint64_t> idnext{0};
 
     m_id = idnext++;
 }
@@ -75,10 +80,50 @@ bool CacheItem::isInUse() const
     return sthis.use_count() > 2;
 }
 
+int64_t CacheItem::sizeBytes() const
+{
+    return 0;
+}
+
+namespace {
+
+struct CacheEntry
+{
+    std::shared_ptr<CacheItem> item;
+    int64_t                    sizeBytes;
+    uint64_t                   lastUse;
+    bool                       pinned;
+};
+
+struct CacheShard
+{
+    std::mutex                                                           mtx;
+    std::unordered_multimap<const IKey *, CacheEntry, HashKey, KeyEqual> items;
+};
+
+} // namespace
+
 struct Cache::Impl
 {
-    std::mutex                                                                           mtx;
-    std::unordered_multimap<const IKey *, std::shared_ptr<CacheItem>, HashKey, KeyEqual> items;
+    // Items are spread among shards according to their key's hash, so that
+    // threads creating objects with different keys don't contend for the
+    // same mutex.
+    static constexpr int kNumShards = 16;
+
+    std::array<CacheShard, kNumShards> shards;
+
+    std::atomic<uint64_t> clock{0}; // timestamp of last use, for LRU eviction
+    std::atomic<int64_t>  limit{-1};
+    std::atomic<int64_t>  sizeBytes{0};
+    std::atomic<int64_t>  numItems{0};
+    std::atomic<int64_t>  hits{0};
+    std::atomic<int64_t>  misses{0};
+    std::atomic<int64_t>  evictions{0};
+
+    CacheShard &shard(const IKey &key)
+    {
+        return shards[key.hash() % kNumShards];
+    }
 };
 
 Cache::Cache()
@@ -86,11 +131,29 @@ Cache::Cache()
 {
 }
 
-void Cache::add(CacheItem &item)
+void Cache::add(CacheItem &item, bool pinned)
 {
-    std::unique_lock<std::mutex> lk(pimpl->mtx);
+    // Evicted items must only be destroyed after the mutexes are unlocked,
+    // see removeAllNotInUseMatching.
+    std::vector<std::shared_ptr<CacheItem>> holdItemsUntilMtxUnlocked;
+
+    CacheEntry entry{item.shared_from_this(), item.sizeBytes(), pimpl->clock++, pinned};
+
+    {
+        CacheShard &shard = pimpl->shard(item.key());
 
-    pimpl->items.emplace(&item.key(), item.shared_from_this());
+        std::unique_lock<std::mutex> lk(shard.mtx);
+        shard.items.emplace(&item.key(), entry);
+    }
+
+    ++pimpl->numItems;
+    int64_t sizeBytes = pimpl->sizeBytes += entry.sizeBytes;
+
+    int64_t limit = pimpl->limit;
+    if (limit >= 0 && sizeBytes > limit)
+    {
+        doEvict(holdItemsUntilMtxUnlocked);
+    }
 }
 
 void Cache::removeAllNotInUseMatching(const IKey &key)
@@ -108,19 +171,76 @@ void Cache::removeAllNotInUseMatching(const IKey &key)
     std::vector<std::shared_ptr<CacheItem>> holdItemsUntilMtxUnlocked;
 
     {
-        std::unique_lock<std::mutex> lk(pimpl->mtx);
+        CacheShard &shard = pimpl->shard(key);
 
-        auto itrange = pimpl->items.equal_range(&key);
+        std::unique_lock<std::mutex> lk(shard.mtx);
 
-        int numItems = std::distance(itrange.first, itrange.second);
+        auto itrange = shard.items.equal_range(&key);
 
-        auto it = itrange.first;
-        for (int i = 0; i < numItems; ++i)
+        for (auto it = itrange.first; it != itrange.second;)
         {
-            if (!it->second->isInUse())
+            if (!it->second.pinned && !it->second.item->isInUse())
             {
-                holdItemsUntilMtxUnlocked.push_back(it->second);
-                pimpl->items.erase(it++);
+                pimpl->sizeBytes -= it->second.sizeBytes;
+                --pimpl->numItems;
+
+                holdItemsUntilMtxUnlocked.push_back(std::move(it->second.item));
+                it = shard.items.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+}
+
+void Cache::removeAllNotInUse()
+{
+    // See removeAllNotInUseMatching
+    std::vector<std::shared_ptr<CacheItem>> holdItemsUntilMtxUnlocked;
+
+    for (CacheShard &shard : pimpl->shards)
+    {
+        std::unique_lock<std::mutex> lk(shard.mtx);
+
+        for (auto it = shard.items.begin(); it != shard.items.end();)
+        {
+            if (!it->second.pinned && !it->second.item->isInUse())
+            {
+                pimpl->sizeBytes -= it->second.sizeBytes;
+                --pimpl->numItems;
+                ++pimpl->evictions;
+
+                holdItemsUntilMtxUnlocked.push_back(std::move(it->second.item));
+                it = shard.items.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+}
+
+void Cache::removeAllNotInUseIf(const std::function<bool(const CacheItem &)> &pred)
+{
+    // See removeAllNotInUseMatching
+    std::vector<std::shared_ptr<CacheItem>> holdItemsUntilMtxUnlocked;
+
+    for (CacheShard &shard : pimpl->shards)
+    {
+        std::unique_lock<std::mutex> lk(shard.mtx);
+
+        for (auto it = shard.items.begin(); it != shard.items.end();)
+        {
+            if (!it->second.pinned && pred(*it->second.item) && !it->second.item->isInUse())
+            {
+                pimpl->sizeBytes -= it->second.sizeBytes;
+                --pimpl->numItems;
+
+                holdItemsUntilMtxUnlocked.push_back(std::move(it->second.item));
+                it = shard.items.erase(it);
             }
             else
             {
@@ -134,42 +254,175 @@ std::vector<std::shared_ptr<CacheItem>> Cache::fetch(const IKey &key) const
 {
     std::vector<std::shared_ptr<CacheItem>> v;
 
-    std::unique_lock<std::mutex> lk(pimpl->mtx);
+    {
+        CacheShard &shard = pimpl->shard(key);
 
-    auto itrange = pimpl->items.equal_range(&key);
+        std::unique_lock<std::mutex> lk(shard.mtx);
 
-    v.reserve(distance(itrange.first, itrange.second));
+        auto itrange = shard.items.equal_range(&key);
 
-    for (auto it = itrange.first; it != itrange.second; ++it)
-    {
-        if (!it->second->isInUse())
+        for (auto it = itrange.first; it != itrange.second; ++it)
         {
-            v.emplace_back(it->second);
+            if (!it->second.item->isInUse())
+            {
+                // callers reuse the first item returned
+                if (v.empty())
+                {
+                    it->second.lastUse = pimpl->clock++;
+                }
+                v.emplace_back(it->second.item);
+            }
         }
     }
 
+    if (v.empty())
+    {
+        ++pimpl->misses;
+    }
+    else
+    {
+        ++pimpl->hits;
+    }
+
     return v;
 }
 
+std::shared_ptr<CacheItem> Cache::fetchAndClaim(const IKey &key) const
+{
+    std::shared_ptr<CacheItem> item;
+
+    {
+        CacheShard &shard = pimpl->shard(key);
+
+        std::unique_lock<std::mutex> lk(shard.mtx);
+
+        auto itrange = shard.items.equal_range(&key);
+
+        for (auto it = itrange.first; it != itrange.second; ++it)
+        {
+            if (!it->second.item->isInUse())
+            {
+                // Holding a reference marks it as in use before the mutex is unlocked
+                it->second.lastUse = pimpl->clock++;
+                item               = it->second.item;
+                break;
+            }
+        }
+    }
+
+    if (item)
+    {
+        ++pimpl->hits;
+    }
+    else
+    {
+        ++pimpl->misses;
+    }
+
+    return item;
+}
+
+void Cache::doEvict(std::vector<std::shared_ptr<CacheItem>> &evicted)
+{
+    // Eviction only happens when the cache goes above its limit, so we can
+    // afford locking all shards (always in the same order) to evict the least
+    // recently used items globally.
+    std::vector<std::unique_lock<std::mutex>> locks;
+    locks.reserve(Impl::kNumShards);
+
+    using Candidate = std::pair<uint64_t, std::pair<CacheShard *, decltype(CacheShard::items)::iterator>>;
+    std::vector<Candidate> candidates;
+
+    for (CacheShard &shard : pimpl->shards)
+    {
+        locks.emplace_back(shard.mtx);
+
+        for (auto it = shard.items.begin(); it != shard.items.end(); ++it)
+        {
+            if (it->second.sizeBytes > 0 && !it->second.pinned && !it->second.item->isInUse())
+            {
+                candidates.push_back({it->second.lastUse, {&shard, it}});
+            }
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+              [](const Candidate &a, const Candidate &b) { return a.first < b.first; });
+
+    int64_t limit = pimpl->limit;
+
+    for (const Candidate &c : candidates)
+    {
+        if (limit < 0 || pimpl->sizeBytes <= limit)
+        {
+            break;
+        }
+
+        auto [shard, it] = c.second;
+
+        pimpl->sizeBytes -= it->second.sizeBytes;
+        --pimpl->numItems;
+        ++pimpl->evictions;
+
+        evicted.push_back(std::move(it->second.item));
+        shard->items.erase(it);
+    }
+}
+
+auto Cache::stats() const -> Stats
+{
+    return {pimpl->hits, pimpl->misses, pimpl->evictions, pimpl->numItems, pimpl->sizeBytes};
+}
+
+void Cache::setLimit(int64_t sizeBytes)
+{
+    std::vector<std::shared_ptr<CacheItem>> holdItemsUntilMtxUnlocked;
+
+    pimpl->limit = sizeBytes;
+    if (sizeBytes >= 0 && pimpl->sizeBytes > sizeBytes)
+    {
+        doEvict(holdItemsUntilMtxUnlocked);
+    }
+}
+
+int64_t Cache::limit() const
+{
+    return pimpl->limit;
+}
+
 void Cache::clear()
 {
-    std::unique_lock<std::mutex> lk(pimpl->mtx);
-    pimpl->items.clear();
+    std::vector<std::shared_ptr<CacheItem>> holdItemsUntilMtxUnlocked;
+
+    for (CacheShard &shard : pimpl->shards)
+    {
+        std::unique_lock<std::mutex> lk(shard.mtx);
+
+        for (auto &[key, entry] : shard.items)
+        {
+            pimpl->sizeBytes -= entry.sizeBytes;
+            --pimpl->numItems;
+
+            holdItemsUntilMtxUnlocked.push_back(std::move(entry.item));
+        }
+        shard.items.clear();
+    }
 }
 
 void Cache::doIterateThroughItems(const std::function<void(CacheItem &item)> &fn) const
 {
-    // To avoid keeping mutex locked for too long, let's first gather all items
-    // into a vector, unlock the mutex, and then iterate through them.
+    // To avoid keeping mutexes locked for too long, let's first gather all items
+    // into a vector, unlock the mutexes, and then iterate through them.
     std::vector<std::shared_ptr<CacheItem>> v;
+    v.reserve(pimpl->numItems);
 
+    for (CacheShard &shard : pimpl->shards)
     {
-        std::unique_lock<std::mutex> lk(pimpl->mtx);
-        v.reserve(pimpl->items.size());
+        std::unique_lock<std::mutex> lk(shard.mtx);
 
-        for (auto it = pimpl->items.begin(); it != pimpl->items.end(); ++it)
+        for (auto it = shard.items.begin(); it != shard.items.end(); ++it)
         {
-            v.push_back(it->second);
+            v.push_back(it->second.item);
         }
     }
 
@@ -187,6 +440,8 @@ Cache &Cache::Instance()
 
 void Cache::Export(py::module &m)
 {
+    using namespace py::literals;
+
     py::class_<CacheItem, std::shared_ptr<CacheItem>>(nullptr, "CacheItem", py::module_local());
 
     py::class_<ExternalCacheItem, CacheItem, std::shared_ptr<ExternalCacheItem>>(nullptr, "ExternalCacheItem",
@@ -201,6 +456,47 @@ void Cache::Export(py::module &m)
 
     m.def("clear_cache", [] { Cache::Instance().clear(); });
 
+    m.def(
+        "set_cache_limit_inbytes", [](int64_t sizeBytes) { Cache::Instance().setLimit(sizeBytes); }, "size"_a,
+        "Set the maximum size in bytes of the objects kept in cache. Objects not in use are evicted, least recently "
+        "used first, when the cache goes above it. A negative size means no limit, the default.");
+    m.def(
+        "get_cache_limit_inbytes", [] { return Cache::Instance().limit(); },
+        "Get the maximum size in bytes of the objects kept in cache.");
+    m.def(
+        "cache_limit",
+        [](std::optional<int64_t> sizeBytes)
+        {
+            if (sizeBytes)
+            {
+                Cache::Instance().setLimit(*sizeBytes);
+            }
+            return Cache::Instance().limit();
+        },
+        "size"_a = std::nullopt,
+        "Get the maximum size in bytes of the objects kept in cache, setting it first if a size is given.");
+    m.def(
+        "cache_size", [] { return Cache::Instance().stats().sizeBytes; },
+        "Get the total size in bytes of the objects currently in cache.");
+    m.def(
+        "current_cache_size_inbytes", [] { return Cache::Instance().stats().sizeBytes; },
+        "Get the total size in bytes of the objects currently in cache.");
+    m.def(
+        "cache_stats",
+        []
+        {
+            Cache::Stats stats = Cache::Instance().stats();
+
+            py::dict d;
+            d["hits"]       = stats.hits;
+            d["misses"]     = stats.misses;
+            d["evictions"]  = stats.evictions;
+            d["num_items"]  = stats.numItems;
+            d["size_bytes"] = stats.sizeBytes;
+            return d;
+        },
+        "Get the cache hit, miss and eviction counts, and the number and total size of objects in cache.");
+
     // Just to check if fetchAll compiles, it's harmless
     Cache::Instance().fetchAll<Cache>();
 }
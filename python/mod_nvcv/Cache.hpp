@@ -21,9 +21,11 @@
 #include "Object.hpp"
 
 #include <common/Hash.hpp>
+#include <nvcv/Exception.hpp>
 #include <nvcv/python/Cache.hpp>
 #include <pybind11/pybind11.h>
 
+#include <functional>
 #include <vector>
 
 namespace nvcvpy::priv {
@@ -42,6 +44,9 @@ public:
 
     bool isInUse() const;
 
+    // Memory owned by the item, accounted against the cache limit.
+    virtual int64_t sizeBytes() const;
+
 protected:
     CacheItem();
 
@@ -72,11 +77,56 @@ public:
 
     static Cache &Instance();
 
-    void add(CacheItem &container);
+    // Pinned items are never evicted, only removed by clear().
+    void add(CacheItem &container, bool pinned = false);
     void removeAllNotInUseMatching(const IKey &key);
+    void removeAllNotInUse();
+    void removeAllNotInUseIf(const std::function<bool(const CacheItem &)> &pred);
+
+    // Calls create() to allocate a new item. If it runs out of memory, all
+    // items not in use are evicted and it's called again.
+    template<class F>
+    auto allocate(F &&create) -> decltype(create())
+    {
+        try
+        {
+            return create();
+        }
+        catch (const nvcv::Exception &e)
+        {
+            if (e.code() != nvcv::Status::ERROR_OUT_OF_MEMORY)
+            {
+                throw;
+            }
+        }
+
+        removeAllNotInUse();
+        return create();
+    }
 
     std::vector<std::shared_ptr<CacheItem>> fetch(const IKey &key) const;
 
+    // Returns an item with the given key not in use, or nullptr if there's none.
+    // It's taken while the cache is locked, so concurrent calls never return
+    // the same item, as could happen when picking one of the items fetched.
+    std::shared_ptr<CacheItem> fetchAndClaim(const IKey &key) const;
+
+    struct Stats
+    {
+        int64_t hits;
+        int64_t misses;
+        int64_t evictions;
+        int64_t numItems;
+        int64_t sizeBytes;
+    };
+
+    Stats stats() const;
+
+    // Items not in use are evicted, least recently used first, when the total
+    // size of the cached items goes above the limit. A negative limit means no limit.
+    void    setLimit(int64_t sizeBytes);
+    int64_t limit() const;
+
     template<class T>
     std::vector<std::shared_ptr<T>> fetchAll() const
     {
@@ -102,6 +152,7 @@ private:
     Cache();
 
     void doIterateThroughItems(const std::function<void(CacheItem &item)> &fn) const;
+    void doEvict(std::vector<std::shared_ptr<CacheItem>> &evicted);
 };
 
 } // namespace nvcvpy::priv
@@ -0,0 +1,179 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Graph.hpp"
+
+#include "Resource.hpp"
+#include "StreamStack.hpp"
+
+#include <common/CheckError.hpp>
+
+namespace nvcvpy::priv {
+
+Graph::Graph()
+{
+    util::CheckThrow(cudaEventCreateWithFlags(&m_doneEvent, cudaEventDisableTiming));
+}
+
+Graph::~Graph()
+{
+    this->reset();
+    cudaEventDestroy(m_doneEvent);
+}
+
+void Graph::reset()
+{
+    // Previous launches must be done before the graph and the resources it
+    // uses can be released.
+    util::CheckLog(cudaEventSynchronize(m_doneEvent));
+
+    if (m_exec != nullptr)
+    {
+        util::CheckLog(cudaGraphExecDestroy(m_exec));
+        m_exec = nullptr;
+    }
+    if (m_graph != nullptr)
+    {
+        util::CheckLog(cudaGraphDestroy(m_graph));
+        m_graph = nullptr;
+    }
+    m_resources.clear();
+}
+
+Graph &Graph::capture(std::shared_ptr<Stream> stream)
+{
+    if (m_capturing)
+    {
+        throw std::runtime_error("Graph is already being captured");
+    }
+
+    if (!stream)
+    {
+        stream = Stream::Current().shared_from_this();
+    }
+
+    m_captureStream = std::move(stream);
+    return *this;
+}
+
+void Graph::beginCapture()
+{
+    if (m_capturing)
+    {
+        throw std::runtime_error("Graph is already being captured");
+    }
+
+    if (!m_captureStream)
+    {
+        m_captureStream = Stream::Current().shared_from_this();
+    }
+
+    this->reset();
+
+    m_captureStream->beginCapture();
+    m_capturing = true;
+
+    // Operators called without an explicit stream are captured too
+    StreamStack::Instance().push(*m_captureStream);
+}
+
+void Graph::endCapture(py::object exc_type, py::object exc_value, py::object exc_tb)
+{
+    StreamStack::Instance().pop();
+    m_capturing = false;
+
+    std::shared_ptr<Stream> stream = std::move(m_captureStream);
+
+    // Discard the graph if the capture didn't complete.
+    if (!exc_type.is_none())
+    {
+        stream->endCapture(nullptr);
+        return;
+    }
+
+    m_resources = stream->endCapture(&m_graph);
+
+    cudaError_t err = cudaGraphInstantiateWithFlags(&m_exec, m_graph, 0);
+    if (err != cudaSuccess)
+    {
+        m_exec = nullptr;
+        this->reset();
+        util::CheckThrow(err);
+    }
+}
+
+bool Graph::isCaptured() const
+{
+    return m_exec != nullptr;
+}
+
+void Graph::launch(std::shared_ptr<Stream> stream)
+{
+    if (m_capturing)
+    {
+        throw std::runtime_error("Graph can't be launched while being captured");
+    }
+    if (m_exec == nullptr)
+    {
+        throw std::runtime_error("Graph must be captured before being launched");
+    }
+
+    if (!stream)
+    {
+        stream = Stream::Current().shared_from_this();
+    }
+
+    // The whole graph behaves as one operator w.r.t. the resources it uses.
+    for (const auto &[mode, res] : m_resources)
+    {
+        res->submitSync(*stream, mode);
+    }
+
+    util::CheckThrow(cudaGraphLaunch(m_exec, stream->handle()));
+    util::CheckThrow(cudaEventRecord(m_doneEvent, stream->handle()));
+
+    for (const auto &[mode, res] : m_resources)
+    {
+        res->submitSignal(*stream, mode);
+    }
+}
+
+void Graph::Export(py::module &m)
+{
+    py::class_<Graph, std::shared_ptr<Graph>>(m, "Graph",
+                                              "Sequence of operator calls that can be captured once and launched "
+                                              "repeatedly with a single call.")
+        .def(py::init<>())
+        .def("capture", &Graph::capture, py::arg("stream") = nullptr, py::return_value_policy::reference_internal,
+             R"!(Captures the operators called in the returned context into the graph.
+
+                 Operators called inside the context are recorded into the graph instead of being
+                 executed. Their outputs are valid only after the graph is launched. The inputs and
+                 outputs used during the capture are the ones read and written on each launch, new
+                 data must be copied into the captured inputs before launching the graph again.
+                 Operators that upload parameters from pageable host memory can't be captured.
+
+                 Args:
+                     stream (Stream): Stream to capture, defaults to the current stream.)!")
+        .def("__enter__", &Graph::beginCapture)
+        .def("__exit__", &Graph::endCapture)
+        .def("launch", &Graph::launch, py::arg("stream") = nullptr,
+             "Launches the captured operators on the given stream, defaults to the current stream.")
+        .def_property_readonly("captured", &Graph::isCaptured);
+}
+
+} // namespace nvcvpy::priv
@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_PYTHON_PRIV_GRAPH_HPP
+#define NVCV_PYTHON_PRIV_GRAPH_HPP
+
+#include "Stream.hpp"
+
+#include <cuda_runtime.h>
+#include <pybind11/pybind11.h>
+
+#include <memory>
+
+namespace nvcvpy::priv {
+
+namespace py = pybind11;
+
+// Sequence of operator calls captured once into a CUDA graph and launched
+// repeatedly with a single call, without going through the per-call python
+// overhead of argument conversion, cache lookups and resource tracking.
+class Graph
+{
+public:
+    static void Export(py::module &m);
+
+    Graph();
+    ~Graph();
+
+    Graph(const Graph &) = delete;
+    Graph &operator=(const Graph &) = delete;
+
+    Graph &capture(std::shared_ptr<Stream> stream);
+    void   beginCapture();
+    void   endCapture(py::object exc_type, py::object exc_value, py::object exc_tb);
+
+    void launch(std::shared_ptr<Stream> stream);
+
+    bool isCaptured() const;
+
+private:
+    void reset();
+
+    std::shared_ptr<Stream> m_captureStream;
+    bool                    m_capturing = false;
+
+    cudaGraph_t     m_graph = nullptr;
+    cudaGraphExec_t m_exec  = nullptr;
+
+    // Resources used by the captured work, with their lock modes
+    LockResources m_resources;
+
+    // Recorded after each launch, so that the graph and its resources outlive
+    // the work in flight.
+    cudaEvent_t m_doneEvent = nullptr;
+};
+
+} // namespace nvcvpy::priv
+
+#endif // NVCV_PYTHON_PRIV_GRAPH_HPP
@@ -17,6 +17,7 @@
 
 #include "Image.hpp"
 
+#include "Allocator.hpp"
 #include "Cache.hpp"
 #include "DataType.hpp"
 #include "ImageFormat.hpp"
@@ -27,8 +28,10 @@
 #include <common/PyUtil.hpp>
 #include <common/String.hpp>
 #include <dlpack/dlpack.h>
+#include <nvcv/Ipc.hpp>
 #include <nvcv/TensorLayout.hpp>
 #include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/alloc/Requirements.hpp>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -451,9 +454,12 @@ nvcv::ImageDataStridedHost CreateNVCVImageDataHost(const std::vector<DLPackTenso
 } // namespace
 
 Image::Image(const Size2D &size, nvcv::ImageFormat fmt)
-    : m_impl(std::make_unique<nvcv::Image>(nvcv::Size2D{std::get<0>(size), std::get<1>(size)}, fmt))
+    : m_impl(std::make_unique<nvcv::Image>(nvcv::Size2D{std::get<0>(size), std::get<1>(size)}, fmt,
+                                           CurrentAllocator()))
     , m_key{size, fmt}
 {
+    nvcv::Image::Requirements reqs = nvcv::Image::CalcRequirements(m_impl->size(), fmt);
+    m_sizeBytes                    = nvcv::CalcTotalSizeBytes(nvcv::Requirements{reqs.mem}.cudaMem());
 }
 
 Image::Image(std::vector<std::shared_ptr<ExternalBuffer>> bufs, const nvcv::IImageDataStridedCuda &imgData)
@@ -491,7 +497,7 @@ Image::Image(std::vector<py::buffer> bufs, const nvcv::IImageDataStridedHost &ho
     // We'll create a regular image and copy the host data into it.
 
     // Create the image with same size and format as host data
-    m_impl = std::make_unique<nvcv::Image>(hostData.size(), hostData.format());
+    m_impl = std::make_unique<nvcv::Image>(hostData.size(), hostData.format(), CurrentAllocator());
 
     auto *devData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(m_impl->exportData());
     NVCV_ASSERT(devData != nullptr);
@@ -518,6 +524,12 @@ Image::Image(std::vector<py::buffer> bufs, const nvcv::IImageDataStridedHost &ho
     };
 }
 
+Image::Image(const NVCVImageIpcHandle &ipc, Stream &stream)
+    : m_impl(std::make_unique<nvcv::ImageWrapIpc>(ipc, stream.handle()))
+    , m_key{} // it's a wrap!
+{
+}
+
 std::shared_ptr<Image> Image::shared_from_this()
 {
     return std::static_pointer_cast<Image>(Container::shared_from_this());
@@ -530,19 +542,19 @@ std::shared_ptr<const Image> Image::shared_from_this() const
 
 std::shared_ptr<Image> Image::Create(const Size2D &size, nvcv::ImageFormat fmt)
 {
-    std::vector<std::shared_ptr<CacheItem>> vcont = Cache::Instance().fetch(Key{size, fmt});
+    std::shared_ptr<CacheItem> cont = Cache::Instance().fetchAndClaim(Key{size, fmt});
 
     // None found?
-    if (vcont.empty())
+    if (!cont)
     {
-        std::shared_ptr<Image> img(new Image(size, fmt));
+        std::shared_ptr<Image> img
+            = Cache::Instance().allocate([&] { return std::shared_ptr<Image>(new Image(size, fmt)); });
         Cache::Instance().add(*img);
         return img;
     }
     else
     {
-        // Get the first one
-        return std::static_pointer_cast<Image>(vcont[0]);
+        return std::static_pointer_cast<Image>(cont);
     }
 }
 
@@ -595,6 +607,38 @@ std::shared_ptr<Image> Image::WrapExternalBufferVector(std::vector<std::shared_p
     return img;
 }
 
+std::shared_ptr<Image> Image::ImportIpc(py::bytes ipc, std::shared_ptr<Stream> stream)
+{
+    if (!stream)
+    {
+        stream = Stream::Current().shared_from_this();
+    }
+
+    auto ipcHandle = util::FromBytes<NVCVImageIpcHandle>(ipc);
+
+    Image::Key key;
+    Cache::Instance().removeAllNotInUseMatching(key);
+
+    std::shared_ptr<Image> img(new Image(ipcHandle, *stream));
+    Cache::Instance().add(*img);
+    return img;
+}
+
+py::bytes Image::exportIpc(std::shared_ptr<Stream> stream) const
+{
+    if (!stream)
+    {
+        stream = Stream::Current().shared_from_this();
+    }
+
+    // The exported event must come after all pending writes to the image
+    this->submitSync(*stream, LOCK_READ);
+    NVCVImageIpcHandle ipc = nvcv::ExportIpc(*m_impl, stream->handle());
+    this->submitSignal(*stream, LOCK_READ);
+
+    return util::ToBytes(ipc);
+}
+
 std::shared_ptr<Image> Image::CreateHost(py::buffer buffer, nvcv::ImageFormat fmt)
 {
     return CreateHostVector(std::vector{buffer}, fmt);
@@ -1006,6 +1050,9 @@ void Image::Export(py::module &m)
         .def("__repr__", &util::ToString<Image>)
         .def("cuda", &Image::cuda, "layout"_a = std::nullopt)
         .def("cpu", &Image::cpu, "layout"_a = std::nullopt)
+        .def("export_ipc", &Image::exportIpc, py::kw_only(), "stream"_a = nullptr,
+             "Returns the bytes describing the image, for another process on the same GPU to import it with "
+             "nvcv.import_image_ipc without copies. The image must be kept alive while it's used there.")
         .def_property_readonly("size", &Image::size)
         .def_property_readonly("width", &Image::width)
         .def_property_readonly("height", &Image::height)
@@ -1015,6 +1062,10 @@ void Image::Export(py::module &m)
     m.def("as_image", &Image::WrapExternalBuffer, "buffer"_a, "format"_a = nvcv::FMT_NONE, py::keep_alive<0, 1>());
     m.def("as_image", &Image::WrapExternalBufferVector, "buffer"_a, "format"_a = nvcv::FMT_NONE,
           py::keep_alive<0, 1>());
+
+    m.def("import_image_ipc", &Image::ImportIpc, "ipc"_a, py::kw_only(), "stream"_a = nullptr,
+          "Imports an image exported by another process with Image.export_ipc. The stream waits for the work "
+          "that produced its contents in the exporting process.");
 }
 
 } // namespace nvcvpy::priv
@@ -25,6 +25,7 @@
 
 #include <nvcv/Image.hpp>
 #include <nvcv/ImageFormat.hpp>
+#include <nvcv/Ipc.h>
 #include <nvcv/TensorLayout.hpp>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
@@ -36,6 +37,8 @@
 namespace nvcvpy::priv {
 namespace py = pybind11;
 
+class Stream;
+
 class Image final : public Container
 {
 public:
@@ -50,6 +53,9 @@ public:
     static std::shared_ptr<Image> WrapExternalBufferVector(std::vector<std::shared_ptr<ExternalBuffer>> buffer,
                                                            nvcv::ImageFormat                            fmt);
 
+    // Imports an image exported by another process with exportIpc
+    static std::shared_ptr<Image> ImportIpc(py::bytes ipc, std::shared_ptr<Stream> stream);
+
     std::shared_ptr<Image>       shared_from_this();
     std::shared_ptr<const Image> shared_from_this() const;
 
@@ -99,13 +105,22 @@ public:
         return m_key;
     }
 
+    virtual int64_t sizeBytes() const override
+    {
+        return m_sizeBytes;
+    }
+
     py::object cpu(std::optional<nvcv::TensorLayout> layout) const;
     py::object cuda(std::optional<nvcv::TensorLayout> layout) const;
 
+    // Describes the image so that another process can import it without copies
+    py::bytes exportIpc(std::shared_ptr<Stream> stream) const;
+
 private:
     explicit Image(const Size2D &size, nvcv::ImageFormat fmt);
     explicit Image(std::vector<std::shared_ptr<ExternalBuffer>> buf, const nvcv::IImageDataStridedCuda &imgData);
     explicit Image(std::vector<py::buffer> buf, const nvcv::IImageDataStridedHost &imgData);
+    explicit Image(const NVCVImageIpcHandle &ipc, Stream &stream);
 
     std::unique_ptr<nvcv::IImage> m_impl; // must come before m_key
     Key                           m_key;
@@ -118,6 +133,8 @@ private:
 
     // If wrapping external data, it's not nullopt.
     std::optional<WrapData> m_wrapData;
+
+    int64_t m_sizeBytes = 0; // 0 if not owning its memory
 };
 
 std::ostream &operator<<(std::ostream &out, const Image &img);
@@ -17,9 +17,11 @@
 
 #include "ImageBatch.hpp"
 
+#include "Allocator.hpp"
 #include "Image.hpp"
 
 #include <common/Assert.hpp>
+#include <nvcv/alloc/Requirements.hpp>
 
 namespace nvcvpy::priv {
 
@@ -37,19 +39,19 @@ bool ImageBatchVarShape::Key::doIsEqual(const IKey &ithat) const
 
 std::shared_ptr<ImageBatchVarShape> ImageBatchVarShape::Create(int capacity)
 {
-    std::vector<std::shared_ptr<CacheItem>> vcont = Cache::Instance().fetch(Key{capacity});
+    std::shared_ptr<CacheItem> cont = Cache::Instance().fetchAndClaim(Key{capacity});
 
     // None found?
-    if (vcont.empty())
+    if (!cont)
     {
-        std::shared_ptr<ImageBatchVarShape> batch(new ImageBatchVarShape(capacity));
+        std::shared_ptr<ImageBatchVarShape> batch = Cache::Instance().allocate(
+            [capacity] { return std::shared_ptr<ImageBatchVarShape>(new ImageBatchVarShape(capacity)); });
         Cache::Instance().add(*batch);
         return batch;
     }
     else
     {
-        // Get the first one
-        auto batch = std::static_pointer_cast<ImageBatchVarShape>(vcont[0]);
+        auto batch = std::static_pointer_cast<ImageBatchVarShape>(cont);
         batch->clear(); // make sure it's in pristine state
         return batch;
     }
@@ -57,9 +59,12 @@ std::shared_ptr<ImageBatchVarShape> ImageBatchVarShape::Create(int capacity)
 
 ImageBatchVarShape::ImageBatchVarShape(int capacity)
     : m_key(capacity)
-    , m_impl(capacity)
+    , m_impl(capacity, CurrentAllocator())
 {
     m_list.reserve(capacity);
+
+    nvcv::ImageBatchVarShape::Requirements reqs = nvcv::ImageBatchVarShape::CalcRequirements(capacity);
+    m_sizeBytes = nvcv::CalcTotalSizeBytes(nvcv::Requirements{reqs.mem}.cudaMem());
 }
 
 const nvcv::ImageBatchVarShape &ImageBatchVarShape::impl() const
@@ -129,6 +134,12 @@ void ImageBatchVarShape::popBack(int imgCount)
     m_list.erase(m_list.end() - imgCount, m_list.end());
 }
 
+void ImageBatchVarShape::setImage(int index, Image &img)
+{
+    m_impl.setImage(index, img.impl());
+    m_list[index] = img.shared_from_this();
+}
+
 void ImageBatchVarShape::clear()
 {
     m_impl.clear();
@@ -169,6 +180,7 @@ void ImageBatchVarShape::Export(py::module &m)
         .def("pushback", &ImageBatchVarShape::pushBack)
         .def("pushback", &ImageBatchVarShape::pushBackMany)
         .def("popback", &ImageBatchVarShape::popBack, "count"_a = 1)
+        .def("__setitem__", &ImageBatchVarShape::setImage, "index"_a, "image"_a)
         .def("clear", &ImageBatchVarShape::clear);
 }
 
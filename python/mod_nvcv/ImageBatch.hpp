@@ -55,6 +55,7 @@ public:
     void pushBack(Image &img);
     void pushBackMany(std::vector<std::shared_ptr<Image>> &imgList);
     void popBack(int imgCount);
+    void setImage(int index, Image &img);
     void clear();
 
     ImageList::const_iterator begin() const;
@@ -80,11 +81,17 @@ public:
         return m_key;
     }
 
+    virtual int64_t sizeBytes() const override
+    {
+        return m_sizeBytes;
+    }
+
 private:
     explicit ImageBatchVarShape(int capacity);
     Key                      m_key;
     ImageList                m_list;
     nvcv::ImageBatchVarShape m_impl;
+    int64_t                  m_sizeBytes;
 };
 
 } // namespace nvcvpy::priv
@@ -0,0 +1,253 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JpegDecoder.hpp"
+
+#include "Image.hpp"
+#include "Resource.hpp"
+
+#include <common/Assert.hpp>
+#include <common/CheckError.hpp>
+#include <pybind11/stl.h>
+
+#include <string>
+
+namespace nvcvpy::priv {
+
+namespace {
+
+void CheckNvjpeg(nvjpegStatus_t status, const char *call)
+{
+    if (status != NVJPEG_STATUS_SUCCESS)
+    {
+        throw std::runtime_error(std::string(call) + " failed with status " + std::to_string(static_cast<int>(status)));
+    }
+}
+
+} // namespace
+
+JpegDecoder::JpegDecoder(int maxBatchSize)
+    : m_maxBatchSize(maxBatchSize)
+{
+    if (m_maxBatchSize < 1)
+    {
+        throw std::invalid_argument("Maximum batch size must be positive");
+    }
+
+    nvjpegStatus_t status = nvjpegCreateEx(NVJPEG_BACKEND_HARDWARE, nullptr, nullptr, NVJPEG_FLAGS_DEFAULT, &m_handle);
+    if (status == NVJPEG_STATUS_ARCH_MISMATCH)
+    {
+        m_hardware = false;
+        status     = nvjpegCreateEx(NVJPEG_BACKEND_DEFAULT, nullptr, nullptr, NVJPEG_FLAGS_DEFAULT, &m_handle);
+    }
+    CheckNvjpeg(status, "nvjpegCreateEx");
+
+    CheckNvjpeg(nvjpegJpegStateCreate(m_handle, &m_batchedState), "nvjpegJpegStateCreate");
+
+    CheckNvjpeg(nvjpegDecoderCreate(m_handle, NVJPEG_BACKEND_DEFAULT, &m_decoder), "nvjpegDecoderCreate");
+    CheckNvjpeg(nvjpegDecoderStateCreate(m_handle, m_decoder, &m_decoderState), "nvjpegDecoderStateCreate");
+    CheckNvjpeg(nvjpegBufferDeviceCreate(m_handle, nullptr, &m_deviceBuffer), "nvjpegBufferDeviceCreate");
+    CheckNvjpeg(nvjpegStateAttachDeviceBuffer(m_decoderState, m_deviceBuffer), "nvjpegStateAttachDeviceBuffer");
+    CheckNvjpeg(nvjpegDecodeParamsCreate(m_handle, &m_decodeParams), "nvjpegDecodeParamsCreate");
+    CheckNvjpeg(nvjpegDecodeParamsSetOutputFormat(m_decodeParams, NVJPEG_OUTPUT_RGBI),
+                "nvjpegDecodeParamsSetOutputFormat");
+
+    for (int b = 0; b < 2; ++b)
+    {
+        CheckNvjpeg(nvjpegBufferPinnedCreate(m_handle, nullptr, &m_pinnedBuffers[b]), "nvjpegBufferPinnedCreate");
+        CheckNvjpeg(nvjpegJpegStreamCreate(m_handle, &m_jpegStreams[b]), "nvjpegJpegStreamCreate");
+        util::CheckThrow(cudaEventCreateWithFlags(&m_pinnedBufferDone[b], cudaEventDisableTiming));
+    }
+}
+
+JpegDecoder::~JpegDecoder()
+{
+    for (int b = 0; b < 2; ++b)
+    {
+        if (m_pinnedBufferDone[b])
+        {
+            cudaEventSynchronize(m_pinnedBufferDone[b]);
+            cudaEventDestroy(m_pinnedBufferDone[b]);
+        }
+        nvjpegJpegStreamDestroy(m_jpegStreams[b]);
+        nvjpegBufferPinnedDestroy(m_pinnedBuffers[b]);
+    }
+
+    nvjpegDecodeParamsDestroy(m_decodeParams);
+    nvjpegBufferDeviceDestroy(m_deviceBuffer);
+    nvjpegJpegStateDestroy(m_decoderState);
+    nvjpegDecoderDestroy(m_decoder);
+    nvjpegJpegStateDestroy(m_batchedState);
+    nvjpegDestroy(m_handle);
+}
+
+int JpegDecoder::maxBatchSize() const
+{
+    return m_maxBatchSize;
+}
+
+bool JpegDecoder::hardwareDecode() const
+{
+    return m_hardware;
+}
+
+std::shared_ptr<ImageBatchVarShape> JpegDecoder::decode(const std::vector<py::buffer> &bitstreams,
+                                                        std::shared_ptr<Stream>        stream)
+{
+    const int numImages = static_cast<int>(bitstreams.size());
+    if (numImages < 1 || numImages > m_maxBatchSize)
+    {
+        throw std::invalid_argument("Number of images must be between 1 and the maximum batch size "
+                                    + std::to_string(m_maxBatchSize));
+    }
+
+    if (!stream)
+    {
+        stream = Stream::Current().shared_from_this();
+    }
+
+    std::vector<py::buffer_info> infos;
+    for (const py::buffer &bitstream : bitstreams)
+    {
+        infos.push_back(bitstream.request());
+        if (infos.back().ndim != 1 || infos.back().itemsize != 1)
+        {
+            throw std::invalid_argument("JPEG bitstreams must be one-dimensional byte buffers");
+        }
+    }
+
+    std::shared_ptr<ImageBatchVarShape> batch = ImageBatchVarShape::Create(numImages);
+    batch->submitSync(*stream, LockMode::LOCK_WRITE);
+
+    std::vector<std::shared_ptr<Image>> images;
+
+    std::vector<const unsigned char *> batchedBitstreams, otherBitstreams;
+    std::vector<size_t>                batchedLengths, otherLengths;
+    std::vector<nvjpegImage_t>         batchedOutput, otherOutput;
+
+    for (const py::buffer_info &info : infos)
+    {
+        auto  *bitstream = static_cast<const unsigned char *>(info.ptr);
+        size_t length    = info.size;
+
+        int                       widths[NVJPEG_MAX_COMPONENT];
+        int                       heights[NVJPEG_MAX_COMPONENT];
+        int                       channels;
+        nvjpegChromaSubsampling_t subsampling;
+        CheckNvjpeg(nvjpegGetImageInfo(m_handle, bitstream, length, &channels, &subsampling, widths, heights),
+                    "nvjpegGetImageInfo");
+
+        // Cached images are written only once the work still using them is done
+        std::shared_ptr<Image> img = Image::Create({widths[0], heights[0]}, nvcv::FMT_RGB8);
+        img->submitSync(*stream, LockMode::LOCK_WRITE);
+        images.push_back(img);
+
+        auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(img->impl().exportData());
+        NVCV_ASSERT(data != nullptr);
+
+        nvjpegImage_t out = {};
+        out.channel[0]    = reinterpret_cast<unsigned char *>(data->plane(0).basePtr);
+        out.pitch[0]      = data->plane(0).rowStride;
+
+        int batchedSupported = -1;
+        if (m_hardware)
+        {
+            CheckNvjpeg(nvjpegJpegStreamParseHeader(m_handle, bitstream, length, m_jpegStreams[0]),
+                        "nvjpegJpegStreamParseHeader");
+            CheckNvjpeg(nvjpegDecodeBatchedSupported(m_handle, m_jpegStreams[0], &batchedSupported),
+                        "nvjpegDecodeBatchedSupported");
+        }
+
+        // 0 means supported
+        if (batchedSupported == 0)
+        {
+            batchedBitstreams.push_back(bitstream);
+            batchedLengths.push_back(length);
+            batchedOutput.push_back(out);
+        }
+        else
+        {
+            otherBitstreams.push_back(bitstream);
+            otherLengths.push_back(length);
+            otherOutput.push_back(out);
+        }
+    }
+
+    if (!batchedBitstreams.empty())
+    {
+        CheckNvjpeg(nvjpegDecodeBatchedInitialize(m_handle, m_batchedState, static_cast<int>(batchedBitstreams.size()),
+                                                  1, NVJPEG_OUTPUT_RGBI),
+                    "nvjpegDecodeBatchedInitialize");
+        CheckNvjpeg(nvjpegDecodeBatched(m_handle, m_batchedState, batchedBitstreams.data(), batchedLengths.data(),
+                                        batchedOutput.data(), stream->handle()),
+                    "nvjpegDecodeBatched");
+    }
+
+    for (size_t i = 0; i < otherBitstreams.size(); ++i)
+    {
+        const int b  = m_nextBuffer;
+        m_nextBuffer = 1 - m_nextBuffer;
+
+        // Only waits for the transfer from this pinned buffer, two images ago
+        util::CheckThrow(cudaEventSynchronize(m_pinnedBufferDone[b]));
+
+        CheckNvjpeg(nvjpegJpegStreamParse(m_handle, otherBitstreams[i], otherLengths[i], 0, 0, m_jpegStreams[b]),
+                    "nvjpegJpegStreamParse");
+        CheckNvjpeg(nvjpegStateAttachPinnedBuffer(m_decoderState, m_pinnedBuffers[b]),
+                    "nvjpegStateAttachPinnedBuffer");
+        CheckNvjpeg(nvjpegDecodeJpegHost(m_handle, m_decoder, m_decoderState, m_decodeParams, m_jpegStreams[b]),
+                    "nvjpegDecodeJpegHost");
+        CheckNvjpeg(nvjpegDecodeJpegTransferToDevice(m_handle, m_decoder, m_decoderState, m_jpegStreams[b],
+                                                     stream->handle()),
+                    "nvjpegDecodeJpegTransferToDevice");
+        util::CheckThrow(cudaEventRecord(m_pinnedBufferDone[b], stream->handle()));
+        CheckNvjpeg(nvjpegDecodeJpegDevice(m_handle, m_decoder, m_decoderState, &otherOutput[i], stream->handle()),
+                    "nvjpegDecodeJpegDevice");
+    }
+
+    for (const std::shared_ptr<Image> &img : images)
+    {
+        img->submitSignal(*stream, LockMode::LOCK_WRITE);
+    }
+
+    batch->pushBackMany(images);
+    batch->submitSignal(*stream, LockMode::LOCK_WRITE);
+
+    return batch;
+}
+
+void JpegDecoder::Export(py::module &m)
+{
+    using namespace py::literals;
+
+    py::class_<JpegDecoder, std::shared_ptr<JpegDecoder>>(m, "JpegDecoder",
+                                                          "Batched JPEG decoder producing image batches on the GPU.")
+        .def(py::init<int>(), "max_batch_size"_a)
+        .def("decode", &JpegDecoder::decode, "bitstreams"_a, py::kw_only(), "stream"_a = nullptr,
+             R"!(Decodes JPEG images into a new ImageBatchVarShape of RGB8 images.
+
+                 Decoding is enqueued on the stream without waiting for it to complete. The images
+                 supported by the hardware decoder are decoded in a single batched call.
+
+                 Args:
+                     bitstreams (list): JPEG files, as bytes or one-dimensional uint8 buffers.
+                     stream (Stream): Stream to decode on, defaults to the current stream.)!")
+        .def_property_readonly("max_batch_size", &JpegDecoder::maxBatchSize)
+        .def_property_readonly("hardware_decode", &JpegDecoder::hardwareDecode);
+}
+
+} // namespace nvcvpy::priv
@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_PYTHON_PRIV_JPEGDECODER_HPP
+#define NVCV_PYTHON_PRIV_JPEGDECODER_HPP
+
+#include "ImageBatch.hpp"
+#include "Stream.hpp"
+
+#include <cuda_runtime.h>
+#include <nvjpeg.h>
+#include <pybind11/pybind11.h>
+
+#include <memory>
+#include <vector>
+
+namespace nvcvpy::priv {
+
+namespace py = pybind11;
+
+// Decodes batches of JPEG images on the GPU into RGB8 images of an image
+// batch, with the hardware decoder when it supports them. The images and the
+// batch come from the cache, and their use is tracked like the outputs of
+// operators, so that decoding and pre-processing are ordered on the stream
+// without copies nor host synchronization.
+class JpegDecoder
+{
+public:
+    static void Export(py::module &m);
+
+    explicit JpegDecoder(int maxBatchSize);
+    ~JpegDecoder();
+
+    JpegDecoder(const JpegDecoder &) = delete;
+    JpegDecoder &operator=(const JpegDecoder &) = delete;
+
+    std::shared_ptr<ImageBatchVarShape> decode(const std::vector<py::buffer> &bitstreams,
+                                               std::shared_ptr<Stream>        stream);
+
+    int  maxBatchSize() const;
+    bool hardwareDecode() const;
+
+private:
+    int  m_maxBatchSize;
+    bool m_hardware = true;
+
+    nvjpegHandle_t    m_handle       = nullptr;
+    nvjpegJpegState_t m_batchedState = nullptr;
+
+    // Hybrid decoder for the images that the hardware decoder doesn't
+    // support, double buffered.
+    nvjpegJpegDecoder_t  m_decoder      = nullptr;
+    nvjpegJpegState_t    m_decoderState = nullptr;
+    nvjpegBufferPinned_t m_pinnedBuffers[2] = {};
+    nvjpegBufferDevice_t m_deviceBuffer     = nullptr;
+    nvjpegJpegStream_t   m_jpegStreams[2]   = {};
+    nvjpegDecodeParams_t m_decodeParams     = nullptr;
+    cudaEvent_t          m_pinnedBufferDone[2] = {};
+    int                  m_nextBuffer          = 0;
+};
+
+} // namespace nvcvpy::priv
+
+#endif // NVCV_PYTHON_PRIV_JPEGDECODER_HPP
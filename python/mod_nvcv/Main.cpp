@@ -15,25 +15,29 @@
  * limitations under the License.
  */
 
+#include "Allocator.hpp"
 #include "CAPI.hpp"
 #include "Cache.hpp"
 #include "Container.hpp"
 #include "DataType.hpp"
 #include "ExternalBuffer.hpp"
+#include "Graph.hpp"
 #include "Image.hpp"
 #include "ImageBatch.hpp"
 #include "ImageFormat.hpp"
+#include "JpegDecoder.hpp"
 #include "Rect.hpp"
 #include "Resource.hpp"
 #include "Stream.hpp"
 #include "Tensor.hpp"
 
+#include <common/PyUtil.hpp>
 #include <nvcv/Version.h>
 #include <pybind11/pybind11.h>
 
 namespace py = pybind11;
 
-PYBIND11_MODULE(nvcv, m)
+NVCV_PYBIND11_MODULE(nvcv, m)
 {
     m.doc() = R"pbdoc(
         NVCV Python API reference
@@ -48,10 +52,12 @@ PYBIND11_MODULE(nvcv, m)
 
     // Core entities
     Cache::Export(m);
+    ExportAllocator(m);
 
     {
         py::module_ cuda = m.def_submodule("cuda");
         Stream::Export(cuda);
+        Graph::Export(cuda);
     }
 
     ExternalBuffer::Export(m);
@@ -63,5 +69,6 @@ PYBIND11_MODULE(nvcv, m)
     Tensor::Export(m);
     Image::Export(m);
     ImageBatchVarShape::Export(m);
+    JpegDecoder::Export(m);
     ExportCAPI(m);
 }
@@ -22,34 +22,27 @@
 #include <common/Assert.hpp>
 #include <common/CheckError.hpp>
 
+#include <atomic>
 #include <iostream>
 
 namespace nvcvpy::priv {
 
 Resource::Resource()
 {
-    static uint64_t idnext = 0;
+    static std::atomic<uint64_t> idnext{0};
 
     m_id = idnext++;
 
-    m_readEvent = m_writeEvent = nullptr;
-    try
-    {
-        util::CheckThrow(cudaEventCreateWithFlags(&m_readEvent, cudaEventDisableTiming));
-        util::CheckThrow(cudaEventCreateWithFlags(&m_writeEvent, cudaEventDisableTiming));
-    }
-    catch (...)
-    {
-        cudaEventDestroy(m_readEvent);
-        cudaEventDestroy(m_writeEvent);
-        throw;
-    }
+    util::CheckThrow(cudaEventCreateWithFlags(&m_writeEvent, cudaEventDisableTiming));
 }
 
 Resource::~Resource()
 {
-    cudaEventDestroy(m_readEvent);
     cudaEventDestroy(m_writeEvent);
+    for (const StreamEvent &read : m_readEvents)
+    {
+        cudaEventDestroy(read.event);
+    }
 }
 
 uint64_t Resource::id() const
@@ -61,13 +54,42 @@ void Resource::submitSignal(Stream &stream, LockMode mode) const
 {
     doBeforeSubmitSignal(stream, mode);
 
-    if (mode & LOCK_READ)
+    // Captured work is tracked when the graph is launched
+    if (stream.isCapturing())
     {
-        util::CheckThrow(cudaEventRecord(m_readEvent, stream.handle()));
+        return;
     }
+
+    std::unique_lock lk(m_mtx);
+
     if (mode & LOCK_WRITE)
     {
+        // Writers have waited on all previous reads in submitSync, future
+        // users only need to wait on this write.
         util::CheckThrow(cudaEventRecord(m_writeEvent, stream.handle()));
+        m_writeStreamId = stream.id();
+        m_numReads      = 0;
+    }
+    else if (mode & LOCK_READ)
+    {
+        size_t idx = 0;
+        while (idx < m_numReads && m_readEvents[idx].streamId != stream.id())
+        {
+            ++idx;
+        }
+
+        if (idx == m_numReads)
+        {
+            if (m_numReads == m_readEvents.size())
+            {
+                cudaEvent_t event;
+                util::CheckThrow(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+                m_readEvents.push_back({stream.id(), event});
+            }
+            m_readEvents[m_numReads++].streamId = stream.id();
+        }
+
+        util::CheckThrow(cudaEventRecord(m_readEvents[idx].event, stream.handle()));
     }
 }
 
@@ -78,16 +100,45 @@ void Resource::submitSync(Stream &stream, LockMode mode) const
     doSubmitSync(stream, mode);
 }
 
+void Resource::submitSync(cudaStream_t stream, LockMode mode) const
+{
+    doSubmitSync(stream, std::nullopt, mode);
+}
+
 void Resource::doSubmitSync(Stream &stream, LockMode mode) const
 {
-    if (mode & LOCK_WRITE)
+    if (stream.isCapturing())
     {
-        util::CheckThrow(cudaStreamWaitEvent(stream.handle(), m_writeEvent));
-        util::CheckThrow(cudaStreamWaitEvent(stream.handle(), m_readEvent));
+        return;
     }
-    else if (mode & LOCK_READ)
+
+    doSubmitSync(stream.handle(), stream.id(), mode);
+}
+
+void Resource::doSubmitSync(cudaStream_t stream, std::optional<uint64_t> streamId, LockMode mode) const
+{
+    if (!(mode & (LOCK_READ | LOCK_WRITE)))
+    {
+        return;
+    }
+
+    std::unique_lock lk(m_mtx);
+
+    // Work submitted to the same stream is already ordered
+    if (m_writeStreamId && *m_writeStreamId != streamId)
+    {
+        util::CheckThrow(cudaStreamWaitEvent(stream, m_writeEvent));
+    }
+
+    if (mode & LOCK_WRITE)
     {
-        util::CheckThrow(cudaStreamWaitEvent(stream.handle(), m_writeEvent));
+        for (size_t i = 0; i < m_numReads; ++i)
+        {
+            if (m_readEvents[i].streamId != streamId)
+            {
+                util::CheckThrow(cudaStreamWaitEvent(stream, m_readEvents[i].event));
+            }
+        }
     }
 }
 
@@ -104,17 +155,42 @@ void Resource::doSync(LockMode mode) const
 {
     NVCV_ASSERT(PyGILState_Check() == 0);
 
-    if (mode & LOCK_WRITE)
+    // Don't block other threads using the resource while waiting
+    std::vector<cudaEvent_t> events;
     {
-        util::CheckThrow(cudaEventSynchronize(m_writeEvent));
-        util::CheckThrow(cudaEventSynchronize(m_readEvent));
+        std::unique_lock lk(m_mtx);
+
+        if (mode & (LOCK_READ | LOCK_WRITE))
+        {
+            events.push_back(m_writeEvent);
+        }
+
+        if (mode & LOCK_WRITE)
+        {
+            for (size_t i = 0; i < m_numReads; ++i)
+            {
+                events.push_back(m_readEvents[i].event);
+            }
+        }
     }
-    else if (mode & LOCK_READ)
+
+    for (cudaEvent_t event : events)
     {
-        util::CheckThrow(cudaEventSynchronize(m_writeEvent));
+        util::CheckThrow(cudaEventSynchronize(event));
     }
 }
 
+py::object Resource::ready() const
+{
+    // A stream from the cache only waits on this resource, so the future isn't
+    // delayed by unrelated work. It's kept in use until the wait is over.
+    std::shared_ptr<Stream> stream = Stream::Create();
+
+    submitSync(*stream, LOCK_READ);
+
+    return stream->completion();
+}
+
 std::shared_ptr<Resource> Resource::shared_from_this()
 {
     return std::dynamic_pointer_cast<Resource>(Object::shared_from_this());
@@ -130,7 +206,10 @@ void Resource::Export(py::module &m)
     py::class_<Resource, std::shared_ptr<Resource>>(m, "Resource")
         .def_property_readonly("id", &Resource::id, "Unique resource instance identifier")
         .def("submitSync", &Resource::submitSync)
-        .def("submitSignal", &Resource::submitSignal);
+        .def("submitSignal", &Resource::submitSignal)
+        .def("ready", &Resource::ready,
+             "Returns an awaitable that completes once pending writes to the resource are done. "
+             "Must be called from a running asyncio event loop.");
 }
 
 } // namespace nvcvpy::priv
@@ -25,9 +25,13 @@
 #include <pybind11/pybind11.h>
 
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
 
 // fwd declaration from driver_types.h
-typedef struct CUevent_st *cudaEvent_t;
+typedef struct CUevent_st  *cudaEvent_t;
+typedef struct CUstream_st *cudaStream_t;
 
 namespace nvcvpy::priv {
 namespace py = pybind11;
@@ -46,9 +50,17 @@ public:
     void submitSync(Stream &stream, LockMode mode) const;
     void submitSignal(Stream &stream, LockMode mode) const;
 
+    // Makes work on a stream not managed by us, e.g. of a consumer of
+    // exported data, wait on the pending work on the resource.
+    void submitSync(cudaStream_t stream, LockMode mode) const;
+
     // Assumes GIL is locked (is in acquired state)
     void sync(LockMode mode) const;
 
+    // Returns an asyncio future resolved once pending writes to the resource
+    // are done, see Stream::completion.
+    py::object ready() const;
+
     std::shared_ptr<Resource>       shared_from_this();
     std::shared_ptr<const Resource> shared_from_this() const;
 
@@ -56,6 +68,7 @@ protected:
     Resource();
 
     void doSubmitSync(Stream &stream, LockMode mode) const;
+    void doSubmitSync(cudaStream_t stream, std::optional<uint64_t> streamId, LockMode mode) const;
 
     // Assumes GIL is not locked (is in released state)
     void doSync(LockMode mode) const;
@@ -66,8 +79,28 @@ private:
     virtual void doBeforeSubmitSync(Stream &stream, LockMode mode) const {};
     virtual void doBeforeSubmitSignal(Stream &stream, LockMode mode) const {};
 
-    uint64_t    m_id;
-    cudaEvent_t m_readEvent, m_writeEvent;
+    uint64_t m_id;
+
+    // Stream-ordered dependency tracking. Writers wait on the last write and on
+    // every read done since then, readers only wait on the last write, on
+    // other streams.
+    struct StreamEvent
+    {
+        uint64_t    streamId;
+        cudaEvent_t event;
+    };
+
+    cudaEvent_t                     m_writeEvent;
+    mutable std::optional<uint64_t> m_writeStreamId; // stream of last write, if any
+
+    // Reads since last write, one entry per stream. Entries past m_numReads are
+    // kept so that their events can be reused.
+    mutable std::vector<StreamEvent> m_readEvents;
+    mutable size_t                   m_numReads = 0;
+
+    // Protects the tracking state above, the same resource might be used by
+    // several threads at once when the GIL is disabled.
+    mutable std::mutex m_mtx;
 };
 
 } // namespace nvcvpy::priv
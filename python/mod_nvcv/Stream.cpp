@@ -25,6 +25,16 @@
 #include <common/PyUtil.hpp>
 #include <common/String.hpp>
 #include <pybind11/operators.h>
+#include <pybind11/stl.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <mutex>
+#include <sstream>
+#include <system_error>
+#include <unordered_map>
 
 namespace nvcvpy::priv {
 
@@ -160,40 +170,218 @@ struct type_caster<priv::ExternalStream<priv::TORCH>>
 
 namespace nvcvpy::priv {
 
-// In terms of caching, all streams are the same.
-// Any stream in the cache can be fetched and used.
+namespace {
+
+// Number of calls whose resources are released by a single host function
+constexpr int kMaxPendingCalls = 16;
+
+// Resolves asyncio futures of one event loop when stream work they wait on is
+// done. CUDA host callbacks only queue the completion and write to an eventfd
+// watched by the loop, futures are then resolved in the loop's thread, no
+// thread is blocked per pending future.
+class AsyncNotifier
+{
+public:
+    AsyncNotifier()
+    {
+        m_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_fd < 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "Can't create eventfd");
+        }
+    }
+
+    ~AsyncNotifier()
+    {
+        if (!m_pending.empty())
+        {
+            // Might be destroyed by the last host callback, outside python.
+            py::gil_scoped_acquire gil;
+            m_pending.clear();
+        }
+        close(m_fd);
+    }
+
+    // Returns the notifier of the given loop, registering it into the loop
+    // if needed. Must be called from the loop's thread.
+    static std::shared_ptr<AsyncNotifier> ForLoop(py::object loop)
+    {
+        struct Entry
+        {
+            std::shared_ptr<AsyncNotifier> notifier;
+            py::object                     loopRef;
+        };
+
+        // Never destroyed, as its python objects can't outlive the interpreter.
+        static auto      *notifiers = new std::unordered_map<PyObject *, Entry>();
+        static std::mutex mtx;
+
+        {
+            std::unique_lock<std::mutex> lk(mtx);
+
+            auto it = notifiers->find(loop.ptr());
+            if (it != notifiers->end())
+            {
+                return it->second.notifier;
+            }
+        }
+
+        auto notifier = std::make_shared<AsyncNotifier>();
+        loop.attr("add_reader")(notifier->m_fd, py::cpp_function([notifier]() { notifier->drain(); }));
+
+        // Forget the notifier once the loop is gone, so that a new loop
+        // allocated at the same address doesn't reuse it.
+        PyObject  *key = loop.ptr();
+        py::object loopRef;
+        try
+        {
+            loopRef = py::weakref(loop, py::cpp_function(
+                                            [key](py::handle)
+                                            {
+                                                std::unique_lock<std::mutex> lk(mtx);
+                                                notifiers->erase(key);
+                                            }));
+        }
+        catch (py::error_already_set &)
+        {
+            // Loop doesn't support weak references, keep it alive instead.
+            loopRef = loop;
+        }
+
+        std::unique_lock<std::mutex> lk(mtx);
+        notifiers->emplace(key, Entry{notifier, std::move(loopRef)});
+        return notifier;
+    }
+
+    // Must be called from the loop's thread
+    uint64_t add(py::object future)
+    {
+        uint64_t id = m_nextId++;
+        m_pending.emplace(id, std::move(future));
+        return id;
+    }
+
+    // Must be called from the loop's thread
+    void remove(uint64_t id)
+    {
+        m_pending.erase(id);
+    }
+
+    // Called from CUDA host callbacks, GIL isn't locked.
+    void signal(uint64_t id, cudaError_t status)
+    {
+        {
+            std::unique_lock<std::mutex> lk(m_mtx);
+            m_done.push_back({id, status});
+        }
+
+        uint64_t one = 1;
+        while (write(m_fd, &one, sizeof(one)) < 0 && errno == EINTR)
+        {
+        }
+    }
+
+private:
+    struct Completion
+    {
+        uint64_t    id;
+        cudaError_t status;
+    };
+
+    int m_fd;
+
+    std::mutex              m_mtx;
+    std::vector<Completion> m_done; // protected by m_mtx
+
+    // Only accessed from the loop's thread
+    std::unordered_map<uint64_t, py::object> m_pending;
+    uint64_t                                 m_nextId = 0;
+
+    // Called by the event loop when the eventfd is readable.
+    void drain()
+    {
+        uint64_t count;
+        while (read(m_fd, &count, sizeof(count)) < 0 && errno == EINTR)
+        {
+        }
+
+        std::vector<Completion> done;
+        {
+            std::unique_lock<std::mutex> lk(m_mtx);
+            std::swap(done, m_done);
+        }
+
+        for (const Completion &c : done)
+        {
+            auto it = m_pending.find(c.id);
+            NVCV_ASSERT(it != m_pending.end());
+
+            py::object future = std::move(it->second);
+            m_pending.erase(it);
+
+            // Waiter might have given up on it already
+            if (future.attr("done")().cast<bool>())
+            {
+                continue;
+            }
+
+            if (c.status == cudaSuccess)
+            {
+                future.attr("set_result")(py::none());
+            }
+            else
+            {
+                std::ostringstream ss;
+                ss << cudaGetErrorName(c.status) << ": " << cudaGetErrorString(c.status);
+                future.attr("set_exception")(py::reinterpret_borrow<py::object>(PyExc_RuntimeError)(ss.str()));
+            }
+        }
+    }
+};
+
+} // namespace
+
+// In terms of caching, streams of the same priority are the same.
+// Any stream of the priority in the cache can be fetched and used.
 size_t Stream::Key::doGetHash() const
 {
-    return 0;
+    return std::hash<int>()(m_priority);
 }
 
-bool Stream::Key::doIsEqual(const IKey &that) const
+bool Stream::Key::doIsEqual(const IKey &ithat) const
 {
-    return true;
+    auto &that = static_cast<const Key &>(ithat);
+    return m_priority == that.m_priority;
 }
 
-std::shared_ptr<Stream> Stream::Create()
+std::shared_ptr<Stream> Stream::Create(std::optional<int> priority)
 {
-    std::vector<std::shared_ptr<CacheItem>> vcont = Cache::Instance().fetch(Stream::Key{});
+    // Lower numbers mean higher priorities, greatest <= least
+    int least, greatest;
+    util::CheckThrow(cudaDeviceGetStreamPriorityRange(&least, &greatest));
+
+    int effPriority = std::clamp(priority.value_or(least), greatest, least);
+
+    std::shared_ptr<CacheItem> cont = Cache::Instance().fetchAndClaim(Stream::Key{effPriority});
 
     // None found?
-    if (vcont.empty())
+    if (!cont)
     {
-        std::shared_ptr<Stream> stream(new Stream());
+        std::shared_ptr<Stream> stream(new Stream(effPriority));
         Cache::Instance().add(*stream);
         return stream;
     }
     else
     {
-        // Get the first one
-        return std::static_pointer_cast<Stream>(vcont[0]);
+        return std::static_pointer_cast<Stream>(cont);
     }
 }
 
-Stream::Stream()
+Stream::Stream(int priority)
     : m_owns(true)
+    , m_key(priority)
 {
-    util::CheckThrow(cudaStreamCreate(&m_handle));
+    util::CheckThrow(cudaStreamCreateWithPriority(&m_handle, cudaStreamDefault, priority));
 }
 
 Stream::Stream(IExternalStream &extStream)
@@ -206,15 +394,24 @@ Stream::Stream(IExternalStream &extStream)
     {
         throw std::runtime_error("Invalid cuda stream");
     }
+
+    // Not in the cache, only reported
+    m_key = Key{this->priority()};
 }
 
 Stream::~Stream()
 {
     if (m_owns)
     {
+        // Pending resources are released along with the stream, once synced
         util::CheckLog(cudaStreamSynchronize(m_handle));
         util::CheckLog(cudaStreamDestroy(m_handle));
     }
+    else
+    {
+        // The external stream lives on, its work still needs them
+        util::CheckLog(flushResources());
+    }
 }
 
 std::shared_ptr<Stream> Stream::shared_from_this()
@@ -232,6 +429,13 @@ cudaStream_t Stream::handle() const
     return m_handle;
 }
 
+int Stream::priority() const
+{
+    int priority;
+    util::CheckThrow(cudaStreamGetPriority(m_handle, &priority));
+    return priority;
+}
+
 intptr_t Stream::pyhandle() const
 {
     return reinterpret_cast<intptr_t>(m_handle);
@@ -239,16 +443,82 @@ intptr_t Stream::pyhandle() const
 
 void Stream::sync()
 {
+    // Resources held by work submitted from other threads while the GIL is
+    // released must stay pending.
+    ResourceSet resources = std::move(m_pendingResources);
+    m_pendingResources.clear();
+    m_pendingCalls = 0;
+
     py::gil_scoped_release release;
 
-    util::CheckThrow(cudaStreamSynchronize(m_handle));
+    cudaError_t err = cudaStreamSynchronize(m_handle);
+    if (err != cudaSuccess)
+    {
+        py::gil_scoped_acquire acquire;
+        m_pendingResources.merge(resources);
+        util::CheckThrow(err);
+    }
+}
+
+py::object Stream::completion()
+{
+    if (m_capturedResources)
+    {
+        throw std::runtime_error("Stream completion can't be awaited while the stream is being captured");
+    }
+
+    py::object loop = py::module_::import("asyncio").attr("get_running_loop")();
+
+    std::shared_ptr<AsyncNotifier> notifier = AsyncNotifier::ForLoop(loop);
+
+    py::object future = loop.attr("create_future")();
+
+    struct HostFunctionClosure
+    {
+        // Streams fetched from the cache must stay in use until the callback.
+        std::shared_ptr<const Stream>  stream;
+        std::shared_ptr<AsyncNotifier> notifier;
+        uint64_t                       id;
+        ResourceSet                    resources;
+    };
+
+    auto closure = std::make_unique<HostFunctionClosure>();
+
+    closure->stream   = this->shared_from_this();
+    closure->notifier = notifier;
+    closure->id       = notifier->add(future);
+
+    // The callback also flushes the pending resources
+    closure->resources = std::move(m_pendingResources);
+    m_pendingResources.clear();
+    m_pendingCalls = 0;
+
+    // Unlike cudaLaunchHostFunc, the callback also runs when the stream is in
+    // error, the future gets the error instead of never being resolved.
+    auto fn = [](cudaStream_t stream, cudaError_t error, void *userData) -> void
+    {
+        auto *pclosure = reinterpret_cast<HostFunctionClosure *>(userData);
+        pclosure->notifier->signal(pclosure->id, error);
+        delete pclosure;
+    };
+
+    cudaError_t err = cudaStreamAddCallback(m_handle, fn, closure.get(), 0);
+    if (err != cudaSuccess)
+    {
+        notifier->remove(closure->id);
+        m_pendingResources.merge(closure->resources);
+        util::CheckThrow(err);
+    }
+
+    closure.release();
+    return future;
 }
 
 Stream &Stream::Current()
 {
-    auto defStream = StreamStack::Instance().top();
-    NVCV_ASSERT(defStream);
-    return *defStream;
+    Stream *stream = StreamStack::Instance().topPtr();
+    NVCV_ASSERT(stream);
+    return *stream;
 }
 
 void Stream::activate()
@@ -259,34 +529,127 @@ void Stream::activate()
 void Stream::deactivate(py::object exc_type, py::object exc_value, py::object exc_tb)
 {
     StreamStack::Instance().pop();
+    util::CheckThrow(flushResources());
 }
 
 void Stream::holdResources(LockResources usedResources)
 {
+    if (m_capturedResources)
+    {
+        // The graph being captured will hold them
+        m_capturedResources->merge(usedResources);
+        return;
+    }
+
+    if (usedResources.empty())
+    {
+        return;
+    }
+
+    // Resources used by consecutive calls are mostly the same, they're only
+    // held once per batch.
+    for (auto &[mode, resource] : usedResources)
+    {
+        m_pendingResources.insert(std::move(resource));
+    }
+
+    if (++m_pendingCalls >= kMaxPendingCalls)
+    {
+        util::CheckThrow(flushResources());
+    }
+}
+
+cudaError_t Stream::flushResources()
+{
+    // Work submitted while capturing is in the graph, flushing would add the
+    // host function to it too.
+    if (m_pendingResources.empty() || m_capturedResources)
+    {
+        return cudaSuccess;
+    }
+
     struct HostFunctionClosure
     {
-        // Also hold the stream reference so that it isn't destroyed before the processing is done.
-        std::shared_ptr<const Stream> stream;
-        LockResources                 resources;
+        ResourceSet resources;
     };
 
-    if (!usedResources.empty())
+    auto closure = std::make_unique<HostFunctionClosure>();
+
+    closure->resources = std::move(m_pendingResources);
+    m_pendingResources.clear();
+    m_pendingCalls = 0;
+
+    auto fn = [](void *userData) -> void
     {
-        auto closure = std::make_unique<HostFunctionClosure>();
+        auto *pclosure = reinterpret_cast<HostFunctionClosure *>(userData);
+        delete pclosure;
+    };
 
-        closure->stream    = this->shared_from_this();
-        closure->resources = std::move(usedResources);
+    cudaError_t err = cudaLaunchHostFunc(m_handle, fn, closure.get());
+    if (err != cudaSuccess)
+    {
+        // They're released when the stream is synced instead
+        m_pendingResources = std::move(closure->resources);
+        return err;
+    }
 
-        auto fn = [](cudaStream_t stream, cudaError_t error, void *userData) -> void
-        {
-            auto *pclosure = reinterpret_cast<HostFunctionClosure *>(userData);
-            delete pclosure;
-        };
+    closure.release();
+    return cudaSuccess;
+}
 
-        util::CheckThrow(cudaStreamAddCallback(m_handle, fn, closure.get(), 0));
+bool Stream::isCapturing() const
+{
+    return m_capturedResources.has_value();
+}
 
-        closure.release();
+void Stream::beginCapture()
+{
+    if (m_capturedResources)
+    {
+        throw std::runtime_error("Stream is already being captured");
+    }
+    if (m_handle == 0)
+    {
+        throw std::runtime_error("The default stream can't be captured, a user stream must be used instead");
+    }
+
+    // Resources of the work submitted so far aren't the graph's to hold
+    util::CheckThrow(flushResources());
+
+    // Relaxed mode, as operators might allocate memory while being captured.
+    util::CheckThrow(cudaStreamBeginCapture(m_handle, cudaStreamCaptureModeRelaxed));
+    m_capturedResources.emplace();
+}
+
+LockResources Stream::endCapture(cudaGraph_t *graph)
+{
+    NVCV_ASSERT(m_capturedResources);
+
+    LockResources resources = std::move(*m_capturedResources);
+    m_capturedResources.reset();
+
+    cudaGraph_t capturedGraph = nullptr;
+    cudaError_t err           = cudaStreamEndCapture(m_handle, &capturedGraph);
+
+    if (graph != nullptr && err == cudaSuccess)
+    {
+        *graph = capturedGraph;
+    }
+    else if (capturedGraph != nullptr)
+    {
+        cudaGraphDestroy(capturedGraph);
+    }
+
+    if (graph == nullptr)
+    {
+        // Capture is being discarded, most likely because of an earlier error
+        util::CheckLog(err);
+    }
+    else
+    {
+        util::CheckThrow(err);
     }
+    return resources;
 }
 
 std::ostream &operator<<(std::ostream &out, const Stream &stream)
@@ -305,13 +668,22 @@ void Stream::Export(py::module &m)
     py::class_<Stream, std::shared_ptr<Stream>> stream(m, "Stream");
 
     stream.def_property_readonly_static("current", [](py::object) { return Current().shared_from_this(); })
-        .def(py::init(&Stream::Create));
+        .def(py::init(&Stream::Create), py::arg("priority") = std::nullopt,
+             "Creates a stream of the given CUDA priority, lower numbers meaning higher priorities, e.g. "
+             "nvcv.cuda.Stream.priority_range[1] for latency-critical work. Defaults to the least priority.")
+        .def_property_readonly_static("priority_range",
+                                      [](py::object)
+                                      {
+                                          int least, greatest;
+                                          util::CheckThrow(cudaDeviceGetStreamPriorityRange(&least, &greatest));
+                                          return std::make_pair(least, greatest);
+                                      });
 
     // Create the global stream object by wrapping cuda stream 0.
     // It'll be destroyed when python module is deinitialized.
     static priv::ExternalStream<priv::VOIDP> cudaDefaultStream((cudaStream_t)0);
     auto                                     globalStream = std::make_shared<Stream>(cudaDefaultStream);
-    StreamStack::Instance().push(*globalStream);
+    StreamStack::SetDefault(globalStream);
     stream.attr("default") = globalStream;
 
     // Order from most specific to less specific
@@ -322,9 +694,13 @@ void Stream::Export(py::module &m)
     stream.def("__enter__", &Stream::activate)
         .def("__exit__", &Stream::deactivate)
         .def("sync", &Stream::sync)
+        .def("completion", &Stream::completion,
+             "Returns an awaitable that completes once work submitted so far to the stream is done. "
+             "Must be called from a running asyncio event loop.")
         .def("__int__", &Stream::pyhandle)
         .def("__repr__", &util::ToString<Stream>)
         .def_property_readonly("handle", &Stream::pyhandle)
+        .def_property_readonly("priority", &Stream::priority)
         .def_property_readonly("id", &Stream::id);
 
     // Make sure all streams we've created are synced when script ends.
@@ -338,19 +714,18 @@ void Stream::Export(py::module &m)
                               }
                               globalStream->sync();
 
-                              // There should only be 1 stream in the stack, namely the
-                              // global stream.
-                              auto s = StreamStack::Instance().top();
-                              if (s != globalStream)
+                              // All activated streams should have been deactivated.
+                              if (!StreamStack::Instance().empty())
                               {
                                   std::cerr << "Stream stack leak detected" << std::endl;
                               }
 
                               // Make sure stream stack is empty
-                              while (auto s = StreamStack::Instance().top())
+                              while (!StreamStack::Instance().empty())
                               {
                                   StreamStack::Instance().pop();
                               }
+                              StreamStack::SetDefault(nullptr);
                           });
 }
 
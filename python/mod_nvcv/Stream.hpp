@@ -26,7 +26,9 @@
 
 #include <initializer_list>
 #include <memory>
+#include <optional>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace nvcvpy::priv {
@@ -49,7 +51,10 @@ public:
 
     static Stream &Current();
 
-    static std::shared_ptr<Stream> Create();
+    // Streams of the given CUDA priority, lower numbers meaning higher
+    // priorities, clamped to the device's range. Without one, streams get the
+    // least priority, the default of CUDA.
+    static std::shared_ptr<Stream> Create(std::optional<int> priority = std::nullopt);
 
     ~Stream();
 
@@ -59,10 +64,26 @@ public:
     void activate();
     void deactivate(py::object exc_type, py::object exc_value, py::object exc_tb);
 
+    // Resources used by submitted work are kept alive until the work is done.
+    // They're batched and released all at once by a single host function per
+    // flush, enqueued every few calls, or when the stream is synced, awaited,
+    // deactivated or captured.
     void holdResources(LockResources usedResources);
 
+    // While the stream is being captured into a graph, resources used by the
+    // submitted work are collected instead of being tracked with events.
+    bool          isCapturing() const;
+    void          beginCapture();
+    LockResources endCapture(cudaGraph_t *graph);
+
     void         sync();
     cudaStream_t handle() const;
+    int          priority() const;
+
+    // Returns an asyncio future of the running event loop, resolved once the
+    // work submitted so far to the stream is done. No thread is blocked while
+    // waiting on it.
+    py::object completion();
 
     // Returns the cuda handle in python
     intptr_t pyhandle() const;
@@ -73,24 +94,41 @@ public:
 
 private:
     Stream(Stream &&) = delete;
-    Stream();
+    explicit Stream(int priority);
 
     class Key final : public IKey
     {
+    public:
+        explicit Key(int priority = 0)
+            : m_priority(priority)
+        {
+        }
+
     private:
+        int m_priority;
+
         virtual size_t doGetHash() const override;
         virtual bool   doIsEqual(const IKey &that) const override;
     };
 
     virtual const Key &key() const override
     {
-        static Key key;
-        return key;
+        return m_key;
     }
 
+    using ResourceSet = std::unordered_set<std::shared_ptr<const Resource>>;
+
+    cudaError_t flushResources();
+
     bool         m_owns;
     cudaStream_t m_handle;
+    Key          m_key;
     py::object   m_wrappedObj;
+
+    std::optional<LockResources> m_capturedResources;
+
+    ResourceSet m_pendingResources;
+    int         m_pendingCalls = 0;
 };
 
 } // namespace nvcvpy::priv
@@ -19,37 +19,70 @@
 
 #include "Stream.hpp"
 
+#include <pybind11/pybind11.h>
+
 namespace nvcvpy::priv {
 
+std::mutex            StreamStack::m_defaultMtx;
+std::weak_ptr<Stream> StreamStack::m_default;
+std::atomic<Stream *> StreamStack::m_defaultPtr{nullptr};
+
 void StreamStack::push(Stream &stream)
 {
-    std::unique_lock lk(m_mtx);
-    m_stack.push(stream.shared_from_this());
+    m_stack.emplace(stream.shared_from_this(), &stream);
 }
 
 void StreamStack::pop()
 {
-    std::unique_lock lk(m_mtx);
     m_stack.pop();
 }
 
+bool StreamStack::empty() const
+{
+    return m_stack.empty();
+}
+
 std::shared_ptr<Stream> StreamStack::top()
 {
-    std::unique_lock lk(m_mtx);
     if (!m_stack.empty())
     {
-        return m_stack.top().lock();
+        return m_stack.top().first.lock();
     }
     else
     {
-        return nullptr;
+        std::unique_lock lk(m_defaultMtx);
+        return m_default.lock();
+    }
+}
+
+Stream *StreamStack::topPtr() const
+{
+    if (m_stack.empty())
+    {
+        return m_defaultPtr.load(std::memory_order_acquire);
     }
+
+    auto &[stream, ptr] = m_stack.top();
+    return stream.expired() ? nullptr : ptr;
 }
 
 StreamStack &StreamStack::Instance()
 {
+#ifdef Py_GIL_DISABLED
+    // Threads run at once, activating streams in one mustn't change the current stream of the others
+    thread_local StreamStack stack;
+#else
+    // The GIL serializes the threads, a stream activated in one is current in all of them
     static StreamStack stack;
+#endif
     return stack;
 }
 
+void StreamStack::SetDefault(std::shared_ptr<Stream> stream)
+{
+    std::unique_lock lk(m_defaultMtx);
+    m_defaultPtr.store(stream.get(), std::memory_order_release);
+    m_default = std::move(stream);
+}
+
 } // namespace nvcvpy::priv
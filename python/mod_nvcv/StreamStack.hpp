@@ -18,27 +18,48 @@
 #ifndef NVCV_PYTHON_PRIV_STREAMSTACK_HPP
 #define NVCV_PYTHON_PRIV_STREAMSTACK_HPP
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <stack>
+#include <utility>
 
 namespace nvcvpy::priv {
 
 class Stream;
 
+// Streams activated with 'with stream:' are kept in a stack. In free-threaded
+// python builds they're only current in the thread that activated them, each
+// thread has its own stack, otherwise all threads share one. When it's empty,
+// the default stream shared by all threads is used.
 class StreamStack
 {
 public:
     void                    push(Stream &stream);
     void                    pop();
+    bool                    empty() const;
     std::shared_ptr<Stream> top();
 
+    // Same as top, without locking nor reference counting, for the stream to
+    // be used right away by the calling thread. Returns nullptr if the stream
+    // activated last was destroyed.
+    Stream *topPtr() const;
+
+    // Stack of the calling thread, or the one of all threads with the GIL
     static StreamStack &Instance();
 
+    static void SetDefault(std::shared_ptr<Stream> stream);
+
 private:
-    std::stack<std::weak_ptr<Stream>> m_stack;
-    std::weak_ptr<Stream>             m_cur;
-    std::mutex                        m_mtx;
+    // Streams aren't kept alive by being active, the raw pointer is only used
+    // while the weak one hasn't expired.
+    std::stack<std::pair<std::weak_ptr<Stream>, Stream *>> m_stack;
+
+    static std::mutex            m_defaultMtx;
+    static std::weak_ptr<Stream> m_default;
+
+    // The default stream is kept alive until it's reset
+    static std::atomic<Stream *> m_defaultPtr;
 };
 
 } // namespace nvcvpy::priv
@@ -17,20 +17,27 @@
 
 #include "Tensor.hpp"
 
+#include "Allocator.hpp"
 #include "DataType.hpp"
 #include "ExternalBuffer.hpp"
 #include "Image.hpp"
 #include "ImageFormat.hpp"
+#include "Stream.hpp"
 
 #include <common/Assert.hpp>
 #include <common/CheckError.hpp>
 #include <common/Hash.hpp>
 #include <common/PyUtil.hpp>
 #include <common/String.hpp>
+#include <nvcv/Ipc.hpp>
 #include <nvcv/TensorShapeInfo.hpp>
+#include <nvcv/Transfer.hpp>
+#include <nvcv/alloc/Requirements.hpp>
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
+
 namespace nvcv {
 
 static size_t ComputeHash(const nvcv::TensorShape &shape)
@@ -43,44 +50,76 @@ static size_t ComputeHash(const nvcv::TensorShape &shape)
 
 namespace nvcvpy::priv {
 
-std::shared_ptr<Tensor> Tensor::CreateForImageBatch(int numImages, const Size2D &size, nvcv::ImageFormat fmt)
+std::shared_ptr<Tensor> Tensor::CreateForImageBatch(int numImages, const Size2D &size, nvcv::ImageFormat fmt,
+                                                    int32_t rowAlign)
 {
-    nvcv::Tensor::Requirements reqs
-        = nvcv::Tensor::CalcRequirements(numImages, nvcv::Size2D{std::get<0>(size), std::get<1>(size)}, fmt);
+    nvcv::Tensor::Requirements reqs = nvcv::Tensor::CalcRequirements(
+        numImages, nvcv::Size2D{std::get<0>(size), std::get<1>(size)}, fmt, nvcv::MemAlignment{}.rowAddr(rowAlign));
     return CreateFromReqs(reqs);
 }
 
-std::shared_ptr<Tensor> Tensor::Create(Shape shape, nvcv::DataType dtype, std::optional<nvcv::TensorLayout> layout)
+std::shared_ptr<Tensor> Tensor::Create(Shape shape, nvcv::DataType dtype, std::optional<nvcv::TensorLayout> layout,
+                                       int32_t rowAlign)
 {
     if (!layout)
     {
         layout = nvcv::TENSOR_NONE;
     }
 
-    nvcv::Tensor::Requirements reqs = nvcv::Tensor::CalcRequirements(CreateNVCVTensorShape(shape, *layout), dtype);
+    nvcv::Tensor::Requirements reqs = nvcv::Tensor::CalcRequirements(CreateNVCVTensorShape(shape, *layout), dtype,
+                                                                     nvcv::MemAlignment{}.rowAddr(rowAlign));
     return CreateFromReqs(reqs);
 }
 
 std::shared_ptr<Tensor> Tensor::CreateFromReqs(const nvcv::Tensor::Requirements &reqs)
 {
-    std::vector<std::shared_ptr<CacheItem>> vcont = Cache::Instance().fetch(Key{reqs});
+    std::shared_ptr<CacheItem> cont = Cache::Instance().fetchAndClaim(Key{reqs});
 
     // None found?
-    if (vcont.empty())
+    if (!cont)
     {
-        std::shared_ptr<Tensor> tensor(new Tensor(reqs));
+        std::shared_ptr<Tensor> tensor = Cache::Instance().allocate(
+            [&reqs] { return std::shared_ptr<Tensor>(new Tensor(reqs)); });
         Cache::Instance().add(*tensor);
         return tensor;
     }
     else
     {
-        // Get the first one
-        auto tensor = std::static_pointer_cast<Tensor>(vcont[0]);
+        auto tensor = std::static_pointer_cast<Tensor>(cont);
         NVCV_ASSERT(tensor->dtype() == reqs.dtype);
         return tensor;
     }
 }
 
+void Tensor::Reserve(Shape shape, nvcv::DataType dtype, std::optional<nvcv::TensorLayout> layout, int count,
+                     int32_t rowAlign)
+{
+    if (count < 0)
+    {
+        throw std::invalid_argument(util::FormatString("Number of tensors must be >= 0, not %d", count));
+    }
+
+    if (!layout)
+    {
+        layout = nvcv::TENSOR_NONE;
+    }
+
+    nvcv::Tensor::Requirements reqs = nvcv::Tensor::CalcRequirements(CreateNVCVTensorShape(shape, *layout), dtype,
+                                                                     nvcv::MemAlignment{}.rowAddr(rowAlign));
+
+    // Hold them until all are created, or else they'd be fetched from the
+    // cache instead of being allocated.
+    std::vector<std::shared_ptr<Tensor>> tensors;
+    tensors.reserve(count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        tensors.push_back(
+            Cache::Instance().allocate([&reqs] { return std::shared_ptr<Tensor>(new Tensor(reqs)); }));
+        Cache::Instance().add(*tensors.back(), true);
+    }
+}
+
 namespace {
 
 NVCVTensorData FillNVCVTensorData(const DLTensor &tensor, std::optional<nvcv::TensorLayout> layout,
@@ -149,12 +188,28 @@ std::shared_ptr<Tensor> Tensor::Wrap(ExternalBuffer &buffer, std::optional<nvcv:
 
     nvcv::TensorDataStridedCuda data{FillNVCVTensorDataCUDA(dlTensor, std::move(layout))};
 
-    // This is the key of a tensor wrapper.
-    // All tensor wrappers have the same key.
-    Tensor::Key key;
+    // Buffers wrapped at every iteration, e.g. persistent framework
+    // allocations, get the same wrapper as last time if it isn't in use.
+    Tensor::Key key{data};
+
+    if (std::shared_ptr<CacheItem> cont = Cache::Instance().fetchAndClaim(key))
+    {
+        auto tensor = std::static_pointer_cast<Tensor>(cont);
+
+        // The new buffer object keeps the same memory alive, let go of the old one.
+        tensor->m_wrappedObject = py::cast(buffer.shared_from_this());
+        return tensor;
+    }
+
     // We take this opportunity to remove from cache all wrappers that aren't
-    // being used. They aren't reusable anyway.
-    Cache::Instance().removeAllNotInUseMatching(key);
+    // being used, so that they don't keep external memory alive.
+    Cache::Instance().removeAllNotInUseMatching(Tensor::Key{});
+    Cache::Instance().removeAllNotInUseIf(
+        [](const CacheItem &item)
+        {
+            auto *tensor = dynamic_cast<const Tensor *>(&item);
+            return tensor != nullptr && tensor->key().wrapsExternalBuffer();
+        });
 
     auto tensor = std::shared_ptr<Tensor>(new Tensor(data, py::cast(buffer.shared_from_this())));
 
@@ -176,15 +231,34 @@ std::shared_ptr<Tensor> Tensor::WrapImage(Image &img)
     return tensor;
 }
 
+std::shared_ptr<Tensor> Tensor::ImportIpc(py::bytes ipc, std::shared_ptr<Stream> stream)
+{
+    if (!stream)
+    {
+        stream = Stream::Current().shared_from_this();
+    }
+
+    auto ipcHandle = util::FromBytes<NVCVTensorIpcHandle>(ipc);
+
+    Tensor::Key key;
+    Cache::Instance().removeAllNotInUseMatching(key);
+
+    auto tensor = std::shared_ptr<Tensor>(new Tensor(ipcHandle, *stream));
+
+    Cache::Instance().add(*tensor);
+    return tensor;
+}
+
 Tensor::Tensor(const nvcv::Tensor::Requirements &reqs)
-    : m_impl{std::make_unique<nvcv::Tensor>(reqs)}
+    : m_impl{std::make_unique<nvcv::Tensor>(reqs, CurrentAllocator())}
     , m_key{reqs}
+    , m_sizeBytes{nvcv::CalcTotalSizeBytes(nvcv::Requirements{reqs.mem}.cudaMem())}
 {
 }
 
-Tensor::Tensor(const nvcv::ITensorData &data, py::object wrappedObject)
+Tensor::Tensor(const nvcv::ITensorDataStrided &data, py::object wrappedObject)
     : m_impl{std::make_unique<nvcv::TensorWrapData>(data)}
-    , m_key{}
+    , m_key{data}
     , m_wrappedObject(wrappedObject)
 {
 }
@@ -196,6 +270,19 @@ Tensor::Tensor(Image &img)
 {
 }
 
+Tensor::Tensor(const NVCVTensorIpcHandle &ipc, Stream &stream)
+    : m_impl{std::make_unique<nvcv::TensorWrapIpc>(ipc, stream.handle())}
+    , m_key{}
+{
+}
+
+Tensor::Tensor(const nvcv::ITensorDataStrided &data, std::shared_ptr<Tensor> parent)
+    : m_impl{std::make_unique<nvcv::TensorWrapData>(data)}
+    , m_key{}
+    , m_parent(std::move(parent))
+{
+}
+
 std::shared_ptr<Tensor> Tensor::shared_from_this()
 {
     return std::static_pointer_cast<Tensor>(Container::shared_from_this());
@@ -247,6 +334,7 @@ int Tensor::rank() const
 Tensor::Key::Key(const nvcv::Tensor::Requirements &reqs)
     : Key(nvcv::TensorShape(reqs.shape, reqs.rank, reqs.layout), static_cast<nvcv::DataType>(reqs.dtype))
 {
+    std::copy_n(reqs.strides, reqs.rank, m_strides.begin());
 }
 
 Tensor::Key::Key(const nvcv::TensorShape &shape, nvcv::DataType dtype)
@@ -256,15 +344,36 @@ Tensor::Key::Key(const nvcv::TensorShape &shape, nvcv::DataType dtype)
 {
 }
 
+Tensor::Key::Key(const nvcv::ITensorDataStrided &data)
+    : m_shape(data.shape())
+    , m_dtype(data.dtype())
+    , m_wrapper(true)
+    , m_basePtr(data.basePtr())
+{
+    for (int d = 0; d < data.rank(); ++d)
+    {
+        m_strides[d] = data.stride(d);
+    }
+}
+
+bool Tensor::Key::wrapsExternalBuffer() const
+{
+    return m_wrapper && m_basePtr != nullptr;
+}
+
 size_t Tensor::Key::doGetHash() const
 {
-    if (m_wrapper)
+    using util::ComputeHash;
+    if (m_wrapper && m_basePtr == nullptr)
     {
-        return 0; // all wrappers are equal wrt. the cache
+        return 0; // all other wrappers are equal wrt. the cache
+    }
+    else if (m_wrapper)
+    {
+        return ComputeHash(reinterpret_cast<uintptr_t>(m_basePtr), m_shape, m_dtype);
     }
     else
     {
-        using util::ComputeHash;
         return ComputeHash(m_shape, m_dtype);
     }
 }
@@ -273,12 +382,14 @@ bool Tensor::Key::doIsEqual(const IKey &that_) const
 {
     const Key &that = static_cast<const Key &>(that_);
 
-    // Wrapper key's all compare equal, are they can't be used
-    // and whenever we query the cache for wrappers, we really
+    // Wrappers of images and of imported memory all compare equal, as they
+    // can't be reused and whenever we query the cache for them, we really
     // want to get them all (as long as they aren't being used).
+    // Wrappers of external buffers are equal if they wrap the same data.
     if (m_wrapper && that.m_wrapper)
     {
-        return true;
+        return std::tie(m_basePtr, m_shape, m_dtype, m_strides)
+            == std::tie(that.m_basePtr, that.m_shape, that.m_dtype, that.m_strides);
     }
     else if (m_wrapper || that.m_wrapper) // xor
     {
@@ -286,7 +397,7 @@ bool Tensor::Key::doIsEqual(const IKey &that_) const
     }
     else
     {
-        return std::tie(m_shape, m_dtype) == std::tie(that.m_shape, that.m_dtype);
+        return std::tie(m_shape, m_dtype, m_strides) == std::tie(that.m_shape, that.m_dtype, that.m_strides);
     }
 }
 
@@ -322,6 +433,488 @@ py::object Tensor::cuda() const
     return ToPython(*tensorData, py::cast(this->shared_from_this()));
 }
 
+void Tensor::upload(py::buffer array, std::shared_ptr<Stream> stream)
+{
+    if (!stream)
+    {
+        stream = Stream::Current().shared_from_this();
+    }
+
+    py::buffer_info info = array.request();
+    if (info.itemsize != ToDType(this->dtype()).itemsize())
+    {
+        throw std::invalid_argument(
+            util::FormatString("Array item size %ld doesn't match the tensor data type", (long)info.itemsize));
+    }
+
+    // Only C-contiguous arrays have the packed layout the transfer expects.
+    int64_t packedStride = info.itemsize;
+    for (int i = info.ndim - 1; i >= 0; --i)
+    {
+        if (info.shape[i] > 1 && info.strides[i] != packedStride)
+        {
+            throw std::invalid_argument("Array must be C-contiguous");
+        }
+        packedStride *= info.shape[i];
+    }
+
+    // Sources still read by pending work must not be overwritten
+    this->submitSync(*stream, LOCK_WRITE);
+    {
+        py::gil_scoped_release release;
+        nvcv::Upload(*m_impl, info.ptr, info.size * info.itemsize, stream->handle());
+    }
+    this->submitSignal(*stream, LOCK_WRITE);
+}
+
+py::array Tensor::download(std::shared_ptr<Stream> stream) const
+{
+    if (!stream)
+    {
+        stream = Stream::Current().shared_from_this();
+    }
+
+    const nvcv::TensorShape &tshape = m_impl->shape();
+
+    std::vector<py::ssize_t> shape;
+    for (int i = 0; i < tshape.rank(); ++i)
+    {
+        shape.push_back(tshape[i]);
+    }
+    py::array out(ToDType(this->dtype()), shape);
+
+    this->submitSync(*stream, LOCK_READ);
+    {
+        py::gil_scoped_release release;
+        nvcv::Download(*m_impl, out.mutable_data(), out.nbytes(), stream->handle());
+    }
+    this->submitSignal(*stream, LOCK_READ);
+
+    return out;
+}
+
+py::bytes Tensor::exportIpc(std::shared_ptr<Stream> stream) const
+{
+    if (!stream)
+    {
+        stream = Stream::Current().shared_from_this();
+    }
+
+    // The exported event must come after all pending writes to the tensor
+    this->submitSync(*stream, LOCK_READ);
+    NVCVTensorIpcHandle ipc = nvcv::ExportIpc(*m_impl, stream->handle());
+    this->submitSignal(*stream, LOCK_READ);
+
+    return util::ToBytes(ipc);
+}
+
+py::capsule Tensor::dlpack(py::object stream) const
+{
+    // Stream semantics as defined by the DLPack protocol for CUDA devices:
+    // the producer makes the consumer's stream wait on all pending work on
+    // the tensor, so that the consumer doesn't have to synchronize.
+    std::optional<cudaStream_t> consumerStream;
+    if (stream.is_none())
+    {
+        consumerStream = cudaStreamLegacy;
+    }
+    else
+    {
+        intptr_t s = stream.cast<intptr_t>();
+        switch (s)
+        {
+        case -1: // consumer synchronizes by itself
+            break;
+        case 0:
+            throw std::invalid_argument("Stream 0 is ambiguous, use 1 for the legacy default stream "
+                                        "or 2 for the per-thread default stream");
+        case 1:
+            consumerStream = cudaStreamLegacy;
+            break;
+        case 2:
+            consumerStream = cudaStreamPerThread;
+            break;
+        default:
+            consumerStream = reinterpret_cast<cudaStream_t>(s);
+            break;
+        }
+    }
+
+    if (consumerStream)
+    {
+        // Consumer might write to the tensor too.
+        this->submitSync(*consumerStream, LOCK_READWRITE);
+        if (m_parent)
+        {
+            m_parent->submitSync(*consumerStream, LOCK_READWRITE);
+        }
+    }
+
+    return this->cuda().attr("__dlpack__")().cast<py::capsule>();
+}
+
+py::tuple Tensor::dlpackDevice() const
+{
+    const nvcv::ITensorData *tensorData = m_impl->exportData();
+    if (!tensorData)
+    {
+        throw std::runtime_error("Tensor data can't be exported");
+    }
+
+    if (tensorData->cdata().bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA)
+    {
+        throw std::runtime_error("Only tensors with pitch-linear data can be exported");
+    }
+
+    cudaPointerAttributes attrs = {};
+    util::CheckThrow(cudaPointerGetAttributes(&attrs, tensorData->cdata().buffer.strided.basePtr));
+
+    return py::make_tuple(py::int_(static_cast<int>(kDLCUDA)), py::int_(attrs.device));
+}
+
+namespace {
+
+// Strided data of a tensor, from which the data of its views is derived
+NVCVTensorData ExportStridedData(const nvcv::ITensor &tensor)
+{
+    const nvcv::ITensorData *data = tensor.exportData();
+    if (!data || data->cdata().bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA)
+    {
+        throw std::runtime_error("Only tensors with pitch-linear data can be viewed");
+    }
+    return data->cdata();
+}
+
+// Layout made of the given labels of a layout, or no layout if it has none
+NVCVTensorLayout SelectLabels(const NVCVTensorLayout &layout, const std::vector<int> &dims)
+{
+    if (layout.rank == 0)
+    {
+        return nvcv::TENSOR_NONE;
+    }
+
+    std::string labels;
+    for (int d : dims)
+    {
+        labels += layout.data[d];
+    }
+    return nvcv::TensorLayout(labels.c_str());
+}
+
+// Strides of the new shape that address the same elements as the old shape and strides, in the same order, or
+// nothing if a copy is needed. This is numpy's no-copy reshape: groups of old dimensions whose product matches a
+// group of new dimensions must be contiguous between themselves.
+std::optional<std::vector<int64_t>> ReshapeStrides(const std::vector<int64_t> &oldShape,
+                                                   const std::vector<int64_t> &oldStrides,
+                                                   const std::vector<int64_t> &newShape, int64_t elemSize)
+{
+    // Dimensions of size 1 can have any stride, leave them out.
+    std::vector<int64_t> shape, strides;
+    for (size_t d = 0; d < oldShape.size(); ++d)
+    {
+        if (oldShape[d] != 1)
+        {
+            shape.push_back(oldShape[d]);
+            strides.push_back(oldStrides[d]);
+        }
+    }
+
+    const int            oldRank = shape.size(), newRank = newShape.size();
+    std::vector<int64_t> newStrides(newRank);
+
+    int oi = 0, oj = 1, ni = 0, nj = 1;
+    while (ni < newRank && oi < oldRank)
+    {
+        int64_t np = newShape[ni], op = shape[oi];
+        while (np != op)
+        {
+            if (np < op)
+            {
+                np *= newShape[nj++];
+            }
+            else
+            {
+                op *= shape[oj++];
+            }
+        }
+
+        for (int ok = oi; ok < oj - 1; ++ok)
+        {
+            if (strides[ok] != shape[ok + 1] * strides[ok + 1])
+            {
+                return std::nullopt;
+            }
+        }
+
+        newStrides[nj - 1] = strides[oj - 1];
+        for (int nk = nj - 1; nk > ni; --nk)
+        {
+            newStrides[nk - 1] = newStrides[nk] * newShape[nk];
+        }
+
+        ni = nj++;
+        oi = oj++;
+    }
+
+    // Trailing dimensions of size 1
+    const int64_t last = ni > 0 ? newStrides[ni - 1] : elemSize;
+    for (int nk = ni; nk < newRank; ++nk)
+    {
+        newStrides[nk] = last;
+    }
+    return newStrides;
+}
+
+} // namespace
+
+std::shared_ptr<Tensor> Tensor::createView(const NVCVTensorData &data)
+{
+    // Views of views view the same tensor, whose tracking they all share.
+    std::shared_ptr<Tensor> parent = m_parent ? m_parent : this->shared_from_this();
+
+    nvcv::TensorDataStridedCuda viewData{data};
+
+    Tensor::Key key;
+    Cache::Instance().removeAllNotInUseMatching(key);
+
+    auto tensor = std::shared_ptr<Tensor>(new Tensor(viewData, std::move(parent)));
+
+    // Kept in cache as other wrappers, so that they outlive the work submitted on them.
+    Cache::Instance().add(*tensor);
+    return tensor;
+}
+
+std::shared_ptr<Tensor> Tensor::getItem(py::object key)
+{
+    const NVCVTensorData data = ExportStridedData(*m_impl);
+
+    py::tuple indices = py::isinstance<py::tuple>(key) ? key.cast<py::tuple>() : py::make_tuple(key);
+
+    int  numIndexed  = 0;
+    bool hasEllipsis = false;
+    for (py::handle idx : indices)
+    {
+        if (idx.is(py::ellipsis()))
+        {
+            if (hasEllipsis)
+            {
+                throw std::invalid_argument("An index can only have a single ellipsis");
+            }
+            hasEllipsis = true;
+        }
+        else
+        {
+            ++numIndexed;
+        }
+    }
+
+    if (numIndexed > data.rank)
+    {
+        throw py::index_error(
+            util::FormatString("Too many indices for a tensor of rank %d: %d", data.rank, numIndexed));
+    }
+
+    NVCVTensorData   view     = data;
+    NVCVByte       *&basePtr  = view.buffer.strided.basePtr;
+    std::vector<int> keptDims = {};
+    view.rank                 = 0;
+
+    auto keep = [&](int d, int64_t size, int64_t stride)
+    {
+        view.shape[view.rank]                  = size;
+        view.buffer.strided.strides[view.rank] = stride;
+        ++view.rank;
+        keptDims.push_back(d);
+    };
+
+    int d = 0;
+    for (py::handle idx : indices)
+    {
+        if (idx.is(py::ellipsis()))
+        {
+            for (int n = data.rank - numIndexed; n > 0; --n, ++d)
+            {
+                keep(d, data.shape[d], data.buffer.strided.strides[d]);
+            }
+            continue;
+        }
+
+        const int64_t size   = data.shape[d];
+        const int64_t stride = data.buffer.strided.strides[d];
+
+        if (py::isinstance<py::slice>(idx))
+        {
+            py::ssize_t start, stop, step, length;
+            if (!idx.cast<py::slice>().compute(size, &start, &stop, &step, &length))
+            {
+                throw py::error_already_set();
+            }
+            if (step <= 0)
+            {
+                throw std::invalid_argument("Slices of tensors must have a positive step");
+            }
+            if (length == 0)
+            {
+                throw std::invalid_argument(util::FormatString("Slice of dimension %d is empty", d));
+            }
+            basePtr += start * stride;
+            keep(d, length, stride * step);
+        }
+        else if (py::isinstance<py::int_>(idx))
+        {
+            int64_t i = idx.cast<int64_t>();
+            if (i < -size || i >= size)
+            {
+                throw py::index_error(util::FormatString("Index %ld is out of bounds for dimension %d of size %ld",
+                                                         (long)i, d, (long)size));
+            }
+            basePtr += (i < 0 ? i + size : i) * stride;
+        }
+        else
+        {
+            throw py::type_error("Tensors can only be indexed by integers, slices and an ellipsis");
+        }
+        ++d;
+    }
+
+    for (; d < data.rank; ++d)
+    {
+        keep(d, data.shape[d], data.buffer.strided.strides[d]);
+    }
+
+    if (view.rank == 0)
+    {
+        throw std::invalid_argument("Indexing a tensor must keep at least one dimension");
+    }
+
+    view.layout = SelectLabels(data.layout, keptDims);
+
+    return createView(view);
+}
+
+std::shared_ptr<Tensor> Tensor::reshape(Shape shape, std::optional<nvcv::TensorLayout> layout)
+{
+    const NVCVTensorData data = ExportStridedData(*m_impl);
+
+    if (shape.size() < 1 || shape.size() > NVCV_TENSOR_MAX_RANK)
+    {
+        throw std::invalid_argument(util::FormatString("Number of dimensions must be between 1 and %d, not %d",
+                                                       NVCV_TENSOR_MAX_RANK, (int)shape.size()));
+    }
+
+    int64_t numElements = 1;
+    for (int d = 0; d < data.rank; ++d)
+    {
+        numElements *= data.shape[d];
+    }
+
+    // A single dimension can be -1, inferred from the number of elements
+    std::vector<int64_t> newShape;
+    int                  inferred = -1;
+    int64_t              known    = 1;
+    for (py::handle dim : shape)
+    {
+        int64_t size = dim.cast<int64_t>();
+        if (size == -1 && inferred < 0)
+        {
+            inferred = newShape.size();
+        }
+        else if (size < 1)
+        {
+            throw std::invalid_argument(util::FormatString("Invalid dimension size %ld", (long)size));
+        }
+        else
+        {
+            known *= size;
+        }
+        newShape.push_back(size);
+    }
+    if (inferred >= 0)
+    {
+        newShape[inferred] = numElements / known;
+    }
+
+    int64_t newNumElements = 1;
+    for (int64_t size : newShape)
+    {
+        newNumElements *= size;
+    }
+    if (newNumElements != numElements)
+    {
+        throw std::invalid_argument(util::FormatString("Can't reshape a tensor of %ld elements to %ld elements",
+                                                       (long)numElements, (long)newNumElements));
+    }
+
+    // The layout is kept if the rank is, otherwise it must be given.
+    if (!layout)
+    {
+        layout = static_cast<int>(newShape.size()) == data.rank ? nvcv::TensorLayout(data.layout) : nvcv::TENSOR_NONE;
+    }
+    else if (layout->rank() != 0 && layout->rank() != static_cast<int>(newShape.size()))
+    {
+        throw std::invalid_argument(util::FormatString("Layout of rank %d doesn't match the %d dimensions",
+                                                       layout->rank(), (int)newShape.size()));
+    }
+
+    const int64_t elemSize = nvcv::DataType(data.dtype).strideBytes();
+
+    std::optional<std::vector<int64_t>> strides
+        = ReshapeStrides(std::vector<int64_t>(data.shape, data.shape + data.rank),
+                         std::vector<int64_t>(data.buffer.strided.strides, data.buffer.strided.strides + data.rank),
+                         newShape, elemSize);
+    if (!strides)
+    {
+        throw std::invalid_argument("Tensor can't be reshaped without a copy, its strides aren't compatible with the "
+                                    "new shape");
+    }
+
+    NVCVTensorData view = data;
+    view.rank           = newShape.size();
+    view.layout         = *layout;
+    std::copy(newShape.begin(), newShape.end(), view.shape);
+    std::copy(strides->begin(), strides->end(), view.buffer.strided.strides);
+
+    return createView(view);
+}
+
+std::shared_ptr<Tensor> Tensor::reinterpretLayout(nvcv::TensorLayout layout)
+{
+    NVCVTensorData view = ExportStridedData(*m_impl);
+
+    if (layout.rank() != 0 && layout.rank() != view.rank)
+    {
+        throw std::invalid_argument(util::FormatString("Layout of rank %d doesn't match the tensor rank %d",
+                                                       layout.rank(), view.rank));
+    }
+    view.layout = layout;
+
+    return createView(view);
+}
+
+void Tensor::doBeforeSync(LockMode mode) const
+{
+    if (m_parent)
+    {
+        m_parent->doSync(mode);
+    }
+}
+
+void Tensor::doBeforeSubmitSync(Stream &stream, LockMode mode) const
+{
+    if (m_parent)
+    {
+        m_parent->submitSync(stream, mode);
+    }
+}
+
+void Tensor::doBeforeSubmitSignal(Stream &stream, LockMode mode) const
+{
+    if (m_parent)
+    {
+        m_parent->submitSignal(stream, mode);
+    }
+}
+
 std::ostream &operator<<(std::ostream &out, const Tensor &tensor)
 {
     return out << "<nvcv.Tensor shape=" << tensor.impl().shape()
@@ -361,8 +954,8 @@ void Tensor::Export(py::module &m)
     py::implicitly_convertible<py::str, nvcv::TensorLayout>();
 
     py::class_<Tensor, std::shared_ptr<Tensor>, Container>(m, "Tensor")
-        .def(py::init(&Tensor::CreateForImageBatch), "nimages"_a, "imgsize"_a, "format"_a)
-        .def(py::init(&Tensor::Create), "shape"_a, "dtype"_a, "layout"_a = std::nullopt)
+        .def(py::init(&Tensor::CreateForImageBatch), "nimages"_a, "imgsize"_a, "format"_a, "rowalign"_a = 0)
+        .def(py::init(&Tensor::Create), "shape"_a, "dtype"_a, "layout"_a = std::nullopt, "rowalign"_a = 0)
         .def_property_readonly("layout", &Tensor::layout)
         .def_property_readonly("shape", &Tensor::shape)
         .def_property_readonly("dtype", &Tensor::dtype)
@@ -371,9 +964,40 @@ void Tensor::Export(py::module &m)
         // Each language use whatever is appropriate (and expected) in their environment.
         .def_property_readonly("ndim", &Tensor::rank)
         .def("cuda", &Tensor::cuda)
+        .def("upload", &Tensor::upload, "array"_a, py::kw_only(), "stream"_a = nullptr,
+             "Copies a C-contiguous host array to the tensor, returning once the array can be reused.")
+        .def("download", &Tensor::download, py::kw_only(), "stream"_a = nullptr,
+             "Copies the tensor to a new host array, returning once the copy is complete.")
+        .def("export_ipc", &Tensor::exportIpc, py::kw_only(), "stream"_a = nullptr,
+             "Returns the bytes describing the tensor, for another process on the same GPU to import it with "
+             "nvcv.import_tensor_ipc without copies. The tensor must be kept alive while it's used there.")
+        .def("__dlpack__", &Tensor::dlpack, "stream"_a = py::none())
+        .def("__dlpack_device__", &Tensor::dlpackDevice)
+        .def("__getitem__", &Tensor::getItem, "key"_a,
+             "Returns a view of the tensor indexed by integers, slices with a positive step and an ellipsis, as a "
+             "numpy array would be. Integer indices remove their dimension and its layout label.")
+        .def("reshape", &Tensor::reshape, "shape"_a, "layout"_a = std::nullopt,
+             "Returns a view of the tensor with another shape, one of its dimensions can be -1. The layout is kept "
+             "when the rank is, and the strides must allow the view, as with numpy's reshape without copy.")
+        .def("reinterpret_layout", &Tensor::reinterpretLayout, "layout"_a,
+             "Returns a view of the tensor with the same shape and another layout of the same rank.")
         .def("__repr__", &util::ToString<Tensor>);
 
     m.def("as_tensor", &Tensor::Wrap, "buffer"_a, "layout"_a = std::nullopt);
+
+    m.def("import_tensor_ipc", &Tensor::ImportIpc, "ipc"_a, py::kw_only(), "stream"_a = nullptr,
+          "Imports a tensor exported by another process with Tensor.export_ipc. The stream waits for the work "
+          "that produced its contents in the exporting process.");
+
+    m.def("reserve", &Tensor::Reserve, "shape"_a, "dtype"_a, "layout"_a = std::nullopt, "count"_a = 1,
+          "rowalign"_a = 0,
+          "Pre-allocates count tensors with the given shape, data type and layout, and keeps them in cache so "
+          "that creating tensors like them, e.g. operator outputs, doesn't allocate memory. Reserved tensors are "
+          "never evicted from cache, they are only released by clear_cache().");
+
+    // Row alignment that can be passed as rowalign when creating tensors, so that
+    // rows start on global memory segments and kernels can use vectorized loads.
+    m.attr("ROW_ALIGNMENT_PERFORMANCE") = NVCV_ROW_ALIGNMENT_PERFORMANCE;
     m.def("as_tensor", &Tensor::WrapImage, "image"_a);
 }
 
@@ -21,31 +21,45 @@
 #include "Container.hpp"
 #include "Size.hpp"
 
+#include <nvcv/Ipc.h>
 #include <nvcv/Shape.hpp>
 #include <nvcv/Tensor.hpp>
 #include <nvcv/python/Shape.hpp>
 #include <pybind11/numpy.h>
 #include <pybind11/pytypes.h>
 
+#include <array>
+
 namespace nvcvpy::priv {
 namespace py = pybind11;
 
 class ExternalBuffer;
 class Image;
+class Stream;
 
 class Tensor : public Container
 {
 public:
     static void Export(py::module &m);
 
-    static std::shared_ptr<Tensor> CreateForImageBatch(int numImages, const Size2D &size, nvcv::ImageFormat fmt);
-    static std::shared_ptr<Tensor> Create(Shape shape, nvcv::DataType dtype, std::optional<nvcv::TensorLayout> layout);
+    // rowAlign is the row address alignment in bytes, 0 for the default one.
+    static std::shared_ptr<Tensor> CreateForImageBatch(int numImages, const Size2D &size, nvcv::ImageFormat fmt,
+                                                       int32_t rowAlign = 0);
+    static std::shared_ptr<Tensor> Create(Shape shape, nvcv::DataType dtype, std::optional<nvcv::TensorLayout> layout,
+                                          int32_t rowAlign = 0);
 
     static std::shared_ptr<Tensor> CreateFromReqs(const nvcv::Tensor::Requirements &reqs);
 
+    // Pre-allocates tensors that are kept in cache for later Create calls
+    static void Reserve(Shape shape, nvcv::DataType dtype, std::optional<nvcv::TensorLayout> layout, int count,
+                        int32_t rowAlign = 0);
+
     static std::shared_ptr<Tensor> Wrap(ExternalBuffer &buffer, std::optional<nvcv::TensorLayout> layout);
     static std::shared_ptr<Tensor> WrapImage(Image &img);
 
+    // Imports a tensor exported by another process with exportIpc
+    static std::shared_ptr<Tensor> ImportIpc(py::bytes ipc, std::shared_ptr<Stream> stream);
+
     std::shared_ptr<Tensor>       shared_from_this();
     std::shared_ptr<const Tensor> shared_from_this() const;
 
@@ -68,10 +82,19 @@ public:
         explicit Key(const nvcv::Tensor::Requirements &reqs);
         explicit Key(const nvcv::TensorShape &shape, nvcv::DataType dtype);
 
+        // Key of a wrapper of external memory, equal to the keys of other
+        // wrappers of the same buffer with the same shape, strides and dtype.
+        explicit Key(const nvcv::ITensorDataStrided &data);
+
+        bool wrapsExternalBuffer() const;
+
     private:
         nvcv::TensorShape m_shape;
         nvcv::DataType    m_dtype;
-        bool              m_wrapper;
+        // Tensors with the same shape might have different row alignments.
+        std::array<int64_t, NVCV_TENSOR_MAX_RANK> m_strides = {};
+        bool                                      m_wrapper;
+        const void                               *m_basePtr = nullptr; // only set for external buffer wrappers
 
         virtual size_t doGetHash() const override;
         virtual bool   doIsEqual(const IKey &that) const override;
@@ -79,12 +102,39 @@ public:
 
     virtual const Key &key() const override;
 
+    virtual int64_t sizeBytes() const override;
+
     py::object cuda() const;
 
+    // Copies between the tensor and a packed host array through pinned staging memory
+    void      upload(py::buffer array, std::shared_ptr<Stream> stream);
+    py::array download(std::shared_ptr<Stream> stream) const;
+
+    // Describes the tensor so that another process can import it without copies
+    py::bytes exportIpc(std::shared_ptr<Stream> stream) const;
+
+    // DLPack protocol, for zero-copy export to other frameworks
+    py::capsule dlpack(py::object stream) const;
+    py::tuple   dlpackDevice() const;
+
+    // Views of the tensor's memory, without copies. They keep the tensor alive and share its dependency tracking,
+    // so work on a view is ordered with work on the tensor and its other views.
+    std::shared_ptr<Tensor> getItem(py::object key);
+    std::shared_ptr<Tensor> reshape(Shape shape, std::optional<nvcv::TensorLayout> layout);
+    std::shared_ptr<Tensor> reinterpretLayout(nvcv::TensorLayout layout);
+
 private:
     Tensor(const nvcv::Tensor::Requirements &reqs);
-    Tensor(const nvcv::ITensorData &data, py::object wrappedObject);
+    Tensor(const nvcv::ITensorDataStrided &data, py::object wrappedObject);
     Tensor(Image &img);
+    Tensor(const NVCVTensorIpcHandle &ipc, Stream &stream);
+    Tensor(const nvcv::ITensorDataStrided &data, std::shared_ptr<Tensor> parent);
+
+    std::shared_ptr<Tensor> createView(const NVCVTensorData &data);
+
+    void doBeforeSync(LockMode mode) const override;
+    void doBeforeSubmitSync(Stream &stream, LockMode mode) const override;
+    void doBeforeSubmitSignal(Stream &stream, LockMode mode) const override;
 
     // m_impl must come before m_key
     std::unique_ptr<nvcv::ITensor> m_impl;
@@ -94,6 +144,10 @@ private:
     mutable std::optional<nvcv::TensorLayout> m_cacheExternalObjectLayout;
 
     py::object m_wrappedObject; // null if not wrapping
+
+    std::shared_ptr<Tensor> m_parent; // tensor whose memory is viewed, null if not a view
+
+    int64_t m_sizeBytes = 0; // 0 if not owning its memory
 };
 
 std::ostream &operator<<(std::ostream &out, const Tensor &tensor);
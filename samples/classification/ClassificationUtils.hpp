@@ -55,7 +55,7 @@ std::vector<std::string> getClassLabels(const std::string &labelsFilePath)
 }
 
 /**
- * @brief Display the TopN classification results
+ * @brief Display the TopN classification results, from the sorted scores and indices of each image
  *
  **/
 void DisplayResults(std::vector<std::vector<float>> &scores, std::vector<std::vector<int>> &indices,
@@ -68,7 +68,7 @@ void DisplayResults(std::vector<std::vector<float>> &scores, std::vector<std::ve
         for (int j = 0; j < TOPN; j++)
         {
             auto index = indices[i][j];
-            printf("Class : %s , Score : %f\n", classes[index].c_str(), scores[i][index]);
+            printf("Class : %s , Score : %f\n", classes[index].c_str(), scores[i][j]);
         }
     }
 }
@@ -80,7 +80,8 @@ void DisplayResults(std::vector<std::vector<float>> &scores, std::vector<std::ve
 void showUsage()
 {
     std::cout << "usage: ./nvcv_classification_app -e <tensorrt engine path> -i <image file path or  image directory "
-                 "path> -l <labels file path> -b <batch size>"
+                 "path> -l <labels file path> -b <batch size> -n <number of batches> -s <batches in flight> "
+                 "-w <number of warm-up batches>"
               << std::endl;
 }
 
@@ -89,7 +90,7 @@ void showUsage()
  *
  **/
 int ParseArgs(int argc, char *argv[], std::string &modelPath, std::string &imagePath, std::string &labelPath,
-              uint32_t &batchSize)
+              uint32_t &batchSize, uint32_t &numBatches, uint32_t &numSlots, uint32_t &numWarmup)
 {
     static struct option long_options[] = {
         {     "help",       no_argument, 0, 'h'},
@@ -97,12 +98,15 @@ int ParseArgs(int argc, char *argv[], std::string &modelPath, std::string &image
         {"labelPath", required_argument, 0, 'l'},
         {"imagePath", required_argument, 0, 'i'},
         {    "batch", required_argument, 0, 'b'},
+        {  "batches", required_argument, 0, 'n'},
+        { "inflight", required_argument, 0, 's'},
+        {   "warmup", required_argument, 0, 'w'},
         {          0,                 0, 0,   0}
     };
 
     int long_index = 0;
     int opt        = 0;
-    while ((opt = getopt_long(argc, argv, "he:l:i:b:", long_options, &long_index)) != -1)
+    while ((opt = getopt_long(argc, argv, "he:l:i:b:n:s:w:", long_options, &long_index)) != -1)
     {
         switch (opt)
         {
@@ -122,6 +126,15 @@ int ParseArgs(int argc, char *argv[], std::string &modelPath, std::string &image
         case 'b':
             batchSize = std::stoi(optarg);
             break;
+        case 'n':
+            numBatches = std::stoi(optarg);
+            break;
+        case 's':
+            numSlots = std::stoi(optarg);
+            break;
+        case 'w':
+            numWarmup = std::stoi(optarg);
+            break;
         case ':':
             showUsage();
             return -1;
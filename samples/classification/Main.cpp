@@ -18,12 +18,14 @@
 #include "ClassificationUtils.hpp"
 
 #include <common/NvDecoder.h>
+#include <common/Pipeline.h>
 #include <common/TRTUtils.h>
 #include <cuda_runtime_api.h>
 #include <cvcuda/OpConvertTo.hpp>
 #include <cvcuda/OpNormalize.hpp>
 #include <cvcuda/OpReformat.hpp>
 #include <cvcuda/OpResize.hpp>
+#include <cvcuda/OpTopK.hpp>
 #include <math.h>
 #include <nvcv/Image.hpp>
 #include <nvcv/Tensor.hpp>
@@ -31,7 +33,6 @@
 
 #include <fstream>
 #include <iostream>
-#include <numeric>
 
 /**
  * @brief Image classification sample.
@@ -41,8 +42,44 @@
  * which takes as input a batch of images and returns the TopN classification results
  * of each image.
  *
+ * The stages run on their own streams with several batches in flight, see Pipeline.h, so that
+ * the upload, preprocessing, inference and download of consecutive batches overlap.
+ *
  */
 
+/**
+ * @brief Buffers of the preprocessing stage
+ *
+ * @details Each batch in flight has its own, so that preprocessing doesn't allocate memory
+ * nor overwrite tensors that a previous batch is still using.
+ */
+struct PreProcessBuffers
+{
+    PreProcessBuffers(uint32_t batchSize, int inputLayerWidth, int inputLayerHeight)
+        : resizedTensor(batchSize, {inputLayerWidth, inputLayerHeight}, nvcv::FMT_RGB8)
+        , floatTensor(batchSize, {inputLayerWidth, inputLayerHeight}, nvcv::FMT_RGBf32)
+        , normTensor(batchSize, {inputLayerWidth, inputLayerHeight}, nvcv::FMT_RGBf32)
+        , scaleTensor(1, {1, 1}, nvcv::FMT_RGBf32)
+        , baseTensor(1, {1, 1}, nvcv::FMT_RGBf32)
+    {
+        // The R,G,B scale and mean will be applied to all the pixels across the batch of input images
+        const auto *scaleData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(scaleTensor.exportData());
+        const auto *baseData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(baseTensor.exportData());
+        float       scale[3]  = {0.229, 0.224, 0.225};
+        float       base[3]   = {0.485f, 0.456f, 0.406f};
+
+        CHECK_CUDA_ERROR(cudaMemcpy(scaleData->basePtr(), scale, 3 * sizeof(float), cudaMemcpyHostToDevice));
+        CHECK_CUDA_ERROR(cudaMemcpy(baseData->basePtr(), base, 3 * sizeof(float), cudaMemcpyHostToDevice));
+    }
+
+    nvcv::Tensor resizedTensor;
+    nvcv::Tensor floatTensor;
+    nvcv::Tensor normTensor;
+    // Standard deviation and mean values for R,G,B
+    nvcv::Tensor scaleTensor;
+    nvcv::Tensor baseTensor;
+};
+
 /**
  * @brief Preprocess function
  *
@@ -50,154 +87,115 @@
  * Resize -> DataType Convert(U8->F32) -> Normalize( Apply mean and std deviation) -> Interleaved to Planar
  *
  * @param [in] inTensor CVCUDA Tensor containing the batched input images
- * @param [in] batchSize Batch size of the input tensor
- * @param [in] inputLayerWidth Input Layer width of the network
- * @param [in] inputLayerHeight Input Layer height of the network
+ * @param [in] buffers Intermediate tensors of the batch
  * @param [in] stream Cuda stream
  *
  * @param [out] outTensor  CVCUDA Tensor containing the preprocessed image batch
  *
  */
 
-void PreProcess(nvcv::TensorWrapData &inTensor, uint32_t batchSize, int inputLayerWidth, int inputLayerHeight,
-                cudaStream_t stream, nvcv::TensorWrapData &outTensor)
+void PreProcess(nvcv::TensorWrapData &inTensor, PreProcessBuffers &buffers, cudaStream_t stream,
+                nvcv::Tensor &outTensor)
 {
-#ifdef PROFILE_SAMPLE
-    cudaEvent_t start, stop;
-    cudaEventCreate(&start);
-    cudaEventCreate(&stop);
-    cudaEventRecord(start);
-#endif
-
     // Resize to the dimensions of input layer of network
-    nvcv::Tensor   resizedTensor(batchSize, {inputLayerWidth, inputLayerHeight}, nvcv::FMT_RGB8);
     cvcuda::Resize resizeOp;
-    resizeOp(stream, inTensor, resizedTensor, NVCV_INTERP_LINEAR);
+    resizeOp(stream, inTensor, buffers.resizedTensor, NVCV_INTERP_LINEAR);
 
     // Convert to data format expected by network (F32). Apply scale 1/255f.
-    nvcv::Tensor      floatTensor(batchSize, {inputLayerWidth, inputLayerHeight}, nvcv::FMT_RGBf32);
     cvcuda::ConvertTo convertOp;
-    convertOp(stream, resizedTensor, floatTensor, 1.0f / 255.f, 0.0f);
+    convertOp(stream, buffers.resizedTensor, buffers.floatTensor, 1.0f / 255.f, 0.0f);
 
     // The input to the network needs to be normalized based on the mean and std deviation values
     // to standardize the input data.
 
-    // Create a Tensor to store the standard deviation values for R,G,B
-    nvcv::Tensor::Requirements reqsScale       = nvcv::Tensor::CalcRequirements(1, {1, 1}, nvcv::FMT_RGBf32);
-    int64_t                    scaleBufferSize = CalcTotalSizeBytes(nvcv::Requirements{reqsScale.mem}.cudaMem());
-    nvcv::TensorDataStridedCuda::Buffer bufScale;
-    std::copy(reqsScale.strides, reqsScale.strides + NVCV_TENSOR_MAX_RANK, bufScale.strides);
-    CHECK_CUDA_ERROR(cudaMalloc(&bufScale.basePtr, scaleBufferSize));
-    nvcv::TensorDataStridedCuda scaleIn(nvcv::TensorShape{reqsScale.shape, reqsScale.rank, reqsScale.layout},
-                                        nvcv::DataType{reqsScale.dtype}, bufScale);
-    nvcv::TensorWrapData        scaleTensor(scaleIn);
-
-    // Create a Tensor to store the mean values for R,G,B
-    nvcv::TensorDataStridedCuda::Buffer bufBase;
-    nvcv::Tensor::Requirements          reqsBase       = nvcv::Tensor::CalcRequirements(1, {1, 1}, nvcv::FMT_RGBf32);
-    int64_t                             baseBufferSize = CalcTotalSizeBytes(nvcv::Requirements{reqsBase.mem}.cudaMem());
-    std::copy(reqsBase.strides, reqsBase.strides + NVCV_TENSOR_MAX_RANK, bufBase.strides);
-    CHECK_CUDA_ERROR(cudaMalloc(&bufBase.basePtr, baseBufferSize));
-    nvcv::TensorDataStridedCuda baseIn(nvcv::TensorShape{reqsBase.shape, reqsBase.rank, reqsBase.layout},
-                                       nvcv::DataType{reqsBase.dtype}, bufBase);
-    nvcv::TensorWrapData        baseTensor(baseIn);
-
-    // Copy the values from Host to Device
-    // The R,G,B scale and mean will be applied to all the pixels across the batch of input images
-    const auto *baseData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(scaleTensor.exportData());
-    const auto *scaleData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(baseTensor.exportData());
-    float       scale[3]  = {0.229, 0.224, 0.225};
-    float       base[3]   = {0.485f, 0.456f, 0.406f};
-
     // Flag to set the scale value as standard deviation i.e use 1/scale
     uint32_t flags = CVCUDA_NORMALIZE_SCALE_IS_STDDEV;
-    CHECK_CUDA_ERROR(cudaMemcpyAsync(scaleData->basePtr(), scale, 3 * sizeof(float), cudaMemcpyHostToDevice, stream));
-    CHECK_CUDA_ERROR(cudaMemcpyAsync(baseData->basePtr(), base, 3 * sizeof(float), cudaMemcpyHostToDevice, stream));
-
-    nvcv::Tensor normTensor(batchSize, {inputLayerWidth, inputLayerHeight}, nvcv::FMT_RGBf32);
 
     // Normalize
     cvcuda::Normalize normOp;
-    normOp(stream, floatTensor, baseTensor, scaleTensor, normTensor, 1.0f, 0.0f, 0.0f, flags);
+    normOp(stream, buffers.floatTensor, buffers.baseTensor, buffers.scaleTensor, buffers.normTensor, 1.0f, 0.0f, 0.0f,
+           flags);
 
     // Convert the data layout from interleaved to planar
     cvcuda::Reformat reformatOp;
-    reformatOp(stream, normTensor, outTensor);
-
-#ifdef PROFILE_SAMPLE
-    cudaEventRecord(stop);
-    cudaEventSynchronize(stop);
-    float preprocessms = 0;
-    cudaEventElapsedTime(&preprocessms, start, stop);
-    std::cout << "\nTime for Preprocess : " << preprocessms << " ms" << std::endl;
-#endif
+    reformatOp(stream, buffers.normTensor, outTensor);
 }
 
 /**
  * @brief Postprocess function
  *
- * @details Postprocessing function normalizes the classification score from the network and sorts
- *           the scores to get the TopN classification scores.
+ * @details Postprocessing function normalizes the classification scores from the network with a softmax
+ *           and finds the TopN classification scores of each image, on the GPU.
  *
- * @param [in] outputCudaBuffer Classification scores from the network
+ * @param [in] outputTensor Classification scores from the network
  * @param [in] stream Cuda Stream
  *
- * @param [out] scores Vector to store the sorted scores
- * @param [out] indices Vector to store the sorted indices
+ * @param [out] topScores Tensor to store the TopN sorted scores of each image
+ * @param [out] topIndices Tensor to store the indices of the TopN scores
+ */
+void PostProcess(nvcv::Tensor &outputTensor, cudaStream_t stream, nvcv::Tensor &topScores, nvcv::Tensor &topIndices)
+{
+    cvcuda::TopK topkOp;
+    topkOp(stream, outputTensor, topScores, topIndices, true);
+}
+
+/**
+ * @brief Buffers of one batch in flight
  */
-void PostProcess(float *outputCudaBuffer, std::vector<std::vector<float>> &scores,
-                 std::vector<std::vector<int>> &indices, cudaStream_t stream)
+struct BatchBuffers
 {
-#ifdef PROFILE_SAMPLE
-    cudaEvent_t start, stop;
-    cudaEventCreate(&start);
-    cudaEventCreate(&stop);
-    cudaEventRecord(start);
-#endif
-
-    uint32_t batchSize  = scores.size();
-    uint32_t numClasses = scores[0].size();
-
-    // Copy the network classification scores from Device to Host
-    for (int i = 0; i < batchSize; i++)
+    BatchBuffers(uint32_t batchSize, const nvcv::TensorDataStridedCuda::Buffer &inLayout,
+                 const nvcv::Tensor::Requirements &inReqs, const TRTBackendBlobSize &inputDims,
+                 const TRTBackendBlobSize &outputDims)
+        : inBuf(inLayout)
+        , inTensorData(nvcv::TensorShape{inReqs.shape, inReqs.rank, inReqs.layout}, nvcv::DataType{inReqs.dtype},
+                       AllocInput(inBuf, batchSize))
+        , inTensor(inTensorData)
+        , preprocess(batchSize, inputDims.width, inputDims.height)
+        , inputLayerTensor(batchSize, {inputDims.width, inputDims.height}, nvcv::FMT_RGBf32p)
+        // The network writes the scores of the batch contiguously
+        , outputLayerTensor({{batchSize, 1, outputDims.width, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32,
+                            nvcv::MemAlignment{}.rowAddr(sizeof(float)))
+        , topScores({{batchSize, 1, TOPN, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32)
+        , topIndices({{batchSize, 1, TOPN, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32)
     {
-        CHECK_CUDA_ERROR(cudaMemcpyAsync(scores[i].data(), outputCudaBuffer + i * numClasses,
-                                         numClasses * sizeof(float), cudaMemcpyDeviceToHost, stream));
     }
 
-    CHECK_CUDA_ERROR(cudaStreamSynchronize(stream));
+    ~BatchBuffers()
+    {
+        cudaFree(inBuf.basePtr);
+    }
 
-    for (int i = 0; i < batchSize; i++)
+    static const nvcv::TensorDataStridedCuda::Buffer &AllocInput(nvcv::TensorDataStridedCuda::Buffer &buf,
+                                                                  uint32_t                             batchSize)
     {
-        // Apply softmax to normalize the scores in the range 0-1
-        std::transform(scores[i].begin(), scores[i].end(), scores[i].begin(), [](float val) { return std::exp(val); });
-
-        auto sum = std::accumulate(scores[i].begin(), scores[i].end(), 0.0);
-        std::transform(scores[i].begin(), scores[i].end(), scores[i].begin(), [sum](float val) { return val / sum; });
-        // Sort the indices based on scores
-        std::iota(indices[i].begin(), indices[i].end(), 0);
-        std::sort(indices[i].begin(), indices[i].end(),
-                  [&scores, i](int i1, int i2) { return scores[i][i1] > scores[i][i2]; });
+        CHECK_CUDA_ERROR(cudaMalloc(&buf.basePtr, batchSize * buf.strides[0]));
+        return buf;
     }
-#ifdef PROFILE_SAMPLE
-    cudaEventRecord(stop);
-    cudaEventSynchronize(stop);
-    float postprocessms = 0;
-    cudaEventElapsedTime(&postprocessms, start, stop);
-    std::cout << "Time for Postprocess : " << postprocessms << " ms" << std::endl;
-#endif
-}
+
+    nvcv::TensorDataStridedCuda::Buffer inBuf;
+    nvcv::TensorDataStridedCuda         inTensorData;
+    nvcv::TensorWrapData                inTensor;
+    PreProcessBuffers                   preprocess;
+    nvcv::Tensor                        inputLayerTensor;
+    nvcv::Tensor                        outputLayerTensor;
+    nvcv::Tensor                        topScores;
+    nvcv::Tensor                        topIndices;
+};
 
 int main(int argc, char *argv[])
 {
     // Default parameters
-    std::string modelPath = "./engines/resnet50.engine";
-    std::string imagePath = "./samples/assets/tabby_tiger_cat.jpg";
-    std::string labelPath = "./engines/imagenet-classes.txt";
-    uint32_t    batchSize = 1;
+    std::string modelPath  = "./engines/resnet50.engine";
+    std::string imagePath  = "./samples/assets/tabby_tiger_cat.jpg";
+    std::string labelPath  = "./engines/imagenet-classes.txt";
+    uint32_t    batchSize  = 1;
+    uint32_t    numBatches = 1;
+    uint32_t    numSlots   = 2;
+    uint32_t    numWarmup  = 0;
 
     // Parse the command line paramaters to override the default parameters
-    int retval = ParseArgs(argc, argv, modelPath, imagePath, labelPath, batchSize);
+    int retval = ParseArgs(argc, argv, modelPath, imagePath, labelPath, batchSize, numBatches, numSlots, numWarmup);
     if (retval != 0)
     {
         return retval;
@@ -214,27 +212,23 @@ int main(int argc, char *argv[])
     int maxImageHeight = 720;
     int maxChannels    = 3;
 
-    cudaStream_t stream;
-    CHECK_CUDA_ERROR(cudaStreamCreate(&stream));
-
-    // Allocating memory for input image batch
-    nvcv::TensorDataStridedCuda::Buffer inBuf;
-    inBuf.strides[3] = sizeof(uint8_t);
-    inBuf.strides[2] = maxChannels * inBuf.strides[3];
-    inBuf.strides[1] = maxImageWidth * inBuf.strides[2];
-    inBuf.strides[0] = maxImageHeight * inBuf.strides[1];
-    CHECK_CUDA_ERROR(cudaMallocAsync(&inBuf.basePtr, batchSize * inBuf.strides[0], stream));
+    // Layout of the input image batch
+    nvcv::TensorDataStridedCuda::Buffer inLayout;
+    inLayout.strides[3] = sizeof(uint8_t);
+    inLayout.strides[2] = maxChannels * inLayout.strides[3];
+    inLayout.strides[1] = maxImageWidth * inLayout.strides[2];
+    inLayout.strides[0] = maxImageHeight * inLayout.strides[1];
+    const int64_t inBatchBytes = batchSize * inLayout.strides[0];
 
     nvcv::Tensor::Requirements inReqs
         = nvcv::Tensor::CalcRequirements(batchSize, {maxImageWidth, maxImageHeight}, nvcv::FMT_RGB8);
 
-    nvcv::TensorDataStridedCuda inData(nvcv::TensorShape{inReqs.shape, inReqs.rank, inReqs.layout},
-                                       nvcv::DataType{inReqs.dtype}, inBuf);
-    nvcv::TensorWrapData        inTensor(inData);
-
     // NvJpeg is used to load the images to create a batched input device buffer.
-    uint8_t *gpuInput = reinterpret_cast<uint8_t *>(inBuf.basePtr);
-    NvDecode(imagePath, batchSize, totalImages, outputFormat, gpuInput);
+    // The decoder creates and destroys its handles on each call, which synchronizes the device, so the
+    // images are decoded once and each batch uploads them again, standing in for a decoder in the pipeline.
+    uint8_t *decodedImages = nullptr;
+    CHECK_CUDA_ERROR(cudaMalloc(&decodedImages, inBatchBytes));
+    NvDecode(imagePath, batchSize, totalImages, outputFormat, decodedImages);
 
     // TensorRT is used for the inference which loads the serialized engine file which is generated from the onnx model.
     // Initialize TensorRT backend
@@ -249,10 +243,6 @@ int main(int argc, char *argv[])
         return -1;
     }
 
-    // Initialize TensorRT Buffers
-    std::vector<void *> buffers;
-    buffers.resize(numBindings);
-
     // Get dimensions of input and output layers
     TRTBackendBlobSize inputDims, outputDims;
     uint32_t           inputBindingIndex, outputBindingIndex;
@@ -270,69 +260,93 @@ int main(int argc, char *argv[])
         }
     }
 
-    // Allocate input layer buffer based on input layer dimensions and batch size
-    // Calculates the resource requirements needed to create a tensor with given shape
-    nvcv::Tensor::Requirements reqsInputLayer
-        = nvcv::Tensor::CalcRequirements(batchSize, {inputDims.width, inputDims.height}, nvcv::FMT_RGBf32p);
-    // Calculates the total buffer size needed based on the requirements
-    int64_t inputLayerSize = CalcTotalSizeBytes(nvcv::Requirements{reqsInputLayer.mem}.cudaMem());
-    nvcv::TensorDataStridedCuda::Buffer bufInputLayer;
-    std::copy(reqsInputLayer.strides, reqsInputLayer.strides + NVCV_TENSOR_MAX_RANK, bufInputLayer.strides);
-    // Allocate buffer size needed for the tensor
-    CHECK_CUDA_ERROR(cudaMalloc(&bufInputLayer.basePtr, inputLayerSize));
-    // Wrap the tensor as a CVCUDA tensor
-    nvcv::TensorDataStridedCuda inputLayerTensorData(
-        nvcv::TensorShape{reqsInputLayer.shape, reqsInputLayer.rank, reqsInputLayer.layout},
-        nvcv::DataType{reqsInputLayer.dtype}, bufInputLayer);
-    nvcv::TensorWrapData inputLayerTensor(inputLayerTensorData);
-
-    // Allocate ouput layer buffer based on the output layer dimensions and batch size
-    nvcv::Tensor::Requirements reqsOutputLayer
-        = nvcv::Tensor::CalcRequirements(batchSize, {outputDims.width, 1}, nvcv::FMT_RGBf32p);
-    int64_t outputLayerSize = CalcTotalSizeBytes(nvcv::Requirements{reqsOutputLayer.mem}.cudaMem());
-    nvcv::TensorDataStridedCuda::Buffer bufOutputLayer;
-    std::copy(reqsOutputLayer.strides, reqsOutputLayer.strides + NVCV_TENSOR_MAX_RANK, bufOutputLayer.strides);
-    CHECK_CUDA_ERROR(cudaMalloc(&bufOutputLayer.basePtr, outputLayerSize));
-    nvcv::TensorDataStridedCuda outputLayerTensorData(
-        nvcv::TensorShape{reqsOutputLayer.shape, reqsOutputLayer.rank, reqsOutputLayer.layout},
-        nvcv::DataType{reqsOutputLayer.dtype}, bufOutputLayer);
-    nvcv::TensorWrapData outputLayerTensor(outputLayerTensorData);
-
-    // Run preprocess on the input image batch
-    PreProcess(inTensor, batchSize, inputDims.width, inputDims.height, stream, inputLayerTensor);
-
-    // Setup the TensortRT Buffer needed for inference
-    const auto *inputData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inputLayerTensor.exportData());
-    const auto *outputData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outputLayerTensor.exportData());
-
-    buffers[inputBindingIndex]  = inputData->basePtr();
-    buffers[outputBindingIndex] = outputData->basePtr();
-
-#ifdef PROFILE_SAMPLE
-    cudaEvent_t start, stop;
-    cudaEventCreate(&start);
-    cudaEventCreate(&stop);
-    cudaEventRecord(start);
-#endif
-    // Inference call
-    trtBackend->infer(&buffers[inputBindingIndex], batchSize, stream);
-#ifdef PROFILE_SAMPLE
-    cudaEventRecord(stop);
-    cudaEventSynchronize(stop);
-    float inferms = 0;
-    cudaEventElapsedTime(&inferms, start, stop);
-    std::cout << "Time for Inference : " << inferms << " ms" << std::endl;
-#endif
-
-    // Post Process to normalize and sort the classifications scores
-    uint32_t                        numClasses = outputDims.width;
-    std::vector<std::vector<float>> scores(batchSize, std::vector<float>(numClasses));
-    std::vector<std::vector<int>>   indices(batchSize, std::vector<int>(numClasses));
-    PostProcess((float *)outputData->basePtr(), scores, indices, stream);
-
-    // Display Results
-    DisplayResults(scores, indices, labelPath);
+    // Each batch in flight has its own input, intermediate and network buffers, and its own pinned
+    // buffer where the TopN scores and indices are downloaded, the full scores never leave the device
+    const int64_t topScoresBytes  = batchSize * TOPN * sizeof(float);
+    const int64_t topIndicesBytes = batchSize * TOPN * sizeof(int);
+
+    std::vector<std::unique_ptr<BatchBuffers>> batches;
+    std::vector<std::vector<void *>>           trtBuffers(numSlots, std::vector<void *>(numBindings));
+    for (uint32_t slot = 0; slot < numSlots; ++slot)
+    {
+        batches.emplace_back(new BatchBuffers(batchSize, inLayout, inReqs, inputDims, outputDims));
+
+        const auto *inputData
+            = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(batches[slot]->inputLayerTensor.exportData());
+        const auto *outputData
+            = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(batches[slot]->outputLayerTensor.exportData());
+
+        trtBuffers[slot][inputBindingIndex]  = inputData->basePtr();
+        trtBuffers[slot][outputBindingIndex] = outputData->basePtr();
+    }
+    PinnedBufferRing hostResults(numSlots, topScoresBytes + topIndicesBytes);
+
+    auto upload = [&](int slot, cudaStream_t stream)
+    {
+        CHECK_CUDA_ERROR(cudaMemcpyAsync(batches[slot]->inBuf.basePtr, decodedImages, inBatchBytes,
+                                         cudaMemcpyDeviceToDevice, stream));
+    };
+    auto preprocess = [&](int slot, cudaStream_t stream)
+    {
+        PreProcess(batches[slot]->inTensor, batches[slot]->preprocess, stream, batches[slot]->inputLayerTensor);
+    };
+    auto inference = [&](int slot, cudaStream_t stream)
+    {
+        trtBackend->infer(&trtBuffers[slot][inputBindingIndex], batchSize, stream);
+    };
+    auto postprocess = [&](int slot, cudaStream_t stream)
+    {
+        PostProcess(batches[slot]->outputLayerTensor, stream, batches[slot]->topScores, batches[slot]->topIndices);
+    };
+    auto download = [&](int slot, cudaStream_t stream)
+    {
+        const auto *scoreData
+            = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(batches[slot]->topScores.exportData());
+        const auto *indexData
+            = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(batches[slot]->topIndices.exportData());
+
+        uint8_t *dst = static_cast<uint8_t *>(hostResults[slot]);
+        CHECK_CUDA_ERROR(cudaMemcpy2DAsync(dst, TOPN * sizeof(float), scoreData->basePtr(), scoreData->stride(0),
+                                           TOPN * sizeof(float), batchSize, cudaMemcpyDeviceToHost, stream));
+        CHECK_CUDA_ERROR(cudaMemcpy2DAsync(dst + topScoresBytes, TOPN * sizeof(int), indexData->basePtr(),
+                                           indexData->stride(0), TOPN * sizeof(int), batchSize,
+                                           cudaMemcpyDeviceToHost, stream));
+    };
+
+    std::vector<PipelineStage> stages{
+        {     "Upload",      upload},
+        { "Preprocess",  preprocess},
+        {  "Inference",   inference},
+        {"Postprocess", postprocess},
+        {   "Download",    download},
+    };
+
+    // The results are displayed once the batch is downloaded.
+    // All batches hold the same images, the results of the first one are displayed.
+    std::vector<std::vector<float>> scores(batchSize, std::vector<float>(TOPN));
+    std::vector<std::vector<int>>   indices(batchSize, std::vector<int>(TOPN));
+
+    auto retire = [&](int slot, int64_t batch)
+    {
+        if (batch == 0)
+        {
+            const uint8_t *src         = static_cast<const uint8_t *>(hostResults[slot]);
+            const float   *hostScores  = reinterpret_cast<const float *>(src);
+            const int     *hostIndices = reinterpret_cast<const int *>(src + topScoresBytes);
+            for (uint32_t i = 0; i < batchSize; i++)
+            {
+                std::copy(hostScores + i * TOPN, hostScores + (i + 1) * TOPN, scores[i].begin());
+                std::copy(hostIndices + i * TOPN, hostIndices + (i + 1) * TOPN, indices[i].begin());
+            }
+            DisplayResults(scores, indices, labelPath);
+        }
+    };
+
+    Pipeline pipeline(std::move(stages), numSlots, retire);
+
+    // The warm-up batches, e.g. TensorRT's first inferences, aren't accounted in the reported times
+    RunBenchmark(pipeline, batchSize, numWarmup, numBatches);
 
     // Clean up
-    CHECK_CUDA_ERROR(cudaStreamDestroy(stream));
+    CHECK_CUDA_ERROR(cudaFree(decodedImages));
 }
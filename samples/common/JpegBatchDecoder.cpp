@@ -0,0 +1,208 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "JpegBatchDecoder.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+void CheckCuda(cudaError_t code, const char *call)
+{
+    if (code != cudaSuccess)
+    {
+        throw std::runtime_error(std::string("JpegBatchDecoder: ") + call + " failed: " + cudaGetErrorString(code));
+    }
+}
+
+void CheckNvjpeg(nvjpegStatus_t status, const char *call)
+{
+    if (status != NVJPEG_STATUS_SUCCESS)
+    {
+        throw std::runtime_error(std::string("JpegBatchDecoder: ") + call + " failed with status "
+                                 + std::to_string(static_cast<int>(status)));
+    }
+}
+
+} // namespace
+
+JpegBatchDecoder::JpegBatchDecoder(int maxBatchSize)
+    : m_maxBatchSize(maxBatchSize)
+    , m_hardware(true)
+{
+    if (m_maxBatchSize < 1)
+    {
+        throw std::invalid_argument("JpegBatchDecoder: maximum batch size must be positive");
+    }
+
+    nvjpegStatus_t status = nvjpegCreateEx(NVJPEG_BACKEND_HARDWARE, nullptr, nullptr, NVJPEG_FLAGS_DEFAULT, &m_handle);
+    if (status == NVJPEG_STATUS_ARCH_MISMATCH)
+    {
+        m_hardware = false;
+        status     = nvjpegCreateEx(NVJPEG_BACKEND_DEFAULT, nullptr, nullptr, NVJPEG_FLAGS_DEFAULT, &m_handle);
+    }
+    CheckNvjpeg(status, "nvjpegCreateEx");
+
+    CheckNvjpeg(nvjpegJpegStateCreate(m_handle, &m_batchedState), "nvjpegJpegStateCreate");
+
+    CheckNvjpeg(nvjpegDecoderCreate(m_handle, NVJPEG_BACKEND_DEFAULT, &m_decoder), "nvjpegDecoderCreate");
+    CheckNvjpeg(nvjpegDecoderStateCreate(m_handle, m_decoder, &m_decoderState), "nvjpegDecoderStateCreate");
+    CheckNvjpeg(nvjpegBufferDeviceCreate(m_handle, nullptr, &m_deviceBuffer), "nvjpegBufferDeviceCreate");
+    CheckNvjpeg(nvjpegStateAttachDeviceBuffer(m_decoderState, m_deviceBuffer), "nvjpegStateAttachDeviceBuffer");
+    CheckNvjpeg(nvjpegDecodeParamsCreate(m_handle, &m_decodeParams), "nvjpegDecodeParamsCreate");
+    CheckNvjpeg(nvjpegDecodeParamsSetOutputFormat(m_decodeParams, NVJPEG_OUTPUT_RGBI),
+                "nvjpegDecodeParamsSetOutputFormat");
+
+    for (int b = 0; b < 2; ++b)
+    {
+        CheckNvjpeg(nvjpegBufferPinnedCreate(m_handle, nullptr, &m_pinnedBuffers[b]), "nvjpegBufferPinnedCreate");
+        CheckNvjpeg(nvjpegJpegStreamCreate(m_handle, &m_jpegStreams[b]), "nvjpegJpegStreamCreate");
+        CheckCuda(cudaEventCreateWithFlags(&m_pinnedBufferDone[b], cudaEventDisableTiming), "cudaEventCreate");
+    }
+
+    m_images.reserve(m_maxBatchSize);
+}
+
+JpegBatchDecoder::~JpegBatchDecoder()
+{
+    // Pending decodes use the buffers below
+    for (int b = 0; b < 2; ++b)
+    {
+        cudaEventSynchronize(m_pinnedBufferDone[b]);
+        cudaEventDestroy(m_pinnedBufferDone[b]);
+        nvjpegJpegStreamDestroy(m_jpegStreams[b]);
+        nvjpegBufferPinnedDestroy(m_pinnedBuffers[b]);
+    }
+
+    nvjpegDecodeParamsDestroy(m_decodeParams);
+    nvjpegBufferDeviceDestroy(m_deviceBuffer);
+    nvjpegJpegStateDestroy(m_decoderState);
+    nvjpegDecoderDestroy(m_decoder);
+    nvjpegJpegStateDestroy(m_batchedState);
+    nvjpegDestroy(m_handle);
+}
+
+int JpegBatchDecoder::maxBatchSize() const
+{
+    return m_maxBatchSize;
+}
+
+bool JpegBatchDecoder::hardwareDecode() const
+{
+    return m_hardware;
+}
+
+void JpegBatchDecoder::decode(const std::vector<const uint8_t *> &bitstreams, const std::vector<size_t> &lengths,
+                              nvcv::ImageBatchVarShape &out, cudaStream_t stream)
+{
+    const int numImages = static_cast<int>(bitstreams.size());
+    if (lengths.size() != bitstreams.size() || numImages > m_maxBatchSize || numImages > out.capacity())
+    {
+        throw std::invalid_argument("JpegBatchDecoder: there must be one length per bitstream, and no more "
+                                    "bitstreams than the maximum batch size and the output capacity");
+    }
+
+    // Buffers of the previous batch go back to the pool, its readers are ordered before the decode on the stream
+    out.clear();
+    m_images.clear();
+
+    std::vector<const unsigned char *> batchedBitstreams, otherBitstreams;
+    std::vector<size_t>                batchedLengths, otherLengths;
+    std::vector<nvjpegImage_t>         batchedOutput, otherOutput;
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        int                       widths[NVJPEG_MAX_COMPONENT];
+        int                       heights[NVJPEG_MAX_COMPONENT];
+        int                       channels;
+        nvjpegChromaSubsampling_t subsampling;
+        CheckNvjpeg(nvjpegGetImageInfo(m_handle, bitstreams[i], lengths[i], &channels, &subsampling, widths, heights),
+                    "nvjpegGetImageInfo");
+
+        m_images.push_back(m_pool.acquire(nvcv::Size2D{widths[0], heights[0]}, nvcv::FMT_RGB8));
+
+        auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(m_images.back()->exportData());
+        if (data == nullptr)
+        {
+            throw std::runtime_error("JpegBatchDecoder: pool images must be cuda-accessible, pitch-linear");
+        }
+
+        nvjpegImage_t image = {};
+        image.channel[0]    = reinterpret_cast<unsigned char *>(data->plane(0).basePtr);
+        image.pitch[0]      = data->plane(0).rowStride;
+
+        int batchedSupported = -1;
+        if (m_hardware)
+        {
+            CheckNvjpeg(nvjpegJpegStreamParseHeader(m_handle, bitstreams[i], lengths[i], m_jpegStreams[0]),
+                        "nvjpegJpegStreamParseHeader");
+            CheckNvjpeg(nvjpegDecodeBatchedSupported(m_handle, m_jpegStreams[0], &batchedSupported),
+                        "nvjpegDecodeBatchedSupported");
+        }
+
+        // 0 means supported
+        if (batchedSupported == 0)
+        {
+            batchedBitstreams.push_back(bitstreams[i]);
+            batchedLengths.push_back(lengths[i]);
+            batchedOutput.push_back(image);
+        }
+        else
+        {
+            otherBitstreams.push_back(bitstreams[i]);
+            otherLengths.push_back(lengths[i]);
+            otherOutput.push_back(image);
+        }
+    }
+
+    if (!batchedBitstreams.empty())
+    {
+        CheckNvjpeg(nvjpegDecodeBatchedInitialize(m_handle, m_batchedState, static_cast<int>(batchedBitstreams.size()),
+                                                  1, NVJPEG_OUTPUT_RGBI),
+                    "nvjpegDecodeBatchedInitialize");
+        CheckNvjpeg(nvjpegDecodeBatched(m_handle, m_batchedState, batchedBitstreams.data(), batchedLengths.data(),
+                                        batchedOutput.data(), stream),
+                    "nvjpegDecodeBatched");
+    }
+
+    for (size_t i = 0; i < otherBitstreams.size(); ++i)
+    {
+        const int b = m_nextBuffer;
+        m_nextBuffer = 1 - m_nextBuffer;
+
+        // Only waits for the transfer from this pinned buffer, two images ago
+        CheckCuda(cudaEventSynchronize(m_pinnedBufferDone[b]), "cudaEventSynchronize");
+
+        CheckNvjpeg(nvjpegJpegStreamParse(m_handle, otherBitstreams[i], otherLengths[i], 0, 0, m_jpegStreams[b]),
+                    "nvjpegJpegStreamParse");
+        CheckNvjpeg(nvjpegStateAttachPinnedBuffer(m_decoderState, m_pinnedBuffers[b]),
+                    "nvjpegStateAttachPinnedBuffer");
+        CheckNvjpeg(nvjpegDecodeJpegHost(m_handle, m_decoder, m_decoderState, m_decodeParams, m_jpegStreams[b]),
+                    "nvjpegDecodeJpegHost");
+        CheckNvjpeg(nvjpegDecodeJpegTransferToDevice(m_handle, m_decoder, m_decoderState, m_jpegStreams[b], stream),
+                    "nvjpegDecodeJpegTransferToDevice");
+        CheckCuda(cudaEventRecord(m_pinnedBufferDone[b], stream), "cudaEventRecord");
+        CheckNvjpeg(nvjpegDecodeJpegDevice(m_handle, m_decoder, m_decoderState, &otherOutput[i], stream),
+                    "nvjpegDecodeJpegDevice");
+    }
+
+    for (const std::unique_ptr<nvcv::ImageWrapData> &image : m_images)
+    {
+        out.pushBack(*image);
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file JpegBatchDecoder.h
+ *
+ * @brief Batched JPEG decoder writing into pooled images of a varshape batch
+ */
+
+#ifndef NVCV_JPEGBATCHDECODER_H
+#define NVCV_JPEGBATCHDECODER_H
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/ImagePool.hpp>
+#include <nvjpeg.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * Decodes batches of JPEG images to RGB8 images of an ImageBatchVarShape, without any copy nor host synchronization
+ * between the decoder and the consumers of the batch.
+ *
+ * Images supported by the hardware decoder are decoded in a single batched call, the others with the hybrid
+ * decoder, one after the other. Images come from an ImagePool, so that no allocation happens once the pool is warm.
+ * The nvjpeg handles are created once, by the constructor.
+ *
+ * The images of a batch are kept until the next decode, which gives their buffers back to the pool. Work reading
+ * them must be enqueued on the decode stream, or complete before the next decode.
+ */
+class JpegBatchDecoder
+{
+public:
+    /**
+     * Constructor of JpegBatchDecoder.
+     * @param maxBatchSize maximum number of images decoded at once.
+     */
+    explicit JpegBatchDecoder(int maxBatchSize);
+
+    ~JpegBatchDecoder();
+
+    JpegBatchDecoder(const JpegBatchDecoder &)            = delete;
+    JpegBatchDecoder &operator=(const JpegBatchDecoder &) = delete;
+
+    /**
+     * Enqueues the decoding of JPEG bitstreams on the given stream.
+     * @param bitstreams bitstreams of the images, they must stay valid until the call returns.
+     * @param lengths lengths of the bitstreams, in bytes.
+     * @param out batch receiving the RGB8 images, in the order of the bitstreams, after being cleared.
+     *            Its capacity must be at least the number of bitstreams.
+     * @param stream stream on which the decoding is enqueued.
+     */
+    void decode(const std::vector<const uint8_t *> &bitstreams, const std::vector<size_t> &lengths,
+                nvcv::ImageBatchVarShape &out, cudaStream_t stream);
+
+    int maxBatchSize() const;
+
+    /**
+     * Whether images are decoded by the hardware decoder, when they're supported by it.
+     */
+    bool hardwareDecode() const;
+
+private:
+    int  m_maxBatchSize;
+    bool m_hardware;
+
+    nvjpegHandle_t    m_handle;
+    nvjpegJpegState_t m_batchedState;
+
+    // Hybrid decoder, double buffered so that the host decoding of an image overlaps the device decoding of the
+    // previous one
+    nvjpegJpegDecoder_t  m_decoder;
+    nvjpegJpegState_t    m_decoderState;
+    nvjpegBufferPinned_t m_pinnedBuffers[2];
+    nvjpegBufferDevice_t m_deviceBuffer;
+    nvjpegJpegStream_t   m_jpegStreams[2];
+    nvjpegDecodeParams_t m_decodeParams;
+    cudaEvent_t          m_pinnedBufferDone[2];
+    int                  m_nextBuffer = 0;
+
+    nvcv::ImagePool                                   m_pool;
+    std::vector<std::unique_ptr<nvcv::ImageWrapData>> m_images;
+};
+
+#endif // NVCV_JPEGBATCHDECODER_H
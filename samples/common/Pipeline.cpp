@@ -0,0 +1,239 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Pipeline.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+
+void CheckCuda(cudaError_t code, const char *call)
+{
+    if (code != cudaSuccess)
+    {
+        throw std::runtime_error(std::string("Pipeline: ") + call + " failed: " + cudaGetErrorString(code));
+    }
+}
+
+} // namespace
+
+Pipeline::Pipeline(std::vector<PipelineStage> stages, int numSlots, RetireFn retire)
+    : m_stages(std::move(stages))
+    , m_numSlots(numSlots)
+    , m_retire(std::move(retire))
+{
+    if (m_stages.empty() || m_numSlots < 1)
+    {
+        throw std::invalid_argument("Pipeline: it needs at least one stage and one slot");
+    }
+
+    m_streams.resize(m_stages.size());
+    m_startEvents.resize(m_stages.size() * m_numSlots);
+    m_doneEvents.resize(m_stages.size() * m_numSlots);
+    m_stageTotalMs.resize(m_stages.size(), 0.0);
+
+    // Non-blocking streams don't synchronize with work that other components might enqueue on the default stream
+    for (cudaStream_t &stream : m_streams)
+    {
+        CheckCuda(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking), "cudaStreamCreateWithFlags");
+    }
+    for (size_t i = 0; i < m_doneEvents.size(); ++i)
+    {
+        CheckCuda(cudaEventCreate(&m_startEvents[i]), "cudaEventCreate");
+        CheckCuda(cudaEventCreate(&m_doneEvents[i]), "cudaEventCreate");
+    }
+}
+
+Pipeline::~Pipeline()
+{
+    for (cudaStream_t stream : m_streams)
+    {
+        cudaStreamSynchronize(stream);
+        cudaStreamDestroy(stream);
+    }
+    for (size_t i = 0; i < m_doneEvents.size(); ++i)
+    {
+        cudaEventDestroy(m_startEvents[i]);
+        cudaEventDestroy(m_doneEvents[i]);
+    }
+}
+
+int Pipeline::submit()
+{
+    if (m_numSubmitted - m_numRetired == m_numSlots)
+    {
+        retireOldest();
+    }
+
+    const int slot = static_cast<int>(m_numSubmitted % m_numSlots);
+
+    // Only the enqueueing is host overhead, waiting for a free slot above is the device being busy
+    auto cpuStart = std::chrono::steady_clock::now();
+
+    for (size_t s = 0; s < m_stages.size(); ++s)
+    {
+        cudaStream_t stream = m_streams[s];
+
+        // Hand the batch over from the previous stage, the stream keeps running the previous batches meanwhile
+        if (s > 0)
+        {
+            CheckCuda(cudaStreamWaitEvent(stream, m_doneEvents[(s - 1) * m_numSlots + slot], 0),
+                      "cudaStreamWaitEvent");
+        }
+        CheckCuda(cudaEventRecord(m_startEvents[s * m_numSlots + slot], stream), "cudaEventRecord");
+
+        m_stages[s].run(slot, stream);
+
+        CheckCuda(cudaEventRecord(m_doneEvents[s * m_numSlots + slot], stream), "cudaEventRecord");
+    }
+
+    m_cpuTotalMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - cpuStart).count();
+    ++m_numCpuTimed;
+    ++m_numSubmitted;
+    return slot;
+}
+
+void Pipeline::flush()
+{
+    while (m_numRetired < m_numSubmitted)
+    {
+        retireOldest();
+    }
+}
+
+void Pipeline::retireOldest()
+{
+    const int slot = static_cast<int>(m_numRetired % m_numSlots);
+
+    // Stages run in order, the last one completing means the whole batch did
+    CheckCuda(cudaEventSynchronize(m_doneEvents[(m_stages.size() - 1) * m_numSlots + slot]), "cudaEventSynchronize");
+
+    for (size_t s = 0; s < m_stages.size(); ++s)
+    {
+        float ms = 0;
+        CheckCuda(cudaEventElapsedTime(&ms, m_startEvents[s * m_numSlots + slot], m_doneEvents[s * m_numSlots + slot]),
+                  "cudaEventElapsedTime");
+        m_stageTotalMs[s] += ms;
+    }
+    ++m_numTimed;
+
+    if (m_retire)
+    {
+        m_retire(slot, m_numRetired);
+    }
+    ++m_numRetired;
+}
+
+int Pipeline::numSlots() const
+{
+    return m_numSlots;
+}
+
+cudaStream_t Pipeline::stream(int stage) const
+{
+    return m_streams.at(stage);
+}
+
+float Pipeline::stageTimeMs(int stage) const
+{
+    return m_numTimed == 0 ? 0.f : static_cast<float>(m_stageTotalMs.at(stage) / m_numTimed);
+}
+
+float Pipeline::cpuTimeMs() const
+{
+    return m_numCpuTimed == 0 ? 0.f : static_cast<float>(m_cpuTotalMs / m_numCpuTimed);
+}
+
+void Pipeline::printStageTimes() const
+{
+    for (size_t s = 0; s < m_stages.size(); ++s)
+    {
+        std::cout << "Time for " << m_stages[s].name << " : " << stageTimeMs(s) << " ms" << std::endl;
+    }
+}
+
+void Pipeline::resetStats()
+{
+    if (m_numRetired != m_numSubmitted)
+    {
+        throw std::logic_error("Pipeline: stats can't be reset with batches in flight");
+    }
+
+    std::fill(m_stageTotalMs.begin(), m_stageTotalMs.end(), 0.0);
+    m_cpuTotalMs  = 0;
+    m_numTimed    = 0;
+    m_numCpuTimed = 0;
+}
+
+void RunBenchmark(Pipeline &pipeline, int batchSize, int64_t numWarmup, int64_t numTimed)
+{
+    for (int64_t b = 0; b < numWarmup; ++b)
+    {
+        pipeline.submit();
+    }
+    pipeline.flush();
+    pipeline.resetStats();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int64_t b = 0; b < numTimed; ++b)
+    {
+        pipeline.submit();
+    }
+    pipeline.flush();
+    auto stop = std::chrono::steady_clock::now();
+
+    double totalMs = std::chrono::duration<double, std::milli>(stop - start).count();
+
+    std::cout << std::endl;
+    std::cout << "Average GPU time per batch of " << batchSize << " images, over " << numTimed << " batches after "
+              << numWarmup << " warm-up ones" << std::endl;
+    pipeline.printStageTimes();
+    std::cout << "CPU time per batch : " << pipeline.cpuTimeMs() << " ms" << std::endl;
+    std::cout << "Throughput : " << (totalMs > 0 ? numTimed * batchSize * 1000.0 / totalMs : 0) << " images/s with "
+              << pipeline.numSlots() << " batches in flight" << std::endl;
+}
+
+PinnedBufferRing::PinnedBufferRing(int numSlots, size_t slotBytes)
+    : m_buffers(numSlots, nullptr)
+    , m_slotBytes(slotBytes)
+{
+    for (void *&buffer : m_buffers)
+    {
+        CheckCuda(cudaHostAlloc(&buffer, m_slotBytes, cudaHostAllocDefault), "cudaHostAlloc");
+    }
+}
+
+PinnedBufferRing::~PinnedBufferRing()
+{
+    for (void *buffer : m_buffers)
+    {
+        cudaFreeHost(buffer);
+    }
+}
+
+void *PinnedBufferRing::operator[](int slot) const
+{
+    return m_buffers.at(slot);
+}
+
+size_t PinnedBufferRing::slotBytes() const
+{
+    return m_slotBytes;
+}
@@ -0,0 +1,201 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Pipeline.h
+ *
+ * @brief Multi-stream pipeline keeping several batches in flight
+ */
+
+#ifndef NVCV_PIPELINE_H
+#define NVCV_PIPELINE_H
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * One stage of a pipeline, e.g. decode, preprocess, inference or download.
+ */
+struct PipelineStage
+{
+    std::string name; /**< stage name, used in reports. */
+
+    /**
+     * Enqueues the work of the stage for the batch in the given slot.
+     * It must only use the buffers of that slot, and only enqueue work on the given stream.
+     */
+    std::function<void(int slot, cudaStream_t stream)> run;
+};
+
+/**
+ * Pipeline running its stages on batches, with up to numSlots batches in flight.
+ *
+ * Each stage has its own stream, and each batch in flight has its own slot, whose buffers are owned by the caller.
+ * A stage waits on an event recorded after the previous stage of the same batch, so the stages of different
+ * batches overlap. A slot is reused once its previous batch went through all the stages, which is when the
+ * batch is retired and its results can be read.
+ */
+class Pipeline
+{
+public:
+    /**
+     * Called once all the stages of a batch completed, before its slot is reused.
+     * @param slot slot of the batch.
+     * @param batch index of the batch, in submission order.
+     */
+    using RetireFn = std::function<void(int slot, int64_t batch)>;
+
+    /**
+     * Constructor of Pipeline.
+     * @param stages stages run on each batch, in order.
+     * @param numSlots maximum number of batches in flight, use 2 for double buffering.
+     * @param retire callback for retired batches, can be empty.
+     */
+    Pipeline(std::vector<PipelineStage> stages, int numSlots, RetireFn retire = nullptr);
+
+    /**
+     * Destructor of Pipeline, waits for the batches in flight without retiring them.
+     */
+    ~Pipeline();
+
+    Pipeline(const Pipeline &)            = delete;
+    Pipeline &operator=(const Pipeline &) = delete;
+
+    /**
+     * Enqueues all the stages of a new batch.
+     * When all slots are in use, the oldest batch is waited for and retired first.
+     * @return slot of the new batch.
+     */
+    int submit();
+
+    /**
+     * Waits for all batches in flight and retires them, in submission order.
+     */
+    void flush();
+
+    /**
+     * Get the number of slots.
+     * @return maximum number of batches in flight.
+     */
+    int numSlots() const;
+
+    /**
+     * Get the stream of a stage.
+     * @param stage stage index.
+     * @return stream the stage runs on.
+     */
+    cudaStream_t stream(int stage) const;
+
+    /**
+     * Get the average GPU time of a stage over the retired batches.
+     * Host work done by a stage before it enqueues its GPU work isn't accounted.
+     * @param stage stage index.
+     * @return time in milliseconds.
+     */
+    float stageTimeMs(int stage) const;
+
+    /**
+     * Get the average host time spent enqueueing the stages of a batch, i.e. the CPU overhead of the pipeline.
+     * @return time in milliseconds.
+     */
+    float cpuTimeMs() const;
+
+    /**
+     * Print the average time of each stage.
+     */
+    void printStageTimes() const;
+
+    /**
+     * Reset the times of the stages, so that batches submitted so far aren't accounted, e.g. warm-up ones.
+     * It must only be called when there's no batch in flight, e.g. after flush().
+     */
+    void resetStats();
+
+private:
+    void retireOldest();
+
+    std::vector<PipelineStage> m_stages;
+    int                        m_numSlots;
+    RetireFn                   m_retire;
+
+    std::vector<cudaStream_t> m_streams;
+    // Events indexed by stage * m_numSlots + slot
+    std::vector<cudaEvent_t> m_startEvents;
+    std::vector<cudaEvent_t> m_doneEvents;
+    std::vector<double>      m_stageTotalMs;
+    double                   m_cpuTotalMs = 0;
+
+    // Batches accounted in the stage and CPU times are the ones retired and submitted since the last reset
+    int64_t m_numSubmitted = 0;
+    int64_t m_numRetired   = 0;
+    int64_t m_numTimed     = 0;
+    int64_t m_numCpuTimed  = 0;
+};
+
+/**
+ * Benchmark the pipeline: submits numWarmup batches, then numTimed batches whose throughput, average GPU time per
+ * stage and CPU time per batch are printed.
+ * @param pipeline pipeline to run, without batches in flight.
+ * @param batchSize number of images per batch, for the throughput.
+ * @param numWarmup number of batches run before timing, e.g. so that lazy initialization isn't timed.
+ * @param numTimed number of timed batches.
+ */
+void RunBenchmark(Pipeline &pipeline, int batchSize, int64_t numWarmup, int64_t numTimed);
+
+/**
+ * Ring of pinned host buffers, one per pipeline slot, where the last stage downloads the results of its batch.
+ * The memory isn't write-combined so that the CPU can read it efficiently.
+ */
+class PinnedBufferRing
+{
+public:
+    /**
+     * Constructor of PinnedBufferRing.
+     * @param numSlots number of buffers, usually the number of pipeline slots.
+     * @param slotBytes size of each buffer in bytes.
+     */
+    PinnedBufferRing(int numSlots, size_t slotBytes);
+
+    ~PinnedBufferRing();
+
+    PinnedBufferRing(const PinnedBufferRing &)            = delete;
+    PinnedBufferRing &operator=(const PinnedBufferRing &) = delete;
+
+    /**
+     * Get the buffer of a slot.
+     * @param slot slot index.
+     * @return pinned host buffer.
+     */
+    void *operator[](int slot) const;
+
+    /**
+     * Get the size of each buffer.
+     * @return size in bytes.
+     */
+    size_t slotBytes() const;
+
+private:
+    std::vector<void *> m_buffers;
+    size_t              m_slotBytes;
+};
+
+#endif // NVCV_PIPELINE_H
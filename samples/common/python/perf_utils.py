@@ -0,0 +1,93 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+perf_utils
+
+This file hosts utilities to benchmark the sample pipelines.
+"""
+
+
+import time
+import torch
+
+
+class StageTimer:
+    """
+    Times the stages of the batches of a pipeline. The GPU time of each stage is
+    measured with CUDA events recorded on the current torch stream between the
+    stages, the CPU time is the host time spent running the batch, including the
+    waits of synchronous calls. The first num_warmup batches aren't accounted.
+    """
+
+    def __init__(self, device_id, num_warmup=0):
+        self.device_id = device_id
+        self.num_warmup = num_warmup
+        self.num_batches = 0
+        self.num_timed = 0
+        self.num_images = 0
+        self.stage_ms = {}
+        self.cpu_ms = 0.0
+        self.timed_start = None
+        self.elapsed_s = 0.0
+
+    def _record(self):
+        event = torch.cuda.Event(enable_timing=True)
+        event.record(torch.cuda.current_stream(self.device_id))
+        return event
+
+    def begin_batch(self):
+        self.cpu_start = time.perf_counter()
+        if self.num_batches == self.num_warmup:
+            self.timed_start = self.cpu_start
+        self.events = [self._record()]
+        self.names = []
+
+    def mark(self, stage_name):
+        # Ends the stage started by the previous mark, or by begin_batch.
+        self.events.append(self._record())
+        self.names.append(stage_name)
+
+    def end_batch(self, batch_size):
+        cpu_ms = (time.perf_counter() - self.cpu_start) * 1000
+        self.events[-1].synchronize()
+
+        if self.num_batches >= self.num_warmup:
+            for name, start, stop in zip(self.names, self.events, self.events[1:]):
+                self.stage_ms[name] = self.stage_ms.get(name, 0.0) + start.elapsed_time(
+                    stop
+                )
+            self.cpu_ms += cpu_ms
+            self.num_timed += 1
+            self.num_images += batch_size
+            self.elapsed_s = time.perf_counter() - self.timed_start
+        self.num_batches += 1
+
+    def report(self):
+        if self.num_timed == 0:
+            print("No batch was timed, after %d warm-up ones." % self.num_batches)
+            return
+
+        print(
+            "Average times per batch, over %d batches after %d warm-up ones:"
+            % (self.num_timed, self.num_warmup)
+        )
+        for name, total_ms in self.stage_ms.items():
+            print("\tGPU time for %s : %.3f ms" % (name, total_ms / self.num_timed))
+        print("\tCPU time : %.3f ms" % (self.cpu_ms / self.num_timed))
+        print(
+            "Throughput : %.1f images/s"
+            % (self.num_images / self.elapsed_s if self.elapsed_s > 0 else 0)
+        )
@@ -23,11 +23,46 @@ This file hosts various Video Processing Framework(VPF) related utilities.
 import av
 import torch
 import numpy as np
+import cvcuda
 from fractions import Fraction
 import PyNvCodec as nvc
 import PytorchNvCodec as pnvc
 
 
+class nv12surface:
+    """
+    Exposes the NV12 plane of a decoded surface through the CUDA array interface,
+    so that CV-CUDA can wrap it in place, with the decoder pitch, as a
+    (1, 3 * height / 2, width, 1) tensor.
+    """
+
+    def __init__(self, surface: nvc.Surface):
+        plane = surface.PlanePtr()
+        self.__cuda_array_interface__ = {
+            "shape": (1, plane.Height(), plane.Width(), 1),
+            "strides": (plane.Height() * plane.Pitch(), plane.Pitch(), 1, 1),
+            "typestr": "|u1",
+            "data": (plane.GpuMem(), False),
+            "version": 3,
+        }
+
+
+class surfacelease:
+    """
+    Keeps a decoded surface alive until the CV-CUDA work reading it is done.
+    The release event is recorded on the CV-CUDA stream after the last reader,
+    so releasing never waits on the host.
+    """
+
+    def __init__(self, surface: nvc.Surface, stream: cvcuda.Stream):
+        self.surface = surface
+        self.done = torch.cuda.Event()
+        self.done.record(torch.cuda.ExternalStream(stream.handle))
+
+    def released(self) -> bool:
+        return self.done.query()
+
+
 class nvdecoder:
     def __init__(self, enc_file: str, gpu_id: int):
         """
@@ -121,6 +156,10 @@ class nvdecoder:
         else:
             self.to_sar = None
 
+        # Surfaces handed to CV-CUDA without a copy, until their readers are done.
+        self.is_yuv420 = is_yuv420
+        self.leases = []
+
     def decode_sw(self, dec_frame, *args, **kwargs) -> nvc.Surface:
         """
         This is called when input video isn't supported by Nvdec HW.
@@ -185,6 +224,49 @@ class nvdecoder:
 
         return rgb_pln
 
+    def decode_batch_to_tensor(
+        self, batch_size: int, stream: cvcuda.Stream = None
+    ) -> torch.Tensor:
+        """
+        Decode batch_size video frames to a torch.cuda.ByteTensor of shape
+        (batch_size, height, width, 3), with packed RGB frames.
+        Nvdec NV12 surfaces are converted by CV-CUDA straight into the batch,
+        without intermediate copies or host synchronization. Other videos are
+        decoded frame by frame with decode_to_tensor.
+        """
+        if stream is None:
+            stream = cvcuda.Stream.current
+
+        if not self.is_hw_dec or not self.is_yuv420 or self.to_sar is not None:
+            frames = torch.stack(
+                [self.decode_to_tensor() for i in range(batch_size)]
+            )
+            return frames.permute(0, 2, 3, 1).contiguous()
+
+        # Surfaces of frames converted by previous batches go back to the decoder.
+        self.leases = [lease for lease in self.leases if not lease.released()]
+
+        frames = torch.empty(
+            (batch_size, self.h, self.w, 3),
+            dtype=torch.uint8,
+            device="cuda:%d" % self.device_id,
+        )
+
+        for i in range(batch_size):
+            dec_surface = self.nvDec.DecodeSingleSurface()
+            if not dec_surface or dec_surface.Empty():
+                raise RuntimeError("Can not decode frame.")
+
+            cvcuda.cvtcolor_into(
+                cvcuda.as_tensor(frames[i : i + 1], "NHWC"),  # noqa: E203
+                cvcuda.as_tensor(nv12surface(dec_surface), "NHWC"),
+                cvcuda.ColorConversion.YUV2RGB_NV12,
+                stream=stream,
+            )
+            self.leases.append(surfacelease(dec_surface, stream))
+
+        return frames
+
     def decode_to_tensor(self, *args, **kwargs) -> torch.Tensor:
         """
         Decode single video frame, convert it to torch.cuda.FloatTensor.
@@ -16,6 +16,7 @@
  */
 
 #include <common/NvDecoder.h>
+#include <common/Pipeline.h>
 #include <common/TestUtils.h>
 #include <cuda_runtime_api.h>
 #include <cvcuda/OpCustomCrop.hpp>
@@ -25,6 +26,9 @@
 #include <nvcv/Image.hpp>
 #include <nvcv/Tensor.hpp>
 
+#include <memory>
+#include <vector>
+
 /**
  * @brief Crop and Resize sample app.
  *
@@ -32,6 +36,8 @@
  * CVCuda Tensor along with a few operators.
  *
  * Input Batch Tensor -> Crop -> Resize -> WriteImage
+ *
+ * When given a number of batches, the Crop and Resize are also benchmarked on the decoded batch, see Pipeline.h.
  */
 
 /**
@@ -40,25 +46,31 @@
  **/
 void showUsage()
 {
-    std::cout << "usage: ./nvcv_cropandresize_app -i <image file path or  image directory -b <batch size>" << std::endl;
+    std::cout << "usage: ./nvcv_cropandresize_app -i <image file path or  image directory -b <batch size> "
+                 "-n <number of benchmark batches> -s <batches in flight> -w <number of warm-up batches>"
+              << std::endl;
 }
 
 /**
  * @brief Utility to parse the command line arguments
  *
  **/
-int ParseArgs(int argc, char *argv[], std::string &imagePath, uint32_t &batchSize)
+int ParseArgs(int argc, char *argv[], std::string &imagePath, uint32_t &batchSize, uint32_t &numBatches,
+              uint32_t &numSlots, uint32_t &numWarmup)
 {
     static struct option long_options[] = {
         {     "help",       no_argument, 0, 'h'},
         {"imagePath", required_argument, 0, 'i'},
         {    "batch", required_argument, 0, 'b'},
+        {  "batches", required_argument, 0, 'n'},
+        { "inflight", required_argument, 0, 's'},
+        {   "warmup", required_argument, 0, 'w'},
         {          0,                 0, 0,   0}
     };
 
     int long_index = 0;
     int opt        = 0;
-    while ((opt = getopt_long(argc, argv, "hi:b:", long_options, &long_index)) != -1)
+    while ((opt = getopt_long(argc, argv, "hi:b:n:s:w:", long_options, &long_index)) != -1)
     {
         switch (opt)
         {
@@ -72,6 +84,15 @@ int ParseArgs(int argc, char *argv[], std::string &imagePath, uint32_t &batchSiz
         case 'b':
             batchSize = std::stoi(optarg);
             break;
+        case 'n':
+            numBatches = std::stoi(optarg);
+            break;
+        case 's':
+            numSlots = std::stoi(optarg);
+            break;
+        case 'w':
+            numWarmup = std::stoi(optarg);
+            break;
         case ':':
             showUsage();
             return -1;
@@ -92,11 +113,14 @@ int ParseArgs(int argc, char *argv[], std::string &imagePath, uint32_t &batchSiz
 int main(int argc, char *argv[])
 {
     // Default parameters
-    std::string imagePath = "./samples/assets/tabby_tiger_cat.jpg";
-    uint32_t    batchSize = 1;
+    std::string imagePath  = "./samples/assets/tabby_tiger_cat.jpg";
+    uint32_t    batchSize  = 1;
+    uint32_t    numBatches = 0;
+    uint32_t    numSlots   = 2;
+    uint32_t    numWarmup  = 10;
 
     // Parse the command line paramaters to override the default parameters
-    int retval = ParseArgs(argc, argv, imagePath, batchSize);
+    int retval = ParseArgs(argc, argv, imagePath, batchSize, numBatches, numSlots, numWarmup);
     if (retval != 0)
     {
         return retval;
@@ -203,6 +227,28 @@ int main(int argc, char *argv[])
     // tag: Copy the buffer to CPU and write resized image into .bmp file
     WriteRGBITensor(resizedTensor, stream);
 
+    // tag: Benchmark
+    // Each batch in flight has its own output tensors, all of them read the same decoded input batch
+    if (numBatches > 0)
+    {
+        std::vector<std::unique_ptr<nvcv::Tensor>> cropTensors, resizedTensors;
+        for (uint32_t slot = 0; slot < numSlots; ++slot)
+        {
+            cropTensors.emplace_back(new nvcv::Tensor(batchSize, {cropWidth, cropHeight}, nvcv::FMT_RGB8));
+            resizedTensors.emplace_back(new nvcv::Tensor(batchSize, {resizeWidth, resizeHeight}, nvcv::FMT_RGB8));
+        }
+
+        std::vector<PipelineStage> stages{
+            {  "Crop", [&](int slot, cudaStream_t s) { cropOp(s, inTensor, *cropTensors[slot], crpRect); }},
+            {"Resize",
+             [&](int slot, cudaStream_t s)
+             { resizeOp(s, *cropTensors[slot], *resizedTensors[slot], NVCV_INTERP_LINEAR); }},
+        };
+
+        Pipeline pipeline(std::move(stages), numSlots);
+        RunBenchmark(pipeline, batchSize, numWarmup, numBatches);
+    }
+
     // tag: Clean up
     CHECK_CUDA_ERROR(cudaStreamDestroy(stream));
 
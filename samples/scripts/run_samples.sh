@@ -20,6 +20,8 @@
 # Crop and Resize Sample
 # Batch size 2
 LD_LIBRARY_PATH=./lib ./bin/nvcv_samples_cropandresize -i ./assets/images/ -b 2
+# Benchmark of 100 batches of size 32 after 10 warm-up ones, 2 batches in flight
+LD_LIBRARY_PATH=./lib ./bin/nvcv_samples_cropandresize -i ./assets/images/tabby_tiger_cat.jpg -b 32 -n 100 -w 10 -s 2
 export CUDA_MODULE_LOADING="LAZY"
 
 mkdir -p models
@@ -48,9 +50,15 @@ python3 ./segmentation/python/inference.py -bk tensorrt
 python3 segmentation/python/inference.py -i assets/images/ -o /tmp -b 5 -c __background__ -bk tensorrt
 # Run it on a video for class background.
 python segmentation/python/inference.py -i assets/videos/pexels-ilimdar-avgezer-7081456.mp4 -b 5 -c __background__
+# Benchmark 50 batches of size 16 after 5 warm-up ones, with TensorRT
+python3 segmentation/python/inference.py -i assets/images/ -b 16 -bn 50 -wb 5 -bk tensorrt
 
 # Classification sample
 # Batch size 1
 LD_LIBRARY_PATH=./lib ./bin/nvcv_samples_classification -e ./models/resnet50.engine -i ./assets/images/tabby_tiger_cat.jpg -l ./models/imagenet-classes.txt -b 1
 # Batch size 2
 LD_LIBRARY_PATH=./lib ./bin/nvcv_samples_classification -e ./models/resnet50.engine -i ./assets/images/tabby_tiger_cat.jpg -l ./models/imagenet-classes.txt -b 2
+# Throughput with 100 batches of size 8, 3 batches in flight
+LD_LIBRARY_PATH=./lib ./bin/nvcv_samples_classification -e ./models/resnet50.engine -i ./assets/images/tabby_tiger_cat.jpg -l ./models/imagenet-classes.txt -b 8 -n 100 -s 3
+# Same, excluding 10 warm-up batches from the reported times
+LD_LIBRARY_PATH=./lib ./bin/nvcv_samples_classification -e ./models/resnet50.engine -i ./assets/images/tabby_tiger_cat.jpg -l ./models/imagenet-classes.txt -b 8 -n 100 -s 3 -w 10
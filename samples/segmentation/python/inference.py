@@ -30,7 +30,6 @@ import sys
 import glob
 import argparse
 import torch
-import torchnvjpeg
 import torchvision.transforms.functional as F
 from torchvision.models import segmentation as segmentation_models
 import numpy as np
@@ -47,6 +46,7 @@ common_dir = os.path.join(
 sys.path.insert(0, common_dir)
 from trt_utils import convert_onnx_to_tensorrt, setup_tensort_bindings  # noqa: E402
 from vpf_utils import nvencoder, nvdecoder  # noqa: E402
+from perf_utils import StageTimer  # noqa: E402
 
 # docs_tag: end_python_imports
 
@@ -63,6 +63,8 @@ class SemanticSegmentationSample:
         target_img_width,
         device_id,
         backend,
+        benchmark_batches=0,
+        warmup_batches=0,
     ):
         # docs_tag: begin_class_init
         self.input_path = input_path
@@ -73,6 +75,8 @@ class SemanticSegmentationSample:
         self.target_img_width = target_img_width
         self.device_id = device_id
         self.backend = backend
+        self.benchmark_batches = benchmark_batches
+        self.warmup_batches = warmup_batches
         self.class_to_idx_dict = None
         self.data_modality = None
 
@@ -93,9 +97,9 @@ class SemanticSegmentationSample:
                 # Then create a dummy list with the data from the same file to simulate a
                 # batch.
                 self.data = [open(path, "rb").read() for path in self.file_names]
-                # We will use the torchnvjpeg based decoder on the GPU in case of images.
-                # This will be allocated once during the first run or whenever a batch
-                # size change happens.
+                # We will use CVCUDA's JPEG decoder on the GPU in case of images.
+                # This will be allocated once during the first run or whenever a larger
+                # batch size is needed.
                 self.decoder = None
                 self.data_modality = "images"
             else:
@@ -156,6 +160,10 @@ class SemanticSegmentationSample:
                 % self.data_modality
             )
             exit(1)
+
+        if self.benchmark_batches > 0 and self.data_modality != "images":
+            print("Benchmarks loop over the input batches, they need images.")
+            exit(1)
         # docs_tag: end_input_validation
 
     # docs_tag: setup_model_def
@@ -405,7 +413,6 @@ class SemanticSegmentationSample:
     def run(self):
         # docs_tag: begin_run_basics
         # Runs the complete sample end-to-end.
-        max_image_size = 1024 * 1024 * 3  # Maximum possible image size.
 
         # First setup the model.
         model_info = self.setup_model()
@@ -421,53 +428,77 @@ class SemanticSegmentationSample:
             for i in range(0, len(self.data), self.batch_size)
         ]
         batch_idx = 0
+
+        # When benchmarking, the input batches are looped over and the stages of
+        # each batch are timed, instead of saving the results.
+        timer = None
+        if self.benchmark_batches > 0:
+            num_batches = self.warmup_batches + self.benchmark_batches
+            file_name_batches = [
+                file_name_batches[i % len(file_name_batches)]
+                for i in range(num_batches)
+            ]
+            data_batches = [
+                data_batches[i % len(data_batches)] for i in range(num_batches)
+            ]
+            timer = StageTimer(self.device_id, self.warmup_batches)
         # docs_tag: end_run_basics
 
         # docs_tag: begin_batch_loop
         for file_name_batch, data_batch in zip(file_name_batches, data_batches):
             print("Processing batch %d of %d" % (batch_idx + 1, len(file_name_batches)))
             effective_batch_size = len(file_name_batch)
+            if timer:
+                timer.begin_batch()
 
             # docs_tag: begin_decode
-            # Decode in batch using torchnvjpeg decoder on the GPU if the input is
+            # Decode in batch using CVCUDA's JPEG decoder on the GPU if the input is
             # images or use VPF if it is a video.
             if self.data_modality == "images":
-                if not self.decoder or effective_batch_size != self.batch_size:
-                    decoder = torchnvjpeg.Decoder(
-                        0,
-                        0,
-                        True,
-                        self.device_id,
-                        effective_batch_size,
-                        8,  # this is max_cpu_threads parameter. Not used internally.
-                        max_image_size,
-                        torch.cuda.current_stream(self.device_id),
-                    )
-                image_tensor_list = decoder.batch_decode(data_batch)
+                if (
+                    not self.decoder
+                    or effective_batch_size > self.decoder.max_batch_size
+                ):
+                    self.decoder = cvcuda.JpegDecoder(self.batch_size)
+
+                # Images are decoded on the torch stream, so that torch reads them
+                # once they're decoded, without any host synchronization.
+                decode_stream = cvcuda.as_stream(
+                    torch.cuda.current_stream(self.device_id)
+                )
+                image_batch = self.decoder.decode(data_batch, stream=decode_stream)
 
-                # Convert the list of tensors to a tensor itself.
-                image_tensors = torch.stack(image_tensor_list)
+                # The images of the batch are wrapped by torch without copies, and
+                # stacked into a tensor.
+                image_tensors = torch.stack(
+                    [
+                        torch.as_tensor(img.cuda(), device="cuda:%d" % self.device_id)
+                        for img in image_batch
+                    ]
+                )
 
                 # Also save an NCHW version of the image tensors.
                 image_tensors_nchw = image_tensors.permute(
                     0, 3, 1, 2
                 )  # from NHWC to NCHW
             else:
-                # Read the frames using VPF's decoder.
-                image_tensors_nchw = torch.stack(
-                    [
-                        self.decoder.decode_to_tensor()
-                        for i in range(len(file_name_batch))
-                    ]
+                # Read the frames using VPF's decoder. Decoded surfaces are
+                # converted to RGB by CV-CUDA in place, without extra copies.
+                image_tensors = self.decoder.decode_batch_to_tensor(
+                    effective_batch_size
                 )
-                image_tensors = image_tensors_nchw.permute(
-                    0, 2, 3, 1
-                ).contiguous()  # from NCHW to NHWC
+
+                # Also save an NCHW version of the image tensors.
+                image_tensors_nchw = image_tensors.permute(
+                    0, 3, 1, 2
+                )  # from NHWC to NCHW
 
             input_image_height, input_image_width = (
                 image_tensors.shape[1],
                 image_tensors.shape[2],
             )
+            if timer:
+                timer.mark("Decode")
             # docs_tag: end_decode
 
             # docs_tag: begin_torch_to_cvcuda
@@ -519,6 +550,8 @@ class SemanticSegmentationSample:
             cvcuda_preprocessed_tensor = cvcuda.reformat(
                 cvcuda_normalized_tensor, "NCHW"
             )
+            if timer:
+                timer.mark("Preprocess")
             # docs_tag: end_preproc
 
             # docs_tag: begin_run_infer
@@ -528,6 +561,8 @@ class SemanticSegmentationSample:
                 device=torch.device("cuda", self.device_id),
             )
             infer_output = self.execute_inference(model_info, torch_preprocessed_tensor)
+            if timer:
+                timer.mark("Inference")
             # docs_tag: end_run_infer
 
             # Once the inference is over we would start the post-processing steps.
@@ -599,6 +634,12 @@ class SemanticSegmentationSample:
             ]  # In-place
             # docs_tag: end_overlay
 
+            if timer:
+                timer.mark("Postprocess")
+                timer.end_batch(effective_batch_size)
+                batch_idx += 1
+                continue
+
             # Loop over all the images in the current batch and save the
             # inference results. Depending on the type of input we had used, we
             # save the inferences in different ways. For image inputs, we generate
@@ -655,6 +696,9 @@ class SemanticSegmentationSample:
             batch_idx += 1
             # docs_tag: end_visualization_loop
 
+        if timer:
+            timer.report()
+
         if self.data_modality == "video":
             self.encoder.flush()
 
@@ -733,6 +777,25 @@ def main():
         help="The inference backend to use. Currently supports pytorch, tensorrt.",
     )
 
+    parser.add_argument(
+        "-bn",
+        "--benchmark_batches",
+        default=0,
+        type=int,
+        help="When above 0, the input images are looped over for this many batches "
+        "whose GPU time per stage, CPU time and throughput are reported, instead of "
+        "saving the results.",
+    )
+
+    parser.add_argument(
+        "-wb",
+        "--warmup_batches",
+        default=5,
+        type=int,
+        help="The number of batches run before the benchmarked ones, which aren't "
+        "accounted.",
+    )
+
     # Parse the command line arguments.
     args = parser.parse_args()
 
@@ -746,6 +809,8 @@ def main():
         args.target_img_width,
         args.device_id,
         args.backend,
+        args.benchmark_batches,
+        args.warmup_batches,
     )
 
     sample.run()
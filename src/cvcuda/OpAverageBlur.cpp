@@ -17,6 +17,7 @@
 
 #include "priv/OpAverageBlur.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -52,6 +53,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaAverageBlurSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("AverageBlur", stream, in);
+
             nvcv::TensorWrapHandle output(out), input(in);
             priv::ToDynamicRef<priv::AverageBlur>(handle)(stream, input, output,
                                                           nvcv::Size2D{kernelWidth, kernelHeight},
@@ -66,6 +69,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaAverageBlurVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("AverageBlurVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle inWrap(in), outWrap(out);
             nvcv::TensorWrapHandle             kernelSizeWrap(kernelSize), kernelAnchorWrap(kernelAnchor);
             priv::ToDynamicRef<priv::AverageBlur>(handle)(stream, inWrap, outWrap, kernelSizeWrap, kernelAnchorWrap,
@@ -17,6 +17,7 @@
 
 #include "priv/OpBilateralFilter.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -48,6 +49,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaBilateralFilterSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("BilateralFilter", stream, in);
+
             nvcv::TensorWrapHandle input(in), output(out);
             priv::ToDynamicRef<priv::BilateralFilter>(handle)(stream, input, output, diameter, sigmaColor, sigmaSpace,
                                                               borderMode);
@@ -62,6 +65,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaBilateralFilterVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("BilateralFilterVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
             nvcv::TensorWrapHandle diameterData(diameter), sigmaColorData(sigmaColor), sigmaSpaceData(sigmaSpace);
             priv::ToDynamicRef<priv::BilateralFilter>(handle)(stream, input, output, diameterData, sigmaColorData,
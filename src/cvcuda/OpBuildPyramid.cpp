@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/OpBuildPyramid.hpp"
+
+#include "priv/OperatorRange.hpp"
+#include "priv/SymbolVersioning.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <util/Assert.h>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaBuildPyramidCreate, (NVCVOperatorHandle * handle))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::BuildPyramid());
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaBuildPyramidSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVImageBatchHandle out,
+                   int32_t numLevels, NVCVPyramidType type))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("BuildPyramid", stream, in);
+
+            nvcv::TensorWrapHandle             input(in);
+            nvcv::ImageBatchVarShapeWrapHandle output(out);
+            priv::ToDynamicRef<priv::BuildPyramid>(handle)(stream, input, output, numLevels, type);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaBuildPyramidVarShapeSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle out,
+                   int32_t numLevels, NVCVPyramidType type))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("BuildPyramidVarShape", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
+            priv::ToDynamicRef<priv::BuildPyramid>(handle)(stream, input, output, numLevels, type);
+        });
+}
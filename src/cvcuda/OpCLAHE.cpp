@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/OpCLAHE.hpp"
+
+#include "priv/OperatorRange.hpp"
+#include "priv/SymbolVersioning.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <util/Assert.h>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaCLAHECreate,
+                  (NVCVOperatorHandle * handle, int32_t maxBatchSize, int32_t maxTilesX, int32_t maxTilesY))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::CLAHE(maxBatchSize, maxTilesX, maxTilesY));
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaCLAHESubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle out,
+                   float clipLimit, int32_t tilesX, int32_t tilesY))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("CLAHE", stream, in);
+
+            nvcv::TensorWrapHandle input(in), output(out);
+            priv::ToDynamicRef<priv::CLAHE>(handle)(stream, input, output, clipLimit, tilesX, tilesY);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaCLAHEVarShapeSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle out,
+                   float clipLimit, int32_t tilesX, int32_t tilesY))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("CLAHEVarShape", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
+            priv::ToDynamicRef<priv::CLAHE>(handle)(stream, input, output, clipLimit, tilesX, tilesY);
+        });
+}
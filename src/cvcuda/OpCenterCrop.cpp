@@ -15,8 +15,10 @@
  * limitations under the License.
  */
 
+#include "priv/CropView.hpp"
 #include "priv/OpCenterCrop.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -47,7 +49,26 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaCenterCropSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("CenterCrop", stream, in);
+
             nvcv::TensorWrapHandle input(in), output(out);
             priv::ToDynamicRef<priv::CenterCrop>(handle)(stream, input, output, {cropWidth, cropHeight});
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaCenterCropView,
+                  (NVCVTensorHandle in, int32_t cropWidth, int32_t cropHeight, NVCVTensorHandle *view))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (view == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to the view tensor handle must not be NULL");
+            }
+
+            nvcv::TensorWrapHandle input(in);
+            *view = priv::CreateCenterCropView(input, {cropWidth, cropHeight});
+        });
+}
@@ -17,6 +17,7 @@
 
 #include "priv/OpChannelReorder.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -48,6 +49,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaChannelReorderVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("ChannelReorderVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle output(out), input(in);
             nvcv::TensorWrapHandle             orders(orders_in);
 
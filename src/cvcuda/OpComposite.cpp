@@ -17,6 +17,7 @@
 
 #include "priv/OpComposite.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -48,6 +49,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaCompositeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("Composite", stream, fg);
+
             nvcv::TensorWrapHandle foreground(fg), background(bg), mask(fgMask), output(out);
             priv::ToDynamicRef<priv::Composite>(handle)(stream, foreground, background, mask, output);
         });
@@ -60,7 +63,38 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaCompositeVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("CompositeVarShape", stream, fg);
+
             nvcv::ImageBatchVarShapeWrapHandle foreground(fg), background(bg), mask(fgMask), output(out);
             priv::ToDynamicRef<priv::Composite>(handle)(stream, foreground, background, mask, output);
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaCompositeFlagsSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle fg, NVCVTensorHandle bg,
+                   NVCVTensorHandle fgMask, NVCVTensorHandle out, int32_t flags))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("CompositeFlags", stream, fg);
+
+            nvcv::TensorWrapHandle foreground(fg), background(bg), mask(fgMask), output(out);
+            priv::ToDynamicRef<priv::Composite>(handle)(stream, foreground, background, mask, output, flags);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaCompositeROISubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle fg, NVCVTensorHandle fgMask,
+                   NVCVTensorHandle bg, int32_t offsetX, int32_t offsetY, int32_t flags))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("CompositeROI", stream, fg);
+
+            nvcv::TensorWrapHandle foreground(fg), mask(fgMask), background(bg);
+            priv::ToDynamicRef<priv::Composite>(handle)(stream, foreground, mask, background,
+                                                        int2{offsetX, offsetY}, flags);
+        });
+}
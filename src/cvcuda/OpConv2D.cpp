@@ -17,6 +17,7 @@
 
 #include "priv/OpConv2D.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <cvcuda/OpConv2D.hpp>
@@ -42,6 +43,22 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaConv2DCreate, (NVCVOperatorHandle * ha
         });
 }
 
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaConv2DCreateWithAlgorithm,
+                  (NVCVOperatorHandle * handle, NVCVConv2DAlgorithm algorithm))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::Conv2D(algorithm));
+        });
+}
+
 CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaConv2DVarShapeSubmit,
                   (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle out,
                    NVCVImageBatchHandle kernel, NVCVTensorHandle kernelAnchor, NVCVBorderType borderMode))
@@ -49,6 +66,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaConv2DVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("Conv2DVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle inWrap(in), outWrap(out), kernelWrap(kernel);
             nvcv::TensorWrapHandle             kernelAnchorWrap(kernelAnchor);
             priv::ToDynamicRef<priv::Conv2D>(handle)(stream, inWrap, outWrap, kernelWrap, kernelAnchorWrap, borderMode);
@@ -17,12 +17,15 @@
 
 #include "priv/OpConvertTo.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
 #include <nvcv/Tensor.hpp>
 #include <util/Assert.h>
 
+#include <vector>
+
 namespace priv = cvcuda::priv;
 
 CVCUDA_DEFINE_API(0, 0, NVCVStatus, cvcudaConvertToCreate, (NVCVOperatorHandle * handle))
@@ -47,7 +50,65 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaConvertToSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("ConvertTo", stream, in);
+
             nvcv::TensorWrapHandle input(in), output(out);
             priv::ToDynamicRef<priv::ConvertTo>(handle)(stream, input, output, alpha, beta);
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaConvertToReorderSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle out,
+                   const double alpha, const double beta, NVCVSwizzle channelOrder))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("ConvertTo", stream, in);
+
+            nvcv::TensorWrapHandle input(in), output(out);
+            priv::ToDynamicRef<priv::ConvertTo>(handle)(stream, input, output, alpha, beta, channelOrder);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaConvertToPerChannelSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle out,
+                   NVCVTensorHandle alpha, NVCVTensorHandle beta))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("ConvertTo", stream, in);
+
+            nvcv::TensorWrapHandle input(in), output(out), alphaWrap(alpha), betaWrap(beta);
+            priv::ToDynamicRef<priv::ConvertTo>(handle)(stream, input, output, alphaWrap, betaWrap);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaConvertToMultiSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, const NVCVTensorHandle *out,
+                   const NVCVConvertToParams *params, int32_t numOutputs))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("ConvertToMulti", stream, in);
+
+            if (out == nullptr || params == nullptr || numOutputs <= 0)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Must have at least one output tensor and its parameters");
+            }
+
+            nvcv::TensorWrapHandle input(in);
+
+            std::vector<nvcv::TensorWrapHandle> output(out, out + numOutputs);
+            std::vector<const nvcv::ITensor *>  outputPtrs;
+            for (const nvcv::TensorWrapHandle &o : output)
+            {
+                outputPtrs.push_back(&o);
+            }
+
+            priv::ToDynamicRef<priv::ConvertTo>(handle)(stream, input, outputPtrs.data(), params, numOutputs);
+        });
+}
@@ -17,6 +17,7 @@
 
 #include "priv/OpCopyMakeBorder.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -48,6 +49,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaCopyMakeBorderSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("CopyMakeBorder", stream, in);
+
             nvcv::TensorWrapHandle output(out), input(in);
             priv::ToDynamicRef<priv::CopyMakeBorder>(handle)(stream, input, output, top, left, borderMode, borderValue);
         });
@@ -60,6 +63,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaCopyMakeBorderVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("CopyMakeBorderVarShape", stream, in);
+
             nvcv::ImageBatchWrapHandle output(out), input(in);
             nvcv::TensorWrapHandle     topVec(top), leftVec(left);
             priv::ToDynamicRef<priv::CopyMakeBorder>(handle)(stream, input, output, topVec, leftVec, borderMode,
@@ -74,9 +79,28 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaCopyMakeBorderVarShapeStackSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("CopyMakeBorderVarShapeStack", stream, in);
+
             nvcv::ImageBatchWrapHandle input(in);
             nvcv::TensorWrapHandle     output(out), topVec(top), leftVec(left);
             priv::ToDynamicRef<priv::CopyMakeBorder>(handle)(stream, input, output, topVec, leftVec, borderMode,
                                                              borderValue);
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaCopyMakeBorderVarShapeStackValuesSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVTensorHandle out,
+                   NVCVTensorHandle top, NVCVTensorHandle left, NVCVBorderType borderMode,
+                   NVCVTensorHandle borderValues))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("CopyMakeBorderVarShapeStackValues", stream, in);
+
+            nvcv::ImageBatchWrapHandle input(in);
+            nvcv::TensorWrapHandle     output(out), topVec(top), leftVec(left), values(borderValues);
+            priv::ToDynamicRef<priv::CopyMakeBorder>(handle)(stream, input, output, topVec, leftVec, borderMode,
+                                                             values);
+        });
+}
@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/OpCropResize.hpp"
+
+#include "priv/OperatorRange.hpp"
+#include "priv/SymbolVersioning.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <util/Assert.h>
+
+#include <optional>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaCropResizeCreate, (NVCVOperatorHandle * handle))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::CropResize());
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaCropResizeSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle boxes,
+                   NVCVTensorHandle out, const NVCVInterpolationType interpolation))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("CropResize", stream, in);
+
+            nvcv::TensorWrapHandle inWrap(in), boxesWrap(boxes), outWrap(out);
+            priv::ToDynamicRef<priv::CropResize>(handle)(stream, inWrap, boxesWrap, outWrap, interpolation);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaCropResizeVarShapeSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVTensorHandle boxes,
+                   NVCVTensorHandle flipCode, NVCVTensorHandle out, const NVCVInterpolationType interpolation))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("CropResizeVarShape", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle    inWrap(in);
+            nvcv::TensorWrapHandle                boxesWrap(boxes), outWrap(out);
+            std::optional<nvcv::TensorWrapHandle> flipCodeWrap;
+            if (flipCode != nullptr)
+            {
+                flipCodeWrap.emplace(flipCode);
+            }
+            priv::ToDynamicRef<priv::CropResize>(handle)(stream, inWrap, boxesWrap,
+                                                         flipCodeWrap ? &*flipCodeWrap : nullptr, outWrap,
+                                                         interpolation);
+        });
+}
@@ -15,8 +15,10 @@
  * limitations under the License.
  */
 
+#include "priv/CropView.hpp"
 #include "priv/OpCustomCrop.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -47,7 +49,26 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaCustomCropSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("CustomCrop", stream, in);
+
             nvcv::TensorWrapHandle input(in), output(out);
             priv::ToDynamicRef<priv::CustomCrop>(handle)(stream, input, output, cropRect);
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaCustomCropView,
+                  (NVCVTensorHandle in, const NVCVRectI cropRect, NVCVTensorHandle *view))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (view == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to the view tensor handle must not be NULL");
+            }
+
+            nvcv::TensorWrapHandle input(in);
+            *view = priv::CreateCropView(input, cropRect);
+        });
+}
@@ -17,6 +17,7 @@
 
 #include "priv/OpCvtColor.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -48,11 +49,27 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaCvtColorSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("CvtColor", stream, in);
+
             nvcv::TensorWrapHandle output(out), input(in);
             priv::ToDynamicRef<priv::CvtColor>(handle)(stream, input, output, code);
         });
 }
 
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaCvtColorWithSpecSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle out,
+                   NVCVColorConversionCode code, NVCVColorSpec inSpec))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("CvtColor", stream, in);
+
+            nvcv::TensorWrapHandle output(out), input(in);
+            priv::ToDynamicRef<priv::CvtColor>(handle)(stream, input, output, code, inSpec);
+        });
+}
+
 CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaCvtColorVarShapeSubmit,
                   (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle out,
                    NVCVColorConversionCode code))
@@ -60,7 +77,22 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaCvtColorVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("CvtColorVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle inWrap(in), outWrap(out);
             priv::ToDynamicRef<priv::CvtColor>(handle)(stream, inWrap, outWrap, code);
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaCvtColorVarShapeMixedSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle out))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("CvtColorVarShapeMixed", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle inWrap(in), outWrap(out);
+            priv::ToDynamicRef<priv::CvtColor>(handle)(stream, inWrap, outWrap);
+        });
+}
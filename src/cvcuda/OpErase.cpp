@@ -17,6 +17,7 @@
 
 #include "priv/OpErase.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -49,6 +50,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaEraseSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("Erase", stream, in);
+
             nvcv::TensorWrapHandle input(in), output(out), anchorwrap(anchor), erasingwrap(erasing), valueswrap(values),
                 imgIdxwrap(imgIdx);
             priv::ToDynamicRef<priv::Erase>(handle)(stream, input, output, anchorwrap, erasingwrap, valueswrap,
@@ -64,6 +67,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaEraseVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("EraseVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
             nvcv::TensorWrapHandle anchorwrap(anchor), erasingwrap(erasing), valueswrap(values), imgIdxwrap(imgIdx);
             priv::ToDynamicRef<priv::Erase>(handle)(stream, input, output, anchorwrap, erasingwrap, valueswrap,
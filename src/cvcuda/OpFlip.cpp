@@ -17,6 +17,7 @@
 
 #include "priv/OpFlip.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -48,6 +49,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaFlipSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("Flip", stream, in);
+
             nvcv::TensorWrapHandle output(out), input(in);
             priv::ToDynamicRef<priv::Flip>(handle)(stream, input, output, flipCode);
         });
@@ -60,8 +63,25 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaFlipVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("FlipVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle output(out), input(in);
             nvcv::TensorWrapHandle             flip_code(flipCode);
             priv::ToDynamicRef<priv::Flip>(handle)(stream, input, output, flip_code);
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaFlipVarShapeStackSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVTensorHandle out,
+                   NVCVTensorHandle flipCode))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("FlipVarShapeStack", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in);
+            nvcv::TensorWrapHandle             output(out), flip_code(flipCode);
+            priv::ToDynamicRef<priv::Flip>(handle)(stream, input, output, flip_code);
+        });
+}
@@ -17,6 +17,7 @@
 
 #include "priv/OpGammaContrast.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -51,6 +52,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaGammaContrastVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("GammaContrastVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle inWrap(in), outWrap(out);
             nvcv::TensorWrapHandle             gammaWrap(gamma);
             priv::ToDynamicRef<priv::GammaContrast>(handle)(stream, inWrap, outWrap, gammaWrap);
@@ -17,6 +17,7 @@
 
 #include "priv/OpGaussian.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -51,6 +52,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaGaussianSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("Gaussian", stream, in);
+
             nvcv::TensorWrapHandle output(out), input(in);
             priv::ToDynamicRef<priv::Gaussian>(handle)(stream, input, output, nvcv::Size2D{kernelWidth, kernelHeight},
                                                        double2{sigmaX, sigmaY}, borderMode);
@@ -64,6 +67,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaGaussianVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("GaussianVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle inWrap(in), outWrap(out);
             nvcv::TensorWrapHandle             kernelSizeWrap(kernelSize), sigmaWrap(sigma);
             priv::ToDynamicRef<priv::Gaussian>(handle)(stream, inWrap, outWrap, kernelSizeWrap, sigmaWrap, borderMode);
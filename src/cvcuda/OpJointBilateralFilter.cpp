@@ -17,6 +17,7 @@
 
 #include "priv/OpJointBilateralFilter.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -48,6 +49,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaJointBilateralFilterSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("JointBilateralFilter", stream, in);
+
             nvcv::TensorWrapHandle input(in), inputColor(inColor), output(out);
             priv::ToDynamicRef<priv::JointBilateralFilter>(handle)(stream, input, inputColor, output, diameter,
                                                                    sigmaColor, sigmaSpace, borderMode);
@@ -62,6 +65,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaJointBilateralFilterVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("JointBilateralFilterVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle input(in), inputColor(inColor), output(out);
             nvcv::TensorWrapHandle diameterData(diameter), sigmaColorData(sigmaColor), sigmaSpaceData(sigmaSpace);
             priv::ToDynamicRef<priv::JointBilateralFilter>(handle)(stream, input, inputColor, output, diameterData,
@@ -17,6 +17,7 @@
 
 #include "priv/OpLaplacian.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -48,6 +49,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaLaplacianSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("Laplacian", stream, in);
+
             nvcv::TensorWrapHandle output(out), input(in);
             priv::ToDynamicRef<priv::Laplacian>(handle)(stream, input, output, ksize, scale, borderMode);
         });
@@ -60,6 +63,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaLaplacianVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("LaplacianVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle inWrap(in), outWrap(out);
             nvcv::TensorWrapHandle             ksizeWrap(ksize), scaleWrap(scale);
             priv::ToDynamicRef<priv::Laplacian>(handle)(stream, inWrap, outWrap, ksizeWrap, scaleWrap, borderMode);
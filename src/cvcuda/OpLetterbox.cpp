@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/OpLetterbox.hpp"
+
+#include "priv/OperatorRange.hpp"
+#include "priv/SymbolVersioning.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <util/Assert.h>
+
+#include <optional>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaLetterboxCreate, (NVCVOperatorHandle * handle))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::Letterbox());
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaLetterboxSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle out,
+                   NVCVTensorHandle transform, NVCVInterpolationType interpolation, const float4 fillValue))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("Letterbox", stream, in);
+
+            nvcv::TensorWrapHandle                input(in), output(out);
+            std::optional<nvcv::TensorWrapHandle> transformWrap;
+            if (transform != nullptr)
+            {
+                transformWrap.emplace(transform);
+            }
+            priv::ToDynamicRef<priv::Letterbox>(handle)(stream, input, output,
+                                                        transformWrap ? &*transformWrap : nullptr, interpolation,
+                                                        fillValue);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaLetterboxVarShapeSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVTensorHandle out,
+                   NVCVTensorHandle transform, NVCVInterpolationType interpolation, const float4 fillValue))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("LetterboxVarShape", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle    input(in);
+            nvcv::TensorWrapHandle                output(out);
+            std::optional<nvcv::TensorWrapHandle> transformWrap;
+            if (transform != nullptr)
+            {
+                transformWrap.emplace(transform);
+            }
+            priv::ToDynamicRef<priv::Letterbox>(handle)(stream, input, output,
+                                                        transformWrap ? &*transformWrap : nullptr, interpolation,
+                                                        fillValue);
+        });
+}
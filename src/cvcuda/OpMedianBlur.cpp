@@ -17,6 +17,7 @@
 
 #include "priv/OpMedianBlur.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -49,6 +50,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaMedianBlurSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("MedianBlur", stream, in);
+
             nvcv::TensorWrapHandle input(in), output(out);
             priv::ToDynamicRef<priv::MedianBlur>(handle)(stream, input, output,
                                                          nvcv::Size2D{kernelWidth, kernelHeight});
@@ -62,6 +65,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaMedianBlurVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("MedianBlurVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
             nvcv::TensorWrapHandle             ksizeWrap(ksize);
             priv::ToDynamicRef<priv::MedianBlur>(handle)(stream, input, output, ksizeWrap);
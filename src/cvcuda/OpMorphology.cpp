@@ -17,6 +17,7 @@
 
 #include "priv/OpMorphology.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -50,6 +51,8 @@ CVCUDA_DEFINE_API(0, 0, NVCVStatus, cvcudaMorphologySubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("Morphology", stream, in);
+
             nvcv::TensorWrapHandle input(in), output(out);
             nvcv::Size2D           maskSize = {maskWidth, maskHeight};
             int2                   anchor   = {anchorX, anchorY};
@@ -66,6 +69,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaMorphologyVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("MorphologyVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
             nvcv::TensorWrapHandle             masksWrap(masks), anchorsWrap(anchors);
             priv::ToDynamicRef<priv::Morphology>(handle)(stream, input, output, morphType, masksWrap, anchorsWrap,
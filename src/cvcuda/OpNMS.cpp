@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/OpNMS.hpp"
+
+#include "priv/OperatorRange.hpp"
+#include "priv/SymbolVersioning.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/Tensor.hpp>
+#include <util/Assert.h>
+
+#include <optional>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaNMSCreate,
+                  (NVCVOperatorHandle * handle, int32_t maxBatchSize, int32_t maxNumBoxes))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::NMS(maxBatchSize, maxNumBoxes));
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaNMSSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle boxes, NVCVTensorHandle scores,
+                   NVCVTensorHandle classes, NVCVTensorHandle outIndices, NVCVTensorHandle outScores,
+                   NVCVTensorHandle outCount, float scoreThreshold, float iouThreshold, float softSigma))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("NMS", stream, boxes);
+
+            nvcv::TensorWrapHandle inBoxes(boxes), inScores(scores), indices(outIndices), keptScores(outScores),
+                count(outCount);
+
+            std::optional<nvcv::TensorWrapHandle> inClasses;
+            if (classes != nullptr)
+            {
+                inClasses.emplace(classes);
+            }
+
+            priv::ToDynamicRef<priv::NMS>(handle)(stream, inBoxes, inScores, inClasses ? &*inClasses : nullptr,
+                                                  indices, keptScores, count, scoreThreshold, iouThreshold,
+                                                  softSigma);
+        });
+}
@@ -17,6 +17,7 @@
 
 #include "priv/OpNormalize.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -49,6 +50,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaNormalizeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("Normalize", stream, in);
+
             nvcv::TensorWrapHandle inWrap(in), baseWrap(base), scaleWrap(scale), outWrap(out);
             priv::ToDynamicRef<priv::Normalize>(handle)(stream, inWrap, baseWrap, scaleWrap, outWrap, global_scale,
                                                         shift, epsilon, flags);
@@ -63,9 +66,44 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaNormalizeVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("NormalizeVarShape", stream, in);
+
             nvcv::TensorWrapHandle             baseWrap(base), scaleWrap(scale);
             nvcv::ImageBatchVarShapeWrapHandle inWrap(in), outWrap(out);
             priv::ToDynamicRef<priv::Normalize>(handle)(stream, inWrap, baseWrap, scaleWrap, outWrap, global_scale,
                                                         shift, epsilon, flags);
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaNormalizeReorderSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle base,
+                   NVCVTensorHandle scale, NVCVTensorHandle out, float global_scale, float shift, float epsilon,
+                   uint32_t flags, NVCVSwizzle channelOrder))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("Normalize", stream, in);
+
+            nvcv::TensorWrapHandle inWrap(in), baseWrap(base), scaleWrap(scale), outWrap(out);
+            priv::ToDynamicRef<priv::Normalize>(handle)(stream, inWrap, baseWrap, scaleWrap, outWrap, global_scale,
+                                                        shift, epsilon, flags, channelOrder);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaNormalizeVarShapeReorderSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVTensorHandle base,
+                   NVCVTensorHandle scale, NVCVImageBatchHandle out, float global_scale, float shift, float epsilon,
+                   uint32_t flags, NVCVSwizzle channelOrder))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("NormalizeVarShape", stream, in);
+
+            nvcv::TensorWrapHandle             baseWrap(base), scaleWrap(scale);
+            nvcv::ImageBatchVarShapeWrapHandle inWrap(in), outWrap(out);
+            priv::ToDynamicRef<priv::Normalize>(handle)(stream, inWrap, baseWrap, scaleWrap, outWrap, global_scale,
+                                                        shift, epsilon, flags, channelOrder);
+        });
+}
@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/OpOSD.hpp"
+
+#include "priv/OperatorRange.hpp"
+#include "priv/SymbolVersioning.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/Tensor.hpp>
+#include <util/Assert.h>
+
+#include <optional>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaOSDCreate,
+                  (NVCVOperatorHandle * handle, int32_t maxBatchSize, int32_t maxNumElements))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::OSD(maxBatchSize, maxNumElements));
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaOSDSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle inOut, NVCVTensorHandle elements,
+                   NVCVTensorHandle numElements, NVCVTensorHandle points, NVCVTensorHandle glyphs))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("OSD", stream, inOut);
+
+            nvcv::TensorWrapHandle images(inOut), inElements(elements);
+
+            std::optional<nvcv::TensorWrapHandle> count, inPoints, inGlyphs;
+            if (numElements != nullptr)
+            {
+                count.emplace(numElements);
+            }
+            if (points != nullptr)
+            {
+                inPoints.emplace(points);
+            }
+            if (glyphs != nullptr)
+            {
+                inGlyphs.emplace(glyphs);
+            }
+
+            priv::ToDynamicRef<priv::OSD>(handle)(stream, images, inElements, count ? &*count : nullptr,
+                                                  inPoints ? &*inPoints : nullptr, inGlyphs ? &*inGlyphs : nullptr);
+        });
+}
@@ -17,6 +17,7 @@
 
 #include "priv/OpPadAndStack.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -48,9 +49,30 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaPadAndStackSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("PadAndStack", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle input(in);
             nvcv::TensorWrapHandle             output(out), topWrap(top), leftWrap(left);
             priv::ToDynamicRef<priv::PadAndStack>(handle)(stream, input, output, topWrap, leftWrap, borderMode,
                                                           borderValue);
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaPadAndStackNormalizeSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVTensorHandle out,
+                   NVCVTensorHandle top, NVCVTensorHandle left, NVCVBorderType borderMode, float borderValue,
+                   NVCVTensorHandle base, NVCVTensorHandle scale, float global_scale, float shift, float epsilon,
+                   uint32_t flags))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("PadAndStackNormalize", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in);
+            nvcv::TensorWrapHandle output(out), topWrap(top), leftWrap(left), baseWrap(base), scaleWrap(scale);
+            priv::ToDynamicRef<priv::PadAndStack>(handle)(stream, input, output, topWrap, leftWrap, borderMode,
+                                                          borderValue, baseWrap, scaleWrap, global_scale, shift,
+                                                          epsilon, flags);
+        });
+}
@@ -17,6 +17,7 @@
 
 #include "priv/OpPillowResize.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -50,6 +51,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaPillowResizeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("PillowResize", stream, in);
+
             nvcv::TensorWrapHandle input(in), output(out);
             priv::ToDynamicRef<priv::PillowResize>(handle)(stream, input, output, interpolation);
         });
@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/OpRandomParams.hpp"
+
+#include "priv/OperatorRange.hpp"
+#include "priv/SymbolVersioning.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <util/Assert.h>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaRandomParamsCreate, (NVCVOperatorHandle * handle, uint64_t seed))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::RandomParams(seed));
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaRandomParamsSetSeed, (NVCVOperatorHandle handle, uint64_t seed))
+{
+    return nvcv::ProtectCall([&] { priv::ToDynamicRef<priv::RandomParams>(handle).setSeed(seed); });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaRandomFlipCodeSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle flipCode, float probHoriz,
+                   float probVert))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("RandomFlipCode", stream);
+
+            nvcv::TensorWrapHandle output(flipCode);
+            priv::ToDynamicRef<priv::RandomParams>(handle).flipCode(stream, output, probHoriz, probVert);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaRandomUniformSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle out, double low, double high))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("RandomUniform", stream);
+
+            nvcv::TensorWrapHandle output(out);
+            priv::ToDynamicRef<priv::RandomParams>(handle).uniform(stream, output, low, high);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaRandomRotateSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVTensorHandle angleDeg,
+                   NVCVTensorHandle shift, double minAngleDeg, double maxAngleDeg))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("RandomRotate", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in);
+            nvcv::TensorWrapHandle             angle(angleDeg), shifts(shift);
+            priv::ToDynamicRef<priv::RandomParams>(handle).rotate(stream, input, angle, shifts, minAngleDeg,
+                                                                  maxAngleDeg);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaRandomEraseSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVTensorHandle anchor,
+                   NVCVTensorHandle erasing, NVCVTensorHandle imgIdx, float probability, float minArea,
+                   float maxArea, float minAspect, float maxAspect))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("RandomErase", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in);
+            nvcv::TensorWrapHandle             anchorWrap(anchor), erasingWrap(erasing), imgIdxWrap(imgIdx);
+            priv::ToDynamicRef<priv::RandomParams>(handle).erase(stream, input, anchorWrap, erasingWrap, imgIdxWrap,
+                                                                 probability, minArea, maxArea, minAspect,
+                                                                 maxAspect);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaRandomCropSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle boxes, int32_t width,
+                   int32_t height, float minScale, float maxScale, float minAspect, float maxAspect))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("RandomCrop", stream);
+
+            nvcv::TensorWrapHandle output(boxes);
+            priv::ToDynamicRef<priv::RandomParams>(handle).crop(stream, output, width, height, minScale, maxScale,
+                                                                minAspect, maxAspect);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaRandomCropVarShapeSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVTensorHandle boxes,
+                   float minScale, float maxScale, float minAspect, float maxAspect))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("RandomCropVarShape", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in);
+            nvcv::TensorWrapHandle             output(boxes);
+            priv::ToDynamicRef<priv::RandomParams>(handle).crop(stream, input, output, minScale, maxScale, minAspect,
+                                                                maxAspect);
+        });
+}
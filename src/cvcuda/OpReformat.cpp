@@ -17,6 +17,7 @@
 
 #include "priv/OpReformat.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -46,7 +47,23 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaReformatSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("Reformat", stream, in);
+
             nvcv::TensorWrapHandle input(in), output(out);
             priv::ToDynamicRef<priv::Reformat>(handle)(stream, input, output);
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaReformatReorderSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle out,
+                   NVCVSwizzle channelOrder))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("Reformat", stream, in);
+
+            nvcv::TensorWrapHandle input(in), output(out);
+            priv::ToDynamicRef<priv::Reformat>(handle)(stream, input, output, channelOrder);
+        });
+}
@@ -17,13 +17,17 @@
 
 #include "priv/OpResize.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
 #include <nvcv/ImageBatch.hpp>
 #include <nvcv/Tensor.hpp>
+#include <nvcv/TensorData.hpp>
 #include <util/Assert.h>
 
+#include <vector>
+
 namespace priv = cvcuda::priv;
 
 CVCUDA_DEFINE_API(0, 0, NVCVStatus, cvcudaResizeCreate, (NVCVOperatorHandle * handle))
@@ -48,11 +52,27 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaResizeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("Resize", stream, in);
+
             nvcv::TensorWrapHandle input(in), output(out);
             priv::ToDynamicRef<priv::Resize>(handle)(stream, input, output, interpolation);
         });
 }
 
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizeReorderSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle out,
+                   const NVCVInterpolationType interpolation, NVCVSwizzle channelOrder))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("Resize", stream, in);
+
+            nvcv::TensorWrapHandle input(in), output(out);
+            priv::ToDynamicRef<priv::Resize>(handle)(stream, input, output, interpolation, channelOrder);
+        });
+}
+
 CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaResizeVarShapeSubmit,
                   (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle out,
                    const NVCVInterpolationType interpolation))
@@ -60,7 +80,246 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaResizeVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("ResizeVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
             priv::ToDynamicRef<priv::Resize>(handle)(stream, input, output, interpolation);
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizePlanCreate,
+                  (NVCVOperatorHandle handle, const NVCVTensorRequirements *inReqs,
+                   const NVCVTensorRequirements *outReqs, const NVCVInterpolationType interpolation,
+                   NVCVOperatorHandle *plan))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::ToDynamicRef<priv::Resize>(handle);
+
+            if (inReqs == nullptr || outReqs == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to tensor requirements must not be NULL");
+            }
+
+            if (plan == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *plan = reinterpret_cast<NVCVOperatorHandle>(new priv::ResizePlan(*inReqs, *outReqs, interpolation));
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizePlanSubmit,
+                  (NVCVOperatorHandle plan, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle out))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("ResizePlan", stream, in);
+
+            nvcv::TensorWrapHandle input(in), output(out);
+            priv::ToDynamicRef<priv::ResizePlan>(plan)(stream, input, output);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizeMultiSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, const NVCVTensorHandle *out,
+                   const NVCVInterpolationType *interpolation, int32_t numOutputs))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("ResizeMulti", stream, in);
+
+            if (out == nullptr || interpolation == nullptr || numOutputs <= 0)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Must have at least one output tensor and its interpolation");
+            }
+
+            nvcv::TensorWrapHandle input(in);
+
+            std::vector<nvcv::TensorWrapHandle> output(out, out + numOutputs);
+            std::vector<const nvcv::ITensor *>  outputPtrs;
+            for (const nvcv::TensorWrapHandle &o : output)
+            {
+                outputPtrs.push_back(&o);
+            }
+
+            priv::ToDynamicRef<priv::Resize>(handle)(stream, input, outputPtrs.data(), interpolation, numOutputs);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizeVarShapePerSampleSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle out,
+                   NVCVTensorHandle interpolation, int8_t antialias))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("ResizeVarShapePerSample", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
+            nvcv::TensorWrapHandle             interp(interpolation);
+            priv::ToDynamicRef<priv::Resize>(handle)(stream, input, output, interp, antialias != 0);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizeVarShapeMultiSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in,
+                   const NVCVImageBatchHandle *out, const NVCVInterpolationType *interpolation, int32_t numOutputs))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("ResizeVarShapeMulti", stream, in);
+
+            if (out == nullptr || interpolation == nullptr || numOutputs <= 0)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Must have at least one output image batch and its interpolation");
+            }
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in);
+
+            std::vector<nvcv::ImageBatchVarShapeWrapHandle> output(out, out + numOutputs);
+            std::vector<const nvcv::IImageBatchVarShape *>  outputPtrs;
+            for (const nvcv::ImageBatchVarShapeWrapHandle &o : output)
+            {
+                outputPtrs.push_back(&o);
+            }
+
+            priv::ToDynamicRef<priv::Resize>(handle)(stream, input, outputPtrs.data(), interpolation, numOutputs);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizePyramidSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, const NVCVTensorHandle *out,
+                   int32_t numLevels, const NVCVInterpolationType interpolation))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("ResizePyramid", stream, in);
+
+            if (out == nullptr || numLevels <= 0)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pyramid must have at least one output tensor");
+            }
+
+            nvcv::TensorWrapHandle input(in);
+
+            std::vector<nvcv::TensorWrapHandle> output(out, out + numLevels);
+            std::vector<const nvcv::ITensor *>  levels;
+            for (const nvcv::TensorWrapHandle &level : output)
+            {
+                levels.push_back(&level);
+            }
+
+            priv::ToDynamicRef<priv::Resize>(handle).pyramid(stream, input, levels.data(), numLevels, interpolation);
+        });
+}
+
+namespace {
+
+// The data submissions are meant for latency-critical code, their
+// validation errors are reported by status, without exceptions.
+
+NVCVStatus CheckTensorData(const NVCVTensorData *data, const char *name)
+{
+    if (data == nullptr)
+    {
+        nvcvSetThreadStatus(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to %s tensor data must not be NULL", name);
+        return NVCV_ERROR_INVALID_ARGUMENT;
+    }
+    if (data->bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA)
+    {
+        nvcvSetThreadStatus(NVCV_ERROR_INVALID_ARGUMENT, "%s must be cuda-accessible, pitch-linear tensor", name);
+        return NVCV_ERROR_INVALID_ARGUMENT;
+    }
+    return NVCV_SUCCESS;
+}
+
+} // namespace
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizeDataSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, const NVCVTensorData *in,
+                   const NVCVTensorData *out, const NVCVInterpolationType interpolation))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("ResizeData", stream);
+
+            priv::Resize *op;
+            if (NVCVStatus status = priv::TryToDynamicPtr(handle, op); status != NVCV_SUCCESS)
+            {
+                return status;
+            }
+            if (NVCVStatus status = CheckTensorData(in, "Input"); status != NVCV_SUCCESS)
+            {
+                return status;
+            }
+            if (NVCVStatus status = CheckTensorData(out, "Output"); status != NVCV_SUCCESS)
+            {
+                return status;
+            }
+
+            return op->submit(stream, nvcv::TensorDataStridedCuda(*in), nvcv::TensorDataStridedCuda(*out),
+                              interpolation);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizePlanDataSubmit,
+                  (NVCVOperatorHandle plan, cudaStream_t stream, const NVCVTensorData *in, const NVCVTensorData *out))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("ResizePlanData", stream);
+
+            priv::ResizePlan *op;
+            if (NVCVStatus status = priv::TryToDynamicPtr(plan, op); status != NVCV_SUCCESS)
+            {
+                return status;
+            }
+            if (NVCVStatus status = CheckTensorData(in, "Input"); status != NVCV_SUCCESS)
+            {
+                return status;
+            }
+            if (NVCVStatus status = CheckTensorData(out, "Output"); status != NVCV_SUCCESS)
+            {
+                return status;
+            }
+
+            return op->submit(stream, nvcv::TensorDataStridedCuda(*in), nvcv::TensorDataStridedCuda(*out));
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizeEstimate,
+                  (const NVCVTensorRequirements *inReqs, const NVCVTensorRequirements *outReqs,
+                   const NVCVInterpolationType interpolation, NVCVOperatorEstimate *estimate))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (inReqs == nullptr || outReqs == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to tensor requirements must not be NULL");
+            }
+
+            if (estimate == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to the estimate must not be NULL");
+            }
+
+            *estimate = priv::ResizePlan(*inReqs, *outReqs, interpolation).estimate();
+        });
+}
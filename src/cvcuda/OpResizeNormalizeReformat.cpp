@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/OpResizeNormalizeReformat.hpp"
+
+#include "priv/OperatorRange.hpp"
+#include "priv/SymbolVersioning.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <util/Assert.h>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizeNormalizeReformatCreate, (NVCVOperatorHandle * handle))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::ResizeNormalizeReformat());
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizeNormalizeReformatSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle base,
+                   NVCVTensorHandle scale, NVCVTensorHandle out, const NVCVInterpolationType interpolation,
+                   float global_scale, float shift, float epsilon, uint32_t flags))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("ResizeNormalizeReformat", stream, in);
+
+            nvcv::TensorWrapHandle inWrap(in), baseWrap(base), scaleWrap(scale), outWrap(out);
+            priv::ToDynamicRef<priv::ResizeNormalizeReformat>(handle)(stream, inWrap, baseWrap, scaleWrap, outWrap,
+                                                                      interpolation, global_scale, shift, epsilon,
+                                                                      flags);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizeNormalizeReformatVarShapeSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVTensorHandle base,
+                   NVCVTensorHandle scale, NVCVTensorHandle out, const NVCVInterpolationType interpolation,
+                   float global_scale, float shift, float epsilon, uint32_t flags))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("ResizeNormalizeReformatVarShape", stream, in);
+
+            nvcv::TensorWrapHandle             baseWrap(base), scaleWrap(scale), outWrap(out);
+            nvcv::ImageBatchVarShapeWrapHandle inWrap(in);
+            priv::ToDynamicRef<priv::ResizeNormalizeReformat>(handle)(stream, inWrap, baseWrap, scaleWrap, outWrap,
+                                                                      interpolation, global_scale, shift, epsilon,
+                                                                      flags);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResizeNormalizeReformatNV12Submit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle luma, NVCVTensorHandle chroma,
+                   const NVCVRectI *roi, NVCVTensorHandle base, NVCVTensorHandle scale, NVCVTensorHandle out,
+                   const NVCVColorConversionCode code, const NVCVInterpolationType interpolation, float global_scale,
+                   float shift, float epsilon, uint32_t flags))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("ResizeNormalizeReformatNV12", stream, luma);
+
+            nvcv::TensorWrapHandle lumaWrap(luma), chromaWrap(chroma), baseWrap(base), scaleWrap(scale),
+                outWrap(out);
+            priv::ToDynamicRef<priv::ResizeNormalizeReformat>(handle)(
+                stream, lumaWrap, chromaWrap, roi ? *roi : NVCVRectI{0, 0, 0, 0}, baseWrap, scaleWrap, outWrap, code,
+                interpolation, global_scale, shift, epsilon, flags);
+        });
+}
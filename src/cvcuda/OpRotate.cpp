@@ -17,6 +17,7 @@
 
 #include "priv/OpRotate.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -38,7 +39,25 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaRotateCreate,
                                       "Pointer to NVCVOperator handle must not be NULL");
             }
 
-            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::Rotate(maxVarShapeBatchSize));
+            *handle = reinterpret_cast<NVCVOperatorHandle>(
+                new priv::Rotate(maxVarShapeBatchSize, NVCV_COORD_PRECISION_DEFAULT));
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaRotateCreateWithPrecision,
+                  (NVCVOperatorHandle * handle, const int32_t maxVarShapeBatchSize,
+                   const NVCVCoordinatePrecision precision))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::Rotate(maxVarShapeBatchSize, precision));
         });
 }
 
@@ -49,6 +68,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaRotateSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("Rotate", stream, in);
+
             nvcv::TensorWrapHandle input(in), output(out);
             priv::ToDynamicRef<priv::Rotate>(handle)(stream, input, output, angleDeg, shift, interpolation);
         });
@@ -61,8 +82,24 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaRotateVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("RotateVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
             nvcv::TensorWrapHandle             angleDegWrap(angleDeg), shiftWrap(shift);
             priv::ToDynamicRef<priv::Rotate>(handle)(stream, input, output, angleDegWrap, shiftWrap, interpolation);
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaRotateVarShapeSubmitHostParams,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle out,
+                   const double *angleDeg, const double2 *shift, const NVCVInterpolationType interpolation))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("RotateVarShape", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
+            priv::ToDynamicRef<priv::Rotate>(handle)(stream, input, output, angleDeg, shift, interpolation);
+        });
+}
@@ -0,0 +1,77 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/OpSobel.hpp"
+
+#include "priv/OperatorRange.hpp"
+#include "priv/SymbolVersioning.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/Tensor.hpp>
+#include <util/Assert.h>
+
+#include <optional>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaSobelCreate, (NVCVOperatorHandle * handle))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::Sobel());
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaSobelSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle dx,
+                   NVCVTensorHandle dy, NVCVTensorHandle magnitude, int32_t ksize, float scale,
+                   NVCVBorderType borderMode))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("Sobel", stream, in);
+
+            nvcv::TensorWrapHandle input(in);
+
+            std::optional<nvcv::TensorWrapHandle> outDx, outDy, outMagnitude;
+            if (dx != nullptr)
+            {
+                outDx.emplace(dx);
+            }
+            if (dy != nullptr)
+            {
+                outDy.emplace(dy);
+            }
+            if (magnitude != nullptr)
+            {
+                outMagnitude.emplace(magnitude);
+            }
+
+            priv::ToDynamicRef<priv::Sobel>(handle)(stream, input, outDx ? &*outDx : nullptr,
+                                                    outDy ? &*outDy : nullptr,
+                                                    outMagnitude ? &*outMagnitude : nullptr, ksize, scale,
+                                                    borderMode);
+        });
+}
@@ -17,6 +17,7 @@
 
 #include "priv/OpWarpAffine.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -50,6 +51,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaWarpAffineSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("WarpAffine", stream, in);
+
             nvcv::TensorWrapHandle input(in), output(out);
             priv::ToDynamicRef<priv::WarpAffine>(handle)(stream, input, output, xform, flags, borderMode, borderValue);
         });
@@ -63,9 +66,27 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaWarpAffineVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("WarpAffineVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
             nvcv::TensorWrapHandle             transMatrixWrap(transMatrix);
             priv::ToDynamicRef<priv::WarpAffine>(handle)(stream, input, output, transMatrixWrap, flags, borderMode,
                                                          borderValue);
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaWarpAffineVarShapeSubmitHostParams,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVImageBatchHandle out,
+                   const NVCVAffineTransform *xforms, const int32_t flags, const NVCVBorderType borderMode,
+                   const float4 borderValue))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("WarpAffineVarShape", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
+            priv::ToDynamicRef<priv::WarpAffine>(handle)(stream, input, output, xforms, flags, borderMode,
+                                                         borderValue);
+        });
+}
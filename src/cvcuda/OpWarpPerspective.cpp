@@ -17,6 +17,7 @@
 
 #include "priv/OpWarpPerspective.hpp"
 
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/Exception.hpp>
@@ -50,6 +51,8 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaWarpPerspectiveSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("WarpPerspective", stream, in);
+
             nvcv::TensorWrapHandle input(in), output(out);
             priv::ToDynamicRef<priv::WarpPerspective>(handle)(stream, input, output, transMatrix, flags, borderMode,
                                                               borderValue);
@@ -64,9 +67,28 @@ CVCUDA_DEFINE_API(0, 2, NVCVStatus, cvcudaWarpPerspectiveVarShapeSubmit,
     return nvcv::ProtectCall(
         [&]
         {
+            priv::OperatorRange range("WarpPerspectiveVarShape", stream, in);
+
             nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
             nvcv::TensorWrapHandle             transMatrixWrap(transMatrix);
             priv::ToDynamicRef<priv::WarpPerspective>(handle)(stream, input, output, transMatrixWrap, flags, borderMode,
                                                               borderValue);
         });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaWarpPerspectiveCropVarShapeSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVTensorHandle quads,
+                   NVCVImageBatchHandle out, const int flags, const NVCVBorderType borderMode,
+                   const float4 borderValue))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::OperatorRange range("WarpPerspectiveCropVarShape", stream, in);
+
+            nvcv::ImageBatchVarShapeWrapHandle input(in), output(out);
+            nvcv::TensorWrapHandle             quadsWrap(quads);
+            priv::ToDynamicRef<priv::WarpPerspective>(handle).crop(stream, input, quadsWrap, output, flags, borderMode,
+                                                                   borderValue);
+        });
+}
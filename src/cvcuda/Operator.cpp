@@ -16,14 +16,236 @@
  */
 
 #include "priv/IOperator.hpp"
+#include "priv/OperatorRange.hpp"
 #include "priv/SymbolVersioning.hpp"
+#include "priv/legacy/KernelTuner.hpp"
+#include "priv/legacy/LaunchBudget.hpp"
+#include "priv/legacy/Precision.hpp"
 
 #include <cvcuda/Operator.h>
 #include <nvcv/Exception.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 namespace priv = cvcuda::priv;
 
 CVCUDA_DEFINE_API(0, 0, NVCVStatus, nvcvOperatorDestroy, (NVCVOperatorHandle handle))
 {
     return nvcv::ProtectCall([&] { delete priv::ToOperatorPtr(handle); });
 }
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, nvcvOperatorGetWorkspaceRequirements,
+                  (NVCVOperatorHandle handle, NVCVOperatorWorkspaceRequirements *reqs))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (reqs == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to output requirements must not be NULL");
+            }
+
+            *reqs = priv::ToDynamicRef<priv::IOperator>(handle).workspaceRequirements();
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, nvcvOperatorSetWorkspace,
+                  (NVCVOperatorHandle handle, void *cudaMem, int64_t size))
+{
+    return nvcv::ProtectCall([&] { priv::ToDynamicRef<priv::IOperator>(handle).setWorkspace(cudaMem, size); });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, nvcvOperatorReserveWorkspace, (NVCVOperatorHandle handle, cudaStream_t stream))
+{
+    return nvcv::ProtectCall([&] { priv::ToDynamicRef<priv::IOperator>(handle).reserveWorkspace(stream); });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaSetOperatorTimingEnabled, (int32_t enabled))
+{
+    return nvcv::ProtectCall([&] { priv::SetOperatorTimingEnabled(enabled != 0); });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaGetOperatorStats, (NVCVOperatorStats * stats, int32_t *numStats))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (numStats == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to number of stats must not be NULL");
+            }
+
+            std::vector<NVCVOperatorStats> all = priv::GetOperatorStats();
+
+            if (stats == nullptr)
+            {
+                *numStats = static_cast<int32_t>(all.size());
+                return;
+            }
+
+            if (*numStats < 0)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Capacity of stats must not be negative");
+            }
+
+            *numStats = std::min(*numStats, static_cast<int32_t>(all.size()));
+            std::memcpy(stats, all.data(), *numStats * sizeof(NVCVOperatorStats));
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaResetOperatorStats, ())
+{
+    return nvcv::ProtectCall([&] { priv::ResetOperatorStats(); });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaSetOperatorTimingSampling, (int32_t sampleEvery))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (sampleEvery < 1)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Sampling period must be positive, not %d", sampleEvery);
+            }
+
+            priv::SetOperatorTimingSampling(sampleEvery);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaSetOperatorStatsSink,
+                  (NVCVOperatorStatsSinkFunc sink, void *userData, int32_t intervalMs))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (sink != nullptr && intervalMs <= 0)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Interval between calls to the sink must be positive, not %d", intervalMs);
+            }
+
+            priv::SetOperatorStatsSink(sink, userData, intervalMs);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaSetAutotuneEnabled, (int32_t enabled))
+{
+    return nvcv::ProtectCall([&] { nvcv::legacy::cuda_op::KernelTuner::Instance().setEnabled(enabled != 0); });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaLoadTuningCache, (const char *path))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (path == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Path must not be NULL");
+            }
+
+            if (!nvcv::legacy::cuda_op::KernelTuner::Instance().load(path))
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Can't read tuning cache %s", path);
+            }
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaSaveTuningCache, (const char *path))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (path == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Path must not be NULL");
+            }
+
+            if (!nvcv::legacy::cuda_op::KernelTuner::Instance().save(path))
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Can't write tuning cache %s", path);
+            }
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaSetLaunchBudget, (int32_t maxSMs))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (maxSMs < 0)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Launch budget must not be negative");
+            }
+
+            nvcv::legacy::cuda_op::SetLaunchBudget(maxSMs);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaSetThreadLaunchBudget, (int32_t maxSMs))
+{
+    return nvcv::ProtectCall([&] { nvcv::legacy::cuda_op::SetThreadLaunchBudget(maxSMs); });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaGetLaunchBudget, (int32_t * maxSMs))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (maxSMs == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to output launch budget must not be NULL");
+            }
+
+            *maxSMs = nvcv::legacy::cuda_op::GetLaunchBudget();
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaSetPrecisionMode, (NVCVPrecisionMode mode))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (mode != NVCV_PRECISION_ACCURATE && mode != NVCV_PRECISION_FAST)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid precision mode %d",
+                                      static_cast<int>(mode));
+            }
+
+            nvcv::legacy::cuda_op::SetPrecisionMode(mode);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaSetThreadPrecisionMode, (NVCVPrecisionMode mode))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (mode != NVCV_PRECISION_INHERIT && mode != NVCV_PRECISION_ACCURATE && mode != NVCV_PRECISION_FAST)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid precision mode %d",
+                                      static_cast<int>(mode));
+            }
+
+            nvcv::legacy::cuda_op::SetThreadPrecisionMode(mode);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaGetPrecisionMode, (NVCVPrecisionMode * mode))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (mode == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to output precision mode must not be NULL");
+            }
+
+            *mode = nvcv::legacy::cuda_op::GetPrecisionMode();
+        });
+}
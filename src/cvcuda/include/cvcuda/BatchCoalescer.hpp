@@ -0,0 +1,329 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file BatchCoalescer.hpp
+ *
+ * @brief Defines the public C++ class that coalesces single-image requests into varshape batches.
+ * @defgroup NVCV_CPP_ALGORITHM_BATCHCOALESCER BatchCoalescer
+ * @{
+ */
+
+#ifndef CVCUDA_BATCH_COALESCER_HPP
+#define CVCUDA_BATCH_COALESCER_HPP
+
+#include <cuda_runtime.h>
+#include <nvcv/Exception.hpp>
+#include <nvcv/IImage.hpp>
+#include <nvcv/ImageBatch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cvcuda {
+
+/**
+ * Collects requests of one input and one output image, submitted one at a time from any thread, into varshape
+ * image batches that are processed by a single operator launch.
+ *
+ * A batch is launched once it holds maxBatch requests, or timeout after its oldest request was submitted,
+ * whichever comes first. The launch function is called from the coalescer's worker thread with the coalescer's
+ * stream and two batches referring to the requests' images in submission order, so each output is written in
+ * place and nothing has to be copied back to the requests. A request's future becomes ready when the launch that
+ * processed it is done on the device, or holds the exception thrown by the launch function.
+ *
+ * Requests submitted while a batch runs are collected into the next one, so under load batches grow up to
+ * maxBatch without waiting for the timeout, and at low rates a request waits at most timeout before it runs.
+ *
+ * Images are referenced, not copied: they must outlive the request's future, and inputs must be ready to be read
+ * by work submitted to the coalescer's stream.
+ *
+ * @code
+ * cvcuda::Resize resize;
+ * cvcuda::BatchCoalescer coalescer(stream, {32, std::chrono::microseconds(500)},
+ *                                  [&](cudaStream_t s, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out)
+ *                                  { resize(s, in, out, NVCV_INTERP_LINEAR); });
+ *
+ * // in each request handler
+ * coalescer.submit(inImage, outImage).get();
+ * @endcode
+ */
+class BatchCoalescer
+{
+public:
+    struct Config
+    {
+        int32_t                   maxBatch; ///< Largest number of requests of a batch, at least one.
+        std::chrono::microseconds timeout;  ///< Longest time a request waits for others before it's launched.
+    };
+
+    /// Function submitting the work of a batch to stream, typically a varshape operator.
+    using LaunchFn
+        = std::function<void(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out)>;
+
+    /**
+     * Create a coalescer and start its worker thread.
+     *
+     * The worker runs on the device current when the coalescer is created, which the stream must belong to.
+     *
+     * @param[in] stream Stream the batches are launched on.
+     * @param[in] config Batching limits.
+     * @param[in] launch Function launching each batch.
+     */
+    BatchCoalescer(cudaStream_t stream, Config config, LaunchFn launch);
+
+    /// Process the pending requests and stop the worker thread.
+    ~BatchCoalescer();
+
+    BatchCoalescer(const BatchCoalescer &)            = delete;
+    BatchCoalescer &operator=(const BatchCoalescer &) = delete;
+
+    /**
+     * Queue the processing of in into out.
+     *
+     * @return Future ready once out is written.
+     */
+    std::future<void> submit(const nvcv::IImage &in, const nvcv::IImage &out);
+
+    /// Launch the requests submitted so far without waiting for their timeout.
+    void flush();
+
+    /// Number of launches and of requests processed so far.
+    int64_t numBatches() const;
+    int64_t numRequests() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Request
+    {
+        const nvcv::IImage *in;
+        const nvcv::IImage *out;
+        std::promise<void>  done;
+        Clock::time_point   submitted;
+    };
+
+    cudaStream_t             m_stream;
+    Config                   m_config;
+    LaunchFn                 m_launch;
+    int                      m_device;
+    nvcv::ImageBatchVarShape m_inBatch;
+    nvcv::ImageBatchVarShape m_outBatch;
+    cudaEvent_t              m_doneEvent = nullptr;
+
+    mutable std::mutex      m_mtx;
+    std::condition_variable m_cv;
+    std::deque<Request>     m_pending;
+    size_t                  m_numFlushed = 0; // pending requests to launch without waiting
+    bool                    m_stop       = false;
+    int64_t                 m_numBatches = 0, m_numRequests = 0;
+
+    // Started last, once everything it uses is constructed
+    std::thread m_worker;
+
+    static Config CheckConfig(Config config);
+    static void   CheckCuda(cudaError_t err, const char *what);
+
+    void run();
+    void process(std::vector<Request> &batch);
+};
+
+// BatchCoalescer implementation ------------------------------
+
+inline BatchCoalescer::Config BatchCoalescer::CheckConfig(Config config)
+{
+    if (config.maxBatch < 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Batches must hold at least one request");
+    }
+    if (config.timeout.count() < 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Timeout must not be negative");
+    }
+    return config;
+}
+
+inline void BatchCoalescer::CheckCuda(cudaError_t err, const char *what)
+{
+    if (err != cudaSuccess)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_DEVICE, "%s failed: %s", what, cudaGetErrorString(err));
+    }
+}
+
+inline BatchCoalescer::BatchCoalescer(cudaStream_t stream, Config config, LaunchFn launch)
+    : m_stream(stream)
+    , m_config(CheckConfig(config))
+    , m_launch(std::move(launch))
+    , m_inBatch(m_config.maxBatch)
+    , m_outBatch(m_config.maxBatch)
+{
+    if (!m_launch)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Launch function must not be empty");
+    }
+
+    CheckCuda(cudaGetDevice(&m_device), "cudaGetDevice");
+    CheckCuda(cudaEventCreateWithFlags(&m_doneEvent, cudaEventDisableTiming), "cudaEventCreateWithFlags");
+
+    m_worker = std::thread([this] { this->run(); });
+}
+
+inline BatchCoalescer::~BatchCoalescer()
+{
+    {
+        std::lock_guard<std::mutex> lk(m_mtx);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_worker.join();
+
+    cudaEventDestroy(m_doneEvent);
+}
+
+inline std::future<void> BatchCoalescer::submit(const nvcv::IImage &in, const nvcv::IImage &out)
+{
+    std::future<void> done;
+    {
+        std::lock_guard<std::mutex> lk(m_mtx);
+        m_pending.push_back(Request{&in, &out, std::promise<void>(), Clock::now()});
+        done = m_pending.back().done.get_future();
+    }
+    m_cv.notify_all();
+    return done;
+}
+
+inline void BatchCoalescer::flush()
+{
+    {
+        std::lock_guard<std::mutex> lk(m_mtx);
+        m_numFlushed = m_pending.size();
+    }
+    m_cv.notify_all();
+}
+
+inline int64_t BatchCoalescer::numBatches() const
+{
+    std::lock_guard<std::mutex> lk(m_mtx);
+    return m_numBatches;
+}
+
+inline int64_t BatchCoalescer::numRequests() const
+{
+    std::lock_guard<std::mutex> lk(m_mtx);
+    return m_numRequests;
+}
+
+inline void BatchCoalescer::run()
+{
+    // The worker thread starts with the default device, not the creator's
+    if (cudaSetDevice(m_device) != cudaSuccess)
+    {
+        m_device = -1;
+    }
+
+    const size_t maxBatch = m_config.maxBatch;
+
+    std::unique_lock<std::mutex> lk(m_mtx);
+    for (;;)
+    {
+        m_cv.wait(lk, [&] { return m_stop || !m_pending.empty(); });
+        if (m_pending.empty())
+        {
+            break;
+        }
+
+        // The oldest request bounds how long the batch waits for more requests
+        m_cv.wait_until(lk, m_pending.front().submitted + m_config.timeout,
+                        [&] { return m_stop || m_numFlushed > 0 || m_pending.size() >= maxBatch; });
+
+        std::vector<Request> batch;
+        while (!m_pending.empty() && batch.size() < maxBatch)
+        {
+            batch.push_back(std::move(m_pending.front()));
+            m_pending.pop_front();
+        }
+        m_numFlushed -= std::min(m_numFlushed, batch.size());
+
+        lk.unlock();
+        this->process(batch);
+        lk.lock();
+    }
+}
+
+inline void BatchCoalescer::process(std::vector<Request> &batch)
+{
+    std::exception_ptr err;
+    try
+    {
+        if (m_device < 0)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_DEVICE, "Worker thread couldn't select the stream's device");
+        }
+
+        m_inBatch.clear();
+        m_outBatch.clear();
+        for (const Request &r : batch)
+        {
+            m_inBatch.pushBack(*r.in);
+            m_outBatch.pushBack(*r.out);
+        }
+
+        m_launch(m_stream, m_inBatch, m_outBatch);
+
+        // Requests are done when the launch is, batches are reused by the next launch once it's done as well
+        CheckCuda(cudaEventRecord(m_doneEvent, m_stream), "cudaEventRecord");
+        CheckCuda(cudaEventSynchronize(m_doneEvent), "cudaEventSynchronize");
+    }
+    catch (...)
+    {
+        err = std::current_exception();
+    }
+
+    // Counted before the requests complete, so that their submitters see them
+    {
+        std::lock_guard<std::mutex> lk(m_mtx);
+        m_numBatches += 1;
+        m_numRequests += batch.size();
+    }
+
+    for (Request &r : batch)
+    {
+        if (err)
+        {
+            r.done.set_exception(err);
+        }
+        else
+        {
+            r.done.set_value();
+        }
+    }
+}
+
+} // namespace cvcuda
+
+/** @} */
+
+#endif // CVCUDA_BATCH_COALESCER_HPP
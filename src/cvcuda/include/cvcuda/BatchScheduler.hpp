@@ -0,0 +1,338 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file BatchScheduler.hpp
+ *
+ * @brief Defines the public C++ class that splits batches across several streams or devices.
+ * @defgroup NVCV_CPP_ALGORITHM_BATCHSCHEDULER BatchScheduler
+ * @{
+ */
+
+#ifndef CVCUDA_BATCH_SCHEDULER_HPP
+#define CVCUDA_BATCH_SCHEDULER_HPP
+
+#include <cuda_runtime.h>
+#include <nvcv/Exception.hpp>
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cvcuda {
+
+/**
+ * Splits the samples of a batch in contiguous shards and runs an operator on each shard in its own stream.
+ *
+ * Each lane is a (device, stream) pair. Running a batch makes every lane wait for the work already submitted to
+ * the caller's stream, calls the user function with the lane's stream and shard, and makes the caller's stream
+ * wait for all the lanes, so from the caller's point of view the result behaves as if the whole batch had been
+ * processed on its stream. No host synchronization takes place.
+ *
+ * Shards alias the original data: tensor shards are strided views of the outermost "N" dimension, and varshape
+ * shards are new image batches referring to the same images, so no pixel is copied.
+ *
+ * Operators keep internal state (e.g. parameter buffers and workspaces) bound to the stream they run on, so the
+ * user function should use one operator instance per lane, created on the lane's device. Lanes on different
+ * devices must be able to access the batch memory, e.g. through peer access or managed memory.
+ *
+ * @code
+ * std::vector<cvcuda::Flip> flips(2);
+ * cvcuda::BatchScheduler sched({{0, stream0}, {0, stream1}});
+ * sched(stream, in, out,
+ *       [&](int lane, cudaStream_t s, nvcv::ITensor &inShard, nvcv::ITensor &outShard)
+ *       { flips[lane](s, inShard, outShard, 1); });
+ * @endcode
+ */
+class BatchScheduler
+{
+public:
+    struct Lane
+    {
+        int          device; ///< CUDA device the lane runs on.
+        cudaStream_t stream; ///< Stream of the lane, belonging to device.
+    };
+
+    /// Range [begin, end) of samples of a shard.
+    using Range = std::pair<int32_t, int32_t>;
+
+    /**
+     * Create a scheduler over the given lanes.
+     *
+     * The stream passed when running batches must belong to the device current when the scheduler is created.
+     *
+     * @param[in] lanes Lanes the batches are split across, at least one.
+     */
+    explicit BatchScheduler(std::vector<Lane> lanes);
+    ~BatchScheduler();
+
+    BatchScheduler(const BatchScheduler &)            = delete;
+    BatchScheduler &operator=(const BatchScheduler &) = delete;
+
+    int32_t numLanes() const;
+
+    /**
+     * Split [0, numSamples) into contiguous ranges of nearly equal size, one per lane at most.
+     */
+    std::vector<Range> split(int32_t numSamples) const;
+
+    /**
+     * Run fn(lane, laneStream, begin, end) for every non-empty shard of [0, numSamples).
+     *
+     * The function is called with the lane's device set as current device, and the caller's device is restored
+     * afterwards.
+     */
+    template<class F>
+    void operator()(cudaStream_t stream, int32_t numSamples, F &&fn);
+
+    /**
+     * Split input and output tensors along their outermost "N" dimension and run
+     * fn(lane, laneStream, inShard, outShard) on each shard.
+     */
+    template<class F>
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, F &&fn);
+
+    /**
+     * Split input and output varshape image batches and run fn(lane, laneStream, inShard, outShard) on each
+     * shard.
+     */
+    template<class F>
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out, F &&fn);
+
+    /**
+     * Create a zero-copy view of samples [begin, end) of a tensor whose outermost dimension is "N".
+     * The view keeps the tensor alive.
+     */
+    static std::unique_ptr<nvcv::TensorSlice> SliceTensor(const nvcv::ITensor &tensor, int32_t begin, int32_t end);
+
+    /**
+     * Create an image batch holding images [begin, end) of another batch, sharing the same images.
+     * The view keeps the batch alive.
+     */
+    static std::unique_ptr<nvcv::ImageBatchVarShapeSubrange> SliceBatch(const nvcv::IImageBatchVarShape &batch,
+                                                                        int32_t begin, int32_t end);
+
+private:
+    std::vector<Lane>        m_lanes;
+    std::vector<cudaEvent_t> m_joinEvents;
+    cudaEvent_t              m_forkEvent = nullptr;
+
+    static void CheckCuda(cudaError_t err, const char *what);
+};
+
+// BatchScheduler implementation ------------------------------
+
+inline void BatchScheduler::CheckCuda(cudaError_t err, const char *what)
+{
+    if (err != cudaSuccess)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_DEVICE, "%s failed: %s", what, cudaGetErrorString(err));
+    }
+}
+
+inline BatchScheduler::BatchScheduler(std::vector<Lane> lanes)
+    : m_lanes(std::move(lanes))
+{
+    if (m_lanes.empty())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "BatchScheduler needs at least one lane");
+    }
+
+    int curDevice;
+    CheckCuda(cudaGetDevice(&curDevice), "cudaGetDevice");
+    CheckCuda(cudaEventCreateWithFlags(&m_forkEvent, cudaEventDisableTiming), "cudaEventCreateWithFlags");
+
+    // join events are recorded on the lanes' streams so they must be created on their devices
+    for (const Lane &lane : m_lanes)
+    {
+        cudaEvent_t ev  = nullptr;
+        cudaError_t err = cudaSetDevice(lane.device);
+        if (err == cudaSuccess)
+        {
+            err = cudaEventCreateWithFlags(&ev, cudaEventDisableTiming);
+        }
+        if (err != cudaSuccess)
+        {
+            for (cudaEvent_t created : m_joinEvents)
+            {
+                cudaEventDestroy(created);
+            }
+            cudaEventDestroy(m_forkEvent);
+            cudaSetDevice(curDevice);
+            CheckCuda(err, "Lane event creation");
+        }
+        m_joinEvents.push_back(ev);
+    }
+
+    CheckCuda(cudaSetDevice(curDevice), "cudaSetDevice");
+}
+
+inline BatchScheduler::~BatchScheduler()
+{
+    for (cudaEvent_t ev : m_joinEvents)
+    {
+        cudaEventDestroy(ev);
+    }
+    m_joinEvents.clear();
+
+    if (m_forkEvent)
+    {
+        cudaEventDestroy(m_forkEvent);
+        m_forkEvent = nullptr;
+    }
+}
+
+inline int32_t BatchScheduler::numLanes() const
+{
+    return static_cast<int32_t>(m_lanes.size());
+}
+
+inline std::vector<BatchScheduler::Range> BatchScheduler::split(int32_t numSamples) const
+{
+    std::vector<Range> ranges;
+
+    int32_t numShards = std::min(numSamples, numLanes());
+    int32_t begin     = 0;
+    for (int32_t i = 0; i < numShards; ++i)
+    {
+        // the first numSamples % numShards shards get one extra sample
+        int32_t count = numSamples / numShards + (i < numSamples % numShards ? 1 : 0);
+        ranges.emplace_back(begin, begin + count);
+        begin += count;
+    }
+
+    return ranges;
+}
+
+template<class F>
+void BatchScheduler::operator()(cudaStream_t stream, int32_t numSamples, F &&fn)
+{
+    std::vector<Range> ranges = this->split(numSamples);
+
+    int curDevice;
+    CheckCuda(cudaGetDevice(&curDevice), "cudaGetDevice");
+
+    // lanes start once everything submitted so far to the caller's stream is done
+    CheckCuda(cudaEventRecord(m_forkEvent, stream), "cudaEventRecord");
+
+    struct DeviceGuard
+    {
+        int device;
+
+        ~DeviceGuard()
+        {
+            cudaSetDevice(device);
+        }
+    } guard{curDevice};
+
+    for (size_t i = 0; i < ranges.size(); ++i)
+    {
+        const Lane &lane = m_lanes[i];
+
+        CheckCuda(cudaSetDevice(lane.device), "cudaSetDevice");
+        CheckCuda(cudaStreamWaitEvent(lane.stream, m_forkEvent, 0), "cudaStreamWaitEvent");
+
+        fn(static_cast<int>(i), lane.stream, ranges[i].first, ranges[i].second);
+
+        CheckCuda(cudaEventRecord(m_joinEvents[i], lane.stream), "cudaEventRecord");
+    }
+
+    CheckCuda(cudaSetDevice(curDevice), "cudaSetDevice");
+    for (size_t i = 0; i < ranges.size(); ++i)
+    {
+        CheckCuda(cudaStreamWaitEvent(stream, m_joinEvents[i], 0), "cudaStreamWaitEvent");
+    }
+}
+
+template<class F>
+void BatchScheduler::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, F &&fn)
+{
+    if (in.layout().find('N') != 0 || out.layout().find('N') != 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Tensors must have the sample dimension 'N' as outermost dimension");
+    }
+    if (in.shape()[0] != out.shape()[0])
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input and output tensors must have the same number of samples");
+    }
+
+    // views are created upfront so that a failure doesn't leave lanes half-submitted
+    std::vector<std::unique_ptr<nvcv::TensorSlice>> inShards, outShards;
+    for (const Range &r : this->split(static_cast<int32_t>(in.shape()[0])))
+    {
+        inShards.push_back(SliceTensor(in, r.first, r.second));
+        outShards.push_back(SliceTensor(out, r.first, r.second));
+    }
+
+    (*this)(stream, static_cast<int32_t>(in.shape()[0]),
+            [&](int lane, cudaStream_t laneStream, int32_t, int32_t)
+            { fn(lane, laneStream, *inShards[lane], *outShards[lane]); });
+}
+
+template<class F>
+void BatchScheduler::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
+                                F &&fn)
+{
+    if (in.numImages() != out.numImages())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input and output batches must have the same number of images");
+    }
+
+    std::vector<std::unique_ptr<nvcv::ImageBatchVarShapeSubrange>> inShards, outShards;
+    for (const Range &r : this->split(in.numImages()))
+    {
+        inShards.push_back(SliceBatch(in, r.first, r.second));
+        outShards.push_back(SliceBatch(out, r.first, r.second));
+    }
+
+    (*this)(stream, in.numImages(),
+            [&](int lane, cudaStream_t laneStream, int32_t, int32_t)
+            { fn(lane, laneStream, *inShards[lane], *outShards[lane]); });
+}
+
+inline std::unique_ptr<nvcv::TensorSlice> BatchScheduler::SliceTensor(const nvcv::ITensor &tensor, int32_t begin,
+                                                                       int32_t end)
+{
+    if (tensor.layout().find('N') != 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Tensor must have the sample dimension 'N' as outermost dimension");
+    }
+
+    return std::unique_ptr<nvcv::TensorSlice>(new nvcv::TensorSlice(tensor, 0, begin, end));
+}
+
+inline std::unique_ptr<nvcv::ImageBatchVarShapeSubrange> BatchScheduler::SliceBatch(
+    const nvcv::IImageBatchVarShape &batch, int32_t begin, int32_t end)
+{
+    return std::unique_ptr<nvcv::ImageBatchVarShapeSubrange>(
+        new nvcv::ImageBatchVarShapeSubrange(batch, begin, end - begin));
+}
+
+} // namespace cvcuda
+
+/** @} */
+
+#endif // CVCUDA_BATCH_SCHEDULER_HPP
@@ -26,6 +26,8 @@
 
 #include "Operator.h"
 
+#include <nvcv/detail/CheckError.hpp>
+
 namespace cvcuda {
 
 class IOperator
@@ -35,6 +37,23 @@ public:
 
     virtual NVCVOperatorHandle handle() const noexcept = 0;
 
+    NVCVOperatorWorkspaceRequirements workspaceRequirements() const
+    {
+        NVCVOperatorWorkspaceRequirements reqs;
+        nvcv::detail::CheckThrow(nvcvOperatorGetWorkspaceRequirements(this->handle(), &reqs));
+        return reqs;
+    }
+
+    void setWorkspace(void *cudaMem, int64_t size)
+    {
+        nvcv::detail::CheckThrow(nvcvOperatorSetWorkspace(this->handle(), cudaMem, size));
+    }
+
+    void reserveWorkspace(cudaStream_t stream)
+    {
+        nvcv::detail::CheckThrow(nvcvOperatorReserveWorkspace(this->handle(), stream));
+    }
+
 private:
 };
 
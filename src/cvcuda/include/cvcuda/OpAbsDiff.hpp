@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpAbsDiff.hpp
+ *
+ * @brief Defines the public C++ Class for the absolute difference operation.
+ * @defgroup NVCV_CPP_ALGORITHM_ABSDIFF AbsDiff
+ * @{
+ */
+
+#ifndef CVCUDA_ABSDIFF_HPP
+#define CVCUDA_ABSDIFF_HPP
+
+#include "IOperator.hpp"
+#include "OpAbsDiff.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class AbsDiff final : public IOperator
+{
+public:
+    explicit AbsDiff();
+
+    ~AbsDiff();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in1, nvcv::ITensor &in2, nvcv::ITensor &out);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline AbsDiff::AbsDiff()
+{
+    nvcv::detail::CheckThrow(cvcudaAbsDiffCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline AbsDiff::~AbsDiff()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void AbsDiff::operator()(cudaStream_t stream, nvcv::ITensor &in1, nvcv::ITensor &in2, nvcv::ITensor &out)
+{
+    nvcv::detail::CheckThrow(cvcudaAbsDiffSubmit(m_handle, stream, in1.handle(), in2.handle(), out.handle()));
+}
+
+inline NVCVOperatorHandle AbsDiff::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_ABSDIFF_HPP
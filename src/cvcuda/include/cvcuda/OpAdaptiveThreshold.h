@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpAdaptiveThreshold.h
+ *
+ * @brief Defines types and functions to handle the adaptive threshold operation.
+ * @defgroup NVCV_C_ALGORITHM_ADAPTIVE_THRESHOLD Adaptive Threshold
+ * @{
+ */
+
+#ifndef CVCUDA_ADAPTIVE_THRESHOLD_H
+#define CVCUDA_ADAPTIVE_THRESHOLD_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the adaptive threshold operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @param [in] maxBatchSize maximum number of samples of the tensors given to the operator.
+ *                          + Must not be negative.
+ *
+ * @param [in] maxWidth maximum width of the images given to the operator.
+ *                      + Must not be negative.
+ *
+ * @param [in] maxHeight maximum height of the images given to the operator.
+ *                       + Must not be negative.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaAdaptiveThresholdCreate(NVCVOperatorHandle *handle, int32_t maxBatchSize,
+                                                       int32_t maxWidth, int32_t maxHeight);
+
+/** Executes the adaptive threshold operation on the given cuda stream. This operation does not wait for
+ *  completion.
+ *
+ *  Thresholds each pixel against the mean of the blockSize x blockSize window centered on it minus c, as OpenCV's
+ *  adaptiveThreshold with ADAPTIVE_THRESH_MEAN_C: with NVCV_THRESH_BINARY, the output is maxValue where the pixel
+ *  is above the threshold and 0 elsewhere, and the opposite with NVCV_THRESH_BINARY_INV. The means are rounded to
+ *  the nearest integer, and c is rounded up for NVCV_THRESH_BINARY and down for NVCV_THRESH_BINARY_INV.
+ *
+ *  The window sums are read from an integral image of the input, and the windows are clipped to the image at its
+ *  borders, the mean being taken over the pixels inside it, whereas OpenCV replicates the border pixels.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | Yes
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | Yes
+ *       Height        | Yes
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor.
+ *                + Must not have more samples, columns or rows than given at creation.
+ *
+ * @param [out] out output tensor.
+ *
+ * @param [in] maxValue value of the pixels above the threshold, saturated to uint8.
+ *
+ * @param [in] type thresholding type, \ref NVCVThresholdType.
+ *
+ * @param [in] blockSize size of the window of the means.
+ *                       + Must be odd and greater than 1.
+ *
+ * @param [in] c constant subtracted from the means.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaAdaptiveThresholdSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                       NVCVTensorHandle in, NVCVTensorHandle out, double maxValue,
+                                                       NVCVThresholdType type, int32_t blockSize, double c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_ADAPTIVE_THRESHOLD_H */
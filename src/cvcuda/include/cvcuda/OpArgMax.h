@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpArgMax.h
+ *
+ * @brief Defines types and functions to handle the argmax operation.
+ * @defgroup NVCV_C_ALGORITHM_ARGMAX ArgMax
+ * @{
+ */
+
+#ifndef CVCUDA_ARGMAX_H
+#define CVCUDA_ARGMAX_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the argmax operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaArgMaxCreate(NVCVOperatorHandle *handle);
+
+/** Executes the argmax operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  Writes the index of the channel with the largest score of each pixel, such as the class of each pixel from the
+ *  logits or probabilities of a segmentation model. When the output is larger than the input, the scores are
+ *  upsampled to the output size in the same kernel, with the nearest or bilinear interpolation of Resize, and no
+ *  intermediate full-resolution scores are written. Ties go to the lowest channel.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNCHW, kCHW], one plane per class
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes, up to 256 classes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | Yes
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | No
+ *       Width         | No
+ *       Height        | No
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor with the scores, one plane per class.
+ *
+ * @param [out] out output tensor with the label of each pixel, of any size.
+ *
+ * @param [in] interpolation NVCV_INTERP_NEAREST or NVCV_INTERP_LINEAR, how the scores are resampled to the output
+ *                           size.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaArgMaxSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                            NVCVTensorHandle out, NVCVInterpolationType interpolation);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_ARGMAX_H */
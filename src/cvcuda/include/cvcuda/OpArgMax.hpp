@@ -0,0 +1,80 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpArgMax.hpp
+ *
+ * @brief Defines the public C++ Class for the argmax operation.
+ * @defgroup NVCV_CPP_ALGORITHM_ARGMAX ArgMax
+ * @{
+ */
+
+#ifndef CVCUDA_ARGMAX_HPP
+#define CVCUDA_ARGMAX_HPP
+
+#include "IOperator.hpp"
+#include "OpArgMax.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class ArgMax final : public IOperator
+{
+public:
+    explicit ArgMax();
+
+    ~ArgMax();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out,
+                    NVCVInterpolationType interpolation = NVCV_INTERP_NEAREST);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline ArgMax::ArgMax()
+{
+    nvcv::detail::CheckThrow(cvcudaArgMaxCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline ArgMax::~ArgMax()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void ArgMax::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out,
+                               NVCVInterpolationType interpolation)
+{
+    nvcv::detail::CheckThrow(cvcudaArgMaxSubmit(m_handle, stream, in.handle(), out.handle(), interpolation));
+}
+
+inline NVCVOperatorHandle ArgMax::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_ARGMAX_HPP
@@ -63,7 +63,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaAverageBlurCreate(NVCVOperatorHandle *handle, int
  * Limitations:
  *
  * Input:
- *      Data Layout:    [kNHWC, kHWC]
+ *      Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *      Channels:       [1, 3, 4]
  *
  *      Data Type      | Allowed
@@ -78,7 +78,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaAverageBlurCreate(NVCVOperatorHandle *handle, int
  *      64bit Float    | No
  *
  * Output:
- *      Data Layout:    [kNHWC, kHWC]
+ *      Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *      Channels:       [1, 3, 4]
  *
  *      Data Type      | Allowed
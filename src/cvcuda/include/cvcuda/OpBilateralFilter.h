@@ -60,7 +60,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaBilateralFilterCreate(NVCVOperatorHandle *handle)
  *  Destination must be same format and size as source
  *
  *  Input:
- *       Data Layout:    [kNHWC, kHWC]
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, kCHW], planar layouts with 1 channel only
  *       Channels:       [1, 3, 4]
  *
  *       Data Type      | Allowed
@@ -75,7 +75,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaBilateralFilterCreate(NVCVOperatorHandle *handle)
  *       64bit Float    | Yes
  *
  *  Output:
- *       Data Layout:    [kNHWC, kHWC]
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, kCHW], planar layouts with 1 channel only
  *       Channels:       [1, 3, 4]
  *
  *       Data Type      | Allowed
@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpBlurRegions.h
+ *
+ * @brief Defines types and functions to handle the blur regions operation.
+ * @defgroup NVCV_C_ALGORITHM_BLUR_REGIONS Blur Regions
+ * @{
+ */
+
+#ifndef CVCUDA_BLUR_REGIONS_H
+#define CVCUDA_BLUR_REGIONS_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/BorderType.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the blur regions operator.
+ *
+ * The operator reserves a workspace of 4 floats per pixel of maxBatchSize images of maxWidth x maxHeight, for the
+ * rows blurred by the first pass of the Gaussian blur or the means of the pixelation cells.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @param [in] maxBatchSize maximum number of samples of the tensors given to the operator.
+ *                          + Must not be negative.
+ *
+ * @param [in] maxWidth maximum width of the images given to the operator.
+ *                      + Must not be negative.
+ *
+ * @param [in] maxHeight maximum height of the images given to the operator.
+ *                       + Must not be negative.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaBlurRegionsCreate(NVCVOperatorHandle *handle, int32_t maxBatchSize, int32_t maxWidth,
+                                                 int32_t maxHeight);
+
+/** Executes the blur regions operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  Blurs or pixelates, in place, the pixels inside the boxes of each sample, e.g. to anonymize faces or license
+ *  plates, and leaves the other pixels untouched. Only the pixels of the boxes, and with the Gaussian blur the rows
+ *  around them, are read and written, so the cost follows the area of the boxes and not the size of the images.
+ *  Boxes are read from device memory, e.g. straight from \ref cvcudaNMSSubmit, without synchronizing.
+ *
+ *  Boxes are given by their corners `[x1, y1, x2, y2]` in pixel coordinates, with `x2` and `y2` exclusive. The
+ *  pixels of a box are those of the integer region covering it, clipped to the image, and empty boxes are skipped.
+ *
+ *  - \ref NVCV_BLUR_REGION_GAUSSIAN replaces each pixel of the boxes by the Gaussian blur of the image around it,
+ *    the same as \ref cvcudaGaussianSubmit with a square kernel, read from the image before any box is blurred.
+ *  - \ref NVCV_BLUR_REGION_PIXELATE replaces each pixel of the boxes by the mean of its cell, the cells being
+ *    squares of kernelSize pixels aligned with the top-left corner of the image, clipped to the image.
+ *
+ *  In both modes the new value of a pixel only depends on its position and the original image, so overlapping boxes
+ *  give the same result as their union.
+ *
+ *  Limitations:
+ *
+ *  Input/Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | Yes
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Boxes Tensor:
+ *
+ *       32-bit float tensor with layout [kNHWC, kHWC], one row of 4-channel boxes per sample, i.e. with shape
+ *       [N,1,M,4] for M boxes per sample, the same as the boxes of \ref cvcudaNMSSubmit.
+ *
+ *  Number of Boxes Tensor:
+ *
+ *       32-bit signed integer tensor with layout [kNHWC, kHWC] and a single element per sample, i.e. with shape
+ *       [N,1,1,1], the same as the count output of \ref cvcudaNMSSubmit. Only the first boxes of each sample
+ *       are used, up to their number.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in,out] inOut Images, modified in place.
+ *                       + Must not have more samples or a larger size than given at creation.
+ *
+ * @param [in] boxes Boxes tensor.
+ *                   + Must not have more than 65535 boxes per sample.
+ *
+ * @param [in] numBoxes Number of boxes tensor, or NULL to use all the boxes of the boxes tensor.
+ *
+ * @param [in] type Blur applied to the boxes, \ref NVCV_BLUR_REGION_GAUSSIAN or \ref NVCV_BLUR_REGION_PIXELATE.
+ *
+ * @param [in] kernelSize Size of the square Gaussian kernel, or of the pixelation cells.
+ *                        + The Gaussian kernel size must be odd and at most 255.
+ *                        + The cell size must be positive.
+ *
+ * @param [in] sigma Standard deviation of the Gaussian kernel, or 0 to compute it from the kernel size as
+ *                   0.3 * ((kernelSize - 1) * 0.5 - 1) + 0.8. Unused by the pixelation.
+ *
+ * @param [in] borderMode Border used by the Gaussian blur to read pixels outside of the image, from
+ *                        \ref NVCVBorderType. The constant border reads zeros. Unused by the pixelation.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaBlurRegionsSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                 NVCVTensorHandle inOut, NVCVTensorHandle boxes,
+                                                 NVCVTensorHandle numBoxes, NVCVBlurRegionType type,
+                                                 int32_t kernelSize, double sigma, NVCVBorderType borderMode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_BLUR_REGIONS_H */
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpBlurRegions.hpp
+ *
+ * @brief Defines the public C++ Class for the blur regions operation.
+ * @defgroup NVCV_CPP_ALGORITHM_BLUR_REGIONS Blur Regions
+ * @{
+ */
+
+#ifndef CVCUDA_BLUR_REGIONS_HPP
+#define CVCUDA_BLUR_REGIONS_HPP
+
+#include "IOperator.hpp"
+#include "OpBlurRegions.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class BlurRegions final : public IOperator
+{
+public:
+    explicit BlurRegions(int32_t maxBatchSize, int32_t maxWidth, int32_t maxHeight);
+
+    ~BlurRegions();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &inOut, nvcv::ITensor &boxes, NVCVBlurRegionType type,
+                    int32_t kernelSize, double sigma = 0, NVCVBorderType borderMode = NVCV_BORDER_REFLECT101);
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &inOut, nvcv::ITensor &boxes, nvcv::ITensor &numBoxes,
+                    NVCVBlurRegionType type, int32_t kernelSize, double sigma = 0,
+                    NVCVBorderType borderMode = NVCV_BORDER_REFLECT101);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline BlurRegions::BlurRegions(int32_t maxBatchSize, int32_t maxWidth, int32_t maxHeight)
+{
+    nvcv::detail::CheckThrow(cvcudaBlurRegionsCreate(&m_handle, maxBatchSize, maxWidth, maxHeight));
+    assert(m_handle);
+}
+
+inline BlurRegions::~BlurRegions()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void BlurRegions::operator()(cudaStream_t stream, nvcv::ITensor &inOut, nvcv::ITensor &boxes,
+                                    NVCVBlurRegionType type, int32_t kernelSize, double sigma,
+                                    NVCVBorderType borderMode)
+{
+    nvcv::detail::CheckThrow(cvcudaBlurRegionsSubmit(m_handle, stream, inOut.handle(), boxes.handle(), nullptr, type,
+                                                     kernelSize, sigma, borderMode));
+}
+
+inline void BlurRegions::operator()(cudaStream_t stream, nvcv::ITensor &inOut, nvcv::ITensor &boxes,
+                                    nvcv::ITensor &numBoxes, NVCVBlurRegionType type, int32_t kernelSize,
+                                    double sigma, NVCVBorderType borderMode)
+{
+    nvcv::detail::CheckThrow(cvcudaBlurRegionsSubmit(m_handle, stream, inOut.handle(), boxes.handle(),
+                                                     numBoxes.handle(), type, kernelSize, sigma, borderMode));
+}
+
+inline NVCVOperatorHandle BlurRegions::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_BLUR_REGIONS_HPP
@@ -0,0 +1,132 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpBoxDecode.h
+ *
+ * @brief Defines types and functions to handle the box decode operation.
+ * @defgroup NVCV_C_ALGORITHM_BOX_DECODE Box Decode
+ * @{
+ */
+
+#ifndef CVCUDA_BOX_DECODE_H
+#define CVCUDA_BOX_DECODE_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the box decode operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaBoxDecodeCreate(NVCVOperatorHandle *handle);
+
+/** Executes the box decode operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  Decodes the box regression outputs of a detection model, such as SSD or Faster R-CNN heads, into boxes.
+ *  Anchors and boxes are corners [x1, y1, x2, y2], and deltas are [dx, dy, dw, dh] offsets of the anchor center,
+ *  relative to the anchor size, and logarithms of the size ratios:
+ *
+ *      cx = acx + dx * varianceXY * aw      w = aw * exp(dw * varianceWH)
+ *      cy = acy + dy * varianceXY * ah      h = ah * exp(dh * varianceWH)
+ *
+ *  Size deltas are clamped to log(1000/16) so that boxes don't overflow.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC], one row of 4-channel elements per sample, one column per anchor
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | Yes
+ *       Data Type     | Yes
+ *       Number        | Yes, anchors may also have a single sample shared by all samples
+ *       Channels      | Yes
+ *       Width         | Yes
+ *       Height        | Yes
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] anchors input tensor with the anchors, of one sample or of each sample.
+ *
+ * @param [in] deltas input tensor with the regression outputs of each sample.
+ *
+ * @param [out] boxes output tensor with the decoded boxes of each sample.
+ *
+ * @param [in] varianceXY scale of the center deltas.
+ *
+ * @param [in] varianceWH scale of the size deltas.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaBoxDecodeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                               NVCVTensorHandle anchors, NVCVTensorHandle deltas,
+                                               NVCVTensorHandle boxes, float varianceXY, float varianceWH);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_BOX_DECODE_H */
@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpBoxDecode.hpp
+ *
+ * @brief Defines the public C++ Class for the box decode operation.
+ * @defgroup NVCV_CPP_ALGORITHM_BOX_DECODE Box Decode
+ * @{
+ */
+
+#ifndef CVCUDA_BOX_DECODE_HPP
+#define CVCUDA_BOX_DECODE_HPP
+
+#include "IOperator.hpp"
+#include "OpBoxDecode.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class BoxDecode final : public IOperator
+{
+public:
+    explicit BoxDecode();
+
+    ~BoxDecode();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &anchors, nvcv::ITensor &deltas, nvcv::ITensor &boxes,
+                    float varianceXY = 1.f, float varianceWH = 1.f);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline BoxDecode::BoxDecode()
+{
+    nvcv::detail::CheckThrow(cvcudaBoxDecodeCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline BoxDecode::~BoxDecode()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void BoxDecode::operator()(cudaStream_t stream, nvcv::ITensor &anchors, nvcv::ITensor &deltas,
+                                  nvcv::ITensor &boxes, float varianceXY, float varianceWH)
+{
+    nvcv::detail::CheckThrow(cvcudaBoxDecodeSubmit(m_handle, stream, anchors.handle(), deltas.handle(),
+                                                   boxes.handle(), varianceXY, varianceWH));
+}
+
+inline NVCVOperatorHandle BoxDecode::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_BOX_DECODE_HPP
@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpBuildPyramid.h
+ *
+ * @brief Defines types and functions to handle the build pyramid operation.
+ * @defgroup NVCV_C_ALGORITHM_BUILD_PYRAMID Build Pyramid
+ * @{
+ */
+
+#ifndef CVCUDA_BUILD_PYRAMID_H
+#define CVCUDA_BUILD_PYRAMID_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the build pyramid operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaBuildPyramidCreate(NVCVOperatorHandle *handle);
+
+/** Executes the build pyramid operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  Builds the multi-scale pyramid of every sample, with all its levels written to a varshape batch. Level 0 is a
+ *  copy of the input, and each following level is the previous one blurred by the 5x5 Gaussian kernel
+ *  [1 4 6 4 1]^T [1 4 6 4 1] / 256 with a reflect-101 border and downscaled by 2, as OpenCV's pyrDown, with
+ *  size ((w + 1) / 2, (h + 1) / 2).  Each launch computes two levels, the first of them staying in shared memory
+ *  for the second, so the whole Gaussian pyramid takes (numLevels - 1) / 2 launches, rounded up.
+ *
+ *  Laplacian pyramids replace each level but the last by its difference with the 2x upscaling of the level below,
+ *  as OpenCV's pyrUp, so the input is recovered by adding upscaled levels back from the last one.  They take
+ *  numLevels - 1 more launches.
+ *
+ *  The levels of sample `n` are the output images `n * numLevels` to `n * numLevels + numLevels - 1`.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes, Gaussian only
+ *       8bit  Signed | No
+ *       16bit Unsigned | Yes, Gaussian only
+ *       16bit Signed | Yes, Gaussian only
+ *       32bit Unsigned | No
+ *       32bit Signed | No
+ *       32bit Float | Yes
+ *       64bit Float | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes, Gaussian only
+ *       8bit  Signed | No
+ *       16bit Unsigned | Yes, Gaussian only
+ *       16bit Signed | Yes, Gaussian only
+ *       32bit Unsigned | No
+ *       32bit Signed | No
+ *       32bit Float | Yes
+ *       64bit Float | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | Yes
+ *       Number        | No, numLevels images per sample
+ *       Channels      | Yes
+ *       Width         | Yes for level 0, halved rounding up at each level
+ *       Height        | Yes for level 0, halved rounding up at each level
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [out] out Output varshape image batch, with the levels of each sample.
+ *
+ * @param [in] numLevels Number of levels of each pyramid, including level 0.
+ *                       + Must be at least 1.
+ *
+ * @param [in] type Kind of pyramid, \ref NVCV_PYRAMID_GAUSSIAN or \ref NVCV_PYRAMID_LAPLACIAN.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaBuildPyramidSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                                  NVCVImageBatchHandle out, int32_t numLevels, NVCVPyramidType type);
+
+/** Executes the build pyramid operation on a varshape batch, see \ref cvcudaBuildPyramidSubmit.
+ *
+ *  Images must all have the same format, and each one gets its own pyramid, starting at its own size.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaBuildPyramidVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                          NVCVImageBatchHandle in, NVCVImageBatchHandle out,
+                                                          int32_t numLevels, NVCVPyramidType type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_BUILD_PYRAMID_H */
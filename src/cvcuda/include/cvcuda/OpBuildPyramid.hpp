@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpBuildPyramid.hpp
+ *
+ * @brief Defines the public C++ Class for the build pyramid operation.
+ * @defgroup NVCV_CPP_ALGORITHM_BUILD_PYRAMID Build Pyramid
+ * @{
+ */
+
+#ifndef CVCUDA_BUILD_PYRAMID_HPP
+#define CVCUDA_BUILD_PYRAMID_HPP
+
+#include "IOperator.hpp"
+#include "OpBuildPyramid.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class BuildPyramid final : public IOperator
+{
+public:
+    explicit BuildPyramid();
+
+    ~BuildPyramid();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::IImageBatchVarShape &out, int32_t numLevels,
+                    NVCVPyramidType type = NVCV_PYRAMID_GAUSSIAN);
+
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
+                    int32_t numLevels, NVCVPyramidType type = NVCV_PYRAMID_GAUSSIAN);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline BuildPyramid::BuildPyramid()
+{
+    nvcv::detail::CheckThrow(cvcudaBuildPyramidCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline BuildPyramid::~BuildPyramid()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void BuildPyramid::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::IImageBatchVarShape &out,
+                                     int32_t numLevels, NVCVPyramidType type)
+{
+    nvcv::detail::CheckThrow(cvcudaBuildPyramidSubmit(m_handle, stream, in.handle(), out.handle(), numLevels, type));
+}
+
+inline void BuildPyramid::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in,
+                                     nvcv::IImageBatchVarShape &out, int32_t numLevels, NVCVPyramidType type)
+{
+    nvcv::detail::CheckThrow(
+        cvcudaBuildPyramidVarShapeSubmit(m_handle, stream, in.handle(), out.handle(), numLevels, type));
+}
+
+inline NVCVOperatorHandle BuildPyramid::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_BUILD_PYRAMID_HPP
@@ -0,0 +1,172 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpCLAHE.h
+ *
+ * @brief Defines types and functions to handle the contrast limited adaptive histogram equalization operation.
+ * @defgroup NVCV_C_ALGORITHM_CLAHE CLAHE
+ * @{
+ */
+
+#ifndef CVCUDA_CLAHE_H
+#define CVCUDA_CLAHE_H
+
+#include "Operator.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the contrast limited adaptive histogram equalization operator.
+ *
+ * @param [out] handle Where the operator instance handle will be written to.
+ *                     + Must not be NULL.
+ * @param [in] maxBatchSize The maximum number of images that will be equalized at once, tensor samples
+ *                          or varshape images.
+ *                          + Positive value.
+ * @param [in] maxTilesX The maximum number of tile columns that will be used.
+ *                       + Positive value.
+ * @param [in] maxTilesY The maximum number of tile rows that will be used.
+ *                       + Positive value.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCLAHECreate(NVCVOperatorHandle *handle, int32_t maxBatchSize, int32_t maxTilesX,
+                                           int32_t maxTilesY);
+
+/** Executes the contrast limited adaptive histogram equalization operation on the given cuda stream. This
+ *  operation does not wait for completion.
+ *
+ *  Like cv::CLAHE, each image is split in a grid of tilesX x tilesY tiles, whose sizes are the image ones divided
+ *  by the grid ones and rounded up, the tiles past the image borders being mirrored.  The histogram of each tile
+ *  is clipped, its excess is redistributed among all bins, and its normalized cumulative histogram gives the tile
+ *  mapping.  Pixels are mapped by the bilinear interpolation of the mappings of the four tiles whose centers are
+ *  nearest to them.  The output may be the input itself.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | Yes
+ *       Data Type     | Yes
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | Yes
+ *       Height        | Yes
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor, with at most maxBatchSize samples of at least tilesX x tilesY pixels.
+ *
+ * @param [out] out output tensor.
+ *
+ * @param [in] clipLimit limit of the histogram bins, relative to the average bin count of a tile, e.g. 40 gives
+ *                       the default of cv::CLAHE.  Bins aren't clipped when it isn't positive, which gives
+ *                       the adaptive histogram equalization.
+ *
+ * @param [in] tilesX number of tile columns.
+ *                    + Between 1 and maxTilesX.
+ *
+ * @param [in] tilesY number of tile rows.
+ *                    + Between 1 and maxTilesY.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCLAHESubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                           NVCVTensorHandle out, float clipLimit, int32_t tilesX, int32_t tilesY);
+
+/** Executes the contrast limited adaptive histogram equalization operation on the images of a varshape batch, see
+ *  @ref cvcudaCLAHESubmit.
+ *
+ *  All images are split in the same tile grid, with tiles sized after each image.  Images must all have the same
+ *  format, and each output image the format and size of its input.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input image batch, with at most maxBatchSize images of at least tilesX x tilesY pixels.
+ *
+ * @param [out] out output image batch.
+ *
+ * @param [in] clipLimit limit of the histogram bins, relative to the average bin count of a tile.
+ *
+ * @param [in] tilesX number of tile columns.
+ *                    + Between 1 and maxTilesX.
+ *
+ * @param [in] tilesY number of tile rows.
+ *                    + Between 1 and maxTilesY.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCLAHEVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                   NVCVImageBatchHandle in, NVCVImageBatchHandle out, float clipLimit,
+                                                   int32_t tilesX, int32_t tilesY);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_CLAHE_H */
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpCLAHE.hpp
+ *
+ * @brief Defines the public C++ Class for the contrast limited adaptive histogram equalization operation.
+ * @defgroup NVCV_CPP_ALGORITHM_CLAHE CLAHE
+ * @{
+ */
+
+#ifndef CVCUDA_CLAHE_HPP
+#define CVCUDA_CLAHE_HPP
+
+#include "IOperator.hpp"
+#include "OpCLAHE.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class CLAHE final : public IOperator
+{
+public:
+    explicit CLAHE(int32_t maxBatchSize, int32_t maxTilesX = 8, int32_t maxTilesY = 8);
+
+    ~CLAHE();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, float clipLimit, int32_t tilesX,
+                    int32_t tilesY);
+
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
+                    float clipLimit, int32_t tilesX, int32_t tilesY);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline CLAHE::CLAHE(int32_t maxBatchSize, int32_t maxTilesX, int32_t maxTilesY)
+{
+    nvcv::detail::CheckThrow(cvcudaCLAHECreate(&m_handle, maxBatchSize, maxTilesX, maxTilesY));
+    assert(m_handle);
+}
+
+inline CLAHE::~CLAHE()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void CLAHE::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, float clipLimit,
+                              int32_t tilesX, int32_t tilesY)
+{
+    nvcv::detail::CheckThrow(
+        cvcudaCLAHESubmit(m_handle, stream, in.handle(), out.handle(), clipLimit, tilesX, tilesY));
+}
+
+inline void CLAHE::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
+                              float clipLimit, int32_t tilesX, int32_t tilesY)
+{
+    nvcv::detail::CheckThrow(
+        cvcudaCLAHEVarShapeSubmit(m_handle, stream, in.handle(), out.handle(), clipLimit, tilesX, tilesY));
+}
+
+inline NVCVOperatorHandle CLAHE::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_CLAHE_HPP
@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpCanny.h
+ *
+ * @brief Defines types and functions to handle the canny operation.
+ * @defgroup NVCV_C_ALGORITHM_CANNY Canny
+ * @{
+ */
+
+#ifndef CVCUDA_CANNY_H
+#define CVCUDA_CANNY_H
+
+#include "Operator.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the canny operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCannyCreate(NVCVOperatorHandle *handle);
+
+/** Executes the canny operation on the given cuda stream.
+ *
+ *  Finds the edges of each image of the input as OpenCV's Canny: the gradient is computed with the Sobel filters
+ *  of the aperture size, replicating the border, and thinned with the non-maximum suppression along its
+ *  direction. Pixels whose gradient magnitude is above the high threshold are edges, and those above the low
+ *  threshold are edges when connected to one through the 8-neighborhood. Edges are 255 in the output, and the
+ *  other pixels 0.
+ *
+ *  The connected components are propagated on the device in passes, each of them moving across at least one
+ *  32x8 tile of pixels, until a pass doesn't cross the tiles anymore. On devices without cooperative launches
+ *  the operation waits on the stream after each sequence of passes to know whether another one is needed.
+ *  While the stream is captured in a CUDA graph, a bounded sequence of passes is enqueued instead: twice the
+ *  number of tiles across the width and height of the image, enough for edges running across the image and
+ *  back. The passes left once the components converged do nothing.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Same shape and data type as the input.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor.
+ *
+ * @param [out] out output tensor with the edges.
+ *
+ * @param [in] thresholdLow gradient magnitude above which pixels connected to an edge are edges.
+ *                          + It must not be negative.
+ *
+ * @param [in] thresholdHigh gradient magnitude above which pixels are edges.
+ *                           + It must not be negative, the thresholds are swapped when it's below thresholdLow.
+ *
+ * @param [in] apertureSize aperture size of the Sobel filters, it can be 3, 5 or 7.
+ *
+ * @param [in] l2Gradient whether the gradient magnitude is sqrt(dx*dx + dy*dy), != 0, or |dx| + |dy|.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCannySubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                           NVCVTensorHandle out, float thresholdLow, float thresholdHigh,
+                                           int32_t apertureSize, int8_t l2Gradient);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_CANNY_H */
@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpCanny.hpp
+ *
+ * @brief Defines the public C++ Class for the canny operation.
+ * @defgroup NVCV_CPP_ALGORITHM_CANNY Canny
+ * @{
+ */
+
+#ifndef CVCUDA_CANNY_HPP
+#define CVCUDA_CANNY_HPP
+
+#include "IOperator.hpp"
+#include "OpCanny.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class Canny final : public IOperator
+{
+public:
+    explicit Canny();
+
+    ~Canny();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, float thresholdLow,
+                    float thresholdHigh, int32_t apertureSize = 3, bool l2Gradient = false);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline Canny::Canny()
+{
+    nvcv::detail::CheckThrow(cvcudaCannyCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline Canny::~Canny()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void Canny::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, float thresholdLow,
+                              float thresholdHigh, int32_t apertureSize, bool l2Gradient)
+{
+    nvcv::detail::CheckThrow(cvcudaCannySubmit(m_handle, stream, in.handle(), out.handle(), thresholdLow,
+                                               thresholdHigh, apertureSize, l2Gradient ? 1 : 0));
+}
+
+inline NVCVOperatorHandle Canny::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_CANNY_HPP
@@ -117,6 +117,34 @@ CVCUDA_PUBLIC NVCVStatus cvcudaCenterCropCreate(NVCVOperatorHandle *handle);
 CVCUDA_PUBLIC NVCVStatus cvcudaCenterCropSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
                                                 NVCVTensorHandle out, int32_t cropWidth, int32_t cropHeight);
 
+/** Creates a tensor viewing the center crop of every sample of the input, without copying any data.
+ *
+ *  The view aliases the input memory: its base pointer is offset to the top left corner of the crop and it has the
+ *  input strides, so it holds the values \ref cvcudaCenterCropSubmit would copy, with the same rounding of the
+ *  crop position. Operators reading strided tensors can take the view in place of a cropped copy. The view holds a
+ *  reference to the input, it must be released with \ref nvcvTensorDecRef.
+ *
+ * @param [in] in Tensor to be cropped.
+ *                + Must not be NULL.
+ *                + Its layout must have H and W dimensions.
+ *                + Tensor contents must be cuda-accessible, strided.
+ *
+ * @param [in] cropWidth Width of the crop.
+ *                       + Must be positive and not larger than the input width.
+ *
+ * @param [in] cropHeight Height of the crop.
+ *                        + Must be positive and not larger than the input height.
+ *
+ * @param [out] view Where the view handle will be written to.
+ *                   + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the view.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCenterCropView(NVCVTensorHandle in, int32_t cropWidth, int32_t cropHeight,
+                                              NVCVTensorHandle *view);
+
 #ifdef __cplusplus
 }
 #endif
@@ -76,6 +76,38 @@ inline NVCVOperatorHandle CenterCrop::handle() const noexcept
     return m_handle;
 }
 
+// Tensor viewing the centered crop of every sample of another tensor, i.e. the values CenterCrop would copy, sharing its
+// memory and keeping it alive.
+class CenterCropView final : public nvcv::ITensor
+{
+public:
+    explicit CenterCropView(const nvcv::ITensor &in, const nvcv::Size2D &cropSize);
+    ~CenterCropView();
+
+    CenterCropView(const CenterCropView &) = delete;
+
+private:
+    NVCVTensorHandle doGetHandle() const final override;
+
+    NVCVTensorHandle m_handle;
+};
+
+inline CenterCropView::CenterCropView(const nvcv::ITensor &in, const nvcv::Size2D &cropSize)
+{
+    nvcv::detail::CheckThrow(cvcudaCenterCropView(in.handle(), cropSize.w, cropSize.h, &m_handle));
+    nvcv::detail::SetObjectAssociation(nvcvTensorSetUserPointer, this, m_handle);
+}
+
+inline CenterCropView::~CenterCropView()
+{
+    nvcvTensorDecRef(m_handle, nullptr);
+}
+
+inline NVCVTensorHandle CenterCropView::doGetHandle() const
+{
+    return m_handle;
+}
+
 } // namespace cvcuda
 
 #endif // CVCUDA_CENTER_CROP_HPP
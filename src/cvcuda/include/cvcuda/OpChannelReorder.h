@@ -55,6 +55,9 @@ CVCUDA_PUBLIC NVCVStatus cvcudaChannelReorderCreate(NVCVOperatorHandle *handle);
 /** Executes the reformat operation on the given cuda stream. This operation does not
  *  wait for completion.
  *
+ *  The output batch may be the input one, channels are then reordered in place.  Other overlaps between their
+ *  images are rejected with #NVCV_ERROR_INVALID_ARGUMENT.
+ *
  *  Limitations:
  *
  *  * Input and output image formats must all have the same number of channels and
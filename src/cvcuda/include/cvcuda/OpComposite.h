@@ -40,6 +40,10 @@ extern "C"
 {
 #endif
 
+// @brief Flag to be used by composite operation to indicate the foreground is already multiplied by its mask, so
+//        that output = foreground + background * (255 - mask) / 255.
+#define CVCUDA_COMPOSITE_PREMULTIPLIED (1 << 0)
+
 /** Constructs and an instance of the composite operator.
  *
  * @param [out] handle Where the image instance handle will be written to.
@@ -123,6 +127,107 @@ CVCUDA_PUBLIC NVCVStatus cvcudaCompositeVarShapeSubmit(NVCVOperatorHandle handle
                                                        NVCVImageBatchHandle fgMask, NVCVImageBatchHandle output);
 /** @} */
 
+/** Executes the composite operation on the given cuda stream, with flags selecting how the foreground is blended.
+ *  This operation does not wait for completion.
+ *
+ *  Limitations are the same as @ref cvcudaCompositeSubmit. The blend is computed in integer arithmetic, rounding to
+ *  the nearest value.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] foreground input foreground tensor. Each image is BGR (3-channel) 8-bit.
+ *
+ * @param [in] background input background tensor. Each image is BGR (3-channel) 8-bit.
+ *
+ * @param [in] fgMask input foreground mask tensor. Each mask image is grayscale 8-bit
+ *
+ * @param [out] output output tensor. Each output image is BGR(A) (3-channel for BGR, 4-channel for BGRA) 8-bit.
+ *
+ * @param [in] flags 0, or CVCUDA_COMPOSITE_PREMULTIPLIED if the foreground is already multiplied by its mask.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCompositeFlagsSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                    NVCVTensorHandle foreground, NVCVTensorHandle background,
+                                                    NVCVTensorHandle fgMask, NVCVTensorHandle output, int32_t flags);
+
+/** Executes the composite operation of a foreground into a region of the background, in place, on the given cuda
+ *  stream. This operation does not wait for completion.
+ *
+ *  The foreground is usually smaller than the background, with its top-left pixel at (offsetX, offsetY) in the
+ *  background. Only the background pixels it covers are read and written, and parts of the foreground falling
+ *  outside the background are skipped.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [3] for the foreground, [1] for the mask
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Input/Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [3, 4], the 4th channel is left unchanged.
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | Yes
+ *       Data Type     | Yes
+ *       Number        | Yes
+ *       Channels      | No
+ *       Width         | No
+ *       Height        | No
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] foreground input foreground tensor. Each image is BGR (3-channel) 8-bit.
+ *
+ * @param [in] fgMask input foreground mask tensor, with the foreground size. Each mask image is grayscale 8-bit.
+ *
+ * @param [in,out] background background tensor, updated in place. Each image is BGR(A) 8-bit.
+ *
+ * @param [in] offsetX, offsetY position of the foreground top-left pixel in the background, may be negative.
+ *
+ * @param [in] flags 0, or CVCUDA_COMPOSITE_PREMULTIPLIED if the foreground is already multiplied by its mask.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCompositeROISubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                  NVCVTensorHandle foreground, NVCVTensorHandle fgMask,
+                                                  NVCVTensorHandle background, int32_t offsetX, int32_t offsetY,
+                                                  int32_t flags);
+
 #ifdef __cplusplus
 }
 #endif
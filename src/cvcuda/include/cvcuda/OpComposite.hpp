@@ -47,6 +47,12 @@ public:
     void operator()(cudaStream_t stream, nvcv::ITensor &foreground, nvcv::ITensor &background, nvcv::ITensor &fgMask,
                     nvcv::ITensor &output);
 
+    void operator()(cudaStream_t stream, nvcv::ITensor &foreground, nvcv::ITensor &background, nvcv::ITensor &fgMask,
+                    nvcv::ITensor &output, int32_t flags);
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &foreground, nvcv::ITensor &fgMask, nvcv::ITensor &background,
+                    int32_t offsetX, int32_t offsetY, int32_t flags = 0);
+
     void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &foreground, nvcv::IImageBatchVarShape &background,
                     nvcv::IImageBatchVarShape &fgMask, nvcv::IImageBatchVarShape &output);
 
@@ -75,6 +81,20 @@ inline void Composite::operator()(cudaStream_t stream, nvcv::ITensor &foreground
                                                    fgMask.handle(), output.handle()));
 }
 
+inline void Composite::operator()(cudaStream_t stream, nvcv::ITensor &foreground, nvcv::ITensor &background,
+                                  nvcv::ITensor &fgMask, nvcv::ITensor &output, int32_t flags)
+{
+    nvcv::detail::CheckThrow(cvcudaCompositeFlagsSubmit(m_handle, stream, foreground.handle(), background.handle(),
+                                                        fgMask.handle(), output.handle(), flags));
+}
+
+inline void Composite::operator()(cudaStream_t stream, nvcv::ITensor &foreground, nvcv::ITensor &fgMask,
+                                  nvcv::ITensor &background, int32_t offsetX, int32_t offsetY, int32_t flags)
+{
+    nvcv::detail::CheckThrow(cvcudaCompositeROISubmit(m_handle, stream, foreground.handle(), fgMask.handle(),
+                                                      background.handle(), offsetX, offsetY, flags));
+}
+
 inline void Composite::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &foreground,
                                   nvcv::IImageBatchVarShape &background, nvcv::IImageBatchVarShape &fgMask,
                                   nvcv::IImageBatchVarShape &output)
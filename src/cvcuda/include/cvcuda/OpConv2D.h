@@ -51,6 +51,24 @@ extern "C"
  */
 CVCUDA_PUBLIC NVCVStatus cvcudaConv2DCreate(NVCVOperatorHandle *handle);
 
+/** Constructs an instance of the Conv2D that computes the convolution with the given algorithm.
+ *
+ * With #NVCV_CONV2D_ALGO_FFT or #NVCV_CONV2D_ALGO_AUTO and large kernels, the images are correlated with the kernels
+ * by overlap-save FFTs using cuFFT, whose cost doesn't depend on the kernel size.  Their results are within float
+ * rounding of the direct convolution, instead of bitwise equal, and the operator uses a workspace of fixed size,
+ * see \ref nvcvOperatorGetWorkspaceRequirements.
+ *
+ * @param [out] handle Where the operator instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @param [in] algorithm Algorithm of the convolution, #NVCV_CONV2D_ALGO_AUTO chooses it from the kernel size.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or algorithm is invalid.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaConv2DCreateWithAlgorithm(NVCVOperatorHandle *handle, NVCVConv2DAlgorithm algorithm);
+
 /** Executes the Conv2D operation on the given cuda stream.  This operation does not wait for completion.
  *
  * Limitations:
@@ -115,7 +133,8 @@ CVCUDA_PUBLIC NVCVStatus cvcudaConv2DCreate(NVCVOperatorHandle *handle);
  *
  * @param [in] borderMode Border mode to be used when accessing elements outside, cf. \p NVCVBorderType.
  *
- * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range, or a kernel is larger than 512x512
+ *                                      with #NVCV_CONV2D_ALGO_FFT.
  * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
  * @retval #NVCV_SUCCESS                Operation executed successfully.
  */
@@ -41,6 +41,8 @@ class Conv2D final : public IOperator
 public:
     explicit Conv2D();
 
+    explicit Conv2D(NVCVConv2DAlgorithm algorithm);
+
     ~Conv2D();
 
     void operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::IImageBatch &out, nvcv::IImageBatch &kernel,
@@ -58,6 +60,12 @@ inline Conv2D::Conv2D()
     assert(m_handle);
 }
 
+inline Conv2D::Conv2D(NVCVConv2DAlgorithm algorithm)
+{
+    nvcv::detail::CheckThrow(cvcudaConv2DCreateWithAlgorithm(&m_handle, algorithm));
+    assert(m_handle);
+}
+
 inline Conv2D::~Conv2D()
 {
     nvcvOperatorDestroy(m_handle);
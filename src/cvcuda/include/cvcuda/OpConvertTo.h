@@ -27,9 +27,11 @@
 #define CVCUDA_CONVERT_TO_H
 
 #include "Operator.h"
+#include "Types.h"
 #include "detail/Export.h"
 
 #include <cuda_runtime.h>
+#include <nvcv/DataLayout.h>
 #include <nvcv/Status.h>
 #include <nvcv/Tensor.h>
 
@@ -52,8 +54,18 @@ CVCUDA_PUBLIC NVCVStatus cvcudaConvertToCreate(NVCVOperatorHandle *handle);
 /** Executes the ConvertTo operation on the given cuda stream. This operation does not
  *  wait for completion.
  *
+ *  With the same input and output type, the output may be the input itself, the operation then runs in place.
+ *  Other overlaps between them are rejected with #NVCV_ERROR_INVALID_ARGUMENT.
+ *
+ *  When both tensors are in host memory, wrapped with #NVCV_TENSOR_BUFFER_STRIDED_HOST, the operation runs on the
+ *  host instead, synchronously, and the stream isn't used.
+ *
  *  outputs(x,y) = saturate_cast<out_type>(α * inputs(x, y) + β)
  *
+ *  With an 8-bit output type this is a per-tensor quantization: scale `qs` and zero point `zp` are applied with
+ *  `α = 1 / qs` and `β = zp`.  Per-channel quantization is done by \ref cvcudaNormalizeSubmit, whose scale and base
+ *  tensors hold one value per channel.
+ *
  *  Limitations:
  *
  *  Input:
@@ -66,6 +78,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaConvertToCreate(NVCVOperatorHandle *handle);
  *       8bit  Signed   | Yes
  *       16bit Unsigned | Yes
  *       16bit Signed   | Yes
+ *       16bit Float    | Yes
  *       32bit Unsigned | No
  *       32bit Signed   | Yes
  *       32bit Float    | Yes
@@ -81,6 +94,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaConvertToCreate(NVCVOperatorHandle *handle);
  *       8bit  Signed   | Yes
  *       16bit Unsigned | Yes
  *       16bit Signed   | Yes
+ *       16bit Float    | Yes
  *       32bit Unsigned | No
  *       32bit Signed   | Yes
  *       32bit Float    | Yes
@@ -116,6 +130,199 @@ CVCUDA_PUBLIC NVCVStatus cvcudaConvertToCreate(NVCVOperatorHandle *handle);
 CVCUDA_PUBLIC NVCVStatus cvcudaConvertToSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
                                                NVCVTensorHandle out, const double alpha, const double beta);
 
+/** Executes the ConvertTo operation, reordering the channels of each pixel as it's converted.
+ *
+ * Output channel c is converted from the input channel selected by the c-th component of \p channelOrder, e.g.
+ * NVCV_SWIZZLE_ZYXW turns BGR(A) into RGB(A) without an operator of its own. The same input channel may feed
+ * several output channels.
+ *
+ * Limitations are the same as \ref cvcudaConvertToSubmit, both tensors must be cuda-accessible.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ * @param [in] in intput tensor.
+ * @param [out] out output tensor.
+ * @param [in] alpha Scalar for output data.
+ * @param [in] beta Offset for the data.
+ * @param [in] channelOrder Input channel of each output channel.
+ *                          + Its first components, one per channel, must be X, Y, Z or W selecting an existing
+ *                            channel.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_NOT_COMPATIBLE   Tensors are in host memory.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaConvertToReorderSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                      NVCVTensorHandle in, NVCVTensorHandle out, const double alpha,
+                                                      const double beta, NVCVSwizzle channelOrder);
+
+/** Executes the ConvertTo operation with a scale and shift per channel, writing the output in its own layout.
+ *
+ * Each output channel c is computed from input channel c with its own scale and shift:
+ *
+ * ```
+ * outputs(x,y,c) = saturate_cast<out_type>(alpha[c] * inputs(x, y, c) + beta[c])
+ * ```
+ *
+ * The output may be interleaved, like the input, or planar, so that mean/stddev preprocessing of 8-bit images for
+ * NCHW networks is done in a single pass instead of ConvertTo, Normalize and Reformat.  With \p alpha = `1 /
+ * stddev` and \p beta = `-mean / stddev` it matches 
+ef cvcudaNormalizeSubmit with per-channel parameters.
+ *
+ * Limitations:
+ *
+ * Input:
+ *      Data Layout:    [kNHWC, kHWC]
+ *      Channels:       [1-4]
+ *
+ *      Data Type      | Allowed
+ *      -------------- | -------------
+ *      8bit  Unsigned | Yes
+ *      8bit  Signed   | No
+ *      16bit Unsigned | No
+ *      16bit Signed   | No
+ *      16bit Float    | No
+ *      32bit Unsigned | No
+ *      32bit Signed   | No
+ *      32bit Float    | No
+ *      64bit Float    | No
+ *
+ * Output:
+ *      Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
+ *      Channels:       [1-4]
+ *
+ *      Data Type      | Allowed
+ *      -------------- | -------------
+ *      8bit  Unsigned | No
+ *      8bit  Signed   | No
+ *      16bit Unsigned | No
+ *      16bit Signed   | No
+ *      16bit Float    | Yes
+ *      32bit Unsigned | No
+ *      32bit Signed   | No
+ *      32bit Float    | Yes
+ *      64bit Float    | No
+ *
+ * Input/Output dependency
+ *
+ *      Property      |  Input == Output
+ *     -------------- | -------------
+ *      Data Layout   | No
+ *      Data Type     | No
+ *      Number        | Yes
+ *      Channels      | Yes
+ *      Width         | Yes
+ *      Height        | Yes
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in intput tensor.
+ *
+ * @param [out] out output tensor.
+ *
+ * @param [in] alpha Scale of each channel.
+ *                   + Must be a cuda-accessible 32-bit float tensor holding one packed value per channel, e.g. with
+ *                     shape [C] or [1,1,1,C].
+ *
+ * @param [in] beta Shift of each channel, with the same requirements as \p alpha.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_NOT_COMPATIBLE   Tensors are in host memory.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaConvertToPerChannelSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                         NVCVTensorHandle in, NVCVTensorHandle out,
+                                                         NVCVTensorHandle alpha, NVCVTensorHandle beta);
+
+/** Converts the input tensor to several output tensors on the given cuda stream.
+ *  This operation does not wait for completion.
+ *
+ *  Each output has its own data type, layout, scale and shift per channel and channel order, and is computed as
+ *  with \ref cvcudaConvertToReorderSubmit and \ref cvcudaConvertToPerChannelSubmit together:
+ *
+ *  ```
+ *  outputs[o](x,y,c) = saturate_cast<out_type[o]>(params[o].alpha[c] * inputs(x, y, order[o][c]) + params[o].beta[c])
+ *  ```
+ *
+ *  Outputs are written together, up to 8 per kernel launch, so that the input is read from memory once instead of
+ *  once per conversion, e.g. to feed a planar float network and an interleaved 8-bit encoder from the same frame.
+ *  Values are computed in single precision.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1-4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | Yes
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       16bit Float    | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | Yes
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
+ *       Channels:       [1-4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | Yes
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       16bit Float    | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | Yes
+ *       32bit Float    | Yes
+ *       64bit Float    | Yes
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | Yes
+ *       Height        | Yes
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor.
+ *
+ * @param [out] out output tensors.
+ *                  + Must not be NULL.
+ *                  + Must not overlap with the input.
+ *
+ * @param [in] params Conversion of each output, see \ref NVCVConvertToParams.
+ *                    + Must not be NULL.
+ *                    + The channel order of each output must select one of the input channels for each of them.
+ *
+ * @param [in] numOutputs Number of output tensors.
+ *                        + Must be positive.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaConvertToMultiSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                    NVCVTensorHandle in, const NVCVTensorHandle *out,
+                                                    const NVCVConvertToParams *params, int32_t numOutputs);
+
 #ifdef __cplusplus
 }
 #endif
@@ -34,6 +34,8 @@
 #include <nvcv/ImageFormat.hpp>
 #include <nvcv/alloc/Requirements.hpp>
 
+#include <vector>
+
 namespace cvcuda {
 
 class ConvertTo final : public IOperator
@@ -45,6 +47,19 @@ public:
 
     void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, const double alpha, const double beta);
 
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, const double alpha, const double beta,
+                    NVCVSwizzle channelOrder);
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, nvcv::ITensor &alpha,
+                    nvcv::ITensor &beta);
+
+    /**
+     * Convert \p in to the \p numOutputs tensors in \p out, each with its parameters, in one pass over the input,
+     * see \ref cvcudaConvertToMultiSubmit.
+     */
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor *const *out,
+                    const NVCVConvertToParams *params, int32_t numOutputs);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -69,6 +84,32 @@ inline void ConvertTo::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::
     nvcv::detail::CheckThrow(cvcudaConvertToSubmit(m_handle, stream, in.handle(), out.handle(), alpha, beta));
 }
 
+inline void ConvertTo::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, const double alpha,
+                                  const double beta, NVCVSwizzle channelOrder)
+{
+    nvcv::detail::CheckThrow(
+        cvcudaConvertToReorderSubmit(m_handle, stream, in.handle(), out.handle(), alpha, beta, channelOrder));
+}
+
+inline void ConvertTo::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, nvcv::ITensor &alpha,
+                                  nvcv::ITensor &beta)
+{
+    nvcv::detail::CheckThrow(cvcudaConvertToPerChannelSubmit(m_handle, stream, in.handle(), out.handle(),
+                                                             alpha.handle(), beta.handle()));
+}
+
+inline void ConvertTo::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor *const *out,
+                                  const NVCVConvertToParams *params, int32_t numOutputs)
+{
+    std::vector<NVCVTensorHandle> outHandles;
+    for (int32_t o = 0; o < numOutputs; ++o)
+    {
+        outHandles.push_back(out[o]->handle());
+    }
+    nvcv::detail::CheckThrow(
+        cvcudaConvertToMultiSubmit(m_handle, stream, in.handle(), outHandles.data(), params, numOutputs));
+}
+
 inline NVCVOperatorHandle ConvertTo::handle() const noexcept
 {
     return m_handle;
@@ -138,6 +138,46 @@ CVCUDA_PUBLIC NVCVStatus cvcudaCopyMakeBorderVarShapeStackSubmit(NVCVOperatorHan
                                                                  NVCVTensorHandle top, NVCVTensorHandle left,
                                                                  NVCVBorderType borderMode, const float4 borderValue);
 
+/** Executes the CopyMakeBorder operation from a varshape batch into a tensor with a border value per sample.
+ *
+ *  Each image is copied into its sample of the output tensor at (left, top), in one launch, as
+ *  \ref cvcudaCopyMakeBorderVarShapeStackSubmit does, e.g. to letterbox a batch into the network input. With
+ *  \p NVCV_BORDER_CONSTANT, the border of each sample takes its own value from \p borderValues instead of a single
+ *  value shared by the batch.
+ *
+ *  Limitations, data types and top/left tensors are the same as \ref cvcudaCopyMakeBorderSubmit.
+ *
+ *  Border values Tensor
+ *
+ *      Must be kNHWC where N is the number of images, H=W=1 and C the number of channels of the images.
+ *      Data Type must be 32bit Float, values are saturated to the output data type.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input image batch.
+ *
+ * @param [out] out Output tensor.
+ *
+ * @param [in] top The top pixels of each image.
+ *
+ * @param [in] left The left pixels of each image.
+ *
+ * @param [in] borderMode Border mode to be used when accessing elements outside input image, cf. \p NVCVBorderType.
+ *
+ * @param [in] borderValues Border value of each sample, used for constant border mode \p NVCV_BORDER_CONSTANT.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCopyMakeBorderVarShapeStackValuesSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                                       NVCVImageBatchHandle in, NVCVTensorHandle out,
+                                                                       NVCVTensorHandle top, NVCVTensorHandle left,
+                                                                       NVCVBorderType borderMode,
+                                                                       NVCVTensorHandle borderValues);
+
 #ifdef __cplusplus
 }
 #endif
@@ -50,6 +50,8 @@ public:
                     nvcv::ITensor &top, nvcv::ITensor &left, NVCVBorderType borderMode, const float4 borderValue);
     void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out, nvcv::ITensor &top,
                     nvcv::ITensor &left, NVCVBorderType borderMode, const float4 borderValue);
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out, nvcv::ITensor &top,
+                    nvcv::ITensor &left, NVCVBorderType borderMode, nvcv::ITensor &borderValues);
 
     virtual NVCVOperatorHandle handle() const noexcept override;
 
@@ -92,6 +94,14 @@ inline void CopyMakeBorder::operator()(cudaStream_t stream, nvcv::IImageBatchVar
         m_handle, stream, in.handle(), out.handle(), top.handle(), left.handle(), borderMode, borderValue));
 }
 
+inline void CopyMakeBorder::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out,
+                                       nvcv::ITensor &top, nvcv::ITensor &left, NVCVBorderType borderMode,
+                                       nvcv::ITensor &borderValues)
+{
+    nvcv::detail::CheckThrow(cvcudaCopyMakeBorderVarShapeStackValuesSubmit(
+        m_handle, stream, in.handle(), out.handle(), top.handle(), left.handle(), borderMode, borderValues.handle()));
+}
+
 inline NVCVOperatorHandle CopyMakeBorder::handle() const noexcept
 {
     return m_handle;
@@ -0,0 +1,228 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpCropResize.h
+ *
+ * @brief Defines types and functions to handle the batched crop and resize operation.
+ * @defgroup NVCV_C_ALGORITHM_CROP_RESIZE Crop Resize
+ * @{
+ */
+
+#ifndef CVCUDA_CROP_RESIZE_H
+#define CVCUDA_CROP_RESIZE_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the crop resize operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCropResizeCreate(NVCVOperatorHandle *handle);
+
+/** Executes the crop resize operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  Crops every box out of the input and resizes it to the output width and height, as in ROI align.
+ *  Output sample `i` holds box `i`. All boxes are processed by one kernel launch, and boxes are read from
+ *  device memory, so they can be produced by a previous kernel, e.g. a detector, without synchronizing.
+ *
+ *  Boxes are given by their corners `[x1, y1, x2, y2]` in source pixel coordinates, with `x2` and `y2`
+ *  exclusive, so that an integer box `{x, y, width, height}` is `[x, y, x + width, y + height]`. Box
+ *  coordinates can be fractional. The box is mapped to the output with pixel centers aligned, as in
+ *  \ref cvcudaResizeSubmit, and pixels are read from the integer region covering the box, clipped to the
+ *  input. When downscaling integer boxes inside the input, the result is the same as
+ *  \ref cvcudaCustomCropSubmit followed by \ref cvcudaResizeSubmit for each box. Boxes falling outside of the input, or referring to a
+ *  sample that doesn't exist, give zero outputs.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | Yes
+ *       Number        | No
+ *       Channels      | Yes
+ *       Width         | No
+ *       Height        | No
+ *
+ *  Boxes Tensor:
+ *
+ *       32-bit float tensor with shape [N,4] holding `[x1, y1, x2, y2]` per box, or [N,5] holding
+ *       `[sample, x1, y1, x2, y2]`, where N is the output number of samples. Without the sample index,
+ *       box `i` is read from input sample `i`, or from sample 0 if the input has a single sample.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [in] boxes Boxes tensor.
+ *
+ * @param [out] out Output tensor, with one sample per box.
+ *
+ * @param [in] interpolation Interpolation method to be used, \ref NVCV_INTERP_NEAREST, \ref NVCV_INTERP_LINEAR or
+ *                           \ref NVCV_INTERP_AREA. Area averages all the pixels under each output pixel, which
+ *                           avoids aliasing when downscaling large boxes, and interpolates linearly when upscaling.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCropResizeSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                                NVCVTensorHandle boxes, NVCVTensorHandle out,
+                                                const NVCVInterpolationType interpolation);
+
+/** Executes the crop resize operation on a varshape batch, with optional flips, on the given cuda stream. This
+ *  operation does not wait for completion.
+ *
+ *  Same as \ref cvcudaCropResizeSubmit, with the boxes in coordinates of their own images, and each box optionally
+ *  flipped after being resized. This fuses the random resized crop and flip augmentations of training pipelines
+ *  into one launch that reads the decoded images once, and the boxes and flip codes can be drawn on device by
+ *  \ref cvcudaRandomCropVarShapeSubmit and \ref cvcudaRandomFlipCodeSubmit.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | Yes
+ *       Number        | No
+ *       Channels      | Yes
+ *       Width         | No
+ *       Height        | No
+ *
+ *  Boxes Tensor:
+ *
+ *       Same as \ref cvcudaCropResizeSubmit, with sample indices referring to images of the batch.
+ *
+ *  Flip Code Tensor:
+ *
+ *       32-bit signed integer tensor with shape [N] or [N,1], as in \ref cvcudaFlipVarShapeSubmit: 1 flips
+ *       box `i` horizontally, 0 vertically, -1 both, and any other value doesn't flip it.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input image batch, all images with the same format.
+ *
+ * @param [in] boxes Boxes tensor.
+ *
+ * @param [in] flipCode Flip code tensor, or NULL to not flip any box.
+ *
+ * @param [out] out Output tensor, with one sample per box.
+ *
+ * @param [in] interpolation Interpolation method to be used, \ref NVCV_INTERP_NEAREST, \ref NVCV_INTERP_LINEAR or
+ *                           \ref NVCV_INTERP_AREA.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCropResizeVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                        NVCVImageBatchHandle in, NVCVTensorHandle boxes,
+                                                        NVCVTensorHandle flipCode, NVCVTensorHandle out,
+                                                        const NVCVInterpolationType interpolation);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_CROP_RESIZE_H */
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpCropResize.hpp
+ *
+ * @brief Defines the public C++ Class for the batched crop and resize operation.
+ * @defgroup NVCV_CPP_ALGORITHM_CROP_RESIZE Crop Resize
+ * @{
+ */
+
+#ifndef CVCUDA_CROP_RESIZE_HPP
+#define CVCUDA_CROP_RESIZE_HPP
+
+#include "IOperator.hpp"
+#include "OpCropResize.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class CropResize final : public IOperator
+{
+public:
+    explicit CropResize();
+
+    ~CropResize();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &boxes, nvcv::ITensor &out,
+                    const NVCVInterpolationType interpolation);
+
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &boxes, nvcv::ITensor *flipCode,
+                    nvcv::ITensor &out, const NVCVInterpolationType interpolation);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline CropResize::CropResize()
+{
+    nvcv::detail::CheckThrow(cvcudaCropResizeCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline CropResize::~CropResize()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void CropResize::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &boxes, nvcv::ITensor &out,
+                                   const NVCVInterpolationType interpolation)
+{
+    nvcv::detail::CheckThrow(
+        cvcudaCropResizeSubmit(m_handle, stream, in.handle(), boxes.handle(), out.handle(), interpolation));
+}
+
+inline void CropResize::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &boxes,
+                                   nvcv::ITensor *flipCode, nvcv::ITensor &out,
+                                   const NVCVInterpolationType interpolation)
+{
+    nvcv::detail::CheckThrow(cvcudaCropResizeVarShapeSubmit(m_handle, stream, in.handle(), boxes.handle(),
+                                                            flipCode ? flipCode->handle() : nullptr, out.handle(),
+                                                            interpolation));
+}
+
+inline NVCVOperatorHandle CropResize::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_CROP_RESIZE_HPP
@@ -115,6 +115,30 @@ CVCUDA_PUBLIC NVCVStatus cvcudaCustomCropCreate(NVCVOperatorHandle *handle);
 CVCUDA_PUBLIC NVCVStatus cvcudaCustomCropSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
                                                 NVCVTensorHandle out, const NVCVRectI cropRect);
 
+/** Creates a tensor viewing the given rectangle of every sample of the input, without copying any data.
+ *
+ *  The view aliases the input memory: its base pointer is offset to the top left corner of the rectangle and it has
+ *  the input strides, so it holds the values \ref cvcudaCustomCropSubmit would copy. Operators reading strided
+ *  tensors can take the view in place of a cropped copy. The view holds a reference to the input, it must be
+ *  released with \ref nvcvTensorDecRef.
+ *
+ * @param [in] in Tensor to be cropped.
+ *                + Must not be NULL.
+ *                + Its layout must have H and W dimensions.
+ *                + Tensor contents must be cuda-accessible, strided.
+ *
+ * @param [in] cropRect Crop rectangle.
+ *                      + Must have a positive size and be inside the input.
+ *
+ * @param [out] view Where the view handle will be written to.
+ *                   + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the view.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCustomCropView(NVCVTensorHandle in, const NVCVRectI cropRect, NVCVTensorHandle *view);
+
 #ifdef __cplusplus
 }
 #endif
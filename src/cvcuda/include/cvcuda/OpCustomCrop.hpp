@@ -73,6 +73,38 @@ inline NVCVOperatorHandle CustomCrop::handle() const noexcept
     return m_handle;
 }
 
+// Tensor viewing the rectangle of every sample of another tensor, i.e. the values CustomCrop would copy, sharing its
+// memory and keeping it alive.
+class CustomCropView final : public nvcv::ITensor
+{
+public:
+    explicit CustomCropView(const nvcv::ITensor &in, const NVCVRectI &cropRect);
+    ~CustomCropView();
+
+    CustomCropView(const CustomCropView &) = delete;
+
+private:
+    NVCVTensorHandle doGetHandle() const final override;
+
+    NVCVTensorHandle m_handle;
+};
+
+inline CustomCropView::CustomCropView(const nvcv::ITensor &in, const NVCVRectI &cropRect)
+{
+    nvcv::detail::CheckThrow(cvcudaCustomCropView(in.handle(), cropRect, &m_handle));
+    nvcv::detail::SetObjectAssociation(nvcvTensorSetUserPointer, this, m_handle);
+}
+
+inline CustomCropView::~CustomCropView()
+{
+    nvcvTensorDecRef(m_handle, nullptr);
+}
+
+inline NVCVTensorHandle CustomCropView::doGetHandle() const
+{
+    return m_handle;
+}
+
 } // namespace cvcuda
 
 #endif // CVCUDA_CUSTOM_CROP_HPP
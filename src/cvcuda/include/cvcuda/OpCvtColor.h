@@ -31,6 +31,7 @@
 #include "detail/Export.h"
 
 #include <cuda_runtime.h>
+#include <nvcv/ColorSpec.h>
 #include <nvcv/ImageBatch.h>
 #include <nvcv/Status.h>
 #include <nvcv/Tensor.h>
@@ -70,10 +71,97 @@ CVCUDA_PUBLIC NVCVStatus cvcudaCvtColorCreate(NVCVOperatorHandle *handle);
 CVCUDA_PUBLIC NVCVStatus cvcudaCvtColorSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
                                               NVCVTensorHandle out, NVCVColorConversionCode code);
 
+/** Executes the CvtColor (convert color) operation on the given cuda stream, given the color spec of the input.
+ *  This operation does not wait for completion.
+ *
+ *  Same as \ref cvcudaCvtColorSubmit, where \p inSpec describes the input of the 16-bit YUV 4:2:0 conversions
+ *  (NVCV_COLOR_YUV2RGB_P010 and alike, P016 uses the same codes). Other conversions ignore it.
+ *
+ *  For these conversions:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1], luma plane followed by the interleaved CbCr plane, height is 3/2 of the output's
+ *       Data Type:      [16U], 10 or 12-bit samples are stored in the most significant bits
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [3, 4]
+ *       Data Type:      [8U, 16U, 32F], 32F values are in [0,1]
+ *
+ *  The YCbCr encoding (BT.601, BT.709, BT.2020 or SMPTE 240M) and the range of the input are taken from
+ *  \p inSpec. When its transfer function is #NVCV_COLOR_XFER_PQ or #NVCV_COLOR_XFER_HLG, the HDR content is
+ *  tone mapped to SDR in the same pass: it's linearized, its luminance is compressed so that the 1000 nits
+ *  peak maps to the 203 nits reference white of ITU-R BT.2408, converted to BT.709 primaries and encoded
+ *  with a 2.4 gamma. Otherwise the output is the non-linear RGB in the primaries of the input.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [out] out Output tensor.
+ *
+ * @param [in] code Color conversion code, \ref NVCVColorConversionCode.
+ *
+ * @param [in] inSpec Color spec of the input, e.g. #NVCV_COLOR_SPEC_BT2020_PQ.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCvtColorWithSpecSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                      NVCVTensorHandle in, NVCVTensorHandle out,
+                                                      NVCVColorConversionCode code, NVCVColorSpec inSpec);
+
 CVCUDA_PUBLIC NVCVStatus cvcudaCvtColorVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
                                                       NVCVImageBatchHandle in, NVCVImageBatchHandle out,
                                                       NVCVColorConversionCode code);
 
+/** Executes the CvtColor (convert color) operation on a batch of images with mixed formats on the given cuda
+ *  stream.  This operation does not wait for completion.
+ *
+ *  Each input image is converted from its own format to the format of the output batch, so that a batch
+ *  mixing, for instance, NV12 frames with BGR and grayscale images is converted in a single launch.  The
+ *  conversion of each image is selected by its image format, no conversion code is needed.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Image Formats:  Y8, Y8_ER, BGR8, RGB8, BGRA8, RGBA8, NV12 (two planes), can differ per image
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Image Formats:  Y8, Y8_ER, BGR8, RGB8, BGRA8, RGBA8, must be the same for all images
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Number        | Yes
+ *       Width         | Yes
+ *       Height        | Yes
+ *
+ *  Color images converted to gray use BT.601 weights, NV12 images use BT.601 limited range.  The alpha channel
+ *  is copied from 4-channel inputs and set to 255 otherwise.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input image batch, images can have different formats.
+ *
+ * @param [out] out Output image batch, all images must have the same format.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaCvtColorVarShapeMixedSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                           NVCVImageBatchHandle in, NVCVImageBatchHandle out);
+
 #ifdef __cplusplus
 }
 #endif
@@ -30,6 +30,7 @@
 #include "OpCvtColor.h"
 
 #include <cuda_runtime.h>
+#include <nvcv/ColorSpec.hpp>
 #include <nvcv/IImageBatch.hpp>
 #include <nvcv/ITensor.hpp>
 #include <nvcv/ImageFormat.hpp>
@@ -47,8 +48,13 @@ public:
 
     void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, NVCVColorConversionCode code);
 
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, NVCVColorConversionCode code,
+                    nvcv::ColorSpec inSpec);
+
     void operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::IImageBatch &out, NVCVColorConversionCode code);
 
+    void operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::IImageBatch &out);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -73,12 +79,23 @@ inline void CvtColor::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::I
     nvcv::detail::CheckThrow(cvcudaCvtColorSubmit(m_handle, stream, in.handle(), out.handle(), code));
 }
 
+inline void CvtColor::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out,
+                                 NVCVColorConversionCode code, nvcv::ColorSpec inSpec)
+{
+    nvcv::detail::CheckThrow(cvcudaCvtColorWithSpecSubmit(m_handle, stream, in.handle(), out.handle(), code, inSpec));
+}
+
 inline void CvtColor::operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::IImageBatch &out,
                                  NVCVColorConversionCode code)
 {
     nvcv::detail::CheckThrow(cvcudaCvtColorVarShapeSubmit(m_handle, stream, in.handle(), out.handle(), code));
 }
 
+inline void CvtColor::operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::IImageBatch &out)
+{
+    nvcv::detail::CheckThrow(cvcudaCvtColorVarShapeMixedSubmit(m_handle, stream, in.handle(), out.handle()));
+}
+
 inline NVCVOperatorHandle CvtColor::handle() const noexcept
 {
     return m_handle;
@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpDemosaic.h
+ *
+ * @brief Defines types and functions to handle the demosaic operation.
+ * @defgroup NVCV_C_ALGORITHM_DEMOSAIC Demosaic
+ * @{
+ */
+
+#ifndef CVCUDA_DEMOSAIC_H
+#define CVCUDA_DEMOSAIC_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ColorSpec.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the demosaic operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaDemosaicCreate(NVCVOperatorHandle *handle);
+
+/** Executes the demosaic operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  Converts the raw Bayer images of the input to RGB. Each output pixel gets the red, green and blue interpolated
+ *  from the input, which are then multiplied by the white balance gains, transformed by the color correction
+ *  matrix, clamped to [0,1] and raised to the power 1/gamma, all in the same pass.
+ *
+ *  With #NVCV_DEMOSAIC_BILINEAR, missing colors are the average of the nearest samples of that color. With
+ *  #NVCV_DEMOSAIC_EDGE_AWARE, green is interpolated along the direction with the smallest gradient, then red and
+ *  blue are interpolated from their differences to green, which avoids most of the zippering and false colors
+ *  along edges.
+ *
+ *  Input samples are normalized by the maximum of their type, so 10 or 12-bit samples stored in the low bits of
+ *  16-bit values need their gains scaled by 64 or 16. Borders are mirrored.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [3, 4], RGB or RGBA with an opaque alpha
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes, in [0,1]
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | Yes
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | No
+ *       Width         | Yes
+ *       Height        | Yes
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor, images of at least 3x3 pixels.
+ *
+ * @param [out] out output tensor.
+ *
+ * @param [in] pattern colors of the top-left 2x2 pixels of the images.
+ *                     + Must be #NVCV_RAW_BAYER_RGGB, #NVCV_RAW_BAYER_BGGR, #NVCV_RAW_BAYER_GRBG or
+ *                       #NVCV_RAW_BAYER_GBRG.
+ *
+ * @param [in] type interpolation of the missing colors, \ref NVCVDemosaicType.
+ *
+ * @param [in] params color processing of all images, or NULL for unit gains, identity matrix and linear output.
+ *                    + Its gamma must be positive.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaDemosaicSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                              NVCVTensorHandle out, NVCVRawPattern pattern, NVCVDemosaicType type,
+                                              const NVCVDemosaicParams *params);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_DEMOSAIC_H */
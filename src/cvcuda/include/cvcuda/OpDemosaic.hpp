@@ -0,0 +1,80 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpDemosaic.hpp
+ *
+ * @brief Defines the public C++ Class for the demosaic operation.
+ * @defgroup NVCV_CPP_ALGORITHM_DEMOSAIC Demosaic
+ * @{
+ */
+
+#ifndef CVCUDA_DEMOSAIC_HPP
+#define CVCUDA_DEMOSAIC_HPP
+
+#include "IOperator.hpp"
+#include "OpDemosaic.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class Demosaic final : public IOperator
+{
+public:
+    explicit Demosaic();
+
+    ~Demosaic();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, NVCVRawPattern pattern,
+                    NVCVDemosaicType type = NVCV_DEMOSAIC_BILINEAR, const NVCVDemosaicParams *params = nullptr);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline Demosaic::Demosaic()
+{
+    nvcv::detail::CheckThrow(cvcudaDemosaicCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline Demosaic::~Demosaic()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void Demosaic::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, NVCVRawPattern pattern,
+                                 NVCVDemosaicType type, const NVCVDemosaicParams *params)
+{
+    nvcv::detail::CheckThrow(cvcudaDemosaicSubmit(m_handle, stream, in.handle(), out.handle(), pattern, type, params));
+}
+
+inline NVCVOperatorHandle Demosaic::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_DEMOSAIC_HPP
@@ -57,6 +57,9 @@ CVCUDA_PUBLIC NVCVStatus cvcudaEraseCreate(NVCVOperatorHandle *handle, int32_t m
 /* Executes the erase operation on the given cuda stream. This operation does not
  *  wait for completion.
  *
+ *  The output may be the input itself, areas are then erased in place without copying the input.  Other overlaps
+ *  between them are rejected with #NVCV_ERROR_INVALID_ARGUMENT.
+ *
  *  Limitations:
  *
  *  Input:
@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpFAST.h
+ *
+ * @brief Defines types and functions to handle the FAST corner detection operation.
+ * @defgroup NVCV_C_ALGORITHM_FAST FAST
+ * @{
+ */
+
+#ifndef CVCUDA_FAST_H
+#define CVCUDA_FAST_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the FAST corner detector.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaFASTCreate(NVCVOperatorHandle *handle);
+
+/** Executes the FAST corner detection operation on the given cuda stream. This operation does not wait for
+ *  completion.
+ *
+ *  Detects the FAST-9 corners of each sample, as OpenCV's FAST with TYPE_9_16: pixels with 9 contiguous pixels of
+ *  the circle of radius 3 around them all brighter, or all darker, than the pixel by more than the threshold.  The
+ *  score of a corner is the largest threshold it's detected with.  Pixels closer than 3 to the image border are
+ *  never corners.
+ *
+ *  The corners of each sample are compacted on the device in the rows of the outputs, in no particular order.  The
+ *  counts are the number of corners written, at most the capacity of the outputs, and the entries past them are
+ *  padded with keypoints (-1, -1) of score 0.  Corners found beyond the capacity are dropped, which ones depends on
+ *  the scheduling of the detection.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Outputs:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Keypoints:      32bit Signed, N x 1 x capacity x 2, the (x, y) of the corners
+ *       Scores:         32bit Float, N x 1 x capacity x 1, the scores of the corners
+ *       Count:          32bit Signed, N x 1 x 1 x 1
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [out] outKeypoints Keypoints of the corners of each sample, in its single row.
+ *
+ * @param [out] outScores Scores of the keypoints.
+ *
+ * @param [out] outCount Number of keypoints written for each sample.
+ *
+ * @param [in] threshold Difference of intensity to the center of the pixels of the arcs.
+ *                       + Must be in [0, 255].
+ *
+ * @param [in] nonmaxSuppression Keep only the corners with a score larger than their 8 neighbours.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaFASTSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                          NVCVTensorHandle outKeypoints, NVCVTensorHandle outScores,
+                                          NVCVTensorHandle outCount, int32_t threshold, int8_t nonmaxSuppression);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_FAST_H */
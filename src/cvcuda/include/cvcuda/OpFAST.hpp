@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpFAST.hpp
+ *
+ * @brief Defines the public C++ Class for the FAST corner detection operation.
+ * @defgroup NVCV_CPP_ALGORITHM_FAST FAST
+ * @{
+ */
+
+#ifndef CVCUDA_FAST_HPP
+#define CVCUDA_FAST_HPP
+
+#include "IOperator.hpp"
+#include "OpFAST.h"
+#include "Types.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class FAST final : public IOperator
+{
+public:
+    explicit FAST();
+
+    ~FAST();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &outKeypoints, nvcv::ITensor &outScores,
+                    nvcv::ITensor &outCount, int32_t threshold, bool nonmaxSuppression);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline FAST::FAST()
+{
+    nvcv::detail::CheckThrow(cvcudaFASTCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline FAST::~FAST()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void FAST::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &outKeypoints,
+                             nvcv::ITensor &outScores, nvcv::ITensor &outCount, int32_t threshold,
+                             bool nonmaxSuppression)
+{
+    nvcv::detail::CheckThrow(cvcudaFASTSubmit(m_handle, stream, in.handle(), outKeypoints.handle(),
+                                              outScores.handle(), outCount.handle(), threshold, nonmaxSuppression));
+}
+
+inline NVCVOperatorHandle FAST::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_FAST_HPP
@@ -54,6 +54,12 @@ extern "C"
 CVCUDA_PUBLIC NVCVStatus cvcudaFlipCreate(NVCVOperatorHandle *handle, int32_t maxVarShapeBatchSize);
 
 /** Executes the Flip operation on the given cuda stream.
+ *
+ * The output may be the input itself, images are then flipped in place.  Other overlaps between them are rejected
+ * with #NVCV_ERROR_INVALID_ARGUMENT.
+ *
+ * When both tensors are in host memory, wrapped with #NVCV_TENSOR_BUFFER_STRIDED_HOST, the operation runs on the
+ * host instead, synchronously, and the stream isn't used.
  *
  * Limitations:
  *
@@ -67,6 +73,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaFlipCreate(NVCVOperatorHandle *handle, int32_t ma
  *      8bit  Signed   | No
  *      16bit Unsigned | Yes
  *      16bit Signed   | No
+ *      16bit Float    | Yes
  *      32bit Unsigned | No
  *      32bit Signed   | Yes
  *      32bit Float    | Yes
@@ -82,6 +89,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaFlipCreate(NVCVOperatorHandle *handle, int32_t ma
  *      8bit  Signed   | No
  *      16bit Unsigned | Yes
  *      16bit Signed   | No
+ *      16bit Float    | Yes
  *      32bit Unsigned | No
  *      32bit Signed   | Yes
  *      32bit Float    | Yes
@@ -116,6 +124,9 @@ CVCUDA_PUBLIC NVCVStatus cvcudaFlipSubmit(NVCVOperatorHandle handle, cudaStream_
                                           NVCVTensorHandle out, int32_t flipCode);
 
 /** Executes the Flip operation on the given cuda stream.
+ *
+ * The output may be the input itself, images are then flipped in place.  Other overlaps between them are rejected
+ * with #NVCV_ERROR_INVALID_ARGUMENT.
  *
  * Limitations:
  *
@@ -129,6 +140,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaFlipSubmit(NVCVOperatorHandle handle, cudaStream_
  *      8bit  Signed   | No
  *      16bit Unsigned | Yes
  *      16bit Signed   | Yes
+ *      16bit Float    | Yes
  *      32bit Unsigned | No
  *      32bit Signed   | Yes
  *      32bit Float    | Yes
@@ -144,6 +156,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaFlipSubmit(NVCVOperatorHandle handle, cudaStream_
  *      8bit  Signed   | No
  *      16bit Unsigned | Yes
  *      16bit Signed   | Yes
+ *      16bit Float    | Yes
  *      32bit Unsigned | No
  *      32bit Signed   | Yes
  *      32bit Float    | Yes
@@ -178,6 +191,29 @@ CVCUDA_PUBLIC NVCVStatus cvcudaFlipVarShapeSubmit(NVCVOperatorHandle handle, cud
                                                   NVCVImageBatchHandle in, NVCVImageBatchHandle out,
                                                   NVCVTensorHandle flipCode);
 
+/** Executes the Flip operation from a varshape batch into a tensor.
+ *
+ * Each image is flipped into its sample of the output tensor, e.g. to feed a network with a batch of images decoded
+ * separately, without a copy of the flipped batch. All images must have the size of the output samples.
+ *
+ * Limitations, data types and flip codes are the same as \ref cvcudaFlipVarShapeSubmit, the output must be kNHWC
+ * with one sample per image.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ * @param [in] in Input image batch.
+ * @param [out] out Output tensor.
+ * @param [in] flipCode a tensor flag to specify how to flip each image, as in \ref cvcudaFlipVarShapeSubmit.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaFlipVarShapeStackSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                       NVCVImageBatchHandle in, NVCVTensorHandle out,
+                                                       NVCVTensorHandle flipCode);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
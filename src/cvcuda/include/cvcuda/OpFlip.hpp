@@ -46,6 +46,7 @@ public:
 
     void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, int32_t flipCode);
     void operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::IImageBatch &out, nvcv::ITensor &flipCode);
+    void operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::ITensor &out, nvcv::ITensor &flipCode);
 
     virtual NVCVOperatorHandle handle() const noexcept override;
 
@@ -76,6 +77,12 @@ inline void Flip::operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::I
     nvcv::detail::CheckThrow(cvcudaFlipVarShapeSubmit(m_handle, stream, in.handle(), out.handle(), flipCode.handle()));
 }
 
+inline void Flip::operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::ITensor &out, nvcv::ITensor &flipCode)
+{
+    nvcv::detail::CheckThrow(
+        cvcudaFlipVarShapeStackSubmit(m_handle, stream, in.handle(), out.handle(), flipCode.handle()));
+}
+
 inline NVCVOperatorHandle Flip::handle() const noexcept
 {
     return m_handle;
@@ -56,6 +56,9 @@ CVCUDA_PUBLIC NVCVStatus cvcudaGammaContrastCreate(NVCVOperatorHandle *handle, c
                                                    const int32_t maxVarShapeChannelCount);
 
 /** Executes the GammaContrast operation on the given cuda stream.  This operation does not wait for completion.
+ *
+ * The output batch may be the input one, the operation then runs in place.  Other overlaps between their images are
+ * rejected with #NVCV_ERROR_INVALID_ARGUMENT.
  *
  * Limitations:
  *
@@ -64,7 +64,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaGaussianCreate(NVCVOperatorHandle *handle, int32_
  * Limitations:
  *
  * Input:
- *      Data Layout:    [kNHWC, kHWC]
+ *      Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *      Channels:       [1, 3, 4]
  *
  *      Data Type      | Allowed
@@ -79,7 +79,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaGaussianCreate(NVCVOperatorHandle *handle, int32_
  *      64bit Float    | No
  *
  * Output:
- *      Data Layout:    [kNHWC, kHWC]
+ *      Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *      Channels:       [1, 3, 4]
  *
  *      Data Type      | Allowed
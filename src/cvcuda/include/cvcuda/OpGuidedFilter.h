@@ -0,0 +1,202 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpGuidedFilter.h
+ *
+ * @brief Defines types and functions to handle the guided filter operation.
+ * @defgroup NVCV_C_ALGORITHM_GUIDED_FILTER Guided Filter
+ * @{
+ */
+
+#ifndef CVCUDA_GUIDED_FILTER_H
+#define CVCUDA_GUIDED_FILTER_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the guided filter operator.
+ *
+ * The operator reserves a workspace of 33 floats per pixel of maxBatchSize images of maxWidth x maxHeight, for the
+ * box sums and the coefficients of the filter.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @param [in] maxBatchSize maximum number of samples or images given to the operator.
+ *                          + Must not be negative.
+ *
+ * @param [in] maxWidth maximum width of the images given to the operator.
+ *                      + Must not be negative.
+ *
+ * @param [in] maxHeight maximum height of the images given to the operator.
+ *                       + Must not be negative.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaGuidedFilterCreate(NVCVOperatorHandle *handle, int32_t maxBatchSize, int32_t maxWidth,
+                                                  int32_t maxHeight);
+
+/** Executes the guided filter operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  Smooths the input while preserving the edges of the guide, as the guided filter of He et al.: each window of
+ *  (2 * radius + 1) x (2 * radius + 1) pixels fits the input as a linear function a * I + b of the guide I, a being
+ *  regularized by eps, and each output pixel applies the mean coefficients of the windows containing it to its
+ *  guide pixel. With a color guide, a is the solution of a 3x3 system per window and input channel.
+ *
+ *  The filter is built on box means over running sums, so that its cost doesn't depend on the radius, unlike
+ *  joint bilateral filtering. The windows are clipped to the image at its borders, the means being taken over the
+ *  pixels inside them.
+ *
+ *  Values of integer images are normalized to [0, 1], eps being in squared normalized units of the guide, e.g.
+ *  0.01 blurs guide variations smaller than 0.1.
+ *
+ *  With subsample greater than 1, the coefficients are computed on the guide and input averaged over subsample x
+ *  subsample blocks, with the radius divided by subsample, and upsampled bilinearly to the full resolution, which
+ *  is the fast guided filter. The cost of the box means then drops by the square of the factor.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Guide:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3]
+ *       Data Type:      same as allowed for the input, it may differ from the input one
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | Yes
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | Yes
+ *       Height        | Yes
+ *
+ *  The guide must have the same number of samples, width and height as the input.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor.
+ *                + Must not have more samples, columns or rows than given at creation.
+ *
+ * @param [in] guide guide tensor.
+ *
+ * @param [out] out output tensor.
+ *
+ * @param [in] radius radius of the windows.
+ *                    + Must be at least 1.
+ *
+ * @param [in] eps regularization of the coefficients a.
+ *                 + Must be positive.
+ *
+ * @param [in] subsample factor the coefficients are computed at a lower resolution by, 1 to compute them at full
+ *                       resolution.
+ *                       + Must be at least 1.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaGuidedFilterSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                                  NVCVTensorHandle guide, NVCVTensorHandle out, int32_t radius,
+                                                  float eps, int32_t subsample);
+
+/** Executes the guided filter operation on image batches, as \ref cvcudaGuidedFilterSubmit.
+ *
+ *  The images of each batch must have the same format, each guide and output image having the size of its input
+ *  image. The box means of all images are computed in the same launches.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input image batch.
+ *                + Must not have more images than given at creation, nor images larger than given at creation.
+ *
+ * @param [in] guide guide image batch.
+ *
+ * @param [out] out output image batch.
+ *
+ * @param [in] radius radius of the windows.
+ *                    + Must be at least 1.
+ *
+ * @param [in] eps regularization of the coefficients a.
+ *                 + Must be positive.
+ *
+ * @param [in] subsample factor the coefficients are computed at a lower resolution by.
+ *                       + Must be at least 1.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaGuidedFilterVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                          NVCVImageBatchHandle in, NVCVImageBatchHandle guide,
+                                                          NVCVImageBatchHandle out, int32_t radius, float eps,
+                                                          int32_t subsample);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_GUIDED_FILTER_H */
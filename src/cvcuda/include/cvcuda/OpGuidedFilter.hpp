@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpGuidedFilter.hpp
+ *
+ * @brief Defines the public C++ Class for the guided filter operation.
+ * @defgroup NVCV_CPP_ALGORITHM_GUIDED_FILTER Guided Filter
+ * @{
+ */
+
+#ifndef CVCUDA_GUIDED_FILTER_HPP
+#define CVCUDA_GUIDED_FILTER_HPP
+
+#include "IOperator.hpp"
+#include "OpGuidedFilter.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class GuidedFilter final : public IOperator
+{
+public:
+    explicit GuidedFilter(int32_t maxBatchSize, int32_t maxWidth, int32_t maxHeight);
+
+    ~GuidedFilter();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &guide, nvcv::ITensor &out, int32_t radius,
+                    float eps, int32_t subsample = 1);
+
+    void operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::IImageBatch &guide, nvcv::IImageBatch &out,
+                    int32_t radius, float eps, int32_t subsample = 1);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline GuidedFilter::GuidedFilter(int32_t maxBatchSize, int32_t maxWidth, int32_t maxHeight)
+{
+    nvcv::detail::CheckThrow(cvcudaGuidedFilterCreate(&m_handle, maxBatchSize, maxWidth, maxHeight));
+    assert(m_handle);
+}
+
+inline GuidedFilter::~GuidedFilter()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void GuidedFilter::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &guide, nvcv::ITensor &out,
+                                     int32_t radius, float eps, int32_t subsample)
+{
+    nvcv::detail::CheckThrow(cvcudaGuidedFilterSubmit(m_handle, stream, in.handle(), guide.handle(), out.handle(),
+                                                      radius, eps, subsample));
+}
+
+inline void GuidedFilter::operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::IImageBatch &guide,
+                                     nvcv::IImageBatch &out, int32_t radius, float eps, int32_t subsample)
+{
+    nvcv::detail::CheckThrow(cvcudaGuidedFilterVarShapeSubmit(m_handle, stream, in.handle(), guide.handle(),
+                                                              out.handle(), radius, eps, subsample));
+}
+
+inline NVCVOperatorHandle GuidedFilter::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_GUIDED_FILTER_HPP
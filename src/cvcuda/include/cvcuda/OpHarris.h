@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpHarris.h
+ *
+ * @brief Defines types and functions to handle the Harris corner detection operation.
+ * @defgroup NVCV_C_ALGORITHM_HARRIS Harris
+ * @{
+ */
+
+#ifndef CVCUDA_HARRIS_H
+#define CVCUDA_HARRIS_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the Harris corner detector.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaHarrisCreate(NVCVOperatorHandle *handle);
+
+/** Executes the Harris corner detection operation on the given cuda stream. This operation does not wait for
+ *  completion.
+ *
+ *  Computes the corner response of each pixel from the structure tensor of the 3x3 Sobel gradients summed over a
+ *  blockSize x blockSize window, as OpenCV's cornerHarris or cornerMinEigenVal depending on the response type, and
+ *  detects the pixels with a response above the threshold and no smaller than their 8 neighbours.  The gradients
+ *  of 8-bit images are those of the image scaled to [0, 1].
+ *
+ *  The corners of each sample are compacted on the device in the rows of the outputs, in no particular order.  The
+ *  counts are the number of corners written, at most the capacity of the outputs, and the entries past them are
+ *  padded with keypoints (-1, -1) of score 0.  Corners found beyond the capacity are dropped, which ones depends on
+ *  the scheduling of the detection.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Outputs:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Keypoints:      32bit Signed, N x 1 x capacity x 2, the (x, y) of the corners
+ *       Scores:         32bit Float, N x 1 x capacity x 1, the responses of the corners
+ *       Count:          32bit Signed, N x 1 x 1 x 1
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [out] outKeypoints Keypoints of the corners of each sample, in its single row.
+ *
+ * @param [out] outScores Responses of the keypoints.
+ *
+ * @param [out] outCount Number of keypoints written for each sample.
+ *
+ * @param [in] type Corner response, \ref NVCV_CORNER_HARRIS or \ref NVCV_CORNER_SHI_TOMASI.
+ *
+ * @param [in] blockSize Side of the window of the structure tensor.
+ *                       + Must be in [1, 7].
+ *
+ * @param [in] k Harris free parameter, unused by Shi-Tomasi.
+ *
+ * @param [in] threshold Response the corners must be above.
+ *
+ * @param [in] borderMode Border mode of the gradients, all but \ref NVCV_BORDER_CONSTANT extrapolate the gradient
+ *                        image as OpenCV does.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaHarrisSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                            NVCVTensorHandle outKeypoints, NVCVTensorHandle outScores,
+                                            NVCVTensorHandle outCount, NVCVCornerResponseType type,
+                                            int32_t blockSize, float k, float threshold,
+                                            NVCVBorderType borderMode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_HARRIS_H */
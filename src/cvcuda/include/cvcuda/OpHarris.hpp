@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpHarris.hpp
+ *
+ * @brief Defines the public C++ Class for the Harris corner detection operation.
+ * @defgroup NVCV_CPP_ALGORITHM_HARRIS Harris
+ * @{
+ */
+
+#ifndef CVCUDA_HARRIS_HPP
+#define CVCUDA_HARRIS_HPP
+
+#include "IOperator.hpp"
+#include "OpHarris.h"
+#include "Types.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class Harris final : public IOperator
+{
+public:
+    explicit Harris();
+
+    ~Harris();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &outKeypoints, nvcv::ITensor &outScores,
+                    nvcv::ITensor &outCount, NVCVCornerResponseType type, int32_t blockSize, float k, float threshold,
+                    NVCVBorderType borderMode);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline Harris::Harris()
+{
+    nvcv::detail::CheckThrow(cvcudaHarrisCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline Harris::~Harris()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void Harris::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &outKeypoints,
+                               nvcv::ITensor &outScores, nvcv::ITensor &outCount, NVCVCornerResponseType type,
+                               int32_t blockSize, float k, float threshold, NVCVBorderType borderMode)
+{
+    nvcv::detail::CheckThrow(cvcudaHarrisSubmit(m_handle, stream, in.handle(), outKeypoints.handle(),
+                                                outScores.handle(), outCount.handle(), type, blockSize, k, threshold,
+                                                borderMode));
+}
+
+inline NVCVOperatorHandle Harris::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_HARRIS_HPP
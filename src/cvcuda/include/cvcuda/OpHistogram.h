@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpHistogram.h
+ *
+ * @brief Defines types and functions to handle the histogram operation.
+ * @defgroup NVCV_C_ALGORITHM_HISTOGRAM Histogram
+ * @{
+ */
+
+#ifndef CVCUDA_HISTOGRAM_H
+#define CVCUDA_HISTOGRAM_H
+
+#include "Operator.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the histogram operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaHistogramCreate(NVCVOperatorHandle *handle);
+
+/** Executes the histogram operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  Counts the pixels of every sample with each of the 256 8-bit values, either per channel or over all
+ *  channels, depending on the number of channels of the output. Bin `i` of sample `n` and channel `c` is at
+ *  `out[n, 0, i, c]`. All samples are processed by a single launch.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
+ *       Channels:       [1, 3, 4] for interleaved layouts, any for planar layouts
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed | No
+ *       16bit Unsigned | No
+ *       16bit Signed | No
+ *       32bit Unsigned | No
+ *       32bit Signed | No
+ *       32bit Float | No
+ *       64bit Float | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, input channels]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed | No
+ *       16bit Unsigned | No
+ *       16bit Signed | No
+ *       32bit Unsigned | No
+ *       32bit Signed | Yes
+ *       32bit Float | No
+ *       64bit Float | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | Yes, or 1 to count all channels together
+ *       Width         | No, 256
+ *       Height        | No, 1
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [out] out Output tensor, with the histogram of each sample in its row.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaHistogramSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                               NVCVTensorHandle out);
+
+/** Executes the histogram operation on a varshape batch, see \ref cvcudaHistogramSubmit.
+ *
+ *  Images must all have the same format, with 1, 3 or 4 channels. The output has one sample per image.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaHistogramVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                       NVCVImageBatchHandle in, NVCVTensorHandle out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_HISTOGRAM_H */
@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpImageHash.h
+ *
+ * @brief Defines types and functions to handle the image hash operation.
+ * @defgroup NVCV_C_ALGORITHM_IMAGE_HASH Image Hash
+ * @{
+ */
+
+#ifndef CVCUDA_IMAGE_HASH_H
+#define CVCUDA_IMAGE_HASH_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the image hash operator.
+ *
+ * @param [out] handle Where the operator instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaImageHashCreate(NVCVOperatorHandle *handle);
+
+/** Executes the image hash operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  Computes a 64-bit hash of every sample, so that images can be compared or deduplicated by copying only their
+ *  hashes to the host.  All samples are processed by a single launch.
+ *
+ *  - #NVCV_IMAGE_HASH_EXACT hashes every row with XXH64, seeded with the row index, and the sum of the row hashes
+ *    with the image size.  Equal images give the same hash whatever their row strides, any other image gives
+ *    another hash, but for collisions.
+ *  - #NVCV_IMAGE_HASH_DHASH averages the image into a 9x8 grayscale thumbnail, bit `8*y + x` is set when the
+ *    thumbnail pixel at `(x+1, y)` is brighter than the one at `(x, y)`.
+ *  - #NVCV_IMAGE_HASH_PHASH averages the image into a 32x32 grayscale thumbnail, bit `8*v + u` is set when the
+ *    DCT coefficient `(u, v)` of the thumbnail is above the median of the 8x8 lowest frequency ones.
+ *
+ *  Perceptual hashes of similar images, e.g. re-encoded or slightly rescaled, differ by a few bits, their hamming
+ *  distance measures how much the images differ.  Three and four channel images are taken as RGB and RGBA for the
+ *  grayscale conversion.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | Exact hash only
+ *       16bit Unsigned | Exact hash only
+ *       16bit Signed   | Exact hash only
+ *       32bit Unsigned | Exact hash only
+ *       32bit Signed   | Exact hash only
+ *       32bit Float    | Exact hash only
+ *       64bit Float    | Exact hash only
+ *
+ *       Perceptual hashes need images at least as large as their thumbnail.
+ *
+ *  Output:
+ *       Values are uint64 with one element per sample, e.g. NHWC with width, height and channels 1.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [out] out Hash of each sample.
+ *
+ * @param [in] type Hash to compute, see \ref NVCVImageHashType.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaImageHashSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                               NVCVTensorHandle out, NVCVImageHashType type);
+
+/** Executes the image hash operation on the images of a varshape batch, see @ref cvcudaImageHashSubmit.
+ *
+ *  Images must all have the same format.  Equal images of different batches, or of a batch and a tensor, give the
+ *  same hash.  Image sizes aren't checked, perceptual hashes of images smaller than the thumbnail treat its empty
+ *  cells as black.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input image batch.
+ *
+ * @param [out] out Hash of each image, uint64 with one element per image.
+ *
+ * @param [in] type Hash to compute, see \ref NVCVImageHashType.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaImageHashVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                       NVCVImageBatchHandle in, NVCVTensorHandle out,
+                                                       NVCVImageHashType type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_IMAGE_HASH_H */
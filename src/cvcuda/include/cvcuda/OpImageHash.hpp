@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpImageHash.hpp
+ *
+ * @brief Defines the public C++ Class for the image hash operation.
+ * @defgroup NVCV_CPP_ALGORITHM_IMAGE_HASH Image Hash
+ * @{
+ */
+
+#ifndef CVCUDA_IMAGE_HASH_HPP
+#define CVCUDA_IMAGE_HASH_HPP
+
+#include "IOperator.hpp"
+#include "OpImageHash.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class ImageHash final : public IOperator
+{
+public:
+    explicit ImageHash();
+
+    ~ImageHash();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, NVCVImageHashType type);
+
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out, NVCVImageHashType type);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline ImageHash::ImageHash()
+{
+    nvcv::detail::CheckThrow(cvcudaImageHashCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline ImageHash::~ImageHash()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void ImageHash::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, NVCVImageHashType type)
+{
+    nvcv::detail::CheckThrow(cvcudaImageHashSubmit(m_handle, stream, in.handle(), out.handle(), type));
+}
+
+inline void ImageHash::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out,
+                                  NVCVImageHashType type)
+{
+    nvcv::detail::CheckThrow(cvcudaImageHashVarShapeSubmit(m_handle, stream, in.handle(), out.handle(), type));
+}
+
+inline NVCVOperatorHandle ImageHash::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_IMAGE_HASH_HPP
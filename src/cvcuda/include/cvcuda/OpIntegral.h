@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpIntegral.h
+ *
+ * @brief Defines types and functions to handle the integral image operation.
+ * @defgroup NVCV_C_ALGORITHM_INTEGRAL Integral
+ * @{
+ */
+
+#ifndef CVCUDA_INTEGRAL_H
+#define CVCUDA_INTEGRAL_H
+
+#include "Operator.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the integral image operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @param [in] maxBatchSize maximum number of samples of the tensors given to the operator.
+ *                          + Must not be negative.
+ *
+ * @param [in] maxWidth maximum width of the input images given to the operator.
+ *                      + Must not be negative.
+ *
+ * @param [in] maxHeight maximum height of the input images given to the operator.
+ *                       + Must not be negative.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaIntegralCreate(NVCVOperatorHandle *handle, int32_t maxBatchSize, int32_t maxWidth,
+                                              int32_t maxHeight);
+
+/** Executes the integral image operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  Computes the integral image of each image of the input as OpenCV's integral: the output is one row and one
+ *  column larger than the input, with sum(x, y) the sum of the input pixels above and to the left of (x, y), so
+ *  that the first row and column are 0. The integral of the squared pixels is computed as well when a squared sum
+ *  tensor is given.
+ *
+ *  The rows and then the columns are summed by single-pass scans, so float sums may differ in their last bits
+ *  from a sequential summation. int32 sums wrap around on overflow, but the sums of boxes computed from them are
+ *  exact as long as those fit in 32 bits.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | Yes, for the sum of integer inputs
+ *       32bit Float    | Yes
+ *       64bit Float    | Yes
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | No, input width + 1
+ *       Height        | No, input height + 1
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor.
+ *                + Must not have more samples, columns or rows than given at creation.
+ *
+ * @param [out] sum output tensor with the integral images.
+ *
+ * @param [out] sqsum output tensor with the integral images of the squared pixels, or NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaIntegralSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                              NVCVTensorHandle sum, NVCVTensorHandle sqsum);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_INTEGRAL_H */
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpIntegral.hpp
+ *
+ * @brief Defines the public C++ Class for the integral image operation.
+ * @defgroup NVCV_CPP_ALGORITHM_INTEGRAL Integral
+ * @{
+ */
+
+#ifndef CVCUDA_INTEGRAL_HPP
+#define CVCUDA_INTEGRAL_HPP
+
+#include "IOperator.hpp"
+#include "OpIntegral.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class Integral final : public IOperator
+{
+public:
+    explicit Integral(int32_t maxBatchSize, int32_t maxWidth, int32_t maxHeight);
+
+    ~Integral();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &sum);
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &sum, nvcv::ITensor &sqsum);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline Integral::Integral(int32_t maxBatchSize, int32_t maxWidth, int32_t maxHeight)
+{
+    nvcv::detail::CheckThrow(cvcudaIntegralCreate(&m_handle, maxBatchSize, maxWidth, maxHeight));
+    assert(m_handle);
+}
+
+inline Integral::~Integral()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void Integral::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &sum)
+{
+    nvcv::detail::CheckThrow(cvcudaIntegralSubmit(m_handle, stream, in.handle(), sum.handle(), nullptr));
+}
+
+inline void Integral::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &sum, nvcv::ITensor &sqsum)
+{
+    nvcv::detail::CheckThrow(cvcudaIntegralSubmit(m_handle, stream, in.handle(), sum.handle(), sqsum.handle()));
+}
+
+inline NVCVOperatorHandle Integral::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_INTEGRAL_HPP
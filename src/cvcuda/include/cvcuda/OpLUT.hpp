@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpLUT.hpp
+ *
+ * @brief Defines the public C++ Class for the lookup table operation.
+ * @defgroup NVCV_CPP_ALGORITHM_LUT LUT
+ * @{
+ */
+
+#ifndef CVCUDA_LUT_HPP
+#define CVCUDA_LUT_HPP
+
+#include "IOperator.hpp"
+#include "OpLUT.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class LUT final : public IOperator
+{
+public:
+    explicit LUT();
+
+    ~LUT();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, nvcv::ITensor &lut);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline LUT::LUT()
+{
+    nvcv::detail::CheckThrow(cvcudaLUTCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline LUT::~LUT()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void LUT::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, nvcv::ITensor &lut)
+{
+    nvcv::detail::CheckThrow(cvcudaLUTSubmit(m_handle, stream, in.handle(), out.handle(), lut.handle()));
+}
+
+inline NVCVOperatorHandle LUT::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_LUT_HPP
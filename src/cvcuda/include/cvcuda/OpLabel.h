@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpLabel.h
+ *
+ * @brief Defines types and functions to handle the connected components labeling operation.
+ * @defgroup NVCV_C_ALGORITHM_LABEL Label
+ * @{
+ */
+
+#ifndef CVCUDA_LABEL_H
+#define CVCUDA_LABEL_H
+
+#include "Operator.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the connected components labeling operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaLabelCreate(NVCVOperatorHandle *handle);
+
+/** Executes the connected components labeling operation on the given cuda stream. This operation does not wait
+ *  for completion.
+ *
+ *  Labels the connected components of the non-zero pixels of each image of the input, with 4 or 8-connectivity.
+ *  The label of a component is 1 plus the smallest linear index y * width + x of its pixels, so that labels are
+ *  deterministic but not consecutive, and background pixels are labeled 0.
+ *
+ *  The number of components of each sample is written to the count tensor when given. The statistics of the
+ *  components are written to the statistics tensor when given, one column per component in no particular order,
+ *  with its label, the left, top, width and height of its bounding box and its area in the 6 channels. Components
+ *  beyond the number of columns of the statistics tensor have no statistics, but are still counted.
+ *
+ *  Images are processed in parallel, with union-find merging of the pixels in tiles of shared memory and then
+ *  across the tile borders.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | Yes
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC], with one row and column per sample for the count and one row per sample
+ *                       for the statistics
+ *       Channels:       [1], 6 for the statistics
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | Yes
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | Yes, for the labels
+ *       Width         | Yes, for the labels
+ *       Height        | Yes, for the labels
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor.
+ *
+ * @param [out] out output tensor with the labels.
+ *
+ * @param [out] count output tensor with the number of components of each sample, or NULL.
+ *
+ * @param [out] stats output tensor with the statistics of the components, or NULL.
+ *                    + Must be NULL when count is NULL.
+ *
+ * @param [in] connectivity 4 or 8, whether diagonal neighbors are connected.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaLabelSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                           NVCVTensorHandle out, NVCVTensorHandle count, NVCVTensorHandle stats,
+                                           int32_t connectivity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_LABEL_H */
@@ -57,7 +57,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaLaplacianCreate(NVCVOperatorHandle *handle);
  * Limitations:
  *
  * Input:
- *      Data Layout:    [kNHWC, kHWC]
+ *      Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *      Channels:       [1, 3, 4]
  *
  *      Data Type      | Allowed
@@ -72,7 +72,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaLaplacianCreate(NVCVOperatorHandle *handle);
  *      64bit Float    | No
  *
  * Output:
- *      Data Layout:    [kNHWC, kHWC]
+ *      Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *      Channels:       [1, 3, 4]
  *
  *      Data Type      | Allowed
@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpLetterbox.h
+ *
+ * @brief Defines types and functions to handle the letterbox operation.
+ * @defgroup NVCV_C_ALGORITHM_LETTERBOX Letterbox
+ * @{
+ */
+
+#ifndef CVCUDA_LETTERBOX_H
+#define CVCUDA_LETTERBOX_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the letterbox operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaLetterboxCreate(NVCVOperatorHandle *handle);
+
+/** Executes the letterbox operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  Resizes every sample with the largest scale that fits the output while keeping its aspect ratio, centers it in
+ *  the output and fills the rest of the output with \p fillValue. Scale and offsets are computed on the device for
+ *  each sample, and all samples are processed by a single launch. This is the usual preprocessing of detection
+ *  networks, done with no host computation.
+ *
+ *  The resized image is `round(width * s) x round(height * s)` with `s = min(outWidth / width, outHeight / height)`,
+ *  at offset `((outWidth - resizedWidth) / 2, (outHeight - resizedHeight) / 2)`, rounded down.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | Yes
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | No
+ *       Height        | No
+ *
+ *  Transform Tensor:
+ *
+ *      32-bit float tensor with shape [N,1,1,4], e.g. NHWC with format RGBAf32. The channels of sample n receive
+ *      `scale_x, scale_y, offset_x, offset_y`, so that a point of the output maps back to the source with
+ *      `x = (x_out - offset_x) / scale_x` and `y = (y_out - offset_y) / scale_y`, e.g. to unmap detected boxes.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [out] out Output tensor, all samples are letterboxed to its width and height.
+ *
+ * @param [out] transform Transform tensor, receiving the scale and offsets of each sample.
+ *                        + If NULL, they are not written.
+ *
+ * @param [in] interpolation Interpolation method to be used, either \ref NVCV_INTERP_NEAREST or
+ *                           \ref NVCV_INTERP_LINEAR.
+ *
+ * @param [in] fillValue Value of the output pixels outside the resized image, one value per channel.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaLetterboxSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                               NVCVTensorHandle out, NVCVTensorHandle transform,
+                                               NVCVInterpolationType interpolation, const float4 fillValue);
+
+/** Executes the letterbox operation on a varshape batch, see \ref cvcudaLetterboxSubmit.
+ *
+ *  Images must all have the same format. Each image gets its own scale and offsets, and is letterboxed into its
+ *  sample of the output tensor.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaLetterboxVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                       NVCVImageBatchHandle in, NVCVTensorHandle out,
+                                                       NVCVTensorHandle transform,
+                                                       NVCVInterpolationType interpolation, const float4 fillValue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_LETTERBOX_H */
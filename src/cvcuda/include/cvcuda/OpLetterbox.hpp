@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpLetterbox.hpp
+ *
+ * @brief Defines the public C++ Class for the letterbox operation.
+ * @defgroup NVCV_CPP_ALGORITHM_LETTERBOX Letterbox
+ * @{
+ */
+
+#ifndef CVCUDA_LETTERBOX_HPP
+#define CVCUDA_LETTERBOX_HPP
+
+#include "IOperator.hpp"
+#include "OpLetterbox.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class Letterbox final : public IOperator
+{
+public:
+    explicit Letterbox();
+
+    ~Letterbox();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, nvcv::ITensor *transform,
+                    NVCVInterpolationType interpolation, const float4 fillValue);
+
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out, nvcv::ITensor *transform,
+                    NVCVInterpolationType interpolation, const float4 fillValue);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline Letterbox::Letterbox()
+{
+    nvcv::detail::CheckThrow(cvcudaLetterboxCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline Letterbox::~Letterbox()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void Letterbox::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out,
+                                  nvcv::ITensor *transform, NVCVInterpolationType interpolation,
+                                  const float4 fillValue)
+{
+    nvcv::detail::CheckThrow(cvcudaLetterboxSubmit(m_handle, stream, in.handle(), out.handle(),
+                                                   transform ? transform->handle() : nullptr, interpolation,
+                                                   fillValue));
+}
+
+inline void Letterbox::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out,
+                                  nvcv::ITensor *transform, NVCVInterpolationType interpolation,
+                                  const float4 fillValue)
+{
+    nvcv::detail::CheckThrow(cvcudaLetterboxVarShapeSubmit(m_handle, stream, in.handle(), out.handle(),
+                                                           transform ? transform->handle() : nullptr, interpolation,
+                                                           fillValue));
+}
+
+inline NVCVOperatorHandle Letterbox::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_LETTERBOX_HPP
@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpMaskOverlay.h
+ *
+ * @brief Defines types and functions to handle the mask overlay operation.
+ * @defgroup NVCV_C_ALGORITHM_MASK_OVERLAY Mask Overlay
+ * @{
+ */
+
+#ifndef CVCUDA_MASK_OVERLAY_H
+#define CVCUDA_MASK_OVERLAY_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the mask overlay operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaMaskOverlayCreate(NVCVOperatorHandle *handle);
+
+/** Executes the mask overlay operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  Colorizes a label mask, such as the output of @ref cvcudaArgMaxSubmit, with a palette and blends it over the
+ *  frames, as @ref cvcudaCompositeSubmit would with the colorized mask as foreground and the palette alpha as mask:
+ *  output = frame + (color - frame) * alpha / 255, rounded. The colorized mask isn't written to memory.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [3, 4], the 4th channel is copied unchanged.
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | Yes
+ *       Data Type     | Yes
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | Yes
+ *       Height        | Yes
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input frames tensor.
+ *
+ * @param [in] labels label of each pixel, with the frame size and one channel of uint8 or int32.
+ *
+ * @param [in] palette color of each label, HWC or NHWC tensor with 1 row and 4 channels of uint8: the color in the
+ *                     frame channel order, and its alpha. Labels past the palette, or with alpha 0, are left
+ *                     unchanged.
+ *
+ * @param [out] out output frames tensor, it may be the input tensor.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaMaskOverlaySubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                                 NVCVTensorHandle labels, NVCVTensorHandle palette,
+                                                 NVCVTensorHandle out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_MASK_OVERLAY_H */
@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpMaskOverlay.hpp
+ *
+ * @brief Defines the public C++ Class for the mask overlay operation.
+ * @defgroup NVCV_CPP_ALGORITHM_MASK_OVERLAY Mask Overlay
+ * @{
+ */
+
+#ifndef CVCUDA_MASK_OVERLAY_HPP
+#define CVCUDA_MASK_OVERLAY_HPP
+
+#include "IOperator.hpp"
+#include "OpMaskOverlay.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class MaskOverlay final : public IOperator
+{
+public:
+    explicit MaskOverlay();
+
+    ~MaskOverlay();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &labels, nvcv::ITensor &palette,
+                    nvcv::ITensor &out);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline MaskOverlay::MaskOverlay()
+{
+    nvcv::detail::CheckThrow(cvcudaMaskOverlayCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline MaskOverlay::~MaskOverlay()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void MaskOverlay::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &labels,
+                                    nvcv::ITensor &palette, nvcv::ITensor &out)
+{
+    nvcv::detail::CheckThrow(
+        cvcudaMaskOverlaySubmit(m_handle, stream, in.handle(), labels.handle(), palette.handle(), out.handle()));
+}
+
+inline NVCVOperatorHandle MaskOverlay::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_MASK_OVERLAY_HPP
@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpMatchTemplate.h
+ *
+ * @brief Defines types and functions to handle the template matching operation.
+ * @defgroup NVCV_C_ALGORITHM_MATCH_TEMPLATE Match Template
+ * @{
+ */
+
+#ifndef CVCUDA_MATCH_TEMPLATE_H
+#define CVCUDA_MATCH_TEMPLATE_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the template matching operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaMatchTemplateCreate(NVCVOperatorHandle *handle);
+
+/** Executes the template matching operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  Scores every position of the template in each sample of the input by their normalized cross-correlation, as
+ *  OpenCV's matchTemplate with TM_CCOEFF_NORMED: the correlation of the image window and the template, both minus
+ *  their mean, divided by the product of their deviations.  Scores are in [-1, 1], and 0 where the window or the
+ *  template is flat.  The correlations are computed by overlap-save FFTs with cuFFT, so their cost doesn't depend
+ *  on the template size, and the operator uses a workspace of fixed size.
+ *
+ *  Limitations:
+ *
+ *  Input and template:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | No, W - templW + 1
+ *       Height        | No, H - templH + 1
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor, with at most 65536 samples.
+ *
+ * @param [in] templ Template tensor, with the data type of the input and either one sample per input sample or a
+ *                   single one matched against all of them.
+ *                   + Must be at most 512x512 pixels, and no larger than the input images.
+ *
+ * @param [out] out Output tensor, with the score of the template placed with its top-left corner at each pixel.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaMatchTemplateSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                   NVCVTensorHandle in, NVCVTensorHandle templ,
+                                                   NVCVTensorHandle out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_MATCH_TEMPLATE_H */
@@ -0,0 +1,80 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpMatchTemplate.hpp
+ *
+ * @brief Defines the public C++ Class for the template matching operation.
+ * @defgroup NVCV_CPP_ALGORITHM_MATCH_TEMPLATE Match Template
+ * @{
+ */
+
+#ifndef CVCUDA_MATCH_TEMPLATE_HPP
+#define CVCUDA_MATCH_TEMPLATE_HPP
+
+#include "IOperator.hpp"
+#include "OpMatchTemplate.h"
+#include "Types.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class MatchTemplate final : public IOperator
+{
+public:
+    explicit MatchTemplate();
+
+    ~MatchTemplate();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &templ, nvcv::ITensor &out);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline MatchTemplate::MatchTemplate()
+{
+    nvcv::detail::CheckThrow(cvcudaMatchTemplateCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline MatchTemplate::~MatchTemplate()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void MatchTemplate::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &templ,
+                                      nvcv::ITensor &out)
+{
+    nvcv::detail::CheckThrow(cvcudaMatchTemplateSubmit(m_handle, stream, in.handle(), templ.handle(), out.handle()));
+}
+
+inline NVCVOperatorHandle MatchTemplate::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_MATCH_TEMPLATE_HPP
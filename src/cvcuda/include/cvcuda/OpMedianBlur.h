@@ -59,7 +59,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaMedianBlurCreate(NVCVOperatorHandle *handle, cons
  *  Limitations:
  *
  *  Input:
- *       Data Layout:    [kNHWC, kHWC]
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *       Channels:       [1, 3, 4]
  *
  *       Data Type      | Allowed
@@ -74,7 +74,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaMedianBlurCreate(NVCVOperatorHandle *handle, cons
  *       64bit Float    | No
  *
  *  Output:
- *       Data Layout:    [kNHWC, kHWC]
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *       Channels:       [1, 3, 4]
  *
  *       Data Type      | Allowed
@@ -111,6 +111,10 @@ CVCUDA_PUBLIC NVCVStatus cvcudaMedianBlurCreate(NVCVOperatorHandle *handle, cons
  *
  * @param [in] kernelHeight height of the kernel.
  *
+ * @param [in] ksize width and height of the kernel of each image in the batch, with NW layout and int32 data type.
+ *                   Kernel sizes are only read on device, images whose kernel size isn't positive and odd
+ *                   are copied to the output unchanged.
+ *
  * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
  * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
  * @retval #NVCV_SUCCESS                Operation executed successfully.
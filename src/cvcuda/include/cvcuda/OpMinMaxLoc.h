@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpMinMaxLoc.h
+ *
+ * @brief Defines types and functions to handle the min/max location operation.
+ * @defgroup NVCV_C_ALGORITHM_MIN_MAX_LOC MinMaxLoc
+ * @{
+ */
+
+#ifndef CVCUDA_MIN_MAX_LOC_H
+#define CVCUDA_MIN_MAX_LOC_H
+
+#include "Operator.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the min/max location operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaMinMaxLocCreate(NVCVOperatorHandle *handle);
+
+/** Executes the min/max location operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  Finds the minimum and maximum values of every sample of the batch, and their locations. When a value occurs
+ *  several times, the first location in row-major order is returned, as OpenCV's minMaxLoc. All samples are
+ *  processed by a single launch.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, kCHW, kNHW, kHW]
+ *       Channels:       [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed | Yes
+ *       16bit Unsigned | Yes
+ *       16bit Signed | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed | Yes
+ *       32bit Float | Yes
+ *       64bit Float | No
+ *
+ *  Output:
+ *       Values are float32 with one element per sample, e.g. NHWC with width, height and channels 1.
+ *       Locations are int32 with two elements `[x, y]` per sample, e.g. NHWC with width and height 1 and
+ *       2 channels.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [out] minVal Minimum value of each sample.
+ *
+ * @param [out] minLoc Location of the minimum value of each sample.
+ *
+ * @param [out] maxVal Maximum value of each sample.
+ *
+ * @param [out] maxLoc Location of the maximum value of each sample.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaMinMaxLocSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                               NVCVTensorHandle minVal, NVCVTensorHandle minLoc,
+                                               NVCVTensorHandle maxVal, NVCVTensorHandle maxLoc);
+
+/** Executes the min/max location operation on a varshape batch, see \ref cvcudaMinMaxLocSubmit.
+ *
+ *  Images must all have the same single channel format. Outputs have one sample per image, and locations are
+ *  relative to each image.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaMinMaxLocVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                       NVCVImageBatchHandle in, NVCVTensorHandle minVal,
+                                                       NVCVTensorHandle minLoc, NVCVTensorHandle maxVal,
+                                                       NVCVTensorHandle maxLoc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_MIN_MAX_LOC_H */
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpMinMaxLoc.hpp
+ *
+ * @brief Defines the public C++ Class for the min/max location operation.
+ * @defgroup NVCV_CPP_ALGORITHM_MIN_MAX_LOC MinMaxLoc
+ * @{
+ */
+
+#ifndef CVCUDA_MIN_MAX_LOC_HPP
+#define CVCUDA_MIN_MAX_LOC_HPP
+
+#include "IOperator.hpp"
+#include "OpMinMaxLoc.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class MinMaxLoc final : public IOperator
+{
+public:
+    explicit MinMaxLoc();
+
+    ~MinMaxLoc();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &minVal, nvcv::ITensor &minLoc,
+                    nvcv::ITensor &maxVal, nvcv::ITensor &maxLoc);
+
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &minVal, nvcv::ITensor &minLoc,
+                    nvcv::ITensor &maxVal, nvcv::ITensor &maxLoc);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline MinMaxLoc::MinMaxLoc()
+{
+    nvcv::detail::CheckThrow(cvcudaMinMaxLocCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline MinMaxLoc::~MinMaxLoc()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void MinMaxLoc::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &minVal, nvcv::ITensor &minLoc,
+                                  nvcv::ITensor &maxVal, nvcv::ITensor &maxLoc)
+{
+    nvcv::detail::CheckThrow(cvcudaMinMaxLocSubmit(m_handle, stream, in.handle(), minVal.handle(), minLoc.handle(),
+                                                   maxVal.handle(), maxLoc.handle()));
+}
+
+inline void MinMaxLoc::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &minVal,
+                                  nvcv::ITensor &minLoc, nvcv::ITensor &maxVal, nvcv::ITensor &maxLoc)
+{
+    nvcv::detail::CheckThrow(cvcudaMinMaxLocVarShapeSubmit(m_handle, stream, in.handle(), minVal.handle(),
+                                                           minLoc.handle(), maxVal.handle(), maxLoc.handle()));
+}
+
+inline NVCVOperatorHandle MinMaxLoc::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_MIN_MAX_LOC_HPP
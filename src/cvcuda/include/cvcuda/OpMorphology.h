@@ -56,10 +56,16 @@ CVCUDA_PUBLIC NVCVStatus cvcudaMorphologyCreate(NVCVOperatorHandle *handle, cons
 /**
  * Executes the morphology operation of Dilates/Erodes on images
  *
+ * The compound operations Open, Close, Gradient, TopHat and BlackHat are computed in a single pass, keeping the
+ * intermediate erosion or dilation of each 32x8 tile in shared memory. With iterations the mask grows to
+ * (w - 1) * iterations + 1 by (h - 1) * iterations + 1, and the tile plus its halo of that mask must fit in 48 KB.
+ * As in OpenCV, with iterations all erosions are done before the dilations, and with NVCV_BORDER_CONSTANT the
+ * pixels outside of the image are ignored.
+ *
  * Limitations:
  *
  * Input:
- *      Data Layout:    [kNHWC, kHWC]
+ *      Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *      Channels:       [1, 3, 4]
  *
  *      Data Type      | Allowed
@@ -74,7 +80,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaMorphologyCreate(NVCVOperatorHandle *handle, cons
  *      64bit Float    | No
  *
  * Output:
- *      Data Layout:    [kNHWC, kHWC]
+ *      Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *      Channels:       [1, 3, 4]
  *
  *      Data Type      | Allowed
@@ -107,7 +113,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaMorphologyCreate(NVCVOperatorHandle *handle, cons
  *
  * @param [out] out Output tensor.
  *
- * @param [in] morphType Type of operation to performs Erode/Dilate. \ref NVCVMorphologyType.
+ * @param [in] morphType Type of operation to perform, Erode/Dilate or a compound one. \ref NVCVMorphologyType.
  *
  * @param [in] maskWidth Width of the mask to use (set heigh/width to -1 for default of 3,3).
  *
@@ -185,7 +191,8 @@ CVCUDA_PUBLIC NVCVStatus cvcudaMorphologySubmit(NVCVOperatorHandle handle, cudaS
  *
  * @param [out] out Output variable shape tensor.
  *
- * @param [in] morphType Type of operation to perform (Erode/Dilate). \ref NVCVMorphologyType.
+ * @param [in] morphType Type of operation to perform (Erode/Dilate), compound ones are not supported.
+ *                       \ref NVCVMorphologyType.
  *
  * @param [in] masks  1D Tensor of NVCV_DATA_TYPE_2S32 mask W/H pairs, where the 1st pair is for image 0, second for image 1, etc.
  *                    Setting values to -1,-1 will create a default 3,3 mask.
@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpMosaic.h
+ *
+ * @brief Defines types and functions to handle the mosaic operation.
+ * @defgroup NVCV_C_ALGORITHM_MOSAIC Mosaic
+ * @{
+ */
+
+#ifndef CVCUDA_MOSAIC_H
+#define CVCUDA_MOSAIC_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the mosaic operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaMosaicCreate(NVCVOperatorHandle *handle);
+
+/** Executes the mosaic operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  Resizes each image of the batch into its destination rectangle of one of the output canvases, e.g. the cells
+ *  of a video wall grid or the 4 quadrants of a mosaic augmentation, all in one launch. Rectangles are read from
+ *  device memory, so they can be drawn on device without synchronizing.
+ *
+ *  Rectangles are given by their corners `[x1, y1, x2, y2]` in canvas pixel coordinates, with `x2` and `y2`
+ *  exclusive, and can be fractional. The canvas pixels written are those whose center is inside the rectangle,
+ *  and the image is mapped to the rectangle with pixel centers aligned, as in \ref cvcudaResizeSubmit, so an
+ *  integer rectangle at the origin gives the same result as resizing the image to its size. Rectangles partly
+ *  outside of their canvas are clipped, which crops the image, and empty rectangles, rectangles of canvases that
+ *  don't exist and empty images are skipped.
+ *
+ *  The canvas pixels outside of the rectangles are left unchanged, so the canvases are filled beforehand with
+ *  their background. Rectangles of the same canvas shouldn't overlap, their overlapping pixels get the value of
+ *  either image.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | Yes
+ *       Number        | No
+ *       Channels      | Yes
+ *       Width         | No
+ *       Height        | No
+ *
+ *  Rectangles Tensor:
+ *
+ *       [N, 5] float32 `[canvas, x1, y1, x2, y2]`, where N is the number of images of the batch and `canvas` the
+ *       index of the output sample the image is resized into.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input image batch.
+ *                + Must not have more than 65535 images.
+ *
+ * @param [in] rects Rectangles tensor.
+ *
+ * @param [in,out] out Output canvases, only written inside the rectangles.
+ *
+ * @param [in] interpolation Interpolation method to be used, \ref NVCV_INTERP_NEAREST, \ref NVCV_INTERP_LINEAR or
+ *                           \ref NVCV_INTERP_AREA. Area averages all the pixels under each canvas pixel, which
+ *                           avoids aliasing when downscaling, and interpolates linearly when upscaling.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaMosaicSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in,
+                                            NVCVTensorHandle rects, NVCVTensorHandle out,
+                                            const NVCVInterpolationType interpolation);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_MOSAIC_H */
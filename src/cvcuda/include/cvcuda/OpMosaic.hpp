@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpMosaic.hpp
+ *
+ * @brief Defines the public C++ Class for the mosaic operation.
+ * @defgroup NVCV_CPP_ALGORITHM_MOSAIC Mosaic
+ * @{
+ */
+
+#ifndef CVCUDA_MOSAIC_HPP
+#define CVCUDA_MOSAIC_HPP
+
+#include "IOperator.hpp"
+#include "OpMosaic.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class Mosaic final : public IOperator
+{
+public:
+    explicit Mosaic();
+
+    ~Mosaic();
+
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &rects, nvcv::ITensor &out,
+                    const NVCVInterpolationType interpolation = NVCV_INTERP_LINEAR);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline Mosaic::Mosaic()
+{
+    nvcv::detail::CheckThrow(cvcudaMosaicCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline Mosaic::~Mosaic()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void Mosaic::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &rects,
+                               nvcv::ITensor &out, const NVCVInterpolationType interpolation)
+{
+    nvcv::detail::CheckThrow(
+        cvcudaMosaicSubmit(m_handle, stream, in.handle(), rects.handle(), out.handle(), interpolation));
+}
+
+inline NVCVOperatorHandle Mosaic::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_MOSAIC_HPP
@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpNMS.h
+ *
+ * @brief Defines types and functions to handle the non-maximum suppression operation.
+ * @defgroup NVCV_C_ALGORITHM_NMS NMS
+ * @{
+ */
+
+#ifndef CVCUDA_NMS_H
+#define CVCUDA_NMS_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the non-maximum suppression operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @param [in] maxBatchSize maximum number of samples of the tensors given to the operator.
+ *                          + Must not be negative.
+ *
+ * @param [in] maxNumBoxes maximum number of boxes per sample of the tensors given to the operator.
+ *                         + Must not be negative.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaNMSCreate(NVCVOperatorHandle *handle, int32_t maxBatchSize, int32_t maxNumBoxes);
+
+/** Executes the non-maximum suppression operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  Greedily keeps the box of highest score among the boxes whose score is at least the score threshold, and
+ *  suppresses the boxes whose IoU with it is above the IoU threshold, until the output is full or no box is left.
+ *  With class ids, only boxes of the same class suppress each other. With a soft-NMS sigma above zero, overlapping
+ *  boxes aren't suppressed but their scores decay by exp(-IoU^2 / sigma), and they are dropped once below the score
+ *  threshold; the IoU threshold is then unused.
+ *
+ *  The indices of the kept boxes and their scores are written in the order they are kept, followed by -1 indices
+ *  and 0 scores up to the output width, and the number of kept boxes of each sample is written to the count tensor.
+ *  Boxes are corners [x1, y1, x2, y2]. Ties go to the lowest index. Scores must not be NaN.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC], one row per sample, one column per box, with 4 channels for boxes and
+ *                       1 channel for scores and classes
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | Yes, for the classes
+ *       32bit Float    | Yes, for the boxes and scores
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC], one row and one channel per sample, with one column per output box for
+ *                       indices and scores and a single column for counts
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | Yes, for the indices and counts
+ *       32bit Float    | Yes, for the scores
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | No
+ *       Width         | No
+ *       Height        | Yes
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] boxes input tensor with the boxes of each sample.
+ *                   + Must not have more samples or boxes than given at creation.
+ *
+ * @param [in] scores input tensor with the score of each box.
+ *
+ * @param [in] classes input tensor with the class id of each box, or NULL for class-agnostic suppression.
+ *
+ * @param [out] outIndices output tensor with the indices of the kept boxes.
+ *
+ * @param [out] outScores output tensor with the scores of the kept boxes.
+ *
+ * @param [out] outCount output tensor with the number of kept boxes of each sample.
+ *
+ * @param [in] scoreThreshold minimum score of the kept boxes.
+ *
+ * @param [in] iouThreshold IoU above which boxes are suppressed.
+ *                          + Must not be negative.
+ *
+ * @param [in] softSigma soft-NMS sigma, or 0 for hard suppression.
+ *                       + Must not be negative.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaNMSSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle boxes,
+                                         NVCVTensorHandle scores, NVCVTensorHandle classes,
+                                         NVCVTensorHandle outIndices, NVCVTensorHandle outScores,
+                                         NVCVTensorHandle outCount, float scoreThreshold, float iouThreshold,
+                                         float softSigma);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_NMS_H */
@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpNMS.hpp
+ *
+ * @brief Defines the public C++ Class for the non-maximum suppression operation.
+ * @defgroup NVCV_CPP_ALGORITHM_NMS NMS
+ * @{
+ */
+
+#ifndef CVCUDA_NMS_HPP
+#define CVCUDA_NMS_HPP
+
+#include "IOperator.hpp"
+#include "OpNMS.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class NMS final : public IOperator
+{
+public:
+    explicit NMS(int32_t maxBatchSize, int32_t maxNumBoxes);
+
+    ~NMS();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &boxes, nvcv::ITensor &scores, nvcv::ITensor &outIndices,
+                    nvcv::ITensor &outScores, nvcv::ITensor &outCount, float scoreThreshold, float iouThreshold,
+                    float softSigma = 0.f);
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &boxes, nvcv::ITensor &scores, nvcv::ITensor &classes,
+                    nvcv::ITensor &outIndices, nvcv::ITensor &outScores, nvcv::ITensor &outCount,
+                    float scoreThreshold, float iouThreshold, float softSigma = 0.f);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline NMS::NMS(int32_t maxBatchSize, int32_t maxNumBoxes)
+{
+    nvcv::detail::CheckThrow(cvcudaNMSCreate(&m_handle, maxBatchSize, maxNumBoxes));
+    assert(m_handle);
+}
+
+inline NMS::~NMS()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void NMS::operator()(cudaStream_t stream, nvcv::ITensor &boxes, nvcv::ITensor &scores,
+                            nvcv::ITensor &outIndices, nvcv::ITensor &outScores, nvcv::ITensor &outCount,
+                            float scoreThreshold, float iouThreshold, float softSigma)
+{
+    nvcv::detail::CheckThrow(cvcudaNMSSubmit(m_handle, stream, boxes.handle(), scores.handle(), nullptr,
+                                             outIndices.handle(), outScores.handle(), outCount.handle(),
+                                             scoreThreshold, iouThreshold, softSigma));
+}
+
+inline void NMS::operator()(cudaStream_t stream, nvcv::ITensor &boxes, nvcv::ITensor &scores, nvcv::ITensor &classes,
+                            nvcv::ITensor &outIndices, nvcv::ITensor &outScores, nvcv::ITensor &outCount,
+                            float scoreThreshold, float iouThreshold, float softSigma)
+{
+    nvcv::detail::CheckThrow(cvcudaNMSSubmit(m_handle, stream, boxes.handle(), scores.handle(), classes.handle(),
+                                             outIndices.handle(), outScores.handle(), outCount.handle(),
+                                             scoreThreshold, iouThreshold, softSigma));
+}
+
+inline NVCVOperatorHandle NMS::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_NMS_HPP
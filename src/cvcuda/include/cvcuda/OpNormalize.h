@@ -30,6 +30,7 @@
 #include "detail/Export.h"
 
 #include <cuda_runtime.h>
+#include <nvcv/DataLayout.h>
 #include <nvcv/ImageBatch.h>
 #include <nvcv/Status.h>
 #include <nvcv/Tensor.h>
@@ -42,6 +43,10 @@ extern "C"
 // @brief Flag to be used by normalize operation to indicate scale is standard deviation instead.
 #define CVCUDA_NORMALIZE_SCALE_IS_STDDEV (1 << 0)
 
+// @brief Flag to be used by normalize operation to compute the mean and standard deviation of the input into base
+//        and scale, and normalize with them.
+#define CVCUDA_NORMALIZE_COMPUTE_STATS (1 << 1)
+
 /** Constructs and an instance of the normalize operator.
  *
  * @param [out] handle Where the image instance handle will be written to.
@@ -57,6 +62,9 @@ CVCUDA_PUBLIC NVCVStatus cvcudaNormalizeCreate(NVCVOperatorHandle *handle);
  * Executes the normalize operation on the given cuda stream. This operation does not
  * wait for completion.
  *
+ * The output may be the input itself when they have the same type, the operation then runs in place.  Other
+ * overlaps between them are rejected with #NVCV_ERROR_INVALID_ARGUMENT.
+ *
  * Data normalization is done using externally provided base (typically: mean or min) and scale (typically
  * reciprocal of standard deviation or 1/(max-min)). The normalization follows the formula:
  * ```
@@ -79,6 +87,25 @@ CVCUDA_PUBLIC NVCVStatus cvcudaNormalizeCreate(NVCVOperatorHandle *handle);
  * param_idx[axis] = param_shape[axis] == 1 ? 0 : data_idx[axis]
  * ```
  *
+ * With the \p CVCUDA_NORMALIZE_COMPUTE_STATS flag, base and scale are outputs: the operator first computes the
+ * mean and the (population) standard deviation of the input over the elements that share a `param_idx`, writes
+ * them to base and scale respectively, and then normalizes as if \p CVCUDA_NORMALIZE_SCALE_IS_STDDEV was set.
+ * Base and scale must have the same shape, with height and width 1, so the statistics are computed per sample
+ * and/or per channel.  This flag isn't supported by the varshape variant.
+ *
+ * The output usually has the input data type.  For 8-bit unsigned and float inputs it may also be 8-bit signed or
+ * unsigned, to quantize the normalized values directly, e.g. for INT8 inference.  Values are then rounded and
+ * saturated to the output type.  Quantization with scale `qs` and zero point `zp`, i.e. `round(v / qs) + zp`, is
+ * expressed with the normalization parameters:
+ * ```
+ * global_scale' = global_scale / qs
+ * shift'        = shift / qs + zp
+ * ```
+ * Per-channel scales are divided into the scale tensor instead, and per-channel zero points are subtracted from
+ * base as `base[c] - zp[c] / m[c]`, where `m[c]` is the overall multiplier of channel `c`.  These inputs may
+ * also have a half-precision float output, e.g. for FP16 inference, normalized in float and rounded to half.
+ * Quantized and half outputs aren't supported by the varshape variant.
+ *
  * Limitations:
  *
  * Input:
@@ -110,13 +137,14 @@ CVCUDA_PUBLIC NVCVStatus cvcudaNormalizeCreate(NVCVOperatorHandle *handle);
  *      32bit Signed   | Yes
  *      32bit Float    | Yes
  *      64bit Float    | No
+ *      16bit Float    | Yes, for 8-bit unsigned and float inputs
  *
  * Input/Output dependency
  *
  *      Property      |  Input == Output
  *     -------------- | -------------
  *      Data Layout   | Yes
- *      Data Type     | Yes
+ *      Data Type     | Yes, except for quantized and half outputs
  *      Number        | Yes
  *      Channels      | Yes
  *      Width         | Yes
@@ -135,9 +163,9 @@ CVCUDA_PUBLIC NVCVStatus cvcudaNormalizeCreate(NVCVOperatorHandle *handle);
  *
  * @param [in] in Intput tensor.
  *
- * @param [in] base Base tensor.
+ * @param [in,out] base Base tensor, output of the means with \p CVCUDA_NORMALIZE_COMPUTE_STATS.
  *
- * @param [in] scale Scale tensor.
+ * @param [in,out] scale Scale tensor, output of the standard deviations with \p CVCUDA_NORMALIZE_COMPUTE_STATS.
  *
  * @param [out] out Output tensor.
  *
@@ -149,7 +177,8 @@ CVCUDA_PUBLIC NVCVStatus cvcudaNormalizeCreate(NVCVOperatorHandle *handle);
  *                     added to variance.
  *
  * @param [in] flags Algorithm flags, use \p CVCUDA_NORMALIZE_SCALE_IS_STDDEV if scale passed as argument
- *                   is standard deviation instead or 0 if it is scaling.
+ *                   is standard deviation instead or 0 if it is scaling.  Use \p CVCUDA_NORMALIZE_COMPUTE_STATS
+ *                   to have base and scale computed from the input.
  *
  * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
  * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
@@ -166,6 +195,36 @@ CVCUDA_PUBLIC NVCVStatus cvcudaNormalizeVarShapeSubmit(NVCVOperatorHandle handle
                                                        float global_scale, float shift, float epsilon, uint32_t flags);
 /** @} */
 
+/** Executes the normalize operation, reordering the channels of each pixel as it's loaded.
+ *
+ * Output channel c is normalized from the input channel selected by the c-th component of \p channelOrder, e.g.
+ * NVCV_SWIZZLE_ZYXW turns BGR(A) into RGB(A) without an operator of its own. Base and scale values are in output
+ * channel order, and so are the statistics computed with \p CVCUDA_NORMALIZE_COMPUTE_STATS.
+ *
+ * Other parameters and limitations are the same as \ref cvcudaNormalizeSubmit.
+ *
+ * @param [in] channelOrder Input channel of each output channel.
+ *                          + Its first components, one per channel, must be X, Y, Z or W selecting an existing
+ *                            channel.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+/** @{ */
+CVCUDA_PUBLIC NVCVStatus cvcudaNormalizeReorderSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                      NVCVTensorHandle in, NVCVTensorHandle base,
+                                                      NVCVTensorHandle scale, NVCVTensorHandle out, float global_scale,
+                                                      float shift, float epsilon, uint32_t flags,
+                                                      NVCVSwizzle channelOrder);
+
+CVCUDA_PUBLIC NVCVStatus cvcudaNormalizeVarShapeReorderSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                              NVCVImageBatchHandle in, NVCVTensorHandle base,
+                                                              NVCVTensorHandle scale, NVCVImageBatchHandle out,
+                                                              float global_scale, float shift, float epsilon,
+                                                              uint32_t flags, NVCVSwizzle channelOrder);
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
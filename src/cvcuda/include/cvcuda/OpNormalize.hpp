@@ -50,6 +50,14 @@ public:
     void operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::ITensor &base, nvcv::ITensor &scale,
                     nvcv::IImageBatch &out, float global_scale, float shift, float epsilon, uint32_t flags = 0);
 
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &base, nvcv::ITensor &scale,
+                    nvcv::ITensor &out, float global_scale, float shift, float epsilon, uint32_t flags,
+                    NVCVSwizzle channelOrder);
+
+    void operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::ITensor &base, nvcv::ITensor &scale,
+                    nvcv::IImageBatch &out, float global_scale, float shift, float epsilon, uint32_t flags,
+                    NVCVSwizzle channelOrder);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -83,6 +91,24 @@ inline void Normalize::operator()(cudaStream_t stream, nvcv::IImageBatch &in, nv
                                                            out.handle(), global_scale, shift, epsilon, flags));
 }
 
+inline void Normalize::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &base, nvcv::ITensor &scale,
+                                  nvcv::ITensor &out, float global_scale, float shift, float epsilon, uint32_t flags,
+                                  NVCVSwizzle channelOrder)
+{
+    nvcv::detail::CheckThrow(cvcudaNormalizeReorderSubmit(m_handle, stream, in.handle(), base.handle(), scale.handle(),
+                                                          out.handle(), global_scale, shift, epsilon, flags,
+                                                          channelOrder));
+}
+
+inline void Normalize::operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::ITensor &base, nvcv::ITensor &scale,
+                                  nvcv::IImageBatch &out, float global_scale, float shift, float epsilon,
+                                  uint32_t flags, NVCVSwizzle channelOrder)
+{
+    nvcv::detail::CheckThrow(cvcudaNormalizeVarShapeReorderSubmit(m_handle, stream, in.handle(), base.handle(),
+                                                                  scale.handle(), out.handle(), global_scale, shift,
+                                                                  epsilon, flags, channelOrder));
+}
+
 inline NVCVOperatorHandle Normalize::handle() const noexcept
 {
     return m_handle;
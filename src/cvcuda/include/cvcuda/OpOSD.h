@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpOSD.h
+ *
+ * @brief Defines types and functions to handle the on-screen display operation.
+ * @defgroup NVCV_C_ALGORITHM_OSD On-Screen Display
+ * @{
+ */
+
+#ifndef CVCUDA_OSD_H
+#define CVCUDA_OSD_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the on-screen display operator.
+ *
+ * The operator reserves a workspace of 4 ints per element of maxBatchSize samples of maxNumElements elements, for
+ * the pixel bounds of the elements.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @param [in] maxBatchSize maximum number of samples of the tensors given to the operator.
+ *                          + Must not be negative.
+ *
+ * @param [in] maxNumElements maximum number of elements per sample given to the operator.
+ *                            + Must not be negative.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaOSDCreate(NVCVOperatorHandle *handle, int32_t maxBatchSize, int32_t maxNumElements);
+
+/** Executes the on-screen display operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  Draws rectangles, lines, filled polygons and text over the frames, in place, e.g. detection boxes with their
+ *  labels. The elements are read from device memory, so they can be built on device from the detections without
+ *  copying the frames to the host. Masks are drawn by \ref cvcudaMaskOverlaySubmit.
+ *
+ *  The elements of a sample are drawn in their order, each one blended over the pixels whose center it covers as
+ *  \ref cvcudaCompositeSubmit does: pixel + (color - pixel) * alpha / 255, rounded, where alpha is the alpha of the
+ *  element color scaled by its coverage of the pixel. Only the pixels covered by elements are read and written, and
+ *  each tile of the frames only tests the elements overlapping it.
+ *
+ *  Each element is 12 float values: its \ref NVCVOSDElementType, its color R, G, B, A in [0, 255], in the channel
+ *  order of the frames, then the parameters of the primitive, unused ones being ignored.
+ *
+ *       Type                    | Parameters
+ *       ----------------------- | ---------------------------------------------------------------------------
+ *       \ref NVCV_OSD_RECT      | x1, y1, x2, y2, thickness: the rectangle [x1, x2) x [y1, y2), outlined inside
+ *                               | with the thickness, or filled when it isn't positive.
+ *       \ref NVCV_OSD_LINE      | x1, y1, x2, y2, thickness: pixels closer to the segment than half the
+ *                               | thickness, at least 1.
+ *       \ref NVCV_OSD_POLYGON   | first, count: polygon of the count points of the points tensor of the sample
+ *                               | starting at first, filled with the even-odd rule. Needs at least 3 points.
+ *       \ref NVCV_OSD_GLYPH     | x, y, scale, glyph: glyph of the atlas with its top-left corner at (x, y),
+ *                               | scaled with the nearest texel, its texels being the coverage of the pixels.
+ *
+ *  Text is drawn with one glyph element per character of a monospace atlas. Elements with zero alpha, empty
+ *  rectangles, and polygons or glyphs outside of their tensors are skipped.
+ *
+ *  Limitations:
+ *
+ *  Input/Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4], the 4th channel is left unchanged.
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Elements Tensor:
+ *
+ *       [N,1,M,12] float32 for M elements per sample.
+ *
+ *  Number of Elements Tensor:
+ *
+ *       [N,1,1,1] int32. Only the first elements of each sample are drawn, up to their number.
+ *
+ *  Points Tensor:
+ *
+ *       [N,1,P,2] float32, the (x, y) vertices of the polygons of each sample.
+ *
+ *  Glyphs Tensor:
+ *
+ *       [G,H,W,1] uint8, the coverage of the W x H pixels of each of the G glyphs of the atlas.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in,out] inOut Frames, modified in place.
+ *                       + Must not have more samples than given at creation.
+ *
+ * @param [in] elements Elements tensor.
+ *                      + Must not have more elements per sample than given at creation.
+ *
+ * @param [in] numElements Number of elements tensor, or NULL to draw all the elements of the elements tensor.
+ *
+ * @param [in] points Points tensor, or NULL when there are no polygons.
+ *
+ * @param [in] glyphs Glyphs tensor, or NULL when there is no text.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaOSDSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle inOut,
+                                         NVCVTensorHandle elements, NVCVTensorHandle numElements,
+                                         NVCVTensorHandle points, NVCVTensorHandle glyphs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_OSD_H */
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpOSD.hpp
+ *
+ * @brief Defines the public C++ Class for the on-screen display operation.
+ * @defgroup NVCV_CPP_ALGORITHM_OSD On-Screen Display
+ * @{
+ */
+
+#ifndef CVCUDA_OSD_HPP
+#define CVCUDA_OSD_HPP
+
+#include "IOperator.hpp"
+#include "OpOSD.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class OSD final : public IOperator
+{
+public:
+    explicit OSD(int32_t maxBatchSize, int32_t maxNumElements);
+
+    ~OSD();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &inOut, nvcv::ITensor &elements,
+                    nvcv::ITensor *numElements = nullptr, nvcv::ITensor *points = nullptr,
+                    nvcv::ITensor *glyphs = nullptr);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline OSD::OSD(int32_t maxBatchSize, int32_t maxNumElements)
+{
+    nvcv::detail::CheckThrow(cvcudaOSDCreate(&m_handle, maxBatchSize, maxNumElements));
+    assert(m_handle);
+}
+
+inline OSD::~OSD()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void OSD::operator()(cudaStream_t stream, nvcv::ITensor &inOut, nvcv::ITensor &elements,
+                            nvcv::ITensor *numElements, nvcv::ITensor *points, nvcv::ITensor *glyphs)
+{
+    nvcv::detail::CheckThrow(cvcudaOSDSubmit(m_handle, stream, inOut.handle(), elements.handle(),
+                                             numElements ? numElements->handle() : nullptr,
+                                             points ? points->handle() : nullptr, glyphs ? glyphs->handle() : nullptr));
+}
+
+inline NVCVOperatorHandle OSD::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_OSD_HPP
@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpPSNR.h
+ *
+ * @brief Defines types and functions to handle the peak signal-to-noise ratio operation.
+ * @defgroup NVCV_C_ALGORITHM_PSNR PSNR
+ * @{
+ */
+
+#ifndef CVCUDA_PSNR_H
+#define CVCUDA_PSNR_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the peak signal-to-noise ratio operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaPSNRCreate(NVCVOperatorHandle *handle);
+
+/** Executes the peak signal-to-noise ratio operation on the given cuda stream. This operation does not wait
+ *  for completion.
+ *
+ *  Computes the peak signal-to-noise ratio of every sample of the input against the same sample of the
+ *  reference, 10 * log10(maxValue^2 / MSE) in dB, where MSE is the mean squared error of the sample, e.g. to
+ *  monitor the quality of encoded or resized frames without copying them to the host. All samples are scored by a
+ *  single launch, and the score of each sample is computed in a fixed order, so it doesn't change from one run to
+ *  the next. Squared errors are accumulated in single precision. Equal samples have infinite scores.
+ *
+ *  Limitations:
+ *
+ *  Input and reference:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, input channels]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | Yes, or 1 to score all channels together
+ *       Width         | No, 1
+ *       Height        | No, 1
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [in] ref Reference tensor, with the shape and data type of the input.
+ *
+ * @param [out] out Output tensor, with one score per sample, and per channel when it has the input channels.
+ *
+ * @param [in] maxValue Peak value of the images, or 0 to use the range of the data type: 255 for uint8, 65535 for
+ *                      uint16, 32767 for int16 and 1 for float32.
+ *                      + Must not be negative.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaPSNRSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                          NVCVTensorHandle ref, NVCVTensorHandle out, float maxValue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_PSNR_H */
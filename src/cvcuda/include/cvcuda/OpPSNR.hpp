@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpPSNR.hpp
+ *
+ * @brief Defines the public C++ Class for the peak signal-to-noise ratio operation.
+ * @defgroup NVCV_CPP_ALGORITHM_PSNR PSNR
+ * @{
+ */
+
+#ifndef CVCUDA_PSNR_HPP
+#define CVCUDA_PSNR_HPP
+
+#include "IOperator.hpp"
+#include "OpPSNR.h"
+#include "Types.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class PSNR final : public IOperator
+{
+public:
+    explicit PSNR();
+
+    ~PSNR();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &ref, nvcv::ITensor &out,
+                    float maxValue = 0);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline PSNR::PSNR()
+{
+    nvcv::detail::CheckThrow(cvcudaPSNRCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline PSNR::~PSNR()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void PSNR::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &ref, nvcv::ITensor &out,
+                             float maxValue)
+{
+    nvcv::detail::CheckThrow(cvcudaPSNRSubmit(m_handle, stream, in.handle(), ref.handle(), out.handle(), maxValue));
+}
+
+inline NVCVOperatorHandle PSNR::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_PSNR_HPP
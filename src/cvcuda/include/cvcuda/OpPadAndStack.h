@@ -26,6 +26,7 @@
 #ifndef CVCUDA_PADANDSTACK_H
 #define CVCUDA_PADANDSTACK_H
 
+#include "OpNormalize.h" // for CVCUDA_NORMALIZE_SCALE_IS_STDDEV
 #include "Operator.h"
 #include "Types.h"
 #include "detail/Export.h"
@@ -66,6 +67,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaPadAndStackCreate(NVCVOperatorHandle *handle);
  *       8bit  Signed   | No
  *       16bit Unsigned | Yes
  *       16bit Signed   | Yes
+ *       16bit Float    | Yes
  *       32bit Unsigned | No
  *       32bit Signed   | Yes
  *       32bit Float    | Yes
@@ -81,6 +83,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaPadAndStackCreate(NVCVOperatorHandle *handle);
  *       8bit  Signed   | No
  *       16bit Unsigned | Yes
  *       16bit Signed   | Yes
+ *       16bit Float    | Yes
  *       32bit Unsigned | No
  *       32bit Signed   | Yes
  *       32bit Float    | Yes
@@ -130,6 +133,101 @@ CVCUDA_PUBLIC NVCVStatus cvcudaPadAndStackSubmit(NVCVOperatorHandle handle, cuda
                                                  NVCVImageBatchHandle in, NVCVTensorHandle out, NVCVTensorHandle top,
                                                  NVCVTensorHandle left, NVCVBorderType borderMode, float borderValue);
 
+/** Executes the pad and stack operation fused with normalization, type conversion and reformat on the given cuda
+ *  stream. This operation does not wait for completion.
+ *
+ *  It's equivalent to executing \ref cvcudaPadAndStackSubmit, \ref cvcudaConvertToSubmit to float,
+ *  \ref cvcudaNormalizeSubmit and optionally \ref cvcudaReformatSubmit to NCHW in sequence, but input images
+ *  are read once and no intermediate tensors are needed. Padded values, border values included, are normalized
+ *  as in \ref cvcudaResizeNormalizeReformatSubmit:
+ *  ```
+ *  out[n,c,y,x] = (padded[n,y,x,c] - base[param_idx]) * scale[param_idx] * global_scale + shift
+ *  ```
+ *  and rounded and saturated to the output type, which can be 8-bit for networks with quantized inputs.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | No
+ *       16bit Float    | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | Yes
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       16bit Float    | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | No
+ *       Height        | No
+ *
+ *  Scale/Base Tensor:
+ *
+ *       32-bit float tensors with shape [1,1,1,1], [1,1,1,C], [N,1,1,1] or [N,1,1,C],
+ *       where N and C are the output number of samples and channels.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in, out, top, left, borderMode, borderValue Same as \ref cvcudaPadAndStackSubmit, the border value
+ *                                                          is in input units.
+ *
+ * @param [in] base Base tensor.
+ *
+ * @param [in] scale Scale tensor.
+ *
+ * @param [in] global_scale Additional scale value to be used in addition to scale.
+ *
+ * @param [in] shift Additional bias value to be used in addition to base.
+ *
+ * @param [in] epsilon Epsilon to use when \p CVCUDA_NORMALIZE_SCALE_IS_STDDEV flag is set as a regularizing term to
+ *                     be added to variance.
+ *
+ * @param [in] flags Algorithm flags, use \p CVCUDA_NORMALIZE_SCALE_IS_STDDEV if scale passed as argument
+ *                   is standard deviation instead or 0 if it is scaling.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaPadAndStackNormalizeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                          NVCVImageBatchHandle in, NVCVTensorHandle out,
+                                                          NVCVTensorHandle top, NVCVTensorHandle left,
+                                                          NVCVBorderType borderMode, float borderValue,
+                                                          NVCVTensorHandle base, NVCVTensorHandle scale,
+                                                          float global_scale, float shift, float epsilon,
+                                                          uint32_t flags);
+
 #ifdef __cplusplus
 }
 #endif
@@ -47,6 +47,10 @@ public:
     void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out, nvcv::ITensor &top,
                     nvcv::ITensor &left, NVCVBorderType borderMode, float borderValue);
 
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out, nvcv::ITensor &top,
+                    nvcv::ITensor &left, NVCVBorderType borderMode, float borderValue, nvcv::ITensor &base,
+                    nvcv::ITensor &scale, float global_scale, float shift, float epsilon, uint32_t flags = 0);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -73,6 +77,17 @@ inline void PadAndStack::operator()(cudaStream_t stream, nvcv::IImageBatchVarSha
                                                      left.handle(), borderMode, borderValue));
 }
 
+inline void PadAndStack::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out,
+                                    nvcv::ITensor &top, nvcv::ITensor &left, NVCVBorderType borderMode,
+                                    float borderValue, nvcv::ITensor &base, nvcv::ITensor &scale, float global_scale,
+                                    float shift, float epsilon, uint32_t flags)
+{
+    nvcv::detail::CheckThrow(cvcudaPadAndStackNormalizeSubmit(m_handle, stream, in.handle(), out.handle(),
+                                                              top.handle(), left.handle(), borderMode, borderValue,
+                                                              base.handle(), scale.handle(), global_scale, shift,
+                                                              epsilon, flags));
+}
+
 inline NVCVOperatorHandle PadAndStack::handle() const noexcept
 {
     return m_handle;
@@ -0,0 +1,285 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpRandomParams.h
+ *
+ * @brief Defines types and functions to draw random augmentation parameters on device.
+ * @defgroup NVCV_C_ALGORITHM_RANDOM_PARAMS Random Params
+ * @{
+ */
+
+#ifndef CVCUDA_RANDOM_PARAMS_H
+#define CVCUDA_RANDOM_PARAMS_H
+
+#include "Operator.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the random params operator.
+ *
+ *  The operator draws the parameters of random augmentations on device, directly into the tensors consumed by
+ *  \ref cvcudaFlipVarShapeSubmit, \ref cvcudaGammaContrastVarShapeSubmit, \ref cvcudaRotateVarShapeSubmit,
+ *  \ref cvcudaEraseVarShapeSubmit, \ref cvcudaCropResizeSubmit and \ref cvcudaCropResizeVarShapeSubmit, so that
+ *  training pipelines neither generate them on host nor copy them to device every batch.
+ *
+ *  It's the state of the random number generator: every successful submission is a new draw, and sample `i` of
+ *  draw `d` uses the Philox4x32-10 stream `{seed, i}` starting at block `d * 2^32`, see \ref nvcv::cuda::Philox.
+ *  Results only depend on the seed and on the sequence of submissions, not on the device. Submissions must not be
+ *  made concurrently from several threads.
+ *
+ * @param [out] handle Where the operator instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @param [in] seed Seed of the random number generator.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRandomParamsCreate(NVCVOperatorHandle *handle, uint64_t seed);
+
+/** Restarts the random number generator of the operator with a new seed.
+ *
+ *  The next submission is draw 0 again, so a pipeline reseeded with the same seed draws the same parameters.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ *
+ * @param [in] seed Seed of the random number generator.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or invalid.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRandomParamsSetSeed(NVCVOperatorHandle handle, uint64_t seed);
+
+/** Draws random flip codes, for \ref cvcudaFlipVarShapeSubmit. This operation does not wait for completion.
+ *
+ *  Each sample is flipped horizontally with probability \p probHoriz and vertically with probability
+ *  \p probVert, independently. Its code is 1 for a horizontal flip, 0 for a vertical one, -1 for both, and 2 when
+ *  it isn't flipped, which the flip operator copies as is.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [out] flipCode Flip code of each sample.
+ *                       + Must be a 32-bit signed integer tensor with shape [N].
+ *
+ * @param [in] probHoriz Probability of a horizontal flip.
+ *                       + Must be in [0, 1].
+ *
+ * @param [in] probVert Probability of a vertical flip.
+ *                      + Must be in [0, 1].
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRandomFlipCodeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                    NVCVTensorHandle flipCode, float probHoriz, float probVert);
+
+/** Draws values uniformly distributed between \p low and \p high. This operation does not wait for completion.
+ *
+ *  Meant for scalar parameters such as the gammas of \ref cvcudaGammaContrastVarShapeSubmit. A tensor with shape
+ *  [N] gets one value per sample; with shape [N,K], each of the N rows gets K values.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [out] out Random values.
+ *                  + Must be a 32-bit or 64-bit float tensor with shape [N] or [N,K].
+ *                  + Rows of a [N,K] tensor must be contiguous.
+ *
+ * @param [in] low Lower bound of the values.
+ *
+ * @param [in] high Upper bound of the values.
+ *                  + Must not be less than \p low.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRandomUniformSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                   NVCVTensorHandle out, double low, double high);
+
+/** Draws random rotations about the image centers, for \ref cvcudaRotateVarShapeSubmit.
+ *  This operation does not wait for completion.
+ *
+ *  Each image gets an angle uniformly distributed between \p minAngleDeg and \p maxAngleDeg, and the shift that
+ *  keeps its center `((width - 1) / 2, (height - 1) / 2)` in place.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Image batch to be rotated, only the image sizes are used.
+ *
+ * @param [out] angleDeg Angle of each image in degrees.
+ *                       + Must be a 64-bit float tensor with shape [N], N being the number of images.
+ *
+ * @param [out] shift Shift of each image.
+ *                    + Must be a 64-bit float tensor with shape [N,2].
+ *
+ * @param [in] minAngleDeg Smallest angle in degrees.
+ *
+ * @param [in] maxAngleDeg Largest angle in degrees.
+ *                         + Must not be less than \p minAngleDeg.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRandomRotateSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                  NVCVImageBatchHandle in, NVCVTensorHandle angleDeg,
+                                                  NVCVTensorHandle shift, double minAngleDeg, double maxAngleDeg);
+
+/** Draws random erasing areas, one per image, for \ref cvcudaEraseVarShapeSubmit.
+ *  This operation does not wait for completion.
+ *
+ *  With probability \p probability, image `i` gets an area covering a fraction of the image uniformly distributed
+ *  between \p minArea and \p maxArea, with an aspect ratio (width over height) whose logarithm is uniformly
+ *  distributed between the ones of \p minAspect and \p maxAspect, clipped to the image and placed uniformly
+ *  inside it, as in random erasing. All channels are erased. Otherwise the area is empty. Area `i` is mapped to
+ *  image `i`, pass as many values as areas to the erase operator, or ask it to fill the areas randomly.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Image batch to be erased, only the image sizes are used.
+ *
+ * @param [out] anchor Top left corner of each area.
+ *                     + Must be a tensor with shape [N] of 2 interleaved 32-bit signed integers, N being the
+ *                       number of images.
+ *
+ * @param [out] erasing Width, height and channel mask of each area.
+ *                      + Must be a tensor with shape [N] of 3 interleaved 32-bit signed integers.
+ *
+ * @param [out] imgIdx Image of each area.
+ *                     + Must be a 32-bit signed integer tensor with shape [N].
+ *
+ * @param [in] probability Probability of erasing each image.
+ *                         + Must be in [0, 1].
+ *
+ * @param [in] minArea Smallest fraction of the image area.
+ *
+ * @param [in] maxArea Largest fraction of the image area.
+ *                     + Must have 0 < \p minArea <= \p maxArea <= 1.
+ *
+ * @param [in] minAspect Smallest aspect ratio.
+ *
+ * @param [in] maxAspect Largest aspect ratio.
+ *                       + Must have 0 < \p minAspect <= \p maxAspect.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRandomEraseSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                 NVCVImageBatchHandle in, NVCVTensorHandle anchor,
+                                                 NVCVTensorHandle erasing, NVCVTensorHandle imgIdx,
+                                                 float probability, float minArea, float maxArea, float minAspect,
+                                                 float maxAspect);
+
+/** Draws random crop boxes, for \ref cvcudaCropResizeSubmit. This operation does not wait for completion.
+ *
+ *  Box `i` covers a fraction of the \p width by \p height input uniformly distributed between \p minScale and
+ *  \p maxScale, with an aspect ratio whose logarithm is uniformly distributed between the ones of \p minAspect and
+ *  \p maxAspect, clipped to the input and placed uniformly inside it, as in random resized crops. Boxes have
+ *  integer corners `[x1, y1, x2, y2]`.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [out] boxes Crop boxes.
+ *                    + Must be a 32-bit float tensor with shape [N,4].
+ *
+ * @param [in] width Width of the input.
+ *                   + Must be positive.
+ *
+ * @param [in] height Height of the input.
+ *                    + Must be positive.
+ *
+ * @param [in] minScale Smallest fraction of the input area.
+ *
+ * @param [in] maxScale Largest fraction of the input area.
+ *                      + Must have 0 < \p minScale <= \p maxScale <= 1.
+ *
+ * @param [in] minAspect Smallest aspect ratio.
+ *
+ * @param [in] maxAspect Largest aspect ratio.
+ *                       + Must have 0 < \p minAspect <= \p maxAspect.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRandomCropSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                NVCVTensorHandle boxes, int32_t width, int32_t height,
+                                                float minScale, float maxScale, float minAspect,
+                                                float maxAspect);
+
+/** Draws one random crop box inside each image of a batch, for \ref cvcudaCropResizeVarShapeSubmit.
+ *  This operation does not wait for completion.
+ *
+ *  Same as \ref cvcudaRandomCropSubmit, with box `i` drawn inside image `i` of \p in.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Image batch to be cropped, only the image sizes are used.
+ *
+ * @param [out] boxes Crop boxes.
+ *                    + Must be a 32-bit float tensor with shape [N,4], N being the number of images.
+ *
+ * @param [in] minScale Smallest fraction of the image area.
+ *
+ * @param [in] maxScale Largest fraction of the image area.
+ *                      + Must have 0 < \p minScale <= \p maxScale <= 1.
+ *
+ * @param [in] minAspect Smallest aspect ratio.
+ *
+ * @param [in] maxAspect Largest aspect ratio.
+ *                       + Must have 0 < \p minAspect <= \p maxAspect.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRandomCropVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                        NVCVImageBatchHandle in, NVCVTensorHandle boxes,
+                                                        float minScale, float maxScale, float minAspect,
+                                                        float maxAspect);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_RANDOM_PARAMS_H */
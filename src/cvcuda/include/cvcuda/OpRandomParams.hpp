@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpRandomParams.hpp
+ *
+ * @brief Defines the public C++ Class for the random params operation.
+ * @defgroup NVCV_CPP_ALGORITHM_RANDOM_PARAMS Random Params
+ * @{
+ */
+
+#ifndef CVCUDA_RANDOM_PARAMS_HPP
+#define CVCUDA_RANDOM_PARAMS_HPP
+
+#include "IOperator.hpp"
+#include "OpRandomParams.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class RandomParams final : public IOperator
+{
+public:
+    explicit RandomParams(uint64_t seed);
+
+    ~RandomParams();
+
+    void setSeed(uint64_t seed);
+
+    void flipCode(cudaStream_t stream, nvcv::ITensor &flipCode, float probHoriz, float probVert);
+
+    void uniform(cudaStream_t stream, nvcv::ITensor &out, double low, double high);
+
+    void rotate(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &angleDeg, nvcv::ITensor &shift,
+                double minAngleDeg, double maxAngleDeg);
+
+    void erase(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &anchor, nvcv::ITensor &erasing,
+               nvcv::ITensor &imgIdx, float probability, float minArea, float maxArea, float minAspect,
+               float maxAspect);
+
+    void crop(cudaStream_t stream, nvcv::ITensor &boxes, int32_t width, int32_t height, float minScale,
+              float maxScale, float minAspect, float maxAspect);
+
+    void crop(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &boxes, float minScale,
+              float maxScale, float minAspect, float maxAspect);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline RandomParams::RandomParams(uint64_t seed)
+{
+    nvcv::detail::CheckThrow(cvcudaRandomParamsCreate(&m_handle, seed));
+    assert(m_handle);
+}
+
+inline RandomParams::~RandomParams()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void RandomParams::setSeed(uint64_t seed)
+{
+    nvcv::detail::CheckThrow(cvcudaRandomParamsSetSeed(m_handle, seed));
+}
+
+inline void RandomParams::flipCode(cudaStream_t stream, nvcv::ITensor &flipCode, float probHoriz, float probVert)
+{
+    nvcv::detail::CheckThrow(cvcudaRandomFlipCodeSubmit(m_handle, stream, flipCode.handle(), probHoriz, probVert));
+}
+
+inline void RandomParams::uniform(cudaStream_t stream, nvcv::ITensor &out, double low, double high)
+{
+    nvcv::detail::CheckThrow(cvcudaRandomUniformSubmit(m_handle, stream, out.handle(), low, high));
+}
+
+inline void RandomParams::rotate(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &angleDeg,
+                                 nvcv::ITensor &shift, double minAngleDeg, double maxAngleDeg)
+{
+    nvcv::detail::CheckThrow(cvcudaRandomRotateSubmit(m_handle, stream, in.handle(), angleDeg.handle(),
+                                                      shift.handle(), minAngleDeg, maxAngleDeg));
+}
+
+inline void RandomParams::erase(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &anchor,
+                                nvcv::ITensor &erasing, nvcv::ITensor &imgIdx, float probability, float minArea,
+                                float maxArea, float minAspect, float maxAspect)
+{
+    nvcv::detail::CheckThrow(cvcudaRandomEraseSubmit(m_handle, stream, in.handle(), anchor.handle(),
+                                                     erasing.handle(), imgIdx.handle(), probability, minArea,
+                                                     maxArea, minAspect, maxAspect));
+}
+
+inline void RandomParams::crop(cudaStream_t stream, nvcv::ITensor &boxes, int32_t width, int32_t height,
+                               float minScale, float maxScale, float minAspect, float maxAspect)
+{
+    nvcv::detail::CheckThrow(cvcudaRandomCropSubmit(m_handle, stream, boxes.handle(), width, height, minScale,
+                                                    maxScale, minAspect, maxAspect));
+}
+
+inline void RandomParams::crop(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &boxes,
+                               float minScale, float maxScale, float minAspect, float maxAspect)
+{
+    nvcv::detail::CheckThrow(cvcudaRandomCropVarShapeSubmit(m_handle, stream, in.handle(), boxes.handle(), minScale,
+                                                            maxScale, minAspect, maxAspect));
+}
+
+inline NVCVOperatorHandle RandomParams::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_RANDOM_PARAMS_HPP
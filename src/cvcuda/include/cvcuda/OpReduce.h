@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpReduce.h
+ *
+ * @brief Defines types and functions to handle the reduce operation.
+ * @defgroup NVCV_C_ALGORITHM_REDUCE Reduce
+ * @{
+ */
+
+#ifndef CVCUDA_REDUCE_H
+#define CVCUDA_REDUCE_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the reduce operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaReduceCreate(NVCVOperatorHandle *handle);
+
+/** Executes the reduce operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  Reduces every sample of the batch to the sum, mean, minimum or maximum of its values, either per channel or
+ *  over all channels, depending on the number of channels of the output. All samples are reduced by a single
+ *  launch, and the result of each sample is computed in a fixed order, so it doesn't change from one run to
+ *  the next. Values are accumulated in single precision.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
+ *       Channels:       [1, 3, 4] for interleaved layouts, any for planar layouts
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed | Yes
+ *       16bit Unsigned | Yes
+ *       16bit Signed | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed | Yes
+ *       32bit Float | Yes
+ *       64bit Float | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, input channels]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed | No
+ *       16bit Unsigned | No
+ *       16bit Signed | No
+ *       32bit Unsigned | No
+ *       32bit Signed | No
+ *       32bit Float | Yes
+ *       64bit Float | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | Yes, or 1 to reduce all channels together
+ *       Width         | No, 1
+ *       Height        | No, 1
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [out] out Output tensor, with one value per sample and channel.
+ *
+ * @param [in] op Reduce operation, \ref NVCV_REDUCE_SUM, \ref NVCV_REDUCE_MEAN, \ref NVCV_REDUCE_MIN or
+ *                \ref NVCV_REDUCE_MAX.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaReduceSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                            NVCVTensorHandle out, const NVCVReduceOp op);
+
+/** Executes the reduce operation on a varshape batch, see \ref cvcudaReduceSubmit.
+ *
+ *  Images must all have the same format, with 1, 3 or 4 channels. The output has one sample per image.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaReduceVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                    NVCVImageBatchHandle in, NVCVTensorHandle out,
+                                                    const NVCVReduceOp op);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_REDUCE_H */
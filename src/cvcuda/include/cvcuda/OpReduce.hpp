@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpReduce.hpp
+ *
+ * @brief Defines the public C++ Class for the reduce operation.
+ * @defgroup NVCV_CPP_ALGORITHM_REDUCE Reduce
+ * @{
+ */
+
+#ifndef CVCUDA_REDUCE_HPP
+#define CVCUDA_REDUCE_HPP
+
+#include "IOperator.hpp"
+#include "OpReduce.h"
+#include "Types.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class Reduce final : public IOperator
+{
+public:
+    explicit Reduce();
+
+    ~Reduce();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, const NVCVReduceOp op);
+
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out, const NVCVReduceOp op);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline Reduce::Reduce()
+{
+    nvcv::detail::CheckThrow(cvcudaReduceCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline Reduce::~Reduce()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void Reduce::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, const NVCVReduceOp op)
+{
+    nvcv::detail::CheckThrow(cvcudaReduceSubmit(m_handle, stream, in.handle(), out.handle(), op));
+}
+
+inline void Reduce::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out,
+                               const NVCVReduceOp op)
+{
+    nvcv::detail::CheckThrow(cvcudaReduceVarShapeSubmit(m_handle, stream, in.handle(), out.handle(), op));
+}
+
+inline NVCVOperatorHandle Reduce::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_REDUCE_HPP
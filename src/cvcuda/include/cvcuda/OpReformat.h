@@ -30,6 +30,7 @@
 #include "detail/Export.h"
 
 #include <cuda_runtime.h>
+#include <nvcv/DataLayout.h>
 #include <nvcv/Status.h>
 #include <nvcv/Tensor.h>
 
@@ -54,10 +55,14 @@ CVCUDA_PUBLIC NVCVStatus cvcudaReformatCreate(NVCVOperatorHandle *handle);
 /** Executes the reformat operation on the given cuda stream. This operation does not
  *  wait for completion.
  *
+ *  When both tensors are in host memory, wrapped with #NVCV_TENSOR_BUFFER_STRIDED_HOST, the operation runs on the
+ *  host instead, synchronously, and the stream isn't used.  Only changes between planar and interleaved layouts are
+ *  supported there, e.g. NHWC to NCHW.
+ *
  *  Limitations:
  *
  *  Input:
- *       Data Layout:    [kNHWC, kHWC, kNCHW, KCHW]
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, KCHW, NCHWc]
  *       Channels:       [1, 3, 4]
  *
  *       Data Type      | Allowed
@@ -66,13 +71,14 @@ CVCUDA_PUBLIC NVCVStatus cvcudaReformatCreate(NVCVOperatorHandle *handle);
  *       8bit  Signed   | Yes
  *       16bit Unsigned | Yes
  *       16bit Signed   | Yes
+ *       16bit Float    | Yes
  *       32bit Unsigned | No
  *       32bit Signed   | Yes
  *       32bit Float    | Yes
  *       64bit Float    | Yes
  *
  *  Output:
- *       Data Layout:    [kNHWC, kHWC, kNCHW, KCHW]
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, KCHW, NCHWc]
  *       Channels:       [1, 3, 4]
  *
  *       Data Type      | Allowed
@@ -81,11 +87,15 @@ CVCUDA_PUBLIC NVCVStatus cvcudaReformatCreate(NVCVOperatorHandle *handle);
  *       8bit  Signed   | Yes
  *       16bit Unsigned | Yes
  *       16bit Signed   | Yes
+ *       16bit Float    | Yes
  *       32bit Unsigned | No
  *       32bit Signed   | Yes
  *       32bit Float    | Yes
  *       64bit Float    | Yes
  *
+ *  The channel-blocked layout NCHWc, i.e. NC/xHWx such as NC4HW4, has shape [N, ceil(C/x), H, W, x] and can be
+ *  converted from or to NCHW and NHWC.  The last channel block is padded with zeros when C is not a multiple of x.
+ *
  *  Input/Output dependency
  *
  *       Property      |  Input == Output
@@ -112,6 +122,32 @@ CVCUDA_PUBLIC NVCVStatus cvcudaReformatCreate(NVCVOperatorHandle *handle);
 CVCUDA_PUBLIC NVCVStatus cvcudaReformatSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
                                               NVCVTensorHandle out);
 
+/** Executes the reformat operation, reordering the channels as they're moved.
+ *
+ * Output channel c is moved from the input channel selected by the c-th component of \p channelOrder, e.g.
+ * NVCV_SWIZZLE_ZYXW turns interleaved BGR into planar RGB in a single pass. Channels past the fourth of blocked
+ * layouts are kept in place. When both tensors have the same layout the channels are only reordered.
+ *
+ * Limitations are the same as \ref cvcudaReformatSubmit, both tensors must be cuda-accessible.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ * @param [in] in intput tensor.
+ * @param [out] out output tensor.
+ * @param [in] channelOrder Input channel of each output channel.
+ *                          + Its first components, one per channel, must be X, Y, Z or W selecting an existing
+ *                            channel.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_NOT_COMPATIBLE   Tensors are in host memory.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaReformatReorderSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                     NVCVTensorHandle in, NVCVTensorHandle out,
+                                                     NVCVSwizzle channelOrder);
+
 #ifdef __cplusplus
 }
 #endif
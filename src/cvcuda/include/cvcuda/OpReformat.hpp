@@ -44,6 +44,7 @@ public:
     ~Reformat();
 
     void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out);
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, NVCVSwizzle channelOrder);
 
     virtual NVCVOperatorHandle handle() const noexcept override;
 
@@ -68,6 +69,11 @@ inline void Reformat::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::I
     nvcv::detail::CheckThrow(cvcudaReformatSubmit(m_handle, stream, in.handle(), out.handle()));
 }
 
+inline void Reformat::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, NVCVSwizzle channelOrder)
+{
+    nvcv::detail::CheckThrow(cvcudaReformatReorderSubmit(m_handle, stream, in.handle(), out.handle(), channelOrder));
+}
+
 inline NVCVOperatorHandle Reformat::handle() const noexcept
 {
     return m_handle;
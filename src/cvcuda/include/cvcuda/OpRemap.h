@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpRemap.h
+ *
+ * @brief Defines types and functions to handle the remap operation.
+ * @defgroup NVCV_C_ALGORITHM_REMAP Remap
+ * @{
+ */
+
+#ifndef CVCUDA_REMAP_H
+#define CVCUDA_REMAP_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/BorderType.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the remap operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRemapCreate(NVCVOperatorHandle *handle);
+
+/** Executes the remap operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  Every output pixel `(x, y)` is read from the input at the location given by the map, i.e.
+ *  `out(x, y) = in(mapx(x, y), mapy(x, y))`, or `out(x, y) = in(x + mapx(x, y), y + mapy(x, y))` in relative
+ *  mode, with the given interpolation and border extrapolation. It is typically used with a fixed map, e.g. for
+ *  lens undistortion. The map is read by the kernel as is, so a map computed once can be reused by every call
+ *  without any copy, and a map with a single sample is applied to all samples of the batch.
+ *
+ *  Two map formats are supported:
+ *  - float32 with 2 channels `[x, y]`, 8 bytes per pixel;
+ *  - int16 with 3 channels `[x, y, frac]`, 6 bytes per pixel, where `x` and `y` are the integer parts of the
+ *    coordinates (rounded down) and `frac = fy * 32 + fx` holds their fractional parts in 1/32 of pixel,
+ *    `fx` and `fy` in [0, 32). This is the same precision as OpenCV's fixed-point maps.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | Yes
+ *       Data Type     | Yes
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | No
+ *       Height        | No
+ *
+ *  Map Tensor:
+ *
+ *       float32 with 2 channels or int16 with 3 channels, in NHWC or HWC layout, with the output width and
+ *       height, and either one sample or one sample per output sample.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *
+ * @param [out] out Output tensor.
+ *
+ * @param [in] map Map tensor.
+ *
+ * @param [in] interpolation Interpolation method, \ref NVCV_INTERP_NEAREST, \ref NVCV_INTERP_LINEAR or
+ *                           \ref NVCV_INTERP_CUBIC.
+ *
+ * @param [in] mapValueType Whether the map holds absolute source coordinates (\ref NVCV_REMAP_ABSOLUTE) or
+ *                          offsets to the output coordinates (\ref NVCV_REMAP_RELATIVE).
+ *
+ * @param [in] borderMode Pixel extrapolation method for source locations outside of the input.
+ *
+ * @param [in] borderValue Used in case of a constant border.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRemapSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                           NVCVTensorHandle out, NVCVTensorHandle map,
+                                           const NVCVInterpolationType interpolation,
+                                           const NVCVRemapMapValueType mapValueType,
+                                           const NVCVBorderType borderMode, const float4 borderValue);
+
+/** Executes the remap operation on a varshape batch, see \ref cvcudaRemapSubmit.
+ *
+ *  Input and output images must have the same format, and the map must be at least as large as the largest
+ *  output image. Each image reads the map at its own pixel coordinates, i.e. uses the top-left part of it.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRemapVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                   NVCVImageBatchHandle in, NVCVImageBatchHandle out,
+                                                   NVCVTensorHandle map, const NVCVInterpolationType interpolation,
+                                                   const NVCVRemapMapValueType mapValueType,
+                                                   const NVCVBorderType borderMode, const float4 borderValue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_REMAP_H */
@@ -31,6 +31,7 @@
 #include "detail/Export.h"
 
 #include <cuda_runtime.h>
+#include <nvcv/DataLayout.h>
 #include <nvcv/ImageBatch.h>
 #include <nvcv/Status.h>
 #include <nvcv/Tensor.h>
@@ -57,7 +58,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaResizeCreate(NVCVOperatorHandle *handle);
  *  Limitations:
  *
  *  Input:
- *       Data Layout:    [kNHWC, kHWC]
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *       Channels:       [1, 3, 4]
  *
  *       Data Type      | Allowed
@@ -72,7 +73,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaResizeCreate(NVCVOperatorHandle *handle);
  *       64bit Float    | No
  *
  *  Output:
- *       Data Layout:    [kNHWC, kHWC]
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *       Channels:       [1, 3, 4]
  *
  *       Data Type      | Allowed
@@ -85,18 +86,27 @@ CVCUDA_PUBLIC NVCVStatus cvcudaResizeCreate(NVCVOperatorHandle *handle);
  *       32bit Signed   | No
  *       32bit Float    | Yes
  *       64bit Float    | No
+ *       16bit Float    | Yes, tensors only
  *
  *  Input/Output dependency
  *
  *       Property      |  Input == Output
  *      -------------- | -------------
  *       Data Layout   | Yes
- *       Data Type     | Yes
+ *       Data Type     | Yes, except for half outputs
  *       Number        | Yes
  *       Channels      | Yes
  *       Width         | No
  *       Height        | No
  *
+ *  A tensor output may also be half-precision float, e.g. for FP16 inference: pixels are interpolated in float and
+ *  rounded to half once, without the rounding to the input type. Channels can't be reordered into it.
+ *
+ *  Image batches can also hold multi-plane 8-bit YUV images, e.g. NV12, NV21 or I420, with the same format in the
+ *  input and the output. They're resized plane by plane with nearest, linear or area interpolation, the chroma
+ *  planes being sampled at the chroma location of the color spec of the format so that they stay aligned with
+ *  luma. Downscaling them before the conversion to RGB saves converting the pixels that would be discarded.
+ *
  * @param [in] handle Handle to the operator.
  *                    + Must not be NULL.
  * @param [in] stream Handle to a valid CUDA stream.
@@ -120,6 +130,275 @@ CVCUDA_PUBLIC NVCVStatus cvcudaResizeVarShapeSubmit(NVCVOperatorHandle handle, c
                                                     const NVCVInterpolationType interpolation);
 /** @} */
 
+/** Executes the resize operation on a tensor, reordering the channels of each pixel as it's stored.
+ *
+ * Output channel c is interpolated from the input channel selected by the c-th component of \p channelOrder, e.g.
+ * NVCV_SWIZZLE_ZYXW turns BGR(A) into RGB(A) without an operator of its own. Unless the order keeps all channels
+ * in place, pixels are resized by the generic single pixel kernels.
+ *
+ * Limitations are the same as \ref cvcudaResizeSubmit.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ * @param [in] in input tensor.
+ * @param [out] out output tensor.
+ * @param [in] interpolation Interpolation method to be used, see \ref NVCVInterpolationType for more details.
+ * @param [in] channelOrder Input channel of each output channel.
+ *                          + Its first components, one per channel, must be X, Y, Z or W selecting an existing
+ *                            channel.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResizeReorderSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                   NVCVTensorHandle in, NVCVTensorHandle out,
+                                                   const NVCVInterpolationType interpolation, NVCVSwizzle channelOrder);
+
+/** Creates a plan to resize tensors with fixed requirements.
+ *
+ *  All validation and kernel selection is done once when the plan is created, so submitting it only launches the
+ *  resize kernel. Tensors passed to \ref cvcudaResizePlanSubmit must have the shapes and data type given here.
+ *  The plan is an operator on its own, and must be destroyed with \ref nvcvOperatorDestroy.
+ *
+ * @param [in] handle Handle to the resize operator.
+ *                    + Must not be NULL.
+ *
+ * @param [in] inReqs Requirements of the input tensors, e.g. from \ref nvcvTensorCalcRequirements.
+ *                    + Must not be NULL.
+ *
+ * @param [in] outReqs Requirements of the output tensors.
+ *                     + Must not be NULL.
+ *
+ * @param [in] interpolation Interpolation method to be used, see \ref NVCVInterpolationType for more details.
+ *
+ * @param [out] plan Where the plan handle will be written to.
+ *                   + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the plan.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResizePlanCreate(NVCVOperatorHandle handle, const NVCVTensorRequirements *inReqs,
+                                                const NVCVTensorRequirements *outReqs,
+                                                const NVCVInterpolationType interpolation, NVCVOperatorHandle *plan);
+
+/** Executes a resize plan on the given cuda stream. This operation does not wait for completion.
+ *
+ * @param [in] plan Handle to the plan created with \ref cvcudaResizePlanCreate.
+ *                  + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor, with the shape and data type of the plan's input requirements.
+ *
+ * @param [out] out output tensor, with the shape and data type of the plan's output requirements.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Tensors don't match the plan.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResizePlanSubmit(NVCVOperatorHandle plan, cudaStream_t stream, NVCVTensorHandle in,
+                                                NVCVTensorHandle out);
+
+/** Resizes the input tensor to several output tensors on the given cuda stream.
+ *  This operation does not wait for completion.
+ *
+ *  Outputs have independent sizes and interpolation methods, and are written together, up to 8 per kernel
+ *  launch, so that the input is mostly read from memory once instead of once per \ref cvcudaResizeSubmit call.
+ *  Each output is computed like a separate resize of the input; results may differ from \ref cvcudaResizeSubmit
+ *  in the last bit of floating point data, as that one picks different kernels depending on the scale.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor, with the same restrictions as in \ref cvcudaResizeSubmit.
+ *
+ * @param [out] out output tensors.
+ *                  + Must not be NULL.
+ *                  + Must have the same data type and number of samples as the input.
+ *
+ * @param [in] interpolation Interpolation method of each output, see \ref NVCVInterpolationType.
+ *                           + Must not be NULL.
+ *
+ * @param [in] numOutputs Number of output tensors.
+ *                        + Must be positive.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResizeMultiSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                                 const NVCVTensorHandle *out, const NVCVInterpolationType *interpolation,
+                                                 int32_t numOutputs);
+
+/** Resizes each image of the input batch with its own interpolation on the given cuda stream, in a single
+ *  launch.  This operation does not wait for completion.
+ *
+ *  Mixed batches, where some images are upscaled and others downscaled a lot, don't need to be split by
+ *  interpolation.  With \p antialias, images downscaled along both axes are resized with
+ *  #NVCV_INTERP_AREA whatever their interpolation, so that each output pixel averages its whole footprint in the
+ *  input, and the rest keeps the interpolation of its sample.
+ *
+ *  Restrictions are the same as in \ref cvcudaResizeVarShapeSubmit.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input image batch.
+ *
+ * @param [out] out output image batch, with as many images as the input.
+ *
+ * @param [in] interpolation Interpolation method of each image, see \ref NVCVInterpolationType.
+ *                           + Must be a cuda-accessible 32-bit signed integer tensor with shape [N], with N the
+ *                             number of images.
+ *                           + Its values must be #NVCV_INTERP_NEAREST, #NVCV_INTERP_LINEAR,
+ *                             #NVCV_INTERP_CUBIC or #NVCV_INTERP_AREA, others are resized with area.
+ *
+ * @param [in] antialias Whether images downscaled along both axes are resized with area.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResizeVarShapePerSampleSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                             NVCVImageBatchHandle in, NVCVImageBatchHandle out,
+                                                             NVCVTensorHandle interpolation, int8_t antialias);
+
+/** Resizes the images of the input batch to several output batches on the given cuda stream, see
+ *  \ref cvcudaResizeMultiSubmit.  This operation does not wait for completion.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input image batch, with the same restrictions as in \ref cvcudaResizeVarShapeSubmit.
+ *
+ * @param [out] out output image batches, each with as many images as the input.
+ *                  + Must not be NULL.
+ *
+ * @param [in] interpolation Interpolation method of each output, see \ref NVCVInterpolationType.
+ *                           + Must not be NULL.
+ *
+ * @param [in] numOutputs Number of output image batches.
+ *                        + Must be positive.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResizeVarShapeMultiSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                         NVCVImageBatchHandle in, const NVCVImageBatchHandle *out,
+                                                         const NVCVInterpolationType *interpolation,
+                                                         int32_t numOutputs);
+
+/** Resizes the input tensor to every level of an image pyramid on the given cuda stream.
+ *  This operation does not wait for completion.
+ *
+ *  Each level is resized from the input with the same interpolation, as in \ref cvcudaResizeMultiSubmit.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor, with the same restrictions as in \ref cvcudaResizeSubmit.
+ *
+ * @param [out] out output tensors, one per level.
+ *                  + Must not be NULL.
+ *                  + Must have the same data type and number of samples as the input.
+ *
+ * @param [in] numLevels Number of levels, i.e. of output tensors.
+ *                       + Must be positive.
+ *
+ * @param [in] interpolation Interpolation method to be used, see \ref NVCVInterpolationType for more details.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResizePyramidSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                   NVCVTensorHandle in, const NVCVTensorHandle *out,
+                                                   int32_t numLevels, const NVCVInterpolationType interpolation);
+
+/** Resizes tensors given by their exported data on the given cuda stream.
+ *  This operation does not wait for completion.
+ *
+ *  Same as \ref cvcudaResizeSubmit, for callers that already hold the tensors' data, e.g. from
+ *  \ref nvcvTensorExportData, or that wrap their own device buffers.  Tensor handles aren't looked up nor their
+ *  data exported again, which matters for small images where the call overhead is comparable to the kernel time.
+ *  The caller must keep the buffers alive until the operation completes.
+ *  Argument validation doesn't raise any exception internally, errors are reported by the returned status only.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor data, with the same restrictions as in \ref cvcudaResizeSubmit.
+ *                + Must not be NULL.
+ *                + Buffer type must be \ref NVCV_TENSOR_BUFFER_STRIDED_CUDA.
+ *
+ * @param [out] out output tensor data.
+ *                  + Must not be NULL.
+ *                  + Buffer type must be \ref NVCV_TENSOR_BUFFER_STRIDED_CUDA.
+ *
+ * @param [in] interpolation Interpolation method to be used, see \ref NVCVInterpolationType for more details.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResizeDataSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                const NVCVTensorData *in, const NVCVTensorData *out,
+                                                const NVCVInterpolationType interpolation);
+
+/** Executes a resize plan on tensors given by their exported data, see \ref cvcudaResizeDataSubmit.
+ *  This operation does not wait for completion.
+ *
+ * @param [in] plan Handle to the plan created with \ref cvcudaResizePlanCreate.
+ *                  + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor data, with the shape and data type of the plan's input requirements.
+ *                + Must not be NULL.
+ *                + Buffer type must be \ref NVCV_TENSOR_BUFFER_STRIDED_CUDA.
+ *
+ * @param [out] out output tensor data, with the shape and data type of the plan's output requirements.
+ *                  + Must not be NULL.
+ *                  + Buffer type must be \ref NVCV_TENSOR_BUFFER_STRIDED_CUDA.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Tensors don't match the plan.
+ * @retval #NVCV_ERROR_NOT_COMPATIBLE   Handle isn't a resize plan.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResizePlanDataSubmit(NVCVOperatorHandle plan, cudaStream_t stream,
+                                                    const NVCVTensorData *in, const NVCVTensorData *out);
+
+/** Predicts the cost of resizing tensors with the given requirements on the current device.
+ *
+ *  The configuration is validated as in \ref cvcudaResizePlanCreate, nothing is launched nor allocated.
+ *  If the configuration was autotuned on the current GPU model, the time measured then is returned, otherwise
+ *  the time is modeled from the bytes moved and the device's memory bandwidth, within the launch budget.
+ *  Estimates are meant to compare configurations and to schedule work, not as exact timings.
+ *
+ * @param [in] inReqs Requirements of the input tensors, e.g. from \ref nvcvTensorCalcRequirements.
+ *                    + Must not be NULL.
+ *
+ * @param [in] outReqs Requirements of the output tensors.
+ *                     + Must not be NULL.
+ *
+ * @param [in] interpolation Interpolation method to be used, see \ref NVCVInterpolationType for more details.
+ *
+ * @param [out] estimate Where the estimate will be written to.
+ *                       + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResizeEstimate(const NVCVTensorRequirements *inReqs,
+                                              const NVCVTensorRequirements *outReqs,
+                                              const NVCVInterpolationType interpolation, NVCVOperatorEstimate *estimate);
+
 #ifdef __cplusplus
 }
 #endif
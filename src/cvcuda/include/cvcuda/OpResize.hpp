@@ -32,23 +32,116 @@
 #include <cuda_runtime.h>
 #include <nvcv/IImageBatch.hpp>
 #include <nvcv/ITensor.hpp>
+#include <nvcv/ITensorData.hpp>
 #include <nvcv/ImageFormat.hpp>
+#include <nvcv/Tensor.hpp>
 #include <nvcv/alloc/Requirements.hpp>
 
+#include <new>
+#include <vector>
+
 namespace cvcuda {
 
 class Resize final : public IOperator
 {
 public:
+    /**
+     * Resize of tensors with fixed shapes and data type, all validation done once at creation.
+     */
+    class Plan final : public IOperator
+    {
+    public:
+        Plan(Plan &&that);
+        ~Plan();
+
+        Plan(const Plan &)            = delete;
+        Plan &operator=(const Plan &) = delete;
+
+        void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out);
+        void operator()(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                        const nvcv::ITensorDataStridedCuda &out);
+
+        /**
+         * Non-throwing variants, the status is returned as is by the C API, see \ref Resize::operator()().
+         */
+        nvcv::Status operator()(std::nothrow_t, cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out) noexcept;
+        nvcv::Status operator()(std::nothrow_t, cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                                const nvcv::ITensorDataStridedCuda &out) noexcept;
+
+        virtual NVCVOperatorHandle handle() const noexcept override;
+
+    private:
+        friend class Resize;
+        explicit Plan(NVCVOperatorHandle handle);
+
+        NVCVOperatorHandle m_handle;
+    };
+
     explicit Resize();
 
     ~Resize();
 
+    Plan plan(const nvcv::Tensor::Requirements &inReqs, const nvcv::Tensor::Requirements &outReqs,
+              const NVCVInterpolationType interpolation) const;
+
+    static NVCVOperatorEstimate estimate(const nvcv::Tensor::Requirements &inReqs,
+                                         const nvcv::Tensor::Requirements &outReqs,
+                                         const NVCVInterpolationType       interpolation);
+
     void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out,
                     const NVCVInterpolationType interpolation);
     void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
                     const NVCVInterpolationType interpolation);
 
+    /**
+     * Resize with the channels reordered, see \ref cvcudaResizeReorderSubmit.
+     */
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out,
+                    const NVCVInterpolationType interpolation, NVCVSwizzle channelOrder);
+
+    /**
+     * Resize of already exported tensor data, e.g. kept from a previous \ref nvcv::ITensor::exportData call,
+     * skipping the per-call tensor handle lookups, see \ref cvcudaResizeDataSubmit.
+     */
+    void operator()(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                    const nvcv::ITensorDataStridedCuda &out, const NVCVInterpolationType interpolation);
+
+    /**
+     * Non-throwing variants for latency-critical code, called as `resize(std::nothrow, stream, ...)`.
+     *
+     * The status of the C API is returned as is, in case of error its message can be retrieved with
+     * \ref nvcvGetLastErrorMessage. The tensor data submission validates its arguments without raising any
+     * exception internally either.
+     */
+    nvcv::Status operator()(std::nothrow_t, cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out,
+                            const NVCVInterpolationType interpolation) noexcept;
+    nvcv::Status operator()(std::nothrow_t, cudaStream_t stream, nvcv::IImageBatchVarShape &in,
+                            nvcv::IImageBatchVarShape &out, const NVCVInterpolationType interpolation) noexcept;
+    nvcv::Status operator()(std::nothrow_t, cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                            const nvcv::ITensorDataStridedCuda &out,
+                            const NVCVInterpolationType interpolation) noexcept;
+
+    /**
+     * Resize \p in to the \p numOutputs tensors in \p out, each with its interpolation, in one pass over the
+     * input, see \ref cvcudaResizeMultiSubmit.
+     */
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor *const *out,
+                    const NVCVInterpolationType *interpolation, int32_t numOutputs);
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape *const *out,
+                    const NVCVInterpolationType *interpolation, int32_t numOutputs);
+
+    /**
+     * Resize each image of \p in with the interpolation of its sample, see \ref cvcudaResizeVarShapePerSampleSubmit.
+     */
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
+                    nvcv::ITensor &interpolation, bool antialias);
+
+    /**
+     * Resize \p in to each of the \p numLevels tensors in \p out, see \ref cvcudaResizePyramidSubmit.
+     */
+    void pyramid(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor *const *out, int32_t numLevels,
+                 const NVCVInterpolationType interpolation);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -73,17 +166,162 @@ inline void Resize::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITe
     nvcv::detail::CheckThrow(cvcudaResizeSubmit(m_handle, stream, in.handle(), out.handle(), interpolation));
 }
 
+inline void Resize::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out,
+                               const NVCVInterpolationType interpolation, NVCVSwizzle channelOrder)
+{
+    nvcv::detail::CheckThrow(
+        cvcudaResizeReorderSubmit(m_handle, stream, in.handle(), out.handle(), interpolation, channelOrder));
+}
+
 inline void Resize::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
                                const NVCVInterpolationType interpolation)
 {
     nvcv::detail::CheckThrow(cvcudaResizeVarShapeSubmit(m_handle, stream, in.handle(), out.handle(), interpolation));
 }
 
+inline void Resize::operator()(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                               const nvcv::ITensorDataStridedCuda &out, const NVCVInterpolationType interpolation)
+{
+    nvcv::detail::CheckThrow(cvcudaResizeDataSubmit(m_handle, stream, &in.cdata(), &out.cdata(), interpolation));
+}
+
+inline nvcv::Status Resize::operator()(std::nothrow_t, cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out,
+                                       const NVCVInterpolationType interpolation) noexcept
+{
+    return static_cast<nvcv::Status>(cvcudaResizeSubmit(m_handle, stream, in.handle(), out.handle(), interpolation));
+}
+
+inline nvcv::Status Resize::operator()(std::nothrow_t, cudaStream_t stream, nvcv::IImageBatchVarShape &in,
+                                       nvcv::IImageBatchVarShape &out,
+                                       const NVCVInterpolationType interpolation) noexcept
+{
+    return static_cast<nvcv::Status>(
+        cvcudaResizeVarShapeSubmit(m_handle, stream, in.handle(), out.handle(), interpolation));
+}
+
+inline nvcv::Status Resize::operator()(std::nothrow_t, cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                                       const nvcv::ITensorDataStridedCuda &out,
+                                       const NVCVInterpolationType interpolation) noexcept
+{
+    return static_cast<nvcv::Status>(
+        cvcudaResizeDataSubmit(m_handle, stream, &in.cdata(), &out.cdata(), interpolation));
+}
+
+inline void Resize::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor *const *out,
+                               const NVCVInterpolationType *interpolation, int32_t numOutputs)
+{
+    std::vector<NVCVTensorHandle> outHandles;
+    for (int32_t o = 0; o < numOutputs; ++o)
+    {
+        outHandles.push_back(out[o]->handle());
+    }
+    nvcv::detail::CheckThrow(
+        cvcudaResizeMultiSubmit(m_handle, stream, in.handle(), outHandles.data(), interpolation, numOutputs));
+}
+
+inline void Resize::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in,
+                               nvcv::IImageBatchVarShape *const *out, const NVCVInterpolationType *interpolation,
+                               int32_t numOutputs)
+{
+    std::vector<NVCVImageBatchHandle> outHandles;
+    for (int32_t o = 0; o < numOutputs; ++o)
+    {
+        outHandles.push_back(out[o]->handle());
+    }
+    nvcv::detail::CheckThrow(
+        cvcudaResizeVarShapeMultiSubmit(m_handle, stream, in.handle(), outHandles.data(), interpolation, numOutputs));
+}
+
+inline void Resize::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
+                               nvcv::ITensor &interpolation, bool antialias)
+{
+    nvcv::detail::CheckThrow(cvcudaResizeVarShapePerSampleSubmit(m_handle, stream, in.handle(), out.handle(),
+                                                                 interpolation.handle(), antialias));
+}
+
+inline void Resize::pyramid(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor *const *out, int32_t numLevels,
+                            const NVCVInterpolationType interpolation)
+{
+    std::vector<NVCVTensorHandle> outHandles;
+    for (int32_t l = 0; l < numLevels; ++l)
+    {
+        outHandles.push_back(out[l]->handle());
+    }
+    nvcv::detail::CheckThrow(cvcudaResizePyramidSubmit(m_handle, stream, in.handle(), outHandles.data(), numLevels,
+                                                       interpolation));
+}
+
 inline NVCVOperatorHandle Resize::handle() const noexcept
 {
     return m_handle;
 }
 
+inline auto Resize::plan(const nvcv::Tensor::Requirements &inReqs, const nvcv::Tensor::Requirements &outReqs,
+                         const NVCVInterpolationType interpolation) const -> Plan
+{
+    NVCVOperatorHandle plan;
+    nvcv::detail::CheckThrow(cvcudaResizePlanCreate(m_handle, &inReqs, &outReqs, interpolation, &plan));
+    return Plan(plan);
+}
+
+inline NVCVOperatorEstimate Resize::estimate(const nvcv::Tensor::Requirements &inReqs,
+                                             const nvcv::Tensor::Requirements &outReqs,
+                                             const NVCVInterpolationType       interpolation)
+{
+    NVCVOperatorEstimate estimate;
+    nvcv::detail::CheckThrow(cvcudaResizeEstimate(&inReqs, &outReqs, interpolation, &estimate));
+    return estimate;
+}
+
+inline Resize::Plan::Plan(NVCVOperatorHandle handle)
+    : m_handle(handle)
+{
+    assert(m_handle);
+}
+
+inline Resize::Plan::Plan(Plan &&that)
+    : m_handle(that.m_handle)
+{
+    that.m_handle = nullptr;
+}
+
+inline Resize::Plan::~Plan()
+{
+    if (m_handle != nullptr)
+    {
+        nvcvOperatorDestroy(m_handle);
+    }
+}
+
+inline void Resize::Plan::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out)
+{
+    nvcv::detail::CheckThrow(cvcudaResizePlanSubmit(m_handle, stream, in.handle(), out.handle()));
+}
+
+inline void Resize::Plan::operator()(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                                     const nvcv::ITensorDataStridedCuda &out)
+{
+    nvcv::detail::CheckThrow(cvcudaResizePlanDataSubmit(m_handle, stream, &in.cdata(), &out.cdata()));
+}
+
+inline nvcv::Status Resize::Plan::operator()(std::nothrow_t, cudaStream_t stream, nvcv::ITensor &in,
+                                             nvcv::ITensor &out) noexcept
+{
+    return static_cast<nvcv::Status>(cvcudaResizePlanSubmit(m_handle, stream, in.handle(), out.handle()));
+}
+
+inline nvcv::Status Resize::Plan::operator()(std::nothrow_t, cudaStream_t stream,
+                                             const nvcv::ITensorDataStridedCuda &in,
+                                             const nvcv::ITensorDataStridedCuda &out) noexcept
+{
+    return static_cast<nvcv::Status>(cvcudaResizePlanDataSubmit(m_handle, stream, &in.cdata(), &out.cdata()));
+}
+
+inline NVCVOperatorHandle Resize::Plan::handle() const noexcept
+{
+    return m_handle;
+}
+
 } // namespace cvcuda
 
 #endif // CVCUDA_RESIZE_HPP
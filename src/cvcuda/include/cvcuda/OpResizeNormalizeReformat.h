@@ -0,0 +1,281 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpResizeNormalizeReformat.h
+ *
+ * @brief Defines types and functions to handle the fused resize, normalize and reformat operation.
+ * @defgroup NVCV_C_ALGORITHM_RESIZE_NORMALIZE_REFORMAT Resize Normalize Reformat
+ * @{
+ */
+
+#ifndef CVCUDA_RESIZE_NORMALIZE_REFORMAT_H
+#define CVCUDA_RESIZE_NORMALIZE_REFORMAT_H
+
+#include "OpNormalize.h" // for CVCUDA_NORMALIZE_SCALE_IS_STDDEV
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Rect.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// @brief Flag to be used by resize normalize reformat operation to swap the first and third channels, i.e. RGB <-> BGR.
+#define CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB (1 << 1)
+
+/** Constructs an instance of the resize normalize reformat operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResizeNormalizeReformatCreate(NVCVOperatorHandle *handle);
+
+/** Executes the resize normalize reformat operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  It's equivalent to executing \ref cvcudaResizeSubmit, \ref cvcudaConvertToSubmit to float,
+ *  \ref cvcudaNormalizeSubmit and \ref cvcudaReformatSubmit to NCHW in sequence, but input is read only
+ *  once and no intermediate tensors are needed. Resized values aren't rounded to 8-bit before normalization,
+ *  so results can differ slightly from the chained operators. The normalization follows the formula:
+ *  ```
+ *  out[n,c,y,x] = (resized[n,y,x,c'] - base[param_idx]) * scale[param_idx] * global_scale + shift
+ *  ```
+ *  Where `c'` is `c` with the first and third channels swapped if \p CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB
+ *  is set, or `c` itself otherwise. `param_idx` is `[n,c]`, where `n` is 0 if the parameter has only one
+ *  sample and `c` is 0 if it has only one channel. That is, parameters refer to output channels.
+ *
+ *  To normalize [0,1] ranged data, as when converting to float with `alpha=1/255`,
+ *  pass base multiplied by 255 and `global_scale = 1/255`.
+ *
+ *  The output is either float, or 8-bit signed or unsigned for networks with quantized inputs, in which case the
+ *  normalized values are rounded and saturated, at a quarter of the memory traffic of float. A scale `qs` and zero
+ *  point `zp` are folded into the parameters: for `q = round(v / qs) + zp`, pass `global_scale / qs` and
+ *  `shift / qs + zp`. Per-channel scales go in the scale tensor, and per-channel zero points in base, as
+ *  `base[c] - zp[c] / m[c]` where `m[c]` multiplies `(resized - base[c])`.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNCHW]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | Yes
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | No
+ *       Height        | No
+ *
+ *  Scale/Base Tensor:
+ *
+ *       32-bit float tensors with shape [1,1,1,1], [1,1,1,C], [N,1,1,1] or [N,1,1,C],
+ *       where N and C are the output number of samples and channels.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor / image batch. Images in the batch can have different sizes, but must have the same format.
+ *
+ * @param [in] base Base tensor.
+ *
+ * @param [in] scale Scale tensor.
+ *
+ * @param [out] out Output tensor, all samples are resized to its width and height.
+ *
+ * @param [in] interpolation Interpolation method to be used, either \ref NVCV_INTERP_NEAREST or \ref NVCV_INTERP_LINEAR.
+ *
+ * @param [in] global_scale Additional scale value to be used in addition to scale.
+ *
+ * @param [in] shift Additional bias value to be used in addition to base.
+ *
+ * @param [in] epsilon Epsilon to use when \p CVCUDA_NORMALIZE_SCALE_IS_STDDEV flag is set as a regularizing term to be
+ *                     added to variance.
+ *
+ * @param [in] flags Algorithm flags, a combination of \p CVCUDA_NORMALIZE_SCALE_IS_STDDEV, if scale passed as
+ *                   argument is standard deviation, and \p CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+/** @{ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResizeNormalizeReformatSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                             NVCVTensorHandle in, NVCVTensorHandle base,
+                                                             NVCVTensorHandle scale, NVCVTensorHandle out,
+                                                             const NVCVInterpolationType interpolation,
+                                                             float global_scale, float shift, float epsilon,
+                                                             uint32_t flags);
+
+CVCUDA_PUBLIC NVCVStatus cvcudaResizeNormalizeReformatVarShapeSubmit(
+    NVCVOperatorHandle handle, cudaStream_t stream, NVCVImageBatchHandle in, NVCVTensorHandle base,
+    NVCVTensorHandle scale, NVCVTensorHandle out, const NVCVInterpolationType interpolation, float global_scale,
+    float shift, float epsilon, uint32_t flags);
+/** @} */
+
+/** Executes the resize normalize reformat operation on YUV 4:2:0 semi-planar frames, on the given cuda stream.
+ *  This operation does not wait for completion.
+ *
+ *  Frames are given by their luma and interleaved chroma planes, so that NV12 and P016 surfaces output by NVDEC
+ *  can be wrapped as tensors, e.g. with \ref nvcvTensorWrapDataConstruct, and processed in place. First the
+ *  region of interest is cropped out of each frame and converted to RGB or BGR as in \ref cvcudaCvtColorSubmit.
+ *  Then it's resized, normalized and written as float32 or quantized 8-bit planes as in
+ *  \ref cvcudaResizeNormalizeReformatSubmit, all in a single pass. Converted and resized values aren't rounded
+ *  to 8-bit. 16-bit samples are divided by 256 for the conversion, so that base and scale refer to the 8-bit
+ *  range for both NV12 and P016.
+ *
+ *  Limitations:
+ *
+ *  Luma/Chroma:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       luma: [1], chroma: [1, 2]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes (NV12)
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes (P016)
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *       Luma is [N,H,W,1] with even H and W. Chroma is [N,H/2,W/2,2], or [N,H/2,W,1] as in the bottom part
+ *       of the packed NV12 tensors used by \ref cvcudaCvtColorSubmit, with the same data type as luma. The
+ *       planes can have any row and sample stride.
+ *
+ *  Output:
+ *       Data Layout:    [kNCHW]
+ *       Channels:       [3]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | Yes
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | No
+ *       Width         | No
+ *       Height        | No
+ *
+ *  Scale/Base Tensor:
+ *
+ *       32-bit float tensors with shape [1,1,1,1], [1,1,1,3], [N,1,1,1] or [N,1,1,3].
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] luma Luma plane tensor.
+ *
+ * @param [in] chroma Interleaved chroma plane tensor.
+ *
+ * @param [in] roi Region of the frames to be resized, in luma pixels. The same region is used for all samples.
+ *                 + It must lie inside the frames.
+ *                 + If NULL, or with zero width and height, whole frames are resized.
+ *
+ * @param [in] base Base tensor.
+ *
+ * @param [in] scale Scale tensor.
+ *
+ * @param [out] out Output tensor, all regions are resized to its width and height.
+ *
+ * @param [in] code Color conversion, one of \ref NVCV_COLOR_YUV2RGB_NV12, \ref NVCV_COLOR_YUV2BGR_NV12,
+ *                  \ref NVCV_COLOR_YUV2RGB_NV21 or \ref NVCV_COLOR_YUV2BGR_NV21. P016 frames use the NV12 codes.
+ *
+ * @param [in] interpolation Interpolation method to be used, either \ref NVCV_INTERP_NEAREST or \ref NVCV_INTERP_LINEAR.
+ *
+ * @param [in] global_scale Additional scale value to be used in addition to scale.
+ *
+ * @param [in] shift Additional bias value to be used in addition to base.
+ *
+ * @param [in] epsilon Epsilon to use when \p CVCUDA_NORMALIZE_SCALE_IS_STDDEV flag is set as a regularizing term to be
+ *                     added to variance.
+ *
+ * @param [in] flags Algorithm flags, as in \ref cvcudaResizeNormalizeReformatSubmit.
+ *                   \p CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB swaps the channel order given by \p code.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResizeNormalizeReformatNV12Submit(
+    NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle luma, NVCVTensorHandle chroma,
+    const NVCVRectI *roi, NVCVTensorHandle base, NVCVTensorHandle scale, NVCVTensorHandle out,
+    const NVCVColorConversionCode code, const NVCVInterpolationType interpolation, float global_scale, float shift,
+    float epsilon, uint32_t flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_RESIZE_NORMALIZE_REFORMAT_H */
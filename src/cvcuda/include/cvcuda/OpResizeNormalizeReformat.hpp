@@ -0,0 +1,116 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpResizeNormalizeReformat.hpp
+ *
+ * @brief Defines the public C++ Class for the fused resize normalize reformat operation.
+ * @defgroup NVCV_CPP_ALGORITHM_RESIZE_NORMALIZE_REFORMAT Resize Normalize Reformat
+ * @{
+ */
+
+#ifndef CVCUDA_RESIZE_NORMALIZE_REFORMAT_HPP
+#define CVCUDA_RESIZE_NORMALIZE_REFORMAT_HPP
+
+#include "IOperator.hpp"
+#include "OpResizeNormalizeReformat.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class ResizeNormalizeReformat final : public IOperator
+{
+public:
+    explicit ResizeNormalizeReformat();
+
+    ~ResizeNormalizeReformat();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &base, nvcv::ITensor &scale,
+                    nvcv::ITensor &out, const NVCVInterpolationType interpolation, float global_scale, float shift,
+                    float epsilon, uint32_t flags = 0);
+
+    void operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::ITensor &base, nvcv::ITensor &scale,
+                    nvcv::ITensor &out, const NVCVInterpolationType interpolation, float global_scale, float shift,
+                    float epsilon, uint32_t flags = 0);
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &luma, nvcv::ITensor &chroma, const NVCVRectI *roi,
+                    nvcv::ITensor &base, nvcv::ITensor &scale, nvcv::ITensor &out, const NVCVColorConversionCode code,
+                    const NVCVInterpolationType interpolation, float global_scale, float shift, float epsilon,
+                    uint32_t flags = 0);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline ResizeNormalizeReformat::ResizeNormalizeReformat()
+{
+    nvcv::detail::CheckThrow(cvcudaResizeNormalizeReformatCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline ResizeNormalizeReformat::~ResizeNormalizeReformat()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void ResizeNormalizeReformat::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &base,
+                                                nvcv::ITensor &scale, nvcv::ITensor &out,
+                                                const NVCVInterpolationType interpolation, float global_scale,
+                                                float shift, float epsilon, uint32_t flags)
+{
+    nvcv::detail::CheckThrow(cvcudaResizeNormalizeReformatSubmit(m_handle, stream, in.handle(), base.handle(),
+                                                                 scale.handle(), out.handle(), interpolation,
+                                                                 global_scale, shift, epsilon, flags));
+}
+
+inline void ResizeNormalizeReformat::operator()(cudaStream_t stream, nvcv::IImageBatch &in, nvcv::ITensor &base,
+                                                nvcv::ITensor &scale, nvcv::ITensor &out,
+                                                const NVCVInterpolationType interpolation, float global_scale,
+                                                float shift, float epsilon, uint32_t flags)
+{
+    nvcv::detail::CheckThrow(cvcudaResizeNormalizeReformatVarShapeSubmit(m_handle, stream, in.handle(), base.handle(),
+                                                                         scale.handle(), out.handle(), interpolation,
+                                                                         global_scale, shift, epsilon, flags));
+}
+
+inline void ResizeNormalizeReformat::operator()(cudaStream_t stream, nvcv::ITensor &luma, nvcv::ITensor &chroma,
+                                                const NVCVRectI *roi, nvcv::ITensor &base, nvcv::ITensor &scale,
+                                                nvcv::ITensor &out, const NVCVColorConversionCode code,
+                                                const NVCVInterpolationType interpolation, float global_scale,
+                                                float shift, float epsilon, uint32_t flags)
+{
+    nvcv::detail::CheckThrow(cvcudaResizeNormalizeReformatNV12Submit(
+        m_handle, stream, luma.handle(), chroma.handle(), roi, base.handle(), scale.handle(), out.handle(), code,
+        interpolation, global_scale, shift, epsilon, flags));
+}
+
+inline NVCVOperatorHandle ResizeNormalizeReformat::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_RESIZE_NORMALIZE_REFORMAT_HPP
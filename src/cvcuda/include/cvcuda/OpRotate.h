@@ -53,6 +53,27 @@ extern "C"
  */
 CVCUDA_PUBLIC NVCVStatus cvcudaRotateCreate(NVCVOperatorHandle *handle, const int32_t maxVarShapeBatchSize);
 
+/** Constructs an instance of the rotate operator with a given coordinate precision.
+ *
+ * The source coordinates of each output pixel are computed in float or double precision.  The float path
+ * differs from the double path by at most a few float ulps of the coordinates, and is much faster on GPUs with
+ * low FP64 throughput.  With #NVCV_COORD_PRECISION_DEFAULT, which is what \ref cvcudaRotateCreate uses, float
+ * is chosen when the current device's FP32 to FP64 throughput ratio is larger than 2.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @param [in] maxVarShapeBatchSize maximum batch size for var shape operator
+ *
+ * @param [in] precision precision of the coordinate math, see \ref NVCVCoordinatePrecision.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or precision is invalid.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRotateCreateWithPrecision(NVCVOperatorHandle *handle, const int32_t maxVarShapeBatchSize,
+                                                         const NVCVCoordinatePrecision precision);
+
 /** Executes the rotate operation on the given cuda stream. This operation does not
  *  wait for completion.
  *
@@ -108,6 +129,10 @@ CVCUDA_PUBLIC NVCVStatus cvcudaRotateCreate(NVCVOperatorHandle *handle, const in
  *       NVCV_INTERP_CUBIC    | Yes
  *       NVCV_INTERP_AREA     | No
  *
+ *  Tensor rotations by a multiple of 90 degrees with an integer shift move whole pixels. They run as an exact copy
+ *  or tiled transpose whatever the interpolation, and the output can have the transposed size of the input, e.g.
+ *  to fix the EXIF orientation of non-square images.
+ *
  * @param [in] handle Handle to the operator.
  *                    + Must not be NULL.
  * @param [in] stream Handle to a valid CUDA stream.
@@ -137,6 +162,37 @@ CVCUDA_PUBLIC NVCVStatus cvcudaRotateVarShapeSubmit(NVCVOperatorHandle handle, c
                                                     const NVCVInterpolationType interpolation);
 /** @} */
 
+/** Executes the rotate operation on a varshape image batch, with the per-sample parameters given on the host.
+ *
+ *  Same as \ref cvcudaRotateVarShapeSubmit, but the parameters are passed to the kernels by value, so small batches
+ *  need neither device tensors for them nor any copy. The arrays can be reused as soon as the call returns.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input image batch.
+ *                + Must have at most #CVCUDA_MAX_HOST_PARAM_SAMPLES images.
+ *
+ * @param [out] out output image batch.
+ *
+ * @param [in] angleDeg host array with the angle of rotation of each image, in degrees.
+ *                      + Must not be NULL.
+ *
+ * @param [in] shift host array with the {x, y} shift of each image.
+ *                   + Must not be NULL.
+ *
+ * @param [in] interpolation Interpolation method to be used, see \ref NVCVInterpolationType for more details.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaRotateVarShapeSubmitHostParams(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                              NVCVImageBatchHandle in, NVCVImageBatchHandle out,
+                                                              const double *angleDeg, const double2 *shift,
+                                                              const NVCVInterpolationType interpolation);
+
 #ifdef __cplusplus
 }
 #endif
@@ -42,6 +42,8 @@ class Rotate final : public IOperator
 public:
     explicit Rotate(const int maxVarShapeBatchSize);
 
+    Rotate(const int maxVarShapeBatchSize, NVCVCoordinatePrecision precision);
+
     ~Rotate();
 
     void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, const double angleDeg,
@@ -50,6 +52,9 @@ public:
     void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
                     nvcv::ITensor &angleDeg, nvcv::ITensor &shift, const NVCVInterpolationType interpolation);
 
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
+                    const double *angleDeg, const double2 *shift, const NVCVInterpolationType interpolation);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -62,6 +67,12 @@ inline Rotate::Rotate(const int maxVarShapeBatchSize)
     assert(m_handle);
 }
 
+inline Rotate::Rotate(const int maxVarShapeBatchSize, NVCVCoordinatePrecision precision)
+{
+    nvcv::detail::CheckThrow(cvcudaRotateCreateWithPrecision(&m_handle, maxVarShapeBatchSize, precision));
+    assert(m_handle);
+}
+
 inline Rotate::~Rotate()
 {
     nvcvOperatorDestroy(m_handle);
@@ -82,6 +93,13 @@ inline void Rotate::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &i
                                                         shift.handle(), interpolation));
 }
 
+inline void Rotate::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
+                               const double *angleDeg, const double2 *shift, const NVCVInterpolationType interpolation)
+{
+    nvcv::detail::CheckThrow(cvcudaRotateVarShapeSubmitHostParams(m_handle, stream, in.handle(), out.handle(),
+                                                                  angleDeg, shift, interpolation));
+}
+
 inline NVCVOperatorHandle Rotate::handle() const noexcept
 {
     return m_handle;
@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpSSIM.h
+ *
+ * @brief Defines types and functions to handle the structural similarity operation.
+ * @defgroup NVCV_C_ALGORITHM_SSIM SSIM
+ * @{
+ */
+
+#ifndef CVCUDA_SSIM_H
+#define CVCUDA_SSIM_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the structural similarity operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSSIMCreate(NVCVOperatorHandle *handle);
+
+/** Executes the structural similarity operation on the given cuda stream. This operation does not wait for completion.
+ *
+ *  Computes the mean structural similarity index (SSIM) of every sample of the input against the same sample
+ *  of the reference, as in the reference implementation of Wang et al.: local means, variances and covariance are
+ *  computed with an 11x11 Gaussian window of standard deviation 1.5, with stabilizing constants (0.01 * maxValue)^2
+ *  and (0.03 * maxValue)^2, and the SSIM map is averaged over the windows inside the image. The score of all
+ *  channels together is the mean of their scores.
+ *
+ *  The Gaussian window is separable, both filters and the mean are fused in a single launch for all samples, so
+ *  the SSIM map is never stored. Scores are computed in a fixed order, so they don't change from one run to the
+ *  next.
+ *
+ *  Limitations:
+ *
+ *  Input and reference:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, input channels]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | No
+ *       Data Type     | No
+ *       Number        | Yes
+ *       Channels      | Yes, or 1 to score all channels together
+ *       Width         | No, 1
+ *       Height        | No, 1
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in Input tensor.
+ *                + Images must have at least 11x11 pixels.
+ *
+ * @param [in] ref Reference tensor, with the shape and data type of the input.
+ *
+ * @param [out] out Output tensor, with one score per sample, and per channel when it has the input channels.
+ *
+ * @param [in] maxValue Peak value of the images, or 0 to use the range of the data type: 255 for uint8, 65535 for
+ *                      uint16, 32767 for int16 and 1 for float32.
+ *                      + Must not be negative.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSSIMSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                          NVCVTensorHandle ref, NVCVTensorHandle out, float maxValue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_SSIM_H */
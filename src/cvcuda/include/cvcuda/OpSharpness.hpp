@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpSharpness.hpp
+ *
+ * @brief Defines the public C++ Class for the sharpness operation.
+ * @defgroup NVCV_CPP_ALGORITHM_SHARPNESS Sharpness
+ * @{
+ */
+
+#ifndef CVCUDA_SHARPNESS_HPP
+#define CVCUDA_SHARPNESS_HPP
+
+#include "IOperator.hpp"
+#include "OpSharpness.h"
+#include "Types.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class Sharpness final : public IOperator
+{
+public:
+    explicit Sharpness();
+
+    ~Sharpness();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, int32_t ksize,
+                    NVCVBorderType borderMode);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline Sharpness::Sharpness()
+{
+    nvcv::detail::CheckThrow(cvcudaSharpnessCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline Sharpness::~Sharpness()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void Sharpness::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out, int32_t ksize,
+                                  NVCVBorderType borderMode)
+{
+    nvcv::detail::CheckThrow(cvcudaSharpnessSubmit(m_handle, stream, in.handle(), out.handle(), ksize, borderMode));
+}
+
+inline NVCVOperatorHandle Sharpness::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_SHARPNESS_HPP
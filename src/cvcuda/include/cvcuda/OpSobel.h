@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpSobel.h
+ *
+ * @brief Defines types and functions to handle the sobel operation.
+ * @defgroup NVCV_C_ALGORITHM_SOBEL Sobel
+ * @{
+ */
+
+#ifndef CVCUDA_SOBEL_H
+#define CVCUDA_SOBEL_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/BorderType.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the sobel operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSobelCreate(NVCVOperatorHandle *handle);
+
+/** Executes the sobel operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  Computes the first x and y derivatives of each channel of the input with the Sobel filters of OpenCV, or the
+ *  Scharr filters for a ksize of -1, together with the L2 norm of the gradient, sqrt(dx*dx + dy*dy). Each output
+ *  is optional, and all the requested ones are computed in a single pass over the input.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | Yes
+ *       Data Type     | No, all outputs have the same data type
+ *       Number        | Yes
+ *       Channels      | Yes
+ *       Width         | Yes
+ *       Height        | Yes
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor.
+ *
+ * @param [out] dx output tensor with the x derivative, or NULL.
+ *
+ * @param [out] dy output tensor with the y derivative, or NULL.
+ *
+ * @param [out] magnitude output tensor with the gradient magnitude, or NULL.
+ *                        + At least one of the outputs must not be NULL.
+ *
+ * @param [in] ksize aperture size of the Sobel filters, it can be 1, 3, 5 or 7, or -1 for the 3x3 Scharr filters.
+ *
+ * @param [in] scale scale factor for the computed derivatives.
+ *
+ * @param [in] borderMode Border mode to be used when accessing elements outside input image, cf. \p NVCVBorderType.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSobelSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
+                                           NVCVTensorHandle dx, NVCVTensorHandle dy, NVCVTensorHandle magnitude,
+                                           int32_t ksize, float scale, NVCVBorderType borderMode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_SOBEL_H */
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpSobel.hpp
+ *
+ * @brief Defines the public C++ Class for the sobel operation.
+ * @defgroup NVCV_CPP_ALGORITHM_SOBEL Sobel
+ * @{
+ */
+
+#ifndef CVCUDA_SOBEL_HPP
+#define CVCUDA_SOBEL_HPP
+
+#include "IOperator.hpp"
+#include "OpSobel.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class Sobel final : public IOperator
+{
+public:
+    explicit Sobel();
+
+    ~Sobel();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor *dx, nvcv::ITensor *dy,
+                    nvcv::ITensor *magnitude, int32_t ksize, float scale = 1.f,
+                    NVCVBorderType borderMode = NVCV_BORDER_REFLECT101);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline Sobel::Sobel()
+{
+    nvcv::detail::CheckThrow(cvcudaSobelCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline Sobel::~Sobel()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void Sobel::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor *dx, nvcv::ITensor *dy,
+                              nvcv::ITensor *magnitude, int32_t ksize, float scale, NVCVBorderType borderMode)
+{
+    nvcv::detail::CheckThrow(cvcudaSobelSubmit(m_handle, stream, in.handle(), dx ? dx->handle() : nullptr,
+                                               dy ? dy->handle() : nullptr,
+                                               magnitude ? magnitude->handle() : nullptr, ksize, scale, borderMode));
+}
+
+inline NVCVOperatorHandle Sobel::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_SOBEL_HPP
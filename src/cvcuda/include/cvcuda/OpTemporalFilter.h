@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpTemporalFilter.h
+ *
+ * @brief Defines types and functions to handle the temporal filter operation.
+ * @defgroup NVCV_C_ALGORITHM_TEMPORAL_FILTER Temporal Filter
+ * @{
+ */
+
+#ifndef CVCUDA_TEMPORAL_FILTER_H
+#define CVCUDA_TEMPORAL_FILTER_H
+
+#include "Operator.h"
+#include "Types.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/Tensor.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Constructs an instance of the temporal filter operator.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaTemporalFilterCreate(NVCVOperatorHandle *handle);
+
+/** Executes the temporal filter operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  The samples of the input are consecutive frames of a stream, filtered in order. The float32 state holds the
+ *  filtered value of every pixel, it's read at the start of the call and written back at the end, so that it
+ *  carries over from one call to the next. Frame n updates each pixel of the state s with its value x as
+ *
+ *      d = max over channels of |x - s|
+ *      s = s + k * (x - s)
+ *
+ *  where k is alpha for \ref NVCV_TEMPORAL_RUNNING_AVERAGE. The state is then an exponentially weighted running
+ *  average of the frames, such as the background model used for motion detection. For
+ *  \ref NVCV_TEMPORAL_RECURSIVE k is 1 when d is above the threshold and alpha otherwise, so that static
+ *  regions are denoised by the running average while moving pixels restart it and don't leave trails.
+ *
+ *  Output frame n, when given, is the state after frame n saturated to the input data type, i.e. the background
+ *  or the denoised frame. Mask n, when given, is 255 where d is above the threshold, moving or foreground pixels,
+ *  and 0 elsewhere. With reset, the state is set to the first frame before filtering, whose mask is then 0.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 2, 3, 4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  State:
+ *       Data Layout:    [kNHWC, kHWC], one sample with the height, width and channels of the input
+ *       Data Type:      32bit Float
+ *
+ *  Output:
+ *       Same shape and data type as the input.
+ *
+ *  Mask:
+ *       Data Layout:    [kNHWC, kHWC], the samples, height and width of the input with one channel
+ *       Data Type:      8bit Unsigned
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor of consecutive frames.
+ *
+ * @param [in,out] state state tensor of the filter.
+ *
+ * @param [out] out output tensor with the filtered frames, or NULL.
+ *
+ * @param [out] mask output tensor with the motion masks, or NULL.
+ *
+ * @param [in] type how the state is updated.
+ *
+ * @param [in] alpha weight of each new frame in the running average.
+ *                   + It must be in (0, 1].
+ *
+ * @param [in] threshold difference above which a pixel is moving, in the input value range.
+ *                       + It must not be negative.
+ *
+ * @param [in] reset whether the state is set to the first frame first, != 0, e.g. for the first call of a stream.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaTemporalFilterSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                    NVCVTensorHandle in, NVCVTensorHandle state, NVCVTensorHandle out,
+                                                    NVCVTensorHandle mask, NVCVTemporalFilterType type, float alpha,
+                                                    float threshold, int8_t reset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_TEMPORAL_FILTER_H */
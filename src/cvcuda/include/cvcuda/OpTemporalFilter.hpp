@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpTemporalFilter.hpp
+ *
+ * @brief Defines the public C++ Class for the temporal filter operation.
+ * @defgroup NVCV_CPP_ALGORITHM_TEMPORAL_FILTER Temporal Filter
+ * @{
+ */
+
+#ifndef CVCUDA_TEMPORAL_FILTER_HPP
+#define CVCUDA_TEMPORAL_FILTER_HPP
+
+#include "IOperator.hpp"
+#include "OpTemporalFilter.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class TemporalFilter final : public IOperator
+{
+public:
+    explicit TemporalFilter();
+
+    ~TemporalFilter();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &state, nvcv::ITensor *out,
+                    nvcv::ITensor *mask, NVCVTemporalFilterType type, float alpha, float threshold,
+                    bool reset = false);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline TemporalFilter::TemporalFilter()
+{
+    nvcv::detail::CheckThrow(cvcudaTemporalFilterCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline TemporalFilter::~TemporalFilter()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void TemporalFilter::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &state,
+                                       nvcv::ITensor *out, nvcv::ITensor *mask, NVCVTemporalFilterType type,
+                                       float alpha, float threshold, bool reset)
+{
+    nvcv::detail::CheckThrow(cvcudaTemporalFilterSubmit(m_handle, stream, in.handle(), state.handle(),
+                                                        out ? out->handle() : nullptr,
+                                                        mask ? mask->handle() : nullptr, type, alpha, threshold,
+                                                        reset ? 1 : 0));
+}
+
+inline NVCVOperatorHandle TemporalFilter::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_TEMPORAL_FILTER_HPP
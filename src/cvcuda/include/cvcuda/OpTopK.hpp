@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpTopK.hpp
+ *
+ * @brief Defines the public C++ Class for the top-k operation.
+ * @defgroup NVCV_CPP_ALGORITHM_TOPK TopK
+ * @{
+ */
+
+#ifndef CVCUDA_TOPK_HPP
+#define CVCUDA_TOPK_HPP
+
+#include "IOperator.hpp"
+#include "OpTopK.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+
+namespace cvcuda {
+
+class TopK final : public IOperator
+{
+public:
+    explicit TopK();
+
+    ~TopK();
+
+    void operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &scores, nvcv::ITensor &indices,
+                    bool softmax = false);
+
+    virtual NVCVOperatorHandle handle() const noexcept override;
+
+private:
+    NVCVOperatorHandle m_handle;
+};
+
+inline TopK::TopK()
+{
+    nvcv::detail::CheckThrow(cvcudaTopKCreate(&m_handle));
+    assert(m_handle);
+}
+
+inline TopK::~TopK()
+{
+    nvcvOperatorDestroy(m_handle);
+    m_handle = nullptr;
+}
+
+inline void TopK::operator()(cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &scores, nvcv::ITensor &indices,
+                             bool softmax)
+{
+    nvcv::detail::CheckThrow(
+        cvcudaTopKSubmit(m_handle, stream, in.handle(), scores.handle(), indices.handle(), softmax ? 1 : 0));
+}
+
+inline NVCVOperatorHandle TopK::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_TOPK_HPP
@@ -66,7 +66,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaWarpAffineCreate(NVCVOperatorHandle *handle, cons
  *  Limitations:
  *
  *  Input:
- *       Data Layout:    [kNHWC, kHWC]
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *       Channels:       [1,3,4]
  *
  *       Data Type      | Allowed
@@ -81,7 +81,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaWarpAffineCreate(NVCVOperatorHandle *handle, cons
  *       64bit Float    | No
  *
  *  Output:
- *       Data Layout:    [kNHWC, kHWC]
+ *       Data Layout:    [kNHWC, kHWC, kNCHW, kCHW]
  *       Channels:       [1,3,4]
  *
  *       Data Type      | Allowed
@@ -137,6 +137,40 @@ CVCUDA_PUBLIC NVCVStatus cvcudaWarpAffineVarShapeSubmit(NVCVOperatorHandle handl
                                                         NVCVTensorHandle transMatrix, const int32_t flags,
                                                         const NVCVBorderType borderMode, const float4 borderValue);
 
+/** Executes the warp affine operation on a varshape image batch, with the matrices given on the host.
+ *
+ *  Same as \ref cvcudaWarpAffineVarShapeSubmit, but the matrices are passed to the kernels by value, so small batches
+ *  need neither a device tensor for them nor any copy. The array can be reused as soon as the call returns.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input image batch.
+ *                + Must have at most #CVCUDA_MAX_HOST_PARAM_SAMPLES images.
+ *
+ * @param [out] out output image batch.
+ *
+ * @param [in] xforms host array with the 2x3 affine transformation matrix of each image.
+ *                    + Must not be NULL.
+ *
+ * @param [in] flags Combination of interpolation methods(NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR or NVCV_INTERP_CUBIC)
+                     and the optional flag NVCV_WARP_INVERSE_MAP, that sets xforms as the inverse transformations.
+ *
+ * @param [in] borderMode pixel extrapolation method (NVCV_BORDER_CONSTANT or NVCV_BORDER_REPLICATE).
+ *
+ * @param [in] borderValue used in case of a constant border.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaWarpAffineVarShapeSubmitHostParams(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                                  NVCVImageBatchHandle in, NVCVImageBatchHandle out,
+                                                                  const NVCVAffineTransform *xforms,
+                                                                  const int32_t flags, const NVCVBorderType borderMode,
+                                                                  const float4 borderValue);
+
 #ifdef __cplusplus
 }
 #endif
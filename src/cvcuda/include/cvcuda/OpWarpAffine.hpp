@@ -52,6 +52,10 @@ public:
                     nvcv::ITensor &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
                     const float4 borderValue);
 
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
+                    const NVCVAffineTransform *xforms, const int32_t flags, const NVCVBorderType borderMode,
+                    const float4 borderValue);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -86,6 +90,14 @@ inline void WarpAffine::operator()(cudaStream_t stream, nvcv::IImageBatchVarShap
                                                             transMatrix.handle(), flags, borderMode, borderValue));
 }
 
+inline void WarpAffine::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
+                                   const NVCVAffineTransform *xforms, const int32_t flags,
+                                   const NVCVBorderType borderMode, const float4 borderValue)
+{
+    nvcv::detail::CheckThrow(cvcudaWarpAffineVarShapeSubmitHostParams(m_handle, stream, in.handle(), out.handle(),
+                                                                      xforms, flags, borderMode, borderValue));
+}
+
 inline NVCVOperatorHandle WarpAffine::handle() const noexcept
 {
     return m_handle;
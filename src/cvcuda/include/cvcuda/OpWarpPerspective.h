@@ -136,6 +136,46 @@ CVCUDA_PUBLIC NVCVStatus cvcudaWarpPerspectiveVarShapeSubmit(NVCVOperatorHandle
                                                              NVCVTensorHandle transMatrix, const int32_t flags,
                                                              const NVCVBorderType borderMode, const float4 borderValue);
 
+/** Rectifies quadrilateral regions of the input images into the output images, one per quadrilateral.
+ *
+ *  Each output image is filled with the perspective projection of its quadrilateral, whose corners are mapped to
+ *  the output corners, so that e.g. text lines of different sizes and orientations detected in a page are all
+ *  straightened in one call. The output size of each region is given by the size of its output image.
+ *
+ *  Limitations: same as @ref cvcudaWarpPerspectiveVarShapeSubmit, the number of quadrilaterals isn't limited by the
+ *  maximum batch size passed at creation.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input images, all with the same format.
+ *
+ * @param [in] quads float32 tensor with the source corners of the quadrilaterals, in pixels.
+ *                   + Shape [N, 8], rows [x0, y0, x1, y1, x2, y2, x3, y3] mapped to the output corners
+ *                     (0, 0), (width, 0), (width, height) and (0, height), quadrilateral i reads image i,
+ *                     or image 0 if the input has a single image.
+ *                   + Shape [N, 9], rows with the index of the image to read from first, followed by the corners.
+ *                     Quadrilaterals with an index outside the input batch produce zeros.
+ *
+ * @param [out] out N output images with the input format.
+ *
+ * @param [in] flags Interpolation method, NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR or NVCV_INTERP_CUBIC.
+ *
+ * @param [in] borderMode pixel extrapolation method.
+ *
+ * @param [in] borderValue used in case of a constant border.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaWarpPerspectiveCropVarShapeSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                                 NVCVImageBatchHandle in, NVCVTensorHandle quads,
+                                                                 NVCVImageBatchHandle out, const int32_t flags,
+                                                                 const NVCVBorderType borderMode,
+                                                                 const float4 borderValue);
+
 #ifdef __cplusplus
 }
 #endif
@@ -53,6 +53,9 @@ public:
                     nvcv::ITensor &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
                     const float4 borderValue);
 
+    void crop(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &quads, nvcv::IImageBatchVarShape &out,
+              const int32_t flags, const NVCVBorderType borderMode, const float4 borderValue);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -87,6 +90,14 @@ inline void WarpPerspective::operator()(cudaStream_t stream, nvcv::IImageBatchVa
                                                                  transMatrix.handle(), flags, borderMode, borderValue));
 }
 
+inline void WarpPerspective::crop(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &quads,
+                                  nvcv::IImageBatchVarShape &out, const int32_t flags, const NVCVBorderType borderMode,
+                                  const float4 borderValue)
+{
+    nvcv::detail::CheckThrow(cvcudaWarpPerspectiveCropVarShapeSubmit(m_handle, stream, in.handle(), quads.handle(),
+                                                                     out.handle(), flags, borderMode, borderValue));
+}
+
 inline NVCVOperatorHandle WarpPerspective::handle() const noexcept
 {
     return m_handle;
@@ -24,17 +24,407 @@
 #ifndef CVCUDA_OPERATOR_H
 #define CVCUDA_OPERATOR_H
 
+#include "Types.h"
 #include "detail/Export.h"
 
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+/**
+ * @defgroup NVCV_C_OPERATOR_GRAPHS CUDA Graph capture
+ *
+ * All operators can be executed on a stream that is being captured into a CUDA graph.
+ * Their execution doesn't synchronize with the host, nor copies from pageable host memory,
+ * so the captured graph performs exactly the same work when launched.
+ *
+ * The following rules apply:
+ * - Operators that need a workspace allocate it on first execution, which is allowed
+ *   while capturing. The graph refers to this workspace, so the operator, or the workspace
+ *   set with \ref nvcvOperatorSetWorkspace, must outlive the graph.
+ * - Image batches must be used at least once outside of capture after being modified.
+ *   Their contents, i.e. which images they hold, must not change while the graph is in use.
+ * - Parameters passed by value (scalars, sizes, enums) are baked into the graph at capture time.
+ * - Parameters passed in tensors (e.g. per-sample parameters of varshape operators, Erase
+ *   areas, Normalize base and scale) are read by the device when the graph is launched. Their
+ *   contents can be updated in place between launches to replay the graph with new parameters.
+ * - The data of images and tensors is also read at launch time, so new inputs can be
+ *   copied into the same buffers for every launch.
+ *
+ * At small batch sizes, launching a captured sequence of operators removes most of their
+ * launch overhead. In C++, cvcuda::OperatorGraph wraps the capture, update and launch, and
+ * cvcuda::OperatorNode adds operators to a graph built by the application.
+ *
+ * @{
+ */
+
 typedef struct NVCVOperator *NVCVOperatorHandle;
 
 CVCUDA_PUBLIC void nvcvOperatorDestroy(NVCVOperatorHandle handle);
 
+/** Stores the workspace requirements of an operator. */
+typedef struct NVCVOperatorWorkspaceRequirementsRec
+{
+    /*< Size in bytes of the cuda memory needed by the operator, 0 if none is needed. */
+    int64_t cudaMemSize;
+
+    /*< Required alignment in bytes of the cuda memory. */
+    int32_t cudaMemAlignment;
+} NVCVOperatorWorkspaceRequirements;
+
+/** Stores the predicted cost of an operator execution, see e.g. \ref cvcudaResizeEstimate. */
+typedef struct NVCVOperatorEstimateRec
+{
+    /*< Size in bytes of the cuda workspace needed by the execution, 0 if none is needed. */
+    int64_t workspaceBytes;
+
+    /*< Approximate bytes of device memory read and written by the execution. */
+    int64_t bytesMoved;
+
+    /*< Approximate GPU time of the execution on the current device, in milliseconds. */
+    double gpuTimeMs;
+} NVCVOperatorEstimate;
+
+/** Returns the workspace needed by the operator when executed.
+ *
+ * The requirements are derived from the maximum sizes passed when creating the operator,
+ * they're valid for all its executions. Creating an operator doesn't allocate it: operators
+ * allocate their own workspace for each stream on the first execution on it, with the size
+ * needed by the passed data, and grow it when later executions need more.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ *
+ * @param [out] reqs Where the workspace requirements will be written to.
+ *                   + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus nvcvOperatorGetWorkspaceRequirements(NVCVOperatorHandle                 handle,
+                                                              NVCVOperatorWorkspaceRequirements *reqs);
+
+/** Sets the workspace to be used by the operator.
+ *
+ * By default, operators allocate their own workspace on first execution. Providing one
+ * allows sharing a single scratch buffer among several operators, as long as they're all
+ * executed on the same cuda stream. The workspace contents aren't preserved between executions.
+ *
+ * The workspace must outlive all operator executions using it. If a workspace was
+ * allocated by the operator, it's freed.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ *
+ * @param [in] cudaMem Cuda memory to be used as workspace.
+ *                     + Must be aligned to the alignment returned by \ref nvcvOperatorGetWorkspaceRequirements.
+ *                     + If NULL, the operator will allocate its own workspace again when needed.
+ *
+ * @param [in] size Size in bytes of the memory pointed by cudaMem.
+ *                  + Must be at least the size returned by \ref nvcvOperatorGetWorkspaceRequirements.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus nvcvOperatorSetWorkspace(NVCVOperatorHandle handle, void *cudaMem, int64_t size);
+
+/** Allocates the operator's own workspace for a stream up front.
+ *
+ * The workspace has the size returned by \ref nvcvOperatorGetWorkspaceRequirements, so that no
+ * execution on the stream allocates memory, e.g. to keep allocations out of latency-sensitive
+ * paths or to fail early when memory is short. It does nothing if the operator doesn't need
+ * a workspace, or when one was set with \ref nvcvOperatorSetWorkspace.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ *
+ * @param [in] stream Cuda stream where the operator will be executed.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough device memory to allocate the workspace.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus nvcvOperatorReserveWorkspace(NVCVOperatorHandle handle, cudaStream_t stream);
+
+/** @} */
+
+/**
+ * @defgroup NVCV_C_OPERATOR_STATS Operator instrumentation
+ *
+ * When CV-CUDA is built with ENABLE_NVTX, every operator execution is an NVTX range named after the
+ * operator, e.g. "Resize" or "ResizeVarShape", followed by the shape and type of its input, so that
+ * profilers like Nsight Systems show which operator launched which kernels.
+ *
+ * Independently of NVTX, executions can be timed on the GPU. Timing is disabled by default, once
+ * enabled each execution records two cuda events on its stream, and the time between them is added
+ * to the operator stats when they complete, without ever synchronizing. The CPU time spent submitting
+ * the execution, from validation to the last launch, is added along with it. Executions that fail, or
+ * that are captured into a graph, aren't timed.
+ *
+ * To bound the overhead on hot paths, only one execution every N of each operator can be timed, see
+ * \ref cvcudaSetOperatorTimingSampling. Stats can also be pushed periodically to a sink, e.g. to
+ * export them as metrics, by a background thread that collects the completed timings, see
+ * \ref cvcudaSetOperatorStatsSink.
+ *
+ * @{
+ */
+
+/** Number of bins of the GPU time histogram of operator stats. */
+#define CVCUDA_OPERATOR_STATS_NUM_BINS 24
+
+/** Maximum length of an operator name in its stats, including the terminating null character. */
+#define CVCUDA_OPERATOR_NAME_LENGTH 64
+
+/** Stores GPU time stats of the executions of an operator. */
+typedef struct NVCVOperatorStatsRec
+{
+    /*< Operator name, e.g. "Resize" or "ResizeVarShape", null-terminated. */
+    char name[CVCUDA_OPERATOR_NAME_LENGTH];
+
+    /*< Number of timed executions. */
+    int64_t count;
+
+    /*< Total, minimum and maximum GPU time of the executions, in milliseconds. */
+    double totalTimeMs;
+    double minTimeMs;
+    double maxTimeMs;
+
+    /*< Number of executions per GPU time bin. Bin 0 counts times below 1 us, bin i times within
+        [2^(i-1), 2^i) us, and the last bin also counts all longer times. */
+    int64_t histogram[CVCUDA_OPERATOR_STATS_NUM_BINS];
+
+    /*< Total and maximum CPU time spent submitting the executions, in milliseconds. */
+    double totalSubmitTimeMs;
+    double maxSubmitTimeMs;
+
+    /*< Number of executions per CPU submit time bin, with the bins of the GPU time histogram. */
+    int64_t submitHistogram[CVCUDA_OPERATOR_STATS_NUM_BINS];
+} NVCVOperatorStats;
+
+/** Enables or disables GPU timing of operator executions.
+ *
+ * @param [in] enabled Non-zero to time the executions that follow, zero to stop. Stats gathered so far are kept.
+ *
+ * @retval #NVCV_SUCCESS Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSetOperatorTimingEnabled(int32_t enabled);
+
+/** Returns the stats of the operators timed so far, one entry per operator name.
+ *
+ * Executions whose events haven't completed yet on the GPU are added to later calls.
+ *
+ * @param [out] stats Where the stats will be written to.
+ *                    + May be NULL to only query the number of entries.
+ *
+ * @param [in,out] numStats On input, the capacity of stats. On output, the number of entries written,
+ *                          or available when stats is NULL.
+ *                          + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaGetOperatorStats(NVCVOperatorStats *stats, int32_t *numStats);
+
+/** Clears the stats of all operators, including executions still pending on the GPU.
+ *
+ * @retval #NVCV_SUCCESS Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaResetOperatorStats(void);
+
+/** Sets how many executions of each operator there are per timed one.
+ *
+ * Executions that aren't sampled only cost an atomic increment. The counts of the stats are then the
+ * number of timed executions, about 1/sampleEvery of all of them.
+ *
+ * @param [in] sampleEvery Time one execution every sampleEvery executions of each operator, 1 to time
+ *                         them all, the default.
+ *                         + Must be positive.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSetOperatorTimingSampling(int32_t sampleEvery);
+
+/** Function receiving the stats of all operators, as returned by \ref cvcudaGetOperatorStats.
+ *
+ * @param [in] userData The pointer given along with the sink.
+ * @param [in] stats Stats of the operators timed so far, only valid during the call.
+ * @param [in] numStats Number of entries of stats.
+ */
+typedef void (*NVCVOperatorStatsSinkFunc)(void *userData, const NVCVOperatorStats *stats, int32_t numStats);
+
+/** Sets the sink the operator stats are pushed to periodically.
+ *
+ * A background thread collects the timings that completed on the GPU and calls the sink with the stats
+ * of all operators every intervalMs milliseconds. Stats are cumulative, the sink can compute rates and
+ * percentiles from the counts and histograms. Setting a sink replaces the previous one, and waits for a
+ * call to it in progress to return.
+ *
+ * @param [in] sink Function called from the background thread, or NULL to stop the thread.
+ *                  It must not set the sink itself.
+ *
+ * @param [in] userData Pointer passed to the sink.
+ *
+ * @param [in] intervalMs Milliseconds between calls to the sink.
+ *                        + Must be positive when sink isn't NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT    Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INVALID_OPERATION   Called from the sink.
+ * @retval #NVCV_SUCCESS                   Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSetOperatorStatsSink(NVCVOperatorStatsSinkFunc sink, void *userData,
+                                                     int32_t intervalMs);
+
+/** @} */
+
+/**
+ * @defgroup NVCV_C_OPERATOR_TUNING Kernel tuning
+ * @{
+ *
+ * Some operators choose between several kernels or launch configurations, e.g. nearest-neighbor Resize and
+ * MedianBlur. By default the choice follows built-in heuristics. With autotuning enabled, the first execution
+ * with a given configuration on a GPU model times each candidate and remembers the fastest one for later
+ * executions. Tuning synchronizes the stream, and is skipped while the stream is being captured.
+ *
+ * Selections are kept per GPU model, and can be saved to a file and loaded back, so that a fleet of GPUs is
+ * tuned once per model. At startup, selections are loaded from the file named by the CVCUDA_TUNING_CACHE
+ * environment variable, if any, and new ones are saved back to it. Setting the CVCUDA_AUTOTUNE environment
+ * variable to 1 enables autotuning at startup.
+ */
+
+/** Enables or disables autotuning of kernel selections.
+ *
+ * @param [in] enabled Non-zero to tune new configurations, zero to use the built-in heuristics for them.
+ *                     Selections tuned so far are kept in both cases.
+ *
+ * @retval #NVCV_SUCCESS Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSetAutotuneEnabled(int32_t enabled);
+
+/** Loads kernel selections from a file, replacing the current ones with the same configuration.
+ *
+ * @param [in] path Path of a file written by \ref cvcudaSaveTuningCache.
+ *                  + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT The path is NULL or the file can't be read.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaLoadTuningCache(const char *path);
+
+/** Saves the current kernel selections to a file.
+ *
+ * @param [in] path Path of the file, overwritten if it exists.
+ *                  + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT The path is NULL or the file can't be written.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSaveTuningCache(const char *path);
+
+/** @} */
+
+/**
+ * @defgroup NVCV_C_OPERATOR_LAUNCH_BUDGET Launch budget
+ * @{
+ *
+ * Operators launching large grids, e.g. CvtColor or ResizeVarShape, can occupy all SMs of the GPU and delay work
+ * running concurrently on other streams, such as inference. A launch budget limits them to a number of SMs: their
+ * kernels are launched with at most as many blocks as fit at full occupancy on that many SMs, and each block loops
+ * over the work of several blocks. The remaining SMs stay available to other work, at the cost of a longer run time
+ * of the operators. The budget bounds the resources in use, the hardware can still spread the blocks over more SMs.
+ *
+ * Operators that don't support it run their usual grids. By default there's no budget. At startup, it's read
+ * from the CVCUDA_LAUNCH_MAX_SMS environment variable, if set.
+ */
+
+/** Sets the launch budget of all threads that didn't override it.
+ *
+ * @param [in] maxSMs Number of SMs the launches may occupy, 0 for no limit.
+ *                    + Must not be negative.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSetLaunchBudget(int32_t maxSMs);
+
+/** Overrides the launch budget for the operators executed by the calling thread.
+ *
+ * This limits the calls of a given thread, e.g. the one preprocessing for a latency-sensitive model, while others
+ * keep the global budget.
+ *
+ * @param [in] maxSMs Number of SMs the launches of the thread may occupy, 0 for no limit.
+ *                    If negative, the thread follows the budget set by \ref cvcudaSetLaunchBudget again.
+ *
+ * @retval #NVCV_SUCCESS Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSetThreadLaunchBudget(int32_t maxSMs);
+
+/** Returns the launch budget of the calling thread.
+ *
+ * @param [out] maxSMs Where the number of SMs the launches of the thread may occupy is written, 0 if unlimited.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaGetLaunchBudget(int32_t *maxSMs);
+
+/** @} */
+
+/**
+ * @defgroup NVCV_C_OPERATOR_PRECISION Precision mode
+ * @{
+ *
+ * Some kernels spend much of their time in transcendental functions and divisions, e.g. the exp() of every tap of
+ * BilateralFilter and JointBilateralFilter, the inverse standard deviation of Normalize with
+ * #CVCUDA_NORMALIZE_SCALE_IS_STDDEV, and the HSV conversions of CvtColor. With #NVCV_PRECISION_FAST they use
+ * the hardware approximations instead, __expf, rsqrtf and __fdividef, whose results differ from the accurate ones
+ * by a few ULPs, which is usually acceptable for inference preprocessing. Rotate operators created in this mode
+ * compute their coordinates in single precision, as with #NVCV_COORD_PRECISION_FLOAT.
+ *
+ * Other operators aren't affected. The default mode is #NVCV_PRECISION_ACCURATE. At startup, it's set to
+ * #NVCV_PRECISION_FAST if the CVCUDA_PRECISION environment variable is "fast".
+ */
+
+/** Sets the precision mode of all threads that didn't override it.
+ *
+ * @param [in] mode Precision mode.
+ *                  + Must be #NVCV_PRECISION_ACCURATE or #NVCV_PRECISION_FAST.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSetPrecisionMode(NVCVPrecisionMode mode);
+
+/** Overrides the precision mode for the operators executed by the calling thread.
+ *
+ * Setting it around a call selects the mode of that call only.
+ *
+ * @param [in] mode Precision mode of the thread, #NVCV_PRECISION_INHERIT to follow the global mode again.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaSetThreadPrecisionMode(NVCVPrecisionMode mode);
+
+/** Returns the precision mode of the calling thread.
+ *
+ * @param [out] mode Where the mode of the thread is written.
+ *                   + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaGetPrecisionMode(NVCVPrecisionMode *mode);
+
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,316 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OperatorGraph.hpp
+ *
+ * @brief Defines the public C++ classes that replay sequences of operators with a single launch.
+ * @defgroup NVCV_CPP_ALGORITHM_OPERATORGRAPH OperatorGraph
+ * @{
+ */
+
+#ifndef CVCUDA_OPERATOR_GRAPH_HPP
+#define CVCUDA_OPERATOR_GRAPH_HPP
+
+#include <cuda_runtime.h>
+#include <nvcv/Exception.hpp>
+
+#include <utility>
+
+namespace cvcuda {
+
+/**
+ * Low-latency execution of a fixed sequence of operators, e.g. the preprocessing of one image per inference.
+ *
+ * At small batch sizes every operator is a handful of tiny kernels, and the pipeline latency is dominated by the
+ * per-launch cost on the host and the gaps between kernels on the GPU.  The sequence is captured once into a CUDA
+ * graph, following the rules of \ref NVCV_C_OPERATOR_GRAPHS, and every launch submits all of its kernels as one
+ * unit, which the GPU runs back to back.
+ *
+ * Replays read and write the same tensors and parameter buffers as the captured calls. To process new data,
+ * overwrite the contents of the input tensors before launching. To use other tensors or other operator
+ * parameters, capture again. When the new sequence has the same kernels as the old one, the executable graph is
+ * updated in place, which is much cheaper than building a new one.
+ *
+ * @code
+ * cvcuda::OperatorGraph graph;
+ * graph.capture(stream,
+ *               [&](cudaStream_t s)
+ *               {
+ *                   resize(s, in, resized, NVCV_INTERP_LINEAR);
+ *                   convert(s, resized, out, 1 / 255.f, 0);
+ *               });
+ * for (;;)
+ * {
+ *     // ... upload the next image to in
+ *     graph.launch(stream);
+ * }
+ * @endcode
+ */
+class OperatorGraph
+{
+public:
+    OperatorGraph() = default;
+    ~OperatorGraph();
+
+    OperatorGraph(const OperatorGraph &)            = delete;
+    OperatorGraph &operator=(const OperatorGraph &) = delete;
+
+    /**
+     * Capture the operators submitted by ops(stream), replacing the previous capture.
+     *
+     * The operators aren't executed. If ops throws, the capture is discarded and the exception propagates, the
+     * previous capture is kept.
+     *
+     * @param[in] stream Stream the operators are submitted to, can't be the legacy default stream.
+     * @param[in] ops Function submitting the operators to the stream it's called with.
+     */
+    template<class F>
+    void capture(cudaStream_t stream, F &&ops);
+
+    /**
+     * Execute the captured operators on a stream, which can differ from the capture stream.
+     */
+    void launch(cudaStream_t stream);
+
+    bool isCaptured() const;
+
+private:
+    cudaGraphExec_t m_exec = nullptr;
+};
+
+/**
+ * Operators as nodes of a CUDA graph built by the application, e.g. one combined with an inference engine's graph.
+ *
+ * The operators submitted by a function are captured into a child graph node, which carries all of their kernels
+ * and the dependencies between them. Once the application's graph is instantiated, the node can be updated for
+ * each batch with the same operators called on other tensors or with other parameters: they're captured again,
+ * which runs only their host side, and the new kernel parameters are patched into the executable graph, with no
+ * instantiation. The operators must launch the same kernels as when the node was added, which is the case when
+ * the shapes and types of their arguments don't change.
+ *
+ * @code
+ * cvcuda::OperatorNode preproc;
+ * cudaGraphNode_t      node = preproc.add(graph, nullptr, 0, stream,
+ *                                         [&](cudaStream_t s) { resize(s, frames[0], input, NVCV_INTERP_LINEAR); });
+ * // ... add the inference nodes depending on node, and instantiate graph into exec
+ * for (int i = 0; i < numBatches; ++i)
+ * {
+ *     preproc.update(exec, stream, [&](cudaStream_t s) { resize(s, frames[i], input, NVCV_INTERP_LINEAR); });
+ *     cudaGraphLaunch(exec, stream);
+ * }
+ * @endcode
+ */
+class OperatorNode
+{
+public:
+    OperatorNode() = default;
+
+    OperatorNode(const OperatorNode &)            = delete;
+    OperatorNode &operator=(const OperatorNode &) = delete;
+
+    /**
+     * Add the operators submitted by ops(stream) to a graph.
+     *
+     * The operators aren't executed. The node belongs to the graph, a node can be added again to another graph,
+     * after which only the new one can be updated.
+     *
+     * @param[in] graph Graph the node is added to.
+     * @param[in] deps Nodes of the graph the new node depends on, can be NULL if numDeps is 0.
+     * @param[in] numDeps Number of dependencies.
+     * @param[in] stream Stream the operators are captured on, can't be the legacy default stream.
+     * @param[in] ops Function submitting the operators to the stream it's called with.
+     *
+     * @return The new node.
+     */
+    template<class F>
+    cudaGraphNode_t add(cudaGraph_t graph, const cudaGraphNode_t *deps, size_t numDeps, cudaStream_t stream,
+                        F &&ops);
+
+    /**
+     * Update the node in an executable graph instantiated from the graph it was added to.
+     *
+     * Takes effect on the next launch of exec, launches already submitted aren't affected.
+     *
+     * @param[in] exec Executable graph.
+     * @param[in] stream Stream the operators are captured on, can't be the legacy default stream.
+     * @param[in] ops Function submitting the same kernels as when the node was added.
+     */
+    template<class F>
+    void update(cudaGraphExec_t exec, cudaStream_t stream, F &&ops);
+
+    /** Node in the graph it was last added to, NULL if it wasn't added. */
+    cudaGraphNode_t node() const;
+
+private:
+    cudaGraphNode_t m_node = nullptr;
+};
+
+namespace detail {
+
+inline void CheckGraphCall(cudaError_t err, const char *what)
+{
+    if (err != cudaSuccess)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_DEVICE, "%s failed: %s", what, cudaGetErrorString(err));
+    }
+}
+
+// Returns the graph of the operators submitted by ops, owned by the caller.
+template<class F>
+cudaGraph_t CaptureOperators(cudaStream_t stream, F &&ops)
+{
+    if (stream == 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "The legacy default stream can't be captured");
+    }
+
+    // Relaxed, as operators may allocate their workspaces on first use
+    CheckGraphCall(cudaStreamBeginCapture(stream, cudaStreamCaptureModeRelaxed), "cudaStreamBeginCapture");
+
+    cudaGraph_t graph = nullptr;
+    try
+    {
+        std::forward<F>(ops)(stream);
+    }
+    catch (...)
+    {
+        if (cudaStreamEndCapture(stream, &graph) == cudaSuccess && graph)
+        {
+            cudaGraphDestroy(graph);
+        }
+        throw;
+    }
+    CheckGraphCall(cudaStreamEndCapture(stream, &graph), "cudaStreamEndCapture");
+    return graph;
+}
+
+} // namespace detail
+
+// OperatorGraph implementation ------------------------------
+
+inline OperatorGraph::~OperatorGraph()
+{
+    if (m_exec)
+    {
+        cudaGraphExecDestroy(m_exec);
+        m_exec = nullptr;
+    }
+}
+
+template<class F>
+void OperatorGraph::capture(cudaStream_t stream, F &&ops)
+{
+    cudaGraph_t graph = detail::CaptureOperators(stream, std::forward<F>(ops));
+
+    cudaError_t err = cudaSuccess;
+    if (m_exec)
+    {
+#if CUDART_VERSION >= 12000
+        cudaGraphExecUpdateResultInfo info;
+        err = cudaGraphExecUpdate(m_exec, graph, &info);
+#else
+        cudaGraphNode_t           errorNode;
+        cudaGraphExecUpdateResult result;
+        err = cudaGraphExecUpdate(m_exec, graph, &errorNode, &result);
+#endif
+        if (err != cudaSuccess)
+        {
+            // Different kernels or topology, the graph must be instantiated again
+            cudaGetLastError();
+            cudaGraphExecDestroy(m_exec);
+            m_exec = nullptr;
+        }
+    }
+
+    if (!m_exec)
+    {
+        err = cudaGraphInstantiateWithFlags(&m_exec, graph, 0);
+        if (err != cudaSuccess)
+        {
+            m_exec = nullptr;
+        }
+    }
+
+    cudaGraphDestroy(graph);
+    detail::CheckGraphCall(err, "Graph instantiation");
+}
+
+inline void OperatorGraph::launch(cudaStream_t stream)
+{
+    if (!m_exec)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_OPERATION, "Nothing was captured in the graph");
+    }
+    detail::CheckGraphCall(cudaGraphLaunch(m_exec, stream), "cudaGraphLaunch");
+}
+
+inline bool OperatorGraph::isCaptured() const
+{
+    return m_exec != nullptr;
+}
+
+// OperatorNode implementation ------------------------------
+
+template<class F>
+cudaGraphNode_t OperatorNode::add(cudaGraph_t graph, const cudaGraphNode_t *deps, size_t numDeps,
+                                  cudaStream_t stream, F &&ops)
+{
+    cudaGraph_t child = detail::CaptureOperators(stream, std::forward<F>(ops));
+
+    // The child graph is cloned into the node
+    cudaGraphNode_t node = nullptr;
+    cudaError_t     err  = cudaGraphAddChildGraphNode(&node, graph, deps, numDeps, child);
+    cudaGraphDestroy(child);
+    detail::CheckGraphCall(err, "cudaGraphAddChildGraphNode");
+
+    m_node = node;
+    return m_node;
+}
+
+template<class F>
+void OperatorNode::update(cudaGraphExec_t exec, cudaStream_t stream, F &&ops)
+{
+    if (!m_node)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_OPERATION, "The node wasn't added to a graph");
+    }
+
+    cudaGraph_t child = detail::CaptureOperators(stream, std::forward<F>(ops));
+
+    // Patches the parameters of each kernel of the node, the topology must be the same
+    cudaError_t err = cudaGraphExecChildGraphNodeSetParams(exec, m_node, child);
+    cudaGraphDestroy(child);
+    if (err != cudaSuccess)
+    {
+        cudaGetLastError();
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_OPERATION,
+                              "The operators can't update the node, they launch other kernels: %s",
+                              cudaGetErrorString(err));
+    }
+}
+
+inline cudaGraphNode_t OperatorNode::node() const
+{
+    return m_node;
+}
+
+} // namespace cvcuda
+
+/** @} */
+
+#endif // CVCUDA_OPERATOR_GRAPH_HPP
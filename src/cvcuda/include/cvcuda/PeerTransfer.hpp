@@ -0,0 +1,386 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file PeerTransfer.hpp
+ *
+ * @brief Defines the public C++ class that gathers and scatters batches across devices.
+ * @defgroup NVCV_CPP_ALGORITHM_PEERTRANSFER PeerTransfer
+ * @{
+ */
+
+#ifndef CVCUDA_PEER_TRANSFER_HPP
+#define CVCUDA_PEER_TRANSFER_HPP
+
+#include <cuda_runtime.h>
+#include <nvcv/Exception.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/TensorData.hpp>
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace cvcuda {
+
+/**
+ * Concatenates tensors spread over several devices into one tensor, and splits a tensor into tensors on other
+ * devices, copying device to device.
+ *
+ * Shards are concatenated along their outermost "N" dimension, in order. Copies go directly between devices when
+ * they have peer access to each other, which is enabled for every pair of the given devices that supports it, e.g.
+ * over NVLink, with no host bounce buffer involved.
+ *
+ * Cross-device ordering is done with events: each copy waits for the work already submitted to the stream of the
+ * tensor it reads, and the streams of the tensors it reads from then wait for the copy, so that their memory can
+ * be reused right away. No host synchronization takes place.
+ *
+ * The device of each tensor is the one its memory is on, see nvcv::ITensor::device().
+ *
+ * @code
+ * // shards processed by one lane per GPU, e.g. with cvcuda::BatchScheduler
+ * cvcuda::PeerTransfer peer({0, 1, 2, 3});
+ * peer.gather(stream0, batchOnGpu0, {{&out0, stream0}, {&out1, stream1}, {&out2, stream2}, {&out3, stream3}});
+ * @endcode
+ */
+class PeerTransfer
+{
+public:
+    struct Shard
+    {
+        const nvcv::ITensor *tensor; ///< Tensor with the samples of the shard.
+        cudaStream_t         stream; ///< Stream of the work using the tensor, belonging to its device.
+    };
+
+    /**
+     * Enable peer access between every pair of the given devices that supports it.
+     *
+     * @param[in] devices Devices the tensors being transferred are on.
+     */
+    explicit PeerTransfer(std::vector<int> devices);
+    ~PeerTransfer();
+
+    PeerTransfer(const PeerTransfer &)            = delete;
+    PeerTransfer &operator=(const PeerTransfer &) = delete;
+
+    /// Whether device can access memory of peerDevice directly.
+    bool canAccessPeer(int device, int peerDevice) const;
+
+    /**
+     * Copy the samples of the shards, in order, into dst.
+     *
+     * @param[in] stream Stream the copies are done in, belonging to the device of dst.
+     * @param[out] dst Tensor with as many samples as all shards together.
+     * @param[in] shards Tensors with the same type and sample shape as dst.
+     */
+    void gather(cudaStream_t stream, const nvcv::ITensor &dst, const std::vector<Shard> &shards);
+
+    /**
+     * Copy the samples of src, in order, into the shards.
+     *
+     * Each shard is copied in its stream, the stream of src then waits for all copies.
+     *
+     * @param[in] stream Stream of the work producing src, belonging to its device.
+     * @param[in] src Tensor with as many samples as all shards together.
+     * @param[out] shards Tensors with the same type and sample shape as src.
+     */
+    void scatter(cudaStream_t stream, const nvcv::ITensor &src, const std::vector<Shard> &shards);
+
+private:
+    std::vector<int>                        m_devices;
+    std::vector<std::pair<int, int>>        m_peerPairs;
+    std::map<int, std::vector<cudaEvent_t>> m_events;
+
+    static void CheckCuda(cudaError_t err, const char *what);
+
+    // index-th event of the device, created on first use
+    cudaEvent_t event(int device, size_t index);
+
+    static const nvcv::ITensorDataStridedCuda &ExportData(const nvcv::ITensor &tensor);
+
+    // Checks that the tensors are made of the same samples, and that they add up to the samples of the whole one.
+    static void CheckShards(const nvcv::ITensorDataStridedCuda &whole, const std::vector<Shard> &shards);
+
+    // Copies count samples starting at sample dstBegin of dst and srcBegin of src
+    static void CopySamples(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &dst, int dstDevice,
+                            int64_t dstBegin, const nvcv::ITensorDataStridedCuda &src, int srcDevice,
+                            int64_t srcBegin, int64_t count);
+};
+
+// PeerTransfer implementation ------------------------------
+
+inline void PeerTransfer::CheckCuda(cudaError_t err, const char *what)
+{
+    if (err != cudaSuccess)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_DEVICE, "%s failed: %s", what, cudaGetErrorString(err));
+    }
+}
+
+inline PeerTransfer::PeerTransfer(std::vector<int> devices)
+    : m_devices(std::move(devices))
+{
+    int curDevice;
+    CheckCuda(cudaGetDevice(&curDevice), "cudaGetDevice");
+
+    for (int device : m_devices)
+    {
+        for (int peer : m_devices)
+        {
+            int canAccess = 0;
+            if (peer == device || cudaDeviceCanAccessPeer(&canAccess, device, peer) != cudaSuccess || !canAccess)
+            {
+                continue;
+            }
+
+            // peer access is enabled from the current device
+            cudaError_t err = cudaSetDevice(device);
+            if (err == cudaSuccess)
+            {
+                err = cudaDeviceEnablePeerAccess(peer, 0);
+            }
+            if (err == cudaSuccess || err == cudaErrorPeerAccessAlreadyEnabled)
+            {
+                m_peerPairs.emplace_back(device, peer);
+            }
+            cudaGetLastError();
+        }
+    }
+
+    CheckCuda(cudaSetDevice(curDevice), "cudaSetDevice");
+}
+
+inline PeerTransfer::~PeerTransfer()
+{
+    // Peer access stays enabled, other code in the process might rely on it
+    for (auto &[device, events] : m_events)
+    {
+        for (cudaEvent_t ev : events)
+        {
+            cudaEventDestroy(ev);
+        }
+    }
+}
+
+inline bool PeerTransfer::canAccessPeer(int device, int peerDevice) const
+{
+    return device == peerDevice
+        || std::find(m_peerPairs.begin(), m_peerPairs.end(), std::make_pair(device, peerDevice))
+               != m_peerPairs.end();
+}
+
+inline cudaEvent_t PeerTransfer::event(int device, size_t index)
+{
+    std::vector<cudaEvent_t> &events = m_events[device];
+    while (events.size() <= index)
+    {
+        // events can only be recorded on streams of the device current when they're created
+        int curDevice;
+        CheckCuda(cudaGetDevice(&curDevice), "cudaGetDevice");
+        CheckCuda(cudaSetDevice(device), "cudaSetDevice");
+
+        cudaEvent_t ev  = nullptr;
+        cudaError_t err = cudaEventCreateWithFlags(&ev, cudaEventDisableTiming);
+        cudaSetDevice(curDevice);
+        CheckCuda(err, "cudaEventCreateWithFlags");
+
+        events.push_back(ev);
+    }
+    return events[index];
+}
+
+inline const nvcv::ITensorDataStridedCuda &PeerTransfer::ExportData(const nvcv::ITensor &tensor)
+{
+    if (tensor.layout().find('N') != 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Tensors must have the sample dimension 'N' as outermost dimension");
+    }
+
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    if (data == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Tensors must be cuda-accessible strided tensors");
+    }
+    return *data;
+}
+
+inline void PeerTransfer::CheckShards(const nvcv::ITensorDataStridedCuda &whole, const std::vector<Shard> &shards)
+{
+    // shards are validated upfront so that a failure doesn't leave copies half-submitted
+    int64_t numSamples = 0;
+    for (const Shard &shard : shards)
+    {
+        const nvcv::ITensorDataStridedCuda &data = ExportData(*shard.tensor);
+
+        if (data.dtype() != whole.dtype() || data.rank() != whole.rank())
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Tensors must have the same type and rank");
+        }
+        for (int d = 1; d < whole.rank(); ++d)
+        {
+            if (data.shape(d) != whole.shape(d) || data.stride(d) != whole.stride(d))
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Tensors must have the same sample shape and strides");
+            }
+        }
+
+        numSamples += data.shape(0);
+    }
+
+    if (numSamples != whole.shape(0))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Tensor must have as many samples as all shards together");
+    }
+}
+
+inline void PeerTransfer::CopySamples(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &dst, int dstDevice,
+                                      int64_t dstBegin, const nvcv::ITensorDataStridedCuda &src, int srcDevice,
+                                      int64_t srcBegin, int64_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    // bytes spanned by one sample
+    int64_t sampleBytes = dst.rank() > 1 ? dst.shape(1) * dst.stride(1) : dst.dtype().strideBytes();
+
+    nvcv::Byte       *dstPtr = dst.basePtr() + dstBegin * dst.stride(0);
+    const nvcv::Byte *srcPtr = src.basePtr() + srcBegin * src.stride(0);
+
+    if (dst.stride(0) == src.stride(0))
+    {
+        // samples laid out the same way are copied in one go
+        CheckCuda(cudaMemcpyPeerAsync(dstPtr, dstDevice, srcPtr, srcDevice, (count - 1) * dst.stride(0) + sampleBytes,
+                                      stream),
+                  "cudaMemcpyPeerAsync");
+    }
+    else
+    {
+        // with unified addressing the copy goes device to device too
+        CheckCuda(cudaMemcpy2DAsync(dstPtr, dst.stride(0), srcPtr, src.stride(0), sampleBytes, count,
+                                    cudaMemcpyDefault, stream),
+                  "cudaMemcpy2DAsync");
+    }
+}
+
+inline void PeerTransfer::gather(cudaStream_t stream, const nvcv::ITensor &dst, const std::vector<Shard> &shards)
+{
+    const nvcv::ITensorDataStridedCuda &dstData   = ExportData(dst);
+    const int                           dstDevice = dst.device();
+
+    CheckShards(dstData, shards);
+
+    int curDevice;
+    CheckCuda(cudaGetDevice(&curDevice), "cudaGetDevice");
+
+    struct DeviceGuard
+    {
+        int device;
+
+        ~DeviceGuard()
+        {
+            cudaSetDevice(device);
+        }
+    } guard{curDevice};
+
+    int64_t begin = 0;
+    for (size_t i = 0; i < shards.size(); ++i)
+    {
+        const Shard &shard       = shards[i];
+        const int    shardDevice = shard.tensor->device();
+
+        // copy starts once the work producing the shard is done
+        cudaEvent_t ready = event(shardDevice, i);
+        CheckCuda(cudaSetDevice(shardDevice), "cudaSetDevice");
+        CheckCuda(cudaEventRecord(ready, shard.stream), "cudaEventRecord");
+
+        CheckCuda(cudaSetDevice(dstDevice), "cudaSetDevice");
+        CheckCuda(cudaStreamWaitEvent(stream, ready, 0), "cudaStreamWaitEvent");
+        CopySamples(stream, dstData, dstDevice, begin, ExportData(*shard.tensor), shardDevice, 0,
+                    shard.tensor->shape()[0]);
+
+        begin += shard.tensor->shape()[0];
+    }
+
+    // shards can be reused once all copies are done
+    cudaEvent_t done = event(dstDevice, shards.size());
+    CheckCuda(cudaSetDevice(dstDevice), "cudaSetDevice");
+    CheckCuda(cudaEventRecord(done, stream), "cudaEventRecord");
+    for (const Shard &shard : shards)
+    {
+        CheckCuda(cudaSetDevice(shard.tensor->device()), "cudaSetDevice");
+        CheckCuda(cudaStreamWaitEvent(shard.stream, done, 0), "cudaStreamWaitEvent");
+    }
+}
+
+inline void PeerTransfer::scatter(cudaStream_t stream, const nvcv::ITensor &src, const std::vector<Shard> &shards)
+{
+    const nvcv::ITensorDataStridedCuda &srcData   = ExportData(src);
+    const int                           srcDevice = src.device();
+
+    CheckShards(srcData, shards);
+
+    int curDevice;
+    CheckCuda(cudaGetDevice(&curDevice), "cudaGetDevice");
+
+    struct DeviceGuard
+    {
+        int device;
+
+        ~DeviceGuard()
+        {
+            cudaSetDevice(device);
+        }
+    } guard{curDevice};
+
+    // copies start once the work producing the source is done
+    cudaEvent_t ready = event(srcDevice, 0);
+    CheckCuda(cudaSetDevice(srcDevice), "cudaSetDevice");
+    CheckCuda(cudaEventRecord(ready, stream), "cudaEventRecord");
+
+    int64_t begin = 0;
+    for (size_t i = 0; i < shards.size(); ++i)
+    {
+        const Shard &shard       = shards[i];
+        const int    shardDevice = shard.tensor->device();
+
+        // each device pulls its shard in its own stream
+        CheckCuda(cudaSetDevice(shardDevice), "cudaSetDevice");
+        CheckCuda(cudaStreamWaitEvent(shard.stream, ready, 0), "cudaStreamWaitEvent");
+        CopySamples(shard.stream, ExportData(*shard.tensor), shardDevice, 0, srcData, srcDevice, begin,
+                    shard.tensor->shape()[0]);
+
+        cudaEvent_t done = event(shardDevice, i + 1);
+        CheckCuda(cudaEventRecord(done, shard.stream), "cudaEventRecord");
+
+        CheckCuda(cudaSetDevice(srcDevice), "cudaSetDevice");
+        CheckCuda(cudaStreamWaitEvent(stream, done, 0), "cudaStreamWaitEvent");
+
+        begin += shard.tensor->shape()[0];
+    }
+}
+
+} // namespace cvcuda
+
+/** @} */
+
+#endif // CVCUDA_PEER_TRANSFER_HPP
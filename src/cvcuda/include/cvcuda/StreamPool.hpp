@@ -0,0 +1,196 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file StreamPool.hpp
+ *
+ * @brief Defines the public C++ class holding the high and low priority streams of internal work.
+ * @defgroup NVCV_CPP_ALGORITHM_STREAMPOOL StreamPool
+ * @{
+ */
+
+#ifndef CVCUDA_STREAM_POOL_HPP
+#define CVCUDA_STREAM_POOL_HPP
+
+#include <cuda_runtime.h>
+#include <nvcv/Exception.hpp>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace cvcuda {
+
+/// Priority classes of the work submitted by CV-CUDA.
+enum class StreamPriority
+{
+    LOW,  ///< Least priority of the device, that of streams created without one, e.g. bulk or backfill work.
+    HIGH, ///< Greatest priority of the device, e.g. latency-critical requests.
+};
+
+/**
+ * Streams on which helpers run work of their own, e.g. the slots of \ref TiledProcessor, in two pools, one per
+ * priority class.
+ *
+ * Work forked off the caller's stream would otherwise run at the default priority whatever the caller's, so that
+ * latency-critical requests sharing the GPU with bulk work would wait behind it. Helpers pick their streams from
+ * the pool of the class of the caller's stream instead: a caller's stream of any priority above the device's least
+ * one is in the HIGH class.
+ *
+ * Streams are non-blocking, created on the current device when first used, and destroyed with the pool. A pool
+ * isn't thread-safe.
+ *
+ * @code
+ * cudaStream_t online;
+ * cudaStreamCreateWithPriority(&online, cudaStreamNonBlocking,
+ *                              cvcuda::StreamPool::CudaPriority(cvcuda::StreamPriority::HIGH));
+ *
+ * cvcuda::StreamPool pool(2);
+ * cudaStream_t       side = pool.get(online, 0); // high priority too
+ * @endcode
+ */
+class StreamPool
+{
+public:
+    /**
+     * Create pools of the given number of streams per priority class.
+     *
+     * @param[in] size Number of streams of each class, at least one.
+     */
+    explicit StreamPool(int32_t size);
+    ~StreamPool();
+
+    StreamPool(const StreamPool &)            = delete;
+    StreamPool &operator=(const StreamPool &) = delete;
+
+    int32_t size() const;
+
+    /// Stream index of the pool of the given class.
+    cudaStream_t get(StreamPriority priority, int32_t index);
+
+    /// Stream index of the pool of the class of stream.
+    cudaStream_t get(cudaStream_t stream, int32_t index);
+
+    /// Least and greatest stream priorities of the current device, the greatest being numerically the lowest.
+    static std::pair<int, int> PriorityRange();
+
+    /// CUDA stream priority of a class on the current device.
+    static int CudaPriority(StreamPriority priority);
+
+    /// Class of a stream, LOW for the default streams.
+    static StreamPriority PriorityOf(cudaStream_t stream);
+
+private:
+    int32_t                                  m_size;
+    std::array<std::vector<cudaStream_t>, 2> m_streams;
+
+    static void CheckCuda(cudaError_t err, const char *what);
+};
+
+// StreamPool implementation ------------------------------
+
+inline void StreamPool::CheckCuda(cudaError_t err, const char *what)
+{
+    if (err != cudaSuccess)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_DEVICE, "%s failed: %s", what, cudaGetErrorString(err));
+    }
+}
+
+inline StreamPool::StreamPool(int32_t size)
+    : m_size(size)
+{
+    if (size < 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Stream pool must have at least one stream");
+    }
+
+    for (auto &streams : m_streams)
+    {
+        streams.assign(size, nullptr);
+    }
+}
+
+inline StreamPool::~StreamPool()
+{
+    for (auto &streams : m_streams)
+    {
+        for (cudaStream_t stream : streams)
+        {
+            if (stream)
+            {
+                cudaStreamDestroy(stream);
+            }
+        }
+    }
+}
+
+inline int32_t StreamPool::size() const
+{
+    return m_size;
+}
+
+inline cudaStream_t StreamPool::get(StreamPriority priority, int32_t index)
+{
+    if (index < 0 || index >= m_size)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Stream index %d out of range [0, %d)", index,
+                              m_size);
+    }
+
+    cudaStream_t &stream = m_streams[static_cast<int>(priority)][index];
+    if (stream == nullptr)
+    {
+        CheckCuda(cudaStreamCreateWithPriority(&stream, cudaStreamNonBlocking, CudaPriority(priority)),
+                  "cudaStreamCreateWithPriority");
+    }
+    return stream;
+}
+
+inline cudaStream_t StreamPool::get(cudaStream_t stream, int32_t index)
+{
+    return this->get(PriorityOf(stream), index);
+}
+
+inline std::pair<int, int> StreamPool::PriorityRange()
+{
+    int least = 0, greatest = 0;
+    CheckCuda(cudaDeviceGetStreamPriorityRange(&least, &greatest), "cudaDeviceGetStreamPriorityRange");
+    return {least, greatest};
+}
+
+inline int StreamPool::CudaPriority(StreamPriority priority)
+{
+    auto [least, greatest] = PriorityRange();
+    return priority == StreamPriority::HIGH ? greatest : least;
+}
+
+inline StreamPriority StreamPool::PriorityOf(cudaStream_t stream)
+{
+    int priority = 0;
+    CheckCuda(cudaStreamGetPriority(stream, &priority), "cudaStreamGetPriority");
+
+    // lower numbers mean higher priorities
+    return priority < PriorityRange().first ? StreamPriority::HIGH : StreamPriority::LOW;
+}
+
+} // namespace cvcuda
+
+/** @} */
+
+#endif // CVCUDA_STREAM_POOL_HPP
@@ -0,0 +1,264 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file StreamPreprocessor.hpp
+ *
+ * @brief Defines the public C++ class that pre-processes the consecutive frames of a video stream.
+ * @defgroup NVCV_CPP_ALGORITHM_STREAMPREPROCESSOR StreamPreprocessor
+ * @{
+ */
+
+#ifndef CVCUDA_STREAM_PREPROCESSOR_HPP
+#define CVCUDA_STREAM_PREPROCESSOR_HPP
+
+#include "OpResizeNormalizeReformat.hpp"
+
+#include <cuda_runtime.h>
+#include <nvcv/Exception.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/Tensor.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace cvcuda {
+
+/**
+ * Per-stream context applying the same crop, color conversion, resize and normalization to every frame of a
+ * YUV 4:2:0 semi-planar video stream.
+ *
+ * The context is created once per stream and keeps everything that doesn't change from one frame to the next:
+ * the \ref ResizeNormalizeReformat operator with its internal state, the parameters of the pre-processing and a
+ * ring of output tensors. Processing a frame only submits the fused operation into the next ring slot, so no
+ * memory is allocated and no parameter is validated again on the host after the first frames.
+ *
+ * Frames can optionally be gated: when the caller knows which region of the frame changed since the previous
+ * one (e.g. from the decoder's skipped macroblocks or from a motion detector) and it doesn't overlap the crop,
+ * nothing is submitted and the slot holding the previous output is returned again.
+ *
+ * An output slot is overwritten ringDepth processed frames later. Work submitted on the same stream is ordered
+ * by it, but consumers running on other streams must be done with a slot by then.
+ *
+ * Base and scale tensors are referenced, not copied, and must outlive the context.
+ *
+ * @code
+ * cvcuda::StreamPreprocessor prep(3, 1, {640, 384}, nvcv::TYPE_F32, base, scale, NVCV_COLOR_YUV2RGB_NV12,
+ *                                 NVCV_INTERP_LINEAR, 1.f / 255, 0.f, 0.f);
+ * while (decode(luma, chroma, &changed))
+ * {
+ *     nvcv::ITensor &input = prep(stream, luma, chroma, &changed);
+ *     infer(stream, input);
+ * }
+ * @endcode
+ */
+class StreamPreprocessor
+{
+public:
+    /**
+     * Create a context and allocate its output ring.
+     *
+     * @param[in] ringDepth Number of output tensors, at least one.
+     * @param[in] numFrames Number of samples of the luma and chroma tensors passed for each call.
+     * @param[in] outSize Size of the outputs, crops are resized to it.
+     * @param[in] outType Data type of the outputs, as allowed by \ref cvcudaResizeNormalizeReformatNV12Submit.
+     * @param[in] base, scale Normalization parameters.
+     * @param[in] code, interpolation, globalScale, shift, epsilon, flags Parameters of the fused operation, see
+     *            \ref cvcudaResizeNormalizeReformatNV12Submit.
+     * @param[in] roi Crop region, in luma pixels. NULL or an empty region means whole frames.
+     */
+    StreamPreprocessor(int32_t ringDepth, int32_t numFrames, nvcv::Size2D outSize, nvcv::DataType outType,
+                       nvcv::ITensor &base, nvcv::ITensor &scale, NVCVColorConversionCode code,
+                       NVCVInterpolationType interpolation, float globalScale, float shift, float epsilon,
+                       uint32_t flags = 0, const NVCVRectI *roi = nullptr);
+
+    StreamPreprocessor(const StreamPreprocessor &)            = delete;
+    StreamPreprocessor &operator=(const StreamPreprocessor &) = delete;
+
+    /**
+     * Pre-process the next frames of the stream.
+     *
+     * @param[in] stream Stream the work is submitted to.
+     * @param[in] luma, chroma Planes of the frames, as in \ref cvcudaResizeNormalizeReformatNV12Submit.
+     * @param[in] changed Region that changed since the previous frames, in luma pixels.
+     *                    + If NULL, the frames are always processed.
+     *                    + An empty region means the frames didn't change.
+     *
+     * @return The output slot holding the result, valid once the work submitted to the stream is done.
+     */
+    nvcv::ITensor &operator()(cudaStream_t stream, nvcv::ITensor &luma, nvcv::ITensor &chroma,
+                              const NVCVRectI *changed = nullptr);
+
+    /**
+     * Change the crop region. Next frames are processed regardless of their changed region.
+     */
+    void setRoi(const NVCVRectI *roi);
+
+    /**
+     * Forget the previous frames, e.g. after a seek. Next frames are processed regardless of their changed region.
+     */
+    void reset();
+
+    int32_t ringDepth() const;
+
+    /// Output slot returned by the last call.
+    nvcv::ITensor &current();
+
+    /// Number of calls that submitted work, and that were skipped by gating.
+    int64_t numProcessed() const;
+    int64_t numSkipped() const;
+
+private:
+    ResizeNormalizeReformat                    m_op;
+    std::vector<std::unique_ptr<nvcv::Tensor>> m_ring;
+
+    nvcv::ITensor          &m_base;
+    nvcv::ITensor          &m_scale;
+    NVCVColorConversionCode m_code;
+    NVCVInterpolationType   m_interpolation;
+    float                   m_globalScale;
+    float                   m_shift;
+    float                   m_epsilon;
+    uint32_t                m_flags;
+    NVCVRectI               m_roi;
+
+    int32_t m_slot         = -1;
+    bool    m_hasPrevious  = false;
+    int64_t m_numProcessed = 0;
+    int64_t m_numSkipped   = 0;
+
+    bool overlapsCrop(const NVCVRectI &changed, const nvcv::ITensor &luma) const;
+};
+
+// StreamPreprocessor implementation ------------------------------
+
+inline StreamPreprocessor::StreamPreprocessor(int32_t ringDepth, int32_t numFrames, nvcv::Size2D outSize,
+                                              nvcv::DataType outType, nvcv::ITensor &base, nvcv::ITensor &scale,
+                                              NVCVColorConversionCode code, NVCVInterpolationType interpolation,
+                                              float globalScale, float shift, float epsilon, uint32_t flags,
+                                              const NVCVRectI *roi)
+    : m_base(base)
+    , m_scale(scale)
+    , m_code(code)
+    , m_interpolation(interpolation)
+    , m_globalScale(globalScale)
+    , m_shift(shift)
+    , m_epsilon(epsilon)
+    , m_flags(flags)
+{
+    if (ringDepth < 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Ring depth must be at least 1, not %d",
+                              ringDepth);
+    }
+    if (numFrames < 1 || outSize.w < 1 || outSize.h < 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Number of frames and output size must be positive");
+    }
+
+    this->setRoi(roi);
+
+    for (int32_t i = 0; i < ringDepth; ++i)
+    {
+        m_ring.emplace_back(new nvcv::Tensor({{numFrames, 3, outSize.h, outSize.w}, nvcv::TENSOR_NCHW}, outType));
+    }
+}
+
+inline nvcv::ITensor &StreamPreprocessor::operator()(cudaStream_t stream, nvcv::ITensor &luma, nvcv::ITensor &chroma,
+                                                     const NVCVRectI *changed)
+{
+    if (changed && m_hasPrevious && !this->overlapsCrop(*changed, luma))
+    {
+        ++m_numSkipped;
+        return *m_ring[m_slot];
+    }
+
+    int32_t next = (m_slot + 1) % this->ringDepth();
+
+    // the previous output stays current if the submission fails
+    m_op(stream, luma, chroma, &m_roi, m_base, m_scale, *m_ring[next], m_code, m_interpolation, m_globalScale,
+         m_shift, m_epsilon, m_flags);
+
+    m_slot        = next;
+    m_hasPrevious = true;
+    ++m_numProcessed;
+    return *m_ring[m_slot];
+}
+
+inline bool StreamPreprocessor::overlapsCrop(const NVCVRectI &changed, const nvcv::ITensor &luma) const
+{
+    if (changed.width <= 0 || changed.height <= 0)
+    {
+        return false;
+    }
+
+    NVCVRectI crop = m_roi;
+    if (crop.width == 0 && crop.height == 0)
+    {
+        const nvcv::TensorShape &shape = luma.shape();
+        crop = NVCVRectI{0, 0, static_cast<int32_t>(shape[2]), static_cast<int32_t>(shape[1])};
+    }
+
+    // linear interpolation and 2x2 chroma subsampling read a couple of pixels around the crop
+    constexpr int32_t kMargin = 2;
+
+    return changed.x < crop.x + crop.width + kMargin && crop.x - kMargin < changed.x + changed.width
+        && changed.y < crop.y + crop.height + kMargin && crop.y - kMargin < changed.y + changed.height;
+}
+
+inline void StreamPreprocessor::setRoi(const NVCVRectI *roi)
+{
+    m_roi         = roi ? *roi : NVCVRectI{0, 0, 0, 0};
+    m_hasPrevious = false;
+}
+
+inline void StreamPreprocessor::reset()
+{
+    m_hasPrevious = false;
+}
+
+inline int32_t StreamPreprocessor::ringDepth() const
+{
+    return static_cast<int32_t>(m_ring.size());
+}
+
+inline nvcv::ITensor &StreamPreprocessor::current()
+{
+    if (m_slot < 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_OPERATION, "No frame has been processed yet");
+    }
+    return *m_ring[m_slot];
+}
+
+inline int64_t StreamPreprocessor::numProcessed() const
+{
+    return m_numProcessed;
+}
+
+inline int64_t StreamPreprocessor::numSkipped() const
+{
+    return m_numSkipped;
+}
+
+} // namespace cvcuda
+
+/** @} */
+
+#endif // CVCUDA_STREAM_PREPROCESSOR_HPP
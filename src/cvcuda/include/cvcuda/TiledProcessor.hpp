@@ -0,0 +1,577 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file TiledProcessor.hpp
+ *
+ * @brief Defines the public C++ class that applies a chain of operators to host images too large for the GPU.
+ * @defgroup NVCV_CPP_ALGORITHM_TILEDPROCESSOR TiledProcessor
+ * @{
+ */
+
+#ifndef CVCUDA_TILED_PROCESSOR_HPP
+#define CVCUDA_TILED_PROCESSOR_HPP
+
+#include "OpCvtColor.hpp"
+#include "OpGaussian.hpp"
+#include "OpResize.hpp"
+#include "StreamPool.hpp"
+
+#include <cuda_runtime.h>
+#include <nvcv/Exception.hpp>
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/Rect.h>
+#include <nvcv/Size.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorData.hpp>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace cvcuda {
+
+/**
+ * Applies a chain of operators to an image held in host memory, one tile at a time, so that the whole image
+ * never has to be resident on the GPU, e.g. for gigapixel pathology or satellite images.
+ *
+ * The output is cut in tiles. Walking the chain backwards, every stage widens the region it needs by its halo,
+ * i.e. the input pixels read beyond the ones its output maps to (kernel radius, interpolation support), so each
+ * tile reads its input with enough context for the pixels it writes to be the same as the ones of whole-image
+ * processing. The borders of the image are still handled by the operators themselves, as tile inputs are clipped
+ * to the image and tiles on its edges see the same edges.
+ *
+ * Stages changing the size of the image (see \ref addResize) map outSize.w / gcd(inSize.w, outSize.w) output
+ * pixels to inSize.w / gcd(inSize.w, outSize.w) input pixels, horizontally and likewise vertically. Tiles are
+ * aligned to these steps so that every tile is resized with exactly the scale of the whole image. Ratios of
+ * sizes sharing no large divisor make the steps, and hence the tiles, large.
+ *
+ * Tiles are processed in two slots, each with its own stream, device buffers and operator instances, so that the
+ * upload of a tile, the processing of the previous one and the download of the one before overlap. Slot streams
+ * come from a \ref StreamPool, with the priority class of the caller's stream. Host buffers must be page-locked
+ * (e.g. with cudaHostRegister) for the copies to be asynchronous.
+ *
+ * @code
+ * cvcuda::TiledProcessor tiled({100000, 100000}, nvcv::FMT_RGB8, {4096, 4096});
+ * tiled.addGaussian({7, 7}, {1.5, 1.5}, NVCV_BORDER_REFLECT101)
+ *     .addCvtColor(NVCV_COLOR_RGB2GRAY, nvcv::FMT_U8)
+ *     .addResize({25000, 25000}, NVCV_INTERP_LINEAR);
+ * tiled(stream, src, srcRowStride, dst, dstRowStride);
+ * @endcode
+ */
+class TiledProcessor
+{
+public:
+    static constexpr int kNumSlots = 2;
+
+    /**
+     * Runs a stage on a tile: fn(slot, stream, in, out).
+     *
+     * Tiles are NHWC tensors with one sample, strided views of the slot's buffers. Functions keeping state bound
+     * to a stream, such as operators, must use one instance per slot.
+     */
+    using StageFunc = std::function<void(int slot, cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out)>;
+
+    struct Stage
+    {
+        nvcv::Size2D      outSize;   ///< Size of the output of the stage for the whole image.
+        nvcv::ImageFormat outFormat; ///< Format of the output, with a single plane.
+        nvcv::Size2D      halo;      ///< Input pixels read on each side beyond the ones the output maps to.
+        StageFunc         run;
+    };
+
+    /// Regions of the image a tile goes through, in the coordinates of the whole image at each stage.
+    struct Tile
+    {
+        NVCVRectI              result; ///< Part of the final output written by the tile.
+        std::vector<NVCVRectI> in;     ///< Input read by each stage.
+        std::vector<NVCVRectI> out;    ///< Output computed by each stage, the next stage reads a part of it.
+    };
+
+    /**
+     * Create a processor for images of the given size and format.
+     *
+     * @param[in] imageSize Size of the input images.
+     * @param[in] format Format of the input images, with a single plane.
+     * @param[in] tileSize Size of the tiles of the final output, before alignment to the resize steps.
+     */
+    TiledProcessor(nvcv::Size2D imageSize, nvcv::ImageFormat format, nvcv::Size2D tileSize);
+    ~TiledProcessor();
+
+    TiledProcessor(const TiledProcessor &)            = delete;
+    TiledProcessor &operator=(const TiledProcessor &) = delete;
+
+    /// Append a custom stage to the chain.
+    TiledProcessor &addStage(Stage stage);
+
+    /// Append a \ref Gaussian filter, its halo is half the kernel size.
+    TiledProcessor &addGaussian(nvcv::Size2D kernelSize, double2 sigma, NVCVBorderType borderMode);
+
+    /// Append a \ref CvtColor conversion between formats of the same size, e.g. not to or from YUV 4:2:0.
+    TiledProcessor &addCvtColor(NVCVColorConversionCode code, nvcv::ImageFormat outFormat);
+
+    /**
+     * Append a \ref Resize of the whole image to outSize.
+     *
+     * Tiles are resized with the scale of the whole image, but the kernels compute source coordinates in float
+     * relative to the tile, so the output is bitwise identical to whole-image resizing when these are exact, i.e.
+     * when the scale is a power of two. Otherwise a few pixels may round differently.
+     */
+    TiledProcessor &addResize(nvcv::Size2D outSize, NVCVInterpolationType interpolation);
+
+    nvcv::Size2D      outSize() const;
+    nvcv::ImageFormat outFormat() const;
+
+    /// Tiles of the current chain, in row-major order of their results.
+    std::vector<Tile> tiles() const;
+
+    /**
+     * Process an image.
+     *
+     * The slots wait for the work already submitted to the stream, and the stream waits for the slots, so the
+     * host buffers must stay valid and the output mustn't be read until the work on stream is done.
+     *
+     * @param[in] stream Stream ordering the processing.
+     * @param[in] src Input image in host memory, packed rows of imageSize.w pixels of the input format.
+     * @param[in] srcRowStride Bytes between rows of src.
+     * @param[out] dst Output image in host memory, rows of outSize().w pixels of outFormat().
+     * @param[in] dstRowStride Bytes between rows of dst.
+     */
+    void operator()(cudaStream_t stream, const void *src, int64_t srcRowStride, void *dst, int64_t dstRowStride);
+
+private:
+    // Interval [begin, end) along one axis
+    struct Span
+    {
+        int32_t begin, end;
+    };
+
+    // Tile along one axis, with the spans of each stage
+    struct AxisTile
+    {
+        Span              result;
+        std::vector<Span> in, out;
+    };
+
+    nvcv::Size2D          m_imageSize, m_tileSize;
+    nvcv::ImageFormat     m_format;
+    std::vector<Stage>    m_stages;
+    bool                  m_planned = false;
+    std::vector<AxisTile> m_tilesX, m_tilesY;
+
+    StreamPool                         m_streams{kNumSlots};
+    std::array<cudaEvent_t, kNumSlots> m_joinEvents{};
+    cudaEvent_t                        m_forkEvent = nullptr;
+
+    // Per slot, the input buffer followed by the output buffer of every stage
+    std::array<std::vector<std::unique_ptr<nvcv::Tensor>>, kNumSlots> m_buffers;
+
+    static void CheckCuda(cudaError_t err, const char *what);
+
+    static std::vector<AxisTile> PlanAxis(int32_t tileSize, const std::vector<int32_t> &sizes,
+                                          const std::vector<int32_t> &halos);
+
+    void planAxes(std::vector<AxisTile> &tilesX, std::vector<AxisTile> &tilesY) const;
+
+    static std::unique_ptr<nvcv::TensorWrapData> View(const nvcv::ITensor &buffer, int32_t x, int32_t y,
+                                                      int32_t width, int32_t height);
+
+    void plan();
+    void destroy();
+};
+
+// TiledProcessor implementation ------------------------------
+
+inline void TiledProcessor::CheckCuda(cudaError_t err, const char *what)
+{
+    if (err != cudaSuccess)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_DEVICE, "%s failed: %s", what, cudaGetErrorString(err));
+    }
+}
+
+inline TiledProcessor::TiledProcessor(nvcv::Size2D imageSize, nvcv::ImageFormat format, nvcv::Size2D tileSize)
+    : m_imageSize(imageSize)
+    , m_tileSize(tileSize)
+    , m_format(format)
+{
+    if (imageSize.w <= 0 || imageSize.h <= 0 || tileSize.w <= 0 || tileSize.h <= 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Image and tile sizes must be positive");
+    }
+    if (format.numPlanes() != 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Image format must have a single plane");
+    }
+
+    CheckCuda(cudaEventCreateWithFlags(&m_forkEvent, cudaEventDisableTiming), "cudaEventCreateWithFlags");
+    for (int slot = 0; slot < kNumSlots; ++slot)
+    {
+        cudaError_t err = cudaEventCreateWithFlags(&m_joinEvents[slot], cudaEventDisableTiming);
+        if (err != cudaSuccess)
+        {
+            this->destroy();
+            CheckCuda(err, "Slot event creation");
+        }
+    }
+}
+
+inline TiledProcessor::~TiledProcessor()
+{
+    this->destroy();
+}
+
+inline void TiledProcessor::destroy()
+{
+    for (int slot = 0; slot < kNumSlots; ++slot)
+    {
+        if (m_joinEvents[slot])
+        {
+            cudaEventDestroy(m_joinEvents[slot]);
+            m_joinEvents[slot] = nullptr;
+        }
+    }
+
+    if (m_forkEvent)
+    {
+        cudaEventDestroy(m_forkEvent);
+        m_forkEvent = nullptr;
+    }
+}
+
+inline TiledProcessor &TiledProcessor::addStage(Stage stage)
+{
+    if (stage.outSize.w <= 0 || stage.outSize.h <= 0 || stage.halo.w < 0 || stage.halo.h < 0 || !stage.run)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Stage must have a positive output size, a non-negative halo and a function");
+    }
+    if (stage.outFormat.numPlanes() != 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Stage output format must have a single plane");
+    }
+
+    m_stages.push_back(std::move(stage));
+    m_planned = false;
+    return *this;
+}
+
+inline TiledProcessor &TiledProcessor::addGaussian(nvcv::Size2D kernelSize, double2 sigma, NVCVBorderType borderMode)
+{
+    std::array<std::shared_ptr<Gaussian>, kNumSlots> ops;
+    for (auto &op : ops)
+    {
+        op = std::make_shared<Gaussian>(kernelSize, 1);
+    }
+
+    return this->addStage({this->outSize(), this->outFormat(), {kernelSize.w / 2, kernelSize.h / 2},
+                           [ops, kernelSize, sigma, borderMode](int slot, cudaStream_t stream, nvcv::ITensor &in,
+                                                                nvcv::ITensor &out)
+                           { (*ops[slot])(stream, in, out, kernelSize, sigma, borderMode); }});
+}
+
+inline TiledProcessor &TiledProcessor::addCvtColor(NVCVColorConversionCode code, nvcv::ImageFormat outFormat)
+{
+    std::array<std::shared_ptr<CvtColor>, kNumSlots> ops;
+    for (auto &op : ops)
+    {
+        op = std::make_shared<CvtColor>();
+    }
+
+    return this->addStage({this->outSize(), outFormat, {0, 0},
+                           [ops, code](int slot, cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out)
+                           { (*ops[slot])(stream, in, out, code); }});
+}
+
+inline TiledProcessor &TiledProcessor::addResize(nvcv::Size2D outSize, NVCVInterpolationType interpolation)
+{
+    std::array<std::shared_ptr<Resize>, kNumSlots> ops;
+    for (auto &op : ops)
+    {
+        op = std::make_shared<Resize>();
+    }
+
+    // generous supports, a larger halo only costs a few more input pixels
+    nvcv::Size2D inSize = this->outSize();
+    auto         halo   = [interpolation](int32_t in, int32_t out)
+    {
+        switch (interpolation)
+        {
+        case NVCV_INTERP_NEAREST:
+            return 1;
+        case NVCV_INTERP_LINEAR:
+            return 2;
+        case NVCV_INTERP_CUBIC:
+            return 3;
+        default:
+            return (in + out - 1) / out + 1;
+        }
+    };
+
+    return this->addStage({outSize, this->outFormat(), {halo(inSize.w, outSize.w), halo(inSize.h, outSize.h)},
+                           [ops, interpolation](int slot, cudaStream_t stream, nvcv::ITensor &in, nvcv::ITensor &out)
+                           { (*ops[slot])(stream, in, out, interpolation); }});
+}
+
+inline nvcv::Size2D TiledProcessor::outSize() const
+{
+    return m_stages.empty() ? m_imageSize : m_stages.back().outSize;
+}
+
+inline nvcv::ImageFormat TiledProcessor::outFormat() const
+{
+    return m_stages.empty() ? m_format : m_stages.back().outFormat;
+}
+
+inline std::vector<TiledProcessor::AxisTile> TiledProcessor::PlanAxis(int32_t tileSize,
+                                                                      const std::vector<int32_t> &sizes,
+                                                                      const std::vector<int32_t> &halos)
+{
+    // sizes holds the size of the input followed by the output size of every stage
+    const int numStages = static_cast<int>(halos.size());
+
+    std::vector<AxisTile> tiles;
+    for (int32_t begin = 0; begin < sizes.back(); begin += tileSize)
+    {
+        AxisTile tile;
+        tile.result = {begin, std::min(begin + tileSize, sizes.back())};
+        tile.in.resize(numStages);
+        tile.out.resize(numStages);
+
+        // walk back from the region the tile must produce to the input it needs
+        Span need = tile.result;
+        for (int k = numStages - 1; k >= 0; --k)
+        {
+            const int32_t inSize = sizes[k], outSize = sizes[k + 1];
+            const int32_t g = std::gcd(inSize, outSize);
+            const int32_t p = inSize / g, q = outSize / g; // q output pixels map to p input pixels
+
+            const int32_t hIn = (halos[k] + p - 1) / p * p;
+
+            Span in;
+            in.begin = std::max(0, need.begin / q * p - hIn);
+            in.end   = need.end == outSize ? inSize : std::min(inSize, (need.end + q - 1) / q * p + hIn);
+
+            // both ends are now multiples of p or image edges, so they map to whole output pixels
+            tile.in[k]  = in;
+            tile.out[k] = {in.begin / p * q, in.end == inSize ? outSize : in.end / p * q};
+
+            need = in;
+        }
+
+        tiles.push_back(std::move(tile));
+    }
+
+    return tiles;
+}
+
+inline void TiledProcessor::planAxes(std::vector<AxisTile> &tilesX, std::vector<AxisTile> &tilesY) const
+{
+    std::vector<int32_t> sizesX{m_imageSize.w}, sizesY{m_imageSize.h}, halosX, halosY;
+    for (const Stage &stage : m_stages)
+    {
+        sizesX.push_back(stage.outSize.w);
+        sizesY.push_back(stage.outSize.h);
+        halosX.push_back(stage.halo.w);
+        halosY.push_back(stage.halo.h);
+    }
+
+    tilesX = PlanAxis(m_tileSize.w, sizesX, halosX);
+    tilesY = PlanAxis(m_tileSize.h, sizesY, halosY);
+}
+
+inline std::vector<TiledProcessor::Tile> TiledProcessor::tiles() const
+{
+    std::vector<AxisTile> tilesX, tilesY;
+    this->planAxes(tilesX, tilesY);
+
+    auto rect = [](const Span &x, const Span &y)
+    {
+        return NVCVRectI{x.begin, y.begin, x.end - x.begin, y.end - y.begin};
+    };
+
+    std::vector<Tile> tiles;
+    for (const AxisTile &ty : tilesY)
+    {
+        for (const AxisTile &tx : tilesX)
+        {
+            Tile tile;
+            tile.result = rect(tx.result, ty.result);
+            for (size_t k = 0; k < m_stages.size(); ++k)
+            {
+                tile.in.push_back(rect(tx.in[k], ty.in[k]));
+                tile.out.push_back(rect(tx.out[k], ty.out[k]));
+            }
+            tiles.push_back(std::move(tile));
+        }
+    }
+    return tiles;
+}
+
+inline void TiledProcessor::plan()
+{
+    this->planAxes(m_tilesX, m_tilesY);
+
+    // buffers are sized for the largest region of each stage over all tiles, the first one holds the input
+    auto maxLength = [](const std::vector<AxisTile> &tiles, int k)
+    {
+        int32_t length = 0;
+        for (const AxisTile &tile : tiles)
+        {
+            const Span &span = k < 0 ? (tile.in.empty() ? tile.result : tile.in[0]) : tile.out[k];
+            length           = std::max(length, span.end - span.begin);
+        }
+        return length;
+    };
+
+    std::vector<nvcv::Size2D> maxSizes;
+    for (int k = -1; k < static_cast<int>(m_stages.size()); ++k)
+    {
+        maxSizes.push_back({maxLength(m_tilesX, k), maxLength(m_tilesY, k)});
+    }
+
+    for (int slot = 0; slot < kNumSlots; ++slot)
+    {
+        m_buffers[slot].clear();
+        m_buffers[slot].push_back(std::make_unique<nvcv::Tensor>(1, maxSizes[0], m_format));
+        for (size_t k = 0; k < m_stages.size(); ++k)
+        {
+            m_buffers[slot].push_back(std::make_unique<nvcv::Tensor>(1, maxSizes[k + 1], m_stages[k].outFormat));
+        }
+    }
+
+    m_planned = true;
+}
+
+inline std::unique_ptr<nvcv::TensorWrapData> TiledProcessor::View(const nvcv::ITensor &buffer, int32_t x, int32_t y,
+                                                                  int32_t width, int32_t height)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(buffer.exportData());
+    if (data == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Tile buffer must be cuda-accessible");
+    }
+
+    nvcv::TensorDataStridedCuda::Buffer buf;
+    for (int d = 0; d < data->rank(); ++d)
+    {
+        buf.strides[d] = data->stride(d);
+    }
+    buf.basePtr = reinterpret_cast<NVCVByte *>(data->basePtr()) + y * data->stride(1) + x * data->stride(2);
+
+    nvcv::TensorShape shape({1, height, width, data->shape()[3]}, data->layout());
+    return std::make_unique<nvcv::TensorWrapData>(nvcv::TensorDataStridedCuda(shape, data->dtype(), buf));
+}
+
+inline void TiledProcessor::operator()(cudaStream_t stream, const void *src, int64_t srcRowStride, void *dst,
+                                       int64_t dstRowStride)
+{
+    if (src == nullptr || dst == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Source and destination must not be NULL");
+    }
+
+    if (!m_planned)
+    {
+        this->plan();
+    }
+
+    const int32_t numStages     = static_cast<int32_t>(m_stages.size());
+    const int64_t inPixelBytes  = m_format.planePixelStrideBytes(0);
+    const int64_t outPixelBytes = this->outFormat().planePixelStrideBytes(0);
+
+    // slots run at the caller's priority, once everything submitted so far to its stream is done
+    std::array<cudaStream_t, kNumSlots> slotStreams;
+    CheckCuda(cudaEventRecord(m_forkEvent, stream), "cudaEventRecord");
+    for (int slot = 0; slot < kNumSlots; ++slot)
+    {
+        slotStreams[slot] = m_streams.get(stream, slot);
+        CheckCuda(cudaStreamWaitEvent(slotStreams[slot], m_forkEvent, 0), "cudaStreamWaitEvent");
+    }
+
+    int tileIdx = 0;
+    for (const AxisTile &ty : m_tilesY)
+    {
+        for (const AxisTile &tx : m_tilesX)
+        {
+            const int    slot    = tileIdx++ % kNumSlots;
+            cudaStream_t sstream = slotStreams[slot];
+            const auto  &bufs    = m_buffers[slot];
+
+            // upload the input of the first stage
+            Span inX = numStages > 0 ? tx.in[0] : tx.result;
+            Span inY = numStages > 0 ? ty.in[0] : ty.result;
+
+            std::unique_ptr<nvcv::TensorWrapData> cur
+                = View(*bufs[0], 0, 0, inX.end - inX.begin, inY.end - inY.begin);
+            {
+                const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(cur->exportData());
+                CheckCuda(cudaMemcpy2DAsync(data->basePtr(), data->stride(1),
+                                            static_cast<const uint8_t *>(src) + inY.begin * srcRowStride
+                                                + inX.begin * inPixelBytes,
+                                            srcRowStride, (inX.end - inX.begin) * inPixelBytes, inY.end - inY.begin,
+                                            cudaMemcpyHostToDevice, sstream),
+                          "Tile upload");
+            }
+
+            // run the chain, each stage reading the part of the previous output its input region covers
+            Span curX = inX, curY = inY;
+            for (int32_t k = 0; k < numStages; ++k)
+            {
+                const Span outX = tx.out[k], outY = ty.out[k];
+
+                std::unique_ptr<nvcv::TensorWrapData> out
+                    = View(*bufs[k + 1], 0, 0, outX.end - outX.begin, outY.end - outY.begin);
+                m_stages[k].run(slot, sstream, *cur, *out);
+
+                const Span nextX = k + 1 < numStages ? tx.in[k + 1] : tx.result;
+                const Span nextY = k + 1 < numStages ? ty.in[k + 1] : ty.result;
+
+                cur  = View(*bufs[k + 1], nextX.begin - outX.begin, nextY.begin - outY.begin, nextX.end - nextX.begin,
+                            nextY.end - nextY.begin);
+                curX = nextX;
+                curY = nextY;
+            }
+
+            // download the tile's result, cur now views it
+            const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(cur->exportData());
+            CheckCuda(cudaMemcpy2DAsync(static_cast<uint8_t *>(dst) + curY.begin * dstRowStride
+                                            + curX.begin * outPixelBytes,
+                                        dstRowStride, data->basePtr(), data->stride(1),
+                                        (curX.end - curX.begin) * outPixelBytes, curY.end - curY.begin,
+                                        cudaMemcpyDeviceToHost, sstream),
+                      "Tile download");
+        }
+    }
+
+    for (int slot = 0; slot < kNumSlots; ++slot)
+    {
+        CheckCuda(cudaEventRecord(m_joinEvents[slot], slotStreams[slot]), "cudaEventRecord");
+        CheckCuda(cudaStreamWaitEvent(stream, m_joinEvents[slot], 0), "cudaStreamWaitEvent");
+    }
+}
+
+} // namespace cvcuda
+
+/** @} */
+
+#endif // CVCUDA_TILED_PROCESSOR_HPP
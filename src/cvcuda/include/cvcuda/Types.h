@@ -28,6 +28,8 @@
 
 #include "detail/Export.h"
 
+#include <nvcv/DataLayout.h>
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -46,10 +48,134 @@ typedef enum
 
 typedef enum
 {
-    NVCV_ERODE  = 0,
-    NVCV_DILATE = 1,
+    NVCV_ERODE    = 0,
+    NVCV_DILATE   = 1,
+    NVCV_OPEN     = 2, //!< erosion followed by a dilation
+    NVCV_CLOSE    = 3, //!< dilation followed by an erosion
+    NVCV_GRADIENT = 4, //!< dilation minus the erosion
+    NVCV_TOPHAT   = 5, //!< image minus its opening
+    NVCV_BLACKHAT = 6, //!< closing minus the image
 } NVCVMorphologyType;
 
+// @brief Flag to choose how the values of a remap map are interpreted
+typedef enum
+{
+    NVCV_REMAP_ABSOLUTE = 0, //!< map holds the source coordinates of each output pixel
+    NVCV_REMAP_RELATIVE = 1, //!< map holds offsets added to the coordinates of each output pixel
+} NVCVRemapMapValueType;
+
+// @brief Flag to choose the precision of the coordinate math of geometric operators
+typedef enum
+{
+    NVCV_COORD_PRECISION_DEFAULT = 0, //!< float on devices with low FP64 throughput, double otherwise
+    NVCV_COORD_PRECISION_FLOAT   = 1, //!< per-pixel coordinates computed in single precision
+    NVCV_COORD_PRECISION_DOUBLE  = 2, //!< per-pixel coordinates computed in double precision
+} NVCVCoordinatePrecision;
+
+// @brief Flag to choose the accuracy of the math of the operators that support it, see cvcudaSetPrecisionMode
+typedef enum
+{
+    NVCV_PRECISION_INHERIT  = -1, //!< only for threads, follow the global mode
+    NVCV_PRECISION_ACCURATE = 0,  //!< full-precision math
+    NVCV_PRECISION_FAST     = 1,  //!< hardware approximations of exp, division and square root, within a few ULPs
+} NVCVPrecisionMode;
+
+// @brief Maximum number of samples of the varshape submits taking per-sample parameters as host arrays, which are
+// passed to the kernels by value instead of through device tensors, e.g. cvcudaRotateVarShapeSubmitHostParams.
+#define CVCUDA_MAX_HOST_PARAM_SAMPLES 64
+
+// @brief Flag to choose how the 2D convolution operator computes its result, see cvcudaConv2DCreateWithAlgorithm
+typedef enum
+{
+    NVCV_CONV2D_ALGO_AUTO   = 0, //!< FFT for kernels of 32x32 taps or more, direct otherwise
+    NVCV_CONV2D_ALGO_DIRECT = 1, //!< direct accumulation of the taps of each output pixel
+    NVCV_CONV2D_ALGO_FFT    = 2, //!< overlap-save FFTs, kernels up to 512x512, rounding differs from direct
+} NVCVConv2DAlgorithm;
+
+// @brief Flag to choose the operation of the reduce operator
+typedef enum
+{
+    NVCV_REDUCE_SUM  = 0, //!< sum of the values
+    NVCV_REDUCE_MEAN = 1, //!< mean of the values
+    NVCV_REDUCE_MIN  = 2, //!< minimum value
+    NVCV_REDUCE_MAX  = 3, //!< maximum value
+} NVCVReduceOp;
+
+// @brief Flag to choose the kind of pyramid built by the pyramid operator
+typedef enum
+{
+    NVCV_PYRAMID_GAUSSIAN  = 0, //!< each level is the 5x5 Gaussian blur of the level above, downscaled by 2
+    NVCV_PYRAMID_LAPLACIAN = 1, //!< each level is the difference of its Gaussian level with the upscaled level below
+} NVCVPyramidType;
+
+// @brief Flag to choose how the temporal filter operator updates its state
+typedef enum
+{
+    NVCV_TEMPORAL_RUNNING_AVERAGE = 0, //!< state is the running average of the frames, e.g. a background model
+    NVCV_TEMPORAL_RECURSIVE       = 1, //!< running average restarted on moving pixels, for temporal denoising
+} NVCVTemporalFilterType;
+
+// @brief Flag to choose the output of the thresholding operators from the comparison of each pixel
+typedef enum
+{
+    NVCV_THRESH_BINARY     = 0, //!< maxValue where the pixel is above the threshold, 0 elsewhere
+    NVCV_THRESH_BINARY_INV = 1, //!< 0 where the pixel is above the threshold, maxValue elsewhere
+} NVCVThresholdType;
+
+// @brief Flag to choose how the demosaic operator interpolates the missing colors
+typedef enum
+{
+    NVCV_DEMOSAIC_BILINEAR   = 0, //!< average of the nearest samples of each color
+    NVCV_DEMOSAIC_EDGE_AWARE = 1, //!< green interpolated along edges, red and blue from the differences to green
+} NVCVDemosaicType;
+
+// @brief Flag to choose the hash computed by the image hash operator
+typedef enum
+{
+    NVCV_IMAGE_HASH_EXACT = 0, //!< hash of every byte of the image, any change gives another hash
+    NVCV_IMAGE_HASH_DHASH = 1, //!< perceptual difference hash, from the gradients of a 9x8 grayscale thumbnail
+    NVCV_IMAGE_HASH_PHASH = 2, //!< perceptual hash, from the low frequencies of a 32x32 grayscale thumbnail
+} NVCVImageHashType;
+
+// @brief Flag to choose how the blur regions operator hides the pixels of each region
+typedef enum
+{
+    NVCV_BLUR_REGION_GAUSSIAN = 0, //!< Gaussian blur of the pixels around each pixel of the region
+    NVCV_BLUR_REGION_PIXELATE = 1, //!< each pixel replaced by the mean of its square cell of the image grid
+} NVCVBlurRegionType;
+
+// @brief Kind of primitive drawn by the on-screen display operator, the first value of each element
+typedef enum
+{
+    NVCV_OSD_RECT    = 0, //!< rectangle [x1, y1, x2, y2] outlined with a thickness, filled when it's not positive
+    NVCV_OSD_LINE    = 1, //!< segment from (x1, y1) to (x2, y2) with a thickness
+    NVCV_OSD_POLYGON = 2, //!< polygon filled with the even-odd rule, its vertices are a range of the points tensor
+    NVCV_OSD_GLYPH   = 3, //!< glyph of the atlas scaled and drawn from (x, y), e.g. a character of a label
+} NVCVOSDElementType;
+
+// @brief Flag to choose the corner response of the Harris operator, from the structure tensor of each window
+typedef enum
+{
+    NVCV_CORNER_HARRIS     = 0, //!< det - k * trace^2, as OpenCV's cornerHarris
+    NVCV_CORNER_SHI_TOMASI = 1, //!< smallest eigenvalue, as OpenCV's cornerMinEigenVal
+} NVCVCornerResponseType;
+
+// @brief Color processing applied by the demosaic operator to the interpolated RGB, in this order
+typedef struct
+{
+    float wbGains[3]; //!< white balance gains of red, green and blue
+    float ccm[9];     //!< color correction matrix, row-major, applied to the white balanced RGB
+    float gamma;      //!< output is the corrected RGB, clamped to [0,1], to the power 1/gamma, 1 for linear output
+} NVCVDemosaicParams;
+
+// @brief Conversion of one of the outputs of the multi-output ConvertTo
+typedef struct
+{
+    float       alpha[4];     //!< scale of each output channel
+    float       beta[4];      //!< shift of each output channel, added to the scaled value
+    NVCVSwizzle channelOrder; //!< input channel of each output channel, NVCV_SWIZZLE_XYZW keeps their order
+} NVCVConvertToParams;
+
 // @brief Flag to choose the color conversion to be used
 typedef enum
 {
@@ -324,7 +450,17 @@ typedef enum
     NVCV_COLOR_BGRA2YUV_NV21 = 147,
     NVCV_COLOR_BGRA2YUV420sp = NVCV_COLOR_BGRA2YUV_NV21,
 
-    NVCV_COLORCVT_MAX = 148,
+    //! 16-bit semi-planar 4:2:0 (P010/P016) to RGB, see @ref cvcudaCvtColorWithSpecSubmit
+    NVCV_COLOR_YUV2RGB_P010  = 148,
+    NVCV_COLOR_YUV2BGR_P010  = 149,
+    NVCV_COLOR_YUV2RGBA_P010 = 150,
+    NVCV_COLOR_YUV2BGRA_P010 = 151,
+    NVCV_COLOR_YUV2RGB_P016  = NVCV_COLOR_YUV2RGB_P010,
+    NVCV_COLOR_YUV2BGR_P016  = NVCV_COLOR_YUV2BGR_P010,
+    NVCV_COLOR_YUV2RGBA_P016 = NVCV_COLOR_YUV2RGBA_P010,
+    NVCV_COLOR_YUV2BGRA_P016 = NVCV_COLOR_YUV2BGRA_P010,
+
+    NVCV_COLORCVT_MAX = 152,
 
 } NVCVColorConversionCode;
 
@@ -0,0 +1,172 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Filter2D.hpp
+ *
+ * @brief Defines the device-callable 2D filter primitive, specialized at compile time.
+ */
+
+#ifndef CVCUDA_CUDA_FILTER_2D_HPP
+#define CVCUDA_CUDA_FILTER_2D_HPP
+
+#include <cuda_runtime.h>
+#include <nvcv/BorderType.h>
+#include <nvcv/Exception.hpp>
+#include <nvcv/cuda/BorderWrap.hpp>
+#include <nvcv/cuda/MathOps.hpp>
+#include <nvcv/cuda/SaturateCast.hpp>
+#include <nvcv/cuda/TensorWrap.hpp>
+#include <nvcv/cuda/TypeTraits.hpp>
+
+namespace cvcuda::cuda {
+
+/**
+ * 2D correlation with its pixel type, kernel size and border fixed at compile time.
+ *
+ * This is the filter applied by operators such as \ref cvcuda::Conv2D, \ref cvcuda::Gaussian or
+ * \ref cvcuda::Laplacian, without their run-time dispatch on data type, number of channels and border: the
+ * kernel loops are fully unrolled.  Weights are read from \p kernel in row-major order, as float.
+ *
+ * @defgroup NVCV_CPP_CUDA_FILTER2D Filter2D primitive
+ * @{
+ *
+ * @code
+ * using Blur = cvcuda::cuda::Filter2D<uint8_t, 3, 3, 3, NVCV_BORDER_REFLECT101>;
+ *
+ * Blur::SrcWrap src = nvcv::cuda::CreateBorderWrapNHW<const uchar3, NVCV_BORDER_REFLECT101>(inData, {});
+ * Blur::run(stream, src, nvcv::cuda::CreateTensorWrapNHW<uchar3>(outData), weights, int2{1, 1}, size, numSamples);
+ * @endcode
+ *
+ * @tparam BT Base type of the pixels, e.g. uint8_t.
+ * @tparam C Number of channels, interleaved.
+ * @tparam KW, KH Kernel width and height.
+ * @tparam B Border used to read source pixels outside the images.
+ */
+template<typename BT, int C, int KW, int KH, NVCVBorderType B>
+class Filter2D
+{
+    static_assert(KW > 0 && KH > 0, "Kernel size must be positive");
+
+public:
+    using ValueType = nvcv::cuda::MakeType<BT, C>;
+    using SrcWrap   = nvcv::cuda::BorderWrap<nvcv::cuda::Tensor3DWrap<const ValueType>, B, false, true, true>;
+    using DstWrap   = nvcv::cuda::Tensor3DWrap<ValueType>;
+
+    /**
+     * Computes one destination pixel.
+     *
+     * @param[in] src Source images, border aware in rows and columns.
+     * @param[in] kernel KW x KH weights.
+     * @param[in] anchor Kernel position over the pixel filtered.
+     * @param[in] coord Column, row and sample of the pixel.
+     *
+     * @return The filtered pixel.
+     */
+    static __device__ ValueType pixel(const SrcWrap &src, const float *kernel, int2 anchor, int3 coord);
+
+    /**
+     * Filters \p numSamples images of \p src into \p dst on \p stream, \p kernel must be in device memory.
+     *
+     * @throw nvcv::Exception ERROR_DEVICE if the kernel can't be launched.
+     */
+    static void run(cudaStream_t stream, const SrcWrap &src, const DstWrap &dst, const float *kernel, int2 anchor,
+                    int2 size, int numSamples);
+
+private:
+    using WorkType = nvcv::cuda::ConvertBaseTypeTo<float, ValueType>;
+};
+
+/**@}*/
+
+namespace detail {
+
+template<class F>
+__global__ void Filter2DKernel(typename F::SrcWrap src, typename F::DstWrap dst, const float *kernel, int2 anchor,
+                               int2 size, int numSamples)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    if (x >= size.x || y >= size.y)
+    {
+        return;
+    }
+
+    for (int z = blockIdx.z; z < numSamples; z += gridDim.z)
+    {
+        int3 coord{x, y, z};
+        dst[coord] = F::pixel(src, kernel, anchor, coord);
+    }
+}
+
+} // namespace detail
+
+// Filter2D implementation -----------------------------------
+
+template<typename BT, int C, int KW, int KH, NVCVBorderType B>
+inline __device__ auto Filter2D<BT, C, KW, KH, B>::pixel(const SrcWrap &src, const float *kernel, int2 anchor,
+                                                         int3 coord) -> ValueType
+{
+    WorkType res = nvcv::cuda::SetAll<WorkType>(0);
+
+    int3 srcCoord{0, 0, coord.z};
+
+#pragma unroll
+    for (int i = 0; i < KH; ++i)
+    {
+        srcCoord.y = coord.y - anchor.y + i;
+
+#pragma unroll
+        for (int j = 0; j < KW; ++j)
+        {
+            srcCoord.x = coord.x - anchor.x + j;
+
+            res = res + src[srcCoord] * kernel[i * KW + j];
+        }
+    }
+
+    return nvcv::cuda::SaturateCast<ValueType>(res);
+}
+
+template<typename BT, int C, int KW, int KH, NVCVBorderType B>
+inline void Filter2D<BT, C, KW, KH, B>::run(cudaStream_t stream, const SrcWrap &src, const DstWrap &dst,
+                                            const float *kernel, int2 anchor, int2 size, int numSamples)
+{
+    if (numSamples <= 0 || size.x <= 0 || size.y <= 0)
+    {
+        return;
+    }
+
+    constexpr int kMaxGridDimZ = 65535;
+
+    dim3 block(32, 8);
+    dim3 grid((size.x + block.x - 1) / block.x, (size.y + block.y - 1) / block.y,
+              numSamples < kMaxGridDimZ ? numSamples : kMaxGridDimZ);
+
+    detail::Filter2DKernel<Filter2D><<<grid, block, 0, stream>>>(src, dst, kernel, anchor, size, numSamples);
+
+    cudaError_t err = cudaGetLastError();
+    if (err != cudaSuccess)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_DEVICE, "Filter2D kernel launch failed: %s",
+                              cudaGetErrorString(err));
+    }
+}
+
+} // namespace cvcuda::cuda
+
+#endif // CVCUDA_CUDA_FILTER_2D_HPP
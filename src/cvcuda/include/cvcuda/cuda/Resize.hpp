@@ -0,0 +1,257 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Resize.hpp
+ *
+ * @brief Defines the device-callable resize primitive, specialized at compile time.
+ */
+
+#ifndef CVCUDA_CUDA_RESIZE_HPP
+#define CVCUDA_CUDA_RESIZE_HPP
+
+#include "../Types.h" // for NVCVInterpolationType, etc.
+
+#include <cuda_runtime.h>
+#include <nvcv/Exception.hpp>
+#include <nvcv/cuda/MathOps.hpp>
+#include <nvcv/cuda/MathWrappers.hpp>
+#include <nvcv/cuda/SaturateCast.hpp>
+#include <nvcv/cuda/TensorWrap.hpp>
+#include <nvcv/cuda/TypeTraits.hpp>
+
+namespace cvcuda::cuda {
+
+/**
+ * Resize with its pixel type and interpolation fixed at compile time.
+ *
+ * Unlike \ref cvcuda::Resize, which selects one of its kernels at run time from the tensor data type, number of
+ * channels and interpolation, this only instantiates the code of one combination.  It gives the same results as
+ * the operator on NHWC or HWC tensors, including taking the absolute value of the cubic interpolation, as the
+ * operator does, instead of clamping it.  Only nearest, linear and cubic interpolations are supported.
+ *
+ * Linear interpolation reads 2x2 source pixels and cubic 4x4, so source images must be at least 2 pixels wide
+ * and high for linear and 4 for cubic.
+ *
+ * Images are accessed through \ref nvcv::cuda::Tensor3DWrap, e.g. created with
+ * \ref nvcv::cuda::CreateTensorWrapNHW, so \ref pixel can be called from any kernel to fuse the resize with
+ * other work, and \ref run launches a standalone resize.
+ *
+ * @defgroup NVCV_CPP_CUDA_RESIZE Resize primitive
+ * @{
+ *
+ * @code
+ * using ResizeRGB8 = cvcuda::cuda::Resize<uint8_t, 3, NVCV_INTERP_LINEAR>;
+ *
+ * __global__ void ResizeAndNormalize(ResizeRGB8::SrcWrap src, int2 srcSize, float2 scale, ...)
+ * {
+ *     float3 value = nvcv::cuda::StaticCast<float>(ResizeRGB8::pixel(src, srcSize, scale, coord));
+ *     ...
+ * }
+ * @endcode
+ *
+ * @tparam BT Base type of the pixels, e.g. uint8_t.
+ * @tparam C Number of channels, interleaved.
+ * @tparam I Interpolation type.
+ */
+template<typename BT, int C, NVCVInterpolationType I>
+class Resize
+{
+    static_assert(I == NVCV_INTERP_NEAREST || I == NVCV_INTERP_LINEAR || I == NVCV_INTERP_CUBIC,
+                  "Resize primitive only supports nearest, linear and cubic interpolations");
+
+public:
+    using ValueType = nvcv::cuda::MakeType<BT, C>;
+    using SrcWrap   = nvcv::cuda::Tensor3DWrap<const ValueType>;
+    using DstWrap   = nvcv::cuda::Tensor3DWrap<ValueType>;
+
+    /// Ratio of the source to the destination size, as expected by \ref pixel.
+    static __host__ __device__ float2 Scale(int2 srcSize, int2 dstSize)
+    {
+        return float2{static_cast<float>(srcSize.x) / dstSize.x, static_cast<float>(srcSize.y) / dstSize.y};
+    }
+
+    /**
+     * Computes one destination pixel.
+     *
+     * Source pixels past the image are read when it's smaller than 2x2 for linear interpolation, or 4x4 for
+     * cubic, it's up to the caller not to use those sizes.
+     *
+     * @param[in] src Source images.
+     * @param[in] srcSize Width and height of the source images.
+     * @param[in] scale Source to destination ratio, see \ref Scale.
+     * @param[in] dstCoord Destination column, row and sample.
+     *
+     * @return The resized pixel.
+     */
+    static __device__ ValueType pixel(const SrcWrap &src, int2 srcSize, float2 scale, int3 dstCoord);
+
+    /**
+     * Resizes \p numSamples images of \p src into \p dst on \p stream.
+     *
+     * @throw nvcv::Exception ERROR_INVALID_ARGUMENT if \p srcSize is smaller than the pixels interpolated, 1x1 for
+     *                        nearest, 2x2 for linear and 4x4 for cubic interpolation.
+     * @throw nvcv::Exception ERROR_DEVICE if the kernel can't be launched.
+     */
+    static void run(cudaStream_t stream, const SrcWrap &src, const DstWrap &dst, int2 srcSize, int2 dstSize,
+                    int numSamples);
+
+private:
+    using WorkType = nvcv::cuda::ConvertBaseTypeTo<float, ValueType>;
+
+    static constexpr float kCubicA = -0.75f;
+
+    static __device__ void CubicWeights(float f, float (&w)[4]);
+};
+
+/**@}*/
+
+namespace detail {
+
+template<class R>
+__global__ void ResizeKernel(typename R::SrcWrap src, typename R::DstWrap dst, int2 srcSize, int2 dstSize,
+                             float2 scale, int numSamples)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    if (x >= dstSize.x || y >= dstSize.y)
+    {
+        return;
+    }
+
+    // grid is capped in z, samples beyond it are strided
+    for (int z = blockIdx.z; z < numSamples; z += gridDim.z)
+    {
+        int3 coord{x, y, z};
+        dst[coord] = R::pixel(src, srcSize, scale, coord);
+    }
+}
+
+} // namespace detail
+
+// Resize implementation -----------------------------------
+
+template<typename BT, int C, NVCVInterpolationType I>
+inline __device__ void Resize<BT, C, I>::CubicWeights(float f, float (&w)[4])
+{
+    constexpr float A = kCubicA;
+
+    w[0] = ((A * (f + 1.0f) - 5.0f * A) * (f + 1.0f) + 8.0f * A) * (f + 1.0f) - 4.0f * A;
+    w[1] = ((A + 2.0f) * f - (A + 3.0f)) * f * f + 1.0f;
+    w[2] = ((A + 2.0f) * (1.0f - f) - (A + 3.0f)) * (1.0f - f) * (1.0f - f) + 1.0f;
+    w[3] = 1.0f - w[0] - w[1] - w[2];
+}
+
+template<typename BT, int C, NVCVInterpolationType I>
+inline __device__ auto Resize<BT, C, I>::pixel(const SrcWrap &src, int2 srcSize, float2 scale, int3 dstCoord)
+    -> ValueType
+{
+    namespace cuda = nvcv::cuda;
+
+    if constexpr (I == NVCV_INTERP_NEAREST)
+    {
+        const int sx = cuda::min(__float2int_rd(dstCoord.x * scale.x), srcSize.x - 1);
+        const int sy = cuda::min(__float2int_rd(dstCoord.y * scale.y), srcSize.y - 1);
+        return src[int3{sx, sy, dstCoord.z}];
+    }
+    else if constexpr (I == NVCV_INTERP_LINEAR)
+    {
+        float fy = (dstCoord.y + 0.5f) * scale.y - 0.5f;
+        int   sy = __float2int_rd(fy);
+        fy -= sy;
+        sy = cuda::max(0, cuda::min(sy, srcSize.y - 2));
+
+        float fx = (dstCoord.x + 0.5f) * scale.x - 0.5f;
+        int   sx = __float2int_rd(fx);
+        fx -= sx;
+        fx *= ((sx >= 0) && (sx < srcSize.x - 1));
+        sx = cuda::max(0, cuda::min(sx, srcSize.x - 2));
+
+        const ValueType *aPtr = src.ptr(dstCoord.z, sy, sx);
+        const ValueType *bPtr = src.ptr(dstCoord.z, sy + 1, sx);
+
+        return cuda::SaturateCast<ValueType>((1.0f - fx) * (aPtr[0] * (1.0f - fy) + bPtr[0] * fy)
+                                             + fx * (aPtr[1] * (1.0f - fy) + bPtr[1] * fy));
+    }
+    else
+    {
+        float fy = (dstCoord.y + 0.5f) * scale.y - 0.5f;
+        int   sy = __float2int_rd(fy);
+        fy -= sy;
+        sy = cuda::max(1, cuda::min(sy, srcSize.y - 3));
+
+        float fx = (dstCoord.x + 0.5f) * scale.x - 0.5f;
+        int   sx = __float2int_rd(fx);
+        fx -= sx;
+        fx *= ((sx >= 1) && (sx < srcSize.x - 3));
+        sx = cuda::max(1, cuda::min(sx, srcSize.x - 3));
+
+        float cX[4], cY[4];
+        CubicWeights(fx, cX);
+        CubicWeights(fy, cY);
+
+        WorkType accum = cuda::SetAll<WorkType>(0);
+#pragma unroll
+        for (int row = 0; row < 4; ++row)
+        {
+            const ValueType *rowPtr = src.ptr(dstCoord.z, sy + row - 1, sx - 1);
+            accum += cY[row] * (cX[0] * rowPtr[0] + cX[1] * rowPtr[1] + cX[2] * rowPtr[2] + cX[3] * rowPtr[3]);
+        }
+
+        // the operator takes the absolute value, negative results aren't clamped to 0
+        return cuda::SaturateCast<ValueType>(cuda::abs(accum));
+    }
+}
+
+template<typename BT, int C, NVCVInterpolationType I>
+inline void Resize<BT, C, I>::run(cudaStream_t stream, const SrcWrap &src, const DstWrap &dst, int2 srcSize,
+                                  int2 dstSize, int numSamples)
+{
+    if (numSamples <= 0 || dstSize.x <= 0 || dstSize.y <= 0)
+    {
+        return;
+    }
+
+    constexpr int kMinSrcSize = I == NVCV_INTERP_NEAREST ? 1 : (I == NVCV_INTERP_LINEAR ? 2 : 4);
+
+    if (srcSize.x < kMinSrcSize || srcSize.y < kMinSrcSize)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Source size %dx%d is too small, the interpolation needs at least %dx%d pixels",
+                              srcSize.x, srcSize.y, kMinSrcSize, kMinSrcSize);
+    }
+
+    constexpr int kMaxGridDimZ = 65535;
+
+    dim3 block(32, 8);
+    dim3 grid((dstSize.x + block.x - 1) / block.x, (dstSize.y + block.y - 1) / block.y,
+              numSamples < kMaxGridDimZ ? numSamples : kMaxGridDimZ);
+
+    detail::ResizeKernel<Resize><<<grid, block, 0, stream>>>(src, dst, srcSize, dstSize, Scale(srcSize, dstSize),
+                                                             numSamples);
+
+    cudaError_t err = cudaGetLastError();
+    if (err != cudaSuccess)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_DEVICE, "Resize kernel launch failed: %s",
+                              cudaGetErrorString(err));
+    }
+}
+
+} // namespace cvcuda::cuda
+
+#endif // CVCUDA_CUDA_RESIZE_HPP
@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CropView.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/Tensor.h>
+#include <nvcv/TensorShape.hpp>
+
+namespace cvcuda::priv {
+
+namespace {
+
+struct SpatialDims
+{
+    int     h, w;
+    int64_t height, width;
+};
+
+SpatialDims GetSpatialDims(const nvcv::ITensor &in)
+{
+    const nvcv::TensorShape shape = in.shape();
+
+    SpatialDims dims;
+    dims.h = shape.layout().find('H');
+    dims.w = shape.layout().find('W');
+    if (dims.h < 0 || dims.w < 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input layout must have H and W dimensions");
+    }
+    dims.height = shape[dims.h];
+    dims.width  = shape[dims.w];
+    return dims;
+}
+
+NVCVTensorHandle SliceRect(const nvcv::ITensor &in, const SpatialDims &dims, const NVCVRectI &rect)
+{
+    if (rect.width <= 0 || rect.height <= 0 || rect.x < 0 || rect.y < 0 || rect.x + rect.width > dims.width
+        || rect.y + rect.height > dims.height)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Crop rectangle x=%d y=%d width=%d height=%d must be inside the %ldx%ld input",
+                              rect.x, rect.y, rect.width, rect.height, static_cast<long>(dims.width),
+                              static_cast<long>(dims.height));
+    }
+
+    NVCVTensorHandle rows = nullptr;
+    nvcv::detail::CheckThrow(nvcvTensorSlice(in.handle(), dims.h, rect.y, rect.y + rect.height, &rows));
+
+    // the view of the columns holds a reference to the view of the rows, which holds one to the input
+    NVCVTensorHandle view   = nullptr;
+    NVCVStatus       status = nvcvTensorSlice(rows, dims.w, rect.x, rect.x + rect.width, &view);
+    nvcvTensorDecRef(rows, nullptr);
+    nvcv::detail::CheckThrow(status);
+
+    return view;
+}
+
+} // namespace
+
+NVCVTensorHandle CreateCropView(const nvcv::ITensor &in, const NVCVRectI &rect)
+{
+    return SliceRect(in, GetSpatialDims(in), rect);
+}
+
+NVCVTensorHandle CreateCenterCropView(const nvcv::ITensor &in, const nvcv::Size2D &cropSize)
+{
+    const SpatialDims dims = GetSpatialDims(in);
+
+    NVCVRectI rect;
+    rect.width  = cropSize.w;
+    rect.height = cropSize.h;
+    rect.x      = static_cast<int>((dims.width - cropSize.w) / 2);
+    rect.y      = static_cast<int>((dims.height - cropSize.h) / 2);
+
+    return SliceRect(in, dims, rect);
+}
+
+} // namespace cvcuda::priv
@@ -0,0 +1,42 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file CropView.hpp
+ *
+ * @brief Defines the zero-copy views of a crop of every sample of a tensor.
+ */
+
+#ifndef CVCUDA_PRIV_CROP_VIEW_HPP
+#define CVCUDA_PRIV_CROP_VIEW_HPP
+
+#include <nvcv/ITensor.hpp>
+#include <nvcv/Rect.h>
+#include <nvcv/Size.hpp>
+
+namespace cvcuda::priv {
+
+// Creates a tensor viewing the rectangle of every sample of the input, i.e. what CustomCrop would copy.  The view
+// aliases the input memory with an offset base pointer and the input strides, and keeps the input alive.
+NVCVTensorHandle CreateCropView(const nvcv::ITensor &in, const NVCVRectI &rect);
+
+// Creates a tensor viewing the centered crop of every sample of the input, rounded as CenterCrop does.
+NVCVTensorHandle CreateCenterCropView(const nvcv::ITensor &in, const nvcv::Size2D &cropSize);
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_CROP_VIEW_HPP
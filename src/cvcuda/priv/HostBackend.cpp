@@ -0,0 +1,398 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HostBackend.hpp"
+
+#include "InPlace.hpp"
+
+#include <cuda_fp16.h>
+#include <nvcv/Exception.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/cuda/SaturateCast.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cvcuda::priv::host {
+
+namespace {
+
+// Below this many bytes per thread, starting a thread costs more than what it saves
+constexpr int64_t kMinBytesPerThread = 256 * 1024;
+
+// Calls func(begin, end) over chunks of [0, count), each item touching about itemBytes, the last chunk in the
+// calling thread and the others in as many threads as the work and the hardware justify.
+template<class F>
+void ParallelFor(int64_t count, int64_t itemBytes, F &&func)
+{
+    const int64_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    int64_t numThreads = std::min({maxThreads, count, count * itemBytes / kMinBytesPerThread});
+    if (numThreads <= 1)
+    {
+        func(int64_t{0}, count);
+        return;
+    }
+
+    const int64_t chunk = (count + numThreads - 1) / numThreads;
+
+    std::vector<std::thread> workers;
+    workers.reserve(numThreads - 1);
+    for (int64_t begin = 0; begin + chunk < count; begin += chunk)
+    {
+        workers.emplace_back([&func, begin, chunk] { func(begin, begin + chunk); });
+    }
+
+    func(static_cast<int64_t>(workers.size()) * chunk, count);
+
+    for (std::thread &t : workers)
+    {
+        t.join();
+    }
+}
+
+nvcv::TensorDataAccessStridedImagePlanar CreateAccess(const nvcv::ITensorDataStridedHost &data, const char *name)
+{
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(data);
+    if (!access)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "%s tensor must have an image layout", name);
+    }
+    return *access;
+}
+
+void CheckInterleaved(const nvcv::TensorDataAccessStridedImagePlanar &access, const char *name)
+{
+    if (access.infoLayout().isChannelFirst() || access.numChannels() > 4)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "%s tensor must have HWC or NHWC layout with at most 4 channels", name);
+    }
+}
+
+void CheckSameImageShape(const nvcv::TensorDataAccessStridedImagePlanar &in,
+                         const nvcv::TensorDataAccessStridedImagePlanar &out)
+{
+    if (in.numSamples() != out.numSamples() || in.numRows() != out.numRows() || in.numCols() != out.numCols()
+        || in.numChannels() != out.numChannels())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input and output tensors must have the same number of samples, rows, columns and "
+                              "channels");
+    }
+}
+
+// Calls func(T{}) with the type of the channels of dtype
+template<class F>
+void DispatchType(nvcv::DataType dtype, const char *name, F &&func)
+{
+    const int bits = dtype.bitsPerChannel()[0];
+
+    switch (dtype.dataKind())
+    {
+    case nvcv::DataKind::UNSIGNED:
+        switch (bits)
+        {
+        case 8:
+            return func(uint8_t{});
+        case 16:
+            return func(uint16_t{});
+        }
+        break;
+
+    case nvcv::DataKind::SIGNED:
+        switch (bits)
+        {
+        case 8:
+            return func(int8_t{});
+        case 16:
+            return func(int16_t{});
+        case 32:
+            return func(int32_t{});
+        }
+        break;
+
+    case nvcv::DataKind::FLOAT:
+        switch (bits)
+        {
+        case 16:
+            return func(__half{});
+        case 32:
+            return func(float{});
+        case 64:
+            return func(double{});
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "%s tensor data type is not supported", name);
+}
+
+// Pixels moved as a whole, so that mirroring rows compiles to plain loads and stores
+template<int N>
+struct Pixel
+{
+    nvcv::Byte bytes[N];
+};
+
+template<class P>
+void FlipRows(const nvcv::TensorDataAccessStridedImagePlanar &in, const nvcv::TensorDataAccessStridedImagePlanar &out,
+              int32_t flipCode, bool inplace)
+{
+    const int  rows  = in.numRows();
+    const int  cols  = in.numCols();
+    const bool flipX = flipCode != 0;
+    const bool flipY = flipCode <= 0;
+
+    ParallelFor(static_cast<int64_t>(in.numSamples()) * rows, cols * sizeof(P),
+                [&](int64_t begin, int64_t end)
+                {
+                    for (int64_t i = begin; i < end; ++i)
+                    {
+                        const int n  = i / rows;
+                        const int y  = i % rows;
+                        const int my = flipY ? rows - 1 - y : y;
+
+                        const P *src = reinterpret_cast<const P *>(in.rowData(my, in.sampleData(n)));
+                        P       *dst = reinterpret_cast<P *>(out.rowData(y, out.sampleData(n)));
+
+                        if (inplace)
+                        {
+                            // Each pair of mirrored rows is swapped once, by the one that comes first
+                            if (my < y)
+                            {
+                                continue;
+                            }
+                            if (my == y)
+                            {
+                                if (flipX)
+                                {
+                                    std::reverse(dst, dst + cols);
+                                }
+                            }
+                            else if (flipX)
+                            {
+                                P *mirror = const_cast<P *>(src);
+                                for (int x = 0; x < cols; ++x)
+                                {
+                                    std::swap(dst[x], mirror[cols - 1 - x]);
+                                }
+                            }
+                            else
+                            {
+                                std::swap_ranges(dst, dst + cols, const_cast<P *>(src));
+                            }
+                        }
+                        else if (flipX)
+                        {
+                            for (int x = 0; x < cols; ++x)
+                            {
+                                dst[x] = src[cols - 1 - x];
+                            }
+                        }
+                        else
+                        {
+                            std::memcpy(dst, src, cols * sizeof(P));
+                        }
+                    }
+                });
+}
+
+template<class ST, class DT>
+void ConvertRows(const nvcv::TensorDataAccessStridedImagePlanar &in,
+                 const nvcv::TensorDataAccessStridedImagePlanar &out, int rowLength, double alpha, double beta)
+{
+    namespace cuda = nvcv::cuda;
+
+    // Same computation type as the cuda implementation, with half-precision values scaled in float
+    using S = decltype(float() * std::conditional_t<std::is_same_v<ST, __half>, float, ST>()
+                       * std::conditional_t<std::is_same_v<DT, __half>, float, DT>());
+
+    const S a = cuda::SaturateCast<S>(alpha);
+    const S b = cuda::SaturateCast<S>(beta);
+
+    const int rows = in.numRows();
+
+    ParallelFor(static_cast<int64_t>(in.numSamples()) * rows, rowLength * sizeof(DT),
+                [&](int64_t begin, int64_t end)
+                {
+                    for (int64_t i = begin; i < end; ++i)
+                    {
+                        const int n = i / rows;
+                        const int y = i % rows;
+
+                        const ST *src = reinterpret_cast<const ST *>(in.rowData(y, in.sampleData(n)));
+                        DT       *dst = reinterpret_cast<DT *>(out.rowData(y, out.sampleData(n)));
+
+                        for (int x = 0; x < rowLength; ++x)
+                        {
+                            dst[x] = cuda::SaturateCast<DT>(a * cuda::SaturateCast<S>(src[x]) + b);
+                        }
+                    }
+                });
+}
+
+} // namespace
+
+std::optional<TensorsData> ExportData(const nvcv::ITensor &in, const nvcv::ITensor &out)
+{
+    auto *inData  = dynamic_cast<const nvcv::ITensorDataStridedHost *>(in.exportData());
+    auto *outData = dynamic_cast<const nvcv::ITensorDataStridedHost *>(out.exportData());
+
+    if ((inData == nullptr) != (outData == nullptr))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input and output tensors must be both in host memory or both cuda-accessible");
+    }
+
+    if (inData == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    return TensorsData{*inData, *outData};
+}
+
+void Flip(const nvcv::ITensorDataStridedHost &in, const nvcv::ITensorDataStridedHost &out, int32_t flipCode)
+{
+    if (in.dtype() != out.dtype())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input and output tensors must have the same data type");
+    }
+
+    auto inAccess  = CreateAccess(in, "Input");
+    auto outAccess = CreateAccess(out, "Output");
+    CheckInterleaved(inAccess, "Input");
+    CheckInterleaved(outAccess, "Output");
+    CheckSameImageShape(inAccess, outAccess);
+
+    const bool inplace = CheckInPlace(in, out);
+
+    // Flip only moves pixels, they're moved as opaque blocks of bytes whatever their type
+    switch (in.dtype().strideBytes() * inAccess.numChannels())
+    {
+#define CVCUDA_HOST_FLIP_CASE(N)                                     \
+    case N:                                                          \
+        return FlipRows<Pixel<N>>(inAccess, outAccess, flipCode, inplace)
+
+        CVCUDA_HOST_FLIP_CASE(1);
+        CVCUDA_HOST_FLIP_CASE(2);
+        CVCUDA_HOST_FLIP_CASE(3);
+        CVCUDA_HOST_FLIP_CASE(4);
+        CVCUDA_HOST_FLIP_CASE(6);
+        CVCUDA_HOST_FLIP_CASE(8);
+        CVCUDA_HOST_FLIP_CASE(12);
+        CVCUDA_HOST_FLIP_CASE(16);
+        CVCUDA_HOST_FLIP_CASE(24);
+        CVCUDA_HOST_FLIP_CASE(32);
+
+#undef CVCUDA_HOST_FLIP_CASE
+
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Tensor pixel size is not supported");
+    }
+}
+
+void ConvertTo(const nvcv::ITensorDataStridedHost &in, const nvcv::ITensorDataStridedHost &out, double alpha,
+               double beta)
+{
+    auto inAccess  = CreateAccess(in, "Input");
+    auto outAccess = CreateAccess(out, "Output");
+    CheckInterleaved(inAccess, "Input");
+    CheckInterleaved(outAccess, "Output");
+    CheckSameImageShape(inAccess, outAccess);
+
+    if (in.dtype().numChannels() != out.dtype().numChannels())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input and output tensors must have the same number of channels");
+    }
+
+    CheckInPlace(in, out);
+
+    // The scale is the same for all channels, rows are converted as flat arrays of values
+    const int rowLength = inAccess.numCols() * inAccess.numChannels() * in.dtype().numChannels();
+
+    DispatchType(in.dtype(), "Input",
+                 [&](auto st)
+                 {
+                     DispatchType(out.dtype(), "Output",
+                                  [&](auto dt) {
+                                      ConvertRows<decltype(st), decltype(dt)>(inAccess, outAccess, rowLength, alpha,
+                                                                              beta);
+                                  });
+                 });
+}
+
+void Reformat(const nvcv::ITensorDataStridedHost &in, const nvcv::ITensorDataStridedHost &out)
+{
+    if (in.dtype() != out.dtype())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input and output tensors must have the same data type");
+    }
+
+    auto inAccess  = CreateAccess(in, "Input");
+    auto outAccess = CreateAccess(out, "Output");
+    CheckSameImageShape(inAccess, outAccess);
+
+    if (CheckInPlace(in, out))
+    {
+        return;
+    }
+
+    const int     rows      = inAccess.numRows();
+    const int     cols      = inAccess.numCols();
+    const int     channels  = inAccess.numChannels();
+    const int64_t elemBytes = in.dtype().strideBytes();
+
+    // Each value is copied by the offset computed from its coordinates, which covers planar and interleaved layouts
+    // in any combination
+    ParallelFor(static_cast<int64_t>(inAccess.numSamples()) * rows, cols * channels * elemBytes,
+                [&](int64_t begin, int64_t end)
+                {
+                    for (int64_t i = begin; i < end; ++i)
+                    {
+                        const int n = i / rows;
+                        const int y = i % rows;
+
+                        const nvcv::Byte *srcRow = inAccess.rowData(y, inAccess.sampleData(n));
+                        nvcv::Byte       *dstRow = outAccess.rowData(y, outAccess.sampleData(n));
+
+                        for (int c = 0; c < channels; ++c)
+                        {
+                            const nvcv::Byte *src = srcRow + c * inAccess.chStride();
+                            nvcv::Byte       *dst = dstRow + c * outAccess.chStride();
+
+                            for (int x = 0; x < cols; ++x)
+                            {
+                                std::memcpy(dst + x * outAccess.colStride(), src + x * inAccess.colStride(),
+                                            elemBytes);
+                            }
+                        }
+                    }
+                });
+}
+
+} // namespace cvcuda::priv::host
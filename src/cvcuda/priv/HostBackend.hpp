@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file HostBackend.hpp
+ *
+ * @brief Defines the host implementations of operators, used when their tensors are in host memory.
+ */
+
+#ifndef CVCUDA_PRIV_HOST_BACKEND_HPP
+#define CVCUDA_PRIV_HOST_BACKEND_HPP
+
+#include <nvcv/ITensor.hpp>
+#include <nvcv/ITensorData.hpp>
+
+#include <optional>
+
+namespace cvcuda::priv::host {
+
+struct TensorsData
+{
+    const nvcv::ITensorDataStridedHost &in;
+    const nvcv::ITensorDataStridedHost &out;
+};
+
+// Returns the data of in and out when both are in host memory, nothing when neither is.  Throws
+// ERROR_INVALID_ARGUMENT when only one of them is, as operators run either on the host or on the device.
+std::optional<TensorsData> ExportData(const nvcv::ITensor &in, const nvcv::ITensor &out);
+
+// The operations below run synchronously in the calling thread and a few worker threads, when the tensors are large
+// enough for them to be worth it.  They accept the same layouts and data types as their cuda counterparts.
+
+void Flip(const nvcv::ITensorDataStridedHost &in, const nvcv::ITensorDataStridedHost &out, int32_t flipCode);
+
+void ConvertTo(const nvcv::ITensorDataStridedHost &in, const nvcv::ITensorDataStridedHost &out, double alpha,
+               double beta);
+
+void Reformat(const nvcv::ITensorDataStridedHost &in, const nvcv::ITensorDataStridedHost &out);
+
+} // namespace cvcuda::priv::host
+
+#endif // CVCUDA_PRIV_HOST_BACKEND_HPP
@@ -12,10 +12,53 @@
 
 #include "IOperator.hpp"
 
+#include <cstdint>
 #include <sstream>
 
 namespace cvcuda::priv {
 
+namespace {
+
+// Same as what cudaMalloc guarantees, so that operators can use
+// the workspace as if allocated by them.
+constexpr int32_t kCudaWorkspaceAlignment = 256;
+
+} // namespace
+
+NVCVOperatorWorkspaceRequirements IOperator::workspaceRequirements() const
+{
+    NVCVOperatorWorkspaceRequirements reqs;
+    reqs.cudaMemSize      = doGetCudaWorkspaceSize();
+    reqs.cudaMemAlignment = kCudaWorkspaceAlignment;
+    return reqs;
+}
+
+void IOperator::setWorkspace(void *cudaMem, int64_t size)
+{
+    if (cudaMem != nullptr)
+    {
+        int64_t reqSize = doGetCudaWorkspaceSize();
+        if (size < reqSize)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Workspace size must be at least %ld bytes, not %ld", reqSize, size);
+        }
+
+        if (reinterpret_cast<uintptr_t>(cudaMem) % kCudaWorkspaceAlignment != 0)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Workspace must be aligned to %d bytes",
+                                  kCudaWorkspaceAlignment);
+        }
+    }
+
+    doSetCudaWorkspace(cudaMem);
+}
+
+void IOperator::reserveWorkspace(cudaStream_t stream)
+{
+    doReserveCudaWorkspace(stream);
+}
+
 IOperator *ToOperatorPtr(void *handle)
 {
     // First cast to the operator interface, this must always succeed.
@@ -21,6 +21,7 @@
 
 #include "Version.hpp"
 
+#include <cuda_runtime.h>
 #include <cvcuda/Operator.h>
 #include <nvcv/Exception.hpp>
 
@@ -43,6 +44,29 @@ public:
     {
         return CURRENT_VERSION;
     }
+
+    NVCVOperatorWorkspaceRequirements workspaceRequirements() const;
+
+    void setWorkspace(void *cudaMem, int64_t size);
+
+    void reserveWorkspace(cudaStream_t stream);
+
+private:
+    // Operators that need a workspace must override all three
+    virtual int64_t doGetCudaWorkspaceSize() const
+    {
+        return 0;
+    }
+
+    virtual void doSetCudaWorkspace(void *cudaMem)
+    {
+        (void)cudaMem;
+    }
+
+    virtual void doReserveCudaWorkspace(cudaStream_t stream)
+    {
+        (void)stream;
+    }
 };
 
 IOperator *ToOperatorPtr(void *handle);
@@ -72,6 +96,26 @@ inline T &ToDynamicRef(NVCVOperatorHandle h)
     }
 }
 
+// Same checks as ToDynamicRef, but errors are set as the thread's status and returned instead of thrown.
+template<class T>
+inline NVCVStatus TryToDynamicPtr(NVCVOperatorHandle h, T *&op)
+{
+    if (h == nullptr)
+    {
+        nvcvSetThreadStatus(NVCV_ERROR_INVALID_ARGUMENT, "Handle cannot be NULL");
+        return NVCV_ERROR_INVALID_ARGUMENT;
+    }
+
+    op = ToDynamicPtr<T>(h);
+    if (op == nullptr)
+    {
+        nvcvSetThreadStatus(NVCV_ERROR_NOT_COMPATIBLE,
+                            "Handle doesn't correspond to the requested object or was already destroyed.");
+        return NVCV_ERROR_NOT_COMPATIBLE;
+    }
+    return NVCV_SUCCESS;
+}
+
 } // namespace cvcuda::priv
 
 #endif // CVCUDA_PRIV_IOPERATOR_HPP
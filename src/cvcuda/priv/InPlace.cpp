@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "InPlace.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/IImageData.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <tuple>
+#include <vector>
+
+namespace cvcuda::priv {
+
+namespace {
+
+// Bytes spanned by a strided buffer, from its first to its last element, and how they are addressed.  Two buffers
+// with the same range and addressing hold the same elements.
+struct MemoryRange
+{
+    const nvcv::Byte *begin;
+    const nvcv::Byte *end;
+    int64_t           rowStride;
+    int64_t           rowBytes;
+
+    bool isOutput;
+    int  index;
+
+    bool sameDataAs(const MemoryRange &that) const
+    {
+        return begin == that.begin && end == that.end && rowStride == that.rowStride && rowBytes == that.rowBytes;
+    }
+
+    bool overlaps(const MemoryRange &that) const
+    {
+        return begin < that.end && that.begin < end;
+    }
+};
+
+void AddImageRanges(std::vector<MemoryRange> &ranges, const nvcv::IImageBatchVarShape &batch, bool isOutput)
+{
+    for (int i = 0; i < batch.numImages(); ++i)
+    {
+        auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(batch[i].exportData());
+        if (data == nullptr)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Images must be cuda-accessible, pitch-linear images");
+        }
+
+        for (int p = 0; p < data->numPlanes(); ++p)
+        {
+            const nvcv::ImagePlaneStrided &plane = data->plane(p);
+            if (plane.width <= 0 || plane.height <= 0)
+            {
+                continue;
+            }
+
+            const int64_t rowBytes = static_cast<int64_t>(plane.width) * data->format().planePixelStrideBytes(p);
+            const int64_t numBytes = static_cast<int64_t>(plane.height - 1) * plane.rowStride + rowBytes;
+
+            const nvcv::Byte *basePtr = reinterpret_cast<const nvcv::Byte *>(plane.basePtr);
+
+            ranges.push_back({basePtr, basePtr + numBytes, plane.rowStride, rowBytes, isOutput, i});
+        }
+    }
+}
+
+[[noreturn]] void ThrowUnsafeOverlap()
+{
+    throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                          "Output overlaps the input without being the same data, it can't be computed in place");
+}
+
+} // namespace
+
+bool CheckInPlace(const nvcv::ITensorDataStrided &in, const nvcv::ITensorDataStrided &out)
+{
+    if (in.basePtr() == out.basePtr() && in.shape() == out.shape() && in.dtype() == out.dtype())
+    {
+        bool sameStrides = true;
+        for (int d = 0; d < in.rank(); ++d)
+        {
+            sameStrides = sameStrides && in.stride(d) == out.stride(d);
+        }
+        if (sameStrides)
+        {
+            return true;
+        }
+    }
+
+    auto extent = [](const nvcv::ITensorDataStrided &data) -> int64_t
+    {
+        int64_t bytes = data.dtype().strideBytes();
+        for (int d = 0; d < data.rank(); ++d)
+        {
+            if (data.shape(d) <= 0)
+            {
+                return 0;
+            }
+            bytes += (data.shape(d) - 1) * data.stride(d);
+        }
+        return bytes;
+    };
+
+    const nvcv::Byte *inBegin  = in.basePtr();
+    const nvcv::Byte *outBegin = out.basePtr();
+    if (inBegin < outBegin + extent(out) && outBegin < inBegin + extent(in))
+    {
+        ThrowUnsafeOverlap();
+    }
+
+    return false;
+}
+
+bool CheckInPlace(const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out)
+{
+    std::vector<MemoryRange> ranges;
+    AddImageRanges(ranges, in, false);
+    AddImageRanges(ranges, out, true);
+
+    std::sort(ranges.begin(), ranges.end(),
+              [](const MemoryRange &a, const MemoryRange &b)
+              { return std::tie(a.begin, a.end, a.isOutput) < std::tie(b.begin, b.end, b.isOutput); });
+
+    // Ranges with the same data are grouped, the only safe group with an output is an input image and the output
+    // image at the same index.  Distinct groups must not overlap when one has an input and the other an output.
+    const nvcv::Byte *inEnd      = nullptr;
+    const nvcv::Byte *outEnd     = nullptr;
+    int               numInPlace = 0;
+
+    for (size_t first = 0; first < ranges.size();)
+    {
+        size_t last = first + 1;
+        while (last < ranges.size() && ranges[last].sameDataAs(ranges[first]))
+        {
+            ++last;
+        }
+
+        int numIn = 0, numOut = 0;
+        for (size_t i = first; i < last; ++i)
+        {
+            (ranges[i].isOutput ? numOut : numIn) += 1;
+        }
+
+        const MemoryRange &group = ranges[first];
+        if ((numOut > 0 && inEnd != nullptr && group.begin < inEnd)
+            || (numIn > 0 && outEnd != nullptr && group.begin < outEnd))
+        {
+            ThrowUnsafeOverlap();
+        }
+
+        if (numIn > 0 && numOut > 0)
+        {
+            // Inputs are sorted before outputs
+            if (numIn != 1 || numOut != 1 || ranges[first].index != ranges[first + 1].index)
+            {
+                ThrowUnsafeOverlap();
+            }
+            ++numInPlace;
+        }
+
+        if (numIn > 0)
+        {
+            inEnd = std::max(inEnd, group.end, std::less<>());
+        }
+        if (numOut > 0)
+        {
+            outEnd = std::max(outEnd, group.end, std::less<>());
+        }
+
+        first = last;
+    }
+
+    // numInPlace counts planes, so it's compared with the number of output planes
+    int numOutPlanes = 0;
+    for (const MemoryRange &range : ranges)
+    {
+        numOutPlanes += range.isOutput ? 1 : 0;
+    }
+
+    return numOutPlanes > 0 && in.numImages() == out.numImages() && numInPlace == numOutPlanes;
+}
+
+} // namespace cvcuda::priv
@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file InPlace.hpp
+ *
+ * @brief Defines the checks of operators that can run in place, with the output being the input.
+ */
+
+#ifndef CVCUDA_PRIV_IN_PLACE_HPP
+#define CVCUDA_PRIV_IN_PLACE_HPP
+
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensorData.hpp>
+
+namespace cvcuda::priv {
+
+// Returns whether in and out are the same data, with the same shape, strides and type, in which case operators
+// supporting it run in place.  Throws ERROR_INVALID_ARGUMENT when their memory overlaps any other way, since the
+// output would overwrite input values that are still to be read.
+bool CheckInPlace(const nvcv::ITensorDataStrided &in, const nvcv::ITensorDataStrided &out);
+
+// Same as above for image batches, returns whether every output image is the input image at the same index.
+// Throws when an output image overlaps any input image that isn't itself, e.g. when an image of the input batch is
+// also in the output batch at another index.
+bool CheckInPlace(const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out);
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_IN_PLACE_HPP
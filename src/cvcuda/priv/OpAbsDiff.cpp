@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpAbsDiff.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <util/CheckError.hpp>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+namespace {
+
+const nvcv::ITensorDataStridedCuda &ExportData(const nvcv::ITensor &tensor, const char *name)
+{
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    if (data == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "%s must be cuda-accessible, pitch-linear tensor", name);
+    }
+    return *data;
+}
+
+} // namespace
+
+AbsDiff::AbsDiff()
+{
+    legacy::DataShape maxIn, maxOut;
+    //maxIn/maxOut not used by op.
+    m_legacyOp = std::make_unique<legacy::AbsDiff>(maxIn, maxOut);
+}
+
+void AbsDiff::operator()(cudaStream_t stream, const nvcv::ITensor &in1, const nvcv::ITensor &in2,
+                         const nvcv::ITensor &out) const
+{
+    const nvcv::ITensorDataStridedCuda &in1Data = ExportData(in1, "Input 1");
+    const nvcv::ITensorDataStridedCuda &in2Data = ExportData(in2, "Input 2");
+    const nvcv::ITensorDataStridedCuda &outData = ExportData(out, "Output");
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(in1Data, in2Data, outData, stream));
+}
+
+} // namespace cvcuda::priv
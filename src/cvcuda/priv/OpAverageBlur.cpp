@@ -23,6 +23,8 @@
 #include <nvcv/Exception.hpp>
 #include <util/CheckError.hpp>
 
+#include <algorithm>
+
 namespace cvcuda::priv {
 
 namespace legacy = nvcv::legacy::cuda_op;
@@ -51,6 +53,15 @@ void AverageBlur::operator()(cudaStream_t stream, const nvcv::ITensor &in, const
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
+    // Planar tensors are blurred as batches of single-channel planes
+    auto inPlanes  = nvcv::legacy::helpers::PlanesAsSamples(*inData);
+    auto outPlanes = nvcv::legacy::helpers::PlanesAsSamples(*outData);
+    if (inPlanes && outPlanes)
+    {
+        inData  = &*inPlanes;
+        outData = &*outPlanes;
+    }
+
     NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, kernelSize, kernelAnchor, borderMode, stream));
 }
 
@@ -90,4 +101,22 @@ void AverageBlur::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShap
         m_legacyOpVarShape->infer(*inData, *outData, *kernelSizeData, *kernelAnchorData, borderMode, stream));
 }
 
+int64_t AverageBlur::doGetCudaWorkspaceSize() const
+{
+    // Tensor and varshape implementations aren't executed at the same time, they can share the workspace
+    return std::max(m_legacyOp->gpuWorkspaceSize(), m_legacyOpVarShape->gpuWorkspaceSize());
+}
+
+void AverageBlur::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOp->setGpuWorkspace(cudaMem);
+    m_legacyOpVarShape->setGpuWorkspace(cudaMem);
+}
+
+void AverageBlur::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOp->reserveGpuWorkspace(stream);
+    m_legacyOpVarShape->reserveGpuWorkspace(stream);
+}
+
 } // namespace cvcuda::priv
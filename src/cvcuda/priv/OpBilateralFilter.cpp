@@ -23,6 +23,8 @@
 #include <nvcv/Exception.hpp>
 #include <util/CheckError.hpp>
 
+#include <optional>
+
 namespace cvcuda::priv {
 
 namespace legacy = nvcv::legacy::cuda_op;
@@ -52,6 +54,19 @@ void BilateralFilter::operator()(cudaStream_t stream, const nvcv::ITensor &in, c
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
+    // Color distances are summed over channels, only single-channel planar tensors are filtered as interleaved ones
+    std::optional<nvcv::TensorDataStridedCuda> inPlanes, outPlanes;
+    if (auto inInfo = nvcv::TensorShapeInfoImage::Create(inData->shape()); inInfo && inInfo->numChannels() == 1)
+    {
+        inPlanes  = nvcv::legacy::helpers::PlanesAsSamples(*inData);
+        outPlanes = nvcv::legacy::helpers::PlanesAsSamples(*outData);
+        if (inPlanes && outPlanes)
+        {
+            inData  = &*inPlanes;
+            outData = &*outPlanes;
+        }
+    }
+
     NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, diameter, sigmaColor, sigmaSpace, borderMode, stream));
 }
 
@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpBoxDecode.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <util/CheckError.hpp>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+BoxDecode::BoxDecode()
+{
+    legacy::DataShape maxIn, maxOut;
+    //maxIn/maxOut not used by op.
+    m_legacyOp = std::make_unique<legacy::BoxDecode>(maxIn, maxOut);
+}
+
+void BoxDecode::operator()(cudaStream_t stream, const nvcv::ITensor &anchors, const nvcv::ITensor &deltas,
+                           const nvcv::ITensor &boxes, float varianceXY, float varianceWH) const
+{
+    auto *anchorData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(anchors.exportData());
+    if (anchorData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input anchors must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *deltaData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(deltas.exportData());
+    if (deltaData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input deltas must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *boxData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(boxes.exportData());
+    if (boxData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output boxes must be cuda-accessible, pitch-linear tensor");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(*anchorData, *deltaData, *boxData, varianceXY, varianceWH, stream));
+}
+
+} // namespace cvcuda::priv
@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpBuildPyramid.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+#include <util/CheckError.hpp>
+
+#include <functional>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+namespace {
+
+// Checks that the output holds numLevels images per sample, with the sizes of the levels of each sample.  They
+// are checked on the host, the kernels write each level within the bounds of its image.
+void CheckLevels(const nvcv::IImageBatchVarShape &out, int32_t numSamples, int32_t numLevels,
+                 const std::function<nvcv::Size2D(int32_t)> &baseSize)
+{
+    if (numLevels < 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Number of levels must be at least 1, not %d",
+                              numLevels);
+    }
+
+    if (out.numImages() != numSamples * numLevels)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must have %d images, %d per sample, not %d", numSamples * numLevels, numLevels,
+                              out.numImages());
+    }
+
+    for (int32_t n = 0; n < numSamples; ++n)
+    {
+        nvcv::Size2D size = baseSize(n);
+        for (int32_t l = 0; l < numLevels; ++l)
+        {
+            const nvcv::Size2D outSize = out[n * numLevels + l].size();
+            if (outSize != size)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Level %d of sample %d must be %dx%d, not %dx%d", l, n, size.w, size.h,
+                                      outSize.w, outSize.h);
+            }
+            size = nvcv::Size2D{(size.w + 1) / 2, (size.h + 1) / 2};
+        }
+    }
+}
+
+} // namespace
+
+BuildPyramid::BuildPyramid()
+{
+    legacy::DataShape maxIn, maxOut;
+    //maxIn/maxOut not used by op.
+    m_legacyOp         = std::make_unique<legacy::BuildPyramid>(maxIn, maxOut);
+    m_legacyOpVarShape = std::make_unique<legacy::BuildPyramidVarShape>();
+}
+
+void BuildPyramid::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::IImageBatchVarShape &out,
+                              int32_t numLevels, NVCVPyramidType type) const
+{
+    auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    if (!inAccess)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must have an image layout");
+    }
+
+    const nvcv::Size2D inSize{inAccess->numCols(), inAccess->numRows()};
+    CheckLevels(out, inAccess->numSamples(), numLevels, [&](int32_t) { return inSize; });
+
+    auto *outData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(out.exportData(stream));
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output must be varshape image batch");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, numLevels, type, stream));
+}
+
+void BuildPyramid::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in,
+                              const nvcv::IImageBatchVarShape &out, int32_t numLevels, NVCVPyramidType type) const
+{
+    CheckLevels(out, in.numImages(), numLevels, [&](int32_t n) { return in[n].size(); });
+
+    auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must be varshape image batch");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(out.exportData(stream));
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output must be varshape image batch");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, numLevels, type, stream));
+}
+
+} // namespace cvcuda::priv
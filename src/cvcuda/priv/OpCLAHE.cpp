@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpCLAHE.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <util/CheckError.hpp>
+
+#include <algorithm>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+CLAHE::CLAHE(int32_t maxBatchSize, int32_t maxTilesX, int32_t maxTilesY)
+{
+    m_legacyOp         = std::make_unique<legacy::CLAHE>(maxBatchSize, maxTilesX, maxTilesY);
+    m_legacyOpVarShape = std::make_unique<legacy::CLAHEVarShape>(maxBatchSize, maxTilesX, maxTilesY);
+}
+
+void CLAHE::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out, float clipLimit,
+                       int32_t tilesX, int32_t tilesY) const
+{
+    auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out.exportData());
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, clipLimit, tilesX, tilesY, stream));
+}
+
+void CLAHE::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out,
+                       float clipLimit, int32_t tilesX, int32_t tilesY) const
+{
+    if (out.numImages() != in.numImages())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output must have %d images, not %d",
+                              in.numImages(), out.numImages());
+    }
+
+    // Tiles are sized after each image, which must have at least one pixel per tile
+    for (int32_t i = 0; i < in.numImages(); ++i)
+    {
+        const nvcv::Size2D size = in[i].size();
+        if (out[i].size() != size)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Output image %d must have the size of the input", i);
+        }
+        if (size.w < tilesX || size.h < tilesY)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Image %d is %dx%d, it must have at least one pixel per tile of the %dx%d grid", i,
+                                  size.w, size.h, tilesX, tilesY);
+        }
+    }
+
+    auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, varshape pitch-linear image batch");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(out.exportData(stream));
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, varshape pitch-linear image batch");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, clipLimit, tilesX, tilesY, stream));
+}
+
+int64_t CLAHE::doGetCudaWorkspaceSize() const
+{
+    return std::max(m_legacyOp->gpuWorkspaceSize(), m_legacyOpVarShape->gpuWorkspaceSize());
+}
+
+void CLAHE::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOp->setGpuWorkspace(cudaMem);
+    m_legacyOpVarShape->setGpuWorkspace(cudaMem);
+}
+
+void CLAHE::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOp->reserveGpuWorkspace(stream);
+    m_legacyOpVarShape->reserveGpuWorkspace(stream);
+}
+
+} // namespace cvcuda::priv
@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpCLAHE.hpp
+ *
+ * @brief Defines the private C++ Class for the contrast limited adaptive histogram equalization operation.
+ */
+
+#ifndef CVCUDA_PRIV_CLAHE_HPP
+#define CVCUDA_PRIV_CLAHE_HPP
+
+#include "IOperator.hpp"
+#include "legacy/CvCudaLegacy.h"
+
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+
+#include <memory>
+
+namespace cvcuda::priv {
+
+class CLAHE final : public IOperator
+{
+public:
+    explicit CLAHE(int32_t maxBatchSize, int32_t maxTilesX, int32_t maxTilesY);
+
+    void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out, float clipLimit,
+                    int32_t tilesX, int32_t tilesY) const;
+
+    void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out,
+                    float clipLimit, int32_t tilesX, int32_t tilesY) const;
+
+private:
+    std::unique_ptr<nvcv::legacy::cuda_op::CLAHE>         m_legacyOp;
+    std::unique_ptr<nvcv::legacy::cuda_op::CLAHEVarShape> m_legacyOpVarShape;
+
+    int64_t doGetCudaWorkspaceSize() const override;
+    void    doSetCudaWorkspace(void *cudaMem) override;
+    void    doReserveCudaWorkspace(cudaStream_t stream) override;
+};
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_CLAHE_HPP
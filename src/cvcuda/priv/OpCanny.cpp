@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpCanny.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <util/CheckError.hpp>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+Canny::Canny()
+{
+    legacy::DataShape maxIn, maxOut;
+    //maxIn/maxOut not used by op.
+    m_legacyOp = std::make_unique<legacy::Canny>(maxIn, maxOut);
+}
+
+void Canny::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out, float thresholdLow,
+                       float thresholdHigh, int32_t apertureSize, bool l2Gradient) const
+{
+    auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out.exportData());
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    NVCV_CHECK_THROW(
+        m_legacyOp->infer(*inData, *outData, thresholdLow, thresholdHigh, apertureSize, l2Gradient, stream));
+}
+
+int64_t Canny::doGetCudaWorkspaceSize() const
+{
+    return m_legacyOp->gpuWorkspaceSize();
+}
+
+void Canny::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOp->setGpuWorkspace(cudaMem);
+}
+
+void Canny::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOp->reserveGpuWorkspace(stream);
+}
+
+} // namespace cvcuda::priv
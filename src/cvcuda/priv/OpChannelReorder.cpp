@@ -17,6 +17,7 @@
 
 #include "OpChannelReorder.hpp"
 
+#include "InPlace.hpp"
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
@@ -58,6 +59,7 @@ void ChannelReorder::operator()(cudaStream_t stream, const nvcv::IImageBatchVarS
                               "Input channel order tensor must be cuda-accessible, pitch-linear tensor");
     }
 
+    CheckInPlace(in, out);
     NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, *ordersData, stream));
 }
 
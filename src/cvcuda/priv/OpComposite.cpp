@@ -36,7 +36,7 @@ Composite::Composite()
 }
 
 void Composite::operator()(cudaStream_t stream, const nvcv::ITensor &foreground, const nvcv::ITensor &background,
-                           const nvcv::ITensor &fgMask, const nvcv::ITensor &output) const
+                           const nvcv::ITensor &fgMask, const nvcv::ITensor &output, int flags) const
 {
     auto *foregroundData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(foreground.exportData());
     if (foregroundData == nullptr)
@@ -66,7 +66,34 @@ void Composite::operator()(cudaStream_t stream, const nvcv::ITensor &foreground,
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
-    NVCV_CHECK_THROW(m_legacyOp->infer(*foregroundData, *backgroundData, *fgMaskData, *outData, stream));
+    NVCV_CHECK_THROW(m_legacyOp->infer(*foregroundData, *backgroundData, *fgMaskData, *outData, flags, stream));
+}
+
+void Composite::operator()(cudaStream_t stream, const nvcv::ITensor &foreground, const nvcv::ITensor &fgMask,
+                           const nvcv::ITensor &inOut, int2 offset, int flags) const
+{
+    auto *foregroundData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(foreground.exportData());
+    if (foregroundData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input foreground must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *fgMaskData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(fgMask.exportData());
+    if (fgMaskData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input fgMask must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *inOutData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inOut.exportData());
+    if (inOutData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Background must be cuda-accessible, pitch-linear tensor");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOp->inferROI(*foregroundData, *fgMaskData, *inOutData, offset, flags, stream));
 }
 
 void Composite::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &foreground,
@@ -41,7 +41,11 @@ public:
     explicit Composite();
 
     void operator()(cudaStream_t stream, const nvcv::ITensor &foreground, const nvcv::ITensor &background,
-                    const nvcv::ITensor &fgMask, const nvcv::ITensor &output) const;
+                    const nvcv::ITensor &fgMask, const nvcv::ITensor &output, int flags = 0) const;
+
+    // Composites the foreground into inOut in place, at the given offset
+    void operator()(cudaStream_t stream, const nvcv::ITensor &foreground, const nvcv::ITensor &fgMask,
+                    const nvcv::ITensor &inOut, int2 offset, int flags) const;
 
     void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &foreground,
                     const nvcv::IImageBatchVarShape &background, const nvcv::IImageBatchVarShape &fgMask,
@@ -27,10 +27,16 @@ namespace cvcuda::priv {
 
 namespace legacy = nvcv::legacy::cuda_op;
 
-Conv2D::Conv2D()
+Conv2D::Conv2D(NVCVConv2DAlgorithm algorithm)
 {
+    if (algorithm != NVCV_CONV2D_ALGO_AUTO && algorithm != NVCV_CONV2D_ALGO_DIRECT && algorithm != NVCV_CONV2D_ALGO_FFT)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid convolution algorithm %d",
+                              static_cast<int>(algorithm));
+    }
+
     legacy::DataShape maxIn, maxOut; //maxIn/maxOut not used by op.
-    m_legacyOpVarShape = std::make_unique<legacy::Conv2DVarShape>(maxIn, maxOut);
+    m_legacyOpVarShape = std::make_unique<legacy::Conv2DVarShape>(maxIn, maxOut, algorithm);
 }
 
 void Conv2D::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
@@ -65,7 +71,23 @@ void Conv2D::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in
                               "Kernel anchor must be cuda-accessible, pitch-linear tensor");
     }
 
-    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, *kernelData, *kernelAnchorData, borderMode, stream));
+    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, *kernelData, *kernelAnchorData, borderMode, stream,
+                                               nvcv::legacy::helpers::IsSparseBatch(out)));
+}
+
+int64_t Conv2D::doGetCudaWorkspaceSize() const
+{
+    return m_legacyOpVarShape->gpuWorkspaceSize();
+}
+
+void Conv2D::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOpVarShape->setGpuWorkspace(cudaMem);
+}
+
+void Conv2D::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOpVarShape->reserveGpuWorkspace(stream);
 }
 
 } // namespace cvcuda::priv
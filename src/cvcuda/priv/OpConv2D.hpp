@@ -37,13 +37,17 @@ namespace cvcuda::priv {
 class Conv2D final : public IOperator
 {
 public:
-    explicit Conv2D();
+    explicit Conv2D(NVCVConv2DAlgorithm algorithm = NVCV_CONV2D_ALGO_AUTO);
 
     void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, nvcv::IImageBatchVarShape &out,
                     const nvcv::IImageBatchVarShape &kernel, const nvcv::ITensor &kernelAnchor,
                     NVCVBorderType borderMode) const;
 
 private:
+    int64_t doGetCudaWorkspaceSize() const override;
+    void    doSetCudaWorkspace(void *cudaMem) override;
+    void    doReserveCudaWorkspace(cudaStream_t stream) override;
+
     std::unique_ptr<nvcv::legacy::cuda_op::Conv2DVarShape> m_legacyOpVarShape;
 };
 
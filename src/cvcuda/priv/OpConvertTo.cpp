@@ -17,12 +17,17 @@
 
 #include "OpConvertTo.hpp"
 
+#include "HostBackend.hpp"
+#include "InPlace.hpp"
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
 #include <nvcv/Exception.hpp>
+#include <nvcv/TensorDataAccess.hpp>
 #include <util/CheckError.hpp>
 
+#include <vector>
+
 namespace cvcuda::priv {
 
 namespace legacy = nvcv::legacy::cuda_op;
@@ -35,8 +40,50 @@ ConvertTo::ConvertTo()
 }
 
 void ConvertTo::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out, const double alpha,
-                           const double beta) const
+                           const double beta, const NVCVSwizzle channelOrder) const
+{
+    // Tensors in host memory are processed on the host, synchronously, the stream isn't used
+    if (auto hostData = host::ExportData(in, out))
+    {
+        if (channelOrder != NVCV_SWIZZLE_XYZW)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_NOT_COMPATIBLE,
+                                  "Channels can only be reordered in cuda-accessible tensors");
+        }
+        host::ConvertTo(hostData->in, hostData->out, alpha, beta);
+        return;
+    }
+
+    auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out.exportData());
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    auto order    = nvcv::legacy::helpers::GetLegacyChannelOrder(channelOrder, inAccess ? inAccess->numChannels() : 0);
+
+    CheckInPlace(*inData, *outData);
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, alpha, beta, order, stream));
+}
+
+void ConvertTo::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out,
+                           const nvcv::ITensor &alpha, const nvcv::ITensor &beta) const
 {
+    if (host::ExportData(in, out))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_NOT_COMPATIBLE,
+                              "Per-channel conversion is only supported on cuda-accessible tensors");
+    }
+
     auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
     if (inData == nullptr)
     {
@@ -51,7 +98,63 @@ void ConvertTo::operator()(cudaStream_t stream, const nvcv::ITensor &in, const n
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
-    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, alpha, beta, stream));
+    auto *alphaData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(alpha.exportData());
+    if (alphaData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Alpha must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *betaData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(beta.exportData());
+    if (betaData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Beta must be cuda-accessible, pitch-linear tensor");
+    }
+
+    CheckInPlace(*inData, *outData);
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, *alphaData, *betaData, stream));
+}
+
+void ConvertTo::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor *const *out,
+                           const NVCVConvertToParams *params, int32_t numOutputs) const
+{
+    auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    if (numOutputs <= 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Must have at least one output");
+    }
+
+    auto inAccess    = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    int  numChannels = inAccess ? inAccess->numChannels() : 0;
+
+    std::vector<const nvcv::ITensorDataStridedCuda *> outData(numOutputs);
+    std::vector<legacy::ChannelOrder>                  orders(numOutputs);
+    for (int32_t o = 0; o < numOutputs; ++o)
+    {
+        outData[o] = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out[o]->exportData());
+        if (outData[o] == nullptr)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Output must be cuda-accessible, pitch-linear tensor");
+        }
+
+        // The input is read once for all outputs, none of them may write over it
+        if (CheckInPlace(*inData, *outData[o]))
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output %d overlaps with the input", o);
+        }
+
+        orders[o] = nvcv::legacy::helpers::GetLegacyChannelOrder(params[o].channelOrder, numChannels);
+    }
+
+    NVCV_CHECK_THROW(m_legacyOp->inferMulti(*inData, outData.data(), params, orders.data(), numOutputs, stream));
 }
 
 } // namespace cvcuda::priv
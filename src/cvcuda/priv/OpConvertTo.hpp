@@ -39,7 +39,13 @@ public:
     explicit ConvertTo();
 
     void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out, const double alpha,
-                    const double beta) const;
+                    const double beta, NVCVSwizzle channelOrder = NVCV_SWIZZLE_XYZW) const;
+
+    void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out,
+                    const nvcv::ITensor &alpha, const nvcv::ITensor &beta) const;
+
+    void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor *const *out,
+                    const NVCVConvertToParams *params, int32_t numOutputs) const;
 
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::ConvertTo> m_legacyOp;
@@ -89,6 +89,47 @@ void CopyMakeBorder::operator()(cudaStream_t stream, const nvcv::IImageBatch &in
         m_legacyOpVarShape->infer(*inData, *outData, *topData, *leftData, borderMode, borderValue, stream));
 }
 
+void CopyMakeBorder::operator()(cudaStream_t stream, const nvcv::IImageBatch &in, const nvcv::ITensor &out,
+                                const nvcv::ITensor &top, const nvcv::ITensor &left, const NVCVBorderType borderMode,
+                                const nvcv::ITensor &borderValues) const
+{
+    auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must be varshape image batch");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out.exportData());
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *topData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(top.exportData());
+    if (topData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Top must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *leftData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(left.exportData());
+    if (leftData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Left must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *valuesData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(borderValues.exportData());
+    if (valuesData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Border values must be cuda-accessible, pitch-linear tensor");
+    }
+
+    NVCV_CHECK_THROW(
+        m_legacyOpVarShape->infer(*inData, *outData, *topData, *leftData, borderMode, *valuesData, stream));
+}
+
 void CopyMakeBorder::operator()(cudaStream_t stream, const nvcv::IImageBatch &in, const nvcv::IImageBatch &out,
                                 const nvcv::ITensor &top, const nvcv::ITensor &left, const NVCVBorderType borderMode,
                                 const float4 borderValue) const
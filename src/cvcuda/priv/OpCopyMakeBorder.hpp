@@ -47,6 +47,9 @@ public:
     void operator()(cudaStream_t stream, const nvcv::IImageBatch &in, const nvcv::ITensor &out,
                     const nvcv::ITensor &top, const nvcv::ITensor &left, const NVCVBorderType borderMode,
                     const float4 borderValue) const;
+    void operator()(cudaStream_t stream, const nvcv::IImageBatch &in, const nvcv::ITensor &out,
+                    const nvcv::ITensor &top, const nvcv::ITensor &left, const NVCVBorderType borderMode,
+                    const nvcv::ITensor &borderValues) const;
 
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::CopyMakeBorder>         m_legacyOp;
@@ -0,0 +1,104 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpCropResize.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <util/CheckError.hpp>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+CropResize::CropResize()
+{
+    legacy::DataShape maxIn, maxOut;
+    //maxIn/maxOut not used by op.
+    m_legacyOp         = std::make_unique<legacy::CropResize>(maxIn, maxOut);
+    m_legacyOpVarShape = std::make_unique<legacy::CropResizeVarShape>();
+}
+
+void CropResize::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &boxes,
+                            nvcv::ITensor &out, const NVCVInterpolationType interpolation) const
+{
+    auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *boxData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(boxes.exportData());
+    if (boxData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Boxes must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out.exportData());
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *boxData, *outData, interpolation, stream));
+}
+
+void CropResize::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &boxes,
+                            const nvcv::ITensor *flipCode, nvcv::ITensor &out,
+                            const NVCVInterpolationType interpolation) const
+{
+    auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, varshape pitch-linear image batch");
+    }
+
+    auto *boxData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(boxes.exportData());
+    if (boxData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Boxes must be cuda-accessible, pitch-linear tensor");
+    }
+
+    const nvcv::ITensorDataStridedCuda *flipData = nullptr;
+    if (flipCode != nullptr)
+    {
+        flipData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(flipCode->exportData());
+        if (flipData == nullptr)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Flip codes must be cuda-accessible, pitch-linear tensor");
+        }
+    }
+
+    auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out.exportData());
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *boxData, flipData, *outData, interpolation, stream));
+}
+
+} // namespace cvcuda::priv
@@ -36,6 +36,12 @@ CvtColor::CvtColor()
 
 void CvtColor::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out,
                           NVCVColorConversionCode code) const
+{
+    (*this)(stream, in, out, code, NVCV_COLOR_SPEC_BT2020);
+}
+
+void CvtColor::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out,
+                          NVCVColorConversionCode code, NVCVColorSpec inSpec) const
 {
     auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
     if (inData == nullptr)
@@ -51,7 +57,7 @@ void CvtColor::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nv
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
-    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, code, stream));
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, code, inSpec, stream));
 }
 
 void CvtColor::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in,
@@ -74,4 +80,24 @@ void CvtColor::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &
     NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, code, stream));
 }
 
+void CvtColor::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in,
+                          const nvcv::IImageBatchVarShape &out) const
+{
+    auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, varshape pitch-linear image batch");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(out.exportData(stream));
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, varshape pitch-linear image batch");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, stream));
+}
+
 } // namespace cvcuda::priv
@@ -42,9 +42,15 @@ public:
     void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out,
                     NVCVColorConversionCode code) const;
 
+    void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out,
+                    NVCVColorConversionCode code, NVCVColorSpec inSpec) const;
+
     void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out,
                     NVCVColorConversionCode code) const;
 
+    void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in,
+                    const nvcv::IImageBatchVarShape &out) const;
+
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::CvtColor>         m_legacyOp;
     std::unique_ptr<nvcv::legacy::cuda_op::CvtColorVarShape> m_legacyOpVarShape;
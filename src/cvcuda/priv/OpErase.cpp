@@ -17,6 +17,7 @@
 
 #include "OpErase.hpp"
 
+#include "InPlace.hpp"
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
@@ -81,7 +82,7 @@ void Erase::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv:
                               "imgIdx must be cuda-accessible, pitch-linear tensor");
     }
 
-    bool inplace = (in.handle() == out.handle());
+    bool inplace = CheckInPlace(*inData, *outData);
     NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, *anchorData, *erasingData, *valuesData, *imgIdxData, random,
                                        seed, inplace, stream));
 }
@@ -118,7 +119,7 @@ void Erase::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in,
                               "imgIdx must be cuda-accessible, pitch-linear tensor");
     }
 
-    bool inplace = (in.handle() == out.handle());
+    bool inplace = CheckInPlace(in, out);
     NVCV_CHECK_THROW(m_legacyOpVarShape->infer(in, out, *anchorData, *erasingData, *valuesData, *imgIdxData, random,
                                                seed, inplace, stream));
 }
@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpFAST.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <util/CheckError.hpp>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+namespace {
+
+const nvcv::ITensorDataStridedCuda &ExportData(const nvcv::ITensor &tensor, const char *name)
+{
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    if (data == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "%s must be cuda-accessible, pitch-linear tensor", name);
+    }
+    return *data;
+}
+
+} // namespace
+
+FAST::FAST()
+{
+    m_legacyOp = std::make_unique<legacy::FAST>();
+}
+
+void FAST::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &outKeypoints,
+                      const nvcv::ITensor &outScores, const nvcv::ITensor &outCount, int32_t threshold,
+                      bool nonmaxSuppression) const
+{
+    const nvcv::ITensorDataStridedCuda &inData       = ExportData(in, "Input");
+    const nvcv::ITensorDataStridedCuda &keypointData = ExportData(outKeypoints, "Keypoint output");
+    const nvcv::ITensorDataStridedCuda &scoreData    = ExportData(outScores, "Score output");
+    const nvcv::ITensorDataStridedCuda &countData    = ExportData(outCount, "Count output");
+
+    NVCV_CHECK_THROW(
+        m_legacyOp->infer(inData, keypointData, scoreData, countData, threshold, nonmaxSuppression, stream));
+}
+
+} // namespace cvcuda::priv
@@ -17,10 +17,13 @@
 
 #include "OpFlip.hpp"
 
+#include "HostBackend.hpp"
+#include "InPlace.hpp"
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
 #include <nvcv/Exception.hpp>
+#include <nvcv/TensorDataAccess.hpp>
 #include <util/CheckError.hpp>
 
 namespace cvcuda::priv {
@@ -36,6 +39,13 @@ Flip::Flip(int32_t maxBatchSize)
 
 void Flip::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out, int32_t flipCode) const
 {
+    // Tensors in host memory are processed on the host, synchronously, the stream isn't used
+    if (auto hostData = host::ExportData(in, out))
+    {
+        host::Flip(hostData->in, hostData->out, flipCode);
+        return;
+    }
+
     auto *input = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
     if (input == nullptr)
     {
@@ -50,7 +60,8 @@ void Flip::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
-    NVCV_CHECK_THROW(m_legacyOp->infer(*input, *output, flipCode, stream));
+    bool inplace = CheckInPlace(*input, *output);
+    NVCV_CHECK_THROW(m_legacyOp->infer(*input, *output, flipCode, inplace, stream));
 }
 
 void Flip::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out,
@@ -79,6 +90,51 @@ void Flip::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in,
                               "Flip Code must be cuda-accessible, pitch-linear tensor");
     }
 
+    // Pixels are swapped with their mirror, which works whether images are flipped in place or not
+    CheckInPlace(in, out);
+    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*input, *output, *flip_code, stream));
+}
+
+void Flip::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &out,
+                      const nvcv::ITensor &flipCode) const
+{
+    auto *output = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out.exportData());
+    if (output == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*output);
+    if (!outAccess)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output must be a NHWC tensor");
+    }
+
+    const nvcv::Size2D outSize{outAccess->numCols(), outAccess->numRows()};
+    for (int32_t i = 0; i < in.numImages(); ++i)
+    {
+        if (in[i].size() != outSize)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Input image %d must have the size of the output samples", i);
+        }
+    }
+
+    auto *input = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (input == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, varshape pitch-linear image batch");
+    }
+
+    auto *flip_code = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(flipCode.exportData());
+    if (flip_code == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Flip Code must be cuda-accessible, pitch-linear tensor");
+    }
+
     NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*input, *output, *flip_code, stream));
 }
 
@@ -44,6 +44,9 @@ public:
     void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out,
                     const nvcv::ITensor &flipCode) const;
 
+    void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &out,
+                    const nvcv::ITensor &flipCode) const;
+
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::Flip>               m_legacyOp;
     std::unique_ptr<nvcv::legacy::cuda_op::FlipOrCopyVarShape> m_legacyOpVarShape;
@@ -17,6 +17,7 @@
 
 #include "OpGammaContrast.hpp"
 
+#include "InPlace.hpp"
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
@@ -56,7 +57,23 @@ void GammaContrast::operator()(cudaStream_t stream, const nvcv::IImageBatchVarSh
                               "Gamma must be device-acessible, pitch-linear tensor");
     }
 
+    CheckInPlace(in, out);
     NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, *gammaData, stream));
 }
 
+int64_t GammaContrast::doGetCudaWorkspaceSize() const
+{
+    return m_legacyOpVarShape->gpuWorkspaceSize();
+}
+
+void GammaContrast::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOpVarShape->setGpuWorkspace(cudaMem);
+}
+
+void GammaContrast::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOpVarShape->reserveGpuWorkspace(stream);
+}
+
 } // namespace cvcuda::priv
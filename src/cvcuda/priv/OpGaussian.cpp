@@ -23,6 +23,8 @@
 #include <nvcv/Exception.hpp>
 #include <util/CheckError.hpp>
 
+#include <algorithm>
+
 namespace cvcuda::priv {
 
 namespace legacy = nvcv::legacy::cuda_op;
@@ -51,6 +53,15 @@ void Gaussian::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nv
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
+    // Channels are blurred independently, planar tensors are blurred plane by plane
+    auto inPlanes  = nvcv::legacy::helpers::PlanesAsSamples(*inData);
+    auto outPlanes = nvcv::legacy::helpers::PlanesAsSamples(*outData);
+    if (inPlanes && outPlanes)
+    {
+        inData  = &*inPlanes;
+        outData = &*outPlanes;
+    }
+
     NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, kernelSize, sigma, borderMode, stream));
 }
 
@@ -88,4 +99,22 @@ void Gaussian::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &
     NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, *kernelSizeData, *sigmaData, borderMode, stream));
 }
 
+int64_t Gaussian::doGetCudaWorkspaceSize() const
+{
+    // Tensor and varshape implementations aren't executed at the same time, they can share the workspace
+    return std::max(m_legacyOp->gpuWorkspaceSize(), m_legacyOpVarShape->gpuWorkspaceSize());
+}
+
+void Gaussian::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOp->setGpuWorkspace(cudaMem);
+    m_legacyOpVarShape->setGpuWorkspace(cudaMem);
+}
+
+void Gaussian::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOp->reserveGpuWorkspace(stream);
+    m_legacyOpVarShape->reserveGpuWorkspace(stream);
+}
+
 } // namespace cvcuda::priv
@@ -48,6 +48,10 @@ public:
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::Gaussian>         m_legacyOp;
     std::unique_ptr<nvcv::legacy::cuda_op::GaussianVarShape> m_legacyOpVarShape;
+
+    int64_t doGetCudaWorkspaceSize() const override;
+    void    doSetCudaWorkspace(void *cudaMem) override;
+    void    doReserveCudaWorkspace(cudaStream_t stream) override;
 };
 
 } // namespace cvcuda::priv
@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpGuidedFilter.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <util/CheckError.hpp>
+
+#include <algorithm>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+namespace {
+
+const nvcv::ITensorDataStridedCuda &ExportData(const nvcv::ITensor &tensor, const char *name)
+{
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    if (data == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "%s must be cuda-accessible, pitch-linear tensor", name);
+    }
+    return *data;
+}
+
+const nvcv::IImageBatchVarShapeDataStridedCuda &ExportData(const nvcv::IImageBatchVarShape &batch,
+                                                           cudaStream_t stream, const char *name)
+{
+    auto *data = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(batch.exportData(stream));
+    if (data == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "%s must be cuda-accessible, varshape pitch-linear image batch", name);
+    }
+    return *data;
+}
+
+} // namespace
+
+GuidedFilter::GuidedFilter(int maxBatchSize, int maxWidth, int maxHeight)
+{
+    if (maxBatchSize < 0 || maxWidth < 0 || maxHeight < 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Maximum batch size, width and height must not be negative");
+    }
+
+    legacy::DataShape maxIn, maxOut;
+    //maxIn/maxOut not used by op.
+    nvcv::Size2D maxSize{maxWidth, maxHeight};
+    m_legacyOp         = std::make_unique<legacy::GuidedFilter>(maxIn, maxOut, maxBatchSize, maxSize);
+    m_legacyOpVarShape = std::make_unique<legacy::GuidedFilterVarShape>(maxIn, maxOut, maxBatchSize, maxSize);
+}
+
+void GuidedFilter::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &guide,
+                              const nvcv::ITensor &out, int32_t radius, float eps, int32_t subsample) const
+{
+    const nvcv::ITensorDataStridedCuda &inData    = ExportData(in, "Input");
+    const nvcv::ITensorDataStridedCuda &guideData = ExportData(guide, "Guide");
+    const nvcv::ITensorDataStridedCuda &outData   = ExportData(out, "Output");
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(inData, guideData, outData, radius, eps, subsample, stream));
+}
+
+void GuidedFilter::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in,
+                              const nvcv::IImageBatchVarShape &guide, const nvcv::IImageBatchVarShape &out,
+                              int32_t radius, float eps, int32_t subsample) const
+{
+    const nvcv::IImageBatchVarShapeDataStridedCuda &inData    = ExportData(in, stream, "Input");
+    const nvcv::IImageBatchVarShapeDataStridedCuda &guideData = ExportData(guide, stream, "Guide");
+    const nvcv::IImageBatchVarShapeDataStridedCuda &outData   = ExportData(out, stream, "Output");
+
+    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(inData, guideData, outData, radius, eps, subsample, stream));
+}
+
+int64_t GuidedFilter::doGetCudaWorkspaceSize() const
+{
+    // Tensor and varshape implementations aren't executed at the same time, they can share the workspace
+    return std::max(m_legacyOp->gpuWorkspaceSize(), m_legacyOpVarShape->gpuWorkspaceSize());
+}
+
+void GuidedFilter::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOp->setGpuWorkspace(cudaMem);
+    m_legacyOpVarShape->setGpuWorkspace(cudaMem);
+}
+
+void GuidedFilter::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOp->reserveGpuWorkspace(stream);
+    m_legacyOpVarShape->reserveGpuWorkspace(stream);
+}
+
+} // namespace cvcuda::priv
@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpGuidedFilter.hpp
+ *
+ * @brief Defines the private C++ Class for the guided filter operation.
+ */
+
+#ifndef CVCUDA_PRIV_GUIDED_FILTER_HPP
+#define CVCUDA_PRIV_GUIDED_FILTER_HPP
+
+#include "IOperator.hpp"
+#include "legacy/CvCudaLegacy.h"
+
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+
+#include <memory>
+
+namespace cvcuda::priv {
+
+class GuidedFilter final : public IOperator
+{
+public:
+    explicit GuidedFilter(int maxBatchSize, int maxWidth, int maxHeight);
+
+    void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &guide, const nvcv::ITensor &out,
+                    int32_t radius, float eps, int32_t subsample) const;
+
+    void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &guide,
+                    const nvcv::IImageBatchVarShape &out, int32_t radius, float eps, int32_t subsample) const;
+
+private:
+    std::unique_ptr<nvcv::legacy::cuda_op::GuidedFilter>         m_legacyOp;
+    std::unique_ptr<nvcv::legacy::cuda_op::GuidedFilterVarShape> m_legacyOpVarShape;
+
+    int64_t doGetCudaWorkspaceSize() const override;
+    void    doSetCudaWorkspace(void *cudaMem) override;
+    void    doReserveCudaWorkspace(cudaStream_t stream) override;
+};
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_GUIDED_FILTER_HPP
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpIntegral.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <util/CheckError.hpp>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+namespace {
+
+const nvcv::ITensorDataStridedCuda &ExportData(const nvcv::ITensor &tensor, const char *name)
+{
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    if (data == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "%s must be cuda-accessible, pitch-linear tensor", name);
+    }
+    return *data;
+}
+
+} // namespace
+
+Integral::Integral(int maxBatchSize, int maxWidth, int maxHeight)
+{
+    if (maxBatchSize < 0 || maxWidth < 0 || maxHeight < 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Maximum batch size, width and height must not be negative");
+    }
+
+    legacy::DataShape maxIn, maxOut;
+    //maxIn/maxOut not used by op.
+    m_legacyOp = std::make_unique<legacy::Integral>(maxIn, maxOut, maxBatchSize, nvcv::Size2D{maxWidth, maxHeight});
+}
+
+void Integral::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &sum,
+                          const nvcv::ITensor *sqsum) const
+{
+    const nvcv::ITensorDataStridedCuda &inData    = ExportData(in, "Input");
+    const nvcv::ITensorDataStridedCuda &sumData   = ExportData(sum, "Output sum");
+    const nvcv::ITensorDataStridedCuda *sqsumData = sqsum ? &ExportData(*sqsum, "Output squared sum") : nullptr;
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(inData, sumData, sqsumData, stream));
+}
+
+int64_t Integral::doGetCudaWorkspaceSize() const
+{
+    return m_legacyOp->gpuWorkspaceSize();
+}
+
+void Integral::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOp->setGpuWorkspace(cudaMem);
+}
+
+void Integral::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOp->reserveGpuWorkspace(stream);
+}
+
+} // namespace cvcuda::priv
@@ -51,6 +51,15 @@ void Laplacian::operator()(cudaStream_t stream, const nvcv::ITensor &in, const n
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
+    // The filter doesn't mix channels, so each plane of a planar tensor is filtered as a sample
+    auto inPlanes  = nvcv::legacy::helpers::PlanesAsSamples(*inData);
+    auto outPlanes = nvcv::legacy::helpers::PlanesAsSamples(*outData);
+    if (inPlanes && outPlanes)
+    {
+        inData  = &*inPlanes;
+        outData = &*outPlanes;
+    }
+
     NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, ksize, scale, borderMode, stream));
 }
 
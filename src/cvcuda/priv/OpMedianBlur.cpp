@@ -52,6 +52,15 @@ void MedianBlur::operator()(cudaStream_t stream, const nvcv::ITensor &in, const
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
+    // Medians are per channel, planes of planar tensors are processed as single-channel samples
+    auto inPlanes  = nvcv::legacy::helpers::PlanesAsSamples(*inData);
+    auto outPlanes = nvcv::legacy::helpers::PlanesAsSamples(*outData);
+    if (inPlanes && outPlanes)
+    {
+        inData  = &*inPlanes;
+        outData = &*outPlanes;
+    }
+
     NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, ksize, stream));
 }
 
@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpMinMaxLoc.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <util/CheckError.hpp>
+
+#include <algorithm>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+MinMaxLoc::MinMaxLoc()
+{
+    legacy::DataShape maxIn, maxOut;
+    //maxIn/maxOut not used by op.
+    m_legacyOp         = std::make_unique<legacy::MinMaxLoc>(maxIn, maxOut);
+    m_legacyOpVarShape = std::make_unique<legacy::MinMaxLocVarShape>();
+}
+
+void MinMaxLoc::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &minVal,
+                           const nvcv::ITensor &minLoc, const nvcv::ITensor &maxVal, const nvcv::ITensor &maxLoc) const
+{
+    auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *minValData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(minVal.exportData());
+    if (minValData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "MinVal must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *minLocData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(minLoc.exportData());
+    if (minLocData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "MinLoc must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *maxValData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(maxVal.exportData());
+    if (maxValData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "MaxVal must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *maxLocData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(maxLoc.exportData());
+    if (maxLocData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "MaxLoc must be cuda-accessible, pitch-linear tensor");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *minValData, *minLocData, *maxValData, *maxLocData, stream));
+}
+
+void MinMaxLoc::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &minVal,
+                           const nvcv::ITensor &minLoc, const nvcv::ITensor &maxVal, const nvcv::ITensor &maxLoc) const
+{
+    auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must be varshape image batch");
+    }
+
+    auto *minValData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(minVal.exportData());
+    if (minValData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "MinVal must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *minLocData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(minLoc.exportData());
+    if (minLocData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "MinLoc must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *maxValData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(maxVal.exportData());
+    if (maxValData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "MaxVal must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *maxLocData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(maxLoc.exportData());
+    if (maxLocData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "MaxLoc must be cuda-accessible, pitch-linear tensor");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *minValData, *minLocData, *maxValData, *maxLocData, stream));
+}
+
+int64_t MinMaxLoc::doGetCudaWorkspaceSize() const
+{
+    return std::max(m_legacyOp->gpuWorkspaceSize(), m_legacyOpVarShape->gpuWorkspaceSize());
+}
+
+void MinMaxLoc::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOp->setGpuWorkspace(cudaMem);
+    m_legacyOpVarShape->setGpuWorkspace(cudaMem);
+}
+
+void MinMaxLoc::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOp->reserveGpuWorkspace(stream);
+    m_legacyOpVarShape->reserveGpuWorkspace(stream);
+}
+
+} // namespace cvcuda::priv
@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpMinMaxLoc.hpp
+ *
+ * @brief Defines the private C++ Class for the min/max location operation.
+ */
+
+#ifndef CVCUDA_PRIV_MIN_MAX_LOC_HPP
+#define CVCUDA_PRIV_MIN_MAX_LOC_HPP
+
+#include "IOperator.hpp"
+#include "legacy/CvCudaLegacy.h"
+
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+
+#include <memory>
+
+namespace cvcuda::priv {
+
+class MinMaxLoc final : public IOperator
+{
+public:
+    explicit MinMaxLoc();
+
+    void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &minVal,
+                    const nvcv::ITensor &minLoc, const nvcv::ITensor &maxVal, const nvcv::ITensor &maxLoc) const;
+
+    void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &minVal,
+                    const nvcv::ITensor &minLoc, const nvcv::ITensor &maxVal, const nvcv::ITensor &maxLoc) const;
+
+private:
+    std::unique_ptr<nvcv::legacy::cuda_op::MinMaxLoc>         m_legacyOp;
+    std::unique_ptr<nvcv::legacy::cuda_op::MinMaxLocVarShape> m_legacyOpVarShape;
+
+    int64_t doGetCudaWorkspaceSize() const override;
+    void    doSetCudaWorkspace(void *cudaMem) override;
+    void    doReserveCudaWorkspace(cudaStream_t stream) override;
+};
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_MIN_MAX_LOC_HPP
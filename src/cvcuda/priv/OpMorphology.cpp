@@ -53,6 +53,15 @@ void Morphology::operator()(cudaStream_t stream, const nvcv::ITensor &in, const
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
+    // Each channel is eroded or dilated on its own, planar tensors are processed plane by plane
+    auto inPlanes  = nvcv::legacy::helpers::PlanesAsSamples(*inData);
+    auto outPlanes = nvcv::legacy::helpers::PlanesAsSamples(*outData);
+    if (inPlanes && outPlanes)
+    {
+        inData  = &*inPlanes;
+        outData = &*outPlanes;
+    }
+
     NVCV_CHECK_THROW(
         m_legacyOp->infer(*inData, *outData, morph_type, mask_size, anchor, iteration, borderMode, stream));
 }
@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpNMS.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <util/CheckError.hpp>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+namespace {
+
+const nvcv::ITensorDataStridedCuda &ExportData(const nvcv::ITensor &tensor, const char *name)
+{
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    if (data == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "%s must be cuda-accessible, pitch-linear tensor", name);
+    }
+    return *data;
+}
+
+} // namespace
+
+NMS::NMS(int maxBatchSize, int maxNumBoxes)
+{
+    if (maxBatchSize < 0 || maxNumBoxes < 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Maximum batch size and number of boxes must not be negative");
+    }
+
+    legacy::DataShape maxIn, maxOut;
+    //maxIn/maxOut not used by op.
+    m_legacyOp = std::make_unique<legacy::NMS>(maxIn, maxOut, maxBatchSize, maxNumBoxes);
+}
+
+void NMS::operator()(cudaStream_t stream, const nvcv::ITensor &boxes, const nvcv::ITensor &scores,
+                     const nvcv::ITensor *classes, const nvcv::ITensor &outIndices, const nvcv::ITensor &outScores,
+                     const nvcv::ITensor &outCount, float scoreThreshold, float iouThreshold, float softSigma) const
+{
+    const nvcv::ITensorDataStridedCuda &boxData      = ExportData(boxes, "Input boxes");
+    const nvcv::ITensorDataStridedCuda &scoreData    = ExportData(scores, "Input scores");
+    const nvcv::ITensorDataStridedCuda *classData    = classes ? &ExportData(*classes, "Input classes") : nullptr;
+    const nvcv::ITensorDataStridedCuda &outIndexData = ExportData(outIndices, "Output indices");
+    const nvcv::ITensorDataStridedCuda &outScoreData = ExportData(outScores, "Output scores");
+    const nvcv::ITensorDataStridedCuda &outCountData = ExportData(outCount, "Output count");
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(boxData, scoreData, classData, outIndexData, outScoreData, outCountData,
+                                       scoreThreshold, iouThreshold, softSigma, stream));
+}
+
+} // namespace cvcuda::priv
@@ -17,10 +17,12 @@
 
 #include "OpNormalize.hpp"
 
+#include "InPlace.hpp"
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
 #include <nvcv/Exception.hpp>
+#include <nvcv/TensorDataAccess.hpp>
 #include <util/CheckError.hpp>
 
 namespace cvcuda::priv {
@@ -37,7 +39,7 @@ Normalize::Normalize()
 
 void Normalize::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &base,
                            const nvcv::ITensor &scale, nvcv::ITensor &out, const float global_scale, const float shift,
-                           const float epsilon, const uint32_t flags) const
+                           const float epsilon, const uint32_t flags, const NVCVSwizzle channelOrder) const
 {
     auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
     if (inData == nullptr)
@@ -67,13 +69,18 @@ void Normalize::operator()(cudaStream_t stream, const nvcv::ITensor &in, const n
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
-    NVCV_CHECK_THROW(
-        m_legacyOp->infer(*inData, *baseData, *scaleData, *outData, global_scale, shift, epsilon, flags, stream));
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    auto order    = nvcv::legacy::helpers::GetLegacyChannelOrder(channelOrder, inAccess ? inAccess->numChannels() : 0);
+
+    CheckInPlace(*inData, *outData);
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *baseData, *scaleData, *outData, global_scale, shift, epsilon, flags,
+                                       order, stream));
 }
 
 void Normalize::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &base,
                            const nvcv::ITensor &scale, nvcv::IImageBatchVarShape &out, const float global_scale,
-                           const float shift, const float epsilon, const uint32_t flags) const
+                           const float shift, const float epsilon, const uint32_t flags,
+                           const NVCVSwizzle channelOrder) const
 {
     auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
     if (inData == nullptr)
@@ -103,8 +110,27 @@ void Normalize::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape
                               "Output must be cuda-accessible, varshape pitch-linear image batch");
     }
 
+    nvcv::ImageFormat inFormat = inData->uniqueFormat();
+    auto order = nvcv::legacy::helpers::GetLegacyChannelOrder(channelOrder, inFormat != nvcv::FMT_NONE ? inFormat.numChannels() : 0);
+
+    CheckInPlace(in, out);
     NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *baseData, *scaleData, *outData, global_scale, shift, epsilon,
-                                               flags, stream));
+                                               flags, order, stream));
+}
+
+int64_t Normalize::doGetCudaWorkspaceSize() const
+{
+    return m_legacyOp->gpuWorkspaceSize();
+}
+
+void Normalize::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOp->setGpuWorkspace(cudaMem);
+}
+
+void Normalize::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOp->reserveGpuWorkspace(stream);
 }
 
 } // namespace cvcuda::priv
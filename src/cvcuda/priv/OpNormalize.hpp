@@ -40,15 +40,20 @@ public:
     explicit Normalize();
 
     void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &base, const nvcv::ITensor &scale,
-                    nvcv::ITensor &out, float global_scale, float shift, float epsilon, uint32_t flags) const;
+                    nvcv::ITensor &out, float global_scale, float shift, float epsilon, uint32_t flags,
+                    NVCVSwizzle channelOrder = NVCV_SWIZZLE_XYZW) const;
 
     void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &base,
                     const nvcv::ITensor &scale, nvcv::IImageBatchVarShape &out, float global_scale, float shift,
-                    float epsilon, uint32_t flags) const;
+                    float epsilon, uint32_t flags, NVCVSwizzle channelOrder = NVCV_SWIZZLE_XYZW) const;
 
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::Normalize>         m_legacyOp;
     std::unique_ptr<nvcv::legacy::cuda_op::NormalizeVarShape> m_legacyOpVarShape;
+
+    int64_t doGetCudaWorkspaceSize() const override;
+    void    doSetCudaWorkspace(void *cudaMem) override;
+    void    doReserveCudaWorkspace(cudaStream_t stream) override;
 };
 
 } // namespace cvcuda::priv
@@ -0,0 +1,54 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpPSNR.hpp
+ *
+ * @brief Defines the private C++ Class for the peak signal-to-noise ratio operation.
+ */
+
+#ifndef CVCUDA_PRIV_PSNR_HPP
+#define CVCUDA_PRIV_PSNR_HPP
+
+#include "IOperator.hpp"
+#include "legacy/CvCudaLegacy.h"
+
+#include <nvcv/ITensor.hpp>
+
+#include <memory>
+
+namespace cvcuda::priv {
+
+class PSNR final : public IOperator
+{
+public:
+    explicit PSNR();
+
+    void operator()(cudaStream_t stream, const nvcv::ITensor &in1, const nvcv::ITensor &in2, const nvcv::ITensor &out,
+                    float maxValue) const;
+
+private:
+    std::unique_ptr<nvcv::legacy::cuda_op::PSNR> m_legacyOp;
+
+    int64_t doGetCudaWorkspaceSize() const override;
+    void    doSetCudaWorkspace(void *cudaMem) override;
+    void    doReserveCudaWorkspace(cudaStream_t stream) override;
+};
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_PSNR_HPP
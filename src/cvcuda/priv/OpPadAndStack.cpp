@@ -34,37 +34,78 @@ PadAndStack::PadAndStack()
     m_legacyOp = std::make_unique<legacy::PadAndStack>(maxIn, maxOut);
 }
 
-void PadAndStack::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out, nvcv::ITensor &top,
-                             nvcv::ITensor &left, const NVCVBorderType borderMode, const float borderValue) const
+struct PadAndStackData
+{
+    const nvcv::IImageBatchVarShapeDataStridedCuda *in;
+    const nvcv::ITensorDataStridedCuda             *out, *top, *left;
+};
+
+static PadAndStackData ExportData(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out,
+                                  nvcv::ITensor &top, nvcv::ITensor &left)
 {
-    auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
-    if (inData == nullptr)
+    PadAndStackData data;
+
+    data.in = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (data.in == nullptr)
     {
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
                               "Input must be cuda-accessible, pitch-linear tensor");
     }
 
-    auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out.exportData());
-    if (outData == nullptr)
+    data.out = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out.exportData());
+    if (data.out == nullptr)
     {
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
-    auto *topData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(top.exportData());
-    if (outData == nullptr)
+    data.top = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(top.exportData());
+    if (data.top == nullptr)
     {
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Top must be cuda-accessible, pitch-linear tensor");
     }
 
-    auto *leftData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(left.exportData());
-    if (outData == nullptr)
+    data.left = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(left.exportData());
+    if (data.left == nullptr)
     {
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
                               "Left must be cuda-accessible, pitch-linear tensor");
     }
 
-    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, *topData, *leftData, borderMode, borderValue, stream));
+    return data;
+}
+
+void PadAndStack::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out, nvcv::ITensor &top,
+                             nvcv::ITensor &left, const NVCVBorderType borderMode, const float borderValue) const
+{
+    PadAndStackData data = ExportData(stream, in, out, top, left);
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(*data.in, *data.out, *data.top, *data.left, borderMode, borderValue, stream));
+}
+
+void PadAndStack::operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out, nvcv::ITensor &top,
+                             nvcv::ITensor &left, const NVCVBorderType borderMode, const float borderValue,
+                             const nvcv::ITensor &base, const nvcv::ITensor &scale, const float global_scale,
+                             const float shift, const float epsilon, const uint32_t flags) const
+{
+    PadAndStackData data = ExportData(stream, in, out, top, left);
+
+    auto *baseData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(base.exportData());
+    if (baseData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input base must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *scaleData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(scale.exportData());
+    if (scaleData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input scale must be cuda-accessible, pitch-linear tensor");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(*data.in, *data.out, *data.top, *data.left, borderMode, borderValue, *baseData,
+                                       *scaleData, global_scale, shift, epsilon, flags, stream));
 }
 
 } // namespace cvcuda::priv
@@ -42,6 +42,11 @@ public:
     void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out, nvcv::ITensor &top,
                     nvcv::ITensor &left, const NVCVBorderType borderMode, const float borderValue) const;
 
+    void operator()(cudaStream_t stream, nvcv::IImageBatchVarShape &in, nvcv::ITensor &out, nvcv::ITensor &top,
+                    nvcv::ITensor &left, const NVCVBorderType borderMode, const float borderValue,
+                    const nvcv::ITensor &base, const nvcv::ITensor &scale, float global_scale, float shift,
+                    float epsilon, uint32_t flags) const;
+
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::PadAndStack> m_legacyOp;
 };
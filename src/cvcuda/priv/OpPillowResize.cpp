@@ -23,6 +23,8 @@
 #include <nvcv/ImageFormat.h>
 #include <util/CheckError.hpp>
 
+#include <algorithm>
+
 namespace cvcuda::priv {
 
 namespace leg    = nvcv::legacy;
@@ -70,4 +72,22 @@ void PillowResize::operator()(cudaStream_t stream, const nvcv::IImageBatchVarSha
     NVCV_CHECK_THROW(m_legacyOpVarShape->infer(in, out, interpolation, stream));
 }
 
+int64_t PillowResize::doGetCudaWorkspaceSize() const
+{
+    // Tensor and varshape implementations aren't executed at the same time, they can share the workspace
+    return std::max(m_legacyOp->gpuWorkspaceSize(), m_legacyOpVarShape->gpuWorkspaceSize());
+}
+
+void PillowResize::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOp->setGpuWorkspace(cudaMem);
+    m_legacyOpVarShape->setGpuWorkspace(cudaMem);
+}
+
+void PillowResize::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOp->reserveGpuWorkspace(stream);
+    m_legacyOpVarShape->reserveGpuWorkspace(stream);
+}
+
 } // namespace cvcuda::priv
@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpRandomParams.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <util/CheckError.hpp>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+namespace {
+
+const nvcv::ITensorDataStridedCuda &ExportData(const nvcv::ITensor &tensor, const char *name)
+{
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    if (data == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "%s must be cuda-accessible, pitch-linear tensor", name);
+    }
+    return *data;
+}
+
+const nvcv::IImageBatchVarShapeDataStridedCuda &ExportData(cudaStream_t stream, const nvcv::IImageBatchVarShape &in)
+{
+    auto *data = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (data == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must be varshape image batch");
+    }
+    return *data;
+}
+
+} // namespace
+
+RandomParams::RandomParams(uint64_t seed)
+    : m_seed(seed)
+{
+    legacy::DataShape maxIn, maxOut;
+    //maxIn/maxOut not used by op.
+    m_legacyOp = std::make_unique<legacy::RandomParams>(maxIn, maxOut);
+}
+
+void RandomParams::setSeed(uint64_t seed)
+{
+    m_seed = seed;
+    m_draw = 0;
+}
+
+void RandomParams::flipCode(cudaStream_t stream, const nvcv::ITensor &flipCode, float probHoriz, float probVert)
+{
+    const nvcv::ITensorDataStridedCuda &flipCodeData = ExportData(flipCode, "flipCode");
+
+    NVCV_CHECK_THROW(m_legacyOp->inferFlip(flipCodeData, probHoriz, probVert, m_seed, m_draw, stream));
+    ++m_draw;
+}
+
+void RandomParams::uniform(cudaStream_t stream, const nvcv::ITensor &out, double low, double high)
+{
+    const nvcv::ITensorDataStridedCuda &outData = ExportData(out, "Output");
+
+    NVCV_CHECK_THROW(m_legacyOp->inferUniform(outData, low, high, m_seed, m_draw, stream));
+    ++m_draw;
+}
+
+void RandomParams::rotate(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &angleDeg,
+                          const nvcv::ITensor &shift, double minAngleDeg, double maxAngleDeg)
+{
+    const nvcv::IImageBatchVarShapeDataStridedCuda &inData = ExportData(stream, in);
+
+    const nvcv::ITensorDataStridedCuda &angleData = ExportData(angleDeg, "angleDeg");
+    const nvcv::ITensorDataStridedCuda &shiftData = ExportData(shift, "shift");
+
+    NVCV_CHECK_THROW(
+        m_legacyOp->inferRotate(inData, angleData, shiftData, minAngleDeg, maxAngleDeg, m_seed, m_draw, stream));
+    ++m_draw;
+}
+
+void RandomParams::erase(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &anchor,
+                         const nvcv::ITensor &erasing, const nvcv::ITensor &imgIdx, float probability, float minArea,
+                         float maxArea, float minAspect, float maxAspect)
+{
+    const nvcv::IImageBatchVarShapeDataStridedCuda &inData = ExportData(stream, in);
+
+    const nvcv::ITensorDataStridedCuda &anchorData  = ExportData(anchor, "anchor");
+    const nvcv::ITensorDataStridedCuda &erasingData = ExportData(erasing, "erasing");
+    const nvcv::ITensorDataStridedCuda &imgIdxData  = ExportData(imgIdx, "imgIdx");
+
+    NVCV_CHECK_THROW(m_legacyOp->inferErase(inData, anchorData, erasingData, imgIdxData, probability, minArea,
+                                            maxArea, minAspect, maxAspect, m_seed, m_draw, stream));
+    ++m_draw;
+}
+
+void RandomParams::crop(cudaStream_t stream, const nvcv::ITensor &boxes, int32_t width, int32_t height,
+                        float minScale, float maxScale, float minAspect, float maxAspect)
+{
+    const nvcv::ITensorDataStridedCuda &boxData = ExportData(boxes, "boxes");
+
+    NVCV_CHECK_THROW(m_legacyOp->inferCrop(boxData, int2{width, height}, minScale, maxScale, minAspect, maxAspect,
+                                           m_seed, m_draw, stream));
+    ++m_draw;
+}
+
+void RandomParams::crop(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &boxes,
+                        float minScale, float maxScale, float minAspect, float maxAspect)
+{
+    const nvcv::IImageBatchVarShapeDataStridedCuda &inData  = ExportData(stream, in);
+    const nvcv::ITensorDataStridedCuda             &boxData = ExportData(boxes, "boxes");
+
+    NVCV_CHECK_THROW(m_legacyOp->inferCrop(inData, boxData, minScale, maxScale, minAspect, maxAspect, m_seed, m_draw,
+                                           stream));
+    ++m_draw;
+}
+
+} // namespace cvcuda::priv
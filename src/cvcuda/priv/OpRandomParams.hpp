@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OpRandomParams.hpp
+ *
+ * @brief Defines the private C++ Class for the random params operation.
+ */
+
+#ifndef CVCUDA_PRIV_RANDOM_PARAMS_HPP
+#define CVCUDA_PRIV_RANDOM_PARAMS_HPP
+
+#include "IOperator.hpp"
+#include "legacy/CvCudaLegacy.h"
+
+#include <nvcv/IImageBatch.hpp>
+#include <nvcv/ITensor.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace cvcuda::priv {
+
+// Keeps the seed and the index of the next draw, which every successful submission advances.
+class RandomParams final : public IOperator
+{
+public:
+    explicit RandomParams(uint64_t seed);
+
+    void setSeed(uint64_t seed);
+
+    void flipCode(cudaStream_t stream, const nvcv::ITensor &flipCode, float probHoriz, float probVert);
+
+    void uniform(cudaStream_t stream, const nvcv::ITensor &out, double low, double high);
+
+    void rotate(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &angleDeg,
+                const nvcv::ITensor &shift, double minAngleDeg, double maxAngleDeg);
+
+    void erase(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &anchor,
+               const nvcv::ITensor &erasing, const nvcv::ITensor &imgIdx, float probability, float minArea,
+               float maxArea, float minAspect, float maxAspect);
+
+    void crop(cudaStream_t stream, const nvcv::ITensor &boxes, int32_t width, int32_t height, float minScale,
+              float maxScale, float minAspect, float maxAspect);
+
+    void crop(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &boxes, float minScale,
+              float maxScale, float minAspect, float maxAspect);
+
+private:
+    std::unique_ptr<nvcv::legacy::cuda_op::RandomParams> m_legacyOp;
+
+    uint64_t m_seed;
+    uint32_t m_draw = 0;
+};
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_RANDOM_PARAMS_HPP
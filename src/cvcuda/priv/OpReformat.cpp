@@ -17,10 +17,12 @@
 
 #include "OpReformat.hpp"
 
+#include "HostBackend.hpp"
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
 #include <nvcv/Exception.hpp>
+#include <nvcv/TensorDataAccess.hpp>
 #include <util/CheckError.hpp>
 
 namespace cvcuda::priv {
@@ -34,8 +36,21 @@ Reformat::Reformat()
     m_legacyOp = std::make_unique<legacy::Reformat>(maxIn, maxOut);
 }
 
-void Reformat::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out) const
+void Reformat::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out,
+                          const NVCVSwizzle channelOrder) const
 {
+    // Tensors in host memory are processed on the host, synchronously, the stream isn't used
+    if (auto hostData = host::ExportData(in, out))
+    {
+        if (channelOrder != NVCV_SWIZZLE_XYZW)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_NOT_COMPATIBLE,
+                                  "Channels can only be reordered in cuda-accessible tensors");
+        }
+        host::Reformat(hostData->in, hostData->out);
+        return;
+    }
+
     auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
     if (inData == nullptr)
     {
@@ -50,7 +65,10 @@ void Reformat::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nv
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
-    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, stream));
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    auto order    = nvcv::legacy::helpers::GetLegacyChannelOrder(channelOrder, inAccess ? inAccess->numChannels() : 0);
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, order, stream));
 }
 
 } // namespace cvcuda::priv
@@ -38,7 +38,8 @@ class Reformat final : public IOperator
 public:
     explicit Reformat();
 
-    void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out) const;
+    void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out,
+                    NVCVSwizzle channelOrder = NVCV_SWIZZLE_XYZW) const;
 
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::Reformat> m_legacyOp;
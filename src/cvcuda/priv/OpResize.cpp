@@ -21,8 +21,12 @@
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
 #include <nvcv/Exception.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/detail/CheckError.hpp>
 #include <util/CheckError.hpp>
 
+#include <vector>
+
 namespace cvcuda::priv {
 
 namespace legacy = nvcv::legacy::cuda_op;
@@ -52,7 +56,50 @@ void Resize::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
-    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, interpolation, stream));
+    (*this)(stream, *inData, *outData, interpolation);
+}
+
+void Resize::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out,
+                        const NVCVInterpolationType interpolation, const NVCVSwizzle channelOrder) const
+{
+    auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out.exportData());
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    auto order    = nvcv::legacy::helpers::GetLegacyChannelOrder(channelOrder, inAccess ? inAccess->numChannels() : 0);
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, interpolation, order, stream));
+}
+
+void Resize::operator()(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                        const nvcv::ITensorDataStridedCuda &out, const NVCVInterpolationType interpolation) const
+{
+    nvcv::detail::CheckThrow(this->submit(stream, in, out, interpolation));
+}
+
+NVCVStatus Resize::submit(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                          const nvcv::ITensorDataStridedCuda &out, const NVCVInterpolationType interpolation) const
+{
+    // Channels are interpolated independently, planar tensors are resized as batches of single-channel planes
+    auto inPlanes  = nvcv::legacy::helpers::PlanesAsSamples(in);
+    auto outPlanes = nvcv::legacy::helpers::PlanesAsSamples(out);
+    if (inPlanes && outPlanes)
+    {
+        return NVCV_CHECK_STATUS(m_legacyOp->infer(*inPlanes, *outPlanes, interpolation, stream));
+    }
+
+    return NVCV_CHECK_STATUS(m_legacyOp->infer(in, out, interpolation, stream));
 }
 
 void Resize::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out,
@@ -70,7 +117,168 @@ void Resize::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output must be varshape image batch");
     }
 
-    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, interpolation, stream));
+    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, interpolation, stream,
+                                               nvcv::legacy::helpers::IsSparseBatch(out)));
+}
+
+void Resize::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out,
+                        const nvcv::ITensor &interpolation, bool antialias) const
+{
+    auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must be varshape image batch");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(out.exportData(stream));
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output must be varshape image batch");
+    }
+
+    auto *interpData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(interpolation.exportData());
+    if (interpData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Interpolation must be cuda-accessible, pitch-linear tensor");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOpVarShape->inferPerSample(*inData, *outData, *interpData, antialias, stream));
+}
+
+void Resize::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor *const *out,
+                        const NVCVInterpolationType *interpolation, int32_t numOutputs) const
+{
+    auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    if (numOutputs <= 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Must have at least one output");
+    }
+
+    std::vector<const nvcv::ITensorDataStridedCuda *> outData(numOutputs);
+    for (int32_t o = 0; o < numOutputs; ++o)
+    {
+        outData[o] = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out[o]->exportData());
+        if (outData[o] == nullptr)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Output must be cuda-accessible, pitch-linear tensor");
+        }
+    }
+
+    NVCV_CHECK_THROW(m_legacyOp->inferMulti(*inData, outData.data(), interpolation, numOutputs, stream));
+}
+
+void Resize::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in,
+                        const nvcv::IImageBatchVarShape *const *out, const NVCVInterpolationType *interpolation,
+                        int32_t numOutputs) const
+{
+    auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must be varshape image batch");
+    }
+
+    if (numOutputs <= 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Must have at least one output");
+    }
+
+    std::vector<const nvcv::IImageBatchVarShapeDataStridedCuda *> outData(numOutputs);
+    for (int32_t o = 0; o < numOutputs; ++o)
+    {
+        outData[o] = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(out[o]->exportData(stream));
+        if (outData[o] == nullptr)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output must be varshape image batch");
+        }
+    }
+
+    NVCV_CHECK_THROW(m_legacyOpVarShape->inferMulti(*inData, outData.data(), interpolation, numOutputs, stream));
+}
+
+void Resize::pyramid(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor *const *out,
+                     int32_t numLevels, const NVCVInterpolationType interpolation) const
+{
+    if (numLevels <= 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Pyramid must have at least one level");
+    }
+
+    std::vector<NVCVInterpolationType> interpolations(numLevels, interpolation);
+    (*this)(stream, in, out, interpolations.data(), numLevels);
+}
+
+ResizePlan::ResizePlan(const NVCVTensorRequirements &inReqs, const NVCVTensorRequirements &outReqs,
+                       const NVCVInterpolationType interpolation)
+    : m_inShape(inReqs.shape, inReqs.rank, inReqs.layout)
+    , m_outShape(outReqs.shape, outReqs.rank, outReqs.layout)
+    , m_dtype(inReqs.dtype)
+    , m_interpolation(interpolation)
+{
+    if (inReqs.dtype != outReqs.dtype)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input and output tensors must have the same data type");
+    }
+
+    NVCV_CHECK_THROW(legacy::Resize::plan(m_inShape, m_dtype, m_outShape, m_interpolation, m_func));
+}
+
+void ResizePlan::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out) const
+{
+    auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out.exportData());
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    (*this)(stream, *inData, *outData);
+}
+
+void ResizePlan::operator()(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                            const nvcv::ITensorDataStridedCuda &out) const
+{
+    nvcv::detail::CheckThrow(this->submit(stream, in, out));
+}
+
+NVCVStatus ResizePlan::submit(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                              const nvcv::ITensorDataStridedCuda &out) const
+{
+    // only what the plan was created for is checked, the rest was validated at plan creation
+    if (in.shape() != m_inShape || out.shape() != m_outShape || in.dtype() != m_dtype || out.dtype() != m_dtype)
+    {
+        nvcvSetThreadStatus(NVCV_ERROR_INVALID_ARGUMENT,
+                            "Input and output tensors don't match the shapes and data type of the plan");
+        return NVCV_ERROR_INVALID_ARGUMENT;
+    }
+
+    m_func(in, out, m_interpolation, stream);
+    return NVCV_SUCCESS;
+}
+
+NVCVOperatorEstimate ResizePlan::estimate() const
+{
+    NVCVOperatorEstimate estimate;
+    estimate.workspaceBytes = this->workspaceRequirements().cudaMemSize;
+
+    NVCV_CHECK_THROW(legacy::Resize::estimate(m_inShape, m_dtype, m_outShape, m_interpolation, estimate.bytesMoved,
+                                              estimate.gpuTimeMs));
+    return estimate;
 }
 
 } // namespace cvcuda::priv
@@ -42,14 +42,67 @@ public:
     void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out,
                     const NVCVInterpolationType interpolation) const;
 
+    // Same, with output channel c interpolated from input channel channelOrder[c]
+    void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out,
+                    const NVCVInterpolationType interpolation, NVCVSwizzle channelOrder) const;
+
+    // Resizes already exported tensor data, without going through the tensors
+    void operator()(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                    const nvcv::ITensorDataStridedCuda &out, const NVCVInterpolationType interpolation) const;
+
+    // Same, but validation errors are returned and set as the thread's status instead of thrown
+    NVCVStatus submit(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                      const nvcv::ITensorDataStridedCuda &out, const NVCVInterpolationType interpolation) const;
+
     void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out,
                     const NVCVInterpolationType interpolation) const;
 
+    // Resizes each image with the interpolation of its sample, read from a tensor
+    void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out,
+                    const nvcv::ITensor &interpolation, bool antialias) const;
+
+    // Resizes the input to several outputs at once, each with its own interpolation
+    void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor *const *out,
+                    const NVCVInterpolationType *interpolation, int32_t numOutputs) const;
+
+    void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in,
+                    const nvcv::IImageBatchVarShape *const *out, const NVCVInterpolationType *interpolation,
+                    int32_t numOutputs) const;
+
+    // Resizes the input to every level of a pyramid
+    void pyramid(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor *const *out, int32_t numLevels,
+                 const NVCVInterpolationType interpolation) const;
+
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::Resize>         m_legacyOp;
     std::unique_ptr<nvcv::legacy::cuda_op::ResizeVarShape> m_legacyOpVarShape;
 };
 
+// Resize of tensors with fixed requirements, validated once at construction
+class ResizePlan final : public IOperator
+{
+public:
+    explicit ResizePlan(const NVCVTensorRequirements &inReqs, const NVCVTensorRequirements &outReqs,
+                        const NVCVInterpolationType interpolation);
+
+    void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out) const;
+    void operator()(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                    const nvcv::ITensorDataStridedCuda &out) const;
+
+    NVCVStatus submit(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                      const nvcv::ITensorDataStridedCuda &out) const;
+
+    // Predicted cost of submitting the plan on the current device
+    NVCVOperatorEstimate estimate() const;
+
+private:
+    nvcv::TensorShape     m_inShape, m_outShape;
+    nvcv::DataType        m_dtype;
+    NVCVInterpolationType m_interpolation;
+
+    nvcv::legacy::cuda_op::Resize::func_t m_func;
+};
+
 } // namespace cvcuda::priv
 
 #endif // CVCUDA_PRIV_RESIZE_HPP
@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpResizeNormalizeReformat.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <util/CheckError.hpp>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+ResizeNormalizeReformat::ResizeNormalizeReformat()
+{
+    legacy::DataShape maxIn, maxOut;
+    //maxIn/maxOut not used by op.
+    m_legacyOp         = std::make_unique<legacy::ResizeNormalizeReformat>(maxIn, maxOut);
+    m_legacyOpVarShape = std::make_unique<legacy::ResizeNormalizeReformatVarShape>(maxIn, maxOut);
+    m_legacyOpNV12     = std::make_unique<legacy::ResizeNormalizeReformatNV12>(maxIn, maxOut);
+}
+
+static void ExportParams(const nvcv::ITensor &base, const nvcv::ITensor &scale, nvcv::ITensor &out,
+                         const nvcv::ITensorDataStridedCuda *&baseData, const nvcv::ITensorDataStridedCuda *&scaleData,
+                         const nvcv::ITensorDataStridedCuda *&outData)
+{
+    baseData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(base.exportData());
+    if (baseData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input base must be cuda-accessible, pitch-linear tensor");
+    }
+
+    scaleData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(scale.exportData());
+    if (scaleData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input scale must be cuda-accessible, pitch-linear tensor");
+    }
+
+    outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(out.exportData());
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+}
+
+void ResizeNormalizeReformat::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &base,
+                                         const nvcv::ITensor &scale, nvcv::ITensor &out,
+                                         const NVCVInterpolationType interpolation, const float global_scale,
+                                         const float shift, const float epsilon, const uint32_t flags) const
+{
+    auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(in.exportData());
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    const nvcv::ITensorDataStridedCuda *baseData, *scaleData, *outData;
+    ExportParams(base, scale, out, baseData, scaleData, outData);
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *baseData, *scaleData, *outData, interpolation, global_scale, shift,
+                                       epsilon, flags, stream));
+}
+
+void ResizeNormalizeReformat::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in,
+                                         const nvcv::ITensor &base, const nvcv::ITensor &scale, nvcv::ITensor &out,
+                                         const NVCVInterpolationType interpolation, const float global_scale,
+                                         const float shift, const float epsilon, const uint32_t flags) const
+{
+    auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, varshape pitch-linear image batch");
+    }
+
+    const nvcv::ITensorDataStridedCuda *baseData, *scaleData, *outData;
+    ExportParams(base, scale, out, baseData, scaleData, outData);
+
+    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *baseData, *scaleData, *outData, interpolation, global_scale,
+                                               shift, epsilon, flags, stream));
+}
+
+void ResizeNormalizeReformat::operator()(cudaStream_t stream, const nvcv::ITensor &luma, const nvcv::ITensor &chroma,
+                                         const NVCVRectI roi, const nvcv::ITensor &base, const nvcv::ITensor &scale,
+                                         nvcv::ITensor &out, const NVCVColorConversionCode code,
+                                         const NVCVInterpolationType interpolation, const float global_scale,
+                                         const float shift, const float epsilon, const uint32_t flags) const
+{
+    auto *lumaData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(luma.exportData());
+    if (lumaData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input luma must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *chromaData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(chroma.exportData());
+    if (chromaData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input chroma must be cuda-accessible, pitch-linear tensor");
+    }
+
+    const nvcv::ITensorDataStridedCuda *baseData, *scaleData, *outData;
+    ExportParams(base, scale, out, baseData, scaleData, outData);
+
+    NVCV_CHECK_THROW(m_legacyOpNV12->infer(*lumaData, *chromaData, roi, *baseData, *scaleData, *outData, code,
+                                           interpolation, global_scale, shift, epsilon, flags, stream));
+}
+
+} // namespace cvcuda::priv
@@ -19,20 +19,61 @@
 
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
+#include "legacy/Precision.hpp"
 
 #include <nvcv/Exception.hpp>
 #include <util/CheckError.hpp>
 
+#include <algorithm>
+
 namespace cvcuda::priv {
 
 namespace legacy = nvcv::legacy::cuda_op;
 
-Rotate::Rotate(const int maxVarShapeBatchSize)
+namespace {
+
+NVCVCoordinatePrecision ResolveCoordinatePrecision(NVCVCoordinatePrecision precision)
+{
+    switch (precision)
+    {
+    case NVCV_COORD_PRECISION_FLOAT:
+    case NVCV_COORD_PRECISION_DOUBLE:
+        return precision;
+
+    case NVCV_COORD_PRECISION_DEFAULT:
+        break;
+
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid coordinate precision %d",
+                              static_cast<int>(precision));
+    }
+
+    // The fast precision mode trades the double coordinate math for float on any GPU.
+    if (legacy::UseFastMath())
+    {
+        return NVCV_COORD_PRECISION_FLOAT;
+    }
+
+    // Consumer and inference GPUs run FP64 at 1/32 or 1/64 of the FP32 rate, where
+    // the double coordinate math dominates the kernels. Data center GPUs run it at
+    // half rate or better and keep the double path.
+    int device, ratio;
+    NVCV_CHECK_THROW(cudaGetDevice(&device));
+    NVCV_CHECK_THROW(cudaDeviceGetAttribute(&ratio, cudaDevAttrSingleToDoublePrecisionPerfRatio, device));
+
+    return ratio > 2 ? NVCV_COORD_PRECISION_FLOAT : NVCV_COORD_PRECISION_DOUBLE;
+}
+
+} // namespace
+
+Rotate::Rotate(const int maxVarShapeBatchSize, NVCVCoordinatePrecision precision)
 {
+    precision = ResolveCoordinatePrecision(precision);
+
     legacy::DataShape maxIn, maxOut;
     // maxIn/maxOut not used by op.
-    m_legacyOp         = std::make_unique<legacy::Rotate>(maxIn, maxOut);
-    m_legacyOpVarShape = std::make_unique<legacy::RotateVarShape>(maxVarShapeBatchSize);
+    m_legacyOp         = std::make_unique<legacy::Rotate>(maxIn, maxOut, precision);
+    m_legacyOpVarShape = std::make_unique<legacy::RotateVarShape>(maxVarShapeBatchSize, precision);
 }
 
 void Rotate::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out, const double angleDeg,
@@ -85,4 +126,45 @@ void Rotate::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in
     NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, *angleDegData, *shiftData, interpolation, stream));
 }
 
+void Rotate::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out,
+                        const double *angleDeg, const double2 *shift, const NVCVInterpolationType interpolation) const
+{
+    if (angleDeg == nullptr || shift == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "angleDeg and shift must not be NULL");
+    }
+
+    auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must be varshape image batch");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(out.exportData(stream));
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output must be varshape image batch");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, angleDeg, shift, interpolation, stream));
+}
+
+int64_t Rotate::doGetCudaWorkspaceSize() const
+{
+    // Tensor and varshape implementations aren't executed at the same time, they can share the workspace
+    return std::max(m_legacyOp->gpuWorkspaceSize(), m_legacyOpVarShape->gpuWorkspaceSize());
+}
+
+void Rotate::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOp->setGpuWorkspace(cudaMem);
+    m_legacyOpVarShape->setGpuWorkspace(cudaMem);
+}
+
+void Rotate::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOp->reserveGpuWorkspace(stream);
+    m_legacyOpVarShape->reserveGpuWorkspace(stream);
+}
+
 } // namespace cvcuda::priv
@@ -37,7 +37,7 @@ namespace cvcuda::priv {
 class Rotate final : public IOperator
 {
 public:
-    explicit Rotate(const int maxVarShapeBatchSize);
+    Rotate(const int maxVarShapeBatchSize, NVCVCoordinatePrecision precision);
 
     void operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &out, const double angleDeg,
                     const double2 shift, const NVCVInterpolationType interpolation) const;
@@ -45,9 +45,16 @@ public:
     void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out,
                     nvcv::ITensor &angleDeg, nvcv::ITensor &shift, const NVCVInterpolationType interpolation) const;
 
+    void operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::IImageBatchVarShape &out,
+                    const double *angleDeg, const double2 *shift, const NVCVInterpolationType interpolation) const;
+
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::Rotate>         m_legacyOp;
     std::unique_ptr<nvcv::legacy::cuda_op::RotateVarShape> m_legacyOpVarShape;
+
+    int64_t doGetCudaWorkspaceSize() const override;
+    void    doSetCudaWorkspace(void *cudaMem) override;
+    void    doReserveCudaWorkspace(cudaStream_t stream) override;
 };
 
 } // namespace cvcuda::priv
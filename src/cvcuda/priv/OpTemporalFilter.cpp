@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpTemporalFilter.hpp"
+
+#include "legacy/CvCudaLegacy.h"
+#include "legacy/CvCudaLegacyHelpers.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <util/CheckError.hpp>
+
+namespace cvcuda::priv {
+
+namespace legacy = nvcv::legacy::cuda_op;
+
+namespace {
+
+const nvcv::ITensorDataStridedCuda &ExportData(const nvcv::ITensor &tensor, const char *name)
+{
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    if (data == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "%s must be cuda-accessible, pitch-linear tensor", name);
+    }
+    return *data;
+}
+
+} // namespace
+
+TemporalFilter::TemporalFilter()
+{
+    legacy::DataShape maxIn, maxOut;
+    //maxIn/maxOut not used by op.
+    m_legacyOp = std::make_unique<legacy::TemporalFilter>(maxIn, maxOut);
+}
+
+void TemporalFilter::operator()(cudaStream_t stream, const nvcv::ITensor &in, const nvcv::ITensor &state,
+                                const nvcv::ITensor *out, const nvcv::ITensor *mask, NVCVTemporalFilterType type,
+                                float alpha, float threshold, bool reset) const
+{
+    const nvcv::ITensorDataStridedCuda &inData    = ExportData(in, "Input");
+    const nvcv::ITensorDataStridedCuda &stateData = ExportData(state, "State");
+    const nvcv::ITensorDataStridedCuda *outData   = out ? &ExportData(*out, "Output") : nullptr;
+    const nvcv::ITensorDataStridedCuda *maskData  = mask ? &ExportData(*mask, "Output mask") : nullptr;
+
+    NVCV_CHECK_THROW(
+        m_legacyOp->infer(inData, stateData, outData, maskData, type, alpha, threshold, reset, stream));
+}
+
+} // namespace cvcuda::priv
@@ -23,6 +23,8 @@
 #include <nvcv/Exception.hpp>
 #include <util/CheckError.hpp>
 
+#include <algorithm>
+
 namespace cvcuda::priv {
 
 namespace legacy = nvcv::legacy::cuda_op;
@@ -53,6 +55,40 @@ void WarpAffine::operator()(cudaStream_t stream, const nvcv::ITensor &in, const
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
+    auto inPlanes  = nvcv::legacy::helpers::PlanesAsSamples(*inData);
+    auto outPlanes = nvcv::legacy::helpers::PlanesAsSamples(*outData);
+    if (inPlanes && outPlanes)
+    {
+        // The constant border differs per channel, each channel's planes are then warped with their own value
+        auto inInfo = nvcv::TensorShapeInfoImage::Create(inData->shape());
+        if (borderMode == NVCV_BORDER_CONSTANT && inInfo && inInfo->numChannels() > 1)
+        {
+            if (inInfo->numChannels() > 4)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid channel number %d",
+                                      inInfo->numChannels());
+            }
+
+            const float values[4] = {borderValue.x, borderValue.y, borderValue.z, borderValue.w};
+            for (int c = 0; c < inInfo->numChannels(); ++c)
+            {
+                auto inChannel  = nvcv::legacy::helpers::PlanesAsSamples(*inData, c);
+                auto outChannel = nvcv::legacy::helpers::PlanesAsSamples(*outData, c);
+                if (!inChannel || !outChannel)
+                {
+                    throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                          "Input and output must have the same number of channels");
+                }
+                NVCV_CHECK_THROW(m_legacyOp->infer(*inChannel, *outChannel, xform, flags, borderMode,
+                                                   float4{values[c], values[c], values[c], values[c]}, stream));
+            }
+            return;
+        }
+
+        inData  = &*inPlanes;
+        outData = &*outPlanes;
+    }
+
     NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, xform, flags, borderMode, borderValue, stream));
 }
 
@@ -83,4 +119,46 @@ void WarpAffine::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape
         m_legacyOpVarShape->infer(*inData, *outData, *transMatrixData, flags, borderMode, borderValue, stream));
 }
 
+void WarpAffine::operator()(cudaStream_t stream, const nvcv::IImageBatchVarShape &in,
+                            const nvcv::IImageBatchVarShape &out, const NVCVAffineTransform *xforms,
+                            const int32_t flags, const NVCVBorderType borderMode, const float4 borderValue) const
+{
+    if (xforms == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "xforms must not be NULL");
+    }
+
+    auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must be varshape image batch");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(out.exportData(stream));
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output must be varshape image batch");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOpVarShape->infer(*inData, *outData, xforms[0], flags, borderMode, borderValue, stream));
+}
+
+int64_t WarpAffine::doGetCudaWorkspaceSize() const
+{
+    // Tensor and varshape implementations aren't executed at the same time, they can share the workspace
+    return std::max(m_legacyOp->gpuWorkspaceSize(), m_legacyOpVarShape->gpuWorkspaceSize());
+}
+
+void WarpAffine::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOp->setGpuWorkspace(cudaMem);
+    m_legacyOpVarShape->setGpuWorkspace(cudaMem);
+}
+
+void WarpAffine::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOp->reserveGpuWorkspace(stream);
+    m_legacyOpVarShape->reserveGpuWorkspace(stream);
+}
+
 } // namespace cvcuda::priv
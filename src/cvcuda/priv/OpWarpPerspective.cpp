@@ -23,6 +23,8 @@
 #include <nvcv/Exception.hpp>
 #include <util/CheckError.hpp>
 
+#include <algorithm>
+
 namespace cvcuda::priv {
 
 namespace legacy = nvcv::legacy::cuda_op;
@@ -73,7 +75,7 @@ void WarpPerspective::operator()(cudaStream_t stream, const nvcv::IImageBatchVar
     }
 
     auto *transMatrixData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(transMatrix.exportData());
-    if (outData == nullptr)
+    if (transMatrixData == nullptr)
     {
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
                               "transformation matrix must be cuda-accessible, pitch-linear tensor");
@@ -83,4 +85,55 @@ void WarpPerspective::operator()(cudaStream_t stream, const nvcv::IImageBatchVar
         m_legacyOpVarShape->infer(*inData, *outData, *transMatrixData, flags, borderMode, borderValue, stream));
 }
 
+void WarpPerspective::crop(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &quads,
+                           const nvcv::IImageBatchVarShape &out, const int32_t flags, const NVCVBorderType borderMode,
+                           const float4 borderValue) const
+{
+    if (flags & ~NVCV_INTERP_MAX)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Flags must only hold the interpolation, quadrilaterals are always in the input");
+    }
+
+    auto *inData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(in.exportData(stream));
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must be varshape image batch");
+    }
+
+    auto *quadData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(quads.exportData());
+    if (quadData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Quadrilaterals must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto *outData = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(out.exportData(stream));
+    if (outData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Output must be varshape image batch");
+    }
+
+    NVCV_CHECK_THROW(
+        m_legacyOpVarShape->inferCrop(*inData, *quadData, *outData, flags, borderMode, borderValue, stream));
+}
+
+int64_t WarpPerspective::doGetCudaWorkspaceSize() const
+{
+    // Tensor and varshape implementations aren't executed at the same time, they can share the workspace
+    return std::max(m_legacyOp->gpuWorkspaceSize(), m_legacyOpVarShape->gpuWorkspaceSize());
+}
+
+void WarpPerspective::doSetCudaWorkspace(void *cudaMem)
+{
+    m_legacyOp->setGpuWorkspace(cudaMem);
+    m_legacyOpVarShape->setGpuWorkspace(cudaMem);
+}
+
+void WarpPerspective::doReserveCudaWorkspace(cudaStream_t stream)
+{
+    m_legacyOp->reserveGpuWorkspace(stream);
+    m_legacyOpVarShape->reserveGpuWorkspace(stream);
+}
+
 } // namespace cvcuda::priv
@@ -48,9 +48,17 @@ public:
                     const nvcv::ITensor &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
                     const float4 borderValue) const;
 
+    void crop(cudaStream_t stream, const nvcv::IImageBatchVarShape &in, const nvcv::ITensor &quads,
+              const nvcv::IImageBatchVarShape &out, const int32_t flags, const NVCVBorderType borderMode,
+              const float4 borderValue) const;
+
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::WarpPerspective>         m_legacyOp;
     std::unique_ptr<nvcv::legacy::cuda_op::WarpPerspectiveVarShape> m_legacyOpVarShape;
+
+    int64_t doGetCudaWorkspaceSize() const override;
+    void    doSetCudaWorkspace(void *cudaMem) override;
+    void    doReserveCudaWorkspace(cudaStream_t stream) override;
 };
 
 } // namespace cvcuda::priv
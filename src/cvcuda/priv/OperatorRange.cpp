@@ -0,0 +1,465 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OperatorRange.hpp"
+
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+
+#ifdef CVCUDA_ENABLE_NVTX
+#    include <nvtx3/nvToolsExt.h>
+#endif
+
+#include <nvcv/Exception.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace cvcuda::priv {
+
+namespace {
+
+// Timings still pending beyond this are dropped, e.g. when stats are never read while the GPU is far behind
+constexpr size_t kMaxPendingTimings = 4096;
+
+// Execution counters of the sampling, operators are spread over them by the address of their name
+constexpr size_t kNumSampleCounters = 64;
+
+// Bin 0 holds times below 1 us, bin i times in [2^(i-1), 2^i) us
+int HistogramBin(double ms)
+{
+    const double us  = ms * 1000.0;
+    const int    bin = us < 1.0 ? 0 : 1 + static_cast<int>(std::floor(std::log2(us)));
+    return std::min(bin, CVCUDA_OPERATOR_STATS_NUM_BINS - 1);
+}
+
+// Device the input tensor is on, or -1 if there's no need to switch to it
+int InputDevice(NVCVTensorHandle in)
+{
+    static const int numDevices = []
+    {
+        int count = 0;
+        if (cudaGetDeviceCount(&count) != cudaSuccess)
+        {
+            cudaGetLastError();
+        }
+        return count;
+    }();
+
+    int32_t device = -1;
+    if (in == nullptr || numDevices <= 1 || nvcvTensorGetDevice(in, &device) != NVCV_SUCCESS)
+    {
+        return -1;
+    }
+    return device;
+}
+
+struct PendingTiming
+{
+    const char *name;
+    int         device;
+    cudaEvent_t start;
+    cudaEvent_t end;
+    double      submitMs;
+};
+
+class OperatorTimer
+{
+public:
+    static OperatorTimer &Instance()
+    {
+        // Never destroyed, events can't be destroyed once the cuda runtime is torn down at exit
+        static OperatorTimer *timer = new OperatorTimer;
+        return *timer;
+    }
+
+    bool enabled() const
+    {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool enabled)
+    {
+        m_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void setSampling(int32_t sampleEvery)
+    {
+        m_sampleEvery.store(sampleEvery, std::memory_order_relaxed);
+    }
+
+    // Whether this execution of the operator is one of the sampled ones
+    bool sample(const char *name)
+    {
+        const uint32_t every = m_sampleEvery.load(std::memory_order_relaxed);
+        if (every <= 1)
+        {
+            return true;
+        }
+
+        auto &counter = m_sampleCounters[(reinterpret_cast<uintptr_t>(name) >> 4) % kNumSampleCounters];
+        return counter.fetch_add(1, std::memory_order_relaxed) % every == 0;
+    }
+
+    // Events are pooled per device, as they can only be recorded on streams of the device they were created on
+    cudaEvent_t acquireEvent(int device)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto it = std::find_if(m_pool.begin(), m_pool.end(), [device](auto &e) { return e.first == device; });
+            if (it != m_pool.end())
+            {
+                cudaEvent_t event = it->second;
+                m_pool.erase(it);
+                return event;
+            }
+        }
+
+        cudaEvent_t event = nullptr;
+        if (cudaEventCreate(&event) != cudaSuccess)
+        {
+            cudaGetLastError();
+            return nullptr;
+        }
+        return event;
+    }
+
+    void releaseEvent(int device, cudaEvent_t event)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pool.emplace_back(device, event);
+    }
+
+    void add(const char *name, int device, cudaEvent_t start, cudaEvent_t end, double submitMs)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_pending.push_back({name, device, start, end, submitMs});
+
+        // Cheap in-order collection, stats() collects everything that completed
+        while (!m_pending.empty() && tryCollectLocked(m_pending.front()))
+        {
+            m_pending.pop_front();
+        }
+
+        if (m_pending.size() > kMaxPendingTimings)
+        {
+            releaseLocked(m_pending.front());
+            m_pending.pop_front();
+        }
+    }
+
+    std::vector<NVCVOperatorStats> stats()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_pending.erase(std::remove_if(m_pending.begin(), m_pending.end(),
+                                       [this](const PendingTiming &t) { return tryCollectLocked(t); }),
+                        m_pending.end());
+
+        std::vector<NVCVOperatorStats> out;
+        out.reserve(m_stats.size());
+        for (const auto &[name, stats] : m_stats)
+        {
+            out.push_back(stats);
+        }
+        return out;
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (const PendingTiming &t : m_pending)
+        {
+            releaseLocked(t);
+        }
+        m_pending.clear();
+        m_stats.clear();
+    }
+
+    // The sink thread also collects the timings, so that they don't pile up while nobody reads the stats
+    void setSink(NVCVOperatorStatsSinkFunc sink, void *userData, int32_t intervalMs)
+    {
+        std::lock_guard<std::mutex> sinkLock(m_sinkSetMutex);
+
+        if (m_sinkThread.joinable())
+        {
+            if (m_sinkThread.get_id() == std::this_thread::get_id())
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_OPERATION,
+                                      "Operator stats sink can't be set from the sink");
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_sinkMutex);
+                m_sinkStop = true;
+            }
+            m_sinkCond.notify_all();
+            m_sinkThread.join();
+        }
+
+        if (sink == nullptr)
+        {
+            return;
+        }
+
+        m_sinkStop   = false;
+        m_sinkThread = std::thread(
+            [this, sink, userData, interval = std::chrono::milliseconds(intervalMs)]
+            {
+                std::unique_lock<std::mutex> lock(m_sinkMutex);
+                while (!m_sinkCond.wait_for(lock, interval, [this] { return m_sinkStop; }))
+                {
+                    lock.unlock();
+
+                    std::vector<NVCVOperatorStats> all = this->stats();
+                    sink(userData, all.data(), static_cast<int32_t>(all.size()));
+
+                    lock.lock();
+                }
+            });
+    }
+
+private:
+    std::atomic<bool>     m_enabled{false};
+    std::atomic<uint32_t> m_sampleEvery{1};
+
+    std::array<std::atomic<uint32_t>, kNumSampleCounters> m_sampleCounters{};
+
+    std::mutex              m_sinkSetMutex;
+    std::mutex              m_sinkMutex;
+    std::condition_variable m_sinkCond;
+    bool                    m_sinkStop = false; // protected by m_sinkMutex
+    std::thread             m_sinkThread;
+
+    std::mutex                                m_mutex;
+    std::deque<PendingTiming>                 m_pending;
+    std::vector<std::pair<int, cudaEvent_t>>  m_pool;
+    std::map<std::string, NVCVOperatorStats> m_stats;
+
+    void releaseLocked(const PendingTiming &t)
+    {
+        m_pool.emplace_back(t.device, t.start);
+        m_pool.emplace_back(t.device, t.end);
+    }
+
+    // Adds the timing to the stats and returns true if its events completed, or failed
+    bool tryCollectLocked(const PendingTiming &t)
+    {
+        cudaError_t err = cudaEventQuery(t.end);
+        if (err == cudaErrorNotReady)
+        {
+            return false;
+        }
+
+        float ms = 0;
+        if (err == cudaSuccess && cudaEventElapsedTime(&ms, t.start, t.end) == cudaSuccess)
+        {
+            addLocked(t.name, ms, t.submitMs);
+        }
+        else
+        {
+            cudaGetLastError();
+        }
+
+        releaseLocked(t);
+        return true;
+    }
+
+    void addLocked(const char *name, float ms, double submitMs)
+    {
+        auto [it, inserted] = m_stats.try_emplace(name);
+
+        NVCVOperatorStats &stats = it->second;
+        if (inserted)
+        {
+            strncpy(stats.name, name, sizeof(stats.name) - 1);
+            stats.minTimeMs = ms;
+            stats.maxTimeMs = ms;
+        }
+
+        stats.count += 1;
+        stats.totalTimeMs += ms;
+        stats.minTimeMs = std::min<double>(stats.minTimeMs, ms);
+        stats.maxTimeMs = std::max<double>(stats.maxTimeMs, ms);
+        stats.histogram[HistogramBin(ms)] += 1;
+
+        stats.totalSubmitTimeMs += submitMs;
+        stats.maxSubmitTimeMs = std::max(stats.maxSubmitTimeMs, submitMs);
+        stats.submitHistogram[HistogramBin(submitMs)] += 1;
+    }
+};
+
+} // namespace
+
+OperatorRange::OperatorRange(const char *name, cudaStream_t stream)
+    : m_name(name)
+    , m_stream(stream)
+{
+    begin(name);
+}
+
+OperatorRange::OperatorRange(const char *name, cudaStream_t stream, NVCVTensorHandle in)
+    : m_name(name)
+    , m_stream(stream)
+{
+    m_deviceGuard.emplace(InputDevice(in));
+
+#ifdef CVCUDA_ENABLE_NVTX
+    std::ostringstream ss;
+    ss << name;
+    if (in != nullptr)
+    {
+        nvcv::TensorWrapHandle tensor(in);
+        ss << ' ' << tensor.shape() << ' ' << tensor.dtype();
+    }
+    begin(ss.str().c_str());
+#else
+    (void)in;
+    begin(name);
+#endif
+}
+
+OperatorRange::OperatorRange(const char *name, cudaStream_t stream, NVCVImageBatchHandle in)
+    : m_name(name)
+    , m_stream(stream)
+{
+#ifdef CVCUDA_ENABLE_NVTX
+    std::ostringstream ss;
+    ss << name;
+    if (in != nullptr)
+    {
+        nvcv::ImageBatchVarShapeWrapHandle batch(in);
+        ss << ' ' << batch.numImages() << " images up to " << batch.maxSize().w << 'x' << batch.maxSize().h << ' '
+           << batch.uniqueFormat();
+    }
+    begin(ss.str().c_str());
+#else
+    (void)in;
+    begin(name);
+#endif
+}
+
+void OperatorRange::begin(const char *message)
+{
+#ifdef CVCUDA_ENABLE_NVTX
+    nvtxRangePushA(message);
+#else
+    (void)message;
+#endif
+
+    OperatorTimer &timer = OperatorTimer::Instance();
+    if (!timer.enabled() || !timer.sample(m_name))
+    {
+        return;
+    }
+
+    // Events recorded while capturing become graph nodes, they can't be queried
+    cudaStreamCaptureStatus capture = cudaStreamCaptureStatusNone;
+    if (cudaStreamIsCapturing(m_stream, &capture) != cudaSuccess || capture != cudaStreamCaptureStatusNone
+        || cudaGetDevice(&m_device) != cudaSuccess)
+    {
+        cudaGetLastError();
+        return;
+    }
+
+    m_start = timer.acquireEvent(m_device);
+    if (m_start != nullptr && cudaEventRecord(m_start, m_stream) != cudaSuccess)
+    {
+        cudaGetLastError();
+        timer.releaseEvent(m_device, m_start);
+        m_start = nullptr;
+    }
+
+    m_uncaught    = std::uncaught_exceptions();
+    m_submitStart = std::chrono::steady_clock::now();
+}
+
+OperatorRange::~OperatorRange()
+{
+    if (m_start != nullptr)
+    {
+        OperatorTimer &timer = OperatorTimer::Instance();
+
+        const double submitMs
+            = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_submitStart).count();
+
+        cudaEvent_t end = nullptr;
+        if (std::uncaught_exceptions() == m_uncaught)
+        {
+            end = timer.acquireEvent(m_device);
+        }
+
+        if (end != nullptr && cudaEventRecord(end, m_stream) == cudaSuccess)
+        {
+            timer.add(m_name, m_device, m_start, end, submitMs);
+        }
+        else
+        {
+            cudaGetLastError();
+            timer.releaseEvent(m_device, m_start);
+            if (end != nullptr)
+            {
+                timer.releaseEvent(m_device, end);
+            }
+        }
+    }
+
+#ifdef CVCUDA_ENABLE_NVTX
+    nvtxRangePop();
+#endif
+}
+
+void SetOperatorTimingEnabled(bool enabled)
+{
+    OperatorTimer::Instance().setEnabled(enabled);
+}
+
+std::vector<NVCVOperatorStats> GetOperatorStats()
+{
+    return OperatorTimer::Instance().stats();
+}
+
+void ResetOperatorStats()
+{
+    OperatorTimer::Instance().reset();
+}
+
+void SetOperatorTimingSampling(int32_t sampleEvery)
+{
+    OperatorTimer::Instance().setSampling(sampleEvery);
+}
+
+void SetOperatorStatsSink(NVCVOperatorStatsSinkFunc sink, void *userData, int32_t intervalMs)
+{
+    OperatorTimer::Instance().setSink(sink, userData, intervalMs);
+}
+
+} // namespace cvcuda::priv
@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file OperatorRange.hpp
+ *
+ * @brief Defines the instrumentation of operator executions, with NVTX ranges and GPU timing.
+ */
+
+#ifndef CVCUDA_PRIV_OPERATOR_RANGE_HPP
+#define CVCUDA_PRIV_OPERATOR_RANGE_HPP
+
+#include <cuda_runtime.h>
+#include <cvcuda/Operator.h>
+#include <nvcv/ImageBatch.h>
+#include <nvcv/Tensor.h>
+#include <util/DeviceGuard.hpp>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace cvcuda::priv {
+
+// Instruments the execution of an operator for as long as it's in scope.  When built with ENABLE_NVTX, it's an NVTX
+// range named after the operator and the shape and type of its input.  When timing is enabled, the GPU time between
+// its construction and destruction is measured with events recorded on the stream, and added to the operator stats
+// once the events complete, along with the CPU time in between.  Only sampled executions are timed, and those that
+// throw, or happen while the stream is captured in a graph, aren't.
+// With several devices, the device of the input tensor is made current while in scope, so that operators run on the
+// device their data is on without the caller having to switch to it.
+class OperatorRange
+{
+public:
+    OperatorRange(const char *name, cudaStream_t stream);
+    OperatorRange(const char *name, cudaStream_t stream, NVCVTensorHandle in);
+    OperatorRange(const char *name, cudaStream_t stream, NVCVImageBatchHandle in);
+
+    ~OperatorRange();
+
+    OperatorRange(const OperatorRange &)            = delete;
+    OperatorRange &operator=(const OperatorRange &) = delete;
+
+private:
+    const char  *m_name;
+    cudaStream_t m_stream;
+    cudaEvent_t  m_start    = nullptr;
+    int          m_device   = 0;
+    int          m_uncaught = 0;
+
+    std::chrono::steady_clock::time_point m_submitStart;
+
+    std::optional<nvcv::util::DeviceGuard> m_deviceGuard;
+
+    void begin(const char *message);
+};
+
+void SetOperatorTimingEnabled(bool enabled);
+
+void SetOperatorTimingSampling(int32_t sampleEvery);
+
+// Returns the stats of the operators timed so far, after adding the executions that completed since the last call.
+std::vector<NVCVOperatorStats> GetOperatorStats();
+
+void ResetOperatorStats();
+
+// Replaces the sink the stats are pushed to by a background thread, a null sink stops it.
+void SetOperatorStatsSink(NVCVOperatorStatsSinkFunc sink, void *userData, int32_t intervalMs);
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_OPERATOR_RANGE_HPP
@@ -0,0 +1,186 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CV_CUDA_BILATERAL_FILTER_TILE_CUH
+#define CV_CUDA_BILATERAL_FILTER_TILE_CUH
+
+#include "CvCudaUtils.cuh"
+
+#include <nvcv/cuda/MathOps.hpp>
+#include <nvcv/cuda/MathWrappers.hpp>
+#include <nvcv/cuda/SaturateCast.hpp>
+#include <nvcv/cuda/StaticCast.hpp>
+#include <nvcv/cuda/TypeTraits.hpp>
+
+namespace nvcv::legacy::cuda_op {
+
+// Side of the square block of threads, and of outputs, of the tiled bilateral filters.
+constexpr int kBilateralTileBlock = 16;
+
+// Dynamic shared memory available to the tiled bilateral filters, larger radii use the direct kernels.
+constexpr int kBilateralTileMaxSharedMem = 48 * 1024;
+
+// 8-bit types have few enough color distances to tabulate all their weights.
+template<typename T>
+constexpr bool kBilateralColorLUT = sizeof(cuda::BaseType<T>) == 1;
+
+// Number of floats of a lookup table with n entries, padded to keep the following data 16-byte aligned.
+__host__ __device__ inline int BilateralLUTCount(int n)
+{
+    return (n + 3) / 4 * 4;
+}
+
+// Dynamic shared memory of the tiled bilateral filter: the spatial and color weight tables followed by
+// numImages tiles of input pixels with a halo of radius.
+template<typename T>
+int BilateralTileSharedMemSize(int radius, int numImages)
+{
+    int tileSide = kBilateralTileBlock + 2 * radius;
+    int numLUT   = BilateralLUTCount(radius * radius + 1);
+    if constexpr (kBilateralColorLUT<T>)
+    {
+        numLUT += BilateralLUTCount(255 * cuda::NumElements<T> + 1);
+    }
+    return numLUT * sizeof(float) + numImages * tileSide * tileSide * sizeof(T);
+}
+
+/**
+ * Compute one output pixel of the bilateral filter from tiles in shared memory.
+ *
+ * The block loads the input (and for the joint filter the color guide) of its tile plus a halo of \p radius in
+ * shared memory once, instead of every tap going through the border wrapper in global memory.  The spatial
+ * weights only depend on the squared distance to the center, so they are tabulated once per block, as are the
+ * color weights of 8-bit inputs, whose L1 color distances are integers in [0, 255 * channels].  Other types
+ * still evaluate the color weight with one exp() per tap, ExpF<Fast>.
+ *
+ * All threads of the block must call this function, which writes the output with \p store when the thread's
+ * pixel is inside the image.
+ *
+ * @param smem Dynamic shared memory of BilateralTileSharedMemSize<T>(radius, Joint ? 2 : 1) bytes.
+ * @param src Border-aware wrapper of the input, read at (x, y, batch_idx) coordinates.
+ * @param srcColor Border-aware wrapper of the color guide, only read for the joint filter.
+ * @param store Functor store(coord, value) writing the output pixel.
+ */
+template<bool Joint, bool Fast, class SrcWrapper, class Store>
+__device__ void BilateralFilterTile(unsigned char *smem, const SrcWrapper &src, const SrcWrapper &srcColor,
+                                    int radius, float sigmaColor, float sigmaSpace, int rows, int columns,
+                                    Store store)
+{
+    using T         = std::remove_const_t<typename SrcWrapper::ValueType>;
+    using work_type = cuda::ConvertBaseTypeTo<float, T>;
+
+    const int tileSide       = kBilateralTileBlock + 2 * radius;
+    const int squared_radius = radius * radius;
+    const int tid            = threadIdx.y * blockDim.x + threadIdx.x;
+    const int numThreads     = blockDim.x * blockDim.y;
+    const int batch_idx      = blockIdx.z;
+
+    float space_coefficient = -1 / (2 * sigmaSpace * sigmaSpace);
+    float color_coefficient = -1 / (2 * sigmaColor * sigmaColor);
+
+    float *spaceLUT = reinterpret_cast<float *>(smem);
+    float *colorLUT = spaceLUT + BilateralLUTCount(squared_radius + 1);
+    T     *tile     = reinterpret_cast<T *>(colorLUT);
+
+    for (int i = tid; i <= squared_radius; i += numThreads)
+    {
+        spaceLUT[i] = ExpF<Fast>(i * space_coefficient);
+    }
+
+    if constexpr (kBilateralColorLUT<T>)
+    {
+        constexpr int numColors = 255 * cuda::NumElements<T> + 1;
+        for (int i = tid; i < numColors; i += numThreads)
+        {
+            colorLUT[i] = ExpF<Fast>(static_cast<float>(i * i) * color_coefficient);
+        }
+        tile = reinterpret_cast<T *>(colorLUT + BilateralLUTCount(numColors));
+    }
+
+    T *colorTile = Joint ? tile + tileSide * tileSide : tile;
+
+    const int x0 = blockIdx.x * kBilateralTileBlock - radius;
+    const int y0 = blockIdx.y * kBilateralTileBlock - radius;
+
+    for (int i = tid; i < tileSide * tileSide; i += numThreads)
+    {
+        int3 coord{x0 + i % tileSide, y0 + i / tileSide, batch_idx};
+        tile[i] = src[coord];
+        if constexpr (Joint)
+        {
+            colorTile[i] = srcColor[coord];
+        }
+    }
+
+    __syncthreads();
+
+    const int colIdx = blockIdx.x * kBilateralTileBlock + threadIdx.x;
+    const int rowIdx = blockIdx.y * kBilateralTileBlock + threadIdx.y;
+    if (colIdx >= columns || rowIdx >= rows)
+    {
+        return;
+    }
+
+    const int centerIdx   = (threadIdx.y + radius) * tileSide + threadIdx.x + radius;
+    work_type centerColor = cuda::StaticCast<float>(colorTile[centerIdx]);
+    work_type numerator   = cuda::SetAll<work_type>(0);
+    float     denominator = 0;
+
+    for (int dy = -radius; dy <= radius; ++dy)
+    {
+        const T *tileRow  = tile + centerIdx + dy * tileSide;
+        const T *colorRow = colorTile + centerIdx + dy * tileSide;
+
+        for (int dx = -radius; dx <= radius; ++dx)
+        {
+            int squared_dis = dx * dx + dy * dy;
+            if (squared_dis > squared_radius)
+            {
+                continue;
+            }
+
+            work_type diff          = cuda::StaticCast<float>(colorRow[dx]) - centerColor;
+            float     one_norm_size = 0;
+#pragma unroll
+            for (int e = 0; e < cuda::NumElements<T>; ++e)
+            {
+                one_norm_size += cuda::abs(cuda::GetElement(diff, e));
+            }
+
+            float weight;
+            if constexpr (kBilateralColorLUT<T>)
+            {
+                weight = spaceLUT[squared_dis] * colorLUT[static_cast<int>(one_norm_size)];
+            }
+            else
+            {
+                weight = spaceLUT[squared_dis] * ExpF<Fast>(one_norm_size * one_norm_size * color_coefficient);
+            }
+
+            work_type curr = cuda::StaticCast<float>(tileRow[dx]);
+            denominator += weight;
+            numerator += weight * curr;
+        }
+    }
+
+    denominator = (denominator != 0) ? denominator : 1.0f;
+    store(int3{colIdx, rowIdx, batch_idx}, cuda::SaturateCast<T>(numerator / denominator));
+}
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_BILATERAL_FILTER_TILE_CUH
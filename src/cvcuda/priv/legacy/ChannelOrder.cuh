@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file ChannelOrder.cuh
+ *
+ * @brief Channel reordering folded into the loads or stores of the operators that take a ChannelOrder.
+ */
+
+#ifndef CV_CUDA_CHANNEL_ORDER_CUH
+#define CV_CUDA_CHANNEL_ORDER_CUH
+
+#include "CvCudaLegacy.h"
+#include "CvCudaUtils.cuh"
+
+#include <type_traits>
+
+namespace nvcv::legacy::cuda_op {
+
+// Input channel read for output channel c, channels past the first four are kept in place.
+__device__ __forceinline__ int SourceChannel(const ChannelOrder &order, int c)
+{
+    return c < 4 ? order.channel[c] : c;
+}
+
+// Returns the pixel with its channels reordered.  Channels are selected with compile-time indices, so that pixels
+// stay in registers.
+template<typename T>
+__device__ __forceinline__ T Reorder(const T &pix, const ChannelOrder &order)
+{
+    constexpr int NC = cuda::NumElements<T>;
+
+    T out = pix;
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
+    {
+#pragma unroll
+        for (int k = 0; k < NC; ++k)
+        {
+            if (order.channel[c] == k)
+            {
+                cuda::GetElement(out, c) = cuda::GetElement(pix, k);
+            }
+        }
+    }
+    return out;
+}
+
+// Wraps a tensor or image batch wrap so that pixels are reordered as kernels access them with *wrap.ptr(...):
+// loads from wraps of const values return reordered pixels, stores to the others reorder the stored pixels.
+template<class Wrap>
+class ChannelOrderWrap
+{
+public:
+    using ValueType = typename Wrap::ValueType;
+    using PixelType = std::remove_const_t<ValueType>;
+
+    // Result of a store through *ptr(...)
+    class Ref
+    {
+    public:
+        __device__ Ref(PixelType *ptr, const ChannelOrder &order)
+            : m_ptr(ptr)
+            , m_order(order)
+        {
+        }
+
+        __device__ void operator=(const PixelType &pix) const
+        {
+            *m_ptr = Reorder(pix, m_order);
+        }
+
+    private:
+        PixelType   *m_ptr;
+        ChannelOrder m_order;
+    };
+
+    // Result of ptr(...), to be dereferenced
+    class Pointer
+    {
+    public:
+        __device__ Pointer(ValueType *ptr, const ChannelOrder &order)
+            : m_ptr(ptr)
+            , m_order(order)
+        {
+        }
+
+        __device__ auto operator*() const
+        {
+            if constexpr (std::is_const_v<ValueType>)
+            {
+                return Reorder(*m_ptr, m_order);
+            }
+            else
+            {
+                return Ref(m_ptr, m_order);
+            }
+        }
+
+    private:
+        ValueType   *m_ptr;
+        ChannelOrder m_order;
+    };
+
+    ChannelOrderWrap(Wrap wrap, const ChannelOrder &order)
+        : m_wrap(wrap)
+        , m_order(order)
+    {
+    }
+
+    template<typename... Coords>
+    __device__ Pointer ptr(Coords... coords) const
+    {
+        return Pointer(m_wrap.ptr(coords...), m_order);
+    }
+
+private:
+    Wrap         m_wrap;
+    ChannelOrder m_order;
+};
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_CHANNEL_ORDER_CUH
@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file CompositeUtils.cuh
+ *
+ * @brief 8-bit alpha blending shared by the Composite operators.
+ */
+
+#ifndef CV_CUDA_COMPOSITE_UTILS_CUH
+#define CV_CUDA_COMPOSITE_UTILS_CUH
+
+#include "CvCudaUtils.cuh"
+
+namespace nvcv::legacy::cuda_op {
+
+// Rounds x / 255 to the nearest integer for 0 <= x <= 255 * 255, without division.
+__device__ __forceinline__ int DivRound255(int x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+// Blends background c0 and foreground c1 with 8-bit alpha a, c0 + (c1 - c0) * a / 255 rounded, in integers.
+// With a premultiplied foreground, c1 is already scaled by a and only the background is attenuated.
+template<bool Premultiplied>
+__device__ __forceinline__ uchar AlphaBlend(int c0, int c1, int a)
+{
+    if constexpr (Premultiplied)
+    {
+        return min(255, c1 + DivRound255(c0 * (255 - a)));
+    }
+    else
+    {
+        return DivRound255(c0 * (255 - a) + c1 * a);
+    }
+}
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_COMPOSITE_UTILS_CUH
@@ -0,0 +1,285 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+
+#include <util/Assert.h>
+#include <util/CheckError.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace nvcv::legacy::cuda_op {
+
+CudaBaseOp::~CudaBaseOp()
+{
+    doFreeOwnGpuWorkspaces();
+}
+
+void CudaBaseOp::setGpuWorkspaceSize(size_t size)
+{
+    m_gpuWorkspaceSize = size;
+}
+
+void CudaBaseOp::setGpuWorkspace(void *workspace)
+{
+    std::lock_guard<std::mutex> lock(m_mtxGpuWorkspaces);
+
+    doFreeOwnGpuWorkspaces();
+    m_userGpuWorkspace = workspace;
+}
+
+void CudaBaseOp::reserveGpuWorkspace(cudaStream_t stream)
+{
+    std::lock_guard<std::mutex> lock(m_mtxGpuWorkspaces);
+
+    if (m_userGpuWorkspace == nullptr && m_gpuWorkspaceSize > 0)
+    {
+        doGetOwnGpuWorkspace(stream, m_gpuWorkspaceSize);
+    }
+}
+
+void CudaBaseOp::doFreeOwnGpuWorkspaces() noexcept
+{
+    for (auto &[stream, ws] : m_gpuWorkspaces)
+    {
+        // The stream might be gone by now, cudaFree waits for all the work that could still use it
+        if (!ws.streamOrdered || ws.captured || cudaFreeAsync(ws.data, stream) != cudaSuccess)
+        {
+            cudaGetLastError();
+            NVCV_CHECK_LOG(cudaFree(ws.data));
+        }
+    }
+    m_gpuWorkspaces.clear();
+
+    for (void *data : m_retiredGpuWorkspaces)
+    {
+        NVCV_CHECK_LOG(cudaFree(data));
+    }
+    m_retiredGpuWorkspaces.clear();
+}
+
+void CudaBaseOp::doReleaseGpuWorkspace(cudaStream_t stream, GpuWorkspace &ws)
+{
+    if (ws.data == nullptr)
+    {
+        return;
+    }
+
+    cudaStreamCaptureStatus captureStatus = cudaStreamCaptureStatusNone;
+    cudaError_t             err           = cudaStreamIsCapturing(stream, &captureStatus);
+
+    if (ws.captured || ws.leases > 0 || (err == cudaSuccess && captureStatus != cudaStreamCaptureStatusNone))
+    {
+        // Captured work refers to it, or the work using it isn't queued yet: it can only be freed with the operator
+        m_retiredGpuWorkspaces.push_back(ws.data);
+    }
+    else if (err == cudaSuccess && ws.streamOrdered)
+    {
+        // Freed once the work already queued on stream is done, without blocking
+        NVCV_CHECK_THROW(cudaFreeAsync(ws.data, stream));
+    }
+    else
+    {
+        // The stream is gone, or the workspace wasn't allocated in stream order:
+        // cudaFree waits for the work that still uses it
+        cudaGetLastError();
+        NVCV_CHECK_THROW(cudaFree(ws.data));
+    }
+
+    ws.data     = nullptr;
+    ws.capacity = 0;
+    ws.contents.reset();
+}
+
+auto CudaBaseOp::doGetOwnGpuWorkspace(cudaStream_t stream, size_t size) -> GpuWorkspace &
+{
+    auto it = m_gpuWorkspaces.find(stream);
+
+    if (it == m_gpuWorkspaces.end())
+    {
+        if (m_gpuWorkspaces.size() >= kMaxGpuWorkspaces)
+        {
+            // Graphs replay captured workspaces at any time, and leased ones are about to be used
+            auto lru = m_gpuWorkspaces.end();
+            for (auto cand = m_gpuWorkspaces.begin(); cand != m_gpuWorkspaces.end(); ++cand)
+            {
+                if (!cand->second.captured && cand->second.leases == 0
+                    && (lru == m_gpuWorkspaces.end() || cand->second.lastUse < lru->second.lastUse))
+                {
+                    lru = cand;
+                }
+            }
+            if (lru != m_gpuWorkspaces.end())
+            {
+                doReleaseGpuWorkspace(lru->first, lru->second);
+                m_gpuWorkspaces.erase(lru);
+            }
+        }
+        it = m_gpuWorkspaces.emplace(stream, GpuWorkspace{}).first;
+    }
+
+    GpuWorkspace &ws = it->second;
+    ws.lastUse       = ++m_gpuWorkspaceUses;
+
+    // A workspace allocated earlier, e.g. reserved, is captured as soon as it's used during capture
+    cudaStreamCaptureStatus captureStatus = cudaStreamCaptureStatusNone;
+    NVCV_CHECK_THROW(cudaStreamIsCapturing(stream, &captureStatus));
+
+    if (captureStatus != cudaStreamCaptureStatusNone && ws.data != nullptr)
+    {
+        ws.captured = true;
+    }
+
+    if (ws.capacity < size)
+    {
+        // Grow geometrically so that slowly increasing sizes don't reallocate every time
+        size_t capacity = std::min(std::max(size, 2 * ws.capacity), m_gpuWorkspaceSize);
+
+        void       *data          = nullptr;
+        bool        streamOrdered = false;
+        cudaError_t err           = cudaSuccess;
+
+        if (captureStatus == cudaStreamCaptureStatusNone)
+        {
+            // Stream-ordered, so that neither the allocation nor the release of the outgrown workspace
+            // waits for the work queued on stream
+            err           = cudaMallocAsync(&data, capacity, stream);
+            streamOrdered = err != cudaErrorNotSupported;
+            if (!streamOrdered)
+            {
+                cudaGetLastError();
+            }
+        }
+
+        if (!streamOrdered)
+        {
+            // The first call might happen while the stream is being captured into
+            // a CUDA graph, where cudaMalloc is prohibited in the default capture
+            // mode. The allocation isn't a stream operation, so it's safe to relax it.
+            cudaStreamCaptureMode mode = cudaStreamCaptureModeRelaxed;
+            NVCV_CHECK_THROW(cudaThreadExchangeStreamCaptureMode(&mode));
+
+            err = cudaMalloc(&data, capacity);
+
+            NVCV_CHECK_THROW(cudaThreadExchangeStreamCaptureMode(&mode));
+        }
+        NVCV_CHECK_THROW(err);
+
+        doReleaseGpuWorkspace(stream, ws);
+
+        ws.data          = data;
+        ws.capacity      = capacity;
+        ws.streamOrdered = streamOrdered;
+        ws.captured      = captureStatus != cudaStreamCaptureStatusNone;
+    }
+    return ws;
+}
+
+auto CudaBaseOp::gpuWorkspace(cudaStream_t stream) -> GpuWorkspaceLease
+{
+    return gpuWorkspace(stream, m_gpuWorkspaceSize);
+}
+
+auto CudaBaseOp::gpuWorkspace(cudaStream_t stream, size_t size) -> GpuWorkspaceLease
+{
+    std::lock_guard<std::mutex> lock(m_mtxGpuWorkspaces);
+
+    if (m_userGpuWorkspace != nullptr || m_gpuWorkspaceSize == 0)
+    {
+        return GpuWorkspaceLease(nullptr, stream, m_userGpuWorkspace);
+    }
+
+    NVCV_ASSERT(size <= m_gpuWorkspaceSize);
+    GpuWorkspace &ws = doGetOwnGpuWorkspace(stream, std::max<size_t>(size, 1));
+    ++ws.leases;
+    return GpuWorkspaceLease(this, stream, ws.data);
+}
+
+void CudaBaseOp::doReturnGpuWorkspace(cudaStream_t stream) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtxGpuWorkspaces);
+
+    // Gone if the user set a workspace meanwhile
+    auto it = m_gpuWorkspaces.find(stream);
+    if (it != m_gpuWorkspaces.end() && it->second.leases > 0)
+    {
+        --it->second.leases;
+    }
+}
+
+CudaBaseOp::GpuWorkspaceLease::GpuWorkspaceLease(CudaBaseOp *op, cudaStream_t stream, void *data)
+    : m_op(op)
+    , m_stream(stream)
+    , m_data(data)
+{
+}
+
+CudaBaseOp::GpuWorkspaceLease::GpuWorkspaceLease(GpuWorkspaceLease &&that) noexcept
+    : m_op(std::exchange(that.m_op, nullptr))
+    , m_stream(that.m_stream)
+    , m_data(std::exchange(that.m_data, nullptr))
+{
+}
+
+auto CudaBaseOp::GpuWorkspaceLease::operator=(GpuWorkspaceLease &&that) noexcept -> GpuWorkspaceLease &
+{
+    if (this != &that)
+    {
+        if (m_op != nullptr)
+        {
+            m_op->doReturnGpuWorkspace(m_stream);
+        }
+        m_op     = std::exchange(that.m_op, nullptr);
+        m_stream = that.m_stream;
+        m_data   = std::exchange(that.m_data, nullptr);
+    }
+    return *this;
+}
+
+CudaBaseOp::GpuWorkspaceLease::~GpuWorkspaceLease()
+{
+    if (m_op != nullptr)
+    {
+        m_op->doReturnGpuWorkspace(m_stream);
+    }
+}
+
+bool CudaBaseOp::gpuWorkspaceHolds(cudaStream_t stream, const LaunchPlanKey &contents)
+{
+    std::lock_guard<std::mutex> lock(m_mtxGpuWorkspaces);
+
+    if (m_userGpuWorkspace != nullptr || !contents.valid())
+    {
+        return false;
+    }
+
+    auto it = m_gpuWorkspaces.find(stream);
+    return it != m_gpuWorkspaces.end() && it->second.contents && *it->second.contents == contents;
+}
+
+void CudaBaseOp::setGpuWorkspaceContents(cudaStream_t stream, const LaunchPlanKey &contents)
+{
+    std::lock_guard<std::mutex> lock(m_mtxGpuWorkspaces);
+
+    if (m_userGpuWorkspace == nullptr)
+    {
+        doGetOwnGpuWorkspace(stream, 1).contents = contents;
+    }
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -18,14 +18,22 @@
 #ifndef CV_CUDA_LEGACY_H
 #define CV_CUDA_LEGACY_H
 
+#include "FFTCorrelation.hpp"
+#include "LaunchPlanCache.hpp"
+
 #include <cuda_runtime.h>
 #include <cvcuda/Types.h>
 #include <nvcv/BorderType.h>
+#include <nvcv/ColorSpec.h>
 #include <nvcv/IImageBatch.hpp>
 #include <nvcv/IImageBatchData.hpp>
 #include <nvcv/ITensorData.hpp>
 #include <nvcv/Rect.h>
 
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
 #include <vector>
 
 namespace nvcv::legacy::cuda_op {
@@ -102,6 +110,18 @@ struct DataShape
     int W;     // width
 };
 
+// Input channel read for each output channel, e.g. {2, 1, 0, 3} turns BGR into RGB. Operators taking it reorder
+// channels as they load or store pixels, instead of in a pass of their own.
+struct ChannelOrder
+{
+    int8_t channel[4] = {0, 1, 2, 3};
+
+    bool isIdentity() const
+    {
+        return channel[0] == 0 && channel[1] == 1 && channel[2] == 2 && channel[3] == 3;
+    }
+};
+
 inline size_t DataSize(DataType data_type)
 {
     size_t size = 0;
@@ -203,9 +223,116 @@ public:
         return (input_size <= max_input_size) && (output_size <= max_output_size);
     }
 
+    virtual ~CudaBaseOp();
+
+    CudaBaseOp(const CudaBaseOp &)            = delete;
+    CudaBaseOp &operator=(const CudaBaseOp &) = delete;
+
+    /**
+     * @brief size of the gpu workspace needed by infer, in bytes, 0 if none is needed.
+     */
+    size_t gpuWorkspaceSize() const
+    {
+        return m_gpuWorkspaceSize;
+    }
+
+    /**
+     * @brief sets the gpu buffer used as workspace by infer, instead of the ones allocated by the operator.
+     * The buffer must have at least gpuWorkspaceSize() bytes and can be shared with other operators,
+     * as long as they're executed in the same stream. Its contents aren't kept between infer calls.
+     * Without it, the operator allocates one workspace per stream, so that it can be used by concurrent streams.
+     * Only the workspaces of the most recently used streams are kept.
+     * @param workspace gpu pointer, or nullptr to make the operator allocate its own workspaces again.
+     */
+    void setGpuWorkspace(void *workspace);
+
+    /**
+     * @brief allocates the operator's own workspace for stream up front, with gpuWorkspaceSize() bytes.
+     * Otherwise it's allocated on its first use in stream, with the size needed by that call, and grown later
+     * if needed. Does nothing if a workspace was set by user.
+     * @param stream stream where the operator will be executed.
+     */
+    void reserveGpuWorkspace(cudaStream_t stream);
+
 protected:
     DataShape max_input_shape_;
     DataShape max_output_shape_;
+
+    // To be called by the operator constructor
+    void setGpuWorkspaceSize(size_t size);
+
+    // Workspace handed out by gpuWorkspace. The operator's own workspace isn't released while it's alive,
+    // not even when other streams need room, so it must be kept until the work using it is queued.
+    class GpuWorkspaceLease
+    {
+    public:
+        GpuWorkspaceLease() = default;
+        GpuWorkspaceLease(CudaBaseOp *op, cudaStream_t stream, void *data);
+        GpuWorkspaceLease(GpuWorkspaceLease &&that) noexcept;
+        GpuWorkspaceLease &operator=(GpuWorkspaceLease &&that) noexcept;
+        ~GpuWorkspaceLease();
+
+        void *get() const
+        {
+            return m_data;
+        }
+
+        template<class T>
+        T *as() const
+        {
+            return static_cast<T *>(m_data);
+        }
+
+    private:
+        CudaBaseOp  *m_op     = nullptr; // null for the workspace set by user
+        cudaStream_t m_stream = nullptr;
+        void        *m_data   = nullptr;
+    };
+
+    // Returns the workspace set by user, or else the operator's own for stream, allocated on its first use.
+    // Work on a stream only sees its own workspace, so they're safe to use without synchronization.
+    GpuWorkspaceLease gpuWorkspace(cudaStream_t stream);
+
+    // Same, but the operator's own workspace only needs to have size bytes, at most gpuWorkspaceSize().
+    // Operators whose needs depend on the input, e.g. on the batch size, use it to not allocate the worst case.
+    GpuWorkspaceLease gpuWorkspace(cudaStream_t stream, size_t size);
+
+    // Operators can keep data in their workspace across infer calls, e.g. filter kernels, identified by a key.
+    // It's never kept in a workspace set by user, as other operators might overwrite it.
+    bool gpuWorkspaceHolds(cudaStream_t stream, const LaunchPlanKey &contents);
+    void setGpuWorkspaceContents(cudaStream_t stream, const LaunchPlanKey &contents);
+
+private:
+    struct GpuWorkspace
+    {
+        void                        *data          = nullptr;
+        size_t                       capacity      = 0;
+        bool                         streamOrdered = false; // allocated with cudaMallocAsync
+        bool                         captured      = false; // used while its stream was being captured
+        int                          leases        = 0;     // GpuWorkspaceLease alive
+        uint64_t                     lastUse       = 0;
+        std::optional<LaunchPlanKey> contents;
+    };
+
+    // Streams whose workspace is kept, the least recently used one is released to make room for a new stream,
+    // so that applications creating short-lived streams don't accumulate workspaces. Captured or leased
+    // workspaces are never released that way, there might be more of them.
+    static constexpr size_t kMaxGpuWorkspaces = 8;
+
+    size_t m_gpuWorkspaceSize = 0;
+    void  *m_userGpuWorkspace = nullptr;
+
+    std::mutex                                     m_mtxGpuWorkspaces;
+    std::unordered_map<cudaStream_t, GpuWorkspace> m_gpuWorkspaces;
+    uint64_t                                       m_gpuWorkspaceUses = 0;
+
+    // Workspaces outgrown while captured or leased, the graph or the caller might still use them.
+    std::vector<void *> m_retiredGpuWorkspaces;
+
+    GpuWorkspace &doGetOwnGpuWorkspace(cudaStream_t stream, size_t size);
+    void          doReleaseGpuWorkspace(cudaStream_t stream, GpuWorkspace &ws);
+    void          doFreeOwnGpuWorkspaces() noexcept;
+    void          doReturnGpuWorkspace(cudaStream_t stream) noexcept;
 };
 
 class ConvertTo : public CudaBaseOp
@@ -284,11 +411,48 @@ public:
      * @param input_shape shape of the input images.
      * @param format format of the input images, e.g. kNHWC.
      * @param data_type data type of the input images, e.g. kCV_32F.
+     * @param order channels of the input read for each output channel.
      * @param stream for the asynchronous execution.
      *
      */
     ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, const double alpha,
-                    const double beta, cudaStream_t stream);
+                    const double beta, const ChannelOrder &order, cudaStream_t stream);
+
+    /**
+     * @brief Converts 8-bit unsigned images to float or half with a scale and shift per channel, writing either
+     * interleaved or planar outputs:
+     *
+     * ```
+     * outputs(x,y,c) = saturate_cast<out_type>(alpha[c] * inputs(x, y, c) + beta[c])
+     * ```
+     *
+     * Input layout is kNHWC or kHWC, output layout is kNHWC, kHWC, kNCHW or kCHW.
+     *
+     * @param alphaData scale of each channel, one packed 32-bit float per channel.
+     * @param betaData shift of each channel, one packed 32-bit float per channel.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    const ITensorDataStridedCuda &alphaData, const ITensorDataStridedCuda &betaData,
+                    cudaStream_t stream);
+
+    /**
+     * @brief Converts the input to several outputs, each with its own type, layout, scale and shift per channel
+     * and channel order, reading the input once per group of outputs:
+     *
+     * ```
+     * outputs[o](x,y,c) = saturate_cast<out_type[o]>(alpha[o][c] * inputs(x, y, order[o][c]) + beta[o][c])
+     * ```
+     *
+     * Input layout is kNHWC or kHWC, output layouts are kNHWC, kHWC, kNCHW or kCHW.
+     *
+     * @param outData numOutputs output tensors, with the number of samples, size and channels of the input.
+     * @param params scale and shift of the channels of each output, their channelOrder is ignored.
+     * @param order channels of the input read for the channels of each output.
+     */
+    ErrorCode inferMulti(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda *const *outData,
+                         const NVCVConvertToParams *params, const ChannelOrder *order, int numOutputs,
+                         cudaStream_t stream);
+
     /**
      * @brief calculate the cpu/gpu buffer size needed by this operator
      * @param max_input_shape maximum input DataShape that may be used
@@ -296,6 +460,19 @@ public:
      * @param max_data_type DataType with the maximum size that may be used
      */
     size_t    calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+
+private:
+    typedef void (*func_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                           int numChannels, const double alpha, const double beta, const ChannelOrder &order,
+                           cudaStream_t stream);
+
+    struct Plan
+    {
+        func_t func;
+        int    numChannels;
+    };
+
+    LaunchPlanCache<Plan> m_plans;
 };
 
 class CustomCrop : public CudaBaseOp
@@ -437,10 +614,11 @@ public:
      *      around the x-axis and positive value (for example, 1) means flipping
      *      around y-axis. Negative value (for example, -1) means flipping around
      *      both axes.
+     * @param inplace whether output is the same data as input, pixels are then swapped with their mirror.
      * @param stream for the asynchronous execution.
      */
     ErrorCode infer(const ITensorDataStridedCuda &input, const ITensorDataStridedCuda &output, const int32_t flipCode,
-                    cudaStream_t stream);
+                    bool inplace, cudaStream_t stream);
 
     /**
      * @brief calculate the cpu/gpu buffer size needed by this operator
@@ -449,6 +627,12 @@ public:
      * @param max_data_type DataType with the maximum size that may be used
      */
     size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+
+private:
+    typedef void (*flip_t)(const ITensorDataStridedCuda &input, const ITensorDataStridedCuda &output,
+                           const int32_t flipCode, bool inplace, cudaStream_t stream);
+
+    LaunchPlanCache<flip_t> m_plans;
 };
 
 class FlipOrCopyVarShape : public CudaBaseOp
@@ -515,6 +699,15 @@ public:
     ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &input, const IImageBatchVarShapeDataStridedCuda &output,
                     const ITensorDataStridedCuda &flipCode, cudaStream_t stream);
 
+    /**
+     * @brief Flips the images into the samples of a tensor, all images must have the size of the tensor samples.
+     * @param output NHWC tensor with one sample per input image, and the same data type and channels.
+     * @param flipCode int32 flip code of each image, as above.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &input, const ITensorDataStridedCuda &output,
+                    const ITensorDataStridedCuda &flipCode, cudaStream_t stream);
+
     /**
      * @brief calculate the gpu buffer size needed by this operator
      * @param maxBatchSize Maximum batch size that may be used
@@ -540,7 +733,7 @@ public:
      *
      *
      * Input:
-     *      Data Layout:    [kNHWC, kHWC, kNCHW, KCHW]
+     *      Data Layout:    [kNHWC, kHWC, kNCHW, KCHW, NCHWc]
      *      Channels:       [1, 3, 4]
      *
      *      Data Type      | Allowed
@@ -555,7 +748,7 @@ public:
      *      64bit Float    | Yes
      *
      * Output:
-     *      Data Layout:    [kNHWC, kHWC, kNCHW, KCHW]
+     *      Data Layout:    [kNHWC, kHWC, kNCHW, KCHW, NCHWc]
      *      Channels:       [1, 3, 4]
      *
      *      Data Type      | Allowed
@@ -588,9 +781,11 @@ public:
      * @param input_format input format. kNHWC -> kNCHW, kNCHW -> kNHWC.
      * @param output_format output format.
      * @param data_type data type of the input images, e.g. kCV_32F.
+     * @param order channels of the input read for each output channel.
      * @param stream for the asynchronous execution.
      */
-    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, cudaStream_t stream);
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    const ChannelOrder &order, cudaStream_t stream);
     /**
      * @brief calculate the cpu/gpu buffer size needed by this operator
      * @param max_input_shape maximum input DataShape that may be used
@@ -599,6 +794,17 @@ public:
      */
     size_t    calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
     void      checkDataFormat(DataFormat format);
+
+private:
+    typedef void (*transform_t)(const ITensorDataStridedCuda &input, const ITensorDataStridedCuda &output,
+                                const ChannelOrder &order, cudaStream_t stream);
+
+    void copy(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, cudaStream_t stream);
+    void copy(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, const ChannelOrder &order,
+              cudaStream_t stream);
+
+    // a null transform means plain copy, when input and output have the same layout
+    LaunchPlanCache<transform_t> m_plans;
 };
 
 class Resize : public CudaBaseOp
@@ -667,6 +873,61 @@ public:
      */
     ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
                     const NVCVInterpolationType interpolation, cudaStream_t stream);
+
+    /**
+     * @brief Same as above, but output channel c is interpolated from input channel order.channel[c].
+     * Unless the order is the identity, the generic single pixel kernels are used.
+     *
+     * @param [in] order Channels of the input read for each output channel.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    const NVCVInterpolationType interpolation, const ChannelOrder &order, cudaStream_t stream);
+
+    /**
+     * @brief Resizes the input images to several outputs, each with its own interpolation.
+     * Outputs are written together, up to 8 per kernel launch, with the math of the generic single pixel kernels
+     * of \ref infer.
+     *
+     * @param [in] inData Intput tensor.
+     * @param [out] outData Output tensors, with the same data type and number of samples as the input.
+     * @param [in] interpolation Interpolation method of each output. See \ref NVCVInterpolationType.
+     * @param [in] numOutputs Number of outputs.
+     * @param [in] stream Stream for the asynchronous execution.
+     */
+    ErrorCode inferMulti(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda *const *outData,
+                         const NVCVInterpolationType *interpolation, int numOutputs, cudaStream_t stream);
+
+    typedef void (*func_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                           const NVCVInterpolationType interpolation, cudaStream_t stream);
+
+    /**
+     * @brief Validates a resize configuration and selects the function launching its kernel.
+     * Tensors with the given shapes and data type can then be resized with func(inData, outData, interpolation,
+     * stream), skipping any validation.
+     *
+     * @param [in] inShape Shape of the input tensor.
+     * @param [in] dtype Data type of the input and output tensors.
+     * @param [in] outShape Shape of the output tensor.
+     * @param [in] interpolation Interpolation method. See \ref NVCVInterpolationType for more details.
+     * @param [out] func Function launching the resize kernel.
+     */
+    static ErrorCode plan(const TensorShape &inShape, nvcv::DataType dtype, const TensorShape &outShape,
+                          const NVCVInterpolationType interpolation, func_t &func);
+
+    /**
+     * @brief Estimates the cost of resizing tensors with the given shapes and data type on the current device.
+     * The time is the one measured when the configuration was autotuned on this GPU model, if it was, otherwise
+     * it's derived from the bytes moved and the memory bandwidth available within the launch budget.
+     *
+     * @param [in] inShape Shape of the input tensor.
+     * @param [in] dtype Data type of the input and output tensors.
+     * @param [in] outShape Shape of the output tensor.
+     * @param [in] interpolation Interpolation method. See \ref NVCVInterpolationType for more details.
+     * @param [out] bytesMoved Approximate bytes of device memory read and written by the kernel.
+     * @param [out] timeMs Approximate GPU time of the kernel in milliseconds.
+     */
+    static ErrorCode estimate(const TensorShape &inShape, nvcv::DataType dtype, const TensorShape &outShape,
+                              const NVCVInterpolationType interpolation, int64_t &bytesMoved, double &timeMs);
     /**
      * @brief calculate the cpu/gpu buffer size needed by this operator
      * @param max_input_shape maximum input DataShape that may be used
@@ -733,7 +994,8 @@ public:
      *
      * @param inData gpuData to a tensor of one or more HWC images
      * @param outData gpuData a tensor hosting the outputs of the operation
-     * @param morph_type Type of operation to perform on data Erode/Dilate
+     * @param morph_type Type of operation to perform on data Erode/Dilate, or Open/Close/Gradient/TopHat/BlackHat
+     *                   fused in a single pass
      * @param mask_size shape and size of the mask to use for the operation
      * @param anchor anchor to use for the kernel (-1,-1) will use center of kernel
      * @param iteraton number of times to perform the kernel pass
@@ -825,6 +1087,7 @@ public:
     Normalize(DataShape max_input_shape, DataShape max_output_shape)
         : CudaBaseOp(max_input_shape, max_output_shape)
     {
+        setGpuWorkspaceSize(calBufferSize(max_input_shape, max_output_shape, kCV_32F));
     }
 
     /**
@@ -898,6 +1161,8 @@ public:
      *
      * Scale and Base may be a tensor the same shape as the input/output tensors, or it can be a scalar each dimension.
      *
+     * With CVCUDA_NORMALIZE_COMPUTE_STATS, base and scale of shape [N or 1, 1, 1, C or 1] receive the mean and
+     * standard deviation of the input, which is then normalized with them as standard deviation.
      *
      * @param inputs gpu pointer,
      * @param global_scale additional scaling factor, used e.g. when output is of integral type.
@@ -905,12 +1170,13 @@ public:
      * @param epsilon regularizing term added to variance; only used if scale_is_stddev = true
      * @param flags if true, scale is interpreted as standard deviation and it's regularized and its
      * reciprocal is used when scaling.
+     * @param order channels of the input read for each output channel, base and scale are in output order.
      * @param stream for the asynchronous execution.
      */
     ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &baseData,
                     const ITensorDataStridedCuda &scaleData, const ITensorDataStridedCuda &outData,
                     const float global_scale, const float shift, const float epsilon, const uint32_t flags,
-                    cudaStream_t stream);
+                    const ChannelOrder &order, cudaStream_t stream);
     /**
      * @brief calculate the cpu/gpu buffer size needed by this operator
      * @param max_input_shape maximum input DataShape that may be used
@@ -985,6 +1251,20 @@ public:
                     const ITensorDataStridedCuda &top, const ITensorDataStridedCuda &left,
                     const NVCVBorderType borderMode, const float borderValue, cudaStream_t stream);
 
+    /**
+     * @brief Same as above, but padded values are also normalized as in ResizeNormalizeReformat, converted to the
+     * output type and written in the output layout, in a single pass.
+     * @param inData input images, uint8, uint16 or float32 with 1, 3 or 4 interleaved channels.
+     * @param outData output tensor, NHWC, HWC, NCHW or CHW, float32, float16, uint8 or int8, with the input channels.
+     * @param baseData, scaleData float32 normalization parameters of shape [1 or N, 1, 1, 1 or C].
+     * @param flags 0 or CVCUDA_NORMALIZE_SCALE_IS_STDDEV.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    const ITensorDataStridedCuda &top, const ITensorDataStridedCuda &left,
+                    const NVCVBorderType borderMode, const float borderValue, const ITensorDataStridedCuda &baseData,
+                    const ITensorDataStridedCuda &scaleData, const float global_scale, const float shift,
+                    const float epsilon, const uint32_t flags, cudaStream_t stream);
+
     size_t calBufferSize(int batch_size);
 };
 
@@ -992,9 +1272,13 @@ class Rotate : public CudaBaseOp
 {
 public:
     Rotate() = delete;
-    Rotate(DataShape max_input_shape, DataShape max_output_shape);
 
-    ~Rotate();
+    /**
+     * @param precision precision of the per-pixel coordinate math, either NVCV_COORD_PRECISION_FLOAT or
+     * NVCV_COORD_PRECISION_DOUBLE.
+     */
+    Rotate(DataShape max_input_shape, DataShape max_output_shape,
+           NVCVCoordinatePrecision precision = NVCV_COORD_PRECISION_DOUBLE);
 
     /**
      * @brief Rotates input images around the origin (0,0) and then shifts it.
@@ -1022,8 +1306,8 @@ public:
      */
     size_t    calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
 
-protected:
-    double *d_aCoeffs;
+private:
+    const NVCVCoordinatePrecision m_precision;
 };
 
 class MedianBlur : public CudaBaseOp
@@ -1116,12 +1400,14 @@ public:
      * @param format format of the input images, e.g. kNHWC.
      * @param data_type data type of the input images, e.g. kCV_32F.
      * @param out_data_type data type of the output images, e.g. kCV_32F.
+     * @param order channels of the input read for each output channel, base and scale are in output order.
      * @param stream for the asynchronous execution.
      */
     ErrorCode infer(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
                     const nvcv::ITensorDataStridedCuda &baseData, const nvcv::ITensorDataStridedCuda &scaleData,
                     const nvcv::IImageBatchVarShapeDataStridedCuda &outData, const float global_scale,
-                    const float shift, const float epsilon, const uint32_t flags, cudaStream_t stream);
+                    const float shift, const float epsilon, const uint32_t flags, const ChannelOrder &order,
+                    cudaStream_t stream);
 };
 
 class ResizeVarShape : public CudaBaseOp
@@ -1160,10 +1446,40 @@ public:
      * @param format format of the input images, e.g. kNHWC.
      * @param data_type data type of the input images, e.g. kCV_32F.
      * @param stream for the asynchronous execution.
+     * @param flatTiles distribute the blocks over the tiles of the output images instead of a grid sized for the
+     * largest one, for batches whose images cover a small part of that grid. See FlatTiles.cuh.
      *
      */
     ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
-                    const NVCVInterpolationType interpolation, cudaStream_t stream);
+                    const NVCVInterpolationType interpolation, cudaStream_t stream, bool flatTiles = false);
+
+    /**
+     * @brief Resizes the input images to several output batches, each with its own interpolation.
+     * Outputs are written together, up to 8 per kernel launch, with the math of the single pixel kernels.
+     *
+     * @param inData Input images.
+     * @param outData Output images, one batch per output with as many images as the input.
+     * @param interpolation Interpolation method of each output, see \ref NVCVInterpolationType.
+     * @param numOutputs Number of outputs.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode inferMulti(const IImageBatchVarShapeDataStridedCuda &inData,
+                         const IImageBatchVarShapeDataStridedCuda *const *outData,
+                         const NVCVInterpolationType *interpolation, int numOutputs, cudaStream_t stream);
+
+    /**
+     * @brief Resizes each image of the batch with its own interpolation, in a single launch.
+     *
+     * @param inData Input images.
+     * @param outData Output images, as many as the input.
+     * @param interpData Interpolation method of each image, one packed int32 per image in device memory.
+     *        Values other than nearest, linear and cubic resize with area.
+     * @param antialias resize images downscaled along both axes with area, whatever their interpolation.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode inferPerSample(const IImageBatchVarShapeDataStridedCuda &inData,
+                             const IImageBatchVarShapeDataStridedCuda &outData,
+                             const ITensorDataStridedCuda &interpData, bool antialias, cudaStream_t stream);
 };
 
 class CopyMakeBorder : public CudaBaseOp
@@ -1281,11 +1597,24 @@ public:
                     const nvcv::ITensorDataStridedCuda &top, const nvcv::ITensorDataStridedCuda &left,
                     const NVCVBorderType border_type, const float4 value, cudaStream_t stream);
 
+    /**
+     * @brief Forms a border around each image of the batch and stacks them in the output tensor, in one launch.
+     * Same as the stacking infer above, except that the constant border of each sample takes its own value,
+     * e.g. to letterbox a batch straight into the network input.
+     * @param borderValues float32 tensor with one 1x1 pixel per sample, with as many channels as the images.
+     * It is only used with the NVCV_BORDER_CONSTANT border type.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    const nvcv::ITensorDataStridedCuda &top, const nvcv::ITensorDataStridedCuda &left,
+                    const NVCVBorderType border_type, const nvcv::ITensorDataStridedCuda &borderValues,
+                    cudaStream_t stream);
+
 private:
     template<class OutType>
     ErrorCode inferWarp(const IImageBatchVarShapeDataStridedCuda &inData, const OutType &outData,
                         const nvcv::ITensorDataStridedCuda &top, const nvcv::ITensorDataStridedCuda &left,
-                        const NVCVBorderType border_type, const float4 value, cudaStream_t stream);
+                        const NVCVBorderType border_type, const float4 value,
+                        const nvcv::ITensorDataStridedCuda *borderValues, cudaStream_t stream);
 };
 
 class CenterCrop : public CudaBaseOp
@@ -1325,9 +1654,11 @@ class RotateVarShape : public CudaBaseOp
 public:
     RotateVarShape() = delete;
 
-    RotateVarShape(const int maxVarShapeBatchSize);
-
-    ~RotateVarShape();
+    /**
+     * @param precision precision of the per-pixel coordinate math, either NVCV_COORD_PRECISION_FLOAT or
+     * NVCV_COORD_PRECISION_DOUBLE.
+     */
+    RotateVarShape(const int maxVarShapeBatchSize, NVCVCoordinatePrecision precision = NVCV_COORD_PRECISION_DOUBLE);
 
     /**
      * @brief Rotates input images around the origin (0,0) and then shifts it.
@@ -1352,9 +1683,26 @@ public:
                     const ITensorDataStridedCuda &angleDeg, const ITensorDataStridedCuda &shift,
                     const NVCVInterpolationType interpolation, cudaStream_t stream);
 
+    /**
+     * @brief Same, with the angles and {x, y} shifts of the at most CVCUDA_MAX_HOST_PARAM_SAMPLES images given on the
+     * host. Their coefficients are passed to the kernel by value, no workspace is used.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
+                    const double *angleDeg, const double2 *shift, const NVCVInterpolationType interpolation,
+                    cudaStream_t stream);
+
 protected:
-    double   *d_aCoeffs;
-    const int m_maxBatchSize;
+    const int                     m_maxBatchSize;
+    const NVCVCoordinatePrecision m_precision;
+
+private:
+    ErrorCode validate(const IImageBatchVarShapeDataStridedCuda &inData,
+                       const IImageBatchVarShapeDataStridedCuda &outData,
+                       const NVCVInterpolationType               interpolation) const;
+
+    void launch(const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
+                const void *aCoeffs, bool hostCoeffs, const NVCVInterpolationType interpolation,
+                cudaStream_t stream) const;
 };
 
 class Laplacian : public CudaBaseOp
@@ -1431,6 +1779,84 @@ public:
     size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
 };
 
+class Sobel : public CudaBaseOp
+{
+public:
+    Sobel() = delete;
+
+    Sobel(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * Limitations:
+     *
+     * Input:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1, 3, 4]
+     *
+     *      Data Type      | Allowed
+     *      -------------- | -------------
+     *      8bit  Unsigned | Yes
+     *      8bit  Signed   | No
+     *      16bit Unsigned | Yes
+     *      16bit Signed   | Yes
+     *      32bit Unsigned | No
+     *      32bit Signed   | No
+     *      32bit Float    | Yes
+     *      64bit Float    | No
+     *
+     * Output:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1, 3, 4]
+     *
+     *      Data Type      | Allowed
+     *      -------------- | -------------
+     *      8bit  Unsigned | No
+     *      8bit  Signed   | No
+     *      16bit Unsigned | No
+     *      16bit Signed   | Yes
+     *      32bit Unsigned | No
+     *      32bit Signed   | No
+     *      32bit Float    | Yes
+     *      64bit Float    | No
+     *
+     * Input/Output dependency
+     *
+     *      Property      |  Input == Output
+     *     -------------- | -------------
+     *      Data Layout   | Yes
+     *      Data Type     | No, all outputs have the same data type
+     *      Number        | Yes
+     *      Channels      | Yes
+     *      Width         | Yes
+     *      Height        | Yes
+     *
+     * @brief Calculates the first x and y derivatives of an image with the Sobel or Scharr filters, and their
+     *        magnitude, in a single pass.
+     * @param inData Input Tensor
+     * @param dxData Output Tensor with the x derivative, or NULL
+     * @param dyData Output Tensor with the y derivative, or NULL
+     * @param magData Output Tensor with the L2 norm of the gradient, or NULL
+     * @param ksize aperture size of the Sobel filters, it can be 1, 3, 5, 7, or -1 for the 3x3 Scharr filters.
+     * @param scale scale factor for the computed derivatives.
+     * @param borderMode pixel extrapolation method, e.g. \p NVCV_BORDER_CONSTANT
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda *dxData,
+                    const ITensorDataStridedCuda *dyData, const ITensorDataStridedCuda *magData, int ksize,
+                    float scale, NVCVBorderType borderMode, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
 class Gaussian : public CudaBaseOp
 {
 public:
@@ -1438,8 +1864,6 @@ public:
 
     Gaussian(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize);
 
-    ~Gaussian();
-
     /**
      * Limitations:
      *
@@ -1508,10 +1932,7 @@ public:
                          Size2D maxKernelSize);
 
 private:
-    Size2D  m_maxKernelSize = {0, 0};
-    Size2D  m_curKernelSize = {0, 0};
-    double2 m_curSigma      = {-1.0, -1.0};
-    float  *m_kernel        = nullptr;
+    Size2D m_maxKernelSize = {0, 0};
 };
 
 class Erase : public CudaBaseOp
@@ -1521,8 +1942,6 @@ public:
 
     Erase(DataShape max_input_shape, DataShape max_output_shape, int num_erasing_area);
 
-    ~Erase();
-
     /**
      * @brief erase areas of images. Different images in the same batch can be erased differently.
      * @param inData gpu pointer, inputs[0] are batched input images, whose shape is input_shape and type is data_type.
@@ -1546,10 +1965,7 @@ public:
                     unsigned int seed, bool inplace, cudaStream_t stream);
 
 protected:
-    int3  *d_max_values;
-    void  *temp_storage;
-    size_t storage_bytes;
-    int    max_num_erasing_area;
+    int max_num_erasing_area;
 };
 
 class AverageBlur : public CudaBaseOp
@@ -1559,8 +1975,6 @@ public:
 
     AverageBlur(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize);
 
-    ~AverageBlur();
-
     /**
      * Limitations:
      *
@@ -1627,8 +2041,6 @@ public:
 
 private:
     Size2D m_maxKernelSize = {0, 0};
-    Size2D m_curKernelSize = {0, 0};
-    float *m_kernel        = nullptr;
 };
 
 class Conv2DVarShape : public CudaBaseOp
@@ -1636,11 +2048,17 @@ class Conv2DVarShape : public CudaBaseOp
 public:
     Conv2DVarShape() = delete;
 
-    Conv2DVarShape(DataShape max_input_shape, DataShape max_output_shape)
+    Conv2DVarShape(DataShape max_input_shape, DataShape max_output_shape,
+                   NVCVConv2DAlgorithm algorithm = NVCV_CONV2D_ALGO_AUTO)
         : CudaBaseOp(max_input_shape, max_output_shape)
+        , m_algorithm(algorithm)
     {
+        setGpuWorkspaceSize(algorithm == NVCV_CONV2D_ALGO_DIRECT ? 0 : FFTCorrelator::kWorkspaceSize);
     }
 
+    /// Kernels with at least this many taps use the FFT path with NVCV_CONV2D_ALGO_AUTO.
+    static constexpr int kFFTMinKernelArea = 32 * 32;
+
     /**
      * Limitations:
      *
@@ -1701,10 +2119,27 @@ public:
      * (-1,-1) means that the anchor is at the kernel center.
      * @param borderMode pixel extrapolation method, e.g. NVCV_BORDER_CONSTANT
      * @param stream for the asynchronous execution.
+     * @param flatTiles distribute the blocks over the tiles of the output images instead of a grid sized for the
+     * largest one, for batches whose images cover a small part of that grid. Large kernels always use the tiled
+     * convolution. See FlatTiles.cuh.
+     *
+     * Kernels of kFFTMinKernelArea taps or more are correlated by overlap-save FFTs with NVCV_CONV2D_ALGO_AUTO, see
+     * FFTCorrelation.hpp, whose results differ from the direct path by the float rounding of the transforms.
      */
     ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
                     const IImageBatchVarShapeDataStridedCuda &kernelData,
-                    const ITensorDataStridedCuda &kernelAnchorData, NVCVBorderType borderMode, cudaStream_t stream);
+                    const ITensorDataStridedCuda &kernelAnchorData, NVCVBorderType borderMode, cudaStream_t stream,
+                    bool flatTiles = false);
+
+private:
+    NVCVConv2DAlgorithm m_algorithm;
+    FFTCorrelator       m_fft;
+
+    ErrorCode inferFFT(const IImageBatchVarShapeDataStridedCuda &inData,
+                       const IImageBatchVarShapeDataStridedCuda &outData,
+                       const IImageBatchVarShapeDataStridedCuda &kernelData,
+                       const ITensorDataStridedCuda &kernelAnchorData, NVCVBorderType borderMode, DataType dataType,
+                       int channels, cudaStream_t stream);
 };
 
 class LaplacianVarShape : public CudaBaseOp
@@ -1783,8 +2218,6 @@ public:
 
     GammaContrastVarShape(const int32_t maxVarShapeBatchSize, const int32_t maxVarShapeChannelCount);
 
-    ~GammaContrastVarShape();
-
     /**
      * @brief Adjust image contrast by scaling pixel values to 255*((v/255)**gamma)
      * @param inputs gpu pointer, inputs[i] is input image where i ranges from 0 to batch-1, whose shape is
@@ -1808,9 +2241,8 @@ public:
                     const ITensorDataStridedCuda &gammas, cudaStream_t stream);
 
 private:
-    int    m_maxBatchSize    = 0;
-    int    m_maxChannelCount = 0;
-    float *m_gammaArray      = nullptr;
+    int m_maxBatchSize    = 0;
+    int m_maxChannelCount = 0;
 };
 
 class EraseVarShape : public CudaBaseOp
@@ -1820,8 +2252,6 @@ public:
 
     EraseVarShape(DataShape max_input_shape, DataShape max_output_shape, int num_erasing_area);
 
-    ~EraseVarShape();
-
     /**
     * @brief erase areas of images. Different images in the same batch can be erased differently.
     * @param inbatch gpu pointer, inputs[0] are batched input images, whose shape is input_shape and type is data_type.
@@ -1842,10 +2272,7 @@ public:
                     unsigned int seed, bool inplace, cudaStream_t stream);
 
 protected:
-    int3  *d_max_values;
-    void  *temp_storage;
-    size_t storage_bytes;
-    int    max_num_erasing_area;
+    int max_num_erasing_area;
 };
 
 class GaussianVarShape : public CudaBaseOp
@@ -1855,8 +2282,6 @@ public:
 
     GaussianVarShape(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize, int maxBatchSize);
 
-    ~GaussianVarShape();
-
     /**
      * Limitations:
      *
@@ -1924,7 +2349,6 @@ public:
 private:
     Size2D m_maxKernelSize = {0, 0};
     int    m_maxBatchSize  = 0;
-    float *m_kernel        = nullptr;
 };
 
 class AverageBlurVarShape : public CudaBaseOp
@@ -1934,8 +2358,6 @@ public:
 
     AverageBlurVarShape(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize, int maxBatchSize);
 
-    ~AverageBlurVarShape();
-
     /**
      * Limitations:
      *
@@ -2005,7 +2427,6 @@ public:
 private:
     Size2D m_maxKernelSize = {0, 0};
     int    m_maxBatchSize  = 0;
-    float *m_kernel        = nullptr;
 };
 
 class MedianBlurVarShape : public CudaBaseOp
@@ -2014,7 +2435,6 @@ public:
     MedianBlurVarShape() = delete;
     MedianBlurVarShape(const int maxVarShapeBatchSize);
 
-    ~MedianBlurVarShape();
     /**
      * @brief Blur an image using a median kernel.
      * @param inputs gpu pointer, inputs[i] is input image where i ranges from 0 to batch-1, whose shape is
@@ -2035,8 +2455,7 @@ public:
                     const ITensorDataStridedCuda &ksize, cudaStream_t stream);
 
 protected:
-    const int        m_maxBatchSize;
-    std::vector<int> m_kernelSizes;
+    const int m_maxBatchSize;
 };
 
 class BilateralFilter : public CudaBaseOp
@@ -2142,49 +2561,133 @@ public:
                     NVCVBorderType borderMode, cudaStream_t stream);
 };
 
-class CvtColor : public CudaBaseOp
+class GuidedFilter : public CudaBaseOp
 {
 public:
-    CvtColor() = delete;
+    GuidedFilter() = delete;
 
-    CvtColor(DataShape max_input_shape, DataShape max_output_shape)
-        : CudaBaseOp(max_input_shape, max_output_shape)
-    {
-    }
+    GuidedFilter(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size, Size2D max_size);
 
     /**
-     * @brief Converts an image from one color space to another.
-     * @param inData Input tensor.
-     * @param outData Output tensor.
-     * @param code Color space conversion code, \ref NVCVColorConversionCode.
+     * Limitations:
+     *
+     * Input, Guide:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1, 3]
+     *      Data Type:      8bit Unsigned, 16bit Unsigned, 32bit Float, integer values being normalized to [0, 1]
+     *
+     * Output:
+     *      Same shape and data type as the input.
+     *
+     * @brief Edge-preserving smoothing of the input following the guide, with box means whose cost doesn't depend
+     *        on the radius.
+     * @param inData Input Tensor
+     * @param guideData Guide Tensor, with the same number of samples, rows and columns as the input
+     * @param outData Output Tensor
+     * @param radius radius of the windows, at least 1.
+     * @param eps regularization of the fitted coefficients, in squared normalized guide units.
+     * @param subsample factor the coefficients are subsampled by, 1 to compute them at full resolution.
      * @param stream for the asynchronous execution.
      */
-    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
-                    NVCVColorConversionCode code, cudaStream_t stream);
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &guideData,
+                    const ITensorDataStridedCuda &outData, int radius, float eps, int subsample, cudaStream_t stream);
 
     /**
      * @brief calculate the cpu/gpu buffer size needed by this operator
-     * @param max_input_shape maximum input DataShape that may be used
-     * @param max_output_shape maximum output DataShape that may be used
-     * @param max_data_type DataType with the maximum size that may be used
+     * @param max_batch_size maximum number of samples that may be used
+     * @param max_size maximum input size that may be used
      */
-    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+    static size_t calBufferSize(int max_batch_size, Size2D max_size);
+
+private:
+    int    m_maxBatchSize;
+    Size2D m_maxSize;
 };
 
-class WarpAffine : public CudaBaseOp
+class GuidedFilterVarShape : public CudaBaseOp
 {
 public:
-    WarpAffine() = delete;
+    GuidedFilterVarShape() = delete;
 
-    WarpAffine(DataShape max_input_shape, DataShape max_output_shape)
-        : CudaBaseOp(max_input_shape, max_output_shape)
-    {
-    }
+    GuidedFilterVarShape(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size,
+                         Size2D max_size);
 
-    /*
-     * @brief Applies an affine transformation to an image. Same function as nvcv::warpAffine.
-     * @param inData input tensor.
-     * @param outData output tensor.
+    /**
+     * @brief Same as GuidedFilter, on batches of images of the same format whose guide and output images have the
+     *        size of the input images.
+     * @param inData VarShape representing batch of input images
+     * @param guideData VarShape representing batch of guide images
+     * @param outData VarShape representing batch of output images
+     * @param radius radius of the windows, at least 1.
+     * @param eps regularization of the fitted coefficients, in squared normalized guide units.
+     * @param subsample factor the coefficients are subsampled by, 1 to compute them at full resolution.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                    const IImageBatchVarShapeDataStridedCuda &guideData,
+                    const IImageBatchVarShapeDataStridedCuda &outData, int radius, float eps, int subsample,
+                    cudaStream_t stream);
+
+private:
+    int    m_maxBatchSize;
+    Size2D m_maxSize;
+};
+
+class CvtColor : public CudaBaseOp
+{
+public:
+    CvtColor() = delete;
+
+    CvtColor(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Converts an image from one color space to another.
+     * @param inData Input tensor.
+     * @param outData Output tensor.
+     * @param code Color space conversion code, \ref NVCVColorConversionCode.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    NVCVColorConversionCode code, cudaStream_t stream);
+
+    /**
+     * @brief Converts an image from one color space to another, given the input color spec.
+     * @param inData Input tensor.
+     * @param outData Output tensor.
+     * @param code Color space conversion code, \ref NVCVColorConversionCode.
+     * @param inSpec Color spec of the input, used by the 16-bit YUV (P010/P016) conversions to select
+     *               the YCbCr encoding, range and whether PQ/HLG content is tone mapped to SDR.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    NVCVColorConversionCode code, NVCVColorSpec inSpec, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class WarpAffine : public CudaBaseOp
+{
+public:
+    WarpAffine() = delete;
+
+    WarpAffine(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /*
+     * @brief Applies an affine transformation to an image. Same function as nvcv::warpAffine.
+     * @param inData input tensor.
+     * @param outData output tensor.
      * @param xform cpu pointer, 2x3 transformation matrix.
      * @param flags Combination of interpolation methods(NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR or NVCV_INTERP_CUBIC)
                      and the optional flag NVCV_WARP_INVERSE_MAP, that sets trans_matrix as the inverse transformation.
@@ -2245,8 +2748,6 @@ public:
 
     WarpPerspectiveVarShape(const int32_t maxBatchSize);
 
-    ~WarpPerspectiveVarShape();
-
     /**
      * @brief Applies a perspective transformation to an image. Same function as nvcv::warpPerspective.
      * @param inputs gpu pointer, inputs[i] is input image where i ranges from 0 to batch-1, whose shape is
@@ -2274,9 +2775,24 @@ public:
                     const ITensorDataStridedCuda &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
                     const float4 borderValue, cudaStream_t stream);
 
+    /**
+     * @brief Rectifies quadrilaterals of the input images into the output images, one per quadrilateral.
+     * @param inData input images, all with the same format.
+     * @param quadData float32 source corners [x0, y0, ..., x3, y3] with shape [N, 8], mapped to the output corners
+     * (0, 0), (w, 0), (w, h) and (0, h), or [N, 9] with the source image index first. Without index,
+     * quadrilateral i reads image i, or image 0 if the input has a single image.
+     * @param outData N output images of any size, with the input format.
+     * @param interpolation INTER_NEAREST, INTER_LINEAR or INTER_CUBIC.
+     * @param borderMode pixel extrapolation method.
+     * @param borderValue used in case of a constant border.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode inferCrop(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &quadData,
+                        const IImageBatchVarShapeDataStridedCuda &outData, const int32_t interpolation,
+                        const NVCVBorderType borderMode, const float4 borderValue, cudaStream_t stream);
+
 protected:
     const int m_maxBatchSize;
-    float    *m_transformationMatrix = nullptr;
 };
 
 class WarpAffineVarShape : public CudaBaseOp
@@ -2285,8 +2801,6 @@ public:
     WarpAffineVarShape() = delete;
 
     WarpAffineVarShape(const int32_t maxBatchSize);
-
-    ~WarpAffineVarShape();
     /**
      * @brief Applies an affine transformation to an image. Same function as nvcv::warpAffine.
      * @param inputs gpu pointer, inputs[i] is input image where i ranges from 0 to batch-1, whose shape is
@@ -2313,9 +2827,20 @@ public:
                     const ITensorDataStridedCuda &transMatrix, const int32_t flags, const NVCVBorderType borderMode,
                     const float4 borderValue, cudaStream_t stream);
 
+    /**
+     * @brief Same, with the 2x3 row-major matrices of the at most CVCUDA_MAX_HOST_PARAM_SAMPLES images given on the
+     * host, as 6 consecutive floats each. They're passed to the kernel by value.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
+                    const float *transMatrix, const int32_t flags, const NVCVBorderType borderMode,
+                    const float4 borderValue, cudaStream_t stream);
+
 protected:
     const int m_maxBatchSize;
-    float    *m_transformationMatrix = nullptr;
+
+private:
+    ErrorCode validate(const IImageBatchVarShapeDataStridedCuda &inData,
+                       const IImageBatchVarShapeDataStridedCuda &outData) const;
 };
 
 class CvtColorVarShape : public CudaBaseOp
@@ -2338,6 +2863,17 @@ public:
     ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
                     NVCVColorConversionCode code, cudaStream_t stream);
 
+    /**
+     * @brief Converts each image, whatever its format, to the common format of the output batch in one launch.
+     * Input images can be Y8, BGR8, RGB8, BGRA8, RGBA8 or NV12, output images must be Y8, BGR8, RGB8, BGRA8
+     * or RGBA8.
+     * @param inData Input batch, images can have different formats.
+     * @param outData Output batch, images must all have the same format and the size of their input image.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
+                    cudaStream_t stream);
+
     /**
      * @brief calculate the cpu/gpu buffer size needed by this operator
      * @param batch_size maximum input batch size
@@ -2370,6 +2906,34 @@ public:
      */
     ErrorCode infer(const ITensorDataStridedCuda &foreground, const ITensorDataStridedCuda &background,
                     const ITensorDataStridedCuda &fgMask, const ITensorDataStridedCuda &outData, cudaStream_t stream);
+
+    /*
+     * @brief Same as above, with flags selecting how the foreground is blended.
+     *
+     * @param flags 0 or CVCUDA_COMPOSITE_PREMULTIPLIED when the foreground was already multiplied by its mask.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &foreground, const ITensorDataStridedCuda &background,
+                    const ITensorDataStridedCuda &fgMask, const ITensorDataStridedCuda &outData, int flags,
+                    cudaStream_t stream);
+
+    /*
+     * @brief Composites a foreground, usually smaller, into the background in place.
+     *
+     * @param foreground gpu tensor for the 3-channel foreground image
+     *
+     * @param fgMask gpu tensor for the 1-channel foreground mask, of the foreground size
+     *
+     * @param inOut gpu tensor for the 3 or 4-channel background, overwritten with the result. A 4th channel is
+     * left unchanged.
+     *
+     * @param offset position of the top-left foreground pixel in the background, parts outside of it are skipped.
+     *
+     * @param flags 0 or CVCUDA_COMPOSITE_PREMULTIPLIED.
+     *
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode inferROI(const ITensorDataStridedCuda &foreground, const ITensorDataStridedCuda &fgMask,
+                       const ITensorDataStridedCuda &inOut, int2 offset, int flags, cudaStream_t stream);
 };
 
 class ChannelReorderVarShape : public CudaBaseOp
@@ -2469,7 +3033,10 @@ public:
     size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
 
 private:
-    void *gpu_workspace;
+    // Filter coefficients of the last few (input size, output size, filter) configurations, kept on the device
+    // across calls as they don't depend on the image contents.
+    class CoeffCache;
+    std::unique_ptr<CoeffCache> m_coeffCache;
 };
 
 class PillowResizeVarShape : public CudaBaseOp
@@ -2479,17 +3046,14 @@ public:
 
     PillowResizeVarShape(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
 
-    ~PillowResizeVarShape();
-
     /**
      * @brief Resizes the input images. The function resize resizes the image down to or up to the specified size.
      * @param inputs gpu pointer, inputs[0] are batched input images, whose shape is input_shape and type is data_type.
      * @param outputs gpu pointer, outputs[0] are batched output images that have the same type as data_type. The output
      * sizes are derived from the dsize,fx, and fy.
      * @param gpu_workspace gpu pointer, gpu memory used to store the temporary variables.
-     * @param cpu_workspace cpu pointer, cpu memory used to store the temporary variables.
      * @param batch batch_size.
-     * @param buffer_size buffer size of gpu_workspace and cpu_workspace
+     * @param buffer_size buffer size of gpu_workspace
      * @param dsize size of the output images.if it equals zero, it is computed as:
      * @param interpolation interpolation method. See cv::InterpolationFlags for more detials.
      * @param input_shape shape of the input images.
@@ -2508,10 +3072,1565 @@ public:
      * @param max_data_type DataType with the maximum size that may be used
      */
     size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class ResizeNormalizeReformat : public CudaBaseOp
+{
+public:
+    ResizeNormalizeReformat() = delete;
+
+    ResizeNormalizeReformat(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Resizes uint8 interleaved images, normalizes them and writes them as float planes, in one pass.
+     * Equivalent to Resize, ConvertTo, Normalize and Reformat to NCHW, but resized values aren't rounded
+     * back to uint8 before being normalized.
+     * @param inData input images, NHWC or HWC uint8 with 1, 3 or 4 channels.
+     * @param baseData normalization base, float32 with shape [1 or N, 1, 1, 1 or C].
+     * @param scaleData normalization scale, float32 with shape [1 or N, 1, 1, 1 or C].
+     * @param outData output images, float32 NCHW, with the same number of samples and channels as input.
+     * @param interpolation interpolation method, NVCV_INTERP_NEAREST or NVCV_INTERP_LINEAR.
+     * @param global_scale additional scaling factor.
+     * @param shift additional bias value.
+     * @param epsilon regularizing term added to variance; only used if scale is standard deviation.
+     * @param flags CVCUDA_NORMALIZE_SCALE_IS_STDDEV and/or CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &baseData,
+                    const ITensorDataStridedCuda &scaleData, const ITensorDataStridedCuda &outData,
+                    const NVCVInterpolationType interpolation, const float global_scale, const float shift,
+                    const float epsilon, const uint32_t flags, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class ResizeNormalizeReformatVarShape : public CudaBaseOp
+{
+public:
+    ResizeNormalizeReformatVarShape() = delete;
+
+    ResizeNormalizeReformatVarShape(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Same as ResizeNormalizeReformat::infer, but each input image can have its own size. All images
+     * are resized to the output size.
+     * @param inData input image batch, uint8 interleaved with 1, 3 or 4 channels, all with the same format.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &baseData,
+                    const ITensorDataStridedCuda &scaleData, const ITensorDataStridedCuda &outData,
+                    const NVCVInterpolationType interpolation, const float global_scale, const float shift,
+                    const float epsilon, const uint32_t flags, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class ResizeNormalizeReformatNV12 : public CudaBaseOp
+{
+public:
+    ResizeNormalizeReformatNV12() = delete;
+
+    ResizeNormalizeReformatNV12(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Same as ResizeNormalizeReformat::infer, but input frames are YUV 4:2:0 semi-planar, as output by
+     * NVDEC, and are converted to RGB or BGR before being cropped and resized.
+     * @param lumaData luma plane, NHWC or HWC with 1 channel, uint8 (NV12) or uint16 (P016), even width and height.
+     * @param chromaData interleaved chroma plane, same type as luma, with shape [N, H/2, W/2, 2] or [N, H/2, W, 1].
+     * @param roi region of the frame to be resized, the whole frame if its width and height are 0.
+     * @param code NVCV_COLOR_YUV2RGB_NV12, NVCV_COLOR_YUV2BGR_NV12, NVCV_COLOR_YUV2RGB_NV21 or
+     * NVCV_COLOR_YUV2BGR_NV21.
+     * @param outData output images, float32 NCHW with 3 channels and the same number of samples as input.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &lumaData, const ITensorDataStridedCuda &chromaData,
+                    const NVCVRectI roi, const ITensorDataStridedCuda &baseData,
+                    const ITensorDataStridedCuda &scaleData, const ITensorDataStridedCuda &outData,
+                    const NVCVColorConversionCode code, const NVCVInterpolationType interpolation,
+                    const float global_scale, const float shift, const float epsilon, const uint32_t flags,
+                    cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class CropResize : public CudaBaseOp
+{
+public:
+    CropResize() = delete;
+
+    CropResize(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Crops boxes out of the input and resizes each of them to the output size, in one launch.
+     * Equivalent to CustomCrop followed by Resize for every box, when downscaling integer boxes.
+     * @param inData input images, NHWC or HWC with 1, 3 or 4 channels.
+     * @param boxData boxes, float32 with shape [N, 4] holding [x1, y1, x2, y2] in source pixels, or [N, 5] with
+     *                the source sample index first. Without index, box i reads sample i, or sample 0 if the input
+     *                has a single sample.
+     * @param outData output images, NHWC with N samples and the same data type and channels as input.
+     * @param interpolation interpolation method, NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR or NVCV_INTERP_AREA,
+     *                      which averages the pixels under each output pixel when downscaling.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &boxData,
+                    const ITensorDataStridedCuda &outData, const NVCVInterpolationType interpolation,
+                    cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class CropResizeVarShape : public CudaBaseOp
+{
+public:
+    CropResizeVarShape()
+        : CudaBaseOp()
+    {
+    }
+
+    /**
+     * @brief Crops boxes out of the images of the batch and resizes each of them to the output size, optionally
+     * flipping them, in one launch. See CropResize::infer.
+     * @param inData input images, all with the same format.
+     * @param boxData boxes, as in CropResize::infer, with coordinates in pixels of their image.
+     * @param flipData optional int32 flip code of each box with shape [N] or [N, 1], as in FlipOrCopyVarShape.
+     * @param outData output images, NHWC with N samples and the same data type and channels as input.
+     * @param interpolation interpolation method, NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR or NVCV_INTERP_AREA.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &boxData,
+                    const ITensorDataStridedCuda *flipData, const ITensorDataStridedCuda &outData,
+                    const NVCVInterpolationType interpolation, cudaStream_t stream);
+};
+
+class Remap : public CudaBaseOp
+{
+public:
+    Remap() = delete;
+
+    Remap(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Moves every output pixel from the source location given by a dense map.
+     * @param inData input images, NHWC or HWC with 1, 3 or 4 channels.
+     * @param outData output images, same layout, data type and channels as input.
+     * @param mapData map with the output width and height, and one sample or one sample per output sample. Either
+     *                float32 with 2 channels [x, y], or int16 with 3 channels [x, y, frac] where frac holds the
+     *                fractional parts in 1/32 of pixel, y in bits 5-9 and x in bits 0-4.
+     * @param interpolation interpolation method, NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR or NVCV_INTERP_CUBIC.
+     * @param mapValueType whether map values are absolute source coordinates or offsets to the output coordinates.
+     * @param borderMode pixel extrapolation method.
+     * @param borderValue used in case of a constant border.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    const ITensorDataStridedCuda &mapData, const NVCVInterpolationType interpolation,
+                    const NVCVRemapMapValueType mapValueType, const NVCVBorderType borderMode,
+                    const float4 borderValue, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class RemapVarShape : public CudaBaseOp
+{
+public:
+    RemapVarShape()
+        : CudaBaseOp()
+    {
+    }
+
+    /**
+     * @brief Moves every output pixel from the source location given by a dense map, see Remap::infer.
+     * @param inData input images, with 1, 3 or 4 channels.
+     * @param outData output images, same number of images and format as input.
+     * @param mapData map at least as large as the largest output image, with one sample or one sample per image.
+     *                Each image reads the map at its own pixel coordinates.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
+                    const ITensorDataStridedCuda &mapData, const NVCVInterpolationType interpolation,
+                    const NVCVRemapMapValueType mapValueType, const NVCVBorderType borderMode,
+                    const float4 borderValue, cudaStream_t stream);
+};
+
+class Reduce : public CudaBaseOp
+{
+public:
+    Reduce() = delete;
+
+    Reduce(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+        setGpuWorkspaceSize(calBufferSize(max_input_shape, max_output_shape, kCV_32F));
+    }
+
+    /**
+     * @brief Reduces each sample to its sum, mean, minimum or maximum, per channel or over all channels.
+     * @param inData input images, NHWC, HWC, NCHW or CHW.
+     * @param outData float output, NHWC or HWC with one sample per input sample, width and height 1, and either
+     *                the input number of channels or 1 to reduce all channels together.
+     * @param op reduce operation.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    const NVCVReduceOp op, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class ReduceVarShape : public CudaBaseOp
+{
+public:
+    ReduceVarShape()
+        : CudaBaseOp()
+    {
+        setGpuWorkspaceSize(calBufferSize());
+    }
+
+    /**
+     * @brief Reduces each image of the batch, see Reduce::infer.
+     * @param inData input images, all with the same format.
+     * @param outData float output, NHWC with one sample per image, width and height 1, and either the number of
+     *                channels of the images or 1.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    const NVCVReduceOp op, cudaStream_t stream);
+
+    size_t calBufferSize();
+};
+
+class Histogram : public CudaBaseOp
+{
+public:
+    Histogram() = delete;
+
+    Histogram(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Computes the 256-bin histogram of each sample, per channel or over all channels.
+     * @param inData 8-bit unsigned input images, NHWC, HWC, NCHW or CHW.
+     * @param outData int32 output, NHWC or HWC with one sample per input sample, height 1, width 256 (one bin per
+     *                value), and either the input number of channels or 1 to count all channels together.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class HistogramVarShape : public CudaBaseOp
+{
+public:
+    HistogramVarShape()
+        : CudaBaseOp()
+    {
+    }
+
+    /**
+     * @brief Computes the histogram of each image of the batch, see Histogram::infer.
+     * @param inData 8-bit unsigned input images, all with the same format.
+     * @param outData int32 output, NHWC with one sample per image, height 1, width 256, and either the number of
+     *                channels of the images or 1.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    cudaStream_t stream);
+};
+
+class MinMaxLoc : public CudaBaseOp
+{
+public:
+    MinMaxLoc() = delete;
+
+    MinMaxLoc(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+        setGpuWorkspaceSize(calBufferSize(max_input_shape, max_output_shape, kCV_32F));
+    }
+
+    /**
+     * @brief Finds the minimum and maximum values of each sample and their first locations in row-major order.
+     * @param inData single channel input images, NHWC, HWC, NCHW, CHW or NHW.
+     * @param minValData float output with one value per input sample, e.g. NHWC with width, height and channels 1.
+     * @param minLocData int32 output with the two coordinates [x, y] of the minimum of each sample, e.g. NHWC with
+     *                   width and height 1 and 2 channels.
+     * @param maxValData float output of the maximum values, same shape as minValData.
+     * @param maxLocData int32 output of the maximum locations, same shape as minLocData.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &minValData,
+                    const ITensorDataStridedCuda &minLocData, const ITensorDataStridedCuda &maxValData,
+                    const ITensorDataStridedCuda &maxLocData, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class MinMaxLocVarShape : public CudaBaseOp
+{
+public:
+    MinMaxLocVarShape()
+        : CudaBaseOp()
+    {
+        setGpuWorkspaceSize(calBufferSize());
+    }
+
+    /**
+     * @brief Finds the minimum and maximum values of each image of the batch, see MinMaxLoc::infer.
+     * @param inData single channel input images, all with the same format.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &minValData,
+                    const ITensorDataStridedCuda &minLocData, const ITensorDataStridedCuda &maxValData,
+                    const ITensorDataStridedCuda &maxLocData, cudaStream_t stream);
+
+    size_t calBufferSize();
+};
+
+class Letterbox : public CudaBaseOp
+{
+public:
+    Letterbox() = delete;
+
+    Letterbox(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Resizes each sample to the largest size that fits the output while keeping its aspect ratio, centers it
+     * in the output and fills the rest with a constant value. Scale and offsets are computed on the device.
+     * @param inData input images, NHWC or HWC with 1, 3 or 4 channels.
+     * @param outData output images, NHWC or HWC with the input data type, number of samples and channels.
+     * @param transformData optional float32 output with one 1x1 pixel of 4 channels per sample, receiving the
+     *                      scale_x, scale_y, offset_x and offset_y that map source to output coordinates, or NULL.
+     * @param interpolation NVCV_INTERP_NEAREST or NVCV_INTERP_LINEAR.
+     * @param fillValue value of the output pixels outside the resized image.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    const ITensorDataStridedCuda *transformData, NVCVInterpolationType interpolation,
+                    const float4 fillValue, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class LetterboxVarShape : public CudaBaseOp
+{
+public:
+    LetterboxVarShape()
+        : CudaBaseOp()
+    {
+    }
+
+    /**
+     * @brief Letterboxes each image of the batch into its sample of the output tensor, see Letterbox::infer.
+     * @param inData input images, all with the same format.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    const ITensorDataStridedCuda *transformData, NVCVInterpolationType interpolation,
+                    const float4 fillValue, cudaStream_t stream);
+};
+
+class BuildPyramid : public CudaBaseOp
+{
+public:
+    BuildPyramid() = delete;
+
+    BuildPyramid(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Builds a Gaussian or Laplacian pyramid of each sample, with two Gaussian levels per launch.
+     * @param inData input images, NHWC or HWC, 1, 3 or 4 channels of uint8, uint16, int16 or float32.
+     * @param outData output levels, numLevels images per sample stored sample by sample, with the input data type
+     *                and number of channels. Level 0 has the input size, and level l is ((w + 1) / 2, (h + 1) / 2)
+     *                of level l - 1.
+     * @param numLevels number of levels of each pyramid, level 0 included.
+     * @param type NVCV_PYRAMID_GAUSSIAN or NVCV_PYRAMID_LAPLACIAN, the latter for float32 data only.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
+                    int numLevels, NVCVPyramidType type, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class BuildPyramidVarShape : public CudaBaseOp
+{
+public:
+    BuildPyramidVarShape()
+        : CudaBaseOp()
+    {
+    }
+
+    /**
+     * @brief Builds the pyramid of each image of the batch, see BuildPyramid::infer.
+     * @param inData input images, all with the same format.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
+                    int numLevels, NVCVPyramidType type, cudaStream_t stream);
+};
+
+class ArgMax : public CudaBaseOp
+{
+public:
+    ArgMax() = delete;
+
+    ArgMax(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Writes the index of the channel with the largest score of each pixel, upsampling the scores to the
+     *        output size when it's larger, in the same kernel.
+     * @param inData class scores, NCHW or CHW float32, one plane per class.
+     * @param outData labels, NHWC or HWC with one channel of uint8 (up to 256 classes) or int32.
+     * @param interpolation NVCV_INTERP_NEAREST or NVCV_INTERP_LINEAR, how the scores are resampled to the output
+     *                      size before their argmax.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    NVCVInterpolationType interpolation, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class MaskOverlay : public CudaBaseOp
+{
+public:
+    MaskOverlay() = delete;
+
+    MaskOverlay(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Blends the palette color of the label of each pixel over the frame, weighted by the color alpha.
+     * @param inData frames, NHWC or HWC with 3 or 4 channels of uint8. The 4th channel is copied unchanged.
+     * @param labelData labels with the frame size, NHWC or HWC with one channel of uint8 or int32.
+     * @param paletteData one color per label, HWC or NHWC with 1 row and sample, and 4 channels of uint8: the color
+     *                    in the frame channel order, and its alpha. Labels past the palette are left unchanged.
+     * @param outData output frames, with the shape and data type of the input. It may be the input.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &labelData,
+                    const ITensorDataStridedCuda &paletteData, const ITensorDataStridedCuda &outData,
+                    cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class TopK : public CudaBaseOp
+{
+public:
+    TopK() = delete;
+
+    TopK(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Writes the k largest scores of each sample and their indices, in decreasing order.
+     * @param inData scores, NHWC or HWC float32 with one row and one channel, one column per class.
+     * @param scoreData k largest scores of each sample, NHWC or HWC float32 with one row of k columns.
+     * @param indexData indices of the k largest scores, NHWC or HWC int32 with the shape of scoreData.
+     * @param softmax whether the softmax of the scores is written instead of the scores.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &scoreData,
+                    const ITensorDataStridedCuda &indexData, bool softmax, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class BoxDecode : public CudaBaseOp
+{
+public:
+    BoxDecode() = delete;
+
+    BoxDecode(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Applies the regression deltas of a detector to its anchors, giving the boxes they predict.
+     * @param anchorData anchor boxes [x1, y1, x2, y2], NHWC or HWC float32 with one row of 4-channel boxes, either
+     *                   shared by all samples or one set per sample.
+     * @param deltaData deltas [dx, dy, dw, dh] of each anchor, NHWC or HWC float32 with one row per sample.
+     * @param boxData boxes [x1, y1, x2, y2], same shape as deltaData.
+     * @param varianceXY scale of the center deltas dx, dy.
+     * @param varianceWH scale of the size deltas dw, dh.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &anchorData, const ITensorDataStridedCuda &deltaData,
+                    const ITensorDataStridedCuda &boxData, float varianceXY, float varianceWH, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class NMS : public CudaBaseOp
+{
+public:
+    NMS() = delete;
+
+    NMS(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size, int max_num_boxes);
+
+    /**
+     * @brief Greedy non-maximum suppression of each sample's boxes, hard or Gaussian soft-NMS.
+     * @param boxData boxes [x1, y1, x2, y2], NHWC or HWC float32 with one row of 4-channel boxes per sample.
+     * @param scoreData score of each box, NHWC or HWC float32 with one row and one channel per sample.
+     * @param classData optional class of each box, int32 with the shape of scoreData. Boxes only suppress boxes
+     *                  of their class when it's given, all boxes otherwise.
+     * @param outIndexData indices of the kept boxes in decreasing score order, NHWC or HWC int32 with one row of
+     *                     max_output columns and one channel per sample, padded with -1.
+     * @param outScoreData scores of the kept boxes, float32 with the shape of outIndexData, padded with 0. With
+     *                     soft-NMS, these are the decayed scores.
+     * @param outCountData number of kept boxes of each sample, int32 with one element per sample.
+     * @param score_threshold boxes with a lower score are discarded, before and after their decay.
+     * @param iou_threshold with hard NMS, boxes overlapping a kept box more than this are suppressed.
+     * @param soft_sigma when positive, scores are decayed by exp(-iou^2 / soft_sigma) instead.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &boxData, const ITensorDataStridedCuda &scoreData,
+                    const ITensorDataStridedCuda *classData, const ITensorDataStridedCuda &outIndexData,
+                    const ITensorDataStridedCuda &outScoreData, const ITensorDataStridedCuda &outCountData,
+                    float score_threshold, float iou_threshold, float soft_sigma, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_batch_size maximum number of samples that may be used
+     * @param max_num_boxes maximum number of boxes per sample that may be used
+     */
+    static size_t calBufferSize(int max_batch_size, int max_num_boxes);
+
+private:
+    int m_maxBatchSize;
+    int m_maxNumBoxes;
+};
+
+class AbsDiff : public CudaBaseOp
+{
+public:
+    AbsDiff() = delete;
+
+    AbsDiff(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Writes |in1 - in2| of every value, saturated to the data type.
+     * @param in1Data first input, NHWC or HWC.
+     * @param in2Data second input, with the shape and data type of in1Data.
+     * @param outData output, with the shape and data type of in1Data.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &in1Data, const ITensorDataStridedCuda &in2Data,
+                    const ITensorDataStridedCuda &outData, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class TemporalFilter : public CudaBaseOp
+{
+public:
+    TemporalFilter() = delete;
+
+    TemporalFilter(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Filters the consecutive frames of a stream in order, updating the running average kept in the state.
+     * @param inData consecutive frames, NHWC or HWC.
+     * @param stateData running average of each pixel, float32 with one sample of the frame shape.
+     * @param outData state after each frame, with the shape and data type of inData, or NULL.
+     * @param maskData motion mask of each frame, uint8 with one channel, or NULL.
+     * @param type running average, or recursive filter restarted on moving pixels.
+     * @param alpha weight of each new frame in the running average.
+     * @param threshold difference with the state above which a pixel is moving.
+     * @param reset whether the state is set to the first frame first.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &stateData,
+                    const ITensorDataStridedCuda *outData, const ITensorDataStridedCuda *maskData,
+                    NVCVTemporalFilterType type, float alpha, float threshold, bool reset, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class RandomParams : public CudaBaseOp
+{
+public:
+    RandomParams() = delete;
+
+    RandomParams(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Draws the flip code of each sample, each flip being drawn independently.
+     * @param flipCodeData flip code of each sample, int32 with shape [N].
+     * @param probHoriz probability of a horizontal flip.
+     * @param probVert probability of a vertical flip.
+     * @param seed key of the random number generator.
+     * @param draw index of the draw, giving the first block of the stream of each sample.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode inferFlip(const ITensorDataStridedCuda &flipCodeData, float probHoriz, float probVert, uint64_t seed,
+                        uint32_t draw, cudaStream_t stream);
+
+    /**
+     * @brief Draws uniformly distributed values, one row of the output per sample.
+     * @param outData random values, float32 or float64 with shape [N] or [N, K].
+     * @param low lower bound of the values.
+     * @param high upper bound of the values.
+     * @param seed key of the random number generator.
+     * @param draw index of the draw, giving the first block of the stream of each sample.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode inferUniform(const ITensorDataStridedCuda &outData, double low, double high, uint64_t seed,
+                           uint32_t draw, cudaStream_t stream);
+
+    /**
+     * @brief Draws the rotation of each image about its center.
+     * @param inData images to be rotated, only their sizes are read.
+     * @param angleData angle of each image in degrees, float64 with shape [N].
+     * @param shiftData shift of each image, float64 with shape [N, 2].
+     * @param minAngleDeg smallest angle.
+     * @param maxAngleDeg largest angle.
+     * @param seed key of the random number generator.
+     * @param draw index of the draw, giving the first block of the stream of each sample.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode inferRotate(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &angleData,
+                          const ITensorDataStridedCuda &shiftData, double minAngleDeg, double maxAngleDeg,
+                          uint64_t seed, uint32_t draw, cudaStream_t stream);
+
+    /**
+     * @brief Draws the erasing area of each image.
+     * @param inData images to be erased, only their sizes are read.
+     * @param anchorData top left corner of each area, int2 with shape [N].
+     * @param erasingData width, height and channel mask of each area, int3 with shape [N].
+     * @param imgIdxData image of each area, int32 with shape [N].
+     * @param probability probability of erasing each image.
+     * @param minArea smallest fraction of the image area.
+     * @param maxArea largest fraction of the image area.
+     * @param minAspect smallest aspect ratio.
+     * @param maxAspect largest aspect ratio.
+     * @param seed key of the random number generator.
+     * @param draw index of the draw, giving the first block of the stream of each sample.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode inferErase(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &anchorData,
+                         const ITensorDataStridedCuda &erasingData, const ITensorDataStridedCuda &imgIdxData,
+                         float probability, float minArea, float maxArea, float minAspect, float maxAspect,
+                         uint64_t seed, uint32_t draw, cudaStream_t stream);
+
+    /**
+     * @brief Draws crop boxes inside an input of the given size.
+     * @param boxData boxes as [x1, y1, x2, y2], float32 with shape [N, 4].
+     * @param size width and height of the input.
+     * @param minScale smallest fraction of the input area.
+     * @param maxScale largest fraction of the input area.
+     * @param minAspect smallest aspect ratio.
+     * @param maxAspect largest aspect ratio.
+     * @param seed key of the random number generator.
+     * @param draw index of the draw, giving the first block of the stream of each sample.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode inferCrop(const ITensorDataStridedCuda &boxData, int2 size, float minScale, float maxScale,
+                        float minAspect, float maxAspect, uint64_t seed, uint32_t draw, cudaStream_t stream);
+
+    /**
+     * @brief Draws one crop box inside each image of the batch, see inferCrop.
+     * @param inData images to be cropped, only their sizes are used.
+     * @param boxData boxes as [x1, y1, x2, y2], float32 with shape [N, 4], N being the number of images.
+     */
+    ErrorCode inferCrop(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &boxData,
+                        float minScale, float maxScale, float minAspect, float maxAspect, uint64_t seed,
+                        uint32_t draw, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class LUT : public CudaBaseOp
+{
+public:
+    LUT() = delete;
+
+    LUT(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * @brief Replaces every value by its entry in the lookup table of its sample and channel.
+     * @param inData input images, NHWC or HWC, uint8 or uint16.
+     * @param outData output images, with the shape of inData and the data type of lutData.
+     * @param lutData tables of 256 or 65536 entries, with shape [C, E] or [N, C, E], where N is 1 or the number of
+     * samples and C is 1 or the number of channels.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    const ITensorDataStridedCuda &lutData, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class Canny : public CudaBaseOp
+{
+public:
+    Canny() = delete;
+
+    Canny(DataShape max_input_shape, DataShape max_output_shape);
+
+    /**
+     * Limitations:
+     *
+     * Input:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1]
+     *      Data Type:      8bit Unsigned
+     *
+     * Output:
+     *      Same shape and data type as the input.
+     *
+     * @brief Finds the edges of an image with the Canny algorithm, 255 on edges and 0 elsewhere.
+     * @param inData Input Tensor
+     * @param outData Output Tensor
+     * @param thresholdLow gradient magnitude below which a pixel is not an edge.
+     * @param thresholdHigh gradient magnitude above which a pixel is an edge, pixels in between are edges when
+     *                      connected to one.
+     * @param apertureSize aperture size of the Sobel filters, it can be 3, 5 or 7.
+     * @param l2Gradient whether the gradient magnitude is its L2 norm, or the faster L1 norm.
+     * @param stream for the execution, synchronized once per pass of the hysteresis.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, float thresholdLow,
+                    float thresholdHigh, int apertureSize, bool l2Gradient, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class Integral : public CudaBaseOp
+{
+public:
+    Integral() = delete;
+
+    Integral(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size, Size2D max_size);
+
+    /**
+     * Limitations:
+     *
+     * Input:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1]
+     *
+     *      Data Type      | Allowed
+     *      -------------- | -------------
+     *      8bit  Unsigned | Yes
+     *      8bit  Signed   | No
+     *      16bit Unsigned | Yes
+     *      16bit Signed   | Yes
+     *      32bit Unsigned | No
+     *      32bit Signed   | No
+     *      32bit Float    | Yes
+     *      64bit Float    | No
+     *
+     * Output:
+     *      Data Layout:    [kNHWC, kHWC], one more row and column than the input
+     *      Channels:       [1]
+     *      Data Type:      32bit Signed for integer inputs, 32bit Float or 64bit Float for the sum, 32bit Float or
+     *                      64bit Float for the squared sum.
+     *
+     * @brief Calculates the integral images of the sum and squared sum of the pixels, where the element (y, x) is
+     *        the sum of the input pixels above and left of it, row y and column x excluded.
+     * @param inData Input Tensor
+     * @param sumData Output Tensor with the integral image of the sum
+     * @param sqsumData Output Tensor with the integral image of the squared sum, or NULL
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &sumData,
+                    const ITensorDataStridedCuda *sqsumData, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_batch_size maximum number of samples that may be used
+     * @param max_size maximum input size that may be used
+     */
+    static size_t calBufferSize(int max_batch_size, Size2D max_size);
+
+private:
+    int    m_maxBatchSize;
+    Size2D m_maxSize;
+};
+
+class AdaptiveThreshold : public CudaBaseOp
+{
+public:
+    AdaptiveThreshold() = delete;
+
+    AdaptiveThreshold(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size, Size2D max_size);
+
+    /**
+     * Limitations:
+     *
+     * Input:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1]
+     *      Data Type:      8bit Unsigned
+     *
+     * Output:
+     *      Same shape and data type as the input.
+     *
+     * @brief Thresholds each pixel with the mean of the block_size x block_size window around it minus c.
+     * The means are computed from an integral image, so their cost doesn't depend on block_size.
+     * @param inData Input Tensor
+     * @param outData Output Tensor
+     * @param max_value value of the pixels passing the threshold.
+     * @param type whether pixels above the threshold are set to max_value or 0.
+     * @param block_size size of the window of the local mean, odd and greater than 1.
+     * @param c constant subtracted from the local mean.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, double max_value,
+                    NVCVThresholdType type, int block_size, double c, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_batch_size maximum number of samples that may be used
+     * @param max_size maximum input size that may be used
+     */
+    static size_t calBufferSize(int max_batch_size, Size2D max_size);
+
+private:
+    int    m_maxBatchSize;
+    Size2D m_maxSize;
+};
+
+class Label : public CudaBaseOp
+{
+public:
+    Label() = delete;
+
+    Label(DataShape max_input_shape, DataShape max_output_shape);
+
+    /**
+     * Limitations:
+     *
+     * Input:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1]
+     *      Data Type:      8bit Unsigned, 16bit Unsigned or 32bit Signed
+     *
+     * Output:
+     *      Labels:         same shape as the input, 32bit Signed
+     *      Count:          [kNHWC, kHWC] with one row, column and channel per sample, 32bit Signed
+     *      Stats:          [kNHWC, kHWC] with one row per sample, one column per component and 6 channels,
+     *                      32bit Signed
+     *
+     * @brief Labels the connected components of the non-zero pixels of each image, 1 plus the smallest linear
+     *        index of its pixels for each component and 0 for the background.
+     * @param inData Input Tensor
+     * @param outData Output Tensor with the labels
+     * @param countData Output Tensor with the number of components of each sample, or nullptr.
+     * @param statsData Output Tensor with the label, left, top, width, height and area of the components of
+     *                  each sample, in no particular order, up to its number of columns, or nullptr. It needs
+     *                  the count tensor.
+     * @param connectivity 4 or 8, whether diagonal neighbors are connected.
+     * @param stream for the execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    const ITensorDataStridedCuda *countData, const ITensorDataStridedCuda *statsData,
+                    int connectivity, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+class Demosaic : public CudaBaseOp
+{
+public:
+    Demosaic() = delete;
+
+    Demosaic(DataShape max_input_shape, DataShape max_output_shape)
+        : CudaBaseOp(max_input_shape, max_output_shape)
+    {
+    }
+
+    /**
+     * Limitations:
+     *
+     * Input:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1]
+     *      Data Type:      8bit Unsigned or 16bit Unsigned, normalized by their maximum
+     *
+     * Output:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [3, 4], RGB or RGBA with an opaque alpha
+     *      Data Type:      8bit Unsigned, 16bit Unsigned or 32bit Float in [0,1]
+     *
+     * @brief Interpolates the missing colors of Bayer images and applies the white balance, color correction
+     *        and gamma of \p params to the result, in a single pass.
+     * @param inData Input Tensor, images of at least 3x3 pixels.
+     * @param outData Output Tensor, with the number of images and size of the input.
+     * @param pattern One of the RGGB Bayer patterns, giving the colors of the top-left 2x2 pixels.
+     * @param type Interpolation method, \ref NVCVDemosaicType.
+     * @param params Color processing of the interpolated RGB.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    NVCVRawPattern pattern, NVCVDemosaicType type, const NVCVDemosaicParams &params,
+                    cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_input_shape maximum input DataShape that may be used
+     * @param max_output_shape maximum output DataShape that may be used
+     * @param max_data_type DataType with the maximum size that may be used
+     */
+    size_t calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type);
+};
+
+
+class HistogramEq : public CudaBaseOp
+{
+public:
+    HistogramEq() = delete;
+
+    explicit HistogramEq(int maxBatchSize)
+        : CudaBaseOp()
+        , m_maxBatchSize(maxBatchSize)
+    {
+        setGpuWorkspaceSize(calBufferSize(maxBatchSize));
+    }
+
+    /**
+     * Limitations:
+     *
+     * Input:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1]
+     *      Data Type:      8bit Unsigned
+     *
+     * Output:
+     *      Same shape, layout and data type as the input, it can be the input itself.
+     *
+     * @brief Equalizes the histogram of each image, mapping its pixels through the normalized cumulative histogram
+     *        like cv::equalizeHist.
+     * @param inData Input Tensor, with at most maxBatchSize images.
+     * @param outData Output Tensor.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    cudaStream_t stream);
+
+    // Bytes of the per image histograms
+    size_t calBufferSize(int maxBatchSize);
+
+private:
+    int m_maxBatchSize;
+};
+
+class HistogramEqVarShape : public CudaBaseOp
+{
+public:
+    HistogramEqVarShape() = delete;
+
+    explicit HistogramEqVarShape(int maxBatchSize)
+        : CudaBaseOp()
+        , m_maxBatchSize(maxBatchSize)
+    {
+        setGpuWorkspaceSize(calBufferSize(maxBatchSize));
+    }
+
+    /**
+     * @brief Equalizes the histogram of each image of the batch, see HistogramEq::infer.
+     * @param inData single channel 8-bit unsigned input images.
+     * @param outData output images, with the format and size of the input ones.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
+                    cudaStream_t stream);
+
+    size_t calBufferSize(int maxBatchSize);
+
+private:
+    int m_maxBatchSize;
+};
+
+class CLAHE : public CudaBaseOp
+{
+public:
+    CLAHE() = delete;
+
+    CLAHE(int maxBatchSize, int maxTilesX, int maxTilesY)
+        : CudaBaseOp()
+        , m_maxBatchSize(maxBatchSize)
+        , m_maxTilesX(maxTilesX)
+        , m_maxTilesY(maxTilesY)
+    {
+        setGpuWorkspaceSize(calBufferSize(maxBatchSize, maxTilesX, maxTilesY));
+    }
+
+    /**
+     * Limitations:
+     *
+     * Input:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1]
+     *      Data Type:      8bit Unsigned
+     *
+     * Output:
+     *      Same shape, layout and data type as the input, it can be the input itself.
+     *
+     * @brief Contrast limited adaptive histogram equalization, like cv::CLAHE.  Images are split in a grid of
+     *        tiles, each one gets a mapping from its clipped histogram, and pixels are mapped by the bilinear
+     *        interpolation of the mappings of the four nearest tiles.
+     * @param inData Input Tensor, with at most maxBatchSize images, at least as wide and high as the tile grid.
+     * @param outData Output Tensor.
+     * @param clipLimit Histogram bins are clipped to clipLimit times the average bin count of a tile and their
+     *                  excess is redistributed among all bins, no clipping happens when it isn't positive.
+     * @param tilesX Number of tile columns, at most maxTilesX.
+     * @param tilesY Number of tile rows, at most maxTilesY.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, float clipLimit,
+                    int tilesX, int tilesY, cudaStream_t stream);
+
+    // Bytes of the per tile mappings
+    size_t calBufferSize(int maxBatchSize, int maxTilesX, int maxTilesY);
+
+private:
+    int m_maxBatchSize, m_maxTilesX, m_maxTilesY;
+};
+
+class CLAHEVarShape : public CudaBaseOp
+{
+public:
+    CLAHEVarShape() = delete;
+
+    CLAHEVarShape(int maxBatchSize, int maxTilesX, int maxTilesY)
+        : CudaBaseOp()
+        , m_maxBatchSize(maxBatchSize)
+        , m_maxTilesX(maxTilesX)
+        , m_maxTilesY(maxTilesY)
+    {
+        setGpuWorkspaceSize(calBufferSize(maxBatchSize, maxTilesX, maxTilesY));
+    }
+
+    /**
+     * @brief Contrast limited adaptive histogram equalization of each image of the batch, see CLAHE::infer.
+     *        All images have the same tile grid, with tiles sized after each image.
+     * @param inData single channel 8-bit unsigned input images, at least as wide and high as the tile grid.
+     * @param outData output images, with the format and size of the input ones.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
+                    float clipLimit, int tilesX, int tilesY, cudaStream_t stream);
+
+    size_t calBufferSize(int maxBatchSize, int maxTilesX, int maxTilesY);
+
+private:
+    int m_maxBatchSize, m_maxTilesX, m_maxTilesY;
+};
+
+class ImageHash : public CudaBaseOp
+{
+public:
+    ImageHash()
+        : CudaBaseOp()
+    {
+    }
+
+    /**
+     * Limitations:
+     *
+     * Input:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1, 3, 4]
+     *      Data Type:      any for the exact hash, 8bit Unsigned for the perceptual ones
+     *
+     * Output:
+     *      uint64 with one element per input sample, e.g. NHWC with width, height and channels 1.
+     *
+     * @brief Computes a 64-bit exact or perceptual hash of each sample, all samples in a single launch.
+     * @param inData Input Tensor, at least as large as the thumbnail of perceptual hashes.
+     * @param outData Output Tensor with the hashes.
+     * @param type Hash to compute, \ref NVCVImageHashType.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    NVCVImageHashType type, cudaStream_t stream);
+};
+
+class ImageHashVarShape : public CudaBaseOp
+{
+public:
+    ImageHashVarShape()
+        : CudaBaseOp()
+    {
+    }
+
+    /**
+     * @brief Computes the hash of each image of the batch, see ImageHash::infer.
+     * @param inData input images, all with the same format.
+     * @param outData uint64 output with one element per image.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    NVCVImageHashType type, cudaStream_t stream);
+};
+
+class BlurRegions : public CudaBaseOp
+{
+public:
+    BlurRegions() = delete;
+
+    BlurRegions(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size, Size2D max_size);
+
+    /**
+     * Limitations:
+     *
+     * Input/Output:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1, 3, 4]
+     *      Data Type:      8bit Unsigned, 16bit Unsigned, 16bit Signed, 32bit Signed, 32bit Float
+     *
+     * @brief Blurs or pixelates the pixels inside the boxes of each sample, in place. Only the pixels of the boxes
+     *        and the rows around them are processed.
+     * @param inOutData images, modified in place.
+     * @param boxData boxes [x1, y1, x2, y2], NHWC or HWC float32 with one row of 4-channel boxes per sample. The
+     *                pixels of a box are those of the integer region covering it, clipped to the image.
+     * @param countData optional number of boxes of each sample, int32 with one element per sample. All the boxes of
+     *                  the row are used when it's not given.
+     * @param type Gaussian blur or pixelation.
+     * @param kernel_size odd Gaussian kernel size, at most 255, or the pixelation cell size.
+     * @param sigma Gaussian standard deviation, computed from the kernel size when not positive.
+     * @param border_mode border used by the Gaussian blur to read pixels outside of the image.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inOutData, const ITensorDataStridedCuda &boxData,
+                    const ITensorDataStridedCuda *countData, NVCVBlurRegionType type, int kernel_size, double sigma,
+                    NVCVBorderType border_mode, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_batch_size maximum number of samples that may be used
+     * @param max_size maximum image size that may be used
+     */
+    static size_t calBufferSize(int max_batch_size, Size2D max_size);
+
+private:
+    int    m_maxBatchSize;
+    Size2D m_maxSize;
+};
+
+class Mosaic : public CudaBaseOp
+{
+public:
+    Mosaic()
+        : CudaBaseOp()
+    {
+    }
+
+    /**
+     * Limitations:
+     *
+     * Input/Output:
+     *      Data Layout:    [kNHWC, kHWC] input, [kNHWC] output
+     *      Channels:       [1, 3, 4]
+     *      Data Type:      8bit Unsigned, 16bit Unsigned, 16bit Signed, 32bit Float
+     *
+     * @brief Resizes each image of the batch into its destination rectangle of one of the output canvases, all in
+     *        one launch. The other pixels of the canvases are left unchanged.
+     * @param inData input images, all with the same format.
+     * @param rectData float32 [N, 5] destination of each image: canvas index, x1, y1, x2, y2, in canvas pixels with
+     *                 x2 and y2 exclusive. Rectangles are clipped to their canvas.
+     * @param outData output canvases, NHWC with the same data type and channels as input.
+     * @param interpolation interpolation method, NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR or NVCV_INTERP_AREA.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &rectData,
+                    const ITensorDataStridedCuda &outData, const NVCVInterpolationType interpolation,
+                    cudaStream_t stream);
+};
+
+class OSD : public CudaBaseOp
+{
+public:
+    OSD() = delete;
+
+    OSD(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size, int max_num_elements);
+
+    /**
+     * Limitations:
+     *
+     * Input/Output:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1, 3, 4]
+     *      Data Type:      8bit Unsigned
+     *
+     * @brief Draws the elements of each sample over its image in place, in the order of the elements, each one
+     *        alpha blended like Composite does. Only the pixels covered by elements are read and written.
+     * @param inOutData images, modified in place.
+     * @param elementData elements, NHWC or HWC float32 with one row of 12-channel elements per sample: the
+     *                    NVCVOSDElementType, the RGBA color and the parameters of the primitive.
+     * @param countData optional number of elements of each sample, int32 with one element per sample. All the
+     *                  elements of the row are drawn when it's not given.
+     * @param pointData optional polygon vertices, NHWC or HWC float32 with one row of 2-channel points per sample.
+     * @param glyphData optional glyph atlas, NHWC uint8 with one single-channel coverage image per glyph.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inOutData, const ITensorDataStridedCuda &elementData,
+                    const ITensorDataStridedCuda *countData, const ITensorDataStridedCuda *pointData,
+                    const ITensorDataStridedCuda *glyphData, cudaStream_t stream);
+
+    /**
+     * @brief calculate the cpu/gpu buffer size needed by this operator
+     * @param max_batch_size maximum number of samples that may be used
+     * @param max_num_elements maximum number of elements per sample that may be used
+     */
+    static size_t calBufferSize(int max_batch_size, int max_num_elements);
+
+private:
+    int m_maxBatchSize;
+    int m_maxNumElements;
+};
+
+class PSNR : public CudaBaseOp
+{
+public:
+    PSNR()
+        : CudaBaseOp()
+    {
+        setGpuWorkspaceSize(calBufferSize());
+    }
+
+    /**
+     * Limitations:
+     *
+     * Input:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1, 3, 4]
+     *      Data Type:      8bit Unsigned, 16bit Unsigned, 16bit Signed, 32bit Float
+     *
+     * @brief Computes the peak signal-to-noise ratio between the samples of 2 tensors, 10 * log10(maxValue^2 / MSE),
+     *        infinite for equal samples.
+     * @param inData1 compared images.
+     * @param inData2 reference images, with the shape and type of inData1.
+     * @param outData float output, NHWC or HWC with one sample per input sample, width and height 1, and either the
+     *                input number of channels for per-channel scores or 1 for the score of all channels together.
+     * @param maxValue peak value of the images, or 0 to use the range of the data type.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData1, const ITensorDataStridedCuda &inData2,
+                    const ITensorDataStridedCuda &outData, float maxValue, cudaStream_t stream);
+
+    size_t calBufferSize();
+};
+
+class SSIM : public CudaBaseOp
+{
+public:
+    SSIM()
+        : CudaBaseOp()
+    {
+        setGpuWorkspaceSize(calBufferSize());
+    }
+
+    /**
+     * @brief Computes the mean structural similarity index between the samples of 2 tensors, with 11x11 Gaussian
+     *        windows of standard deviation 1.5 averaged over the windows inside the images. Scores of all channels
+     *        together are the mean of the channel scores. See PSNR::infer for the limitations and parameters,
+     *        images must have at least 11x11 pixels.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData1, const ITensorDataStridedCuda &inData2,
+                    const ITensorDataStridedCuda &outData, float maxValue, cudaStream_t stream);
+
+    size_t calBufferSize();
+};
+
+class Sharpness : public CudaBaseOp
+{
+public:
+    Sharpness()
+        : CudaBaseOp()
+    {
+        setGpuWorkspaceSize(calBufferSize());
+    }
+
+    /**
+     * Limitations:
+     *
+     * Input:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1]
+     *      Data Type:      8bit Unsigned, 16bit Unsigned, 16bit Signed, 32bit Float
+     *
+     * @brief Computes the variance of the Laplacian of each sample, a measure of its sharpness, without writing the
+     *        Laplacian: each block reduces the sums of the responses of its rows and their squares.
+     * @param inData images.
+     * @param outData float output, NHWC or HWC with one sample per input sample, width, height and channels 1.
+     * @param ksize aperture of the Laplacian, 1 or 3 as with the Laplacian operator.
+     * @param borderMode pixel extrapolation method of the Laplacian.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, int ksize,
+                    NVCVBorderType borderMode, cudaStream_t stream);
+
+    size_t calBufferSize();
+};
+
+class FAST : public CudaBaseOp
+{
+public:
+    FAST()
+        : CudaBaseOp()
+    {
+    }
+
+    /**
+     * Limitations:
+     *
+     * Input:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1]
+     *      Data Type:      8bit Unsigned
+     *
+     * @brief Detects FAST-9 corners: pixels with 9 contiguous pixels of the circle of radius 3 around them all
+     *        brighter, or all darker, by more than the threshold, 3 pixels or more away from the image border.
+     *        The score of a corner is the largest threshold it would still be detected with, as OpenCV's FAST.
+     * @param inData images.
+     * @param outKeypointData [x, y] of the corners, NHWC or HWC int32 with one row of capacity columns and 2
+     *                        channels per sample, padded with -1 past the count. Their order is unspecified.
+     * @param outScoreData scores of the corners, float32 with one channel and the other dimensions of
+     *                     outKeypointData, padded with 0.
+     * @param outCountData number of corners written for each sample, int32 with one element per sample. Corners
+     *                     past the capacity are dropped.
+     * @param threshold minimum difference to the center pixel.
+     * @param nonmaxSuppression keep only the corners of higher score than their 8 neighbors.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outKeypointData,
+                    const ITensorDataStridedCuda &outScoreData, const ITensorDataStridedCuda &outCountData,
+                    int threshold, bool nonmaxSuppression, cudaStream_t stream);
+};
+
+class Harris : public CudaBaseOp
+{
+public:
+    Harris()
+        : CudaBaseOp()
+    {
+    }
+
+    /// Largest window of the structure tensor.
+    static constexpr int kMaxBlockSize = 7;
+
+    /**
+     * Limitations:
+     *
+     * Input:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1]
+     *      Data Type:      8bit Unsigned, 32bit Float
+     *
+     * @brief Detects the local maxima of the Harris or Shi-Tomasi corner response above a threshold. Gradients
+     *        are 3x3 Sobel derivatives, and the response is computed from their products summed over a window of
+     *        blockSize pixels, scaled as OpenCV's cornerHarris and cornerMinEigenVal so thresholds carry over.
+     *        Maxima are the responses not below any of their 8 neighbors.
+     * @param inData images.
+     * @param outKeypointData [x, y] of the corners, as with FAST.
+     * @param outScoreData responses of the corners.
+     * @param outCountData number of corners written for each sample.
+     * @param type corner response.
+     * @param blockSize side of the window, in [1, kMaxBlockSize].
+     * @param k Harris free parameter, unused by Shi-Tomasi.
+     * @param threshold responses must be above it.
+     * @param borderMode extrapolation of the image for the gradients and of the gradients for the windows.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outKeypointData,
+                    const ITensorDataStridedCuda &outScoreData, const ITensorDataStridedCuda &outCountData,
+                    NVCVCornerResponseType type, int blockSize, float k, float threshold, NVCVBorderType borderMode,
+                    cudaStream_t stream);
+};
+
+class MatchTemplate : public CudaBaseOp
+{
+public:
+    MatchTemplate()
+        : CudaBaseOp()
+    {
+        setGpuWorkspaceSize(calBufferSize());
+    }
+
+    /// Largest number of samples of a call, the statistics of their templates are kept in the workspace.
+    static constexpr int kMaxSamples = 1 << 16;
+
+    /**
+     * Limitations:
+     *
+     * Input and template:
+     *      Data Layout:    [kNHWC, kHWC]
+     *      Channels:       [1]
+     *      Data Type:      8bit Unsigned, 32bit Float
+     *
+     * @brief Computes the normalized cross-correlation of every sample with a template, as OpenCV's
+     *        TM_CCOEFF_NORMED. The correlation with the template minus its mean is computed by overlap-save FFTs,
+     *        see FFTCorrelation.hpp, and normalized with the sums over each window.
+     * @param inData images to search.
+     * @param templData templates, one per input sample or a single one for all, with the input type and at most
+     *                  FFTCorrelator::kMaxKernelSize pixels per side, and no larger than the images.
+     * @param outData float scores in [-1, 1], NHWC or HWC with the input samples and a single channel, of
+     *                (W - templW + 1) x (H - templH + 1) pixels.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &templData,
+                    const ITensorDataStridedCuda &outData, cudaStream_t stream);
+
+    size_t calBufferSize();
 
 private:
-    void *gpu_workspace = nullptr;
-    void *cpu_workspace = nullptr;
+    FFTCorrelator m_fft;
 };
 
 } // namespace nvcv::legacy::cuda_op
@@ -20,6 +20,7 @@
 #include "CvCudaLegacy.h"
 #include "nvcv/TensorDataAccess.hpp"
 
+#include <nvcv/DataLayout.h>
 #include <nvcv/DataType.hpp>
 #include <nvcv/Exception.hpp>
 
@@ -266,11 +267,102 @@ Size2D GetMaxImageSize(const ITensorDataStridedCuda &tensor)
     }
 }
 
+std::optional<TensorDataStridedCuda> PlanesAsSamples(const ITensorDataStridedCuda &tensor, int channel)
+{
+    const bool hasSamples = tensor.layout() == TENSOR_NCHW;
+    if (!hasSamples && tensor.layout() != TENSOR_CHW)
+    {
+        return std::nullopt;
+    }
+
+    const NVCVTensorData          &data = tensor.cdata();
+    const NVCVTensorBufferStrided &buf  = data.buffer.strided;
+
+    // Index of the C dimension, followed by H and W
+    const int     c           = hasSamples ? 1 : 0;
+    const int64_t numSamples  = hasSamples ? data.shape[0] : 1;
+    const int64_t numChannels = data.shape[c];
+    const int64_t planeStride = buf.strides[c];
+
+    NVCVTensorData planes = data;
+    planes.layout         = TENSOR_NHWC;
+    planes.rank           = 4;
+
+    planes.shape[1] = data.shape[c + 1];
+    planes.shape[2] = data.shape[c + 2];
+    planes.shape[3] = 1;
+
+    NVCVTensorBufferStrided &planesBuf = planes.buffer.strided;
+    planesBuf.strides[1]                = buf.strides[c + 1];
+    planesBuf.strides[2]                = buf.strides[c + 2];
+    planesBuf.strides[3]                = buf.strides[c + 2];
+
+    if (channel < 0)
+    {
+        // The last plane of a sample must be followed by the first plane of the next one
+        if (numSamples > 1 && buf.strides[0] != numChannels * planeStride)
+        {
+            return std::nullopt;
+        }
+        planes.shape[0]      = numSamples * numChannels;
+        planesBuf.strides[0] = planeStride;
+    }
+    else
+    {
+        if (channel >= numChannels)
+        {
+            return std::nullopt;
+        }
+        planes.shape[0]      = numSamples;
+        planesBuf.strides[0] = hasSamples ? buf.strides[0] : numChannels * planeStride;
+        planesBuf.basePtr += channel * planeStride;
+    }
+
+    return TensorDataStridedCuda(planes);
+}
+
+cuda_op::ChannelOrder GetLegacyChannelOrder(NVCVSwizzle swizzle, int32_t numChannels)
+{
+    NVCVChannel channels[4];
+    if (nvcvSwizzleGetChannels(swizzle, channels) != NVCV_SUCCESS)
+    {
+        throw Exception(Status::ERROR_INVALID_ARGUMENT, "Invalid channel order swizzle");
+    }
+
+    cuda_op::ChannelOrder order;
+    for (int c = 0; c < numChannels && c < 4; ++c)
+    {
+        const int src = static_cast<int>(channels[c]) - NVCV_CHANNEL_X;
+        if (src < 0 || src >= numChannels)
+        {
+            throw Exception(Status::ERROR_INVALID_ARGUMENT,
+                            "Channel order %s must only select one of the %d channels for each of them",
+                            nvcvSwizzleGetName(swizzle), numChannels);
+        }
+        order.channel[c] = static_cast<int8_t>(src);
+    }
+    return order;
+}
+
 Size2D GetMaxImageSize(const IImageBatchVarShapeDataStridedCuda &imageBatch)
 {
     return imageBatch.maxSize();
 }
 
+bool IsSparseBatch(const IImageBatchVarShape &imageBatch)
+{
+    const Size2D maxSize = imageBatch.maxSize();
+
+    int64_t area = 0;
+    for (const IImage &image : imageBatch)
+    {
+        const Size2D size = image.size();
+        area += static_cast<int64_t>(size.w) * size.h;
+    }
+
+    return 2 * area < static_cast<int64_t>(maxSize.w) * maxSize.h * imageBatch.numImages();
+}
+
 } // namespace nvcv::legacy::helpers
 
 namespace nvcv::util {
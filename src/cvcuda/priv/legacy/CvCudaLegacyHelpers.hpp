@@ -28,8 +28,11 @@
 
 #include <nvcv/IImageBatchData.hpp>
 #include <nvcv/ITensorData.hpp>
+#include <nvcv/TensorData.hpp>
 #include <nvcv/TensorShapeInfo.hpp>
 
+#include <optional>
+
 namespace nvcv::legacy::helpers {
 
 cuda_op::DataFormat GetLegacyDataFormat(int32_t numberChannels, int32_t numberPlanes, int32_t numberInBatch);
@@ -45,9 +48,22 @@ cuda_op::DataFormat GetLegacyDataFormat(const ITensorDataStridedCuda &tensor);
 
 cuda_op::DataShape GetLegacyDataShape(const TensorShapeInfoImage &shapeInfo);
 
+// Channels of the first numChannels components of the swizzle, which must only select channels below numChannels
+cuda_op::ChannelOrder GetLegacyChannelOrder(NVCVSwizzle swizzle, int32_t numChannels);
+
 Size2D GetMaxImageSize(const ITensorDataStridedCuda &tensor);
 Size2D GetMaxImageSize(const IImageBatchVarShapeDataStridedCuda &imageBatch);
 
+// Whether the images of the batch cover less than half of a grid sized for the largest one, most blocks of such a
+// grid would have nothing to do.  Varshape kernels then distribute their blocks with FlatTiles.cuh.
+bool IsSparseBatch(const IImageBatchVarShape &imageBatch);
+
+// Views a planar tensor, with NCHW or CHW layout, as an NHWC tensor with one channel whose samples are its planes,
+// so that operators processing each channel on its own run their interleaved kernels on planar data.  With a
+// channel, only the planes of that channel are viewed, one per sample.  Returns nothing for other layouts, or when
+// the planes of all channels aren't evenly spaced across samples.
+std::optional<TensorDataStridedCuda> PlanesAsSamples(const ITensorDataStridedCuda &tensor, int channel = -1);
+
 } // namespace nvcv::legacy::helpers
 
 namespace nvcv::util {
@@ -18,6 +18,10 @@
 #ifndef CV_CUDA_UTILS_CUH
 #define CV_CUDA_UTILS_CUH
 
+#include "LaunchBudget.hpp"
+#include "Precision.hpp"
+
+#include <cvcuda/Types.h> // for CVCUDA_MAX_HOST_PARAM_SAMPLES
 #include <nvcv/Exception.hpp>
 #include <nvcv/IImageBatchData.hpp>
 #include <nvcv/IImageData.hpp>  // for IImageDataStridedCuda, etc.
@@ -37,6 +41,7 @@
 #include <util/Assert.h>                        // for NVCV_ASSERT, etc.
 #include <util/CheckError.hpp>                  // for NVCV_CHECK_LOG, etc.
 
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
 #include <cmath>
@@ -44,6 +49,7 @@
 #include <cstring>
 #include <iostream>
 #include <sstream>
+#include <type_traits>
 
 namespace nvcv::legacy::cuda_op {
 
@@ -59,6 +65,145 @@ inline int divUp(int a, int b)
     return ceil((float)a / b);
 };
 
+// Largest grid z dimension. Kernels launched on more samples than that loop over them
+// from get_batch_idx() with a stride of gridDim.z.
+constexpr int kMaxGridDimZ = 65535;
+
+inline unsigned int BatchGridDim(int numSamples)
+{
+    return std::min(numSamples, kMaxGridDimZ);
+}
+
+// Grid of a launch whose kernel loops over x, y and the samples with a stride of the grid size, e.g. with
+// ForEachGridPixel.  It's capped by kMaxGridDimZ and by the launch budget of the calling thread, see LaunchBudget.hpp,
+// the samples being spread over the grid first, then whole rows of blocks.
+inline dim3 BudgetGrid(dim3 grid, dim3 block)
+{
+    grid.z = std::min(grid.z, static_cast<unsigned int>(kMaxGridDimZ));
+
+    const int64_t maxBlocks = BudgetedBlockCount(block);
+    if (maxBlocks == 0 || static_cast<int64_t>(grid.x) * grid.y * grid.z <= maxBlocks)
+    {
+        return grid;
+    }
+
+    grid.z               = static_cast<unsigned int>(std::min<int64_t>(grid.z, maxBlocks));
+    const int64_t perRow = maxBlocks / grid.z;
+    grid.x               = static_cast<unsigned int>(std::min<int64_t>(grid.x, perRow));
+    grid.y               = static_cast<unsigned int>(std::min<int64_t>(grid.y, std::max<int64_t>(1, perRow / grid.x)));
+    return grid;
+}
+
+// Calls op(batch_idx, x, y) for the pixels of the size.x x size.y images of the size.z samples handled by the
+// thread, with a stride of the grid size, so that grids capped by BudgetGrid still cover all of them.  Threads
+// handle PixelsPerThread consecutive pixels along x, op is called with the first one.
+template<int PixelsPerThread = 1, class PixelOp>
+inline __device__ void ForEachGridPixel(int3 size, PixelOp &&op)
+{
+    for (int batch_idx = get_batch_idx(); batch_idx < size.z; batch_idx += gridDim.z)
+    {
+        for (int y = blockIdx.y * blockDim.y + threadIdx.y; y < size.y; y += gridDim.y * blockDim.y)
+        {
+            for (int x = (blockIdx.x * blockDim.x + threadIdx.x) * PixelsPerThread; x < size.x;
+                 x += gridDim.x * blockDim.x * PixelsPerThread)
+            {
+                op(batch_idx, x, y);
+            }
+        }
+    }
+}
+
+// Per-sample parameters of N elements given on the host, passed to the kernel by value instead of read from a device
+// tensor, so that small batches need neither an allocation nor a copy.  Kernel arguments are limited to 4KB, batches
+// hold at most CVCUDA_MAX_HOST_PARAM_SAMPLES samples.  ptr() mirrors cuda::Tensor2DWrap, and with N == 1 operator[]
+// mirrors a device array, for kernels templated on where their parameters come from.
+template<typename T, int N = 1>
+struct SampleParams
+{
+    static_assert(sizeof(T) * N * CVCUDA_MAX_HOST_PARAM_SAMPLES <= 3072, "Parameters too large for kernel arguments");
+
+    SampleParams(const T *params, int numSamples)
+    {
+        NVCV_ASSERT(numSamples <= CVCUDA_MAX_HOST_PARAM_SAMPLES);
+        std::copy(params, params + numSamples * N, &data[0][0]);
+    }
+
+    __host__ __device__ const T *ptr(int sample, int elem = 0) const
+    {
+        return &data[sample][elem];
+    }
+
+    __host__ __device__ const T &operator[](int sample) const
+    {
+        return data[sample][0];
+    }
+
+    T data[CVCUDA_MAX_HOST_PARAM_SAMPLES][N];
+};
+
+// Calls launch(fast) with fast a std::bool_constant of whether the calling thread uses the fast precision mode, see
+// Precision.hpp, for launchers of kernels instantiated for both modes.
+template<class Launch>
+inline void DispatchPrecision(Launch &&launch)
+{
+    if (UseFastMath())
+    {
+        launch(std::true_type{});
+    }
+    else
+    {
+        launch(std::false_type{});
+    }
+}
+
+// exp(x), __expf when Fast, whose error grows with |x| but stays within a few ULPs for the weights kernels compute.
+template<bool Fast>
+inline __device__ float ExpF(float x)
+{
+    if constexpr (Fast)
+    {
+        return __expf(x);
+    }
+    else
+    {
+        return expf(x);
+    }
+}
+
+// a / b, __fdividef when Fast, within 2 ULPs for |b| in [2^-126, 2^126].
+template<bool Fast>
+inline __device__ float DivF(float a, float b)
+{
+    if constexpr (Fast)
+    {
+        return __fdividef(a, b);
+    }
+    else
+    {
+        return a / b;
+    }
+}
+
+// 1 / sqrt(x) of each element, rsqrtf when Fast.
+template<bool Fast, typename T>
+inline __device__ T RsqrtF(T x)
+{
+    if constexpr (Fast)
+    {
+        T r;
+#pragma unroll
+        for (int e = 0; e < nvcv::cuda::NumElements<T>; ++e)
+        {
+            nvcv::cuda::GetElement(r, e) = rsqrtf(nvcv::cuda::GetElement(x, e));
+        }
+        return r;
+    }
+    else
+    {
+        return 1.0f / nvcv::cuda::sqrt(x);
+    }
+}
+
 struct DefaultTransformPolicy
 {
     enum
@@ -940,7 +1085,7 @@ struct CubicFilter
 };
 
 // for integer scaling
-template<typename BrdReader>
+template<typename BrdReader, typename ResultType = typename BrdReader::elem_type>
 struct IntegerAreaFilter
 {
     typedef typename BrdReader::elem_type elem_type;
@@ -954,7 +1099,7 @@ struct IntegerAreaFilter
     {
     }
 
-    __device__ __forceinline__ elem_type operator()(int bidx, float y, float x) const
+    __device__ __forceinline__ ResultType operator()(int bidx, float y, float x) const
     {
         float fsx1 = x * scale_x;
         float fsx2 = fsx1 + scale_x;
@@ -977,14 +1122,14 @@ struct IntegerAreaFilter
                 out = out + src(bidx, dy, dx) * scale;
             }
 
-        return nvcv::cuda::SaturateCast<elem_type>(out);
+        return nvcv::cuda::SaturateCast<ResultType>(out);
     }
 
     BrdReader src;
     float     scale_x, scale_y, scale;
 };
 
-template<typename BrdReader>
+template<typename BrdReader, typename ResultType = typename BrdReader::elem_type>
 struct AreaFilter
 {
     typedef typename BrdReader::elem_type elem_type;
@@ -996,7 +1141,7 @@ struct AreaFilter
     {
     }
 
-    __device__ __forceinline__ elem_type operator()(int bidx, float y, float x) const
+    __device__ __forceinline__ ResultType operator()(int bidx, float y, float x) const
     {
         float fsx1 = x * scale_x;
         float fsx2 = fsx1 + scale_x;
@@ -1044,7 +1189,7 @@ struct AreaFilter
         if ((sy2 < fsy2) && (sx1 > fsx1))
             out = out + src(bidx, sy2, (sx1 - 1)) * ((fsy2 - sy2) * (sx1 - fsx1) * scale);
 
-        return nvcv::cuda::SaturateCast<elem_type>(out);
+        return nvcv::cuda::SaturateCast<ResultType>(out);
     }
 
     BrdReader src;
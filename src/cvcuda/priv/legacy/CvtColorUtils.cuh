@@ -0,0 +1,226 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file CvtColorUtils.cuh
+ *
+ * @brief Lookup tables and CIE Lab/Luv math shared by the tensor and varshape color conversions.
+ */
+
+#ifndef CV_CUDA_CVT_COLOR_UTILS_CUH
+#define CV_CUDA_CVT_COLOR_UTILS_CUH
+
+#include "CvCudaUtils.cuh"
+
+#include <cfloat>
+#include <cmath>
+
+namespace nvcv::legacy::cuda_op {
+
+static constexpr int hsv_shift = 12;
+
+// Division tables of the 8-bit BGR to HSV conversion, val[v] holds the S divisor of V and val[256 + d] the H
+// divisor of d = V - min(B, G, R).  They're computed once on the host, passed as kernel argument and copied to
+// shared memory by each block, so that pixels don't need double precision divisions.
+struct HsvDivTables8u
+{
+    int val[512];
+};
+
+inline HsvDivTables8u MakeHsvDivTables8u(int hrange)
+{
+    HsvDivTables8u tables;
+    tables.val[0]   = 0;
+    tables.val[256] = 0;
+    for (int i = 1; i < 256; ++i)
+    {
+        tables.val[i]       = cuda::SaturateCast<int>((255 << hsv_shift) / (1. * i));
+        tables.val[256 + i] = cuda::SaturateCast<int>((hrange << hsv_shift) / (6. * i));
+    }
+    return tables;
+}
+
+inline const HsvDivTables8u &GetHsvDivTables8u(bool isFullRange)
+{
+    static const HsvDivTables8u tables[2] = {MakeHsvDivTables8u(180), MakeHsvDivTables8u(256)};
+    return tables[isFullRange ? 1 : 0];
+}
+
+// Conversion table of 8-bit values to linear floating-point values in [0, 1], with or without sRGB gamma.
+struct GammaLut8u
+{
+    float val[256];
+};
+
+inline float SrgbToLinearHost(float x)
+{
+    return x <= 0.04045f ? x * (1.f / 12.92f) : std::pow((x + 0.055f) * (1.f / 1.055f), 2.4f);
+}
+
+inline const GammaLut8u &GetGammaLut8u(bool isSrgb)
+{
+    static const auto make = [](bool srgb)
+    {
+        GammaLut8u lut;
+        for (int i = 0; i < 256; ++i)
+        {
+            lut.val[i] = srgb ? SrgbToLinearHost(i * (1.f / 255.f)) : i * (1.f / 255.f);
+        }
+        return lut;
+    };
+    static const GammaLut8u luts[2] = {make(false), make(true)};
+    return luts[isSrgb ? 1 : 0];
+}
+
+// Copies a table passed as kernel argument to shared memory.  Must be called by all threads of the block.
+template<class Table>
+__device__ inline void LoadTableToShared(const Table &table, Table &smem)
+{
+    constexpr int kSize = sizeof(table.val) / sizeof(table.val[0]);
+    for (int i = get_lid(); i < kSize; i += blockDim.x * blockDim.y)
+    {
+        smem.val[i] = table.val[i];
+    }
+    __syncthreads();
+}
+
+__device__ inline float SrgbToLinear(float x)
+{
+    return x <= 0.04045f ? x * (1.f / 12.92f) : powf((x + 0.055f) * (1.f / 1.055f), 2.4f);
+}
+
+__device__ inline float LinearToSrgb(float x)
+{
+    return x <= 0.0031308f ? x * 12.92f : 1.055f * powf(x, 1.f / 2.4f) - 0.055f;
+}
+
+// CIE XYZ with D65 white point, as in OpenCV
+static constexpr float D65_Xn = 0.950456f;
+static constexpr float D65_Zn = 1.088754f;
+static constexpr float Luv_un = 4 * D65_Xn / (D65_Xn + 15 + 3 * D65_Zn);
+static constexpr float Luv_vn = 9 / (D65_Xn + 15 + 3 * D65_Zn);
+static constexpr float Lab_thresh = 0.008856f;
+static constexpr float Lab_kappa  = 903.3f;
+
+__device__ inline float LabF(float t)
+{
+    return t > Lab_thresh ? cbrtf(t) : 7.787f * t + 16.f / 116.f;
+}
+
+__device__ inline float LabFInv(float t)
+{
+    return t > 0.206893f ? t * t * t : (t - 16.f / 116.f) * (1.f / 7.787f);
+}
+
+__device__ inline float3 LinearRGBToXYZ(float r, float g, float b)
+{
+    return {0.412453f * r + 0.357580f * g + 0.180423f * b, 0.212671f * r + 0.715160f * g + 0.072169f * b,
+            0.019334f * r + 0.119193f * g + 0.950227f * b};
+}
+
+__device__ inline void XYZToLinearRGB(float3 xyz, float &r, float &g, float &b)
+{
+    r = 3.240479f * xyz.x - 1.53715f * xyz.y - 0.498535f * xyz.z;
+    g = -0.969256f * xyz.x + 1.875991f * xyz.y + 0.041556f * xyz.z;
+    b = 0.055648f * xyz.x - 0.204043f * xyz.y + 1.057311f * xyz.z;
+}
+
+// L* of both Lab and Luv from Y, and back
+__device__ inline float YToL(float y)
+{
+    return y > Lab_thresh ? 116.f * cbrtf(y) - 16.f : Lab_kappa * y;
+}
+
+__device__ inline float LToY(float l)
+{
+    if (l <= Lab_kappa * Lab_thresh)
+    {
+        return l * (1.f / Lab_kappa);
+    }
+    float fy = (l + 16.f) * (1.f / 116.f);
+    return fy * fy * fy;
+}
+
+// Linear RGB in [0, 1] to L in [0, 100] and a, b or u, v
+__device__ inline float3 LinearRGBToLab(float r, float g, float b, bool isLuv)
+{
+    float3 xyz = LinearRGBToXYZ(r, g, b);
+    float  L   = YToL(xyz.y);
+    if (isLuv)
+    {
+        float d = 1.f / fmaxf(xyz.x + 15.f * xyz.y + 3.f * xyz.z, FLT_EPSILON);
+        return {L, 13.f * L * (4.f * xyz.x * d - Luv_un), 13.f * L * (9.f * xyz.y * d - Luv_vn)};
+    }
+    float fx = LabF(xyz.x * (1.f / D65_Xn));
+    float fy = LabF(xyz.y);
+    float fz = LabF(xyz.z * (1.f / D65_Zn));
+    return {L, 500.f * (fx - fy), 200.f * (fy - fz)};
+}
+
+// L in [0, 100] and a, b or u, v to linear RGB clamped to [0, 1]
+__device__ inline void LabToLinearRGB(float3 lab, bool isLuv, float &r, float &g, float &b)
+{
+    float3 xyz;
+    xyz.y = LToY(lab.x);
+    if (isLuv)
+    {
+        if (lab.x <= 0.f)
+        {
+            xyz = {0.f, 0.f, 0.f};
+        }
+        else
+        {
+            float up = lab.y / (13.f * lab.x) + Luv_un;
+            float vp = fmaxf(lab.z / (13.f * lab.x) + Luv_vn, FLT_EPSILON);
+            xyz.x    = 9.f * xyz.y * up / (4.f * vp);
+            xyz.z    = xyz.y * (12.f - 3.f * up - 20.f * vp) / (4.f * vp);
+        }
+    }
+    else
+    {
+        float fy = lab.x <= Lab_kappa * Lab_thresh ? 7.787f * xyz.y + 16.f / 116.f : (lab.x + 16.f) * (1.f / 116.f);
+        xyz.x    = LabFInv(fy + lab.y * (1.f / 500.f)) * D65_Xn;
+        xyz.z    = LabFInv(fy - lab.z * (1.f / 200.f)) * D65_Zn;
+    }
+    XYZToLinearRGB(xyz, r, g, b);
+    r = fminf(fmaxf(r, 0.f), 1.f);
+    g = fminf(fmaxf(g, 0.f), 1.f);
+    b = fminf(fmaxf(b, 0.f), 1.f);
+}
+
+// Scaling of Lab and Luv values to 8 bits, as in OpenCV
+__device__ inline float3 LabTo8u(float3 lab, bool isLuv)
+{
+    if (isLuv)
+    {
+        return {lab.x * (255.f / 100.f), (lab.y + 134.f) * (255.f / 354.f), (lab.z + 140.f) * (255.f / 262.f)};
+    }
+    return {lab.x * (255.f / 100.f), lab.y + 128.f, lab.z + 128.f};
+}
+
+__device__ inline float3 LabFrom8u(float3 lab, bool isLuv)
+{
+    if (isLuv)
+    {
+        return {lab.x * (100.f / 255.f), lab.y * (354.f / 255.f) - 134.f, lab.z * (262.f / 255.f) - 140.f};
+    }
+    return {lab.x * (100.f / 255.f), lab.y - 128.f, lab.z - 128.f};
+}
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_CVT_COLOR_UTILS_CUH
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file FFTCorrelation.hpp
+ *
+ * @brief Defines the cuFFT plans of the FFT-based correlation of legacy operators.
+ */
+
+#ifndef CV_CUDA_LEGACY_FFT_CORRELATION_HPP
+#define CV_CUDA_LEGACY_FFT_CORRELATION_HPP
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+namespace nvcv::legacy::cuda_op {
+
+/**
+ * Images are correlated with kernels by overlap-save: they're cut in square tiles of TransformSize() pixels
+ * overlapping by the kernel size minus one, each tile is multiplied with the kernel in the frequency domain, and
+ * the part of the product that didn't wrap around is kept. Tiles are transformed in batches sized to fit
+ * kWorkspaceSize bytes, see fft_correlation.cu.
+ *
+ * The batched plans are created on first use and kept for the next calls, per stream since the work area of a
+ * plan can't be shared by concurrent executions.
+ */
+class FFTCorrelator
+{
+public:
+    /// Largest kernel side supported.
+    static constexpr int kMaxKernelSize = 512;
+
+    /// Workspace used by a correlation, whatever the size of the images.
+    static constexpr size_t kWorkspaceSize = 64 << 20;
+
+    FFTCorrelator() = default;
+    ~FFTCorrelator();
+
+    FFTCorrelator(const FFTCorrelator &)            = delete;
+    FFTCorrelator &operator=(const FFTCorrelator &) = delete;
+
+    /// Side of the transforms used for kernels up to maxKernelSize, a power of two.
+    static int TransformSize(int2 maxKernelSize);
+
+    /// R2C and C2R plans of batch transforms of n x n pixels for stream, as cufftHandle.
+    std::pair<int, int> plans(cudaStream_t stream, int n, int batch);
+
+private:
+    std::mutex                                                       m_mtx;
+    std::map<std::tuple<cudaStream_t, int, int>, std::pair<int, int>> m_plans;
+};
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_LEGACY_FFT_CORRELATION_HPP
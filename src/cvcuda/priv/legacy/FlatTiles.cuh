@@ -0,0 +1,201 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CV_CUDA_FLAT_TILES_CUH
+#define CV_CUDA_FLAT_TILES_CUH
+
+#include "LaunchBudget.hpp"
+
+#include <cuda_runtime.h>
+#include <nvcv/Size.hpp>
+
+#include <algorithm>
+
+namespace nvcv::legacy::cuda_op {
+
+// Blocks per multiprocessor of the grid of flattened kernels, they loop over the tiles of the batch.
+constexpr int kFlatTilesBlocksPerSM = 8;
+
+// Images whose tile offsets fit in the shared memory of flattened kernels.
+constexpr int kFlatTilesMaxImages = 48 * 1024 / sizeof(int) - 1;
+
+/**
+ * Compute where the tiles of each image of a varshape batch start in the flattened list of tiles.
+ *
+ * Tiles have the size of the block.  The number of tiles of each image is derived from its size, and an
+ * exclusive prefix sum over them is computed by the whole block, with a carry between chunks of as many images as
+ * there are threads.  The block must have a multiple of 32 threads, 1024 at most.
+ *
+ * All threads of the block must call this function with the same arguments.
+ *
+ * @param sizes Wrapper with the size of the images, e.g. the output ImageBatchVarShapeWrap.
+ * @param numImages Number of images in the batch.
+ * @param firstTile Shared memory with numImages + 1 entries, the last one receives the total number of tiles.
+ *
+ * @return Total number of tiles.
+ */
+template<class SizeWrapper>
+inline __device__ int FlatTilesPrefix(const SizeWrapper &sizes, int numImages, int *firstTile)
+{
+    __shared__ int warpSums[32];
+    __shared__ int carry;
+
+    const int numThreads = blockDim.x * blockDim.y;
+    const int numWarps   = numThreads / 32;
+    const int lid        = threadIdx.y * blockDim.x + threadIdx.x;
+    const int lane       = lid % 32;
+    const int warp       = lid / 32;
+
+    if (lid == 0)
+    {
+        carry = 0;
+    }
+
+    for (int base = 0; base < numImages; base += numThreads)
+    {
+        const int i     = base + lid;
+        int       count = 0;
+        if (i < numImages)
+        {
+            const int tilesX = (sizes.width(i) + blockDim.x - 1) / blockDim.x;
+            const int tilesY = (sizes.height(i) + blockDim.y - 1) / blockDim.y;
+            count            = tilesX * tilesY;
+        }
+
+        int sum = count;
+#pragma unroll
+        for (int d = 1; d < 32; d *= 2)
+        {
+            int v = __shfl_up_sync(0xffffffff, sum, d);
+            if (lane >= d)
+            {
+                sum += v;
+            }
+        }
+        if (lane == 31)
+        {
+            warpSums[warp] = sum;
+        }
+        __syncthreads();
+
+        if (warp == 0)
+        {
+            int warpSum = lane < numWarps ? warpSums[lane] : 0;
+#pragma unroll
+            for (int d = 1; d < 32; d *= 2)
+            {
+                int v = __shfl_up_sync(0xffffffff, warpSum, d);
+                if (lane >= d)
+                {
+                    warpSum += v;
+                }
+            }
+            warpSums[lane] = warpSum;
+        }
+        __syncthreads();
+
+        if (i < numImages)
+        {
+            firstTile[i] = carry + (warp > 0 ? warpSums[warp - 1] : 0) + sum - count;
+        }
+        __syncthreads();
+
+        if (lid == 0)
+        {
+            carry += warpSums[numWarps - 1];
+        }
+        __syncthreads();
+    }
+
+    if (lid == 0)
+    {
+        firstTile[numImages] = carry;
+    }
+    __syncthreads();
+
+    return firstTile[numImages];
+}
+
+/**
+ * Kernel running a per-pixel functor over the tiles of all images of a varshape batch.
+ *
+ * The usual varshape grid is sized for the largest image, with one image per grid z, so blocks past the end of
+ * smaller images exit right away.  Here the grid is one-dimensional, and each block loops over the flattened list
+ * of tiles: the GPU does work proportional to the number of pixels of the batch, whatever the spread of sizes.
+ *
+ * @param op Functor with a __device__ operator()(int batch_idx, int x, int y), called for each pixel of the tiles,
+ *           including those past the right and bottom edges of the image, which it must ignore.
+ * @param sizes Wrapper with the size of the images that are tiled.
+ * @param numImages Number of images, at most kFlatTilesMaxImages.
+ */
+template<class PixelOp, class SizeWrapper>
+__global__ void flatTilesKernel(const PixelOp op, const SizeWrapper sizes, int numImages)
+{
+    extern __shared__ int firstTile[];
+
+    const int numTiles = FlatTilesPrefix(sizes, numImages, firstTile);
+
+    for (int tile = blockIdx.x; tile < numTiles; tile += gridDim.x)
+    {
+        // last image starting at or before the tile, which skips images without tiles
+        int lo = 0, hi = numImages - 1;
+        while (lo < hi)
+        {
+            const int mid = (lo + hi + 1) / 2;
+            if (firstTile[mid] <= tile)
+            {
+                lo = mid;
+            }
+            else
+            {
+                hi = mid - 1;
+            }
+        }
+
+        const int local  = tile - firstTile[lo];
+        const int tilesX = (sizes.width(lo) + blockDim.x - 1) / blockDim.x;
+
+        op(lo, (local % tilesX) * blockDim.x + threadIdx.x, (local / tilesX) * blockDim.y + threadIdx.y);
+    }
+}
+
+/// Whether a batch with this many images can be processed by flatTilesKernel.
+inline bool CanFlatTiles(int numImages, dim3 block)
+{
+    return numImages > 0 && numImages <= kFlatTilesMaxImages && (block.x * block.y) % 32 == 0
+        && block.x * block.y <= 1024;
+}
+
+/// Launches flatTilesKernel with enough blocks to fill the SMs of the launch budget, or to cover the largest image of
+/// each sample.
+template<class PixelOp, class SizeWrapper>
+void LaunchFlatTiles(const PixelOp &op, const SizeWrapper &sizes, int numImages, Size2D maxSize, dim3 block,
+                     cudaStream_t stream)
+{
+    const int numSMs = BudgetedSMCount();
+
+    const int64_t maxTiles = static_cast<int64_t>(numImages) * ((maxSize.w + block.x - 1) / block.x)
+                           * ((maxSize.h + block.y - 1) / block.y);
+    const int     numBlocks = static_cast<int>(std::max<int64_t>(
+        1, std::min<int64_t>(maxTiles, static_cast<int64_t>(numSMs) * kFlatTilesBlocksPerSM)));
+
+    flatTilesKernel<<<numBlocks, block, (numImages + 1) * sizeof(int), stream>>>(op, sizes, numImages);
+}
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_FLAT_TILES_CUH
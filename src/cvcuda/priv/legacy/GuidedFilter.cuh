@@ -0,0 +1,734 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file GuidedFilter.cuh
+ *
+ * @brief Guided filter kernels shared by the tensor and varshape operators.
+ *
+ * The filter of He et al. is made of box means of the guide I, the input p and their products, followed by box
+ * means of the linear coefficients a and b fitted in each window, each output pixel being a * I + b with the
+ * means of the coefficients of the windows it belongs to.
+ *
+ * Box means are separable running sums over float planes in the workspace: a column pass slides the window down
+ * strips of columns, and a row pass, one warp per strip of row, takes the differences of prefix sums scanned across
+ * the warp. Both are O(1) per pixel whatever the radius, strips being at least as long as the window. The windows
+ * are clipped to the image, the means being taken over the pixels inside them.
+ *
+ * In the fast mode the coefficients are computed on images subsampled by averaging factor x factor blocks, with the
+ * radius divided by the factor, and they're upsampled bilinearly before being applied to the full resolution guide.
+ */
+
+#ifndef CV_CUDA_GUIDED_FILTER_CUH
+#define CV_CUDA_GUIDED_FILTER_CUH
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+#include "CvCudaUtils.cuh"
+
+namespace nvcv::legacy::cuda_op::guided {
+
+// Element types of the images, integer values are normalized to [0, 1]
+enum ElemKind
+{
+    kElemU8,
+    kElemU16,
+    kElemF32,
+};
+
+inline bool GetElemKind(DataType type, ElemKind &kind)
+{
+    switch (type)
+    {
+    case kCV_8U:
+        kind = kElemU8;
+        return true;
+    case kCV_16U:
+        kind = kElemU16;
+        return true;
+    case kCV_32F:
+        kind = kElemF32;
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Checks the parameters shared by the tensor and varshape operators
+inline ErrorCode CheckParams(int radius, float eps, int subsample)
+{
+    if (radius < 1)
+    {
+        LOG_ERROR("Invalid radius " << radius << ", it must be at least 1");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    if (!(eps > 0))
+    {
+        LOG_ERROR("Invalid eps " << eps << ", it must be positive");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    if (subsample < 1)
+    {
+        LOG_ERROR("Invalid subsampling factor " << subsample << ", it must be at least 1");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+// Minimum length of the strips of both box passes, more than the window when the radius is large
+constexpr int kMinStrip = 128;
+
+inline int StripLength(int radius)
+{
+    return divUp(std::max(kMinStrip, 2 * radius), 32) * 32;
+}
+
+// Size of the images the coefficients are computed on
+__host__ __device__ inline int2 LowSize(int2 size, int factor)
+{
+    return int2{(size.x + factor - 1) / factor, (size.y + factor - 1) / factor};
+}
+
+__device__ __forceinline__ float LoadElem(const uchar *row, int i, ElemKind kind)
+{
+    switch (kind)
+    {
+    case kElemU8:
+        return row[i] * (1.f / 255);
+    case kElemU16:
+        return reinterpret_cast<const ushort *>(row)[i] * (1.f / 65535);
+    default:
+        return reinterpret_cast<const float *>(row)[i];
+    }
+}
+
+__device__ __forceinline__ void StoreElem(uchar *row, int i, ElemKind kind, float value)
+{
+    switch (kind)
+    {
+    case kElemU8:
+        row[i] = cuda::SaturateCast<uchar>(value * 255);
+        break;
+    case kElemU16:
+        reinterpret_cast<ushort *>(row)[i] = cuda::SaturateCast<ushort>(value * 65535);
+        break;
+    default:
+        reinterpret_cast<float *>(row)[i] = value;
+        break;
+    }
+}
+
+// Rows of the samples of a tensor, all of the same size
+struct TensorRows
+{
+    cuda::Tensor3DWrap<uchar> data;
+    int2                      size;
+
+    __device__ int2 imageSize(int) const
+    {
+        return size;
+    }
+
+    __device__ uchar *row(int s, int y) const
+    {
+        return data.ptr(s, y, 0);
+    }
+};
+
+// Rows of the images of a varshape batch
+struct BatchRows
+{
+    cuda::ImageBatchVarShapeWrap<uchar> data;
+
+    __device__ int2 imageSize(int s) const
+    {
+        return int2{data.width(s), data.height(s)};
+    }
+
+    __device__ uchar *row(int s, int y) const
+    {
+        return data.ptr(s, y, 0);
+    }
+};
+
+// Float planes of the workspace, numPlanes per sample
+struct Planes
+{
+    float *data;
+    int    numPlanes, width, height;
+
+    __device__ float &at(int s, int k, int y, int x) const
+    {
+        return data[((static_cast<int64_t>(s) * numPlanes + k) * height + y) * width + x];
+    }
+};
+
+// Number of box means of the first pass: guide, guide products, input and guide times input
+template<int GC, int C>
+constexpr int kNumInputMeans = GC * (GC + 3) / 2 + C * (GC + 1);
+
+// Number of coefficients: GC values of a and one of b per input channel
+template<int GC, int C>
+constexpr int kNumCoefs = C * (GC + 1);
+
+// Guide and input pixels of the first pass, averaged over factor x factor blocks in the fast mode
+template<int GC, int C, class Rows>
+struct InputLoader
+{
+    static constexpr int K = kNumInputMeans<GC, C>;
+
+    Rows     guide, in;
+    ElemKind guideKind, inKind;
+    int      factor;
+
+    __device__ int2 size(int s) const
+    {
+        return LowSize(guide.imageSize(s), factor);
+    }
+
+    __device__ void operator()(int s, int y, int x, float (&q)[K]) const
+    {
+        const int2 full = guide.imageSize(s);
+        const int  x0 = x * factor, x1 = min(x0 + factor, full.x);
+        const int  y0 = y * factor, y1 = min(y0 + factor, full.y);
+
+        float g[GC] = {}, p[C] = {};
+        for (int fy = y0; fy < y1; ++fy)
+        {
+            const uchar *guideRow = guide.row(s, fy);
+            const uchar *inRow    = in.row(s, fy);
+            for (int fx = x0; fx < x1; ++fx)
+            {
+#pragma unroll
+                for (int i = 0; i < GC; ++i)
+                {
+                    g[i] += LoadElem(guideRow, fx * GC + i, guideKind);
+                }
+#pragma unroll
+                for (int c = 0; c < C; ++c)
+                {
+                    p[c] += LoadElem(inRow, fx * C + c, inKind);
+                }
+            }
+        }
+
+        if (factor > 1)
+        {
+            const float norm = 1.f / ((x1 - x0) * (y1 - y0));
+#pragma unroll
+            for (int i = 0; i < GC; ++i)
+            {
+                g[i] *= norm;
+            }
+#pragma unroll
+            for (int c = 0; c < C; ++c)
+            {
+                p[c] *= norm;
+            }
+        }
+
+        int k = 0;
+#pragma unroll
+        for (int i = 0; i < GC; ++i)
+        {
+            q[k++] = g[i];
+        }
+#pragma unroll
+        for (int i = 0; i < GC; ++i)
+        {
+#pragma unroll
+            for (int j = i; j < GC; ++j)
+            {
+                q[k++] = g[i] * g[j];
+            }
+        }
+#pragma unroll
+        for (int c = 0; c < C; ++c)
+        {
+            q[k++] = p[c];
+        }
+#pragma unroll
+        for (int c = 0; c < C; ++c)
+        {
+#pragma unroll
+            for (int i = 0; i < GC; ++i)
+            {
+                q[k++] = g[i] * p[c];
+            }
+        }
+    }
+};
+
+// Values of the workspace planes, for the box means of the coefficients
+template<int K_, class Rows>
+struct PlaneLoader
+{
+    static constexpr int K = K_;
+
+    Planes planes;
+    Rows   guide;
+    int    factor;
+
+    __device__ int2 size(int s) const
+    {
+        return LowSize(guide.imageSize(s), factor);
+    }
+
+    __device__ void operator()(int s, int y, int x, float (&q)[K]) const
+    {
+#pragma unroll
+        for (int k = 0; k < K; ++k)
+        {
+            q[k] = planes.at(s, k, y, x);
+        }
+    }
+};
+
+// Stores the box means to the workspace planes, the means of the coefficients in the fast mode
+template<int K_, class Rows>
+struct PlaneStore
+{
+    static constexpr int K = K_;
+
+    Planes planes;
+    Rows   guide;
+    int    factor;
+
+    __device__ int2 size(int s) const
+    {
+        return LowSize(guide.imageSize(s), factor);
+    }
+
+    __device__ void operator()(int s, int y, int x, const float (&m)[K]) const
+    {
+#pragma unroll
+        for (int k = 0; k < K; ++k)
+        {
+            planes.at(s, k, y, x) = m[k];
+        }
+    }
+};
+
+// Fits the coefficients a and b of each window from the means of the first pass, a being the solution of
+// (cov(I, I) + eps) a = cov(I, p), which is a 3x3 system for color guides.
+template<int GC, int C, class Rows>
+struct CoefStore
+{
+    static constexpr int K = kNumInputMeans<GC, C>;
+
+    Planes coefs;
+    Rows   guide;
+    int    factor;
+    float  eps;
+
+    __device__ int2 size(int s) const
+    {
+        return LowSize(guide.imageSize(s), factor);
+    }
+
+    __device__ void operator()(int s, int y, int x, const float (&m)[K]) const
+    {
+        constexpr int kMeanP  = GC * (GC + 3) / 2;
+        constexpr int kMeanIP = kMeanP + C;
+
+        const float *meanI = m;
+
+        if constexpr (GC == 1)
+        {
+            const float invVar = 1.f / (m[1] - meanI[0] * meanI[0] + eps);
+#pragma unroll
+            for (int c = 0; c < C; ++c)
+            {
+                const float meanP = m[kMeanP + c];
+                const float a     = (m[kMeanIP + c] - meanI[0] * meanP) * invVar;
+
+                coefs.at(s, 2 * c, y, x)     = a;
+                coefs.at(s, 2 * c + 1, y, x) = meanP - a * meanI[0];
+            }
+        }
+        else
+        {
+            // products are ordered 00, 01, 02, 11, 12, 22
+            const float v00 = m[3] - meanI[0] * meanI[0] + eps;
+            const float v01 = m[4] - meanI[0] * meanI[1];
+            const float v02 = m[5] - meanI[0] * meanI[2];
+            const float v11 = m[6] - meanI[1] * meanI[1] + eps;
+            const float v12 = m[7] - meanI[1] * meanI[2];
+            const float v22 = m[8] - meanI[2] * meanI[2] + eps;
+
+            // inverse of the symmetric matrix from its adjugate
+            const float i00 = v11 * v22 - v12 * v12;
+            const float i01 = v02 * v12 - v01 * v22;
+            const float i02 = v01 * v12 - v02 * v11;
+            const float i11 = v00 * v22 - v02 * v02;
+            const float i12 = v01 * v02 - v00 * v12;
+            const float i22 = v00 * v11 - v01 * v01;
+            const float det = 1.f / (v00 * i00 + v01 * i01 + v02 * i02);
+
+#pragma unroll
+            for (int c = 0; c < C; ++c)
+            {
+                const float  meanP = m[kMeanP + c];
+                const float *meanIP = m + kMeanIP + 3 * c;
+
+                const float cov0 = meanIP[0] - meanI[0] * meanP;
+                const float cov1 = meanIP[1] - meanI[1] * meanP;
+                const float cov2 = meanIP[2] - meanI[2] * meanP;
+
+                const float a0 = (i00 * cov0 + i01 * cov1 + i02 * cov2) * det;
+                const float a1 = (i01 * cov0 + i11 * cov1 + i12 * cov2) * det;
+                const float a2 = (i02 * cov0 + i12 * cov1 + i22 * cov2) * det;
+
+                coefs.at(s, 4 * c, y, x)     = a0;
+                coefs.at(s, 4 * c + 1, y, x) = a1;
+                coefs.at(s, 4 * c + 2, y, x) = a2;
+                coefs.at(s, 4 * c + 3, y, x) = meanP - a0 * meanI[0] - a1 * meanI[1] - a2 * meanI[2];
+            }
+        }
+    }
+};
+
+// Applies the coefficients to a guide pixel and stores the output pixel.
+template<int GC, int C, class Rows>
+__device__ __forceinline__ void StoreOutput(const Rows &guide, const Rows &out, ElemKind guideKind, ElemKind outKind,
+                                            int s, int y, int x, const float (&coef)[kNumCoefs<GC, C>])
+{
+    const uchar *guideRow = guide.row(s, y);
+    uchar       *outRow   = out.row(s, y);
+
+    float g[GC];
+#pragma unroll
+    for (int i = 0; i < GC; ++i)
+    {
+        g[i] = LoadElem(guideRow, x * GC + i, guideKind);
+    }
+
+#pragma unroll
+    for (int c = 0; c < C; ++c)
+    {
+        float value = coef[c * (GC + 1) + GC];
+#pragma unroll
+        for (int i = 0; i < GC; ++i)
+        {
+            value += coef[c * (GC + 1) + i] * g[i];
+        }
+        StoreElem(outRow, x * C + c, outKind, value);
+    }
+}
+
+// Stores the output from the means of the coefficients, without subsampling
+template<int GC, int C, class Rows>
+struct OutputStore
+{
+    static constexpr int K = kNumCoefs<GC, C>;
+
+    Rows     guide, out;
+    ElemKind guideKind, outKind;
+
+    __device__ int2 size(int s) const
+    {
+        return guide.imageSize(s);
+    }
+
+    __device__ void operator()(int s, int y, int x, const float (&m)[K]) const
+    {
+        StoreOutput<GC, C>(guide, out, guideKind, outKind, s, y, x, m);
+    }
+};
+
+// Each thread slides the window down a strip of one column, adding the row entering it and subtracting the one
+// leaving it. The sums are stored as is, the row pass divides them by the clipped window area.
+template<class Loader>
+__global__ void boxColumns(Loader load, Planes sums, int radius, int strip)
+{
+    constexpr int K = Loader::K;
+
+    const int  s    = blockIdx.z;
+    const int  x    = blockIdx.x * blockDim.x + threadIdx.x;
+    const int  y0   = blockIdx.y * strip;
+    const int2 size = load.size(s);
+
+    if (x >= size.x || y0 >= size.y)
+        return;
+
+    const int y1 = min(y0 + strip, size.y);
+
+    float sum[K] = {};
+    float q[K];
+
+    // rows y0 - radius to y0 + radius - 1, the first loop iteration adds the last row of the window
+    for (int y = max(y0 - radius, 0); y < min(y0 + radius, size.y); ++y)
+    {
+        load(s, y, x, q);
+#pragma unroll
+        for (int k = 0; k < K; ++k)
+        {
+            sum[k] += q[k];
+        }
+    }
+
+    for (int y = y0; y < y1; ++y)
+    {
+        if (y + radius < size.y)
+        {
+            load(s, y + radius, x, q);
+#pragma unroll
+            for (int k = 0; k < K; ++k)
+            {
+                sum[k] += q[k];
+            }
+        }
+
+#pragma unroll
+        for (int k = 0; k < K; ++k)
+        {
+            sums.at(s, k, y, x) = sum[k];
+        }
+
+        if (y - radius >= 0)
+        {
+            load(s, y - radius, x, q);
+#pragma unroll
+            for (int k = 0; k < K; ++k)
+            {
+                sum[k] -= q[k];
+            }
+        }
+    }
+}
+
+// Each warp sums the windows along a strip of one row, 32 columns at a time. The window sum at x is
+// D + scan(x) + c[x - radius], D being the difference of the prefix sums at both ends of the window of the first
+// column of the chunk minus one, scan the inclusive warp scan of c[x + radius] - c[x - radius], so that column
+// sums are read coalesced and only twice whatever the radius.
+template<class Store>
+__global__ void boxRows(Planes sums, Store store, int radius, int strip)
+{
+    constexpr int K = Store::K;
+
+    const int  s    = blockIdx.z;
+    const int  y    = blockIdx.y * blockDim.y + threadIdx.y;
+    const int  x0   = blockIdx.x * strip;
+    const int  lane = threadIdx.x;
+    const int2 size = store.size(s);
+
+    // uniform across the warp
+    if (y >= size.y || x0 >= size.x)
+        return;
+
+    const int x1 = min(x0 + strip, size.x);
+    const int ny = min(y + radius, size.y - 1) - max(y - radius, 0) + 1;
+
+    // sum of the columns x0 - radius to x0 + radius - 1
+    float diff[K] = {};
+    for (int j = x0 - radius + lane; j < x0 + radius; j += 32)
+    {
+        if (j >= 0 && j < size.x)
+        {
+#pragma unroll
+            for (int k = 0; k < K; ++k)
+            {
+                diff[k] += sums.at(s, k, y, j);
+            }
+        }
+    }
+#pragma unroll
+    for (int k = 0; k < K; ++k)
+    {
+#pragma unroll
+        for (int d = 16; d >= 1; d /= 2)
+        {
+            diff[k] += __shfl_xor_sync(0xffffffff, diff[k], d);
+        }
+    }
+
+    for (int xb = x0; xb < x1; xb += 32)
+    {
+        const int  x        = xb + lane;
+        const int  lead     = x + radius;
+        const int  trail    = x - radius;
+        const bool hasLead  = lead < size.x;
+        const bool hasTrail = trail >= 0 && trail < size.x;
+
+        float box[K];
+#pragma unroll
+        for (int k = 0; k < K; ++k)
+        {
+            const float cl = hasLead ? sums.at(s, k, y, lead) : 0.f;
+            const float ct = hasTrail ? sums.at(s, k, y, trail) : 0.f;
+
+            float scan = cl - ct;
+#pragma unroll
+            for (int d = 1; d < 32; d *= 2)
+            {
+                const float v = __shfl_up_sync(0xffffffff, scan, d);
+                if (lane >= d)
+                {
+                    scan += v;
+                }
+            }
+
+            box[k] = diff[k] + scan + ct;
+            diff[k] += __shfl_sync(0xffffffff, scan, 31);
+        }
+
+        if (x < x1)
+        {
+            const int   nx   = min(x + radius, size.x - 1) - max(x - radius, 0) + 1;
+            const float norm = 1.f / (nx * ny);
+#pragma unroll
+            for (int k = 0; k < K; ++k)
+            {
+                box[k] *= norm;
+            }
+            store(s, y, x, box);
+        }
+    }
+}
+
+// Full resolution output of the fast mode, from the means of the coefficients upsampled bilinearly.
+template<int GC, int C, class Rows>
+__global__ void upsampleCoefs(Planes means, Rows guide, Rows out, ElemKind guideKind, ElemKind outKind, int factor)
+{
+    constexpr int K = kNumCoefs<GC, C>;
+
+    const int  s    = blockIdx.z;
+    const int  x    = blockIdx.x * blockDim.x + threadIdx.x;
+    const int  y    = blockIdx.y * blockDim.y + threadIdx.y;
+    const int2 size = guide.imageSize(s);
+
+    if (x >= size.x || y >= size.y)
+        return;
+
+    const int2  low = LowSize(size, factor);
+    const float fx  = cuda::clamp((x + 0.5f) / factor - 0.5f, 0.f, low.x - 1.f);
+    const float fy  = cuda::clamp((y + 0.5f) / factor - 0.5f, 0.f, low.y - 1.f);
+    const int   lx0 = static_cast<int>(fx), ly0 = static_cast<int>(fy);
+    const int   lx1 = min(lx0 + 1, low.x - 1), ly1 = min(ly0 + 1, low.y - 1);
+    const float wx = fx - lx0, wy = fy - ly0;
+
+    float coef[K];
+#pragma unroll
+    for (int k = 0; k < K; ++k)
+    {
+        const float top    = means.at(s, k, ly0, lx0) + wx * (means.at(s, k, ly0, lx1) - means.at(s, k, ly0, lx0));
+        const float bottom = means.at(s, k, ly1, lx0) + wx * (means.at(s, k, ly1, lx1) - means.at(s, k, ly1, lx0));
+        coef[k]            = top + wy * (bottom - top);
+    }
+
+    StoreOutput<GC, C>(guide, out, guideKind, outKind, s, y, x, coef);
+}
+
+template<class Loader>
+void launchBoxColumns(const Loader &load, const Planes &sums, int numSamples, int radius, cudaStream_t stream)
+{
+    const int strip = StripLength(radius);
+
+    dim3 block(128);
+    dim3 grid(divUp(sums.width, block.x), divUp(sums.height, strip), numSamples);
+
+    boxColumns<<<grid, block, 0, stream>>>(load, sums, radius, strip);
+    checkKernelErrors();
+}
+
+template<class Store>
+void launchBoxRows(const Planes &sums, const Store &store, int numSamples, int radius, cudaStream_t stream)
+{
+    const int strip = StripLength(radius);
+
+    dim3 block(32, 8);
+    dim3 grid(divUp(sums.width, strip), divUp(sums.height, block.y), numSamples);
+
+    boxRows<<<grid, block, 0, stream>>>(sums, store, radius, strip);
+    checkKernelErrors();
+}
+
+// Runs the whole filter, the planes of the images being width x height at full resolution, the maximum size of
+// the batch for varshape inputs. The workspace must hold numSamples x (kNumInputMeans + kNumCoefs) planes of the
+// subsampled size.
+template<int GC, int C, class Rows>
+void runGuidedFilter(const Rows &guide, const Rows &in, const Rows &out, ElemKind guideKind, ElemKind inKind,
+                     int numSamples, int2 size, int radius, float eps, int factor, float *workspace,
+                     cudaStream_t stream)
+{
+    constexpr int K1 = kNumInputMeans<GC, C>;
+    constexpr int K2 = kNumCoefs<GC, C>;
+
+    const int2 low       = LowSize(size, factor);
+    const int  lowRadius = std::max(radius / factor, 1);
+
+    // the first planes hold the column sums of each pass, the others the coefficients then their means
+    Planes sums{workspace, K1, low.x, low.y};
+    Planes coefs{workspace + static_cast<int64_t>(numSamples) * K1 * low.x * low.y, K2, low.x, low.y};
+
+    launchBoxColumns(InputLoader<GC, C, Rows>{guide, in, guideKind, inKind, factor}, sums, numSamples, lowRadius,
+                     stream);
+    launchBoxRows(sums, CoefStore<GC, C, Rows>{coefs, guide, factor, eps}, numSamples, lowRadius, stream);
+
+    sums.numPlanes = K2;
+    launchBoxColumns(PlaneLoader<K2, Rows>{coefs, guide, factor}, sums, numSamples, lowRadius, stream);
+
+    if (factor == 1)
+    {
+        launchBoxRows(sums, OutputStore<GC, C, Rows>{guide, out, guideKind, inKind}, numSamples, lowRadius, stream);
+    }
+    else
+    {
+        // the coefficients aren't needed anymore, their means take their place
+        launchBoxRows(sums, PlaneStore<K2, Rows>{coefs, guide, factor}, numSamples, lowRadius, stream);
+
+        dim3 block(32, 8);
+        dim3 grid(divUp(size.x, block.x), divUp(size.y, block.y), numSamples);
+
+        upsampleCoefs<GC, C><<<grid, block, 0, stream>>>(coefs, guide, out, guideKind, inKind, factor);
+        checkKernelErrors();
+    }
+}
+
+template<class Rows>
+void GuidedFilterCaller(const Rows &guide, const Rows &in, const Rows &out, int guideChannels, int channels,
+                        ElemKind guideKind, ElemKind inKind, int numSamples, int2 size, int radius, float eps,
+                        int factor, float *workspace, cudaStream_t stream)
+{
+    typedef void (*func_t)(const Rows &guide, const Rows &in, const Rows &out, ElemKind guideKind, ElemKind inKind,
+                           int numSamples, int2 size, int radius, float eps, int factor, float *workspace,
+                           cudaStream_t stream);
+
+    // indexed by guide channels then input channels, 1 or 3
+    static const func_t funcs[2][2] = {
+        {runGuidedFilter<1, 1, Rows>, runGuidedFilter<1, 3, Rows>},
+        {runGuidedFilter<3, 1, Rows>, runGuidedFilter<3, 3, Rows>},
+    };
+
+    funcs[guideChannels / 3][channels / 3](guide, in, out, guideKind, inKind, numSamples, size, radius, eps, factor,
+                                           workspace, stream);
+}
+
+// Workspace size in bytes for the largest images and number of channels
+inline size_t WorkspaceSize(int maxBatchSize, Size2D maxSize)
+{
+    if (maxBatchSize <= 0 || maxSize.w <= 0 || maxSize.h <= 0)
+    {
+        return 0;
+    }
+    constexpr int kMaxPlanes = kNumInputMeans<3, 3> + kNumCoefs<3, 3>;
+    return static_cast<size_t>(maxBatchSize) * maxSize.w * maxSize.h * kMaxPlanes * sizeof(float);
+}
+
+} // namespace nvcv::legacy::cuda_op::guided
+
+#endif // CV_CUDA_GUIDED_FILTER_CUH
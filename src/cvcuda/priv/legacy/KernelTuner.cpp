@@ -0,0 +1,293 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "KernelTuner.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace nvcv::legacy::cuda_op {
+
+namespace {
+
+constexpr const char *kTuningCacheEnvVar = "CVCUDA_TUNING_CACHE";
+constexpr const char *kAutotuneEnvVar    = "CVCUDA_AUTOTUNE";
+
+// Timed launches of each candidate, after a warm-up launch
+constexpr int kTuningRuns = 5;
+
+} // namespace
+
+TuningKey &TuningKey::add(const ITensorDataStridedCuda &tensor)
+{
+    return add(tensor.shape(), tensor.dtype());
+}
+
+TuningKey &TuningKey::add(const TensorShape &shape, DataType dtype)
+{
+    const NVCVTensorLayout &layout = shape.layout();
+
+    std::ostringstream ss;
+    ss << ',' << std::string(layout.data, layout.rank) << ':' << std::hex << static_cast<NVCVDataType>(dtype)
+       << std::dec << ':';
+    for (int i = 0; i < shape.rank(); ++i)
+    {
+        ss << (i == 0 ? "" : "x") << shape[i];
+    }
+    m_key += ss.str();
+    return *this;
+}
+
+TuningKey &TuningKey::add(int64_t value)
+{
+    m_key += ',';
+    m_key += std::to_string(value);
+    return *this;
+}
+
+KernelTuner &KernelTuner::Instance()
+{
+    static KernelTuner tuner;
+    return tuner;
+}
+
+KernelTuner::KernelTuner()
+{
+    if (const char *path = std::getenv(kTuningCacheEnvVar))
+    {
+        m_cachePath = path;
+        // A missing file is fine, it's created when the first selection is tuned
+        loadLocked(path);
+    }
+
+    if (const char *autotune = std::getenv(kAutotuneEnvVar))
+    {
+        m_enabled = std::string(autotune) == "1";
+    }
+}
+
+void KernelTuner::setEnabled(bool enabled)
+{
+    m_enabled = enabled;
+}
+
+const std::string &KernelTuner::deviceModel(int device) const
+{
+    if (device >= static_cast<int>(m_deviceModels.size()))
+    {
+        m_deviceModels.resize(device + 1);
+    }
+
+    std::string &model = m_deviceModels[device];
+    if (model.empty())
+    {
+        cudaDeviceProp prop;
+        if (cudaGetDeviceProperties(&prop, device) == cudaSuccess)
+        {
+            model = prop.name;
+            // Keys are whitespace-separated from their selection in the cache file
+            std::replace(model.begin(), model.end(), ' ', '_');
+            model += "/sm" + std::to_string(prop.major) + std::to_string(prop.minor);
+        }
+        else
+        {
+            model = "unknown";
+        }
+    }
+    return model;
+}
+
+int KernelTuner::select(const TuningKey &key, std::initializer_list<int> candidates, int fallback,
+                        const Launcher &launch, cudaStream_t stream)
+{
+    if (candidates.size() <= 1)
+    {
+        return fallback;
+    }
+
+    int device;
+    if (cudaGetDevice(&device) != cudaSuccess)
+    {
+        return fallback;
+    }
+
+    std::string fullKey;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        fullKey = deviceModel(device) + '|' + key.str();
+
+        // Selections read from a file might not be valid for this call anymore
+        auto it = m_selections.find(fullKey);
+        if (it != m_selections.end() && std::find(candidates.begin(), candidates.end(), it->second) != candidates.end())
+        {
+            return it->second;
+        }
+    }
+
+    if (!m_enabled)
+    {
+        return fallback;
+    }
+
+    cudaStreamCaptureStatus captureStatus;
+    if (cudaStreamIsCapturing(stream, &captureStatus) != cudaSuccess || captureStatus != cudaStreamCaptureStatusNone)
+    {
+        return fallback;
+    }
+
+    cudaEvent_t start, end;
+    if (cudaEventCreate(&start) != cudaSuccess)
+    {
+        return fallback;
+    }
+    if (cudaEventCreate(&end) != cudaSuccess)
+    {
+        cudaEventDestroy(start);
+        return fallback;
+    }
+
+    int   best     = fallback;
+    float bestTime = std::numeric_limits<float>::infinity();
+    for (int variant : candidates)
+    {
+        launch(variant, stream);
+
+        cudaEventRecord(start, stream);
+        for (int i = 0; i < kTuningRuns; ++i)
+        {
+            launch(variant, stream);
+        }
+        cudaEventRecord(end, stream);
+
+        // Variants that fail to launch, e.g. because of their resource usage, aren't selected
+        float time;
+        bool  launched = cudaEventSynchronize(end) == cudaSuccess && cudaGetLastError() == cudaSuccess
+                     && cudaEventElapsedTime(&time, start, end) == cudaSuccess;
+        if (launched && time < bestTime)
+        {
+            best     = variant;
+            bestTime = time;
+        }
+    }
+
+    cudaEventDestroy(start);
+    cudaEventDestroy(end);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_selections[fullKey] = best;
+    if (bestTime < std::numeric_limits<float>::infinity())
+    {
+        m_times[fullKey] = bestTime / kTuningRuns;
+    }
+    if (!m_cachePath.empty())
+    {
+        saveLocked(m_cachePath.c_str());
+    }
+    return best;
+}
+
+bool KernelTuner::measuredTime(const TuningKey &key, float &timeMs) const
+{
+    int device;
+    if (cudaGetDevice(&device) != cudaSuccess)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_times.find(deviceModel(device) + '|' + key.str());
+    if (it == m_times.end())
+    {
+        return false;
+    }
+    timeMs = it->second;
+    return true;
+}
+
+bool KernelTuner::load(const char *path)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return loadLocked(path);
+}
+
+bool KernelTuner::save(const char *path) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return saveLocked(path);
+}
+
+bool KernelTuner::loadLocked(const char *path)
+{
+    std::ifstream in(path);
+    if (!in)
+    {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        std::istringstream ss(line);
+        std::string        key;
+        int                variant;
+        if (ss >> key >> variant)
+        {
+            m_selections[key] = variant;
+
+            // The time was added later, older files don't have it
+            float time;
+            if (ss >> time)
+            {
+                m_times[key] = time;
+            }
+        }
+    }
+    return true;
+}
+
+bool KernelTuner::saveLocked(const char *path) const
+{
+    std::ofstream out(path, std::ios::trunc);
+    if (!out)
+    {
+        return false;
+    }
+
+    out << "# CV-CUDA kernel tuning cache: <gpu model>|<selection>,<configuration> <variant> [<time ms>]\n";
+    for (const auto &[key, variant] : m_selections)
+    {
+        out << key << ' ' << variant;
+        if (auto it = m_times.find(key); it != m_times.end())
+        {
+            out << ' ' << it->second;
+        }
+        out << '\n';
+    }
+    return static_cast<bool>(out);
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file KernelTuner.hpp
+ *
+ * @brief Defines the selection of kernel variants of legacy operators, tuned per GPU model and configuration.
+ */
+
+#ifndef CV_CUDA_LEGACY_KERNEL_TUNER_HPP
+#define CV_CUDA_LEGACY_KERNEL_TUNER_HPP
+
+#include <cuda_runtime.h>
+#include <nvcv/ITensorData.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace nvcv::legacy::cuda_op {
+
+/**
+ * Key of a tuned kernel selection.
+ *
+ * It starts with the name of the selection, followed by the shape and data type of the tensors involved and
+ * the parameters the best variant depends on.  The GPU model is added by the KernelTuner.
+ */
+class TuningKey
+{
+public:
+    explicit TuningKey(const char *name)
+        : m_key(name)
+    {
+    }
+
+    TuningKey &add(const ITensorDataStridedCuda &tensor);
+    TuningKey &add(const TensorShape &shape, DataType dtype);
+    TuningKey &add(int64_t value);
+
+    const std::string &str() const
+    {
+        return m_key;
+    }
+
+private:
+    std::string m_key;
+};
+
+/**
+ * Selects the kernel variant an operator launches.
+ *
+ * Operators number the variants of a selection (kernels, block sizes, ...) and pass the ones valid for a call,
+ * along with the variant their built-in heuristic picks.  Unless the configuration was tuned on the current GPU
+ * model, the heuristic's pick is used.  When autotuning is enabled, an untuned configuration is tuned on its first
+ * call: each candidate is launched a few times on the stream and timed, and the fastest is remembered along with
+ * its time, which cost estimates use in place of their model.  Tuning
+ * synchronizes the stream and clobbers the outputs, which the operator overwrites when it launches the selected
+ * variant.  It's skipped while the stream is being captured.
+ *
+ * Tuned selections are loaded at startup from the file named by the CVCUDA_TUNING_CACHE environment variable,
+ * and new ones are saved back to it, so that each GPU model in a fleet runs its best variants once tuned.
+ * Autotuning is enabled at startup when the CVCUDA_AUTOTUNE environment variable is 1.
+ */
+class KernelTuner
+{
+public:
+    /// Launches the given variant on the given stream.
+    using Launcher = std::function<void(int variant, cudaStream_t stream)>;
+
+    static KernelTuner &Instance();
+
+    int select(const TuningKey &key, std::initializer_list<int> candidates, int fallback, const Launcher &launch,
+               cudaStream_t stream);
+
+    void setEnabled(bool enabled);
+
+    /// Gets the GPU time of one launch of the variant selected for the key on the current device, if it was tuned.
+    bool measuredTime(const TuningKey &key, float &timeMs) const;
+
+    /// Merges the selections in the file into the current ones, returns false if the file can't be read.
+    bool load(const char *path);
+
+    /// Writes the current selections to the file, returns false if it can't be written.
+    bool save(const char *path) const;
+
+private:
+    KernelTuner();
+
+    const std::string &deviceModel(int device) const;
+    bool               loadLocked(const char *path);
+    bool               saveLocked(const char *path) const;
+
+    std::atomic<bool>                m_enabled{false};
+    mutable std::mutex               m_mutex;
+    std::map<std::string, int>       m_selections;
+    std::map<std::string, float>     m_times;
+    mutable std::vector<std::string> m_deviceModels;
+    std::string                      m_cachePath;
+};
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_LEGACY_KERNEL_TUNER_HPP
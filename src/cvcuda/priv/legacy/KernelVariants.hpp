@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file KernelVariants.hpp
+ *
+ * @brief Defines which (data type, channels) variants of the legacy kernels are instantiated in the build.
+ *
+ * Operators dispatch on tables of kernels instantiated for every pixel type, e.g. uchar3, times their other
+ * template parameters.  Deployments using a few pixel types can configure the build with CVCUDA_KERNEL_VARIANTS
+ * set to a list like "U8C1;U8C3;F32C3": only the listed pixel types get their own kernels, the others run the
+ * operator's runtime-channel kernel of their base type, which reads the channels of a pixel in a loop.  By default
+ * the list is "ALL".
+ */
+
+#ifndef CV_CUDA_LEGACY_KERNEL_VARIANTS_HPP
+#define CV_CUDA_LEGACY_KERNEL_VARIANTS_HPP
+
+#include <nvcv/cuda/TypeTraits.hpp>
+
+#include <type_traits>
+
+#ifndef CVCUDA_KERNEL_VARIANTS
+#    define CVCUDA_KERNEL_VARIANTS "ALL"
+#endif
+
+namespace nvcv::legacy::cuda_op {
+
+namespace detail {
+
+template<typename BT>
+constexpr const char *KernelVariantTypeName()
+{
+    if constexpr (std::is_same_v<BT, unsigned char>)
+        return "U8";
+    else if constexpr (std::is_same_v<BT, signed char> || std::is_same_v<BT, char>)
+        return "S8";
+    else if constexpr (std::is_same_v<BT, unsigned short>)
+        return "U16";
+    else if constexpr (std::is_same_v<BT, short>)
+        return "S16";
+    else if constexpr (std::is_same_v<BT, unsigned int>)
+        return "U32";
+    else if constexpr (std::is_same_v<BT, int>)
+        return "S32";
+    else if constexpr (std::is_same_v<BT, float>)
+        return "F32";
+    else
+    {
+        static_assert(std::is_same_v<BT, double>, "Pixel type without kernel variant name");
+        return "F64";
+    }
+}
+
+// Whether list[begin, end) is the name of the type followed by C and the number of channels, or ALL.
+constexpr bool KernelVariantMatches(const char *list, int begin, int end, const char *type, int channels)
+{
+    const char all[] = "ALL";
+
+    bool isAll = end - begin == 3;
+    for (int i = 0; isAll && i < 3; ++i)
+    {
+        isAll = list[begin + i] == all[i];
+    }
+    if (isAll)
+    {
+        return true;
+    }
+
+    int i = begin;
+    for (; *type != '\0'; ++type, ++i)
+    {
+        if (i >= end || list[i] != *type)
+        {
+            return false;
+        }
+    }
+    return end - i == 2 && list[i] == 'C' && list[i + 1] == '0' + channels;
+}
+
+// Whether the ';' or ',' separated list has the variant.
+constexpr bool KernelVariantListed(const char *list, const char *type, int channels)
+{
+    int begin = 0;
+    for (int end = 0;; ++end)
+    {
+        if (list[end] == ';' || list[end] == ',' || list[end] == '\0')
+        {
+            if (KernelVariantMatches(list, begin, end, type, channels))
+            {
+                return true;
+            }
+            if (list[end] == '\0')
+            {
+                return false;
+            }
+            begin = end + 1;
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * Whether kernels are instantiated for pixels of type T.
+ *
+ * Dispatchers templated on the pixel type check it with if constexpr, so that the kernels of disabled variants
+ * aren't instantiated, and call the runtime-channel kernel of the base type instead.
+ */
+template<typename T>
+constexpr bool IsKernelVariantEnabled = detail::KernelVariantListed(
+    CVCUDA_KERNEL_VARIANTS, detail::KernelVariantTypeName<cuda::BaseType<T>>(), cuda::NumElements<T>);
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_LEGACY_KERNEL_VARIANTS_HPP
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LaunchBudget.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+
+namespace nvcv::legacy::cuda_op {
+
+namespace {
+
+constexpr const char *kLaunchBudgetEnvVar = "CVCUDA_LAUNCH_MAX_SMS";
+
+int ReadBudgetEnv()
+{
+    const char *value = std::getenv(kLaunchBudgetEnvVar);
+    return value ? std::max(0, std::atoi(value)) : 0;
+}
+
+std::atomic<int> &GlobalBudget()
+{
+    static std::atomic<int> budget{ReadBudgetEnv()};
+    return budget;
+}
+
+thread_local int g_threadBudget = -1;
+
+int CurrentDeviceSMCount()
+{
+    int device = 0, numSMs = 1;
+    cudaGetDevice(&device);
+    cudaDeviceGetAttribute(&numSMs, cudaDevAttrMultiProcessorCount, device);
+    return numSMs;
+}
+
+} // namespace
+
+void SetLaunchBudget(int maxSMs)
+{
+    GlobalBudget() = std::max(0, maxSMs);
+}
+
+void SetThreadLaunchBudget(int maxSMs)
+{
+    g_threadBudget = maxSMs;
+}
+
+int GetLaunchBudget()
+{
+    return g_threadBudget >= 0 ? g_threadBudget : GlobalBudget().load();
+}
+
+int BudgetedSMCount()
+{
+    const int numSMs = CurrentDeviceSMCount();
+    const int budget = GetLaunchBudget();
+    return budget > 0 ? std::min(budget, numSMs) : numSMs;
+}
+
+int64_t BudgetedBlockCount(dim3 block)
+{
+    const int budget = GetLaunchBudget();
+    if (budget == 0)
+    {
+        return 0;
+    }
+
+    int device = 0, maxThreadsPerSM = 2048;
+    cudaGetDevice(&device);
+    cudaDeviceGetAttribute(&maxThreadsPerSM, cudaDevAttrMaxThreadsPerMultiProcessor, device);
+
+    const int64_t blocksPerSM = std::max<int64_t>(1, maxThreadsPerSM / (block.x * block.y * block.z));
+    return std::min(budget, CurrentDeviceSMCount()) * blocksPerSM;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,57 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file LaunchBudget.hpp
+ *
+ * @brief Defines the limit on the share of the GPU the kernels of legacy operators may occupy.
+ */
+
+#ifndef CV_CUDA_LEGACY_LAUNCH_BUDGET_HPP
+#define CV_CUDA_LEGACY_LAUNCH_BUDGET_HPP
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+
+namespace nvcv::legacy::cuda_op {
+
+/**
+ * The launch budget is a number of SMs.  Kernels that support it are launched with a persistent grid of at most as
+ * many blocks as fit at full occupancy on that many SMs, and loop over their work with the stride of the grid, so
+ * that the rest of the GPU stays available to work running concurrently, e.g. inference on another stream.
+ *
+ * The budget is global, 0 meaning no limit, and can be overridden per thread.  At startup it's read from the
+ * CVCUDA_LAUNCH_MAX_SMS environment variable, if set.
+ */
+void SetLaunchBudget(int maxSMs);
+
+/// Overrides the global budget for the launches of the calling thread, a negative value follows the global one.
+void SetThreadLaunchBudget(int maxSMs);
+
+/// Budget of the launches of the calling thread, 0 if they aren't limited.
+int GetLaunchBudget();
+
+/// Number of SMs of the current device the launches of the calling thread may occupy.
+int BudgetedSMCount();
+
+/// Maximum number of blocks of the given size of a launch of the calling thread, 0 if it isn't limited.
+int64_t BudgetedBlockCount(dim3 block);
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_LEGACY_LAUNCH_BUDGET_HPP
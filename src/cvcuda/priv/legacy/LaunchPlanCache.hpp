@@ -0,0 +1,167 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file LaunchPlanCache.hpp
+ *
+ * @brief Defines a small cache of launch plans of legacy operators, keyed on the tensor configuration.
+ */
+
+#ifndef CV_CUDA_LEGACY_LAUNCH_PLAN_CACHE_HPP
+#define CV_CUDA_LEGACY_LAUNCH_PLAN_CACHE_HPP
+
+#include <nvcv/ITensorData.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+namespace nvcv::legacy::cuda_op {
+
+/**
+ * Key of a launch plan.
+ *
+ * It holds the shape, data type and layout of each tensor involved in a call, followed by the operator
+ * parameters the plan depends on.  Data pointers and strides aren't part of the key, so plans must not depend
+ * on them.  Keys that don't fit in the storage are marked invalid and never match, i.e. they're not cached.
+ */
+class LaunchPlanKey
+{
+public:
+    LaunchPlanKey &add(const ITensorDataStridedCuda &tensor)
+    {
+        const NVCVTensorData &data = tensor.cdata();
+
+        int64_t layout[2] = {};
+        static_assert(sizeof(layout) >= sizeof(data.layout.data), "layout doesn't fit in key");
+        std::memcpy(layout, data.layout.data, sizeof(data.layout.data));
+
+        add(static_cast<int64_t>(data.dtype)).add(data.rank).add(layout[0]).add(layout[1]);
+        for (int i = 0; i < data.rank; ++i)
+        {
+            add(data.shape[i]);
+        }
+        return *this;
+    }
+
+    LaunchPlanKey &add(int64_t value)
+    {
+        if (m_size < kMaxValues)
+        {
+            m_values[m_size] = value;
+        }
+        ++m_size;
+        return *this;
+    }
+
+    LaunchPlanKey &add(int32_t value)
+    {
+        return add(static_cast<int64_t>(value));
+    }
+
+    LaunchPlanKey &add(double value)
+    {
+        int64_t bits;
+        static_assert(sizeof(bits) == sizeof(value));
+        std::memcpy(&bits, &value, sizeof(bits));
+        return add(bits);
+    }
+
+    bool valid() const
+    {
+        return m_size <= kMaxValues;
+    }
+
+    bool operator==(const LaunchPlanKey &that) const
+    {
+        return valid() && m_size == that.m_size
+            && std::equal(m_values.begin(), m_values.begin() + m_size, that.m_values.begin());
+    }
+
+private:
+    static constexpr int kMaxValues = 48;
+
+    std::array<int64_t, kMaxValues> m_values;
+    int                             m_size = 0;
+};
+
+/**
+ * Cache of the launch plans of an operator, similar to FFT plans.
+ *
+ * Operators validate their arguments, derive the legacy data format and type, and select the kernel to launch
+ * into a Plan on the first call with a given configuration.  Later calls with the same LaunchPlanKey find the
+ * plan and go straight to the launch.  The cache holds a few entries, replaced in round-robin order, as an
+ * operator is usually called with a handful of different configurations.
+ *
+ * @tparam Plan Launch plan, must be copyable and default-constructible.
+ * @tparam Capacity Maximum number of cached plans.
+ */
+template<class Plan, int Capacity = 8>
+class LaunchPlanCache
+{
+public:
+    bool find(const LaunchPlanKey &key, Plan &plan) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (int i = 0; i < m_size; ++i)
+        {
+            if (m_entries[i].key == key)
+            {
+                plan = m_entries[i].plan;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void insert(const LaunchPlanKey &key, const Plan &plan)
+    {
+        if (!key.valid())
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_size < Capacity)
+        {
+            m_entries[m_size++] = {key, plan};
+        }
+        else
+        {
+            m_entries[m_next] = {key, plan};
+            m_next            = (m_next + 1) % Capacity;
+        }
+    }
+
+private:
+    struct Entry
+    {
+        LaunchPlanKey key;
+        Plan          plan;
+    };
+
+    mutable std::mutex          m_mutex;
+    std::array<Entry, Capacity> m_entries;
+    int                         m_size = 0;
+    int                         m_next = 0;
+};
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_LEGACY_LAUNCH_PLAN_CACHE_HPP
@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CV_CUDA_MEDIAN_HISTOGRAM_CUH
+#define CV_CUDA_MEDIAN_HISTOGRAM_CUH
+
+namespace nvcv::legacy::cuda_op {
+
+// Number of bins of the 8-bit histograms, the block computing a tile must have this many threads.
+constexpr int kMedianHistogramBins = 256;
+
+// Kernel area from which the histogram median is faster than the selection-based ones.
+constexpr int kMedianHistogramMinArea = 11 * 11;
+
+/**
+ * Compute the median filter of an 8-bit tile in constant time per pixel.
+ *
+ * This follows Perreault and Hebert, "Median Filtering in Constant Time": one histogram per column of the tile
+ * (plus the horizontal halo) is kept in shared memory and slid down one row at a time, adding one pixel and
+ * removing another.  The kernel histogram of a row is slid horizontally from one output to the next by adding
+ * and subtracting whole column histograms.  Each of the 256 threads of the block owns one bin, the median bin
+ * is found with a block-wide prefix sum over the bins.
+ *
+ * All threads of the block must call this function with the same arguments.
+ *
+ * @param colHist Shared memory with (tileW + kWidth - 1) * 256 counters.
+ * @param tileX, tileY Top-left output pixel of the tile.
+ * @param tileW, tileH Size of the tile, clipped to the image size.
+ * @param w, h Image size.
+ * @param kWidth, kHeight Odd kernel size.
+ * @param fetch Functor fetch(gx, gy) returning the pixel at any coordinate, with borders replicated.
+ * @param store Functor store(x, y, value) writing the output pixel.
+ */
+template<class Fetch, class Store>
+__device__ void MedianHistogramTile(unsigned short *colHist, int tileX, int tileY, int tileW, int tileH, int w,
+                                    int h, int kWidth, int kHeight, Fetch fetch, Store store)
+{
+    __shared__ int warpSums[kMedianHistogramBins / 32];
+
+    const int bin  = threadIdx.y * blockDim.x + threadIdx.x;
+    const int lane = bin % 32;
+    const int warp = bin / 32;
+
+    const int numCols = tileW + kWidth - 1;
+    const int rx      = kWidth / 2;
+    const int ry      = kHeight / 2;
+    const int k       = (kWidth * kHeight) / 2;
+
+    const int xCount = min(tileW, w - tileX);
+    const int yEnd   = min(tileY + tileH, h);
+
+    if (xCount <= 0 || tileY >= h)
+    {
+        return;
+    }
+
+    for (int i = bin; i < numCols * kMedianHistogramBins; i += kMedianHistogramBins)
+    {
+        colHist[i] = 0;
+    }
+    __syncthreads();
+
+    for (int c = bin; c < numCols; c += kMedianHistogramBins)
+    {
+        for (int dy = -ry; dy <= ry; ++dy)
+        {
+            colHist[c * kMedianHistogramBins + fetch(tileX - rx + c, tileY + dy)]++;
+        }
+    }
+    __syncthreads();
+
+    for (int y = tileY; y < yEnd; ++y)
+    {
+        if (y > tileY)
+        {
+            // slide the column histograms down one row
+            for (int c = bin; c < numCols; c += kMedianHistogramBins)
+            {
+                unsigned char out = fetch(tileX - rx + c, y - ry - 1);
+                unsigned char in  = fetch(tileX - rx + c, y + ry);
+
+                colHist[c * kMedianHistogramBins + out]--;
+                colHist[c * kMedianHistogramBins + in]++;
+            }
+            __syncthreads();
+        }
+
+        int count = 0;
+        for (int c = 0; c < kWidth; ++c)
+        {
+            count += colHist[c * kMedianHistogramBins + bin];
+        }
+
+        for (int ox = 0; ox < xCount; ++ox)
+        {
+            if (ox > 0)
+            {
+                // slide the kernel histogram right one column
+                count += colHist[(ox + kWidth - 1) * kMedianHistogramBins + bin]
+                       - colHist[(ox - 1) * kMedianHistogramBins + bin];
+            }
+
+            int incl = count;
+#pragma unroll
+            for (int d = 1; d < 32; d *= 2)
+            {
+                int n = __shfl_up_sync(0xFFFFFFFF, incl, d);
+                if (lane >= d)
+                {
+                    incl += n;
+                }
+            }
+
+            if (lane == 31)
+            {
+                warpSums[warp] = incl;
+            }
+            __syncthreads();
+
+            for (int i = 0; i < warp; ++i)
+            {
+                incl += warpSums[i];
+            }
+
+            if (incl - count <= k && k < incl)
+            {
+                store(tileX + ox, y, static_cast<unsigned char>(bin));
+            }
+            __syncthreads();
+        }
+    }
+}
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_MEDIAN_HISTOGRAM_CUH
@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file NormalizeUtils.cuh
+ *
+ * @brief Normalization parameters shared by the fused ResizeNormalizeReformat and PadAndStack operators.
+ */
+
+#ifndef CV_CUDA_NORMALIZE_UTILS_CUH
+#define CV_CUDA_NORMALIZE_UTILS_CUH
+
+#include "CvCudaLegacy.h"
+#include "CvCudaUtils.cuh"
+
+#include <cvcuda/OpNormalize.h> // for CVCUDA_NORMALIZE_SCALE_IS_STDDEV
+#include <nvcv/cuda/MathWrappers.hpp>
+
+namespace nvcv::legacy::cuda_op {
+
+// Per-channel normalization parameters, optionally per sample too.
+struct NormParams
+{
+    cuda::Tensor2DWrap<const float> base, scale;
+
+    // x: number of channels, y: number of samples, either 1 or the same as the data.
+    int2 baseSize, scaleSize;
+
+    float globalScale, shift, epsilon;
+    bool  scaleIsStdDev;
+};
+
+inline __device__ float NormalizeValue(const NormParams &p, float value, int sample, int ch)
+{
+    float base  = *p.base.ptr(p.baseSize.y == 1 ? 0 : sample, p.baseSize.x == 1 ? 0 : ch);
+    float scale = *p.scale.ptr(p.scaleSize.y == 1 ? 0 : sample, p.scaleSize.x == 1 ? 0 : ch);
+
+    if (p.scaleIsStdDev)
+    {
+        scale = 1.0f / cuda::sqrt(scale * scale + p.epsilon);
+    }
+
+    return (value - base) * scale * p.globalScale + p.shift;
+}
+
+// Checks a base or scale tensor of shape [1 or N, 1, 1, 1 or C], and returns its number of channels and samples.
+inline ErrorCode ValidateNormParam(const char *name, const ITensorDataStridedCuda &paramData, int numSamples,
+                                   int channels, int2 &paramSize)
+{
+    if (paramData.dtype() != TYPE_F32)
+    {
+        LOG_ERROR("Invalid " << name << " DataType " << paramData.dtype() << ", it must be float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto access = TensorDataAccessStridedImagePlanar::Create(paramData);
+    if (!access)
+    {
+        LOG_ERROR("Invalid " << name << " DataFormat");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (access->numRows() != 1 || access->numCols() != 1
+        || (access->numSamples() != 1 && access->numSamples() != numSamples)
+        || (access->numChannels() != 1 && access->numChannels() != channels))
+    {
+        LOG_ERROR("Invalid " << name << " shape " << paramData.shape()
+                             << ", it must be [1 or N, 1, 1, 1 or C], with N=" << numSamples << " and C=" << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (access->numChannels() > 1 && access->colStride() != channels * static_cast<int64_t>(sizeof(float)))
+    {
+        LOG_ERROR("Invalid " << name << " layout, channels must be packed");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    paramSize = int2{static_cast<int>(access->numChannels()), static_cast<int>(access->numSamples())};
+    return ErrorCode::SUCCESS;
+}
+
+inline NormParams CreateNormParams(const ITensorDataStridedCuda &baseData, int2 baseSize,
+                                   const ITensorDataStridedCuda &scaleData, int2 scaleSize, float global_scale,
+                                   float shift, float epsilon, uint32_t flags)
+{
+    NormParams p;
+    p.base          = cuda::Tensor2DWrap<const float>(baseData.basePtr(), static_cast<int>(baseData.stride(0)));
+    p.scale         = cuda::Tensor2DWrap<const float>(scaleData.basePtr(), static_cast<int>(scaleData.stride(0)));
+    p.baseSize      = baseSize;
+    p.scaleSize     = scaleSize;
+    p.globalScale   = global_scale;
+    p.shift         = shift;
+    p.epsilon       = epsilon;
+    p.scaleIsStdDev = (flags & CVCUDA_NORMALIZE_SCALE_IS_STDDEV) != 0;
+    return p;
+}
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_NORMALIZE_UTILS_CUH
@@ -0,0 +1,61 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Precision.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+namespace nvcv::legacy::cuda_op {
+
+namespace {
+
+constexpr const char *kPrecisionEnvVar = "CVCUDA_PRECISION";
+
+NVCVPrecisionMode ReadPrecisionEnv()
+{
+    const char *value = std::getenv(kPrecisionEnvVar);
+    return value && std::strcmp(value, "fast") == 0 ? NVCV_PRECISION_FAST : NVCV_PRECISION_ACCURATE;
+}
+
+std::atomic<NVCVPrecisionMode> &GlobalMode()
+{
+    static std::atomic<NVCVPrecisionMode> mode{ReadPrecisionEnv()};
+    return mode;
+}
+
+thread_local NVCVPrecisionMode g_threadMode = NVCV_PRECISION_INHERIT;
+
+} // namespace
+
+void SetPrecisionMode(NVCVPrecisionMode mode)
+{
+    GlobalMode() = mode;
+}
+
+void SetThreadPrecisionMode(NVCVPrecisionMode mode)
+{
+    g_threadMode = mode;
+}
+
+NVCVPrecisionMode GetPrecisionMode()
+{
+    return g_threadMode != NVCV_PRECISION_INHERIT ? g_threadMode : GlobalMode().load();
+}
+
+} // namespace nvcv::legacy::cuda_op
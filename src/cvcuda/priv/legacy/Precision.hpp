@@ -0,0 +1,54 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Precision.hpp
+ *
+ * @brief Defines the precision mode selecting the math of the kernels of legacy operators.
+ */
+
+#ifndef CV_CUDA_LEGACY_PRECISION_HPP
+#define CV_CUDA_LEGACY_PRECISION_HPP
+
+#include <cvcuda/Types.h>
+
+namespace nvcv::legacy::cuda_op {
+
+/**
+ * Kernels that support the fast mode are instantiated for both modes, and their launchers pick the instantiation
+ * with UseFastMath().  See ExpF, DivF and RsqrtF in CvCudaUtils.cuh.
+ *
+ * The mode is global and can be overridden per thread.  At startup it's read from the CVCUDA_PRECISION environment
+ * variable, if set.
+ */
+void SetPrecisionMode(NVCVPrecisionMode mode);
+
+/// Overrides the global mode for the launches of the calling thread, NVCV_PRECISION_INHERIT follows the global one.
+void SetThreadPrecisionMode(NVCVPrecisionMode mode);
+
+/// Mode of the launches of the calling thread.
+NVCVPrecisionMode GetPrecisionMode();
+
+/// Whether the launches of the calling thread use the fast math.
+inline bool UseFastMath()
+{
+    return GetPrecisionMode() == NVCV_PRECISION_FAST;
+}
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_LEGACY_PRECISION_HPP
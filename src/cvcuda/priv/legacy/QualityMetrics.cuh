@@ -0,0 +1,236 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file QualityMetrics.cuh
+ *
+ * @brief Parameter checks and per-sample score reduction shared by the PSNR and SSIM operators, whose sums
+ *        are also used by Sharpness.
+ */
+
+#ifndef CV_CUDA_QUALITY_METRICS_CUH
+#define CV_CUDA_QUALITY_METRICS_CUH
+
+#include "CvCudaLegacyHelpers.hpp"
+#include "CvCudaUtils.cuh"
+#include "ReduceUtils.cuh"
+
+#include <cmath>
+
+namespace nvcv::legacy::cuda_op::quality {
+
+// Per-channel sums of the values of a thread, a block or a sample
+template<int NC>
+struct ChannelSums
+{
+    float val[NC];
+};
+
+template<int NC>
+struct SumCombine
+{
+    __device__ ChannelSums<NC> operator()(ChannelSums<NC> a, const ChannelSums<NC> &b) const
+    {
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            a.val[c] += b.val[c];
+        }
+        return a;
+    }
+};
+
+// Partial sums of the blocks of all samples, one float per channel
+constexpr size_t kWorkspaceSize = kMaxReduceBlocks * sizeof(ChannelSums<4>);
+
+// Writes the scores of a sample from the sums of its count values per channel. A single score is the one of the
+// sums of all channels, e.g. of the mean squared error of all values for PSNR.
+template<class Metric, int NC>
+__device__ void WriteScores(const ChannelSums<NC> &v, const Metric &metric, float count, float *out, int outChannels)
+{
+    if (outChannels == 1)
+    {
+        float sum = v.val[0];
+#pragma unroll
+        for (int c = 1; c < NC; ++c)
+        {
+            sum += v.val[c];
+        }
+        out[0] = metric(sum, count * NC);
+    }
+    else
+    {
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            out[c] = metric(v.val[c], count);
+        }
+    }
+}
+
+// Reduces the partial sums of the sample's blocks with a single warp, blockIdx.x is the sample.
+template<class Metric, int NC>
+__global__ void FinalScoresKernel(const ChannelSums<NC> *partials, int numBlocks, nvcv::cuda::Tensor3DWrap<float> dst,
+                                  Metric metric, float count, int outChannels)
+{
+    const int sample = blockIdx.x;
+
+    ChannelSums<NC> v = ReducePartials(partials + sample * numBlocks, numBlocks, SumCombine<NC>());
+
+    if (threadIdx.x == 0)
+    {
+        WriteScores(v, metric, count, dst.ptr(sample, 0, 0), outChannels);
+    }
+}
+
+// Block sums of a gridDim.x x numBlocks grid: a single block writes the scores of its sample directly, otherwise each
+// block writes its partial sums for FinalScoresKernel.
+template<class Metric, int NC>
+__device__ void StoreBlockSums(const ChannelSums<NC> &v, ChannelSums<NC> *partials,
+                               nvcv::cuda::Tensor3DWrap<float> dst, const Metric &metric, float count,
+                               int outChannels)
+{
+    if (get_lid() != 0)
+    {
+        return;
+    }
+
+    if (gridDim.y == 1)
+    {
+        WriteScores(v, metric, count, dst.ptr(static_cast<int>(blockIdx.x), 0, 0), outChannels);
+    }
+    else
+    {
+        partials[blockIdx.x * gridDim.y + blockIdx.y] = v;
+    }
+}
+
+template<class Metric, int NC>
+void LaunchFinalScores(const ChannelSums<NC> *partials, int numSamples, int numBlocks,
+                       nvcv::cuda::Tensor3DWrap<float> dst, const Metric &metric, float count, int outChannels,
+                       cudaStream_t stream)
+{
+    if (numBlocks > 1)
+    {
+        FinalScoresKernel<<<numSamples, 32, 0, stream>>>(partials, numBlocks, dst, metric, count, outChannels);
+        checkKernelErrors();
+    }
+}
+
+// Peak value of a data type, used when no maximum value is given.
+inline float DataTypeRange(DataType dtype)
+{
+    switch (dtype)
+    {
+    case kCV_8U:
+        return 255.f;
+    case kCV_16U:
+        return 65535.f;
+    case kCV_16S:
+        return 32767.f;
+    default:
+        return 1.f;
+    }
+}
+
+/**
+ * Checks the two compared tensors and the scores tensor, and returns the data type and the number of channels and
+ * of output channels. The inputs must have the same shape and at least minSize x minSize pixels.
+ */
+inline ErrorCode CheckParams(const ITensorDataStridedCuda &inData1, const ITensorDataStridedCuda &inData2,
+                             const ITensorDataStridedCuda &outData, float maxValue, int minSize, DataType &dtype,
+                             int &channels, int &outChannels)
+{
+    for (const ITensorDataStridedCuda *data : {&inData1, &inData2})
+    {
+        DataFormat format = helpers::GetLegacyDataFormat(data->layout());
+        if (!(format == kNHWC || format == kHWC))
+        {
+            LOG_ERROR("Invalid input DataFormat " << format);
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+    }
+
+    if (inData1.shape() != inData2.shape() || inData1.dtype() != inData2.dtype())
+    {
+        LOG_ERROR("Invalid inputs of shapes " << inData1.shape() << " and " << inData2.shape() << ", types "
+                                              << inData1.dtype() << " and " << inData2.dtype()
+                                              << ", they must be the same");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    dtype = helpers::GetLegacyDataType(inData1.dtype());
+    if (!(dtype == kCV_8U || dtype == kCV_16U || dtype == kCV_16S || dtype == kCV_32F))
+    {
+        LOG_ERROR("Invalid input DataType " << inData1.dtype() << ", it must be uint8, uint16, int16 or float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData1);
+    NVCV_ASSERT(inAccess);
+
+    channels = inAccess->numChannels();
+    if (channels != 1 && channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid input channel number " << channels << ", it must be 1, 3 or 4");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (inAccess->numCols() < minSize || inAccess->numRows() < minSize)
+    {
+        LOG_ERROR("Invalid input shape " << inData1.shape() << ", images must have at least " << minSize << "x"
+                                         << minSize << " pixels");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (!(maxValue >= 0 && std::isfinite(maxValue)))
+    {
+        LOG_ERROR("Invalid maximum value " << maxValue << ", it must be positive, or 0 for the data type range");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    DataFormat outFormat = helpers::GetLegacyDataFormat(outData.layout());
+    if (!(outFormat == kNHWC || outFormat == kHWC))
+    {
+        LOG_ERROR("Invalid output DataFormat " << outFormat);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (outData.dtype() != nvcv::TYPE_F32)
+    {
+        LOG_ERROR("Invalid output DataType " << outData.dtype() << ", it must be float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    outChannels = outAccess->numChannels();
+    if (outAccess->numSamples() != inAccess->numSamples() || outAccess->numRows() != 1 || outAccess->numCols() != 1
+        || (outChannels != 1 && outChannels != channels))
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must have " << inAccess->numSamples()
+                                          << " samples of 1x1 pixels with 1 or " << channels << " channels");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op::quality
+
+#endif // CV_CUDA_QUALITY_METRICS_CUH
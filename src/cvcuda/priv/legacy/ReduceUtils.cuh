@@ -0,0 +1,258 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file ReduceUtils.cuh
+ *
+ * @brief Segment access and block reductions shared by the Reduce, Histogram, MinMaxLoc, TopK, NMS, PSNR, SSIM and
+ *        Sharpness operators.
+ */
+
+#ifndef CV_CUDA_REDUCE_UTILS_CUH
+#define CV_CUDA_REDUCE_UTILS_CUH
+
+#include "CvCudaUtils.cuh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace nvcv::legacy::cuda_op {
+
+// Segments are reduced by blocks of kReduceBlockW x kReduceBlockH threads.  The rows of a segment are split among
+// several blocks when there are few segments, as long as there are at most kMaxReduceBlocks blocks in total, so
+// that their partial results fit in the operator workspace.
+constexpr int kReduceBlockW    = 32;
+constexpr int kReduceBlockH    = 8;
+constexpr int kMaxReduceBlocks = 1024;
+
+inline int NumReduceBlocks(int num_segments, int max_rows)
+{
+    return std::min(divUp(max_rows, kReduceBlockH), std::max(1, kMaxReduceBlocks / num_segments));
+}
+
+/**
+ * Segments of a tensor reduced independently.
+ *
+ * Each sample of an interleaved tensor is a segment.  The planes of a planar tensor are either segments by
+ * themselves, or all the planes of a sample form a segment whose rows are the rows of each plane in turn.
+ */
+template<typename T>
+struct TensorSegments
+{
+    using value_type = T;
+
+    TensorSegments(const TensorDataAccessStridedImagePlanar &access, bool segmentPerPlane)
+        : data(access.sampleData(0))
+        , sampleStride(access.sampleStride())
+        , planeStride(access.numPlanes() > 1 ? access.planeStride() : 0)
+        , rowStride(access.rowStride())
+        , height(access.numRows())
+        , width(access.numCols())
+        , segmentsPerSample(segmentPerPlane ? access.numPlanes() : 1)
+        , planesPerSegment(segmentPerPlane ? 1 : access.numPlanes())
+    {
+    }
+
+    __host__ __device__ int numSegments(int numSamples) const
+    {
+        return numSamples * segmentsPerSample;
+    }
+
+    __device__ int numRows(int s) const
+    {
+        return height * planesPerSegment;
+    }
+
+    __device__ int numCols(int s) const
+    {
+        return width;
+    }
+
+    __device__ const T *row(int s, int r) const
+    {
+        int n = s / segmentsPerSample;
+        int p = (s % segmentsPerSample) * planesPerSegment + r / height;
+        return reinterpret_cast<const T *>(data + n * sampleStride + p * planeStride + (r % height) * rowStride);
+    }
+
+    // Sample and first channel of the reduced values of segment s in the output
+    __device__ int sample(int s) const
+    {
+        return s / segmentsPerSample;
+    }
+
+    __device__ int channel(int s) const
+    {
+        return (s % segmentsPerSample) * nvcv::cuda::NumElements<T>;
+    }
+
+    const Byte *data;
+    int64_t     sampleStride, planeStride, rowStride;
+    int         height, width;
+    int         segmentsPerSample, planesPerSegment;
+};
+
+// Segments of a varshape batch, one per image.
+template<typename T>
+struct VarShapeSegments
+{
+    using value_type = T;
+
+    VarShapeSegments(const IImageBatchVarShapeDataStridedCuda &data)
+        : ptr(data)
+    {
+    }
+
+    __device__ int numRows(int s) const
+    {
+        return ptr.at_rows(s);
+    }
+
+    __device__ int numCols(int s) const
+    {
+        return ptr.at_cols(s);
+    }
+
+    __device__ const T *row(int s, int r) const
+    {
+        return ptr.ptr(s, r, 0);
+    }
+
+    __device__ int sample(int s) const
+    {
+        return s;
+    }
+
+    __device__ int channel(int s) const
+    {
+        return 0;
+    }
+
+    Ptr2dVarShapeNHWC<T> ptr;
+};
+
+// Shuffles any trivially copyable value made of 32-bit words down the warp.
+template<class V>
+__device__ V ShuffleDown(const V &v, int offset)
+{
+    static_assert(sizeof(V) % sizeof(int) == 0, "value must be made of 32-bit words");
+    constexpr int kWords = sizeof(V) / sizeof(int);
+
+    int words[kWords];
+    memcpy(words, &v, sizeof(V));
+#pragma unroll
+    for (int i = 0; i < kWords; ++i)
+    {
+        words[i] = __shfl_down_sync(0xFFFFFFFF, words[i], offset);
+    }
+
+    V res;
+    memcpy(&res, words, sizeof(V));
+    return res;
+}
+
+template<class V, class Combine>
+__device__ V WarpReduce(V v, Combine combine)
+{
+#pragma unroll
+    for (int offset = 16; offset > 0; offset /= 2)
+    {
+        v = combine(v, ShuffleDown(v, offset));
+    }
+    return v;
+}
+
+// Reduces the values of a block of kReduceBlockW x kReduceBlockH threads, the result is valid in thread 0 only.
+// Values are combined in a fixed order, so results don't change from one run to the next.
+template<class V, class Combine>
+__device__ V BlockReduce(V v, Combine combine)
+{
+    constexpr int kNumWarps = kReduceBlockW * kReduceBlockH / 32;
+
+    __shared__ V warp_values[kNumWarps];
+
+    v = WarpReduce(v, combine);
+
+    const int lid = get_lid();
+    if (lid % 32 == 0)
+    {
+        warp_values[lid / 32] = v;
+    }
+    __syncthreads();
+
+    if (lid == 0)
+    {
+        for (int w = 1; w < kNumWarps; ++w)
+        {
+            v = combine(v, warp_values[w]);
+        }
+    }
+    return v;
+}
+
+// Score of an element, ranked by decreasing score, then increasing index, so that each score has a single rank.
+struct ScoreCandidate
+{
+    float value;
+    int   index; // negative when there's no candidate
+};
+
+__device__ __forceinline__ bool RanksBefore(const ScoreCandidate &a, const ScoreCandidate &b)
+{
+    return b.index < 0 || (a.index >= 0 && (a.value > b.value || (a.value == b.value && a.index < b.index)));
+}
+
+struct FirstRanked
+{
+    __device__ ScoreCandidate operator()(const ScoreCandidate &a, const ScoreCandidate &b) const
+    {
+        return RanksBefore(b, a) ? b : a;
+    }
+};
+
+// Reduces the num_blocks > 0 partial results of a segment with a single warp, the result is valid in lane 0 only.
+template<class V, class Combine>
+__device__ V ReducePartials(const V *partials, int num_blocks, Combine combine)
+{
+    __shared__ V lane_values[32];
+
+    const int lane = threadIdx.x;
+    if (lane < num_blocks)
+    {
+        V v = partials[lane];
+        for (int b = lane + 32; b < num_blocks; b += 32)
+        {
+            v = combine(v, partials[b]);
+        }
+        lane_values[lane] = v;
+    }
+    __syncwarp();
+
+    V v = lane_values[0];
+    if (lane == 0)
+    {
+        for (int l = 1; l < min(num_blocks, 32); ++l)
+        {
+            v = combine(v, lane_values[l]);
+        }
+    }
+    return v;
+}
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_REDUCE_UTILS_CUH
@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CV_CUDA_SOBEL_KERNELS_CUH
+#define CV_CUDA_SOBEL_KERNELS_CUH
+
+#include <nvcv/cuda/MathOps.hpp>
+#include <nvcv/cuda/StaticCast.hpp>
+#include <nvcv/cuda/TypeTraits.hpp>
+#include <nvcv/cuda/math/LinAlg.hpp>
+
+namespace nvcv::legacy::cuda_op {
+
+// Largest aperture of the Sobel filters.
+constexpr int kSobelMaxSize = 7;
+
+// ksize of the 3x3 Scharr filters, as in OpenCV.
+constexpr int kScharrSize = -1;
+
+/**
+ * 1D kernels of a Sobel or Scharr derivative.
+ *
+ * The x derivative is the outer product of the smooth column and the deriv row, and the y derivative the outer
+ * product of the deriv column and the smooth row, so both are computed with the same taps.
+ */
+struct SobelKernels
+{
+    cuda::math::Vector<float, kSobelMaxSize> deriv;
+    cuda::math::Vector<float, kSobelMaxSize> smooth;
+
+    int size;
+};
+
+inline bool IsValidSobelSize(int ksize)
+{
+    return ksize == kScharrSize || ksize == 1 || ksize == 3 || ksize == 5 || ksize == 7;
+}
+
+/**
+ * Compute the 1D kernels of the OpenCV Sobel filter of size ksize, or the Scharr filter for kScharrSize.
+ *
+ * The smooth kernel is the binomial of size ksize and the deriv kernel the binomial of size ksize - 1 convolved
+ * with [-1, 1]. ksize 1 is the 3-tap derivative without smoothing. The scale is folded in the smooth kernel.
+ */
+inline SobelKernels GetSobelKernels(int ksize, float scale)
+{
+    SobelKernels k{};
+
+    if (ksize == kScharrSize)
+    {
+        k.size   = 3;
+        k.deriv  = {-1.f, 0.f, 1.f};
+        k.smooth = {3.f, 10.f, 3.f};
+    }
+    else if (ksize == 1)
+    {
+        k.size   = 3;
+        k.deriv  = {-1.f, 0.f, 1.f};
+        k.smooth = {0.f, 1.f, 0.f};
+    }
+    else
+    {
+        k.size = ksize;
+
+        // row of the Pascal triangle, the binomial of size n is in its first n elements
+        float binomial[kSobelMaxSize] = {1.f};
+
+        auto nextRow = [&binomial](int n)
+        {
+            for (int i = n - 1; i > 0; --i)
+            {
+                binomial[i] += binomial[i - 1];
+            }
+        };
+
+        for (int n = 2; n < ksize; ++n)
+        {
+            nextRow(n);
+        }
+        for (int i = 0; i < ksize; ++i)
+        {
+            // applied as a correlation, so the [-1, 1] difference is the right tap minus the left one
+            k.deriv[i] = (i > 0 ? binomial[i - 1] : 0.f) - (i < ksize - 1 ? binomial[i] : 0.f);
+        }
+
+        nextRow(ksize);
+        for (int i = 0; i < ksize; ++i)
+        {
+            k.smooth[i] = binomial[i];
+        }
+    }
+
+    for (int i = 0; i < k.size; ++i)
+    {
+        k.smooth[i] *= scale;
+    }
+
+    return k;
+}
+
+/**
+ * Compute the x and y derivatives at coord in a single pass over the size x size window centered on it.
+ *
+ * @param src Wrapper of the input, read at every tap of the window.
+ * @param coord Coordinates (x, y, sample) of the output pixel.
+ * @param k 1D kernels of the derivative.
+ * @param gx Where the x derivative is written to.
+ * @param gy Where the y derivative is written to.
+ */
+template<int KSize, class SrcWrapper, typename W>
+__device__ inline void SobelGradient(const SrcWrapper &src, int3 coord, const SobelKernels &k, W &gx, W &gy)
+{
+    constexpr int kRadius = KSize / 2;
+
+    gx = cuda::SetAll<W>(0);
+    gy = cuda::SetAll<W>(0);
+
+    const int x = coord.x;
+    const int y = coord.y;
+
+#pragma unroll
+    for (int i = 0; i < KSize; ++i)
+    {
+        coord.y = y - kRadius + i;
+
+        W rowDeriv  = cuda::SetAll<W>(0);
+        W rowSmooth = cuda::SetAll<W>(0);
+
+#pragma unroll
+        for (int j = 0; j < KSize; ++j)
+        {
+            coord.x = x - kRadius + j;
+
+            const W v = cuda::StaticCast<float>(src[coord]);
+
+            rowDeriv  += v * k.deriv[j];
+            rowSmooth += v * k.smooth[j];
+        }
+
+        gx += rowDeriv * k.smooth[i];
+        gy += rowSmooth * k.deriv[i];
+    }
+}
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_SOBEL_KERNELS_CUH
@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CV_CUDA_STENCIL_REGIONS_CUH
+#define CV_CUDA_STENCIL_REGIONS_CUH
+
+#include <nvcv/Size.hpp>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace nvcv::legacy::cuda_op {
+
+// Rectangle of output pixels processed by one launch of a stencil kernel.
+struct StencilRegion
+{
+    int2   offset;
+    Size2D size;
+};
+
+/**
+ * Split the launch of a stencil kernel in its interior and border regions.
+ *
+ * The taps of the stencil span [windowMin, windowMax] around each output pixel. In the interior every tap falls
+ * inside the srcSize input, so it is launched as launch(std::true_type{}, region) and the kernel can read the
+ * input through the plain TensorWrap of its BorderWrap. The up to four strips around it, top and bottom of full
+ * width and left and right in between, are launched as launch(std::false_type{}, region) and keep the border
+ * handling. Empty regions are not launched.
+ *
+ * @param dstSize Size of the output covered by all regions.
+ * @param srcSize Size of the input read by the stencil.
+ * @param windowMin Offset of the first tap relative to the output pixel, usually -anchor.
+ * @param windowMax Offset of the last tap relative to the output pixel, usually kernelSize - 1 - anchor.
+ * @param launch Callable launching the kernel over one region.
+ */
+template<class Launch>
+inline void LaunchStencilRegions(Size2D dstSize, Size2D srcSize, int2 windowMin, int2 windowMax, Launch &&launch)
+{
+    // the interior [x0, x1) x [y0, y1) has all x + windowMin.x >= 0 and x + windowMax.x < srcSize.w, same for y
+    const int x0 = std::clamp(-windowMin.x, 0, dstSize.w);
+    const int x1 = std::clamp(srcSize.w - windowMax.x, x0, dstSize.w);
+    const int y0 = std::clamp(-windowMin.y, 0, dstSize.h);
+    const int y1 = std::clamp(srcSize.h - windowMax.y, y0, dstSize.h);
+
+    auto launchRegion = [&launch](auto interior, int x, int y, int w, int h)
+    {
+        if (w > 0 && h > 0)
+        {
+            launch(interior, StencilRegion{int2{x, y}, Size2D{w, h}});
+        }
+    };
+
+    launchRegion(std::true_type{}, x0, y0, x1 - x0, y1 - y0);
+    launchRegion(std::false_type{}, 0, 0, dstSize.w, y0);
+    launchRegion(std::false_type{}, 0, y1, dstSize.w, dstSize.h - y1);
+    launchRegion(std::false_type{}, 0, y0, x0, y1 - y0);
+    launchRegion(std::false_type{}, x1, y0, dstSize.w - x1, y1 - y0);
+}
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_STENCIL_REGIONS_CUH
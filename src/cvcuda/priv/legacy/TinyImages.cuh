@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CV_CUDA_TINY_IMAGES_CUH
+#define CV_CUDA_TINY_IMAGES_CUH
+
+#include "LaunchBudget.hpp"
+
+#include <cuda_runtime.h>
+#include <nvcv/Size.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace nvcv::legacy::cuda_op {
+
+// Largest number of pixels of the images of batches processed by tinyImagesKernel, 64x64.
+constexpr int kTinyImageMaxArea = 64 * 64;
+
+// Threads of the blocks of tinyImagesKernel, they hold several groups of warps, one image each.
+constexpr int kTinyImagesBlockSize = 256;
+
+/**
+ * Kernel running a per-pixel functor over the images of a varshape batch of tiny images.
+ *
+ * With one image per grid z and blocks sized for the usual 2D tiles, a batch of e.g. 16x16 images leaves most
+ * threads of each block without a pixel, and launches as many small blocks as there are images.  Here each group of
+ * groupSize threads, a whole number of warps, takes an image at a time: it reads the size of the image once from the
+ * batch descriptors, then its threads go over the pixels of the image in row-major order, so that consecutive lanes
+ * access consecutive pixels even across rows.  The blocks hold kTinyImagesBlockSize / groupSize images, and loop over
+ * the batch with the stride of the grid.
+ *
+ * @param op Functor with a __device__ operator()(int batch_idx, int x, int y), called once per pixel of the images.
+ * @param sizes Wrapper with the size of the images, e.g. the output ImageBatchVarShapeWrap.
+ * @param numImages Number of images in the batch.
+ * @param groupSize Threads processing each image, a multiple of 32 dividing the block size.
+ */
+template<class PixelOp, class SizeWrapper>
+__global__ void tinyImagesKernel(const PixelOp op, const SizeWrapper sizes, int numImages, int groupSize)
+{
+    const int groupsPerBlock = blockDim.x / groupSize;
+    const int lane           = threadIdx.x % groupSize;
+
+    for (int i = blockIdx.x * groupsPerBlock + threadIdx.x / groupSize; i < numImages; i += gridDim.x * groupsPerBlock)
+    {
+        const int width     = sizes.width(i);
+        const int numPixels = width * sizes.height(i);
+
+        for (int p = lane; p < numPixels; p += groupSize)
+        {
+            op(i, p % width, p / width);
+        }
+    }
+}
+
+/// Whether the images of a batch whose largest image has this size are processed faster by tinyImagesKernel.
+inline bool IsTinyBatch(int numImages, Size2D maxSize)
+{
+    return numImages > 0 && maxSize.w > 0 && maxSize.h > 0
+        && static_cast<int64_t>(maxSize.w) * maxSize.h <= kTinyImageMaxArea;
+}
+
+/// Launches tinyImagesKernel with a warp per image up to 32x32 pixels, and two or four warps for larger ones.  The
+/// grid covers the batch, or what the launch budget allows.
+template<class PixelOp, class SizeWrapper>
+void LaunchTinyImages(const PixelOp &op, const SizeWrapper &sizes, int numImages, Size2D maxSize, cudaStream_t stream)
+{
+    const int maxArea   = maxSize.w * maxSize.h;
+    const int groupSize = maxArea <= 32 * 32 ? 32 : (maxArea <= 2 * 32 * 32 ? 64 : 128);
+
+    const dim3 block(kTinyImagesBlockSize);
+    const int  groupsPerBlock = kTinyImagesBlockSize / groupSize;
+
+    int64_t numBlocks = (numImages + groupsPerBlock - 1) / groupsPerBlock;
+    if (int64_t budget = BudgetedBlockCount(block); budget > 0)
+    {
+        numBlocks = std::min(numBlocks, budget);
+    }
+
+    tinyImagesKernel<<<static_cast<int>(numBlocks), block, 0, stream>>>(op, sizes, numImages, groupSize);
+}
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_TINY_IMAGES_CUH
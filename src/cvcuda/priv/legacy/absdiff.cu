@@ -0,0 +1,202 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+#include <nvcv/cuda/VectorizedAccess.hpp>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Integer differences are computed in int so that signed 16-bit ones saturate like in OpenCV
+template<typename T>
+__device__ T absDiff(T a, T b)
+{
+    using W = std::conditional_t<std::is_floating_point_v<T>, float, int>;
+
+    W d = static_cast<W>(a) - static_cast<W>(b);
+    return nvcv::cuda::SaturateCast<T>(d < 0 ? -d : d);
+}
+
+// Rows of packed pixels are handled as flat rows of values, each thread computing one chunk of N values.
+template<int N, typename T>
+__global__ void absdiff_kernel(const nvcv::cuda::Tensor3DWrap<const T> in1,
+                               const nvcv::cuda::Tensor3DWrap<const T> in2, nvcv::cuda::Tensor3DWrap<T> out,
+                               int rowLength, int rows)
+{
+    const int chunk_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y         = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    const int idx = chunk_idx * N;
+    if (y >= rows || idx >= rowLength)
+        return;
+
+    const T *a   = in1.ptr(batch_idx, y);
+    const T *b   = in2.ptr(batch_idx, y);
+    T       *dst = out.ptr(batch_idx, y);
+
+    if (idx + N <= rowLength && nvcv::cuda::IsVectorAligned<T, N>(a + idx)
+        && nvcv::cuda::IsVectorAligned<T, N>(b + idx) && nvcv::cuda::IsVectorAligned<T, N>(dst + idx))
+    {
+        nvcv::cuda::Vector<T, N> va = nvcv::cuda::LoadVector<N>(a + idx);
+        nvcv::cuda::Vector<T, N> vb = nvcv::cuda::LoadVector<N>(b + idx);
+        nvcv::cuda::Vector<T, N> vd;
+
+#pragma unroll
+        for (int k = 0; k < N; ++k)
+        {
+            vd[k] = absDiff(va[k], vb[k]);
+        }
+
+        nvcv::cuda::StoreVector(dst + idx, vd);
+    }
+    else
+    {
+        const int end = idx + N < rowLength ? idx + N : rowLength;
+        for (int i = idx; i < end; ++i)
+        {
+            dst[i] = absDiff(a[i], b[i]);
+        }
+    }
+}
+
+template<typename T>
+nvcv::cuda::Tensor3DWrap<T> wrapRows(const nvcv::TensorDataAccessStridedImagePlanar &access)
+{
+    return nvcv::cuda::Tensor3DWrap<T>(access.sampleData(0), static_cast<int>(access.sampleStride()),
+                                       static_cast<int>(access.rowStride()));
+}
+
+template<typename T>
+void absdiff(const nvcv::TensorDataAccessStridedImagePlanar &in1Access,
+             const nvcv::TensorDataAccessStridedImagePlanar &in2Access,
+             const nvcv::TensorDataAccessStridedImagePlanar &outAccess, cudaStream_t stream)
+{
+    constexpr int N = nvcv::cuda::VectorWidth<1, T>;
+
+    const int rowLength = in1Access.numCols() * in1Access.numChannels();
+    const int rows      = in1Access.numRows();
+
+    dim3 block(32, 8);
+    dim3 grid(divUp(divUp(rowLength, N), block.x), divUp(rows, block.y), in1Access.numSamples());
+
+    absdiff_kernel<N, T><<<grid, block, 0, stream>>>(wrapRows<const T>(in1Access), wrapRows<const T>(in2Access),
+                                                   wrapRows<T>(outAccess), rowLength, rows);
+    checkKernelErrors();
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t AbsDiff::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode AbsDiff::infer(const ITensorDataStridedCuda &in1Data, const ITensorDataStridedCuda &in2Data,
+                         const ITensorDataStridedCuda &outData, cudaStream_t stream)
+{
+    for (const ITensorDataStridedCuda *data : {&in1Data, &in2Data, &outData})
+    {
+        DataFormat format = GetLegacyDataFormat(data->layout());
+        if (!(format == kNHWC || format == kHWC))
+        {
+            LOG_ERROR("Invalid DataFormat " << format);
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+    }
+
+    if (in2Data.dtype() != in1Data.dtype() || outData.dtype() != in1Data.dtype())
+    {
+        LOG_ERROR("Inputs and output must have the same data type");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto in1Access = TensorDataAccessStridedImagePlanar::Create(in1Data);
+    auto in2Access = TensorDataAccessStridedImagePlanar::Create(in2Data);
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(in1Access && in2Access && outAccess);
+
+    const int channels = in1Access->numChannels();
+    if (channels < 1 || channels > 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    for (const auto *access : {&*in2Access, &*outAccess})
+    {
+        if (access->numSamples() != in1Access->numSamples() || access->numRows() != in1Access->numRows()
+            || access->numCols() != in1Access->numCols() || access->numChannels() != channels)
+        {
+            LOG_ERROR("Inputs and output must have the same shape");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
+    const int64_t pixelSize = channels * in1Data.dtype().strideBytes();
+    for (const auto *access : {&*in1Access, &*in2Access, &*outAccess})
+    {
+        if (access->colStride() != pixelSize)
+        {
+            LOG_ERROR("Pixels must be packed, with a column stride of " << pixelSize << " bytes");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
+    if (in1Access->numSamples() == 0 || in1Access->numRows() == 0 || in1Access->numCols() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const TensorDataAccessStridedImagePlanar &in1Access,
+                           const TensorDataAccessStridedImagePlanar &in2Access,
+                           const TensorDataAccessStridedImagePlanar &outAccess, cudaStream_t stream);
+
+    func_t func = nullptr;
+    switch (GetLegacyDataType(in1Data.dtype()))
+    {
+    case kCV_8U:
+        func = absdiff<uchar>;
+        break;
+    case kCV_16U:
+        func = absdiff<ushort>;
+        break;
+    case kCV_16S:
+        func = absdiff<short>;
+        break;
+    case kCV_32F:
+        func = absdiff<float>;
+        break;
+    default:
+        LOG_ERROR("Invalid DataType " << in1Data.dtype());
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    func(*in1Access, *in2Access, *outAccess, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
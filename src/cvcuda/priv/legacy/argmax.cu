@@ -0,0 +1,207 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Each thread computes the label of one output pixel, reading the scores of all classes at the source position.
+// Source positions follow resize, with pixel centers aligned: nearest takes floor(x * scale) and linear
+// interpolates at (x + 0.5) * scale - 0.5, clamped to the image. Ties go to the lowest class.
+template<typename LabelT, bool Linear>
+__global__ void argmax_kernel(const nvcv::cuda::Tensor4DWrap<const float> src, int numClasses, int2 srcSize,
+                              float2 scale, nvcv::cuda::Tensor3DWrap<LabelT> dst, int2 dstSize)
+{
+    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
+        return;
+
+    float best  = -INFINITY;
+    int   label = 0;
+
+    if constexpr (Linear)
+    {
+        const float fx = fmaxf((dst_x + 0.5f) * scale.x - 0.5f, 0.f);
+        const float fy = fmaxf((dst_y + 0.5f) * scale.y - 0.5f, 0.f);
+
+        const int x0 = min(static_cast<int>(fx), srcSize.x - 1);
+        const int y0 = min(static_cast<int>(fy), srcSize.y - 1);
+        const int x1 = min(x0 + 1, srcSize.x - 1);
+        const int y1 = min(y0 + 1, srcSize.y - 1);
+
+        const float ax = fx - x0;
+        const float ay = fy - y0;
+
+        for (int c = 0; c < numClasses; ++c)
+        {
+            const float v0 = *src.ptr(batch_idx, c, y0, x0) * (1 - ax) + *src.ptr(batch_idx, c, y0, x1) * ax;
+            const float v1 = *src.ptr(batch_idx, c, y1, x0) * (1 - ax) + *src.ptr(batch_idx, c, y1, x1) * ax;
+            const float v  = v0 * (1 - ay) + v1 * ay;
+            if (v > best)
+            {
+                best  = v;
+                label = c;
+            }
+        }
+    }
+    else
+    {
+        const int x = min(static_cast<int>(dst_x * scale.x), srcSize.x - 1);
+        const int y = min(static_cast<int>(dst_y * scale.y), srcSize.y - 1);
+
+        for (int c = 0; c < numClasses; ++c)
+        {
+            const float v = *src.ptr(batch_idx, c, y, x);
+            if (v > best)
+            {
+                best  = v;
+                label = c;
+            }
+        }
+    }
+
+    *dst.ptr(batch_idx, dst_y, dst_x) = label;
+}
+
+template<typename LabelT>
+void argmax(const nvcv::TensorDataAccessStridedImagePlanar &inAccess,
+            const nvcv::TensorDataAccessStridedImagePlanar &outAccess, bool linear, cudaStream_t stream)
+{
+    nvcv::cuda::Tensor4DWrap<const float> src(
+        inAccess.sampleData(0), static_cast<int>(inAccess.sampleStride()), static_cast<int>(inAccess.planeStride()),
+        static_cast<int>(inAccess.rowStride()));
+    nvcv::cuda::Tensor3DWrap<LabelT> dst(outAccess.sampleData(0), static_cast<int>(outAccess.sampleStride()),
+                                         static_cast<int>(outAccess.rowStride()));
+
+    const int2   srcSize{inAccess.numCols(), inAccess.numRows()};
+    const int2   dstSize{outAccess.numCols(), outAccess.numRows()};
+    const float2 scale{static_cast<float>(srcSize.x) / dstSize.x, static_cast<float>(srcSize.y) / dstSize.y};
+
+    dim3 block(32, 8, 1);
+    dim3 grid(divUp(dstSize.x, block.x), divUp(dstSize.y, block.y), outAccess.numSamples());
+
+    // Interpolating at source pixel centers gives the scores back
+    if (linear && (srcSize.x != dstSize.x || srcSize.y != dstSize.y))
+    {
+        argmax_kernel<LabelT, true>
+            <<<grid, block, 0, stream>>>(src, inAccess.numPlanes(), srcSize, scale, dst, dstSize);
+    }
+    else
+    {
+        argmax_kernel<LabelT, false>
+            <<<grid, block, 0, stream>>>(src, inAccess.numPlanes(), srcSize, scale, dst, dstSize);
+    }
+    checkKernelErrors();
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t ArgMax::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode ArgMax::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                        NVCVInterpolationType interpolation, cudaStream_t stream)
+{
+    DataFormat in_format = GetLegacyDataFormat(inData.layout());
+    if (!(in_format == kNCHW || in_format == kCHW))
+    {
+        LOG_ERROR("Invalid input DataFormat " << in_format << ", scores must be planar, one plane per class");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (inData.dtype() != nvcv::TYPE_F32)
+    {
+        LOG_ERROR("Invalid input DataType " << inData.dtype() << ", scores must be float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    DataFormat out_format = GetLegacyDataFormat(outData.layout());
+    if (!(out_format == kNHWC || out_format == kHWC))
+    {
+        LOG_ERROR("Invalid output DataFormat " << out_format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (interpolation != NVCV_INTERP_NEAREST && interpolation != NVCV_INTERP_LINEAR)
+    {
+        LOG_ERROR("Unsupported interpolation method " << interpolation);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    auto inAccess  = TensorDataAccessStridedImagePlanar::Create(inData);
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(inAccess && outAccess);
+
+    const int numClasses = inAccess->numPlanes();
+    if (numClasses < 1)
+    {
+        LOG_ERROR("Invalid number of classes " << numClasses);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (outAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid output channel number " << outAccess->numChannels() << ", it must be 1");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (outAccess->numSamples() != inAccess->numSamples())
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must have " << inAccess->numSamples()
+                                          << " samples");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const bool linear = interpolation == NVCV_INTERP_LINEAR;
+
+    if (outData.dtype() == nvcv::TYPE_U8)
+    {
+        if (numClasses > 256)
+        {
+            LOG_ERROR("Invalid output DataType " << outData.dtype() << ", " << numClasses
+                                                 << " classes need int32 labels");
+            return ErrorCode::INVALID_DATA_TYPE;
+        }
+        argmax<uchar>(*inAccess, *outAccess, linear, stream);
+    }
+    else if (outData.dtype() == nvcv::TYPE_S32)
+    {
+        argmax<int>(*inAccess, *outAccess, linear, stream);
+    }
+    else
+    {
+        LOG_ERROR("Invalid output DataType " << outData.dtype() << ", labels must be uint8 or int32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
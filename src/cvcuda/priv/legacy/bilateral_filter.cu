@@ -20,10 +20,12 @@
  * limitations under the License.
  */
 
+#include "BilateralFilterTile.cuh"
 #include "CvCudaLegacy.h"
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "StencilRegions.cuh"
 
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
@@ -50,13 +52,15 @@ static __device__ __forceinline__ float norm1(const float4 &a)
     return cuda::abs(a.x) + cuda::abs(a.y) + cuda::abs(a.z) + cuda::abs(a.w);
 }
 
-template<typename SrcWrapper, typename DstWrapper>
+template<bool Fast, typename SrcWrapper, typename DstWrapper>
 __global__ void BilateralFilterKernel(SrcWrapper src, DstWrapper dst, const int radius, const float sigmaColor,
-                                      const float sigmaSpace, const int rows, const int columns)
+                                      const float sigmaSpace, StencilRegion region)
 {
-    const int colIdx    = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
-    const int rowIdx    = (blockIdx.y * blockDim.y + threadIdx.y) * 2;
+    const int colIdx    = region.offset.x + (blockIdx.x * blockDim.x + threadIdx.x) * 2;
+    const int rowIdx    = region.offset.y + (blockIdx.y * blockDim.y + threadIdx.y) * 2;
     const int batch_idx = blockIdx.z;
+    const int columns   = region.offset.x + region.size.w;
+    const int rows      = region.offset.y + region.size.h;
 
     using T         = typename DstWrapper::ValueType;
     using work_type = cuda::ConvertBaseTypeTo<float, T>;
@@ -106,7 +110,7 @@ __global__ void BilateralFilterKernel(SrcWrapper src, DstWrapper dst, const int
                 float e_space       = squared_dis0 * space_coefficient;
                 float one_norm_size = norm1(curr - center0);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator0 += weight;
                 numerator0 += weight * curr;
             }
@@ -116,7 +120,7 @@ __global__ void BilateralFilterKernel(SrcWrapper src, DstWrapper dst, const int
                 float e_space       = squared_dis1 * space_coefficient;
                 float one_norm_size = norm1(curr - center1);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator1 += weight;
                 numerator1 = numerator1 + (weight * curr);
             }
@@ -126,7 +130,7 @@ __global__ void BilateralFilterKernel(SrcWrapper src, DstWrapper dst, const int
                 float e_space       = squared_dis2 * space_coefficient;
                 float one_norm_size = norm1(curr - center2);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator2 += weight;
                 numerator2 = numerator2 + (weight * curr);
             }
@@ -136,7 +140,7 @@ __global__ void BilateralFilterKernel(SrcWrapper src, DstWrapper dst, const int
                 float e_space       = squared_dis3 * space_coefficient;
                 float one_norm_size = norm1(curr - center3);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator3 += weight;
                 numerator3 = numerator3 + (weight * curr);
             }
@@ -160,13 +164,24 @@ __global__ void BilateralFilterKernel(SrcWrapper src, DstWrapper dst, const int
     }
 }
 
+// Tiled variant of BilateralFilterKernel with one output per thread, see BilateralFilterTile
+template<bool Fast, typename SrcWrapper, typename DstWrapper>
+__global__ void BilateralFilterTiledKernel(SrcWrapper src, DstWrapper dst, const int radius, const float sigmaColor,
+                                           const float sigmaSpace, const int rows, const int columns)
+{
+    using T = typename DstWrapper::ValueType;
+
+    extern __shared__ __align__(16) unsigned char smem[];
+    BilateralFilterTile<false, Fast>(smem, src, src, radius, sigmaColor, sigmaSpace, rows, columns,
+                                     [&dst](const int3 &coord, const T &value) { dst[coord] = value; });
+}
+
 template<typename T, NVCVBorderType B>
 void BilateralFilterCaller(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, const int batch,
                            int rows, int columns, int radius, float sigmaColor, float sigmaSpace, float borderValue,
                            cudaStream_t stream)
 {
     dim3 block(8, 8);
-    dim3 grid(divUp(columns, block.x * 2), divUp(rows, block.y * 2), batch);
 
     auto src = cuda::CreateBorderWrapNHW<const T, B>(inData, cuda::SetAll<T>(borderValue));
     auto dst = cuda::CreateTensorWrapNHW<T>(outData);
@@ -176,7 +191,45 @@ void BilateralFilterCaller(const ITensorDataStridedCuda &inData, const ITensorDa
     checkCudaErrors(cudaGetLastError());
 #endif
 
-    BilateralFilterKernel<<<grid, block, 0, stream>>>(src, dst, radius, sigmaColor, sigmaSpace, rows, columns);
+    int tileSmem = BilateralTileSharedMemSize<T>(radius, 1);
+    if (tileSmem <= kBilateralTileMaxSharedMem)
+    {
+        dim3 tileBlock(kBilateralTileBlock, kBilateralTileBlock);
+        dim3 tileGrid(divUp(columns, tileBlock.x), divUp(rows, tileBlock.y), batch);
+
+        DispatchPrecision(
+            [&](auto fast)
+            {
+                BilateralFilterTiledKernel<decltype(fast)::value>
+                    <<<tileGrid, tileBlock, tileSmem, stream>>>(src, dst, radius, sigmaColor, sigmaSpace, rows, columns);
+            });
+    }
+    else
+    {
+        // each thread computes 2x2 outputs, so the window reaches one pixel further right and down
+        LaunchStencilRegions(Size2D{columns, rows}, Size2D{columns, rows}, int2{-radius, -radius},
+                             int2{radius + 1, radius + 1},
+                             [&](auto interior, StencilRegion region)
+                             {
+                                 dim3 grid(divUp(region.size.w, block.x * 2), divUp(region.size.h, block.y * 2),
+                                           batch);
+                                 DispatchPrecision(
+                                     [&](auto fast)
+                                     {
+                                         constexpr bool Fast = decltype(fast)::value;
+                                         if constexpr (decltype(interior)::value)
+                                         {
+                                             BilateralFilterKernel<Fast><<<grid, block, 0, stream>>>(
+                                                 src.tensorWrap(), dst, radius, sigmaColor, sigmaSpace, region);
+                                         }
+                                         else
+                                         {
+                                             BilateralFilterKernel<Fast><<<grid, block, 0, stream>>>(
+                                                 src, dst, radius, sigmaColor, sigmaSpace, region);
+                                         }
+                                     });
+                             });
+    }
 
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
@@ -50,7 +50,7 @@ static __device__ __forceinline__ float norm1(const float4 &a)
     return cuda::abs(a.x) + cuda::abs(a.y) + cuda::abs(a.z) + cuda::abs(a.w);
 }
 
-template<class SrcWrapper, class DstWrapper>
+template<bool Fast, class SrcWrapper, class DstWrapper>
 __global__ void BilateralFilterVarShapeKernel(const SrcWrapper src, DstWrapper dst,
                                               const cuda::Tensor1DWrap<int>   inDiameter,
                                               const cuda::Tensor1DWrap<float> inSigmaColor,
@@ -138,7 +138,7 @@ __global__ void BilateralFilterVarShapeKernel(const SrcWrapper src, DstWrapper d
                 float e_space       = squared_dis0 * space_coefficient;
                 float one_norm_size = norm1(curr - center0);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator0 += weight;
                 numerator0 += weight * curr;
             }
@@ -148,7 +148,7 @@ __global__ void BilateralFilterVarShapeKernel(const SrcWrapper src, DstWrapper d
                 float e_space       = squared_dis1 * space_coefficient;
                 float one_norm_size = norm1(curr - center1);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator1 += weight;
                 numerator1 = numerator1 + (weight * curr);
             }
@@ -158,7 +158,7 @@ __global__ void BilateralFilterVarShapeKernel(const SrcWrapper src, DstWrapper d
                 float e_space       = squared_dis2 * space_coefficient;
                 float one_norm_size = norm1(curr - center2);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator2 += weight;
                 numerator2 = numerator2 + (weight * curr);
             }
@@ -168,7 +168,7 @@ __global__ void BilateralFilterVarShapeKernel(const SrcWrapper src, DstWrapper d
                 float e_space       = squared_dis3 * space_coefficient;
                 float one_norm_size = norm1(curr - center3);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator3 += weight;
                 numerator3 = numerator3 + (weight * curr);
             }
@@ -211,7 +211,12 @@ void BilateralFilterVarShapeCaller(const IImageBatchVarShapeDataStridedCuda &inD
     checkCudaErrors(cudaGetLastError());
 #endif
 
-    BilateralFilterVarShapeKernel<<<grid, block, 0, stream>>>(src, dst, inDiameter, inSigmaColor, inSigmaSpace);
+    DispatchPrecision(
+        [&](auto fast)
+        {
+            BilateralFilterVarShapeKernel<decltype(fast)::value>
+                <<<grid, block, 0, stream>>>(src, dst, inDiameter, inSigmaColor, inSigmaSpace);
+        });
 
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
@@ -0,0 +1,533 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+#include <nvcv/cuda/BorderWrap.hpp>
+#include <nvcv/cuda/MathWrappers.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+constexpr int kBlockW = 32;
+constexpr int kBlockH = 8;
+
+// Blocks are launched per box since the boxes are only known on device. Each box gets enough blocks to fill the
+// device when there are few boxes, and its blocks share its tiles, so the work follows the area of the boxes.
+constexpr int kTargetBlocks    = 1024;
+constexpr int kMaxBlocksPerBox = 64;
+
+// Largest Gaussian radius, the one-sided weights are passed by value to the kernels.
+constexpr int kMaxRadius = 127;
+
+struct GaussianWeights
+{
+    float w[kMaxRadius + 1];
+    int   radius;
+};
+
+// Boxes [x1, y1, x2, y2] of each sample with their optional count, and the size of the images.
+struct Regions
+{
+    nvcv::cuda::Tensor3DWrap<const float4> boxes;
+    nvcv::cuda::Tensor3DWrap<const int>    counts;
+
+    bool hasCounts;
+    int2 size;
+};
+
+// Gets the integer region [lo, hi) covering box i of the sample, clipped to the image. Returns false when the box
+// isn't counted or its region is empty.
+__device__ bool LoadRegion(const Regions &regions, int sample, int i, int2 &lo, int2 &hi)
+{
+    if (regions.hasCounts && i >= *regions.counts.ptr(sample, 0, 0))
+    {
+        return false;
+    }
+
+    const float4 box = *regions.boxes.ptr(sample, 0, i);
+    if (!(box.z > box.x && box.w > box.y))
+    {
+        return false;
+    }
+
+    const float2 size{static_cast<float>(regions.size.x), static_cast<float>(regions.size.y)};
+
+    lo.x = static_cast<int>(fminf(fmaxf(floorf(box.x), 0.f), size.x));
+    lo.y = static_cast<int>(fminf(fmaxf(floorf(box.y), 0.f), size.y));
+    hi.x = static_cast<int>(fmaxf(fminf(ceilf(box.z), size.x), 0.f));
+    hi.y = static_cast<int>(fmaxf(fminf(ceilf(box.w), size.y), 0.f));
+
+    return hi.x > lo.x && hi.y > lo.y;
+}
+
+// Calls f(x, y) for each pixel of a size.x x size.y rectangle, split in tiles shared by the blocks of the box.
+template<class F>
+__device__ void ForEachPixel(int2 size, F &&f)
+{
+    const int tilesX   = (size.x + kBlockW - 1) / kBlockW;
+    const int numTiles = tilesX * ((size.y + kBlockH - 1) / kBlockH);
+
+    for (int t = blockIdx.x; t < numTiles; t += gridDim.x)
+    {
+        const int x = (t % tilesX) * kBlockW + threadIdx.x;
+        const int y = (t / tilesX) * kBlockH + threadIdx.y;
+        if (x < size.x && y < size.y)
+        {
+            f(x, y);
+        }
+    }
+}
+
+// Index of coordinate c in [0, s) after applying the border, -1 for constant borders outside of the image.
+__device__ int BorderIndex(int c, int s, NVCVBorderType border)
+{
+    if (c >= 0 && c < s)
+    {
+        return c;
+    }
+
+    switch (border)
+    {
+    case NVCV_BORDER_REPLICATE:
+        return nvcv::cuda::GetIndexWithBorder<NVCV_BORDER_REPLICATE>(c, s);
+    case NVCV_BORDER_REFLECT:
+        return nvcv::cuda::GetIndexWithBorder<NVCV_BORDER_REFLECT>(c, s);
+    case NVCV_BORDER_WRAP:
+        return nvcv::cuda::GetIndexWithBorder<NVCV_BORDER_WRAP>(c, s);
+    case NVCV_BORDER_REFLECT101:
+        return nvcv::cuda::GetIndexWithBorder<NVCV_BORDER_REFLECT101>(c, s);
+    default:
+        return -1;
+    }
+}
+
+// The Gaussian blur is separable: the row pass filters the rows of each box and the rows around it read by the
+// column pass into a full-size plane of the workspace, then the column pass filters the plane into the image. The
+// image is only written after all the rows were read, so the blur is done in place. Each plane value only depends on
+// its position, so the rows shared by overlapping boxes, or mapped to the same image row by the border, get the same
+// values whichever box writes them last.
+template<typename T, typename W>
+__global__ void gaussianRows(nvcv::cuda::Tensor3DWrap<const T> src, Regions regions, W *plane,
+                             GaussianWeights weights, NVCVBorderType border)
+{
+    const int sample = blockIdx.z;
+
+    int2 lo, hi;
+    if (!LoadRegion(regions, sample, blockIdx.y, lo, hi))
+    {
+        return;
+    }
+
+    const int  r    = weights.radius;
+    const int2 size = regions.size;
+
+    ForEachPixel(int2{hi.x - lo.x, hi.y - lo.y + 2 * r},
+                 [&](int dx, int dy)
+                 {
+                     const int y = BorderIndex(lo.y - r + dy, size.y, border);
+                     if (y < 0)
+                     {
+                         return;
+                     }
+
+                     const int x   = lo.x + dx;
+                     const T  *row = src.ptr(sample, y, 0);
+
+                     W sum = weights.w[0] * row[x];
+                     if (x >= r && x + r < size.x)
+                     {
+                         for (int k = 1; k <= r; ++k)
+                         {
+                             sum += weights.w[k] * row[x - k] + weights.w[k] * row[x + k];
+                         }
+                     }
+                     else
+                     {
+                         for (int k = 1; k <= r; ++k)
+                         {
+                             const int left  = BorderIndex(x - k, size.x, border);
+                             const int right = BorderIndex(x + k, size.x, border);
+                             if (left >= 0)
+                             {
+                                 sum += weights.w[k] * row[left];
+                             }
+                             if (right >= 0)
+                             {
+                                 sum += weights.w[k] * row[right];
+                             }
+                         }
+                     }
+
+                     plane[(static_cast<int64_t>(sample) * size.y + y) * size.x + x] = sum;
+                 });
+}
+
+template<typename T, typename W>
+__global__ void gaussianColumns(nvcv::cuda::Tensor3DWrap<T> dst, Regions regions, const W *plane,
+                                GaussianWeights weights, NVCVBorderType border)
+{
+    const int sample = blockIdx.z;
+
+    int2 lo, hi;
+    if (!LoadRegion(regions, sample, blockIdx.y, lo, hi))
+    {
+        return;
+    }
+
+    const int  r    = weights.radius;
+    const int2 size = regions.size;
+
+    const W *samplePlane = plane + static_cast<int64_t>(sample) * size.y * size.x;
+
+    ForEachPixel(int2{hi.x - lo.x, hi.y - lo.y},
+                 [&](int dx, int dy)
+                 {
+                     const int x = lo.x + dx;
+                     const int y = lo.y + dy;
+
+                     const W *column = samplePlane + x;
+
+                     W sum = weights.w[0] * column[static_cast<int64_t>(y) * size.x];
+                     for (int k = 1; k <= r; ++k)
+                     {
+                         const int up   = BorderIndex(y - k, size.y, border);
+                         const int down = BorderIndex(y + k, size.y, border);
+                         if (up >= 0)
+                         {
+                             sum += weights.w[k] * column[static_cast<int64_t>(up) * size.x];
+                         }
+                         if (down >= 0)
+                         {
+                             sum += weights.w[k] * column[static_cast<int64_t>(down) * size.x];
+                         }
+                     }
+
+                     *dst.ptr(sample, y, x) = nvcv::cuda::SaturateCast<T>(sum);
+                 });
+}
+
+// Pixelation replaces each pixel by the mean of its cell, the cells being squares aligned with the image. The
+// means of the cells covering each box are written to the workspace before any pixel is, so like the blur it's done
+// in place and overlapping boxes agree.
+template<typename T, typename W>
+__global__ void pixelateCells(nvcv::cuda::Tensor3DWrap<const T> src, Regions regions, W *cells, int cellSize)
+{
+    const int sample = blockIdx.z;
+
+    int2 lo, hi;
+    if (!LoadRegion(regions, sample, blockIdx.y, lo, hi))
+    {
+        return;
+    }
+
+    const int2 size = regions.size;
+    const int2 numCells{(size.x + cellSize - 1) / cellSize, (size.y + cellSize - 1) / cellSize};
+    const int2 first{lo.x / cellSize, lo.y / cellSize};
+    const int2 last{(hi.x - 1) / cellSize, (hi.y - 1) / cellSize};
+
+    ForEachPixel(int2{last.x - first.x + 1, last.y - first.y + 1},
+                 [&](int dx, int dy)
+                 {
+                     const int cx = first.x + dx;
+                     const int cy = first.y + dy;
+
+                     const int x0 = cx * cellSize;
+                     const int y0 = cy * cellSize;
+                     const int x1 = nvcv::cuda::min(x0 + cellSize, size.x);
+                     const int y1 = nvcv::cuda::min(y0 + cellSize, size.y);
+
+                     W sum = nvcv::cuda::SetAll<W>(0);
+                     for (int y = y0; y < y1; ++y)
+                     {
+                         const T *row = src.ptr(sample, y, 0);
+                         for (int x = x0; x < x1; ++x)
+                         {
+                             sum += row[x];
+                         }
+                     }
+
+                     cells[(static_cast<int64_t>(sample) * numCells.y + cy) * numCells.x + cx]
+                         = sum / static_cast<float>((x1 - x0) * (y1 - y0));
+                 });
+}
+
+template<typename T, typename W>
+__global__ void pixelateRegions(nvcv::cuda::Tensor3DWrap<T> dst, Regions regions, const W *cells, int cellSize)
+{
+    const int sample = blockIdx.z;
+
+    int2 lo, hi;
+    if (!LoadRegion(regions, sample, blockIdx.y, lo, hi))
+    {
+        return;
+    }
+
+    const int2 size = regions.size;
+    const int2 numCells{(size.x + cellSize - 1) / cellSize, (size.y + cellSize - 1) / cellSize};
+
+    ForEachPixel(int2{hi.x - lo.x, hi.y - lo.y},
+                 [&](int dx, int dy)
+                 {
+                     const int x = lo.x + dx;
+                     const int y = lo.y + dy;
+
+                     const W mean = cells[(static_cast<int64_t>(sample) * numCells.y + y / cellSize) * numCells.x
+                                          + x / cellSize];
+
+                     *dst.ptr(sample, y, x) = nvcv::cuda::SaturateCast<T>(mean);
+                 });
+}
+
+// One-sided weights of the normalized Gaussian kernel.
+GaussianWeights makeGaussianWeights(int kernelSize, double sigma)
+{
+    GaussianWeights weights;
+    weights.radius = kernelSize / 2;
+
+    if (sigma <= 0)
+    {
+        // same as Gaussian kernels computed from their size only in OpenCV
+        sigma = 0.3 * ((kernelSize - 1) * 0.5 - 1) + 0.8;
+    }
+
+    double sum = 0;
+    double w[kMaxRadius + 1];
+    for (int k = 0; k <= weights.radius; ++k)
+    {
+        w[k] = std::exp(-(k * k) / (2 * sigma * sigma));
+        sum += k == 0 ? w[k] : 2 * w[k];
+    }
+    for (int k = 0; k <= weights.radius; ++k)
+    {
+        weights.w[k] = static_cast<float>(w[k] / sum);
+    }
+    return weights;
+}
+
+template<typename T>
+void blurRegions(const ITensorDataStridedCuda &data, const Regions &regions, int numSamples, int numBoxes,
+                 NVCVBlurRegionType type, int kernelSize, double sigma, NVCVBorderType border, void *workspace,
+                 cudaStream_t stream)
+{
+    using work_type = nvcv::cuda::ConvertBaseTypeTo<float, T>;
+
+    auto src = nvcv::cuda::CreateTensorWrapNHW<const T>(data);
+    auto dst = nvcv::cuda::CreateTensorWrapNHW<T>(data);
+
+    work_type *plane = static_cast<work_type *>(workspace);
+
+    dim3 block(kBlockW, kBlockH);
+    dim3 grid(std::clamp(kTargetBlocks / (numSamples * numBoxes), 1, kMaxBlocksPerBox), numBoxes, numSamples);
+
+    if (type == NVCV_BLUR_REGION_PIXELATE)
+    {
+        pixelateCells<T><<<grid, block, 0, stream>>>(src, regions, plane, kernelSize);
+        checkKernelErrors();
+
+        pixelateRegions<T><<<grid, block, 0, stream>>>(dst, regions, plane, kernelSize);
+        checkKernelErrors();
+    }
+    else
+    {
+        GaussianWeights weights = makeGaussianWeights(kernelSize, sigma);
+
+        gaussianRows<T><<<grid, block, 0, stream>>>(src, regions, plane, weights, border);
+        checkKernelErrors();
+
+        gaussianColumns<T><<<grid, block, 0, stream>>>(dst, regions, plane, weights, border);
+        checkKernelErrors();
+    }
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
+template<typename T>
+nvcv::cuda::Tensor3DWrap<T> wrapRows(const nvcv::TensorDataAccessStridedImagePlanar &access)
+{
+    return nvcv::cuda::Tensor3DWrap<T>(access.sampleData(0), static_cast<int>(access.sampleStride()),
+                                       static_cast<int>(access.rowStride()));
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+BlurRegions::BlurRegions(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size, Size2D max_size)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_maxBatchSize(max_batch_size)
+    , m_maxSize(max_size)
+{
+    setGpuWorkspaceSize(calBufferSize(max_batch_size, max_size));
+}
+
+size_t BlurRegions::calBufferSize(int max_batch_size, Size2D max_size)
+{
+    // Row pass plane or cell means, at most one float per channel and pixel
+    return static_cast<size_t>(std::max(max_batch_size, 0)) * std::max(max_size.w, 0) * std::max(max_size.h, 0)
+         * sizeof(float4);
+}
+
+ErrorCode BlurRegions::infer(const ITensorDataStridedCuda &inOutData, const ITensorDataStridedCuda &boxData,
+                             const ITensorDataStridedCuda *countData, NVCVBlurRegionType type, int kernel_size,
+                             double sigma, NVCVBorderType border_mode, cudaStream_t stream)
+{
+    for (const ITensorDataStridedCuda *data : {&inOutData, &boxData, countData})
+    {
+        if (data == nullptr)
+        {
+            continue;
+        }
+
+        DataFormat format = GetLegacyDataFormat(data->layout());
+        if (!(format == kNHWC || format == kHWC))
+        {
+            LOG_ERROR("Invalid DataFormat " << format);
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+    }
+
+    cuda_op::DataType data_type = GetLegacyDataType(inOutData.dtype());
+    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_16S || data_type == kCV_32S
+          || data_type == kCV_32F))
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (boxData.dtype() != nvcv::TYPE_F32 || (countData && countData->dtype() != nvcv::TYPE_S32))
+    {
+        LOG_ERROR("Invalid DataType, boxes must be float32 and counts int32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (type == NVCV_BLUR_REGION_GAUSSIAN)
+    {
+        if (kernel_size < 1 || kernel_size % 2 == 0 || kernel_size > 2 * kMaxRadius + 1)
+        {
+            LOG_ERROR("Invalid Gaussian kernel size " << kernel_size << ", it must be odd and at most "
+                                                      << 2 * kMaxRadius + 1);
+            return ErrorCode::INVALID_PARAMETER;
+        }
+
+        if (!(border_mode == NVCV_BORDER_REFLECT101 || border_mode == NVCV_BORDER_REPLICATE
+              || border_mode == NVCV_BORDER_CONSTANT || border_mode == NVCV_BORDER_REFLECT
+              || border_mode == NVCV_BORDER_WRAP))
+        {
+            LOG_ERROR("Invalid borderMode " << border_mode);
+            return ErrorCode::INVALID_PARAMETER;
+        }
+    }
+    else if (type == NVCV_BLUR_REGION_PIXELATE)
+    {
+        if (kernel_size < 1)
+        {
+            LOG_ERROR("Invalid pixelation cell size " << kernel_size << ", it must be positive");
+            return ErrorCode::INVALID_PARAMETER;
+        }
+    }
+    else
+    {
+        LOG_ERROR("Invalid blur region type " << type);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    auto access    = TensorDataAccessStridedImagePlanar::Create(inOutData);
+    auto boxAccess = TensorDataAccessStridedImagePlanar::Create(boxData);
+    NVCV_ASSERT(access && boxAccess);
+
+    const int  channels   = access->numChannels();
+    const int  numSamples = access->numSamples();
+    const int2 size{static_cast<int>(access->numCols()), static_cast<int>(access->numRows())};
+
+    if (channels != 1 && channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (numSamples > m_maxBatchSize || size.x > m_maxSize.w || size.y > m_maxSize.h)
+    {
+        LOG_ERROR("Invalid shape " << inOutData.shape() << ", it exceeds the maximum batch size " << m_maxBatchSize
+                                   << " or size " << m_maxSize.w << "x" << m_maxSize.h << " of the operator");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const int numBoxes = boxAccess->numCols();
+
+    if (boxAccess->numSamples() != numSamples || boxAccess->numRows() != 1 || boxAccess->numChannels() != 4
+        || boxAccess->colStride() != sizeof(float4) || numBoxes > 65535 || numSamples > 65535)
+    {
+        LOG_ERROR("Invalid box shape " << boxData.shape() << ", boxes must be a single row of at most 65535 "
+                                       << "4-channel elements for each of at most 65535 samples");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    nvcv::detail::Optional<TensorDataAccessStridedImagePlanar> countAccess;
+    if (countData)
+    {
+        countAccess = TensorDataAccessStridedImagePlanar::Create(*countData);
+        NVCV_ASSERT(countAccess);
+
+        if (countAccess->numSamples() != numSamples || countAccess->numRows() != 1 || countAccess->numCols() != 1
+            || countAccess->numChannels() != 1)
+        {
+            LOG_ERROR("Invalid count shape " << countData->shape() << ", it must have a single element per sample");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
+    if (numSamples == 0 || numBoxes == 0 || size.x == 0 || size.y == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    Regions regions{wrapRows<const float4>(*boxAccess),
+                    countAccess ? wrapRows<const int>(*countAccess) : nvcv::cuda::Tensor3DWrap<const int>{},
+                    countData != nullptr, size};
+
+    typedef void (*blur_regions_t)(const ITensorDataStridedCuda &data, const Regions &regions, int numSamples,
+                                   int numBoxes, NVCVBlurRegionType type, int kernelSize, double sigma,
+                                   NVCVBorderType border, void *workspace, cudaStream_t stream);
+
+    static const blur_regions_t funcs[6][4] = {
+        { blurRegions<uchar>, 0,  blurRegions<uchar3>,  blurRegions<uchar4>},
+        {                  0, 0,                    0,                    0},
+        {blurRegions<ushort>, 0, blurRegions<ushort3>, blurRegions<ushort4>},
+        { blurRegions<short>, 0,  blurRegions<short3>,  blurRegions<short4>},
+        {   blurRegions<int>, 0,    blurRegions<int3>,    blurRegions<int4>},
+        { blurRegions<float>, 0,  blurRegions<float3>,  blurRegions<float4>},
+    };
+
+    funcs[data_type][channels - 1](inOutData, regions, numSamples, numBoxes, type, kernel_size, sigma, border_mode,
+                                   gpuWorkspace(stream).get(), stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+#include <cmath>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Size deltas are clamped before their exponential, like torchvision does, so that boxes stay finite.
+constexpr float kMaxSizeDelta = 4.135166556742356f; // log(1000 / 16)
+
+// Each thread decodes one anchor, the anchors of sample 0 are used by all samples when anchorsPerSample is false.
+__global__ void box_decode_kernel(const nvcv::cuda::Tensor3DWrap<const float4> anchors, bool anchorsPerSample,
+                                  const nvcv::cuda::Tensor3DWrap<const float4> deltas,
+                                  nvcv::cuda::Tensor3DWrap<float4> boxes, int numAnchors, float varianceXY,
+                                  float varianceWH)
+{
+    const int i         = blockIdx.x * blockDim.x + threadIdx.x;
+    const int batch_idx = get_batch_idx();
+
+    if (i >= numAnchors)
+        return;
+
+    const float4 a = *anchors.ptr(anchorsPerSample ? batch_idx : 0, 0, i);
+    const float4 d = *deltas.ptr(batch_idx, 0, i);
+
+    const float aw  = a.z - a.x;
+    const float ah  = a.w - a.y;
+    const float acx = a.x + 0.5f * aw;
+    const float acy = a.y + 0.5f * ah;
+
+    const float cx = acx + d.x * varianceXY * aw;
+    const float cy = acy + d.y * varianceXY * ah;
+    const float w  = aw * expf(fminf(d.z * varianceWH, kMaxSizeDelta));
+    const float h  = ah * expf(fminf(d.w * varianceWH, kMaxSizeDelta));
+
+    *boxes.ptr(batch_idx, 0, i) = make_float4(cx - 0.5f * w, cy - 0.5f * h, cx + 0.5f * w, cy + 0.5f * h);
+}
+
+// Boxes are one row of packed 4-channel float32 elements per sample.
+bool isBoxRow(const nvcv::TensorDataAccessStridedImagePlanar &access)
+{
+    return access.numRows() == 1 && access.numChannels() == 4 && access.colStride() == sizeof(float4);
+}
+
+template<typename T>
+nvcv::cuda::Tensor3DWrap<T> wrapBoxRows(const nvcv::TensorDataAccessStridedImagePlanar &access)
+{
+    return nvcv::cuda::Tensor3DWrap<T>(access.sampleData(0), static_cast<int>(access.sampleStride()),
+                                       static_cast<int>(access.rowStride()));
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t BoxDecode::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode BoxDecode::infer(const ITensorDataStridedCuda &anchorData, const ITensorDataStridedCuda &deltaData,
+                           const ITensorDataStridedCuda &boxData, float varianceXY, float varianceWH,
+                           cudaStream_t stream)
+{
+    for (const ITensorDataStridedCuda *data : {&anchorData, &deltaData, &boxData})
+    {
+        DataFormat format = GetLegacyDataFormat(data->layout());
+        if (!(format == kNHWC || format == kHWC))
+        {
+            LOG_ERROR("Invalid DataFormat " << format);
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+
+        if (data->dtype() != nvcv::TYPE_F32)
+        {
+            LOG_ERROR("Invalid DataType " << data->dtype() << ", anchors, deltas and boxes must be float32");
+            return ErrorCode::INVALID_DATA_TYPE;
+        }
+    }
+
+    auto anchorAccess = TensorDataAccessStridedImagePlanar::Create(anchorData);
+    auto deltaAccess  = TensorDataAccessStridedImagePlanar::Create(deltaData);
+    auto boxAccess    = TensorDataAccessStridedImagePlanar::Create(boxData);
+    NVCV_ASSERT(anchorAccess && deltaAccess && boxAccess);
+
+    if (!isBoxRow(*deltaAccess) || deltaData.shape() != boxData.shape() || !isBoxRow(*boxAccess))
+    {
+        LOG_ERROR("Invalid delta and box shapes " << deltaData.shape() << " and " << boxData.shape()
+                                                  << ", they must be equal, with a single row of 4-channel elements");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const int numSamples = deltaAccess->numSamples();
+    const int numAnchors = deltaAccess->numCols();
+
+    if (!isBoxRow(*anchorAccess) || anchorAccess->numCols() != numAnchors
+        || (anchorAccess->numSamples() != 1 && anchorAccess->numSamples() != numSamples))
+    {
+        LOG_ERROR("Invalid anchor shape " << anchorData.shape() << ", it must have a single row of " << numAnchors
+                                          << " 4-channel elements, for 1 or " << numSamples << " samples");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (numSamples == 0 || numAnchors == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    dim3 block(256, 1, 1);
+    dim3 grid(divUp(numAnchors, block.x), 1, numSamples);
+
+    box_decode_kernel<<<grid, block, 0, stream>>>(wrapBoxRows<const float4>(*anchorAccess),
+                                                  anchorAccess->numSamples() > 1,
+                                                  wrapBoxRows<const float4>(*deltaAccess),
+                                                  wrapBoxRows<float4>(*boxAccess), numAnchors, varianceXY, varianceWH);
+    checkKernelErrors();
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,449 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "SobelKernels.cuh"
+
+#include <cooperative_groups.h>
+
+#include <utility>
+
+namespace cg = cooperative_groups;
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Pixels processed by each block, the tiles of the gradient and of the labels have a 1-pixel halo around them.
+constexpr int kCannyBlockW = 32;
+constexpr int kCannyBlockH = 8;
+constexpr int kCannyTileW  = kCannyBlockW + 2;
+constexpr int kCannyTileH  = kCannyBlockH + 2;
+
+// Labels of the pixels until the hysteresis is done, weak pixels are edges only when connected to a strong one.
+constexpr uchar kCannyStrong = 255;
+constexpr uchar kCannyWeak   = 127;
+
+// tan(22.5) and tan(67.5), bounds of the gradient direction sectors
+constexpr float kTan22 = 0.41421356f;
+constexpr float kTan67 = 2.41421356f;
+
+// Each block computes the gradient of its pixels and their halo in shared memory, thins the edges keeping the
+// local maxima of the magnitude along the gradient direction, then labels them with the double threshold. The
+// magnitude is 0 outside the image, so edges reach its border.
+template<int KSize, class SrcWrapper>
+__global__ void cannyNonMaxSuppression(SrcWrapper src, nvcv::cuda::Tensor3DWrap<uchar> dst, int2 size,
+                                       SobelKernels kernels, float thresholdLow, float thresholdHigh,
+                                       bool l2Gradient)
+{
+    __shared__ float2 sGrad[kCannyTileH][kCannyTileW];
+    __shared__ float  sMag[kCannyTileH][kCannyTileW];
+
+    const int z  = blockIdx.z;
+    const int x0 = blockIdx.x * kCannyBlockW - 1;
+    const int y0 = blockIdx.y * kCannyBlockH - 1;
+
+    for (int i = threadIdx.y * blockDim.x + threadIdx.x; i < kCannyTileW * kCannyTileH; i += blockDim.x * blockDim.y)
+    {
+        const int tx = i % kCannyTileW;
+        const int ty = i / kCannyTileW;
+        const int x  = x0 + tx;
+        const int y  = y0 + ty;
+
+        float gx = 0.f, gy = 0.f, mag = 0.f;
+        if (x >= 0 && x < size.x && y >= 0 && y < size.y)
+        {
+            SobelGradient<KSize>(src, int3{x, y, z}, kernels, gx, gy);
+            mag = l2Gradient ? sqrtf(gx * gx + gy * gy) : fabsf(gx) + fabsf(gy);
+        }
+
+        sGrad[ty][tx] = float2{gx, gy};
+        sMag[ty][tx]  = mag;
+    }
+
+    __syncthreads();
+
+    const int x = x0 + 1 + threadIdx.x;
+    const int y = y0 + 1 + threadIdx.y;
+
+    if (x >= size.x || y >= size.y)
+        return;
+
+    const int tx = threadIdx.x + 1;
+    const int ty = threadIdx.y + 1;
+
+    const float mag   = sMag[ty][tx];
+    uchar       label = 0;
+
+    if (mag > thresholdLow)
+    {
+        const float2 g  = sGrad[ty][tx];
+        const float  ax = fabsf(g.x);
+        const float  ay = fabsf(g.y);
+
+        bool isMax;
+        if (ay < ax * kTan22)
+        {
+            isMax = mag > sMag[ty][tx - 1] && mag >= sMag[ty][tx + 1];
+        }
+        else if (ay > ax * kTan67)
+        {
+            isMax = mag > sMag[ty - 1][tx] && mag >= sMag[ty + 1][tx];
+        }
+        else
+        {
+            const int s = g.x * g.y < 0.f ? -1 : 1;
+            isMax       = mag > sMag[ty - 1][tx - s] && mag > sMag[ty + 1][tx + s];
+        }
+
+        if (isMax)
+        {
+            label = mag > thresholdHigh ? kCannyStrong : kCannyWeak;
+        }
+    }
+
+    *dst.ptr(z, y, x) = label;
+}
+
+// Hysteresis of one tile: the block promotes the weak pixels of the tile connected to a strong one, iterating in
+// shared memory until the tile doesn't change. Promotions on the border of the tile may connect weak pixels of
+// the neighboring tiles, they raise the changed flag so that another pass is run. Labels are read bypassing L1,
+// they might have been written by other blocks of the same grid.
+__device__ void cannyHysteresisTile(nvcv::cuda::Tensor3DWrap<uchar> edges, int2 size, int3 tile, int *changed)
+{
+    __shared__ uchar sLabel[kCannyTileH][kCannyTileW];
+    __shared__ int   sChanged;
+
+    const int z  = tile.z;
+    const int x0 = tile.x * kCannyBlockW - 1;
+    const int y0 = tile.y * kCannyBlockH - 1;
+
+    const int tid = threadIdx.y * blockDim.x + threadIdx.x;
+
+    for (int i = tid; i < kCannyTileW * kCannyTileH; i += blockDim.x * blockDim.y)
+    {
+        const int x = x0 + i % kCannyTileW;
+        const int y = y0 + i / kCannyTileW;
+
+        sLabel[i / kCannyTileW][i % kCannyTileW]
+            = x >= 0 && x < size.x && y >= 0 && y < size.y ? __ldcg(edges.ptr(z, y, x)) : 0;
+    }
+
+    const int tx = threadIdx.x + 1;
+    const int ty = threadIdx.y + 1;
+
+    // pixels outside the image are labeled 0 and take part in the synchronization only
+    bool promoted = false;
+
+    for (;;)
+    {
+        if (tid == 0)
+        {
+            sChanged = 0;
+        }
+        __syncthreads();
+
+        if (sLabel[ty][tx] == kCannyWeak
+            && (sLabel[ty - 1][tx - 1] == kCannyStrong || sLabel[ty - 1][tx] == kCannyStrong
+                || sLabel[ty - 1][tx + 1] == kCannyStrong || sLabel[ty][tx - 1] == kCannyStrong
+                || sLabel[ty][tx + 1] == kCannyStrong || sLabel[ty + 1][tx - 1] == kCannyStrong
+                || sLabel[ty + 1][tx] == kCannyStrong || sLabel[ty + 1][tx + 1] == kCannyStrong))
+        {
+            sLabel[ty][tx] = kCannyStrong;
+            promoted       = true;
+            sChanged       = 1;
+        }
+        __syncthreads();
+
+        if (sChanged == 0)
+            break;
+
+        __syncthreads();
+    }
+
+    if (promoted)
+    {
+        *edges.ptr(z, y0 + ty, x0 + tx) = kCannyStrong;
+
+        if (threadIdx.x == 0 || threadIdx.y == 0 || threadIdx.x == blockDim.x - 1 || threadIdx.y == blockDim.y - 1)
+        {
+            *changed = 1;
+        }
+    }
+
+    // the block might go on with another tile
+    __syncthreads();
+}
+
+// One pass of the hysteresis, a block per tile. The flags are rotated as in the persistent kernel below, the pass
+// does nothing if the previous one didn't change any tile border, so that a sequence of passes can be enqueued at
+// once and stops on the device as soon as the hysteresis converged.
+__global__ void cannyHysteresisPass(nvcv::cuda::Tensor3DWrap<uchar> edges, int2 size, int *changed, int pass)
+{
+    if (__ldcg(changed + (pass + 2) % 3) == 0)
+    {
+        return;
+    }
+
+    if (blockIdx.x == 0 && blockIdx.y == 0 && blockIdx.z == 0 && threadIdx.x == 0 && threadIdx.y == 0)
+    {
+        changed[(pass + 1) % 3] = 0;
+    }
+
+    cannyHysteresisTile(edges, size, int3{(int)blockIdx.x, (int)blockIdx.y, (int)blockIdx.z}, changed + pass % 3);
+}
+
+// All the passes of the hysteresis, in a grid small enough for all its blocks to be resident. The blocks process
+// the tiles in turns and the grid is synchronized after each pass, until a pass doesn't change any tile border,
+// so there's no round-trip to the host between the passes. Three flags are rotated: the one of the current pass
+// is raised by its promotions, the one of the next pass is cleared, and the one of the previous pass might still
+// be read by blocks leaving the grid synchronization late.
+__global__ void cannyHysteresisPersistent(nvcv::cuda::Tensor3DWrap<uchar> edges, int2 size, int3 numTiles,
+                                          int *changed)
+{
+    cg::grid_group grid = cg::this_grid();
+
+    const int numTilesTotal = numTiles.x * numTiles.y * numTiles.z;
+
+    for (int pass = 0;; ++pass)
+    {
+        int *flag = changed + pass % 3;
+
+        if (blockIdx.x == 0 && threadIdx.x == 0 && threadIdx.y == 0)
+        {
+            changed[(pass + 1) % 3] = 0;
+        }
+
+        for (int t = blockIdx.x; t < numTilesTotal; t += gridDim.x)
+        {
+            const int3 tile{t % numTiles.x, (t / numTiles.x) % numTiles.y, t / (numTiles.x * numTiles.y)};
+            cannyHysteresisTile(edges, size, tile, flag);
+        }
+
+        grid.sync();
+
+        if (__ldcg(flag) == 0)
+        {
+            break;
+        }
+    }
+}
+
+// Weak pixels left after the hysteresis aren't connected to any edge.
+__global__ void cannyFinalize(nvcv::cuda::Tensor3DWrap<uchar> edges, int2 size)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if (x >= size.x || y >= size.y)
+        return;
+
+    uchar *p = edges.ptr((int)blockIdx.z, y, x);
+    if (*p != kCannyStrong)
+    {
+        *p = 0;
+    }
+}
+
+ErrorCode checkFormat(const ITensorDataStridedCuda &data, const char *name)
+{
+    DataFormat format = GetLegacyDataFormat(data.layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid " << name << " DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+    if (data.dtype() != nvcv::TYPE_U8)
+    {
+        LOG_ERROR("Invalid " << name << " DataType " << data.dtype() << ", it must be uint8");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+Canny::Canny(DataShape max_input_shape, DataShape max_output_shape)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+{
+    // flags raised by the hysteresis passes connecting pixels across tiles
+    setGpuWorkspaceSize(3 * sizeof(int));
+}
+
+size_t Canny::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 3 * sizeof(int);
+}
+
+ErrorCode Canny::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                       float thresholdLow, float thresholdHigh, int apertureSize, bool l2Gradient,
+                       cudaStream_t stream)
+{
+    if (!(apertureSize == 3 || apertureSize == 5 || apertureSize == 7))
+    {
+        LOG_ERROR("Invalid apertureSize " << apertureSize << ", it must be 3, 5 or 7");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    if (!(thresholdLow >= 0.f && thresholdHigh >= 0.f))
+    {
+        LOG_ERROR("Invalid thresholds " << thresholdLow << " and " << thresholdHigh << ", they must not be negative");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    for (auto [data, name] : {std::make_pair(&inData, "input"), std::make_pair(&outData, "output")})
+    {
+        if (ErrorCode err = checkFormat(*data, name); err != ErrorCode::SUCCESS)
+        {
+            return err;
+        }
+    }
+
+    if (outData.shape() != inData.shape())
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must be the input shape " << inData.shape());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    if (inAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid channel number " << inAccess->numChannels() << ", it must be 1");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const int2 size{inAccess->numCols(), inAccess->numRows()};
+    if (inAccess->numSamples() == 0 || size.x == 0 || size.y == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    // as in OpenCV, the thresholds can be given in any order
+    if (thresholdLow > thresholdHigh)
+    {
+        std::swap(thresholdLow, thresholdHigh);
+    }
+
+    auto src   = cuda::CreateBorderWrapNHW<const uchar, NVCV_BORDER_REPLICATE>(inData, 0);
+    auto edges = cuda::CreateTensorWrapNHW<uchar>(outData);
+
+    const SobelKernels kernels = GetSobelKernels(apertureSize, 1.f);
+
+    dim3 block(kCannyBlockW, kCannyBlockH);
+    dim3 grid(divUp(size.x, block.x), divUp(size.y, block.y), inAccess->numSamples());
+
+    switch (apertureSize)
+    {
+#define NVCV_CANNY_CASE(KSIZE)                                                                             \
+    case KSIZE:                                                                                            \
+        cannyNonMaxSuppression<KSIZE><<<grid, block, 0, stream>>>(src, edges, size, kernels, thresholdLow, \
+                                                                  thresholdHigh, l2Gradient);              \
+        break
+
+        NVCV_CANNY_CASE(3);
+        NVCV_CANNY_CASE(5);
+        NVCV_CANNY_CASE(7);
+
+#undef NVCV_CANNY_CASE
+    default:
+        break;
+    }
+    checkKernelErrors();
+
+    // Weak pixels are promoted along their connected components, a pass propagates them across a tile at least,
+    // and the passes are repeated until none of them crosses the tiles anymore.
+    GpuWorkspaceLease workspace = gpuWorkspace(stream);
+    int              *changed   = workspace.as<int>();
+
+    // While the stream is captured there's no way to wait for the flags, the passes are then enqueued up to a bound
+    // that covers edges running across the image and back, a path winding through the tiles more than that isn't
+    // followed to its end. Cooperative launches are left out of the capture as well.
+    cudaStreamCaptureStatus captureStatus;
+    checkCudaErrors(cudaStreamIsCapturing(stream, &captureStatus));
+    const bool capturing = captureStatus != cudaStreamCaptureStatusNone;
+
+    int device, cooperative = 0;
+    checkCudaErrors(cudaGetDevice(&device));
+    checkCudaErrors(cudaDeviceGetAttribute(&cooperative, cudaDevAttrCooperativeLaunch, device));
+
+    int3 numTiles{(int)grid.x, (int)grid.y, (int)grid.z};
+    int  numBlocks = 0;
+    if (cooperative && !capturing)
+    {
+        int numSMs, blocksPerSM;
+        checkCudaErrors(cudaDeviceGetAttribute(&numSMs, cudaDevAttrMultiProcessorCount, device));
+        checkCudaErrors(cudaOccupancyMaxActiveBlocksPerMultiprocessor(&blocksPerSM, cannyHysteresisPersistent,
+                                                                      block.x * block.y, 0));
+        numBlocks = std::min(numTiles.x * numTiles.y * numTiles.z, blocksPerSM * numSMs);
+    }
+
+    if (numBlocks > 0)
+    {
+        checkCudaErrors(cudaMemsetAsync(changed, 0, 3 * sizeof(int), stream));
+
+        int2  sizeArg = size;
+        void *args[]  = {&edges, &sizeArg, &numTiles, &changed};
+        checkCudaErrors(cudaLaunchCooperativeKernel((const void *)cannyHysteresisPersistent, dim3(numBlocks), block,
+                                                    args, 0, stream));
+    }
+    else
+    {
+        // the flag before the first pass is raised so that it runs
+        checkCudaErrors(cudaMemsetAsync(changed, 0, 3 * sizeof(int), stream));
+        checkCudaErrors(cudaMemsetAsync(changed + 2, 1, sizeof(int), stream));
+
+        const int numPasses   = 2 * (numTiles.x + numTiles.y);
+        int       pass        = 0;
+        int       hostChanged = 0;
+        do
+        {
+            for (int end = pass + numPasses; pass < end; ++pass)
+            {
+                cannyHysteresisPass<<<grid, block, 0, stream>>>(edges, size, changed, pass);
+                checkKernelErrors();
+            }
+
+            // out of capture, the flag of the last pass is checked once per sequence
+            if (!capturing)
+            {
+                checkCudaErrors(cudaMemcpyAsync(&hostChanged, changed + (pass - 1) % 3, sizeof(int),
+                                                cudaMemcpyDeviceToHost, stream));
+                checkCudaErrors(cudaStreamSynchronize(stream));
+            }
+        }
+        while (hostChanged != 0);
+    }
+
+    cannyFinalize<<<grid, block, 0, stream>>>(edges, size);
+    checkKernelErrors();
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -41,20 +41,34 @@ __global__ void channel_reorder_kernel(const cuda::ImageBatchVarShapeWrapNHWC<co
     if (dst_x >= out_width || dst_y >= out_height)
         return;
 
-    const int *chOrder = orders.ptr(batch_idx);
-
-    for (int ch = 0; ch < dst.numChannels(); ch++)
+    const int *chOrder    = orders.ptr(batch_idx);
+    const int  dstNumChan = dst.numChannels();
+
+    // All source channels are read before any is written, so that images can be reordered in place.  Loops over the
+    // 4 channels at most are unrolled to keep the pixel in registers.
+    T pix[4];
+#pragma unroll
+    for (int ch = 0; ch < 4; ch++)
     {
-        int src_ch = chOrder[ch];
+        int src_ch = ch < dstNumChan ? chOrder[ch] : -1;
         if (src_ch < 0)
         {
-            *dst.ptr(batch_idx, dst_y, dst_x, ch) = 0;
+            pix[ch] = 0;
         }
         else
         {
             NVCV_CUDA_ASSERT(0 <= src_ch && src_ch < src.numChannels(),
                              "Index to source channel %d is out of bounds (%d)", src_ch, src.numChannels());
-            *dst.ptr(batch_idx, dst_y, dst_x, ch) = *src.ptr(batch_idx, dst_y, dst_x, src_ch);
+            pix[ch] = *src.ptr(batch_idx, dst_y, dst_x, src_ch);
+        }
+    }
+
+#pragma unroll
+    for (int ch = 0; ch < 4; ch++)
+    {
+        if (ch < dstNumChan)
+        {
+            *dst.ptr(batch_idx, dst_y, dst_x, ch) = pix[ch];
         }
     }
 }
@@ -21,74 +21,180 @@
 #include "CvCudaLegacy.h"
 #include "CvCudaLegacyHelpers.hpp"
 
+#include "CompositeUtils.cuh"
 #include "CvCudaUtils.cuh"
 
+#include <cvcuda/OpComposite.h>
+
 using namespace nvcv;
 using namespace nvcv::legacy::helpers;
 using namespace nvcv::legacy::cuda_op;
 
-#define Inv_255              0.00392156862f // 1.f/255.f
-#define AlphaLerp(c0, c1, a) int(((int)c1 - (int)c0) * (int)a * Inv_255 + c0 + 0.5f)
+// Each thread blends kPixelsPerThread consecutive pixels of a row, loading the 8-bit mask values as a single
+// 32-bit word and the pixels as vectors when the rows are suitably aligned.
+constexpr int kPixelsPerThread = 4;
+
+template<int scn, int dcn, bool Premultiplied>
+__device__ void compositePixels(const uchar *fgRow, const uchar *bgRow, const uchar *maskRow, uchar *dstRow,
+                                int numPixels)
+{
+    constexpr int N = kPixelsPerThread;
+
+    if (numPixels == N && cuda::IsVectorAligned<uchar, N * scn>(fgRow) && cuda::IsVectorAligned<uchar, N * scn>(bgRow)
+        && cuda::IsVectorAligned<uchar, N>(maskRow) && cuda::IsVectorAligned<uchar, N * dcn>(dstRow))
+    {
+        const cuda::Vector<uchar, N * scn> fg   = cuda::LoadVector<N * scn>(fgRow);
+        const cuda::Vector<uchar, N * scn> bg   = cuda::LoadVector<N * scn>(bgRow);
+        const cuda::Vector<uchar, N>       mask = cuda::LoadVector<N>(maskRow);
+        cuda::Vector<uchar, N * dcn>       out;
+
+#pragma unroll
+        for (int p = 0; p < N; ++p)
+        {
+#pragma unroll
+            for (int c = 0; c < scn; ++c)
+            {
+                out[p * dcn + c] = AlphaBlend<Premultiplied>(bg[p * scn + c], fg[p * scn + c], mask[p]);
+            }
+            if constexpr (dcn > scn)
+            {
+                out[p * dcn + scn] = 255;
+            }
+        }
+
+        cuda::StoreVector(dstRow, out);
+    }
+    else
+    {
+        for (int p = 0; p < numPixels; ++p)
+        {
+#pragma unroll
+            for (int c = 0; c < scn; ++c)
+            {
+                dstRow[p * dcn + c] = AlphaBlend<Premultiplied>(bgRow[p * scn + c], fgRow[p * scn + c], maskRow[p]);
+            }
+            if constexpr (dcn > scn)
+            {
+                dstRow[p * dcn + scn] = 255;
+            }
+        }
+    }
+}
 
-template<typename T, typename U, typename D>
-__global__ void composite_kernel(const Ptr2dNHWC<T> fg, const Ptr2dNHWC<T> bg, const Ptr2dNHWC<U> fgMask,
-                                 Ptr2dNHWC<D> dst)
+// Wraps are indexed by byte, i.e. channel, within each row.
+template<int scn, int dcn, bool Premultiplied>
+__global__ void composite_kernel(const cuda::Tensor3DWrap<const uchar> fg, const cuda::Tensor3DWrap<const uchar> bg,
+                                 const cuda::Tensor3DWrap<const uchar> fgMask, cuda::Tensor3DWrap<uchar> dst,
+                                 int width, int height)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int dst_x     = (blockIdx.x * blockDim.x + threadIdx.x) * kPixelsPerThread;
+    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
 
-    if (dst_x >= dst.cols || dst_y >= dst.rows)
+    if (dst_x >= width || dst_y >= height)
         return;
 
+    compositePixels<scn, dcn, Premultiplied>(
+        fg.ptr(batch_idx, dst_y, dst_x * scn), bg.ptr(batch_idx, dst_y, dst_x * scn),
+        fgMask.ptr(batch_idx, dst_y, dst_x), dst.ptr(batch_idx, dst_y, dst_x * dcn),
+        min(kPixelsPerThread, width - dst_x));
+}
+
+// Blends the foreground into the background in place, with the top-left corner of the foreground at offset.
+// Parts of the foreground outside the background are skipped, and a 4th background channel is left unchanged.
+template<int bcn, bool Premultiplied>
+__global__ void composite_roi_kernel(const cuda::Tensor3DWrap<const uchar> fg,
+                                     const cuda::Tensor3DWrap<const uchar> fgMask, cuda::Tensor3DWrap<uchar> bg,
+                                     int2 fgSize, int2 bgSize, int2 offset)
+{
+    constexpr int scn = 3;
+
+    const int fg_x      = blockIdx.x * blockDim.x + threadIdx.x;
+    const int fg_y      = blockIdx.y * blockDim.y + threadIdx.y;
     const int batch_idx = get_batch_idx();
 
-    int dst_ch = dst.ch;
-    int src_ch = fg.ch;
+    const int bg_x = fg_x + offset.x;
+    const int bg_y = fg_y + offset.y;
+
+    if (fg_x >= fgSize.x || fg_y >= fgSize.y || bg_x < 0 || bg_x >= bgSize.x || bg_y < 0 || bg_y >= bgSize.y)
+        return;
 
-    U mask_val = *fgMask.ptr(batch_idx, dst_y, dst_x);
-    T bg_val   = *bg.ptr(batch_idx, dst_y, dst_x);
-    T fg_val   = *fg.ptr(batch_idx, dst_y, dst_x);
-    D out;
+    const uchar *fgPix   = fg.ptr(batch_idx, fg_y, fg_x * scn);
+    const int    maskVal = *fgMask.ptr(batch_idx, fg_y, fg_x);
+    uchar       *bgPix   = bg.ptr(batch_idx, bg_y, bg_x * bcn);
 
-    for (int i = 0; i < src_ch; i++)
+#pragma unroll
+    for (int c = 0; c < scn; ++c)
     {
-        uint8_t c0               = cuda::GetElement(bg_val, i);
-        uint8_t c1               = cuda::GetElement(fg_val, i);
-        cuda::GetElement(out, i) = AlphaLerp(c0, c1, mask_val);
+        bgPix[c] = AlphaBlend<Premultiplied>(bgPix[c], fgPix[c], maskVal);
     }
-    if (src_ch == 3 && dst_ch == 4)
-        cuda::GetElement(out, 3) = 255;
-    *dst.ptr(batch_idx, dst_y, dst_x) = out;
+}
+
+template<typename T>
+cuda::Tensor3DWrap<T> CreateRowWrap(const nvcv::TensorDataAccessStridedImagePlanar &data)
+{
+    return cuda::Tensor3DWrap<T>(data.sampleData(0), static_cast<int>(data.sampleStride()),
+                                 static_cast<int>(data.rowStride()));
 }
 
 template<typename T, int scn, int dcn> // uchar
 void composite(const nvcv::TensorDataAccessStridedImagePlanar &foregroundData,
                const nvcv::TensorDataAccessStridedImagePlanar &backgroundData,
                const nvcv::TensorDataAccessStridedImagePlanar &fgMaskData,
-               const nvcv::TensorDataAccessStridedImagePlanar &outData, cudaStream_t stream)
+               const nvcv::TensorDataAccessStridedImagePlanar &outData, bool premultiplied, cudaStream_t stream)
 {
     const int batch_size = foregroundData.numSamples();
     const int out_width  = outData.numCols();
     const int out_height = outData.numRows();
 
     dim3 blockSize(16, 16, 1);
-    dim3 gridSize(divUp(out_width, blockSize.x), divUp(out_height, blockSize.y), batch_size);
-
-    typedef typename cuda::MakeType<T, scn> src_type;
-    typedef typename cuda::MakeType<T, dcn> dst_type;
+    dim3 gridSize(divUp(out_width, blockSize.x * kPixelsPerThread), divUp(out_height, blockSize.y), batch_size);
 
-    Ptr2dNHWC<src_type> fg_ptr(foregroundData);
-    Ptr2dNHWC<src_type> bg_ptr(backgroundData);
-    Ptr2dNHWC<T>        fgMask_ptr(fgMaskData);
-    Ptr2dNHWC<dst_type> dst_ptr(outData);
+    auto fg_ptr     = CreateRowWrap<const T>(foregroundData);
+    auto bg_ptr     = CreateRowWrap<const T>(backgroundData);
+    auto fgMask_ptr = CreateRowWrap<const T>(fgMaskData);
+    auto dst_ptr    = CreateRowWrap<T>(outData);
 
-    composite_kernel<<<gridSize, blockSize, 0, stream>>>(fg_ptr, bg_ptr, fgMask_ptr, dst_ptr);
+    if (premultiplied)
+    {
+        composite_kernel<scn, dcn, true>
+            <<<gridSize, blockSize, 0, stream>>>(fg_ptr, bg_ptr, fgMask_ptr, dst_ptr, out_width, out_height);
+    }
+    else
+    {
+        composite_kernel<scn, dcn, false>
+            <<<gridSize, blockSize, 0, stream>>>(fg_ptr, bg_ptr, fgMask_ptr, dst_ptr, out_width, out_height);
+    }
     checkKernelErrors();
+}
+
+template<typename T, int bcn> // uchar
+void compositeROI(const nvcv::TensorDataAccessStridedImagePlanar &foregroundData,
+                  const nvcv::TensorDataAccessStridedImagePlanar &fgMaskData,
+                  const nvcv::TensorDataAccessStridedImagePlanar &backgroundData, int2 offset, bool premultiplied,
+                  cudaStream_t stream)
+{
+    int2 fgSize{foregroundData.numCols(), foregroundData.numRows()};
+    int2 bgSize{backgroundData.numCols(), backgroundData.numRows()};
+
+    dim3 blockSize(32, 8, 1);
+    dim3 gridSize(divUp(fgSize.x, blockSize.x), divUp(fgSize.y, blockSize.y), foregroundData.numSamples());
+
+    auto fg_ptr     = CreateRowWrap<const T>(foregroundData);
+    auto fgMask_ptr = CreateRowWrap<const T>(fgMaskData);
+    auto bg_ptr     = CreateRowWrap<T>(backgroundData);
 
-#ifdef CUDA_DEBUG_LOG
-    checkCudaErrors(cudaStreamSynchronize(stream));
-    checkCudaErrors(cudaGetLastError());
-#endif
+    if (premultiplied)
+    {
+        composite_roi_kernel<bcn, true>
+            <<<gridSize, blockSize, 0, stream>>>(fg_ptr, fgMask_ptr, bg_ptr, fgSize, bgSize, offset);
+    }
+    else
+    {
+        composite_roi_kernel<bcn, false>
+            <<<gridSize, blockSize, 0, stream>>>(fg_ptr, fgMask_ptr, bg_ptr, fgSize, bgSize, offset);
+    }
+    checkKernelErrors();
 }
 
 namespace nvcv::legacy::cuda_op {
@@ -97,6 +203,19 @@ ErrorCode Composite::infer(const ITensorDataStridedCuda &foreground, const ITens
                            const ITensorDataStridedCuda &fgMask, const ITensorDataStridedCuda &outData,
                            cudaStream_t stream)
 {
+    return infer(foreground, background, fgMask, outData, 0, stream);
+}
+
+ErrorCode Composite::infer(const ITensorDataStridedCuda &foreground, const ITensorDataStridedCuda &background,
+                           const ITensorDataStridedCuda &fgMask, const ITensorDataStridedCuda &outData, int flags,
+                           cudaStream_t stream)
+{
+    if ((flags & ~CVCUDA_COMPOSITE_PREMULTIPLIED) != 0)
+    {
+        LOG_ERROR("Invalid flags " << flags);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
     DataFormat background_format = GetLegacyDataFormat(background.layout());
     DataFormat foreground_format = GetLegacyDataFormat(foreground.layout());
     DataFormat fgMask_format     = GetLegacyDataFormat(fgMask.layout());
@@ -164,7 +283,8 @@ ErrorCode Composite::infer(const ITensorDataStridedCuda &foreground, const ITens
     typedef void (*func_t)(const nvcv::TensorDataAccessStridedImagePlanar &foregroundData,
                            const nvcv::TensorDataAccessStridedImagePlanar &backgroundData,
                            const nvcv::TensorDataAccessStridedImagePlanar &fgMaskData,
-                           const nvcv::TensorDataAccessStridedImagePlanar &outData, cudaStream_t stream);
+                           const nvcv::TensorDataAccessStridedImagePlanar &outData, bool premultiplied,
+                           cudaStream_t stream);
 
     static const func_t funcs[6][4] = {
         { 0 /*composite<uchar,1,1>*/,  0 /*composite<uchar,2,2>*/,             composite<uchar,3, 3>, composite<uchar, 3, 4>},
@@ -182,7 +302,94 @@ ErrorCode Composite::infer(const ITensorDataStridedCuda &foreground, const ITens
     const func_t func = funcs[foreground_data_type][channels - 1];
     NVCV_ASSERT(func != 0);
 
-    func(*foregroundAccess, *backgroundAccess, *fgMaskAccess, *outAccess, stream);
+    func(*foregroundAccess, *backgroundAccess, *fgMaskAccess, *outAccess, (flags & CVCUDA_COMPOSITE_PREMULTIPLIED) != 0,
+         stream);
+
+    return SUCCESS;
+}
+
+ErrorCode Composite::inferROI(const ITensorDataStridedCuda &foreground, const ITensorDataStridedCuda &fgMask,
+                              const ITensorDataStridedCuda &inOut, int2 offset, int flags, cudaStream_t stream)
+{
+    if ((flags & ~CVCUDA_COMPOSITE_PREMULTIPLIED) != 0)
+    {
+        LOG_ERROR("Invalid flags " << flags);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    DataFormat foreground_format = GetLegacyDataFormat(foreground.layout());
+    DataFormat fgMask_format     = GetLegacyDataFormat(fgMask.layout());
+    DataFormat inOut_format      = GetLegacyDataFormat(inOut.layout());
+
+    if (!(foreground_format == fgMask_format && foreground_format == inOut_format))
+    {
+        LOG_ERROR("Invalid DataFormat between foreground (" << foreground_format << "), foreground mask ("
+                                                            << fgMask_format << ") and background (" << inOut_format
+                                                            << ")");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!(foreground_format == kNHWC || foreground_format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << foreground_format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!(GetLegacyDataType(foreground.dtype()) == kCV_8U && GetLegacyDataType(fgMask.dtype()) == kCV_8U
+          && GetLegacyDataType(inOut.dtype()) == kCV_8U))
+    {
+        LOG_ERROR("Invalid DataType " << GetLegacyDataType(foreground.dtype()));
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto foregroundAccess = TensorDataAccessStridedImagePlanar::Create(foreground);
+    NVCV_ASSERT(foregroundAccess);
+
+    auto fgMaskAccess = TensorDataAccessStridedImagePlanar::Create(fgMask);
+    NVCV_ASSERT(fgMaskAccess);
+
+    auto inOutAccess = TensorDataAccessStridedImagePlanar::Create(inOut);
+    NVCV_ASSERT(inOutAccess);
+
+    const int background_channels = inOutAccess->numChannels();
+    if (!(foregroundAccess->numChannels() == 3 && fgMaskAccess->numChannels() == 1
+          && (background_channels == 3 || background_channels == 4)))
+    {
+        LOG_ERROR("Invalid channel number, foreground must have 3 channels, its mask 1 and the background 3 or 4");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (foregroundAccess->numSamples() != fgMaskAccess->numSamples()
+        || foregroundAccess->numSamples() != inOutAccess->numSamples())
+    {
+        LOG_ERROR("Invalid number of samples, foreground, its mask and the background must have the same");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (foregroundAccess->numCols() != fgMaskAccess->numCols()
+        || foregroundAccess->numRows() != fgMaskAccess->numRows())
+    {
+        LOG_ERROR("Invalid foreground mask shape " << fgMask.shape() << ", it must have the foreground size");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    // Nothing to do when the foreground doesn't overlap the background
+    if (offset.x >= inOutAccess->numCols() || offset.y >= inOutAccess->numRows()
+        || offset.x + foregroundAccess->numCols() <= 0 || offset.y + foregroundAccess->numRows() <= 0)
+    {
+        return SUCCESS;
+    }
+
+    const bool premultiplied = (flags & CVCUDA_COMPOSITE_PREMULTIPLIED) != 0;
+
+    if (background_channels == 3)
+    {
+        compositeROI<uchar, 3>(*foregroundAccess, *fgMaskAccess, *inOutAccess, offset, premultiplied, stream);
+    }
+    else
+    {
+        compositeROI<uchar, 4>(*foregroundAccess, *fgMaskAccess, *inOutAccess, offset, premultiplied, stream);
+    }
 
     return SUCCESS;
 }
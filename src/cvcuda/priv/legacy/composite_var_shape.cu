@@ -21,15 +21,13 @@
 #include "CvCudaLegacy.h"
 #include "CvCudaLegacyHelpers.hpp"
 
+#include "CompositeUtils.cuh"
 #include "CvCudaUtils.cuh"
 
 using namespace nvcv;
 using namespace nvcv::legacy::helpers;
 using namespace nvcv::legacy::cuda_op;
 
-#define Inv_255              0.00392156862f // 1.f/255.f
-#define AlphaLerp(c0, c1, a) int(((int)c1 - (int)c0) * (int)a * Inv_255 + c0 + 0.5f)
-
 template<typename T, typename U, typename D>
 __global__ void composite_kernel(const cuda::ImageBatchVarShapeWrap<T> fg, const cuda::ImageBatchVarShapeWrap<T> bg,
                                  const cuda::ImageBatchVarShapeWrap<U> fgMask, cuda::ImageBatchVarShapeWrap<D> dst)
@@ -53,7 +51,7 @@ __global__ void composite_kernel(const cuda::ImageBatchVarShapeWrap<T> fg, const
     {
         uint8_t c0               = cuda::GetElement(bg_val, i);
         uint8_t c1               = cuda::GetElement(fg_val, i);
-        cuda::GetElement(out, i) = AlphaLerp(c0, c1, mask_val);
+        cuda::GetElement(out, i) = AlphaBlend<false>(c0, c1, mask_val);
     }
     if (src_ch == 3 && dst_ch == 4)
         cuda::GetElement(out, 3) = 255;
@@ -21,46 +21,134 @@
 #include "CvCudaLegacy.h"
 #include "CvCudaLegacyHelpers.hpp"
 
+#include "ChannelOrder.cuh"
 #include "CvCudaUtils.cuh"
 
 #include <nvcv/IImage.hpp>
 #include <nvcv/IImageData.hpp>
+#include <nvcv/cuda/Pointwise.hpp>
 #include <nvcv/cuda/TypeTraits.hpp>
+#include <nvcv/cuda/VectorizedAccess.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
 
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
 
-template<typename SRC_TYPE, typename DST_TYPE, typename S>
-struct Convertor
+// Half-precision values are scaled in float, as __half has no arithmetic operators in host code
+template<typename T>
+using ScaleType = std::conditional_t<std::is_same_v<T, __half>, float, T>;
+
+// alpha * src + beta computed in S, then saturated to the destination type, as a single composed pointwise op
+template<typename DST_TYPE, typename S>
+auto MakeConvertor(double alpha, double beta)
+{
+    return nvcv::cuda::Compose(
+        nvcv::cuda::ScaleShiftOp<S>{nvcv::cuda::SaturateCast<S>(alpha), nvcv::cuda::SaturateCast<S>(beta)},
+        nvcv::cuda::SaturateOp<DST_TYPE>{});
+}
+
+template<class SrcWrapper, class DstWrapper, class UnOp>
+__global__ void convertFormat(SrcWrapper src, DstWrapper dst, UnOp op, int2 size, int numSamples)
 {
-    S alpha;
-    S beta;
+    const int src_x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int src_y = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if (src_x >= size.x || src_y >= size.y)
+        return;
 
-    __device__ __forceinline__ DST_TYPE operator()(SRC_TYPE src) const
+    for (int batch_idx = get_batch_idx(); batch_idx < numSamples; batch_idx += gridDim.z)
     {
-        return nvcv::cuda::SaturateCast<DST_TYPE>(alpha * src + beta);
+        *dst.ptr(batch_idx, src_y, src_x) = op(*src.ptr(batch_idx, src_y, src_x));
     }
-};
+}
 
-template<class SrcWrapper, class DstWrapper, class UnOp>
-__global__ void convertFormat(SrcWrapper src, DstWrapper dst, UnOp op, int2 size)
+// Each thread converts N consecutive channel values of a row, the scale is the same for all channels.
+template<int N, class SrcWrapper, class DstWrapper, class UnOp>
+__global__ void convertFormatVector(SrcWrapper src, DstWrapper dst, UnOp op, int rowLength, int rows,
+                                    int numSamples)
 {
-    const int src_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    const int chunk_idx = blockIdx.x * blockDim.x + threadIdx.x;
     const int src_y     = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
+
+    if (src_y >= rows)
+        return;
+
+    for (int batch_idx = get_batch_idx(); batch_idx < numSamples; batch_idx += gridDim.z)
+    {
+        nvcv::cuda::TransformRowVector<N>(dst.ptr(batch_idx, src_y), src.ptr(batch_idx, src_y), rowLength, chunk_idx,
+                                          op);
+    }
+}
+
+// Each thread converts the channels of a pixel, reading input channel order[c] for output channel c.  Channels are
+// accessed one by one, so that half types, which have no compound types, are handled as well.  All channels are
+// read before any is written, as operators may run in place.
+template<int NC, class SrcWrapper, class DstWrapper, class UnOp>
+__global__ void convertFormatReorder(SrcWrapper src, DstWrapper dst, UnOp op, ChannelOrder order, int2 size,
+                                     int numSamples)
+{
+    const int src_x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int src_y = blockIdx.y * blockDim.y + threadIdx.y;
 
     if (src_x >= size.x || src_y >= size.y)
         return;
 
-    *dst.ptr(batch_idx, src_y, src_x) = op(*src.ptr(batch_idx, src_y, src_x));
+    for (int batch_idx = get_batch_idx(); batch_idx < numSamples; batch_idx += gridDim.z)
+    {
+        decltype(op(*src.ptr(0, 0, 0, 0))) out[NC];
+
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            out[c] = op(*src.ptr(batch_idx, src_y, src_x, order.channel[c]));
+        }
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            *dst.ptr(batch_idx, src_y, src_x, c) = out[c];
+        }
+    }
 }
 
-template<typename DT_SOURCE, typename DT_DEST, int NC>
-void convertToScaleCN(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
-                      const double alpha, const double beta, cudaStream_t stream)
+// Each thread converts the channels of an interleaved pixel with the scale and shift of each channel.  The
+// destination wrap addresses channels with their own stride, so that it's either interleaved or planar.
+template<int NC, typename DT_DEST, class SrcWrapper, class DstWrapper>
+__global__ void convertFormatPerChannel(SrcWrapper src, DstWrapper dst, const float *alpha, const float *beta,
+                                        int2 size, int numSamples)
+{
+    const int src_x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int src_y = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if (src_x >= size.x || src_y >= size.y)
+        return;
+
+    float a[NC], b[NC];
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
+    {
+        a[c] = alpha[c];
+        b[c] = beta[c];
+    }
+
+    for (int batch_idx = get_batch_idx(); batch_idx < numSamples; batch_idx += gridDim.z)
+    {
+        const auto pix = *src.ptr(batch_idx, src_y, src_x);
+
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            *dst.ptr(batch_idx, src_y, src_x, c)
+                = nvcv::cuda::SaturateCast<DT_DEST>(a[c] * nvcv::cuda::GetElement(pix, c) + b[c]);
+        }
+    }
+}
+
+template<typename DT_SOURCE, typename DT_DEST, int NC, typename StrideType>
+void convertToScaleCNImpl(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
+                          const double alpha, const double beta, const ChannelOrder &order, cudaStream_t stream)
 {
     auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
     NVCV_ASSERT(inAccess);
@@ -69,42 +157,93 @@ void convertToScaleCN(const nvcv::ITensorDataStridedCuda &inData, const nvcv::IT
     const int  batch_size = inAccess->numSamples();
 
     dim3 block(32, 8);
-    dim3 grid(divUp(size.x, block.x), divUp(size.y, block.y), batch_size);
+    dim3 grid(divUp(size.x, block.x), divUp(size.y, block.y), BatchGridDim(batch_size));
+
+    using DT_AB = decltype(float() * ScaleType<DT_SOURCE>() * ScaleType<DT_DEST>()); //pick correct scalar
+
+    constexpr int N = nvcv::cuda::VectorWidth<1, DT_SOURCE, DT_DEST>;
 
-    using DT_AB         = decltype(float() * DT_SOURCE() * DT_DEST()); //pick correct scalar
-    using SRC_DATA_TYPE = nvcv::cuda::MakeType<DT_SOURCE, NC>;
-    using DST_DATA_TYPE = nvcv::cuda::MakeType<DT_DEST, NC>;
+    // There are no compound half types, half rows are always converted as flat rows, that fall back to scalar
+    // accesses on their own when not vector aligned
+    constexpr bool isHalf = std::is_same_v<DT_SOURCE, __half> || std::is_same_v<DT_DEST, __half>;
 
-    Convertor<SRC_DATA_TYPE, DST_DATA_TYPE, DT_AB> op;
+    if (!order.isIdentity())
+    {
+        auto op = MakeConvertor<DT_DEST, DT_AB>(alpha, beta);
+
+        auto src = nvcv::cuda::CreateTensorWrapNHWC<const DT_SOURCE, StrideType>(inData);
+        auto dst = nvcv::cuda::CreateTensorWrapNHWC<DT_DEST, StrideType>(outData);
+
+        convertFormatReorder<NC><<<grid, block, 0, stream>>>(src, dst, op, order, size, batch_size);
+        return;
+    }
+
+    if (isHalf
+        || (nvcv::cuda::IsVectorAligned<DT_SOURCE, N>(inData, NC)
+            && nvcv::cuda::IsVectorAligned<DT_DEST, N>(outData, NC)))
+    {
+        auto op = MakeConvertor<DT_DEST, DT_AB>(alpha, beta);
 
-    auto src = nvcv::cuda::CreateTensorWrapNHW<SRC_DATA_TYPE>(inData);
-    auto dst = nvcv::cuda::CreateTensorWrapNHW<DST_DATA_TYPE>(outData);
+        auto src = nvcv::cuda::CreateTensorWrapNHW<const DT_SOURCE, StrideType>(inData);
+        auto dst = nvcv::cuda::CreateTensorWrapNHW<DT_DEST, StrideType>(outData);
 
-    op.alpha = nvcv::cuda::SaturateCast<DT_AB>(alpha);
-    op.beta  = nvcv::cuda::SaturateCast<DT_AB>(beta);
-    convertFormat<<<grid, block, 0, stream>>>(src, dst, op, size);
+        const int rowLength = size.x * NC;
+
+        dim3 vecGrid(divUp(divUp(rowLength, N), block.x), divUp(size.y, block.y), BatchGridDim(batch_size));
+        convertFormatVector<N><<<vecGrid, block, 0, stream>>>(src, dst, op, rowLength, size.y, batch_size);
+        return;
+    }
+
+    if constexpr (!isHalf)
+    {
+        using SRC_DATA_TYPE = nvcv::cuda::MakeType<DT_SOURCE, NC>;
+        using DST_DATA_TYPE = nvcv::cuda::MakeType<DT_DEST, NC>;
+
+        auto op = MakeConvertor<DST_DATA_TYPE, DT_AB>(alpha, beta);
+
+        auto src = nvcv::cuda::CreateTensorWrapNHW<SRC_DATA_TYPE, StrideType>(inData);
+        auto dst = nvcv::cuda::CreateTensorWrapNHW<DST_DATA_TYPE, StrideType>(outData);
+
+        convertFormat<<<grid, block, 0, stream>>>(src, dst, op, size, batch_size);
+    }
+}
+
+// 64-bit offsets are only used for tensors larger than 2 GB
+template<typename DT_SOURCE, typename DT_DEST, int NC>
+void convertToScaleCN(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
+                      const double alpha, const double beta, const ChannelOrder &order, cudaStream_t stream)
+{
+    if (nvcv::cuda::NeedsLargeOffsets(inData) || nvcv::cuda::NeedsLargeOffsets(outData))
+    {
+        convertToScaleCNImpl<DT_SOURCE, DT_DEST, NC, int64_t>(inData, outData, alpha, beta, order, stream);
+    }
+    else
+    {
+        convertToScaleCNImpl<DT_SOURCE, DT_DEST, NC, int>(inData, outData, alpha, beta, order, stream);
+    }
 }
 
 template<typename DT_SOURCE, typename DT_DEST> // <uchar, float> <float double>
 void convertToScale(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
-                    int numChannels, const double alpha, const double beta, cudaStream_t stream)
+                    int numChannels, const double alpha, const double beta, const ChannelOrder &order,
+                    cudaStream_t stream)
 {
     switch (numChannels)
     {
     case 1:
-        convertToScaleCN<DT_SOURCE, DT_DEST, 1>(inData, outData, alpha, beta, stream);
+        convertToScaleCN<DT_SOURCE, DT_DEST, 1>(inData, outData, alpha, beta, order, stream);
         break;
 
     case 2:
-        convertToScaleCN<DT_SOURCE, DT_DEST, 2>(inData, outData, alpha, beta, stream);
+        convertToScaleCN<DT_SOURCE, DT_DEST, 2>(inData, outData, alpha, beta, order, stream);
         break;
 
     case 3:
-        convertToScaleCN<DT_SOURCE, DT_DEST, 3>(inData, outData, alpha, beta, stream);
+        convertToScaleCN<DT_SOURCE, DT_DEST, 3>(inData, outData, alpha, beta, order, stream);
         break;
 
     case 4:
-        convertToScaleCN<DT_SOURCE, DT_DEST, 4>(inData, outData, alpha, beta, stream);
+        convertToScaleCN<DT_SOURCE, DT_DEST, 4>(inData, outData, alpha, beta, order, stream);
         break;
 
     default:
@@ -118,6 +257,224 @@ void convertToScale(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITen
 #endif
 }
 
+template<typename DT_DEST, int NC, typename StrideType>
+void convertToPerChannelCNImpl(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
+                               const float *alpha, const float *beta, cudaStream_t stream)
+{
+    auto inAccess  = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(inAccess && outAccess);
+
+    const int2 size       = {inAccess->numCols(), inAccess->numRows()};
+    const int  batch_size = inAccess->numSamples();
+
+    dim3 block(32, 8);
+    dim3 grid(divUp(size.x, block.x), divUp(size.y, block.y), BatchGridDim(batch_size));
+
+    auto src = nvcv::cuda::CreateTensorWrapNHW<const nvcv::cuda::MakeType<uchar, NC>, StrideType>(inData);
+
+    // N, H, W and C strides, C is innermost for interleaved outputs and outermost but N for planar ones
+    nvcv::cuda::TensorWrapT<DT_DEST, StrideType, -1, -1, -1, -1> dst(
+        outData.basePtr(), static_cast<StrideType>(outAccess->sampleStride()),
+        static_cast<StrideType>(outAccess->rowStride()), static_cast<StrideType>(outAccess->colStride()),
+        static_cast<StrideType>(outAccess->chStride()));
+
+    convertFormatPerChannel<NC, DT_DEST><<<grid, block, 0, stream>>>(src, dst, alpha, beta, size, batch_size);
+}
+
+template<typename DT_DEST, int NC>
+void convertToPerChannelCN(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
+                           const float *alpha, const float *beta, cudaStream_t stream)
+{
+    if (nvcv::cuda::NeedsLargeOffsets(inData) || nvcv::cuda::NeedsLargeOffsets(outData))
+    {
+        convertToPerChannelCNImpl<DT_DEST, NC, int64_t>(inData, outData, alpha, beta, stream);
+    }
+    else
+    {
+        convertToPerChannelCNImpl<DT_DEST, NC, int>(inData, outData, alpha, beta, stream);
+    }
+}
+
+// Per-channel parameters must hold one packed value per channel, whatever their rank
+static bool IsPerChannelParam(const nvcv::ITensorDataStridedCuda &data, int channels)
+{
+    if (data.dtype() != nvcv::TYPE_F32 || data.shape(data.rank() - 1) != channels
+        || data.stride(data.rank() - 1) != sizeof(float))
+    {
+        return false;
+    }
+    for (int d = 0; d < data.rank() - 1; ++d)
+    {
+        if (data.shape(d) != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//******************** Multiple outputs
+
+#define MAX_CONVERT_OUTPUTS 8
+
+// Output of a single convertFormatMulti launch.  It's addressed in bytes with its own strides, so that it's either
+// interleaved or planar, and its type is only known at run time so that any mix of output types needs no kernel
+// of its own.
+struct ConvertOutput
+{
+    NVCVByte                       *basePtr;
+    int64_t                         sampleStride, rowStride, colStride, chStride;
+    nvcv::legacy::cuda_op::DataType dtype; // output types are all supported, see GetLegacyDataType
+    float                           alpha[4], beta[4];
+    int8_t                          channel[4];
+};
+
+struct ConvertOutputs
+{
+    ConvertOutput out[MAX_CONVERT_OUTPUTS];
+    int           count;
+};
+
+template<typename T>
+__device__ inline void storeConverted(NVCVByte *ptr, float val)
+{
+    *reinterpret_cast<T *>(ptr) = nvcv::cuda::SaturateCast<T>(val);
+}
+
+// Each thread reads an input pixel once and writes it to all outputs of the launch.  The type switch is uniform
+// across the grid, so it doesn't diverge.
+template<int NC, class SrcWrapper>
+__global__ void convertFormatMulti(SrcWrapper src, const ConvertOutputs outputs, int2 size, int numSamples)
+{
+    const int src_x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int src_y = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if (src_x >= size.x || src_y >= size.y)
+        return;
+
+    for (int batch_idx = get_batch_idx(); batch_idx < numSamples; batch_idx += gridDim.z)
+    {
+        const auto pix = *src.ptr(batch_idx, src_y, src_x);
+
+        float in[NC];
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            in[c] = nvcv::cuda::GetElement(pix, c);
+        }
+
+        for (int o = 0; o < outputs.count; ++o)
+        {
+            const ConvertOutput &out = outputs.out[o];
+
+            NVCVByte *ptr
+                = out.basePtr + batch_idx * out.sampleStride + src_y * out.rowStride + src_x * out.colStride;
+
+#pragma unroll
+            for (int c = 0; c < NC; ++c, ptr += out.chStride)
+            {
+                // Selected without indexing the pixel at run time, which would move it to local memory
+                float val = in[0];
+#pragma unroll
+                for (int k = 1; k < NC; ++k)
+                {
+                    val = out.channel[c] == k ? in[k] : val;
+                }
+                val = out.alpha[c] * val + out.beta[c];
+
+                switch (out.dtype)
+                {
+                case kCV_8U:
+                    storeConverted<uchar>(ptr, val);
+                    break;
+                case kCV_8S:
+                    storeConverted<schar>(ptr, val);
+                    break;
+                case kCV_16U:
+                    storeConverted<ushort>(ptr, val);
+                    break;
+                case kCV_16S:
+                    storeConverted<short>(ptr, val);
+                    break;
+                case kCV_32S:
+                    storeConverted<int>(ptr, val);
+                    break;
+                case kCV_32F:
+                    storeConverted<float>(ptr, val);
+                    break;
+                case kCV_64F:
+                    storeConverted<double>(ptr, val);
+                    break;
+                case kCV_16F:
+                    storeConverted<__half>(ptr, val);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+template<typename T, int NC, typename StrideType>
+void convertToMultiCNImpl(const nvcv::ITensorDataStridedCuda        &inData,
+                          const nvcv::ITensorDataStridedCuda *const *outData, const NVCVConvertToParams *params,
+                          const ChannelOrder *order, int numOutputs, cudaStream_t stream)
+{
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+    NVCV_ASSERT(numOutputs > 0 && numOutputs <= MAX_CONVERT_OUTPUTS);
+
+    const int2 size       = {inAccess->numCols(), inAccess->numRows()};
+    const int  batch_size = inAccess->numSamples();
+
+    ConvertOutputs outputs;
+    outputs.count = numOutputs;
+    for (int o = 0; o < numOutputs; ++o)
+    {
+        auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*outData[o]);
+        NVCV_ASSERT(outAccess);
+
+        ConvertOutput &out = outputs.out[o];
+
+        out.basePtr      = outData[o]->basePtr();
+        out.sampleStride = outAccess->sampleStride();
+        out.rowStride    = outAccess->rowStride();
+        out.colStride    = outAccess->colStride();
+        out.chStride     = outAccess->chStride();
+        out.dtype        = GetLegacyDataType(outData[o]->dtype());
+        for (int c = 0; c < 4; ++c)
+        {
+            out.alpha[c]   = params[o].alpha[c];
+            out.beta[c]    = params[o].beta[c];
+            out.channel[c] = order[o].channel[c];
+        }
+    }
+
+    dim3 block(32, 8);
+    dim3 grid(divUp(size.x, block.x), divUp(size.y, block.y), BatchGridDim(batch_size));
+
+    auto src = nvcv::cuda::CreateTensorWrapNHW<const nvcv::cuda::MakeType<T, NC>, StrideType>(inData);
+
+    convertFormatMulti<NC><<<grid, block, 0, stream>>>(src, outputs, size, batch_size);
+    checkKernelErrors();
+}
+
+// Only the input is addressed with a tensor wrap, the outputs always use 64-bit byte offsets
+template<typename T, int NC>
+void convertToMultiCN(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda *const *outData,
+                      const NVCVConvertToParams *params, const ChannelOrder *order, int numOutputs,
+                      cudaStream_t stream)
+{
+    if (nvcv::cuda::NeedsLargeOffsets(inData))
+    {
+        convertToMultiCNImpl<T, NC, int64_t>(inData, outData, params, order, numOutputs, stream);
+    }
+    else
+    {
+        convertToMultiCNImpl<T, NC, int>(inData, outData, params, order, numOutputs, stream);
+    }
+}
+
 namespace nvcv::legacy::cuda_op {
 
 size_t ConvertTo::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
@@ -126,8 +483,18 @@ size_t ConvertTo::calBufferSize(DataShape max_input_shape, DataShape max_output_
 }
 
 ErrorCode ConvertTo::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
-                           const double alpha, const double beta, cudaStream_t stream)
+                           const double alpha, const double beta, const ChannelOrder &order, cudaStream_t stream)
 {
+    LaunchPlanKey key;
+    key.add(inData).add(outData);
+
+    Plan plan;
+    if (m_plans.find(key, plan))
+    {
+        plan.func(inData, outData, plan.numChannels, alpha, beta, order, stream);
+        return ErrorCode::SUCCESS;
+    }
+
     cuda_op::DataFormat input_format    = GetLegacyDataFormat(inData.layout());
     cuda_op::DataFormat output_format   = GetLegacyDataFormat(outData.layout());
     cuda_op::DataType   input_datatype  = GetLegacyDataType(inData.dtype());
@@ -154,7 +521,8 @@ ErrorCode ConvertTo::infer(const ITensorDataStridedCuda &inData, const ITensorDa
     }
 
     if (!(input_datatype == kCV_8U || input_datatype == kCV_8S || input_datatype == kCV_16U || input_datatype == kCV_16S
-          || input_datatype == kCV_32S || input_datatype == kCV_32F || input_datatype == kCV_64F))
+          || input_datatype == kCV_32S || input_datatype == kCV_32F || input_datatype == kCV_64F
+          || input_datatype == kCV_16F))
     {
         LOG_ERROR("Invalid DataType " << input_datatype);
         return ErrorCode::INVALID_DATA_TYPE;
@@ -162,29 +530,205 @@ ErrorCode ConvertTo::infer(const ITensorDataStridedCuda &inData, const ITensorDa
 
     if (!(output_datatype == kCV_8U || output_datatype == kCV_8S || output_datatype == kCV_16U
           || output_datatype == kCV_16S || output_datatype == kCV_32S || output_datatype == kCV_32F
-          || output_datatype == kCV_64F))
+          || output_datatype == kCV_64F || output_datatype == kCV_16F))
     {
         LOG_ERROR("Invalid Converted DataType " << output_datatype);
         return ErrorCode::INVALID_DATA_TYPE;
     }
 
-    typedef void (*func_t)(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
-                           int numChannels, const double alpha, const double beta, cudaStream_t stream);
-
     // clang-format off
-    static const func_t funcs[7][7] = {
-        { convertToScale<uchar, uchar>,  convertToScale<uchar, schar>,  convertToScale<uchar, ushort>,  convertToScale<uchar, short>,  convertToScale<uchar, int>,       convertToScale<uchar, float>,    convertToScale<uchar, double>   },
-        { convertToScale<schar, uchar>,  convertToScale<schar, schar>,  convertToScale<schar, ushort>,  convertToScale<schar, short>,  convertToScale<schar, int>,       convertToScale<schar, float>,    convertToScale<schar, double>   },
-        { convertToScale<ushort, uchar>, convertToScale<ushort, schar>, convertToScale<ushort, ushort>, convertToScale<ushort, short>, convertToScale<ushort, int>,      convertToScale<ushort, float>,   convertToScale<ushort, double>  },
-        { convertToScale<short, uchar>,  convertToScale<short, schar>,  convertToScale<short, ushort>,  convertToScale<short, short>,  convertToScale<short, int>,       convertToScale<short, float>,    convertToScale<short, double>   },
-        { convertToScale<int, uchar>,    convertToScale<int, schar>,    convertToScale<int, ushort>,    convertToScale<int, short>,    convertToScale<int, int>,         convertToScale<int, float>,      convertToScale<int, double>     },
-        { convertToScale<float, uchar>,  convertToScale<float, schar>,  convertToScale<float, ushort>,  convertToScale<float, short>,  convertToScale<float, int>,       convertToScale<float, float>,    convertToScale<float, double>   },
-        { convertToScale<double, uchar>, convertToScale<double, schar>, convertToScale<double, ushort>, convertToScale<double, short>, convertToScale<double, int>,      convertToScale<double, float>,   convertToScale<double, double>  }
+    static const func_t funcs[8][8] = {
+        { convertToScale<uchar, uchar>, convertToScale<uchar, schar>, convertToScale<uchar, ushort>, convertToScale<uchar, short>, convertToScale<uchar, int>, convertToScale<uchar, float>, convertToScale<uchar, double>, convertToScale<uchar, __half> },
+        { convertToScale<schar, uchar>, convertToScale<schar, schar>, convertToScale<schar, ushort>, convertToScale<schar, short>, convertToScale<schar, int>, convertToScale<schar, float>, convertToScale<schar, double>, convertToScale<schar, __half> },
+        { convertToScale<ushort, uchar>, convertToScale<ushort, schar>, convertToScale<ushort, ushort>, convertToScale<ushort, short>, convertToScale<ushort, int>, convertToScale<ushort, float>, convertToScale<ushort, double>, convertToScale<ushort, __half> },
+        { convertToScale<short, uchar>, convertToScale<short, schar>, convertToScale<short, ushort>, convertToScale<short, short>, convertToScale<short, int>, convertToScale<short, float>, convertToScale<short, double>, convertToScale<short, __half> },
+        { convertToScale<int, uchar>, convertToScale<int, schar>, convertToScale<int, ushort>, convertToScale<int, short>, convertToScale<int, int>, convertToScale<int, float>, convertToScale<int, double>, convertToScale<int, __half> },
+        { convertToScale<float, uchar>, convertToScale<float, schar>, convertToScale<float, ushort>, convertToScale<float, short>, convertToScale<float, int>, convertToScale<float, float>, convertToScale<float, double>, convertToScale<float, __half> },
+        { convertToScale<double, uchar>, convertToScale<double, schar>, convertToScale<double, ushort>, convertToScale<double, short>, convertToScale<double, int>, convertToScale<double, float>, convertToScale<double, double>, convertToScale<double, __half> },
+        { convertToScale<__half, uchar>, convertToScale<__half, schar>, convertToScale<__half, ushort>, convertToScale<__half, short>, convertToScale<__half, int>, convertToScale<__half, float>, convertToScale<__half, double>, convertToScale<__half, __half> }
     };
 
     // clang-format on
-    const func_t func = funcs[input_datatype][output_datatype];
-    func(inData, outData, channels, alpha, beta, stream);
+    plan.func        = funcs[input_datatype][output_datatype];
+    plan.numChannels = channels;
+
+    m_plans.insert(key, plan);
+    plan.func(inData, outData, plan.numChannels, alpha, beta, order, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode ConvertTo::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                           const ITensorDataStridedCuda &alphaData, const ITensorDataStridedCuda &betaData,
+                           cudaStream_t stream)
+{
+    cuda_op::DataFormat input_format  = GetLegacyDataFormat(inData.layout());
+    cuda_op::DataFormat output_format = GetLegacyDataFormat(outData.layout());
+
+    if (!(input_format == kNHWC || input_format == kHWC))
+    {
+        LOG_ERROR("Invalid input DataFormat " << input_format << ", it must be kHWC/kNHWC");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!(output_format == kNHWC || output_format == kHWC || output_format == kNCHW || output_format == kCHW))
+    {
+        LOG_ERROR("Invalid output DataFormat " << output_format << ", it must be kHWC/kNHWC/kCHW/kNCHW");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    auto inAccess  = TensorDataAccessStridedImagePlanar::Create(inData);
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(inAccess && outAccess);
+
+    int channels = inAccess->numChannels();
+
+    if (channels > 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (outAccess->numSamples() != inAccess->numSamples() || outAccess->numRows() != inAccess->numRows()
+        || outAccess->numCols() != inAccess->numCols() || outAccess->numChannels() != channels)
+    {
+        LOG_ERROR("Output shape " << outData.shape() << " doesn't match input shape " << inData.shape());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (inData.dtype() != nvcv::TYPE_U8)
+    {
+        LOG_ERROR("Invalid DataType " << GetLegacyDataType(inData.dtype()) << ", it must be kCV_8U");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (!IsPerChannelParam(alphaData, channels) || !IsPerChannelParam(betaData, channels))
+    {
+        LOG_ERROR("Alpha and beta must hold " << channels << " packed 32-bit float values each");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    typedef void (*per_channel_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                                  const float *alpha, const float *beta, cudaStream_t stream);
+
+    static const per_channel_t funcs[2][4] = {
+        {convertToPerChannelCN<float, 1>, convertToPerChannelCN<float, 2>, convertToPerChannelCN<float, 3>,
+         convertToPerChannelCN<float, 4>},
+        {convertToPerChannelCN<__half, 1>, convertToPerChannelCN<__half, 2>, convertToPerChannelCN<__half, 3>,
+         convertToPerChannelCN<__half, 4>},
+    };
+
+    int typeIdx;
+    if (outData.dtype() == nvcv::TYPE_F32)
+    {
+        typeIdx = 0;
+    }
+    else if (outData.dtype() == nvcv::TYPE_F16)
+    {
+        typeIdx = 1;
+    }
+    else
+    {
+        LOG_ERROR("Invalid Converted DataType " << GetLegacyDataType(outData.dtype()) << ", it must be F32 or F16");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    funcs[typeIdx][channels - 1](inData, outData, reinterpret_cast<const float *>(alphaData.basePtr()),
+                                 reinterpret_cast<const float *>(betaData.basePtr()), stream);
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode ConvertTo::inferMulti(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda *const *outData,
+                                const NVCVConvertToParams *params, const ChannelOrder *order, int numOutputs,
+                                cudaStream_t stream)
+{
+    if (numOutputs <= 0)
+    {
+        LOG_ERROR("Invalid number of outputs " << numOutputs);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    cuda_op::DataFormat input_format = GetLegacyDataFormat(inData.layout());
+    if (!(input_format == kNHWC || input_format == kHWC))
+    {
+        LOG_ERROR("Invalid input DataFormat " << input_format << ", it must be kHWC/kNHWC");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    int channels = inAccess->numChannels();
+
+    if (channels > 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    cuda_op::DataType input_datatype = GetLegacyDataType(inData.dtype());
+    if (!(input_datatype == kCV_8U || input_datatype == kCV_8S || input_datatype == kCV_16U || input_datatype == kCV_16S
+          || input_datatype == kCV_32S || input_datatype == kCV_32F))
+    {
+        LOG_ERROR("Invalid DataType " << input_datatype);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    for (int o = 0; o < numOutputs; ++o)
+    {
+        cuda_op::DataFormat output_format = GetLegacyDataFormat(outData[o]->layout());
+        if (!(output_format == kNHWC || output_format == kHWC || output_format == kNCHW || output_format == kCHW))
+        {
+            LOG_ERROR("Invalid DataFormat " << output_format << " of output " << o
+                                            << ", it must be kHWC/kNHWC/kCHW/kNCHW");
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+
+        auto outAccess = TensorDataAccessStridedImagePlanar::Create(*outData[o]);
+        NVCV_ASSERT(outAccess);
+
+        if (outAccess->numSamples() != inAccess->numSamples() || outAccess->numRows() != inAccess->numRows()
+            || outAccess->numCols() != inAccess->numCols() || outAccess->numChannels() != channels)
+        {
+            LOG_ERROR("Shape " << outData[o]->shape() << " of output " << o << " doesn't match input shape "
+                               << inData.shape());
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
+    typedef void (*multi_func_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda *const *outData,
+                                 const NVCVConvertToParams *params, const ChannelOrder *order, int numOutputs,
+                                 cudaStream_t stream);
+
+    // clang-format off
+    static const multi_func_t funcs[6][4] = {
+        { convertToMultiCN<uchar, 1>, convertToMultiCN<uchar, 2>, convertToMultiCN<uchar, 3>, convertToMultiCN<uchar, 4> },
+        { convertToMultiCN<schar, 1>, convertToMultiCN<schar, 2>, convertToMultiCN<schar, 3>, convertToMultiCN<schar, 4> },
+        { convertToMultiCN<ushort, 1>, convertToMultiCN<ushort, 2>, convertToMultiCN<ushort, 3>, convertToMultiCN<ushort, 4> },
+        { convertToMultiCN<short, 1>, convertToMultiCN<short, 2>, convertToMultiCN<short, 3>, convertToMultiCN<short, 4> },
+        { convertToMultiCN<int, 1>, convertToMultiCN<int, 2>, convertToMultiCN<int, 3>, convertToMultiCN<int, 4> },
+        { convertToMultiCN<float, 1>, convertToMultiCN<float, 2>, convertToMultiCN<float, 3>, convertToMultiCN<float, 4> }
+    };
+    // clang-format on
+
+    const multi_func_t func = funcs[input_datatype][channels - 1];
+
+    for (int first = 0; first < numOutputs; first += MAX_CONVERT_OUTPUTS)
+    {
+        func(inData, outData + first, params + first, order + first, std::min(numOutputs - first, MAX_CONVERT_OUTPUTS),
+             stream);
+    }
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
 
     return ErrorCode::SUCCESS;
 }
@@ -34,17 +34,19 @@ namespace {
 
 template<class SrcWrapper, class DstWrapper>
 __global__ void copyMakeBorderKernel(const SrcWrapper src, DstWrapper dst, const cuda::Tensor3DWrap<int> left_,
-                                     const cuda::Tensor3DWrap<int> top_, int out_height, int out_width)
+                                     const cuda::Tensor3DWrap<int> top_)
 {
     const int x         = blockIdx.x * blockDim.x + threadIdx.x;
     const int y         = blockIdx.y * blockDim.y + threadIdx.y;
     const int batch_idx = get_batch_idx();
 
-    int       left    = *left_.ptr(0, 0, batch_idx);
-    int       top     = *top_.ptr(0, 0, batch_idx);
+    const int left    = *left_.ptr(0, 0, batch_idx);
+    const int top     = *top_.ptr(0, 0, batch_idx);
     const int x_shift = x - left;
     const int y_shift = y - top;
 
+    int out_height = dst.height(batch_idx), out_width = dst.width(batch_idx);
+
     if (x < out_width && y < out_height)
     {
         int3 srcCoord             = {x_shift, y_shift, batch_idx};
@@ -52,49 +54,87 @@ __global__ void copyMakeBorderKernel(const SrcWrapper src, DstWrapper dst, const
     }
 }
 
-template<class SrcWrapper, class DstWrapper>
-__global__ void copyMakeBorderKernel(const SrcWrapper src, DstWrapper dst, const cuda::Tensor3DWrap<int> left_,
-                                     const cuda::Tensor3DWrap<int> top_)
+// Writes each image of the batch into its sample of the output tensor at (left, top).  Pixels that come from the
+// image are read directly, only the ones around it go through border handling.  With per-sample border values, the
+// constant border of each sample takes its own value instead of borderValue.
+template<NVCVBorderType B, typename T>
+__global__ void copyMakeBorderStackKernel(const cuda::ImageBatchVarShapeWrap<const T> src, cuda::Tensor3DWrap<T> dst,
+                                          const cuda::Tensor3DWrap<int> left_, const cuda::Tensor3DWrap<int> top_,
+                                          const T borderValue, const cuda::Tensor2DWrap<const float> sampleValues,
+                                          bool hasSampleValues, int out_height, int out_width)
 {
     const int x         = blockIdx.x * blockDim.x + threadIdx.x;
     const int y         = blockIdx.y * blockDim.y + threadIdx.y;
     const int batch_idx = get_batch_idx();
 
-    const int left    = *left_.ptr(0, 0, batch_idx);
-    const int top     = *top_.ptr(0, 0, batch_idx);
-    const int x_shift = x - left;
-    const int y_shift = y - top;
+    if (x >= out_width || y >= out_height)
+    {
+        return;
+    }
 
-    int out_height = dst.height(batch_idx), out_width = dst.width(batch_idx);
+    const int left       = *left_.ptr(0, 0, batch_idx);
+    const int top        = *top_.ptr(0, 0, batch_idx);
+    int       x_shift    = x - left;
+    int       y_shift    = y - top;
+    const int src_height = src.height(batch_idx);
+    const int src_width  = src.width(batch_idx);
 
-    if (x < out_width && y < out_height)
+    T *out = dst.ptr(batch_idx, y, x);
+
+    if (cuda::IsOutside(x_shift, src_width) || cuda::IsOutside(y_shift, src_height))
     {
-        int3 srcCoord             = {x_shift, y_shift, batch_idx};
-        *dst.ptr(batch_idx, y, x) = src[srcCoord];
+        if constexpr (B == NVCV_BORDER_CONSTANT)
+        {
+            T value = borderValue;
+            if (hasSampleValues)
+            {
+#pragma unroll
+                for (int c = 0; c < cuda::NumElements<T>; ++c)
+                {
+                    cuda::GetElement(value, c)
+                        = cuda::SaturateCast<cuda::BaseType<T>>(*sampleValues.ptr(batch_idx, c));
+                }
+            }
+            *out = value;
+            return;
+        }
+        else
+        {
+            x_shift = cuda::GetIndexWithBorder<B>(x_shift, src_width);
+            y_shift = cuda::GetIndexWithBorder<B>(y_shift, src_height);
+        }
     }
+
+    *out = *src.ptr(batch_idx, y_shift, x_shift);
 }
 
 template<NVCVBorderType B, typename T>
-struct copyMakeBorderDispatcher
+void copyMakeBorderStackCaller(const IImageBatchVarShapeDataStridedCuda &src, const ITensorDataStridedCuda &dst,
+                               const T &borderValue, const ITensorDataStridedCuda *sampleValues,
+                               const cuda::Tensor3DWrap<int> &left, const cuda::Tensor3DWrap<int> &top,
+                               cudaStream_t stream)
 {
-    static void call(const IImageBatchVarShapeDataStridedCuda &src, cuda::Tensor3DWrap<T> dst, const T &borderValue,
-                     const cuda::Tensor3DWrap<int> &left, const cuda::Tensor3DWrap<int> &top, int max_height,
-                     int max_width, cudaStream_t stream)
-    {
-        dim3 blockSize(BLOCK, BLOCK / 4, 1);
-        dim3 gridSize(divUp(max_width, blockSize.x), divUp(max_height, blockSize.y), src.numImages());
+    auto outSize = GetMaxImageSize(dst);
 
-        cuda::BorderVarShapeWrap<const T, B> brdSrc(src, borderValue);
+    dim3 blockSize(BLOCK, BLOCK / 4, 1);
+    dim3 gridSize(divUp(outSize.w, blockSize.x), divUp(outSize.h, blockSize.y), src.numImages());
 
-        copyMakeBorderKernel<<<gridSize, blockSize, 0, stream>>>(brdSrc, dst, left, top, max_height, max_width);
-        checkKernelErrors();
-
-#ifdef CUDA_DEBUG_LOG
-        checkCudaErrors(cudaStreamSynchronize(stream));
-        checkCudaErrors(cudaGetLastError());
-#endif
+    cuda::Tensor2DWrap<const float> valuesWrap;
+    if (sampleValues != nullptr)
+    {
+        valuesWrap = cuda::Tensor2DWrap<const float>(reinterpret_cast<const float *>(sampleValues->basePtr()),
+                                                     static_cast<int>(sampleValues->stride(0)));
     }
 
+    copyMakeBorderStackKernel<B><<<gridSize, blockSize, 0, stream>>>(
+        cuda::ImageBatchVarShapeWrap<const T>(src), cuda::Tensor3DWrap<T>(dst), left, top, borderValue, valuesWrap,
+        sampleValues != nullptr, outSize.h, outSize.w);
+    checkKernelErrors();
+}
+
+template<NVCVBorderType B, typename T>
+struct copyMakeBorderDispatcher
+{
     static void call(const IImageBatchVarShapeDataStridedCuda &src, cuda::ImageBatchVarShapeWrap<T> dst,
                      const T &borderValue, const cuda::Tensor3DWrap<int> &left, const cuda::Tensor3DWrap<int> &top,
                      int max_height, int max_width, cudaStream_t stream)
@@ -106,18 +146,14 @@ struct copyMakeBorderDispatcher
 
         copyMakeBorderKernel<<<gridSize, blockSize, 0, stream>>>(brdSrc, dst, left, top);
         checkKernelErrors();
-
-#ifdef CUDA_DEBUG_LOG
-        checkCudaErrors(cudaStreamSynchronize(stream));
-        checkCudaErrors(cudaGetLastError());
-#endif
     }
 };
 
 template<typename T, int cn, typename OutType> // uchar3 float3 uchar float
 void copyMakeBorder(const IImageBatchVarShapeDataStridedCuda &inData, const OutType &outData,
                     const ITensorDataStridedCuda &top, const ITensorDataStridedCuda &left,
-                    const NVCVBorderType borderType, const float4 value, cudaStream_t stream)
+                    const NVCVBorderType borderType, const float4 value, const ITensorDataStridedCuda *borderValues,
+                    cudaStream_t stream)
 {
     typedef cuda::MakeType<T, cn> src_type;
     src_type                      brdVal;
@@ -127,32 +163,48 @@ void copyMakeBorder(const IImageBatchVarShapeDataStridedCuda &inData, const OutT
     cuda::Tensor3DWrap<int> topVec(top);
     cuda::Tensor3DWrap<int> leftVec(left);
 
-    auto outSize = GetMaxImageSize(outData);
-
-    using out_type =
-        typename std::conditional<std::is_same<OutType, ITensorDataStridedCuda>::value, cuda::Tensor3DWrap<src_type>,
-                                  cuda::ImageBatchVarShapeWrap<src_type>>::type;
+    if constexpr (std::is_same_v<OutType, ITensorDataStridedCuda>)
+    {
+        typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &src, const ITensorDataStridedCuda &dst,
+                               const src_type &borderValue, const ITensorDataStridedCuda *sampleValues,
+                               const cuda::Tensor3DWrap<int> &left, const cuda::Tensor3DWrap<int> &top,
+                               cudaStream_t stream);
+
+        static const func_t funcs[] = {copyMakeBorderStackCaller<NVCV_BORDER_CONSTANT, src_type>,
+                                       copyMakeBorderStackCaller<NVCV_BORDER_REPLICATE, src_type>,
+                                       copyMakeBorderStackCaller<NVCV_BORDER_REFLECT, src_type>,
+                                       copyMakeBorderStackCaller<NVCV_BORDER_WRAP, src_type>,
+                                       copyMakeBorderStackCaller<NVCV_BORDER_REFLECT101, src_type>};
+
+        funcs[borderType](inData, outData, brdVal, borderValues, leftVec, topVec, stream);
+    }
+    else
+    {
+        auto outSize = GetMaxImageSize(outData);
 
-    out_type dstWrap(outData);
+        cuda::ImageBatchVarShapeWrap<src_type> dstWrap(outData);
 
-    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &src, out_type dst, const src_type &borderValue,
-                           const cuda::Tensor3DWrap<int> &left, const cuda::Tensor3DWrap<int> &top, int max_height,
-                           int max_width, cudaStream_t stream);
+        typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &src,
+                               cuda::ImageBatchVarShapeWrap<src_type> dst, const src_type &borderValue,
+                               const cuda::Tensor3DWrap<int> &left, const cuda::Tensor3DWrap<int> &top,
+                               int max_height, int max_width, cudaStream_t stream);
 
-    static const func_t funcs[] = {copyMakeBorderDispatcher<NVCV_BORDER_CONSTANT, src_type>::call,
-                                   copyMakeBorderDispatcher<NVCV_BORDER_REPLICATE, src_type>::call,
-                                   copyMakeBorderDispatcher<NVCV_BORDER_REFLECT, src_type>::call,
-                                   copyMakeBorderDispatcher<NVCV_BORDER_WRAP, src_type>::call,
-                                   copyMakeBorderDispatcher<NVCV_BORDER_REFLECT101, src_type>::call};
+        static const func_t funcs[] = {copyMakeBorderDispatcher<NVCV_BORDER_CONSTANT, src_type>::call,
+                                       copyMakeBorderDispatcher<NVCV_BORDER_REPLICATE, src_type>::call,
+                                       copyMakeBorderDispatcher<NVCV_BORDER_REFLECT, src_type>::call,
+                                       copyMakeBorderDispatcher<NVCV_BORDER_WRAP, src_type>::call,
+                                       copyMakeBorderDispatcher<NVCV_BORDER_REFLECT101, src_type>::call};
 
-    funcs[borderType](inData, dstWrap, brdVal, leftVec, topVec, outSize.h, outSize.w, stream);
+        funcs[borderType](inData, dstWrap, brdVal, leftVec, topVec, outSize.h, outSize.w, stream);
+    }
 }
 } // namespace
 
 template<class OutType>
 ErrorCode CopyMakeBorderVarShape::inferWarp(const IImageBatchVarShapeDataStridedCuda &data_in, const OutType &data_out,
                                             const ITensorDataStridedCuda &top, const ITensorDataStridedCuda &left,
-                                            const NVCVBorderType borderType, const float4 value, cudaStream_t stream)
+                                            const NVCVBorderType borderType, const float4 value,
+                                            const ITensorDataStridedCuda *borderValues, cudaStream_t stream)
 {
     DataFormat input_format  = GetLegacyDataFormat(data_in);
     DataFormat output_format = GetLegacyDataFormat(data_out);
@@ -219,9 +271,35 @@ ErrorCode CopyMakeBorderVarShape::inferWarp(const IImageBatchVarShapeDataStrided
         return ErrorCode::INVALID_DATA_FORMAT;
     }
 
+    if (borderValues != nullptr)
+    {
+        if (GetLegacyDataType(borderValues->dtype()) != kCV_32F)
+        {
+            LOG_ERROR("Invalid border values DataType " << borderValues->dtype() << ", it must be float32");
+            return ErrorCode::INVALID_DATA_TYPE;
+        }
+
+        auto valuesAccess = TensorDataAccessStridedImagePlanar::Create(*borderValues);
+        if (!valuesAccess || valuesAccess->numPlanes() != 1)
+        {
+            LOG_ERROR("Invalid border values DataFormat, it must be interleaved");
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+
+        if (valuesAccess->numSamples() != data_in.numImages() || valuesAccess->numRows() != 1
+            || valuesAccess->numCols() != 1 || valuesAccess->numChannels() != channels)
+        {
+            LOG_ERROR("Invalid border values shape " << borderValues->shape() << ", it must have "
+                                                     << data_in.numImages() << " samples of 1x1 pixels with "
+                                                     << channels << " channels");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
     typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &d_in, const OutType &d_out,
                            const ITensorDataStridedCuda &top, const ITensorDataStridedCuda &left,
-                           const NVCVBorderType borderType, const float4 value, cudaStream_t stream);
+                           const NVCVBorderType borderType, const float4 value,
+                           const ITensorDataStridedCuda *borderValues, cudaStream_t stream);
 
     // clang-format off
     static const func_t funcs[6][4] = {
@@ -237,7 +315,7 @@ ErrorCode CopyMakeBorderVarShape::inferWarp(const IImageBatchVarShapeDataStrided
     const func_t func = funcs[data_type][channels - 1];
     NVCV_ASSERT(func != 0);
 
-    func(data_in, data_out, top, left, borderType, value, stream);
+    func(data_in, data_out, top, left, borderType, value, borderValues, stream);
 
     return SUCCESS;
 }
@@ -247,7 +325,7 @@ ErrorCode CopyMakeBorderVarShape::infer(const IImageBatchVarShapeDataStridedCuda
                                         const ITensorDataStridedCuda &top, const ITensorDataStridedCuda &left,
                                         const NVCVBorderType borderType, const float4 value, cudaStream_t stream)
 {
-    return inferWarp(data_in, data_out, top, left, borderType, value, stream);
+    return inferWarp(data_in, data_out, top, left, borderType, value, nullptr, stream);
 }
 
 ErrorCode CopyMakeBorderVarShape::infer(const IImageBatchVarShapeDataStridedCuda &data_in,
@@ -255,7 +333,15 @@ ErrorCode CopyMakeBorderVarShape::infer(const IImageBatchVarShapeDataStridedCuda
                                         const ITensorDataStridedCuda &left, const NVCVBorderType borderType,
                                         const float4 value, cudaStream_t stream)
 {
-    return inferWarp(data_in, data_out, top, left, borderType, value, stream);
+    return inferWarp(data_in, data_out, top, left, borderType, value, nullptr, stream);
+}
+
+ErrorCode CopyMakeBorderVarShape::infer(const IImageBatchVarShapeDataStridedCuda &data_in,
+                                        const ITensorDataStridedCuda &data_out, const ITensorDataStridedCuda &top,
+                                        const ITensorDataStridedCuda &left, const NVCVBorderType borderType,
+                                        const ITensorDataStridedCuda &borderValues, cudaStream_t stream)
+{
+    return inferWarp(data_in, data_out, top, left, borderType, float4{}, &borderValues, stream);
 }
 
 } // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,562 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+#include <climits>
+#include <type_traits>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace nvcv::legacy::cuda_op {
+
+namespace {
+
+// Each block detects the corners of a tile of kTileW x kTileH pixels, and computes the scores of the tile with a
+// halo of one pixel in shared memory for the 3x3 suppression.  A row of the block is a warp.
+constexpr int kTileW = 32;
+constexpr int kTileH = 8;
+constexpr int kHaloW = kTileW + 2;
+constexpr int kHaloH = kTileH + 2;
+
+// Keypoints of each sample, appended through the counters of outCount.
+struct KeypointOutput
+{
+    cuda::Tensor3DWrap<int2>  keypoints;
+    cuda::Tensor3DWrap<float> scores;
+    cuda::Tensor3DWrap<int>   counts;
+
+    int capacity;
+};
+
+__global__ void clearKeypointCounts(KeypointOutput out, int numSamples)
+{
+    const int sample = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (sample < numSamples)
+    {
+        *out.counts.ptr(sample, 0, 0) = 0;
+    }
+}
+
+// Appends the keypoints of the lanes of the warp with keep set, called by all the lanes.  The first keeping lane
+// reserves the slots of the whole warp with a single atomic, and each lane writes at its rank among the keeping
+// ones.  Keypoints past the capacity are counted but not written.
+__device__ void AppendKeypoint(const KeypointOutput &out, int sample, bool keep, int x, int y, float score)
+{
+    const unsigned kept = __ballot_sync(0xFFFFFFFF, keep);
+    if (kept == 0)
+        return;
+
+    const int lane   = threadIdx.x % warpSize;
+    const int leader = __ffs(kept) - 1;
+
+    int base = 0;
+    if (lane == leader)
+    {
+        base = atomicAdd(out.counts.ptr(sample, 0, 0), __popc(kept));
+    }
+    base = __shfl_sync(0xFFFFFFFF, base, leader);
+
+    if (keep)
+    {
+        const int idx = base + __popc(kept & ((1u << lane) - 1));
+        if (idx < out.capacity)
+        {
+            *out.keypoints.ptr(sample, 0, idx) = int2{x, y};
+            *out.scores.ptr(sample, 0, idx)    = score;
+        }
+    }
+}
+
+// Clamps the counts to the capacity and pads the keypoints past them, blockIdx.y is the sample.
+__global__ void finalizeKeypoints(KeypointOutput out)
+{
+    const int sample = blockIdx.y;
+    const int i      = blockIdx.x * blockDim.x + threadIdx.x;
+    const int count  = min(*out.counts.ptr(sample, 0, 0), out.capacity);
+
+    // every thread reads the same clamped count, before or after it's written back
+    if (i == 0)
+    {
+        *out.counts.ptr(sample, 0, 0) = count;
+    }
+
+    if (i >= count && i < out.capacity)
+    {
+        *out.keypoints.ptr(sample, 0, i) = int2{-1, -1};
+        *out.scores.ptr(sample, 0, i)    = 0.f;
+    }
+}
+
+// Checks the keypoint outputs of numSamples samples and returns their capacity, or a negative value on error.
+ErrorCode CheckKeypointOutputs(int numSamples, const ITensorDataStridedCuda &outKeypointData,
+                               const ITensorDataStridedCuda &outScoreData, const ITensorDataStridedCuda &outCountData,
+                               int &capacity)
+{
+    for (const ITensorDataStridedCuda *data : {&outKeypointData, &outScoreData, &outCountData})
+    {
+        DataFormat format = GetLegacyDataFormat(data->layout());
+        if (!(format == kNHWC || format == kHWC))
+        {
+            LOG_ERROR("Invalid output DataFormat " << format);
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+    }
+
+    if (outKeypointData.dtype() != nvcv::TYPE_S32 || outScoreData.dtype() != nvcv::TYPE_F32
+        || outCountData.dtype() != nvcv::TYPE_S32)
+    {
+        LOG_ERROR("Invalid output DataTypes " << outKeypointData.dtype() << ", " << outScoreData.dtype() << " and "
+                                              << outCountData.dtype() << ", they must be int32, float32 and int32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto kpAccess    = TensorDataAccessStridedImagePlanar::Create(outKeypointData);
+    auto scoreAccess = TensorDataAccessStridedImagePlanar::Create(outScoreData);
+    auto countAccess = TensorDataAccessStridedImagePlanar::Create(outCountData);
+    NVCV_ASSERT(kpAccess && scoreAccess && countAccess);
+
+    if (kpAccess->numSamples() != numSamples || kpAccess->numRows() != 1 || kpAccess->numChannels() != 2)
+    {
+        LOG_ERROR("Invalid keypoint output shape " << outKeypointData.shape() << ", it must have one row of 2 "
+                                                   << "channels for each of the " << numSamples << " samples");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (scoreAccess->numSamples() != numSamples || scoreAccess->numRows() != 1
+        || scoreAccess->numCols() != kpAccess->numCols() || scoreAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid score output shape " << outScoreData.shape() << ", it must have the samples and "
+                                                << "columns of the keypoints, and one channel");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (countAccess->numSamples() != numSamples || countAccess->numRows() != 1 || countAccess->numCols() != 1
+        || countAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid count output shape " << outCountData.shape() << ", it must have one element for each of "
+                                                << "the " << numSamples << " samples");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    capacity = kpAccess->numCols();
+    return ErrorCode::SUCCESS;
+}
+
+KeypointOutput CreateKeypointOutput(const ITensorDataStridedCuda &outKeypointData,
+                                    const ITensorDataStridedCuda &outScoreData,
+                                    const ITensorDataStridedCuda &outCountData, int capacity)
+{
+    return {cuda::CreateTensorWrapNHW<int2>(outKeypointData), cuda::CreateTensorWrapNHW<float>(outScoreData),
+            cuda::CreateTensorWrapNHW<int>(outCountData), capacity};
+}
+
+// Detection of the samples between the clearing and the finalization of the outputs.
+template<class DetectFunc>
+void DetectKeypoints(const KeypointOutput &out, int numSamples, DetectFunc &&detect, cudaStream_t stream)
+{
+    clearKeypointCounts<<<divUp(numSamples, 256), 256, 0, stream>>>(out, numSamples);
+    checkKernelErrors();
+
+    detect();
+
+    dim3 grid(divUp(std::max(out.capacity, 1), 256), numSamples);
+    finalizeKeypoints<<<grid, 256, 0, stream>>>(out);
+    checkKernelErrors();
+}
+
+// FAST ------------------------------------------------------------------------
+
+// Bresenham circle of radius 3, clockwise from the top
+__constant__ int2 kFastCircle[16] = {
+    { 0, -3},
+    { 1, -3},
+    { 2, -2},
+    { 3, -1},
+    { 3,  0},
+    { 3,  1},
+    { 2,  2},
+    { 1,  3},
+    { 0,  3},
+    {-1,  3},
+    {-2,  2},
+    {-3,  1},
+    {-3,  0},
+    {-3, -1},
+    {-2, -2},
+    {-1, -3}
+};
+
+constexpr int kFastArc    = 9;
+constexpr int kFastRadius = 3;
+
+// Smallest difference to the center over the most contrasted arc of kFastArc pixels, either all brighter or all
+// darker, if above the threshold, 0 otherwise.  Minus one, it's the largest threshold the pixel is a corner with.
+template<class SrcWrapper>
+__device__ int FastScore(const SrcWrapper &src, int sample, int x, int y, int threshold)
+{
+    const int center = src[int3{x, y, sample}];
+
+    int diff[16];
+#pragma unroll
+    for (int i = 0; i < 16; ++i)
+    {
+        diff[i] = src[int3{x + kFastCircle[i].x, y + kFastCircle[i].y, sample}] - center;
+    }
+
+    int best = 0;
+#pragma unroll
+    for (int start = 0; start < 16; ++start)
+    {
+        int lo = INT_MAX, hi = INT_MIN;
+#pragma unroll
+        for (int k = 0; k < kFastArc; ++k)
+        {
+            lo = min(lo, diff[(start + k) % 16]);
+            hi = max(hi, diff[(start + k) % 16]);
+        }
+        best = max(best, max(lo, -hi));
+    }
+
+    return best > threshold ? best : 0;
+}
+
+template<class SrcWrapper>
+__global__ void fastKernel(const SrcWrapper src, int2 size, int threshold, bool nonmaxSuppression,
+                           KeypointOutput out)
+{
+    __shared__ int scores[kHaloH * kHaloW];
+
+    const int sample = blockIdx.z;
+    const int x0     = blockIdx.x * kTileW;
+    const int y0     = blockIdx.y * kTileH;
+    const int tid    = threadIdx.y * kTileW + threadIdx.x;
+
+    for (int i = tid; i < kHaloW * kHaloH; i += kTileW * kTileH)
+    {
+        const int x = x0 - 1 + i % kHaloW;
+        const int y = y0 - 1 + i / kHaloW;
+
+        const bool interior = x >= kFastRadius && y >= kFastRadius && x < size.x - kFastRadius
+                           && y < size.y - kFastRadius;
+
+        scores[i] = interior ? FastScore(src, sample, x, y, threshold) : 0;
+    }
+    __syncthreads();
+
+    const int center = (threadIdx.y + 1) * kHaloW + threadIdx.x + 1;
+    const int score  = scores[center];
+
+    bool keep = score > 0;
+    if (keep && nonmaxSuppression)
+    {
+#pragma unroll
+        for (int dy = -1; dy <= 1; ++dy)
+        {
+#pragma unroll
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                if (dx != 0 || dy != 0)
+                {
+                    keep = keep && score > scores[center + dy * kHaloW + dx];
+                }
+            }
+        }
+    }
+
+    AppendKeypoint(out, sample, keep, x0 + threadIdx.x, y0 + threadIdx.y, static_cast<float>(score - 1));
+}
+
+// Harris ----------------------------------------------------------------------
+
+constexpr int kGradMaxW = kHaloW + Harris::kMaxBlockSize - 1;
+constexpr int kGradMaxH = kHaloH + Harris::kMaxBlockSize - 1;
+
+// Structure tensor products [dx^2, dx * dy, dy^2] of the 3x3 Sobel gradient at (x, y), which is extrapolated as a
+// gradient image would be, as OpenCV's box filter of the products does.
+template<NVCVBorderType B, class SrcWrapper>
+__device__ float3 GradientProducts(const SrcWrapper &src, int sample, int x, int y, int2 size, float scale)
+{
+    if constexpr (B == NVCV_BORDER_CONSTANT)
+    {
+        if (cuda::IsOutside(x, size.x) || cuda::IsOutside(y, size.y))
+        {
+            return float3{0.f, 0.f, 0.f};
+        }
+    }
+    else
+    {
+        x = cuda::GetIndexWithBorder<B>(x, size.x);
+        y = cuda::GetIndexWithBorder<B>(y, size.y);
+    }
+
+    auto p = [&](int dx, int dy) { return static_cast<float>(src[int3{x + dx, y + dy, sample}]); };
+
+    const float gx = ((p(1, -1) + 2.f * p(1, 0) + p(1, 1)) - (p(-1, -1) + 2.f * p(-1, 0) + p(-1, 1))) * scale;
+    const float gy = ((p(-1, 1) + 2.f * p(0, 1) + p(1, 1)) - (p(-1, -1) + 2.f * p(0, -1) + p(1, -1))) * scale;
+
+    return float3{gx * gx, gx * gy, gy * gy};
+}
+
+template<NVCVBorderType B, class SrcWrapper>
+__global__ void harrisKernel(const SrcWrapper src, int2 size, int blockSize, float scale, float k, bool minEigen,
+                             float threshold, KeypointOutput out)
+{
+    __shared__ float3 products[kGradMaxH * kGradMaxW];
+    __shared__ float  responses[kHaloH * kHaloW];
+
+    const int sample = blockIdx.z;
+    const int x0     = blockIdx.x * kTileW;
+    const int y0     = blockIdx.y * kTileH;
+    const int tid    = threadIdx.y * kTileW + threadIdx.x;
+
+    // products of the windows of the tile and its halo
+    const int gradW = kHaloW + blockSize - 1;
+    const int gradH = kHaloH + blockSize - 1;
+    const int gx0   = x0 - 1 - blockSize / 2;
+    const int gy0   = y0 - 1 - blockSize / 2;
+
+    for (int i = tid; i < gradW * gradH; i += kTileW * kTileH)
+    {
+        products[i] = GradientProducts<B>(src, sample, gx0 + i % gradW, gy0 + i / gradW, size, scale);
+    }
+    __syncthreads();
+
+    for (int i = tid; i < kHaloW * kHaloH; i += kTileW * kTileH)
+    {
+        const int hx = i % kHaloW;
+        const int hy = i / kHaloW;
+        const int x  = x0 - 1 + hx;
+        const int y  = y0 - 1 + hy;
+
+        float response = -INFINITY;
+        if (x >= 0 && y >= 0 && x < size.x && y < size.y)
+        {
+            float a = 0.f, b = 0.f, c = 0.f;
+            for (int v = 0; v < blockSize; ++v)
+            {
+                const float3 *row = products + (hy + v) * gradW + hx;
+                for (int u = 0; u < blockSize; ++u)
+                {
+                    a += row[u].x;
+                    b += row[u].y;
+                    c += row[u].z;
+                }
+            }
+
+            if (minEigen)
+            {
+                a *= 0.5f;
+                c *= 0.5f;
+                response = (a + c) - sqrtf((a - c) * (a - c) + b * b);
+            }
+            else
+            {
+                response = a * c - b * b - k * (a + c) * (a + c);
+            }
+        }
+        responses[i] = response;
+    }
+    __syncthreads();
+
+    const int   center   = (threadIdx.y + 1) * kHaloW + threadIdx.x + 1;
+    const float response = responses[center];
+
+    bool keep = response > threshold;
+#pragma unroll
+    for (int dy = -1; dy <= 1; ++dy)
+    {
+#pragma unroll
+        for (int dx = -1; dx <= 1; ++dx)
+        {
+            keep = keep && response >= responses[center + dy * kHaloW + dx];
+        }
+    }
+
+    AppendKeypoint(out, sample, keep, x0 + threadIdx.x, y0 + threadIdx.y, response);
+}
+
+template<typename T, NVCVBorderType B>
+void HarrisCaller(const ITensorDataStridedCuda &inData, int numSamples, int2 size, const KeypointOutput &out,
+                  int blockSize, float k, bool minEigen, float threshold, cudaStream_t stream)
+{
+    auto src = cuda::CreateBorderWrapNHW<const T, B>(inData, T{});
+
+    // as OpenCV, gradients are scaled by the Sobel weights, the window and the range of 8-bit images
+    float scale = 1.f / (4 * blockSize);
+    if constexpr (std::is_same_v<T, uchar>)
+    {
+        scale /= 255.f;
+    }
+
+    dim3 block(kTileW, kTileH);
+    dim3 grid(divUp(size.x, kTileW), divUp(size.y, kTileH), numSamples);
+
+    harrisKernel<B><<<grid, block, 0, stream>>>(src, size, blockSize, scale, k, minEigen, threshold, out);
+    checkKernelErrors();
+}
+
+// Checks an input of one channel of the given type and returns its number of samples and size.
+ErrorCode CheckCornerInput(const ITensorDataStridedCuda &inData, bool allowFloat, int &numSamples, int2 &size)
+{
+    DataFormat format = GetLegacyDataFormat(inData.layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid input DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataType dataType = GetLegacyDataType(inData.dtype());
+    if (!(dataType == kCV_8U || (allowFloat && dataType == kCV_32F)))
+    {
+        LOG_ERROR("Invalid input DataType " << inData.dtype() << ", it must be uint8"
+                                            << (allowFloat ? " or float32" : ""));
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    if (inAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid input channel number " << inAccess->numChannels() << ", it must be 1");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    numSamples = inAccess->numSamples();
+    size       = int2{static_cast<int>(inAccess->numCols()), static_cast<int>(inAccess->numRows())};
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+ErrorCode FAST::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outKeypointData,
+                      const ITensorDataStridedCuda &outScoreData, const ITensorDataStridedCuda &outCountData,
+                      int threshold, bool nonmaxSuppression, cudaStream_t stream)
+{
+    int       numSamples, capacity;
+    int2      size;
+    ErrorCode err = CheckCornerInput(inData, false, numSamples, size);
+    if (err == ErrorCode::SUCCESS)
+    {
+        err = CheckKeypointOutputs(numSamples, outKeypointData, outScoreData, outCountData, capacity);
+    }
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (threshold < 0 || threshold > 255)
+    {
+        LOG_ERROR("Invalid threshold " << threshold << ", it must be in [0, 255]");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (numSamples == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    KeypointOutput out = CreateKeypointOutput(outKeypointData, outScoreData, outCountData, capacity);
+    auto           src = cuda::CreateBorderWrapNHW<const uchar, NVCV_BORDER_REPLICATE>(inData, 0);
+
+    DetectKeypoints(
+        out, numSamples,
+        [&]
+        {
+            dim3 block(kTileW, kTileH);
+            dim3 grid(divUp(size.x, kTileW), divUp(size.y, kTileH), numSamples);
+
+            fastKernel<<<grid, block, 0, stream>>>(src, size, threshold, nonmaxSuppression, out);
+            checkKernelErrors();
+        },
+        stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode Harris::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outKeypointData,
+                        const ITensorDataStridedCuda &outScoreData, const ITensorDataStridedCuda &outCountData,
+                        NVCVCornerResponseType type, int blockSize, float k, float threshold,
+                        NVCVBorderType borderMode, cudaStream_t stream)
+{
+    int       numSamples, capacity;
+    int2      size;
+    ErrorCode err = CheckCornerInput(inData, true, numSamples, size);
+    if (err == ErrorCode::SUCCESS)
+    {
+        err = CheckKeypointOutputs(numSamples, outKeypointData, outScoreData, outCountData, capacity);
+    }
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (!(type == NVCV_CORNER_HARRIS || type == NVCV_CORNER_SHI_TOMASI))
+    {
+        LOG_ERROR("Invalid corner response type " << type);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (blockSize < 1 || blockSize > kMaxBlockSize)
+    {
+        LOG_ERROR("Invalid block size " << blockSize << ", it must be in [1, " << kMaxBlockSize << "]");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (!(borderMode == NVCV_BORDER_REFLECT101 || borderMode == NVCV_BORDER_REPLICATE
+          || borderMode == NVCV_BORDER_CONSTANT || borderMode == NVCV_BORDER_REFLECT || borderMode == NVCV_BORDER_WRAP))
+    {
+        LOG_ERROR("Invalid borderMode " << borderMode);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (numSamples == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const ITensorDataStridedCuda &inData, int numSamples, int2 size, const KeypointOutput &out,
+                           int blockSize, float k, bool minEigen, float threshold, cudaStream_t stream);
+
+    static const func_t funcs[2][5] = {
+        {HarrisCaller<uchar, NVCV_BORDER_CONSTANT>, HarrisCaller<uchar, NVCV_BORDER_REPLICATE>,
+         HarrisCaller<uchar, NVCV_BORDER_REFLECT>, HarrisCaller<uchar, NVCV_BORDER_WRAP>,
+         HarrisCaller<uchar, NVCV_BORDER_REFLECT101>},
+        {HarrisCaller<float, NVCV_BORDER_CONSTANT>, HarrisCaller<float, NVCV_BORDER_REPLICATE>,
+         HarrisCaller<float, NVCV_BORDER_REFLECT>, HarrisCaller<float, NVCV_BORDER_WRAP>,
+         HarrisCaller<float, NVCV_BORDER_REFLECT101>},
+    };
+
+    const func_t func = funcs[inData.dtype() == nvcv::TYPE_F32 ? 1 : 0][borderMode];
+
+    KeypointOutput out = CreateKeypointOutput(outKeypointData, outScoreData, outCountData, capacity);
+
+    DetectKeypoints(
+        out, numSamples,
+        [&] { func(inData, numSamples, size, out, blockSize, k, type == NVCV_CORNER_SHI_TOMASI, threshold, stream); },
+        stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
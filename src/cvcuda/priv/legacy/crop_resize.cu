@@ -0,0 +1,517 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+#include <nvcv/cuda/MathWrappers.hpp>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace nvcv::legacy::cuda_op {
+
+namespace {
+
+#define BLOCK 32
+
+// Boxes are rows of [x1, y1, x2, y2], optionally preceded by the source sample index.
+struct Boxes
+{
+    cuda::Tensor2DWrap<const float> data;
+
+    bool hasSampleIdx;
+};
+
+// Optional flip code of each box, as in FlipOrCopyVarShape: 1 flips horizontally, 0 vertically, -1 both, anything
+// else doesn't flip.
+struct Flips
+{
+    cuda::Tensor1DWrap<const int> code;
+
+    bool enabled = false;
+};
+
+// Source samples, all with the same size in a tensor.
+template<class Wrapper>
+struct TensorSource
+{
+    Wrapper data;
+    int2    size;
+    int     numSamples;
+
+    __device__ int2 sampleSize(int) const
+    {
+        return size;
+    }
+};
+
+// Source samples with their own sizes in a varshape batch.
+template<typename T>
+struct VarShapeSource
+{
+    cuda::ImageBatchVarShapeWrap<const T> data;
+    int                                   numSamples;
+
+    __device__ int2 sampleSize(int sample) const
+    {
+        return int2{data.width(sample), data.height(sample)};
+    }
+};
+
+// Averages the window pixels covered by the footprint of an output pixel, weighted by their overlap with it, as in
+// area resize. The footprint is at least one source pixel wide, so that upscaling interpolates linearly.
+template<typename T, class Source>
+__device__ cuda::ConvertBaseTypeTo<float, T> area_sample(const Source &src, int sample, int2 lo, int width,
+                                                         int height, float fx, float fy, float scale_x,
+                                                         float scale_y)
+{
+    using work_type = cuda::ConvertBaseTypeTo<float, T>;
+
+    const float fw = cuda::max(scale_x, 1.0f);
+    const float fh = cuda::max(scale_y, 1.0f);
+
+    // footprint clipped to the window, boxes partly outside of the source keep the closest pixels
+    float ax = cuda::max(fx - 0.5f * fw, 0.0f), bx = cuda::min(fx + 0.5f * fw, static_cast<float>(width));
+    float ay = cuda::max(fy - 0.5f * fh, 0.0f), by = cuda::min(fy + 0.5f * fh, static_cast<float>(height));
+    if (bx <= ax)
+    {
+        ax = cuda::min(floorf(ax), width - 1.0f);
+        bx = ax + 1.0f;
+    }
+    if (by <= ay)
+    {
+        ay = cuda::min(floorf(ay), height - 1.0f);
+        by = ay + 1.0f;
+    }
+
+    const int x0 = __float2int_rd(ax), x1 = __float2int_ru(bx);
+    const int y0 = __float2int_rd(ay), y1 = __float2int_ru(by);
+
+    work_type sum = cuda::SetAll<work_type>(0);
+    for (int sy = y0; sy < y1; ++sy)
+    {
+        const float wy  = cuda::min(by, sy + 1.0f) - cuda::max(ay, static_cast<float>(sy));
+        const T    *row = src.data.ptr(sample, lo.y + sy, lo.x);
+
+        work_type rowSum = cuda::SetAll<work_type>(0);
+        for (int sx = x0; sx < x1; ++sx)
+        {
+            const float wx = cuda::min(bx, sx + 1.0f) - cuda::max(ax, static_cast<float>(sx));
+            rowSum += row[sx] * wx;
+        }
+        sum += rowSum * wy;
+    }
+
+    return sum * (1.0f / ((bx - ax) * (by - ay)));
+}
+
+// Each block of the grid z dimension crops one box out of its source sample and resizes it to the output
+// size. Sampling follows Resize applied to the crop: the box is mapped to the output with pixel centers
+// aligned, and reads are clamped to the box's integer window, i.e. the pixels CustomCrop would extract.
+// Downscaled integer boxes thus give the same result as CustomCrop followed by Resize, without the
+// intermediate tensor and with one launch for all boxes. Flipped boxes write each output pixel from the
+// mirrored position, which is the same as flipping the resized crop.
+template<class Source, class DstWrapper>
+__global__ void crop_resize(Source src, Boxes boxes, Flips flips, DstWrapper dst, int2 dstSize,
+                            NVCVInterpolationType interpolation)
+{
+    using T         = typename DstWrapper::ValueType;
+    using work_type = cuda::ConvertBaseTypeTo<float, T>;
+
+    const int dst_x   = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dst_y   = blockIdx.y * blockDim.y + threadIdx.y;
+    const int box_idx = get_batch_idx();
+
+    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
+        return;
+
+    const float *box    = boxes.data.ptr(box_idx, 0);
+    int          sample = src.numSamples == 1 ? 0 : box_idx;
+    if (boxes.hasSampleIdx)
+    {
+        sample = __float2int_rn(box[0]);
+        ++box;
+    }
+
+    // boxes referring to invalid samples produce zeros
+    if (sample < 0 || sample >= src.numSamples)
+    {
+        *dst.ptr(box_idx, dst_y, dst_x) = cuda::SetAll<T>(0);
+        return;
+    }
+
+    const int2  srcSize = src.sampleSize(sample);
+    const float x1 = box[0], y1 = box[1], x2 = box[2], y2 = box[3];
+
+    // integer window covered by the box, clipped to the source
+    const int2 lo{cuda::max(0, __float2int_rd(x1)), cuda::max(0, __float2int_rd(y1))};
+    const int2 hi{cuda::min(srcSize.x, __float2int_ru(x2)), cuda::min(srcSize.y, __float2int_ru(y2))};
+
+    // as well as boxes falling outside the source
+    if (hi.x <= lo.x || hi.y <= lo.y)
+    {
+        *dst.ptr(box_idx, dst_y, dst_x) = cuda::SetAll<T>(0);
+        return;
+    }
+
+    const int width = hi.x - lo.x, height = hi.y - lo.y;
+
+    const float scale_x = (x2 - x1) / dstSize.x;
+    const float scale_y = (y2 - y1) / dstSize.y;
+
+    // box origin relative to its window, zero for integer boxes inside the source
+    const float off_x = x1 - lo.x;
+    const float off_y = y1 - lo.y;
+
+    const int code = flips.enabled ? flips.code[box_idx] : 2;
+    const int x    = (code == 1 || code == -1) ? dstSize.x - 1 - dst_x : dst_x;
+    const int y    = (code == 0 || code == -1) ? dstSize.y - 1 - dst_y : dst_y;
+
+    if (interpolation == NVCV_INTERP_NEAREST)
+    {
+        const int sx = cuda::max(0, cuda::min(__float2int_rd(off_x + x * scale_x), width - 1));
+        const int sy = cuda::max(0, cuda::min(__float2int_rd(off_y + y * scale_y), height - 1));
+
+        *dst.ptr(box_idx, dst_y, dst_x) = *src.data.ptr(sample, lo.y + sy, lo.x + sx);
+        return;
+    }
+
+    if (interpolation == NVCV_INTERP_AREA)
+    {
+        *dst.ptr(box_idx, dst_y, dst_x) = cuda::SaturateCast<T>(area_sample<T>(
+            src, sample, lo, width, height, off_x + (x + 0.5f) * scale_x, off_y + (y + 0.5f) * scale_y, scale_x,
+            scale_y));
+        return;
+    }
+
+    float fy = (y + 0.5f) * scale_y - 0.5f + off_y;
+    int   sy = __float2int_rd(fy);
+    fy -= sy;
+    fy *= ((sy >= 0) && (sy < height - 1));
+    sy = cuda::max(0, cuda::min(sy, height - 2));
+
+    float fx = (x + 0.5f) * scale_x - 0.5f + off_x;
+    int   sx = __float2int_rd(fx);
+    fx -= sx;
+    fx *= ((sx >= 0) && (sx < width - 1));
+    sx = cuda::max(0, cuda::min(sx, width - 2));
+
+    // windows with only one row or column read the same pixel twice
+    const int sy1 = cuda::min(sy + 1, height - 1);
+    const int sx1 = cuda::min(sx + 1, width - 1);
+
+    const T *aPtr = src.data.ptr(sample, lo.y + sy, lo.x);
+    const T *bPtr = src.data.ptr(sample, lo.y + sy1, lo.x);
+
+    work_type value
+        = (1.0f - fx) * (aPtr[sx] * (1.0f - fy) + bPtr[sx] * fy) + fx * (aPtr[sx1] * (1.0f - fy) + bPtr[sx1] * fy);
+
+    *dst.ptr(box_idx, dst_y, dst_x) = cuda::SaturateCast<T>(value);
+}
+
+template<class Source, typename T>
+void launchCropResize(const Source &src, const Boxes &boxes, const Flips &flips,
+                      const ITensorDataStridedCuda &outData, NVCVInterpolationType interpolation, cudaStream_t stream)
+{
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    int2 dstSize{static_cast<int>(outAccess->numCols()), static_cast<int>(outAccess->numRows())};
+
+    auto dst = cuda::CreateTensorWrapNHW<T>(outData);
+
+    dim3 block(BLOCK, BLOCK / 4, 1);
+    dim3 grid(divUp(dstSize.x, block.x), divUp(dstSize.y, block.y), outAccess->numSamples());
+
+    crop_resize<<<grid, block, 0, stream>>>(src, boxes, flips, dst, dstSize, interpolation);
+    checkKernelErrors();
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
+template<typename T>
+void cropResize(const ITensorDataStridedCuda &inData, const Boxes &boxes, const ITensorDataStridedCuda &outData,
+                NVCVInterpolationType interpolation, cudaStream_t stream)
+{
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    auto src = cuda::CreateTensorWrapNHW<const T>(inData);
+
+    TensorSource<decltype(src)> source{src, int2{static_cast<int>(inAccess->numCols()),
+                                                 static_cast<int>(inAccess->numRows())},
+                                       static_cast<int>(inAccess->numSamples())};
+
+    launchCropResize<decltype(source), T>(source, boxes, Flips{}, outData, interpolation, stream);
+}
+
+template<typename T>
+void cropResizeVarShape(const IImageBatchVarShapeDataStridedCuda &inData, const Boxes &boxes, const Flips &flips,
+                        const ITensorDataStridedCuda &outData, NVCVInterpolationType interpolation,
+                        cudaStream_t stream)
+{
+    VarShapeSource<T> source{cuda::ImageBatchVarShapeWrap<const T>(inData), inData.numImages()};
+
+    launchCropResize<VarShapeSource<T>, T>(source, boxes, flips, outData, interpolation, stream);
+}
+
+bool isSupportedType(DataType data_type)
+{
+    return data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_16S || data_type == kCV_32F;
+}
+
+// Checks what doesn't depend on the input container: output, interpolation and boxes, whose wrapper is set up.
+ErrorCode checkBoxesAndOutput(const ITensorDataStridedCuda &boxData, const ITensorDataStridedCuda &outData,
+                              int numInputSamples, int channels, const NVCVInterpolationType interpolation,
+                              Boxes &boxes)
+{
+    if (GetLegacyDataFormat(outData.layout()) != kNHWC)
+    {
+        LOG_ERROR("Invalid output DataFormat " << GetLegacyDataFormat(outData.layout()) << ", it must be NHWC");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    if (!outAccess)
+    {
+        LOG_ERROR("Invalid output DataFormat");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (channels != 1 && channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (outAccess->numChannels() != channels)
+    {
+        LOG_ERROR("Invalid output channel number " << outAccess->numChannels() << ", it must be " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (interpolation != NVCV_INTERP_NEAREST && interpolation != NVCV_INTERP_LINEAR
+        && interpolation != NVCV_INTERP_AREA)
+    {
+        LOG_ERROR("Unsupported interpolation method " << interpolation);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (boxData.dtype() != TYPE_F32)
+    {
+        LOG_ERROR("Invalid boxes DataType " << boxData.dtype() << ", it must be float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (boxData.rank() != 2 || (boxData.shape(1) != 4 && boxData.shape(1) != 5))
+    {
+        LOG_ERROR("Invalid boxes shape " << boxData.shape() << ", it must be [N, 4] or [N, 5]");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (boxData.stride(1) != sizeof(float))
+    {
+        LOG_ERROR("Invalid boxes layout, box coordinates must be packed");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    int numBoxes = boxData.shape(0);
+    if (outAccess->numSamples() != numBoxes)
+    {
+        LOG_ERROR("Invalid output number of samples " << outAccess->numSamples() << ", it must be the number of boxes "
+                                                      << numBoxes);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    boxes.hasSampleIdx = boxData.shape(1) == 5;
+    if (!boxes.hasSampleIdx && numInputSamples != 1 && numInputSamples != numBoxes)
+    {
+        LOG_ERROR("Boxes without sample index require one input sample or one sample per box, got "
+                  << numInputSamples << " samples and " << numBoxes << " boxes");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    boxes.data = cuda::Tensor2DWrap<const float>(boxData.basePtr(), static_cast<int>(boxData.stride(0)));
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+size_t CropResize::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode CropResize::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &boxData,
+                            const ITensorDataStridedCuda &outData, const NVCVInterpolationType interpolation,
+                            cudaStream_t stream)
+{
+    DataFormat input_format = GetLegacyDataFormat(inData.layout());
+
+    if (!(input_format == kNHWC || input_format == kHWC))
+    {
+        LOG_ERROR("Invalid input DataFormat " << input_format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (inData.dtype() != outData.dtype())
+    {
+        LOG_ERROR("Invalid DataType between input (" << inData.dtype() << ") and output (" << outData.dtype() << ")");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    DataType data_type = GetLegacyDataType(inData.dtype());
+    if (!isSupportedType(data_type))
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    if (!inAccess)
+    {
+        LOG_ERROR("Invalid input DataFormat");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    int   channels = inAccess->numChannels();
+    Boxes boxes;
+    if (ErrorCode err = checkBoxesAndOutput(boxData, outData, inAccess->numSamples(), channels, interpolation, boxes);
+        err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (boxData.shape(0) == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const ITensorDataStridedCuda &inData, const Boxes &boxes,
+                           const ITensorDataStridedCuda &outData, NVCVInterpolationType interpolation,
+                           cudaStream_t stream);
+
+    static const func_t funcs[6][4] = {
+        {      cropResize<uchar>,  0 /*cropResize<uchar2>*/,       cropResize<uchar3>,       cropResize<uchar4>},
+        {0 /*cropResize<schar>*/,  0 /*cropResize<schar2>*/, 0 /*cropResize<schar3>*/, 0 /*cropResize<schar4>*/},
+        {     cropResize<ushort>, 0 /*cropResize<ushort2>*/,      cropResize<ushort3>,      cropResize<ushort4>},
+        {      cropResize<short>,  0 /*cropResize<short2>*/,       cropResize<short3>,       cropResize<short4>},
+        {  0 /*cropResize<int>*/,    0 /*cropResize<int2>*/,   0 /*cropResize<int3>*/,   0 /*cropResize<int4>*/},
+        {      cropResize<float>,  0 /*cropResize<float2>*/,       cropResize<float3>,       cropResize<float4>}
+    };
+
+    const func_t func = funcs[data_type][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(inData, boxes, outData, interpolation, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode CropResizeVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                    const ITensorDataStridedCuda &boxData, const ITensorDataStridedCuda *flipData,
+                                    const ITensorDataStridedCuda &outData, const NVCVInterpolationType interpolation,
+                                    cudaStream_t stream)
+{
+    DataFormat input_format = GetLegacyDataFormat(inData);
+
+    if (!(input_format == kNHWC || input_format == kHWC))
+    {
+        LOG_ERROR("Invalid input DataFormat " << input_format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!inData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input batch must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataType data_type = GetLegacyDataType(inData.uniqueFormat());
+    if (data_type != GetLegacyDataType(outData.dtype()))
+    {
+        LOG_ERROR("Invalid DataType between input (" << data_type << ") and output ("
+                                                     << GetLegacyDataType(outData.dtype()) << ")");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (!isSupportedType(data_type))
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    int   channels = inData.uniqueFormat().numChannels();
+    Boxes boxes;
+    if (ErrorCode err = checkBoxesAndOutput(boxData, outData, inData.numImages(), channels, interpolation, boxes);
+        err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    int   numBoxes = boxData.shape(0);
+    Flips flips;
+    if (flipData != nullptr)
+    {
+        // [N, 1] as well, like the flip codes of FlipOrCopyVarShape
+        const bool validShape = flipData->rank() == 1 || (flipData->rank() == 2 && flipData->shape(1) == 1);
+        if (flipData->dtype() != TYPE_S32 || !validShape || flipData->shape(0) != numBoxes
+            || flipData->stride(0) != sizeof(int))
+        {
+            LOG_ERROR("Invalid flip codes " << flipData->dtype() << " " << flipData->shape()
+                                            << ", they must be packed int32 with shape [" << numBoxes << "]");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+
+        flips.code    = cuda::Tensor1DWrap<const int>(*flipData);
+        flips.enabled = true;
+    }
+
+    if (numBoxes == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData, const Boxes &boxes, const Flips &flips,
+                           const ITensorDataStridedCuda &outData, NVCVInterpolationType interpolation,
+                           cudaStream_t stream);
+
+    static const func_t funcs[6][4] = {
+        { cropResizeVarShape<uchar>, 0,  cropResizeVarShape<uchar3>,  cropResizeVarShape<uchar4>},
+        {                         0, 0,                           0,                           0},
+        {cropResizeVarShape<ushort>, 0, cropResizeVarShape<ushort3>, cropResizeVarShape<ushort4>},
+        { cropResizeVarShape<short>, 0,  cropResizeVarShape<short3>,  cropResizeVarShape<short4>},
+        {                         0, 0,                           0,                           0},
+        { cropResizeVarShape<float>, 0,  cropResizeVarShape<float3>,  cropResizeVarShape<float4>}
+    };
+
+    const func_t func = funcs[data_type][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(inData, boxes, flips, outData, interpolation, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -34,34 +34,53 @@ using namespace nvcv::legacy::helpers;
 
 template<class SrcWrapper, class DstWrapper>
 __global__ void custom_crop_kernel(const SrcWrapper src, DstWrapper dst, int start_x, int start_y, int width,
-                                   int height)
+                                   int height, int numSamples)
 {
-    const int x         = blockIdx.x * blockDim.x + threadIdx.x;
-    const int y         = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
     if (x >= width || y >= height)
         return;
 
-    *dst.ptr(batch_idx, y, x) = *src.ptr(batch_idx, y + start_y, x + start_x);
+    for (int batch_idx = get_batch_idx(); batch_idx < numSamples; batch_idx += gridDim.z)
+    {
+        *dst.ptr(batch_idx, y, x) = *src.ptr(batch_idx, y + start_y, x + start_x);
+    }
 }
 
-template<typename T>
-void customCrop(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData, NVCVRectI roi,
-                cudaStream_t stream)
+template<typename T, typename StrideType>
+void customCropImpl(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
+                    NVCVRectI roi, cudaStream_t stream)
 {
     auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(outData);
     NVCV_ASSERT(outAccess);
 
-    auto src = nvcv::cuda::CreateTensorWrapNHW<const T>(inData);
-    auto dst = nvcv::cuda::CreateTensorWrapNHW<T>(outData);
+    auto src = nvcv::cuda::CreateTensorWrapNHW<const T, StrideType>(inData);
+    auto dst = nvcv::cuda::CreateTensorWrapNHW<T, StrideType>(outData);
+
+    const int numSamples = outAccess->numSamples();
 
     dim3 block(16, 16);
-    dim3 grid(divUp(roi.width, block.x), divUp(roi.height, block.y), outAccess->numSamples());
+    dim3 grid(divUp(roi.width, block.x), divUp(roi.height, block.y), BatchGridDim(numSamples));
 
-    custom_crop_kernel<<<grid, block, 0, stream>>>(src, dst, roi.x, roi.y, roi.width, roi.height);
+    custom_crop_kernel<<<grid, block, 0, stream>>>(src, dst, roi.x, roi.y, roi.width, roi.height, numSamples);
     checkKernelErrors();
 }
 
+// 64-bit offsets are only used for tensors larger than 2 GB
+template<typename T>
+void customCrop(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData, NVCVRectI roi,
+                cudaStream_t stream)
+{
+    if (nvcv::cuda::NeedsLargeOffsets(inData) || nvcv::cuda::NeedsLargeOffsets(outData))
+    {
+        customCropImpl<T, int64_t>(inData, outData, roi, stream);
+    }
+    else
+    {
+        customCropImpl<T, int>(inData, outData, roi, stream);
+    }
+}
+
 namespace nvcv::legacy::cuda_op {
 
 size_t CustomCrop::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
@@ -24,8 +24,10 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "CvtColorUtils.cuh"
 
 #include <cfloat>
+#include <type_traits>
 
 static constexpr float B2YF = 0.114f;
 static constexpr float G2YF = 0.587f;
@@ -80,258 +82,244 @@ static constexpr int ITUR_BT_601_CBV = -74448;
 namespace nvcv::legacy::cuda_op {
 
 template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void rgb_to_bgr_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int sch, int dch, int bidx)
+__global__ void rgb_to_bgr_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int sch, int dch, int bidx)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-
-    T b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
-    T g = *src.ptr(batch_idx, dst_y, dst_x, 1);
-    T r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
-
-    *dst.ptr(batch_idx, dst_y, dst_x, 0) = b;
-    *dst.ptr(batch_idx, dst_y, dst_x, 1) = g;
-    *dst.ptr(batch_idx, dst_y, dst_x, 2) = r;
-
-    if (dch == 4)
-    {
-        T al = sch == 4 ? *src.ptr(batch_idx, dst_y, dst_x, 3) : cuda::TypeTraits<T>::max;
-        *dst.ptr(batch_idx, dst_y, dst_x, 3) = al;
-    }
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         T b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
+                         T g = *src.ptr(batch_idx, dst_y, dst_x, 1);
+                         T r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, 0) = b;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1) = g;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 2) = r;
+
+                         if (dch == 4)
+                         {
+                             T al = sch == 4 ? *src.ptr(batch_idx, dst_y, dst_x, 3) : cuda::TypeTraits<T>::max;
+                             *dst.ptr(batch_idx, dst_y, dst_x, 3) = al;
+                         }
+                     });
 }
 
 template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void gray_to_bgr_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int dch)
+__global__ void gray_to_bgr_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int dch)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-
-    T g = *src.ptr(batch_idx, dst_y, dst_x, 0);
-
-    *dst.ptr(batch_idx, dst_y, dst_x, 0) = g;
-    *dst.ptr(batch_idx, dst_y, dst_x, 1) = g;
-    *dst.ptr(batch_idx, dst_y, dst_x, 2) = g;
-    if (dch == 4)
-    {
-        *dst.ptr(batch_idx, dst_y, dst_x, 3) = g;
-    }
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         T g = *src.ptr(batch_idx, dst_y, dst_x, 0);
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, 0) = g;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1) = g;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 2) = g;
+                         if (dch == 4)
+                         {
+                             *dst.ptr(batch_idx, dst_y, dst_x, 3) = g;
+                         }
+                     });
 }
 
 template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void bgr_to_gray_char_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int bidx)
+__global__ void bgr_to_gray_char_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int bidx)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-    int       b         = *src.ptr(batch_idx, dst_y, dst_x, bidx);
-    int       g         = *src.ptr(batch_idx, dst_y, dst_x, 1);
-    int       r         = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
-
-    T gray                               = (T)CV_DESCALE(b * BY15 + g * GY15 + r * RY15, gray_shift);
-    *dst.ptr(batch_idx, dst_y, dst_x, 0) = gray;
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         int b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
+                         int g = *src.ptr(batch_idx, dst_y, dst_x, 1);
+                         int r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
+
+                         T gray = (T)CV_DESCALE(b * BY15 + g * GY15 + r * RY15, gray_shift);
+                         *dst.ptr(batch_idx, dst_y, dst_x, 0) = gray;
+                     });
 }
 
 template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void bgr_to_gray_float_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int bidx)
+__global__ void bgr_to_gray_float_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int bidx)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-    T         b         = *src.ptr(batch_idx, dst_y, dst_x, bidx);
-    T         g         = *src.ptr(batch_idx, dst_y, dst_x, 1);
-    T         r         = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
-
-    T gray                               = (T)(b * B2YF + g * G2YF + r * R2YF);
-    *dst.ptr(batch_idx, dst_y, dst_x, 0) = gray;
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         T b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
+                         T g = *src.ptr(batch_idx, dst_y, dst_x, 1);
+                         T r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
+
+                         T gray                               = (T)(b * B2YF + g * G2YF + r * R2YF);
+                         *dst.ptr(batch_idx, dst_y, dst_x, 0) = gray;
+                     });
 }
 
 template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void bgr_to_yuv_char_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int bidx)
+__global__ void bgr_to_yuv_char_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int bidx)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-    int       B         = *src.ptr(batch_idx, dst_y, dst_x, bidx);
-    int       G         = *src.ptr(batch_idx, dst_y, dst_x, 1);
-    int       R         = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
-
-    int C0 = R2Y, C1 = G2Y, C2 = B2Y, C3 = R2VI, C4 = B2UI;
-    int delta = ((T)(cuda::TypeTraits<T>::max / 2 + 1)) * (1 << yuv_shift);
-    int Y     = CV_DESCALE(R * C0 + G * C1 + B * C2, yuv_shift);
-    int Cr    = CV_DESCALE((R - Y) * C3 + delta, yuv_shift);
-    int Cb    = CV_DESCALE((B - Y) * C4 + delta, yuv_shift);
-
-    *dst.ptr(batch_idx, dst_y, dst_x, 0) = cuda::SaturateCast<T>(Y);
-    *dst.ptr(batch_idx, dst_y, dst_x, 1) = cuda::SaturateCast<T>(Cb);
-    *dst.ptr(batch_idx, dst_y, dst_x, 2) = cuda::SaturateCast<T>(Cr);
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         int B = *src.ptr(batch_idx, dst_y, dst_x, bidx);
+                         int G = *src.ptr(batch_idx, dst_y, dst_x, 1);
+                         int R = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
+
+                         int C0 = R2Y, C1 = G2Y, C2 = B2Y, C3 = R2VI, C4 = B2UI;
+                         int delta = ((T)(cuda::TypeTraits<T>::max / 2 + 1)) * (1 << yuv_shift);
+                         int Y     = CV_DESCALE(R * C0 + G * C1 + B * C2, yuv_shift);
+                         int Cr    = CV_DESCALE((R - Y) * C3 + delta, yuv_shift);
+                         int Cb    = CV_DESCALE((B - Y) * C4 + delta, yuv_shift);
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, 0) = cuda::SaturateCast<T>(Y);
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1) = cuda::SaturateCast<T>(Cb);
+                         *dst.ptr(batch_idx, dst_y, dst_x, 2) = cuda::SaturateCast<T>(Cr);
+                     });
 }
 
 template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void bgr_to_yuv_float_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int bidx)
+__global__ void bgr_to_yuv_float_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int bidx)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-    T         B         = *src.ptr(batch_idx, dst_y, dst_x, bidx);
-    T         G         = *src.ptr(batch_idx, dst_y, dst_x, 1);
-    T         R         = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
-
-    T C0 = R2YF, C1 = G2YF, C2 = B2YF, C3 = R2VF, C4 = B2UF;
-    T delta                              = 0.5f;
-    T Y                                  = R * C0 + G * C1 + B * C2;
-    T Cr                                 = (R - Y) * C3 + delta;
-    T Cb                                 = (B - Y) * C4 + delta;
-    *dst.ptr(batch_idx, dst_y, dst_x, 0) = Y;
-    *dst.ptr(batch_idx, dst_y, dst_x, 1) = Cb;
-    *dst.ptr(batch_idx, dst_y, dst_x, 2) = Cr;
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         T B = *src.ptr(batch_idx, dst_y, dst_x, bidx);
+                         T G = *src.ptr(batch_idx, dst_y, dst_x, 1);
+                         T R = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
+
+                         T C0 = R2YF, C1 = G2YF, C2 = B2YF, C3 = R2VF, C4 = B2UF;
+                         T delta                              = 0.5f;
+                         T Y                                  = R * C0 + G * C1 + B * C2;
+                         T Cr                                 = (R - Y) * C3 + delta;
+                         T Cb                                 = (B - Y) * C4 + delta;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 0) = Y;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1) = Cb;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 2) = Cr;
+                     });
 }
 
 template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void yuv_to_bgr_char_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int bidx)
+__global__ void yuv_to_bgr_char_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int bidx)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-    T         Y         = *src.ptr(batch_idx, dst_y, dst_x, 0);
-    T         Cb        = *src.ptr(batch_idx, dst_y, dst_x, 1);
-    T         Cr        = *src.ptr(batch_idx, dst_y, dst_x, 2);
-
-    int C0 = V2RI, C1 = V2GI, C2 = U2GI, C3 = U2BI;
-    int delta = ((T)(cuda::TypeTraits<T>::max / 2 + 1));
-    int b     = Y + CV_DESCALE((Cb - delta) * C3, yuv_shift);
-    int g     = Y + CV_DESCALE((Cb - delta) * C2 + (Cr - delta) * C1, yuv_shift);
-    int r     = Y + CV_DESCALE((Cr - delta) * C0, yuv_shift);
-
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = cuda::SaturateCast<T>(b);
-    *dst.ptr(batch_idx, dst_y, dst_x, 1)        = cuda::SaturateCast<T>(g);
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = cuda::SaturateCast<T>(r);
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         T Y  = *src.ptr(batch_idx, dst_y, dst_x, 0);
+                         T Cb = *src.ptr(batch_idx, dst_y, dst_x, 1);
+                         T Cr = *src.ptr(batch_idx, dst_y, dst_x, 2);
+
+                         int C0 = V2RI, C1 = V2GI, C2 = U2GI, C3 = U2BI;
+                         int delta = ((T)(cuda::TypeTraits<T>::max / 2 + 1));
+                         int b     = Y + CV_DESCALE((Cb - delta) * C3, yuv_shift);
+                         int g     = Y + CV_DESCALE((Cb - delta) * C2 + (Cr - delta) * C1, yuv_shift);
+                         int r     = Y + CV_DESCALE((Cr - delta) * C0, yuv_shift);
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = cuda::SaturateCast<T>(b);
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1)        = cuda::SaturateCast<T>(g);
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = cuda::SaturateCast<T>(r);
+                     });
 }
 
 template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void yuv_to_bgr_float_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int bidx)
+__global__ void yuv_to_bgr_float_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int bidx)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-    T         Y         = *src.ptr(batch_idx, dst_y, dst_x, 0);
-    T         Cb        = *src.ptr(batch_idx, dst_y, dst_x, 1);
-    T         Cr        = *src.ptr(batch_idx, dst_y, dst_x, 2);
-
-    T C0 = V2RF, C1 = V2GF, C2 = U2GF, C3 = U2BF;
-    T delta = 0.5f;
-    T b     = Y + (Cb - delta) * C3;
-    T g     = Y + (Cb - delta) * C2 + (Cr - delta) * C1;
-    T r     = Y + (Cr - delta) * C0;
-
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = b;
-    *dst.ptr(batch_idx, dst_y, dst_x, 1)        = g;
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = r;
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         T Y  = *src.ptr(batch_idx, dst_y, dst_x, 0);
+                         T Cb = *src.ptr(batch_idx, dst_y, dst_x, 1);
+                         T Cr = *src.ptr(batch_idx, dst_y, dst_x, 2);
+
+                         T C0 = V2RF, C1 = V2GF, C2 = U2GF, C3 = U2BF;
+                         T delta = 0.5f;
+                         T b     = Y + (Cb - delta) * C3;
+                         T g     = Y + (Cb - delta) * C2 + (Cr - delta) * C1;
+                         T r     = Y + (Cr - delta) * C0;
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = b;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1)        = g;
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = r;
+                     });
 }
 
 template<class SrcWrapper, class DstWrapper>
-__global__ void bgr_to_hsv_char_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int bidx, bool isFullRange)
+__global__ void bgr_to_hsv_char_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int bidx, int hrange,
+                                     const HsvDivTables8u tables)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-
-    int       b         = *src.ptr(batch_idx, dst_y, dst_x, bidx);
-    int       g         = *src.ptr(batch_idx, dst_y, dst_x, 1);
-    int       r         = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
-    int       hrange    = isFullRange ? 256 : 180;
-    int       hr        = hrange;
-    const int hsv_shift = 12;
-    int       h, s, v = b;
-    int       vmin = b;
-    int       vr, vg;
-
-    v    = cuda::max(v, g);
-    v    = cuda::max(v, r);
-    vmin = cuda::min(vmin, g);
-    vmin = cuda::min(vmin, r);
-
-    unsigned char diff = cuda::SaturateCast<unsigned char>(v - vmin);
-    vr                 = v == r ? -1 : 0;
-    vg                 = v == g ? -1 : 0;
-
-    int hdiv_table = diff == 0 ? 0 : cuda::SaturateCast<int>((hrange << hsv_shift) / (6. * diff));
-    int sdiv_table = v == 0 ? 0 : cuda::SaturateCast<int>((255 << hsv_shift) / (1. * v));
-    s              = (diff * sdiv_table + (1 << (hsv_shift - 1))) >> hsv_shift;
-    h              = (vr & (g - b)) + (~vr & ((vg & (b - r + 2 * diff)) + ((~vg) & (r - g + 4 * diff))));
-    h              = (h * hdiv_table + (1 << (hsv_shift - 1))) >> hsv_shift;
-    h += h < 0 ? hr : 0;
-
-    *dst.ptr(batch_idx, dst_y, dst_x, 0) = cuda::SaturateCast<unsigned char>(h);
-    *dst.ptr(batch_idx, dst_y, dst_x, 1) = (unsigned char)s;
-    *dst.ptr(batch_idx, dst_y, dst_x, 2) = (unsigned char)v;
+    __shared__ HsvDivTables8u divTables;
+    LoadTableToShared(tables, divTables);
+
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         int b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
+                         int g = *src.ptr(batch_idx, dst_y, dst_x, 1);
+                         int r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
+                         int h, s, v = b;
+                         int vmin = b;
+                         int vr, vg;
+
+                         v    = cuda::max(v, g);
+                         v    = cuda::max(v, r);
+                         vmin = cuda::min(vmin, g);
+                         vmin = cuda::min(vmin, r);
+
+                         int diff = v - vmin;
+                         vr       = v == r ? -1 : 0;
+                         vg       = v == g ? -1 : 0;
+
+                         s = (diff * divTables.val[v] + (1 << (hsv_shift - 1))) >> hsv_shift;
+                         h = (vr & (g - b)) + (~vr & ((vg & (b - r + 2 * diff)) + ((~vg) & (r - g + 4 * diff))));
+                         h = (h * divTables.val[256 + diff] + (1 << (hsv_shift - 1))) >> hsv_shift;
+                         h += h < 0 ? hrange : 0;
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, 0) = cuda::SaturateCast<unsigned char>(h);
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1) = (unsigned char)s;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 2) = (unsigned char)v;
+                     });
 }
 
-template<class SrcWrapper, class DstWrapper>
-__global__ void bgr_to_hsv_float_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int bidx)
+template<bool Fast, class SrcWrapper, class DstWrapper>
+__global__ void bgr_to_hsv_float_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int bidx)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-
-    float b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
-    float g = *src.ptr(batch_idx, dst_y, dst_x, 1);
-    float r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
-    float h, s, v;
-    float hrange = 360.0;
-    float hscale = hrange * (1.f / 360.f);
-
-    float vmin, diff;
-
-    v = vmin = r;
-    if (v < g)
-        v = g;
-    if (v < b)
-        v = b;
-    if (vmin > g)
-        vmin = g;
-    if (vmin > b)
-        vmin = b;
-
-    diff = v - vmin;
-    s    = diff / (float)(fabs(v) + FLT_EPSILON);
-    diff = (float)(60. / (diff + FLT_EPSILON));
-    if (v == r)
-        h = (g - b) * diff;
-    else if (v == g)
-        h = (b - r) * diff + 120.f;
-    else
-        h = (r - g) * diff + 240.f;
-
-    if (h < 0)
-        h += 360.f;
-
-    *dst.ptr(batch_idx, dst_y, dst_x, 0) = h * hscale;
-    *dst.ptr(batch_idx, dst_y, dst_x, 1) = s;
-    *dst.ptr(batch_idx, dst_y, dst_x, 2) = v;
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         float b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
+                         float g = *src.ptr(batch_idx, dst_y, dst_x, 1);
+                         float r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
+                         float h, s, v;
+                         float hrange = 360.0;
+                         float hscale = hrange * (1.f / 360.f);
+
+                         float vmin, diff;
+
+                         v = vmin = r;
+                         if (v < g)
+                             v = g;
+                         if (v < b)
+                             v = b;
+                         if (vmin > g)
+                             vmin = g;
+                         if (vmin > b)
+                             vmin = b;
+
+                         diff = v - vmin;
+                         s    = DivF<Fast>(diff, fabsf(v) + FLT_EPSILON);
+                         diff = Fast ? DivF<Fast>(60.f, diff + FLT_EPSILON) : (float)(60. / (diff + FLT_EPSILON));
+                         if (v == r)
+                             h = (g - b) * diff;
+                         else if (v == g)
+                             h = (b - r) * diff + 120.f;
+                         else
+                             h = (r - g) * diff + 240.f;
+
+                         if (h < 0)
+                             h += 360.f;
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, 0) = h * hscale;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1) = s;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 2) = v;
+                     });
 }
 
+template<bool Fast>
 __device__ inline void HSV2RGB_native(float h, float s, float v, float &b, float &g, float &r, const float hscale)
 {
     if (s == 0)
@@ -349,7 +337,7 @@ __device__ inline void HSV2RGB_native(float h, float s, float v, float &b, float
         float tab[4];
         int   sector;
         h *= hscale;
-        h      = fmod(h, 6.f);
+        h      = Fast ? h - 6.f * floorf(h * (1.f / 6.f)) : fmod(h, 6.f);
         sector = (int)floor(h);
         h -= sector;
         if ((unsigned)sector >= 6u)
@@ -369,58 +357,136 @@ __device__ inline void HSV2RGB_native(float h, float s, float v, float &b, float
     }
 }
 
-template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void hsv_to_bgr_char_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int bidx, int dcn, bool isFullRange)
+template<bool Fast, class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
+__global__ void hsv_to_bgr_char_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int bidx, int dcn, bool isFullRange)
+{
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         float h = *src.ptr(batch_idx, dst_y, dst_x, 0);
+                         float s = *src.ptr(batch_idx, dst_y, dst_x, 1) * (1.0f / 255.0f);
+                         float v = *src.ptr(batch_idx, dst_y, dst_x, 2) * (1.0f / 255.0f);
+
+                         float         hrange = isFullRange ? 255 : 180;
+                         unsigned char alpha  = cuda::TypeTraits<T>::max;
+                         float         hs     = 6.f / hrange;
+
+                         float b, g, r;
+                         HSV2RGB_native<Fast>(h, s, v, b, g, r, hs);
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = cuda::SaturateCast<uchar>(b * 255.0f);
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1)        = cuda::SaturateCast<uchar>(g * 255.0f);
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = cuda::SaturateCast<uchar>(r * 255.0f);
+                         if (dcn == 4)
+                             *dst.ptr(batch_idx, dst_y, dst_x, 3) = alpha;
+                     });
+}
+
+template<bool Fast, class SrcWrapper, class DstWrapper>
+__global__ void hsv_to_bgr_float_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int bidx, int dcn)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-
-    float h = *src.ptr(batch_idx, dst_y, dst_x, 0);
-    float s = *src.ptr(batch_idx, dst_y, dst_x, 1) * (1.0f / 255.0f);
-    float v = *src.ptr(batch_idx, dst_y, dst_x, 2) * (1.0f / 255.0f);
-
-    float         hrange = isFullRange ? 255 : 180;
-    unsigned char alpha  = cuda::TypeTraits<T>::max;
-    float         hs     = 6.f / hrange;
-
-    float b, g, r;
-    HSV2RGB_native(h, s, v, b, g, r, hs);
-
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = cuda::SaturateCast<uchar>(b * 255.0f);
-    *dst.ptr(batch_idx, dst_y, dst_x, 1)        = cuda::SaturateCast<uchar>(g * 255.0f);
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = cuda::SaturateCast<uchar>(r * 255.0f);
-    if (dcn == 4)
-        *dst.ptr(batch_idx, dst_y, dst_x, 3) = alpha;
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         float h = *src.ptr(batch_idx, dst_y, dst_x, 0);
+                         float s = *src.ptr(batch_idx, dst_y, dst_x, 1);
+                         float v = *src.ptr(batch_idx, dst_y, dst_x, 2);
+
+                         float hrange = 360.0;
+                         float alpha  = 1.f;
+                         float hs     = 6.f / hrange;
+
+                         float b, g, r;
+                         HSV2RGB_native<Fast>(h, s, v, b, g, r, hs);
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = b;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1)        = g;
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = r;
+                         if (dcn == 4)
+                             *dst.ptr(batch_idx, dst_y, dst_x, 3) = alpha;
+                     });
 }
 
 template<class SrcWrapper, class DstWrapper>
-__global__ void hsv_to_bgr_float_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int bidx, int dcn)
+__global__ void bgr_to_lab_char_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int bidx, bool isLuv,
+                                     const GammaLut8u lut)
+{
+    __shared__ GammaLut8u gammaLut;
+    LoadTableToShared(lut, gammaLut);
+
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         float b = gammaLut.val[*src.ptr(batch_idx, dst_y, dst_x, bidx)];
+                         float g = gammaLut.val[*src.ptr(batch_idx, dst_y, dst_x, 1)];
+                         float r = gammaLut.val[*src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2)];
+
+                         float3 lab = LabTo8u(LinearRGBToLab(r, g, b, isLuv), isLuv);
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, 0) = cuda::SaturateCast<uchar>(lab.x);
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1) = cuda::SaturateCast<uchar>(lab.y);
+                         *dst.ptr(batch_idx, dst_y, dst_x, 2) = cuda::SaturateCast<uchar>(lab.z);
+                     });
+}
+
+template<class SrcWrapper, class DstWrapper>
+__global__ void bgr_to_lab_float_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int bidx, bool isLuv, bool isSrgb)
+{
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         float b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
+                         float g = *src.ptr(batch_idx, dst_y, dst_x, 1);
+                         float r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
+                         if (isSrgb)
+                         {
+                             b = SrgbToLinear(b);
+                             g = SrgbToLinear(g);
+                             r = SrgbToLinear(r);
+                         }
+
+                         float3 lab = LinearRGBToLab(r, g, b, isLuv);
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, 0) = lab.x;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1) = lab.y;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 2) = lab.z;
+                     });
+}
+
+template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
+__global__ void lab_to_bgr_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int bidx, int dcn, bool isLuv,
+                                bool isSrgb)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-
-    float h = *src.ptr(batch_idx, dst_y, dst_x, 0);
-    float s = *src.ptr(batch_idx, dst_y, dst_x, 1);
-    float v = *src.ptr(batch_idx, dst_y, dst_x, 2);
-
-    float hrange = 360.0;
-    float alpha  = 1.f;
-    float hs     = 6.f / hrange;
-
-    float b, g, r;
-    HSV2RGB_native(h, s, v, b, g, r, hs);
-
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = b;
-    *dst.ptr(batch_idx, dst_y, dst_x, 1)        = g;
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = r;
-    if (dcn == 4)
-        *dst.ptr(batch_idx, dst_y, dst_x, 3) = alpha;
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         constexpr bool is8u = std::is_same_v<T, uchar>;
+
+                         float3 lab = make_float3(*src.ptr(batch_idx, dst_y, dst_x, 0),
+                                                  *src.ptr(batch_idx, dst_y, dst_x, 1),
+                                                  *src.ptr(batch_idx, dst_y, dst_x, 2));
+                         if (is8u)
+                         {
+                             lab = LabFrom8u(lab, isLuv);
+                         }
+
+                         float b, g, r;
+                         LabToLinearRGB(lab, isLuv, r, g, b);
+                         if (isSrgb)
+                         {
+                             b = LinearToSrgb(b);
+                             g = LinearToSrgb(g);
+                             r = LinearToSrgb(r);
+                         }
+
+                         const float scale = is8u ? 255.f : 1.f;
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = cuda::SaturateCast<T>(b * scale);
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1)        = cuda::SaturateCast<T>(g * scale);
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = cuda::SaturateCast<T>(r * scale);
+                         if (dcn == 4)
+                             *dst.ptr(batch_idx, dst_y, dst_x, 3) = is8u ? cuda::TypeTraits<T>::max : T(1);
+                     });
 }
 
 __device__ __forceinline__ void yuv42xxp_to_bgr_kernel(const int &Y, const int &U, const int &V, uchar &r, uchar &g,
@@ -464,163 +530,492 @@ __device__ __forceinline__ void bgr_to_yuv42xxp_kernel(const uchar &r, const uch
 }
 
 template<class SrcWrapper, class DstWrapper>
-__global__ void bgr_to_yuv420p_char_nhwc(SrcWrapper src, DstWrapper dst, int2 srcSize, int scn, int bidx, int uidx)
+__global__ void bgr_to_yuv420p_char_nhwc(SrcWrapper src, DstWrapper dst, int3 srcSize, int scn, int bidx, int uidx)
+{
+    ForEachGridPixel(srcSize,
+                     [&](int batch_idx, int src_x, int src_y)
+                     {
+                         int plane_y_step  = srcSize.y * srcSize.x;
+                         int plane_uv_step = plane_y_step / 4;
+                         int uv_x          = (src_y % 4 < 2) ? src_x / 2 : (src_x / 2 + srcSize.x / 2);
+
+                         uchar b = static_cast<uchar>(*src.ptr(batch_idx, src_y, src_x, bidx));
+                         uchar g = static_cast<uchar>(*src.ptr(batch_idx, src_y, src_x, 1));
+                         uchar r = static_cast<uchar>(*src.ptr(batch_idx, src_y, src_x, bidx ^ 2));
+                         // Ignore gray channel if input is RGBA
+
+                         uchar Y{0}, U{0}, V{0};
+                         bgr_to_yuv42xxp_kernel(r, g, b, Y, U, V);
+
+                         *dst.ptr(batch_idx, src_y, src_x, 0) = Y;
+                         if (src_y % 2 == 0 && src_x % 2 == 0)
+                         {
+                             *dst.ptr(batch_idx, srcSize.y + src_y / 4, uv_x + plane_uv_step * uidx)       = U;
+                             *dst.ptr(batch_idx, srcSize.y + src_y / 4, uv_x + plane_uv_step * (1 - uidx)) = V;
+                         }
+                     });
+}
+
+template<class SrcWrapper, class DstWrapper>
+__global__ void bgr_to_yuv420sp_char_nhwc(SrcWrapper src, DstWrapper dst, int3 srcSize, int scn, int bidx, int uidx)
 {
-    int src_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int src_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (src_x >= srcSize.x || src_y >= srcSize.y)
-        return;
-    const int batch_idx     = get_batch_idx();
-    int       plane_y_step  = srcSize.y * srcSize.x;
-    int       plane_uv_step = plane_y_step / 4;
-    int       uv_x          = (src_y % 4 < 2) ? src_x / 2 : (src_x / 2 + srcSize.x / 2);
+    ForEachGridPixel(srcSize,
+                     [&](int batch_idx, int src_x, int src_y)
+                     {
+                         int uv_x = (src_x % 2 == 0) ? src_x : (src_x - 1);
+
+                         uchar b = static_cast<uchar>(*src.ptr(batch_idx, src_y, src_x, bidx));
+                         uchar g = static_cast<uchar>(*src.ptr(batch_idx, src_y, src_x, 1));
+                         uchar r = static_cast<uchar>(*src.ptr(batch_idx, src_y, src_x, bidx ^ 2));
+                         // Ignore gray channel if input is RGBA
+
+                         uchar Y{0}, U{0}, V{0};
+                         bgr_to_yuv42xxp_kernel(r, g, b, Y, U, V);
+
+                         *dst.ptr(batch_idx, src_y, src_x, 0) = Y;
+                         if (src_y % 2 == 0 && src_x % 2 == 0)
+                         {
+                             *dst.ptr(batch_idx, srcSize.y + src_y / 2, uv_x + uidx)       = U;
+                             *dst.ptr(batch_idx, srcSize.y + src_y / 2, uv_x + (1 - uidx)) = V;
+                         }
+                     });
+}
 
-    uchar b = static_cast<uchar>(*src.ptr(batch_idx, src_y, src_x, bidx));
-    uchar g = static_cast<uchar>(*src.ptr(batch_idx, src_y, src_x, 1));
-    uchar r = static_cast<uchar>(*src.ptr(batch_idx, src_y, src_x, bidx ^ 2));
-    // Ignore gray channel if input is RGBA
+template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
+__global__ void yuv420sp_to_bgr_char_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int dcn, int bidx, int uidx)
+{
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         int uv_x = (dst_x % 2 == 0) ? dst_x : (dst_x - 1);
+
+                         T Y = *src.ptr(batch_idx, dst_y, dst_x, 0);
+                         T U = *src.ptr(batch_idx, dstSize.y + dst_y / 2, uv_x + uidx);
+                         T V = *src.ptr(batch_idx, dstSize.y + dst_y / 2, uv_x + 1 - uidx);
+
+                         uchar r{0}, g{0}, b{0}, a{0xff};
+                         yuv42xxp_to_bgr_kernel(int(Y), int(U), int(V), r, g, b);
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = b;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1)        = g;
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = r;
+                         if (dcn == 4)
+                         {
+                             *dst.ptr(batch_idx, dst_y, dst_x, 3) = a;
+                         }
+                     });
+}
 
-    uchar Y{0}, U{0}, V{0};
-    bgr_to_yuv42xxp_kernel(r, g, b, Y, U, V);
+// 16-bit YUV 4:2:0 (P010/P016) to RGB ------------------------------------------
 
-    *dst.ptr(batch_idx, src_y, src_x, 0) = Y;
-    if (src_y % 2 == 0 && src_x % 2 == 0)
-    {
-        *dst.ptr(batch_idx, srcSize.y + src_y / 4, uv_x + plane_uv_step * uidx)       = U;
-        *dst.ptr(batch_idx, srcSize.y + src_y / 4, uv_x + plane_uv_step * (1 - uidx)) = V;
-    }
+enum Yuv16ToneMap
+{
+    kToneMapNone,
+    kToneMapPQ,
+    kToneMapHLG
+};
+
+// Conversion of 16-bit components normalized to [0,1], Y = (Y16 - yOffset) * yScale, C = (C16 - 32768) * cScale.
+struct Yuv16ToRgbParams
+{
+    float yOffset, yScale, cScale;
+    float crToR, cbToG, crToG, cbToB;
+    int   toneMap;
+};
+
+// Assumed mastering display peak of HDR content and SDR reference white, as in ITU-R BT.2408.
+constexpr float kHdrPeakNits  = 1000.f;
+constexpr float kSdrWhiteNits = 203.f;
+
+// Display light in nits from a PQ signal, SMPTE ST 2084 EOTF.
+__device__ __forceinline__ float pq_eotf(float e)
+{
+    constexpr float m1 = 0.1593017578125f, m2 = 78.84375f;
+    constexpr float c1 = 0.8359375f, c2 = 18.8515625f, c3 = 18.6875f;
+
+    float p = powf(fmaxf(e, 0.f), 1.f / m2);
+    return 10000.f * powf(fmaxf(p - c1, 0.f) / (c2 - c3 * p), 1.f / m1);
 }
 
-template<class SrcWrapper, class DstWrapper>
-__global__ void bgr_to_yuv420sp_char_nhwc(SrcWrapper src, DstWrapper dst, int2 srcSize, int scn, int bidx, int uidx)
+// Normalized scene light from an HLG signal, ITU-R BT.2100 inverse OETF.
+__device__ __forceinline__ float hlg_inv_oetf(float e)
+{
+    constexpr float a = 0.17883277f, b = 0.28466892f, c = 0.55991073f;
+
+    e = fmaxf(e, 0.f);
+    return e <= 0.5f ? e * e / 3.f : (expf((e - c) / a) + b) / 12.f;
+}
+
+// Maps non-linear BT.2020 PQ/HLG RGB to non-linear BT.709 SDR RGB in [0,1].
+__device__ __forceinline__ void hdr_to_sdr(float &r, float &g, float &b, int toneMap)
 {
-    int src_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int src_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (src_x >= srcSize.x || src_y >= srcSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-    int       uv_x      = (src_x % 2 == 0) ? src_x : (src_x - 1);
+    // Linear light relative to SDR reference white
+    if (toneMap == kToneMapPQ)
+    {
+        r = pq_eotf(r) / kSdrWhiteNits;
+        g = pq_eotf(g) / kSdrWhiteNits;
+        b = pq_eotf(b) / kSdrWhiteNits;
+    }
+    else
+    {
+        r = hlg_inv_oetf(r);
+        g = hlg_inv_oetf(g);
+        b = hlg_inv_oetf(b);
 
-    uchar b = static_cast<uchar>(*src.ptr(batch_idx, src_y, src_x, bidx));
-    uchar g = static_cast<uchar>(*src.ptr(batch_idx, src_y, src_x, 1));
-    uchar r = static_cast<uchar>(*src.ptr(batch_idx, src_y, src_x, bidx ^ 2));
-    // Ignore gray channel if input is RGBA
+        // HLG OOTF with system gamma 1.2 for a kHdrPeakNits display
+        float ys = 0.2627f * r + 0.6780f * g + 0.0593f * b;
+        float k  = kHdrPeakNits / kSdrWhiteNits * powf(ys, 0.2f);
+        r *= k;
+        g *= k;
+        b *= k;
+    }
 
-    uchar Y{0}, U{0}, V{0};
-    bgr_to_yuv42xxp_kernel(r, g, b, Y, U, V);
+    // Extended Reinhard on luminance, the HDR peak maps to SDR white
+    constexpr float peak = kHdrPeakNits / kSdrWhiteNits;
 
-    *dst.ptr(batch_idx, src_y, src_x, 0) = Y;
-    if (src_y % 2 == 0 && src_x % 2 == 0)
+    float l = 0.2627f * r + 0.6780f * g + 0.0593f * b;
+    if (l > 0.f)
     {
-        *dst.ptr(batch_idx, srcSize.y + src_y / 2, uv_x + uidx)       = U;
-        *dst.ptr(batch_idx, srcSize.y + src_y / 2, uv_x + (1 - uidx)) = V;
+        float s = (1.f + l / (peak * peak)) / (1.f + l);
+        r *= s;
+        g *= s;
+        b *= s;
+    }
+
+    // BT.2020 to BT.709 primaries
+    float r709 = 1.6605f * r - 0.5876f * g - 0.0728f * b;
+    float g709 = -0.1246f * r + 1.1329f * g - 0.0083f * b;
+    float b709 = -0.0182f * r - 0.1006f * g + 1.1187f * b;
+
+    // BT.1886 display with gamma 2.4
+    r = powf(fminf(fmaxf(r709, 0.f), 1.f), 1.f / 2.4f);
+    g = powf(fminf(fmaxf(g709, 0.f), 1.f), 1.f / 2.4f);
+    b = powf(fminf(fmaxf(b709, 0.f), 1.f), 1.f / 2.4f);
+}
+
+template<typename T>
+__device__ __forceinline__ T yuv16_to_output(float v)
+{
+    v = fminf(fmaxf(v, 0.f), 1.f);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return v;
+    }
+    else
+    {
+        return cuda::SaturateCast<T>(v * cuda::TypeTraits<T>::max);
     }
 }
 
 template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void yuv420sp_to_bgr_char_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int dcn, int bidx, int uidx)
+__global__ void yuv420sp16_to_bgr_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int dcn, int bidx,
+                                       Yuv16ToRgbParams params)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-    int       uv_x      = (dst_x % 2 == 0) ? dst_x : (dst_x - 1);
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         int uv_x = dst_x & ~1;
+
+                         float Y = (float(*src.ptr(batch_idx, dst_y, dst_x, 0)) - params.yOffset) * params.yScale;
+                         float U = (float(*src.ptr(batch_idx, dstSize.y + dst_y / 2, uv_x)) - 32768.f) * params.cScale;
+                         float V
+                             = (float(*src.ptr(batch_idx, dstSize.y + dst_y / 2, uv_x + 1)) - 32768.f) * params.cScale;
+
+                         float r = Y + params.crToR * V;
+                         float g = Y - params.cbToG * U - params.crToG * V;
+                         float b = Y + params.cbToB * U;
+
+                         if (params.toneMap != kToneMapNone)
+                         {
+                             hdr_to_sdr(r, g, b, params.toneMap);
+                         }
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = yuv16_to_output<T>(b);
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1)        = yuv16_to_output<T>(g);
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = yuv16_to_output<T>(r);
+                         if (dcn == 4)
+                         {
+                             *dst.ptr(batch_idx, dst_y, dst_x, 3) = yuv16_to_output<T>(1.f);
+                         }
+                     });
+}
 
-    T Y = *src.ptr(batch_idx, dst_y, dst_x, 0);
-    T U = *src.ptr(batch_idx, dstSize.y + dst_y / 2, uv_x + uidx);
-    T V = *src.ptr(batch_idx, dstSize.y + dst_y / 2, uv_x + 1 - uidx);
+template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
+__global__ void yuv420p_to_bgr_char_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int dcn, int bidx, int uidx)
+{
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         int plane_y_step  = dstSize.y * dstSize.x;
+                         int plane_uv_step = plane_y_step / 4;
+                         int uv_x          = (dst_y % 4 < 2) ? dst_x / 2 : (dst_x / 2 + dstSize.x / 2);
+
+                         T Y = *src.ptr(batch_idx, dst_y, dst_x, 0);
+                         T U = *src.ptr(batch_idx, dstSize.y + dst_y / 4, uv_x + plane_uv_step * uidx);
+                         T V = *src.ptr(batch_idx, dstSize.y + dst_y / 4, uv_x + plane_uv_step * (1 - uidx));
+
+                         uchar r{0}, g{0}, b{0}, a{0xff};
+                         yuv42xxp_to_bgr_kernel(int(Y), int(U), int(V), r, g, b);
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = b;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1)        = g;
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = r;
+                         if (dcn == 4)
+                         {
+                             *dst.ptr(batch_idx, dst_y, dst_x, 3) = a;
+                         }
+                     });
+}
 
-    uchar r{0}, g{0}, b{0}, a{0xff};
-    yuv42xxp_to_bgr_kernel(int(Y), int(U), int(V), r, g, b);
+template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
+__global__ void yuv422_to_bgr_char_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int dcn, int bidx, int yidx,
+                                        int uidx)
+{
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         int uv_x = (dst_x % 2 == 0) ? dst_x : dst_x - 1;
+
+                         T Y = *src.ptr(batch_idx, dst_y, dst_x, yidx);
+                         T U = *src.ptr(batch_idx, dst_y, uv_x, (1 - yidx) + uidx);
+                         T V = *src.ptr(batch_idx, dst_y, uv_x, (1 - yidx) + uidx ^ 2);
+
+                         uchar r{0}, g{0}, b{0}, a{0xff};
+                         yuv42xxp_to_bgr_kernel(int(Y), int(U), int(V), r, g, b);
+
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = b;
+                         *dst.ptr(batch_idx, dst_y, dst_x, 1)        = g;
+                         *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = r;
+                         if (dcn == 4)
+                         {
+                             *dst.ptr(batch_idx, dst_y, dst_x, 3) = a;
+                         }
+                     });
+}
 
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = b;
-    *dst.ptr(batch_idx, dst_y, dst_x, 1)        = g;
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = r;
-    if (dcn == 4)
-    {
-        *dst.ptr(batch_idx, dst_y, dst_x, 3) = a;
-    }
+template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
+__global__ void yuv420_to_gray_char_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize)
+{
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         T Y = *src.ptr(batch_idx, dst_y, dst_x, 0);
+                         *dst.ptr(batch_idx, dst_y, dst_x, 0) = Y;
+                     });
 }
 
 template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void yuv420p_to_bgr_char_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int dcn, int bidx, int uidx)
+__global__ void yuv422_to_gray_char_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, int yidx)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
+    ForEachGridPixel(dstSize,
+                     [&](int batch_idx, int dst_x, int dst_y)
+                     {
+                         T Y = *src.ptr(batch_idx, dst_y, dst_x, yidx);
+                         *dst.ptr(batch_idx, dst_y, dst_x, 0) = Y;
+                     });
+}
 
-    const int batch_idx     = get_batch_idx();
-    int       plane_y_step  = dstSize.y * dstSize.x;
-    int       plane_uv_step = plane_y_step / 4;
-    int       uv_x          = (dst_y % 4 < 2) ? dst_x / 2 : (dst_x / 2 + dstSize.x / 2);
+// 8-bit conversions processing 4 pixels per thread.  The 4 pixels of CN interleaved channels are loaded and stored
+// as CN 32-bit words (a single 128-bit word for 4 channels when aligned), and unpacked with byte permutations into
+// one 32-bit word per pixel, channel c in byte c, unused bytes being undefined.  Per-pixel operations work on these
+// words, channel swaps and alpha add/remove being a single __byte_perm.
 
-    T Y = *src.ptr(batch_idx, dst_y, dst_x, 0);
-    T U = *src.ptr(batch_idx, dstSize.y + dst_y / 4, uv_x + plane_uv_step * uidx);
-    T V = *src.ptr(batch_idx, dstSize.y + dst_y / 4, uv_x + plane_uv_step * (1 - uidx));
+template<int CN>
+__device__ __forceinline__ void load_pixels4_8u(const uint8_t *in, uint32_t (&px)[4])
+{
+    if constexpr (CN == 1)
+    {
+        uint32_t w = *reinterpret_cast<const uint32_t *>(in);
+#pragma unroll
+        for (int i = 0; i < 4; ++i)
+        {
+            px[i] = __byte_perm(w, 0, 0x4440 | i);
+        }
+    }
+    else if constexpr (CN == 3)
+    {
+        const uint32_t *w = reinterpret_cast<const uint32_t *>(in);
+        uint32_t        w0 = w[0], w1 = w[1], w2 = w[2];
 
-    uchar r{0}, g{0}, b{0}, a{0xff};
-    yuv42xxp_to_bgr_kernel(int(Y), int(U), int(V), r, g, b);
+        px[0] = __byte_perm(w0, 0, 0x4210);
+        px[1] = __byte_perm(w0, w1, 0x0543);
+        px[2] = __byte_perm(w1, w2, 0x0432);
+        px[3] = __byte_perm(w2, 0, 0x4321);
+    }
+    else
+    {
+        static_assert(CN == 4, "Only 1, 3 and 4 channels are supported");
+        if (reinterpret_cast<uintptr_t>(in) % sizeof(uint4) == 0)
+        {
+            uint4 w = *reinterpret_cast<const uint4 *>(in);
+            px[0] = w.x, px[1] = w.y, px[2] = w.z, px[3] = w.w;
+        }
+        else
+        {
+            const uint32_t *w = reinterpret_cast<const uint32_t *>(in);
+            px[0] = w[0], px[1] = w[1], px[2] = w[2], px[3] = w[3];
+        }
+    }
+}
+
+template<int CN>
+__device__ __forceinline__ void store_pixels4_8u(uint8_t *out, const uint32_t (&px)[4])
+{
+    if constexpr (CN == 1)
+    {
+        *reinterpret_cast<uint32_t *>(out)
+            = __byte_perm(__byte_perm(px[0], px[1], 0x0040), __byte_perm(px[2], px[3], 0x0040), 0x5410);
+    }
+    else if constexpr (CN == 3)
+    {
+        uint32_t *w = reinterpret_cast<uint32_t *>(out);
 
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = b;
-    *dst.ptr(batch_idx, dst_y, dst_x, 1)        = g;
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = r;
-    if (dcn == 4)
+        w[0] = __byte_perm(px[0], px[1], 0x4210);
+        w[1] = __byte_perm(px[1], px[2], 0x5421);
+        w[2] = __byte_perm(px[2], px[3], 0x6542);
+    }
+    else
     {
-        *dst.ptr(batch_idx, dst_y, dst_x, 3) = a;
+        static_assert(CN == 4, "Only 1, 3 and 4 channels are supported");
+        if (reinterpret_cast<uintptr_t>(out) % sizeof(uint4) == 0)
+        {
+            *reinterpret_cast<uint4 *>(out) = make_uint4(px[0], px[1], px[2], px[3]);
+        }
+        else
+        {
+            uint32_t *w = reinterpret_cast<uint32_t *>(out);
+            w[0] = px[0], w[1] = px[1], w[2] = px[2], w[3] = px[3];
+        }
     }
 }
 
-template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void yuv422_to_bgr_char_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int dcn, int bidx, int yidx,
-                                        int uidx)
+// Moves the channels of a pixel, byte i of the result is byte sel_i of the pixel, or 255 when sel_i is 4.
+struct PermutePixel8u
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx = get_batch_idx();
-    int       uv_x      = (dst_x % 2 == 0) ? dst_x : dst_x - 1;
+    uint32_t sel;
+
+    __device__ __forceinline__ uint32_t operator()(uint32_t px) const
+    {
+        return __byte_perm(px, 0xff, sel);
+    }
+};
+
+struct BGRToGrayPixel8u
+{
+    int bidx;
+
+    __device__ __forceinline__ uint32_t operator()(uint32_t px) const
+    {
+        int b = (px >> (8 * bidx)) & 0xff;
+        int g = (px >> 8) & 0xff;
+        int r = (px >> (8 * (bidx ^ 2))) & 0xff;
+
+        return CV_DESCALE(b * BY15 + g * GY15 + r * RY15, gray_shift);
+    }
+};
+
+struct BGRToYUVPixel8u
+{
+    int bidx;
+
+    __device__ __forceinline__ uint32_t operator()(uint32_t px) const
+    {
+        int B = (px >> (8 * bidx)) & 0xff;
+        int G = (px >> 8) & 0xff;
+        int R = (px >> (8 * (bidx ^ 2))) & 0xff;
+
+        int delta = 128 * (1 << yuv_shift);
+        int Y     = CV_DESCALE(R * R2Y + G * G2Y + B * B2Y, yuv_shift);
+        int Cr    = CV_DESCALE((R - Y) * R2VI + delta, yuv_shift);
+        int Cb    = CV_DESCALE((B - Y) * B2UI + delta, yuv_shift);
 
-    T Y = *src.ptr(batch_idx, dst_y, dst_x, yidx);
-    T U = *src.ptr(batch_idx, dst_y, uv_x, (1 - yidx) + uidx);
-    T V = *src.ptr(batch_idx, dst_y, uv_x, (1 - yidx) + uidx ^ 2);
+        return cuda::SaturateCast<uint8_t>(Y) | (cuda::SaturateCast<uint8_t>(Cb) << 8)
+             | (cuda::SaturateCast<uint8_t>(Cr) << 16);
+    }
+};
 
-    uchar r{0}, g{0}, b{0}, a{0xff};
-    yuv42xxp_to_bgr_kernel(int(Y), int(U), int(V), r, g, b);
+struct YUVToBGRPixel8u
+{
+    int bidx;
 
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = b;
-    *dst.ptr(batch_idx, dst_y, dst_x, 1)        = g;
-    *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = r;
-    if (dcn == 4)
+    __device__ __forceinline__ uint32_t operator()(uint32_t px) const
     {
-        *dst.ptr(batch_idx, dst_y, dst_x, 3) = a;
+        int Y  = px & 0xff;
+        int Cb = ((px >> 8) & 0xff) - 128;
+        int Cr = ((px >> 16) & 0xff) - 128;
+
+        int b = Y + CV_DESCALE(Cb * U2BI, yuv_shift);
+        int g = Y + CV_DESCALE(Cb * U2GI + Cr * V2GI, yuv_shift);
+        int r = Y + CV_DESCALE(Cr * V2RI, yuv_shift);
+
+        return (cuda::SaturateCast<uint8_t>(b) << (8 * bidx)) | (cuda::SaturateCast<uint8_t>(g) << 8)
+             | (cuda::SaturateCast<uint8_t>(r) << (8 * (bidx ^ 2)));
     }
+};
+
+template<int SCN, int DCN, class SrcWrapper, class DstWrapper, class PixelOp>
+__global__ void cvt_color_8u_vec4_nhwc(SrcWrapper src, DstWrapper dst, int3 dstSize, PixelOp op)
+{
+    ForEachGridPixel<4>(dstSize,
+                        [&](int batch_idx, int dst_x, int dst_y)
+                        {
+                            const uint8_t *in  = src.ptr(batch_idx, dst_y, dst_x, 0);
+                            uint8_t       *out = dst.ptr(batch_idx, dst_y, dst_x, 0);
+
+                            if (dst_x + 4 <= dstSize.x)
+                            {
+                                uint32_t px[4];
+                                load_pixels4_8u<SCN>(in, px);
+#pragma unroll
+                                for (int i = 0; i < 4; ++i)
+                                {
+                                    px[i] = op(px[i]);
+                                }
+                                store_pixels4_8u<DCN>(out, px);
+                            }
+                            else
+                            {
+                                // Last pixels of a row whose width isn't a multiple of 4
+                                for (int i = 0; dst_x + i < dstSize.x; ++i)
+                                {
+                                    uint32_t px = 0;
+#pragma unroll
+                                    for (int c = 0; c < SCN; ++c)
+                                    {
+                                        px |= uint32_t(in[i * SCN + c]) << (8 * c);
+                                    }
+                                    px = op(px);
+#pragma unroll
+                                    for (int c = 0; c < DCN; ++c)
+                                    {
+                                        out[i * DCN + c] = px >> (8 * c);
+                                    }
+                                }
+                            }
+                        });
 }
 
-template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void yuv420_to_gray_char_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize)
+// Whether the 8-bit pixels of the tensor can be accessed 4 at a time with 32-bit words, i.e. pixels are packed
+// and each row starts at a 4-byte boundary.
+inline bool CanUseVec4Access8u(const TensorDataAccessStridedImagePlanar &access)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx                  = get_batch_idx();
-    T         Y                          = *src.ptr(batch_idx, dst_y, dst_x, 0);
-    *dst.ptr(batch_idx, dst_y, dst_x, 0) = Y;
+    return reinterpret_cast<uintptr_t>(access.sampleData(0)) % sizeof(uint32_t) == 0
+        && access.rowStride() % sizeof(uint32_t) == 0 && access.sampleStride() % sizeof(uint32_t) == 0
+        && access.colStride() == access.numChannels() && access.chStride() == 1;
 }
 
-template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void yuv422_to_gray_char_nhwc(SrcWrapper src, DstWrapper dst, int2 dstSize, int yidx)
+template<int SCN, int DCN, class PixelOp>
+inline void cvt_color_8u_vec4(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                              int3 dstSize, PixelOp op, cudaStream_t stream)
 {
-    int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
-    int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
-    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
-        return;
-    const int batch_idx                  = get_batch_idx();
-    T         Y                          = *src.ptr(batch_idx, dst_y, dst_x, yidx);
-    *dst.ptr(batch_idx, dst_y, dst_x, 0) = Y;
+    dim3 blockSize(BLOCK, BLOCK / 4, 1);
+    dim3 gridSize(divUp(divUp(dstSize.x, 4), blockSize.x), divUp(dstSize.y, blockSize.y), dstSize.z);
+    gridSize = BudgetGrid(gridSize, blockSize);
+
+    auto srcWrap = cuda::CreateTensorWrapNHWC<uint8_t>(inData);
+    auto dstWrap = cuda::CreateTensorWrapNHWC<uint8_t>(outData);
+    cvt_color_8u_vec4_nhwc<SCN, DCN><<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, op);
+    checkKernelErrors();
 }
 
 inline ErrorCode BGR_to_RGB(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
@@ -664,8 +1059,26 @@ inline ErrorCode BGR_to_RGB(const ITensorDataStridedCuda &inData, const ITensorD
 
     dim3 blockSize(BLOCK, BLOCK / 4, 1);
     dim3 gridSize(divUp(inputShape.W, blockSize.x), divUp(inputShape.H, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
 
-    int2 dstSize{outputShape.W, outputShape.H};
+    int3 dstSize{outputShape.W, outputShape.H, outputShape.N};
+
+    if ((inDataType == kCV_8U || inDataType == kCV_8S) && CanUseVec4Access8u(*inAccess)
+        && CanUseVec4Access8u(*outAccess))
+    {
+        PermutePixel8u op{static_cast<uint32_t>(bidx | (1 << 4) | ((bidx ^ 2) << 8) | ((sch == 4 ? 3 : 4) << 12))};
+        if (sch == 3)
+        {
+            dch == 3 ? cvt_color_8u_vec4<3, 3>(inData, outData, dstSize, op, stream)
+                     : cvt_color_8u_vec4<3, 4>(inData, outData, dstSize, op, stream);
+        }
+        else
+        {
+            dch == 3 ? cvt_color_8u_vec4<4, 3>(inData, outData, dstSize, op, stream)
+                     : cvt_color_8u_vec4<4, 4>(inData, outData, dstSize, op, stream);
+        }
+        return ErrorCode::SUCCESS;
+    }
 
     switch (inDataType)
     {
@@ -752,8 +1165,19 @@ inline ErrorCode GRAY_to_BGR(const ITensorDataStridedCuda &inData, const ITensor
 
     dim3 blockSize(BLOCK, BLOCK / 4, 1);
     dim3 gridSize(divUp(inputShape.W, blockSize.x), divUp(inputShape.H, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
+
+    int3 dstSize{outputShape.W, outputShape.H, outputShape.N};
 
-    int2 dstSize{outputShape.W, outputShape.H};
+    if ((inDataType == kCV_8U || inDataType == kCV_8S) && CanUseVec4Access8u(*inAccess)
+        && CanUseVec4Access8u(*outAccess))
+    {
+        // Gray is replicated on all channels, alpha included
+        PermutePixel8u op{0x0000};
+        dch == 3 ? cvt_color_8u_vec4<1, 3>(inData, outData, dstSize, op, stream)
+                 : cvt_color_8u_vec4<1, 4>(inData, outData, dstSize, op, stream);
+        return ErrorCode::SUCCESS;
+    }
 
     switch (inDataType)
     {
@@ -841,8 +1265,17 @@ inline ErrorCode BGR_to_GRAY(const ITensorDataStridedCuda &inData, const ITensor
 
     dim3 blockSize(BLOCK, BLOCK / 4, 1);
     dim3 gridSize(divUp(inputShape.W, blockSize.x), divUp(inputShape.H, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
+
+    int3 dstSize{outputShape.W, outputShape.H, outputShape.N};
 
-    int2 dstSize{outputShape.W, outputShape.H};
+    if (inDataType == kCV_8U && CanUseVec4Access8u(*inAccess) && CanUseVec4Access8u(*outAccess))
+    {
+        BGRToGrayPixel8u op{bidx};
+        sch == 3 ? cvt_color_8u_vec4<3, 1>(inData, outData, dstSize, op, stream)
+                 : cvt_color_8u_vec4<4, 1>(inData, outData, dstSize, op, stream);
+        return ErrorCode::SUCCESS;
+    }
 
     switch (inDataType)
     {
@@ -912,8 +1345,15 @@ inline ErrorCode BGR_to_YUV(const ITensorDataStridedCuda &inData, const ITensorD
 
     dim3 blockSize(BLOCK, BLOCK / 4, 1);
     dim3 gridSize(divUp(inputShape.W, blockSize.x), divUp(inputShape.H, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
+
+    int3 dstSize{outputShape.W, outputShape.H, outputShape.N};
 
-    int2 dstSize{outputShape.W, outputShape.H};
+    if (inDataType == kCV_8U && CanUseVec4Access8u(*inAccess) && CanUseVec4Access8u(*outAccess))
+    {
+        cvt_color_8u_vec4<3, 3>(inData, outData, dstSize, BGRToYUVPixel8u{bidx}, stream);
+        return ErrorCode::SUCCESS;
+    }
 
     switch (inDataType)
     {
@@ -983,8 +1423,15 @@ inline ErrorCode YUV_to_BGR(const ITensorDataStridedCuda &inData, const ITensorD
 
     dim3 blockSize(BLOCK, BLOCK / 4, 1);
     dim3 gridSize(divUp(inputShape.W, blockSize.x), divUp(inputShape.H, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
+
+    int3 dstSize{outputShape.W, outputShape.H, outputShape.N};
 
-    int2 dstSize{outputShape.W, outputShape.H};
+    if (inDataType == kCV_8U && CanUseVec4Access8u(*inAccess) && CanUseVec4Access8u(*outAccess))
+    {
+        cvt_color_8u_vec4<3, 3>(inData, outData, dstSize, YUVToBGRPixel8u{bidx}, stream);
+        return ErrorCode::SUCCESS;
+    }
 
     switch (inDataType)
     {
@@ -1055,8 +1502,9 @@ inline ErrorCode BGR_to_HSV(const ITensorDataStridedCuda &inData, const ITensorD
 
     dim3 blockSize(BLOCK, BLOCK / 4, 1);
     dim3 gridSize(divUp(inputShape.W, blockSize.x), divUp(inputShape.H, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
 
-    int2 dstSize{outputShape.W, outputShape.H};
+    int3 dstSize{outputShape.W, outputShape.H, outputShape.N};
 
     switch (inDataType)
     {
@@ -1064,7 +1512,9 @@ inline ErrorCode BGR_to_HSV(const ITensorDataStridedCuda &inData, const ITensorD
     {
         auto srcWrap = cuda::CreateTensorWrapNHWC<uint8_t>(inData);
         auto dstWrap = cuda::CreateTensorWrapNHWC<uint8_t>(outData);
-        bgr_to_hsv_char_nhwc<<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, bidx, isFullRange);
+        int hrange = isFullRange ? 256 : 180;
+        bgr_to_hsv_char_nhwc<<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, bidx, hrange,
+                                                                  GetHsvDivTables8u(isFullRange));
         checkKernelErrors();
     }
     break;
@@ -1072,7 +1522,12 @@ inline ErrorCode BGR_to_HSV(const ITensorDataStridedCuda &inData, const ITensorD
     {
         auto srcWrap = cuda::CreateTensorWrapNHWC<float>(inData);
         auto dstWrap = cuda::CreateTensorWrapNHWC<float>(outData);
-        bgr_to_hsv_float_nhwc<<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, bidx);
+        DispatchPrecision(
+            [&](auto fast)
+            {
+                bgr_to_hsv_float_nhwc<decltype(fast)::value>
+                    <<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, bidx);
+            });
         checkKernelErrors();
     }
     break;
@@ -1124,8 +1579,9 @@ inline ErrorCode HSV_to_BGR(const ITensorDataStridedCuda &inData, const ITensorD
 
     dim3 blockSize(BLOCK, BLOCK / 4, 1);
     dim3 gridSize(divUp(inputShape.W, blockSize.x), divUp(inputShape.H, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
 
-    int2 dstSize{outputShape.W, outputShape.H};
+    int3 dstSize{outputShape.W, outputShape.H, outputShape.N};
     int  dcn = outputShape.C;
 
     switch (inDataType)
@@ -1134,7 +1590,12 @@ inline ErrorCode HSV_to_BGR(const ITensorDataStridedCuda &inData, const ITensorD
     {
         auto srcWrap = cuda::CreateTensorWrapNHWC<uint8_t>(inData);
         auto dstWrap = cuda::CreateTensorWrapNHWC<uint8_t>(outData);
-        hsv_to_bgr_char_nhwc<<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, bidx, dcn, isFullRange);
+        DispatchPrecision(
+            [&](auto fast)
+            {
+                hsv_to_bgr_char_nhwc<decltype(fast)::value>
+                    <<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, bidx, dcn, isFullRange);
+            });
         checkKernelErrors();
     }
     break;
@@ -1142,7 +1603,166 @@ inline ErrorCode HSV_to_BGR(const ITensorDataStridedCuda &inData, const ITensorD
     {
         auto srcWrap = cuda::CreateTensorWrapNHWC<float>(inData);
         auto dstWrap = cuda::CreateTensorWrapNHWC<float>(outData);
-        hsv_to_bgr_float_nhwc<<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, bidx, dcn);
+        DispatchPrecision(
+            [&](auto fast)
+            {
+                hsv_to_bgr_float_nhwc<decltype(fast)::value>
+                    <<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, bidx, dcn);
+            });
+        checkKernelErrors();
+    }
+    break;
+    default:
+        LOG_ERROR("Unsupported DataType " << inDataType);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+inline ErrorCode BGR_to_Lab(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                            NVCVColorConversionCode code, cudaStream_t stream)
+{
+    int bidx = (code == NVCV_COLOR_BGR2Lab || code == NVCV_COLOR_BGR2Luv || code == NVCV_COLOR_LBGR2Lab
+                || code == NVCV_COLOR_LBGR2Luv)
+                 ? 0
+                 : 2;
+    bool isLuv  = (code == NVCV_COLOR_BGR2Luv || code == NVCV_COLOR_RGB2Luv || code == NVCV_COLOR_LBGR2Luv
+                  || code == NVCV_COLOR_LRGB2Luv);
+    bool isSrgb = (code == NVCV_COLOR_BGR2Lab || code == NVCV_COLOR_RGB2Lab || code == NVCV_COLOR_BGR2Luv
+                   || code == NVCV_COLOR_RGB2Luv);
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    cuda_op::DataType  inDataType = helpers::GetLegacyDataType(inData.dtype());
+    cuda_op::DataShape inputShape = helpers::GetLegacyDataShape(inAccess->infoShape());
+
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    cuda_op::DataType  outDataType = helpers::GetLegacyDataType(outData.dtype());
+    cuda_op::DataShape outputShape = helpers::GetLegacyDataShape(outAccess->infoShape());
+
+    if (inputShape.C != 3 && inputShape.C != 4)
+    {
+        LOG_ERROR("Invalid input channel number " << inputShape.C);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (outputShape.C != 3)
+    {
+        LOG_ERROR("Invalid output channel number " << outputShape.C);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (outDataType != inDataType)
+    {
+        LOG_ERROR("Unsupported input/output DataType " << inDataType << "/" << outDataType);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    if (outputShape.H != inputShape.H || outputShape.W != inputShape.W || outputShape.N != inputShape.N)
+    {
+        LOG_ERROR("Invalid output shape " << outputShape);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    dim3 blockSize(BLOCK, BLOCK / 4, 1);
+    dim3 gridSize(divUp(inputShape.W, blockSize.x), divUp(inputShape.H, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
+
+    int3 dstSize{outputShape.W, outputShape.H, outputShape.N};
+
+    switch (inDataType)
+    {
+    case kCV_8U:
+    {
+        auto srcWrap = cuda::CreateTensorWrapNHWC<uint8_t>(inData);
+        auto dstWrap = cuda::CreateTensorWrapNHWC<uint8_t>(outData);
+        bgr_to_lab_char_nhwc<<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, bidx, isLuv,
+                                                                  GetGammaLut8u(isSrgb));
+        checkKernelErrors();
+    }
+    break;
+    case kCV_32F:
+    {
+        auto srcWrap = cuda::CreateTensorWrapNHWC<float>(inData);
+        auto dstWrap = cuda::CreateTensorWrapNHWC<float>(outData);
+        bgr_to_lab_float_nhwc<<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, bidx, isLuv, isSrgb);
+        checkKernelErrors();
+    }
+    break;
+    default:
+        LOG_ERROR("Unsupported DataType " << inDataType);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+inline ErrorCode Lab_to_BGR(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                            NVCVColorConversionCode code, cudaStream_t stream)
+{
+    int bidx = (code == NVCV_COLOR_Lab2BGR || code == NVCV_COLOR_Luv2BGR || code == NVCV_COLOR_Lab2LBGR
+                || code == NVCV_COLOR_Luv2LBGR)
+                 ? 0
+                 : 2;
+    bool isLuv  = (code == NVCV_COLOR_Luv2BGR || code == NVCV_COLOR_Luv2RGB || code == NVCV_COLOR_Luv2LBGR
+                  || code == NVCV_COLOR_Luv2LRGB);
+    bool isSrgb = (code == NVCV_COLOR_Lab2BGR || code == NVCV_COLOR_Lab2RGB || code == NVCV_COLOR_Luv2BGR
+                   || code == NVCV_COLOR_Luv2RGB);
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    cuda_op::DataType  inDataType = helpers::GetLegacyDataType(inData.dtype());
+    cuda_op::DataShape inputShape = helpers::GetLegacyDataShape(inAccess->infoShape());
+
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    cuda_op::DataType  outDataType = helpers::GetLegacyDataType(outData.dtype());
+    cuda_op::DataShape outputShape = helpers::GetLegacyDataShape(outAccess->infoShape());
+
+    if (outputShape.C != 3 && outputShape.C != 4)
+    {
+        LOG_ERROR("Invalid output channel number " << outputShape.C);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (inputShape.C != 3)
+    {
+        LOG_ERROR("Invalid input channel number " << inputShape.C);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (outDataType != inDataType)
+    {
+        LOG_ERROR("Unsupported input/output DataType " << inDataType << "/" << outDataType);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    if (outputShape.H != inputShape.H || outputShape.W != inputShape.W || outputShape.N != inputShape.N)
+    {
+        LOG_ERROR("Invalid output shape " << outputShape);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    dim3 blockSize(BLOCK, BLOCK / 4, 1);
+    dim3 gridSize(divUp(inputShape.W, blockSize.x), divUp(inputShape.H, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
+
+    int3 dstSize{outputShape.W, outputShape.H, outputShape.N};
+    int  dcn = outputShape.C;
+
+    switch (inDataType)
+    {
+    case kCV_8U:
+    {
+        auto srcWrap = cuda::CreateTensorWrapNHWC<uint8_t>(inData);
+        auto dstWrap = cuda::CreateTensorWrapNHWC<uint8_t>(outData);
+        lab_to_bgr_nhwc<<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, bidx, dcn, isLuv, isSrgb);
+        checkKernelErrors();
+    }
+    break;
+    case kCV_32F:
+    {
+        auto srcWrap = cuda::CreateTensorWrapNHWC<float>(inData);
+        auto dstWrap = cuda::CreateTensorWrapNHWC<float>(outData);
+        lab_to_bgr_nhwc<<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, bidx, dcn, isLuv, isSrgb);
         checkKernelErrors();
     }
     break;
@@ -1214,8 +1834,9 @@ inline ErrorCode YUV420xp_to_BGR(const ITensorDataStridedCuda &inData, const ITe
 
     dim3 blockSize(BLOCK, BLOCK / 1, 1);
     dim3 gridSize(divUp(rgb_width, blockSize.x), divUp(rgb_height, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
 
-    int2 dstSize{outputShape.W, outputShape.H};
+    int3 dstSize{outputShape.W, outputShape.H, outputShape.N};
     int  dcn = outputShape.C;
 
     auto srcWrap = cuda::CreateTensorWrapNHWC<uint8_t>(inData);
@@ -1330,8 +1951,9 @@ inline ErrorCode YUV422_to_BGR(const ITensorDataStridedCuda &inData, const ITens
 
     dim3 blockSize(BLOCK, BLOCK / 4, 1);
     dim3 gridSize(divUp(inputShape.W, blockSize.x), divUp(inputShape.H, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
 
-    int2 dstSize{outputShape.W, outputShape.H};
+    int3 dstSize{outputShape.W, outputShape.H, outputShape.N};
     int  dcn = outputShape.C;
 
     auto srcWrap = cuda::CreateTensorWrapNHWC<uint8_t>(inData);
@@ -1374,10 +1996,11 @@ template<class SrcWrapper, class DstWrapper>
 inline static void bgr_to_yuv420p_launcher(SrcWrapper srcWrap, DstWrapper dstWrap, DataShape inputShape, int bidx,
                                            int uidx, cudaStream_t stream)
 {
-    int2 srcSize{inputShape.W, inputShape.H};
+    int3 srcSize{inputShape.W, inputShape.H, inputShape.N};
     // method 1
     dim3 blockSize(BLOCK, BLOCK / 1, 1);
     dim3 gridSize(divUp(inputShape.W, blockSize.x), divUp(inputShape.H, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
     bgr_to_yuv420p_char_nhwc<<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, srcSize, inputShape.C, bidx, uidx);
     checkKernelErrors();
 
@@ -1389,10 +2012,11 @@ template<class SrcWrapper, class DstWrapper>
 inline static void bgr_to_yuv420sp_launcher(SrcWrapper srcWrap, DstWrapper dstWrap, DataShape inputShape, int bidx,
                                             int uidx, cudaStream_t stream)
 {
-    int2 srcSize{inputShape.W, inputShape.H};
+    int3 srcSize{inputShape.W, inputShape.H, inputShape.N};
     // method 1
     dim3 blockSize(BLOCK, BLOCK / 1, 1);
     dim3 gridSize(divUp(inputShape.W, blockSize.x), divUp(inputShape.H, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
     bgr_to_yuv420sp_char_nhwc<<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, srcSize, inputShape.C, bidx, uidx);
     checkKernelErrors();
 
@@ -1499,8 +2123,160 @@ size_t CvtColor::calBufferSize(DataShape max_input_shape, DataShape max_output_s
     return 0;
 }
 
+template<typename T>
+inline void launch_yuv420sp16_to_bgr(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                                     dim3 gridSize, dim3 blockSize, int3 dstSize, int dcn, int bidx,
+                                     const Yuv16ToRgbParams &params, cudaStream_t stream)
+{
+    auto srcWrap = cuda::CreateTensorWrapNHWC<uint16_t>(inData);
+    auto dstWrap = cuda::CreateTensorWrapNHWC<T>(outData);
+
+    yuv420sp16_to_bgr_nhwc<<<gridSize, blockSize, 0, stream>>>(srcWrap, dstWrap, dstSize, dcn, bidx, params);
+    checkKernelErrors();
+}
+
+inline ErrorCode YUV420sp16_to_BGR(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                                   NVCVColorConversionCode code, NVCVColorSpec inSpec, cudaStream_t stream)
+{
+    int bidx = (code == NVCV_COLOR_YUV2BGR_P010 || code == NVCV_COLOR_YUV2BGRA_P010) ? 0 : 2;
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    cuda_op::DataType  inDataType = helpers::GetLegacyDataType(inData.dtype());
+    cuda_op::DataShape inputShape = helpers::GetLegacyDataShape(inAccess->infoShape());
+
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    cuda_op::DataType  outDataType = helpers::GetLegacyDataType(outData.dtype());
+    cuda_op::DataShape outputShape = helpers::GetLegacyDataShape(outAccess->infoShape());
+
+    if (outputShape.C != 3 && outputShape.C != 4)
+    {
+        LOG_ERROR("Invalid output channel number " << outputShape.C);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (inputShape.C != 1)
+    {
+        LOG_ERROR("Invalid input channel number " << inputShape.C);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (inputShape.H % 3 != 0 || inputShape.W % 2 != 0)
+    {
+        LOG_ERROR("Invalid input shape " << inputShape);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (inDataType != kCV_16U || (outDataType != kCV_8U && outDataType != kCV_16U && outDataType != kCV_32F))
+    {
+        LOG_ERROR("Unsupported input/output DataType " << inDataType << "/" << outDataType);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    int rgb_width  = inputShape.W;
+    int rgb_height = inputShape.H * 2 / 3;
+
+    if (outputShape.H != rgb_height || outputShape.W != rgb_width || outputShape.N != inputShape.N)
+    {
+        LOG_ERROR("Invalid output shape " << outputShape);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    NVCVYCbCrEncoding         encoding;
+    NVCVColorRange            range;
+    NVCVColorTransferFunction xfer;
+    if (nvcvColorSpecGetYCbCrEncoding(inSpec, &encoding) != NVCV_SUCCESS
+        || nvcvColorSpecGetRange(inSpec, &range) != NVCV_SUCCESS
+        || nvcvColorSpecGetColorTransferFunction(inSpec, &xfer) != NVCV_SUCCESS)
+    {
+        LOG_ERROR("Invalid input color spec " << nvcvColorSpecGetName(inSpec));
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    float kr, kb;
+    switch (encoding)
+    {
+    case NVCV_YCbCr_ENC_BT601:
+        kr = 0.299f;
+        kb = 0.114f;
+        break;
+    case NVCV_YCbCr_ENC_BT709:
+        kr = 0.2126f;
+        kb = 0.0722f;
+        break;
+    case NVCV_YCbCr_ENC_BT2020:
+        kr = 0.2627f;
+        kb = 0.0593f;
+        break;
+    case NVCV_YCbCr_ENC_SMPTE240M:
+        kr = 0.212f;
+        kb = 0.087f;
+        break;
+    default:
+        LOG_ERROR("Unsupported YCbCr encoding of input color spec " << nvcvColorSpecGetName(inSpec));
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    float kg = 1.f - kr - kb;
+
+    Yuv16ToRgbParams params;
+    if (range == NVCV_COLOR_RANGE_LIMITED)
+    {
+        // 16-bit words hold the 8-bit limited range scaled by 256, Y in [16, 235], C in [16, 240]
+        params.yOffset = 16 << 8;
+        params.yScale  = 1.f / (219 << 8);
+        params.cScale  = 1.f / (224 << 8);
+    }
+    else
+    {
+        params.yOffset = 0;
+        params.yScale  = 1.f / 65535;
+        params.cScale  = 1.f / 65535;
+    }
+    params.crToR   = 2 * (1 - kr);
+    params.cbToG   = 2 * kb * (1 - kb) / kg;
+    params.crToG   = 2 * kr * (1 - kr) / kg;
+    params.cbToB   = 2 * (1 - kb);
+    params.toneMap = kToneMapNone;
+    if (xfer == NVCV_COLOR_XFER_PQ)
+    {
+        params.toneMap = kToneMapPQ;
+    }
+    else if (xfer == NVCV_COLOR_XFER_HLG)
+    {
+        params.toneMap = kToneMapHLG;
+    }
+
+    dim3 blockSize(BLOCK, BLOCK / 1, 1);
+    dim3 gridSize(divUp(rgb_width, blockSize.x), divUp(rgb_height, blockSize.y), inputShape.N);
+    gridSize = BudgetGrid(gridSize, blockSize);
+
+    int3 dstSize{outputShape.W, outputShape.H, outputShape.N};
+    int  dcn = outputShape.C;
+
+    switch (outDataType)
+    {
+    case kCV_8U:
+        launch_yuv420sp16_to_bgr<uint8_t>(inData, outData, gridSize, blockSize, dstSize, dcn, bidx, params, stream);
+        break;
+    case kCV_16U:
+        launch_yuv420sp16_to_bgr<uint16_t>(inData, outData, gridSize, blockSize, dstSize, dcn, bidx, params, stream);
+        break;
+    default:
+        launch_yuv420sp16_to_bgr<float>(inData, outData, gridSize, blockSize, dstSize, dcn, bidx, params, stream);
+        break;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
 ErrorCode CvtColor::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
                           NVCVColorConversionCode code, cudaStream_t stream)
+{
+    return infer(inData, outData, code, NVCV_COLOR_SPEC_BT2020, stream);
+}
+
+ErrorCode CvtColor::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                          NVCVColorConversionCode code, NVCVColorSpec inSpec, cudaStream_t stream)
 {
     DataFormat input_format  = helpers::GetLegacyDataFormat(inData.layout());
     DataFormat output_format = helpers::GetLegacyDataFormat(outData.layout());
@@ -1577,16 +2353,16 @@ ErrorCode CvtColor::infer(const ITensorDataStridedCuda &inData, const ITensorDat
         0, //                =42
         0, //                =43
 
-        0, //BGR_to_Lab,             // CV_BGR2Lab     =44
-        0, //RGB_to_Lab,             // CV_RGB2Lab     =45
+        BGR_to_Lab, // CV_BGR2Lab     =44
+        BGR_to_Lab, // CV_RGB2Lab     =45
 
         0, //bayerBG_to_BGR,         // CV_BayerBG2BGR =46
         0, //bayeRGB_to_BGR,         // CV_BayeRGB2BGR =47
         0, //bayerRG_to_BGR,         // CV_BayerRG2BGR =48
         0, //bayerGR_to_BGR,         // CV_BayerGR2BGR =49
 
-        0, //BGR_to_Luv,             // CV_BGR2Luv     =50
-        0, //RGB_to_Luv,             // CV_RGB2Luv     =51
+        BGR_to_Lab, // CV_BGR2Luv     =50
+        BGR_to_Lab, // CV_RGB2Luv     =51
 
         0, //BGR_to_HLS,             // CV_BGR2HLS     =52
         0, //RGB_to_HLS,             // CV_RGB2HLS     =53
@@ -1594,10 +2370,10 @@ ErrorCode CvtColor::infer(const ITensorDataStridedCuda &inData, const ITensorDat
         HSV_to_BGR, // CV_HSV2BGR     =54
         HSV_to_BGR, // CV_HSV2RGB     =55
 
-        0, //Lab_to_BGR,             // CV_Lab2BGR     =56
-        0, //Lab_to_RGB,             // CV_Lab2RGB     =57
-        0, //Luv_to_BGR,             // CV_Luv2BGR     =58
-        0, //Luv_to_RGB,             // CV_Luv2RGB     =59
+        Lab_to_BGR, // CV_Lab2BGR     =56
+        Lab_to_BGR, // CV_Lab2RGB     =57
+        Lab_to_BGR, // CV_Luv2BGR     =58
+        Lab_to_BGR, // CV_Luv2RGB     =59
 
         0, //HLS_to_BGR,             // CV_HLS2BGR     =60
         0, //HLS_to_RGB,             // CV_HLS2RGB     =61
@@ -1617,15 +2393,15 @@ ErrorCode CvtColor::infer(const ITensorDataStridedCuda &inData, const ITensorDat
         0,          //HLS_to_BGR_FULL,        // CV_HLS2BGR_FULL = 72
         0,          //HLS_to_RGB_FULL,        // CV_HLS2RGB_FULL = 73
 
-        0, //LBGR_to_Lab,            // CV_LBGR2Lab     = 74
-        0, //LRGB_to_Lab,            // CV_LRGB2Lab     = 75
-        0, //LBGR_to_Luv,            // CV_LBGR2Luv     = 76
-        0, //LRGB_to_Luv,            // CV_LRGB2Luv     = 77
+        BGR_to_Lab, // CV_LBGR2Lab     = 74
+        BGR_to_Lab, // CV_LRGB2Lab     = 75
+        BGR_to_Lab, // CV_LBGR2Luv     = 76
+        BGR_to_Lab, // CV_LRGB2Luv     = 77
 
-        0, //Lab_to_LBGR,            // CV_Lab2LBGR     = 78
-        0, //Lab_to_LRGB,            // CV_Lab2LRGB     = 79
-        0, //Luv_to_LBGR,            // CV_Luv2LBGR     = 80
-        0, //Luv_to_LRGB,            // CV_Luv2LRGB     = 81
+        Lab_to_BGR, // CV_Lab2LBGR     = 78
+        Lab_to_BGR, // CV_Lab2LRGB     = 79
+        Lab_to_BGR, // CV_Luv2LBGR     = 80
+        Lab_to_BGR, // CV_Luv2LRGB     = 81
 
         BGR_to_YUV, // CV_BGR2YUV      = 82
         BGR_to_YUV, // CV_RGB2YUV      = 83
@@ -1728,6 +2504,18 @@ ErrorCode CvtColor::infer(const ITensorDataStridedCuda &inData, const ITensorDat
         0, // CV_COLORCVT_MAX  = 148
     };
 
+    if (code == NVCV_COLOR_YUV2RGB_P010 || code == NVCV_COLOR_YUV2BGR_P010 || code == NVCV_COLOR_YUV2RGBA_P010
+        || code == NVCV_COLOR_YUV2BGRA_P010)
+    {
+        return YUV420sp16_to_BGR(inData, outData, code, inSpec, stream);
+    }
+
+    if (code < 0 || code >= int(sizeof(funcs) / sizeof(funcs[0])))
+    {
+        LOG_ERROR("Invalid convert color code: " << code);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
     func_t func = funcs[code];
 
     if (func == 0)
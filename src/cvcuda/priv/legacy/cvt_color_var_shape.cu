@@ -24,6 +24,8 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "CvtColorUtils.cuh"
+#include "TinyImages.cuh"
 
 #include <cfloat>
 
@@ -134,66 +136,96 @@ __device__ inline bool checkShapeFromYUV420(int rows, int cols, NVCVColorConvers
 }
 
 template<class T>
-__global__ void rgb_to_bgr_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, cuda::ImageBatchVarShapeWrapNHWC<T> dst,
-                                int bidx)
+struct RgbToBgrOp
 {
-    int       dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
-    int       dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
-    if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
-        return;
+    cuda::ImageBatchVarShapeWrapNHWC<T> src, dst;
+    int                                 bidx;
 
-    T b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
-    T g = *src.ptr(batch_idx, dst_y, dst_x, 1);
-    T r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
+    __device__ void operator()(int batch_idx, int dst_x, int dst_y) const
+    {
+        if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
+            return;
 
-    *dst.ptr(batch_idx, dst_y, dst_x, 0) = b;
-    *dst.ptr(batch_idx, dst_y, dst_x, 1) = g;
-    *dst.ptr(batch_idx, dst_y, dst_x, 2) = r;
+        T b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
+        T g = *src.ptr(batch_idx, dst_y, dst_x, 1);
+        T r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
 
-    if (dst.numChannels() == 4)
-    {
-        T al = src.numChannels() == 4 ? *src.ptr(batch_idx, dst_y, dst_x, 3) : cuda::TypeTraits<T>::max;
-        *dst.ptr(batch_idx, dst_y, dst_x, 3) = al;
+        *dst.ptr(batch_idx, dst_y, dst_x, 0) = b;
+        *dst.ptr(batch_idx, dst_y, dst_x, 1) = g;
+        *dst.ptr(batch_idx, dst_y, dst_x, 2) = r;
+
+        if (dst.numChannels() == 4)
+        {
+            T al = src.numChannels() == 4 ? *src.ptr(batch_idx, dst_y, dst_x, 3) : cuda::TypeTraits<T>::max;
+            *dst.ptr(batch_idx, dst_y, dst_x, 3) = al;
+        }
     }
-}
+};
 
 template<class T>
-__global__ void gray_to_bgr_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, cuda::ImageBatchVarShapeWrapNHWC<T> dst)
+struct GrayToBgrOp
 {
-    int       dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
-    int       dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
-    if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
-        return;
+    cuda::ImageBatchVarShapeWrapNHWC<T> src, dst;
 
-    T g = *src.ptr(batch_idx, dst_y, dst_x, 0);
-
-    *dst.ptr(batch_idx, dst_y, dst_x, 0) = g;
-    *dst.ptr(batch_idx, dst_y, dst_x, 1) = g;
-    *dst.ptr(batch_idx, dst_y, dst_x, 2) = g;
-    if (dst.numChannels() == 4)
+    __device__ void operator()(int batch_idx, int dst_x, int dst_y) const
     {
-        *dst.ptr(batch_idx, dst_y, dst_x, 3) = g;
+        if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
+            return;
+
+        T g = *src.ptr(batch_idx, dst_y, dst_x, 0);
+
+        *dst.ptr(batch_idx, dst_y, dst_x, 0) = g;
+        *dst.ptr(batch_idx, dst_y, dst_x, 1) = g;
+        *dst.ptr(batch_idx, dst_y, dst_x, 2) = g;
+        if (dst.numChannels() == 4)
+        {
+            *dst.ptr(batch_idx, dst_y, dst_x, 3) = g;
+        }
     }
-}
+};
 
 template<class T>
-__global__ void bgr_to_gray_char_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, cuda::ImageBatchVarShapeWrapNHWC<T> dst,
-                                      int bidx)
+struct BgrToGrayOp
 {
-    int       dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
-    int       dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
-    if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
-        return;
+    cuda::ImageBatchVarShapeWrapNHWC<T> src, dst;
+    int                                 bidx;
 
-    int b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
-    int g = *src.ptr(batch_idx, dst_y, dst_x, 1);
-    int r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
+    __device__ void operator()(int batch_idx, int dst_x, int dst_y) const
+    {
+        if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
+            return;
+
+        int b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
+        int g = *src.ptr(batch_idx, dst_y, dst_x, 1);
+        int r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
+
+        T gray                               = (T)CV_DESCALE(b * BY15 + g * GY15 + r * RY15, gray_shift);
+        *dst.ptr(batch_idx, dst_y, dst_x, 0) = gray;
+    }
+};
+
+template<class PixelOp>
+__global__ void cvt_color_nhwc(const PixelOp op)
+{
+    op(get_batch_idx(), blockIdx.x * blockDim.x + threadIdx.x, blockIdx.y * blockDim.y + threadIdx.y);
+}
 
-    T gray                               = (T)CV_DESCALE(b * BY15 + g * GY15 + r * RY15, gray_shift);
-    *dst.ptr(batch_idx, dst_y, dst_x, 0) = gray;
+// Conversions of batches of tiny images, e.g. crops before a classifier, take a warp per image
+template<class PixelOp>
+void launchCvtColor(const PixelOp &op, const IImageBatchVarShapeDataStridedCuda &inData, cudaStream_t stream)
+{
+    if (IsTinyBatch(inData.numImages(), inData.maxSize()))
+    {
+        LaunchTinyImages(op, op.dst, inData.numImages(), inData.maxSize(), stream);
+    }
+    else
+    {
+        dim3 blockSize(BLOCK, BLOCK / 4, 1);
+        dim3 gridSize(divUp(inData.maxSize().w, blockSize.x), divUp(inData.maxSize().h, blockSize.y),
+                      inData.numImages());
+        cvt_color_nhwc<<<gridSize, blockSize, 0, stream>>>(op);
+    }
+    checkKernelErrors();
 }
 
 template<class T>
@@ -314,46 +346,44 @@ __global__ void yuv_to_bgr_float_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, c
 
 template<class T>
 __global__ void bgr_to_hsv_char_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, cuda::ImageBatchVarShapeWrapNHWC<T> dst,
-                                     int bidx, bool isFullRange)
+                                     int bidx, int hrange, const HsvDivTables8u tables)
 {
+    __shared__ HsvDivTables8u divTables;
+    LoadTableToShared(tables, divTables);
+
     int       dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
     int       dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
     const int batch_idx = get_batch_idx();
     if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
         return;
 
-    int       b         = *src.ptr(batch_idx, dst_y, dst_x, bidx);
-    int       g         = *src.ptr(batch_idx, dst_y, dst_x, 1);
-    int       r         = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
-    int       hrange    = isFullRange ? 256 : 180;
-    int       hr        = hrange;
-    const int hsv_shift = 12;
-    int       h, s, v = b;
-    int       vmin = b;
-    int       vr, vg;
+    int b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
+    int g = *src.ptr(batch_idx, dst_y, dst_x, 1);
+    int r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
+    int h, s, v = b;
+    int vmin = b;
+    int vr, vg;
 
     v    = cuda::max(v, g);
     v    = cuda::max(v, r);
     vmin = min(vmin, g);
     vmin = min(vmin, r);
 
-    unsigned char diff = cuda::SaturateCast<unsigned char>(v - vmin);
-    vr                 = v == r ? -1 : 0;
-    vg                 = v == g ? -1 : 0;
+    int diff = v - vmin;
+    vr       = v == r ? -1 : 0;
+    vg       = v == g ? -1 : 0;
 
-    int hdiv_table = diff == 0 ? 0 : cuda::SaturateCast<int>((hrange << hsv_shift) / (6. * diff));
-    int sdiv_table = v == 0 ? 0 : cuda::SaturateCast<int>((255 << hsv_shift) / (1. * v));
-    s              = (diff * sdiv_table + (1 << (hsv_shift - 1))) >> hsv_shift;
-    h              = (vr & (g - b)) + (~vr & ((vg & (b - r + 2 * diff)) + ((~vg) & (r - g + 4 * diff))));
-    h              = (h * hdiv_table + (1 << (hsv_shift - 1))) >> hsv_shift;
-    h += h < 0 ? hr : 0;
+    s = (diff * divTables.val[v] + (1 << (hsv_shift - 1))) >> hsv_shift;
+    h = (vr & (g - b)) + (~vr & ((vg & (b - r + 2 * diff)) + ((~vg) & (r - g + 4 * diff))));
+    h = (h * divTables.val[256 + diff] + (1 << (hsv_shift - 1))) >> hsv_shift;
+    h += h < 0 ? hrange : 0;
 
     *dst.ptr(batch_idx, dst_y, dst_x, 0) = cuda::SaturateCast<unsigned char>(h);
     *dst.ptr(batch_idx, dst_y, dst_x, 1) = (unsigned char)s;
     *dst.ptr(batch_idx, dst_y, dst_x, 2) = (unsigned char)v;
 }
 
-template<class T>
+template<bool Fast, class T>
 __global__ void bgr_to_hsv_float_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, cuda::ImageBatchVarShapeWrapNHWC<T> dst,
                                       int bidx)
 {
@@ -383,8 +413,8 @@ __global__ void bgr_to_hsv_float_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, c
         vmin = b;
 
     diff = v - vmin;
-    s    = diff / (float)(fabs(v) + FLT_EPSILON);
-    diff = (float)(60. / (diff + FLT_EPSILON));
+    s    = DivF<Fast>(diff, fabsf(v) + FLT_EPSILON);
+    diff = Fast ? DivF<Fast>(60.f, diff + FLT_EPSILON) : (float)(60. / (diff + FLT_EPSILON));
     if (v == r)
         h = (g - b) * diff;
     else if (v == g)
@@ -400,6 +430,7 @@ __global__ void bgr_to_hsv_float_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, c
     *dst.ptr(batch_idx, dst_y, dst_x, 2) = v;
 }
 
+template<bool Fast>
 __device__ inline void HSV2RGB_native_var_shape(float h, float s, float v, float &b, float &g, float &r,
                                                 const float hscale)
 {
@@ -418,7 +449,7 @@ __device__ inline void HSV2RGB_native_var_shape(float h, float s, float v, float
         float tab[4];
         int   sector;
         h *= hscale;
-        h      = fmod(h, 6.f);
+        h      = Fast ? h - 6.f * floorf(h * (1.f / 6.f)) : fmod(h, 6.f);
         sector = (int)floor(h);
         h -= sector;
         if ((unsigned)sector >= 6u)
@@ -438,7 +469,7 @@ __device__ inline void HSV2RGB_native_var_shape(float h, float s, float v, float
     }
 }
 
-template<class T>
+template<bool Fast, class T>
 __global__ void hsv_to_bgr_char_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, cuda::ImageBatchVarShapeWrapNHWC<T> dst,
                                      int bidx, bool isFullRange)
 {
@@ -457,7 +488,7 @@ __global__ void hsv_to_bgr_char_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, cu
     float         hs     = 6.f / hrange;
 
     float b, g, r;
-    HSV2RGB_native_var_shape(h, s, v, b, g, r, hs);
+    HSV2RGB_native_var_shape<Fast>(h, s, v, b, g, r, hs);
 
     *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = cuda::SaturateCast<uchar>(b * 255.0f);
     *dst.ptr(batch_idx, dst_y, dst_x, 1)        = cuda::SaturateCast<uchar>(g * 255.0f);
@@ -466,7 +497,7 @@ __global__ void hsv_to_bgr_char_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, cu
         *dst.ptr(batch_idx, dst_y, dst_x, 3) = alpha;
 }
 
-template<class T>
+template<bool Fast, class T>
 __global__ void hsv_to_bgr_float_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, cuda::ImageBatchVarShapeWrapNHWC<T> dst,
                                       int bidx)
 {
@@ -485,7 +516,7 @@ __global__ void hsv_to_bgr_float_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, c
     float hs     = 6.f / hrange;
 
     float b, g, r;
-    HSV2RGB_native_var_shape(h, s, v, b, g, r, hs);
+    HSV2RGB_native_var_shape<Fast>(h, s, v, b, g, r, hs);
 
     *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = b;
     *dst.ptr(batch_idx, dst_y, dst_x, 1)        = g;
@@ -494,6 +525,94 @@ __global__ void hsv_to_bgr_float_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, c
         *dst.ptr(batch_idx, dst_y, dst_x, 3) = alpha;
 }
 
+template<class T>
+__global__ void bgr_to_lab_char_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, cuda::ImageBatchVarShapeWrapNHWC<T> dst,
+                                     int bidx, bool isLuv, const GammaLut8u lut)
+{
+    __shared__ GammaLut8u gammaLut;
+    LoadTableToShared(lut, gammaLut);
+
+    int       dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    int       dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+    if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
+        return;
+
+    float b = gammaLut.val[*src.ptr(batch_idx, dst_y, dst_x, bidx)];
+    float g = gammaLut.val[*src.ptr(batch_idx, dst_y, dst_x, 1)];
+    float r = gammaLut.val[*src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2)];
+
+    float3 lab = LabTo8u(LinearRGBToLab(r, g, b, isLuv), isLuv);
+
+    *dst.ptr(batch_idx, dst_y, dst_x, 0) = cuda::SaturateCast<uchar>(lab.x);
+    *dst.ptr(batch_idx, dst_y, dst_x, 1) = cuda::SaturateCast<uchar>(lab.y);
+    *dst.ptr(batch_idx, dst_y, dst_x, 2) = cuda::SaturateCast<uchar>(lab.z);
+}
+
+template<class T>
+__global__ void bgr_to_lab_float_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, cuda::ImageBatchVarShapeWrapNHWC<T> dst,
+                                      int bidx, bool isLuv, bool isSrgb)
+{
+    int       dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    int       dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+    if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
+        return;
+
+    float b = *src.ptr(batch_idx, dst_y, dst_x, bidx);
+    float g = *src.ptr(batch_idx, dst_y, dst_x, 1);
+    float r = *src.ptr(batch_idx, dst_y, dst_x, bidx ^ 2);
+    if (isSrgb)
+    {
+        b = SrgbToLinear(b);
+        g = SrgbToLinear(g);
+        r = SrgbToLinear(r);
+    }
+
+    float3 lab = LinearRGBToLab(r, g, b, isLuv);
+
+    *dst.ptr(batch_idx, dst_y, dst_x, 0) = lab.x;
+    *dst.ptr(batch_idx, dst_y, dst_x, 1) = lab.y;
+    *dst.ptr(batch_idx, dst_y, dst_x, 2) = lab.z;
+}
+
+template<class T>
+__global__ void lab_to_bgr_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src, cuda::ImageBatchVarShapeWrapNHWC<T> dst,
+                                int bidx, bool isLuv, bool isSrgb)
+{
+    int       dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    int       dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+    if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
+        return;
+
+    constexpr bool is8u = std::is_same_v<T, uchar>;
+
+    float3 lab = make_float3(*src.ptr(batch_idx, dst_y, dst_x, 0), *src.ptr(batch_idx, dst_y, dst_x, 1),
+                             *src.ptr(batch_idx, dst_y, dst_x, 2));
+    if (is8u)
+    {
+        lab = LabFrom8u(lab, isLuv);
+    }
+
+    float b, g, r;
+    LabToLinearRGB(lab, isLuv, r, g, b);
+    if (isSrgb)
+    {
+        b = LinearToSrgb(b);
+        g = LinearToSrgb(g);
+        r = LinearToSrgb(r);
+    }
+
+    const float scale = is8u ? 255.f : 1.f;
+
+    *dst.ptr(batch_idx, dst_y, dst_x, bidx)     = cuda::SaturateCast<T>(b * scale);
+    *dst.ptr(batch_idx, dst_y, dst_x, 1)        = cuda::SaturateCast<T>(g * scale);
+    *dst.ptr(batch_idx, dst_y, dst_x, bidx ^ 2) = cuda::SaturateCast<T>(r * scale);
+    if (dst.numChannels() == 4)
+        *dst.ptr(batch_idx, dst_y, dst_x, 3) = is8u ? cuda::TypeTraits<T>::max : T(1);
+}
+
 __device__ __forceinline__ void yuv42xxp_to_bgr_kernel(const int &Y, const int &U, const int &V, uchar &r, uchar &g,
                                                        uchar &b)
 {
@@ -728,6 +847,104 @@ __global__ void yuv422_to_gray_char_nhwc(cuda::ImageBatchVarShapeWrapNHWC<T> src
     *dst.ptr(batch_idx, dst_y, dst_x, 0) = Y;
 }
 
+// Layout of an image in a batch of mixed formats, derived from its image format both on host, to validate
+// the batch, and on device, to select the conversion of each sample.
+struct MixedFormat
+{
+    enum Kind
+    {
+        INVALID,
+        GRAY,     // single 8-bit channel
+        COLOR,    // interleaved 8-bit BGR/RGB, with or without alpha
+        YUV420SP, // NV12, luma plane followed by interleaved UV plane
+    };
+
+    Kind kind;
+    int  channels; // interleaved channels of plane 0
+    int  bidx;     // index of the blue channel of a COLOR image
+};
+
+__host__ __device__ __forceinline__ MixedFormat GetMixedFormat(NVCVImageFormat fmt)
+{
+    switch (fmt)
+    {
+    case NVCV_IMAGE_FORMAT_Y8:
+    case NVCV_IMAGE_FORMAT_Y8_ER:
+        return {MixedFormat::GRAY, 1, 0};
+    case NVCV_IMAGE_FORMAT_BGR8:
+        return {MixedFormat::COLOR, 3, 0};
+    case NVCV_IMAGE_FORMAT_RGB8:
+        return {MixedFormat::COLOR, 3, 2};
+    case NVCV_IMAGE_FORMAT_BGRA8:
+        return {MixedFormat::COLOR, 4, 0};
+    case NVCV_IMAGE_FORMAT_RGBA8:
+        return {MixedFormat::COLOR, 4, 2};
+    case NVCV_IMAGE_FORMAT_NV12:
+        return {MixedFormat::YUV420SP, 1, 0};
+    default:
+        return {MixedFormat::INVALID, 0, 0};
+    }
+}
+
+// Converts each image of a batch with mixed formats to the common format of the output batch.  The input format
+// is read per sample from the batch format list, so the whole batch is converted in a single launch.
+__global__ void mixed_to_common_char_nhwc(cuda::ImageBatchVarShapeWrap<const uchar> src,
+                                          const NVCVImageFormat                     *srcFormats,
+                                          cuda::ImageBatchVarShapeWrapNHWC<uchar> dst, MixedFormat dstFormat)
+{
+    int       dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    int       dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+    if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
+        return;
+
+    const MixedFormat srcFormat = GetMixedFormat(srcFormats[batch_idx]);
+
+    uchar r, g, b, a = 0xff, gray;
+    switch (srcFormat.kind)
+    {
+    case MixedFormat::GRAY:
+        gray = *src.ptr(batch_idx, dst_y, dst_x);
+        r = g = b = gray;
+        break;
+    case MixedFormat::COLOR:
+    {
+        const uchar *pix = src.ptr(batch_idx, dst_y, dst_x * srcFormat.channels);
+
+        b    = pix[srcFormat.bidx];
+        g    = pix[1];
+        r    = pix[srcFormat.bidx ^ 2];
+        a    = srcFormat.channels == 4 ? pix[3] : a;
+        gray = (uchar)CV_DESCALE(b * BY15 + g * GY15 + r * RY15, gray_shift);
+    }
+    break;
+    case MixedFormat::YUV420SP:
+    {
+        const uchar *uv = src.ptr(batch_idx, 1, dst_y / 2, dst_x & ~1);
+
+        gray = *src.ptr(batch_idx, dst_y, dst_x);
+        yuv42xxp_to_bgr_kernel(int(gray), int(uv[0]), int(uv[1]), r, g, b);
+    }
+    break;
+    default:
+        return;
+    }
+
+    if (dstFormat.kind == MixedFormat::GRAY)
+    {
+        *dst.ptr(batch_idx, dst_y, dst_x, 0) = gray;
+        return;
+    }
+
+    *dst.ptr(batch_idx, dst_y, dst_x, dstFormat.bidx)     = b;
+    *dst.ptr(batch_idx, dst_y, dst_x, 1)                  = g;
+    *dst.ptr(batch_idx, dst_y, dst_x, dstFormat.bidx ^ 2) = r;
+    if (dstFormat.channels == 4)
+    {
+        *dst.ptr(batch_idx, dst_y, dst_x, 3) = a;
+    }
+}
+
 inline ErrorCode BGR_to_RGB(const IImageBatchVarShapeDataStridedCuda &inData,
                             const IImageBatchVarShapeDataStridedCuda &outData, NVCVColorConversionCode code,
                             cudaStream_t stream)
@@ -768,13 +985,6 @@ inline ErrorCode BGR_to_RGB(const IImageBatchVarShapeDataStridedCuda &inData,
         return ErrorCode::INVALID_DATA_SHAPE;
     }
 
-    int max_width  = inData.maxSize().w;
-    int max_height = inData.maxSize().h;
-    int batch_size = inData.numImages();
-
-    dim3 blockSize(BLOCK, BLOCK / 4, 1);
-    dim3 gridSize(divUp(max_width, blockSize.x), divUp(max_height, blockSize.y), batch_size);
-
     switch (data_type)
     {
     case kCV_8U:
@@ -782,8 +992,7 @@ inline ErrorCode BGR_to_RGB(const IImageBatchVarShapeDataStridedCuda &inData,
     {
         cuda::ImageBatchVarShapeWrapNHWC<unsigned char> src_ptr(inData, sch);
         cuda::ImageBatchVarShapeWrapNHWC<unsigned char> dst_ptr(outData, dch);
-        rgb_to_bgr_nhwc<unsigned char><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx);
-        checkKernelErrors();
+        launchCvtColor(RgbToBgrOp<unsigned char>{src_ptr, dst_ptr, bidx}, inData, stream);
     }
     break;
     case kCV_16U:
@@ -792,32 +1001,28 @@ inline ErrorCode BGR_to_RGB(const IImageBatchVarShapeDataStridedCuda &inData,
     {
         cuda::ImageBatchVarShapeWrapNHWC<uint16_t> src_ptr(inData, sch);
         cuda::ImageBatchVarShapeWrapNHWC<uint16_t> dst_ptr(outData, dch);
-        rgb_to_bgr_nhwc<uint16_t><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx);
-        checkKernelErrors();
+        launchCvtColor(RgbToBgrOp<uint16_t>{src_ptr, dst_ptr, bidx}, inData, stream);
     }
     break;
     case kCV_32S:
     {
         cuda::ImageBatchVarShapeWrapNHWC<int32_t> src_ptr(inData, sch);
         cuda::ImageBatchVarShapeWrapNHWC<int32_t> dst_ptr(outData, dch);
-        rgb_to_bgr_nhwc<int32_t><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx);
-        checkKernelErrors();
+        launchCvtColor(RgbToBgrOp<int32_t>{src_ptr, dst_ptr, bidx}, inData, stream);
     }
     break;
     case kCV_32F:
     {
         cuda::ImageBatchVarShapeWrapNHWC<float> src_ptr(inData, sch);
         cuda::ImageBatchVarShapeWrapNHWC<float> dst_ptr(outData, dch);
-        rgb_to_bgr_nhwc<float><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx);
-        checkKernelErrors();
+        launchCvtColor(RgbToBgrOp<float>{src_ptr, dst_ptr, bidx}, inData, stream);
     }
     break;
     case kCV_64F:
     {
         cuda::ImageBatchVarShapeWrapNHWC<double> src_ptr(inData, sch);
         cuda::ImageBatchVarShapeWrapNHWC<double> dst_ptr(outData, dch);
-        rgb_to_bgr_nhwc<double><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx);
-        checkKernelErrors();
+        launchCvtColor(RgbToBgrOp<double>{src_ptr, dst_ptr, bidx}, inData, stream);
     }
     break;
     }
@@ -859,13 +1064,6 @@ inline ErrorCode GRAY_to_BGR(const IImageBatchVarShapeDataStridedCuda &inData,
         return ErrorCode::INVALID_DATA_SHAPE;
     }
 
-    int max_width  = inData.maxSize().w;
-    int max_height = inData.maxSize().h;
-    int batch_size = inData.numImages();
-
-    dim3 blockSize(BLOCK, BLOCK / 4, 1);
-    dim3 gridSize(divUp(max_width, blockSize.x), divUp(max_height, blockSize.y), batch_size);
-
     switch (data_type)
     {
     case kCV_8U:
@@ -873,8 +1071,7 @@ inline ErrorCode GRAY_to_BGR(const IImageBatchVarShapeDataStridedCuda &inData,
     {
         cuda::ImageBatchVarShapeWrapNHWC<unsigned char> src_ptr(inData, channels);
         cuda::ImageBatchVarShapeWrapNHWC<unsigned char> dst_ptr(outData, dch);
-        gray_to_bgr_nhwc<unsigned char><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr);
-        checkKernelErrors();
+        launchCvtColor(GrayToBgrOp<unsigned char>{src_ptr, dst_ptr}, inData, stream);
     }
     break;
     case kCV_16U:
@@ -883,32 +1080,28 @@ inline ErrorCode GRAY_to_BGR(const IImageBatchVarShapeDataStridedCuda &inData,
     {
         cuda::ImageBatchVarShapeWrapNHWC<uint16_t> src_ptr(inData, channels);
         cuda::ImageBatchVarShapeWrapNHWC<uint16_t> dst_ptr(outData, dch);
-        gray_to_bgr_nhwc<uint16_t><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr);
-        checkKernelErrors();
+        launchCvtColor(GrayToBgrOp<uint16_t>{src_ptr, dst_ptr}, inData, stream);
     }
     break;
     case kCV_32S:
     {
         cuda::ImageBatchVarShapeWrapNHWC<int32_t> src_ptr(inData, channels);
         cuda::ImageBatchVarShapeWrapNHWC<int32_t> dst_ptr(outData, dch);
-        gray_to_bgr_nhwc<int32_t><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr);
-        checkKernelErrors();
+        launchCvtColor(GrayToBgrOp<int32_t>{src_ptr, dst_ptr}, inData, stream);
     }
     break;
     case kCV_32F:
     {
         cuda::ImageBatchVarShapeWrapNHWC<float> src_ptr(inData, channels);
         cuda::ImageBatchVarShapeWrapNHWC<float> dst_ptr(outData, dch);
-        gray_to_bgr_nhwc<float><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr);
-        checkKernelErrors();
+        launchCvtColor(GrayToBgrOp<float>{src_ptr, dst_ptr}, inData, stream);
     }
     break;
     case kCV_64F:
     {
         cuda::ImageBatchVarShapeWrapNHWC<double> src_ptr(inData, channels);
         cuda::ImageBatchVarShapeWrapNHWC<double> dst_ptr(outData, dch);
-        gray_to_bgr_nhwc<double><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr);
-        checkKernelErrors();
+        launchCvtColor(GrayToBgrOp<double>{src_ptr, dst_ptr}, inData, stream);
     }
     break;
     }
@@ -951,37 +1144,27 @@ inline ErrorCode BGR_to_GRAY(const IImageBatchVarShapeDataStridedCuda &inData,
         return ErrorCode::INVALID_DATA_SHAPE;
     }
 
-    int max_width  = inData.maxSize().w;
-    int max_height = inData.maxSize().h;
-    int batch_size = inData.numImages();
-
-    dim3 blockSize(BLOCK, BLOCK / 4, 1);
-    dim3 gridSize(divUp(max_width, blockSize.x), divUp(max_height, blockSize.y), batch_size);
-
     switch (data_type)
     {
     case kCV_8U:
     {
         cuda::ImageBatchVarShapeWrapNHWC<unsigned char> src_ptr(inData, channels);
         cuda::ImageBatchVarShapeWrapNHWC<unsigned char> dst_ptr(outData, dcn);
-        bgr_to_gray_char_nhwc<unsigned char><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx);
-        checkKernelErrors();
+        launchCvtColor(BgrToGrayOp<unsigned char>{src_ptr, dst_ptr, bidx}, inData, stream);
     }
     break;
     case kCV_16U:
     {
         cuda::ImageBatchVarShapeWrapNHWC<unsigned short> src_ptr(inData, channels);
         cuda::ImageBatchVarShapeWrapNHWC<unsigned short> dst_ptr(outData, dcn);
-        bgr_to_gray_char_nhwc<unsigned short><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx);
-        checkKernelErrors();
+        launchCvtColor(BgrToGrayOp<unsigned short>{src_ptr, dst_ptr, bidx}, inData, stream);
     }
     break;
     case kCV_32F:
     {
         cuda::ImageBatchVarShapeWrapNHWC<float> src_ptr(inData, channels);
         cuda::ImageBatchVarShapeWrapNHWC<float> dst_ptr(outData, dcn);
-        bgr_to_gray_char_nhwc<float><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx);
-        checkKernelErrors();
+        launchCvtColor(BgrToGrayOp<float>{src_ptr, dst_ptr, bidx}, inData, stream);
     }
     break;
     default:
@@ -1190,7 +1373,9 @@ inline ErrorCode BGR_to_HSV(const IImageBatchVarShapeDataStridedCuda &inData,
     {
         cuda::ImageBatchVarShapeWrapNHWC<unsigned char> src_ptr(inData, channels);
         cuda::ImageBatchVarShapeWrapNHWC<unsigned char> dst_ptr(outData, dcn);
-        bgr_to_hsv_char_nhwc<unsigned char><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx, isFullRange);
+        int hrange = isFullRange ? 256 : 180;
+        bgr_to_hsv_char_nhwc<unsigned char>
+            <<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx, hrange, GetHsvDivTables8u(isFullRange));
         checkKernelErrors();
     }
     break;
@@ -1198,7 +1383,12 @@ inline ErrorCode BGR_to_HSV(const IImageBatchVarShapeDataStridedCuda &inData,
     {
         cuda::ImageBatchVarShapeWrapNHWC<float> src_ptr(inData, channels);
         cuda::ImageBatchVarShapeWrapNHWC<float> dst_ptr(outData, dcn);
-        bgr_to_hsv_float_nhwc<float><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx);
+        DispatchPrecision(
+            [&](auto fast)
+            {
+                bgr_to_hsv_float_nhwc<decltype(fast)::value, float>
+                    <<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx);
+            });
         checkKernelErrors();
     }
     break;
@@ -1258,7 +1448,166 @@ inline ErrorCode HSV_to_BGR(const IImageBatchVarShapeDataStridedCuda &inData,
     {
         cuda::ImageBatchVarShapeWrapNHWC<unsigned char> src_ptr(inData, channels);
         cuda::ImageBatchVarShapeWrapNHWC<unsigned char> dst_ptr(outData, dcn);
-        hsv_to_bgr_char_nhwc<unsigned char><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx, isFullRange);
+        DispatchPrecision(
+            [&](auto fast)
+            {
+                hsv_to_bgr_char_nhwc<decltype(fast)::value, unsigned char>
+                    <<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx, isFullRange);
+            });
+        checkKernelErrors();
+    }
+    break;
+    case kCV_32F:
+    {
+        cuda::ImageBatchVarShapeWrapNHWC<float> src_ptr(inData, channels);
+        cuda::ImageBatchVarShapeWrapNHWC<float> dst_ptr(outData, dcn);
+        DispatchPrecision(
+            [&](auto fast)
+            {
+                hsv_to_bgr_float_nhwc<decltype(fast)::value, float>
+                    <<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx);
+            });
+        checkKernelErrors();
+    }
+    break;
+    default:
+        LOG_ERROR("Unsupported DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+inline ErrorCode BGR_to_Lab(const IImageBatchVarShapeDataStridedCuda &inData,
+                            const IImageBatchVarShapeDataStridedCuda &outData, NVCVColorConversionCode code,
+                            cudaStream_t stream)
+{
+    int bidx = (code == NVCV_COLOR_BGR2Lab || code == NVCV_COLOR_BGR2Luv || code == NVCV_COLOR_LBGR2Lab
+                || code == NVCV_COLOR_LBGR2Luv)
+                 ? 0
+                 : 2;
+    bool isLuv  = (code == NVCV_COLOR_BGR2Luv || code == NVCV_COLOR_RGB2Luv || code == NVCV_COLOR_LBGR2Luv
+                  || code == NVCV_COLOR_LRGB2Luv);
+    bool isSrgb = (code == NVCV_COLOR_BGR2Lab || code == NVCV_COLOR_RGB2Lab || code == NVCV_COLOR_BGR2Luv
+                   || code == NVCV_COLOR_RGB2Luv);
+
+    if (!inData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input batch must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    int      channels  = inData.uniqueFormat().numChannels();
+    DataType data_type = helpers::GetLegacyDataType(inData.uniqueFormat());
+
+    if (channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid input channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (!outData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the output batch must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    int dcn = outData.uniqueFormat().numChannels();
+
+    if (dcn != 3)
+    {
+        LOG_ERROR("Invalid output channel number " << dcn);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    int max_width  = inData.maxSize().w;
+    int max_height = inData.maxSize().h;
+    int batch_size = inData.numImages();
+
+    dim3 blockSize(BLOCK, BLOCK / 4, 1);
+    dim3 gridSize(divUp(max_width, blockSize.x), divUp(max_height, blockSize.y), batch_size);
+
+    switch (data_type)
+    {
+    case kCV_8U:
+    {
+        cuda::ImageBatchVarShapeWrapNHWC<unsigned char> src_ptr(inData, channels);
+        cuda::ImageBatchVarShapeWrapNHWC<unsigned char> dst_ptr(outData, dcn);
+        bgr_to_lab_char_nhwc<unsigned char>
+            <<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx, isLuv, GetGammaLut8u(isSrgb));
+        checkKernelErrors();
+    }
+    break;
+    case kCV_32F:
+    {
+        cuda::ImageBatchVarShapeWrapNHWC<float> src_ptr(inData, channels);
+        cuda::ImageBatchVarShapeWrapNHWC<float> dst_ptr(outData, dcn);
+        bgr_to_lab_float_nhwc<float><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx, isLuv, isSrgb);
+        checkKernelErrors();
+    }
+    break;
+    default:
+        LOG_ERROR("Unsupported DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+inline ErrorCode Lab_to_BGR(const IImageBatchVarShapeDataStridedCuda &inData,
+                            const IImageBatchVarShapeDataStridedCuda &outData, NVCVColorConversionCode code,
+                            cudaStream_t stream)
+{
+    int bidx = (code == NVCV_COLOR_Lab2BGR || code == NVCV_COLOR_Luv2BGR || code == NVCV_COLOR_Lab2LBGR
+                || code == NVCV_COLOR_Luv2LBGR)
+                 ? 0
+                 : 2;
+    bool isLuv  = (code == NVCV_COLOR_Luv2BGR || code == NVCV_COLOR_Luv2RGB || code == NVCV_COLOR_Luv2LBGR
+                  || code == NVCV_COLOR_Luv2LRGB);
+    bool isSrgb = (code == NVCV_COLOR_Lab2BGR || code == NVCV_COLOR_Lab2RGB || code == NVCV_COLOR_Luv2BGR
+                   || code == NVCV_COLOR_Luv2RGB);
+
+    if (!inData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input batch must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    int      channels  = inData.uniqueFormat().numChannels();
+    DataType data_type = helpers::GetLegacyDataType(inData.uniqueFormat());
+
+    if (channels != 3)
+    {
+        LOG_ERROR("Invalid input channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (!outData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the output batch must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    int dcn = outData.uniqueFormat().numChannels();
+
+    if (dcn != 3 && dcn != 4)
+    {
+        LOG_ERROR("Invalid output channel number " << dcn);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    int max_width  = inData.maxSize().w;
+    int max_height = inData.maxSize().h;
+    int batch_size = inData.numImages();
+
+    dim3 blockSize(BLOCK, BLOCK / 4, 1);
+    dim3 gridSize(divUp(max_width, blockSize.x), divUp(max_height, blockSize.y), batch_size);
+
+    switch (data_type)
+    {
+    case kCV_8U:
+    {
+        cuda::ImageBatchVarShapeWrapNHWC<unsigned char> src_ptr(inData, channels);
+        cuda::ImageBatchVarShapeWrapNHWC<unsigned char> dst_ptr(outData, dcn);
+        lab_to_bgr_nhwc<unsigned char><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx, isLuv, isSrgb);
         checkKernelErrors();
     }
     break;
@@ -1266,7 +1615,7 @@ inline ErrorCode HSV_to_BGR(const IImageBatchVarShapeDataStridedCuda &inData,
     {
         cuda::ImageBatchVarShapeWrapNHWC<float> src_ptr(inData, channels);
         cuda::ImageBatchVarShapeWrapNHWC<float> dst_ptr(outData, dcn);
-        hsv_to_bgr_float_nhwc<float><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx);
+        lab_to_bgr_nhwc<float><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, bidx, isLuv, isSrgb);
         checkKernelErrors();
     }
     break;
@@ -1680,16 +2029,16 @@ ErrorCode CvtColorVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inDa
         0, //                =42
         0, //                =43
 
-        0, //BGR_to_Lab,             // CV_BGR2Lab     =44
-        0, //RGB_to_Lab,             // CV_RGB2Lab     =45
+        BGR_to_Lab, // CV_BGR2Lab     =44
+        BGR_to_Lab, // CV_RGB2Lab     =45
 
         0, //bayerBG_to_BGR,         // CV_BayerBG2BGR =46
         0, //bayeRGB_to_BGR,         // CV_BayeRGB2BGR =47
         0, //bayerRG_to_BGR,         // CV_BayerRG2BGR =48
         0, //bayerGR_to_BGR,         // CV_BayerGR2BGR =49
 
-        0, //BGR_to_Luv,             // CV_BGR2Luv     =50
-        0, //RGB_to_Luv,             // CV_RGB2Luv     =51
+        BGR_to_Lab, // CV_BGR2Luv     =50
+        BGR_to_Lab, // CV_RGB2Luv     =51
 
         0, //BGR_to_HLS,             // CV_BGR2HLS     =52
         0, //RGB_to_HLS,             // CV_RGB2HLS     =53
@@ -1697,10 +2046,10 @@ ErrorCode CvtColorVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inDa
         HSV_to_BGR, // CV_HSV2BGR     =54
         HSV_to_BGR, // CV_HSV2RGB     =55
 
-        0, //Lab_to_BGR,             // CV_Lab2BGR     =56
-        0, //Lab_to_RGB,             // CV_Lab2RGB     =57
-        0, //Luv_to_BGR,             // CV_Luv2BGR     =58
-        0, //Luv_to_RGB,             // CV_Luv2RGB     =59
+        Lab_to_BGR, // CV_Lab2BGR     =56
+        Lab_to_BGR, // CV_Lab2RGB     =57
+        Lab_to_BGR, // CV_Luv2BGR     =58
+        Lab_to_BGR, // CV_Luv2RGB     =59
 
         0, //HLS_to_BGR,             // CV_HLS2BGR     =60
         0, //HLS_to_RGB,             // CV_HLS2RGB     =61
@@ -1720,15 +2069,15 @@ ErrorCode CvtColorVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inDa
         0,          //HLS_to_BGR_FULL,        // CV_HLS2BGR_FULL = 72
         0,          //HLS_to_RGB_FULL,        // CV_HLS2RGB_FULL = 73
 
-        0, //LBGR_to_Lab,            // CV_LBGR2Lab     = 74
-        0, //LRGB_to_Lab,            // CV_LRGB2Lab     = 75
-        0, //LBGR_to_Luv,            // CV_LBGR2Luv     = 76
-        0, //LRGB_to_Luv,            // CV_LRGB2Luv     = 77
+        BGR_to_Lab, // CV_LBGR2Lab     = 74
+        BGR_to_Lab, // CV_LRGB2Lab     = 75
+        BGR_to_Lab, // CV_LBGR2Luv     = 76
+        BGR_to_Lab, // CV_LRGB2Luv     = 77
 
-        0, //Lab_to_LBGR,            // CV_Lab2LBGR     = 78
-        0, //Lab_to_LRGB,            // CV_Lab2LRGB     = 79
-        0, //Luv_to_LBGR,            // CV_Luv2LBGR     = 80
-        0, //Luv_to_LRGB,            // CV_Luv2LRGB     = 81
+        Lab_to_BGR, // CV_Lab2LBGR     = 78
+        Lab_to_BGR, // CV_Lab2LRGB     = 79
+        Lab_to_BGR, // CV_Luv2LBGR     = 80
+        Lab_to_BGR, // CV_Luv2LRGB     = 81
 
         BGR_to_YUV, // CV_BGR2YUV      = 82
         BGR_to_YUV, // CV_RGB2YUV      = 83
@@ -1831,11 +2180,64 @@ ErrorCode CvtColorVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inDa
         0, // CV_COLORCVT_MAX  = 148
     };
 
-    func_t func = funcs[code];
+    if (code < 0 || code >= int(sizeof(funcs) / sizeof(funcs[0])) || funcs[code] == 0)
+    {
+        LOG_ERROR("Invalid convert color code: " << code);
+        return ErrorCode::INVALID_PARAMETER;
+    }
 
-    NVCV_ASSERT(func != 0);
+    func_t func = funcs[code];
 
     return func(inData, outData, code, stream);
 }
 
+ErrorCode CvtColorVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                  const IImageBatchVarShapeDataStridedCuda &outData, cudaStream_t stream)
+{
+    if (inData.numImages() != outData.numImages())
+    {
+        LOG_ERROR("Input and Output data must have the same number of images (" << inData.numImages()
+                                                                                << " != " << outData.numImages());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const NVCVImageFormat *formats = inData.hostFormatList();
+    for (int i = 0; i < inData.numImages(); ++i)
+    {
+        if (GetMixedFormat(formats[i]).kind == MixedFormat::INVALID)
+        {
+            LOG_ERROR("Unsupported input image format " << ImageFormat{formats[i]} << " of image " << i);
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+    }
+
+    if (!outData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the output batch must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    MixedFormat dstFormat = GetMixedFormat(outData.uniqueFormat());
+    if (dstFormat.kind != MixedFormat::GRAY && dstFormat.kind != MixedFormat::COLOR)
+    {
+        LOG_ERROR("Unsupported output image format " << outData.uniqueFormat());
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    int max_width  = outData.maxSize().w;
+    int max_height = outData.maxSize().h;
+    int batch_size = outData.numImages();
+
+    dim3 blockSize(BLOCK, BLOCK / 4, 1);
+    dim3 gridSize(divUp(max_width, blockSize.x), divUp(max_height, blockSize.y), batch_size);
+
+    cuda::ImageBatchVarShapeWrap<const uchar> src_ptr(inData);
+    cuda::ImageBatchVarShapeWrapNHWC<uchar>   dst_ptr(outData, dstFormat.channels);
+
+    mixed_to_common_char_nhwc<<<gridSize, blockSize, 0, stream>>>(src_ptr, inData.formatList(), dst_ptr, dstFormat);
+    checkKernelErrors();
+
+    return ErrorCode::SUCCESS;
+}
+
 } // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,357 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+#include <type_traits>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Each thread interpolates the missing colors of one pixel and applies the white balance gains, the color
+// correction matrix and the gamma to its RGB before writing it, so the raw image is read once. Samples are
+// normalized to [0,1] when loaded. Borders are mirrored without repeating the border samples, which keeps the
+// colors of the mirrored samples.
+
+// Color processing of the interpolated RGB, the gains being scaled by the normalization of the samples.
+struct ColorParams
+{
+    float gains[3];
+    float ccm[9];
+    float invGamma;
+};
+
+__device__ inline int Reflect101(int i, int n)
+{
+    i = i < 0 ? -i : i;
+    return i >= n ? 2 * n - 2 - i : i;
+}
+
+// Normalized samples of a sample of the batch, with mirrored borders.
+template<typename T>
+struct Bayer
+{
+    nvcv::cuda::Tensor3DWrap<const T> in;
+
+    int   z;
+    int2  size;
+    float scale;
+
+    __device__ float operator()(int x, int y) const
+    {
+        return *in.ptr(z, Reflect101(y, size.y), Reflect101(x, size.x)) * scale;
+    }
+};
+
+// Green at a red or blue site, interpolated along the direction with the smallest gradient and corrected by the
+// laplacian of the site color, as in Hamilton-Adams.
+template<typename T>
+__device__ float GreenAt(const Bayer<T> &s, int x, int y)
+{
+    const float c  = s(x, y);
+    const float ch = 2 * c - s(x - 2, y) - s(x + 2, y);
+    const float cv = 2 * c - s(x, y - 2) - s(x, y + 2);
+    const float gl = s(x - 1, y), gr = s(x + 1, y);
+    const float gu = s(x, y - 1), gd = s(x, y + 1);
+
+    const float dh = fabsf(gl - gr) + fabsf(ch);
+    const float dv = fabsf(gu - gd) + fabsf(cv);
+
+    const float gh = (gl + gr) / 2 + ch / 4;
+    const float gv = (gu + gd) / 2 + cv / 4;
+
+    const float g = dh < dv ? gh : (dv < dh ? gv : (gh + gv) / 2);
+    return fminf(fmaxf(g, 0.f), 1.f);
+}
+
+template<typename T>
+__device__ float DiffToGreen(const Bayer<T> &s, int x, int y)
+{
+    return s(x, y) - GreenAt(s, x, y);
+}
+
+template<bool EdgeAware, typename T, class DstWrapper>
+__global__ void demosaic(nvcv::cuda::Tensor3DWrap<const T> in, DstWrapper dst, int2 size, float scale, int2 redPos,
+                         int dcn, ColorParams params)
+{
+    using DT = typename DstWrapper::ValueType;
+
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int z = blockIdx.z;
+
+    if (x >= size.x || y >= size.y)
+        return;
+
+    const Bayer<T> s{in, z, size, scale};
+
+    const bool redRow = (y & 1) == redPos.y;
+    const bool redCol = (x & 1) == redPos.x;
+
+    float rgb[3];
+
+    if (redRow != redCol)
+    {
+        // Green site, the horizontal neighbors are red on red rows and blue otherwise
+        const float g = s(x, y);
+        float       h, v;
+        if constexpr (EdgeAware)
+        {
+            h = g + (DiffToGreen(s, x - 1, y) + DiffToGreen(s, x + 1, y)) / 2;
+            v = g + (DiffToGreen(s, x, y - 1) + DiffToGreen(s, x, y + 1)) / 2;
+        }
+        else
+        {
+            h = (s(x - 1, y) + s(x + 1, y)) / 2;
+            v = (s(x, y - 1) + s(x, y + 1)) / 2;
+        }
+        rgb[0] = redRow ? h : v;
+        rgb[1] = g;
+        rgb[2] = redRow ? v : h;
+    }
+    else
+    {
+        // Red or blue site, the diagonal neighbors have the other color
+        const float c = s(x, y);
+        float       g, o;
+        if constexpr (EdgeAware)
+        {
+            g = GreenAt(s, x, y);
+            o = g
+              + (DiffToGreen(s, x - 1, y - 1) + DiffToGreen(s, x + 1, y - 1) + DiffToGreen(s, x - 1, y + 1)
+                 + DiffToGreen(s, x + 1, y + 1))
+                    / 4;
+        }
+        else
+        {
+            g = (s(x - 1, y) + s(x + 1, y) + s(x, y - 1) + s(x, y + 1)) / 4;
+            o = (s(x - 1, y - 1) + s(x + 1, y - 1) + s(x - 1, y + 1) + s(x + 1, y + 1)) / 4;
+        }
+        rgb[0] = redRow ? c : o;
+        rgb[1] = g;
+        rgb[2] = redRow ? o : c;
+    }
+
+#pragma unroll
+    for (int c = 0; c < 3; ++c)
+    {
+        rgb[c] *= params.gains[c];
+    }
+
+    constexpr float outScale = std::is_floating_point_v<DT> ? 1.f : nvcv::cuda::TypeTraits<DT>::max;
+
+#pragma unroll
+    for (int c = 0; c < 3; ++c)
+    {
+        float v = params.ccm[c * 3] * rgb[0] + params.ccm[c * 3 + 1] * rgb[1] + params.ccm[c * 3 + 2] * rgb[2];
+        v       = fminf(fmaxf(v, 0.f), 1.f);
+        if (params.invGamma != 1.f)
+        {
+            v = powf(v, params.invGamma);
+        }
+        *dst.ptr(z, y, x, c) = nvcv::cuda::SaturateCast<DT>(v * outScale);
+    }
+    if (dcn == 4)
+    {
+        *dst.ptr(z, y, x, 3) = nvcv::cuda::SaturateCast<DT>(outScale);
+    }
+}
+
+template<typename T, typename DT>
+void Demosaic(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, int numSamples,
+              int2 size, int2 redPos, int dcn, bool edgeAware, const ColorParams &params, cudaStream_t stream)
+{
+    auto in  = nvcv::cuda::CreateTensorWrapNHW<const T>(inData);
+    auto out = nvcv::cuda::CreateTensorWrapNHWC<DT>(outData);
+
+    const float scale = 1.f / nvcv::cuda::TypeTraits<T>::max;
+
+    dim3 block(32, 8);
+    dim3 grid(divUp(size.x, block.x), divUp(size.y, block.y), numSamples);
+
+    if (edgeAware)
+    {
+        demosaic<true><<<grid, block, 0, stream>>>(in, out, size, scale, redPos, dcn, params);
+    }
+    else
+    {
+        demosaic<false><<<grid, block, 0, stream>>>(in, out, size, scale, redPos, dcn, params);
+    }
+    checkKernelErrors();
+}
+
+template<typename T>
+void DemosaicTo(DataType out_type, const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                int numSamples, int2 size, int2 redPos, int dcn, bool edgeAware, const ColorParams &params,
+                cudaStream_t stream)
+{
+    switch (out_type)
+    {
+    case kCV_8U:
+        Demosaic<T, uchar>(inData, outData, numSamples, size, redPos, dcn, edgeAware, params, stream);
+        break;
+    case kCV_16U:
+        Demosaic<T, ushort>(inData, outData, numSamples, size, redPos, dcn, edgeAware, params, stream);
+        break;
+    default:
+        Demosaic<T, float>(inData, outData, numSamples, size, redPos, dcn, edgeAware, params, stream);
+        break;
+    }
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t Demosaic::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode Demosaic::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                          NVCVRawPattern pattern, NVCVDemosaicType type, const NVCVDemosaicParams &params,
+                          cudaStream_t stream)
+{
+    // Position of the red sample in the 2x2 pattern
+    int2 redPos;
+    switch (pattern)
+    {
+    case NVCV_RAW_BAYER_RGGB:
+        redPos = {0, 0};
+        break;
+    case NVCV_RAW_BAYER_GRBG:
+        redPos = {1, 0};
+        break;
+    case NVCV_RAW_BAYER_GBRG:
+        redPos = {0, 1};
+        break;
+    case NVCV_RAW_BAYER_BGGR:
+        redPos = {1, 1};
+        break;
+    default:
+        LOG_ERROR("Invalid raw pattern " << pattern << ", it must be one of the RGGB Bayer patterns");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (type != NVCV_DEMOSAIC_BILINEAR && type != NVCV_DEMOSAIC_EDGE_AWARE)
+    {
+        LOG_ERROR("Invalid demosaic type " << type);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    if (!(params.gamma > 0))
+    {
+        LOG_ERROR("Invalid gamma " << params.gamma << ", it must be positive");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    DataFormat input_format  = GetLegacyDataFormat(inData.layout());
+    DataFormat output_format = GetLegacyDataFormat(outData.layout());
+    if (input_format != output_format)
+    {
+        LOG_ERROR("Invalid DataFormat between input (" << input_format << ") and output (" << output_format << ")");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+    if (!(input_format == kNHWC || input_format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << input_format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataType in_type  = GetLegacyDataType(inData.dtype());
+    DataType out_type = GetLegacyDataType(outData.dtype());
+    if (!(in_type == kCV_8U || in_type == kCV_16U))
+    {
+        LOG_ERROR("Invalid input DataType " << in_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    if (!(out_type == kCV_8U || out_type == kCV_16U || out_type == kCV_32F))
+    {
+        LOG_ERROR("Invalid output DataType " << out_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    const int  numSamples = inAccess->numSamples();
+    const int2 size{inAccess->numCols(), inAccess->numRows()};
+    const int  dcn = outAccess->numChannels();
+
+    if (inAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid input channel number " << inAccess->numChannels() << ", it must be 1");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (dcn != 3 && dcn != 4)
+    {
+        LOG_ERROR("Invalid output channel number " << dcn << ", it must be 3 or 4");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (outAccess->numSamples() != numSamples || outAccess->numCols() != size.x || outAccess->numRows() != size.y)
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must match the input " << inData.shape());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (numSamples > 0 && (size.x < 3 || size.y < 3))
+    {
+        LOG_ERROR("Invalid input shape " << inData.shape() << ", images must be at least 3x3");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (numSamples == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    ColorParams colorParams;
+    for (int c = 0; c < 3; ++c)
+    {
+        colorParams.gains[c] = params.wbGains[c];
+    }
+    for (int i = 0; i < 9; ++i)
+    {
+        colorParams.ccm[i] = params.ccm[i];
+    }
+    colorParams.invGamma = 1.f / params.gamma;
+
+    const bool edgeAware = type == NVCV_DEMOSAIC_EDGE_AWARE;
+
+    if (in_type == kCV_8U)
+    {
+        DemosaicTo<uchar>(out_type, inData, outData, numSamples, size, redPos, dcn, edgeAware, colorParams, stream);
+    }
+    else
+    {
+        DemosaicTo<ushort>(out_type, inData, outData, numSamples, size, redPos, dcn, edgeAware, colorParams, stream);
+    }
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -22,7 +22,8 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
-#include "cub/cub.cuh"
+
+#include <algorithm>
 
 using namespace nvcv::legacy::helpers;
 
@@ -36,36 +37,53 @@ static __device__ int erase_hash(unsigned int x)
     return x;
 }
 
+// Blocks per launch are limited so that many small erasing areas don't
+// end up launching too many idle blocks.
+static constexpr int kEraseBlockSize = 256;
+static constexpr int kEraseMaxBlocks = 4096;
+
 template<class Wrapper, typename T = typename Wrapper::ValueType>
 __global__ void erase(Wrapper img, int imgH, int imgW, nvcv::cuda::Tensor1DWrap<int2> anchorVec,
                       nvcv::cuda::Tensor1DWrap<int3> erasingVec, nvcv::cuda::Tensor1DWrap<float> valuesVec,
                       nvcv::cuda::Tensor1DWrap<int> imgIdxVec, int channels, int random, unsigned int seed)
 {
-    unsigned int id      = threadIdx.x + blockIdx.x * blockDim.x;
-    int          c       = blockIdx.y;
-    int          eraseId = blockIdx.z;
-    int2         anchor  = anchorVec[eraseId];
-    int3         erasing = erasingVec[eraseId];
-    float        value   = valuesVec[eraseId * channels + c];
-    int          batchId = imgIdxVec[eraseId];
-    if (id < erasing.y * erasing.x && (0x1 & (erasing.z >> c)) == 1)
+    int  c       = blockIdx.y;
+    int  eraseId = blockIdx.z;
+    int3 erasing = erasingVec[eraseId];
+
+    if ((0x1 & (erasing.z >> c)) == 0)
     {
-        int x = id % erasing.x;
-        int y = id / erasing.x;
-        if (anchor.x + x < imgW && anchor.y + y < imgH)
+        return;
+    }
+
+    int2  anchor  = anchorVec[eraseId];
+    float value   = valuesVec[eraseId * channels + c];
+    int   batchId = imgIdxVec[eraseId];
+
+    // Only the part of the erasing area inside the image is processed.
+    int width  = min(erasing.x, imgW - anchor.x);
+    int height = min(erasing.y, imgH - anchor.y);
+    if (width <= 0 || height <= 0)
+    {
+        return;
+    }
+
+    // The grid isn't sized from the erasing area as it's only known on device,
+    // therefore we loop until the whole area is covered.
+    int area = width * height;
+    for (int id = threadIdx.x + blockIdx.x * blockDim.x; id < area; id += blockDim.x * gridDim.x)
+    {
+        int x = id % width;
+        int y = id / width;
+        if (random)
+        {
+            unsigned int hashValue = seed + id + 0x26AD0C9 * (eraseId * channels + c + 1);
+            *img.ptr(batchId, anchor.y + y, anchor.x + x, c)
+                = nvcv::cuda::SaturateCast<T>(erase_hash(hashValue) % 256);
+        }
+        else
         {
-            if (random)
-            {
-                unsigned int hashValue = seed + threadIdx.x
-                                       + 0x26AD0C9 * blockDim.x * blockDim.y * blockDim.z * (blockIdx.x + 1)
-                                             * (blockIdx.y + 1) * (blockIdx.z + 1);
-                *img.ptr(batchId, anchor.y + y, anchor.x + x, c)
-                    = nvcv::cuda::SaturateCast<T>(erase_hash(hashValue) % 256);
-            }
-            else
-            {
-                *img.ptr(batchId, anchor.y + y, anchor.x + x, c) = nvcv::cuda::SaturateCast<T>(value);
-            }
+            *img.ptr(batchId, anchor.y + y, anchor.x + x, c) = nvcv::cuda::SaturateCast<T>(value);
         }
     }
 }
@@ -73,7 +91,7 @@ __global__ void erase(Wrapper img, int imgH, int imgW, nvcv::cuda::Tensor1DWrap<
 template<typename T>
 void eraseCaller(const nvcv::ITensorDataStridedCuda &imgs, const nvcv::ITensorDataStridedCuda &anchor,
                  const nvcv::ITensorDataStridedCuda &erasing, const nvcv::ITensorDataStridedCuda &imgIdx,
-                 const nvcv::ITensorDataStridedCuda &values, int max_eh, int max_ew, int num_erasing_area, bool random,
+                 const nvcv::ITensorDataStridedCuda &values, int num_erasing_area, bool random,
                  unsigned int seed, int rows, int cols, int channels, cudaStream_t stream)
 {
     auto wrap = nvcv::cuda::CreateTensorWrapNHWC<T>(imgs);
@@ -83,69 +101,26 @@ void eraseCaller(const nvcv::ITensorDataStridedCuda &imgs, const nvcv::ITensorDa
     nvcv::cuda::Tensor1DWrap<int>   imgIdxVec(imgIdx);
     nvcv::cuda::Tensor1DWrap<float> valuesVec(values);
 
-    int  blockSize = (max_eh * max_ew < 1024) ? max_eh * max_ew : 1024;
-    int  gridSize  = divUp(max_eh * max_ew, 1024);
-    dim3 block(blockSize);
+    // Erasing areas are clipped to the image, so they can't be larger than it.
+    int  gridSize = std::min(divUp(rows * cols, kEraseBlockSize),
+                             std::max(1, kEraseMaxBlocks / (channels * num_erasing_area)));
+    dim3 block(kEraseBlockSize);
     dim3 grid(gridSize, channels, num_erasing_area);
     erase<<<grid, block, 0, stream>>>(wrap, rows, cols, anchorVec, erasingVec, valuesVec, imgIdxVec, channels, random,
                                       seed);
 }
 
-struct MaxWH
-{
-    __device__ __forceinline__ int3 operator()(const int3 &a, const int3 &b) const
-    {
-        return int3{max(a.x, b.x), max(a.y, b.y), 0};
-    }
-};
-
 namespace nvcv::legacy::cuda_op {
 
 Erase::Erase(DataShape max_input_shape, DataShape max_output_shape, int num_erasing_area)
     : CudaBaseOp(max_input_shape, max_output_shape)
-    , d_max_values(nullptr)
-    , temp_storage(nullptr)
 {
-    cudaError_t err = cudaMalloc(&d_max_values, sizeof(int3));
-    if (err != cudaSuccess)
-    {
-        LOG_ERROR("CUDA memory allocation error of size: " << sizeof(int3));
-        throw std::runtime_error("CUDA memory allocation error!");
-    }
-
     max_num_erasing_area = num_erasing_area;
     if (max_num_erasing_area < 0)
     {
-        cudaFree(d_max_values);
         LOG_ERROR("Invalid num of erasing area" << max_num_erasing_area);
         throw std::runtime_error("Parameter error!");
     }
-    temp_storage  = NULL;
-    storage_bytes = 0;
-    MaxWH mwh;
-    int3  init = {0, 0, 0};
-    cub::DeviceReduce::Reduce(temp_storage, storage_bytes, (int3 *)nullptr, (int3 *)nullptr, max_num_erasing_area, mwh,
-                              init);
-
-    err = cudaMalloc(&temp_storage, storage_bytes);
-    if (err != cudaSuccess)
-    {
-        cudaFree(d_max_values);
-        LOG_ERROR("CUDA memory allocation error of size: " << storage_bytes);
-        throw std::runtime_error("CUDA memory allocation error!");
-    }
-}
-
-Erase::~Erase()
-{
-    cudaError_t err0 = cudaFree(d_max_values);
-    cudaError_t err1 = cudaFree(temp_storage);
-    if (err0 != cudaSuccess || err1 != cudaSuccess)
-    {
-        LOG_ERROR("CUDA memory free error, possible memory leak!");
-    }
-    d_max_values = nullptr;
-    temp_storage = nullptr;
 }
 
 ErrorCode Erase::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
@@ -257,38 +232,21 @@ ErrorCode Erase::infer(const ITensorDataStridedCuda &inData, const ITensorDataSt
         return SUCCESS;
     }
 
-    int3 *d_erasing = (int3 *)erasing.basePtr();
-    int3  h_max_values;
-    MaxWH maxwh;
-    int3  init = {0, 0, 0};
-
-    cub::DeviceReduce::Reduce(temp_storage, storage_bytes, d_erasing, d_max_values, num_erasing_area, maxwh, init,
-                              stream);
-    checkCudaErrors(cudaMemcpyAsync(&h_max_values, d_max_values, sizeof(int3), cudaMemcpyDeviceToHost, stream));
-
-    checkCudaErrors(cudaStreamSynchronize(stream));
-
-    int max_ew = h_max_values.x, max_eh = h_max_values.y;
-
-    // All areas as empty? Weird, but valid nonetheless.
-    if (max_ew == 0 || max_eh == 0)
-    {
-        return SUCCESS;
-    }
-
+    // Max erasing area size is only known on device, sizing the grid with it
+    // would require a stream synchronization.
     typedef void (*erase_t)(const ITensorDataStridedCuda &imgs, const ITensorDataStridedCuda &anchor,
                             const ITensorDataStridedCuda &erasing, const ITensorDataStridedCuda &imgIdx,
-                            const ITensorDataStridedCuda &values, int max_eh, int max_ew, int num_erasing_area,
-                            bool random, unsigned int seed, int rows, int cols, int channels, cudaStream_t stream);
+                            const ITensorDataStridedCuda &values, int num_erasing_area, bool random,
+                            unsigned int seed, int rows, int cols, int channels, cudaStream_t stream);
 
     static const erase_t funcs[6] = {eraseCaller<uchar>, eraseCaller<char>, eraseCaller<ushort>,
                                      eraseCaller<short>, eraseCaller<int>,  eraseCaller<float>};
 
     if (inplace)
-        funcs[data_type](inData, anchor, erasing, imgIdx, values, max_eh, max_ew, num_erasing_area, random, seed,
+        funcs[data_type](inData, anchor, erasing, imgIdx, values, num_erasing_area, random, seed,
                          inAccess->numRows(), inAccess->numCols(), inAccess->numChannels(), stream);
     else
-        funcs[data_type](outData, anchor, erasing, imgIdx, values, max_eh, max_ew, num_erasing_area, random, seed,
+        funcs[data_type](outData, anchor, erasing, imgIdx, values, num_erasing_area, random, seed,
                          outAccess->numRows(), outAccess->numCols(), outAccess->numChannels(), stream);
 
     return SUCCESS;
@@ -22,7 +22,8 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
-#include "cub/cub.cuh"
+
+#include <algorithm>
 
 using namespace nvcv::legacy::helpers;
 
@@ -36,36 +37,53 @@ static __device__ int erase_var_shape_hash(unsigned int x)
     return x;
 }
 
+// Blocks per launch are limited so that many small erasing areas don't
+// end up launching too many idle blocks.
+static constexpr int kEraseBlockSize = 256;
+static constexpr int kEraseMaxBlocks = 4096;
+
 template<typename D>
 __global__ void erase(nvcv::cuda::ImageBatchVarShapeWrapNHWC<D> img, nvcv::cuda::Tensor1DWrap<int2> anchorVec,
                       nvcv::cuda::Tensor1DWrap<int3> erasingVec, nvcv::cuda::Tensor1DWrap<float> valuesVec,
                       nvcv::cuda::Tensor1DWrap<int> imgIdxVec, int channels, int random, unsigned int seed)
 {
-    unsigned int id      = threadIdx.x + blockIdx.x * blockDim.x;
-    int          c       = blockIdx.y;
-    int          eraseId = blockIdx.z;
-    int2         anchor  = anchorVec[eraseId];
-    int3         erasing = erasingVec[eraseId];
-    float        value   = valuesVec[eraseId * channels + c];
-    int          batchId = imgIdxVec[eraseId];
-    if (id < erasing.y * erasing.x && (0x1 & (erasing.z >> c)) == 1)
+    int  c       = blockIdx.y;
+    int  eraseId = blockIdx.z;
+    int3 erasing = erasingVec[eraseId];
+
+    if ((0x1 & (erasing.z >> c)) == 0)
+    {
+        return;
+    }
+
+    int2  anchor  = anchorVec[eraseId];
+    float value   = valuesVec[eraseId * channels + c];
+    int   batchId = imgIdxVec[eraseId];
+
+    // Only the part of the erasing area inside the image is processed.
+    int width  = min(erasing.x, img.width(batchId) - anchor.x);
+    int height = min(erasing.y, img.height(batchId) - anchor.y);
+    if (width <= 0 || height <= 0)
+    {
+        return;
+    }
+
+    // The grid isn't sized from the erasing area as it's only known on device,
+    // therefore we loop until the whole area is covered.
+    int area = width * height;
+    for (int id = threadIdx.x + blockIdx.x * blockDim.x; id < area; id += blockDim.x * gridDim.x)
     {
-        int x = id % erasing.x;
-        int y = id / erasing.x;
-        if ((anchor.x + x) < img.width(batchId) && (anchor.y + y) < img.height(batchId))
+        int x = id % width;
+        int y = id / width;
+        if (random)
         {
-            if (random)
-            {
-                unsigned int hashValue = seed + threadIdx.x
-                                       + 0x26AD0C9 * blockDim.x * blockDim.y * blockDim.z * (blockIdx.x + 1)
-                                             * (blockIdx.y + 1) * (blockIdx.z + 1);
-                *img.ptr(batchId, anchor.y + y, anchor.x + x, c)
-                    = nvcv::cuda::SaturateCast<D>(erase_var_shape_hash(hashValue) % 256);
-            }
-            else
-            {
-                *img.ptr(batchId, anchor.y + y, anchor.x + x, c) = nvcv::cuda::SaturateCast<D>(value);
-            }
+            unsigned int hashValue = seed + id + 0x26AD0C9 * (eraseId * channels + c + 1);
+            *img.ptr(batchId, anchor.y + y, anchor.x + x, c)
+                = nvcv::cuda::SaturateCast<D>(erase_var_shape_hash(hashValue) % 256);
+        }
+        else
+        {
+            *img.ptr(batchId, anchor.y + y, anchor.x + x, c) = nvcv::cuda::SaturateCast<D>(value);
         }
     }
 }
@@ -73,7 +91,7 @@ __global__ void erase(nvcv::cuda::ImageBatchVarShapeWrapNHWC<D> img, nvcv::cuda:
 template<typename D>
 void eraseCaller(const nvcv::IImageBatchVarShapeDataStridedCuda &imgs, const nvcv::ITensorDataStridedCuda &anchor,
                  const nvcv::ITensorDataStridedCuda &erasing, const nvcv::ITensorDataStridedCuda &imgIdx,
-                 const nvcv::ITensorDataStridedCuda &values, int max_eh, int max_ew, int num_erasing_area, bool random,
+                 const nvcv::ITensorDataStridedCuda &values, int max_h, int max_w, int num_erasing_area, bool random,
                  unsigned int seed, cudaStream_t stream)
 {
     nvcv::cuda::ImageBatchVarShapeWrapNHWC<D> src(imgs, imgs.uniqueFormat().numChannels());
@@ -83,69 +101,27 @@ void eraseCaller(const nvcv::IImageBatchVarShapeDataStridedCuda &imgs, const nvc
     nvcv::cuda::Tensor1DWrap<int>   imgIdxVec(imgIdx);
     nvcv::cuda::Tensor1DWrap<float> valuesVec(values);
 
-    int  channel   = imgs.uniqueFormat().numChannels();
-    int  blockSize = (max_eh * max_ew < 1024) ? max_eh * max_ew : 1024;
-    int  gridSize  = divUp(max_eh * max_ew, 1024);
-    dim3 block(blockSize);
+    int channel = imgs.uniqueFormat().numChannels();
+
+    // Erasing areas are clipped to the image, so they can't be larger than it.
+    int  gridSize = std::min(divUp(max_h * max_w, kEraseBlockSize),
+                             std::max(1, kEraseMaxBlocks / (channel * num_erasing_area)));
+    dim3 block(kEraseBlockSize);
     dim3 grid(gridSize, channel, num_erasing_area);
     erase<D><<<grid, block, 0, stream>>>(src, anchorVec, erasingVec, valuesVec, imgIdxVec, channel, random, seed);
 }
 
-struct MaxWH
-{
-    __device__ __forceinline__ int3 operator()(const int3 &a, const int3 &b) const
-    {
-        return int3{max(a.x, b.x), max(a.y, b.y), 0};
-    }
-};
-
 namespace nvcv::legacy::cuda_op {
 
 EraseVarShape::EraseVarShape(DataShape max_input_shape, DataShape max_output_shape, int num_erasing_area)
     : CudaBaseOp(max_input_shape, max_output_shape)
-    , d_max_values(nullptr)
-    , temp_storage(nullptr)
 {
-    cudaError_t err = cudaMalloc(&d_max_values, sizeof(int3));
-    if (err != cudaSuccess)
-    {
-        LOG_ERROR("CUDA memory allocation error of size: " << sizeof(int3));
-        throw std::runtime_error("CUDA memory allocation error!");
-    }
-
     max_num_erasing_area = num_erasing_area;
     if (max_num_erasing_area < 0)
     {
-        cudaFree(d_max_values);
         LOG_ERROR("Invalid num of erasing area" << max_num_erasing_area);
         throw std::runtime_error("Parameter error!");
     }
-    temp_storage  = NULL;
-    storage_bytes = 0;
-    MaxWH mwh;
-    int3  init = {0, 0, 0};
-    cub::DeviceReduce::Reduce(temp_storage, storage_bytes, (int3 *)nullptr, (int3 *)nullptr, max_num_erasing_area, mwh,
-                              init);
-
-    err = cudaMalloc(&temp_storage, storage_bytes);
-    if (err != cudaSuccess)
-    {
-        cudaFree(d_max_values);
-        LOG_ERROR("CUDA memory allocation error of size: " << storage_bytes);
-        throw std::runtime_error("CUDA memory allocation error!");
-    }
-}
-
-EraseVarShape::~EraseVarShape()
-{
-    cudaError_t err0 = cudaFree(d_max_values);
-    cudaError_t err1 = cudaFree(temp_storage);
-    if (err0 != cudaSuccess || err1 != cudaSuccess)
-    {
-        LOG_ERROR("CUDA memory free error, possible memory leak!");
-    }
-    d_max_values = nullptr;
-    temp_storage = nullptr;
 }
 
 ErrorCode EraseVarShape::infer(const nvcv::IImageBatchVarShape &inbatch, const nvcv::IImageBatchVarShape &outbatch,
@@ -260,6 +236,11 @@ ErrorCode EraseVarShape::infer(const nvcv::IImageBatchVarShape &inbatch, const n
             auto                    *outimgdata = dynamic_cast<const IImageDataStridedCuda *>(outimg.exportData());
             const ImagePlaneStrided &inplane    = inimgdata->plane(0);
             const ImagePlaneStrided &outplane   = outimgdata->plane(0);
+            // Images of the output batch that are also in the input one are erased in place
+            if (outplane.basePtr == inplane.basePtr)
+            {
+                continue;
+            }
             checkCudaErrors(cudaMemcpy2DAsync(outplane.basePtr, outplane.rowStride, inplane.basePtr, inplane.rowStride,
                                               inplane.rowStride, inplane.height, cudaMemcpyDeviceToDevice, stream));
         }
@@ -270,39 +251,24 @@ ErrorCode EraseVarShape::infer(const nvcv::IImageBatchVarShape &inbatch, const n
         return SUCCESS;
     }
 
-    int3 *d_erasing = (int3 *)erasing.basePtr();
-    int3  h_max_values;
-    MaxWH maxwh;
-    int3  init = {0, 0, 0};
-
-    cub::DeviceReduce::Reduce(temp_storage, storage_bytes, d_erasing, d_max_values, num_erasing_area, maxwh, init,
-                              stream);
-    checkCudaErrors(cudaMemcpyAsync(&h_max_values, d_max_values, sizeof(int3), cudaMemcpyDeviceToHost, stream));
-
-    checkCudaErrors(cudaStreamSynchronize(stream));
-
-    int max_ew = h_max_values.x, max_eh = h_max_values.y;
-
-    // All areas as empty? Weird, but valid nonetheless.
-    if (max_ew == 0 || max_eh == 0)
-    {
-        return SUCCESS;
-    }
+    // Max erasing area size is only known on device, sizing the grid with it
+    // would require a stream synchronization.
+    nvcv::Size2D maxSize = inData->maxSize();
 
     typedef void (*erase_t)(const IImageBatchVarShapeDataStridedCuda &imgs, const ITensorDataStridedCuda &anchor,
                             const ITensorDataStridedCuda &erasing, const ITensorDataStridedCuda &imgIdx,
-                            const ITensorDataStridedCuda &values, int max_eh, int max_ew, int num_erasing_area,
+                            const ITensorDataStridedCuda &values, int max_h, int max_w, int num_erasing_area,
                             bool random, unsigned int seed, cudaStream_t stream);
 
     static const erase_t funcs[6] = {eraseCaller<uchar>, eraseCaller<char>, eraseCaller<ushort>,
                                      eraseCaller<short>, eraseCaller<int>,  eraseCaller<float>};
 
     if (inplace)
-        funcs[data_type](*inData, anchor, erasing, imgIdx, values, max_eh, max_ew, num_erasing_area, random, seed,
-                         stream);
+        funcs[data_type](*inData, anchor, erasing, imgIdx, values, maxSize.h, maxSize.w, num_erasing_area, random,
+                         seed, stream);
     else
-        funcs[data_type](*outData, anchor, erasing, imgIdx, values, max_eh, max_ew, num_erasing_area, random, seed,
-                         stream);
+        funcs[data_type](*outData, anchor, erasing, imgIdx, values, maxSize.h, maxSize.w, num_erasing_area, random,
+                         seed, stream);
 
     return SUCCESS;
 }
@@ -0,0 +1,762 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../Assert.h"
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+#include <cufft.h>
+#include <nvcv/Exception.hpp>
+
+#include <algorithm>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace nvcv::legacy::cuda_op {
+
+namespace {
+
+// Smallest and largest side of the transforms.  Transforms of four times the kernel side keep at least 3/4 of
+// each tile valid, the largest kernels settle for half of it.
+constexpr int kMinTransformSize = 64;
+constexpr int kMaxTransformSize = 1024;
+
+void CheckCufft(cufftResult result, const char *call)
+{
+    if (result != CUFFT_SUCCESS)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INTERNAL, "%s failed with cuFFT error %d", call,
+                              static_cast<int>(result));
+    }
+}
+
+#define CHECK_CUFFT(call) CheckCufft(call, #call)
+
+// The correlation kernels work on chunks of n x n real tiles, stored one after the other, and on their spectra of
+// n x (n / 2 + 1) complex values, as laid out by cuFFT batched transforms.  blockIdx.z is the tile of the chunk.
+
+// Tiles::load(tile, u, v) is the pixel (u, v) of the given tile, 0 where there's none.
+template<class Tiles>
+__global__ void fftLoadTiles(const Tiles tiles, float *real, int n, int firstTile)
+{
+    const int u = blockIdx.x * blockDim.x + threadIdx.x;
+    const int v = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if (u >= n || v >= n)
+        return;
+
+    real[(static_cast<size_t>(blockIdx.z) * n + v) * n + u] = tiles.load(firstTile + blockIdx.z, u, v);
+}
+
+// Kernels::load(kernel, u, v) is the weight (u, v) of the kernel, 0 outside it.  The weights are scaled to
+// normalize the inverse transforms.
+template<class Kernels>
+__global__ void fftLoadKernels(const Kernels kernels, float *real, int n, int firstKernel, float scale)
+{
+    const int u = blockIdx.x * blockDim.x + threadIdx.x;
+    const int v = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if (u >= n || v >= n)
+        return;
+
+    real[(static_cast<size_t>(blockIdx.z) * n + v) * n + u] = kernels.load(firstKernel + blockIdx.z, u, v) * scale;
+}
+
+// Multiplies the spectrum of each tile by the conjugate of the spectrum of its kernel, i.e. correlates them.
+__global__ void fftMultiplySpectra(cufftComplex *tileSpectra, const cufftComplex *kernelSpectra, int specSize,
+                                   int firstTile, int tilesPerKernel, int firstKernel)
+{
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (i >= specSize)
+        return;
+
+    const int kernel = (firstTile + blockIdx.y) / tilesPerKernel - firstKernel;
+
+    const cufftComplex k = kernelSpectra[static_cast<size_t>(kernel) * specSize + i];
+    cufftComplex      &a = tileSpectra[static_cast<size_t>(blockIdx.y) * specSize + i];
+
+    a = cufftComplex{a.x * k.x + a.y * k.y, a.y * k.x - a.x * k.y};
+}
+
+// Tiles::store(tile, x, y, value) writes the correlation at (x, y) of the tile, for the tiles.valid part of it
+// that didn't wrap around.
+template<class Tiles>
+__global__ void fftStoreTiles(const Tiles tiles, const float *real, int n, int firstTile)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if (x >= tiles.valid.x || y >= tiles.valid.y)
+        return;
+
+    tiles.store(firstTile + blockIdx.z, x, y, real[(static_cast<size_t>(blockIdx.z) * n + y) * n + x]);
+}
+
+inline int NextPowerOfTwo(int value)
+{
+    int p = 1;
+    while (p < value)
+    {
+        p *= 2;
+    }
+    return p;
+}
+
+// Correlates numKernels * tilesPerKernel tiles of n x n pixels, tile t with kernel t / tilesPerKernel, in
+// workspaceSize bytes.  Half of the workspace holds a chunk of tiles with their spectra, the rest the spectra of as
+// many kernels as fit, which are transformed once per group.  Chunks are powers of two, or the largest that fits,
+// to bound the number of plans.
+template<class Tiles, class Kernels>
+void Correlate(FFTCorrelator &fft, const Tiles &tiles, const Kernels &kernels, int n, int numKernels,
+               int tilesPerKernel, void *workspace, size_t workspaceSize, cudaStream_t stream)
+{
+    const size_t specSize  = static_cast<size_t>(n) * (n / 2 + 1);
+    const size_t realBytes = static_cast<size_t>(n) * n * sizeof(float);
+    const size_t specBytes = specSize * sizeof(cufftComplex);
+
+    const int numTiles = numKernels * tilesPerKernel;
+    const int maxChunk = std::max<int>(1, workspaceSize / 2 / (realBytes + specBytes));
+    const int chunk    = std::min(maxChunk, NextPowerOfTwo(numTiles));
+
+    const int maxGroup = (workspaceSize - chunk * (realBytes + specBytes)) / specBytes / chunk * chunk;
+    NVCV_ASSERT(maxGroup >= chunk);
+
+    float        *real          = static_cast<float *>(workspace);
+    cufftComplex *tileSpectra   = reinterpret_cast<cufftComplex *>(static_cast<char *>(workspace) + chunk * realBytes);
+    cufftComplex *kernelSpectra = tileSpectra + chunk * specSize;
+
+    auto [forward, inverse] = fft.plans(stream, n, chunk);
+
+    dim3 block(32, 8);
+
+    for (int firstKernel = 0; firstKernel < numKernels; firstKernel += maxGroup)
+    {
+        const int groupSize = std::min(maxGroup, numKernels - firstKernel);
+
+        for (int k = 0; k < groupSize; k += chunk)
+        {
+            const int count = std::min(chunk, groupSize - k);
+
+            dim3 grid(divUp(n, block.x), divUp(n, block.y), count);
+            fftLoadKernels<<<grid, block, 0, stream>>>(kernels, real, n, firstKernel + k, 1.f / (n * n));
+            checkKernelErrors();
+
+            CHECK_CUFFT(cufftExecR2C(forward, real, kernelSpectra + k * specSize));
+        }
+
+        const int lastTile = (firstKernel + groupSize) * tilesPerKernel;
+
+        for (int firstTile = firstKernel * tilesPerKernel; firstTile < lastTile; firstTile += chunk)
+        {
+            const int count = std::min(chunk, lastTile - firstTile);
+
+            dim3 loadGrid(divUp(n, block.x), divUp(n, block.y), count);
+            fftLoadTiles<<<loadGrid, block, 0, stream>>>(tiles, real, n, firstTile);
+            checkKernelErrors();
+
+            CHECK_CUFFT(cufftExecR2C(forward, real, tileSpectra));
+
+            dim3 mulGrid(divUp(static_cast<int>(specSize), 256), count);
+            fftMultiplySpectra<<<mulGrid, 256, 0, stream>>>(tileSpectra, kernelSpectra, specSize, firstTile,
+                                                            tilesPerKernel, firstKernel);
+            checkKernelErrors();
+
+            CHECK_CUFFT(cufftExecC2R(inverse, tileSpectra, real));
+
+            dim3 storeGrid(divUp(tiles.valid.x, block.x), divUp(tiles.valid.y, block.y), count);
+            fftStoreTiles<<<storeGrid, block, 0, stream>>>(tiles, real, n, firstTile);
+            checkKernelErrors();
+        }
+    }
+}
+
+// Conv2D ----------------------------------------------------------------------
+
+// Tiles of the correlation of each channel of each sample, on a grid over the largest image, with its border.
+// Tiles past the end of smaller images are transformed but not stored.
+template<typename T, NVCVBorderType B>
+struct Conv2DFFTTiles
+{
+    cuda::ImageBatchVarShapeWrapNHWC<const T> src;
+    cuda::ImageBatchVarShapeWrapNHWC<T>       dst;
+    cuda::ImageBatchVarShapeWrap<float>       kernel;
+    cuda::Tensor1DWrap<int2>                  kernelAnchor;
+
+    float borderValue;
+    int   channels, tilesX, tilesY;
+    int2  valid;
+
+    // Sample, channel and position of the first output of a tile
+    __device__ int4 locate(int tile) const
+    {
+        const int tilesPerImage = tilesX * tilesY;
+
+        const int sample = tile / (channels * tilesPerImage);
+        tile -= sample * channels * tilesPerImage;
+
+        const int c = tile / tilesPerImage;
+        tile -= c * tilesPerImage;
+
+        return {sample, c, tile % tilesX * valid.x, tile / tilesX * valid.y};
+    }
+
+    __device__ float load(int tile, int u, int v) const
+    {
+        const int4 loc = locate(tile);
+        const int2 size{src.width(loc.x), src.height(loc.x)};
+
+        int2 anchor = kernelAnchor[loc.x];
+        if (anchor.x < 0)
+            anchor.x = kernel.width(loc.x) / 2;
+        if (anchor.y < 0)
+            anchor.y = kernel.height(loc.x) / 2;
+
+        int2 coord{loc.z - anchor.x + u, loc.w - anchor.y + v};
+
+        if constexpr (B == NVCV_BORDER_CONSTANT)
+        {
+            if (cuda::IsOutside(coord.x, size.x) || cuda::IsOutside(coord.y, size.y))
+            {
+                return borderValue;
+            }
+        }
+        else
+        {
+            coord.x = cuda::GetIndexWithBorder<B>(coord.x, size.x);
+            coord.y = cuda::GetIndexWithBorder<B>(coord.y, size.y);
+        }
+
+        return static_cast<float>(src.ptr(loc.x, coord.y, coord.x)[loc.y]);
+    }
+
+    __device__ void store(int tile, int x, int y, float value) const
+    {
+        const int4 loc = locate(tile);
+
+        x += loc.z;
+        y += loc.w;
+
+        if (x < dst.width(loc.x) && y < dst.height(loc.x))
+        {
+            dst.ptr(loc.x, y, x)[loc.y] = cuda::SaturateCast<T>(value);
+        }
+    }
+};
+
+struct Conv2DFFTKernels
+{
+    cuda::ImageBatchVarShapeWrap<float> kernel;
+
+    __device__ float load(int sample, int u, int v) const
+    {
+        return u < kernel.width(sample) && v < kernel.height(sample) ? *kernel.ptr(sample, v, u) : 0.f;
+    }
+};
+
+template<typename T, NVCVBorderType B>
+void Conv2DFFTCaller(FFTCorrelator &fft, const IImageBatchVarShapeDataStridedCuda &inData,
+                     const IImageBatchVarShapeDataStridedCuda &outData,
+                     const IImageBatchVarShapeDataStridedCuda &kernelData,
+                     const ITensorDataStridedCuda &kernelAnchorData, int channels, void *workspace,
+                     cudaStream_t stream)
+{
+    const Size2D maxKernelSize = kernelData.maxSize();
+    const int    n             = FFTCorrelator::TransformSize(int2{maxKernelSize.w, maxKernelSize.h});
+    const int2   valid{n - maxKernelSize.w + 1, n - maxKernelSize.h + 1};
+
+    Conv2DFFTTiles<T, B> tiles{cuda::ImageBatchVarShapeWrapNHWC<const T>(inData, channels),
+                               cuda::ImageBatchVarShapeWrapNHWC<T>(outData, channels),
+                               cuda::ImageBatchVarShapeWrap<float>(kernelData),
+                               cuda::Tensor1DWrap<int2>(kernelAnchorData),
+                               0.f,
+                               channels,
+                               divUp(outData.maxSize().w, valid.x),
+                               divUp(outData.maxSize().h, valid.y),
+                               valid};
+
+    Correlate(fft, tiles, Conv2DFFTKernels{cuda::ImageBatchVarShapeWrap<float>(kernelData)}, n,
+              outData.numImages(), channels * tiles.tilesX * tiles.tilesY, workspace, FFTCorrelator::kWorkspaceSize,
+              stream);
+}
+
+template<typename T>
+void Conv2DFFT(FFTCorrelator &fft, const IImageBatchVarShapeDataStridedCuda &inData,
+               const IImageBatchVarShapeDataStridedCuda &outData, const IImageBatchVarShapeDataStridedCuda &kernelData,
+               const ITensorDataStridedCuda &kernelAnchorData, NVCVBorderType borderMode, int channels,
+               void *workspace, cudaStream_t stream)
+{
+    typedef void (*func_t)(FFTCorrelator &fft, const IImageBatchVarShapeDataStridedCuda &inData,
+                           const IImageBatchVarShapeDataStridedCuda &outData,
+                           const IImageBatchVarShapeDataStridedCuda &kernelData,
+                           const ITensorDataStridedCuda &kernelAnchorData, int channels, void *workspace,
+                           cudaStream_t stream);
+
+    static const func_t funcs[]
+        = {Conv2DFFTCaller<T, NVCV_BORDER_CONSTANT>, Conv2DFFTCaller<T, NVCV_BORDER_REPLICATE>,
+           Conv2DFFTCaller<T, NVCV_BORDER_REFLECT>, Conv2DFFTCaller<T, NVCV_BORDER_WRAP>,
+           Conv2DFFTCaller<T, NVCV_BORDER_REFLECT101>};
+
+    funcs[borderMode](fft, inData, outData, kernelData, kernelAnchorData, channels, workspace.get(), stream);
+}
+
+// MatchTemplate ---------------------------------------------------------------
+
+// Output columns and rows of the blocks of the normalization.  Each thread sums the window rows of up to
+// kNormColsPerThread input columns, enough for the block's outputs and the largest templates.
+constexpr int kNormBlock         = 256;
+constexpr int kNormRows          = 64;
+constexpr int kNormColsPerThread = 3;
+
+static_assert(kNormBlock * kNormColsPerThread >= kNormBlock + FFTCorrelator::kMaxKernelSize - 1);
+
+// Tiles of the correlation of each sample with the mean-centered template, storing the numerator of the score.
+template<typename T>
+struct MatchTemplateTiles
+{
+    cuda::Tensor3DWrap<const T> src;
+    cuda::Tensor3DWrap<float>   dst;
+
+    int2 size, outSize;
+    int  tilesX, tilesY;
+    int2 valid;
+
+    __device__ float load(int tile, int u, int v) const
+    {
+        const int sample = tile / (tilesX * tilesY);
+        tile -= sample * tilesX * tilesY;
+
+        const int x = tile % tilesX * valid.x + u;
+        const int y = tile / tilesX * valid.y + v;
+
+        return x < size.x && y < size.y ? static_cast<float>(*src.ptr(sample, y, x)) : 0.f;
+    }
+
+    __device__ void store(int tile, int x, int y, float value) const
+    {
+        const int sample = tile / (tilesX * tilesY);
+        tile -= sample * tilesX * tilesY;
+
+        x += tile % tilesX * valid.x;
+        y += tile / tilesX * valid.y;
+
+        if (x < outSize.x && y < outSize.y)
+        {
+            *dst.ptr(sample, y, x) = value;
+        }
+    }
+};
+
+template<typename T>
+struct MatchTemplateKernels
+{
+    cuda::Tensor3DWrap<const T> templ;
+
+    int2           templSize;
+    bool           broadcast;
+    const double2 *stats;
+
+    __device__ float load(int sample, int u, int v) const
+    {
+        if (u >= templSize.x || v >= templSize.y)
+            return 0.f;
+
+        return static_cast<float>(*templ.ptr(broadcast ? 0 : sample, v, u) - stats[sample].x);
+    }
+};
+
+__device__ double BlockSum(double value, double *partial)
+{
+    partial[threadIdx.x] = value;
+    __syncthreads();
+
+    for (int s = blockDim.x / 2; s > 0; s /= 2)
+    {
+        if (threadIdx.x < s)
+        {
+            partial[threadIdx.x] += partial[threadIdx.x + s];
+        }
+        __syncthreads();
+    }
+
+    value = partial[0];
+    __syncthreads();
+    return value;
+}
+
+// Mean of the template of each sample, and the sum of its squared deviations, blockIdx.x being the sample.
+template<typename T>
+__global__ void matchTemplateStats(const cuda::Tensor3DWrap<const T> templ, int2 templSize, bool broadcast,
+                                   double2 *stats)
+{
+    __shared__ double partial[256];
+
+    const int sample = blockIdx.x;
+    const int area   = templSize.x * templSize.y;
+    const int ts     = broadcast ? 0 : sample;
+
+    double sum = 0;
+    for (int i = threadIdx.x; i < area; i += blockDim.x)
+    {
+        sum += *templ.ptr(ts, i / templSize.x, i % templSize.x);
+    }
+    const double mean = BlockSum(sum, partial) / area;
+
+    double sumSq = 0;
+    for (int i = threadIdx.x; i < area; i += blockDim.x)
+    {
+        double d = *templ.ptr(ts, i / templSize.x, i % templSize.x) - mean;
+        sumSq += d * d;
+    }
+    sumSq = BlockSum(sumSq, partial);
+
+    if (threadIdx.x == 0)
+    {
+        stats[sample] = double2{mean, sumSq};
+    }
+}
+
+// Normalizes the numerators in dst by the deviation of the image windows, as OpenCV's TM_CCOEFF_NORMED.  Each
+// thread keeps the sums over the window rows of its input columns, sliding them down the block's output rows, and
+// the window sums are differences of their prefix sums over the block.
+template<typename T>
+__global__ void matchTemplateNormalize(const cuda::Tensor3DWrap<const T> src, cuda::Tensor3DWrap<float> dst,
+                                       int2 size, int2 templSize, int2 outSize, const double2 *stats)
+{
+    __shared__ double2 scan[kNormBlock];
+    __shared__ double2 prefix[kNormBlock * kNormColsPerThread + 1];
+
+    const int sample = blockIdx.z;
+    const int x0     = blockIdx.x * kNormBlock;
+    const int y0     = blockIdx.y * kNormRows;
+    const int y1     = min(y0 + kNormRows, outSize.y);
+    const int c0     = threadIdx.x * kNormColsPerThread;
+
+    const double area  = static_cast<double>(templSize.x) * templSize.y;
+    const double varT  = stats[sample].y;
+    const int    xLast = min(x0 + kNormBlock + templSize.x - 1, size.x);
+
+    double2 cols[kNormColsPerThread];
+#pragma unroll
+    for (int k = 0; k < kNormColsPerThread; ++k)
+    {
+        cols[k] = double2{0, 0};
+
+        const int x = x0 + c0 + k;
+        if (x < xLast)
+        {
+            for (int v = 0; v < templSize.y; ++v)
+            {
+                double p = *src.ptr(sample, y0 + v, x);
+                cols[k].x += p;
+                cols[k].y += p * p;
+            }
+        }
+    }
+
+    if (threadIdx.x == 0)
+    {
+        prefix[0] = double2{0, 0};
+    }
+
+    for (int y = y0; y < y1; ++y)
+    {
+        if (y > y0)
+        {
+#pragma unroll
+            for (int k = 0; k < kNormColsPerThread; ++k)
+            {
+                const int x = x0 + c0 + k;
+                if (x < xLast)
+                {
+                    double pIn  = *src.ptr(sample, y + templSize.y - 1, x);
+                    double pOut = *src.ptr(sample, y - 1, x);
+                    cols[k].x += pIn - pOut;
+                    cols[k].y += pIn * pIn - pOut * pOut;
+                }
+            }
+        }
+
+        double2 total{0, 0};
+#pragma unroll
+        for (int k = 0; k < kNormColsPerThread; ++k)
+        {
+            total.x += cols[k].x;
+            total.y += cols[k].y;
+        }
+
+        // inclusive scan of the thread totals
+        scan[threadIdx.x] = total;
+        __syncthreads();
+        for (int offset = 1; offset < kNormBlock; offset *= 2)
+        {
+            double2 add = threadIdx.x >= offset ? scan[threadIdx.x - offset] : double2{0, 0};
+            __syncthreads();
+            scan[threadIdx.x].x += add.x;
+            scan[threadIdx.x].y += add.y;
+            __syncthreads();
+        }
+
+        double2 run = threadIdx.x > 0 ? scan[threadIdx.x - 1] : double2{0, 0};
+#pragma unroll
+        for (int k = 0; k < kNormColsPerThread; ++k)
+        {
+            run.x += cols[k].x;
+            run.y += cols[k].y;
+            prefix[c0 + k + 1] = run;
+        }
+        __syncthreads();
+
+        const int x = x0 + threadIdx.x;
+        if (x < outSize.x)
+        {
+            const double2 a = prefix[threadIdx.x];
+            const double2 b = prefix[threadIdx.x + templSize.x];
+
+            const double sum   = b.x - a.x;
+            const double sumSq = b.y - a.y;
+            const double t     = sqrt(max(sumSq - sum * sum / area, 0.0) * varT);
+
+            float &r = *dst.ptr(sample, y, x);
+            double num = r;
+            if (fabs(num) < t)
+                num /= t;
+            else if (fabs(num) < t * 1.125)
+                num = num > 0 ? 1 : -1;
+            else
+                num = 0;
+            r = static_cast<float>(num);
+        }
+        __syncthreads();
+    }
+}
+
+template<typename T>
+void MatchTemplateCaller(FFTCorrelator &fft, const TensorDataAccessStridedImagePlanar &inAccess,
+                         const TensorDataAccessStridedImagePlanar &templAccess, const ITensorDataStridedCuda &inData,
+                         const ITensorDataStridedCuda &templData, const ITensorDataStridedCuda &outData,
+                         void *workspace, cudaStream_t stream)
+{
+    const int  numSamples = inAccess.numSamples();
+    const int2 size{static_cast<int>(inAccess.numCols()), static_cast<int>(inAccess.numRows())};
+    const int2 templSize{static_cast<int>(templAccess.numCols()), static_cast<int>(templAccess.numRows())};
+    const int2 outSize{size.x - templSize.x + 1, size.y - templSize.y + 1};
+    const bool broadcast = templAccess.numSamples() == 1;
+
+    auto src   = cuda::CreateTensorWrapNHW<const T>(inData);
+    auto templ = cuda::CreateTensorWrapNHW<const T>(templData);
+    auto dst   = cuda::CreateTensorWrapNHW<float>(outData);
+
+    double2 *stats = reinterpret_cast<double2 *>(static_cast<char *>(workspace) + FFTCorrelator::kWorkspaceSize);
+
+    matchTemplateStats<<<numSamples, 256, 0, stream>>>(templ, templSize, broadcast, stats);
+    checkKernelErrors();
+
+    const int  n = FFTCorrelator::TransformSize(templSize);
+    const int2 valid{n - templSize.x + 1, n - templSize.y + 1};
+
+    MatchTemplateTiles<T> tiles{src, dst, size, outSize, divUp(outSize.x, valid.x), divUp(outSize.y, valid.y), valid};
+
+    Correlate(fft, tiles, MatchTemplateKernels<T>{templ, templSize, broadcast, stats}, n, numSamples,
+              tiles.tilesX * tiles.tilesY, workspace, FFTCorrelator::kWorkspaceSize, stream);
+
+    dim3 grid(divUp(outSize.x, kNormBlock), divUp(outSize.y, kNormRows), numSamples);
+    matchTemplateNormalize<<<grid, kNormBlock, 0, stream>>>(src, dst, size, templSize, outSize, stats);
+    checkKernelErrors();
+}
+
+} // namespace
+
+// FFTCorrelator ---------------------------------------------------------------
+
+FFTCorrelator::~FFTCorrelator()
+{
+    for (auto &[key, plans] : m_plans)
+    {
+        cufftDestroy(plans.first);
+        cufftDestroy(plans.second);
+    }
+}
+
+int FFTCorrelator::TransformSize(int2 maxKernelSize)
+{
+    const int side = std::max(maxKernelSize.x, maxKernelSize.y);
+    return std::clamp(NextPowerOfTwo(4 * side), kMinTransformSize, kMaxTransformSize);
+}
+
+std::pair<int, int> FFTCorrelator::plans(cudaStream_t stream, int n, int batch)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+
+    auto key = std::make_tuple(stream, n, batch);
+    auto it  = m_plans.find(key);
+    if (it == m_plans.end())
+    {
+        int dims[2] = {n, n};
+
+        cufftHandle forward, inverse;
+        CHECK_CUFFT(cufftPlanMany(&forward, 2, dims, nullptr, 1, 0, nullptr, 1, 0, CUFFT_R2C, batch));
+        if (cufftResult result = cufftPlanMany(&inverse, 2, dims, nullptr, 1, 0, nullptr, 1, 0, CUFFT_C2R, batch);
+            result != CUFFT_SUCCESS)
+        {
+            cufftDestroy(forward);
+            CheckCufft(result, "cufftPlanMany");
+        }
+
+        CHECK_CUFFT(cufftSetStream(forward, stream));
+        CHECK_CUFFT(cufftSetStream(inverse, stream));
+
+        it = m_plans.emplace(key, std::make_pair(forward, inverse)).first;
+    }
+
+    return it->second;
+}
+
+// Conv2DVarShape --------------------------------------------------------------
+
+ErrorCode Conv2DVarShape::inferFFT(const IImageBatchVarShapeDataStridedCuda &inData,
+                                   const IImageBatchVarShapeDataStridedCuda &outData,
+                                   const IImageBatchVarShapeDataStridedCuda &kernelData,
+                                   const ITensorDataStridedCuda &kernelAnchorData, NVCVBorderType borderMode,
+                                   DataType dataType, int channels, cudaStream_t stream)
+{
+    typedef void (*func_t)(FFTCorrelator &fft, const IImageBatchVarShapeDataStridedCuda &inData,
+                           const IImageBatchVarShapeDataStridedCuda &outData,
+                           const IImageBatchVarShapeDataStridedCuda &kernelData,
+                           const ITensorDataStridedCuda &kernelAnchorData, NVCVBorderType borderMode, int channels,
+                           void *workspace, cudaStream_t stream);
+
+    static const func_t funcs[6] = {Conv2DFFT<uchar>, 0, Conv2DFFT<ushort>, Conv2DFFT<short>,
+                                    Conv2DFFT<int>,   Conv2DFFT<float>};
+
+    const func_t func = funcs[dataType];
+    NVCV_ASSERT(func != 0);
+
+    GpuWorkspaceLease workspace = gpuWorkspace(stream, FFTCorrelator::kWorkspaceSize);
+
+    func(m_fft, inData, outData, kernelData, kernelAnchorData, borderMode, channels, workspace.get(), stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+// MatchTemplate ---------------------------------------------------------------
+
+size_t MatchTemplate::calBufferSize()
+{
+    return FFTCorrelator::kWorkspaceSize + kMaxSamples * sizeof(double2);
+}
+
+ErrorCode MatchTemplate::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &templData,
+                               const ITensorDataStridedCuda &outData, cudaStream_t stream)
+{
+    for (const ITensorDataStridedCuda *data : {&inData, &templData, &outData})
+    {
+        DataFormat format = GetLegacyDataFormat(data->layout());
+        if (!(format == kNHWC || format == kHWC))
+        {
+            LOG_ERROR("Invalid DataFormat " << format);
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+    }
+
+    DataType dataType = GetLegacyDataType(inData.dtype());
+    if (!(dataType == kCV_8U || dataType == kCV_32F))
+    {
+        LOG_ERROR("Invalid input DataType " << inData.dtype() << ", it must be uint8 or float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (templData.dtype() != inData.dtype())
+    {
+        LOG_ERROR("Invalid template DataType " << templData.dtype() << ", it must be the input's " << inData.dtype());
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (outData.dtype() != nvcv::TYPE_F32)
+    {
+        LOG_ERROR("Invalid output DataType " << outData.dtype() << ", it must be float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess    = TensorDataAccessStridedImagePlanar::Create(inData);
+    auto templAccess = TensorDataAccessStridedImagePlanar::Create(templData);
+    auto outAccess   = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(inAccess && templAccess && outAccess);
+
+    if (inAccess->numChannels() != 1 || templAccess->numChannels() != 1 || outAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid channel numbers of input " << inAccess->numChannels() << ", template "
+                                                      << templAccess->numChannels() << " and output "
+                                                      << outAccess->numChannels() << ", they must be 1");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const int numSamples = inAccess->numSamples();
+    if (numSamples > kMaxSamples)
+    {
+        LOG_ERROR("Invalid number of samples " << numSamples << ", it must be at most " << kMaxSamples);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (templAccess->numSamples() != numSamples && templAccess->numSamples() != 1)
+    {
+        LOG_ERROR("Invalid number of templates " << templAccess->numSamples() << ", it must be 1 or the number of "
+                                                 << "input samples " << numSamples);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const int64_t templW = templAccess->numCols(), templH = templAccess->numRows();
+    if (templW < 1 || templH < 1 || templW > FFTCorrelator::kMaxKernelSize || templH > FFTCorrelator::kMaxKernelSize
+        || templW > inAccess->numCols() || templH > inAccess->numRows())
+    {
+        LOG_ERROR("Invalid template shape " << templData.shape() << ", it must be at most "
+                                            << FFTCorrelator::kMaxKernelSize << " pixels per side and fit in the "
+                                            << "input images " << inData.shape());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (outAccess->numSamples() != numSamples || outAccess->numCols() != inAccess->numCols() - templW + 1
+        || outAccess->numRows() != inAccess->numRows() - templH + 1)
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must have the " << numSamples
+                                          << " input samples of (W - templW + 1) x (H - templH + 1) pixels");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (numSamples == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(FFTCorrelator &fft, const TensorDataAccessStridedImagePlanar &inAccess,
+                           const TensorDataAccessStridedImagePlanar &templAccess, const ITensorDataStridedCuda &inData,
+                           const ITensorDataStridedCuda &templData, const ITensorDataStridedCuda &outData,
+                           void *workspace, cudaStream_t stream);
+
+    const func_t func = dataType == kCV_8U ? MatchTemplateCaller<uchar> : MatchTemplateCaller<float>;
+
+    GpuWorkspaceLease workspace = gpuWorkspace(stream, FFTCorrelator::kWorkspaceSize + numSamples * sizeof(double2));
+
+    func(m_fft, *inAccess, *templAccess, inData, templData, outData, workspace.get(), stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
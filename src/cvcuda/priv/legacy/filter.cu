@@ -24,35 +24,62 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "SobelKernels.cuh"
+#include "StencilRegions.cuh"
 
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
 
 namespace nvcv::legacy::cuda_op {
 
+// Kernel weights passed by value (in the kernel parameter constant bank) have their square size fixed at compile
+// time, so the filter loops are fully unrolled.  Weights in global memory have a run-time kernel size.
+template<class KernelWrapper>
+struct FixedKernelSize
+{
+    static constexpr int value = 0;
+};
+
+template<int N>
+struct FixedKernelSize<cuda::math::Vector<float, N>>
+{
+    static constexpr int value = N == 9 ? 3 : (N == 25 ? 5 : (N == 49 ? 7 : 0));
+    static_assert(value != 0, "Unsupported fixed kernel size");
+};
+
 template<class SrcWrapper, class DstWrapper, class KernelWrapper>
-__global__ void filter2D(SrcWrapper src, DstWrapper dst, Size2D dstSize, KernelWrapper kernel, Size2D kernelSize,
-                         int2 kernelAnchor)
+__global__ void filter2D(SrcWrapper src, DstWrapper dst, StencilRegion region, KernelWrapper kernel,
+                         Size2D kernelSize, int2 kernelAnchor)
 {
     using T         = typename DstWrapper::ValueType;
     using work_type = cuda::ConvertBaseTypeTo<float, T>;
     work_type res   = cuda::SetAll<work_type>(0);
 
-    const int x         = blockIdx.x * blockDim.x + threadIdx.x;
-    const int y         = blockIdx.y * blockDim.y + threadIdx.y;
+    constexpr int kFixedSize = FixedKernelSize<KernelWrapper>::value;
+
+    const int kernelWidth  = kFixedSize > 0 ? kFixedSize : kernelSize.w;
+    const int kernelHeight = kFixedSize > 0 ? kFixedSize : kernelSize.h;
+
+    const int dx        = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dy        = blockIdx.y * blockDim.y + threadIdx.y;
     const int batch_idx = get_batch_idx();
 
-    if (x >= dstSize.w || y >= dstSize.h)
+    if (dx >= region.size.w || dy >= region.size.h)
         return;
 
+    const int x = region.offset.x + dx;
+    const int y = region.offset.y + dy;
+
     int  kInd = 0;
     int3 coord{x, y, batch_idx};
 
-    for (int i = 0; i < kernelSize.h; ++i)
+#pragma unroll
+    for (int i = 0; i < kernelHeight; ++i)
     {
         coord.y = y - kernelAnchor.y + i;
 
-        for (int j = 0; j < kernelSize.w; ++j)
+#pragma unroll
+        for (int j = 0; j < kernelWidth; ++j)
         {
             coord.x = x - kernelAnchor.x + j;
 
@@ -72,15 +99,40 @@ void Filter2DCaller(const ITensorDataStridedCuda &inData, const ITensorDataStrid
 
     Size2D dstSize{outAccess->numCols(), outAccess->numRows()};
 
+    // fixed-size kernels must match the run-time size
+    NVCV_ASSERT(FixedKernelSize<KernelWrapper>::value == 0
+                || (kernelSize.w == FixedKernelSize<KernelWrapper>::value
+                    && kernelSize.h == FixedKernelSize<KernelWrapper>::value));
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    Size2D srcSize{inAccess->numCols(), inAccess->numRows()};
+
     auto src = cuda::CreateBorderWrapNHW<const T, B>(inData, cuda::SetAll<T>(borderValue));
     auto dst = cuda::CreateTensorWrapNHW<T>(outData);
 
     dim3 block(16, 16);
-    dim3 grid(divUp(dstSize.w, block.x), divUp(dstSize.h, block.y), outAccess->numSamples());
-
-    filter2D<<<grid, block, 0, stream>>>(src, dst, dstSize, kernel, kernelSize, kernelAnchor);
 
-    checkKernelErrors();
+    // the interior reads the input without border handling, only the strips around it use the border wrap
+    LaunchStencilRegions(dstSize, srcSize, int2{-kernelAnchor.x, -kernelAnchor.y},
+                         int2{kernelSize.w - 1 - kernelAnchor.x, kernelSize.h - 1 - kernelAnchor.y},
+                         [&](auto interior, StencilRegion region)
+                         {
+                             dim3 grid(divUp(region.size.w, block.x), divUp(region.size.h, block.y),
+                                       outAccess->numSamples());
+                             if constexpr (decltype(interior)::value)
+                             {
+                                 filter2D<<<grid, block, 0, stream>>>(src.tensorWrap(), dst, region, kernel,
+                                                                      kernelSize, kernelAnchor);
+                             }
+                             else
+                             {
+                                 filter2D<<<grid, block, 0, stream>>>(src, dst, region, kernel, kernelSize,
+                                                                      kernelAnchor);
+                             }
+                             checkKernelErrors();
+                         });
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
     checkCudaErrors(cudaGetLastError());
@@ -110,6 +162,173 @@ void Filter2D(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda
     }
 }
 
+// Separable filter ------------------------------------------------------------
+
+// Output tile computed by each block of the separable filter, the block has kSepTileW x kSepBlockH threads.
+constexpr int kSepTileW  = 32;
+constexpr int kSepTileH  = 16;
+constexpr int kSepBlockH = 8;
+
+// Maximum shared memory used by the separable filter, larger kernels use the 2D filter instead.
+constexpr size_t kSepMaxSharedMem = 48 * 1024;
+
+// Shared memory layout: row-filtered tile (work type), input tile with halo (T), then the 1D kernels (float).
+template<typename T>
+__host__ __device__ inline size_t SeparableTileOffset(Size2D kernelSize)
+{
+    using work_type = cuda::ConvertBaseTypeTo<float, T>;
+    return (kSepTileH + kernelSize.h - 1) * kSepTileW * sizeof(work_type);
+}
+
+template<typename T>
+__host__ __device__ inline size_t SeparableKernelOffset(Size2D kernelSize)
+{
+    size_t end = SeparableTileOffset<T>(kernelSize)
+               + (kSepTileH + kernelSize.h - 1) * (kSepTileW + kernelSize.w - 1) * sizeof(T);
+    return (end + alignof(float) - 1) / alignof(float) * alignof(float);
+}
+
+template<typename T>
+__host__ __device__ inline size_t SeparableSharedMemSize(Size2D kernelSize)
+{
+    return SeparableKernelOffset<T>(kernelSize) + (kernelSize.w + kernelSize.h) * sizeof(float);
+}
+
+template<class SrcWrapper, class DstWrapper>
+__global__ void filterSeparable(SrcWrapper src, DstWrapper dst, Size2D dstSize, const float *kernelX,
+                                const float *kernelY, Size2D kernelSize, int2 kernelAnchor)
+{
+    using T         = typename DstWrapper::ValueType;
+    using work_type = cuda::ConvertBaseTypeTo<float, T>;
+
+    extern __shared__ __align__(16) unsigned char smem[];
+
+    const int tileRows = kSepTileH + kernelSize.h - 1;
+    const int tileCols = kSepTileW + kernelSize.w - 1;
+
+    work_type *rowTile = reinterpret_cast<work_type *>(smem);
+    T         *inTile  = reinterpret_cast<T *>(smem + SeparableTileOffset<T>(kernelSize));
+    float     *kx      = reinterpret_cast<float *>(smem + SeparableKernelOffset<T>(kernelSize));
+    float     *ky      = kx + kernelSize.w;
+
+    const int tid       = threadIdx.y * blockDim.x + threadIdx.x;
+    const int nthreads  = blockDim.x * blockDim.y;
+    const int batch_idx = get_batch_idx();
+
+    const int x0 = blockIdx.x * kSepTileW;
+    const int y0 = blockIdx.y * kSepTileH;
+
+    // load the input tile with its halo, out-of-bounds pixels come from the border wrap
+    for (int i = tid; i < tileRows * tileCols; i += nthreads)
+    {
+        int3 coord{x0 - kernelAnchor.x + i % tileCols, y0 - kernelAnchor.y + i / tileCols, batch_idx};
+
+        inTile[i] = src[coord];
+    }
+    for (int i = tid; i < kernelSize.w + kernelSize.h; i += nthreads)
+    {
+        kx[i] = i < kernelSize.w ? kernelX[i] : kernelY[i - kernelSize.w];
+    }
+
+    __syncthreads();
+
+    // horizontal pass over all tile rows, including the vertical halo
+    for (int i = tid; i < tileRows * kSepTileW; i += nthreads)
+    {
+        const T   *in  = inTile + (i / kSepTileW) * tileCols + i % kSepTileW;
+        work_type  res = cuda::SetAll<work_type>(0);
+
+        for (int j = 0; j < kernelSize.w; ++j)
+        {
+            res = res + in[j] * kx[j];
+        }
+
+        rowTile[i] = res;
+    }
+
+    __syncthreads();
+
+    // vertical pass producing the output tile
+    const int x = x0 + threadIdx.x;
+
+    for (int ty = threadIdx.y; ty < kSepTileH; ty += blockDim.y)
+    {
+        const int y = y0 + ty;
+
+        if (x >= dstSize.w || y >= dstSize.h)
+            continue;
+
+        work_type res = cuda::SetAll<work_type>(0);
+
+        for (int j = 0; j < kernelSize.h; ++j)
+        {
+            res = res + rowTile[(ty + j) * kSepTileW + threadIdx.x] * ky[j];
+        }
+
+        *dst.ptr(batch_idx, y, x) = cuda::SaturateCast<T>(res);
+    }
+}
+
+template<typename T, NVCVBorderType B>
+void FilterSeparableCaller(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                           const float *kernelX, const float *kernelY, Size2D kernelSize, int2 kernelAnchor,
+                           float borderValue, cudaStream_t stream)
+{
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    Size2D dstSize{outAccess->numCols(), outAccess->numRows()};
+
+    auto src = cuda::CreateBorderWrapNHW<const T, B>(inData, cuda::SetAll<T>(borderValue));
+    auto dst = cuda::CreateTensorWrapNHW<T>(outData);
+
+    dim3 block(kSepTileW, kSepBlockH);
+    dim3 grid(divUp(dstSize.w, kSepTileW), divUp(dstSize.h, kSepTileH), outAccess->numSamples());
+
+    size_t smemSize = SeparableSharedMemSize<T>(kernelSize);
+
+    filterSeparable<<<grid, block, smemSize, stream>>>(src, dst, dstSize, kernelX, kernelY, kernelSize, kernelAnchor);
+
+    checkKernelErrors();
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
+// Returns false if the kernel is too large for the shared memory tiles, the caller must use Filter2D then.
+template<typename T>
+bool FilterSeparable(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                     const float *kernelX, const float *kernelY, Size2D kernelSize, int2 kernelAnchor,
+                     NVCVBorderType borderMode, float borderValue, cudaStream_t stream)
+{
+    if (SeparableSharedMemSize<T>(kernelSize) > kSepMaxSharedMem)
+    {
+        return false;
+    }
+
+    switch (borderMode)
+    {
+#define NVCV_FILTER_CASE(BORDERTYPE)                                                                      \
+    case BORDERTYPE:                                                                                      \
+        FilterSeparableCaller<T, BORDERTYPE>(inData, outData, kernelX, kernelY, kernelSize, kernelAnchor, \
+                                             borderValue, stream);                                        \
+        break
+
+        NVCV_FILTER_CASE(NVCV_BORDER_CONSTANT);
+        NVCV_FILTER_CASE(NVCV_BORDER_REPLICATE);
+        NVCV_FILTER_CASE(NVCV_BORDER_REFLECT);
+        NVCV_FILTER_CASE(NVCV_BORDER_WRAP);
+        NVCV_FILTER_CASE(NVCV_BORDER_REFLECT101);
+
+#undef NVCV_FILTER_CASE
+    default:
+        return false;
+    }
+
+    return true;
+}
+
 // Laplacian -------------------------------------------------------------------
 
 // @brief Laplacian 3x3 kernels for ksize == 1 and ksize == 3
@@ -227,8 +446,292 @@ ErrorCode Laplacian::infer(const ITensorDataStridedCuda &inData, const ITensorDa
     return ErrorCode::SUCCESS;
 }
 
+// Sobel -----------------------------------------------------------------------
+
+// Each thread computes both derivatives of one pixel in a single pass over its window, and writes any of them and
+// their magnitude, so requesting more outputs doesn't read the input again.
+template<int KSize, class SrcWrapper, class DstWrapper>
+__global__ void sobelKernel(SrcWrapper src, DstWrapper dx, DstWrapper dy, DstWrapper mag, bool writeDx, bool writeDy,
+                            bool writeMag, StencilRegion region, SobelKernels kernels)
+{
+    using T         = typename DstWrapper::ValueType;
+    using work_type = cuda::ConvertBaseTypeTo<float, T>;
+
+    const int tx        = blockIdx.x * blockDim.x + threadIdx.x;
+    const int ty        = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    if (tx >= region.size.w || ty >= region.size.h)
+        return;
+
+    const int x = region.offset.x + tx;
+    const int y = region.offset.y + ty;
+
+    work_type gx, gy;
+    SobelGradient<KSize>(src, int3{x, y, batch_idx}, kernels, gx, gy);
+
+    if (writeDx)
+    {
+        *dx.ptr(batch_idx, y, x) = cuda::SaturateCast<T>(gx);
+    }
+    if (writeDy)
+    {
+        *dy.ptr(batch_idx, y, x) = cuda::SaturateCast<T>(gy);
+    }
+    if (writeMag)
+    {
+        *mag.ptr(batch_idx, y, x) = cuda::SaturateCast<T>(cuda::sqrt(gx * gx + gy * gy));
+    }
+}
+
+template<class SrcWrapper, class DstWrapper>
+void SobelLaunch(dim3 grid, dim3 block, cudaStream_t stream, SrcWrapper src, DstWrapper dx, DstWrapper dy,
+                 DstWrapper mag, bool writeDx, bool writeDy, bool writeMag, StencilRegion region, SobelKernels kernels)
+{
+    switch (kernels.size)
+    {
+    case 3:
+        sobelKernel<3><<<grid, block, 0, stream>>>(src, dx, dy, mag, writeDx, writeDy, writeMag, region, kernels);
+        break;
+    case 5:
+        sobelKernel<5><<<grid, block, 0, stream>>>(src, dx, dy, mag, writeDx, writeDy, writeMag, region, kernels);
+        break;
+    case 7:
+        sobelKernel<7><<<grid, block, 0, stream>>>(src, dx, dy, mag, writeDx, writeDy, writeMag, region, kernels);
+        break;
+    default:
+        break;
+    }
+}
+
+template<typename T, typename D, NVCVBorderType B>
+void SobelCaller(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda *dxData,
+                 const ITensorDataStridedCuda *dyData, const ITensorDataStridedCuda *magData, SobelKernels kernels,
+                 cudaStream_t stream)
+{
+    using DT = cuda::ConvertBaseTypeTo<D, T>;
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    Size2D size{inAccess->numCols(), inAccess->numRows()};
+
+    auto src = cuda::CreateBorderWrapNHW<const T, B>(inData, cuda::SetAll<T>(0));
+
+    auto createDst = [](const ITensorDataStridedCuda *data)
+    {
+        return data ? cuda::CreateTensorWrapNHW<DT>(*data) : cuda::Tensor3DWrap<DT>();
+    };
+
+    auto dx  = createDst(dxData);
+    auto dy  = createDst(dyData);
+    auto mag = createDst(magData);
+
+    const int radius = kernels.size / 2;
+
+    dim3 block(16, 16);
+
+    // the interior reads the input without border handling, only the strips around it use the border wrap
+    LaunchStencilRegions(size, size, int2{-radius, -radius}, int2{radius, radius},
+                         [&](auto interior, StencilRegion region)
+                         {
+                             dim3 grid(divUp(region.size.w, block.x), divUp(region.size.h, block.y),
+                                       inAccess->numSamples());
+
+                             if constexpr (decltype(interior)::value)
+                             {
+                                 SobelLaunch(grid, block, stream, src.tensorWrap(), dx, dy, mag, dxData != nullptr,
+                                             dyData != nullptr, magData != nullptr, region, kernels);
+                             }
+                             else
+                             {
+                                 SobelLaunch(grid, block, stream, src, dx, dy, mag, dxData != nullptr,
+                                             dyData != nullptr, magData != nullptr, region, kernels);
+                             }
+                             checkKernelErrors();
+                         });
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
+template<typename T, typename D>
+void SobelFilter(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda *dxData,
+                 const ITensorDataStridedCuda *dyData, const ITensorDataStridedCuda *magData, SobelKernels kernels,
+                 NVCVBorderType borderMode, cudaStream_t stream)
+{
+    switch (borderMode)
+    {
+#define NVCV_SOBEL_BORDER_CASE(BORDERTYPE)                                               \
+    case BORDERTYPE:                                                                     \
+        SobelCaller<T, D, BORDERTYPE>(inData, dxData, dyData, magData, kernels, stream); \
+        break
+
+        NVCV_SOBEL_BORDER_CASE(NVCV_BORDER_CONSTANT);
+        NVCV_SOBEL_BORDER_CASE(NVCV_BORDER_REPLICATE);
+        NVCV_SOBEL_BORDER_CASE(NVCV_BORDER_REFLECT);
+        NVCV_SOBEL_BORDER_CASE(NVCV_BORDER_WRAP);
+        NVCV_SOBEL_BORDER_CASE(NVCV_BORDER_REFLECT101);
+
+#undef NVCV_SOBEL_BORDER_CASE
+    default:
+        break;
+    }
+}
+
+size_t Sobel::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode Sobel::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda *dxData,
+                       const ITensorDataStridedCuda *dyData, const ITensorDataStridedCuda *magData, int ksize,
+                       float scale, NVCVBorderType borderMode, cudaStream_t stream)
+{
+    if (!IsValidSobelSize(ksize))
+    {
+        LOG_ERROR("Invalid ksize " << ksize << ", it must be 1, 3, 5, 7 or -1 for Scharr");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (!(borderMode == NVCV_BORDER_REFLECT101 || borderMode == NVCV_BORDER_REPLICATE
+          || borderMode == NVCV_BORDER_CONSTANT || borderMode == NVCV_BORDER_REFLECT || borderMode == NVCV_BORDER_WRAP))
+    {
+        LOG_ERROR("Invalid borderMode " << borderMode);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    const ITensorDataStridedCuda *outData = dxData ? dxData : (dyData ? dyData : magData);
+    if (outData == nullptr)
+    {
+        LOG_ERROR("At least one of the dx, dy and magnitude outputs must be given");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    DataFormat format = GetLegacyDataFormat(inData.layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    for (const ITensorDataStridedCuda *data : {dxData, dyData, magData})
+    {
+        if (data == nullptr)
+        {
+            continue;
+        }
+        if (GetLegacyDataFormat(data->layout()) != format)
+        {
+            LOG_ERROR("Invalid DataFormat between input (" << format << ") and output ("
+                                                           << GetLegacyDataFormat(data->layout()) << ")");
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+        if (data->shape() != inData.shape())
+        {
+            LOG_ERROR("Invalid output shape " << data->shape() << ", it must be the input shape " << inData.shape());
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+        if (data->dtype() != outData->dtype())
+        {
+            LOG_ERROR("All outputs must have the same DataType");
+            return ErrorCode::INVALID_DATA_TYPE;
+        }
+    }
+
+    cuda_op::DataType data_type = GetLegacyDataType(inData.dtype());
+    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_16S || data_type == kCV_32F))
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    cuda_op::DataType out_data_type = GetLegacyDataType(outData->dtype());
+    if (!(out_data_type == kCV_16S || out_data_type == kCV_32F))
+    {
+        LOG_ERROR("Invalid output DataType " << out_data_type << ", it must be int16 or float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    const int channels = inAccess->numChannels();
+    if (!(channels == 1 || channels == 3 || channels == 4))
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (inAccess->numSamples() == 0 || inAccess->numRows() == 0 || inAccess->numCols() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*sobel_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda *dxData,
+                            const ITensorDataStridedCuda *dyData, const ITensorDataStridedCuda *magData,
+                            SobelKernels kernels, NVCVBorderType borderMode, cudaStream_t stream);
+
+    // clang-format off
+    static const sobel_t funcs[2][4][4] = {
+        {
+            { SobelFilter<uchar, short>, 0,  SobelFilter<uchar3, short>,  SobelFilter<uchar4, short>},
+            {SobelFilter<ushort, short>, 0, SobelFilter<ushort3, short>, SobelFilter<ushort4, short>},
+            { SobelFilter<short, short>, 0,  SobelFilter<short3, short>,  SobelFilter<short4, short>},
+            { SobelFilter<float, short>, 0,  SobelFilter<float3, short>,  SobelFilter<float4, short>},
+        },
+        {
+            { SobelFilter<uchar, float>, 0,  SobelFilter<uchar3, float>,  SobelFilter<uchar4, float>},
+            {SobelFilter<ushort, float>, 0, SobelFilter<ushort3, float>, SobelFilter<ushort4, float>},
+            { SobelFilter<short, float>, 0,  SobelFilter<short3, float>,  SobelFilter<short4, float>},
+            { SobelFilter<float, float>, 0,  SobelFilter<float3, float>,  SobelFilter<float4, float>},
+        },
+    };
+    // clang-format on
+
+    const int in_idx  = data_type == kCV_8U ? 0 : data_type == kCV_16U ? 1 : data_type == kCV_16S ? 2 : 3;
+    const int out_idx = out_data_type == kCV_16S ? 0 : 1;
+
+    funcs[out_idx][in_idx][channels - 1](inData, dxData, dyData, magData, GetSobelKernels(ksize, scale), borderMode,
+                                         stream);
+
+    return ErrorCode::SUCCESS;
+}
+
 // Gaussian --------------------------------------------------------------------
 
+// 1D kernels whose outer product is the normalized 2D kernel, used by the separable filter
+__global__ void CalculateSeparableGaussianKernel(float *kernelX, float *kernelY, Size2D kernelSize, double2 sigma)
+{
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (i >= kernelSize.w + kernelSize.h)
+    {
+        return;
+    }
+
+    bool   isX    = i < kernelSize.w;
+    int    size   = isX ? kernelSize.w : kernelSize.h;
+    double sig    = isX ? sigma.x : sigma.y;
+    float *kernel = isX ? kernelX : kernelY;
+    int    k      = isX ? i : i - kernelSize.w;
+
+    int   half = size / 2;
+    float s    = 2.f * sig * sig;
+
+    float sum = 0.f;
+
+    for (int x = -half; x <= half; ++x)
+    {
+        sum += cuda::exp(-(x * x) / s);
+    }
+
+    int x = k - half;
+
+    kernel[k] = cuda::exp(-(x * x) / s) / sum;
+}
+
 __global__ void CalculateGaussianKernel(float *kernel, Size2D kernelSize, double2 sigma)
 {
     int2 coord = cuda::StaticCast<int>(cuda::DropCast<2>(blockIdx * blockDim + threadIdx));
@@ -260,22 +763,75 @@ __global__ void CalculateGaussianKernel(float *kernel, Size2D kernelSize, double
     kernel[coord.y * kernelSize.w + coord.x] = cuda::exp(-((x * x) / sx + (y * y) / sy)) / (s * sum);
 }
 
-Gaussian::Gaussian(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize)
-    : CudaBaseOp(max_input_shape, max_output_shape)
-    , m_maxKernelSize(maxKernelSize)
+// Small square Gaussian kernels are computed on the host and passed by value to the unrolled 2D filter.
+// Returns false if the kernel size isn't K x K.
+template<int K>
+bool GaussianFixedSize(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                       cuda_op::DataType data_type, int channels, Size2D kernelSize, double2 sigma, int2 kernelAnchor,
+                       NVCVBorderType borderMode, float borderValue, cudaStream_t stream)
 {
-    NVCV_CHECK_THROW(cudaMalloc(&m_kernel, maxKernelSize.w * maxKernelSize.h * sizeof(float)));
+    if (kernelSize.w != K || kernelSize.h != K)
+    {
+        return false;
+    }
+
+    constexpr int half = K / 2;
+
+    float sx = 2.f * sigma.x * sigma.x;
+    float sy = 2.f * sigma.y * sigma.y;
+    float s  = 2.f * sigma.x * sigma.y * M_PI;
+
+    float sum = 0.f;
+
+    for (int y = -half; y <= half; ++y)
+    {
+        for (int x = -half; x <= half; ++x)
+        {
+            sum += std::exp(-((x * x) / sx + (y * y) / sy)) / s;
+        }
+    }
+
+    cuda::math::Vector<float, K * K> kernel;
+
+    for (int y = -half; y <= half; ++y)
+    {
+        for (int x = -half; x <= half; ++x)
+        {
+            kernel[(y + half) * K + (x + half)] = std::exp(-((x * x) / sx + (y * y) / sy)) / (s * sum);
+        }
+    }
+
+    typedef void (*filter2D_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                               cuda::math::Vector<float, K * K> kernel, Size2D kernelSize, int2 kernelAnchor,
+                               NVCVBorderType borderMode, float borderValue, cudaStream_t stream);
+
+    static const filter2D_t funcs[6][4] = {
+        { Filter2D<uchar>, 0,  Filter2D<uchar3>,  Filter2D<uchar4>},
+        {               0, 0,                 0,                 0},
+        {Filter2D<ushort>, 0, Filter2D<ushort3>, Filter2D<ushort4>},
+        { Filter2D<short>, 0,  Filter2D<short3>,  Filter2D<short4>},
+        {   Filter2D<int>, 0,    Filter2D<int3>,    Filter2D<int4>},
+        { Filter2D<float>, 0,  Filter2D<float3>,  Filter2D<float4>},
+    };
+
+    funcs[data_type][channels - 1](inData, outData, kernel, kernelSize, kernelAnchor, borderMode, borderValue,
+                                   stream);
+
+    return true;
 }
 
-Gaussian::~Gaussian()
+Gaussian::Gaussian(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_maxKernelSize(maxKernelSize)
 {
-    NVCV_CHECK_LOG(cudaFree(m_kernel));
+    setGpuWorkspaceSize(calBufferSize(max_input_shape, max_output_shape, kCV_32F, maxKernelSize));
 }
 
 size_t Gaussian::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type,
                                Size2D maxKernelSize)
 {
-    return maxKernelSize.w * maxKernelSize.h * sizeof(float);
+    // 2D kernel followed by the 1D kernels of the separable filter
+    return (maxKernelSize.w * maxKernelSize.h + maxKernelSize.w + maxKernelSize.h) * sizeof(float);
 }
 
 ErrorCode Gaussian::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
@@ -343,24 +899,50 @@ ErrorCode Gaussian::infer(const ITensorDataStridedCuda &inData, const ITensorDat
     sigma.x = std::max(sigma.x, 0.0);
     sigma.y = std::max(sigma.y, 0.0);
 
-    if (m_curSigma != sigma || m_curKernelSize != kernelSize)
+    const int channels = input_shape.C;
+
+    int2 kernelAnchor{-1, -1};
+    normalizeAnchor(kernelAnchor, kernelSize);
+    float borderValue = .0f;
+
+    if (GaussianFixedSize<3>(inData, outData, data_type, channels, kernelSize, sigma, kernelAnchor, borderMode,
+                             borderValue, stream)
+        || GaussianFixedSize<5>(inData, outData, data_type, channels, kernelSize, sigma, kernelAnchor, borderMode,
+                                borderValue, stream)
+        || GaussianFixedSize<7>(inData, outData, data_type, channels, kernelSize, sigma, kernelAnchor, borderMode,
+                                borderValue, stream))
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    // Only the kernels of kernelSize are allocated, the workspace grows if a larger size is used later
+    const int numKernelTaps = kernelSize.w * kernelSize.h + kernelSize.w + kernelSize.h;
+
+    GpuWorkspaceLease workspace = gpuWorkspace(stream, numKernelTaps * sizeof(float));
+    float            *kernel    = workspace.as<float>();
+    float            *kernelX   = kernel + kernelSize.w * kernelSize.h;
+    float            *kernelY   = kernelX + kernelSize.w;
+
+    LaunchPlanKey kernelKey;
+    kernelKey.add(kernelSize.w).add(kernelSize.h).add(sigma.x).add(sigma.y);
+
+    if (!gpuWorkspaceHolds(stream, kernelKey))
     {
         dim3 block(32, 4);
         dim3 grid(divUp(kernelSize.w, block.x), divUp(kernelSize.h, block.y));
 
-        CalculateGaussianKernel<<<grid, block, 0, stream>>>(m_kernel, kernelSize, sigma);
+        CalculateGaussianKernel<<<grid, block, 0, stream>>>(kernel, kernelSize, sigma);
 
         checkKernelErrors();
 
-        m_curKernelSize = kernelSize;
-        m_curSigma      = sigma;
-    }
+        int numTaps = kernelSize.w + kernelSize.h;
 
-    const int channels = input_shape.C;
+        CalculateSeparableGaussianKernel<<<divUp(numTaps, 128), 128, 0, stream>>>(kernelX, kernelY, kernelSize, sigma);
 
-    int2 kernelAnchor{-1, -1};
-    normalizeAnchor(kernelAnchor, kernelSize);
-    float borderValue = .0f;
+        checkKernelErrors();
+
+        setGpuWorkspaceContents(stream, kernelKey);
+    }
 
     typedef void (*filter2D_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
                                float *kernel, Size2D kernelSize, int2 kernelAnchor, NVCVBorderType borderMode,
@@ -375,8 +957,27 @@ ErrorCode Gaussian::infer(const ITensorDataStridedCuda &inData, const ITensorDat
         { Filter2D<float>, 0,  Filter2D<float3>,  Filter2D<float4>},
     };
 
-    funcs[data_type][channels - 1](inData, outData, m_kernel, kernelSize, kernelAnchor, borderMode, borderValue,
-                                   stream);
+    typedef bool (*filterSeparable_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                                      const float *kernelX, const float *kernelY, Size2D kernelSize,
+                                      int2 kernelAnchor, NVCVBorderType borderMode, float borderValue,
+                                      cudaStream_t stream);
+
+    static const filterSeparable_t funcsSeparable[6][4] = {
+        { FilterSeparable<uchar>, 0,  FilterSeparable<uchar3>,  FilterSeparable<uchar4>},
+        {                      0, 0,                        0,                        0},
+        {FilterSeparable<ushort>, 0, FilterSeparable<ushort3>, FilterSeparable<ushort4>},
+        { FilterSeparable<short>, 0,  FilterSeparable<short3>,  FilterSeparable<short4>},
+        {   FilterSeparable<int>, 0,    FilterSeparable<int3>,    FilterSeparable<int4>},
+        { FilterSeparable<float>, 0,  FilterSeparable<float3>,  FilterSeparable<float4>},
+    };
+
+    // the Gaussian kernel is separable, the 2D filter is only used when the tiles don't fit in shared memory
+    if (!funcsSeparable[data_type][channels - 1](inData, outData, kernelX, kernelY, kernelSize, kernelAnchor,
+                                                 borderMode, borderValue, stream))
+    {
+        funcs[data_type][channels - 1](inData, outData, kernel, kernelSize, kernelAnchor, borderMode, borderValue,
+                                       stream);
+    }
 
     return ErrorCode::SUCCESS;
 }
@@ -393,22 +994,31 @@ __global__ void compute_average_blur_kernel(float *kernel_ptr, int k_size)
     }
 }
 
-AverageBlur::AverageBlur(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize)
-    : CudaBaseOp(max_input_shape, max_output_shape)
-    , m_maxKernelSize(maxKernelSize)
+__global__ void compute_average_blur_separable_kernel(float *kernel_x, int k_width, float *kernel_y, int k_height)
 {
-    NVCV_CHECK_THROW(cudaMalloc(&m_kernel, maxKernelSize.w * maxKernelSize.h * sizeof(float)));
+    int tid = blockIdx.x * blockDim.x + threadIdx.x;
+    if (tid < k_width)
+    {
+        kernel_x[tid] = 1.0 / k_width;
+    }
+    else if (tid < k_width + k_height)
+    {
+        kernel_y[tid - k_width] = 1.0 / k_height;
+    }
 }
 
-AverageBlur::~AverageBlur()
+AverageBlur::AverageBlur(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_maxKernelSize(maxKernelSize)
 {
-    NVCV_CHECK_LOG(cudaFree(m_kernel));
+    setGpuWorkspaceSize(calBufferSize(max_input_shape, max_output_shape, kCV_32F, maxKernelSize));
 }
 
 size_t AverageBlur::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type,
                                   Size2D maxKernelSize)
 {
-    return maxKernelSize.w * maxKernelSize.h * sizeof(float);
+    // 2D kernel followed by the 1D kernels of the separable filter
+    return (maxKernelSize.w * maxKernelSize.h + maxKernelSize.w + maxKernelSize.h) * sizeof(float);
 }
 
 ErrorCode AverageBlur::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
@@ -494,19 +1104,56 @@ ErrorCode AverageBlur::infer(const ITensorDataStridedCuda &inData, const ITensor
         { Filter2D<float>, 0,  Filter2D<float3>,  Filter2D<float4>},
     };
 
-    if (m_curKernelSize != kernelSize)
+    typedef bool (*filterSeparable_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                                      const float *kernelX, const float *kernelY, Size2D kernelSize,
+                                      int2 kernelAnchor, NVCVBorderType borderMode, float borderValue,
+                                      cudaStream_t stream);
+
+    static const filterSeparable_t funcsSeparable[6][4] = {
+        { FilterSeparable<uchar>, 0,  FilterSeparable<uchar3>,  FilterSeparable<uchar4>},
+        {                      0, 0,                        0,                        0},
+        {FilterSeparable<ushort>, 0, FilterSeparable<ushort3>, FilterSeparable<ushort4>},
+        { FilterSeparable<short>, 0,  FilterSeparable<short3>,  FilterSeparable<short4>},
+        {   FilterSeparable<int>, 0,    FilterSeparable<int3>,    FilterSeparable<int4>},
+        { FilterSeparable<float>, 0,  FilterSeparable<float3>,  FilterSeparable<float4>},
+    };
+
+    // Only the kernels of kernelSize are allocated, the workspace grows if a larger size is used later
+    const int numKernelTaps = kernelSize.w * kernelSize.h + kernelSize.w + kernelSize.h;
+
+    GpuWorkspaceLease workspace = gpuWorkspace(stream, numKernelTaps * sizeof(float));
+    float            *kernel    = workspace.as<float>();
+    float            *kernelX   = kernel + kernelSize.w * kernelSize.h;
+    float            *kernelY   = kernelX + kernelSize.w;
+
+    LaunchPlanKey kernelKey;
+    kernelKey.add(kernelSize.w).add(kernelSize.h);
+
+    if (!gpuWorkspaceHolds(stream, kernelKey))
     {
         int k_size = kernelSize.h * kernelSize.w;
 
-        compute_average_blur_kernel<<<1, k_size, 0, stream>>>(m_kernel, k_size);
+        compute_average_blur_kernel<<<1, k_size, 0, stream>>>(kernel, k_size);
+
+        checkKernelErrors();
+
+        int numTaps = kernelSize.w + kernelSize.h;
+
+        compute_average_blur_separable_kernel<<<divUp(numTaps, 128), 128, 0, stream>>>(kernelX, kernelSize.w, kernelY,
+                                                                                       kernelSize.h);
 
         checkKernelErrors();
 
-        m_curKernelSize = kernelSize;
+        setGpuWorkspaceContents(stream, kernelKey);
     }
 
-    funcs[data_type][channels - 1](inData, outData, m_kernel, kernelSize, kernelAnchor, borderMode, borderValue,
-                                   stream);
+    // the box kernel is separable, the 2D filter is only used when the tiles don't fit in shared memory
+    if (!funcsSeparable[data_type][channels - 1](inData, outData, kernelX, kernelY, kernelSize, kernelAnchor,
+                                                 borderMode, borderValue, stream))
+    {
+        funcs[data_type][channels - 1](inData, outData, kernel, kernelSize, kernelAnchor, borderMode, borderValue,
+                                       stream);
+    }
 
     return ErrorCode::SUCCESS;
 }
@@ -25,23 +25,156 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "FlatTiles.cuh"
+#include "KernelVariants.hpp"
 
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
 
 namespace nvcv::legacy::cuda_op {
 
+// Runtime-channel variants ----------------------------------------------------
+
+// 2D convolution of images with any number of interleaved channels of type T, run for the pixel types without
+// kernels of their own, see KernelVariants.hpp.  Taps gives the size, anchor and weights of each sample's kernel.
+// It accumulates in the same order as the kernels of each op, so both give the same results.
+template<NVCVBorderType B, typename T, class Taps>
+__device__ void filter2DAnyChannelsPixel(const cuda::ImageBatchVarShapeWrapNHWC<const T> &src,
+                                         cuda::ImageBatchVarShapeWrapNHWC<T> &dst, T borderValue, const Taps &taps,
+                                         int batch_idx, int x, int y)
+{
+    constexpr int kMaxChannels = 4;
+
+    if (x >= dst.width(batch_idx) || y >= dst.height(batch_idx))
+        return;
+
+    const int  channels = dst.numChannels();
+    const int2 size{src.width(batch_idx), src.height(batch_idx)};
+    const int2 kernelSize = taps.size(batch_idx);
+    const int2 anchor     = taps.anchor(batch_idx, kernelSize);
+
+    float res[kMaxChannels] = {0.f, 0.f, 0.f, 0.f};
+
+    for (int i = 0; i < kernelSize.y; ++i)
+    {
+        for (int j = 0; j < kernelSize.x; ++j)
+        {
+            int2  coord{x - anchor.x + j, y - anchor.y + i};
+            float weight = taps(batch_idx, i, j);
+
+            const T *pixel = nullptr;
+            if constexpr (B == NVCV_BORDER_CONSTANT)
+            {
+                if (!cuda::IsOutside(coord.x, size.x) && !cuda::IsOutside(coord.y, size.y))
+                {
+                    pixel = src.ptr(batch_idx, coord.y, coord.x);
+                }
+            }
+            else
+            {
+                pixel = src.ptr(batch_idx, cuda::GetIndexWithBorder<B>(coord.y, size.y),
+                                cuda::GetIndexWithBorder<B>(coord.x, size.x));
+            }
+
+#pragma unroll
+            for (int c = 0; c < kMaxChannels; ++c)
+            {
+                if (c < channels)
+                {
+                    res[c] = res[c] + static_cast<float>(pixel ? pixel[c] : borderValue) * weight;
+                }
+            }
+        }
+    }
+
+    T *out = dst.ptr(batch_idx, y, x);
+#pragma unroll
+    for (int c = 0; c < kMaxChannels; ++c)
+    {
+        if (c < channels)
+        {
+            out[c] = cuda::SaturateCast<T>(res[c]);
+        }
+    }
+}
+
+template<NVCVBorderType B, typename T, class Taps>
+__global__ void filter2DAnyChannels(const cuda::ImageBatchVarShapeWrapNHWC<const T> src,
+                                    cuda::ImageBatchVarShapeWrapNHWC<T> dst, T borderValue, Taps taps)
+{
+    filter2DAnyChannelsPixel<B>(src, dst, borderValue, taps, get_batch_idx(), blockIdx.x * blockDim.x + threadIdx.x,
+                                blockIdx.y * blockDim.y + threadIdx.y);
+}
+
+// Per-pixel functor of the runtime-channel filter, launched over flat tiles, see FlatTiles.cuh.
+template<NVCVBorderType B, typename T, class Taps>
+struct Filter2DAnyChannelsPixelOp
+{
+    cuda::ImageBatchVarShapeWrapNHWC<const T> src;
+    cuda::ImageBatchVarShapeWrapNHWC<T>       dst;
+    T                                         borderValue;
+    Taps                                      taps;
+
+    __device__ void operator()(int batch_idx, int x, int y) const
+    {
+        cuda::ImageBatchVarShapeWrapNHWC<T> out = dst;
+        filter2DAnyChannelsPixel<B>(src, out, borderValue, taps, batch_idx, x, y);
+    }
+};
+
+template<typename T, NVCVBorderType B, class Taps>
+void Filter2DAnyChannelsCaller(const IImageBatchVarShapeDataStridedCuda &inData,
+                               const IImageBatchVarShapeDataStridedCuda &outData, const Taps &taps, float borderValue,
+                               bool flatTiles, cudaStream_t stream)
+{
+    const int channels = inData.uniqueFormat().numChannels();
+
+    cuda::ImageBatchVarShapeWrapNHWC<const T> src(inData, channels);
+    cuda::ImageBatchVarShapeWrapNHWC<T>       dst(outData, channels);
+
+    dim3 block(16, 16);
+
+    if (flatTiles && CanFlatTiles(outData.numImages(), block))
+    {
+        LaunchFlatTiles(Filter2DAnyChannelsPixelOp<B, T, Taps>{src, dst, static_cast<T>(borderValue), taps}, dst,
+                        outData.numImages(), outData.maxSize(), block, stream);
+    }
+    else
+    {
+        dim3 grid(divUp(inData.maxSize().w, block.x), divUp(inData.maxSize().h, block.y), outData.numImages());
+
+        filter2DAnyChannels<B><<<grid, block, 0, stream>>>(src, dst, static_cast<T>(borderValue), taps);
+    }
+    checkKernelErrors();
+}
+
+template<typename T, class Taps>
+void Filter2DAnyChannels(const IImageBatchVarShapeDataStridedCuda &inData,
+                         const IImageBatchVarShapeDataStridedCuda &outData, const Taps &taps,
+                         NVCVBorderType borderMode, float borderValue, bool flatTiles, cudaStream_t stream)
+{
+    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData,
+                           const IImageBatchVarShapeDataStridedCuda &outData, const Taps &taps, float borderValue,
+                           bool flatTiles, cudaStream_t stream);
+
+    static const func_t funcs[]
+        = {Filter2DAnyChannelsCaller<T, NVCV_BORDER_CONSTANT, Taps>,
+           Filter2DAnyChannelsCaller<T, NVCV_BORDER_REPLICATE, Taps>,
+           Filter2DAnyChannelsCaller<T, NVCV_BORDER_REFLECT, Taps>,
+           Filter2DAnyChannelsCaller<T, NVCV_BORDER_WRAP, Taps>,
+           Filter2DAnyChannelsCaller<T, NVCV_BORDER_REFLECT101, Taps>};
+
+    funcs[borderMode](inData, outData, taps, borderValue, flatTiles, stream);
+}
+
 template<class SrcWrapper, class DstWrapper>
-__global__ void filter2D(const SrcWrapper src, DstWrapper dst, cuda::ImageBatchVarShapeWrap<float> kernel,
-                         cuda::Tensor1DWrap<int2> kernelAnchor)
+inline __device__ void filter2DPixel(const SrcWrapper &src, const DstWrapper &dst,
+                                     const cuda::ImageBatchVarShapeWrap<float> &kernel,
+                                     const cuda::Tensor1DWrap<int2> &kernelAnchor, int batch_idx, int x, int y)
 {
     using work_type = cuda::ConvertBaseTypeTo<float, typename DstWrapper::ValueType>;
     work_type res   = cuda::SetAll<work_type>(0);
 
-    const int x         = blockIdx.x * blockDim.x + threadIdx.x;
-    const int y         = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
-
     if (x >= dst.width(batch_idx) || y >= dst.height(batch_idx))
         return;
 
@@ -72,10 +205,133 @@ __global__ void filter2D(const SrcWrapper src, DstWrapper dst, cuda::ImageBatchV
     *dst.ptr(batch_idx, y, x) = cuda::SaturateCast<typename DstWrapper::ValueType>(res);
 }
 
+template<class SrcWrapper, class DstWrapper>
+__global__ void filter2D(const SrcWrapper src, DstWrapper dst, cuda::ImageBatchVarShapeWrap<float> kernel,
+                         cuda::Tensor1DWrap<int2> kernelAnchor)
+{
+    filter2DPixel(src, dst, kernel, kernelAnchor, get_batch_idx(), blockIdx.x * blockDim.x + threadIdx.x,
+                  blockIdx.y * blockDim.y + threadIdx.y);
+}
+
+// Per-pixel functor of the flattened filter2D, see FlatTiles.cuh.
+template<class SrcWrapper, class DstWrapper>
+struct Filter2DPixelOp
+{
+    SrcWrapper                          src;
+    DstWrapper                          dst;
+    cuda::ImageBatchVarShapeWrap<float> kernel;
+    cuda::Tensor1DWrap<int2>            kernelAnchor;
+
+    __device__ void operator()(int batch_idx, int x, int y) const
+    {
+        filter2DPixel(src, dst, kernel, kernelAnchor, batch_idx, x, y);
+    }
+};
+
+// Side of the square block of threads, and of outputs, of the tiled 2D convolution.
+constexpr int kFilter2DTileBlock = 16;
+
+// Dynamic shared memory available to the tiled 2D convolution, larger kernels use the direct one.
+constexpr int kFilter2DTileMaxSharedMem = 48 * 1024;
+
+// Smaller kernels read too few taps per input pixel for the tile to pay off.
+constexpr int kFilter2DTileMinTaps = 7 * 7;
+
+// Number of kernel weights in shared memory, padded to keep the following tile 16-byte aligned.
+__host__ __device__ inline int Filter2DTileWeightCount(int numTaps)
+{
+    return (numTaps + 3) / 4 * 4;
+}
+
+// Dynamic shared memory of the tiled 2D convolution: the kernel weights followed by a tile of input pixels with
+// a halo of the kernel size.
+template<typename T>
+int Filter2DTileSharedMemSize(Size2D kernelSize)
+{
+    int tileWidth  = kFilter2DTileBlock + kernelSize.w - 1;
+    int tileHeight = kFilter2DTileBlock + kernelSize.h - 1;
+    return Filter2DTileWeightCount(kernelSize.w * kernelSize.h) * sizeof(float) + tileWidth * tileHeight * sizeof(T);
+}
+
+// Tiled variant of filter2D for large kernels.  The block loads the sample's kernel and the input of its tile plus
+// the kernel halo in shared memory once, instead of every tap reading both through global memory.  Taps are
+// accumulated in the same order as filter2D, so both give the same results.
+template<class SrcWrapper, class DstWrapper>
+__global__ void filter2DTiled(const SrcWrapper src, DstWrapper dst, cuda::ImageBatchVarShapeWrap<float> kernel,
+                              cuda::Tensor1DWrap<int2> kernelAnchor)
+{
+    using T         = typename DstWrapper::ValueType;
+    using work_type = cuda::ConvertBaseTypeTo<float, T>;
+
+    extern __shared__ __align__(16) unsigned char smem[];
+
+    const int batch_idx = get_batch_idx();
+    const int x0        = blockIdx.x * kFilter2DTileBlock;
+    const int y0        = blockIdx.y * kFilter2DTileBlock;
+
+    // The whole block is outside images smaller than the largest one
+    if (x0 >= dst.width(batch_idx) || y0 >= dst.height(batch_idx))
+        return;
+
+    int2 anchor = kernelAnchor[batch_idx];
+
+    int2 kernelSize{kernel.width(batch_idx), kernel.height(batch_idx)};
+
+    if (anchor.x < 0)
+        anchor.x = kernelSize.x / 2;
+
+    if (anchor.y < 0)
+        anchor.y = kernelSize.y / 2;
+
+    const int numTaps    = kernelSize.x * kernelSize.y;
+    const int tileWidth  = kFilter2DTileBlock + kernelSize.x - 1;
+    const int tileHeight = kFilter2DTileBlock + kernelSize.y - 1;
+    const int tid        = threadIdx.y * blockDim.x + threadIdx.x;
+    const int numThreads = blockDim.x * blockDim.y;
+
+    float *weights = reinterpret_cast<float *>(smem);
+    T     *tile    = reinterpret_cast<T *>(weights + Filter2DTileWeightCount(numTaps));
+
+    for (int i = tid; i < numTaps; i += numThreads)
+    {
+        weights[i] = *kernel.ptr(batch_idx, i / kernelSize.x, i % kernelSize.x);
+    }
+
+    for (int i = tid; i < tileWidth * tileHeight; i += numThreads)
+    {
+        int3 srcCoord{x0 - anchor.x + i % tileWidth, y0 - anchor.y + i / tileWidth, batch_idx};
+        tile[i] = src[srcCoord];
+    }
+
+    __syncthreads();
+
+    const int x = x0 + threadIdx.x;
+    const int y = y0 + threadIdx.y;
+
+    if (x >= dst.width(batch_idx) || y >= dst.height(batch_idx))
+        return;
+
+    work_type res = cuda::SetAll<work_type>(0);
+
+    for (int i = 0; i < kernelSize.y; ++i)
+    {
+        const T     *tileRow   = tile + (threadIdx.y + i) * tileWidth + threadIdx.x;
+        const float *weightRow = weights + i * kernelSize.x;
+
+        for (int j = 0; j < kernelSize.x; ++j)
+        {
+            res = res + tileRow[j] * weightRow[j];
+        }
+    }
+
+    *dst.ptr(batch_idx, y, x) = cuda::SaturateCast<T>(res);
+}
+
 template<typename D, NVCVBorderType B>
 void Filter2DCaller(const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
                     const IImageBatchVarShapeDataStridedCuda &kernelData,
-                    const ITensorDataStridedCuda &kernelAnchorData, float borderValue, cudaStream_t stream)
+                    const ITensorDataStridedCuda &kernelAnchorData, float borderValue, bool flatTiles,
+                    cudaStream_t stream)
 {
     cuda::BorderVarShapeWrap<const D, B> src(inData, cuda::SetAll<D>(borderValue));
     cuda::ImageBatchVarShapeWrap<D>      dst(outData);
@@ -92,7 +348,25 @@ void Filter2DCaller(const IImageBatchVarShapeDataStridedCuda &inData, const IIma
     checkCudaErrors(cudaGetLastError());
 #endif
 
-    filter2D<<<grid, block, 0, stream>>>(src, dst, kernel, kernelAnchor);
+    const Size2D maxKernelSize = kernelData.maxSize();
+    const int    tileSmem      = Filter2DTileSharedMemSize<D>(maxKernelSize);
+    if (maxKernelSize.w * maxKernelSize.h >= kFilter2DTileMinTaps && tileSmem <= kFilter2DTileMaxSharedMem)
+    {
+        dim3 tileBlock(kFilter2DTileBlock, kFilter2DTileBlock);
+        dim3 tileGrid(divUp(outData.maxSize().w, tileBlock.x), divUp(outData.maxSize().h, tileBlock.y),
+                      outData.numImages());
+
+        filter2DTiled<<<tileGrid, tileBlock, tileSmem, stream>>>(src, dst, kernel, kernelAnchor);
+    }
+    else if (flatTiles && CanFlatTiles(outData.numImages(), block))
+    {
+        LaunchFlatTiles(Filter2DPixelOp<decltype(src), decltype(dst)>{src, dst, kernel, kernelAnchor}, dst,
+                        outData.numImages(), outData.maxSize(), block, stream);
+    }
+    else
+    {
+        filter2D<<<grid, block, 0, stream>>>(src, dst, kernel, kernelAnchor);
+    }
     checkKernelErrors();
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
@@ -100,21 +374,66 @@ void Filter2DCaller(const IImageBatchVarShapeDataStridedCuda &inData, const IIma
 #endif
 }
 
+// Kernels given as images, with anchors where negative ones are the center.
+struct Conv2DTaps
+{
+    cuda::ImageBatchVarShapeWrap<float> kernel;
+    cuda::Tensor1DWrap<int2>            kernelAnchor;
+
+    __device__ int2 size(int batch_idx) const
+    {
+        return {kernel.width(batch_idx), kernel.height(batch_idx)};
+    }
+
+    __device__ int2 anchor(int batch_idx, int2 kernelSize) const
+    {
+        int2 anchor = kernelAnchor[batch_idx];
+        return {anchor.x < 0 ? kernelSize.x / 2 : anchor.x, anchor.y < 0 ? kernelSize.y / 2 : anchor.y};
+    }
+
+    __device__ float operator()(int batch_idx, int i, int j) const
+    {
+        return *kernel.ptr(batch_idx, i, j);
+    }
+};
+
+// Conv2D of any number of channels of type BT, for the pixel types without kernels of their own, e.g. 2 channels.
+template<typename BT>
+void Filter2DAnyChannelsOf(const IImageBatchVarShapeDataStridedCuda &inData,
+                           const IImageBatchVarShapeDataStridedCuda &outData,
+                           const IImageBatchVarShapeDataStridedCuda &kernelData,
+                           const ITensorDataStridedCuda &kernelAnchorData, NVCVBorderType borderMode, float borderValue,
+                           bool flatTiles, cudaStream_t stream)
+{
+    Conv2DTaps taps{cuda::ImageBatchVarShapeWrap<float>(kernelData), cuda::Tensor1DWrap<int2>(kernelAnchorData)};
+    Filter2DAnyChannels<BT>(inData, outData, taps, borderMode, borderValue, flatTiles, stream);
+}
+
 template<typename D>
 void Filter2D(const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
               const IImageBatchVarShapeDataStridedCuda &kernelData, const ITensorDataStridedCuda &kernelAnchorData,
-              NVCVBorderType borderMode, float borderValue, cudaStream_t stream)
+              NVCVBorderType borderMode, float borderValue, bool flatTiles, cudaStream_t stream)
 {
-    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData,
-                           const IImageBatchVarShapeDataStridedCuda &outData,
-                           const IImageBatchVarShapeDataStridedCuda &kernelData,
-                           const ITensorDataStridedCuda &kernelAnchorData, float borderValue, cudaStream_t stream);
+    if constexpr (!IsKernelVariantEnabled<D>)
+    {
+        Filter2DAnyChannelsOf<cuda::BaseType<D>>(inData, outData, kernelData, kernelAnchorData, borderMode,
+                                                 borderValue, flatTiles, stream);
+    }
+    else
+    {
+        typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData,
+                               const IImageBatchVarShapeDataStridedCuda &outData,
+                               const IImageBatchVarShapeDataStridedCuda &kernelData,
+                               const ITensorDataStridedCuda &kernelAnchorData, float borderValue, bool flatTiles,
+                               cudaStream_t stream);
 
-    static const func_t funcs[] = {Filter2DCaller<D, NVCV_BORDER_CONSTANT>, Filter2DCaller<D, NVCV_BORDER_REPLICATE>,
-                                   Filter2DCaller<D, NVCV_BORDER_REFLECT>, Filter2DCaller<D, NVCV_BORDER_WRAP>,
-                                   Filter2DCaller<D, NVCV_BORDER_REFLECT101>};
+        static const func_t funcs[]
+            = {Filter2DCaller<D, NVCV_BORDER_CONSTANT>, Filter2DCaller<D, NVCV_BORDER_REPLICATE>,
+               Filter2DCaller<D, NVCV_BORDER_REFLECT>, Filter2DCaller<D, NVCV_BORDER_WRAP>,
+               Filter2DCaller<D, NVCV_BORDER_REFLECT101>};
 
-    funcs[borderMode](inData, outData, kernelData, kernelAnchorData, borderValue, stream);
+        funcs[borderMode](inData, outData, kernelData, kernelAnchorData, borderValue, flatTiles, stream);
+    }
 }
 
 // Conv2DVarShape --------------------------------------------------------------
@@ -123,7 +442,7 @@ ErrorCode Conv2DVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData
                                 const IImageBatchVarShapeDataStridedCuda &outData,
                                 const IImageBatchVarShapeDataStridedCuda &kernelData,
                                 const ITensorDataStridedCuda &kernelAnchorData, NVCVBorderType borderMode,
-                                cudaStream_t stream)
+                                cudaStream_t stream, bool flatTiles)
 {
     DataFormat input_format  = helpers::GetLegacyDataFormat(inData);
     DataFormat output_format = helpers::GetLegacyDataFormat(outData);
@@ -171,27 +490,45 @@ ErrorCode Conv2DVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData
         return ErrorCode::INVALID_DATA_SHAPE;
     }
 
+    const Size2D maxKernelSize = kernelData.maxSize();
+    const bool   fftFits       = maxKernelSize.w <= FFTCorrelator::kMaxKernelSize
+                        && maxKernelSize.h <= FFTCorrelator::kMaxKernelSize;
+
+    if (m_algorithm == NVCV_CONV2D_ALGO_FFT && !fftFits)
+    {
+        LOG_ERROR("Invalid kernel size " << maxKernelSize << ", the FFT algorithm supports kernels up to "
+                                         << FFTCorrelator::kMaxKernelSize << " taps per side");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (fftFits
+        && (m_algorithm == NVCV_CONV2D_ALGO_FFT
+            || (m_algorithm == NVCV_CONV2D_ALGO_AUTO && maxKernelSize.w * maxKernelSize.h >= kFFTMinKernelArea)))
+    {
+        return inferFFT(inData, outData, kernelData, kernelAnchorData, borderMode, data_type, channels, stream);
+    }
+
     float borderValue = .0f;
 
     typedef void (*filter2D_t)(
         const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
         const IImageBatchVarShapeDataStridedCuda &kernelData, const ITensorDataStridedCuda &kernelAnchorData,
-        NVCVBorderType borderMode, float borderValue, cudaStream_t stream);
+        NVCVBorderType borderMode, float borderValue, bool flatTiles, cudaStream_t stream);
 
     static const filter2D_t funcs[6][4] = {
-        { Filter2D<uchar>, 0,  Filter2D<uchar3>,  Filter2D<uchar4>},
-        {               0, 0,                 0,                 0},
-        {Filter2D<ushort>, 0, Filter2D<ushort3>, Filter2D<ushort4>},
-        { Filter2D<short>, 0,  Filter2D<short3>,  Filter2D<short4>},
-        {   Filter2D<int>, 0,    Filter2D<int3>,    Filter2D<int4>},
-        { Filter2D<float>, 0,  Filter2D<float3>,  Filter2D<float4>},
+        { Filter2D<uchar>,  Filter2DAnyChannelsOf<uchar>,  Filter2D<uchar3>,  Filter2D<uchar4>},
+        {               0,                             0,                 0,                 0},
+        {Filter2D<ushort>, Filter2DAnyChannelsOf<ushort>, Filter2D<ushort3>, Filter2D<ushort4>},
+        { Filter2D<short>,  Filter2DAnyChannelsOf<short>,  Filter2D<short3>,  Filter2D<short4>},
+        {   Filter2D<int>,    Filter2DAnyChannelsOf<int>,    Filter2D<int3>,    Filter2D<int4>},
+        { Filter2D<float>,  Filter2DAnyChannelsOf<float>,  Filter2D<float3>,  Filter2D<float4>},
     };
 
     const filter2D_t func = funcs[data_type][channels - 1];
 
     NVCV_ASSERT(func != 0);
 
-    func(inData, outData, kernelData, kernelAnchorData, borderMode, borderValue, stream);
+    func(inData, outData, kernelData, kernelAnchorData, borderMode, borderValue, flatTiles, stream);
 
     return ErrorCode::SUCCESS;
 }
@@ -288,22 +625,57 @@ void LaplacianFilter2DCaller(const IImageBatchVarShapeDataStridedCuda &inData,
 #endif
 }
 
+// 3x3 Laplacian kernels of each sample's ksize, scaled.
+struct LaplacianTaps
+{
+    cuda::Tensor1DWrap<int>   ksize;
+    cuda::Tensor1DWrap<float> scale;
+
+    __device__ int2 size(int) const
+    {
+        return {3, 3};
+    }
+
+    __device__ int2 anchor(int, int2) const
+    {
+        return {1, 1};
+    }
+
+    __device__ float operator()(int batch_idx, int i, int j) const
+    {
+        const int ksizeVal = ksize[batch_idx];
+
+        NVCV_CUDA_ASSERT(ksizeVal == 1 || ksizeVal == 3, "E Wrong ksize = %d, expected: 1 or 3", ksizeVal);
+        const auto &kernel = ksizeVal == 1 ? kLaplacianKernel1 : kLaplacianKernel3;
+
+        return kernel[i * 3 + j] * scale[batch_idx];
+    }
+};
+
 template<typename D>
 void LaplacianFilter2D(const IImageBatchVarShapeDataStridedCuda &inData,
                        const IImageBatchVarShapeDataStridedCuda &outData, const ITensorDataStridedCuda &ksize,
                        const ITensorDataStridedCuda &scale, NVCVBorderType borderMode, float borderValue,
                        cudaStream_t stream)
 {
-    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData,
-                           const IImageBatchVarShapeDataStridedCuda &outData, const ITensorDataStridedCuda &ksize,
-                           const ITensorDataStridedCuda &scale, float borderValue, cudaStream_t stream);
+    if constexpr (!IsKernelVariantEnabled<D>)
+    {
+        LaplacianTaps taps{cuda::Tensor1DWrap<int>(ksize), cuda::Tensor1DWrap<float>(scale)};
+        Filter2DAnyChannels<cuda::BaseType<D>>(inData, outData, taps, borderMode, borderValue, false, stream);
+    }
+    else
+    {
+        typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData,
+                               const IImageBatchVarShapeDataStridedCuda &outData, const ITensorDataStridedCuda &ksize,
+                               const ITensorDataStridedCuda &scale, float borderValue, cudaStream_t stream);
 
-    static const func_t funcs[]
-        = {LaplacianFilter2DCaller<D, NVCV_BORDER_CONSTANT>, LaplacianFilter2DCaller<D, NVCV_BORDER_REPLICATE>,
-           LaplacianFilter2DCaller<D, NVCV_BORDER_REFLECT>, LaplacianFilter2DCaller<D, NVCV_BORDER_WRAP>,
-           LaplacianFilter2DCaller<D, NVCV_BORDER_REFLECT101>};
+        static const func_t funcs[]
+            = {LaplacianFilter2DCaller<D, NVCV_BORDER_CONSTANT>, LaplacianFilter2DCaller<D, NVCV_BORDER_REPLICATE>,
+               LaplacianFilter2DCaller<D, NVCV_BORDER_REFLECT>, LaplacianFilter2DCaller<D, NVCV_BORDER_WRAP>,
+               LaplacianFilter2DCaller<D, NVCV_BORDER_REFLECT101>};
 
-    funcs[borderMode](inData, outData, ksize, scale, borderValue, stream);
+        funcs[borderMode](inData, outData, ksize, scale, borderValue, stream);
+    }
 }
 
 ErrorCode LaplacianVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
@@ -383,62 +755,77 @@ ErrorCode LaplacianVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inD
 
 // GaussianVarShape ------------------------------------------------------------
 
-__global__ void CalculateGaussianKernel(cuda::Tensor3DWrap<float> kernel, int dataKernelSize, Size2D maxKernelSize,
-                                        cuda::Tensor1DWrap<int2> kernelSizeArr, cuda::Tensor1DWrap<double2> sigmaArr)
+// Each sample's horizontal taps are followed by its vertical taps, the 2D kernel is their outer product.
+__global__ void CalculateSeparableGaussianKernel(cuda::Tensor2DWrap<float> kernel, Size2D maxKernelSize,
+                                                 cuda::Tensor1DWrap<int2> kernelSizeArr,
+                                                 cuda::Tensor1DWrap<double2> sigmaArr)
 {
-    int3 coord = cuda::StaticCast<int>(blockIdx * blockDim + threadIdx);
+    int i         = blockIdx.x * blockDim.x + threadIdx.x;
+    int batch_idx = blockIdx.y;
 
-    int2 kernelSize = kernelSizeArr[coord.z];
+    int2 kernelSize = kernelSizeArr[batch_idx];
 
-    if (coord.x >= kernelSize.x || coord.y >= kernelSize.y)
+    bool isX  = i < maxKernelSize.w;
+    int  size = isX ? kernelSize.x : kernelSize.y;
+    int  k    = isX ? i : i - maxKernelSize.w;
+
+    if (i >= maxKernelSize.w + maxKernelSize.h || k >= size)
     {
         return;
     }
 
-    double2 sigma = sigmaArr[coord.z];
-
-    if (sigma.y <= 0)
-        sigma.y = sigma.x;
-
-    // automatic detection of kernel size from sigma
-    if (kernelSize.x <= 0 && sigma.x > 0)
-        kernelSize.x = cuda::round<int>(sigma.x * dataKernelSize * 2 + 1) | 1;
-    if (kernelSize.y <= 0 && sigma.y > 0)
-        kernelSize.y = cuda::round<int>(sigma.y * dataKernelSize * 2 + 1) | 1;
-
     NVCV_CUDA_ASSERT(kernelSize.x > 0 && (kernelSize.x % 2 == 1) && kernelSize.x <= maxKernelSize.w,
                      "E Wrong kernelSize.x = %d, expected > 0, odd and <= %d\n", kernelSize.x, maxKernelSize.w);
     NVCV_CUDA_ASSERT(kernelSize.y > 0 && (kernelSize.y % 2 == 1) && kernelSize.y <= maxKernelSize.h,
                      "E Wrong kernelSize.y = %d, expected > 0, odd and <= %d\n", kernelSize.y, maxKernelSize.h);
 
-    int2 half{kernelSize.x / 2, kernelSize.y / 2};
+    double2 sigma = sigmaArr[batch_idx];
 
-    sigma.x = cuda::max(sigma.x, 0.0);
-    sigma.y = cuda::max(sigma.y, 0.0);
+    if (sigma.y <= 0)
+        sigma.y = sigma.x;
+
+    double sig = cuda::max(isX ? sigma.x : sigma.y, 0.0);
 
-    float sx = 2.f * sigma.x * sigma.x;
-    float sy = 2.f * sigma.y * sigma.y;
-    float s  = 2.f * sigma.x * sigma.y * M_PI;
+    int   half = size / 2;
+    float s    = 2.f * sig * sig;
 
     float sum = 0.f;
 
-    for (int y = -half.y; y <= half.y; ++y)
+    for (int x = -half; x <= half; ++x)
     {
-        for (int x = -half.x; x <= half.x; ++x)
-        {
-            sum += cuda::exp(-((x * x) / sx + (y * y) / sy)) / s;
-        }
+        sum += cuda::exp(-(x * x) / s);
     }
 
-    int x = coord.x - half.x;
-    int y = coord.y - half.y;
+    int x = k - half;
 
-    kernel[coord] = cuda::exp(-((x * x) / sx + (y * y) / sy)) / (s * sum);
+    *kernel.ptr(batch_idx, i) = cuda::exp(-(x * x) / s) / sum;
 }
 
+// Gaussian kernels computed in the workspace, from their separable taps.
+struct GaussianTaps
+{
+    cuda::Tensor2DWrap<float> kernel;
+    cuda::Tensor1DWrap<int2>  kernelSize;
+    int                       maxKernelWidth;
+
+    __device__ int2 size(int batch_idx) const
+    {
+        return kernelSize[batch_idx];
+    }
+
+    __device__ int2 anchor(int batch_idx, int2 size) const
+    {
+        return int2{size.x / 2, size.y / 2};
+    }
+
+    __device__ float operator()(int batch_idx, int i, int j) const
+    {
+        return *kernel.ptr(batch_idx, j) * *kernel.ptr(batch_idx, maxKernelWidth + i);
+    }
+};
+
 template<class SrcWrapper, class DstWrapper>
-__global__ void gaussianFilter2D(const SrcWrapper src, DstWrapper dst, cuda::Tensor3DWrap<float> kernel,
-                                 cuda::Tensor1DWrap<int2> kernelSizeArr)
+__global__ void gaussianFilter2D(const SrcWrapper src, DstWrapper dst, GaussianTaps taps)
 {
     using work_type = cuda::ConvertBaseTypeTo<float, typename DstWrapper::ValueType>;
     work_type res   = cuda::SetAll<work_type>(0);
@@ -450,9 +837,8 @@ __global__ void gaussianFilter2D(const SrcWrapper src, DstWrapper dst, cuda::Ten
     if (x >= dst.width(batch_idx) || y >= dst.height(batch_idx))
         return;
 
-    int2 kernelSize = kernelSizeArr[batch_idx];
-
-    int2 anchor{kernelSize.x / 2, kernelSize.y / 2};
+    int2 kernelSize = taps.size(batch_idx);
+    int2 anchor     = taps.anchor(batch_idx, kernelSize);
 
     int3 srcCoord{0, 0, batch_idx};
 
@@ -464,7 +850,7 @@ __global__ void gaussianFilter2D(const SrcWrapper src, DstWrapper dst, cuda::Ten
         {
             srcCoord.x = x - anchor.x + j;
 
-            res = res + src[srcCoord] * (*kernel.ptr(batch_idx, i, j));
+            res = res + src[srcCoord] * taps(batch_idx, i, j);
         }
     }
 
@@ -473,9 +859,8 @@ __global__ void gaussianFilter2D(const SrcWrapper src, DstWrapper dst, cuda::Ten
 
 template<typename D, NVCVBorderType B>
 void GaussianFilter2DCaller(const IImageBatchVarShapeDataStridedCuda &inData,
-                            const IImageBatchVarShapeDataStridedCuda &outData,
-                            const cuda::Tensor3DWrap<float>          &kernelTensor,
-                            const cuda::Tensor1DWrap<int2> &kernelSizeTensor, float borderValue, cudaStream_t stream)
+                            const IImageBatchVarShapeDataStridedCuda &outData, const GaussianTaps &taps,
+                            float borderValue, cudaStream_t stream)
 {
     cuda::BorderVarShapeWrap<const D, B> src(inData, cuda::SetAll<D>(borderValue));
     cuda::ImageBatchVarShapeWrap<D>      dst(outData);
@@ -490,7 +875,7 @@ void GaussianFilter2DCaller(const IImageBatchVarShapeDataStridedCuda &inData,
     checkCudaErrors(cudaGetLastError());
 #endif
 
-    gaussianFilter2D<<<grid, block, 0, stream>>>(src, dst, kernelTensor, kernelSizeTensor);
+    gaussianFilter2D<<<grid, block, 0, stream>>>(src, dst, taps);
     checkKernelErrors();
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
@@ -498,23 +883,52 @@ void GaussianFilter2DCaller(const IImageBatchVarShapeDataStridedCuda &inData,
 #endif
 }
 
+// Kernels computed in the workspace, centered, or anchored where the anchors are given.
+struct WorkspaceTaps
+{
+    cuda::Tensor3DWrap<float> kernel;
+    cuda::Tensor1DWrap<int2>  kernelSize;
+    cuda::Tensor1DWrap<int2>  kernelAnchor;
+    bool                      hasAnchor;
+
+    __device__ int2 size(int batch_idx) const
+    {
+        return kernelSize[batch_idx];
+    }
+
+    __device__ int2 anchor(int batch_idx, int2 size) const
+    {
+        return hasAnchor ? kernelAnchor[batch_idx] : int2{size.x / 2, size.y / 2};
+    }
+
+    __device__ float operator()(int batch_idx, int i, int j) const
+    {
+        return *kernel.ptr(batch_idx, i, j);
+    }
+};
+
 template<typename D>
 void GaussianFilter2D(const IImageBatchVarShapeDataStridedCuda &inData,
-                      const IImageBatchVarShapeDataStridedCuda &outData, const cuda::Tensor3DWrap<float> &kernelTensor,
-                      const cuda::Tensor1DWrap<int2> &kernelSizeTensor, NVCVBorderType borderMode, float borderValue,
-                      cudaStream_t stream)
+                      const IImageBatchVarShapeDataStridedCuda &outData, const GaussianTaps &taps,
+                      NVCVBorderType borderMode, float borderValue, cudaStream_t stream)
 {
-    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData,
-                           const IImageBatchVarShapeDataStridedCuda &outData,
-                           const cuda::Tensor3DWrap<float>          &kernelTensor,
-                           const cuda::Tensor1DWrap<int2> &kernelSizeTensor, float borderValue, cudaStream_t stream);
+    if constexpr (!IsKernelVariantEnabled<D>)
+    {
+        Filter2DAnyChannels<cuda::BaseType<D>>(inData, outData, taps, borderMode, borderValue, false, stream);
+    }
+    else
+    {
+        typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData,
+                               const IImageBatchVarShapeDataStridedCuda &outData, const GaussianTaps &taps,
+                               float borderValue, cudaStream_t stream);
 
-    static const func_t funcs[]
-        = {GaussianFilter2DCaller<D, NVCV_BORDER_CONSTANT>, GaussianFilter2DCaller<D, NVCV_BORDER_REPLICATE>,
-           GaussianFilter2DCaller<D, NVCV_BORDER_REFLECT>, GaussianFilter2DCaller<D, NVCV_BORDER_WRAP>,
-           GaussianFilter2DCaller<D, NVCV_BORDER_REFLECT101>};
+        static const func_t funcs[]
+            = {GaussianFilter2DCaller<D, NVCV_BORDER_CONSTANT>, GaussianFilter2DCaller<D, NVCV_BORDER_REPLICATE>,
+               GaussianFilter2DCaller<D, NVCV_BORDER_REFLECT>, GaussianFilter2DCaller<D, NVCV_BORDER_WRAP>,
+               GaussianFilter2DCaller<D, NVCV_BORDER_REFLECT101>};
 
-    funcs[borderMode](inData, outData, kernelTensor, kernelSizeTensor, borderValue, stream);
+        funcs[borderMode](inData, outData, taps, borderValue, stream);
+    }
 }
 
 GaussianVarShape::GaussianVarShape(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize,
@@ -525,18 +939,13 @@ GaussianVarShape::GaussianVarShape(DataShape max_input_shape, DataShape max_outp
 {
     if (maxBatchSize > 0)
     {
-        NVCV_CHECK_THROW(cudaMalloc(&m_kernel, maxKernelSize.w * maxKernelSize.h * maxBatchSize * sizeof(float)));
+        setGpuWorkspaceSize(calBufferSize(maxKernelSize, maxBatchSize));
     }
 }
 
-GaussianVarShape::~GaussianVarShape()
-{
-    NVCV_CHECK_LOG(cudaFree(m_kernel));
-}
-
 size_t GaussianVarShape::calBufferSize(Size2D maxKernelSize, int maxBatchSize)
 {
-    return maxKernelSize.w * maxKernelSize.h * maxBatchSize * sizeof(float);
+    return (maxKernelSize.w + maxKernelSize.h) * maxBatchSize * sizeof(float);
 }
 
 ErrorCode GaussianVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
@@ -598,28 +1007,30 @@ ErrorCode GaussianVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inDa
 
     float borderValue = .0f;
 
-    int dataKernelSize = (data_type == kCV_8U ? 3 : 4);
-
-    dim3 block(32, 4);
-    dim3 grid(divUp(m_maxKernelSize.w, block.x), divUp(m_maxKernelSize.h, block.y), outData.numImages());
+    // Only the separable taps are computed, the filter multiplies them
+    const int numTaps = m_maxKernelSize.w + m_maxKernelSize.h;
 
     cuda::Tensor1DWrap<int2>    kernelSizeTensor(kernelSize);
     cuda::Tensor1DWrap<double2> sigmaTensor(sigma);
 
-    int kernelPitch2 = static_cast<int>(m_maxKernelSize.w * sizeof(float));
-    int kernelPitch1 = m_maxKernelSize.h * kernelPitch2;
+    GpuWorkspaceLease workspace = gpuWorkspace(stream, calBufferSize(m_maxKernelSize, outData.numImages()));
+    void             *kernelMem = workspace.get();
+
+    cuda::Tensor2DWrap<float> kernelTensor(static_cast<float *>(kernelMem), static_cast<int>(numTaps * sizeof(float)));
 
-    cuda::Tensor3DWrap<float> kernelTensor(m_kernel, kernelPitch1, kernelPitch2);
+    dim3 block(128);
+    dim3 grid(divUp(numTaps, block.x), outData.numImages());
 
-    CalculateGaussianKernel<<<grid, block, 0, stream>>>(kernelTensor, dataKernelSize, m_maxKernelSize, kernelSizeTensor,
-                                                        sigmaTensor);
+    CalculateSeparableGaussianKernel<<<grid, block, 0, stream>>>(kernelTensor, m_maxKernelSize, kernelSizeTensor,
+                                                                 sigmaTensor);
 
     checkKernelErrors();
 
-    typedef void (*filter2D_t)(
-        const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
-        const cuda::Tensor3DWrap<float> &kernelTensor, const cuda::Tensor1DWrap<int2> &kernelSizeTensor,
-        NVCVBorderType borderMode, float borderValue, cudaStream_t stream);
+    GaussianTaps taps{kernelTensor, kernelSizeTensor, m_maxKernelSize.w};
+
+    typedef void (*filter2D_t)(const IImageBatchVarShapeDataStridedCuda &inData,
+                               const IImageBatchVarShapeDataStridedCuda &outData, const GaussianTaps &taps,
+                               NVCVBorderType borderMode, float borderValue, cudaStream_t stream);
 
     static const filter2D_t funcs[6][4] = {
         { GaussianFilter2D<uchar>, 0,  GaussianFilter2D<uchar3>,  GaussianFilter2D<uchar4>},
@@ -634,7 +1045,7 @@ ErrorCode GaussianVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inDa
 
     NVCV_ASSERT(func != 0);
 
-    func(inData, outData, kernelTensor, kernelSizeTensor, borderMode, borderValue, stream);
+    func(inData, outData, taps, borderMode, borderValue, stream);
 
     return ErrorCode::SUCCESS;
 }
@@ -748,17 +1159,25 @@ void AverageBlurFilter2D(const IImageBatchVarShapeDataStridedCuda &inData,
                          const cuda::Tensor1DWrap<int2> &kernelAnchorTensor, NVCVBorderType borderMode,
                          float borderValue, cudaStream_t stream)
 {
-    typedef void (*func_t)(
-        const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
-        const cuda::Tensor3DWrap<float> &kernelTensor, const cuda::Tensor1DWrap<int2> &kernelSizeTensor,
-        const cuda::Tensor1DWrap<int2> &kernelAnchorTensor, float borderValue, cudaStream_t stream);
+    if constexpr (!IsKernelVariantEnabled<D>)
+    {
+        WorkspaceTaps taps{kernelTensor, kernelSizeTensor, kernelAnchorTensor, true};
+        Filter2DAnyChannels<cuda::BaseType<D>>(inData, outData, taps, borderMode, borderValue, false, stream);
+    }
+    else
+    {
+        typedef void (*func_t)(
+            const IImageBatchVarShapeDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
+            const cuda::Tensor3DWrap<float> &kernelTensor, const cuda::Tensor1DWrap<int2> &kernelSizeTensor,
+            const cuda::Tensor1DWrap<int2> &kernelAnchorTensor, float borderValue, cudaStream_t stream);
 
-    static const func_t funcs[]
-        = {AverageBlurFilter2DCaller<D, NVCV_BORDER_CONSTANT>, AverageBlurFilter2DCaller<D, NVCV_BORDER_REPLICATE>,
-           AverageBlurFilter2DCaller<D, NVCV_BORDER_REFLECT>, AverageBlurFilter2DCaller<D, NVCV_BORDER_WRAP>,
-           AverageBlurFilter2DCaller<D, NVCV_BORDER_REFLECT101>};
+        static const func_t funcs[]
+            = {AverageBlurFilter2DCaller<D, NVCV_BORDER_CONSTANT>, AverageBlurFilter2DCaller<D, NVCV_BORDER_REPLICATE>,
+               AverageBlurFilter2DCaller<D, NVCV_BORDER_REFLECT>, AverageBlurFilter2DCaller<D, NVCV_BORDER_WRAP>,
+               AverageBlurFilter2DCaller<D, NVCV_BORDER_REFLECT101>};
 
-    funcs[borderMode](inData, outData, kernelTensor, kernelSizeTensor, kernelAnchorTensor, borderValue, stream);
+        funcs[borderMode](inData, outData, kernelTensor, kernelSizeTensor, kernelAnchorTensor, borderValue, stream);
+    }
 }
 
 AverageBlurVarShape::AverageBlurVarShape(DataShape max_input_shape, DataShape max_output_shape, Size2D maxKernelSize,
@@ -769,15 +1188,10 @@ AverageBlurVarShape::AverageBlurVarShape(DataShape max_input_shape, DataShape ma
 {
     if (maxBatchSize > 0)
     {
-        NVCV_CHECK_THROW(cudaMalloc(&m_kernel, maxKernelSize.w * maxKernelSize.h * maxBatchSize * sizeof(float)));
+        setGpuWorkspaceSize(calBufferSize(maxKernelSize, maxBatchSize));
     }
 }
 
-AverageBlurVarShape::~AverageBlurVarShape()
-{
-    NVCV_CHECK_LOG(cudaFree(m_kernel));
-}
-
 size_t AverageBlurVarShape::calBufferSize(Size2D maxKernelSize, int maxBatchSize)
 {
     return maxKernelSize.w * maxKernelSize.h * maxBatchSize * sizeof(float);
@@ -852,7 +1266,10 @@ ErrorCode AverageBlurVarShape::infer(const IImageBatchVarShapeDataStridedCuda &i
     int kernelPitch2 = static_cast<int>(m_maxKernelSize.w * sizeof(float));
     int kernelPitch1 = m_maxKernelSize.h * kernelPitch2;
 
-    cuda::Tensor3DWrap<float> kernelTensor(m_kernel, kernelPitch1, kernelPitch2);
+    GpuWorkspaceLease workspace = gpuWorkspace(stream, calBufferSize(m_maxKernelSize, outData.numImages()));
+    void             *kernelMem = workspace.get();
+
+    cuda::Tensor3DWrap<float> kernelTensor(static_cast<float *>(kernelMem), kernelPitch1, kernelPitch2);
 
     compute_average_blur_kernel<<<grid, block, 0, stream>>>(kernelTensor, kernelSizeTensor, kernelAnchorTensor);
 
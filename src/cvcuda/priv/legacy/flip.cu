@@ -76,9 +76,35 @@ __global__ void flipHorizontalVertical(SrcWrapper src, DstWrapper dst, Size2D ds
     }
 }
 
+// In place, each thread swaps a pixel with its mirror.  Only the one of the pair that comes first in row-major
+// order does it, pixels that are their own mirror are left as they are.
+template<typename Wrapper>
+__global__ void flipInPlace(Wrapper img, Size2D size, const int32_t flipCode)
+{
+    const int32_t x         = blockIdx.x * blockDim.x + threadIdx.x;
+    const int32_t y         = blockIdx.y * blockDim.y + threadIdx.y;
+    const int32_t batch_idx = get_batch_idx();
+
+    if (x >= size.w || y >= size.h)
+        return;
+
+    const int32_t mirror_x = flipCode != 0 ? size.w - 1 - x : x;
+    const int32_t mirror_y = flipCode <= 0 ? size.h - 1 - y : y;
+
+    if (mirror_y < y || (mirror_y == y && mirror_x <= x))
+        return;
+
+    auto *pix    = img.ptr(batch_idx, y, x);
+    auto *mirror = img.ptr(batch_idx, mirror_y, mirror_x);
+
+    const auto tmp = *pix;
+    *pix           = *mirror;
+    *mirror        = tmp;
+}
+
 template<typename T>
 void flip(const ITensorDataStridedCuda &input, const ITensorDataStridedCuda &output, const int32_t flipCode,
-          cudaStream_t stream)
+          bool inplace, cudaStream_t stream)
 {
     constexpr uint32_t BLOCK = 32;
 
@@ -93,7 +119,19 @@ void flip(const ITensorDataStridedCuda &input, const ITensorDataStridedCuda &out
     dim3 blockSize(BLOCK, BLOCK / 4, 1);
     dim3 gridSize(divUp(dstSize.w, blockSize.x), divUp(dstSize.h, blockSize.y), outputWrapper->numSamples());
 
-    if (flipCode > 0)
+    if (inplace)
+    {
+        // Only the first half of the columns or rows swap pixels
+        const int32_t width  = flipCode > 0 ? divUp(dstSize.w, 2) : dstSize.w;
+        const int32_t height = flipCode <= 0 ? divUp(dstSize.h, 2) : dstSize.h;
+
+        gridSize.x = divUp(width, blockSize.x);
+        gridSize.y = divUp(height, blockSize.y);
+
+        flipInPlace<<<gridSize, blockSize, 0, stream>>>(dst, dstSize, flipCode);
+        checkKernelErrors();
+    }
+    else if (flipCode > 0)
     {
         flipHorizontal<<<gridSize, blockSize, 0, stream>>>(src, dst, dstSize);
         checkKernelErrors();
@@ -121,8 +159,18 @@ size_t Flip::calBufferSize(DataShape max_input_shape, DataShape max_output_shape
 }
 
 ErrorCode Flip::infer(const ITensorDataStridedCuda &input, const ITensorDataStridedCuda &output, const int32_t flipCode,
-                      cudaStream_t stream)
+                      bool inplace, cudaStream_t stream)
 {
+    LaunchPlanKey key;
+    key.add(input).add(output);
+
+    flip_t func;
+    if (m_plans.find(key, func))
+    {
+        func(input, output, flipCode, inplace, stream);
+        return ErrorCode::SUCCESS;
+    }
+
     if (input.dtype() != output.dtype())
     {
         LOG_ERROR("Invalid DataType between input (" << input.dtype() << ") and output (" << output.dtype() << ")");
@@ -145,7 +193,8 @@ ErrorCode Flip::infer(const ITensorDataStridedCuda &input, const ITensorDataStri
     }
 
     cuda_op::DataType dataType = GetLegacyDataType(input.dtype());
-    if (!(dataType == kCV_8U || dataType == kCV_16U || dataType == kCV_32S || dataType == kCV_32F))
+    if (!(dataType == kCV_8U || dataType == kCV_16U || dataType == kCV_32S || dataType == kCV_32F
+          || dataType == kCV_16F))
     {
         LOG_ERROR("Invalid DataType " << dataType);
         return ErrorCode::INVALID_DATA_TYPE;
@@ -161,23 +210,23 @@ ErrorCode Flip::infer(const ITensorDataStridedCuda &input, const ITensorDataStri
         return ErrorCode::INVALID_DATA_SHAPE;
     }
 
-    // using flip_t = void(const ITensorDataStridedCuda & input,
-    //                     const ITensorDataStridedCuda & output,
-    //                     const int32_t flipCode, cudaStream_t stream);
-    typedef void (*flip_t)(const ITensorDataStridedCuda &input, const ITensorDataStridedCuda &output,
-                           const int32_t flipCode, cudaStream_t stream);
-
-    static const flip_t funcs[6][4] = {
+    // Flip only moves values, half-precision ones are moved as 16-bit unsigned integers
+    static const flip_t funcs[8][4] = {
         {  flip<uchar>, 0,  flip<uchar3>,  flip<uchar4>},
         {            0, 0,             0,             0},
         { flip<ushort>, 0, flip<ushort3>, flip<ushort4>},
         {            0, 0,             0,             0},
         {flip<int32_t>, 0,    flip<int3>,    flip<int4>},
-        {  flip<float>, 0,  flip<float3>,  flip<float4>}
+        {  flip<float>, 0,  flip<float3>,  flip<float4>},
+        {            0, 0,             0,             0},
+        { flip<ushort>, 0, flip<ushort3>, flip<ushort4>}
     };
 
     const int32_t channels = inputShape.C;
-    funcs[dataType][channels - 1](input, output, flipCode, stream);
+    func                   = funcs[dataType][channels - 1];
+
+    m_plans.insert(key, func);
+    func(input, output, flipCode, inplace, stream);
 
     return ErrorCode::SUCCESS;
 }
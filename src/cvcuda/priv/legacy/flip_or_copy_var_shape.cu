@@ -23,62 +23,166 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "TinyImages.cuh"
+
+#include <numeric>
 
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
 
 namespace nvcv::legacy::cuda_op {
 
+// Pixels moved at once by each thread, the smallest whole number of pixels filling 16-byte vectors: 16 bytes, or
+// 48 bytes for 3-channel types
+template<typename T>
+constexpr int kChunkSize = 16 / std::gcd(sizeof(T), size_t{16});
+
+template<typename T>
+struct alignas(16) Chunk
+{
+    T px[kChunkSize<T>];
+};
+
+// Horizontal flips reverse the pixels of the chunks in registers
 template<typename T>
-__global__ void flip_kernel(const cuda::ImageBatchVarShapeWrap<T> src, cuda::ImageBatchVarShapeWrap<T> dst,
+__device__ __forceinline__ void reverse(Chunk<T> &chunk)
+{
+#pragma unroll
+    for (int i = 0; i < kChunkSize<T> / 2; ++i)
+    {
+        const T tmp                         = chunk.px[i];
+        chunk.px[i]                         = chunk.px[kChunkSize<T> - 1 - i];
+        chunk.px[kChunkSize<T> - 1 - i] = tmp;
+    }
+}
+
+// Chunks can be moved as vectors when rows are aligned and hold a whole number of them, mirrored chunks are then
+// aligned too. Works for image batch and tensor wraps.
+template<class Wrap>
+__device__ __forceinline__ bool isVectorizable(const Wrap &img, int sample, int width, int chunkSize)
+{
+    const auto row0 = reinterpret_cast<uintptr_t>(img.ptr(sample, 0, 0));
+    const auto row1 = reinterpret_cast<uintptr_t>(img.ptr(sample, 1, 0));
+    return width % chunkSize == 0 && row0 % 16 == 0 && (row1 - row0) % 16 == 0;
+}
+
+// Each thread moves a chunk of pixels and its mirror, and only the one of the pair that comes first in row-major
+// order does it, so that output images may also be the input ones, flipped in place. Samples whose rows can't be
+// moved as vectors are moved pixel by pixel, in the same way.
+template<typename T, class DstWrap>
+__global__ void flip_kernel(const cuda::ImageBatchVarShapeWrap<T> src, DstWrap dst,
                             const cuda::Tensor1DWrap<int> flipCode)
 {
-    const int x         = blockIdx.x * blockDim.x + threadIdx.x;
+    constexpr int N = kChunkSize<T>;
+
+    const int cx        = blockIdx.x * blockDim.x + threadIdx.x;
     const int y         = blockIdx.y * blockDim.y + threadIdx.y;
     const int batch_idx = get_batch_idx();
 
-    int out_height = dst.height(batch_idx), out_width = dst.width(batch_idx);
-    if (x >= out_width || y >= out_height)
+    const int height = src.height(batch_idx), width = src.width(batch_idx);
+    if (cx * N >= width || y >= height)
         return;
-    int flip_code = flipCode[batch_idx];
+    const int flip_code = flipCode[batch_idx];
 
-    if (flip_code == 1) // flip_code = 1, horizontal flip
-    {
-        *dst.ptr(batch_idx, y, x) = *src.ptr(batch_idx, y, (out_width - 1 - x));
-    }
-    else if (flip_code == 0) // flip_code = 0, vertical flip
+    // flip_code = 1 is a horizontal flip, 0 a vertical one and -1 both, anything else just copies
+    const bool flip_x   = flip_code == 1 || flip_code == -1;
+    const int  mirror_y = (flip_code == 0 || flip_code == -1) ? height - 1 - y : y;
+
+    if (isVectorizable(src, batch_idx, width, N) && isVectorizable(dst, batch_idx, width, N))
     {
-        *dst.ptr(batch_idx, y, x) = *src.ptr(batch_idx, (out_height - 1 - y), x);
+        const int mirror_cx = flip_x ? width / N - 1 - cx : cx;
+        if (mirror_y < y || (mirror_y == y && mirror_cx < cx))
+            return;
+
+        Chunk<T> chunk  = *reinterpret_cast<const Chunk<T> *>(src.ptr(batch_idx, y, cx * N));
+        Chunk<T> mirror = *reinterpret_cast<const Chunk<T> *>(src.ptr(batch_idx, mirror_y, mirror_cx * N));
+        if (flip_x)
+        {
+            reverse(chunk);
+            reverse(mirror);
+        }
+
+        *reinterpret_cast<Chunk<T> *>(dst.ptr(batch_idx, mirror_y, mirror_cx * N)) = chunk;
+        *reinterpret_cast<Chunk<T> *>(dst.ptr(batch_idx, y, cx * N))               = mirror;
+        return;
     }
-    else if (flip_code == -1) // flip_code = -1, horizontal and vertical flip
+
+    const int x_end = min(cx * N + N, width);
+    for (int x = cx * N; x < x_end; ++x)
     {
-        *dst.ptr(batch_idx, y, x) = *src.ptr(batch_idx, (out_height - 1 - y), (out_width - 1 - x));
+        const int mirror_x = flip_x ? width - 1 - x : x;
+        if (mirror_y < y || (mirror_y == y && mirror_x < x))
+            continue;
+
+        const T pix    = *src.ptr(batch_idx, y, x);
+        const T mirror = *src.ptr(batch_idx, mirror_y, mirror_x);
+
+        *dst.ptr(batch_idx, mirror_y, mirror_x) = pix;
+        *dst.ptr(batch_idx, y, x)               = mirror;
     }
-    else // just copy
+}
+
+// Per-pixel functor of batches of tiny images, with the pairing of the scalar path of flip_kernel: the pixel of the
+// pair that comes first moves both, which keeps in-place flips safe across the threads of an image
+template<typename T, class DstWrap>
+struct FlipPixelOp
+{
+    cuda::ImageBatchVarShapeWrap<T> src;
+    DstWrap                         dst;
+    cuda::Tensor1DWrap<int>         flipCode;
+
+    __device__ void operator()(int batch_idx, int x, int y) const
     {
-        *dst.ptr(batch_idx, y, x) = *src.ptr(batch_idx, y, x);
+        const int flip_code = flipCode[batch_idx];
+        const int mirror_x  = (flip_code == 1 || flip_code == -1) ? src.width(batch_idx) - 1 - x : x;
+        const int mirror_y  = (flip_code == 0 || flip_code == -1) ? src.height(batch_idx) - 1 - y : y;
+        if (mirror_y < y || (mirror_y == y && mirror_x < x))
+            return;
+
+        const T pix    = *src.ptr(batch_idx, y, x);
+        const T mirror = *src.ptr(batch_idx, mirror_y, mirror_x);
+
+        *dst.ptr(batch_idx, mirror_y, mirror_x) = pix;
+        *dst.ptr(batch_idx, y, x)               = mirror;
     }
-}
+};
 
 template<typename T>
-void flip(const IImageBatchVarShapeDataStridedCuda &input, const IImageBatchVarShapeDataStridedCuda &output,
-          const ITensorDataStridedCuda &flipCode, cudaStream_t stream)
+cuda::ImageBatchVarShapeWrap<T> CreateDstWrap(const IImageBatchVarShapeDataStridedCuda &output)
 {
-    constexpr uint32_t BLOCK = 32;
+    return cuda::ImageBatchVarShapeWrap<T>(output);
+}
 
-    dim3 blockSize(BLOCK, BLOCK / 4, 1);
-    dim3 gridSize(divUp(input.maxSize().w, blockSize.x), divUp(input.maxSize().h, blockSize.y), output.numImages());
+template<typename T>
+auto CreateDstWrap(const ITensorDataStridedCuda &output)
+{
+    return cuda::CreateTensorWrapNHW<T>(output);
+}
 
+template<typename T, class OutData>
+void flip(const IImageBatchVarShapeDataStridedCuda &input, const OutData &output,
+          const ITensorDataStridedCuda &flipCode, cudaStream_t stream)
+{
     cuda::ImageBatchVarShapeWrap<T> src(input);
-    cuda::ImageBatchVarShapeWrap<T> dst(output);
     cuda::Tensor1DWrap<int>         flip_code(flipCode);
 
-#ifdef CUDA_DEBUG_LOG
-    checkCudaErrors(cudaStreamSynchronize(stream));
-    checkCudaErrors(cudaGetLastError());
-#endif // CUDA_DEBUG_LOG
+    // batches of thumbnails or crops: a warp per image instead of mostly idle 32x8 blocks
+    if (IsTinyBatch(input.numImages(), input.maxSize()))
+    {
+        auto dst = CreateDstWrap<T>(output);
+        LaunchTinyImages(FlipPixelOp<T, decltype(dst)>{src, dst, flip_code}, src, input.numImages(), input.maxSize(),
+                         stream);
+        checkKernelErrors();
+        return;
+    }
+
+    constexpr uint32_t BLOCK = 32;
+
+    dim3 blockSize(BLOCK, BLOCK / 4, 1);
+    dim3 gridSize(divUp(divUp(input.maxSize().w, kChunkSize<T>), blockSize.x), divUp(input.maxSize().h, blockSize.y),
+                  input.numImages());
 
-    flip_kernel<T><<<gridSize, blockSize, 0, stream>>>(src, dst, flip_code);
+    flip_kernel<T><<<gridSize, blockSize, 0, stream>>>(src, CreateDstWrap<T>(output), flip_code);
     checkKernelErrors();
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
@@ -86,6 +190,51 @@ void flip(const IImageBatchVarShapeDataStridedCuda &input, const IImageBatchVarS
 #endif // CUDA_DEBUG_LOG
 }
 
+template<class OutData>
+using flip_t = void (*)(const IImageBatchVarShapeDataStridedCuda &input, const OutData &output,
+                        const ITensorDataStridedCuda &flipCode, cudaStream_t stream);
+
+// Gets the flip of the input images, logs an error and returns its code if they aren't supported
+template<class OutData>
+static ErrorCode GetFlip(const IImageBatchVarShapeDataStridedCuda &input, flip_t<OutData> &func)
+{
+    if (!input.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input batch must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataType dataType = helpers::GetLegacyDataType(input.uniqueFormat());
+    if (!(dataType == kCV_8U || dataType == kCV_16U || dataType == kCV_16S || dataType == kCV_32S
+          || dataType == kCV_32F || dataType == kCV_16F))
+    {
+        LOG_ERROR("Invalid DataType " << dataType);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    const int channels = input.uniqueFormat().numChannels();
+    if (channels > 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    // Flip only moves values, half-precision ones are moved as 16-bit unsigned integers
+    static const flip_t<OutData> funcs[8][4] = {
+        { flip<uchar>, 0,  flip<uchar3>,  flip<uchar4>},
+        {           0, 0,             0,             0},
+        {flip<ushort>, 0, flip<ushort3>, flip<ushort4>},
+        { flip<short>, 0,  flip<short3>,  flip<short4>},
+        {   flip<int>, 0,    flip<int3>,    flip<int4>},
+        { flip<float>, 0,  flip<float3>,  flip<float4>},
+        {           0, 0,             0,             0},
+        {flip<ushort>, 0, flip<ushort3>, flip<ushort4>}
+    };
+
+    func = funcs[dataType][channels - 1];
+    return ErrorCode::SUCCESS;
+}
+
 size_t FlipOrCopyVarShape::calBufferSize(int maxBatchSize)
 {
     return (sizeof(void *) * 2 + sizeof(int) * 3) * maxBatchSize;
@@ -110,45 +259,54 @@ ErrorCode FlipOrCopyVarShape::infer(const IImageBatchVarShapeDataStridedCuda &in
         return ErrorCode::INVALID_DATA_FORMAT;
     }
 
-    if (!input.uniqueFormat())
+    flip_t<IImageBatchVarShapeDataStridedCuda> func;
+    if (ErrorCode err = GetFlip(input, func); err != ErrorCode::SUCCESS)
     {
-        LOG_ERROR("Images in the input batch must all have the same format");
+        return err;
+    }
+
+    func(input, output, flipCode, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode FlipOrCopyVarShape::infer(const IImageBatchVarShapeDataStridedCuda &input,
+                                    const ITensorDataStridedCuda &output, const ITensorDataStridedCuda &flipCode,
+                                    cudaStream_t stream)
+{
+    DataFormat inputFormat  = helpers::GetLegacyDataFormat(input);
+    DataFormat outputFormat = helpers::GetLegacyDataFormat(output.layout());
+    if (!(inputFormat == kNHWC || inputFormat == kHWC) || outputFormat != kNHWC)
+    {
+        LOG_ERROR("Invalid DataFormat between input (" << inputFormat << ") and output (" << outputFormat << ")");
         return ErrorCode::INVALID_DATA_FORMAT;
     }
 
-    DataType dataType = helpers::GetLegacyDataType(input.uniqueFormat());
-    if (!(dataType == kCV_8U || dataType == kCV_16U || dataType == kCV_16S || dataType == kCV_32S
-          || dataType == kCV_32F))
+    flip_t<ITensorDataStridedCuda> func;
+    if (ErrorCode err = GetFlip(input, func); err != ErrorCode::SUCCESS)
     {
-        LOG_ERROR("Invalid DataType " << dataType);
-        return ErrorCode::INVALID_DATA_TYPE;
+        return err;
     }
 
-    const int channels = input.uniqueFormat().numChannels();
-    if (channels > 4)
+    if (helpers::GetLegacyDataType(output.dtype()) != helpers::GetLegacyDataType(input.uniqueFormat()))
     {
-        LOG_ERROR("Invalid channel number " << channels);
-        return ErrorCode::INVALID_DATA_SHAPE;
+        LOG_ERROR("Invalid DataType between input (" << helpers::GetLegacyDataType(input.uniqueFormat())
+                                                     << ") and output (" << helpers::GetLegacyDataType(output.dtype())
+                                                     << ")");
+        return ErrorCode::INVALID_DATA_TYPE;
     }
 
-    // using flip_t = void(const IImageBatchVarShapeDataStridedCuda & input,
-    //                     const IImageBatchVarShapeDataStridedCuda & output,
-    //                     const ITensorDataStridedCuda & flipCode,
-    //                     cudaStream_t stream);
-    typedef void (*flip_t)(const IImageBatchVarShapeDataStridedCuda &input,
-                           const IImageBatchVarShapeDataStridedCuda &output, const ITensorDataStridedCuda &flipCode,
-                           cudaStream_t stream);
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(output);
+    NVCV_ASSERT(outAccess);
 
-    static const flip_t funcs[6][4] = {
-        { flip<uchar>, 0,  flip<uchar3>,  flip<uchar4>},
-        {           0, 0,             0,             0},
-        {flip<ushort>, 0, flip<ushort3>, flip<ushort4>},
-        { flip<short>, 0,  flip<short3>,  flip<short4>},
-        {   flip<int>, 0,    flip<int3>,    flip<int4>},
-        { flip<float>, 0,  flip<float3>,  flip<float4>}
-    };
+    if (outAccess->numSamples() != input.numImages() || outAccess->numChannels() != input.uniqueFormat().numChannels()
+        || outAccess->numCols() != input.maxSize().w || outAccess->numRows() != input.maxSize().h)
+    {
+        LOG_ERROR("Invalid output shape " << output.shape() << ", it must have one sample per image, of their size");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
 
-    funcs[dataType][channels - 1](input, output, flipCode, stream);
+    func(input, output, flipCode, stream);
 
     return ErrorCode::SUCCESS;
 }
@@ -20,6 +20,8 @@
 
 #include "CvCudaUtils.cuh"
 
+#include <nvcv/cuda/VectorizedAccess.hpp>
+
 #define BLOCK 32
 
 using namespace nvcv::legacy::cuda_op;
@@ -27,74 +29,144 @@ using namespace nvcv::legacy::helpers;
 
 namespace nvcv::legacy::cuda_op {
 
-__global__ void copyGammaValues(float *gammaArray, const cuda::Tensor1DWrap<float> gamma, const int numImages,
-                                const int channelCount)
+// Gammas are given per image, or per image channel, and read straight from the gamma tensor.
+template<typename gamma_type>
+__device__ gamma_type loadGamma(const cuda::Tensor1DWrap<const float> &gammas, int batch_idx, bool perChannel)
 {
-    int index = threadIdx.x + blockIdx.x * blockDim.x;
-    if (index >= numImages)
+    constexpr int NC = cuda::NumElements<gamma_type>;
+
+    gamma_type gamma;
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
     {
-        return;
+        cuda::GetElement(gamma, c) = gammas[perChannel ? batch_idx * NC + c : batch_idx];
     }
+    return gamma;
+}
+
+// 8-bit values only take 256 values, so each block first tabulates 255*((x/255)**gamma) of its image in shared
+// memory, with the same expression as gamma_contrast_kernel, and then looks pixels up instead of calling pow.
+template<int N, typename D>
+__global__ void gamma_contrast_lut_kernel(const cuda::ImageBatchVarShapeWrap<D> src,
+                                          cuda::ImageBatchVarShapeWrap<D>       dst,
+                                          const cuda::Tensor1DWrap<const float> gammas, bool perChannel)
+{
+    using BT         = cuda::BaseType<D>;
+    constexpr int NC = cuda::NumElements<D>;
+
+    __shared__ BT lut[NC][256];
+
+    const int chunk_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
 
-    for (int i = 0; i < channelCount; i++)
+    // blocks entirely outside of the image skip building the table
+    if (blockIdx.y * blockDim.y >= dst.height(batch_idx)
+        || blockIdx.x * blockDim.x * N >= dst.width(batch_idx) * NC)
+        return;
+
+    using gamma_type       = cuda::ConvertBaseTypeTo<float, D>;
+    const gamma_type gamma = loadGamma<gamma_type>(gammas, batch_idx, perChannel);
+
+    for (int i = threadIdx.y * blockDim.x + threadIdx.x; i < NC * 256; i += blockDim.x * blockDim.y)
     {
-        gammaArray[index * channelCount + i] = gamma[index];
+        const int c = i / 256, v = i % 256;
+
+        float tmp = (v + 0.0f) / 255.0f;
+        lut[c][v] = nvcv::cuda::SaturateCast<BT>(cuda::pow(tmp, cuda::GetElement(gamma, c)) * 255.0f);
     }
+    __syncthreads();
+
+    if (dst_y >= dst.height(batch_idx))
+        return;
+
+    cuda::TransformRowVector<N, NC>(reinterpret_cast<BT *>(dst.ptr(batch_idx, dst_y, 0)),
+                                    reinterpret_cast<const BT *>(src.ptr(batch_idx, dst_y, 0)),
+                                    dst.width(batch_idx) * NC, chunk_idx, [&](BT v, int c) { return lut[c][v]; });
 }
 
-// apply 255*((x/255)**gamma) on each pixel
-template<typename D, typename gamma_type>
+// apply 255*((x/255)**gamma) on each pixel, each thread handles N consecutive channel values of a row
+template<int N, typename D, typename gamma_type>
 __global__ void gamma_contrast_kernel(const cuda::ImageBatchVarShapeWrap<D> src, cuda::ImageBatchVarShapeWrap<D> dst,
-                                      const cuda::Tensor1DWrap<gamma_type> gamma_)
+                                      const cuda::Tensor1DWrap<const float> gammas, bool perChannel)
 {
-    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    using BT         = cuda::BaseType<D>;
+    constexpr int NC = cuda::NumElements<D>;
+
+    const int chunk_idx = blockIdx.x * blockDim.x + threadIdx.x;
     const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
     const int batch_idx = get_batch_idx();
-    if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
+    if (dst_y >= dst.height(batch_idx))
         return;
 
-    gamma_type gamma = gamma_[batch_idx];
-    gamma_type tmp   = (*src.ptr(batch_idx, dst_y, dst_x) + 0.0f) / 255.0f;
-
-    D out                             = nvcv::cuda::SaturateCast<D>(cuda::pow(tmp, gamma) * 255.0f);
-    *dst.ptr(batch_idx, dst_y, dst_x) = out;
+    const gamma_type gamma = loadGamma<gamma_type>(gammas, batch_idx, perChannel);
+
+    // Rows of images not aligned for vector accesses are handled element by element.
+    cuda::TransformRowVector<N, NC>(reinterpret_cast<BT *>(dst.ptr(batch_idx, dst_y, 0)),
+                                    reinterpret_cast<const BT *>(src.ptr(batch_idx, dst_y, 0)),
+                                    dst.width(batch_idx) * NC, chunk_idx,
+                                    [&gamma](BT v, int c)
+                                    {
+                                        float tmp = (v + 0.0f) / 255.0f;
+                                        return nvcv::cuda::SaturateCast<BT>(
+                                            cuda::pow(tmp, cuda::GetElement(gamma, c)) * 255.0f);
+                                    });
 }
 
-// apply (x**gamma) on each pixel
-template<typename D, typename gamma_type>
+// apply (x**gamma) on each pixel, each thread handles N consecutive channel values of a row
+template<int N, typename D, typename gamma_type>
 __global__ void gamma_contrast_float_kernel(const cuda::ImageBatchVarShapeWrap<D> src,
                                             cuda::ImageBatchVarShapeWrap<D>       dst,
-                                            const cuda::Tensor1DWrap<gamma_type>  gamma_)
+                                            const cuda::Tensor1DWrap<const float> gammas, bool perChannel)
 {
-    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    using BT         = cuda::BaseType<D>;
+    constexpr int NC = cuda::NumElements<D>;
+
+    const int chunk_idx = blockIdx.x * blockDim.x + threadIdx.x;
     const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
     const int batch_idx = get_batch_idx();
-    if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
+    if (dst_y >= dst.height(batch_idx))
         return;
 
-    gamma_type gamma = gamma_[batch_idx];
-
-    D out = nvcv::cuda::SaturateCast<D>(cuda::pow(cuda::StaticCast<float>(*src.ptr(batch_idx, dst_y, dst_x)), gamma));
-
-    *dst.ptr(batch_idx, dst_y, dst_x) = cuda::clamp(cuda::StaticCast<float>(out), 0.f, 1.f);
+    const gamma_type gamma = loadGamma<gamma_type>(gammas, batch_idx, perChannel);
+
+    cuda::TransformRowVector<N, NC>(reinterpret_cast<BT *>(dst.ptr(batch_idx, dst_y, 0)),
+                                    reinterpret_cast<const BT *>(src.ptr(batch_idx, dst_y, 0)),
+                                    dst.width(batch_idx) * NC, chunk_idx,
+                                    [&gamma](BT v, int c)
+                                    {
+                                        BT out = nvcv::cuda::SaturateCast<BT>(
+                                            cuda::pow(cuda::StaticCast<float>(v), cuda::GetElement(gamma, c)));
+                                        return static_cast<BT>(cuda::clamp(cuda::StaticCast<float>(out), 0.f, 1.f));
+                                    });
 }
 
 template<typename T>
 void gamma_contrast(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda &out,
-                    float *gammaValues, cudaStream_t stream)
+                    const ITensorDataStridedCuda &gammas, bool perChannel, cudaStream_t stream)
 {
+    constexpr int N = cuda::VectorWidth<cuda::NumElements<T>, cuda::BaseType<T>>;
+
     int max_width  = in.maxSize().w;
     int max_height = in.maxSize().h;
     int batch      = in.numImages();
 
     dim3                            block(BLOCK, BLOCK / 4, 1);
-    dim3                            grid(divUp(max_width, block.x), divUp(max_height, block.y), batch);
+    dim3                            grid(divUp(divUp(max_width * cuda::NumElements<T>, N), block.x),
+                                         divUp(max_height, block.y), batch);
     cuda::ImageBatchVarShapeWrap<T> src_ptr(in);
     cuda::ImageBatchVarShapeWrap<T> dst_ptr(out);
 
     using gamma_type = cuda::ConvertBaseTypeTo<float, T>;
-    cuda::Tensor1DWrap<gamma_type> gamma(gammaValues);
-    gamma_contrast_kernel<T, gamma_type><<<grid, block, 0, stream>>>(src_ptr, dst_ptr, gamma);
+    cuda::Tensor1DWrap<const float> gamma(gammas);
+    if constexpr (std::is_same_v<cuda::BaseType<T>, uchar>)
+    {
+        gamma_contrast_lut_kernel<N, T><<<grid, block, 0, stream>>>(src_ptr, dst_ptr, gamma, perChannel);
+    }
+    else
+    {
+        gamma_contrast_kernel<N, T, gamma_type><<<grid, block, 0, stream>>>(src_ptr, dst_ptr, gamma, perChannel);
+    }
 
     checkKernelErrors();
 #ifdef CUDA_DEBUG_LOG
@@ -105,20 +177,23 @@ void gamma_contrast(const IImageBatchVarShapeDataStridedCuda &in, const IImageBa
 
 template<typename T>
 void gamma_contrast_float(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda &out,
-                          float *gammaValues, cudaStream_t stream)
+                          const ITensorDataStridedCuda &gammas, bool perChannel, cudaStream_t stream)
 {
+    constexpr int N = cuda::VectorWidth<cuda::NumElements<T>, cuda::BaseType<T>>;
+
     int max_width  = in.maxSize().w;
     int max_height = in.maxSize().h;
     int batch      = in.numImages();
 
     dim3                            block(BLOCK, BLOCK / 4, 1);
-    dim3                            grid(divUp(max_width, block.x), divUp(max_height, block.y), batch);
+    dim3                            grid(divUp(divUp(max_width * cuda::NumElements<T>, N), block.x),
+                                         divUp(max_height, block.y), batch);
     cuda::ImageBatchVarShapeWrap<T> src_ptr(in);
     cuda::ImageBatchVarShapeWrap<T> dst_ptr(out);
 
     using gamma_type = cuda::ConvertBaseTypeTo<float, T>;
-    cuda::Tensor1DWrap<gamma_type> gamma(gammaValues);
-    gamma_contrast_float_kernel<T, gamma_type><<<grid, block, 0, stream>>>(src_ptr, dst_ptr, gamma);
+    cuda::Tensor1DWrap<const float> gamma(gammas);
+    gamma_contrast_float_kernel<N, T, gamma_type><<<grid, block, 0, stream>>>(src_ptr, dst_ptr, gamma, perChannel);
     checkKernelErrors();
 }
 
@@ -127,15 +202,6 @@ GammaContrastVarShape::GammaContrastVarShape(const int32_t maxVarShapeBatchSize,
     , m_maxBatchSize(maxVarShapeBatchSize)
     , m_maxChannelCount(maxVarShapeChannelCount)
 {
-    if (m_maxBatchSize > 0 && m_maxChannelCount > 0)
-    {
-        NVCV_CHECK_THROW(cudaMalloc(&m_gammaArray, m_maxBatchSize * m_maxChannelCount * sizeof(float)));
-    }
-}
-
-GammaContrastVarShape::~GammaContrastVarShape()
-{
-    NVCV_CHECK_LOG(cudaFree(m_gammaArray));
 }
 
 ErrorCode GammaContrastVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
@@ -206,32 +272,17 @@ ErrorCode GammaContrastVarShape::infer(const IImageBatchVarShapeDataStridedCuda
         return ErrorCode::INVALID_DATA_SHAPE;
     }
 
-    auto gammasAccess = nvcv::TensorDataAccessStrided::Create(gammas);
-    NVCV_ASSERT(gammasAccess);
-
     int numElements = 1;
     for (int i = 0; i < gammas.rank(); i++)
     {
         numElements *= gammas.shape(i);
     }
 
-    if (inData.numImages() * channels == numElements)
-    {
-        // Copy the data device to device
-        checkCudaErrors(cudaMemcpyAsync(m_gammaArray, gammasAccess->sampleData(0),
-                                        sizeof(float) * inData.numImages() * channels, cudaMemcpyDeviceToDevice,
-                                        stream));
-    }
-    else
-    {
-        cuda::Tensor1DWrap<float> gammaTensorWrap(gammas);
-        copyGammaValues<<<1, inData.numImages(), 0, stream>>>(m_gammaArray, gammaTensorWrap, inData.numImages(),
-                                                              channels);
-        checkKernelErrors();
-    }
+    const bool perChannel = inData.numImages() * channels == numElements;
 
     typedef void (*func_t)(const nvcv::IImageBatchVarShapeDataStridedCuda &in,
-                           const nvcv::IImageBatchVarShapeDataStridedCuda &out, float *gammas, cudaStream_t stream);
+                           const nvcv::IImageBatchVarShapeDataStridedCuda &out, const ITensorDataStridedCuda &gammas,
+                           bool perChannel, cudaStream_t stream);
 
     static const func_t funcs[5][4] = {
         {      gamma_contrast<uchar>,      gamma_contrast<uchar2>,      gamma_contrast<uchar3>,gamma_contrast<uchar4>                                                                                               },
@@ -248,12 +299,12 @@ ErrorCode GammaContrastVarShape::infer(const IImageBatchVarShapeDataStridedCuda
     if (data_type == kCV_32F)
     {
         const func_t func = funcs_float[channels - 1];
-        func(inData, outData, m_gammaArray, stream);
+        func(inData, outData, gammas, perChannel, stream);
     }
     else
     {
         const func_t func = funcs[data_type][channels - 1];
-        func(inData, outData, m_gammaArray, stream);
+        func(inData, outData, gammas, perChannel, stream);
     }
 
     return ErrorCode::SUCCESS;
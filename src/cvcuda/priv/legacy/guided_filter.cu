@@ -0,0 +1,157 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "GuidedFilter.cuh"
+
+#include <tuple>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Checks the data format, channels and type of one of the tensors.
+ErrorCode checkTensor(const ITensorDataStridedCuda &data, const char *name, guided::ElemKind &kind, int &channels)
+{
+    DataFormat format = GetLegacyDataFormat(data.layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid " << name << " DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    auto access = TensorDataAccessStridedImagePlanar::Create(data);
+    NVCV_ASSERT(access);
+
+    channels = access->numChannels();
+    if (channels != 1 && channels != 3)
+    {
+        LOG_ERROR("Invalid " << name << " channel number " << channels << ", it must be 1 or 3");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (!guided::GetElemKind(GetLegacyDataType(data.dtype()), kind))
+    {
+        LOG_ERROR("Invalid " << name << " DataType " << data.dtype() << ", it must be uint8, uint16 or float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+guided::TensorRows makeRows(const ITensorDataStridedCuda &data, int2 size)
+{
+    return guided::TensorRows{nvcv::cuda::CreateTensorWrapNHW<uchar>(data), size};
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+GuidedFilter::GuidedFilter(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size,
+                           Size2D max_size)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_maxBatchSize(max_batch_size)
+    , m_maxSize(max_size)
+{
+    setGpuWorkspaceSize(calBufferSize(max_batch_size, max_size));
+}
+
+size_t GuidedFilter::calBufferSize(int max_batch_size, Size2D max_size)
+{
+    return guided::WorkspaceSize(max_batch_size, max_size);
+}
+
+ErrorCode GuidedFilter::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &guideData,
+                              const ITensorDataStridedCuda &outData, int radius, float eps, int subsample,
+                              cudaStream_t stream)
+{
+    if (ErrorCode err = guided::CheckParams(radius, eps, subsample); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    guided::ElemKind inKind, guideKind, outKind;
+    int              channels, guideChannels, outChannels;
+    for (auto [data, name, kind, numChannels] :
+         {std::make_tuple(&inData, "input", &inKind, &channels),
+          std::make_tuple(&guideData, "guide", &guideKind, &guideChannels),
+          std::make_tuple(&outData, "output", &outKind, &outChannels)})
+    {
+        if (ErrorCode err = checkTensor(*data, name, *kind, *numChannels); err != ErrorCode::SUCCESS)
+        {
+            return err;
+        }
+    }
+
+    if (inData.dtype() != outData.dtype())
+    {
+        LOG_ERROR("Invalid DataType between input (" << inData.dtype() << ") and output (" << outData.dtype()
+                                                     << "), they must be the same");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess    = TensorDataAccessStridedImagePlanar::Create(inData);
+    auto guideAccess = TensorDataAccessStridedImagePlanar::Create(guideData);
+    auto outAccess   = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(inAccess && guideAccess && outAccess);
+
+    const int  numSamples = inAccess->numSamples();
+    const int2 size{inAccess->numCols(), inAccess->numRows()};
+
+    if (guideAccess->numSamples() != numSamples || guideAccess->numCols() != size.x
+        || guideAccess->numRows() != size.y)
+    {
+        LOG_ERROR("Invalid guide shape " << guideData.shape() << ", it must have " << numSamples << " samples of "
+                                         << size.x << "x" << size.y << " pixels");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (outAccess->numSamples() != numSamples || outAccess->numCols() != size.x || outAccess->numRows() != size.y
+        || outChannels != channels)
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must be the same as the input shape "
+                                          << inData.shape());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (numSamples > m_maxBatchSize || size.x > m_maxSize.w || size.y > m_maxSize.h)
+    {
+        LOG_ERROR("Invalid input shape " << inData.shape() << ", it exceeds the maximum batch size " << m_maxBatchSize
+                                         << " or size " << m_maxSize.w << "x" << m_maxSize.h);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (numSamples == 0 || size.x == 0 || size.y == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    guided::GuidedFilterCaller(makeRows(guideData, size), makeRows(inData, size), makeRows(outData, size),
+                               guideChannels, channels, guideKind, inKind, numSamples, size, radius, eps, subsample,
+                               gpuWorkspace(stream).as<float>(), stream);
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
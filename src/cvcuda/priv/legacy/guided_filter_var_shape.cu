@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "GuidedFilter.cuh"
+
+#include <tuple>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Checks the data format, channels and type of one of the image batches.
+ErrorCode checkBatch(const IImageBatchVarShapeDataStridedCuda &data, const char *name, guided::ElemKind &kind,
+                     int &channels)
+{
+    DataFormat format = GetLegacyDataFormat(data);
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid " << name << " DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!data.uniqueFormat() || data.uniqueFormat().numPlanes() != 1)
+    {
+        LOG_ERROR("Images in the " << name << " varshape must all have the same single-plane format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    channels = data.uniqueFormat().numChannels();
+    if (channels != 1 && channels != 3)
+    {
+        LOG_ERROR("Invalid " << name << " channel number " << channels << ", it must be 1 or 3");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (!guided::GetElemKind(GetLegacyDataType(data.uniqueFormat()), kind))
+    {
+        LOG_ERROR("Invalid " << name << " format " << data.uniqueFormat() << ", it must be uint8, uint16 or float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+GuidedFilterVarShape::GuidedFilterVarShape(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size,
+                                           Size2D max_size)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_maxBatchSize(max_batch_size)
+    , m_maxSize(max_size)
+{
+    setGpuWorkspaceSize(GuidedFilter::calBufferSize(max_batch_size, max_size));
+}
+
+ErrorCode GuidedFilterVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                      const IImageBatchVarShapeDataStridedCuda &guideData,
+                                      const IImageBatchVarShapeDataStridedCuda &outData, int radius, float eps,
+                                      int subsample, cudaStream_t stream)
+{
+    if (ErrorCode err = guided::CheckParams(radius, eps, subsample); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    guided::ElemKind inKind, guideKind, outKind;
+    int              channels, guideChannels, outChannels;
+    for (auto [data, name, kind, numChannels] :
+         {std::make_tuple(&inData, "input", &inKind, &channels),
+          std::make_tuple(&guideData, "guide", &guideKind, &guideChannels),
+          std::make_tuple(&outData, "output", &outKind, &outChannels)})
+    {
+        if (ErrorCode err = checkBatch(*data, name, *kind, *numChannels); err != ErrorCode::SUCCESS)
+        {
+            return err;
+        }
+    }
+
+    if (inData.uniqueFormat() != outData.uniqueFormat())
+    {
+        LOG_ERROR("Input and Output formats must be the same, input format = " << inData.uniqueFormat()
+                                                                              << " output format = "
+                                                                              << outData.uniqueFormat());
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    const int numSamples = inData.numImages();
+    if (guideData.numImages() != numSamples || outData.numImages() != numSamples)
+    {
+        LOG_ERROR("Input, guide and output must have the same number of images (" << numSamples << ", "
+                                                                                   << guideData.numImages() << ", "
+                                                                                   << outData.numImages() << ")");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const Size2D maxSize = inData.maxSize();
+    if (numSamples > m_maxBatchSize || maxSize.w > m_maxSize.w || maxSize.h > m_maxSize.h)
+    {
+        LOG_ERROR("Invalid input of " << numSamples << " images up to " << maxSize.w << "x" << maxSize.h
+                                      << ", it exceeds the maximum batch size " << m_maxBatchSize << " or size "
+                                      << m_maxSize.w << "x" << m_maxSize.h);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (numSamples == 0 || maxSize.w == 0 || maxSize.h == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    // the images are read with the sizes of the guide ones, the planes have the size of the largest image
+    guided::GuidedFilterCaller(guided::BatchRows{guideData}, guided::BatchRows{inData}, guided::BatchRows{outData},
+                               guideChannels, channels, guideKind, inKind, numSamples, int2{maxSize.w, maxSize.h},
+                               radius, eps, subsample, gpuWorkspace(stream).as<float>(), stream);
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,290 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "ReduceUtils.cuh"
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+constexpr int kHistogramBins = 256;
+
+__global__ void histogramClearKernel(nvcv::cuda::Tensor3DWrap<int> dst, int out_channels)
+{
+    int *out = dst.ptr(static_cast<int>(blockIdx.x), 0, static_cast<int>(threadIdx.x));
+    for (int c = 0; c < out_channels; ++c)
+    {
+        out[c] = 0;
+    }
+}
+
+// blockIdx.x is the segment, whose rows are split among gridDim.y blocks.  Each block counts its pixels in a
+// shared memory histogram per channel, and adds it to the output, directly when it's the only block of the segment.
+// Integer additions don't depend on their order, so results are the same from one run to the next.
+template<class Segments>
+__global__ void histogramKernel(Segments src, nvcv::cuda::Tensor3DWrap<int> dst, int out_channels)
+{
+    using T          = typename Segments::value_type;
+    constexpr int NC = nvcv::cuda::NumElements<T>;
+
+    __shared__ int hist[NC][kHistogramBins];
+
+    const int lid        = get_lid();
+    const int hist_count = out_channels == 1 ? 1 : NC;
+    for (int i = lid; i < NC * kHistogramBins; i += kReduceBlockW * kReduceBlockH)
+    {
+        hist[i / kHistogramBins][i % kHistogramBins] = 0;
+    }
+    __syncthreads();
+
+    const int segment = blockIdx.x;
+    const int rows    = src.numRows(segment);
+    const int cols    = src.numCols(segment);
+
+    for (int y = blockIdx.y * kReduceBlockH + threadIdx.y; y < rows; y += gridDim.y * kReduceBlockH)
+    {
+        const T *row = src.row(segment, y);
+        for (int x = threadIdx.x; x < cols; x += kReduceBlockW)
+        {
+            const T p = row[x];
+#pragma unroll
+            for (int c = 0; c < NC; ++c)
+            {
+                atomicAdd(&hist[hist_count == 1 ? 0 : c][nvcv::cuda::GetElement(p, c)], 1);
+            }
+        }
+    }
+    __syncthreads();
+
+    const int sample = src.sample(segment);
+    const int first  = out_channels == 1 ? 0 : src.channel(segment);
+    for (int i = lid; i < hist_count * kHistogramBins; i += kReduceBlockW * kReduceBlockH)
+    {
+        const int c     = i / kHistogramBins;
+        const int bin   = i % kHistogramBins;
+        const int count = hist[c][bin];
+        int      *out   = dst.ptr(sample, 0, bin) + first + c;
+
+        if (gridDim.y == 1)
+        {
+            *out = count;
+        }
+        else if (count != 0)
+        {
+            atomicAdd(out, count);
+        }
+    }
+}
+
+template<class Segments>
+void histogramCaller(const Segments &src, int num_segments, int num_samples, int max_rows,
+                     const nvcv::ITensorDataStridedCuda &outData, int out_channels, cudaStream_t stream)
+{
+    auto dst = nvcv::cuda::CreateTensorWrapNHW<int>(outData);
+
+    const int num_blocks = NumReduceBlocks(num_segments, max_rows);
+
+    // Blocks accumulate their counts in the output when there are several per segment
+    if (num_blocks > 1)
+    {
+        histogramClearKernel<<<num_samples, kHistogramBins, 0, stream>>>(dst, out_channels);
+        checkKernelErrors();
+    }
+
+    dim3 block(kReduceBlockW, kReduceBlockH);
+    dim3 grid(num_segments, num_blocks);
+
+    histogramKernel<<<grid, block, 0, stream>>>(src, dst, out_channels);
+    checkKernelErrors();
+}
+
+template<typename T>
+void histogramTensor(const nvcv::TensorDataAccessStridedImagePlanar &inAccess,
+                     const nvcv::ITensorDataStridedCuda &outData, int out_channels, cudaStream_t stream)
+{
+    // Planes of planar tensors are counted separately, unless all channels are counted together
+    TensorSegments<T> src(inAccess, out_channels > 1);
+
+    histogramCaller(src, src.numSegments(inAccess.numSamples()), inAccess.numSamples(),
+                    src.height * src.planesPerSegment, outData, out_channels, stream);
+}
+
+template<typename T>
+void histogramVarShape(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
+                       const nvcv::ITensorDataStridedCuda &outData, int out_channels, cudaStream_t stream)
+{
+    VarShapeSegments<T> src(inData);
+
+    histogramCaller(src, inData.numImages(), inData.numImages(), inData.maxSize().h, outData, out_channels, stream);
+}
+
+// Checks the parameters shared by tensor and varshape histograms, and returns the number of output channels.
+ErrorCode checkHistogramParams(const nvcv::ITensorDataStridedCuda &outData, int numSamples, int channels,
+                               DataType data_type, int &out_channels)
+{
+    if (data_type != kCV_8U)
+    {
+        LOG_ERROR("Invalid DataType " << data_type << ", histograms are computed for 8-bit unsigned inputs");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    DataFormat out_format = GetLegacyDataFormat(outData.layout());
+    if (!(out_format == kNHWC || out_format == kHWC))
+    {
+        LOG_ERROR("Invalid output DataFormat " << out_format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (GetLegacyDataType(outData.dtype()) != kCV_32S)
+    {
+        LOG_ERROR("Invalid output DataType " << outData.dtype() << ", it must be int32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    if (outAccess->numSamples() != numSamples || outAccess->numRows() != 1
+        || outAccess->numCols() != kHistogramBins)
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must have " << numSamples
+                                          << " samples with height 1 and width " << kHistogramBins);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    out_channels = outAccess->numChannels();
+    if (out_channels != 1 && out_channels != channels)
+    {
+        LOG_ERROR("Invalid output channel number " << out_channels << ", it must be 1 or " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t Histogram::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode Histogram::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                           cudaStream_t stream)
+{
+    DataFormat format = GetLegacyDataFormat(inData.layout());
+    if (!(format == kNHWC || format == kHWC || format == kNCHW || format == kCHW))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    if (!inAccess)
+    {
+        LOG_ERROR("Invalid input DataFormat");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    const int channels      = inAccess->numChannels();
+    const int elem_channels = inAccess->numPlanes() > 1 ? 1 : channels;
+    if (elem_channels != 1 && elem_channels != 3 && elem_channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    int       out_channels = 0;
+    ErrorCode err          = checkHistogramParams(outData, inAccess->numSamples(), channels,
+                                                  GetLegacyDataType(inData.dtype()), out_channels);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    typedef void (*func_t)(const TensorDataAccessStridedImagePlanar &inAccess, const ITensorDataStridedCuda &outData,
+                           int out_channels, cudaStream_t stream);
+
+    static const func_t funcs[4]
+        = {histogramTensor<uchar>, 0 /*histogramTensor<uchar2>*/, histogramTensor<uchar3>, histogramTensor<uchar4>};
+
+    const func_t func = funcs[elem_channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(*inAccess, outData, out_channels, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode HistogramVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                   const ITensorDataStridedCuda &outData, cudaStream_t stream)
+{
+    DataFormat format = helpers::GetLegacyDataFormat(inData);
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!inData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input varshape must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    const int channels = inData.uniqueFormat().numChannels();
+    if (channels != 1 && channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    int       out_channels = 0;
+    ErrorCode err          = checkHistogramParams(outData, inData.numImages(), channels,
+                                                  helpers::GetLegacyDataType(inData.uniqueFormat()), out_channels);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (inData.numImages() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                           int out_channels, cudaStream_t stream);
+
+    static const func_t funcs[4] = {histogramVarShape<uchar>, 0 /*histogramVarShape<uchar2>*/,
+                                    histogramVarShape<uchar3>, histogramVarShape<uchar4>};
+
+    const func_t func = funcs[channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(inData, outData, out_channels, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
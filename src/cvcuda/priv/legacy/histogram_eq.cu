@@ -0,0 +1,591 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "ReduceUtils.cuh"
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+constexpr int kHistogramBins = 256;
+
+// Histograms are counted, scanned and mapped with one thread per bin
+static_assert(kReduceBlockW * kReduceBlockH == kHistogramBins, "blocks must have one thread per histogram bin");
+
+// Single channel 8-bit images of a tensor, and the output images they're mapped to.
+struct TensorImages
+{
+    TensorImages(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData, int rows,
+                 int cols)
+        : src(nvcv::cuda::CreateTensorWrapNHW<const uchar>(inData))
+        , dst(nvcv::cuda::CreateTensorWrapNHW<uchar>(outData))
+        , rows(rows)
+        , cols(cols)
+    {
+    }
+
+    __device__ int numRows(int n) const
+    {
+        return rows;
+    }
+
+    __device__ int numCols(int n) const
+    {
+        return cols;
+    }
+
+    __device__ uchar load(int n, int y, int x) const
+    {
+        return *src.ptr(n, y, x);
+    }
+
+    __device__ void store(int n, int y, int x, uchar v) const
+    {
+        *dst.ptr(n, y, x) = v;
+    }
+
+    nvcv::cuda::Tensor3DWrap<const uchar> src;
+    nvcv::cuda::Tensor3DWrap<uchar>       dst;
+    int                                   rows, cols;
+};
+
+// Same, for the images of varshape batches.
+struct VarShapeImages
+{
+    VarShapeImages(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
+                   const nvcv::IImageBatchVarShapeDataStridedCuda &outData)
+        : src(inData)
+        , dst(outData)
+    {
+    }
+
+    __device__ int numRows(int n) const
+    {
+        return src.at_rows(n);
+    }
+
+    __device__ int numCols(int n) const
+    {
+        return src.at_cols(n);
+    }
+
+    __device__ uchar load(int n, int y, int x) const
+    {
+        return *src.ptr(n, y, x);
+    }
+
+    __device__ void store(int n, int y, int x, uchar v)
+    {
+        *dst.ptr(n, y, x) = v;
+    }
+
+    Ptr2dVarShapeNHWC<uchar> src, dst;
+};
+
+// Replaces the bins of a block's shared histogram by their cumulative counts.
+__device__ void ScanHistogram(int *hist, int lid)
+{
+#pragma unroll
+    for (int offset = 1; offset < kHistogramBins; offset *= 2)
+    {
+        const int prev = lid >= offset ? hist[lid - offset] : 0;
+        __syncthreads();
+        hist[lid] += prev;
+        __syncthreads();
+    }
+}
+
+// Mirrors coordinates past the end of a row or column, without repeating the last pixel.
+__device__ __forceinline__ int Reflect101(int i, int size)
+{
+    return i < size ? i : max(2 * size - 2 - i, 0);
+}
+
+// blockIdx.x is the image, whose rows are split among gridDim.y blocks.  Each block counts its pixels in a
+// shared memory histogram, and adds it to the image histogram.
+template<class Images>
+__global__ void histogramEqCountKernel(Images imgs, int *hists)
+{
+    __shared__ int hist[kHistogramBins];
+
+    const int lid = get_lid();
+    hist[lid]     = 0;
+    __syncthreads();
+
+    const int n    = blockIdx.x;
+    const int rows = imgs.numRows(n);
+    const int cols = imgs.numCols(n);
+
+    for (int y = blockIdx.y * kReduceBlockH + threadIdx.y; y < rows; y += gridDim.y * kReduceBlockH)
+    {
+        for (int x = threadIdx.x; x < cols; x += kReduceBlockW)
+        {
+            atomicAdd(&hist[imgs.load(n, y, x)], 1);
+        }
+    }
+    __syncthreads();
+
+    if (hist[lid] != 0)
+    {
+        atomicAdd(&hists[n * kHistogramBins + lid], hist[lid]);
+    }
+}
+
+// blockIdx.z is the image.  Each block builds the mapping of its image from the histogram, which costs less than
+// another kernel launch, and applies it to its pixels.
+template<class Images>
+__global__ void histogramEqMapKernel(Images imgs, const int *hists)
+{
+    __shared__ int   cdf[kHistogramBins];
+    __shared__ uchar lut[kHistogramBins];
+
+    const int lid = get_lid();
+    const int n   = blockIdx.z;
+
+    cdf[lid] = hists[n * kHistogramBins + lid];
+    __syncthreads();
+    ScanHistogram(cdf, lid);
+
+    // Like cv::equalizeHist, the first non empty bin is mapped to 0 and the others are spread over the whole range
+    const int first = __syncthreads_count(cdf[lid] == 0);
+    if (first == kHistogramBins)
+    {
+        return; // empty image
+    }
+
+    const int total      = cdf[kHistogramBins - 1];
+    const int firstCount = cdf[first];
+    if (firstCount == total)
+    {
+        lut[lid] = first; // a single value is kept as is
+    }
+    else
+    {
+        const float scale = 255.f / (total - firstCount);
+        lut[lid]          = lid <= first ? 0 : nvcv::cuda::SaturateCast<uchar>((cdf[lid] - firstCount) * scale);
+    }
+    __syncthreads();
+
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    if (x < imgs.numCols(n) && y < imgs.numRows(n))
+    {
+        imgs.store(n, y, x, lut[imgs.load(n, y, x)]);
+    }
+}
+
+template<class Images>
+void histogramEqCaller(Images imgs, int numImages, int maxRows, int maxCols, int *hists, cudaStream_t stream)
+{
+    checkCudaErrors(cudaMemsetAsync(hists, 0, numImages * kHistogramBins * sizeof(int), stream));
+
+    dim3 block(kReduceBlockW, kReduceBlockH);
+
+    dim3 countGrid(numImages, NumReduceBlocks(numImages, maxRows));
+    histogramEqCountKernel<<<countGrid, block, 0, stream>>>(imgs, hists);
+    checkKernelErrors();
+
+    dim3 mapGrid(divUp(maxCols, block.x), divUp(maxRows, block.y), numImages);
+    histogramEqMapKernel<<<mapGrid, block, 0, stream>>>(imgs, hists);
+    checkKernelErrors();
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
+// blockIdx.x and blockIdx.y are the tile, blockIdx.z the image.  Each block counts the pixels of its tile in a
+// shared memory histogram, clips it and redistributes the excess like cv::CLAHE, and writes the tile mapping.
+// Tiles past the image borders, when its size isn't a multiple of the grid's, are filled by mirroring the image.
+template<class Images>
+__global__ void claheTileKernel(Images imgs, uchar *luts, float clipLimit, int tilesX, int tilesY)
+{
+    __shared__ int hist[kHistogramBins];
+    __shared__ int clipped;
+
+    const int lid = get_lid();
+    const int n   = blockIdx.z;
+
+    hist[lid] = 0;
+    if (lid == 0)
+    {
+        clipped = 0;
+    }
+    __syncthreads();
+
+    const int rows  = imgs.numRows(n);
+    const int cols  = imgs.numCols(n);
+    const int tileW = (cols + tilesX - 1) / tilesX;
+    const int tileH = (rows + tilesY - 1) / tilesY;
+    const int x0    = blockIdx.x * tileW;
+    const int y0    = blockIdx.y * tileH;
+
+    for (int y = threadIdx.y; y < tileH; y += kReduceBlockH)
+    {
+        const int sy = Reflect101(y0 + y, rows);
+        for (int x = threadIdx.x; x < tileW; x += kReduceBlockW)
+        {
+            atomicAdd(&hist[imgs.load(n, sy, Reflect101(x0 + x, cols))], 1);
+        }
+    }
+    __syncthreads();
+
+    const int tileArea = tileW * tileH;
+    int       count    = hist[lid];
+
+    if (clipLimit > 0)
+    {
+        const int limit = max(static_cast<int>(static_cast<double>(clipLimit) * tileArea / kHistogramBins), 1);
+        if (count > limit)
+        {
+            atomicAdd(&clipped, count - limit);
+            count = limit;
+        }
+        __syncthreads();
+
+        // The excess is spread evenly, and what remains goes to equally spaced bins
+        const int residual = clipped % kHistogramBins;
+        count += clipped / kHistogramBins;
+        if (residual != 0)
+        {
+            const int step = max(kHistogramBins / residual, 1);
+            count += lid % step == 0 && lid / step < residual;
+        }
+    }
+
+    hist[lid] = count;
+    __syncthreads();
+    ScanHistogram(hist, lid);
+
+    const float scale = 255.f / tileArea;
+    const int   tile  = (n * tilesY + blockIdx.y) * tilesX + blockIdx.x;
+
+    luts[tile * kHistogramBins + lid] = nvcv::cuda::SaturateCast<uchar>(hist[lid] * scale);
+}
+
+// Maps each pixel with the bilinear interpolation of the mappings of the tiles whose centers surround it.
+template<class Images>
+__global__ void claheMapKernel(Images imgs, const uchar *luts, int tilesX, int tilesY)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int n = blockIdx.z;
+
+    const int rows = imgs.numRows(n);
+    const int cols = imgs.numCols(n);
+    if (x >= cols || y >= rows)
+    {
+        return;
+    }
+
+    const int tileW = (cols + tilesX - 1) / tilesX;
+    const int tileH = (rows + tilesY - 1) / tilesY;
+
+    const float txf = x * (1.f / tileW) - 0.5f;
+    const float tyf = y * (1.f / tileH) - 0.5f;
+    const int   tx  = static_cast<int>(floorf(txf));
+    const int   ty  = static_cast<int>(floorf(tyf));
+    const float xa  = txf - tx;
+    const float ya  = tyf - ty;
+
+    const int tx1 = max(tx, 0), tx2 = min(tx + 1, tilesX - 1);
+    const int ty1 = max(ty, 0), ty2 = min(ty + 1, tilesY - 1);
+
+    const uchar *lut = luts + n * tilesY * tilesX * kHistogramBins + imgs.load(n, y, x);
+
+    auto at = [&](int tileX, int tileY) -> float
+    {
+        return lut[(tileY * tilesX + tileX) * kHistogramBins];
+    };
+
+    const float res = (at(tx1, ty1) * (1 - xa) + at(tx2, ty1) * xa) * (1 - ya)
+                    + (at(tx1, ty2) * (1 - xa) + at(tx2, ty2) * xa) * ya;
+
+    imgs.store(n, y, x, nvcv::cuda::SaturateCast<uchar>(res));
+}
+
+template<class Images>
+void claheCaller(Images imgs, int numImages, int maxRows, int maxCols, float clipLimit, int tilesX, int tilesY,
+                 uchar *luts, cudaStream_t stream)
+{
+    dim3 block(kReduceBlockW, kReduceBlockH);
+
+    dim3 tileGrid(tilesX, tilesY, numImages);
+    claheTileKernel<<<tileGrid, block, 0, stream>>>(imgs, luts, clipLimit, tilesX, tilesY);
+    checkKernelErrors();
+
+    dim3 mapGrid(divUp(maxCols, block.x), divUp(maxRows, block.y), numImages);
+    claheMapKernel<<<mapGrid, block, 0, stream>>>(imgs, luts, tilesX, tilesY);
+    checkKernelErrors();
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
+// Checks the input and output tensors of both equalizations.
+ErrorCode checkTensors(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
+                       int maxBatchSize)
+{
+    DataFormat format = GetLegacyDataFormat(inData.layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (GetLegacyDataFormat(outData.layout()) != format)
+    {
+        LOG_ERROR("Invalid output DataFormat " << GetLegacyDataFormat(outData.layout()) << ", it must be " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (GetLegacyDataType(inData.dtype()) != kCV_8U || outData.dtype() != inData.dtype())
+    {
+        LOG_ERROR("Invalid DataType " << inData.dtype() << " or " << outData.dtype() << ", both must be uint8");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (outData.shape() != inData.shape())
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must be the input shape " << inData.shape());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    if (inAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid channel number " << inAccess->numChannels() << ", images must be single channel");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (inAccess->numSamples() > maxBatchSize)
+    {
+        LOG_ERROR("Invalid number of samples " << inAccess->numSamples() << ", it must be at most " << maxBatchSize);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode checkVarShapes(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
+                         const nvcv::IImageBatchVarShapeDataStridedCuda &outData, int maxBatchSize)
+{
+    if (!inData.uniqueFormat() || !outData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input and output varshapes must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (inData.uniqueFormat() != outData.uniqueFormat())
+    {
+        LOG_ERROR("Invalid output format " << outData.uniqueFormat() << ", it must be " << inData.uniqueFormat());
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (inData.uniqueFormat().numChannels() != 1 || GetLegacyDataType(inData.uniqueFormat()) != kCV_8U)
+    {
+        LOG_ERROR("Invalid format " << inData.uniqueFormat() << ", images must be single channel uint8");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (outData.numImages() != inData.numImages())
+    {
+        LOG_ERROR("Invalid number of output images " << outData.numImages() << ", it must be "
+                                                     << inData.numImages());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (inData.numImages() > maxBatchSize)
+    {
+        LOG_ERROR("Invalid number of images " << inData.numImages() << ", it must be at most " << maxBatchSize);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode checkTileGrid(int tilesX, int tilesY, int maxTilesX, int maxTilesY)
+{
+    if (tilesX < 1 || tilesY < 1 || tilesX > maxTilesX || tilesY > maxTilesY)
+    {
+        LOG_ERROR("Invalid tile grid " << tilesX << "x" << tilesY << ", it must be between 1x1 and " << maxTilesX
+                                       << "x" << maxTilesY);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t HistogramEq::calBufferSize(int maxBatchSize)
+{
+    return std::max(maxBatchSize, 0) * kHistogramBins * sizeof(int);
+}
+
+ErrorCode HistogramEq::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                             cudaStream_t stream)
+{
+    ErrorCode err = checkTensors(inData, outData, m_maxBatchSize);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    const int numImages = inAccess->numSamples();
+    if (numImages == 0 || inAccess->numRows() == 0 || inAccess->numCols() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    GpuWorkspaceLease workspace = gpuWorkspace(stream, calBufferSize(numImages));
+    auto             *hists     = workspace.as<int>();
+
+    histogramEqCaller(TensorImages(inData, outData, inAccess->numRows(), inAccess->numCols()), numImages,
+                      inAccess->numRows(), inAccess->numCols(), hists, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+size_t HistogramEqVarShape::calBufferSize(int maxBatchSize)
+{
+    return std::max(maxBatchSize, 0) * kHistogramBins * sizeof(int);
+}
+
+ErrorCode HistogramEqVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                     const IImageBatchVarShapeDataStridedCuda &outData, cudaStream_t stream)
+{
+    ErrorCode err = checkVarShapes(inData, outData, m_maxBatchSize);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    const int numImages = inData.numImages();
+    if (numImages == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    GpuWorkspaceLease workspace = gpuWorkspace(stream, calBufferSize(numImages));
+    auto             *hists     = workspace.as<int>();
+
+    histogramEqCaller(VarShapeImages(inData, outData), numImages, inData.maxSize().h, inData.maxSize().w, hists,
+                      stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+size_t CLAHE::calBufferSize(int maxBatchSize, int maxTilesX, int maxTilesY)
+{
+    return std::max(maxBatchSize, 0) * std::max(maxTilesX, 0) * std::max(maxTilesY, 0) * kHistogramBins;
+}
+
+ErrorCode CLAHE::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, float clipLimit,
+                       int tilesX, int tilesY, cudaStream_t stream)
+{
+    ErrorCode err = checkTensors(inData, outData, m_maxBatchSize);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    const int    numImages = inAccess->numSamples();
+    const Size2D size{static_cast<int>(inAccess->numCols()), static_cast<int>(inAccess->numRows())};
+
+    err = checkTileGrid(tilesX, tilesY, m_maxTilesX, m_maxTilesY);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (size.w < tilesX || size.h < tilesY)
+    {
+        LOG_ERROR("Invalid image size " << size.w << "x" << size.h << ", images must have at least one pixel per "
+                                        << "tile of the " << tilesX << "x" << tilesY << " grid");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (numImages == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    GpuWorkspaceLease workspace = gpuWorkspace(stream, calBufferSize(numImages, tilesX, tilesY));
+    auto             *luts      = workspace.as<uchar>();
+
+    claheCaller(TensorImages(inData, outData, size.h, size.w), numImages, size.h, size.w, clipLimit, tilesX, tilesY,
+                luts, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+size_t CLAHEVarShape::calBufferSize(int maxBatchSize, int maxTilesX, int maxTilesY)
+{
+    return std::max(maxBatchSize, 0) * std::max(maxTilesX, 0) * std::max(maxTilesY, 0) * kHistogramBins;
+}
+
+ErrorCode CLAHEVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                               const IImageBatchVarShapeDataStridedCuda &outData, float clipLimit, int tilesX,
+                               int tilesY, cudaStream_t stream)
+{
+    ErrorCode err = checkVarShapes(inData, outData, m_maxBatchSize);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    err = checkTileGrid(tilesX, tilesY, m_maxTilesX, m_maxTilesY);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    const int numImages = inData.numImages();
+    if (numImages == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    GpuWorkspaceLease workspace = gpuWorkspace(stream, calBufferSize(numImages, tilesX, tilesY));
+    auto             *luts      = workspace.as<uchar>();
+
+    claheCaller(VarShapeImages(inData, outData), numImages, inData.maxSize().h, inData.maxSize().w, clipLimit, tilesX,
+                tilesY, luts, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,632 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "ReduceUtils.cuh"
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Blocks have one thread per row of the exact hash, and per first pass DCT coefficient of the perceptual hash
+constexpr int kBlockSize = kReduceBlockW * kReduceBlockH;
+
+// Thumbnails of the perceptual hashes
+constexpr int kDHashW = 9, kDHashH = 8;
+constexpr int kPHashSize = 32, kPHashLowFreqs = 8;
+
+static_assert(kBlockSize == kPHashLowFreqs * kPHashSize, "blocks must have one thread per DCT first pass value");
+
+// XXH64 primes
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+__device__ __forceinline__ uint64_t Rotl(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+__device__ __forceinline__ uint64_t XXH64Round(uint64_t acc, uint64_t input)
+{
+    return Rotl(acc + input * kPrime2, 31) * kPrime1;
+}
+
+__device__ __forceinline__ uint64_t XXH64Merge(uint64_t acc, uint64_t v)
+{
+    return (acc ^ XXH64Round(0, v)) * kPrime1 + kPrime4;
+}
+
+// Little-endian loads, rows aren't necessarily aligned
+template<typename T>
+__device__ __forceinline__ T Load(const uchar *p, bool aligned)
+{
+    if (aligned)
+    {
+        return *reinterpret_cast<const T *>(p);
+    }
+
+    T v = 0;
+#pragma unroll
+    for (int i = 0; i < static_cast<int>(sizeof(T)); ++i)
+    {
+        v |= static_cast<T>(p[i]) << (8 * i);
+    }
+    return v;
+}
+
+// XXH64 of the len bytes at p, https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+__device__ uint64_t XXH64(const uchar *p, int64_t len, uint64_t seed)
+{
+    // Once p is aligned, all 8 and 4-byte loads are
+    const bool   aligned = reinterpret_cast<uintptr_t>(p) % sizeof(uint64_t) == 0;
+    const uchar *end     = p + len;
+    uint64_t     h;
+
+    if (len >= 32)
+    {
+        uint64_t v1 = seed + kPrime1 + kPrime2, v2 = seed + kPrime2, v3 = seed, v4 = seed - kPrime1;
+        for (; p + 32 <= end; p += 32)
+        {
+            v1 = XXH64Round(v1, Load<uint64_t>(p, aligned));
+            v2 = XXH64Round(v2, Load<uint64_t>(p + 8, aligned));
+            v3 = XXH64Round(v3, Load<uint64_t>(p + 16, aligned));
+            v4 = XXH64Round(v4, Load<uint64_t>(p + 24, aligned));
+        }
+        h = Rotl(v1, 1) + Rotl(v2, 7) + Rotl(v3, 12) + Rotl(v4, 18);
+        h = XXH64Merge(h, v1);
+        h = XXH64Merge(h, v2);
+        h = XXH64Merge(h, v3);
+        h = XXH64Merge(h, v4);
+    }
+    else
+    {
+        h = seed + kPrime5;
+    }
+
+    h += static_cast<uint64_t>(len);
+
+    for (; p + 8 <= end; p += 8)
+    {
+        h ^= XXH64Round(0, Load<uint64_t>(p, aligned));
+        h = Rotl(h, 27) * kPrime1 + kPrime4;
+    }
+    if (p + 4 <= end)
+    {
+        h ^= Load<uint32_t>(p, aligned) * kPrime1;
+        h = Rotl(h, 23) * kPrime2 + kPrime3;
+        p += 4;
+    }
+    for (; p < end; ++p)
+    {
+        h ^= *p * kPrime5;
+        h = Rotl(h, 11) * kPrime1;
+    }
+
+    h ^= h >> 33;
+    h *= kPrime2;
+    h ^= h >> 29;
+    h *= kPrime3;
+    h ^= h >> 32;
+    return h;
+}
+
+struct AddHashes
+{
+    __device__ uint64_t operator()(uint64_t a, uint64_t b) const
+    {
+        return a + b;
+    }
+};
+
+// Rows of the samples of an interleaved tensor
+struct TensorImages
+{
+    __device__ int numRows(int n) const
+    {
+        return rows;
+    }
+
+    __device__ int numCols(int n) const
+    {
+        return cols;
+    }
+
+    __device__ const uchar *row(int n, int y) const
+    {
+        return data + n * sampleStride + y * rowStride;
+    }
+
+    const uchar *data;
+    int64_t      sampleStride, rowStride;
+    int          rows, cols;
+};
+
+// Rows of the images of a varshape batch, all with a single plane
+struct VarShapeImages
+{
+    __device__ int numRows(int n) const
+    {
+        return imgs[n].planes[0].height;
+    }
+
+    __device__ int numCols(int n) const
+    {
+        return imgs[n].planes[0].width;
+    }
+
+    __device__ const uchar *row(int n, int y) const
+    {
+        return imgs[n].planes[0].basePtr + static_cast<int64_t>(imgs[n].planes[0].rowStride) * y;
+    }
+
+    const NVCVImageBufferStrided *imgs;
+};
+
+using HashWrap = nvcv::cuda::Tensor3DWrap<uint64_t>;
+
+__global__ void clearHashesKernel(HashWrap hashes, int numImages)
+{
+    const int n = blockIdx.x * blockDim.x + threadIdx.x;
+    if (n < numImages)
+    {
+        *hashes.ptr(n, 0, 0) = 0;
+    }
+}
+
+// blockIdx.x is the image, whose rows are split among gridDim.y blocks.  Each thread hashes whole rows, seeded with
+// their index so that swapped rows change the hash, and the row hashes are summed into the output.
+template<class Images>
+__global__ void exactHashRowsKernel(Images imgs, int pixelBytes, HashWrap hashes)
+{
+    const int n    = blockIdx.x;
+    const int rows = imgs.numRows(n);
+
+    const int64_t rowBytes = static_cast<int64_t>(imgs.numCols(n)) * pixelBytes;
+
+    uint64_t sum = 0;
+    for (int y = blockIdx.y * kBlockSize + get_lid(); y < rows; y += gridDim.y * kBlockSize)
+    {
+        sum += XXH64(imgs.row(n, y), rowBytes, y);
+    }
+
+    sum = BlockReduce(sum, AddHashes{});
+    if (get_lid() == 0)
+    {
+        atomicAdd(reinterpret_cast<unsigned long long *>(hashes.ptr(n, 0, 0)), sum);
+    }
+}
+
+// The sum of the row hashes is hashed with the image size, so that images whose rows are split differently don't
+// collide.
+template<class Images>
+__global__ void exactHashFinalKernel(Images imgs, int pixelBytes, HashWrap hashes, int numImages)
+{
+    const int n = blockIdx.x * blockDim.x + threadIdx.x;
+    if (n >= numImages)
+    {
+        return;
+    }
+
+    uint64_t *hash = hashes.ptr(n, 0, 0);
+
+    const uint64_t words[3] = {*hash, static_cast<uint64_t>(imgs.numRows(n)),
+                               static_cast<uint64_t>(imgs.numCols(n)) * pixelBytes};
+
+    *hash = XXH64(reinterpret_cast<const uchar *>(words), sizeof(words), 0);
+}
+
+// First pixel of thumbnail cell c, when size pixels are split in cells.  Pixel i is in cell i * cells / size.
+__device__ __forceinline__ int CellBegin(int c, int size, int cells)
+{
+    return (static_cast<int64_t>(c) * size + cells - 1) / cells;
+}
+
+__device__ __forceinline__ int CellSize(int c, int size, int cells)
+{
+    return CellBegin(c + 1, size, cells) - CellBegin(c, size, cells);
+}
+
+// Gray level times 256 of a pixel, three and four channel pixels are RGB, BT.601 luma weights
+__device__ __forceinline__ uint32_t Gray256(const uchar *p, int channels)
+{
+    return channels == 1 ? p[0] * 256u : 77u * p[0] + 150u * p[1] + 29u * p[2];
+}
+
+// Sums the gray levels of the pixels in each cell of a W x H thumbnail of image n.  Each warp sums whole rows, with
+// contiguous segments per lane, which cross few cells and are added as they're left.  Sums are integers, so that
+// they don't depend on the order they're added in.
+template<int W, int H, class Images>
+__device__ void ThumbnailSums(const Images &imgs, int n, int channels, unsigned long long *sums)
+{
+    const int lid = get_lid();
+    for (int i = lid; i < W * H; i += kBlockSize)
+    {
+        sums[i] = 0;
+    }
+    __syncthreads();
+
+    const int rows = imgs.numRows(n);
+    const int cols = imgs.numCols(n);
+
+    const int segment = (cols + kReduceBlockW - 1) / kReduceBlockW;
+    const int xBegin  = threadIdx.x * segment;
+    const int xEnd    = min(cols, xBegin + segment);
+
+    for (int y = threadIdx.y; y < rows; y += kReduceBlockH)
+    {
+        const uchar *row   = imgs.row(n, y);
+        const int    cellY = static_cast<int64_t>(y) * H / rows;
+
+        int      cellX = -1;
+        uint64_t acc   = 0;
+        for (int x = xBegin; x < xEnd; ++x)
+        {
+            const int cx = static_cast<int64_t>(x) * W / cols;
+            if (cx != cellX)
+            {
+                if (cellX >= 0)
+                {
+                    atomicAdd(&sums[cellY * W + cellX], acc);
+                }
+                cellX = cx;
+                acc   = 0;
+            }
+            acc += Gray256(row + x * channels, channels);
+        }
+        if (cellX >= 0)
+        {
+            atomicAdd(&sums[cellY * W + cellX], acc);
+        }
+    }
+    __syncthreads();
+}
+
+// Writes the 64 bits computed by the first 64 threads of the block, bit i by thread i.
+__device__ void StoreHashBits(bool bit, uint64_t *hash)
+{
+    __shared__ unsigned int words[2];
+
+    const int lid = get_lid();
+    if (lid < 64)
+    {
+        const unsigned int w = __ballot_sync(0xFFFFFFFF, bit);
+        if (lid % 32 == 0)
+        {
+            words[lid / 32] = w;
+        }
+    }
+    __syncthreads();
+
+    if (lid == 0)
+    {
+        *hash = static_cast<uint64_t>(words[1]) << 32 | words[0];
+    }
+}
+
+// One block per image, bit 8*y + x tells whether the thumbnail gets brighter from (x, y) to (x+1, y)
+template<class Images>
+__global__ void dHashKernel(Images imgs, int channels, HashWrap hashes)
+{
+    __shared__ unsigned long long sums[kDHashW * kDHashH];
+
+    const int n = blockIdx.x;
+    ThumbnailSums<kDHashW, kDHashH>(imgs, n, channels, sums);
+
+    const int lid = get_lid();
+    bool      bit = false;
+    if (lid < 64)
+    {
+        const int x = lid % 8, y = lid / 8;
+        const int cols = imgs.numCols(n);
+
+        // Averages compared by cross-multiplying the sums with the widths of the cells, their heights are the same
+        const uint64_t w0 = CellSize(x, cols, kDHashW);
+        const uint64_t w1 = CellSize(x + 1, cols, kDHashW);
+
+        bit = sums[y * kDHashW + x + 1] * w0 > sums[y * kDHashW + x] * w1;
+    }
+
+    StoreHashBits(bit, hashes.ptr(n, 0, 0));
+}
+
+// One block per image, bit 8*v + u tells whether the DCT coefficient (u, v) of the thumbnail is above the median of
+// the 8x8 lowest frequency ones.  The DCT is computed on these frequencies only, by columns then by rows.
+template<class Images>
+__global__ void pHashKernel(Images imgs, int channels, HashWrap hashes)
+{
+    __shared__ unsigned long long sums[kPHashSize * kPHashSize];
+    __shared__ float              thumb[kPHashSize * kPHashSize];
+    __shared__ float              cosines[kPHashLowFreqs][kPHashSize];
+    __shared__ float              columns[kPHashLowFreqs][kPHashSize];
+    __shared__ float              coefs[kPHashLowFreqs * kPHashLowFreqs];
+    __shared__ float              middle[2];
+
+    const int n   = blockIdx.x;
+    const int lid = get_lid();
+
+    // cos((2i+1) k pi / 2N) for frequency k and thumbnail pixel i
+    const int k = lid / kPHashSize, i = lid % kPHashSize;
+    cosines[k][i] = cospif((2 * i + 1) * k / (2.f * kPHashSize));
+
+    ThumbnailSums<kPHashSize, kPHashSize>(imgs, n, channels, sums);
+
+    const int rows = imgs.numRows(n);
+    const int cols = imgs.numCols(n);
+    for (int c = lid; c < kPHashSize * kPHashSize; c += kBlockSize)
+    {
+        const int count = CellSize(c % kPHashSize, cols, kPHashSize) * CellSize(c / kPHashSize, rows, kPHashSize);
+        thumb[c]        = count > 0 ? sums[c] / (256.f * count) : 0.f;
+    }
+    __syncthreads();
+
+    // Frequency k along the columns, of column i
+    float acc = 0;
+    for (int y = 0; y < kPHashSize; ++y)
+    {
+        acc += thumb[y * kPHashSize + i] * cosines[k][y];
+    }
+    columns[k][i] = acc;
+    __syncthreads();
+
+    float coef = 0;
+    if (lid < 64)
+    {
+        const int u = lid % kPHashLowFreqs, v = lid / kPHashLowFreqs;
+        for (int x = 0; x < kPHashSize; ++x)
+        {
+            coef += columns[v][x] * cosines[u][x];
+        }
+        coefs[lid] = coef;
+    }
+    __syncthreads();
+
+    // The median is the average of the two middle coefficients, found by their ranks, ties broken by index
+    if (lid < 64)
+    {
+        int rank = 0;
+        for (int j = 0; j < 64; ++j)
+        {
+            rank += coefs[j] < coef || (coefs[j] == coef && j < lid);
+        }
+        if (rank == 31 || rank == 32)
+        {
+            middle[rank - 31] = coef;
+        }
+    }
+    __syncthreads();
+
+    StoreHashBits(lid < 64 && coef > (middle[0] + middle[1]) / 2, hashes.ptr(n, 0, 0));
+}
+
+template<class Images>
+void imageHashCaller(const Images &imgs, int numImages, int maxRows, int pixelBytes, int channels,
+                     NVCVImageHashType type, const HashWrap &hashes, cudaStream_t stream)
+{
+    dim3 block(kReduceBlockW, kReduceBlockH);
+
+    switch (type)
+    {
+    case NVCV_IMAGE_HASH_EXACT:
+    {
+        const int numBlocks = std::min(divUp(maxRows, kBlockSize), std::max(1, kMaxReduceBlocks / numImages));
+
+        clearHashesKernel<<<divUp(numImages, kBlockSize), kBlockSize, 0, stream>>>(hashes, numImages);
+        checkKernelErrors();
+
+        exactHashRowsKernel<<<dim3(numImages, std::max(numBlocks, 1)), block, 0, stream>>>(imgs, pixelBytes, hashes);
+        checkKernelErrors();
+
+        exactHashFinalKernel<<<divUp(numImages, kBlockSize), kBlockSize, 0, stream>>>(imgs, pixelBytes, hashes,
+                                                                                      numImages);
+        checkKernelErrors();
+        break;
+    }
+
+    case NVCV_IMAGE_HASH_DHASH:
+        dHashKernel<<<numImages, block, 0, stream>>>(imgs, channels, hashes);
+        checkKernelErrors();
+        break;
+
+    case NVCV_IMAGE_HASH_PHASH:
+        pHashKernel<<<numImages, block, 0, stream>>>(imgs, channels, hashes);
+        checkKernelErrors();
+        break;
+    }
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
+ErrorCode checkHashType(NVCVImageHashType type)
+{
+    if (type != NVCV_IMAGE_HASH_EXACT && type != NVCV_IMAGE_HASH_DHASH && type != NVCV_IMAGE_HASH_PHASH)
+    {
+        LOG_ERROR("Invalid image hash type " << type);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+// Perceptual hashes need 8-bit gray, RGB or RGBA images
+ErrorCode checkPerceptualInput(NVCVImageHashType type, nvcv::DataType channelType, int channels)
+{
+    if (type == NVCV_IMAGE_HASH_EXACT)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    if (channelType != nvcv::TYPE_U8)
+    {
+        LOG_ERROR("Invalid DataType " << channelType << ", perceptual hashes need uint8 images");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (channels != 1 && channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels << ", perceptual hashes need 1, 3 or 4 channels");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode checkHashOutput(const nvcv::ITensorDataStridedCuda &outData, int numImages, HashWrap &hashes)
+{
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(outData);
+    if (!access)
+    {
+        LOG_ERROR("Invalid output DataFormat");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (outData.dtype() != nvcv::TYPE_U64)
+    {
+        LOG_ERROR("Invalid output DataType " << outData.dtype() << ", it must be uint64");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (access->numSamples() != numImages || access->numRows() != 1 || access->numCols() != 1
+        || access->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must have " << numImages
+                                          << " samples of 1 element");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    hashes = nvcv::cuda::CreateTensorWrapNHW<uint64_t>(outData);
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+ErrorCode ImageHash::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                           NVCVImageHashType type, cudaStream_t stream)
+{
+    ErrorCode err = checkHashType(type);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    DataFormat format = GetLegacyDataFormat(inData.layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    const int channels   = inAccess->numChannels() * inData.dtype().numChannels();
+    const int pixelBytes = inAccess->numChannels() * inData.dtype().strideBytes();
+
+    // Rows are hashed as contiguous bytes
+    if (inAccess->numCols() > 1 && inAccess->colStride() != pixelBytes)
+    {
+        LOG_ERROR("Invalid input strides, pixels of a row must be packed");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if ((err = checkPerceptualInput(type, inData.dtype().channelType(0), channels)) != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    const int minWidth  = type == NVCV_IMAGE_HASH_DHASH ? kDHashW : type == NVCV_IMAGE_HASH_PHASH ? kPHashSize : 0;
+    const int minHeight = type == NVCV_IMAGE_HASH_DHASH ? kDHashH : type == NVCV_IMAGE_HASH_PHASH ? kPHashSize : 0;
+    if (inAccess->numCols() < minWidth || inAccess->numRows() < minHeight)
+    {
+        LOG_ERROR("Invalid input size " << inAccess->numCols() << "x" << inAccess->numRows()
+                                        << ", it must be at least " << minWidth << "x" << minHeight);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const int numImages = inAccess->numSamples();
+
+    HashWrap hashes;
+    if ((err = checkHashOutput(outData, numImages, hashes)) != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (numImages == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    TensorImages imgs{reinterpret_cast<const uchar *>(inData.basePtr()), inAccess->sampleStride(),
+                      inAccess->rowStride(), inAccess->numRows(), inAccess->numCols()};
+
+    imageHashCaller(imgs, numImages, inAccess->numRows(), pixelBytes, channels, type, hashes, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode ImageHashVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                   const ITensorDataStridedCuda &outData, NVCVImageHashType type, cudaStream_t stream)
+{
+    ErrorCode err = checkHashType(type);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    const nvcv::ImageFormat format = inData.uniqueFormat();
+    if (!format || format.numPlanes() != 1)
+    {
+        LOG_ERROR("Images in the input varshape must all have the same single plane format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    err = checkPerceptualInput(type, format.planeDataType(0).channelType(0), format.numChannels());
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    const int numImages = inData.numImages();
+
+    HashWrap hashes;
+    if ((err = checkHashOutput(outData, numImages, hashes)) != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (numImages == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    imageHashCaller(VarShapeImages{inData.imageList()}, numImages, inData.maxSize().h,
+                    format.planePixelStrideBytes(0), format.numChannels(), type, hashes, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,690 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+#include <cmath>
+#include <type_traits>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// The integral image is the prefix sum of the rows followed by the prefix sum of the columns, both computed by
+// single-pass scans with decoupled look-back: each tile of a row or column publishes its own sum as soon as it's
+// known, and its inclusive prefix once it has looked back at the tiles before it, so that the tiles after it
+// rarely wait for more than their direct predecessor.
+
+// Status of a tile of a look-back scan.
+constexpr int kTileInvalid   = 0; //!< nothing published yet
+constexpr int kTileAggregate = 1; //!< sum of the tile alone
+constexpr int kTilePrefix    = 2; //!< sum of the tile and all the tiles before it
+
+// Row scans: tiles of kRowThreads x kRowItems consecutive pixels of a row.
+constexpr int kRowThreads = 256;
+constexpr int kRowItems   = 4;
+constexpr int kRowTile    = kRowThreads * kRowItems;
+
+// Column scans: tiles of kColThreadsX columns x kColTileH rows, each thread sums kColItems rows of its column.
+constexpr int kColThreadsX = 32;
+constexpr int kColThreadsY = 8;
+constexpr int kColTileH    = 64;
+constexpr int kColItems    = kColTileH / kColThreadsY;
+
+// Integer sums are accumulated modulo 2^32, so that differences of the integral image, i.e. box sums, are exact
+// even when it overflows.
+template<typename S>
+using IntegralWorkType = std::conditional_t<std::is_integral_v<S>, uint32_t, S>;
+
+// Look-back state of a scan, one lane per tile, the tiles of a row or a column being consecutive lanes.
+template<typename W>
+struct ScanState
+{
+    int *counter; //!< next tile to be scanned, tiles start in the order of their dependencies
+    int *status;
+    W   *aggregate;
+    W   *inclusive;
+};
+
+// Rounds bytes up so that the array after them is aligned for sums of up to 8 bytes.
+inline size_t AlignBytes(size_t bytes)
+{
+    return (bytes + sizeof(double) - 1) / sizeof(double) * sizeof(double);
+}
+
+// Number of lanes needed by both scans of images of the given size.
+inline size_t ScanLanes(int numSamples, int2 size)
+{
+    const size_t rowLanes = (size_t)numSamples * size.y * divUp(size.x, kRowTile);
+    const size_t colLanes = (size_t)numSamples * divUp(size.x, kColThreadsX) * kColThreadsX * divUp(size.y, kColTileH);
+    return std::max(rowLanes, colLanes);
+}
+
+// Bytes of the state of the scans, with room for sums of up to 8 bytes.
+inline size_t ScanStateSize(int numSamples, int2 size)
+{
+    const size_t lanes = ScanLanes(numSamples, size);
+    return 2 * sizeof(double) + AlignBytes(lanes * sizeof(int)) + 2 * lanes * sizeof(double);
+}
+
+template<typename W>
+ScanState<W> MakeScanState(void *workspace, int numSamples, int2 size)
+{
+    const size_t lanes = ScanLanes(numSamples, size);
+
+    auto *base   = static_cast<char *>(workspace);
+    auto *status = base + 2 * sizeof(double);
+    auto *values = status + AlignBytes(lanes * sizeof(int));
+
+    return ScanState<W>{reinterpret_cast<int *>(base), reinterpret_cast<int *>(status), reinterpret_cast<W *>(values),
+                        reinterpret_cast<W *>(values + lanes * sizeof(double))};
+}
+
+template<typename W>
+__device__ void PublishTile(const ScanState<W> &state, int lane, W value, int status)
+{
+    W *values = status == kTilePrefix ? state.inclusive : state.aggregate;
+
+    *reinterpret_cast<volatile W *>(&values[lane]) = value;
+    __threadfence();
+    *reinterpret_cast<volatile int *>(&state.status[lane]) = status;
+}
+
+// Exclusive prefix of tile k of the chain of tiles starting at lane base.
+template<typename W>
+__device__ W LookBack(const ScanState<W> &state, int base, int k)
+{
+    W prefix = 0;
+
+    for (int lane = base + k - 1; lane >= base; --lane)
+    {
+        int status;
+        do
+        {
+            status = *reinterpret_cast<volatile int *>(&state.status[lane]);
+        }
+        while (status == kTileInvalid);
+
+        __threadfence();
+
+        if (status == kTilePrefix)
+        {
+            return prefix + *reinterpret_cast<volatile W *>(&state.inclusive[lane]);
+        }
+        prefix += *reinterpret_cast<volatile W *>(&state.aggregate[lane]);
+    }
+    return prefix;
+}
+
+// Publishes the sum of tile k and returns the sum of the tiles before it.
+template<typename W>
+__device__ W ScanTile(const ScanState<W> &state, int base, int k, W total)
+{
+    if (k == 0)
+    {
+        PublishTile(state, base, total, kTilePrefix);
+        return 0;
+    }
+
+    PublishTile(state, base + k, total, kTileAggregate);
+    const W prefix = LookBack(state, base, k);
+    PublishTile(state, base + k, prefix + total, kTilePrefix);
+    return prefix;
+}
+
+// Prefix sum of each row of the input, or of its squares, written at (y + 1, x + 1) of the output. The first row
+// and column of the output are set to 0.
+template<bool Square, typename T, typename S>
+__global__ void integralRows(nvcv::cuda::Tensor3DWrap<const T> in, nvcv::cuda::Tensor3DWrap<S> out, int2 size,
+                             int tilesPerRow, ScanState<IntegralWorkType<S>> state)
+{
+    using W = IntegralWorkType<S>;
+
+    __shared__ int sTile;
+    __shared__ W   sWarpSums[kRowThreads / 32];
+    __shared__ W   sPrefix;
+
+    const int tid = threadIdx.x;
+    if (tid == 0)
+    {
+        sTile = atomicAdd(state.counter, 1);
+    }
+    __syncthreads();
+
+    const int row = sTile / tilesPerRow;
+    const int k   = sTile % tilesPerRow;
+    const int z   = row / size.y;
+    const int y   = row % size.y;
+    const int x0  = k * kRowTile + tid * kRowItems;
+
+    W items[kRowItems];
+    W sum = 0;
+#pragma unroll
+    for (int i = 0; i < kRowItems; ++i)
+    {
+        W v = x0 + i < size.x ? static_cast<W>(*in.ptr(z, y, x0 + i)) : W{0};
+        if constexpr (Square)
+        {
+            v *= v;
+        }
+        sum += v;
+        items[i] = sum;
+    }
+
+    // exclusive scan of the thread sums in the block
+    const int lane = tid % 32;
+    const int warp = tid / 32;
+
+    W inclusive = sum;
+#pragma unroll
+    for (int d = 1; d < 32; d *= 2)
+    {
+        const W v = __shfl_up_sync(0xffffffff, inclusive, d);
+        if (lane >= d)
+        {
+            inclusive += v;
+        }
+    }
+    W exclusive = __shfl_up_sync(0xffffffff, inclusive, 1);
+    if (lane == 0)
+    {
+        exclusive = 0;
+    }
+
+    if (lane == 31)
+    {
+        sWarpSums[warp] = inclusive;
+    }
+    __syncthreads();
+
+    W total = 0;
+#pragma unroll
+    for (int w = 0; w < kRowThreads / 32; ++w)
+    {
+        if (w == warp)
+        {
+            exclusive += total;
+        }
+        total += sWarpSums[w];
+    }
+
+    if (tid == 0)
+    {
+        sPrefix = ScanTile(state, row * tilesPerRow, k, total);
+    }
+    __syncthreads();
+
+    const W prefix = sPrefix + exclusive;
+#pragma unroll
+    for (int i = 0; i < kRowItems; ++i)
+    {
+        if (x0 + i < size.x)
+        {
+            *out.ptr(z, y + 1, x0 + i + 1) = static_cast<S>(prefix + items[i]);
+            if (y == 0)
+            {
+                *out.ptr(z, 0, x0 + i + 1) = 0;
+            }
+        }
+    }
+    if (k == 0 && tid == 0)
+    {
+        *out.ptr(z, y + 1, 0) = 0;
+        if (y == 0)
+        {
+            *out.ptr(z, 0, 0) = 0;
+        }
+    }
+}
+
+// Prefix sum of each column of the output of integralRows, in place, rows and columns 1 to size.
+template<typename S>
+__global__ void integralCols(nvcv::cuda::Tensor3DWrap<S> out, int2 size, int stripsPerSample, int tilesPerCol,
+                             ScanState<IntegralWorkType<S>> state)
+{
+    using W = IntegralWorkType<S>;
+
+    __shared__ int sTile;
+    __shared__ W   sSums[kColThreadsY][kColThreadsX];
+    __shared__ W   sPrefix[kColThreadsX];
+
+    const int tx = threadIdx.x;
+    const int ty = threadIdx.y;
+    if (tx == 0 && ty == 0)
+    {
+        sTile = atomicAdd(state.counter, 1);
+    }
+    __syncthreads();
+
+    // tiles of a strip of columns are consecutive, each column of the strip is a chain of lanes
+    const int strip = sTile / tilesPerCol;
+    const int k     = sTile % tilesPerCol;
+    const int z     = strip / stripsPerSample;
+    const int x     = 1 + (strip % stripsPerSample) * kColThreadsX + tx;
+    const int y0    = 1 + k * kColTileH + ty * kColItems;
+
+    const bool inside = x <= size.x;
+
+    W items[kColItems];
+    W sum = 0;
+#pragma unroll
+    for (int i = 0; i < kColItems; ++i)
+    {
+        if (inside && y0 + i <= size.y)
+        {
+            sum += static_cast<W>(*out.ptr(z, y0 + i, x));
+        }
+        items[i] = sum;
+    }
+
+    sSums[ty][tx] = sum;
+    __syncthreads();
+
+    W exclusive = 0, total = 0;
+#pragma unroll
+    for (int r = 0; r < kColThreadsY; ++r)
+    {
+        if (r == ty)
+        {
+            exclusive = total;
+        }
+        total += sSums[r][tx];
+    }
+
+    if (ty == 0)
+    {
+        sPrefix[tx] = ScanTile(state, (strip * kColThreadsX + tx) * tilesPerCol, k, total);
+    }
+    __syncthreads();
+
+    const W prefix = sPrefix[tx] + exclusive;
+#pragma unroll
+    for (int i = 0; i < kColItems; ++i)
+    {
+        if (inside && y0 + i <= size.y)
+        {
+            *out.ptr(z, y0 + i, x) = static_cast<S>(prefix + items[i]);
+        }
+    }
+}
+
+// Integral image of the input, or of its squares, in out with numSamples x (size.y + 1) x (size.x + 1) elements.
+template<bool Square, typename T, typename S>
+void IntegralImage(nvcv::cuda::Tensor3DWrap<const T> in, nvcv::cuda::Tensor3DWrap<S> out, int numSamples, int2 size,
+                   void *workspace, cudaStream_t stream)
+{
+    using W = IntegralWorkType<S>;
+
+    const ScanState<W> state = MakeScanState<W>(workspace, numSamples, int2{size.x, size.y});
+    const size_t       lanes = ScanLanes(numSamples, size);
+
+    const int tilesPerRow = divUp(size.x, kRowTile);
+
+    checkCudaErrors(cudaMemsetAsync(state.counter, 0, sizeof(int), stream));
+    checkCudaErrors(cudaMemsetAsync(state.status, 0, lanes * sizeof(int), stream));
+
+    integralRows<Square><<<numSamples * size.y * tilesPerRow, kRowThreads, 0, stream>>>(in, out, size, tilesPerRow,
+                                                                                       state);
+    checkKernelErrors();
+
+    const int stripsPerSample = divUp(size.x, kColThreadsX);
+    const int tilesPerCol     = divUp(size.y, kColTileH);
+
+    checkCudaErrors(cudaMemsetAsync(state.counter, 0, sizeof(int), stream));
+    checkCudaErrors(cudaMemsetAsync(state.status, 0, lanes * sizeof(int), stream));
+
+    dim3 block(kColThreadsX, kColThreadsY);
+    integralCols<<<numSamples * stripsPerSample * tilesPerCol, block, 0, stream>>>(out, size, stripsPerSample,
+                                                                                  tilesPerCol, state);
+    checkKernelErrors();
+}
+
+template<bool Square, typename T, typename S>
+void IntegralCaller(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, int numSamples,
+                   int2 size, void *workspace, cudaStream_t stream)
+{
+    IntegralImage<Square>(nvcv::cuda::CreateTensorWrapNHW<const T>(inData), nvcv::cuda::CreateTensorWrapNHW<S>(outData),
+                          numSamples, size, workspace, stream);
+}
+
+// The sum of the block_size x block_size window around each pixel is read from the integral image, the window
+// being clipped to the image.
+__global__ void adaptiveThresholdKernel(nvcv::cuda::Tensor3DWrap<const uchar> in, nvcv::cuda::Tensor3DWrap<uchar> out,
+                                        nvcv::cuda::Tensor3DWrap<const uint32_t> integral, int2 size, int radius,
+                                        uchar maxValue, bool inverse, int delta)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int z = blockIdx.z;
+
+    if (x >= size.x || y >= size.y)
+        return;
+
+    const int x0 = max(x - radius, 0);
+    const int x1 = min(x + radius + 1, size.x);
+    const int y0 = max(y - radius, 0);
+    const int y1 = min(y + radius + 1, size.y);
+
+    const uint32_t sum = *integral.ptr(z, y1, x1) - *integral.ptr(z, y0, x1) - *integral.ptr(z, y1, x0)
+                       + *integral.ptr(z, y0, x0);
+
+    const int mean = __double2int_rn(static_cast<double>(sum) / ((x1 - x0) * (y1 - y0)));
+
+    // as in OpenCV, the pixel is above the threshold when it's above the rounded mean minus the rounded c
+    const bool above = *in.ptr(z, y, x) - mean > -delta;
+
+    *out.ptr(z, y, x) = above != inverse ? maxValue : 0;
+}
+
+ErrorCode checkFormat(const ITensorDataStridedCuda &data, const char *name)
+{
+    DataFormat format = GetLegacyDataFormat(data.layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid " << name << " DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+// Checks the shape of a single-channel image tensor.
+ErrorCode checkShape(const ITensorDataStridedCuda &data, int numSamples, int rows, int cols, const char *name)
+{
+    auto access = TensorDataAccessStridedImagePlanar::Create(data);
+    NVCV_ASSERT(access);
+
+    if (access->numSamples() != numSamples || access->numRows() != rows || access->numCols() != cols
+        || access->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid " << name << " shape " << data.shape() << ", it must have " << numSamples << " samples of "
+                             << cols << "x" << rows << " pixels with 1 channel");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+// Checks the input of both operators against the maximum sizes given at their construction.
+ErrorCode checkInput(const ITensorDataStridedCuda &inData, int maxBatchSize, Size2D maxSize, int &numSamples,
+                     int2 &size)
+{
+    if (ErrorCode err = checkFormat(inData, "input"); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    numSamples = inAccess->numSamples();
+    size       = int2{inAccess->numCols(), inAccess->numRows()};
+
+    if (inAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid channel number " << inAccess->numChannels() << ", it must be 1");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (numSamples > maxBatchSize || size.x > maxSize.w || size.y > maxSize.h)
+    {
+        LOG_ERROR("Invalid input shape " << inData.shape() << ", it exceeds the maximum batch size " << maxBatchSize
+                                         << " or size " << maxSize.w << "x" << maxSize.h);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+// Integral --------------------------------------------------------------------
+
+Integral::Integral(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size, Size2D max_size)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_maxBatchSize(max_batch_size)
+    , m_maxSize(max_size)
+{
+    setGpuWorkspaceSize(calBufferSize(max_batch_size, max_size));
+}
+
+size_t Integral::calBufferSize(int max_batch_size, Size2D max_size)
+{
+    if (max_batch_size <= 0 || max_size.w <= 0 || max_size.h <= 0)
+    {
+        return 0;
+    }
+    return ScanStateSize(max_batch_size, int2{max_size.w, max_size.h});
+}
+
+ErrorCode Integral::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &sumData,
+                          const ITensorDataStridedCuda *sqsumData, cudaStream_t stream)
+{
+    int  numSamples;
+    int2 size;
+    if (ErrorCode err = checkInput(inData, m_maxBatchSize, m_maxSize, numSamples, size); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    DataType data_type = GetLegacyDataType(inData.dtype());
+    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_16S || data_type == kCV_32F))
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    DataType sum_type = GetLegacyDataType(sumData.dtype());
+    if (!(sum_type == kCV_32F || sum_type == kCV_64F || (sum_type == kCV_32S && data_type != kCV_32F)))
+    {
+        LOG_ERROR("Invalid sum DataType " << sum_type << ", it must be float32, float64, or int32 for integer inputs");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    DataType sqsum_type = sqsumData ? GetLegacyDataType(sqsumData->dtype()) : kCV_64F;
+    if (!(sqsum_type == kCV_32F || sqsum_type == kCV_64F))
+    {
+        LOG_ERROR("Invalid squared sum DataType " << sqsum_type << ", it must be float32 or float64");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    for (auto [data, name] : {std::make_pair(&sumData, "sum"), std::make_pair(sqsumData, "squared sum")})
+    {
+        if (data == nullptr)
+        {
+            continue;
+        }
+        if (ErrorCode err = checkFormat(*data, name); err != ErrorCode::SUCCESS)
+        {
+            return err;
+        }
+        if (ErrorCode err = checkShape(*data, numSamples, size.y + 1, size.x + 1, name); err != ErrorCode::SUCCESS)
+        {
+            return err;
+        }
+    }
+
+    if (numSamples == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+    if (size.x == 0 || size.y == 0)
+    {
+        // the integral images are all zeros
+        for (const ITensorDataStridedCuda *data : {&sumData, sqsumData})
+        {
+            if (data)
+            {
+                auto access = TensorDataAccessStridedImagePlanar::Create(*data);
+                NVCV_ASSERT(access);
+                checkCudaErrors(cudaMemset2DAsync(data->basePtr(), access->rowStride(), 0,
+                                                  access->numCols() * data->dtype().strideBytes(),
+                                                  access->numSamples() * access->numRows(), stream));
+            }
+        }
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*integral_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                               int numSamples, int2 size, void *workspace, cudaStream_t stream);
+
+    // clang-format off
+    static const integral_t sumFuncs[4][3] = {
+        {IntegralCaller<false, uchar, int>, IntegralCaller<false, uchar, float>, IntegralCaller<false, uchar, double>},
+        {IntegralCaller<false, ushort, int>, IntegralCaller<false, ushort, float>,
+         IntegralCaller<false, ushort, double>},
+        {IntegralCaller<false, short, int>, IntegralCaller<false, short, float>, IntegralCaller<false, short, double>},
+        {0, IntegralCaller<false, float, float>, IntegralCaller<false, float, double>},
+    };
+
+    static const integral_t sqsumFuncs[4][2] = {
+        {IntegralCaller<true, uchar, float>,  IntegralCaller<true, uchar, double> },
+        {IntegralCaller<true, ushort, float>, IntegralCaller<true, ushort, double>},
+        {IntegralCaller<true, short, float>,  IntegralCaller<true, short, double> },
+        {IntegralCaller<true, float, float>,  IntegralCaller<true, float, double> },
+    };
+    // clang-format on
+
+    const int type_idx = data_type == kCV_8U ? 0 : data_type == kCV_16U ? 1 : data_type == kCV_16S ? 2 : 3;
+
+    // both scans share the workspace, one after the other in the stream
+    sumFuncs[type_idx][sum_type == kCV_32S ? 0 : sum_type == kCV_32F ? 1 : 2](inData, sumData, numSamples, size,
+                                                                             gpuWorkspace(stream).get(), stream);
+    if (sqsumData)
+    {
+        sqsumFuncs[type_idx][sqsum_type == kCV_32F ? 0 : 1](inData, *sqsumData, numSamples, size,
+                                                            gpuWorkspace(stream).get(), stream);
+    }
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+
+    return ErrorCode::SUCCESS;
+}
+
+// AdaptiveThreshold -----------------------------------------------------------
+
+AdaptiveThreshold::AdaptiveThreshold(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size,
+                                     Size2D max_size)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_maxBatchSize(max_batch_size)
+    , m_maxSize(max_size)
+{
+    setGpuWorkspaceSize(calBufferSize(max_batch_size, max_size));
+}
+
+size_t AdaptiveThreshold::calBufferSize(int max_batch_size, Size2D max_size)
+{
+    if (max_batch_size <= 0 || max_size.w <= 0 || max_size.h <= 0)
+    {
+        return 0;
+    }
+
+    // uint32 integral image, followed by the scan state
+    const size_t integralSize = (size_t)max_batch_size * (max_size.h + 1) * (max_size.w + 1) * sizeof(uint32_t);
+    return AlignBytes(integralSize) + ScanStateSize(max_batch_size, int2{max_size.w, max_size.h});
+}
+
+ErrorCode AdaptiveThreshold::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                                   double max_value, NVCVThresholdType type, int block_size, double c,
+                                   cudaStream_t stream)
+{
+    if (type != NVCV_THRESH_BINARY && type != NVCV_THRESH_BINARY_INV)
+    {
+        LOG_ERROR("Invalid threshold type " << type);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    if (block_size < 3 || block_size % 2 == 0)
+    {
+        LOG_ERROR("Invalid block size " << block_size << ", it must be odd and greater than 1");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    int  numSamples;
+    int2 size;
+    if (ErrorCode err = checkInput(inData, m_maxBatchSize, m_maxSize, numSamples, size); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (inData.dtype() != nvcv::TYPE_U8 || outData.dtype() != nvcv::TYPE_U8)
+    {
+        LOG_ERROR("Invalid DataType between input (" << inData.dtype() << ") and output (" << outData.dtype()
+                                                     << "), they must be uint8");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    if (ErrorCode err = checkFormat(outData, "output"); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+    if (ErrorCode err = checkShape(outData, numSamples, size.y, size.x, "output"); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (numSamples == 0 || size.x == 0 || size.y == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    // the box sums of uint8 windows must fit in the 32-bit integral image
+    if ((uint64_t)std::min(block_size, size.x) * std::min(block_size, size.y) * 255 > UINT32_MAX)
+    {
+        LOG_ERROR("Invalid block size " << block_size << ", its windows are too large");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    GpuWorkspaceLease workspace   = gpuWorkspace(stream);
+    auto             *integralMem = workspace.as<uint32_t>();
+
+    const int64_t rowStride    = (size.x + 1) * sizeof(uint32_t);
+    const int64_t sampleStride = (size.y + 1) * rowStride;
+    const size_t  integralSize = numSamples * sampleStride;
+
+    nvcv::cuda::Tensor3DWrap<uint32_t> integral(integralMem, static_cast<int>(sampleStride),
+                                                static_cast<int>(rowStride));
+    nvcv::cuda::Tensor3DWrap<const uint32_t> integralIn(integralMem, static_cast<int>(sampleStride),
+                                                        static_cast<int>(rowStride));
+
+    IntegralImage<false>(nvcv::cuda::CreateTensorWrapNHW<const uchar>(inData), integral, numSamples, size,
+                         reinterpret_cast<char *>(integralMem) + AlignBytes(integralSize),
+                         stream);
+
+    const uchar maxValue = nvcv::cuda::SaturateCast<uchar>(max_value);
+    const int   delta    = type == NVCV_THRESH_BINARY ? (int)std::ceil(c) : (int)std::floor(c);
+
+    dim3 block(32, 8);
+    dim3 grid(divUp(size.x, block.x), divUp(size.y, block.y), numSamples);
+
+    adaptiveThresholdKernel<<<grid, block, 0, stream>>>(
+        nvcv::cuda::CreateTensorWrapNHW<const uchar>(inData), nvcv::cuda::CreateTensorWrapNHW<uchar>(outData),
+        integralIn, size, block_size / 2, maxValue, type == NVCV_THRESH_BINARY_INV, delta);
+    checkKernelErrors();
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
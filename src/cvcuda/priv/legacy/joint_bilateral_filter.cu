@@ -20,6 +20,7 @@
  * limitations under the License.
  */
 
+#include "BilateralFilterTile.cuh"
 #include "CvCudaLegacy.h"
 #include "CvCudaLegacyHelpers.hpp"
 
@@ -50,7 +51,7 @@ static __device__ __forceinline__ float norm1(const float4 &a)
     return cuda::abs(a.x) + cuda::abs(a.y) + cuda::abs(a.z) + cuda::abs(a.w);
 }
 
-template<typename SrcWrapper, typename DstWrapper>
+template<bool Fast, typename SrcWrapper, typename DstWrapper>
 __global__ void JointBilateralFilterKernel(SrcWrapper src, SrcWrapper srcColor, DstWrapper dst, const int radius,
                                            const float sigmaColor, const float sigmaSpace, const int rows,
                                            const int columns)
@@ -108,7 +109,7 @@ __global__ void JointBilateralFilterKernel(SrcWrapper src, SrcWrapper srcColor,
                 float e_space       = squared_dis0 * space_coefficient;
                 float one_norm_size = norm1(currColor - centerColor0);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator0 += weight;
                 numerator0 += weight * curr;
             }
@@ -118,7 +119,7 @@ __global__ void JointBilateralFilterKernel(SrcWrapper src, SrcWrapper srcColor,
                 float e_space       = squared_dis1 * space_coefficient;
                 float one_norm_size = norm1(currColor - centerColor1);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator1 += weight;
                 numerator1 = numerator1 + (weight * curr);
             }
@@ -128,7 +129,7 @@ __global__ void JointBilateralFilterKernel(SrcWrapper src, SrcWrapper srcColor,
                 float e_space       = squared_dis2 * space_coefficient;
                 float one_norm_size = norm1(currColor - centerColor2);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator2 += weight;
                 numerator2 = numerator2 + (weight * curr);
             }
@@ -138,7 +139,7 @@ __global__ void JointBilateralFilterKernel(SrcWrapper src, SrcWrapper srcColor,
                 float e_space       = squared_dis3 * space_coefficient;
                 float one_norm_size = norm1(currColor - centerColor3);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator3 += weight;
                 numerator3 = numerator3 + (weight * curr);
             }
@@ -166,6 +167,19 @@ __global__ void JointBilateralFilterKernel(SrcWrapper src, SrcWrapper srcColor,
     }
 }
 
+// Tiled variant of JointBilateralFilterKernel with one output per thread, see BilateralFilterTile
+template<bool Fast, typename SrcWrapper, typename DstWrapper>
+__global__ void JointBilateralFilterTiledKernel(SrcWrapper src, SrcWrapper srcColor, DstWrapper dst, const int radius,
+                                                const float sigmaColor, const float sigmaSpace, const int rows,
+                                                const int columns)
+{
+    using T = typename DstWrapper::ValueType;
+
+    extern __shared__ __align__(16) unsigned char smem[];
+    BilateralFilterTile<true, Fast>(smem, src, srcColor, radius, sigmaColor, sigmaSpace, rows, columns,
+                                    [&dst](const int3 &coord, const T &value) { dst[coord] = value; });
+}
+
 template<typename T, NVCVBorderType B>
 void JointBilateralFilterCaller(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &inColorData,
                                 const ITensorDataStridedCuda &outData, const int batch, int rows, int columns,
@@ -183,8 +197,25 @@ void JointBilateralFilterCaller(const ITensorDataStridedCuda &inData, const ITen
     checkCudaErrors(cudaGetLastError());
 #endif
 
-    JointBilateralFilterKernel<<<grid, block, 0, stream>>>(src, srcColor, dst, radius, sigmaColor, sigmaSpace, rows,
-                                                           columns);
+    int tileSmem = BilateralTileSharedMemSize<T>(radius, 2);
+    DispatchPrecision(
+        [&](auto fast)
+        {
+            constexpr bool Fast = decltype(fast)::value;
+            if (tileSmem <= kBilateralTileMaxSharedMem)
+            {
+                dim3 tileBlock(kBilateralTileBlock, kBilateralTileBlock);
+                dim3 tileGrid(divUp(columns, tileBlock.x), divUp(rows, tileBlock.y), batch);
+
+                JointBilateralFilterTiledKernel<Fast><<<tileGrid, tileBlock, tileSmem, stream>>>(
+                    src, srcColor, dst, radius, sigmaColor, sigmaSpace, rows, columns);
+            }
+            else
+            {
+                JointBilateralFilterKernel<Fast><<<grid, block, 0, stream>>>(src, srcColor, dst, radius, sigmaColor,
+                                                                             sigmaSpace, rows, columns);
+            }
+        });
 
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
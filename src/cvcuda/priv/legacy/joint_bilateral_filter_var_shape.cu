@@ -50,7 +50,7 @@ static __device__ __forceinline__ float norm1(const float4 &a)
     return cuda::abs(a.x) + cuda::abs(a.y) + cuda::abs(a.z) + cuda::abs(a.w);
 }
 
-template<class SrcWrapper, class DstWrapper>
+template<bool Fast, class SrcWrapper, class DstWrapper>
 __global__ void JointBilateralFilterVarShapeKernel(const SrcWrapper src, const SrcWrapper srcColor, DstWrapper dst,
                                                    const cuda::Tensor1DWrap<int>   inDiameter,
                                                    const cuda::Tensor1DWrap<float> inSigmaColor,
@@ -139,7 +139,7 @@ __global__ void JointBilateralFilterVarShapeKernel(const SrcWrapper src, const S
                 float e_space       = squared_dis0 * space_coefficient;
                 float one_norm_size = norm1(currColor - centerColor0);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator0 += weight;
                 numerator0 += weight * curr;
             }
@@ -149,7 +149,7 @@ __global__ void JointBilateralFilterVarShapeKernel(const SrcWrapper src, const S
                 float e_space       = squared_dis1 * space_coefficient;
                 float one_norm_size = norm1(currColor - centerColor1);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator1 += weight;
                 numerator1 = numerator1 + (weight * curr);
             }
@@ -159,7 +159,7 @@ __global__ void JointBilateralFilterVarShapeKernel(const SrcWrapper src, const S
                 float e_space       = squared_dis2 * space_coefficient;
                 float one_norm_size = norm1(currColor - centerColor2);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator2 += weight;
                 numerator2 = numerator2 + (weight * curr);
             }
@@ -169,7 +169,7 @@ __global__ void JointBilateralFilterVarShapeKernel(const SrcWrapper src, const S
                 float e_space       = squared_dis3 * space_coefficient;
                 float one_norm_size = norm1(currColor - centerColor3);
                 float e_color       = one_norm_size * one_norm_size * color_coefficient;
-                float weight        = cuda::exp(e_space + e_color);
+                float weight        = ExpF<Fast>(e_space + e_color);
                 denominator3 += weight;
                 numerator3 = numerator3 + (weight * curr);
             }
@@ -218,8 +218,12 @@ void JointBilateralFilterVarShapeCaller(const IImageBatchVarShapeDataStridedCuda
     checkCudaErrors(cudaGetLastError());
 #endif
 
-    JointBilateralFilterVarShapeKernel<<<grid, block, 0, stream>>>(src, srcColor, dst, inDiameter, inSigmaColor,
-                                                                   inSigmaSpace);
+    DispatchPrecision(
+        [&](auto fast)
+        {
+            JointBilateralFilterVarShapeKernel<decltype(fast)::value>
+                <<<grid, block, 0, stream>>>(src, srcColor, dst, inDiameter, inSigmaColor, inSigmaSpace);
+        });
 
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
@@ -0,0 +1,540 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Components are labeled with a union-find forest in the label tensor itself, each foreground pixel pointing to
+// the linear index of its parent in its sample and the roots to themselves. Pixels are first merged within
+// tiles in shared memory, then across the tile borders in global memory, and the trees are finally flattened.
+// Parents are only ever lowered, with atomicMin, so the root of a component is its smallest linear index.
+
+constexpr int kTileW = 32;
+constexpr int kTileH = 8;
+
+// Label of the background while labeling, the labels of the foreground being indices.
+constexpr int kBackground = -1;
+
+// Roots of components with statistics hold the encoded index of their statistics until they are finalized.
+__device__ inline int EncodeStatsIndex(int index)
+{
+    return kBackground - 1 - index;
+}
+
+__device__ inline int DecodeStatsIndex(int label)
+{
+    return kBackground - 1 - label;
+}
+
+// Union-find forest of a sample, addressed by linear index.
+struct Forest
+{
+    nvcv::cuda::Tensor3DWrap<int> labels;
+
+    int z;
+    int width;
+
+    __device__ int *ptr(int index) const
+    {
+        return labels.ptr(z, index / width, index % width);
+    }
+};
+
+// Root of a, parent(index) being the address of the parent of index. Parents are read as volatile since other
+// threads may lower them at any time.
+template<class Parent>
+__device__ int Find(Parent &&parent, int a)
+{
+    for (int p = *static_cast<volatile int *>(parent(a)); p != a; p = *static_cast<volatile int *>(parent(a)))
+    {
+        a = p;
+    }
+    return a;
+}
+
+// Merges the trees of a and b, the greater root being linked to the smaller one. A root can be linked by another
+// thread in the meantime, in which case the union is retried from its new parent.
+template<class Parent>
+__device__ void Union(Parent &&parent, int a, int b)
+{
+    while (true)
+    {
+        a = Find(parent, a);
+        b = Find(parent, b);
+
+        if (a == b)
+        {
+            return;
+        }
+        if (a > b)
+        {
+            int t = a;
+            a     = b;
+            b     = t;
+        }
+
+        const int old = atomicMin(parent(b), a);
+        if (old == b)
+        {
+            return;
+        }
+        b = old;
+    }
+}
+
+template<typename T>
+__device__ inline bool IsForeground(const nvcv::cuda::Tensor3DWrap<const T> &in, int z, int y, int x)
+{
+    return *in.ptr(z, y, x) != 0;
+}
+
+// Labels the components within each tile, the labels being the linear indices of their roots in the sample.
+template<bool Diagonal, typename T>
+__global__ void labelTiles(nvcv::cuda::Tensor3DWrap<const T> in, nvcv::cuda::Tensor3DWrap<int> out, int2 size)
+{
+    __shared__ int sParent[kTileH * kTileW];
+
+    const int tx = threadIdx.x;
+    const int ty = threadIdx.y;
+    const int x  = blockIdx.x * kTileW + tx;
+    const int y  = blockIdx.y * kTileH + ty;
+    const int z  = blockIdx.z;
+
+    const int  local      = ty * kTileW + tx;
+    const bool inside     = x < size.x && y < size.y;
+    const bool foreground = inside && IsForeground(in, z, y, x);
+
+    sParent[local] = foreground ? local : kBackground;
+    __syncthreads();
+
+    auto parent = [&](int index)
+    {
+        return &sParent[index];
+    };
+
+    auto merge = [&](int dx, int dy)
+    {
+        const int nx = tx + dx;
+        const int ny = ty + dy;
+        if (nx >= 0 && nx < kTileW && ny >= 0 && sParent[ny * kTileW + nx] != kBackground)
+        {
+            Union(parent, local, ny * kTileW + nx);
+        }
+    };
+
+    // local indices are in the same order as the linear indices in the sample, roots stay the smallest pixels
+    if (foreground)
+    {
+        merge(-1, 0);
+        merge(0, -1);
+        if constexpr (Diagonal)
+        {
+            merge(-1, -1);
+            merge(1, -1);
+        }
+    }
+    __syncthreads();
+
+    if (inside)
+    {
+        int label = kBackground;
+        if (foreground)
+        {
+            const int root = Find(parent, local);
+            label = (blockIdx.y * kTileH + root / kTileW) * size.x + blockIdx.x * kTileW + root % kTileW;
+        }
+        *out.ptr(z, y, x) = label;
+    }
+}
+
+// Merges the components of neighbor pixels in different tiles.
+template<bool Diagonal>
+__global__ void labelBorders(nvcv::cuda::Tensor3DWrap<int> out, int2 size)
+{
+    const int x = blockIdx.x * kTileW + threadIdx.x;
+    const int y = blockIdx.y * kTileH + threadIdx.y;
+    const int z = blockIdx.z;
+
+    const bool left  = threadIdx.x == 0;
+    const bool top   = threadIdx.y == 0;
+    const bool right = threadIdx.x == kTileW - 1;
+
+    if (x >= size.x || y >= size.y || !(left || top || (Diagonal && right)))
+        return;
+
+    if (*out.ptr(z, y, x) == kBackground)
+        return;
+
+    Forest forest{out, z, size.x};
+
+    auto parent = [&forest](int index)
+    {
+        return forest.ptr(index);
+    };
+
+    auto merge = [&](int nx, int ny)
+    {
+        if (nx >= 0 && nx < size.x && ny >= 0 && *out.ptr(z, ny, nx) != kBackground)
+        {
+            Union(parent, y * size.x + x, ny * size.x + nx);
+        }
+    };
+
+    if (left)
+    {
+        merge(x - 1, y);
+    }
+    if (top)
+    {
+        merge(x, y - 1);
+    }
+    if constexpr (Diagonal)
+    {
+        if (left || top)
+        {
+            merge(x - 1, y - 1);
+        }
+        if (right || top)
+        {
+            merge(x + 1, y - 1);
+        }
+    }
+}
+
+// Points each foreground pixel to its root.
+__global__ void labelFlatten(nvcv::cuda::Tensor3DWrap<int> out, int2 size)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int z = blockIdx.z;
+
+    if (x >= size.x || y >= size.y)
+        return;
+
+    int *label = out.ptr(z, y, x);
+    if (*label != kBackground)
+    {
+        Forest forest{out, z, size.x};
+
+        auto parent = [&forest](int index)
+        {
+            return forest.ptr(index);
+        };
+
+        *label = Find(parent, *label);
+    }
+}
+
+// Counts the roots of each sample, and gives them their row of statistics.
+__global__ void labelCount(nvcv::cuda::Tensor3DWrap<int> out, nvcv::cuda::Tensor3DWrap<int> count,
+                           nvcv::cuda::Tensor4DWrap<int> stats, int numStats, int2 size)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int z = blockIdx.z;
+
+    if (x >= size.x || y >= size.y)
+        return;
+
+    int *label = out.ptr(z, y, x);
+    if (*label != y * size.x + x)
+        return;
+
+    const int index = atomicAdd(count.ptr(z, 0, 0), 1);
+    if (numStats == 0)
+        return;
+
+    *label = EncodeStatsIndex(index);
+    if (index < numStats)
+    {
+        // the root is the first pixel of the component, its row is the top of the bounding box
+        int *s = stats.ptr(z, 0, index, 0);
+        s[0]   = y * size.x + x + 1;
+        s[1]   = x;
+        s[2]   = y;
+        s[3]   = x;
+        s[4]   = y;
+        s[5]   = 0;
+    }
+}
+
+// Writes the final labels of the pixels, except for the roots with statistics, whose statistics are accumulated.
+__global__ void labelFinalize(nvcv::cuda::Tensor3DWrap<int> out, nvcv::cuda::Tensor4DWrap<int> stats, int numStats,
+                              int2 size)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int z = blockIdx.z;
+
+    if (x >= size.x || y >= size.y)
+        return;
+
+    int      *label = out.ptr(z, y, x);
+    const int root  = *label;
+
+    if (root == kBackground)
+    {
+        *label = 0;
+        return;
+    }
+    if (numStats == 0)
+    {
+        *label = root + 1;
+        return;
+    }
+
+    const bool isRoot = root < kBackground;
+    const int  index  = DecodeStatsIndex(isRoot ? root : *out.ptr(z, root / size.x, root % size.x));
+    if (index < numStats)
+    {
+        int *s = stats.ptr(z, 0, index, 0);
+        atomicMin(&s[1], x);
+        atomicMax(&s[3], x);
+        atomicMax(&s[4], y);
+        atomicAdd(&s[5], 1);
+    }
+    if (!isRoot)
+    {
+        *label = root + 1;
+    }
+}
+
+// Writes the final labels of the roots with statistics, and the sizes of their bounding boxes.
+__global__ void labelFinalizeRoots(nvcv::cuda::Tensor3DWrap<int> out, nvcv::cuda::Tensor4DWrap<int> stats,
+                                   int numStats, int2 size)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int z = blockIdx.z;
+
+    if (x >= size.x || y >= size.y)
+        return;
+
+    int *label = out.ptr(z, y, x);
+    if (*label >= kBackground)
+        return;
+
+    const int index = DecodeStatsIndex(*label);
+    if (index < numStats)
+    {
+        int *s = stats.ptr(z, 0, index, 0);
+        s[3]   = s[3] - s[1] + 1;
+        s[4]   = s[4] - s[2] + 1;
+    }
+    *label = y * size.x + x + 1;
+}
+
+template<typename T>
+void LabelTiles(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, int numSamples,
+                int2 size, bool diagonal, cudaStream_t stream)
+{
+    auto in  = nvcv::cuda::CreateTensorWrapNHW<const T>(inData);
+    auto out = nvcv::cuda::CreateTensorWrapNHW<int>(outData);
+
+    dim3 block(kTileW, kTileH);
+    dim3 grid(divUp(size.x, kTileW), divUp(size.y, kTileH), numSamples);
+
+    if (diagonal)
+    {
+        labelTiles<true><<<grid, block, 0, stream>>>(in, out, size);
+        checkKernelErrors();
+        labelBorders<true><<<grid, block, 0, stream>>>(out, size);
+    }
+    else
+    {
+        labelTiles<false><<<grid, block, 0, stream>>>(in, out, size);
+        checkKernelErrors();
+        labelBorders<false><<<grid, block, 0, stream>>>(out, size);
+    }
+    checkKernelErrors();
+}
+
+ErrorCode checkOutput(const ITensorDataStridedCuda *data, int numSamples, int rows, int cols, int channels,
+                      const char *name)
+{
+    DataFormat format = GetLegacyDataFormat(data->layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid " << name << " DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+    if (data->dtype() != nvcv::TYPE_S32)
+    {
+        LOG_ERROR("Invalid " << name << " DataType " << data->dtype() << ", it must be int32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto access = TensorDataAccessStridedImagePlanar::Create(*data);
+    NVCV_ASSERT(access);
+
+    if (access->numSamples() != numSamples || access->numRows() != rows || (cols >= 0 && access->numCols() != cols)
+        || access->numChannels() != channels)
+    {
+        LOG_ERROR("Invalid " << name << " shape " << data->shape());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+Label::Label(DataShape max_input_shape, DataShape max_output_shape)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+{
+}
+
+size_t Label::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode Label::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                       const ITensorDataStridedCuda *countData, const ITensorDataStridedCuda *statsData,
+                       int connectivity, cudaStream_t stream)
+{
+    if (connectivity != 4 && connectivity != 8)
+    {
+        LOG_ERROR("Invalid connectivity " << connectivity << ", it must be 4 or 8");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    if (statsData && !countData)
+    {
+        LOG_ERROR("Invalid statistics without a count tensor");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    DataFormat format = GetLegacyDataFormat(inData.layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataType data_type = GetLegacyDataType(inData.dtype());
+    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_32S))
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    const int  numSamples = inAccess->numSamples();
+    const int2 size{inAccess->numCols(), inAccess->numRows()};
+
+    if (inAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid channel number " << inAccess->numChannels() << ", it must be 1");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if ((int64_t)size.x * size.y >= INT32_MAX)
+    {
+        LOG_ERROR("Invalid input shape " << inData.shape() << ", its labels don't fit in int32");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (ErrorCode err = checkOutput(&outData, numSamples, size.y, size.x, 1, "output"); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+    if (countData)
+    {
+        if (ErrorCode err = checkOutput(countData, numSamples, 1, 1, 1, "count"); err != ErrorCode::SUCCESS)
+        {
+            return err;
+        }
+    }
+    if (statsData)
+    {
+        if (ErrorCode err = checkOutput(statsData, numSamples, 1, -1, 6, "statistics"); err != ErrorCode::SUCCESS)
+        {
+            return err;
+        }
+    }
+
+    if (countData)
+    {
+        auto countAccess = TensorDataAccessStridedImagePlanar::Create(*countData);
+        NVCV_ASSERT(countAccess);
+        checkCudaErrors(cudaMemset2DAsync(countData->basePtr(), countAccess->sampleStride(), 0, sizeof(int),
+                                          numSamples, stream));
+    }
+
+    if (numSamples == 0 || size.x == 0 || size.y == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*label_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                            int numSamples, int2 size, bool diagonal, cudaStream_t stream);
+
+    static const label_t funcs[3] = {LabelTiles<uchar>, LabelTiles<ushort>, LabelTiles<int>};
+
+    funcs[data_type == kCV_8U ? 0 : data_type == kCV_16U ? 1 : 2](inData, outData, numSamples, size,
+                                                                 connectivity == 8, stream);
+
+    auto out = nvcv::cuda::CreateTensorWrapNHW<int>(outData);
+
+    dim3 block(32, 8);
+    dim3 grid(divUp(size.x, block.x), divUp(size.y, block.y), numSamples);
+
+    labelFlatten<<<grid, block, 0, stream>>>(out, size);
+    checkKernelErrors();
+
+    nvcv::cuda::Tensor4DWrap<int> stats;
+    int                           numStats = 0;
+    if (statsData)
+    {
+        stats    = nvcv::cuda::CreateTensorWrapNHWC<int>(*statsData);
+        numStats = TensorDataAccessStridedImagePlanar::Create(*statsData)->numCols();
+    }
+
+    if (countData)
+    {
+        labelCount<<<grid, block, 0, stream>>>(out, nvcv::cuda::CreateTensorWrapNHW<int>(*countData), stats,
+                                               numStats, size);
+        checkKernelErrors();
+    }
+
+    labelFinalize<<<grid, block, 0, stream>>>(out, stats, numStats, size);
+    checkKernelErrors();
+
+    if (numStats > 0)
+    {
+        labelFinalizeRoots<<<grid, block, 0, stream>>>(out, stats, numStats, size);
+        checkKernelErrors();
+    }
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
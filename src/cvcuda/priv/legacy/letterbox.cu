@@ -0,0 +1,411 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+constexpr int kLetterboxBlockW = 32;
+constexpr int kLetterboxBlockH = 8;
+
+// Channels of the per-sample transform: scale_x, scale_y, offset_x, offset_y
+constexpr int kTransformChannels = 4;
+
+template<typename T>
+struct LetterboxTensorSrc
+{
+    __device__ int2 size(int n) const
+    {
+        return imageSize;
+    }
+
+    __device__ const T *row(int n, int y) const
+    {
+        return wrap.ptr(n, y, 0);
+    }
+
+    nvcv::cuda::Tensor3DWrap<const T> wrap;
+    int2                              imageSize;
+};
+
+template<typename T>
+struct LetterboxVarShapeSrc
+{
+    __device__ int2 size(int n) const
+    {
+        return {wrap.width(n), wrap.height(n)};
+    }
+
+    __device__ const T *row(int n, int y) const
+    {
+        return wrap.ptr(n, y, 0);
+    }
+
+    nvcv::cuda::ImageBatchVarShapeWrap<const T> wrap;
+};
+
+// Region of the output covered by the resized image, centered, with the largest scale that fits the output.
+struct LetterboxGeometry
+{
+    float scale_x, scale_y;
+    int   left, top, width, height;
+};
+
+__device__ LetterboxGeometry GetLetterboxGeometry(int2 srcSize, int2 dstSize)
+{
+    LetterboxGeometry g{0.f, 0.f, 0, 0, 0, 0};
+    if (srcSize.x <= 0 || srcSize.y <= 0)
+    {
+        return g;
+    }
+
+    const float scale = fminf(static_cast<float>(dstSize.x) / srcSize.x, static_cast<float>(dstSize.y) / srcSize.y);
+
+    g.width   = min(dstSize.x, max(1, __float2int_rn(srcSize.x * scale)));
+    g.height  = min(dstSize.y, max(1, __float2int_rn(srcSize.y * scale)));
+    g.left    = (dstSize.x - g.width) / 2;
+    g.top     = (dstSize.y - g.height) / 2;
+    g.scale_x = static_cast<float>(g.width) / srcSize.x;
+    g.scale_y = static_cast<float>(g.height) / srcSize.y;
+    return g;
+}
+
+template<NVCVInterpolationType I, class Src, typename T>
+__global__ void letterboxKernel(const Src src, nvcv::cuda::Tensor3DWrap<T> dst, int2 dstSize, const T fillValue,
+                                nvcv::cuda::Tensor2DWrap<float> transform, bool hasTransform)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int n = blockIdx.z;
+
+    if (x >= dstSize.x || y >= dstSize.y)
+    {
+        return;
+    }
+
+    const int2              srcSize = src.size(n);
+    const LetterboxGeometry g       = GetLetterboxGeometry(srcSize, dstSize);
+
+    if (hasTransform && x == 0 && y == 0)
+    {
+        // Output coordinates map back to the source with src = (dst - offset) / scale
+        *transform.ptr(n, 0) = g.scale_x;
+        *transform.ptr(n, 1) = g.scale_y;
+        *transform.ptr(n, 2) = g.left;
+        *transform.ptr(n, 3) = g.top;
+    }
+
+    T *out = dst.ptr(n, y, x);
+
+    const int ix = x - g.left;
+    const int iy = y - g.top;
+    if (ix < 0 || ix >= g.width || iy < 0 || iy >= g.height)
+    {
+        *out = fillValue;
+        return;
+    }
+
+    const float inv_scale_x = 1.f / g.scale_x;
+    const float inv_scale_y = 1.f / g.scale_y;
+
+    if constexpr (I == NVCV_INTERP_NEAREST)
+    {
+        const int sx = min(__float2int_rd(ix * inv_scale_x), srcSize.x - 1);
+        const int sy = min(__float2int_rd(iy * inv_scale_y), srcSize.y - 1);
+
+        *out = src.row(n, sy)[sx];
+    }
+    else
+    {
+        float     fx  = (ix + 0.5f) * inv_scale_x - 0.5f;
+        float     fy  = (iy + 0.5f) * inv_scale_y - 0.5f;
+        const int sx  = __float2int_rd(fx);
+        const int sy  = __float2int_rd(fy);
+        const int sx0 = max(0, min(sx, srcSize.x - 1)), sx1 = max(0, min(sx + 1, srcSize.x - 1));
+        const int sy0 = max(0, min(sy, srcSize.y - 1)), sy1 = max(0, min(sy + 1, srcSize.y - 1));
+        fx -= sx;
+        fy -= sy;
+
+        const T *aPtr = src.row(n, sy0);
+        const T *bPtr = src.row(n, sy1);
+
+        *out = nvcv::cuda::SaturateCast<T>((1.0f - fx) * (aPtr[sx0] * (1.0f - fy) + bPtr[sx0] * fy)
+                                           + fx * (aPtr[sx1] * (1.0f - fy) + bPtr[sx1] * fy));
+    }
+}
+
+template<typename T, class Src>
+void letterboxCaller(const Src &src, int numSamples, const nvcv::ITensorDataStridedCuda &outData,
+                     const nvcv::ITensorDataStridedCuda *transformData, NVCVInterpolationType interpolation,
+                     const float4 fillValue, cudaStream_t stream)
+{
+    T fill;
+#pragma unroll
+    for (int c = 0; c < nvcv::cuda::NumElements<T>; ++c)
+    {
+        nvcv::cuda::GetElement(fill, c)
+            = nvcv::cuda::SaturateCast<nvcv::cuda::BaseType<T>>(nvcv::cuda::GetElement(fillValue, c));
+    }
+
+    auto outSize = GetMaxImageSize(outData);
+    int2 dstSize{outSize.w, outSize.h};
+
+    auto dst = nvcv::cuda::CreateTensorWrapNHW<T>(outData);
+
+    nvcv::cuda::Tensor2DWrap<float> transform;
+    if (transformData != nullptr)
+    {
+        transform = nvcv::cuda::Tensor2DWrap<float>(reinterpret_cast<float *>(transformData->basePtr()),
+                                                    static_cast<int>(transformData->stride(0)));
+    }
+
+    dim3 block(kLetterboxBlockW, kLetterboxBlockH);
+    dim3 grid(divUp(dstSize.x, block.x), divUp(dstSize.y, block.y), numSamples);
+
+    if (interpolation == NVCV_INTERP_NEAREST)
+    {
+        letterboxKernel<NVCV_INTERP_NEAREST>
+            <<<grid, block, 0, stream>>>(src, dst, dstSize, fill, transform, transformData != nullptr);
+    }
+    else
+    {
+        letterboxKernel<NVCV_INTERP_LINEAR>
+            <<<grid, block, 0, stream>>>(src, dst, dstSize, fill, transform, transformData != nullptr);
+    }
+    checkKernelErrors();
+}
+
+template<typename T>
+void letterboxTensor(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
+                     const nvcv::ITensorDataStridedCuda *transformData, NVCVInterpolationType interpolation,
+                     const float4 fillValue, cudaStream_t stream)
+{
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    LetterboxTensorSrc<T> src{nvcv::cuda::CreateTensorWrapNHW<const T>(inData),
+                              int2{inAccess->numCols(), inAccess->numRows()}};
+
+    letterboxCaller<T>(src, inAccess->numSamples(), outData, transformData, interpolation, fillValue, stream);
+}
+
+template<typename T>
+void letterboxVarShape(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
+                       const nvcv::ITensorDataStridedCuda &outData, const nvcv::ITensorDataStridedCuda *transformData,
+                       NVCVInterpolationType interpolation, const float4 fillValue, cudaStream_t stream)
+{
+    LetterboxVarShapeSrc<T> src{nvcv::cuda::ImageBatchVarShapeWrap<const T>(inData)};
+
+    letterboxCaller<T>(src, inData.numImages(), outData, transformData, interpolation, fillValue, stream);
+}
+
+// Checks the parameters shared by tensor and varshape letterboxes.
+ErrorCode checkLetterboxParams(const nvcv::ITensorDataStridedCuda &outData,
+                               const nvcv::ITensorDataStridedCuda *transformData, int numSamples, int channels,
+                               DataType data_type, NVCVInterpolationType interpolation)
+{
+    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_16S || data_type == kCV_32F))
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (channels != 1 && channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (interpolation != NVCV_INTERP_NEAREST && interpolation != NVCV_INTERP_LINEAR)
+    {
+        LOG_ERROR("Invalid interpolation " << interpolation << ", it must be nearest or linear");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    DataFormat out_format = GetLegacyDataFormat(outData.layout());
+    if (!(out_format == kNHWC || out_format == kHWC))
+    {
+        LOG_ERROR("Invalid output DataFormat " << out_format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (GetLegacyDataType(outData.dtype()) != data_type)
+    {
+        LOG_ERROR("Invalid output DataType " << outData.dtype() << ", it must be the input DataType");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    if (outAccess->numSamples() != numSamples || outAccess->numChannels() != channels)
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must have " << numSamples << " samples with "
+                                          << channels << " channels");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (transformData != nullptr)
+    {
+        if (GetLegacyDataType(transformData->dtype()) != kCV_32F)
+        {
+            LOG_ERROR("Invalid transform DataType " << transformData->dtype() << ", it must be float32");
+            return ErrorCode::INVALID_DATA_TYPE;
+        }
+
+        auto transformAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*transformData);
+        if (!transformAccess || transformAccess->numPlanes() != 1)
+        {
+            LOG_ERROR("Invalid transform DataFormat, it must be interleaved");
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+
+        if (transformAccess->numSamples() != numSamples || transformAccess->numRows() != 1
+            || transformAccess->numCols() != 1 || transformAccess->numChannels() != kTransformChannels)
+        {
+            LOG_ERROR("Invalid transform shape " << transformData->shape() << ", it must have " << numSamples
+                                                 << " samples of 1x1 pixels with " << kTransformChannels
+                                                 << " channels");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t Letterbox::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode Letterbox::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                           const ITensorDataStridedCuda *transformData, NVCVInterpolationType interpolation,
+                           const float4 fillValue, cudaStream_t stream)
+{
+    DataFormat format = GetLegacyDataFormat(inData.layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    if (!inAccess)
+    {
+        LOG_ERROR("Invalid input DataFormat");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    const int channels  = inAccess->numChannels();
+    DataType  data_type = GetLegacyDataType(inData.dtype());
+
+    ErrorCode err = checkLetterboxParams(outData, transformData, inAccess->numSamples(), channels, data_type,
+                                         interpolation);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    typedef void (*func_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                           const ITensorDataStridedCuda *transformData, NVCVInterpolationType interpolation,
+                           const float4 fillValue, cudaStream_t stream);
+
+    // clang-format off
+    static const func_t funcs[6][4] = {
+        {letterboxTensor<uchar>,  0, letterboxTensor<uchar3>,  letterboxTensor<uchar4> },
+        {0,                       0, 0,                        0                      },
+        {letterboxTensor<ushort>, 0, letterboxTensor<ushort3>, letterboxTensor<ushort4>},
+        {letterboxTensor<short>,  0, letterboxTensor<short3>,  letterboxTensor<short4> },
+        {0,                       0, 0,                        0                      },
+        {letterboxTensor<float>,  0, letterboxTensor<float3>,  letterboxTensor<float4> },
+    };
+    // clang-format on
+
+    const func_t func = funcs[data_type][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(inData, outData, transformData, interpolation, fillValue, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode LetterboxVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                   const ITensorDataStridedCuda &outData, const ITensorDataStridedCuda *transformData,
+                                   NVCVInterpolationType interpolation, const float4 fillValue, cudaStream_t stream)
+{
+    DataFormat format = helpers::GetLegacyDataFormat(inData);
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!inData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input varshape must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    const int channels  = inData.uniqueFormat().numChannels();
+    DataType  data_type = helpers::GetLegacyDataType(inData.uniqueFormat());
+
+    ErrorCode err
+        = checkLetterboxParams(outData, transformData, inData.numImages(), channels, data_type, interpolation);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (inData.numImages() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                           const ITensorDataStridedCuda *transformData, NVCVInterpolationType interpolation,
+                           const float4 fillValue, cudaStream_t stream);
+
+    // clang-format off
+    static const func_t funcs[6][4] = {
+        {letterboxVarShape<uchar>,  0, letterboxVarShape<uchar3>,  letterboxVarShape<uchar4> },
+        {0,                         0, 0,                          0                        },
+        {letterboxVarShape<ushort>, 0, letterboxVarShape<ushort3>, letterboxVarShape<ushort4>},
+        {letterboxVarShape<short>,  0, letterboxVarShape<short3>,  letterboxVarShape<short4> },
+        {0,                         0, 0,                          0                        },
+        {letterboxVarShape<float>,  0, letterboxVarShape<float3>,  letterboxVarShape<float4> },
+    };
+    // clang-format on
+
+    const func_t func = funcs[data_type][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(inData, outData, transformData, interpolation, fillValue, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,261 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+#include <nvcv/cuda/VectorizedAccess.hpp>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Tables of a sample and channel are at tables.ptr(sample, channel), with zero strides for the tables shared by
+// all samples or all channels.
+template<typename D>
+using Tables = nvcv::cuda::Tensor3DWrap<const D>;
+
+// 8-bit tables are small enough for each block to first copy the tables of its sample to shared memory, where
+// lookups don't depend on the locality of the input values.
+template<int N, int NC, typename S, typename D>
+__global__ void lut_shared_kernel(const nvcv::cuda::Tensor3DWrap<const S> in, const Tables<D> tables,
+                                  nvcv::cuda::Tensor3DWrap<D> out, int rowLength, int rows)
+{
+    __shared__ D lut[NC][256];
+
+    const int chunk_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y         = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    for (int i = threadIdx.y * blockDim.x + threadIdx.x; i < NC * 256; i += blockDim.x * blockDim.y)
+    {
+        lut[i / 256][i % 256] = *tables.ptr(batch_idx, i / 256, i % 256);
+    }
+    __syncthreads();
+
+    if (y >= rows)
+        return;
+
+    nvcv::cuda::TransformRowVector<N, NC>(out.ptr(batch_idx, y), in.ptr(batch_idx, y), rowLength, chunk_idx,
+                                          [&](S v, int c) { return lut[c][v]; });
+}
+
+// 16-bit tables don't fit in shared memory and are looked up in global memory.
+template<int N, int NC, typename S, typename D>
+__global__ void lut_global_kernel(const nvcv::cuda::Tensor3DWrap<const S> in, const Tables<D> tables,
+                                  nvcv::cuda::Tensor3DWrap<D> out, int rowLength, int rows)
+{
+    const int chunk_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y         = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    if (y >= rows)
+        return;
+
+    nvcv::cuda::TransformRowVector<N, NC>(out.ptr(batch_idx, y), in.ptr(batch_idx, y), rowLength, chunk_idx,
+                                          [&](S v, int c) { return __ldg(tables.ptr(batch_idx, c, v)); });
+}
+
+template<typename T>
+nvcv::cuda::Tensor3DWrap<T> wrapRows(const nvcv::TensorDataAccessStridedImagePlanar &access)
+{
+    return nvcv::cuda::Tensor3DWrap<T>(access.sampleData(0), static_cast<int>(access.sampleStride()),
+                                       static_cast<int>(access.rowStride()));
+}
+
+template<typename S, typename D, int NC>
+void lut(const nvcv::TensorDataAccessStridedImagePlanar &inAccess,
+         const nvcv::TensorDataAccessStridedImagePlanar &outAccess, const Tables<D> &tables, cudaStream_t stream)
+{
+    constexpr int N = nvcv::cuda::VectorWidth<NC, S, D>;
+
+    const int rowLength = inAccess.numCols() * NC;
+    const int rows      = inAccess.numRows();
+
+    dim3 block(32, 8);
+    dim3 grid(divUp(divUp(rowLength, N), block.x), divUp(rows, block.y), inAccess.numSamples());
+
+    if constexpr (sizeof(S) == 1)
+    {
+        lut_shared_kernel<N, NC, S, D><<<grid, block, 0, stream>>>(wrapRows<const S>(inAccess), tables,
+                                                                   wrapRows<D>(outAccess), rowLength, rows);
+    }
+    else
+    {
+        lut_global_kernel<N, NC, S, D><<<grid, block, 0, stream>>>(wrapRows<const S>(inAccess), tables,
+                                                                   wrapRows<D>(outAccess), rowLength, rows);
+    }
+    checkKernelErrors();
+}
+
+typedef void (*func_t)(const nvcv::TensorDataAccessStridedImagePlanar &inAccess,
+                       const nvcv::TensorDataAccessStridedImagePlanar &outAccess,
+                       const nvcv::ITensorDataStridedCuda &lutData, int sampleStride, int channelStride,
+                       cudaStream_t stream);
+
+template<typename S, typename D, int NC>
+void lutFunc(const nvcv::TensorDataAccessStridedImagePlanar &inAccess,
+             const nvcv::TensorDataAccessStridedImagePlanar &outAccess, const nvcv::ITensorDataStridedCuda &lutData,
+             int sampleStride, int channelStride, cudaStream_t stream)
+{
+    Tables<D> tables(lutData.basePtr(), sampleStride, channelStride);
+    lut<S, D, NC>(inAccess, outAccess, tables, stream);
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t LUT::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode LUT::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                     const ITensorDataStridedCuda &lutData, cudaStream_t stream)
+{
+    for (const ITensorDataStridedCuda *data : {&inData, &outData})
+    {
+        DataFormat format = GetLegacyDataFormat(data->layout());
+        if (!(format == kNHWC || format == kHWC))
+        {
+            LOG_ERROR("Invalid DataFormat " << format);
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+    }
+
+    int numEntries = 0;
+    if (inData.dtype() == nvcv::TYPE_U8)
+    {
+        numEntries = 256;
+    }
+    else if (inData.dtype() == nvcv::TYPE_U16)
+    {
+        numEntries = 65536;
+    }
+    else
+    {
+        LOG_ERROR("Invalid input DataType " << inData.dtype() << ", it must be uint8 or uint16");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    int outType = -1;
+    for (auto [i, dtype] : {std::make_pair(0, nvcv::TYPE_U8), std::make_pair(1, nvcv::TYPE_U16),
+                            std::make_pair(2, nvcv::TYPE_S16), std::make_pair(3, nvcv::TYPE_F32)})
+    {
+        if (lutData.dtype() == dtype)
+        {
+            outType = i;
+        }
+    }
+    if (outType < 0)
+    {
+        LOG_ERROR("Invalid table DataType " << lutData.dtype() << ", it must be uint8, uint16, int16 or float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    if (outData.dtype() != lutData.dtype())
+    {
+        LOG_ERROR("Output must have the data type of the tables");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess  = TensorDataAccessStridedImagePlanar::Create(inData);
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(inAccess && outAccess);
+
+    const int channels = inAccess->numChannels();
+    if (channels < 1 || channels > 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (outAccess->numSamples() != inAccess->numSamples() || outAccess->numRows() != inAccess->numRows()
+        || outAccess->numCols() != inAccess->numCols() || outAccess->numChannels() != channels)
+    {
+        LOG_ERROR("Input and output must have the same shape");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    for (auto [data, access] : {std::make_pair(&inData, &*inAccess), std::make_pair(&outData, &*outAccess)})
+    {
+        if (access->colStride() != channels * data->dtype().strideBytes())
+        {
+            LOG_ERROR("Pixels must be packed");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
+    const int rank = lutData.rank();
+    if (rank != 2 && rank != 3)
+    {
+        LOG_ERROR("Invalid table shape " << lutData.shape() << ", it must be [C, " << numEntries << "] or [N, C, "
+                                         << numEntries << "]");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const int64_t numSampleTables  = rank == 3 ? lutData.shape(0) : 1;
+    const int64_t numChannelTables = lutData.shape(rank - 2);
+    if ((numSampleTables != 1 && numSampleTables != inAccess->numSamples())
+        || (numChannelTables != 1 && numChannelTables != channels) || lutData.shape(rank - 1) != numEntries)
+    {
+        LOG_ERROR("Invalid table shape " << lutData.shape() << ", it must have 1 or " << inAccess->numSamples()
+                                         << " samples, 1 or " << channels << " channels and " << numEntries
+                                         << " entries");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (lutData.stride(rank - 1) != lutData.dtype().strideBytes())
+    {
+        LOG_ERROR("Invalid table layout, the entries of each table must be packed");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (inAccess->numSamples() == 0 || inAccess->numRows() == 0 || inAccess->numCols() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    // Tables shared by all samples or all channels are broadcast with zero strides.
+    const int sampleStride  = numSampleTables > 1 ? static_cast<int>(lutData.stride(0)) : 0;
+    const int channelStride = numChannelTables > 1 ? static_cast<int>(lutData.stride(rank - 2)) : 0;
+
+    // indexed by input type, output type and number of channels
+    static const func_t funcs[2][4][4] = {
+        {
+         {lutFunc<uchar, uchar, 1>, lutFunc<uchar, uchar, 2>, lutFunc<uchar, uchar, 3>, lutFunc<uchar, uchar, 4>},
+         {lutFunc<uchar, ushort, 1>, lutFunc<uchar, ushort, 2>, lutFunc<uchar, ushort, 3>, lutFunc<uchar, ushort, 4>},
+         {lutFunc<uchar, short, 1>, lutFunc<uchar, short, 2>, lutFunc<uchar, short, 3>, lutFunc<uchar, short, 4>},
+         {lutFunc<uchar, float, 1>, lutFunc<uchar, float, 2>, lutFunc<uchar, float, 3>, lutFunc<uchar, float, 4>},
+         },
+        {
+         {lutFunc<ushort, uchar, 1>, lutFunc<ushort, uchar, 2>, lutFunc<ushort, uchar, 3>, lutFunc<ushort, uchar, 4>},
+         {lutFunc<ushort, ushort, 1>, lutFunc<ushort, ushort, 2>, lutFunc<ushort, ushort, 3>,
+             lutFunc<ushort, ushort, 4>},
+         {lutFunc<ushort, short, 1>, lutFunc<ushort, short, 2>, lutFunc<ushort, short, 3>, lutFunc<ushort, short, 4>},
+         {lutFunc<ushort, float, 1>, lutFunc<ushort, float, 2>, lutFunc<ushort, float, 3>, lutFunc<ushort, float, 4>},
+         },
+    };
+
+    const func_t func = funcs[numEntries == 256 ? 0 : 1][outType][channels - 1];
+
+    func(*inAccess, *outAccess, lutData, sampleStride, channelStride, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,204 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CompositeUtils.cuh"
+#include "CvCudaUtils.cuh"
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Palettes up to this size are staged in shared memory, colors of larger ones are read from global memory.
+constexpr int kMaxSharedPaletteSize = 256;
+
+// Palette colors are read byte by byte, the palette might not be 4-byte aligned.
+__device__ __forceinline__ uchar4 LoadColor(const uchar *palette, int label)
+{
+    const uchar *c = palette + label * 4;
+    return make_uchar4(c[0], c[1], c[2], c[3]);
+}
+
+// Each thread blends one pixel with the palette color of its label, like Composite does with a mask equal to the
+// color alpha. Pixels whose label is outside the palette are copied unchanged.
+template<int cn, typename LabelT>
+__global__ void mask_overlay_kernel(const nvcv::cuda::Tensor3DWrap<const uchar> src,
+                                    const nvcv::cuda::Tensor3DWrap<const LabelT> labels, const uchar *palette,
+                                    int paletteSize, nvcv::cuda::Tensor3DWrap<uchar> dst, int width, int height)
+{
+    __shared__ uchar4 sharedPalette[kMaxSharedPaletteSize];
+
+    const bool useShared = paletteSize <= kMaxSharedPaletteSize;
+    if (useShared)
+    {
+        const int lid = threadIdx.y * blockDim.x + threadIdx.x;
+        for (int i = lid; i < paletteSize; i += blockDim.x * blockDim.y)
+        {
+            sharedPalette[i] = LoadColor(palette, i);
+        }
+        __syncthreads();
+    }
+
+    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    if (dst_x >= width || dst_y >= height)
+        return;
+
+    const uchar *srcPix = src.ptr(batch_idx, dst_y, dst_x * cn);
+    uchar       *dstPix = dst.ptr(batch_idx, dst_y, dst_x * cn);
+
+    const int label = *labels.ptr(batch_idx, dst_y, dst_x);
+
+    uchar4 color = make_uchar4(0, 0, 0, 0);
+    if (label >= 0 && label < paletteSize)
+    {
+        color = useShared ? sharedPalette[label] : LoadColor(palette, label);
+    }
+
+    dstPix[0] = AlphaBlend<false>(srcPix[0], color.x, color.w);
+    dstPix[1] = AlphaBlend<false>(srcPix[1], color.y, color.w);
+    dstPix[2] = AlphaBlend<false>(srcPix[2], color.z, color.w);
+    if constexpr (cn == 4)
+    {
+        dstPix[3] = srcPix[3];
+    }
+}
+
+template<int cn, typename LabelT>
+void maskOverlay(const nvcv::TensorDataAccessStridedImagePlanar &inAccess,
+                 const nvcv::TensorDataAccessStridedImagePlanar &labelAccess, const uchar *palette, int paletteSize,
+                 const nvcv::TensorDataAccessStridedImagePlanar &outAccess, cudaStream_t stream)
+{
+    nvcv::cuda::Tensor3DWrap<const uchar> src(inAccess.sampleData(0), static_cast<int>(inAccess.sampleStride()),
+                                              static_cast<int>(inAccess.rowStride()));
+    nvcv::cuda::Tensor3DWrap<const LabelT> labels(labelAccess.sampleData(0),
+                                                  static_cast<int>(labelAccess.sampleStride()),
+                                                  static_cast<int>(labelAccess.rowStride()));
+    nvcv::cuda::Tensor3DWrap<uchar> dst(outAccess.sampleData(0), static_cast<int>(outAccess.sampleStride()),
+                                        static_cast<int>(outAccess.rowStride()));
+
+    const int width  = outAccess.numCols();
+    const int height = outAccess.numRows();
+
+    dim3 block(32, 8, 1);
+    dim3 grid(divUp(width, block.x), divUp(height, block.y), outAccess.numSamples());
+
+    mask_overlay_kernel<cn, LabelT>
+        <<<grid, block, 0, stream>>>(src, labels, palette, paletteSize, dst, width, height);
+    checkKernelErrors();
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t MaskOverlay::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode MaskOverlay::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &labelData,
+                             const ITensorDataStridedCuda &paletteData, const ITensorDataStridedCuda &outData,
+                             cudaStream_t stream)
+{
+    for (const ITensorDataStridedCuda *data : {&inData, &labelData, &paletteData, &outData})
+    {
+        DataFormat format = GetLegacyDataFormat(data->layout());
+        if (!(format == kNHWC || format == kHWC))
+        {
+            LOG_ERROR("Invalid DataFormat " << format);
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+    }
+
+    if (inData.dtype() != nvcv::TYPE_U8 || outData.dtype() != nvcv::TYPE_U8 || paletteData.dtype() != nvcv::TYPE_U8)
+    {
+        LOG_ERROR("Invalid DataType, frames and palette must be uint8");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess      = TensorDataAccessStridedImagePlanar::Create(inData);
+    auto labelAccess   = TensorDataAccessStridedImagePlanar::Create(labelData);
+    auto paletteAccess = TensorDataAccessStridedImagePlanar::Create(paletteData);
+    auto outAccess     = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(inAccess && labelAccess && paletteAccess && outAccess);
+
+    const int channels = inAccess->numChannels();
+    if (channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (inData.shape() != outData.shape())
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must be the input shape " << inData.shape());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (labelAccess->numSamples() != inAccess->numSamples() || labelAccess->numRows() != inAccess->numRows()
+        || labelAccess->numCols() != inAccess->numCols() || labelAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid label shape " << labelData.shape() << ", it must have one channel and the input size");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (paletteAccess->numSamples() != 1 || paletteAccess->numRows() != 1 || paletteAccess->numChannels() != 4
+        || paletteAccess->colStride() != 4)
+    {
+        LOG_ERROR("Invalid palette shape " << paletteData.shape() << ", it must be one row of packed 4-channel colors");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const auto *palette     = reinterpret_cast<const uchar *>(paletteAccess->sampleData(0));
+    const int   paletteSize = paletteAccess->numCols();
+
+    typedef void (*func_t)(const TensorDataAccessStridedImagePlanar &inAccess,
+                           const TensorDataAccessStridedImagePlanar &labelAccess, const uchar *palette,
+                           int paletteSize, const TensorDataAccessStridedImagePlanar &outAccess, cudaStream_t stream);
+
+    static const func_t funcs[2][2] = {
+        {maskOverlay<3, uchar>, maskOverlay<3, int>},
+        {maskOverlay<4, uchar>, maskOverlay<4, int>}
+    };
+
+    int labelIdx;
+    if (labelData.dtype() == nvcv::TYPE_U8)
+    {
+        labelIdx = 0;
+    }
+    else if (labelData.dtype() == nvcv::TYPE_S32)
+    {
+        labelIdx = 1;
+    }
+    else
+    {
+        LOG_ERROR("Invalid label DataType " << labelData.dtype() << ", labels must be uint8 or int32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    funcs[channels - 3][labelIdx](*inAccess, *labelAccess, palette, paletteSize, *outAccess, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
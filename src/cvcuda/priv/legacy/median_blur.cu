@@ -22,9 +22,15 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "KernelTuner.hpp"
+#include "MedianHistogram.cuh"
 
 #define GENERAL_KERNEL_BLOCK 32
 #define SMALL_KERNEL_BLOCK   16
+#define HISTOGRAM_TILE_W     32
+#define HISTOGRAM_TILE_H     64
+#define NETWORK_BLOCK_W      32
+#define NETWORK_BLOCK_H      8
 
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
@@ -328,6 +334,347 @@ __global__ void medianForSmallKernel(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, c
 #undef fetch_
 #undef fetchAs1d
 
+/**
+ * Perform constant-time histogram median filter on 8-bit images.
+ * Each block of 256 threads computes a HISTOGRAM_TILE_W x HISTOGRAM_TILE_H tile of one channel.
+ * @param src a Ptr2dNHWC <uchar> stored in global memory.
+ * @param dst a Ptr2dNHWC <uchar> stored in global memory.
+ * @param kWidth width of the kernel.
+ * @param kHeight height of the kernel.
+ */
+__global__ void medianHistogram(const Ptr2dNHWC<uchar> src, Ptr2dNHWC<uchar> dst, const int kWidth,
+                                const int kHeight)
+{
+    extern __shared__ unsigned short colHist[];
+
+    int channel  = blockIdx.z % dst.ch;
+    int batchIdx = blockIdx.z / dst.ch;
+    int h = src.rows, w = src.cols;
+
+    auto fetch = [&](int gx, int gy) -> unsigned char
+    {
+        // nvcv::BORDER_REPLICATE
+        gx = min(max(gx, 0), w - 1);
+        gy = min(max(gy, 0), h - 1);
+        return *src.ptr(batchIdx, gy, gx, channel);
+    };
+
+    auto store = [&](int x, int y, unsigned char value)
+    {
+        *dst.ptr(batchIdx, y, x, channel) = value;
+    };
+
+    MedianHistogramTile(colHist, blockIdx.x * HISTOGRAM_TILE_W, blockIdx.y * HISTOGRAM_TILE_H, HISTOGRAM_TILE_W,
+                        HISTOGRAM_TILE_H, w, h, kWidth, kHeight, fetch, store);
+}
+
+/**
+ * Four 8-bit pixels compared lane-wise, each lane holding the value of one of four horizontally adjacent outputs.
+ */
+struct PackedU8
+{
+    unsigned int v;
+};
+
+template<typename T>
+__device__ __forceinline__ T networkMin(T a, T b)
+{
+    return b < a ? b : a;
+}
+
+template<typename T>
+__device__ __forceinline__ T networkMax(T a, T b)
+{
+    return b < a ? a : b;
+}
+
+__device__ __forceinline__ PackedU8 networkMin(PackedU8 a, PackedU8 b)
+{
+    return {__vminu4(a.v, b.v)};
+}
+
+__device__ __forceinline__ PackedU8 networkMax(PackedU8 a, PackedU8 b)
+{
+    return {__vmaxu4(a.v, b.v)};
+}
+
+// min/max exchange, the building block of the branch-free sorting networks
+template<typename V>
+__device__ __forceinline__ void exchange(V &a, V &b)
+{
+    V lo = networkMin(a, b);
+    b    = networkMax(a, b);
+    a    = lo;
+}
+
+template<typename V>
+__device__ __forceinline__ V median3(V a, V b, V c)
+{
+    return networkMax(networkMin(a, b), networkMin(networkMax(a, b), c));
+}
+
+/**
+ * Sort K = 3 or 5 values in ascending order with an optimal sorting network.
+ */
+template<int K, typename V>
+__device__ __forceinline__ void sortNetwork(V (&a)[K])
+{
+    if constexpr (K == 3)
+    {
+        exchange(a[0], a[1]);
+        exchange(a[1], a[2]);
+        exchange(a[0], a[1]);
+    }
+    else
+    {
+        static_assert(K == 5, "Only sorting networks of 3 and 5 values are implemented");
+        exchange(a[0], a[1]);
+        exchange(a[3], a[4]);
+        exchange(a[2], a[4]);
+        exchange(a[2], a[3]);
+        exchange(a[0], a[3]);
+        exchange(a[0], a[2]);
+        exchange(a[1], a[4]);
+        exchange(a[1], a[3]);
+        exchange(a[1], a[2]);
+    }
+}
+
+/**
+ * Median of N values by forgetful selection: N / 2 + 2 values are kept, the smallest and largest of them are
+ * dropped and the next value is taken until all are taken, then the median is the one of the last 3 kept.
+ */
+template<int N, typename V>
+__device__ __forceinline__ V forgetfulMedian(V (&v)[N])
+{
+    constexpr int kKept = N / 2 + 2;
+
+    int first = 0;
+#pragma unroll
+    for (int next = kKept; next < N; ++next, ++first)
+    {
+        const int last = first + kKept - (next - kKept) - 1;
+#pragma unroll
+        for (int i = first + 1; i <= last; ++i)
+        {
+            exchange(v[first], v[i]);
+        }
+#pragma unroll
+        for (int i = first + 1; i < last; ++i)
+        {
+            exchange(v[i], v[last]);
+        }
+        v[last] = v[next];
+    }
+    return median3(v[first], v[first + 1], v[first + 2]);
+}
+
+/**
+ * Median of the K x K window whose K columns are already sorted.
+ *
+ * For 3x3 it's the median of the largest minimum, the median of the middles and the smallest maximum.  For 5x5
+ * the ranks are also sorted across columns, which keeps them sorted along the columns.  The value of rank (r, c)
+ * then has (r + 1) * (c + 1) - 1 values below it and (5 - r) * (5 - c) - 1 above, which leaves 13 candidates, 6 of
+ * the others being below the median: it's the median of the candidates.
+ */
+template<int K, typename V>
+__device__ __forceinline__ V medianOfSortedColumns(const V (*col)[K])
+{
+    if constexpr (K == 3)
+    {
+        V lo = networkMax(networkMax(col[0][0], col[1][0]), col[2][0]);
+        V mi = median3(col[0][1], col[1][1], col[2][1]);
+        V hi = networkMin(networkMin(col[0][2], col[1][2]), col[2][2]);
+        return median3(lo, mi, hi);
+    }
+    else
+    {
+        V rank[5][5];
+#pragma unroll
+        for (int r = 0; r < 5; ++r)
+        {
+#pragma unroll
+            for (int c = 0; c < 5; ++c)
+            {
+                rank[r][c] = col[c][r];
+            }
+            sortNetwork<5>(rank[r]);
+        }
+
+        V candidates[13] = {rank[0][3], rank[0][4], rank[1][2], rank[1][3], rank[1][4], rank[2][1], rank[2][2],
+                            rank[2][3], rank[3][0], rank[3][1], rank[3][2], rank[4][0], rank[4][1]};
+        return forgetfulMedian<13>(candidates);
+    }
+}
+
+/**
+ * Perform 3x3 median filter with sorting networks, each thread computing 2x2 outputs.
+ * The sorted columns of the 4x4 window are shared by the two outputs of each row.
+ * @param src a Ptr2dNHWC <T> stored in global memory.
+ * @param dst a Ptr2dNHWC <T> stored in global memory.
+ */
+template<typename T>
+__global__ void medianNetwork3x3(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst)
+{
+    int x0       = (blockIdx.x * blockDim.x + threadIdx.x) * 2;
+    int y0       = (blockIdx.y * blockDim.y + threadIdx.y) * 2;
+    int channel  = blockIdx.z % dst.ch;
+    int batchIdx = blockIdx.z / dst.ch;
+    int h = src.rows, w = src.cols;
+
+    if (x0 >= w || y0 >= h)
+    {
+        return;
+    }
+
+    // the 4x4 window with nvcv::BORDER_REPLICATE
+    T v[4][4];
+#pragma unroll
+    for (int r = 0; r < 4; ++r)
+    {
+        int gy = min(max(y0 - 1 + r, 0), h - 1);
+#pragma unroll
+        for (int c = 0; c < 4; ++c)
+        {
+            int gx  = min(max(x0 - 1 + c, 0), w - 1);
+            v[r][c] = *src.ptr(batchIdx, gy, gx, channel);
+        }
+    }
+
+    T col[2][4][3];
+#pragma unroll
+    for (int o = 0; o < 2; ++o)
+    {
+#pragma unroll
+        for (int c = 0; c < 4; ++c)
+        {
+            col[o][c][0] = v[o][c];
+            col[o][c][1] = v[o + 1][c];
+            col[o][c][2] = v[o + 2][c];
+            sortNetwork<3>(col[o][c]);
+        }
+    }
+
+#pragma unroll
+    for (int o = 0; o < 2; ++o)
+    {
+#pragma unroll
+        for (int i = 0; i < 2; ++i)
+        {
+            if (y0 + o < h && x0 + i < w)
+            {
+                *dst.ptr(batchIdx, y0 + o, x0 + i, channel) = medianOfSortedColumns<3>(col[o] + i);
+            }
+        }
+    }
+}
+
+/**
+ * Perform 5x5 median filter with sorting networks, each thread computing 4x1 outputs.
+ * The 8 columns of the window are sorted once and shared by the 4 outputs.
+ * @param src a Ptr2dNHWC <T> stored in global memory.
+ * @param dst a Ptr2dNHWC <T> stored in global memory.
+ */
+template<typename T>
+__global__ void medianNetwork5x5(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst)
+{
+    int x0       = (blockIdx.x * blockDim.x + threadIdx.x) * 4;
+    int y        = blockIdx.y * blockDim.y + threadIdx.y;
+    int channel  = blockIdx.z % dst.ch;
+    int batchIdx = blockIdx.z / dst.ch;
+    int h = src.rows, w = src.cols;
+
+    if (x0 >= w || y >= h)
+    {
+        return;
+    }
+
+    T col[8][5];
+#pragma unroll
+    for (int c = 0; c < 8; ++c)
+    {
+        int gx = min(max(x0 - 2 + c, 0), w - 1);
+#pragma unroll
+        for (int r = 0; r < 5; ++r)
+        {
+            int gy    = min(max(y - 2 + r, 0), h - 1);
+            col[c][r] = *src.ptr(batchIdx, gy, gx, channel);
+        }
+        sortNetwork<5>(col[c]);
+    }
+
+#pragma unroll
+    for (int i = 0; i < 4; ++i)
+    {
+        if (x0 + i < w)
+        {
+            *dst.ptr(batchIdx, y, x0 + i, channel) = medianOfSortedColumns<5>(col + i);
+        }
+    }
+}
+
+/**
+ * Perform 3x3 or 5x5 median filter on 8-bit images with sorting networks of packed SIMD min/max, each thread
+ * computing 4x1 outputs, one per byte lane.
+ * @tparam K size of the square kernel, 3 or 5.
+ * @param src a Ptr2dNHWC <uchar> stored in global memory.
+ * @param dst a Ptr2dNHWC <uchar> stored in global memory.
+ */
+template<int K>
+__global__ void medianNetworkU8(const Ptr2dNHWC<uchar> src, Ptr2dNHWC<uchar> dst)
+{
+    constexpr int kRadius = K / 2;
+
+    int x0       = (blockIdx.x * blockDim.x + threadIdx.x) * 4;
+    int y        = blockIdx.y * blockDim.y + threadIdx.y;
+    int channel  = blockIdx.z % dst.ch;
+    int batchIdx = blockIdx.z / dst.ch;
+    int h = src.rows, w = src.cols;
+
+    if (x0 >= w || y >= h)
+    {
+        return;
+    }
+
+    // lane l of col[c][r] is the pixel at column x0 + l + c - kRadius of row y + r - kRadius
+    PackedU8 col[K][K];
+#pragma unroll
+    for (int r = 0; r < K; ++r)
+    {
+        int gy = min(max(y - kRadius + r, 0), h - 1);
+
+        unsigned int bytes[2] = {0, 0};
+#pragma unroll
+        for (int c = 0; c < K + 3; ++c)
+        {
+            int gx = min(max(x0 - kRadius + c, 0), w - 1);
+            bytes[c / 4] |= static_cast<unsigned int>(*src.ptr(batchIdx, gy, gx, channel)) << (8 * (c % 4));
+        }
+#pragma unroll
+        for (int c = 0; c < K; ++c)
+        {
+            col[c][r].v = __byte_perm(bytes[0], bytes[1], 0x3210 + c * 0x1111);
+        }
+    }
+
+#pragma unroll
+    for (int c = 0; c < K; ++c)
+    {
+        sortNetwork<K>(col[c]);
+    }
+
+    PackedU8 res = medianOfSortedColumns<K>(col);
+
+#pragma unroll
+    for (int i = 0; i < 4; ++i)
+    {
+        if (x0 + i < w)
+        {
+            *dst.ptr(batchIdx, y, x0 + i, channel) = static_cast<uchar>(res.v >> (8 * i));
+        }
+    }
+}
+
 template<typename T>
 void median(const nvcv::TensorDataAccessStridedImagePlanar &inData,
             const nvcv::TensorDataAccessStridedImagePlanar &outData, int kWidth, int kHeight, cudaStream_t stream)
@@ -339,21 +686,86 @@ void median(const nvcv::TensorDataAccessStridedImagePlanar &inData,
     checkCudaErrors(cudaStreamSynchronize(stream));
     checkCudaErrors(cudaGetLastError());
 #endif
-    long unsigned int sharedMemSize = SMALL_KERNEL_BLOCK * SMALL_KERNEL_BLOCK * kWidth * kHeight * sizeof(T);
-    if (sharedMemSize < 48 * 1024)
-    {
-        dim3 block(SMALL_KERNEL_BLOCK, SMALL_KERNEL_BLOCK);
-        dim3 grid(divUp(dst.cols, block.x), divUp(dst.rows, block.y), dst.ch * dst.batches);
-        medianForSmallKernel<T><<<grid, block, sharedMemSize, stream>>>(src, dst, kWidth, kHeight);
-        checkKernelErrors();
-    }
-    else
+
+    //variants: general kernel, shared memory kernel for small windows, constant-time histogram for large 8-bit ones,
+    //sorting networks for 3x3 and 5x5
+    const size_t smallMemSize = SMALL_KERNEL_BLOCK * SMALL_KERNEL_BLOCK * kWidth * kHeight * sizeof(T);
+    const size_t histMemSize  = (HISTOGRAM_TILE_W + kWidth - 1) * kMedianHistogramBins * sizeof(unsigned short);
+    const bool   can_small    = smallMemSize < 48 * 1024;
+    const bool   can_hist     = std::is_same_v<T, uchar> && histMemSize <= 48 * 1024;
+    const bool   can_network  = kWidth == kHeight && (kWidth == 3 || kWidth == 5);
+
+    auto launchMedian = [&](int variant, cudaStream_t s)
     {
-        dim3 block(GENERAL_KERNEL_BLOCK, GENERAL_KERNEL_BLOCK);
-        dim3 grid(divUp(dst.cols, block.x), divUp(dst.rows, block.y), dst.ch * dst.batches);
-        median<T><<<grid, block, 0, stream>>>(src, dst, kWidth, kHeight);
-        checkKernelErrors();
-    }
+        if (variant == 3)
+        {
+            dim3 block(NETWORK_BLOCK_W, NETWORK_BLOCK_H);
+            if constexpr (std::is_same_v<T, uchar>)
+            {
+                dim3 grid(divUp(dst.cols, block.x * 4), divUp(dst.rows, block.y), dst.ch * dst.batches);
+                if (kWidth == 3)
+                {
+                    medianNetworkU8<3><<<grid, block, 0, s>>>(src, dst);
+                }
+                else
+                {
+                    medianNetworkU8<5><<<grid, block, 0, s>>>(src, dst);
+                }
+            }
+            else if (kWidth == 3)
+            {
+                dim3 grid(divUp(dst.cols, block.x * 2), divUp(dst.rows, block.y * 2), dst.ch * dst.batches);
+                medianNetwork3x3<T><<<grid, block, 0, s>>>(src, dst);
+            }
+            else
+            {
+                dim3 grid(divUp(dst.cols, block.x * 4), divUp(dst.rows, block.y), dst.ch * dst.batches);
+                medianNetwork5x5<T><<<grid, block, 0, s>>>(src, dst);
+            }
+        }
+        else if (variant == 2)
+        {
+            if constexpr (std::is_same_v<T, uchar>)
+            {
+                dim3 block(kMedianHistogramBins);
+                dim3 grid(divUp(dst.cols, HISTOGRAM_TILE_W), divUp(dst.rows, HISTOGRAM_TILE_H), dst.ch * dst.batches);
+                medianHistogram<<<grid, block, histMemSize, s>>>(src, dst, kWidth, kHeight);
+            }
+        }
+        else if (variant == 1)
+        {
+            dim3 block(SMALL_KERNEL_BLOCK, SMALL_KERNEL_BLOCK);
+            dim3 grid(divUp(dst.cols, block.x), divUp(dst.rows, block.y), dst.ch * dst.batches);
+            medianForSmallKernel<T><<<grid, block, smallMemSize, s>>>(src, dst, kWidth, kHeight);
+        }
+        else
+        {
+            dim3 block(GENERAL_KERNEL_BLOCK, GENERAL_KERNEL_BLOCK);
+            dim3 grid(divUp(dst.cols, block.x), divUp(dst.rows, block.y), dst.ch * dst.batches);
+            median<T><<<grid, block, 0, s>>>(src, dst, kWidth, kHeight);
+        }
+    };
+
+    // 3x3 and 5x5 use the sorting networks and large 8-bit kernels the constant-time histogram median by default
+    const int fallback = can_network                                             ? 3
+                       : can_hist && kWidth * kHeight >= kMedianHistogramMinArea ? 2
+                       : can_small                                               ? 1
+                                                                                 : 0;
+
+    TuningKey key("median_blur");
+    key.add(inData.numSamples()).add(inData.numRows()).add(inData.numCols()).add(inData.numChannels());
+    key.add(static_cast<int64_t>(sizeof(T))).add(int64_t{std::is_floating_point_v<nvcv::cuda::BaseType<T>>});
+    key.add(kWidth).add(kHeight);
+
+    auto     &tuner   = KernelTuner::Instance();
+    const int variant = can_network && can_hist ? tuner.select(key, {0, 1, 2, 3}, fallback, launchMedian, stream)
+                      : can_network             ? tuner.select(key, {0, 1, 3}, fallback, launchMedian, stream)
+                      : can_hist && can_small   ? tuner.select(key, {0, 1, 2}, fallback, launchMedian, stream)
+                      : can_hist                ? tuner.select(key, {0, 2}, fallback, launchMedian, stream)
+                      : can_small               ? tuner.select(key, {0, 1}, fallback, launchMedian, stream)
+                                                : fallback;
+    launchMedian(variant, stream);
+    checkKernelErrors();
 
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
@@ -433,3 +845,7 @@ ErrorCode MedianBlur::infer(const ITensorDataStridedCuda &inData, const ITensorD
 
 #undef GENERAL_KERNEL_BLOCK
 #undef SMALL_KERNEL_BLOCK
+#undef HISTOGRAM_TILE_W
+#undef HISTOGRAM_TILE_H
+#undef NETWORK_BLOCK_W
+#undef NETWORK_BLOCK_H
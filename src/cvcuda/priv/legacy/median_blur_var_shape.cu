@@ -22,9 +22,11 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "MedianHistogram.cuh"
 
-#define GENERAL_KERNEL_BLOCK 32
-#define SMALL_KERNEL_BLOCK   16
+#define BLOCK_SIZE            16
+#define MAX_SMALL_KERNEL_AREA 49 // up to 7x7
+#define MAX_HIST_KERNEL_WIDTH 31 // widest kernel using the histogram median
 
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
@@ -81,154 +83,6 @@ __device__ T fetch(T *shared, const cuda::ImageBatchVarShapeWrapNHWC<T> src, int
     }
 }
 
-/**
- * Perform median fliter on the image
- * @tparam T The type of the pixels stored.
- * @param src a Ptr2dNHWC <T> stored in global memory.
- * @param dst a Ptr2dNHWC <T> stored in global memory.
- * @param kWidth width of the kernel.
- * @param kHeight height of the kernel.
- */
-template<typename T>
-__global__ void median(const cuda::ImageBatchVarShapeWrapNHWC<T> src, cuda::ImageBatchVarShapeWrapNHWC<T> dst,
-                       const cuda::Tensor2DWrap<int> ksize)
-{
-#define fetch_(gx, gy, block_size) \
-    fetch<T>(tails, src, batchIdx, h, w, channel, blockX, blockY, (gx), (gy), (block_size))
-#define fetchAs1d(idx, block_size) \
-    fetch_(x - (kWidth / 2) + ((idx) % kWidth), y - (kHeight / 2) + ((idx) / kWidth), (block_size))
-    int tx = threadIdx.x, ty = threadIdx.y;
-    int blockX   = blockIdx.x * blockDim.x;
-    int blockY   = blockIdx.y * blockDim.y;
-    int x        = blockX + threadIdx.x;
-    int y        = blockY + threadIdx.y;
-    int channel  = blockIdx.z % dst.numChannels();
-    int batchIdx = blockIdx.z / dst.numChannels();
-    int h = src.height(batchIdx), w = src.width(batchIdx);
-    int kWidth  = *ksize.ptr(batchIdx, 0); //kWidths[batchIdx];
-    int kHeight = *ksize.ptr(batchIdx, 1); //kHeights[batchIdx];
-
-    __shared__ T tails[GENERAL_KERNEL_BLOCK * GENERAL_KERNEL_BLOCK];
-    if (x < w && y < h)
-    {
-        tails[ty * GENERAL_KERNEL_BLOCK + tx] = *src.ptr(batchIdx, y, x, channel);
-    }
-    __syncthreads();
-
-    if ((x < w && y < h))
-    {
-        // min_ and max_ set up a range that we are looking for
-        // only elements in that range could be median
-        T    tmp, pivot0, pivot1, pivot2, min_, max_;
-        // In the 1st and possibly several following iterations, min_ or max_ is not assigned.
-        // use isMinReady and isMaxReady to control from comparison on them.
-        bool isMinReady = false, isMaxReady = false;
-        int  numOfEq = 0, numOfGt = 0, numOfLt = 0, numOfTaken = 0;
-        int  median = (kWidth * kHeight) / 2;
-        int  start = 0, end = kWidth * kHeight, t;
-        bool isAllPreviousOutOfRange = true;
-
-        // loop until we rule out all possible elements, and the last pivot is the median.
-        while (numOfTaken < (kWidth * kHeight))
-        {
-            pivot0 = fetchAs1d(start, GENERAL_KERNEL_BLOCK);
-            while ((isMinReady && (min_ >= pivot0)) || (isMaxReady && (max_ <= pivot0)))
-            {
-                start++;
-                pivot0 = fetchAs1d(start, GENERAL_KERNEL_BLOCK);
-            }
-
-            pivot2 = fetchAs1d(end - 1, GENERAL_KERNEL_BLOCK);
-            while ((isMinReady && (min_ >= pivot2)) || (isMaxReady && (max_ <= pivot2)))
-            {
-                end--;
-                pivot2 = fetchAs1d(end - 1, GENERAL_KERNEL_BLOCK);
-            }
-
-            int idx = (start + end) / 2;
-            pivot1  = fetchAs1d(idx, GENERAL_KERNEL_BLOCK);
-            // check if the pivot is in the range defined by min_ and max_.
-            // if not, go to the next until we find one that is in the range.
-            while ((isMinReady && (min_ >= pivot1)) || (isMaxReady && (max_ <= pivot1)))
-            {
-                idx++;
-                if (idx >= end)
-                {
-                    idx = start;
-                }
-                pivot1 = fetchAs1d(idx, GENERAL_KERNEL_BLOCK);
-            }
-
-            if (pivot0 < pivot1 && pivot1 < pivot2)
-            {
-                pivot0 = pivot1;
-            }
-            else if (pivot0 < pivot2 && pivot2 < pivot1)
-            {
-                pivot0 = pivot2;
-            }
-
-            // use the pivot to partition the array.
-            t = end;
-            for (int i = start; i < t; i++)
-            {
-                tmp = fetchAs1d(i, GENERAL_KERNEL_BLOCK);
-                // only consider the element in the range defined by min_ and max_.
-                // because others are already ruled out.
-                if ((!isMinReady || min_ < tmp) && (!isMaxReady || tmp < max_))
-                {
-                    if (tmp > pivot0)
-                    {
-                        numOfGt++;
-                    }
-                    else if (tmp < pivot0)
-                    {
-                        numOfLt++;
-                    }
-                    else
-                    {
-                        numOfEq++;
-                    }
-                    if (isAllPreviousOutOfRange)
-                    {
-                        start                   = i;
-                        isAllPreviousOutOfRange = false;
-                    }
-                    end = i + 1;
-                }
-            }
-
-            // if the index of median is less than numOfLt,
-            // use max_ to rule out elements greater than or equal to pivot.
-            if (median < numOfLt)
-            {
-                max_       = pivot0;
-                numOfTaken = numOfTaken + numOfEq + numOfGt;
-                isMaxReady = true;
-                // if the index of median is in between numOfLt and (numOfLt + numOfEq).
-                // the median is found. we are lucky:)
-            }
-            else if (median < (numOfLt + numOfEq))
-            {
-                break;
-                // if the index of median is greater than (numOfLt + numOfEq),
-                // use min_ to rule out elements greater than or equal to pivot.
-            }
-            else
-            {
-                min_       = pivot0;
-                median     = median - numOfLt - numOfEq;
-                numOfTaken = numOfTaken + numOfLt + numOfEq;
-                isMinReady = true;
-            }
-            numOfLt = 0;
-            numOfEq = 0;
-            numOfGt = 0;
-        }
-        *dst.ptr(batchIdx, y, x, channel) = pivot0;
-    }
-}
-
 template<typename T>
 __device__ int partition(T *arr, int length, T pvt, int *numOfEq)
 {
@@ -275,9 +129,189 @@ __inline__ __device__ T placePivot(T *arr, int length)
     return pivot0;
 }
 
+#define fetch_(gx, gy, block_size) \
+    fetch<T>(tails, src, batchIdx, h, w, channel, blockX, blockY, (gx), (gy), (block_size))
+#define fetchAs1d(idx, block_size) \
+    fetch_(x - (kWidth / 2) + ((idx) % kWidth), y - (kHeight / 2) + ((idx) / kWidth), (block_size))
+
+/**
+ * Computes the median of the kernel window centered at (x, y) for kernels of any size.
+ * It iteratively rules out elements using pivots, so that no extra storage is needed.
+ * @tparam T The type of the pixels stored.
+ * @param tails the block's pixels cached in shared memory.
+ * @param src a Ptr2dNHWC <T> stored in global memory.
+ * @param kWidth width of the kernel.
+ * @param kHeight height of the kernel.
+ * @return the median of the window.
+ */
+template<typename T>
+__device__ T medianGeneral(T *tails, const cuda::ImageBatchVarShapeWrapNHWC<T> &src, int batchIdx, int h, int w,
+                           int channel, int blockX, int blockY, int x, int y, int kWidth, int kHeight)
+{
+    // min_ and max_ set up a range that we are looking for
+    // only elements in that range could be median
+    T    tmp, pivot0, pivot1, pivot2, min_, max_;
+    // In the 1st and possibly several following iterations, min_ or max_ is not assigned.
+    // use isMinReady and isMaxReady to control from comparison on them.
+    bool isMinReady = false, isMaxReady = false;
+    int  numOfEq = 0, numOfGt = 0, numOfLt = 0, numOfTaken = 0;
+    int  median = (kWidth * kHeight) / 2;
+    int  start = 0, end = kWidth * kHeight, t;
+    bool isAllPreviousOutOfRange = true;
+
+    // loop until we rule out all possible elements, and the last pivot is the median.
+    while (numOfTaken < (kWidth * kHeight))
+    {
+        pivot0 = fetchAs1d(start, BLOCK_SIZE);
+        while ((isMinReady && (min_ >= pivot0)) || (isMaxReady && (max_ <= pivot0)))
+        {
+            start++;
+            pivot0 = fetchAs1d(start, BLOCK_SIZE);
+        }
+
+        pivot2 = fetchAs1d(end - 1, BLOCK_SIZE);
+        while ((isMinReady && (min_ >= pivot2)) || (isMaxReady && (max_ <= pivot2)))
+        {
+            end--;
+            pivot2 = fetchAs1d(end - 1, BLOCK_SIZE);
+        }
+
+        int idx = (start + end) / 2;
+        pivot1  = fetchAs1d(idx, BLOCK_SIZE);
+        // check if the pivot is in the range defined by min_ and max_.
+        // if not, go to the next until we find one that is in the range.
+        while ((isMinReady && (min_ >= pivot1)) || (isMaxReady && (max_ <= pivot1)))
+        {
+            idx++;
+            if (idx >= end)
+            {
+                idx = start;
+            }
+            pivot1 = fetchAs1d(idx, BLOCK_SIZE);
+        }
+
+        if (pivot0 < pivot1 && pivot1 < pivot2)
+        {
+            pivot0 = pivot1;
+        }
+        else if (pivot0 < pivot2 && pivot2 < pivot1)
+        {
+            pivot0 = pivot2;
+        }
+
+        // use the pivot to partition the array.
+        t = end;
+        for (int i = start; i < t; i++)
+        {
+            tmp = fetchAs1d(i, BLOCK_SIZE);
+            // only consider the element in the range defined by min_ and max_.
+            // because others are already ruled out.
+            if ((!isMinReady || min_ < tmp) && (!isMaxReady || tmp < max_))
+            {
+                if (tmp > pivot0)
+                {
+                    numOfGt++;
+                }
+                else if (tmp < pivot0)
+                {
+                    numOfLt++;
+                }
+                else
+                {
+                    numOfEq++;
+                }
+                if (isAllPreviousOutOfRange)
+                {
+                    start                   = i;
+                    isAllPreviousOutOfRange = false;
+                }
+                end = i + 1;
+            }
+        }
+
+        // if the index of median is less than numOfLt,
+        // use max_ to rule out elements greater than or equal to pivot.
+        if (median < numOfLt)
+        {
+            max_       = pivot0;
+            numOfTaken = numOfTaken + numOfEq + numOfGt;
+            isMaxReady = true;
+            // if the index of median is in between numOfLt and (numOfLt + numOfEq).
+            // the median is found. we are lucky:)
+        }
+        else if (median < (numOfLt + numOfEq))
+        {
+            break;
+            // if the index of median is greater than (numOfLt + numOfEq),
+            // use min_ to rule out elements greater than or equal to pivot.
+        }
+        else
+        {
+            min_       = pivot0;
+            median     = median - numOfLt - numOfEq;
+            numOfTaken = numOfTaken + numOfLt + numOfEq;
+            isMinReady = true;
+        }
+        numOfLt = 0;
+        numOfEq = 0;
+        numOfGt = 0;
+    }
+    return pivot0;
+}
+
+/**
+ * Computes the median of the kernel window centered at (x, y) using quickselect on a
+ * per-thread copy of the window. Only usable when the window fits in MAX_SMALL_KERNEL_AREA.
+ */
 template<typename T>
-__global__ void medianForSmallKernel(const cuda::ImageBatchVarShapeWrapNHWC<T> src,
-                                     cuda::ImageBatchVarShapeWrapNHWC<T> dst, const cuda::Tensor2DWrap<int> ksize)
+__device__ T medianSmall(T *tails, const cuda::ImageBatchVarShapeWrapNHWC<T> &src, int batchIdx, int h, int w,
+                         int channel, int blockX, int blockY, int x, int y, int kWidth, int kHeight)
+{
+    T   arrStorage[MAX_SMALL_KERNEL_AREA];
+    T  *arr    = arrStorage;
+    int length = kWidth * kHeight;
+    T   pivot;
+    int numOfEq, k = length / 2;
+
+    for (int i = 0; i < length; i++)
+    {
+        arr[i] = fetchAs1d(i, BLOCK_SIZE);
+    }
+    while (length > 1)
+    {
+        pivot      = placePivot(arr, length);
+        int middle = partition(arr, length, pivot, &numOfEq);
+        if (k < middle)
+        {
+            length = middle;
+        }
+        else if (k < (middle + numOfEq))
+        {
+            return pivot;
+        }
+        else
+        {
+            k      = k - middle - 1;
+            length = length - middle - 1;
+            arr    = arr + middle + 1;
+        }
+    }
+    return arr[0];
+}
+
+/**
+ * Perform median fliter on the image.
+ * Kernel sizes are read per sample from the ksize tensor, and the algorithm is chosen on
+ * device depending on the kernel area, so no host round-trip is needed.
+ * Samples with invalid kernel sizes (not positive and odd) are copied to the output unchanged.
+ * @tparam T The type of the pixels stored.
+ * @param src a Ptr2dNHWC <T> stored in global memory.
+ * @param dst a Ptr2dNHWC <T> stored in global memory.
+ * @param ksize {width, height} of the kernel of each sample.
+ */
+template<typename T>
+__global__ void median(const cuda::ImageBatchVarShapeWrapNHWC<T> src, cuda::ImageBatchVarShapeWrapNHWC<T> dst,
+                       const cuda::Tensor2DWrap<int> ksize)
 {
     int tx = threadIdx.x, ty = threadIdx.y;
     int blockX   = blockIdx.x * blockDim.x;
@@ -287,49 +321,62 @@ __global__ void medianForSmallKernel(const cuda::ImageBatchVarShapeWrapNHWC<T> s
     int channel  = blockIdx.z % dst.numChannels();
     int batchIdx = blockIdx.z / dst.numChannels();
     int h = src.height(batchIdx), w = src.width(batchIdx);
-    int kWidth  = *ksize.ptr(batchIdx, 0); //kWidths[batchIdx];
-    int kHeight = *ksize.ptr(batchIdx, 1); //kHeights[batchIdx];
+    int kWidth  = *ksize.ptr(batchIdx, 0);
+    int kHeight = *ksize.ptr(batchIdx, 1);
+
+    bool validKernel = kWidth > 0 && kWidth % 2 == 1 && kHeight > 0 && kHeight % 2 == 1;
 
-    __shared__ T tails[SMALL_KERNEL_BLOCK * SMALL_KERNEL_BLOCK];
+    if constexpr (std::is_same_v<T, uchar>)
+    {
+        // Large 8-bit kernels use the constant-time histogram median, the block's 256 threads act as bins.
+        if (validKernel && kWidth * kHeight >= kMedianHistogramMinArea && kWidth <= MAX_HIST_KERNEL_WIDTH)
+        {
+            __shared__ unsigned short colHist[(BLOCK_SIZE + MAX_HIST_KERNEL_WIDTH - 1) * kMedianHistogramBins];
+
+            auto fetch = [&](int gx, int gy) -> unsigned char
+            {
+                // nvcv::BORDER_REPLICATE
+                gx = min(max(gx, 0), w - 1);
+                gy = min(max(gy, 0), h - 1);
+                return *src.ptr(batchIdx, gy, gx, channel);
+            };
+
+            auto store = [&](int sx, int sy, unsigned char value)
+            {
+                *dst.ptr(batchIdx, sy, sx, channel) = value;
+            };
+
+            MedianHistogramTile(colHist, blockX, blockY, BLOCK_SIZE, BLOCK_SIZE, w, h, kWidth, kHeight, fetch, store);
+            return;
+        }
+    }
+
+    __shared__ T tails[BLOCK_SIZE * BLOCK_SIZE];
     if (x < w && y < h)
     {
-        tails[ty * SMALL_KERNEL_BLOCK + tx] = *src.ptr(batchIdx, y, x, channel);
+        tails[ty * BLOCK_SIZE + tx] = *src.ptr(batchIdx, y, x, channel);
     }
     __syncthreads();
 
-    extern __shared__ char _arrays[];
-    int                    length = kWidth * kHeight;
-    T                     *arr    = ((T *)_arrays) + ((tx * SMALL_KERNEL_BLOCK) + ty) * length;
-    T                      pivot;
-    int                    numOfEq, k = length / 2;
+    if (x >= w || y >= h)
+    {
+        return;
+    }
 
-    if ((x < w && y < h))
+    // Kernel size is uniform across the block, so are the branches below.
+    if (!validKernel)
     {
-        for (int i = 0; i < length; i++)
-        {
-            arr[i] = fetchAs1d(i, SMALL_KERNEL_BLOCK);
-        }
-        while (length > 1)
-        {
-            pivot      = placePivot(arr, length);
-            int middle = partition(arr, length, pivot, &numOfEq);
-            if (k < middle)
-            {
-                length = middle;
-            }
-            else if (k < (middle + numOfEq))
-            {
-                *dst.ptr(batchIdx, y, x, channel) = pivot;
-                return;
-            }
-            else
-            {
-                k      = k - middle - 1;
-                length = length - middle - 1;
-                arr    = arr + middle + 1;
-            }
-        }
-        *dst.ptr(batchIdx, y, x, channel) = arr[0];
+        *dst.ptr(batchIdx, y, x, channel) = tails[ty * BLOCK_SIZE + tx];
+    }
+    else if (kWidth * kHeight <= MAX_SMALL_KERNEL_AREA)
+    {
+        *dst.ptr(batchIdx, y, x, channel)
+            = medianSmall<T>(tails, src, batchIdx, h, w, channel, blockX, blockY, x, y, kWidth, kHeight);
+    }
+    else
+    {
+        *dst.ptr(batchIdx, y, x, channel)
+            = medianGeneral<T>(tails, src, batchIdx, h, w, channel, blockX, blockY, x, y, kWidth, kHeight);
     }
 }
 
@@ -338,7 +385,7 @@ __global__ void medianForSmallKernel(const cuda::ImageBatchVarShapeWrapNHWC<T> s
 
 template<typename T>
 void median(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda &out,
-            const ITensorDataStridedCuda &ksize, int maxKHeight, int maxKWidth, cudaStream_t stream)
+            const ITensorDataStridedCuda &ksize, cudaStream_t stream)
 {
     Size2D outMaxSize = out.maxSize();
 
@@ -357,21 +404,10 @@ void median(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarSh
     checkCudaErrors(cudaGetLastError());
 #endif
 
-    long unsigned int sharedMemSize = SMALL_KERNEL_BLOCK * SMALL_KERNEL_BLOCK * maxKWidth * maxKHeight * sizeof(T);
-    if (sharedMemSize < 48 * 1024)
-    {
-        dim3 block(SMALL_KERNEL_BLOCK, SMALL_KERNEL_BLOCK);
-        dim3 grid(divUp(maxWidth, block.x), divUp(maxHeight, block.y), channels * out.numImages());
-        medianForSmallKernel<T><<<grid, block, sharedMemSize, stream>>>(src, dst, ksize);
-        checkKernelErrors();
-    }
-    else
-    {
-        dim3 block(GENERAL_KERNEL_BLOCK, GENERAL_KERNEL_BLOCK);
-        dim3 grid(divUp(maxWidth, block.x), divUp(maxHeight, block.y), channels * out.numImages());
-        median<T><<<grid, block, 0, stream>>>(src, dst, ksize);
-        checkKernelErrors();
-    }
+    dim3 block(BLOCK_SIZE, BLOCK_SIZE);
+    dim3 grid(divUp(maxWidth, block.x), divUp(maxHeight, block.y), channels * out.numImages());
+    median<T><<<grid, block, 0, stream>>>(src, dst, ksizePtr);
+    checkKernelErrors();
 
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
@@ -383,23 +419,6 @@ MedianBlurVarShape::MedianBlurVarShape(const int maxBatchSize)
     : CudaBaseOp()
     , m_maxBatchSize(maxBatchSize)
 {
-    if (m_maxBatchSize > 0)
-    {
-        // {Width, Height} per image in var shape
-        size_t totalNumElements = m_maxBatchSize * 2;
-
-        m_kernelSizes.resize(totalNumElements);
-        if (m_kernelSizes.size() != totalNumElements)
-        {
-            LOG_ERROR("Host memory allocation error!!!");
-        }
-    }
-}
-
-MedianBlurVarShape::~MedianBlurVarShape()
-{
-    m_kernelSizes.clear();
-    m_kernelSizes.shrink_to_fit();
 }
 
 ErrorCode MedianBlurVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
@@ -452,52 +471,21 @@ ErrorCode MedianBlurVarShape::infer(const IImageBatchVarShapeDataStridedCuda &in
         return ErrorCode::INVALID_DATA_SHAPE;
     }
 
-    auto ksizeDataAccess = nvcv::TensorDataAccessStrided::Create(ksize);
-    NVCV_ASSERT(ksizeDataAccess);
-
-    // Copy the data to host
-    checkCudaErrors(cudaMemcpy2DAsync(m_kernelSizes.data(), sizeof(int) * 2, ksizeDataAccess->sampleData(0),
-                                      ksizeDataAccess->sampleStride(), sizeof(int) * 2, inData.numImages(),
-                                      cudaMemcpyDeviceToHost, stream));
-    checkCudaErrors(cudaStreamSynchronize(stream));
-
-    // Compute the max width & height of kernel sizes
-    int maxKHeight = 0, maxKWidth = 0;
-    for (int b = 0; b < inData.numImages(); b++)
-    {
-        int wIndex = b * 2;
-        int hIndex = b * 2 + 1;
-        if (!(m_kernelSizes[wIndex] > 0 && m_kernelSizes[wIndex] % 2 == 1 && m_kernelSizes[hIndex] > 0
-              && m_kernelSizes[hIndex] % 2 == 1))
-        {
-            LOG_ERROR("Invalid ksize " << m_kernelSizes[wIndex] << " " << m_kernelSizes[hIndex]);
-            return ErrorCode::INVALID_PARAMETER;
-        }
-
-        if (m_kernelSizes[wIndex] > maxKWidth)
-        {
-            maxKWidth = m_kernelSizes[wIndex];
-        }
-
-        if (m_kernelSizes[hIndex] > maxKHeight)
-        {
-            maxKHeight = m_kernelSizes[hIndex];
-        }
-    }
-
+    // Kernel sizes are validated and dispatched on device, no need to synchronize with the stream.
     typedef void (*median_t)(const IImageBatchVarShapeDataStridedCuda &in,
                              const IImageBatchVarShapeDataStridedCuda &out, const ITensorDataStridedCuda &ksize,
-                             int maxKHeight, int maxKWidth, cudaStream_t stream);
+                             cudaStream_t stream);
 
     static const median_t funcs[6] = {
         median<uchar>, 0, median<ushort>, 0, median<int>, median<float>,
 
     };
-    funcs[data_type](inData, outData, ksize, maxKHeight, maxKWidth, stream);
+    funcs[data_type](inData, outData, ksize, stream);
     return SUCCESS;
 }
 
 } // namespace nvcv::legacy::cuda_op
 
-#undef GENERAL_KERNEL_BLOCK
-#undef SMALL_KERNEL_BLOCK
+#undef BLOCK_SIZE
+#undef MAX_SMALL_KERNEL_AREA
+#undef MAX_HIST_KERNEL_WIDTH
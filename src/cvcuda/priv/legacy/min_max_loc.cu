@@ -0,0 +1,337 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "ReduceUtils.cuh"
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Minimum and maximum values of a segment part, with their indices in row-major order
+template<typename T>
+struct MinMaxLocValue
+{
+    T   minVal, maxVal;
+    int minIdx, maxIdx;
+};
+
+// Keeps the first location of the extrema, so results don't depend on the order values are combined
+struct MinMaxLocCombine
+{
+    template<typename T>
+    __device__ MinMaxLocValue<T> operator()(MinMaxLocValue<T> a, const MinMaxLocValue<T> &b) const
+    {
+        if (b.minVal < a.minVal || (b.minVal == a.minVal && b.minIdx < a.minIdx))
+        {
+            a.minVal = b.minVal;
+            a.minIdx = b.minIdx;
+        }
+        if (b.maxVal > a.maxVal || (b.maxVal == a.maxVal && b.maxIdx < a.maxIdx))
+        {
+            a.maxVal = b.maxVal;
+            a.maxIdx = b.maxIdx;
+        }
+        return a;
+    }
+};
+
+struct MinMaxLocOutputs
+{
+    nvcv::cuda::Tensor3DWrap<float> minVal, maxVal;
+    nvcv::cuda::Tensor3DWrap<int>   minLoc, maxLoc;
+};
+
+template<typename T>
+__device__ void writeMinMaxLoc(const MinMaxLocValue<T> &v, int s, int cols, const MinMaxLocOutputs &dst)
+{
+    int *minLoc = dst.minLoc.ptr(s, 0, 0);
+    int *maxLoc = dst.maxLoc.ptr(s, 0, 0);
+
+    *dst.minVal.ptr(s, 0, 0) = v.minVal;
+    *dst.maxVal.ptr(s, 0, 0) = v.maxVal;
+    minLoc[0]                = v.minIdx % cols;
+    minLoc[1]                = v.minIdx / cols;
+    maxLoc[0]                = v.maxIdx % cols;
+    maxLoc[1]                = v.maxIdx / cols;
+}
+
+// blockIdx.x is the segment, whose rows are split among gridDim.y blocks.  Threads start from the first pixel of
+// the segment, which is a valid extremum location whatever the data type.  A single block writes the result
+// directly, otherwise each block writes its partial result for minMaxLocFinalKernel.
+template<class Segments>
+__global__ void minMaxLocKernel(Segments src, MinMaxLocOutputs dst,
+                                MinMaxLocValue<typename Segments::value_type> *partials)
+{
+    using T = typename Segments::value_type;
+
+    const int segment = blockIdx.x;
+    const int rows    = src.numRows(segment);
+    const int cols    = src.numCols(segment);
+
+    const T           first = *src.row(segment, 0);
+    MinMaxLocValue<T> v     = {first, first, 0, 0};
+
+    for (int y = blockIdx.y * kReduceBlockH + threadIdx.y; y < rows; y += gridDim.y * kReduceBlockH)
+    {
+        const T *row = src.row(segment, y);
+        for (int x = threadIdx.x; x < cols; x += kReduceBlockW)
+        {
+            const T p = row[x];
+            // Pixels are visited in increasing index order, only strictly better values are kept
+            if (p < v.minVal)
+            {
+                v.minVal = p;
+                v.minIdx = y * cols + x;
+            }
+            if (p > v.maxVal)
+            {
+                v.maxVal = p;
+                v.maxIdx = y * cols + x;
+            }
+        }
+    }
+
+    v = BlockReduce(v, MinMaxLocCombine());
+
+    if (get_lid() != 0)
+    {
+        return;
+    }
+
+    if (gridDim.y == 1)
+    {
+        writeMinMaxLoc(v, segment, cols, dst);
+    }
+    else
+    {
+        partials[segment * gridDim.y + blockIdx.y] = v;
+    }
+}
+
+// One warp per segment reduces the partial results of its blocks.
+template<class Segments>
+__global__ void minMaxLocFinalKernel(Segments src, MinMaxLocOutputs dst,
+                                     const MinMaxLocValue<typename Segments::value_type> *partials, int num_blocks)
+{
+    const int segment = blockIdx.x;
+
+    auto v = ReducePartials(partials + segment * num_blocks, num_blocks, MinMaxLocCombine());
+
+    if (threadIdx.x == 0)
+    {
+        writeMinMaxLoc(v, segment, src.numCols(segment), dst);
+    }
+}
+
+template<class Segments>
+void minMaxLocCaller(const Segments &src, int num_segments, int max_rows, const MinMaxLocOutputs &dst,
+                     void *workspace, cudaStream_t stream)
+{
+    using Value = MinMaxLocValue<typename Segments::value_type>;
+
+    const int num_blocks = NumReduceBlocks(num_segments, max_rows);
+    Value    *partials   = static_cast<Value *>(workspace);
+
+    dim3 block(kReduceBlockW, kReduceBlockH);
+    dim3 grid(num_segments, num_blocks);
+
+    minMaxLocKernel<<<grid, block, 0, stream>>>(src, dst, partials);
+    checkKernelErrors();
+
+    if (num_blocks > 1)
+    {
+        minMaxLocFinalKernel<<<num_segments, 32, 0, stream>>>(src, dst, partials, num_blocks);
+        checkKernelErrors();
+    }
+}
+
+template<typename T>
+void minMaxLocTensor(const nvcv::TensorDataAccessStridedImagePlanar &inAccess, const MinMaxLocOutputs &dst,
+                     void *workspace, cudaStream_t stream)
+{
+    TensorSegments<T> src(inAccess, true);
+
+    minMaxLocCaller(src, inAccess.numSamples(), src.height, dst, workspace, stream);
+}
+
+template<typename T>
+void minMaxLocVarShape(const nvcv::IImageBatchVarShapeDataStridedCuda &inData, const MinMaxLocOutputs &dst,
+                       void *workspace, cudaStream_t stream)
+{
+    VarShapeSegments<T> src(inData);
+
+    minMaxLocCaller(src, inData.numImages(), inData.maxSize().h, dst, workspace, stream);
+}
+
+ErrorCode checkMinMaxLocOutput(const nvcv::ITensorDataStridedCuda &data, const char *name, int numSamples,
+                               DataType data_type, int numElements)
+{
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(data);
+    if (!access)
+    {
+        LOG_ERROR("Invalid " << name << " DataFormat");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (GetLegacyDataType(data.dtype()) != data_type)
+    {
+        LOG_ERROR("Invalid " << name << " DataType " << data.dtype() << ", it must be " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (access->numSamples() != numSamples || access->numRows() != 1 || access->numCols() != 1
+        || access->numChannels() != numElements)
+    {
+        LOG_ERROR("Invalid " << name << " shape " << data.shape() << ", it must have " << numSamples
+                             << " samples of " << numElements << " elements");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+// Checks the outputs shared by tensor and varshape variants, and wraps them.
+ErrorCode checkMinMaxLocParams(const nvcv::ITensorDataStridedCuda &minValData,
+                               const nvcv::ITensorDataStridedCuda &minLocData,
+                               const nvcv::ITensorDataStridedCuda &maxValData,
+                               const nvcv::ITensorDataStridedCuda &maxLocData, int numSamples, DataType data_type,
+                               MinMaxLocOutputs &dst)
+{
+    if (data_type == kCV_64F || data_type == kCV_16F)
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    ErrorCode err = ErrorCode::SUCCESS;
+    if ((err = checkMinMaxLocOutput(minValData, "minVal", numSamples, kCV_32F, 1)) != ErrorCode::SUCCESS
+        || (err = checkMinMaxLocOutput(maxValData, "maxVal", numSamples, kCV_32F, 1)) != ErrorCode::SUCCESS
+        || (err = checkMinMaxLocOutput(minLocData, "minLoc", numSamples, kCV_32S, 2)) != ErrorCode::SUCCESS
+        || (err = checkMinMaxLocOutput(maxLocData, "maxLoc", numSamples, kCV_32S, 2)) != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    dst.minVal = nvcv::cuda::CreateTensorWrapNHW<float>(minValData);
+    dst.maxVal = nvcv::cuda::CreateTensorWrapNHW<float>(maxValData);
+    dst.minLoc = nvcv::cuda::CreateTensorWrapNHW<int>(minLocData);
+    dst.maxLoc = nvcv::cuda::CreateTensorWrapNHW<int>(maxLocData);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t MinMaxLoc::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    // Partial results of the blocks, with 32-bit values at most
+    return kMaxReduceBlocks * sizeof(MinMaxLocValue<float>);
+}
+
+size_t MinMaxLocVarShape::calBufferSize()
+{
+    return kMaxReduceBlocks * sizeof(MinMaxLocValue<float>);
+}
+
+ErrorCode MinMaxLoc::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &minValData,
+                           const ITensorDataStridedCuda &minLocData, const ITensorDataStridedCuda &maxValData,
+                           const ITensorDataStridedCuda &maxLocData, cudaStream_t stream)
+{
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    if (!inAccess)
+    {
+        LOG_ERROR("Invalid input DataFormat");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (inAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid channel number " << inAccess->numChannels() << ", input must have a single channel");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    DataType         data_type = GetLegacyDataType(inData.dtype());
+    MinMaxLocOutputs dst;
+    ErrorCode        err = checkMinMaxLocParams(minValData, minLocData, maxValData, maxLocData,
+                                                inAccess->numSamples(), data_type, dst);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    typedef void (*func_t)(const TensorDataAccessStridedImagePlanar &inAccess, const MinMaxLocOutputs &dst,
+                           void *workspace, cudaStream_t stream);
+
+    static const func_t funcs[6] = {minMaxLocTensor<uchar>, minMaxLocTensor<schar>, minMaxLocTensor<ushort>,
+                                    minMaxLocTensor<short>, minMaxLocTensor<int>,   minMaxLocTensor<float>};
+
+    funcs[data_type](*inAccess, dst, gpuWorkspace(stream).get(), stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode MinMaxLocVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                   const ITensorDataStridedCuda &minValData, const ITensorDataStridedCuda &minLocData,
+                                   const ITensorDataStridedCuda &maxValData, const ITensorDataStridedCuda &maxLocData,
+                                   cudaStream_t stream)
+{
+    if (!inData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input varshape must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (inData.uniqueFormat().numChannels() != 1)
+    {
+        LOG_ERROR("Invalid channel number " << inData.uniqueFormat().numChannels()
+                                            << ", input must have a single channel");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    DataType         data_type = helpers::GetLegacyDataType(inData.uniqueFormat());
+    MinMaxLocOutputs dst;
+    ErrorCode        err = checkMinMaxLocParams(minValData, minLocData, maxValData, maxLocData, inData.numImages(),
+                                                data_type, dst);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (inData.numImages() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData, const MinMaxLocOutputs &dst,
+                           void *workspace, cudaStream_t stream);
+
+    static const func_t funcs[6] = {minMaxLocVarShape<uchar>, minMaxLocVarShape<schar>, minMaxLocVarShape<ushort>,
+                                    minMaxLocVarShape<short>, minMaxLocVarShape<int>,   minMaxLocVarShape<float>};
+
+    funcs[data_type](inData, dst, gpuWorkspace(stream).get(), stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -22,6 +22,7 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "StencilRegions.cuh"
 
 #include <nvcv/cuda/MathWrappers.hpp>
 #include <nvcv/cuda/SaturateCast.hpp>
@@ -31,25 +32,35 @@ using namespace nvcv::legacy::cuda_op;
 
 namespace nvcv::legacy::cuda_op {
 
-template<typename T, class SrcWrapper, class DstWrapper>
-__global__ void dilate(SrcWrapper src, DstWrapper dst, Size2D dstSize, Size2D kernelSize, int2 kernelAnchor, T maxmin)
+// KSize > 0 fixes a square kernel size at compile time so the loops are fully unrolled, 0 uses kernelSize
+template<int KSize, typename T, class SrcWrapper, class DstWrapper>
+__global__ void dilate(SrcWrapper src, DstWrapper dst, StencilRegion region, Size2D kernelSize, int2 kernelAnchor,
+                       T maxmin)
 {
     using PT = typename DstWrapper::ValueType;
     PT res   = cuda::SetAll<PT>(maxmin);
 
-    const int x         = blockIdx.x * blockDim.x + threadIdx.x;
-    const int y         = blockIdx.y * blockDim.y + threadIdx.y;
+    const int kernelWidth  = KSize > 0 ? KSize : kernelSize.w;
+    const int kernelHeight = KSize > 0 ? KSize : kernelSize.h;
+
+    const int dx        = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dy        = blockIdx.y * blockDim.y + threadIdx.y;
     const int batch_idx = get_batch_idx();
 
-    if (x >= dstSize.w || y >= dstSize.h)
+    if (dx >= region.size.w || dy >= region.size.h)
         return;
 
+    const int x = region.offset.x + dx;
+    const int y = region.offset.y + dy;
+
     int3 coord{x, y, batch_idx};
 
-    for (int i = 0; i < kernelSize.h; ++i)
+#pragma unroll
+    for (int i = 0; i < kernelHeight; ++i)
     {
         coord.y = y - kernelAnchor.y + i;
-        for (int j = 0; j < kernelSize.w; ++j)
+#pragma unroll
+        for (int j = 0; j < kernelWidth; ++j)
         {
             coord.x = x - kernelAnchor.x + j;
             res     = cuda::max(res, src[coord]);
@@ -58,25 +69,34 @@ __global__ void dilate(SrcWrapper src, DstWrapper dst, Size2D dstSize, Size2D ke
     *dst.ptr(batch_idx, y, x) = cuda::SaturateCast<T>(res);
 }
 
-template<typename T, class SrcWrapper, class DstWrapper>
-__global__ void erode(SrcWrapper src, DstWrapper dst, Size2D dstSize, Size2D kernelSize, int2 kernelAnchor, T maxmin)
+template<int KSize, typename T, class SrcWrapper, class DstWrapper>
+__global__ void erode(SrcWrapper src, DstWrapper dst, StencilRegion region, Size2D kernelSize, int2 kernelAnchor,
+                      T maxmin)
 {
     using PT = typename DstWrapper::ValueType;
     PT res   = cuda::SetAll<PT>(maxmin);
 
-    const int x         = blockIdx.x * blockDim.x + threadIdx.x;
-    const int y         = blockIdx.y * blockDim.y + threadIdx.y;
+    const int kernelWidth  = KSize > 0 ? KSize : kernelSize.w;
+    const int kernelHeight = KSize > 0 ? KSize : kernelSize.h;
+
+    const int dx        = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dy        = blockIdx.y * blockDim.y + threadIdx.y;
     const int batch_idx = get_batch_idx();
 
-    if (x >= dstSize.w || y >= dstSize.h)
+    if (dx >= region.size.w || dy >= region.size.h)
         return;
 
+    const int x = region.offset.x + dx;
+    const int y = region.offset.y + dy;
+
     int3 coord{x, y, batch_idx};
 
-    for (int i = 0; i < kernelSize.h; ++i)
+#pragma unroll
+    for (int i = 0; i < kernelHeight; ++i)
     {
         coord.y = y - kernelAnchor.y + i;
-        for (int j = 0; j < kernelSize.w; ++j)
+#pragma unroll
+        for (int j = 0; j < kernelWidth; ++j)
         {
             coord.x = x - kernelAnchor.x + j;
             res     = cuda::min(res, src[coord]);
@@ -85,12 +105,391 @@ __global__ void erode(SrcWrapper src, DstWrapper dst, Size2D dstSize, Size2D ker
     *dst.ptr(batch_idx, y, x) = cuda::SaturateCast<T>(res);
 }
 
+// Tile of outputs computed by one block of the van Herk/Gil-Werman kernel
+#define MORPH_VHGW_TILE_W   32
+#define MORPH_VHGW_TILE_H   32
+#define MORPH_VHGW_BLOCK    256
+#define MORPH_VHGW_MAX_SMEM (48 * 1024)
+
+struct MorphMin
+{
+    template<typename T>
+    __device__ T operator()(T a, T b) const
+    {
+        return cuda::min(a, b);
+    }
+};
+
+struct MorphMax
+{
+    template<typename T>
+    __device__ T operator()(T a, T b) const
+    {
+        return cuda::max(a, b);
+    }
+};
+
+inline int MorphVanHerkSharedMemSize(Size2D kernelSize, int elemSize)
+{
+    return (MORPH_VHGW_TILE_H + kernelSize.h - 1) * MORPH_VHGW_TILE_W * elemSize;
+}
+
+// van Herk/Gil-Werman min/max filter over a rectangular structuring element, done as a row pass into shared memory
+// followed by a column pass. Outputs are split in segments of k (the window length): for all windows starting in a
+// segment [b, b+k) the element b+k-1 is common, so each window is the combination of a suffix over [s, b+k) and a
+// prefix over [b+k, s+k), both computed with one sweep. This costs about three operations per pixel and pass
+// regardless of the kernel size, instead of kernelSize.w * kernelSize.h.
+template<class Op, class SrcWrapper, class DstWrapper>
+__global__ void morphVanHerk(SrcWrapper src, DstWrapper dst, Size2D dstSize, Size2D kernelSize, int2 kernelAnchor,
+                             Op op)
+{
+    using PT = typename DstWrapper::ValueType;
+
+    extern __shared__ __align__(16) unsigned char smem[];
+    PT *rowRes = reinterpret_cast<PT *>(smem);
+
+    const int x0        = blockIdx.x * MORPH_VHGW_TILE_W;
+    const int y0        = blockIdx.y * MORPH_VHGW_TILE_H;
+    const int batch_idx = get_batch_idx();
+    const int numRows   = MORPH_VHGW_TILE_H + kernelSize.h - 1;
+
+    // row pass: window minimum/maximum along x for every input row needed by the tile
+    const int rowSegs = divUp(MORPH_VHGW_TILE_W, kernelSize.w);
+    for (int item = threadIdx.x; item < numRows * rowSegs; item += blockDim.x)
+    {
+        const int r     = item / rowSegs;
+        const int first = (item % rowSegs) * kernelSize.w;
+        const int count = min(kernelSize.w, MORPH_VHGW_TILE_W - first);
+        const int b     = x0 + first - kernelAnchor.x;
+        const int m     = b + kernelSize.w - 1;
+
+        PT  *line = rowRes + r * MORPH_VHGW_TILE_W + first;
+        int3 coord{m, y0 - kernelAnchor.y + r, batch_idx};
+
+        PT acc = src[coord];
+        if (kernelSize.w - 1 < count)
+            line[kernelSize.w - 1] = acc;
+        for (int i = kernelSize.w - 2; i >= 0; --i)
+        {
+            coord.x = b + i;
+            acc     = op(acc, src[coord]);
+            if (i < count)
+                line[i] = acc;
+        }
+
+        for (int j = 1; j < count; ++j)
+        {
+            coord.x = m + j;
+            acc     = j == 1 ? src[coord] : op(acc, src[coord]);
+            line[j] = op(line[j], acc);
+        }
+    }
+
+    __syncthreads();
+
+    // column pass: window minimum/maximum along y of the row results, written straight to the output
+    const int colSegs = divUp(MORPH_VHGW_TILE_H, kernelSize.h);
+    for (int item = threadIdx.x; item < MORPH_VHGW_TILE_W * colSegs; item += blockDim.x)
+    {
+        const int c     = item % MORPH_VHGW_TILE_W;
+        const int first = (item / MORPH_VHGW_TILE_W) * kernelSize.h;
+        const int x     = x0 + c;
+        const int count = min(min(kernelSize.h, MORPH_VHGW_TILE_H - first), dstSize.h - y0 - first);
+
+        if (x >= dstSize.w || count <= 0)
+            continue;
+
+        const PT *column = rowRes + first * MORPH_VHGW_TILE_W + c;
+        const int m      = kernelSize.h - 1;
+
+        PT acc = column[m * MORPH_VHGW_TILE_W];
+        if (m < count)
+            *dst.ptr(batch_idx, y0 + first + m, x) = acc;
+        for (int i = m - 1; i >= 0; --i)
+        {
+            acc = op(acc, column[i * MORPH_VHGW_TILE_W]);
+            if (i < count)
+                *dst.ptr(batch_idx, y0 + first + i, x) = acc;
+        }
+
+        for (int j = 1; j < count; ++j)
+        {
+            PT  val = column[(m + j) * MORPH_VHGW_TILE_W];
+            PT *out = dst.ptr(batch_idx, y0 + first + j, x);
+
+            acc  = j == 1 ? val : op(acc, val);
+            *out = op(*out, acc);
+        }
+    }
+}
+
+// Tile of outputs computed by one block of the fused compound operations
+#define MORPH_FUSED_TILE_W   32
+#define MORPH_FUSED_TILE_H   8
+#define MORPH_FUSED_MAX_SMEM (48 * 1024)
+
+inline int MorphFusedSharedMemSize(Size2D kernelSize, int elemSize)
+{
+    return (MORPH_FUSED_TILE_W + kernelSize.w - 1) * (MORPH_FUSED_TILE_H + kernelSize.h - 1) * elemSize;
+}
+
+// Final step of the compound operations, from the result of the second operation and the source pixel
+struct MorphKeepResult
+{
+    template<typename T>
+    __device__ T operator()(T res, T) const
+    {
+        return res;
+    }
+};
+
+struct MorphSourceMinusResult
+{
+    template<typename T>
+    __device__ T operator()(T res, T src) const
+    {
+        return cuda::SaturateCast<cuda::BaseType<T>>(src - res);
+    }
+};
+
+struct MorphResultMinusSource
+{
+    template<typename T>
+    __device__ T operator()(T res, T src) const
+    {
+        return cuda::SaturateCast<cuda::BaseType<T>>(res - src);
+    }
+};
+
+// Combines op over the window of the pixel (x, y) of src, the pixels outside of the image being extrapolated with
+// the border B, or skipped for NVCV_BORDER_CONSTANT
+template<NVCVBorderType B, class Op, class SrcWrapper, typename PT>
+__device__ PT MorphWindow(const SrcWrapper &src, int batch_idx, int x, int y, Size2D size, Size2D kernelSize,
+                          int2 kernelAnchor, PT res, Op op)
+{
+    for (int i = 0; i < kernelSize.h; ++i)
+    {
+        int sy = y - kernelAnchor.y + i;
+        if constexpr (B == NVCV_BORDER_CONSTANT)
+        {
+            if (cuda::IsOutside(sy, size.h))
+                continue;
+        }
+        else
+        {
+            sy = cuda::GetIndexWithBorder<B>(sy, size.h);
+        }
+
+        for (int j = 0; j < kernelSize.w; ++j)
+        {
+            int sx = x - kernelAnchor.x + j;
+            if constexpr (B == NVCV_BORDER_CONSTANT)
+            {
+                if (cuda::IsOutside(sx, size.w))
+                    continue;
+            }
+            else
+            {
+                sx = cuda::GetIndexWithBorder<B>(sx, size.w);
+            }
+
+            res = op(res, *src.ptr(batch_idx, sy, sx));
+        }
+    }
+    return res;
+}
+
+// Open, close, top-hat and black-hat in one pass: the first operation is computed over the tile and the halo of
+// the second one into shared memory, and the second operation reads it from there, so the intermediate image never
+// goes to global memory. As in OpenCV, the halo outside of the image is the border of the intermediate image, the
+// first operation being computed at the extrapolated coordinates, and with NVCV_BORDER_CONSTANT the pixels outside
+// of the image are ignored by both operations.
+template<NVCVBorderType B, class FirstOp, class SecondOp, class Final, class SrcWrapper, class DstWrapper>
+__global__ void morphFused(SrcWrapper src, DstWrapper dst, Size2D size, Size2D kernelSize, int2 kernelAnchor,
+                           typename DstWrapper::ValueType firstInit, typename DstWrapper::ValueType secondInit,
+                           FirstOp firstOp, SecondOp secondOp, Final final)
+{
+    using PT = typename DstWrapper::ValueType;
+
+    extern __shared__ __align__(16) unsigned char smem[];
+    PT *mid = reinterpret_cast<PT *>(smem);
+
+    const int x0        = blockIdx.x * MORPH_FUSED_TILE_W;
+    const int y0        = blockIdx.y * MORPH_FUSED_TILE_H;
+    const int batch_idx = get_batch_idx();
+    const int midW      = MORPH_FUSED_TILE_W + kernelSize.w - 1;
+    const int midH      = MORPH_FUSED_TILE_H + kernelSize.h - 1;
+
+    for (int item = get_lid(); item < midW * midH; item += blockDim.x * blockDim.y)
+    {
+        int mx = x0 - kernelAnchor.x + item % midW;
+        int my = y0 - kernelAnchor.y + item / midW;
+
+        if constexpr (B == NVCV_BORDER_CONSTANT)
+        {
+            if (cuda::IsOutside(mx, size.w) || cuda::IsOutside(my, size.h))
+            {
+                mid[item] = secondInit;
+                continue;
+            }
+        }
+        else
+        {
+            mx = cuda::GetIndexWithBorder<B>(mx, size.w);
+            my = cuda::GetIndexWithBorder<B>(my, size.h);
+        }
+
+        mid[item] = MorphWindow<B>(src, batch_idx, mx, my, size, kernelSize, kernelAnchor, firstInit, firstOp);
+    }
+
+    __syncthreads();
+
+    const int x = x0 + threadIdx.x;
+    const int y = y0 + threadIdx.y;
+
+    if (x >= size.w || y >= size.h)
+        return;
+
+    PT res = secondInit;
+    for (int i = 0; i < kernelSize.h; ++i)
+    {
+        const PT *row = mid + (threadIdx.y + i) * midW + threadIdx.x;
+        for (int j = 0; j < kernelSize.w; ++j)
+        {
+            res = secondOp(res, row[j]);
+        }
+    }
+
+    *dst.ptr(batch_idx, y, x) = final(res, *src.ptr(batch_idx, y, x));
+}
+
+// Gradient, the dilation minus the erosion, from the same window
+template<NVCVBorderType B, class SrcWrapper, class DstWrapper>
+__global__ void morphGradient(SrcWrapper src, DstWrapper dst, Size2D size, Size2D kernelSize, int2 kernelAnchor,
+                              typename DstWrapper::ValueType minInit, typename DstWrapper::ValueType maxInit)
+{
+    using PT = typename DstWrapper::ValueType;
+
+    const int x         = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y         = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    if (x >= size.w || y >= size.h)
+        return;
+
+    const PT lo = MorphWindow<B>(src, batch_idx, x, y, size, kernelSize, kernelAnchor, minInit, MorphMin{});
+    const PT hi = MorphWindow<B>(src, batch_idx, x, y, size, kernelSize, kernelAnchor, maxInit, MorphMax{});
+
+    *dst.ptr(batch_idx, y, x) = cuda::SaturateCast<cuda::BaseType<PT>>(hi - lo);
+}
+
+template<typename D, NVCVBorderType B>
+void MorphCompound(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                   NVCVMorphologyType morph_type, Size2D kernelSize, int2 kernelAnchor, cudaStream_t stream)
+{
+    using BT = cuda::BaseType<D>;
+
+    const D minInit = cuda::SetAll<D>(std::numeric_limits<BT>::max());
+    const D maxInit = cuda::SetAll<D>(std::numeric_limits<BT>::lowest());
+
+    auto src = cuda::CreateTensorWrapNHW<const D>(inData);
+    auto dst = cuda::CreateTensorWrapNHW<D>(outData);
+
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+    Size2D size{outAccess->numCols(), outAccess->numRows()};
+
+    if (morph_type == NVCVMorphologyType::NVCV_GRADIENT)
+    {
+        dim3 block(32, 8);
+        dim3 grid(divUp(size.w, block.x), divUp(size.h, block.y), outAccess->numSamples());
+
+        morphGradient<B><<<grid, block, 0, stream>>>(src, dst, size, kernelSize, kernelAnchor, minInit, maxInit);
+        checkKernelErrors();
+        return;
+    }
+
+    dim3 block(MORPH_FUSED_TILE_W, MORPH_FUSED_TILE_H);
+    dim3 grid(divUp(size.w, MORPH_FUSED_TILE_W), divUp(size.h, MORPH_FUSED_TILE_H), outAccess->numSamples());
+    int  smemSize = MorphFusedSharedMemSize(kernelSize, sizeof(D));
+
+    switch (morph_type)
+    {
+    case NVCVMorphologyType::NVCV_OPEN:
+        morphFused<B><<<grid, block, smemSize, stream>>>(src, dst, size, kernelSize, kernelAnchor, minInit, maxInit,
+                                                         MorphMin{}, MorphMax{}, MorphKeepResult{});
+        break;
+    case NVCVMorphologyType::NVCV_CLOSE:
+        morphFused<B><<<grid, block, smemSize, stream>>>(src, dst, size, kernelSize, kernelAnchor, maxInit, minInit,
+                                                         MorphMax{}, MorphMin{}, MorphKeepResult{});
+        break;
+    case NVCVMorphologyType::NVCV_TOPHAT:
+        morphFused<B><<<grid, block, smemSize, stream>>>(src, dst, size, kernelSize, kernelAnchor, minInit, maxInit,
+                                                         MorphMin{}, MorphMax{}, MorphSourceMinusResult{});
+        break;
+    case NVCVMorphologyType::NVCV_BLACKHAT:
+        morphFused<B><<<grid, block, smemSize, stream>>>(src, dst, size, kernelSize, kernelAnchor, maxInit, minInit,
+                                                         MorphMax{}, MorphMin{}, MorphResultMinusSource{});
+        break;
+    default:
+        break;
+    }
+    checkKernelErrors();
+}
+
+template<int KSize, typename BT, class SrcWrapper, class DstWrapper>
+void MorphLaunch(SrcWrapper src, DstWrapper dst, NVCVMorphologyType morph_type, StencilRegion region,
+                 Size2D kernelSize, int2 kernelAnchor, BT val, dim3 block, int numSamples, cudaStream_t stream)
+{
+    dim3 grid(divUp(region.size.w, block.x), divUp(region.size.h, block.y), numSamples);
+
+    if (morph_type == NVCVMorphologyType::NVCV_ERODE)
+    {
+        erode<KSize><<<grid, block, 0, stream>>>(src, dst, region, kernelSize, kernelAnchor, val);
+        checkKernelErrors();
+    }
+    else if (morph_type == NVCVMorphologyType::NVCV_DILATE)
+    {
+        dilate<KSize><<<grid, block, 0, stream>>>(src, dst, region, kernelSize, kernelAnchor, val);
+        checkKernelErrors();
+    }
+}
+
+// Splits the output in the interior, read without border handling, and the border strips, see LaunchStencilRegions
+template<int KSize, typename BT, class BorderWrapper, class DstWrapper>
+void MorphLaunchRegions(const BorderWrapper &src, DstWrapper dst, NVCVMorphologyType morph_type, Size2D dstSize,
+                        Size2D srcSize, Size2D kernelSize, int2 kernelAnchor, BT val, dim3 block, int numSamples,
+                        cudaStream_t stream)
+{
+    LaunchStencilRegions(dstSize, srcSize, int2{-kernelAnchor.x, -kernelAnchor.y},
+                         int2{kernelSize.w - 1 - kernelAnchor.x, kernelSize.h - 1 - kernelAnchor.y},
+                         [&](auto interior, StencilRegion region)
+                         {
+                             if constexpr (decltype(interior)::value)
+                             {
+                                 MorphLaunch<KSize>(src.tensorWrap(), dst, morph_type, region, kernelSize,
+                                                    kernelAnchor, val, block, numSamples, stream);
+                             }
+                             else
+                             {
+                                 MorphLaunch<KSize>(src, dst, morph_type, region, kernelSize, kernelAnchor, val,
+                                                    block, numSamples, stream);
+                             }
+                         });
+}
+
 template<typename D, NVCVBorderType B>
 void MorphFilter2DCaller(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
                          NVCVMorphologyType morph_type, Size2D kernelSize, int2 kernelAnchor, cudaStream_t stream)
 {
+    if (morph_type != NVCVMorphologyType::NVCV_ERODE && morph_type != NVCVMorphologyType::NVCV_DILATE)
+    {
+        MorphCompound<D, B>(inData, outData, morph_type, kernelSize, kernelAnchor, stream);
+        return;
+    }
+
     using BT = cuda::BaseType<D>;
-    BT val   = (morph_type == NVCVMorphologyType::NVCV_DILATE) ? std::numeric_limits<BT>::min()
+    BT val   = (morph_type == NVCVMorphologyType::NVCV_DILATE) ? std::numeric_limits<BT>::lowest()
                                                                : std::numeric_limits<BT>::max();
 
     auto src = cuda::CreateBorderWrapNHW<const D, B>(inData, cuda::SetAll<D>(val));
@@ -100,22 +499,60 @@ void MorphFilter2DCaller(const ITensorDataStridedCuda &inData, const ITensorData
     NVCV_ASSERT(outAccess);
     Size2D dstSize{outAccess->numCols(), outAccess->numRows()};
     dim3   block(16, 16);
-    dim3   grid(divUp(dstSize.w, block.x), divUp(dstSize.h, block.y), outAccess->numSamples());
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+    Size2D srcSize{inAccess->numCols(), inAccess->numRows()};
 
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
     checkCudaErrors(cudaGetLastError());
 #endif
 
-    if (morph_type == NVCVMorphologyType::NVCV_ERODE)
+    // large kernels, including the ones fused from several iterations, use the van Herk/Gil-Werman filter
+    int vanHerkSmem = MorphVanHerkSharedMemSize(kernelSize, sizeof(D));
+    if (std::max(kernelSize.w, kernelSize.h) > 7 && vanHerkSmem <= MORPH_VHGW_MAX_SMEM)
     {
-        erode<BT><<<grid, block, 0, stream>>>(src, dst, dstSize, kernelSize, kernelAnchor, val);
-        checkKernelErrors();
+        dim3 vhgwGrid(divUp(dstSize.w, MORPH_VHGW_TILE_W), divUp(dstSize.h, MORPH_VHGW_TILE_H),
+                      outAccess->numSamples());
+
+        if (morph_type == NVCVMorphologyType::NVCV_ERODE)
+        {
+            morphVanHerk<<<vhgwGrid, MORPH_VHGW_BLOCK, vanHerkSmem, stream>>>(src, dst, dstSize, kernelSize,
+                                                                              kernelAnchor, MorphMin{});
+            checkKernelErrors();
+        }
+        else if (morph_type == NVCVMorphologyType::NVCV_DILATE)
+        {
+            morphVanHerk<<<vhgwGrid, MORPH_VHGW_BLOCK, vanHerkSmem, stream>>>(src, dst, dstSize, kernelSize,
+                                                                              kernelAnchor, MorphMax{});
+            checkKernelErrors();
+        }
     }
-    else if (morph_type == NVCVMorphologyType::NVCV_DILATE)
+    else
     {
-        dilate<BT><<<grid, block, 0, stream>>>(src, dst, dstSize, kernelSize, kernelAnchor, val);
-        checkKernelErrors();
+        // common square kernel sizes get unrolled specializations
+        int fixedSize = kernelSize.w == kernelSize.h ? kernelSize.w : 0;
+
+        switch (fixedSize)
+        {
+        case 3:
+            MorphLaunchRegions<3>(src, dst, morph_type, dstSize, srcSize, kernelSize, kernelAnchor, val, block,
+                                  outAccess->numSamples(), stream);
+            break;
+        case 5:
+            MorphLaunchRegions<5>(src, dst, morph_type, dstSize, srcSize, kernelSize, kernelAnchor, val, block,
+                                  outAccess->numSamples(), stream);
+            break;
+        case 7:
+            MorphLaunchRegions<7>(src, dst, morph_type, dstSize, srcSize, kernelSize, kernelAnchor, val, block,
+                                  outAccess->numSamples(), stream);
+            break;
+        default:
+            MorphLaunchRegions<0>(src, dst, morph_type, dstSize, srcSize, kernelSize, kernelAnchor, val, block,
+                                  outAccess->numSamples(), stream);
+            break;
+        }
     }
 
 #ifdef CUDA_DEBUG_LOG
@@ -197,6 +634,12 @@ ErrorCode Morphology::infer(const ITensorDataStridedCuda &inData, const ITensorD
         LOG_ERROR("Invalid borderMode " << borderMode);
         return ErrorCode::INVALID_PARAMETER;
     }
+    if (!(morph_type >= NVCV_ERODE && morph_type <= NVCV_BLACKHAT))
+    {
+        LOG_ERROR("Invalid morph_type " << morph_type);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
     Size2D mask_size_ = mask_size;
     if (mask_size.w == -1 || mask_size.h == -1)
     {
@@ -207,6 +650,20 @@ ErrorCode Morphology::infer(const ITensorDataStridedCuda &inData, const ITensorD
     int2 anchor_ = anchor;
     normalizeAnchor(anchor_, mask_size_);
 
+    const bool isDifference = morph_type == NVCV_GRADIENT || morph_type == NVCV_TOPHAT || morph_type == NVCV_BLACKHAT;
+
+    if ((iteration == 0 || mask_size_.w * mask_size_.h == 1) && isDifference)
+    {
+        // the difference of an image with itself
+        for (uint32_t i = 0; i < inAccess->numSamples(); ++i)
+        {
+            checkCudaErrors(cudaMemset2DAsync(outAccess->sampleData(i), outAccess->rowStride(), 0,
+                                              outAccess->numCols() * outAccess->colStride(),
+                                              outAccess->numRows(), stream));
+        }
+        return SUCCESS;
+    }
+
     if (iteration == 0 || mask_size_.w * mask_size_.h == 1)
     {
         // just a unity copy here
@@ -230,6 +687,14 @@ ErrorCode Morphology::infer(const ITensorDataStridedCuda &inData, const ITensorD
     mask_size_.h = mask_size_.h + (iteration - 1) * (mask_size_.h - 1);
     anchor_      = anchor_ * iteration;
 
+    if (morph_type != NVCV_ERODE && morph_type != NVCV_DILATE && morph_type != NVCV_GRADIENT
+        && MorphFusedSharedMemSize(mask_size_, inAccess->colStride()) > MORPH_FUSED_MAX_SMEM)
+    {
+        LOG_ERROR("Invalid mask size " << mask_size_.w << "x" << mask_size_.h << " with " << iteration
+                                       << " iterations, the intermediate tile doesn't fit in shared memory");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
     typedef void (*filter2D_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
                                NVCVMorphologyType morph_type, Size2D kernelSize, int2 kernelAnchor,
                                NVCVBorderType borderMode, cudaStream_t stream);
@@ -236,6 +236,12 @@ ErrorCode MorphologyVarShape::infer(const nvcv::IImageBatchVarShape &inBatch, co
         return ErrorCode::INVALID_PARAMETER;
     }
 
+    if (morph_type != NVCV_ERODE && morph_type != NVCV_DILATE)
+    {
+        LOG_ERROR("Invalid morph_type " << morph_type << ", only erode and dilate are supported with varshape");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
     if (input_format != output_format)
     {
         LOG_ERROR("Invalid DataFormat between input (" << input_format << ") and output (" << output_format << ")");
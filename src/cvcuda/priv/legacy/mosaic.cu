@@ -0,0 +1,317 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+#include <nvcv/cuda/MathWrappers.hpp>
+
+#include <algorithm>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+constexpr int kBlockW = 32;
+constexpr int kBlockH = 8;
+
+// Blocks are launched per image since the rectangles are only known on device. Each image gets enough blocks to
+// fill the device when there are few of them, and its blocks share the tiles of its rectangle.
+constexpr int kTargetBlocks      = 1024;
+constexpr int kMaxBlocksPerImage = 64;
+
+// Calls f(x, y) for each pixel of a size.x x size.y rectangle, split in tiles shared by the blocks of the image.
+template<class F>
+__device__ void ForEachPixel(int2 size, F &&f)
+{
+    const int tilesX   = (size.x + kBlockW - 1) / kBlockW;
+    const int numTiles = tilesX * ((size.y + kBlockH - 1) / kBlockH);
+
+    for (int t = blockIdx.x; t < numTiles; t += gridDim.x)
+    {
+        const int x = (t % tilesX) * kBlockW + threadIdx.x;
+        const int y = (t / tilesX) * kBlockH + threadIdx.y;
+        if (x < size.x && y < size.y)
+        {
+            f(x, y);
+        }
+    }
+}
+
+// Canvas pixels [lo, hi) whose centers are inside [c1, c2), clipped to [0, size).
+__device__ int2 CoveredPixels(float c1, float c2, int size)
+{
+    const float s = static_cast<float>(size);
+    return int2{static_cast<int>(fminf(fmaxf(ceilf(c1 - 0.5f), 0.f), s)),
+                static_cast<int>(fminf(fmaxf(ceilf(c2 - 0.5f), 0.f), s))};
+}
+
+// Averages the source pixels under the footprint of a canvas pixel centered at (fx, fy), weighted by their overlap
+// with it, as in area resize. The footprint is at least one source pixel wide, so upscaling interpolates linearly.
+template<typename T>
+__device__ nvcv::cuda::ConvertBaseTypeTo<float, T> AreaSample(const nvcv::cuda::ImageBatchVarShapeWrap<const T> &src,
+                                                              int sample, int2 size, float fx, float fy,
+                                                              float scale_x, float scale_y)
+{
+    using work_type = nvcv::cuda::ConvertBaseTypeTo<float, T>;
+
+    const float fw = fmaxf(scale_x, 1.f);
+    const float fh = fmaxf(scale_y, 1.f);
+
+    // footprint clipped to the image, footprints on its edges keep the closest pixels
+    float ax = fmaxf(fx - 0.5f * fw, 0.f), bx = fminf(fx + 0.5f * fw, static_cast<float>(size.x));
+    float ay = fmaxf(fy - 0.5f * fh, 0.f), by = fminf(fy + 0.5f * fh, static_cast<float>(size.y));
+    if (bx <= ax)
+    {
+        ax = fminf(floorf(ax), size.x - 1.f);
+        bx = ax + 1.f;
+    }
+    if (by <= ay)
+    {
+        ay = fminf(floorf(ay), size.y - 1.f);
+        by = ay + 1.f;
+    }
+
+    const int x0 = __float2int_rd(ax), x1 = __float2int_ru(bx);
+    const int y0 = __float2int_rd(ay), y1 = __float2int_ru(by);
+
+    work_type sum = nvcv::cuda::SetAll<work_type>(0);
+    for (int sy = y0; sy < y1; ++sy)
+    {
+        const float wy  = fminf(by, sy + 1.f) - fmaxf(ay, static_cast<float>(sy));
+        const T    *row = src.ptr(sample, sy, 0);
+
+        work_type rowSum = nvcv::cuda::SetAll<work_type>(0);
+        for (int sx = x0; sx < x1; ++sx)
+        {
+            const float wx = fminf(bx, sx + 1.f) - fmaxf(ax, static_cast<float>(sx));
+            rowSum += row[sx] * wx;
+        }
+        sum += rowSum * wy;
+    }
+
+    return sum * (1.f / ((bx - ax) * (by - ay)));
+}
+
+// Each image is resized into its rectangle, mapped with pixel centers aligned as in Resize: the source coordinate
+// of canvas pixel x is (x + 0.5 - x1) * srcWidth / (x2 - x1). Rectangles partly outside of their canvas are clipped,
+// which crops the image, as mosaic augmentation does around its random center.
+template<typename T>
+__global__ void mosaic(nvcv::cuda::ImageBatchVarShapeWrap<const T> src, nvcv::cuda::Tensor2DWrap<const float> rects,
+                       nvcv::cuda::Tensor3DWrap<T> dst, int numCanvases, int2 canvasSize,
+                       NVCVInterpolationType interpolation)
+{
+    using work_type = nvcv::cuda::ConvertBaseTypeTo<float, T>;
+
+    const int sample = blockIdx.y;
+
+    const float *rect   = rects.ptr(sample, 0);
+    const int    canvas = __float2int_rn(rect[0]);
+    const float  x1 = rect[1], y1 = rect[2], x2 = rect[3], y2 = rect[4];
+
+    const int2 srcSize{src.width(sample), src.height(sample)};
+
+    if (canvas < 0 || canvas >= numCanvases || !(x2 > x1 && y2 > y1) || srcSize.x <= 0 || srcSize.y <= 0)
+    {
+        return;
+    }
+
+    const int2 xs = CoveredPixels(x1, x2, canvasSize.x);
+    const int2 ys = CoveredPixels(y1, y2, canvasSize.y);
+
+    const float scale_x = srcSize.x / (x2 - x1);
+    const float scale_y = srcSize.y / (y2 - y1);
+
+    ForEachPixel(int2{xs.y - xs.x, ys.y - ys.x},
+                 [&](int dx, int dy)
+                 {
+                     const int x = xs.x + dx;
+                     const int y = ys.x + dy;
+
+                     const float fx = (x + 0.5f - x1) * scale_x;
+                     const float fy = (y + 0.5f - y1) * scale_y;
+
+                     T *out = dst.ptr(canvas, y, x);
+
+                     if (interpolation == NVCV_INTERP_NEAREST)
+                     {
+                         const int sx = nvcv::cuda::clamp(__float2int_rd(fx), 0, srcSize.x - 1);
+                         const int sy = nvcv::cuda::clamp(__float2int_rd(fy), 0, srcSize.y - 1);
+
+                         *out = *src.ptr(sample, sy, sx);
+                     }
+                     else if (interpolation == NVCV_INTERP_AREA)
+                     {
+                         *out = nvcv::cuda::SaturateCast<T>(AreaSample(src, sample, srcSize, fx, fy, scale_x, scale_y));
+                     }
+                     else
+                     {
+                         // pixels outside of the image replicate its border
+                         const int   sx = __float2int_rd(fx - 0.5f), sy = __float2int_rd(fy - 0.5f);
+                         const float ax = fx - 0.5f - sx, ay = fy - 0.5f - sy;
+
+                         const int sx0 = nvcv::cuda::clamp(sx, 0, srcSize.x - 1);
+                         const int sx1 = nvcv::cuda::clamp(sx + 1, 0, srcSize.x - 1);
+                         const T  *r0  = src.ptr(sample, nvcv::cuda::clamp(sy, 0, srcSize.y - 1), 0);
+                         const T  *r1  = src.ptr(sample, nvcv::cuda::clamp(sy + 1, 0, srcSize.y - 1), 0);
+
+                         const work_type value = (1.f - ay) * (r0[sx0] * (1.f - ax) + r0[sx1] * ax)
+                                               + ay * (r1[sx0] * (1.f - ax) + r1[sx1] * ax);
+
+                         *out = nvcv::cuda::SaturateCast<T>(value);
+                     }
+                 });
+}
+
+template<typename T>
+void launchMosaic(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &rectData,
+                  const ITensorDataStridedCuda &outData, NVCVInterpolationType interpolation, cudaStream_t stream)
+{
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    const int  numImages = inData.numImages();
+    const int2 canvasSize{static_cast<int>(outAccess->numCols()), static_cast<int>(outAccess->numRows())};
+
+    nvcv::cuda::ImageBatchVarShapeWrap<const T> src(inData);
+    nvcv::cuda::Tensor2DWrap<const float>       rects(rectData.basePtr(), static_cast<int>(rectData.stride(0)));
+    nvcv::cuda::Tensor3DWrap<T> dst(outAccess->sampleData(0), static_cast<int>(outAccess->sampleStride()),
+                                    static_cast<int>(outAccess->rowStride()));
+
+    dim3 block(kBlockW, kBlockH);
+    dim3 grid(std::clamp(kTargetBlocks / numImages, 1, kMaxBlocksPerImage), numImages);
+
+    mosaic<T><<<grid, block, 0, stream>>>(src, rects, dst, static_cast<int>(outAccess->numSamples()), canvasSize,
+                                          interpolation);
+    checkKernelErrors();
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+ErrorCode Mosaic::infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &rectData,
+                        const ITensorDataStridedCuda &outData, const NVCVInterpolationType interpolation,
+                        cudaStream_t stream)
+{
+    DataFormat input_format = GetLegacyDataFormat(inData);
+    if (!(input_format == kNHWC || input_format == kHWC))
+    {
+        LOG_ERROR("Invalid input DataFormat " << input_format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!inData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input batch must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataFormat output_format = GetLegacyDataFormat(outData.layout());
+    if (!(output_format == kNHWC || output_format == kHWC))
+    {
+        LOG_ERROR("Invalid output DataFormat " << output_format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataType data_type = GetLegacyDataType(inData.uniqueFormat());
+    if (data_type != GetLegacyDataType(outData.dtype()))
+    {
+        LOG_ERROR("Invalid DataType between input (" << data_type << ") and output ("
+                                                     << GetLegacyDataType(outData.dtype()) << ")");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_16S || data_type == kCV_32F))
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    const int channels = inData.uniqueFormat().numChannels();
+    if (channels != 1 && channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (outAccess->numChannels() != channels)
+    {
+        LOG_ERROR("Invalid output channel number " << outAccess->numChannels() << ", it must be " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (interpolation != NVCV_INTERP_NEAREST && interpolation != NVCV_INTERP_LINEAR
+        && interpolation != NVCV_INTERP_AREA)
+    {
+        LOG_ERROR("Unsupported interpolation method " << interpolation);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (rectData.dtype() != TYPE_F32)
+    {
+        LOG_ERROR("Invalid rectangles DataType " << rectData.dtype() << ", it must be float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    const int numImages = inData.numImages();
+    if (rectData.rank() != 2 || rectData.shape(0) != numImages || rectData.shape(1) != 5
+        || rectData.stride(1) != sizeof(float) || numImages > 65535)
+    {
+        LOG_ERROR("Invalid rectangles " << rectData.shape() << ", they must be packed with shape [" << numImages
+                                        << ", 5] for at most 65535 images");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (numImages == 0 || outAccess->numSamples() == 0 || outAccess->numCols() == 0 || outAccess->numRows() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &rectData,
+                           const ITensorDataStridedCuda &outData, NVCVInterpolationType interpolation,
+                           cudaStream_t stream);
+
+    static const func_t funcs[6][4] = {
+        { launchMosaic<uchar>, 0,  launchMosaic<uchar3>,  launchMosaic<uchar4>},
+        {                   0, 0,                     0,                     0},
+        {launchMosaic<ushort>, 0, launchMosaic<ushort3>, launchMosaic<ushort4>},
+        { launchMosaic<short>, 0,  launchMosaic<short3>,  launchMosaic<short4>},
+        {                   0, 0,                     0,                     0},
+        { launchMosaic<float>, 0,  launchMosaic<float3>,  launchMosaic<float4>}
+    };
+
+    const func_t func = funcs[data_type][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(inData, rectData, outData, interpolation, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,283 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "ReduceUtils.cuh"
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+__device__ __forceinline__ float IoU(const float4 &a, const float4 &b)
+{
+    const float iw = fminf(a.z, b.z) - fmaxf(a.x, b.x);
+    const float ih = fminf(a.w, b.w) - fmaxf(a.y, b.y);
+    if (iw <= 0.f || ih <= 0.f)
+    {
+        return 0.f;
+    }
+    const float inter = iw * ih;
+    const float uni   = (a.z - a.x) * (a.w - a.y) + (b.z - b.x) * (b.w - b.y) - inter;
+    return uni > 0.f ? inter / uni : 0.f;
+}
+
+// One block per sample keeps boxes greedily: each round reduces the live scores to the best box, which is kept, and
+// suppresses or decays the live boxes overlapping it. Suppressed boxes have a live score of -inf. Each thread only
+// ever touches the live scores of its own boxes, so rounds only synchronize on the box kept.
+__global__ void nms_kernel(const nvcv::cuda::Tensor3DWrap<const float4> boxes,
+                           const nvcv::cuda::Tensor3DWrap<const float> scores,
+                           const nvcv::cuda::Tensor3DWrap<const int> classes, bool hasClasses, float *workspace,
+                           int numBoxes, nvcv::cuda::Tensor3DWrap<int> outIndices,
+                           nvcv::cuda::Tensor3DWrap<float> outScores, nvcv::cuda::Tensor3DWrap<int> outCount,
+                           int maxOutput, float scoreThreshold, float iouThreshold, float softSigma)
+{
+    constexpr int kThreads = kReduceBlockW * kReduceBlockH;
+
+    __shared__ ScoreCandidate kept;
+
+    const int sample = blockIdx.x;
+    const int lid    = get_lid();
+    float    *live   = workspace + static_cast<int64_t>(sample) * numBoxes;
+
+    for (int i = lid; i < numBoxes; i += kThreads)
+    {
+        const float s = *scores.ptr(sample, 0, i);
+        live[i]       = s >= scoreThreshold ? s : -INFINITY;
+    }
+
+    int count = 0;
+    for (; count < maxOutput; ++count)
+    {
+        ScoreCandidate best{0.f, -1};
+        for (int i = lid; i < numBoxes; i += kThreads)
+        {
+            const ScoreCandidate c{live[i], i};
+            if (c.value != -INFINITY && RanksBefore(c, best))
+            {
+                best = c;
+            }
+        }
+
+        best = BlockReduce(best, FirstRanked{});
+        if (lid == 0)
+        {
+            kept = best;
+        }
+        __syncthreads();
+        const ScoreCandidate k = kept;
+
+        if (k.index < 0)
+        {
+            break;
+        }
+
+        if (lid == 0)
+        {
+            *outIndices.ptr(sample, 0, count) = k.index;
+            *outScores.ptr(sample, 0, count)  = k.value;
+        }
+
+        const float4 keptBox   = *boxes.ptr(sample, 0, k.index);
+        const int    keptClass = hasClasses ? *classes.ptr(sample, 0, k.index) : 0;
+
+        for (int i = lid; i < numBoxes; i += kThreads)
+        {
+            float s = live[i];
+            if (s == -INFINITY || (hasClasses && *classes.ptr(sample, 0, i) != keptClass))
+            {
+                continue;
+            }
+
+            if (i == k.index)
+            {
+                live[i] = -INFINITY;
+                continue;
+            }
+
+            const float iou = IoU(keptBox, *boxes.ptr(sample, 0, i));
+            if (softSigma > 0.f)
+            {
+                s *= expf(-iou * iou / softSigma);
+                live[i] = s >= scoreThreshold ? s : -INFINITY;
+            }
+            else if (iou > iouThreshold)
+            {
+                live[i] = -INFINITY;
+            }
+        }
+    }
+
+    for (int r = count + lid; r < maxOutput; r += kThreads)
+    {
+        *outIndices.ptr(sample, 0, r) = -1;
+        *outScores.ptr(sample, 0, r)  = 0.f;
+    }
+    if (lid == 0)
+    {
+        *outCount.ptr(sample, 0, 0) = count;
+    }
+}
+
+template<typename T>
+nvcv::cuda::Tensor3DWrap<T> wrapRows(const nvcv::TensorDataAccessStridedImagePlanar &access)
+{
+    return nvcv::cuda::Tensor3DWrap<T>(access.sampleData(0), static_cast<int>(access.sampleStride()),
+                                       static_cast<int>(access.rowStride()));
+}
+
+// Per-sample values are one row of single-channel elements.
+bool isValueRow(const nvcv::TensorDataAccessStridedImagePlanar &access, int numSamples, int numCols)
+{
+    return access.numSamples() == numSamples && access.numRows() == 1 && access.numChannels() == 1
+        && access.numCols() == numCols;
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+NMS::NMS(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size, int max_num_boxes)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_maxBatchSize(max_batch_size)
+    , m_maxNumBoxes(max_num_boxes)
+{
+    setGpuWorkspaceSize(calBufferSize(max_batch_size, max_num_boxes));
+}
+
+size_t NMS::calBufferSize(int max_batch_size, int max_num_boxes)
+{
+    // Live score of each box
+    return static_cast<size_t>(std::max(max_batch_size, 0)) * std::max(max_num_boxes, 0) * sizeof(float);
+}
+
+ErrorCode NMS::infer(const ITensorDataStridedCuda &boxData, const ITensorDataStridedCuda &scoreData,
+                     const ITensorDataStridedCuda *classData, const ITensorDataStridedCuda &outIndexData,
+                     const ITensorDataStridedCuda &outScoreData, const ITensorDataStridedCuda &outCountData,
+                     float score_threshold, float iou_threshold, float soft_sigma, cudaStream_t stream)
+{
+    for (const ITensorDataStridedCuda *data : {&boxData, &scoreData, classData, &outIndexData, &outScoreData,
+                                               &outCountData})
+    {
+        if (data == nullptr)
+        {
+            continue;
+        }
+
+        DataFormat format = GetLegacyDataFormat(data->layout());
+        if (!(format == kNHWC || format == kHWC))
+        {
+            LOG_ERROR("Invalid DataFormat " << format);
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+    }
+
+    if (boxData.dtype() != nvcv::TYPE_F32 || scoreData.dtype() != nvcv::TYPE_F32
+        || outScoreData.dtype() != nvcv::TYPE_F32)
+    {
+        LOG_ERROR("Invalid DataType, boxes and scores must be float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if ((classData && classData->dtype() != nvcv::TYPE_S32) || outIndexData.dtype() != nvcv::TYPE_S32
+        || outCountData.dtype() != nvcv::TYPE_S32)
+    {
+        LOG_ERROR("Invalid DataType, classes, indices and counts must be int32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (!(iou_threshold >= 0.f) || !(soft_sigma >= 0.f))
+    {
+        LOG_ERROR("Invalid IoU threshold " << iou_threshold << " or soft-NMS sigma " << soft_sigma
+                                           << ", they must not be negative");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    auto boxAccess      = TensorDataAccessStridedImagePlanar::Create(boxData);
+    auto scoreAccess    = TensorDataAccessStridedImagePlanar::Create(scoreData);
+    auto outIndexAccess = TensorDataAccessStridedImagePlanar::Create(outIndexData);
+    auto outScoreAccess = TensorDataAccessStridedImagePlanar::Create(outScoreData);
+    auto outCountAccess = TensorDataAccessStridedImagePlanar::Create(outCountData);
+    NVCV_ASSERT(boxAccess && scoreAccess && outIndexAccess && outScoreAccess && outCountAccess);
+
+    if (boxAccess->numRows() != 1 || boxAccess->numChannels() != 4 || boxAccess->colStride() != sizeof(float4))
+    {
+        LOG_ERROR("Invalid box shape " << boxData.shape() << ", boxes must be a single row of 4-channel elements");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const int numSamples = boxAccess->numSamples();
+    const int numBoxes   = boxAccess->numCols();
+    const int maxOutput  = outIndexAccess->numCols();
+
+    if (numSamples > m_maxBatchSize || numBoxes > m_maxNumBoxes)
+    {
+        LOG_ERROR("Invalid box shape " << boxData.shape() << ", it exceeds the maximum batch size " << m_maxBatchSize
+                                       << " or number of boxes " << m_maxNumBoxes << " of the operator");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (!isValueRow(*scoreAccess, numSamples, numBoxes))
+    {
+        LOG_ERROR("Invalid score shape " << scoreData.shape() << ", it must have one score per box");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    nvcv::detail::Optional<TensorDataAccessStridedImagePlanar> classAccess;
+    if (classData)
+    {
+        classAccess = TensorDataAccessStridedImagePlanar::Create(*classData);
+        NVCV_ASSERT(classAccess);
+
+        if (!isValueRow(*classAccess, numSamples, numBoxes))
+        {
+            LOG_ERROR("Invalid class shape " << classData->shape() << ", it must have one class per box");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
+    if (!isValueRow(*outIndexAccess, numSamples, maxOutput) || !isValueRow(*outScoreAccess, numSamples, maxOutput)
+        || !isValueRow(*outCountAccess, numSamples, 1))
+    {
+        LOG_ERROR("Invalid output shapes " << outIndexData.shape() << ", " << outScoreData.shape() << " and "
+                                           << outCountData.shape() << ", indices and scores must have one row of "
+                                           << "the same width per sample, and counts a single element per sample");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (numSamples == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    dim3 block(kReduceBlockW, kReduceBlockH);
+
+    nms_kernel<<<numSamples, block, 0, stream>>>(
+        wrapRows<const float4>(*boxAccess), wrapRows<const float>(*scoreAccess),
+        classAccess ? wrapRows<const int>(*classAccess) : nvcv::cuda::Tensor3DWrap<const int>{}, classData != nullptr,
+        gpuWorkspace(stream).as<float>(), numBoxes, wrapRows<int>(*outIndexAccess),
+        wrapRows<float>(*outScoreAccess), wrapRows<int>(*outCountAccess), maxOutput, score_threshold, iou_threshold,
+        soft_sigma);
+    checkKernelErrors();
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
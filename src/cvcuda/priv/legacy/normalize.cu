@@ -21,16 +21,55 @@
 #include "CvCudaLegacy.h"
 #include "CvCudaLegacyHelpers.hpp"
 
+#include "ChannelOrder.cuh"
 #include "CvCudaUtils.cuh"
 
-#include <cvcuda/OpNormalize.h> // for CVCUDA_NORMALIZE_SCALE_IS_STDDEV, etc.
+#include <cvcuda/OpNormalize.h>           // for CVCUDA_NORMALIZE_SCALE_IS_STDDEV, etc.
+#include <nvcv/cuda/VectorizedAccess.hpp> // for TransformRowVector, etc.
+
+#include <algorithm>
+#include <type_traits>
 
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
 
+// There are no compound half types, so half outputs are wrapped per channel, see storeNormalized
+template<typename output_type>
+auto createOutputWrap(const nvcv::ITensorDataStridedCuda &outData)
+{
+    if constexpr (std::is_same_v<output_type, __half>)
+    {
+        return nvcv::cuda::CreateTensorWrapNHWC<__half>(outData);
+    }
+    else
+    {
+        return nvcv::cuda::CreateTensorWrapNHW<output_type>(outData);
+    }
+}
+
+// Stores a pixel normalized in float, channel by channel for half outputs
+template<class DstWrapper, typename T>
+__device__ inline void storeNormalized(const DstWrapper &dst, int batch_idx, int y, int x, T val)
+{
+    using output_value_type = std::remove_const_t<typename DstWrapper::ValueType>;
+
+    if constexpr (std::is_same_v<output_value_type, __half>)
+    {
+#pragma unroll
+        for (int c = 0; c < nvcv::cuda::NumElements<T>; ++c)
+        {
+            *dst.ptr(batch_idx, y, x, c) = nvcv::cuda::SaturateCast<__half>(nvcv::cuda::GetElement(val, c));
+        }
+    }
+    else
+    {
+        *dst.ptr(batch_idx, y, x) = nvcv::cuda::SaturateCast<output_value_type>(val);
+    }
+}
+
 // (float3 - float3) * float3 / (float3 - float) * float3 / (float3 - float3) * float / (float3 - float) * float
-template<typename input_type, typename base_type, typename scale_type>
-__global__ void normalizeKernel(const input_type src, const base_type base, const scale_type scale, input_type dst,
+template<typename input_type, typename base_type, typename scale_type, typename output_type>
+__global__ void normalizeKernel(const input_type src, const base_type base, const scale_type scale, output_type dst,
                                 int2 inout_size, int3 base_size, int3 scale_size, float global_scale,
                                 float global_shift)
 {
@@ -49,18 +88,16 @@ __global__ void normalizeKernel(const input_type src, const base_type base, cons
     const int scale_y         = scale_size.y == 1 ? 0 : src_y;
     const int scale_batch_idx = scale_size.z == 1 ? 0 : batch_idx;
 
-    using input_value_type = typename input_type::ValueType;
-
-    *dst.ptr(batch_idx, src_y, src_x) = nvcv::cuda::SaturateCast<input_value_type>(
-        (*src.ptr(batch_idx, src_y, src_x) - *base.ptr(base_batch_idx, base_y, base_x))
-            * (*scale.ptr(scale_batch_idx, scale_y, scale_x)) * global_scale
-        + global_shift);
+    storeNormalized(dst, batch_idx, src_y, src_x,
+                    (*src.ptr(batch_idx, src_y, src_x) - *base.ptr(base_batch_idx, base_y, base_x))
+                            * (*scale.ptr(scale_batch_idx, scale_y, scale_x)) * global_scale
+                        + global_shift);
 }
 
 // (float3 - float3) * float3 / (float3 - float) * float3 / (float3 - float3) * float / (float3 - float) * float
-template<typename input_type, typename base_type, typename scale_type>
+template<bool Fast, typename input_type, typename base_type, typename scale_type, typename output_type>
 __global__ void normalizeInvStdDevKernel(const input_type src, const base_type base, const scale_type scale,
-                                         input_type dst, int2 inout_size, int3 base_size, int3 scale_size,
+                                         output_type dst, int2 inout_size, int3 base_size, int3 scale_size,
                                          float global_scale, float global_shift, float epsilon)
 {
     const int src_x     = blockIdx.x * blockDim.x + threadIdx.x;
@@ -78,16 +115,359 @@ __global__ void normalizeInvStdDevKernel(const input_type src, const base_type b
     const int scale_y         = scale_size.y == 1 ? 0 : src_y;
     const int scale_batch_idx = scale_size.z == 1 ? 0 : batch_idx;
 
-    using input_value_type = typename input_type::ValueType;
     using scale_value_type = typename scale_type::ValueType;
 
     scale_value_type s   = *scale.ptr(scale_batch_idx, scale_y, scale_x);
     scale_value_type x   = s * s + epsilon;
-    scale_value_type mul = 1.0f / nvcv::cuda::sqrt(x);
+    scale_value_type mul = RsqrtF<Fast>(x);
+
+    storeNormalized(dst, batch_idx, src_y, src_x,
+                    (*src.ptr(batch_idx, src_y, src_x) - *base.ptr(base_batch_idx, base_y, base_x)) * mul * global_scale
+                        + global_shift);
+}
+
+// Vectorized normalization for base and scale broadcast over the image, i.e. one value per sample and channel.
+// Each thread reads its sample parameters once and normalizes N consecutive channel values of a row.
+template<bool Fast, int N, int NC, bool InvStdDev, typename T, typename U>
+__global__ void normalizeVectorKernel(nvcv::cuda::Tensor3DWrap<const T> src, nvcv::cuda::Tensor3DWrap<U> dst,
+                                      nvcv::cuda::Tensor3DWrap<const float> base,
+                                      nvcv::cuda::Tensor3DWrap<const float> scale, int rowLength, int rows,
+                                      int2 base_info, int2 scale_info, float global_scale, float global_shift,
+                                      float epsilon)
+{
+    const int chunk_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    const int src_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    if (src_y >= rows)
+        return;
+
+    // base_info/scale_info hold {numChannels, numSamples} of the parameter tensors.
+    const float *base_ptr  = base.ptr(base_info.y == 1 ? 0 : batch_idx, 0, 0);
+    const float *scale_ptr = scale.ptr(scale_info.y == 1 ? 0 : batch_idx, 0, 0);
+
+    float base_val[NC], mul_val[NC];
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
+    {
+        base_val[c] = base_ptr[base_info.x == 1 ? 0 : c];
+
+        float s = scale_ptr[scale_info.x == 1 ? 0 : c];
+        if constexpr (InvStdDev)
+        {
+            s = RsqrtF<Fast>(s * s + epsilon);
+        }
+        mul_val[c] = s;
+    }
+
+    nvcv::cuda::TransformRowVector<N, NC>(dst.ptr(batch_idx, src_y), src.ptr(batch_idx, src_y), rowLength, chunk_idx,
+                                          [&](T v, int c) {
+                                              return nvcv::cuda::SaturateCast<U>((v - base_val[c]) * mul_val[c]
+                                                                                     * global_scale
+                                                                                 + global_shift);
+                                          });
+}
+
+// Launches the vectorized kernel when it applies, returns false if the generic kernel must be used instead.
+template<typename input_type, bool InvStdDev, typename output_type>
+bool normalizeVector(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &baseData,
+                     const nvcv::ITensorDataStridedCuda &scaleData, const nvcv::ITensorDataStridedCuda &outData,
+                     float global_scale, float shift, float epsilon, cudaStream_t stream)
+{
+    using T          = nvcv::cuda::BaseType<input_type>;
+    using U          = nvcv::cuda::BaseType<output_type>;
+    constexpr int NC = nvcv::cuda::NumElements<input_type>;
+    constexpr int N  = nvcv::cuda::VectorWidth<NC, T, U>;
+
+    auto inAccess    = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
+    auto baseAccess  = nvcv::TensorDataAccessStridedImagePlanar::Create(baseData);
+    auto scaleAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(scaleData);
+    NVCV_ASSERT(inAccess && baseAccess && scaleAccess);
+
+    if (baseAccess->numCols() != 1 || baseAccess->numRows() != 1 || scaleAccess->numCols() != 1
+        || scaleAccess->numRows() != 1)
+    {
+        return false;
+    }
+
+    if (!nvcv::cuda::IsVectorAligned<T, N>(inData, NC) || !nvcv::cuda::IsVectorAligned<U, N>(outData, NC))
+    {
+        return false;
+    }
+
+    const int rowLength = inAccess->numCols() * NC;
+    const int rows      = inAccess->numRows();
+
+    dim3 block(32, 8);
+    dim3 grid(divUp(divUp(rowLength, N), block.x), divUp(rows, block.y), static_cast<int>(inAccess->numSamples()));
+
+    int2 base_info  = {baseAccess->numChannels(), static_cast<int>(baseAccess->numSamples())};
+    int2 scale_info = {scaleAccess->numChannels(), static_cast<int>(scaleAccess->numSamples())};
+
+    auto srcWrap   = nvcv::cuda::CreateTensorWrapNHW<const T>(inData);
+    auto dstWrap   = nvcv::cuda::CreateTensorWrapNHW<U>(outData);
+    auto baseWrap  = nvcv::cuda::CreateTensorWrapNHW<const float>(baseData);
+    auto scaleWrap = nvcv::cuda::CreateTensorWrapNHW<const float>(scaleData);
+
+    DispatchPrecision(
+        [&](auto fast)
+        {
+            normalizeVectorKernel<decltype(fast)::value, N, NC, InvStdDev><<<grid, block, 0, stream>>>(
+                srcWrap, dstWrap, baseWrap, scaleWrap, rowLength, rows, base_info, scale_info, global_scale, shift,
+                epsilon);
+        });
+    checkKernelErrors();
+
+    return true;
+}
+
+// Statistics of CVCUDA_NORMALIZE_COMPUTE_STATS are computed by blocks of kStatsBlockW x kStatsBlockH threads, at
+// most kMaxStatsBlocks in total when several of them reduce the same base/scale sample.
+constexpr int kStatsBlockW    = 32;
+constexpr int kStatsBlockH    = 8;
+constexpr int kMaxStatsBlocks = 1024;
+
+// Writes the mean and standard deviation of a base/scale sample from the sums of the differences to the pivot
+// values, and of their squares, over count values per channel.  Channels are merged when the parameters have one.
+template<int NC>
+__device__ void writeNormalizeStats(const float (&sum)[NC], const float (&sqsum)[NC], const float (&pivot)[NC],
+                                    float count, float *mean, float *stddev, int param_channels)
+{
+    float mu[NC], m2[NC];
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
+    {
+        float d = sum[c] / count;
+        mu[c]   = pivot[c] + d;
+        m2[c]   = fmaxf(sqsum[c] - sum[c] * d, 0.f);
+    }
+
+    if (param_channels == 1)
+    {
+        float total_mu = 0.f;
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            total_mu += mu[c];
+        }
+        total_mu /= NC;
+
+        float total_m2 = 0.f;
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            float d = mu[c] - total_mu;
+            total_m2 += m2[c] + count * d * d;
+        }
+        mean[0]   = total_mu;
+        stddev[0] = nvcv::cuda::sqrt(total_m2 / (count * NC));
+    }
+    else
+    {
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            mean[c]   = mu[c];
+            stddev[c] = nvcv::cuda::sqrt(m2[c] / count);
+        }
+    }
+}
 
-    *dst.ptr(batch_idx, src_y, src_x) = nvcv::cuda::SaturateCast<input_value_type>(
-        (*src.ptr(batch_idx, src_y, src_x) - *base.ptr(base_batch_idx, base_y, base_x)) * mul * global_scale
-        + global_shift);
+template<typename input_type, class SrcWrapper, int NC = nvcv::cuda::NumElements<input_type>>
+__device__ void loadStatsPivot(const SrcWrapper &src, int sample, float (&pivot)[NC])
+{
+    const input_type p = *src.ptr(sample, 0, 0);
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
+    {
+        pivot[c] = nvcv::cuda::GetElement(p, c);
+    }
+}
+
+// First phase of the statistics: blockIdx.y is the base/scale sample, whose rows are split among gridDim.x blocks.
+// Values are accumulated relative to the first pixel of the sample, to limit cancellation in the variance, and
+// reduced with warp shuffles and then across warps.  A single block writes the statistics directly, otherwise
+// each block writes its sums to partials for normalizeStatsFinalKernel.
+template<typename input_type, class SrcWrapper>
+__global__ void normalizeStatsKernel(SrcWrapper src, nvcv::cuda::Tensor3DWrap<float> base,
+                                     nvcv::cuda::Tensor3DWrap<float> scale, float *partials, int2 size,
+                                     int samples_per_param, int param_channels)
+{
+    constexpr int NC        = nvcv::cuda::NumElements<input_type>;
+    constexpr int kNumWarps = kStatsBlockW * kStatsBlockH / 32;
+
+    const int param_idx    = blockIdx.y;
+    const int first_sample = param_idx * samples_per_param;
+    const int num_rows     = samples_per_param * size.y;
+
+    float pivot[NC], sum[NC], sqsum[NC];
+    loadStatsPivot<input_type>(src, first_sample, pivot);
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
+    {
+        sum[c] = sqsum[c] = 0.f;
+    }
+
+    for (int row = blockIdx.x * kStatsBlockH + threadIdx.y; row < num_rows; row += gridDim.x * kStatsBlockH)
+    {
+        const int sample = first_sample + row / size.y;
+        const int y      = row % size.y;
+        for (int x = threadIdx.x; x < size.x; x += kStatsBlockW)
+        {
+            const input_type v = *src.ptr(sample, y, x);
+#pragma unroll
+            for (int c = 0; c < NC; ++c)
+            {
+                float d = nvcv::cuda::GetElement(v, c) - pivot[c];
+                sum[c] += d;
+                sqsum[c] += d * d;
+            }
+        }
+    }
+
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
+    {
+#pragma unroll
+        for (int offset = 16; offset > 0; offset /= 2)
+        {
+            sum[c] += __shfl_down_sync(0xFFFFFFFF, sum[c], offset);
+            sqsum[c] += __shfl_down_sync(0xFFFFFFFF, sqsum[c], offset);
+        }
+    }
+
+    __shared__ float warp_sums[kNumWarps][2 * NC];
+
+    const int lid = get_lid();
+    if (lid % 32 == 0)
+    {
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            warp_sums[lid / 32][c]      = sum[c];
+            warp_sums[lid / 32][NC + c] = sqsum[c];
+        }
+    }
+    __syncthreads();
+
+    if (lid != 0)
+        return;
+
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
+    {
+        sum[c] = sqsum[c] = 0.f;
+        for (int w = 0; w < kNumWarps; ++w)
+        {
+            sum[c] += warp_sums[w][c];
+            sqsum[c] += warp_sums[w][NC + c];
+        }
+    }
+
+    if (gridDim.x == 1)
+    {
+        writeNormalizeStats(sum, sqsum, pivot, static_cast<float>(num_rows) * size.x, base.ptr(param_idx, 0, 0),
+                            scale.ptr(param_idx, 0, 0), param_channels);
+    }
+    else
+    {
+        float *block_partials = partials + (param_idx * gridDim.x + blockIdx.x) * 2 * NC;
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            block_partials[c]      = sum[c];
+            block_partials[NC + c] = sqsum[c];
+        }
+    }
+}
+
+// Second phase of the statistics: one warp per base/scale sample reduces the sums of its blocks.
+template<typename input_type, class SrcWrapper>
+__global__ void normalizeStatsFinalKernel(SrcWrapper src, nvcv::cuda::Tensor3DWrap<float> base,
+                                          nvcv::cuda::Tensor3DWrap<float> scale, const float *partials,
+                                          int num_blocks, int2 size, int samples_per_param, int param_channels)
+{
+    constexpr int NC = nvcv::cuda::NumElements<input_type>;
+
+    const int param_idx = blockIdx.x;
+    const int lane      = threadIdx.x;
+
+    float sum[NC], sqsum[NC];
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
+    {
+        sum[c] = sqsum[c] = 0.f;
+    }
+
+    for (int b = lane; b < num_blocks; b += 32)
+    {
+        const float *block_partials = partials + (param_idx * num_blocks + b) * 2 * NC;
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            sum[c] += block_partials[c];
+            sqsum[c] += block_partials[NC + c];
+        }
+    }
+
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
+    {
+#pragma unroll
+        for (int offset = 16; offset > 0; offset /= 2)
+        {
+            sum[c] += __shfl_down_sync(0xFFFFFFFF, sum[c], offset);
+            sqsum[c] += __shfl_down_sync(0xFFFFFFFF, sqsum[c], offset);
+        }
+    }
+
+    if (lane == 0)
+    {
+        float pivot[NC];
+        loadStatsPivot<input_type>(src, param_idx * samples_per_param, pivot);
+        writeNormalizeStats(sum, sqsum, pivot, static_cast<float>(samples_per_param) * size.y * size.x,
+                            base.ptr(param_idx, 0, 0), scale.ptr(param_idx, 0, 0), param_channels);
+    }
+}
+
+// Computes the mean and standard deviation of the input into base and scale, in output channel order.
+template<typename input_type>
+void normalizeStats(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &baseData,
+                    const nvcv::ITensorDataStridedCuda &scaleData, const ChannelOrder &order, float *workspace,
+                    cudaStream_t stream)
+{
+    auto inAccess   = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
+    auto baseAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(baseData);
+    NVCV_ASSERT(inAccess && baseAccess);
+
+    const int num_params        = static_cast<int>(baseAccess->numSamples());
+    const int samples_per_param = num_params == 1 ? static_cast<int>(inAccess->numSamples()) : 1;
+    const int param_channels    = baseAccess->numChannels();
+
+    int2 size = {static_cast<int>(inAccess->numCols()), static_cast<int>(inAccess->numRows())};
+
+    // Split the rows of each sample among blocks as long as the partial sums fit in the workspace
+    const int num_blocks
+        = std::min(divUp(samples_per_param * size.y, kStatsBlockH), std::max(1, kMaxStatsBlocks / num_params));
+
+    ChannelOrderWrap srcWrap(nvcv::cuda::CreateTensorWrapNHW<const input_type>(inData), order);
+
+    auto baseWrap  = nvcv::cuda::CreateTensorWrapNHW<float>(baseData);
+    auto scaleWrap = nvcv::cuda::CreateTensorWrapNHW<float>(scaleData);
+
+    dim3 block(kStatsBlockW, kStatsBlockH);
+    dim3 grid(num_blocks, num_params);
+
+    normalizeStatsKernel<input_type><<<grid, block, 0, stream>>>(srcWrap, baseWrap, scaleWrap, workspace, size,
+                                                                 samples_per_param, param_channels);
+    checkKernelErrors();
+
+    if (num_blocks > 1)
+    {
+        normalizeStatsFinalKernel<input_type><<<num_params, 32, 0, stream>>>(
+            srcWrap, baseWrap, scaleWrap, workspace, num_blocks, size, samples_per_param, param_channels);
+        checkKernelErrors();
+    }
 }
 
 template<typename base_type, typename scale_type, typename WrapInput, typename WrapOutput>
@@ -141,18 +521,31 @@ void normalizeInvStdDevWrap(WrapInput srcWrap, WrapOutput dstWrap, DataShape inp
     int3 scale_size = {static_cast<int>(scaleAccess->numCols()), static_cast<int>(scaleAccess->numRows()),
                        static_cast<int>(scaleAccess->numSamples())};
 
-    normalizeInvStdDevKernel<<<grid, block, 0, stream>>>(srcWrap, baseWrap, scaleWrap, dstWrap, inout_size, base_size,
-                                                         scale_size, global_scale, shift, epsilon);
+    DispatchPrecision(
+        [&](auto fast)
+        {
+            normalizeInvStdDevKernel<decltype(fast)::value><<<grid, block, 0, stream>>>(
+                srcWrap, baseWrap, scaleWrap, dstWrap, inout_size, base_size, scale_size, global_scale, shift, epsilon);
+        });
     checkKernelErrors();
 }
 
-template<typename input_type>
+// The output type differs from the input type for quantized and half outputs, see Normalize::infer.  Channels are
+// reordered as pixels are loaded, the vectorized kernel only applies when they're kept as they are.
+template<typename input_type, typename output_type = input_type>
 void normalize(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &baseData,
                const nvcv::ITensorDataStridedCuda &scaleData, const nvcv::ITensorDataStridedCuda &outData,
-               float global_scale, float shift, cudaStream_t stream)
+               float global_scale, float shift, const ChannelOrder &order, cudaStream_t stream)
 {
-    auto srcWrap = nvcv::cuda::CreateTensorWrapNHW<input_type>(inData);
-    auto dstWrap = nvcv::cuda::CreateTensorWrapNHW<input_type>(outData);
+    if (order.isIdentity()
+        && normalizeVector<input_type, false, output_type>(inData, baseData, scaleData, outData, global_scale, shift,
+                                                           0.f, stream))
+    {
+        return;
+    }
+
+    ChannelOrderWrap srcWrap(nvcv::cuda::CreateTensorWrapNHW<const input_type>(inData), order);
+    auto dstWrap = createOutputWrap<output_type>(outData);
 
     auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
     NVCV_ASSERT(inAccess);
@@ -197,13 +590,21 @@ void normalize(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDa
     }
 }
 
-template<typename input_type>
+template<typename input_type, typename output_type = input_type>
 void normalizeInvStdDev(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &baseData,
                         const nvcv::ITensorDataStridedCuda &scaleData, const nvcv::ITensorDataStridedCuda &outData,
-                        float global_scale, float shift, float epsilon, cudaStream_t stream)
+                        float global_scale, float shift, float epsilon, const ChannelOrder &order,
+                        cudaStream_t stream)
 {
-    auto srcWrap = nvcv::cuda::CreateTensorWrapNHW<input_type>(inData);
-    auto dstWrap = nvcv::cuda::CreateTensorWrapNHW<input_type>(outData);
+    if (order.isIdentity()
+        && normalizeVector<input_type, true, output_type>(inData, baseData, scaleData, outData, global_scale, shift,
+                                                          epsilon, stream))
+    {
+        return;
+    }
+
+    ChannelOrderWrap srcWrap(nvcv::cuda::CreateTensorWrapNHW<const input_type>(inData), order);
+    auto dstWrap = createOutputWrap<output_type>(outData);
 
     auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
     NVCV_ASSERT(inAccess);
@@ -260,13 +661,14 @@ void Normalize::checkParamShape(DataShape input_shape, DataShape param_shape)
 
 size_t Normalize::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
 {
-    return 0;
+    // Partial sums of the statistics, two per channel and block
+    return kMaxStatsBlocks * 2 * 4 * sizeof(float);
 }
 
 ErrorCode Normalize::infer(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &baseData,
                            const nvcv::ITensorDataStridedCuda &scaleData, const nvcv::ITensorDataStridedCuda &outData,
                            const float global_scale, const float shift, const float epsilon, const uint32_t flags,
-                           cudaStream_t stream)
+                           const ChannelOrder &order, cudaStream_t stream)
 {
     DataFormat format = GetLegacyDataFormat(inData.layout());
 
@@ -324,16 +726,46 @@ ErrorCode Normalize::infer(const nvcv::ITensorDataStridedCuda &inData, const nvc
         return ErrorCode::INVALID_DATA_TYPE;
     }
 
+    // An output of another type is quantized, normalized values are rounded and saturated to 8 bits, or stored in
+    // half precision.  Either way they're computed in float.
+    DataType   out_data_type = GetLegacyDataType(outData.dtype());
+    const bool quantized     = out_data_type != data_type;
+
+    if (quantized
+        && !((data_type == kCV_8U || data_type == kCV_32F)
+             && (out_data_type == kCV_8U || out_data_type == kCV_8S || out_data_type == kCV_16F)))
+    {
+        LOG_ERROR("Invalid output DataType " << out_data_type << ", it must be the input DataType " << data_type
+                                             << ", or 8-bit or half for 8-bit unsigned and float inputs");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
     checkParamShape(input_shape, base_param_shape);
     checkParamShape(input_shape, scale_param_shape);
 
+    if (flags & CVCUDA_NORMALIZE_COMPUTE_STATS)
+    {
+        if (GetLegacyDataType(baseData.dtype()) != kCV_32F || GetLegacyDataType(scaleData.dtype()) != kCV_32F)
+        {
+            LOG_ERROR("Base and scale must be float to hold the computed statistics");
+            return ErrorCode::INVALID_DATA_TYPE;
+        }
+        if (base_param_shape != scale_param_shape || base_param_shape.H != 1 || base_param_shape.W != 1)
+        {
+            LOG_ERROR("Invalid base shape " << base_param_shape << " and scale shape " << scale_param_shape
+                                            << ", statistics are computed per sample and channel");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
     typedef void (*normalize_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &baseData,
                                 const ITensorDataStridedCuda &scaleData, const ITensorDataStridedCuda &outData,
-                                float global_scale, float shift, cudaStream_t stream);
+                                float global_scale, float shift, const ChannelOrder &order, cudaStream_t stream);
 
     typedef void (*normalizeInvStdDev_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &baseData,
                                          const ITensorDataStridedCuda &scaleData, const ITensorDataStridedCuda &outData,
-                                         float global_scale, float shift, float epsilon, cudaStream_t stream);
+                                         float global_scale, float shift, float epsilon, const ChannelOrder &order,
+                                         cudaStream_t stream);
 
     static const normalize_t funcs_normalize[6][4] = {
         { normalize<uchar>,  0 /*normalize<uchar2>*/,  normalize<uchar3>,  normalize<uchar4>},
@@ -358,14 +790,60 @@ ErrorCode Normalize::infer(const nvcv::ITensorDataStridedCuda &inData, const nvc
          normalizeInvStdDev<float4>                                                                                          }
     };
 
-    if (flags & CVCUDA_NORMALIZE_SCALE_IS_STDDEV)
+    typedef void (*normalizeStats_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &baseData,
+                                     const ITensorDataStridedCuda &scaleData, const ChannelOrder &order,
+                                     float *workspace, cudaStream_t stream);
+
+    static const normalizeStats_t funcs_normalize_stats[6][4] = {
+        { normalizeStats<uchar>,  0 /*normalizeStats<uchar2>*/,  normalizeStats<uchar3>,  normalizeStats<uchar4>},
+        { normalizeStats<schar>,   0 /*normalizeStats<char2>*/,   normalizeStats<char3>,   normalizeStats<char4>},
+        {normalizeStats<ushort>, 0 /*normalizeStats<ushort2>*/, normalizeStats<ushort3>, normalizeStats<ushort4>},
+        { normalizeStats<short>,  0 /*normalizeStats<short2>*/,  normalizeStats<short3>,  normalizeStats<short4>},
+        {   normalizeStats<int>,    0 /*normalizeStats<int2>*/,    normalizeStats<int3>,    normalizeStats<int4>},
+        { normalizeStats<float>,  0 /*normalizeStats<float2>*/,  normalizeStats<float3>,  normalizeStats<float4>}
+    };
+
+    if (flags & CVCUDA_NORMALIZE_COMPUTE_STATS)
+    {
+        funcs_normalize_stats[data_type][channels - 1](inData, baseData, scaleData, order,
+                                                       gpuWorkspace(stream).as<float>(), stream);
+    }
+
+    // Quantized and half outputs, indexed by input type (8U or 32F) and output type (8U, 8S or 16F)
+    static const normalize_t funcs_normalize_quant[2][3][4] = {
+        {{normalize<uchar, uchar>, 0, normalize<uchar3, uchar3>, normalize<uchar4, uchar4>},
+         {normalize<uchar, schar>, 0, normalize<uchar3, char3>, normalize<uchar4, char4>},
+         {normalize<uchar, __half>, 0, normalize<uchar3, __half>, normalize<uchar4, __half>}},
+        {{normalize<float, uchar>, 0, normalize<float3, uchar3>, normalize<float4, uchar4>},
+         {normalize<float, schar>, 0, normalize<float3, char3>, normalize<float4, char4>},
+         {normalize<float, __half>, 0, normalize<float3, __half>, normalize<float4, __half>}}
+    };
+
+    static const normalizeInvStdDev_t funcs_normalize_stddev_quant[2][3][4] = {
+        {{normalizeInvStdDev<uchar, uchar>, 0, normalizeInvStdDev<uchar3, uchar3>, normalizeInvStdDev<uchar4, uchar4>},
+         {normalizeInvStdDev<uchar, schar>, 0, normalizeInvStdDev<uchar3, char3>, normalizeInvStdDev<uchar4, char4>},
+         {normalizeInvStdDev<uchar, __half>, 0, normalizeInvStdDev<uchar3, __half>,
+          normalizeInvStdDev<uchar4, __half>}},
+        {{normalizeInvStdDev<float, uchar>, 0, normalizeInvStdDev<float3, uchar3>, normalizeInvStdDev<float4, uchar4>},
+         {normalizeInvStdDev<float, schar>, 0, normalizeInvStdDev<float3, char3>, normalizeInvStdDev<float4, char4>},
+         {normalizeInvStdDev<float, __half>, 0, normalizeInvStdDev<float3, __half>,
+          normalizeInvStdDev<float4, __half>}}
+    };
+
+    const int quant_in  = data_type == kCV_32F ? 1 : 0;
+    const int quant_out = out_data_type == kCV_8S ? 1 : (out_data_type == kCV_16F ? 2 : 0);
+
+    if (flags & (CVCUDA_NORMALIZE_SCALE_IS_STDDEV | CVCUDA_NORMALIZE_COMPUTE_STATS))
     {
-        funcs_normalize_stddev[data_type][channels - 1](inData, baseData, scaleData, outData, global_scale, shift,
-                                                        epsilon, stream);
+        const normalizeInvStdDev_t func = quantized ? funcs_normalize_stddev_quant[quant_in][quant_out][channels - 1]
+                                                    : funcs_normalize_stddev[data_type][channels - 1];
+        func(inData, baseData, scaleData, outData, global_scale, shift, epsilon, order, stream);
     }
     else
     {
-        funcs_normalize[data_type][channels - 1](inData, baseData, scaleData, outData, global_scale, shift, stream);
+        const normalize_t func = quantized ? funcs_normalize_quant[quant_in][quant_out][channels - 1]
+                                           : funcs_normalize[data_type][channels - 1];
+        func(inData, baseData, scaleData, outData, global_scale, shift, order, stream);
     }
 
     return SUCCESS;
@@ -21,7 +21,9 @@
 #include "CvCudaLegacy.h"
 #include "CvCudaLegacyHelpers.hpp"
 
+#include "ChannelOrder.cuh"
 #include "CvCudaUtils.cuh"
+#include "TinyImages.cuh"
 
 #include <cvcuda/OpNormalize.h> // for CVCUDA_NORMALIZE_SCALE_IS_STDDEV, etc.
 #include <nvcv/cuda/MathWrappers.hpp>
@@ -34,79 +36,108 @@ namespace {
 
 // (float3 - float3) * float3 / (float3 - float) * float3 / (float3 - float3) * float / (float3 - float) * float
 template<typename T, typename out_T, typename base_type, typename scale_type>
-__global__ void normKernel(const cuda::ImageBatchVarShapeWrap<const T> src, cuda::ImageBatchVarShapeWrap<out_T> dst,
-                           const scale_type *scale, const base_type *base, float global_scale, float global_shift)
+struct NormPixelOp
 {
-    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
-    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
-    if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
-        return;
-
-    T out                             = *src.ptr(batch_idx, dst_y, dst_x);
-    *dst.ptr(batch_idx, dst_y, dst_x) = cuda::SaturateCast<out_T>((out - *base) * *scale * global_scale + global_shift);
-}
+    cuda::ImageBatchVarShapeWrap<const T> src;
+    cuda::ImageBatchVarShapeWrap<out_T>   dst;
+    const scale_type                     *scale;
+    const base_type                      *base;
+    float                                 global_scale, global_shift;
+    ChannelOrder                          order;
+
+    __device__ void operator()(int batch_idx, int dst_x, int dst_y) const
+    {
+        if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
+            return;
+
+        T out                             = Reorder(*src.ptr(batch_idx, dst_y, dst_x), order);
+        *dst.ptr(batch_idx, dst_y, dst_x) = cuda::SaturateCast<out_T>((out - *base) * *scale * global_scale
+                                                                      + global_shift);
+    }
+};
 
 // (float3 - float3) * float3 / (float3 - float) * float3 / (float3 - float3) * float / (float3 - float) * float
 template<typename T, typename out_T, typename base_type, typename scale_type>
-__global__ void normInvStdDevKernel(const cuda::ImageBatchVarShapeWrap<const T> src,
-                                    cuda::ImageBatchVarShapeWrap<out_T> dst, const scale_type *scale,
-                                    const base_type *base, float global_scale, float global_shift, float epsilon)
+struct NormInvStdDevPixelOp
 {
-    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
-    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
-    if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
-        return;
-
-    scale_type s   = *scale;
-    scale_type x   = s * s + epsilon;
-    scale_type mul = 1.0f / cuda::sqrt(x);
-
-    T out                             = *src.ptr(batch_idx, dst_y, dst_x);
-    *dst.ptr(batch_idx, dst_y, dst_x) = cuda::SaturateCast<out_T>((out - *base) * mul * global_scale + global_shift);
+    cuda::ImageBatchVarShapeWrap<const T> src;
+    cuda::ImageBatchVarShapeWrap<out_T>   dst;
+    const scale_type                     *scale;
+    const base_type                      *base;
+    float                                 global_scale, global_shift, epsilon;
+    ChannelOrder                          order;
+
+    __device__ void operator()(int batch_idx, int dst_x, int dst_y) const
+    {
+        if (dst_x >= dst.width(batch_idx) || dst_y >= dst.height(batch_idx))
+            return;
+
+        scale_type s   = *scale;
+        scale_type x   = s * s + epsilon;
+        scale_type mul = 1.0f / cuda::sqrt(x);
+
+        T out                             = Reorder(*src.ptr(batch_idx, dst_y, dst_x), order);
+        *dst.ptr(batch_idx, dst_y, dst_x) = cuda::SaturateCast<out_T>((out - *base) * mul * global_scale
+                                                                      + global_shift);
+    }
+};
+
+template<class PixelOp>
+__global__ void normKernel(const PixelOp op)
+{
+    op(get_batch_idx(), blockIdx.x * blockDim.x + threadIdx.x, blockIdx.y * blockDim.y + threadIdx.y);
 }
 
-template<typename T, typename out_T, typename base_type, typename scale_type>
-void normWrap(const IImageBatchVarShapeDataStridedCuda &in, const base_type *base, const scale_type *scale,
-              const IImageBatchVarShapeDataStridedCuda &out, float global_scale, float shift, cudaStream_t stream)
+// Batches of tiny images get a warp per image, the others a 2D grid sized for the largest image
+template<class PixelOp>
+void launchNorm(const PixelOp &op, const IImageBatchVarShapeDataStridedCuda &in, cudaStream_t stream)
 {
     int max_width  = in.maxSize().w;
     int max_height = in.maxSize().h;
     int batch      = in.numImages();
 
-    dim3                                  block(BLOCK, BLOCK / 4, 1);
-    dim3                                  grid(divUp(max_width, block.x), divUp(max_height, block.y), batch);
+    if (IsTinyBatch(batch, in.maxSize()))
+    {
+        LaunchTinyImages(op, op.dst, batch, in.maxSize(), stream);
+    }
+    else
+    {
+        dim3 block(BLOCK, BLOCK / 4, 1);
+        dim3 grid(divUp(max_width, block.x), divUp(max_height, block.y), batch);
+        normKernel<<<grid, block, 0, stream>>>(op);
+    }
+    checkKernelErrors();
+}
+
+template<typename T, typename out_T, typename base_type, typename scale_type>
+void normWrap(const IImageBatchVarShapeDataStridedCuda &in, const base_type *base, const scale_type *scale,
+              const IImageBatchVarShapeDataStridedCuda &out, float global_scale, float shift, const ChannelOrder &order,
+              cudaStream_t stream)
+{
     cuda::ImageBatchVarShapeWrap<const T> src_ptr(in);
     cuda::ImageBatchVarShapeWrap<out_T>   dst_ptr(out);
 
-    normKernel<T, out_T><<<grid, block, 0, stream>>>(src_ptr, dst_ptr, scale, base, global_scale, shift);
-    checkKernelErrors();
+    launchNorm(NormPixelOp<T, out_T, base_type, scale_type>{src_ptr, dst_ptr, scale, base, global_scale, shift, order},
+               in, stream);
 }
 
 template<typename T, typename out_T, typename base_type, typename scale_type>
 void normInvStdDevWrap(const IImageBatchVarShapeDataStridedCuda &in, const base_type *base, const scale_type *scale,
                        const IImageBatchVarShapeDataStridedCuda &out, float global_scale, float shift, float epsilon,
-                       cudaStream_t stream)
+                       const ChannelOrder &order, cudaStream_t stream)
 {
-    int max_width  = in.maxSize().w;
-    int max_height = in.maxSize().h;
-    int batch      = in.numImages();
-
-    dim3 block(BLOCK, BLOCK / 4, 1);
-    dim3 grid(divUp(max_width, block.x), divUp(max_height, block.y), batch);
-
     cuda::ImageBatchVarShapeWrap<const T> src_ptr(in);
     cuda::ImageBatchVarShapeWrap<out_T>   dst_ptr(out);
-    normInvStdDevKernel<T, out_T>
-        <<<grid, block, 0, stream>>>(src_ptr, dst_ptr, scale, base, global_scale, shift, epsilon);
-    checkKernelErrors();
+
+    launchNorm(NormInvStdDevPixelOp<T, out_T, base_type, scale_type>{src_ptr, dst_ptr, scale, base, global_scale, shift,
+                                                                     epsilon, order},
+               in, stream);
 }
 
 template<typename T, typename out_T>
 void norm(const IImageBatchVarShapeDataStridedCuda &in, const TensorDataAccessStridedImagePlanar &base,
           const TensorDataAccessStridedImagePlanar &scale, const IImageBatchVarShapeDataStridedCuda &out,
-          float global_scale, float shift, cudaStream_t stream)
+          float global_scale, float shift, const ChannelOrder &order, cudaStream_t stream)
 {
     using work_type = cuda::ConvertBaseTypeTo<float, T>;
     if (base.numChannels() != 1 && scale.numChannels() != 1)
@@ -114,35 +145,39 @@ void norm(const IImageBatchVarShapeDataStridedCuda &in, const TensorDataAccessSt
         using base_type  = work_type;
         using scale_type = work_type;
         normWrap<T, out_T>(in, reinterpret_cast<const base_type *>(base.sampleData(0)),
-                           reinterpret_cast<const scale_type *>(scale.sampleData(0)), out, global_scale, shift, stream);
+                           reinterpret_cast<const scale_type *>(scale.sampleData(0)), out, global_scale, shift,
+                           order, stream);
     }
     else if (base.numChannels() != 1)
     {
         using base_type  = work_type;
         using scale_type = float;
         normWrap<T, out_T>(in, reinterpret_cast<const base_type *>(base.sampleData(0)),
-                           reinterpret_cast<const scale_type *>(scale.sampleData(0)), out, global_scale, shift, stream);
+                           reinterpret_cast<const scale_type *>(scale.sampleData(0)), out, global_scale, shift,
+                           order, stream);
     }
     else if (scale.numChannels() != 1)
     {
         using base_type  = float;
         using scale_type = work_type;
         normWrap<T, out_T>(in, reinterpret_cast<const base_type *>(base.sampleData(0)),
-                           reinterpret_cast<const scale_type *>(scale.sampleData(0)), out, global_scale, shift, stream);
+                           reinterpret_cast<const scale_type *>(scale.sampleData(0)), out, global_scale, shift,
+                           order, stream);
     }
     else
     {
         using base_type  = float;
         using scale_type = float;
         normWrap<T, out_T>(in, reinterpret_cast<const base_type *>(base.sampleData(0)),
-                           reinterpret_cast<const scale_type *>(scale.sampleData(0)), out, global_scale, shift, stream);
+                           reinterpret_cast<const scale_type *>(scale.sampleData(0)), out, global_scale, shift,
+                           order, stream);
     }
 }
 
 template<typename T, typename out_T>
 void normInvStdDev(const IImageBatchVarShapeDataStridedCuda &in, const TensorDataAccessStridedImagePlanar &base,
                    const TensorDataAccessStridedImagePlanar &scale, const IImageBatchVarShapeDataStridedCuda &out,
-                   float global_scale, float shift, float epsilon, cudaStream_t stream)
+                   float global_scale, float shift, float epsilon, const ChannelOrder &order, cudaStream_t stream)
 {
     using work_type = cuda::ConvertBaseTypeTo<float, T>;
     if (base.numChannels() != 1 && scale.numChannels() != 1)
@@ -151,7 +186,7 @@ void normInvStdDev(const IImageBatchVarShapeDataStridedCuda &in, const TensorDat
         using scale_type = work_type;
         normInvStdDevWrap<T, out_T>(in, reinterpret_cast<const base_type *>(base.sampleData(0)),
                                     reinterpret_cast<const scale_type *>(scale.sampleData(0)), out, global_scale, shift,
-                                    epsilon, stream);
+                                    epsilon, order, stream);
     }
     else if (base.numChannels() != 1)
     {
@@ -159,7 +194,7 @@ void normInvStdDev(const IImageBatchVarShapeDataStridedCuda &in, const TensorDat
         using scale_type = float;
         normInvStdDevWrap<T, out_T>(in, reinterpret_cast<const base_type *>(base.sampleData(0)),
                                     reinterpret_cast<const scale_type *>(scale.sampleData(0)), out, global_scale, shift,
-                                    epsilon, stream);
+                                    epsilon, order, stream);
     }
     else if (scale.numChannels() != 1)
     {
@@ -167,7 +202,7 @@ void normInvStdDev(const IImageBatchVarShapeDataStridedCuda &in, const TensorDat
         using scale_type = work_type;
         normInvStdDevWrap<T, out_T>(in, reinterpret_cast<const base_type *>(base.sampleData(0)),
                                     reinterpret_cast<const scale_type *>(scale.sampleData(0)), out, global_scale, shift,
-                                    epsilon, stream);
+                                    epsilon, order, stream);
     }
     else
     {
@@ -175,7 +210,7 @@ void normInvStdDev(const IImageBatchVarShapeDataStridedCuda &in, const TensorDat
         using scale_type = float;
         normInvStdDevWrap<T, out_T>(in, reinterpret_cast<const base_type *>(base.sampleData(0)),
                                     reinterpret_cast<const scale_type *>(scale.sampleData(0)), out, global_scale, shift,
-                                    epsilon, stream);
+                                    epsilon, order, stream);
     }
 }
 
@@ -185,8 +220,15 @@ ErrorCode NormalizeVarShape::infer(const nvcv::IImageBatchVarShapeDataStridedCud
                                    const nvcv::ITensorDataStridedCuda             &baseData,
                                    const nvcv::ITensorDataStridedCuda             &scaleData,
                                    const nvcv::IImageBatchVarShapeDataStridedCuda &outData, const float global_scale,
-                                   const float shift, const float epsilon, const uint32_t flags, cudaStream_t stream)
+                                   const float shift, const float epsilon, const uint32_t flags,
+                                   const ChannelOrder &order, cudaStream_t stream)
 {
+    if (flags & CVCUDA_NORMALIZE_COMPUTE_STATS)
+    {
+        LOG_ERROR("Computing the statistics isn't supported for varshape image batches");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
     DataFormat input_format  = helpers::GetLegacyDataFormat(inData);
     DataFormat output_format = helpers::GetLegacyDataFormat(outData);
     if (input_format != output_format)
@@ -256,12 +298,12 @@ ErrorCode NormalizeVarShape::infer(const nvcv::IImageBatchVarShapeDataStridedCud
     typedef void (*normalize_t)(
         const IImageBatchVarShapeDataStridedCuda &in, const TensorDataAccessStridedImagePlanar &base,
         const TensorDataAccessStridedImagePlanar &scale, const IImageBatchVarShapeDataStridedCuda &out,
-        float global_scale, float shift, cudaStream_t stream);
+        float global_scale, float shift, const ChannelOrder &order, cudaStream_t stream);
 
     typedef void (*normalizeInvStdDev_t)(
         const IImageBatchVarShapeDataStridedCuda &in, const TensorDataAccessStridedImagePlanar &base,
         const TensorDataAccessStridedImagePlanar &scale, const IImageBatchVarShapeDataStridedCuda &out,
-        float global_scale, float shift, float epsilon, cudaStream_t stream);
+        float global_scale, float shift, float epsilon, const ChannelOrder &order, cudaStream_t stream);
 
     int out_type_code = out_data_type == kCV_8U ? 0 : 1;
 
@@ -310,12 +352,12 @@ normInvStdDev<ushort4, uchar4>},
     if (flags & CVCUDA_NORMALIZE_SCALE_IS_STDDEV)
     {
         funcs_normalize_stddev[data_type][out_type_code][channels - 1](inData, *baseAccess, *scaleAccess, outData,
-                                                                       global_scale, shift, epsilon, stream);
+                                                                       global_scale, shift, epsilon, order, stream);
     }
     else
     {
         funcs_normalize[data_type][out_type_code][channels - 1](inData, *baseAccess, *scaleAccess, outData,
-                                                                global_scale, shift, stream);
+                                                                global_scale, shift, order, stream);
     }
 
     return ErrorCode::SUCCESS;
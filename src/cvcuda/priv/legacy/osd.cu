@@ -0,0 +1,560 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CompositeUtils.cuh"
+#include "CvCudaUtils.cuh"
+
+#include <nvcv/cuda/MathWrappers.hpp>
+
+#include <algorithm>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Each element is the NVCVOSDElementType, the RGBA color and up to 7 parameters of the primitive.
+constexpr int kElementSize = 12;
+constexpr int kNumParams   = kElementSize - 5;
+
+// Each block draws a tile of the image, one pixel per thread, with the elements overlapping it.
+constexpr int kTileW       = 32;
+constexpr int kTileH       = 8;
+constexpr int kTileThreads = kTileW * kTileH;
+
+struct Element
+{
+    int    type;
+    uchar4 color;
+    float  p[kNumParams];
+};
+
+// Elements, polygon points and glyph atlas of the batch, and the size of the images.
+struct Scene
+{
+    nvcv::cuda::Tensor3DWrap<const float>  elements;
+    nvcv::cuda::Tensor3DWrap<const int>    counts;
+    nvcv::cuda::Tensor3DWrap<const float2> points;
+    nvcv::cuda::Tensor3DWrap<const uchar>  glyphs;
+
+    bool hasCounts;
+    int  numElements, numPoints, numGlyphs;
+    int2 glyphSize;
+    int2 size;
+};
+
+__device__ int NumElements(const Scene &scene, int sample)
+{
+    return scene.hasCounts ? nvcv::cuda::min(*scene.counts.ptr(sample, 0, 0), scene.numElements) : scene.numElements;
+}
+
+__device__ Element LoadElement(const Scene &scene, int sample, int i)
+{
+    const float *e = scene.elements.ptr(sample, 0, i * kElementSize);
+
+    Element element;
+    element.type = static_cast<int>(e[0]);
+
+    uchar c[4];
+#pragma unroll
+    for (int k = 0; k < 4; ++k)
+    {
+        c[k] = nvcv::cuda::SaturateCast<uchar>(e[1 + k]);
+    }
+    element.color = make_uchar4(c[0], c[1], c[2], c[3]);
+
+#pragma unroll
+    for (int k = 0; k < kNumParams; ++k)
+    {
+        element.p[k] = e[5 + k];
+    }
+    return element;
+}
+
+// Line thickness, thinner lines would miss pixels.
+__device__ float LineThickness(const Element &e)
+{
+    return fmaxf(e.p[4], 1.f);
+}
+
+// Pixels [lo, hi) whose center may be covered by the box [x1, y1, x2, y2], clipped to the image.
+__device__ int4 ClipBounds(float4 box, int2 size)
+{
+    if (!(box.z > box.x && box.w > box.y))
+    {
+        return int4{0, 0, 0, 0};
+    }
+
+    const float2 s{static_cast<float>(size.x), static_cast<float>(size.y)};
+
+    return int4{static_cast<int>(fminf(fmaxf(floorf(box.x), 0.f), s.x)),
+                static_cast<int>(fminf(fmaxf(floorf(box.y), 0.f), s.y)),
+                static_cast<int>(fmaxf(fminf(ceilf(box.z), s.x), 0.f)),
+                static_cast<int>(fmaxf(fminf(ceilf(box.w), s.y), 0.f))};
+}
+
+// Vertices of a polygon element, false when its range isn't inside the points of the sample.
+__device__ bool PolygonRange(const Scene &scene, const Element &e, int &first, int &count)
+{
+    if (!(e.p[0] >= 0 && e.p[1] >= 3 && e.p[0] + e.p[1] <= scene.numPoints))
+    {
+        return false;
+    }
+    first = static_cast<int>(e.p[0]);
+    count = static_cast<int>(e.p[1]);
+    return count >= 3 && first <= scene.numPoints - count;
+}
+
+// Glyph of a glyph element, false when it isn't in the atlas or the scale isn't positive.
+__device__ bool GlyphIndex(const Scene &scene, const Element &e, int &glyph)
+{
+    if (!(e.p[3] >= 0 && e.p[3] < scene.numGlyphs && e.p[2] > 0))
+    {
+        return false;
+    }
+    glyph = static_cast<int>(e.p[3]);
+    return true;
+}
+
+// Pixel region [lo, hi) that an element may cover, empty when it's not drawn.
+__device__ int4 ElementBounds(const Scene &scene, int sample, const Element &e)
+{
+    float4 box{0, 0, 0, 0};
+
+    if (e.color.w == 0)
+    {
+        return int4{0, 0, 0, 0};
+    }
+
+    switch (e.type)
+    {
+    case NVCV_OSD_RECT:
+        box = float4{e.p[0], e.p[1], e.p[2], e.p[3]};
+        break;
+
+    case NVCV_OSD_LINE:
+    {
+        const float r = LineThickness(e) / 2;
+
+        box = float4{fminf(e.p[0], e.p[2]) - r, fminf(e.p[1], e.p[3]) - r, fmaxf(e.p[0], e.p[2]) + r,
+                     fmaxf(e.p[1], e.p[3]) + r};
+        break;
+    }
+
+    case NVCV_OSD_POLYGON:
+    {
+        int first, count;
+        if (PolygonRange(scene, e, first, count))
+        {
+            box = float4{INFINITY, INFINITY, -INFINITY, -INFINITY};
+            for (int j = first; j < first + count; ++j)
+            {
+                const float2 v = *scene.points.ptr(sample, 0, j);
+
+                box = float4{fminf(box.x, v.x), fminf(box.y, v.y), fmaxf(box.z, v.x), fmaxf(box.w, v.y)};
+            }
+        }
+        break;
+    }
+
+    case NVCV_OSD_GLYPH:
+    {
+        int glyph;
+        if (GlyphIndex(scene, e, glyph))
+        {
+            box = float4{e.p[0], e.p[1], e.p[0] + scene.glyphSize.x * e.p[2], e.p[1] + scene.glyphSize.y * e.p[2]};
+        }
+        break;
+    }
+    }
+
+    return ClipBounds(box, scene.size);
+}
+
+// Coverage in [0, 255] of the pixel center p by the element, only glyphs are partially covering.
+__device__ int Coverage(const Scene &scene, int sample, const Element &e, float2 p)
+{
+    switch (e.type)
+    {
+    case NVCV_OSD_RECT:
+    {
+        const float t = e.p[4];
+
+        const bool outer = p.x >= e.p[0] && p.x < e.p[2] && p.y >= e.p[1] && p.y < e.p[3];
+        const bool inner = t > 0 && p.x >= e.p[0] + t && p.x < e.p[2] - t && p.y >= e.p[1] + t && p.y < e.p[3] - t;
+        return outer && !inner ? 255 : 0;
+    }
+
+    case NVCV_OSD_LINE:
+    {
+        const float2 v{e.p[2] - e.p[0], e.p[3] - e.p[1]};
+        const float2 w{p.x - e.p[0], p.y - e.p[1]};
+
+        const float len2 = v.x * v.x + v.y * v.y;
+        const float u    = len2 > 0 ? fminf(fmaxf((w.x * v.x + w.y * v.y) / len2, 0.f), 1.f) : 0.f;
+        const float dx   = w.x - u * v.x;
+        const float dy   = w.y - u * v.y;
+        const float r    = LineThickness(e) / 2;
+        return dx * dx + dy * dy <= r * r ? 255 : 0;
+    }
+
+    case NVCV_OSD_POLYGON:
+    {
+        int first, count;
+        PolygonRange(scene, e, first, count);
+
+        bool   inside = false;
+        float2 prev   = *scene.points.ptr(sample, 0, first + count - 1);
+        for (int j = first; j < first + count; ++j)
+        {
+            const float2 cur = *scene.points.ptr(sample, 0, j);
+            if ((cur.y > p.y) != (prev.y > p.y) && p.x < (prev.x - cur.x) * (p.y - cur.y) / (prev.y - cur.y) + cur.x)
+            {
+                inside = !inside;
+            }
+            prev = cur;
+        }
+        return inside ? 255 : 0;
+    }
+
+    case NVCV_OSD_GLYPH:
+    {
+        int glyph;
+        GlyphIndex(scene, e, glyph);
+
+        const float u = floorf((p.x - e.p[0]) / e.p[2]);
+        const float v = floorf((p.y - e.p[1]) / e.p[2]);
+        if (u < 0 || v < 0 || u >= scene.glyphSize.x || v >= scene.glyphSize.y)
+        {
+            return 0;
+        }
+        return *scene.glyphs.ptr(glyph, static_cast<int>(v), static_cast<int>(u));
+    }
+    }
+
+    return 0;
+}
+
+__global__ void elementBounds(Scene scene, int4 *bounds)
+{
+    const int sample = blockIdx.y;
+    const int i      = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (i >= scene.numElements)
+    {
+        return;
+    }
+
+    int4 b{0, 0, 0, 0};
+    if (i < NumElements(scene, sample))
+    {
+        b = ElementBounds(scene, sample, LoadElement(scene, sample, i));
+    }
+    bounds[static_cast<int64_t>(sample) * scene.numElements + i] = b;
+}
+
+// The elements overlapping the tile of the block are listed in shared memory, in their order, a chunk at a time.
+// Each thread then blends them one after the other over its pixel, so later elements are drawn over earlier ones
+// and the result doesn't depend on how the image is split in tiles.
+template<int cn>
+__global__ void drawElements(nvcv::cuda::Tensor3DWrap<uchar> img, Scene scene, const int4 *bounds)
+{
+    __shared__ Element elements[kTileThreads];
+    __shared__ int     warpCounts[kTileThreads / 32];
+
+    const int sample = get_batch_idx();
+    const int tid    = threadIdx.y * blockDim.x + threadIdx.x;
+    const int lane   = tid % 32;
+    const int warp   = tid / 32;
+
+    const int4 tile{static_cast<int>(blockIdx.x) * kTileW, static_cast<int>(blockIdx.y) * kTileH,
+                    static_cast<int>(blockIdx.x + 1) * kTileW, static_cast<int>(blockIdx.y + 1) * kTileH};
+
+    const int  x      = tile.x + threadIdx.x;
+    const int  y      = tile.y + threadIdx.y;
+    const bool inside = x < scene.size.x && y < scene.size.y;
+
+    // the pixel is only read and written when an element covers it
+    uchar pix[cn];
+    bool  changed = false;
+
+    const float2 p{x + .5f, y + .5f};
+    const int4  *sampleBounds = bounds + static_cast<int64_t>(sample) * scene.numElements;
+    const int    numElements  = NumElements(scene, sample);
+
+    for (int base = 0; base < numElements; base += kTileThreads)
+    {
+        const int i = base + tid;
+
+        bool hit = false;
+        if (i < numElements)
+        {
+            const int4 b = sampleBounds[i];
+
+            hit = b.z > b.x && b.w > b.y && b.x < tile.z && b.z > tile.x && b.y < tile.w && b.w > tile.y;
+        }
+
+        const unsigned mask = __ballot_sync(0xFFFFFFFF, hit);
+        if (lane == 0)
+        {
+            warpCounts[warp] = __popc(mask);
+        }
+        __syncthreads();
+
+        int offset = 0, total = 0;
+#pragma unroll
+        for (int w = 0; w < kTileThreads / 32; ++w)
+        {
+            offset += w < warp ? warpCounts[w] : 0;
+            total += warpCounts[w];
+        }
+        if (hit)
+        {
+            elements[offset + __popc(mask & ((1u << lane) - 1))] = LoadElement(scene, sample, i);
+        }
+        __syncthreads();
+
+        if (inside)
+        {
+            for (int k = 0; k < total; ++k)
+            {
+                const Element &e = elements[k];
+
+                const int cov = Coverage(scene, sample, e, p);
+                if (cov == 0)
+                {
+                    continue;
+                }
+
+                if (!changed)
+                {
+#pragma unroll
+                    for (int c = 0; c < cn; ++c)
+                    {
+                        pix[c] = *img.ptr(sample, y, x * cn + c);
+                    }
+                    changed = true;
+                }
+
+                const int   alpha    = DivRound255(e.color.w * cov);
+                const uchar color[3] = {e.color.x, e.color.y, e.color.z};
+#pragma unroll
+                for (int c = 0; c < (cn < 3 ? cn : 3); ++c)
+                {
+                    pix[c] = AlphaBlend<false>(pix[c], color[c], alpha);
+                }
+            }
+        }
+        __syncthreads();
+    }
+
+    if (changed)
+    {
+#pragma unroll
+        for (int c = 0; c < cn; ++c)
+        {
+            *img.ptr(sample, y, x * cn + c) = pix[c];
+        }
+    }
+}
+
+template<int cn>
+void drawOSD(const nvcv::TensorDataAccessStridedImagePlanar &access, const Scene &scene, int4 *bounds,
+             cudaStream_t stream)
+{
+    nvcv::cuda::Tensor3DWrap<uchar> img(access.sampleData(0), static_cast<int>(access.sampleStride()),
+                                        static_cast<int>(access.rowStride()));
+
+    const int numSamples = access.numSamples();
+
+    dim3 boundsGrid(divUp(scene.numElements, kTileThreads), numSamples);
+
+    elementBounds<<<boundsGrid, kTileThreads, 0, stream>>>(scene, bounds);
+    checkKernelErrors();
+
+    dim3 block(kTileW, kTileH);
+    dim3 grid(divUp(scene.size.x, kTileW), divUp(scene.size.y, kTileH), numSamples);
+
+    drawElements<cn><<<grid, block, 0, stream>>>(img, scene, bounds);
+    checkKernelErrors();
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
+template<typename T>
+nvcv::cuda::Tensor3DWrap<T> wrapRows(const nvcv::TensorDataAccessStridedImagePlanar &access)
+{
+    return nvcv::cuda::Tensor3DWrap<T>(access.sampleData(0), static_cast<int>(access.sampleStride()),
+                                       static_cast<int>(access.rowStride()));
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+OSD::OSD(DataShape max_input_shape, DataShape max_output_shape, int max_batch_size, int max_num_elements)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_maxBatchSize(max_batch_size)
+    , m_maxNumElements(max_num_elements)
+{
+    setGpuWorkspaceSize(calBufferSize(max_batch_size, max_num_elements));
+}
+
+size_t OSD::calBufferSize(int max_batch_size, int max_num_elements)
+{
+    // Pixel bounds of each element
+    return static_cast<size_t>(std::max(max_batch_size, 0)) * std::max(max_num_elements, 0) * sizeof(int4);
+}
+
+ErrorCode OSD::infer(const ITensorDataStridedCuda &inOutData, const ITensorDataStridedCuda &elementData,
+                     const ITensorDataStridedCuda *countData, const ITensorDataStridedCuda *pointData,
+                     const ITensorDataStridedCuda *glyphData, cudaStream_t stream)
+{
+    for (const ITensorDataStridedCuda *data : {&inOutData, &elementData, countData, pointData, glyphData})
+    {
+        if (data == nullptr)
+        {
+            continue;
+        }
+
+        DataFormat format = GetLegacyDataFormat(data->layout());
+        if (!(format == kNHWC || format == kHWC))
+        {
+            LOG_ERROR("Invalid DataFormat " << format);
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+    }
+
+    cuda_op::DataType data_type = GetLegacyDataType(inOutData.dtype());
+    if (data_type != kCV_8U)
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (elementData.dtype() != nvcv::TYPE_F32 || (countData && countData->dtype() != nvcv::TYPE_S32)
+        || (pointData && pointData->dtype() != nvcv::TYPE_F32) || (glyphData && glyphData->dtype() != nvcv::TYPE_U8))
+    {
+        LOG_ERROR("Invalid DataType, elements and points must be float32, counts int32 and glyphs uint8");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto access        = TensorDataAccessStridedImagePlanar::Create(inOutData);
+    auto elementAccess = TensorDataAccessStridedImagePlanar::Create(elementData);
+    NVCV_ASSERT(access && elementAccess);
+
+    const int  channels   = access->numChannels();
+    const int  numSamples = access->numSamples();
+    const int2 size{static_cast<int>(access->numCols()), static_cast<int>(access->numRows())};
+
+    if (channels != 1 && channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const int numElements = elementAccess->numCols();
+
+    if (elementAccess->numSamples() != numSamples || elementAccess->numRows() != 1
+        || elementAccess->numChannels() != kElementSize || elementAccess->colStride() != kElementSize * sizeof(float))
+    {
+        LOG_ERROR("Invalid element shape " << elementData.shape() << ", elements must be a single row of "
+                                           << kElementSize << "-channel elements per sample");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (numSamples > m_maxBatchSize || numElements > m_maxNumElements || numSamples > 65535)
+    {
+        LOG_ERROR("Invalid element shape " << elementData.shape() << ", it exceeds the maximum batch size "
+                                           << m_maxBatchSize << " or number of elements " << m_maxNumElements
+                                           << " of the operator");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    nvcv::detail::Optional<TensorDataAccessStridedImagePlanar> countAccess, pointAccess, glyphAccess;
+    if (countData)
+    {
+        countAccess = TensorDataAccessStridedImagePlanar::Create(*countData);
+        NVCV_ASSERT(countAccess);
+
+        if (countAccess->numSamples() != numSamples || countAccess->numRows() != 1 || countAccess->numCols() != 1
+            || countAccess->numChannels() != 1)
+        {
+            LOG_ERROR("Invalid count shape " << countData->shape() << ", it must have a single element per sample");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+    if (pointData)
+    {
+        pointAccess = TensorDataAccessStridedImagePlanar::Create(*pointData);
+        NVCV_ASSERT(pointAccess);
+
+        if (pointAccess->numSamples() != numSamples || pointAccess->numRows() != 1 || pointAccess->numChannels() != 2
+            || pointAccess->colStride() != sizeof(float2))
+        {
+            LOG_ERROR("Invalid point shape " << pointData->shape()
+                                             << ", points must be a single row of 2-channel points per sample");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+    if (glyphData)
+    {
+        glyphAccess = TensorDataAccessStridedImagePlanar::Create(*glyphData);
+        NVCV_ASSERT(glyphAccess);
+
+        if (glyphAccess->numChannels() != 1 || glyphAccess->colStride() != sizeof(uchar))
+        {
+            LOG_ERROR("Invalid glyph atlas shape " << glyphData->shape() << ", glyphs must have a single channel");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
+    if (numSamples == 0 || numElements == 0 || size.x == 0 || size.y == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    // Polygons and glyphs are skipped when their points or atlas aren't given
+    Scene scene{wrapRows<const float>(*elementAccess),
+                countAccess ? wrapRows<const int>(*countAccess) : nvcv::cuda::Tensor3DWrap<const int>{},
+                pointAccess ? wrapRows<const float2>(*pointAccess) : nvcv::cuda::Tensor3DWrap<const float2>{},
+                glyphAccess ? wrapRows<const uchar>(*glyphAccess) : nvcv::cuda::Tensor3DWrap<const uchar>{},
+                countData != nullptr,
+                numElements,
+                pointAccess ? static_cast<int>(pointAccess->numCols()) : 0,
+                glyphAccess ? static_cast<int>(glyphAccess->numSamples()) : 0,
+                glyphAccess ? int2{static_cast<int>(glyphAccess->numCols()), static_cast<int>(glyphAccess->numRows())}
+                            : int2{0, 0},
+                size};
+
+    typedef void (*draw_osd_t)(const nvcv::TensorDataAccessStridedImagePlanar &access, const Scene &scene,
+                               int4 *bounds, cudaStream_t stream);
+
+    static const draw_osd_t funcs[4] = {drawOSD<1>, 0, drawOSD<3>, drawOSD<4>};
+
+    funcs[channels - 1](*access, scene, gpuWorkspace(stream).as<int4>(), stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -22,6 +22,7 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "NormalizeUtils.cuh"
 
 using namespace nvcv::legacy::helpers;
 
@@ -101,26 +102,118 @@ void padAndStack(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
     funcs[borderMode](inData, outData, top, left, borderValue, stream);
 }
 
-namespace nvcv::legacy::cuda_op {
-
-size_t PadAndStack::calBufferSize(int batch_size)
+// Output samples of the fused pad, normalize and reformat path are interleaved or planar, the channels of a pixel
+// are either next to each other or a plane apart.
+template<typename T>
+struct StackedOutput
 {
-    return 0;
-}
+    nvcv::Byte *data;
+    int64_t     sampleStride, rowStride, colStride, channelStride;
 
-ErrorCode PadAndStack::infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
-                             const ITensorDataStridedCuda &top, const ITensorDataStridedCuda &left,
-                             const NVCVBorderType borderMode, const float borderValue, cudaStream_t stream)
+    __device__ T &at(int n, int y, int x, int c) const
+    {
+        return *reinterpret_cast<T *>(data + n * sampleStride + y * rowStride + x * colStride + c * channelStride);
+    }
+};
+
+// Pads each sample, normalizes it, converts it to the output type and writes it in the output layout in one pass.
+template<typename OutT, typename BrdRd, class Ptr2DVec>
+__global__ void padAndStackNormalizeKernel(const BrdRd src, StackedOutput<OutT> dst, const Ptr2DVec topVec,
+                                           const Ptr2DVec leftVec, NormParams params, int out_rows, int out_cols)
 {
-    DataFormat format    = GetLegacyDataFormat(outData.layout());
-    DataType   data_type = GetLegacyDataType(outData.dtype());
+    using T = typename BrdRd::elem_type;
 
-    if (!(format == kNHWC || format == kHWC))
+    const int x_out     = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y_out     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = blockIdx.z;
+
+    if (x_out >= out_cols || y_out >= out_rows)
+        return;
+
+    const int top  = *topVec.ptr(0, 0, batch_idx);
+    const int left = *leftVec.ptr(0, 0, batch_idx);
+
+    const auto value = nvcv::cuda::StaticCast<float>(src(batch_idx, y_out - top, x_out - left));
+
+#pragma unroll
+    for (int c = 0; c < nvcv::cuda::NumElements<T>; ++c)
     {
-        LOG_ERROR("Invalid DataFormat " << format);
-        return ErrorCode::INVALID_DATA_FORMAT;
+        dst.at(batch_idx, y_out, x_out, c)
+            = nvcv::cuda::SaturateCast<OutT>(NormalizeValue(params, nvcv::cuda::GetElement(value, c), batch_idx, c));
     }
+}
+
+template<typename D, typename OutT, template<typename> class Brd>
+void padAndStackNormalizeCaller(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
+                                const nvcv::TensorDataAccessStridedImagePlanar &outData,
+                                const nvcv::TensorDataAccessStridedImagePlanar &top,
+                                const nvcv::TensorDataAccessStridedImagePlanar &left, const float borderValue,
+                                const NormParams &params, cudaStream_t stream)
+{
+    Ptr2dVarShapeNHWC<D> src(inData);
+
+    StackedOutput<OutT> dst;
+    dst.data          = outData.sampleData(0);
+    dst.sampleStride  = outData.sampleStride();
+    dst.rowStride     = outData.rowStride();
+    dst.colStride     = outData.colStride();
+    dst.channelStride = outData.numPlanes() > 1 ? outData.planeStride() : static_cast<int64_t>(sizeof(OutT));
+
+    Ptr2dNHWC<int> topVec(top);
+    Ptr2dNHWC<int> leftVec(left);
+
+    dim3 block(16, 16);
+    dim3 grid(divUp(outData.size().w, block.x), divUp(outData.size().h, block.y), outData.numSamples());
+
+    Brd<D> brd(0, 0, nvcv::cuda::SetAll<D>(borderValue));
+
+    BorderReader<Ptr2dVarShapeNHWC<D>, Brd<D>> brdSrc(src, brd);
+
+    padAndStackNormalizeKernel<<<grid, block, 0, stream>>>(brdSrc, dst, topVec, leftVec, params, outData.numRows(),
+                                                           outData.numCols());
+    checkKernelErrors();
+}
+
+template<typename T, typename OutT>
+void padAndStackNormalize(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
+                          const nvcv::TensorDataAccessStridedImagePlanar &outData,
+                          const nvcv::TensorDataAccessStridedImagePlanar &top,
+                          const nvcv::TensorDataAccessStridedImagePlanar &left, int channels,
+                          const NVCVBorderType borderMode, const float borderValue, const NormParams &params,
+                          cudaStream_t stream)
+{
+    using T1 = nvcv::cuda::MakeType<T, 1>;
+    using T3 = nvcv::cuda::MakeType<T, 3>;
+    using T4 = nvcv::cuda::MakeType<T, 4>;
+
+    typedef void (*caller_t)(
+        const nvcv::IImageBatchVarShapeDataStridedCuda &inData, const nvcv::TensorDataAccessStridedImagePlanar &outData,
+        const nvcv::TensorDataAccessStridedImagePlanar &top, const nvcv::TensorDataAccessStridedImagePlanar &left,
+        const float borderValue, const NormParams &params, cudaStream_t stream);
+
+    static const caller_t funcs[4][5] = {
+        {padAndStackNormalizeCaller<T1, OutT, BrdConstant>, padAndStackNormalizeCaller<T1, OutT, BrdReplicate>,
+         padAndStackNormalizeCaller<T1, OutT, BrdReflect>, padAndStackNormalizeCaller<T1, OutT, BrdWrap>,
+         padAndStackNormalizeCaller<T1, OutT, BrdReflect101>},
+        {0, 0, 0, 0, 0},
+        {padAndStackNormalizeCaller<T3, OutT, BrdConstant>, padAndStackNormalizeCaller<T3, OutT, BrdReplicate>,
+         padAndStackNormalizeCaller<T3, OutT, BrdReflect>, padAndStackNormalizeCaller<T3, OutT, BrdWrap>,
+         padAndStackNormalizeCaller<T3, OutT, BrdReflect101>},
+        {padAndStackNormalizeCaller<T4, OutT, BrdConstant>, padAndStackNormalizeCaller<T4, OutT, BrdReplicate>,
+         padAndStackNormalizeCaller<T4, OutT, BrdReflect>, padAndStackNormalizeCaller<T4, OutT, BrdWrap>,
+         padAndStackNormalizeCaller<T4, OutT, BrdReflect101>}
+    };
+
+    const caller_t func = funcs[channels - 1][borderMode];
+    NVCV_ASSERT(func != 0);
+
+    func(inData, outData, top, left, borderValue, params, stream);
+}
 
+// Checks the border mode and the top/left tensors shared by the plain and fused paths.
+ErrorCode checkPadArgs(const nvcv::ITensorDataStridedCuda &top, const nvcv::ITensorDataStridedCuda &left,
+                       const NVCVBorderType borderMode)
+{
     if (!(borderMode == NVCV_BORDER_REFLECT101 || borderMode == NVCV_BORDER_REPLICATE
           || borderMode == NVCV_BORDER_CONSTANT || borderMode == NVCV_BORDER_REFLECT || borderMode == NVCV_BORDER_WRAP))
     {
@@ -128,16 +221,6 @@ ErrorCode PadAndStack::infer(const IImageBatchVarShapeDataStridedCuda &inData, c
         return ErrorCode::INVALID_PARAMETER;
     }
 
-    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_16S || data_type == kCV_32S
-          || data_type == kCV_32F))
-    {
-        LOG_ERROR("Invalid DataType " << data_type);
-        return ErrorCode::INVALID_DATA_TYPE;
-    }
-
-    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
-    NVCV_ASSERT(outAccess);
-
     DataType   left_data_type = GetLegacyDataType(left.dtype());
     DataFormat left_format    = GetLegacyDataFormat(left.layout());
     if (left_data_type != kCV_32S)
@@ -150,9 +233,7 @@ ErrorCode PadAndStack::infer(const IImageBatchVarShapeDataStridedCuda &inData, c
         LOG_ERROR("Invalid Left DataFormat " << left_format);
         return ErrorCode::INVALID_DATA_FORMAT;
     }
-
-    auto leftAccess = TensorDataAccessStridedImagePlanar::Create(left);
-    if (!leftAccess)
+    if (!nvcv::TensorDataAccessStridedImagePlanar::Create(left))
     {
         return ErrorCode::INVALID_DATA_TYPE;
     }
@@ -169,13 +250,54 @@ ErrorCode PadAndStack::infer(const IImageBatchVarShapeDataStridedCuda &inData, c
         LOG_ERROR("Invalid Top DataFormat " << top_format);
         return ErrorCode::INVALID_DATA_FORMAT;
     }
+    if (!nvcv::TensorDataAccessStridedImagePlanar::Create(top))
+    {
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+namespace nvcv::legacy::cuda_op {
+
+size_t PadAndStack::calBufferSize(int batch_size)
+{
+    return 0;
+}
+
+ErrorCode PadAndStack::infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                             const ITensorDataStridedCuda &top, const ITensorDataStridedCuda &left,
+                             const NVCVBorderType borderMode, const float borderValue, cudaStream_t stream)
+{
+    DataFormat format    = GetLegacyDataFormat(outData.layout());
+    DataType   data_type = GetLegacyDataType(outData.dtype());
+
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
 
-    auto topAccess = TensorDataAccessStridedImagePlanar::Create(top);
-    if (!topAccess)
+    ErrorCode err = checkPadArgs(top, left, borderMode);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_16S || data_type == kCV_32S
+          || data_type == kCV_32F || data_type == kCV_16F))
     {
+        LOG_ERROR("Invalid DataType " << data_type);
         return ErrorCode::INVALID_DATA_TYPE;
     }
 
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    auto leftAccess = TensorDataAccessStridedImagePlanar::Create(left);
+    auto topAccess  = TensorDataAccessStridedImagePlanar::Create(top);
+    NVCV_ASSERT(leftAccess && topAccess);
+
     const int channels = outAccess->numChannels();
 
     if (channels > 4)
@@ -189,19 +311,128 @@ ErrorCode PadAndStack::infer(const IImageBatchVarShapeDataStridedCuda &inData, c
         const TensorDataAccessStridedImagePlanar &top, const TensorDataAccessStridedImagePlanar &left,
         const NVCVBorderType borderMode, const float borderValue, cudaStream_t stream);
 
-    static const func_t funcs[6][4] = {
+    // Half-precision values are moved as 16-bit unsigned integers, so is the bit pattern of the border value
+    static const func_t funcs[8][4] = {
         { padAndStack<uchar1>, padAndStack<uchar2>,  padAndStack<uchar3>,  padAndStack<uchar4>},
         {                   0,                   0,                    0,                    0},
         {padAndStack<ushort1>,                   0, padAndStack<ushort3>, padAndStack<ushort4>},
         { padAndStack<short1>,                   0,  padAndStack<short3>,  padAndStack<short4>},
         {   padAndStack<int1>,                   0,    padAndStack<int3>,    padAndStack<int4>},
-        { padAndStack<float1>,                   0,  padAndStack<float3>,  padAndStack<float4>}
+        { padAndStack<float1>,                   0,  padAndStack<float3>,  padAndStack<float4>},
+        {                   0,                   0,                    0,                    0},
+        {padAndStack<ushort1>,                   0, padAndStack<ushort3>, padAndStack<ushort4>}
     };
 
     const func_t func = funcs[data_type][channels - 1];
     NVCV_ASSERT(func != 0);
 
-    func(inData, *outAccess, *topAccess, *leftAccess, borderMode, borderValue, stream);
+    const float value
+        = data_type == kCV_16F ? static_cast<__half_raw>(__float2half_rn(borderValue)).x : borderValue;
+
+    func(inData, *outAccess, *topAccess, *leftAccess, borderMode, value, stream);
+
+    return SUCCESS;
+}
+
+ErrorCode PadAndStack::infer(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                             const ITensorDataStridedCuda &top, const ITensorDataStridedCuda &left,
+                             const NVCVBorderType borderMode, const float borderValue,
+                             const ITensorDataStridedCuda &baseData, const ITensorDataStridedCuda &scaleData,
+                             const float global_scale, const float shift, const float epsilon, const uint32_t flags,
+                             cudaStream_t stream)
+{
+    DataFormat format = GetLegacyDataFormat(outData.layout());
+    if (!(format == kNHWC || format == kHWC || format == kNCHW || format == kCHW))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    ErrorCode err = checkPadArgs(top, left, borderMode);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (flags & ~CVCUDA_NORMALIZE_SCALE_IS_STDDEV)
+    {
+        LOG_ERROR("Invalid flags " << flags << ", only CVCUDA_NORMALIZE_SCALE_IS_STDDEV is supported");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (!inData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input varshape must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    const ImageFormat inFormat = inData.uniqueFormat();
+    DataType          in_type  = GetLegacyDataType(inFormat);
+    if (!(in_type == kCV_8U || in_type == kCV_16U || in_type == kCV_32F) || inFormat.numPlanes() != 1)
+    {
+        LOG_ERROR("Invalid input DataType " << in_type << ", it must be interleaved uint8, uint16 or float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    const DataType out_type = GetLegacyDataType(outData.dtype());
+    if (!(out_type == kCV_32F || out_type == kCV_16F || out_type == kCV_8U || out_type == kCV_8S))
+    {
+        LOG_ERROR("Invalid output DataType " << out_type << ", it must be float32, float16, uint8 or int8");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    const int channels = outAccess->numChannels();
+    if (!(channels == 1 || channels == 3 || channels == 4) || inFormat.numChannels() != channels)
+    {
+        LOG_ERROR("Invalid channel number " << channels << ", input and output must have 1, 3 or 4 channels");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const int numSamples = outAccess->numSamples();
+    if (inData.numImages() != numSamples)
+    {
+        LOG_ERROR("Invalid number of output samples " << numSamples << ", input has " << inData.numImages());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    int2 baseSize, scaleSize;
+    if ((err = ValidateNormParam("base", baseData, numSamples, channels, baseSize)) != ErrorCode::SUCCESS
+        || (err = ValidateNormParam("scale", scaleData, numSamples, channels, scaleSize)) != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    NormParams params
+        = CreateNormParams(baseData, baseSize, scaleData, scaleSize, global_scale, shift, epsilon, flags);
+
+    auto leftAccess = TensorDataAccessStridedImagePlanar::Create(left);
+    auto topAccess  = TensorDataAccessStridedImagePlanar::Create(top);
+    NVCV_ASSERT(leftAccess && topAccess);
+
+    typedef void (*func_t)(
+        const nvcv::IImageBatchVarShapeDataStridedCuda &inData, const TensorDataAccessStridedImagePlanar &outData,
+        const TensorDataAccessStridedImagePlanar &top, const TensorDataAccessStridedImagePlanar &left,
+        int channels, const NVCVBorderType borderMode, const float borderValue, const NormParams &params,
+        cudaStream_t stream);
+
+    // Input uint8, uint16 or float, output float, half, uint8 or int8
+    static const func_t funcs[3][4] = {
+        {padAndStackNormalize<uchar, float>, padAndStackNormalize<uchar, __half>, padAndStackNormalize<uchar, uchar>,
+         padAndStackNormalize<uchar, schar>},
+        {padAndStackNormalize<ushort, float>, padAndStackNormalize<ushort, __half>,
+         padAndStackNormalize<ushort, uchar>, padAndStackNormalize<ushort, schar>},
+        {padAndStackNormalize<float, float>, padAndStackNormalize<float, __half>, padAndStackNormalize<float, uchar>,
+         padAndStackNormalize<float, schar>}
+    };
+
+    const int in_idx  = in_type == kCV_8U ? 0 : (in_type == kCV_16U ? 1 : 2);
+    const int out_idx = out_type == kCV_32F ? 0 : (out_type == kCV_16F ? 1 : (out_type == kCV_8U ? 2 : 3));
+
+    funcs[in_idx][out_idx](inData, *outAccess, *topAccess, *leftAccess, channels, borderMode, borderValue, params,
+                           stream);
 
     return SUCCESS;
 }
@@ -25,12 +25,16 @@
 
 #include <nvcv/Rect.h>
 
+#include <array>
+#include <mutex>
+
 using namespace nvcv;
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
 
 #define BLOCK           32
 #define SHARE_MEM_LIMIT 4096
+#define FUSED_SHARE_MEM_LIMIT (32 * 1024)
 #define work_type       float
 
 namespace nvcv::legacy::cuda_op {
@@ -259,10 +263,111 @@ __global__ void vertical_pass(const cuda_op::Ptr2dNHWC<T> src, cuda_op::Ptr2dNHW
     }
 }
 
+// Horizontal and vertical passes fused in one kernel.  Each block resamples horizontally the input rows read by
+// its tile of output rows into shared memory, then resamples them vertically, so the intermediate image doesn't
+// go through global memory.  Intermediate values are rounded to T as in horizontal_pass, so results are the same.
+// The dynamic shared memory must hold the first blockDim.x columns of all rows read by the tile.
+template<class T>
+__global__ void fused_pass(const cuda_op::Ptr2dNHWC<T> src, cuda_op::Ptr2dNHWC<T> dst, int h_ksize, int v_ksize,
+                           const int *h_bounds, const work_type *h_kk, const int *v_bounds, const work_type *v_kk,
+                           work_type init_buffer, bool round_up)
+{
+    extern __shared__ __align__(sizeof(work_type)) unsigned char fused_smem[];
+    T *h_rows = reinterpret_cast<T *>(fused_smem);
+
+    const int x_offset   = blockIdx.x * blockDim.x;
+    const int y_offset   = blockIdx.y * blockDim.y;
+    const int dst_x      = x_offset + threadIdx.x;
+    const int dst_y      = y_offset + threadIdx.y;
+    const int local_tid  = threadIdx.x + blockDim.x * threadIdx.y;
+    const int batch_idx  = get_batch_idx();
+    int       out_height = dst.rows, out_width = dst.cols;
+
+    // Bounds are monotonic, the tile reads the rows from the start of its first row to the end of its last one.
+    int last_y    = min(y_offset + (int)blockDim.y, out_height) - 1;
+    int row_begin = v_bounds[y_offset * 2];
+    int num_rows  = v_bounds[last_y * 2] + v_bounds[last_y * 2 + 1] - row_begin;
+
+    for (int i = local_tid; i < num_rows * (int)blockDim.x; i += blockDim.x * blockDim.y)
+    {
+        int local_x = i % blockDim.x;
+        int x       = x_offset + local_x;
+        if (x < out_width)
+        {
+            int              y    = row_begin + i / blockDim.x;
+            int              xmin = h_bounds[x * 2];
+            int              xmax = h_bounds[x * 2 + 1];
+            const work_type *h_k  = &h_kk[x * h_ksize];
+
+            for (int c = 0; c < src.ch; ++c)
+            {
+                work_type h_ss = 0.0;
+                for (int k = 0; k < xmax; ++k)
+                {
+                    h_ss = h_ss + *src.ptr(batch_idx, y, k + xmin, c) * h_k[k];
+                }
+
+                if (round_up)
+                    h_rows[i * src.ch + c] = cuda::SaturateCast<T>(std::round(h_ss));
+                else
+                    h_rows[i * src.ch + c] = cuda::SaturateCast<T>(h_ss);
+            }
+        }
+    }
+
+    __syncthreads();
+
+    if (dst_x < out_width && dst_y < out_height)
+    {
+        int ymin = v_bounds[dst_y * 2] - row_begin;
+        int ymax = v_bounds[dst_y * 2 + 1];
+
+        const work_type *v_k = &v_kk[dst_y * v_ksize];
+
+        for (int c = 0; c < src.ch; ++c)
+        {
+            work_type ss = init_buffer;
+            for (int y = 0; y < ymax; ++y)
+            {
+                ss = ss + h_rows[((y + ymin) * blockDim.x + threadIdx.x) * src.ch + c] * v_k[y];
+            }
+
+            if (round_up)
+                *dst.ptr(batch_idx, dst_y, dst_x, c) = cuda::SaturateCast<T>(std::round(ss));
+            else
+                *dst.ptr(batch_idx, dst_y, dst_x, c) = cuda::SaturateCast<T>(ss);
+        }
+    }
+}
+
+// Maximum number of coefficients of the filter resampling in_size pixels to out_size pixels.
+template<typename Filter>
+int pillow_k_size(int in_size, int out_size)
+{
+    work_type filterscale = static_cast<work_type>(in_size) / out_size;
+    if (filterscale < 1.0)
+    {
+        filterscale = 1.0;
+    }
+    return static_cast<int>(ceil(Filter().support() * filterscale)) * 2 + 1;
+}
+
+// Size of the coefficient tables h_kk, v_kk and of the bounds h_bounds, v_bounds, stored in this order.
+template<typename Filter>
+size_t pillow_coeffs_size(int in_width, int in_height, int out_width, int out_height)
+{
+    return out_width * pillow_k_size<Filter>(in_width, out_width) * sizeof(work_type)
+         + out_height * pillow_k_size<Filter>(in_height, out_height) * sizeof(work_type)
+         + (out_width + out_height) * 2 * sizeof(int);
+}
+
+// The coefficient tables are stored at coeffs if not null, or at the beginning of gpu_workspace otherwise.
+// They're only computed if coeffs_ready is false.
 template<typename Filter, typename elem_type>
 void pillow_resize_v2(const TensorDataAccessStridedImagePlanar &inData,
-                      const TensorDataAccessStridedImagePlanar &outData, void *gpu_workspace, bool normalize_coeff,
-                      work_type init_buffer, bool round_up, cudaStream_t stream)
+                      const TensorDataAccessStridedImagePlanar &outData, void *gpu_workspace, void *coeffs,
+                      bool coeffs_ready, bool normalize_coeff, work_type init_buffer, bool round_up,
+                      cudaStream_t stream)
 {
     cuda_op::DataShape   input_shape = GetLegacyDataShape(inData.infoShape());
     Ptr2dNHWC<elem_type> src_ptr(inData);
@@ -294,11 +399,18 @@ void pillow_resize_v2(const TensorDataAccessStridedImagePlanar &inData,
     int h_k_size = static_cast<int>(ceil(h_support)) * 2 + 1;
     int v_k_size = static_cast<int>(ceil(v_support)) * 2 + 1;
 
-    work_type *h_kk     = (work_type *)((char *)gpu_workspace);
+    size_t coeffs_size = pillow_coeffs_size<Filter>(src_ptr.cols, src_ptr.rows, dst_ptr.cols, dst_ptr.rows);
+    if (coeffs == nullptr)
+    {
+        coeffs       = gpu_workspace;
+        coeffs_ready = false;
+    }
+
+    work_type *h_kk     = (work_type *)((char *)coeffs);
     work_type *v_kk     = (work_type *)((char *)h_kk + dst_ptr.cols * h_k_size * sizeof(work_type));
     int       *h_bounds = (int *)((char *)v_kk + dst_ptr.rows * v_k_size * sizeof(work_type));
     int       *v_bounds = (int *)((char *)h_bounds + dst_ptr.cols * 2 * sizeof(int));
-    elem_type *d_h_data = (elem_type *)((char *)v_bounds + dst_ptr.rows * 2 * sizeof(int));
+    elem_type *d_h_data = (elem_type *)((char *)gpu_workspace + coeffs_size);
 
     Ptr2dNHWC<elem_type> h_ptr(input_shape.N, input_shape.H, out_width, input_shape.C, (elem_type *)d_h_data);
 
@@ -331,37 +443,53 @@ void pillow_resize_v2(const TensorDataAccessStridedImagePlanar &inData,
         hv_sm_size1 = 0;
         hv_sm_size2 = 0;
     }
-    // compute horizental coef
-    _precomputeCoeffs<Filter><<<h_coef_grid, coef_block, h_sm_size, stream>>>(
-        src_ptr.cols, roi.x, h_scale, h_filterscale, h_support, dst_ptr.cols, h_k_size, filterp, h_bounds, h_kk,
-        normalize_coeff, h_use_share_mem);
+    if (!coeffs_ready)
+    {
+        // compute horizental coef
+        _precomputeCoeffs<Filter><<<h_coef_grid, coef_block, h_sm_size, stream>>>(
+            src_ptr.cols, roi.x, h_scale, h_filterscale, h_support, dst_ptr.cols, h_k_size, filterp, h_bounds, h_kk,
+            normalize_coeff, h_use_share_mem);
 
-    checkKernelErrors();
+        checkKernelErrors();
 #ifdef CUDA_DEBUG_LOG
-    checkCudaErrors(cudaStreamSynchronize(stream));
-    checkCudaErrors(cudaGetLastError());
+        checkCudaErrors(cudaStreamSynchronize(stream));
+        checkCudaErrors(cudaGetLastError());
 #endif
 
-    // compute vertical coef
-    _precomputeCoeffs<Filter><<<v_coef_grid, coef_block, v_sm_size, stream>>>(
-        src_ptr.rows, roi.y, v_scale, v_filterscale, v_support, dst_ptr.rows, v_k_size, filterp, v_bounds, v_kk,
-        normalize_coeff, v_use_share_mem);
+        // compute vertical coef
+        _precomputeCoeffs<Filter><<<v_coef_grid, coef_block, v_sm_size, stream>>>(
+            src_ptr.rows, roi.y, v_scale, v_filterscale, v_support, dst_ptr.rows, v_k_size, filterp, v_bounds, v_kk,
+            normalize_coeff, v_use_share_mem);
 
-    checkKernelErrors();
+        checkKernelErrors();
 #ifdef CUDA_DEBUG_LOG
-    checkCudaErrors(cudaStreamSynchronize(stream));
-    checkCudaErrors(cudaGetLastError());
+        checkCudaErrors(cudaStreamSynchronize(stream));
+        checkCudaErrors(cudaGetLastError());
 #endif
+    }
 
-    horizontal_pass<elem_type, Filter>
-        <<<gridSizeH, blockSize, hv_sm_size1, stream>>>(src_ptr, h_ptr, roi, filterp, h_k_size, v_k_size, h_bounds,
-                                                        h_kk, v_bounds, v_kk, init_buffer, round_up, hv_use_share_mem);
-    checkKernelErrors();
-    vertical_pass<elem_type, Filter>
-        <<<gridSizeV, blockSize, hv_sm_size2, stream>>>(h_ptr, dst_ptr, roi, filterp, h_k_size, v_k_size, h_bounds,
-                                                        h_kk, v_bounds, v_kk, init_buffer, round_up, hv_use_share_mem);
+    // Number of input rows read by a tile of blockSize.y output rows, whose centers are (blockSize.y - 1) * v_scale
+    // apart, each reading at most v_k_size rows.
+    int    fused_rows    = static_cast<int>(ceil((blockSize.y - 1) * v_scale)) + v_k_size + 1;
+    size_t fused_sm_size = fused_rows * blockSize.x * input_shape.C * sizeof(elem_type);
 
-    checkKernelErrors();
+    if (fused_sm_size <= FUSED_SHARE_MEM_LIMIT)
+    {
+        fused_pass<elem_type><<<gridSizeV, blockSize, fused_sm_size, stream>>>(
+            src_ptr, dst_ptr, h_k_size, v_k_size, h_bounds, h_kk, v_bounds, v_kk, init_buffer, round_up);
+        checkKernelErrors();
+    }
+    else
+    {
+        horizontal_pass<elem_type, Filter><<<gridSizeH, blockSize, hv_sm_size1, stream>>>(
+            src_ptr, h_ptr, roi, filterp, h_k_size, v_k_size, h_bounds, h_kk, v_bounds, v_kk, init_buffer, round_up,
+            hv_use_share_mem);
+        checkKernelErrors();
+        vertical_pass<elem_type, Filter><<<gridSizeV, blockSize, hv_sm_size2, stream>>>(
+            h_ptr, dst_ptr, roi, filterp, h_k_size, v_k_size, h_bounds, h_kk, v_bounds, v_kk, init_buffer, round_up,
+            hv_use_share_mem);
+        checkKernelErrors();
+    }
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
     checkCudaErrors(cudaGetLastError());
@@ -370,55 +498,152 @@ void pillow_resize_v2(const TensorDataAccessStridedImagePlanar &inData,
 
 template<typename Filter>
 void pillow_resize_filter(const TensorDataAccessStridedImagePlanar &inData,
-                          const TensorDataAccessStridedImagePlanar &outData, void *gpu_workspace,
-                          NVCVInterpolationType interpolation, cudaStream_t stream)
+                          const TensorDataAccessStridedImagePlanar &outData, void *gpu_workspace, void *coeffs,
+                          bool coeffs_ready, cudaStream_t stream)
 {
     cuda_op::DataType data_type = GetLegacyDataType(inData.dtype());
     switch (data_type)
     {
     case kCV_8U:
-        pillow_resize_v2<Filter, unsigned char>(inData, outData, gpu_workspace, false, 0., false, stream);
+        pillow_resize_v2<Filter, unsigned char>(inData, outData, gpu_workspace, coeffs, coeffs_ready, false, 0., false,
+                                                stream);
         break;
     case kCV_8S:
-        pillow_resize_v2<Filter, signed char>(inData, outData, gpu_workspace, false, 0., true, stream);
+        pillow_resize_v2<Filter, signed char>(inData, outData, gpu_workspace, coeffs, coeffs_ready, false, 0., true,
+                                              stream);
         break;
     case kCV_16U:
-        pillow_resize_v2<Filter, std::uint16_t>(inData, outData, gpu_workspace, false, 0., false, stream);
+        pillow_resize_v2<Filter, std::uint16_t>(inData, outData, gpu_workspace, coeffs, coeffs_ready, false, 0., false,
+                                                stream);
         break;
     case kCV_16S:
-        pillow_resize_v2<Filter, std::int16_t>(inData, outData, gpu_workspace, false, 0., true, stream);
+        pillow_resize_v2<Filter, std::int16_t>(inData, outData, gpu_workspace, coeffs, coeffs_ready, false, 0., true,
+                                               stream);
         break;
     case kCV_32S:
-        pillow_resize_v2<Filter, int>(inData, outData, gpu_workspace, false, 0., true, stream);
+        pillow_resize_v2<Filter, int>(inData, outData, gpu_workspace, coeffs, coeffs_ready, false, 0., true, stream);
         break;
     case kCV_32F:
-        pillow_resize_v2<Filter, float>(inData, outData, gpu_workspace, false, 0., false, stream);
+        pillow_resize_v2<Filter, float>(inData, outData, gpu_workspace, coeffs, coeffs_ready, false, 0., false, stream);
         break;
     default:
         break;
     }
 }
 
+// The coefficient tables of each configuration live in their own device allocation, as the workspace contents
+// aren't kept between calls.  Every entry has an event recorded after the last launch reading its tables, which
+// later calls, possibly on other streams, wait on before reading or overwriting them.
+class PillowResize::CoeffCache
+{
+public:
+    struct Entry
+    {
+        LaunchPlanKey key;
+        void         *data     = nullptr;
+        size_t        capacity = 0;
+        bool          ready    = false;
+        cudaEvent_t   lastUse  = nullptr;
+    };
+
+    ~CoeffCache()
+    {
+        for (int i = 0; i < m_size; ++i)
+        {
+            cudaEventSynchronize(m_entries[i].lastUse);
+            cudaEventDestroy(m_entries[i].lastUse);
+            cudaFree(m_entries[i].data);
+        }
+    }
+
+    std::mutex &mutex()
+    {
+        return m_mutex;
+    }
+
+    // Returns the entry whose tables are ready for key, or else a recycled entry of at least size bytes whose
+    // tables must be computed.  The stream waits for previous launches using the entry.  Returns nullptr if the
+    // tables can't be cached, the caller must then compute them in the workspace.
+    // Must be called with the mutex locked, until the entry is released.
+    Entry *acquire(const LaunchPlanKey &key, size_t size, cudaStream_t stream)
+    {
+        if (!key.valid())
+        {
+            return nullptr;
+        }
+
+        for (int i = 0; i < m_size; ++i)
+        {
+            Entry &entry = m_entries[i];
+            if (entry.ready && entry.key == key)
+            {
+                return cudaStreamWaitEvent(stream, entry.lastUse, 0) == cudaSuccess ? &entry : nullptr;
+            }
+        }
+
+        Entry *entry;
+        if (m_size < kCapacity)
+        {
+            entry = &m_entries[m_size];
+            if (cudaEventCreateWithFlags(&entry->lastUse, cudaEventDisableTiming) != cudaSuccess)
+            {
+                return nullptr;
+            }
+            ++m_size;
+        }
+        else
+        {
+            entry  = &m_entries[m_next];
+            m_next = (m_next + 1) % kCapacity;
+        }
+
+        entry->key   = key;
+        entry->ready = false;
+
+        if (entry->capacity < size)
+        {
+            cudaEventSynchronize(entry->lastUse);
+            cudaFree(entry->data);
+            entry->data     = nullptr;
+            entry->capacity = 0;
+            if (cudaMalloc(&entry->data, size) != cudaSuccess)
+            {
+                cudaGetLastError(); // clear the allocation error
+                entry->data = nullptr;
+                return nullptr;
+            }
+            entry->capacity = size;
+        }
+        else if (cudaStreamWaitEvent(stream, entry->lastUse, 0) != cudaSuccess)
+        {
+            return nullptr;
+        }
+        return entry;
+    }
+
+    // Records the launches enqueued on stream as the last users of the entry, whose tables are then ready.
+    void release(Entry &entry, cudaStream_t stream)
+    {
+        entry.ready = cudaEventRecord(entry.lastUse, stream) == cudaSuccess;
+    }
+
+private:
+    static constexpr int kCapacity = 8;
+
+    std::mutex                   m_mutex;
+    std::array<Entry, kCapacity> m_entries;
+    int                          m_size = 0;
+    int                          m_next = 0;
+};
+
 PillowResize::PillowResize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
     : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_coeffCache(std::make_unique<CoeffCache>())
 {
-    int    max_support = 1; //3
-    size_t size
-        = std::ceil(
-              max_output_shape.H
-                  * (((1.0 * max_input_shape.H / max_output_shape.H + 1) * max_support * 2 + 1) * sizeof(work_type)
-                     + 2 * sizeof(int))
-              + max_output_shape.W
-                    * (((1.0 * max_input_shape.W / max_output_shape.W + 1) * max_support * 2 + 1) * sizeof(work_type)
-                       + 2 * sizeof(int)))
-        + max_input_shape.N * max_input_shape.C * max_input_shape.H * max_output_shape.W * DataSize(max_data_type);
-    NVCV_CHECK_LOG(cudaMalloc(&gpu_workspace, size));
+    setGpuWorkspaceSize(calBufferSize(max_input_shape, max_output_shape, max_data_type));
 }
 
-PillowResize::~PillowResize()
-{
-    NVCV_CHECK_LOG(cudaFree(gpu_workspace));
-}
+PillowResize::~PillowResize() = default;
 
 size_t PillowResize::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
 {
@@ -482,14 +707,44 @@ ErrorCode PillowResize::infer(const ITensorDataStridedCuda &inData, const ITenso
         return ErrorCode::INVALID_PARAMETER;
     }
 
+    cuda_op::DataShape output_shape = GetLegacyDataShape(outAccess->infoShape());
+
+    // Coefficients are computed in the workspace while the stream is being captured, so that the graph doesn't
+    // depend on memory that later calls may overwrite.
+    cudaStreamCaptureStatus capture_status = cudaStreamCaptureStatusNone;
+    checkCudaErrors(cudaStreamIsCapturing(stream, &capture_status));
+
+    std::unique_lock<std::mutex> lock;
+    CoeffCache::Entry           *entry = nullptr;
+    if (capture_status == cudaStreamCaptureStatusNone)
+    {
+        LaunchPlanKey key;
+        key.add(input_shape.W).add(input_shape.H).add(output_shape.W).add(output_shape.H);
+        key.add(static_cast<int32_t>(interpolation)).add(static_cast<int32_t>(data_type));
+
+        size_t size = pillow_coeffs_size<BilinearFilter>(input_shape.W, input_shape.H, output_shape.W, output_shape.H);
+
+        lock  = std::unique_lock<std::mutex>(m_coeffCache->mutex());
+        entry = m_coeffCache->acquire(key, size, stream);
+    }
+
+    void *coeffs       = entry ? entry->data : nullptr;
+    bool  coeffs_ready = entry && entry->ready;
+
     switch (interpolation)
     {
     case NVCV_INTERP_LINEAR:
-        pillow_resize_filter<BilinearFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, stream);
+        pillow_resize_filter<BilinearFilter>(*inAccess, *outAccess, gpuWorkspace(stream).get(), coeffs, coeffs_ready,
+                                             stream);
         break;
     default:
         break;
     }
+
+    if (entry)
+    {
+        m_coeffCache->release(*entry, stream);
+    }
     return ErrorCode::SUCCESS;
 }
 
@@ -30,6 +30,7 @@ using namespace nvcv::legacy::helpers;
 
 #define BLOCK           32
 #define SHARE_MEM_LIMIT 4096
+#define FUSED_SHARE_MEM_LIMIT (32 * 1024)
 #define work_type       float
 
 namespace nvcv::legacy::cuda_op {
@@ -67,6 +68,103 @@ private:
     work_type _support;
 };
 
+// Fills the per-sample parameter table straight from the image descriptors,
+// so that no host staging is needed and the whole operator can be captured
+// in a CUDA graph. Each thread handles one sample on its own: the coefficient
+// tables of the samples are h_kk_stride and v_kk_stride elements apart, see
+// _coeffStride, so that no sample depends on the sizes of the previous ones.
+// Samples resizing the same width (or height) to the same size share the
+// horizontal (or vertical) coefficients of the first of them, see
+// _firstWithSameSize.
+template<class Filter, typename T>
+__global__ void _computeParamsVarShape(Ptr2dVarShapeNHWC<T> src, Ptr2dVarShapeNHWC<T> dst, Filter filterp,
+                                       int *rows, int *cols, int *out_rows, int *out_cols, int *roi_x, int *roi_y,
+                                       work_type *h_scale_batch, work_type *v_scale_batch,
+                                       work_type *h_filterscale_batch, work_type *v_filterscale_batch,
+                                       work_type *h_support_batch, work_type *v_support_batch, int *h_k_size_batch,
+                                       int *v_k_size_batch, int *h_bounds_offset, int *v_bounds_offset,
+                                       int *h_kk_offset, int *v_kk_offset, int h_kk_stride, int v_kk_stride,
+                                       int h_bounds_stride, int v_bounds_stride)
+{
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= src.batches)
+    {
+        return;
+    }
+
+    int h_first = i, v_first = i;
+    for (int j = i - 1; j >= 0; --j)
+    {
+        if (src.at_cols(j) == src.at_cols(i) && dst.at_cols(j) == dst.at_cols(i))
+        {
+            h_first = j;
+        }
+        if (src.at_rows(j) == src.at_rows(i) && dst.at_rows(j) == dst.at_rows(i))
+        {
+            v_first = j;
+        }
+    }
+
+    work_type h_scale = static_cast<work_type>(src.at_cols(i)) / dst.at_cols(i);
+    work_type v_scale = static_cast<work_type>(src.at_rows(i)) / dst.at_rows(i);
+
+    work_type h_filterscale = h_scale < 1.0 ? 1.0 : h_scale;
+    work_type v_filterscale = v_scale < 1.0 ? 1.0 : v_scale;
+
+    // Determine support size (length of resampling filter).
+    work_type h_support = filterp.support() * h_filterscale;
+    work_type v_support = filterp.support() * v_filterscale;
+
+    rows[i]     = src.at_rows(i);
+    cols[i]     = src.at_cols(i);
+    out_rows[i] = dst.at_rows(i);
+    out_cols[i] = dst.at_cols(i);
+
+    roi_x[i] = 0;
+    roi_y[i] = 0;
+
+    h_scale_batch[i]       = h_scale;
+    v_scale_batch[i]       = v_scale;
+    h_filterscale_batch[i] = h_filterscale;
+    v_filterscale_batch[i] = v_filterscale;
+    h_support_batch[i]     = h_support;
+    v_support_batch[i]     = v_support;
+    // Maximum number of coeffs.
+    h_k_size_batch[i] = static_cast<int>(ceil(h_support)) * 2 + 1;
+    v_k_size_batch[i] = static_cast<int>(ceil(v_support)) * 2 + 1;
+
+    h_kk_offset[i]     = h_first * h_kk_stride;
+    h_bounds_offset[i] = h_first * h_bounds_stride;
+    v_kk_offset[i]     = v_first * v_kk_stride;
+    v_bounds_offset[i] = v_first * v_bounds_stride;
+}
+
+// Upper bound of out_size * k_size of the samples resizing at most max_in to at
+// most max_out, the stride of their coefficient tables. As ceil(support * in /
+// out) <= support * in / out + 1, a downscaling sample needs at most
+// 2 * support * in + 3 * out coefficients, and an upscaling one
+// (2 * ceil(support) + 1) * out. With the bilinear support of 1 it's what
+// PillowResizeVarShape::calBufferSize reserves per sample.
+inline int _coeffStride(int max_in, int max_out, work_type support)
+{
+    int s = static_cast<int>(ceil(support));
+    return std::max(2 * s * max_in + 3 * max_out, (2 * s + 1) * max_out);
+}
+
+// Returns whether no sample before idx resizes the same input size to the same
+// output size, i.e. whether sample idx computes the coefficients it shares.
+__device__ bool _firstWithSameSize(const int *in_size_batch, const int *out_size_batch, int idx)
+{
+    for (int j = 0; j < idx; ++j)
+    {
+        if (in_size_batch[j] == in_size_batch[idx] && out_size_batch[j] == out_size_batch[idx])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 template<class Filter>
 __global__ void _precomputeCoeffsVarShape(int *in_size_batch, int *in0_batch, work_type *scale_batch,
                                           work_type *filterscale_batch, work_type *support_batch, int *out_size_batch,
@@ -78,7 +176,12 @@ __global__ void _precomputeCoeffsVarShape(int *in_size_batch, int *in0_batch, wo
     const int local_id = threadIdx.x;
     const int x_offset = blockIdx.x * blockDim.x;
 
-    const int  batch_idx   = get_batch_idx();
+    const int batch_idx = get_batch_idx();
+    if (!_firstWithSameSize(in_size_batch, out_size_batch, batch_idx))
+    {
+        return;
+    }
+
     int        in_size     = in_size_batch[batch_idx];
     int        in0         = in0_batch[batch_idx];
     work_type  scale       = scale_batch[batch_idx];
@@ -293,9 +396,97 @@ __global__ void vertical_pass_var_shape(const Ptr2dNHWC<T1> src, Ptr2dVarShapeNH
     }
 }
 
+// Horizontal and vertical passes fused in one kernel, see fused_pass in pillow_resize.cu.  The intermediate
+// rows are kept in shared memory as work_type, as horizontal_pass_var_shape stores them.
+template<class T>
+__global__ void fused_pass_var_shape(const Ptr2dVarShapeNHWC<T> src, Ptr2dVarShapeNHWC<T> dst, int *h_ksize_batch,
+                                     int *v_ksize_batch, int *h_bounds_batch, int *h_bounds_offset,
+                                     work_type *h_kk_batch, int *h_kk_offset, int *v_bounds_batch,
+                                     int *v_bounds_offset, work_type *v_kk_batch, int *v_kk_offset,
+                                     work_type init_buffer, bool round_up)
+{
+    extern __shared__ __align__(sizeof(work_type)) unsigned char fused_smem[];
+    work_type *h_rows = reinterpret_cast<work_type *>(fused_smem);
+
+    const int x_offset  = blockIdx.x * blockDim.x;
+    const int y_offset  = blockIdx.y * blockDim.y;
+    const int dst_x     = x_offset + threadIdx.x;
+    const int dst_y     = y_offset + threadIdx.y;
+    const int local_tid = threadIdx.x + blockDim.x * threadIdx.y;
+
+    const int batch_idx  = get_batch_idx();
+    int       out_height = dst.at_rows(batch_idx), out_width = dst.at_cols(batch_idx);
+    if (x_offset >= out_width || y_offset >= out_height)
+    {
+        return;
+    }
+
+    int        h_ksize  = h_ksize_batch[batch_idx];
+    int        v_ksize  = v_ksize_batch[batch_idx];
+    int       *h_bounds = h_bounds_batch + h_bounds_offset[batch_idx];
+    work_type *h_kk     = h_kk_batch + h_kk_offset[batch_idx];
+    int       *v_bounds = v_bounds_batch + v_bounds_offset[batch_idx];
+    work_type *v_kk     = v_kk_batch + v_kk_offset[batch_idx];
+
+    int last_y    = min(y_offset + (int)blockDim.y, out_height) - 1;
+    int row_begin = v_bounds[y_offset * 2];
+    int num_rows  = v_bounds[last_y * 2] + v_bounds[last_y * 2 + 1] - row_begin;
+
+    for (int i = local_tid; i < num_rows * (int)blockDim.x; i += blockDim.x * blockDim.y)
+    {
+        int local_x = i % blockDim.x;
+        int x       = x_offset + local_x;
+        if (x < out_width)
+        {
+            int        y    = row_begin + i / blockDim.x;
+            int        xmin = h_bounds[x * 2];
+            int        xmax = h_bounds[x * 2 + 1];
+            work_type *h_k  = &h_kk[x * h_ksize];
+
+            for (int c = 0; c < src.nch; ++c)
+            {
+                work_type h_ss = 0.0;
+                for (int k = 0; k < xmax; ++k)
+                {
+                    h_ss = h_ss + *src.ptr(batch_idx, y, k + xmin, c) * h_k[k];
+                }
+
+                if (round_up)
+                    h_rows[i * src.nch + c] = cuda::SaturateCast<work_type>(std::round(h_ss));
+                else
+                    h_rows[i * src.nch + c] = cuda::SaturateCast<work_type>(h_ss);
+            }
+        }
+    }
+
+    __syncthreads();
+
+    if (dst_x < out_width && dst_y < out_height)
+    {
+        int ymin = v_bounds[dst_y * 2] - row_begin;
+        int ymax = v_bounds[dst_y * 2 + 1];
+
+        work_type *v_k = &v_kk[dst_y * v_ksize];
+
+        for (int c = 0; c < src.nch; ++c)
+        {
+            work_type ss = init_buffer;
+            for (int y = 0; y < ymax; ++y)
+            {
+                ss = ss + h_rows[((y + ymin) * blockDim.x + threadIdx.x) * src.nch + c] * v_k[y];
+            }
+
+            if (round_up)
+                *dst.ptr(batch_idx, dst_y, dst_x, c) = cuda::SaturateCast<T>(std::round(ss));
+            else
+                *dst.ptr(batch_idx, dst_y, dst_x, c) = cuda::SaturateCast<T>(ss);
+        }
+    }
+}
+
 template<typename Filter, typename elem_type>
 void pillow_resize_var_shape(const IImageBatchVarShape &inDataBase, const IImageBatchVarShape &outDataBase,
-                             void *gpu_workspace, void *cpu_workspace, bool normalize_coeff, work_type init_buffer,
+                             void *gpu_workspace, bool normalize_coeff, work_type init_buffer,
                              bool round_up, cudaStream_t stream)
 {
     auto *inDataPtr = dynamic_cast<const IImageBatchVarShapeDataStridedCuda *>(inDataBase.exportData(stream));
@@ -324,82 +515,40 @@ void pillow_resize_var_shape(const IImageBatchVarShape &inDataBase, const IImage
     int max_height = outMaxSize.h, max_width = outMaxSize.w;
     int max_input_height = inMaxSize.h;
 
-    const void **inputs              = (const void **)cpu_workspace;
-    void       **outputs             = (void **)((char *)inputs + sizeof(void *) * batch);
-    void       **hori                = (void **)((char *)outputs + sizeof(void *) * batch);
-    int         *rows                = (int *)((char *)hori + sizeof(void *) * batch);
-    int         *cols                = (int *)((char *)rows + sizeof(int) * batch);
-    int         *out_rows            = (int *)((char *)cols + sizeof(int) * batch);
-    int         *out_cols            = (int *)((char *)out_rows + sizeof(int) * batch);
-    int         *roi_x               = (int *)((char *)out_cols + sizeof(int) * batch);
-    int         *roi_y               = (int *)((char *)roi_x + sizeof(int) * batch);
-    work_type   *h_scale_batch       = (work_type *)((char *)roi_y + sizeof(int) * batch);
-    work_type   *v_scale_batch       = (work_type *)((char *)h_scale_batch + sizeof(work_type) * batch);
-    work_type   *h_filterscale_batch = (work_type *)((char *)v_scale_batch + sizeof(work_type) * batch);
-    work_type   *v_filterscale_batch = (work_type *)((char *)h_filterscale_batch + sizeof(work_type) * batch);
-    work_type   *h_support_batch     = (work_type *)((char *)v_filterscale_batch + sizeof(work_type) * batch);
-    work_type   *v_support_batch     = (work_type *)((char *)h_support_batch + sizeof(work_type) * batch);
-    int         *h_k_size_batch      = (int *)((char *)v_support_batch + sizeof(work_type) * batch);
-    int         *v_k_size_batch      = (int *)((char *)h_k_size_batch + sizeof(int) * batch);
-    int         *h_bounds_offset     = (int *)((char *)v_k_size_batch + sizeof(int) * batch);
-    int         *v_bounds_offset     = (int *)((char *)h_bounds_offset + sizeof(int) * batch);
-    int         *h_kk_offset         = (int *)((char *)v_bounds_offset + sizeof(int) * batch);
-    int         *v_kk_offset         = (int *)((char *)h_kk_offset + sizeof(int) * batch);
-
-    int h_kk_total = 0, v_kk_total = 0;
+    // Per-sample parameters and coefficient tables are computed on device, in
+    // tables of fixed stride per sample. Host only needs the largest kernel
+    // sizes of the batch to size the shared memory of the launches.
+    const int h_kk_stride     = _coeffStride(inMaxSize.w, outMaxSize.w, filterp.support());
+    const int v_kk_stride     = _coeffStride(inMaxSize.h, outMaxSize.h, filterp.support());
+    const int h_bounds_stride = outMaxSize.w * 2;
+    const int v_bounds_stride = outMaxSize.h * 2;
+
+    const int h_kk_total     = h_kk_stride * batch;
+    const int v_kk_total     = v_kk_stride * batch;
+    const int h_bounds_total = h_bounds_stride * batch;
+    const int v_bounds_total = v_bounds_stride * batch;
+
     int max_h_k_size = 0, max_v_k_size = 0;
-    int h_bounds_total = 0, v_bounds_total = 0;
+    int max_fused_rows = 0;
 
     for (int i = 0; i < batch; i++)
     {
-        rows[i]     = inDataBase[i].size().h;
-        cols[i]     = inDataBase[i].size().w;
-        out_rows[i] = outDataBase[i].size().h;
-        out_cols[i] = outDataBase[i].size().w;
-
-        roi_x[i] = 0;
-        roi_y[i] = 0;
-
-        work_type h_scale = 0, v_scale = 0;
-        work_type h_filterscale = 0, v_filterscale = 0;
-        h_filterscale = h_scale = static_cast<work_type>(inDataBase[i].size().w) / out_cols[i];
-        v_filterscale = v_scale = static_cast<work_type>(inDataBase[i].size().h) / out_rows[i];
-        if (h_filterscale < 1.0)
-        {
-            h_filterscale = 1.0;
-        }
-        if (v_filterscale < 1.0)
-        {
-            v_filterscale = 1.0;
-        }
-        h_scale_batch[i]       = h_scale;
-        v_scale_batch[i]       = v_scale;
-        h_filterscale_batch[i] = h_filterscale;
-        v_filterscale_batch[i] = v_filterscale;
-
-        // Determine support size (length of resampling filter).
-        work_type h_support = filterp.support() * h_filterscale;
-        work_type v_support = filterp.support() * v_filterscale;
-        // Maximum number of coeffs.
-        int       h_k_size = static_cast<int>(ceil(h_support)) * 2 + 1;
-        int       v_k_size = static_cast<int>(ceil(v_support)) * 2 + 1;
-        h_support_batch[i] = h_support;
-        v_support_batch[i] = v_support;
-        h_k_size_batch[i]  = h_k_size;
-        v_k_size_batch[i]  = v_k_size;
-        h_kk_offset[i]     = h_kk_total;
-        v_kk_offset[i]     = v_kk_total;
-        h_kk_total += out_cols[i] * h_k_size;
-        v_kk_total += out_rows[i] * v_k_size;
-        h_bounds_offset[i] = h_bounds_total;
-        v_bounds_offset[i] = v_bounds_total;
-        h_bounds_total += out_cols[i] * 2;
-        v_bounds_total += out_rows[i] * 2;
-
-        if (h_k_size > max_h_k_size)
-            max_h_k_size = h_k_size;
-        if (v_k_size > max_v_k_size)
-            max_v_k_size = v_k_size;
+        Size2D in_size  = inDataBase[i].size();
+        Size2D out_size = outDataBase[i].size();
+
+        work_type h_filterscale = std::max<work_type>(static_cast<work_type>(in_size.w) / out_size.w, 1.0);
+        work_type v_scale       = static_cast<work_type>(in_size.h) / out_size.h;
+        work_type v_filterscale = std::max<work_type>(v_scale, 1.0);
+
+        int h_k_size = static_cast<int>(ceil(filterp.support() * h_filterscale)) * 2 + 1;
+        int v_k_size = static_cast<int>(ceil(filterp.support() * v_filterscale)) * 2 + 1;
+
+        max_h_k_size = std::max(max_h_k_size, h_k_size);
+        max_v_k_size = std::max(max_v_k_size, v_k_size);
+
+        // Input rows read by a tile of output rows in fused_pass_var_shape.
+        int fused_rows = static_cast<int>(ceil((BLOCK / 4 - 1) * v_scale)) + v_k_size + 1;
+        max_fused_rows = std::max(max_fused_rows, fused_rows);
     }
 
     const void **inputs_gpu              = (const void **)gpu_workspace;
@@ -436,11 +585,15 @@ void pillow_resize_var_shape(const IImageBatchVarShape &inDataBase, const IImage
     // buffer for storing results from horizontal pass
     void *hori_gpu_data = (void *)((char *)gpu_workspace + current_buffer_size);
 
-    checkCudaErrors(cudaMemcpyAsync((void *)gpu_workspace, (void *)cpu_workspace, current_buffer_size,
-                                    cudaMemcpyHostToDevice, stream));
-
     Ptr2dVarShapeNHWC<elem_type> src_ptr(inData);
     Ptr2dVarShapeNHWC<elem_type> dst_ptr(outData);
+
+    _computeParamsVarShape<<<divUp(batch, BLOCK * 2), BLOCK * 2, 0, stream>>>(
+        src_ptr, dst_ptr, filterp, rows_gpu, cols_gpu, out_rows_gpu, out_cols_gpu, roi_x_gpu, roi_y_gpu,
+        h_scale_batch_gpu, v_scale_batch_gpu, h_filterscale_batch_gpu, v_filterscale_batch_gpu, h_support_batch_gpu,
+        v_support_batch_gpu, h_k_size_batch_gpu, v_k_size_batch_gpu, h_bounds_offset_gpu, v_bounds_offset_gpu,
+        h_kk_offset_gpu, v_kk_offset_gpu, h_kk_stride, v_kk_stride, h_bounds_stride, v_bounds_stride);
+    checkKernelErrors();
     Ptr2dNHWC<work_type>         ptr_h_out(batch, max_input_height, max_width, channels, (work_type *)hori_gpu_data);
 
     dim3 blockSize(BLOCK, BLOCK / 4, 1);
@@ -487,6 +640,17 @@ void pillow_resize_var_shape(const IImageBatchVarShape &inDataBase, const IImage
         normalize_coeff, v_use_share_mem);
     checkKernelErrors();
     // checkCudaErrors(cudaStreamSynchronize(stream));
+    size_t fused_sm_size = max_fused_rows * blockSize.x * channels * sizeof(work_type);
+    if (fused_sm_size <= FUSED_SHARE_MEM_LIMIT)
+    {
+        fused_pass_var_shape<elem_type><<<gridSizeV, blockSize, fused_sm_size, stream>>>(
+            src_ptr, dst_ptr, h_k_size_batch_gpu, v_k_size_batch_gpu, h_bounds_batch_gpu, h_bounds_offset_gpu,
+            h_kk_batch_gpu, h_kk_offset_gpu, v_bounds_batch_gpu, v_bounds_offset_gpu, v_kk_batch_gpu, v_kk_offset_gpu,
+            init_buffer, round_up);
+        checkKernelErrors();
+        return;
+    }
+
     horizontal_pass_var_shape<elem_type, work_type, Filter><<<gridSizeH, blockSize, hv_sm_size1, stream>>>(
         src_ptr, ptr_h_out, filterp, h_k_size_batch_gpu, v_k_size_batch_gpu, h_bounds_batch_gpu, h_bounds_offset_gpu,
         h_kk_batch_gpu, h_kk_offset_gpu, v_bounds_batch_gpu, v_bounds_offset_gpu, v_kk_batch_gpu, v_kk_offset_gpu,
@@ -505,33 +669,33 @@ void pillow_resize_var_shape(const IImageBatchVarShape &inDataBase, const IImage
 
 template<typename Filter>
 void pillow_resize_filter_var_shape(const IImageBatchVarShape &inData, const IImageBatchVarShape &outData,
-                                    void *gpu_workspace, void *cpu_workspace, NVCVInterpolationType interpolation,
+                                    void *gpu_workspace, NVCVInterpolationType interpolation,
                                     cudaStream_t stream)
 {
     DataType data_type = helpers::GetLegacyDataType(inData.uniqueFormat());
     switch (data_type)
     {
     case kCV_8U:
-        pillow_resize_var_shape<Filter, unsigned char>(inData, outData, gpu_workspace, cpu_workspace, false, 0., false,
+        pillow_resize_var_shape<Filter, unsigned char>(inData, outData, gpu_workspace, false, 0., false,
                                                        stream);
         break;
     case kCV_8S:
-        pillow_resize_var_shape<Filter, signed char>(inData, outData, gpu_workspace, cpu_workspace, false, 0., true,
+        pillow_resize_var_shape<Filter, signed char>(inData, outData, gpu_workspace, false, 0., true,
                                                      stream);
         break;
     case kCV_16U:
-        pillow_resize_var_shape<Filter, std::uint16_t>(inData, outData, gpu_workspace, cpu_workspace, false, 0., false,
+        pillow_resize_var_shape<Filter, std::uint16_t>(inData, outData, gpu_workspace, false, 0., false,
                                                        stream);
         break;
     case kCV_16S:
-        pillow_resize_var_shape<Filter, std::int16_t>(inData, outData, gpu_workspace, cpu_workspace, false, 0., true,
+        pillow_resize_var_shape<Filter, std::int16_t>(inData, outData, gpu_workspace, false, 0., true,
                                                       stream);
         break;
     case kCV_32S:
-        pillow_resize_var_shape<Filter, int>(inData, outData, gpu_workspace, cpu_workspace, false, 0., true, stream);
+        pillow_resize_var_shape<Filter, int>(inData, outData, gpu_workspace, false, 0., true, stream);
         break;
     case kCV_32F:
-        pillow_resize_var_shape<Filter, float>(inData, outData, gpu_workspace, cpu_workspace, false, 0., false, stream);
+        pillow_resize_var_shape<Filter, float>(inData, outData, gpu_workspace, false, 0., false, stream);
         break;
     case kCV_64F:
     default:
@@ -543,31 +707,9 @@ PillowResizeVarShape::PillowResizeVarShape(DataShape max_input_shape, DataShape
                                            DataType max_data_type)
     : CudaBaseOp(max_input_shape, max_output_shape)
 {
-    int    max_support = 1; //3
-    size_t size        = std::ceil(
-               max_output_shape.H
-                   * (((1.0 * max_input_shape.H / max_output_shape.H + 1) * max_support * 2 + 1) * sizeof(work_type)
-               + 2 * sizeof(int))
-               + max_output_shape.W
-                     * (((1.0 * max_input_shape.W / max_output_shape.W + 1) * max_support * 2 + 1) * sizeof(work_type)
-                 + 2 * sizeof(int)));
-    size_t buffer_size = (sizeof(void *) * 3 + sizeof(int) * 12 + sizeof(work_type) * 6 + size) * max_input_shape.N;
-    buffer_size += max_input_shape.N * max_input_shape.C * max_input_shape.H * max_output_shape.W * sizeof(float);
-
-    NVCV_CHECK_LOG(cudaMalloc(&gpu_workspace, buffer_size));
+    size_t buffer_size = calBufferSize(max_input_shape, max_output_shape, max_data_type);
 
-    cpu_workspace = malloc(buffer_size);
-    if (!cpu_workspace)
-    {
-        LOG_ERROR("Memory allocation error of size: " << buffer_size);
-        throw std::runtime_error("Memory allocation error!");
-    }
-}
-
-PillowResizeVarShape::~PillowResizeVarShape()
-{
-    NVCV_CHECK_LOG(cudaFree(gpu_workspace));
-    free(cpu_workspace);
+    setGpuWorkspaceSize(buffer_size);
 }
 
 size_t PillowResizeVarShape::calBufferSize(DataShape max_input_shape, DataShape max_output_shape,
@@ -636,7 +778,7 @@ ErrorCode PillowResizeVarShape::infer(const nvcv::IImageBatchVarShape &inDataBas
     switch (interpolation)
     {
     case NVCV_INTERP_LINEAR:
-        pillow_resize_filter_var_shape<BilinearFilterVarShape>(inDataBase, outDataBase, gpu_workspace, cpu_workspace,
+        pillow_resize_filter_var_shape<BilinearFilterVarShape>(inDataBase, outDataBase, gpuWorkspace(stream).get(),
                                                                interpolation, stream);
         break;
     default:
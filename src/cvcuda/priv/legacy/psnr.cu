@@ -0,0 +1,162 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "QualityMetrics.cuh"
+#include "ReduceUtils.cuh"
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+using quality::ChannelSums;
+
+// Peak signal-to-noise ratio of a sum of count squared errors, infinite for equal images
+struct PSNRMetric
+{
+    float maxValue;
+
+    __device__ float operator()(float sumSquaredErrors, float count) const
+    {
+        return 10.f * log10f(maxValue * maxValue * count / sumSquaredErrors);
+    }
+};
+
+// blockIdx.x is the sample, whose rows are split among gridDim.y blocks, as in Reduce.
+template<typename T>
+__global__ void psnrKernel(TensorSegments<T> src1, TensorSegments<T> src2, nvcv::cuda::Tensor3DWrap<float> dst,
+                           ChannelSums<nvcv::cuda::NumElements<T>> *partials, PSNRMetric metric, int outChannels)
+{
+    constexpr int NC = nvcv::cuda::NumElements<T>;
+
+    const int sample = blockIdx.x;
+
+    ChannelSums<NC> v;
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
+    {
+        v.val[c] = 0.f;
+    }
+
+    for (int y = blockIdx.y * kReduceBlockH + threadIdx.y; y < src1.height; y += gridDim.y * kReduceBlockH)
+    {
+        const T *row1 = src1.row(sample, y);
+        const T *row2 = src2.row(sample, y);
+        for (int x = threadIdx.x; x < src1.width; x += kReduceBlockW)
+        {
+            const auto d = nvcv::cuda::StaticCast<float>(row1[x]) - nvcv::cuda::StaticCast<float>(row2[x]);
+#pragma unroll
+            for (int c = 0; c < NC; ++c)
+            {
+                const float e = nvcv::cuda::GetElement(d, c);
+                v.val[c] += e * e;
+            }
+        }
+    }
+
+    v = BlockReduce(v, quality::SumCombine<NC>());
+
+    quality::StoreBlockSums(v, partials, dst, metric, static_cast<float>(src1.height) * src1.width, outChannels);
+}
+
+template<typename T>
+void psnr(const TensorDataAccessStridedImagePlanar &inAccess1, const TensorDataAccessStridedImagePlanar &inAccess2,
+          const nvcv::ITensorDataStridedCuda &outData, int outChannels, float maxValue, void *workspace,
+          cudaStream_t stream)
+{
+    using Sums = ChannelSums<nvcv::cuda::NumElements<T>>;
+
+    TensorSegments<T> src1(inAccess1, false), src2(inAccess2, false);
+
+    auto dst = nvcv::cuda::CreateTensorWrapNHW<float>(outData);
+
+    const int  numSamples = inAccess1.numSamples();
+    const int  numBlocks  = NumReduceBlocks(numSamples, src1.height);
+    Sums      *partials   = static_cast<Sums *>(workspace);
+    PSNRMetric metric{maxValue};
+
+    dim3 block(kReduceBlockW, kReduceBlockH);
+    dim3 grid(numSamples, numBlocks);
+
+    psnrKernel<<<grid, block, 0, stream>>>(src1, src2, dst, partials, metric, outChannels);
+    checkKernelErrors();
+
+    quality::LaunchFinalScores(partials, numSamples, numBlocks, dst, metric,
+                               static_cast<float>(src1.height) * src1.width, outChannels, stream);
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t PSNR::calBufferSize()
+{
+    return quality::kWorkspaceSize;
+}
+
+ErrorCode PSNR::infer(const ITensorDataStridedCuda &inData1, const ITensorDataStridedCuda &inData2,
+                      const ITensorDataStridedCuda &outData, float maxValue, cudaStream_t stream)
+{
+    DataType  dtype;
+    int       channels, outChannels;
+    ErrorCode err = quality::CheckParams(inData1, inData2, outData, maxValue, 1, dtype, channels, outChannels);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    auto inAccess1 = TensorDataAccessStridedImagePlanar::Create(inData1);
+    auto inAccess2 = TensorDataAccessStridedImagePlanar::Create(inData2);
+    NVCV_ASSERT(inAccess1 && inAccess2);
+
+    if (inAccess1->numSamples() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const TensorDataAccessStridedImagePlanar &inAccess1,
+                           const TensorDataAccessStridedImagePlanar &inAccess2, const ITensorDataStridedCuda &outData,
+                           int outChannels, float maxValue, void *workspace, cudaStream_t stream);
+
+    static const func_t funcs[6][4] = {
+        { psnr<uchar>, 0 /*psnr<uchar2>*/,  psnr<uchar3>,  psnr<uchar4>},
+        {           0,                 0,              0,             0},
+        {psnr<ushort>, 0 /*psnr<ushort2>*/, psnr<ushort3>, psnr<ushort4>},
+        { psnr<short>, 0 /*psnr<short2>*/,  psnr<short3>,  psnr<short4>},
+        {           0,                 0,              0,             0},
+        { psnr<float>, 0 /*psnr<float2>*/,  psnr<float3>,  psnr<float4>}
+    };
+
+    const func_t func = funcs[dtype][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(*inAccess1, *inAccess2, outData, outChannels, maxValue > 0 ? maxValue : quality::DataTypeRange(dtype),
+         gpuWorkspace(stream).get(), stream);
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,501 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+#include <vector>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Side of the tile of the last level written by each launch that a block computes
+constexpr int kPyramidTile = 16;
+
+// Side of the region of the intermediate level that a block keeps in shared memory when it computes two levels.
+// Output pixel x of the last level reads 2x-2 .. 2x+2 of the intermediate level.
+constexpr int kPyramidMidTile = 2 * kPyramidTile + 3;
+
+// BORDER_REFLECT_101, e.g. -1 reads 1 and size reads size-2
+__device__ __forceinline__ int pyramidReflect(int x, int size)
+{
+    if (size == 1)
+    {
+        return 0;
+    }
+    const int period = 2 * size - 2;
+    x                = abs(x) % period;
+    return x < size ? x : period - x;
+}
+
+template<typename T>
+struct PyramidTensorSrc
+{
+    __device__ int2 size(int n) const
+    {
+        return imageSize;
+    }
+
+    __device__ const T *ptr(int n, int y, int x) const
+    {
+        return wrap.ptr(n, y, x);
+    }
+
+    nvcv::cuda::Tensor3DWrap<const T> wrap;
+    int2                              imageSize;
+};
+
+template<typename T>
+struct PyramidVarShapeSrc
+{
+    __device__ int2 size(int n) const
+    {
+        return {wrap.width(n), wrap.height(n)};
+    }
+
+    __device__ const T *ptr(int n, int y, int x) const
+    {
+        return wrap.ptr(n, y, x);
+    }
+
+    nvcv::cuda::ImageBatchVarShapeWrap<const T> wrap;
+};
+
+// Level of every sample of the output pyramid, images are stored sample by sample: n * numLevels + level
+template<typename T>
+struct PyramidLevelSrc
+{
+    __device__ int2 size(int n) const
+    {
+        return {wrap.width(n * numLevels + level), wrap.height(n * numLevels + level)};
+    }
+
+    __device__ const T *ptr(int n, int y, int x) const
+    {
+        return wrap.ptr(n * numLevels + level, y, x);
+    }
+
+    nvcv::cuda::ImageBatchVarShapeWrap<T> wrap;
+    int                                   numLevels;
+    int                                   level;
+};
+
+// 5x5 Gaussian [1 4 6 4 1]^2 / 256 centered on (cx, cy), with the rounding and the summation order of OpenCV's
+// pyrDown: integers are accumulated exactly and rounded half up.  at(x, y) returns the source pixel at (x, y).
+template<typename T, class At>
+__device__ T pyrDown5x5(const At &at, int cx, int cy)
+{
+    using BT = nvcv::cuda::BaseType<T>;
+    using WT = std::conditional_t<std::is_integral_v<BT>, int, float>;
+    using W  = nvcv::cuda::ConvertBaseTypeTo<WT, T>;
+
+    auto row = [&](int y)
+    {
+        auto p = [&](int dx)
+        {
+            return nvcv::cuda::StaticCast<WT>(at(cx + dx, y));
+        };
+        return p(0) * 6 + (p(-1) + p(1)) * 4 + p(-2) + p(2);
+    };
+
+    const W sum = row(cy) * 6 + (row(cy - 1) + row(cy + 1)) * 4 + row(cy - 2) + row(cy + 2);
+
+    if constexpr (std::is_integral_v<BT>)
+    {
+        return nvcv::cuda::SaturateCast<T>((sum + 128) >> 8);
+    }
+    else
+    {
+        return nvcv::cuda::SaturateCast<T>(sum * (1.f / 256));
+    }
+}
+
+// Pixel (x, y) of the level below the one of src
+template<typename T, class Src>
+__device__ T pyrDownPixel(const Src &src, int n, int x, int y)
+{
+    const int2 size = src.size(n);
+
+    return pyrDown5x5<T>([&](int sx, int sy)
+                         { return *src.ptr(n, pyramidReflect(sy, size.y), pyramidReflect(sx, size.x)); },
+                         2 * x, 2 * y);
+}
+
+// Computes level `level` of every sample from src, the level above it, and level + 1 too with TWO_LEVELS.  The
+// intermediate level is computed over the tile and its halo in shared memory, so the second level doesn't read
+// it back from global memory.  Each block stores the pixels of the intermediate level in its own footprint, the
+// halo is recomputed by the neighbours that own it.  With copySrc, src is the input and is also copied to level 0.
+template<bool TWO_LEVELS, typename T, class Src>
+__global__ void pyrDownKernel(const Src src, nvcv::cuda::ImageBatchVarShapeWrap<T> dst, int numLevels, int level,
+                              bool copySrc)
+{
+    const int n     = blockIdx.z;
+    const int tx    = threadIdx.x;
+    const int ty    = threadIdx.y;
+    const int bx    = blockIdx.x;
+    const int by    = blockIdx.y;
+    const int ox    = bx * kPyramidTile;
+    const int oy    = by * kPyramidTile;
+    const int first = n * numLevels + level;
+
+    if (copySrc)
+    {
+        constexpr int span = (TWO_LEVELS ? 4 : 2) * kPyramidTile;
+        const int2    size = src.size(n);
+        for (int y = by * span + ty; y < min(size.y, (by + 1) * span); y += kPyramidTile)
+        {
+            for (int x = bx * span + tx; x < min(size.x, (bx + 1) * span); x += kPyramidTile)
+            {
+                *dst.ptr(first - 1, y, x) = *src.ptr(n, y, x);
+            }
+        }
+    }
+
+    if (level >= numLevels)
+    {
+        return;
+    }
+
+    if constexpr (!TWO_LEVELS)
+    {
+        const int x = ox + tx;
+        const int y = oy + ty;
+        if (x < dst.width(first) && y < dst.height(first))
+        {
+            *dst.ptr(first, y, x) = pyrDownPixel<T>(src, n, x, y);
+        }
+    }
+    else
+    {
+        __shared__ T mid[kPyramidMidTile][kPyramidMidTile];
+
+        const int w1 = dst.width(first);
+        const int h1 = dst.height(first);
+        const int x1 = 2 * ox - 2;
+        const int y1 = 2 * oy - 2;
+
+        for (int i = ty * kPyramidTile + tx; i < kPyramidMidTile * kPyramidMidTile; i += kPyramidTile * kPyramidTile)
+        {
+            const int mx = x1 + i % kPyramidMidTile;
+            const int my = y1 + i / kPyramidMidTile;
+            const T   v  = pyrDownPixel<T>(src, n, pyramidReflect(mx, w1), pyramidReflect(my, h1));
+
+            mid[i / kPyramidMidTile][i % kPyramidMidTile] = v;
+
+            if (mx >= 2 * ox && mx < min(w1, 2 * (ox + kPyramidTile)) && my >= 2 * oy
+                && my < min(h1, 2 * (oy + kPyramidTile)))
+            {
+                *dst.ptr(first, my, mx) = v;
+            }
+        }
+        __syncthreads();
+
+        const int x = ox + tx;
+        const int y = oy + ty;
+        if (x < dst.width(first + 1) && y < dst.height(first + 1))
+        {
+            *dst.ptr(first + 1, y, x)
+                = pyrDown5x5<T>([&](int sx, int sy) { return mid[sy][sx]; }, 2 * tx + 2, 2 * ty + 2);
+        }
+    }
+}
+
+// Replaces Gaussian level `level` by its difference with the 2x upsampling of the level below, as in OpenCV's
+// pyrUp: even coordinates blend source pixels i-1, i, i+1 with weights 1, 6, 1, odd ones i, i+1 with 4, 4.
+template<typename T>
+__global__ void pyrLaplacianKernel(nvcv::cuda::ImageBatchVarShapeWrap<T> dst, int numLevels, int level)
+{
+    const int x   = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y   = blockIdx.y * blockDim.y + threadIdx.y;
+    const int idx = blockIdx.z * numLevels + level;
+
+    if (x >= dst.width(idx) || y >= dst.height(idx))
+    {
+        return;
+    }
+
+    const int lw = dst.width(idx + 1);
+    const int lh = dst.height(idx + 1);
+
+    const int   ix = x >> 1, iy = y >> 1;
+    const int   tapX[3] = {x & 1 ? ix : ix - 1, x & 1 ? ix + 1 : ix, ix + 1};
+    const int   tapY[3] = {y & 1 ? iy : iy - 1, y & 1 ? iy + 1 : iy, iy + 1};
+    const float wX[3]   = {x & 1 ? 4.f : 1.f, x & 1 ? 4.f : 6.f, x & 1 ? 0.f : 1.f};
+    const float wY[3]   = {y & 1 ? 4.f : 1.f, y & 1 ? 4.f : 6.f, y & 1 ? 0.f : 1.f};
+
+    T up{};
+#pragma unroll
+    for (int j = 0; j < 3; ++j)
+    {
+        T rowSum{};
+#pragma unroll
+        for (int i = 0; i < 3; ++i)
+        {
+            rowSum += wX[i] * *dst.ptr(idx + 1, pyramidReflect(tapY[j], lh), pyramidReflect(tapX[i], lw));
+        }
+        up += wY[j] * rowSum;
+    }
+
+    T *out = dst.ptr(idx, y, x);
+    *out   = *out - up * (1.f / 64);
+}
+
+template<typename T, class Src>
+void buildPyramidCaller(const Src &src, int numSamples, nvcv::Size2D maxSize,
+                        const nvcv::IImageBatchVarShapeDataStridedCuda &outData, int numLevels, NVCVPyramidType type,
+                        cudaStream_t stream)
+{
+    nvcv::cuda::ImageBatchVarShapeWrap<T> dst(outData);
+
+    // Sizes of the levels of the largest sample, that bound the grids, with an extra level for the copy-only launch
+    std::vector<int2> levelSizes(numLevels + 1);
+    levelSizes[0] = int2{maxSize.w, maxSize.h};
+    for (int l = 1; l <= numLevels; ++l)
+    {
+        levelSizes[l] = int2{(levelSizes[l - 1].x + 1) / 2, (levelSizes[l - 1].y + 1) / 2};
+    }
+
+    dim3 block(kPyramidTile, kPyramidTile);
+
+    // Level 0 is the input, copied by the first launch, and each launch computes up to two levels
+    auto launch = [&](const auto &levelSrc, int level, bool copySrc)
+    {
+        const bool two  = level + 1 < numLevels;
+        const int2 last = levelSizes[two ? level + 1 : level];
+        dim3       grid(divUp(last.x, kPyramidTile), divUp(last.y, kPyramidTile), numSamples);
+
+        if (two)
+        {
+            pyrDownKernel<true><<<grid, block, 0, stream>>>(levelSrc, dst, numLevels, level, copySrc);
+        }
+        else
+        {
+            pyrDownKernel<false><<<grid, block, 0, stream>>>(levelSrc, dst, numLevels, level, copySrc);
+        }
+        checkKernelErrors();
+        return two ? 2 : 1;
+    };
+
+    for (int level = 1 + launch(src, 1, true); level < numLevels;)
+    {
+        level += launch(PyramidLevelSrc<T>{dst, numLevels, level - 1}, level, false);
+    }
+
+    if (type == NVCV_PYRAMID_LAPLACIAN)
+    {
+        // Each level reads the Gaussian level below it, so levels are replaced from the top, one launch each
+        for (int level = 0; level + 1 < numLevels; ++level)
+        {
+            dim3 grid(divUp(levelSizes[level].x, block.x), divUp(levelSizes[level].y, block.y), numSamples);
+            pyrLaplacianKernel<<<grid, block, 0, stream>>>(dst, numLevels, level);
+            checkKernelErrors();
+        }
+    }
+}
+
+template<typename T>
+void buildPyramidTensor(const nvcv::ITensorDataStridedCuda               &inData,
+                        const nvcv::IImageBatchVarShapeDataStridedCuda &outData, int numLevels, NVCVPyramidType type,
+                        cudaStream_t stream)
+{
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    PyramidTensorSrc<T> src{nvcv::cuda::CreateTensorWrapNHW<const T>(inData),
+                            int2{inAccess->numCols(), inAccess->numRows()}};
+
+    buildPyramidCaller<T>(src, inAccess->numSamples(), nvcv::Size2D{inAccess->numCols(), inAccess->numRows()},
+                          outData, numLevels, type, stream);
+}
+
+template<typename T>
+void buildPyramidVarShape(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
+                          const nvcv::IImageBatchVarShapeDataStridedCuda &outData, int numLevels,
+                          NVCVPyramidType type, cudaStream_t stream)
+{
+    PyramidVarShapeSrc<T> src{nvcv::cuda::ImageBatchVarShapeWrap<const T>(inData)};
+
+    buildPyramidCaller<T>(src, inData.numImages(), inData.maxSize(), outData, numLevels, type, stream);
+}
+
+// Checks the parameters shared by tensor and varshape pyramids.
+ErrorCode checkPyramidParams(const nvcv::IImageBatchVarShapeDataStridedCuda &outData, int numSamples, int channels,
+                             DataType data_type, int numLevels, NVCVPyramidType type)
+{
+    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_16S || data_type == kCV_32F))
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (channels != 1 && channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (type != NVCV_PYRAMID_GAUSSIAN && type != NVCV_PYRAMID_LAPLACIAN)
+    {
+        LOG_ERROR("Invalid pyramid type " << type);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (type == NVCV_PYRAMID_LAPLACIAN && data_type != kCV_32F)
+    {
+        LOG_ERROR("Invalid DataType " << data_type << ", Laplacian pyramids hold signed differences in float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (numLevels < 1)
+    {
+        LOG_ERROR("Invalid number of levels " << numLevels << ", it must be at least 1");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (outData.numImages() != numSamples * numLevels)
+    {
+        LOG_ERROR("Invalid number of output images " << outData.numImages() << ", it must be " << numSamples
+                                                     << " samples times " << numLevels << " levels");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (!outData.uniqueFormat() || GetLegacyDataType(outData.uniqueFormat()) != data_type
+        || outData.uniqueFormat().numChannels() != channels)
+    {
+        LOG_ERROR("Images in the output varshape must all have the input data type and number of channels");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t BuildPyramid::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode BuildPyramid::infer(const ITensorDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
+                              int numLevels, NVCVPyramidType type, cudaStream_t stream)
+{
+    DataFormat format = GetLegacyDataFormat(inData.layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    if (!inAccess)
+    {
+        LOG_ERROR("Invalid input DataFormat");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    const int channels  = inAccess->numChannels();
+    DataType  data_type = GetLegacyDataType(inData.dtype());
+
+    ErrorCode err = checkPyramidParams(outData, inAccess->numSamples(), channels, data_type, numLevels, type);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    typedef void (*func_t)(const ITensorDataStridedCuda &inData, const IImageBatchVarShapeDataStridedCuda &outData,
+                           int numLevels, NVCVPyramidType type, cudaStream_t stream);
+
+    // clang-format off
+    static const func_t funcs[6][4] = {
+        {buildPyramidTensor<uchar>,  0, buildPyramidTensor<uchar3>,  buildPyramidTensor<uchar4> },
+        {0,                          0, 0,                           0                         },
+        {buildPyramidTensor<ushort>, 0, buildPyramidTensor<ushort3>, buildPyramidTensor<ushort4>},
+        {buildPyramidTensor<short>,  0, buildPyramidTensor<short3>,  buildPyramidTensor<short4> },
+        {0,                          0, 0,                           0                         },
+        {buildPyramidTensor<float>,  0, buildPyramidTensor<float3>,  buildPyramidTensor<float4> },
+    };
+    // clang-format on
+
+    const func_t func = funcs[data_type][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(inData, outData, numLevels, type, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode BuildPyramidVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                      const IImageBatchVarShapeDataStridedCuda &outData, int numLevels,
+                                      NVCVPyramidType type, cudaStream_t stream)
+{
+    DataFormat format = helpers::GetLegacyDataFormat(inData);
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!inData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input varshape must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    const int channels  = inData.uniqueFormat().numChannels();
+    DataType  data_type = helpers::GetLegacyDataType(inData.uniqueFormat());
+
+    ErrorCode err = checkPyramidParams(outData, inData.numImages(), channels, data_type, numLevels, type);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (inData.numImages() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData,
+                           const IImageBatchVarShapeDataStridedCuda &outData, int numLevels, NVCVPyramidType type,
+                           cudaStream_t stream);
+
+    // clang-format off
+    static const func_t funcs[6][4] = {
+        {buildPyramidVarShape<uchar>,  0, buildPyramidVarShape<uchar3>,  buildPyramidVarShape<uchar4> },
+        {0,                            0, 0,                             0                           },
+        {buildPyramidVarShape<ushort>, 0, buildPyramidVarShape<ushort3>, buildPyramidVarShape<ushort4>},
+        {buildPyramidVarShape<short>,  0, buildPyramidVarShape<short3>,  buildPyramidVarShape<short4> },
+        {0,                            0, 0,                             0                           },
+        {buildPyramidVarShape<float>,  0, buildPyramidVarShape<float3>,  buildPyramidVarShape<float4> },
+    };
+    // clang-format on
+
+    const func_t func = funcs[data_type][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(inData, outData, numLevels, type, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,501 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+#include <nvcv/cuda/Philox.hpp>
+
+#include <cmath>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace cuda = nvcv::cuda;
+
+namespace {
+
+#define BLOCK 256
+#define PI    3.1415926535897932384626433832795
+
+// Each thread draws the parameters of one sample from its own stream, so results don't depend on the launch.
+__device__ cuda::Philox SampleStream(uint64_t seed, int sample, uint32_t draw)
+{
+    return cuda::Philox(seed, sample, static_cast<uint64_t>(draw) << 32);
+}
+
+// Draws a box covering a fraction of the area of an image in [minArea, maxArea), with a log-uniform aspect
+// ratio, clipped to the image and placed uniformly inside it. Returns its corner and size.
+__device__ int4 DrawBox(cuda::Philox &rng, int2 size, float minArea, float maxArea, float logMinAspect,
+                        float logMaxAspect)
+{
+    const float area   = size.x * size.y * rng.uniform(minArea, maxArea);
+    const float aspect = expf(rng.uniform(logMinAspect, logMaxAspect));
+
+    const int w = min(max(__float2int_rn(sqrtf(area * aspect)), 1), size.x);
+    const int h = min(max(__float2int_rn(sqrtf(area / aspect)), 1), size.y);
+    const int x = min(__float2int_rd(rng.uniform() * (size.x - w + 1)), size.x - w);
+    const int y = min(__float2int_rd(rng.uniform() * (size.y - h + 1)), size.y - h);
+
+    return make_int4(x, y, w, h);
+}
+
+__global__ void random_flip_kernel(cuda::Tensor1DWrap<int> flipCode, int numSamples, float probHoriz,
+                                   float probVert, uint64_t seed, uint32_t draw)
+{
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= numSamples)
+        return;
+
+    cuda::Philox rng = SampleStream(seed, i, draw);
+
+    const bool horiz = rng.uniform() < probHoriz;
+    const bool vert  = rng.uniform() < probVert;
+
+    flipCode[i] = horiz && vert ? -1 : horiz ? 1 : vert ? 0 : 2;
+}
+
+template<typename T>
+__device__ T DrawUniform(cuda::Philox &rng, double low, double high);
+
+template<>
+__device__ float DrawUniform<float>(cuda::Philox &rng, double low, double high)
+{
+    return static_cast<float>(low + (high - low) * rng.uniform());
+}
+
+template<>
+__device__ double DrawUniform<double>(cuda::Philox &rng, double low, double high)
+{
+    return low + (high - low) * rng.uniformDouble();
+}
+
+template<typename T>
+__global__ void random_uniform_kernel(cuda::Tensor2DWrap<T> out, int numSamples, int numValues, double low,
+                                      double high, uint64_t seed, uint32_t draw)
+{
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= numSamples)
+        return;
+
+    cuda::Philox rng = SampleStream(seed, i, draw);
+
+    T *row = out.ptr(i, 0);
+    for (int k = 0; k < numValues; ++k)
+    {
+        row[k] = DrawUniform<T>(rng, low, high);
+    }
+}
+
+__global__ void random_rotate_kernel(cuda::ImageBatchVarShapeWrap<const uchar> in,
+                                     cuda::Tensor1DWrap<double> angleDeg, cuda::Tensor2DWrap<double> shift,
+                                     int numSamples, double minAngleDeg, double maxAngleDeg, uint64_t seed,
+                                     uint32_t draw)
+{
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= numSamples)
+        return;
+
+    cuda::Philox rng = SampleStream(seed, i, draw);
+
+    const double angle = minAngleDeg + (maxAngleDeg - minAngleDeg) * rng.uniformDouble();
+
+    // Rotate maps x to [cos sin; -sin cos] x + shift, which keeps the center in place with this shift.
+    const double cx = (in.width(i) - 1) / 2.0, cy = (in.height(i) - 1) / 2.0;
+    const double c = cos(angle * PI / 180), s = sin(angle * PI / 180);
+
+    angleDeg[i]      = angle;
+    *shift.ptr(i, 0) = (1 - c) * cx - s * cy;
+    *shift.ptr(i, 1) = s * cx + (1 - c) * cy;
+}
+
+__global__ void random_erase_kernel(cuda::ImageBatchVarShapeWrap<const uchar> in, cuda::Tensor1DWrap<int2> anchor,
+                                    cuda::Tensor1DWrap<int3> erasing, cuda::Tensor1DWrap<int> imgIdx,
+                                    int numSamples, float probability, float minArea, float maxArea,
+                                    float logMinAspect, float logMaxAspect, uint64_t seed, uint32_t draw)
+{
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= numSamples)
+        return;
+
+    cuda::Philox rng = SampleStream(seed, i, draw);
+
+    imgIdx[i] = i;
+    if (!(rng.uniform() < probability))
+    {
+        anchor[i]  = make_int2(0, 0);
+        erasing[i] = make_int3(0, 0, 0);
+        return;
+    }
+
+    const int4 box = DrawBox(rng, int2{in.width(i), in.height(i)}, minArea, maxArea, logMinAspect, logMaxAspect);
+
+    anchor[i]  = make_int2(box.x, box.y);
+    erasing[i] = make_int3(box.z, box.w, 0xF);
+}
+
+// Size of the input of each box, the same for all of them or the one of each image of a batch.
+struct FixedSize
+{
+    int2 size;
+
+    __device__ int2 operator()(int) const
+    {
+        return size;
+    }
+};
+
+struct ImageSize
+{
+    cuda::ImageBatchVarShapeWrap<const uchar> in;
+
+    __device__ int2 operator()(int i) const
+    {
+        return int2{in.width(i), in.height(i)};
+    }
+};
+
+template<class Sizes>
+__global__ void random_crop_kernel(cuda::Tensor2DWrap<float> boxes, int numSamples, Sizes sizes, float minScale,
+                                   float maxScale, float logMinAspect, float logMaxAspect, uint64_t seed,
+                                   uint32_t draw)
+{
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= numSamples)
+        return;
+
+    cuda::Philox rng = SampleStream(seed, i, draw);
+
+    const int4 box = DrawBox(rng, sizes(i), minScale, maxScale, logMinAspect, logMaxAspect);
+
+    float *row = boxes.ptr(i, 0);
+    row[0]     = box.x;
+    row[1]     = box.y;
+    row[2]     = box.x + box.z;
+    row[3]     = box.y + box.w;
+}
+
+ErrorCode checkProbability(float probability, const char *name)
+{
+    if (!(probability >= 0.f && probability <= 1.f))
+    {
+        LOG_ERROR("Invalid " << name << " probability " << probability << ", it must be in [0, 1]");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode checkBoxRanges(float minArea, float maxArea, float minAspect, float maxAspect)
+{
+    if (!(minArea > 0.f && minArea <= maxArea && maxArea <= 1.f))
+    {
+        LOG_ERROR("Invalid area range [" << minArea << ", " << maxArea << "], it must be within (0, 1]");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    if (!(minAspect > 0.f && minAspect <= maxAspect && std::isfinite(maxAspect)))
+    {
+        LOG_ERROR("Invalid aspect ratio range [" << minAspect << ", " << maxAspect << "], it must be positive");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+// Checks a 1D tensor of one value per sample.
+ErrorCode checkSamples(const ITensorDataStridedCuda &data, nvcv::DataType dtype, int numSamples, const char *name)
+{
+    if (data.dtype() != dtype)
+    {
+        LOG_ERROR("Invalid " << name << " DataType " << data.dtype() << ", it must be " << dtype);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    if (data.rank() != 1 || data.shape(0) != numSamples)
+    {
+        LOG_ERROR("Invalid " << name << " shape " << data.shape() << ", it must be [" << numSamples << "]");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+// Checks a 2D tensor of numValues packed values per sample, any number of samples if numSamples is negative.
+ErrorCode checkRows(const ITensorDataStridedCuda &data, nvcv::DataType dtype, int numSamples, int numValues,
+                    const char *name)
+{
+    if (data.dtype() != dtype)
+    {
+        LOG_ERROR("Invalid " << name << " DataType " << data.dtype() << ", it must be " << dtype);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    if (data.rank() != 2 || (numSamples >= 0 && data.shape(0) != numSamples) || data.shape(1) != numValues)
+    {
+        LOG_ERROR("Invalid " << name << " shape " << data.shape() << ", it must be [N, " << numValues << "]");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (data.stride(1) != dtype.strideBytes())
+    {
+        LOG_ERROR("Invalid " << name << " layout, the values of each sample must be packed");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+template<class Sizes>
+void randomCrop(const ITensorDataStridedCuda &boxData, Sizes sizes, float minScale, float maxScale, float minAspect,
+                float maxAspect, uint64_t seed, uint32_t draw, cudaStream_t stream)
+{
+    const int numSamples = boxData.shape(0);
+    if (numSamples == 0)
+    {
+        return;
+    }
+
+    cuda::Tensor2DWrap<float> boxes(boxData.basePtr(), static_cast<int>(boxData.stride(0)));
+
+    random_crop_kernel<<<divUp(numSamples, BLOCK), BLOCK, 0, stream>>>(
+        boxes, numSamples, sizes, minScale, maxScale, std::log(minAspect), std::log(maxAspect), seed, draw);
+    checkKernelErrors();
+}
+
+template<typename T>
+void randomUniform(const ITensorDataStridedCuda &outData, int numSamples, int numValues, double low, double high,
+                   uint64_t seed, uint32_t draw, cudaStream_t stream)
+{
+    cuda::Tensor2DWrap<T> out(outData.basePtr(), static_cast<int>(outData.stride(0)));
+
+    random_uniform_kernel<T><<<divUp(numSamples, BLOCK), BLOCK, 0, stream>>>(out, numSamples, numValues, low,
+                                                                             high, seed, draw);
+    checkKernelErrors();
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t RandomParams::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode RandomParams::inferFlip(const ITensorDataStridedCuda &flipCodeData, float probHoriz, float probVert,
+                                  uint64_t seed, uint32_t draw, cudaStream_t stream)
+{
+    for (auto [probability, name] : {std::make_pair(probHoriz, "horizontal flip"),
+                                     std::make_pair(probVert, "vertical flip")})
+    {
+        if (ErrorCode err = checkProbability(probability, name); err != ErrorCode::SUCCESS)
+        {
+            return err;
+        }
+    }
+    if (flipCodeData.rank() != 1)
+    {
+        LOG_ERROR("Invalid flipCode shape " << flipCodeData.shape() << ", it must be [N]");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const int numSamples = flipCodeData.shape(0);
+    if (ErrorCode err = checkSamples(flipCodeData, nvcv::TYPE_S32, numSamples, "flipCode"); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+    if (numSamples == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    cuda::Tensor1DWrap<int> flipCode(flipCodeData);
+
+    random_flip_kernel<<<divUp(numSamples, BLOCK), BLOCK, 0, stream>>>(flipCode, numSamples, probHoriz, probVert,
+                                                                       seed, draw);
+    checkKernelErrors();
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode RandomParams::inferUniform(const ITensorDataStridedCuda &outData, double low, double high, uint64_t seed,
+                                     uint32_t draw, cudaStream_t stream)
+{
+    if (!(low <= high && std::isfinite(low) && std::isfinite(high)))
+    {
+        LOG_ERROR("Invalid range [" << low << ", " << high << "], low must not be greater than high");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    if (outData.dtype() != nvcv::TYPE_F32 && outData.dtype() != nvcv::TYPE_F64)
+    {
+        LOG_ERROR("Invalid output DataType " << outData.dtype() << ", it must be float32 or float64");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    if (outData.rank() != 1 && outData.rank() != 2)
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must be [N] or [N, K]");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const int numSamples = outData.shape(0);
+    const int numValues  = outData.rank() == 2 ? outData.shape(1) : 1;
+    if (outData.rank() == 2)
+    {
+        if (ErrorCode err = checkRows(outData, outData.dtype(), numSamples, numValues, "output");
+            err != ErrorCode::SUCCESS)
+        {
+            return err;
+        }
+    }
+    if (numSamples == 0 || numValues == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    // Values of a 1D tensor are read as rows of one value, with the sample stride.
+    if (outData.dtype() == nvcv::TYPE_F32)
+    {
+        randomUniform<float>(outData, numSamples, numValues, low, high, seed, draw, stream);
+    }
+    else
+    {
+        randomUniform<double>(outData, numSamples, numValues, low, high, seed, draw, stream);
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode RandomParams::inferRotate(const IImageBatchVarShapeDataStridedCuda &inData,
+                                    const ITensorDataStridedCuda &angleData, const ITensorDataStridedCuda &shiftData,
+                                    double minAngleDeg, double maxAngleDeg, uint64_t seed, uint32_t draw,
+                                    cudaStream_t stream)
+{
+    if (!(minAngleDeg <= maxAngleDeg && std::isfinite(minAngleDeg) && std::isfinite(maxAngleDeg)))
+    {
+        LOG_ERROR("Invalid angle range [" << minAngleDeg << ", " << maxAngleDeg
+                                          << "], the smallest angle must not be greater than the largest");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    const int numSamples = inData.numImages();
+    if (ErrorCode err = checkSamples(angleData, nvcv::TYPE_F64, numSamples, "angleDeg"); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+    if (ErrorCode err = checkRows(shiftData, nvcv::TYPE_F64, numSamples, 2, "shift"); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+    if (numSamples == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    cuda::ImageBatchVarShapeWrap<const uchar> in(inData);
+    cuda::Tensor1DWrap<double>                angleDeg(angleData);
+    cuda::Tensor2DWrap<double>                shift(shiftData);
+
+    random_rotate_kernel<<<divUp(numSamples, BLOCK), BLOCK, 0, stream>>>(in, angleDeg, shift, numSamples,
+                                                                         minAngleDeg, maxAngleDeg, seed, draw);
+    checkKernelErrors();
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode RandomParams::inferErase(const IImageBatchVarShapeDataStridedCuda &inData,
+                                   const ITensorDataStridedCuda &anchorData, const ITensorDataStridedCuda &erasingData,
+                                   const ITensorDataStridedCuda &imgIdxData, float probability, float minArea,
+                                   float maxArea, float minAspect, float maxAspect, uint64_t seed, uint32_t draw,
+                                   cudaStream_t stream)
+{
+    if (ErrorCode err = checkProbability(probability, "erasing"); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+    if (ErrorCode err = checkBoxRanges(minArea, maxArea, minAspect, maxAspect); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    const int numSamples = inData.numImages();
+    for (auto [data, dtype, name] : {std::make_tuple(&anchorData, nvcv::TYPE_2S32, "anchor"),
+                                     std::make_tuple(&erasingData, nvcv::TYPE_3S32, "erasing"),
+                                     std::make_tuple(&imgIdxData, nvcv::TYPE_S32, "imgIdx")})
+    {
+        if (ErrorCode err = checkSamples(*data, dtype, numSamples, name); err != ErrorCode::SUCCESS)
+        {
+            return err;
+        }
+    }
+    if (numSamples == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    cuda::ImageBatchVarShapeWrap<const uchar> in(inData);
+    cuda::Tensor1DWrap<int2>                  anchor(anchorData);
+    cuda::Tensor1DWrap<int3>                  erasing(erasingData);
+    cuda::Tensor1DWrap<int>                   imgIdx(imgIdxData);
+
+    random_erase_kernel<<<divUp(numSamples, BLOCK), BLOCK, 0, stream>>>(
+        in, anchor, erasing, imgIdx, numSamples, probability, minArea, maxArea, std::log(minAspect),
+        std::log(maxAspect), seed, draw);
+    checkKernelErrors();
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode RandomParams::inferCrop(const ITensorDataStridedCuda &boxData, int2 size, float minScale, float maxScale,
+                                  float minAspect, float maxAspect, uint64_t seed, uint32_t draw,
+                                  cudaStream_t stream)
+{
+    if (size.x <= 0 || size.y <= 0)
+    {
+        LOG_ERROR("Invalid input size " << size.x << "x" << size.y << ", it must be positive");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    if (ErrorCode err = checkBoxRanges(minScale, maxScale, minAspect, maxAspect); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+    if (ErrorCode err = checkRows(boxData, nvcv::TYPE_F32, -1, 4, "boxes"); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    randomCrop(boxData, FixedSize{size}, minScale, maxScale, minAspect, maxAspect, seed, draw, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode RandomParams::inferCrop(const IImageBatchVarShapeDataStridedCuda &inData,
+                                  const ITensorDataStridedCuda &boxData, float minScale, float maxScale,
+                                  float minAspect, float maxAspect, uint64_t seed, uint32_t draw,
+                                  cudaStream_t stream)
+{
+    if (ErrorCode err = checkBoxRanges(minScale, maxScale, minAspect, maxAspect); err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+    if (ErrorCode err = checkRows(boxData, nvcv::TYPE_F32, inData.numImages(), 4, "boxes");
+        err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    randomCrop(boxData, ImageSize{cuda::ImageBatchVarShapeWrap<const uchar>(inData)}, minScale, maxScale, minAspect,
+               maxAspect, seed, draw, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,421 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "ReduceUtils.cuh"
+
+#include <cfloat>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+struct ReduceSumOp
+{
+    static constexpr float identity = 0.f;
+
+    __device__ float operator()(float a, float b) const
+    {
+        return a + b;
+    }
+};
+
+struct ReduceMinOp
+{
+    static constexpr float identity = FLT_MAX;
+
+    __device__ float operator()(float a, float b) const
+    {
+        return fminf(a, b);
+    }
+};
+
+struct ReduceMaxOp
+{
+    static constexpr float identity = -FLT_MAX;
+
+    __device__ float operator()(float a, float b) const
+    {
+        return fmaxf(a, b);
+    }
+};
+
+// Values of all channels reduced by a thread, a block or a segment
+template<int NC>
+struct ReduceValue
+{
+    float val[NC];
+};
+
+template<class Segments>
+using SegmentValue = ReduceValue<nvcv::cuda::NumElements<typename Segments::value_type>>;
+
+template<class Op, int NC>
+struct ReduceCombine
+{
+    __device__ ReduceValue<NC> operator()(ReduceValue<NC> a, const ReduceValue<NC> &b) const
+    {
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            a.val[c] = Op()(a.val[c], b.val[c]);
+        }
+        return a;
+    }
+};
+
+template<class Op, int NC, class Segments>
+__device__ void writeReduceResult(const ReduceValue<NC> &v, const Segments &src, int s,
+                                  nvcv::cuda::Tensor3DWrap<float> dst, int out_channels, bool mean)
+{
+    float *out   = dst.ptr(src.sample(s), 0, 0);
+    float  count = static_cast<float>(src.numRows(s)) * src.numCols(s);
+
+    if (out_channels == 1)
+    {
+        float res = v.val[0];
+#pragma unroll
+        for (int c = 1; c < NC; ++c)
+        {
+            res = Op()(res, v.val[c]);
+        }
+        out[0] = mean ? res / (count * NC) : res;
+    }
+    else
+    {
+        const int first = src.channel(s);
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            out[first + c] = mean ? v.val[c] / count : v.val[c];
+        }
+    }
+}
+
+// blockIdx.x is the segment, whose rows are split among gridDim.y blocks.  A single block writes the result
+// directly, otherwise each block writes its partial result for reduceFinalKernel.
+template<class Op, class Segments>
+__global__ void reduceKernel(Segments src, nvcv::cuda::Tensor3DWrap<float> dst, SegmentValue<Segments> *partials,
+                             int out_channels, bool mean)
+{
+    using T          = typename Segments::value_type;
+    constexpr int NC = nvcv::cuda::NumElements<T>;
+
+    const int segment = blockIdx.x;
+    const int rows    = src.numRows(segment);
+    const int cols    = src.numCols(segment);
+
+    ReduceValue<NC> v;
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
+    {
+        v.val[c] = Op::identity;
+    }
+
+    for (int y = blockIdx.y * kReduceBlockH + threadIdx.y; y < rows; y += gridDim.y * kReduceBlockH)
+    {
+        const T *row = src.row(segment, y);
+        for (int x = threadIdx.x; x < cols; x += kReduceBlockW)
+        {
+            const T p = row[x];
+#pragma unroll
+            for (int c = 0; c < NC; ++c)
+            {
+                v.val[c] = Op()(v.val[c], static_cast<float>(nvcv::cuda::GetElement(p, c)));
+            }
+        }
+    }
+
+    v = BlockReduce(v, ReduceCombine<Op, NC>());
+
+    if (get_lid() != 0)
+    {
+        return;
+    }
+
+    if (gridDim.y == 1)
+    {
+        writeReduceResult<Op>(v, src, segment, dst, out_channels, mean);
+    }
+    else
+    {
+        partials[segment * gridDim.y + blockIdx.y] = v;
+    }
+}
+
+// One warp per segment reduces the partial results of its blocks.
+template<class Op, class Segments>
+__global__ void reduceFinalKernel(Segments src, nvcv::cuda::Tensor3DWrap<float> dst,
+                                  const SegmentValue<Segments> *partials, int num_blocks, int out_channels, bool mean)
+{
+    constexpr int NC      = nvcv::cuda::NumElements<typename Segments::value_type>;
+    const int     segment = blockIdx.x;
+
+    SegmentValue<Segments> v = ReducePartials(partials + segment * num_blocks, num_blocks, ReduceCombine<Op, NC>());
+
+    if (threadIdx.x == 0)
+    {
+        writeReduceResult<Op>(v, src, segment, dst, out_channels, mean);
+    }
+}
+
+template<class Op, class Segments>
+void reduceCaller(const Segments &src, int num_segments, int max_rows, const nvcv::ITensorDataStridedCuda &outData,
+                  int out_channels, bool mean, void *workspace, cudaStream_t stream)
+{
+    using Value = SegmentValue<Segments>;
+
+    auto dst = nvcv::cuda::CreateTensorWrapNHW<float>(outData);
+
+    const int num_blocks = NumReduceBlocks(num_segments, max_rows);
+    Value    *partials   = static_cast<Value *>(workspace);
+
+    dim3 block(kReduceBlockW, kReduceBlockH);
+    dim3 grid(num_segments, num_blocks);
+
+    reduceKernel<Op><<<grid, block, 0, stream>>>(src, dst, partials, out_channels, mean);
+    checkKernelErrors();
+
+    if (num_blocks > 1)
+    {
+        reduceFinalKernel<Op><<<num_segments, 32, 0, stream>>>(src, dst, partials, num_blocks, out_channels, mean);
+        checkKernelErrors();
+    }
+}
+
+template<class Segments>
+void reduceOpCaller(const Segments &src, int num_segments, int max_rows, const nvcv::ITensorDataStridedCuda &outData,
+                    int out_channels, NVCVReduceOp op, void *workspace, cudaStream_t stream)
+{
+    switch (op)
+    {
+    case NVCV_REDUCE_SUM:
+    case NVCV_REDUCE_MEAN:
+        reduceCaller<ReduceSumOp>(src, num_segments, max_rows, outData, out_channels, op == NVCV_REDUCE_MEAN,
+                                  workspace, stream);
+        break;
+    case NVCV_REDUCE_MIN:
+        reduceCaller<ReduceMinOp>(src, num_segments, max_rows, outData, out_channels, false, workspace, stream);
+        break;
+    case NVCV_REDUCE_MAX:
+        reduceCaller<ReduceMaxOp>(src, num_segments, max_rows, outData, out_channels, false, workspace, stream);
+        break;
+    }
+}
+
+template<typename T>
+void reduceTensor(const nvcv::TensorDataAccessStridedImagePlanar &inAccess, const nvcv::ITensorDataStridedCuda &outData,
+                  int out_channels, NVCVReduceOp op, void *workspace, cudaStream_t stream)
+{
+    // Planes of planar tensors are reduced separately, unless all channels are reduced together
+    TensorSegments<T> src(inAccess, out_channels > 1);
+
+    reduceOpCaller(src, src.numSegments(inAccess.numSamples()), src.height * src.planesPerSegment, outData,
+                   out_channels, op, workspace, stream);
+}
+
+template<typename T>
+void reduceVarShape(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
+                    const nvcv::ITensorDataStridedCuda &outData, int out_channels, NVCVReduceOp op, void *workspace,
+                    cudaStream_t stream)
+{
+    VarShapeSegments<T> src(inData);
+
+    reduceOpCaller(src, inData.numImages(), inData.maxSize().h, outData, out_channels, op, workspace, stream);
+}
+
+// Checks the parameters shared by tensor and varshape reductions, and returns the number of output channels.
+ErrorCode checkReduceParams(const nvcv::ITensorDataStridedCuda &outData, int numSamples, int channels,
+                            DataType data_type, NVCVReduceOp op, int &out_channels)
+{
+    if (!(op == NVCV_REDUCE_SUM || op == NVCV_REDUCE_MEAN || op == NVCV_REDUCE_MIN || op == NVCV_REDUCE_MAX))
+    {
+        LOG_ERROR("Invalid reduce operation " << op);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (data_type == kCV_64F || data_type == kCV_16F)
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    DataFormat out_format = GetLegacyDataFormat(outData.layout());
+    if (!(out_format == kNHWC || out_format == kHWC))
+    {
+        LOG_ERROR("Invalid output DataFormat " << out_format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (GetLegacyDataType(outData.dtype()) != kCV_32F)
+    {
+        LOG_ERROR("Invalid output DataType " << outData.dtype() << ", it must be float");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    if (outAccess->numSamples() != numSamples || outAccess->numRows() != 1 || outAccess->numCols() != 1)
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must have " << numSamples
+                                          << " samples with width and height 1");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    out_channels = outAccess->numChannels();
+    if (out_channels != 1 && out_channels != channels)
+    {
+        LOG_ERROR("Invalid output channel number " << out_channels << ", it must be 1 or " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t Reduce::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    // Partial results of the blocks, one float per channel
+    return kMaxReduceBlocks * sizeof(ReduceValue<4>);
+}
+
+size_t ReduceVarShape::calBufferSize()
+{
+    return kMaxReduceBlocks * sizeof(ReduceValue<4>);
+}
+
+ErrorCode Reduce::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                        const NVCVReduceOp op, cudaStream_t stream)
+{
+    DataFormat format = GetLegacyDataFormat(inData.layout());
+    if (!(format == kNHWC || format == kHWC || format == kNCHW || format == kCHW))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    if (!inAccess)
+    {
+        LOG_ERROR("Invalid input DataFormat");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataType  data_type = GetLegacyDataType(inData.dtype());
+    const int channels  = inAccess->numChannels();
+    const int numPlanes = inAccess->numPlanes();
+
+    // Planar tensors are read one channel at a time, interleaved ones one pixel at a time
+    const int elem_channels = numPlanes > 1 ? 1 : channels;
+    if (elem_channels != 1 && elem_channels != 3 && elem_channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    int       out_channels = 0;
+    ErrorCode err = checkReduceParams(outData, inAccess->numSamples(), channels, data_type, op, out_channels);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    typedef void (*func_t)(const TensorDataAccessStridedImagePlanar &inAccess, const ITensorDataStridedCuda &outData,
+                           int out_channels, NVCVReduceOp op, void *workspace, cudaStream_t stream);
+
+    static const func_t funcs[6][4] = {
+        { reduceTensor<uchar>,  0 /*reduceTensor<uchar2>*/,  reduceTensor<uchar3>,  reduceTensor<uchar4>},
+        { reduceTensor<schar>,   0 /*reduceTensor<char2>*/,   reduceTensor<char3>,   reduceTensor<char4>},
+        {reduceTensor<ushort>, 0 /*reduceTensor<ushort2>*/, reduceTensor<ushort3>, reduceTensor<ushort4>},
+        { reduceTensor<short>,  0 /*reduceTensor<short2>*/,  reduceTensor<short3>,  reduceTensor<short4>},
+        {   reduceTensor<int>,    0 /*reduceTensor<int2>*/,    reduceTensor<int3>,    reduceTensor<int4>},
+        { reduceTensor<float>,  0 /*reduceTensor<float2>*/,  reduceTensor<float3>,  reduceTensor<float4>}
+    };
+
+    const func_t func = funcs[data_type][elem_channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(*inAccess, outData, out_channels, op, gpuWorkspace(stream).get(), stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode ReduceVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                const ITensorDataStridedCuda &outData, const NVCVReduceOp op, cudaStream_t stream)
+{
+    DataFormat format = helpers::GetLegacyDataFormat(inData);
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!inData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input varshape must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    const int channels = inData.uniqueFormat().numChannels();
+    if (channels != 1 && channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    DataType  data_type    = helpers::GetLegacyDataType(inData.uniqueFormat());
+    int       out_channels = 0;
+    ErrorCode err          = checkReduceParams(outData, inData.numImages(), channels, data_type, op, out_channels);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (inData.numImages() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                           int out_channels, NVCVReduceOp op, void *workspace, cudaStream_t stream);
+
+    static const func_t funcs[6][4] = {
+        { reduceVarShape<uchar>,  0 /*reduceVarShape<uchar2>*/,  reduceVarShape<uchar3>,  reduceVarShape<uchar4>},
+        { reduceVarShape<schar>,   0 /*reduceVarShape<char2>*/,   reduceVarShape<char3>,   reduceVarShape<char4>},
+        {reduceVarShape<ushort>, 0 /*reduceVarShape<ushort2>*/, reduceVarShape<ushort3>, reduceVarShape<ushort4>},
+        { reduceVarShape<short>,  0 /*reduceVarShape<short2>*/,  reduceVarShape<short3>,  reduceVarShape<short4>},
+        {   reduceVarShape<int>,    0 /*reduceVarShape<int2>*/,    reduceVarShape<int3>,    reduceVarShape<int4>},
+        { reduceVarShape<float>,  0 /*reduceVarShape<float2>*/,  reduceVarShape<float3>,  reduceVarShape<float4>}
+    };
+
+    const func_t func = funcs[data_type][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(inData, outData, out_channels, op, gpuWorkspace(stream).get(), stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
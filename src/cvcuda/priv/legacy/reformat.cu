@@ -21,18 +21,21 @@
 #include "CvCudaLegacy.h"
 #include "CvCudaLegacyHelpers.hpp"
 
+#include "ChannelOrder.cuh"
 #include "CvCudaUtils.cuh"
 
 #include <nvcv/IImage.hpp>
 #include <nvcv/IImageData.hpp>
+#include <nvcv/cuda/VectorizedAccess.hpp> // for LoadVector, etc.
 
 #include <cassert>
+#include <cstdlib>
 
 namespace cuda    = nvcv::cuda;
 namespace cuda_op = nvcv::legacy::cuda_op;
 
 template<cuda_op::DataFormat SrcFormat, class SrcWrapper, class DstWrapper>
-__global__ void transformFormat(const SrcWrapper src, DstWrapper dst, int3 inout_size)
+__global__ void transformFormat(const SrcWrapper src, DstWrapper dst, int3 inout_size, cuda_op::ChannelOrder order)
 {
     int3 thrCoord = cuda::StaticCast<int>(blockIdx * blockDim + threadIdx);
 
@@ -44,24 +47,26 @@ __global__ void transformFormat(const SrcWrapper src, DstWrapper dst, int3 inout
 
     for (int c = 0; c < inout_size.z; c++)
     {
+        const int sc = cuda_op::SourceChannel(order, c);
+
         if constexpr (SrcFormat == cuda_op::kNCHW)
         {
-            srcCoord = {thrCoord.x, thrCoord.y, c, thrCoord.z};
+            srcCoord = {thrCoord.x, thrCoord.y, sc, thrCoord.z};
             dstCoord = {c, thrCoord.x, thrCoord.y, thrCoord.z};
         }
         else if constexpr (SrcFormat == cuda_op::kNHWC)
         {
-            srcCoord = {c, thrCoord.x, thrCoord.y, thrCoord.z};
+            srcCoord = {sc, thrCoord.x, thrCoord.y, thrCoord.z};
             dstCoord = {thrCoord.x, thrCoord.y, c, thrCoord.z};
         }
         else if constexpr (SrcFormat == cuda_op::kCHW)
         {
-            srcCoord = {thrCoord.x, thrCoord.y, c};
+            srcCoord = {thrCoord.x, thrCoord.y, sc};
             dstCoord = {c, thrCoord.x, thrCoord.y};
         }
         else if constexpr (SrcFormat == cuda_op::kHWC)
         {
-            srcCoord = {c, thrCoord.x, thrCoord.y};
+            srcCoord = {sc, thrCoord.x, thrCoord.y};
             dstCoord = {thrCoord.x, thrCoord.y, c};
         }
 
@@ -71,7 +76,7 @@ __global__ void transformFormat(const SrcWrapper src, DstWrapper dst, int3 inout
 
 template<cuda_op::DataFormat input_format, typename data_type> // k(N)CHW k(N)HWC, uchar float
 void transform(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
-               cudaStream_t stream)
+               const cuda_op::ChannelOrder &order, cudaStream_t stream)
 {
     auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
     NVCV_ASSERT(inAccess);
@@ -87,7 +92,7 @@ void transform(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDa
     cuda::TensorNDWrap<const data_type, cuda_op::FormatDimensions<input_format>> src(inData);
     cuda::TensorNDWrap<data_type, cuda_op::FormatDimensions<input_format>>       dst(outData);
 
-    transformFormat<input_format><<<grid, block, 0, stream>>>(src, dst, inout_size);
+    transformFormat<input_format><<<grid, block, 0, stream>>>(src, dst, inout_size, order);
 
     checkKernelErrors();
 
@@ -97,6 +102,327 @@ void transform(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDa
 #endif
 }
 
+// NHWC <-> NCHW transposes of 3 or 4 channels go through shared memory tiles of kTileRows x kTileCols pixels, so
+// that both the interleaved and the planar side are accessed by consecutive threads at consecutive addresses.
+constexpr int kTileCols = 64;
+constexpr int kTileRows = 8;
+
+// Tile planes are padded so that the elements of an interleaved row written or read by a warp fall in different
+// shared memory banks, e.g. planes start 8 banks apart with 4 channels of 32-bit values.
+template<int C>
+constexpr int kTilePitch = kTileCols + (32 + C - 1) / C;
+
+// Elements per vectorized access of the interleaved rows of full tiles
+template<typename T>
+constexpr int kTileVector = cuda::kMaxVectorAccessBytes / sizeof(T);
+
+struct TileStrides
+{
+    int64_t sample, plane, row;
+};
+
+// Channels are reordered as tiles are moved to the output, plane c receiving tile channel order[c].
+template<typename T, int C>
+__global__ void interleavedToPlanar(const nvcv::Byte *src, TileStrides srcStrides, nvcv::Byte *dst,
+                                    TileStrides dstStrides, int2 size, bool vectorized, cuda_op::ChannelOrder order)
+{
+    constexpr int V = kTileVector<T>;
+    static_assert(kTileCols * C % V == 0, "tile rows must be made of whole vectors");
+
+    __shared__ T tile[kTileRows][C][kTilePitch<C>];
+
+    const int tx   = threadIdx.x;
+    const int ty   = threadIdx.y;
+    const int x0   = blockIdx.x * kTileCols;
+    const int y    = blockIdx.y * kTileRows + ty;
+    const int n    = blockIdx.z;
+    const int cols = min(kTileCols, size.x - x0);
+
+    if (y < size.y)
+    {
+        const T *row = reinterpret_cast<const T *>(src + n * srcStrides.sample + y * srcStrides.row) + x0 * C;
+
+        if (vectorized && cols == kTileCols)
+        {
+            for (int i = tx; i < kTileCols * C / V; i += kTileCols)
+            {
+                cuda::Vector<T, V> v = cuda::LoadVector<V>(row + i * V);
+#pragma unroll
+                for (int k = 0; k < V; ++k)
+                {
+                    const int e            = i * V + k;
+                    tile[ty][e % C][e / C] = v[k];
+                }
+            }
+        }
+        else
+        {
+            for (int e = tx; e < cols * C; e += kTileCols)
+            {
+                tile[ty][e % C][e / C] = row[e];
+            }
+        }
+    }
+    __syncthreads();
+
+    if (y < size.y && tx < cols)
+    {
+#pragma unroll
+        for (int c = 0; c < C; ++c)
+        {
+            T *plane = reinterpret_cast<T *>(dst + n * dstStrides.sample + c * dstStrides.plane + y * dstStrides.row);
+            plane[x0 + tx] = tile[ty][order.channel[c]][tx];
+        }
+    }
+}
+
+// Channels are reordered as planes are loaded, tile channel c receiving plane order[c].
+template<typename T, int C>
+__global__ void planarToInterleaved(const nvcv::Byte *src, TileStrides srcStrides, nvcv::Byte *dst,
+                                    TileStrides dstStrides, int2 size, bool vectorized, cuda_op::ChannelOrder order)
+{
+    constexpr int V = kTileVector<T>;
+    static_assert(kTileCols * C % V == 0, "tile rows must be made of whole vectors");
+
+    __shared__ T tile[kTileRows][C][kTilePitch<C>];
+
+    const int tx   = threadIdx.x;
+    const int ty   = threadIdx.y;
+    const int x0   = blockIdx.x * kTileCols;
+    const int y    = blockIdx.y * kTileRows + ty;
+    const int n    = blockIdx.z;
+    const int cols = min(kTileCols, size.x - x0);
+
+    if (y < size.y && tx < cols)
+    {
+#pragma unroll
+        for (int c = 0; c < C; ++c)
+        {
+            const T *plane = reinterpret_cast<const T *>(src + n * srcStrides.sample
+                                                         + order.channel[c] * srcStrides.plane + y * srcStrides.row);
+            tile[ty][c][tx] = plane[x0 + tx];
+        }
+    }
+    __syncthreads();
+
+    if (y < size.y)
+    {
+        T *row = reinterpret_cast<T *>(dst + n * dstStrides.sample + y * dstStrides.row) + x0 * C;
+
+        if (vectorized && cols == kTileCols)
+        {
+            for (int i = tx; i < kTileCols * C / V; i += kTileCols)
+            {
+                cuda::Vector<T, V> v;
+#pragma unroll
+                for (int k = 0; k < V; ++k)
+                {
+                    const int e = i * V + k;
+                    v[k]        = tile[ty][e % C][e / C];
+                }
+                cuda::StoreVector(row + i * V, v);
+            }
+        }
+        else
+        {
+            for (int e = tx; e < cols * C; e += kTileCols)
+            {
+                row[e] = tile[ty][e % C][e / C];
+            }
+        }
+    }
+}
+
+template<cuda_op::DataFormat input_format, typename T, int C> // k(N)CHW k(N)HWC, uchar float, 3 or 4 channels
+void transposeTiled(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
+                    const cuda_op::ChannelOrder &order, cudaStream_t stream)
+{
+    constexpr bool kFromInterleaved = input_format == cuda_op::kNHWC || input_format == cuda_op::kHWC;
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    auto strides = [](const nvcv::TensorDataAccessStridedImagePlanar &access)
+    {
+        return TileStrides{access.sampleStride(), access.numPlanes() > 1 ? access.planeStride() : 0,
+                           access.rowStride()};
+    };
+
+    // Rows of full tiles are moved with vectors when the interleaved side is suitably aligned
+    const bool vectorized = cuda::IsVectorAligned<T, kTileVector<T>>(kFromInterleaved ? inData : outData, C);
+
+    const int2 size = {inAccess->numCols(), inAccess->numRows()};
+
+    dim3 block(kTileCols, kTileRows);
+    dim3 grid(cuda_op::divUp(size.x, kTileCols), cuda_op::divUp(size.y, kTileRows), inAccess->numSamples());
+
+    if constexpr (kFromInterleaved)
+    {
+        interleavedToPlanar<T, C><<<grid, block, 0, stream>>>(inData.basePtr(), strides(*inAccess), outData.basePtr(),
+                                                              strides(*outAccess), size, vectorized, order);
+    }
+    else
+    {
+        planarToInterleaved<T, C><<<grid, block, 0, stream>>>(inData.basePtr(), strides(*inAccess), outData.basePtr(),
+                                                              strides(*outAccess), size, vectorized, order);
+    }
+
+    checkKernelErrors();
+}
+
+// Addressing of the elements of a sample by channel, with channel c stored at (c / block, c % block).  Interleaved
+// layouts have a single block of all channels, planar layouts blocks of one channel, and NCHWc, i.e. NC/xHWx
+// layouts such as NC4HW4, blocks of x channels.
+struct BlockedStrides
+{
+    int64_t sample, outer, row, col, inner;
+    int     block;
+
+    __host__ __device__ int64_t offset(int n, int y, int x, int c) const
+    {
+        return n * sample + (c / block) * outer + y * row + x * col + (c % block) * inner;
+    }
+};
+
+// Returns the addressing of a tensor in one of the supported layouts, and its number of channels, including the
+// padding channels of the last block of blocked layouts.
+BlockedStrides GetBlockedStrides(const nvcv::ITensorDataStridedCuda &data, int &channels)
+{
+    const nvcv::TensorLayout &layout = data.layout();
+
+    const int iN = layout.find('N');
+    const int iC = layout.find('C');
+    const int iH = layout.find('H');
+    const int iW = layout.find('W');
+    const int ic = layout.find('c');
+    NVCV_ASSERT(iC >= 0 && iH >= 0 && iW >= 0);
+
+    BlockedStrides strides;
+    strides.sample = iN >= 0 ? data.stride(iN) : 0;
+    strides.row    = data.stride(iH);
+    strides.col    = data.stride(iW);
+
+    if (ic >= 0)
+    {
+        strides.outer = data.stride(iC);
+        strides.inner = data.stride(ic);
+        strides.block = data.shape(ic);
+        channels      = data.shape(iC) * data.shape(ic);
+    }
+    else if (iC == layout.rank() - 1)
+    {
+        strides.outer = 0;
+        strides.inner = data.stride(iC);
+        strides.block = data.shape(iC);
+        channels      = data.shape(iC);
+    }
+    else
+    {
+        strides.outer = data.stride(iC);
+        strides.inner = 0;
+        strides.block = 1;
+        channels      = data.shape(iC);
+    }
+    return strides;
+}
+
+// Each thread moves all the channels of a pixel, padding channels of blocked outputs are set to zero.
+template<typename T>
+__global__ void transformBlockedKernel(const nvcv::Byte *src, BlockedStrides srcStrides, int srcChannels,
+                                       nvcv::Byte *dst, BlockedStrides dstStrides, int dstChannels, int2 size,
+                                       cuda_op::ChannelOrder order)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+    const int n = blockIdx.z;
+
+    if (x >= size.x || y >= size.y)
+        return;
+
+    for (int c = 0; c < dstChannels; ++c)
+    {
+        const int sc    = cuda_op::SourceChannel(order, c);
+        T         value = c < srcChannels ? *reinterpret_cast<const T *>(src + srcStrides.offset(n, y, x, sc)) : T{};
+        *reinterpret_cast<T *>(dst + dstStrides.offset(n, y, x, c)) = value;
+    }
+}
+
+template<typename T>
+void transformBlocked(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
+                      const cuda_op::ChannelOrder &order, cudaStream_t stream)
+{
+    int                  srcChannels, dstChannels;
+    const BlockedStrides srcStrides = GetBlockedStrides(inData, srcChannels);
+    const BlockedStrides dstStrides = GetBlockedStrides(outData, dstChannels);
+
+    const nvcv::TensorLayout &layout = inData.layout();
+
+    const int  iN         = layout.find('N');
+    const int  numSamples = iN >= 0 ? inData.shape(iN) : 1;
+    const int2 size       = {static_cast<int>(inData.shape(layout.find('W'))),
+                             static_cast<int>(inData.shape(layout.find('H')))};
+
+    dim3 block(32, 8);
+    dim3 grid(cuda_op::divUp(size.x, block.x), cuda_op::divUp(size.y, block.y), numSamples);
+
+    transformBlockedKernel<T><<<grid, block, 0, stream>>>(inData.basePtr(), srcStrides, srcChannels,
+                                                          outData.basePtr(), dstStrides, dstChannels, size, order);
+    checkKernelErrors();
+}
+
+// Checks a reformat from or to a blocked layout: samples, rows and columns must match, and channel counts may only
+// differ by the padding of the last channel block.
+cuda_op::ErrorCode checkBlocked(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData)
+{
+    for (const nvcv::ITensorDataStridedCuda *data : {&inData, &outData})
+    {
+        const nvcv::TensorLayout &layout = data->layout();
+        if (layout != nvcv::TENSOR_NCHWc && layout != nvcv::TENSOR_NCHW && layout != nvcv::TENSOR_NHWC)
+        {
+            LOG_ERROR("Invalid layout " << layout << ", blocked reformats are between NCHWc, NCHW and NHWC");
+            return cuda_op::ErrorCode::INVALID_DATA_FORMAT;
+        }
+    }
+
+    if (inData.dtype() != outData.dtype())
+    {
+        LOG_ERROR("Input and output data types must be the same");
+        return cuda_op::ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto dim = [](const nvcv::ITensorDataStridedCuda &data, char label)
+    {
+        return data.shape(data.layout().find(label));
+    };
+
+    if (dim(inData, 'N') != dim(outData, 'N') || dim(inData, 'H') != dim(outData, 'H')
+        || dim(inData, 'W') != dim(outData, 'W'))
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << " for input shape " << inData.shape());
+        return cuda_op::ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    int                  inChannels, outChannels;
+    const BlockedStrides inStrides  = GetBlockedStrides(inData, inChannels);
+    const BlockedStrides outStrides = GetBlockedStrides(outData, outChannels);
+
+    const bool inPadded  = inData.layout() == nvcv::TENSOR_NCHWc;
+    const bool outPadded = outData.layout() == nvcv::TENSOR_NCHWc;
+
+    const int padding = inChannels > outChannels ? (inPadded ? inStrides.block : 1)
+                                                 : (outPadded ? outStrides.block : 1);
+    if (std::abs(inChannels - outChannels) >= padding)
+    {
+        LOG_ERROR("Invalid channel numbers, input has " << inChannels << " and output " << outChannels);
+        return cuda_op::ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    return cuda_op::ErrorCode::SUCCESS;
+}
+
 namespace nvcv::legacy::cuda_op {
 
 void Reformat::checkDataFormat(DataFormat format)
@@ -109,40 +435,101 @@ size_t Reformat::calBufferSize(DataShape max_input_shape, DataShape max_output_s
     return 0;
 }
 
+void Reformat::copy(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, cudaStream_t stream)
+{
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    for (uint32_t i = 0; i < inAccess->numSamples(); ++i)
+    {
+        nvcv::Byte *inSampData  = inAccess->sampleData(i);
+        nvcv::Byte *outSampData = outAccess->sampleData(i);
+
+        for (int p = 0; p < inAccess->numPlanes(); ++p)
+        {
+            checkCudaErrors(cudaMemcpy2DAsync(outAccess->planeData(p, outSampData), outAccess->rowStride(),
+                                              inAccess->planeData(p, inSampData), inAccess->rowStride(),
+                                              inAccess->numCols() * inAccess->colStride(), inAccess->numRows(),
+                                              cudaMemcpyDeviceToDevice, stream));
+        }
+    }
+}
+
+// Blocked layouts only move values, half-precision ones as 16-bit unsigned integers.  Same-layout copies that
+// reorder channels go through them too.
+using blocked_t = void (*)(const ITensorDataStridedCuda &, const ITensorDataStridedCuda &, const ChannelOrder &,
+                           cudaStream_t);
+
+static const blocked_t blocked_funcs[8]
+    = {transformBlocked<uchar>, transformBlocked<schar>, transformBlocked<ushort>, transformBlocked<short>,
+       transformBlocked<int>,   transformBlocked<float>, transformBlocked<double>, transformBlocked<ushort>};
+
+void Reformat::copy(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                    const ChannelOrder &order, cudaStream_t stream)
+{
+    if (!order.isIdentity())
+    {
+        blocked_funcs[helpers::GetLegacyDataType(inData.dtype())](inData, outData, order, stream);
+        return;
+    }
+
+    copy(inData, outData, stream);
+}
+
 ErrorCode Reformat::infer(const nvcv::ITensorDataStridedCuda &inData, const nvcv::ITensorDataStridedCuda &outData,
-                          cudaStream_t stream)
+                          const ChannelOrder &order, cudaStream_t stream)
 {
+    LaunchPlanKey key;
+    key.add(inData).add(outData);
+
+    transform_t func;
+    if (m_plans.find(key, func))
+    {
+        if (func == nullptr)
+        {
+            copy(inData, outData, order, stream);
+        }
+        else
+        {
+            func(inData, outData, order, stream);
+        }
+        return SUCCESS;
+    }
+
+    DataType data_type = helpers::GetLegacyDataType(inData.dtype());
+
+    if (inData.layout() == TENSOR_NCHWc || outData.layout() == TENSOR_NCHWc)
+    {
+        ErrorCode err = checkBlocked(inData, outData);
+        if (err != ErrorCode::SUCCESS)
+        {
+            return err;
+        }
+
+        func = blocked_funcs[data_type];
+
+        m_plans.insert(key, func);
+        func(inData, outData, order, stream);
+        return SUCCESS;
+    }
+
     DataFormat input_format  = helpers::GetLegacyDataFormat(inData.layout());
     DataFormat output_format = helpers::GetLegacyDataFormat(outData.layout());
 
     checkDataFormat(input_format);
     checkDataFormat(output_format);
 
-    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
-    NVCV_ASSERT(inAccess);
-
-    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(outData);
-    NVCV_ASSERT(outAccess);
-
     if (inData.dtype() == outData.dtype() && inData.shape() == outData.shape())
     {
 #ifdef CUDA_DEBUG_LOG
         LOG_ERROR("input_format == output_format, copy outputs from inputs");
 #endif
 
-        for (uint32_t i = 0; i < inAccess->numSamples(); ++i)
-        {
-            nvcv::Byte *inSampData  = inAccess->sampleData(i);
-            nvcv::Byte *outSampData = outAccess->sampleData(i);
-
-            for (int p = 0; p < inAccess->numPlanes(); ++p)
-            {
-                checkCudaErrors(cudaMemcpy2DAsync(outAccess->planeData(p, outSampData), outAccess->rowStride(),
-                                                  inAccess->planeData(p, inSampData), inAccess->rowStride(),
-                                                  inAccess->numCols() * inAccess->colStride(), inAccess->numRows(),
-                                                  cudaMemcpyDeviceToDevice, stream));
-            }
-        }
+        m_plans.insert(key, nullptr);
+        copy(inData, outData, order, stream);
         return SUCCESS;
     }
 
@@ -156,31 +543,53 @@ ErrorCode Reformat::infer(const nvcv::ITensorDataStridedCuda &inData, const nvcv
         return ErrorCode::INVALID_DATA_FORMAT;
     }
 
-    DataType data_type = helpers::GetLegacyDataType(inData.dtype());
-
     if (!(data_type == kCV_8U || data_type == kCV_8S || data_type == kCV_16U || data_type == kCV_16S
-          || data_type == kCV_32S || data_type == kCV_32F || data_type == kCV_64F))
+          || data_type == kCV_32S || data_type == kCV_32F || data_type == kCV_64F || data_type == kCV_16F))
     {
         LOG_ERROR("Invalid DataType " << data_type);
         return ErrorCode::INVALID_DATA_TYPE;
     }
 
-    typedef void (*transform_t)(const ITensorDataStridedCuda &input, const ITensorDataStridedCuda &output,
-                                cudaStream_t stream);
-
-    static const transform_t funcs[4][7] = {
+    // Reformat only moves values, half-precision ones are moved as 16-bit unsigned integers
+    static const transform_t funcs[4][8] = {
         {transform<kNCHW, uchar>, transform<kNCHW, schar>, transform<kNCHW, ushort>, transform<kNCHW, short>,
-         transform<kNCHW, int>, transform<kNCHW, float>, transform<kNCHW, double>},
+         transform<kNCHW, int>, transform<kNCHW, float>, transform<kNCHW, double>, transform<kNCHW, ushort>},
         {transform<kNHWC, uchar>, transform<kNHWC, schar>, transform<kNHWC, ushort>, transform<kNHWC, short>,
-         transform<kNHWC, int>, transform<kNHWC, float>, transform<kNHWC, double>},
+         transform<kNHWC, int>, transform<kNHWC, float>, transform<kNHWC, double>, transform<kNHWC, ushort>},
         { transform<kCHW, uchar>,  transform<kCHW, schar>,  transform<kCHW, ushort>,  transform<kCHW, short>,
-         transform<kCHW, int>,  transform<kCHW, float>,  transform<kCHW, double> },
+         transform<kCHW, int>,  transform<kCHW, float>,  transform<kCHW, double>,  transform<kCHW, ushort> },
         { transform<kHWC, uchar>,  transform<kHWC, schar>,  transform<kHWC, ushort>,  transform<kHWC, short>,
-         transform<kHWC, int>,  transform<kHWC, float>,  transform<kHWC, double> }
+         transform<kHWC, int>,  transform<kHWC, float>,  transform<kHWC, double>,  transform<kHWC, ushort> }
+    };
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    const int channels = inAccess->numChannels();
+
+    // 8-bit and float transposes of 3 or 4 channels go through shared memory tiles
+    static const transform_t tiled_funcs[4][2][2] = {
+        {{transposeTiled<kNCHW, uchar, 3>, transposeTiled<kNCHW, uchar, 4>},
+         {transposeTiled<kNCHW, float, 3>, transposeTiled<kNCHW, float, 4>}},
+        {{transposeTiled<kNHWC, uchar, 3>, transposeTiled<kNHWC, uchar, 4>},
+         {transposeTiled<kNHWC, float, 3>, transposeTiled<kNHWC, float, 4>}},
+        {{ transposeTiled<kCHW, uchar, 3>,  transposeTiled<kCHW, uchar, 4>},
+         { transposeTiled<kCHW, float, 3>,  transposeTiled<kCHW, float, 4>}},
+        {{ transposeTiled<kHWC, uchar, 3>,  transposeTiled<kHWC, uchar, 4>},
+         { transposeTiled<kHWC, float, 3>,  transposeTiled<kHWC, float, 4>}}
     };
 
-    transform_t func = funcs[input_format][data_type];
-    func(inData, outData, stream);
+    if ((channels == 3 || channels == 4) && (data_type == kCV_8U || data_type == kCV_32F))
+    {
+        func = tiled_funcs[input_format][data_type == kCV_32F][channels - 3];
+    }
+    else
+    {
+        func = funcs[input_format][data_type];
+    }
+
+    m_plans.insert(key, func);
+    func(inData, outData, order, stream);
 
     return SUCCESS;
 }
@@ -0,0 +1,481 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+#include <type_traits>
+
+#define BLOCK 32
+// output pixels computed by each thread, blockDim.x apart to keep the accesses of a warp coalesced
+#define PIXELS_PER_THREAD 4
+
+// fixed-point maps store the fractional part of the coordinates in 1/32 of pixel, as OpenCV's INTER_BITS
+#define REMAP_FRAC_BITS 5
+#define REMAP_FRAC_MASK ((1 << REMAP_FRAC_BITS) - 1)
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+using namespace nvcv::cuda;
+
+namespace nvcv::legacy::cuda_op {
+
+namespace {
+
+// Map readers return the map value at an output pixel as float coordinates (or offsets).
+struct RemapFloatMap
+{
+    cuda::Tensor3DWrap<const float2> map;
+
+    __device__ __forceinline__ float2 operator()(int b, int y, int x) const
+    {
+        return *map.ptr(b, y, x);
+    }
+};
+
+// Compact map, [x, y, frac] as int16, i.e. 6 bytes per pixel instead of 8 for float maps.
+struct RemapFixedMap
+{
+    cuda::Tensor3DWrap<const short3> map;
+
+    __device__ __forceinline__ float2 operator()(int b, int y, int x) const
+    {
+        constexpr float scale = 1.f / (1 << REMAP_FRAC_BITS);
+
+        const short3 m = *map.ptr(b, y, x);
+        return make_float2(m.x + (m.z & REMAP_FRAC_MASK) * scale,
+                           m.y + ((m.z >> REMAP_FRAC_BITS) & REMAP_FRAC_MASK) * scale);
+    }
+};
+
+// Src and Dst are either Ptr2dNHWC or Ptr2dVarShapeNHWC. Maps with a single sample are used by every sample, so
+// a map shared by a whole batch is read from DRAM about once and mostly served from L2 afterwards.
+template<bool Round, class Map, class Filter, class Dst>
+__global__ void remap(const Filter src, Dst dst, const Map map, const int mapSamples, const bool relative)
+{
+    const int x0        = blockDim.x * blockIdx.x * PIXELS_PER_THREAD + threadIdx.x;
+    const int y         = blockDim.y * blockIdx.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+    const int map_idx   = mapSamples == 1 ? 0 : batch_idx;
+
+    if (y >= dst.at_rows(batch_idx))
+    {
+        return;
+    }
+
+#pragma unroll
+    for (int i = 0; i < PIXELS_PER_THREAD; ++i)
+    {
+        const int x = x0 + i * blockDim.x;
+        if (x < dst.at_cols(batch_idx))
+        {
+            float2 coord = map(map_idx, y, x);
+            if (relative)
+            {
+                coord.x += x;
+                coord.y += y;
+            }
+            if constexpr (Round)
+            {
+                // PointFilter truncates, nearest neighbor must pick the closest pixel, also for negative coordinates
+                coord.x = floorf(coord.x + 0.5f);
+                coord.y = floorf(coord.y + 0.5f);
+            }
+
+            using T                   = typename Dst::value_type;
+            *dst.ptr(batch_idx, y, x) = nvcv::cuda::SaturateCast<T>(src(batch_idx, coord.y, coord.x));
+        }
+    }
+}
+
+template<class Map, template<typename> class Filter, template<typename> class B, class Src, class Dst>
+struct RemapDispatcher
+{
+    static void call(const Src src, Dst dst, const Map map, const int mapSamples, const bool relative,
+                     const int max_height, const int max_width, const float4 borderValue, cudaStream_t stream)
+    {
+        using T         = typename Src::value_type;
+        using work_type = nvcv::cuda::ConvertBaseTypeTo<float, T>;
+        using Reader    = BorderReader<Src, B<work_type>>;
+
+        constexpr bool round = std::is_same_v<Filter<Reader>, PointFilter<Reader>>;
+
+        dim3 block(BLOCK, BLOCK / 4);
+        dim3 grid(divUp(max_width, block.x * PIXELS_PER_THREAD), divUp(max_height, block.y), src.batches);
+
+        work_type      borderVal = nvcv::cuda::DropCast<NumComponents<T>>(borderValue);
+        B<work_type>   brd(0, 0, borderVal);
+        Reader         brdSrc(src, brd);
+        Filter<Reader> filter_src(brdSrc);
+
+        remap<round><<<grid, block, 0, stream>>>(filter_src, dst, map, mapSamples, relative);
+        checkKernelErrors();
+    }
+};
+
+template<class Map, class Src, class Dst>
+void remap_caller(const Src src, Dst dst, const Map map, const int mapSamples, const bool relative,
+                  const int max_height, const int max_width, const int interpolation, const int borderMode,
+                  const float4 borderValue, cudaStream_t stream)
+{
+    typedef void (*func_t)(const Src src, Dst dst, const Map map, const int mapSamples, const bool relative,
+                           const int max_height, const int max_width, const float4 borderValue, cudaStream_t stream);
+
+    static const func_t funcs[3][5] = {
+        {RemapDispatcher<Map,  PointFilter, BrdConstant, Src, Dst>::call,
+         RemapDispatcher<Map,  PointFilter, BrdReplicate, Src, Dst>::call,
+         RemapDispatcher<Map,  PointFilter, BrdReflect, Src, Dst>::call,
+         RemapDispatcher<Map,  PointFilter, BrdWrap, Src, Dst>::call,
+         RemapDispatcher<Map,  PointFilter, BrdReflect101, Src, Dst>::call},
+        {RemapDispatcher<Map, LinearFilter, BrdConstant, Src, Dst>::call,
+         RemapDispatcher<Map, LinearFilter, BrdReplicate, Src, Dst>::call,
+         RemapDispatcher<Map, LinearFilter, BrdReflect, Src, Dst>::call,
+         RemapDispatcher<Map, LinearFilter, BrdWrap, Src, Dst>::call,
+         RemapDispatcher<Map, LinearFilter, BrdReflect101, Src, Dst>::call},
+        {RemapDispatcher<Map,  CubicFilter, BrdConstant, Src, Dst>::call,
+         RemapDispatcher<Map,  CubicFilter, BrdReplicate, Src, Dst>::call,
+         RemapDispatcher<Map,  CubicFilter, BrdReflect, Src, Dst>::call,
+         RemapDispatcher<Map,  CubicFilter, BrdWrap, Src, Dst>::call,
+         RemapDispatcher<Map,  CubicFilter, BrdReflect101, Src, Dst>::call}
+    };
+
+    funcs[interpolation][borderMode](src, dst, map, mapSamples, relative, max_height, max_width, borderValue,
+                                     stream);
+}
+
+template<class Src, class Dst>
+void remap_map_caller(const Src src, Dst dst, const ITensorDataStridedCuda &mapData, const int mapSamples,
+                      const bool relative, const int max_height, const int max_width, const int interpolation,
+                      const int borderMode, const float4 borderValue, cudaStream_t stream)
+{
+    if (mapData.dtype() == TYPE_F32)
+    {
+        RemapFloatMap map{cuda::CreateTensorWrapNHW<const float2>(mapData)};
+        remap_caller(src, dst, map, mapSamples, relative, max_height, max_width, interpolation, borderMode,
+                     borderValue, stream);
+    }
+    else
+    {
+        RemapFixedMap map{cuda::CreateTensorWrapNHW<const short3>(mapData)};
+        remap_caller(src, dst, map, mapSamples, relative, max_height, max_width, interpolation, borderMode,
+                     borderValue, stream);
+    }
+}
+
+template<typename T>
+void remapTensor(const TensorDataAccessStridedImagePlanar &inData, const TensorDataAccessStridedImagePlanar &outData,
+                 const ITensorDataStridedCuda &mapData, const int mapSamples, const bool relative,
+                 const int interpolation, const int borderMode, const float4 borderValue, cudaStream_t stream)
+{
+    Ptr2dNHWC<T> src_ptr(inData);
+    Ptr2dNHWC<T> dst_ptr(outData);
+
+    remap_map_caller(src_ptr, dst_ptr, mapData, mapSamples, relative, dst_ptr.rows, dst_ptr.cols, interpolation,
+                     borderMode, borderValue, stream);
+}
+
+template<typename T>
+void remapVarShape(const IImageBatchVarShapeDataStridedCuda &inData,
+                   const IImageBatchVarShapeDataStridedCuda &outData, const ITensorDataStridedCuda &mapData,
+                   const int mapSamples, const bool relative, const int interpolation, const int borderMode,
+                   const float4 borderValue, cudaStream_t stream)
+{
+    Ptr2dVarShapeNHWC<T> src_ptr(inData);
+    Ptr2dVarShapeNHWC<T> dst_ptr(outData);
+
+    Size2D outMaxSize = outData.maxSize();
+
+    remap_map_caller(src_ptr, dst_ptr, mapData, mapSamples, relative, outMaxSize.h, outMaxSize.w, interpolation,
+                     borderMode, borderValue, stream);
+}
+
+// Checks the parameters shared by tensor and varshape remaps, and returns the number of map samples.
+ErrorCode checkRemapParams(const ITensorDataStridedCuda &mapData, const int numSamples, const Size2D outMaxSize,
+                           const NVCVInterpolationType interpolation, const NVCVRemapMapValueType mapValueType,
+                           const NVCVBorderType borderMode, int &mapSamples)
+{
+    if (interpolation != NVCV_INTERP_NEAREST && interpolation != NVCV_INTERP_LINEAR
+        && interpolation != NVCV_INTERP_CUBIC)
+    {
+        LOG_ERROR("Unsupported interpolation method " << interpolation);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (mapValueType != NVCV_REMAP_ABSOLUTE && mapValueType != NVCV_REMAP_RELATIVE)
+    {
+        LOG_ERROR("Invalid map value type " << mapValueType);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (!(borderMode == NVCV_BORDER_REFLECT101 || borderMode == NVCV_BORDER_REPLICATE
+          || borderMode == NVCV_BORDER_CONSTANT || borderMode == NVCV_BORDER_REFLECT || borderMode == NVCV_BORDER_WRAP))
+    {
+        LOG_ERROR("Invalid borderMode " << borderMode);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    DataFormat map_format = GetLegacyDataFormat(mapData.layout());
+    if (!(map_format == kNHWC || map_format == kHWC))
+    {
+        LOG_ERROR("Invalid map DataFormat " << map_format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    auto mapAccess = TensorDataAccessStridedImagePlanar::Create(mapData);
+    if (!mapAccess)
+    {
+        LOG_ERROR("Invalid map DataFormat");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    const int mapChannels = mapAccess->numChannels();
+    if (!(mapData.dtype() == TYPE_F32 && mapChannels == 2) && !(mapData.dtype() == TYPE_S16 && mapChannels == 3))
+    {
+        LOG_ERROR("Invalid map DataType " << mapData.dtype() << " with " << mapChannels
+                                          << " channels, it must be float32 with 2 channels or int16 with 3 channels");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (mapAccess->colStride() != mapChannels * mapData.dtype().strideBytes())
+    {
+        LOG_ERROR("Invalid map layout, map channels must be packed");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    mapSamples = mapAccess->numSamples();
+    if (mapSamples != 1 && mapSamples != numSamples)
+    {
+        LOG_ERROR("Invalid map number of samples " << mapSamples << ", it must be 1 or " << numSamples);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (mapAccess->numCols() < outMaxSize.w || mapAccess->numRows() < outMaxSize.h)
+    {
+        LOG_ERROR("Invalid map size " << mapAccess->numCols() << "x" << mapAccess->numRows()
+                                      << ", it must cover the output size " << outMaxSize.w << "x" << outMaxSize.h);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+size_t Remap::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode Remap::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                       const ITensorDataStridedCuda &mapData, const NVCVInterpolationType interpolation,
+                       const NVCVRemapMapValueType mapValueType, const NVCVBorderType borderMode,
+                       const float4 borderValue, cudaStream_t stream)
+{
+    DataFormat input_format  = GetLegacyDataFormat(inData.layout());
+    DataFormat output_format = GetLegacyDataFormat(outData.layout());
+
+    if (input_format != output_format)
+    {
+        LOG_ERROR("Invalid DataFormat between input (" << input_format << ") and output (" << output_format << ")");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataFormat format = input_format;
+
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (inData.dtype() != outData.dtype())
+    {
+        LOG_ERROR("Invalid DataType between input (" << inData.dtype() << ") and output (" << outData.dtype() << ")");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    DataType data_type = GetLegacyDataType(inData.dtype());
+    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_16S || data_type == kCV_32F))
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess  = TensorDataAccessStridedImagePlanar::Create(inData);
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    if (!inAccess || !outAccess)
+    {
+        LOG_ERROR("Invalid input or output DataFormat");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    int channels = inAccess->numChannels();
+    if (channels != 1 && channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (outAccess->numChannels() != channels)
+    {
+        LOG_ERROR("Invalid output channel number " << outAccess->numChannels() << ", it must be " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (outAccess->numSamples() != inAccess->numSamples())
+    {
+        LOG_ERROR("Invalid output number of samples " << outAccess->numSamples() << ", it must be "
+                                                      << inAccess->numSamples());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    // Tensor maps must match the output size exactly, a larger map is most likely a mistake
+    auto mapAccess = TensorDataAccessStridedImagePlanar::Create(mapData);
+    if (mapAccess && (mapAccess->numCols() != outAccess->numCols() || mapAccess->numRows() != outAccess->numRows()))
+    {
+        LOG_ERROR("Invalid map size " << mapAccess->numCols() << "x" << mapAccess->numRows()
+                                      << ", it must be the output size " << outAccess->numCols() << "x"
+                                      << outAccess->numRows());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    int       mapSamples = 0;
+    ErrorCode err = checkRemapParams(mapData, outAccess->numSamples(), {outAccess->numCols(), outAccess->numRows()},
+                                     interpolation, mapValueType, borderMode, mapSamples);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    typedef void (*func_t)(const TensorDataAccessStridedImagePlanar &inData,
+                           const TensorDataAccessStridedImagePlanar &outData, const ITensorDataStridedCuda &mapData,
+                           const int mapSamples, const bool relative, const int interpolation, const int borderMode,
+                           const float4 borderValue, cudaStream_t stream);
+
+    static const func_t funcs[6][4] = {
+        {      remapTensor<uchar>,  0 /*remapTensor<uchar2>*/,       remapTensor<uchar3>,       remapTensor<uchar4>},
+        {0 /*remapTensor<schar>*/,  0 /*remapTensor<schar2>*/, 0 /*remapTensor<schar3>*/, 0 /*remapTensor<schar4>*/},
+        {     remapTensor<ushort>, 0 /*remapTensor<ushort2>*/,      remapTensor<ushort3>,      remapTensor<ushort4>},
+        {      remapTensor<short>,  0 /*remapTensor<short2>*/,       remapTensor<short3>,       remapTensor<short4>},
+        {  0 /*remapTensor<int>*/,    0 /*remapTensor<int2>*/,   0 /*remapTensor<int3>*/,   0 /*remapTensor<int4>*/},
+        {      remapTensor<float>,  0 /*remapTensor<float2>*/,       remapTensor<float3>,       remapTensor<float4>}
+    };
+
+    const func_t func = funcs[data_type][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(*inAccess, *outAccess, mapData, mapSamples, mapValueType == NVCV_REMAP_RELATIVE, interpolation, borderMode,
+         borderValue, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode RemapVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                               const IImageBatchVarShapeDataStridedCuda &outData,
+                               const ITensorDataStridedCuda &mapData, const NVCVInterpolationType interpolation,
+                               const NVCVRemapMapValueType mapValueType, const NVCVBorderType borderMode,
+                               const float4 borderValue, cudaStream_t stream)
+{
+    DataFormat input_format  = helpers::GetLegacyDataFormat(inData);
+    DataFormat output_format = helpers::GetLegacyDataFormat(outData);
+
+    if (input_format != output_format)
+    {
+        LOG_ERROR("Invalid DataFormat between input (" << input_format << ") and output (" << output_format << ")");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataFormat format = input_format;
+
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!inData.uniqueFormat() || inData.uniqueFormat() != outData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input and output varshapes must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (inData.numImages() != outData.numImages())
+    {
+        LOG_ERROR("Invalid number of output images " << outData.numImages() << ", it must be "
+                                                     << inData.numImages());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    int channels = inData.uniqueFormat().numChannels();
+    if (channels != 1 && channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    DataType data_type = helpers::GetLegacyDataType(inData.uniqueFormat());
+    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_16S || data_type == kCV_32F))
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    int       mapSamples = 0;
+    ErrorCode err        = checkRemapParams(mapData, inData.numImages(), outData.maxSize(), interpolation,
+                                            mapValueType, borderMode, mapSamples);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (inData.numImages() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData,
+                           const IImageBatchVarShapeDataStridedCuda &outData, const ITensorDataStridedCuda &mapData,
+                           const int mapSamples, const bool relative, const int interpolation, const int borderMode,
+                           const float4 borderValue, cudaStream_t stream);
+
+    static const func_t funcs[6][4] = {
+        {      remapVarShape<uchar>,  0 /*remapVarShape<uchar2>*/,
+               remapVarShape<uchar3>,       remapVarShape<uchar4>},
+        {0 /*remapVarShape<schar>*/,  0 /*remapVarShape<schar2>*/,
+         0 /*remapVarShape<schar3>*/, 0 /*remapVarShape<schar4>*/},
+        {     remapVarShape<ushort>, 0 /*remapVarShape<ushort2>*/,
+              remapVarShape<ushort3>,      remapVarShape<ushort4>},
+        {      remapVarShape<short>,  0 /*remapVarShape<short2>*/,
+               remapVarShape<short3>,       remapVarShape<short4>},
+        {  0 /*remapVarShape<int>*/,    0 /*remapVarShape<int2>*/,
+           0 /*remapVarShape<int3>*/,   0 /*remapVarShape<int4>*/},
+        {      remapVarShape<float>,  0 /*remapVarShape<float2>*/,
+               remapVarShape<float3>,       remapVarShape<float4>}
+    };
+
+    const func_t func = funcs[data_type][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(inData, outData, mapData, mapSamples, mapValueType == NVCV_REMAP_RELATIVE, interpolation, borderMode,
+         borderValue, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -20,9 +20,19 @@
 #include "CvCudaLegacy.h"
 #include "CvCudaLegacyHelpers.hpp"
 
+#include "ChannelOrder.cuh"
 #include "CvCudaUtils.cuh"
+#include "KernelTuner.hpp"
+#include "LaunchBudget.hpp"
 
 #include <nvcv/cuda/MathWrappers.hpp>
+#include <nvcv/cuda/TextureWrap.hpp>
+#include <nvcv/cuda/VectorizedAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <type_traits>
 
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
@@ -93,30 +103,58 @@ inline void __device__ _alignedCudaMemcpyQuad(T *pDst, T *pSrc)
 
 } //_alignedCudaMemcpyQuad
 
+//stores a pixel of the generic kernels; half outputs have no compound type, their channels are rounded to half
+//one by one, from the float values computed by the kernel
+template<typename T, class DstWrapper, typename U>
+inline __device__ void _storePixel(DstWrapper dst, const int batch_idx, const int y, const int x, const U &value)
+{
+    if constexpr (std::is_same_v<DstWrapper, cuda::Tensor4DWrap<__half>>)
+    {
+#pragma unroll
+        for (int c = 0; c < cuda::NumElements<U>; ++c)
+        {
+            *dst.ptr(batch_idx, y, x, c) = cuda::SaturateCast<__half>(cuda::GetElement(value, c));
+        }
+    }
+    else
+    {
+        *dst.ptr(batch_idx, y, x) = cuda::SaturateCast<T>(value);
+    }
+} //_storePixel
+
 //******************** NN = Nearest Neighbor
 
-template<class SrcWrapper, class DstWrapper>
-__global__ void resize_NN(SrcWrapper src, DstWrapper dst, int2 srcSize, int2 dstSize, const float scale_x,
-                          const float scale_y)
+//the per-pixel functions below hold the math of the generic kernels, shared with resize_multi
+
+template<class SrcWrapper, class DstWrapper, typename T = std::remove_const_t<typename SrcWrapper::ValueType>>
+inline __device__ void _resizeNN(SrcWrapper src, DstWrapper dst, int2 srcSize, int2 dstSize, const float scale_x,
+                                 const float scale_y, const int batch_idx, const int dst_x, const int dst_y)
 {
-    const int dst_x      = blockIdx.x * blockDim.x + threadIdx.x;
-    const int dst_y      = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx  = get_batch_idx();
-    int       out_height = dstSize.y, out_width = dstSize.x;
+    int out_height = dstSize.y, out_width = dstSize.x;
 
     if ((dst_x < out_width) && (dst_y < out_height))
     { //generic copy pixel to pixel
-        const int sx                      = cuda::min(__float2int_rd(dst_x * scale_x), srcSize.x - 1);
-        const int sy                      = cuda::min(__float2int_rd(dst_y * scale_y), srcSize.y - 1);
-        *dst.ptr(batch_idx, dst_y, dst_x) = *src.ptr(batch_idx, sy, sx);
+        const int sx = cuda::min(__float2int_rd(dst_x * scale_x), srcSize.x - 1);
+        const int sy = cuda::min(__float2int_rd(dst_y * scale_y), srcSize.y - 1);
+        _storePixel<T>(dst, batch_idx, dst_y, dst_x, *src.ptr(batch_idx, sy, sx));
     }
+} //_resizeNN
+
+template<class SrcWrapper, class DstWrapper>
+__global__ void resize_NN(SrcWrapper src, DstWrapper dst, int2 srcSize, int2 dstSize, const float scale_x,
+                          const float scale_y)
+{
+    _resizeNN(src, dst, srcSize, dstSize, scale_x, scale_y, get_batch_idx(), blockIdx.x * blockDim.x + threadIdx.x,
+              blockIdx.y * blockDim.y + threadIdx.y);
 } //resize_NN
 
 template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
 __global__ void resize_NN_quad_alignread(SrcWrapper src, DstWrapper dst, int2 srcSize, int2 dstSize,
-                                         const float scale_x, const float scale_y)
+                                         const float scale_x, const float scale_y,
+                                         const float MAX_BUFFERED_X_SCALE = 4.0f)
 {
-    const float MAX_BUFFERED_X_SCALE = 4.0f; //probably more efficient all the way up to 4.0
+    //MAX_BUFFERED_X_SCALE is probably more efficient all the way up to 4.0, and 0 disables buffering.  It can't be
+    //larger than 4.0, the read buffer wouldn't fit
 
     const int dst_x      = (blockIdx.x * blockDim.x + threadIdx.x) * 4; //quad
     const int dst_y      = blockIdx.y * blockDim.y + threadIdx.y;
@@ -161,14 +199,12 @@ __global__ void resize_NN_quad_alignread(SrcWrapper src, DstWrapper dst, int2 sr
 
 //******************** Bilinear
 
-template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void resize_bilinear(SrcWrapper src, DstWrapper dst, int2 srcSize, int2 dstSize, const float scale_x,
-                                const float scale_y)
+template<class SrcWrapper, class DstWrapper, typename T = std::remove_const_t<typename SrcWrapper::ValueType>>
+inline __device__ void _resizeBilinear(SrcWrapper src, DstWrapper dst, int2 srcSize, int2 dstSize,
+                                       const float scale_x, const float scale_y, const int batch_idx, const int dst_x,
+                                       const int dst_y)
 {
-    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
-    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
-    int       height = srcSize.y, width = srcSize.x, out_height = dstSize.y, out_width = dstSize.x;
+    int height = srcSize.y, width = srcSize.x, out_height = dstSize.y, out_width = dstSize.x;
 
     if ((dst_x < out_width) && (dst_y < out_height))
     {
@@ -192,11 +228,19 @@ __global__ void resize_bilinear(SrcWrapper src, DstWrapper dst, int2 srcSize, in
             fx *= ((sx >= 0) && (sx < width - 1));
             sx = cuda::max(0, cuda::min(sx, width - 2));
 
-            *dst.ptr(batch_idx, dst_y, dst_x)
-                = cuda::SaturateCast<T>((1.0f - fx) * (aPtr[sx] * (1.0f - fy) + bPtr[sx] * fy)
-                                        + fx * (aPtr[sx + 1] * (1.0f - fy) + bPtr[sx + 1] * fy));
+            _storePixel<T>(dst, batch_idx, dst_y, dst_x,
+                           (1.0f - fx) * (aPtr[sx] * (1.0f - fy) + bPtr[sx] * fy)
+                               + fx * (aPtr[sx + 1] * (1.0f - fy) + bPtr[sx + 1] * fy));
         }
     }
+} //_resizeBilinear
+
+template<class SrcWrapper, class DstWrapper>
+__global__ void resize_bilinear(SrcWrapper src, DstWrapper dst, int2 srcSize, int2 dstSize, const float scale_x,
+                                const float scale_y)
+{
+    _resizeBilinear(src, dst, srcSize, dstSize, scale_x, scale_y, get_batch_idx(),
+                    blockIdx.x * blockDim.x + threadIdx.x, blockIdx.y * blockDim.y + threadIdx.y);
 } //resize_bilinear
 
 template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
@@ -307,14 +351,11 @@ __global__ void resize_bilinear_quad_alignread(SrcWrapper src, DstWrapper dst, i
 
 //******************** Bicubic
 
-template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
-__global__ void resize_bicubic(SrcWrapper src, DstWrapper dst, int2 srcSize, int2 dstSize, const float scale_x,
-                               const float scale_y)
+template<class SrcWrapper, class DstWrapper, typename T = std::remove_const_t<typename SrcWrapper::ValueType>>
+inline __device__ void _resizeBicubic(SrcWrapper src, DstWrapper dst, int2 srcSize, int2 dstSize, const float scale_x,
+                                      const float scale_y, const int batch_idx, const int dst_x, const int dst_y)
 { //optimized for aligned read
-    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
-    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
-    int       height = srcSize.y, width = srcSize.x, out_height = dstSize.y, out_width = dstSize.x;
+    int height = srcSize.y, width = srcSize.x, out_height = dstSize.y, out_width = dstSize.x;
 
     if ((dst_x < out_width) & (dst_y < out_height))
     {
@@ -363,12 +404,20 @@ __global__ void resize_bicubic(SrcWrapper src, DstWrapper dst, int2 srcSize, int
         } //for row
 #ifndef LEGACY_BICUBIC_MATH
         //correct math
-        *dst.ptr(batch_idx, dst_y, dst_x) = cuda::SaturateCast<T>(accum);
+        _storePixel<T>(dst, batch_idx, dst_y, dst_x, accum);
 #else
         //abs() needed to match legacy operator.
-        *dst.ptr(batch_idx, dst_y, dst_x) = cuda::SaturateCast<T>(cuda::abs(accum));
+        _storePixel<T>(dst, batch_idx, dst_y, dst_x, cuda::abs(accum));
 #endif
     }
+} //_resizeBicubic
+
+template<class SrcWrapper, class DstWrapper>
+__global__ void resize_bicubic(SrcWrapper src, DstWrapper dst, int2 srcSize, int2 dstSize, const float scale_x,
+                               const float scale_y)
+{
+    _resizeBicubic(src, dst, srcSize, dstSize, scale_x, scale_y, get_batch_idx(),
+                   blockIdx.x * blockDim.x + threadIdx.x, blockIdx.y * blockDim.y + threadIdx.y);
 } //resize_bicubic
 
 template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
@@ -503,15 +552,159 @@ __global__ void resize_bicubic_quad_alignread(SrcWrapper src, DstWrapper dst, in
     _alignedCudaMemcpyQuad<T>(dst.ptr(batch_idx, dst_y, dst_x), result);
 } //resize_bicubic_quad_alignread
 
-template<typename T, typename IntegerAreaFilter, typename AreaFilter>
-__global__ void resize_area_ocv_align(const Ptr2dNHWC<T> src, const IntegerAreaFilter integer_filter,
-                                      const AreaFilter area_filter, Ptr2dNHWC<T> dst, const float scale_x,
-                                      const float scale_y)
+//******************** Shared-memory tiles (downscale)
+
+//block of output pixels computed by the tiled kernels, wide to make the source tile loads coalesced
+#define TILE_BLOCK_WIDTH  32
+#define TILE_BLOCK_HEIGHT 8
+
+//above this factor neighbouring output pixels barely share source pixels, and the tile gets too large
+#define MAX_TILED_SCALE 2.0f
+
+//source coordinate and weight of the first tap along one axis, with the same math and clamping as
+//resize_bilinear (Taps = 2) and resize_bicubic (Taps = 4)
+template<int Taps, bool ZeroFracAtBorder>
+inline __device__ int _tiledSrcCoord(int dstCoord, float scale, int size, float &frac)
 {
-    const int x          = blockDim.x * blockIdx.x + threadIdx.x;
-    const int y          = blockDim.y * blockIdx.y + threadIdx.y;
-    const int batch_idx  = get_batch_idx();
-    int       out_height = dst.rows, out_width = dst.cols;
+    constexpr int lo = Taps / 2 - 1; //number of taps before the source coordinate
+
+    float f = (float)((dstCoord + 0.5f) * scale - 0.5f);
+    int   s = __float2int_rd(f);
+    frac    = f - s;
+    if (ZeroFracAtBorder)
+        frac *= ((s >= lo) && (s < (Taps == 2 ? size - 1 : size - 3)));
+    return cuda::max(lo, cuda::min(s, size - Taps + lo)) - lo;
+}
+
+template<int Taps, class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
+__global__ void resize_tiled(SrcWrapper src, DstWrapper dst, int2 srcSize, int2 dstSize, const float scale_x,
+                             const float scale_y)
+{
+    extern __shared__ __align__(sizeof(float4)) unsigned char resizeTileMem[];
+
+    T *tile = reinterpret_cast<T *>(resizeTileMem);
+
+    const int batch_idx = get_batch_idx();
+    const int dst_x0    = blockIdx.x * blockDim.x;
+    const int dst_y0    = blockIdx.y * blockDim.y;
+    const int dst_x1    = cuda::min(dst_x0 + (int)blockDim.x, dstSize.x) - 1;
+    const int dst_y1    = cuda::min(dst_y0 + (int)blockDim.y, dstSize.y) - 1;
+
+    //1 - source window of the block, source coordinates are monotonic in the destination ones
+    float     frac;
+    const int tile_x0 = _tiledSrcCoord<Taps, false>(dst_x0, scale_x, srcSize.x, frac);
+    const int tile_y0 = _tiledSrcCoord<Taps, false>(dst_y0, scale_y, srcSize.y, frac);
+    const int tile_w  = _tiledSrcCoord<Taps, false>(dst_x1, scale_x, srcSize.x, frac) + Taps - tile_x0;
+    const int tile_h  = _tiledSrcCoord<Taps, false>(dst_y1, scale_y, srcSize.y, frac) + Taps - tile_y0;
+
+    //2 - cooperative load, consecutive threads read consecutive pixels of a row
+    for (int i = get_lid(); i < tile_w * tile_h; i += blockDim.x * blockDim.y)
+    {
+        const int ty = i / tile_w;
+        const int tx = i - ty * tile_w;
+        tile[i]      = *src.ptr(batch_idx, tile_y0 + ty, tile_x0 + tx);
+    }
+    __syncthreads();
+
+    const int dst_x = dst_x0 + threadIdx.x;
+    const int dst_y = dst_y0 + threadIdx.y;
+    if ((dst_x >= dstSize.x) | (dst_y >= dstSize.y))
+        return;
+
+    //3 - interpolate from the tile
+    using work_type = cuda::ConvertBaseTypeTo<float, T>;
+
+    float     fx, fy;
+    const int sx = _tiledSrcCoord<Taps, true>(dst_x, scale_x, srcSize.x, fx) - tile_x0;
+    const int sy = _tiledSrcCoord<Taps, false>(dst_y, scale_y, srcSize.y, fy) - tile_y0;
+
+    const T *aPtr = &tile[sy * tile_w + sx];
+
+    if constexpr (Taps == 2)
+    {
+        const T *bPtr = aPtr + tile_w;
+
+        *dst.ptr(batch_idx, dst_y, dst_x) = cuda::SaturateCast<T>((1.0f - fx) * (aPtr[0] * (1.0f - fy) + bPtr[0] * fy)
+                                                                  + fx * (aPtr[1] * (1.0f - fy) + bPtr[1] * fy));
+    }
+    else
+    {
+        const float A = -0.75f;
+
+        float cY[4];
+        cY[0] = ((A * (fy + 1) - 5 * A) * (fy + 1) + 8 * A) * (fy + 1) - 4 * A;
+        cY[1] = ((A + 2) * fy - (A + 3)) * fy * fy + 1;
+        cY[2] = ((A + 2) * (1 - fy) - (A + 3)) * (1 - fy) * (1 - fy) + 1;
+        cY[3] = 1.f - cY[0] - cY[1] - cY[2];
+
+        float cX[4];
+        cX[0] = ((A * (fx + 1.0f) - 5.0f * A) * (fx + 1.0f) + 8.0f * A) * (fx + 1.0f) - 4.0f * A;
+        cX[1] = ((A + 2.0f) * fx - (A + 3.0f)) * fx * fx + 1.0f;
+        cX[2] = ((A + 2.0f) * (1.0f - fx) - (A + 3.0f)) * (1.0f - fx) * (1.0f - fx) + 1.0f;
+        cX[3] = 1.0f - cX[0] - cX[1] - cX[2];
+
+        work_type accum = cuda::SetAll<work_type>(0);
+#pragma unroll
+        for (int row = 0; row < 4; ++row, aPtr += tile_w)
+        {
+            accum += cY[row] * (cX[0] * aPtr[0] + cX[1] * aPtr[1] + cX[2] * aPtr[2] + cX[3] * aPtr[3]);
+        }
+#ifndef LEGACY_BICUBIC_MATH
+        *dst.ptr(batch_idx, dst_y, dst_x) = cuda::SaturateCast<T>(accum);
+#else
+        *dst.ptr(batch_idx, dst_y, dst_x) = cuda::SaturateCast<T>(cuda::abs(accum));
+#endif
+    }
+} //resize_tiled
+
+//number of bytes of shared memory needed by resize_tiled
+template<int Taps, typename T>
+size_t _tiledSharedMemSize(float scale_x, float scale_y)
+{
+    //+1 to account for rounding of the source coordinates
+    int tile_w = (int)std::ceil((TILE_BLOCK_WIDTH - 1) * scale_x) + Taps + 1;
+    int tile_h = (int)std::ceil((TILE_BLOCK_HEIGHT - 1) * scale_y) + Taps + 1;
+    return tile_w * tile_h * sizeof(T);
+}
+
+//******************** Texture cache (upscale)
+
+template<class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
+__global__ void resize_bilinear_tex(SrcWrapper src, DstWrapper dst, int2 srcSize, int2 dstSize, const float scale_x,
+                                    const float scale_y)
+{ //same math as resize_bilinear, texels are read through the texture cache
+    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+    int       height = srcSize.y, width = srcSize.x, out_height = dstSize.y, out_width = dstSize.x;
+
+    if ((dst_x < out_width) && (dst_y < out_height))
+    {
+        float fy = (float)((dst_y + 0.5f) * scale_y - 0.5f);
+        int   sy = __float2int_rd(fy);
+        fy -= sy;
+        sy = cuda::max(0, cuda::min(sy, height - 2));
+
+        float fx = (float)((dst_x + 0.5f) * scale_x - 0.5f);
+        int   sx = __float2int_rd(fx);
+        fx -= sx;
+        fx *= ((sx >= 0) && (sx < width - 1));
+        sx = cuda::max(0, cuda::min(sx, width - 2));
+
+        const T a0 = src[int3{sx, sy, batch_idx}], a1 = src[int3{sx + 1, sy, batch_idx}];
+        const T b0 = src[int3{sx, sy + 1, batch_idx}], b1 = src[int3{sx + 1, sy + 1, batch_idx}];
+
+        *dst.ptr(batch_idx, dst_y, dst_x) = cuda::SaturateCast<T>((1.0f - fx) * (a0 * (1.0f - fy) + b0 * fy)
+                                                                  + fx * (a1 * (1.0f - fy) + b1 * fy));
+    }
+} //resize_bilinear_tex
+
+template<typename T, typename IntegerAreaFilter, typename AreaFilter, class DstWrapper>
+inline __device__ void _resizeArea(const Ptr2dNHWC<T> src, const IntegerAreaFilter integer_filter,
+                                   const AreaFilter area_filter, DstWrapper dst, int2 dstSize, const float scale_x,
+                                   const float scale_y, const int batch_idx, const int x, const int y)
+{
+    int out_height = dstSize.y, out_width = dstSize.x;
 
     if (x >= out_width || y >= out_height)
         return;
@@ -526,11 +719,11 @@ __global__ void resize_area_ocv_align(const Ptr2dNHWC<T> src, const IntegerAreaF
     {
         if (is_area_fast) // integer multiples
         {
-            *dst.ptr(batch_idx, y, x) = integer_filter(batch_idx, y, x);
+            _storePixel<T>(dst, batch_idx, y, x, integer_filter(batch_idx, y, x));
             return;
         }
 
-        *dst.ptr(batch_idx, y, x) = area_filter(batch_idx, y, x);
+        _storePixel<T>(dst, batch_idx, y, x, area_filter(batch_idx, y, x));
         return;
     }
 
@@ -565,12 +758,237 @@ __global__ void resize_area_ocv_align(const Ptr2dNHWC<T> src, const IntegerAreaF
     cbufx[0] = 1.f - fx;
     cbufx[1] = fx;
 
-    *dst.ptr(batch_idx, y, x) = cuda::SaturateCast<T>((*src.ptr(batch_idx, sy, sx) * cbufx[0] * cbufy[0]
-                                                       + *src.ptr(batch_idx, sy + 1, sx) * cbufx[0] * cbufy[1]
-                                                       + *src.ptr(batch_idx, sy, sx + 1) * cbufx[1] * cbufy[0]
-                                                       + *src.ptr(batch_idx, sy + 1, sx + 1) * cbufx[1] * cbufy[1]));
+    _storePixel<T>(dst, batch_idx, y, x,
+                   *src.ptr(batch_idx, sy, sx) * cbufx[0] * cbufy[0]
+                       + *src.ptr(batch_idx, sy + 1, sx) * cbufx[0] * cbufy[1]
+                       + *src.ptr(batch_idx, sy, sx + 1) * cbufx[1] * cbufy[0]
+                       + *src.ptr(batch_idx, sy + 1, sx + 1) * cbufx[1] * cbufy[1]);
+} //_resizeArea
+
+template<typename T, typename IntegerAreaFilter, typename AreaFilter>
+__global__ void resize_area_ocv_align(const Ptr2dNHWC<T> src, const IntegerAreaFilter integer_filter,
+                                      const AreaFilter area_filter, Ptr2dNHWC<T> dst, const float scale_x,
+                                      const float scale_y)
+{
+    _resizeArea(src, integer_filter, area_filter, dst, int2{dst.cols, dst.rows}, scale_x, scale_y, get_batch_idx(),
+                blockDim.x * blockIdx.x + threadIdx.x, blockDim.y * blockIdx.y + threadIdx.y);
+} //resize_area_ocv_align
+
+template<typename T, typename IntegerAreaFilter, typename AreaFilter, class DstWrapper>
+__global__ void resize_area(const Ptr2dNHWC<T> src, const IntegerAreaFilter integer_filter,
+                            const AreaFilter area_filter, DstWrapper dst, int2 dstSize, const float scale_x,
+                            const float scale_y)
+{ //same as resize_area_ocv_align, with any destination wrap
+    _resizeArea(src, integer_filter, area_filter, dst, dstSize, scale_x, scale_y, get_batch_idx(),
+                blockDim.x * blockIdx.x + threadIdx.x, blockDim.y * blockIdx.y + threadIdx.y);
+} //resize_area
+
+//******************** Integer factor downscale
+
+//F consecutive pixels of a row, in a single vector load when the rows are aligned
+template<int F, bool Vectorized, typename T>
+inline __device__ cuda::Vector<T, F> _loadIntegerRun(const T *ptr)
+{
+    if constexpr (Vectorized)
+    {
+        return cuda::LoadVector<F>(ptr);
+    }
+    else
+    {
+        cuda::Vector<T, F> run;
+#pragma unroll
+        for (int i = 0; i < F; ++i) run[i] = ptr[i];
+        return run;
+    }
+}
+
+template<int F, bool Vectorized, class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
+__global__ void resize_area_integer(SrcWrapper src, DstWrapper dst, int2 dstSize)
+{ //same accumulation order as IntegerAreaFilter, each row of the FxF box is read at once
+    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    if ((dst_x >= dstSize.x) | (dst_y >= dstSize.y))
+        return;
+
+    using work_type = cuda::ConvertBaseTypeTo<float, T>;
+
+    const float scale = 1.f / ((float)F * (float)F);
+    work_type   out   = cuda::SetAll<work_type>(0.f);
+
+#pragma unroll
+    for (int dy = 0; dy < F; ++dy)
+    {
+        const cuda::Vector<T, F> run = _loadIntegerRun<F, Vectorized>(src.ptr(batch_idx, dst_y * F + dy, dst_x * F));
+#pragma unroll
+        for (int dx = 0; dx < F; ++dx)
+        {
+            out = out + run[dx] * scale;
+        }
+    }
+
+    *dst.ptr(batch_idx, dst_y, dst_x) = cuda::SaturateCast<T>(out);
+} //resize_area_integer
+
+template<int F, bool Vectorized, class SrcWrapper, class DstWrapper, typename T = typename DstWrapper::ValueType>
+__global__ void resize_bilinear_integer(SrcWrapper src, DstWrapper dst, int2 dstSize)
+{ //with an even factor, the source position of resize_bilinear is exactly between the two middle pixels of the
+  //FxF block, so both weights are 0.5 and no clamping is needed
+    static_assert(F % 2 == 0, "Only even factors have constant weights");
+
+    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    if ((dst_x >= dstSize.x) | (dst_y >= dstSize.y))
+        return;
+
+    const float   fx = 0.5f, fy = 0.5f;
+    constexpr int sx = F / 2 - 1;
+    const int     sy = dst_y * F + F / 2 - 1;
+
+    const cuda::Vector<T, F> a = _loadIntegerRun<F, Vectorized>(src.ptr(batch_idx, sy, dst_x * F));
+    const cuda::Vector<T, F> b = _loadIntegerRun<F, Vectorized>(src.ptr(batch_idx, sy + 1, dst_x * F));
+
+    *dst.ptr(batch_idx, dst_y, dst_x) = cuda::SaturateCast<T>((1.0f - fx) * (a[sx] * (1.0f - fy) + b[sx] * fy)
+                                                              + fx * (a[sx + 1] * (1.0f - fy) + b[sx + 1] * fy));
+} //resize_bilinear_integer
+
+template<int F, typename T>
+void _resizeIntegerFactor(const ITensorDataStridedCuda &inData, cuda::Tensor3DWrap<const T> src,
+                          cuda::Tensor3DWrap<T> dst, int2 dstSize, NVCVInterpolationType interpolation,
+                          dim3 gridSize, dim3 blockSize, cudaStream_t stream)
+{
+    const bool vectorized = cuda::IsVectorAligned<T, F>(inData, 1);
+
+    if (interpolation == NVCV_INTERP_AREA)
+    {
+        if (vectorized)
+            resize_area_integer<F, true><<<gridSize, blockSize, 0, stream>>>(src, dst, dstSize);
+        else
+            resize_area_integer<F, false><<<gridSize, blockSize, 0, stream>>>(src, dst, dstSize);
+    }
+    else
+    {
+        if (vectorized)
+            resize_bilinear_integer<F, true><<<gridSize, blockSize, 0, stream>>>(src, dst, dstSize);
+        else
+            resize_bilinear_integer<F, false><<<gridSize, blockSize, 0, stream>>>(src, dst, dstSize);
+    }
 }
 
+//******************** Multiple outputs
+
+#define MAX_RESIZE_OUTPUTS 8
+
+//outputs of a single resize_multi launch, each with its own size and interpolation
+template<typename T>
+struct ResizeOutputs
+{
+    cuda::Tensor3DWrap<T> dst[MAX_RESIZE_OUTPUTS];
+    int2                  size[MAX_RESIZE_OUTPUTS];
+    float2                scale[MAX_RESIZE_OUTPUTS]; //input size over output size
+    NVCVInterpolationType interpolation[MAX_RESIZE_OUTPUTS];
+    int                   blocksX[MAX_RESIZE_OUTPUTS];        //number of blocks along the rows of each output
+    int                   firstBlock[MAX_RESIZE_OUTPUTS + 1]; //first block of each output along the x axis
+};
+
+template<typename T>
+__global__ void resize_multi(cuda::Tensor3DWrap<const T> src, const Ptr2dNHWC<T> src_ptr, int2 srcSize,
+                             const ResizeOutputs<T> outputs)
+{ //blocks along the x axis of the grid are split between the outputs, so that all of them are written while the
+  //input is resident in L2; each output uses the math of the generic single pixel kernel of its interpolation
+    int out = 0;
+    while ((int)blockIdx.x >= outputs.firstBlock[out + 1]) ++out;
+
+    const int block     = (int)blockIdx.x - outputs.firstBlock[out];
+    const int dst_x     = (block % outputs.blocksX[out]) * blockDim.x + threadIdx.x;
+    const int dst_y     = (block / outputs.blocksX[out]) * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    const int2  dstSize = outputs.size[out];
+    const float scale_x = outputs.scale[out].x;
+    const float scale_y = outputs.scale[out].y;
+
+    switch (outputs.interpolation[out])
+    {
+    case NVCV_INTERP_NEAREST:
+        _resizeNN(src, outputs.dst[out], srcSize, dstSize, scale_x, scale_y, batch_idx, dst_x, dst_y);
+        break;
+
+    case NVCV_INTERP_LINEAR:
+        _resizeBilinear(src, outputs.dst[out], srcSize, dstSize, scale_x, scale_y, batch_idx, dst_x, dst_y);
+        break;
+
+    case NVCV_INTERP_CUBIC:
+        _resizeBicubic(src, outputs.dst[out], srcSize, dstSize, scale_x, scale_y, batch_idx, dst_x, dst_y);
+        break;
+
+    default:
+    {
+        BrdConstant<T>                                                brd(src_ptr.rows, src_ptr.cols);
+        BorderReader<Ptr2dNHWC<T>, BrdConstant<T>>                    brdSrc(src_ptr, brd);
+        IntegerAreaFilter<BorderReader<Ptr2dNHWC<T>, BrdConstant<T>>> integer_filter(brdSrc, scale_x, scale_y);
+        AreaFilter<BorderReader<Ptr2dNHWC<T>, BrdConstant<T>>>        area_filter(brdSrc, scale_x, scale_y);
+        _resizeArea(src_ptr, integer_filter, area_filter, outputs.dst[out], dstSize, scale_x, scale_y, batch_idx,
+                    dst_x, dst_y);
+    }
+    break;
+    }
+} //resize_multi
+
+template<typename T>
+void resizeMulti(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda *const *outData,
+                  const NVCVInterpolationType *interpolation, int numOutputs, cudaStream_t stream)
+{
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+    NVCV_ASSERT(numOutputs > 0 && numOutputs <= MAX_RESIZE_OUTPUTS);
+
+    const int THREADS_PER_BLOCK = 256;
+    const int BLOCK_WIDTH       = 8;
+
+    const dim3 blockSize(BLOCK_WIDTH, THREADS_PER_BLOCK / BLOCK_WIDTH, 1);
+
+    const int2 srcSize{inAccess->numCols(), inAccess->numRows()};
+
+    ResizeOutputs<T> outputs;
+    outputs.firstBlock[0] = 0;
+    for (int o = 0; o < MAX_RESIZE_OUTPUTS; ++o)
+    {
+        int numBlocks = 0;
+        if (o < numOutputs)
+        {
+            auto outAccess = TensorDataAccessStridedImagePlanar::Create(*outData[o]);
+            NVCV_ASSERT(outAccess);
+
+            const int2 dstSize{outAccess->numCols(), outAccess->numRows()};
+
+            outputs.dst[o]           = cuda::CreateTensorWrapNHW<T>(*outData[o]);
+            outputs.size[o]          = dstSize;
+            outputs.scale[o]         = float2{(float)srcSize.x / dstSize.x, (float)srcSize.y / dstSize.y};
+            outputs.interpolation[o] = interpolation[o];
+            outputs.blocksX[o]       = divUp(dstSize.x, blockSize.x);
+            numBlocks                = outputs.blocksX[o] * divUp(dstSize.y, blockSize.y);
+        }
+        outputs.firstBlock[o + 1] = outputs.firstBlock[o] + numBlocks;
+    }
+
+    const dim3 gridSize(outputs.firstBlock[numOutputs], 1, inAccess->numSamples());
+
+    auto         src = cuda::CreateTensorWrapNHW<const T>(inData);
+    Ptr2dNHWC<T> src_ptr(*inAccess);
+
+    resize_multi<T><<<gridSize, blockSize, 0, stream>>>(src, src_ptr, srcSize, outputs);
+    checkKernelErrors();
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+} //resizeMulti
+
 template<typename T>
 void resize(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
             NVCVInterpolationType interpolation, cudaStream_t stream)
@@ -611,26 +1029,98 @@ void resize(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &
     bool can_quad = ((out_width % 4) == 0); //is the output buffer quad-pixel aligned?
     //bool can_quad = false; //override
 
+    //downscale by up to MAX_TILED_SCALE: neighbouring output pixels share source pixels, read them once per
+    //block into shared memory
+    const bool can_tile = scale_x > 1.0f && scale_y > 1.0f && scale_x <= MAX_TILED_SCALE
+                       && scale_y <= MAX_TILED_SCALE && in_width >= 4 && in_height >= 4;
+
+    const dim3   tileBlockSize(TILE_BLOCK_WIDTH, TILE_BLOCK_HEIGHT, 1);
+    const dim3   tileGridSize(divUp(out_width, tileBlockSize.x), divUp(out_height, tileBlockSize.y), batch_size);
+    const size_t bilinearTileBytes = _tiledSharedMemSize<2, T>(scale_x, scale_y);
+    const size_t bicubicTileBytes  = _tiledSharedMemSize<4, T>(scale_x, scale_y);
+
+    //exact 2x or 4x downscale: every output pixel reads whole rows of its source block, see _resizeIntegerFactor
+    int int_factor = 0;
+    if (in_width == 2 * out_width && in_height == 2 * out_height)
+        int_factor = 2;
+    else if (in_width == 4 * out_width && in_height == 4 * out_height)
+        int_factor = 4;
+
+    //upscale: neighbouring output pixels read the same few source pixels, served by the texture cache
+    //the texture objects are cached, filtering is done in software to match the other kernels
+    std::optional<cuda::TextureWrap<T, NVCV_BORDER_REPLICATE>> tex;
+    if constexpr (cuda::HasTextureFormat<T>)
+    {
+        if (interpolation == NVCV_INTERP_LINEAR && scale_x < 1.0f && scale_y < 1.0f)
+        {
+            tex = cuda::CreateTextureWrapNHW<T, NVCV_BORDER_REPLICATE>(inData);
+        }
+    }
+    const bool use_tex = tex.has_value();
+
     //Note: resize is fundamentally a gather memory operation, with a little bit of compute
     //      our goals are to (a) maximize throughput, and (b) minimize occupancy for the same performance
 
     switch (interpolation)
     {
     case NVCV_INTERP_NEAREST:
+    {
+        //variants: generic kernel with tall or wide blocks, quad kernel with or without buffered reads
+        auto launchNN = [&](int variant, cudaStream_t s)
+        {
+            const dim3 wideBlockSize(blockSize.y, blockSize.x, 1);
+            const dim3 wideGridSize(divUp(out_width, wideBlockSize.x), divUp(out_height, wideBlockSize.y), batch_size);
+            switch (variant)
+            {
+            case 0: //generic single pixel per thread case
+                resize_NN<<<gridSize, blockSize, 0, s>>>(src, dst, srcSize, dstSize, scale_x, scale_y);
+                break;
+            case 1:
+                resize_NN<<<wideGridSize, wideBlockSize, 0, s>>>(src, dst, srcSize, dstSize, scale_x, scale_y);
+                break;
+            case 2: //thread does 4 pixels horizontally for aligned read and write
+                resize_NN_quad_alignread<<<quadGridSize, blockSize, 0, s>>>(src, dst, srcSize, dstSize, scale_x,
+                                                                            scale_y);
+                break;
+            case 3:
+                resize_NN_quad_alignread<<<quadGridSize, blockSize, 0, s>>>(src, dst, srcSize, dstSize, scale_x,
+                                                                            scale_y, 0.0f);
+                break;
+            }
+        };
 
-        if (can_quad)
-        { //thread does 4 pixels horizontally for aligned read and write
-            resize_NN_quad_alignread<<<quadGridSize, blockSize, 0, stream>>>(src, dst, srcSize, dstSize, scale_x,
-                                                                             scale_y);
-        }
-        else
-        { //generic single pixel per thread case
-            resize_NN<<<gridSize, blockSize, 0, stream>>>(src, dst, srcSize, dstSize, scale_x, scale_y);
-        }
+        TuningKey key("resize_nn");
+        key.add(inData).add(outData);
+
+        const int variant = can_quad ? KernelTuner::Instance().select(key, {0, 1, 2, 3}, 2, launchNN, stream)
+                                     : KernelTuner::Instance().select(key, {0, 1}, 0, launchNN, stream);
+        launchNN(variant, stream);
         break;
+    }
 
     case NVCV_INTERP_LINEAR:
-        if (can_quad)
+        if (int_factor == 2)
+        {
+            _resizeIntegerFactor<2, T>(inData, src, dst, dstSize, interpolation, gridSize, blockSize, stream);
+        }
+        else if (int_factor == 4)
+        {
+            _resizeIntegerFactor<4, T>(inData, src, dst, dstSize, interpolation, gridSize, blockSize, stream);
+        }
+        else if (can_tile)
+        {
+            resize_tiled<2>
+                <<<tileGridSize, tileBlockSize, bilinearTileBytes, stream>>>(src, dst, srcSize, dstSize, scale_x, scale_y);
+        }
+        else if (use_tex)
+        {
+            if constexpr (cuda::HasTextureFormat<T>)
+            {
+                resize_bilinear_tex<<<gridSize, blockSize, 0, stream>>>(*tex, dst, srcSize, dstSize, scale_x,
+                                                                        scale_y);
+            }
+        }
+        else if (can_quad)
         { //thread does 4 pixels horizontally for aligned read and write
             resize_bilinear_quad_alignread<<<quadGridSize, blockSize, 0, stream>>>(src, dst, srcSize, dstSize, scale_x,
                                                                                    scale_y);
@@ -642,7 +1132,12 @@ void resize(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &
         break;
 
     case NVCV_INTERP_CUBIC:
-        if (can_quad)
+        if (can_tile)
+        {
+            resize_tiled<4>
+                <<<tileGridSize, tileBlockSize, bicubicTileBytes, stream>>>(src, dst, srcSize, dstSize, scale_x, scale_y);
+        }
+        else if (can_quad)
         { //thread does 4 pixels horizontally for aligned read and write
             resize_bicubic_quad_alignread<<<quadGridSize, blockSize, 0, stream>>>(src, dst, srcSize, dstSize, scale_x,
                                                                                   scale_y);
@@ -654,17 +1149,26 @@ void resize(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &
         break;
 
     case NVCV_INTERP_AREA:
-    {
-        Ptr2dNHWC<T>                                                  src_ptr(*inAccess);
-        Ptr2dNHWC<T>                                                  dst_ptr(*outAccess);
-        BrdConstant<T>                                                brd(src_ptr.rows, src_ptr.cols);
-        BorderReader<Ptr2dNHWC<T>, BrdConstant<T>>                    brdSrc(src_ptr, brd);
-        IntegerAreaFilter<BorderReader<Ptr2dNHWC<T>, BrdConstant<T>>> integer_filter(brdSrc, scale_x, scale_y);
-        AreaFilter<BorderReader<Ptr2dNHWC<T>, BrdConstant<T>>>        area_filter(brdSrc, scale_x, scale_y);
-        resize_area_ocv_align<T>
-            <<<gridSize, blockSize, 0, stream>>>(src_ptr, integer_filter, area_filter, dst_ptr, scale_x, scale_y);
-    }
-    break;
+        if (int_factor == 2)
+        {
+            _resizeIntegerFactor<2, T>(inData, src, dst, dstSize, interpolation, gridSize, blockSize, stream);
+        }
+        else if (int_factor == 4)
+        {
+            _resizeIntegerFactor<4, T>(inData, src, dst, dstSize, interpolation, gridSize, blockSize, stream);
+        }
+        else
+        {
+            Ptr2dNHWC<T>                                                  src_ptr(*inAccess);
+            Ptr2dNHWC<T>                                                  dst_ptr(*outAccess);
+            BrdConstant<T>                                                brd(src_ptr.rows, src_ptr.cols);
+            BorderReader<Ptr2dNHWC<T>, BrdConstant<T>>                    brdSrc(src_ptr, brd);
+            IntegerAreaFilter<BorderReader<Ptr2dNHWC<T>, BrdConstant<T>>> integer_filter(brdSrc, scale_x, scale_y);
+            AreaFilter<BorderReader<Ptr2dNHWC<T>, BrdConstant<T>>>        area_filter(brdSrc, scale_x, scale_y);
+            resize_area_ocv_align<T>
+                <<<gridSize, blockSize, 0, stream>>>(src_ptr, integer_filter, area_filter, dst_ptr, scale_x, scale_y);
+        }
+        break;
 
     default:
         //$$$ need to throw or log an error here
@@ -672,22 +1176,99 @@ void resize(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &
     } //switch
 
     checkKernelErrors();
+
 #ifdef CUDA_DEBUG_LOG
     checkCudaErrors(cudaStreamSynchronize(stream));
     checkCudaErrors(cudaGetLastError());
 #endif
 } //resize
 
+//the generic single pixel kernels, as they take any destination wrap; area filters compute ResultT pixels, the
+//float work type for half outputs so that they're only rounded as they're stored
+template<typename T, typename ResultT = T, class DstWrapper>
+void _resizeGeneric(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, DstWrapper dst,
+                    NVCVInterpolationType interpolation, cudaStream_t stream)
+{
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    const int2 srcSize{inAccess->numCols(), inAccess->numRows()};
+    const int2 dstSize{outAccess->numCols(), outAccess->numRows()};
+
+    const float scale_x = ((float)srcSize.x) / dstSize.x;
+    const float scale_y = ((float)srcSize.y) / dstSize.y;
+
+    auto src = cuda::CreateTensorWrapNHW<const T>(inData);
+
+    const dim3 blockSize(8, 32, 1);
+    const dim3 gridSize(divUp(dstSize.x, blockSize.x), divUp(dstSize.y, blockSize.y), inAccess->numSamples());
+
+    switch (interpolation)
+    {
+    case NVCV_INTERP_NEAREST:
+        resize_NN<<<gridSize, blockSize, 0, stream>>>(src, dst, srcSize, dstSize, scale_x, scale_y);
+        break;
+
+    case NVCV_INTERP_LINEAR:
+        resize_bilinear<<<gridSize, blockSize, 0, stream>>>(src, dst, srcSize, dstSize, scale_x, scale_y);
+        break;
+
+    case NVCV_INTERP_CUBIC:
+        resize_bicubic<<<gridSize, blockSize, 0, stream>>>(src, dst, srcSize, dstSize, scale_x, scale_y);
+        break;
+
+    default:
+    {
+        using Reader = BorderReader<Ptr2dNHWC<T>, BrdConstant<T>>;
+
+        Ptr2dNHWC<T>                       src_ptr(*inAccess);
+        BrdConstant<T>                     brd(src_ptr.rows, src_ptr.cols);
+        Reader                             brdSrc(src_ptr, brd);
+        IntegerAreaFilter<Reader, ResultT> integer_filter(brdSrc, scale_x, scale_y);
+        AreaFilter<Reader, ResultT>        area_filter(brdSrc, scale_x, scale_y);
+        resize_area<T><<<gridSize, blockSize, 0, stream>>>(src_ptr, integer_filter, area_filter, dst, dstSize,
+                                                           scale_x, scale_y);
+    }
+    break;
+    } //switch
+
+    checkKernelErrors();
+} //_resizeGeneric
+
+//channels are reordered as output pixels are stored, which is the same as reordering the input since all
+//interpolations are per channel
+template<typename T>
+void resizeReorder(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                   NVCVInterpolationType interpolation, const ChannelOrder &order, cudaStream_t stream)
+{
+    ChannelOrderWrap dst(cuda::CreateTensorWrapNHW<T>(outData), order);
+    _resizeGeneric<T>(inData, outData, dst, interpolation, stream);
+} //resizeReorder
+
+//half outputs, e.g. for FP16 inference, are interpolated in float and rounded once
+template<typename T>
+void resizeToHalf(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                  NVCVInterpolationType interpolation, cudaStream_t stream)
+{
+    using work_type = cuda::ConvertBaseTypeTo<float, T>;
+
+    auto dst = cuda::CreateTensorWrapNHWC<__half>(outData);
+    _resizeGeneric<T, work_type>(inData, outData, dst, interpolation, stream);
+} //resizeToHalf
+
 size_t Resize::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
 {
     return 0;
 } //Resize::calBufferSize
 
-ErrorCode Resize::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
-                        const NVCVInterpolationType interpolation, cudaStream_t stream)
+ErrorCode Resize::plan(const TensorShape &inShape, nvcv::DataType dtype, const TensorShape &outShape,
+                       const NVCVInterpolationType interpolation, func_t &func)
 {
-    DataFormat input_format  = GetLegacyDataFormat(inData.layout());
-    DataFormat output_format = GetLegacyDataFormat(outData.layout());
+    DataFormat input_format  = GetLegacyDataFormat(inShape.layout());
+    DataFormat output_format = GetLegacyDataFormat(outShape.layout());
 
     if (input_format != output_format)
     {
@@ -703,11 +1284,11 @@ ErrorCode Resize::infer(const ITensorDataStridedCuda &inData, const ITensorDataS
         return ErrorCode::INVALID_DATA_FORMAT;
     }
 
-    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
-    NVCV_ASSERT(inAccess);
+    auto inShapeInfo = TensorShapeInfoImage::Create(inShape);
+    NVCV_ASSERT(inShapeInfo);
 
-    cuda_op::DataType  data_type   = GetLegacyDataType(inData.dtype());
-    cuda_op::DataShape input_shape = GetLegacyDataShape(inAccess->infoShape());
+    cuda_op::DataType  data_type   = GetLegacyDataType(dtype);
+    cuda_op::DataShape input_shape = GetLegacyDataShape(*inShapeInfo);
 
     int channels = input_shape.C;
 
@@ -723,9 +1304,6 @@ ErrorCode Resize::infer(const ITensorDataStridedCuda &inData, const ITensorDataS
         return ErrorCode::INVALID_DATA_TYPE;
     }
 
-    typedef void (*func_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
-                           const NVCVInterpolationType interpolation, cudaStream_t stream);
-
     static const func_t funcs[6][4] = {
         {      resize<uchar>,  0 /*resize<uchar2>*/,       resize<uchar3>,       resize<uchar4>},
         {0 /*resize<schar>*/,  0 /*resize<schar2>*/, 0 /*resize<schar3>*/, 0 /*resize<schar4>*/},
@@ -740,10 +1318,8 @@ ErrorCode Resize::infer(const ITensorDataStridedCuda &inData, const ITensorDataS
     if (interpolation == NVCV_INTERP_NEAREST || interpolation == NVCV_INTERP_LINEAR
         || interpolation == NVCV_INTERP_CUBIC || interpolation == NVCV_INTERP_AREA)
     {
-        const func_t func = funcs[data_type][channels - 1];
+        func = funcs[data_type][channels - 1];
         NVCV_ASSERT(func != 0);
-
-        func(inData, outData, interpolation, stream);
     }
     else
     {
@@ -751,6 +1327,234 @@ ErrorCode Resize::infer(const ITensorDataStridedCuda &inData, const ITensorDataS
         return ErrorCode::INVALID_PARAMETER;
     }
     return SUCCESS;
+} //Resize::plan
+
+ErrorCode Resize::estimate(const TensorShape &inShape, nvcv::DataType dtype, const TensorShape &outShape,
+                           const NVCVInterpolationType interpolation, int64_t &bytesMoved, double &timeMs)
+{
+    func_t    func;
+    ErrorCode err = plan(inShape, dtype, outShape, interpolation, func);
+    if (err != SUCCESS)
+    {
+        return err;
+    }
+
+    auto inInfo  = TensorShapeInfoImage::Create(inShape);
+    auto outInfo = TensorShapeInfoImage::Create(outShape);
+    NVCV_ASSERT(inInfo && outInfo);
+
+    const int64_t pixelBytes = static_cast<int64_t>(inInfo->numChannels()) * dtype.strideBytes();
+    const int64_t inBytes    = inInfo->numSamples() * inInfo->numRows() * inInfo->numCols() * pixelBytes;
+    const int64_t outBytes   = outInfo->numSamples() * outInfo->numRows() * outInfo->numCols() * pixelBytes;
+
+    // Input pixels read per output pixel, neighbouring output pixels share most of them through the caches, so
+    // the input is read at most once
+    int64_t taps = 1;
+    switch (interpolation)
+    {
+    case NVCV_INTERP_LINEAR:
+        taps = 4;
+        break;
+    case NVCV_INTERP_CUBIC:
+        taps = 16;
+        break;
+    case NVCV_INTERP_AREA:
+        taps = std::max<int64_t>(divUp(inInfo->numCols(), outInfo->numCols()), 2)
+             * std::max<int64_t>(divUp(inInfo->numRows(), outInfo->numRows()), 2);
+        break;
+    default:
+        break;
+    }
+    bytesMoved = std::min(inBytes, outBytes * taps) + outBytes;
+
+    if (interpolation == NVCV_INTERP_NEAREST)
+    {
+        // Same key as the selection in resize()
+        TuningKey key("resize_nn");
+        key.add(inShape, dtype).add(outShape, dtype);
+
+        float measuredMs;
+        if (KernelTuner::Instance().measuredTime(key, measuredMs))
+        {
+            timeMs = measuredMs;
+            return SUCCESS;
+        }
+    }
+
+    // Resize is memory bound, its kernels reach about this share of the peak bandwidth
+    constexpr double kBandwidthEfficiency = 0.7;
+    constexpr double kLaunchOverheadMs    = 0.005;
+
+    int device = 0, memClockKHz = 0, busWidthBits = 0, numSMs = 1;
+    checkCudaErrors(cudaGetDevice(&device));
+    checkCudaErrors(cudaDeviceGetAttribute(&memClockKHz, cudaDevAttrMemoryClockRate, device));
+    checkCudaErrors(cudaDeviceGetAttribute(&busWidthBits, cudaDevAttrGlobalMemoryBusWidth, device));
+    checkCudaErrors(cudaDeviceGetAttribute(&numSMs, cudaDevAttrMultiProcessorCount, device));
+
+    // Double data rate, in bytes per millisecond, of which a budgeted launch gets roughly its share of the SMs
+    double bandwidth = 2.0 * memClockKHz * (busWidthBits / 8) * kBandwidthEfficiency;
+    bandwidth *= static_cast<double>(BudgetedSMCount()) / std::max(numSMs, 1);
+
+    timeMs = kLaunchOverheadMs + (bandwidth > 0 ? bytesMoved / bandwidth : 0);
+    return SUCCESS;
+} //Resize::estimate
+
+ErrorCode Resize::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                        const NVCVInterpolationType interpolation, cudaStream_t stream)
+{
+    func_t    func;
+    ErrorCode err = plan(inData.shape(), inData.dtype(), outData.shape(), interpolation, func);
+    if (err != SUCCESS)
+    {
+        return err;
+    }
+
+    if (outData.dtype() != inData.dtype())
+    {
+        //besides the input type, the output can only be half, see resizeToHalf
+        if (outData.dtype() != nvcv::TYPE_F16)
+        {
+            LOG_ERROR("Invalid output DataType " << GetLegacyDataType(outData.dtype())
+                                                 << ", it must be the input DataType or half");
+            return ErrorCode::INVALID_DATA_TYPE;
+        }
+
+        // clang-format off
+        static const func_t funcs[6][4] = {
+            {      resizeToHalf<uchar>,  0 /*resizeToHalf<uchar2>*/,       resizeToHalf<uchar3>,       resizeToHalf<uchar4>},
+            {0 /*resizeToHalf<schar>*/,  0 /*resizeToHalf<schar2>*/, 0 /*resizeToHalf<schar3>*/, 0 /*resizeToHalf<schar4>*/},
+            {     resizeToHalf<ushort>, 0 /*resizeToHalf<ushort2>*/,      resizeToHalf<ushort3>,      resizeToHalf<ushort4>},
+            {      resizeToHalf<short>,  0 /*resizeToHalf<short2>*/,       resizeToHalf<short3>,       resizeToHalf<short4>},
+            {  0 /*resizeToHalf<int>*/,    0 /*resizeToHalf<int2>*/,   0 /*resizeToHalf<int3>*/,   0 /*resizeToHalf<int4>*/},
+            {      resizeToHalf<float>,  0 /*resizeToHalf<float2>*/,       resizeToHalf<float3>,       resizeToHalf<float4>}
+        };
+        // clang-format on
+
+        auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+        NVCV_ASSERT(inAccess);
+
+        func = funcs[GetLegacyDataType(inData.dtype())][inAccess->numChannels() - 1];
+        NVCV_ASSERT(func != 0);
+    }
+
+    func(inData, outData, interpolation, stream);
+    return SUCCESS;
+} //Resize::infer
+
+ErrorCode Resize::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                        const NVCVInterpolationType interpolation, const ChannelOrder &order, cudaStream_t stream)
+{
+    if (order.isIdentity())
+    {
+        return infer(inData, outData, interpolation, stream);
+    }
+
+    if (outData.dtype() != inData.dtype())
+    {
+        LOG_ERROR("Channels can't be reordered into an output of another DataType");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    func_t    func;
+    ErrorCode err = plan(inData.shape(), inData.dtype(), outData.shape(), interpolation, func);
+    if (err != SUCCESS)
+    {
+        return err;
+    }
+
+    typedef void (*reorder_func_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                                   NVCVInterpolationType interpolation, const ChannelOrder &order,
+                                   cudaStream_t stream);
+
+    // clang-format off
+    static const reorder_func_t funcs[6][4] = {
+        {      resizeReorder<uchar>,  0 /*resizeReorder<uchar2>*/,       resizeReorder<uchar3>,       resizeReorder<uchar4>},
+        {0 /*resizeReorder<schar>*/,  0 /*resizeReorder<schar2>*/, 0 /*resizeReorder<schar3>*/, 0 /*resizeReorder<schar4>*/},
+        {     resizeReorder<ushort>, 0 /*resizeReorder<ushort2>*/,      resizeReorder<ushort3>,      resizeReorder<ushort4>},
+        {      resizeReorder<short>,  0 /*resizeReorder<short2>*/,       resizeReorder<short3>,       resizeReorder<short4>},
+        {  0 /*resizeReorder<int>*/,    0 /*resizeReorder<int2>*/,   0 /*resizeReorder<int3>*/,   0 /*resizeReorder<int4>*/},
+        {      resizeReorder<float>,  0 /*resizeReorder<float2>*/,       resizeReorder<float3>,       resizeReorder<float4>}
+    };
+    // clang-format on
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    const reorder_func_t reorder = funcs[GetLegacyDataType(inData.dtype())][inAccess->numChannels() - 1];
+    NVCV_ASSERT(reorder != 0);
+
+    reorder(inData, outData, interpolation, order, stream);
+    return SUCCESS;
 } //Resize::infer
 
+ErrorCode Resize::inferMulti(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda *const *outData,
+                             const NVCVInterpolationType *interpolation, int numOutputs, cudaStream_t stream)
+{
+    if (numOutputs <= 0)
+    {
+        LOG_ERROR("Invalid number of outputs " << numOutputs);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    if (!inAccess)
+    {
+        LOG_ERROR("Invalid input tensor");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    //outputs are validated as independent resizes of the input
+    for (int o = 0; o < numOutputs; ++o)
+    {
+        if (outData[o]->dtype() != inData.dtype())
+        {
+            LOG_ERROR("Invalid DataType of output " << o);
+            return ErrorCode::INVALID_DATA_TYPE;
+        }
+
+        func_t    func;
+        ErrorCode err = plan(inData.shape(), inData.dtype(), outData[o]->shape(), interpolation[o], func);
+        if (err != SUCCESS)
+        {
+            return err;
+        }
+
+        auto outAccess = TensorDataAccessStridedImagePlanar::Create(*outData[o]);
+        NVCV_ASSERT(outAccess);
+
+        if (outAccess->numSamples() != inAccess->numSamples())
+        {
+            LOG_ERROR("Invalid number of samples of output " << o);
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
+    typedef void (*multi_func_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda *const *outData,
+                                 const NVCVInterpolationType *interpolation, int numOutputs, cudaStream_t stream);
+
+    // clang-format off
+    static const multi_func_t funcs[6][4] = {
+        {      resizeMulti<uchar>,  0 /*resizeMulti<uchar2>*/,       resizeMulti<uchar3>,       resizeMulti<uchar4>},
+        {0 /*resizeMulti<schar>*/,  0 /*resizeMulti<schar2>*/, 0 /*resizeMulti<schar3>*/, 0 /*resizeMulti<schar4>*/},
+        {     resizeMulti<ushort>, 0 /*resizeMulti<ushort2>*/,      resizeMulti<ushort3>,      resizeMulti<ushort4>},
+        {      resizeMulti<short>,  0 /*resizeMulti<short2>*/,       resizeMulti<short3>,       resizeMulti<short4>},
+        {  0 /*resizeMulti<int>*/,    0 /*resizeMulti<int2>*/,   0 /*resizeMulti<int3>*/,   0 /*resizeMulti<int4>*/},
+        {      resizeMulti<float>,  0 /*resizeMulti<float2>*/,       resizeMulti<float3>,       resizeMulti<float4>}
+    };
+    // clang-format on
+
+    cuda_op::DataType data_type = GetLegacyDataType(inData.dtype());
+    int               channels  = inAccess->numChannels();
+
+    const multi_func_t func = funcs[data_type][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    for (int first = 0; first < numOutputs; first += MAX_RESIZE_OUTPUTS)
+    {
+        func(inData, outData + first, interpolation + first, std::min(numOutputs - first, MAX_RESIZE_OUTPUTS),
+             stream);
+    }
+    return SUCCESS;
+} //Resize::inferMulti
+
 } // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,636 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "NormalizeUtils.cuh"
+
+#include <cvcuda/OpResizeNormalizeReformat.h> // for CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB
+#include <nvcv/cuda/MathWrappers.hpp>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace nvcv::legacy::cuda_op {
+
+namespace {
+
+#define BLOCK 32
+
+template<typename T>
+inline __device__ int2 GetSourceSize(const cuda::Tensor3DWrap<const T> &, int2 size, int)
+{
+    return size;
+}
+
+template<typename T>
+inline __device__ int2 GetSourceSize(const cuda::ImageBatchVarShapeWrap<const T> &src, int2, int sample)
+{
+    return int2{src.width(sample), src.height(sample)};
+}
+
+// Source pixels and weight of the linear interpolation along one axis, as in the Resize operator.
+inline __device__ void LinearCoord(int dst, float scale, int srcSize, int &s0, int &s1, float &f)
+{
+    f  = (dst + 0.5f) * scale - 0.5f;
+    s0 = __float2int_rd(f);
+    f -= s0;
+    f *= ((s0 >= 0) && (s0 < srcSize - 1));
+    s0 = cuda::max(0, cuda::min(s0, srcSize - 2));
+
+    // Sources with only one row or column read the same pixel twice.
+    s1 = cuda::min(s0 + 1, srcSize - 1);
+}
+
+// Same coordinate mapping as the Resize operator, but results are kept in float
+// instead of being rounded back to the source type.
+template<class SrcWrapper, typename T = std::remove_const_t<typename SrcWrapper::ValueType>>
+inline __device__ cuda::ConvertBaseTypeTo<float, T> Sample(const SrcWrapper &src, int sample, int2 srcSize,
+                                                           int2 dstSize, int dst_x, int dst_y,
+                                                           NVCVInterpolationType interpolation)
+{
+    const float scale_x = static_cast<float>(srcSize.x) / dstSize.x;
+    const float scale_y = static_cast<float>(srcSize.y) / dstSize.y;
+
+    if (interpolation == NVCV_INTERP_NEAREST)
+    {
+        const int sx = cuda::min(__float2int_rd(dst_x * scale_x), srcSize.x - 1);
+        const int sy = cuda::min(__float2int_rd(dst_y * scale_y), srcSize.y - 1);
+        return cuda::StaticCast<float>(*src.ptr(sample, sy, sx));
+    }
+
+    int   sx, sx1, sy, sy1;
+    float fx, fy;
+    LinearCoord(dst_x, scale_x, srcSize.x, sx, sx1, fx);
+    LinearCoord(dst_y, scale_y, srcSize.y, sy, sy1, fy);
+
+    const T *aPtr = src.ptr(sample, sy, 0);
+    const T *bPtr = src.ptr(sample, sy1, 0);
+
+    return (1.0f - fx) * (aPtr[sx] * (1.0f - fy) + bPtr[sx] * fy) + fx * (aPtr[sx1] * (1.0f - fy) + bPtr[sx1] * fy);
+}
+
+// Resizes the sample, normalizes it and writes each channel to its own plane, all
+// in one pass. Source samples are only read, intermediate results never hit memory.
+template<class SrcWrapper, typename OutT>
+__global__ void resizeNormalizeReformat(SrcWrapper src, int2 srcSize, cuda::Tensor4DWrap<OutT> dst, int2 dstSize,
+                                        NormParams params, NVCVInterpolationType interpolation, bool swapRB)
+{
+    using T                = std::remove_const_t<typename SrcWrapper::ValueType>;
+    constexpr int channels = cuda::NumElements<T>;
+
+    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
+        return;
+
+    int2 sampleSize = GetSourceSize(src, srcSize, batch_idx);
+
+    auto value = Sample(src, batch_idx, sampleSize, dstSize, dst_x, dst_y, interpolation);
+
+#pragma unroll
+    for (int c = 0; c < channels; ++c)
+    {
+        int dst_c = c;
+        if constexpr (channels >= 3)
+        {
+            dst_c = swapRB && c != 1 && c < 3 ? 2 - c : c;
+        }
+
+        *dst.ptr(batch_idx, dst_c, dst_y, dst_x)
+            = cuda::SaturateCast<OutT>(NormalizeValue(params, cuda::GetElement(value, c), batch_idx, dst_c));
+    }
+}
+
+// Luma and interleaved chroma planes of a NV12 (8-bit) or P016 (16-bit) frame, as
+// output by NVDEC. Chroma rows hold U and V of every pair of luma columns.
+template<typename T>
+struct YUV420spPlanes
+{
+    cuda::Tensor3DWrap<const T> luma, chroma;
+
+    int uidx;
+};
+
+// Reads the YUV values of a source pixel, in the 8-bit range. Chroma is taken from the
+// 2x2 block the pixel belongs to, as in the CvtColor operator.
+template<typename T>
+inline __device__ float3 LoadYUV(const YUV420spPlanes<T> &src, int sample, int x, int y)
+{
+    // 16-bit samples hold the value in the most significant bits.
+    constexpr float norm = 1.0f / (1 << (8 * (sizeof(T) - 1)));
+
+    const T *uv = src.chroma.ptr(sample, y >> 1, x & ~1);
+
+    return float3{*src.luma.ptr(sample, y, x) * norm, uv[src.uidx] * norm, uv[src.uidx ^ 1] * norm};
+}
+
+// BT.601 limited range conversion with the same coefficients as the CvtColor operator,
+// saturated to [0, 255] but not rounded.
+inline __device__ float3 YUVToRGB(float3 yuv)
+{
+    const float yy = cuda::max(0.0f, yuv.x - 16.0f) * 1.164f;
+    const float uu = yuv.y - 128.0f;
+    const float vv = yuv.z - 128.0f;
+
+    return cuda::clamp(float3{yy + 1.596f * vv, yy - 0.813f * vv - 0.391f * uu, yy + 2.018f * uu}, 0.0f, 255.0f);
+}
+
+// Crops the region of interest of a YUV 4:2:0 semi-planar frame, converts it to RGB,
+// resizes it, normalizes it and writes each channel to its own plane. Results are the
+// same as those of CvtColor, CustomCrop, Resize and Normalize in sequence, except that
+// intermediate values aren't rounded to uint8.
+template<typename T, typename OutT>
+__global__ void yuv420spResizeNormalizeReformat(YUV420spPlanes<T> src, int4 roi, cuda::Tensor4DWrap<OutT> dst,
+                                                int2 dstSize, NormParams params,
+                                                NVCVInterpolationType interpolation, int bidx)
+{
+    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    if (dst_x >= dstSize.x || dst_y >= dstSize.y)
+        return;
+
+    const float scale_x = static_cast<float>(roi.z) / dstSize.x;
+    const float scale_y = static_cast<float>(roi.w) / dstSize.y;
+
+    float3 rgb;
+
+    if (interpolation == NVCV_INTERP_NEAREST)
+    {
+        const int sx = cuda::min(__float2int_rd(dst_x * scale_x), roi.z - 1) + roi.x;
+        const int sy = cuda::min(__float2int_rd(dst_y * scale_y), roi.w - 1) + roi.y;
+
+        rgb = YUVToRGB(LoadYUV(src, batch_idx, sx, sy));
+    }
+    else
+    {
+        int   sx, sx1, sy, sy1;
+        float fx, fy;
+        LinearCoord(dst_x, scale_x, roi.z, sx, sx1, fx);
+        LinearCoord(dst_y, scale_y, roi.w, sy, sy1, fy);
+
+        sx += roi.x;
+        sx1 += roi.x;
+        sy += roi.y;
+        sy1 += roi.y;
+
+        // Pixels are converted before being interpolated, chroma changes every 2 pixels.
+        const float3 a0 = YUVToRGB(LoadYUV(src, batch_idx, sx, sy));
+        const float3 a1 = YUVToRGB(LoadYUV(src, batch_idx, sx1, sy));
+        const float3 b0 = YUVToRGB(LoadYUV(src, batch_idx, sx, sy1));
+        const float3 b1 = YUVToRGB(LoadYUV(src, batch_idx, sx1, sy1));
+
+        rgb = (1.0f - fx) * (a0 * (1.0f - fy) + b0 * fy) + fx * (a1 * (1.0f - fy) + b1 * fy);
+    }
+
+    const float r = NormalizeValue(params, rgb.x, batch_idx, bidx ^ 2);
+    const float g = NormalizeValue(params, rgb.y, batch_idx, 1);
+    const float b = NormalizeValue(params, rgb.z, batch_idx, bidx);
+
+    *dst.ptr(batch_idx, bidx ^ 2, dst_y, dst_x) = cuda::SaturateCast<OutT>(r);
+    *dst.ptr(batch_idx, 1, dst_y, dst_x)        = cuda::SaturateCast<OutT>(g);
+    *dst.ptr(batch_idx, bidx, dst_y, dst_x)     = cuda::SaturateCast<OutT>(b);
+}
+
+ErrorCode ValidateOutput(const ITensorDataStridedCuda &outData, int numSamples, int channels)
+{
+    if (outData.layout() != TENSOR_NCHW)
+    {
+        LOG_ERROR("Invalid output DataFormat " << GetLegacyDataFormat(outData.layout()) << ", it must be NCHW");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (outData.dtype() != TYPE_F32 && outData.dtype() != TYPE_U8 && outData.dtype() != TYPE_S8)
+    {
+        LOG_ERROR("Invalid output DataType " << outData.dtype() << ", it must be float32, uint8 or int8");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (outData.shape(0) != numSamples || outData.shape(1) != channels)
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must have " << numSamples << " samples and "
+                                          << channels << " channels");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+// Index of the output type in the dispatch tables: float, or quantized uint8 and int8 outputs.
+int OutputTypeIndex(const ITensorDataStridedCuda &outData)
+{
+    return outData.dtype() == TYPE_F32 ? 0 : (outData.dtype() == TYPE_U8 ? 1 : 2);
+}
+
+ErrorCode ValidateArgs(int channels, NVCVInterpolationType interpolation, uint32_t flags)
+{
+    if (channels != 1 && channels != 3 && channels != 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (interpolation != NVCV_INTERP_NEAREST && interpolation != NVCV_INTERP_LINEAR)
+    {
+        LOG_ERROR("Unsupported interpolation method " << interpolation);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if ((flags & CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB) && channels < 3)
+    {
+        LOG_ERROR("Swapping red and blue channels requires at least 3 channels, got " << channels);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    return ErrorCode::SUCCESS;
+}
+
+template<typename OutT, class SrcWrapper>
+void resizeNormalizeReformatWrap(SrcWrapper src, int2 srcSize, const ITensorDataStridedCuda &outData,
+                                 const NormParams &params, NVCVInterpolationType interpolation, bool swapRB,
+                                 cudaStream_t stream)
+{
+    cuda::Tensor4DWrap<OutT> dst(outData);
+
+    int  batch = outData.shape(0);
+    int2 dstSize{static_cast<int>(outData.shape(3)), static_cast<int>(outData.shape(2))};
+
+    dim3 block(BLOCK, BLOCK / 4, 1);
+    dim3 grid(divUp(dstSize.x, block.x), divUp(dstSize.y, block.y), batch);
+
+    resizeNormalizeReformat<<<grid, block, 0, stream>>>(src, srcSize, dst, dstSize, params, interpolation, swapRB);
+    checkKernelErrors();
+}
+
+template<typename T, typename OutT>
+void resizeNormalizeReformatTensor(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                                   const NormParams &params, NVCVInterpolationType interpolation, bool swapRB,
+                                   cudaStream_t stream)
+{
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    int2 srcSize{static_cast<int>(inAccess->numCols()), static_cast<int>(inAccess->numRows())};
+
+    resizeNormalizeReformatWrap<OutT>(cuda::CreateTensorWrapNHW<const T>(inData), srcSize, outData, params,
+                                      interpolation, swapRB, stream);
+}
+
+template<typename T, typename OutT>
+void resizeNormalizeReformatVarShape(const IImageBatchVarShapeDataStridedCuda &inData,
+                                     const ITensorDataStridedCuda &outData, const NormParams &params,
+                                     NVCVInterpolationType interpolation, bool swapRB, cudaStream_t stream)
+{
+    resizeNormalizeReformatWrap<OutT>(cuda::ImageBatchVarShapeWrap<const T>(inData), int2{0, 0}, outData, params,
+                                      interpolation, swapRB, stream);
+}
+
+template<typename T, typename OutT>
+void resizeNormalizeReformatYUV420sp(const ITensorDataStridedCuda &lumaData, const ITensorDataStridedCuda &chromaData,
+                                     int4 roi, const ITensorDataStridedCuda &outData, const NormParams &params,
+                                     NVCVInterpolationType interpolation, int bidx, int uidx, cudaStream_t stream)
+{
+    YUV420spPlanes<T> src;
+    src.luma   = cuda::CreateTensorWrapNHW<const T>(lumaData);
+    src.chroma = cuda::CreateTensorWrapNHW<const T>(chromaData);
+    src.uidx   = uidx;
+
+    cuda::Tensor4DWrap<OutT> dst(outData);
+
+    int  batch = outData.shape(0);
+    int2 dstSize{static_cast<int>(outData.shape(3)), static_cast<int>(outData.shape(2))};
+
+    dim3 block(BLOCK, BLOCK / 4, 1);
+    dim3 grid(divUp(dstSize.x, block.x), divUp(dstSize.y, block.y), batch);
+
+    yuv420spResizeNormalizeReformat<<<grid, block, 0, stream>>>(src, roi, dst, dstSize, params, interpolation, bidx);
+    checkKernelErrors();
+}
+
+} // namespace
+
+size_t ResizeNormalizeReformat::calBufferSize(DataShape max_input_shape, DataShape max_output_shape,
+                                              DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode ResizeNormalizeReformat::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &baseData,
+                                         const ITensorDataStridedCuda &scaleData,
+                                         const ITensorDataStridedCuda &outData,
+                                         const NVCVInterpolationType interpolation, const float global_scale,
+                                         const float shift, const float epsilon, const uint32_t flags,
+                                         cudaStream_t stream)
+{
+    DataFormat format = GetLegacyDataFormat(inData.layout());
+
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid input DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    if (!inAccess)
+    {
+        LOG_ERROR("Invalid input DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataType data_type = GetLegacyDataType(inData.dtype());
+    if (data_type != kCV_8U)
+    {
+        LOG_ERROR("Invalid input DataType " << data_type << ", it must be uint8");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    int numSamples = inAccess->numSamples();
+    int channels   = inAccess->numChannels();
+
+    ErrorCode err = ValidateArgs(channels, interpolation, flags);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if ((err = ValidateOutput(outData, numSamples, channels)) != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    int2 baseSize, scaleSize;
+    if ((err = ValidateNormParam("base", baseData, numSamples, channels, baseSize)) != ErrorCode::SUCCESS
+        || (err = ValidateNormParam("scale", scaleData, numSamples, channels, scaleSize)) != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    NormParams params
+        = CreateNormParams(baseData, baseSize, scaleData, scaleSize, global_scale, shift, epsilon, flags);
+    bool swapRB = (flags & CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB) != 0;
+
+    typedef void (*func_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                           const NormParams &params, NVCVInterpolationType interpolation, bool swapRB,
+                           cudaStream_t stream);
+
+    static const func_t funcs[3][4] = {
+        {resizeNormalizeReformatTensor<uchar1, float>, 0, resizeNormalizeReformatTensor<uchar3, float>,
+         resizeNormalizeReformatTensor<uchar4, float>},
+        {resizeNormalizeReformatTensor<uchar1, uint8_t>, 0, resizeNormalizeReformatTensor<uchar3, uint8_t>,
+         resizeNormalizeReformatTensor<uchar4, uint8_t>},
+        {resizeNormalizeReformatTensor<uchar1, int8_t>, 0, resizeNormalizeReformatTensor<uchar3, int8_t>,
+         resizeNormalizeReformatTensor<uchar4, int8_t>}
+    };
+
+    funcs[OutputTypeIndex(outData)][channels - 1](inData, outData, params, interpolation, swapRB, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+size_t ResizeNormalizeReformatVarShape::calBufferSize(DataShape max_input_shape, DataShape max_output_shape,
+                                                      DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode ResizeNormalizeReformatVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                                 const ITensorDataStridedCuda &baseData,
+                                                 const ITensorDataStridedCuda &scaleData,
+                                                 const ITensorDataStridedCuda &outData,
+                                                 const NVCVInterpolationType interpolation, const float global_scale,
+                                                 const float shift, const float epsilon, const uint32_t flags,
+                                                 cudaStream_t stream)
+{
+    if (!inData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input batch must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataFormat format = GetLegacyDataFormat(inData);
+
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid input DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataType data_type = GetLegacyDataType(inData.uniqueFormat());
+    if (data_type != kCV_8U)
+    {
+        LOG_ERROR("Invalid input DataType " << data_type << ", it must be uint8");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    int numSamples = inData.numImages();
+    int channels   = inData.uniqueFormat().numChannels();
+
+    ErrorCode err = ValidateArgs(channels, interpolation, flags);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if ((err = ValidateOutput(outData, numSamples, channels)) != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    int2 baseSize, scaleSize;
+    if ((err = ValidateNormParam("base", baseData, numSamples, channels, baseSize)) != ErrorCode::SUCCESS
+        || (err = ValidateNormParam("scale", scaleData, numSamples, channels, scaleSize)) != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    NormParams params
+        = CreateNormParams(baseData, baseSize, scaleData, scaleSize, global_scale, shift, epsilon, flags);
+    bool swapRB = (flags & CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB) != 0;
+
+    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
+                           const NormParams &params, NVCVInterpolationType interpolation, bool swapRB,
+                           cudaStream_t stream);
+
+    static const func_t funcs[3][4] = {
+        {resizeNormalizeReformatVarShape<uchar1, float>, 0, resizeNormalizeReformatVarShape<uchar3, float>,
+         resizeNormalizeReformatVarShape<uchar4, float>},
+        {resizeNormalizeReformatVarShape<uchar1, uint8_t>, 0, resizeNormalizeReformatVarShape<uchar3, uint8_t>,
+         resizeNormalizeReformatVarShape<uchar4, uint8_t>},
+        {resizeNormalizeReformatVarShape<uchar1, int8_t>, 0, resizeNormalizeReformatVarShape<uchar3, int8_t>,
+         resizeNormalizeReformatVarShape<uchar4, int8_t>}
+    };
+
+    funcs[OutputTypeIndex(outData)][channels - 1](inData, outData, params, interpolation, swapRB, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+size_t ResizeNormalizeReformatNV12::calBufferSize(DataShape max_input_shape, DataShape max_output_shape,
+                                                  DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode ResizeNormalizeReformatNV12::infer(const ITensorDataStridedCuda &lumaData,
+                                             const ITensorDataStridedCuda &chromaData, const NVCVRectI roi,
+                                             const ITensorDataStridedCuda &baseData,
+                                             const ITensorDataStridedCuda &scaleData,
+                                             const ITensorDataStridedCuda &outData, const NVCVColorConversionCode code,
+                                             const NVCVInterpolationType interpolation, const float global_scale,
+                                             const float shift, const float epsilon, const uint32_t flags,
+                                             cudaStream_t stream)
+{
+    int bidx, uidx;
+    switch (code)
+    {
+    case NVCV_COLOR_YUV2BGR_NV12:
+        bidx = 0, uidx = 0;
+        break;
+    case NVCV_COLOR_YUV2RGB_NV12:
+        bidx = 2, uidx = 0;
+        break;
+    case NVCV_COLOR_YUV2BGR_NV21:
+        bidx = 0, uidx = 1;
+        break;
+    case NVCV_COLOR_YUV2RGB_NV21:
+        bidx = 2, uidx = 1;
+        break;
+    default:
+        LOG_ERROR("Unsupported color conversion code " << code);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    DataFormat format = GetLegacyDataFormat(lumaData.layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid luma DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (GetLegacyDataFormat(chromaData.layout()) != format)
+    {
+        LOG_ERROR("Invalid chroma DataFormat " << GetLegacyDataFormat(chromaData.layout()) << ", it must be "
+                                               << format << " as luma");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataType data_type = GetLegacyDataType(lumaData.dtype());
+    if (data_type != kCV_8U && data_type != kCV_16U)
+    {
+        LOG_ERROR("Invalid luma DataType " << data_type << ", it must be uint8 (NV12) or uint16 (P016)");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (chromaData.dtype() != lumaData.dtype())
+    {
+        LOG_ERROR("Invalid chroma DataType " << chromaData.dtype() << ", it must be the same as luma");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto lumaAccess   = TensorDataAccessStridedImagePlanar::Create(lumaData);
+    auto chromaAccess = TensorDataAccessStridedImagePlanar::Create(chromaData);
+    NVCV_ASSERT(lumaAccess && chromaAccess);
+
+    const int numSamples = lumaAccess->numSamples();
+    const int width      = lumaAccess->numCols();
+    const int height     = lumaAccess->numRows();
+
+    if (lumaAccess->numChannels() != 1 || width % 2 != 0 || height % 2 != 0)
+    {
+        LOG_ERROR("Invalid luma shape " << lumaData.shape() << ", it must have 1 channel and even width and height");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    // Chroma is either [N, H/2, W/2, 2], or [N, H/2, W, 1] as the bottom part of a packed NV12 frame.
+    const int64_t elemSize = data_type == kCV_8U ? sizeof(uint8_t) : sizeof(uint16_t);
+    if (chromaAccess->numSamples() != numSamples || chromaAccess->numRows() != height / 2
+        || chromaAccess->numCols() * chromaAccess->numChannels() != width
+        || (chromaAccess->numChannels() != 1 && chromaAccess->numChannels() != 2)
+        || chromaAccess->colStride() != chromaAccess->numChannels() * elemSize)
+    {
+        LOG_ERROR("Invalid chroma shape " << chromaData.shape() << ", it must be [" << numSamples << ", "
+                                          << height / 2 << ", " << width / 2 << ", 2] or [" << numSamples << ", "
+                                          << height / 2 << ", " << width << ", 1], with packed channels");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    int4 roiRect{roi.x, roi.y, roi.width, roi.height};
+    if (roi.width == 0 && roi.height == 0)
+    {
+        roiRect = int4{0, 0, width, height};
+    }
+
+    if (roiRect.x < 0 || roiRect.y < 0 || roiRect.z <= 0 || roiRect.w <= 0 || roiRect.x + roiRect.z > width
+        || roiRect.y + roiRect.w > height)
+    {
+        LOG_ERROR("Invalid ROI {" << roi.x << ", " << roi.y << ", " << roi.width << ", " << roi.height
+                                  << "}, it must lie in the " << width << "x" << height << " frame");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    constexpr int channels = 3;
+
+    ErrorCode err = ValidateArgs(channels, interpolation, flags);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if ((err = ValidateOutput(outData, numSamples, channels)) != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    int2 baseSize, scaleSize;
+    if ((err = ValidateNormParam("base", baseData, numSamples, channels, baseSize)) != ErrorCode::SUCCESS
+        || (err = ValidateNormParam("scale", scaleData, numSamples, channels, scaleSize)) != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    NormParams params
+        = CreateNormParams(baseData, baseSize, scaleData, scaleSize, global_scale, shift, epsilon, flags);
+
+    if (flags & CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB)
+    {
+        bidx ^= 2;
+    }
+
+    typedef void (*func_t)(const ITensorDataStridedCuda &lumaData, const ITensorDataStridedCuda &chromaData,
+                           int4 roi, const ITensorDataStridedCuda &outData, const NormParams &params,
+                           NVCVInterpolationType interpolation, int bidx, int uidx, cudaStream_t stream);
+
+    static const func_t funcs[2][3] = {
+        {resizeNormalizeReformatYUV420sp<uint8_t, float>, resizeNormalizeReformatYUV420sp<uint8_t, uint8_t>,
+         resizeNormalizeReformatYUV420sp<uint8_t, int8_t>},
+        {resizeNormalizeReformatYUV420sp<uint16_t, float>, resizeNormalizeReformatYUV420sp<uint16_t, uint8_t>,
+         resizeNormalizeReformatYUV420sp<uint16_t, int8_t>}
+    };
+
+    funcs[data_type == kCV_8U ? 0 : 1][OutputTypeIndex(outData)](lumaData, chromaData, roiRect, outData, params,
+                                                                 interpolation, bidx, uidx, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
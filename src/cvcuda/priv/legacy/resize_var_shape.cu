@@ -24,10 +24,14 @@
 #include "CvCudaLegacyHelpers.hpp"
 
 #include "CvCudaUtils.cuh"
+#include "FlatTiles.cuh"
+#include "TinyImages.cuh"
 
 #include <nvcv/cuda/MathWrappers.hpp>
 #include <nvcv/cuda/SaturateCast.hpp>
 
+#include <algorithm>
+
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
 
@@ -99,12 +103,12 @@ inline void __device__ _alignedCudaMemcpyQuadVS(T *pDst, T *pSrc)
 
 //******************** NN = Nearest Neighbor
 
+//the per-pixel functions below hold the math of the generic kernels, shared with resize_multi
+
 template<typename T>
-__global__ void resize_NN(cuda::ImageBatchVarShapeWrap<const T> src, cuda::ImageBatchVarShapeWrap<T> dst)
+inline __device__ void _resizeNN(cuda::ImageBatchVarShapeWrap<const T> src, cuda::ImageBatchVarShapeWrap<T> dst,
+                                 const int batch_idx, const int dst_x, const int dst_y)
 {
-    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
-    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
     const int dstWidth  = dst.width(batch_idx);
     const int dstHeight = dst.height(batch_idx);
 
@@ -119,6 +123,12 @@ __global__ void resize_NN(cuda::ImageBatchVarShapeWrap<const T> src, cuda::Image
         const int   sy                    = cuda::min(__float2int_rd(dst_y * scale_y), height - 1);
         *dst.ptr(batch_idx, dst_y, dst_x) = *src.ptr(batch_idx, sy, sx);
     }
+} //_resizeNN
+
+template<typename T>
+__global__ void resize_NN(cuda::ImageBatchVarShapeWrap<const T> src, cuda::ImageBatchVarShapeWrap<T> dst)
+{
+    _resizeNN(src, dst, get_batch_idx(), blockIdx.x * blockDim.x + threadIdx.x, blockIdx.y * blockDim.y + threadIdx.y);
 } //resize_NN
 
 template<typename T>
@@ -190,11 +200,10 @@ __global__ void resize_NN_quad_combo(cuda::ImageBatchVarShapeWrap<const T> src,
 //******************** Bilinear
 
 template<typename T>
-__global__ void resize_bilinear(cuda::ImageBatchVarShapeWrap<const T> src, cuda::ImageBatchVarShapeWrap<T> dst)
+inline __device__ void _resizeBilinear(cuda::ImageBatchVarShapeWrap<const T> src,
+                                       cuda::ImageBatchVarShapeWrap<T> dst, const int batch_idx, const int dst_x,
+                                       const int dst_y)
 {
-    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
-    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
     const int dstWidth  = dst.width(batch_idx);
     const int dstHeight = dst.height(batch_idx);
 
@@ -231,6 +240,13 @@ __global__ void resize_bilinear(cuda::ImageBatchVarShapeWrap<const T> src, cuda:
                                         + fx * (aPtr[sx + 1] * (1.0f - fy) + bPtr[sx + 1] * fy));
         }
     }
+} //_resizeBilinear
+
+template<typename T>
+__global__ void resize_bilinear(cuda::ImageBatchVarShapeWrap<const T> src, cuda::ImageBatchVarShapeWrap<T> dst)
+{
+    _resizeBilinear(src, dst, get_batch_idx(), blockIdx.x * blockDim.x + threadIdx.x,
+                    blockIdx.y * blockDim.y + threadIdx.y);
 } //resize_bilinear
 
 template<typename T>
@@ -377,11 +393,9 @@ __global__ void resize_bilinear_quad_combo(cuda::ImageBatchVarShapeWrap<const T>
 //******************** Bicubic
 
 template<typename T>
-__global__ void resize_bicubic(cuda::ImageBatchVarShapeWrap<const T> src, cuda::ImageBatchVarShapeWrap<T> dst)
+inline __device__ void _resizeBicubic(cuda::ImageBatchVarShapeWrap<const T> src, cuda::ImageBatchVarShapeWrap<T> dst,
+                                      const int batch_idx, const int dst_x, const int dst_y)
 { //optimized for aligned read
-    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
-    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
     const int dstWidth  = dst.width(batch_idx);
     const int dstHeight = dst.height(batch_idx);
 
@@ -444,6 +458,13 @@ __global__ void resize_bicubic(cuda::ImageBatchVarShapeWrap<const T> src, cuda::
         *dst.ptr(batch_idx, dst_y, dst_x) = cuda::SaturateCast<T>(cuda::abs(accum));
 #endif
     }
+} //_resizeBicubic
+
+template<typename T>
+__global__ void resize_bicubic(cuda::ImageBatchVarShapeWrap<const T> src, cuda::ImageBatchVarShapeWrap<T> dst)
+{
+    _resizeBicubic(src, dst, get_batch_idx(), blockIdx.x * blockDim.x + threadIdx.x,
+                   blockIdx.y * blockDim.y + threadIdx.y);
 } //resize_bicubic
 
 template<typename T>
@@ -635,14 +656,10 @@ __global__ void resize_bicubic_quad_combo(cuda::ImageBatchVarShapeWrap<const T>
 //******************** Integrate area
 
 template<typename T>
-__global__ void resize_area_ocv_align(const cuda::ImageBatchVarShapeWrap<const T>                   src,
-                                      const cuda::BorderVarShapeWrap<const T, NVCV_BORDER_CONSTANT> brd_src,
-                                      cuda::ImageBatchVarShapeWrap<T>                               dst)
+inline __device__ void _resizeArea(const cuda::ImageBatchVarShapeWrap<const T>                   src,
+                                   const cuda::BorderVarShapeWrap<const T, NVCV_BORDER_CONSTANT> brd_src,
+                                   cuda::ImageBatchVarShapeWrap<T> dst, const int batch_idx, const int x, const int y)
 {
-    const int x         = blockDim.x * blockIdx.x + threadIdx.x;
-    const int y         = blockDim.y * blockIdx.y + threadIdx.y;
-    const int batch_idx = get_batch_idx();
-
     int dstWidth  = dst.width(batch_idx);
     int dstHeight = dst.height(batch_idx);
 
@@ -679,17 +696,15 @@ __global__ void resize_area_ocv_align(const cuda::ImageBatchVarShapeWrap<const T
             using work_type = cuda::ConvertBaseTypeTo<float, T>;
             work_type out   = {0};
 
-            int3 srcCoord = {0, 0, batch_idx};
-
+            //the box of an integer factor is always inside the image, read the rows directly without border
+            //checks
             for (int dy = sy1; dy < sy2; ++dy)
             {
-                srcCoord.y = dy;
+                const T *row = src.ptr(batch_idx, dy, 0);
 
                 for (int dx = sx1; dx < sx2; ++dx)
                 {
-                    srcCoord.x = dx;
-
-                    out = out + brd_src[srcCoord] * scale;
+                    out = out + row[dx] * scale;
                 }
             }
             *dst.ptr(batch_idx, y, x) = cuda::SaturateCast<T>(out);
@@ -827,7 +842,16 @@ __global__ void resize_area_ocv_align(const cuda::ImageBatchVarShapeWrap<const T
                                                        + *src.ptr(batch_idx, sy + 1, sx) * cbufx[0] * cbufy[1]
                                                        + *src.ptr(batch_idx, sy, sx + 1) * cbufx[1] * cbufy[0]
                                                        + *src.ptr(batch_idx, sy + 1, sx + 1) * cbufx[1] * cbufy[1]));
-}
+} //_resizeArea
+
+template<typename T>
+__global__ void resize_area_ocv_align(const cuda::ImageBatchVarShapeWrap<const T>                   src,
+                                      const cuda::BorderVarShapeWrap<const T, NVCV_BORDER_CONSTANT> brd_src,
+                                      cuda::ImageBatchVarShapeWrap<T>                               dst)
+{
+    _resizeArea(src, brd_src, dst, get_batch_idx(), blockDim.x * blockIdx.x + threadIdx.x,
+                blockDim.y * blockIdx.y + threadIdx.y);
+} //resize_area_ocv_align
 
 template<class Filter, typename T>
 __global__ void resize_area_v2(const Filter src, cuda_op::Ptr2dVarShapeNHWC<T> dst)
@@ -841,9 +865,70 @@ __global__ void resize_area_v2(const Filter src, cuda_op::Ptr2dVarShapeNHWC<T> d
     *dst.ptr(batch_idx, dst_y, dst_x) = src(batch_idx, dst_y, dst_x);
 }
 
+//per-pixel functor of the flattened resize, with the math of the generic single pixel kernels
+template<typename T>
+struct ResizePixelOp
+{
+    cuda::ImageBatchVarShapeWrap<const T>                   src;
+    cuda::BorderVarShapeWrap<const T, NVCV_BORDER_CONSTANT> brd_src;
+    cuda::ImageBatchVarShapeWrap<T>                         dst;
+    int                                                     interpolation;
+
+    __device__ void operator()(int batch_idx, int dst_x, int dst_y) const
+    {
+        switch (interpolation)
+        {
+        case NVCV_INTERP_NEAREST:
+            _resizeNN(src, dst, batch_idx, dst_x, dst_y);
+            break;
+        case NVCV_INTERP_LINEAR:
+            _resizeBilinear(src, dst, batch_idx, dst_x, dst_y);
+            break;
+        case NVCV_INTERP_CUBIC:
+            _resizeBicubic(src, dst, batch_idx, dst_x, dst_y);
+            break;
+        default:
+            _resizeArea(src, brd_src, dst, batch_idx, dst_x, dst_y);
+            break;
+        }
+    }
+};
+
+//per-pixel functor of the per-sample resize, the interpolation of each sample is read from device memory
+template<typename T>
+struct ResizeSampleOp
+{
+    cuda::ImageBatchVarShapeWrap<const T>                   src;
+    cuda::BorderVarShapeWrap<const T, NVCV_BORDER_CONSTANT> brd_src;
+    cuda::ImageBatchVarShapeWrap<T>                         dst;
+    const int                                              *interpolation;
+    bool                                                    antialias;
+
+    __device__ void operator()(int batch_idx, int dst_x, int dst_y) const
+    {
+        int interp = interpolation[batch_idx];
+
+        //antialiased downscales average the whole footprint of each output pixel
+        const int width = src.width(batch_idx), height = src.height(batch_idx);
+        const int dstWidth = dst.width(batch_idx), dstHeight = dst.height(batch_idx);
+        if (antialias && width >= dstWidth && height >= dstHeight && (width > dstWidth || height > dstHeight))
+        {
+            interp = NVCV_INTERP_AREA;
+        }
+
+        ResizePixelOp<T>{src, brd_src, dst, interp}(batch_idx, dst_x, dst_y);
+    }
+};
+
+template<class PixelOp>
+__global__ void resize_per_sample(const PixelOp op)
+{
+    op(get_batch_idx(), blockIdx.x * blockDim.x + threadIdx.x, blockIdx.y * blockDim.y + threadIdx.y);
+} //resize_per_sample
+
 template<typename T>
 void resize(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda &out,
-            const int interpolation, cudaStream_t stream)
+            const int interpolation, bool flatTiles, cudaStream_t stream)
 {
     NVCV_ASSERT(in.numImages() == out.numImages());
 
@@ -865,6 +950,29 @@ void resize(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarSh
     const int  out_quad_width = outMaxSize.w / 4;
     const dim3 quadGridSize(divUp(out_quad_width, blockSize.x), divUp(outMaxSize.h, blockSize.y), in.numImages());
 
+    //tiny outputs, e.g. crops resized to thumbnails: a warp per image, with many images per block
+    if (IsTinyBatch(out.numImages(), outMaxSize))
+    {
+        cuda::BorderVarShapeWrap<const T, NVCV_BORDER_CONSTANT> brdSrc(in);
+
+        LaunchTinyImages(ResizePixelOp<T>{src_ptr, brdSrc, dst_ptr, interpolation}, dst_ptr, out.numImages(),
+                         outMaxSize, stream);
+        checkKernelErrors();
+        return;
+    }
+
+    //sparse batch, e.g. small images next to a large one: blocks go over the tiles of the images instead of a grid
+    //sized for the largest one. Its grid is persistent, which also keeps launches within the launch budget
+    if ((flatTiles || GetLaunchBudget() > 0) && CanFlatTiles(out.numImages(), blockSize))
+    {
+        cuda::BorderVarShapeWrap<const T, NVCV_BORDER_CONSTANT> brdSrc(in);
+
+        LaunchFlatTiles(ResizePixelOp<T>{src_ptr, brdSrc, dst_ptr, interpolation}, dst_ptr, out.numImages(),
+                        outMaxSize, blockSize, stream);
+        checkKernelErrors();
+        return;
+    }
+
     switch (interpolation)
     {
     case NVCV_INTERP_NEAREST:
@@ -912,11 +1020,317 @@ void resize(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarSh
 #endif
 }
 
-} // namespace
+template<typename T>
+void resizePerSample(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda &out,
+                     const int *interpolation, bool antialias, cudaStream_t stream)
+{
+    NVCV_ASSERT(in.numImages() == out.numImages());
 
-ErrorCode ResizeVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
-                                const IImageBatchVarShapeDataStridedCuda &outData,
-                                const NVCVInterpolationType interpolation, cudaStream_t stream)
+    cuda::ImageBatchVarShapeWrap<const T>                   src_ptr(in);
+    cuda::BorderVarShapeWrap<const T, NVCV_BORDER_CONSTANT> brdSrc(in);
+    cuda::ImageBatchVarShapeWrap<T>                         dst_ptr(out);
+
+    Size2D outMaxSize = out.maxSize();
+
+    const int THREADS_PER_BLOCK = 256;
+    const int BLOCK_WIDTH       = 8;
+
+    const dim3 blockSize(BLOCK_WIDTH, THREADS_PER_BLOCK / BLOCK_WIDTH, 1);
+
+    ResizeSampleOp<T> op{src_ptr, brdSrc, dst_ptr, interpolation, antialias};
+
+    //samples of mixed batches usually have different sizes, blocks go over the tiles of the images when possible,
+    //or a warp takes each image when they're all tiny
+    if (IsTinyBatch(out.numImages(), outMaxSize))
+    {
+        LaunchTinyImages(op, dst_ptr, out.numImages(), outMaxSize, stream);
+    }
+    else if (CanFlatTiles(out.numImages(), blockSize))
+    {
+        LaunchFlatTiles(op, dst_ptr, out.numImages(), outMaxSize, blockSize, stream);
+    }
+    else
+    {
+        const dim3 gridSize(divUp(outMaxSize.w, blockSize.x), divUp(outMaxSize.h, blockSize.y), in.numImages());
+        resize_per_sample<<<gridSize, blockSize, 0, stream>>>(op);
+    }
+    checkKernelErrors();
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
+#define MAX_RESIZE_OUTPUTS 8
+
+//outputs of a single resize_multi launch, each with its own interpolation
+template<typename T>
+struct ResizeOutputs
+{
+    cuda::ImageBatchVarShapeWrap<T> dst[MAX_RESIZE_OUTPUTS];
+    NVCVInterpolationType           interpolation[MAX_RESIZE_OUTPUTS];
+    int                             blocksX[MAX_RESIZE_OUTPUTS];        //number of blocks along the widest row
+    int                             firstBlock[MAX_RESIZE_OUTPUTS + 1]; //first block of each output along x
+};
+
+template<typename T>
+__global__ void resize_multi(const cuda::ImageBatchVarShapeWrap<const T>                   src,
+                             const cuda::BorderVarShapeWrap<const T, NVCV_BORDER_CONSTANT> brd_src,
+                             const ResizeOutputs<T>                                        outputs)
+{ //blocks along the x axis of the grid are split between the outputs, so that all of them are written while the
+  //input is resident in L2; each output uses the math of the generic single pixel kernel of its interpolation
+    int out = 0;
+    while ((int)blockIdx.x >= outputs.firstBlock[out + 1]) ++out;
+
+    const int block     = (int)blockIdx.x - outputs.firstBlock[out];
+    const int dst_x     = (block % outputs.blocksX[out]) * blockDim.x + threadIdx.x;
+    const int dst_y     = (block / outputs.blocksX[out]) * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    switch (outputs.interpolation[out])
+    {
+    case NVCV_INTERP_NEAREST:
+        _resizeNN(src, outputs.dst[out], batch_idx, dst_x, dst_y);
+        break;
+    case NVCV_INTERP_LINEAR:
+        _resizeBilinear(src, outputs.dst[out], batch_idx, dst_x, dst_y);
+        break;
+    case NVCV_INTERP_CUBIC:
+        _resizeBicubic(src, outputs.dst[out], batch_idx, dst_x, dst_y);
+        break;
+    default:
+        _resizeArea(src, brd_src, outputs.dst[out], batch_idx, dst_x, dst_y);
+        break;
+    }
+} //resize_multi
+
+template<typename T>
+void resizeMulti(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda *const *out,
+                 const NVCVInterpolationType *interpolation, int numOutputs, cudaStream_t stream)
+{
+    NVCV_ASSERT(numOutputs > 0 && numOutputs <= MAX_RESIZE_OUTPUTS);
+
+    const int THREADS_PER_BLOCK = 256;
+    const int BLOCK_WIDTH       = 8;
+
+    const dim3 blockSize(BLOCK_WIDTH, THREADS_PER_BLOCK / BLOCK_WIDTH, 1);
+
+    ResizeOutputs<T> outputs;
+    outputs.firstBlock[0] = 0;
+    for (int o = 0; o < MAX_RESIZE_OUTPUTS; ++o)
+    {
+        int numBlocks = 0;
+        if (o < numOutputs)
+        {
+            NVCV_ASSERT(in.numImages() == out[o]->numImages());
+
+            Size2D outMaxSize = out[o]->maxSize();
+
+            outputs.dst[o]           = cuda::ImageBatchVarShapeWrap<T>(*out[o]);
+            outputs.interpolation[o] = interpolation[o];
+            outputs.blocksX[o]       = divUp(outMaxSize.w, blockSize.x);
+            numBlocks                = outputs.blocksX[o] * divUp(outMaxSize.h, blockSize.y);
+        }
+        outputs.firstBlock[o + 1] = outputs.firstBlock[o] + numBlocks;
+    }
+
+    const dim3 gridSize(outputs.firstBlock[numOutputs], 1, in.numImages());
+
+    cuda::ImageBatchVarShapeWrap<const T>                   src_ptr(in);
+    cuda::BorderVarShapeWrap<const T, NVCV_BORDER_CONSTANT> brdSrc(in);
+
+    resize_multi<T><<<gridSize, blockSize, 0, stream>>>(src_ptr, brdSrc, outputs);
+    checkKernelErrors();
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
+//******************** Multi-plane YUV (NV12, NV21, I420, ...)
+
+//plane 0 is luma, the other planes are subsampled by 'factor' and their sample i sits at luma coordinate
+//factor * i + site. Source coordinates are derived in luma space so that chroma stays aligned with luma after the
+//resize whatever the chroma location of the format is
+template<typename T>
+__global__ void resize_yuv_plane(cuda::ImageBatchVarShapeWrap<const T> src, cuda::ImageBatchVarShapeWrap<T> dst,
+                                 const int plane, const int2 factor, const float2 site, const int interpolation)
+{
+    const int dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
+    const int dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+
+    if ((dst_x >= dst.width(batch_idx, plane)) | (dst_y >= dst.height(batch_idx, plane)))
+        return;
+
+    const int width  = src.width(batch_idx, plane);
+    const int height = src.height(batch_idx, plane);
+
+    const float scale_x = static_cast<float>(src.width(batch_idx, 0)) / dst.width(batch_idx, 0);
+    const float scale_y = static_cast<float>(src.height(batch_idx, 0)) / dst.height(batch_idx, 0);
+
+    //luma coordinates of the output sample
+    const float lx = factor.x * dst_x + site.x;
+    const float ly = factor.y * dst_y + site.y;
+
+    if (interpolation == NVCV_INTERP_NEAREST)
+    {
+        const int sx = cuda::max(0, cuda::min(__float2int_rd((lx * scale_x - site.x) / factor.x), width - 1));
+        const int sy = cuda::max(0, cuda::min(__float2int_rd((ly * scale_y - site.y) / factor.y), height - 1));
+        *dst.ptr(batch_idx, plane, dst_y, dst_x) = *src.ptr(batch_idx, plane, sy, sx);
+        return;
+    }
+
+    //position of the output sample in the source plane, in pixel index units
+    const float fx = ((lx + 0.5f) * scale_x - 0.5f - site.x) / factor.x;
+    const float fy = ((ly + 0.5f) * scale_y - 0.5f - site.y) / factor.y;
+
+    using work_type = cuda::ConvertBaseTypeTo<float, T>;
+
+    if (interpolation == NVCV_INTERP_AREA && scale_x >= 1.f && scale_y >= 1.f)
+    { //box over the footprint of the output sample, clamped to the plane
+        const float x0 = fx + 0.5f - 0.5f * scale_x, x1 = fx + 0.5f + 0.5f * scale_x;
+        const float y0 = fy + 0.5f - 0.5f * scale_y, y1 = fy + 0.5f + 0.5f * scale_y;
+
+        work_type sum  = cuda::SetAll<work_type>(0);
+        float     area = 0;
+        for (int sy = __float2int_rd(y0); sy < y1; ++sy)
+        {
+            const float wy  = cuda::min(y1, sy + 1.f) - cuda::max(y0, (float)sy);
+            const T    *row = src.ptr(batch_idx, plane, cuda::max(0, cuda::min(sy, height - 1)), 0);
+            for (int sx = __float2int_rd(x0); sx < x1; ++sx)
+            {
+                const float w = wy * (cuda::min(x1, sx + 1.f) - cuda::max(x0, (float)sx));
+                sum += row[cuda::max(0, cuda::min(sx, width - 1))] * w;
+                area += w;
+            }
+        }
+        *dst.ptr(batch_idx, plane, dst_y, dst_x) = cuda::SaturateCast<T>(sum / area);
+        return;
+    }
+
+    //bilinear, also used by upscales with area interpolation
+    int   sx = __float2int_rd(fx);
+    int   sy = __float2int_rd(fy);
+    float wx = (fx - sx) * ((sx >= 0) && (sx < width - 1));
+    float wy = (fy - sy) * ((sy >= 0) && (sy < height - 1));
+    sx       = cuda::max(0, cuda::min(sx, width - 2));
+    sy       = cuda::max(0, cuda::min(sy, height - 2));
+
+    const T *aPtr = src.ptr(batch_idx, plane, sy, 0);
+    const T *bPtr = src.ptr(batch_idx, plane, sy + 1, 0);
+
+    *dst.ptr(batch_idx, plane, dst_y, dst_x)
+        = cuda::SaturateCast<T>((1.0f - wx) * (aPtr[sx] * (1.0f - wy) + bPtr[sx] * wy)
+                                + wx * (aPtr[sx + 1] * (1.0f - wy) + bPtr[sx + 1] * wy));
+} //resize_yuv_plane
+
+template<typename T>
+void resizeYUVPlane(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda &out,
+                    int plane, int2 factor, float2 site, int interpolation, cudaStream_t stream)
+{
+    cuda::ImageBatchVarShapeWrap<const T> src_ptr(in);
+    cuda::ImageBatchVarShapeWrap<T>       dst_ptr(out);
+
+    Size2D outMaxSize = out.maxSize();
+
+    const dim3 blockSize(32, 8, 1);
+    const dim3 gridSize(divUp(divUp(outMaxSize.w, factor.x), blockSize.x),
+                        divUp(divUp(outMaxSize.h, factor.y), blockSize.y), in.numImages());
+
+    resize_yuv_plane<T><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, plane, factor, site, interpolation);
+    checkKernelErrors();
+}
+
+//luma coordinate of the first chroma sample of a plane subsampled by factor
+float ChromaSite(ChromaLocation loc, int factor)
+{
+    switch (loc)
+    {
+    case ChromaLocation::EVEN:
+        return 0.f;
+    case ChromaLocation::ODD:
+        return factor - 1.f;
+    default:
+        return 0.5f * (factor - 1);
+    }
+}
+
+//semi-planar and planar YUV images are resized plane by plane, so that they can be downscaled before the color
+//conversion to RGB
+ErrorCode resizeMultiPlane(const IImageBatchVarShapeDataStridedCuda &inData,
+                           const IImageBatchVarShapeDataStridedCuda &outData, const NVCVInterpolationType interpolation,
+                           cudaStream_t stream)
+{
+    ImageFormat format = inData.uniqueFormat();
+
+    if (outData.uniqueFormat() != format)
+    {
+        LOG_ERROR("Output images must have the same multi-plane format as the input, " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (outData.numImages() != inData.numImages())
+    {
+        LOG_ERROR("Invalid number of output images " << outData.numImages() << ", it must be "
+                                                     << inData.numImages());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (format.colorModel() != ColorModel::YCbCr || format.numPlanes() > 3)
+    {
+        LOG_ERROR("Invalid multi-plane format " << format << ", only YUV formats are supported");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    for (int p = 0; p < format.numPlanes(); ++p)
+    {
+        if (format.dataKind() != DataKind::UNSIGNED || format.planeNumChannels(p) > 2
+            || format.planeBitsPerPixel(p) != 8 * format.planeNumChannels(p))
+        {
+            LOG_ERROR("Invalid plane " << p << " of format " << format << ", planes must be 8-bit unsigned with "
+                                       << "up to 2 channels");
+            return ErrorCode::INVALID_DATA_TYPE;
+        }
+    }
+
+    if (!(interpolation == NVCV_INTERP_NEAREST || interpolation == NVCV_INTERP_LINEAR
+          || interpolation == NVCV_INTERP_AREA))
+    {
+        LOG_ERROR("Invalid interpolation " << interpolation << " for multi-plane images");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    const ChromaSubsampling css    = format.chromaSubsampling();
+    const int2              factor = {4 / GetSamplesHoriz(css), 4 / GetSamplesVert(css)};
+    const float2            site   = {ChromaSite(format.colorSpec().chromaLocHoriz(), factor.x),
+                                      ChromaSite(format.colorSpec().chromaLocVert(), factor.y)};
+
+    resizeYUVPlane<uchar>(inData, outData, 0, int2{1, 1}, float2{0.f, 0.f}, interpolation, stream);
+    for (int p = 1; p < format.numPlanes(); ++p)
+    {
+        if (format.planeNumChannels(p) == 2)
+        {
+            resizeYUVPlane<uchar2>(inData, outData, p, factor, site, interpolation, stream);
+        }
+        else
+        {
+            resizeYUVPlane<uchar>(inData, outData, p, factor, site, interpolation, stream);
+        }
+    }
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode checkResizeVarShape(const IImageBatchVarShapeDataStridedCuda &inData,
+                              const IImageBatchVarShapeDataStridedCuda &outData,
+                              const NVCVInterpolationType interpolation, DataType &data_type, int &channels)
 {
     DataFormat input_format  = helpers::GetLegacyDataFormat(inData);
     DataFormat output_format = helpers::GetLegacyDataFormat(outData);
@@ -941,7 +1355,7 @@ ErrorCode ResizeVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData
         return ErrorCode::INVALID_DATA_FORMAT;
     }
 
-    int channels = inData.uniqueFormat().numChannels();
+    channels = inData.uniqueFormat().numChannels();
 
     if (channels > 4)
     {
@@ -949,7 +1363,7 @@ ErrorCode ResizeVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData
         return ErrorCode::INVALID_DATA_SHAPE;
     }
 
-    DataType data_type = helpers::GetLegacyDataType(inData.uniqueFormat());
+    data_type = helpers::GetLegacyDataType(inData.uniqueFormat());
 
     if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_16S || data_type == kCV_32F))
     {
@@ -964,8 +1378,30 @@ ErrorCode ResizeVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData
         return ErrorCode::INVALID_PARAMETER;
     }
 
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+ErrorCode ResizeVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                const IImageBatchVarShapeDataStridedCuda &outData,
+                                const NVCVInterpolationType interpolation, cudaStream_t stream, bool flatTiles)
+{
+    if (inData.uniqueFormat() && inData.uniqueFormat().numPlanes() > 1)
+    {
+        return resizeMultiPlane(inData, outData, interpolation, stream);
+    }
+
+    DataType  data_type;
+    int       channels;
+    ErrorCode err = checkResizeVarShape(inData, outData, interpolation, data_type, channels);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
     typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda &out,
-                           const int interpolation, cudaStream_t stream);
+                           const int interpolation, bool flatTiles, cudaStream_t stream);
 
     static const func_t funcs[6][4] = {
         {      resize<uchar>,  0 /*resize<uchar2>*/,      resize<uchar3>,      resize<uchar4>},
@@ -979,8 +1415,111 @@ ErrorCode ResizeVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData
     const func_t func = funcs[data_type][channels - 1];
 
     assert(func != 0);
-    func(inData, outData, interpolation, stream);
+    func(inData, outData, interpolation, flatTiles, stream);
     return ErrorCode::SUCCESS;
 } // namespace
 
+ErrorCode ResizeVarShape::inferPerSample(const IImageBatchVarShapeDataStridedCuda &inData,
+                                         const IImageBatchVarShapeDataStridedCuda &outData,
+                                         const ITensorDataStridedCuda &interpData, bool antialias,
+                                         cudaStream_t stream)
+{
+    //interpolations are only known on the device, any valid one lets the rest of the arguments be checked
+    DataType  data_type;
+    int       channels;
+    ErrorCode err = checkResizeVarShape(inData, outData, NVCV_INTERP_NEAREST, data_type, channels);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    if (outData.numImages() != inData.numImages())
+    {
+        LOG_ERROR("Invalid number of output images " << outData.numImages() << ", it must be "
+                                                     << inData.numImages());
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (interpData.dtype() != nvcv::TYPE_S32 || interpData.rank() != 1 || interpData.shape(0) != inData.numImages()
+        || interpData.stride(0) != sizeof(int32_t))
+    {
+        LOG_ERROR("Invalid interpolation tensor " << interpData.shape() << ", it must hold one packed 32-bit "
+                                                  << "signed integer per image");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda &out,
+                           const int *interpolation, bool antialias, cudaStream_t stream);
+
+    // clang-format off
+    static const func_t funcs[6][4] = {
+        {      resizePerSample<uchar>,  0 /*resizePerSample<uchar2>*/,      resizePerSample<uchar3>,      resizePerSample<uchar4>},
+        {0 /*resizePerSample<schar>*/,   0 /*resizePerSample<char2>*/, 0 /*resizePerSample<char3>*/, 0 /*resizePerSample<char4>*/},
+        {     resizePerSample<ushort>, 0 /*resizePerSample<ushort2>*/,     resizePerSample<ushort3>,     resizePerSample<ushort4>},
+        {      resizePerSample<short>,  0 /*resizePerSample<short2>*/,      resizePerSample<short3>,      resizePerSample<short4>},
+        {  0 /*resizePerSample<int>*/,    0 /*resizePerSample<int2>*/,  0 /*resizePerSample<int3>*/,  0 /*resizePerSample<int4>*/},
+        {      resizePerSample<float>,  0 /*resizePerSample<float2>*/,      resizePerSample<float3>,      resizePerSample<float4>}
+    };
+    // clang-format on
+
+    const func_t func = funcs[data_type][channels - 1];
+    assert(func != 0);
+
+    func(inData, outData, reinterpret_cast<const int *>(interpData.basePtr()), antialias, stream);
+    return ErrorCode::SUCCESS;
+} //ResizeVarShape::inferPerSample
+
+ErrorCode ResizeVarShape::inferMulti(const IImageBatchVarShapeDataStridedCuda        &inData,
+                                     const IImageBatchVarShapeDataStridedCuda *const *outData,
+                                     const NVCVInterpolationType *interpolation, int numOutputs, cudaStream_t stream)
+{
+    if (numOutputs <= 0)
+    {
+        LOG_ERROR("Invalid number of outputs " << numOutputs);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    DataType data_type;
+    int      channels;
+    for (int o = 0; o < numOutputs; ++o)
+    {
+        ErrorCode err = checkResizeVarShape(inData, *outData[o], interpolation[o], data_type, channels);
+        if (err != ErrorCode::SUCCESS)
+        {
+            return err;
+        }
+
+        if (outData[o]->numImages() != inData.numImages())
+        {
+            LOG_ERROR("Invalid number of images of output " << o);
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
+    typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &in,
+                           const IImageBatchVarShapeDataStridedCuda *const *out,
+                           const NVCVInterpolationType *interpolation, int numOutputs, cudaStream_t stream);
+
+    // clang-format off
+    static const func_t funcs[6][4] = {
+        {      resizeMulti<uchar>,  0 /*resizeMulti<uchar2>*/,      resizeMulti<uchar3>,      resizeMulti<uchar4>},
+        {0 /*resizeMulti<schar>*/,   0 /*resizeMulti<char2>*/, 0 /*resizeMulti<char3>*/, 0 /*resizeMulti<char4>*/},
+        {     resizeMulti<ushort>, 0 /*resizeMulti<ushort2>*/,     resizeMulti<ushort3>,     resizeMulti<ushort4>},
+        {      resizeMulti<short>,  0 /*resizeMulti<short2>*/,      resizeMulti<short3>,      resizeMulti<short4>},
+        {  0 /*resizeMulti<int>*/,    0 /*resizeMulti<int2>*/,  0 /*resizeMulti<int3>*/,  0 /*resizeMulti<int4>*/},
+        {      resizeMulti<float>,  0 /*resizeMulti<float2>*/,      resizeMulti<float3>,      resizeMulti<float4>}
+    };
+    // clang-format on
+
+    const func_t func = funcs[data_type][channels - 1];
+    assert(func != 0);
+
+    for (int first = 0; first < numOutputs; first += MAX_RESIZE_OUTPUTS)
+    {
+        func(inData, outData + first, interpolation + first, std::min(numOutputs - first, MAX_RESIZE_OUTPUTS),
+             stream);
+    }
+    return ErrorCode::SUCCESS;
+} //ResizeVarShape::inferMulti
+
 } // namespace nvcv::legacy::cuda_op
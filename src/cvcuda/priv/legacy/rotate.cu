@@ -23,24 +23,49 @@
 
 #include "CvCudaUtils.cuh"
 
+#include <cmath>
+
 #define BLOCK 32
 #define PI    3.1415926535897932384626433832795
 
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
 
-__global__ void compute_warpAffine(const double angle, const double xShift, const double yShift, double *aCoeffs)
+// Rotation coefficients, passed by value to the kernels. The double-precision
+// coordinate math is slow on GPUs with low FP64 throughput, the float variant
+// is used there instead.
+template<typename CoeffT>
+struct RotateCoeffs
+{
+    CoeffT c[6];
+};
+
+template<typename CoeffT>
+RotateCoeffs<CoeffT> compute_warpAffine(const double angle, const double xShift, const double yShift)
 {
-    aCoeffs[0] = cos(angle * PI / 180);
-    aCoeffs[1] = sin(angle * PI / 180);
-    aCoeffs[2] = xShift;
-    aCoeffs[3] = -sin(angle * PI / 180);
-    aCoeffs[4] = cos(angle * PI / 180);
-    aCoeffs[5] = yShift;
+    // sin/cos are always evaluated in double, only the result is rounded to CoeffT
+    RotateCoeffs<CoeffT> coeffs;
+    coeffs.c[0] = cos(angle * PI / 180);
+    coeffs.c[1] = sin(angle * PI / 180);
+    coeffs.c[2] = xShift;
+    coeffs.c[3] = -sin(angle * PI / 180);
+    coeffs.c[4] = cos(angle * PI / 180);
+    coeffs.c[5] = yShift;
+    return coeffs;
 }
 
-template<typename T>
-__global__ void rotate_linear(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, const double *d_aCoeffs)
+template<typename CoeffT>
+__device__ __forceinline__ float2 rotate_src_coord(const int dst_x, const int dst_y, const RotateCoeffs<CoeffT> &coeffs)
+{
+    const CoeffT *c           = coeffs.c;
+    const CoeffT  dst_x_shift = dst_x - c[2];
+    const CoeffT  dst_y_shift = dst_y - c[5];
+    return make_float2((float)(dst_x_shift * c[0] + dst_y_shift * (-c[1])),
+                       (float)(dst_x_shift * (-c[3]) + dst_y_shift * c[4]));
+}
+
+template<typename T, typename CoeffT>
+__global__ void rotate_linear(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, const RotateCoeffs<CoeffT> coeffs)
 {
     int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
     int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
@@ -49,12 +74,11 @@ __global__ void rotate_linear(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, const do
     const int batch_idx = get_batch_idx();
     int       height = src.rows, width = src.cols;
 
-    const double dst_x_shift = dst_x - d_aCoeffs[2];
-    const double dst_y_shift = dst_y - d_aCoeffs[5];
-    float        src_x       = (float)(dst_x_shift * d_aCoeffs[0] + dst_y_shift * (-d_aCoeffs[1]));
-    float        src_y       = (float)(dst_x_shift * (-d_aCoeffs[3]) + dst_y_shift * d_aCoeffs[4]);
+    const float2 src_coord = rotate_src_coord(dst_x, dst_y, coeffs);
+    const float  src_x     = src_coord.x;
+    const float  src_y     = src_coord.y;
 
-    if (src_x > -0.5 && src_x < width && src_y > -0.5 && src_y < height)
+    if (src_x > -0.5f && src_x < width && src_y > -0.5f && src_y < height)
     {
         using work_type = nvcv::cuda::ConvertBaseTypeTo<float, T>;
         work_type out   = nvcv::cuda::SetAll<work_type>(0);
@@ -82,8 +106,8 @@ __global__ void rotate_linear(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, const do
     }
 }
 
-template<typename T>
-__global__ void rotate_nearest(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, const double *d_aCoeffs)
+template<typename T, typename CoeffT>
+__global__ void rotate_nearest(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, const RotateCoeffs<CoeffT> coeffs)
 {
     int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
     int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
@@ -92,24 +116,22 @@ __global__ void rotate_nearest(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, const d
     const int batch_idx = get_batch_idx();
     int       height = src.rows, width = src.cols;
 
-    const double dst_x_shift = dst_x - d_aCoeffs[2];
-    const double dst_y_shift = dst_y - d_aCoeffs[5];
-
-    float src_x = (float)(dst_x_shift * d_aCoeffs[0] + dst_y_shift * (-d_aCoeffs[1]));
-    float src_y = (float)(dst_x_shift * (-d_aCoeffs[3]) + dst_y_shift * d_aCoeffs[4]);
+    const float2 src_coord = rotate_src_coord(dst_x, dst_y, coeffs);
+    const float  src_x     = src_coord.x;
+    const float  src_y     = src_coord.y;
 
-    if (src_x > -0.5 && src_x < width && src_y > -0.5 && src_y < height)
+    if (src_x > -0.5f && src_x < width && src_y > -0.5f && src_y < height)
     {
-        const int x1 = min(__float2int_rz(src_x + 0.5), width - 1);
-        const int y1 = min(__float2int_rz(src_y + 0.5), height - 1);
+        const int x1 = min(__float2int_rz(src_x + 0.5f), width - 1);
+        const int y1 = min(__float2int_rz(src_y + 0.5f), height - 1);
 
         *dst.ptr(batch_idx, dst_y, dst_x) = *src.ptr(batch_idx, y1, x1);
     }
 }
 
-template<typename T>
+template<typename T, typename CoeffT>
 __global__ void rotate_cubic(CubicFilter<BorderReader<Ptr2dNHWC<T>, BrdReplicate<T>>> filteredSrc, Ptr2dNHWC<T> dst,
-                             const double *d_aCoeffs)
+                             const RotateCoeffs<CoeffT> coeffs)
 {
     int dst_x = blockIdx.x * blockDim.x + threadIdx.x;
     int dst_y = blockIdx.y * blockDim.y + threadIdx.y;
@@ -118,45 +140,28 @@ __global__ void rotate_cubic(CubicFilter<BorderReader<Ptr2dNHWC<T>, BrdReplicate
     const int batch_idx = get_batch_idx();
     int       height = filteredSrc.src.ptr.rows, width = filteredSrc.src.ptr.cols;
 
-    const double dst_x_shift = dst_x - d_aCoeffs[2];
-    const double dst_y_shift = dst_y - d_aCoeffs[5];
-
-    float src_x = (float)(dst_x_shift * d_aCoeffs[0] + dst_y_shift * (-d_aCoeffs[1]));
-    float src_y = (float)(dst_x_shift * (-d_aCoeffs[3]) + dst_y_shift * d_aCoeffs[4]);
+    const float2 src_coord = rotate_src_coord(dst_x, dst_y, coeffs);
+    const float  src_x     = src_coord.x;
+    const float  src_y     = src_coord.y;
 
-    if (src_x > -0.5 && src_x < width && src_y > -0.5 && src_y < height)
+    if (src_x > -0.5f && src_x < width && src_y > -0.5f && src_y < height)
     {
         *dst.ptr(batch_idx, dst_y, dst_x) = filteredSrc(batch_idx, src_y, src_x);
     }
 }
 
-template<typename T> // uchar3 float3 uchar1 float3
-void rotate(const nvcv::TensorDataAccessStridedImagePlanar &inData,
-            const nvcv::TensorDataAccessStridedImagePlanar &outData, double *d_aCoeffs, const double angleDeg,
-            const double2 shift, const NVCVInterpolationType interpolation, cudaStream_t stream)
+template<typename T, typename CoeffT>
+void rotate_caller(const Ptr2dNHWC<T> &src_ptr, const Ptr2dNHWC<T> &dst_ptr, const RotateCoeffs<CoeffT> &coeffs,
+                   const NVCVInterpolationType interpolation, dim3 gridSize, dim3 blockSize, cudaStream_t stream)
 {
-    const int batch_size = inData.numSamples();
-    const int in_width   = inData.numCols();
-    const int in_height  = inData.numRows();
-    const int out_width  = outData.numCols();
-    const int out_height = outData.numRows();
-
-    compute_warpAffine<<<1, 1, 0, stream>>>(angleDeg, shift.x, shift.y, d_aCoeffs);
-    checkKernelErrors();
-
-    dim3         blockSize(BLOCK, BLOCK / 4, 1);
-    dim3         gridSize(divUp(out_width, blockSize.x), divUp(out_height, blockSize.y), batch_size);
-    Ptr2dNHWC<T> src_ptr(inData);  //batch_size, height, width, channels, (T *) d_in);
-    Ptr2dNHWC<T> dst_ptr(outData); //batch_size, out_height, out_width, channels, (T *) d_out);
-
     if (interpolation == NVCV_INTERP_LINEAR)
     {
-        rotate_linear<T><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, d_aCoeffs);
+        rotate_linear<T><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, coeffs);
         checkKernelErrors();
     }
     else if (interpolation == NVCV_INTERP_NEAREST)
     {
-        rotate_nearest<T><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, d_aCoeffs);
+        rotate_nearest<T><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, coeffs);
         checkKernelErrors();
     }
     else if (interpolation == NVCV_INTERP_CUBIC)
@@ -165,47 +170,183 @@ void rotate(const nvcv::TensorDataAccessStridedImagePlanar &inData,
         BorderReader<Ptr2dNHWC<T>, BrdReplicate<T>>              brdSrc(src_ptr, brd);
         CubicFilter<BorderReader<Ptr2dNHWC<T>, BrdReplicate<T>>> filteredSrc(brdSrc);
 
-        rotate_cubic<T><<<gridSize, blockSize, 0, stream>>>(filteredSrc, dst_ptr, d_aCoeffs);
+        rotate_cubic<T><<<gridSize, blockSize, 0, stream>>>(filteredSrc, dst_ptr, coeffs);
         checkKernelErrors();
     }
-
-#ifdef CUDA_DEBUG_LOG
-    checkCudaErrors(cudaStreamSynchronize(stream));
-    checkCudaErrors(cudaGetLastError());
-#endif
 }
 
-namespace nvcv::legacy::cuda_op {
+// Source pixel of the output pixel (x, y) for K quarter turns and an integer shift, the mapping of
+// rotate_src_coord with exact sines and cosines
+template<int K>
+__device__ __forceinline__ int2 right_angle_src_coord(int x, int y, const int2 shift)
+{
+    x -= shift.x;
+    y -= shift.y;
+    if (K == 0)
+        return make_int2(x, y);
+    else if (K == 1)
+        return make_int2(-y, x);
+    else if (K == 2)
+        return make_int2(-x, -y);
+    else
+        return make_int2(y, -x);
+}
 
-Rotate::Rotate(DataShape max_input_shape, DataShape max_output_shape)
-    : CudaBaseOp(max_input_shape, max_output_shape)
-    , d_aCoeffs(nullptr)
+// Right-angle rotations move whole pixels, every interpolation reduces to a copy of the pixels whose source is
+// inside the input, others are left untouched as in the generic kernels. Each block handles a BLOCK x BLOCK tile.
+template<int K, typename T>
+__global__ void rotate_right_angle(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, const int2 shift)
 {
-    size_t      bufferSize = calBufferSize(max_input_shape, max_output_shape, DataType::kCV_8U /*not in use*/);
-    cudaError_t err        = cudaMalloc(&d_aCoeffs, bufferSize);
-    if (err != cudaSuccess)
+    const int batch_idx = get_batch_idx();
+    const int dst_x     = blockIdx.x * BLOCK + threadIdx.x;
+    const int dst_y_end = min(static_cast<int>(blockIdx.y + 1) * BLOCK, dst.rows);
+    if (dst_x >= dst.cols)
+        return;
+
+    for (int dst_y = blockIdx.y * BLOCK + threadIdx.y; dst_y < dst_y_end; dst_y += blockDim.y)
     {
-        LOG_ERROR("CUDA memory allocation error of size: " << bufferSize);
-        throw std::runtime_error("CUDA memory allocation error!");
+        const int2 src_coord = right_angle_src_coord<K>(dst_x, dst_y, shift);
+        if (src_coord.x >= 0 && src_coord.x < src.cols && src_coord.y >= 0 && src_coord.y < src.rows)
+        {
+            *dst.ptr(batch_idx, dst_y, dst_x) = *src.ptr(batch_idx, src_coord.y, src_coord.x);
+        }
     }
 }
 
-Rotate::~Rotate()
+// Quarter and three-quarter turns are transposes, the source tile of the output tile is staged in shared memory
+// so that both reads and writes are coalesced. Padding the tile rows avoids bank conflicts on the column reads.
+template<int K, typename T>
+__global__ void rotate_right_angle_transpose(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, const int2 shift)
 {
-    if (d_aCoeffs != nullptr)
+    __shared__ T tile[BLOCK][BLOCK + 1];
+
+    const int batch_idx = get_batch_idx();
+    const int dst_x0    = blockIdx.x * BLOCK;
+    const int dst_y0    = blockIdx.y * BLOCK;
+
+    // top-left corner of the source tile, the source of the bottom-left (K = 1) or top-right (K = 3) output corner
+    const int2 origin = right_angle_src_coord<K>(K == 1 ? dst_x0 : dst_x0 + BLOCK - 1,
+                                                 K == 1 ? dst_y0 + BLOCK - 1 : dst_y0, shift);
+
+    for (int j = threadIdx.y; j < BLOCK; j += blockDim.y)
     {
-        cudaError_t err = cudaFree(d_aCoeffs);
-        if (err != cudaSuccess)
+        const int src_x = origin.x + static_cast<int>(threadIdx.x), src_y = origin.y + j;
+        if (src_x >= 0 && src_x < src.cols && src_y >= 0 && src_y < src.rows)
         {
-            LOG_ERROR("CUDA memory free error, possible memory leak!");
+            tile[j][threadIdx.x] = *src.ptr(batch_idx, src_y, src_x);
         }
     }
-    d_aCoeffs = nullptr;
+    __syncthreads();
+
+    const int dst_x = dst_x0 + threadIdx.x;
+    for (int j = threadIdx.y; j < BLOCK; j += blockDim.y)
+    {
+        const int  dst_y     = dst_y0 + j;
+        const int2 src_coord = right_angle_src_coord<K>(dst_x, dst_y, shift);
+        if (dst_x < dst.cols && dst_y < dst.rows && src_coord.x >= 0 && src_coord.x < src.cols && src_coord.y >= 0
+            && src_coord.y < src.rows)
+        {
+            *dst.ptr(batch_idx, dst_y, dst_x) = tile[src_coord.y - origin.y][src_coord.x - origin.x];
+        }
+    }
+}
+
+// Checks whether the rotation maps pixels to pixels, i.e. the angle is a multiple of 90 degrees and the shift is
+// integer. The shift tolerance absorbs the rounding of shifts computed from the sine and cosine of the angle.
+static bool is_right_angle(const double angleDeg, const double2 shift, int &quarterTurns, int2 &intShift)
+{
+    const double turns = angleDeg / 90;
+    if (turns != std::floor(turns) || std::abs(shift.x) > (1 << 30) || std::abs(shift.y) > (1 << 30))
+    {
+        return false;
+    }
+
+    intShift = make_int2(static_cast<int>(std::rint(shift.x)), static_cast<int>(std::rint(shift.y)));
+    if (std::abs(shift.x - intShift.x) > 1e-6 || std::abs(shift.y - intShift.y) > 1e-6)
+    {
+        return false;
+    }
+
+    quarterTurns = static_cast<int>(std::fmod(std::fmod(turns, 4) + 4, 4));
+    return true;
+}
+
+template<typename T>
+void rotate_right_angle_caller(const Ptr2dNHWC<T> &src_ptr, const Ptr2dNHWC<T> &dst_ptr, const int quarterTurns,
+                               const int2 shift, const int batch_size, cudaStream_t stream)
+{
+    dim3 blockSize(BLOCK, BLOCK / 4, 1);
+    dim3 gridSize(divUp(dst_ptr.cols, BLOCK), divUp(dst_ptr.rows, BLOCK), batch_size);
+
+    switch (quarterTurns)
+    {
+    case 0:
+        rotate_right_angle<0><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, shift);
+        break;
+    case 1:
+        rotate_right_angle_transpose<1><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, shift);
+        break;
+    case 2:
+        rotate_right_angle<2><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, shift);
+        break;
+    default:
+        rotate_right_angle_transpose<3><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, shift);
+        break;
+    }
+    checkKernelErrors();
+}
+
+template<typename T> // uchar3 float3 uchar1 float3
+void rotate(const nvcv::TensorDataAccessStridedImagePlanar &inData,
+            const nvcv::TensorDataAccessStridedImagePlanar &outData, const double angleDeg, const double2 shift,
+            const NVCVInterpolationType interpolation, const NVCVCoordinatePrecision precision, cudaStream_t stream)
+{
+    const int batch_size = inData.numSamples();
+    const int out_width  = outData.numCols();
+    const int out_height = outData.numRows();
+
+    dim3         blockSize(BLOCK, BLOCK / 4, 1);
+    dim3         gridSize(divUp(out_width, blockSize.x), divUp(out_height, blockSize.y), batch_size);
+    Ptr2dNHWC<T> src_ptr(inData);  //batch_size, height, width, channels, (T *) d_in);
+    Ptr2dNHWC<T> dst_ptr(outData); //batch_size, out_height, out_width, channels, (T *) d_out);
+
+    int  quarterTurns;
+    int2 intShift;
+    if (is_right_angle(angleDeg, shift, quarterTurns, intShift))
+    {
+        // EXIF orientation fixes and the like, a bandwidth-bound copy instead of a resample
+        rotate_right_angle_caller<T>(src_ptr, dst_ptr, quarterTurns, intShift, batch_size, stream);
+    }
+    else if (precision == NVCV_COORD_PRECISION_FLOAT)
+    {
+        rotate_caller<T>(src_ptr, dst_ptr, compute_warpAffine<float>(angleDeg, shift.x, shift.y), interpolation,
+                         gridSize, blockSize, stream);
+    }
+    else
+    {
+        rotate_caller<T>(src_ptr, dst_ptr, compute_warpAffine<double>(angleDeg, shift.x, shift.y), interpolation,
+                         gridSize, blockSize, stream);
+    }
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
+namespace nvcv::legacy::cuda_op {
+
+Rotate::Rotate(DataShape max_input_shape, DataShape max_output_shape, NVCVCoordinatePrecision precision)
+    : CudaBaseOp(max_input_shape, max_output_shape)
+    , m_precision(precision)
+{
+    setGpuWorkspaceSize(calBufferSize(max_input_shape, max_output_shape, DataType::kCV_8U /*not in use*/));
 }
 
 size_t Rotate::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
 {
-    return 6 * sizeof(double);
+    // Coefficients are passed to the kernels by value
+    return 0;
 }
 
 ErrorCode Rotate::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData,
@@ -260,9 +401,9 @@ ErrorCode Rotate::infer(const ITensorDataStridedCuda &inData, const ITensorDataS
     }
 
     typedef void (*func_t)(const nvcv::TensorDataAccessStridedImagePlanar &inData,
-                           const nvcv::TensorDataAccessStridedImagePlanar &outData, double *d_aCoeffs,
-                           const double angleDeg, const double2 shift, const NVCVInterpolationType interpolation,
-                           cudaStream_t stream);
+                           const nvcv::TensorDataAccessStridedImagePlanar &outData, const double angleDeg,
+                           const double2 shift, const NVCVInterpolationType interpolation,
+                           const NVCVCoordinatePrecision precision, cudaStream_t stream);
 
     static const func_t funcs[6][4] = {
         {      rotate<uchar>,  0 /*rotate<uchar2>*/,      rotate<uchar3>,      rotate<uchar4>},
@@ -276,7 +417,7 @@ ErrorCode Rotate::infer(const ITensorDataStridedCuda &inData, const ITensorDataS
     const func_t func = funcs[data_type][channels - 1];
     NVCV_ASSERT(func != 0);
 
-    func(*inAccess, *outAccess, d_aCoeffs, angleDeg, shift, interpolation, stream);
+    func(*inAccess, *outAccess, angleDeg, shift, interpolation, m_precision, stream);
 
     return SUCCESS;
 }
@@ -23,6 +23,8 @@
 
 #include "CvCudaUtils.cuh"
 
+#include <vector>
+
 #define BLOCK 32
 #define PI    3.1415926535897932384626433832795
 
@@ -31,8 +33,31 @@ using namespace nvcv::legacy::helpers;
 
 namespace nvcv::legacy::cuda_op {
 
+// Rotation coefficients of one sample, stored in the workspace as float or
+// double depending on the coordinate precision of the operator.
+template<typename CoeffT>
+struct RotateCoeffs
+{
+    CoeffT c[6];
+};
+
+template<typename CoeffT>
+__host__ __device__ RotateCoeffs<CoeffT> rotate_coeffs(double angle, double xShift, double yShift)
+{
+    // sin/cos are always evaluated in double, only the result is rounded to CoeffT
+    RotateCoeffs<CoeffT> coeffs;
+    coeffs.c[0] = cos(angle * PI / 180);
+    coeffs.c[1] = sin(angle * PI / 180);
+    coeffs.c[2] = xShift;
+    coeffs.c[3] = -sin(angle * PI / 180);
+    coeffs.c[4] = cos(angle * PI / 180);
+    coeffs.c[5] = yShift;
+    return coeffs;
+}
+
+template<typename CoeffT>
 __global__ void compute_warpAffine(const int numImages, const cuda::Tensor1DWrap<double> angleDeg,
-                                   const cuda::Tensor2DWrap<double> shift, double *d_aCoeffs)
+                                   const cuda::Tensor2DWrap<double> shift, RotateCoeffs<CoeffT> *d_aCoeffs)
 {
     int index = threadIdx.x + blockIdx.x * blockDim.x;
     if (index >= numImages)
@@ -40,22 +65,22 @@ __global__ void compute_warpAffine(const int numImages, const cuda::Tensor1DWrap
         return;
     }
 
-    double *aCoeffs = (double *)((char *)d_aCoeffs + (sizeof(double) * 6) * index);
-
-    double angle  = angleDeg[index];
-    double xShift = *shift.ptr(index, 0);
-    double yShift = *shift.ptr(index, 1);
+    d_aCoeffs[index] = rotate_coeffs<CoeffT>(angleDeg[index], *shift.ptr(index, 0), *shift.ptr(index, 1));
+}
 
-    aCoeffs[0] = cos(angle * PI / 180);
-    aCoeffs[1] = sin(angle * PI / 180);
-    aCoeffs[2] = xShift;
-    aCoeffs[3] = -sin(angle * PI / 180);
-    aCoeffs[4] = cos(angle * PI / 180);
-    aCoeffs[5] = yShift;
+template<typename CoeffT>
+__device__ __forceinline__ float2 rotate_src_coord(const int dst_x, const int dst_y, const RotateCoeffs<CoeffT> &coeffs)
+{
+    const CoeffT *c           = coeffs.c;
+    const CoeffT  dst_x_shift = dst_x - c[2];
+    const CoeffT  dst_y_shift = dst_y - c[5];
+    return make_float2((float)(dst_x_shift * c[0] + dst_y_shift * (-c[1])),
+                       (float)(dst_x_shift * (-c[3]) + dst_y_shift * c[4]));
 }
 
-template<typename T>
-__global__ void rotate_linear(const Ptr2dVarShapeNHWC<T> src, Ptr2dVarShapeNHWC<T> dst, const double *d_aCoeffs_)
+template<typename T, class Coeffs>
+__global__ void rotate_linear(const Ptr2dVarShapeNHWC<T> src, Ptr2dVarShapeNHWC<T> dst,
+                              const Coeffs aCoeffs)
 {
     int       dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
     int       dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
@@ -64,13 +89,11 @@ __global__ void rotate_linear(const Ptr2dVarShapeNHWC<T> src, Ptr2dVarShapeNHWC<
         return;
     int height = src.at_rows(batch_idx), width = src.at_cols(batch_idx);
 
-    const double *d_aCoeffs   = (const double *)((char *)d_aCoeffs_ + (sizeof(double) * 6) * batch_idx);
-    const double  dst_x_shift = dst_x - d_aCoeffs[2];
-    const double  dst_y_shift = dst_y - d_aCoeffs[5];
-    float         src_x       = (float)(dst_x_shift * d_aCoeffs[0] + dst_y_shift * (-d_aCoeffs[1]));
-    float         src_y       = (float)(dst_x_shift * (-d_aCoeffs[3]) + dst_y_shift * d_aCoeffs[4]);
+    const float2 src_coord = rotate_src_coord(dst_x, dst_y, aCoeffs[batch_idx]);
+    const float  src_x     = src_coord.x;
+    const float  src_y     = src_coord.y;
 
-    if (src_x > -0.5 && src_x < width && src_y > -0.5 && src_y < height)
+    if (src_x > -0.5f && src_x < width && src_y > -0.5f && src_y < height)
     {
         using work_type = nvcv::cuda::ConvertBaseTypeTo<float, T>;
         work_type out   = nvcv::cuda::SetAll<work_type>(0);
@@ -98,8 +121,9 @@ __global__ void rotate_linear(const Ptr2dVarShapeNHWC<T> src, Ptr2dVarShapeNHWC<
     }
 }
 
-template<typename T>
-__global__ void rotate_nearest(const Ptr2dVarShapeNHWC<T> src, Ptr2dVarShapeNHWC<T> dst, const double *d_aCoeffs_)
+template<typename T, class Coeffs>
+__global__ void rotate_nearest(const Ptr2dVarShapeNHWC<T> src, Ptr2dVarShapeNHWC<T> dst,
+                               const Coeffs aCoeffs)
 {
     int       dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
     int       dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
@@ -108,24 +132,22 @@ __global__ void rotate_nearest(const Ptr2dVarShapeNHWC<T> src, Ptr2dVarShapeNHWC
         return;
     int height = src.at_rows(batch_idx), width = src.at_cols(batch_idx);
 
-    const double *d_aCoeffs   = (const double *)((char *)d_aCoeffs_ + (sizeof(double) * 6) * batch_idx);
-    const double  dst_x_shift = dst_x - d_aCoeffs[2];
-    const double  dst_y_shift = dst_y - d_aCoeffs[5];
-    float         src_x       = (float)(dst_x_shift * d_aCoeffs[0] + dst_y_shift * (-d_aCoeffs[1]));
-    float         src_y       = (float)(dst_x_shift * (-d_aCoeffs[3]) + dst_y_shift * d_aCoeffs[4]);
+    const float2 src_coord = rotate_src_coord(dst_x, dst_y, aCoeffs[batch_idx]);
+    const float  src_x     = src_coord.x;
+    const float  src_y     = src_coord.y;
 
-    if (src_x > -0.5 && src_x < width && src_y > -0.5 && src_y < height)
+    if (src_x > -0.5f && src_x < width && src_y > -0.5f && src_y < height)
     {
-        const int x1 = min(__float2int_rz(src_x + 0.5), width - 1);
-        const int y1 = min(__float2int_rz(src_y + 0.5), height - 1);
+        const int x1 = min(__float2int_rz(src_x + 0.5f), width - 1);
+        const int y1 = min(__float2int_rz(src_y + 0.5f), height - 1);
 
         *dst.ptr(batch_idx, dst_y, dst_x) = *src.ptr(batch_idx, y1, x1);
     }
 }
 
-template<typename T>
+template<typename T, class Coeffs>
 __global__ void rotate_cubic(CubicFilter<BorderReader<Ptr2dVarShapeNHWC<T>, BrdReplicate<T>>> filteredSrc,
-                             Ptr2dVarShapeNHWC<T> dst, const double *d_aCoeffs_)
+                             Ptr2dVarShapeNHWC<T> dst, const Coeffs aCoeffs)
 {
     int       dst_x     = blockIdx.x * blockDim.x + threadIdx.x;
     int       dst_y     = blockIdx.y * blockDim.y + threadIdx.y;
@@ -134,21 +156,20 @@ __global__ void rotate_cubic(CubicFilter<BorderReader<Ptr2dVarShapeNHWC<T>, BrdR
         return;
     int height = filteredSrc.src.ptr.at_rows(batch_idx), width = filteredSrc.src.ptr.at_cols(batch_idx);
 
-    const double *d_aCoeffs   = (const double *)((char *)d_aCoeffs_ + (sizeof(double) * 6) * batch_idx);
-    const double  dst_x_shift = dst_x - d_aCoeffs[2];
-    const double  dst_y_shift = dst_y - d_aCoeffs[5];
-    float         src_x       = (float)(dst_x_shift * d_aCoeffs[0] + dst_y_shift * (-d_aCoeffs[1]));
-    float         src_y       = (float)(dst_x_shift * (-d_aCoeffs[3]) + dst_y_shift * d_aCoeffs[4]);
+    const float2 src_coord = rotate_src_coord(dst_x, dst_y, aCoeffs[batch_idx]);
+    const float  src_x     = src_coord.x;
+    const float  src_y     = src_coord.y;
 
-    if (src_x > -0.5 && src_x < width && src_y > -0.5 && src_y < height)
+    if (src_x > -0.5f && src_x < width && src_y > -0.5f && src_y < height)
     {
         *dst.ptr(batch_idx, dst_y, dst_x) = filteredSrc(batch_idx, src_y, src_x);
     }
 }
 
-template<typename T> // uchar3 float3 uchar1 float3
-void rotate(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda &out,
-            double *d_aCoeffs, const NVCVInterpolationType interpolation, cudaStream_t stream)
+// Coeffs is either a device array of RotateCoeffs, or SampleParams of them passed by value.
+template<typename T, class Coeffs>
+void rotate_caller(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda &out,
+                   const Coeffs &aCoeffs, const NVCVInterpolationType interpolation, cudaStream_t stream)
 {
     dim3 blockSize(BLOCK, BLOCK / 4, 1);
 
@@ -162,12 +183,12 @@ void rotate(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarSh
     Ptr2dVarShapeNHWC<T> dst_ptr(out); //batch_size, out_height, out_width, channels, (T **) d_out);
     if (interpolation == NVCV_INTERP_LINEAR)
     {
-        rotate_linear<T><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, d_aCoeffs);
+        rotate_linear<T><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, aCoeffs);
         checkKernelErrors();
     }
     else if (interpolation == NVCV_INTERP_NEAREST)
     {
-        rotate_nearest<T><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, d_aCoeffs);
+        rotate_nearest<T><<<gridSize, blockSize, 0, stream>>>(src_ptr, dst_ptr, aCoeffs);
         checkKernelErrors();
     }
     else if (interpolation == NVCV_INTERP_CUBIC)
@@ -176,45 +197,59 @@ void rotate(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarSh
         BorderReader<Ptr2dVarShapeNHWC<T>, BrdReplicate<T>>              brdSrc(src_ptr, brd);
         CubicFilter<BorderReader<Ptr2dVarShapeNHWC<T>, BrdReplicate<T>>> filteredSrc(brdSrc);
 
-        rotate_cubic<T><<<gridSize, blockSize, 0, stream>>>(filteredSrc, dst_ptr, d_aCoeffs);
+        rotate_cubic<T><<<gridSize, blockSize, 0, stream>>>(filteredSrc, dst_ptr, aCoeffs);
         checkKernelErrors();
     }
 }
 
-RotateVarShape::RotateVarShape(const int maxBatchSize)
-    : CudaBaseOp()
-    , d_aCoeffs(nullptr)
-    , m_maxBatchSize(maxBatchSize)
+template<typename T, typename CoeffT>
+void rotate_coeffs_caller(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda &out,
+                          const void *aCoeffs, const bool hostCoeffs, const NVCVInterpolationType interpolation,
+                          cudaStream_t stream)
 {
-    if (m_maxBatchSize > 0)
+    const auto *coeffs = static_cast<const RotateCoeffs<CoeffT> *>(aCoeffs);
+    if (hostCoeffs)
     {
-        size_t      bufferSize = sizeof(double) * 6 * m_maxBatchSize;
-        cudaError_t err        = cudaMalloc(&d_aCoeffs, bufferSize);
-        if (err != cudaSuccess)
-        {
-            LOG_ERROR("CUDA memory allocation error of size: " << bufferSize);
-            throw std::runtime_error("CUDA memory allocation error!");
-        }
+        rotate_caller<T>(in, out, SampleParams<RotateCoeffs<CoeffT>>(coeffs, in.numImages()), interpolation, stream);
+    }
+    else
+    {
+        rotate_caller<T>(in, out, coeffs, interpolation, stream);
     }
 }
 
-RotateVarShape::~RotateVarShape()
+// aCoeffs are in the workspace, or on the host if hostCoeffs, as RotateCoeffs of the coordinate precision.
+template<typename T> // uchar3 float3 uchar1 float3
+void rotate(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda &out,
+            const void *aCoeffs, const bool hostCoeffs, const NVCVInterpolationType interpolation,
+            const NVCVCoordinatePrecision precision, cudaStream_t stream)
 {
-    if (d_aCoeffs != nullptr)
+    if (precision == NVCV_COORD_PRECISION_FLOAT)
     {
-        cudaError_t err = cudaFree(d_aCoeffs);
-        if (err != cudaSuccess)
-        {
-            LOG_ERROR("CUDA memory free error, possible memory leak!");
-        }
+        rotate_coeffs_caller<T, float>(in, out, aCoeffs, hostCoeffs, interpolation, stream);
+    }
+    else
+    {
+        rotate_coeffs_caller<T, double>(in, out, aCoeffs, hostCoeffs, interpolation, stream);
     }
-    d_aCoeffs = nullptr;
 }
 
-ErrorCode RotateVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
-                                const IImageBatchVarShapeDataStridedCuda &outData,
-                                const ITensorDataStridedCuda &angleDeg, const ITensorDataStridedCuda &shift,
-                                const NVCVInterpolationType interpolation, cudaStream_t stream)
+RotateVarShape::RotateVarShape(const int maxBatchSize, NVCVCoordinatePrecision precision)
+    : CudaBaseOp()
+    , m_maxBatchSize(maxBatchSize)
+    , m_precision(precision)
+{
+    if (m_maxBatchSize > 0)
+    {
+        const size_t coeffsSize = m_precision == NVCV_COORD_PRECISION_FLOAT ? sizeof(RotateCoeffs<float>)
+                                                                            : sizeof(RotateCoeffs<double>);
+        setGpuWorkspaceSize(coeffsSize * m_maxBatchSize);
+    }
+}
+
+ErrorCode RotateVarShape::validate(const IImageBatchVarShapeDataStridedCuda &inData,
+                                   const IImageBatchVarShapeDataStridedCuda &outData,
+                                   const NVCVInterpolationType               interpolation) const
 {
     if (m_maxBatchSize <= 0)
     {
@@ -274,14 +309,17 @@ ErrorCode RotateVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData
         return ErrorCode::INVALID_PARAMETER;
     }
 
-    cuda::Tensor1DWrap<double> angleDecPtr(angleDeg);
-    cuda::Tensor2DWrap<double> shiftPtr(shift);
-
-    compute_warpAffine<<<1, inData.numImages(), 0, stream>>>(inData.numImages(), angleDecPtr, shiftPtr, d_aCoeffs);
-    checkKernelErrors();
+    return SUCCESS;
+}
 
+void RotateVarShape::launch(const IImageBatchVarShapeDataStridedCuda &inData,
+                            const IImageBatchVarShapeDataStridedCuda &outData, const void *aCoeffs,
+                            const bool hostCoeffs, const NVCVInterpolationType interpolation,
+                            cudaStream_t stream) const
+{
     typedef void (*func_t)(const IImageBatchVarShapeDataStridedCuda &in, const IImageBatchVarShapeDataStridedCuda &out,
-                           double *d_aCoeffs, const NVCVInterpolationType interpolation, cudaStream_t stream);
+                           const void *aCoeffs, const bool hostCoeffs, const NVCVInterpolationType interpolation,
+                           const NVCVCoordinatePrecision precision, cudaStream_t stream);
 
     static const func_t funcs[6][4] = {
         {      rotate<uchar>,  0 /*rotate<uchar2>*/,      rotate<uchar3>,      rotate<uchar4>},
@@ -292,10 +330,87 @@ ErrorCode RotateVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData
         {      rotate<float>,  0 /*rotate<float2>*/,      rotate<float3>,      rotate<float4>}
     };
 
-    const func_t func = funcs[data_type][channels - 1];
+    DataType data_type = helpers::GetLegacyDataType(inData.uniqueFormat());
+    int      channels  = inData.uniqueFormat().numChannels();
 
-    func(inData, outData, d_aCoeffs, interpolation, stream);
+    const func_t func = funcs[data_type][channels - 1];
     assert(func != 0);
+
+    func(inData, outData, aCoeffs, hostCoeffs, interpolation, m_precision, stream);
+}
+
+ErrorCode RotateVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                const IImageBatchVarShapeDataStridedCuda &outData,
+                                const ITensorDataStridedCuda &angleDeg, const ITensorDataStridedCuda &shift,
+                                const NVCVInterpolationType interpolation, cudaStream_t stream)
+{
+    ErrorCode err = validate(inData, outData, interpolation);
+    if (err != SUCCESS)
+    {
+        return err;
+    }
+
+    cuda::Tensor1DWrap<double> angleDecPtr(angleDeg);
+    cuda::Tensor2DWrap<double> shiftPtr(shift);
+
+    const size_t coeffsSize = m_precision == NVCV_COORD_PRECISION_FLOAT ? sizeof(RotateCoeffs<float>)
+                                                                        : sizeof(RotateCoeffs<double>);
+
+    GpuWorkspaceLease workspace = gpuWorkspace(stream, coeffsSize * inData.numImages());
+    void             *d_aCoeffs = workspace.get();
+
+    if (m_precision == NVCV_COORD_PRECISION_FLOAT)
+    {
+        compute_warpAffine<<<1, inData.numImages(), 0, stream>>>(inData.numImages(), angleDecPtr, shiftPtr,
+                                                                 static_cast<RotateCoeffs<float> *>(d_aCoeffs));
+    }
+    else
+    {
+        compute_warpAffine<<<1, inData.numImages(), 0, stream>>>(inData.numImages(), angleDecPtr, shiftPtr,
+                                                                 static_cast<RotateCoeffs<double> *>(d_aCoeffs));
+    }
+    checkKernelErrors();
+
+    launch(inData, outData, d_aCoeffs, false, interpolation, stream);
+    return SUCCESS;
+}
+
+ErrorCode RotateVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                const IImageBatchVarShapeDataStridedCuda &outData, const double *angleDeg,
+                                const double2 *shift, const NVCVInterpolationType interpolation, cudaStream_t stream)
+{
+    ErrorCode err = validate(inData, outData, interpolation);
+    if (err != SUCCESS)
+    {
+        return err;
+    }
+
+    if (inData.numImages() > CVCUDA_MAX_HOST_PARAM_SAMPLES)
+    {
+        LOG_ERROR("Invalid number of images, host parameters are limited to " << CVCUDA_MAX_HOST_PARAM_SAMPLES
+                                                                              << " samples");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    // The coefficients are computed here and passed to the kernel by value, the workspace isn't used.
+    if (m_precision == NVCV_COORD_PRECISION_FLOAT)
+    {
+        std::vector<RotateCoeffs<float>> aCoeffs(inData.numImages());
+        for (int i = 0; i < inData.numImages(); ++i)
+        {
+            aCoeffs[i] = rotate_coeffs<float>(angleDeg[i], shift[i].x, shift[i].y);
+        }
+        launch(inData, outData, aCoeffs.data(), true, interpolation, stream);
+    }
+    else
+    {
+        std::vector<RotateCoeffs<double>> aCoeffs(inData.numImages());
+        for (int i = 0; i < inData.numImages(); ++i)
+        {
+            aCoeffs[i] = rotate_coeffs<double>(angleDeg[i], shift[i].x, shift[i].y);
+        }
+        launch(inData, outData, aCoeffs.data(), true, interpolation, stream);
+    }
     return SUCCESS;
 }
 
@@ -0,0 +1,231 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "QualityMetrics.cuh"
+#include "ReduceUtils.cuh"
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Sum of the Laplacian responses of a thread, a block or a sample, and of their squares
+using LaplacianSums = quality::ChannelSums<2>;
+
+__device__ float Variance(const LaplacianSums &v, float count)
+{
+    const float mean = v.val[0] / count;
+    return fmaxf(v.val[1] / count - mean * mean, 0.f);
+}
+
+// blockIdx.x is the sample, whose rows are split among gridDim.y blocks, as in PSNR. The Laplacian of each pixel is
+// read through the border wrap and only accumulated, so the whole sample is read once and nothing is written back.
+template<class SrcWrapper>
+__global__ void sharpnessKernel(const SrcWrapper src, int2 size, int ksize, nvcv::cuda::Tensor3DWrap<float> dst,
+                                LaplacianSums *partials)
+{
+    const int sample = blockIdx.x;
+
+    LaplacianSums v{0.f, 0.f};
+
+    for (int y = blockIdx.y * kReduceBlockH + threadIdx.y; y < size.y; y += gridDim.y * kReduceBlockH)
+    {
+        for (int x = threadIdx.x; x < size.x; x += kReduceBlockW)
+        {
+            auto p = [&](int dx, int dy) { return static_cast<float>(src[int3{x + dx, y + dy, sample}]); };
+
+            const float lap = ksize == 1 ? p(0, -1) + p(-1, 0) + p(1, 0) + p(0, 1) - 4.f * p(0, 0)
+                                         : 2.f * (p(-1, -1) + p(1, -1) + p(-1, 1) + p(1, 1)) - 8.f * p(0, 0);
+            v.val[0] += lap;
+            v.val[1] += lap * lap;
+        }
+    }
+
+    v = BlockReduce(v, quality::SumCombine<2>());
+
+    if (get_lid() != 0)
+    {
+        return;
+    }
+
+    if (gridDim.y == 1)
+    {
+        *dst.ptr(sample, 0, 0) = Variance(v, static_cast<float>(size.x) * size.y);
+    }
+    else
+    {
+        partials[blockIdx.x * gridDim.y + blockIdx.y] = v;
+    }
+}
+
+__global__ void sharpnessFinalKernel(const LaplacianSums *partials, int numBlocks, float count,
+                                     nvcv::cuda::Tensor3DWrap<float> dst)
+{
+    const int sample = blockIdx.x;
+
+    LaplacianSums v = ReducePartials(partials + sample * numBlocks, numBlocks, quality::SumCombine<2>());
+
+    if (threadIdx.x == 0)
+    {
+        *dst.ptr(sample, 0, 0) = Variance(v, count);
+    }
+}
+
+template<typename T, NVCVBorderType B>
+void sharpness(const TensorDataAccessStridedImagePlanar &inAccess, const nvcv::ITensorDataStridedCuda &inData,
+               const nvcv::ITensorDataStridedCuda &outData, int ksize, void *workspace, cudaStream_t stream)
+{
+    auto src = nvcv::cuda::CreateBorderWrapNHW<const T, B>(inData, T{});
+    auto dst = nvcv::cuda::CreateTensorWrapNHW<float>(outData);
+
+    const int2 size{static_cast<int>(inAccess.numCols()), static_cast<int>(inAccess.numRows())};
+
+    const int      numSamples = inAccess.numSamples();
+    const int      numBlocks  = NumReduceBlocks(numSamples, size.y);
+    LaplacianSums *partials   = static_cast<LaplacianSums *>(workspace);
+
+    dim3 block(kReduceBlockW, kReduceBlockH);
+    dim3 grid(numSamples, numBlocks);
+
+    sharpnessKernel<<<grid, block, 0, stream>>>(src, size, ksize, dst, partials);
+    checkKernelErrors();
+
+    if (numBlocks > 1)
+    {
+        sharpnessFinalKernel<<<numSamples, 32, 0, stream>>>(partials, numBlocks, static_cast<float>(size.x) * size.y,
+                                                            dst);
+        checkKernelErrors();
+    }
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t Sharpness::calBufferSize()
+{
+    return kMaxReduceBlocks * sizeof(LaplacianSums);
+}
+
+ErrorCode Sharpness::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &outData, int ksize,
+                           NVCVBorderType borderMode, cudaStream_t stream)
+{
+    DataFormat format = GetLegacyDataFormat(inData.layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid input DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    DataType dtype = GetLegacyDataType(inData.dtype());
+    if (!(dtype == kCV_8U || dtype == kCV_16U || dtype == kCV_16S || dtype == kCV_32F))
+    {
+        LOG_ERROR("Invalid input DataType " << inData.dtype() << ", it must be uint8, uint16, int16 or float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    if (inAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid input channel number " << inAccess->numChannels() << ", it must be 1");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    DataFormat outFormat = GetLegacyDataFormat(outData.layout());
+    if (!(outFormat == kNHWC || outFormat == kHWC))
+    {
+        LOG_ERROR("Invalid output DataFormat " << outFormat);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (outData.dtype() != nvcv::TYPE_F32)
+    {
+        LOG_ERROR("Invalid output DataType " << outData.dtype() << ", it must be float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto outAccess = TensorDataAccessStridedImagePlanar::Create(outData);
+    NVCV_ASSERT(outAccess);
+
+    if (outAccess->numSamples() != inAccess->numSamples() || outAccess->numRows() != 1 || outAccess->numCols() != 1
+        || outAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid output shape " << outData.shape() << ", it must have " << inAccess->numSamples()
+                                          << " samples of 1x1 pixels with 1 channel");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (!(ksize == 1 || ksize == 3))
+    {
+        LOG_ERROR("Invalid ksize " << ksize << ", it must be 1 or 3");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (!(borderMode == NVCV_BORDER_REFLECT101 || borderMode == NVCV_BORDER_REPLICATE
+          || borderMode == NVCV_BORDER_CONSTANT || borderMode == NVCV_BORDER_REFLECT || borderMode == NVCV_BORDER_WRAP))
+    {
+        LOG_ERROR("Invalid borderMode " << borderMode);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (inAccess->numSamples() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const TensorDataAccessStridedImagePlanar &inAccess, const ITensorDataStridedCuda &inData,
+                           const ITensorDataStridedCuda &outData, int ksize, void *workspace, cudaStream_t stream);
+
+    // clang-format off
+    static const func_t funcs[6][5] = {
+        { sharpness<uchar, NVCV_BORDER_CONSTANT>,  sharpness<uchar, NVCV_BORDER_REPLICATE>,
+          sharpness<uchar, NVCV_BORDER_REFLECT>,   sharpness<uchar, NVCV_BORDER_WRAP>,
+          sharpness<uchar, NVCV_BORDER_REFLECT101>},
+        {0, 0, 0, 0, 0},
+        { sharpness<ushort, NVCV_BORDER_CONSTANT>, sharpness<ushort, NVCV_BORDER_REPLICATE>,
+          sharpness<ushort, NVCV_BORDER_REFLECT>,  sharpness<ushort, NVCV_BORDER_WRAP>,
+          sharpness<ushort, NVCV_BORDER_REFLECT101>},
+        { sharpness<short, NVCV_BORDER_CONSTANT>,  sharpness<short, NVCV_BORDER_REPLICATE>,
+          sharpness<short, NVCV_BORDER_REFLECT>,   sharpness<short, NVCV_BORDER_WRAP>,
+          sharpness<short, NVCV_BORDER_REFLECT101>},
+        {0, 0, 0, 0, 0},
+        { sharpness<float, NVCV_BORDER_CONSTANT>,  sharpness<float, NVCV_BORDER_REPLICATE>,
+          sharpness<float, NVCV_BORDER_REFLECT>,   sharpness<float, NVCV_BORDER_WRAP>,
+          sharpness<float, NVCV_BORDER_REFLECT101>}
+    };
+    // clang-format on
+
+    const func_t func = funcs[dtype][borderMode];
+    NVCV_ASSERT(func != 0);
+
+    func(*inAccess, inData, outData, ksize, gpuWorkspace(stream).get(), stream);
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
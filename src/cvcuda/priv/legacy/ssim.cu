@@ -0,0 +1,278 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "QualityMetrics.cuh"
+#include "ReduceUtils.cuh"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+using quality::ChannelSums;
+
+// 11x11 Gaussian window of standard deviation 1.5, as in the reference implementation of Wang et al.
+constexpr int   kWindow = 11;
+constexpr int   kRadius = kWindow / 2;
+constexpr float kSigma  = 1.5f;
+
+// Blocks of kReduceBlockW x kReduceBlockH threads compute tiles of kTileW x kTileH scores, each thread computing
+// kTileH / kReduceBlockH of them, from the tile and its border of kRadius pixels kept in shared memory.
+constexpr int kTileW = kReduceBlockW;
+constexpr int kTileH = 2 * kReduceBlockH;
+constexpr int kInW   = kTileW + 2 * kRadius;
+constexpr int kInH   = kTileH + 2 * kRadius;
+
+constexpr int kBlockThreads = kReduceBlockW * kReduceBlockH;
+
+struct GaussianWindow
+{
+    float w[kWindow];
+};
+
+GaussianWindow MakeGaussianWindow()
+{
+    GaussianWindow window;
+    float          sum = 0;
+    for (int i = 0; i < kWindow; ++i)
+    {
+        window.w[i] = std::exp(-(i - kRadius) * (i - kRadius) / (2 * kSigma * kSigma));
+        sum += window.w[i];
+    }
+    for (float &w : window.w)
+    {
+        w /= sum;
+    }
+    return window;
+}
+
+// Mean SSIM of a sum of count local scores
+struct SSIMMetric
+{
+    __device__ float operator()(float sum, float count) const
+    {
+        return sum / count;
+    }
+};
+
+// SSIM map of the windows of 2 images, averaged over the windows that fit in the images. blockIdx.x is the sample,
+// whose tiles are shared by the gridDim.y blocks of the sample. Each channel of a tile is loaded, filtered
+// horizontally into the 5 local moments, then filtered vertically and scored, so that the maps are never stored.
+template<typename T>
+__global__ void ssimKernel(TensorSegments<T> src1, TensorSegments<T> src2, nvcv::cuda::Tensor3DWrap<float> dst,
+                           ChannelSums<nvcv::cuda::NumElements<T>> *partials, GaussianWindow window, float c1, float c2,
+                           int outChannels)
+{
+    constexpr int NC = nvcv::cuda::NumElements<T>;
+
+    __shared__ float in1[kInH][kInW];
+    __shared__ float in2[kInH][kInW];
+    __shared__ float moments[5][kInH][kTileW]; // means, second moments and cross moment of the rows
+
+    const int  sample = blockIdx.x;
+    const int  lid    = threadIdx.y * kReduceBlockW + threadIdx.x;
+    const int2 size{src1.width - 2 * kRadius, src1.height - 2 * kRadius};
+
+    const int tilesX   = (size.x + kTileW - 1) / kTileW;
+    const int numTiles = tilesX * ((size.y + kTileH - 1) / kTileH);
+
+    ChannelSums<NC> v;
+#pragma unroll
+    for (int c = 0; c < NC; ++c)
+    {
+        v.val[c] = 0.f;
+    }
+
+    for (int t = blockIdx.y; t < numTiles; t += gridDim.y)
+    {
+        const int x0 = (t % tilesX) * kTileW;
+        const int y0 = (t / tilesX) * kTileH;
+
+#pragma unroll
+        for (int c = 0; c < NC; ++c)
+        {
+            for (int i = lid; i < kInH * kInW; i += kBlockThreads)
+            {
+                const int r = i / kInW, col = i % kInW;
+                const int x = x0 + col, y = y0 + r;
+
+                float a = 0.f, b = 0.f;
+                if (x < src1.width && y < src1.height)
+                {
+                    a = nvcv::cuda::GetElement(src1.row(sample, y)[x], c);
+                    b = nvcv::cuda::GetElement(src2.row(sample, y)[x], c);
+                }
+                in1[r][col] = a;
+                in2[r][col] = b;
+            }
+            __syncthreads();
+
+            for (int i = lid; i < kInH * kTileW; i += kBlockThreads)
+            {
+                const int r = i / kTileW, col = i % kTileW;
+
+                float m1 = 0.f, m2 = 0.f, m11 = 0.f, m22 = 0.f, m12 = 0.f;
+#pragma unroll
+                for (int k = 0; k < kWindow; ++k)
+                {
+                    const float w = window.w[k], a = in1[r][col + k], b = in2[r][col + k];
+
+                    m1 += w * a;
+                    m2 += w * b;
+                    m11 += w * a * a;
+                    m22 += w * b * b;
+                    m12 += w * a * b;
+                }
+                moments[0][r][col] = m1;
+                moments[1][r][col] = m2;
+                moments[2][r][col] = m11;
+                moments[3][r][col] = m22;
+                moments[4][r][col] = m12;
+            }
+            __syncthreads();
+
+#pragma unroll
+            for (int j = 0; j < kTileH / kReduceBlockH; ++j)
+            {
+                const int r = threadIdx.y + j * kReduceBlockH;
+                if (x0 + static_cast<int>(threadIdx.x) >= size.x || y0 + r >= size.y)
+                {
+                    continue;
+                }
+
+                float m[5] = {0.f, 0.f, 0.f, 0.f, 0.f};
+#pragma unroll
+                for (int k = 0; k < kWindow; ++k)
+                {
+#pragma unroll
+                    for (int q = 0; q < 5; ++q)
+                    {
+                        m[q] += window.w[k] * moments[q][r + k][threadIdx.x];
+                    }
+                }
+
+                const float mu12 = m[0] * m[1];
+                const float mu11 = m[0] * m[0], mu22 = m[1] * m[1];
+                const float s11 = m[2] - mu11, s22 = m[3] - mu22, s12 = m[4] - mu12;
+
+                v.val[c] += ((2 * mu12 + c1) * (2 * s12 + c2)) / ((mu11 + mu22 + c1) * (s11 + s22 + c2));
+            }
+            __syncthreads();
+        }
+    }
+
+    v = BlockReduce(v, quality::SumCombine<NC>());
+
+    quality::StoreBlockSums(v, partials, dst, SSIMMetric{}, static_cast<float>(size.x) * size.y, outChannels);
+}
+
+template<typename T>
+void ssim(const TensorDataAccessStridedImagePlanar &inAccess1, const TensorDataAccessStridedImagePlanar &inAccess2,
+          const nvcv::ITensorDataStridedCuda &outData, int outChannels, float maxValue, void *workspace,
+          cudaStream_t stream)
+{
+    using Sums = ChannelSums<nvcv::cuda::NumElements<T>>;
+
+    TensorSegments<T> src1(inAccess1, false), src2(inAccess2, false);
+
+    auto dst = nvcv::cuda::CreateTensorWrapNHW<float>(outData);
+
+    const int2 size{src1.width - 2 * kRadius, src1.height - 2 * kRadius};
+    const int  numTiles   = divUp(size.x, kTileW) * divUp(size.y, kTileH);
+    const int  numSamples = inAccess1.numSamples();
+    const int  numBlocks  = std::min(numTiles, std::max(1, kMaxReduceBlocks / numSamples));
+    Sums      *partials   = static_cast<Sums *>(workspace);
+
+    // stabilizing constants of the luminance and contrast terms
+    const float c1 = (0.01f * maxValue) * (0.01f * maxValue);
+    const float c2 = (0.03f * maxValue) * (0.03f * maxValue);
+
+    dim3 block(kReduceBlockW, kReduceBlockH);
+    dim3 grid(numSamples, numBlocks);
+
+    ssimKernel<<<grid, block, 0, stream>>>(src1, src2, dst, partials, MakeGaussianWindow(), c1, c2, outChannels);
+    checkKernelErrors();
+
+    quality::LaunchFinalScores(partials, numSamples, numBlocks, dst, SSIMMetric{},
+                               static_cast<float>(size.x) * size.y, outChannels, stream);
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t SSIM::calBufferSize()
+{
+    return quality::kWorkspaceSize;
+}
+
+ErrorCode SSIM::infer(const ITensorDataStridedCuda &inData1, const ITensorDataStridedCuda &inData2,
+                      const ITensorDataStridedCuda &outData, float maxValue, cudaStream_t stream)
+{
+    DataType  dtype;
+    int       channels, outChannels;
+    ErrorCode err
+        = quality::CheckParams(inData1, inData2, outData, maxValue, kWindow, dtype, channels, outChannels);
+    if (err != ErrorCode::SUCCESS)
+    {
+        return err;
+    }
+
+    auto inAccess1 = TensorDataAccessStridedImagePlanar::Create(inData1);
+    auto inAccess2 = TensorDataAccessStridedImagePlanar::Create(inData2);
+    NVCV_ASSERT(inAccess1 && inAccess2);
+
+    if (inAccess1->numSamples() == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const TensorDataAccessStridedImagePlanar &inAccess1,
+                           const TensorDataAccessStridedImagePlanar &inAccess2, const ITensorDataStridedCuda &outData,
+                           int outChannels, float maxValue, void *workspace, cudaStream_t stream);
+
+    static const func_t funcs[6][4] = {
+        { ssim<uchar>, 0 /*ssim<uchar2>*/,  ssim<uchar3>,  ssim<uchar4>},
+        {           0,                 0,              0,             0},
+        {ssim<ushort>, 0 /*ssim<ushort2>*/, ssim<ushort3>, ssim<ushort4>},
+        { ssim<short>, 0 /*ssim<short2>*/,  ssim<short3>,  ssim<short4>},
+        {           0,                 0,              0,             0},
+        { ssim<float>, 0 /*ssim<float2>*/,  ssim<float3>,  ssim<float4>}
+    };
+
+    const func_t func = funcs[dtype][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(*inAccess1, *inAccess2, outData, outChannels, maxValue > 0 ? maxValue : quality::DataTypeRange(dtype),
+         gpuWorkspace(stream).get(), stream);
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
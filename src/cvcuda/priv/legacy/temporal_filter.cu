@@ -0,0 +1,249 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// Each thread filters one pixel through all the frames, so the state is read and written once per call, and kept
+// in registers in between.
+template<typename T, typename S>
+__global__ void temporal_filter_kernel(const nvcv::cuda::Tensor3DWrap<const T> in,
+                                       nvcv::cuda::Tensor3DWrap<S> state, nvcv::cuda::Tensor3DWrap<T> out,
+                                       nvcv::cuda::Tensor3DWrap<uchar> mask, bool writeOut, bool writeMask,
+                                       int numFrames, int2 size, bool recursive, float alpha, float threshold,
+                                       bool reset)
+{
+    const int x = blockIdx.x * blockDim.x + threadIdx.x;
+    const int y = blockIdx.y * blockDim.y + threadIdx.y;
+
+    if (x >= size.x || y >= size.y)
+        return;
+
+    S s = reset ? nvcv::cuda::StaticCast<float>(*in.ptr(0, y, x)) : *state.ptr(0, y, x);
+
+    for (int n = 0; n < numFrames; ++n)
+    {
+        const S v = nvcv::cuda::StaticCast<float>(*in.ptr(n, y, x));
+
+        float d = 0.f;
+#pragma unroll
+        for (int c = 0; c < nvcv::cuda::NumElements<S>; ++c)
+        {
+            d = fmaxf(d, fabsf(nvcv::cuda::GetElement(v, c) - nvcv::cuda::GetElement(s, c)));
+        }
+
+        const bool  moving = d > threshold;
+        const float k      = recursive && moving ? 1.f : alpha;
+
+        s += k * (v - s);
+
+        if (writeOut)
+        {
+            *out.ptr(n, y, x) = nvcv::cuda::SaturateCast<T>(s);
+        }
+        if (writeMask)
+        {
+            *mask.ptr(n, y, x) = moving ? 255 : 0;
+        }
+    }
+
+    *state.ptr(0, y, x) = s;
+}
+
+template<typename T, int NC>
+void temporalFilter(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &stateData,
+                    const ITensorDataStridedCuda *outData, const ITensorDataStridedCuda *maskData, int numFrames,
+                    int2 size, bool recursive, float alpha, float threshold, bool reset, cudaStream_t stream)
+{
+    using VT = nvcv::cuda::MakeType<T, NC>;
+    using ST = nvcv::cuda::MakeType<float, NC>;
+
+    auto in    = nvcv::cuda::CreateTensorWrapNHW<const VT>(inData);
+    auto state = nvcv::cuda::CreateTensorWrapNHW<ST>(stateData);
+    auto out   = outData ? nvcv::cuda::CreateTensorWrapNHW<VT>(*outData) : nvcv::cuda::Tensor3DWrap<VT>();
+    auto mask  = maskData ? nvcv::cuda::CreateTensorWrapNHW<uchar>(*maskData) : nvcv::cuda::Tensor3DWrap<uchar>();
+
+    dim3 block(32, 8);
+    dim3 grid(divUp(size.x, block.x), divUp(size.y, block.y));
+
+    temporal_filter_kernel<<<grid, block, 0, stream>>>(in, state, out, mask, outData != nullptr, maskData != nullptr,
+                                                       numFrames, size, recursive, alpha, threshold, reset);
+    checkKernelErrors();
+}
+
+ErrorCode checkFormat(const ITensorDataStridedCuda &data, const char *name)
+{
+    DataFormat format = GetLegacyDataFormat(data.layout());
+    if (!(format == kNHWC || format == kHWC))
+    {
+        LOG_ERROR("Invalid " << name << " DataFormat " << format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+// Checks the size of an image tensor, and that its pixels are packed as the kernel reads them as compound types.
+ErrorCode checkShape(const TensorDataAccessStridedImagePlanar &access, const ITensorDataStridedCuda &data,
+                     int numSamples, int rows, int cols, int channels, const char *name)
+{
+    if (access.numSamples() != numSamples || access.numRows() != rows || access.numCols() != cols
+        || access.numChannels() != channels)
+    {
+        LOG_ERROR("Invalid " << name << " shape " << data.shape() << ", it must have " << numSamples
+                             << " samples of " << cols << "x" << rows << " pixels with " << channels << " channels");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    if (access.colStride() != channels * data.dtype().strideBytes())
+    {
+        LOG_ERROR("Pixels of the " << name << " must be packed");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t TemporalFilter::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode TemporalFilter::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &stateData,
+                                const ITensorDataStridedCuda *outData, const ITensorDataStridedCuda *maskData,
+                                NVCVTemporalFilterType type, float alpha, float threshold, bool reset,
+                                cudaStream_t stream)
+{
+    if (type != NVCV_TEMPORAL_RUNNING_AVERAGE && type != NVCV_TEMPORAL_RECURSIVE)
+    {
+        LOG_ERROR("Invalid temporal filter type " << type);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    if (!(alpha > 0.f && alpha <= 1.f))
+    {
+        LOG_ERROR("Invalid alpha " << alpha << ", it must be in (0, 1]");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+    if (!(threshold >= 0.f))
+    {
+        LOG_ERROR("Invalid threshold " << threshold << ", it must not be negative");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    for (auto [data, name] : {std::make_pair(&inData, "input"), std::make_pair(&stateData, "state"),
+                              std::make_pair(outData, "output"), std::make_pair(maskData, "mask")})
+    {
+        if (data)
+        {
+            if (ErrorCode err = checkFormat(*data, name); err != ErrorCode::SUCCESS)
+            {
+                return err;
+            }
+        }
+    }
+
+    DataType data_type = GetLegacyDataType(inData.dtype());
+    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_32F))
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    if (stateData.dtype() != nvcv::TYPE_F32)
+    {
+        LOG_ERROR("Invalid state DataType " << stateData.dtype() << ", it must be float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    if (outData && outData->dtype() != inData.dtype())
+    {
+        LOG_ERROR("Output must have the data type of the input");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+    if (maskData && maskData->dtype() != nvcv::TYPE_U8)
+    {
+        LOG_ERROR("Invalid mask DataType " << maskData->dtype() << ", it must be uint8");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    const int numFrames = inAccess->numSamples();
+    const int rows      = inAccess->numRows();
+    const int cols      = inAccess->numCols();
+    const int channels  = inAccess->numChannels();
+    if (channels < 1 || channels > 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    struct Check
+    {
+        const ITensorDataStridedCuda *data;
+        int                           numSamples, channels;
+        const char                   *name;
+    };
+
+    for (const Check &check : {Check{&inData, numFrames, channels, "input"}, Check{&stateData, 1, channels, "state"},
+                               Check{outData, numFrames, channels, "output"}, Check{maskData, numFrames, 1, "mask"}})
+    {
+        if (check.data)
+        {
+            auto access = TensorDataAccessStridedImagePlanar::Create(*check.data);
+            NVCV_ASSERT(access);
+
+            ErrorCode err = checkShape(*access, *check.data, check.numSamples, rows, cols, check.channels, check.name);
+            if (err != ErrorCode::SUCCESS)
+            {
+                return err;
+            }
+        }
+    }
+
+    if (numFrames == 0 || rows == 0 || cols == 0)
+    {
+        return ErrorCode::SUCCESS;
+    }
+
+    typedef void (*func_t)(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &stateData,
+                           const ITensorDataStridedCuda *outData, const ITensorDataStridedCuda *maskData,
+                           int numFrames, int2 size, bool recursive, float alpha, float threshold, bool reset,
+                           cudaStream_t stream);
+
+    static const func_t funcs[3][4] = {
+        {temporalFilter<uchar, 1>,  temporalFilter<uchar, 2>,  temporalFilter<uchar, 3>,  temporalFilter<uchar, 4>},
+        {temporalFilter<ushort, 1>, temporalFilter<ushort, 2>, temporalFilter<ushort, 3>, temporalFilter<ushort, 4>},
+        {temporalFilter<float, 1>,  temporalFilter<float, 2>,  temporalFilter<float, 3>,  temporalFilter<float, 4>}
+    };
+
+    const int type_idx = data_type == kCV_8U ? 0 : data_type == kCV_16U ? 1 : 2;
+
+    funcs[type_idx][channels - 1](inData, stateData, outData, maskData, numFrames, int2{cols, rows},
+                                  type == NVCV_TEMPORAL_RECURSIVE, alpha, threshold, reset, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -0,0 +1,175 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CvCudaLegacy.h"
+#include "CvCudaLegacyHelpers.hpp"
+
+#include "CvCudaUtils.cuh"
+#include "ReduceUtils.cuh"
+
+using namespace nvcv::legacy::cuda_op;
+using namespace nvcv::legacy::helpers;
+
+namespace {
+
+// One block per sample finds the k largest scores in k rounds, each round reducing the scores that rank after the
+// one found in the previous round. Nothing but the k results is written, which suits the small k of classifiers.
+__global__ void topk_kernel(const nvcv::cuda::Tensor3DWrap<const float> src, int numClasses,
+                            nvcv::cuda::Tensor3DWrap<float> dstScores, nvcv::cuda::Tensor3DWrap<int> dstIndices,
+                            int k, bool softmax)
+{
+    constexpr int kThreads = kReduceBlockW * kReduceBlockH;
+
+    __shared__ ScoreCandidate found;
+    __shared__ float          expSum;
+
+    const int    sample = blockIdx.x;
+    const int    lid    = get_lid();
+    const float *scores = src.ptr(sample, 0, 0);
+
+    ScoreCandidate last{0.f, -1};
+    float          maxScore = 0.f;
+    for (int r = 0; r < k; ++r)
+    {
+        ScoreCandidate best{0.f, -1};
+        for (int i = lid; i < numClasses; i += kThreads)
+        {
+            const ScoreCandidate c{scores[i], i};
+            if ((last.index < 0 || RanksBefore(last, c)) && RanksBefore(c, best))
+            {
+                best = c;
+            }
+        }
+
+        best = BlockReduce(best, FirstRanked{});
+        if (lid == 0)
+        {
+            found = best;
+        }
+        __syncthreads();
+        last = found;
+
+        // The largest score offsets the exponentials, which then can't overflow
+        if (softmax && r == 0)
+        {
+            maxScore  = last.value;
+            float sum = 0.f;
+            for (int i = lid; i < numClasses; i += kThreads)
+            {
+                sum += expf(scores[i] - maxScore);
+            }
+            sum = BlockReduce(sum, [](float a, float b) { return a + b; });
+            if (lid == 0)
+            {
+                expSum = sum;
+            }
+            __syncthreads();
+        }
+
+        if (lid == 0)
+        {
+            *dstScores.ptr(sample, 0, r)  = softmax ? expf(last.value - maxScore) / expSum : last.value;
+            *dstIndices.ptr(sample, 0, r) = last.index;
+        }
+    }
+}
+
+} // namespace
+
+namespace nvcv::legacy::cuda_op {
+
+size_t TopK::calBufferSize(DataShape max_input_shape, DataShape max_output_shape, DataType max_data_type)
+{
+    return 0;
+}
+
+ErrorCode TopK::infer(const ITensorDataStridedCuda &inData, const ITensorDataStridedCuda &scoreData,
+                      const ITensorDataStridedCuda &indexData, bool softmax, cudaStream_t stream)
+{
+    for (const ITensorDataStridedCuda *data : {&inData, &scoreData, &indexData})
+    {
+        DataFormat format = GetLegacyDataFormat(data->layout());
+        if (!(format == kNHWC || format == kHWC))
+        {
+            LOG_ERROR("Invalid DataFormat " << format);
+            return ErrorCode::INVALID_DATA_FORMAT;
+        }
+    }
+
+    if (inData.dtype() != nvcv::TYPE_F32 || scoreData.dtype() != nvcv::TYPE_F32)
+    {
+        LOG_ERROR("Invalid DataType, input and output scores must be float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (indexData.dtype() != nvcv::TYPE_S32)
+    {
+        LOG_ERROR("Invalid index DataType " << indexData.dtype() << ", it must be int32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    auto inAccess    = TensorDataAccessStridedImagePlanar::Create(inData);
+    auto scoreAccess = TensorDataAccessStridedImagePlanar::Create(scoreData);
+    auto indexAccess = TensorDataAccessStridedImagePlanar::Create(indexData);
+    NVCV_ASSERT(inAccess && scoreAccess && indexAccess);
+
+    if (inAccess->numRows() != 1 || inAccess->numChannels() != 1)
+    {
+        LOG_ERROR("Invalid input shape " << inData.shape() << ", the scores of each sample must be a single row");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    const int numSamples = inAccess->numSamples();
+    const int numClasses = inAccess->numCols();
+    const int k          = scoreAccess->numCols();
+
+    for (const auto *access : {&scoreAccess, &indexAccess})
+    {
+        if ((*access)->numSamples() != numSamples || (*access)->numRows() != 1 || (*access)->numChannels() != 1
+            || (*access)->numCols() != k)
+        {
+            LOG_ERROR("Invalid output shapes " << scoreData.shape() << " and " << indexData.shape()
+                                               << ", they must have " << numSamples
+                                               << " samples of a single row of k columns");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
+    if (k < 1 || k > numClasses)
+    {
+        LOG_ERROR("Invalid k " << k << ", it must be between 1 and the number of classes " << numClasses);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    nvcv::cuda::Tensor3DWrap<const float> src(inAccess->sampleData(0), static_cast<int>(inAccess->sampleStride()),
+                                              static_cast<int>(inAccess->rowStride()));
+    nvcv::cuda::Tensor3DWrap<float>       dstScores(scoreAccess->sampleData(0),
+                                                    static_cast<int>(scoreAccess->sampleStride()),
+                                                    static_cast<int>(scoreAccess->rowStride()));
+    nvcv::cuda::Tensor3DWrap<int>         dstIndices(indexAccess->sampleData(0),
+                                                     static_cast<int>(indexAccess->sampleStride()),
+                                                     static_cast<int>(indexAccess->rowStride()));
+
+    dim3 block(kReduceBlockW, kReduceBlockH);
+
+    topk_kernel<<<numSamples, block, 0, stream>>>(src, numClasses, dstScores, dstIndices, k, softmax);
+    checkKernelErrors();
+
+    return ErrorCode::SUCCESS;
+}
+
+} // namespace nvcv::legacy::cuda_op
@@ -21,6 +21,8 @@
 #include "CvCudaUtils.cuh"
 
 #define BLOCK 32
+// output pixels computed by each thread, blockDim.x apart to keep the accesses of a warp coalesced
+#define PIXELS_PER_THREAD 4
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
 using namespace nvcv::cuda;
@@ -28,7 +30,7 @@ using namespace nvcv::cuda;
 template<class Transform, class Filter, typename T>
 __global__ void warp(const Filter src, Ptr2dNHWC<T> dst, Transform transform)
 {
-    const int               x         = blockDim.x * blockIdx.x + threadIdx.x;
+    const int               x0        = blockDim.x * blockIdx.x * PIXELS_PER_THREAD + threadIdx.x;
     const int               y         = blockDim.y * blockIdx.y + threadIdx.y;
     const int               lid       = get_lid();
     const int               batch_idx = get_batch_idx();
@@ -38,10 +40,20 @@ __global__ void warp(const Filter src, Ptr2dNHWC<T> dst, Transform transform)
         coeff[lid] = transform.xform[lid];
     }
     __syncthreads();
-    if (x < dst.cols && y < dst.rows)
+    if (y >= dst.rows)
     {
-        const float2 coord        = Transform::calcCoord(coeff, x, y);
-        *dst.ptr(batch_idx, y, x) = nvcv::cuda::SaturateCast<T>(src(batch_idx, coord.y, coord.x));
+        return;
+    }
+
+#pragma unroll
+    for (int i = 0; i < PIXELS_PER_THREAD; ++i)
+    {
+        const int x = x0 + i * blockDim.x;
+        if (x < dst.cols)
+        {
+            const float2 coord        = Transform::calcCoord(coeff, x, y);
+            *dst.ptr(batch_idx, y, x) = nvcv::cuda::SaturateCast<T>(src(batch_idx, coord.y, coord.x));
+        }
     }
 }
 
@@ -54,7 +66,7 @@ struct WarpDispatcher
         using work_type = nvcv::cuda::ConvertBaseTypeTo<float, T>;
 
         dim3 block(BLOCK, BLOCK / 4);
-        dim3 grid(divUp(dst.cols, block.x), divUp(dst.rows, block.y), dst.batches);
+        dim3 grid(divUp(dst.cols, block.x * PIXELS_PER_THREAD), divUp(dst.rows, block.y), dst.batches);
 
         work_type                                borderVal = nvcv::cuda::DropCast<NumComponents<T>>(borderValue);
         B<work_type>                             brd(src.rows, src.cols, borderVal);
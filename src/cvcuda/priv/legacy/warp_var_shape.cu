@@ -27,6 +27,8 @@
 #include "CvCudaUtils.cuh"
 
 #define BLOCK 32
+// output pixels computed by each thread, blockDim.x apart to keep the accesses of a warp coalesced
+#define PIXELS_PER_THREAD 4
 
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
@@ -34,56 +36,70 @@ using namespace nvcv::cuda;
 
 namespace nvcv::legacy::cuda_op {
 
-__global__ void inverseMatWarpPerspective(const int numImages, const cuda::Tensor2DWrap<float> in,
-                                          cuda::Tensor2DWrap<float> out)
+// Loads the coefficients of the transformation of one sample straight from the user tensor, or from the SampleParams
+// passed by value, inverting them if requested, so that no per-call copy of the matrices is needed.
+template<class Transform>
+struct WarpCoeffs;
+
+template<>
+struct WarpCoeffs<WarpAffineTransform>
 {
-    int index = threadIdx.x + blockIdx.x * blockDim.x;
-    if (index >= numImages)
+    template<class Mats>
+    static __device__ void load(const Mats &mats, int index, bool inverse, float *coeff)
     {
-        return;
+        cuda::math::Matrix<float, 2, 3> M;
+        M[0][0] = *mats.ptr(index, 0);
+        M[0][1] = *mats.ptr(index, 1);
+        M[0][2] = *mats.ptr(index, 2);
+        M[1][0] = *mats.ptr(index, 3);
+        M[1][1] = *mats.ptr(index, 4);
+        M[1][2] = *mats.ptr(index, 5);
+
+        if (inverse)
+        {
+            // M is stored in row-major format M[0,0], M[0,1], M[0,2], M[1,0], M[1,1], M[1,2]
+            float den = M[0][0] * M[1][1] - M[0][1] * M[1][0];
+            den       = std::abs(den) > 1e-5 ? 1. / den : .0;
+            coeff[0]  = (float)M[1][2] * den;
+            coeff[1]  = (float)-M[0][1] * den;
+            coeff[2]  = (float)(M[0][1] * M[1][2] - M[1][1] * M[0][2]) * den;
+            coeff[3]  = (float)-M[1][0] * den;
+            coeff[4]  = (float)M[0][0] * den;
+            coeff[5]  = (float)(M[1][0] * M[0][2] - M[0][0] * M[1][2]) * den;
+        }
+        else
+        {
+            for (int i = 0; i < 6; ++i)
+            {
+                coeff[i] = M[i / 3][i % 3];
+            }
+        }
     }
+};
 
-    cuda::math::Matrix<float, 3, 3> transMatrix;
-
-    transMatrix.load(in.ptr(index));
+template<>
+struct WarpCoeffs<PerspectiveTransform>
+{
+    template<class Mats>
+    static __device__ void load(const Mats &mats, int index, bool inverse, float *coeff)
+    {
+        cuda::math::Matrix<float, 3, 3> transMatrix;
 
-    cuda::math::inv_inplace(transMatrix);
+        transMatrix.load(mats.ptr(index));
 
-    transMatrix.store(out.ptr(index));
-}
+        if (inverse)
+        {
+            cuda::math::inv_inplace(transMatrix);
+        }
 
-__global__ void inverseMatWarpAffine(const int numImages, const cuda::Tensor2DWrap<float> in,
-                                     cuda::Tensor2DWrap<float> out)
-{
-    int index = threadIdx.x + blockIdx.x * blockDim.x;
-    if (index >= numImages)
-    {
-        return;
+        transMatrix.store(coeff);
     }
+};
 
-    cuda::math::Matrix<float, 2, 3> M;
-    M[0][0] = (float)(*in.ptr(index, 0));
-    M[0][1] = (float)(*in.ptr(index, 1));
-    M[0][2] = (float)(*in.ptr(index, 2));
-    M[1][0] = (float)(*in.ptr(index, 3));
-    M[1][1] = (float)(*in.ptr(index, 4));
-    M[1][2] = (float)(*in.ptr(index, 5));
-
-    // M is stored in row-major format M[0,0], M[0,1], M[0,2], M[1,0], M[1,1], M[1,2]
-    float den          = M[0][0] * M[1][1] - M[0][1] * M[1][0];
-    den                = std::abs(den) > 1e-5 ? 1. / den : .0;
-    *out.ptr(index, 0) = (float)M[1][2] * den;
-    *out.ptr(index, 1) = (float)-M[0][1] * den;
-    *out.ptr(index, 2) = (float)(M[0][1] * M[1][2] - M[1][1] * M[0][2]) * den;
-    *out.ptr(index, 3) = (float)-M[1][0] * den;
-    *out.ptr(index, 4) = (float)M[0][0] * den;
-    *out.ptr(index, 5) = (float)(M[1][0] * M[0][2] - M[0][0] * M[1][2]) * den;
-}
-
-template<class Transform, class Filter, typename T>
-__global__ void warp(const Filter src, cuda::ImageBatchVarShapeWrap<T> dst, const cuda::Tensor2DWrap<float> d_coeffs_)
+template<class Transform, class Filter, typename T, class Mats>
+__global__ void warp(const Filter src, cuda::ImageBatchVarShapeWrap<T> dst, const Mats mats, bool inverse)
 {
-    const int x         = blockDim.x * blockIdx.x + threadIdx.x;
+    const int x0        = blockDim.x * blockIdx.x * PIXELS_PER_THREAD + threadIdx.x;
     const int y         = blockDim.y * blockIdx.y + threadIdx.y;
     const int batch_idx = get_batch_idx();
     const int lid       = get_lid();
@@ -91,28 +107,42 @@ __global__ void warp(const Filter src, cuda::ImageBatchVarShapeWrap<T> dst, cons
     extern __shared__ float coeff[];
     if (lid < 9)
     {
-        coeff[lid] = *d_coeffs_.ptr(batch_idx, lid);
+        coeff[lid] = 0.f;
+    }
+    if (lid == 0)
+    {
+        WarpCoeffs<Transform>::load(mats, batch_idx, inverse, coeff);
     }
     __syncthreads();
 
-    if (x < dst.width(batch_idx) && y < dst.height(batch_idx))
+    if (y >= dst.height(batch_idx))
     {
-        const float2 coord        = Transform::calcCoord(coeff, x, y);
-        *dst.ptr(batch_idx, y, x) = nvcv::cuda::SaturateCast<T>(src(batch_idx, coord.y, coord.x));
+        return;
+    }
+
+#pragma unroll
+    for (int i = 0; i < PIXELS_PER_THREAD; ++i)
+    {
+        const int x = x0 + i * blockDim.x;
+        if (x < dst.width(batch_idx))
+        {
+            const float2 coord        = Transform::calcCoord(coeff, x, y);
+            *dst.ptr(batch_idx, y, x) = nvcv::cuda::SaturateCast<T>(src(batch_idx, coord.y, coord.x));
+        }
     }
 }
 
-template<class Transform, template<typename> class Filter, template<typename> class B, typename T>
+template<class Transform, template<typename> class Filter, template<typename> class B, typename T, class Mats>
 struct WarpDispatcher
 {
-    static void call(const Ptr2dVarShapeNHWC<T> src, cuda::ImageBatchVarShapeWrap<T> dst,
-                     const cuda::Tensor2DWrap<float> d_coeffs, const int max_height, const int max_width,
-                     const float4 borderValue, cudaStream_t stream)
+    static void call(const Ptr2dVarShapeNHWC<T> src, cuda::ImageBatchVarShapeWrap<T> dst, const Mats &mats,
+                     const bool inverse, const int max_height, const int max_width, const float4 borderValue,
+                     cudaStream_t stream)
     {
         using work_type = nvcv::cuda::ConvertBaseTypeTo<float, T>;
 
         dim3 block(BLOCK, BLOCK / 4);
-        dim3 grid(divUp(max_width, block.x), divUp(max_height, block.y), src.batches);
+        dim3 grid(divUp(max_width, block.x * PIXELS_PER_THREAD), divUp(max_height, block.y), src.batches);
 
         work_type    borderVal = nvcv::cuda::DropCast<NumComponents<T>>(borderValue);
         B<work_type> brd(0, 0, borderVal);
@@ -120,44 +150,45 @@ struct WarpDispatcher
         BorderReader<Ptr2dVarShapeNHWC<T>, B<work_type>>         brdSrc(src, brd);
         Filter<BorderReader<Ptr2dVarShapeNHWC<T>, B<work_type>>> filter_src(brdSrc);
         size_t                                                   smem_size = 9 * sizeof(float);
-        warp<Transform><<<grid, block, smem_size, stream>>>(filter_src, dst, d_coeffs);
+        warp<Transform><<<grid, block, smem_size, stream>>>(filter_src, dst, mats, inverse);
         checkKernelErrors();
     }
 };
 
-template<class Transform, typename T>
-void warp_caller(const Ptr2dVarShapeNHWC<T> src, cuda::ImageBatchVarShapeWrap<T> dst,
-                 const cuda::Tensor2DWrap<float> transform, const int max_height, const int max_width,
-                 const int interpolation, const int borderMode, const float4 borderValue, cudaStream_t stream)
+// Mats is either a cuda::Tensor2DWrap<float> of the user tensor, or SampleParams of the matrices given on the host.
+template<class Transform, typename T, class Mats = cuda::Tensor2DWrap<float>>
+void warp_caller(const Ptr2dVarShapeNHWC<T> src, cuda::ImageBatchVarShapeWrap<T> dst, const Mats &transform,
+                 const bool inverse, const int max_height, const int max_width, const int interpolation,
+                 const int borderMode, const float4 borderValue, cudaStream_t stream)
 {
-    typedef void (*func_t)(const Ptr2dVarShapeNHWC<T> src, cuda::ImageBatchVarShapeWrap<T> dst,
-                           const cuda::Tensor2DWrap<float> transform, const int max_height, const int max_width,
-                           const float4 borderValue, cudaStream_t stream);
+    typedef void (*func_t)(const Ptr2dVarShapeNHWC<T> src, cuda::ImageBatchVarShapeWrap<T> dst, const Mats &transform,
+                           const bool inverse, const int max_height, const int max_width, const float4 borderValue,
+                           cudaStream_t stream);
 
     static const func_t funcs[3][5] = {
-        {WarpDispatcher<Transform,  PointFilter, BrdConstant, T>::call,
-         WarpDispatcher<Transform,  PointFilter, BrdReplicate, T>::call,
-         WarpDispatcher<Transform,  PointFilter, BrdReflect, T>::call,
-         WarpDispatcher<Transform,  PointFilter, BrdWrap, T>::call,
-         WarpDispatcher<Transform,  PointFilter, BrdReflect101, T>::call},
-        {WarpDispatcher<Transform, LinearFilter, BrdConstant, T>::call,
-         WarpDispatcher<Transform, LinearFilter, BrdReplicate, T>::call,
-         WarpDispatcher<Transform, LinearFilter, BrdReflect, T>::call,
-         WarpDispatcher<Transform, LinearFilter, BrdWrap, T>::call,
-         WarpDispatcher<Transform, LinearFilter, BrdReflect101, T>::call},
-        {WarpDispatcher<Transform,  CubicFilter, BrdConstant, T>::call,
-         WarpDispatcher<Transform,  CubicFilter, BrdReplicate, T>::call,
-         WarpDispatcher<Transform,  CubicFilter, BrdReflect, T>::call,
-         WarpDispatcher<Transform,  CubicFilter, BrdWrap, T>::call,
-         WarpDispatcher<Transform,  CubicFilter, BrdReflect101, T>::call}
+        {WarpDispatcher<Transform,  PointFilter, BrdConstant, T, Mats>::call,
+         WarpDispatcher<Transform,  PointFilter, BrdReplicate, T, Mats>::call,
+         WarpDispatcher<Transform,  PointFilter, BrdReflect, T, Mats>::call,
+         WarpDispatcher<Transform,  PointFilter, BrdWrap, T, Mats>::call,
+         WarpDispatcher<Transform,  PointFilter, BrdReflect101, T, Mats>::call},
+        {WarpDispatcher<Transform, LinearFilter, BrdConstant, T, Mats>::call,
+         WarpDispatcher<Transform, LinearFilter, BrdReplicate, T, Mats>::call,
+         WarpDispatcher<Transform, LinearFilter, BrdReflect, T, Mats>::call,
+         WarpDispatcher<Transform, LinearFilter, BrdWrap, T, Mats>::call,
+         WarpDispatcher<Transform, LinearFilter, BrdReflect101, T, Mats>::call},
+        {WarpDispatcher<Transform,  CubicFilter, BrdConstant, T, Mats>::call,
+         WarpDispatcher<Transform,  CubicFilter, BrdReplicate, T, Mats>::call,
+         WarpDispatcher<Transform,  CubicFilter, BrdReflect, T, Mats>::call,
+         WarpDispatcher<Transform,  CubicFilter, BrdWrap, T, Mats>::call,
+         WarpDispatcher<Transform,  CubicFilter, BrdReflect101, T, Mats>::call}
     };
 
-    funcs[interpolation][borderMode](src, dst, transform, max_height, max_width, borderValue, stream);
+    funcs[interpolation][borderMode](src, dst, transform, inverse, max_height, max_width, borderValue, stream);
 }
 
-template<typename T>
+template<typename T, class Mats>
 void warpAffine(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
-                const nvcv::IImageBatchVarShapeDataStridedCuda &outData, const cuda::Tensor2DWrap<float> transform,
+                const nvcv::IImageBatchVarShapeDataStridedCuda &outData, const Mats &transform, const bool inverse,
                 const int interpolation, const int borderMode, const float4 borderValue, cudaStream_t stream)
 {
     cuda_op::Ptr2dVarShapeNHWC<T>   src_ptr(inData);
@@ -165,50 +196,177 @@ void warpAffine(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
 
     Size2D outMaxSize = outData.maxSize();
 
-    warp_caller<WarpAffineTransform, T>(src_ptr, dst_ptr, transform, outMaxSize.h, outMaxSize.w, interpolation,
-                                        borderMode, borderValue, stream);
+    warp_caller<WarpAffineTransform, T, Mats>(src_ptr, dst_ptr, transform, inverse, outMaxSize.h, outMaxSize.w,
+                                              interpolation, borderMode, borderValue, stream);
 }
 
 template<typename T>
 void warpPerspective(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
                      const nvcv::IImageBatchVarShapeDataStridedCuda &outData, const cuda::Tensor2DWrap<float> transform,
-                     const int interpolation, const int borderMode, const float4 borderValue, cudaStream_t stream)
+                     const bool inverse, const int interpolation, const int borderMode, const float4 borderValue,
+                     cudaStream_t stream)
 {
     Ptr2dVarShapeNHWC<T>            src_ptr(inData);
     cuda::ImageBatchVarShapeWrap<T> dst_ptr(outData);
 
     Size2D outMaxSize = outData.maxSize();
 
-    warp_caller<PerspectiveTransform, T>(src_ptr, dst_ptr, transform, outMaxSize.h, outMaxSize.w, interpolation,
-                                         borderMode, borderValue, stream);
+    warp_caller<PerspectiveTransform, T>(src_ptr, dst_ptr, transform, inverse, outMaxSize.h, outMaxSize.w,
+                                         interpolation, borderMode, borderValue, stream);
 }
 
-WarpAffineVarShape::WarpAffineVarShape(const int32_t maxBatchSize)
-    : CudaBaseOp()
-    , m_maxBatchSize(maxBatchSize)
+// Quadrilaterals are rows of the source corners [x0, y0, x1, y1, x2, y2, x3, y3] mapped to the output corners
+// (0, 0), (w, 0), (w, h) and (0, h), optionally preceded by the source sample index.
+struct Quads
+{
+    cuda::Tensor2DWrap<const float> data;
+
+    bool hasSampleIdx;
+    int  numSamples;
+};
+
+// Homography from the output pixels of a perspective crop to the source, the inverse of
+// cv::getPerspectiveTransform(quad, outputCorners). The unit square is mapped to the quadrilateral in closed form,
+// then scaled to the output size. Degenerate quadrilaterals are mapped as parallelograms.
+__device__ void QuadCoeffs(const float *q, int width, int height, float *coeff)
 {
-    if (m_maxBatchSize > 0)
+    const float x0 = q[0], y0 = q[1], x1 = q[2], y1 = q[3], x2 = q[4], y2 = q[5], x3 = q[6], y3 = q[7];
+
+    const float sx = x0 - x1 + x2 - x3, sy = y0 - y1 + y2 - y3;
+    const float dx1 = x1 - x2, dx2 = x3 - x2, dy1 = y1 - y2, dy2 = y3 - y2;
+    const float den = dx1 * dy2 - dx2 * dy1;
+
+    float g = 0.f, h = 0.f;
+    if ((sx != 0.f || sy != 0.f) && den != 0.f)
     {
-        // Allocating for 9 floats even though only 6 are required because the CUDA kernel
-        // is shared between affine & perspective
-        size_t bufferSize = sizeof(float) * 9 * m_maxBatchSize;
-        NVCV_CHECK_LOG(cudaMalloc(&m_transformationMatrix, bufferSize));
+        g = (sx * dy2 - dx2 * sy) / den;
+        h = (dx1 * sy - sx * dy1) / den;
     }
+
+    coeff[0] = (x1 - x0 + g * x1) / width;
+    coeff[1] = (x3 - x0 + h * x3) / height;
+    coeff[2] = x0;
+    coeff[3] = (y1 - y0 + g * y1) / width;
+    coeff[4] = (y3 - y0 + h * y3) / height;
+    coeff[5] = y0;
+    coeff[6] = g / width;
+    coeff[7] = h / height;
+    coeff[8] = 1.f;
 }
 
-WarpAffineVarShape::~WarpAffineVarShape()
+// Each block of the grid z dimension rectifies one quadrilateral into its output image, whose size gives the
+// scale of the homography, so regions of any shape and output size are processed in one launch.
+template<class Filter, typename T>
+__global__ void perspective_crop(const Filter src, cuda::ImageBatchVarShapeWrap<T> dst, const Quads quads)
 {
-    if (m_transformationMatrix != nullptr)
+    const int x0        = blockDim.x * blockIdx.x * PIXELS_PER_THREAD + threadIdx.x;
+    const int y         = blockDim.y * blockIdx.y + threadIdx.y;
+    const int batch_idx = get_batch_idx();
+    const int lid       = get_lid();
+
+    const int width = dst.width(batch_idx), height = dst.height(batch_idx);
+
+    const float *quad   = quads.data.ptr(batch_idx, 0);
+    int          sample = quads.numSamples == 1 ? 0 : batch_idx;
+    if (quads.hasSampleIdx)
+    {
+        sample = __float2int_rn(quad[0]);
+        ++quad;
+    }
+
+    __shared__ float coeff[9];
+    if (lid == 0)
     {
-        NVCV_CHECK_LOG(cudaFree(m_transformationMatrix));
+        QuadCoeffs(quad, width, height, coeff);
+    }
+    __syncthreads();
+
+    if (y >= height)
+    {
+        return;
+    }
+
+#pragma unroll
+    for (int i = 0; i < PIXELS_PER_THREAD; ++i)
+    {
+        const int x = x0 + i * blockDim.x;
+        if (x < width)
+        {
+            // quadrilaterals referring to a sample that doesn't exist produce zeros
+            if (sample < 0 || sample >= quads.numSamples)
+            {
+                *dst.ptr(batch_idx, y, x) = nvcv::cuda::SetAll<T>(0);
+                continue;
+            }
+
+            const float2 coord        = PerspectiveTransform::calcCoord(coeff, x, y);
+            *dst.ptr(batch_idx, y, x) = nvcv::cuda::SaturateCast<T>(src(sample, coord.y, coord.x));
+        }
     }
-    m_transformationMatrix = nullptr;
 }
 
-ErrorCode WarpAffineVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
-                                    const IImageBatchVarShapeDataStridedCuda &outData,
-                                    const ITensorDataStridedCuda &transMatrix, const int32_t flags,
-                                    const NVCVBorderType borderMode, const float4 borderValue, cudaStream_t stream)
+template<template<typename> class Filter, template<typename> class B, typename T>
+struct PerspectiveCropDispatcher
+{
+    static void call(const Ptr2dVarShapeNHWC<T> src, cuda::ImageBatchVarShapeWrap<T> dst, const Quads quads,
+                     const int numOutputs, const Size2D maxSize, const float4 borderValue, cudaStream_t stream)
+    {
+        using work_type = nvcv::cuda::ConvertBaseTypeTo<float, T>;
+
+        dim3 block(BLOCK, BLOCK / 4);
+        dim3 grid(divUp(maxSize.w, block.x * PIXELS_PER_THREAD), divUp(maxSize.h, block.y), numOutputs);
+
+        work_type    borderVal = nvcv::cuda::DropCast<NumComponents<T>>(borderValue);
+        B<work_type> brd(0, 0, borderVal);
+        BorderReader<Ptr2dVarShapeNHWC<T>, B<work_type>>         brdSrc(src, brd);
+        Filter<BorderReader<Ptr2dVarShapeNHWC<T>, B<work_type>>> filter_src(brdSrc);
+        perspective_crop<<<grid, block, 0, stream>>>(filter_src, dst, quads);
+        checkKernelErrors();
+    }
+};
+
+template<typename T>
+void perspectiveCrop(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
+                     const nvcv::IImageBatchVarShapeDataStridedCuda &outData, const Quads quads,
+                     const int interpolation, const int borderMode, const float4 borderValue, cudaStream_t stream)
+{
+    typedef void (*func_t)(const Ptr2dVarShapeNHWC<T> src, cuda::ImageBatchVarShapeWrap<T> dst, const Quads quads,
+                           const int numOutputs, const Size2D maxSize, const float4 borderValue,
+                           cudaStream_t stream);
+
+    static const func_t funcs[3][5] = {
+        {PerspectiveCropDispatcher< PointFilter, BrdConstant, T>::call,
+         PerspectiveCropDispatcher< PointFilter, BrdReplicate, T>::call,
+         PerspectiveCropDispatcher< PointFilter, BrdReflect, T>::call,
+         PerspectiveCropDispatcher< PointFilter, BrdWrap, T>::call,
+         PerspectiveCropDispatcher< PointFilter, BrdReflect101, T>::call},
+        {PerspectiveCropDispatcher<LinearFilter, BrdConstant, T>::call,
+         PerspectiveCropDispatcher<LinearFilter, BrdReplicate, T>::call,
+         PerspectiveCropDispatcher<LinearFilter, BrdReflect, T>::call,
+         PerspectiveCropDispatcher<LinearFilter, BrdWrap, T>::call,
+         PerspectiveCropDispatcher<LinearFilter, BrdReflect101, T>::call},
+        {PerspectiveCropDispatcher< CubicFilter, BrdConstant, T>::call,
+         PerspectiveCropDispatcher< CubicFilter, BrdReplicate, T>::call,
+         PerspectiveCropDispatcher< CubicFilter, BrdReflect, T>::call,
+         PerspectiveCropDispatcher< CubicFilter, BrdWrap, T>::call,
+         PerspectiveCropDispatcher< CubicFilter, BrdReflect101, T>::call}
+    };
+
+    Ptr2dVarShapeNHWC<T>            src_ptr(inData);
+    cuda::ImageBatchVarShapeWrap<T> dst_ptr(outData);
+
+    funcs[interpolation][borderMode](src_ptr, dst_ptr, quads, outData.numImages(), outData.maxSize(), borderValue,
+                                     stream);
+}
+
+WarpAffineVarShape::WarpAffineVarShape(const int32_t maxBatchSize)
+    : CudaBaseOp()
+    , m_maxBatchSize(maxBatchSize)
+{
+}
+
+ErrorCode WarpAffineVarShape::validate(const IImageBatchVarShapeDataStridedCuda &inData,
+                                       const IImageBatchVarShapeDataStridedCuda &outData) const
 {
     if (m_maxBatchSize <= 0)
     {
@@ -254,8 +412,6 @@ ErrorCode WarpAffineVarShape::infer(const IImageBatchVarShapeDataStridedCuda &in
         return ErrorCode::INVALID_DATA_SHAPE;
     }
 
-    const int interpolation = flags & NVCV_INTERP_MAX;
-
     DataType data_type = helpers::GetLegacyDataType(inData.uniqueFormat());
 
     if (!(data_type == kCV_8U || data_type == kCV_8S || data_type == kCV_16U || data_type == kCV_16S
@@ -265,6 +421,16 @@ ErrorCode WarpAffineVarShape::infer(const IImageBatchVarShapeDataStridedCuda &in
         return ErrorCode::INVALID_DATA_TYPE;
     }
 
+    return SUCCESS;
+}
+
+template<class Mats>
+void warpAffineVarShape(const IImageBatchVarShapeDataStridedCuda &inData,
+                        const IImageBatchVarShapeDataStridedCuda &outData, const Mats &transMatrix, const int32_t flags,
+                        const NVCVBorderType borderMode, const float4 borderValue, cudaStream_t stream)
+{
+    const int interpolation = flags & NVCV_INTERP_MAX;
+
     NVCV_ASSERT(interpolation == NVCV_INTERP_NEAREST || interpolation == NVCV_INTERP_LINEAR
                 || interpolation == NVCV_INTERP_CUBIC);
     NVCV_ASSERT(borderMode == NVCV_BORDER_REFLECT101 || borderMode == NVCV_BORDER_REPLICATE
@@ -274,62 +440,74 @@ ErrorCode WarpAffineVarShape::infer(const IImageBatchVarShapeDataStridedCuda &in
     // Check if inverse op is needed
     bool performInverse = flags & NVCV_WARP_INVERSE_MAP;
 
-    // Wrap the matrix in 2D wrappers with proper pitch
-    cuda::Tensor2DWrap<float> transMatrixInput(transMatrix);
-    cuda::Tensor2DWrap<float> transMatrixOutput(m_transformationMatrix, static_cast<int>(sizeof(float) * 9));
-
-    if (performInverse)
-    {
-        inverseMatWarpAffine<<<1, inData.numImages(), 0, stream>>>(inData.numImages(), transMatrixInput,
-                                                                   transMatrixOutput);
-        checkKernelErrors();
-    }
-    else
-    {
-        NVCV_CHECK_LOG(cudaMemcpy2DAsync(m_transformationMatrix, sizeof(float) * 9, transMatrixInput.ptr(0, 0),
-                                         transMatrixInput.strides()[0], sizeof(float) * 6, inData.numImages(),
-                                         cudaMemcpyDeviceToDevice, stream));
-    }
-
     typedef void (*func_t)(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
-                           const nvcv::IImageBatchVarShapeDataStridedCuda &outData,
-                           const cuda::Tensor2DWrap<float> transform, const int interpolation, const int borderMode,
-                           const float4 borderValue, cudaStream_t stream);
+                           const nvcv::IImageBatchVarShapeDataStridedCuda &outData, const Mats &transform,
+                           const bool inverse, const int interpolation, const int borderMode, const float4 borderValue,
+                           cudaStream_t stream);
 
     static const func_t funcs[6][4] = {
-        {      warpAffine<uchar>,  0 /*warpAffine<uchar2>*/,      warpAffine<uchar3>,      warpAffine<uchar4>},
-        {0 /*warpAffine<schar>*/,   0 /*warpAffine<char2>*/, 0 /*warpAffine<char3>*/, 0 /*warpAffine<char4>*/},
-        {     warpAffine<ushort>, 0 /*warpAffine<ushort2>*/,     warpAffine<ushort3>,     warpAffine<ushort4>},
-        {      warpAffine<short>,  0 /*warpAffine<short2>*/,      warpAffine<short3>,      warpAffine<short4>},
-        {  0 /*warpAffine<int>*/,    0 /*warpAffine<int2>*/,  0 /*warpAffine<int3>*/,  0 /*warpAffine<int4>*/},
-        {      warpAffine<float>,  0 /*warpAffine<float2>*/,      warpAffine<float3>,      warpAffine<float4>}
+        {warpAffine<uchar, Mats>, 0 /*warpAffine<uchar2>*/, warpAffine<uchar3, Mats>, warpAffine<uchar4, Mats>},
+        {0 /*warpAffine<schar>*/, 0 /*warpAffine<char2>*/, 0 /*warpAffine<char3>*/, 0 /*warpAffine<char4>*/},
+        {warpAffine<ushort, Mats>, 0 /*warpAffine<ushort2>*/, warpAffine<ushort3, Mats>, warpAffine<ushort4, Mats>},
+        {warpAffine<short, Mats>, 0 /*warpAffine<short2>*/, warpAffine<short3, Mats>, warpAffine<short4, Mats>},
+        {0 /*warpAffine<int>*/, 0 /*warpAffine<int2>*/, 0 /*warpAffine<int3>*/, 0 /*warpAffine<int4>*/},
+        {warpAffine<float, Mats>, 0 /*warpAffine<float2>*/, warpAffine<float3, Mats>, warpAffine<float4, Mats>}
     };
 
+    DataType data_type = helpers::GetLegacyDataType(inData.uniqueFormat());
+    int      channels  = inData.uniqueFormat().numChannels();
+
     const func_t func = funcs[data_type][channels - 1];
     NVCV_ASSERT(func != 0);
 
-    func(inData, outData, transMatrixOutput, interpolation, borderMode, borderValue, stream);
-    return SUCCESS;
+    func(inData, outData, transMatrix, performInverse, interpolation, borderMode, borderValue, stream);
 }
 
-WarpPerspectiveVarShape::WarpPerspectiveVarShape(const int32_t maxBatchSize)
-    : CudaBaseOp()
-    , m_maxBatchSize(maxBatchSize)
+ErrorCode WarpAffineVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                    const IImageBatchVarShapeDataStridedCuda &outData,
+                                    const ITensorDataStridedCuda &transMatrix, const int32_t flags,
+                                    const NVCVBorderType borderMode, const float4 borderValue, cudaStream_t stream)
 {
-    if (m_maxBatchSize > 0)
+    ErrorCode err = validate(inData, outData);
+    if (err != SUCCESS)
     {
-        size_t bufferSize = sizeof(float) * 9 * m_maxBatchSize;
-        NVCV_CHECK_LOG(cudaMalloc(&m_transformationMatrix, bufferSize));
+        return err;
     }
+
+    // The kernel reads (and inverts if needed) each sample's matrix straight from the user tensor
+    warpAffineVarShape(inData, outData, cuda::Tensor2DWrap<float>(transMatrix), flags, borderMode, borderValue,
+                       stream);
+    return SUCCESS;
 }
 
-WarpPerspectiveVarShape::~WarpPerspectiveVarShape()
+ErrorCode WarpAffineVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
+                                    const IImageBatchVarShapeDataStridedCuda &outData, const float *transMatrix,
+                                    const int32_t flags, const NVCVBorderType borderMode, const float4 borderValue,
+                                    cudaStream_t stream)
 {
-    if (m_transformationMatrix != nullptr)
+    ErrorCode err = validate(inData, outData);
+    if (err != SUCCESS)
+    {
+        return err;
+    }
+
+    if (inData.numImages() > CVCUDA_MAX_HOST_PARAM_SAMPLES)
     {
-        NVCV_CHECK_LOG(cudaFree(m_transformationMatrix));
+        LOG_ERROR("Invalid number of images, host parameters are limited to " << CVCUDA_MAX_HOST_PARAM_SAMPLES
+                                                                              << " samples");
+        return ErrorCode::INVALID_DATA_SHAPE;
     }
-    m_transformationMatrix = nullptr;
+
+    // The matrices are passed to the kernel by value, which inverts them if needed as with a tensor
+    warpAffineVarShape(inData, outData, SampleParams<float, 6>(transMatrix, inData.numImages()), flags, borderMode,
+                       borderValue, stream);
+    return SUCCESS;
+}
+
+WarpPerspectiveVarShape::WarpPerspectiveVarShape(const int32_t maxBatchSize)
+    : CudaBaseOp()
+    , m_maxBatchSize(maxBatchSize)
+{
 }
 
 ErrorCode WarpPerspectiveVarShape::infer(const IImageBatchVarShapeDataStridedCuda &inData,
@@ -401,27 +579,13 @@ ErrorCode WarpPerspectiveVarShape::infer(const IImageBatchVarShapeDataStridedCud
     // Check if inverse op is needed
     bool performInverse = flags & NVCV_WARP_INVERSE_MAP;
 
-    // Wrap the matrix in 2D wrappers with proper pitch
+    // The kernel reads (and inverts if needed) each sample's matrix straight from the user tensor
     cuda::Tensor2DWrap<float> transMatrixInput(transMatrix);
-    cuda::Tensor2DWrap<float> transMatrixOutput(m_transformationMatrix, static_cast<int>(sizeof(float) * 9));
-
-    if (performInverse)
-    {
-        inverseMatWarpPerspective<<<1, inData.numImages(), 0, stream>>>(inData.numImages(), transMatrixInput,
-                                                                        transMatrixOutput);
-        checkKernelErrors();
-    }
-    else
-    {
-        NVCV_CHECK_LOG(cudaMemcpy2DAsync(m_transformationMatrix, sizeof(float) * 9, transMatrixInput.ptr(0, 0),
-                                         transMatrixInput.strides()[0], sizeof(float) * 9, inData.numImages(),
-                                         cudaMemcpyDeviceToDevice, stream));
-    }
 
     typedef void (*func_t)(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
                            const nvcv::IImageBatchVarShapeDataStridedCuda &outData,
-                           const cuda::Tensor2DWrap<float> transform, const int interpolation, const int borderMode,
-                           const float4 borderValue, cudaStream_t stream);
+                           const cuda::Tensor2DWrap<float> transform, const bool inverse, const int interpolation,
+                           const int borderMode, const float4 borderValue, cudaStream_t stream);
 
     static const func_t funcs[6][4] = {
         {      warpPerspective<uchar>,  0 /*warpPerspective<uchar2>*/,      warpPerspective<uchar3>,warpPerspective<uchar4>                                                                                                    },
@@ -437,7 +601,128 @@ ErrorCode WarpPerspectiveVarShape::infer(const IImageBatchVarShapeDataStridedCud
     const func_t func = funcs[data_type][channels - 1];
     NVCV_ASSERT(func != 0);
 
-    func(inData, outData, transMatrixOutput, interpolation, borderMode, borderValue, stream);
+    func(inData, outData, transMatrixInput, performInverse, interpolation, borderMode, borderValue, stream);
+    return SUCCESS;
+}
+
+ErrorCode WarpPerspectiveVarShape::inferCrop(const IImageBatchVarShapeDataStridedCuda &inData,
+                                             const ITensorDataStridedCuda                 &quadData,
+                                             const IImageBatchVarShapeDataStridedCuda     &outData,
+                                             const int32_t interpolation, const NVCVBorderType borderMode,
+                                             const float4 borderValue, cudaStream_t stream)
+{
+    DataFormat input_format  = helpers::GetLegacyDataFormat(inData);
+    DataFormat output_format = helpers::GetLegacyDataFormat(outData);
+
+    if (input_format != output_format)
+    {
+        LOG_ERROR("Invalid DataFormat between input (" << input_format << ") and output (" << output_format << ")");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!(input_format == kNHWC || input_format == kHWC))
+    {
+        LOG_ERROR("Invalid DataFormat " << input_format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!inData.uniqueFormat() || outData.uniqueFormat() != inData.uniqueFormat())
+    {
+        LOG_ERROR("Images in the input and output varshapes must all have the same format");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    int channels = inData.uniqueFormat().numChannels();
+
+    DataType data_type = helpers::GetLegacyDataType(inData.uniqueFormat());
+
+    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_16S || data_type == kCV_32F))
+    {
+        LOG_ERROR("Invalid DataType " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (channels == 2 || channels > 4)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (interpolation != NVCV_INTERP_NEAREST && interpolation != NVCV_INTERP_LINEAR
+        && interpolation != NVCV_INTERP_CUBIC)
+    {
+        LOG_ERROR("Invalid interpolation " << interpolation);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (!(borderMode == NVCV_BORDER_REFLECT101 || borderMode == NVCV_BORDER_REPLICATE
+          || borderMode == NVCV_BORDER_CONSTANT || borderMode == NVCV_BORDER_REFLECT || borderMode == NVCV_BORDER_WRAP))
+    {
+        LOG_ERROR("Invalid border mode " << borderMode);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    if (quadData.dtype() != TYPE_F32)
+    {
+        LOG_ERROR("Invalid quadrilaterals DataType " << quadData.dtype() << ", it must be float32");
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (quadData.rank() != 2 || (quadData.shape(1) != 8 && quadData.shape(1) != 9))
+    {
+        LOG_ERROR("Invalid quadrilaterals shape " << quadData.shape() << ", it must be [N, 8] or [N, 9]");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (quadData.stride(1) != sizeof(float))
+    {
+        LOG_ERROR("Invalid quadrilaterals layout, corner coordinates must be packed");
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    const int numQuads = quadData.shape(0);
+    if (outData.numImages() != numQuads)
+    {
+        LOG_ERROR("Invalid number of output images " << outData.numImages()
+                                                     << ", it must be the number of quadrilaterals " << numQuads);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    Quads quads;
+    quads.hasSampleIdx = quadData.shape(1) == 9;
+    quads.numSamples   = inData.numImages();
+    if (!quads.hasSampleIdx && quads.numSamples != 1 && quads.numSamples != numQuads)
+    {
+        LOG_ERROR("Quadrilaterals without sample index require one input image or one image per quadrilateral, got "
+                  << quads.numSamples << " images and " << numQuads << " quadrilaterals");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (numQuads == 0)
+    {
+        return SUCCESS;
+    }
+
+    quads.data = cuda::Tensor2DWrap<const float>(quadData);
+
+    typedef void (*func_t)(const nvcv::IImageBatchVarShapeDataStridedCuda &inData,
+                           const nvcv::IImageBatchVarShapeDataStridedCuda &outData, const Quads quads,
+                           const int interpolation, const int borderMode, const float4 borderValue,
+                           cudaStream_t stream);
+
+    static const func_t funcs[6][4] = {
+        { perspectiveCrop<uchar>, 0,  perspectiveCrop<uchar3>,  perspectiveCrop<uchar4>},
+        {                      0, 0,                        0,                        0},
+        {perspectiveCrop<ushort>, 0, perspectiveCrop<ushort3>, perspectiveCrop<ushort4>},
+        { perspectiveCrop<short>, 0,  perspectiveCrop<short3>,  perspectiveCrop<short4>},
+        {                      0, 0,                        0,                        0},
+        { perspectiveCrop<float>, 0,  perspectiveCrop<float3>,  perspectiveCrop<float4>}
+    };
+
+    const func_t func = funcs[data_type][channels - 1];
+    NVCV_ASSERT(func != 0);
+
+    func(inData, outData, quads, interpolation, borderMode, borderValue, stream);
     return SUCCESS;
 }
 
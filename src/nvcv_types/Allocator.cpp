@@ -19,6 +19,9 @@
 #include "priv/CustomAllocator.hpp"
 #include "priv/DefaultAllocator.hpp"
 #include "priv/Exception.hpp"
+#include "priv/CompressibleAllocator.hpp"
+#include "priv/ManagedAllocator.hpp"
+#include "priv/PoolAllocator.hpp"
 #include "priv/Status.hpp"
 #include "priv/SymbolVersioning.hpp"
 
@@ -51,6 +54,170 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvAllocatorConstructCustom,
         });
 }
 
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorConstructCustomAsync,
+                (const NVCVCustomAllocator *customAllocators, int32_t numCustomAllocators,
+                 const NVCVCustomCudaMemAsyncAllocator *cudaAllocator, NVCVAllocatorHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            if (cudaAllocator == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                                      "Pointer to stream-ordered cuda allocator must not be NULL");
+            }
+
+            *handle
+                = priv::CreateCoreObject<priv::CustomAllocator>(customAllocators, numCustomAllocators, cudaAllocator);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorConstructPool,
+                (const NVCVPoolAllocatorParams *params, NVCVAllocatorHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            *handle = priv::CreateCoreObject<priv::PoolAllocator>(params);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorConstructDevicePool,
+                (int32_t device, const NVCVPoolAllocatorParams *params, NVCVAllocatorHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            if (device < 0)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Device must be >= 0, not %d", device);
+            }
+
+            *handle = priv::CreateCoreObject<priv::PoolAllocator>(params, device);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorConstructManaged,
+                (const NVCVManagedAllocatorParams *params, NVCVAllocatorHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            *handle = priv::CreateCoreObject<priv::ManagedAllocator>(params);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorConstructCompressible,
+                (const NVCVCompressibleAllocatorParams *params, NVCVAllocatorHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            if (params && params->minSize < 0)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Minimum size must be >= 0, not %ld",
+                                      params->minSize);
+            }
+
+            *handle = priv::CreateCoreObject<priv::CompressibleAllocator>(params);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorIsCompressible, (NVCVAllocatorHandle handle, int8_t *compressible))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (compressible == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output must not be NULL");
+            }
+
+            auto *alloc = dynamic_cast<priv::CompressibleAllocator *>(&priv::ToStaticRef<priv::IAllocator>(handle));
+            *compressible = alloc != nullptr && alloc->compressible();
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorTrim, (NVCVAllocatorHandle handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            auto *pool = dynamic_cast<priv::PoolAllocator *>(&priv::ToStaticRef<priv::IAllocator>(handle));
+            if (pool == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Allocator must be a pool allocator");
+            }
+
+            pool->trim();
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorGetDevice, (NVCVAllocatorHandle handle, int32_t *device))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (device == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output device must not be NULL");
+            }
+
+            *device = priv::GetAllocator(handle).device();
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorGetStats,
+                (NVCVAllocatorHandle handle, NVCVResourceType resType, NVCVAllocatorStats *stats))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (stats == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output stats must not be NULL");
+            }
+
+            *stats = priv::GetAllocator(handle).stats(resType);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorResetStats, (NVCVAllocatorHandle handle))
+{
+    return priv::ProtectCall([&] { priv::GetAllocator(handle).resetStats(); });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorSetTraceFunc,
+                (NVCVAllocatorHandle handle, NVCVAllocatorTraceFunc fn, void *ctx))
+{
+    return priv::ProtectCall([&] { priv::GetAllocator(handle).setTraceFunc(fn, ctx); });
+}
+
 NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorDecRef, (NVCVAllocatorHandle handle, int *newRefCount))
 {
     return priv::ProtectCall(
@@ -175,6 +342,34 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvAllocatorFreeHostPinnedMemory,
         });
 }
 
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorAllocHostPinnedMemoryEx,
+                (NVCVAllocatorHandle halloc, void **ptr, int64_t sizeBytes, int32_t alignBytes, uint32_t flags))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (ptr == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output buffer must not be NULL");
+            }
+
+            *ptr = priv::ToStaticRef<priv::IAllocator>(halloc).allocHostPinnedMem(sizeBytes, alignBytes, flags);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorFreeHostPinnedMemoryEx,
+                (NVCVAllocatorHandle halloc, void *ptr, int64_t sizeBytes, int32_t alignBytes, uint32_t flags))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (ptr != nullptr)
+            {
+                priv::ToStaticRef<priv::IAllocator>(halloc).freeHostPinnedMem(ptr, sizeBytes, alignBytes, flags);
+            }
+        });
+}
+
 NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvAllocatorAllocCudaMemory,
                 (NVCVAllocatorHandle halloc, void **ptr, int64_t sizeBytes, int32_t alignBytes))
 {
@@ -202,3 +397,31 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvAllocatorFreeCudaMemory,
             }
         });
 }
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorAllocCudaMemoryAsync,
+                (NVCVAllocatorHandle halloc, void **ptr, int64_t sizeBytes, int32_t alignBytes, CUstream stream))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (ptr == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output buffer must not be NULL");
+            }
+
+            *ptr = priv::ToStaticRef<priv::IAllocator>(halloc).allocCudaMemAsync(sizeBytes, alignBytes, stream);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorFreeCudaMemoryAsync,
+                (NVCVAllocatorHandle halloc, void *ptr, int64_t sizeBytes, int32_t alignBytes, CUstream stream))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (ptr != nullptr)
+            {
+                priv::ToStaticRef<priv::IAllocator>(halloc).freeCudaMemAsync(ptr, sizeBytes, alignBytes, stream);
+            }
+        });
+}
@@ -16,6 +16,7 @@
  */
 
 #include "priv/AllocatorManager.hpp"
+#include "priv/Exception.hpp"
 #include "priv/ImageBatchManager.hpp"
 #include "priv/ImageManager.hpp"
 #include "priv/Status.hpp"
@@ -26,6 +27,28 @@
 
 namespace priv = nvcv::priv;
 
+namespace {
+
+template<class Manager>
+void ExportHandleStats(NVCVHandleStats *stats)
+{
+    if (stats == nullptr)
+    {
+        throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output stats must not be NULL");
+    }
+
+    priv::HandleManagerStats mstats = std::get<Manager &>(priv::GlobalContext().managerList()).stats();
+
+    stats->capacity         = mstats.capacity;
+    stats->inUse            = mstats.inUse;
+    stats->cacheHits        = mstats.cacheHits;
+    stats->globalRefills    = mstats.globalRefills;
+    stats->globalFlushes    = mstats.globalFlushes;
+    stats->contendedRetries = mstats.contendedRetries;
+}
+
+} // namespace
+
 NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvConfigSetMaxImageCount, (int32_t maxCount))
 {
     return priv::ProtectCall(
@@ -93,3 +116,23 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvConfigSetMaxAllocatorCount, (int32_t maxCo
             }
         });
 }
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvConfigGetImageHandleStats, (NVCVHandleStats * stats))
+{
+    return priv::ProtectCall([&] { ExportHandleStats<priv::ImageManager>(stats); });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvConfigGetImageBatchHandleStats, (NVCVHandleStats * stats))
+{
+    return priv::ProtectCall([&] { ExportHandleStats<priv::ImageBatchManager>(stats); });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvConfigGetTensorHandleStats, (NVCVHandleStats * stats))
+{
+    return priv::ProtectCall([&] { ExportHandleStats<priv::TensorManager>(stats); });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvConfigGetAllocatorHandleStats, (NVCVHandleStats * stats))
+{
+    return priv::ProtectCall([&] { ExportHandleStats<priv::AllocatorManager>(stats); });
+}
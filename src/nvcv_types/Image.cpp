@@ -87,6 +87,91 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvImageWrapDataConstruct,
         });
 }
 
+static void ReleaseParentImage(void *ctx, const NVCVImageData *)
+{
+    nvcvImageDecRef(static_cast<NVCVImageHandle>(ctx), nullptr);
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageRoi,
+                (NVCVImageHandle hparent, const NVCVRectI *roi, NVCVImageHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (hparent == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Parent image handle must not be NULL");
+            }
+
+            if (roi == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to region of interest must not be NULL");
+            }
+
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            auto &parent = priv::ToStaticRef<priv::IImage>(hparent);
+
+            priv::Size2D      size   = parent.size();
+            priv::ImageFormat format = parent.format();
+
+            if (roi->width <= 0 || roi->height <= 0 || roi->x < 0 || roi->y < 0 || roi->x + roi->width > size.w
+                || roi->y + roi->height > size.h)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT)
+                    << "Region of interest {" << roi->x << ", " << roi->y << ", " << roi->width << ", "
+                    << roi->height << "} must be a non-empty region inside the " << size.w << "x" << size.h << " image";
+            }
+
+            NVCVImageData imgData;
+            parent.exportData(imgData);
+
+            if (imgData.bufferType != NVCV_IMAGE_BUFFER_STRIDED_CUDA)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                                      "Only cuda-accessible pitch-linear images can have region views");
+            }
+
+            NVCVImageBufferStrided &buffer = imgData.buffer.strided;
+            for (int p = 0; p < buffer.numPlanes; ++p)
+            {
+                NVCVImagePlaneStrided &plane = buffer.planes[p];
+
+                // subsampled planes need the region to start at a whole plane pixel
+                if ((int64_t)roi->x * plane.width % size.w != 0 || (int64_t)roi->y * plane.height % size.h != 0)
+                {
+                    throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT)
+                        << "Region of interest origin (" << roi->x << ", " << roi->y
+                        << ") isn't aligned to the subsampling of plane #" << p;
+                }
+
+                int64_t x = (int64_t)roi->x * plane.width / size.w;
+                int64_t y = (int64_t)roi->y * plane.height / size.h;
+
+                priv::Size2D planeSize = format.planeSize({roi->width, roi->height}, p);
+
+                plane.basePtr += y * plane.rowStride + x * format.planePixelStrideBytes(p);
+                plane.width  = planeSize.w;
+                plane.height = planeSize.h;
+            }
+
+            // the view owns a reference to the parent, released by the cleanup function
+            priv::CoreObjectIncRef(hparent);
+            try
+            {
+                *handle = priv::CreateCoreObject<priv::ImageWrapData>(imgData, &ReleaseParentImage, hparent);
+            }
+            catch (...)
+            {
+                priv::CoreObjectDecRef(hparent);
+                throw;
+            }
+        });
+}
+
 NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageDecRef, (NVCVImageHandle handle, int *newRefCount))
 {
     return priv::ProtectCall(
@@ -240,3 +325,13 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvImageGetUserPointer, (NVCVImageHandle hand
             }
         });
 }
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageSetReleaseStream, (NVCVImageHandle handle, CUstream stream))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            auto &img = priv::ToStaticRef<priv::IImage>(handle);
+            img.setReleaseStream(stream);
+        });
+}
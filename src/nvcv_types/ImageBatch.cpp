@@ -20,12 +20,16 @@
 #include "priv/IAllocator.hpp"
 #include "priv/ImageBatchManager.hpp"
 #include "priv/ImageBatchVarShape.hpp"
+#include "priv/ImageBatchVarShapeWrapData.hpp"
 #include "priv/ImageFormat.hpp"
+#include "priv/TensorManager.hpp"
 #include "priv/Status.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/ImageBatch.h>
 
+#include <vector>
+
 namespace priv = nvcv::priv;
 
 NVCV_DEFINE_API(0, 0, NVCVStatus, nvcvImageBatchVarShapeCalcRequirements,
@@ -67,6 +71,73 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvImageBatchVarShapeConstruct,
         });
 }
 
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageBatchVarShapeSubrange,
+                (NVCVImageBatchHandle hparent, int32_t begIndex, int32_t numImages, NVCVImageBatchHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (hparent == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Parent image batch handle must not be NULL");
+            }
+
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            auto &parent = priv::ToDynamicRef<priv::IImageBatchVarShape>(hparent);
+
+            if (begIndex < 0 || numImages < 1 || begIndex + numImages > parent.numImages())
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT)
+                    << "Image range [" << begIndex << ", " << begIndex + numImages
+                    << ") must be a non-empty range inside [0, " << parent.numImages() << ")";
+            }
+
+            std::vector<NVCVImageHandle> images(numImages);
+            parent.getImages(begIndex, images.data(), numImages);
+
+            NVCVImageBatchHandle hbatch = priv::CreateCoreObject<priv::ImageBatchVarShape>(
+                priv::ImageBatchVarShape::CalcRequirements(numImages), parent.alloc());
+            try
+            {
+                auto &batch = priv::ToDynamicRef<priv::ImageBatchVarShape>(hbatch);
+                batch.pushImages(images.data(), numImages);
+                batch.setParent(hparent);
+            }
+            catch (...)
+            {
+                priv::CoreObjectDecRef(hbatch);
+                throw;
+            }
+
+            *handle = hbatch;
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageBatchVarShapeWrapDataConstruct,
+                (const NVCVImageBatchData *data, NVCVImageBatchDataCleanupFunc cleanup, void *ctxCleanup,
+                 NVCVImageBatchHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (data == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to image batch data must not be NULL");
+            }
+
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            *handle = priv::CreateCoreObject<priv::ImageBatchVarShapeWrapData>(*data, cleanup, ctxCleanup);
+        });
+}
+
 NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageBatchDecRef, (NVCVImageBatchHandle handle, int *newRefCount))
 {
     return priv::ProtectCall(
@@ -281,6 +352,19 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvImageBatchVarShapePushImagesCallback,
         });
 }
 
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageBatchVarShapeConstructImages,
+                (NVCVImageBatchHandle handle, const int32_t *widths, const int32_t *heights, int32_t numImages,
+                 NVCVImageFormat format))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            auto &batch = priv::ToDynamicRef<priv::ImageBatchVarShape>(handle);
+
+            batch.constructImages(widths, heights, numImages, priv::ImageFormat{format});
+        });
+}
+
 NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvImageBatchVarShapePopImages, (NVCVImageBatchHandle handle, int32_t numImages))
 {
     return priv::ProtectCall(
@@ -292,6 +376,18 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvImageBatchVarShapePopImages, (NVCVImageBat
         });
 }
 
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageBatchVarShapeSetImage,
+                (NVCVImageBatchHandle handle, int32_t index, NVCVImageHandle image))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            auto &batch = priv::ToDynamicRef<priv::IImageBatchVarShape>(handle);
+
+            batch.setImage(index, image);
+        });
+}
+
 NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvImageBatchVarShapeClear, (NVCVImageBatchHandle handle))
 {
     return priv::ProtectCall(
@@ -303,6 +399,45 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvImageBatchVarShapeClear, (NVCVImageBatchHa
         });
 }
 
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageBatchVarShapeSetActiveMask,
+                (NVCVImageBatchHandle handle, NVCVTensorHandle mask))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            auto &batch = priv::ToDynamicRef<priv::IImageBatchVarShape>(handle);
+
+            const uint8_t *flags = nullptr;
+            if (mask != nullptr)
+            {
+                NVCVTensorData data;
+                priv::ToStaticRef<priv::ITensor>(mask).exportData(data);
+
+                if (data.bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA)
+                {
+                    throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Active mask must be in cuda memory");
+                }
+
+                if (data.rank != 1 || data.dtype != NVCV_DATA_TYPE_U8 || data.buffer.strided.strides[0] != 1)
+                {
+                    throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                                          "Active mask must be a packed rank-1 tensor of U8");
+                }
+
+                if (data.shape[0] < batch.capacity())
+                {
+                    throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT)
+                        << "Active mask must have at least one flag per image, " << data.shape[0] << " < "
+                        << batch.capacity();
+                }
+
+                flags = reinterpret_cast<const uint8_t *>(data.buffer.strided.basePtr);
+            }
+
+            batch.setActiveMask(mask, flags);
+        });
+}
+
 NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvImageBatchVarShapeGetImages,
                 (NVCVImageBatchHandle handle, int32_t begIndex, NVCVImageHandle *outImages, int32_t numImages))
 {
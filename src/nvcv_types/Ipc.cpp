@@ -0,0 +1,259 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/Exception.hpp"
+#include "priv/IContext.hpp"
+#include "priv/Image.hpp"
+#include "priv/ImageManager.hpp"
+#include "priv/IpcRegistry.hpp"
+#include "priv/Status.hpp"
+#include "priv/SymbolVersioning.hpp"
+#include "priv/TensorManager.hpp"
+#include "priv/TensorWrapDataStrided.hpp"
+
+#include <cuda_runtime.h>
+#include <nvcv/Ipc.h>
+#include <util/CheckError.hpp>
+
+#include <cstring>
+
+namespace priv = nvcv::priv;
+
+static_assert(sizeof(cudaIpcMemHandle_t) == NVCV_IPC_HANDLE_SIZE);
+static_assert(sizeof(cudaIpcEventHandle_t) == NVCV_IPC_HANDLE_SIZE);
+
+namespace {
+
+// Makes stream wait for the event recorded by the exporter.
+void WaitIpcEvent(const char (&eventHandle)[NVCV_IPC_HANDLE_SIZE], cudaStream_t stream)
+{
+    cudaIpcEventHandle_t handle;
+    std::memcpy(&handle, eventHandle, sizeof(handle));
+
+    cudaEvent_t ev;
+    NVCV_CHECK_THROW(cudaIpcOpenEventHandle(&ev, handle));
+
+    cudaError_t err = cudaStreamWaitEvent(stream, ev, 0);
+    NVCV_CHECK_LOG(cudaEventDestroy(ev));
+    NVCV_CHECK_THROW(err);
+}
+
+// Maps the exported allocation and calls fn with its start in this process,
+// the mapping is released if fn throws.
+template<class F>
+auto ImportIpcMem(const char (&memHandle)[NVCV_IPC_HANDLE_SIZE], F &&fn)
+{
+    cudaIpcMemHandle_t handle;
+    std::memcpy(&handle, memHandle, sizeof(handle));
+
+    priv::IpcRegistry &registry  = priv::GlobalContext().ipcRegistry();
+    std::byte         *allocBase = registry.openMem(handle);
+    try
+    {
+        return fn(allocBase);
+    }
+    catch (...)
+    {
+        registry.closeMem(allocBase);
+        throw;
+    }
+}
+
+// Cleanup of imported objects, ctx is the start of their allocation.
+template<class DATA>
+void CloseIpcMem(void *ctx, const DATA *)
+{
+    priv::GlobalContext().ipcRegistry().closeMem(static_cast<std::byte *>(ctx));
+}
+
+} // namespace
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorExportIpc,
+                (NVCVTensorHandle handle, CUstream stream, NVCVTensorIpcHandle *ipc))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (ipc == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output IPC handle must not be NULL");
+            }
+
+            NVCVTensorData data;
+            priv::ToStaticRef<priv::ITensor>(handle).exportData(data);
+
+            if (data.bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Only strided cuda tensors can be exported");
+            }
+
+            priv::IpcRegistry &registry = priv::GlobalContext().ipcRegistry();
+
+            std::byte         *allocBase;
+            cudaIpcMemHandle_t memHandle = registry.exportMem(data.buffer.strided.basePtr, allocBase);
+
+            cudaIpcEventHandle_t eventHandle = registry.recordEvent(stream);
+
+            std::memcpy(ipc->memHandle, &memHandle, sizeof(memHandle));
+            std::memcpy(ipc->eventHandle, &eventHandle, sizeof(eventHandle));
+            ipc->offset = reinterpret_cast<std::byte *>(data.buffer.strided.basePtr) - allocBase;
+
+            ipc->data                        = data;
+            ipc->data.buffer.strided.basePtr = nullptr;
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorImportIpc,
+                (const NVCVTensorIpcHandle *ipc, CUstream stream, NVCVTensorHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (ipc == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to IPC handle must not be NULL");
+            }
+
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            if (ipc->data.bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA || ipc->offset < 0)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "IPC handle doesn't describe an exported tensor");
+            }
+
+            *handle = ImportIpcMem(ipc->memHandle,
+                                   [&](std::byte *allocBase)
+                                   {
+                                       WaitIpcEvent(ipc->eventHandle, stream);
+
+                                       NVCVTensorData data = ipc->data;
+                                       data.buffer.strided.basePtr
+                                           = reinterpret_cast<NVCVByte *>(allocBase + ipc->offset);
+
+                                       return priv::CreateCoreObject<priv::TensorWrapDataStrided>(
+                                           data, &CloseIpcMem<NVCVTensorData>, allocBase);
+                                   });
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageExportIpc,
+                (NVCVImageHandle handle, CUstream stream, NVCVImageIpcHandle *ipc))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (ipc == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output IPC handle must not be NULL");
+            }
+
+            NVCVImageData data;
+            priv::ToStaticRef<priv::IImage>(handle).exportData(data);
+
+            if (data.bufferType != NVCV_IMAGE_BUFFER_STRIDED_CUDA)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Only strided cuda images can be exported");
+            }
+
+            NVCVImageBufferStrided &buffer = data.buffer.strided;
+
+            priv::IpcRegistry &registry = priv::GlobalContext().ipcRegistry();
+
+            std::byte         *allocBase = nullptr;
+            cudaIpcMemHandle_t memHandle;
+            for (int p = 0; p < buffer.numPlanes; ++p)
+            {
+                std::byte *planeAllocBase;
+                memHandle = registry.exportMem(buffer.planes[p].basePtr, planeAllocBase);
+
+                if (p > 0 && planeAllocBase != allocBase)
+                {
+                    throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                                          "All image planes must be in the same allocation to be exported");
+                }
+                allocBase = planeAllocBase;
+
+                ipc->planeOffset[p]      = reinterpret_cast<std::byte *>(buffer.planes[p].basePtr) - allocBase;
+                buffer.planes[p].basePtr = nullptr;
+            }
+
+            if (allocBase == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Image must have at least one plane");
+            }
+
+            cudaIpcEventHandle_t eventHandle = registry.recordEvent(stream);
+
+            std::memcpy(ipc->memHandle, &memHandle, sizeof(memHandle));
+            std::memcpy(ipc->eventHandle, &eventHandle, sizeof(eventHandle));
+            ipc->data = data;
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageImportIpc,
+                (const NVCVImageIpcHandle *ipc, CUstream stream, NVCVImageHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (ipc == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to IPC handle must not be NULL");
+            }
+
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            const NVCVImageBufferStrided &buffer = ipc->data.buffer.strided;
+
+            if (ipc->data.bufferType != NVCV_IMAGE_BUFFER_STRIDED_CUDA || buffer.numPlanes < 1
+                || buffer.numPlanes > NVCV_MAX_PLANE_COUNT)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "IPC handle doesn't describe an exported image");
+            }
+
+            for (int p = 0; p < buffer.numPlanes; ++p)
+            {
+                if (ipc->planeOffset[p] < 0)
+                {
+                    throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                                          "IPC handle doesn't describe an exported image");
+                }
+            }
+
+            *handle = ImportIpcMem(ipc->memHandle,
+                                   [&](std::byte *allocBase)
+                                   {
+                                       WaitIpcEvent(ipc->eventHandle, stream);
+
+                                       NVCVImageData data = ipc->data;
+                                       for (int p = 0; p < buffer.numPlanes; ++p)
+                                       {
+                                           data.buffer.strided.planes[p].basePtr
+                                               = reinterpret_cast<NVCVByte *>(allocBase + ipc->planeOffset[p]);
+                                       }
+
+                                       return priv::CreateCoreObject<priv::ImageWrapData>(
+                                           data, &CloseIpcMem<NVCVImageData>, allocBase);
+                                   });
+        });
+}
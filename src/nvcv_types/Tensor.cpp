@@ -20,6 +20,7 @@
 #include "priv/AllocatorManager.hpp"
 #include "priv/DataType.hpp"
 #include "priv/Exception.hpp"
+#include "priv/GrowableTensor.hpp"
 #include "priv/IAllocator.hpp"
 #include "priv/IImage.hpp"
 #include "priv/ImageFormat.hpp"
@@ -95,6 +96,63 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorConstruct,
         });
 }
 
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorConstructGrowable,
+                (const NVCVTensorRequirements *reqs, int64_t maxOuterSize, NVCVTensorHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (reqs == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to tensor requirements must not be NULL");
+            }
+
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            *handle = priv::CreateCoreObject<priv::GrowableTensor>(*reqs, maxOuterSize);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorSetOuterSize, (NVCVTensorHandle handle, int64_t outerSize))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            auto *tensor = dynamic_cast<priv::GrowableTensor *>(&priv::ToStaticRef<priv::ITensor>(handle));
+            if (tensor == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Tensor must be a growable tensor");
+            }
+
+            tensor->setOuterSize(outerSize);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorGetMaxOuterSize, (NVCVTensorHandle handle, int64_t *maxOuterSize))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (maxOuterSize == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output must not be NULL");
+            }
+
+            auto &tensor = priv::ToStaticRef<priv::ITensor>(handle);
+            if (auto *growable = dynamic_cast<priv::GrowableTensor *>(&tensor))
+            {
+                *maxOuterSize = growable->maxOuterSize();
+            }
+            else
+            {
+                *maxOuterSize = tensor.shape()[0];
+            }
+        });
+}
+
 NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorWrapDataConstruct,
                 (const NVCVTensorData *data, NVCVTensorDataCleanupFunc cleanup, void *ctxCleanup,
                  NVCVTensorHandle *handle))
@@ -115,6 +173,7 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorWrapDataConstruct,
             switch (data->bufferType)
             {
             case NVCV_TENSOR_BUFFER_STRIDED_CUDA:
+            case NVCV_TENSOR_BUFFER_STRIDED_HOST:
                 *handle = priv::CreateCoreObject<priv::TensorWrapDataStrided>(*data, cleanup, ctxCleanup);
                 break;
 
@@ -148,6 +207,71 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorWrapImageConstruct, (NVCVImageHandle
         });
 }
 
+static void ReleaseParentTensor(void *ctx, const NVCVTensorData *)
+{
+    nvcvTensorDecRef(static_cast<NVCVTensorHandle>(ctx), nullptr);
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorSlice,
+                (NVCVTensorHandle hparent, int32_t dim, int64_t begin, int64_t end, NVCVTensorHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (hparent == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Parent tensor handle must not be NULL");
+            }
+
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            auto &parent = priv::ToStaticRef<priv::ITensor>(hparent);
+
+            NVCVTensorData tensorData;
+            parent.exportData(tensorData);
+
+            if (tensorData.bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                                      "Only cuda-accessible strided tensors can be sliced");
+            }
+
+            if (dim < 0 || dim >= tensorData.rank)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Dimension to slice must be in [0, %d), not %d",
+                                      tensorData.rank, dim);
+            }
+
+            if (begin < 0 || end > tensorData.shape[dim] || begin >= end)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT)
+                    << "Slice range [" << begin << ", " << end << ") must be a non-empty range inside [0, "
+                    << tensorData.shape[dim] << ")";
+            }
+
+            NVCVTensorBufferStrided &buffer = tensorData.buffer.strided;
+
+            tensorData.shape[dim] = end - begin;
+            buffer.basePtr += begin * buffer.strides[dim];
+
+            // the view owns a reference to the parent, released by the cleanup function
+            priv::CoreObjectIncRef(hparent);
+            try
+            {
+                *handle = priv::CreateCoreObject<priv::TensorWrapDataStrided>(tensorData, &ReleaseParentTensor,
+                                                                              hparent);
+            }
+            catch (...)
+            {
+                priv::CoreObjectDecRef(hparent);
+                throw;
+            }
+        });
+}
+
 NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorDecRef, (NVCVTensorHandle handle, int *newRefCount))
 {
     return priv::ProtectCall(
@@ -207,6 +331,22 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorGetAllocator, (NVCVTensorHandle hand
         });
 }
 
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorGetDevice, (NVCVTensorHandle handle, int32_t *device))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (device == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output device cannot be NULL");
+            }
+
+            auto &tensor = priv::ToStaticRef<const priv::ITensor>(handle);
+
+            *device = tensor.device();
+        });
+}
+
 NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorExportData, (NVCVTensorHandle handle, NVCVTensorData *data))
 {
     return priv::ProtectCall(
@@ -309,3 +449,13 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorGetUserPointer, (NVCVTensorHandle ha
             }
         });
 }
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorSetReleaseStream, (NVCVTensorHandle handle, CUstream stream))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            auto &tensor = priv::ToStaticRef<priv::ITensor>(handle);
+            tensor.setReleaseStream(stream);
+        });
+}
@@ -0,0 +1,435 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/DataType.hpp"
+#include "priv/Exception.hpp"
+#include "priv/StagingRing.hpp"
+#include "priv/Status.hpp"
+#include "priv/SymbolVersioning.hpp"
+#include "priv/TensorManager.hpp"
+
+#include <cuda_runtime.h>
+#include <fcntl.h>
+#include <nvcv/Transfer.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <util/CheckError.hpp>
+
+#ifdef NVCV_ENABLE_GDS
+#    include <cufile.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace priv = nvcv::priv;
+
+namespace {
+
+// Tensor memory seen as rows of rowBytes, rowStride apart.
+struct TensorRows
+{
+    std::byte *basePtr;
+    int64_t    rowBytes, rowStride, numRows;
+};
+
+TensorRows GetTensorRows(NVCVTensorHandle handle)
+{
+    NVCVTensorData data;
+    priv::ToStaticRef<priv::ITensor>(handle).exportData(data);
+
+    if (data.bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA)
+    {
+        throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Only cuda-accessible strided tensors can be transferred");
+    }
+
+    const int      rank    = data.rank;
+    const int64_t *shape   = data.shape;
+    const int64_t *strides = data.buffer.strided.strides;
+
+    if (strides[rank - 1] != priv::DataType{data.dtype}.strideBytes())
+    {
+        throw priv::Exception(NVCV_ERROR_NOT_IMPLEMENTED, "Tensor elements must be packed in memory");
+    }
+
+    // Dimensions [first, rank) are packed, they form the rows.
+    int first = rank - 1;
+    while (first > 0 && strides[first - 1] == strides[first] * shape[first])
+    {
+        --first;
+    }
+
+    TensorRows rows;
+    rows.basePtr   = reinterpret_cast<std::byte *>(data.buffer.strided.basePtr);
+    rows.rowBytes  = strides[first] * shape[first];
+    rows.rowStride = first > 0 ? strides[first - 1] : rows.rowBytes;
+    rows.numRows   = 1;
+
+    for (int d = first - 1; d >= 0; --d)
+    {
+        // Only the rows can be padded, the outer dimensions must be packed wrt. them.
+        if (d < first - 1 && strides[d] != strides[d + 1] * shape[d + 1])
+        {
+            throw priv::Exception(NVCV_ERROR_NOT_IMPLEMENTED, "Only tensors with padded rows can be transferred");
+        }
+        rows.numRows *= shape[d];
+    }
+
+    return rows;
+}
+
+TensorRows GetTensorRows(NVCVTensorHandle handle, int64_t hostSizeBytes)
+{
+    TensorRows rows = GetTensorRows(handle);
+
+    if (rows.rowBytes * rows.numRows != hostSizeBytes)
+    {
+        throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT)
+            << "Host buffer size must be " << rows.rowBytes * rows.numRows << " bytes, not " << hostSizeBytes;
+    }
+
+    return rows;
+}
+
+// File descriptor, closed when going out of scope.
+class File
+{
+public:
+    File(const char *path, int flags, mode_t mode = 0)
+        : m_fd(open(path, flags, mode))
+    {
+    }
+
+    ~File()
+    {
+        if (m_fd >= 0)
+        {
+            close(m_fd);
+        }
+    }
+
+    File(const File &) = delete;
+
+    int fd() const
+    {
+        return m_fd;
+    }
+
+private:
+    int m_fd;
+};
+
+// Mapping of the first size bytes of a file, unmapped when going out of scope.
+class FileMapping
+{
+public:
+    FileMapping(const File &file, int64_t size, int prot)
+        : m_size(size)
+    {
+        void *ptr = mmap(nullptr, size, prot, MAP_SHARED, file.fd(), 0);
+        if (ptr == MAP_FAILED)
+        {
+            throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Couldn't map tensor file: %s", strerror(errno));
+        }
+        m_data = static_cast<std::byte *>(ptr);
+    }
+
+    ~FileMapping()
+    {
+        munmap(m_data, m_size);
+    }
+
+    FileMapping(const FileMapping &) = delete;
+
+    std::byte *data() const
+    {
+        return m_data;
+    }
+
+private:
+    std::byte *m_data;
+    int64_t    m_size;
+};
+
+NVCVTensorFileHeader ReadTensorFileHeader(const File &file, const char *path)
+{
+    if (file.fd() < 0)
+    {
+        throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Couldn't open tensor file %s: %s", path, strerror(errno));
+    }
+
+    NVCVTensorFileHeader header;
+    struct stat          st;
+    if (pread(file.fd(), &header, sizeof(header), 0) != sizeof(header) || fstat(file.fd(), &st) != 0
+        || std::strncmp(header.magic, NVCV_TENSOR_FILE_MAGIC, sizeof(header.magic)) != 0)
+    {
+        throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "%s isn't a tensor file", path);
+    }
+
+    if (header.version != NVCV_TENSOR_FILE_VERSION)
+    {
+        throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Tensor file %s has unsupported version %d", path,
+                              header.version);
+    }
+
+    bool valid = header.rank >= 1 && header.rank <= NVCV_TENSOR_MAX_RANK
+              && header.payloadOffset >= static_cast<int64_t>(sizeof(header))
+              && header.payloadOffset % NVCV_TENSOR_FILE_ALIGNMENT == 0
+              && header.payloadOffset + header.payloadSize <= st.st_size;
+
+    if (valid)
+    {
+        int64_t size = priv::DataType{header.dtype}.strideBytes();
+        for (int i = 0; i < header.rank; ++i)
+        {
+            size *= header.shape[i];
+        }
+        valid = size == header.payloadSize;
+    }
+
+    if (!valid)
+    {
+        throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Tensor file %s is corrupted", path);
+    }
+
+    return header;
+}
+
+#ifdef NVCV_ENABLE_GDS
+// Reads the payload straight into device memory. Returns false if GPUDirect
+// Storage can't be used for the file, e.g. its filesystem isn't supported.
+bool LoadTensorFileGds(const char *path, const NVCVTensorFileHeader &header, std::byte *dst, cudaStream_t stream)
+{
+    static const bool driverOpen = cuFileDriverOpen().err == CU_FILE_SUCCESS;
+    if (!driverOpen)
+    {
+        return false;
+    }
+
+    File file(path, O_RDONLY | O_DIRECT);
+    if (file.fd() < 0)
+    {
+        return false;
+    }
+
+    CUfileDescr_t descr = {};
+    descr.handle.fd     = file.fd();
+    descr.type          = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+
+    CUfileHandle_t handle;
+    if (cuFileHandleRegister(&handle, &descr).err != CU_FILE_SUCCESS)
+    {
+        return false;
+    }
+
+    // cuFileRead isn't ordered on the stream, pending work might still use the tensor
+    cudaError_t err = cudaStreamSynchronize(stream);
+
+    ssize_t numRead = -1;
+    if (err == cudaSuccess)
+    {
+        numRead = cuFileRead(handle, dst, header.payloadSize, header.payloadOffset, 0);
+    }
+    cuFileHandleDeregister(handle);
+
+    NVCV_CHECK_THROW(err);
+    return numRead == header.payloadSize;
+}
+#endif
+
+} // namespace
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorUpload,
+                (NVCVTensorHandle handle, const void *src, int64_t sizeBytes, CUstream stream))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (src == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to host buffer must not be NULL");
+            }
+
+            TensorRows rows = GetTensorRows(handle, sizeBytes);
+
+            priv::GlobalContext().stagingRing().upload(rows.basePtr, rows.rowStride,
+                                                       static_cast<const std::byte *>(src), rows.rowBytes,
+                                                       rows.numRows, stream);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorDownload,
+                (NVCVTensorHandle handle, void *dst, int64_t sizeBytes, CUstream stream))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (dst == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to host buffer must not be NULL");
+            }
+
+            TensorRows rows = GetTensorRows(handle, sizeBytes);
+
+            priv::GlobalContext().stagingRing().download(static_cast<std::byte *>(dst), rows.basePtr,
+                                                         rows.rowStride, rows.rowBytes, rows.numRows, stream);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorPrefetch, (NVCVTensorHandle handle, int32_t device, CUstream stream))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            NVCVTensorData data;
+            priv::ToStaticRef<priv::ITensor>(handle).exportData(data);
+
+            if (data.bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Only strided tensors can be prefetched");
+            }
+
+            int numDevices;
+            NVCV_CHECK_THROW(cudaGetDeviceCount(&numDevices));
+            if (device != NVCV_PREFETCH_TO_HOST && (device < 0 || device >= numDevices))
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Invalid device id %d", device);
+            }
+
+            void *ptr = data.buffer.strided.basePtr;
+
+            cudaPointerAttributes attrs = {};
+            NVCV_CHECK_THROW(cudaPointerGetAttributes(&attrs, ptr));
+            if (attrs.type != cudaMemoryTypeManaged)
+            {
+                return;
+            }
+
+            int64_t sizeBytes = data.buffer.strided.strides[0] * data.shape[0];
+            int     dstDevice = device == NVCV_PREFETCH_TO_HOST ? cudaCpuDeviceId : device;
+            NVCV_CHECK_THROW(cudaMemPrefetchAsync(ptr, sizeBytes, dstDevice, stream));
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorSaveFile, (NVCVTensorHandle handle, const char *path, CUstream stream))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (path == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to file path must not be NULL");
+            }
+
+            TensorRows rows = GetTensorRows(handle);
+
+            NVCVTensorData data;
+            priv::ToStaticRef<priv::ITensor>(handle).exportData(data);
+
+            static_assert(sizeof(NVCVTensorFileHeader) <= NVCV_TENSOR_FILE_ALIGNMENT);
+
+            NVCVTensorFileHeader header = {};
+            std::strncpy(header.magic, NVCV_TENSOR_FILE_MAGIC, sizeof(header.magic));
+            header.version = NVCV_TENSOR_FILE_VERSION;
+            header.rank    = data.rank;
+            header.layout  = data.layout;
+            header.dtype   = data.dtype;
+            std::copy(data.shape, data.shape + data.rank, header.shape);
+            header.payloadOffset = NVCV_TENSOR_FILE_ALIGNMENT;
+            header.payloadSize   = rows.rowBytes * rows.numRows;
+
+            const int64_t fileSize = header.payloadOffset + header.payloadSize;
+
+            File file(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+            if (file.fd() < 0 || ftruncate(file.fd(), fileSize) != 0)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Couldn't write tensor file %s: %s", path,
+                                      strerror(errno));
+            }
+
+            // The tensor is copied straight into the file pages
+            FileMapping mapping(file, fileSize, PROT_READ | PROT_WRITE);
+            std::memcpy(mapping.data(), &header, sizeof(header));
+
+            priv::GlobalContext().stagingRing().download(mapping.data() + header.payloadOffset, rows.basePtr,
+                                                         rows.rowStride, rows.rowBytes, rows.numRows, stream);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorFileReadHeader, (const char *path, NVCVTensorFileHeader *header))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (path == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to file path must not be NULL");
+            }
+
+            if (header == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output header must not be NULL");
+            }
+
+            *header = ReadTensorFileHeader(File(path, O_RDONLY), path);
+        });
+}
+
+NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorLoadFile, (const char *path, NVCVTensorHandle handle, CUstream stream))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (path == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to file path must not be NULL");
+            }
+
+            File                 file(path, O_RDONLY);
+            NVCVTensorFileHeader header = ReadTensorFileHeader(file, path);
+
+            NVCVTensorData data;
+            priv::ToStaticRef<priv::ITensor>(handle).exportData(data);
+
+            if (data.dtype != header.dtype || data.rank != header.rank
+                || !std::equal(data.shape, data.shape + data.rank, header.shape))
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                                      "Tensor shape and data type must match the ones of tensor file %s", path);
+            }
+
+            TensorRows rows = GetTensorRows(handle, header.payloadSize);
+
+#ifdef NVCV_ENABLE_GDS
+            // Only a packed tensor can be read in one go
+            if ((rows.rowStride == rows.rowBytes || rows.numRows == 1)
+                && LoadTensorFileGds(path, header, rows.basePtr, stream))
+            {
+                return;
+            }
+#endif
+
+            FileMapping mapping(file, header.payloadOffset + header.payloadSize, PROT_READ);
+            madvise(mapping.data(), header.payloadOffset + header.payloadSize, MADV_SEQUENTIAL);
+
+            priv::GlobalContext().stagingRing().upload(rows.basePtr, rows.rowStride,
+                                                       mapping.data() + header.payloadOffset, rows.rowBytes,
+                                                       rows.numRows, stream);
+        });
+}
@@ -90,6 +90,7 @@ typedef enum
     NVCV_COLOR_XFER_BT709,     /**< Color transfer function specified by ITU-R BT.709 standard. */
     NVCV_COLOR_XFER_BT2020,    /**< Color transfer function specified by ITU-R BT.2020 standard. */
     NVCV_COLOR_XFER_SMPTE240M, /**< Color transfer function specified by SMPTE 240M standard. */
+    NVCV_COLOR_XFER_HLG,       /**< Hybrid log-gamma color transfer function, as in ITU-R BT.2100. */
 } NVCVColorTransferFunction;
 
 /** Defines the color range of a particular \ref NVCVColorSpec. */
@@ -162,6 +163,12 @@ typedef enum
     /** Color spec defining ITU-R BT.2020 standard, full range and perceptual quantizer transfer function. */
     NVCV_COLOR_SPEC_BT2020_PQ_ER     = NVCV_DETAIL_MAKE_CSPC(SPACE_BT2020, ENC_BT2020,    XFER_PQ,        RANGE_FULL,    LOC_EVEN,   LOC_EVEN),
 
+    /** Color spec defining ITU-R BT.2020 standard, limited range and hybrid log-gamma transfer function. */
+    NVCV_COLOR_SPEC_BT2020_HLG       = NVCV_DETAIL_MAKE_CSPC(SPACE_BT2020, ENC_BT2020,    XFER_HLG,       RANGE_LIMITED, LOC_EVEN,   LOC_EVEN),
+
+    /** Color spec defining ITU-R BT.2020 standard, full range and hybrid log-gamma transfer function. */
+    NVCV_COLOR_SPEC_BT2020_HLG_ER    = NVCV_DETAIL_MAKE_CSPC(SPACE_BT2020, ENC_BT2020,    XFER_HLG,       RANGE_FULL,    LOC_EVEN,   LOC_EVEN),
+
     /** Color spec defining ITU-R BT.2020 standard for constant luminance, limited range. */
     NVCV_COLOR_SPEC_BT2020c          = NVCV_DETAIL_MAKE_CSPC(SPACE_BT2020, ENC_BT2020c,   XFER_BT2020,    RANGE_LIMITED, LOC_EVEN,   LOC_EVEN),
 
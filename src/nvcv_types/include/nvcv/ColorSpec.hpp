@@ -75,6 +75,7 @@ enum class ColorTransferFunction : int8_t
     BT709     = NVCV_COLOR_XFER_BT709,
     BT2020    = NVCV_COLOR_XFER_BT2020,
     SMPTE240M = NVCV_COLOR_XFER_SMPTE240M,
+    HLG       = NVCV_COLOR_XFER_HLG,
 };
 
 enum class ColorRange : int8_t
@@ -167,6 +168,8 @@ constexpr ColorSpec CSPEC_BT2020_ER        = NVCV_COLOR_SPEC_BT2020_ER;
 constexpr ColorSpec CSPEC_BT2020_LINEAR    = NVCV_COLOR_SPEC_BT2020_LINEAR;
 constexpr ColorSpec CSPEC_BT2020_PQ        = NVCV_COLOR_SPEC_BT2020_PQ;
 constexpr ColorSpec CSPEC_BT2020_PQ_ER     = NVCV_COLOR_SPEC_BT2020_PQ_ER;
+constexpr ColorSpec CSPEC_BT2020_HLG       = NVCV_COLOR_SPEC_BT2020_HLG;
+constexpr ColorSpec CSPEC_BT2020_HLG_ER    = NVCV_COLOR_SPEC_BT2020_HLG_ER;
 constexpr ColorSpec CSPEC_BT2020c_ER       = NVCV_COLOR_SPEC_BT2020c_ER;
 constexpr ColorSpec CSPEC_MPEG2_BT601      = NVCV_COLOR_SPEC_MPEG2_BT601;
 constexpr ColorSpec CSPEC_MPEG2_BT709      = NVCV_COLOR_SPEC_MPEG2_BT709;
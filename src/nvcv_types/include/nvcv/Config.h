@@ -35,8 +35,8 @@ extern "C"
 /**
  * Set a hard limit on the number of image handles that can be created.
  *
- * The function will preallocate all resources necessary to satisfy creation
- * of a limited number of image handles in the future.
+ * Resources are still allocated on demand, in pools of increasing size, but
+ * creating more than maxCount live image handles will fail.
  *
  * @param[in] maxCount Maximum number of image handles that can be created.
  *                     If negative, switches to dynamic allocation, no hard limit is defined.
@@ -50,8 +50,8 @@ NVCV_PUBLIC NVCVStatus nvcvConfigSetMaxImageCount(int32_t maxCount);
 /**
  * Set a hard limit on the number of image batch handles that can be created.
  *
- * The function will preallocate all resources necessary to satisfy creation
- * of a limited number of image batch handles in the future.
+ * Resources are still allocated on demand, in pools of increasing size, but
+ * creating more than maxCount live image batch handles will fail.
  *
  * @param[in] maxCount Maximum number of image batch handles that can be created.
  *                     If negative, switches to dynamic allocation, no hard limit is defined.
@@ -65,8 +65,8 @@ NVCV_PUBLIC NVCVStatus nvcvConfigSetMaxImageBatchCount(int32_t maxCount);
 /**
  * Set a hard limit on the number of tensor handles that can be created.
  *
- * The function will preallocate all resources necessary to satisfy creation
- * of a limited number of tensor handles in the future.
+ * Resources are still allocated on demand, in pools of increasing size, but
+ * creating more than maxCount live tensor handles will fail.
  *
  * @param[in] maxCount Maximum number of tensor handles that can be created.
  *                     If negative, switches to dynamic allocation, no hard limit is defined.
@@ -80,8 +80,8 @@ NVCV_PUBLIC NVCVStatus nvcvConfigSetMaxTensorCount(int32_t maxCount);
 /**
  * Set a hard limit on the number of allocator handles that can be created.
  *
- * The function will preallocate all resources necessary to satisfy creation
- * of a limited number of allocator handles in the future.
+ * Resources are still allocated on demand, in pools of increasing size, but
+ * creating more than maxCount live allocator handles will fail.
  *
  * @param[in] maxCount Maximum number of allocator handles that can be created.
  *                     If negative, switches to dynamic allocation, no hard limit is defined.
@@ -92,6 +92,78 @@ NVCV_PUBLIC NVCVStatus nvcvConfigSetMaxTensorCount(int32_t maxCount);
  */
 NVCV_PUBLIC NVCVStatus nvcvConfigSetMaxAllocatorCount(int32_t maxCount);
 
+/** Usage statistics of the handles of a given object type.
+ *
+ * Under dynamic allocation, each thread keeps a small cache of free handles
+ * and only goes to the shared free list to refill or drain it in batches.
+ * The event counters are updated at these points, they might not include the
+ * most recent handle operations of threads that are still running.
+ */
+typedef struct NVCVHandleStatsRec
+{
+    /** Number of handles allocated, either free or in use. */
+    int64_t capacity;
+
+    /** Number of handles in use. */
+    int64_t inUse;
+
+    /** Number of handle creations and destructions that only used the calling thread's cache. */
+    int64_t cacheHits;
+
+    /** Number of times a batch of free handles was taken from the shared free list. */
+    int64_t globalRefills;
+
+    /** Number of times a batch of free handles was given back to the shared free list. */
+    int64_t globalFlushes;
+
+    /** Number of failed updates of the shared free list due to concurrent access from other threads. */
+    int64_t contendedRetries;
+} NVCVHandleStats;
+
+/**
+ * Retrieves usage statistics of image handles.
+ *
+ * @param[out] stats Where the statistics will be written to.
+ *                   + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvConfigGetImageHandleStats(NVCVHandleStats *stats);
+
+/**
+ * Retrieves usage statistics of image batch handles.
+ *
+ * @param[out] stats Where the statistics will be written to.
+ *                   + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvConfigGetImageBatchHandleStats(NVCVHandleStats *stats);
+
+/**
+ * Retrieves usage statistics of tensor handles.
+ *
+ * @param[out] stats Where the statistics will be written to.
+ *                   + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvConfigGetTensorHandleStats(NVCVHandleStats *stats);
+
+/**
+ * Retrieves usage statistics of allocator handles.
+ *
+ * @param[out] stats Where the statistics will be written to.
+ *                   + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvConfigGetAllocatorHandleStats(NVCVHandleStats *stats);
+
 #ifdef __cplusplus
 }
 #endif
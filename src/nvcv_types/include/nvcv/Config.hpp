@@ -49,6 +49,34 @@ inline void SetMaxAllocatorCount(int32_t maxCount)
     detail::CheckThrow(nvcvConfigSetMaxAllocatorCount(maxCount));
 }
 
+inline NVCVHandleStats GetImageHandleStats()
+{
+    NVCVHandleStats stats;
+    detail::CheckThrow(nvcvConfigGetImageHandleStats(&stats));
+    return stats;
+}
+
+inline NVCVHandleStats GetImageBatchHandleStats()
+{
+    NVCVHandleStats stats;
+    detail::CheckThrow(nvcvConfigGetImageBatchHandleStats(&stats));
+    return stats;
+}
+
+inline NVCVHandleStats GetTensorHandleStats()
+{
+    NVCVHandleStats stats;
+    detail::CheckThrow(nvcvConfigGetTensorHandleStats(&stats));
+    return stats;
+}
+
+inline NVCVHandleStats GetAllocatorHandleStats()
+{
+    NVCVHandleStats stats;
+    detail::CheckThrow(nvcvConfigGetAllocatorHandleStats(&stats));
+    return stats;
+}
+
 }} // namespace nvcv::cfg
 
 #endif // NVCV_CONFIG_HPP
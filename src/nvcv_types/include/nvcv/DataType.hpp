@@ -26,6 +26,7 @@
 
 #include "DataLayout.hpp"
 #include "DataType.h"
+#include "detail/ImageFormatInfo.hpp"
 
 #include <iostream>
 
@@ -58,7 +59,7 @@ public:
 
     Packing                packing() const;
     std::array<int32_t, 4> bitsPerChannel() const;
-    DataKind               dataKind() const;
+    constexpr DataKind     dataKind() const;
     int32_t                numChannels() const;
     DataType               channelType(int32_t channel) const;
     int32_t                strideBytes() const;
@@ -116,6 +117,15 @@ constexpr DataType TYPE_3S16{NVCV_DATA_TYPE_3S16};
 /** Four interleaved channels of signed 16-bit values. */
 constexpr DataType TYPE_4S16{NVCV_DATA_TYPE_4S16};
 
+/** One channel of 16-bit IEEE 754 floating-point value. */
+constexpr DataType TYPE_F16{NVCV_DATA_TYPE_F16};
+/** Two interleaved channels of 16-bit IEEE 754 floating-point values. */
+constexpr DataType TYPE_2F16{NVCV_DATA_TYPE_2F16};
+/** Three interleaved channels of 16-bit IEEE 754 floating-point values. */
+constexpr DataType TYPE_3F16{NVCV_DATA_TYPE_3F16};
+/** Four interleaved channels of 16-bit IEEE 754 floating-point values. */
+constexpr DataType TYPE_4F16{NVCV_DATA_TYPE_4F16};
+
 /** One channel of unsigned 32-bit value. */
 constexpr DataType TYPE_U32{NVCV_DATA_TYPE_U32};
 /** Two interleaved channels of unsigned 32-bit values. */
@@ -222,11 +232,9 @@ inline std::array<int32_t, 4> DataType::bitsPerChannel() const
     return {bits[0], bits[1], bits[2], bits[3]};
 }
 
-inline DataKind DataType::dataKind() const
+constexpr DataKind DataType::dataKind() const
 {
-    NVCVDataKind out;
-    detail::CheckThrow(nvcvDataTypeGetDataKind(m_type, &out));
-    return static_cast<DataKind>(out);
+    return static_cast<DataKind>(detail::DecodeDataKind(m_type));
 }
 
 inline int32_t DataType::numChannels() const
@@ -28,6 +28,7 @@
 
 #include <cassert>
 #include <cstring>
+#include <type_traits>
 
 namespace nvcv {
 
@@ -156,13 +157,22 @@ inline void SetThreadError(std::exception_ptr e)
     }
 }
 
+// If fn returns a status, it's returned as is. It must have set the thread's
+// status by itself in case of error, no exception is involved.
 template<class F>
 NVCVStatus ProtectCall(F &&fn)
 {
     try
     {
-        fn();
-        return NVCV_SUCCESS;
+        if constexpr (std::is_same_v<std::invoke_result_t<F>, NVCVStatus>)
+        {
+            return fn();
+        }
+        else
+        {
+            fn();
+            return NVCV_SUCCESS;
+        }
     }
     catch (...)
     {
@@ -49,6 +49,8 @@ public:
     void  setUserPointer(void *ptr);
     void *userPointer() const;
 
+    void setReleaseStream(CUstream stream);
+
 protected:
     IImage();
 
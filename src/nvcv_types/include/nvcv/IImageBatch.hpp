@@ -20,6 +20,7 @@
 
 #include "Image.hpp"
 #include "ImageBatch.h"
+#include "ITensor.hpp"
 #include "ImageBatchData.hpp"
 #include "detail/Optional.hpp"
 
@@ -61,12 +62,18 @@ public:
     void pushBack(const IImage &img);
     void popBack(int32_t imgCount = 1);
 
+    // Only the replaced image is uploaded again on next exportData
+    void setImage(int32_t index, const IImage &img);
+
     // For any invocable functor with zero parameters
     template<class F, class = decltype(std::declval<F>()())>
     void pushBack(F &&cb);
 
     void clear();
 
+    // Images whose flag in mask is 0 aren't written by operators, nullptr if all are active
+    void setActiveMask(const ITensor *mask);
+
     Size2D      maxSize() const;
     ImageFormat uniqueFormat() const;
 
@@ -68,6 +68,8 @@ public:
 
     const NVCVImageBufferStrided *imageList() const;
 
+    const uint8_t *activeMask() const;
+
 protected:
     using IImageBatchVarShapeData::IImageBatchVarShapeData;
 };
@@ -45,15 +45,21 @@ public:
     DataType     dtype() const;
     TensorLayout layout() const;
 
+    // CUDA device the tensor memory is on, or -1 if it isn't on a device.
+    int32_t device() const;
+
     const ITensorData *exportData() const;
 
     void  setUserPointer(void *ptr);
     void *userPointer() const;
 
+    void setReleaseStream(CUstream stream);
+
 private:
     virtual NVCVTensorHandle doGetHandle() const = 0;
 
     mutable detail::Optional<TensorDataStridedCuda> m_cacheData;
+    mutable detail::Optional<TensorDataStridedHost> m_cacheDataHost;
 };
 
 } // namespace nvcv
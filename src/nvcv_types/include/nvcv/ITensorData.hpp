@@ -75,6 +75,15 @@ protected:
     using ITensorDataStrided::ITensorDataStrided;
 };
 
+class ITensorDataStridedHost : public ITensorDataStrided
+{
+public:
+    virtual ~ITensorDataStridedHost() = 0;
+
+protected:
+    using ITensorDataStrided::ITensorDataStrided;
+};
+
 } // namespace nvcv
 
 #include "detail/ITensorDataImpl.hpp"
@@ -27,6 +27,7 @@
 #include "Export.h"
 #include "Fwd.h"
 #include "ImageData.h"
+#include "Rect.h"
 #include "Status.h"
 #include "alloc/Allocator.h"
 #include "alloc/Requirements.h"
@@ -87,7 +88,8 @@ typedef struct NVCVImageRequirementsRec
  *                              If 0, use a default suitable for optimized memory access.
  *                              The used alignment is at least the given value.
  *                              Pass 1 for fully packed rows, i.e., no padding
- *                              at the end of each row.
+ *                              at the end of each row, or #NVCV_ROW_ALIGNMENT_PERFORMANCE
+ *                              for rows aligned to global memory segments.
  *                              + If different from 0, it must be a power-of-two.
  *
  * @param [out] reqs        Where the image requirements will be written to.
@@ -148,6 +150,30 @@ NVCV_PUBLIC NVCVStatus nvcvImageConstruct(const NVCVImageRequirements *reqs, NVC
 NVCV_PUBLIC NVCVStatus nvcvImageWrapDataConstruct(const NVCVImageData *data, NVCVImageDataCleanupFunc cleanup,
                                                   void *ctxCleanup, NVCVImageHandle *handle);
 
+/** Creates an image that is a view of a rectangular region of another image.
+ *
+ * The view aliases the parent's memory, with the same row strides and format, no data is copied.
+ * It holds a reference to the parent image, which is released when the view is destroyed, so the
+ * parent is kept alive for as long as the view exists.
+ *
+ * @param [in] parent Image whose region is viewed.
+ *                    + Must not be NULL.
+ *                    + Image contents must be cuda-accessible, pitch-linear.
+ *
+ * @param [in] roi Region of the parent image, in pixels of the first plane.
+ *                 + Must not be NULL.
+ *                 + Must be fully inside the parent image and not empty.
+ *                 + For subsampled planes, the region must be aligned to the subsampling factors.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the image.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvImageRoi(NVCVImageHandle parent, const NVCVRectI *roi, NVCVImageHandle *handle);
+
 /** Decrements the reference count of an existing image instance.
  *
  * The image is destroyed when its reference count reaches zero.
@@ -219,6 +245,27 @@ NVCV_PUBLIC NVCVStatus nvcvImageSetUserPointer(NVCVImageHandle handle, void *use
  */
 NVCV_PUBLIC NVCVStatus nvcvImageGetUserPointer(NVCVImageHandle handle, void **outUserPtr);
 
+/** Sets the stream the image memory is last used on.
+ *
+ * When the image is destroyed, its memory is given back to the allocator only after
+ * all work submitted to this stream up to then is done, without blocking the thread
+ * that destroys it. Pair it with a pool allocator to avoid the device synchronization
+ * that freeing cuda memory usually implies.
+ *
+ * If no stream is set, the image memory is freed right away, as before.
+ * It has no effect on images that don't own their memory, i.e. wrapping external data,
+ * set it on the object that owns it instead.
+ *
+ * @param [in] handle Image to be updated.
+ *
+ * @param [in] stream Stream the image memory is used on.
+ *                    + It must be valid until the image is destroyed.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvImageSetReleaseStream(NVCVImageHandle handle, CUstream stream);
+
 /** Returns the underlying image type.
  *
  * @param [in] handle Image to be queried.
@@ -71,6 +71,24 @@ private:
     std::function<ImageDataCleanupFunc> m_cleanup;
 };
 
+// ImageRoi definition -------------------------------------
+// Image that views a rectangular region of another image,
+// sharing its memory and keeping it alive.
+
+class ImageRoi : public IImage
+{
+public:
+    explicit ImageRoi(const IImage &parent, const NVCVRectI &roi);
+    ~ImageRoi();
+
+    ImageRoi(const ImageRoi &) = delete;
+
+private:
+    NVCVImageHandle doGetHandle() const final override;
+
+    NVCVImageHandle m_handle;
+};
+
 // For API backward-compatibility
 using ImageWrapHandle = detail::WrapHandle<IImage>;
 
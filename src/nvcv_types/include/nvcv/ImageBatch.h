@@ -49,6 +49,8 @@ typedef enum
     NVCV_TYPE_IMAGEBATCH_TENSOR,
     /** Image batch that wraps an user-allocated tensor buffer. */
     NVCV_TYPE_IMAGEBATCH_TENSOR_WRAPDATA,
+    /** Varshape image batch that wraps user-provided device image descriptors. */
+    NVCV_TYPE_IMAGEBATCH_VARSHAPE_WRAPDATA,
 } NVCVTypeImageBatch;
 
 typedef struct NVCVImageBatch *NVCVImageBatchHandle;
@@ -101,11 +103,71 @@ NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapeCalcRequirements(int32_t
 NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapeConstruct(const NVCVImageBatchVarShapeRequirements *reqs,
                                                        NVCVAllocatorHandle alloc, NVCVImageBatchHandle *handle);
 
+/** Creates a varshape image batch holding a contiguous range of the images of another batch.
+ *
+ * The new batch refers to the same images as the parent, no image data is copied. It holds a reference to
+ * the parent batch, which is released when the new batch is destroyed, so the parent is kept alive for as long
+ * as the new batch exists. Images later pushed to or popped from the parent don't affect the new batch.
+ *
+ * @param [in] parent Varshape image batch whose images are referred to.
+ *                    + Must not be NULL.
+ *                    + The handle must have been created with @ref nvcvImageBatchVarShapeConstruct.
+ *
+ * @param [in] begIndex Index of the first image of the range.
+ *                      + Must be >= 0.
+ *
+ * @param [in] numImages Number of images in the range.
+ *                       + Must be >= 1.
+ *                       + Must be begIndex+numImages <= number of images in the parent batch.
+ *
+ * @param [out] handle Where the image batch instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the image batch.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapeSubrange(NVCVImageBatchHandle parent, int32_t begIndex,
+                                                      int32_t numImages, NVCVImageBatchHandle *handle);
+
+/** Wraps image descriptors already in device memory into a varshape image batch.
+ *
+ * Useful when the descriptors are produced on the device, e.g. by a decoder,
+ * as no image objects are needed and nothing is uploaded when the batch is used.
+ * The batch contents can't be modified, functions that add, remove or get its
+ * images fail with @ref NVCV_ERROR_INVALID_OPERATION.
+ *
+ * @param [in] data Image batch contents.
+ *                  + Must not be NULL.
+ *                  + Buffer type must be @ref NVCV_IMAGE_BATCH_VARSHAPE_BUFFER_STRIDED_CUDA.
+ *                  + `imageList` and `formatList` must point to device memory with `numImages` elements
+ *                    that stay valid while the batch exists.
+ *                  + `hostFormatList` can be NULL only if `uniqueFormat` isn't @ref NVCV_IMAGE_FORMAT_NONE.
+ *                  + `maxWidth` and `maxHeight` must be the maximum image size, >= 1 if the batch isn't empty.
+ *
+ * @param [in] cleanup Cleanup function to be called when the image batch is destroyed
+ *                     via @ref nvcvImageBatchDecRef.
+ *                     If NULL, no cleanup function is defined.
+ *
+ * @param [in] ctxCleanup Pointer to be passed unchanged to the cleanup function, if defined.
+ *
+ * @param [out] handle Where the image batch instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the image batch.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapeWrapDataConstruct(const NVCVImageBatchData   *data,
+                                                               NVCVImageBatchDataCleanupFunc cleanup, void *ctxCleanup,
+                                                               NVCVImageBatchHandle *handle);
+
 /** Decrements the reference count of an existing image batch instance.
  *
  * The image batch is destroyed when its reference count reaches zero.
 
- * If the image has type @ref NVCV_TYPE_IMAGEBATCH_TENSOR_WRAPDATA and has a cleanup function defined,
+ * If the image has type @ref NVCV_TYPE_IMAGEBATCH_TENSOR_WRAPDATA or @ref NVCV_TYPE_IMAGEBATCH_VARSHAPE_WRAPDATA
+ * and has a cleanup function defined,
  * cleanup will be called.
  *
  * @note The image batch object must not be in use in current and future operations.
@@ -225,16 +287,24 @@ NVCV_PUBLIC NVCVStatus nvcvImageBatchGetNumImages(NVCVImageBatchHandle handle, i
 /**
  * Retrieve the image batch contents.
  *
+ * Changes made to the batch since the last export are uploaded to the device
+ * asynchronously in \p stream. No upload is done if the batch wasn't modified,
+ * and in this case the returned device buffers stay valid until the batch is
+ * changed again. This is what allows CUDA graphs that use the batch to be
+ * replayed, as long as the batch isn't modified between capture and replay.
+ *
  * @param[in] handle Image batch to be queried.
  *                   + Must not be NULL.
  *
  * @param[in] stream CUDA stream where the export operation will execute.
+ *                   + If batch was modified, it must not be capturing a CUDA graph.
  *
  * @param[out] data Where the image batch buffer information will be written to.
  *                  + Must not be NULL.
  *
- * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
- * @retval #NVCV_SUCCESS                Operation executed successfully.
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT  Some parameter is outside its valid range.
+ * @retval #NVCV_ERROR_INVALID_OPERATION Batch was modified and \p stream is being captured.
+ * @retval #NVCV_SUCCESS                 Operation executed successfully.
  */
 NVCV_PUBLIC NVCVStatus nvcvImageBatchExportData(NVCVImageBatchHandle handle, CUstream stream, NVCVImageBatchData *data);
 
@@ -337,6 +407,43 @@ typedef NVCVImageHandle (*NVCVPushImageFunc)(void *ctx);
 NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapePushImagesCallback(NVCVImageBatchHandle handle,
                                                                 NVCVPushImageFunc cbPushImage, void *ctxCallback);
 
+/**
+ * Creates images and pushes them to the end of the image batch.
+ *
+ * All image planes are placed in a single allocation made with the batch's
+ * allocator, each image aligned as if it were allocated by @ref nvcvImageConstruct
+ * with default alignments. It's much cheaper than creating and pushing each
+ * image separately.
+ *
+ * The images are owned by the batch and destroyed along with it, even if they
+ * were popped from it before. Their memory is given back once all of them are
+ * destroyed, so handles fetched with @ref nvcvImageBatchVarShapeGetImages also
+ * keep it alive.
+ *
+ * @param[in] handle Image batch to be manipulated
+ *                   + Must not be NULL.
+ *                   + The handle must have been created with @ref nvcvImageBatchVarShapeConstruct.
+ *
+ * @param[in] widths,heights Size of each image to be created.
+ *                           + Must not be NULL.
+ *                           + Must have numImages elements each.
+ *
+ * @param[in] numImages Number of images to be created.
+ *                      + Must be >= 1.
+ *                      + Must not make the number of images exceed the batch capacity.
+ *
+ * @param[in] format Format of all images.
+ *                   + Must indicate a pitch-linear memory layout.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_ERROR_OVERFLOW         Image batch capacity exceeded.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the images.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapeConstructImages(NVCVImageBatchHandle handle, const int32_t *widths,
+                                                             const int32_t *heights, int32_t numImages,
+                                                             NVCVImageFormat format);
+
 /**
  * Pop images from the end of the image batch.
  *
@@ -354,6 +461,31 @@ NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapePushImagesCallback(NVCVImageBatchHa
  */
 NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapePopImages(NVCVImageBatchHandle handle, int32_t numImages);
 
+/**
+ * Replaces one of the images of the varshape image batch.
+ *
+ * Only the descriptors of replaced images are uploaded to the device the next time the batch data is
+ * exported, along with the ones of images added since then.
+ *
+ * @param[in] handle Image batch to be manipulated
+ *                   + Must not be NULL.
+ *                   + The handle must have been created with @ref nvcvImageBatchVarShapeConstruct.
+ *
+ * @param[in] index Index of the image to be replaced.
+ *                  + Must be >= 0.
+ *                  + Must be < number of images in the batch.
+ *
+ * @param[in] image Image that replaces the current one.
+ *                  + Must not be NULL.
+ *                  + Image must have memory layout @ref NVCV_MEM_LAYOUT_PL and be gpu-accessible.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_ERROR_OVERFLOW         Index is past the end of the image batch.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapeSetImage(NVCVImageBatchHandle handle, int32_t index,
+                                                      NVCVImageHandle image);
+
 /**
  * Clear the contents of the varshape image batch.
  *
@@ -367,6 +499,33 @@ NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapePopImages(NVCVImageBatchHandle hand
  */
 NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapeClear(NVCVImageBatchHandle handle);
 
+/**
+ * Sets the flags telling which images of the varshape image batch are active.
+ *
+ * Operators writing to the batch skip the images whose flag is 0, the work of their kernels
+ * for these images ends as soon as it starts. This keeps the batch contents, and graphs
+ * captured with it, unchanged when only some of the images have new data, e.g. when some
+ * cameras of a multi-camera pipeline have no new frame. The flags are read by the device
+ * when the operators run, they can be updated between executions.
+ *
+ * Only the batches operators write to are masked, images of input batches are always read.
+ *
+ * @param[in] handle Image batch to be manipulated
+ *                   + Must not be NULL.
+ *                   + The handle must have been created with @ref nvcvImageBatchVarShapeConstruct
+ *                     or @ref nvcvImageBatchVarShapeSubrange.
+ *
+ * @param[in] mask Tensor with one flag per image, referenced by the batch until the mask is replaced.
+ *                 If NULL, all images are active.
+ *                 + Must be a packed rank-1 tensor of @ref NVCV_DATA_TYPE_U8 in cuda memory.
+ *                 + Must have at least as many elements as the batch capacity.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT  Some parameter is outside its valid range.
+ * @retval #NVCV_ERROR_INVALID_OPERATION The batch wraps device data, which carries its own mask.
+ * @retval #NVCV_SUCCESS                 Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapeSetActiveMask(NVCVImageBatchHandle handle, NVCVTensorHandle mask);
+
 /**
  * Retrieve the image handles from the varshape image batch.
  *
@@ -22,6 +22,9 @@
 #include "IImageBatch.hpp"
 #include "ImageBatchData.hpp"
 
+#include <functional>
+#include <vector>
+
 namespace nvcv {
 
 // ImageBatch varshape definition -------------------------------------
@@ -35,6 +38,9 @@ public:
     explicit ImageBatchVarShape(int32_t capacity, IAllocator *alloc = nullptr);
     ~ImageBatchVarShape();
 
+    // Appends new images, all of them in one allocation owned by the batch.
+    void constructImages(const std::vector<Size2D> &sizes, ImageFormat fmt);
+
     ImageBatchVarShape(const ImageBatchVarShape &) = delete;
 
 private:
@@ -43,6 +49,46 @@ private:
     NVCVImageBatchHandle m_handle;
 };
 
+// Varshape image batch with a range of the images of another batch,
+// sharing the same images and keeping the parent batch alive.
+class ImageBatchVarShapeSubrange : public IImageBatchVarShape
+{
+public:
+    explicit ImageBatchVarShapeSubrange(const IImageBatchVarShape &parent, int32_t begIndex, int32_t numImages);
+    ~ImageBatchVarShapeSubrange();
+
+    ImageBatchVarShapeSubrange(const ImageBatchVarShapeSubrange &) = delete;
+
+private:
+    NVCVImageBatchHandle doGetHandle() const final override;
+
+    NVCVImageBatchHandle m_handle;
+};
+
+// ImageBatchVarShapeWrapData definition -------------------------------------
+using ImageBatchDataCleanupFunc = void(const IImageBatchData &);
+
+// Varshape image batch over image descriptors that are already on the device.
+// Images can't be added to or removed from it.
+class ImageBatchVarShapeWrapData : public IImageBatchVarShape
+{
+public:
+    explicit ImageBatchVarShapeWrapData(const IImageBatchVarShapeDataStridedCuda &data,
+                                        std::function<ImageBatchDataCleanupFunc> cleanup = nullptr);
+    ~ImageBatchVarShapeWrapData();
+
+    ImageBatchVarShapeWrapData(const ImageBatchVarShapeWrapData &) = delete;
+
+private:
+    NVCVImageBatchHandle doGetHandle() const final override;
+
+    static void doCleanup(void *ctx, const NVCVImageBatchData *data);
+
+    NVCVImageBatchHandle m_handle;
+
+    std::function<ImageBatchDataCleanupFunc> m_cleanup;
+};
+
 // For API backward-compatibility
 using ImageBatchWrapHandle         = detail::WrapHandle<IImageBatch>;
 using ImageBatchVarShapeWrapHandle = detail::WrapHandle<IImageBatchVarShape>;
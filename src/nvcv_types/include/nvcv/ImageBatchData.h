@@ -47,6 +47,11 @@ typedef struct NVCVImageBatchVarShapeBufferStridedRec
      * plane P of image N can be indexed as imageList[N].planes[P].
      */
     NVCVImageBufferStrided *imageList;
+
+    /** Pointer to a device-side array of flags, one for each image in `imageList`.
+     * Operators don't write to the images whose flag is 0, see @ref nvcvImageBatchVarShapeSetActiveMask.
+     * NULL if all images are active. */
+    const uint8_t *activeMask;
 } NVCVImageBatchVarShapeBufferStrided;
 
 /** Stores the tensor plane contents. */
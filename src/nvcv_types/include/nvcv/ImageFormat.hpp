@@ -28,6 +28,7 @@
 #include "DataLayout.hpp"
 #include "DataType.hpp"
 #include "ImageFormat.h"
+#include "detail/ImageFormatInfo.hpp"
 
 #include <nvcv/Size.hpp>
 
@@ -91,11 +92,11 @@ public:
     constexpr bool operator==(ImageFormat that) const noexcept;
     constexpr bool operator!=(ImageFormat that) const noexcept;
 
-    ImageFormat dataKind(DataKind dataKind) const;
-    DataKind    dataKind() const noexcept;
+    ImageFormat        dataKind(DataKind dataKind) const;
+    constexpr DataKind dataKind() const noexcept;
 
-    ImageFormat memLayout(MemLayout newMemLayout) const;
-    MemLayout   memLayout() const noexcept;
+    ImageFormat         memLayout(MemLayout newMemLayout) const;
+    constexpr MemLayout memLayout() const noexcept;
 
     ImageFormat colorSpec(ColorSpec newColorSpec) const;
     ColorSpec   colorSpec() const noexcept;
@@ -106,7 +107,7 @@ public:
     ImageFormat rawPattern(RawPattern newRawPattern) const;
     RawPattern  rawPattern() const noexcept;
 
-    Swizzle                swizzle() const noexcept;
+    constexpr Swizzle      swizzle() const noexcept;
     ColorModel             colorModel() const noexcept;
     int32_t                numChannels() const noexcept;
     std::array<int32_t, 4> bitsPerChannel() const noexcept;
@@ -525,11 +526,9 @@ inline ImageFormat ImageFormat::dataKind(DataKind newDataKind) const
     return ImageFormat{out};
 }
 
-inline DataKind ImageFormat::dataKind() const noexcept
+constexpr DataKind ImageFormat::dataKind() const noexcept
 {
-    NVCVDataKind out;
-    detail::CheckThrow(nvcvImageFormatGetDataKind(m_format, &out));
-    return static_cast<DataKind>(out);
+    return static_cast<DataKind>(detail::DecodeDataKind(m_format));
 }
 
 inline ImageFormat ImageFormat::memLayout(MemLayout newMemLayout) const
@@ -539,11 +538,9 @@ inline ImageFormat ImageFormat::memLayout(MemLayout newMemLayout) const
     return ImageFormat{out};
 }
 
-inline MemLayout ImageFormat::memLayout() const noexcept
+constexpr MemLayout ImageFormat::memLayout() const noexcept
 {
-    NVCVMemLayout out;
-    detail::CheckThrow(nvcvImageFormatGetMemLayout(m_format, &out));
-    return static_cast<MemLayout>(out);
+    return static_cast<MemLayout>(detail::DecodeMemLayout(m_format));
 }
 
 inline ImageFormat ImageFormat::colorSpec(ColorSpec newColorSpec) const
@@ -588,11 +585,9 @@ inline RawPattern ImageFormat::rawPattern() const noexcept
     return static_cast<RawPattern>(out);
 }
 
-inline Swizzle ImageFormat::swizzle() const noexcept
+constexpr Swizzle ImageFormat::swizzle() const noexcept
 {
-    NVCVSwizzle out;
-    detail::CheckThrow(nvcvImageFormatGetSwizzle(m_format, &out));
-    return static_cast<Swizzle>(out);
+    return static_cast<Swizzle>(detail::DecodeSwizzle(m_format));
 }
 
 inline ColorModel ImageFormat::colorModel() const noexcept
@@ -604,9 +599,7 @@ inline ColorModel ImageFormat::colorModel() const noexcept
 
 inline int32_t ImageFormat::numChannels() const noexcept
 {
-    int32_t out;
-    detail::CheckThrow(nvcvImageFormatGetNumChannels(m_format, &out));
-    return out;
+    return detail::GetImageFormatInfo(m_format).numChannels;
 }
 
 inline std::array<int32_t, 4> ImageFormat::bitsPerChannel() const noexcept
@@ -625,9 +618,7 @@ inline uint32_t ImageFormat::fourCC() const
 
 inline int32_t ImageFormat::numPlanes() const noexcept
 {
-    int32_t out;
-    detail::CheckThrow(nvcvImageFormatGetNumPlanes(m_format, &out));
-    return out;
+    return detail::GetImageFormatInfo(m_format).numPlanes;
 }
 
 inline ImageFormat ImageFormat::swizzleAndPacking(Swizzle newSwizzle, Packing newPacking0, Packing newPacking1,
@@ -650,6 +641,11 @@ inline Packing ImageFormat::planePacking(int32_t plane) const noexcept
 
 inline DataType ImageFormat::planeDataType(int32_t plane) const noexcept
 {
+    if (0 <= plane && plane < 4)
+    {
+        return static_cast<DataType>(detail::GetImageFormatInfo(m_format).planeDataType[plane]);
+    }
+
     NVCVDataType out;
     detail::CheckThrow(nvcvImageFormatGetPlaneDataType(m_format, plane, &out));
     return static_cast<DataType>(out);
@@ -657,6 +653,11 @@ inline DataType ImageFormat::planeDataType(int32_t plane) const noexcept
 
 inline int32_t ImageFormat::planePixelStrideBytes(int32_t plane) const noexcept
 {
+    if (0 <= plane && plane < 4)
+    {
+        return detail::GetImageFormatInfo(m_format).planePixelStrideBytes[plane];
+    }
+
     int32_t out;
     detail::CheckThrow(nvcvImageFormatGetPlanePixelStrideBytes(m_format, plane, &out));
     return out;
@@ -664,6 +665,11 @@ inline int32_t ImageFormat::planePixelStrideBytes(int32_t plane) const noexcept
 
 inline int32_t ImageFormat::planeNumChannels(int32_t plane) const noexcept
 {
+    if (0 <= plane && plane < 4)
+    {
+        return detail::GetImageFormatInfo(m_format).planeNumChannels[plane];
+    }
+
     int32_t out;
     detail::CheckThrow(nvcvImageFormatGetPlaneNumChannels(m_format, plane, &out));
     return out;
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_IMAGEPOOL_HPP
+#define NVCV_IMAGEPOOL_HPP
+
+#include "Image.hpp"
+#include "alloc/CustomAllocator.hpp"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace nvcv {
+
+// ImagePool definition -------------------------------------
+// Hands out images whose buffers are kept once the images are destroyed,
+// to be reused by later images with the same format and size class.
+// Images are plain ImageWrapData, they can be added to any image batch.
+// They can outlive the pool, their buffers are freed when they're destroyed.
+// As with PoolAllocator, buffers are reused without waiting for pending device
+// work, images must be destroyed on the stream where they're used.
+
+class ImagePool
+{
+public:
+    explicit ImagePool(IAllocator *alloc = nullptr, const MemAlignment &bufAlign = {});
+    ~ImagePool();
+
+    ImagePool(const ImagePool &) = delete;
+
+    std::unique_ptr<ImageWrapData> acquire(const Size2D &size, ImageFormat fmt);
+
+    // Frees the buffers that aren't used by any image.
+    void trim();
+
+    int32_t numBuffers() const;     // buffers allocated, used or not
+    int32_t numFreeBuffers() const; // buffers waiting to be reused
+
+    // Images with sizes up to the size class share the same buffers.
+    static Size2D CalcSizeClass(const Size2D &size);
+
+private:
+    class Impl;
+    std::shared_ptr<Impl> m_impl;
+};
+
+} // namespace nvcv
+
+#include "detail/ImagePoolImpl.hpp"
+
+#endif // NVCV_IMAGEPOOL_HPP
@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Ipc.h
+ *
+ * @brief Public C interface to share NVCV tensors and images between processes.
+ *
+ * Exporting an object fills a plain struct that describes it, which can be
+ * sent as is to another process on the same machine, e.g. through a socket
+ * or shared memory. Importing it there creates an object that refers to the
+ * same device memory through CUDA IPC, without any copy.
+ *
+ * The struct also carries an interprocess event recorded on the stream
+ * passed when exporting, the importer's stream waits on it so that it sees
+ * the work that produced the object contents.
+ *
+ * Only memory allocated with cudaMalloc, as done by the default allocator,
+ * can be exported. The exporting process must keep the object alive, and not
+ * modify it, while it's used by importers. Memory can't be imported back in
+ * the process that exported it.
+ */
+
+#ifndef NVCV_IPC_H
+#define NVCV_IPC_H
+
+#include "Export.h"
+#include "Image.h"
+#include "Status.h"
+#include "Tensor.h"
+#include "detail/CudaFwd.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Size in bytes of the CUDA IPC handles, same as CUDA_IPC_HANDLE_SIZE. */
+#define NVCV_IPC_HANDLE_SIZE (64)
+
+/** Describes a tensor exported to other processes. */
+typedef struct NVCVTensorIpcHandleRec
+{
+    /** cudaIpcMemHandle_t of the allocation holding the tensor. */
+    char memHandle[NVCV_IPC_HANDLE_SIZE];
+
+    /** cudaIpcEventHandle_t of the event recorded when exporting. */
+    char eventHandle[NVCV_IPC_HANDLE_SIZE];
+
+    /** Offset in bytes of the tensor buffer from the allocation start. */
+    int64_t offset;
+
+    /** Tensor data, with a NULL base pointer. */
+    NVCVTensorData data;
+} NVCVTensorIpcHandle;
+
+/** Describes an image exported to other processes. */
+typedef struct NVCVImageIpcHandleRec
+{
+    /** cudaIpcMemHandle_t of the allocation holding the image planes. */
+    char memHandle[NVCV_IPC_HANDLE_SIZE];
+
+    /** cudaIpcEventHandle_t of the event recorded when exporting. */
+    char eventHandle[NVCV_IPC_HANDLE_SIZE];
+
+    /** Offset in bytes of each plane from the allocation start. */
+    int64_t planeOffset[NVCV_MAX_PLANE_COUNT];
+
+    /** Image data, with NULL plane base pointers. */
+    NVCVImageData data;
+} NVCVImageIpcHandle;
+
+/** Exports a tensor to other processes.
+ *
+ * @param [in] handle Tensor to be exported.
+ *                    + Must have strided cuda memory allocated with cudaMalloc.
+ *
+ * @param [in] stream Stream whose work submitted so far produces the tensor contents.
+ *
+ * @param [out] ipc   Where the tensor description will be written to.
+ *                    + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorExportIpc(NVCVTensorHandle handle, CUstream stream, NVCVTensorIpcHandle *ipc);
+
+/** Imports a tensor exported by another process.
+ *
+ * The created tensor refers to the exported memory, which stays mapped in
+ * this process until the tensor is destroyed. Tensors imported from the same
+ * allocation share its mapping.
+ *
+ * @param [in] ipc     Description of the tensor, as filled by @ref nvcvTensorExportIpc.
+ *                     + Must not be NULL.
+ *
+ * @param [in] stream  Stream that waits for the work the exporter submitted before exporting.
+ *
+ * @param [out] handle Where the tensor handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Memory couldn't be mapped, e.g. exporting process is gone.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorImportIpc(const NVCVTensorIpcHandle *ipc, CUstream stream,
+                                           NVCVTensorHandle *handle);
+
+/** Exports an image to other processes.
+ *
+ * @param [in] handle Image to be exported.
+ *                    + Must have strided cuda planes, all in the same allocation made with cudaMalloc.
+ *
+ * @param [in] stream Stream whose work submitted so far produces the image contents.
+ *
+ * @param [out] ipc   Where the image description will be written to.
+ *                    + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvImageExportIpc(NVCVImageHandle handle, CUstream stream, NVCVImageIpcHandle *ipc);
+
+/** Imports an image exported by another process.
+ *
+ * Same as @ref nvcvTensorImportIpc, for images.
+ *
+ * @param [in] ipc     Description of the image, as filled by @ref nvcvImageExportIpc.
+ *                     + Must not be NULL.
+ *
+ * @param [in] stream  Stream that waits for the work the exporter submitted before exporting.
+ *
+ * @param [out] handle Where the image handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Memory couldn't be mapped, e.g. exporting process is gone.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvImageImportIpc(const NVCVImageIpcHandle *ipc, CUstream stream, NVCVImageHandle *handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NVCV_IPC_H
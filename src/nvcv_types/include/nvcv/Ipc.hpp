@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Ipc.hpp
+ *
+ * @brief Public C++ interface to share NVCV tensors and images between processes.
+ */
+
+#ifndef NVCV_IPC_HPP
+#define NVCV_IPC_HPP
+
+#include "IImage.hpp"
+#include "ITensor.hpp"
+#include "Ipc.h"
+#include "detail/CheckError.hpp"
+
+namespace nvcv {
+
+// Exports the tensor to other processes, see nvcvTensorExportIpc.
+inline NVCVTensorIpcHandle ExportIpc(const ITensor &tensor, CUstream stream)
+{
+    NVCVTensorIpcHandle ipc;
+    detail::CheckThrow(nvcvTensorExportIpc(tensor.handle(), stream, &ipc));
+    return ipc;
+}
+
+// Exports the image to other processes, see nvcvImageExportIpc.
+inline NVCVImageIpcHandle ExportIpc(const IImage &img, CUstream stream)
+{
+    NVCVImageIpcHandle ipc;
+    detail::CheckThrow(nvcvImageExportIpc(img.handle(), stream, &ipc));
+    return ipc;
+}
+
+// TensorWrapIpc definition -------------------------------------
+// Tensor exported by another process, see nvcvTensorImportIpc.
+class TensorWrapIpc : public ITensor
+{
+public:
+    explicit TensorWrapIpc(const NVCVTensorIpcHandle &ipc, CUstream stream)
+    {
+        detail::CheckThrow(nvcvTensorImportIpc(&ipc, stream, &m_handle));
+        detail::SetObjectAssociation(nvcvTensorSetUserPointer, this, m_handle);
+    }
+
+    ~TensorWrapIpc()
+    {
+        nvcvTensorDecRef(m_handle, nullptr);
+    }
+
+    TensorWrapIpc(const TensorWrapIpc &) = delete;
+
+private:
+    NVCVTensorHandle doGetHandle() const final override
+    {
+        return m_handle;
+    }
+
+    NVCVTensorHandle m_handle;
+};
+
+// ImageWrapIpc definition -------------------------------------
+// Image exported by another process, see nvcvImageImportIpc.
+class ImageWrapIpc : public IImage
+{
+public:
+    explicit ImageWrapIpc(const NVCVImageIpcHandle &ipc, CUstream stream)
+    {
+        detail::CheckThrow(nvcvImageImportIpc(&ipc, stream, &m_handle));
+        detail::SetObjectAssociation(nvcvImageSetUserPointer, this, m_handle);
+    }
+
+    ~ImageWrapIpc()
+    {
+        nvcvImageDecRef(m_handle, nullptr);
+    }
+
+    ImageWrapIpc(const ImageWrapIpc &) = delete;
+
+private:
+    NVCVImageHandle doGetHandle() const final override
+    {
+        return m_handle;
+    }
+
+    NVCVImageHandle m_handle;
+};
+
+} // namespace nvcv
+
+#endif // NVCV_IPC_HPP
@@ -0,0 +1,77 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_PACKEDIMAGEBATCH_HPP
+#define NVCV_PACKEDIMAGEBATCH_HPP
+
+#include "Image.hpp"
+#include "ImageBatch.hpp"
+#include "alloc/CustomAllocator.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace nvcv {
+
+// PackedImageLayout definition -------------------------------------
+// Placement of the images of a varshape batch inside one buffer.
+// Image i starts at byte offsets[i], and its planes follow each other
+// as in an image allocated by cv-cuda, with the row strides in reqs[i].
+
+struct PackedImageLayout
+{
+    std::vector<Image::Requirements> reqs;
+    std::vector<int64_t>             offsets;
+
+    int64_t totalSizeBytes = 0; // multiple of alignBytes
+    int32_t alignBytes     = 1;
+};
+
+PackedImageLayout CalcPackedImageLayout(const std::vector<Size2D> &sizes, ImageFormat fmt,
+                                        const MemAlignment &bufAlign = {});
+
+// PackedImageBatchVarShape definition -------------------------------------
+// Varshape image batch whose images are all allocated inside a single
+// cuda buffer, instead of one allocation per image.
+
+class PackedImageBatchVarShape final : public ImageBatchVarShape
+{
+public:
+    explicit PackedImageBatchVarShape(const std::vector<Size2D> &sizes, ImageFormat fmt, IAllocator *alloc = nullptr,
+                                      const MemAlignment &bufAlign = {});
+    ~PackedImageBatchVarShape();
+
+    PackedImageBatchVarShape(const PackedImageBatchVarShape &) = delete;
+
+    const PackedImageLayout &layout() const noexcept;
+
+    // Beginning of the buffer, images are at layout().offsets from it.
+    void *buffer() const noexcept;
+
+private:
+    std::unique_ptr<IAllocator>                 m_defaultAlloc;
+    IAllocator                                 *m_alloc;
+    PackedImageLayout                           m_layout;
+    void                                       *m_buffer;
+    std::vector<std::unique_ptr<ImageWrapData>> m_images;
+};
+
+} // namespace nvcv
+
+#include "detail/PackedImageBatchImpl.hpp"
+
+#endif // NVCV_PACKEDIMAGEBATCH_HPP
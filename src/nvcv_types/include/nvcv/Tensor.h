@@ -93,6 +93,7 @@ typedef struct NVCVTensorRequirementsRec
  *                              If 0, use a default suitable for optimized memory access.
  *                              The used alignment is at least the given value.
  *                              Pass 1 for creation of fully packed tensors, i.e., no padding between dimensions.
+ *                              Pass #NVCV_ROW_ALIGNMENT_PERFORMANCE for rows aligned to global memory segments.
  *                              + If different from 0, it must be a power-of-two.
  *
  * @param [out] reqs  Where the tensor requirements will be written to.
@@ -127,6 +128,7 @@ NVCV_PUBLIC NVCVStatus nvcvTensorCalcRequirements(int32_t rank, const int64_t *s
  *                              If 0, use a default suitable for optimized memory access.
  *                              The used alignment is at least the given value.
  *                              Pass 1 for creation of fully packed tensors, i.e., no padding between dimensions.
+ *                              Pass #NVCV_ROW_ALIGNMENT_PERFORMANCE for rows aligned to global memory segments.
  *                              + If different from 0, it must be a power-of-two.
  *
  * @param [out] reqs  Where the tensor requirements will be written to.
@@ -160,6 +162,70 @@ NVCV_PUBLIC NVCVStatus nvcvTensorCalcRequirementsForImages(int32_t numImages, in
 NVCV_PUBLIC NVCVStatus nvcvTensorConstruct(const NVCVTensorRequirements *reqs, NVCVAllocatorHandle alloc,
                                            NVCVTensorHandle *handle);
 
+/** Constructs a tensor whose outermost dimension can grow and shrink in place.
+ *
+ * The address range of the tensor with an outermost dimension of maxOuterSize
+ * is reserved up front, and device memory is mapped on it with the cuda
+ * virtual memory management API as the tensor grows. The base pointer and
+ * strides never change and contents aren't copied, so e.g. the batch size of
+ * an NHWC tensor can follow each request of a dynamic batching server.
+ *
+ * Memory stays mapped when the tensor shrinks, until it's destroyed.
+ *
+ * @note Captured CUDA graphs keep referring to valid memory after a resize,
+ *       but they still process the shape the tensor had at capture.
+ *
+ * @param [in] reqs Tensor requirements with the initial shape, e.g. from
+ *                  @ref nvcvTensorCalcRequirements.
+ *                  + Must not be NULL.
+ *                  + Rank must be >= 1 and the outermost dimension must have the largest stride.
+ *
+ * @param [in] maxOuterSize Largest size the outermost dimension can grow to.
+ *                          + Must be >= reqs->shape[0].
+ *
+ * @param [out] handle Where the tensor instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_NOT_COMPATIBLE   Current device doesn't support virtual memory management.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the tensor.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorConstructGrowable(const NVCVTensorRequirements *reqs, int64_t maxOuterSize,
+                                                   NVCVTensorHandle *handle);
+
+/** Changes the size of the outermost dimension of a growable tensor in place.
+ *
+ * Contents of the samples that are kept are preserved. The tensor must not
+ * be in use by other threads, and operations already submitted keep using
+ * the shape that was exported to them.
+ *
+ * @param [in] handle Tensor to be resized.
+ *                    + Must have been created by @ref nvcvTensorConstructGrowable.
+ *
+ * @param [in] outerSize New size of the outermost dimension.
+ *                       + Must be >= 0 and <= the maximum outer size of the tensor.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough device memory to grow the tensor.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorSetOuterSize(NVCVTensorHandle handle, int64_t outerSize);
+
+/** Returns the largest size the outermost dimension of a tensor can have.
+ *
+ * @param [in] handle Tensor to be queried.
+ *                    + Must not be NULL.
+ *
+ * @param [out] maxOuterSize The maximum outer size of a growable tensor,
+ *                           the current one for other tensors.
+ *                           + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorGetMaxOuterSize(NVCVTensorHandle handle, int64_t *maxOuterSize);
+
 /** Wraps an existing tensor buffer into an NVCV tensor instance constructed in given storage
  *
  * It allows for interoperation of external tensor representations with NVCV.
@@ -216,6 +282,33 @@ NVCV_PUBLIC NVCVStatus nvcvTensorWrapDataConstruct(const NVCVTensorData *data, N
  */
 NVCV_PUBLIC NVCVStatus nvcvTensorWrapImageConstruct(NVCVImageHandle img, NVCVTensorHandle *handle);
 
+/** Creates a tensor that is a view of a range of indices of one dimension of another tensor.
+ *
+ * The view aliases the parent's memory, with same strides, data type and layout, no data is copied.
+ * It holds a reference to the parent tensor, which is released when the view is destroyed, so the
+ * parent is kept alive for as long as the view exists.
+ *
+ * @param [in] parent Tensor to be sliced.
+ *                    + Must not be NULL.
+ *                    + Tensor contents must be cuda-accessible, strided.
+ *
+ * @param [in] dim Dimension to be sliced.
+ *                 + Must be >= 0 and < rank of the parent tensor.
+ *                 + For channel-last layouts the channel dimension can't be sliced, as it must remain packed.
+ *
+ * @param [in] begin, end Range of indices [begin, end) of dimension dim in the view.
+ *                        + Must satisfy 0 <= begin < end <= size of dimension dim.
+ *
+ * @param [out] handle Where the tensor instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the tensor.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorSlice(NVCVTensorHandle parent, int32_t dim, int64_t begin, int64_t end,
+                                       NVCVTensorHandle *handle);
+
 /** Decrements the reference count of an existing tensor instance.
  *
  * The tensor is destroyed when its reference count reaches zero.
@@ -287,6 +380,27 @@ NVCV_PUBLIC NVCVStatus nvcvTensorSetUserPointer(NVCVTensorHandle handle, void *u
  */
 NVCV_PUBLIC NVCVStatus nvcvTensorGetUserPointer(NVCVTensorHandle handle, void **outUserPtr);
 
+/** Sets the stream the tensor memory is last used on.
+ *
+ * When the tensor is destroyed, its memory is given back to the allocator only after
+ * all work submitted to this stream up to then is done, without blocking the thread
+ * that destroys it. Pair it with a pool allocator to avoid the device synchronization
+ * that freeing cuda memory usually implies.
+ *
+ * If no stream is set, the tensor memory is freed right away, as before.
+ * It has no effect on tensors that don't own their memory, i.e. wrapping external data,
+ * set it on the object that owns it instead.
+ *
+ * @param [in] handle Tensor to be updated.
+ *
+ * @param [in] stream Stream the tensor memory is used on.
+ *                    + It must be valid until the tensor is destroyed.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorSetReleaseStream(NVCVTensorHandle handle, CUstream stream);
+
 /**
  * Get the type of the tensor elements (its data type).
  *
@@ -329,6 +443,24 @@ NVCV_PUBLIC NVCVStatus nvcvTensorGetLayout(NVCVTensorHandle handle, NVCVTensorLa
  */
 NVCV_PUBLIC NVCVStatus nvcvTensorGetAllocator(NVCVTensorHandle handle, NVCVAllocatorHandle *alloc);
 
+/**
+ * Get the CUDA device the tensor memory is on.
+ *
+ * Tensors allocated by the library are on the device their allocator is bound to,
+ * or else on the device that was current when they were created. For wrapped
+ * memory, the device is found out from the buffer pointer.
+ *
+ * @param[in] handle Tensor to be queried.
+ *                   + Must not be NULL.
+ *
+ * @param[out] device Where the device will be written to, or -1 if the memory isn't on a device.
+ *                    + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorGetDevice(NVCVTensorHandle handle, int32_t *device);
+
 /**
  * Retrieve the tensor contents.
  *
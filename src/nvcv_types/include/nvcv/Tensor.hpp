@@ -52,6 +52,28 @@ private:
     NVCVTensorHandle m_handle;
 };
 
+// GrowableTensor definition -------------------------------------
+// Tensor whose outermost dimension can change in place up to a maximum size,
+// without changing its memory address. See nvcvTensorConstructGrowable.
+class GrowableTensor : public ITensor
+{
+public:
+    explicit GrowableTensor(const Tensor::Requirements &reqs, int64_t maxOuterSize);
+    explicit GrowableTensor(const TensorShape &shape, DataType dtype, int64_t maxOuterSize,
+                            const MemAlignment &bufAlign = {});
+    ~GrowableTensor();
+
+    GrowableTensor(const GrowableTensor &) = delete;
+
+    void    setOuterSize(int64_t outerSize);
+    int64_t maxOuterSize() const;
+
+private:
+    NVCVTensorHandle doGetHandle() const final override;
+
+    NVCVTensorHandle m_handle;
+};
+
 // TensorWrapData definition -------------------------------------
 using TensorDataCleanupFunc = void(const ITensorData &);
 
@@ -88,6 +110,23 @@ private:
     NVCVTensorHandle m_handle;
 };
 
+// TensorSlice definition -------------------------------------
+// Tensor that views the range [begin, end) of one dimension of another tensor,
+// sharing its memory and keeping it alive.
+class TensorSlice : public ITensor
+{
+public:
+    explicit TensorSlice(const ITensor &parent, int32_t dim, int64_t begin, int64_t end);
+    ~TensorSlice();
+
+    TensorSlice(const TensorSlice &) = delete;
+
+private:
+    NVCVTensorHandle doGetHandle() const final override;
+
+    NVCVTensorHandle m_handle;
+};
+
 // For API backward-compatibility
 using TensorWrapHandle = detail::WrapHandle<ITensor>;
 
@@ -36,6 +36,17 @@ public:
     explicit TensorDataStridedCuda(const NVCVTensorData &data);
 };
 
+// TensorDataStridedHost definition -----------------------
+
+class TensorDataStridedHost : public ITensorDataStridedHost
+{
+public:
+    using Buffer = NVCVTensorBufferStrided;
+
+    explicit TensorDataStridedHost(const TensorShape &shape, const DataType &dtype, const Buffer &data);
+    explicit TensorDataStridedHost(const NVCVTensorData &data);
+};
+
 } // namespace nvcv
 
 #include "detail/TensorDataImpl.hpp"
@@ -0,0 +1,224 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Transfer.h
+ *
+ * @brief Public C interface to NVCV host-device transfers.
+ *
+ * Copies between pageable host memory and tensors are done through a ring of
+ * host-pinned staging buffers. The data is split in chunks: while one chunk is
+ * being copied by the CPU to or from a staging buffer, the previous one is
+ * transferred by the copy engine, so both proceed at full speed and the copy
+ * from device is truly asynchronous wrt. the stream.
+ *
+ * Tensors in unified memory don't need copies, but can be migrated ahead of
+ * their use with @ref nvcvTensorPrefetch.
+ *
+ * Tensors can also be saved to and loaded from files, e.g. to cache
+ * preprocessed datasets. When built with GPUDirect Storage support, loading
+ * DMAs the file contents straight into device memory, otherwise the file is
+ * memory-mapped and copied through the staging buffers.
+ */
+
+#ifndef NVCV_TRANSFER_H
+#define NVCV_TRANSFER_H
+
+#include "Export.h"
+#include "Status.h"
+#include "Tensor.h"
+#include "detail/CudaFwd.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Copies a packed host buffer into a tensor.
+ *
+ * The host buffer holds the tensor elements in row-major order without any
+ * padding, e.g. as in a C-contiguous numpy array of the same shape.
+ *
+ * The function returns once all data was copied out of the host buffer,
+ * which can be reused right away. The device side of the copy is ordered on
+ * the given stream, so work submitted to it afterwards sees the data.
+ *
+ * @param [in] handle    Tensor to be written to.
+ *                       + Must have pitch-linear cuda memory, with only its rows padded.
+ *
+ * @param [in] src       Host buffer to be copied from.
+ *                       + Must not be NULL.
+ *
+ * @param [in] sizeBytes Size of the host buffer in bytes.
+ *                       + Must be equal to the tensor size without padding.
+ *
+ * @param [in] stream    Stream where the copy to device is done.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_NOT_IMPLEMENTED  Tensor layout in memory isn't supported.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Staging buffers couldn't be allocated.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorUpload(NVCVTensorHandle handle, const void *src, int64_t sizeBytes, CUstream stream);
+
+/** Copies a tensor into a packed host buffer.
+ *
+ * The copy waits for the work already submitted to the stream, and the
+ * function returns once the host buffer holds the tensor contents.
+ *
+ * @param [in] handle    Tensor to be read from.
+ *                       + Must have pitch-linear cuda memory, with only its rows padded.
+ *
+ * @param [out] dst      Host buffer to be written to, packed as in @ref nvcvTensorUpload.
+ *                       + Must not be NULL.
+ *
+ * @param [in] sizeBytes Size of the host buffer in bytes.
+ *                       + Must be equal to the tensor size without padding.
+ *
+ * @param [in] stream    Stream where the copy from device is done.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_NOT_IMPLEMENTED  Tensor layout in memory isn't supported.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Staging buffers couldn't be allocated.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorDownload(NVCVTensorHandle handle, void *dst, int64_t sizeBytes, CUstream stream);
+
+/** Device id passed to @ref nvcvTensorPrefetch to migrate memory to the host. */
+#define NVCV_PREFETCH_TO_HOST (-1)
+
+/** Migrates the unified memory of a tensor to a device or to the host.
+ *
+ * Tensors allocated with unified memory, e.g. by an allocator created with
+ * @ref nvcvAllocatorConstructManaged, are migrated on demand when accessed, which
+ * stalls the first kernel touching them. Prefetching on the stream where the
+ * tensor is used next moves the pages beforehand.
+ * It does nothing for other kinds of memory.
+ *
+ * @param [in] handle Tensor to be migrated.
+ *                    + Must have pitch-linear memory.
+ *
+ * @param [in] device Device to migrate to, or @ref NVCV_PREFETCH_TO_HOST.
+ *
+ * @param [in] stream Stream where the migration is ordered.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorPrefetch(NVCVTensorHandle handle, int32_t device, CUstream stream);
+
+/** Identifies tensor files, it's stored at their start. */
+#define NVCV_TENSOR_FILE_MAGIC "NVCVTSR"
+
+/** Current version of the tensor file format. */
+#define NVCV_TENSOR_FILE_VERSION 1
+
+/** Alignment in bytes of the tensor file payload, as required for direct IO. */
+#define NVCV_TENSOR_FILE_ALIGNMENT 4096
+
+/** Header at the start of a tensor file.
+ *
+ * The header is followed by the payload, at an offset aligned to
+ * @ref NVCV_TENSOR_FILE_ALIGNMENT. The payload holds the tensor elements in
+ * row-major order without padding, so the file can be memory-mapped as an
+ * array with the tensor shape and data type, e.g. with numpy.memmap.
+ * Fields are stored with the byte order of the machine that wrote the file.
+ */
+typedef struct NVCVTensorFileHeaderRec
+{
+    /** Equal to @ref NVCV_TENSOR_FILE_MAGIC, null-terminated. */
+    char magic[8];
+
+    /** File format version, @ref NVCV_TENSOR_FILE_VERSION. */
+    int32_t version;
+
+    /** Rank, layout, shape and data type of the stored tensor. */
+    int32_t          rank;
+    NVCVTensorLayout layout;
+    int64_t          shape[NVCV_TENSOR_MAX_RANK];
+    NVCVDataType     dtype;
+
+    /** Offset in bytes of the payload from the file start. */
+    int64_t payloadOffset;
+
+    /** Size in bytes of the payload. */
+    int64_t payloadSize;
+} NVCVTensorFileHeader;
+
+/** Saves a tensor to a file.
+ *
+ * The tensor contents are copied once the work already submitted to the
+ * stream is done, the function returns once the file is written.
+ *
+ * @param [in] handle Tensor to be saved.
+ *                    + Must have pitch-linear cuda memory, with only its rows padded.
+ *
+ * @param [in] path   Path of the file, which is overwritten if it exists.
+ *                    + Must not be NULL.
+ *
+ * @param [in] stream Stream where the copy from device is done.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range, or the file couldn't be written.
+ * @retval #NVCV_ERROR_NOT_IMPLEMENTED  Tensor layout in memory isn't supported.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorSaveFile(NVCVTensorHandle handle, const char *path, CUstream stream);
+
+/** Reads the header of a tensor file.
+ *
+ * It's used to create a tensor with the stored shape and data type before
+ * loading the file into it with @ref nvcvTensorLoadFile.
+ *
+ * @param [in] path    Path of the file.
+ *                     + Must not be NULL.
+ *
+ * @param [out] header Where the file header will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range, or the file isn't a tensor file.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorFileReadHeader(const char *path, NVCVTensorFileHeader *header);
+
+/** Loads a tensor file into a tensor.
+ *
+ * With GPUDirect Storage, packed tensors are read directly into device
+ * memory once the work already submitted to the stream is done, and the
+ * function returns after the read. Otherwise, or if the tensor rows are
+ * padded, the file is copied as in @ref nvcvTensorUpload.
+ *
+ * @param [in] path   Path of the file.
+ *                    + Must not be NULL.
+ *
+ * @param [in] handle Tensor to be written to.
+ *                    + Must have the shape and data type stored in the file.
+ *                    + Must have pitch-linear cuda memory, with only its rows padded.
+ *
+ * @param [in] stream Stream where the copy to device is done.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range, or the file isn't a tensor file.
+ * @retval #NVCV_ERROR_NOT_IMPLEMENTED  Tensor layout in memory isn't supported.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Staging buffers couldn't be allocated.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorLoadFile(const char *path, NVCVTensorHandle handle, CUstream stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NVCV_TRANSFER_H
@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Transfer.hpp
+ *
+ * @brief Public C++ interface to NVCV host-device transfers.
+ */
+
+#ifndef NVCV_TRANSFER_HPP
+#define NVCV_TRANSFER_HPP
+
+#include "ITensor.hpp"
+#include "Transfer.h"
+#include "detail/CheckError.hpp"
+
+namespace nvcv {
+
+// Copies a packed host buffer into the tensor, see nvcvTensorUpload.
+inline void Upload(const ITensor &dst, const void *src, int64_t sizeBytes, CUstream stream)
+{
+    detail::CheckThrow(nvcvTensorUpload(dst.handle(), src, sizeBytes, stream));
+}
+
+// Copies the tensor into a packed host buffer, see nvcvTensorDownload.
+inline void Download(const ITensor &src, void *dst, int64_t sizeBytes, CUstream stream)
+{
+    detail::CheckThrow(nvcvTensorDownload(src.handle(), dst, sizeBytes, stream));
+}
+
+// Migrates the tensor's unified memory, see nvcvTensorPrefetch.
+inline void Prefetch(const ITensor &tensor, int32_t device, CUstream stream)
+{
+    detail::CheckThrow(nvcvTensorPrefetch(tensor.handle(), device, stream));
+}
+
+// Writes the tensor to a file, see nvcvTensorSaveFile.
+inline void SaveFile(const ITensor &tensor, const char *path, CUstream stream)
+{
+    detail::CheckThrow(nvcvTensorSaveFile(tensor.handle(), path, stream));
+}
+
+// Reads the header of a tensor file, see nvcvTensorFileReadHeader.
+inline NVCVTensorFileHeader ReadTensorFileHeader(const char *path)
+{
+    NVCVTensorFileHeader header;
+    detail::CheckThrow(nvcvTensorFileReadHeader(path, &header));
+    return header;
+}
+
+// Fills the tensor with the contents of a file, see nvcvTensorLoadFile.
+inline void LoadFile(const char *path, const ITensor &tensor, CUstream stream)
+{
+    detail::CheckThrow(nvcvTensorLoadFile(path, tensor.handle(), stream));
+}
+
+} // namespace nvcv
+
+#endif // NVCV_TRANSFER_HPP
@@ -39,6 +39,14 @@
  * | cuda memory        | cudaMalloc    | cudaFree     |
  * | host pinned memory | cudaHostAlloc | cudaHostFree |
  *
+ * Alternatively, a pool allocator can be created with @ref nvcvAllocatorConstructPool.
+ * It caches buffers being freed for later reuse, avoiding calls to the CUDA driver
+ * when objects are repeatedly created and destroyed.
+ *
+ * On devices where CPU and GPU share memory, @ref nvcvAllocatorConstructManaged
+ * creates an allocator whose cuda memory is also accessible by the host, so
+ * that data produced by the CPU doesn't have to be copied to the device.
+ *
  * By using defining custom resource allocators, user can override the allocation
  * and deallocation functions used for each resource type. When overriding, they can pass
  * a pointer to some user-defined context. It'll be passed unchanged to the
@@ -52,6 +60,7 @@
 
 #include "../Export.h"
 #include "../Status.h"
+#include "../detail/CudaFwd.h"
 #include "Fwd.h"
 
 #include <stdalign.h>
@@ -95,6 +104,38 @@ typedef enum
 
 #define NVCV_NUM_RESOURCE_TYPES (3)
 
+/** Caching and mapping semantics of host-pinned memory.
+ *
+ * Flags can be or-ed together and are passed to
+ * @ref nvcvAllocatorAllocHostPinnedMemoryEx. They correspond to the
+ * cudaHostAlloc flags.
+ */
+typedef enum
+{
+    /** Regular page-locked memory, cached by the CPU.
+     *  Best suited for buffers read by the host, e.g. device-to-host readback. */
+    NVCV_HOST_PINNED_MEM_DEFAULT = 0,
+
+    /** Write-combined memory. Host writes and transfers over PCIe are faster,
+     *  but host reads are very slow. Best suited for host-to-device staging. */
+    NVCV_HOST_PINNED_MEM_WRITE_COMBINED = (1 << 0),
+
+    /** Memory is considered pinned by all CUDA contexts. */
+    NVCV_HOST_PINNED_MEM_PORTABLE = (1 << 1),
+
+    /** Memory is mapped into the CUDA address space. */
+    NVCV_HOST_PINNED_MEM_MAPPED = (1 << 2),
+
+    /** Memory is placed on the NUMA node closest to the current device, if known.
+     *  On multi-socket systems, transfers from memory on the other socket's node
+     *  must cross the inter-socket link and get much less bandwidth. */
+    NVCV_HOST_PINNED_MEM_NUMA_LOCAL = (1 << 3),
+} NVCVHostPinnedMemFlag;
+
+/** Host-pinned memory flags used by @ref nvcvAllocatorAllocHostPinnedMemory. */
+#define NVCV_HOST_PINNED_MEM_STAGING \
+    (NVCV_HOST_PINNED_MEM_WRITE_COMBINED | NVCV_HOST_PINNED_MEM_MAPPED | NVCV_HOST_PINNED_MEM_NUMA_LOCAL)
+
 typedef struct NVCVCustomMemAllocatorRec
 {
     /** Pointer to function that performs memory allocation.
@@ -129,8 +170,174 @@ typedef struct NVCVCustomAllocatorRec
     NVCVCustomResourceAllocator res;
 } NVCVCustomAllocator;
 
+/** Function type for stream-ordered cuda memory allocation.
+ *
+ * Same as @ref NVCVMemAllocFunc, but the memory only needs to be usable by
+ * work submitted to @p stream after the call, as with cudaMallocAsync.
+ *
+ * @param [in] stream Stream where the memory will be used.
+ *                    NULL for allocations not tied to a stream, whose memory must be
+ *                    usable by any work submitted after the call.
+ */
+typedef void *(*NVCVMemAllocAsyncFunc)(void *ctx, int64_t sizeBytes, int32_t alignBytes, CUstream stream);
+
+/** Function type for stream-ordered cuda memory deallocation.
+ *
+ * Same as @ref NVCVMemFreeFunc, but work submitted to @p stream before the call
+ * might still be using the memory, it must only be reused once that work is done,
+ * as with cudaFreeAsync.
+ *
+ * @param [in] stream Stream where the memory was last used.
+ *                    NULL if the memory isn't in use anymore.
+ */
+typedef void (*NVCVMemFreeAsyncFunc)(void *ctx, void *ptr, int64_t sizeBytes, int32_t alignBytes, CUstream stream);
+
+/** Stream-ordered cuda memory allocator, see @ref nvcvAllocatorConstructCustomAsync. */
+typedef struct NVCVCustomCudaMemAsyncAllocatorRec
+{
+    /** Pointer to user context passed unchanged to the functions, can be NULL. */
+    void *ctx;
+
+    /** Pointer to function that performs memory allocation.
+     *  + Cannot be NULL.
+     */
+    NVCVMemAllocAsyncFunc fnAlloc;
+
+    /** Pointer to function that performs memory deallocation.
+     *  + Cannot be NULL.
+     */
+    NVCVMemFreeAsyncFunc fnFree;
+} NVCVCustomCudaMemAsyncAllocator;
+
 typedef struct NVCVAllocator *NVCVAllocatorHandle;
 
+/** How cuda memory is allocated by a managed allocator.
+ *
+ * @see nvcvAllocatorConstructManaged
+ */
+typedef enum
+{
+    /** Mapped host memory on integrated GPUs, unified memory otherwise. */
+    NVCV_MANAGED_MEM_AUTO = 0,
+
+    /** Unified memory, allocated with cudaMallocManaged and migrated on demand
+     *  between host and device. */
+    NVCV_MANAGED_MEM_UNIFIED,
+
+    /** Zero-copy host-pinned memory mapped into the device address space.
+     *  Device accesses go through the host memory, which is the physical
+     *  memory of the GPU on integrated devices. */
+    NVCV_MANAGED_MEM_MAPPED,
+} NVCVManagedMemMode;
+
+/** Parameters of the managed allocator.
+ *
+ * @see nvcvAllocatorConstructManaged
+ */
+typedef struct NVCVManagedAllocatorParamsRec
+{
+    NVCVManagedMemMode mode;
+
+    /** If non-zero, unified memory is advised to reside on the device it's
+     *  allocated for, while still being accessed by the host without faults.
+     *  Ignored for mapped memory. */
+    int8_t adviseDevice;
+} NVCVManagedAllocatorParams;
+
+/** Parameters of the compressible allocator.
+ *
+ * @see nvcvAllocatorConstructCompressible
+ */
+typedef struct NVCVCompressibleAllocatorParamsRec
+{
+    /** If non-zero, constructing the allocator fails on devices without
+     *  generic compression instead of falling back to regular cuda memory. */
+    int8_t requireCompression;
+
+    /** Cuda allocations smaller than this many bytes are made by the default
+     *  allocator, as they'd be rounded up to the allocation granularity.
+     *  If 0, the allocation granularity of the device is used. */
+    int64_t minSize;
+} NVCVCompressibleAllocatorParams;
+
+/** Number of buckets in the allocation size histogram of @ref NVCVAllocatorStats. */
+#define NVCV_ALLOCATOR_NUM_SIZE_BUCKETS (24)
+
+/** Usage counters of one resource type of an allocator.
+ *
+ * @see nvcvAllocatorGetStats
+ */
+typedef struct NVCVAllocatorStatsRec
+{
+    /** Bytes currently allocated and not freed yet. */
+    int64_t bytesInUse;
+
+    /** Largest value bytesInUse reached. */
+    int64_t peakBytesInUse;
+
+    /** Number of allocations and frees performed. Freeing NULL isn't counted. */
+    int64_t numAllocs;
+    int64_t numFrees;
+
+    /** Number of allocations by size.
+     *  Bucket 0 counts allocations smaller than 1 KiB, bucket i those
+     *  in [2^(9+i), 2^(10+i)) bytes, and the last one those of 4 GiB or more.
+     */
+    int64_t sizeHistogram[NVCV_ALLOCATOR_NUM_SIZE_BUCKETS];
+} NVCVAllocatorStats;
+
+/** Kind of event passed to @ref NVCVAllocatorTraceFunc. */
+typedef enum
+{
+    NVCV_ALLOCATOR_TRACE_ALLOC, /**< Buffer was allocated. */
+    NVCV_ALLOCATOR_TRACE_FREE   /**< Buffer is about to be freed. */
+} NVCVAllocatorTraceEventType;
+
+typedef struct NVCVAllocatorTraceEventRec
+{
+    NVCVAllocatorTraceEventType type;
+    NVCVResourceType            resType;
+
+    void   *ptr;
+    int64_t sizeBytes;
+    int32_t alignBytes;
+
+    /** Host-pinned memory flags, a combination of NVCVHostPinnedMemFlag.
+     *  It's 0 for the other resource types. */
+    uint32_t flags;
+} NVCVAllocatorTraceEvent;
+
+/** Function type called on each allocation and free of an allocator.
+ *
+ * It's called synchronously by the thread that allocates or frees memory,
+ * so memory can be attributed to the operator or object being created or
+ * destroyed at that moment. It must not allocate memory from the same allocator.
+ *
+ * @param [in] ctx    Pointer to user context given to @ref nvcvAllocatorSetTraceFunc.
+ * @param [in] handle Allocator performing the operation, NULL for the default allocator.
+ * @param [in] event  What's being allocated or freed.
+ */
+typedef void (*NVCVAllocatorTraceFunc)(void *ctx, NVCVAllocatorHandle handle, const NVCVAllocatorTraceEvent *event);
+
+/** Parameters of the pool allocator.
+ *
+ * @see nvcvAllocatorConstructPool
+ */
+typedef struct NVCVPoolAllocatorParamsRec
+{
+    /** Maximum number of bytes kept cached in each pool.
+     *  Once reached, buffers being freed are returned to the CUDA driver instead.
+     *  If negative, there's no limit.
+     */
+    int64_t releaseThreshold;
+
+    /** Buffers larger than this (in bytes) aren't cached, they're allocated
+     *  and freed directly with the CUDA driver.
+     *  If negative, there's no limit.
+     */
+    int64_t maxBlockSize;
+} NVCVPoolAllocatorParams;
+
 /** Constructs a custom allocator instance in the given storage.
  *
  * The constructed allocator is configured to use the default resource
@@ -156,6 +363,246 @@ typedef struct NVCVAllocator *NVCVAllocatorHandle;
 NVCV_PUBLIC NVCVStatus nvcvAllocatorConstructCustom(const NVCVCustomAllocator *customAllocators,
                                                     int32_t numCustomAllocators, NVCVAllocatorHandle *handle);
 
+/** Constructs an allocator instance whose cuda memory is allocated in stream order.
+ *
+ * Cuda memory is handled by the given stream-ordered functions, e.g. from a memory
+ * pool implementation like RAPIDS RMM, the other memory types as in
+ * @ref nvcvAllocatorConstructCustom.
+ *
+ * Objects whose release stream is set, with @ref nvcvTensorSetReleaseStream or
+ * @ref nvcvImageSetReleaseStream, give their memory back to @p cudaAllocator on that
+ * stream right away, instead of waiting for its work to be done. Memory allocated and
+ * freed without a stream is passed a NULL stream.
+ *
+ * @param [in] customAllocators    Array of custom resource allocators, see @ref nvcvAllocatorConstructCustom.
+ *                                 + Must not have a cuda memory allocator.
+ *
+ * @param [in] numCustomAllocators Number of custom allocators in the array.
+ *
+ * @param [in] cudaAllocator       Stream-ordered cuda memory allocator.
+ *                                 + Must not be NULL.
+ *
+ * @param [out] handle Where new instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some argument is outside its valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the allocator.
+ * @retval #NVCV_SUCCESS                Allocator created successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorConstructCustomAsync(const NVCVCustomAllocator *customAllocators,
+                                                         int32_t                numCustomAllocators,
+                                                         const NVCVCustomCudaMemAsyncAllocator *cudaAllocator,
+                                                         NVCVAllocatorHandle                   *handle);
+
+/** Constructs a pool allocator instance.
+ *
+ * The pool allocator caches cuda and host-pinned memory buffers once they're freed,
+ * and reuses them in subsequent allocations of similar size. This way, when the
+ * same objects are created and destroyed repeatedly, such as tensors
+ * created for each frame in an inference loop, no calls to cudaMalloc/cudaFree
+ * (and the implicit device synchronization they incur) are needed once the pools warm up.
+ * Host memory is handled by the default allocator.
+ *
+ * There's one pool for each CUDA device, cuda memory is allocated from the pool
+ * associated with the current device. Freed buffers are returned to the pool
+ * they were allocated from, regardless of the current device.
+ *
+ * @note Returning a buffer to the pool doesn't wait for pending device work.
+ *       Instead, the buffer is only handed out again once the work submitted to
+ *       the legacy default stream, and to every blocking stream, before it was
+ *       returned is completed. Work submitted to streams created with
+ *       cudaStreamNonBlocking isn't covered, the objects using the buffer must
+ *       then be released through that stream, i.e. with @ref nvcvTensorSetReleaseStream.
+ *       Host-pinned buffers only wait for the work of the device current when
+ *       they are returned.
+ *
+ * When not needed anymore, the allocator instance must be destroyed by
+ * @ref nvcvAllocatorDecRef function. All cached buffers are then released.
+ *
+ * @param [in] params Pool configuration.
+ *                    If NULL, pools will have no size limit.
+ *
+ * @param [out] handle Where new instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some argument is outside its valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the allocator.
+ * @retval #NVCV_SUCCESS                Allocator created successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorConstructPool(const NVCVPoolAllocatorParams *params, NVCVAllocatorHandle *handle);
+
+/** Constructs a pool allocator bound to a CUDA device.
+ *
+ * Same as @ref nvcvAllocatorConstructPool, but all cuda memory is allocated on
+ * the given device and cached in a pool of its own, whatever device is current.
+ * With one such allocator per device, objects of different devices never share
+ * a pool, and allocating and freeing them doesn't contend with other devices.
+ *
+ * @param [in] device CUDA device the cuda memory is allocated on.
+ *                    + Must be >= 0 and less than the number of devices.
+ *
+ * @param [in] params Pool configuration.
+ *                    If NULL, the pool will have no size limit.
+ *
+ * @param [out] handle Where new instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some argument is outside its valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the allocator.
+ * @retval #NVCV_SUCCESS                Allocator created successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorConstructDevicePool(int32_t device, const NVCVPoolAllocatorParams *params,
+                                                        NVCVAllocatorHandle *handle);
+
+/** Releases all buffers cached by a pool allocator back to the CUDA driver.
+ *
+ * Buffers currently in use aren't affected.
+ *
+ * @param [in] handle Handle to the allocator.
+ *                    + Must have been created by @ref nvcvAllocatorConstructPool.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT The handle is invalid or doesn't refer to a pool allocator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorTrim(NVCVAllocatorHandle handle);
+
+/** Returns the CUDA device an allocator allocates cuda memory on.
+ *
+ * @param [in] handle Handle to the allocator.
+ *                    + If NULL, the default allocator is queried.
+ *
+ * @param [out] device Where the device will be written to, or -1 if cuda memory
+ *                     is allocated on the device current at allocation.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some argument is outside its valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorGetDevice(NVCVAllocatorHandle handle, int32_t *device);
+
+/** Constructs an allocator whose cuda memory is accessible by host and device.
+ *
+ * Host and host-pinned memory are allocated as by the default allocator.
+ * Cuda memory is either unified or mapped host memory, as chosen by params->mode,
+ * so images and tensors can be written by the host and read by operators without
+ * explicit copies. Work on the device must still be synchronized with host
+ * accesses, and for unified memory @ref nvcvTensorPrefetch can be used to
+ * migrate the pages before they're used.
+ *
+ * When not needed anymore, the allocator instance must be destroyed by
+ * @ref nvcvAllocatorDecRef function.
+ *
+ * @param [in] params Allocator configuration.
+ *                    If NULL, @ref NVCV_MANAGED_MEM_AUTO is used with device advice.
+ *
+ * @param [out] handle Where new instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some argument is outside its valid range.
+ * @retval #NVCV_ERROR_NOT_COMPATIBLE   Current device doesn't support the requested mode.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the allocator.
+ * @retval #NVCV_SUCCESS                Allocator created successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorConstructManaged(const NVCVManagedAllocatorParams *params,
+                                                     NVCVAllocatorHandle              *handle);
+
+/** Constructs an allocator whose cuda memory is compressible.
+ *
+ * Cuda memory is allocated with the virtual memory management API of the
+ * driver as generic compressible memory, available on Ampere and newer GPUs.
+ * Compression is transparent to the kernels, it raises the effective bandwidth
+ * of data with large uniform regions, e.g. masks, padding and constant borders.
+ * Allocations are rounded up to the allocation granularity of the device, so
+ * smaller ones, and allocations that can't be compressed, e.g. once the
+ * compressible memory of the device is exhausted, use regular cuda memory.
+ *
+ * On devices without generic compression, cuda memory is allocated as by the
+ * default allocator unless params->requireCompression is set.
+ * Host and host-pinned memory are always allocated as by the default allocator.
+ *
+ * When not needed anymore, the allocator instance must be destroyed by
+ * @ref nvcvAllocatorDecRef function.
+ *
+ * @param [in] params Allocator configuration.
+ *                    If NULL, compression isn't required and the granularity
+ *                    of the device is the minimum size.
+ *                    + minSize must be >= 0.
+ *
+ * @param [out] handle Where new instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some argument is outside its valid range.
+ * @retval #NVCV_ERROR_NOT_COMPATIBLE   Compression is required and the current device doesn't support it.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the allocator.
+ * @retval #NVCV_SUCCESS                Allocator created successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorConstructCompressible(const NVCVCompressibleAllocatorParams *params,
+                                                          NVCVAllocatorHandle                   *handle);
+
+/** Returns whether cuda memory of an allocator is compressible.
+ *
+ * @param [in] handle Allocator to be queried.
+ *                    + Must not be NULL.
+ *
+ * @param [out] compressible Set to 1 if the allocator was constructed by
+ *                           @ref nvcvAllocatorConstructCompressible and its
+ *                           device supports compression, 0 otherwise.
+ *                           + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some argument is outside its valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorIsCompressible(NVCVAllocatorHandle handle, int8_t *compressible);
+
+/** Returns the usage counters of the given resource type of an allocator.
+ *
+ * The counters reflect the memory requested from the allocator by NVCV objects
+ * and users, not what it requests from the system, e.g. buffers cached by a pool
+ * allocator aren't in use.
+ *
+ * @param [in] handle  Allocator to be queried.
+ *                     If NULL, the default allocator is queried.
+ *
+ * @param [in] resType Resource type whose counters are returned.
+ *
+ * @param [out] stats  Where the counters will be written to.
+ *                     + Cannot be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorGetStats(NVCVAllocatorHandle handle, NVCVResourceType resType,
+                                             NVCVAllocatorStats *stats);
+
+/** Resets the usage counters of all resource types of an allocator.
+ *
+ * Allocation and free counts and the size histogram are zeroed, and the peak
+ * is set to the bytes currently in use, which aren't affected.
+ *
+ * @param [in] handle Allocator whose counters are reset.
+ *                    If NULL, the default allocator is used.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT The handle is invalid.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorResetStats(NVCVAllocatorHandle handle);
+
+/** Sets the function called on each allocation and free of an allocator.
+ *
+ * @note It must not be called while the allocator is being used by other threads.
+ *
+ * @param [in] handle Allocator to be traced.
+ *                    If NULL, the default allocator is used.
+ *
+ * @param [in] fn     Function to be called, or NULL to stop tracing.
+ *
+ * @param [in] ctx    Pointer passed unchanged to fn.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT The handle is invalid.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorSetTraceFunc(NVCVAllocatorHandle handle, NVCVAllocatorTraceFunc fn, void *ctx);
+
 /** Decrements the reference count of an existing allocator instance.
  *
  * The allocator is destroyed when its reference count reaches zero.
@@ -271,6 +718,10 @@ NVCV_PUBLIC NVCVStatus nvcvAllocatorFreeHostMemory(NVCVAllocatorHandle halloc, v
  *
  * It's usually used when implementing operators.
  *
+ * Memory is allocated with @ref NVCV_HOST_PINNED_MEM_STAGING semantics, i.e.
+ * it's write-combined. When the host needs to read from the buffer, use
+ * @ref nvcvAllocatorAllocHostPinnedMemoryEx instead.
+ *
  * @param [in] halloc     Handle to the resource allocator object to be used.
  *                        + Must have been created by @ref nvcvAllocatorCreate.
  * @param [out] ptr       Holds a pointer to the allocated buffer.
@@ -309,6 +760,47 @@ NVCV_PUBLIC NVCVStatus nvcvAllocatorAllocHostPinnedMemory(NVCVAllocatorHandle ha
 NVCV_PUBLIC NVCVStatus nvcvAllocatorFreeHostPinnedMemory(NVCVAllocatorHandle halloc, void *ptr, int64_t sizeBytes,
                                                          int32_t alignBytes);
 
+/** Allocates a memory buffer of host-pinned memory with the given caching semantics.
+ *
+ * Allocators created with @ref nvcvAllocatorConstructPool keep separate pools
+ * for each combination of flags. Custom host-pinned allocators defined by the
+ * user know nothing about the flags, they are ignored in this case.
+ *
+ * @param [in] halloc     Handle to the resource allocator object to be used.
+ *                        + Must have been created by @ref nvcvAllocatorCreate.
+ * @param [out] ptr       Holds a pointer to the allocated buffer.
+ *                        + Cannot be NULL.
+ * @param [in] sizeBytes  How many bytes to allocate.
+ *                        + Must be >= 0.
+ *                        + Must be an integral multiple of @p alignBytes.
+ * @param [in] alignBytes Address alignment in bytes.
+ *                        The returned address will be multiple of this value.
+ *                        + Must a power of 2.
+ * @param [in] flags      Bitwise-or of @ref NVCVHostPinnedMemFlag values.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough free memory.
+ * @retval #NVCV_SUCCESS                Operation completed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorAllocHostPinnedMemoryEx(NVCVAllocatorHandle halloc, void **ptr, int64_t sizeBytes,
+                                                            int32_t alignBytes, uint32_t flags);
+
+/** Frees a host-pinned memory buffer allocated with @ref nvcvAllocatorAllocHostPinnedMemoryEx.
+ *
+ * @param [in] halloc     Handle to the memory allocator object to be used.
+ *                        + Must have been created by @ref nvcvAllocatorCreate.
+ * @param [in] ptr        Pointer to the memory buffer to be freed.
+ *                        It can be NULL. In this case, no operation is performed.
+ * @param [in] sizeBytes,alignBytes,flags Parameters passed during buffer allocation.
+ *                                        + Not passing the exact same parameters
+ *                                          passed during allocation will lead to undefined behavior.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_SUCCESS                Operation completed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorFreeHostPinnedMemoryEx(NVCVAllocatorHandle halloc, void *ptr, int64_t sizeBytes,
+                                                           int32_t alignBytes, uint32_t flags);
+
 /** Allocates a memory buffer of cuda-accessible memory.
  *
  * It's usually used when implementing operators.
@@ -351,6 +843,43 @@ NVCV_PUBLIC NVCVStatus nvcvAllocatorAllocCudaMemory(NVCVAllocatorHandle halloc,
 NVCV_PUBLIC NVCVStatus nvcvAllocatorFreeCudaMemory(NVCVAllocatorHandle halloc, void *ptr, int64_t sizeBytes,
                                                    int32_t alignBytes);
 
+/** Allocates a memory buffer of cuda-accessible memory to be used on a stream.
+ *
+ * With allocators constructed by @ref nvcvAllocatorConstructCustomAsync, the
+ * allocation is stream-ordered. Other allocators allocate the buffer right away,
+ * as @ref nvcvAllocatorAllocCudaMemory.
+ *
+ * @param [in] halloc     Handle to the resource allocator object to be used.
+ * @param [out] ptr       Holds a pointer to the allocated buffer.
+ *                        + Cannot be NULL.
+ * @param [in] sizeBytes,alignBytes Same as in @ref nvcvAllocatorAllocCudaMemory.
+ * @param [in] stream     Stream where the buffer will be used.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough free memory.
+ * @retval #NVCV_SUCCESS                Operation completed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorAllocCudaMemoryAsync(NVCVAllocatorHandle halloc, void **ptr, int64_t sizeBytes,
+                                                         int32_t alignBytes, CUstream stream);
+
+/** Frees a cuda-accessible memory buffer once the work submitted so far to a stream is done.
+ *
+ * The function doesn't wait for the work. With allocators constructed by
+ * @ref nvcvAllocatorConstructCustomAsync, the buffer is freed in stream order.
+ * Other allocators get it back once the work is done.
+ *
+ * @param [in] halloc     Handle to the memory allocator object to be used.
+ * @param [in] ptr        Pointer to the memory buffer to be freed.
+ *                        It can be NULL. In this case, no operation is performed.
+ * @param [in] sizeBytes,alignBytes Parameters passed during buffer allocation.
+ * @param [in] stream     Stream where the buffer was last used.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_SUCCESS                Operation completed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorFreeCudaMemoryAsync(NVCVAllocatorHandle halloc, void *ptr, int64_t sizeBytes,
+                                                        int32_t alignBytes, CUstream stream);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file CompressibleAllocator.hpp
+ *
+ * @brief Defines the public C++ implementation of the compressible allocator.
+ */
+
+#ifndef NVCV_COMPRESSIBLEALLOCATOR_HPP
+#define NVCV_COMPRESSIBLEALLOCATOR_HPP
+
+#include "../detail/CheckError.hpp"
+#include "Allocator.h"
+#include "AllocatorWrapHandle.hpp"
+#include "IAllocator.hpp"
+
+namespace nvcv {
+
+// Allocator whose cuda memory is compressible on devices that support it.
+// See nvcvAllocatorConstructCompressible for details.
+class CompressibleAllocator final : public IAllocator
+{
+public:
+    // Prohibit moves/copies.
+    CompressibleAllocator(const CompressibleAllocator &) = delete;
+
+    explicit CompressibleAllocator(const NVCVCompressibleAllocatorParams *params = nullptr)
+        : m_wrap{doCreateAllocator(params)}
+    {
+        detail::SetObjectAssociation(nvcvAllocatorSetUserPointer, this, this->handle());
+    }
+
+    explicit CompressibleAllocator(bool requireCompression, int64_t minSize = 0)
+        : m_wrap{doCreateAllocator(requireCompression, minSize)}
+    {
+        detail::SetObjectAssociation(nvcvAllocatorSetUserPointer, this, this->handle());
+    }
+
+    ~CompressibleAllocator()
+    {
+        nvcvAllocatorDecRef(m_wrap.handle(), nullptr);
+    }
+
+    // Whether cuda memory is actually compressible, false when the device
+    // doesn't support it and the allocator falls back to regular memory.
+    bool compressible() const
+    {
+        int8_t out;
+        detail::CheckThrow(nvcvAllocatorIsCompressible(m_wrap.handle(), &out));
+        return out != 0;
+    }
+
+private:
+    AllocatorWrapHandle m_wrap;
+
+    static NVCVAllocatorHandle doCreateAllocator(const NVCVCompressibleAllocatorParams *params)
+    {
+        NVCVAllocatorHandle handle;
+        detail::CheckThrow(nvcvAllocatorConstructCompressible(params, &handle));
+        return handle;
+    }
+
+    static NVCVAllocatorHandle doCreateAllocator(bool requireCompression, int64_t minSize)
+    {
+        NVCVCompressibleAllocatorParams params;
+        params.requireCompression = requireCompression;
+        params.minSize            = minSize;
+        return doCreateAllocator(&params);
+    }
+
+    NVCVAllocatorHandle doGetHandle() const noexcept override
+    {
+        return m_wrap.handle();
+    }
+
+    IHostMemAllocator &doGetHostMemAllocator() override
+    {
+        return m_wrap.hostMem();
+    }
+
+    IHostPinnedMemAllocator &doGetHostPinnedMemAllocator() override
+    {
+        return m_wrap.hostPinnedMem();
+    }
+
+    ICudaMemAllocator &doGetCudaMemAllocator() override
+    {
+        return m_wrap.cudaMem();
+    }
+};
+
+} // namespace nvcv
+
+#endif // NVCV_COMPRESSIBLEALLOCATOR_HPP
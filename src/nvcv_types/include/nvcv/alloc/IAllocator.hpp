@@ -25,6 +25,7 @@
 #define NVCV_ALLOC_IALLOCATOR_HPP
 
 #include "../Casts.hpp"
+#include "Allocator.h"
 
 #include <cstdint>
 
@@ -81,9 +82,23 @@ public:
     IHostPinnedMemAllocator &hostPinnedMem();
     ICudaMemAllocator       &cudaMem();
 
+    // Host-pinned memory with explicit caching semantics,
+    // flags is a combination of NVCVHostPinnedMemFlag.
+    void *allocHostPinnedMem(int64_t size, int32_t align, uint32_t flags);
+    void  freeHostPinnedMem(void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept;
+
     void  setUserPointer(void *ptr);
     void *userPointer() const;
 
+    NVCVAllocatorStats stats(NVCVResourceType resType) const;
+    void               resetStats();
+
+    // fn is called on each allocation and free, set it before the allocator is used.
+    void setTraceFunc(NVCVAllocatorTraceFunc fn, void *ctx);
+
+    // Device where cuda memory is allocated, or -1 if it's the one current at allocation.
+    int32_t device() const;
+
 private:
     // Using the NVI pattern.
     virtual NVCVAllocatorHandle doGetHandle() const = 0;
@@ -113,6 +128,18 @@ inline ICudaMemAllocator &IAllocator::cudaMem()
     return doGetCudaMemAllocator();
 }
 
+inline void *IAllocator::allocHostPinnedMem(int64_t size, int32_t align, uint32_t flags)
+{
+    void *ptr;
+    detail::CheckThrow(nvcvAllocatorAllocHostPinnedMemoryEx(this->handle(), &ptr, size, align, flags));
+    return ptr;
+}
+
+inline void IAllocator::freeHostPinnedMem(void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept
+{
+    nvcvAllocatorFreeHostPinnedMemoryEx(this->handle(), ptr, size, align, flags);
+}
+
 inline void IAllocator::setUserPointer(void *ptr)
 {
     detail::CheckThrow(nvcvAllocatorSetUserPointer(this->handle(), ptr));
@@ -125,6 +152,30 @@ inline void *IAllocator::userPointer() const
     return ptr;
 }
 
+inline NVCVAllocatorStats IAllocator::stats(NVCVResourceType resType) const
+{
+    NVCVAllocatorStats stats;
+    detail::CheckThrow(nvcvAllocatorGetStats(this->handle(), resType, &stats));
+    return stats;
+}
+
+inline void IAllocator::resetStats()
+{
+    detail::CheckThrow(nvcvAllocatorResetStats(this->handle()));
+}
+
+inline int32_t IAllocator::device() const
+{
+    int32_t device;
+    detail::CheckThrow(nvcvAllocatorGetDevice(this->handle(), &device));
+    return device;
+}
+
+inline void IAllocator::setTraceFunc(NVCVAllocatorTraceFunc fn, void *ctx)
+{
+    detail::CheckThrow(nvcvAllocatorSetTraceFunc(this->handle(), fn, ctx));
+}
+
 inline IAllocator *IAllocator::cast(HandleType h)
 {
     return detail::CastImpl<IAllocator>(&nvcvAllocatorGetUserPointer, &nvcvAllocatorSetUserPointer, h);
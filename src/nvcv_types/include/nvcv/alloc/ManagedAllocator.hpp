@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file ManagedAllocator.hpp
+ *
+ * @brief Defines the public C++ implementation of the managed allocator.
+ */
+
+#ifndef NVCV_MANAGEDALLOCATOR_HPP
+#define NVCV_MANAGEDALLOCATOR_HPP
+
+#include "../detail/CheckError.hpp"
+#include "Allocator.h"
+#include "AllocatorWrapHandle.hpp"
+#include "IAllocator.hpp"
+
+namespace nvcv {
+
+// Allocator whose cuda memory is also accessible by the host.
+// See nvcvAllocatorConstructManaged for details.
+class ManagedAllocator final : public IAllocator
+{
+public:
+    // Prohibit moves/copies.
+    ManagedAllocator(const ManagedAllocator &) = delete;
+
+    explicit ManagedAllocator(const NVCVManagedAllocatorParams *params = nullptr)
+        : m_wrap{doCreateAllocator(params)}
+    {
+        detail::SetObjectAssociation(nvcvAllocatorSetUserPointer, this, this->handle());
+    }
+
+    explicit ManagedAllocator(NVCVManagedMemMode mode, bool adviseDevice = true)
+        : m_wrap{doCreateAllocator(mode, adviseDevice)}
+    {
+        detail::SetObjectAssociation(nvcvAllocatorSetUserPointer, this, this->handle());
+    }
+
+    ~ManagedAllocator()
+    {
+        nvcvAllocatorDecRef(m_wrap.handle(), nullptr);
+    }
+
+private:
+    AllocatorWrapHandle m_wrap;
+
+    static NVCVAllocatorHandle doCreateAllocator(const NVCVManagedAllocatorParams *params)
+    {
+        NVCVAllocatorHandle handle;
+        detail::CheckThrow(nvcvAllocatorConstructManaged(params, &handle));
+        return handle;
+    }
+
+    static NVCVAllocatorHandle doCreateAllocator(NVCVManagedMemMode mode, bool adviseDevice)
+    {
+        NVCVManagedAllocatorParams params;
+        params.mode         = mode;
+        params.adviseDevice = adviseDevice;
+        return doCreateAllocator(&params);
+    }
+
+    NVCVAllocatorHandle doGetHandle() const noexcept override
+    {
+        return m_wrap.handle();
+    }
+
+    IHostMemAllocator &doGetHostMemAllocator() override
+    {
+        return m_wrap.hostMem();
+    }
+
+    IHostPinnedMemAllocator &doGetHostPinnedMemAllocator() override
+    {
+        return m_wrap.hostPinnedMem();
+    }
+
+    ICudaMemAllocator &doGetCudaMemAllocator() override
+    {
+        return m_wrap.cudaMem();
+    }
+};
+
+} // namespace nvcv
+
+#endif // NVCV_MANAGEDALLOCATOR_HPP
@@ -0,0 +1,120 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file PoolAllocator.hpp
+ *
+ * @brief Defines the public C++ implementation of the pool allocator.
+ */
+
+#ifndef NVCV_POOLALLOCATOR_HPP
+#define NVCV_POOLALLOCATOR_HPP
+
+#include "../detail/CheckError.hpp"
+#include "Allocator.h"
+#include "AllocatorWrapHandle.hpp"
+#include "IAllocator.hpp"
+
+namespace nvcv {
+
+// Allocator that caches freed cuda and host-pinned buffers for later reuse.
+// See nvcvAllocatorConstructPool for details.
+class PoolAllocator final : public IAllocator
+{
+public:
+    // Prohibit moves/copies.
+    PoolAllocator(const PoolAllocator &) = delete;
+
+    explicit PoolAllocator(const NVCVPoolAllocatorParams *params = nullptr)
+        : m_wrap{doCreateAllocator(params)}
+    {
+        detail::SetObjectAssociation(nvcvAllocatorSetUserPointer, this, this->handle());
+    }
+
+    explicit PoolAllocator(int64_t releaseThreshold, int64_t maxBlockSize = -1)
+        : m_wrap{doCreateAllocator(releaseThreshold, maxBlockSize)}
+    {
+        detail::SetObjectAssociation(nvcvAllocatorSetUserPointer, this, this->handle());
+    }
+
+    // Allocates all cuda memory on the given device, see nvcvAllocatorConstructDevicePool.
+    PoolAllocator(int32_t device, const NVCVPoolAllocatorParams &params)
+        : m_wrap{doCreateDeviceAllocator(device, params)}
+    {
+        detail::SetObjectAssociation(nvcvAllocatorSetUserPointer, this, this->handle());
+    }
+
+    ~PoolAllocator()
+    {
+        nvcvAllocatorDecRef(m_wrap.handle(), nullptr);
+    }
+
+    // Returns all cached buffers to the CUDA driver.
+    void trim()
+    {
+        detail::CheckThrow(nvcvAllocatorTrim(m_wrap.handle()));
+    }
+
+private:
+    AllocatorWrapHandle m_wrap;
+
+    static NVCVAllocatorHandle doCreateAllocator(const NVCVPoolAllocatorParams *params)
+    {
+        NVCVAllocatorHandle handle;
+        detail::CheckThrow(nvcvAllocatorConstructPool(params, &handle));
+        return handle;
+    }
+
+    static NVCVAllocatorHandle doCreateDeviceAllocator(int32_t device, const NVCVPoolAllocatorParams &params)
+    {
+        NVCVAllocatorHandle handle;
+        detail::CheckThrow(nvcvAllocatorConstructDevicePool(device, &params, &handle));
+        return handle;
+    }
+
+    static NVCVAllocatorHandle doCreateAllocator(int64_t releaseThreshold, int64_t maxBlockSize)
+    {
+        NVCVPoolAllocatorParams params;
+        params.releaseThreshold = releaseThreshold;
+        params.maxBlockSize     = maxBlockSize;
+        return doCreateAllocator(&params);
+    }
+
+    NVCVAllocatorHandle doGetHandle() const noexcept override
+    {
+        return m_wrap.handle();
+    }
+
+    IHostMemAllocator &doGetHostMemAllocator() override
+    {
+        return m_wrap.hostMem();
+    }
+
+    IHostPinnedMemAllocator &doGetHostPinnedMemAllocator() override
+    {
+        return m_wrap.hostPinnedMem();
+    }
+
+    ICudaMemAllocator &doGetCudaMemAllocator() override
+    {
+        return m_wrap.cudaMem();
+    }
+};
+
+} // namespace nvcv
+
+#endif // NVCV_POOLALLOCATOR_HPP
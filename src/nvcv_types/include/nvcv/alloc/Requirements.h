@@ -41,6 +41,19 @@ extern "C"
 
 #define NVCV_MAX_MEM_REQUIREMENTS_BLOCK_SIZE (((int64_t)1) << NVCV_MAX_MEM_REQUIREMENTS_LOG2_BLOCK_SIZE)
 
+/** Row address alignment, in bytes, tuned for kernel performance.
+ *
+ * The default row alignment only guarantees what texture access needs,
+ * usually 32 bytes, so rows with odd widths such as 3-channel 1918-pixel
+ * images don't start on a 128-byte global memory segment. Passing this value
+ * as row alignment when calculating tensor or image requirements makes every
+ * row start on a segment boundary, so that row accesses are coalesced the same
+ * way on all rows and vectorized kernels can use their widest loads, at the
+ * cost of more padding. Larger power-of-two values, e.g. 256, can be
+ * passed as well.
+ */
+#define NVCV_ROW_ALIGNMENT_PERFORMANCE (128)
+
 /** Store memory resource requirements */
 typedef struct NVCVMemRequirementsRec
 {
@@ -230,13 +230,52 @@ public:
      */
     __host__ ImageBatchVarShapeWrap(const IImageBatchVarShapeDataStridedCuda &images)
         : Base(images)
+        , m_activeMask(images.activeMask())
     {
     }
 
-    using Base::height;
     using Base::plane;
     using Base::rowStride;
-    using Base::width;
+
+    /**
+     * Check whether image \p s sample is written to, as given by the active mask of the batch.
+     *
+     * @param[in] s Sample image index in the list.
+     *
+     * @return False if the sample is inactive.
+     */
+    inline __host__ __device__ bool isActive(int s) const
+    {
+        return m_activeMask == nullptr || m_activeMask[s] != 0;
+    }
+
+    /**
+     * Get width of plane \p p of image \p s sample, 0 if the sample is inactive.
+     *
+     * Kernels bounding their work by the size of the images they write do nothing for inactive samples.
+     *
+     * @param[in] s Sample image index in the list.
+     * @param[in] p Plane index in the image.
+     *
+     * @return The width of the given image plane in batch.
+     */
+    inline __host__ __device__ int width(int s, int p = 0) const
+    {
+        return isActive(s) ? Base::width(s, p) : 0;
+    }
+
+    /**
+     * Get height of plane \p p of image \p s sample, 0 if the sample is inactive.
+     *
+     * @param[in] s Sample image index in the list.
+     * @param[in] p Plane index in the image.
+     *
+     * @return The height of the given image plane in batch.
+     */
+    inline __host__ __device__ int height(int s, int p = 0) const
+    {
+        return isActive(s) ? Base::height(s, p) : 0;
+    }
 
     /**
      * Subscript operator for read-and-write access.
@@ -296,6 +335,9 @@ protected:
     {
         return const_cast<T *>(Base::doGetPtr(s, p, y, x));
     }
+
+private:
+    const uint8_t *m_activeMask = nullptr;
 };
 
 /**
@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Philox.hpp
+ *
+ * @brief Defines the Philox4x32-10 counter-based random number generator.
+ */
+
+#ifndef NVCV_CUDA_PHILOX_HPP
+#define NVCV_CUDA_PHILOX_HPP
+
+#include <cuda_runtime.h> // for uint2, uint4, etc.
+
+#include <cstdint> // for uint32_t, etc.
+
+namespace nvcv::cuda {
+
+/**
+ * Philox4x32-10 random number generator (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC 2011).
+ *
+ * Philox is counter-based: the random numbers are a keyed bijection of a 128-bit counter, so any element of any
+ * stream can be computed directly, without a state to keep between kernel launches.  Kernels drawing random
+ * parameters seed one Philox per sample, and get the same numbers no matter how samples are mapped to threads.
+ * Results are the same on host and device, and match the Random123 reference implementation.
+ *
+ * @defgroup NVCV_CPP_CUDATOOLS_PHILOX Philox random number generator
+ * @{
+ *
+ * @code
+ * Philox rng(seed, sample, launch); // independent stream per sample and per launch
+ * float  u = rng.uniform();         // in [0, 1)
+ * @endcode
+ */
+
+/**
+ * Philox4x32 bijection with 10 rounds, i.e. the random block at counter \p ctr for key \p key.
+ *
+ * @param[in] ctr Counter of the block.
+ * @param[in] key Key, usually the seed of the stream.
+ *
+ * @return Four random 32-bit words.
+ */
+inline __host__ __device__ uint4 Philox4x32(uint4 ctr, uint2 key)
+{
+    constexpr uint32_t kMul0 = 0xD2511F53, kMul1 = 0xCD9E8D57;
+    constexpr uint32_t kWeyl0 = 0x9E3779B9, kWeyl1 = 0xBB67AE85;
+
+#ifdef __CUDA_ARCH__
+#    pragma unroll
+#endif
+    for (int round = 0; round < 10; ++round)
+    {
+        const uint64_t p0 = static_cast<uint64_t>(kMul0) * ctr.x;
+        const uint64_t p1 = static_cast<uint64_t>(kMul1) * ctr.z;
+
+        ctr = uint4{static_cast<uint32_t>(p1 >> 32) ^ ctr.y ^ key.x, static_cast<uint32_t>(p1),
+                    static_cast<uint32_t>(p0 >> 32) ^ ctr.w ^ key.y, static_cast<uint32_t>(p0)};
+
+        key.x += kWeyl0;
+        key.y += kWeyl1;
+    }
+    return ctr;
+}
+
+/**
+ * Stream of random numbers drawn with Philox4x32-10.
+ *
+ * The stream given by \p seed and \p subsequence is the sequence of blocks at counters
+ * `{offset, subsequence}`, `{offset + 1, subsequence}`, etc, each one giving four 32-bit words.
+ */
+class Philox
+{
+public:
+    /**
+     * Creates the stream \p subsequence of the generator keyed by \p seed, starting at block \p offset.
+     *
+     * @param[in] seed Key of the generator.
+     * @param[in] subsequence Index of the stream, e.g. the sample index, so that each sample has its own stream.
+     * @param[in] offset First block of the stream to be used.
+     */
+    inline __host__ __device__ Philox(uint64_t seed, uint64_t subsequence, uint64_t offset = 0)
+        : m_ctr{static_cast<uint32_t>(offset), static_cast<uint32_t>(offset >> 32),
+                static_cast<uint32_t>(subsequence), static_cast<uint32_t>(subsequence >> 32)}
+        , m_key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}
+    {
+    }
+
+    /**
+     * Draws the next 32 random bits of the stream.
+     */
+    inline __host__ __device__ uint32_t operator()()
+    {
+        if (m_idx == 4)
+        {
+            m_block = Philox4x32(m_ctr, m_key);
+            m_idx   = 0;
+            if (++m_ctr.x == 0)
+            {
+                ++m_ctr.y;
+            }
+        }
+
+        const uint32_t words[4] = {m_block.x, m_block.y, m_block.z, m_block.w};
+        return words[m_idx++];
+    }
+
+    /**
+     * Draws a float uniformly distributed in [0, 1), with 24 random bits.
+     */
+    inline __host__ __device__ float uniform()
+    {
+        return ((*this)() >> 8) * (1.0f / (1 << 24));
+    }
+
+    /**
+     * Draws a float uniformly distributed in [low, high).
+     */
+    inline __host__ __device__ float uniform(float low, float high)
+    {
+        return low + (high - low) * uniform();
+    }
+
+    /**
+     * Draws a double uniformly distributed in [0, 1), with 53 random bits.
+     */
+    inline __host__ __device__ double uniformDouble()
+    {
+        const uint64_t hi = (*this)() >> 5, lo = (*this)() >> 6;
+        return (hi * 67108864.0 + lo) * (1.0 / 9007199254740992.0);
+    }
+
+private:
+    uint4 m_ctr;
+    uint2 m_key;
+    uint4 m_block = {};
+    int   m_idx   = 4;
+};
+
+/**@}*/
+
+} // namespace nvcv::cuda
+
+#endif // NVCV_CUDA_PHILOX_HPP
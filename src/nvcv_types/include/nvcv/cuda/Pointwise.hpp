@@ -0,0 +1,263 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Pointwise.hpp
+ *
+ * @brief Defines pointwise operations that compose at compile time into a single device function.
+ */
+
+#ifndef NVCV_CUDA_POINTWISE_HPP
+#define NVCV_CUDA_POINTWISE_HPP
+
+#include "MathOps.hpp"      // for operator *, etc.
+#include "MathWrappers.hpp" // for pow, etc.
+#include "SaturateCast.hpp" // for SaturateCast, etc.
+#include "StaticCast.hpp"   // for StaticCast, etc.
+#include "TypeTraits.hpp"   // for Require, etc.
+
+namespace nvcv::cuda {
+
+/**
+ * Pointwise operations and their composition.
+ *
+ * Chains of elementwise operators, e.g. ConvertTo followed by GammaContrast and Normalize, are bound by memory
+ * bandwidth when each runs as its own kernel, as every step reads and writes the whole image.  The functors below
+ * compute one step each on a single value, and Compose chains them into one functor that the compiler inlines: a
+ * single kernel calling it reads the input once and writes the final output once, with intermediate values kept
+ * in registers.  Composed functors can be passed wherever a unary operation is expected, e.g. to
+ * TransformRowVector.
+ *
+ * Operators that move pixels without changing them, e.g. Flip, are expressed as coordinate operations.  A
+ * PixelChain pairs one with a value operation, so that a kernel reads the source pixel at the mapped coordinate
+ * and writes the transformed value at the output coordinate.
+ *
+ * @defgroup NVCV_CPP_CUDATOOLS_POINTWISE Pointwise operations
+ * @{
+ *
+ * @code
+ * // uchar3 -> float3: x * (1 / 255) then x^gamma then (x - mean) * invStd, computed in one pass
+ * auto op = Compose(ScaleShiftOp<float>{1.f / 255, 0.f}, GammaOp{gamma, 1.f}, NormalizeOp<float3>{mean, invStd});
+ * auto chain = MakePixelChain(FlipCoordOp{flipCode, size}, Compose(op, ReorderOp<2, 1, 0>{}));
+ * // kernel: chain(dst, src, int3{x, y, z});
+ * @endcode
+ */
+
+/**
+ * Composition of pointwise operations, applied from left to right.
+ *
+ * @tparam Ops Types of the operations, each one is called with the result of the previous one.
+ */
+template<class... Ops>
+struct ComposedOp;
+
+template<>
+struct ComposedOp<>
+{
+    template<typename T>
+    inline __host__ __device__ T operator()(T x) const
+    {
+        return x;
+    }
+};
+
+template<class Op, class... Ops>
+struct ComposedOp<Op, Ops...>
+{
+    Op                 first;
+    ComposedOp<Ops...> rest;
+
+    template<typename T>
+    inline __host__ __device__ auto operator()(T x) const
+    {
+        return rest(first(x));
+    }
+};
+
+/// Composition of no operations, i.e. identity.
+inline __host__ __device__ ComposedOp<> Compose()
+{
+    return {};
+}
+
+/**
+ * Composes pointwise operations into a single one.
+ *
+ * @param[in] op First operation to apply.
+ * @param[in] ops Operations applied next, from left to right.
+ *
+ * @return The composed operation.
+ */
+template<class Op, class... Ops>
+inline __host__ __device__ ComposedOp<Op, Ops...> Compose(Op op, Ops... ops)
+{
+    return {op, Compose(ops...)};
+}
+
+/**
+ * Casts to base type \p S, then scales and shifts the value, as in ConvertTo.
+ *
+ * @tparam S Base type of the computation, e.g. float.
+ */
+template<typename S, class = Require<!IsCompound<S>>>
+struct ScaleShiftOp
+{
+    S scale;
+    S shift;
+
+    template<typename T>
+    inline __host__ __device__ auto operator()(T x) const
+    {
+        return scale * StaticCast<S>(x) + shift;
+    }
+};
+
+/**
+ * Saturate casts the value to type \p T, usually the last operation of a chain.
+ *
+ * @tparam T Target type, either a regular C type or a type with the same number of components as the value.
+ */
+template<typename T>
+struct SaturateOp
+{
+    template<typename U>
+    inline __host__ __device__ auto operator()(U x) const
+    {
+        return SaturateCast<T>(x);
+    }
+};
+
+/**
+ * Applies gamma correction, \f$ range \cdot (x / range)^{gamma} \f$, as in GammaContrast.
+ *
+ * The range is 255 for values coming from 8-bit images, and 1 for values already normalized to [0, 1].  The result
+ * is in float.
+ */
+struct GammaOp
+{
+    float gamma;
+    float range;
+
+    template<typename T>
+    inline __host__ __device__ auto operator()(T x) const
+    {
+        return pow(StaticCast<float>(x) / range, gamma) * range;
+    }
+};
+
+/**
+ * Subtracts a base and multiplies by a scale, as in Normalize.
+ *
+ * @tparam V Type of base and scale, either a regular C type for all channels, or a type with one value per channel.
+ */
+template<typename V>
+struct NormalizeOp
+{
+    V base;
+    V scale;
+
+    template<typename T>
+    inline __host__ __device__ auto operator()(T x) const
+    {
+        return (StaticCast<BaseType<V>>(x) - base) * scale;
+    }
+};
+
+/**
+ * Reorders the channels of the value with indices known at compile time, as in ChannelReorder.
+ *
+ * The result has one channel per index, so channels can also be dropped or duplicated.
+ *
+ * @tparam I Source channel index for each output channel.
+ */
+template<int... I>
+struct ReorderOp
+{
+    template<typename T, class = Require<HasTypeTraits<T> && ((I >= 0 && I < NumElements<T>)&&...)>>
+    inline __host__ __device__ auto operator()(T x) const
+    {
+        return MakeType<BaseType<T>, sizeof...(I)>{GetElement(x, I)...};
+    }
+};
+
+/// Coordinate operation that reads each pixel at its own coordinate.
+struct IdentityCoordOp
+{
+    inline __host__ __device__ int3 operator()(int3 c) const
+    {
+        return c;
+    }
+};
+
+/**
+ * Coordinate operation that reads each pixel at its mirrored coordinate, as in Flip.
+ *
+ * The flip code is 0 to flip around the x-axis, positive to flip around the y-axis, and negative to flip around
+ * both.
+ */
+struct FlipCoordOp
+{
+    int  flipCode;
+    int2 size;
+
+    inline __host__ __device__ int3 operator()(int3 c) const
+    {
+        return int3{flipCode != 0 ? size.x - 1 - c.x : c.x, flipCode <= 0 ? size.y - 1 - c.y : c.y, c.z};
+    }
+};
+
+/**
+ * Fused pass of a coordinate operation followed by a value operation.
+ *
+ * Calling it with an output coordinate (x, y, sample) reads the source at the coordinate given by the coordinate
+ * operation, applies the value operation and stores the result in the destination at the output coordinate.  The
+ * source must not alias the destination when the coordinate operation moves pixels.
+ */
+template<class CoordOp, class ValueOp>
+struct PixelChain
+{
+    CoordOp coordOp;
+    ValueOp valueOp;
+
+    template<class DstWrapper, class SrcWrapper>
+    inline __host__ __device__ void operator()(DstWrapper &dst, const SrcWrapper &src, int3 c) const
+    {
+        const int3 s = coordOp(c);
+
+        *dst.ptr(c.z, c.y, c.x) = valueOp(*src.ptr(s.z, s.y, s.x));
+    }
+};
+
+/**
+ * Creates a fused pass of a coordinate operation followed by a value operation.
+ *
+ * @param[in] coordOp Operation mapping output coordinates to source coordinates.
+ * @param[in] valueOp Operation applied to the source pixel.
+ *
+ * @return The fused pass.
+ */
+template<class CoordOp, class ValueOp>
+inline __host__ __device__ PixelChain<CoordOp, ValueOp> MakePixelChain(CoordOp coordOp, ValueOp valueOp)
+{
+    return {coordOp, valueOp};
+}
+
+/**@}*/
+
+} // namespace nvcv::cuda
+
+#endif // NVCV_CUDA_POINTWISE_HPP
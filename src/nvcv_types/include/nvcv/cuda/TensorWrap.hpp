@@ -31,6 +31,8 @@
 #include <nvcv/TensorDataAccess.hpp> // for TensorDataAccessStridedImagePlanar, etc.
 #include <util/Assert.h>             // for NVCV_ASSERT, etc.
 
+#include <cstdint>
+#include <type_traits>
 #include <utility>
 
 namespace nvcv::cuda {
@@ -41,7 +43,7 @@ namespace nvcv::cuda {
  */
 
 /**
- * TensorWrap class is a non-owning wrap of a N-D tensor used for easy access of its elements in CUDA device.
+ * TensorWrapT class is a non-owning wrap of a N-D tensor used for easy access of its elements in CUDA device.
  *
  * TensorWrap is a wrapper of a multi-dimensional tensor that can have one or more of its N dimension strides, or
  * pitches, defined either at compile-time or at run-time.  Each pitch in \p Strides represents the offset in bytes
@@ -49,8 +51,12 @@ namespace nvcv::cuda {
  * last (fastest changing) dimension of the tensor, in that order.  Each dimension with run-time pitch is specified
  * as -1 in the \p Strides template parameter.
  *
+ * Offsets are computed with the type of the run-time pitches, \ref TensorWrap uses 32-bit int for the fast path
+ * and \ref TensorWrap64 uses 64-bit int for tensors larger than 2 GB.
+ *
  * Template arguments:
  * - T type of the values inside the tensor
+ * - StrideType type of the run-time pitches and of the offsets computed from them
  * - Strides sequence of compile- or run-time pitches (-1 indicates run-time)
  *   - Y compile-time pitches
  *   - X run-time pitches
@@ -76,24 +82,28 @@ namespace nvcv::cuda {
  * @sa NVCV_CPP_CUDATOOLS_TENSORWRAPS
  *
  * @tparam T Type (it can be const) of each element inside the tensor wrapper.
+ * @tparam StrideType Type of each run-time pitch, int or int64_t.
  * @tparam Strides Each compile-time (use -1 for run-time) pitch in bytes from first to last dimension.
  */
-template<typename T, int... Strides>
-class TensorWrap;
+template<typename T, typename StrideType, int... Strides>
+class TensorWrapT;
 
-template<typename T, int... Strides>
-class TensorWrap<const T, Strides...>
+template<typename T, typename StrideType, int... Strides>
+class TensorWrapT<const T, StrideType, Strides...>
 {
     static_assert(HasTypeTraits<T>, "TensorWrap<T> can only be used if T has type traits");
+    static_assert(std::is_same_v<StrideType, int> || std::is_same_v<StrideType, int64_t>,
+                  "TensorWrap strides must be either int or int64_t");
 
 public:
     using ValueType = const T;
+    using StrideT   = StrideType;
 
     static constexpr int kNumDimensions   = sizeof...(Strides);
     static constexpr int kVariableStrides = ((Strides == -1) + ...);
     static constexpr int kConstantStrides = kNumDimensions - kVariableStrides;
 
-    TensorWrap() = default;
+    TensorWrapT() = default;
 
     /**
      * Constructs a constant TensorWrap by wrapping a const \p data pointer argument.
@@ -102,11 +112,11 @@ public:
      * @param[in] strides0..D Each run-time pitch in bytes from first to last dimension.
      */
     template<typename DataType, typename... Args>
-    explicit __host__ __device__ TensorWrap(const DataType *data, Args... strides)
+    explicit __host__ __device__ TensorWrapT(const DataType *data, Args... strides)
         : m_data(reinterpret_cast<const std::byte *>(data))
-        , m_strides{std::forward<int>(strides)...}
+        , m_strides{static_cast<StrideType>(strides)...}
     {
-        static_assert(std::conjunction_v<std::is_same<int, Args>...>);
+        static_assert(std::conjunction_v<std::disjunction<std::is_same<int, Args>, std::is_same<StrideType, Args>>...>);
         static_assert(sizeof...(Args) == kVariableStrides);
     }
 
@@ -115,7 +125,7 @@ public:
      *
      * @param[in] image Image reference to the image that will be wrapped.
      */
-    __host__ TensorWrap(const IImageDataStridedCuda &image)
+    __host__ TensorWrapT(const IImageDataStridedCuda &image)
     {
         static_assert(kVariableStrides == 1 && kNumDimensions == 2);
 
@@ -129,7 +139,7 @@ public:
      *
      * @param[in] tensor Tensor reference to the tensor that will be wrapped.
      */
-    __host__ TensorWrap(const ITensorDataStridedCuda &tensor)
+    __host__ TensorWrapT(const ITensorDataStridedCuda &tensor)
     {
         constexpr int kStride[] = {std::forward<int>(Strides)...};
 
@@ -146,9 +156,9 @@ public:
             }
             else if (i < kVariableStrides)
             {
-                NVCV_ASSERT(tensor.stride(i) <= TypeTraits<int>::max);
+                NVCV_ASSERT(tensor.stride(i) <= TypeTraits<StrideType>::max);
 
-                m_strides[i] = tensor.stride(i);
+                m_strides[i] = static_cast<StrideType>(tensor.stride(i));
             }
         }
     }
@@ -158,7 +168,7 @@ public:
      *
      * @return The const array (as a pointer) containing run-time pitches in bytes.
      */
-    __host__ __device__ const int *strides() const
+    __host__ __device__ const StrideType *strides() const
     {
         return m_strides;
     }
@@ -226,16 +236,16 @@ protected:
         int coords[] = {std::forward<int>(c)...};
 
         // Computing offset first potentially postpones or avoids 64-bit math during addressing
-        int offset = 0;
+        StrideType offset = 0;
 #pragma unroll
         for (int i = 0; i < kVarSize; ++i)
         {
-            offset += coords[i] * m_strides[i];
+            offset += static_cast<StrideType>(coords[i]) * m_strides[i];
         }
 #pragma unroll
         for (int i = kVariableStrides; i < kDimSize; ++i)
         {
-            offset += coords[i] * kStride[i];
+            offset += static_cast<StrideType>(coords[i]) * kStride[i];
         }
 
         return reinterpret_cast<const T *>(m_data + offset);
@@ -243,28 +253,30 @@ protected:
 
 private:
     const std::byte *m_data                      = nullptr;
-    int              m_strides[kVariableStrides] = {};
+    StrideType       m_strides[kVariableStrides] = {};
 };
 
 /**
  * Tensor wrapper class specialized for non-constant value type.
  *
  * @tparam T Type (non-const) of each element inside the tensor wrapper.
+ * @tparam StrideType Type of each run-time pitch, int or int64_t.
  * @tparam Strides Each compile-time (use -1 for run-time) pitch in bytes from first to last dimension.
  */
-template<typename T, int... Strides>
-class TensorWrap : public TensorWrap<const T, Strides...>
+template<typename T, typename StrideType, int... Strides>
+class TensorWrapT : public TensorWrapT<const T, StrideType, Strides...>
 {
-    using Base = TensorWrap<const T, Strides...>;
+    using Base = TensorWrapT<const T, StrideType, Strides...>;
 
 public:
     using ValueType = T;
+    using typename Base::StrideT;
 
     using Base::kConstantStrides;
     using Base::kNumDimensions;
     using Base::kVariableStrides;
 
-    TensorWrap() = default;
+    TensorWrapT() = default;
 
     /**
      * Constructs a TensorWrap by wrapping a \p data pointer argument.
@@ -273,7 +285,7 @@ public:
      * @param[in] strides0..N Each run-time pitch in bytes from first to last dimension.
      */
     template<typename DataType, typename... Args>
-    explicit __host__ __device__ TensorWrap(DataType *data, Args... strides)
+    explicit __host__ __device__ TensorWrapT(DataType *data, Args... strides)
         : Base(data, strides...)
     {
     }
@@ -283,7 +295,7 @@ public:
      *
      * @param[in] image Image reference to the image that will be wrapped.
      */
-    __host__ TensorWrap(const IImageDataStridedCuda &image)
+    __host__ TensorWrapT(const IImageDataStridedCuda &image)
         : Base(image)
     {
     }
@@ -293,7 +305,7 @@ public:
      *
      * @param[in] tensor Tensor reference to the tensor that will be wrapped.
      */
-    __host__ TensorWrap(const ITensorDataStridedCuda &tensor)
+    __host__ TensorWrapT(const ITensorDataStridedCuda &tensor)
         : Base(tensor)
     {
     }
@@ -355,6 +367,24 @@ protected:
     }
 };
 
+/**
+ * Tensor wrapper with 32-bit run-time pitches and offsets, the default for tensors up to 2 GB.
+ *
+ * @tparam T Type (it can be const) of each element inside the tensor wrapper.
+ * @tparam Strides Each compile-time (use -1 for run-time) pitch in bytes from first to last dimension.
+ */
+template<typename T, int... Strides>
+using TensorWrap = TensorWrapT<T, int, Strides...>;
+
+/**
+ * Tensor wrapper with 64-bit run-time pitches and offsets, for tensors larger than 2 GB.
+ *
+ * @tparam T Type (it can be const) of each element inside the tensor wrapper.
+ * @tparam Strides Each compile-time (use -1 for run-time) pitch in bytes from first to last dimension.
+ */
+template<typename T, int... Strides>
+using TensorWrap64 = TensorWrapT<T, int64_t, Strides...>;
+
 /**@}*/
 
 /**
@@ -366,6 +396,7 @@ protected:
  *  Template arguments:
  *  - T data type of each element in \ref TensorWrap
  *  - N (optional) number of dimensions
+ *  - StrideType (optional) type of the run-time pitches, int by default
  *
  *  @sa NVCV_CPP_CUDATOOLS_TENSORWRAP
  *
@@ -373,23 +404,24 @@ protected:
  *  @{
  */
 
-template<typename T>
-using Tensor1DWrap = TensorWrap<T, sizeof(T)>;
+template<typename T, typename StrideType = int>
+using Tensor1DWrap = TensorWrapT<T, StrideType, sizeof(T)>;
 
-template<typename T>
-using Tensor2DWrap = TensorWrap<T, -1, sizeof(T)>;
+template<typename T, typename StrideType = int>
+using Tensor2DWrap = TensorWrapT<T, StrideType, -1, sizeof(T)>;
 
-template<typename T>
-using Tensor3DWrap = TensorWrap<T, -1, -1, sizeof(T)>;
+template<typename T, typename StrideType = int>
+using Tensor3DWrap = TensorWrapT<T, StrideType, -1, -1, sizeof(T)>;
 
-template<typename T>
-using Tensor4DWrap = TensorWrap<T, -1, -1, -1, sizeof(T)>;
+template<typename T, typename StrideType = int>
+using Tensor4DWrap = TensorWrapT<T, StrideType, -1, -1, -1, sizeof(T)>;
 
-template<typename T, int N>
+template<typename T, int N, typename StrideType = int>
 using TensorNDWrap = std::conditional_t<
-    N == 1, Tensor1DWrap<T>,
-    std::conditional_t<N == 2, Tensor2DWrap<T>,
-                       std::conditional_t<N == 3, Tensor3DWrap<T>, std::conditional_t<N == 4, Tensor4DWrap<T>, void>>>>;
+    N == 1, Tensor1DWrap<T, StrideType>,
+    std::conditional_t<N == 2, Tensor2DWrap<T, StrideType>,
+                       std::conditional_t<N == 3, Tensor3DWrap<T, StrideType>,
+                                          std::conditional_t<N == 4, Tensor4DWrap<T, StrideType>, void>>>>;
 
 /**@}*/
 
@@ -408,16 +440,16 @@ using TensorNDWrap = std::conditional_t<
  *
  * @return Tensor wrap useful to access tensor data in CUDA kernels.
  */
-template<typename T, class = Require<HasTypeTraits<T>>>
+template<typename T, typename StrideType = int, class = Require<HasTypeTraits<T>>>
 __host__ auto CreateTensorWrapNHW(const ITensorDataStridedCuda &tensor)
 {
     auto tensorAccess = TensorDataAccessStridedImagePlanar::Create(tensor);
     NVCV_ASSERT(tensorAccess);
-    NVCV_ASSERT(tensorAccess->sampleStride() <= TypeTraits<int>::max);
-    NVCV_ASSERT(tensorAccess->rowStride() <= TypeTraits<int>::max);
+    NVCV_ASSERT(tensorAccess->sampleStride() <= TypeTraits<StrideType>::max);
+    NVCV_ASSERT(tensorAccess->rowStride() <= TypeTraits<StrideType>::max);
 
-    return Tensor3DWrap<T>(tensor.basePtr(), static_cast<int>(tensorAccess->sampleStride()),
-                           static_cast<int>(tensorAccess->rowStride()));
+    return Tensor3DWrap<T, StrideType>(tensor.basePtr(), static_cast<StrideType>(tensorAccess->sampleStride()),
+                                       static_cast<StrideType>(tensorAccess->rowStride()));
 }
 
 /**
@@ -435,17 +467,33 @@ __host__ auto CreateTensorWrapNHW(const ITensorDataStridedCuda &tensor)
  *
  * @return Tensor wrap useful to access tensor data in CUDA kernels.
  */
-template<typename T, class = Require<HasTypeTraits<T>>>
+template<typename T, typename StrideType = int, class = Require<HasTypeTraits<T>>>
 __host__ auto CreateTensorWrapNHWC(const ITensorDataStridedCuda &tensor)
 {
     auto tensorAccess = TensorDataAccessStridedImagePlanar::Create(tensor);
     NVCV_ASSERT(tensorAccess);
-    NVCV_ASSERT(tensorAccess->sampleStride() <= TypeTraits<int>::max);
-    NVCV_ASSERT(tensorAccess->rowStride() <= TypeTraits<int>::max);
-    NVCV_ASSERT(tensorAccess->colStride() <= TypeTraits<int>::max);
+    NVCV_ASSERT(tensorAccess->sampleStride() <= TypeTraits<StrideType>::max);
+    NVCV_ASSERT(tensorAccess->rowStride() <= TypeTraits<StrideType>::max);
+    NVCV_ASSERT(tensorAccess->colStride() <= TypeTraits<StrideType>::max);
+
+    return Tensor4DWrap<T, StrideType>(tensor.basePtr(), static_cast<StrideType>(tensorAccess->sampleStride()),
+                                       static_cast<StrideType>(tensorAccess->rowStride()),
+                                       static_cast<StrideType>(tensorAccess->colStride()));
+}
 
-    return Tensor4DWrap<T>(tensor.basePtr(), static_cast<int>(tensorAccess->sampleStride()),
-                           static_cast<int>(tensorAccess->rowStride()), static_cast<int>(tensorAccess->colStride()));
+/**
+ * Checks whether offsets inside a tensor can overflow 32-bit int, i.e. if it's larger than 2 GB.
+ *
+ * Kernels dispatch on it to use \ref TensorWrap64 only when needed, keeping the 32-bit offsets of \ref
+ * TensorWrap for all other tensors.
+ *
+ * @param[in] tensor Reference to the tensor to be checked.
+ *
+ * @return True if the tensor needs 64-bit offsets.
+ */
+__host__ inline bool NeedsLargeOffsets(const ITensorDataStridedCuda &tensor)
+{
+    return tensor.stride(0) * tensor.shape(0) > TypeTraits<int>::max;
 }
 
 } // namespace nvcv::cuda
@@ -0,0 +1,386 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file TextureWrap.hpp
+ *
+ * @brief Defines texture wrapper over pitch-linear tensors for fetches through the texture units.
+ */
+
+#ifndef NVCV_CUDA_TEXTURE_WRAP_HPP
+#define NVCV_CUDA_TEXTURE_WRAP_HPP
+
+#include "MathOps.hpp"    // for operator *, etc.
+#include "TypeTraits.hpp" // for ConvertBaseTypeTo, etc.
+
+#include <cuda_runtime.h>            // for cudaTextureObject_t, etc.
+#include <nvcv/BorderType.h>         // for NVCVBorderType, etc.
+#include <nvcv/ITensorData.hpp>      // for ITensorDataStridedCuda, etc.
+#include <nvcv/TensorDataAccess.hpp> // for TensorDataAccessStridedImagePlanar, etc.
+#include <util/Assert.h>             // for NVCV_ASSERT, etc.
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace nvcv::cuda {
+
+/**
+ * @defgroup NVCV_CPP_CUDATOOLS_TEXTUREWRAP TextureWrap classes
+ * @{
+ */
+
+/**
+ * Metavariable to check if a type can be read through a texture.
+ *
+ * Textures have 1, 2 or 4 channels of 8-bit, 16-bit or 32-bit float elements, e.g. uchar, short2 or float4.
+ *
+ * @tparam T Type to be checked.
+ */
+template<typename T, typename BT = BaseType<T>>
+constexpr bool HasTextureFormat
+    = HasTypeTraits<T> && (NumElements<T> == 1 || NumElements<T> == 2 || NumElements<T> == 4)
+   && (std::is_same_v<BT, unsigned char> || std::is_same_v<BT, signed char> || std::is_same_v<BT, unsigned short>
+       || std::is_same_v<BT, short> || std::is_same_v<BT, float>);
+
+namespace detail {
+
+// Process-wide cache of texture objects over pitch-linear memory. Texture objects only describe memory, so the one
+// created for a given device, base pointer, pitch, size and format can be reused by every later call.
+class TextureCache
+{
+public:
+    static TextureCache &Instance()
+    {
+        static TextureCache cache;
+        return cache;
+    }
+
+    ~TextureCache()
+    {
+        for (auto &entry : m_entries)
+        {
+            cudaDestroyTextureObject(entry.second);
+        }
+    }
+
+    // Returns false, with the CUDA error reset, if the texture object could not be created.
+    bool get(const cudaResourceDesc &resDesc, const cudaTextureDesc &texDesc, cudaTextureObject_t &texture)
+    {
+        Key key;
+        if (cudaGetDevice(&key.device) != cudaSuccess)
+        {
+            cudaGetLastError();
+            return false;
+        }
+        key.resDesc = resDesc;
+        key.texDesc = texDesc;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (auto &entry : m_entries)
+        {
+            if (entry.first == key)
+            {
+                texture = entry.second;
+                return true;
+            }
+        }
+
+        if (cudaCreateTextureObject(&texture, &resDesc, &texDesc, nullptr) != cudaSuccess)
+        {
+            cudaGetLastError();
+            return false;
+        }
+
+        if (m_entries.size() == kMaxEntries)
+        {
+            // the texture object is only a descriptor, kernels already launched with it are not affected
+            cudaDestroyTextureObject(m_entries.front().second);
+            m_entries.pop_front();
+        }
+        m_entries.emplace_back(key, texture);
+
+        return true;
+    }
+
+private:
+    static constexpr size_t kMaxEntries = 256;
+
+    struct Key
+    {
+        int              device;
+        cudaResourceDesc resDesc;
+        cudaTextureDesc  texDesc;
+
+        bool operator==(const Key &that) const
+        {
+            return device == that.device
+                && resDesc.res.pitch2D.devPtr == that.resDesc.res.pitch2D.devPtr
+                && resDesc.res.pitch2D.pitchInBytes == that.resDesc.res.pitch2D.pitchInBytes
+                && resDesc.res.pitch2D.width == that.resDesc.res.pitch2D.width
+                && resDesc.res.pitch2D.height == that.resDesc.res.pitch2D.height
+                && std::memcmp(&resDesc.res.pitch2D.desc, &that.resDesc.res.pitch2D.desc,
+                               sizeof(cudaChannelFormatDesc))
+                       == 0
+                && texDesc.filterMode == that.texDesc.filterMode && texDesc.readMode == that.texDesc.readMode;
+        }
+    };
+
+    std::mutex                                       m_mutex;
+    std::deque<std::pair<Key, cudaTextureObject_t>> m_entries;
+};
+
+} // namespace detail
+
+/**
+ * Texture wrapper class used to read an NHW tensor through the texture units.
+ *
+ * This class wraps a texture object over all samples of a pitch-linear tensor, stacked vertically, and provides
+ * \ref operator[] to read it at (x, y, sample) coordinates with border handling.  Pixel centers are at integer
+ * coordinates, as in \ref BorderWrap.  With \p F equal to cudaFilterModeLinear, fractional coordinates are
+ * bilinearly interpolated by the texture units, which use 8-bit fixed-point weights, and values of integer types
+ * are returned as float in the range of \p T.  With cudaFilterModePoint, coordinates are rounded to the nearest
+ * pixel and returned as \p T.
+ *
+ * The texture has clamp addressing, samples are separated and constant borders blended in by this class, so only
+ * \ref NVCV_BORDER_CONSTANT and \ref NVCV_BORDER_REPLICATE are supported.
+ *
+ * @sa CreateTextureWrapNHW
+ *
+ * @tparam T Type of the values in the tensor, see \ref HasTextureFormat.
+ * @tparam B It is a \ref NVCVBorderType indicating the border to be used, constant or replicate.
+ * @tparam F Texture filter mode, cudaFilterModePoint or cudaFilterModeLinear.
+ */
+template<typename T, NVCVBorderType B, cudaTextureFilterMode F = cudaFilterModePoint>
+class TextureWrap
+{
+    static_assert(HasTextureFormat<T>, "TextureWrap<T> can only be used if T has a texture format");
+    static_assert(B == NVCV_BORDER_CONSTANT || B == NVCV_BORDER_REPLICATE,
+                  "TextureWrap only supports constant and replicate borders");
+
+public:
+    // The type of the values in the texture.
+    using ValueType = T;
+
+    // The type returned by fetches, float for interpolated integer types.
+    using FetchType = std::conditional_t<F == cudaFilterModeLinear, ConvertBaseTypeTo<float, T>, T>;
+
+    static constexpr NVCVBorderType        kBorderType = B;
+    static constexpr cudaTextureFilterMode kFilterMode = F;
+
+    TextureWrap() = default;
+
+    /**
+     * Constructs a TextureWrap over a texture object with the samples stacked vertically.
+     *
+     * @param[in] texture Texture object with clamp addressing and non-normalized coordinates.
+     * @param[in] numRows Number of rows of each sample.
+     * @param[in] numCols Number of columns of each sample.
+     * @param[in] borderValue The border value is ignored in non-constant border types.
+     */
+    explicit __host__ __device__ TextureWrap(cudaTextureObject_t texture, int numRows, int numCols,
+                                             FetchType borderValue = {})
+        : m_texture(texture)
+        , m_numRows(numRows)
+        , m_numCols(numCols)
+        , m_borderValue(borderValue)
+    {
+    }
+
+    inline __host__ __device__ cudaTextureObject_t texture() const
+    {
+        return m_texture;
+    }
+
+    inline __host__ __device__ int numRows() const
+    {
+        return m_numRows;
+    }
+
+    inline __host__ __device__ int numCols() const
+    {
+        return m_numCols;
+    }
+
+    inline __host__ __device__ FetchType borderValue() const
+    {
+        return m_borderValue;
+    }
+
+#ifdef __CUDACC__
+    /**
+     * Subscript operator for read-only access through the texture units.
+     *
+     * @param[in] c Coordinate (x, y, sample) to be read, as int3 or float3.
+     *
+     * @return Fetched value, see \ref FetchType.
+     */
+    template<typename DimType, class = Require<NumElements<DimType> == 3>>
+    inline __device__ FetchType operator[](DimType c) const
+    {
+        const int sample = static_cast<int>(c.z);
+
+        if constexpr (F == cudaFilterModePoint)
+        {
+            int x = static_cast<int>(floorf(c.x + 0.5f));
+            int y = static_cast<int>(floorf(c.y + 0.5f));
+
+            if constexpr (B == NVCV_BORDER_CONSTANT)
+            {
+                if (x < 0 || x >= m_numCols || y < 0 || y >= m_numRows)
+                {
+                    return m_borderValue;
+                }
+            }
+
+            // clamping y keeps the fetch inside the sample, clamp addressing only works on the whole texture
+            return doFetch(x, min(max(y, 0), m_numRows - 1), sample);
+        }
+        else
+        {
+            const float x = fminf(fmaxf(c.x, 0.f), m_numCols - 1);
+            const float y = fminf(fmaxf(c.y, 0.f), m_numRows - 1);
+
+            FetchType value = doFetch(x, y, sample);
+
+            if constexpr (B == NVCV_BORDER_CONSTANT)
+            {
+                // the interpolation weight of the pixels inside, the rest goes to the border value
+                const float inside = (1.f - fminf(fabsf(c.x - x), 1.f)) * (1.f - fminf(fabsf(c.y - y), 1.f));
+                if (inside < 1.f)
+                {
+                    value = inside * value + (1.f - inside) * m_borderValue;
+                }
+            }
+
+            return value;
+        }
+    }
+
+private:
+    inline __device__ FetchType doFetch(float x, float y, int sample) const
+    {
+        FetchType value = tex2D<FetchType>(m_texture, x + 0.5f, sample * m_numRows + y + 0.5f);
+
+        if constexpr (F == cudaFilterModeLinear && std::is_integral_v<BaseType<T>>)
+        {
+            // integer types are filtered with normalized float reads, scaled back to the range of T
+            value = value * static_cast<float>(TypeTraits<BaseType<T>>::max);
+        }
+
+        return value;
+    }
+#endif
+
+private:
+    cudaTextureObject_t m_texture = 0;
+
+    int m_numRows = 0;
+    int m_numCols = 0;
+
+    FetchType m_borderValue = SetAll<FetchType>(0);
+};
+
+/**@}*/
+
+/**
+ * Factory function to create a texture wrap given a tensor data.
+ *
+ * The output \ref TextureWrap reads an NHW tensor, with NHWC or HWC layout where the channel C is inside the
+ * given template type \p T, through the texture units.  The texture objects come from a process-wide cache keyed
+ * by device, base pointer, pitch, size and format, so repeated calls on the same memory don't create new ones;
+ * they must not be destroyed by the caller.
+ *
+ * @sa NVCV_CPP_CUDATOOLS_TEXTUREWRAP
+ *
+ * @tparam T Type of the values to be read, see \ref HasTextureFormat.
+ * @tparam B Border to be used when reading outside the samples, constant or replicate.
+ * @tparam F Texture filter mode, cudaFilterModePoint or cudaFilterModeLinear.
+ *
+ * @param[in] tensor Reference to the tensor that will be wrapped.
+ * @param[in] borderValue The border value is ignored in non-constant border types.
+ *
+ * @return Texture wrap, or empty if the tensor doesn't meet the texture requirements: samples contiguous in memory
+ *         and base pointer, row stride and sizes within the device texture limits.
+ */
+template<typename T, NVCVBorderType B, cudaTextureFilterMode F = cudaFilterModePoint,
+         class = Require<HasTextureFormat<T>>>
+__host__ std::optional<TextureWrap<T, B, F>> CreateTextureWrapNHW(
+    const ITensorDataStridedCuda &tensor, typename TextureWrap<T, B, F>::FetchType borderValue = {})
+{
+    auto tensorAccess = TensorDataAccessStridedImagePlanar::Create(tensor);
+    NVCV_ASSERT(tensorAccess);
+
+    int device, texAlign, pitchAlign, maxWidth, maxHeight, maxPitch;
+    if (cudaGetDevice(&device) != cudaSuccess
+        || cudaDeviceGetAttribute(&texAlign, cudaDevAttrTextureAlignment, device) != cudaSuccess
+        || cudaDeviceGetAttribute(&pitchAlign, cudaDevAttrTexturePitchAlignment, device) != cudaSuccess
+        || cudaDeviceGetAttribute(&maxWidth, cudaDevAttrMaxTexture2DLinearWidth, device) != cudaSuccess
+        || cudaDeviceGetAttribute(&maxHeight, cudaDevAttrMaxTexture2DLinearHeight, device) != cudaSuccess
+        || cudaDeviceGetAttribute(&maxPitch, cudaDevAttrMaxTexture2DLinearPitch, device) != cudaSuccess)
+    {
+        cudaGetLastError();
+        return std::nullopt;
+    }
+
+    const int64_t numSamples = tensorAccess->numSamples();
+    const int64_t numRows    = tensorAccess->numRows();
+    const int64_t rowStride  = tensorAccess->rowStride();
+    const int64_t height     = numSamples * numRows;
+
+    if ((numSamples > 1 && tensorAccess->sampleStride() != numRows * rowStride)
+        || reinterpret_cast<uintptr_t>(tensorAccess->sampleData(0)) % texAlign != 0 || rowStride % pitchAlign != 0
+        || tensorAccess->numCols() > maxWidth || height > maxHeight || rowStride > maxPitch)
+    {
+        return std::nullopt;
+    }
+
+    cudaResourceDesc resDesc         = {};
+    resDesc.resType                  = cudaResourceTypePitch2D;
+    resDesc.res.pitch2D.devPtr       = tensorAccess->sampleData(0);
+    resDesc.res.pitch2D.desc         = cudaCreateChannelDesc<T>();
+    resDesc.res.pitch2D.width        = tensorAccess->numCols();
+    resDesc.res.pitch2D.height       = height;
+    resDesc.res.pitch2D.pitchInBytes = rowStride;
+
+    cudaTextureDesc texDesc  = {};
+    texDesc.addressMode[0]   = cudaAddressModeClamp;
+    texDesc.addressMode[1]   = cudaAddressModeClamp;
+    texDesc.filterMode       = F;
+    texDesc.readMode         = F == cudaFilterModeLinear && std::is_integral_v<BaseType<T>>
+                                 ? cudaReadModeNormalizedFloat
+                                 : cudaReadModeElementType;
+    texDesc.normalizedCoords = 0;
+
+    cudaTextureObject_t texture;
+    if (!detail::TextureCache::Instance().get(resDesc, texDesc, texture))
+    {
+        return std::nullopt;
+    }
+
+    return TextureWrap<T, B, F>(texture, static_cast<int>(numRows), static_cast<int>(tensorAccess->numCols()),
+                                borderValue);
+}
+
+} // namespace nvcv::cuda
+
+#endif // NVCV_CUDA_TEXTURE_WRAP_HPP
@@ -0,0 +1,268 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file VectorizedAccess.hpp
+ *
+ * @brief Defines vectorized (multi-element) load and store functionality.
+ */
+
+#ifndef NVCV_CUDA_VECTORIZED_ACCESS_HPP
+#define NVCV_CUDA_VECTORIZED_ACCESS_HPP
+
+#include "TypeTraits.hpp" // for Require, etc.
+
+#include <nvcv/ITensorData.hpp>      // for ITensorDataStridedCuda, etc.
+#include <nvcv/TensorDataAccess.hpp> // for TensorDataAccessStridedImagePlanar, etc.
+
+#include <cstdint>     // for uintptr_t, etc.
+#include <type_traits> // for std::is_invocable_v, etc.
+
+namespace nvcv::cuda {
+
+/**
+ * Vectorized access to contiguous rows of elements.
+ *
+ * Elementwise kernels are usually bound by memory bandwidth, and accessing one 8-bit element (or one 3-channel
+ * 8-bit pixel) per thread issues memory transactions far smaller than what the hardware can serve.  The functions
+ * below group \p N consecutive elements of base type \p T in a Vector, loaded and stored with aligned accesses
+ * of up to 16 bytes each.  Rows whose length is not a multiple of \p N are finished by a scalar tail.
+ *
+ * Vector accesses require aligned addresses, so callers are expected to check the alignment of the data at launch
+ * time with IsVectorAligned, and fall back to their scalar kernel when it does not hold.
+ *
+ * @defgroup NVCV_CPP_CUDATOOLS_VECTORIZEDACCESS Vectorized Access
+ * @{
+ *
+ * @code
+ * constexpr int N = VectorWidth<3, unsigned char, float>; // 3-channel uchar -> float
+ * if (IsVectorAligned<unsigned char, N>(srcData) && IsVectorAligned<float, N>(dstData))
+ * {
+ *     // launch kernel calling TransformRowVector<N, 3>(dstRow, srcRow, width * 3, chunkIdx, op)
+ * }
+ * @endcode
+ */
+
+/// Maximum number of bytes of a single vectorized memory access.
+constexpr int kMaxVectorAccessBytes = 16;
+
+/// Maximum number of bytes of a Vector, i.e. up to four vectorized memory accesses.
+constexpr int kMaxVectorBytes = 4 * kMaxVectorAccessBytes;
+
+namespace detail {
+
+constexpr int VectorGcd(int a, int b)
+{
+    return b == 0 ? a : VectorGcd(b, a % b);
+}
+
+constexpr int VectorAlignment(int bytes)
+{
+    int align = kMaxVectorAccessBytes;
+    while (bytes % align != 0)
+    {
+        align /= 2;
+    }
+    return align;
+}
+
+template<typename T, typename... Ts>
+constexpr int MaxSizeOf()
+{
+    if constexpr (sizeof...(Ts) == 0)
+    {
+        return static_cast<int>(sizeof(T));
+    }
+    else
+    {
+        constexpr int rest = MaxSizeOf<Ts...>();
+        return static_cast<int>(sizeof(T)) > rest ? static_cast<int>(sizeof(T)) : rest;
+    }
+}
+
+} // namespace detail
+
+/**
+ * Aligned array of \p N elements of type \p T accessed with as few memory transactions as possible.
+ *
+ * @tparam T Base type of the elements.
+ * @tparam N Number of elements in the vector.
+ */
+template<typename T, int N>
+struct alignas(detail::VectorAlignment(sizeof(T) * N)) Vector
+{
+    static_assert(sizeof(T) * N <= kMaxVectorBytes, "Vector too large");
+
+    T data[N];
+
+    __host__ __device__ T &operator[](int i)
+    {
+        return data[i];
+    }
+
+    __host__ __device__ const T &operator[](int i) const
+    {
+        return data[i];
+    }
+};
+
+/**
+ * Number of elements per vector for a row of pixels with \p NumChannels channels read or written as types \p Ts.
+ *
+ * The width is the number of elements of the largest type fitting in 16 bytes, rounded up to a multiple of the
+ * number of channels, so that every vector starts at channel zero and the channel of each element is known at
+ * compile time.  For instance 3-channel 8-bit pixels are accessed 16 at a time, i.e. 48 elements per vector.
+ *
+ * @tparam NumChannels Number of interleaved channels in a pixel.
+ * @tparam Ts Base types of the data accessed, e.g. source and destination types.
+ */
+template<int NumChannels, typename... Ts>
+constexpr int VectorWidth = []
+{
+    constexpr int base = kMaxVectorAccessBytes / detail::MaxSizeOf<Ts...>();
+    return base / detail::VectorGcd(base, NumChannels) * NumChannels;
+}();
+
+/**
+ * Check if a pointer or stride is suitably aligned for Vector<T, N> accesses.
+ *
+ * @param[in] ptr Pointer to check.
+ *
+ * @return True if vector accesses at \p ptr are valid.
+ */
+template<typename T, int N>
+__host__ __device__ bool IsVectorAligned(const void *ptr)
+{
+    return reinterpret_cast<uintptr_t>(ptr) % alignof(Vector<T, N>) == 0;
+}
+
+template<typename T, int N>
+__host__ __device__ bool IsVectorAligned(int64_t stride)
+{
+    return stride % alignof(Vector<T, N>) == 0;
+}
+
+/**
+ * Check if tensor data allows Vector<T, N> accesses along its rows.
+ *
+ * The tensor must be in NHWC or HWC layout with densely packed pixels, and its base pointer and all strides
+ * above the pixel stride must be aligned to the vector size.
+ *
+ * @param[in] data Tensor data to check.
+ * @param[in] numChannels Number of channels of base type \p T in each pixel.
+ *
+ * @return True if rows of the tensor can be accessed with vectors.
+ */
+template<typename T, int N>
+bool IsVectorAligned(const ITensorDataStridedCuda &data, int numChannels)
+{
+    auto access = TensorDataAccessStridedImagePlanar::Create(data);
+    if (!access || access->numPlanes() != 1 || access->colStride() != numChannels * (int64_t)sizeof(T))
+    {
+        return false;
+    }
+
+    return IsVectorAligned<T, N>(data.basePtr()) && IsVectorAligned<T, N>(access->sampleStride())
+        && IsVectorAligned<T, N>(access->rowStride());
+}
+
+/**
+ * Load \p N consecutive elements starting at \p ptr, which must be vector aligned.
+ */
+template<int N, typename T>
+__host__ __device__ Vector<std::remove_const_t<T>, N> LoadVector(T *ptr)
+{
+    return *reinterpret_cast<const Vector<std::remove_const_t<T>, N> *>(ptr);
+}
+
+/**
+ * Store \p N consecutive elements starting at \p ptr, which must be vector aligned.
+ */
+template<int N, typename T>
+__host__ __device__ void StoreVector(T *ptr, const Vector<T, N> &v)
+{
+    *reinterpret_cast<Vector<T, N> *>(ptr) = v;
+}
+
+/**
+ * Apply an elementwise operation to one chunk of \p N elements of a row.
+ *
+ * Chunk \p chunkIdx covers elements [chunkIdx * N, chunkIdx * N + N) of the row.  Full chunks in aligned rows are
+ * loaded and stored as vectors; the last partial chunk, or any chunk of a row that is not vector aligned, is
+ * processed one element at a time.  The operation is called as op(value, channel) when it accepts the channel
+ * index, with channel in [0, NumChannels), or as op(value) otherwise.
+ *
+ * @tparam N Number of elements per vector, see VectorWidth.
+ * @tparam NumChannels Number of interleaved channels in the row.
+ *
+ * @param[out] dst Pointer to the first element of the destination row.
+ * @param[in] src Pointer to the first element of the source row.
+ * @param[in] rowLength Number of elements (not pixels) in the row.
+ * @param[in] chunkIdx Index of the chunk of \p N elements to process.
+ * @param[in] op Operation mapping a source element to a destination element.
+ */
+template<int N, int NumChannels = 1, typename DstT, typename SrcT, typename Op>
+__device__ void TransformRowVector(DstT *dst, const SrcT *src, int rowLength, int chunkIdx, Op op)
+{
+    static_assert(N % NumChannels == 0, "Vector width must be a multiple of the number of channels");
+
+    auto apply = [&op](SrcT v, int c) -> DstT
+    {
+        if constexpr (std::is_invocable_v<Op, SrcT, int>)
+        {
+            return op(v, c);
+        }
+        else
+        {
+            return op(v);
+        }
+    };
+
+    int idx = chunkIdx * N;
+    if (idx >= rowLength)
+    {
+        return;
+    }
+
+    if (idx + N <= rowLength && IsVectorAligned<SrcT, N>(src) && IsVectorAligned<DstT, N>(dst))
+    {
+        Vector<SrcT, N> in = LoadVector<N>(src + idx);
+        Vector<DstT, N> out;
+
+#pragma unroll
+        for (int k = 0; k < N; ++k)
+        {
+            out[k] = apply(in[k], k % NumChannels);
+        }
+
+        StoreVector(dst + idx, out);
+    }
+    else
+    {
+        int end = idx + N < rowLength ? idx + N : rowLength;
+        for (int i = idx; i < end; ++i)
+        {
+            dst[i] = apply(src[i], i % NumChannels);
+        }
+    }
+}
+
+/**@}*/
+
+} // namespace nvcv::cuda
+
+#endif // NVCV_CUDA_VECTORIZED_ACCESS_HPP
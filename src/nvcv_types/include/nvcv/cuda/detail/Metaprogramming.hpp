@@ -21,6 +21,7 @@
 // Internal implementation of meta-programming functionalities.
 // Not to be used directly.
 
+#include <cuda_fp16.h>    // for __half, etc.
 #include <cuda_runtime.h> // for uchar1, etc.
 
 #include <cfloat>      // for FLT_MIN, etc.
@@ -80,6 +81,8 @@ NVCV_CUDA_TYPE_TRAITS(long long, long long, 0, 1, LLONG_MIN, LLONG_MAX);
 NVCV_CUDA_TYPE_TRAITS(unsigned long long, unsigned long long, 0, 1, 0, ULLONG_MAX);
 NVCV_CUDA_TYPE_TRAITS(float, float, 0, 1, FLT_MIN, FLT_MAX);
 NVCV_CUDA_TYPE_TRAITS(double, double, 0, 1, DBL_MIN, DBL_MAX);
+// Half-precision float has no CUDA compound type, its min and max follow the FLT_MIN and FLT_MAX convention
+NVCV_CUDA_TYPE_TRAITS(__half, __half, 0, 1, __half_raw{0x0400}, __half_raw{0x7BFF});
 
 #define NVCV_CUDA_TYPE_TRAITS_1_TO_4(COMPOUND_TYPE, BASE_TYPE, MIN_VAL, MAX_VAL) \
     NVCV_CUDA_TYPE_TRAITS(COMPOUND_TYPE##1, BASE_TYPE, 1, 1, MIN_VAL, MAX_VAL);  \
@@ -153,6 +156,7 @@ NVCV_CUDA_MAKE_TYPE_0_TO_4(unsigned long long, ulonglong);
 NVCV_CUDA_MAKE_TYPE_0_TO_4(long long, longlong);
 NVCV_CUDA_MAKE_TYPE_0_TO_4(float, float);
 NVCV_CUDA_MAKE_TYPE_0_TO_4(double, double);
+NVCV_CUDA_MAKE_TYPE(__half, 0, __half);
 
 #undef NVCV_CUDA_MAKE_TYPE_0_TO_4
 #undef NVCV_CUDA_MAKE_TYPE
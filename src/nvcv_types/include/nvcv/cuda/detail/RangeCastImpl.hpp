@@ -30,7 +30,20 @@ namespace nvcv::cuda::detail {
 template<typename T, typename U>
 inline __host__ __device__ T RangeCastImpl(U u)
 {
-    if constexpr (std::is_floating_point_v<U> && std::is_floating_point_v<T> && sizeof(U) > sizeof(T))
+    if constexpr (std::is_same_v<U, __half> && !std::is_same_v<T, __half>)
+    {
+        // half -> any, same as float -> any
+        return RangeCastImpl<T>(__half2float(u));
+    }
+    else if constexpr (std::is_same_v<T, __half> && !std::is_same_v<U, __half>)
+    {
+        // any -> half, same as any -> float clamped to the half range
+        constexpr float maxT = 65504.f;
+
+        float out = RangeCastImpl<float>(u);
+        return __float2half_rn(out <= -maxT ? -maxT : (out >= maxT ? maxT : out));
+    }
+    else if constexpr (std::is_floating_point_v<U> && std::is_floating_point_v<T> && sizeof(U) > sizeof(T))
     {
         // any-float -> any-float, big -> small
         return u <= -TypeTraits<T>::max ? -TypeTraits<T>::max
@@ -38,7 +38,17 @@ inline __host__ __device__ T BaseSaturateCastImpl(U u)
     (void)SmallToBig;
     (void)BigToSmall;
 
-    if constexpr (std::is_floating_point_v<U> && std::is_integral_v<T>)
+    if constexpr (std::is_same_v<U, __half> && !std::is_same_v<T, __half>)
+    {
+        // half -> any, goes through float as half has no host-side arithmetic
+        return BaseSaturateCastImpl<T>(__half2float(u));
+    }
+    else if constexpr (std::is_same_v<T, __half> && !std::is_same_v<U, __half>)
+    {
+        // any -> half, rounds to nearest as any -> any-float, values out of range become infinity
+        return __float2half_rn(static_cast<float>(u));
+    }
+    else if constexpr (std::is_floating_point_v<U> && std::is_integral_v<T>)
     {
         // any-float -> any-integral
         constexpr U minT = static_cast<U>(TypeTraits<T>::min);
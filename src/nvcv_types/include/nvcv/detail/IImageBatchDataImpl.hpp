@@ -92,6 +92,11 @@ inline const NVCVImageBufferStrided *IImageBatchVarShapeDataStrided::imageList()
     return this->cdata().buffer.varShapeStrided.imageList;
 }
 
+inline const uint8_t *IImageBatchVarShapeDataStrided::activeMask() const
+{
+    return this->cdata().buffer.varShapeStrided.activeMask;
+}
+
 // Implementation - IImageBatchVarShapeDataStridedCuda
 
 inline IImageBatchVarShapeDataStridedCuda::~IImageBatchVarShapeDataStridedCuda()
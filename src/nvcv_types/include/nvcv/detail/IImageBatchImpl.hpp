@@ -85,6 +85,7 @@ inline IImageBatch *IImageBatch::cast(HandleType h)
         switch (type)
         {
         case NVCV_TYPE_IMAGEBATCH_VARSHAPE:
+        case NVCV_TYPE_IMAGEBATCH_VARSHAPE_WRAPDATA:
             return detail::CastImpl<IImageBatchVarShape>(&nvcvImageBatchGetUserPointer, &nvcvImageBatchSetUserPointer,
                                                          h);
         default:
@@ -200,6 +201,11 @@ inline void IImageBatchVarShape::popBack(int32_t imgCount)
     detail::CheckThrow(nvcvImageBatchVarShapePopImages(this->handle(), imgCount));
 }
 
+inline void IImageBatchVarShape::setImage(int32_t index, const IImage &img)
+{
+    detail::CheckThrow(nvcvImageBatchVarShapeSetImage(this->handle(), index, img.handle()));
+}
+
 inline IImage &IImageBatchVarShape::operator[](ptrdiff_t n) const
 {
     NVCVImageHandle himg;
@@ -212,6 +218,11 @@ inline void IImageBatchVarShape::clear()
     detail::CheckThrow(nvcvImageBatchVarShapeClear(this->handle()));
 }
 
+inline void IImageBatchVarShape::setActiveMask(const ITensor *mask)
+{
+    detail::CheckThrow(nvcvImageBatchVarShapeSetActiveMask(this->handle(), mask ? mask->handle() : nullptr));
+}
+
 inline Size2D IImageBatchVarShape::maxSize() const
 {
     Size2D s;
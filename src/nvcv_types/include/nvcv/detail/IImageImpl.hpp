@@ -106,6 +106,11 @@ inline void *IImage::userPointer() const
     return ptr;
 }
 
+inline void IImage::setReleaseStream(CUstream stream)
+{
+    detail::CheckThrow(nvcvImageSetReleaseStream(this->handle(), stream));
+}
+
 } // namespace nvcv
 
 #endif // NVCV_IIMAGE_IMPL_HPP
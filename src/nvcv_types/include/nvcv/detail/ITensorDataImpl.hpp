@@ -117,6 +117,12 @@ inline ITensorDataStridedCuda::~ITensorDataStridedCuda()
     // required dtor implementation
 }
 
+// Implementation - ITensorDataStridedHost ----------------------------
+inline ITensorDataStridedHost::~ITensorDataStridedHost()
+{
+    // required dtor implementation
+}
+
 } // namespace nvcv
 
 #endif // NVCV_ITENSORDATA_IMPL_HPP
@@ -67,11 +67,25 @@ inline DataType ITensor::dtype() const
     return DataType{out};
 }
 
+inline int32_t ITensor::device() const
+{
+    int32_t device;
+    detail::CheckThrow(nvcvTensorGetDevice(this->handle(), &device));
+    return device;
+}
+
 inline const ITensorData *ITensor::exportData() const
 {
     NVCVTensorData data;
     detail::CheckThrow(nvcvTensorExportData(this->handle(), &data));
 
+    if (data.bufferType == NVCV_TENSOR_BUFFER_STRIDED_HOST)
+    {
+        m_cacheDataHost.emplace(TensorShape(data.shape, data.rank, data.layout), DataType{data.dtype},
+                                data.buffer.strided);
+        return &*m_cacheDataHost;
+    }
+
     if (data.bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA)
     {
         throw Exception(Status::ERROR_INVALID_OPERATION, "Tensor data cannot be exported, buffer type not supported");
@@ -99,6 +113,11 @@ inline void *ITensor::userPointer() const
     return ptr;
 }
 
+inline void ITensor::setReleaseStream(CUstream stream)
+{
+    detail::CheckThrow(nvcvTensorSetReleaseStream(this->handle(), stream));
+}
+
 } // namespace nvcv
 
 #endif // NVCV_ITENSOR_IMPL_HPP
@@ -49,11 +49,79 @@ inline ImageBatchVarShape::~ImageBatchVarShape()
     nvcvImageBatchDecRef(m_handle, nullptr);
 }
 
+inline void ImageBatchVarShape::constructImages(const std::vector<Size2D> &sizes, ImageFormat fmt)
+{
+    std::vector<int32_t> widths, heights;
+    widths.reserve(sizes.size());
+    heights.reserve(sizes.size());
+    for (const Size2D &size : sizes)
+    {
+        widths.push_back(size.w);
+        heights.push_back(size.h);
+    }
+
+    detail::CheckThrow(nvcvImageBatchVarShapeConstructImages(m_handle, widths.data(), heights.data(),
+                                                             static_cast<int32_t>(sizes.size()), fmt));
+}
+
 inline NVCVImageBatchHandle ImageBatchVarShape::doGetHandle() const
 {
     return m_handle;
 }
 
+// ImageBatchVarShapeSubrange implementation -----------------------
+
+inline ImageBatchVarShapeSubrange::ImageBatchVarShapeSubrange(const IImageBatchVarShape &parent, int32_t begIndex,
+                                                              int32_t numImages)
+{
+    detail::CheckThrow(nvcvImageBatchVarShapeSubrange(parent.handle(), begIndex, numImages, &m_handle));
+    detail::SetObjectAssociation(nvcvImageBatchSetUserPointer, this, m_handle);
+}
+
+inline ImageBatchVarShapeSubrange::~ImageBatchVarShapeSubrange()
+{
+    nvcvImageBatchDecRef(m_handle, nullptr);
+}
+
+inline NVCVImageBatchHandle ImageBatchVarShapeSubrange::doGetHandle() const
+{
+    return m_handle;
+}
+
+// ImageBatchVarShapeWrapData implementation -----------------------
+
+inline ImageBatchVarShapeWrapData::ImageBatchVarShapeWrapData(const IImageBatchVarShapeDataStridedCuda  &data,
+                                                              std::function<ImageBatchDataCleanupFunc> cleanup)
+    : m_cleanup(std::move(cleanup))
+{
+    detail::CheckThrow(
+        nvcvImageBatchVarShapeWrapDataConstruct(&data.cdata(), m_cleanup ? &doCleanup : nullptr, this, &m_handle));
+    detail::SetObjectAssociation(nvcvImageBatchSetUserPointer, this, m_handle);
+}
+
+inline ImageBatchVarShapeWrapData::~ImageBatchVarShapeWrapData()
+{
+    nvcvImageBatchDecRef(m_handle, nullptr);
+}
+
+inline NVCVImageBatchHandle ImageBatchVarShapeWrapData::doGetHandle() const
+{
+    return m_handle;
+}
+
+inline void ImageBatchVarShapeWrapData::doCleanup(void *ctx, const NVCVImageBatchData *data)
+{
+    assert(data != nullptr);
+
+    auto *this_ = reinterpret_cast<ImageBatchVarShapeWrapData *>(ctx);
+    assert(this_ != nullptr);
+
+    ImageBatchVarShapeDataStridedCuda batchData(*data);
+
+    assert(this_->m_cleanup != nullptr);
+    this_->m_cleanup(batchData);
+}
+
 } // namespace nvcv
 
 #endif // NVCV_IMAGEBATCH_IMPL_HPP
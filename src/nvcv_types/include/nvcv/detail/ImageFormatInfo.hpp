@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_DETAIL_IMAGEFORMATINFO_HPP
+#define NVCV_DETAIL_IMAGEFORMATINFO_HPP
+
+#include "../ImageFormat.h"
+#include "CheckError.hpp"
+#include "FormatUtils.h"
+
+#include <cstdint>
+
+namespace nvcv { namespace detail {
+
+// Fields stored verbatim in the NVCVImageFormat bitfield (see NVCV_DETAIL_MAKE_FMTTYPE), decoded without
+// going through the C API.  NVCVDataType shares the data kind field with NVCVImageFormat.
+constexpr NVCVSwizzle DecodeSwizzle(uint64_t fmt) noexcept
+{
+    return static_cast<NVCVSwizzle>(NVCV_DETAIL_GET_BITFIELD(fmt, 0, 4 * 3));
+}
+
+constexpr NVCVMemLayout DecodeMemLayout(uint64_t fmt) noexcept
+{
+    return static_cast<NVCVMemLayout>(NVCV_DETAIL_GET_BITFIELD(fmt, 12, 3));
+}
+
+constexpr NVCVDataKind DecodeDataKind(uint64_t fmt) noexcept
+{
+    return static_cast<NVCVDataKind>(NVCV_DETAIL_GET_BITFIELD(fmt, 61, 3));
+}
+
+// Image format properties queried by operators on every call.
+struct ImageFormatInfo
+{
+    NVCVImageFormat format;
+    bool            valid;
+    int32_t         numPlanes;
+    int32_t         numChannels;
+    NVCVDataType    planeDataType[4];
+    int32_t         planeNumChannels[4];
+    int32_t         planePixelStrideBytes[4];
+};
+
+inline void DecodeImageFormatInfo(NVCVImageFormat fmt, ImageFormatInfo &info)
+{
+    info.format = fmt;
+    CheckThrow(nvcvImageFormatGetNumPlanes(fmt, &info.numPlanes));
+    CheckThrow(nvcvImageFormatGetNumChannels(fmt, &info.numChannels));
+    for (int32_t p = 0; p < 4; ++p)
+    {
+        CheckThrow(nvcvImageFormatGetPlaneDataType(fmt, p, &info.planeDataType[p]));
+        CheckThrow(nvcvImageFormatGetPlaneNumChannels(fmt, p, &info.planeNumChannels[p]));
+        CheckThrow(nvcvImageFormatGetPlanePixelStrideBytes(fmt, p, &info.planePixelStrideBytes[p]));
+    }
+    info.valid = true;
+}
+
+// Returns the properties of the given format.  They're decoded by the C API the first time the calling thread
+// sees the format, and kept in a small direct-mapped table afterwards, where formats that land on the same slot
+// replace each other.  Applications use a handful of formats, so the hot path is one table lookup.
+inline const ImageFormatInfo &GetImageFormatInfo(NVCVImageFormat fmt)
+{
+    constexpr int kNumSlots = 64;
+
+    static thread_local ImageFormatInfo table[kNumSlots];
+
+    uint64_t hash = static_cast<uint64_t>(fmt);
+    hash ^= hash >> 29;
+    hash *= 0x9E3779B97F4A7C15ull;
+
+    ImageFormatInfo &info = table[hash >> 58];
+    if (!info.valid || info.format != fmt)
+    {
+        info.valid = false;
+        DecodeImageFormatInfo(fmt, info);
+    }
+    return info;
+}
+
+}} // namespace nvcv::detail
+
+#endif // NVCV_DETAIL_IMAGEFORMATINFO_HPP
@@ -88,6 +88,24 @@ inline void ImageWrapData::doCleanup(void *ctx, const NVCVImageData *data)
     this_->m_cleanup(*imgData);
 }
 
+// ImageRoi implementation -------------------------------------
+
+inline ImageRoi::ImageRoi(const IImage &parent, const NVCVRectI &roi)
+{
+    detail::CheckThrow(nvcvImageRoi(parent.handle(), &roi, &m_handle));
+    detail::SetObjectAssociation(nvcvImageSetUserPointer, this, m_handle);
+}
+
+inline ImageRoi::~ImageRoi()
+{
+    nvcvImageDecRef(m_handle, nullptr);
+}
+
+inline NVCVImageHandle ImageRoi::doGetHandle() const
+{
+    return m_handle;
+}
+
 } // namespace nvcv
 
 #endif // NVCV_IMAGE_IMPL_HPP
@@ -0,0 +1,222 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_IMAGEPOOL_IMPL_HPP
+#define NVCV_IMAGEPOOL_IMPL_HPP
+
+#ifndef NVCV_IMAGEPOOL_HPP
+#    error "You must not include this header directly"
+#endif
+
+#include <algorithm>
+
+namespace nvcv {
+
+// ImagePool::Impl implementation -------------------------------------
+
+class ImagePool::Impl
+{
+public:
+    // Buffer of a size class, with its layout.
+    struct Buffer
+    {
+        void               *ptr;
+        Image::Requirements reqs;
+        int64_t             sizeBytes;
+    };
+
+    Impl(IAllocator *alloc, const MemAlignment &bufAlign)
+        : m_defaultAlloc(alloc ? nullptr : std::unique_ptr<IAllocator>(new CustomAllocator<>()))
+        , m_alloc(alloc ? alloc : m_defaultAlloc.get())
+        , m_bufAlign(bufAlign)
+    {
+    }
+
+    ~Impl()
+    {
+        trim();
+    }
+
+    Buffer acquire(const Size2D &sizeClass, ImageFormat fmt)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto it = m_free.find(Key{fmt.cvalue(), sizeClass.w, sizeClass.h});
+            if (it != m_free.end() && !it->second.empty())
+            {
+                Buffer buf = it->second.back();
+                it->second.pop_back();
+                --m_numFree;
+                return buf;
+            }
+        }
+
+        Buffer buf;
+        buf.reqs      = Image::CalcRequirements(sizeClass, fmt, m_bufAlign);
+        buf.sizeBytes = 0;
+        for (int32_t p = 0; p < fmt.numPlanes(); ++p)
+        {
+            buf.sizeBytes += static_cast<int64_t>(buf.reqs.planeRowStride[p]) * fmt.planeSize(sizeClass, p).h;
+        }
+        buf.sizeBytes = (buf.sizeBytes + buf.reqs.alignBytes - 1) / buf.reqs.alignBytes * buf.reqs.alignBytes;
+
+        buf.ptr = m_alloc->cudaMem().alloc(buf.sizeBytes, buf.reqs.alignBytes);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_numBuffers;
+        return buf;
+    }
+
+    void release(const Buffer &buf)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_free[Key{buf.reqs.format, buf.reqs.width, buf.reqs.height}].push_back(buf);
+        ++m_numFree;
+    }
+
+    void trim()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (auto &entry : m_free)
+        {
+            for (const Buffer &buf : entry.second)
+            {
+                m_alloc->cudaMem().free(buf.ptr, buf.sizeBytes, buf.reqs.alignBytes);
+            }
+            m_numBuffers -= static_cast<int32_t>(entry.second.size());
+        }
+        m_free.clear();
+        m_numFree = 0;
+    }
+
+    int32_t numBuffers() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_numBuffers;
+    }
+
+    int32_t numFreeBuffers() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_numFree;
+    }
+
+private:
+    using Key = std::tuple<NVCVImageFormat, int32_t, int32_t>;
+
+    std::unique_ptr<IAllocator> m_defaultAlloc;
+    IAllocator                 *m_alloc;
+    MemAlignment                m_bufAlign;
+
+    mutable std::mutex                 m_mutex;
+    std::map<Key, std::vector<Buffer>> m_free;
+
+    int32_t m_numBuffers = 0;
+    int32_t m_numFree    = 0;
+};
+
+// ImagePool implementation -------------------------------------
+
+inline ImagePool::ImagePool(IAllocator *alloc, const MemAlignment &bufAlign)
+    : m_impl(std::make_shared<Impl>(alloc, bufAlign))
+{
+}
+
+inline ImagePool::~ImagePool() = default;
+
+inline Size2D ImagePool::CalcSizeClass(const Size2D &size)
+{
+    // Steps of 1/8th of the next power of two, images waste at most ~12% of each dimension.
+    auto calcClass = [](int32_t v)
+    {
+        int32_t pow2 = 1;
+        while (pow2 < v)
+        {
+            pow2 <<= 1;
+        }
+        int32_t step = std::max(pow2 / 8, 16);
+        return (v + step - 1) / step * step;
+    };
+
+    return {calcClass(size.w), calcClass(size.h)};
+}
+
+inline std::unique_ptr<ImageWrapData> ImagePool::acquire(const Size2D &size, ImageFormat fmt)
+{
+    if (size.w <= 0 || size.h <= 0)
+    {
+        throw Exception(Status::ERROR_INVALID_ARGUMENT, "Image size must be positive");
+    }
+
+    Impl::Buffer buf = m_impl->acquire(CalcSizeClass(size), fmt);
+
+    NVCVImageBufferStrided data = {};
+    data.numPlanes              = fmt.numPlanes();
+
+    // Planes are where they'd be for an image with the size class, so that any size in the class fits.
+    int64_t offset = 0;
+    for (int32_t p = 0; p < data.numPlanes; ++p)
+    {
+        Size2D planeSize = fmt.planeSize(size, p);
+
+        data.planes[p].width     = planeSize.w;
+        data.planes[p].height    = planeSize.h;
+        data.planes[p].rowStride = buf.reqs.planeRowStride[p];
+        data.planes[p].basePtr   = reinterpret_cast<NVCVByte *>(buf.ptr) + offset;
+
+        offset += static_cast<int64_t>(buf.reqs.planeRowStride[p])
+                * fmt.planeSize(Size2D{buf.reqs.width, buf.reqs.height}, p).h;
+    }
+
+    std::shared_ptr<Impl> impl    = m_impl;
+    auto                  cleanup = [impl, buf](const IImageData &)
+    {
+        impl->release(buf);
+    };
+
+    try
+    {
+        return std::unique_ptr<ImageWrapData>(new ImageWrapData(ImageDataStridedCuda{fmt, data}, cleanup));
+    }
+    catch (...)
+    {
+        impl->release(buf);
+        throw;
+    }
+}
+
+inline void ImagePool::trim()
+{
+    m_impl->trim();
+}
+
+inline int32_t ImagePool::numBuffers() const
+{
+    return m_impl->numBuffers();
+}
+
+inline int32_t ImagePool::numFreeBuffers() const
+{
+    return m_impl->numFreeBuffers();
+}
+
+} // namespace nvcv
+
+#endif // NVCV_IMAGEPOOL_IMPL_HPP
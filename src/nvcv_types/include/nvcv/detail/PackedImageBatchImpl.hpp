@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_PACKEDIMAGEBATCH_IMPL_HPP
+#define NVCV_PACKEDIMAGEBATCH_IMPL_HPP
+
+#ifndef NVCV_PACKEDIMAGEBATCH_HPP
+#    error "You must not include this header directly"
+#endif
+
+#include <algorithm>
+
+namespace nvcv {
+
+// PackedImageLayout implementation -------------------------------------
+
+inline PackedImageLayout CalcPackedImageLayout(const std::vector<Size2D> &sizes, ImageFormat fmt,
+                                               const MemAlignment &bufAlign)
+{
+    PackedImageLayout layout;
+    layout.reqs.reserve(sizes.size());
+    layout.offsets.reserve(sizes.size());
+
+    auto roundUp = [](int64_t value, int64_t align)
+    {
+        return (value + align - 1) / align * align;
+    };
+
+    for (const Size2D &size : sizes)
+    {
+        Image::Requirements reqs = Image::CalcRequirements(size, fmt, bufAlign);
+
+        int64_t sizeBytes = 0;
+        for (int32_t p = 0; p < fmt.numPlanes(); ++p)
+        {
+            sizeBytes += static_cast<int64_t>(reqs.planeRowStride[p]) * fmt.planeSize(size, p).h;
+        }
+
+        int64_t offset = roundUp(layout.totalSizeBytes, reqs.alignBytes);
+
+        layout.reqs.push_back(reqs);
+        layout.offsets.push_back(offset);
+        layout.totalSizeBytes = offset + sizeBytes;
+        layout.alignBytes     = std::max(layout.alignBytes, reqs.alignBytes);
+    }
+
+    layout.totalSizeBytes = roundUp(layout.totalSizeBytes, layout.alignBytes);
+
+    return layout;
+}
+
+// PackedImageBatchVarShape implementation -------------------------------------
+
+inline PackedImageBatchVarShape::PackedImageBatchVarShape(const std::vector<Size2D> &sizes, ImageFormat fmt,
+                                                          IAllocator *alloc, const MemAlignment &bufAlign)
+    : ImageBatchVarShape(static_cast<int32_t>(sizes.size()), alloc)
+    , m_defaultAlloc(alloc ? nullptr : std::unique_ptr<IAllocator>(new CustomAllocator<>()))
+    , m_alloc(alloc ? alloc : m_defaultAlloc.get())
+    , m_layout(CalcPackedImageLayout(sizes, fmt, bufAlign))
+    , m_buffer(nullptr)
+{
+    if (m_layout.totalSizeBytes == 0)
+    {
+        return;
+    }
+
+    m_buffer = m_alloc->cudaMem().alloc(m_layout.totalSizeBytes, m_layout.alignBytes);
+
+    try
+    {
+        m_images.reserve(sizes.size());
+        for (size_t i = 0; i < sizes.size(); ++i)
+        {
+            const Image::Requirements &reqs = m_layout.reqs[i];
+
+            NVCVImageBufferStrided buf = {};
+            buf.numPlanes              = fmt.numPlanes();
+
+            int64_t offset = m_layout.offsets[i];
+            for (int32_t p = 0; p < buf.numPlanes; ++p)
+            {
+                Size2D planeSize = fmt.planeSize(sizes[i], p);
+
+                buf.planes[p].width     = planeSize.w;
+                buf.planes[p].height    = planeSize.h;
+                buf.planes[p].rowStride = reqs.planeRowStride[p];
+                buf.planes[p].basePtr   = reinterpret_cast<NVCVByte *>(m_buffer) + offset;
+
+                offset += static_cast<int64_t>(reqs.planeRowStride[p]) * planeSize.h;
+            }
+
+            m_images.emplace_back(new ImageWrapData(ImageDataStridedCuda{fmt, buf}));
+        }
+
+        this->pushBack(m_images.begin(), m_images.end());
+    }
+    catch (...)
+    {
+        this->clear();
+        m_images.clear();
+        m_alloc->cudaMem().free(m_buffer, m_layout.totalSizeBytes, m_layout.alignBytes);
+        throw;
+    }
+}
+
+inline PackedImageBatchVarShape::~PackedImageBatchVarShape()
+{
+    // Images are only wrappers, the batch must not refer to them once they're gone
+    this->clear();
+    m_images.clear();
+
+    if (m_buffer != nullptr)
+    {
+        m_alloc->cudaMem().free(m_buffer, m_layout.totalSizeBytes, m_layout.alignBytes);
+    }
+}
+
+inline const PackedImageLayout &PackedImageBatchVarShape::layout() const noexcept
+{
+    return m_layout;
+}
+
+inline void *PackedImageBatchVarShape::buffer() const noexcept
+{
+    return m_buffer;
+}
+
+} // namespace nvcv
+
+#endif // NVCV_PACKEDIMAGEBATCH_IMPL_HPP
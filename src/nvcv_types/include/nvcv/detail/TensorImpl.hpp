@@ -123,6 +123,60 @@ inline NVCVTensorHandle TensorWrapImage::doGetHandle() const
     return m_handle;
 }
 
+// GrowableTensor implementation -------------------------------------
+
+inline GrowableTensor::GrowableTensor(const Tensor::Requirements &reqs, int64_t maxOuterSize)
+{
+    detail::CheckThrow(nvcvTensorConstructGrowable(&reqs, maxOuterSize, &m_handle));
+    detail::SetObjectAssociation(nvcvTensorSetUserPointer, this, m_handle);
+}
+
+inline GrowableTensor::GrowableTensor(const TensorShape &shape, DataType dtype, int64_t maxOuterSize,
+                                      const MemAlignment &bufAlign)
+    : GrowableTensor(Tensor::CalcRequirements(shape, dtype, bufAlign), maxOuterSize)
+{
+}
+
+inline GrowableTensor::~GrowableTensor()
+{
+    nvcvTensorDecRef(m_handle, nullptr);
+}
+
+inline void GrowableTensor::setOuterSize(int64_t outerSize)
+{
+    detail::CheckThrow(nvcvTensorSetOuterSize(m_handle, outerSize));
+}
+
+inline int64_t GrowableTensor::maxOuterSize() const
+{
+    int64_t out;
+    detail::CheckThrow(nvcvTensorGetMaxOuterSize(m_handle, &out));
+    return out;
+}
+
+inline NVCVTensorHandle GrowableTensor::doGetHandle() const
+{
+    return m_handle;
+}
+
+// TensorSlice implementation -------------------------------------
+
+inline TensorSlice::TensorSlice(const ITensor &parent, int32_t dim, int64_t begin, int64_t end)
+{
+    detail::CheckThrow(nvcvTensorSlice(parent.handle(), dim, begin, end, &m_handle));
+    detail::SetObjectAssociation(nvcvTensorSetUserPointer, this, m_handle);
+}
+
+inline TensorSlice::~TensorSlice()
+{
+    nvcvTensorDecRef(m_handle, nullptr);
+}
+
+inline NVCVTensorHandle TensorSlice::doGetHandle() const
+{
+    return m_handle;
+}
+
 } // namespace nvcv
 
 #endif // NVCV_TENSOR_IMPL_HPP
@@ -21,12 +21,13 @@
 #include "CustomAllocator.hpp"
 #include "DefaultAllocator.hpp"
 #include "IContext.hpp"
+#include "PoolAllocator.hpp"
 
 namespace nvcv::priv {
 
 using AllocatorManager = CoreObjManager<NVCVAllocatorHandle>;
 
-using AllocatorStorage = CompatibleStorage<DefaultAllocator, CustomAllocator>;
+using AllocatorStorage = CompatibleStorage<DefaultAllocator, CustomAllocator, PoolAllocator>;
 
 template<>
 class CoreObjManager<NVCVAllocatorHandle> : public HandleManager<IAllocator, AllocatorStorage>
@@ -188,6 +188,8 @@ std::ostream &operator<<(std::ostream &out, ColorSpec cspec)
         ENUM_CASE(NVCV_COLOR_SPEC_BT2020_LINEAR);
         ENUM_CASE(NVCV_COLOR_SPEC_BT2020_PQ);
         ENUM_CASE(NVCV_COLOR_SPEC_BT2020_PQ_ER);
+        ENUM_CASE(NVCV_COLOR_SPEC_BT2020_HLG);
+        ENUM_CASE(NVCV_COLOR_SPEC_BT2020_HLG_ER);
         ENUM_CASE(NVCV_COLOR_SPEC_BT2020c);
         ENUM_CASE(NVCV_COLOR_SPEC_BT2020c_ER);
         ENUM_CASE(NVCV_COLOR_SPEC_SMPTE240M);
@@ -386,6 +388,7 @@ const char *GetName(NVCVColorTransferFunction xferFunc)
         ENUM_CASE(NVCV_COLOR_XFER_BT709);
         ENUM_CASE(NVCV_COLOR_XFER_BT2020);
         ENUM_CASE(NVCV_COLOR_XFER_SMPTE240M);
+        ENUM_CASE(NVCV_COLOR_XFER_HLG);
 #undef ENUM_CASE
     }
 
@@ -0,0 +1,178 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CompressibleAllocator.hpp"
+
+#include "DriverVMM.hpp"
+
+#include <cuda_runtime.h>
+#include <util/CheckError.hpp>
+#include <util/Math.hpp>
+
+namespace nvcv::priv {
+
+CompressibleAllocator::CompressibleAllocator(const NVCVCompressibleAllocatorParams *params)
+    : m_compressible(false)
+    , m_granularity(0)
+    , m_minSize(params ? params->minSize : 0)
+{
+    NVCV_CHECK_THROW(cudaGetDevice(&m_device));
+
+    // Devices or drivers without virtual memory management or compression
+    // can still use the allocator, it then behaves as the default one.
+    try
+    {
+        const DriverVMM &drv = GetDriverVMM();
+
+        int vmm = 0, compression = 0;
+        CheckDriver(drv.deviceGetAttribute(&vmm, CU_DEVICE_ATTRIBUTE_VIRTUAL_MEMORY_MANAGEMENT_SUPPORTED, m_device),
+                    "cuDeviceGetAttribute");
+        CheckDriver(drv.deviceGetAttribute(&compression, CU_DEVICE_ATTRIBUTE_GENERIC_COMPRESSION_SUPPORTED, m_device),
+                    "cuDeviceGetAttribute");
+
+        if (vmm && compression)
+        {
+            CUmemAllocationProp prop = DeviceAllocationProp(m_device, true);
+
+            size_t granularity = 0;
+            CheckDriver(drv.memGetAllocationGranularity(&granularity, &prop, CU_MEM_ALLOC_GRANULARITY_RECOMMENDED),
+                        "cuMemGetAllocationGranularity");
+
+            m_granularity  = granularity;
+            m_compressible = granularity > 0;
+        }
+    }
+    catch (const Exception &)
+    {
+        m_compressible = false;
+    }
+
+    if (!m_compressible && params && params->requireCompression)
+    {
+        throw Exception(NVCV_ERROR_NOT_COMPATIBLE, "Device %d doesn't support compressible memory", m_device);
+    }
+
+    if (m_minSize == 0)
+    {
+        m_minSize = m_granularity;
+    }
+}
+
+bool CompressibleAllocator::compressible() const noexcept
+{
+    return m_compressible;
+}
+
+bool CompressibleAllocator::isMapped(int64_t size) const noexcept
+{
+    return m_compressible && size >= m_minSize;
+}
+
+void *CompressibleAllocator::doAllocHostMem(int64_t size, int32_t align)
+{
+    return GetDefaultAllocator().allocHostMem(size, align);
+}
+
+void CompressibleAllocator::doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept
+{
+    GetDefaultAllocator().freeHostMem(ptr, size, align);
+}
+
+void *CompressibleAllocator::doAllocHostPinnedMem(int64_t size, int32_t align, uint32_t flags)
+{
+    return GetDefaultAllocator().allocHostPinnedMem(size, align, flags);
+}
+
+void CompressibleAllocator::doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept
+{
+    GetDefaultAllocator().freeHostPinnedMem(ptr, size, align, flags);
+}
+
+void *CompressibleAllocator::doAllocCudaMem(int64_t size, int32_t align)
+{
+    if (!this->isMapped(size))
+    {
+        return GetDefaultAllocator().allocCudaMem(size, align);
+    }
+
+    if (align > m_granularity)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Alignment of %d bytes is larger than the granularity, %ld bytes",
+                        align, m_granularity);
+    }
+
+    const DriverVMM &drv    = GetDriverVMM();
+    const int64_t    mapped = util::RoundUp(size, m_granularity);
+
+    // Compressible memory is a limited resource, once it's exhausted the
+    // allocation is still mapped the same way, only uncompressed.
+    CUmemAllocationProp          prop = DeviceAllocationProp(m_device, true);
+    CUmemGenericAllocationHandle mem;
+    if (drv.memCreate(&mem, mapped, &prop, 0) != CUDA_SUCCESS)
+    {
+        prop = DeviceAllocationProp(m_device, false);
+        CheckDriver(drv.memCreate(&mem, mapped, &prop, 0), "cuMemCreate");
+    }
+
+    CUdeviceptr ptr = 0;
+    try
+    {
+        CheckDriver(drv.memAddressReserve(&ptr, mapped, m_granularity, 0, 0), "cuMemAddressReserve");
+        CheckDriver(drv.memMap(ptr, mapped, 0, mem, 0), "cuMemMap");
+
+        CUmemAccessDesc access = {};
+        access.location        = prop.location;
+        access.flags           = CU_MEM_ACCESS_FLAGS_PROT_READWRITE;
+        CheckDriver(drv.memSetAccess(ptr, mapped, &access, 1), "cuMemSetAccess");
+    }
+    catch (...)
+    {
+        if (ptr != 0)
+        {
+            drv.memUnmap(ptr, mapped);
+            drv.memAddressFree(ptr, mapped);
+        }
+        drv.memRelease(mem);
+        throw;
+    }
+
+    // The mapping keeps the memory alive until it's unmapped.
+    drv.memRelease(mem);
+
+    return reinterpret_cast<void *>(ptr);
+}
+
+void CompressibleAllocator::doFreeCudaMem(void *ptr, int64_t size, int32_t align) noexcept
+{
+    if (!this->isMapped(size))
+    {
+        GetDefaultAllocator().freeCudaMem(ptr, size, align);
+        return;
+    }
+
+    const DriverVMM  &drv    = GetDriverVMM();
+    const int64_t     mapped = util::RoundUp(size, m_granularity);
+    const CUdeviceptr dptr   = reinterpret_cast<CUdeviceptr>(ptr);
+
+    // Unlike cudaFree, unmapping doesn't wait for the work using the memory.
+    NVCV_CHECK_LOG(cudaDeviceSynchronize());
+
+    drv.memUnmap(dptr, mapped);
+    drv.memAddressFree(dptr, mapped);
+}
+
+} // namespace nvcv::priv
@@ -48,6 +48,21 @@ IAllocator &Context::allocDefault()
     return m_allocDefault;
 }
 
+DeferredReleaseQueue &Context::deferredRelease()
+{
+    return m_deferredRelease;
+}
+
+StagingRing &Context::stagingRing()
+{
+    return m_stagingRing;
+}
+
+IpcRegistry &Context::ipcRegistry()
+{
+    return m_ipcRegistry;
+}
+
 auto Context::managerList() const -> const Managers &
 {
     return m_managerList;
@@ -20,9 +20,12 @@
 
 #include "AllocatorManager.hpp"
 #include "DefaultAllocator.hpp"
+#include "DeferredRelease.hpp"
 #include "IContext.hpp"
 #include "ImageBatchManager.hpp"
 #include "ImageManager.hpp"
+#include "IpcRegistry.hpp"
+#include "StagingRing.hpp"
 #include "TensorManager.hpp"
 
 namespace nvcv::priv {
@@ -36,13 +39,20 @@ public:
     const Managers &managerList() const override;
     IAllocator     &allocDefault() override;
 
+    DeferredReleaseQueue &deferredRelease() override;
+    StagingRing          &stagingRing() override;
+    IpcRegistry          &ipcRegistry() override;
+
 private:
     // Order is important due to inter-dependencies
-    DefaultAllocator  m_allocDefault;
-    AllocatorManager  m_allocatorManager;
-    ImageManager      m_imageManager;
-    ImageBatchManager m_imageBatchManager;
-    TensorManager     m_tensorManager;
+    DefaultAllocator     m_allocDefault;
+    DeferredReleaseQueue m_deferredRelease; // flushed after all objects, before the default allocator goes
+    IpcRegistry          m_ipcRegistry;     // imported objects unmap their memory from it
+    AllocatorManager     m_allocatorManager;
+    ImageManager         m_imageManager;
+    ImageBatchManager    m_imageBatchManager;
+    TensorManager        m_tensorManager;
+    StagingRing          m_stagingRing;
 
     Managers m_managerList;
 };
@@ -18,6 +18,8 @@
 #include "CustomAllocator.hpp"
 
 #include "DefaultAllocator.hpp"
+#include "DeferredRelease.hpp"
+#include "IContext.hpp"
 
 #include <cuda_runtime.h>
 #include <nvcv/Version.h>
@@ -28,8 +30,19 @@
 
 namespace nvcv::priv {
 
-CustomAllocator::CustomAllocator(const NVCVCustomAllocator *customAllocators, int32_t numCustomAllocators)
+CustomAllocator::CustomAllocator(const NVCVCustomAllocator *customAllocators, int32_t numCustomAllocators,
+                                 const NVCVCustomCudaMemAsyncAllocator *cudaAsync)
 {
+    if (cudaAsync != nullptr)
+    {
+        if (cudaAsync->fnAlloc == nullptr || cudaAsync->fnFree == nullptr)
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                            "Stream-ordered cuda memory allocation and deallocation functions must not be NULL");
+        }
+        m_cudaAsync = *cudaAsync;
+    }
+
     if (customAllocators == nullptr && numCustomAllocators != 0)
     {
         throw Exception(NVCV_ERROR_INVALID_ARGUMENT,
@@ -73,6 +86,12 @@ CustomAllocator::CustomAllocator(const NVCVCustomAllocator *customAllocators, in
             throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Memory type '%d' is not understood", (int)custAlloc.resType);
         }
 
+        if (m_cudaAsync && custAlloc.resType == NVCV_RESOURCE_MEM_CUDA)
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                            "Custom cuda memory allocator can't be defined along with a stream-ordered one");
+        }
+
         if (filledMap & (1 << custAlloc.resType))
         {
             throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
@@ -81,6 +100,11 @@ CustomAllocator::CustomAllocator(const NVCVCustomAllocator *customAllocators, in
 
         m_allocators[custAlloc.resType] = custAlloc;
         filledMap |= 1 << custAlloc.resType;
+
+        if (custAlloc.resType == NVCV_RESOURCE_MEM_HOST_PINNED)
+        {
+            m_hasCustomHostPinnedMem = true;
+        }
     }
 
     // Now go through all allocators, find the ones that aren't customized
@@ -157,6 +181,12 @@ CustomAllocator::CustomAllocator(const NVCVCustomAllocator *customAllocators, in
                 && "Some allocators weren't filled in");
 }
 
+CustomAllocator::~CustomAllocator()
+{
+    // Memory of destroyed objects might still be waiting to come back.
+    GlobalContext().deferredRelease().flush(this);
+}
+
 // Host Memory ------------------
 
 void *CustomAllocator::doAllocHostMem(int64_t size, int32_t align)
@@ -175,15 +205,25 @@ void CustomAllocator::doFreeHostMem(void *ptr, int64_t size, int32_t align) noex
 
 // Host Pinned Memory ------------------
 
-void *CustomAllocator::doAllocHostPinnedMem(int64_t size, int32_t align)
+void *CustomAllocator::doAllocHostPinnedMem(int64_t size, int32_t align, uint32_t flags)
 {
+    if (!m_hasCustomHostPinnedMem)
+    {
+        return GetDefaultAllocator().allocHostPinnedMem(size, align, flags);
+    }
+
     NVCVCustomAllocator &custom = m_allocators[NVCV_RESOURCE_MEM_HOST_PINNED];
     NVCV_ASSERT(custom.res.mem.fnAlloc != nullptr);
     return custom.res.mem.fnAlloc(custom.ctx, size, align);
 }
 
-void CustomAllocator::doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align) noexcept
+void CustomAllocator::doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept
 {
+    if (!m_hasCustomHostPinnedMem)
+    {
+        return GetDefaultAllocator().freeHostPinnedMem(ptr, size, align, flags);
+    }
+
     NVCVCustomAllocator &custom = m_allocators[NVCV_RESOURCE_MEM_HOST_PINNED];
     NVCV_ASSERT(custom.res.mem.fnFree != nullptr);
     return custom.res.mem.fnFree(custom.ctx, ptr, size, align);
@@ -193,6 +233,11 @@ void CustomAllocator::doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align
 
 void *CustomAllocator::doAllocCudaMem(int64_t size, int32_t align)
 {
+    if (m_cudaAsync)
+    {
+        return m_cudaAsync->fnAlloc(m_cudaAsync->ctx, size, align, nullptr);
+    }
+
     NVCVCustomAllocator &custom = m_allocators[NVCV_RESOURCE_MEM_CUDA];
     NVCV_ASSERT(custom.res.mem.fnAlloc != nullptr);
     return custom.res.mem.fnAlloc(custom.ctx, size, align);
@@ -200,9 +245,31 @@ void *CustomAllocator::doAllocCudaMem(int64_t size, int32_t align)
 
 void CustomAllocator::doFreeCudaMem(void *ptr, int64_t size, int32_t align) noexcept
 {
+    if (m_cudaAsync)
+    {
+        return m_cudaAsync->fnFree(m_cudaAsync->ctx, ptr, size, align, nullptr);
+    }
+
     NVCVCustomAllocator &custom = m_allocators[NVCV_RESOURCE_MEM_CUDA];
     NVCV_ASSERT(custom.res.mem.fnFree != nullptr);
     return custom.res.mem.fnFree(custom.ctx, ptr, size, align);
 }
 
+bool CustomAllocator::doIsStreamOrdered() const noexcept
+{
+    return m_cudaAsync.has_value();
+}
+
+void *CustomAllocator::doAllocCudaMemAsync(int64_t size, int32_t align, cudaStream_t stream)
+{
+    NVCV_ASSERT(m_cudaAsync);
+    return m_cudaAsync->fnAlloc(m_cudaAsync->ctx, size, align, stream);
+}
+
+void CustomAllocator::doFreeCudaMemAsync(void *ptr, int64_t size, int32_t align, cudaStream_t stream) noexcept
+{
+    NVCV_ASSERT(m_cudaAsync);
+    m_cudaAsync->fnFree(m_cudaAsync->ctx, ptr, size, align, stream);
+}
+
 } // namespace nvcv::priv
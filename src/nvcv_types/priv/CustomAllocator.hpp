@@ -22,24 +22,39 @@
 
 #include <nvcv/alloc/Allocator.h>
 
+#include <optional>
+
 namespace nvcv::priv {
 
 class CustomAllocator final : public CoreObjectBase<IAllocator>
 {
 public:
-    CustomAllocator(const NVCVCustomAllocator *customAllocators, int32_t numCustomAllocators);
+    // If cudaAsync isn't NULL, cuda memory is allocated in stream order with it.
+    CustomAllocator(const NVCVCustomAllocator *customAllocators, int32_t numCustomAllocators,
+                    const NVCVCustomCudaMemAsyncAllocator *cudaAsync = nullptr);
+    ~CustomAllocator();
 
 private:
     NVCVCustomAllocator m_allocators[NVCV_NUM_RESOURCE_TYPES];
 
+    std::optional<NVCVCustomCudaMemAsyncAllocator> m_cudaAsync;
+
+    // User-defined allocation functions don't take host-pinned memory flags,
+    // we can only honor them when using the default allocator.
+    bool m_hasCustomHostPinnedMem = false;
+
     void *doAllocHostMem(int64_t size, int32_t align) override;
     void  doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept override;
 
-    void *doAllocHostPinnedMem(int64_t size, int32_t align) override;
-    void  doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align) noexcept override;
+    void *doAllocHostPinnedMem(int64_t size, int32_t align, uint32_t flags) override;
+    void  doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept override;
 
     void *doAllocCudaMem(int64_t size, int32_t align) override;
     void  doFreeCudaMem(void *ptr, int64_t size, int32_t align) noexcept override;
+
+    bool  doIsStreamOrdered() const noexcept override;
+    void *doAllocCudaMemAsync(int64_t size, int32_t align, cudaStream_t stream) override;
+    void  doFreeCudaMemAsync(void *ptr, int64_t size, int32_t align, cudaStream_t stream) noexcept override;
 };
 
 } // namespace nvcv::priv
@@ -111,6 +111,11 @@ std::ostream &operator<<(std::ostream &out, DataType type)
         NVCV_ENUM(NVCV_DATA_TYPE_3S16);
         NVCV_ENUM(NVCV_DATA_TYPE_4S16);
 
+        NVCV_ENUM(NVCV_DATA_TYPE_F16);
+        NVCV_ENUM(NVCV_DATA_TYPE_2F16);
+        NVCV_ENUM(NVCV_DATA_TYPE_3F16);
+        NVCV_ENUM(NVCV_DATA_TYPE_4F16);
+
         NVCV_ENUM(NVCV_DATA_TYPE_U32);
         NVCV_ENUM(NVCV_DATA_TYPE_2U32);
         NVCV_ENUM(NVCV_DATA_TYPE_3U32);
@@ -17,6 +17,8 @@
 
 #include "DefaultAllocator.hpp"
 
+#include "NumaNode.hpp"
+
 #include <cuda_runtime.h>
 #include <nvcv/Version.h>
 #include <util/CheckError.hpp>
@@ -38,10 +40,13 @@ void DefaultAllocator::doFreeHostMem(void *ptr, int64_t size, int32_t align) noe
     std::free(ptr);
 }
 
-void *DefaultAllocator::doAllocHostPinnedMem(int64_t size, int32_t align)
+void *DefaultAllocator::doAllocHostPinnedMem(int64_t size, int32_t align, uint32_t flags)
 {
+    // Pages are placed when cudaHostAlloc pins them.
+    NumaNodeScope numa(flags & NVCV_HOST_PINNED_MEM_NUMA_LOCAL ? GetCurrentDeviceNumaNode() : -1);
+
     void *ptr = nullptr;
-    NVCV_CHECK_THROW(::cudaHostAlloc(&ptr, size, cudaHostAllocWriteCombined | cudaHostAllocMapped));
+    NVCV_CHECK_THROW(::cudaHostAlloc(&ptr, size, GetCudaHostAllocFlags(flags)));
     // TODO: can we do better than this?
     if (reinterpret_cast<uintptr_t>(ptr) % align != 0)
     {
@@ -52,10 +57,11 @@ void *DefaultAllocator::doAllocHostPinnedMem(int64_t size, int32_t align)
     return ptr;
 }
 
-void DefaultAllocator::doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align) noexcept
+void DefaultAllocator::doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept
 {
     (void)size;
     (void)align;
+    (void)flags;
 
     NVCV_CHECK_LOG(::cudaFreeHost(ptr));
 }
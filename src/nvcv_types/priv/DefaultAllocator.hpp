@@ -28,8 +28,8 @@ private:
     void *doAllocHostMem(int64_t size, int32_t align) override;
     void  doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept override;
 
-    void *doAllocHostPinnedMem(int64_t size, int32_t align) override;
-    void  doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align) noexcept override;
+    void *doAllocHostPinnedMem(int64_t size, int32_t align, uint32_t flags) override;
+    void  doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept override;
 
     void *doAllocCudaMem(int64_t size, int32_t align) override;
     void  doFreeCudaMem(void *ptr, int64_t size, int32_t align) noexcept override;
@@ -0,0 +1,227 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeferredRelease.hpp"
+
+#include "IAllocator.hpp"
+#include "IContext.hpp"
+
+#include <util/Assert.h>
+#include <util/CheckError.hpp>
+
+#include <algorithm>
+
+namespace nvcv::priv {
+
+namespace {
+
+thread_local int t_completedWorkDepth = 0;
+
+// Marks the blocks freed in its scope as not used by any pending work.
+class CompletedWorkScope
+{
+public:
+    CompletedWorkScope() noexcept
+    {
+        ++t_completedWorkDepth;
+    }
+
+    ~CompletedWorkScope()
+    {
+        --t_completedWorkDepth;
+    }
+};
+
+void FreeBlocks(const MemRelease *blocks, int numBlocks) noexcept
+{
+    CompletedWorkScope scope;
+
+    for (int i = 0; i < numBlocks; ++i)
+    {
+        const MemRelease &b = blocks[i];
+        switch (b.kind)
+        {
+        case MemRelease::CUDA:
+            b.alloc->freeCudaMem(b.ptr, b.size, b.align);
+            break;
+        case MemRelease::HOST_PINNED:
+            b.alloc->freeHostPinnedMem(b.ptr, b.size, b.align);
+            break;
+        }
+    }
+}
+
+} // namespace
+
+DeferredReleaseQueue::~DeferredReleaseQueue()
+{
+    this->flush();
+
+    for (cudaEvent_t ev : m_freeEvents)
+    {
+        NVCV_CHECK_LOG(cudaEventDestroy(ev));
+    }
+}
+
+bool DeferredReleaseQueue::defer(cudaStream_t stream, std::initializer_list<MemRelease> blocks) noexcept
+{
+    NVCV_ASSERT(0 < blocks.size() && blocks.size() <= kMaxBlocksPerRelease);
+
+    // Memory whose work is done can be reused by whoever allocates next.
+    this->poll();
+
+    std::lock_guard lock(m_mtx);
+
+    Pending p;
+    p.numBlocks = blocks.size();
+    std::copy(blocks.begin(), blocks.end(), p.blocks.begin());
+
+    if (!m_freeEvents.empty())
+    {
+        p.ev = m_freeEvents.back();
+        m_freeEvents.pop_back();
+    }
+    else if (!NVCV_CHECK_LOG(cudaEventCreateWithFlags(&p.ev, cudaEventDisableTiming)))
+    {
+        return false;
+    }
+
+    if (!NVCV_CHECK_LOG(cudaEventRecord(p.ev, stream)))
+    {
+        NVCV_CHECK_LOG(cudaEventDestroy(p.ev));
+        return false;
+    }
+
+    try
+    {
+        m_pending.push_back(p);
+    }
+    catch (...)
+    {
+        NVCV_CHECK_LOG(cudaEventDestroy(p.ev));
+        return false;
+    }
+
+    m_numPending.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+template<class Pred>
+void DeferredReleaseQueue::doRelease(Pred &&mustRelease, bool wait) noexcept
+{
+    std::lock_guard lock(m_mtx);
+
+    for (size_t i = 0; i < m_pending.size();)
+    {
+        if (!mustRelease(m_pending[i]))
+        {
+            ++i;
+            continue;
+        }
+
+        if (wait)
+        {
+            NVCV_CHECK_LOG(cudaEventSynchronize(m_pending[i].ev));
+        }
+        else if (cudaError_t err = cudaEventQuery(m_pending[i].ev); err == cudaErrorNotReady)
+        {
+            ++i;
+            continue;
+        }
+        else
+        {
+            // Any other error means the work won't ever use the memory again.
+            NVCV_CHECK_LOG(err);
+        }
+
+        // Taken out of the list before freeing, allocators might end up deferring other releases.
+        Pending p    = m_pending[i];
+        m_pending[i] = m_pending.back();
+        m_pending.pop_back();
+        m_numPending.fetch_sub(1, std::memory_order_relaxed);
+
+        FreeBlocks(p.blocks.data(), p.numBlocks);
+
+        try
+        {
+            m_freeEvents.push_back(p.ev);
+        }
+        catch (...)
+        {
+            NVCV_CHECK_LOG(cudaEventDestroy(p.ev));
+        }
+    }
+}
+
+void DeferredReleaseQueue::poll() noexcept
+{
+    // Most of the time there's nothing pending, don't contend on the lock then.
+    if (m_numPending.load(std::memory_order_relaxed) > 0)
+    {
+        this->doRelease([](const Pending &) { return true; }, false);
+    }
+}
+
+void DeferredReleaseQueue::flush(const IAllocator *alloc) noexcept
+{
+    this->doRelease(
+        [alloc](const Pending &p)
+        {
+            return alloc == nullptr
+                || std::any_of(p.blocks.begin(), p.blocks.begin() + p.numBlocks,
+                               [alloc](const MemRelease &b) { return b.alloc == alloc; });
+        },
+        true);
+}
+
+int64_t DeferredReleaseQueue::numPending() const noexcept
+{
+    return m_numPending.load(std::memory_order_relaxed);
+}
+
+void FreeCudaMem(IAllocator &alloc, void *ptr, int64_t size, int32_t align,
+                 const std::optional<cudaStream_t> &stream) noexcept
+{
+    if (stream && alloc.isStreamOrdered())
+    {
+        alloc.freeCudaMemAsync(ptr, size, align, *stream);
+        return;
+    }
+
+    if (stream)
+    {
+        if (GlobalContext().deferredRelease().defer(*stream, {{MemRelease::CUDA, &alloc, ptr, size, align}}))
+        {
+            return;
+        }
+        // Couldn't defer, make sure the work is done before giving it back.
+        if (NVCV_CHECK_LOG(cudaStreamSynchronize(*stream)))
+        {
+            CompletedWorkScope scope;
+            alloc.freeCudaMem(ptr, size, align);
+            return;
+        }
+    }
+    alloc.freeCudaMem(ptr, size, align);
+}
+
+bool IsReleasingCompletedWork() noexcept
+{
+    return t_completedWorkDepth > 0;
+}
+
+} // namespace nvcv::priv
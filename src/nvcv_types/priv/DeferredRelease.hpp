@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_DEFERRED_RELEASE_HPP
+#define NVCV_CORE_PRIV_DEFERRED_RELEASE_HPP
+
+#include <cuda_runtime.h>
+
+#include <array>
+#include <atomic>
+#include <initializer_list>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace nvcv::priv {
+
+class IAllocator;
+
+// Memory block to be given back to its allocator.
+struct MemRelease
+{
+    enum Kind
+    {
+        CUDA,
+        HOST_PINNED
+    };
+
+    Kind        kind;
+    IAllocator *alloc;
+    void       *ptr;
+    int64_t     size;
+    int32_t     align;
+};
+
+// Gives memory back to its allocator once the work that might still be using
+// it is done, without blocking the thread that releases it. An event is
+// recorded on the stream the memory was last used on, and the blocks are
+// freed by the first poll that finds it completed.
+class DeferredReleaseQueue
+{
+public:
+    static constexpr int kMaxBlocksPerRelease = 3;
+
+    ~DeferredReleaseQueue();
+
+    // Frees the blocks once all work submitted to stream so far is done.
+    // Returns false if they couldn't be deferred, e.g. stream isn't valid anymore,
+    // the caller must then make sure they aren't in use and free them itself.
+    bool defer(cudaStream_t stream, std::initializer_list<MemRelease> blocks) noexcept;
+
+    // Frees the blocks whose work is done.
+    void poll() noexcept;
+
+    // Waits for the pending releases of memory of the given allocator,
+    // or of all of them if nullptr, and frees their blocks.
+    void flush(const IAllocator *alloc = nullptr) noexcept;
+
+    // Number of releases still waiting for their work to be done.
+    int64_t numPending() const noexcept;
+
+private:
+    struct Pending
+    {
+        cudaEvent_t                                 ev;
+        std::array<MemRelease, kMaxBlocksPerRelease> blocks;
+        int                                         numBlocks;
+    };
+
+    // Allocators might release other objects when freeing memory, which end up here again.
+    mutable std::recursive_mutex m_mtx;
+
+    std::vector<Pending>     m_pending;
+    std::vector<cudaEvent_t> m_freeEvents; // completed, ready to be recorded again
+
+    std::atomic<int64_t> m_numPending = 0;
+
+    template<class Pred>
+    void doRelease(Pred &&mustRelease, bool wait) noexcept;
+};
+
+// Whether the blocks the calling thread is giving back to their allocator are
+// known not to be used by pending work anymore, i.e. the work on their release
+// stream was found done. Pools can then hand them out again right away.
+bool IsReleasingCompletedWork() noexcept;
+
+// Frees a block of cuda memory, once the work on stream is done if there's one.
+void FreeCudaMem(IAllocator &alloc, void *ptr, int64_t size, int32_t align,
+                 const std::optional<cudaStream_t> &stream) noexcept;
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_DEFERRED_RELEASE_HPP
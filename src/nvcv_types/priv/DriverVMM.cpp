@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DriverVMM.hpp"
+
+#include "Exception.hpp"
+
+#include <cuda_runtime.h>
+#include <util/CheckError.hpp>
+
+namespace nvcv::priv {
+
+namespace {
+
+template<class F>
+void GetDriverFunc(F &fn, const char *name)
+{
+    void *ptr = nullptr;
+#if CUDART_VERSION >= 12050
+    cudaDriverEntryPointQueryResult result;
+    NVCV_CHECK_THROW(cudaGetDriverEntryPointByVersion(name, &ptr, 11000, cudaEnableDefault, &result));
+#elif CUDART_VERSION >= 11030
+    NVCV_CHECK_THROW(cudaGetDriverEntryPoint(name, &ptr, cudaEnableDefault));
+#else
+    throw Exception(NVCV_ERROR_NOT_COMPATIBLE, "Virtual memory management requires CUDA 11.3 or later");
+#endif
+    if (ptr == nullptr)
+    {
+        throw Exception(NVCV_ERROR_NOT_COMPATIBLE, "Couldn't get %s from the cuda driver", name);
+    }
+    fn = reinterpret_cast<F>(ptr);
+}
+
+} // namespace
+
+const DriverVMM &GetDriverVMM()
+{
+    static const DriverVMM driver = []
+    {
+        DriverVMM d;
+        GetDriverFunc(d.deviceGetAttribute, "cuDeviceGetAttribute");
+        GetDriverFunc(d.memGetAllocationGranularity, "cuMemGetAllocationGranularity");
+        GetDriverFunc(d.memCreate, "cuMemCreate");
+        GetDriverFunc(d.memRelease, "cuMemRelease");
+        GetDriverFunc(d.memAddressReserve, "cuMemAddressReserve");
+        GetDriverFunc(d.memAddressFree, "cuMemAddressFree");
+        GetDriverFunc(d.memMap, "cuMemMap");
+        GetDriverFunc(d.memUnmap, "cuMemUnmap");
+        GetDriverFunc(d.memSetAccess, "cuMemSetAccess");
+        return d;
+    }();
+    return driver;
+}
+
+CUmemAllocationProp DeviceAllocationProp(int device, bool compressed)
+{
+    CUmemAllocationProp prop = {};
+    prop.type                = CU_MEM_ALLOCATION_TYPE_PINNED;
+    prop.location.type       = CU_MEM_LOCATION_TYPE_DEVICE;
+    prop.location.id         = device;
+    if (compressed)
+    {
+        prop.allocFlags.compressionType = CU_MEM_ALLOCATION_COMP_GENERIC;
+    }
+    return prop;
+}
+
+void CheckDriver(CUresult res, const char *stmt)
+{
+    if (res == CUDA_ERROR_OUT_OF_MEMORY)
+    {
+        throw Exception(NVCV_ERROR_OUT_OF_MEMORY, "%s: out of device memory", stmt);
+    }
+    else if (res != CUDA_SUCCESS)
+    {
+        throw Exception(NVCV_ERROR_INTERNAL, "%s failed with cuda driver error %d", stmt, (int)res);
+    }
+}
+
+} // namespace nvcv::priv
@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_DRIVER_VMM_HPP
+#define NVCV_CORE_PRIV_DRIVER_VMM_HPP
+
+#include <cuda.h>
+
+namespace nvcv::priv {
+
+// Virtual memory management functions, fetched from the driver so that we
+// don't need to link against it.
+struct DriverVMM
+{
+    decltype(&cuDeviceGetAttribute)          deviceGetAttribute;
+    decltype(&cuMemGetAllocationGranularity) memGetAllocationGranularity;
+    decltype(&cuMemCreate)                   memCreate;
+    decltype(&cuMemRelease)                  memRelease;
+    decltype(&cuMemAddressReserve)           memAddressReserve;
+    decltype(&cuMemAddressFree)              memAddressFree;
+    decltype(&cuMemMap)                      memMap;
+    decltype(&cuMemUnmap)                    memUnmap;
+    decltype(&cuMemSetAccess)                memSetAccess;
+};
+
+// Functions of the current driver, throws NVCV_ERROR_NOT_COMPATIBLE if it
+// doesn't have them.
+const DriverVMM &GetDriverVMM();
+
+// Properties of memory pinned on the given device, optionally compressible.
+CUmemAllocationProp DeviceAllocationProp(int device, bool compressed);
+
+// Throws an Exception if a driver call failed.
+void CheckDriver(CUresult res, const char *stmt);
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_DRIVER_VMM_HPP
@@ -0,0 +1,223 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GrowableTensor.hpp"
+
+#include "DriverVMM.hpp"
+#include "Exception.hpp"
+#include "IAllocator.hpp"
+
+#include <util/CheckError.hpp>
+#include <util/Math.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace nvcv::priv {
+
+GrowableTensor::GrowableTensor(const NVCVTensorRequirements &reqs, int64_t maxOuterSize)
+    : m_reqs(reqs)
+    , m_maxOuterSize(maxOuterSize)
+{
+    if (m_reqs.rank < 1)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Growable tensors must have at least one dimension");
+    }
+
+    if (maxOuterSize < m_reqs.shape[0])
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
+            << "Maximum outer size " << maxOuterSize << " must be >= the initial one, " << m_reqs.shape[0];
+    }
+
+    for (int i = 1; i < m_reqs.rank; ++i)
+    {
+        if (m_reqs.strides[i] * m_reqs.shape[i] > m_reqs.strides[0])
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Outermost dimension must have the largest stride");
+        }
+    }
+
+    NVCV_CHECK_THROW(cudaGetDevice(&m_device));
+
+    const DriverVMM &drv = GetDriverVMM();
+
+    int vmm = 0;
+    CheckDriver(drv.deviceGetAttribute(&vmm, CU_DEVICE_ATTRIBUTE_VIRTUAL_MEMORY_MANAGEMENT_SUPPORTED, m_device),
+                "cuDeviceGetAttribute");
+    if (!vmm)
+    {
+        throw Exception(NVCV_ERROR_NOT_COMPATIBLE, "Device %d doesn't support virtual memory management", m_device);
+    }
+
+    CUmemAllocationProp prop        = DeviceAllocationProp(m_device, false);
+    size_t              granularity = 0;
+    CheckDriver(drv.memGetAllocationGranularity(&granularity, &prop, CU_MEM_ALLOC_GRANULARITY_MINIMUM),
+                "cuMemGetAllocationGranularity");
+    m_granularity = std::max<int64_t>(granularity, m_reqs.alignBytes);
+
+    m_reservedSize = util::RoundUp(std::max<int64_t>(1, m_maxOuterSize * m_reqs.strides[0]), m_granularity);
+
+    CUdeviceptr ptr = 0;
+    CheckDriver(drv.memAddressReserve(&ptr, m_reservedSize, m_granularity, 0, 0), "cuMemAddressReserve");
+    m_basePtr = ptr;
+
+    try
+    {
+        this->map(m_reqs.shape[0] * m_reqs.strides[0]);
+    }
+    catch (...)
+    {
+        drv.memAddressFree(m_basePtr, m_reservedSize);
+        throw;
+    }
+}
+
+GrowableTensor::~GrowableTensor()
+{
+    const DriverVMM &drv = GetDriverVMM();
+
+    // Unmapping doesn't wait for the work still using the memory.
+    if (m_releaseStream)
+    {
+        NVCV_CHECK_LOG(cudaStreamSynchronize(*m_releaseStream));
+    }
+    else
+    {
+        NVCV_CHECK_LOG(cudaDeviceSynchronize());
+    }
+
+    int64_t offset = 0;
+    for (int64_t size : m_mappings)
+    {
+        drv.memUnmap(m_basePtr + offset, size);
+        offset += size;
+    }
+    drv.memAddressFree(m_basePtr, m_reservedSize);
+}
+
+void GrowableTensor::map(int64_t size)
+{
+    if (size <= m_mappedSize)
+    {
+        return;
+    }
+
+    // Mappings at least double what's mapped, so that growing one sample at
+    // a time doesn't make one mapping per sample.
+    const int64_t mapSize
+        = std::min(m_reservedSize - m_mappedSize,
+                   util::RoundUp(std::max(size - m_mappedSize, m_mappedSize), m_granularity));
+
+    const DriverVMM    &drv  = GetDriverVMM();
+    CUmemAllocationProp prop = DeviceAllocationProp(m_device, false);
+    const CUdeviceptr   ptr  = m_basePtr + m_mappedSize;
+
+    CUmemGenericAllocationHandle mem;
+    CheckDriver(drv.memCreate(&mem, mapSize, &prop, 0), "cuMemCreate");
+
+    CUresult res = drv.memMap(ptr, mapSize, 0, mem, 0);
+    // The mapping keeps the memory alive until it's unmapped.
+    drv.memRelease(mem);
+    CheckDriver(res, "cuMemMap");
+
+    CUmemAccessDesc access = {};
+    access.location        = prop.location;
+    access.flags           = CU_MEM_ACCESS_FLAGS_PROT_READWRITE;
+    res                    = drv.memSetAccess(ptr, mapSize, &access, 1);
+    if (res != CUDA_SUCCESS)
+    {
+        drv.memUnmap(ptr, mapSize);
+        CheckDriver(res, "cuMemSetAccess");
+    }
+
+    m_mappings.push_back(mapSize);
+    m_mappedSize += mapSize;
+}
+
+void GrowableTensor::setOuterSize(int64_t outerSize)
+{
+    if (outerSize < 0 || outerSize > m_maxOuterSize)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Outer size must be in [0, %ld], not %ld", m_maxOuterSize,
+                        outerSize);
+    }
+
+    std::unique_lock lk(m_mutex);
+
+    this->map(outerSize * m_reqs.strides[0]);
+    m_reqs.shape[0] = outerSize;
+}
+
+int64_t GrowableTensor::maxOuterSize() const
+{
+    return m_maxOuterSize;
+}
+
+void GrowableTensor::setReleaseStream(cudaStream_t stream)
+{
+    m_releaseStream = stream;
+}
+
+int32_t GrowableTensor::rank() const
+{
+    return m_reqs.rank;
+}
+
+const int64_t *GrowableTensor::shape() const
+{
+    return m_reqs.shape;
+}
+
+const NVCVTensorLayout &GrowableTensor::layout() const
+{
+    return m_reqs.layout;
+}
+
+DataType GrowableTensor::dtype() const
+{
+    return DataType{m_reqs.dtype};
+}
+
+IAllocator &GrowableTensor::alloc() const
+{
+    return GetDefaultAllocator();
+}
+
+int32_t GrowableTensor::device() const
+{
+    return m_device;
+}
+
+void GrowableTensor::exportData(NVCVTensorData &data) const
+{
+    std::unique_lock lk(m_mutex);
+
+    data.bufferType = NVCV_TENSOR_BUFFER_STRIDED_CUDA;
+
+    data.dtype  = m_reqs.dtype;
+    data.layout = m_reqs.layout;
+    data.rank   = m_reqs.rank;
+
+    memcpy(data.shape, m_reqs.shape, sizeof(data.shape));
+
+    NVCVTensorBufferStrided &buf = data.buffer.strided;
+    memcpy(buf.strides, m_reqs.strides, sizeof(buf.strides));
+    buf.basePtr = reinterpret_cast<NVCVByte *>(m_basePtr);
+}
+
+} // namespace nvcv::priv
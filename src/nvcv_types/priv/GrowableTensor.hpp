@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_GROWABLE_TENSOR_HPP
+#define NVCV_CORE_PRIV_GROWABLE_TENSOR_HPP
+
+#include "ITensor.hpp"
+
+#include <cuda_runtime.h>
+
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace nvcv::priv {
+
+// Tensor whose outermost dimension can change in place. It reserves the
+// address range of its maximum size and maps device memory on it as it
+// grows, so its base pointer never changes and no contents are copied.
+class GrowableTensor final : public CoreObjectBase<ITensor>
+{
+public:
+    explicit GrowableTensor(const NVCVTensorRequirements &reqs, int64_t maxOuterSize);
+    ~GrowableTensor();
+
+    // Sets the size of the outermost dimension, mapping memory if it doesn't
+    // fit in what's already mapped. Memory isn't unmapped when it shrinks.
+    void setOuterSize(int64_t outerSize);
+
+    int64_t maxOuterSize() const;
+
+    int32_t        rank() const override;
+    const int64_t *shape() const override;
+
+    const NVCVTensorLayout &layout() const override;
+
+    DataType dtype() const override;
+
+    IAllocator &alloc() const override;
+
+    int32_t device() const override;
+
+    void exportData(NVCVTensorData &data) const override;
+
+    void setReleaseStream(cudaStream_t stream) override;
+
+private:
+    NVCVTensorRequirements m_reqs;
+    int64_t                m_maxOuterSize;
+    int32_t                m_device;
+    int64_t                m_granularity;
+
+    uintptr_t m_basePtr;
+    int64_t   m_reservedSize;
+
+    // Sizes of the ranges mapped one after the other from the base pointer,
+    // each unmapped on its own.
+    std::vector<int64_t> m_mappings;
+    int64_t              m_mappedSize = 0;
+
+    mutable std::mutex m_mutex;
+
+    std::optional<cudaStream_t> m_releaseStream;
+
+    void map(int64_t size);
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_GROWABLE_TENSOR_HPP
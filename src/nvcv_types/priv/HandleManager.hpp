@@ -56,6 +56,20 @@ using GetHandleType = typename detail::GetHandleType<T>::type;
 // R=resource address, G=generation, P=private API bit
 static constexpr int kResourceAlignment = 16; // Must be a power of two.
 
+// Snapshot of a handle manager's usage and of how often its threads had to
+// go to the shared free list. Event counters (cacheHits and below) are
+// accumulated per thread and published at every refill/flush, so they might
+// lag behind by up to one cache batch per running thread.
+struct HandleManagerStats
+{
+    int64_t capacity;         // number of resources allocated, free or in use
+    int64_t inUse;            // number of live handles
+    int64_t cacheHits;        // creations/destructions served by the thread's cache alone
+    int64_t globalRefills;    // batch fetches from the shared free list
+    int64_t globalFlushes;    // batch returns to the shared free list
+    int64_t contendedRetries; // failed atomic updates of the shared free list
+};
+
 template<typename Interface, typename Storage>
 class HandleManager
 {
@@ -167,18 +181,28 @@ public:
 
     Interface *validate(HandleType handle) const;
 
+    // Resources are allocated on demand in both policies. Under fixed size,
+    // creation fails once maxSize handles are alive.
     void setFixedSize(int32_t maxSize);
-    void setDynamicSize(int32_t minSize = 0);
+    void setDynamicSize();
 
     void clear();
 
+    HandleManagerStats stats() const;
+
 private:
     struct Impl;
-    std::unique_ptr<Impl> pimpl;
+    struct ThreadCache;
+
+    // Shared so that thread caches can tell whether their manager still exists at thread exit.
+    std::shared_ptr<Impl> pimpl;
 
-    void doAllocate(size_t count);
     void doGrow();
 
+    ThreadCache &doGetThreadCache();
+    void         doRefillCache(ThreadCache &cache);
+    int64_t      doCountUsed() const;
+
     Resource *getValidResource(HandleType handle) const;
 
     Resource  *doFetchFreeResource();
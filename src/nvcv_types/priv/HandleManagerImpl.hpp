@@ -21,56 +21,21 @@
 #include "Exception.hpp"
 #include "LockFreeStack.hpp"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cassert>
 #include <cstring>
 #include <iostream>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 namespace nvcv::priv {
 
 static const char *LEAK_DETECTION_ENVVAR = "NVCV_LEAK_DETECTION";
 
-template<typename Node>
-class ManagedLockFreeStack : protected LockFreeStack<Node>
-{
-    using Base = LockFreeStack<Node>;
-
-public:
-    using Base::pop;
-    using Base::push;
-    using Base::pushStack;
-    using Base::top;
-
-    template<typename... Args>
-    Node *emplace(Args &&...args)
-    {
-        Node *n = new Node{std::forward<Args>(args)...};
-        push(n);
-        return n;
-    }
-
-    ~ManagedLockFreeStack()
-    {
-        clear();
-    }
-
-    void clear()
-    {
-        if (Node *h = this->release())
-        {
-            while (h)
-            {
-                auto *n = h->next;
-                delete h;
-                h = n;
-            }
-        }
-    }
-};
-
 template<typename Interface, typename Storage>
 HandleManager<Interface, Storage>::Resource::Resource()
 {
@@ -95,43 +60,184 @@ void HandleManager<Interface, Storage>::Resource::destroyObject()
     NVCV_ASSERT(!this->live());
 }
 
+// Identifies the resources of a handle manager between two releases.
+// It's unique across all managers, thread caches use it to detect stale contents.
+inline uint64_t NextHandleCacheEpoch()
+{
+    static std::atomic<uint64_t> epoch{0};
+    return ++epoch;
+}
+
+// Free resources owned by the calling thread. Creating and destroying objects
+// under dynamic size policy only goes to the shared free list when the cache
+// is empty or overfull, so threads don't contend on its head for every handle.
+template<typename Interface, typename Storage>
+struct HandleManager<Interface, Storage>::ThreadCache
+{
+    std::weak_ptr<Impl> owner;
+    uint64_t            epoch = 0; // owner's epoch when the cache was bound to it
+
+    Resource *head  = nullptr;
+    int       count = 0;
+
+    // Not published to the owner's counters yet
+    int64_t hits = 0;
+
+    ~ThreadCache();
+};
+
 template<typename Interface, typename Storage>
 struct HandleManager<Interface, Storage>::Impl
 {
-    static constexpr int kMinHandles = 1024;
+    // Size of the first pool, each new one doubles the capacity. There's no
+    // use for more pools than needed to go past the int32_t handle limit.
+    static constexpr int64_t kFirstPoolSize = 1024;
+    static constexpr int     kMaxPools      = 22;
+
+    // Number of free resources moved at once between the shared free list
+    // and a thread cache. A cache holding twice as many gives one batch back.
+    static constexpr int kCacheBatchSize = 32;
+
+    static constexpr size_t kCacheLineSize = 64;
 
-    std::mutex mtxAlloc;
+    // Serializes size policy changes, growth doesn't take it.
+    std::mutex mtxPolicy;
 
     struct ResourcePool
     {
-        explicit ResourcePool(size_t count)
-            : resources(count)
+        ResourcePool(int64_t first, int64_t count)
+            : first(first)
+            , resources(count)
+        {
+            // Turn the resources into a forward_list before the pool is published
+            for (int64_t i = 0; i < count - 1; ++i)
+            {
+                resources[i].next = &resources[i + 1];
+            }
+        }
+
+        int64_t end() const
         {
+            return first + resources.size();
         }
 
-        ResourcePool         *next = nullptr;
+        int64_t               first; // number of resources in the previous pools
         std::vector<Resource> resources;
+
+        // Set once the resources were pushed to the free list
+        std::atomic<bool> ready{false};
     };
 
-    // Store the resources' buffer.
-    // For efficient validation, it's divided into several pools,
-    // it's easy to check if a given resource belong to a pool, O(1).
-    ManagedLockFreeStack<ResourcePool> resourceStack;
+    static int64_t PoolSize(int index)
+    {
+        return index == 0 ? kFirstPoolSize : kFirstPoolSize << (index - 1);
+    }
+
+    // Store the resources' buffer, allocated on demand.
+    // Pools are only added at the first empty slot and stay there until the
+    // manager is cleared, so a resource's validation is a lookup on at most
+    // kMaxPools ranges that doesn't need any lock.
+    std::array<std::atomic<ResourcePool *>, kMaxPools> pools{};
+
+    // Read by every create/destroy
+    bool                  hasFixedSize = false;
+    int64_t               maxCapacity  = 0; // only under fixed size policy
+    const char           *name;
+    std::atomic<uint64_t> epoch{NextHandleCacheEpoch()};
 
-    // All the free resources we have
-    LockFreeStack<Resource> freeResources;
+    // All the free resources we have that aren't in a thread cache.
+    // Written by every refill/flush, so it's kept away from the fields above.
+    alignas(kCacheLineSize) LockFreeStack<Resource> freeResources;
 
     static_assert(std::atomic<Resource *>::is_always_lock_free);
 
-    bool            hasFixedSize  = false;
-    int             totalCapacity = 0;
-    std::atomic_int usedCount     = 0;
-    const char     *name;
+    struct alignas(kCacheLineSize) Counters
+    {
+        std::atomic<int64_t> cacheHits{0};
+        std::atomic<int64_t> refills{0};
+        std::atomic<int64_t> flushes{0};
+        std::atomic<int64_t> retries{0};
+    };
+
+    Counters counters;
+
+    ~Impl()
+    {
+        this->releasePools();
+    }
+
+    void releasePools()
+    {
+        for (auto &slot : pools)
+        {
+            delete slot.exchange(nullptr, std::memory_order_acq_rel);
+        }
+    }
+
+    void publish(ThreadCache &cache, int retries)
+    {
+        if (cache.hits > 0)
+        {
+            counters.cacheHits.fetch_add(cache.hits, std::memory_order_relaxed);
+            cache.hits = 0;
+        }
+        if (retries > 0)
+        {
+            counters.retries.fetch_add(retries, std::memory_order_relaxed);
+        }
+    }
+
+    // Moves the first 'count' resources of the cache to the shared free list.
+    void flushCache(ThreadCache &cache, int count)
+    {
+        NVCV_ASSERT(cache.epoch == epoch.load(std::memory_order_relaxed));
+        NVCV_ASSERT(0 < count && count <= cache.count);
+
+        Resource *first = cache.head;
+        Resource *last  = first;
+        for (int i = 1; i < count; ++i)
+        {
+            last = last->next;
+        }
+        cache.head = last->next;
+        cache.count -= count;
+
+        int retries = 0;
+        freeResources.pushStack(first, last, &retries);
+
+        counters.flushes.fetch_add(1, std::memory_order_relaxed);
+        this->publish(cache, retries);
+    }
+
+    // Gives back all cached resources and unbinds the cache from this manager.
+    void detachCache(ThreadCache &cache)
+    {
+        // If resources were released since the cache was bound, they're gone already.
+        if (cache.epoch == epoch.load(std::memory_order_relaxed) && cache.count > 0)
+        {
+            this->flushCache(cache, cache.count);
+        }
+        this->publish(cache, 0);
+
+        cache.owner.reset();
+        cache.epoch = 0;
+        cache.head  = nullptr;
+        cache.count = 0;
+    }
 };
 
+template<typename Interface, typename Storage>
+HandleManager<Interface, Storage>::ThreadCache::~ThreadCache()
+{
+    if (std::shared_ptr<Impl> impl = owner.lock())
+    {
+        impl->detachCache(*this);
+    }
+}
+
 template<typename Interface, typename Storage>
 HandleManager<Interface, Storage>::HandleManager(const char *name)
-    : pimpl(std::make_unique<Impl>())
+    : pimpl(std::make_shared<Impl>())
 {
     pimpl->name = name;
 }
@@ -193,10 +299,16 @@ int HandleManager<Interface, Storage>::refCount(HandleType handle)
 template<typename Interface, typename Storage>
 bool HandleManager<Interface, Storage>::isManagedResource(Resource *r) const
 {
-    for (auto *range = pimpl->resourceStack.top(); range; range = range->next)
+    for (auto &slot : pimpl->pools)
     {
-        auto *b = range->resources.data();
-        auto *e = b + range->resources.size();
+        const auto *pool = slot.load(std::memory_order_acquire);
+        if (!pool)
+        {
+            break;
+        }
+
+        auto *b = pool->resources.data();
+        auto *e = b + pool->resources.size();
         if (r >= b && r < e)
         {
             return true;
@@ -241,41 +353,35 @@ auto HandleManager<Interface, Storage>::getValidResource(HandleType handle) cons
 template<typename Interface, typename Storage>
 void HandleManager<Interface, Storage>::setFixedSize(int32_t maxSize)
 {
-    std::lock_guard lock(pimpl->mtxAlloc);
-    if (pimpl->usedCount > 0)
+    std::lock_guard lock(pimpl->mtxPolicy);
+    if (int64_t usedCount = doCountUsed(); usedCount > 0)
     {
         throw Exception(NVCV_ERROR_INVALID_OPERATION,
-                        "Cannot change the size policy while there are still %d live %s handles", (int)pimpl->usedCount,
+                        "Cannot change the size policy while there are still %d live %s handles", (int)usedCount,
                         pimpl->name);
     }
 
-    if (pimpl->totalCapacity >= maxSize)
-    {
-        return;
-    }
-
+    // Pools might be larger than the new limit allows, start over.
+    // New ones will be allocated on demand up to maxSize resources.
     this->clear();
 
     pimpl->hasFixedSize = true;
-    doAllocate(maxSize - pimpl->totalCapacity);
+    pimpl->maxCapacity  = maxSize;
 }
 
 template<typename Interface, typename Storage>
-void HandleManager<Interface, Storage>::setDynamicSize(int32_t minSize)
+void HandleManager<Interface, Storage>::setDynamicSize()
 {
-    std::lock_guard lock(pimpl->mtxAlloc);
+    std::lock_guard lock(pimpl->mtxPolicy);
 
     pimpl->hasFixedSize = false;
-    if (pimpl->totalCapacity < minSize)
-    {
-        doAllocate(minSize);
-    }
+    pimpl->maxCapacity  = 0;
 }
 
 template<typename Interface, typename Storage>
 void HandleManager<Interface, Storage>::clear()
 {
-    if (pimpl->usedCount > 0)
+    if (int64_t usedCount = doCountUsed(); usedCount > 0)
     {
         const char *leakDetection = getenv(LEAK_DETECTION_ENVVAR);
 #ifndef NDEBUG
@@ -306,8 +412,8 @@ void HandleManager<Interface, Storage>::clear()
                 abort();
             }
 
-            std::cerr << pimpl->name << " leak detection: " << pimpl->usedCount << " handle"
-                      << (pimpl->usedCount > 1 ? "s" : "") << " still in use" << std::endl;
+            std::cerr << pimpl->name << " leak detection: " << usedCount << " handle" << (usedCount > 1 ? "s" : "")
+                      << " still in use" << std::endl;
             if (doAbort)
             {
                 abort();
@@ -315,54 +421,166 @@ void HandleManager<Interface, Storage>::clear()
         }
     }
 
+    // Thread caches still holding resources will drop them once they see the new epoch.
+    pimpl->epoch.store(NextHandleCacheEpoch(), std::memory_order_relaxed);
+
     pimpl->freeResources.clear();
-    pimpl->resourceStack.clear();
+    pimpl->releasePools();
 }
 
 template<typename Interface, typename Storage>
-void HandleManager<Interface, Storage>::doAllocate(size_t count)
+HandleManagerStats HandleManager<Interface, Storage>::stats() const
 {
-    NVCV_ASSERT(count > 0);
-    auto     *res_block = pimpl->resourceStack.emplace(count);
-    Resource *data      = res_block->resources.data();
+    HandleManagerStats stats;
 
-    // Turn the newly allocated resources into a forward_list
-    for (size_t i = 0; i < count - 1; i++)
+    stats.capacity = 0;
+    for (auto &slot : pimpl->pools)
     {
-        data[i].next = &data[i + 1];
+        if (const auto *pool = slot.load(std::memory_order_acquire))
+        {
+            stats.capacity = pool->end();
+        }
+        else
+        {
+            break;
+        }
     }
+    stats.inUse = doCountUsed();
+
+    stats.cacheHits        = pimpl->counters.cacheHits.load(std::memory_order_relaxed);
+    stats.globalRefills    = pimpl->counters.refills.load(std::memory_order_relaxed);
+    stats.globalFlushes    = pimpl->counters.flushes.load(std::memory_order_relaxed);
+    stats.contendedRetries = pimpl->counters.retries.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+template<typename Interface, typename Storage>
+int64_t HandleManager<Interface, Storage>::doCountUsed() const
+{
+    // Counted on demand instead of tracked by create/destroy, which would make
+    // all threads write to the same memory location.
+    int64_t count = 0;
+    for (auto &slot : pimpl->pools)
+    {
+        const auto *pool = slot.load(std::memory_order_acquire);
+        if (!pool)
+        {
+            break;
+        }
 
-    // Add them to the list of free resources.
-    pimpl->freeResources.pushStack(data, data + count - 1);
+        for (const Resource &r : pool->resources)
+        {
+            count += r.live() ? 1 : 0;
+        }
+    }
+    return count;
 }
 
 template<typename Interface, typename Storage>
 void HandleManager<Interface, Storage>::doGrow()
 {
-    if (pimpl->hasFixedSize)
+    // Called when the free list ran dry. Pools are published lock-free: the new
+    // one is allocated and linked beforehand, and whoever installs it first in
+    // the next empty slot adds its resources to the free list. The others just
+    // try to fetch a resource again.
+    Impl &impl = *pimpl;
+
+    int64_t first = 0;
+    for (int i = 0; i < Impl::kMaxPools; ++i)
+    {
+        typename Impl::ResourcePool *pool = impl.pools[i].load(std::memory_order_acquire);
+        if (pool)
+        {
+            if (!pool->ready.load(std::memory_order_acquire))
+            {
+                // Another thread is still pushing its resources, they'll be available soon.
+                std::this_thread::yield();
+                return;
+            }
+            first = pool->end();
+            continue;
+        }
+
+        int64_t count = Impl::PoolSize(i);
+        if (impl.hasFixedSize)
+        {
+            count = std::min(count, impl.maxCapacity - first);
+            if (count <= 0)
+            {
+                break;
+            }
+        }
+
+        auto newPool = std::make_unique<typename Impl::ResourcePool>(first, count);
+        if (impl.pools[i].compare_exchange_strong(pool, newPool.get(), std::memory_order_acq_rel,
+                                                  std::memory_order_acquire))
+        {
+            pool = newPool.release();
+
+            Resource *data = pool->resources.data();
+            impl.freeResources.pushStack(data, data + count - 1);
+            pool->ready.store(true, std::memory_order_release);
+        }
+        return;
+    }
+
+    if (impl.hasFixedSize)
     {
         throw Exception(NVCV_ERROR_OUT_OF_MEMORY, "%s handle manager pool exhausted under fixed size policy",
-                        pimpl->name);
+                        impl.name);
+    }
+    else
+    {
+        throw Exception(NVCV_ERROR_OUT_OF_MEMORY, "%s handle manager reached its maximum capacity", impl.name);
     }
+}
 
-    std::lock_guard lock(pimpl->mtxAlloc);
-    if (!pimpl->freeResources.top())
+template<typename Interface, typename Storage>
+auto HandleManager<Interface, Storage>::doGetThreadCache() -> ThreadCache &
+{
+    static thread_local ThreadCache cache;
+
+    uint64_t epoch = pimpl->epoch.load(std::memory_order_relaxed);
+    if (cache.epoch != epoch)
     {
-        doAllocate(pimpl->totalCapacity ? pimpl->totalCapacity : pimpl->kMinHandles);
+        // Cache is bound to another manager, or to this one before its resources were released.
+        if (std::shared_ptr<Impl> prev = cache.owner.lock())
+        {
+            prev->detachCache(cache);
+        }
+        else
+        {
+            cache.head  = nullptr;
+            cache.count = 0;
+            cache.hits  = 0;
+        }
+
+        cache.owner = pimpl;
+        cache.epoch = epoch;
     }
+
+    return cache;
 }
 
 template<typename Interface, typename Storage>
-auto HandleManager<Interface, Storage>::doFetchFreeResource() -> Resource *
+void HandleManager<Interface, Storage>::doRefillCache(ThreadCache &cache)
 {
+    NVCV_ASSERT(cache.head == nullptr);
+
     for (;;)
     {
-        if (auto *r = pimpl->freeResources.pop())
+        int       retries = 0;
+        int       count;
+        Resource *head = pimpl->freeResources.popStack(Impl::kCacheBatchSize, count, &retries);
+        pimpl->publish(cache, retries);
+
+        if (head)
         {
-            pimpl->usedCount++;
-            r->incRef();
-            assert(r->refCount() == 1);
-            return r;
+            pimpl->counters.refills.fetch_add(1, std::memory_order_relaxed);
+            cache.head  = head;
+            cache.count = count;
+            return;
         }
         else
         {
@@ -371,11 +589,75 @@ auto HandleManager<Interface, Storage>::doFetchFreeResource() -> Resource *
     }
 }
 
+template<typename Interface, typename Storage>
+auto HandleManager<Interface, Storage>::doFetchFreeResource() -> Resource *
+{
+    Resource *r;
+
+    if (pimpl->hasFixedSize)
+    {
+        // Don't cache under fixed size policy, or free handles could be
+        // stuck in one thread's cache while another one runs out of them.
+        int retries = 0;
+        while (!(r = pimpl->freeResources.pop(&retries)))
+        {
+            doGrow(); // throws
+        }
+        if (retries > 0)
+        {
+            pimpl->counters.retries.fetch_add(retries, std::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        ThreadCache &cache = doGetThreadCache();
+        if (cache.head)
+        {
+            ++cache.hits;
+        }
+        else
+        {
+            doRefillCache(cache);
+        }
+
+        r          = cache.head;
+        cache.head = r->next;
+        --cache.count;
+    }
+
+    r->incRef();
+    assert(r->refCount() == 1);
+    return r;
+}
+
 template<typename Interface, typename Storage>
 void HandleManager<Interface, Storage>::doReturnResource(Resource *r)
 {
-    pimpl->freeResources.push(r);
-    pimpl->usedCount--;
+    if (pimpl->hasFixedSize)
+    {
+        int retries = 0;
+        pimpl->freeResources.push(r, &retries);
+        if (retries > 0)
+        {
+            pimpl->counters.retries.fetch_add(retries, std::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        ThreadCache &cache = doGetThreadCache();
+        r->next            = cache.head;
+        cache.head         = r;
+        ++cache.count;
+
+        if (cache.count >= 2 * Impl::kCacheBatchSize)
+        {
+            pimpl->flushCache(cache, Impl::kCacheBatchSize);
+        }
+        else
+        {
+            ++cache.hits;
+        }
+    }
 }
 
 template<typename Interface, typename Storage>
@@ -17,10 +17,15 @@
 
 #include "IAllocator.hpp"
 
+#include "DeferredRelease.hpp"
 #include "IContext.hpp"
 
+#include <cuda_runtime.h>
+#include <util/Assert.h>
 #include <util/Math.hpp>
 
+#include <algorithm>
+
 namespace nvcv::priv {
 
 void *IAllocator::allocHostMem(int64_t size, int32_t align)
@@ -43,15 +48,18 @@ void *IAllocator::allocHostMem(int64_t size, int32_t align)
                         size);
     }
 
-    return doAllocHostMem(size, align);
+    void *ptr = doAllocHostMem(size, align);
+    doTrackAlloc(NVCV_RESOURCE_MEM_HOST, ptr, size, align, 0);
+    return ptr;
 }
 
 void IAllocator::freeHostMem(void *ptr, int64_t size, int32_t align) noexcept
 {
+    doTrackFree(NVCV_RESOURCE_MEM_HOST, ptr, size, align, 0);
     doFreeHostMem(ptr, size, align);
 }
 
-void *IAllocator::allocHostPinnedMem(int64_t size, int32_t align)
+void *IAllocator::allocHostPinnedMem(int64_t size, int32_t align, uint32_t flags)
 {
     if (size < 0)
     {
@@ -71,15 +79,25 @@ void *IAllocator::allocHostPinnedMem(int64_t size, int32_t align)
                         size);
     }
 
-    return doAllocHostPinnedMem(size, align);
+    constexpr uint32_t kValidFlags = NVCV_HOST_PINNED_MEM_WRITE_COMBINED | NVCV_HOST_PINNED_MEM_PORTABLE
+                                   | NVCV_HOST_PINNED_MEM_MAPPED | NVCV_HOST_PINNED_MEM_NUMA_LOCAL;
+    if (flags & ~kValidFlags)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Invalid host-pinned memory flags 0x%x", flags);
+    }
+
+    void *ptr = doAllocHostPinnedMem(size, align, flags);
+    doTrackAlloc(NVCV_RESOURCE_MEM_HOST_PINNED, ptr, size, align, flags);
+    return ptr;
 }
 
-void IAllocator::freeHostPinnedMem(void *ptr, int64_t size, int32_t align) noexcept
+void IAllocator::freeHostPinnedMem(void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept
 {
-    doFreeHostPinnedMem(ptr, size, align);
+    doTrackFree(NVCV_RESOURCE_MEM_HOST_PINNED, ptr, size, align, flags);
+    doFreeHostPinnedMem(ptr, size, align, flags);
 }
 
-void *IAllocator::allocCudaMem(int64_t size, int32_t align)
+static void CheckCudaMemParams(int64_t size, int32_t align)
 {
     if (size < 0)
     {
@@ -98,15 +116,183 @@ void *IAllocator::allocCudaMem(int64_t size, int32_t align)
                         "Host memory allocator size must be an integral multiple of alignment %d, not %ld", align,
                         size);
     }
+}
 
-    return doAllocCudaMem(size, align);
+void *IAllocator::allocCudaMem(int64_t size, int32_t align)
+{
+    CheckCudaMemParams(size, align);
+
+    void *ptr = doAllocCudaMem(size, align);
+    doTrackAlloc(NVCV_RESOURCE_MEM_CUDA, ptr, size, align, 0);
+    return ptr;
 }
 
 void IAllocator::freeCudaMem(void *ptr, int64_t size, int32_t align) noexcept
 {
+    doTrackFree(NVCV_RESOURCE_MEM_CUDA, ptr, size, align, 0);
     doFreeCudaMem(ptr, size, align);
 }
 
+bool IAllocator::isStreamOrdered() const noexcept
+{
+    return doIsStreamOrdered();
+}
+
+int32_t IAllocator::device() const noexcept
+{
+    return doGetDevice();
+}
+
+void *IAllocator::allocCudaMemAsync(int64_t size, int32_t align, cudaStream_t stream)
+{
+    if (!doIsStreamOrdered())
+    {
+        return allocCudaMem(size, align);
+    }
+
+    CheckCudaMemParams(size, align);
+
+    void *ptr = doAllocCudaMemAsync(size, align, stream);
+    doTrackAlloc(NVCV_RESOURCE_MEM_CUDA, ptr, size, align, 0);
+    return ptr;
+}
+
+void IAllocator::freeCudaMemAsync(void *ptr, int64_t size, int32_t align, cudaStream_t stream) noexcept
+{
+    if (!doIsStreamOrdered())
+    {
+        FreeCudaMem(*this, ptr, size, align, stream);
+        return;
+    }
+
+    doTrackFree(NVCV_RESOURCE_MEM_CUDA, ptr, size, align, 0);
+    doFreeCudaMemAsync(ptr, size, align, stream);
+}
+
+void *IAllocator::doAllocCudaMemAsync(int64_t size, int32_t align, cudaStream_t stream)
+{
+    NVCV_ASSERT(!"Stream-ordered allocators must override it");
+    return nullptr;
+}
+
+void IAllocator::doFreeCudaMemAsync(void *ptr, int64_t size, int32_t align, cudaStream_t stream) noexcept
+{
+    NVCV_ASSERT(!"Stream-ordered allocators must override it");
+}
+
+static int SizeBucket(int64_t size)
+{
+    // Bucket 0 is below 1 KiB, then one bucket per power of two.
+    int bucket = size > 0 ? util::ILog2(size) - 9 : 0;
+    return std::clamp(bucket, 0, NVCV_ALLOCATOR_NUM_SIZE_BUCKETS - 1);
+}
+
+void IAllocator::doTrackAlloc(NVCVResourceType resType, void *ptr, int64_t size, int32_t align,
+                              uint32_t flags) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    ResourceStats &s = m_stats[resType];
+
+    // Counters are only read for reporting, they don't order any memory accesses.
+    int64_t inUse = s.bytesInUse.fetch_add(size, std::memory_order_relaxed) + size;
+    int64_t peak  = s.peakBytesInUse.load(std::memory_order_relaxed);
+    while (inUse > peak && !s.peakBytesInUse.compare_exchange_weak(peak, inUse, std::memory_order_relaxed))
+    {
+    }
+
+    s.numAllocs.fetch_add(1, std::memory_order_relaxed);
+    s.sizeHistogram[SizeBucket(size)].fetch_add(1, std::memory_order_relaxed);
+
+    if (m_traceFn != nullptr)
+    {
+        NVCVAllocatorTraceEvent ev{NVCV_ALLOCATOR_TRACE_ALLOC, resType, ptr, size, align, flags};
+        m_traceFn(m_traceCtx, this->handle(), &ev);
+    }
+}
+
+void IAllocator::doTrackFree(NVCVResourceType resType, void *ptr, int64_t size, int32_t align,
+                             uint32_t flags) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    ResourceStats &s = m_stats[resType];
+
+    s.bytesInUse.fetch_sub(size, std::memory_order_relaxed);
+    s.numFrees.fetch_add(1, std::memory_order_relaxed);
+
+    if (m_traceFn != nullptr)
+    {
+        NVCVAllocatorTraceEvent ev{NVCV_ALLOCATOR_TRACE_FREE, resType, ptr, size, align, flags};
+        m_traceFn(m_traceCtx, this->handle(), &ev);
+    }
+}
+
+NVCVAllocatorStats IAllocator::stats(NVCVResourceType resType) const
+{
+    if (resType < 0 || resType >= NVCV_NUM_RESOURCE_TYPES)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Invalid resource type %d", (int)resType);
+    }
+
+    const ResourceStats &s = m_stats[resType];
+
+    NVCVAllocatorStats out;
+    out.bytesInUse     = s.bytesInUse.load(std::memory_order_relaxed);
+    out.peakBytesInUse = s.peakBytesInUse.load(std::memory_order_relaxed);
+    out.numAllocs      = s.numAllocs.load(std::memory_order_relaxed);
+    out.numFrees       = s.numFrees.load(std::memory_order_relaxed);
+    for (int i = 0; i < NVCV_ALLOCATOR_NUM_SIZE_BUCKETS; ++i)
+    {
+        out.sizeHistogram[i] = s.sizeHistogram[i].load(std::memory_order_relaxed);
+    }
+    return out;
+}
+
+void IAllocator::resetStats() noexcept
+{
+    for (ResourceStats &s : m_stats)
+    {
+        s.peakBytesInUse.store(s.bytesInUse.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        s.numAllocs.store(0, std::memory_order_relaxed);
+        s.numFrees.store(0, std::memory_order_relaxed);
+        for (auto &count : s.sizeHistogram)
+        {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void IAllocator::setTraceFunc(NVCVAllocatorTraceFunc fn, void *ctx) noexcept
+{
+    m_traceFn  = fn;
+    m_traceCtx = ctx;
+}
+
+unsigned int GetCudaHostAllocFlags(uint32_t flags)
+{
+    unsigned int cudaFlags = cudaHostAllocDefault;
+    if (flags & NVCV_HOST_PINNED_MEM_WRITE_COMBINED)
+    {
+        cudaFlags |= cudaHostAllocWriteCombined;
+    }
+    if (flags & NVCV_HOST_PINNED_MEM_PORTABLE)
+    {
+        cudaFlags |= cudaHostAllocPortable;
+    }
+    if (flags & NVCV_HOST_PINNED_MEM_MAPPED)
+    {
+        cudaFlags |= cudaHostAllocMapped;
+    }
+    return cudaFlags;
+}
+
 priv::IAllocator &GetDefaultAllocator()
 {
     return GlobalContext().allocDefault();
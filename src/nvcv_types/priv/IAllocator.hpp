@@ -20,8 +20,12 @@
 
 #include "ICoreObject.hpp"
 
+#include <cuda_runtime.h>
+#include <nvcv/alloc/Allocator.h>
 #include <nvcv/alloc/Fwd.h>
 
+#include <array>
+#include <atomic>
 #include <memory>
 
 namespace nvcv::priv {
@@ -32,22 +36,74 @@ public:
     void *allocHostMem(int64_t size, int32_t align);
     void  freeHostMem(void *ptr, int64_t size, int32_t align) noexcept;
 
-    void *allocHostPinnedMem(int64_t size, int32_t align);
-    void  freeHostPinnedMem(void *ptr, int64_t size, int32_t align) noexcept;
+    // flags is a combination of NVCVHostPinnedMemFlag.
+    void *allocHostPinnedMem(int64_t size, int32_t align, uint32_t flags = NVCV_HOST_PINNED_MEM_STAGING);
+    void  freeHostPinnedMem(void *ptr, int64_t size, int32_t align,
+                            uint32_t flags = NVCV_HOST_PINNED_MEM_STAGING) noexcept;
 
     void *allocCudaMem(int64_t size, int32_t align);
     void  freeCudaMem(void *ptr, int64_t size, int32_t align) noexcept;
 
+    // Memory to be used by work on stream. Allocators that aren't stream-ordered
+    // allocate it right away, and only get it back once the work submitted to
+    // stream so far is done.
+    void *allocCudaMemAsync(int64_t size, int32_t align, cudaStream_t stream);
+    void  freeCudaMemAsync(void *ptr, int64_t size, int32_t align, cudaStream_t stream) noexcept;
+
+    bool isStreamOrdered() const noexcept;
+
+    // Device where cuda memory is allocated, or -1 if it's the one current at allocation.
+    int32_t device() const noexcept;
+
+    // Counters of the memory requested through the functions above.
+    NVCVAllocatorStats stats(NVCVResourceType resType) const;
+    void               resetStats() noexcept;
+
+    // Must not be called while the allocator is in use by other threads.
+    void setTraceFunc(NVCVAllocatorTraceFunc fn, void *ctx) noexcept;
+
 private:
+    struct ResourceStats
+    {
+        std::atomic<int64_t> bytesInUse     = 0;
+        std::atomic<int64_t> peakBytesInUse = 0;
+        std::atomic<int64_t> numAllocs      = 0;
+        std::atomic<int64_t> numFrees       = 0;
+
+        std::array<std::atomic<int64_t>, NVCV_ALLOCATOR_NUM_SIZE_BUCKETS> sizeHistogram = {};
+    };
+
+    std::array<ResourceStats, NVCV_NUM_RESOURCE_TYPES> m_stats;
+
+    NVCVAllocatorTraceFunc m_traceFn  = nullptr;
+    void                  *m_traceCtx = nullptr;
+
+    void doTrackAlloc(NVCVResourceType resType, void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept;
+    void doTrackFree(NVCVResourceType resType, void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept;
+
     // NVI idiom
     virtual void *doAllocHostMem(int64_t size, int32_t align)                    = 0;
     virtual void  doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept = 0;
 
-    virtual void *doAllocHostPinnedMem(int64_t size, int32_t align)                    = 0;
-    virtual void  doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align) noexcept = 0;
+    virtual void *doAllocHostPinnedMem(int64_t size, int32_t align, uint32_t flags)                    = 0;
+    virtual void  doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept = 0;
 
     virtual void *doAllocCudaMem(int64_t size, int32_t align)                    = 0;
     virtual void  doFreeCudaMem(void *ptr, int64_t size, int32_t align) noexcept = 0;
+
+    // Only called if doIsStreamOrdered returns true
+    virtual bool doIsStreamOrdered() const noexcept
+    {
+        return false;
+    }
+
+    virtual int32_t doGetDevice() const noexcept
+    {
+        return -1;
+    }
+
+    virtual void *doAllocCudaMemAsync(int64_t size, int32_t align, cudaStream_t stream);
+    virtual void  doFreeCudaMemAsync(void *ptr, int64_t size, int32_t align, cudaStream_t stream) noexcept;
 };
 
 template<class T, class... ARGS>
@@ -75,6 +131,9 @@ void FreeHostObj(IAllocator &alloc, T *ptr) noexcept
     }
 }
 
+// Converts a combination of NVCVHostPinnedMemFlag into cudaHostAlloc flags.
+unsigned int GetCudaHostAllocFlags(uint32_t flags);
+
 priv::IAllocator &GetAllocator(NVCVAllocatorHandle handle);
 priv::IAllocator &GetDefaultAllocator();
 
@@ -34,6 +34,9 @@ using TensorManager     = CoreObjManager<NVCVTensorHandle>;
 using AllocatorManager  = CoreObjManager<NVCVAllocatorHandle>;
 
 class IAllocator;
+class DeferredReleaseQueue;
+class StagingRing;
+class IpcRegistry;
 
 class IContext
 {
@@ -48,6 +51,10 @@ public:
 
     virtual const Managers &managerList() const = 0;
     virtual IAllocator     &allocDefault()      = 0;
+
+    virtual DeferredReleaseQueue &deferredRelease() = 0;
+    virtual StagingRing          &stagingRing()     = 0;
+    virtual IpcRegistry          &ipcRegistry()     = 0;
 };
 
 // Defined in Context.cpp
@@ -48,8 +48,13 @@ public:
 
     virtual void popImages(int32_t numImages) = 0;
 
+    virtual void setImage(int32_t index, NVCVImageHandle image) = 0;
+
     virtual void clear() = 0;
 
+    // Flags are the device data of mask, a U8 tensor with one flag per image, NULL if all images are active.
+    virtual void setActiveMask(NVCVTensorHandle mask, const uint8_t *flags) = 0;
+
     virtual Size2D      maxSize() const      = 0;
     virtual ImageFormat uniqueFormat() const = 0;
 
@@ -21,6 +21,7 @@
 #include "ICoreObject.hpp"
 #include "ImageFormat.hpp"
 
+#include <cuda_runtime.h>
 #include <nvcv/Tensor.h>
 
 namespace nvcv::priv {
@@ -39,7 +40,18 @@ public:
 
     virtual IAllocator &alloc() const = 0;
 
+    // CUDA device the tensor memory is on, or -1 if it isn't on a device.
+    virtual int32_t device() const = 0;
+
     virtual void exportData(NVCVTensorData &data) const = 0;
+
+    // Stream whose work might still be using the memory when the object is
+    // destroyed, it's freed once that work is done. Only objects that own
+    // their memory have anything to defer.
+    virtual void setReleaseStream(cudaStream_t stream)
+    {
+        (void)stream;
+    }
 };
 
 } // namespace nvcv::priv
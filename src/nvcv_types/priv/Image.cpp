@@ -18,7 +18,9 @@
 #include "Image.hpp"
 
 #include "DataType.hpp"
+#include "DeferredRelease.hpp"
 #include "IAllocator.hpp"
+#include "IContext.hpp"
 #include "Requirements.hpp"
 
 #include <cuda_runtime.h>
@@ -32,21 +34,47 @@ namespace nvcv::priv {
 
 // Image implementation -------------------------------------------
 
+namespace {
+
+struct ImageReqsKey
+{
+    Size2D          size;
+    NVCVImageFormat fmt;
+    int32_t         baseAlign, rowAlign;
+    int             dev;
+
+    bool operator==(const ImageReqsKey &that) const
+    {
+        return size == that.size && fmt == that.fmt && baseAlign == that.baseAlign && rowAlign == that.rowAlign
+            && dev == that.dev;
+    }
+};
+
+} // namespace
+
 NVCVImageRequirements Image::CalcRequirements(Size2D size, ImageFormat fmt, int32_t userBaseAlign, int32_t userRowAlign)
 {
+    int dev;
+    NVCV_CHECK_THROW(cudaGetDevice(&dev));
+
+    ImageReqsKey key{size, fmt.value(), userBaseAlign, userRowAlign, dev};
+
+    thread_local RequirementsMemo<ImageReqsKey, NVCVImageRequirements> memo;
+    if (const NVCVImageRequirements *reqs = memo.find(key))
+    {
+        return *reqs;
+    }
+
     NVCVImageRequirements reqs;
     reqs.width  = size.w;
     reqs.height = size.h;
     reqs.format = fmt.value();
     reqs.mem    = {};
 
-    int dev;
-    NVCV_CHECK_THROW(cudaGetDevice(&dev));
-
     int rowAlign;
     if (userRowAlign == 0)
     {
-        NVCV_CHECK_THROW(cudaDeviceGetAttribute(&rowAlign, cudaDevAttrTexturePitchAlignment, dev));
+        rowAlign = GetDeviceAlignment(dev).rowAlign;
     }
     else
     {
@@ -81,7 +109,7 @@ NVCVImageRequirements Image::CalcRequirements(Size2D size, ImageFormat fmt, int3
     int baseAlign;
     if (userBaseAlign == 0)
     {
-        NVCV_CHECK_THROW(cudaDeviceGetAttribute(&baseAlign, cudaDevAttrTextureAlignment, dev));
+        baseAlign = GetDeviceAlignment(dev).baseAlign;
     }
     else
     {
@@ -116,6 +144,7 @@ NVCVImageRequirements Image::CalcRequirements(Size2D size, ImageFormat fmt, int3
         AddBuffer(reqs.mem.cudaMem, reqs.planeRowStride[p] * planeSize.h, baseAlign);
     }
 
+    memo.insert(key, reqs);
     return reqs;
 }
 
@@ -128,6 +157,9 @@ Image::Image(NVCVImageRequirements reqs, IAllocator &alloc)
         throw Exception(NVCV_ERROR_NOT_IMPLEMENTED, "Image with block-linear format is not currently supported.");
     }
 
+    // Memory of destroyed objects whose work is done can be reused now.
+    GlobalContext().deferredRelease().poll();
+
     int64_t bufSize = CalcTotalSizeBytes(m_reqs.mem.cudaMem);
     m_memBuffer     = m_alloc.allocCudaMem(bufSize, m_reqs.alignBytes);
     NVCV_ASSERT(m_memBuffer != nullptr);
@@ -135,7 +167,12 @@ Image::Image(NVCVImageRequirements reqs, IAllocator &alloc)
 
 Image::~Image()
 {
-    m_alloc.freeCudaMem(m_memBuffer, CalcTotalSizeBytes(m_reqs.mem.cudaMem), m_reqs.alignBytes);
+    FreeCudaMem(m_alloc, m_memBuffer, CalcTotalSizeBytes(m_reqs.mem.cudaMem), m_reqs.alignBytes, m_releaseStream);
+}
+
+void Image::setReleaseStream(cudaStream_t stream)
+{
+    m_releaseStream = stream;
 }
 
 NVCVTypeImage Image::type() const
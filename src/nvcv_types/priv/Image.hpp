@@ -20,6 +20,8 @@
 
 #include "IImage.hpp"
 
+#include <optional>
+
 namespace nvcv::priv {
 
 class Image final : public CoreObjectBase<IImage>
@@ -37,10 +39,14 @@ public:
 
     void exportData(NVCVImageData &data) const override;
 
+    void setReleaseStream(cudaStream_t stream) override;
+
 private:
     IAllocator           &m_alloc;
     NVCVImageRequirements m_reqs;
     void                 *m_memBuffer;
+
+    std::optional<cudaStream_t> m_releaseStream;
 };
 
 class ImageWrapData final : public CoreObjectBase<IImage>
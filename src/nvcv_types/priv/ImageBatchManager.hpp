@@ -20,12 +20,13 @@
 
 #include "IContext.hpp"
 #include "ImageBatchVarShape.hpp"
+#include "ImageBatchVarShapeWrapData.hpp"
 
 namespace nvcv::priv {
 
 using ImageBatchManager = CoreObjManager<NVCVImageBatchHandle>;
 
-using ImageBatchStorage = CompatibleStorage<ImageBatchVarShape>;
+using ImageBatchStorage = CompatibleStorage<ImageBatchVarShape, ImageBatchVarShapeWrapData>;
 
 template<>
 class CoreObjManager<NVCVImageBatchHandle> : public HandleManager<IImageBatch, ImageBatchStorage>
@@ -18,8 +18,12 @@
 #include "ImageBatchVarShape.hpp"
 
 #include "DataType.hpp"
+#include "DeferredRelease.hpp"
 #include "IAllocator.hpp"
+#include "IContext.hpp"
 #include "IImage.hpp"
+#include "Image.hpp"
+#include "ImageBatchManager.hpp"
 #include "ImageManager.hpp"
 #include "Requirements.hpp"
 
@@ -27,6 +31,8 @@
 #include <util/CheckError.hpp>
 #include <util/Math.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <numeric>
 
@@ -53,13 +59,22 @@ NVCVImageBatchVarShapeRequirements ImageBatchVarShape::CalcRequirements(int32_t
                         NVCV_MAX_MEM_REQUIREMENTS_BLOCK_SIZE);
     }
 
-    AddBuffer(reqs.mem.cudaMem, capacity * sizeof(NVCVImageBufferStrided), reqs.alignBytes);
-    AddBuffer(reqs.mem.cudaMem, capacity * sizeof(NVCVImageFormat), reqs.alignBytes);
+    for (int i = 0; i < kNumInitialDeviceBuffers; ++i)
+    {
+        AddBuffer(reqs.mem.cudaMem, capacity * sizeof(NVCVImageBufferStrided), reqs.alignBytes);
+        AddBuffer(reqs.mem.cudaMem, capacity * sizeof(NVCVImageFormat), reqs.alignBytes);
+
+        AddBuffer(reqs.mem.hostPinnedMem,
+                  util::RoundUp(capacity * sizeof(NVCVImageBufferStrided), reqs.alignBytes)
+                      + capacity * sizeof(NVCVImageFormat),
+                  reqs.alignBytes);
+    }
 
     AddBuffer(reqs.mem.hostMem, capacity * sizeof(NVCVImageBufferStrided), reqs.alignBytes);
     AddBuffer(reqs.mem.hostMem, capacity * sizeof(NVCVImageFormat), reqs.alignBytes);
 
     AddBuffer(reqs.mem.hostMem, capacity * sizeof(NVCVImageHandle), reqs.alignBytes);
+    AddBuffer(reqs.mem.hostMem, capacity * sizeof(uint8_t), reqs.alignBytes);
 
     return reqs;
 }
@@ -68,77 +83,467 @@ ImageBatchVarShape::ImageBatchVarShape(NVCVImageBatchVarShapeRequirements reqs,
     : m_alloc{alloc}
     , m_reqs{std::move(reqs)}
     , m_dirtyStartingFromIndex(0)
+    , m_numDirtyFlags(0)
     , m_numImages(0)
+    , m_numDevBuffers(0)
+    , m_curDevBuffer(-1)
     , m_cacheMaxSize{Size2D{0,0}}
 {
-    m_evPostFence     = nullptr;
-    m_devImagesBuffer = m_hostImagesBuffer = nullptr;
-    m_devFormatsBuffer = m_hostFormatsBuffer = nullptr;
-    m_imgHandleBuffer                        = nullptr;
+    m_hostImagesBuffer  = nullptr;
+    m_hostFormatsBuffer = nullptr;
+    m_imgHandleBuffer   = nullptr;
+    m_dirtyFlags        = nullptr;
 
     int64_t bufImagesSize  = m_reqs.capacity * sizeof(NVCVImageBufferStrided);
     int64_t bufFormatsSize = m_reqs.capacity * sizeof(NVCVImageFormat);
     int64_t imgHandlesSize = m_reqs.capacity * sizeof(NVCVImageHandle);
+    int64_t dirtyFlagsSize = m_reqs.capacity * sizeof(uint8_t);
 
     try
     {
-        m_devImagesBuffer
-            = reinterpret_cast<NVCVImageBufferStrided *>(m_alloc.allocCudaMem(bufImagesSize, m_reqs.alignBytes));
-        NVCV_ASSERT(m_devImagesBuffer != nullptr);
-
         m_hostImagesBuffer
             = reinterpret_cast<NVCVImageBufferStrided *>(m_alloc.allocHostMem(bufImagesSize, m_reqs.alignBytes));
-        NVCV_ASSERT(m_devImagesBuffer != nullptr);
-
-        m_devFormatsBuffer
-            = reinterpret_cast<NVCVImageFormat *>(m_alloc.allocCudaMem(bufFormatsSize, m_reqs.alignBytes));
-        NVCV_ASSERT(m_devFormatsBuffer != nullptr);
+        NVCV_ASSERT(m_hostImagesBuffer != nullptr);
 
         m_hostFormatsBuffer
             = reinterpret_cast<NVCVImageFormat *>(m_alloc.allocHostMem(bufFormatsSize, m_reqs.alignBytes));
-        NVCV_ASSERT(m_devFormatsBuffer != nullptr);
+        NVCV_ASSERT(m_hostFormatsBuffer != nullptr);
 
         m_imgHandleBuffer
             = reinterpret_cast<NVCVImageHandle *>(m_alloc.allocHostMem(imgHandlesSize, m_reqs.alignBytes));
         NVCV_ASSERT(m_imgHandleBuffer != nullptr);
 
-        NVCV_CHECK_THROW(cudaEventCreateWithFlags(&m_evPostFence, cudaEventDisableTiming));
+        m_dirtyFlags = reinterpret_cast<uint8_t *>(m_alloc.allocHostMem(dirtyFlagsSize, m_reqs.alignBytes));
+        NVCV_ASSERT(m_dirtyFlags != nullptr);
+        std::fill(m_dirtyFlags, m_dirtyFlags + m_reqs.capacity, 0);
+
+        for (int i = 0; i < kNumInitialDeviceBuffers; ++i)
+        {
+            doAllocDeviceBuffer(m_devBuffers[i]);
+            ++m_numDevBuffers;
+        }
     }
     catch (...)
     {
-        if (m_evPostFence)
+        for (int i = 0; i < m_numDevBuffers; ++i)
         {
-            NVCV_CHECK_LOG(cudaEventDestroy(m_evPostFence));
+            doFreeDeviceBuffer(m_devBuffers[i]);
         }
 
-        m_alloc.freeCudaMem(m_devImagesBuffer, bufImagesSize, m_reqs.alignBytes);
         m_alloc.freeHostMem(m_hostImagesBuffer, bufImagesSize, m_reqs.alignBytes);
-
-        m_alloc.freeCudaMem(m_devFormatsBuffer, bufFormatsSize, m_reqs.alignBytes);
         m_alloc.freeHostMem(m_hostFormatsBuffer, bufFormatsSize, m_reqs.alignBytes);
 
         m_alloc.freeHostMem(m_imgHandleBuffer, imgHandlesSize, m_reqs.alignBytes);
+        m_alloc.freeHostMem(m_dirtyFlags, dirtyFlagsSize, m_reqs.alignBytes);
         throw;
     }
 }
 
 ImageBatchVarShape::~ImageBatchVarShape()
 {
-    NVCV_CHECK_LOG(cudaEventSynchronize(m_evPostFence));
-
     int64_t bufImagesSize  = m_reqs.capacity * sizeof(NVCVImageBufferStrided);
     int64_t bufFormatsSize = m_reqs.capacity * sizeof(NVCVImageFormat);
     int64_t imgHandlesSize = m_reqs.capacity * sizeof(NVCVImageHandle);
+    int64_t dirtyFlagsSize = m_reqs.capacity * sizeof(uint8_t);
 
-    m_alloc.freeCudaMem(m_devImagesBuffer, bufImagesSize, m_reqs.alignBytes);
-    m_alloc.freeHostMem(m_hostImagesBuffer, bufImagesSize, m_reqs.alignBytes);
+    bool curRetired = true;
+    if (m_curDevBuffer >= 0)
+    {
+        try
+        {
+            doRetireDeviceBuffer(m_devBuffers[m_curDevBuffer]);
+        }
+        catch (...)
+        {
+            curRetired = false;
+        }
+    }
+
+    for (int i = 0; i < m_numDevBuffers; ++i)
+    {
+        DeviceBuffer &buf = m_devBuffers[i];
 
-    m_alloc.freeCudaMem(m_devFormatsBuffer, bufFormatsSize, m_reqs.alignBytes);
+        // Buffers are given back once the work of all their consumers is done,
+        // that includes the copy from the staging buffer.
+        if ((i == m_curDevBuffer && !curRetired) || !doDeferFreeDeviceBuffer(buf))
+        {
+            for (cudaStream_t consumer : buf.consumers)
+            {
+                NVCV_CHECK_LOG(cudaStreamSynchronize(consumer));
+            }
+            NVCV_CHECK_LOG(cudaEventSynchronize(buf.evCopyDone));
+            doFreeDeviceBuffer(buf);
+        }
+    }
+
+    m_alloc.freeHostMem(m_hostImagesBuffer, bufImagesSize, m_reqs.alignBytes);
     m_alloc.freeHostMem(m_hostFormatsBuffer, bufFormatsSize, m_reqs.alignBytes);
 
     m_alloc.freeHostMem(m_imgHandleBuffer, imgHandlesSize, m_reqs.alignBytes);
+    m_alloc.freeHostMem(m_dirtyFlags, dirtyFlagsSize, m_reqs.alignBytes);
+
+    for (NVCVImageHandle img : m_ownedImages)
+    {
+        CoreObjectDecRef(img);
+    }
+
+    if (m_parent)
+    {
+        try
+        {
+            CoreObjectDecRef(m_parent);
+        }
+        catch (...)
+        {
+            // parent already destroyed, nothing to release
+        }
+    }
+
+    if (m_activeMask)
+    {
+        CoreObjectDecRef(m_activeMask);
+    }
+}
+
+void ImageBatchVarShape::setParent(NVCVImageBatchHandle parent)
+{
+    NVCV_ASSERT(m_parent == nullptr);
+
+    CoreObjectIncRef(parent);
+    m_parent = parent;
+}
+
+void ImageBatchVarShape::setActiveMask(NVCVTensorHandle mask, const uint8_t *flags)
+{
+    if (mask)
+    {
+        CoreObjectIncRef(mask);
+    }
+    if (m_activeMask)
+    {
+        CoreObjectDecRef(m_activeMask);
+    }
+
+    m_activeMask  = mask;
+    m_activeFlags = flags;
+}
+
+namespace {
+
+// Allocation shared by images created by constructImages, given back once the
+// last of them is destroyed.
+struct ImageArena
+{
+    IAllocator *alloc;
+    void       *buffer;
+    int64_t     sizeBytes;
+    int32_t     alignBytes;
+
+    std::atomic<int32_t> refCount;
+};
+
+void ReleaseImageArena(void *ctx, const NVCVImageData *) noexcept
+{
+    auto *arena = static_cast<ImageArena *>(ctx);
+    if (arena->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        arena->alloc->freeCudaMem(arena->buffer, arena->sizeBytes, arena->alignBytes);
+        delete arena;
+    }
+}
+
+} // namespace
+
+void ImageBatchVarShape::constructImages(const int32_t *widths, const int32_t *heights, int32_t numImages,
+                                         ImageFormat fmt)
+{
+    if (widths == nullptr || heights == nullptr)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Image widths and heights must not be NULL");
+    }
+
+    if (numImages < 1)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Number of images must be >= 1, not %d", numImages);
+    }
+
+    if (numImages + m_numImages > m_reqs.capacity)
+    {
+        throw Exception(NVCV_ERROR_OVERFLOW,
+                        "Adding %d images to image batch would make its size %d exceed its capacity %d", numImages,
+                        numImages + m_numImages, m_reqs.capacity);
+    }
+
+    if (fmt.memLayout() != NVCV_MEM_LAYOUT_PL)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Image format " << fmt << " must be pitch-linear";
+    }
+
+    // Images follow each other in the buffer, each one aligned like a separately allocated image
+    std::vector<NVCVImageRequirements> reqs(numImages);
+    std::vector<int64_t>               offsets(numImages);
+
+    int64_t sizeBytes  = 0;
+    int32_t alignBytes = 1;
+    for (int32_t i = 0; i < numImages; ++i)
+    {
+        reqs[i] = Image::CalcRequirements({widths[i], heights[i]}, fmt, 0, 0);
+
+        offsets[i] = util::RoundUp(sizeBytes, (int64_t)reqs[i].alignBytes);
+        sizeBytes  = offsets[i];
+        for (int32_t p = 0; p < fmt.numPlanes(); ++p)
+        {
+            sizeBytes += static_cast<int64_t>(fmt.planeSize({widths[i], heights[i]}, p).h) * reqs[i].planeRowStride[p];
+        }
+        alignBytes = std::max(alignBytes, reqs[i].alignBytes);
+    }
+    sizeBytes = util::RoundUp(sizeBytes, (int64_t)alignBytes);
+
+    // Memory of destroyed objects whose work is done can be reused now.
+    GlobalContext().deferredRelease().poll();
+
+    // The reference held here is released once all images are created
+    auto *arena = new ImageArena{&m_alloc, nullptr, sizeBytes, alignBytes, 1};
+    try
+    {
+        arena->buffer = m_alloc.allocCudaMem(sizeBytes, alignBytes);
+        NVCV_ASSERT(arena->buffer != nullptr);
+    }
+    catch (...)
+    {
+        delete arena;
+        throw;
+    }
+
+    int32_t oldNumImages = m_numImages;
+    size_t  oldNumOwned  = m_ownedImages.size();
+
+    try
+    {
+        m_ownedImages.reserve(oldNumOwned + numImages);
+
+        for (int32_t i = 0; i < numImages; ++i)
+        {
+            NVCVImageData data = {};
+            data.format        = fmt.value();
+            data.bufferType    = NVCV_IMAGE_BUFFER_STRIDED_CUDA;
+
+            NVCVImageBufferStrided &buf = data.buffer.strided;
+            buf.numPlanes               = fmt.numPlanes();
+
+            int64_t offset = offsets[i];
+            for (int32_t p = 0; p < buf.numPlanes; ++p)
+            {
+                Size2D planeSize = fmt.planeSize({widths[i], heights[i]}, p);
+
+                buf.planes[p].width     = planeSize.w;
+                buf.planes[p].height    = planeSize.h;
+                buf.planes[p].rowStride = reqs[i].planeRowStride[p];
+                buf.planes[p].basePtr   = static_cast<NVCVByte *>(arena->buffer) + offset;
+
+                offset += static_cast<int64_t>(planeSize.h) * reqs[i].planeRowStride[p];
+            }
+
+            arena->refCount.fetch_add(1, std::memory_order_relaxed);
+            NVCVImageHandle img;
+            try
+            {
+                img = CreateCoreObject<ImageWrapData>(data, &ReleaseImageArena, arena);
+            }
+            catch (...)
+            {
+                ReleaseImageArena(arena, nullptr);
+                throw;
+            }
+            m_ownedImages.push_back(img);
+
+            doPushImage(img);
+        }
+    }
+    catch (...)
+    {
+        m_numImages = oldNumImages;
+        for (size_t i = oldNumOwned; i < m_ownedImages.size(); ++i)
+        {
+            CoreObjectDecRef(m_ownedImages[i]);
+        }
+        m_ownedImages.resize(oldNumOwned);
+
+        ReleaseImageArena(arena, nullptr);
+        throw;
+    }
+
+    ReleaseImageArena(arena, nullptr);
+}
+
+int64_t ImageBatchVarShape::doGetStagingImagesSize() const
+{
+    return util::RoundUp((int64_t)(m_reqs.capacity * sizeof(NVCVImageBufferStrided)), (int64_t)m_reqs.alignBytes);
+}
+
+void ImageBatchVarShape::doAllocDeviceBuffer(DeviceBuffer &buf) const
+{
+    int64_t bufImagesSize  = m_reqs.capacity * sizeof(NVCVImageBufferStrided);
+    int64_t bufFormatsSize = m_reqs.capacity * sizeof(NVCVImageFormat);
+
+    try
+    {
+        buf.devImages
+            = reinterpret_cast<NVCVImageBufferStrided *>(m_alloc.allocCudaMem(bufImagesSize, m_reqs.alignBytes));
+        NVCV_ASSERT(buf.devImages != nullptr);
+
+        buf.devFormats = reinterpret_cast<NVCVImageFormat *>(m_alloc.allocCudaMem(bufFormatsSize, m_reqs.alignBytes));
+        NVCV_ASSERT(buf.devFormats != nullptr);
+
+        buf.hostStaging = reinterpret_cast<std::byte *>(m_alloc.allocHostPinnedMem(
+            util::RoundUp(doGetStagingImagesSize() + bufFormatsSize, (int64_t)m_reqs.alignBytes), m_reqs.alignBytes));
+        NVCV_ASSERT(buf.hostStaging != nullptr);
+
+        NVCV_CHECK_THROW(cudaEventCreateWithFlags(&buf.evCopyDone, cudaEventDisableTiming));
+    }
+    catch (...)
+    {
+        doFreeDeviceBuffer(buf);
+        throw;
+    }
+}
+
+void ImageBatchVarShape::doFreeDeviceBuffer(DeviceBuffer &buf) const noexcept
+{
+    int64_t bufImagesSize  = m_reqs.capacity * sizeof(NVCVImageBufferStrided);
+    int64_t bufFormatsSize = m_reqs.capacity * sizeof(NVCVImageFormat);
+
+    if (buf.evCopyDone)
+    {
+        NVCV_CHECK_LOG(cudaEventDestroy(buf.evCopyDone));
+    }
+    for (cudaEvent_t ev : buf.evRetired)
+    {
+        NVCV_CHECK_LOG(cudaEventDestroy(ev));
+    }
+
+    m_alloc.freeCudaMem(buf.devImages, bufImagesSize, m_reqs.alignBytes);
+    m_alloc.freeCudaMem(buf.devFormats, bufFormatsSize, m_reqs.alignBytes);
+    m_alloc.freeHostPinnedMem(
+        buf.hostStaging, util::RoundUp(doGetStagingImagesSize() + bufFormatsSize, (int64_t)m_reqs.alignBytes),
+        m_reqs.alignBytes);
+
+    buf = {};
+}
+
+bool ImageBatchVarShape::doDeferFreeDeviceBuffer(DeviceBuffer &buf) const noexcept
+{
+    int64_t bufImagesSize  = m_reqs.capacity * sizeof(NVCVImageBufferStrided);
+    int64_t bufFormatsSize = m_reqs.capacity * sizeof(NVCVImageFormat);
+    int64_t stagingSize    = util::RoundUp(doGetStagingImagesSize() + bufFormatsSize, (int64_t)m_reqs.alignBytes);
+
+    // The stream of the last upload must also wait for the other consumers.
+    for (size_t i = 0; i < buf.consumers.size(); ++i)
+    {
+        if (buf.consumers[i] != buf.stream && !NVCV_CHECK_LOG(cudaStreamWaitEvent(buf.stream, buf.evRetired[i])))
+        {
+            return false;
+        }
+    }
+
+    if (!GlobalContext().deferredRelease().defer(
+            buf.stream, {
+                            {MemRelease::CUDA, &m_alloc, buf.devImages, bufImagesSize, m_reqs.alignBytes},
+                            {MemRelease::CUDA, &m_alloc, buf.devFormats, bufFormatsSize, m_reqs.alignBytes},
+                            {MemRelease::HOST_PINNED, &m_alloc, buf.hostStaging, stagingSize, m_reqs.alignBytes},
+    }))
+    {
+        return false;
+    }
 
-    NVCV_CHECK_LOG(cudaEventDestroy(m_evPostFence));
+    // Events can go right away, they're released once they complete.
+    NVCV_CHECK_LOG(cudaEventDestroy(buf.evCopyDone));
+    for (cudaEvent_t ev : buf.evRetired)
+    {
+        NVCV_CHECK_LOG(cudaEventDestroy(ev));
+    }
+
+    buf = {};
+    return true;
+}
+
+auto ImageBatchVarShape::doAcquireDeviceBuffer(bool &stagingFree) const -> DeviceBuffer &
+{
+    int32_t next = (m_curDevBuffer + 1) % m_numDevBuffers;
+
+    stagingFree = true;
+
+    // Previous upload from this buffer still in progress?
+    cudaError_t err = cudaEventQuery(m_devBuffers[next].evCopyDone);
+    if (err == cudaErrorNotReady)
+    {
+        if (m_numDevBuffers < kMaxDeviceBuffers)
+        {
+            // Use a new one instead of waiting.
+            next = m_numDevBuffers;
+            doAllocDeviceBuffer(m_devBuffers[next]);
+            ++m_numDevBuffers;
+        }
+        else
+        {
+            // Host is way ahead of device. The device buffers can still be reused
+            // in stream order, only the staging area has to be replaced.
+            stagingFree = false;
+        }
+    }
+    else
+    {
+        NVCV_CHECK_THROW(err);
+    }
+
+    m_curDevBuffer = next;
+    return m_devBuffers[next];
+}
+
+void ImageBatchVarShape::doAddConsumer(DeviceBuffer &buf, cudaStream_t stream) const
+{
+    if (std::find(buf.consumers.begin(), buf.consumers.end(), stream) != buf.consumers.end())
+    {
+        return;
+    }
+
+    if (buf.evRetired.size() <= buf.consumers.size())
+    {
+        cudaEvent_t ev;
+        NVCV_CHECK_THROW(cudaEventCreateWithFlags(&ev, cudaEventDisableTiming));
+        try
+        {
+            buf.evRetired.push_back(ev);
+        }
+        catch (...)
+        {
+            NVCV_CHECK_LOG(cudaEventDestroy(ev));
+            throw;
+        }
+    }
+
+    buf.consumers.push_back(stream);
+}
+
+void ImageBatchVarShape::doRetireDeviceBuffer(DeviceBuffer &buf) const
+{
+    for (size_t i = 0; i < buf.consumers.size(); ++i)
+    {
+        NVCV_CHECK_THROW(cudaEventRecord(buf.evRetired[i], buf.consumers[i]));
+    }
+}
+
+void ImageBatchVarShape::doWaitRetired(DeviceBuffer &buf, cudaStream_t stream) const
+{
+    for (size_t i = 0; i < buf.consumers.size(); ++i)
+    {
+        if (buf.consumers[i] != stream)
+        {
+            NVCV_CHECK_THROW(cudaStreamWaitEvent(stream, buf.evRetired[i]));
+        }
+    }
+    // Events can be recorded again, the waits above are already bound to their current state.
+    buf.consumers.clear();
 }
 
 NVCVTypeImageBatch ImageBatchVarShape::type() const
@@ -215,47 +620,239 @@ void ImageBatchVarShape::doUpdateCache() const
 
 void ImageBatchVarShape::exportData(CUstream stream, NVCVImageBatchData &data) const
 {
-    data.numImages  = m_numImages;
-    data.bufferType = NVCV_IMAGE_BATCH_VARSHAPE_BUFFER_STRIDED_CUDA;
-
-    NVCVImageBatchVarShapeBufferStrided &buf = data.buffer.varShapeStrided;
-    buf.imageList                            = m_devImagesBuffer;
-    buf.formatList                           = m_devFormatsBuffer;
-    buf.hostFormatList                       = m_hostFormatsBuffer;
+    // Images before this index were uploaded already, but some of them might have been replaced since.
+    int32_t numUploaded = std::min(m_dirtyStartingFromIndex, m_numImages);
 
-    NVCV_ASSERT(m_dirtyStartingFromIndex <= m_numImages);
+    bool hasReplaced = false;
+    if (m_numDirtyFlags > 0)
+    {
+        hasReplaced = std::any_of(m_dirtyFlags, m_dirtyFlags + numUploaded, [](uint8_t f) { return f != 0; });
+    }
 
-    if (m_dirtyStartingFromIndex < m_numImages)
+    if (hasReplaced || numUploaded < m_numImages)
     {
-        NVCV_CHECK_THROW(cudaStreamWaitEvent(stream, m_evPostFence));
+        cudaStreamCaptureStatus captureStatus;
+        NVCV_CHECK_THROW(cudaStreamIsCapturing(stream, &captureStatus));
+        if (captureStatus != cudaStreamCaptureStatusNone)
+        {
+            // The upload would be baked into the graph, reading from a staging buffer
+            // that is recycled by later uploads, and the staging ring can't be
+            // synchronized with while capturing anyway.
+            throw Exception(NVCV_ERROR_INVALID_OPERATION,
+                            "Image batch was modified and must be used at least once outside of stream capture "
+                            "before being used while capturing a CUDA graph");
+        }
+
+        DeviceBuffer *buf = m_curDevBuffer >= 0 ? &m_devBuffers[m_curDevBuffer] : nullptr;
+
+        // Whether the images before numUploaded that weren't replaced are in buf already.
+        bool keepUploaded = false;
+        // Whether buf's own staging area can be used.
+        bool stagingFree = true;
+
+        if (buf != nullptr && !hasReplaced)
+        {
+            NVCV_ASSERT(buf->numUploaded >= numUploaded);
+
+            // Images were only appended, the new ones can go to the current buffer
+            // as they won't overwrite anything in use. We only have to make sure that
+            // the images already there are available to this stream.
+            if (buf->stream != stream)
+            {
+                NVCV_CHECK_THROW(cudaStreamWaitEvent(stream, buf->evCopyDone));
+            }
+            doAddConsumer(*buf, stream);
+            keepUploaded = true;
+        }
+        else
+        {
+            DeviceBuffer *prev = buf;
+
+            buf = &doAcquireDeviceBuffer(stagingFree);
 
-        NVCV_CHECK_THROW(cudaMemcpyAsync(
-            m_devImagesBuffer + m_dirtyStartingFromIndex, m_hostImagesBuffer + m_dirtyStartingFromIndex,
-            (m_numImages - m_dirtyStartingFromIndex) * sizeof(*m_devImagesBuffer), cudaMemcpyHostToDevice, stream));
+            // Wait till the new buffer isn't being read by previous work, on any stream.
+            doWaitRetired(*buf, stream);
+            doAddConsumer(*buf, stream);
 
-        NVCV_CHECK_THROW(cudaMemcpyAsync(
-            m_devFormatsBuffer + m_dirtyStartingFromIndex, m_hostFormatsBuffer + m_dirtyStartingFromIndex,
-            (m_numImages - m_dirtyStartingFromIndex) * sizeof(*m_devFormatsBuffer), cudaMemcpyHostToDevice, stream));
+            if (prev != nullptr)
+            {
+                if (numUploaded > 0)
+                {
+                    // Images that weren't replaced are copied from the previous buffer on the device,
+                    // only the replaced ones go through the staging buffer.
+                    if (prev->stream != stream)
+                    {
+                        NVCV_CHECK_THROW(cudaStreamWaitEvent(stream, prev->evCopyDone));
+                    }
+                    NVCV_CHECK_THROW(cudaMemcpyAsync(buf->devImages, prev->devImages,
+                                                     numUploaded * sizeof(*buf->devImages),
+                                                     cudaMemcpyDeviceToDevice, stream));
+                    NVCV_CHECK_THROW(cudaMemcpyAsync(buf->devFormats, prev->devFormats,
+                                                     numUploaded * sizeof(*buf->devFormats),
+                                                     cudaMemcpyDeviceToDevice, stream));
+                    doAddConsumer(*prev, stream);
+                    keepUploaded = true;
+                }
+
+                // Everything that reads from the previous buffer was submitted.
+                doRetireDeviceBuffer(*prev);
+            }
+        }
+
+        int64_t bufFormatsSize = m_reqs.capacity * sizeof(NVCVImageFormat);
+        int64_t stagingSize    = util::RoundUp(doGetStagingImagesSize() + bufFormatsSize, (int64_t)m_reqs.alignBytes);
+
+        std::byte *staging = buf->hostStaging;
+        if (!stagingFree)
+        {
+            // Released once the upload is done, the ring buffer's own staging area is
+            // still being read by a previous upload.
+            staging = reinterpret_cast<std::byte *>(m_alloc.allocHostPinnedMem(stagingSize, m_reqs.alignBytes));
+            NVCV_ASSERT(staging != nullptr);
+        }
+
+        auto *stagingImages  = reinterpret_cast<NVCVImageBufferStrided *>(staging);
+        auto *stagingFormats = reinterpret_cast<NVCVImageFormat *>(staging + doGetStagingImagesSize());
+
+        try
+        {
+            auto upload = [&](int32_t begin, int32_t end)
+            {
+                int32_t count = end - begin;
+
+                std::copy(m_hostImagesBuffer + begin, m_hostImagesBuffer + end, stagingImages + begin);
+                std::copy(m_hostFormatsBuffer + begin, m_hostFormatsBuffer + end, stagingFormats + begin);
+
+                NVCV_CHECK_THROW(cudaMemcpyAsync(buf->devImages + begin, stagingImages + begin,
+                                                 count * sizeof(*buf->devImages), cudaMemcpyHostToDevice, stream));
 
-        // Signal that we finished reading from m_hostBuffer
-        NVCV_CHECK_THROW(cudaEventRecord(m_evPostFence, stream));
+                NVCV_CHECK_THROW(cudaMemcpyAsync(buf->devFormats + begin, stagingFormats + begin,
+                                                 count * sizeof(*buf->devFormats), cudaMemcpyHostToDevice, stream));
+            };
 
-        // WAR: need stream synchronization at this point to avoid data races.
-        // Must do a deeper analysis to see what's wrong. CVCUDA-443 tracks this effort.
-        NVCV_CHECK_THROW(cudaStreamSynchronize(stream));
+            if (!keepUploaded)
+            {
+                upload(0, m_numImages);
+            }
+            else
+            {
+                // Runs of replaced images are uploaded separately up to a few of them,
+                // past that it's cheaper to upload everything from the first one on.
+                constexpr int kMaxUploadRanges = 8;
+
+                int32_t begin     = numUploaded;
+                int32_t numRanges = 0;
+                for (int32_t i = 0; i < numUploaded && numRanges <= kMaxUploadRanges; ++i)
+                {
+                    if (m_dirtyFlags[i] && (i == 0 || !m_dirtyFlags[i - 1]))
+                    {
+                        begin = std::min(begin, i);
+                        ++numRanges;
+                    }
+                }
+
+                if (numRanges > kMaxUploadRanges)
+                {
+                    upload(begin, m_numImages);
+                }
+                else
+                {
+                    for (int32_t i = begin; i < numUploaded;)
+                    {
+                        int32_t end = i;
+                        while (end < numUploaded && m_dirtyFlags[end])
+                        {
+                            ++end;
+                        }
+
+                        if (end > i)
+                        {
+                            upload(i, end);
+                            i = end;
+                        }
+                        else
+                        {
+                            ++i;
+                        }
+                    }
+
+                    if (numUploaded < m_numImages)
+                    {
+                        upload(numUploaded, m_numImages);
+                    }
+                }
+            }
+
+            // Signal that we finished reading from staging buffer
+            NVCV_CHECK_THROW(cudaEventRecord(buf->evCopyDone, stream));
+        }
+        catch (...)
+        {
+            if (!stagingFree)
+            {
+                NVCV_CHECK_LOG(cudaStreamSynchronize(stream));
+                m_alloc.freeHostPinnedMem(staging, stagingSize, m_reqs.alignBytes);
+            }
+            throw;
+        }
+
+        if (!stagingFree
+            && !GlobalContext().deferredRelease().defer(
+                stream, {
+                            {MemRelease::HOST_PINNED, &m_alloc, staging, stagingSize, m_reqs.alignBytes},
+            }))
+        {
+            NVCV_CHECK_THROW(cudaStreamSynchronize(stream));
+            m_alloc.freeHostPinnedMem(staging, stagingSize, m_reqs.alignBytes);
+        }
+
+        buf->stream      = stream;
+        buf->numUploaded = m_numImages;
 
         // up to m_numImages, we're all good
+        std::fill(m_dirtyFlags, m_dirtyFlags + std::max(m_dirtyStartingFromIndex, m_numImages), 0);
+        m_numDirtyFlags          = 0;
         m_dirtyStartingFromIndex = m_numImages;
     }
+    else if (m_curDevBuffer >= 0)
+    {
+        cudaStreamCaptureStatus captureStatus;
+        NVCV_CHECK_THROW(cudaStreamIsCapturing(stream, &captureStatus));
+
+        // Work captured in a graph is ordered by the user when the graph is launched.
+        if (captureStatus == cudaStreamCaptureStatusNone)
+        {
+            DeviceBuffer &cur = m_devBuffers[m_curDevBuffer];
+
+            // Images uploaded on another stream must be available to this one, and
+            // the buffer can't be reused until the work submitted here is done.
+            if (cur.stream != stream)
+            {
+                NVCV_CHECK_THROW(cudaStreamWaitEvent(stream, cur.evCopyDone));
+            }
+            doAddConsumer(cur, stream);
+        }
+    }
+
+    const DeviceBuffer &buf = m_devBuffers[std::max(m_curDevBuffer, 0)];
+
+    data.numImages  = m_numImages;
+    data.bufferType = NVCV_IMAGE_BATCH_VARSHAPE_BUFFER_STRIDED_CUDA;
+
+    NVCVImageBatchVarShapeBufferStrided &bufData = data.buffer.varShapeStrided;
+    bufData.imageList                            = buf.devImages;
+    bufData.formatList                           = buf.devFormats;
+    bufData.hostFormatList                       = m_hostFormatsBuffer;
+    bufData.activeMask                           = m_activeFlags;
 
     doUpdateCache();
 
     NVCV_ASSERT(m_cacheMaxSize);
-    buf.maxWidth  = m_cacheMaxSize->w;
-    buf.maxHeight = m_cacheMaxSize->h;
+    bufData.maxWidth  = m_cacheMaxSize->w;
+    bufData.maxHeight = m_cacheMaxSize->h;
 
     NVCV_ASSERT(m_cacheUniqueFormat);
-    buf.uniqueFormat = m_cacheUniqueFormat->value();
+    bufData.uniqueFormat = m_cacheUniqueFormat->value();
 }
 
 void ImageBatchVarShape::pushImages(const NVCVImageHandle *images, int32_t numImages)
@@ -272,9 +869,6 @@ void ImageBatchVarShape::pushImages(const NVCVImageHandle *images, int32_t numIm
                         numImages + m_numImages, m_reqs.capacity);
     }
 
-    // Wait till m_hostBuffer is free to be written to (all pending reads are finished).
-    NVCV_CHECK_THROW(cudaEventSynchronize(m_evPostFence));
-
     int oldNumImages = m_numImages;
 
     try
@@ -299,9 +893,6 @@ void ImageBatchVarShape::pushImages(NVCVPushImageFunc cbPushImage, void *ctxCall
                         "Callback function that adds images to the image batch cannot be NULL");
     }
 
-    // Wait till m_hostBuffer is free to be written to (all pending reads are finished).
-    NVCV_CHECK_THROW(cudaEventSynchronize(m_evPostFence));
-
     int oldNumImages = m_numImages;
 
     try
@@ -325,10 +916,8 @@ void ImageBatchVarShape::pushImages(NVCVPushImageFunc cbPushImage, void *ctxCall
     }
 }
 
-void ImageBatchVarShape::doPushImage(NVCVImageHandle imgHandle)
+NVCVImageData ImageBatchVarShape::doExportImage(NVCVImageHandle imgHandle)
 {
-    NVCV_ASSERT(m_numImages < m_reqs.capacity);
-
     auto &img = ToStaticRef<IImage>(imgHandle);
 
     if (img.format().memLayout() != NVCV_MEM_LAYOUT_PL)
@@ -345,11 +934,42 @@ void ImageBatchVarShape::doPushImage(NVCVImageHandle imgHandle)
         throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Data buffer of image to be added isn't gpu-accessible";
     }
 
-    m_hostImagesBuffer[m_numImages]  = imgData.buffer.strided;
-    m_hostFormatsBuffer[m_numImages] = imgData.format;
-    m_imgHandleBuffer[m_numImages]   = imgHandle;
+    return imgData;
+}
+
+void ImageBatchVarShape::doStoreImage(int32_t index, NVCVImageHandle imgHandle, const NVCVImageData &imgData)
+{
+    const NVCVImageBufferStrided &cur = m_hostImagesBuffer[index];
+    const NVCVImageBufferStrided &buf = imgData.buffer.strided;
+
+    bool changed = cur.numPlanes != buf.numPlanes || m_hostFormatsBuffer[index] != imgData.format;
+    for (int p = 0; p < buf.numPlanes && !changed; ++p)
+    {
+        changed = cur.planes[p].width != buf.planes[p].width || cur.planes[p].height != buf.planes[p].height
+               || cur.planes[p].rowStride != buf.planes[p].rowStride || cur.planes[p].basePtr != buf.planes[p].basePtr;
+    }
+
+    // Images past m_dirtyStartingFromIndex are uploaded anyway
+    if (changed && index < m_dirtyStartingFromIndex && !m_dirtyFlags[index])
+    {
+        m_dirtyFlags[index] = 1;
+        ++m_numDirtyFlags;
+    }
+
+    m_hostImagesBuffer[index]  = buf;
+    m_hostFormatsBuffer[index] = imgData.format;
+    m_imgHandleBuffer[index]   = imgHandle;
+}
+
+void ImageBatchVarShape::doPushImage(NVCVImageHandle imgHandle)
+{
+    NVCV_ASSERT(m_numImages < m_reqs.capacity);
+
+    NVCVImageData imgData = doExportImage(imgHandle);
 
-    Size2D imgSize = img.size();
+    doStoreImage(m_numImages, imgHandle, imgData);
+
+    Size2D imgSize = ToStaticRef<IImage>(imgHandle).size();
 
     ++m_numImages;
 
@@ -385,11 +1005,6 @@ void ImageBatchVarShape::popImages(int32_t numImages)
 
     m_numImages -= numImages;
 
-    if (m_dirtyStartingFromIndex > m_numImages)
-    {
-        m_dirtyStartingFromIndex = m_numImages;
-    }
-
     // Removing images invalidates size.
     m_cacheMaxSize = std::nullopt;
     // It *does not* always invalidate m_cacheUniqueFormat, though.
@@ -400,6 +1015,27 @@ void ImageBatchVarShape::popImages(int32_t numImages)
     }
 }
 
+void ImageBatchVarShape::setImage(int32_t index, NVCVImageHandle image)
+{
+    if (index < 0 || index >= m_numImages)
+    {
+        throw Exception(NVCV_ERROR_OVERFLOW, "Image index %d must be in [0, %d)", index, m_numImages);
+    }
+
+    if (image == nullptr)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Image handle must not be NULL");
+    }
+
+    NVCVImageData imgData = doExportImage(image);
+
+    doStoreImage(index, image, imgData);
+
+    // Replaced image might have been the largest one, or the only one with another format.
+    m_cacheMaxSize      = std::nullopt;
+    m_cacheUniqueFormat = std::nullopt;
+}
+
 void ImageBatchVarShape::getImages(int32_t begIndex, NVCVImageHandle *outImages, int32_t numImages) const
 {
     if (begIndex + numImages > m_numImages)
@@ -412,10 +1048,10 @@ void ImageBatchVarShape::getImages(int32_t begIndex, NVCVImageHandle *outImages,
 
 void ImageBatchVarShape::clear()
 {
-    m_numImages              = 0;
-    m_dirtyStartingFromIndex = 0;
-    m_cacheMaxSize           = {0, 0};
-    m_cacheUniqueFormat      = std::nullopt;
+    // Uploaded descriptors are kept, images pushed again are compared against them.
+    m_numImages         = 0;
+    m_cacheMaxSize      = {0, 0};
+    m_cacheUniqueFormat = std::nullopt;
 }
 
 } // namespace nvcv::priv
@@ -22,6 +22,9 @@
 
 #include <cuda_runtime.h>
 
+#include <cstddef>
+#include <vector>
+
 namespace nvcv::priv {
 
 class ImageBatchVarShape final : public CoreObjectBase<IImageBatchVarShape>
@@ -49,22 +52,97 @@ public:
     void pushImages(const NVCVImageHandle *images, int32_t numImages) override;
     void pushImages(NVCVPushImageFunc cbPushImage, void *ctxCallback) override;
     void popImages(int32_t numImages) override;
+    void setImage(int32_t index, NVCVImageHandle image) override;
     void clear() override;
+    void setActiveMask(NVCVTensorHandle mask, const uint8_t *flags) override;
+
+    // Keeps a reference to the batch the images come from, released on destruction.
+    void setParent(NVCVImageBatchHandle parent);
+
+    // Creates images with all their planes in one allocation and appends them.
+    // The batch owns them, they're released when it's destroyed.
+    void constructImages(const int32_t *widths, const int32_t *heights, int32_t numImages, ImageFormat fmt);
 
 private:
+    NVCVImageBatchHandle m_parent = nullptr;
+
+    // Referenced while it's set
+    NVCVTensorHandle m_activeMask  = nullptr;
+    const uint8_t   *m_activeFlags = nullptr;
+
+    std::vector<NVCVImageHandle> m_ownedImages;
+
     IAllocator                        &m_alloc;
     NVCVImageBatchVarShapeRequirements m_reqs;
 
+    // Images from this index on must be uploaded to the device. The ones before
+    // it only when their flag in m_dirtyFlags is set, as they were replaced.
+    // Host descriptors past m_numImages are kept, so that images pushed again
+    // after a clear or pop are only uploaded when they actually differ.
     mutable int32_t m_dirtyStartingFromIndex;
+    mutable int32_t m_numDirtyFlags;
 
     int32_t                 m_numImages;
     NVCVImageBufferStrided *m_hostImagesBuffer;
-    NVCVImageBufferStrided *m_devImagesBuffer;
-
-    NVCVImageFormat *m_hostFormatsBuffer;
-    NVCVImageFormat *m_devFormatsBuffer;
+    NVCVImageFormat        *m_hostFormatsBuffer;
 
     NVCVImageHandle *m_imgHandleBuffer;
+    mutable uint8_t *m_dirtyFlags;
+
+    // Device copy of the image list, along with the host-pinned staging buffer
+    // used to upload it. They are used in round-robin fashion so that exportData
+    // never has to block the host thread waiting for the previous copy to be
+    // consumed. Hazards are handled with events, on the device side. When the
+    // ring can't grow anymore and the next staging buffer is still being read,
+    // the upload goes through a temporary one instead.
+    struct DeviceBuffer
+    {
+        NVCVImageBufferStrided *devImages  = nullptr;
+        NVCVImageFormat        *devFormats = nullptr;
+
+        // Host-pinned, holds images followed by formats.
+        std::byte *hostStaging = nullptr;
+
+        // Recorded after the upload from hostStaging.
+        cudaEvent_t evCopyDone = nullptr;
+
+        // Streams the device buffers were handed out to since the buffer was
+        // acquired, upload streams included. Once we switch to another buffer,
+        // evRetired[i] is recorded on consumers[i], after all work that might be
+        // reading from the device buffers. Events are kept for reuse, there are
+        // at least as many as consumers.
+        std::vector<cudaStream_t> consumers;
+        std::vector<cudaEvent_t>  evRetired;
+
+        cudaStream_t stream      = nullptr; // stream of last upload
+        int32_t      numUploaded = 0;       // images uploaded to device buffers
+    };
+
+    static constexpr int kNumInitialDeviceBuffers = 2;
+    static constexpr int kMaxDeviceBuffers        = 4;
+
+    mutable DeviceBuffer m_devBuffers[kMaxDeviceBuffers];
+    mutable int32_t      m_numDevBuffers;
+    mutable int32_t      m_curDevBuffer; // -1 if nothing was uploaded yet
+
+    void doAllocDeviceBuffer(DeviceBuffer &buf) const;
+    void doFreeDeviceBuffer(DeviceBuffer &buf) const noexcept;
+    // Frees it once the work on its stream is done, false if it couldn't be deferred.
+    bool doDeferFreeDeviceBuffer(DeviceBuffer &buf) const noexcept;
+
+    // Returns the next buffer of the ring. Its staging area can be written to by
+    // host only if stagingFree is set, otherwise an upload from it is still in
+    // progress and the ring can't grow anymore.
+    DeviceBuffer &doAcquireDeviceBuffer(bool &stagingFree) const;
+
+    // Work submitted to stream from now on might read from buf.
+    void doAddConsumer(DeviceBuffer &buf, cudaStream_t stream) const;
+    // Records evRetired on every consumer of buf, all work reading from it was submitted.
+    void doRetireDeviceBuffer(DeviceBuffer &buf) const;
+    // Makes stream wait until the work of the consumers of a retired buf is done, and forgets them.
+    void doWaitRetired(DeviceBuffer &buf, cudaStream_t stream) const;
+
+    int64_t doGetStagingImagesSize() const;
 
     // Max width/height up to m_numImages.
     // If nullopt, must be recalculated from the beginning.
@@ -73,12 +151,14 @@ private:
 
     void doUpdateCache() const;
 
-    // TODO: must be retrieved from the resource allocator;
-    cudaEvent_t m_evPostFence;
-
     // Assumes there's enough space for image.
-    // Does not update dirty count
     void doPushImage(NVCVImageHandle imgHandle);
+
+    // Returns the descriptor of an image that can be added to the batch.
+    static NVCVImageData doExportImage(NVCVImageHandle imgHandle);
+
+    // Stores the image at index, flagging it as dirty if its descriptor changed.
+    void doStoreImage(int32_t index, NVCVImageHandle imgHandle, const NVCVImageData &imgData);
 };
 
 } // namespace nvcv::priv
@@ -0,0 +1,172 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ImageBatchVarShapeWrapData.hpp"
+
+#include "IAllocator.hpp"
+
+#include <util/CheckError.hpp>
+
+namespace nvcv::priv {
+
+static void ValidateImageBatchVarShapeBufferStrided(const NVCVImageBatchData &data)
+{
+    if (data.bufferType != NVCV_IMAGE_BATCH_VARSHAPE_BUFFER_STRIDED_CUDA)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                        "Image batch buffer type must be NVCV_IMAGE_BATCH_VARSHAPE_BUFFER_STRIDED_CUDA");
+    }
+
+    if (data.numImages < 0)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Number of images must be >= 0, not %d", data.numImages);
+    }
+
+    const NVCVImageBatchVarShapeBufferStrided &buffer = data.buffer.varShapeStrided;
+
+    if (data.numImages > 0)
+    {
+        if (buffer.imageList == nullptr || buffer.formatList == nullptr)
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Device image and format lists must not be NULL");
+        }
+
+        if (buffer.hostFormatList == nullptr && buffer.uniqueFormat == NVCV_IMAGE_FORMAT_NONE)
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                            "Host format list must not be NULL when images don't all have the same format");
+        }
+
+        // Operators size their launch grids with it
+        if (buffer.maxWidth < 1 || buffer.maxHeight < 1)
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
+                << "Maximum image size must be >= 1x1, not " << buffer.maxWidth << "x" << buffer.maxHeight;
+        }
+    }
+}
+
+ImageBatchVarShapeWrapData::ImageBatchVarShapeWrapData(const NVCVImageBatchData &data,
+                                                       NVCVImageBatchDataCleanupFunc cleanup, void *ctxCleanup)
+    : m_data(data)
+    , m_cleanup(cleanup)
+    , m_ctxCleanup(ctxCleanup)
+{
+    ValidateImageBatchVarShapeBufferStrided(data);
+
+    NVCVImageBatchVarShapeBufferStrided &buffer = m_data.buffer.varShapeStrided;
+    if (buffer.hostFormatList == nullptr)
+    {
+        m_hostFormats.assign(m_data.numImages, buffer.uniqueFormat);
+        buffer.hostFormatList = m_hostFormats.data();
+    }
+}
+
+ImageBatchVarShapeWrapData::~ImageBatchVarShapeWrapData()
+{
+    if (m_cleanup)
+    {
+        // Caller gets back the data it passed in
+        NVCVImageBatchData data = m_data;
+        if (!m_hostFormats.empty())
+        {
+            data.buffer.varShapeStrided.hostFormatList = nullptr;
+        }
+        m_cleanup(m_ctxCleanup, &data);
+    }
+}
+
+NVCVTypeImageBatch ImageBatchVarShapeWrapData::type() const
+{
+    return NVCV_TYPE_IMAGEBATCH_VARSHAPE_WRAPDATA;
+}
+
+int32_t ImageBatchVarShapeWrapData::capacity() const
+{
+    return m_data.numImages;
+}
+
+int32_t ImageBatchVarShapeWrapData::numImages() const
+{
+    return m_data.numImages;
+}
+
+Size2D ImageBatchVarShapeWrapData::maxSize() const
+{
+    return {m_data.buffer.varShapeStrided.maxWidth, m_data.buffer.varShapeStrided.maxHeight};
+}
+
+ImageFormat ImageBatchVarShapeWrapData::uniqueFormat() const
+{
+    return ImageFormat{m_data.buffer.varShapeStrided.uniqueFormat};
+}
+
+IAllocator &ImageBatchVarShapeWrapData::alloc() const
+{
+    return GetDefaultAllocator();
+}
+
+void ImageBatchVarShapeWrapData::exportData(CUstream, NVCVImageBatchData &data) const
+{
+    data = m_data;
+}
+
+void ImageBatchVarShapeWrapData::getImages(int32_t, NVCVImageHandle *, int32_t) const
+{
+    throw Exception(NVCV_ERROR_INVALID_OPERATION, "Image batch wraps device data, it doesn't hold image objects");
+}
+
+void ImageBatchVarShapeWrapData::pushImages(const NVCVImageHandle *, int32_t)
+{
+    throw Exception(NVCV_ERROR_INVALID_OPERATION, "Images can't be added to an image batch that wraps device data");
+}
+
+void ImageBatchVarShapeWrapData::pushImages(NVCVPushImageFunc, void *)
+{
+    throw Exception(NVCV_ERROR_INVALID_OPERATION, "Images can't be added to an image batch that wraps device data");
+}
+
+void ImageBatchVarShapeWrapData::popImages(int32_t)
+{
+    throw Exception(NVCV_ERROR_INVALID_OPERATION,
+                    "Images can't be removed from an image batch that wraps device data");
+}
+
+void ImageBatchVarShapeWrapData::setActiveMask(NVCVTensorHandle, const uint8_t *)
+{
+    throw Exception(NVCV_ERROR_INVALID_OPERATION,
+                    "The active mask of an image batch that wraps device data must be given in the data");
+}
+
+void ImageBatchVarShapeWrapData::setImage(int32_t, NVCVImageHandle)
+{
+    throw Exception(NVCV_ERROR_INVALID_OPERATION, "Images can't be replaced in an image batch that wraps device data");
+}
+
+void ImageBatchVarShapeWrapData::clear()
+{
+    throw Exception(NVCV_ERROR_INVALID_OPERATION,
+                    "Images can't be removed from an image batch that wraps device data");
+}
+
+void ImageBatchVarShapeWrapData::setActiveMask(NVCVTensorHandle, const uint8_t *)
+{
+    throw Exception(NVCV_ERROR_INVALID_OPERATION,
+                    "The active mask of an image batch that wraps device data must be given in the data");
+}
+
+} // namespace nvcv::priv
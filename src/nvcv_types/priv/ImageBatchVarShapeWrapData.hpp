@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_IMAGEBATCHVARSHAPE_WRAPDATA_HPP
+#define NVCV_CORE_PRIV_IMAGEBATCHVARSHAPE_WRAPDATA_HPP
+
+#include "IImageBatch.hpp"
+
+#include <vector>
+
+namespace nvcv::priv {
+
+// Varshape image batch whose image descriptors are already on the device,
+// e.g. written by a decoder. Nothing is uploaded when exporting it, and its
+// contents can't be modified through the batch.
+class ImageBatchVarShapeWrapData final : public CoreObjectBase<IImageBatchVarShape>
+{
+public:
+    explicit ImageBatchVarShapeWrapData(const NVCVImageBatchData &data, NVCVImageBatchDataCleanupFunc cleanup,
+                                        void *ctxCleanup);
+    ~ImageBatchVarShapeWrapData();
+
+    int32_t capacity() const override;
+    int32_t numImages() const override;
+
+    Size2D      maxSize() const override;
+    ImageFormat uniqueFormat() const override;
+
+    NVCVTypeImageBatch type() const override;
+
+    IAllocator &alloc() const override;
+
+    void getImages(int32_t begIndex, NVCVImageHandle *outImages, int32_t numImages) const override;
+
+    void exportData(CUstream stream, NVCVImageBatchData &data) const override;
+
+    void pushImages(const NVCVImageHandle *images, int32_t numImages) override;
+    void pushImages(NVCVPushImageFunc cbPushImage, void *ctxCallback) override;
+    void popImages(int32_t numImages) override;
+    void setImage(int32_t index, NVCVImageHandle image) override;
+    void clear() override;
+    void setActiveMask(NVCVTensorHandle mask, const uint8_t *flags) override;
+
+private:
+    NVCVImageBatchData m_data;
+
+    NVCVImageBatchDataCleanupFunc m_cleanup;
+    void                         *m_ctxCleanup;
+
+    // Used as host format list when the caller only provides the unique format.
+    std::vector<NVCVImageFormat> m_hostFormats;
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_IMAGEBATCHVARSHAPE_WRAPDATA_HPP
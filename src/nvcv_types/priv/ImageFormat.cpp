@@ -443,11 +443,6 @@ int ImageFormat::planeBPP(int plane) const noexcept
     return GetBitsPerPixel(this->planePacking(plane));
 }
 
-NVCVSwizzle ImageFormat::swizzle() const noexcept
-{
-    return static_cast<NVCVSwizzle>(ExtractBitfield(m_format, 0, 3 * 4));
-}
-
 NVCVColorModel ImageFormat::colorModel() const noexcept
 {
     if (m_format == NVCV_IMAGE_FORMAT_NONE)
@@ -510,11 +505,6 @@ ColorSpec ImageFormat::colorSpec() const noexcept
     }
 }
 
-NVCVMemLayout ImageFormat::memLayout() const noexcept
-{
-    return static_cast<NVCVMemLayout>(ExtractBitfield(m_format, 12, 3));
-}
-
 ColorFormat ImageFormat::colorFormat() const noexcept
 {
     ColorFormat colorFormat{this->colorModel()};
@@ -76,8 +76,8 @@ public:
     ImageFormat colorSpec(ColorSpec newColorSpec) const;
     ColorSpec   colorSpec() const noexcept;
 
-    ImageFormat   memLayout(NVCVMemLayout newDataKind) const;
-    NVCVMemLayout memLayout() const noexcept;
+    ImageFormat             memLayout(NVCVMemLayout newDataKind) const;
+    constexpr NVCVMemLayout memLayout() const noexcept;
 
     ImageFormat                   rawPattern(NVCVRawPattern newRawPattern) const;
     std::optional<NVCVRawPattern> rawPattern() const noexcept;
@@ -92,7 +92,7 @@ public:
     ColorFormat colorFormat() const noexcept;
 
     int                    bpp(int plane) const noexcept;
-    NVCVSwizzle            swizzle() const noexcept;
+    constexpr NVCVSwizzle  swizzle() const noexcept;
     NVCVColorModel         colorModel() const noexcept;
     int                    blockHeightLog2() const noexcept;
     int                    numChannels() const noexcept;
@@ -192,6 +192,16 @@ constexpr NVCVDataKind ImageFormat::dataKind() const noexcept
     return (NVCVDataKind)ExtractBitfield(m_format, 61, 3);
 }
 
+constexpr NVCVMemLayout ImageFormat::memLayout() const noexcept
+{
+    return static_cast<NVCVMemLayout>(ExtractBitfield(m_format, 12, 3));
+}
+
+constexpr NVCVSwizzle ImageFormat::swizzle() const noexcept
+{
+    return static_cast<NVCVSwizzle>(ExtractBitfield(m_format, 0, 3 * 4));
+}
+
 bool HasSameDataLayout(ImageFormat a, ImageFormat b) noexcept;
 
 // If `cspace` colorspace is undefined, infer its components from 'source'.
@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IpcRegistry.hpp"
+
+#include "Exception.hpp"
+
+#include <util/CheckError.hpp>
+
+#include <cstring>
+
+namespace nvcv::priv {
+
+namespace {
+
+bool operator==(const cudaIpcMemHandle_t &a, const cudaIpcMemHandle_t &b)
+{
+    return std::memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+// Start of the allocation holding ptr. The runtime has no equivalent of
+// cuMemGetAddressRange, it's fetched from the driver so that we don't need
+// to link against it.
+std::byte *GetAllocationBase(void *ptr)
+{
+    using MemGetAddressRangeFunc = int (*)(unsigned long long *base, size_t *size, unsigned long long ptr);
+
+    static MemGetAddressRangeFunc memGetAddressRange = []
+    {
+        void *fn = nullptr;
+#if CUDART_VERSION >= 12050
+        cudaDriverEntryPointQueryResult result;
+        NVCV_CHECK_THROW(
+            cudaGetDriverEntryPointByVersion("cuMemGetAddressRange", &fn, 11030, cudaEnableDefault, &result));
+#elif CUDART_VERSION >= 11030
+        NVCV_CHECK_THROW(cudaGetDriverEntryPoint("cuMemGetAddressRange", &fn, cudaEnableDefault));
+#else
+        throw Exception(NVCV_ERROR_NOT_IMPLEMENTED, "Exporting memory requires CUDA 11.3 or later");
+#endif
+        if (fn == nullptr)
+        {
+            throw Exception(NVCV_ERROR_INTERNAL, "Couldn't get cuMemGetAddressRange from the cuda driver");
+        }
+        return reinterpret_cast<MemGetAddressRangeFunc>(fn);
+    }();
+
+    unsigned long long base = 0;
+    size_t             size = 0;
+    if (memGetAddressRange(&base, &size, reinterpret_cast<unsigned long long>(ptr)) != 0)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Memory at %p isn't a cuda allocation", ptr);
+    }
+    return reinterpret_cast<std::byte *>(base);
+}
+
+} // namespace
+
+IpcRegistry::~IpcRegistry()
+{
+    for (auto &[stream, ev] : m_events)
+    {
+        NVCV_CHECK_LOG(cudaEventDestroy(ev));
+    }
+
+    // All objects were destroyed by now, mappings left were leaked by them
+    for (Mapping &m : m_mappings)
+    {
+        NVCV_CHECK_LOG(cudaIpcCloseMemHandle(m.allocBase));
+    }
+}
+
+cudaIpcMemHandle_t IpcRegistry::exportMem(void *ptr, std::byte *&allocBase)
+{
+    cudaPointerAttributes attrs = {};
+    NVCV_CHECK_THROW(cudaPointerGetAttributes(&attrs, ptr));
+    if (attrs.type != cudaMemoryTypeDevice)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Only device memory can be exported");
+    }
+
+    allocBase = GetAllocationBase(ptr);
+
+    cudaIpcMemHandle_t handle;
+    if (cudaIpcGetMemHandle(&handle, allocBase) != cudaSuccess)
+    {
+        cudaGetLastError(); // clear the error
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                        "Memory can't be exported to other processes, it must be allocated with cudaMalloc");
+    }
+    return handle;
+}
+
+cudaIpcEventHandle_t IpcRegistry::recordEvent(cudaStream_t stream)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+
+    cudaEvent_t &ev = m_events[stream];
+    if (ev == nullptr)
+    {
+        cudaError_t err = cudaEventCreateWithFlags(&ev, cudaEventInterprocess | cudaEventDisableTiming);
+        if (err != cudaSuccess)
+        {
+            m_events.erase(stream);
+            NVCV_CHECK_THROW(err);
+        }
+    }
+
+    NVCV_CHECK_THROW(cudaEventRecord(ev, stream));
+
+    cudaIpcEventHandle_t handle;
+    NVCV_CHECK_THROW(cudaIpcGetEventHandle(&handle, ev));
+    return handle;
+}
+
+std::byte *IpcRegistry::openMem(const cudaIpcMemHandle_t &handle)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+
+    // The same allocation can't be mapped twice, objects in it share its mapping
+    for (Mapping &m : m_mappings)
+    {
+        if (m.handle == handle)
+        {
+            ++m.refCount;
+            return m.allocBase;
+        }
+    }
+
+    void *ptr = nullptr;
+    NVCV_CHECK_THROW(cudaIpcOpenMemHandle(&ptr, handle, cudaIpcMemLazyEnablePeerAccess));
+
+    m_mappings.push_back({handle, static_cast<std::byte *>(ptr), 1});
+    return m_mappings.back().allocBase;
+}
+
+void IpcRegistry::closeMem(std::byte *allocBase) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+
+    for (auto it = m_mappings.begin(); it != m_mappings.end(); ++it)
+    {
+        if (it->allocBase == allocBase)
+        {
+            if (--it->refCount == 0)
+            {
+                NVCV_CHECK_LOG(cudaIpcCloseMemHandle(allocBase));
+                m_mappings.erase(it);
+            }
+            return;
+        }
+    }
+}
+
+} // namespace nvcv::priv
@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_IPC_REGISTRY_HPP
+#define NVCV_CORE_PRIV_IPC_REGISTRY_HPP
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace nvcv::priv {
+
+// CUDA IPC resources of the process: the interprocess events recorded when
+// exporting objects, and the memory of other processes mapped when importing.
+class IpcRegistry
+{
+public:
+    ~IpcRegistry();
+
+    // Returns the allocation that holds ptr, its start is written to allocBase.
+    // Throws INVALID_ARGUMENT if it can't be exported.
+    cudaIpcMemHandle_t exportMem(void *ptr, std::byte *&allocBase);
+
+    // Records the event of stream and returns its handle. There's one event
+    // per stream, recorded again by each export. An importer that waits on it
+    // later waits for more work, but that work comes after what it needs.
+    cudaIpcEventHandle_t recordEvent(cudaStream_t stream);
+
+    // Maps the allocation on first use, or returns its mapping, and adds a reference to it.
+    std::byte *openMem(const cudaIpcMemHandle_t &handle);
+
+    // Drops a reference to the mapping at allocBase, unmapping it when it was the last one.
+    void closeMem(std::byte *allocBase) noexcept;
+
+private:
+    struct Mapping
+    {
+        cudaIpcMemHandle_t handle;
+        std::byte         *allocBase;
+        int                refCount;
+    };
+
+    std::mutex                                    m_mtx;
+    std::unordered_map<cudaStream_t, cudaEvent_t> m_events;
+    std::vector<Mapping>                          m_mappings; // few, searched linearly
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_IPC_REGISTRY_HPP
@@ -31,7 +31,10 @@ template<class Node, std::enable_if_t<IsForwardListNode<Node>, int> = 0>
 class LockFreeStack
 {
 public:
-    Node *pop() noexcept
+    // If retries isn't null, the number of atomic updates that failed due to
+    // concurrent access to the stack is added to it.
+
+    Node *pop(int *retries = nullptr) noexcept
     {
         // Lock the stack's head so that we can pop current head and set the
         // new one to curhead->next atomically below.
@@ -43,11 +46,12 @@ public:
                 return nullptr;
             }
 
-            if (m_head.compare_exchange_weak(head, doGetLocked(head), std::memory_order_relaxed,
-                                             std::memory_order_release))
+            if (m_head.compare_exchange_weak(head, doGetLocked(head), std::memory_order_acquire,
+                                             std::memory_order_relaxed))
             {
                 break;
             }
+            doCountRetry(retries);
         }
 
         // Set the newHead to oldHead->next and return oldHead
@@ -59,41 +63,89 @@ public:
 
             newHead = doGetUnlocked(oldHead)->next;
         }
-        while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_relaxed, std::memory_order_release));
+        while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_release, std::memory_order_relaxed));
 
         return doGetUnlocked(oldHead);
     }
 
-    void push(Node *newNode) noexcept
+    // Pops up to maxCount nodes at once. They're returned as a null-terminated
+    // list, its length is written to count.
+    Node *popStack(int maxCount, int &count, int *retries = nullptr) noexcept
+    {
+        assert(maxCount > 0);
+
+        Node *head;
+        for (;;)
+        {
+            head = doGetUnlocked(m_head.load(std::memory_order_relaxed));
+            if (!head)
+            {
+                count = 0;
+                return nullptr;
+            }
+
+            if (m_head.compare_exchange_weak(head, doGetLocked(head), std::memory_order_acquire,
+                                             std::memory_order_relaxed))
+            {
+                break;
+            }
+            doCountRetry(retries);
+        }
+
+        // While the head is locked, no one else can modify the stack.
+        Node *last = head;
+        count      = 1;
+        while (count < maxCount && last->next)
+        {
+            last = last->next;
+            ++count;
+        }
+
+        Node *newHead = last->next;
+        last->next    = nullptr;
+        m_head.store(newHead, std::memory_order_release); // also unlocks the head
+
+        return head;
+    }
+
+    void push(Node *newNode, int *retries = nullptr) noexcept
     {
         Node *oldHead;
-        do
+        for (;;)
         {
             oldHead       = doGetUnlocked(m_head.load(std::memory_order_relaxed));
             newNode->next = oldHead;
+            if (m_head.compare_exchange_weak(oldHead, newNode, std::memory_order_release, std::memory_order_relaxed))
+            {
+                break;
+            }
+            doCountRetry(retries);
         }
-        while (!m_head.compare_exchange_weak(oldHead, newNode, std::memory_order_relaxed, std::memory_order_release));
     }
 
     Node *release() noexcept
     {
         Node *h = m_head.load(std::memory_order_relaxed);
-        while (!m_head.compare_exchange_weak(h, nullptr, std::memory_order_relaxed, std::memory_order_release))
+        while (!m_head.compare_exchange_weak(h, nullptr, std::memory_order_acquire, std::memory_order_relaxed))
         {
         }
 
         return h;
     }
 
-    void pushStack(Node *newHead, Node *last) noexcept
+    void pushStack(Node *newHead, Node *last, int *retries = nullptr) noexcept
     {
         Node *oldHead;
-        do
+        for (;;)
         {
             oldHead    = doGetUnlocked(m_head.load(std::memory_order_relaxed));
             last->next = oldHead;
+            if (m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_release, std::memory_order_relaxed))
+            {
+                break;
+            }
+            doCountRetry(retries);
         }
-        while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_relaxed, std::memory_order_release));
     }
 
     Node *top() const
@@ -114,6 +166,14 @@ public:
 private:
     std::atomic<Node *> m_head = nullptr;
 
+    static void doCountRetry(int *retries) noexcept
+    {
+        if (retries)
+        {
+            ++*retries;
+        }
+    }
+
     template<typename T>
     static T *doGetUnlocked(T *maybe_locked)
     {
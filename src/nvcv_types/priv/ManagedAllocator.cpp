@@ -0,0 +1,153 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ManagedAllocator.hpp"
+
+#include <cuda_runtime.h>
+#include <util/CheckError.hpp>
+
+namespace nvcv::priv {
+
+ManagedAllocator::ManagedAllocator(const NVCVManagedAllocatorParams *params)
+{
+    if (params)
+    {
+        m_params = *params;
+    }
+    else
+    {
+        m_params.mode         = NVCV_MANAGED_MEM_AUTO;
+        m_params.adviseDevice = 1;
+    }
+
+    int dev;
+    NVCV_CHECK_THROW(cudaGetDevice(&dev));
+
+    switch (m_params.mode)
+    {
+    case NVCV_MANAGED_MEM_AUTO:
+    {
+        // On integrated GPUs host memory is device memory, mapping it avoids page migrations altogether.
+        int integrated;
+        NVCV_CHECK_THROW(cudaDeviceGetAttribute(&integrated, cudaDevAttrIntegrated, dev));
+        m_params.mode = integrated ? NVCV_MANAGED_MEM_MAPPED : NVCV_MANAGED_MEM_UNIFIED;
+        break;
+    }
+
+    case NVCV_MANAGED_MEM_UNIFIED:
+    {
+        int managed;
+        NVCV_CHECK_THROW(cudaDeviceGetAttribute(&managed, cudaDevAttrManagedMemory, dev));
+        if (!managed)
+        {
+            throw Exception(NVCV_ERROR_NOT_COMPATIBLE, "Device %d doesn't support unified memory", dev);
+        }
+        break;
+    }
+
+    case NVCV_MANAGED_MEM_MAPPED:
+        break;
+
+    default:
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Invalid managed memory mode %d", (int)m_params.mode);
+    }
+
+    if (m_params.mode == NVCV_MANAGED_MEM_MAPPED)
+    {
+        // Device pointers are only the same as the host ones with unified addressing.
+        int unifiedAddressing;
+        NVCV_CHECK_THROW(cudaDeviceGetAttribute(&unifiedAddressing, cudaDevAttrUnifiedAddressing, dev));
+        if (!unifiedAddressing)
+        {
+            throw Exception(NVCV_ERROR_NOT_COMPATIBLE, "Device %d doesn't support mapped host memory", dev);
+        }
+    }
+}
+
+NVCVManagedMemMode ManagedAllocator::mode() const noexcept
+{
+    return m_params.mode;
+}
+
+void *ManagedAllocator::doAllocHostMem(int64_t size, int32_t align)
+{
+    return GetDefaultAllocator().allocHostMem(size, align);
+}
+
+void ManagedAllocator::doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept
+{
+    GetDefaultAllocator().freeHostMem(ptr, size, align);
+}
+
+void *ManagedAllocator::doAllocHostPinnedMem(int64_t size, int32_t align, uint32_t flags)
+{
+    return GetDefaultAllocator().allocHostPinnedMem(size, align, flags);
+}
+
+void ManagedAllocator::doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept
+{
+    GetDefaultAllocator().freeHostPinnedMem(ptr, size, align, flags);
+}
+
+void *ManagedAllocator::doAllocCudaMem(int64_t size, int32_t align)
+{
+    void *ptr = nullptr;
+
+    if (m_params.mode == NVCV_MANAGED_MEM_MAPPED)
+    {
+        NVCV_CHECK_THROW(::cudaHostAlloc(&ptr, size, cudaHostAllocMapped));
+    }
+    else
+    {
+        int dev;
+        NVCV_CHECK_THROW(cudaGetDevice(&dev));
+
+        NVCV_CHECK_THROW(::cudaMallocManaged(&ptr, size, cudaMemAttachGlobal));
+
+        if (m_params.adviseDevice)
+        {
+            // Pages stay on the device, the host maps them instead of faulting them back.
+            NVCV_CHECK_LOG(cudaMemAdvise(ptr, size, cudaMemAdviseSetPreferredLocation, dev));
+            NVCV_CHECK_LOG(cudaMemAdvise(ptr, size, cudaMemAdviseSetAccessedBy, cudaCpuDeviceId));
+        }
+    }
+
+    if (reinterpret_cast<uintptr_t>(ptr) % align != 0)
+    {
+        this->doFreeCudaMem(ptr, size, align);
+        throw Exception(NVCV_ERROR_INTERNAL, "Can't allocate %ld bytes of managed memory with alignment at %d bytes",
+                        size, align);
+    }
+    return ptr;
+}
+
+void ManagedAllocator::doFreeCudaMem(void *ptr, int64_t size, int32_t align) noexcept
+{
+    (void)size;
+    (void)align;
+
+    if (m_params.mode == NVCV_MANAGED_MEM_MAPPED)
+    {
+        NVCV_CHECK_LOG(::cudaFreeHost(ptr));
+    }
+    else
+    {
+        NVCV_CHECK_LOG(::cudaFree(ptr));
+    }
+}
+
+} // namespace nvcv::priv
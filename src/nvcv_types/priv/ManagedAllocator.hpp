@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_MANAGED_ALLOCATOR_HPP
+#define NVCV_CORE_PRIV_MANAGED_ALLOCATOR_HPP
+
+#include "IAllocator.hpp"
+
+#include <nvcv/alloc/Allocator.h>
+
+namespace nvcv::priv {
+
+// Allocates cuda memory that is also accessible by the host, either as
+// unified memory or as mapped host-pinned memory. Host and host-pinned
+// memory are allocated as by the default allocator.
+class ManagedAllocator final : public CoreObjectBase<IAllocator>
+{
+public:
+    explicit ManagedAllocator(const NVCVManagedAllocatorParams *params);
+
+    // Mode actually used, AUTO is resolved at construction.
+    NVCVManagedMemMode mode() const noexcept;
+
+private:
+    NVCVManagedAllocatorParams m_params;
+
+    void *doAllocHostMem(int64_t size, int32_t align) override;
+    void  doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept override;
+
+    void *doAllocHostPinnedMem(int64_t size, int32_t align, uint32_t flags) override;
+    void  doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept override;
+
+    void *doAllocCudaMem(int64_t size, int32_t align) override;
+    void  doFreeCudaMem(void *ptr, int64_t size, int32_t align) noexcept override;
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_MANAGED_ALLOCATOR_HPP
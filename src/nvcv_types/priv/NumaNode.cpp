@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NumaNode.hpp"
+
+#include <cuda_runtime.h>
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cctype>
+#include <climits>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace nvcv::priv {
+
+namespace {
+
+int ReadDeviceNumaNode(int device)
+{
+    char busId[32];
+    if (cudaDeviceGetPCIBusId(busId, sizeof(busId), device) != cudaSuccess)
+    {
+        cudaGetLastError();
+        return -1;
+    }
+
+    // cuda reports the bus id in upper case, sysfs has it in lower case.
+    std::string path = "/sys/bus/pci/devices/";
+    for (const char *c = busId; *c != '\0'; ++c)
+    {
+        path += static_cast<char>(std::tolower(static_cast<unsigned char>(*c)));
+    }
+    path += "/numa_node";
+
+    int           node = -1;
+    std::ifstream in(path);
+    if (!(in >> node))
+    {
+        return -1;
+    }
+    return node;
+}
+
+} // namespace
+
+int GetDeviceNumaNode(int device)
+{
+    static std::mutex                   mtx;
+    static std::unordered_map<int, int> cache;
+
+    std::unique_lock lk(mtx);
+
+    auto it = cache.find(device);
+    if (it == cache.end())
+    {
+        it = cache.emplace(device, ReadDeviceNumaNode(device)).first;
+    }
+    return it->second;
+}
+
+int GetCurrentDeviceNumaNode()
+{
+    int device;
+    if (cudaGetDevice(&device) != cudaSuccess)
+    {
+        cudaGetLastError();
+        return -1;
+    }
+    return GetDeviceNumaNode(device);
+}
+
+NumaNodeScope::NumaNodeScope(int node) noexcept
+{
+    // Only nodes that fit in the single-word mask we pass to the kernel, which uses maxnode-1 bits.
+    if (node < 0 || node >= static_cast<int>(sizeof(unsigned long) * CHAR_BIT) - 1)
+    {
+        return;
+    }
+
+    m_prevNodeMask = 0;
+    if (syscall(SYS_get_mempolicy, &m_prevMode, &m_prevNodeMask, sizeof(m_prevNodeMask) * CHAR_BIT, nullptr, 0) != 0)
+    {
+        return;
+    }
+
+    unsigned long nodeMask = 1UL << node;
+    m_active = syscall(SYS_set_mempolicy, MPOL_PREFERRED, &nodeMask, sizeof(nodeMask) * CHAR_BIT) == 0;
+}
+
+NumaNodeScope::~NumaNodeScope()
+{
+    if (m_active)
+    {
+        syscall(SYS_set_mempolicy, m_prevMode, m_prevMode == MPOL_DEFAULT ? nullptr : &m_prevNodeMask,
+                sizeof(m_prevNodeMask) * CHAR_BIT);
+    }
+}
+
+} // namespace nvcv::priv
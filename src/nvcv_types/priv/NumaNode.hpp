@@ -0,0 +1,49 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_NUMA_NODE_HPP
+#define NVCV_CORE_PRIV_NUMA_NODE_HPP
+
+namespace nvcv::priv {
+
+// NUMA node closest to the given CUDA device, as reported by sysfs,
+// or -1 if it isn't known, e.g. on systems without NUMA.
+int GetDeviceNumaNode(int device);
+
+// Same as above, for the current device.
+int GetCurrentDeviceNumaNode();
+
+// While in scope, memory pages first touched by the calling thread are placed
+// preferably on the given node. Nothing is done if the node is negative.
+class NumaNodeScope
+{
+public:
+    explicit NumaNodeScope(int node) noexcept;
+    ~NumaNodeScope();
+
+    NumaNodeScope(const NumaNodeScope &)            = delete;
+    NumaNodeScope &operator=(const NumaNodeScope &) = delete;
+
+private:
+    bool          m_active = false;
+    int           m_prevMode;
+    unsigned long m_prevNodeMask;
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_NUMA_NODE_HPP
@@ -0,0 +1,467 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PoolAllocator.hpp"
+
+#include "DeferredRelease.hpp"
+#include "IContext.hpp"
+#include "NumaNode.hpp"
+
+#include <cuda_runtime.h>
+#include <util/CheckError.hpp>
+#include <util/DeviceGuard.hpp>
+#include <util/Math.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace nvcv::priv {
+
+namespace {
+
+// Block sizes are rounded up to these granularities so that buffers
+// with slightly different sizes can share the same cached blocks.
+constexpr int64_t kSmallBlockGranularity = 512;
+constexpr int64_t kLargeBlockGranularity = 128 * 1024;
+constexpr int64_t kLargeBlockThreshold   = 1024 * 1024;
+
+int64_t CalcBlockSize(int64_t size)
+{
+    if (size < kLargeBlockThreshold)
+    {
+        return util::RoundUp(std::max<int64_t>(size, 1), kSmallBlockGranularity);
+    }
+    else
+    {
+        return util::RoundUp(size, kLargeBlockGranularity);
+    }
+}
+
+void *CudaAlloc(int64_t size, uint32_t flags)
+{
+    (void)flags;
+
+    void *ptr = nullptr;
+    NVCV_CHECK_THROW(::cudaMalloc(&ptr, size));
+    return ptr;
+}
+
+void CudaFree(void *ptr) noexcept
+{
+    NVCV_CHECK_LOG(::cudaFree(ptr));
+}
+
+void *HostPinnedAlloc(int64_t size, uint32_t flags)
+{
+    NumaNodeScope numa(flags & NVCV_HOST_PINNED_MEM_NUMA_LOCAL ? GetCurrentDeviceNumaNode() : -1);
+
+    void *ptr = nullptr;
+    NVCV_CHECK_THROW(::cudaHostAlloc(&ptr, size, GetCudaHostAllocFlags(flags)));
+    return ptr;
+}
+
+void HostPinnedFree(void *ptr) noexcept
+{
+    NVCV_CHECK_LOG(::cudaFreeHost(ptr));
+}
+
+NVCVPoolAllocatorParams NormalizeParams(const NVCVPoolAllocatorParams *params)
+{
+    NVCVPoolAllocatorParams out;
+
+    if (params == nullptr)
+    {
+        out.releaseThreshold = -1;
+        out.maxBlockSize     = -1;
+    }
+    else
+    {
+        out = *params;
+    }
+
+    if (out.releaseThreshold < 0)
+    {
+        out.releaseThreshold = std::numeric_limits<int64_t>::max();
+    }
+    if (out.maxBlockSize < 0)
+    {
+        out.maxBlockSize = std::numeric_limits<int64_t>::max();
+    }
+
+    return out;
+}
+
+} // namespace
+
+// Pool --------------------------------------
+
+PoolAllocator::Pool::Pool(AllocFunc fnAlloc, FreeFunc fnFree, const NVCVPoolAllocatorParams &params, int device,
+                          uint32_t flags)
+    : m_fnAlloc(fnAlloc)
+    , m_fnFree(fnFree)
+    , m_params(params)
+    , m_device(device)
+    , m_flags(flags)
+{
+}
+
+PoolAllocator::Pool::~Pool()
+{
+    this->trim();
+
+    for (auto &itEvents : m_idleEvents)
+    {
+        for (cudaEvent_t ev : itEvents.second)
+        {
+            NVCV_CHECK_LOG(::cudaEventDestroy(ev));
+        }
+    }
+}
+
+void *PoolAllocator::Pool::alloc(int64_t size, int32_t align)
+{
+    // Too big to be cached? Go straight to the driver.
+    if (size > m_params.maxBlockSize)
+    {
+        return m_fnAlloc(size, m_flags);
+    }
+
+    int64_t blockSize = CalcBlockSize(size);
+
+    std::unique_lock lk(m_mtx);
+
+    // Best fit among the cached blocks, as long as we don't waste
+    // more than half of the block.
+    auto itBlock = m_freeBlocks.lower_bound(blockSize);
+    while (itBlock != m_freeBlocks.end() && itBlock->first < 2 * blockSize)
+    {
+        const FreeBlock &block = itBlock->second;
+
+        // Blocks whose previous work isn't done yet are skipped, not waited for.
+        if (reinterpret_cast<uintptr_t>(block.ptr) % align == 0
+            && (block.ev == nullptr || ::cudaEventQuery(block.ev) == cudaSuccess))
+        {
+            void *ptr = block.ptr;
+            doRecycleEvent(block.ev, block.evDevice);
+            m_cachedBytes -= itBlock->first;
+            m_freeBlocks.erase(itBlock);
+            return ptr;
+        }
+        ++itBlock;
+    }
+
+    void *ptr;
+    try
+    {
+        ptr = m_fnAlloc(blockSize, m_flags);
+    }
+    catch (const Exception &e)
+    {
+        if (e.code() != NVCV_ERROR_OUT_OF_MEMORY || m_freeBlocks.empty())
+        {
+            throw;
+        }
+
+        // Give the cached memory back to the driver and try again.
+        doReleaseCached();
+        ptr = m_fnAlloc(blockSize, m_flags);
+    }
+
+    if (reinterpret_cast<uintptr_t>(ptr) % align != 0)
+    {
+        m_fnFree(ptr);
+        throw Exception(NVCV_ERROR_INTERNAL, "Can't allocate %ld bytes of memory with alignment at %d bytes", size,
+                        align);
+    }
+
+    m_blockSize.emplace(ptr, blockSize);
+    return ptr;
+}
+
+void PoolAllocator::Pool::free(void *ptr) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    std::unique_lock lk(m_mtx);
+
+    auto itSize = m_blockSize.find(ptr);
+    if (itSize == m_blockSize.end())
+    {
+        // Wasn't allocated from the pool.
+        lk.unlock();
+        m_fnFree(ptr);
+        return;
+    }
+
+    int64_t blockSize = itSize->second;
+
+    // Blocks whose release was deferred until their work was done need no event.
+    // Without one the block can't be reused safely, the driver waits for the
+    // device as it frees it.
+    cudaEvent_t ev       = nullptr;
+    int         evDevice = -1;
+    if (m_cachedBytes + blockSize > m_params.releaseThreshold
+        || !(IsReleasingCompletedWork() || doRecordFreeEvent(ev, evDevice)))
+    {
+        m_blockSize.erase(itSize);
+        lk.unlock();
+        m_fnFree(ptr);
+        return;
+    }
+
+    m_freeBlocks.emplace(blockSize, FreeBlock{ptr, ev, evDevice});
+    m_cachedBytes += blockSize;
+}
+
+bool PoolAllocator::Pool::doRecordFreeEvent(cudaEvent_t &ev, int &evDevice) noexcept
+{
+    try
+    {
+        util::DeviceGuard guard(m_device);
+
+        // Unbound host-pinned pools guard the current device only.
+        evDevice = m_device;
+        if (evDevice < 0)
+        {
+            NVCV_CHECK_THROW(::cudaGetDevice(&evDevice));
+        }
+
+        std::vector<cudaEvent_t> &idleEvents = m_idleEvents[evDevice];
+        if (!idleEvents.empty())
+        {
+            ev = idleEvents.back();
+            idleEvents.pop_back();
+        }
+        else if (!NVCV_CHECK_LOG(::cudaEventCreateWithFlags(&ev, cudaEventDisableTiming)))
+        {
+            ev = nullptr;
+            return false;
+        }
+
+        // The legacy stream waits for the work of all blocking streams.
+        if (!NVCV_CHECK_LOG(::cudaEventRecord(ev, cudaStreamLegacy)))
+        {
+            NVCV_CHECK_LOG(::cudaEventDestroy(ev));
+            ev = nullptr;
+            return false;
+        }
+        return true;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+void PoolAllocator::Pool::doRecycleEvent(cudaEvent_t ev, int evDevice) noexcept
+{
+    if (ev == nullptr)
+    {
+        return;
+    }
+
+    try
+    {
+        m_idleEvents[evDevice].push_back(ev);
+    }
+    catch (...)
+    {
+        NVCV_CHECK_LOG(::cudaEventDestroy(ev));
+    }
+}
+
+void PoolAllocator::Pool::trim() noexcept
+{
+    std::unique_lock lk(m_mtx);
+    doReleaseCached();
+}
+
+void PoolAllocator::Pool::doReleaseCached() noexcept
+{
+    // Freeing waits for the device, the events are done afterwards.
+    for (auto it = m_freeBlocks.begin(); it != m_freeBlocks.end(); ++it)
+    {
+        m_blockSize.erase(it->second.ptr);
+        m_fnFree(it->second.ptr);
+        doRecycleEvent(it->second.ev, it->second.evDevice);
+    }
+    m_freeBlocks.clear();
+    m_cachedBytes = 0;
+}
+
+// PoolAllocator --------------------------------------
+
+PoolAllocator::PoolAllocator(const NVCVPoolAllocatorParams *params, int32_t device)
+    : m_params(NormalizeParams(params))
+    , m_device(device)
+{
+    int numDevices = 0;
+    NVCV_CHECK_THROW(::cudaGetDeviceCount(&numDevices));
+    m_devPools.resize(numDevices);
+
+    if (m_device >= 0)
+    {
+        if (m_device >= numDevices)
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Invalid CUDA device %d, there are %d devices", m_device,
+                            numDevices);
+        }
+
+        // Created upfront so that allocations don't need to look it up under the lock.
+        m_devPools[m_device] = std::make_unique<Pool>(&CudaAlloc, &CudaFree, m_params, m_device);
+    }
+
+    for (int flags = 0; flags < kNumHostPinnedPools; ++flags)
+    {
+        m_hostPinnedPools[flags]
+            = std::make_unique<Pool>(&HostPinnedAlloc, &HostPinnedFree, m_params, m_device, flags);
+    }
+}
+
+PoolAllocator::~PoolAllocator()
+{
+    // Memory of destroyed objects might still be waiting to come back.
+    GlobalContext().deferredRelease().flush(this);
+
+    // Pools release their cached blocks when destroyed.
+}
+
+void PoolAllocator::trim() noexcept
+{
+    {
+        std::unique_lock lk(m_mtxDevPools);
+        for (std::unique_ptr<Pool> &pool : m_devPools)
+        {
+            if (pool)
+            {
+                pool->trim();
+            }
+        }
+    }
+
+    for (std::unique_ptr<Pool> &pool : m_hostPinnedPools)
+    {
+        pool->trim();
+    }
+}
+
+auto PoolAllocator::doGetDevicePool(int device) -> Pool &
+{
+    std::unique_lock lk(m_mtxDevPools);
+
+    if (device < 0 || device >= (int)m_devPools.size())
+    {
+        throw Exception(NVCV_ERROR_INTERNAL, "Invalid CUDA device %d", device);
+    }
+
+    std::unique_ptr<Pool> &pool = m_devPools[device];
+    if (!pool)
+    {
+        pool = std::make_unique<Pool>(&CudaAlloc, &CudaFree, m_params, device);
+    }
+    return *pool;
+}
+
+auto PoolAllocator::doGetCurrentDevicePool() -> Pool &
+{
+    int device = 0;
+    NVCV_CHECK_THROW(::cudaGetDevice(&device));
+    return doGetDevicePool(device);
+}
+
+void *PoolAllocator::doAllocHostMem(int64_t size, int32_t align)
+{
+    return GetDefaultAllocator().allocHostMem(size, align);
+}
+
+void PoolAllocator::doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept
+{
+    GetDefaultAllocator().freeHostMem(ptr, size, align);
+}
+
+void *PoolAllocator::doAllocHostPinnedMem(int64_t size, int32_t align, uint32_t flags)
+{
+    NVCV_ASSERT(flags < kNumHostPinnedPools);
+
+    // NUMA-local memory must be close to the bound device.
+    util::DeviceGuard guard(m_device);
+    return m_hostPinnedPools[flags]->alloc(size, align);
+}
+
+void PoolAllocator::doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept
+{
+    (void)size;
+    (void)align;
+
+    NVCV_ASSERT(flags < kNumHostPinnedPools);
+    m_hostPinnedPools[flags]->free(ptr);
+}
+
+int32_t PoolAllocator::doGetDevice() const noexcept
+{
+    return m_device;
+}
+
+void *PoolAllocator::doAllocCudaMem(int64_t size, int32_t align)
+{
+    if (m_device >= 0)
+    {
+        util::DeviceGuard guard(m_device);
+        return m_devPools[m_device]->alloc(size, align);
+    }
+
+    return doGetCurrentDevicePool().alloc(size, align);
+}
+
+void PoolAllocator::doFreeCudaMem(void *ptr, int64_t size, int32_t align) noexcept
+{
+    (void)size;
+    (void)align;
+
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    if (m_device >= 0)
+    {
+        m_devPools[m_device]->free(ptr);
+        return;
+    }
+
+    // Buffer might have been allocated when another device was current,
+    // we must return it to the pool it came from.
+    cudaPointerAttributes attrs;
+    if (!NVCV_CHECK_LOG(::cudaPointerGetAttributes(&attrs, ptr)))
+    {
+        return;
+    }
+
+    try
+    {
+        doGetDevicePool(attrs.device).free(ptr);
+    }
+    catch (...)
+    {
+        NVCV_ASSERT(!"Couldn't find the memory pool of the buffer being freed");
+    }
+}
+
+} // namespace nvcv::priv
@@ -0,0 +1,142 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_POOL_ALLOCATOR_HPP
+#define NVCV_CORE_PRIV_POOL_ALLOCATOR_HPP
+
+#include "IAllocator.hpp"
+
+#include <cuda_runtime.h>
+#include <nvcv/alloc/Allocator.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace nvcv::priv {
+
+// Caches device and host-pinned buffers returned by the user so that
+// subsequent allocations of similar size don't need to go to the driver.
+// Host memory is forwarded to the default allocator.
+// When bound to a device, all cuda memory comes from that device's pool,
+// whatever device is current.
+//
+// Unlike cudaFree, giving a buffer back doesn't wait for the device, work
+// still queued might be using it. An event is recorded on the legacy default
+// stream when a buffer is returned, which orders it after the work submitted
+// so far to all blocking streams, and the buffer is only handed out again
+// once that event completed. Work on streams created with
+// cudaStreamNonBlocking isn't covered, the objects using it must be released
+// through that stream, e.g. with nvcvTensorSetReleaseStream.
+// Host-pinned buffers of an unbound allocator are guarded on the device
+// current when they're returned only, work queued on other devices must be
+// done by then.
+class PoolAllocator final : public CoreObjectBase<IAllocator>
+{
+public:
+    explicit PoolAllocator(const NVCVPoolAllocatorParams *params, int32_t device = -1);
+    ~PoolAllocator();
+
+    // Returns all cached buffers back to the driver.
+    void trim() noexcept;
+
+private:
+    class Pool
+    {
+    public:
+        using AllocFunc = void *(*)(int64_t size, uint32_t flags);
+        using FreeFunc  = void (*)(void *ptr) noexcept;
+
+        // flags are passed unchanged to fnAlloc. Events guarding the returned
+        // blocks are recorded on device, or the current one if negative.
+        Pool(AllocFunc fnAlloc, FreeFunc fnFree, const NVCVPoolAllocatorParams &params, int device,
+             uint32_t flags = 0);
+        ~Pool();
+
+        void *alloc(int64_t size, int32_t align);
+        void  free(void *ptr) noexcept;
+        void  trim() noexcept;
+
+    private:
+        AllocFunc               m_fnAlloc;
+        FreeFunc                m_fnFree;
+        NVCVPoolAllocatorParams m_params;
+        int                     m_device;
+        uint32_t                m_flags;
+
+        std::mutex m_mtx;
+
+        struct FreeBlock
+        {
+            void       *ptr;
+            cudaEvent_t ev;       // completes once the work that could use the block is done, if any
+            int         evDevice; // device the event was recorded on
+        };
+
+        // Blocks given back, indexed by their size.
+        std::multimap<int64_t, FreeBlock> m_freeBlocks;
+        // Completed events, ready to be recorded again, indexed by the device
+        // they were created on since they can't be recorded on another one.
+        std::unordered_map<int, std::vector<cudaEvent_t>> m_idleEvents;
+        // Size of all blocks handed out by the pool, in use or not.
+        std::unordered_map<void *, int64_t> m_blockSize;
+
+        int64_t m_cachedBytes = 0;
+
+        void doReleaseCached() noexcept;
+        bool doRecordFreeEvent(cudaEvent_t &ev, int &evDevice) noexcept;
+        void doRecycleEvent(cudaEvent_t ev, int evDevice) noexcept;
+    };
+
+    NVCVPoolAllocatorParams m_params;
+    int32_t                 m_device;
+
+    // One pool per CUDA device, created on demand.
+    // Only the pool of the bound device exists if there is one.
+    std::mutex                         m_mtxDevPools;
+    std::vector<std::unique_ptr<Pool>> m_devPools;
+
+    // One pool per combination of NVCVHostPinnedMemFlag, indexed by the flags.
+    // NUMA-local buffers stay close to the device current when they were first
+    // allocated, binding the allocator to a device keeps them close to it.
+    static constexpr int kNumHostPinnedPools = 16;
+    static_assert((NVCV_HOST_PINNED_MEM_WRITE_COMBINED | NVCV_HOST_PINNED_MEM_PORTABLE | NVCV_HOST_PINNED_MEM_MAPPED
+                   | NVCV_HOST_PINNED_MEM_NUMA_LOCAL)
+                  < kNumHostPinnedPools);
+
+    std::unique_ptr<Pool> m_hostPinnedPools[kNumHostPinnedPools];
+
+    Pool &doGetDevicePool(int device);
+    Pool &doGetCurrentDevicePool();
+
+    int32_t doGetDevice() const noexcept override;
+
+    void *doAllocHostMem(int64_t size, int32_t align) override;
+    void  doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept override;
+
+    void *doAllocHostPinnedMem(int64_t size, int32_t align, uint32_t flags) override;
+    void  doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align, uint32_t flags) noexcept override;
+
+    void *doAllocCudaMem(int64_t size, int32_t align) override;
+    void  doFreeCudaMem(void *ptr, int64_t size, int32_t align) noexcept override;
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_POOL_ALLOCATOR_HPP
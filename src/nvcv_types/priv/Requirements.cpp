@@ -19,10 +19,14 @@
 
 #include "Exception.hpp"
 
+#include <cuda_runtime.h>
+#include <util/CheckError.hpp>
 #include <util/Math.hpp>
 
 #include <algorithm>
 #include <cmath>
+#include <mutex>
+#include <vector>
 
 namespace nvcv::priv {
 
@@ -109,4 +113,35 @@ int64_t CalcTotalSizeBytes(const NVCVMemRequirements &memReq)
     return static_cast<int64_t>(total);
 }
 
+const DeviceAlignment &GetDeviceAlignment(int dev)
+{
+    static std::once_flag               s_once;
+    static std::vector<DeviceAlignment> s_align;
+
+    // If it throws, it'll be tried again next time.
+    std::call_once(s_once,
+                   []
+                   {
+                       int numDevices;
+                       NVCV_CHECK_THROW(cudaGetDeviceCount(&numDevices));
+
+                       std::vector<DeviceAlignment> align(numDevices);
+                       for (int d = 0; d < numDevices; ++d)
+                       {
+                           NVCV_CHECK_THROW(
+                               cudaDeviceGetAttribute(&align[d].rowAlign, cudaDevAttrTexturePitchAlignment, d));
+                           NVCV_CHECK_THROW(
+                               cudaDeviceGetAttribute(&align[d].baseAlign, cudaDevAttrTextureAlignment, d));
+                       }
+                       s_align = std::move(align);
+                   });
+
+    if (dev < 0 || dev >= (int)s_align.size())
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Invalid device %d", dev);
+    }
+
+    return s_align[dev];
+}
+
 } // namespace nvcv::priv
@@ -20,6 +20,9 @@
 
 #include <nvcv/alloc/Requirements.h>
 
+#include <array>
+#include <cstdint>
+
 namespace nvcv::priv {
 
 void Init(NVCVRequirements &reqs);
@@ -29,6 +32,53 @@ void AddBuffer(NVCVMemRequirements &memReq, int64_t bufSize, int64_t bufAlignmen
 
 int64_t CalcTotalSizeBytes(const NVCVMemRequirements &memReq);
 
+// Texture alignments of a device, in bytes.
+struct DeviceAlignment
+{
+    int32_t rowAlign;  // cudaDevAttrTexturePitchAlignment
+    int32_t baseAlign; // cudaDevAttrTextureAlignment
+};
+
+// Device attributes are queried once and reused afterwards.
+const DeviceAlignment &GetDeviceAlignment(int dev);
+
+// Remembers the last few requirements computed, meant to be thread_local so
+// that creating the same transient objects repeatedly doesn't compute them again.
+// Key must be equality comparable.
+template<class Key, class Reqs, int N = 8>
+class RequirementsMemo
+{
+public:
+    const Reqs *find(const Key &key) const noexcept
+    {
+        for (int i = 0; i < m_size; ++i)
+        {
+            if (m_keys[i] == key)
+            {
+                return &m_reqs[i];
+            }
+        }
+        return nullptr;
+    }
+
+    void insert(const Key &key, const Reqs &reqs) noexcept
+    {
+        // Replaces the oldest entry when full.
+        m_keys[m_next] = key;
+        m_reqs[m_next] = reqs;
+
+        m_next = (m_next + 1) % N;
+        m_size = m_size < N ? m_size + 1 : N;
+    }
+
+private:
+    std::array<Key, N>  m_keys;
+    std::array<Reqs, N> m_reqs;
+
+    int m_size = 0;
+    int m_next = 0;
+};
+
 } // namespace nvcv::priv
 
 #endif // NVCV_CORE_PRIV_REQUIREMENTS_HPP
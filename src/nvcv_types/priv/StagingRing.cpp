@@ -0,0 +1,189 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StagingRing.hpp"
+
+#include "Exception.hpp"
+#include "NumaNode.hpp"
+
+#include <util/CheckError.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+
+namespace nvcv::priv {
+
+StagingRing::~StagingRing()
+{
+    for (Chunk &chunk : m_chunks)
+    {
+        if (chunk.ev != nullptr)
+        {
+            NVCV_CHECK_LOG(cudaEventSynchronize(chunk.ev));
+            NVCV_CHECK_LOG(cudaEventDestroy(chunk.ev));
+        }
+        if (chunk.buf != nullptr)
+        {
+            NVCV_CHECK_LOG(cudaFreeHost(chunk.buf));
+        }
+    }
+}
+
+void StagingRing::doInit()
+{
+    NumaNodeScope numa(GetCurrentDeviceNumaNode());
+
+    for (Chunk &chunk : m_chunks)
+    {
+        if (chunk.buf == nullptr)
+        {
+            void *buf = nullptr;
+            if (cudaHostAlloc(&buf, kChunkSize, cudaHostAllocDefault) != cudaSuccess)
+            {
+                throw Exception(NVCV_ERROR_OUT_OF_MEMORY, "Not enough host-pinned memory for staging buffers");
+            }
+            chunk.buf = static_cast<std::byte *>(buf);
+        }
+        if (chunk.ev == nullptr)
+        {
+            NVCV_CHECK_THROW(cudaEventCreateWithFlags(&chunk.ev, cudaEventDisableTiming));
+        }
+    }
+}
+
+auto StagingRing::doAcquireChunk() -> Chunk &
+{
+    Chunk &chunk = m_chunks[m_next];
+    m_next       = (m_next + 1) % kNumChunks;
+
+    // The DMA transfer that last used it, possibly on another stream, must be done.
+    NVCV_CHECK_THROW(cudaEventSynchronize(chunk.ev));
+    return chunk;
+}
+
+template<class F>
+void StagingRing::ForEachPiece(int64_t rowBytes, int64_t numRows, F &&fn)
+{
+    if (rowBytes <= kChunkSize)
+    {
+        int64_t rowsPerChunk = kChunkSize / rowBytes;
+        for (int64_t r = 0; r < numRows; r += rowsPerChunk)
+        {
+            fn(Piece{r, std::min(rowsPerChunk, numRows - r), 0, rowBytes});
+        }
+    }
+    else
+    {
+        for (int64_t r = 0; r < numRows; ++r)
+        {
+            for (int64_t offset = 0; offset < rowBytes; offset += kChunkSize)
+            {
+                fn(Piece{r, 1, offset, std::min(kChunkSize, rowBytes - offset)});
+            }
+        }
+    }
+}
+
+void StagingRing::upload(std::byte *dst, int64_t dstRowStride, const std::byte *src, int64_t rowBytes,
+                         int64_t numRows, cudaStream_t stream)
+{
+    if (rowBytes == 0 || numRows == 0)
+    {
+        return;
+    }
+
+    // Packed rows are copied as a single one, in fewer and larger pieces.
+    if (dstRowStride == rowBytes)
+    {
+        rowBytes *= numRows;
+        numRows = 1;
+    }
+
+    std::lock_guard lk(m_mtx);
+    doInit();
+
+    ForEachPiece(rowBytes, numRows,
+                 [&](const Piece &p)
+                 {
+                     Chunk &chunk = doAcquireChunk();
+
+                     // Host rows are packed, a piece is always contiguous there.
+                     std::memcpy(chunk.buf, src + p.row * rowBytes + p.offset, p.numRows * p.width);
+
+                     NVCV_CHECK_THROW(cudaMemcpy2DAsync(dst + p.row * dstRowStride + p.offset, dstRowStride,
+                                                        chunk.buf, p.width, p.width, p.numRows,
+                                                        cudaMemcpyHostToDevice, stream));
+                     NVCV_CHECK_THROW(cudaEventRecord(chunk.ev, stream));
+                 });
+}
+
+void StagingRing::download(std::byte *dst, const std::byte *src, int64_t srcRowStride, int64_t rowBytes,
+                           int64_t numRows, cudaStream_t stream)
+{
+    if (rowBytes == 0 || numRows == 0)
+    {
+        return;
+    }
+
+    if (srcRowStride == rowBytes)
+    {
+        rowBytes *= numRows;
+        numRows = 1;
+    }
+
+    std::lock_guard lk(m_mtx);
+    doInit();
+
+    // Pieces being transferred, they're copied to dst once their chunk is
+    // needed again or at the end, while the following ones are in flight.
+    std::deque<std::pair<Piece, Chunk *>> inFlight;
+
+    auto retire = [&]
+    {
+        auto [p, chunk] = inFlight.front();
+        inFlight.pop_front();
+
+        NVCV_CHECK_THROW(cudaEventSynchronize(chunk->ev));
+        std::memcpy(dst + p.row * rowBytes + p.offset, chunk->buf, p.numRows * p.width);
+    };
+
+    ForEachPiece(rowBytes, numRows,
+                 [&](const Piece &p)
+                 {
+                     if (inFlight.size() == kNumChunks)
+                     {
+                         retire();
+                     }
+
+                     Chunk &chunk = doAcquireChunk();
+
+                     NVCV_CHECK_THROW(cudaMemcpy2DAsync(chunk.buf, p.width, src + p.row * srcRowStride + p.offset,
+                                                        srcRowStride, p.width, p.numRows, cudaMemcpyDeviceToHost,
+                                                        stream));
+                     NVCV_CHECK_THROW(cudaEventRecord(chunk.ev, stream));
+
+                     inFlight.emplace_back(p, &chunk);
+                 });
+
+    while (!inFlight.empty())
+    {
+        retire();
+    }
+}
+
+} // namespace nvcv::priv
@@ -0,0 +1,80 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_STAGING_RING_HPP
+#define NVCV_CORE_PRIV_STAGING_RING_HPP
+
+#include <cuda_runtime.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace nvcv::priv {
+
+// Ring of host-pinned buffers used to copy between pageable host memory and
+// device memory. Data is split in chunks, the CPU copy of one chunk to or from
+// its staging buffer overlaps with the DMA transfer of the previous ones.
+// Transfers are serialized, they'd be competing for the same bus anyway.
+class StagingRing
+{
+public:
+    static constexpr int     kNumChunks = 4;
+    static constexpr int64_t kChunkSize = 4 << 20;
+
+    ~StagingRing();
+
+    // Copies numRows rows of rowBytes from the packed host buffer src to dst, whose rows are dstRowStride apart.
+    // It returns once src can be reused, the device copy is ordered on stream.
+    void upload(std::byte *dst, int64_t dstRowStride, const std::byte *src, int64_t rowBytes, int64_t numRows,
+                cudaStream_t stream);
+
+    // Copies numRows rows of rowBytes, srcRowStride apart, from src into the packed host buffer dst.
+    // It returns once dst holds the data.
+    void download(std::byte *dst, const std::byte *src, int64_t srcRowStride, int64_t rowBytes, int64_t numRows,
+                  cudaStream_t stream);
+
+private:
+    struct Chunk
+    {
+        std::byte  *buf = nullptr;
+        cudaEvent_t ev  = nullptr; // recorded after the last copy from/to buf
+    };
+
+    // Part of the 2D buffer that fits in a chunk: rows [row, row+numRows) in
+    // full, or a range of a single row when rows are larger than a chunk.
+    struct Piece
+    {
+        int64_t row, numRows;
+        int64_t offset, width;
+    };
+
+    std::mutex                    m_mtx;
+    std::array<Chunk, kNumChunks> m_chunks;
+    int                           m_next = 0;
+
+    void   doInit();
+    Chunk &doAcquireChunk();
+
+    template<class F>
+    static void ForEachPiece(int64_t rowBytes, int64_t numRows, F &&fn);
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_STAGING_RING_HPP
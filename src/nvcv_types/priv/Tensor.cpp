@@ -19,7 +19,9 @@
 
 #include "DataLayout.hpp"
 #include "DataType.hpp"
+#include "DeferredRelease.hpp"
 #include "IAllocator.hpp"
+#include "IContext.hpp"
 #include "Requirements.hpp"
 #include "TensorData.hpp"
 #include "TensorLayout.hpp"
@@ -37,9 +39,56 @@ namespace nvcv::priv {
 
 // Tensor implementation -------------------------------------------
 
+namespace {
+
+struct ImageTensorReqsKey
+{
+    int32_t         numImages;
+    Size2D          imgSize;
+    NVCVImageFormat fmt;
+    int32_t         baseAlign, rowAlign;
+    int             dev;
+
+    bool operator==(const ImageTensorReqsKey &that) const
+    {
+        return numImages == that.numImages && imgSize == that.imgSize && fmt == that.fmt
+            && baseAlign == that.baseAlign && rowAlign == that.rowAlign && dev == that.dev;
+    }
+};
+
+struct TensorReqsKey
+{
+    int32_t          rank;
+    int64_t          shape[NVCV_TENSOR_MAX_RANK];
+    NVCVDataType     dtype;
+    NVCVTensorLayout layout;
+    int32_t          baseAlign, rowAlign;
+    int              dev;
+
+    bool operator==(const TensorReqsKey &that) const
+    {
+        return rank == that.rank && std::equal(shape, shape + rank, that.shape) && dtype == that.dtype
+            && layout == that.layout && baseAlign == that.baseAlign && rowAlign == that.rowAlign
+            && dev == that.dev;
+    }
+};
+
+} // namespace
+
 NVCVTensorRequirements Tensor::CalcRequirements(int32_t numImages, Size2D imgSize, ImageFormat fmt,
                                                 int32_t userBaseAlign, int32_t userRowAlign)
 {
+    int dev;
+    NVCV_CHECK_THROW(cudaGetDevice(&dev));
+
+    ImageTensorReqsKey key{numImages, imgSize, fmt.value(), userBaseAlign, userRowAlign, dev};
+
+    thread_local RequirementsMemo<ImageTensorReqsKey, NVCVTensorRequirements> memo;
+    if (const NVCVTensorRequirements *reqs = memo.find(key))
+    {
+        return *reqs;
+    }
+
     // Check if format is compatible with tensor representation
     if (fmt.memLayout() != NVCV_MEM_LAYOUT_PL)
     {
@@ -88,12 +137,39 @@ NVCVTensorRequirements Tensor::CalcRequirements(int32_t numImages, Size2D imgSiz
 
     DataType dtype{fmt.dataKind(), *chPacking};
 
-    return CalcRequirements(layout.rank, shape, dtype, layout, userBaseAlign, userRowAlign);
+    NVCVTensorRequirements reqs = CalcRequirements(layout.rank, shape, dtype, layout, userBaseAlign, userRowAlign);
+    memo.insert(key, reqs);
+    return reqs;
 }
 
 NVCVTensorRequirements Tensor::CalcRequirements(int32_t rank, const int64_t *shape, const DataType &dtype,
                                                 NVCVTensorLayout layout, int32_t userBaseAlign, int32_t userRowAlign)
 {
+    int dev;
+    NVCV_CHECK_THROW(cudaGetDevice(&dev));
+
+    TensorReqsKey key{};
+    bool          cacheable = rank > 0 && rank <= NVCV_TENSOR_MAX_RANK;
+    if (cacheable)
+    {
+        key.rank = rank;
+        std::copy_n(shape, rank, key.shape);
+        key.dtype     = dtype.value();
+        key.layout    = layout;
+        key.baseAlign = userBaseAlign;
+        key.rowAlign  = userRowAlign;
+        key.dev       = dev;
+    }
+
+    thread_local RequirementsMemo<TensorReqsKey, NVCVTensorRequirements> memo;
+    if (cacheable)
+    {
+        if (const NVCVTensorRequirements *reqs = memo.find(key))
+        {
+            return *reqs;
+        }
+    }
+
     NVCVTensorRequirements reqs;
 
     reqs.layout = layout;
@@ -115,16 +191,13 @@ NVCVTensorRequirements Tensor::CalcRequirements(int32_t rank, const int64_t *sha
 
     reqs.mem = {};
 
-    int dev;
-    NVCV_CHECK_THROW(cudaGetDevice(&dev));
-
     // Calculate row pitch alignment
     int rowAlign;
     {
         if (userRowAlign == 0)
         {
             // it usually returns 32 bytes
-            NVCV_CHECK_THROW(cudaDeviceGetAttribute(&rowAlign, cudaDevAttrTexturePitchAlignment, dev));
+            rowAlign = GetDeviceAlignment(dev).rowAlign;
             rowAlign = std::lcm(rowAlign, util::RoundUpNextPowerOfTwo(dtype.strideBytes()));
         }
         else
@@ -143,9 +216,8 @@ NVCVTensorRequirements Tensor::CalcRequirements(int32_t rank, const int64_t *sha
     {
         if (userBaseAlign == 0)
         {
-            int addrAlign;
             // it usually returns 512 bytes
-            NVCV_CHECK_THROW(cudaDeviceGetAttribute(&addrAlign, cudaDevAttrTextureAlignment, dev));
+            int addrAlign   = GetDeviceAlignment(dev).baseAlign;
             reqs.alignBytes = std::lcm(addrAlign, rowAlign);
             reqs.alignBytes = util::RoundUpNextPowerOfTwo(reqs.alignBytes);
 
@@ -185,6 +257,10 @@ NVCVTensorRequirements Tensor::CalcRequirements(int32_t rank, const int64_t *sha
 
     AddBuffer(reqs.mem.cudaMem, reqs.strides[0] * reqs.shape[0], reqs.alignBytes);
 
+    if (cacheable)
+    {
+        memo.insert(key, reqs);
+    }
     return reqs;
 }
 
@@ -194,6 +270,15 @@ Tensor::Tensor(NVCVTensorRequirements reqs, IAllocator &alloc)
 {
     // Assuming reqs are already validated during its creation
 
+    // Memory of destroyed objects whose work is done can be reused now.
+    GlobalContext().deferredRelease().poll();
+
+    m_device = m_alloc.device();
+    if (m_device < 0)
+    {
+        NVCV_CHECK_THROW(cudaGetDevice(&m_device));
+    }
+
     int64_t bufSize = CalcTotalSizeBytes(m_reqs.mem.cudaMem);
     m_memBuffer     = m_alloc.allocCudaMem(bufSize, m_reqs.alignBytes);
     NVCV_ASSERT(m_memBuffer != nullptr);
@@ -201,7 +286,12 @@ Tensor::Tensor(NVCVTensorRequirements reqs, IAllocator &alloc)
 
 Tensor::~Tensor()
 {
-    m_alloc.freeCudaMem(m_memBuffer, CalcTotalSizeBytes(m_reqs.mem.cudaMem), m_reqs.alignBytes);
+    FreeCudaMem(m_alloc, m_memBuffer, CalcTotalSizeBytes(m_reqs.mem.cudaMem), m_reqs.alignBytes, m_releaseStream);
+}
+
+void Tensor::setReleaseStream(cudaStream_t stream)
+{
+    m_releaseStream = stream;
 }
 
 int32_t Tensor::rank() const
@@ -229,6 +319,11 @@ IAllocator &Tensor::alloc() const
     return m_alloc;
 }
 
+int32_t Tensor::device() const
+{
+    return m_device;
+}
+
 void Tensor::exportData(NVCVTensorData &data) const
 {
     data.bufferType = NVCV_TENSOR_BUFFER_STRIDED_CUDA;
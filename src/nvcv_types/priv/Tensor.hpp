@@ -22,6 +22,8 @@
 
 #include <cuda_runtime.h>
 
+#include <optional>
+
 namespace nvcv::priv {
 
 class Tensor final : public CoreObjectBase<ITensor>
@@ -44,13 +46,20 @@ public:
 
     IAllocator &alloc() const override;
 
+    int32_t device() const override;
+
     void exportData(NVCVTensorData &data) const override;
 
+    void setReleaseStream(cudaStream_t stream) override;
+
 private:
     IAllocator            &m_alloc;
     NVCVTensorRequirements m_reqs;
+    int32_t                m_device;
 
     void *m_memBuffer;
+
+    std::optional<cudaStream_t> m_releaseStream;
 };
 
 } // namespace nvcv::priv
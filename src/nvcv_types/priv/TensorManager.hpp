@@ -18,6 +18,7 @@
 #ifndef NVCV_PRIV_CORE_TENSORMANAGER_HPP
 #define NVCV_PRIV_CORE_TENSORMANAGER_HPP
 
+#include "GrowableTensor.hpp"
 #include "IContext.hpp"
 #include "Tensor.hpp"
 #include "TensorWrapDataStrided.hpp"
@@ -26,7 +27,7 @@ namespace nvcv::priv {
 
 using TensorManager = CoreObjManager<NVCVTensorHandle>;
 
-using TensorStorage = CompatibleStorage<Tensor, TensorWrapDataStrided>;
+using TensorStorage = CompatibleStorage<Tensor, TensorWrapDataStrided, GrowableTensor>;
 
 template<>
 class CoreObjManager<NVCVTensorHandle> : public HandleManager<ITensor, TensorStorage>
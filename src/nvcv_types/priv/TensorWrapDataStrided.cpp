@@ -34,7 +34,8 @@ namespace nvcv::priv {
 
 static void ValidateTensorBufferStrided(const NVCVTensorData &tdata)
 {
-    NVCV_ASSERT(tdata.bufferType == NVCV_TENSOR_BUFFER_STRIDED_CUDA);
+    NVCV_ASSERT(tdata.bufferType == NVCV_TENSOR_BUFFER_STRIDED_CUDA
+                || tdata.bufferType == NVCV_TENSOR_BUFFER_STRIDED_HOST);
 
     const NVCVTensorBufferStrided &buffer = tdata.buffer.strided;
 
@@ -146,6 +147,33 @@ IAllocator &TensorWrapDataStrided::alloc() const
     return GetDefaultAllocator();
 }
 
+int32_t TensorWrapDataStrided::device() const
+{
+    int32_t device = m_device.load(std::memory_order_relaxed);
+    if (device == kDeviceUnknown)
+    {
+        device = -1;
+
+        cudaPointerAttributes attrs;
+        if (m_tdata.bufferType == NVCV_TENSOR_BUFFER_STRIDED_CUDA
+            && cudaPointerGetAttributes(&attrs, m_tdata.buffer.strided.basePtr) == cudaSuccess)
+        {
+            if (attrs.type == cudaMemoryTypeDevice || attrs.type == cudaMemoryTypeManaged)
+            {
+                device = attrs.device;
+            }
+        }
+        else
+        {
+            // Memory not known to cuda isn't an error here.
+            cudaGetLastError();
+        }
+
+        m_device.store(device, std::memory_order_relaxed);
+    }
+    return device;
+}
+
 void TensorWrapDataStrided::exportData(NVCVTensorData &tdata) const
 {
     tdata = m_tdata;
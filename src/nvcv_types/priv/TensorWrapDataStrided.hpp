@@ -22,6 +22,8 @@
 
 #include <cuda_runtime.h>
 
+#include <atomic>
+
 namespace nvcv::priv {
 
 class TensorWrapDataStrided final : public CoreObjectBase<ITensor>
@@ -39,6 +41,8 @@ public:
 
     IAllocator &alloc() const override;
 
+    int32_t device() const override;
+
     void exportData(NVCVTensorData &tdata) const override;
 
 private:
@@ -46,6 +50,11 @@ private:
 
     NVCVTensorDataCleanupFunc m_cleanup;
     void                     *m_ctxCleanup;
+
+    static constexpr int32_t kDeviceUnknown = -2;
+
+    // Found out from the wrapped pointer the first time it's asked for.
+    mutable std::atomic<int32_t> m_device{kDeviceUnknown};
 };
 
 } // namespace nvcv::priv
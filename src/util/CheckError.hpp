@@ -21,6 +21,7 @@
 #include "Assert.h"
 
 #include <driver_types.h> // for cudaError
+#include <nvcv/Status.h>
 
 #include <cstring>
 #include <iostream>
@@ -38,6 +39,9 @@
 // * inline bool CheckSucceeded(ErrorType err)
 // * const char *ToString(NvError err, const char **perrdescr=nullptr);
 //
+// NVCV_CHECK_STATUS is the non-throwing flavor, it sets the thread's status
+// with the same message and returns it, for paths that report errors by value.
+//
 // Optionally, you can define:
 // * NVCVStatus TranslateError(NvError err);
 //   by default it translates success to NVCV_SUCCESS, failure to NVCV_ERROR_INTERNAL
@@ -111,6 +115,24 @@ void DoThrow(T error, const char *file, int line, const std::string_view &stmt,
     }
 }
 
+template<class T>
+NVCVStatus DoSetStatus(T error, const char *file, int line, const std::string_view &stmt,
+                       const std::string_view &errmsg)
+{
+    NVCVStatus status = TranslateError(error);
+
+    // Can we expose source file data?
+    if (file != nullptr)
+    {
+        nvcvSetThreadStatus(status, "%s:%d %s", file, line, FormatErrorMessage(ToString(error), stmt, errmsg).c_str());
+    }
+    else
+    {
+        nvcvSetThreadStatus(status, "%s", FormatErrorMessage(ToString(error), stmt, errmsg).c_str());
+    }
+    return status;
+}
+
 template<class T>
 void DoLog(T error, const char *file, int line, const std::string_view &stmt, const std::string_view &errmsg)
 {
@@ -142,6 +164,24 @@ void DoLog(T error, const char *file, int line, const std::string_view &stmt, co
         }                                                                                                          \
     }()
 
+#define NVCV_CHECK_STATUS(STMT, ...)                                                                                \
+    [&]() -> NVCVStatus                                                                                             \
+    {                                                                                                               \
+        using ::nvcv::util::PreprocessError;                                                                        \
+        using ::nvcv::util::CheckSucceeded;                                                                         \
+        auto status = (STMT);                                                                                       \
+        PreprocessError(status);                                                                                    \
+        if (!CheckSucceeded(status))                                                                                \
+        {                                                                                                           \
+            char buf[NVCV_MAX_STATUS_MESSAGE_LENGTH];                                                               \
+            return ::nvcv::util::detail::DoSetStatus(status, NVCV_SOURCE_FILE_NAME, NVCV_SOURCE_FILE_LINENO,        \
+                                                     NVCV_OPTIONAL_STRINGIFY(STMT),                                 \
+                                                     ::nvcv::util::detail::GetCheckMessage(buf, sizeof(buf),        \
+                                                                                           ##__VA_ARGS__));         \
+        }                                                                                                           \
+        return NVCV_SUCCESS;                                                                                        \
+    }()
+
 #define NVCV_CHECK_LOG(STMT, ...)                                                                                \
     [&]()                                                                                                        \
     {                                                                                                            \
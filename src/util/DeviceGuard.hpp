@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_UTIL_DEVICE_GUARD_HPP
+#define NVCV_UTIL_DEVICE_GUARD_HPP
+
+#include "CheckError.hpp"
+
+#include <cuda_runtime.h>
+
+namespace nvcv::util {
+
+// Makes the given device current for as long as it's in scope, and restores the previous one afterwards.
+// A negative device leaves the current one unchanged.
+class DeviceGuard
+{
+public:
+    explicit DeviceGuard(int device)
+    {
+        if (device >= 0)
+        {
+            int current = 0;
+            NVCV_CHECK_THROW(cudaGetDevice(&current));
+            if (current != device)
+            {
+                NVCV_CHECK_THROW(cudaSetDevice(device));
+                m_prevDevice = current;
+            }
+        }
+    }
+
+    ~DeviceGuard()
+    {
+        if (m_prevDevice >= 0)
+        {
+            NVCV_CHECK_LOG(cudaSetDevice(m_prevDevice));
+        }
+    }
+
+    DeviceGuard(const DeviceGuard &)            = delete;
+    DeviceGuard &operator=(const DeviceGuard &) = delete;
+
+private:
+    int m_prevDevice = -1;
+};
+
+} // namespace nvcv::util
+
+#endif // NVCV_UTIL_DEVICE_GUARD_HPP
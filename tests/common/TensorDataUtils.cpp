@@ -18,6 +18,7 @@
 #include "TensorDataUtils.hpp"
 
 #include <cmath>
+#include <cstring>
 
 namespace nvcv::test {
 
@@ -185,4 +186,79 @@ nvcv::Tensor CreateTensor(int numImages, int imgWidth, int imgHeight, const nvcv
     return nvcv::Tensor(numImages, {imgWidth, imgHeight}, imgFormat);
 }
 
+namespace {
+
+template<typename T>
+std::vector<uint8_t> FloatsToBytes(const std::vector<float> &values)
+{
+    std::vector<uint8_t> bytes(values.size() * sizeof(T));
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        const T v = static_cast<T>(values[i]);
+        std::memcpy(bytes.data() + i * sizeof(T), &v, sizeof(T));
+    }
+    return bytes;
+}
+
+} // namespace
+
+nvcv::Tensor CreateTensorFromFloats(const std::vector<std::vector<float>> &images, Size2D size,
+                                    const nvcv::ImageFormat &imgFormat)
+{
+    nvcv::Tensor tensor(static_cast<int>(images.size()), size, imgFormat);
+
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    if (data == nullptr)
+        throw std::runtime_error("Tensor Data is not pitch access capable.");
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    if (!access)
+        throw std::runtime_error("Tensor Data is not an image.");
+
+    const nvcv::DataType type     = imgFormat.planeDataType(0).channelType(0);
+    const int            rowBytes = size.w * imgFormat.planePixelStrideBytes(0);
+
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        std::vector<uint8_t> bytes = type == nvcv::TYPE_F32   ? FloatsToBytes<float>(images[i])
+                                   : type == nvcv::TYPE_U16 ? FloatsToBytes<uint16_t>(images[i])
+                                   : type == nvcv::TYPE_S16 ? FloatsToBytes<int16_t>(images[i])
+                                                            : FloatsToBytes<uint8_t>(images[i]);
+
+        if (cudaSuccess
+            != cudaMemcpy2D(access->sampleData(i), access->rowStride(), bytes.data(), rowBytes, rowBytes, size.h,
+                            cudaMemcpyHostToDevice))
+        {
+            throw std::runtime_error("CudaMemcpy failed");
+        }
+    }
+
+    return tensor;
+}
+
+std::vector<float> GetFloatsFromTensor(const nvcv::Tensor &tensor)
+{
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    if (data == nullptr)
+        throw std::runtime_error("Tensor Data is not pitch access capable.");
+
+    int64_t numSamples      = data->shape(0);
+    int64_t valuesPerSample = 1;
+    for (int i = 1; i < data->rank(); ++i)
+    {
+        valuesPerSample *= data->shape(i);
+    }
+
+    std::vector<float> values(numSamples * valuesPerSample);
+
+    if (cudaSuccess
+        != cudaMemcpy2D(values.data(), valuesPerSample * sizeof(float), data->basePtr(), data->stride(0),
+                        valuesPerSample * sizeof(float), numSamples, cudaMemcpyDeviceToHost))
+    {
+        throw std::runtime_error("CudaMemcpy failed");
+    }
+
+    return values;
+}
+
 } // namespace nvcv::test
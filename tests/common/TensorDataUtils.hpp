@@ -23,6 +23,7 @@
 #include <nvcv/TensorDataAccess.hpp>
 
 #include <random>
+#include <vector>
 
 namespace nvcv::test {
 
@@ -187,6 +188,26 @@ private:
  */
 nvcv::Tensor CreateTensor(int numImages, int imgWidth, int imgHeight, const nvcv::ImageFormat &imgFormat);
 
+/**
+ * Create a NHWC Tensor with one sample per host image.
+ *
+ * @param[in] images Packed HWC images, one float per value, converted to the data type of the format.
+ * @param[in] size Size of the images.
+ * @param[in] imgFormat Image format inside the tensor, with one plane of 8-bit or 16-bit integers or 32-bit floats.
+ *
+ */
+nvcv::Tensor CreateTensorFromFloats(const std::vector<std::vector<float>> &images, Size2D size,
+                                    const nvcv::ImageFormat &imgFormat);
+
+/**
+ * Copies the float values of all samples of a tensor to host, e.g. per-sample scores.
+ * The values of each sample must be packed, samples may be strided.
+ *
+ * @param[in] tensor tensor of 32-bit floats.
+ *
+ */
+std::vector<float> GetFloatsFromTensor(const nvcv::Tensor &tensor);
+
 /**
  * Writes over the Tensor data with type DT and value of @data.
  * Function does not do data type or underflow checking if
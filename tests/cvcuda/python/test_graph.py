@@ -0,0 +1,111 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import numpy as np
+import pytest as t
+import torch
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+def as_torch(tensor):
+    return torch.as_tensor(tensor.cuda(), device="cuda")
+
+
+def test_graph_launch_matches_eager():
+    input = util.create_tensor((2, 64, 96, 3), np.uint8, "NHWC", 255, rng=RNG)
+    ref = cvcuda.resize(cvcuda.flip(input, flipCode=1), (2, 32, 48, 3))
+
+    stream = cvcuda.Stream()
+    graph = cvcuda.Graph()
+    assert not graph.captured
+
+    with graph.capture(stream):
+        out = cvcuda.resize(cvcuda.flip(input, flipCode=1), (2, 32, 48, 3))
+    assert graph.captured
+
+    for _ in range(3):
+        graph.launch(stream)
+    stream.sync()
+
+    assert torch.equal(as_torch(out), as_torch(ref))
+
+
+def test_graph_reads_updated_inputs():
+    input = util.create_tensor((1, 16, 16, 1), np.uint8, "NHWC", 255, rng=RNG)
+    output = cvcuda.Tensor(input.shape, input.dtype, input.layout)
+
+    stream = cvcuda.Stream()
+    graph = cvcuda.Graph()
+    with graph.capture(stream):
+        cvcuda.flip_into(dst=output, src=input, flipCode=0)
+
+    as_torch(input).fill_(7)
+    torch.cuda.synchronize()
+
+    with stream:
+        graph.launch()
+    stream.sync()
+
+    assert torch.all(as_torch(output) == 7)
+
+
+def test_graph_launch_before_capture():
+    graph = cvcuda.Graph()
+    with t.raises(RuntimeError):
+        graph.launch()
+
+
+def test_graph_default_stream_capture():
+    graph = cvcuda.Graph()
+    with t.raises(RuntimeError):
+        with graph.capture(cvcuda.Stream.default):
+            pass
+
+
+def test_graph_failed_capture_is_discarded():
+    input = util.create_tensor((1, 16, 16, 1), np.uint8, "NHWC", 255, rng=RNG)
+    graph = cvcuda.Graph()
+
+    with t.raises(ZeroDivisionError):
+        with graph.capture(cvcuda.Stream()):
+            cvcuda.flip(input, flipCode=0)
+            1 / 0
+
+    assert not graph.captured
+    assert cvcuda.Stream.current is cvcuda.Stream.default
+
+
+def test_capture_after_eager_temporaries():
+    input = util.create_tensor((1, 32, 32, 3), np.uint8, "NHWC", 255, rng=RNG)
+
+    # Temporaries are only held by the stream until their work is done, more
+    # calls than are released at once.
+    stream = cvcuda.Stream()
+    out = input
+    for _ in range(40):
+        out = cvcuda.flip(out, flipCode=1, stream=stream)
+
+    graph = cvcuda.Graph()
+    with graph.capture(stream):
+        captured = cvcuda.flip(out, flipCode=0)
+    graph.launch(stream)
+    stream.sync()
+
+    assert torch.equal(as_torch(out), as_torch(input))
+    assert torch.equal(as_torch(captured), torch.flip(as_torch(input), dims=[1]))
@@ -0,0 +1,38 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input",
+    [
+        cvcuda.Tensor((3, 16, 23, 3), np.uint8, "NHWC"),
+        cvcuda.Tensor((16, 23, 1), np.float32, "HWC"),
+        cvcuda.Tensor((2, 8, 8, 4), np.int16, "NHWC"),
+    ],
+)
+def test_op_absdiff(input):
+    out = cvcuda.absdiff(input, input)
+    assert out.layout == input.layout
+    assert out.shape == input.shape
+    assert out.dtype == input.dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(input.shape, input.dtype, input.layout)
+    tmp = cvcuda.absdiff_into(out, input, input, stream=stream)
+    assert tmp is out
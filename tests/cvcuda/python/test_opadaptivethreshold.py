@@ -0,0 +1,50 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,max_value,type,block_size,c",
+    [
+        (
+            cvcuda.Tensor((4, 16, 23, 1), np.uint8, "NHWC"),
+            255,
+            cvcuda.ThresholdType.BINARY,
+            3,
+            2,
+        ),
+        (
+            cvcuda.Tensor((16, 23, 1), np.uint8, "HWC"),
+            128,
+            cvcuda.ThresholdType.BINARY_INV,
+            11,
+            -1.5,
+        ),
+    ],
+)
+def test_op_adaptive_threshold(input, max_value, type, block_size, c):
+    out = cvcuda.adaptive_threshold(input, max_value, type, block_size, c)
+    assert out.layout == input.layout
+    assert out.shape == input.shape
+    assert out.dtype == input.dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(input.shape, input.dtype, input.layout)
+    tmp = cvcuda.adaptive_threshold_into(
+        out, input, max_value, type, block_size, c, stream=stream
+    )
+    assert tmp is out
@@ -0,0 +1,57 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,size,interp,out_shape,out_dtype",
+    [
+        (
+            cvcuda.Tensor((2, 21, 30, 40), np.float32, "NCHW"),
+            None,
+            cvcuda.Interp.NEAREST,
+            (2, 30, 40, 1),
+            np.uint8,
+        ),
+        (
+            cvcuda.Tensor((1, 5, 16, 24), np.float32, "NCHW"),
+            (96, 64),
+            cvcuda.Interp.LINEAR,
+            (1, 64, 96, 1),
+            np.uint8,
+        ),
+        (
+            cvcuda.Tensor((300, 8, 8), np.float32, "CHW"),
+            (16, 12),
+            cvcuda.Interp.NEAREST,
+            (1, 12, 16, 1),
+            np.int32,
+        ),
+    ],
+)
+def test_op_argmax(input, size, interp, out_shape, out_dtype):
+    out = cvcuda.argmax(input, size, interp)
+    assert out.layout == "NHWC"
+    assert out.shape == out_shape
+    assert out.dtype == out_dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(out_shape, np.int32, "NHWC")
+    tmp = cvcuda.argmax_into(dst=out, src=input, interp=interp, stream=stream)
+    assert tmp is out
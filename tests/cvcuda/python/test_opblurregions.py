@@ -0,0 +1,61 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+@t.mark.parametrize(
+    "shape,dtype,type,kernel_size,with_counts",
+    [
+        ((2, 48, 64, 3), np.uint8, cvcuda.BlurRegion.GAUSSIAN, 9, True),
+        ((1, 33, 20, 1), np.float32, cvcuda.BlurRegion.GAUSSIAN, 15, False),
+        ((3, 40, 40, 4), np.uint8, cvcuda.BlurRegion.PIXELATE, 8, True),
+    ],
+)
+def test_op_blur_regions(shape, dtype, type, kernel_size, with_counts):
+    src = util.create_tensor(shape, dtype, "NHWC", rng=RNG)
+    boxes = util.create_tensor(
+        (shape[0], 1, 5, 4), np.float32, "NHWC", max_random=shape[1], rng=RNG
+    )
+    counts = (
+        util.create_tensor((shape[0], 1, 1, 1), np.int32, "NHWC", max_random=5, rng=RNG)
+        if with_counts
+        else None
+    )
+
+    out = cvcuda.blur_regions_into(src, boxes, type, kernel_size, counts)
+    assert out is src
+    assert out.layout == "NHWC"
+    assert out.shape == shape
+    assert out.dtype == dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.blur_regions_into(
+        src,
+        boxes,
+        type,
+        kernel_size,
+        num_boxes=counts,
+        sigma=2.0,
+        border=cvcuda.Border.REPLICATE,
+        stream=stream,
+    )
+    assert out is src
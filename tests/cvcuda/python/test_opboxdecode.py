@@ -0,0 +1,60 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "anchors,deltas,variance_xy,variance_wh",
+    [
+        (
+            cvcuda.Tensor((1, 1, 8732, 4), np.float32, "NHWC"),
+            cvcuda.Tensor((4, 1, 8732, 4), np.float32, "NHWC"),
+            0.1,
+            0.2,
+        ),
+        (
+            cvcuda.Tensor((2, 1, 100, 4), np.float32, "NHWC"),
+            cvcuda.Tensor((2, 1, 100, 4), np.float32, "NHWC"),
+            1.0,
+            1.0,
+        ),
+        (
+            cvcuda.Tensor((1, 10, 4), np.float32, "HWC"),
+            cvcuda.Tensor((1, 10, 4), np.float32, "HWC"),
+            1.0,
+            1.0,
+        ),
+    ],
+)
+def test_op_box_decode(anchors, deltas, variance_xy, variance_wh):
+    boxes = cvcuda.box_decode(anchors, deltas, variance_xy, variance_wh)
+    assert boxes.layout == deltas.layout
+    assert boxes.shape == deltas.shape
+    assert boxes.dtype == np.float32
+
+    stream = cvcuda.Stream()
+    boxes = cvcuda.Tensor(deltas.shape, np.float32, deltas.layout)
+    tmp = cvcuda.box_decode_into(
+        boxes,
+        anchors,
+        deltas,
+        variance_xy=variance_xy,
+        variance_wh=variance_wh,
+        stream=stream,
+    )
+    assert tmp is boxes
@@ -0,0 +1,74 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+
+
+@t.mark.parametrize(
+    "input,levels,type,sizes",
+    [
+        (
+            cvcuda.Tensor((2, 48, 64, 3), np.uint8, "NHWC"),
+            4,
+            cvcuda.PyramidType.GAUSSIAN,
+            [(64, 48), (32, 24), (16, 12), (8, 6)],
+        ),
+        (
+            cvcuda.Tensor((33, 97, 1), np.float32, "HWC"),
+            3,
+            cvcuda.PyramidType.LAPLACIAN,
+            [(97, 33), (49, 17), (25, 9)],
+        ),
+    ],
+)
+def test_op_build_pyramid(input, levels, type, sizes):
+    out = cvcuda.build_pyramid(input, levels, type)
+    nsamples = input.shape[0] if input.layout == "NHWC" else 1
+    assert len(out) == nsamples * levels
+    for i, img in enumerate(out):
+        assert (img.width, img.height) == sizes[i % levels]
+
+    stream = cvcuda.Stream()
+    tmp = cvcuda.build_pyramid_into(
+        dst=out, src=input, levels=levels, type=type, stream=stream
+    )
+    assert tmp is out
+
+
+@t.mark.parametrize(
+    "nimages, format, max_size, levels",
+    [
+        (5, cvcuda.Format.RGB8, (640, 480), 5),
+        (3, cvcuda.Format.U8, (33, 97), 2),
+    ],
+)
+def test_op_build_pyramidvarshape(nimages, format, max_size, levels):
+    input = util.create_image_batch(
+        nimages, format, max_size=max_size, max_random=255, rng=RNG
+    )
+
+    out = cvcuda.build_pyramid(input, levels)
+    assert len(out) == nimages * levels
+    assert out.uniqueformat == format
+
+    stream = cvcuda.Stream()
+    tmp = cvcuda.build_pyramid_into(
+        dst=out, src=input, levels=levels, stream=stream
+    )
+    assert tmp is out
@@ -0,0 +1,37 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,threshold_low,threshold_high,aperture_size,l2_gradient",
+    [
+        (cvcuda.Tensor((4, 16, 23, 1), np.uint8, "NHWC"), 50, 150, 3, False),
+        (cvcuda.Tensor((16, 23, 1), np.uint8, "HWC"), 100, 300, 5, True),
+        (cvcuda.Tensor((2, 40, 70, 1), np.uint8, "NHWC"), 1000, 3000, 7, False),
+    ],
+)
+def test_op_canny(input, threshold_low, threshold_high, aperture_size, l2_gradient):
+    out = cvcuda.canny(input, threshold_low, threshold_high, aperture_size, l2_gradient)
+    assert out.layout == input.layout
+    assert out.shape == input.shape
+    assert out.dtype == input.dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(input.shape, input.dtype, input.layout)
+    cvcuda.canny_into(out, input, threshold_low, threshold_high, stream=stream)
@@ -14,8 +14,11 @@
 # limitations under the License.
 
 import cvcuda
+import nvcv
 import pytest as t
 import numpy as np
+import torch
+import cvcuda_util as util
 
 
 @t.mark.parametrize(
@@ -60,3 +63,83 @@ def test_op_convertto(input, dtype, scale, offset):
     assert out.layout == input.layout
     assert out.shape == input.shape
     assert out.dtype == dtype
+
+
+def test_op_convertto_channel_order():
+    host = np.random.default_rng(0).integers(0, 256, (2, 8, 9, 3), dtype=np.uint8)
+    input = nvcv.as_tensor(util.to_cuda_buffer(host), "NHWC")
+
+    out = cvcuda.convertto(input, np.float32, 2, 1, channel_order=[2, 1, 0])
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()
+    assert np.array_equal(out, host[..., ::-1].astype(np.float32) * 2 + 1)
+
+    out = cvcuda.reformat(input, "NCHW", channel_order=[2, 1, 0])
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()
+    assert np.array_equal(out, host[..., ::-1].transpose(0, 3, 1, 2))
+
+    with t.raises(ValueError):
+        cvcuda.convertto(input, np.float32, channel_order=[4, 1, 0])
+
+
+def test_op_convertto_per_channel():
+    host = np.random.default_rng(0).integers(0, 256, (2, 8, 9, 3), dtype=np.uint8)
+    input = nvcv.as_tensor(util.to_cuda_buffer(host), "NHWC")
+
+    scale_host = np.array([0.5, 0.25, 2], dtype=np.float32)
+    offset_host = np.array([1, -2, 3], dtype=np.float32)
+    scale = nvcv.as_tensor(util.to_cuda_buffer(scale_host), "W")
+    offset = nvcv.as_tensor(util.to_cuda_buffer(offset_host), "W")
+
+    gold = host.astype(np.float32) * scale_host + offset_host
+
+    out = cvcuda.convertto(input, np.float32, scale, offset, layout="NCHW")
+    assert out.layout == "NCHW"
+    assert out.shape == (2, 3, 8, 9)
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()
+    assert np.allclose(out, gold.transpose(0, 3, 1, 2))
+
+    out = cvcuda.Tensor(input.shape, np.float16, input.layout)
+    tmp = cvcuda.convertto_into(out, input, scale, offset)
+    assert tmp is out
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()
+    assert np.allclose(out, gold, rtol=1e-3)
+
+
+def test_op_convertto_multi():
+    host = np.random.default_rng(0).integers(0, 256, (2, 8, 9, 3), dtype=np.uint8)
+    input = nvcv.as_tensor(util.to_cuda_buffer(host), "NHWC")
+
+    scale = [0.5, 0.25, 2]
+    offset = [1, -2, 3]
+
+    planar, bgr = cvcuda.convertto_multi(
+        input,
+        [np.float32, np.uint8],
+        scale=[scale, 1],
+        offset=[offset, 0],
+        layout=["NCHW", None],
+        channel_order=[None, [2, 1, 0]],
+    )
+    assert planar.layout == "NCHW"
+    assert planar.shape == (2, 3, 8, 9)
+    assert planar.dtype == np.float32
+    assert bgr.layout == "NHWC"
+    assert bgr.shape == input.shape
+    assert bgr.dtype == np.uint8
+
+    gold = host.astype(np.float32) * np.array(scale, np.float32) + offset
+    planar = torch.as_tensor(planar.cuda(), device="cuda").cpu().numpy()
+    assert np.allclose(planar, gold.transpose(0, 3, 1, 2))
+    bgr = torch.as_tensor(bgr.cuda(), device="cuda").cpu().numpy()
+    assert np.array_equal(bgr, host[..., ::-1])
+
+    out = [cvcuda.Tensor(input.shape, np.float16, input.layout)]
+    tmp = cvcuda.convertto_multi_into(out, input, scale=[2])
+    assert tmp[0] is out[0]
+    out = torch.as_tensor(out[0].cuda(), device="cuda").cpu().numpy()
+    assert np.allclose(out, host.astype(np.float32) * 2, rtol=1e-3)
+
+    with t.raises(ValueError):
+        cvcuda.convertto_multi(input, [np.float32], scale=[1, 2])
+    with t.raises(ValueError):
+        cvcuda.convertto_multi(input, [np.float32], scale=[[1, 2]])
@@ -0,0 +1,114 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import nvcv
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+
+def create_boxes(boxes):
+    return nvcv.as_tensor(util.to_cuda_buffer(np.array(boxes, np.float32)), "NW")
+
+
+@t.mark.parametrize(
+    "input,boxes,size,interp",
+    [
+        (
+            cvcuda.Tensor((1, 64, 48, 3), np.uint8, "NHWC"),
+            [[0, 0, 16, 16], [8.5, 4.25, 40, 60], [10, 10, 11, 11]],
+            (32, 24),
+            cvcuda.Interp.LINEAR,
+        ),
+        (
+            cvcuda.Tensor((2, 41, 13, 4), np.float32, "NHWC"),
+            [[1, 0, 0, 13, 41], [0, 2, 3, 7, 9]],
+            (7, 9),
+            cvcuda.Interp.NEAREST,
+        ),
+        (
+            cvcuda.Tensor((16, 23, 1), np.uint8, "HWC"),
+            [[2, 3, 12, 9]],
+            (5, 5),
+            cvcuda.Interp.LINEAR,
+        ),
+    ],
+)
+def test_op_crop_resize(input, boxes, size, interp):
+    boxes = create_boxes(boxes)
+    out_shape = (boxes.shape[0], size[1], size[0], input.shape[-1])
+
+    out = cvcuda.crop_resize(input, boxes, size)
+    assert out.layout == "NHWC"
+    assert out.shape == out_shape
+    assert out.dtype == input.dtype
+
+    out = cvcuda.Tensor(out_shape, input.dtype, "NHWC")
+    tmp = cvcuda.crop_resize_into(out, input, boxes, interp)
+    assert tmp is out
+
+    stream = cvcuda.Stream()
+    out = cvcuda.crop_resize(
+        src=input, boxes=boxes, size=size, interp=interp, stream=stream
+    )
+    assert out.layout == "NHWC"
+    assert out.shape == out_shape
+    assert out.dtype == input.dtype
+
+    tmp = cvcuda.crop_resize_into(
+        dst=out, src=input, boxes=boxes, interp=interp, stream=stream
+    )
+    assert tmp is out
+
+
+@t.mark.parametrize(
+    "num_images,img_format,size,interp",
+    [
+        (3, cvcuda.Format.RGB8, (32, 24), cvcuda.Interp.LINEAR),
+        (5, cvcuda.Format.RGBA8, (16, 16), cvcuda.Interp.AREA),
+        (1, cvcuda.Format.U8, (8, 12), cvcuda.Interp.NEAREST),
+    ],
+)
+def test_op_crop_resize_varshape(num_images, img_format, size, interp):
+    input = util.create_image_batch(num_images, img_format, max_size=(64, 64))
+    boxes = create_boxes([[i, 0, 0, 1, 1] for i in range(num_images)])
+    flip_code = util.create_tensor((num_images,), np.int32, "N", max_random=1)
+    out_shape = (num_images, size[1], size[0], img_format.channels)
+
+    out = cvcuda.crop_resize(input, boxes, size, interp)
+    assert out.layout == "NHWC"
+    assert out.shape == out_shape
+
+    stream = cvcuda.Stream()
+    out = cvcuda.crop_resize(
+        src=input,
+        boxes=boxes,
+        size=size,
+        interp=interp,
+        flip_code=flip_code,
+        stream=stream,
+    )
+    assert out.shape == out_shape
+
+    tmp = cvcuda.crop_resize_into(
+        dst=out,
+        src=input,
+        boxes=boxes,
+        interp=interp,
+        flip_code=flip_code,
+        stream=stream,
+    )
+    assert tmp is out
@@ -138,3 +138,49 @@ def test_op_cvtcolorvarshape(
     assert len(output) == len(input)
     assert output.capacity == input.capacity
     assert output.maxsize == input.maxsize
+
+
+@t.mark.parametrize(
+    "in_formats, out_format",
+    [
+        (
+            [
+                cvcuda.Format.NV12,
+                cvcuda.Format.BGR8,
+                cvcuda.Format.Y8,
+                cvcuda.Format.RGBA8,
+            ],
+            cvcuda.Format.RGB8,
+        ),
+        (
+            [cvcuda.Format.BGR8, cvcuda.Format.NV12, cvcuda.Format.Y8_ER],
+            cvcuda.Format.BGRA8,
+        ),
+        (
+            [cvcuda.Format.RGB8, cvcuda.Format.NV12],
+            cvcuda.Format.Y8_ER,
+        ),
+    ],
+)
+def test_op_cvtcolorvarshape_mixed(in_formats, out_format):
+    input = cvcuda.ImageBatchVarShape(len(in_formats))
+    output = cvcuda.ImageBatchVarShape(len(in_formats))
+    for i, fmt in enumerate(in_formats):
+        size = [32 + 2 * i, 24 + 4 * i]
+        input.pushback(cvcuda.Image(size, fmt))
+        output.pushback(cvcuda.Image(size, out_format))
+
+    out = cvcuda.cvtcolor(input, out_format)
+    assert len(out) == len(input)
+    assert out.capacity == input.capacity
+    assert out.maxsize == input.maxsize
+    assert out.uniqueformat == out_format
+
+    stream = cvcuda.Stream()
+    tmp = cvcuda.cvtcolor_into(
+        src=input,
+        dst=output,
+        stream=stream,
+    )
+    assert tmp is output
+    assert len(output) == len(input)
@@ -0,0 +1,64 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,pattern,type,channels,dtype",
+    [
+        (
+            cvcuda.Tensor((4, 16, 24, 1), np.uint8, "NHWC"),
+            cvcuda.RawPattern.BAYER_RGGB,
+            cvcuda.DemosaicType.BILINEAR,
+            3,
+            np.uint8,
+        ),
+        (
+            cvcuda.Tensor((16, 23, 1), np.uint16, "HWC"),
+            cvcuda.RawPattern.BAYER_GBRG,
+            cvcuda.DemosaicType.EDGE_AWARE,
+            4,
+            np.float32,
+        ),
+        (
+            cvcuda.Tensor((2, 40, 30, 1), np.uint16, "NHWC"),
+            cvcuda.RawPattern.BAYER_BGGR,
+            cvcuda.DemosaicType.EDGE_AWARE,
+            3,
+            np.uint16,
+        ),
+    ],
+)
+def test_op_demosaic(input, pattern, type, channels, dtype):
+    out = cvcuda.demosaic(
+        input,
+        pattern,
+        type,
+        wb_gains=[2.0, 1.0, 1.5],
+        ccm=[1.5, -0.3, -0.2, -0.2, 1.4, -0.2, 0.0, -0.5, 1.5],
+        gamma=2.2,
+        channels=channels,
+        dtype=dtype,
+    )
+    assert out.layout == input.layout
+    assert out.shape == input.shape[:-1] + (channels,)
+    assert out.dtype == dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(out.shape, dtype, input.layout)
+    tmp = cvcuda.demosaic_into(out, input, pattern, type, stream=stream)
+    assert tmp is out
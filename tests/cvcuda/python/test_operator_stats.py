@@ -0,0 +1,74 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import numpy as np
+import threading
+
+
+def test_operator_stats():
+    src = cvcuda.Tensor((2, 32, 16, 3), np.uint8, "NHWC")
+    stream = cvcuda.Stream()
+
+    cvcuda.reset_operator_stats()
+    cvcuda.set_operator_timing(True, sample_every=2)
+    try:
+        for _ in range(6):
+            cvcuda.flip(src, 1, stream=stream)
+    finally:
+        cvcuda.set_operator_timing(False)
+    stream.sync()
+
+    stats = {s["name"]: s for s in cvcuda.operator_stats()}
+    flip = stats["Flip"]
+    assert flip["count"] == 3
+    assert sum(flip["histogram"]) == 3
+    assert sum(flip["submit_histogram"]) == 3
+    assert len(flip["histogram"]) == len(cvcuda.OPERATOR_STATS_BIN_BOUNDS_MS)
+    assert 0 <= flip["p50_ms"] <= flip["p99_ms"] <= flip["max_ms"]
+    assert 0 < flip["max_submit_ms"] <= flip["total_submit_ms"]
+
+    cvcuda.reset_operator_stats()
+    assert cvcuda.operator_stats() == []
+
+
+def test_operator_stats_sink():
+    src = cvcuda.Tensor((2, 32, 16, 3), np.uint8, "NHWC")
+    stream = cvcuda.Stream()
+
+    received = threading.Event()
+    pushed = []
+
+    def sink(stats):
+        pushed.append(stats)
+        if any(s["name"] == "Flip" for s in stats):
+            received.set()
+
+    cvcuda.reset_operator_stats()
+    cvcuda.set_operator_timing(True)
+    cvcuda.set_operator_stats_sink(sink, interval_ms=10)
+    try:
+        cvcuda.flip(src, 0, stream=stream)
+        stream.sync()
+        assert received.wait(timeout=10)
+    finally:
+        cvcuda.set_operator_stats_sink(None)
+        cvcuda.set_operator_timing(False)
+        cvcuda.reset_operator_stats()
+
+    # no calls once stopped
+    count = len(pushed)
+    threading.Event().wait(0.05)
+    assert len(pushed) == count
@@ -0,0 +1,58 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,capacity,threshold,nonmax_suppression",
+    [
+        (cvcuda.Tensor((4, 48, 64, 1), np.uint8, "NHWC"), 100, 10, True),
+        (cvcuda.Tensor((77, 123, 1), np.uint8, "HWC"), 1000, 40, False),
+    ],
+)
+def test_op_fast(input, capacity, threshold, nonmax_suppression):
+    num_samples = input.shape[0] if input.layout == "NHWC" else 1
+
+    keypoints, scores, count = cvcuda.fast(
+        input, capacity, threshold, nonmax_suppression=nonmax_suppression
+    )
+    assert keypoints.layout == "NHWC"
+    assert keypoints.shape == (num_samples, 1, capacity, 2)
+    assert keypoints.dtype == np.int32
+    assert scores.shape == (num_samples, 1, capacity, 1)
+    assert scores.dtype == np.float32
+    assert count.shape == (num_samples, 1, 1, 1)
+    assert count.dtype == np.int32
+
+    stream = cvcuda.Stream()
+    keypoints = cvcuda.Tensor((num_samples, 1, capacity, 2), np.int32, "NHWC")
+    scores = cvcuda.Tensor((num_samples, 1, capacity, 1), np.float32, "NHWC")
+    count = cvcuda.Tensor((num_samples, 1, 1, 1), np.int32, "NHWC")
+    tmp = cvcuda.fast_into(
+        keypoints,
+        scores,
+        count,
+        input,
+        threshold,
+        nonmax_suppression=nonmax_suppression,
+        stream=stream,
+    )
+    assert tmp[0] is keypoints
+    assert tmp[1] is scores
+    assert tmp[2] is count
@@ -14,8 +14,10 @@
 # limitations under the License.
 
 import cvcuda
+import nvcv
 import pytest as t
 import numpy as np
+import torch
 import cvcuda_util as util
 
 
@@ -136,3 +138,56 @@ def test_op_flipvarshape(num_images, img_format, img_size, max_pixel, flip_code)
     assert out.capacity == input.capacity
     assert out.uniqueformat == input.uniqueformat
     assert out.maxsize == input.maxsize
+
+
+@t.mark.parametrize(
+    "num_images, img_format, img_size, dtype",
+    [
+        (5, cvcuda.Format.RGB8, (64, 33), np.uint8),
+        (3, cvcuda.Format.RGBA8, (37, 20), np.uint8),
+        (4, cvcuda.Format.S32, (26, 52), np.int32),
+        (2, cvcuda.Format.RGBf32, (62, 35), np.float32),
+    ],
+)
+def test_op_flipstack(num_images, img_format, img_size, dtype):
+    input = util.create_image_batch(
+        num_images, img_format, size=img_size, max_random=255, rng=RNG
+    )
+    codes = np.array([i % 3 - 1 for i in range(num_images)], np.int32)
+    flipCode = nvcv.as_tensor(util.to_cuda_buffer(codes), "N")
+
+    out = cvcuda.flipstack(input, flipCode)
+    assert out.layout == "NHWC"
+    assert out.shape[:3] == (num_images, img_size[1], img_size[0])
+    assert out.dtype == dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(out.shape, out.dtype, out.layout)
+    tmp = cvcuda.flipstack_into(src=input, dst=out, flipCode=flipCode, stream=stream)
+    assert tmp is out
+    stream.sync()
+
+    ref = cvcuda.flip(input, flipCode)
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()
+    for i, image in enumerate(ref):
+        assert np.array_equal(out[i], np.array(image.cpu()).reshape(out[i].shape))
+
+
+def test_op_flip_across_streams():
+    input = util.create_tensor((2, 256, 512, 3), np.uint8, "NHWC", 255, rng=RNG)
+    ref = torch.as_tensor(input.cuda(), device="cuda").clone()
+
+    stream1 = cvcuda.Stream()
+    stream2 = cvcuda.Stream()
+
+    # tmp is written on stream1, read on stream2 and then overwritten on
+    # stream1, with no explicit synchronization between the streams.
+    tmp = cvcuda.flip(input, flipCode=-1, stream=stream1)
+    out = cvcuda.flip(tmp, flipCode=-1, stream=stream2)
+    cvcuda.flip_into(dst=tmp, src=input, flipCode=0, stream=stream1)
+
+    stream1.sync()
+    stream2.sync()
+
+    assert torch.equal(torch.as_tensor(out.cuda(), device="cuda"), ref)
+    assert torch.equal(torch.as_tensor(tmp.cuda(), device="cuda"), ref.flip(1))
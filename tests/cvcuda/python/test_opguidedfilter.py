@@ -0,0 +1,74 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+
+@t.mark.parametrize(
+    "input,guide,radius,eps,subsample",
+    [
+        (
+            cvcuda.Tensor((4, 16, 23, 1), np.uint8, "NHWC"),
+            cvcuda.Tensor((4, 16, 23, 3), np.uint8, "NHWC"),
+            4,
+            0.01,
+            1,
+        ),
+        (
+            cvcuda.Tensor((33, 20, 3), np.float32, "HWC"),
+            cvcuda.Tensor((33, 20, 1), np.uint8, "HWC"),
+            8,
+            0.001,
+            2,
+        ),
+    ],
+)
+def test_op_guided_filter(input, guide, radius, eps, subsample):
+    out = cvcuda.guided_filter(input, guide, radius, eps, subsample=subsample)
+    assert out.layout == input.layout
+    assert out.shape == input.shape
+    assert out.dtype == input.dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(input.shape, input.dtype, input.layout)
+    tmp = cvcuda.guided_filter_into(
+        out, input, guide, radius, eps, subsample=subsample, stream=stream
+    )
+    assert tmp is out
+
+
+def test_op_guided_filter_varshape():
+    RNG = np.random.default_rng(0)
+
+    input = util.create_image_batch(
+        5, cvcuda.Format.U8, size=(0, 0), max_size=(64, 48), max_random=256, rng=RNG
+    )
+
+    guide = cvcuda.ImageBatchVarShape(input.capacity)
+    for image in input:
+        guide.pushback(cvcuda.Image(image.size, cvcuda.Format.RGB8))
+
+    out = cvcuda.guided_filter(input, guide, 3, 0.01)
+    assert len(out) == len(input)
+    assert out.capacity == input.capacity
+    assert out.uniqueformat == input.uniqueformat
+    assert out.maxsize == input.maxsize
+
+    stream = cvcuda.Stream()
+    tmp = cvcuda.guided_filter_into(out, input, guide, 3, 0.01, subsample=2, stream=stream)
+    assert tmp is out
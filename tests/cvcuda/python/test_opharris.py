@@ -0,0 +1,74 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,capacity,threshold,block_size,type,border",
+    [
+        (
+            cvcuda.Tensor((4, 48, 64, 1), np.uint8, "NHWC"),
+            100,
+            1e-4,
+            3,
+            cvcuda.CornerResponse.HARRIS,
+            cvcuda.Border.REFLECT101,
+        ),
+        (
+            cvcuda.Tensor((2, 77, 123, 1), np.float32, "NHWC"),
+            500,
+            10.0,
+            5,
+            cvcuda.CornerResponse.SHI_TOMASI,
+            cvcuda.Border.CONSTANT,
+        ),
+    ],
+)
+def test_op_harris(input, capacity, threshold, block_size, type, border):
+    num_samples = input.shape[0]
+
+    keypoints, scores, count = cvcuda.harris(
+        input, capacity, threshold, block_size, 0.04, type, border=border
+    )
+    assert keypoints.layout == "NHWC"
+    assert keypoints.shape == (num_samples, 1, capacity, 2)
+    assert keypoints.dtype == np.int32
+    assert scores.shape == (num_samples, 1, capacity, 1)
+    assert scores.dtype == np.float32
+    assert count.shape == (num_samples, 1, 1, 1)
+    assert count.dtype == np.int32
+
+    stream = cvcuda.Stream()
+    keypoints = cvcuda.Tensor((num_samples, 1, capacity, 2), np.int32, "NHWC")
+    scores = cvcuda.Tensor((num_samples, 1, capacity, 1), np.float32, "NHWC")
+    count = cvcuda.Tensor((num_samples, 1, 1, 1), np.int32, "NHWC")
+    tmp = cvcuda.harris_into(
+        keypoints,
+        scores,
+        count,
+        input,
+        threshold,
+        block_size=block_size,
+        type=type,
+        border=border,
+        stream=stream,
+    )
+    assert tmp[0] is keypoints
+    assert tmp[1] is scores
+    assert tmp[2] is count
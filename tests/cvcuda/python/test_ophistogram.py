@@ -0,0 +1,68 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+@t.mark.parametrize(
+    "input,per_channel,out_shape",
+    [
+        (cvcuda.Tensor((1, 64, 48, 3), np.uint8, "NHWC"), True, (1, 1, 256, 3)),
+        (cvcuda.Tensor((3, 41, 13, 4), np.uint8, "NHWC"), False, (3, 1, 256, 1)),
+        (cvcuda.Tensor((2, 3, 16, 23), np.uint8, "NCHW"), True, (2, 1, 256, 3)),
+        (cvcuda.Tensor((16, 23, 1), np.uint8, "HWC"), True, (1, 1, 256, 1)),
+    ],
+)
+def test_op_histogram(input, per_channel, out_shape):
+    out = cvcuda.histogram(input, per_channel=per_channel)
+    assert out.layout == "NHWC"
+    assert out.shape == out_shape
+    assert out.dtype == np.int32
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(out_shape, np.int32, "NHWC")
+    tmp = cvcuda.histogram_into(dst=out, src=input, stream=stream)
+    assert tmp is out
+
+
+@t.mark.parametrize(
+    "nimages, format, max_size, per_channel",
+    [
+        (5, cvcuda.Format.RGB8, (16, 23), True),
+        (4, cvcuda.Format.RGBA8, (33, 17), False),
+        (2, cvcuda.Format.U8, (40, 40), True),
+    ],
+)
+def test_op_histogramvarshape(nimages, format, max_size, per_channel):
+    input = util.create_image_batch(
+        nimages, format, max_size=max_size, max_random=255, rng=RNG
+    )
+    out_shape = (nimages, 1, 256, format.channels if per_channel else 1)
+
+    out = cvcuda.histogram(input, per_channel=per_channel)
+    assert out.layout == "NHWC"
+    assert out.shape == out_shape
+    assert out.dtype == np.int32
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(out_shape, np.int32, "NHWC")
+    tmp = cvcuda.histogram_into(dst=out, src=input, stream=stream)
+    assert tmp is out
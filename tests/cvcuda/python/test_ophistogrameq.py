@@ -0,0 +1,66 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+@t.mark.parametrize(
+    "input",
+    [
+        cvcuda.Tensor((1, 64, 48, 1), np.uint8, "NHWC"),
+        cvcuda.Tensor((3, 41, 13, 1), np.uint8, "NHWC"),
+        cvcuda.Tensor((16, 23, 1), np.uint8, "HWC"),
+    ],
+)
+def test_op_histogram_eq(input):
+    out = cvcuda.histogram_eq(input)
+    assert out.layout == input.layout
+    assert out.shape == input.shape
+    assert out.dtype == input.dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(input.shape, input.dtype, input.layout)
+    tmp = cvcuda.histogram_eq_into(dst=out, src=input, stream=stream)
+    assert tmp is out
+
+
+@t.mark.parametrize(
+    "nimages, max_size",
+    [
+        (5, (16, 23)),
+        (2, (40, 40)),
+    ],
+)
+def test_op_histogram_eqvarshape(nimages, max_size):
+    input = util.create_image_batch(
+        nimages, cvcuda.Format.U8, max_size=max_size, max_random=255, rng=RNG
+    )
+
+    out = cvcuda.histogram_eq(input)
+    assert len(out) == len(input)
+    assert out.capacity == input.capacity
+    assert out.uniqueformat == input.uniqueformat
+    assert out.maxsize == input.maxsize
+
+    stream = cvcuda.Stream()
+    out = util.clone_image_batch(input)
+    tmp = cvcuda.histogram_eq_into(dst=out, src=input, stream=stream)
+    assert tmp is out
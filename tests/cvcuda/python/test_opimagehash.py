@@ -0,0 +1,68 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+@t.mark.parametrize(
+    "input, type",
+    [
+        (cvcuda.Tensor((1, 64, 48, 1), np.uint8, "NHWC"), cvcuda.ImageHash.EXACT),
+        (cvcuda.Tensor((3, 41, 33, 3), np.uint8, "NHWC"), cvcuda.ImageHash.DHASH),
+        (cvcuda.Tensor((2, 40, 32, 4), np.uint8, "NHWC"), cvcuda.ImageHash.PHASH),
+        (cvcuda.Tensor((16, 23, 1), np.float32, "HWC"), cvcuda.ImageHash.EXACT),
+    ],
+)
+def test_op_image_hash(input, type):
+    numSamples = input.shape[0] if input.layout == "NHWC" else 1
+
+    out = cvcuda.image_hash(input, type)
+    assert out.layout == "NHWC"
+    assert out.shape == (numSamples, 1, 1, 1)
+    assert out.dtype == np.uint64
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor((numSamples, 1, 1, 1), np.uint64, "NHWC")
+    tmp = cvcuda.image_hash_into(dst=out, src=input, type=type, stream=stream)
+    assert tmp is out
+
+
+@t.mark.parametrize(
+    "nimages, format, max_size, type",
+    [
+        (5, cvcuda.Format.U8, (16, 23), cvcuda.ImageHash.EXACT),
+        (2, cvcuda.Format.RGB8, (40, 40), cvcuda.ImageHash.DHASH),
+    ],
+)
+def test_op_image_hashvarshape(nimages, format, max_size, type):
+    input = util.create_image_batch(
+        nimages, format, max_size=max_size, max_random=255, rng=RNG
+    )
+
+    out = cvcuda.image_hash(input, type)
+    assert out.layout == "NHWC"
+    assert out.shape == (nimages, 1, 1, 1)
+    assert out.dtype == np.uint64
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor((nimages, 1, 1, 1), np.uint64, "NHWC")
+    tmp = cvcuda.image_hash_into(dst=out, src=input, type=type, stream=stream)
+    assert tmp is out
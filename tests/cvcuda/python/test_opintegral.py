@@ -0,0 +1,46 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,dtype,out_shape",
+    [
+        (
+            cvcuda.Tensor((4, 16, 23, 1), np.uint8, "NHWC"),
+            np.float64,
+            (4, 17, 24, 1),
+        ),
+        (cvcuda.Tensor((16, 23, 1), np.uint16, "HWC"), np.int32, (17, 24, 1)),
+        (
+            cvcuda.Tensor((2, 40, 1100, 1), np.float32, "NHWC"),
+            np.float32,
+            (2, 41, 1101, 1),
+        ),
+    ],
+)
+def test_op_integral(input, dtype, out_shape):
+    out = cvcuda.integral(input, dtype)
+    assert out.layout == input.layout
+    assert out.shape == out_shape
+    assert out.dtype == dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(out_shape, dtype, input.layout)
+    sqsum = cvcuda.Tensor(out_shape, np.float64, input.layout)
+    tmp = cvcuda.integral_into(out, input, sqsum, stream=stream)
+    assert tmp is out
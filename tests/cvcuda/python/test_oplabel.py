@@ -0,0 +1,45 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,connectivity,max_stats",
+    [
+        (cvcuda.Tensor((4, 16, 23, 1), np.uint8, "NHWC"), 8, 0),
+        (cvcuda.Tensor((16, 23, 1), np.uint16, "HWC"), 4, 10),
+        (cvcuda.Tensor((2, 40, 70, 1), np.int32, "NHWC"), 8, 100),
+    ],
+)
+def test_op_label(input, connectivity, max_stats):
+    out, count, stats = cvcuda.label(input, connectivity, max_stats)
+    assert out.layout == input.layout
+    assert out.shape == input.shape
+    assert out.dtype == np.int32
+    num_samples = input.shape[0] if input.layout == "NHWC" else 1
+    assert count.shape == (num_samples, 1, 1, 1)
+    assert count.dtype == np.int32
+    if max_stats > 0:
+        assert stats.shape == (num_samples, 1, max_stats, 6)
+        assert stats.dtype == np.int32
+    else:
+        assert stats is None
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(input.shape, np.int32, input.layout)
+    tmp = cvcuda.label_into(out, input, connectivity, count, stats, stream=stream)
+    assert tmp is out
@@ -0,0 +1,91 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+@t.mark.parametrize(
+    "input,out_size,out_shape,interp",
+    [
+        (
+            cvcuda.Tensor((2, 480, 640, 3), np.uint8, "NHWC"),
+            (320, 320),
+            (2, 320, 320, 3),
+            cvcuda.Interp.LINEAR,
+        ),
+        (
+            cvcuda.Tensor((480, 360, 1), np.float32, "HWC"),
+            (256, 416),
+            (256, 416, 1),
+            cvcuda.Interp.NEAREST,
+        ),
+    ],
+)
+def test_op_letterbox(input, out_size, out_shape, interp):
+    out, transform = cvcuda.letterbox(
+        input,
+        out_height=out_size[0],
+        out_width=out_size[1],
+        interp=interp,
+        fill_value=[114, 114, 114],
+    )
+    assert out.layout == input.layout
+    assert out.shape == out_shape
+    assert out.dtype == input.dtype
+    assert transform.shape[3] == 4
+    assert transform.dtype == np.float32
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(out_shape, input.dtype, input.layout)
+    tmp = cvcuda.letterbox_into(
+        dst=out, src=input, transform=transform, interp=interp, stream=stream
+    )
+    assert tmp is out
+
+    tmp = cvcuda.letterbox_into(dst=out, src=input, stream=stream)
+    assert tmp is out
+
+
+@t.mark.parametrize(
+    "nimages, format, max_size, out_size",
+    [
+        (5, cvcuda.Format.RGB8, (640, 480), (416, 416)),
+        (3, cvcuda.Format.RGBA8, (33, 97), (64, 64)),
+    ],
+)
+def test_op_letterboxvarshape(nimages, format, max_size, out_size):
+    input = util.create_image_batch(
+        nimages, format, max_size=max_size, max_random=255, rng=RNG
+    )
+    out_shape = (nimages, out_size[0], out_size[1], format.channels)
+
+    out, transform = cvcuda.letterbox(
+        input, out_height=out_size[0], out_width=out_size[1]
+    )
+    assert out.layout == "NHWC"
+    assert out.shape == out_shape
+    assert out.dtype == np.uint8
+    assert transform.shape == (nimages, 1, 1, 4)
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(out_shape, np.uint8, "NHWC")
+    tmp = cvcuda.letterbox_into(dst=out, src=input, transform=transform, stream=stream)
+    assert tmp is out
@@ -0,0 +1,47 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,lut",
+    [
+        (
+            cvcuda.Tensor((3, 16, 23, 3), np.uint8, "NHWC"),
+            cvcuda.Tensor((3, 256), np.uint8, "CW"),
+        ),
+        (
+            cvcuda.Tensor((2, 16, 23, 1), np.uint8, "NHWC"),
+            cvcuda.Tensor((2, 1, 256), np.float32, "NCW"),
+        ),
+        (
+            cvcuda.Tensor((16, 23, 4), np.uint16, "HWC"),
+            cvcuda.Tensor((1, 65536), np.uint16, "CW"),
+        ),
+    ],
+)
+def test_op_lut(input, lut):
+    out = cvcuda.lut(input, lut)
+    assert out.layout == input.layout
+    assert out.shape == input.shape
+    assert out.dtype == lut.dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(input.shape, lut.dtype, input.layout)
+    tmp = cvcuda.lut_into(out, input, lut, stream=stream)
+    assert tmp is out
@@ -0,0 +1,63 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,labels,palette",
+    [
+        (
+            cvcuda.Tensor((2, 30, 40, 3), np.uint8, "NHWC"),
+            cvcuda.Tensor((2, 30, 40, 1), np.uint8, "NHWC"),
+            cvcuda.Tensor((1, 1, 21, 4), np.uint8, "NHWC"),
+        ),
+        (
+            cvcuda.Tensor((1, 64, 96, 4), np.uint8, "NHWC"),
+            cvcuda.Tensor((1, 64, 96, 1), np.int32, "NHWC"),
+            cvcuda.Tensor((1, 1, 300, 4), np.uint8, "NHWC"),
+        ),
+        (
+            cvcuda.Tensor((12, 16, 3), np.uint8, "HWC"),
+            cvcuda.Tensor((12, 16, 1), np.uint8, "HWC"),
+            cvcuda.Tensor((1, 2, 4), np.uint8, "HWC"),
+        ),
+    ],
+)
+def test_op_maskoverlay(input, labels, palette):
+    out = cvcuda.mask_overlay(input, labels, palette)
+    assert out.layout == input.layout
+    assert out.shape == input.shape
+    assert out.dtype == input.dtype
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(input.shape, input.dtype, input.layout)
+    tmp = cvcuda.mask_overlay_into(
+        dst=out, src=input, labels=labels, palette=palette, stream=stream
+    )
+    assert tmp is out
+
+
+def test_op_maskoverlay_after_argmax():
+    scores = cvcuda.Tensor((1, 21, 30, 40), np.float32, "NCHW")
+    frame = cvcuda.Tensor((1, 120, 160, 3), np.uint8, "NHWC")
+    palette = cvcuda.Tensor((1, 1, 21, 4), np.uint8, "NHWC")
+
+    labels = cvcuda.argmax(scores, (160, 120), cvcuda.Interp.LINEAR)
+    out = cvcuda.mask_overlay(frame, labels, palette)
+    assert out.shape == frame.shape
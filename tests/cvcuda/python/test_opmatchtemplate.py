@@ -0,0 +1,86 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import nvcv
+import pytest as t
+import numpy as np
+import torch
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+def to_tensor(host, layout):
+    return nvcv.as_tensor(util.to_cuda_buffer(host), layout)
+
+
+def gold_scores(img, templ):
+    # TM_CCOEFF_NORMED of every window, in double precision
+    win = np.lib.stride_tricks.sliding_window_view(img.astype(np.float64), templ.shape)
+    win = win - win.mean(axis=(-2, -1), keepdims=True)
+    tc = templ.astype(np.float64) - templ.mean()
+    num = (win * tc).sum(axis=(-2, -1))
+    den = np.sqrt((win * win).sum(axis=(-2, -1)) * (tc * tc).sum())
+    return num / den
+
+
+@t.mark.parametrize(
+    "shape,templ_shape,dtype,layout",
+    [
+        ((2, 40, 50, 1), (2, 9, 7, 1), np.uint8, "NHWC"),
+        ((3, 33, 21, 1), (1, 5, 5, 1), np.uint8, "NHWC"),
+        ((70, 90, 1), (40, 33, 1), np.float32, "HWC"),
+    ],
+)
+def test_op_match_template(shape, templ_shape, dtype, layout):
+    img = RNG.integers(0, 256, shape).astype(dtype)
+    templ = RNG.integers(0, 256, templ_shape).astype(dtype)
+
+    out = cvcuda.match_template(to_tensor(img, layout), to_tensor(templ, layout))
+
+    imgs = img.reshape((-1,) + img.shape[-3:-1])
+    templs = templ.reshape((-1,) + templ.shape[-3:-1])
+    gold = np.stack(
+        [gold_scores(s, templs[i if len(templs) > 1 else 0]) for i, s in enumerate(imgs)]
+    )
+
+    assert out.layout == "NHWC"
+    assert out.shape == gold.shape + (1,)
+    assert out.dtype == np.float32
+
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()
+    assert np.allclose(out.reshape(gold.shape), gold, atol=1e-3)
+
+    stream = cvcuda.Stream()
+    tmp = cvcuda.match_template_into(
+        dst=cvcuda.Tensor(gold.shape + (1,), np.float32, "NHWC"),
+        src=to_tensor(img, layout),
+        templ=to_tensor(templ, layout),
+        stream=stream,
+    )
+    assert tmp.shape == gold.shape + (1,)
+
+
+def test_op_match_template_finds_template():
+    img = RNG.integers(0, 256, (1, 64, 80, 1)).astype(np.uint8)
+    templ = img[:, 20:36, 30:42, :].copy()
+
+    out = cvcuda.match_template(to_tensor(img, "NHWC"), to_tensor(templ, "NHWC"))
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()[0, :, :, 0]
+
+    assert np.unravel_index(np.argmax(out), out.shape) == (20, 30)
+    assert out[20, 30] == t.approx(1, abs=1e-4)
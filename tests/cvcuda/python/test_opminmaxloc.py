@@ -0,0 +1,81 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+def check_outputs(outs, samples):
+    min_val, min_loc, max_val, max_loc = outs
+    for val in (min_val, max_val):
+        assert val.layout == "NHWC"
+        assert val.shape == (samples, 1, 1, 1)
+        assert val.dtype == np.float32
+    for loc in (min_loc, max_loc):
+        assert loc.layout == "NHWC"
+        assert loc.shape == (samples, 1, 1, 2)
+        assert loc.dtype == np.int32
+
+
+@t.mark.parametrize(
+    "input,samples",
+    [
+        (cvcuda.Tensor((1, 64, 48, 1), np.uint8, "NHWC"), 1),
+        (cvcuda.Tensor((3, 41, 13, 1), np.float32, "NHWC"), 3),
+        (cvcuda.Tensor((16, 23, 1), np.int16, "HWC"), 1),
+    ],
+)
+def test_op_minmaxloc(input, samples):
+    check_outputs(cvcuda.min_max_loc(input), samples)
+
+    val_shape = (samples, 1, 1, 1)
+    loc_shape = (samples, 1, 1, 2)
+    outs = (
+        cvcuda.Tensor(val_shape, np.float32, "NHWC"),
+        cvcuda.Tensor(loc_shape, np.int32, "NHWC"),
+        cvcuda.Tensor(val_shape, np.float32, "NHWC"),
+        cvcuda.Tensor(loc_shape, np.int32, "NHWC"),
+    )
+
+    stream = cvcuda.Stream()
+    tmp = cvcuda.min_max_loc_into(
+        min_val=outs[0],
+        min_loc=outs[1],
+        max_val=outs[2],
+        max_loc=outs[3],
+        src=input,
+        stream=stream,
+    )
+    assert all(a is b for a, b in zip(tmp, outs))
+
+
+@t.mark.parametrize(
+    "nimages, format, max_size",
+    [
+        (5, cvcuda.Format.U8, (16, 23)),
+        (4, cvcuda.Format.F32, (33, 17)),
+    ],
+)
+def test_op_minmaxlocvarshape(nimages, format, max_size):
+    input = util.create_image_batch(
+        nimages, format, max_size=max_size, max_random=255, rng=RNG
+    )
+
+    check_outputs(cvcuda.min_max_loc(input), nimages)
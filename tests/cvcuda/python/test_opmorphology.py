@@ -65,6 +65,46 @@ RNG = np.random.default_rng(0)
             1,
             cvcuda.Border.REFLECT101,
         ),
+        (
+            cvcuda.Tensor((2, 16, 23, 1), np.uint8, "NHWC"),
+            cvcuda.MorphologyType.OPEN,
+            [3, 3],
+            [-1, -1],
+            1,
+            cvcuda.Border.CONSTANT,
+        ),
+        (
+            cvcuda.Tensor((16, 23, 4), np.uint8, "HWC"),
+            cvcuda.MorphologyType.CLOSE,
+            [3, 5],
+            [-1, -1],
+            2,
+            cvcuda.Border.REPLICATE,
+        ),
+        (
+            cvcuda.Tensor((1, 8, 9, 3), np.float32, "NHWC"),
+            cvcuda.MorphologyType.GRADIENT,
+            [3, 3],
+            [-1, -1],
+            1,
+            cvcuda.Border.REFLECT,
+        ),
+        (
+            cvcuda.Tensor((3, 12, 7, 1), np.uint16, "NHWC"),
+            cvcuda.MorphologyType.TOPHAT,
+            [5, 5],
+            [-1, -1],
+            1,
+            cvcuda.Border.WRAP,
+        ),
+        (
+            cvcuda.Tensor((12, 7, 1), np.uint8, "HWC"),
+            cvcuda.MorphologyType.BLACKHAT,
+            [-1, -1],
+            [-1, -1],
+            1,
+            cvcuda.Border.REFLECT101,
+        ),
     ],
 )
 def test_op_morphology(input, morphologyType, maskSize, anchor, iteration, border):
@@ -0,0 +1,79 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import nvcv
+import pytest as t
+import numpy as np
+import torch
+import cvcuda_util as util
+
+
+def create_batch(sizes, num_channels):
+    batch = nvcv.ImageBatchVarShape(len(sizes))
+    for i, (w, h) in enumerate(sizes):
+        host = np.full((h, w, num_channels), 10 * (i + 1), dtype=np.uint8)
+        batch.pushback(nvcv.as_image(util.to_cuda_buffer(host)))
+    return batch
+
+
+@t.mark.parametrize(
+    "interp", [cvcuda.Interp.NEAREST, cvcuda.Interp.LINEAR, cvcuda.Interp.AREA]
+)
+@t.mark.parametrize("num_channels", [1, 3, 4])
+def test_op_mosaic(interp, num_channels):
+    shape = (1, 32, 48, num_channels)
+    dst = nvcv.as_tensor(util.to_cuda_buffer(np.zeros(shape, np.uint8)), "NHWC")
+
+    # constant images in the 4 quadrants of the left 32x32 of the canvas
+    src = create_batch([(16, 16), (40, 20), (7, 9), (64, 64)], num_channels)
+    rects = [[0, 0, 0, 16, 16], [0, 16, 0, 32, 16], [0, 0, 16, 16, 32]]
+    rects += [[0, 16, 16, 32, 32]]
+    rects = nvcv.as_tensor(util.to_cuda_buffer(np.array(rects, np.float32)), "NW")
+
+    out = cvcuda.mosaic_into(dst, src, rects, interp)
+    assert out is dst
+    assert out.layout == "NHWC"
+    assert out.shape == shape
+    assert out.dtype == np.uint8
+
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()
+    assert (out[0, :16, :16] == 10).all()
+    assert (out[0, :16, 16:32] == 20).all()
+    assert (out[0, 16:, :16] == 30).all()
+    assert (out[0, 16:, 16:32] == 40).all()
+    assert not out[0, :, 32:].any()
+
+
+def test_op_mosaic_canvases():
+    shape = (2, 8, 8, 3)
+    dst = nvcv.as_tensor(util.to_cuda_buffer(np.zeros(shape, np.uint8)), "NHWC")
+
+    # the 2nd rectangle is clipped to the canvas, the 3rd one is skipped
+    src = create_batch([(4, 4), (4, 4), (4, 4)], 3)
+    rects = [[1, 0, 0, 4, 4], [0, 4, 4, 12, 12], [2, 0, 0, 8, 8]]
+    rects = nvcv.as_tensor(util.to_cuda_buffer(np.array(rects, np.float32)), "NW")
+
+    stream = cvcuda.Stream()
+    out = cvcuda.mosaic_into(
+        dst=dst, src=src, rects=rects, interp=cvcuda.Interp.NEAREST, stream=stream
+    )
+    assert out is dst
+
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()
+    assert (out[1, :4, :4] == 10).all()
+    assert not out[1, 4:].any()
+    assert (out[0, 4:, 4:] == 20).all()
+    assert not out[0, :4].any()
@@ -0,0 +1,69 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "num_samples,num_boxes,max_output,with_classes,soft_sigma",
+    [
+        (4, 1000, 100, False, 0.0),
+        (2, 500, 50, True, 0.0),
+        (1, 200, 200, True, 0.5),
+    ],
+)
+def test_op_nms(num_samples, num_boxes, max_output, with_classes, soft_sigma):
+    boxes = cvcuda.Tensor((num_samples, 1, num_boxes, 4), np.float32, "NHWC")
+    scores = cvcuda.Tensor((num_samples, 1, num_boxes, 1), np.float32, "NHWC")
+    classes = (
+        cvcuda.Tensor((num_samples, 1, num_boxes, 1), np.int32, "NHWC")
+        if with_classes
+        else None
+    )
+
+    indices, out_scores, count = cvcuda.nms(
+        boxes, scores, max_output, 0.05, 0.5, soft_sigma, classes
+    )
+    assert indices.layout == "NHWC"
+    assert indices.shape == (num_samples, 1, max_output, 1)
+    assert indices.dtype == np.int32
+    assert out_scores.layout == "NHWC"
+    assert out_scores.shape == (num_samples, 1, max_output, 1)
+    assert out_scores.dtype == np.float32
+    assert count.layout == "NHWC"
+    assert count.shape == (num_samples, 1, 1, 1)
+    assert count.dtype == np.int32
+
+    stream = cvcuda.Stream()
+    indices = cvcuda.Tensor((num_samples, 1, max_output, 1), np.int32, "NHWC")
+    out_scores = cvcuda.Tensor((num_samples, 1, max_output, 1), np.float32, "NHWC")
+    count = cvcuda.Tensor((num_samples, 1, 1, 1), np.int32, "NHWC")
+    tmp = cvcuda.nms_into(
+        indices,
+        out_scores,
+        count,
+        boxes,
+        scores,
+        score_threshold=0.05,
+        iou_threshold=0.5,
+        soft_sigma=soft_sigma,
+        classes=classes,
+        stream=stream,
+    )
+    assert tmp[0] is indices
+    assert tmp[1] is out_scores
+    assert tmp[2] is count
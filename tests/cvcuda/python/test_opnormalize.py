@@ -61,6 +61,15 @@ RNG = np.random.default_rng(0)
             3,
             None,
         ),
+        (
+            cvcuda.Tensor((5, 16, 23, 4), np.uint8, "NHWC"),
+            cvcuda.Tensor((5, 1, 1, 4), np.float32, "NHWC"),
+            cvcuda.Tensor((5, 1, 1, 4), np.float32, "NHWC"),
+            64,
+            128,
+            0,
+            cvcuda.NormalizeFlags.COMPUTE_STATS,
+        ),
     ],
 )
 def test_op_normalize(input, base, scale, globalscale, globalshift, epsilon, flags):
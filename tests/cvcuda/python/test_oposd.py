@@ -0,0 +1,91 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import nvcv
+import pytest as t
+import numpy as np
+import torch
+import cvcuda_util as util
+
+
+def make_elements(rows):
+    elements = np.zeros((len(rows), 12), dtype=np.float32)
+    for i, (type, color, params) in enumerate(rows):
+        elements[i, 0] = int(type)
+        elements[i, 1:5] = color
+        elements[i, 5 : 5 + len(params)] = params
+    return elements
+
+
+@t.mark.parametrize("shape", [(2, 30, 40, 3), (1, 17, 9, 4), (3, 24, 24, 1)])
+def test_op_osd(shape):
+    host = np.zeros(shape, dtype=np.uint8)
+    src = nvcv.as_tensor(util.to_cuda_buffer(host), "NHWC")
+
+    elements = make_elements(
+        [
+            (cvcuda.OSDElement.RECT, [255, 128, 64, 255], [2, 3, 7, 8, 0]),
+            (cvcuda.OSDElement.LINE, [10, 20, 30, 128], [0, 0, 8, 8, 2]),
+            (cvcuda.OSDElement.POLYGON, [1, 2, 3, 255], [0, 3]),
+            (cvcuda.OSDElement.GLYPH, [200, 100, 50, 255], [1, 1, 2, 0]),
+        ]
+    )
+    elements = np.broadcast_to(elements, (shape[0], 1) + elements.shape).copy()
+    points = np.array([[4, 4], [8, 4], [4, 8]], dtype=np.float32)
+    points = np.broadcast_to(points, (shape[0], 1) + points.shape).copy()
+    glyphs = np.full((1, 3, 2, 1), 255, dtype=np.uint8)
+
+    out = cvcuda.osd_into(
+        src,
+        nvcv.as_tensor(util.to_cuda_buffer(elements), "NHWC"),
+        points=nvcv.as_tensor(util.to_cuda_buffer(points), "NHWC"),
+        glyphs=nvcv.as_tensor(util.to_cuda_buffer(glyphs), "NHWC"),
+    )
+    assert out is src
+    assert out.layout == "NHWC"
+    assert out.shape == shape
+    assert out.dtype == np.uint8
+
+    # the filled opaque rectangle covers the pixels of [2, 7) x [3, 8), the 4th
+    # channel is left unchanged
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()
+    color = np.array([255, 128, 64, 0][: shape[3]], dtype=np.uint8)
+    assert (out[:, 7, 2] == color).all()
+    assert not out[:, 20:, 20:].any()
+
+
+def test_op_osd_counts():
+    shape = (2, 16, 16, 3)
+    src = nvcv.as_tensor(util.to_cuda_buffer(np.zeros(shape, dtype=np.uint8)), "NHWC")
+
+    elements = make_elements(
+        [(cvcuda.OSDElement.RECT, [255, 255, 255, 255], [0, 0, 16, 16, 0])]
+    )
+    elements = np.broadcast_to(elements, (shape[0], 1) + elements.shape).copy()
+    counts = np.array([0, 1], dtype=np.int32).reshape(2, 1, 1, 1)
+
+    stream = cvcuda.Stream()
+    out = cvcuda.osd_into(
+        src,
+        nvcv.as_tensor(util.to_cuda_buffer(elements), "NHWC"),
+        num_elements=nvcv.as_tensor(util.to_cuda_buffer(counts), "NHWC"),
+        stream=stream,
+    )
+    assert out is src
+
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()
+    assert not out[0].any()
+    assert (out[1] == 255).all()
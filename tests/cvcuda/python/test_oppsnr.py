@@ -0,0 +1,83 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import cvcuda
+import nvcv
+import pytest as t
+import numpy as np
+import torch
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+def to_tensor(host, layout):
+    return nvcv.as_tensor(util.to_cuda_buffer(host), layout)
+
+
+def out_tensor(num_samples, num_channels):
+    return cvcuda.Tensor((num_samples, 1, 1, num_channels), np.float32, "NHWC")
+
+
+@t.mark.parametrize(
+    "shape,dtype,layout,per_channel,max_value",
+    [
+        ((2, 48, 64, 3), np.uint8, "NHWC", False, 0),
+        ((1, 17, 23, 4), np.uint8, "NHWC", True, 200),
+        ((3, 40, 50, 1), np.uint16, "NHWC", True, 255),
+        ((40, 50, 3), np.float32, "HWC", False, 255),
+    ],
+)
+def test_op_psnr(shape, dtype, layout, per_channel, max_value):
+    ref = RNG.integers(0, 256, shape)
+    img = np.clip(ref + RNG.integers(-8, 9, shape), 0, 255)
+
+    src = to_tensor(img.astype(dtype), layout)
+    out = cvcuda.psnr(
+        src, to_tensor(ref.astype(dtype), layout), max_value, per_channel=per_channel
+    )
+    num_samples = shape[0] if layout == "NHWC" else 1
+    num_channels = shape[-1] if per_channel else 1
+    assert out.layout == "NHWC"
+    assert out.shape == (num_samples, 1, 1, num_channels)
+    assert out.dtype == np.float32
+
+    # scores of the samples, and of their channels
+    err = ((img - ref) ** 2).reshape(num_samples, -1, shape[-1])
+    mse = err.mean(axis=1) if per_channel else err.mean(axis=(1, 2))[:, None]
+    peak = max_value if max_value > 0 else 255
+    gold = 10 * np.log10(peak * peak / mse)
+
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()
+    assert np.allclose(out.reshape(gold.shape), gold, atol=1e-3)
+
+    stream = cvcuda.Stream()
+    tmp = cvcuda.psnr_into(
+        dst=out_tensor(num_samples, num_channels),
+        src=src,
+        ref=to_tensor(ref.astype(dtype), layout),
+        max_value=max_value,
+        stream=stream,
+    )
+    assert tmp.shape == (num_samples, 1, 1, num_channels)
+
+
+def test_op_psnr_equal_images():
+    img = to_tensor(RNG.integers(0, 256, (2, 16, 16, 3), dtype=np.uint8), "NHWC")
+    out = cvcuda.psnr(img, img)
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()
+    assert np.isinf(out).all()
@@ -0,0 +1,160 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+@t.mark.parametrize(
+    "input,map,interp,map_value_type,border_mode,border_value",
+    [
+        (
+            cvcuda.Tensor((1, 64, 48, 3), np.uint8, "NHWC"),
+            util.create_tensor(
+                (1, 32, 24, 2), np.float32, "NHWC", max_random=48, rng=RNG
+            ),
+            cvcuda.Interp.LINEAR,
+            cvcuda.RemapMapValueType.ABSOLUTE,
+            cvcuda.Border.CONSTANT,
+            [0],
+        ),
+        (
+            cvcuda.Tensor((3, 41, 13, 4), np.float32, "NHWC"),
+            util.create_tensor((3, 41, 13, 3), np.int16, "NHWC", max_random=8, rng=RNG),
+            cvcuda.Interp.NEAREST,
+            cvcuda.RemapMapValueType.RELATIVE,
+            cvcuda.Border.REPLICATE,
+            [],
+        ),
+        (
+            cvcuda.Tensor((16, 23, 1), np.uint8, "HWC"),
+            util.create_tensor((20, 10, 2), np.float32, "HWC", max_random=16, rng=RNG),
+            cvcuda.Interp.CUBIC,
+            cvcuda.RemapMapValueType.ABSOLUTE,
+            cvcuda.Border.REFLECT101,
+            [1, 2, 3, 4],
+        ),
+    ],
+)
+def test_op_remap(input, map, interp, map_value_type, border_mode, border_value):
+    out_shape = list(input.shape)
+    out_shape[-3] = map.shape[-3]
+    out_shape[-2] = map.shape[-2]
+    out_shape = tuple(out_shape)
+
+    out = cvcuda.remap(input, map)
+    assert out.layout == input.layout
+    assert out.shape == out_shape
+    assert out.dtype == input.dtype
+
+    out = cvcuda.Tensor(out_shape, input.dtype, input.layout)
+    tmp = cvcuda.remap_into(out, input, map, interp)
+    assert tmp is out
+
+    stream = cvcuda.Stream()
+    out = cvcuda.remap(
+        src=input,
+        map=map,
+        interp=interp,
+        map_value_type=map_value_type,
+        border_mode=border_mode,
+        border_value=border_value,
+        stream=stream,
+    )
+    assert out.layout == input.layout
+    assert out.shape == out_shape
+    assert out.dtype == input.dtype
+
+    tmp = cvcuda.remap_into(
+        dst=out,
+        src=input,
+        map=map,
+        interp=interp,
+        map_value_type=map_value_type,
+        border_mode=border_mode,
+        border_value=border_value,
+        stream=stream,
+    )
+    assert tmp is out
+
+
+@t.mark.parametrize(
+    "nimages, format, max_size, map_samples, map_dtype, interp, map_value_type",
+    [
+        (
+            5,
+            cvcuda.Format.RGB8,
+            (16, 23),
+            1,
+            np.float32,
+            cvcuda.Interp.LINEAR,
+            cvcuda.RemapMapValueType.ABSOLUTE,
+        ),
+        (
+            4,
+            cvcuda.Format.RGBA8,
+            (33, 17),
+            4,
+            np.int16,
+            cvcuda.Interp.NEAREST,
+            cvcuda.RemapMapValueType.RELATIVE,
+        ),
+    ],
+)
+def test_op_remapvarshape(
+    nimages, format, max_size, map_samples, map_dtype, interp, map_value_type
+):
+    input = util.create_image_batch(
+        nimages, format, max_size=max_size, max_random=255, rng=RNG
+    )
+
+    channels = 2 if map_dtype == np.float32 else 3
+    map = util.create_tensor(
+        (map_samples, max_size[1], max_size[0], channels),
+        map_dtype,
+        "NHWC",
+        max_random=8,
+        rng=RNG,
+    )
+
+    out = cvcuda.remap(input, map, interp, map_value_type=map_value_type)
+    assert len(out) == len(input)
+    assert out.capacity == input.capacity
+    assert out.uniqueformat == input.uniqueformat
+    assert out.maxsize == input.maxsize
+
+    stream = cvcuda.Stream()
+
+    out = util.clone_image_batch(input)
+    tmp = cvcuda.remap_into(
+        dst=out,
+        src=input,
+        map=map,
+        interp=interp,
+        map_value_type=map_value_type,
+        border_mode=cvcuda.Border.CONSTANT,
+        border_value=[1, 2, 3, 4],
+        stream=stream,
+    )
+    assert tmp is out
+    assert len(out) == len(input)
+    assert out.capacity == input.capacity
+    assert out.uniqueformat == input.uniqueformat
+    assert out.maxsize == input.maxsize
@@ -14,6 +14,7 @@
 # limitations under the License.
 
 import cvcuda
+import nvcv
 import pytest as t
 import numpy as np
 import cvcuda_util as util
@@ -115,3 +116,31 @@ def test_op_resizevarshape(inSize, outSize, interp):
     assert out.capacity == input.capacity
     assert out.uniqueformat == input.uniqueformat
     assert out.maxsize == outSize
+
+
+@t.mark.parametrize("antialias", [False, True])
+def test_op_resizevarshape_per_sample(antialias):
+    RNG = np.random.default_rng(0)
+
+    input = util.create_image_batch(
+        4, cvcuda.Format.RGBA8, size=(160, 120), max_random=256, rng=RNG
+    )
+    sizes = [[320, 240], [20, 15], [170, 130], [80, 60]]
+    interp = np.array(
+        [
+            cvcuda.Interp.CUBIC.value,
+            cvcuda.Interp.LINEAR.value,
+            cvcuda.Interp.NEAREST.value,
+            cvcuda.Interp.AREA.value,
+        ],
+        dtype=np.int32,
+    )
+    interp = nvcv.as_tensor(util.to_cuda_buffer(interp), "N")
+
+    out = cvcuda.resize(input, sizes, interp, antialias=antialias)
+    assert len(out) == len(input)
+    assert out.uniqueformat == input.uniqueformat
+    assert out.maxsize == (320, 240)
+
+    tmp = cvcuda.resize_into(out, input, interp, antialias=antialias)
+    assert tmp is out
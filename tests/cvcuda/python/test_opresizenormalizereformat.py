@@ -0,0 +1,179 @@
+# SPDX-FileCopyrightText: Copyright (c) 2022-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+@t.mark.parametrize(
+    "input,size,base,scale,interp,flags",
+    [
+        (
+            cvcuda.Tensor((5, 16, 23, 3), np.uint8, "NHWC"),
+            (32, 24),
+            cvcuda.Tensor((1, 1, 1, 3), np.float32, "NHWC"),
+            cvcuda.Tensor((1, 1, 1, 3), np.float32, "NHWC"),
+            cvcuda.Interp.LINEAR,
+            None,
+        ),
+        (
+            cvcuda.Tensor((2, 41, 13, 4), np.uint8, "NHWC"),
+            (7, 9),
+            cvcuda.Tensor((2, 1, 1, 1), np.float32, "NHWC"),
+            cvcuda.Tensor((1, 1, 1, 4), np.float32, "NHWC"),
+            cvcuda.Interp.NEAREST,
+            cvcuda.ResizeNormalizeReformatFlags.SCALE_IS_STDDEV
+            | cvcuda.ResizeNormalizeReformatFlags.SWAP_RB,
+        ),
+        (
+            cvcuda.Tensor((16, 23, 1), np.uint8, "HWC"),
+            (23, 16),
+            cvcuda.Tensor((1, 1, 1, 1), np.float32, "NHWC"),
+            cvcuda.Tensor((1, 1, 1, 1), np.float32, "NHWC"),
+            cvcuda.Interp.LINEAR,
+            None,
+        ),
+    ],
+)
+def test_op_resize_normalize_reformat(input, size, base, scale, interp, flags):
+    nsamples = input.shape[0] if input.layout == "NHWC" else 1
+    out_shape = (nsamples, input.shape[-1], size[1], size[0])
+
+    out = cvcuda.resize_normalize_reformat(input, size, base, scale)
+    assert out.layout == "NCHW"
+    assert out.shape == out_shape
+    assert out.dtype == np.float32
+
+    out = cvcuda.Tensor(out_shape, np.float32, "NCHW")
+    tmp = cvcuda.resize_normalize_reformat_into(out, input, base, scale)
+    assert tmp is out
+
+    stream = cvcuda.Stream()
+    out = cvcuda.resize_normalize_reformat(
+        src=input,
+        size=size,
+        base=base,
+        scale=scale,
+        interp=interp,
+        flags=flags,
+        globalscale=1 / 255,
+        globalshift=0.5,
+        epsilon=0.1,
+        stream=stream,
+    )
+    assert out.layout == "NCHW"
+    assert out.shape == out_shape
+    assert out.dtype == np.float32
+
+    tmp = cvcuda.resize_normalize_reformat_into(
+        dst=out,
+        src=input,
+        base=base,
+        scale=scale,
+        interp=interp,
+        flags=flags,
+        globalscale=1 / 255,
+        globalshift=0.5,
+        epsilon=0.1,
+        stream=stream,
+    )
+    assert tmp is out
+
+
+@t.mark.parametrize(
+    "nimages,format,max_size,size,interp",
+    [
+        (5, cvcuda.Format.RGB8, (16, 23), (32, 32), cvcuda.Interp.LINEAR),
+        (3, cvcuda.Format.RGBA8, (33, 17), (8, 12), cvcuda.Interp.NEAREST),
+    ],
+)
+def test_op_resize_normalize_reformat_varshape(nimages, format, max_size, size, interp):
+    input = util.create_image_batch(
+        nimages, format, max_size=max_size, max_random=256, rng=RNG
+    )
+    channels = 4 if format == cvcuda.Format.RGBA8 else 3
+    base = cvcuda.Tensor((1, 1, 1, channels), np.float32, "NHWC")
+    scale = cvcuda.Tensor((nimages, 1, 1, 1), np.float32, "NHWC")
+    out_shape = (nimages, channels, size[1], size[0])
+
+    out = cvcuda.resize_normalize_reformat(input, size, base, scale, interp)
+    assert out.layout == "NCHW"
+    assert out.shape == out_shape
+    assert out.dtype == np.float32
+
+    stream = cvcuda.Stream()
+    tmp = cvcuda.resize_normalize_reformat_into(
+        out,
+        input,
+        base,
+        scale,
+        interp,
+        cvcuda.ResizeNormalizeReformatFlags.SWAP_RB,
+        globalscale=1 / 255,
+        stream=stream,
+    )
+    assert tmp is out
+
+
+@t.mark.parametrize(
+    "luma,chroma,size,code,interp,roi",
+    [
+        (
+            cvcuda.Tensor((3, 16, 24, 1), np.uint8, "NHWC"),
+            cvcuda.Tensor((3, 8, 12, 2), np.uint8, "NHWC"),
+            (32, 20),
+            cvcuda.ColorConversion.YUV2RGB_NV12,
+            cvcuda.Interp.LINEAR,
+            None,
+        ),
+        (
+            cvcuda.Tensor((2, 18, 10, 1), np.uint16, "NHWC"),
+            cvcuda.Tensor((2, 9, 10, 1), np.uint16, "NHWC"),
+            (5, 7),
+            cvcuda.ColorConversion.YUV2BGR_NV21,
+            cvcuda.Interp.NEAREST,
+            cvcuda.RectI(x=1, y=3, width=7, height=11),
+        ),
+    ],
+)
+def test_op_resize_normalize_reformat_nv12(luma, chroma, size, code, interp, roi):
+    base = cvcuda.Tensor((1, 1, 1, 3), np.float32, "NHWC")
+    scale = cvcuda.Tensor((1, 1, 1, 1), np.float32, "NHWC")
+    out_shape = (luma.shape[0], 3, size[1], size[0])
+
+    out = cvcuda.resize_normalize_reformat_nv12(luma, chroma, size, base, scale)
+    assert out.layout == "NCHW"
+    assert out.shape == out_shape
+    assert out.dtype == np.float32
+
+    stream = cvcuda.Stream()
+    tmp = cvcuda.resize_normalize_reformat_nv12_into(
+        dst=out,
+        luma=luma,
+        chroma=chroma,
+        base=base,
+        scale=scale,
+        code=code,
+        interp=interp,
+        roi=roi,
+        globalscale=1 / 255,
+        stream=stream,
+    )
+    assert tmp is out
@@ -0,0 +1,41 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,ksize,border",
+    [
+        (cvcuda.Tensor((4, 48, 64, 1), np.uint8, "NHWC"), 1, cvcuda.Border.REFLECT101),
+        (cvcuda.Tensor((77, 123, 1), np.float32, "HWC"), 3, cvcuda.Border.REPLICATE),
+        (cvcuda.Tensor((2, 40, 50, 1), np.uint16, "NHWC"), 1, cvcuda.Border.CONSTANT),
+    ],
+)
+def test_op_sharpness(input, ksize, border):
+    num_samples = input.shape[0] if input.layout == "NHWC" else 1
+
+    out = cvcuda.sharpness(input, ksize, border)
+    assert out.layout == "NHWC"
+    assert out.shape == (num_samples, 1, 1, 1)
+    assert out.dtype == np.float32
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor((num_samples, 1, 1, 1), np.float32, "NHWC")
+    tmp = cvcuda.sharpness_into(out, input, ksize=ksize, border=border, stream=stream)
+    assert tmp is out
@@ -0,0 +1,54 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,ksize,scale,border",
+    [
+        (
+            cvcuda.Tensor((4, 16, 23, 3), np.uint8, "NHWC"),
+            3,
+            1.0,
+            cvcuda.Border.REFLECT101,
+        ),
+        (
+            cvcuda.Tensor((16, 23, 1), np.float32, "HWC"),
+            -1,
+            0.5,
+            cvcuda.Border.CONSTANT,
+        ),
+        (
+            cvcuda.Tensor((2, 33, 17, 1), np.int16, "NHWC"),
+            7,
+            1.0,
+            cvcuda.Border.REPLICATE,
+        ),
+    ],
+)
+def test_op_sobel(input, ksize, scale, border):
+    dx, dy, mag = cvcuda.sobel(input, ksize, scale, border)
+    for out in (dx, dy, mag):
+        assert out.layout == input.layout
+        assert out.shape == input.shape
+        assert out.dtype == np.float32
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(input.shape, np.int16, input.layout)
+    cvcuda.sobel_into(None, None, out, input, ksize, scale, border, stream=stream)
+    cvcuda.sobel_into(out, None, None, input, ksize, stream=stream)
@@ -0,0 +1,74 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import cvcuda
+import nvcv
+import pytest as t
+import numpy as np
+import torch
+import cvcuda_util as util
+
+
+RNG = np.random.default_rng(0)
+
+
+def to_tensor(host, layout):
+    return nvcv.as_tensor(util.to_cuda_buffer(host), layout)
+
+
+@t.mark.parametrize(
+    "shape,dtype,layout,per_channel",
+    [
+        ((2, 48, 64, 3), np.uint8, "NHWC", False),
+        ((1, 17, 23, 4), np.uint8, "NHWC", True),
+        ((3, 40, 50, 1), np.uint16, "NHWC", True),
+        ((40, 50, 3), np.float32, "HWC", False),
+    ],
+)
+def test_op_ssim(shape, dtype, layout, per_channel):
+    ref = RNG.integers(0, 256, shape)
+    img = np.clip(ref + RNG.integers(-40, 41, shape), 0, 255)
+    ref = to_tensor(ref.astype(dtype), layout)
+
+    num_samples = shape[0] if layout == "NHWC" else 1
+    num_channels = shape[-1] if per_channel else 1
+
+    # the score of equal images is 1, noise lowers it
+    out = cvcuda.ssim(ref, ref, 255, per_channel=per_channel)
+    assert out.layout == "NHWC"
+    assert out.shape == (num_samples, 1, 1, num_channels)
+    assert out.dtype == np.float32
+    out = torch.as_tensor(out.cuda(), device="cuda").cpu().numpy()
+    assert np.allclose(out, 1, atol=1e-5)
+
+    dst = cvcuda.Tensor((num_samples, 1, 1, num_channels), np.float32, "NHWC")
+    stream = cvcuda.Stream()
+    tmp = cvcuda.ssim_into(
+        dst=dst,
+        src=to_tensor(img.astype(dtype), layout),
+        ref=ref,
+        max_value=255,
+        stream=stream,
+    )
+    assert tmp is dst
+    out = torch.as_tensor(tmp.cuda(), device="cuda").cpu().numpy()
+    assert ((out > 0) & (out < 0.99)).all()
+
+
+def test_op_ssim_small_images():
+    img = to_tensor(np.zeros((1, 10, 32, 1), np.uint8), "NHWC")
+    with t.raises(RuntimeError):
+        cvcuda.ssim(img, img)
@@ -0,0 +1,51 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,type,mask_shape",
+    [
+        (
+            cvcuda.Tensor((4, 16, 23, 3), np.uint8, "NHWC"),
+            cvcuda.TemporalFilterType.RUNNING_AVERAGE,
+            (4, 16, 23, 1),
+        ),
+        (
+            cvcuda.Tensor((16, 23, 1), np.float32, "HWC"),
+            cvcuda.TemporalFilterType.RECURSIVE,
+            (1, 16, 23, 1),
+        ),
+    ],
+)
+def test_op_temporal_filter(input, type, mask_shape):
+    state_shape = (1,) + input.shape[-3:]
+    state = cvcuda.Tensor(state_shape, np.float32, "NHWC")
+
+    out, mask = cvcuda.temporal_filter(input, state, type, 0.1, 10, reset=True)
+    assert out.layout == input.layout
+    assert out.shape == input.shape
+    assert out.dtype == input.dtype
+    assert mask.layout == "NHWC"
+    assert mask.shape == mask_shape
+    assert mask.dtype == np.uint8
+
+    stream = cvcuda.Stream()
+    out = cvcuda.Tensor(input.shape, input.dtype, input.layout)
+    cvcuda.temporal_filter_into(out, None, input, state, type, 0.1, 10, stream=stream)
+    cvcuda.temporal_filter_into(None, None, input, state, type, 0.1, 10, stream=stream)
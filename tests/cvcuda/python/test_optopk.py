@@ -0,0 +1,44 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import cvcuda
+import pytest as t
+import numpy as np
+
+
+@t.mark.parametrize(
+    "input,k,softmax,out_shape",
+    [
+        (cvcuda.Tensor((4, 1, 1000, 1), np.float32, "NHWC"), 5, True, (4, 1, 5, 1)),
+        (cvcuda.Tensor((1, 10, 1), np.float32, "HWC"), 10, False, (1, 1, 10, 1)),
+        (cvcuda.Tensor((2, 1, 21841, 1), np.float32, "NHWC"), 1, False, (2, 1, 1, 1)),
+    ],
+)
+def test_op_topk(input, k, softmax, out_shape):
+    scores, indices = cvcuda.topk(input, k, softmax)
+    assert scores.layout == "NHWC"
+    assert scores.shape == out_shape
+    assert scores.dtype == np.float32
+    assert indices.layout == "NHWC"
+    assert indices.shape == out_shape
+    assert indices.dtype == np.int32
+
+    stream = cvcuda.Stream()
+    scores = cvcuda.Tensor(out_shape, np.float32, "NHWC")
+    indices = cvcuda.Tensor(out_shape, np.int32, "NHWC")
+    tmp = cvcuda.topk_into(scores, indices, input, softmax=softmax, stream=stream)
+    assert tmp[0] is scores
+    assert tmp[1] is indices
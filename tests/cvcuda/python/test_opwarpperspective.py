@@ -14,6 +14,7 @@
 # limitations under the License.
 
 import cvcuda
+import nvcv
 import pytest as t
 import numpy as np
 import cvcuda_util as util
@@ -225,3 +226,48 @@ def test_op_warp_perspectivevarshape(
     assert out.capacity == input.capacity
     assert out.uniqueformat == input.uniqueformat
     assert out.maxsize == input.maxsize
+
+
+def test_op_warp_perspective_crop():
+    input = util.create_image_batch(
+        2, cvcuda.Format.RGB8, max_size=(64, 48), max_random=128.0, rng=RNG
+    )
+
+    quads = nvcv.as_tensor(
+        util.to_cuda_buffer(
+            np.array(
+                [
+                    [0, 5, 4, 40, 8, 39, 17, 4, 13],
+                    [1, 10, 20, 50, 18, 52, 27, 9, 30],
+                    [0, 2, 35, 60, 33, 62, 46, 1, 44],
+                ],
+                np.float32,
+            )
+        ),
+        "NW",
+    )
+    sizes = [(32, 8), (24, 6), (40, 10)]
+
+    out = cvcuda.warp_perspective_crop(
+        input,
+        quads,
+        sizes,
+        cvcuda.Interp.LINEAR,
+        border_mode=cvcuda.Border.REPLICATE,
+        border_value=[],
+    )
+    assert len(out) == len(sizes)
+    assert out.uniqueformat == input.uniqueformat
+    assert [img.size for img in out] == sizes
+
+    stream = cvcuda.Stream()
+    tmp = cvcuda.warp_perspective_crop_into(
+        dst=out,
+        src=input,
+        quads=quads,
+        flags=cvcuda.Interp.CUBIC,
+        border_mode=cvcuda.Border.CONSTANT,
+        border_value=[0],
+        stream=stream,
+    )
+    assert tmp is out
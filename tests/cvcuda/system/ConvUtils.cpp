@@ -105,8 +105,8 @@ inline void Morph(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std
     using BT  = cuda::BaseType<T>;
     int2 size = cuda::DropCast<2>(shape);
 
-    BT val
-        = (type == NVCVMorphologyType::NVCV_DILATE) ? std::numeric_limits<BT>::min() : std::numeric_limits<BT>::max();
+    BT val = (type == NVCVMorphologyType::NVCV_DILATE) ? std::numeric_limits<BT>::lowest()
+                                                       : std::numeric_limits<BT>::max();
     T borderValueT;
     for (int e = 0; e < cuda::NumElements<T>; ++e)
     {
@@ -167,6 +167,7 @@ inline void Morph(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std
 
 NVCV_TEST_INST(uint8_t);
 NVCV_TEST_INST(ushort);
+NVCV_TEST_INST(short2);
 NVCV_TEST_INST(uchar3);
 NVCV_TEST_INST(uchar4);
 NVCV_TEST_INST(float4);
@@ -192,6 +193,7 @@ void Convolve(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std::ve
 
         NVCV_TEST_CASE(U8, uint8_t);
         NVCV_TEST_CASE(U16, ushort);
+        NVCV_TEST_CASE(2S16, short2);
         NVCV_TEST_CASE(3U8, uchar3);
         NVCV_TEST_CASE(4U8, uchar4);
         NVCV_TEST_CASE(4F32, float4);
@@ -219,6 +221,7 @@ void Morph(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std::vecto
 
         NVCV_TEST_CASE(U8, uint8_t);
         NVCV_TEST_CASE(U16, ushort);
+        NVCV_TEST_CASE(2S16, short2);
         NVCV_TEST_CASE(3U8, uchar3);
         NVCV_TEST_CASE(4U8, uchar4);
         NVCV_TEST_CASE(4F32, float4);
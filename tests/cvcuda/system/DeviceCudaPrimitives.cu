@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeviceCudaPrimitives.hpp"
+
+#include <cvcuda/cuda/Filter2D.hpp> // the object of this test
+#include <cvcuda/cuda/Resize.hpp>   // the object of this test
+#include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/cuda/BorderWrap.hpp>
+#include <nvcv/cuda/TensorWrap.hpp>
+
+namespace cuda = nvcv::cuda;
+
+template<NVCVInterpolationType I>
+static void RunResize(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                      const nvcv::ITensorDataStridedCuda &out)
+{
+    using R = cvcuda::cuda::Resize<uint8_t, 3, I>;
+
+    auto inAccess  = nvcv::TensorDataAccessStridedImagePlanar::Create(in);
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(out);
+
+    int2 srcSize{static_cast<int>(inAccess->numCols()), static_cast<int>(inAccess->numRows())};
+    int2 dstSize{static_cast<int>(outAccess->numCols()), static_cast<int>(outAccess->numRows())};
+
+    R::run(stream, cuda::CreateTensorWrapNHW<const uchar3>(in), cuda::CreateTensorWrapNHW<uchar3>(out), srcSize,
+           dstSize, static_cast<int>(outAccess->numSamples()));
+}
+
+void DeviceRunResizeRGB8(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                         const nvcv::ITensorDataStridedCuda &out, NVCVInterpolationType interpolation)
+{
+    switch (interpolation)
+    {
+    case NVCV_INTERP_NEAREST:
+        RunResize<NVCV_INTERP_NEAREST>(stream, in, out);
+        break;
+    case NVCV_INTERP_LINEAR:
+        RunResize<NVCV_INTERP_LINEAR>(stream, in, out);
+        break;
+    default:
+        RunResize<NVCV_INTERP_CUBIC>(stream, in, out);
+        break;
+    }
+}
+
+void DeviceRunFilter3x3U8(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                          const nvcv::ITensorDataStridedCuda &out, const float *kernel, int2 anchor)
+{
+    using F = cvcuda::cuda::Filter2D<uint8_t, 1, 3, 3, NVCV_BORDER_REFLECT101>;
+
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(out);
+
+    int2 size{static_cast<int>(outAccess->numCols()), static_cast<int>(outAccess->numRows())};
+
+    F::run(stream, cuda::CreateBorderWrapNHW<const uchar1, NVCV_BORDER_REFLECT101>(in, {}),
+           cuda::CreateTensorWrapNHW<uchar1>(out), kernel, anchor, size, static_cast<int>(outAccess->numSamples()));
+}
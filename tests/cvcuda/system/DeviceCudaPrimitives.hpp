@@ -0,0 +1,33 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CVCUDA_TESTS_DEVICE_CUDA_PRIMITIVES_HPP
+#define CVCUDA_TESTS_DEVICE_CUDA_PRIMITIVES_HPP
+
+#include <cuda_runtime.h>
+#include <cvcuda/Types.h>
+#include <nvcv/ITensorData.hpp>
+
+// RGB8 tensors, the primitives are instantiated for the interpolation given at run time
+void DeviceRunResizeRGB8(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                         const nvcv::ITensorDataStridedCuda &out, NVCVInterpolationType interpolation);
+
+// 3x3 correlation with reflect101 border of U8 tensors, kernel in device memory
+void DeviceRunFilter3x3U8(cudaStream_t stream, const nvcv::ITensorDataStridedCuda &in,
+                          const nvcv::ITensorDataStridedCuda &out, const float *kernel, int2 anchor);
+
+#endif // CVCUDA_TESTS_DEVICE_CUDA_PRIMITIVES_HPP
@@ -0,0 +1,186 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/BatchCoalescer.hpp>
+#include <cvcuda/OpResize.hpp>
+#include <nvcv/Image.hpp>
+
+#include <random>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+// Requests whose inputs are filled with random values, copied by a nearest-neighbor resize to the same size
+struct Requests
+{
+    std::vector<std::unique_ptr<nvcv::Image>> src, dst;
+    std::vector<std::vector<uint8_t>>         srcVec;
+
+    Requests(int count, cudaStream_t stream)
+    {
+        std::default_random_engine             rng(0);
+        std::uniform_int_distribution<int>     udistSize(10, 40);
+        std::uniform_int_distribution<uint8_t> udist(0, 255);
+
+        for (int i = 0; i < count; ++i)
+        {
+            nvcv::Size2D size{udistSize(rng), udistSize(rng)};
+            src.emplace_back(std::make_unique<nvcv::Image>(size, nvcv::FMT_U8));
+            dst.emplace_back(std::make_unique<nvcv::Image>(size, nvcv::FMT_U8));
+
+            srcVec.emplace_back(size.w * size.h);
+            std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return udist(rng); });
+
+            auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(src[i]->exportData());
+            EXPECT_NE(data, nullptr);
+            EXPECT_EQ(cudaSuccess, cudaMemcpy2DAsync(data->plane(0).basePtr, data->plane(0).rowStride,
+                                                     srcVec[i].data(), size.w, size.w, size.h,
+                                                     cudaMemcpyHostToDevice, stream));
+        }
+        EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    }
+
+    std::vector<uint8_t> download(int i) const
+    {
+        nvcv::Size2D         size = dst[i]->size();
+        std::vector<uint8_t> vec(size.w * size.h);
+
+        auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(dst[i]->exportData());
+        EXPECT_NE(data, nullptr);
+        EXPECT_EQ(cudaSuccess, cudaMemcpy2D(vec.data(), size.w, data->plane(0).basePtr, data->plane(0).rowStride,
+                                            size.w, size.h, cudaMemcpyDeviceToHost));
+        return vec;
+    }
+};
+
+} // namespace
+
+TEST(BatchCoalescer, full_batches_are_launched_without_timeout)
+{
+    const int numRequests = 8;
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    Requests requests(numRequests, stream);
+
+    {
+        cvcuda::Resize       resize;
+        std::vector<int32_t> batchSizes;
+
+        // The timeout is never reached, only full batches are launched
+        cvcuda::BatchCoalescer coalescer(stream, {4, std::chrono::microseconds(1h)},
+                                         [&](cudaStream_t s, nvcv::IImageBatchVarShape &in,
+                                             nvcv::IImageBatchVarShape &out)
+                                         {
+                                             batchSizes.push_back(in.numImages());
+                                             resize(s, in, out, NVCV_INTERP_NEAREST);
+                                         });
+
+        std::vector<std::future<void>> done;
+        for (int i = 0; i < numRequests; ++i)
+        {
+            done.push_back(coalescer.submit(*requests.src[i], *requests.dst[i]));
+        }
+
+        for (int i = 0; i < numRequests; ++i)
+        {
+            ASSERT_EQ(std::future_status::ready, done[i].wait_for(10s));
+            EXPECT_NO_THROW(done[i].get());
+            EXPECT_EQ(requests.srcVec[i], requests.download(i));
+        }
+
+        EXPECT_EQ(coalescer.numBatches(), 2);
+        EXPECT_EQ(coalescer.numRequests(), numRequests);
+        EXPECT_EQ(batchSizes, (std::vector<int32_t>{4, 4}));
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(BatchCoalescer, partial_batches_are_launched_on_timeout_and_flush)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    Requests requests(3, stream);
+
+    {
+        cvcuda::Resize resize;
+
+        cvcuda::BatchCoalescer coalescer(stream, {16, std::chrono::microseconds(1ms)},
+                                         [&](cudaStream_t s, nvcv::IImageBatchVarShape &in,
+                                             nvcv::IImageBatchVarShape &out)
+                                         { resize(s, in, out, NVCV_INTERP_NEAREST); });
+
+        // A lone request runs once its timeout expires
+        std::future<void> done = coalescer.submit(*requests.src[0], *requests.dst[0]);
+        ASSERT_EQ(std::future_status::ready, done.wait_for(10s));
+        EXPECT_EQ(requests.srcVec[0], requests.download(0));
+        EXPECT_EQ(coalescer.numBatches(), 1);
+    }
+
+    {
+        cvcuda::Resize resize;
+
+        cvcuda::BatchCoalescer coalescer(stream, {16, std::chrono::microseconds(1h)},
+                                         [&](cudaStream_t s, nvcv::IImageBatchVarShape &in,
+                                             nvcv::IImageBatchVarShape &out)
+                                         { resize(s, in, out, NVCV_INTERP_NEAREST); });
+
+        std::future<void> done1 = coalescer.submit(*requests.src[1], *requests.dst[1]);
+        std::future<void> done2 = coalescer.submit(*requests.src[2], *requests.dst[2]);
+        coalescer.flush();
+
+        ASSERT_EQ(std::future_status::ready, done1.wait_for(10s));
+        ASSERT_EQ(std::future_status::ready, done2.wait_for(10s));
+        EXPECT_EQ(requests.srcVec[1], requests.download(1));
+        EXPECT_EQ(requests.srcVec[2], requests.download(2));
+        EXPECT_EQ(coalescer.numRequests(), 2);
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(BatchCoalescer, launch_errors_are_reported_to_each_request)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    Requests requests(2, stream);
+
+    {
+        cvcuda::BatchCoalescer coalescer(stream, {2, std::chrono::microseconds(1h)},
+                                         [&](cudaStream_t, nvcv::IImageBatchVarShape &, nvcv::IImageBatchVarShape &)
+                                         { throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Bad batch"); });
+
+        std::future<void> done1 = coalescer.submit(*requests.src[0], *requests.dst[0]);
+        std::future<void> done2 = coalescer.submit(*requests.src[1], *requests.dst[1]);
+
+        EXPECT_THROW(done1.get(), nvcv::Exception);
+        EXPECT_THROW(done2.get(), nvcv::Exception);
+    }
+
+    EXPECT_THROW(cvcuda::BatchCoalescer(stream, {0, std::chrono::microseconds(0)},
+                                        [](cudaStream_t, nvcv::IImageBatchVarShape &, nvcv::IImageBatchVarShape &) {}),
+                 nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
@@ -0,0 +1,246 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+#include "FlipUtils.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <cvcuda/BatchScheduler.hpp>
+#include <cvcuda/OpFlip.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <random>
+
+namespace test = nvcv::test;
+
+TEST(BatchScheduler, split_balances_samples)
+{
+    cudaStream_t streams[3];
+    for (cudaStream_t &s : streams)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamCreate(&s));
+    }
+
+    {
+        cvcuda::BatchScheduler sched({{0, streams[0]}, {0, streams[1]}, {0, streams[2]}});
+
+        using Ranges = std::vector<cvcuda::BatchScheduler::Range>;
+        EXPECT_EQ(sched.split(7), (Ranges{{0, 3}, {3, 5}, {5, 7}}));
+        EXPECT_EQ(sched.split(6), (Ranges{{0, 2}, {2, 4}, {4, 6}}));
+        EXPECT_EQ(sched.split(2), (Ranges{{0, 1}, {1, 2}}));
+        EXPECT_EQ(sched.split(0), Ranges{});
+    }
+
+    for (cudaStream_t &s : streams)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamDestroy(s));
+    }
+}
+
+TEST(BatchScheduler, slice_tensor_aliases_parent)
+{
+    nvcv::Tensor tensor = test::CreateTensor(5, 16, 8, nvcv::FMT_RGB8);
+
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(data, nullptr);
+
+    auto slice = cvcuda::BatchScheduler::SliceTensor(tensor, 2, 4);
+    ASSERT_NE(slice, nullptr);
+
+    auto *sliceData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(slice->exportData());
+    ASSERT_NE(sliceData, nullptr);
+
+    EXPECT_EQ(sliceData->shape()[0], 2);
+    EXPECT_EQ(sliceData->layout(), data->layout());
+    EXPECT_EQ(sliceData->basePtr(), data->basePtr() + 2 * data->stride(0));
+    for (int d = 0; d < data->rank(); ++d)
+    {
+        EXPECT_EQ(sliceData->stride(d), data->stride(d));
+    }
+
+    EXPECT_THROW(cvcuda::BatchScheduler::SliceTensor(tensor, 3, 6), nvcv::Exception);
+}
+
+TEST(BatchScheduler, tensor_flip_matches_gold)
+{
+    int width = 57, height = 33, batches = 7, flipCode = -1;
+
+    nvcv::ImageFormat format{nvcv::FMT_RGBA8};
+
+    nvcv::Tensor inTensor  = test::CreateTensor(batches, width, height, format);
+    nvcv::Tensor outTensor = test::CreateTensor(batches, width, height, format);
+
+    const auto *input  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inTensor.exportData());
+    const auto *output = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outTensor.exportData());
+    ASSERT_NE(input, nullptr);
+    ASSERT_NE(output, nullptr);
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*input);
+    ASSERT_TRUE(inAccess);
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*output);
+    ASSERT_TRUE(outAccess);
+
+    long3 inStrides{inAccess->sampleStride(), inAccess->rowStride(), inAccess->colStride()};
+    long3 outStrides{outAccess->sampleStride(), outAccess->rowStride(), outAccess->colStride()};
+
+    std::vector<uint8_t> inVec(inStrides.x * batches);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+
+    std::vector<uint8_t> goldVec(outStrides.x * batches);
+    test::FlipCPU(goldVec, outStrides, inVec, inStrides, int3{width, height, batches}, format, flipCode);
+
+    cudaStream_t stream, laneStreams[3];
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+    for (cudaStream_t &s : laneStreams)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamCreate(&s));
+    }
+
+    ASSERT_EQ(cudaSuccess,
+              cudaMemcpyAsync(input->basePtr(), inVec.data(), inVec.size(), cudaMemcpyHostToDevice, stream));
+
+    {
+        cvcuda::BatchScheduler sched({{0, laneStreams[0]}, {0, laneStreams[1]}, {0, laneStreams[2]}});
+
+        std::vector<std::unique_ptr<cvcuda::Flip>> flipOps;
+        for (int i = 0; i < sched.numLanes(); ++i)
+        {
+            flipOps.emplace_back(std::make_unique<cvcuda::Flip>());
+        }
+
+        EXPECT_NO_THROW(sched(stream, inTensor, outTensor,
+                              [&](int lane, cudaStream_t laneStream, nvcv::ITensor &in, nvcv::ITensor &out)
+                              { (*flipOps[lane])(laneStream, in, out, flipCode); }));
+
+        // the output is ready once the caller's stream reaches this point
+        std::vector<uint8_t> testVec(goldVec.size());
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpyAsync(testVec.data(), output->basePtr(), testVec.size(), cudaMemcpyDeviceToHost, stream));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        EXPECT_EQ(testVec, goldVec);
+    }
+
+    for (cudaStream_t &s : laneStreams)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamDestroy(s));
+    }
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(BatchScheduler, varshape_flip_matches_gold)
+{
+    int batches = 5, flipCode = 1;
+
+    nvcv::ImageFormat format{nvcv::FMT_RGB8};
+
+    cudaStream_t stream, laneStreams[2];
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+    for (cudaStream_t &s : laneStreams)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamCreate(&s));
+    }
+
+    std::default_random_engine             rng(0);
+    std::uniform_int_distribution<int>     udistSize(20, 60);
+    std::uniform_int_distribution<uint8_t> udist(0, 255);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst;
+    std::vector<std::vector<uint8_t>>         srcVec(batches);
+
+    for (int i = 0; i < batches; ++i)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{udistSize(rng), udistSize(rng)}, format));
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(imgSrc[i]->size(), format));
+
+        int rowStride = imgSrc[i]->size().w * format.planePixelStrideBytes(0);
+        srcVec[i].resize(imgSrc[i]->size().h * rowStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return udist(rng); });
+
+        auto *imgData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(imgData, nullptr);
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2DAsync(imgData->plane(0).basePtr, imgData->plane(0).rowStride, srcVec[i].data(),
+                                    rowStride, rowStride, imgSrc[i]->size().h, cudaMemcpyHostToDevice, stream));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(batches), batchDst(batches);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+
+    nvcv::Tensor flipCodes({{batches}, "N"}, nvcv::TYPE_S32);
+    {
+        auto *dev = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(flipCodes.exportData());
+        ASSERT_NE(dev, nullptr);
+
+        std::vector<int> vec(batches, flipCode);
+        ASSERT_EQ(cudaSuccess, cudaMemcpyAsync(dev->basePtr(), vec.data(), vec.size() * sizeof(int),
+                                               cudaMemcpyHostToDevice, stream));
+    }
+
+    {
+        cvcuda::BatchScheduler sched({{0, laneStreams[0]}, {0, laneStreams[1]}});
+
+        std::vector<std::unique_ptr<cvcuda::Flip>>       flipOps;
+        std::vector<std::unique_ptr<nvcv::TensorSlice>> laneFlipCodes;
+        for (const cvcuda::BatchScheduler::Range &r : sched.split(batches))
+        {
+            flipOps.emplace_back(std::make_unique<cvcuda::Flip>(r.second - r.first));
+            laneFlipCodes.emplace_back(cvcuda::BatchScheduler::SliceTensor(flipCodes, r.first, r.second));
+        }
+
+        EXPECT_NO_THROW(sched(stream, batchSrc, batchDst,
+                              [&](int lane, cudaStream_t laneStream, nvcv::IImageBatchVarShape &in,
+                                  nvcv::IImageBatchVarShape &out)
+                              { (*flipOps[lane])(laneStream, in, out, *laneFlipCodes[lane]); }));
+
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    }
+
+    for (int i = 0; i < batches; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        const auto *dstData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[i]->exportData());
+        ASSERT_NE(dstData, nullptr);
+
+        int   rowStride = imgSrc[i]->size().w * format.planePixelStrideBytes(0);
+        int3  shape{imgSrc[i]->size().w, imgSrc[i]->size().h, 1};
+        long3 pitches{shape.y * rowStride, rowStride, format.planePixelStrideBytes(0)};
+
+        std::vector<uint8_t> testVec(shape.y * rowStride);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), rowStride, dstData->plane(0).basePtr,
+                                            dstData->plane(0).rowStride, rowStride, shape.y, cudaMemcpyDeviceToHost));
+
+        std::vector<uint8_t> goldVec(shape.y * rowStride);
+        test::FlipCPU(goldVec, pitches, srcVec[i], pitches, shape, format, flipCode);
+
+        EXPECT_EQ(testVec, goldVec);
+    }
+
+    for (cudaStream_t &s : laneStreams)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamDestroy(s));
+    }
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
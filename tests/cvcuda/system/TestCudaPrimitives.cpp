@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ConvUtils.hpp"
+#include "Definitions.hpp"
+#include "DeviceCudaPrimitives.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <cvcuda/OpResize.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace test = nvcv::test;
+
+static std::vector<uint8_t> Download(const nvcv::ITensorDataStridedCuda &data, size_t size)
+{
+    std::vector<uint8_t> vec(size);
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(vec.data(), data.basePtr(), size, cudaMemcpyDeviceToHost));
+    return vec;
+}
+
+TEST(CudaPrimitives, resize_matches_operator)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+
+    cvcuda::Resize resizeOp;
+
+    // downscale, upscale, and exact 2x downscale
+    for (nvcv::Size2D dstSize : {nvcv::Size2D{37, 23}, nvcv::Size2D{131, 97}, nvcv::Size2D{32, 24}})
+    {
+        nvcv::Tensor imgSrc = test::CreateTensor(3, 64, 48, nvcv::FMT_RGB8);
+        nvcv::Tensor imgDst = test::CreateTensor(3, dstSize.w, dstSize.h, nvcv::FMT_RGB8);
+        nvcv::Tensor imgRef = test::CreateTensor(3, dstSize.w, dstSize.h, nvcv::FMT_RGB8);
+
+        const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+        const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+        const auto *refData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgRef.exportData());
+        ASSERT_TRUE(srcData && dstData && refData);
+
+        std::vector<uint8_t> srcVec(srcData->stride(0) * srcData->shape(0));
+        std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), srcVec.size(), cudaMemcpyHostToDevice));
+
+        const size_t dstBytes = dstData->stride(0) * dstData->shape(0);
+
+        for (NVCVInterpolationType interpolation : {NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR, NVCV_INTERP_CUBIC})
+        {
+            EXPECT_NO_THROW(DeviceRunResizeRGB8(stream, *srcData, *dstData, interpolation));
+            EXPECT_NO_THROW(resizeOp(stream, imgSrc, imgRef, interpolation));
+            ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+            EXPECT_EQ(Download(*refData, dstBytes), Download(*dstData, dstBytes))
+                << "interpolation " << interpolation << " to " << dstSize.w << "x" << dstSize.h;
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(CudaPrimitives, resize_rejects_sources_smaller_than_interpolation)
+{
+    // linear interpolation reads 2x2 source pixels and cubic 4x4
+    nvcv::Tensor imgSrc1 = test::CreateTensor(1, 1, 8, nvcv::FMT_RGB8);
+    nvcv::Tensor imgSrc3 = test::CreateTensor(1, 8, 3, nvcv::FMT_RGB8);
+    nvcv::Tensor imgDst  = test::CreateTensor(1, 16, 16, nvcv::FMT_RGB8);
+
+    const auto *src1Data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc1.exportData());
+    const auto *src3Data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc3.exportData());
+    const auto *dstData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_TRUE(src1Data && src3Data && dstData);
+
+    EXPECT_NO_THROW(DeviceRunResizeRGB8(nullptr, *src1Data, *dstData, NVCV_INTERP_NEAREST));
+    EXPECT_THROW(DeviceRunResizeRGB8(nullptr, *src1Data, *dstData, NVCV_INTERP_LINEAR), nvcv::Exception);
+    EXPECT_NO_THROW(DeviceRunResizeRGB8(nullptr, *src3Data, *dstData, NVCV_INTERP_LINEAR));
+    EXPECT_THROW(DeviceRunResizeRGB8(nullptr, *src3Data, *dstData, NVCV_INTERP_CUBIC), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaDeviceSynchronize());
+}
+
+TEST(CudaPrimitives, filter2d_correct_output)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int3         shape{67, 41, 2};
+    nvcv::ImageFormat  format{NVCV_IMAGE_FORMAT_U8};
+    nvcv::Size2D       kernelSize{3, 3};
+    int2               kernelAnchor{1, 1};
+    std::vector<float> kernel{0.0625f, 0.125f, 0.0625f, 0.125f, 0.25f, 0.125f, 0.0625f, 0.125f, 0.0625f};
+
+    nvcv::Tensor inTensor  = test::CreateTensor(shape.z, shape.x, shape.y, format);
+    nvcv::Tensor outTensor = test::CreateTensor(shape.z, shape.x, shape.y, format);
+
+    const auto *inData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inTensor.exportData());
+    const auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outTensor.exportData());
+    ASSERT_TRUE(inData && outData);
+
+    auto inAccess  = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*outData);
+    ASSERT_TRUE(inAccess && outAccess);
+
+    long3 inStrides{inAccess->sampleStride(), inAccess->rowStride(), inAccess->colStride()};
+    long3 outStrides{outAccess->sampleStride(), outAccess->rowStride(), outAccess->colStride()};
+
+    std::vector<uint8_t> inVec(inStrides.x * shape.z);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), inVec.data(), inVec.size(), cudaMemcpyHostToDevice));
+
+    float *dKernel = nullptr;
+    ASSERT_EQ(cudaSuccess, cudaMalloc(&dKernel, kernel.size() * sizeof(float)));
+    ASSERT_EQ(cudaSuccess,
+              cudaMemcpy(dKernel, kernel.data(), kernel.size() * sizeof(float), cudaMemcpyHostToDevice));
+
+    EXPECT_NO_THROW(DeviceRunFilter3x3U8(stream, *inData, *outData, dKernel, kernelAnchor));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    std::vector<uint8_t> testVec = Download(*outData, outStrides.x * shape.z);
+    std::vector<uint8_t> goldVec(testVec.size());
+
+    test::Convolve(goldVec, outStrides, inVec, inStrides, shape, format, kernel, kernelSize, kernelAnchor,
+                   NVCV_BORDER_REFLECT101, float4{0, 0, 0, 0});
+
+    EXPECT_EQ(testVec, goldVec);
+
+    ASSERT_EQ(cudaSuccess, cudaFree(dKernel));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
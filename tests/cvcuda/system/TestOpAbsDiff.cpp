@@ -0,0 +1,171 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpAbsDiff.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+template<typename T>
+void CopyRows(nvcv::Tensor &tensor, std::vector<T> &host, cudaMemcpyKind kind)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(data, nullptr);
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    ASSERT_TRUE(access);
+
+    const int rowBytes = access->numCols() * access->numChannels() * sizeof(T);
+    const int rows     = access->numSamples() * access->numRows();
+    ASSERT_EQ(access->sampleStride(), access->numRows() * access->rowStride());
+
+    if (kind == cudaMemcpyHostToDevice)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(data->basePtr(), access->rowStride(), host.data(), rowBytes, rowBytes,
+                                            rows, kind));
+    }
+    else
+    {
+        host.resize(rows * rowBytes / sizeof(T));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(host.data(), rowBytes, data->basePtr(), access->rowStride(), rowBytes,
+                                            rows, kind));
+    }
+}
+
+template<typename T>
+void RunAbsDiff(int numSamples, int width, int height, int channels, nvcv::DataType dtype, bool inPlace)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::TensorShape shape({numSamples, height, width, channels}, nvcv::TENSOR_NHWC);
+    nvcv::Tensor      in1(shape, dtype), in2(shape, dtype), out(shape, dtype);
+
+    std::default_random_engine rng;
+
+    const size_t   numValues = static_cast<size_t>(numSamples) * height * width * channels;
+    std::vector<T> a(numValues), b(numValues);
+    for (std::vector<T> *v : {&a, &b})
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            std::uniform_real_distribution<T> dist(-100, 100);
+            std::generate(v->begin(), v->end(), [&]() { return dist(rng); });
+        }
+        else
+        {
+            std::uniform_int_distribution<int> dist(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+            std::generate(v->begin(), v->end(), [&]() { return static_cast<T>(dist(rng)); });
+        }
+    }
+
+    CopyRows(in1, a, cudaMemcpyHostToDevice);
+    CopyRows(in2, b, cudaMemcpyHostToDevice);
+
+    cvcuda::AbsDiff op;
+    EXPECT_NO_THROW(op(stream, in1, in2, inPlace ? in1 : out));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<T> test;
+    CopyRows(inPlace ? in1 : out, test, cudaMemcpyDeviceToHost);
+    ASSERT_EQ(test.size(), numValues);
+
+    for (size_t i = 0; i < numValues; ++i)
+    {
+        double d    = std::abs(static_cast<double>(a[i]) - static_cast<double>(b[i]));
+        T      gold = static_cast<T>(std::min(d, static_cast<double>(std::numeric_limits<T>::max())));
+        ASSERT_EQ(gold, test[i]) << "at value " << i;
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpAbsDiff, test::ValueList<int, int, int, int, nvcv::DataType, bool>
+{
+    // numSamples, width, height, channels,          dtype, inPlace
+    {           1,    64,     48,        1,  nvcv::TYPE_U8,   false },
+    {           3,    37,     21,        3,  nvcv::TYPE_U8,   false },
+    {           2,    33,     17,        4,  nvcv::TYPE_U8,    true },
+    {           2,    50,     20,        2, nvcv::TYPE_U16,   false },
+    {           2,    31,     15,        3, nvcv::TYPE_S16,   false },
+    {           4,    19,     13,        1, nvcv::TYPE_F32,    true },
+    {           1,    40,     10,        3, nvcv::TYPE_F32,   false }
+});
+
+// clang-format on
+
+TEST_P(OpAbsDiff, correct_output)
+{
+    int            numSamples = GetParamValue<0>();
+    int            width      = GetParamValue<1>();
+    int            height     = GetParamValue<2>();
+    int            channels   = GetParamValue<3>();
+    nvcv::DataType dtype      = GetParamValue<4>();
+    bool           inPlace    = GetParamValue<5>();
+
+    if (dtype == nvcv::TYPE_U8)
+    {
+        RunAbsDiff<uint8_t>(numSamples, width, height, channels, dtype, inPlace);
+    }
+    else if (dtype == nvcv::TYPE_U16)
+    {
+        RunAbsDiff<uint16_t>(numSamples, width, height, channels, dtype, inPlace);
+    }
+    else if (dtype == nvcv::TYPE_S16)
+    {
+        RunAbsDiff<int16_t>(numSamples, width, height, channels, dtype, inPlace);
+    }
+    else
+    {
+        RunAbsDiff<float>(numSamples, width, height, channels, dtype, inPlace);
+    }
+}
+
+TEST(OpAbsDiff, invalid_arguments)
+{
+    nvcv::Tensor src({{2, 8, 8, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor srcU16({{2, 8, 8, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U16);
+    nvcv::Tensor srcS32({{2, 8, 8, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor srcSmall({{2, 8, 7, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor srcPlanar({{2, 3, 8, 8}, nvcv::TENSOR_NCHW}, nvcv::TYPE_U8);
+    nvcv::Tensor dst({{2, 8, 8, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    cvcuda::AbsDiff op;
+    EXPECT_NO_THROW(op(nullptr, src, src, dst));
+    EXPECT_THROW(op(nullptr, src, srcU16, dst), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, srcS32, srcS32, srcS32), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, srcSmall, dst), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, srcPlanar, srcPlanar, srcPlanar), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
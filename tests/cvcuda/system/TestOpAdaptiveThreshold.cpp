@@ -0,0 +1,192 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpAdaptiveThreshold.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace test = nvcv::test;
+
+namespace {
+
+void CopyRows(const nvcv::Tensor &tensor, std::vector<uint8_t> &host, cudaMemcpyKind kind)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(data, nullptr);
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    ASSERT_TRUE(access);
+
+    const int rowBytes = access->numCols();
+    const int rows     = access->numSamples() * access->numRows();
+    ASSERT_EQ(access->sampleStride(), access->numRows() * access->rowStride());
+
+    if (kind == cudaMemcpyHostToDevice)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(data->basePtr(), access->rowStride(), host.data(), rowBytes, rowBytes,
+                                            rows, kind));
+    }
+    else
+    {
+        host.resize(rows * rowBytes);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(host.data(), rowBytes, data->basePtr(), access->rowStride(), rowBytes,
+                                            rows, kind));
+    }
+}
+
+// adaptiveThreshold of OpenCV with ADAPTIVE_THRESH_MEAN_C on one image, the windows being clipped to the image.
+std::vector<uint8_t> GoldAdaptiveThreshold(const uint8_t *in, int width, int height, double maxValue,
+                                           NVCVThresholdType type, int blockSize, double c)
+{
+    const int     radius = blockSize / 2;
+    const uint8_t maxv   = static_cast<uint8_t>(std::clamp(std::nearbyint(maxValue), 0.0, 255.0));
+    const int     delta  = static_cast<int>(type == NVCV_THRESH_BINARY ? std::ceil(c) : std::floor(c));
+
+    std::vector<uint8_t> out(width * height);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            const int x0 = std::max(x - radius, 0), x1 = std::min(x + radius + 1, width);
+            const int y0 = std::max(y - radius, 0), y1 = std::min(y + radius + 1, height);
+
+            int sum = 0;
+            for (int wy = y0; wy < y1; ++wy)
+            {
+                for (int wx = x0; wx < x1; ++wx)
+                {
+                    sum += in[wy * width + wx];
+                }
+            }
+
+            const int  mean  = static_cast<int>(std::nearbyint(static_cast<double>(sum) / ((x1 - x0) * (y1 - y0))));
+            const bool above = in[y * width + x] - mean > -delta;
+
+            out[y * width + x] = above != (type == NVCV_THRESH_BINARY_INV) ? maxv : 0;
+        }
+    }
+    return out;
+}
+
+std::vector<uint8_t> CreateImage(int numSamples, int width, int height)
+{
+    std::default_random_engine         rng(width * 31 + height);
+    std::uniform_int_distribution<int> noise(-20, 20);
+
+    // smooth gradient with noise, so that the local means matter
+    std::vector<uint8_t> image(numSamples * width * height);
+    for (int n = 0; n < numSamples; ++n)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                const int v = (x * 255 / width + y * 128 / height + n * 40) % 256 + noise(rng);
+
+                image[(n * height + y) * width + x] = static_cast<uint8_t>(std::clamp(v, 0, 255));
+            }
+        }
+    }
+    return image;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpAdaptiveThreshold, test::ValueList<int, int, int, double, NVCVThresholdType, int, double>
+{
+    // numSamples, width, height, maxValue,                   type, blockSize,    c
+    {            1,   128,     96,    255.0,     NVCV_THRESH_BINARY,         3,  2.0},
+    {            2,  1100,     70,    200.4, NVCV_THRESH_BINARY_INV,        11, -3.5},
+    {            3,    45,    133,    300.0,     NVCV_THRESH_BINARY,        25,  4.2},
+    {            1,     7,      5,      1.0, NVCV_THRESH_BINARY_INV,        51,  0.0}
+});
+
+// clang-format on
+
+TEST_P(OpAdaptiveThreshold, correct_output)
+{
+    int               numSamples = GetParamValue<0>();
+    int               width      = GetParamValue<1>();
+    int               height     = GetParamValue<2>();
+    double            maxValue   = GetParamValue<3>();
+    NVCVThresholdType type       = GetParamValue<4>();
+    int               blockSize  = GetParamValue<5>();
+    double            c          = GetParamValue<6>();
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::TensorShape shape({numSamples, height, width, 1}, nvcv::TENSOR_NHWC);
+    nvcv::Tensor      in(shape, nvcv::TYPE_U8), out(shape, nvcv::TYPE_U8);
+
+    std::vector<uint8_t> image = CreateImage(numSamples, width, height);
+    CopyRows(in, image, cudaMemcpyHostToDevice);
+
+    cvcuda::AdaptiveThreshold op(numSamples, width, height);
+    EXPECT_NO_THROW(op(stream, in, out, maxValue, type, blockSize, c));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<uint8_t> test;
+    CopyRows(out, test, cudaMemcpyDeviceToHost);
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        const int            imageSize = width * height;
+        std::vector<uint8_t> gold
+            = GoldAdaptiveThreshold(image.data() + n * imageSize, width, height, maxValue, type, blockSize, c);
+
+        EXPECT_TRUE(std::equal(gold.begin(), gold.end(), test.begin() + n * imageSize)) << "sample " << n;
+    }
+}
+
+TEST(OpAdaptiveThreshold, invalid_arguments)
+{
+    nvcv::TensorShape shape({2, 16, 24, 1}, nvcv::TENSOR_NHWC);
+
+    nvcv::Tensor in(shape, nvcv::TYPE_U8), out(shape, nvcv::TYPE_U8);
+    nvcv::Tensor inF32(shape, nvcv::TYPE_F32), outS16(shape, nvcv::TYPE_S16);
+    nvcv::Tensor outSmall({{2, 16, 23, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor in3({{2, 16, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor out3({{2, 16, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor inLarge({{2, 17, 24, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor outLarge({{2, 17, 24, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    EXPECT_THROW(cvcuda::AdaptiveThreshold(2, -1, 16), nvcv::Exception);
+
+    cvcuda::AdaptiveThreshold op(2, 24, 16);
+    EXPECT_NO_THROW(op(nullptr, in, out, 255, NVCV_THRESH_BINARY, 5, 1));
+    EXPECT_THROW(op(nullptr, in, out, 255, NVCV_THRESH_BINARY, 4, 1), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out, 255, NVCV_THRESH_BINARY, 1, 1), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out, 255, static_cast<NVCVThresholdType>(2), 5, 1), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, inF32, out, 255, NVCV_THRESH_BINARY, 5, 1), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, outS16, 255, NVCV_THRESH_BINARY, 5, 1), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, outSmall, 255, NVCV_THRESH_BINARY, 5, 1), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in3, out3, 255, NVCV_THRESH_BINARY, 5, 1), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, inLarge, outLarge, 255, NVCV_THRESH_BINARY, 5, 1), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
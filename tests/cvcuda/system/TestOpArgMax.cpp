@@ -0,0 +1,206 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpArgMax.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+// Scores of one sample, class-major like an NCHW tensor
+struct HostScores
+{
+    int                numClasses, width, height;
+    std::vector<float> data;
+
+    float at(int c, int x, int y) const
+    {
+        return data[(c * height + y) * width + x];
+    }
+};
+
+// Score of class c at destination pixel (x, y), sampled like the operator does
+float Sample(const HostScores &s, int c, int x, int y, float scaleX, float scaleY, bool linear)
+{
+    if (!linear)
+    {
+        int sx = std::min(static_cast<int>(x * scaleX), s.width - 1);
+        int sy = std::min(static_cast<int>(y * scaleY), s.height - 1);
+        return s.at(c, sx, sy);
+    }
+
+    float fx = std::max((x + 0.5f) * scaleX - 0.5f, 0.f);
+    float fy = std::max((y + 0.5f) * scaleY - 0.5f, 0.f);
+    int   x0 = std::min(static_cast<int>(fx), s.width - 1);
+    int   y0 = std::min(static_cast<int>(fy), s.height - 1);
+    int   x1 = std::min(x0 + 1, s.width - 1);
+    int   y1 = std::min(y0 + 1, s.height - 1);
+    float ax = fx - x0;
+    float ay = fy - y0;
+
+    float v0 = s.at(c, x0, y0) * (1 - ax) + s.at(c, x1, y0) * ax;
+    float v1 = s.at(c, x0, y1) * (1 - ax) + s.at(c, x1, y1) * ax;
+    return v0 * (1 - ay) + v1 * ay;
+}
+
+template<typename LabelT>
+void RunArgMax(int numImages, int numClasses, int srcWidth, int srcHeight, int dstWidth, int dstHeight,
+               NVCVInterpolationType interp)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::DataType labelType = std::is_same_v<LabelT, uint8_t> ? nvcv::TYPE_U8 : nvcv::TYPE_S32;
+
+    nvcv::Tensor imgSrc({{numImages, numClasses, srcHeight, srcWidth}, nvcv::TENSOR_NCHW}, nvcv::TYPE_F32);
+    nvcv::Tensor imgDst({{numImages, dstHeight, dstWidth, 1}, nvcv::TENSOR_NHWC}, labelType);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, srcData);
+    ASSERT_NE(nullptr, dstData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(srcAccess && dstAccess);
+
+    std::default_random_engine            rng;
+    std::uniform_real_distribution<float> udist(-10.f, 10.f);
+
+    std::vector<HostScores> srcs;
+    const int               srcRowBytes = srcWidth * sizeof(float);
+    for (int n = 0; n < numImages; ++n)
+    {
+        srcs.push_back({numClasses, srcWidth, srcHeight, std::vector<float>(numClasses * srcWidth * srcHeight)});
+        std::generate(srcs[n].data.begin(), srcs[n].data.end(), [&]() { return udist(rng); });
+
+        for (int c = 0; c < numClasses; ++c)
+        {
+            ASSERT_EQ(cudaSuccess,
+                      cudaMemcpy2D(srcAccess->sampleData(n, srcAccess->planeData(c)), srcAccess->rowStride(),
+                                   srcs[n].data.data() + c * srcWidth * srcHeight, srcRowBytes, srcRowBytes,
+                                   srcHeight, cudaMemcpyHostToDevice));
+        }
+    }
+
+    cvcuda::ArgMax argmaxOp;
+    EXPECT_NO_THROW(argmaxOp(stream, imgSrc, imgDst, interp));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const float scaleX = static_cast<float>(srcWidth) / dstWidth;
+    const float scaleY = static_cast<float>(srcHeight) / dstHeight;
+    const bool  linear = interp == NVCV_INTERP_LINEAR && (srcWidth != dstWidth || srcHeight != dstHeight);
+
+    const int dstRowBytes = dstWidth * sizeof(LabelT);
+    for (int n = 0; n < numImages; ++n)
+    {
+        std::vector<LabelT> test(dstWidth * dstHeight);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(test.data(), dstRowBytes, dstAccess->sampleData(n), dstAccess->rowStride(),
+                                            dstRowBytes, dstHeight, cudaMemcpyDeviceToHost));
+
+        for (int y = 0; y < dstHeight; ++y)
+        {
+            for (int x = 0; x < dstWidth; ++x)
+            {
+                float best = -INFINITY;
+                for (int c = 0; c < numClasses; ++c)
+                {
+                    best = std::max(best, Sample(srcs[n], c, x, y, scaleX, scaleY, linear));
+                }
+
+                // Interpolated scores may differ in the last bits, a label scoring as high as the best is correct
+                int label = test[y * dstWidth + x];
+                ASSERT_LT(label, numClasses) << "at sample " << n << " pixel " << x << "," << y;
+                EXPECT_NEAR(best, Sample(srcs[n], label, x, y, scaleX, scaleY, linear), 1e-4f)
+                    << "at sample " << n << " pixel " << x << "," << y;
+            }
+        }
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpArgMax, test::ValueList<int, int, int, int, int, int, NVCVInterpolationType>
+{
+    // numImages, numClasses, srcWidth, srcHeight, dstWidth, dstHeight,              interp
+    {           1,          3,       32,        24,       32,        24, NVCV_INTERP_NEAREST },
+    {           2,         21,       40,        30,      160,       120, NVCV_INTERP_NEAREST },
+    {           2,         21,       40,        30,      160,       120,  NVCV_INTERP_LINEAR },
+    {           3,          5,       17,        13,       63,        29,  NVCV_INTERP_LINEAR },
+    {           1,          2,       64,        64,       32,        32,  NVCV_INTERP_LINEAR },
+    {           1,          1,        8,         8,       16,        16, NVCV_INTERP_NEAREST }
+});
+
+// clang-format on
+
+TEST_P(OpArgMax, u8_labels_correct_output)
+{
+    RunArgMax<uint8_t>(GetParamValue<0>(), GetParamValue<1>(), GetParamValue<2>(), GetParamValue<3>(),
+                       GetParamValue<4>(), GetParamValue<5>(), GetParamValue<6>());
+}
+
+TEST_P(OpArgMax, s32_labels_correct_output)
+{
+    RunArgMax<int32_t>(GetParamValue<0>(), GetParamValue<1>(), GetParamValue<2>(), GetParamValue<3>(),
+                       GetParamValue<4>(), GetParamValue<5>(), GetParamValue<6>());
+}
+
+TEST(OpArgMax, many_classes_need_s32_labels)
+{
+    RunArgMax<int32_t>(1, 300, 8, 6, 16, 12, NVCV_INTERP_LINEAR);
+
+    nvcv::Tensor scores({{1, 300, 6, 8}, nvcv::TENSOR_NCHW}, nvcv::TYPE_F32);
+    nvcv::Tensor labels({{1, 6, 8, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    cvcuda::ArgMax argmaxOp;
+    EXPECT_THROW(argmaxOp(nullptr, scores, labels), nvcv::Exception);
+}
+
+TEST(OpArgMax, invalid_arguments)
+{
+    nvcv::Tensor scores({{2, 4, 6, 8}, nvcv::TENSOR_NCHW}, nvcv::TYPE_F32);
+    nvcv::Tensor scoresU8({{2, 4, 6, 8}, nvcv::TENSOR_NCHW}, nvcv::TYPE_U8);
+    nvcv::Tensor scoresNHWC({{2, 6, 8, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor labels({{2, 12, 16, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor labelsF32({{2, 12, 16, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor labels2C({{2, 12, 16, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor labels1N({{1, 12, 16, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    cvcuda::ArgMax argmaxOp;
+    EXPECT_NO_THROW(argmaxOp(nullptr, scores, labels, NVCV_INTERP_LINEAR));
+    EXPECT_THROW(argmaxOp(nullptr, scores, labels, NVCV_INTERP_CUBIC), nvcv::Exception);
+    EXPECT_THROW(argmaxOp(nullptr, scoresU8, labels), nvcv::Exception);
+    EXPECT_THROW(argmaxOp(nullptr, scoresNHWC, labels), nvcv::Exception);
+    EXPECT_THROW(argmaxOp(nullptr, scores, labelsF32), nvcv::Exception);
+    EXPECT_THROW(argmaxOp(nullptr, scores, labels2C), nvcv::Exception);
+    EXPECT_THROW(argmaxOp(nullptr, scores, labels1N), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -166,6 +166,9 @@ NVCV_TEST_SUITE_P(OpBilateralFilter, test::ValueList<int, int, int, float, float
     {    48,     32, 4, 5,          3,          9},
     {    64,     32, 4, 5,          3,          9},
     {    32,    128, 4, 5,          3,          9},
+
+    //width, height, d, SigmaColor, sigmaSpace, numberImages
+    {    75,     50, 19, 30,        6,          2},
 });
 
 // clang-format on
@@ -0,0 +1,382 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpBlurRegions.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+namespace test = nvcv::test;
+
+namespace {
+
+constexpr int kNumBoxes = 7;
+
+constexpr NVCVBlurRegionType kGaussian = NVCV_BLUR_REGION_GAUSSIAN;
+constexpr NVCVBlurRegionType kPixelate = NVCV_BLUR_REGION_PIXELATE;
+
+// Index of coordinate c after applying the border, -1 for constant borders outside of the image.
+int GoldBorderIndex(int c, int s, NVCVBorderType border)
+{
+    while (c < 0 || c >= s)
+    {
+        switch (border)
+        {
+        case NVCV_BORDER_REPLICATE:
+            return std::clamp(c, 0, s - 1);
+        case NVCV_BORDER_WRAP:
+            return ((c % s) + s) % s;
+        case NVCV_BORDER_REFLECT:
+            c = c < 0 ? -c - 1 : 2 * s - 1 - c;
+            break;
+        case NVCV_BORDER_REFLECT101:
+            if (s == 1)
+            {
+                return 0;
+            }
+            c = c < 0 ? -c : 2 * s - 2 - c;
+            break;
+        default:
+            return -1;
+        }
+    }
+    return c;
+}
+
+std::vector<double> GoldGaussianWeights(int kernelSize, double sigma)
+{
+    if (sigma <= 0)
+    {
+        sigma = 0.3 * ((kernelSize - 1) * 0.5 - 1) + 0.8;
+    }
+
+    const int           radius = kernelSize / 2;
+    std::vector<double> weights(kernelSize);
+    double              sum = 0;
+    for (int k = -radius; k <= radius; ++k)
+    {
+        weights[k + radius] = std::exp(-(k * k) / (2 * sigma * sigma));
+        sum += weights[k + radius];
+    }
+    for (double &w : weights)
+    {
+        w /= sum;
+    }
+    return weights;
+}
+
+// Blurred or pixelated value of every pixel of an interleaved image, as if the whole image was a box.
+std::vector<double> GoldBlur(const std::vector<double> &image, int width, int height, int channels,
+                             NVCVBlurRegionType type, int kernelSize, double sigma, NVCVBorderType border)
+{
+    std::vector<double> out(image.size(), 0.0);
+
+    if (type == NVCV_BLUR_REGION_PIXELATE)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                const int x0 = x / kernelSize * kernelSize, x1 = std::min(x0 + kernelSize, width);
+                const int y0 = y / kernelSize * kernelSize, y1 = std::min(y0 + kernelSize, height);
+                for (int c = 0; c < channels; ++c)
+                {
+                    double sum = 0;
+                    for (int v = y0; v < y1; ++v)
+                    {
+                        for (int u = x0; u < x1; ++u)
+                        {
+                            sum += image[(v * width + u) * channels + c];
+                        }
+                    }
+                    out[(y * width + x) * channels + c] = sum / ((x1 - x0) * (y1 - y0));
+                }
+            }
+        }
+        return out;
+    }
+
+    const std::vector<double> weights = GoldGaussianWeights(kernelSize, sigma);
+    const int                 radius  = kernelSize / 2;
+
+    std::vector<double> rows(image.size(), 0.0);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            for (int k = -radius; k <= radius; ++k)
+            {
+                const int u = GoldBorderIndex(x + k, width, border);
+                for (int c = 0; u >= 0 && c < channels; ++c)
+                {
+                    rows[(y * width + x) * channels + c] += weights[k + radius] * image[(y * width + u) * channels + c];
+                }
+            }
+        }
+    }
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            for (int k = -radius; k <= radius; ++k)
+            {
+                const int v = GoldBorderIndex(y + k, height, border);
+                for (int c = 0; v >= 0 && c < channels; ++c)
+                {
+                    out[(y * width + x) * channels + c] += weights[k + radius] * rows[(v * width + x) * channels + c];
+                }
+            }
+        }
+    }
+    return out;
+}
+
+// Boxes partially outside of the image, overlapping, fractional and empty.
+std::vector<float> CreateBoxes(int numSamples, int width, int height)
+{
+    std::default_random_engine            rng(numSamples);
+    std::uniform_real_distribution<float> xDist(-0.2f * width, 0.9f * width);
+    std::uniform_real_distribution<float> yDist(-0.2f * height, 0.9f * height);
+    std::uniform_real_distribution<float> sizeDist(0.1f, 0.5f);
+
+    std::vector<float> boxes(numSamples * kNumBoxes * 4);
+    for (int i = 0; i < numSamples * kNumBoxes; ++i)
+    {
+        float *box = &boxes[i * 4];
+        box[0]     = xDist(rng);
+        box[1]     = yDist(rng);
+        box[2]     = box[0] + sizeDist(rng) * width;
+        box[3]     = box[1] + sizeDist(rng) * height;
+
+        if (i % kNumBoxes == kNumBoxes - 1)
+        {
+            std::swap(box[0], box[2]);
+        }
+    }
+    return boxes;
+}
+
+void CopyRows(void *dst, int dstStride, const void *src, int srcStride, int rowBytes, int rows, cudaMemcpyKind kind)
+{
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(dst, dstStride, src, srcStride, rowBytes, rows, kind));
+}
+
+template<typename T>
+void RunBlurRegions(nvcv::DataType dtype, int numSamples, int width, int height, int channels,
+                    NVCVBlurRegionType type, int kernelSize, double sigma, NVCVBorderType border, bool withCounts)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor images({{numSamples, height, width, channels}, nvcv::TENSOR_NHWC}, dtype);
+    nvcv::Tensor boxes({{numSamples, 1, kNumBoxes, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor counts({{numSamples, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    const auto *imageData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(images.exportData());
+    const auto *boxData   = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(boxes.exportData());
+    const auto *countData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(counts.exportData());
+    ASSERT_TRUE(imageData && boxData && countData);
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*imageData);
+    ASSERT_TRUE(access);
+    ASSERT_EQ(access->sampleStride(), access->numRows() * access->rowStride());
+
+    std::default_random_engine             rng(width * height);
+    std::uniform_real_distribution<double> valueDist(
+        std::is_same_v<T, int16_t> ? -1000.0 : 0.0,
+        std::is_floating_point_v<T> ? 1.0 : std::min(1000.0, (double)std::numeric_limits<T>::max()));
+
+    const int      rowBytes = width * channels * sizeof(T);
+    std::vector<T> src(numSamples * height * width * channels);
+    std::generate(src.begin(), src.end(), [&]() { return static_cast<T>(valueDist(rng)); });
+
+    std::vector<float> srcBoxes = CreateBoxes(numSamples, width, height);
+    std::vector<int>   srcCounts(numSamples);
+    for (int n = 0; n < numSamples; ++n)
+    {
+        srcCounts[n] = withCounts ? kNumBoxes - n % 3 : kNumBoxes;
+    }
+
+    CopyRows(imageData->basePtr(), access->rowStride(), src.data(), rowBytes, rowBytes, numSamples * height,
+             cudaMemcpyHostToDevice);
+    CopyRows(boxData->basePtr(), boxData->stride(0), srcBoxes.data(), kNumBoxes * 4 * sizeof(float),
+             kNumBoxes * 4 * sizeof(float), numSamples, cudaMemcpyHostToDevice);
+    CopyRows(countData->basePtr(), countData->stride(0), srcCounts.data(), sizeof(int), sizeof(int), numSamples,
+             cudaMemcpyHostToDevice);
+
+    cvcuda::BlurRegions op(numSamples, width, height);
+    if (withCounts)
+    {
+        EXPECT_NO_THROW(op(stream, images, boxes, counts, type, kernelSize, sigma, border));
+    }
+    else
+    {
+        EXPECT_NO_THROW(op(stream, images, boxes, type, kernelSize, sigma, border));
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<T> test(src.size());
+    CopyRows(test.data(), rowBytes, imageData->basePtr(), access->rowStride(), rowBytes, numSamples * height,
+             cudaMemcpyDeviceToHost);
+
+    const int    imageSize = width * height * channels;
+    const double tolerance = std::is_integral_v<T> ? 1.0 : 1e-4;
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        std::vector<double> image(src.begin() + n * imageSize, src.begin() + (n + 1) * imageSize);
+        std::vector<double> blurred = GoldBlur(image, width, height, channels, type, kernelSize, sigma, border);
+
+        std::vector<bool> inside(width * height, false);
+        for (int i = 0; i < srcCounts[n]; ++i)
+        {
+            const float *box = &srcBoxes[(n * kNumBoxes + i) * 4];
+            if (!(box[2] > box[0] && box[3] > box[1]))
+            {
+                continue;
+            }
+            const int x0 = std::clamp((int)std::floor(box[0]), 0, width);
+            const int y0 = std::clamp((int)std::floor(box[1]), 0, height);
+            const int x1 = std::clamp((int)std::ceil(box[2]), 0, width);
+            const int y1 = std::clamp((int)std::ceil(box[3]), 0, height);
+            for (int y = y0; y < y1; ++y)
+            {
+                std::fill(inside.begin() + y * width + x0, inside.begin() + y * width + std::max(x0, x1), true);
+            }
+        }
+
+        for (int i = 0; i < imageSize; ++i)
+        {
+            const T value = test[n * imageSize + i];
+            if (inside[i / channels])
+            {
+                ASSERT_NEAR(value, blurred[i], tolerance)
+                    << "sample " << n << " pixel (" << i / channels % width << ", " << i / channels / width << ")";
+            }
+            else
+            {
+                ASSERT_EQ(value, src[n * imageSize + i]) << "sample " << n << " pixel (" << i / channels % width
+                                                         << ", " << i / channels / width << ") outside the boxes";
+            }
+        }
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpBlurRegions, test::ValueList<nvcv::DataType, int, int, int, int, NVCVBlurRegionType, int, double,
+                                                 NVCVBorderType, bool>
+{
+    //          dtype, numSamples, width, height, channels,      type, ksize, sigma,                 border, counts
+    { nvcv::TYPE_U8,            2,    97,     61,        3, kGaussian,     9,   0.0, NVCV_BORDER_REFLECT101,   true},
+    { nvcv::TYPE_U8,            1,    40,     24,        1, kGaussian,    31,   6.0,  NVCV_BORDER_REPLICATE,  false},
+    {nvcv::TYPE_F32,            3,    50,     40,        4, kGaussian,     7,   2.0,       NVCV_BORDER_WRAP,   true},
+    {nvcv::TYPE_U16,            2,    80,     30,        1, kGaussian,     5,   0.0,   NVCV_BORDER_CONSTANT,  false},
+    {nvcv::TYPE_S16,            2,    45,     45,        3, kGaussian,    11,   3.0,    NVCV_BORDER_REFLECT,   true},
+    { nvcv::TYPE_U8,            2,    97,     61,        3, kPixelate,     8,   0.0, NVCV_BORDER_REFLECT101,   true},
+    {nvcv::TYPE_F32,            1,    33,     21,        1, kPixelate,     5,   0.0, NVCV_BORDER_REFLECT101,  false},
+    { nvcv::TYPE_U8,            3,   128,     64,        4, kPixelate,    16,   0.0, NVCV_BORDER_REFLECT101,   true}
+});
+
+// clang-format on
+
+TEST_P(OpBlurRegions, correct_output)
+{
+    nvcv::DataType     dtype      = GetParamValue<0>();
+    int                numSamples = GetParamValue<1>();
+    int                width      = GetParamValue<2>();
+    int                height     = GetParamValue<3>();
+    int                channels   = GetParamValue<4>();
+    NVCVBlurRegionType type       = GetParamValue<5>();
+    int                kernelSize = GetParamValue<6>();
+    double             sigma      = GetParamValue<7>();
+    NVCVBorderType     border     = GetParamValue<8>();
+    bool               withCounts = GetParamValue<9>();
+
+    if (dtype == nvcv::TYPE_U8)
+    {
+        RunBlurRegions<uint8_t>(dtype, numSamples, width, height, channels, type, kernelSize, sigma, border,
+                                withCounts);
+    }
+    else if (dtype == nvcv::TYPE_U16)
+    {
+        RunBlurRegions<uint16_t>(dtype, numSamples, width, height, channels, type, kernelSize, sigma, border,
+                                 withCounts);
+    }
+    else if (dtype == nvcv::TYPE_S16)
+    {
+        RunBlurRegions<int16_t>(dtype, numSamples, width, height, channels, type, kernelSize, sigma, border,
+                                withCounts);
+    }
+    else
+    {
+        RunBlurRegions<float>(dtype, numSamples, width, height, channels, type, kernelSize, sigma, border,
+                              withCounts);
+    }
+}
+
+TEST(OpBlurRegions, invalid_arguments)
+{
+    nvcv::Tensor images({{2, 16, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor imagesF64({{2, 16, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F64);
+    nvcv::Tensor imagesLarge({{2, 17, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor boxes({{2, 1, 5, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor boxesC3({{2, 1, 5, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor boxes3N({{3, 1, 5, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor boxesS32({{2, 1, 5, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor counts({{2, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor countsW2({{2, 1, 2, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    EXPECT_THROW(cvcuda::BlurRegions(-1, 24, 16), nvcv::Exception);
+
+    cvcuda::BlurRegions op(2, 24, 16);
+
+    // no box is counted, so valid calls leave the images untouched
+    const auto *countData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(counts.exportData());
+    ASSERT_NE(nullptr, countData);
+    std::vector<int> zeros(2, 0);
+    CopyRows(countData->basePtr(), countData->stride(0), zeros.data(), sizeof(int), sizeof(int), 2,
+             cudaMemcpyHostToDevice);
+    EXPECT_NO_THROW(op(nullptr, images, boxes, counts, NVCV_BLUR_REGION_GAUSSIAN, 5));
+    EXPECT_NO_THROW(op(nullptr, images, boxes, counts, NVCV_BLUR_REGION_PIXELATE, 4));
+    EXPECT_THROW(op(nullptr, images, boxes, NVCV_BLUR_REGION_GAUSSIAN, 4), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, boxes, NVCV_BLUR_REGION_GAUSSIAN, 257), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, boxes, NVCV_BLUR_REGION_PIXELATE, 0), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, boxes, static_cast<NVCVBlurRegionType>(2), 5), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, boxes, NVCV_BLUR_REGION_GAUSSIAN, 5, 0, static_cast<NVCVBorderType>(5)),
+                 nvcv::Exception);
+    EXPECT_THROW(op(nullptr, imagesF64, boxes, NVCV_BLUR_REGION_GAUSSIAN, 5), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, imagesLarge, boxes, NVCV_BLUR_REGION_GAUSSIAN, 5), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, boxesC3, NVCV_BLUR_REGION_GAUSSIAN, 5), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, boxes3N, NVCV_BLUR_REGION_GAUSSIAN, 5), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, boxesS32, NVCV_BLUR_REGION_GAUSSIAN, 5), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, boxes, countsW2, NVCV_BLUR_REGION_GAUSSIAN, 5), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -0,0 +1,165 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpBoxDecode.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+// Boxes are [x1, y1, x2, y2] and deltas [dx, dy, dw, dh]
+void GoldBoxDecode(const float *anchor, const float *delta, float *box, float varianceXY, float varianceWH)
+{
+    const float maxSizeDelta = std::log(1000.f / 16);
+
+    const float aw  = anchor[2] - anchor[0];
+    const float ah  = anchor[3] - anchor[1];
+    const float acx = anchor[0] + 0.5f * aw;
+    const float acy = anchor[1] + 0.5f * ah;
+
+    const float cx = acx + delta[0] * varianceXY * aw;
+    const float cy = acy + delta[1] * varianceXY * ah;
+    const float w  = aw * std::exp(std::min(delta[2] * varianceWH, maxSizeDelta));
+    const float h  = ah * std::exp(std::min(delta[3] * varianceWH, maxSizeDelta));
+
+    box[0] = cx - 0.5f * w;
+    box[1] = cy - 0.5f * h;
+    box[2] = cx + 0.5f * w;
+    box[3] = cy + 0.5f * h;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpBoxDecode, test::ValueList<int, int, bool, float, float>
+{
+    // numSamples, numAnchors, sharedAnchors, varianceXY, varianceWH
+    {            1,         10,         false,        1.f,        1.f },
+    {            4,       8732,          true,       0.1f,       0.2f },
+    {            3,       1000,         false,       0.1f,       0.2f },
+    {            2,        257,          true,        1.f,        5.f }
+});
+
+// clang-format on
+
+TEST_P(OpBoxDecode, correct_output)
+{
+    const int   numSamples    = GetParamValue<0>();
+    const int   numAnchors    = GetParamValue<1>();
+    const bool  sharedAnchors = GetParamValue<2>();
+    const float varianceXY    = GetParamValue<3>();
+    const float varianceWH    = GetParamValue<4>();
+
+    const int numAnchorSamples = sharedAnchors ? 1 : numSamples;
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor anchors({{numAnchorSamples, 1, numAnchors, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor deltas({{numSamples, 1, numAnchors, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor boxes({{numSamples, 1, numAnchors, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+
+    const auto *anchorData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(anchors.exportData());
+    const auto *deltaData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(deltas.exportData());
+    const auto *boxData    = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(boxes.exportData());
+    ASSERT_TRUE(anchorData && deltaData && boxData);
+
+    std::default_random_engine            rng;
+    std::uniform_real_distribution<float> posDist(0.f, 300.f);
+    std::uniform_real_distribution<float> sizeDist(1.f, 100.f);
+    std::uniform_real_distribution<float> deltaDist(-3.f, 3.f);
+
+    std::vector<float> srcAnchors(numAnchorSamples * numAnchors * 4);
+    for (size_t i = 0; i < srcAnchors.size(); i += 4)
+    {
+        srcAnchors[i]     = posDist(rng);
+        srcAnchors[i + 1] = posDist(rng);
+        srcAnchors[i + 2] = srcAnchors[i] + sizeDist(rng);
+        srcAnchors[i + 3] = srcAnchors[i + 1] + sizeDist(rng);
+    }
+
+    // Size deltas go past the clamp with large variances
+    std::vector<float> srcDeltas(numSamples * numAnchors * 4);
+    std::generate(srcDeltas.begin(), srcDeltas.end(), [&]() { return deltaDist(rng); });
+
+    const int rowBytes = numAnchors * 4 * sizeof(float);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(anchorData->basePtr(), anchorData->stride(0), srcAnchors.data(), rowBytes,
+                                        rowBytes, numAnchorSamples, cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(deltaData->basePtr(), deltaData->stride(0), srcDeltas.data(), rowBytes,
+                                        rowBytes, numSamples, cudaMemcpyHostToDevice));
+
+    cvcuda::BoxDecode boxDecodeOp;
+    EXPECT_NO_THROW(boxDecodeOp(stream, anchors, deltas, boxes, varianceXY, varianceWH));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<float> testBoxes(numSamples * numAnchors * 4);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testBoxes.data(), rowBytes, boxData->basePtr(), boxData->stride(0), rowBytes,
+                                        numSamples, cudaMemcpyDeviceToHost));
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        for (int i = 0; i < numAnchors; ++i)
+        {
+            const float *anchor = &srcAnchors[((sharedAnchors ? 0 : n) * numAnchors + i) * 4];
+            const float *delta  = &srcDeltas[(n * numAnchors + i) * 4];
+            const float *test   = &testBoxes[(n * numAnchors + i) * 4];
+
+            float gold[4];
+            GoldBoxDecode(anchor, delta, gold, varianceXY, varianceWH);
+
+            for (int c = 0; c < 4; ++c)
+            {
+                EXPECT_NEAR(gold[c], test[c], 1e-4f * std::max(1.f, std::abs(gold[c])))
+                    << "at sample " << n << " anchor " << i << " coordinate " << c;
+            }
+        }
+    }
+}
+
+TEST(OpBoxDecode, invalid_arguments)
+{
+    nvcv::Tensor anchors({{1, 1, 10, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor anchors3N({{3, 1, 10, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor anchorsW9({{1, 1, 9, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor deltas({{2, 1, 10, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor deltasC3({{2, 1, 10, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor deltasU8({{2, 1, 10, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor boxes({{2, 1, 10, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor boxesRows({{2, 2, 10, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+
+    cvcuda::BoxDecode boxDecodeOp;
+    EXPECT_NO_THROW(boxDecodeOp(nullptr, anchors, deltas, boxes));
+    EXPECT_THROW(boxDecodeOp(nullptr, anchors3N, deltas, boxes), nvcv::Exception);
+    EXPECT_THROW(boxDecodeOp(nullptr, anchorsW9, deltas, boxes), nvcv::Exception);
+    EXPECT_THROW(boxDecodeOp(nullptr, anchors, deltasC3, boxes), nvcv::Exception);
+    EXPECT_THROW(boxDecodeOp(nullptr, anchors, deltasU8, boxes), nvcv::Exception);
+    EXPECT_THROW(boxDecodeOp(nullptr, anchors, deltas, boxesRows), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -0,0 +1,382 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpBuildPyramid.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+// Interleaved image with packed rows
+template<typename T>
+struct HostImage
+{
+    int            width, height, channels;
+    std::vector<T> data;
+
+    T at(int x, int y, int c) const
+    {
+        return data[(y * width + x) * channels + c];
+    }
+};
+
+int Reflect101(int x, int size)
+{
+    if (size == 1)
+    {
+        return 0;
+    }
+    const int period = 2 * size - 2;
+    x                = std::abs(x) % period;
+    return x < size ? x : period - x;
+}
+
+// OpenCV's pyrDown: 5x5 Gaussian with a reflect-101 border, then every other pixel, integers rounded half up
+template<typename T>
+HostImage<T> PyrDown(const HostImage<T> &src)
+{
+    using W = std::conditional_t<std::is_integral_v<T>, int, float>;
+
+    HostImage<T> dst{(src.width + 1) / 2, (src.height + 1) / 2, src.channels, {}};
+    dst.data.resize(dst.width * dst.height * dst.channels);
+
+    for (int y = 0; y < dst.height; ++y)
+    {
+        for (int x = 0; x < dst.width; ++x)
+        {
+            for (int c = 0; c < src.channels; ++c)
+            {
+                auto row = [&](int sy)
+                {
+                    auto p = [&](int sx)
+                    {
+                        return static_cast<W>(
+                            src.at(Reflect101(sx, src.width), Reflect101(sy, src.height), c));
+                    };
+                    return p(2 * x) * 6 + (p(2 * x - 1) + p(2 * x + 1)) * 4 + p(2 * x - 2) + p(2 * x + 2);
+                };
+                const int cy  = 2 * y;
+                const W   sum = row(cy) * 6 + (row(cy - 1) + row(cy + 1)) * 4 + row(cy - 2) + row(cy + 2);
+
+                if constexpr (std::is_integral_v<T>)
+                {
+                    dst.data[(y * dst.width + x) * dst.channels + c] = static_cast<T>((sum + 128) >> 8);
+                }
+                else
+                {
+                    dst.data[(y * dst.width + x) * dst.channels + c] = sum * (1.f / 256);
+                }
+            }
+        }
+    }
+    return dst;
+}
+
+// Difference of a Gaussian level with the pyrUp 2x upscale of the level below
+HostImage<float> LaplacianLevel(const HostImage<float> &gauss, const HostImage<float> &below)
+{
+    HostImage<float> dst = gauss;
+
+    auto taps = [](int d, int *idx, float *w)
+    {
+        const int i = d / 2;
+        if (d % 2 == 0)
+        {
+            idx[0] = i - 1, idx[1] = i, idx[2] = i + 1;
+            w[0] = 1.f, w[1] = 6.f, w[2] = 1.f;
+        }
+        else
+        {
+            idx[0] = i, idx[1] = i + 1, idx[2] = i + 1;
+            w[0] = 4.f, w[1] = 4.f, w[2] = 0.f;
+        }
+    };
+
+    for (int y = 0; y < gauss.height; ++y)
+    {
+        for (int x = 0; x < gauss.width; ++x)
+        {
+            int   ix[3], iy[3];
+            float wx[3], wy[3];
+            taps(x, ix, wx);
+            taps(y, iy, wy);
+
+            for (int c = 0; c < gauss.channels; ++c)
+            {
+                float up = 0;
+                for (int j = 0; j < 3; ++j)
+                {
+                    float rowSum = 0;
+                    for (int i = 0; i < 3; ++i)
+                    {
+                        rowSum += wx[i] * below.at(Reflect101(ix[i], below.width), Reflect101(iy[j], below.height), c);
+                    }
+                    up += wy[j] * rowSum;
+                }
+                dst.data[(y * gauss.width + x) * gauss.channels + c] -= up * (1.f / 64);
+            }
+        }
+    }
+    return dst;
+}
+
+template<typename T>
+std::vector<HostImage<T>> GoldPyramid(const HostImage<T> &src, int numLevels, NVCVPyramidType type)
+{
+    std::vector<HostImage<T>> levels{src};
+    for (int l = 1; l < numLevels; ++l)
+    {
+        levels.push_back(PyrDown(levels.back()));
+    }
+
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if (type == NVCV_PYRAMID_LAPLACIAN)
+        {
+            for (int l = 0; l + 1 < numLevels; ++l)
+            {
+                levels[l] = LaplacianLevel(levels[l], levels[l + 1]);
+            }
+        }
+    }
+    return levels;
+}
+
+template<typename T>
+HostImage<T> RandomImage(int width, int height, int channels, std::default_random_engine &rng)
+{
+    std::uniform_int_distribution<int> udist(0, 255);
+
+    HostImage<T> img{width, height, channels, std::vector<T>(width * height * channels)};
+    std::generate(img.data.begin(), img.data.end(), [&]() { return static_cast<T>(udist(rng)); });
+    return img;
+}
+
+// Appends the levels of each sample to the output batch, sample by sample
+void PushLevels(nvcv::ImageBatchVarShape &batch, const std::vector<nvcv::Size2D> &sizes, int numLevels,
+                nvcv::ImageFormat fmt, std::vector<std::unique_ptr<nvcv::Image>> &images)
+{
+    for (nvcv::Size2D size : sizes)
+    {
+        for (int l = 0; l < numLevels; ++l)
+        {
+            images.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+            batch.pushBack(*images.back());
+            size = nvcv::Size2D{(size.w + 1) / 2, (size.h + 1) / 2};
+        }
+    }
+}
+
+template<typename T>
+void CheckLevels(const nvcv::ImageBatchVarShape &batch, const std::vector<HostImage<T>> &srcs, int numLevels,
+                 NVCVPyramidType type)
+{
+    for (size_t n = 0; n < srcs.size(); ++n)
+    {
+        std::vector<HostImage<T>> gold = GoldPyramid(srcs[n], numLevels, type);
+        for (int l = 0; l < numLevels; ++l)
+        {
+            SCOPED_TRACE(testing::Message() << "sample " << n << " level " << l);
+
+            const HostImage<T> &g = gold[l];
+
+            const auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(batch[n * numLevels + l].exportData());
+            ASSERT_NE(nullptr, data);
+            ASSERT_EQ(g.width, data->plane(0).width);
+            ASSERT_EQ(g.height, data->plane(0).height);
+
+            const int      rowBytes = g.width * g.channels * sizeof(T);
+            std::vector<T> test(g.data.size());
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(test.data(), rowBytes, data->plane(0).basePtr,
+                                                data->plane(0).rowStride, rowBytes, g.height, cudaMemcpyDeviceToHost));
+
+            for (size_t i = 0; i < test.size(); ++i)
+            {
+                if constexpr (std::is_integral_v<T>)
+                {
+                    ASSERT_EQ(g.data[i], test[i]) << "at pixel " << i / g.channels;
+                }
+                else
+                {
+                    ASSERT_NEAR(g.data[i], test[i], 1e-3f) << "at pixel " << i / g.channels;
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+void RunTensorPyramid(int width, int height, int numImages, int numLevels, nvcv::ImageFormat fmt,
+                      NVCVPyramidType type)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int channels = fmt.numChannels();
+    const int rowBytes = width * channels * sizeof(T);
+
+    std::default_random_engine rng;
+
+    nvcv::Tensor imgSrc  = test::CreateTensor(numImages, width, height, fmt);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<HostImage<T>> srcs;
+    for (int i = 0; i < numImages; ++i)
+    {
+        srcs.push_back(RandomImage<T>(width, height, channels, rng));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcs[i].data.data(),
+                                            rowBytes, rowBytes, height, cudaMemcpyHostToDevice));
+    }
+
+    std::vector<std::unique_ptr<nvcv::Image>> images;
+    nvcv::ImageBatchVarShape                  batchDst(numImages * numLevels);
+    PushLevels(batchDst, std::vector<nvcv::Size2D>(numImages, {width, height}), numLevels, fmt, images);
+
+    cvcuda::BuildPyramid pyramidOp;
+    EXPECT_NO_THROW(pyramidOp(stream, imgSrc, batchDst, numLevels, type));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    CheckLevels(batchDst, srcs, numLevels, type);
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpBuildPyramid, test::ValueList<int, int, int, int, nvcv::ImageFormat>
+{
+    // width, height, numImages, numLevels,          format
+    {      64,     48,         2,         4,    nvcv::FMT_U8 },
+    {      97,     33,         1,         5,  nvcv::FMT_RGB8 },
+    {      35,     35,         3,         2, nvcv::FMT_RGBA8 },
+    {     640,    480,         1,         6,    nvcv::FMT_U8 },
+    {       1,      7,         2,         3,    nvcv::FMT_U8 },
+    {      20,     10,         1,         1,  nvcv::FMT_RGB8 }
+});
+
+// clang-format on
+
+TEST_P(OpBuildPyramid, tensor_gaussian_correct_output)
+{
+    RunTensorPyramid<uint8_t>(GetParamValue<0>(), GetParamValue<1>(), GetParamValue<2>(), GetParamValue<3>(),
+                              GetParamValue<4>(), NVCV_PYRAMID_GAUSSIAN);
+}
+
+TEST_P(OpBuildPyramid, varshape_gaussian_correct_output)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int               width     = GetParamValue<0>();
+    int               height    = GetParamValue<1>();
+    int               numImages = GetParamValue<2>();
+    int               numLevels = GetParamValue<3>();
+    nvcv::ImageFormat fmt       = GetParamValue<4>();
+
+    int channels = fmt.numChannels();
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> sdist(0, std::min(width, height) / 2);
+
+    // Images of different sizes get pyramids of different sizes
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    std::vector<HostImage<uint8_t>>           srcs;
+    std::vector<nvcv::Size2D>                 sizes;
+    for (int i = 0; i < numImages; ++i)
+    {
+        sizes.push_back({width - sdist(rng), height - sdist(rng)});
+        srcs.push_back(RandomImage<uint8_t>(sizes[i].w, sizes[i].h, channels, rng));
+
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(sizes[i], fmt));
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(nullptr, srcData);
+
+        int rowBytes = sizes[i].w * channels;
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride,
+                                            srcs[i].data.data(), rowBytes, rowBytes, sizes[i].h,
+                                            cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    std::vector<std::unique_ptr<nvcv::Image>> images;
+    nvcv::ImageBatchVarShape                  batchDst(numImages * numLevels);
+    PushLevels(batchDst, sizes, numLevels, fmt, images);
+
+    cvcuda::BuildPyramid pyramidOp;
+    EXPECT_NO_THROW(pyramidOp(stream, batchSrc, batchDst, numLevels, NVCV_PYRAMID_GAUSSIAN));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    CheckLevels(batchDst, srcs, numLevels, NVCV_PYRAMID_GAUSSIAN);
+}
+
+TEST(OpBuildPyramid, tensor_float_gaussian_correct_output)
+{
+    RunTensorPyramid<float>(75, 50, 2, 5, nvcv::FMT_RGBf32, NVCV_PYRAMID_GAUSSIAN);
+}
+
+TEST(OpBuildPyramid, tensor_laplacian_correct_output)
+{
+    RunTensorPyramid<float>(75, 50, 2, 5, nvcv::FMT_RGBf32, NVCV_PYRAMID_LAPLACIAN);
+    RunTensorPyramid<float>(33, 17, 1, 3, nvcv::FMT_F32, NVCV_PYRAMID_LAPLACIAN);
+}
+
+TEST(OpBuildPyramid, invalid_arguments)
+{
+    nvcv::Tensor imgSrc = test::CreateTensor(2, 64, 48, nvcv::FMT_RGB8);
+
+    std::vector<std::unique_ptr<nvcv::Image>> images;
+    nvcv::ImageBatchVarShape levels(6), levelsF(6), oneImage(3), badSize(6);
+    PushLevels(levels, {{64, 48}, {64, 48}}, 3, nvcv::FMT_RGB8, images);
+    PushLevels(levelsF, {{64, 48}, {64, 48}}, 3, nvcv::FMT_RGBf32, images);
+    PushLevels(oneImage, {{64, 48}}, 3, nvcv::FMT_RGB8, images);
+    PushLevels(badSize, {{64, 48}, {64, 40}}, 3, nvcv::FMT_RGB8, images);
+
+    cvcuda::BuildPyramid pyramidOp;
+    EXPECT_NO_THROW(pyramidOp(nullptr, imgSrc, levels, 3, NVCV_PYRAMID_GAUSSIAN));
+    EXPECT_THROW(pyramidOp(nullptr, imgSrc, levels, 2, NVCV_PYRAMID_GAUSSIAN), nvcv::Exception);
+    EXPECT_THROW(pyramidOp(nullptr, imgSrc, levels, 0, NVCV_PYRAMID_GAUSSIAN), nvcv::Exception);
+    EXPECT_THROW(pyramidOp(nullptr, imgSrc, levels, 3, NVCV_PYRAMID_LAPLACIAN), nvcv::Exception);
+    EXPECT_THROW(pyramidOp(nullptr, imgSrc, levelsF, 3, NVCV_PYRAMID_GAUSSIAN), nvcv::Exception);
+    EXPECT_THROW(pyramidOp(nullptr, imgSrc, oneImage, 3, NVCV_PYRAMID_GAUSSIAN), nvcv::Exception);
+    EXPECT_THROW(pyramidOp(nullptr, imgSrc, badSize, 3, NVCV_PYRAMID_GAUSSIAN), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
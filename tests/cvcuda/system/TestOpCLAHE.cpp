@@ -0,0 +1,313 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpCLAHE.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+constexpr int kNumBins = 256;
+
+// Smooth gradient with noise, so that tiles have different histograms
+std::vector<uint8_t> RandomImage(nvcv::Size2D size, std::default_random_engine &rng)
+{
+    std::uniform_int_distribution<int> udist(-20, 20);
+
+    std::vector<uint8_t> img(size.w * size.h);
+    for (int y = 0; y < size.h; ++y)
+    {
+        for (int x = 0; x < size.w; ++x)
+        {
+            int v               = 40 + 120 * x / size.w + 60 * y / size.h + udist(rng);
+            img[y * size.w + x] = static_cast<uint8_t>(std::clamp(v, 0, 255));
+        }
+    }
+    return img;
+}
+
+uint8_t RoundToU8(float v)
+{
+    return static_cast<uint8_t>(std::clamp(std::nearbyint(v), 0.f, 255.f));
+}
+
+// Same as cv::CLAHE, with the image mirrored past its borders when its size isn't a multiple of the tile grid's
+std::vector<uint8_t> GoldCLAHE(const std::vector<uint8_t> &img, nvcv::Size2D size, float clipLimit, int tilesX,
+                               int tilesY)
+{
+    const int tileW    = (size.w + tilesX - 1) / tilesX;
+    const int tileH    = (size.h + tilesY - 1) / tilesY;
+    const int tileArea = tileW * tileH;
+
+    auto reflect = [](int i, int n)
+    {
+        return i < n ? i : std::max(2 * n - 2 - i, 0);
+    };
+
+    std::vector<uint8_t> luts(tilesX * tilesY * kNumBins);
+    for (int ty = 0; ty < tilesY; ++ty)
+    {
+        for (int tx = 0; tx < tilesX; ++tx)
+        {
+            std::vector<int> hist(kNumBins, 0);
+            for (int y = ty * tileH; y < (ty + 1) * tileH; ++y)
+            {
+                for (int x = tx * tileW; x < (tx + 1) * tileW; ++x)
+                {
+                    hist[img[reflect(y, size.h) * size.w + reflect(x, size.w)]]++;
+                }
+            }
+
+            if (clipLimit > 0)
+            {
+                const int limit   = std::max(static_cast<int>(static_cast<double>(clipLimit) * tileArea / kNumBins), 1);
+                int       clipped = 0;
+                for (int &h : hist)
+                {
+                    if (h > limit)
+                    {
+                        clipped += h - limit;
+                        h = limit;
+                    }
+                }
+
+                const int batch    = clipped / kNumBins;
+                int       residual = clipped - batch * kNumBins;
+                for (int &h : hist)
+                {
+                    h += batch;
+                }
+                if (residual != 0)
+                {
+                    const int step = std::max(kNumBins / residual, 1);
+                    for (int i = 0; i < kNumBins && residual > 0; i += step, residual--)
+                    {
+                        hist[i]++;
+                    }
+                }
+            }
+
+            const float scale = 255.f / tileArea;
+            uint8_t    *lut   = &luts[(ty * tilesX + tx) * kNumBins];
+            int         sum   = 0;
+            for (int i = 0; i < kNumBins; ++i)
+            {
+                sum += hist[i];
+                lut[i] = RoundToU8(sum * scale);
+            }
+        }
+    }
+
+    std::vector<uint8_t> res(img.size());
+    for (int y = 0; y < size.h; ++y)
+    {
+        const float tyf = y * (1.f / tileH) - 0.5f;
+        const int   ty  = static_cast<int>(std::floor(tyf));
+        const float ya  = tyf - ty;
+        const int   ty1 = std::max(ty, 0), ty2 = std::min(ty + 1, tilesY - 1);
+
+        for (int x = 0; x < size.w; ++x)
+        {
+            const float txf = x * (1.f / tileW) - 0.5f;
+            const int   tx  = static_cast<int>(std::floor(txf));
+            const float xa  = txf - tx;
+            const int   tx1 = std::max(tx, 0), tx2 = std::min(tx + 1, tilesX - 1);
+
+            const int v  = img[y * size.w + x];
+            auto      at = [&](int tileX, int tileY) -> float
+            {
+                return luts[(tileY * tilesX + tileX) * kNumBins + v];
+            };
+
+            res[y * size.w + x] = RoundToU8((at(tx1, ty1) * (1 - xa) + at(tx2, ty1) * xa) * (1 - ya)
+                                            + (at(tx1, ty2) * (1 - xa) + at(tx2, ty2) * xa) * ya);
+        }
+    }
+    return res;
+}
+
+// Interpolations are rounded on device after fused multiply-adds, which can change the result by 1
+void ExpectNear(const std::vector<uint8_t> &gold, const std::vector<uint8_t> &test)
+{
+    ASSERT_EQ(gold.size(), test.size());
+    for (size_t i = 0; i < gold.size(); ++i)
+    {
+        ASSERT_NEAR(gold[i], test[i], 1) << "at " << i;
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpCLAHE, test::ValueList<int, int, int, float, int, int>
+{
+    // width, height, numImages, clipLimit, tilesX, tilesY
+    {      64,     64,         1,      40.f,      8,      8 },
+    {     160,    120,         3,       2.f,      8,      8 },
+    {      97,     33,         4,       4.f,      5,      3 },
+    {      50,     70,         2,       0.f,      4,      4 },
+    {      31,     17,         2,       1.f,      1,      1 },
+    {     640,    480,         1,       3.f,     16,      8 }
+});
+
+// clang-format on
+
+TEST_P(OpCLAHE, tensor_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int   width     = GetParamValue<0>();
+    int   height    = GetParamValue<1>();
+    int   numImages = GetParamValue<2>();
+    float clipLimit = GetParamValue<3>();
+    int   tilesX    = GetParamValue<4>();
+    int   tilesY    = GetParamValue<5>();
+
+    std::default_random_engine rng;
+
+    nvcv::Tensor imgSrc  = test::CreateTensor(numImages, width, height, nvcv::FMT_U8);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<std::vector<uint8_t>> srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        srcVec[i] = RandomImage({width, height}, rng);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(), width,
+                                            width, height, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::Tensor imgDst = test::CreateTensor(numImages, width, height, nvcv::FMT_U8);
+
+    cvcuda::CLAHE claheOp(numImages, tilesX, tilesY);
+    EXPECT_NO_THROW(claheOp(stream, imgSrc, imgDst, clipLimit, tilesX, tilesY));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, dstData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> testVec(width * height);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), width, dstAccess->sampleData(i), dstAccess->rowStride(),
+                                            width, height, cudaMemcpyDeviceToHost));
+
+        ExpectNear(GoldCLAHE(srcVec[i], {width, height}, clipLimit, tilesX, tilesY), testVec);
+    }
+}
+
+TEST_P(OpCLAHE, varshape_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int   width     = GetParamValue<0>();
+    int   height    = GetParamValue<1>();
+    int   numImages = GetParamValue<2>();
+    float clipLimit = GetParamValue<3>();
+    int   tilesX    = GetParamValue<4>();
+    int   tilesY    = GetParamValue<5>();
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> sdist(0, std::min(width - tilesX, height - tilesY) / 2);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst;
+    std::vector<std::vector<uint8_t>>         srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        nvcv::Size2D size{width - sdist(rng), height - sdist(rng)};
+
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(size, nvcv::FMT_U8));
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(size, nvcv::FMT_U8));
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(nullptr, srcData);
+
+        srcVec[i] = RandomImage(size, rng);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec[i].data(),
+                                            size.w, size.w, size.h, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numImages), batchDst(numImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+
+    cvcuda::CLAHE claheOp(numImages, tilesX, tilesY);
+    EXPECT_NO_THROW(claheOp(stream, batchSrc, batchDst, clipLimit, tilesX, tilesY));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        const auto *dstData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[i]->exportData());
+        ASSERT_NE(nullptr, dstData);
+
+        nvcv::Size2D         size = imgDst[i]->size();
+        std::vector<uint8_t> testVec(size.w * size.h);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), size.w, dstData->plane(0).basePtr,
+                                            dstData->plane(0).rowStride, size.w, size.h, cudaMemcpyDeviceToHost));
+
+        ExpectNear(GoldCLAHE(srcVec[i], size, clipLimit, tilesX, tilesY), testVec);
+    }
+}
+
+TEST(OpCLAHE, invalid_arguments)
+{
+    nvcv::Tensor imgSrc   = test::CreateTensor(2, 64, 48, nvcv::FMT_U8);
+    nvcv::Tensor imgDst   = test::CreateTensor(2, 64, 48, nvcv::FMT_U8);
+    nvcv::Tensor imgRGB   = test::CreateTensor(2, 64, 48, nvcv::FMT_RGB8);
+    nvcv::Tensor imgTiny  = test::CreateTensor(2, 4, 4, nvcv::FMT_U8);
+    nvcv::Tensor imgBatch = test::CreateTensor(3, 64, 48, nvcv::FMT_U8);
+
+    cvcuda::CLAHE claheOp(2, 8, 8);
+    EXPECT_NO_THROW(claheOp(nullptr, imgSrc, imgDst, 2.f, 8, 8));
+    EXPECT_NO_THROW(claheOp(nullptr, imgSrc, imgDst, 2.f, 2, 6));
+    EXPECT_THROW(claheOp(nullptr, imgSrc, imgDst, 2.f, 0, 8), nvcv::Exception);
+    EXPECT_THROW(claheOp(nullptr, imgSrc, imgDst, 2.f, 16, 8), nvcv::Exception);
+    EXPECT_THROW(claheOp(nullptr, imgRGB, imgRGB, 2.f, 8, 8), nvcv::Exception);
+    EXPECT_THROW(claheOp(nullptr, imgTiny, imgTiny, 2.f, 8, 8), nvcv::Exception);
+    EXPECT_THROW(claheOp(nullptr, imgBatch, imgBatch, 2.f, 8, 8), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
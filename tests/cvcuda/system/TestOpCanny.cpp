@@ -0,0 +1,396 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpCanny.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace test = nvcv::test;
+
+namespace {
+
+void CopyRows(const nvcv::Tensor &tensor, std::vector<uint8_t> &host, cudaMemcpyKind kind)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(data, nullptr);
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    ASSERT_TRUE(access);
+
+    const int rowBytes = access->numCols();
+    const int rows     = access->numSamples() * access->numRows();
+    ASSERT_EQ(access->sampleStride(), access->numRows() * access->rowStride());
+
+    if (kind == cudaMemcpyHostToDevice)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(data->basePtr(), access->rowStride(), host.data(), rowBytes, rowBytes,
+                                            rows, kind));
+    }
+    else
+    {
+        host.resize(rows * rowBytes);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(host.data(), rowBytes, data->basePtr(), access->rowStride(), rowBytes,
+                                            rows, kind));
+    }
+}
+
+// Canny of OpenCV on one image: Sobel gradient with replicated border, non-maximum suppression and hysteresis.
+std::vector<uint8_t> GoldCanny(const std::vector<uint8_t> &in, int width, int height, float low, float high,
+                               int apertureSize, bool l2Gradient)
+{
+    std::vector<float> deriv, smooth;
+    switch (apertureSize)
+    {
+    case 3:
+        deriv  = {-1, 0, 1};
+        smooth = {1, 2, 1};
+        break;
+    case 5:
+        deriv  = {-1, -2, 0, 2, 1};
+        smooth = {1, 4, 6, 4, 1};
+        break;
+    default:
+        deriv  = {-1, -4, -5, 0, 5, 4, 1};
+        smooth = {1, 6, 15, 20, 15, 6, 1};
+        break;
+    }
+
+    const int radius = apertureSize / 2;
+
+    std::vector<float> gx(width * height), gy(width * height), mag(width * height);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            float sx = 0, sy = 0;
+            for (int i = 0; i < apertureSize; ++i)
+            {
+                for (int j = 0; j < apertureSize; ++j)
+                {
+                    const int   yy = std::clamp(y - radius + i, 0, height - 1);
+                    const int   xx = std::clamp(x - radius + j, 0, width - 1);
+                    const float v  = in[yy * width + xx];
+
+                    sx += v * smooth[i] * deriv[j];
+                    sy += v * deriv[i] * smooth[j];
+                }
+            }
+
+            const int p = y * width + x;
+            gx[p]       = sx;
+            gy[p]       = sy;
+            mag[p]      = l2Gradient ? std::sqrt(sx * sx + sy * sy) : std::abs(sx) + std::abs(sy);
+        }
+    }
+
+    auto magAt = [&](int x, int y)
+    {
+        return x >= 0 && x < width && y >= 0 && y < height ? mag[y * width + x] : 0.f;
+    };
+
+    std::vector<uint8_t> out(width * height, 0);
+    std::vector<int>     stack;
+
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            const int   p = y * width + x;
+            const float m = mag[p];
+            if (!(m > low))
+            {
+                continue;
+            }
+
+            const float ax = std::abs(gx[p]), ay = std::abs(gy[p]);
+
+            bool isMax;
+            if (ay < ax * 0.41421356f)
+            {
+                isMax = m > magAt(x - 1, y) && m >= magAt(x + 1, y);
+            }
+            else if (ay > ax * 2.41421356f)
+            {
+                isMax = m > magAt(x, y - 1) && m >= magAt(x, y + 1);
+            }
+            else
+            {
+                const int s = gx[p] * gy[p] < 0 ? -1 : 1;
+                isMax       = m > magAt(x - s, y - 1) && m > magAt(x + s, y + 1);
+            }
+
+            if (isMax)
+            {
+                out[p] = m > high ? 255 : 1;
+                if (out[p] == 255)
+                {
+                    stack.push_back(p);
+                }
+            }
+        }
+    }
+
+    // weak pixels are edges when 8-connected to a strong one
+    while (!stack.empty())
+    {
+        const int p = stack.back();
+        stack.pop_back();
+
+        const int x = p % width, y = p / width;
+        for (int dy = -1; dy <= 1; ++dy)
+        {
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                const int xx = x + dx, yy = y + dy;
+                if (xx >= 0 && xx < width && yy >= 0 && yy < height && out[yy * width + xx] == 1)
+                {
+                    out[yy * width + xx] = 255;
+                    stack.push_back(yy * width + xx);
+                }
+            }
+        }
+    }
+
+    std::replace(out.begin(), out.end(), uint8_t{1}, uint8_t{0});
+    return out;
+}
+
+// Smooth waves with noise, so that edges of all strengths run across many tiles of the operator.
+std::vector<uint8_t> CreateImage(int numSamples, int width, int height)
+{
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> noise(-12, 12);
+
+    std::vector<uint8_t> image(numSamples * width * height);
+    for (int n = 0; n < numSamples; ++n)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                const float v = 128 + 100 * std::sin((x + 7 * n) / 9.f) * std::cos(y / 13.f);
+
+                image[(n * height + y) * width + x] = std::clamp(static_cast<int>(v) + noise(rng), 0, 255);
+            }
+        }
+    }
+    return image;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpCanny, test::ValueList<int, int, int, float, float, int, bool>
+{
+    // numSamples, width, height,   low,  high, apertureSize, l2Gradient
+    {            1,   128,     96,  50.f, 150.f,            3,      false},
+    {            2,   197,     61, 100.f,  60.f,            3,       true},
+    {            3,    45,     33, 200.f, 800.f,            5,      false},
+    {            1,   300,     20, 800.f, 4000.f,           7,      false},
+    {            2,     7,      5,  10.f,  50.f,            3,      false}
+});
+
+// clang-format on
+
+TEST_P(OpCanny, correct_output)
+{
+    int   numSamples   = GetParamValue<0>();
+    int   width        = GetParamValue<1>();
+    int   height       = GetParamValue<2>();
+    float low          = GetParamValue<3>();
+    float high         = GetParamValue<4>();
+    int   apertureSize = GetParamValue<5>();
+    bool  l2Gradient   = GetParamValue<6>();
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::TensorShape shape({numSamples, height, width, 1}, nvcv::TENSOR_NHWC);
+    nvcv::Tensor      in(shape, nvcv::TYPE_U8), out(shape, nvcv::TYPE_U8);
+
+    std::vector<uint8_t> image = CreateImage(numSamples, width, height);
+    CopyRows(in, image, cudaMemcpyHostToDevice);
+
+    cvcuda::Canny op;
+    EXPECT_NO_THROW(op(stream, in, out, low, high, apertureSize, l2Gradient));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<uint8_t> test;
+    CopyRows(out, test, cudaMemcpyDeviceToHost);
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        const int                  imageSize = width * height;
+        const std::vector<uint8_t> sample(image.begin() + n * imageSize, image.begin() + (n + 1) * imageSize);
+
+        std::vector<uint8_t> gold = GoldCanny(sample, width, height, std::min(low, high), std::max(low, high),
+                                              apertureSize, l2Gradient);
+
+        EXPECT_TRUE(std::equal(gold.begin(), gold.end(), test.begin() + n * imageSize)) << "sample " << n;
+    }
+}
+
+// A weak step edge across the whole image, strong only at its left end, is an edge up to its right end.
+TEST(OpCanny, weak_edge_connected_across_tiles)
+{
+    const int width = 400, height = 24;
+
+    std::vector<uint8_t> image(width * height);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            image[y * width + x] = y < height / 2 ? 50 : (x < 4 ? 250 : 100);
+        }
+    }
+
+    nvcv::TensorShape shape({1, height, width, 1}, nvcv::TENSOR_NHWC);
+    nvcv::Tensor      in(shape, nvcv::TYPE_U8), out(shape, nvcv::TYPE_U8);
+    CopyRows(in, image, cudaMemcpyHostToDevice);
+
+    // the weak edge has a magnitude of 4 * 50, the strong one of 4 * 200
+    cvcuda::Canny op;
+    EXPECT_NO_THROW(op(nullptr, in, out, 100.f, 500.f));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+
+    std::vector<uint8_t> test;
+    CopyRows(out, test, cudaMemcpyDeviceToHost);
+
+    EXPECT_EQ(test, GoldCanny(image, width, height, 100.f, 500.f, 3, false));
+    EXPECT_EQ(255, test[(height / 2 - 1) * width + width - 1]);
+}
+
+// Same, captured in a graph: the passes are enqueued without waiting on the stream, and replaying the graph
+// follows the edge up to its right end.
+TEST(OpCanny, weak_edge_connected_across_tiles_in_graph)
+{
+    const int width = 400, height = 24;
+
+    std::vector<uint8_t> image(width * height);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            image[y * width + x] = y < height / 2 ? 50 : (x < 4 ? 250 : 100);
+        }
+    }
+
+    nvcv::TensorShape shape({1, height, width, 1}, nvcv::TENSOR_NHWC);
+    nvcv::Tensor      in(shape, nvcv::TYPE_U8), out(shape, nvcv::TYPE_U8);
+    CopyRows(in, image, cudaMemcpyHostToDevice);
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+    cvcuda::Canny op;
+
+    cudaGraph_t graph = nullptr;
+    ASSERT_EQ(cudaSuccess, cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal));
+    EXPECT_NO_THROW(op(stream, in, out, 100.f, 500.f));
+    ASSERT_EQ(cudaSuccess, cudaStreamEndCapture(stream, &graph));
+
+    cudaGraphExec_t exec = nullptr;
+    ASSERT_EQ(cudaSuccess, cudaGraphInstantiate(&exec, graph, 0));
+    EXPECT_EQ(cudaSuccess, cudaGraphDestroy(graph));
+
+    const std::vector<uint8_t> gold = GoldCanny(image, width, height, 100.f, 500.f, 3, false);
+
+    for (int replay = 0; replay < 2; ++replay)
+    {
+        EXPECT_EQ(cudaSuccess, cudaGraphLaunch(exec, stream));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        std::vector<uint8_t> result;
+        CopyRows(out, result, cudaMemcpyDeviceToHost);
+
+        EXPECT_EQ(result, gold) << "replay " << replay;
+        EXPECT_EQ(255, result[(height / 2 - 1) * width + width - 1]) << "replay " << replay;
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaGraphExecDestroy(exec));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+// Same, strong at its right end, on more tiles than there can be blocks resident on the device at once.
+TEST(OpCanny, weak_edge_connected_across_many_tiles)
+{
+    const int numSamples = 4, width = 8192, height = 64;
+
+    std::vector<uint8_t> image(numSamples * width * height);
+    for (int n = 0; n < numSamples; ++n)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                image[(n * height + y) * width + x] = y < height / 2 ? 50 : (x >= width - 4 ? 250 : 100);
+            }
+        }
+    }
+
+    nvcv::TensorShape shape({numSamples, height, width, 1}, nvcv::TENSOR_NHWC);
+    nvcv::Tensor      in(shape, nvcv::TYPE_U8), out(shape, nvcv::TYPE_U8);
+    CopyRows(in, image, cudaMemcpyHostToDevice);
+
+    cvcuda::Canny op;
+    EXPECT_NO_THROW(op(nullptr, in, out, 100.f, 500.f));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+
+    std::vector<uint8_t> test;
+    CopyRows(out, test, cudaMemcpyDeviceToHost);
+
+    const std::vector<uint8_t> sample(image.begin(), image.begin() + width * height);
+    const std::vector<uint8_t> gold = GoldCanny(sample, width, height, 100.f, 500.f, 3, false);
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        EXPECT_TRUE(std::equal(gold.begin(), gold.end(), test.begin() + n * width * height)) << "sample " << n;
+        EXPECT_EQ(255, test[(n * height + height / 2 - 1) * width]) << "sample " << n;
+    }
+}
+
+TEST(OpCanny, invalid_arguments)
+{
+    nvcv::TensorShape shape({2, 16, 24, 1}, nvcv::TENSOR_NHWC);
+
+    nvcv::Tensor in(shape, nvcv::TYPE_U8), out(shape, nvcv::TYPE_U8);
+    nvcv::Tensor inF32(shape, nvcv::TYPE_F32), outS16(shape, nvcv::TYPE_S16);
+    nvcv::Tensor outSmall({{2, 16, 23, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor in3({{2, 16, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor out3({{2, 16, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    cvcuda::Canny op;
+    EXPECT_NO_THROW(op(nullptr, in, out, 50.f, 100.f));
+    EXPECT_THROW(op(nullptr, in, out, 50.f, 100.f, 1), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out, 50.f, 100.f, 4), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out, -1.f, 100.f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, inF32, out, 50.f, 100.f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, outS16, 50.f, 100.f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, outSmall, 50.f, 100.f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in3, out3, 50.f, 100.f), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -26,6 +26,7 @@
 #include <nvcv/alloc/CustomAllocator.hpp>
 #include <nvcv/alloc/CustomResourceAllocator.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <random>
 
@@ -47,6 +48,40 @@ static void dbgImage(std::vector<uint8_t> &in, int rowStride)
 }
 #endif
 
+// Downloads the pixels of every sample, without the row padding.
+static std::vector<uint8_t> DownloadPixels(const nvcv::ITensor &tensor)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    EXPECT_NE(nullptr, data);
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    EXPECT_TRUE(access);
+
+    const int rowBytes = access->numCols() * access->colStride();
+    const int rows     = access->numRows();
+
+    std::vector<uint8_t> pixels(access->numSamples() * rows * rowBytes);
+    for (int n = 0; n < access->numSamples(); ++n)
+    {
+        EXPECT_EQ(cudaSuccess, cudaMemcpy2D(pixels.data() + n * rows * rowBytes, rowBytes, access->sampleData(n),
+                                            access->rowStride(), rowBytes, rows, cudaMemcpyDeviceToHost));
+    }
+    return pixels;
+}
+
+static void FillRandom(const nvcv::ITensor &tensor)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(nullptr, data);
+
+    std::vector<uint8_t>               bytes(data->stride(0) * data->shape(0));
+    std::default_random_engine         rng(3);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::generate(bytes.begin(), bytes.end(), [&] { return dist(rng); });
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(data->basePtr(), bytes.data(), bytes.size(), cudaMemcpyHostToDevice));
+}
+
 // Width is in bytes or pixels..
 static void WriteData(const nvcv::TensorDataAccessStridedImagePlanar &data, uint8_t val, int crop_rows,
                       int crop_columns)
@@ -196,3 +231,45 @@ TEST_P(OpCenterCrop, CenterCrop_packed)
 #endif
     EXPECT_EQ(gold, test);
 }
+
+TEST_P(OpCenterCrop, CenterCropView_matches_copy)
+{
+    int inWidth        = GetParamValue<0>();
+    int inHeight       = GetParamValue<1>();
+    int crop_columns   = GetParamValue<2>();
+    int crop_rows      = GetParamValue<3>();
+    int numberOfImages = GetParamValue<4>();
+
+    nvcv::Tensor imgIn  = test::CreateTensor(numberOfImages, inWidth, inHeight, nvcv::FMT_RGBA8);
+    nvcv::Tensor imgOut = test::CreateTensor(numberOfImages, crop_columns, crop_rows, nvcv::FMT_RGBA8);
+    FillRandom(imgIn);
+
+    cvcuda::CenterCrop cropOp;
+    EXPECT_NO_THROW(cropOp(nullptr, imgIn, imgOut, {crop_columns, crop_rows}));
+
+    cvcuda::CenterCropView view(imgIn, {crop_columns, crop_rows});
+
+    const auto *inData   = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgIn.exportData());
+    const auto *viewData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(view.exportData());
+    ASSERT_NE(nullptr, viewData);
+
+    // the view only offsets the base pointer
+    EXPECT_EQ(viewData->shape(), nvcv::TensorShape({numberOfImages, crop_rows, crop_columns, 4}, "NHWC"));
+    for (int d = 0; d < 4; ++d)
+    {
+        EXPECT_EQ(viewData->stride(d), inData->stride(d));
+    }
+    EXPECT_EQ(viewData->basePtr(), inData->basePtr() + (inHeight - crop_rows) / 2 * inData->stride(1)
+                                       + (inWidth - crop_columns) / 2 * inData->stride(2));
+
+    EXPECT_EQ(DownloadPixels(imgOut), DownloadPixels(view));
+}
+
+TEST(OpCenterCrop, CenterCropView_invalid_size)
+{
+    nvcv::Tensor imgIn = test::CreateTensor(2, 16, 8, nvcv::FMT_RGBA8);
+
+    EXPECT_THROW(cvcuda::CenterCropView(imgIn, {17, 8}), nvcv::Exception);
+    EXPECT_THROW(cvcuda::CenterCropView(imgIn, {16, 9}), nvcv::Exception);
+    EXPECT_THROW(cvcuda::CenterCropView(imgIn, {0, 8}), nvcv::Exception);
+}
@@ -110,3 +110,81 @@ TEST(TestOpChannelReorder, smoke_test_works)
     EXPECT_EQ(make_uchar4(4, 1, 2, 0), outImageValues[0]);
     EXPECT_EQ(make_uchar4(28, 10, 3, 0), outImageValues[1]);
 }
+
+TEST(TestOpChannelReorder, in_place_works)
+{
+    nvcv::Image images[2] = {
+        nvcv::Image{nvcv::Size2D{4, 2}, nvcv::FMT_RGBA8},
+        nvcv::Image{nvcv::Size2D{4, 2}, nvcv::FMT_RGBA8}
+    };
+
+    nvcv::ImageBatchVarShape batch(2);
+    batch.pushBack(images[0]);
+    batch.pushBack(images[1]);
+
+    std::vector<uchar4> imageValues;
+    auto               &imageData = dynamic_cast<const nvcv::IImageDataStrided &>(*images[0].exportData());
+    imageValues.resize(imageData.plane(0).rowStride / sizeof(uchar4) * imageData.size().h);
+    imageValues[0] = {1, 2, 3, 7};
+    imageValues[1] = {7, 3, 2, 9};
+    test::SetTensorFromVector<uchar4>(nvcv::TensorWrapImage(images[0]).exportData(), imageValues, -1);
+    test::SetTensorFromVector<uchar4>(nvcv::TensorWrapImage(images[1]).exportData(), imageValues, -1);
+
+    // clang-format off
+    nvcv::Tensor orders(
+        {
+            {2, 4},
+            "NC"
+        },
+        nvcv::TYPE_S32);
+    // clang-format on
+
+    auto             &orderData = dynamic_cast<const nvcv::ITensorDataStrided &>(*orders.exportData());
+    std::vector<int4> orderValues(orderData.stride(0) / sizeof(int4));
+
+    // Channels read after others were written must see their input values
+    orderValues[0] = {3, 2, 1, 0};
+    test::SetTensorFromVector<int4>(orders.exportData(), orderValues, 0);
+
+    orderValues[0] = {1, 0, -1, 1};
+    test::SetTensorFromVector<int4>(orders.exportData(), orderValues, 1);
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::ChannelReorder chReorder;
+
+    chReorder(stream, batch, batch, orders);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<uchar4> outImageValues;
+    test::GetVectorFromTensor<uchar4>(nvcv::TensorWrapImage(images[0]).exportData(), 0, outImageValues);
+    EXPECT_EQ(make_uchar4(7, 3, 2, 1), outImageValues[0]);
+    EXPECT_EQ(make_uchar4(9, 2, 3, 7), outImageValues[1]);
+
+    outImageValues.clear();
+    test::GetVectorFromTensor<uchar4>(nvcv::TensorWrapImage(images[1]).exportData(), 0, outImageValues);
+    EXPECT_EQ(make_uchar4(2, 1, 0, 2), outImageValues[0]);
+    EXPECT_EQ(make_uchar4(3, 7, 0, 3), outImageValues[1]);
+}
+
+TEST(TestOpChannelReorder, image_of_input_at_another_output_index_is_rejected)
+{
+    nvcv::Image images[2] = {
+        nvcv::Image{nvcv::Size2D{4, 2}, nvcv::FMT_RGBA8},
+        nvcv::Image{nvcv::Size2D{4, 2}, nvcv::FMT_RGBA8}
+    };
+
+    nvcv::ImageBatchVarShape in(2), out(2);
+    in.pushBack(images[0]);
+    in.pushBack(images[1]);
+    out.pushBack(images[1]);
+    out.pushBack(images[0]);
+
+    nvcv::Tensor orders({{2, 4}, "NC"}, nvcv::TYPE_S32);
+
+    cvcuda::ChannelReorder chReorder;
+    EXPECT_THROW(chReorder(nullptr, in, out, orders), nvcv::Exception);
+}
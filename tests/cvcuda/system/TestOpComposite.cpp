@@ -26,6 +26,7 @@
 #include <nvcv/alloc/CustomAllocator.hpp>
 #include <nvcv/alloc/CustomResourceAllocator.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <random>
 
@@ -379,3 +380,103 @@ TEST_P(OpComposite, varshape_correct_output)
         EXPECT_EQ(goldVec, testVec);
     }
 }
+
+static uint8_t compositeGold(int c0, int c1, int a, bool premultiplied)
+{
+    if (premultiplied)
+    {
+        return std::min(255, c1 + (c0 * (255 - a) + 127) / 255);
+    }
+    return (c0 * (255 - a) + c1 * a + 127) / 255;
+}
+
+TEST(OpComposite, tensor_roi_in_place)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int numberOfImages = 2;
+    const int bgWidth = 37, bgHeight = 23, bgChannels = 4;
+    const int fgWidth = 13, fgHeight = 9, fgChannels = 3;
+
+    // Partly outside the background on the left, inside on the top
+    const int offsetX = -4, offsetY = 7;
+
+    for (bool premultiplied : {false, true})
+    {
+        SCOPED_TRACE(premultiplied);
+
+        nvcv::Tensor foregroundImg(numberOfImages, {fgWidth, fgHeight}, nvcv::FMT_RGB8);
+        nvcv::Tensor fgMaskImg(numberOfImages, {fgWidth, fgHeight}, nvcv::FMT_U8);
+        nvcv::Tensor backgroundImg(numberOfImages, {bgWidth, bgHeight}, nvcv::FMT_RGBA8);
+
+        std::default_random_engine             rng(premultiplied ? 3 : 7);
+        std::uniform_int_distribution<uint8_t> udist(0, 255);
+
+        auto upload = [&](nvcv::Tensor &tensor, int rowBytes, int height, std::vector<std::vector<uint8_t>> &vec)
+        {
+            const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+            ASSERT_NE(nullptr, data);
+            auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+            ASSERT_TRUE(access);
+
+            vec.resize(numberOfImages);
+            for (int i = 0; i < numberOfImages; ++i)
+            {
+                vec[i].resize(rowBytes * height);
+                std::generate(vec[i].begin(), vec[i].end(), [&]() { return udist(rng); });
+                ASSERT_EQ(cudaSuccess, cudaMemcpy2D(access->sampleData(i), access->rowStride(), vec[i].data(),
+                                                    rowBytes, rowBytes, height, cudaMemcpyHostToDevice));
+            }
+        };
+
+        std::vector<std::vector<uint8_t>> foregroundVec, fgMaskVec, backgroundVec;
+        upload(foregroundImg, fgWidth * fgChannels, fgHeight, foregroundVec);
+        upload(fgMaskImg, fgWidth, fgHeight, fgMaskVec);
+        upload(backgroundImg, bgWidth * bgChannels, bgHeight, backgroundVec);
+
+        cvcuda::Composite compositeOp;
+        EXPECT_NO_THROW(compositeOp(stream, foregroundImg, fgMaskImg, backgroundImg, offsetX, offsetY,
+                                    premultiplied ? CVCUDA_COMPOSITE_PREMULTIPLIED : 0));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        const auto *bgData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(backgroundImg.exportData());
+        ASSERT_NE(nullptr, bgData);
+        auto bgAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*bgData);
+        ASSERT_TRUE(bgAccess);
+
+        const int bgRowBytes = bgWidth * bgChannels;
+        for (int i = 0; i < numberOfImages; ++i)
+        {
+            SCOPED_TRACE(i);
+
+            std::vector<uint8_t> testVec(bgHeight * bgRowBytes);
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), bgRowBytes, bgAccess->sampleData(i),
+                                                bgAccess->rowStride(), bgRowBytes, bgHeight, cudaMemcpyDeviceToHost));
+
+            std::vector<uint8_t> goldVec = backgroundVec[i];
+            for (int y = 0; y < fgHeight; ++y)
+            {
+                for (int x = 0; x < fgWidth; ++x)
+                {
+                    int bx = x + offsetX, by = y + offsetY;
+                    if (bx < 0 || bx >= bgWidth || by < 0 || by >= bgHeight)
+                    {
+                        continue;
+                    }
+                    uint8_t       *bg = goldVec.data() + by * bgRowBytes + bx * bgChannels;
+                    const uint8_t *fg = foregroundVec[i].data() + (y * fgWidth + x) * fgChannels;
+                    const int      a  = fgMaskVec[i][y * fgWidth + x];
+                    for (int k = 0; k < fgChannels; ++k)
+                    {
+                        bg[k] = compositeGold(bg[k], fg[k], a, premultiplied);
+                    }
+                }
+            }
+
+            EXPECT_EQ(goldVec, testVec);
+        }
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
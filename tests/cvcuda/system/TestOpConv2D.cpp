@@ -28,6 +28,7 @@
 #include <nvcv/alloc/CustomResourceAllocator.hpp>
 #include <nvcv/cuda/TypeTraits.hpp>
 
+#include <numeric>
 #include <random>
 
 namespace cuda = nvcv::cuda;
@@ -44,7 +45,11 @@ NVCV_TEST_SUITE_P(OpConv2D, test::ValueList<int, int, int, int, int, int, int, N
     {     13,     12,        13,           5,            5,             4,             4, NVCV_BORDER_WRAP},
     {      4,      3,         4,           3,            3,             1,             1, NVCV_BORDER_REPLICATE},
     {     44,     55,         5,           3,            3,            -1,            -1, NVCV_BORDER_REFLECT},
-    {    244,    155,         6,           5,            5,            -1,            -1, NVCV_BORDER_REFLECT101}
+    {    244,    155,         6,           5,            5,            -1,            -1, NVCV_BORDER_REFLECT101},
+    {    123,    144,         2,           9,            9,            -1,            -1, NVCV_BORDER_REFLECT101},
+    {     66,     99,         3,          11,            7,             2,             6, NVCV_BORDER_REPLICATE},
+    {     45,     33,         4,          15,           15,            -1,            -1, NVCV_BORDER_WRAP},
+    {    200,    100,         2,          31,           31,            -1,            -1, NVCV_BORDER_CONSTANT}
 });
 
 // clang-format on
@@ -202,3 +207,249 @@ TEST_P(OpConv2D, varshape_correct_output)
         EXPECT_EQ(testVec, goldVec);
     }
 }
+
+namespace {
+
+// Runs Conv2D with the given algorithm on RGBA8 images of different sizes, with normalized random kernels of
+// kernelSize, and returns the outputs.
+std::vector<std::vector<uint8_t>> RunConv2D(NVCVConv2DAlgorithm algorithm, nvcv::Size2D kernelSize, int2 kernelAnchor,
+                                            NVCVBorderType borderMode)
+{
+    const std::vector<nvcv::Size2D> sizes{
+        {300, 211},
+        {97, 130},
+        {20, 17}
+    };
+    const int numImages = sizes.size();
+
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    std::default_random_engine             rng(7);
+    std::uniform_int_distribution<uint8_t> udist(0, 255);
+    std::uniform_real_distribution<float>  kdist(0.f, 1.f);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst, kernel;
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(sizes[i], nvcv::FMT_RGBA8));
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(sizes[i], nvcv::FMT_RGBA8));
+        kernel.emplace_back(std::make_unique<nvcv::Image>(kernelSize, nvcv::FMT_F32));
+
+        std::vector<uint8_t> srcVec(sizes[i].w * sizes[i].h * 4);
+        std::generate(srcVec.begin(), srcVec.end(), [&]() { return udist(rng); });
+
+        std::vector<float> kernelVec(kernelSize.w * kernelSize.h);
+        std::generate(kernelVec.begin(), kernelVec.end(), [&]() { return kdist(rng); });
+        float sum = std::accumulate(kernelVec.begin(), kernelVec.end(), 0.f);
+        for (float &w : kernelVec)
+        {
+            w /= sum;
+        }
+
+        auto *srcData    = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        auto *kernelData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(kernel[i]->exportData());
+        EXPECT_NE(nullptr, srcData);
+        EXPECT_NE(nullptr, kernelData);
+
+        EXPECT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec.data(),
+                                            sizes[i].w * 4, sizes[i].w * 4, sizes[i].h, cudaMemcpyHostToDevice));
+        EXPECT_EQ(cudaSuccess,
+                  cudaMemcpy2D(kernelData->plane(0).basePtr, kernelData->plane(0).rowStride, kernelVec.data(),
+                               kernelSize.w * sizeof(float), kernelSize.w * sizeof(float), kernelSize.h,
+                               cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numImages), batchDst(numImages), batchKernel(numImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+    batchKernel.pushBack(kernel.begin(), kernel.end());
+
+    nvcv::Tensor kernelAnchorTensor({{numImages}, "N"}, nvcv::TYPE_2S32);
+    {
+        auto *dev = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(kernelAnchorTensor.exportData());
+        EXPECT_NE(nullptr, dev);
+
+        std::vector<int2> vec(numImages, kernelAnchor);
+        EXPECT_EQ(cudaSuccess,
+                  cudaMemcpy(dev->basePtr(), vec.data(), vec.size() * sizeof(int2), cudaMemcpyHostToDevice));
+    }
+
+    cvcuda::Conv2D conv2dOp(algorithm);
+    EXPECT_NO_THROW(conv2dOp(stream, batchSrc, batchDst, batchKernel, kernelAnchorTensor, borderMode));
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<std::vector<uint8_t>> out(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        auto *dstData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[i]->exportData());
+        EXPECT_NE(nullptr, dstData);
+
+        out[i].resize(sizes[i].w * sizes[i].h * 4);
+        EXPECT_EQ(cudaSuccess, cudaMemcpy2D(out[i].data(), sizes[i].w * 4, dstData->plane(0).basePtr,
+                                            dstData->plane(0).rowStride, sizes[i].w * 4, sizes[i].h,
+                                            cudaMemcpyDeviceToHost));
+    }
+    return out;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpConv2D_FFT, test::ValueList<int, int, int, int, NVCVBorderType>
+{
+    // kernelWidth, kernelHeight, kernelAnchorX, kernelAnchorY,           borderMode
+    {           33,           33,            -1,            -1, NVCV_BORDER_CONSTANT},
+    {           45,           37,             3,            30, NVCV_BORDER_REPLICATE},
+    {           40,           40,            -1,            -1, NVCV_BORDER_REFLECT},
+    {           35,           50,            10,            -1, NVCV_BORDER_WRAP},
+    {          101,           81,            -1,            -1, NVCV_BORDER_REFLECT101},
+    {            5,            3,            -1,            -1, NVCV_BORDER_REFLECT101}
+});
+
+// clang-format on
+
+TEST_P(OpConv2D_FFT, varshape_matches_direct)
+{
+    nvcv::Size2D   kernelSize{GetParamValue<0>(), GetParamValue<1>()};
+    int2           kernelAnchor{GetParamValue<2>(), GetParamValue<3>()};
+    NVCVBorderType borderMode = GetParamValue<4>();
+
+    std::vector<std::vector<uint8_t>> gold = RunConv2D(NVCV_CONV2D_ALGO_DIRECT, kernelSize, kernelAnchor, borderMode);
+    std::vector<std::vector<uint8_t>> test = RunConv2D(NVCV_CONV2D_ALGO_FFT, kernelSize, kernelAnchor, borderMode);
+
+    ASSERT_EQ(gold.size(), test.size());
+    for (size_t i = 0; i < gold.size(); ++i)
+    {
+        SCOPED_TRACE(i);
+        ASSERT_EQ(gold[i].size(), test[i].size());
+
+        // the transforms round differently from the direct sums, which may flip the rounding of the output
+        for (size_t j = 0; j < gold[i].size(); ++j)
+        {
+            ASSERT_NEAR(gold[i][j], test[i][j], 1) << "at element " << j;
+        }
+    }
+}
+
+TEST(OpConv2D_FFT, invalid_algorithm_is_rejected)
+{
+    NVCVOperatorHandle handle = nullptr;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaConv2DCreateWithAlgorithm(&handle, (NVCVConv2DAlgorithm)3));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaConv2DCreateWithAlgorithm(nullptr, NVCV_CONV2D_ALGO_FFT));
+}
+
+// Two-channel images have no kernel of their own and take the runtime-channel filter; with a small image next to a
+// large one the batch is sparse, so it's launched over flat tiles.
+TEST(OpConv2D, varshape_two_channels_sparse_batch)
+{
+    const std::vector<nvcv::Size2D> sizes{
+        {400, 300},
+        {20, 17},
+        {31, 9}
+    };
+    const int numImages = sizes.size();
+
+    nvcv::ImageFormat imageFormat = nvcv::FMT_2S16;
+    nvcv::Size2D      kernelSize{5, 3};
+    int2              kernelAnchor{-1, -1};
+
+    for (NVCVBorderType borderMode : {NVCV_BORDER_CONSTANT, NVCV_BORDER_REFLECT101})
+    {
+        SCOPED_TRACE(borderMode);
+
+        cudaStream_t stream;
+        ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+        std::default_random_engine            rng(3);
+        std::uniform_int_distribution<short>  udist(-1000, 1000);
+        std::uniform_real_distribution<float> kdist(-1.f, 1.f);
+
+        std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst, kernel;
+        std::vector<std::vector<uint8_t>>         srcVec(numImages);
+        std::vector<std::vector<float>>           kernelVec(numImages);
+
+        for (int i = 0; i < numImages; ++i)
+        {
+            imgSrc.emplace_back(std::make_unique<nvcv::Image>(sizes[i], imageFormat));
+            imgDst.emplace_back(std::make_unique<nvcv::Image>(sizes[i], imageFormat));
+            kernel.emplace_back(std::make_unique<nvcv::Image>(kernelSize, nvcv::FMT_F32));
+
+            int rowStride = sizes[i].w * sizeof(short2);
+
+            srcVec[i].resize(sizes[i].h * rowStride);
+            short *srcValues = reinterpret_cast<short *>(srcVec[i].data());
+            std::generate(srcValues, srcValues + srcVec[i].size() / sizeof(short), [&]() { return udist(rng); });
+
+            kernelVec[i].resize(kernelSize.w * kernelSize.h);
+            std::generate(kernelVec[i].begin(), kernelVec[i].end(), [&]() { return kdist(rng); });
+
+            auto *srcData    = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+            auto *kernelData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(kernel[i]->exportData());
+            ASSERT_NE(nullptr, srcData);
+            ASSERT_NE(nullptr, kernelData);
+
+            ASSERT_EQ(cudaSuccess,
+                      cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec[i].data(),
+                                   rowStride, rowStride, sizes[i].h, cudaMemcpyHostToDevice));
+            ASSERT_EQ(cudaSuccess,
+                      cudaMemcpy2D(kernelData->plane(0).basePtr, kernelData->plane(0).rowStride, kernelVec[i].data(),
+                                   kernelSize.w * sizeof(float), kernelSize.w * sizeof(float), kernelSize.h,
+                                   cudaMemcpyHostToDevice));
+        }
+
+        nvcv::ImageBatchVarShape batchSrc(numImages), batchDst(numImages), batchKernel(numImages);
+        batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+        batchDst.pushBack(imgDst.begin(), imgDst.end());
+        batchKernel.pushBack(kernel.begin(), kernel.end());
+
+        nvcv::Tensor kernelAnchorTensor({{numImages}, "N"}, nvcv::TYPE_2S32);
+        {
+            auto *dev = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(kernelAnchorTensor.exportData());
+            ASSERT_NE(nullptr, dev);
+
+            std::vector<int2> vec(numImages, kernelAnchor);
+            ASSERT_EQ(cudaSuccess,
+                      cudaMemcpy(dev->basePtr(), vec.data(), vec.size() * sizeof(int2), cudaMemcpyHostToDevice));
+        }
+
+        cvcuda::Conv2D conv2dOp;
+        EXPECT_NO_THROW(conv2dOp(stream, batchSrc, batchDst, batchKernel, kernelAnchorTensor, borderMode));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+        for (int i = 0; i < numImages; ++i)
+        {
+            SCOPED_TRACE(i);
+
+            auto *dstData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[i]->exportData());
+            ASSERT_NE(nullptr, dstData);
+
+            int   rowStride = sizes[i].w * sizeof(short2);
+            int3  shape{sizes[i].w, sizes[i].h, 1};
+            long3 pitches{shape.y * rowStride, rowStride, sizeof(short2)};
+
+            std::vector<uint8_t> testVec(shape.y * rowStride);
+            ASSERT_EQ(cudaSuccess,
+                      cudaMemcpy2D(testVec.data(), rowStride, dstData->plane(0).basePtr, dstData->plane(0).rowStride,
+                                   rowStride, shape.y, cudaMemcpyDeviceToHost));
+
+            std::vector<uint8_t> goldVec(shape.y * rowStride);
+            int2                 anchor = kernelAnchor;
+            test::Convolve(goldVec, pitches, srcVec[i], pitches, shape, imageFormat, kernelVec[i], kernelSize, anchor,
+                           borderMode, cuda::SetAll<float4>(0));
+
+            const short *test = reinterpret_cast<const short *>(testVec.data());
+            const short *gold = reinterpret_cast<const short *>(goldVec.data());
+
+            // the device may fuse the multiply-adds, which can flip the rounding of the output
+            for (size_t j = 0; j < testVec.size() / sizeof(short); ++j)
+            {
+                ASSERT_NEAR(gold[j], test[j], 1) << "at element " << j;
+            }
+        }
+    }
+}
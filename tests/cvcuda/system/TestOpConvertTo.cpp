@@ -27,6 +27,10 @@
 #include <nvcv/alloc/CustomResourceAllocator.hpp>
 #include <nvcv/cuda/SaturateCast.hpp>
 
+#include <cuda_fp16.h>
+
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <random>
 
@@ -52,15 +56,12 @@ static void setGoldBuffer(std::vector<DT_DEST> &vect, DT_DEST val, int width, in
 }
 
 template<typename DT_SOURCE, typename DT_DEST>
-const void testConvertTo(nvcv::ImageFormat fmtIn, nvcv::ImageFormat fmtOut, int batch, int width, int height,
+const void testConvertTo(nvcv::ITensor &imgIn, nvcv::ITensor &imgOut, int batch, int width, int height,
                          double alpha, double beta, DT_SOURCE setVal, DT_DEST expVal)
 {
     cudaStream_t stream;
     EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
 
-    nvcv::Tensor imgOut = test::CreateTensor(batch, width, height, fmtOut);
-    nvcv::Tensor imgIn  = test::CreateTensor(batch, width, height, fmtIn);
-
     const auto *inData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgIn.exportData());
     const auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgOut.exportData());
 
@@ -107,6 +108,28 @@ const void testConvertTo(nvcv::ImageFormat fmtIn, nvcv::ImageFormat fmtOut, int
     EXPECT_EQ(goldVec, testVec);
 }
 
+template<typename DT_SOURCE, typename DT_DEST>
+const void testConvertTo(nvcv::ImageFormat fmtIn, nvcv::ImageFormat fmtOut, int batch, int width, int height,
+                         double alpha, double beta, DT_SOURCE setVal, DT_DEST expVal)
+{
+    nvcv::Tensor imgOut = test::CreateTensor(batch, width, height, fmtOut);
+    nvcv::Tensor imgIn  = test::CreateTensor(batch, width, height, fmtIn);
+
+    testConvertTo(imgIn, imgOut, batch, width, height, alpha, beta, setVal, expVal);
+}
+
+// There are no half-precision image formats, F16 tensors are created from their shape, and their values are
+// compared by bit pattern
+static nvcv::TensorShape rgbaShape(int batch, int width, int height)
+{
+    return nvcv::TensorShape({batch, height, width, 4}, nvcv::TENSOR_NHWC);
+}
+
+static uint16_t halfBits(double val)
+{
+    return static_cast<__half_raw>(__float2half_rn(static_cast<float>(val))).x;
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpConvertTo, test::ValueList<int, int, double, double, int>
 {
@@ -186,3 +209,387 @@ TEST_P(OpConvertTo, OpConvertTo_RGBAf32toRGBAf32t)
     testConvertTo<fromType, toType>(nvcv::FMT_RGBAf32, nvcv::FMT_RGBAf32, batch, width, height, alpha, beta, val,
                                     valExp);
 }
+
+TEST_P(OpConvertTo, OpConvertTo_RGBA8toRGBAf16)
+{
+    int    width  = GetParamValue<0>();
+    int    height = GetParamValue<1>();
+    double alpha  = GetParamValue<2>();
+    double beta   = GetParamValue<3>();
+    int    batch  = GetParamValue<4>();
+
+    uint8_t  val    = 0x10;
+    uint16_t valExp = halfBits(alpha * val + beta);
+
+    nvcv::Tensor imgIn(rgbaShape(batch, width, height), nvcv::TYPE_U8);
+    nvcv::Tensor imgOut(rgbaShape(batch, width, height), nvcv::TYPE_F16);
+
+    testConvertTo<uint8_t, uint16_t>(imgIn, imgOut, batch, width, height, alpha, beta, val, valExp);
+}
+
+TEST_P(OpConvertTo, OpConvertTo_RGBAf16toRGBAf32)
+{
+    int    width  = GetParamValue<0>();
+    int    height = GetParamValue<1>();
+    double alpha  = GetParamValue<2>();
+    double beta   = GetParamValue<3>();
+    int    batch  = GetParamValue<4>();
+
+    float val    = 16.5f;
+    float valExp = nvcv::cuda::SaturateCast<float>(alpha * val + beta);
+
+    nvcv::Tensor imgIn(rgbaShape(batch, width, height), nvcv::TYPE_F16);
+    nvcv::Tensor imgOut(rgbaShape(batch, width, height), nvcv::TYPE_F32);
+
+    testConvertTo<uint16_t, float>(imgIn, imgOut, batch, width, height, alpha, beta, halfBits(val), valExp);
+}
+
+TEST_P(OpConvertTo, OpConvertTo_host_RGBA8toRGBAf32)
+{
+    int    width  = GetParamValue<0>();
+    int    height = GetParamValue<1>();
+    double alpha  = GetParamValue<2>();
+    double beta   = GetParamValue<3>();
+    int    batch  = GetParamValue<4>();
+
+    nvcv::TensorShape shape = rgbaShape(batch, width, height);
+
+    std::vector<uint8_t> inVec(shape.size());
+    std::vector<float>   outVec(shape.size());
+    std::vector<float>   goldVec(shape.size());
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+    std::transform(inVec.begin(), inVec.end(), goldVec.begin(),
+                   [&](uint8_t v) { return static_cast<float>(alpha) * v + static_cast<float>(beta); });
+
+    // Packed NHWC buffers in host memory
+    auto wrapHost = [&](void *ptr, int64_t elemBytes)
+    {
+        NVCVTensorBufferStrided buffer = {};
+        buffer.basePtr                 = reinterpret_cast<NVCVByte *>(ptr);
+        for (int d = shape.rank() - 1; d >= 0; --d)
+        {
+            buffer.strides[d] = d == shape.rank() - 1 ? elemBytes : buffer.strides[d + 1] * shape[d + 1];
+        }
+        return buffer;
+    };
+
+    nvcv::TensorWrapData imgIn(nvcv::TensorDataStridedHost{shape, nvcv::TYPE_U8, wrapHost(inVec.data(), 1)});
+    nvcv::TensorWrapData imgOut(
+        nvcv::TensorDataStridedHost{shape, nvcv::TYPE_F32, wrapHost(outVec.data(), sizeof(float))});
+
+    cvcuda::ConvertTo convertToOp;
+    EXPECT_NO_THROW(convertToOp(nullptr, imgIn, imgOut, alpha, beta));
+
+    EXPECT_EQ(outVec, goldVec);
+}
+
+TEST_P(OpConvertTo, OpConvertTo_RGBA8toRGBAf32_channel_order)
+{
+    int    width  = GetParamValue<0>();
+    int    height = GetParamValue<1>();
+    double alpha  = GetParamValue<2>();
+    double beta   = GetParamValue<3>();
+    int    batch  = GetParamValue<4>();
+
+    // BGRA output from RGBA input
+    const int order[4] = {2, 1, 0, 3};
+
+    nvcv::Tensor imgIn(rgbaShape(batch, width, height), nvcv::TYPE_U8);
+    nvcv::Tensor imgOut(rgbaShape(batch, width, height), nvcv::TYPE_F32);
+
+    const auto *inData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgIn.exportData());
+    const auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgOut.exportData());
+    ASSERT_NE(nullptr, inData);
+    ASSERT_NE(nullptr, outData);
+
+    std::vector<uint8_t> inVec(inData->stride(0) * batch);
+    std::vector<uint8_t> outVec(outData->stride(0) * batch);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), inVec.data(), inVec.size(), cudaMemcpyHostToDevice));
+
+    cvcuda::ConvertTo convertToOp;
+    EXPECT_NO_THROW(convertToOp(nullptr, imgIn, imgOut, alpha, beta, NVCV_SWIZZLE_ZYXW));
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(outVec.data(), outData->basePtr(), outVec.size(), cudaMemcpyDeviceToHost));
+
+    for (int b = 0; b < batch; ++b)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                for (int c = 0; c < 4; ++c)
+                {
+                    uint8_t in   = inVec[b * inData->stride(0) + y * inData->stride(1) + x * inData->stride(2)
+                                       + order[c]];
+                    float   gold = static_cast<float>(alpha) * in + static_cast<float>(beta);
+                    float   out;
+                    std::memcpy(&out,
+                                &outVec[b * outData->stride(0) + y * outData->stride(1) + x * outData->stride(2)
+                                        + c * sizeof(float)],
+                                sizeof(float));
+                    EXPECT_FLOAT_EQ(gold, out);
+                }
+            }
+        }
+    }
+}
+
+TEST(OpConvertTo, host_channel_order_is_rejected)
+{
+    nvcv::TensorShape shape = rgbaShape(1, 2, 2);
+
+    std::vector<uint8_t> inVec(shape.size());
+    std::vector<float>   outVec(shape.size());
+
+    auto wrapHost = [&](void *ptr, int64_t elemBytes)
+    {
+        NVCVTensorBufferStrided buffer = {};
+        buffer.basePtr                 = reinterpret_cast<NVCVByte *>(ptr);
+        for (int d = shape.rank() - 1; d >= 0; --d)
+        {
+            buffer.strides[d] = d == shape.rank() - 1 ? elemBytes : buffer.strides[d + 1] * shape[d + 1];
+        }
+        return buffer;
+    };
+
+    nvcv::TensorWrapData imgIn(nvcv::TensorDataStridedHost{shape, nvcv::TYPE_U8, wrapHost(inVec.data(), 1)});
+    nvcv::TensorWrapData imgOut(
+        nvcv::TensorDataStridedHost{shape, nvcv::TYPE_F32, wrapHost(outVec.data(), sizeof(float))});
+
+    cvcuda::ConvertTo convertToOp;
+    EXPECT_THROW(convertToOp(nullptr, imgIn, imgOut, 1.0, 0.0, NVCV_SWIZZLE_ZYXW), nvcv::Exception);
+}
+
+TEST(OpConvertTo, per_channel_to_planar)
+{
+    const int batch = 2, width = 37, height = 11, channels = 3;
+
+    const std::vector<float> alphaVec = {1 / 58.4f, 1 / 57.1f, 1 / 57.4f};
+    const std::vector<float> betaVec  = {-123.7f / 58.4f, -116.3f / 57.1f, -103.5f / 57.4f};
+
+    nvcv::Tensor imgIn({{batch, height, width, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor imgOut({{batch, channels, height, width}, nvcv::TENSOR_NCHW}, nvcv::TYPE_F32);
+    nvcv::Tensor alpha({{channels}, "W"}, nvcv::TYPE_F32);
+    nvcv::Tensor beta({{1, 1, 1, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+
+    const auto *inData    = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgIn.exportData());
+    const auto *outData   = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgOut.exportData());
+    const auto *alphaData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(alpha.exportData());
+    const auto *betaData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(beta.exportData());
+    ASSERT_NE(nullptr, inData);
+    ASSERT_NE(nullptr, outData);
+    ASSERT_NE(nullptr, alphaData);
+    ASSERT_NE(nullptr, betaData);
+
+    std::vector<uint8_t> inVec(inData->stride(0) * batch);
+    std::vector<uint8_t> outVec(outData->stride(0) * batch);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), inVec.data(), inVec.size(), cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(alphaData->basePtr(), alphaVec.data(), channels * sizeof(float),
+                                      cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess,
+              cudaMemcpy(betaData->basePtr(), betaVec.data(), channels * sizeof(float), cudaMemcpyHostToDevice));
+
+    cvcuda::ConvertTo convertToOp;
+    EXPECT_NO_THROW(convertToOp(nullptr, imgIn, imgOut, alpha, beta));
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(outVec.data(), outData->basePtr(), outVec.size(), cudaMemcpyDeviceToHost));
+
+    for (int b = 0; b < batch; ++b)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                for (int c = 0; c < channels; ++c)
+                {
+                    uint8_t in   = inVec[b * inData->stride(0) + y * inData->stride(1) + x * inData->stride(2) + c];
+                    float   gold = alphaVec[c] * in + betaVec[c];
+                    float   out;
+                    std::memcpy(&out,
+                                &outVec[b * outData->stride(0) + c * outData->stride(1) + y * outData->stride(2)
+                                        + x * sizeof(float)],
+                                sizeof(float));
+                    EXPECT_NEAR(gold, out, 1e-5f);
+                }
+            }
+        }
+    }
+}
+
+TEST(OpConvertTo, per_channel_to_half)
+{
+    const int batch = 1, width = 16, height = 4, channels = 4;
+
+    const std::vector<float> alphaVec = {0.5f, 1.f, 2.f, -1.f};
+    const std::vector<float> betaVec  = {1.f, 0.f, -3.f, 255.f};
+
+    nvcv::Tensor imgIn(rgbaShape(batch, width, height), nvcv::TYPE_U8);
+    nvcv::Tensor imgOut(rgbaShape(batch, width, height), nvcv::TYPE_F16);
+    nvcv::Tensor alpha({{channels}, "W"}, nvcv::TYPE_F32);
+    nvcv::Tensor beta({{channels}, "W"}, nvcv::TYPE_F32);
+
+    const auto *inData    = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgIn.exportData());
+    const auto *outData   = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgOut.exportData());
+    const auto *alphaData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(alpha.exportData());
+    const auto *betaData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(beta.exportData());
+    ASSERT_NE(nullptr, inData);
+    ASSERT_NE(nullptr, outData);
+    ASSERT_NE(nullptr, alphaData);
+    ASSERT_NE(nullptr, betaData);
+
+    std::vector<uint8_t> inVec(inData->stride(0) * batch);
+    std::vector<uint8_t> outVec(outData->stride(0) * batch);
+
+    // Small integers are exact in half precision
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), inVec.data(), inVec.size(), cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(alphaData->basePtr(), alphaVec.data(), channels * sizeof(float),
+                                      cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess,
+              cudaMemcpy(betaData->basePtr(), betaVec.data(), channels * sizeof(float), cudaMemcpyHostToDevice));
+
+    cvcuda::ConvertTo convertToOp;
+    EXPECT_NO_THROW(convertToOp(nullptr, imgIn, imgOut, alpha, beta));
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(outVec.data(), outData->basePtr(), outVec.size(), cudaMemcpyDeviceToHost));
+
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            for (int c = 0; c < channels; ++c)
+            {
+                uint8_t  in = inVec[y * inData->stride(1) + x * inData->stride(2) + c];
+                uint16_t out;
+                std::memcpy(&out, &outVec[y * outData->stride(1) + x * outData->stride(2) + c * sizeof(uint16_t)],
+                            sizeof(uint16_t));
+                EXPECT_EQ(halfBits(alphaVec[c] * in + betaVec[c]), out);
+            }
+        }
+    }
+}
+
+TEST(OpConvertTo, per_channel_invalid_params_are_rejected)
+{
+    nvcv::Tensor imgIn(rgbaShape(1, 4, 4), nvcv::TYPE_U8);
+    nvcv::Tensor imgOut(rgbaShape(1, 4, 4), nvcv::TYPE_F32);
+    nvcv::Tensor alpha({{3}, "W"}, nvcv::TYPE_F32);
+    nvcv::Tensor beta({{4}, "W"}, nvcv::TYPE_F32);
+
+    cvcuda::ConvertTo convertToOp;
+    EXPECT_THROW(convertToOp(nullptr, imgIn, imgOut, alpha, beta), nvcv::Exception);
+    EXPECT_THROW(convertToOp(nullptr, imgOut, imgOut, beta, beta), nvcv::Exception);
+}
+
+TEST(OpConvertTo, multi_outputs)
+{
+    const int batch = 2, width = 23, height = 9, channels = 3;
+
+    // Planar float for a network and interleaved 8-bit BGR for an encoder, from the same RGB input
+    NVCVConvertToParams params[2] = {};
+    for (int c = 0; c < channels; ++c)
+    {
+        params[0].alpha[c] = 1 / 255.f * (c + 1);
+        params[0].beta[c]  = -0.5f * c;
+        params[1].alpha[c] = 1.f;
+        params[1].beta[c]  = 0.f;
+    }
+    params[0].channelOrder = NVCV_SWIZZLE_XYZW;
+    params[1].channelOrder = NVCV_SWIZZLE_ZYXW;
+
+    const int order[2][3] = {
+        {0, 1, 2},
+        {2, 1, 0}
+    };
+
+    nvcv::Tensor imgIn({{batch, height, width, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor imgPlanar({{batch, channels, height, width}, nvcv::TENSOR_NCHW}, nvcv::TYPE_F32);
+    nvcv::Tensor imgBGR({{batch, height, width, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    const auto *inData     = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgIn.exportData());
+    const auto *planarData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgPlanar.exportData());
+    const auto *bgrData    = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgBGR.exportData());
+    ASSERT_NE(nullptr, inData);
+    ASSERT_NE(nullptr, planarData);
+    ASSERT_NE(nullptr, bgrData);
+
+    std::vector<uint8_t> inVec(inData->stride(0) * batch);
+    std::vector<uint8_t> planarVec(planarData->stride(0) * batch);
+    std::vector<uint8_t> bgrVec(bgrData->stride(0) * batch);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), inVec.data(), inVec.size(), cudaMemcpyHostToDevice));
+
+    nvcv::ITensor    *outputs[2] = {&imgPlanar, &imgBGR};
+    cvcuda::ConvertTo convertToOp;
+    EXPECT_NO_THROW(convertToOp(nullptr, imgIn, outputs, params, 2));
+
+    ASSERT_EQ(cudaSuccess,
+              cudaMemcpy(planarVec.data(), planarData->basePtr(), planarVec.size(), cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(bgrVec.data(), bgrData->basePtr(), bgrVec.size(), cudaMemcpyDeviceToHost));
+
+    for (int b = 0; b < batch; ++b)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                const uint8_t *in = &inVec[b * inData->stride(0) + y * inData->stride(1) + x * inData->stride(2)];
+
+                for (int c = 0; c < channels; ++c)
+                {
+                    float gold = params[0].alpha[c] * in[order[0][c]] + params[0].beta[c];
+                    float out;
+                    std::memcpy(&out,
+                                &planarVec[b * planarData->stride(0) + c * planarData->stride(1)
+                                           + y * planarData->stride(2) + x * sizeof(float)],
+                                sizeof(float));
+                    EXPECT_NEAR(gold, out, 1e-5f);
+
+                    EXPECT_EQ(in[order[1][c]],
+                              bgrVec[b * bgrData->stride(0) + y * bgrData->stride(1) + x * bgrData->stride(2) + c]);
+                }
+            }
+        }
+    }
+}
+
+TEST(OpConvertTo, multi_invalid_outputs_are_rejected)
+{
+    nvcv::Tensor imgIn(rgbaShape(1, 4, 4), nvcv::TYPE_U8);
+    nvcv::Tensor imgOut(rgbaShape(1, 4, 4), nvcv::TYPE_F32);
+    nvcv::Tensor imgSmall(rgbaShape(1, 4, 2), nvcv::TYPE_F32);
+
+    NVCVConvertToParams params[2] = {};
+    params[0].channelOrder = params[1].channelOrder = NVCV_SWIZZLE_XYZW;
+
+    cvcuda::ConvertTo convertToOp;
+
+    nvcv::ITensor *wrongShape[2] = {&imgOut, &imgSmall};
+    EXPECT_THROW(convertToOp(nullptr, imgIn, wrongShape, params, 2), nvcv::Exception);
+
+    // Outputs written over the input would change what the other outputs read
+    nvcv::ITensor *inPlace[2] = {&imgOut, &imgIn};
+    EXPECT_THROW(convertToOp(nullptr, imgIn, inPlace, params, 2), nvcv::Exception);
+
+    EXPECT_THROW(convertToOp(nullptr, imgIn, wrongShape, params, 0), nvcv::Exception);
+}
@@ -651,3 +651,86 @@ TEST_P(OpCopyMakeBorder, stack_correct_output)
         StartTestStack<float>(srcWidth, srcHeight, numBatches, topPad, bottomPad, leftPad, rightPad, borderType,
                               borderValue, format);
 }
+
+TEST(OpCopyMakeBorder, stack_per_sample_border_values)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int         numBatches = 3, dstWidth = 48, dstHeight = 40;
+    nvcv::ImageFormat format     = nvcv::FMT_RGBA8;
+
+    const std::vector<int>    topVec{0, 7, 12}, leftVec{4, 0, 9};
+    const std::vector<float4> valueVec{{114, 114, 114, 255}, {0, 64, 128, 192}, {255, 10, 20, 30}};
+
+    std::default_random_engine             randEng{0};
+    std::uniform_int_distribution<uint8_t> srcRand{0u, 255u};
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrcVec;
+    std::vector<std::vector<uint8_t>>         hImgSrcVec;
+    for (nvcv::Size2D size : {nvcv::Size2D{44, 30}, nvcv::Size2D{32, 33}, nvcv::Size2D{20, 25}})
+    {
+        imgSrcVec.emplace_back(std::make_unique<nvcv::Image>(size, format));
+
+        auto *imgSrcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrcVec.back()->exportData());
+        ASSERT_NE(nullptr, imgSrcData);
+
+        std::vector<uint8_t> srcVec(imgSrcData->plane(0).rowStride * size.h);
+        std::generate(srcVec.begin(), srcVec.end(), [&]() { return srcRand(randEng); });
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy(imgSrcData->plane(0).basePtr, srcVec.data(), srcVec.size(), cudaMemcpyHostToDevice));
+        hImgSrcVec.push_back(std::move(srcVec));
+    }
+
+    nvcv::ImageBatchVarShape imgBatchSrc(numBatches);
+    imgBatchSrc.pushBack(imgSrcVec.begin(), imgSrcVec.end());
+
+    nvcv::Tensor inTop(1, {numBatches, 1}, nvcv::FMT_S32);
+    nvcv::Tensor inLeft(1, {numBatches, 1}, nvcv::FMT_S32);
+    nvcv::Tensor inValues(numBatches, {1, 1}, nvcv::FMT_RGBAf32);
+
+    const auto *inTopData    = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inTop.exportData());
+    const auto *inLeftData   = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inLeft.exportData());
+    const auto *inValuesData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inValues.exportData());
+    ASSERT_NE(nullptr, inTopData);
+    ASSERT_NE(nullptr, inLeftData);
+    ASSERT_NE(nullptr, inValuesData);
+
+    ASSERT_EQ(cudaSuccess,
+              cudaMemcpy(inTopData->basePtr(), topVec.data(), numBatches * sizeof(int), cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess,
+              cudaMemcpy(inLeftData->basePtr(), leftVec.data(), numBatches * sizeof(int), cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(inValuesData->basePtr(), inValuesData->stride(0), valueVec.data(),
+                                        sizeof(float4), sizeof(float4), numBatches, cudaMemcpyHostToDevice));
+
+    nvcv::Tensor imgDst(numBatches, {dstWidth, dstHeight}, format);
+    const auto  *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, dstData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    int sampleSize = dstAccess->sampleStride();
+    int dstBufSize = sampleSize * numBatches;
+    ASSERT_EQ(cudaSuccess, cudaMemsetAsync(dstData->basePtr(), 0, dstBufSize, stream));
+
+    cvcuda::CopyMakeBorder cpyMakeBorderOp;
+
+    EXPECT_NO_THROW(cpyMakeBorderOp(stream, imgBatchSrc, imgDst, inTop, inLeft, NVCV_BORDER_CONSTANT, inValues));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<uint8_t> testVec(dstBufSize);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), dstData->basePtr(), dstBufSize, cudaMemcpyDeviceToHost));
+
+    // Each sample must match stacking the whole batch with the border value of that sample
+    std::vector<uint8_t> goldVec(dstBufSize);
+    for (int b = 0; b < numBatches; ++b)
+    {
+        CopyMakeBorder(goldVec, hImgSrcVec, *dstAccess, imgSrcVec, topVec, leftVec, NVCV_BORDER_CONSTANT, valueVec[b]);
+
+        EXPECT_TRUE(std::equal(goldVec.begin() + b * sampleSize, goldVec.begin() + (b + 1) * sampleSize,
+                               testVec.begin() + b * sampleSize))
+            << "at sample " << b;
+    }
+}
@@ -0,0 +1,560 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpCropResize.hpp>
+#include <cvcuda/OpCustomCrop.hpp>
+#include <cvcuda/OpResize.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+// Crops one box out of a packed HWC sample and resizes it to the output size, then flips it, the same way as
+// cvcuda::CropResize. Boxes outside of the source give zeros.
+void CropResize(std::vector<uint8_t> &hDst, nvcv::Size2D dstSize, const std::vector<uint8_t> &hSrc,
+                nvcv::Size2D srcSize, int channels, const float *box, NVCVInterpolationType interp,
+                int flipCode = 2)
+{
+    const float x1 = box[0], y1 = box[1], x2 = box[2], y2 = box[3];
+
+    const int loX = std::max(0, static_cast<int>(std::floor(x1)));
+    const int loY = std::max(0, static_cast<int>(std::floor(y1)));
+    const int hiX = std::min(srcSize.w, static_cast<int>(std::ceil(x2)));
+    const int hiY = std::min(srcSize.h, static_cast<int>(std::ceil(y2)));
+
+    hDst.assign(dstSize.w * dstSize.h * channels, 0);
+    if (hiX <= loX || hiY <= loY)
+    {
+        return;
+    }
+
+    const int width = hiX - loX, height = hiY - loY;
+
+    const float scaleX = (x2 - x1) / dstSize.w;
+    const float scaleY = (y2 - y1) / dstSize.h;
+    const float offX   = x1 - loX;
+    const float offY   = y1 - loY;
+
+    auto at = [&](int y, int x, int c)
+    {
+        return static_cast<float>(hSrc[((loY + y) * srcSize.w + loX + x) * channels + c]);
+    };
+
+    for (int dy = 0; dy < dstSize.h; ++dy)
+    {
+        for (int dx = 0; dx < dstSize.w; ++dx)
+        {
+            const int x = (flipCode == 1 || flipCode == -1) ? dstSize.w - 1 - dx : dx;
+            const int y = (flipCode == 0 || flipCode == -1) ? dstSize.h - 1 - dy : dy;
+
+            for (int c = 0; c < channels; ++c)
+            {
+                float value;
+
+                if (interp == NVCV_INTERP_NEAREST)
+                {
+                    int sx = std::max(0, std::min(static_cast<int>(std::floor(offX + x * scaleX)), width - 1));
+                    int sy = std::max(0, std::min(static_cast<int>(std::floor(offY + y * scaleY)), height - 1));
+                    value  = at(sy, sx, c);
+                }
+                else if (interp == NVCV_INTERP_AREA)
+                {
+                    // footprint of the output pixel, at least one source pixel wide, clipped to the window
+                    const float fw = std::max(scaleX, 1.f), fh = std::max(scaleY, 1.f);
+                    const float cx = offX + (x + 0.5f) * scaleX, cy = offY + (y + 0.5f) * scaleY;
+
+                    float ax = std::max(cx - fw / 2, 0.f), bx = std::min(cx + fw / 2, static_cast<float>(width));
+                    float ay = std::max(cy - fh / 2, 0.f), by = std::min(cy + fh / 2, static_cast<float>(height));
+                    if (bx <= ax)
+                    {
+                        ax = std::min(std::floor(ax), width - 1.f);
+                        bx = ax + 1;
+                    }
+                    if (by <= ay)
+                    {
+                        ay = std::min(std::floor(ay), height - 1.f);
+                        by = ay + 1;
+                    }
+
+                    float sum = 0;
+                    for (int sy = std::floor(ay); sy < std::ceil(by); ++sy)
+                    {
+                        for (int sx = std::floor(ax); sx < std::ceil(bx); ++sx)
+                        {
+                            const float wx = std::min(bx, sx + 1.f) - std::max(ax, static_cast<float>(sx));
+                            const float wy = std::min(by, sy + 1.f) - std::max(ay, static_cast<float>(sy));
+                            sum += at(sy, sx, c) * wx * wy;
+                        }
+                    }
+                    value = sum / ((bx - ax) * (by - ay));
+                }
+                else
+                {
+                    float fy = (y + 0.5f) * scaleY - 0.5f + offY;
+                    int   sy = static_cast<int>(std::floor(fy));
+                    fy -= sy;
+                    fy *= (sy >= 0 && sy < height - 1);
+                    sy = std::max(0, std::min(sy, height - 2));
+
+                    float fx = (x + 0.5f) * scaleX - 0.5f + offX;
+                    int   sx = static_cast<int>(std::floor(fx));
+                    fx -= sx;
+                    fx *= (sx >= 0 && sx < width - 1);
+                    sx = std::max(0, std::min(sx, width - 2));
+
+                    int sy1 = std::min(sy + 1, height - 1);
+                    int sx1 = std::min(sx + 1, width - 1);
+
+                    value = (1.f - fx) * (at(sy, sx, c) * (1.f - fy) + at(sy1, sx, c) * fy)
+                          + fx * (at(sy, sx1, c) * (1.f - fy) + at(sy1, sx1, c) * fy);
+                }
+
+                hDst[(dy * dstSize.w + dx) * channels + c]
+                    = static_cast<uint8_t>(std::clamp(std::rint(value), 0.f, 255.f));
+            }
+        }
+    }
+}
+
+// Creates a [N, 4] or [N, 5] float tensor holding the boxes.
+std::unique_ptr<nvcv::Tensor> CreateBoxes(const std::vector<std::vector<float>> &hBoxes)
+{
+    int  numCoords = hBoxes.empty() ? 4 : hBoxes[0].size();
+    auto boxes     = std::make_unique<nvcv::Tensor>(
+        nvcv::TensorShape{{static_cast<int64_t>(hBoxes.size()), numCoords}, nvcv::TENSOR_NW}, nvcv::TYPE_F32);
+
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(boxes->exportData());
+    EXPECT_NE(nullptr, data);
+
+    for (size_t i = 0; i < hBoxes.size(); ++i)
+    {
+        EXPECT_EQ(cudaSuccess, cudaMemcpy(data->basePtr() + i * data->stride(0), hBoxes[i].data(),
+                                          numCoords * sizeof(float), cudaMemcpyHostToDevice));
+    }
+
+    return boxes;
+}
+
+std::vector<std::vector<uint8_t>> CopyToHost(nvcv::Tensor &tensor)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    EXPECT_NE(nullptr, data);
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    EXPECT_TRUE(access);
+
+    int rowStride = access->numCols() * access->colStride();
+
+    std::vector<std::vector<uint8_t>> hData(access->numSamples());
+    for (int i = 0; i < access->numSamples(); ++i)
+    {
+        hData[i].resize(access->numRows() * rowStride);
+        EXPECT_EQ(cudaSuccess, cudaMemcpy2D(hData[i].data(), rowStride, access->sampleData(i), access->rowStride(),
+                                            rowStride, access->numRows(), cudaMemcpyDeviceToHost));
+    }
+    return hData;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpCropResize, test::ValueList<int, int, int, int, int, nvcv::ImageFormat, NVCVInterpolationType, bool>
+{
+    // srcWidth, srcHeight, numImages, dstWidth, dstHeight,          format,       interpolation, sampleIdx
+    {       160,       120,         1,       32,        32,   nvcv::FMT_RGB8,  NVCV_INTERP_LINEAR,     false },
+    {       160,       120,         3,       24,        16,  nvcv::FMT_RGBA8,  NVCV_INTERP_LINEAR,      true },
+    {        64,        48,         2,       40,        40,    nvcv::FMT_U8,  NVCV_INTERP_NEAREST,      true },
+    {        97,        33,         1,       16,         8,  nvcv::FMT_RGBA8, NVCV_INTERP_NEAREST,     false },
+    {        50,        70,         4,       64,        48,   nvcv::FMT_RGB8,  NVCV_INTERP_LINEAR,      true },
+    {       320,       240,         1,       20,        20,   nvcv::FMT_RGB8,    NVCV_INTERP_AREA,     false },
+    {        64,        48,         3,       48,        40,  nvcv::FMT_RGBA8,    NVCV_INTERP_AREA,      true }
+});
+
+// clang-format on
+
+TEST_P(OpCropResize, correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int                   srcWidth  = GetParamValue<0>();
+    int                   srcHeight = GetParamValue<1>();
+    int                   numImages = GetParamValue<2>();
+    int                   dstWidth  = GetParamValue<3>();
+    int                   dstHeight = GetParamValue<4>();
+    nvcv::ImageFormat     fmt       = GetParamValue<5>();
+    NVCVInterpolationType interp    = GetParamValue<6>();
+    bool                  sampleIdx = GetParamValue<7>();
+
+    int channels = fmt.numChannels();
+
+    std::default_random_engine rng;
+
+    nvcv::Tensor imgSrc  = test::CreateTensor(numImages, srcWidth, srcHeight, fmt);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<std::vector<uint8_t>> srcVec(numImages);
+    int                               srcVecRowStride = srcWidth * channels;
+    for (int i = 0; i < numImages; ++i)
+    {
+        std::uniform_int_distribution<int> udist(0, 255);
+
+        srcVec[i].resize(srcHeight * srcVecRowStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return udist(rng); });
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(),
+                                            srcVecRowStride, srcVecRowStride, srcHeight, cudaMemcpyHostToDevice));
+    }
+
+    // Integer and fractional boxes, including the whole image, single pixels, boxes partly and fully
+    // outside of the image and, with sample indices, a box referring to a sample that doesn't exist.
+    std::vector<std::vector<float>> hBoxes = {
+        {0, 0, static_cast<float>(srcWidth), static_cast<float>(srcHeight)},
+        {            4,             2,            20,            34},
+        {         3.5f,         7.25f,        41.75f,         19.5f},
+        {            5,             5,             6,             6},
+        {          -10,            -4,            12,            10},
+        {srcWidth - 8.f, srcHeight - 6.f, srcWidth + 8.f, srcHeight + 6.f},
+        {srcWidth + 1.f,             0, srcWidth + 9.f,             9}
+    };
+
+    std::uniform_int_distribution<int> sdist(0, numImages - 1);
+    std::uniform_real_distribution<float> xdist(0, srcWidth), ydist(0, srcHeight);
+    for (int i = 0; i < 10; ++i)
+    {
+        float x1 = xdist(rng), x2 = xdist(rng), y1 = ydist(rng), y2 = ydist(rng);
+        hBoxes.push_back({std::min(x1, x2), std::min(y1, y2), std::max(x1, x2) + 1, std::max(y1, y2) + 1});
+    }
+
+    std::vector<int> boxSample(hBoxes.size());
+    for (size_t b = 0; b < hBoxes.size(); ++b)
+    {
+        boxSample[b] = sampleIdx ? sdist(rng) : (numImages == 1 ? 0 : b % numImages);
+        if (sampleIdx)
+        {
+            hBoxes[b].insert(hBoxes[b].begin(), static_cast<float>(boxSample[b]));
+        }
+    }
+    if (sampleIdx)
+    {
+        hBoxes.push_back({static_cast<float>(numImages), 0, 0, 8, 8});
+        boxSample.push_back(-1);
+    }
+    else if (numImages != 1)
+    {
+        // one sample per box
+        hBoxes.resize(numImages);
+        boxSample.resize(numImages);
+    }
+
+    int numBoxes = hBoxes.size();
+
+    auto         boxes  = CreateBoxes(hBoxes);
+    nvcv::Tensor imgDst = test::CreateTensor(numBoxes, dstWidth, dstHeight, fmt);
+
+    cvcuda::CropResize op;
+    EXPECT_NO_THROW(op(stream, imgSrc, *boxes, imgDst, interp));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<std::vector<uint8_t>> testVec = CopyToHost(imgDst);
+    ASSERT_EQ(numBoxes, static_cast<int>(testVec.size()));
+
+    for (int b = 0; b < numBoxes; ++b)
+    {
+        SCOPED_TRACE(b);
+
+        std::vector<uint8_t> goldVec(dstWidth * dstHeight * channels, 0);
+        if (boxSample[b] >= 0)
+        {
+            CropResize(goldVec, {dstWidth, dstHeight}, srcVec[boxSample[b]], {srcWidth, srcHeight}, channels,
+                       hBoxes[b].data() + (sampleIdx ? 1 : 0), interp);
+        }
+
+        for (size_t k = 0; k < goldVec.size(); ++k)
+        {
+            ASSERT_LE(std::abs(static_cast<int>(goldVec[k]) - static_cast<int>(testVec[b][k])), 1) << "at " << k;
+        }
+    }
+}
+
+// Resize doesn't clamp the vertical weight of the first and last rows when upscaling, only compare downscales.
+TEST(OpCropResize, matches_custom_crop_and_resize)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    nvcv::Tensor imgSrc  = test::CreateTensor(1, 128, 96, fmt);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+
+    std::default_random_engine          rng;
+    std::uniform_int_distribution<int>  udist(0, 255);
+    std::vector<uint8_t>                srcVec(srcData->stride(0));
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return udist(rng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), srcVec.size(), cudaMemcpyHostToDevice));
+
+    const std::vector<NVCVRectI> rects = {
+        { 0,  0, 64, 64},
+        {10, 20, 64, 48},
+        {50,  7, 77, 88},
+        {96, 64, 32, 32}
+    };
+    const nvcv::Size2D dstSize{32, 32};
+
+    std::vector<std::vector<float>> hBoxes;
+    for (const NVCVRectI &rc : rects)
+    {
+        hBoxes.push_back({static_cast<float>(rc.x), static_cast<float>(rc.y), static_cast<float>(rc.x + rc.width),
+                          static_cast<float>(rc.y + rc.height)});
+    }
+
+    for (NVCVInterpolationType interp : {NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR})
+    {
+        SCOPED_TRACE(interp);
+
+        auto         boxes  = CreateBoxes(hBoxes);
+        nvcv::Tensor imgDst = test::CreateTensor(rects.size(), dstSize.w, dstSize.h, fmt);
+
+        cvcuda::CropResize cropResizeOp;
+        EXPECT_NO_THROW(cropResizeOp(stream, imgSrc, *boxes, imgDst, interp));
+
+        cvcuda::CustomCrop cropOp;
+        cvcuda::Resize     resizeOp;
+
+        std::vector<std::vector<uint8_t>> goldVec;
+        for (const NVCVRectI &rc : rects)
+        {
+            nvcv::Tensor imgCrop = test::CreateTensor(1, rc.width, rc.height, fmt);
+            nvcv::Tensor imgGold = test::CreateTensor(1, dstSize.w, dstSize.h, fmt);
+            EXPECT_NO_THROW(cropOp(stream, imgSrc, imgCrop, rc));
+            EXPECT_NO_THROW(resizeOp(stream, imgCrop, imgGold, interp));
+            ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+            goldVec.push_back(CopyToHost(imgGold)[0]);
+        }
+
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        std::vector<std::vector<uint8_t>> testVec = CopyToHost(imgDst);
+
+        for (size_t b = 0; b < rects.size(); ++b)
+        {
+            SCOPED_TRACE(b);
+            for (size_t k = 0; k < goldVec[b].size(); ++k)
+            {
+                ASSERT_LE(std::abs(static_cast<int>(goldVec[b][k]) - static_cast<int>(testVec[b][k])), 1)
+                    << "at " << k;
+            }
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpCropResize, varshape_with_flips)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt       = nvcv::FMT_RGB8;
+    const int               channels  = fmt.numChannels();
+    const int               numImages = 4;
+    const nvcv::Size2D      dstSize{48, 40};
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> udist(0, 255), sizeDist(30, 200);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    std::vector<std::vector<uint8_t>>         srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        nvcv::Size2D size{sizeDist(rng), sizeDist(rng)};
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+
+        int rowStride = size.w * channels;
+        srcVec[i].resize(size.h * rowStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return udist(rng); });
+
+        auto *imgData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(imgData, nullptr);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(imgData->plane(0).basePtr, imgData->plane(0).rowStride, srcVec[i].data(),
+                                            rowStride, rowStride, size.h, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    // Two boxes per image, in its own coordinates, with every flip code
+    std::vector<std::vector<float>> hBoxes;
+    std::vector<int>                hFlips;
+    for (int i = 0; i < numImages; ++i)
+    {
+        const float w = imgSrc[i]->size().w, h = imgSrc[i]->size().h;
+        hBoxes.push_back({static_cast<float>(i), 0, 0, w, h});
+        hBoxes.push_back({static_cast<float>(i), w / 4, h / 3, w - 1.5f, h});
+        hFlips.push_back(i - 1);
+        hFlips.push_back(2 - i);
+    }
+    const int numBoxes = hBoxes.size();
+
+    auto         boxes = CreateBoxes(hBoxes);
+    nvcv::Tensor flipCode({{numBoxes}, "N"}, nvcv::TYPE_S32);
+    {
+        auto *dev = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(flipCode.exportData());
+        ASSERT_NE(dev, nullptr);
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy(dev->basePtr(), hFlips.data(), hFlips.size() * sizeof(int), cudaMemcpyHostToDevice));
+    }
+
+    cvcuda::CropResize op;
+    for (NVCVInterpolationType interp : {NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR, NVCV_INTERP_AREA})
+    {
+        SCOPED_TRACE(interp);
+
+        nvcv::Tensor imgDst = test::CreateTensor(numBoxes, dstSize.w, dstSize.h, fmt);
+        EXPECT_NO_THROW(op(stream, batchSrc, *boxes, &flipCode, imgDst, interp));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        std::vector<std::vector<uint8_t>> testVec = CopyToHost(imgDst);
+        for (int b = 0; b < numBoxes; ++b)
+        {
+            SCOPED_TRACE(b);
+
+            const int            i = b / 2;
+            std::vector<uint8_t> goldVec;
+            CropResize(goldVec, dstSize, srcVec[i], imgSrc[i]->size(), channels, hBoxes[b].data() + 1, interp,
+                       hFlips[b]);
+
+            for (size_t k = 0; k < goldVec.size(); ++k)
+            {
+                ASSERT_LE(std::abs(static_cast<int>(goldVec[k]) - static_cast<int>(testVec[b][k])), 1)
+                    << "at " << k;
+            }
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+// Area is the default antialiasing resize, integer downscales match it.
+TEST(OpCropResize, area_matches_resize_for_integer_downscales)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    nvcv::Tensor imgSrc  = test::CreateTensor(1, 128, 96, fmt);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> udist(0, 255);
+    std::vector<uint8_t>               srcVec(srcData->stride(0));
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return udist(rng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), srcVec.size(), cudaMemcpyHostToDevice));
+
+    for (nvcv::Size2D dstSize : {nvcv::Size2D{64, 48}, nvcv::Size2D{32, 24}, nvcv::Size2D{16, 12}})
+    {
+        SCOPED_TRACE(dstSize.w);
+
+        auto         boxes   = CreateBoxes({{0, 0, 128, 96}});
+        nvcv::Tensor imgDst  = test::CreateTensor(1, dstSize.w, dstSize.h, fmt);
+        nvcv::Tensor imgGold = test::CreateTensor(1, dstSize.w, dstSize.h, fmt);
+
+        cvcuda::CropResize cropResizeOp;
+        cvcuda::Resize     resizeOp;
+        EXPECT_NO_THROW(cropResizeOp(stream, imgSrc, *boxes, imgDst, NVCV_INTERP_AREA));
+        EXPECT_NO_THROW(resizeOp(stream, imgSrc, imgGold, NVCV_INTERP_AREA));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        std::vector<uint8_t> goldVec = CopyToHost(imgGold)[0];
+        std::vector<uint8_t> testVec = CopyToHost(imgDst)[0];
+        for (size_t k = 0; k < goldVec.size(); ++k)
+        {
+            ASSERT_LE(std::abs(static_cast<int>(goldVec[k]) - static_cast<int>(testVec[k])), 1) << "at " << k;
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpCropResize, invalid_arguments)
+{
+    nvcv::Tensor imgSrc = test::CreateTensor(2, 64, 48, nvcv::FMT_RGB8);
+    nvcv::Tensor imgDst = test::CreateTensor(3, 16, 16, nvcv::FMT_RGB8);
+
+    auto boxes4 = CreateBoxes({{0, 0, 8, 8}, {0, 0, 8, 8}, {0, 0, 8, 8}});
+    auto boxes5 = CreateBoxes({{0, 0, 0, 8, 8}, {1, 0, 0, 8, 8}, {0, 0, 0, 8, 8}});
+    auto boxes2 = CreateBoxes({{0, 0, 0, 8, 8}, {1, 0, 0, 8, 8}});
+
+    nvcv::Tensor imgF32 = test::CreateTensor(3, 16, 16, nvcv::FMT_RGBf32);
+
+    cvcuda::CropResize op;
+    EXPECT_NO_THROW(op(nullptr, imgSrc, *boxes5, imgDst, NVCV_INTERP_LINEAR));
+    // boxes without index need one sample per box, or a single sample
+    EXPECT_THROW(op(nullptr, imgSrc, *boxes4, imgDst, NVCV_INTERP_LINEAR), nvcv::Exception);
+    // one output sample per box
+    EXPECT_THROW(op(nullptr, imgSrc, *boxes2, imgDst, NVCV_INTERP_LINEAR), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, imgSrc, *boxes5, imgF32, NVCV_INTERP_LINEAR), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, imgSrc, *boxes5, imgDst, NVCV_INTERP_CUBIC), nvcv::Exception);
+
+    std::vector<std::unique_ptr<nvcv::Image>> images;
+    nvcv::ImageBatchVarShape                  batch(2);
+    for (nvcv::ImageFormat fmt : {nvcv::FMT_RGB8, nvcv::FMT_RGBA8})
+    {
+        images.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{32, 24}, fmt));
+    }
+    batch.pushBack(*images[0]);
+    batch.pushBack(*images[0]);
+
+    nvcv::Tensor flipCode({{3}, "N"}, nvcv::TYPE_S32);
+    nvcv::Tensor flipCodeShort({{2}, "N"}, nvcv::TYPE_S32);
+    nvcv::Tensor flipCodeU8({{3}, "N"}, nvcv::TYPE_U8);
+
+    EXPECT_NO_THROW(op(nullptr, batch, *boxes5, &flipCode, imgDst, NVCV_INTERP_AREA));
+    EXPECT_NO_THROW(op(nullptr, batch, *boxes5, nullptr, imgDst, NVCV_INTERP_LINEAR));
+    // one flip code per box
+    EXPECT_THROW(op(nullptr, batch, *boxes5, &flipCodeShort, imgDst, NVCV_INTERP_LINEAR), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, batch, *boxes5, &flipCodeU8, imgDst, NVCV_INTERP_LINEAR), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, batch, *boxes4, nullptr, imgDst, NVCV_INTERP_LINEAR), nvcv::Exception);
+    // images must all have the same format
+    batch.pushBack(*images[1]);
+    EXPECT_THROW(op(nullptr, batch, *boxes5, nullptr, imgDst, NVCV_INTERP_LINEAR), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
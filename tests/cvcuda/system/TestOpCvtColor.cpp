@@ -21,12 +21,18 @@
 #include <common/TensorDataUtils.hpp>
 #include <common/ValueTests.hpp>
 #include <cvcuda/OpCvtColor.hpp>
+#include <cvcuda/Operator.h>
+#include <nvcv/ColorSpec.hpp>
 #include <nvcv/Image.hpp>
 #include <nvcv/ImageBatch.hpp>
 #include <nvcv/Tensor.hpp>
 #include <nvcv/TensorDataAccess.hpp>
 #include <nvcv/cuda/TypeTraits.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <cfloat>
+#include <cmath>
 #include <random>
 
 namespace test = nvcv::test;
@@ -65,6 +71,8 @@ test::ValueList<int, int, int, NVCVImageFormat, NVCVImageFormat, NVCVColorConver
     {  42, 111,  2,  NVCV_IMAGE_FORMAT_BGRf32, NVCV_IMAGE_FORMAT_RGBAf32,     NVCV_COLOR_BGR2RGBA,      NVCV_COLOR_RGBA2BGR,   0.0},
     {  21,  72,  2,  NVCV_IMAGE_FORMAT_RGBf32, NVCV_IMAGE_FORMAT_BGRAf32,     NVCV_COLOR_RGB2BGRA,      NVCV_COLOR_BGRA2RGB,   0.0},
     {  23,  31,  3, NVCV_IMAGE_FORMAT_RGBAf32, NVCV_IMAGE_FORMAT_BGRAf32,    NVCV_COLOR_RGBA2BGRA,     NVCV_COLOR_BGRA2RGBA,   0.0},
+    {  16,  12, 90,    NVCV_IMAGE_FORMAT_BGR8,   NVCV_IMAGE_FORMAT_RGBA8,     NVCV_COLOR_BGR2RGBA,      NVCV_COLOR_RGBA2BGR,   0.0},
+    {  48,  40, 50,      NVCV_IMAGE_FORMAT_Y8,    NVCV_IMAGE_FORMAT_BGR8,     NVCV_COLOR_GRAY2BGR,      NVCV_COLOR_BGR2GRAY,   0.0},
     // Codes 9 to 39 are not implemented
     {  55, 257,  4,    NVCV_IMAGE_FORMAT_BGR8,   NVCV_IMAGE_FORMAT_HSV8,       NVCV_COLOR_BGR2HSV,       NVCV_COLOR_HSV2BGR,   5.0},
     { 366,  14,  5,    NVCV_IMAGE_FORMAT_RGB8,   NVCV_IMAGE_FORMAT_HSV8,       NVCV_COLOR_RGB2HSV,       NVCV_COLOR_HSV2RGB,   5.0},
@@ -96,12 +104,6 @@ test::ValueList<int, int, int, NVCVImageFormat, NVCVImageFormat, NVCVColorConver
     // Code 148 is not implemented
 });
 
-#undef NVCV_IMAGE_FORMAT_Y16
-#undef NVCV_IMAGE_FORMAT_BGR16
-#undef NVCV_IMAGE_FORMAT_RGB16
-#undef NVCV_IMAGE_FORMAT_YUV8
-#undef NVCV_IMAGE_FORMAT_NV21
-
 // clang-format on
 
 TEST_P(OpCvtColor, correct_output)
@@ -173,6 +175,225 @@ TEST_P(OpCvtColor, correct_output)
     VEC_EXPECT_NEAR(testVec, srcVec, maxDiff);
 }
 
+namespace {
+
+// Host reference of the 8-bit conversions of a single pixel, as done by the 8-bit kernels.
+void CvtColorPixel8u(NVCVColorConversionCode code, const uint8_t *src, uint8_t *dst)
+{
+    auto descale = [](int x, int n) { return (x + (1 << (n - 1))) >> n; };
+    auto sat     = [](int x) { return static_cast<uint8_t>(std::clamp(x, 0, 255)); };
+
+    switch (code)
+    {
+    case NVCV_COLOR_GRAY2BGR:
+    case NVCV_COLOR_GRAY2BGRA:
+        dst[0] = dst[1] = dst[2] = src[0];
+        if (code == NVCV_COLOR_GRAY2BGRA)
+        {
+            dst[3] = src[0];
+        }
+        break;
+    case NVCV_COLOR_BGR2GRAY:
+    case NVCV_COLOR_RGB2GRAY:
+    case NVCV_COLOR_BGRA2GRAY:
+    case NVCV_COLOR_RGBA2GRAY:
+    {
+        int bidx = (code == NVCV_COLOR_RGB2GRAY || code == NVCV_COLOR_RGBA2GRAY) ? 2 : 0;
+        dst[0]   = descale(src[bidx] * 3735 + src[1] * 19235 + src[bidx ^ 2] * 9798, 15);
+    }
+    break;
+    case NVCV_COLOR_BGR2YUV:
+    case NVCV_COLOR_RGB2YUV:
+    {
+        int bidx = code == NVCV_COLOR_BGR2YUV ? 0 : 2;
+        int B = src[bidx], G = src[1], R = src[bidx ^ 2];
+        int Y  = descale(R * 4899 + G * 9617 + B * 1868, 14);
+        dst[0] = sat(Y);
+        dst[1] = sat(descale((B - Y) * 8061 + (128 << 14), 14));
+        dst[2] = sat(descale((R - Y) * 14369 + (128 << 14), 14));
+    }
+    break;
+    case NVCV_COLOR_YUV2BGR:
+    case NVCV_COLOR_YUV2RGB:
+    {
+        int bidx = code == NVCV_COLOR_YUV2BGR ? 0 : 2;
+        int Y = src[0], Cb = src[1] - 128, Cr = src[2] - 128;
+        dst[bidx]     = sat(Y + descale(Cb * 33292, 14));
+        dst[1]        = sat(Y + descale(Cb * -6472 + Cr * -9519, 14));
+        dst[bidx ^ 2] = sat(Y + descale(Cr * 18678, 14));
+    }
+    break;
+    default:
+    {
+        // BGR <-> RGB, with alpha added or removed
+        int sch  = (code == NVCV_COLOR_BGRA2BGR || code == NVCV_COLOR_RGBA2BGR || code == NVCV_COLOR_BGRA2RGBA) ? 4 : 3;
+        int dch  = (code == NVCV_COLOR_BGR2BGRA || code == NVCV_COLOR_BGR2RGBA || code == NVCV_COLOR_BGRA2RGBA) ? 4 : 3;
+        int bidx = (code == NVCV_COLOR_BGR2RGB || code == NVCV_COLOR_RGBA2BGR || code == NVCV_COLOR_BGRA2RGBA
+                    || code == NVCV_COLOR_BGR2RGBA)
+                     ? 2
+                     : 0;
+        dst[0] = src[bidx];
+        dst[1] = src[1];
+        dst[2] = src[bidx ^ 2];
+        if (dch == 4)
+        {
+            dst[3] = sch == 4 ? src[3] : 255;
+        }
+    }
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpCvtColor8u,
+test::ValueList<int, int, int, NVCVImageFormat, NVCVImageFormat, NVCVColorConversionCode>
+{
+    // Widths multiple of 4 use the 4 pixels per thread kernels, the others have partial groups or unaligned rows
+    //  W,   H,  N,           inputFormat,            outputFormat,                 code
+    { 128,  33,  2,   NVCV_IMAGE_FORMAT_BGR8,   NVCV_IMAGE_FORMAT_RGB8,   NVCV_COLOR_BGR2RGB},
+    { 131,  33,  2,   NVCV_IMAGE_FORMAT_BGR8,   NVCV_IMAGE_FORMAT_RGB8,   NVCV_COLOR_BGR2RGB},
+    {  64,  17,  3,   NVCV_IMAGE_FORMAT_BGR8,  NVCV_IMAGE_FORMAT_RGBA8,  NVCV_COLOR_BGR2RGBA},
+    {  66,  17,  3,  NVCV_IMAGE_FORMAT_RGBA8,   NVCV_IMAGE_FORMAT_BGR8,  NVCV_COLOR_RGBA2BGR},
+    {  93,  21,  1,  NVCV_IMAGE_FORMAT_RGBA8,  NVCV_IMAGE_FORMAT_BGRA8, NVCV_COLOR_RGBA2BGRA},
+    { 100,  12,  2,   NVCV_IMAGE_FORMAT_BGR8,  NVCV_IMAGE_FORMAT_BGRA8,  NVCV_COLOR_BGR2BGRA},
+    {  96,  40,  2,     NVCV_IMAGE_FORMAT_Y8,   NVCV_IMAGE_FORMAT_BGR8,  NVCV_COLOR_GRAY2BGR},
+    {  97,  40,  2,     NVCV_IMAGE_FORMAT_Y8,   NVCV_IMAGE_FORMAT_BGR8,  NVCV_COLOR_GRAY2BGR},
+    {  80,  40,  2,   NVCV_IMAGE_FORMAT_RGB8,     NVCV_IMAGE_FORMAT_Y8,  NVCV_COLOR_RGB2GRAY},
+    {  82,  40,  2,  NVCV_IMAGE_FORMAT_BGRA8,     NVCV_IMAGE_FORMAT_Y8, NVCV_COLOR_BGRA2GRAY},
+    { 120,  30,  3,   NVCV_IMAGE_FORMAT_BGR8,   NVCV_IMAGE_FORMAT_YUV8,   NVCV_COLOR_BGR2YUV},
+    { 120,  30,  3,   NVCV_IMAGE_FORMAT_YUV8,   NVCV_IMAGE_FORMAT_RGB8,   NVCV_COLOR_YUV2RGB},
+    { 123,  30,  3,   NVCV_IMAGE_FORMAT_YUV8,   NVCV_IMAGE_FORMAT_BGR8,   NVCV_COLOR_YUV2BGR},
+});
+
+// clang-format on
+
+TEST_P(OpCvtColor8u, correct_output)
+{
+    int width   = GetParamValue<0>();
+    int height  = GetParamValue<1>();
+    int batches = GetParamValue<2>();
+
+    nvcv::ImageFormat srcFormat{GetParamValue<3>()};
+    nvcv::ImageFormat dstFormat{GetParamValue<4>()};
+
+    NVCVColorConversionCode code{GetParamValue<5>()};
+
+    nvcv::Tensor srcTensor = test::CreateTensor(batches, width, height, srcFormat);
+    nvcv::Tensor dstTensor = test::CreateTensor(batches, width, height, dstFormat);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(srcTensor.exportData());
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(dstTensor.exportData());
+
+    ASSERT_NE(srcData, nullptr);
+    ASSERT_NE(dstData, nullptr);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    long srcBufSize = srcAccess->sampleStride() * srcAccess->numSamples();
+    long dstBufSize = dstAccess->sampleStride() * dstAccess->numSamples();
+
+    std::vector<uint8_t> srcVec(srcBufSize);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), srcBufSize, cudaMemcpyHostToDevice));
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::CvtColor cvtColorOp;
+
+    EXPECT_NO_THROW(cvtColorOp(stream, srcTensor, dstTensor, code));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<uint8_t> testVec(dstBufSize), goldVec(dstBufSize);
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), dstData->basePtr(), dstBufSize, cudaMemcpyDeviceToHost));
+
+    for (int n = 0; n < batches; ++n)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                CvtColorPixel8u(code,
+                                &srcVec[n * srcAccess->sampleStride() + y * srcAccess->rowStride()
+                                        + x * srcAccess->colStride()],
+                                &goldVec[n * dstAccess->sampleStride() + y * dstAccess->rowStride()
+                                         + x * dstAccess->colStride()]);
+            }
+        }
+    }
+
+    VEC_EXPECT_NEAR(testVec, goldVec, 0);
+}
+
+TEST(OpCvtColor8u, launch_budget_matches_unlimited)
+{
+    const int width = 1920, height = 1080, batches = 3;
+
+    // BGR to RGB takes the 4 pixels per thread kernel, BGR to HSV the generic one
+    const std::vector<std::pair<NVCVColorConversionCode, nvcv::ImageFormat>> conversions
+        = {{NVCV_COLOR_BGR2RGB, nvcv::FMT_RGB8}, {NVCV_COLOR_BGR2HSV, nvcv::FMT_HSV8}};
+
+    for (auto [code, dstFormat] : conversions)
+    {
+        SCOPED_TRACE(code);
+
+        nvcv::Tensor srcTensor  = test::CreateTensor(batches, width, height, nvcv::FMT_BGR8);
+        nvcv::Tensor dstTensor  = test::CreateTensor(batches, width, height, dstFormat);
+        nvcv::Tensor goldTensor = test::CreateTensor(batches, width, height, dstFormat);
+
+        const auto *srcData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(srcTensor.exportData());
+        const auto *dstData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(dstTensor.exportData());
+        const auto *goldData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(goldTensor.exportData());
+        ASSERT_NE(srcData, nullptr);
+        ASSERT_NE(dstData, nullptr);
+        ASSERT_NE(goldData, nullptr);
+
+        long srcBufSize = srcData->stride(0) * batches;
+        long dstBufSize = dstData->stride(0) * batches;
+
+        std::vector<uint8_t> srcVec(srcBufSize);
+
+        std::default_random_engine    randEng(0);
+        std::uniform_int_distribution rand(0u, 255u);
+        std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), srcBufSize, cudaMemcpyHostToDevice));
+
+        cudaStream_t stream;
+        ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+        cvcuda::CvtColor cvtColorOp;
+
+        // with a single SM, each block of the capped grid loops over the pixels of many blocks
+        EXPECT_NO_THROW(cvtColorOp(stream, srcTensor, goldTensor, code));
+        ASSERT_EQ(NVCV_SUCCESS, cvcudaSetThreadLaunchBudget(1));
+        EXPECT_NO_THROW(cvtColorOp(stream, srcTensor, dstTensor, code));
+        ASSERT_EQ(NVCV_SUCCESS, cvcudaSetThreadLaunchBudget(-1));
+
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+        std::vector<uint8_t> testVec(dstBufSize), goldVec(dstBufSize);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), dstData->basePtr(), dstBufSize, cudaMemcpyDeviceToHost));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(goldVec.data(), goldData->basePtr(), dstBufSize, cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(testVec, goldVec);
+    }
+}
+
 TEST_P(OpCvtColor, varshape_correct_output)
 {
     cudaStream_t stream;
@@ -265,4 +486,692 @@ TEST_P(OpCvtColor, varshape_correct_output)
     }
 }
 
+namespace {
+
+// Host reference of the conversion of one pixel of an image with mixed formats batch, in BGRA and gray.
+struct MixedPixel
+{
+    uint8_t b, g, r, a, gray;
+};
+
+uint8_t SaturateU8(int v)
+{
+    return static_cast<uint8_t>(std::clamp(v, 0, 255));
+}
+
+MixedPixel GetMixedPixel(nvcv::ImageFormat fmt, const std::vector<std::vector<uint8_t>> &planes,
+                         const std::vector<int> &rowStrides, int x, int y)
+{
+    MixedPixel px{0, 0, 0, 255, 0};
+
+    if (fmt == nvcv::FMT_NV12)
+    {
+        int Y  = planes[0][y * rowStrides[0] + x];
+        int uu = planes[1][(y / 2) * rowStrides[1] + (x & ~1)] - 128;
+        int vv = planes[1][(y / 2) * rowStrides[1] + (x & ~1) + 1] - 128;
+        int yy = std::max(0, Y - 16) * 1220542;
+
+        px.r    = SaturateU8((yy + 1673527 * vv + (1 << 19)) >> 20);
+        px.g    = SaturateU8((yy - 852492 * vv - 409993 * uu + (1 << 19)) >> 20);
+        px.b    = SaturateU8((yy + 2116026 * uu + (1 << 19)) >> 20);
+        px.gray = Y;
+    }
+    else if (fmt.numChannels() == 1)
+    {
+        px.b = px.g = px.r = px.gray = planes[0][y * rowStrides[0] + x];
+    }
+    else
+    {
+        int            ch   = fmt.numChannels();
+        int            bidx = (fmt == nvcv::FMT_RGB8 || fmt == nvcv::FMT_RGBA8) ? 2 : 0;
+        const uint8_t *pix  = &planes[0][y * rowStrides[0] + x * ch];
+
+        px.b    = pix[bidx];
+        px.g    = pix[1];
+        px.r    = pix[bidx ^ 2];
+        px.a    = ch == 4 ? pix[3] : 255;
+        px.gray = (px.b * 3735 + px.g * 19235 + px.r * 9798 + (1 << 14)) >> 15;
+    }
+    return px;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpCvtColorVarShapeMixed, test::ValueList<NVCVImageFormat>
+{
+    NVCV_IMAGE_FORMAT_RGB8,
+    NVCV_IMAGE_FORMAT_BGR8,
+    NVCV_IMAGE_FORMAT_RGBA8,
+    NVCV_IMAGE_FORMAT_BGRA8,
+    NVCV_IMAGE_FORMAT_Y8_ER,
+});
+
+// clang-format on
+
+TEST_P(OpCvtColorVarShapeMixed, correct_output)
+{
+    nvcv::ImageFormat dstFormat{GetParam()};
+
+    const std::vector<nvcv::ImageFormat> srcFormats{nvcv::FMT_NV12,  nvcv::FMT_BGR8, nvcv::FMT_Y8,   nvcv::FMT_RGBA8,
+                                                    nvcv::FMT_Y8_ER, nvcv::FMT_NV12, nvcv::FMT_RGB8, nvcv::FMT_BGRA8};
+    const int                            batches = srcFormats.size();
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    std::default_random_engine             rng;
+    std::uniform_int_distribution<int>     udistSize(8, 64);
+    std::uniform_int_distribution<uint8_t> udist(0, 255);
+
+    std::vector<std::unique_ptr<nvcv::Image>>      imgSrc, imgDst;
+    std::vector<std::vector<std::vector<uint8_t>>> srcVec(batches);
+    std::vector<std::vector<int>>                  srcRowStride(batches);
+
+    nvcv::ImageBatchVarShape batchSrc(batches);
+    nvcv::ImageBatchVarShape batchDst(batches);
+
+    for (int i = 0; i < batches; ++i)
+    {
+        // NV12 needs even sizes, use them for all images
+        nvcv::Size2D size{udistSize(rng) * 2, udistSize(rng) * 2};
+
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(size, srcFormats[i]));
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(size, dstFormat));
+
+        auto *imgData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(imgData, nullptr);
+
+        for (int p = 0; p < imgData->numPlanes(); ++p)
+        {
+            int rowStride = imgData->plane(p).width * srcFormats[i].planePixelStrideBytes(p);
+            srcRowStride[i].push_back(rowStride);
+            srcVec[i].emplace_back(imgData->plane(p).height * rowStride);
+            std::generate(srcVec[i][p].begin(), srcVec[i][p].end(), [&]() { return udist(rng); });
+
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2DAsync(imgData->plane(p).basePtr, imgData->plane(p).rowStride,
+                                                     srcVec[i][p].data(), rowStride, rowStride,
+                                                     imgData->plane(p).height, cudaMemcpyHostToDevice, stream));
+        }
+    }
+
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+
+    cvcuda::CvtColor cvtColorOp;
+
+    EXPECT_NO_THROW(cvtColorOp(stream, batchSrc, batchDst));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    int dch  = dstFormat.numChannels();
+    int bidx = (dstFormat == nvcv::FMT_RGB8 || dstFormat == nvcv::FMT_RGBA8) ? 2 : 0;
+
+    for (int i = 0; i < batches; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        const auto *imgData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[i]->exportData());
+        ASSERT_NE(imgData, nullptr);
+
+        nvcv::Size2D size         = imgDst[i]->size();
+        int          dstRowStride = size.w * dch;
+
+        std::vector<uint8_t> testVec(size.h * dstRowStride), goldVec(size.h * dstRowStride);
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), dstRowStride, imgData->plane(0).basePtr,
+                                            imgData->plane(0).rowStride, dstRowStride, size.h,
+                                            cudaMemcpyDeviceToHost));
+
+        for (int y = 0; y < size.h; ++y)
+        {
+            for (int x = 0; x < size.w; ++x)
+            {
+                MixedPixel px  = GetMixedPixel(srcFormats[i], srcVec[i], srcRowStride[i], x, y);
+                uint8_t   *out = &goldVec[y * dstRowStride + x * dch];
+                if (dch == 1)
+                {
+                    out[0] = px.gray;
+                    continue;
+                }
+                out[bidx]     = px.b;
+                out[1]        = px.g;
+                out[bidx ^ 2] = px.r;
+                if (dch == 4)
+                {
+                    out[3] = px.a;
+                }
+            }
+        }
+
+        VEC_EXPECT_NEAR(testVec, goldVec, 0);
+    }
+}
+
+TEST(OpCvtColorVarShapeMixed, invalid_formats_are_rejected)
+{
+    nvcv::ImageBatchVarShape batchSrc(2);
+    nvcv::ImageBatchVarShape batchDst(2);
+
+    batchSrc.pushBack(nvcv::Image({16, 16}, nvcv::FMT_BGR8));
+    batchSrc.pushBack(nvcv::Image({16, 16}, nvcv::FMT_HSV8));
+    batchDst.pushBack(nvcv::Image({16, 16}, nvcv::FMT_RGB8));
+    batchDst.pushBack(nvcv::Image({16, 16}, nvcv::FMT_RGB8));
+
+    cvcuda::CvtColor cvtColorOp;
+
+    // HSV inputs aren't supported by the mixed conversion
+    EXPECT_THROW(cvtColorOp(nullptr, batchSrc, batchDst), nvcv::Exception);
+
+    nvcv::ImageBatchVarShape batchNV12(2);
+    batchNV12.pushBack(nvcv::Image({16, 16}, nvcv::FMT_BGR8));
+    batchNV12.pushBack(nvcv::Image({16, 16}, nvcv::FMT_RGB8));
+
+    nvcv::ImageBatchVarShape batchMixedDst(2);
+    batchMixedDst.pushBack(nvcv::Image({16, 16}, nvcv::FMT_NV12));
+    batchMixedDst.pushBack(nvcv::Image({16, 16}, nvcv::FMT_NV12));
+
+    // NV12 outputs aren't supported
+    EXPECT_THROW(cvtColorOp(nullptr, batchNV12, batchMixedDst), nvcv::Exception);
+}
+
+namespace {
+
+struct LabCodeInfo
+{
+    NVCVColorConversionCode code;
+    NVCVColorConversionCode forwardCode; // same as code for RGB to Lab/Luv conversions
+    bool                    isLuv;
+    bool                    isSrgb;
+    int                     bidx;
+};
+
+// clang-format off
+
+constexpr LabCodeInfo kLabCodes[] = {
+    {  NVCV_COLOR_BGR2Lab,  NVCV_COLOR_BGR2Lab, false,  true, 0},
+    {  NVCV_COLOR_RGB2Lab,  NVCV_COLOR_RGB2Lab, false,  true, 2},
+    { NVCV_COLOR_LBGR2Lab, NVCV_COLOR_LBGR2Lab, false, false, 0},
+    { NVCV_COLOR_LRGB2Lab, NVCV_COLOR_LRGB2Lab, false, false, 2},
+    {  NVCV_COLOR_BGR2Luv,  NVCV_COLOR_BGR2Luv,  true,  true, 0},
+    {  NVCV_COLOR_RGB2Luv,  NVCV_COLOR_RGB2Luv,  true,  true, 2},
+    { NVCV_COLOR_LBGR2Luv, NVCV_COLOR_LBGR2Luv,  true, false, 0},
+    { NVCV_COLOR_LRGB2Luv, NVCV_COLOR_LRGB2Luv,  true, false, 2},
+    {  NVCV_COLOR_Lab2BGR,  NVCV_COLOR_BGR2Lab, false,  true, 0},
+    {  NVCV_COLOR_Lab2RGB,  NVCV_COLOR_RGB2Lab, false,  true, 2},
+    { NVCV_COLOR_Lab2LBGR, NVCV_COLOR_LBGR2Lab, false, false, 0},
+    { NVCV_COLOR_Lab2LRGB, NVCV_COLOR_LRGB2Lab, false, false, 2},
+    {  NVCV_COLOR_Luv2BGR,  NVCV_COLOR_BGR2Luv,  true,  true, 0},
+    {  NVCV_COLOR_Luv2RGB,  NVCV_COLOR_RGB2Luv,  true,  true, 2},
+    { NVCV_COLOR_Luv2LBGR, NVCV_COLOR_LBGR2Luv,  true, false, 0},
+    { NVCV_COLOR_Luv2LRGB, NVCV_COLOR_LRGB2Luv,  true, false, 2},
+};
+
+// clang-format on
+
+const LabCodeInfo &GetLabCodeInfo(NVCVColorConversionCode code)
+{
+    auto it = std::find_if(std::begin(kLabCodes), std::end(kLabCodes),
+                           [code](const LabCodeInfo &info) { return info.code == code; });
+    assert(it != std::end(kLabCodes));
+    return *it;
+}
+
+// Host reference of the Lab and Luv conversions of a single pixel, in double precision.  8-bit values are in
+// [0, 255] and rounded, floating-point RGB values are in [0, 1].
+void CvtColorLabPixel(NVCVColorConversionCode code, bool is8u, const double *src, double *dst, int dcn)
+{
+    const LabCodeInfo &info = GetLabCodeInfo(code);
+
+    const double Xn = 0.950456, Zn = 1.088754;
+    const double un = 4 * Xn / (Xn + 15 + 3 * Zn), vn = 9 / (Xn + 15 + 3 * Zn);
+
+    auto to8u = [](double x) { return std::clamp(std::round(x), 0.0, 255.0); };
+
+    if (info.forwardCode == code)
+    {
+        double rgb[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            double x = src[i == 0 ? info.bidx ^ 2 : (i == 1 ? 1 : info.bidx)] / (is8u ? 255.0 : 1.0);
+            if (info.isSrgb)
+            {
+                x = x <= 0.04045 ? x / 12.92 : std::pow((x + 0.055) / 1.055, 2.4);
+            }
+            rgb[i] = x;
+        }
+
+        double X = 0.412453 * rgb[0] + 0.357580 * rgb[1] + 0.180423 * rgb[2];
+        double Y = 0.212671 * rgb[0] + 0.715160 * rgb[1] + 0.072169 * rgb[2];
+        double Z = 0.019334 * rgb[0] + 0.119193 * rgb[1] + 0.950227 * rgb[2];
+
+        auto   f = [](double t) { return t > 0.008856 ? std::cbrt(t) : 7.787 * t + 16.0 / 116.0; };
+        double L = Y > 0.008856 ? 116.0 * std::cbrt(Y) - 16.0 : 903.3 * Y;
+
+        if (info.isLuv)
+        {
+            double d = 1.0 / std::max(X + 15 * Y + 3 * Z, (double)FLT_EPSILON);
+            dst[0]   = L;
+            dst[1]   = 13 * L * (4 * X * d - un);
+            dst[2]   = 13 * L * (9 * Y * d - vn);
+            if (is8u)
+            {
+                dst[0] = to8u(dst[0] * 255.0 / 100.0);
+                dst[1] = to8u((dst[1] + 134) * 255.0 / 354.0);
+                dst[2] = to8u((dst[2] + 140) * 255.0 / 262.0);
+            }
+        }
+        else
+        {
+            dst[0] = L;
+            dst[1] = 500 * (f(X / Xn) - f(Y));
+            dst[2] = 200 * (f(Y) - f(Z / Zn));
+            if (is8u)
+            {
+                dst[0] = to8u(dst[0] * 255.0 / 100.0);
+                dst[1] = to8u(dst[1] + 128);
+                dst[2] = to8u(dst[2] + 128);
+            }
+        }
+        return;
+    }
+
+    double L = src[0], a = src[1], b = src[2];
+    if (is8u)
+    {
+        L = L * 100.0 / 255.0;
+        a = info.isLuv ? a * 354.0 / 255.0 - 134 : a - 128;
+        b = info.isLuv ? b * 262.0 / 255.0 - 140 : b - 128;
+    }
+
+    double Y  = L <= 903.3 * 0.008856 ? L / 903.3 : std::pow((L + 16) / 116.0, 3);
+    double X  = 0;
+    double Z  = 0;
+    auto   fi = [](double t) { return t > 0.206893 ? t * t * t : (t - 16.0 / 116.0) / 7.787; };
+
+    if (info.isLuv)
+    {
+        if (L > 0)
+        {
+            double up = a / (13 * L) + un;
+            double vp = std::max(b / (13 * L) + vn, (double)FLT_EPSILON);
+            X         = 9 * Y * up / (4 * vp);
+            Z         = Y * (12 - 3 * up - 20 * vp) / (4 * vp);
+        }
+        else
+        {
+            Y = 0;
+        }
+    }
+    else
+    {
+        double fy = L <= 903.3 * 0.008856 ? 7.787 * Y + 16.0 / 116.0 : (L + 16) / 116.0;
+        X         = fi(fy + a / 500) * Xn;
+        Z         = fi(fy - b / 200) * Zn;
+    }
+
+    double rgb[3] = {3.240479 * X - 1.53715 * Y - 0.498535 * Z, -0.969256 * X + 1.875991 * Y + 0.041556 * Z,
+                     0.055648 * X - 0.204043 * Y + 1.057311 * Z};
+    for (int i = 0; i < 3; ++i)
+    {
+        double x = std::clamp(rgb[i], 0.0, 1.0);
+        if (info.isSrgb)
+        {
+            x = x <= 0.0031308 ? x * 12.92 : 1.055 * std::pow(x, 1 / 2.4) - 0.055;
+        }
+        rgb[i] = is8u ? to8u(x * 255) : x;
+    }
+
+    dst[info.bidx ^ 2] = rgb[0];
+    dst[1]             = rgb[1];
+    dst[info.bidx]     = rgb[2];
+    if (dcn == 4)
+    {
+        dst[3] = is8u ? 255 : 1;
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpCvtColorLab,
+test::ValueList<int, int, int, NVCVImageFormat, NVCVImageFormat, NVCVColorConversionCode, double>
+{
+    //  W,   H,  N,            inputFormat,            outputFormat,                code, maxDiff
+    {  67,  31,  2,    NVCV_IMAGE_FORMAT_BGR8,    NVCV_IMAGE_FORMAT_BGR8,   NVCV_COLOR_BGR2Lab,    1.0},
+    {  64,  17,  3,   NVCV_IMAGE_FORMAT_RGBA8,    NVCV_IMAGE_FORMAT_RGB8,   NVCV_COLOR_RGB2Lab,    1.0},
+    {  45,  23,  2,    NVCV_IMAGE_FORMAT_BGR8,    NVCV_IMAGE_FORMAT_BGR8,  NVCV_COLOR_LBGR2Lab,    1.0},
+    {  55,  12,  2,    NVCV_IMAGE_FORMAT_RGB8,    NVCV_IMAGE_FORMAT_RGB8,   NVCV_COLOR_RGB2Luv,    1.0},
+    {  33,  21,  2,    NVCV_IMAGE_FORMAT_BGR8,    NVCV_IMAGE_FORMAT_BGR8,  NVCV_COLOR_LBGR2Luv,    1.0},
+    {  67,  31,  2,    NVCV_IMAGE_FORMAT_BGR8,    NVCV_IMAGE_FORMAT_BGR8,   NVCV_COLOR_Lab2BGR,    1.0},
+    {  40,  20,  2,    NVCV_IMAGE_FORMAT_BGR8,   NVCV_IMAGE_FORMAT_BGRA8,   NVCV_COLOR_Lab2BGR,    1.0},
+    {  41,  19,  1,    NVCV_IMAGE_FORMAT_RGB8,    NVCV_IMAGE_FORMAT_RGB8,  NVCV_COLOR_Lab2LRGB,    1.0},
+    {  52,  16,  2,    NVCV_IMAGE_FORMAT_BGR8,    NVCV_IMAGE_FORMAT_BGR8,   NVCV_COLOR_Luv2BGR,    1.0},
+    {  29,  33,  1,    NVCV_IMAGE_FORMAT_RGB8,    NVCV_IMAGE_FORMAT_RGB8,  NVCV_COLOR_Luv2LRGB,    1.0},
+    {  61,  17,  2,  NVCV_IMAGE_FORMAT_BGRf32,  NVCV_IMAGE_FORMAT_BGRf32,   NVCV_COLOR_BGR2Lab,   1e-2},
+    {  23,  45,  2,  NVCV_IMAGE_FORMAT_RGBf32,  NVCV_IMAGE_FORMAT_RGBf32,  NVCV_COLOR_LRGB2Lab,   1e-2},
+    {  38,  27,  3,  NVCV_IMAGE_FORMAT_RGBf32,  NVCV_IMAGE_FORMAT_RGBf32,   NVCV_COLOR_RGB2Luv,   1e-2},
+    {  61,  17,  2,  NVCV_IMAGE_FORMAT_BGRf32,  NVCV_IMAGE_FORMAT_BGRf32,   NVCV_COLOR_Lab2BGR,   1e-3},
+    {  36,  22,  2,  NVCV_IMAGE_FORMAT_BGRf32, NVCV_IMAGE_FORMAT_BGRAf32,  NVCV_COLOR_Lab2LBGR,   1e-3},
+    {  38,  27,  3,  NVCV_IMAGE_FORMAT_RGBf32,  NVCV_IMAGE_FORMAT_RGBf32,   NVCV_COLOR_Luv2RGB,   1e-3},
+});
+
+// clang-format on
+
+TEST_P(OpCvtColorLab, correct_output)
+{
+    int width   = GetParamValue<0>();
+    int height  = GetParamValue<1>();
+    int batches = GetParamValue<2>();
+
+    nvcv::ImageFormat srcFormat{GetParamValue<3>()};
+    nvcv::ImageFormat dstFormat{GetParamValue<4>()};
+
+    NVCVColorConversionCode code{GetParamValue<5>()};
+
+    double maxDiff{GetParamValue<6>()};
+
+    const LabCodeInfo &info      = GetLabCodeInfo(code);
+    const bool         is8u      = srcFormat.dataKind() != nvcv::DataKind::FLOAT;
+    const int          scn       = srcFormat.numChannels();
+    const int          dcn       = dstFormat.numChannels();
+    const int          numPixels = batches * height * width;
+
+    // Inputs of Lab/Luv to RGB conversions are made from random RGB values, so that they're valid colors
+    std::default_random_engine             randEng(0);
+    std::uniform_real_distribution<double> rand(0.0, 1.0);
+
+    std::vector<double> srcVals(numPixels * scn);
+    for (int i = 0; i < numPixels; ++i)
+    {
+        double rgb[4];
+        for (int c = 0; c < scn; ++c)
+        {
+            rgb[c] = is8u ? std::floor(rand(randEng) * 256) : rand(randEng);
+        }
+        if (info.forwardCode == code)
+        {
+            std::copy(rgb, rgb + scn, &srcVals[i * scn]);
+        }
+        else
+        {
+            CvtColorLabPixel(info.forwardCode, is8u, rgb, &srcVals[i * scn], scn);
+        }
+    }
+
+    std::vector<double> goldVals(numPixels * dcn);
+    for (int i = 0; i < numPixels; ++i)
+    {
+        CvtColorLabPixel(code, is8u, &srcVals[i * scn], &goldVals[i * dcn], dcn);
+    }
+
+    nvcv::Tensor srcTensor = test::CreateTensor(batches, width, height, srcFormat);
+    nvcv::Tensor dstTensor = test::CreateTensor(batches, width, height, dstFormat);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(srcTensor.exportData());
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(dstTensor.exportData());
+
+    ASSERT_NE(srcData, nullptr);
+    ASSERT_NE(dstData, nullptr);
+
+    // Tensors are packed, pixels are contiguous
+    std::vector<float>   srcFloat(srcVals.begin(), srcVals.end());
+    std::vector<uint8_t> src8u(srcVals.begin(), srcVals.end());
+
+    if (is8u)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), src8u.data(), src8u.size(), cudaMemcpyHostToDevice));
+    }
+    else
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcFloat.data(), srcFloat.size() * sizeof(float),
+                                          cudaMemcpyHostToDevice));
+    }
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::CvtColor cvtColorOp;
+
+    EXPECT_NO_THROW(cvtColorOp(stream, srcTensor, dstTensor, code));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<double> testVals(goldVals.size());
+
+    if (is8u)
+    {
+        std::vector<uint8_t> dst8u(goldVals.size());
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(dst8u.data(), dstData->basePtr(), dst8u.size(), cudaMemcpyDeviceToHost));
+        std::copy(dst8u.begin(), dst8u.end(), testVals.begin());
+    }
+    else
+    {
+        std::vector<float> dstFloat(goldVals.size());
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(dstFloat.data(), dstData->basePtr(), dstFloat.size() * sizeof(float),
+                                          cudaMemcpyDeviceToHost));
+        std::copy(dstFloat.begin(), dstFloat.end(), testVals.begin());
+    }
+
+    VEC_EXPECT_NEAR(testVals, goldVals, maxDiff);
+}
+
+namespace {
+
+// Host reference of the 16-bit YUV 4:2:0 to RGB conversion of a single pixel, values in [0,1].
+void CvtColorPixelP010(nvcv::ColorSpec spec, uint16_t y16, uint16_t u16, uint16_t v16, double rgb[3])
+{
+    double kr, kb;
+    switch (spec.yCbCrEncoding())
+    {
+    case nvcv::YCbCrEncoding::BT709:
+        kr = 0.2126, kb = 0.0722;
+        break;
+    default:
+        kr = 0.2627, kb = 0.0593;
+        break;
+    }
+    double kg = 1 - kr - kb;
+
+    bool   limited = spec.colorRange() == nvcv::ColorRange::LIMITED;
+    double y       = limited ? (y16 - 4096.0) / 56064 : y16 / 65535.0;
+    double cb      = (u16 - 32768.0) / (limited ? 57344 : 65535);
+    double cr      = (v16 - 32768.0) / (limited ? 57344 : 65535);
+
+    double r = y + 2 * (1 - kr) * cr;
+    double g = y - 2 * kb * (1 - kb) / kg * cb - 2 * kr * (1 - kr) / kg * cr;
+    double b = y + 2 * (1 - kb) * cb;
+
+    nvcv::ColorTransferFunction xfer = spec.colorTransferFunction();
+    if (xfer == nvcv::ColorTransferFunction::PQ || xfer == nvcv::ColorTransferFunction::HLG)
+    {
+        double lin[3] = {r, g, b};
+        for (double &c : lin)
+        {
+            c = std::max(c, 0.0);
+            if (xfer == nvcv::ColorTransferFunction::PQ)
+            {
+                double p = std::pow(c, 1 / 78.84375);
+                c = 10000 * std::pow(std::max(p - 0.8359375, 0.0) / (18.8515625 - 18.6875 * p), 1 / 0.1593017578125)
+                  / 203;
+            }
+            else
+            {
+                c = c <= 0.5 ? c * c / 3 : (std::exp((c - 0.55991073) / 0.17883277) + 0.28466892) / 12;
+            }
+        }
+        if (xfer == nvcv::ColorTransferFunction::HLG)
+        {
+            double k = 1000.0 / 203 * std::pow(0.2627 * lin[0] + 0.6780 * lin[1] + 0.0593 * lin[2], 0.2);
+            for (double &c : lin)
+            {
+                c *= k;
+            }
+        }
+
+        double peak = 1000.0 / 203;
+        double l    = 0.2627 * lin[0] + 0.6780 * lin[1] + 0.0593 * lin[2];
+        if (l > 0)
+        {
+            double s = (1 + l / (peak * peak)) / (1 + l);
+            for (double &c : lin)
+            {
+                c *= s;
+            }
+        }
+
+        r = 1.6605 * lin[0] - 0.5876 * lin[1] - 0.0728 * lin[2];
+        g = -0.1246 * lin[0] + 1.1329 * lin[1] - 0.0083 * lin[2];
+        b = -0.0182 * lin[0] - 0.1006 * lin[1] + 1.1187 * lin[2];
+
+        r = std::pow(std::clamp(r, 0.0, 1.0), 1 / 2.4);
+        g = std::pow(std::clamp(g, 0.0, 1.0), 1 / 2.4);
+        b = std::pow(std::clamp(b, 0.0, 1.0), 1 / 2.4);
+    }
+
+    rgb[0] = std::clamp(r, 0.0, 1.0);
+    rgb[1] = std::clamp(g, 0.0, 1.0);
+    rgb[2] = std::clamp(b, 0.0, 1.0);
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpCvtColorP010, test::ValueList<int, int, int, NVCVColorSpec, NVCVImageFormat, NVCVColorConversionCode>
+{
+    //width, height, numImages,                     inSpec,                dstFormat,                     code
+    {   64,     32,         2,       NVCV_COLOR_SPEC_BT2020,   NVCV_IMAGE_FORMAT_RGB8,  NVCV_COLOR_YUV2RGB_P010},
+    {   32,     18,         1,       NVCV_COLOR_SPEC_BT709,    NVCV_IMAGE_FORMAT_BGR8,  NVCV_COLOR_YUV2BGR_P016},
+    {   48,     20,         3,    NVCV_COLOR_SPEC_BT2020_PQ, NVCV_IMAGE_FORMAT_RGBAf32, NVCV_COLOR_YUV2RGBA_P010},
+    {   20,     40,         2, NVCV_COLOR_SPEC_BT2020_HLG_ER, NVCV_IMAGE_FORMAT_BGRAf32, NVCV_COLOR_YUV2BGRA_P010},
+});
+
+// clang-format on
+
+TEST_P(OpCvtColorP010, correct_output)
+{
+    int width   = GetParamValue<0>();
+    int height  = GetParamValue<1>();
+    int batches = GetParamValue<2>();
+
+    nvcv::ColorSpec         inSpec{GetParamValue<3>()};
+    nvcv::ImageFormat       dstFormat{GetParamValue<4>()};
+    NVCVColorConversionCode code{GetParamValue<5>()};
+
+    bool is8u = dstFormat.planeDataType(0).bitsPerPixel() / dstFormat.numChannels() == 8;
+    int  dcn  = dstFormat.numChannels();
+    int  bidx = (code == NVCV_COLOR_YUV2BGR_P010 || code == NVCV_COLOR_YUV2BGRA_P010) ? 0 : 2;
+
+    // Luma plane followed by the interleaved CbCr plane, 10-bit samples in the most significant bits
+    nvcv::Tensor srcTensor(batches, {width, height * 3 / 2}, nvcv::FMT_U16);
+    nvcv::Tensor dstTensor(batches, {width, height}, dstFormat);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(srcTensor.exportData());
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(dstTensor.exportData());
+
+    ASSERT_NE(srcData, nullptr);
+    ASSERT_NE(dstData, nullptr);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    int srcRowElems = srcAccess->rowStride() / sizeof(uint16_t);
+    int srcRows     = height * 3 / 2;
+
+    std::vector<uint16_t> srcVec(srcRowElems * srcRows * batches);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 1023u);
+
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng) << 6; });
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->basePtr(), srcAccess->rowStride(), srcVec.data(),
+                                        srcRowElems * sizeof(uint16_t), srcRowElems * sizeof(uint16_t),
+                                        srcRows * batches, cudaMemcpyHostToDevice));
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::CvtColor cvtColorOp;
+
+    EXPECT_NO_THROW(cvtColorOp(stream, srcTensor, dstTensor, code, inSpec));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    int elemSize    = is8u ? 1 : sizeof(float);
+    int dstRowElems = width * dcn;
+
+    std::vector<uint8_t> dstBytes(dstRowElems * elemSize * height * batches);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(dstBytes.data(), dstRowElems * elemSize, dstData->basePtr(),
+                                        dstAccess->rowStride(), dstRowElems * elemSize, height * batches,
+                                        cudaMemcpyDeviceToHost));
+
+    std::vector<double> testVals(dstRowElems * height * batches), goldVals(testVals.size());
+    for (size_t i = 0; i < testVals.size(); ++i)
+    {
+        testVals[i] = is8u ? dstBytes[i] : reinterpret_cast<const float *>(dstBytes.data())[i];
+    }
+
+    for (int z = 0; z < batches; ++z)
+    {
+        const uint16_t *src = srcVec.data() + z * srcRows * srcRowElems;
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                const uint16_t *uv = src + (height + y / 2) * srcRowElems + (x & ~1);
+
+                double rgb[3];
+                CvtColorPixelP010(inSpec, src[y * srcRowElems + x], uv[0], uv[1], rgb);
+
+                double *gold   = goldVals.data() + ((z * height + y) * width + x) * dcn;
+                gold[bidx]     = rgb[2];
+                gold[1]        = rgb[1];
+                gold[bidx ^ 2] = rgb[0];
+                if (dcn == 4)
+                {
+                    gold[3] = 1;
+                }
+                for (int c = 0; c < dcn && is8u; ++c)
+                {
+                    gold[c] = std::round(gold[c] * 255);
+                }
+            }
+        }
+    }
+
+    VEC_EXPECT_NEAR(testVals, goldVals, is8u ? 1.0 : 1e-3);
+}
+
+TEST(OpCvtColorP010, invalid_color_spec_is_rejected)
+{
+    nvcv::Tensor srcTensor(1, {16, 24}, nvcv::FMT_U16);
+    nvcv::Tensor dstTensor(1, {16, 16}, nvcv::FMT_RGB8);
+
+    cvcuda::CvtColor cvtColorOp;
+
+    // Constant luminance BT.2020 isn't supported
+    EXPECT_THROW(cvtColorOp(nullptr, srcTensor, dstTensor, NVCV_COLOR_YUV2RGB_P010, NVCV_COLOR_SPEC_BT2020c),
+                 nvcv::Exception);
+
+    // 8-bit inputs must use the NV12 codes
+    nvcv::Tensor srcTensor8u(1, {16, 24}, nvcv::FMT_U8);
+    EXPECT_THROW(cvtColorOp(nullptr, srcTensor8u, dstTensor, NVCV_COLOR_YUV2RGB_P010, nvcv::CSPEC_BT2020),
+                 nvcv::Exception);
+}
+
 #undef VEC_EXPECT_NEAR
+#undef NVCV_IMAGE_FORMAT_Y16
+#undef NVCV_IMAGE_FORMAT_BGR16
+#undef NVCV_IMAGE_FORMAT_RGB16
+#undef NVCV_IMAGE_FORMAT_YUV8
+#undef NVCV_IMAGE_FORMAT_NV21
@@ -0,0 +1,326 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpDemosaic.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+namespace test = nvcv::test;
+
+namespace {
+
+template<typename T>
+void CopyRows(const nvcv::Tensor &tensor, std::vector<T> &host, cudaMemcpyKind kind)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(data, nullptr);
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    ASSERT_TRUE(access);
+    ASSERT_EQ(access->sampleStride(), access->numRows() * access->rowStride());
+
+    const int rowElems = access->numCols() * access->numChannels();
+    const int rowBytes = rowElems * sizeof(T);
+    const int rows     = access->numSamples() * access->numRows();
+
+    if (kind == cudaMemcpyDeviceToHost)
+    {
+        host.resize(rows * rowElems);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(host.data(), rowBytes, data->basePtr(), access->rowStride(), rowBytes,
+                                            rows, kind));
+    }
+    else
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(data->basePtr(), access->rowStride(), host.data(), rowBytes, rowBytes,
+                                            rows, kind));
+    }
+}
+
+// Reference demosaic of one image, normalized samples in row-major order, as done by the kernel.
+class GoldDemosaic
+{
+public:
+    GoldDemosaic(const std::vector<float> &raw, int width, int height, int redX, int redY)
+        : m_raw(raw)
+        , m_width(width)
+        , m_height(height)
+        , m_redX(redX)
+        , m_redY(redY)
+    {
+    }
+
+    void rgb(int x, int y, bool edgeAware, float out[3]) const
+    {
+        const bool redRow = (y & 1) == m_redY;
+        const bool redCol = (x & 1) == m_redX;
+
+        if (redRow != redCol)
+        {
+            const float g = s(x, y);
+            float       h, v;
+            if (edgeAware)
+            {
+                h = g + (diff(x - 1, y) + diff(x + 1, y)) / 2;
+                v = g + (diff(x, y - 1) + diff(x, y + 1)) / 2;
+            }
+            else
+            {
+                h = (s(x - 1, y) + s(x + 1, y)) / 2;
+                v = (s(x, y - 1) + s(x, y + 1)) / 2;
+            }
+            out[0] = redRow ? h : v;
+            out[1] = g;
+            out[2] = redRow ? v : h;
+        }
+        else
+        {
+            const float c = s(x, y);
+            float       g, o;
+            if (edgeAware)
+            {
+                g = green(x, y);
+                o = g + (diff(x - 1, y - 1) + diff(x + 1, y - 1) + diff(x - 1, y + 1) + diff(x + 1, y + 1)) / 4;
+            }
+            else
+            {
+                g = (s(x - 1, y) + s(x + 1, y) + s(x, y - 1) + s(x, y + 1)) / 4;
+                o = (s(x - 1, y - 1) + s(x + 1, y - 1) + s(x - 1, y + 1) + s(x + 1, y + 1)) / 4;
+            }
+            out[0] = redRow ? c : o;
+            out[1] = g;
+            out[2] = redRow ? o : c;
+        }
+    }
+
+private:
+    static int reflect(int i, int n)
+    {
+        i = std::abs(i);
+        return i >= n ? 2 * n - 2 - i : i;
+    }
+
+    float s(int x, int y) const
+    {
+        return m_raw[reflect(y, m_height) * m_width + reflect(x, m_width)];
+    }
+
+    float green(int x, int y) const
+    {
+        const float c  = s(x, y);
+        const float ch = 2 * c - s(x - 2, y) - s(x + 2, y);
+        const float cv = 2 * c - s(x, y - 2) - s(x, y + 2);
+        const float dh = std::abs(s(x - 1, y) - s(x + 1, y)) + std::abs(ch);
+        const float dv = std::abs(s(x, y - 1) - s(x, y + 1)) + std::abs(cv);
+        const float gh = (s(x - 1, y) + s(x + 1, y)) / 2 + ch / 4;
+        const float gv = (s(x, y - 1) + s(x, y + 1)) / 2 + cv / 4;
+        const float g  = dh < dv ? gh : (dv < dh ? gv : (gh + gv) / 2);
+        return std::clamp(g, 0.f, 1.f);
+    }
+
+    float diff(int x, int y) const
+    {
+        return s(x, y) - green(x, y);
+    }
+
+    const std::vector<float> &m_raw;
+
+    int m_width, m_height, m_redX, m_redY;
+};
+
+template<typename T, typename DT>
+void TestDemosaic(int numSamples, int width, int height, NVCVRawPattern pattern, NVCVDemosaicType type, int dcn,
+                  const NVCVDemosaicParams *params, double maxDiff)
+{
+    nvcv::DataType inType  = std::is_same_v<T, uint8_t> ? nvcv::TYPE_U8 : nvcv::TYPE_U16;
+    nvcv::DataType outType = std::is_same_v<DT, float>
+                               ? nvcv::TYPE_F32
+                               : (std::is_same_v<DT, uint8_t> ? nvcv::TYPE_U8 : nvcv::TYPE_U16);
+
+    nvcv::Tensor in({{numSamples, height, width, 1}, nvcv::TENSOR_NHWC}, inType);
+    nvcv::Tensor out({{numSamples, height, width, dcn}, nvcv::TENSOR_NHWC}, outType);
+
+    const float inMax  = std::numeric_limits<T>::max();
+    const float outMax = std::is_same_v<DT, float> ? 1.f : std::numeric_limits<DT>::max();
+
+    std::default_random_engine             randEng(0);
+    std::uniform_int_distribution<int32_t> rand(0, inMax);
+
+    std::vector<T> raw(numSamples * height * width);
+    std::generate(raw.begin(), raw.end(), [&]() { return rand(randEng); });
+    CopyRows(in, raw, cudaMemcpyHostToDevice);
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::Demosaic op;
+    EXPECT_NO_THROW(op(stream, in, out, pattern, type, params));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<DT> test;
+    CopyRows(out, test, cudaMemcpyDeviceToHost);
+
+    const int redX = (pattern == NVCV_RAW_BAYER_GRBG || pattern == NVCV_RAW_BAYER_BGGR) ? 1 : 0;
+    const int redY = (pattern == NVCV_RAW_BAYER_GBRG || pattern == NVCV_RAW_BAYER_BGGR) ? 1 : 0;
+
+    NVCVDemosaicParams p = params ? *params : NVCVDemosaicParams{{1, 1, 1}, {1, 0, 0, 0, 1, 0, 0, 0, 1}, 1};
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        std::vector<float> sample(width * height);
+        std::transform(raw.begin() + n * width * height, raw.begin() + (n + 1) * width * height, sample.begin(),
+                       [&](T v) { return v / inMax; });
+
+        GoldDemosaic gold(sample, width, height, redX, redY);
+
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                float rgb[3];
+                gold.rgb(x, y, type == NVCV_DEMOSAIC_EDGE_AWARE, rgb);
+                for (int c = 0; c < 3; ++c)
+                {
+                    rgb[c] *= p.wbGains[c];
+                }
+
+                const DT *pix = &test[((n * height + y) * width + x) * dcn];
+                for (int c = 0; c < 3; ++c)
+                {
+                    float v = p.ccm[c * 3] * rgb[0] + p.ccm[c * 3 + 1] * rgb[1] + p.ccm[c * 3 + 2] * rgb[2];
+                    v       = std::pow(std::clamp(v, 0.f, 1.f), 1 / p.gamma) * outMax;
+                    if (!std::is_same_v<DT, float>)
+                    {
+                        v = std::round(v);
+                    }
+                    ASSERT_NEAR(v, pix[c], maxDiff) << "sample " << n << " pixel " << x << "," << y << " channel " << c;
+                }
+                if (dcn == 4)
+                {
+                    ASSERT_EQ(outMax, pix[3]) << "sample " << n << " pixel " << x << "," << y;
+                }
+            }
+        }
+    }
+}
+
+const NVCVDemosaicParams kCameraParams = {
+    {1.9f, 1.f, 1.6f},
+    {1.6f, -0.4f, -0.2f, -0.3f, 1.5f, -0.2f, 0.f, -0.6f, 1.6f},
+    2.2f
+};
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpDemosaic, test::ValueList<int, int, int, NVCVRawPattern, NVCVDemosaicType, int, int, bool>
+{
+    // numSamples, width, height,            pattern,                     type, inBits, outBits, camera
+    {           1,    64,     48, NVCV_RAW_BAYER_RGGB,   NVCV_DEMOSAIC_BILINEAR,      8,       8,  false},
+    {           2,    37,     21, NVCV_RAW_BAYER_BGGR,   NVCV_DEMOSAIC_BILINEAR,     16,      32,   true},
+    {           3,    20,     33, NVCV_RAW_BAYER_GRBG, NVCV_DEMOSAIC_EDGE_AWARE,      8,      32,  false},
+    {           2,    51,     16, NVCV_RAW_BAYER_GBRG, NVCV_DEMOSAIC_EDGE_AWARE,     16,      16,   true},
+    {           1,     3,      3, NVCV_RAW_BAYER_RGGB, NVCV_DEMOSAIC_EDGE_AWARE,      8,       8,   true},
+    {           2,   640,    360, NVCV_RAW_BAYER_BGGR, NVCV_DEMOSAIC_EDGE_AWARE,     16,       8,   true}
+});
+
+// clang-format on
+
+TEST_P(OpDemosaic, correct_output)
+{
+    int              numSamples = GetParamValue<0>();
+    int              width      = GetParamValue<1>();
+    int              height     = GetParamValue<2>();
+    NVCVRawPattern   pattern    = GetParamValue<3>();
+    NVCVDemosaicType type       = GetParamValue<4>();
+    int              inBits     = GetParamValue<5>();
+    int              outBits    = GetParamValue<6>();
+    bool             camera     = GetParamValue<7>();
+
+    const NVCVDemosaicParams *params = camera ? &kCameraParams : nullptr;
+
+    // Alternate RGB and RGBA outputs. Gamma amplifies the rounding differences of dark values, hence the tolerances
+    const int dcn = (numSamples + width) % 2 ? 4 : 3;
+
+    if (inBits == 8)
+    {
+        switch (outBits)
+        {
+        case 8:
+            TestDemosaic<uint8_t, uint8_t>(numSamples, width, height, pattern, type, dcn, params, 1);
+            break;
+        case 16:
+            TestDemosaic<uint8_t, uint16_t>(numSamples, width, height, pattern, type, dcn, params, 1);
+            break;
+        default:
+            TestDemosaic<uint8_t, float>(numSamples, width, height, pattern, type, dcn, params, 1e-3);
+            break;
+        }
+    }
+    else
+    {
+        switch (outBits)
+        {
+        case 8:
+            TestDemosaic<uint16_t, uint8_t>(numSamples, width, height, pattern, type, dcn, params, 1);
+            break;
+        case 16:
+            TestDemosaic<uint16_t, uint16_t>(numSamples, width, height, pattern, type, dcn, params, 64);
+            break;
+        default:
+            TestDemosaic<uint16_t, float>(numSamples, width, height, pattern, type, dcn, params, 1e-3);
+            break;
+        }
+    }
+}
+
+TEST(OpDemosaic, invalid_arguments)
+{
+    nvcv::TensorShape shape({2, 16, 24, 1}, nvcv::TENSOR_NHWC);
+
+    nvcv::Tensor in(shape, nvcv::TYPE_U8), out({{2, 16, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor inF32(shape, nvcv::TYPE_F32), outS32({{2, 16, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor out1(shape, nvcv::TYPE_U8), outSmall({{2, 16, 23, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor inTiny({{2, 2, 24, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor outTiny({{2, 2, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    NVCVDemosaicParams badGamma = kCameraParams;
+    badGamma.gamma              = 0;
+
+    cvcuda::Demosaic op;
+    EXPECT_NO_THROW(op(nullptr, in, out, NVCV_RAW_BAYER_RGGB));
+    EXPECT_THROW(op(nullptr, in, out, NVCV_RAW_BAYER_RCCB), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out, NVCV_RAW_BAYER_RGGB, static_cast<NVCVDemosaicType>(2)), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out, NVCV_RAW_BAYER_RGGB, NVCV_DEMOSAIC_BILINEAR, &badGamma), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, inF32, out, NVCV_RAW_BAYER_RGGB), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, outS32, NVCV_RAW_BAYER_RGGB), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out1, NVCV_RAW_BAYER_RGGB), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, outSmall, NVCV_RAW_BAYER_RGGB), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, inTiny, outTiny, NVCV_RAW_BAYER_RGGB), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
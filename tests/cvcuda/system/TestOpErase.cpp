@@ -27,7 +27,80 @@
 #include <nvcv/alloc/CustomAllocator.hpp>
 #include <nvcv/alloc/CustomResourceAllocator.hpp>
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
+
+namespace {
+
+struct EraseArea
+{
+    int2  anchor;
+    int3  erasing;
+    float value;
+    int   imgIdx;
+};
+
+// Erases the areas of a zeroed single channel image, returns the output rows.
+std::vector<uint8_t> RunErase(int width, int height, const std::vector<EraseArea> &areas, bool random,
+                              unsigned int seed)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor imgIn(1, {width, height}, nvcv::FMT_U8);
+    nvcv::Tensor imgOut(1, {width, height}, nvcv::FMT_U8);
+
+    auto inAccess  = nvcv::TensorDataAccessStridedImagePlanar::Create(*imgIn.exportData());
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*imgOut.exportData());
+    EXPECT_TRUE(inAccess && outAccess);
+
+    EXPECT_EQ(cudaSuccess, cudaMemset2D(inAccess->planeData(0), inAccess->rowStride(), 0, width, height));
+    EXPECT_EQ(cudaSuccess, cudaMemset2D(outAccess->planeData(0), outAccess->rowStride(), 0xFA, width, height));
+
+    int          numAreas = areas.size();
+    nvcv::Tensor anchor({{numAreas}, "N"}, nvcv::TYPE_2S32);
+    nvcv::Tensor erasing({{numAreas}, "N"}, nvcv::TYPE_3S32);
+    nvcv::Tensor values({{numAreas}, "N"}, nvcv::TYPE_F32);
+    nvcv::Tensor imgIdx({{numAreas}, "N"}, nvcv::TYPE_S32);
+
+    std::vector<int2>  anchorVec;
+    std::vector<int3>  erasingVec;
+    std::vector<float> valuesVec;
+    std::vector<int>   imgIdxVec;
+    for (const EraseArea &a : areas)
+    {
+        anchorVec.push_back(a.anchor);
+        erasingVec.push_back(a.erasing);
+        valuesVec.push_back(a.value);
+        imgIdxVec.push_back(a.imgIdx);
+    }
+
+    auto upload = [](const nvcv::Tensor &t, const auto &vec)
+    {
+        const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(t.exportData());
+        EXPECT_NE(nullptr, data);
+        EXPECT_EQ(cudaSuccess,
+                  cudaMemcpy(data->basePtr(), vec.data(), vec.size() * sizeof(vec[0]), cudaMemcpyHostToDevice));
+    };
+    upload(anchor, anchorVec);
+    upload(erasing, erasingVec);
+    upload(values, valuesVec);
+    upload(imgIdx, imgIdxVec);
+
+    cvcuda::Erase eraseOp(numAreas);
+    EXPECT_NO_THROW(eraseOp(stream, imgIn, imgOut, anchor, erasing, values, imgIdx, random, seed));
+
+    std::vector<uint8_t> test(width * height);
+    EXPECT_EQ(cudaSuccess, cudaMemcpy2DAsync(test.data(), width, outAccess->planeData(0), outAccess->rowStride(),
+                                             width, height, cudaMemcpyDeviceToHost, stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    return test;
+}
+
+} // namespace
 
 NVCV_TEST_SUITE_P(OpErase, nvcv::test::ValueList<int>{{1}, {2}});
 
@@ -248,3 +321,51 @@ TEST(OpErase, OpErase_Varshape)
 
     EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
 }
+
+TEST(OpErase, area_larger_than_grid)
+{
+    // The grid is capped to 4096 blocks of 256 threads, this area needs several passes.
+    const int width = 2048, height = 1024;
+
+    std::vector<uint8_t> test
+        = RunErase(width, height, {EraseArea{{0, 0}, {width + 16, height + 16, 0x1}, 3.f, 0}}, false, 0);
+
+    EXPECT_EQ(width * height, std::count(test.begin(), test.end(), 3));
+}
+
+TEST(OpErase, random_fill_is_deterministic)
+{
+    const int width = 320, height = 240;
+
+    EraseArea area{{16, 8}, {100, 80, 0x1}, 0.f, 0};
+    EraseArea other{{200, 120}, {100, 100, 0x1}, 0.f, 0};
+
+    std::vector<uint8_t> test1 = RunErase(width, height, {area}, true, 1234);
+    std::vector<uint8_t> test2 = RunErase(width, height, {area}, true, 1234);
+    EXPECT_EQ(test1, test2);
+
+    // Adding an area changes the launch geometry, not the pattern of the first one.
+    std::vector<uint8_t> test3 = RunErase(width, height, {area, other}, true, 1234);
+
+    std::vector<uint8_t> test4 = RunErase(width, height, {area}, true, 4321);
+
+    int numDiffSeed = 0;
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            int  i      = y * width + x;
+            bool inArea = x >= 16 && x < 116 && y >= 8 && y < 88;
+            if (inArea)
+            {
+                ASSERT_EQ(test1[i], test3[i]) << "at " << x << "," << y;
+                numDiffSeed += test1[i] != test4[i];
+            }
+            else
+            {
+                ASSERT_EQ(0, test1[i]) << "at " << x << "," << y;
+            }
+        }
+    }
+    EXPECT_GT(numDiffSeed, 0);
+}
@@ -0,0 +1,298 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpFAST.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace test = nvcv::test;
+
+namespace {
+
+using Keypoints = std::map<std::pair<int, int>, float>;
+
+constexpr int kCircle[16][2] = {
+    { 0, -3},
+    { 1, -3},
+    { 2, -2},
+    { 3, -1},
+    { 3,  0},
+    { 3,  1},
+    { 2,  2},
+    { 1,  3},
+    { 0,  3},
+    {-1,  3},
+    {-2,  2},
+    {-3,  1},
+    {-3,  0},
+    {-3, -1},
+    {-2, -2},
+    {-1, -3}
+};
+
+// Largest threshold each pixel is a FAST-9 corner with plus one, 0 if it's none with the given threshold.
+std::vector<int> GoldScores(const std::vector<uint8_t> &img, nvcv::Size2D size, int threshold)
+{
+    std::vector<int> scores(size.w * size.h, 0);
+    for (int y = 3; y < size.h - 3; ++y)
+    {
+        for (int x = 3; x < size.w - 3; ++x)
+        {
+            int diff[16];
+            for (int i = 0; i < 16; ++i)
+            {
+                diff[i] = img[(y + kCircle[i][1]) * size.w + x + kCircle[i][0]] - img[y * size.w + x];
+            }
+
+            int best = 0;
+            for (int start = 0; start < 16; ++start)
+            {
+                int lo = 255, hi = -255;
+                for (int k = 0; k < 9; ++k)
+                {
+                    lo = std::min(lo, diff[(start + k) % 16]);
+                    hi = std::max(hi, diff[(start + k) % 16]);
+                }
+                best = std::max({best, lo, -hi});
+            }
+            scores[y * size.w + x] = best > threshold ? best : 0;
+        }
+    }
+    return scores;
+}
+
+Keypoints GoldKeypoints(const std::vector<uint8_t> &img, nvcv::Size2D size, int threshold, bool nonmaxSuppression)
+{
+    std::vector<int> scores = GoldScores(img, size, threshold);
+
+    Keypoints keypoints;
+    for (int y = 0; y < size.h; ++y)
+    {
+        for (int x = 0; x < size.w; ++x)
+        {
+            const int score = scores[y * size.w + x];
+            bool      keep  = score > 0;
+            for (int dy = -1; keep && nonmaxSuppression && dy <= 1; ++dy)
+            {
+                for (int dx = -1; dx <= 1; ++dx)
+                {
+                    const int nx = x + dx, ny = y + dy;
+                    if ((dx != 0 || dy != 0) && nx >= 0 && ny >= 0 && nx < size.w && ny < size.h)
+                    {
+                        keep = keep && score > scores[ny * size.w + nx];
+                    }
+                }
+            }
+            if (keep)
+            {
+                keypoints[{x, y}] = score - 1;
+            }
+        }
+    }
+    return keypoints;
+}
+
+// Blocks of random intensities, whose corners are FAST corners, with some noise.
+std::vector<uint8_t> RandomImage(nvcv::Size2D size, std::default_random_engine &rng)
+{
+    std::uniform_int_distribution<int> block(0, 255), noise(-8, 8);
+
+    std::vector<int> levels((size.w / 7 + 1) * (size.h / 7 + 1));
+    std::generate(levels.begin(), levels.end(), [&]() { return block(rng); });
+
+    std::vector<uint8_t> img(size.w * size.h);
+    for (int y = 0; y < size.h; ++y)
+    {
+        for (int x = 0; x < size.w; ++x)
+        {
+            const int v         = levels[(y / 7) * (size.w / 7 + 1) + x / 7] + noise(rng);
+            img[y * size.w + x] = static_cast<uint8_t>(std::clamp(v, 0, 255));
+        }
+    }
+    return img;
+}
+
+// Keypoints of the outputs of a sample, checking the padding past the count.
+Keypoints ReadKeypoints(const nvcv::Tensor &keypoints, const nvcv::Tensor &scores, const nvcv::Tensor &count,
+                        int sample, int capacity, int &numKeypoints)
+{
+    auto *kpData    = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(keypoints.exportData());
+    auto *scoreData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(scores.exportData());
+    auto *countData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(count.exportData());
+    EXPECT_TRUE(kpData && scoreData && countData);
+
+    std::vector<int>   testKeypoints(capacity * 2);
+    std::vector<float> testScores(capacity);
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(testKeypoints.data(), kpData->basePtr() + sample * kpData->stride(0),
+                                      capacity * 2 * sizeof(int), cudaMemcpyDeviceToHost));
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(testScores.data(), scoreData->basePtr() + sample * scoreData->stride(0),
+                                      capacity * sizeof(float), cudaMemcpyDeviceToHost));
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(&numKeypoints, countData->basePtr() + sample * countData->stride(0),
+                                      sizeof(int), cudaMemcpyDeviceToHost));
+
+    Keypoints result;
+    for (int i = 0; i < capacity; ++i)
+    {
+        if (i < numKeypoints)
+        {
+            result[{testKeypoints[2 * i], testKeypoints[2 * i + 1]}] = testScores[i];
+        }
+        else
+        {
+            EXPECT_EQ(-1, testKeypoints[2 * i]);
+            EXPECT_EQ(-1, testKeypoints[2 * i + 1]);
+            EXPECT_EQ(0.f, testScores[i]);
+        }
+    }
+    EXPECT_EQ(static_cast<size_t>(std::min(numKeypoints, capacity)), result.size()) << "duplicated keypoints";
+    return result;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpFAST, test::ValueList<int, int, int, int, bool>
+{
+    // width, height, numImages, threshold, nonmaxSuppression
+    {     64,     48,         2,        20,              true},
+    {    123,     77,         3,        10,             false},
+    {    300,    200,         1,        40,              true},
+    {      5,      5,         2,        10,              true}
+});
+
+// clang-format on
+
+TEST_P(OpFAST, correct_output)
+{
+    const nvcv::Size2D size{GetParamValue<0>(), GetParamValue<1>()};
+    const int          numImages         = GetParamValue<2>();
+    const int          threshold         = GetParamValue<3>();
+    const bool         nonmaxSuppression = GetParamValue<4>();
+    const int          capacity          = size.w * size.h;
+
+    std::default_random_engine        rng(0);
+    std::vector<std::vector<uint8_t>> images;
+    for (int i = 0; i < numImages; ++i)
+    {
+        images.push_back(RandomImage(size, rng));
+    }
+
+    nvcv::Tensor src(numImages, size, nvcv::FMT_U8);
+    nvcv::Tensor keypoints({{numImages, 1, capacity, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor scores({{numImages, 1, capacity, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor count({{numImages, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(src.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+    for (int i = 0; i < numImages; ++i)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), images[i].data(),
+                                            size.w, size.w, size.h, cudaMemcpyHostToDevice));
+    }
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::FAST op;
+    EXPECT_NO_THROW(op(stream, src, keypoints, scores, count, threshold, nonmaxSuppression));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        int       numKeypoints = 0;
+        Keypoints test         = ReadKeypoints(keypoints, scores, count, i, capacity, numKeypoints);
+        Keypoints gold         = GoldKeypoints(images[i], size, threshold, nonmaxSuppression);
+
+        EXPECT_EQ(gold.size(), static_cast<size_t>(numKeypoints));
+        EXPECT_EQ(gold, test);
+    }
+}
+
+TEST(OpFAST, keypoints_past_capacity_are_dropped)
+{
+    const nvcv::Size2D size{128, 96};
+    const int          capacity = 16;
+
+    std::default_random_engine rng(1);
+    std::vector<uint8_t>       image = RandomImage(size, rng);
+
+    nvcv::Tensor src(1, size, nvcv::FMT_U8);
+    nvcv::Tensor keypoints({{1, 1, capacity, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor scores({{1, 1, capacity, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor count({{1, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(src.exportData());
+    ASSERT_NE(nullptr, srcData);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->basePtr(), srcData->stride(1), image.data(), size.w, size.w, size.h,
+                                        cudaMemcpyHostToDevice));
+
+    cvcuda::FAST op;
+    EXPECT_NO_THROW(op(nullptr, src, keypoints, scores, count, 10, false));
+    ASSERT_EQ(cudaSuccess, cudaDeviceSynchronize());
+
+    Keypoints gold = GoldKeypoints(image, size, 10, false);
+    ASSERT_GT(gold.size(), static_cast<size_t>(capacity));
+
+    int       numKeypoints = 0;
+    Keypoints test         = ReadKeypoints(keypoints, scores, count, 0, capacity, numKeypoints);
+    EXPECT_EQ(capacity, numKeypoints);
+    for (const auto &[xy, score] : test)
+    {
+        ASSERT_EQ(1u, gold.count(xy)) << "at " << xy.first << "," << xy.second;
+        EXPECT_EQ(gold[xy], score);
+    }
+}
+
+TEST(OpFAST, invalid_arguments_are_rejected)
+{
+    nvcv::Tensor src(2, {64, 48}, nvcv::FMT_U8);
+    nvcv::Tensor keypoints({{2, 1, 100, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor scores({{2, 1, 100, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor count({{2, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    nvcv::Tensor srcF32(2, {64, 48}, nvcv::FMT_F32);
+    nvcv::Tensor srcRGB(2, {64, 48}, nvcv::FMT_RGB8);
+    nvcv::Tensor keypointsF32({{2, 1, 100, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor keypointsSamples({{3, 1, 100, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor scoresCapacity({{2, 1, 99, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor countWide({{2, 1, 2, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    cvcuda::FAST op;
+    EXPECT_THROW(op(nullptr, srcF32, keypoints, scores, count, 10, true), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, srcRGB, keypoints, scores, count, 10, true), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, keypointsF32, scores, count, 10, true), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, keypointsSamples, scores, count, 10, true), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, keypoints, scoresCapacity, count, 10, true), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, keypoints, scores, countWide, 10, true), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, keypoints, scores, count, -1, true), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, keypoints, scores, count, 256, true), nvcv::Exception);
+}
@@ -28,6 +28,7 @@
 #include <nvcv/cuda/TypeTraits.hpp>
 
 #include <random>
+#include <tuple>
 
 namespace test = nvcv::test;
 namespace cuda = nvcv::cuda;
@@ -42,7 +43,9 @@ NVCV_TEST_SUITE_P(OpFlip, test::ValueList<int, int, int, NVCVImageFormat, int>
     {    123,     33,       3,  NVCV_IMAGE_FORMAT_RGB8, -1},
     {     42,     53,       4, NVCV_IMAGE_FORMAT_RGBA8,  1},
     {     13,     42,       3,  NVCV_IMAGE_FORMAT_RGB8,  0},
-    {     62,    111,       4, NVCV_IMAGE_FORMAT_RGBA8, -1}
+    {     62,    111,       4, NVCV_IMAGE_FORMAT_RGBA8, -1},
+    {     16,     12,     100,  NVCV_IMAGE_FORMAT_RGB8, -1},
+    {     40,     40,      70,    NVCV_IMAGE_FORMAT_U8,  1}
 });
 
 // clang-format on
@@ -112,6 +115,207 @@ TEST_P(OpFlip, correct_output)
     EXPECT_EQ(testVec, goldVec);
 }
 
+TEST_P(OpFlip, tensor_in_place)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int width   = GetParamValue<0>();
+    int height  = GetParamValue<1>();
+    int batches = GetParamValue<2>();
+
+    nvcv::ImageFormat format{GetParamValue<3>()};
+
+    int flipCode = GetParamValue<4>();
+
+    int3 shape{width, height, batches};
+
+    nvcv::Tensor tensor = test::CreateTensor(batches, width, height, format);
+
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(data, nullptr);
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    ASSERT_TRUE(access);
+
+    long  sampleStride = access->numRows() * access->rowStride();
+    long3 strides{sampleStride, access->rowStride(), access->colStride()};
+
+    std::vector<uint8_t> inVec(sampleStride * batches);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+
+    std::vector<uint8_t> goldVec(inVec.size());
+    test::FlipCPU(goldVec, strides, inVec, strides, shape, format, flipCode);
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(data->basePtr(), inVec.data(), inVec.size(), cudaMemcpyHostToDevice));
+
+    cvcuda::Flip flipOp;
+    EXPECT_NO_THROW(flipOp(stream, tensor, tensor, flipCode));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<uint8_t> testVec(inVec.size());
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), data->basePtr(), testVec.size(), cudaMemcpyDeviceToHost));
+
+    EXPECT_EQ(testVec, goldVec);
+}
+
+namespace {
+
+// Wraps a host buffer holding an NHWC tensor with packed rows and samples
+nvcv::TensorWrapData WrapHost(std::vector<uint8_t> &buf, int batches, int width, int height, int channels)
+{
+    NVCVTensorBufferStrided buffer = {};
+    buffer.basePtr                 = reinterpret_cast<NVCVByte *>(buf.data());
+    buffer.strides[3]              = 1;
+    buffer.strides[2]              = channels;
+    buffer.strides[1]              = buffer.strides[2] * width;
+    buffer.strides[0]              = buffer.strides[1] * height;
+
+    nvcv::TensorShape shape{{batches, height, width, channels}, nvcv::TENSOR_NHWC};
+    return nvcv::TensorWrapData(nvcv::TensorDataStridedHost{shape, nvcv::TYPE_U8, buffer});
+}
+
+} // namespace
+
+TEST_P(OpFlip, host_tensors)
+{
+    int width   = GetParamValue<0>();
+    int height  = GetParamValue<1>();
+    int batches = GetParamValue<2>();
+
+    nvcv::ImageFormat format{GetParamValue<3>()};
+
+    int flipCode = GetParamValue<4>();
+
+    int channels = format.numChannels();
+
+    long3 strides{static_cast<long>(height) * width * channels, width * channels, channels};
+
+    std::vector<uint8_t> inVec(strides.x * batches);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+
+    std::vector<uint8_t> goldVec(inVec.size());
+    test::FlipCPU(goldVec, strides, inVec, strides, int3{width, height, batches}, format, flipCode);
+
+    std::vector<uint8_t> testVec(inVec.size());
+    std::vector<uint8_t> inPlaceVec = inVec;
+
+    nvcv::TensorWrapData inTensor      = WrapHost(inVec, batches, width, height, channels);
+    nvcv::TensorWrapData outTensor     = WrapHost(testVec, batches, width, height, channels);
+    nvcv::TensorWrapData inPlaceTensor = WrapHost(inPlaceVec, batches, width, height, channels);
+
+    // Host tensors are flipped synchronously, no stream is needed
+    cvcuda::Flip flipOp;
+    EXPECT_NO_THROW(flipOp(nullptr, inTensor, outTensor, flipCode));
+    EXPECT_NO_THROW(flipOp(nullptr, inPlaceTensor, inPlaceTensor, flipCode));
+
+    EXPECT_EQ(testVec, goldVec);
+    EXPECT_EQ(inPlaceVec, goldVec);
+}
+
+TEST(OpFlip, host_and_cuda_tensors_are_rejected)
+{
+    std::vector<uint8_t> hostVec(32 * 16 * 3);
+
+    nvcv::Tensor         cudaTensor = test::CreateTensor(1, 32, 16, nvcv::FMT_RGB8);
+    nvcv::TensorWrapData hostTensor = WrapHost(hostVec, 1, 32, 16, 3);
+
+    cvcuda::Flip flipOp;
+    EXPECT_THROW(flipOp(nullptr, hostTensor, cudaTensor, 1), nvcv::Exception);
+    EXPECT_THROW(flipOp(nullptr, cudaTensor, hostTensor, 1), nvcv::Exception);
+}
+
+TEST(OpFlip, overlapping_output_is_rejected)
+{
+    nvcv::Tensor inTensor = test::CreateTensor(1, 32, 16, nvcv::FMT_RGB8);
+
+    const auto *input = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inTensor.exportData());
+    ASSERT_NE(input, nullptr);
+
+    // Same shape as the input, starting one row below it
+    NVCVTensorData outData = input->cdata();
+    outData.buffer.strided.basePtr += input->stride(1);
+    nvcv::TensorWrapData outTensor(nvcv::TensorDataStridedCuda{outData});
+
+    cvcuda::Flip flipOp;
+    EXPECT_THROW(flipOp(nullptr, inTensor, outTensor, 1), nvcv::Exception);
+}
+
+TEST(OpFlip, same_operator_different_configurations)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::Flip flipOp;
+
+    // alternate configurations so that cached launch plans are reused and must stay distinct
+    const std::tuple<int, int, int, nvcv::ImageFormat> configs[] = {
+        {64, 64, 2,  nvcv::FMT_RGB8},
+        {64, 64, 2,    nvcv::FMT_U8},
+        {33, 17, 1, nvcv::FMT_RGBA8},
+        {64, 64, 2,  nvcv::FMT_RGB8},
+        {33, 17, 1, nvcv::FMT_RGBA8}
+    };
+
+    for (const auto &[width, height, batches, format] : configs)
+    {
+        int3 shape{width, height, batches};
+
+        nvcv::Tensor inTensor  = test::CreateTensor(batches, width, height, format);
+        nvcv::Tensor outTensor = test::CreateTensor(batches, width, height, format);
+
+        const auto *input  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inTensor.exportData());
+        const auto *output = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outTensor.exportData());
+        ASSERT_NE(input, nullptr);
+        ASSERT_NE(output, nullptr);
+
+        auto inAccess  = nvcv::TensorDataAccessStridedImagePlanar::Create(*input);
+        auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*output);
+        ASSERT_TRUE(inAccess);
+        ASSERT_TRUE(outAccess);
+
+        long inSampleStride  = inAccess->numRows() * inAccess->rowStride();
+        long outSampleStride = outAccess->numRows() * outAccess->rowStride();
+
+        long3 inStrides{inSampleStride, inAccess->rowStride(), inAccess->colStride()};
+        long3 outStrides{outSampleStride, outAccess->rowStride(), outAccess->colStride()};
+
+        std::vector<uint8_t> inVec(inStrides.x * batches);
+
+        std::default_random_engine    randEng(0);
+        std::uniform_int_distribution rand(0u, 255u);
+        std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+
+        std::vector<uint8_t> goldVec(outStrides.x * batches);
+        test::FlipCPU(goldVec, outStrides, inVec, inStrides, shape, format, -1);
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(input->basePtr(), inVec.data(), inVec.size(), cudaMemcpyHostToDevice));
+
+        EXPECT_NO_THROW(flipOp(stream, inTensor, outTensor, -1));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        std::vector<uint8_t> testVec(goldVec.size());
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), output->basePtr(), testVec.size(), cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(testVec, goldVec);
+    }
+
+    // invalid configurations must still be rejected after valid ones were cached
+    nvcv::Tensor inTensor  = test::CreateTensor(2, 64, 64, nvcv::FMT_RGB8);
+    nvcv::Tensor outTensor = test::CreateTensor(2, 64, 64, nvcv::FMT_RGBf32);
+    EXPECT_THROW(flipOp(stream, inTensor, outTensor, -1), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
 TEST_P(OpFlip, varshape_correct_output)
 {
     cudaStream_t stream;
@@ -218,3 +422,109 @@ TEST_P(OpFlip, varshape_correct_output)
         EXPECT_EQ(testVec, goldVec);
     }
 }
+
+TEST_P(OpFlip, varshape_into_tensor_correct_output)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int width   = GetParamValue<0>();
+    int height  = GetParamValue<1>();
+    int batches = GetParamValue<2>();
+
+    nvcv::ImageFormat format{GetParamValue<3>()};
+
+    // Create input varshape, images all have the size of the output samples
+    std::default_random_engine             rng;
+    std::uniform_int_distribution<uint8_t> udist(0, 255);
+
+    int rowStride = width * format.planePixelStrideBytes(0);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    std::vector<std::vector<uint8_t>>         srcVec(batches);
+
+    for (int i = 0; i < batches; ++i)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{width, height}, format));
+
+        srcVec[i].resize(height * rowStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return udist(rng); });
+
+        auto *imgData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(imgData, nullptr);
+
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2DAsync(imgData->plane(0).basePtr, imgData->plane(0).rowStride, srcVec[i].data(),
+                                    rowStride, rowStride, height, cudaMemcpyHostToDevice, stream));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(batches);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    nvcv::Tensor dst(batches, {width, height}, format);
+
+    // Each sample gets its own flip code
+    std::vector<int> flipCodes(batches);
+    for (int i = 0; i < batches; ++i)
+    {
+        flipCodes[i] = (GetParamValue<4>() + i + 1) % 3 - 1;
+    }
+
+    nvcv::Tensor flip_code({{batches}, "N"}, nvcv::TYPE_S32);
+    {
+        auto *dev = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(flip_code.exportData());
+        ASSERT_NE(dev, nullptr);
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpyAsync(dev->basePtr(), flipCodes.data(), flipCodes.size() * sizeof(int),
+                                               cudaMemcpyHostToDevice, stream));
+    }
+
+    // Run operator
+    cvcuda::Flip flipOp(batches);
+
+    EXPECT_NO_THROW(flipOp(stream, batchSrc, dst, flip_code));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    // Check test data against gold
+    auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(dst.exportData());
+    ASSERT_NE(dstData, nullptr);
+
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    int3  shape{width, height, 1};
+    long3 pitches{height * rowStride, rowStride, format.planePixelStrideBytes(0)};
+
+    for (int i = 0; i < batches; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> testVec(height * rowStride);
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), rowStride, dstAccess->sampleData(i),
+                                            dstAccess->rowStride(), rowStride, height, cudaMemcpyDeviceToHost));
+
+        std::vector<uint8_t> goldVec(height * rowStride);
+        test::FlipCPU(goldVec, pitches, srcVec[i], pitches, shape, format, flipCodes[i]);
+
+        EXPECT_EQ(testVec, goldVec);
+    }
+}
+
+TEST(OpFlip, varshape_into_tensor_of_other_size_is_rejected)
+{
+    nvcv::Image imgA({32, 16}, nvcv::FMT_RGB8), imgB({30, 16}, nvcv::FMT_RGB8);
+
+    nvcv::ImageBatchVarShape batchSrc(2);
+    batchSrc.pushBack(imgA);
+    batchSrc.pushBack(imgB);
+
+    nvcv::Tensor dst(2, {32, 16}, nvcv::FMT_RGB8);
+    nvcv::Tensor flip_code({{2}, "N"}, nvcv::TYPE_S32);
+
+    cvcuda::Flip flipOp(2);
+
+    EXPECT_THROW(flipOp(nullptr, batchSrc, dst, flip_code), nvcv::Exception);
+}
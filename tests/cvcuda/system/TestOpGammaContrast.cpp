@@ -90,6 +90,7 @@ NVCV_TEST_SUITE_P(OpGammaContrast, test::ValueList<int, int, int, NVCVImageForma
     {   11,    11,       4,   NVCV_IMAGE_FORMAT_RGBA8,       0.4,        true},
     {   7,      8,       3,    NVCV_IMAGE_FORMAT_RGB8,       0.9,        true},
     {   7,      6,       4,   NVCV_IMAGE_FORMAT_RGBA8,       0.8,        true},
+    { 301,    203,       3,    NVCV_IMAGE_FORMAT_RGB8,       0.6,        true},
 
     {   5,      5,       1,      NVCV_IMAGE_FORMAT_U8,        0.5,      false},
     {   9,     11,       2,      NVCV_IMAGE_FORMAT_U8,       0.75,      false},
@@ -97,6 +98,7 @@ NVCV_TEST_SUITE_P(OpGammaContrast, test::ValueList<int, int, int, NVCVImageForma
     {   11,    11,       4,   NVCV_IMAGE_FORMAT_RGBA8,        0.4,      false},
     {   7,      8,       3,    NVCV_IMAGE_FORMAT_RGB8,        0.9,      false},
     {   7,      6,       4,   NVCV_IMAGE_FORMAT_RGBA8,        0.8,      false},
+    { 301,    203,       3,    NVCV_IMAGE_FORMAT_RGB8,        0.6,      false},
 });
 
 // clang-format on
@@ -311,3 +311,133 @@ TEST_P(OpGaussian, varshape_correct_output)
         EXPECT_EQ(testVec, goldVec);
     }
 }
+
+TEST(OpGaussian, one_instance_used_by_concurrent_streams)
+{
+    const int          width = 97, height = 61, batches = 2;
+    const nvcv::Size2D kernelSize(9, 9);
+    const double2      sigmas[] = {
+        {0.8, 0.8},
+        {2.5, 1.5}
+    };
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+
+    nvcv::Tensor inTensor = test::CreateTensor(batches, width, height, nvcv::FMT_U8);
+
+    const auto *inData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inTensor.exportData());
+    ASSERT_NE(inData, nullptr);
+
+    int64_t bufSize = inData->stride(0) * inData->shape(0);
+
+    std::vector<uint8_t> inVec(bufSize);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), inVec.data(), bufSize, cudaMemcpyHostToDevice));
+
+    // Gold outputs come from one operator instance per sigma
+    std::vector<uint8_t> goldVec[2];
+    for (int i = 0; i < 2; ++i)
+    {
+        nvcv::Tensor     outTensor = test::CreateTensor(batches, width, height, nvcv::FMT_U8);
+        cvcuda::Gaussian gaussianOp(kernelSize, batches);
+        ASSERT_NO_THROW(gaussianOp(nullptr, inTensor, outTensor, kernelSize, sigmas[i], NVCV_BORDER_REPLICATE));
+
+        const auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outTensor.exportData());
+        ASSERT_NE(outData, nullptr);
+
+        goldVec[i].resize(bufSize);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(goldVec[i].data(), outData->basePtr(), bufSize, cudaMemcpyDeviceToHost));
+    }
+
+    // A single instance alternates the sigmas on two streams, each keeping its own kernel in its workspace
+    cvcuda::Gaussian gaussianOp(kernelSize, batches);
+
+    cudaStream_t stream[2];
+    nvcv::Tensor outTensor[2] = {test::CreateTensor(batches, width, height, nvcv::FMT_U8),
+                                 test::CreateTensor(batches, width, height, nvcv::FMT_U8)};
+    for (int i = 0; i < 2; ++i)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream[i], cudaStreamNonBlocking));
+    }
+
+    for (int iter = 0; iter < 10; ++iter)
+    {
+        for (int i = 0; i < 2; ++i)
+        {
+            ASSERT_NO_THROW(
+                gaussianOp(stream[i], inTensor, outTensor[i], kernelSize, sigmas[i], NVCV_BORDER_REPLICATE));
+        }
+    }
+
+    for (int i = 0; i < 2; ++i)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream[i]));
+
+        const auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outTensor[i].exportData());
+        ASSERT_NE(outData, nullptr);
+
+        std::vector<uint8_t> testVec(bufSize);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), outData->basePtr(), bufSize, cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(goldVec[i], testVec);
+
+        EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream[i]));
+    }
+}
+
+TEST(OpGaussian, planar_matches_interleaved)
+{
+    const int          width = 73, height = 41, batches = 2, channels = 3;
+    const nvcv::Size2D kernelSize(5, 5);
+    const double2      sigma{1.2, 0.9};
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+
+    nvcv::Tensor inNHWC({{batches, height, width, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor outNHWC({{batches, height, width, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor inNCHW({{batches, channels, height, width}, nvcv::TENSOR_NCHW}, nvcv::TYPE_U8);
+    nvcv::Tensor outNCHW({{batches, channels, height, width}, nvcv::TENSOR_NCHW}, nvcv::TYPE_U8);
+
+    const auto *inNHWCData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inNHWC.exportData());
+    const auto *outNHWCData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outNHWC.exportData());
+    const auto *inNCHWData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inNCHW.exportData());
+    const auto *outNCHWData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outNCHW.exportData());
+    ASSERT_TRUE(inNHWCData && outNHWCData && inNCHWData && outNCHWData);
+
+    const int64_t nhwcSize = inNHWCData->stride(0) * batches;
+    const int64_t nchwSize = inNCHWData->stride(0) * batches;
+
+    auto nhwcIdx = [&](int b, int c, int y, int x)
+    { return b * inNHWCData->stride(0) + y * inNHWCData->stride(1) + x * channels + c; };
+    auto nchwIdx = [&](int b, int c, int y, int x)
+    { return b * inNCHWData->stride(0) + c * inNCHWData->stride(1) + y * inNCHWData->stride(2) + x; };
+
+    // Same pixels in both layouts
+    std::vector<uint8_t> interleaved(nhwcSize), planar(nchwSize);
+    std::generate(interleaved.begin(), interleaved.end(), [&]() { return rand(randEng); });
+    for (int b = 0; b < batches; ++b)
+        for (int c = 0; c < channels; ++c)
+            for (int y = 0; y < height; ++y)
+                for (int x = 0; x < width; ++x) planar[nchwIdx(b, c, y, x)] = interleaved[nhwcIdx(b, c, y, x)];
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inNHWCData->basePtr(), interleaved.data(), nhwcSize, cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inNCHWData->basePtr(), planar.data(), nchwSize, cudaMemcpyHostToDevice));
+
+    cvcuda::Gaussian gaussianOp(kernelSize, batches);
+    ASSERT_NO_THROW(gaussianOp(nullptr, inNHWC, outNHWC, kernelSize, sigma, NVCV_BORDER_REFLECT101));
+    ASSERT_NO_THROW(gaussianOp(nullptr, inNCHW, outNCHW, kernelSize, sigma, NVCV_BORDER_REFLECT101));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+
+    std::vector<uint8_t> goldVec(nhwcSize), testVec(nchwSize);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(goldVec.data(), outNHWCData->basePtr(), nhwcSize, cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), outNCHWData->basePtr(), nchwSize, cudaMemcpyDeviceToHost));
+
+    for (int b = 0; b < batches; ++b)
+        for (int c = 0; c < channels; ++c)
+            for (int y = 0; y < height; ++y)
+                for (int x = 0; x < width; ++x)
+                    ASSERT_EQ(testVec[nchwIdx(b, c, y, x)], goldVec[nhwcIdx(b, c, y, x)])
+                        << "b=" << b << " c=" << c << " y=" << y << " x=" << x;
+}
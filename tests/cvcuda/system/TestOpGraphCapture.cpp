@@ -0,0 +1,417 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <cvcuda/OpConvertTo.hpp>
+#include <cvcuda/OpErase.hpp>
+#include <cvcuda/OpNormalize.hpp>
+#include <cvcuda/OpPillowResize.hpp>
+#include <cvcuda/OpReformat.hpp>
+#include <cvcuda/OpResize.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Checks that operators captured in a CUDA graph produce the same results as
+// when executed directly, also after their inputs and tensor parameters are
+// updated in place between graph launches.
+
+namespace test = nvcv::test;
+
+namespace {
+
+// RAII wrapper of an instantiated graph
+class Graph
+{
+public:
+    template<class F>
+    Graph(cudaStream_t stream, F &&fnWork)
+    {
+        EXPECT_EQ(cudaSuccess, cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal));
+        fnWork();
+
+        cudaGraph_t graph = nullptr;
+        EXPECT_EQ(cudaSuccess, cudaStreamEndCapture(stream, &graph));
+        if (graph != nullptr)
+        {
+            EXPECT_EQ(cudaSuccess, cudaGraphInstantiate(&m_exec, graph, 0));
+            EXPECT_EQ(cudaSuccess, cudaGraphDestroy(graph));
+        }
+    }
+
+    ~Graph()
+    {
+        if (m_exec != nullptr)
+        {
+            EXPECT_EQ(cudaSuccess, cudaGraphExecDestroy(m_exec));
+        }
+    }
+
+    void launch(cudaStream_t stream)
+    {
+        ASSERT_NE(nullptr, m_exec);
+        EXPECT_EQ(cudaSuccess, cudaGraphLaunch(m_exec, stream));
+    }
+
+private:
+    cudaGraphExec_t m_exec = nullptr;
+};
+
+int64_t BufferSize(const nvcv::ITensorDataStridedCuda &data)
+{
+    return data.stride(0) * data.shape(0);
+}
+
+template<class T>
+void Upload(nvcv::ITensor &tensor, const std::vector<T> &vec)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(nullptr, data);
+    ASSERT_LE(static_cast<int64_t>(vec.size() * sizeof(T)), BufferSize(*data));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(data->basePtr(), vec.data(), vec.size() * sizeof(T), cudaMemcpyHostToDevice));
+}
+
+void FillRandom(nvcv::ITensor &tensor, std::default_random_engine &rng)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(nullptr, data);
+
+    std::uniform_int_distribution<int> rand{0, 255};
+
+    std::vector<uint8_t> vec(BufferSize(*data));
+    std::generate(vec.begin(), vec.end(), [&] { return rand(rng); });
+    Upload(tensor, vec);
+}
+
+std::vector<uint8_t> Download(nvcv::ITensor &tensor)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    EXPECT_NE(nullptr, data);
+    if (data == nullptr)
+    {
+        return {};
+    }
+
+    std::vector<uint8_t> vec(BufferSize(*data));
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(vec.data(), data->basePtr(), vec.size(), cudaMemcpyDeviceToHost));
+    return vec;
+}
+
+void FillRandom(nvcv::IImage &image, std::default_random_engine &rng)
+{
+    const auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(image.exportData());
+    ASSERT_NE(nullptr, data);
+
+    std::uniform_int_distribution<int> rand{0, 255};
+
+    std::vector<uint8_t> vec(data->plane(0).rowStride * data->plane(0).height);
+    std::generate(vec.begin(), vec.end(), [&] { return rand(rng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(data->plane(0).basePtr, vec.data(), vec.size(), cudaMemcpyHostToDevice));
+}
+
+std::vector<uint8_t> Download(nvcv::IImage &image)
+{
+    const auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(image.exportData());
+    EXPECT_NE(nullptr, data);
+    if (data == nullptr)
+    {
+        return {};
+    }
+
+    // Only the valid part of each row is compared, padding isn't written by operators
+    int rowSize = data->plane(0).width * image.format().planePixelStrideBytes(0);
+
+    std::vector<uint8_t> vec(rowSize * data->plane(0).height);
+    EXPECT_EQ(cudaSuccess, cudaMemcpy2D(vec.data(), rowSize, data->plane(0).basePtr, data->plane(0).rowStride, rowSize,
+                                        data->plane(0).height, cudaMemcpyDeviceToHost));
+    return vec;
+}
+
+} // namespace
+
+TEST(OpGraphCapture, tensor_pipeline_replay_matches_eager)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+    const int N = 3;
+
+    nvcv::Tensor src     = test::CreateTensor(N, 64, 48, nvcv::FMT_RGB8);
+    nvcv::Tensor resized = test::CreateTensor(N, 32, 24, nvcv::FMT_RGB8);
+    nvcv::Tensor floats  = test::CreateTensor(N, 32, 24, nvcv::FMT_RGBf32);
+    nvcv::Tensor normed  = test::CreateTensor(N, 32, 24, nvcv::FMT_RGBf32);
+    nvcv::Tensor dst({{N, 3, 24, 32}, "NCHW"}, nvcv::TYPE_F32);
+
+    nvcv::Tensor base(1, {1, 1}, nvcv::FMT_RGBf32);
+    nvcv::Tensor scale(1, {1, 1}, nvcv::FMT_RGBf32);
+
+    cvcuda::Resize    resizeOp;
+    cvcuda::ConvertTo convertOp;
+    cvcuda::Normalize normalizeOp;
+    cvcuda::Reformat  reformatOp;
+
+    auto pipeline = [&]
+    {
+        EXPECT_NO_THROW(resizeOp(stream, src, resized, NVCV_INTERP_LINEAR));
+        EXPECT_NO_THROW(convertOp(stream, resized, floats, 1 / 255.0, 0));
+        EXPECT_NO_THROW(normalizeOp(stream, floats, base, scale, normed, 1.f, 0.f, 0.f));
+        EXPECT_NO_THROW(reformatOp(stream, normed, dst));
+    };
+
+    Graph graph(stream, pipeline);
+
+    std::default_random_engine rng{0};
+
+    for (int iter = 0; iter < 3; ++iter)
+    {
+        // New inputs and parameters, written in place
+        FillRandom(src, rng);
+        Upload(base, std::vector<float>{0.485f * iter, 0.456f, 0.406f});
+        Upload(scale, std::vector<float>{1 / 0.229f, 1 / 0.224f, 1.f / (iter + 1)});
+
+        graph.launch(stream);
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        std::vector<uint8_t> replayed = Download(dst);
+
+        pipeline();
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        std::vector<uint8_t> eager = Download(dst);
+
+        EXPECT_EQ(eager, replayed) << "iteration " << iter;
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpGraphCapture, erase_replay_with_updated_areas)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+    const int N = 2;
+
+    nvcv::Tensor src = test::CreateTensor(N, 64, 48, nvcv::FMT_U8);
+    nvcv::Tensor dst = test::CreateTensor(N, 64, 48, nvcv::FMT_U8);
+
+    const int    numAreas = 2;
+    nvcv::Tensor anchor({{numAreas}, "N"}, nvcv::TYPE_2S32);
+    nvcv::Tensor erasing({{numAreas}, "N"}, nvcv::TYPE_3S32);
+    nvcv::Tensor values({{numAreas}, "N"}, nvcv::TYPE_F32);
+    nvcv::Tensor imgIdx({{numAreas}, "N"}, nvcv::TYPE_S32);
+
+    cvcuda::Erase eraseOp(numAreas);
+
+    auto erase = [&]
+    {
+        EXPECT_NO_THROW(eraseOp(stream, src, dst, anchor, erasing, values, imgIdx, false, 0));
+    };
+
+    Graph graph(stream, erase);
+
+    std::default_random_engine rng{0};
+
+    for (int iter = 0; iter < 3; ++iter)
+    {
+        FillRandom(src, rng);
+        Upload(anchor, std::vector<int2>{{iter, 2 * iter}, {10 + iter, 3}});
+        Upload(erasing, std::vector<int3>{{5 + iter, 7, 0x1}, {20, 4 * iter + 1, 0x1}});
+        Upload(values, std::vector<float>{1.f + iter, 200.f - iter});
+        Upload(imgIdx, std::vector<int>{iter % N, (iter + 1) % N});
+
+        graph.launch(stream);
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        std::vector<uint8_t> replayed = Download(dst);
+
+        erase();
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        std::vector<uint8_t> eager = Download(dst);
+
+        EXPECT_EQ(eager, replayed) << "iteration " << iter;
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpGraphCapture, pillow_resize_varshape_replay_matches_eager)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+    const int         N   = 4;
+    nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    std::default_random_engine         rng{0};
+    std::uniform_int_distribution<int> randSize{16, 80};
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst;
+    for (int i = 0; i < N; ++i)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{randSize(rng), randSize(rng)}, fmt));
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{randSize(rng), randSize(rng)}, fmt));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(N);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    nvcv::ImageBatchVarShape batchDst(N);
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+
+    cvcuda::PillowResize pillowResizeOp({80, 80}, N, fmt);
+
+    auto resize = [&]
+    {
+        EXPECT_NO_THROW(pillowResizeOp(stream, batchSrc, batchDst, NVCV_INTERP_LINEAR));
+    };
+
+    // Batches were modified, they must be uploaded before capture.
+    resize();
+
+    Graph graph(stream, resize);
+
+    for (int iter = 0; iter < 2; ++iter)
+    {
+        for (int i = 0; i < N; ++i)
+        {
+            FillRandom(*imgSrc[i], rng);
+        }
+
+        graph.launch(stream);
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        std::vector<std::vector<uint8_t>> replayed;
+        for (int i = 0; i < N; ++i)
+        {
+            replayed.push_back(Download(*imgDst[i]));
+        }
+
+        resize();
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        for (int i = 0; i < N; ++i)
+        {
+            EXPECT_EQ(Download(*imgDst[i]), replayed[i]) << "iteration " << iter << ", image " << i;
+        }
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpGraphCapture, modified_varshape_batch_is_rejected_while_capturing)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+    nvcv::Image imgSrc({32, 32}, nvcv::FMT_RGBA8);
+    nvcv::Image imgDst({16, 16}, nvcv::FMT_RGBA8);
+
+    nvcv::ImageBatchVarShape batchSrc(1);
+    batchSrc.pushBack(imgSrc);
+
+    nvcv::ImageBatchVarShape batchDst(1);
+    batchDst.pushBack(imgDst);
+
+    cvcuda::Resize resizeOp;
+
+    ASSERT_EQ(cudaSuccess, cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal));
+    NVCV_EXPECT_STATUS(NVCV_ERROR_INVALID_OPERATION,
+                       cvcudaResizeVarShapeSubmit(resizeOp.handle(), stream, batchSrc.handle(), batchDst.handle(),
+                                                  NVCV_INTERP_LINEAR));
+    cudaGraph_t graph = nullptr;
+    cudaStreamEndCapture(stream, &graph);
+    if (graph != nullptr)
+    {
+        EXPECT_EQ(cudaSuccess, cudaGraphDestroy(graph));
+    }
+
+    // Once uploaded, the batch can be used while capturing.
+    EXPECT_NO_THROW(resizeOp(stream, batchSrc, batchDst, NVCV_INTERP_LINEAR));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    {
+        Graph captured(stream, [&] { EXPECT_NO_THROW(resizeOp(stream, batchSrc, batchDst, NVCV_INTERP_LINEAR)); });
+        captured.launch(stream);
+        EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpGraphCapture, reserved_workspace_survives_other_streams_until_replay)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+    const int N = 2;
+
+    nvcv::Tensor src = test::CreateTensor(N, 64, 48, nvcv::FMT_RGB8);
+    nvcv::Tensor dst = test::CreateTensor(N, 64, 48, nvcv::FMT_RGB8);
+
+    // Base and scale are outputs of the statistics, computed in the operator's workspace
+    nvcv::Tensor base(N, {1, 1}, nvcv::FMT_RGBf32);
+    nvcv::Tensor scale(N, {1, 1}, nvcv::FMT_RGBf32);
+
+    cvcuda::Normalize normalizeOp;
+
+    auto normalize = [&](cudaStream_t s, nvcv::Tensor &in, nvcv::Tensor &b, nvcv::Tensor &sc, nvcv::Tensor &out)
+    {
+        EXPECT_NO_THROW(normalizeOp(s, in, b, sc, out, 64.f, 128.f, 0.f, CVCUDA_NORMALIZE_COMPUTE_STATS));
+    };
+
+    // Allocated outside capture, it's captured when the graph uses it
+    ASSERT_NO_THROW(normalizeOp.reserveWorkspace(stream));
+
+    Graph graph(stream, [&] { normalize(stream, src, base, scale, dst); });
+
+    // More streams than the operator keeps workspaces for, the captured one must not be released for them
+    std::default_random_engine rng{0};
+    for (int i = 0; i < 9; ++i)
+    {
+        cudaStream_t other;
+        ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&other, cudaStreamNonBlocking));
+
+        nvcv::Tensor otherSrc = test::CreateTensor(N, 64, 48, nvcv::FMT_RGB8);
+        nvcv::Tensor otherDst = test::CreateTensor(N, 64, 48, nvcv::FMT_RGB8);
+        nvcv::Tensor otherBase(N, {1, 1}, nvcv::FMT_RGBf32);
+        nvcv::Tensor otherScale(N, {1, 1}, nvcv::FMT_RGBf32);
+        FillRandom(otherSrc, rng);
+
+        normalize(other, otherSrc, otherBase, otherScale, otherDst);
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(other));
+        EXPECT_EQ(cudaSuccess, cudaStreamDestroy(other));
+    }
+
+    FillRandom(src, rng);
+
+    graph.launch(stream);
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    std::vector<uint8_t> replayed      = Download(dst);
+    std::vector<uint8_t> replayedScale = Download(scale);
+
+    normalize(stream, src, base, scale, dst);
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    EXPECT_EQ(Download(dst), replayed);
+    EXPECT_EQ(Download(scale), replayedScale);
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
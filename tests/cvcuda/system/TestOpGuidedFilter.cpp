@@ -0,0 +1,501 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpGuidedFilter.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <type_traits>
+
+namespace test = nvcv::test;
+
+namespace {
+
+// Planes of an image, one vector of width x height values per channel.
+using Planes = std::vector<std::vector<double>>;
+
+template<typename T>
+constexpr double kScale = std::is_integral_v<T> ? std::numeric_limits<T>::max() : 1.0;
+
+// Means of the windows of each pixel, clipped to the image.
+std::vector<double> BoxMean(const std::vector<double> &plane, int width, int height, int radius)
+{
+    std::vector<double> integral((width + 1) * (height + 1), 0);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            const int i = (y + 1) * (width + 1) + x + 1;
+
+            integral[i] = plane[y * width + x] + integral[i - width - 1] + integral[i - 1] - integral[i - width - 2];
+        }
+    }
+
+    std::vector<double> mean(width * height);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            const int x0 = std::max(x - radius, 0), x1 = std::min(x + radius + 1, width);
+            const int y0 = std::max(y - radius, 0), y1 = std::min(y + radius + 1, height);
+
+            const double sum = integral[y1 * (width + 1) + x1] - integral[y0 * (width + 1) + x1]
+                             - integral[y1 * (width + 1) + x0] + integral[y0 * (width + 1) + x0];
+
+            mean[y * width + x] = sum / ((x1 - x0) * (y1 - y0));
+        }
+    }
+    return mean;
+}
+
+// Averages factor x factor blocks of each plane.
+Planes Subsample(const Planes &planes, int width, int height, int factor)
+{
+    const int lw = (width + factor - 1) / factor, lh = (height + factor - 1) / factor;
+
+    Planes low(planes.size(), std::vector<double>(lw * lh));
+    for (size_t c = 0; c < planes.size(); ++c)
+    {
+        for (int y = 0; y < lh; ++y)
+        {
+            for (int x = 0; x < lw; ++x)
+            {
+                const int x1 = std::min((x + 1) * factor, width), y1 = std::min((y + 1) * factor, height);
+
+                double sum = 0;
+                for (int fy = y * factor; fy < y1; ++fy)
+                {
+                    for (int fx = x * factor; fx < x1; ++fx)
+                    {
+                        sum += planes[c][fy * width + fx];
+                    }
+                }
+                low[c][y * lw + x] = sum / ((x1 - x * factor) * (y1 - y * factor));
+            }
+        }
+    }
+    return low;
+}
+
+// Guided filter of He et al. on one image with normalized values, the coefficients being computed on images
+// subsampled by factor and upsampled bilinearly.
+Planes GoldGuidedFilter(const Planes &guide, const Planes &in, int width, int height, int radius, double eps,
+                        int factor)
+{
+    const int gc = guide.size(), nc = in.size();
+    const int lw = (width + factor - 1) / factor, lh = (height + factor - 1) / factor;
+    const int r  = std::max(radius / factor, 1);
+
+    const Planes g = Subsample(guide, width, height, factor);
+    const Planes p = Subsample(in, width, height, factor);
+
+    auto mean = [&](auto value)
+    {
+        std::vector<double> plane(lw * lh);
+        for (int i = 0; i < lw * lh; ++i)
+        {
+            plane[i] = value(i);
+        }
+        return BoxMean(plane, lw, lh, r);
+    };
+
+    Planes meanI(gc), meanII(gc * gc);
+    for (int i = 0; i < gc; ++i)
+    {
+        meanI[i] = mean([&](int k) { return g[i][k]; });
+        for (int j = 0; j < gc; ++j)
+        {
+            meanII[i * gc + j] = mean([&](int k) { return g[i][k] * g[j][k]; });
+        }
+    }
+
+    // a then b for each input channel
+    Planes coefs(nc * (gc + 1), std::vector<double>(lw * lh));
+    for (int c = 0; c < nc; ++c)
+    {
+        const std::vector<double> meanP = mean([&](int k) { return p[c][k]; });
+
+        Planes meanIP(gc);
+        for (int i = 0; i < gc; ++i)
+        {
+            meanIP[i] = mean([&](int k) { return g[i][k] * p[c][k]; });
+        }
+
+        for (int k = 0; k < lw * lh; ++k)
+        {
+            // solves (cov(I, I) + eps) a = cov(I, p) by gaussian elimination
+            double m[3][4];
+            for (int i = 0; i < gc; ++i)
+            {
+                for (int j = 0; j < gc; ++j)
+                {
+                    m[i][j] = meanII[i * gc + j][k] - meanI[i][k] * meanI[j][k] + (i == j ? eps : 0);
+                }
+                m[i][gc] = meanIP[i][k] - meanI[i][k] * meanP[k];
+            }
+            for (int i = 0; i < gc; ++i)
+            {
+                for (int j = i + 1; j < gc; ++j)
+                {
+                    const double f = m[j][i] / m[i][i];
+                    for (int l = i; l <= gc; ++l)
+                    {
+                        m[j][l] -= f * m[i][l];
+                    }
+                }
+            }
+            double b = meanP[k];
+            for (int i = gc - 1; i >= 0; --i)
+            {
+                double a = m[i][gc];
+                for (int j = i + 1; j < gc; ++j)
+                {
+                    a -= m[i][j] * coefs[c * (gc + 1) + j][k];
+                }
+                a /= m[i][i];
+
+                coefs[c * (gc + 1) + i][k] = a;
+                b -= a * meanI[i][k];
+            }
+            coefs[c * (gc + 1) + gc][k] = b;
+        }
+    }
+
+    for (auto &plane : coefs)
+    {
+        plane = BoxMean(plane, lw, lh, r);
+    }
+
+    Planes out(nc, std::vector<double>(width * height));
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            const double fx  = std::clamp((x + 0.5) / factor - 0.5, 0.0, lw - 1.0);
+            const double fy  = std::clamp((y + 0.5) / factor - 0.5, 0.0, lh - 1.0);
+            const int    lx0 = static_cast<int>(fx), ly0 = static_cast<int>(fy);
+            const int    lx1 = std::min(lx0 + 1, lw - 1), ly1 = std::min(ly0 + 1, lh - 1);
+
+            auto coef = [&](int k)
+            {
+                const std::vector<double> &m = coefs[k];
+
+                const double top    = m[ly0 * lw + lx0] + (fx - lx0) * (m[ly0 * lw + lx1] - m[ly0 * lw + lx0]);
+                const double bottom = m[ly1 * lw + lx0] + (fx - lx0) * (m[ly1 * lw + lx1] - m[ly1 * lw + lx0]);
+                return top + (fy - ly0) * (bottom - top);
+            };
+
+            for (int c = 0; c < nc; ++c)
+            {
+                double value = coef(c * (gc + 1) + gc);
+                for (int i = 0; i < gc; ++i)
+                {
+                    value += coef(c * (gc + 1) + i) * guide[i][y * width + x];
+                }
+                out[c][y * width + x] = value;
+            }
+        }
+    }
+    return out;
+}
+
+// Piecewise constant regions with noise, so that the filter has edges to preserve.
+template<typename T>
+std::vector<T> CreateImage(int width, int height, int channels, int seed)
+{
+    std::default_random_engine             rng(seed);
+    std::uniform_real_distribution<double> noise(-0.05, 0.05);
+
+    std::vector<T> image(width * height * channels);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            for (int c = 0; c < channels; ++c)
+            {
+                const int    region = (x * 3 / width + y * 2 / height + c + seed) % 4;
+                const double value  = std::clamp(0.1 + region * 0.25 + noise(rng), 0.0, 1.0);
+
+                image[(y * width + x) * channels + c]
+                    = static_cast<T>(std::is_integral_v<T> ? std::nearbyint(value * kScale<T>) : value);
+            }
+        }
+    }
+    return image;
+}
+
+template<typename T>
+Planes ToPlanes(const T *image, int width, int height, int channels)
+{
+    Planes planes(channels, std::vector<double>(width * height));
+    for (int i = 0; i < width * height; ++i)
+    {
+        for (int c = 0; c < channels; ++c)
+        {
+            planes[c][i] = image[i * channels + c] / kScale<T>;
+        }
+    }
+    return planes;
+}
+
+// Absolute differences of up to one unit are tolerated for integer outputs, as values are rounded.
+template<typename T>
+void CompareOutput(const T *test, const Planes &gold, int width, int height)
+{
+    const double tolerance = std::is_integral_v<T> ? 1.0 : 1e-3;
+
+    const int channels = gold.size();
+    for (int i = 0; i < width * height; ++i)
+    {
+        for (int c = 0; c < channels; ++c)
+        {
+            double value = gold[c][i] * kScale<T>;
+            if constexpr (std::is_integral_v<T>)
+            {
+                value = std::clamp(value, 0.0, kScale<T>);
+            }
+            ASSERT_NEAR(test[i * channels + c], value, tolerance)
+                << "pixel (" << i % width << ", " << i / width << ") channel " << c;
+        }
+    }
+}
+
+template<typename T>
+void CopyTensor(const nvcv::Tensor &tensor, std::vector<T> &host, cudaMemcpyKind kind)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(data, nullptr);
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    ASSERT_TRUE(access);
+
+    const int rowBytes = access->numCols() * access->colStride();
+    const int rows     = access->numSamples() * access->numRows();
+    ASSERT_EQ(access->sampleStride(), access->numRows() * access->rowStride());
+
+    if (kind == cudaMemcpyHostToDevice)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(data->basePtr(), access->rowStride(), host.data(), rowBytes, rowBytes,
+                                            rows, kind));
+    }
+    else
+    {
+        host.resize(rows * rowBytes / sizeof(T));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(host.data(), rowBytes, data->basePtr(), access->rowStride(), rowBytes,
+                                            rows, kind));
+    }
+}
+
+template<typename T>
+void RunGuidedFilter(nvcv::DataType dtype, int numSamples, int width, int height, int guideChannels, int channels,
+                     int radius, float eps, int subsample)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::TensorShape shape({numSamples, height, width, channels}, nvcv::TENSOR_NHWC);
+    nvcv::TensorShape guideShape({numSamples, height, width, guideChannels}, nvcv::TENSOR_NHWC);
+    nvcv::Tensor      in(shape, dtype), guide(guideShape, dtype), out(shape, dtype);
+
+    const int      imageSize = width * height;
+    std::vector<T> inVec, guideVec;
+    for (int n = 0; n < numSamples; ++n)
+    {
+        std::vector<T> inImage    = CreateImage<T>(width, height, channels, n);
+        std::vector<T> guideImage = CreateImage<T>(width, height, guideChannels, n + 1);
+        inVec.insert(inVec.end(), inImage.begin(), inImage.end());
+        guideVec.insert(guideVec.end(), guideImage.begin(), guideImage.end());
+    }
+    CopyTensor(in, inVec, cudaMemcpyHostToDevice);
+    CopyTensor(guide, guideVec, cudaMemcpyHostToDevice);
+
+    cvcuda::GuidedFilter op(numSamples, width, height);
+    EXPECT_NO_THROW(op(stream, in, guide, out, radius, eps, subsample));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<T> test;
+    CopyTensor(out, test, cudaMemcpyDeviceToHost);
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        SCOPED_TRACE(n);
+
+        Planes gold = GoldGuidedFilter(ToPlanes(guideVec.data() + n * imageSize * guideChannels, width, height,
+                                                guideChannels),
+                                       ToPlanes(inVec.data() + n * imageSize * channels, width, height, channels),
+                                       width, height, radius, eps, subsample);
+
+        CompareOutput(test.data() + n * imageSize * channels, gold, width, height);
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpGuidedFilter, test::ValueList<nvcv::DataType, int, int, int, int, int, int, float, int>
+{
+    //          dtype, numSamples, width, height, guideChannels, channels, radius,   eps, subsample
+    { nvcv::TYPE_U8,            1,   128,     96,             1,        1,      4,  0.01f,        1},
+    { nvcv::TYPE_U8,            2,   300,    200,             3,        1,      8,  0.01f,        1},
+    { nvcv::TYPE_U8,            1,    97,     61,             3,        3,      3, 0.001f,        1},
+    {nvcv::TYPE_U16,            2,    70,    150,             1,        3,     20,  0.01f,        1},
+    {nvcv::TYPE_F32,            1,   257,    129,             1,        1,     90,  0.05f,        1},
+    { nvcv::TYPE_U8,            2,   320,    240,             1,        1,     16,  0.01f,        4},
+    {nvcv::TYPE_F32,            1,   131,     77,             3,        3,      9,  0.01f,        3},
+    { nvcv::TYPE_U8,            1,     7,      5,             1,        1,      2,  0.01f,        1}
+});
+
+// clang-format on
+
+TEST_P(OpGuidedFilter, correct_output)
+{
+    nvcv::DataType dtype         = GetParamValue<0>();
+    int            numSamples    = GetParamValue<1>();
+    int            width         = GetParamValue<2>();
+    int            height        = GetParamValue<3>();
+    int            guideChannels = GetParamValue<4>();
+    int            channels      = GetParamValue<5>();
+    int            radius        = GetParamValue<6>();
+    float          eps           = GetParamValue<7>();
+    int            subsample     = GetParamValue<8>();
+
+    if (dtype == nvcv::TYPE_U8)
+    {
+        RunGuidedFilter<uint8_t>(dtype, numSamples, width, height, guideChannels, channels, radius, eps, subsample);
+    }
+    else if (dtype == nvcv::TYPE_U16)
+    {
+        RunGuidedFilter<uint16_t>(dtype, numSamples, width, height, guideChannels, channels, radius, eps, subsample);
+    }
+    else
+    {
+        RunGuidedFilter<float>(dtype, numSamples, width, height, guideChannels, channels, radius, eps, subsample);
+    }
+}
+
+TEST(OpGuidedFilter, varshape_correct_output)
+{
+    constexpr int numImages = 3, radius = 5;
+    constexpr float eps = 0.01f;
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::Size2D sizes[numImages] = {{120, 80}, {33, 150}, {64, 64}};
+
+    for (int subsample : {1, 2})
+    {
+        SCOPED_TRACE(subsample);
+
+        std::vector<std::unique_ptr<nvcv::Image>> imgIn, imgGuide, imgOut;
+        std::vector<std::vector<uint8_t>>         inVec(numImages), guideVec(numImages);
+        for (int i = 0; i < numImages; ++i)
+        {
+            const nvcv::Size2D size = sizes[i];
+
+            imgIn.emplace_back(std::make_unique<nvcv::Image>(size, nvcv::FMT_U8));
+            imgGuide.emplace_back(std::make_unique<nvcv::Image>(size, nvcv::FMT_RGB8));
+            imgOut.emplace_back(std::make_unique<nvcv::Image>(size, nvcv::FMT_U8));
+
+            inVec[i]    = CreateImage<uint8_t>(size.w, size.h, 1, i);
+            guideVec[i] = CreateImage<uint8_t>(size.w, size.h, 3, i + 2);
+
+            for (auto [image, host, pixelBytes] :
+                 {std::make_tuple(imgIn[i].get(), &inVec[i], 1), std::make_tuple(imgGuide[i].get(), &guideVec[i], 3)})
+            {
+                const auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(image->exportData());
+                ASSERT_NE(nullptr, data);
+                ASSERT_EQ(cudaSuccess, cudaMemcpy2D(data->plane(0).basePtr, data->plane(0).rowStride, host->data(),
+                                                    size.w * pixelBytes, size.w * pixelBytes, size.h,
+                                                    cudaMemcpyHostToDevice));
+            }
+        }
+
+        nvcv::ImageBatchVarShape batchIn(numImages), batchGuide(numImages), batchOut(numImages);
+        batchIn.pushBack(imgIn.begin(), imgIn.end());
+        batchGuide.pushBack(imgGuide.begin(), imgGuide.end());
+        batchOut.pushBack(imgOut.begin(), imgOut.end());
+
+        cvcuda::GuidedFilter op(numImages, 120, 150);
+        EXPECT_NO_THROW(op(stream, batchIn, batchGuide, batchOut, radius, eps, subsample));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        for (int i = 0; i < numImages; ++i)
+        {
+            SCOPED_TRACE(i);
+
+            const nvcv::Size2D size = sizes[i];
+            const auto        *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgOut[i]->exportData());
+            ASSERT_NE(nullptr, data);
+
+            std::vector<uint8_t> test(size.w * size.h);
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(test.data(), size.w, data->plane(0).basePtr,
+                                                data->plane(0).rowStride, size.w, size.h, cudaMemcpyDeviceToHost));
+
+            Planes gold = GoldGuidedFilter(ToPlanes(guideVec[i].data(), size.w, size.h, 3),
+                                           ToPlanes(inVec[i].data(), size.w, size.h, 1), size.w, size.h, radius, eps,
+                                           subsample);
+            CompareOutput(test.data(), gold, size.w, size.h);
+        }
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpGuidedFilter, invalid_arguments)
+{
+    nvcv::TensorShape shape({2, 16, 24, 1}, nvcv::TENSOR_NHWC);
+
+    nvcv::Tensor in(shape, nvcv::TYPE_U8), guide(shape, nvcv::TYPE_U8), out(shape, nvcv::TYPE_U8);
+    nvcv::Tensor guideF32(shape, nvcv::TYPE_F32), outF32(shape, nvcv::TYPE_F32), inS16(shape, nvcv::TYPE_S16);
+    nvcv::Tensor guideSmall({{2, 16, 23, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor out3({{2, 16, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor in4({{2, 16, 24, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor inLarge({{3, 16, 24, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor guideLarge({{3, 16, 24, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor outLarge({{3, 16, 24, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    EXPECT_THROW(cvcuda::GuidedFilter(2, 24, -1), nvcv::Exception);
+
+    cvcuda::GuidedFilter op(2, 24, 16);
+    EXPECT_NO_THROW(op(nullptr, in, guide, out, 2, 0.01f));
+    EXPECT_NO_THROW(op(nullptr, in, guideF32, out, 2, 0.01f, 2));
+    EXPECT_THROW(op(nullptr, in, guide, out, 0, 0.01f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, guide, out, 2, 0.f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, guide, out, 2, 0.01f, 0), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, guide, outF32, 2, 0.01f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, inS16, guide, out, 2, 0.01f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, guideSmall, out, 2, 0.01f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, guide, out3, 2, 0.01f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in4, guide, in4, 2, 0.01f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, inLarge, guideLarge, outLarge, 2, 0.01f), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
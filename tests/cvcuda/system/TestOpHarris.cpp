@@ -0,0 +1,313 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/BorderUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpHarris.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace test = nvcv::test;
+
+namespace {
+
+// Corner responses of every pixel in double precision, as OpenCV's cornerHarris and cornerMinEigenVal.
+std::vector<double> GoldResponses(const std::vector<float> &img, nvcv::Size2D size, bool isU8,
+                                  NVCVCornerResponseType type, int blockSize, double k, NVCVBorderType border)
+{
+    auto pixel = [&](int x, int y) -> double
+    {
+        int2 coord{x, y};
+        return test::IsInside(coord, int2{size.w, size.h}, border) ? img[coord.y * size.w + coord.x] : 0;
+    };
+
+    const double scale = 1.0 / (4 * blockSize * (isU8 ? 255.0 : 1.0));
+
+    // products of the gradients at (x, y), extrapolated as the gradient image
+    auto products = [&](int x, int y, double &xx, double &xy, double &yy)
+    {
+        xx = xy = yy = 0;
+
+        int2 coord{x, y};
+        if (!test::IsInside(coord, int2{size.w, size.h}, border))
+        {
+            return;
+        }
+        x = coord.x;
+        y = coord.y;
+
+        const double gx = (pixel(x + 1, y - 1) + 2 * pixel(x + 1, y) + pixel(x + 1, y + 1) - pixel(x - 1, y - 1)
+                           - 2 * pixel(x - 1, y) - pixel(x - 1, y + 1))
+                        * scale;
+        const double gy = (pixel(x - 1, y + 1) + 2 * pixel(x, y + 1) + pixel(x + 1, y + 1) - pixel(x - 1, y - 1)
+                           - 2 * pixel(x, y - 1) - pixel(x + 1, y - 1))
+                        * scale;
+        xx = gx * gx;
+        xy = gx * gy;
+        yy = gy * gy;
+    };
+
+    std::vector<double> responses(size.w * size.h);
+    for (int y = 0; y < size.h; ++y)
+    {
+        for (int x = 0; x < size.w; ++x)
+        {
+            double a = 0, b = 0, c = 0;
+            for (int v = 0; v < blockSize; ++v)
+            {
+                for (int u = 0; u < blockSize; ++u)
+                {
+                    double xx, xy, yy;
+                    products(x + u - blockSize / 2, y + v - blockSize / 2, xx, xy, yy);
+                    a += xx;
+                    b += xy;
+                    c += yy;
+                }
+            }
+
+            if (type == NVCV_CORNER_SHI_TOMASI)
+            {
+                a *= 0.5;
+                c *= 0.5;
+                responses[y * size.w + x] = (a + c) - std::sqrt((a - c) * (a - c) + b * b);
+            }
+            else
+            {
+                responses[y * size.w + x] = a * c - b * b - k * (a + c) * (a + c);
+            }
+        }
+    }
+    return responses;
+}
+
+// Response at (x, y) minus the largest of the threshold and the responses of its neighbours.
+double Margin(const std::vector<double> &responses, nvcv::Size2D size, int x, int y, double threshold)
+{
+    double largest = threshold;
+    for (int dy = -1; dy <= 1; ++dy)
+    {
+        for (int dx = -1; dx <= 1; ++dx)
+        {
+            const int nx = x + dx, ny = y + dy;
+            if ((dx != 0 || dy != 0) && nx >= 0 && ny >= 0 && nx < size.w && ny < size.h)
+            {
+                largest = std::max(largest, responses[ny * size.w + nx]);
+            }
+        }
+    }
+    return responses[y * size.w + x] - largest;
+}
+
+// Blurred noise, whose responses have many local maxima.
+std::vector<float> RandomImage(nvcv::Size2D size, std::default_random_engine &rng)
+{
+    std::uniform_real_distribution<float> udist(0, 255);
+
+    std::vector<float> noise(size.w * size.h), img(size.w * size.h);
+    std::generate(noise.begin(), noise.end(), [&]() { return udist(rng); });
+    for (int y = 0; y < size.h; ++y)
+    {
+        for (int x = 0; x < size.w; ++x)
+        {
+            float sum = 0;
+            for (int v = -1; v <= 1; ++v)
+            {
+                for (int u = -1; u <= 1; ++u)
+                {
+                    sum += noise[std::clamp(y + v, 0, size.h - 1) * size.w + std::clamp(x + u, 0, size.w - 1)];
+                }
+            }
+            img[y * size.w + x] = std::round(sum / 9);
+        }
+    }
+    return img;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpHarris, test::ValueList<int, int, int, nvcv::ImageFormat, NVCVCornerResponseType, int, NVCVBorderType>
+{
+    // width, height, numImages,      format,                   type, blockSize,                  border
+    {     64,     48,         2, nvcv::FMT_U8,     NVCV_CORNER_HARRIS,        3, NVCV_BORDER_REFLECT101},
+    {    100,     37,         3, nvcv::FMT_F32,    NVCV_CORNER_HARRIS,        5, NVCV_BORDER_CONSTANT},
+    {     57,     90,         1, nvcv::FMT_U8, NVCV_CORNER_SHI_TOMASI,        2, NVCV_BORDER_REPLICATE},
+    {     40,     40,         2, nvcv::FMT_F32, NVCV_CORNER_SHI_TOMASI,       7, NVCV_BORDER_REFLECT},
+    {     33,     17,         2, nvcv::FMT_U8,     NVCV_CORNER_HARRIS,        1, NVCV_BORDER_WRAP}
+});
+
+// clang-format on
+
+TEST_P(OpHarris, correct_output)
+{
+    const nvcv::Size2D           size{GetParamValue<0>(), GetParamValue<1>()};
+    const int                    numImages = GetParamValue<2>();
+    const nvcv::ImageFormat      format    = GetParamValue<3>();
+    const NVCVCornerResponseType type      = GetParamValue<4>();
+    const int                    blockSize = GetParamValue<5>();
+    const NVCVBorderType         border    = GetParamValue<6>();
+    const bool                   isU8      = format == nvcv::FMT_U8;
+    const float                  k         = 0.04f;
+    const int                    capacity  = size.w * size.h;
+
+    std::default_random_engine      rng(0);
+    std::vector<std::vector<float>> images;
+    for (int i = 0; i < numImages; ++i)
+    {
+        images.push_back(RandomImage(size, rng));
+    }
+
+    // threshold at the 90th percentile of the responses
+    std::vector<std::vector<double>> responses;
+    std::vector<double>              sorted;
+    for (const auto &img : images)
+    {
+        responses.push_back(GoldResponses(img, size, isU8, type, blockSize, k, border));
+        sorted.insert(sorted.end(), responses.back().begin(), responses.back().end());
+    }
+    std::sort(sorted.begin(), sorted.end());
+    const float  threshold = sorted[sorted.size() * 9 / 10];
+    const double eps       = 1e-4 * std::max(std::abs(sorted.front()), std::abs(sorted.back()));
+
+    nvcv::Tensor src(numImages, size, format);
+    nvcv::Tensor keypoints({{numImages, 1, capacity, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor scores({{numImages, 1, capacity, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor count({{numImages, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(src.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+    for (int i = 0; i < numImages; ++i)
+    {
+        std::vector<uint8_t> bytes(size.w * size.h * (isU8 ? 1 : sizeof(float)));
+        if (isU8)
+        {
+            std::copy(images[i].begin(), images[i].end(), bytes.begin());
+        }
+        else
+        {
+            std::memcpy(bytes.data(), images[i].data(), bytes.size());
+        }
+        const int rowBytes = bytes.size() / size.h;
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), bytes.data(), rowBytes,
+                                            rowBytes, size.h, cudaMemcpyHostToDevice));
+    }
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::Harris op;
+    EXPECT_NO_THROW(op(stream, src, keypoints, scores, count, type, blockSize, k, threshold, border));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *kpData    = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(keypoints.exportData());
+    const auto *scoreData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(scores.exportData());
+    const auto *countData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(count.exportData());
+    ASSERT_TRUE(kpData && scoreData && countData);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        int                testCount = 0;
+        std::vector<int>   testKeypoints(capacity * 2);
+        std::vector<float> testScores(capacity);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(&testCount, countData->basePtr() + i * countData->stride(0), sizeof(int),
+                                          cudaMemcpyDeviceToHost));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(testKeypoints.data(), kpData->basePtr() + i * kpData->stride(0),
+                                          capacity * 2 * sizeof(int), cudaMemcpyDeviceToHost));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(testScores.data(), scoreData->basePtr() + i * scoreData->stride(0),
+                                          capacity * sizeof(float), cudaMemcpyDeviceToHost));
+        ASSERT_LE(testCount, capacity);
+
+        // every keypoint is a maximum above the threshold, up to rounding
+        std::map<std::pair<int, int>, float> test;
+        for (int j = 0; j < testCount; ++j)
+        {
+            const int x = testKeypoints[2 * j], y = testKeypoints[2 * j + 1];
+            ASSERT_TRUE(x >= 0 && y >= 0 && x < size.w && y < size.h);
+            EXPECT_GT(Margin(responses[i], size, x, y, threshold), -eps) << "at " << x << "," << y;
+            EXPECT_NEAR(responses[i][y * size.w + x], testScores[j], eps) << "at " << x << "," << y;
+            test[{x, y}] = testScores[j];
+        }
+        EXPECT_EQ(static_cast<size_t>(testCount), test.size()) << "duplicated keypoints";
+
+        // and the maxima clear of rounding are all found
+        int numClear = 0;
+        for (int y = 0; y < size.h; ++y)
+        {
+            for (int x = 0; x < size.w; ++x)
+            {
+                if (Margin(responses[i], size, x, y, threshold) > eps)
+                {
+                    EXPECT_EQ(1u, test.count({x, y})) << "at " << x << "," << y;
+                    ++numClear;
+                }
+            }
+        }
+        EXPECT_GT(numClear, 0);
+
+        for (int j = testCount; j < capacity; ++j)
+        {
+            EXPECT_EQ(-1, testKeypoints[2 * j]);
+            EXPECT_EQ(-1, testKeypoints[2 * j + 1]);
+            EXPECT_EQ(0.f, testScores[j]);
+        }
+    }
+}
+
+TEST(OpHarris, invalid_arguments_are_rejected)
+{
+    nvcv::Tensor src(2, {64, 48}, nvcv::FMT_U8);
+    nvcv::Tensor keypoints({{2, 1, 100, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor scores({{2, 1, 100, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor count({{2, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    nvcv::Tensor srcS16(2, {64, 48}, nvcv::FMT_S16);
+    nvcv::Tensor srcRGB(2, {64, 48}, nvcv::FMT_RGB8);
+    nvcv::Tensor scoresS32({{2, 1, 100, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor countSamples({{3, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    const auto type = NVCV_CORNER_HARRIS;
+    const auto bord = NVCV_BORDER_REFLECT101;
+
+    cvcuda::Harris op;
+    EXPECT_THROW(op(nullptr, srcS16, keypoints, scores, count, type, 3, 0.04f, 0.f, bord), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, srcRGB, keypoints, scores, count, type, 3, 0.04f, 0.f, bord), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, keypoints, scoresS32, count, type, 3, 0.04f, 0.f, bord), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, keypoints, scores, countSamples, type, 3, 0.04f, 0.f, bord), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, keypoints, scores, count, type, 0, 0.04f, 0.f, bord), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, keypoints, scores, count, type, 8, 0.04f, 0.f, bord), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, keypoints, scores, count, static_cast<NVCVCornerResponseType>(2), 3, 0.04f, 0.f,
+                    bord),
+                 nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, keypoints, scores, count, type, 3, 0.04f, 0.f, static_cast<NVCVBorderType>(255)),
+                 nvcv::Exception);
+}
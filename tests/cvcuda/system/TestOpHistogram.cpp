@@ -0,0 +1,229 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpHistogram.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+constexpr int kNumBins = 256;
+
+std::vector<uint8_t> RandomImage(int size, std::default_random_engine &rng)
+{
+    std::uniform_int_distribution<int> udist(0, 255);
+
+    std::vector<uint8_t> img(size);
+    std::generate(img.begin(), img.end(), [&]() { return udist(rng); });
+    return img;
+}
+
+// Histogram of the image laid out as the output sample, bin after bin with the channels of each bin interleaved.
+// Pixels are counted regardless of their position, so planar images are read as interleaved ones.
+std::vector<int> Histogram(const std::vector<uint8_t> &img, int channels, bool perChannel)
+{
+    const int outChannels = perChannel ? channels : 1;
+
+    std::vector<int> hist(kNumBins * outChannels, 0);
+    for (size_t i = 0; i < img.size(); ++i)
+    {
+        hist[img[i] * outChannels + (perChannel ? i % channels : 0)]++;
+    }
+    return hist;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpHistogram, test::ValueList<int, int, int, nvcv::ImageFormat, bool>
+{
+    // width, height, numImages,          format, perChannel
+    {      33,     17,         1,    nvcv::FMT_U8,       true },
+    {     160,    120,         3,  nvcv::FMT_RGB8,       true },
+    {      97,     33,         4, nvcv::FMT_RGBA8,       true },
+    {      50,     70,         2, nvcv::FMT_RGB8p,       true },
+    {      50,     70,         3, nvcv::FMT_RGB8p,      false },
+    {     160,    120,         2, nvcv::FMT_RGBA8,      false },
+    // A single large image is counted by many blocks
+    {    1920,   1080,         1,  nvcv::FMT_RGB8,       true },
+    {    1024,   1024,         1,    nvcv::FMT_U8,       true }
+});
+
+// clang-format on
+
+TEST_P(OpHistogram, tensor_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int               width      = GetParamValue<0>();
+    int               height     = GetParamValue<1>();
+    int               numImages  = GetParamValue<2>();
+    nvcv::ImageFormat fmt        = GetParamValue<3>();
+    bool              perChannel = GetParamValue<4>();
+
+    int channels    = fmt.numChannels();
+    int outChannels = perChannel ? channels : 1;
+    int rowBytes    = width * fmt.planePixelStrideBytes(0);
+
+    std::default_random_engine rng;
+
+    nvcv::Tensor imgSrc  = test::CreateTensor(numImages, width, height, fmt);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<std::vector<uint8_t>> srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        srcVec[i] = RandomImage(width * height * channels, rng);
+        for (int p = 0; p < fmt.numPlanes(); ++p)
+        {
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i) + p * srcAccess->planeStride(),
+                                                srcAccess->rowStride(), srcVec[i].data() + p * height * rowBytes,
+                                                rowBytes, rowBytes, height, cudaMemcpyHostToDevice));
+        }
+    }
+
+    nvcv::Tensor imgDst({{numImages, 1, kNumBins, outChannels}, "NHWC"}, nvcv::TYPE_S32);
+
+    cvcuda::Histogram histogramOp;
+    EXPECT_NO_THROW(histogramOp(stream, imgSrc, imgDst));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, dstData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<int> testVec(kNumBins * outChannels);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), dstAccess->sampleData(i), testVec.size() * sizeof(int),
+                                          cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(Histogram(srcVec[i], channels, perChannel), testVec);
+    }
+}
+
+TEST_P(OpHistogram, varshape_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int               width      = GetParamValue<0>();
+    int               height     = GetParamValue<1>();
+    int               numImages  = GetParamValue<2>();
+    nvcv::ImageFormat fmt        = GetParamValue<3>();
+    bool              perChannel = GetParamValue<4>();
+
+    if (fmt.numPlanes() > 1)
+    {
+        GTEST_SKIP() << "Varshape images must have a single plane";
+    }
+
+    int channels    = fmt.numChannels();
+    int outChannels = perChannel ? channels : 1;
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> sdist(0, std::min(width, height) / 2);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    std::vector<std::vector<uint8_t>>         srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        nvcv::Size2D size{width - sdist(rng), height - sdist(rng)};
+
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(nullptr, srcData);
+
+        int srcStride = size.w * channels;
+        srcVec[i]     = RandomImage(size.h * srcStride, rng);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec[i].data(),
+                                            srcStride, srcStride, size.h, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    nvcv::Tensor imgDst({{numImages, 1, kNumBins, outChannels}, "NHWC"}, nvcv::TYPE_S32);
+
+    cvcuda::Histogram histogramOp;
+    EXPECT_NO_THROW(histogramOp(stream, batchSrc, imgDst));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, dstData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<int> testVec(kNumBins * outChannels);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), dstAccess->sampleData(i), testVec.size() * sizeof(int),
+                                          cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(Histogram(srcVec[i], channels, perChannel), testVec);
+    }
+}
+
+TEST(OpHistogram, invalid_arguments)
+{
+    nvcv::Tensor imgSrc = test::CreateTensor(2, 64, 48, nvcv::FMT_RGB8);
+    nvcv::Tensor imgF32 = test::CreateTensor(2, 64, 48, nvcv::FMT_RGBf32);
+
+    nvcv::Tensor out3({{2, 1, kNumBins, 3}, "NHWC"}, nvcv::TYPE_S32);
+    nvcv::Tensor out1({{2, 1, kNumBins, 1}, "NHWC"}, nvcv::TYPE_S32);
+    nvcv::Tensor outBins({{2, 1, 128, 3}, "NHWC"}, nvcv::TYPE_S32);
+    nvcv::Tensor outSamples({{1, 1, kNumBins, 3}, "NHWC"}, nvcv::TYPE_S32);
+    nvcv::Tensor outF32({{2, 1, kNumBins, 3}, "NHWC"}, nvcv::TYPE_F32);
+
+    cvcuda::Histogram histogramOp;
+    EXPECT_NO_THROW(histogramOp(nullptr, imgSrc, out3));
+    EXPECT_NO_THROW(histogramOp(nullptr, imgSrc, out1));
+    EXPECT_THROW(histogramOp(nullptr, imgF32, out3), nvcv::Exception);
+    EXPECT_THROW(histogramOp(nullptr, imgSrc, outBins), nvcv::Exception);
+    EXPECT_THROW(histogramOp(nullptr, imgSrc, outSamples), nvcv::Exception);
+    EXPECT_THROW(histogramOp(nullptr, imgSrc, outF32), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -0,0 +1,266 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpHistogramEq.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+constexpr int kNumBins = 256;
+
+// Low contrast image, whose values are spread by the equalization
+std::vector<uint8_t> RandomImage(int size, int lo, int hi, std::default_random_engine &rng)
+{
+    std::uniform_int_distribution<int> udist(lo, hi);
+
+    std::vector<uint8_t> img(size);
+    std::generate(img.begin(), img.end(), [&]() { return udist(rng); });
+    return img;
+}
+
+// Same as cv::equalizeHist
+std::vector<uint8_t> GoldHistogramEq(const std::vector<uint8_t> &img)
+{
+    std::vector<int> hist(kNumBins, 0);
+    for (uint8_t v : img)
+    {
+        hist[v]++;
+    }
+
+    int first = 0;
+    while (hist[first] == 0)
+    {
+        ++first;
+    }
+
+    const int total = static_cast<int>(img.size());
+    if (hist[first] == total)
+    {
+        return img;
+    }
+
+    std::vector<uint8_t> lut(kNumBins, 0);
+
+    const float scale = 255.f / (total - hist[first]);
+    int         sum   = 0;
+    for (int i = first + 1; i < kNumBins; ++i)
+    {
+        sum += hist[i];
+        lut[i] = static_cast<uint8_t>(std::clamp(std::nearbyint(sum * scale), 0.f, 255.f));
+    }
+
+    std::vector<uint8_t> res(img.size());
+    std::transform(img.begin(), img.end(), res.begin(), [&](uint8_t v) { return lut[v]; });
+    return res;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpHistogramEq, test::ValueList<int, int, int, int, int>
+{
+    // width, height, numImages,  lo,  hi
+    {      33,     17,         1,  50, 120 },
+    {     160,    120,         3,   0, 255 },
+    {      97,     33,         4, 100, 101 },
+    {      64,     64,         2,  77,  77 },
+    // A single large image is counted by many blocks
+    {    1920,   1080,         1,  10,  90 }
+});
+
+// clang-format on
+
+TEST_P(OpHistogramEq, tensor_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int width     = GetParamValue<0>();
+    int height    = GetParamValue<1>();
+    int numImages = GetParamValue<2>();
+    int lo        = GetParamValue<3>();
+    int hi        = GetParamValue<4>();
+
+    std::default_random_engine rng;
+
+    nvcv::Tensor imgSrc  = test::CreateTensor(numImages, width, height, nvcv::FMT_U8);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<std::vector<uint8_t>> srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        srcVec[i] = RandomImage(width * height, lo, hi, rng);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(), width,
+                                            width, height, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::Tensor imgDst = test::CreateTensor(numImages, width, height, nvcv::FMT_U8);
+
+    cvcuda::HistogramEq histogramEqOp(numImages);
+    EXPECT_NO_THROW(histogramEqOp(stream, imgSrc, imgDst));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, dstData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> testVec(width * height);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), width, dstAccess->sampleData(i), dstAccess->rowStride(),
+                                            width, height, cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(GoldHistogramEq(srcVec[i]), testVec);
+    }
+}
+
+TEST_P(OpHistogramEq, varshape_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int width     = GetParamValue<0>();
+    int height    = GetParamValue<1>();
+    int numImages = GetParamValue<2>();
+    int lo        = GetParamValue<3>();
+    int hi        = GetParamValue<4>();
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> sdist(0, std::min(width, height) / 2);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst;
+    std::vector<std::vector<uint8_t>>         srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        nvcv::Size2D size{width - sdist(rng), height - sdist(rng)};
+
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(size, nvcv::FMT_U8));
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(size, nvcv::FMT_U8));
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(nullptr, srcData);
+
+        srcVec[i] = RandomImage(size.w * size.h, lo, hi, rng);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec[i].data(),
+                                            size.w, size.w, size.h, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numImages), batchDst(numImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+
+    cvcuda::HistogramEq histogramEqOp(numImages);
+    EXPECT_NO_THROW(histogramEqOp(stream, batchSrc, batchDst));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        const auto *dstData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[i]->exportData());
+        ASSERT_NE(nullptr, dstData);
+
+        nvcv::Size2D         size = imgDst[i]->size();
+        std::vector<uint8_t> testVec(size.w * size.h);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), size.w, dstData->plane(0).basePtr,
+                                            dstData->plane(0).rowStride, size.w, size.h, cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(GoldHistogramEq(srcVec[i]), testVec);
+    }
+}
+
+TEST(OpHistogramEq, in_place)
+{
+    constexpr int width = 40, height = 30, numImages = 2;
+
+    std::default_random_engine rng;
+
+    nvcv::Tensor img     = test::CreateTensor(numImages, width, height, nvcv::FMT_U8);
+    const auto  *imgData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(img.exportData());
+    ASSERT_NE(nullptr, imgData);
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*imgData);
+    ASSERT_TRUE(access);
+
+    std::vector<std::vector<uint8_t>> srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        srcVec[i] = RandomImage(width * height, 30, 60, rng);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(access->sampleData(i), access->rowStride(), srcVec[i].data(), width,
+                                            width, height, cudaMemcpyHostToDevice));
+    }
+
+    cvcuda::HistogramEq histogramEqOp(numImages);
+    EXPECT_NO_THROW(histogramEqOp(nullptr, img, img));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> testVec(width * height);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), width, access->sampleData(i), access->rowStride(), width,
+                                            height, cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(GoldHistogramEq(srcVec[i]), testVec);
+    }
+}
+
+TEST(OpHistogramEq, invalid_arguments)
+{
+    nvcv::Tensor imgSrc   = test::CreateTensor(2, 64, 48, nvcv::FMT_U8);
+    nvcv::Tensor imgDst   = test::CreateTensor(2, 64, 48, nvcv::FMT_U8);
+    nvcv::Tensor imgRGB   = test::CreateTensor(2, 64, 48, nvcv::FMT_RGB8);
+    nvcv::Tensor imgF32   = test::CreateTensor(2, 64, 48, nvcv::FMT_F32);
+    nvcv::Tensor imgSize  = test::CreateTensor(2, 32, 48, nvcv::FMT_U8);
+    nvcv::Tensor imgBatch = test::CreateTensor(3, 64, 48, nvcv::FMT_U8);
+
+    cvcuda::HistogramEq histogramEqOp(2);
+    EXPECT_NO_THROW(histogramEqOp(nullptr, imgSrc, imgDst));
+    EXPECT_THROW(histogramEqOp(nullptr, imgRGB, imgRGB), nvcv::Exception);
+    EXPECT_THROW(histogramEqOp(nullptr, imgF32, imgF32), nvcv::Exception);
+    EXPECT_THROW(histogramEqOp(nullptr, imgSrc, imgF32), nvcv::Exception);
+    EXPECT_THROW(histogramEqOp(nullptr, imgSrc, imgSize), nvcv::Exception);
+    EXPECT_THROW(histogramEqOp(nullptr, imgBatch, imgBatch), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -0,0 +1,462 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpImageHash.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+uint64_t Rotl(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+uint64_t Round(uint64_t acc, uint64_t input)
+{
+    return Rotl(acc + input * kPrime2, 31) * kPrime1;
+}
+
+template<typename T>
+T Read(const uint8_t *p)
+{
+    T v;
+    std::memcpy(&v, p, sizeof(T));
+    return v;
+}
+
+// Straightforward XXH64, little-endian host
+uint64_t GoldXXH64(const uint8_t *p, size_t len, uint64_t seed)
+{
+    const uint8_t *end = p + len;
+    uint64_t       h;
+
+    if (len >= 32)
+    {
+        uint64_t v[4] = {seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1};
+        for (; p + 32 <= end; p += 32)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                v[i] = Round(v[i], Read<uint64_t>(p + 8 * i));
+            }
+        }
+        h = Rotl(v[0], 1) + Rotl(v[1], 7) + Rotl(v[2], 12) + Rotl(v[3], 18);
+        for (int i = 0; i < 4; ++i)
+        {
+            h = (h ^ Round(0, v[i])) * kPrime1 + kPrime4;
+        }
+    }
+    else
+    {
+        h = seed + kPrime5;
+    }
+
+    h += len;
+    for (; p + 8 <= end; p += 8)
+    {
+        h = Rotl(h ^ Round(0, Read<uint64_t>(p)), 27) * kPrime1 + kPrime4;
+    }
+    if (p + 4 <= end)
+    {
+        h = Rotl(h ^ (Read<uint32_t>(p) * kPrime1), 23) * kPrime2 + kPrime3;
+        p += 4;
+    }
+    for (; p < end; ++p)
+    {
+        h = Rotl(h ^ (*p * kPrime5), 11) * kPrime1;
+    }
+
+    h ^= h >> 33;
+    h *= kPrime2;
+    h ^= h >> 29;
+    h *= kPrime3;
+    h ^= h >> 32;
+    return h;
+}
+
+// Packed image, one row after the other
+struct HostImage
+{
+    int                  width, height, channels;
+    std::vector<uint8_t> data;
+
+    const uint8_t *row(int y) const
+    {
+        return data.data() + static_cast<size_t>(y) * width * channels;
+    }
+};
+
+HostImage RandomImage(int width, int height, int channels, std::default_random_engine &rng)
+{
+    std::uniform_int_distribution<int> udist(0, 255);
+
+    HostImage img{width, height, channels, std::vector<uint8_t>(width * height * channels)};
+    std::generate(img.data.begin(), img.data.end(), [&]() { return udist(rng); });
+    return img;
+}
+
+uint64_t GoldExactHash(const HostImage &img)
+{
+    const uint64_t rowBytes = img.width * img.channels;
+
+    uint64_t sum = 0;
+    for (int y = 0; y < img.height; ++y)
+    {
+        sum += GoldXXH64(img.row(y), rowBytes, y);
+    }
+
+    const uint64_t words[3] = {sum, static_cast<uint64_t>(img.height), rowBytes};
+    return GoldXXH64(reinterpret_cast<const uint8_t *>(words), sizeof(words), 0);
+}
+
+uint64_t GoldDHash(const HostImage &img)
+{
+    uint64_t sums[8][9] = {}, widths[9] = {};
+    for (int x = 0; x < img.width; ++x)
+    {
+        widths[x * 9 / img.width]++;
+    }
+    for (int y = 0; y < img.height; ++y)
+    {
+        for (int x = 0; x < img.width; ++x)
+        {
+            const uint8_t *p = img.row(y) + x * img.channels;
+            sums[y * 8 / img.height][x * 9 / img.width]
+                += img.channels == 1 ? p[0] * 256u : 77u * p[0] + 150u * p[1] + 29u * p[2];
+        }
+    }
+
+    uint64_t hash = 0;
+    for (int y = 0; y < 8; ++y)
+    {
+        for (int x = 0; x < 8; ++x)
+        {
+            if (sums[y][x + 1] * widths[x] > sums[y][x] * widths[x + 1])
+            {
+                hash |= uint64_t{1} << (8 * y + x);
+            }
+        }
+    }
+    return hash;
+}
+
+nvcv::ImageFormat Format(int channels)
+{
+    return channels == 1 ? nvcv::FMT_U8 : channels == 3 ? nvcv::FMT_RGB8 : nvcv::FMT_RGBA8;
+}
+
+// Tensor with rows padded to a multiple of rowAlign bytes, at an offset from the allocation start so that rows
+// aren't aligned
+class PaddedTensor
+{
+public:
+    PaddedTensor(const std::vector<HostImage> &imgs, int rowAlign)
+    {
+        const HostImage &img = imgs[0];
+
+        const int64_t pixelStride  = img.channels;
+        const int64_t rowStride    = (img.width * pixelStride + rowAlign - 1) / rowAlign * rowAlign + 1;
+        const int64_t sampleStride = rowStride * img.height;
+
+        size_t bufSize = sampleStride * imgs.size() + 1;
+        EXPECT_EQ(cudaSuccess, cudaMalloc(&m_buffer, bufSize));
+        EXPECT_EQ(cudaSuccess, cudaMemset(m_buffer, 0xAB, bufSize));
+
+        NVCVTensorBufferStrided buffer = {};
+        buffer.basePtr                 = reinterpret_cast<NVCVByte *>(m_buffer) + 1;
+        buffer.strides[3]              = 1;
+        buffer.strides[2]              = pixelStride;
+        buffer.strides[1]              = rowStride;
+        buffer.strides[0]              = sampleStride;
+
+        for (size_t i = 0; i < imgs.size(); ++i)
+        {
+            EXPECT_EQ(cudaSuccess, cudaMemcpy2D(buffer.basePtr + i * sampleStride, rowStride, imgs[i].data.data(),
+                                                img.width * pixelStride, img.width * pixelStride, img.height,
+                                                cudaMemcpyHostToDevice));
+        }
+
+        nvcv::TensorShape shape{{static_cast<int64_t>(imgs.size()), img.height, img.width, img.channels},
+                                nvcv::TENSOR_NHWC};
+        m_tensor = std::make_unique<nvcv::TensorWrapData>(nvcv::TensorDataStridedCuda{shape, nvcv::TYPE_U8, buffer});
+    }
+
+    ~PaddedTensor()
+    {
+        m_tensor.reset();
+        EXPECT_EQ(cudaSuccess, cudaFree(m_buffer));
+    }
+
+    nvcv::ITensor &tensor()
+    {
+        return *m_tensor;
+    }
+
+private:
+    void                                 *m_buffer = nullptr;
+    std::unique_ptr<nvcv::TensorWrapData> m_tensor;
+};
+
+nvcv::Tensor CreateHashes(int numImages)
+{
+    return nvcv::Tensor({{numImages, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U64);
+}
+
+std::vector<uint64_t> DownloadHashes(nvcv::Tensor &hashes)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(hashes.exportData());
+    EXPECT_NE(nullptr, data);
+
+    std::vector<uint64_t> res(data->shape(0));
+    EXPECT_EQ(cudaSuccess, cudaMemcpy2D(res.data(), sizeof(uint64_t), data->basePtr(), data->stride(0),
+                                        sizeof(uint64_t), res.size(), cudaMemcpyDeviceToHost));
+    return res;
+}
+
+std::vector<uint64_t> TensorHashes(const std::vector<HostImage> &imgs, int rowAlign, NVCVImageHashType type)
+{
+    PaddedTensor in(imgs, rowAlign);
+    nvcv::Tensor out = CreateHashes(imgs.size());
+
+    cvcuda::ImageHash imageHashOp;
+    EXPECT_NO_THROW(imageHashOp(nullptr, in.tensor(), out, type));
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+
+    return DownloadHashes(out);
+}
+
+std::vector<uint64_t> VarShapeHashes(const std::vector<HostImage> &imgs, NVCVImageHashType type)
+{
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    for (const HostImage &img : imgs)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{img.width, img.height}, Format(img.channels)));
+
+        const auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc.back()->exportData());
+        EXPECT_NE(nullptr, data);
+
+        const int rowBytes = img.width * img.channels;
+        EXPECT_EQ(cudaSuccess, cudaMemcpy2D(data->plane(0).basePtr, data->plane(0).rowStride, img.data.data(),
+                                            rowBytes, rowBytes, img.height, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batch(imgs.size());
+    batch.pushBack(imgSrc.begin(), imgSrc.end());
+
+    nvcv::Tensor out = CreateHashes(imgs.size());
+
+    cvcuda::ImageHash imageHashOp;
+    EXPECT_NO_THROW(imageHashOp(nullptr, batch, out, type));
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+
+    return DownloadHashes(out);
+}
+
+int HammingDistance(uint64_t a, uint64_t b)
+{
+    return std::bitset<64>(a ^ b).count();
+}
+
+} // namespace
+
+TEST(OpImageHash, gold_xxh64)
+{
+    // From the xxHash test suite
+    EXPECT_EQ(0xEF46DB3751D8E999ULL, GoldXXH64(nullptr, 0, 0));
+
+    const uint8_t abc[] = {'a', 'b', 'c'};
+    EXPECT_EQ(0x44BC2CF5AD770999ULL, GoldXXH64(abc, sizeof(abc), 0));
+}
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpImageHash, test::ValueList<int, int, int, int>
+{
+    // width, height, channels, numImages
+    {      9,      8,        1,         1 },
+    {     33,     17,        3,         3 },
+    {     64,     64,        4,         2 },
+    {    160,    120,        1,         4 },
+    // Rows of a single image are split among many blocks
+    {    640,   2000,        3,         1 }
+});
+
+// clang-format on
+
+TEST_P(OpImageHash, exact_hash_correct_output)
+{
+    int width     = GetParamValue<0>();
+    int height    = GetParamValue<1>();
+    int channels  = GetParamValue<2>();
+    int numImages = GetParamValue<3>();
+
+    std::default_random_engine rng;
+
+    std::vector<HostImage> imgs;
+    std::vector<uint64_t>  gold;
+    for (int i = 0; i < numImages; ++i)
+    {
+        imgs.push_back(RandomImage(width, height, channels, rng));
+        gold.push_back(GoldExactHash(imgs.back()));
+    }
+
+    // Hashes don't depend on the row strides
+    EXPECT_EQ(gold, TensorHashes(imgs, 1, NVCV_IMAGE_HASH_EXACT));
+    EXPECT_EQ(gold, TensorHashes(imgs, 256, NVCV_IMAGE_HASH_EXACT));
+    EXPECT_EQ(gold, VarShapeHashes(imgs, NVCV_IMAGE_HASH_EXACT));
+}
+
+TEST_P(OpImageHash, dhash_correct_output)
+{
+    int width     = GetParamValue<0>();
+    int height    = GetParamValue<1>();
+    int channels  = GetParamValue<2>();
+    int numImages = GetParamValue<3>();
+
+    std::default_random_engine rng;
+
+    std::vector<HostImage> imgs;
+    std::vector<uint64_t>  gold;
+    for (int i = 0; i < numImages; ++i)
+    {
+        imgs.push_back(RandomImage(width, height, channels, rng));
+        gold.push_back(GoldDHash(imgs.back()));
+    }
+
+    EXPECT_EQ(gold, TensorHashes(imgs, 1, NVCV_IMAGE_HASH_DHASH));
+    EXPECT_EQ(gold, VarShapeHashes(imgs, NVCV_IMAGE_HASH_DHASH));
+}
+
+TEST(OpImageHash, exact_hash_detects_changes)
+{
+    std::default_random_engine rng;
+
+    HostImage img = RandomImage(50, 40, 3, rng);
+
+    HostImage changed = img;
+    changed.data[1234] ^= 1;
+
+    // Same bytes, rows split differently
+    HostImage reshaped = img;
+    reshaped.width     = 40;
+    reshaped.height    = 50;
+
+    HostImage swapped = img;
+    std::swap_ranges(swapped.data.begin(), swapped.data.begin() + 150, swapped.data.begin() + 150);
+
+    std::vector<uint64_t> hashes = VarShapeHashes({img, changed, reshaped, swapped, img}, NVCV_IMAGE_HASH_EXACT);
+    EXPECT_NE(hashes[0], hashes[1]);
+    EXPECT_NE(hashes[0], hashes[2]);
+    EXPECT_NE(hashes[0], hashes[3]);
+    EXPECT_EQ(hashes[0], hashes[4]);
+}
+
+TEST(OpImageHash, phash_is_robust)
+{
+    constexpr int width = 96, height = 64;
+
+    // Smooth image with some structure, so that its low frequencies are meaningful
+    HostImage img{width, height, 1, std::vector<uint8_t>(width * height)};
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            img.data[y * width + x] = static_cast<uint8_t>(128 + 60 * std::sin(x * 0.11) * std::cos(y * 0.07) + y);
+        }
+    }
+
+    HostImage brighter = img;
+    for (uint8_t &v : brighter.data)
+    {
+        v = std::min(255, v + 10);
+    }
+
+    HostImage noisy = img;
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> ndist(-3, 3);
+    for (uint8_t &v : noisy.data)
+    {
+        v = std::clamp(v + ndist(rng), 0, 255);
+    }
+
+    HostImage other = RandomImage(width, height, 1, rng);
+
+    std::vector<uint64_t> tensorHashes = TensorHashes({img, img}, 256, NVCV_IMAGE_HASH_PHASH);
+    EXPECT_EQ(tensorHashes[0], tensorHashes[1]);
+
+    std::vector<uint64_t> hashes = VarShapeHashes({img, brighter, noisy, other}, NVCV_IMAGE_HASH_PHASH);
+    EXPECT_EQ(tensorHashes[0], hashes[0]);
+    EXPECT_LE(HammingDistance(hashes[0], hashes[1]), 4);
+    EXPECT_LE(HammingDistance(hashes[0], hashes[2]), 4);
+    EXPECT_GE(HammingDistance(hashes[0], hashes[3]), 16);
+
+    // Half the bits are set, by the median
+    EXPECT_EQ(32, HammingDistance(hashes[0], 0));
+}
+
+TEST(OpImageHash, invalid_arguments)
+{
+    nvcv::Tensor imgSrc   = test::CreateTensor(2, 64, 48, nvcv::FMT_RGB8);
+    nvcv::Tensor imgF32   = test::CreateTensor(2, 64, 48, nvcv::FMT_F32);
+    nvcv::Tensor imgSmall = test::CreateTensor(2, 16, 16, nvcv::FMT_U8);
+    nvcv::Tensor imgNCHW({{2, 3, 48, 64}, nvcv::TENSOR_NCHW}, nvcv::TYPE_U8);
+
+    nvcv::Tensor hashes     = CreateHashes(2);
+    nvcv::Tensor hashesS32  = nvcv::Tensor({{2, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor hashesWide = nvcv::Tensor({{2, 1, 2, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U64);
+    nvcv::Tensor hashesFew  = CreateHashes(1);
+
+    cvcuda::ImageHash imageHashOp;
+    EXPECT_NO_THROW(imageHashOp(nullptr, imgSrc, hashes, NVCV_IMAGE_HASH_PHASH));
+    EXPECT_THROW(imageHashOp(nullptr, imgSrc, hashes, static_cast<NVCVImageHashType>(7)), nvcv::Exception);
+    EXPECT_THROW(imageHashOp(nullptr, imgNCHW, hashes, NVCV_IMAGE_HASH_EXACT), nvcv::Exception);
+    EXPECT_THROW(imageHashOp(nullptr, imgSrc, hashesS32, NVCV_IMAGE_HASH_EXACT), nvcv::Exception);
+    EXPECT_THROW(imageHashOp(nullptr, imgSrc, hashesWide, NVCV_IMAGE_HASH_EXACT), nvcv::Exception);
+    EXPECT_THROW(imageHashOp(nullptr, imgSrc, hashesFew, NVCV_IMAGE_HASH_EXACT), nvcv::Exception);
+
+    // Exact hashes take any type and size, perceptual ones don't
+    EXPECT_NO_THROW(imageHashOp(nullptr, imgF32, hashes, NVCV_IMAGE_HASH_EXACT));
+    EXPECT_THROW(imageHashOp(nullptr, imgF32, hashes, NVCV_IMAGE_HASH_DHASH), nvcv::Exception);
+    EXPECT_NO_THROW(imageHashOp(nullptr, imgSmall, hashes, NVCV_IMAGE_HASH_DHASH));
+    EXPECT_THROW(imageHashOp(nullptr, imgSmall, hashes, NVCV_IMAGE_HASH_PHASH), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
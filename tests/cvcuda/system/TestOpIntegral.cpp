@@ -0,0 +1,276 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpIntegral.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+namespace test = nvcv::test;
+
+namespace {
+
+template<typename T>
+void CopyRows(const nvcv::Tensor &tensor, std::vector<T> &host, cudaMemcpyKind kind)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(data, nullptr);
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    ASSERT_TRUE(access);
+
+    const int rowBytes = access->numCols() * sizeof(T);
+    const int rows     = access->numSamples() * access->numRows();
+    ASSERT_EQ(access->sampleStride(), access->numRows() * access->rowStride());
+
+    if (kind == cudaMemcpyHostToDevice)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(data->basePtr(), access->rowStride(), host.data(), rowBytes, rowBytes,
+                                            rows, kind));
+    }
+    else
+    {
+        host.resize(rows * access->numCols());
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(host.data(), rowBytes, data->basePtr(), access->rowStride(), rowBytes,
+                                            rows, kind));
+    }
+}
+
+// Integral of OpenCV on one image, summed sequentially in double, with (width + 1) x (height + 1) elements.
+template<typename T>
+std::vector<double> GoldIntegral(const T *in, int width, int height, bool square)
+{
+    std::vector<double> sum((width + 1) * (height + 1), 0.0);
+    for (int y = 0; y < height; ++y)
+    {
+        double rowSum = 0;
+        for (int x = 0; x < width; ++x)
+        {
+            const double v = in[y * width + x];
+            rowSum += square ? v * v : v;
+
+            sum[(y + 1) * (width + 1) + x + 1] = sum[y * (width + 1) + x + 1] + rowSum;
+        }
+    }
+    return sum;
+}
+
+template<typename T>
+std::vector<T> CreateImage(int numSamples, int width, int height)
+{
+    std::default_random_engine rng(width * 31 + height);
+
+    std::vector<T> image(numSamples * width * height);
+    for (T &v : image)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            v = std::uniform_real_distribution<T>(-1, 1)(rng);
+        }
+        else
+        {
+            v = std::uniform_int_distribution<int>(std::numeric_limits<T>::min(), std::numeric_limits<T>::max())(rng);
+        }
+    }
+    return image;
+}
+
+// Checks the integral images of the host input against the device output, exactly or to a relative error.
+template<typename T, typename S>
+void CheckIntegral(const std::vector<T> &image, const nvcv::Tensor &out, int numSamples, int width, int height,
+                   bool square, double tolerance)
+{
+    std::vector<S> test;
+    CopyRows(out, test, cudaMemcpyDeviceToHost);
+
+    const int outSize = (width + 1) * (height + 1);
+    ASSERT_EQ(test.size(), (size_t)numSamples * outSize);
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        std::vector<double> gold = GoldIntegral(image.data() + n * width * height, width, height, square);
+
+        int errors = 0;
+        for (int i = 0; i < outSize && errors < 10; ++i)
+        {
+            const double value = test[n * outSize + i];
+            if (std::abs(value - gold[i]) > tolerance * std::max(1.0, std::abs(gold[i])))
+            {
+                ADD_FAILURE() << "sample " << n << " at (" << i % (width + 1) << ", " << i / (width + 1) << "): "
+                              << value << " != " << gold[i];
+                ++errors;
+            }
+        }
+    }
+}
+
+template<typename T, typename S>
+void TestIntegral(nvcv::DataType inType, nvcv::DataType sumType, int numSamples, int width, int height,
+                  bool withSqsum, double tolerance)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor in({{numSamples, height, width, 1}, nvcv::TENSOR_NHWC}, inType);
+    nvcv::Tensor sum({{numSamples, height + 1, width + 1, 1}, nvcv::TENSOR_NHWC}, sumType);
+    nvcv::Tensor sqsum({{numSamples, height + 1, width + 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F64);
+
+    std::vector<T> image = CreateImage<T>(numSamples, width, height);
+    CopyRows(in, image, cudaMemcpyHostToDevice);
+
+    cvcuda::Integral op(numSamples, width, height);
+    if (withSqsum)
+    {
+        EXPECT_NO_THROW(op(stream, in, sum, sqsum));
+    }
+    else
+    {
+        EXPECT_NO_THROW(op(stream, in, sum));
+    }
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    CheckIntegral<T, S>(image, sum, numSamples, width, height, false, tolerance);
+    if (withSqsum)
+    {
+        CheckIntegral<T, double>(image, sqsum, numSamples, width, height, true, 1e-12);
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpIntegral, test::ValueList<int, int, int, bool>
+{
+    // numSamples, width, height, withSqsum
+    {            1,    64,     48,     false},
+    {            2,  1500,     70,      true},
+    {            3,    33,    200,      true},
+    {            1,  2049,      3,     false},
+    {            2,     1,      1,      true}
+});
+
+// clang-format on
+
+TEST_P(OpIntegral, correct_output_u8)
+{
+    int  numSamples = GetParamValue<0>();
+    int  width      = GetParamValue<1>();
+    int  height     = GetParamValue<2>();
+    bool withSqsum  = GetParamValue<3>();
+
+    TestIntegral<uint8_t, int32_t>(nvcv::TYPE_U8, nvcv::TYPE_S32, numSamples, width, height, withSqsum, 0);
+    TestIntegral<uint8_t, double>(nvcv::TYPE_U8, nvcv::TYPE_F64, numSamples, width, height, withSqsum, 0);
+}
+
+TEST_P(OpIntegral, correct_output_u16)
+{
+    int  numSamples = GetParamValue<0>();
+    int  width      = GetParamValue<1>();
+    int  height     = GetParamValue<2>();
+    bool withSqsum  = GetParamValue<3>();
+
+    TestIntegral<uint16_t, double>(nvcv::TYPE_U16, nvcv::TYPE_F64, numSamples, width, height, withSqsum, 0);
+}
+
+TEST_P(OpIntegral, correct_output_s16)
+{
+    int  numSamples = GetParamValue<0>();
+    int  width      = GetParamValue<1>();
+    int  height     = GetParamValue<2>();
+    bool withSqsum  = GetParamValue<3>();
+
+    TestIntegral<int16_t, double>(nvcv::TYPE_S16, nvcv::TYPE_F64, numSamples, width, height, withSqsum, 0);
+}
+
+TEST_P(OpIntegral, correct_output_f32)
+{
+    int  numSamples = GetParamValue<0>();
+    int  width      = GetParamValue<1>();
+    int  height     = GetParamValue<2>();
+    bool withSqsum  = GetParamValue<3>();
+
+    // float sums are added in the order of the scans
+    TestIntegral<float, float>(nvcv::TYPE_F32, nvcv::TYPE_F32, numSamples, width, height, withSqsum, 1e-3);
+    TestIntegral<float, double>(nvcv::TYPE_F32, nvcv::TYPE_F64, numSamples, width, height, withSqsum, 1e-12);
+}
+
+// The int32 sums of large images wrap around, the sums of boxes read from them don't.
+TEST(OpIntegral, box_sums_exact_on_overflow)
+{
+    const int width = 3000, height = 3000;
+
+    std::vector<uint8_t> image(width * height, 255);
+
+    nvcv::Tensor in({{1, height, width, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor sum({{1, height + 1, width + 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    CopyRows(in, image, cudaMemcpyHostToDevice);
+
+    cvcuda::Integral op(1, width, height);
+    EXPECT_NO_THROW(op(nullptr, in, sum));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+
+    std::vector<int32_t> test;
+    CopyRows(sum, test, cudaMemcpyDeviceToHost);
+
+    auto at = [&](int x, int y)
+    {
+        return static_cast<uint32_t>(test[y * (width + 1) + x]);
+    };
+
+    EXPECT_EQ(static_cast<uint32_t>(uint64_t{255} * width * height), at(width, height));
+
+    const int x0 = 2000, y0 = 2500, x1 = 2100, y1 = 2600;
+    EXPECT_EQ(255u * (x1 - x0) * (y1 - y0), at(x1, y1) - at(x0, y1) - at(x1, y0) + at(x0, y0));
+}
+
+TEST(OpIntegral, invalid_arguments)
+{
+    nvcv::TensorShape inShape({2, 16, 24, 1}, nvcv::TENSOR_NHWC);
+    nvcv::TensorShape outShape({2, 17, 25, 1}, nvcv::TENSOR_NHWC);
+
+    nvcv::Tensor in(inShape, nvcv::TYPE_U8), inF32(inShape, nvcv::TYPE_F32), inS32(inShape, nvcv::TYPE_S32);
+    nvcv::Tensor sum(outShape, nvcv::TYPE_S32), sumF64(outShape, nvcv::TYPE_F64), sumU8(outShape, nvcv::TYPE_U8);
+    nvcv::Tensor sqsumS32(outShape, nvcv::TYPE_S32);
+    nvcv::Tensor sumSmall({{2, 16, 24, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor in3({{2, 16, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor inLarge({{3, 16, 24, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor sumLarge({{3, 17, 25, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    EXPECT_THROW(cvcuda::Integral(-1, 24, 16), nvcv::Exception);
+
+    cvcuda::Integral op(2, 24, 16);
+    EXPECT_NO_THROW(op(nullptr, in, sum, sumF64));
+    EXPECT_THROW(op(nullptr, inF32, sum), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, inS32, sumF64), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, sumU8), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, sum, sqsumS32), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, sumSmall), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in3, sum), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, inLarge, sumLarge), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
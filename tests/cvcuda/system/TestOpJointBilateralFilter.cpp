@@ -180,6 +180,9 @@ NVCV_TEST_SUITE_P(OpJointBilateralFilter, test::ValueList<int, int, int, float,
     {    48,     32, 4, 5,          3,          9},
     {    64,     32, 4, 5,          3,          9},
     {    32,    128, 4, 5,          3,          9},
+
+    //width, height, d, SigmaColor, sigmaSpace, numberImages
+    {    75,     50, 19, 30,        6,          2},
 });
 
 // clang-format on
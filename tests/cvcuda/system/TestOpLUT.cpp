@@ -0,0 +1,175 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpLUT.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <random>
+#include <vector>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+// Copies the rows of an NHWC tensor, or the tables of a lookup table tensor, which are stored one after the other
+// with padding.
+template<typename T>
+void CopyRows(const nvcv::Tensor &tensor, std::vector<T> &host, int rowLength, cudaMemcpyKind kind)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(data, nullptr);
+
+    const int rank     = data->rank();
+    const int rowBytes = rowLength * sizeof(T);
+    const int rows     = host.size() / rowLength;
+    const int stride   = data->stride(rank == 4 ? 1 : rank - 2);
+    if (rank >= 3)
+    {
+        ASSERT_EQ(data->stride(0), data->shape(1) * data->stride(1));
+    }
+
+    if (kind == cudaMemcpyHostToDevice)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(data->basePtr(), stride, host.data(), rowBytes, rowBytes, rows, kind));
+    }
+    else
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(host.data(), rowBytes, data->basePtr(), stride, rowBytes, rows, kind));
+    }
+}
+
+template<typename T>
+std::vector<T> RandomValues(std::default_random_engine &rng, size_t count, double low, double high)
+{
+    std::vector<T> values(count);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist(low, high);
+        std::generate(values.begin(), values.end(), [&] { return dist(rng); });
+    }
+    else
+    {
+        std::uniform_int_distribution<int> dist(low, high);
+        std::generate(values.begin(), values.end(), [&] { return static_cast<T>(dist(rng)); });
+    }
+    return values;
+}
+
+// Tables given for numSampleTables samples and numChannelTables channels are broadcast to the others.
+template<typename S, typename D>
+void RunLUT(int numSamples, int width, int height, int channels, nvcv::DataType inType, nvcv::DataType lutType,
+            int numSampleTables, int numChannelTables, bool batchedTables)
+{
+    constexpr int numEntries = sizeof(S) == 1 ? 256 : 65536;
+
+    std::default_random_engine rng(numSamples * 100 + channels);
+
+    nvcv::Tensor in(nvcv::TensorShape({numSamples, height, width, channels}, "NHWC"), inType);
+    nvcv::Tensor out(nvcv::TensorShape({numSamples, height, width, channels}, "NHWC"), lutType);
+
+    nvcv::TensorShape lutShape = batchedTables
+                                   ? nvcv::TensorShape({numSampleTables, numChannelTables, numEntries}, "NCW")
+                                   : nvcv::TensorShape({numChannelTables, numEntries}, "CW");
+    nvcv::Tensor      lut(lutShape, lutType);
+
+    const int      rowLength = width * channels;
+    std::vector<S> inHost    = RandomValues<S>(rng, numSamples * height * rowLength, 0, numEntries - 1);
+    std::vector<D> lutHost   = RandomValues<D>(rng, numSampleTables * numChannelTables * numEntries, 0, 255);
+
+    CopyRows(in, inHost, rowLength, cudaMemcpyHostToDevice);
+    CopyRows(lut, lutHost, numEntries, cudaMemcpyHostToDevice);
+
+    cvcuda::LUT op;
+    EXPECT_NO_THROW(op(nullptr, in, out, lut));
+
+    std::vector<D> outHost(inHost.size());
+    CopyRows(out, outHost, rowLength, cudaMemcpyDeviceToHost);
+
+    for (size_t i = 0; i < inHost.size(); ++i)
+    {
+        const int n = i / (height * rowLength);
+        const int c = i % channels;
+
+        const int table = (numSampleTables > 1 ? n : 0) * numChannelTables + (numChannelTables > 1 ? c : 0);
+        ASSERT_EQ(outHost[i], lutHost[table * numEntries + inHost[i]]) << "at value " << i;
+    }
+}
+
+} // namespace
+
+// clang-format off
+NVCV_TEST_SUITE_P(OpLUT, test::ValueList<int, int, int, int, int, int, bool>
+{
+    // samples, width, height, channels, sample tables, channel tables, batched tables
+    {        1,    17,     13,        1,             1,              1,          false},
+    {        3,    64,     31,        3,             3,              3,           true},
+    {        2,   101,     20,        4,             1,              4,           true},
+    {        4,    33,      9,        3,             4,              1,           true},
+    {        2,     5,      7,        2,             1,              2,          false},
+});
+
+// clang-format on
+
+TEST_P(OpLUT, u8_to_u8_correct_output)
+{
+    RunLUT<uint8_t, uint8_t>(GetParamValue<0>(), GetParamValue<1>(), GetParamValue<2>(), GetParamValue<3>(),
+                             nvcv::TYPE_U8, nvcv::TYPE_U8, GetParamValue<4>(), GetParamValue<5>(),
+                             GetParamValue<6>());
+}
+
+TEST_P(OpLUT, u8_to_f32_correct_output)
+{
+    RunLUT<uint8_t, float>(GetParamValue<0>(), GetParamValue<1>(), GetParamValue<2>(), GetParamValue<3>(),
+                           nvcv::TYPE_U8, nvcv::TYPE_F32, GetParamValue<4>(), GetParamValue<5>(),
+                           GetParamValue<6>());
+}
+
+TEST_P(OpLUT, u16_to_u16_correct_output)
+{
+    RunLUT<uint16_t, uint16_t>(GetParamValue<0>(), GetParamValue<1>(), GetParamValue<2>(), GetParamValue<3>(),
+                               nvcv::TYPE_U16, nvcv::TYPE_U16, GetParamValue<4>(), GetParamValue<5>(),
+                               GetParamValue<6>());
+}
+
+TEST(OpLUT, invalid_arguments)
+{
+    nvcv::Tensor in(nvcv::TensorShape({2, 8, 8, 3}, "NHWC"), nvcv::TYPE_U8);
+    nvcv::Tensor inF32(nvcv::TensorShape({2, 8, 8, 3}, "NHWC"), nvcv::TYPE_F32);
+    nvcv::Tensor out(nvcv::TensorShape({2, 8, 8, 3}, "NHWC"), nvcv::TYPE_U8);
+    nvcv::Tensor outF32(nvcv::TensorShape({2, 8, 8, 3}, "NHWC"), nvcv::TYPE_F32);
+    nvcv::Tensor outSmall(nvcv::TensorShape({2, 4, 8, 3}, "NHWC"), nvcv::TYPE_U8);
+    nvcv::Tensor lut(nvcv::TensorShape({3, 256}, "CW"), nvcv::TYPE_U8);
+    nvcv::Tensor lutShort(nvcv::TensorShape({3, 255}, "CW"), nvcv::TYPE_U8);
+    nvcv::Tensor lutChannels(nvcv::TensorShape({2, 256}, "CW"), nvcv::TYPE_U8);
+    nvcv::Tensor lutSamples(nvcv::TensorShape({3, 3, 256}, "NCW"), nvcv::TYPE_U8);
+    nvcv::Tensor lutF64(nvcv::TensorShape({3, 256}, "CW"), nvcv::TYPE_F64);
+
+    cvcuda::LUT op;
+
+    EXPECT_THROW(op(nullptr, inF32, outF32, lut), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, outF32, lut), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, outSmall, lut), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out, lutShort), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out, lutChannels), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out, lutSamples), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out, lutF64), nvcv::Exception);
+}
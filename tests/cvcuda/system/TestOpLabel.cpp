@@ -0,0 +1,281 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpLabel.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <random>
+
+namespace test = nvcv::test;
+
+namespace {
+
+template<typename T>
+void CopyRows(const nvcv::Tensor &tensor, std::vector<T> &host, cudaMemcpyKind kind)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(data, nullptr);
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    ASSERT_TRUE(access);
+
+    const int rowElems = access->numCols() * access->numChannels();
+    const int rowBytes = rowElems * sizeof(T);
+    const int rows     = access->numSamples() * access->numRows();
+
+    if (kind == cudaMemcpyHostToDevice)
+    {
+        ASSERT_EQ(access->sampleStride(), access->numRows() * access->rowStride());
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(data->basePtr(), access->rowStride(), host.data(), rowBytes, rowBytes,
+                                            rows, kind));
+    }
+    else
+    {
+        // one row per sample for counts and statistics
+        const int64_t pitch = access->numRows() == 1 ? access->sampleStride() : access->rowStride();
+        ASSERT_TRUE(access->numRows() == 1 || access->sampleStride() == access->numRows() * access->rowStride());
+
+        host.resize(rows * rowElems);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(host.data(), rowBytes, data->basePtr(), pitch, rowBytes, rows, kind));
+    }
+}
+
+using Stats = std::array<int, 6>;
+
+// Labels of the components of one mask, 1 plus the smallest linear index of each component, found by flood fill
+// in increasing order of linear index, and the label, bounding box and area of each component.
+std::vector<int> GoldLabel(const std::vector<uint8_t> &mask, int width, int height, int connectivity,
+                           std::map<int, Stats> &stats)
+{
+    std::vector<int> labels(width * height, 0);
+    std::vector<int> stack;
+
+    for (int i = 0; i < width * height; ++i)
+    {
+        if (mask[i] == 0 || labels[i] != 0)
+        {
+            continue;
+        }
+
+        const int label = i + 1;
+        int       x0 = width, y0 = height, x1 = -1, y1 = -1, area = 0;
+
+        labels[i] = label;
+        stack.push_back(i);
+        while (!stack.empty())
+        {
+            const int p = stack.back();
+            stack.pop_back();
+
+            const int x = p % width, y = p / width;
+            x0 = std::min(x0, x);
+            y0 = std::min(y0, y);
+            x1 = std::max(x1, x);
+            y1 = std::max(y1, y);
+            ++area;
+
+            for (int dy = -1; dy <= 1; ++dy)
+            {
+                for (int dx = -1; dx <= 1; ++dx)
+                {
+                    const int nx = x + dx, ny = y + dy;
+                    if ((dx == 0 && dy == 0) || (connectivity == 4 && dx != 0 && dy != 0) || nx < 0 || nx >= width
+                        || ny < 0 || ny >= height)
+                    {
+                        continue;
+                    }
+                    const int q = ny * width + nx;
+                    if (mask[q] != 0 && labels[q] == 0)
+                    {
+                        labels[q] = label;
+                        stack.push_back(q);
+                    }
+                }
+            }
+        }
+
+        stats[label] = {label, x0, y0, x1 - x0 + 1, y1 - y0 + 1, area};
+    }
+    return labels;
+}
+
+// Random blobs, and a serpentine crossing all the tiles of the image.
+std::vector<uint8_t> CreateMask(int numSamples, int width, int height, bool serpentine)
+{
+    std::default_random_engine         rng(width * 31 + height);
+    std::uniform_int_distribution<int> noise(0, 99);
+
+    std::vector<uint8_t> mask(numSamples * width * height);
+    for (int n = 0; n < numSamples; ++n)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                bool on;
+                if (serpentine)
+                {
+                    // full rows every 4 rows, joined alternately at the right and left edges
+                    on = y % 4 == 0 || x == ((y / 4) % 2 == 0 ? width - 1 : 0);
+                }
+                else
+                {
+                    on = noise(rng) < 45 + n * 5;
+                }
+                mask[(n * height + y) * width + x] = on ? 1 + noise(rng) : 0;
+            }
+        }
+    }
+    return mask;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpLabel, test::ValueList<int, int, int, int, bool, int>
+{
+    // numSamples, width, height, connectivity, serpentine, maxStats
+    {            1,    64,     48,            4,      false,     4096},
+    {            2,   197,     61,            8,      false,     8192},
+    {            3,    45,    133,            4,       true,       16},
+    {            1,   300,     20,            8,       true,        1},
+    {            2,     7,      5,            8,      false,        0},
+    {            2,  1000,    600,            8,      false,        0}
+});
+
+// clang-format on
+
+TEST_P(OpLabel, correct_output)
+{
+    int  numSamples   = GetParamValue<0>();
+    int  width        = GetParamValue<1>();
+    int  height       = GetParamValue<2>();
+    int  connectivity = GetParamValue<3>();
+    bool serpentine   = GetParamValue<4>();
+    int  maxStats     = GetParamValue<5>();
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor in({{numSamples, height, width, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor out({{numSamples, height, width, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor count({{numSamples, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor stats({{numSamples, 1, std::max(maxStats, 1), 6}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    std::vector<uint8_t> mask = CreateMask(numSamples, width, height, serpentine);
+    CopyRows(in, mask, cudaMemcpyHostToDevice);
+
+    cvcuda::Label op;
+    EXPECT_NO_THROW(op(stream, in, out, connectivity, &count, maxStats > 0 ? &stats : nullptr));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<int> testLabels, testCount, testStats;
+    CopyRows(out, testLabels, cudaMemcpyDeviceToHost);
+    CopyRows(count, testCount, cudaMemcpyDeviceToHost);
+    CopyRows(stats, testStats, cudaMemcpyDeviceToHost);
+
+    const int imageSize = width * height;
+    for (int n = 0; n < numSamples; ++n)
+    {
+        const std::vector<uint8_t> sample(mask.begin() + n * imageSize, mask.begin() + (n + 1) * imageSize);
+
+        std::map<int, Stats> goldStats;
+        std::vector<int>     gold = GoldLabel(sample, width, height, connectivity, goldStats);
+
+        EXPECT_TRUE(std::equal(gold.begin(), gold.end(), testLabels.begin() + n * imageSize)) << "sample " << n;
+        ASSERT_EQ((int)goldStats.size(), testCount[n]) << "sample " << n;
+
+        if (maxStats > 0)
+        {
+            // statistics are in no particular order, each of them at most once
+            const int numStats = std::min(maxStats, testCount[n]);
+
+            std::map<int, Stats> found;
+            for (int i = 0; i < numStats; ++i)
+            {
+                Stats s;
+                std::copy_n(testStats.begin() + (n * maxStats + i) * 6, 6, s.begin());
+
+                ASSERT_EQ(1u, goldStats.count(s[0])) << "sample " << n << " label " << s[0];
+                EXPECT_EQ(goldStats[s[0]], s) << "sample " << n << " label " << s[0];
+                EXPECT_TRUE(found.emplace(s[0], s).second) << "sample " << n << " label " << s[0];
+            }
+        }
+    }
+}
+
+TEST(OpLabel, serpentine_single_component)
+{
+    const int width = 100, height = 64;
+
+    std::vector<uint8_t> mask = CreateMask(1, width, height, true);
+
+    nvcv::Tensor in({{1, height, width, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor out({{1, height, width, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor count({{1, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    CopyRows(in, mask, cudaMemcpyHostToDevice);
+
+    cvcuda::Label op;
+    EXPECT_NO_THROW(op(nullptr, in, out, 4, &count));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+
+    std::vector<int> testLabels, testCount;
+    CopyRows(out, testLabels, cudaMemcpyDeviceToHost);
+    CopyRows(count, testCount, cudaMemcpyDeviceToHost);
+
+    EXPECT_EQ(1, testCount[0]);
+    for (int i = 0; i < width * height; ++i)
+    {
+        ASSERT_EQ(mask[i] ? 1 : 0, testLabels[i]) << "pixel " << i;
+    }
+}
+
+TEST(OpLabel, invalid_arguments)
+{
+    nvcv::TensorShape shape({2, 16, 24, 1}, nvcv::TENSOR_NHWC);
+
+    nvcv::Tensor in(shape, nvcv::TYPE_U8), out(shape, nvcv::TYPE_S32);
+    nvcv::Tensor inF32(shape, nvcv::TYPE_F32), outU8(shape, nvcv::TYPE_U8);
+    nvcv::Tensor outSmall({{2, 16, 23, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor in3({{2, 16, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor count({{2, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor countSmall({{1, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor stats({{2, 1, 10, 6}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor stats4({{2, 1, 10, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    cvcuda::Label op;
+    EXPECT_NO_THROW(op(nullptr, in, out, 8, &count, &stats));
+    EXPECT_THROW(op(nullptr, in, out, 6), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out, 8, nullptr, &stats), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, inF32, out), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, outU8), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, outSmall), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in3, out), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out, 8, &countSmall), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, out, 8, &count, &stats4), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
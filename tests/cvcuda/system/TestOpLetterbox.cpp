@@ -0,0 +1,311 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpLetterbox.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+constexpr uint8_t kFill = 114;
+
+struct Geometry
+{
+    float scaleX, scaleY;
+    int   left, top, width, height;
+};
+
+// Mirrors the device computation, with the same float operations and rounding.
+Geometry LetterboxGeometry(int srcW, int srcH, int dstW, int dstH)
+{
+    float scale = std::min(static_cast<float>(dstW) / srcW, static_cast<float>(dstH) / srcH);
+
+    Geometry g;
+    g.width  = std::min(dstW, std::max(1, static_cast<int>(std::nearbyint(srcW * scale))));
+    g.height = std::min(dstH, std::max(1, static_cast<int>(std::nearbyint(srcH * scale))));
+    g.left   = (dstW - g.width) / 2;
+    g.top    = (dstH - g.height) / 2;
+    g.scaleX = static_cast<float>(g.width) / srcW;
+    g.scaleY = static_cast<float>(g.height) / srcH;
+    return g;
+}
+
+// Letterboxes an interleaved 8-bit image with packed rows into a dstW x dstH image.
+std::vector<uint8_t> Letterbox(const std::vector<uint8_t> &src, int srcW, int srcH, int dstW, int dstH,
+                               int channels, NVCVInterpolationType interp)
+{
+    Geometry g = LetterboxGeometry(srcW, srcH, dstW, dstH);
+
+    std::vector<uint8_t> dst(dstW * dstH * channels, kFill);
+
+    auto at = [&](int x, int y, int c)
+    {
+        return static_cast<float>(src[(y * srcW + x) * channels + c]);
+    };
+
+    for (int y = g.top; y < g.top + g.height; ++y)
+    {
+        for (int x = g.left; x < g.left + g.width; ++x)
+        {
+            int ix = x - g.left, iy = y - g.top;
+            for (int c = 0; c < channels; ++c)
+            {
+                float value;
+                if (interp == NVCV_INTERP_NEAREST)
+                {
+                    int sx = std::min(static_cast<int>(std::floor(ix * (1.f / g.scaleX))), srcW - 1);
+                    int sy = std::min(static_cast<int>(std::floor(iy * (1.f / g.scaleY))), srcH - 1);
+                    value  = at(sx, sy, c);
+                }
+                else
+                {
+                    float fx  = (ix + 0.5f) * (1.f / g.scaleX) - 0.5f;
+                    float fy  = (iy + 0.5f) * (1.f / g.scaleY) - 0.5f;
+                    int   sx  = static_cast<int>(std::floor(fx));
+                    int   sy  = static_cast<int>(std::floor(fy));
+                    int   sx0 = std::clamp(sx, 0, srcW - 1), sx1 = std::clamp(sx + 1, 0, srcW - 1);
+                    int   sy0 = std::clamp(sy, 0, srcH - 1), sy1 = std::clamp(sy + 1, 0, srcH - 1);
+                    fx -= sx;
+                    fy -= sy;
+
+                    value = (1.f - fx) * (at(sx0, sy0, c) * (1.f - fy) + at(sx0, sy1, c) * fy)
+                          + fx * (at(sx1, sy0, c) * (1.f - fy) + at(sx1, sy1, c) * fy);
+                }
+                dst[(y * dstW + x) * channels + c] = static_cast<uint8_t>(std::clamp(std::round(value), 0.f, 255.f));
+            }
+        }
+    }
+    return dst;
+}
+
+std::vector<uint8_t> RandomImage(int size, std::default_random_engine &rng)
+{
+    std::uniform_int_distribution<int> udist(0, 255);
+
+    std::vector<uint8_t> img(size);
+    std::generate(img.begin(), img.end(), [&]() { return udist(rng); });
+    return img;
+}
+
+// Checks sample i of the output and of the transform against the host letterbox of the source image.
+void CheckSample(const nvcv::TensorDataAccessStridedImagePlanar &dstAccess,
+                 const nvcv::TensorDataAccessStridedImagePlanar &transformAccess, int i,
+                 const std::vector<uint8_t> &src, int srcW, int srcH, int channels, NVCVInterpolationType interp)
+{
+    int dstW = dstAccess.numCols(), dstH = dstAccess.numRows();
+    int rowBytes = dstW * channels;
+
+    std::vector<uint8_t> testVec(dstH * rowBytes);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), rowBytes, dstAccess.sampleData(i), dstAccess.rowStride(),
+                                        rowBytes, dstH, cudaMemcpyDeviceToHost));
+
+    std::vector<uint8_t> goldVec = Letterbox(src, srcW, srcH, dstW, dstH, channels, interp);
+    for (size_t j = 0; j < goldVec.size(); ++j)
+    {
+        ASSERT_NEAR(goldVec[j], testVec[j], 1) << "at pixel (" << (j / channels) % dstW << ", " << j / rowBytes
+                                               << ")";
+    }
+
+    std::array<float, 4> transform;
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(transform.data(), transformAccess.sampleData(i), sizeof(transform),
+                                      cudaMemcpyDeviceToHost));
+
+    Geometry g = LetterboxGeometry(srcW, srcH, dstW, dstH);
+    EXPECT_FLOAT_EQ(g.scaleX, transform[0]);
+    EXPECT_FLOAT_EQ(g.scaleY, transform[1]);
+    EXPECT_EQ(g.left, transform[2]);
+    EXPECT_EQ(g.top, transform[3]);
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpLetterbox, test::ValueList<int, int, int, int, int, nvcv::ImageFormat, NVCVInterpolationType>
+{
+    // srcWidth, srcHeight, numImages, dstWidth, dstHeight,          format,        interpolation
+    {       640,       480,         2,      320,       320,  nvcv::FMT_RGB8,   NVCV_INTERP_LINEAR },
+    {       300,       500,         3,      256,       256,  nvcv::FMT_RGB8,   NVCV_INTERP_LINEAR },
+    {        97,        33,         1,      128,        96, nvcv::FMT_RGBA8,   NVCV_INTERP_LINEAR },
+    {       160,       120,         2,      416,       416,    nvcv::FMT_U8,  NVCV_INTERP_NEAREST },
+    {        64,        64,         4,       64,        64,  nvcv::FMT_RGB8,  NVCV_INTERP_NEAREST }
+});
+
+// clang-format on
+
+TEST_P(OpLetterbox, tensor_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int                   srcW      = GetParamValue<0>();
+    int                   srcH      = GetParamValue<1>();
+    int                   numImages = GetParamValue<2>();
+    int                   dstW      = GetParamValue<3>();
+    int                   dstH      = GetParamValue<4>();
+    nvcv::ImageFormat     fmt       = GetParamValue<5>();
+    NVCVInterpolationType interp    = GetParamValue<6>();
+
+    int channels = fmt.numChannels();
+    int rowBytes = srcW * channels;
+
+    std::default_random_engine rng;
+
+    nvcv::Tensor imgSrc  = test::CreateTensor(numImages, srcW, srcH, fmt);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<std::vector<uint8_t>> srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        srcVec[i] = RandomImage(srcH * rowBytes, rng);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(),
+                                            rowBytes, rowBytes, srcH, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::Tensor imgDst       = test::CreateTensor(numImages, dstW, dstH, fmt);
+    nvcv::Tensor imgTransform = test::CreateTensor(numImages, 1, 1, nvcv::FMT_RGBAf32);
+
+    cvcuda::Letterbox letterboxOp;
+    EXPECT_NO_THROW(letterboxOp(stream, imgSrc, imgDst, &imgTransform, interp, float4{kFill, kFill, kFill, kFill}));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *dstData       = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    const auto *transformData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgTransform.exportData());
+    ASSERT_NE(nullptr, dstData);
+    ASSERT_NE(nullptr, transformData);
+    auto dstAccess       = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    auto transformAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*transformData);
+    ASSERT_TRUE(dstAccess);
+    ASSERT_TRUE(transformAccess);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+        CheckSample(*dstAccess, *transformAccess, i, srcVec[i], srcW, srcH, channels, interp);
+    }
+}
+
+TEST_P(OpLetterbox, varshape_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int                   srcW      = GetParamValue<0>();
+    int                   srcH      = GetParamValue<1>();
+    int                   numImages = GetParamValue<2>();
+    int                   dstW      = GetParamValue<3>();
+    int                   dstH      = GetParamValue<4>();
+    nvcv::ImageFormat     fmt       = GetParamValue<5>();
+    NVCVInterpolationType interp    = GetParamValue<6>();
+
+    int channels = fmt.numChannels();
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> sdist(0, std::min(srcW, srcH) / 2);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    std::vector<std::vector<uint8_t>>         srcVec(numImages);
+    std::vector<nvcv::Size2D>                 srcSizes(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        // Images of different sizes and aspect ratios get different scales and offsets
+        srcSizes[i] = {srcW - sdist(rng), srcH - sdist(rng)};
+
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(srcSizes[i], fmt));
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(nullptr, srcData);
+
+        int srcStride = srcSizes[i].w * channels;
+        srcVec[i]     = RandomImage(srcSizes[i].h * srcStride, rng);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec[i].data(),
+                                            srcStride, srcStride, srcSizes[i].h, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    nvcv::Tensor imgDst       = test::CreateTensor(numImages, dstW, dstH, fmt);
+    nvcv::Tensor imgTransform = test::CreateTensor(numImages, 1, 1, nvcv::FMT_RGBAf32);
+
+    cvcuda::Letterbox letterboxOp;
+    EXPECT_NO_THROW(
+        letterboxOp(stream, batchSrc, imgDst, &imgTransform, interp, float4{kFill, kFill, kFill, kFill}));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *dstData       = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    const auto *transformData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgTransform.exportData());
+    ASSERT_NE(nullptr, dstData);
+    ASSERT_NE(nullptr, transformData);
+    auto dstAccess       = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    auto transformAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*transformData);
+    ASSERT_TRUE(dstAccess);
+    ASSERT_TRUE(transformAccess);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+        CheckSample(*dstAccess, *transformAccess, i, srcVec[i], srcSizes[i].w, srcSizes[i].h, channels, interp);
+    }
+}
+
+TEST(OpLetterbox, invalid_arguments)
+{
+    nvcv::Tensor imgSrc = test::CreateTensor(2, 64, 48, nvcv::FMT_RGB8);
+
+    nvcv::Tensor out({{2, 32, 32, 3}, "NHWC"}, nvcv::TYPE_U8);
+    nvcv::Tensor outF32({{2, 32, 32, 3}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor outSamples({{1, 32, 32, 3}, "NHWC"}, nvcv::TYPE_U8);
+    nvcv::Tensor outChannels({{2, 32, 32, 4}, "NHWC"}, nvcv::TYPE_U8);
+    nvcv::Tensor transform({{2, 1, 1, 4}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor transformShape({{2, 1, 1, 2}, "NHWC"}, nvcv::TYPE_F32);
+
+    const float4 fill{0, 0, 0, 0};
+
+    cvcuda::Letterbox letterboxOp;
+    EXPECT_NO_THROW(letterboxOp(nullptr, imgSrc, out, nullptr, NVCV_INTERP_LINEAR, fill));
+    EXPECT_NO_THROW(letterboxOp(nullptr, imgSrc, out, &transform, NVCV_INTERP_NEAREST, fill));
+    EXPECT_THROW(letterboxOp(nullptr, imgSrc, out, nullptr, NVCV_INTERP_CUBIC, fill), nvcv::Exception);
+    EXPECT_THROW(letterboxOp(nullptr, imgSrc, outF32, nullptr, NVCV_INTERP_LINEAR, fill), nvcv::Exception);
+    EXPECT_THROW(letterboxOp(nullptr, imgSrc, outSamples, nullptr, NVCV_INTERP_LINEAR, fill), nvcv::Exception);
+    EXPECT_THROW(letterboxOp(nullptr, imgSrc, outChannels, nullptr, NVCV_INTERP_LINEAR, fill), nvcv::Exception);
+    EXPECT_THROW(letterboxOp(nullptr, imgSrc, out, &transformShape, NVCV_INTERP_LINEAR, fill), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -0,0 +1,187 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpMaskOverlay.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+template<typename T>
+void Upload(const nvcv::Tensor &tensor, const std::vector<T> &host, int numSamples)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(nullptr, data);
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    ASSERT_TRUE(access);
+
+    const int rowBytes    = access->numCols() * access->numChannels() * sizeof(T);
+    const int sampleElems = access->numRows() * access->numCols() * access->numChannels();
+    for (int n = 0; n < numSamples; ++n)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(access->sampleData(n), access->rowStride(), host.data() + n * sampleElems,
+                                            rowBytes, rowBytes, access->numRows(), cudaMemcpyHostToDevice));
+    }
+}
+
+int DivRound255(int x)
+{
+    return (x + 127) / 255;
+}
+
+template<typename LabelT>
+void RunMaskOverlay(int numImages, int width, int height, int channels, int paletteSize)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt       = channels == 3 ? nvcv::FMT_RGB8 : nvcv::FMT_RGBA8;
+    const nvcv::DataType    labelType = std::is_same_v<LabelT, uint8_t> ? nvcv::TYPE_U8 : nvcv::TYPE_S32;
+
+    nvcv::Tensor imgSrc = test::CreateTensor(numImages, width, height, fmt);
+    nvcv::Tensor imgDst = test::CreateTensor(numImages, width, height, fmt);
+    nvcv::Tensor labels({{numImages, height, width, 1}, nvcv::TENSOR_NHWC}, labelType);
+    nvcv::Tensor palette({{1, 1, paletteSize, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> udist(0, 255);
+    // Some labels fall outside the palette, their pixels are left as is
+    std::uniform_int_distribution<int> ldist(0, paletteSize + 1);
+
+    std::vector<uint8_t> src(numImages * height * width * channels);
+    std::vector<LabelT>  lab(numImages * height * width);
+    std::vector<uint8_t> pal(paletteSize * 4);
+    std::generate(src.begin(), src.end(), [&]() { return udist(rng); });
+    std::generate(lab.begin(), lab.end(), [&]() { return ldist(rng); });
+    std::generate(pal.begin(), pal.end(), [&]() { return udist(rng); });
+
+    // Fully transparent and fully opaque colors are blended exactly
+    pal[3] = 0;
+    if (paletteSize > 1)
+    {
+        pal[7] = 255;
+    }
+
+    Upload(imgSrc, src, numImages);
+    Upload(labels, lab, numImages);
+    Upload(palette, pal, 1);
+
+    cvcuda::MaskOverlay overlayOp;
+    EXPECT_NO_THROW(overlayOp(stream, imgSrc, labels, palette, imgDst));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, dstData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    const int rowBytes = width * channels;
+    for (int n = 0; n < numImages; ++n)
+    {
+        std::vector<uint8_t> test(height * rowBytes);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(test.data(), rowBytes, dstAccess->sampleData(n), dstAccess->rowStride(),
+                                            rowBytes, height, cudaMemcpyDeviceToHost));
+
+        for (int i = 0; i < width * height; ++i)
+        {
+            const int      label = lab[n * width * height + i];
+            const uint8_t *color = label < paletteSize ? &pal[label * 4] : nullptr;
+            const uint8_t *pix   = &src[(n * width * height + i) * channels];
+
+            for (int c = 0; c < channels; ++c)
+            {
+                int gold = pix[c];
+                if (color && c < 3)
+                {
+                    gold = DivRound255(pix[c] * (255 - color[3]) + color[c] * color[3]);
+                }
+                ASSERT_EQ(gold, test[i * channels + c]) << "at sample " << n << " pixel " << i << " channel " << c;
+            }
+        }
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpMaskOverlay, test::ValueList<int, int, int, int, int>
+{
+    // numImages, width, height, channels, paletteSize
+    {           1,    32,     24,        3,           2 },
+    {           2,   101,     37,        3,          21 },
+    {           3,    64,     64,        4,          21 },
+    {           1,   640,    480,        3,         256 },
+    {           2,    17,     11,        4,           1 }
+});
+
+// clang-format on
+
+TEST_P(OpMaskOverlay, u8_labels_correct_output)
+{
+    RunMaskOverlay<uint8_t>(GetParamValue<0>(), GetParamValue<1>(), GetParamValue<2>(), GetParamValue<3>(),
+                            std::min(GetParamValue<4>(), 254));
+}
+
+TEST_P(OpMaskOverlay, s32_labels_correct_output)
+{
+    RunMaskOverlay<int32_t>(GetParamValue<0>(), GetParamValue<1>(), GetParamValue<2>(), GetParamValue<3>(),
+                            GetParamValue<4>());
+}
+
+TEST(OpMaskOverlay, palette_larger_than_shared_memory)
+{
+    RunMaskOverlay<int32_t>(2, 50, 40, 3, 1000);
+}
+
+TEST(OpMaskOverlay, invalid_arguments)
+{
+    nvcv::Tensor imgRGB   = test::CreateTensor(2, 16, 12, nvcv::FMT_RGB8);
+    nvcv::Tensor imgOut   = test::CreateTensor(2, 16, 12, nvcv::FMT_RGB8);
+    nvcv::Tensor imgU8    = test::CreateTensor(2, 16, 12, nvcv::FMT_U8);
+    nvcv::Tensor imgF32   = test::CreateTensor(2, 16, 12, nvcv::FMT_RGBf32);
+    nvcv::Tensor imgSmall = test::CreateTensor(2, 8, 12, nvcv::FMT_RGB8);
+    nvcv::Tensor labels({{2, 12, 16, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor labelsF32({{2, 12, 16, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor labelsSmall({{2, 6, 16, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor palette({{1, 1, 21, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor palette3C({{1, 1, 21, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    cvcuda::MaskOverlay overlayOp;
+
+    EXPECT_NO_THROW(overlayOp(nullptr, imgRGB, labels, palette, imgOut));
+    EXPECT_THROW(overlayOp(nullptr, imgU8, labels, palette, imgU8), nvcv::Exception);
+    EXPECT_THROW(overlayOp(nullptr, imgF32, labels, palette, imgF32), nvcv::Exception);
+    EXPECT_THROW(overlayOp(nullptr, imgRGB, labels, palette, imgSmall), nvcv::Exception);
+    EXPECT_THROW(overlayOp(nullptr, imgRGB, labelsF32, palette, imgOut), nvcv::Exception);
+    EXPECT_THROW(overlayOp(nullptr, imgRGB, labelsSmall, palette, imgOut), nvcv::Exception);
+    EXPECT_THROW(overlayOp(nullptr, imgRGB, labels, palette3C, imgOut), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
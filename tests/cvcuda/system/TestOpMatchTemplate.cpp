@@ -0,0 +1,214 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpMatchTemplate.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace test = nvcv::test;
+
+namespace {
+
+// Copies the packed host images, one float per pixel, to a new tensor of single channel images of the format.
+nvcv::Tensor CreateTensor(const std::vector<std::vector<float>> &images, nvcv::Size2D size, nvcv::ImageFormat fmt)
+{
+    nvcv::Tensor tensor(static_cast<int>(images.size()), size, fmt);
+
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    EXPECT_NE(nullptr, data);
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    EXPECT_TRUE(access);
+
+    const bool isFloat  = fmt == nvcv::FMT_F32;
+    const int  rowBytes = size.w * (isFloat ? sizeof(float) : sizeof(uint8_t));
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        std::vector<uint8_t> bytes(size.h * rowBytes);
+        for (size_t j = 0; j < images[i].size(); ++j)
+        {
+            if (isFloat)
+            {
+                std::memcpy(bytes.data() + j * sizeof(float), &images[i][j], sizeof(float));
+            }
+            else
+            {
+                bytes[j] = static_cast<uint8_t>(images[i][j]);
+            }
+        }
+        EXPECT_EQ(cudaSuccess, cudaMemcpy2D(access->sampleData(i), access->rowStride(), bytes.data(), rowBytes,
+                                            rowBytes, size.h, cudaMemcpyHostToDevice));
+    }
+    return tensor;
+}
+
+// TM_CCOEFF_NORMED scores of the template at every position of the image, in double precision.
+std::vector<double> GoldScores(const std::vector<float> &img, nvcv::Size2D size, const std::vector<float> &templ,
+                               nvcv::Size2D templSize)
+{
+    const int area = templSize.w * templSize.h;
+
+    double templMean = 0;
+    for (float v : templ)
+    {
+        templMean += v;
+    }
+    templMean /= area;
+
+    double templVar = 0;
+    for (float v : templ)
+    {
+        templVar += (v - templMean) * (v - templMean);
+    }
+
+    const int           outW = size.w - templSize.w + 1, outH = size.h - templSize.h + 1;
+    std::vector<double> scores(outW * outH);
+    for (int y = 0; y < outH; ++y)
+    {
+        for (int x = 0; x < outW; ++x)
+        {
+            double mean = 0;
+            for (int v = 0; v < templSize.h; ++v)
+            {
+                for (int u = 0; u < templSize.w; ++u)
+                {
+                    mean += img[(y + v) * size.w + x + u];
+                }
+            }
+            mean /= area;
+
+            double num = 0, var = 0;
+            for (int v = 0; v < templSize.h; ++v)
+            {
+                for (int u = 0; u < templSize.w; ++u)
+                {
+                    double d = img[(y + v) * size.w + x + u] - mean;
+                    num += d * (templ[v * templSize.w + u] - templMean);
+                    var += d * d;
+                }
+            }
+
+            const double den = std::sqrt(var * templVar);
+            scores[y * outW + x] = den > 0 ? num / den : 0;
+        }
+    }
+    return scores;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpMatchTemplate, test::ValueList<int, int, int, int, int, bool, nvcv::ImageFormat>
+{
+    // width, height, numImages, templWidth, templHeight, oneTemplate,       format
+    {     64,     48,         2,          8,           8,       false, nvcv::FMT_U8},
+    {    130,     77,         3,         13,           9,        true, nvcv::FMT_U8},
+    {     90,    100,         1,         40,          33,       false, nvcv::FMT_F32},
+    {    200,    180,         2,        100,         120,       false, nvcv::FMT_U8},
+    {     31,     29,         4,         31,          29,        true, nvcv::FMT_F32}
+});
+
+// clang-format on
+
+TEST_P(OpMatchTemplate, correct_output)
+{
+    const nvcv::Size2D      size{GetParamValue<0>(), GetParamValue<1>()};
+    const int               numImages = GetParamValue<2>();
+    const nvcv::Size2D      templSize{GetParamValue<3>(), GetParamValue<4>()};
+    const bool              oneTemplate = GetParamValue<5>();
+    const nvcv::ImageFormat format      = GetParamValue<6>();
+
+    std::default_random_engine         rng(0);
+    std::uniform_int_distribution<int> udist(0, 255);
+
+    std::vector<std::vector<float>> images(numImages, std::vector<float>(size.w * size.h));
+    std::vector<std::vector<float>> templs(oneTemplate ? 1 : numImages,
+                                           std::vector<float>(templSize.w * templSize.h));
+    for (auto &img : images)
+    {
+        std::generate(img.begin(), img.end(), [&]() { return udist(rng); });
+    }
+    for (auto &templ : templs)
+    {
+        std::generate(templ.begin(), templ.end(), [&]() { return udist(rng); });
+    }
+
+    const nvcv::Size2D outSize{size.w - templSize.w + 1, size.h - templSize.h + 1};
+
+    nvcv::Tensor src   = CreateTensor(images, size, format);
+    nvcv::Tensor templ = CreateTensor(templs, templSize, format);
+    nvcv::Tensor dst(numImages, outSize, nvcv::FMT_F32);
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::MatchTemplate op;
+    EXPECT_NO_THROW(op(stream, src, templ, dst));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(dst.exportData());
+    ASSERT_NE(nullptr, dstData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<float> test(outSize.w * outSize.h);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(test.data(), outSize.w * sizeof(float), dstAccess->sampleData(i),
+                                            dstAccess->rowStride(), outSize.w * sizeof(float), outSize.h,
+                                            cudaMemcpyDeviceToHost));
+
+        std::vector<double> gold = GoldScores(images[i], size, templs[oneTemplate ? 0 : i], templSize);
+        for (size_t j = 0; j < gold.size(); ++j)
+        {
+            ASSERT_NEAR(gold[j], test[j], 1e-3) << "at " << j % outSize.w << "," << j / outSize.w;
+        }
+    }
+}
+
+TEST(OpMatchTemplate, invalid_arguments_are_rejected)
+{
+    nvcv::Tensor src(2, {64, 48}, nvcv::FMT_U8);
+    nvcv::Tensor templ(2, {8, 8}, nvcv::FMT_U8);
+    nvcv::Tensor dst(2, {57, 41}, nvcv::FMT_F32);
+
+    nvcv::Tensor templF32(2, {8, 8}, nvcv::FMT_F32);
+    nvcv::Tensor templRGB(2, {8, 8}, nvcv::FMT_RGB8);
+    nvcv::Tensor templTooLarge(2, {65, 8}, nvcv::FMT_U8);
+    nvcv::Tensor templSamples(3, {8, 8}, nvcv::FMT_U8);
+    nvcv::Tensor dstWrongSize(2, {56, 41}, nvcv::FMT_F32);
+    nvcv::Tensor dstU8(2, {57, 41}, nvcv::FMT_U8);
+
+    cvcuda::MatchTemplate op;
+    EXPECT_THROW(op(nullptr, src, templF32, dst), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, templRGB, dst), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, templTooLarge, dst), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, templSamples, dst), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, templ, dstWrongSize), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, src, templ, dstU8), nvcv::Exception);
+}
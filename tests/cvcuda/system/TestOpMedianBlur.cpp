@@ -182,9 +182,15 @@ NVCV_TEST_SUITE_P(OpMedianBlur, test::ValueList<int, int, nvcv::Size2D, int>
     // width,       height,  kernel size, numberImages
     {         9,         9,        {5,5},           1},
     {         9,         9,        {5,5},           4},
+    {        37,        19,        {3,3},           1},
+    {       130,        67,        {3,3},           3},
+    {       131,        66,        {5,5},           2},
+    {         2,         3,        {5,5},           1},
 
     {        21,        21,      {15,15},           1},
     {        21,        21,      {15,15},           4},
+
+    {        70,       135,      {31,17},           2},
 });
 
 // clang-format on
@@ -465,3 +471,104 @@ TEST_P(OpMedianBlur, varshape_correct_output)
         EXPECT_EQ(goldVec, testVec);
     }
 }
+
+TEST(OpMedianBlur, varshape_invalid_ksize_samples_are_copied)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGB8;
+
+    // Valid kernel sizes mixed with even, zero and negative ones
+    std::vector<nvcv::Size2D> ksizeVecs = {
+        {3, 3},
+        {4, 3},
+        {5, 5},
+        {0, 3},
+        {15, 15},
+        {-1, -1}
+    };
+    int numberOfImages = ksizeVecs.size();
+
+    nvcv::Tensor ksizeTensor(nvcv::TensorShape({numberOfImages, 2}, nvcv::TENSOR_NW), nvcv::TYPE_S32);
+    const auto  *ksizeTensorData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(ksizeTensor.exportData());
+    ASSERT_NE(nullptr, ksizeTensorData);
+
+    auto ksizeTensorDataAccess = nvcv::TensorDataAccessStrided::Create(*ksizeTensorData);
+    ASSERT_TRUE(ksizeTensorDataAccess);
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2DAsync(ksizeTensorDataAccess->sampleData(0),
+                                             ksizeTensorDataAccess->sampleStride(), ksizeVecs.data(), sizeof(int2),
+                                             sizeof(int2), numberOfImages, cudaMemcpyHostToDevice, stream));
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst;
+    std::vector<std::vector<uint8_t>>         srcVec(numberOfImages);
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        nvcv::Size2D size{23 + 4 * i, 17 + 2 * i};
+
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+
+        int rowStride = size.w * fmt.planePixelStrideBytes(0);
+
+        srcVec[i].resize(size.h * rowStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return rand(randEng); });
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(nullptr, srcData);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec[i].data(),
+                                            rowStride, rowStride, size.h, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numberOfImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    nvcv::ImageBatchVarShape batchDst(numberOfImages);
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+
+    cvcuda::MedianBlur medianBlurOp(numberOfImages);
+    EXPECT_NO_THROW(medianBlurOp(stream, batchSrc, batchDst, ksizeTensor));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        nvcv::Size2D size      = imgSrc[i]->size();
+        nvcv::Size2D ksize     = ksizeVecs[i];
+        int          rowStride = size.w * fmt.planePixelStrideBytes(0);
+
+        const auto *dstData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[i]->exportData());
+        ASSERT_NE(nullptr, dstData);
+
+        std::vector<uint8_t> testVec(size.h * rowStride);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), rowStride, dstData->plane(0).basePtr,
+                                            dstData->plane(0).rowStride, rowStride, size.h, cudaMemcpyDeviceToHost));
+
+        bool validKernel = ksize.w > 0 && ksize.w % 2 == 1 && ksize.h > 0 && ksize.h % 2 == 1;
+        if (!validKernel)
+        {
+            EXPECT_EQ(srcVec[i], testVec);
+            continue;
+        }
+
+        nvcv::Size2D brdSize{size.w + (ksize.w / 2) * 2, size.h + (ksize.h / 2) * 2};
+        int          brdRowStride = brdSize.w * fmt.planePixelStrideBytes(0);
+
+        std::vector<uint8_t> srcBrdReplicateVec(brdSize.h * brdRowStride);
+        GenerateInputWithBorderReplicate(srcBrdReplicateVec, brdRowStride, brdSize, srcVec[i], rowStride, size, fmt,
+                                         ksize);
+
+        std::vector<uint8_t> goldVec(size.h * rowStride);
+        GenerateMedianBlurGoldenOutput(goldVec, rowStride, size, srcBrdReplicateVec, brdRowStride, brdSize, fmt, ksize);
+
+        EXPECT_EQ(goldVec, testVec);
+    }
+}
@@ -0,0 +1,267 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpMinMaxLoc.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+// Values are drawn from a small range so that minima and maxima appear several times, the first one must be found.
+std::vector<float> RandomImage(int size, nvcv::DataType dtype, std::default_random_engine &rng)
+{
+    std::uniform_int_distribution<int> udist(dtype == nvcv::TYPE_U8 ? 0 : -100, 100);
+
+    std::vector<float> img(size);
+    std::generate(img.begin(), img.end(),
+                  [&]() { return dtype == nvcv::TYPE_F32 ? udist(rng) * 0.25f : static_cast<float>(udist(rng)); });
+    return img;
+}
+
+std::vector<uint8_t> ToBytes(const std::vector<float> &img, nvcv::DataType dtype)
+{
+    std::vector<uint8_t> bytes(img.size() * dtype.strideBytes());
+    for (size_t i = 0; i < img.size(); ++i)
+    {
+        if (dtype == nvcv::TYPE_F32)
+        {
+            std::memcpy(bytes.data() + i * sizeof(float), &img[i], sizeof(float));
+        }
+        else if (dtype == nvcv::TYPE_S16)
+        {
+            int16_t v = static_cast<int16_t>(img[i]);
+            std::memcpy(bytes.data() + i * sizeof(int16_t), &v, sizeof(int16_t));
+        }
+        else
+        {
+            bytes[i] = static_cast<uint8_t>(img[i]);
+        }
+    }
+    return bytes;
+}
+
+struct MinMaxLocResult
+{
+    float minVal, maxVal;
+    int   minLoc[2], maxLoc[2];
+};
+
+MinMaxLocResult MinMaxLoc(const std::vector<float> &img, int width)
+{
+    auto minIt = std::min_element(img.begin(), img.end());
+    auto maxIt = std::max_element(img.begin(), img.end());
+
+    int minIdx = minIt - img.begin();
+    int maxIdx = maxIt - img.begin();
+
+    return {*minIt, *maxIt, {minIdx % width, minIdx / width}, {maxIdx % width, maxIdx / width}};
+}
+
+struct MinMaxLocTensors
+{
+    MinMaxLocTensors(int numImages)
+        : minVal({{numImages, 1, 1, 1}, "NHWC"}, nvcv::TYPE_F32)
+        , minLoc({{numImages, 1, 1, 2}, "NHWC"}, nvcv::TYPE_S32)
+        , maxVal({{numImages, 1, 1, 1}, "NHWC"}, nvcv::TYPE_F32)
+        , maxLoc({{numImages, 1, 1, 2}, "NHWC"}, nvcv::TYPE_S32)
+    {
+    }
+
+    nvcv::Tensor minVal, minLoc, maxVal, maxLoc;
+};
+
+template<typename T>
+T GetSample(nvcv::Tensor &tensor, int sample, int channel)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    EXPECT_NE(nullptr, data);
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    EXPECT_TRUE(access);
+
+    T value{};
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(&value, access->sampleData(sample) + channel * sizeof(T), sizeof(T),
+                                      cudaMemcpyDeviceToHost));
+    return value;
+}
+
+void ExpectMinMaxLoc(const MinMaxLocResult &gold, MinMaxLocTensors &test, int sample)
+{
+    EXPECT_EQ(gold.minVal, GetSample<float>(test.minVal, sample, 0));
+    EXPECT_EQ(gold.maxVal, GetSample<float>(test.maxVal, sample, 0));
+    EXPECT_EQ(gold.minLoc[0], GetSample<int>(test.minLoc, sample, 0));
+    EXPECT_EQ(gold.minLoc[1], GetSample<int>(test.minLoc, sample, 1));
+    EXPECT_EQ(gold.maxLoc[0], GetSample<int>(test.maxLoc, sample, 0));
+    EXPECT_EQ(gold.maxLoc[1], GetSample<int>(test.maxLoc, sample, 1));
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpMinMaxLoc, test::ValueList<int, int, int, nvcv::ImageFormat>
+{
+    // width, height, numImages,         format
+    {      33,     17,         1,   nvcv::FMT_U8 },
+    {     160,    120,         3,   nvcv::FMT_U8 },
+    {      97,     33,         4,  nvcv::FMT_S16 },
+    {      64,     48,         2,  nvcv::FMT_F32 },
+    // A single large image is searched by many blocks
+    {    1920,   1080,         1,   nvcv::FMT_U8 },
+    {    1024,   1024,         1,  nvcv::FMT_F32 }
+});
+
+// clang-format on
+
+TEST_P(OpMinMaxLoc, tensor_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int               width     = GetParamValue<0>();
+    int               height    = GetParamValue<1>();
+    int               numImages = GetParamValue<2>();
+    nvcv::ImageFormat fmt       = GetParamValue<3>();
+
+    nvcv::DataType dtype    = fmt.planeDataType(0);
+    int            rowBytes = width * dtype.strideBytes();
+
+    std::default_random_engine rng;
+
+    nvcv::Tensor imgSrc  = test::CreateTensor(numImages, width, height, fmt);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<std::vector<float>> srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        srcVec[i] = RandomImage(width * height, dtype, rng);
+
+        std::vector<uint8_t> bytes = ToBytes(srcVec[i], dtype);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), bytes.data(), rowBytes,
+                                            rowBytes, height, cudaMemcpyHostToDevice));
+    }
+
+    MinMaxLocTensors out(numImages);
+
+    cvcuda::MinMaxLoc minMaxLocOp;
+    EXPECT_NO_THROW(minMaxLocOp(stream, imgSrc, out.minVal, out.minLoc, out.maxVal, out.maxLoc));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        ExpectMinMaxLoc(MinMaxLoc(srcVec[i], width), out, i);
+    }
+}
+
+TEST_P(OpMinMaxLoc, varshape_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int               width     = GetParamValue<0>();
+    int               height    = GetParamValue<1>();
+    int               numImages = GetParamValue<2>();
+    nvcv::ImageFormat fmt       = GetParamValue<3>();
+
+    nvcv::DataType dtype = fmt.planeDataType(0);
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> sdist(0, std::min(width, height) / 2);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    std::vector<std::vector<float>>           srcVec(numImages);
+    std::vector<int>                          srcWidth(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        nvcv::Size2D size{width - sdist(rng), height - sdist(rng)};
+
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+        srcWidth[i] = size.w;
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(nullptr, srcData);
+
+        srcVec[i] = RandomImage(size.w * size.h, dtype, rng);
+
+        std::vector<uint8_t> bytes     = ToBytes(srcVec[i], dtype);
+        int                  srcStride = size.w * dtype.strideBytes();
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, bytes.data(),
+                                            srcStride, srcStride, size.h, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    MinMaxLocTensors out(numImages);
+
+    cvcuda::MinMaxLoc minMaxLocOp;
+    EXPECT_NO_THROW(minMaxLocOp(stream, batchSrc, out.minVal, out.minLoc, out.maxVal, out.maxLoc));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        ExpectMinMaxLoc(MinMaxLoc(srcVec[i], srcWidth[i]), out, i);
+    }
+}
+
+TEST(OpMinMaxLoc, invalid_arguments)
+{
+    nvcv::Tensor imgSrc = test::CreateTensor(2, 64, 48, nvcv::FMT_U8);
+    nvcv::Tensor imgRGB = test::CreateTensor(2, 64, 48, nvcv::FMT_RGB8);
+
+    MinMaxLocTensors out(2);
+    MinMaxLocTensors outSamples(3);
+
+    nvcv::Tensor locF32({{2, 1, 1, 2}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor loc1({{2, 1, 1, 1}, "NHWC"}, nvcv::TYPE_S32);
+
+    cvcuda::MinMaxLoc minMaxLocOp;
+    EXPECT_NO_THROW(minMaxLocOp(nullptr, imgSrc, out.minVal, out.minLoc, out.maxVal, out.maxLoc));
+    // input must have a single channel
+    EXPECT_THROW(minMaxLocOp(nullptr, imgRGB, out.minVal, out.minLoc, out.maxVal, out.maxLoc), nvcv::Exception);
+    EXPECT_THROW(minMaxLocOp(nullptr, imgSrc, outSamples.minVal, outSamples.minLoc, outSamples.maxVal,
+                             outSamples.maxLoc),
+                 nvcv::Exception);
+    EXPECT_THROW(minMaxLocOp(nullptr, imgSrc, out.minVal, locF32, out.maxVal, out.maxLoc), nvcv::Exception);
+    EXPECT_THROW(minMaxLocOp(nullptr, imgSrc, out.minVal, out.minLoc, out.maxVal, loc1), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -27,6 +27,7 @@
 #include <nvcv/TensorDataAccess.hpp>
 #include <nvcv/cuda/TypeTraits.hpp>
 
+#include <algorithm>
 #include <random>
 
 namespace test = nvcv::test;
@@ -362,6 +363,8 @@ NVCV_TEST_SUITE_P(OpMorphology, test::ValueList<int, int, int, NVCVImageFormat,
     {    325,     45,       3,      NVCV_IMAGE_FORMAT_RGB8,        3,         3,   NVCV_BORDER_CONSTANT, NVCV_DILATE},
     {     25,     45,       1,      NVCV_IMAGE_FORMAT_U8,          3,         3,   NVCV_BORDER_CONSTANT, NVCV_ERODE},
     {     25,     45,       2,      NVCV_IMAGE_FORMAT_U8,          3,         3,   NVCV_BORDER_CONSTANT, NVCV_DILATE},
+    {     77,     70,       2,      NVCV_IMAGE_FORMAT_U8,         15,         9,   NVCV_BORDER_CONSTANT, NVCV_ERODE},
+    {     70,     77,       1,      NVCV_IMAGE_FORMAT_RGBA8,       5,        41,   NVCV_BORDER_CONSTANT, NVCV_DILATE},
 
 });
 
@@ -485,6 +488,151 @@ TEST_P(OpMorphology, morph_random)
     EXPECT_EQ(testVec, goldVec);
 }
 
+// Gold of the compound operations on 8-bit formats, as two erosions/dilations with the border applied to the
+// intermediate image and a saturated byte-wise difference.
+static void MorphCompound(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std::vector<uint8_t> &hSrc,
+                          const long3 &srcStrides, const int3 &shape, const nvcv::ImageFormat &format,
+                          const nvcv::Size2D &maskSize, NVCVBorderType borderMode, NVCVMorphologyType type)
+{
+    bool               erodeFirst = type == NVCV_OPEN || type == NVCV_TOPHAT;
+    NVCVMorphologyType first      = erodeFirst ? NVCV_ERODE : NVCV_DILATE;
+    NVCVMorphologyType second     = erodeFirst ? NVCV_DILATE : NVCV_ERODE;
+
+    std::vector<uint8_t> tmpVec(hDst.size());
+
+    int2 anchor{-1, -1};
+    test::Morph(tmpVec, dstStrides, hSrc, srcStrides, shape, format, maskSize, anchor, borderMode, first);
+    if (type == NVCV_GRADIENT)
+    {
+        // gradient is the dilation minus the erosion of the source
+        second = NVCV_ERODE;
+        test::Morph(hDst, dstStrides, hSrc, srcStrides, shape, format, maskSize, anchor, borderMode, second);
+    }
+    else
+    {
+        test::Morph(hDst, dstStrides, tmpVec, dstStrides, shape, format, maskSize, anchor, borderMode, second);
+    }
+
+    long rowBytes = shape.x * dstStrides.z;
+    for (int b = 0; b < shape.z; ++b)
+    {
+        for (int y = 0; y < shape.y; ++y)
+        {
+            for (long i = 0; i < rowBytes; ++i)
+            {
+                uint8_t &res = hDst[b * dstStrides.x + y * dstStrides.y + i];
+                int      src = hSrc[b * srcStrides.x + y * srcStrides.y + i];
+                int      tmp = tmpVec[b * dstStrides.x + y * dstStrides.y + i];
+
+                switch (type)
+                {
+                case NVCV_GRADIENT:
+                    res = std::max(tmp - res, 0);
+                    break;
+                case NVCV_TOPHAT:
+                    res = std::max(src - res, 0);
+                    break;
+                case NVCV_BLACKHAT:
+                    res = std::max(res - src, 0);
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// clang-format off
+NVCV_TEST_SUITE_P(OpMorphologyCompound, test::ValueList<int, int, int, NVCVImageFormat, int, int, NVCVBorderType, NVCVMorphologyType>
+{
+    // width, height, batches,                    format,  maskWidth, maskHeight,            borderMode, morphType
+    {      5,      5,       1,      NVCV_IMAGE_FORMAT_U8,          3,         3,   NVCV_BORDER_CONSTANT, NVCV_OPEN},
+    {     25,     45,       2,      NVCV_IMAGE_FORMAT_U8,          3,         3,   NVCV_BORDER_REPLICATE, NVCV_CLOSE},
+    {    125,     35,       1,      NVCV_IMAGE_FORMAT_RGBA8,       5,         3,   NVCV_BORDER_REFLECT, NVCV_GRADIENT},
+    {     52,     45,       1,      NVCV_IMAGE_FORMAT_RGB8,        3,         5,   NVCV_BORDER_CONSTANT, NVCV_TOPHAT},
+    {     77,     70,       2,      NVCV_IMAGE_FORMAT_U8,         15,         9,   NVCV_BORDER_WRAP, NVCV_BLACKHAT},
+    {     70,     77,       1,      NVCV_IMAGE_FORMAT_RGBA8,       2,         4,   NVCV_BORDER_REFLECT101, NVCV_OPEN},
+    {     33,      9,       3,      NVCV_IMAGE_FORMAT_U8,          4,         2,   NVCV_BORDER_CONSTANT, NVCV_CLOSE},
+    {     40,     17,       1,      NVCV_IMAGE_FORMAT_U8,          1,         1,   NVCV_BORDER_REPLICATE, NVCV_TOPHAT},
+});
+
+// clang-format on
+
+TEST_P(OpMorphologyCompound, morph_compound_random)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int width   = GetParamValue<0>();
+    int height  = GetParamValue<1>();
+    int batches = GetParamValue<2>();
+
+    nvcv::ImageFormat format{GetParamValue<3>()};
+
+    nvcv::Size2D maskSize;
+    maskSize.w                    = GetParamValue<4>();
+    maskSize.h                    = GetParamValue<5>();
+    NVCVBorderType     borderMode = GetParamValue<6>();
+    NVCVMorphologyType morphType  = GetParamValue<7>();
+
+    int  iteration = 1;
+    int3 shape{width, height, batches};
+
+    nvcv::Tensor inTensor  = test::CreateTensor(batches, width, height, format);
+    nvcv::Tensor outTensor = test::CreateTensor(batches, width, height, format);
+
+    const auto *inData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inTensor.exportData());
+    const auto *outData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outTensor.exportData());
+
+    ASSERT_NE(inData, nullptr);
+    ASSERT_NE(outData, nullptr);
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    ASSERT_TRUE(inAccess);
+
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*outData);
+    ASSERT_TRUE(outAccess);
+
+    long3 inStrides{inAccess->sampleStride(), inAccess->rowStride(), inAccess->colStride()};
+    long3 outStrides{outAccess->sampleStride(), outAccess->rowStride(), outAccess->colStride()};
+
+    if (inData->rank() == 3)
+    {
+        inStrides.x  = inAccess->numRows() * inAccess->rowStride();
+        outStrides.x = outAccess->numRows() * outAccess->rowStride();
+    }
+
+    long inBufSize  = inStrides.x * inAccess->numSamples();
+    long outBufSize = outStrides.x * outAccess->numSamples();
+
+    std::vector<uint8_t> inVec(inBufSize);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), inVec.data(), inBufSize, cudaMemcpyHostToDevice));
+
+    cvcuda::Morphology morphOp(0);
+    int2               anchor(-1, -1);
+
+    EXPECT_NO_THROW(morphOp(stream, inTensor, outTensor, morphType, maskSize, anchor, iteration, borderMode));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<uint8_t> goldVec(outBufSize);
+    std::vector<uint8_t> testVec(outBufSize);
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), outData->basePtr(), outBufSize, cudaMemcpyDeviceToHost));
+
+    MorphCompound(goldVec, outStrides, inVec, inStrides, shape, format, maskSize, borderMode, morphType);
+
+    EXPECT_EQ(testVec, goldVec);
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpMorphologyVarShape, test::ValueList<int, int, int, NVCVImageFormat, int, int, NVCVBorderType, NVCVMorphologyType>
 {
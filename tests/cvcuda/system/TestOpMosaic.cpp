@@ -0,0 +1,372 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpMosaic.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace test = nvcv::test;
+
+namespace {
+
+struct Image
+{
+    nvcv::Size2D         size;
+    std::vector<uint8_t> data; // packed HWC
+};
+
+// Canvas pixels [lo, hi) whose centers are inside [c1, c2), clipped to [0, size).
+std::pair<int, int> CoveredPixels(float c1, float c2, int size)
+{
+    auto clip = [&](float c) { return static_cast<int>(std::min(std::max(std::ceil(c - 0.5f), 0.f), 1.f * size)); };
+    return {clip(c1), clip(c2)};
+}
+
+float AreaSample(const Image &img, int channels, int c, float fx, float fy, float scaleX, float scaleY)
+{
+    const float fw = std::max(scaleX, 1.f), fh = std::max(scaleY, 1.f);
+
+    float ax = std::max(fx - 0.5f * fw, 0.f), bx = std::min(fx + 0.5f * fw, 1.f * img.size.w);
+    float ay = std::max(fy - 0.5f * fh, 0.f), by = std::min(fy + 0.5f * fh, 1.f * img.size.h);
+    if (bx <= ax)
+    {
+        ax = std::min(std::floor(ax), img.size.w - 1.f);
+        bx = ax + 1;
+    }
+    if (by <= ay)
+    {
+        ay = std::min(std::floor(ay), img.size.h - 1.f);
+        by = ay + 1;
+    }
+
+    float sum = 0;
+    for (int sy = std::floor(ay); sy < std::ceil(by); ++sy)
+    {
+        const float wy = std::min(by, sy + 1.f) - std::max(ay, 1.f * sy);
+        for (int sx = std::floor(ax); sx < std::ceil(bx); ++sx)
+        {
+            const float wx = std::min(bx, sx + 1.f) - std::max(ax, 1.f * sx);
+            sum += img.data[(sy * img.size.w + sx) * channels + c] * wx * wy;
+        }
+    }
+    return sum / ((bx - ax) * (by - ay));
+}
+
+// Resizes each image into its rectangle of the packed HWC canvases, the same way as cvcuda::Mosaic.
+void Mosaic(std::vector<std::vector<uint8_t>> &canvases, nvcv::Size2D canvasSize, int channels,
+            const std::vector<Image> &images, const std::vector<std::vector<float>> &rects,
+            NVCVInterpolationType interp)
+{
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        const Image &img    = images[i];
+        const int    canvas = std::lround(rects[i][0]);
+        const float  x1 = rects[i][1], y1 = rects[i][2], x2 = rects[i][3], y2 = rects[i][4];
+        if (canvas < 0 || canvas >= static_cast<int>(canvases.size()) || !(x2 > x1 && y2 > y1))
+        {
+            continue;
+        }
+
+        const auto [loX, hiX] = CoveredPixels(x1, x2, canvasSize.w);
+        const auto [loY, hiY] = CoveredPixels(y1, y2, canvasSize.h);
+
+        const float scaleX = img.size.w / (x2 - x1);
+        const float scaleY = img.size.h / (y2 - y1);
+
+        auto at = [&](int y, int x, int c)
+        {
+            x = std::clamp(x, 0, img.size.w - 1);
+            y = std::clamp(y, 0, img.size.h - 1);
+            return static_cast<float>(img.data[(y * img.size.w + x) * channels + c]);
+        };
+
+        for (int y = loY; y < hiY; ++y)
+        {
+            for (int x = loX; x < hiX; ++x)
+            {
+                const float fx = (x + 0.5f - x1) * scaleX;
+                const float fy = (y + 0.5f - y1) * scaleY;
+
+                for (int c = 0; c < channels; ++c)
+                {
+                    float value;
+                    if (interp == NVCV_INTERP_NEAREST)
+                    {
+                        value = at(std::floor(fy), std::floor(fx), c);
+                    }
+                    else if (interp == NVCV_INTERP_AREA)
+                    {
+                        value = AreaSample(img, channels, c, fx, fy, scaleX, scaleY);
+                    }
+                    else
+                    {
+                        const int   sx = std::floor(fx - 0.5f), sy = std::floor(fy - 0.5f);
+                        const float ax = fx - 0.5f - sx, ay = fy - 0.5f - sy;
+
+                        value = (1 - ay) * (at(sy, sx, c) * (1 - ax) + at(sy, sx + 1, c) * ax)
+                              + ay * (at(sy + 1, sx, c) * (1 - ax) + at(sy + 1, sx + 1, c) * ax);
+                    }
+                    canvases[canvas][(y * canvasSize.w + x) * channels + c]
+                        = static_cast<uint8_t>(std::clamp(std::lround(value), 0L, 255L));
+                }
+            }
+        }
+    }
+}
+
+std::unique_ptr<nvcv::Tensor> CreateRects(const std::vector<std::vector<float>> &hRects)
+{
+    auto rects = std::make_unique<nvcv::Tensor>(
+        nvcv::TensorShape{{static_cast<int64_t>(hRects.size()), 5}, nvcv::TENSOR_NW}, nvcv::TYPE_F32);
+
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(rects->exportData());
+    EXPECT_NE(nullptr, data);
+
+    for (size_t i = 0; i < hRects.size(); ++i)
+    {
+        EXPECT_EQ(cudaSuccess, cudaMemcpy(data->basePtr() + i * data->stride(0), hRects[i].data(), 5 * sizeof(float),
+                                          cudaMemcpyHostToDevice));
+    }
+    return rects;
+}
+
+void CopyTensor(nvcv::Tensor &tensor, std::vector<std::vector<uint8_t>> &hData, cudaMemcpyKind kind)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(nullptr, data);
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    ASSERT_TRUE(access);
+
+    int rowStride = access->numCols() * access->colStride();
+
+    hData.resize(access->numSamples());
+    for (int i = 0; i < access->numSamples(); ++i)
+    {
+        hData[i].resize(access->numRows() * rowStride);
+        if (kind == cudaMemcpyHostToDevice)
+        {
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(access->sampleData(i), access->rowStride(), hData[i].data(), rowStride,
+                                                rowStride, access->numRows(), kind));
+        }
+        else
+        {
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(hData[i].data(), rowStride, access->sampleData(i), access->rowStride(),
+                                                rowStride, access->numRows(), kind));
+        }
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpMosaic, test::ValueList<nvcv::ImageFormat, NVCVInterpolationType>
+{
+    {  nvcv::FMT_U8, NVCV_INTERP_NEAREST },
+    {  nvcv::FMT_U8, NVCV_INTERP_LINEAR  },
+    {  nvcv::FMT_U8, NVCV_INTERP_AREA    },
+    { nvcv::FMT_RGB8, NVCV_INTERP_NEAREST },
+    { nvcv::FMT_RGB8, NVCV_INTERP_LINEAR  },
+    { nvcv::FMT_RGB8, NVCV_INTERP_AREA    },
+    { nvcv::FMT_RGBA8, NVCV_INTERP_LINEAR },
+    { nvcv::FMT_RGBA8, NVCV_INTERP_AREA   },
+});
+
+// clang-format on
+
+TEST_P(OpMosaic, correct_output)
+{
+    const nvcv::ImageFormat     fmt    = GetParamValue<0>();
+    const NVCVInterpolationType interp = GetParamValue<1>();
+
+    const int          channels = fmt.numChannels();
+    const nvcv::Size2D canvasSize{96, 64};
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> udist(0, 255), sizeDist(10, 150);
+
+    // a 2x2 grid on the 1st canvas, a mosaic around a fractional center clipping its 4 images on the 2nd one, and
+    // rectangles outside of the canvases, of a canvas that doesn't exist or empty
+    std::vector<std::vector<float>> hRects = {
+        {0,     0,     0,   48,   32},
+        {0,    48,     0,   96,   32},
+        {0,     0,    32,   48,   64},
+        {0,    48,    32,   96,   64},
+        {1,   -40, -30.5f, 37.25f, 21.5f},
+        {1, 37.25f, -10,   130,  21.5f},
+        {1,   -20, 21.5f, 37.25f,   90},
+        {1, 37.25f, 21.5f,  70.5f, 50.75f},
+        {1,   100,    10,   120,   20},
+        {2,     0,     0,   10,   10},
+        {0,    20,    20,   20,   30},
+    };
+    const int numImages = hRects.size();
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    std::vector<Image>                        images(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        images[i].size = nvcv::Size2D{sizeDist(rng), sizeDist(rng)};
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(images[i].size, fmt));
+
+        int rowStride = images[i].size.w * channels;
+        images[i].data.resize(images[i].size.h * rowStride);
+        std::generate(images[i].data.begin(), images[i].data.end(), [&]() { return udist(rng); });
+
+        auto *imgData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(imgData, nullptr);
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(imgData->plane(0).basePtr, imgData->plane(0).rowStride, images[i].data.data(),
+                               rowStride, rowStride, images[i].size.h, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    auto rects = CreateRects(hRects);
+
+    // the canvases are filled with a background, the pixels outside of the rectangles must keep it
+    nvcv::Tensor                      imgDst = test::CreateTensor(2, canvasSize.w, canvasSize.h, fmt);
+    std::vector<std::vector<uint8_t>> goldVec(2);
+    for (auto &canvas : goldVec)
+    {
+        canvas.resize(canvasSize.w * canvasSize.h * channels);
+        std::generate(canvas.begin(), canvas.end(), [&]() { return udist(rng); });
+    }
+    ASSERT_NO_FATAL_FAILURE(CopyTensor(imgDst, goldVec, cudaMemcpyHostToDevice));
+
+    cvcuda::Mosaic op;
+    EXPECT_NO_THROW(op(stream, batchSrc, *rects, imgDst, interp));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    std::vector<std::vector<uint8_t>> testVec;
+    ASSERT_NO_FATAL_FAILURE(CopyTensor(imgDst, testVec, cudaMemcpyDeviceToHost));
+
+    Mosaic(goldVec, canvasSize, channels, images, hRects, interp);
+
+    for (int c = 0; c < 2; ++c)
+    {
+        SCOPED_TRACE(c);
+        for (size_t k = 0; k < goldVec[c].size(); ++k)
+        {
+            ASSERT_LE(std::abs(static_cast<int>(goldVec[c][k]) - static_cast<int>(testVec[c][k])), 1) << "at " << k;
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpMosaic, integer_rect_matches_resize_size)
+{
+    // the source pixel centers land on the canvas ones when the rectangle has the source size
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGB8;
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> udist(0, 255);
+
+    Image src{nvcv::Size2D{40, 30}, std::vector<uint8_t>(40 * 30 * 3)};
+    std::generate(src.data.begin(), src.data.end(), [&]() { return udist(rng); });
+
+    nvcv::Image img(src.size, fmt);
+    auto       *imgData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(img.exportData());
+    ASSERT_NE(imgData, nullptr);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(imgData->plane(0).basePtr, imgData->plane(0).rowStride, src.data.data(),
+                                        40 * 3, 40 * 3, 30, cudaMemcpyHostToDevice));
+
+    nvcv::ImageBatchVarShape batch(1);
+    batch.pushBack(img);
+
+    auto         rects  = CreateRects({{0, 5, 7, 45, 37}});
+    nvcv::Tensor imgDst = test::CreateTensor(1, 50, 40, fmt);
+
+    cvcuda::Mosaic op;
+    for (NVCVInterpolationType interp : {NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR, NVCV_INTERP_AREA})
+    {
+        SCOPED_TRACE(interp);
+
+        EXPECT_NO_THROW(op(stream, batch, *rects, imgDst, interp));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        std::vector<std::vector<uint8_t>> testVec;
+        ASSERT_NO_FATAL_FAILURE(CopyTensor(imgDst, testVec, cudaMemcpyDeviceToHost));
+        for (int y = 0; y < 30; ++y)
+        {
+            for (int k = 0; k < 40 * 3; ++k)
+            {
+                ASSERT_EQ(src.data[y * 40 * 3 + k], testVec[0][((y + 7) * 50 + 5) * 3 + k]) << "at " << y << ", " << k;
+            }
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpMosaic, invalid_arguments)
+{
+    std::vector<std::unique_ptr<nvcv::Image>> images;
+    for (nvcv::ImageFormat fmt : {nvcv::FMT_RGB8, nvcv::FMT_RGBA8})
+    {
+        images.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{32, 24}, fmt));
+    }
+    nvcv::ImageBatchVarShape batch(3);
+    batch.pushBack(*images[0]);
+    batch.pushBack(*images[0]);
+
+    auto rects  = CreateRects({{0, 0, 0, 8, 8}, {0, 8, 0, 16, 8}});
+    auto rects3 = CreateRects({{0, 0, 0, 8, 8}, {0, 8, 0, 16, 8}, {0, 0, 8, 8, 16}});
+
+    nvcv::Tensor rects4({{2, 4}, "NW"}, nvcv::TYPE_F32);
+    nvcv::Tensor rectsS32({{2, 5}, "NW"}, nvcv::TYPE_S32);
+
+    nvcv::Tensor imgDst  = test::CreateTensor(1, 16, 16, nvcv::FMT_RGB8);
+    nvcv::Tensor imgRGBA = test::CreateTensor(1, 16, 16, nvcv::FMT_RGBA8);
+    nvcv::Tensor imgF32  = test::CreateTensor(1, 16, 16, nvcv::FMT_RGBf32);
+
+    cvcuda::Mosaic op;
+    EXPECT_NO_THROW(op(nullptr, batch, *rects, imgDst, NVCV_INTERP_LINEAR));
+    // one rectangle per image
+    EXPECT_THROW(op(nullptr, batch, *rects3, imgDst, NVCV_INTERP_LINEAR), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, batch, rects4, imgDst, NVCV_INTERP_LINEAR), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, batch, rectsS32, imgDst, NVCV_INTERP_LINEAR), nvcv::Exception);
+    // canvases have the format of the images
+    EXPECT_THROW(op(nullptr, batch, *rects, imgRGBA, NVCV_INTERP_LINEAR), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, batch, *rects, imgF32, NVCV_INTERP_LINEAR), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, batch, *rects, imgDst, NVCV_INTERP_CUBIC), nvcv::Exception);
+    // images must all have the same format
+    batch.pushBack(*images[1]);
+    EXPECT_THROW(op(nullptr, batch, *rects3, imgDst, NVCV_INTERP_LINEAR), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
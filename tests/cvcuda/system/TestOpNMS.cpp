@@ -0,0 +1,262 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpNMS.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+constexpr float kScoreThreshold = 0.05f;
+constexpr float kIoUThreshold   = 0.5f;
+
+float GoldIoU(const float *a, const float *b)
+{
+    const float iw = std::min(a[2], b[2]) - std::max(a[0], b[0]);
+    const float ih = std::min(a[3], b[3]) - std::max(a[1], b[1]);
+    if (iw <= 0.f || ih <= 0.f)
+    {
+        return 0.f;
+    }
+    const float inter = iw * ih;
+    const float uni   = (a[2] - a[0]) * (a[3] - a[1]) + (b[2] - b[0]) * (b[3] - b[1]) - inter;
+    return uni > 0.f ? inter / uni : 0.f;
+}
+
+// Greedy NMS on one sample, suppressed boxes have a live score of -inf
+void GoldNMS(const float *boxes, const float *scores, const int *classes, int numBoxes, int maxOutput,
+             float softSigma, std::vector<int> &indices, std::vector<float> &keptScores)
+{
+    std::vector<float> live(numBoxes);
+    for (int i = 0; i < numBoxes; ++i)
+    {
+        live[i] = scores[i] >= kScoreThreshold ? scores[i] : -INFINITY;
+    }
+
+    while ((int)indices.size() < maxOutput)
+    {
+        int best = -1;
+        for (int i = 0; i < numBoxes; ++i)
+        {
+            if (live[i] != -INFINITY && (best < 0 || live[i] > live[best]))
+            {
+                best = i;
+            }
+        }
+        if (best < 0)
+        {
+            break;
+        }
+
+        indices.push_back(best);
+        keptScores.push_back(live[best]);
+        live[best] = -INFINITY;
+
+        for (int i = 0; i < numBoxes; ++i)
+        {
+            if (live[i] == -INFINITY || (classes && classes[i] != classes[best]))
+            {
+                continue;
+            }
+
+            const float iou = GoldIoU(&boxes[best * 4], &boxes[i * 4]);
+            if (softSigma > 0.f)
+            {
+                live[i] *= std::exp(-iou * iou / softSigma);
+                if (live[i] < kScoreThreshold)
+                {
+                    live[i] = -INFINITY;
+                }
+            }
+            else if (iou > kIoUThreshold)
+            {
+                live[i] = -INFINITY;
+            }
+        }
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpNMS, test::ValueList<int, int, int, int, float>
+{
+    // numSamples, numBoxes, maxOutput, numClasses, softSigma
+    {            1,       10,         5,          0,       0.f },
+    {            4,     1000,       100,          0,       0.f },
+    {            3,      500,        50,          5,       0.f },
+    {            2,     2000,       300,         80,       0.f },
+    {            2,      300,        30,          0,      0.5f },
+    {            3,      200,       200,          4,      0.5f }
+});
+
+// clang-format on
+
+TEST_P(OpNMS, correct_output)
+{
+    const int   numSamples = GetParamValue<0>();
+    const int   numBoxes   = GetParamValue<1>();
+    const int   maxOutput  = GetParamValue<2>();
+    const int   numClasses = GetParamValue<3>();
+    const float softSigma  = GetParamValue<4>();
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor boxes({{numSamples, 1, numBoxes, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor scores({{numSamples, 1, numBoxes, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor classes({{numSamples, 1, numBoxes, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor outIndices({{numSamples, 1, maxOutput, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor outScores({{numSamples, 1, maxOutput, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor outCount({{numSamples, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    const auto *boxData      = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(boxes.exportData());
+    const auto *scoreData    = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(scores.exportData());
+    const auto *classData    = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(classes.exportData());
+    const auto *outIndexData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outIndices.exportData());
+    const auto *outScoreData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outScores.exportData());
+    const auto *outCountData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outCount.exportData());
+    ASSERT_TRUE(boxData && scoreData && classData && outIndexData && outScoreData && outCountData);
+
+    // Boxes are clustered so that many of them overlap, and scores are distinct so that ranks don't depend on
+    // rounding
+    std::default_random_engine            rng;
+    std::uniform_real_distribution<float> posDist(0.f, 200.f);
+    std::uniform_real_distribution<float> sizeDist(10.f, 60.f);
+    std::uniform_int_distribution<int>    classDist(0, std::max(numClasses - 1, 0));
+
+    std::vector<float> srcBoxes(numSamples * numBoxes * 4);
+    for (size_t i = 0; i < srcBoxes.size(); i += 4)
+    {
+        srcBoxes[i]     = posDist(rng);
+        srcBoxes[i + 1] = posDist(rng);
+        srcBoxes[i + 2] = srcBoxes[i] + sizeDist(rng);
+        srcBoxes[i + 3] = srcBoxes[i + 1] + sizeDist(rng);
+    }
+
+    std::vector<float> srcScores(numSamples * numBoxes);
+    for (int n = 0; n < numSamples; ++n)
+    {
+        for (int i = 0; i < numBoxes; ++i)
+        {
+            srcScores[n * numBoxes + i] = (i + 1) / (numBoxes + 1.f);
+        }
+        std::shuffle(srcScores.begin() + n * numBoxes, srcScores.begin() + (n + 1) * numBoxes, rng);
+    }
+
+    std::vector<int> srcClasses(numSamples * numBoxes);
+    std::generate(srcClasses.begin(), srcClasses.end(), [&]() { return classDist(rng); });
+
+    const int boxRowBytes = numBoxes * 4 * sizeof(float);
+    const int rowBytes    = numBoxes * sizeof(float);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(boxData->basePtr(), boxData->stride(0), srcBoxes.data(), boxRowBytes,
+                                        boxRowBytes, numSamples, cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(scoreData->basePtr(), scoreData->stride(0), srcScores.data(), rowBytes,
+                                        rowBytes, numSamples, cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(classData->basePtr(), classData->stride(0), srcClasses.data(), rowBytes,
+                                        rowBytes, numSamples, cudaMemcpyHostToDevice));
+
+    cvcuda::NMS nmsOp(numSamples, numBoxes);
+    if (numClasses > 0)
+    {
+        EXPECT_NO_THROW(nmsOp(stream, boxes, scores, classes, outIndices, outScores, outCount, kScoreThreshold,
+                              kIoUThreshold, softSigma));
+    }
+    else
+    {
+        EXPECT_NO_THROW(
+            nmsOp(stream, boxes, scores, outIndices, outScores, outCount, kScoreThreshold, kIoUThreshold, softSigma));
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const int          outRowBytes = maxOutput * sizeof(int);
+    std::vector<int>   testIndices(numSamples * maxOutput);
+    std::vector<float> testScores(numSamples * maxOutput);
+    std::vector<int>   testCount(numSamples);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testIndices.data(), outRowBytes, outIndexData->basePtr(),
+                                        outIndexData->stride(0), outRowBytes, numSamples, cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testScores.data(), outRowBytes, outScoreData->basePtr(),
+                                        outScoreData->stride(0), outRowBytes, numSamples, cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testCount.data(), sizeof(int), outCountData->basePtr(),
+                                        outCountData->stride(0), sizeof(int), numSamples, cudaMemcpyDeviceToHost));
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        std::vector<int>   goldIndices;
+        std::vector<float> goldScores;
+        GoldNMS(&srcBoxes[n * numBoxes * 4], &srcScores[n * numBoxes],
+                numClasses > 0 ? &srcClasses[n * numBoxes] : nullptr, numBoxes, maxOutput, softSigma, goldIndices,
+                goldScores);
+
+        ASSERT_EQ((int)goldIndices.size(), testCount[n]) << "at sample " << n;
+
+        for (int r = 0; r < maxOutput; ++r)
+        {
+            const bool kept = r < testCount[n];
+
+            EXPECT_EQ(kept ? goldIndices[r] : -1, testIndices[n * maxOutput + r]) << "at sample " << n << " rank " << r;
+            EXPECT_NEAR(kept ? goldScores[r] : 0.f, testScores[n * maxOutput + r], 1e-5f)
+                << "at sample " << n << " rank " << r;
+        }
+    }
+}
+
+TEST(OpNMS, invalid_arguments)
+{
+    nvcv::Tensor boxes({{2, 1, 100, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor boxesC3({{2, 1, 100, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor boxesLarge({{2, 1, 101, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor boxes3N({{3, 1, 100, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor scores({{2, 1, 100, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor scoresW99({{2, 1, 99, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor classes({{2, 1, 100, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor classesF32({{2, 1, 100, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor indices({{2, 1, 10, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor indicesW9({{2, 1, 9, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor outScores({{2, 1, 10, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor count({{2, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor countF32({{2, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+
+    EXPECT_THROW(cvcuda::NMS(-1, 100), nvcv::Exception);
+
+    cvcuda::NMS nmsOp(2, 100);
+    EXPECT_NO_THROW(nmsOp(nullptr, boxes, scores, indices, outScores, count, 0.1f, 0.5f));
+    EXPECT_NO_THROW(nmsOp(nullptr, boxes, scores, classes, indices, outScores, count, 0.1f, 0.5f, 0.5f));
+    EXPECT_THROW(nmsOp(nullptr, boxesC3, scores, indices, outScores, count, 0.1f, 0.5f), nvcv::Exception);
+    EXPECT_THROW(nmsOp(nullptr, boxesLarge, scores, indices, outScores, count, 0.1f, 0.5f), nvcv::Exception);
+    EXPECT_THROW(nmsOp(nullptr, boxes3N, scores, indices, outScores, count, 0.1f, 0.5f), nvcv::Exception);
+    EXPECT_THROW(nmsOp(nullptr, boxes, scoresW99, indices, outScores, count, 0.1f, 0.5f), nvcv::Exception);
+    EXPECT_THROW(nmsOp(nullptr, boxes, scores, classesF32, indices, outScores, count, 0.1f, 0.5f), nvcv::Exception);
+    EXPECT_THROW(nmsOp(nullptr, boxes, scores, indicesW9, outScores, count, 0.1f, 0.5f), nvcv::Exception);
+    EXPECT_THROW(nmsOp(nullptr, boxes, scores, indices, outScores, countF32, 0.1f, 0.5f), nvcv::Exception);
+    EXPECT_THROW(nmsOp(nullptr, boxes, scores, indices, outScores, count, 0.1f, -0.5f), nvcv::Exception);
+    EXPECT_THROW(nmsOp(nullptr, boxes, scores, indices, outScores, count, 0.1f, 0.5f, -1.f), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -20,6 +20,7 @@
 #include <common/TensorDataUtils.hpp>
 #include <common/ValueTests.hpp>
 #include <cvcuda/OpNormalize.hpp>
+#include <cvcuda/Operator.h>
 #include <nvcv/Image.hpp>
 #include <nvcv/ImageBatch.hpp>
 #include <nvcv/Tensor.hpp>
@@ -27,6 +28,8 @@
 #include <nvcv/alloc/CustomAllocator.hpp>
 #include <nvcv/alloc/CustomResourceAllocator.hpp>
 
+#include <cuda_fp16.h>
+
 #include <cmath>
 #include <random>
 
@@ -96,7 +99,9 @@ NVCV_TEST_SUITE_P(OpNormalize, test::ValueList<int, int, int, bool, bool, uint32
     {     63,     32,         7,      false,        true,   normalScale,        1.3f,        0.3f,     0.f, },
     {     22,     13,         9,       true,       false,   normalScale,        1.4f,        0.4f,     0.f, },
     {     55,     33,         2,       true,       false, scaleIsStdDev,        2.1f,        1.1f,   1.23f, },
-    {    444,    222,         4,       true,       false, scaleIsStdDev,        2.2f,        2.2f,   12.3f, }
+    {    444,    222,         4,       true,       false, scaleIsStdDev,        2.2f,        2.2f,   12.3f, },
+    {     16,     12,       100,      false,       false,   normalScale,        1.5f,        0.5f,     0.f, },
+    {     40,     36,        50,       true,       false, scaleIsStdDev,        1.6f,        0.6f,    0.5f, }
 });
 
 // clang-format on
@@ -398,3 +403,424 @@ TEST_P(OpNormalize, varshape_correct_output)
         EXPECT_THAT(testVec, t::ElementsAreArray(goldVec));
     }
 }
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpNormalizeStats, test::ValueList<int, int, int, bool, bool, float>
+{
+    // width, height, numImages, perSample, perChannel, epsilon,
+    {     32,     33,         1,      true,       true,     0.f, },
+    {     66,     55,         3,      true,      false,     0.f, },
+    {    122,    212,         2,     false,       true,   1.23f, },
+    {     21,     12,         5,     false,      false,     0.f, },
+    {    640,    480,         2,      true,       true,     0.f, },
+    {    444,    222,         4,     false,      false,   12.3f, }
+});
+
+// clang-format on
+
+TEST_P(OpNormalizeStats, tensor_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int   width      = GetParamValue<0>();
+    int   height     = GetParamValue<1>();
+    int   numImages  = GetParamValue<2>();
+    bool  perSample  = GetParamValue<3>();
+    bool  perChannel = GetParamValue<4>();
+    float epsilon    = GetParamValue<5>();
+
+    const float globalScale = 64.f;
+    const float globalShift = 128.f;
+
+    int               paramNumImages = (perSample ? numImages : 1);
+    nvcv::ImageFormat paramFormat    = (perChannel ? nvcv::FMT_RGBAf32 : nvcv::FMT_F32);
+    int               paramChannels  = paramFormat.numChannels();
+
+    nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    std::default_random_engine rng;
+
+    // Create input tensor
+    nvcv::Tensor imgSrc  = test::CreateTensor(numImages, width, height, fmt);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<std::vector<uint8_t>> srcVec(numImages);
+    int                               srcVecRowStride = width * fmt.numChannels();
+    for (int i = 0; i < numImages; ++i)
+    {
+        std::uniform_int_distribution<uint8_t> udist(0, 255);
+
+        srcVec[i].resize(height * srcVecRowStride);
+        generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return udist(rng); });
+
+        // Copy input data to the GPU
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(), srcVecRowStride,
+                               srcVecRowStride, // vec has no padding
+                               height, cudaMemcpyHostToDevice));
+    }
+
+    // Base and scale are outputs of the statistics
+    nvcv::Tensor imgBase(paramNumImages, {1, 1}, paramFormat);
+    nvcv::Tensor imgScale(paramNumImages, {1, 1}, paramFormat);
+    nvcv::Tensor imgDst(numImages, {width, height}, fmt);
+
+    // Generate test result
+    cvcuda::Normalize normalizeOp;
+    EXPECT_NO_THROW(normalizeOp(stream, imgSrc, imgBase, imgScale, imgDst, globalScale, globalShift, epsilon,
+                                CVCUDA_NORMALIZE_COMPUTE_STATS));
+
+    // Get test data back
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *baseData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgBase.exportData());
+    const auto *scaleData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgScale.exportData());
+    const auto *dstData   = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, baseData);
+    ASSERT_NE(nullptr, scaleData);
+    ASSERT_NE(nullptr, dstData);
+
+    auto baseAccess  = nvcv::TensorDataAccessStridedImagePlanar::Create(*baseData);
+    auto scaleAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*scaleData);
+    auto dstAccess   = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(baseAccess);
+    ASSERT_TRUE(scaleAccess);
+    ASSERT_TRUE(dstAccess);
+
+    // Check statistics against the ones computed in double precision
+    std::vector<std::vector<float>> baseVec(paramNumImages), scaleVec(paramNumImages);
+    for (int p = 0; p < paramNumImages; ++p)
+    {
+        SCOPED_TRACE(p);
+
+        baseVec[p].resize(paramChannels);
+        scaleVec[p].resize(paramChannels);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(baseVec[p].data(), baseAccess->sampleData(p), paramChannels * sizeof(float),
+                                          cudaMemcpyDeviceToHost));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(scaleVec[p].data(), scaleAccess->sampleData(p),
+                                          paramChannels * sizeof(float), cudaMemcpyDeviceToHost));
+
+        int firstImage = perSample ? p : 0;
+        int lastImage  = perSample ? p + 1 : numImages;
+
+        for (int c = 0; c < paramChannels; ++c)
+        {
+            double sum = 0, sqsum = 0, count = 0;
+            for (int i = firstImage; i < lastImage; ++i)
+            {
+                for (size_t k = 0; k < srcVec[i].size(); ++k)
+                {
+                    if (perChannel && static_cast<int>(k % fmt.numChannels()) != c)
+                    {
+                        continue;
+                    }
+                    sum += srcVec[i][k];
+                    sqsum += static_cast<double>(srcVec[i][k]) * srcVec[i][k];
+                    count += 1;
+                }
+            }
+            double mean   = sum / count;
+            double stddev = std::sqrt(sqsum / count - mean * mean);
+
+            EXPECT_NEAR(mean, baseVec[p][c], 1e-3 * mean);
+            EXPECT_NEAR(stddev, scaleVec[p][c], 1e-3 * stddev);
+        }
+    }
+
+    // Check output against normalization with the computed statistics
+    int dstVecRowStride = width * fmt.numChannels();
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> testVec(height * dstVecRowStride);
+
+        // Copy output data to Host
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(testVec.data(), dstVecRowStride, dstAccess->sampleData(i), dstAccess->rowStride(),
+                               dstVecRowStride, // vec has no padding
+                               height, cudaMemcpyDeviceToHost));
+
+        std::vector<uint8_t> goldVec(height * dstVecRowStride);
+
+        int pi = perSample ? i : 0;
+
+        // Generate gold result
+        Normalize(goldVec, dstVecRowStride, srcVec[i], srcVecRowStride, {width, height}, fmt, baseVec[pi], 0, {1, 1},
+                  paramFormat, scaleVec[pi], 0, {1, 1}, paramFormat, globalScale, globalShift, epsilon,
+                  scaleIsStdDev);
+
+        EXPECT_EQ(goldVec, testVec);
+    }
+}
+
+TEST(OpNormalize, tensor_channel_order_matches_reordered_input)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int width = 67, height = 35, numImages = 2;
+
+    nvcv::ImageFormat fmt         = nvcv::FMT_RGB8;
+    nvcv::ImageFormat paramFormat = nvcv::FMT_RGBf32;
+    int               rowStride   = width * fmt.numChannels();
+
+    std::default_random_engine             rng;
+    std::uniform_int_distribution<uint8_t> udist(0, 255);
+
+    // BGR input, and the same input already converted to RGB
+    std::vector<uint8_t> bgrVec(numImages * height * rowStride);
+    std::generate(bgrVec.begin(), bgrVec.end(), [&]() { return udist(rng); });
+    std::vector<uint8_t> rgbVec(bgrVec.size());
+    for (size_t i = 0; i < bgrVec.size(); i += 3)
+    {
+        rgbVec[i + 0] = bgrVec[i + 2];
+        rgbVec[i + 1] = bgrVec[i + 1];
+        rgbVec[i + 2] = bgrVec[i + 0];
+    }
+
+    auto upload = [&](nvcv::Tensor &tensor, const void *src, int srcRowStride, int numRows)
+    {
+        const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+        ASSERT_NE(nullptr, data);
+        auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+        ASSERT_TRUE(access);
+        for (int i = 0; i < access->numSamples(); ++i)
+        {
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(access->sampleData(i), access->rowStride(),
+                                                static_cast<const uint8_t *>(src) + i * numRows * srcRowStride,
+                                                srcRowStride, srcRowStride, numRows, cudaMemcpyHostToDevice));
+        }
+    };
+
+    auto download = [&](nvcv::Tensor &tensor, std::vector<uint8_t> &dst)
+    {
+        const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+        ASSERT_NE(nullptr, data);
+        auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+        ASSERT_TRUE(access);
+        int dstRowStride = access->numCols() * access->colStride();
+        dst.resize(access->numSamples() * access->numRows() * dstRowStride);
+        for (int i = 0; i < access->numSamples(); ++i)
+        {
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(dst.data() + i * access->numRows() * dstRowStride, dstRowStride,
+                                                access->sampleData(i), access->rowStride(), dstRowStride,
+                                                access->numRows(), cudaMemcpyDeviceToHost));
+        }
+    };
+
+    nvcv::Tensor bgrSrc = test::CreateTensor(numImages, width, height, fmt);
+    nvcv::Tensor rgbSrc = test::CreateTensor(numImages, width, height, fmt);
+    upload(bgrSrc, bgrVec.data(), rowStride, height);
+    upload(rgbSrc, rgbVec.data(), rowStride, height);
+
+    // Parameters are given in output (RGB) order
+    std::vector<float> baseVec  = {100.f, 120.f, 140.f};
+    std::vector<float> scaleVec = {0.5f, 0.25f, 0.125f};
+
+    cvcuda::Normalize normalizeOp;
+
+    for (uint32_t flags : {0u, static_cast<uint32_t>(CVCUDA_NORMALIZE_COMPUTE_STATS)})
+    {
+        SCOPED_TRACE(flags);
+
+        nvcv::Tensor base[2]  = {nvcv::Tensor(1, {1, 1}, paramFormat), nvcv::Tensor(1, {1, 1}, paramFormat)};
+        nvcv::Tensor scale[2] = {nvcv::Tensor(1, {1, 1}, paramFormat), nvcv::Tensor(1, {1, 1}, paramFormat)};
+        nvcv::Tensor dst[2]   = {test::CreateTensor(numImages, width, height, fmt),
+                                 test::CreateTensor(numImages, width, height, fmt)};
+        for (int k = 0; k < 2; ++k)
+        {
+            upload(base[k], baseVec.data(), baseVec.size() * sizeof(float), 1);
+            upload(scale[k], scaleVec.data(), scaleVec.size() * sizeof(float), 1);
+        }
+
+        EXPECT_NO_THROW(normalizeOp(stream, bgrSrc, base[0], scale[0], dst[0], 64.f, 128.f, 0.f, flags,
+                                    NVCV_SWIZZLE_ZYXW));
+        EXPECT_NO_THROW(normalizeOp(stream, rgbSrc, base[1], scale[1], dst[1], 64.f, 128.f, 0.f, flags));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        std::vector<uint8_t> testVec, goldVec;
+        download(dst[0], testVec);
+        download(dst[1], goldVec);
+        EXPECT_EQ(goldVec, testVec);
+
+        // Statistics are computed in output order too
+        download(base[0], testVec);
+        download(base[1], goldVec);
+        EXPECT_EQ(goldVec, testVec);
+        download(scale[0], testVec);
+        download(scale[1], goldVec);
+        EXPECT_EQ(goldVec, testVec);
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpNormalize, fast_precision_matches_accurate_within_tolerance)
+{
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaSetPrecisionMode(NVCV_PRECISION_INHERIT));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaSetThreadPrecisionMode(static_cast<NVCVPrecisionMode>(2)));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaGetPrecisionMode(nullptr));
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int width = 97, height = 31, numImages = 3;
+
+    nvcv::ImageFormat fmt = nvcv::FMT_RGBf32;
+
+    nvcv::Tensor src    = test::CreateTensor(numImages, width, height, fmt);
+    nvcv::Tensor dst[2] = {test::CreateTensor(numImages, width, height, fmt),
+                           test::CreateTensor(numImages, width, height, fmt)};
+    nvcv::Tensor base(1, {1, 1}, fmt), scale(1, {1, 1}, fmt);
+
+    std::default_random_engine            rng;
+    std::uniform_real_distribution<float> udist(0.f, 1.f);
+
+    // fills every sample of the tensor with the same random values, offset by min
+    auto fill = [&](nvcv::Tensor &tensor, float min)
+    {
+        auto access = nvcv::TensorDataAccessStrided::Create(*tensor.exportData());
+        ASSERT_TRUE(access);
+        std::vector<float> vec(access->sampleStride() / sizeof(float));
+        std::generate(vec.begin(), vec.end(), [&]() { return min + udist(rng); });
+        ASSERT_NO_THROW(test::SetTensorFromVector<float>(tensor.exportData(), vec));
+    };
+
+    fill(src, 0.f);
+    fill(base, 0.f);
+    fill(scale, 0.1f);
+
+    cvcuda::Normalize normalizeOp;
+
+    const uint32_t flags = CVCUDA_NORMALIZE_SCALE_IS_STDDEV;
+
+    EXPECT_NO_THROW(normalizeOp(stream, src, base, scale, dst[0], 1.f, 0.f, 1e-3f, flags));
+
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetThreadPrecisionMode(NVCV_PRECISION_FAST));
+    NVCVPrecisionMode mode = NVCV_PRECISION_ACCURATE;
+    EXPECT_EQ(NVCV_SUCCESS, cvcudaGetPrecisionMode(&mode));
+    EXPECT_EQ(NVCV_PRECISION_FAST, mode);
+
+    EXPECT_NO_THROW(normalizeOp(stream, src, base, scale, dst[1], 1.f, 0.f, 1e-3f, flags));
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetThreadPrecisionMode(NVCV_PRECISION_INHERIT));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<float> goldVec, testVec;
+        ASSERT_NO_THROW(test::GetVectorFromTensor<float>(dst[0].exportData(), i, goldVec));
+        ASSERT_NO_THROW(test::GetVectorFromTensor<float>(dst[1].exportData(), i, testVec));
+        ASSERT_EQ(goldVec.size(), testVec.size());
+
+        // rsqrtf is within 2 ULPs, row padding is left alone by both runs
+        for (size_t k = 0; k < goldVec.size(); ++k)
+        {
+            EXPECT_NEAR(goldVec[k], testVec[k], 1e-5f * std::max(1.f, std::abs(goldVec[k]))) << "at " << k;
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpNormalize, tensor_half_output_from_u8)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int width = 37, height = 19, numImages = 2, channels = 3;
+
+    const float globalScale = 0.5f;
+    const float globalShift = 0.25f;
+
+    // There are no half-precision image formats, the output is created from its shape
+    nvcv::Tensor src = test::CreateTensor(numImages, width, height, nvcv::FMT_RGB8);
+    nvcv::Tensor dst({{numImages, height, width, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F16);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*src.exportData());
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dst.exportData());
+    ASSERT_TRUE(srcAccess);
+    ASSERT_TRUE(dstAccess);
+
+    std::default_random_engine rng;
+
+    std::vector<std::vector<uint8_t>> srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        std::uniform_int_distribution<int> udist(0, 255);
+
+        srcVec[i].resize(srcAccess->sampleStride());
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return udist(rng); });
+        ASSERT_NO_THROW(test::SetTensorFromVector<uint8_t>(src.exportData(), srcVec[i], i));
+    }
+
+    cvcuda::Normalize normalizeOp;
+
+    // Parameters broadcast over the image use the vectorized kernel, per-pixel ones the generic one
+    for (nvcv::Size2D paramSize : {nvcv::Size2D{1, 1}, nvcv::Size2D{width, height}})
+    {
+        SCOPED_TRACE(paramSize.w);
+
+        nvcv::Tensor base(1, paramSize, nvcv::FMT_RGBf32);
+        nvcv::Tensor scale(1, paramSize, nvcv::FMT_RGBf32);
+
+        auto paramAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*base.exportData());
+        ASSERT_TRUE(paramAccess);
+        const int paramRowStride = paramAccess->rowStride() / sizeof(float);
+
+        // Integer bases and power of two scales, so that the float results are exact and rounded once to half
+        std::vector<float> baseVec(paramAccess->sampleStride() / sizeof(float));
+        std::vector<float> scaleVec(baseVec.size());
+        for (int y = 0; y < paramSize.h; ++y)
+        {
+            for (int x = 0; x < paramSize.w * channels; ++x)
+            {
+                baseVec[y * paramRowStride + x]  = static_cast<float>((x + 7 * y) % 200);
+                scaleVec[y * paramRowStride + x] = std::ldexp(1.f, -(x % channels) - 1);
+            }
+        }
+        ASSERT_NO_THROW(test::SetTensorFromVector<float>(base.exportData(), baseVec));
+        ASSERT_NO_THROW(test::SetTensorFromVector<float>(scale.exportData(), scaleVec));
+
+        EXPECT_NO_THROW(normalizeOp(stream, src, base, scale, dst, globalScale, globalShift, 0.f));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        for (int i = 0; i < numImages; ++i)
+        {
+            SCOPED_TRACE(i);
+
+            std::vector<uint16_t> dstVec;
+            ASSERT_NO_THROW(test::GetVectorFromTensor<uint16_t>(dst.exportData(), i, dstVec));
+
+            for (int y = 0; y < height; ++y)
+            {
+                for (int x = 0; x < width * channels; ++x)
+                {
+                    const int p = (paramSize.h == 1 ? 0 : y) * paramRowStride + (paramSize.w == 1 ? x % channels : x);
+
+                    float gold = (srcVec[i][y * srcAccess->rowStride() + x] - baseVec[p]) * scaleVec[p] * globalScale
+                               + globalShift;
+                    uint16_t goldBits = static_cast<__half_raw>(__float2half_rn(gold)).x;
+
+                    ASSERT_EQ(goldBits, dstVec[y * dstAccess->rowStride() / sizeof(uint16_t) + x])
+                        << "at y " << y << ", x " << x;
+                }
+            }
+        }
+    }
+
+    // Half outputs are only supported for 8-bit unsigned and float inputs
+    nvcv::Tensor srcS16({{numImages, height, width, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S16);
+    nvcv::Tensor base(1, {1, 1}, nvcv::FMT_RGBf32), scale(1, {1, 1}, nvcv::FMT_RGBf32);
+    EXPECT_THROW(normalizeOp(stream, srcS16, base, scale, dst, globalScale, globalShift, 0.f), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
@@ -0,0 +1,387 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpOSD.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace test = nvcv::test;
+
+namespace {
+
+constexpr int kElementSize      = 12;
+constexpr int kPointsPerElement = 6;
+constexpr int kNumGlyphs        = 4;
+constexpr int kGlyphW           = 5;
+constexpr int kGlyphH           = 7;
+
+struct Scene
+{
+    std::vector<float>   elements; // numSamples x numElements x kElementSize
+    std::vector<float>   points;   // numSamples x numElements * kPointsPerElement x 2
+    std::vector<uint8_t> glyphs;   // kNumGlyphs x kGlyphH x kGlyphW
+    std::vector<int>     counts;
+    int                  numElements;
+};
+
+int GoldDivRound255(int x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+// Coverage of the pixel center (px, py), with the float operations of the operator, -1 when the element is skipped.
+int GoldCoverage(const Scene &scene, int sample, const float *e, float px, float py)
+{
+    const float *p         = e + 5;
+    const int    numPoints = scene.numElements * kPointsPerElement;
+
+    switch (static_cast<int>(e[0]))
+    {
+    case NVCV_OSD_RECT:
+    {
+        const float t     = p[4];
+        const bool  outer = px >= p[0] && px < p[2] && py >= p[1] && py < p[3];
+        const bool  inner = t > 0 && px >= p[0] + t && px < p[2] - t && py >= p[1] + t && py < p[3] - t;
+        return outer && !inner ? 255 : 0;
+    }
+    case NVCV_OSD_LINE:
+    {
+        const float vx = p[2] - p[0], vy = p[3] - p[1];
+        const float wx = px - p[0], wy = py - p[1];
+
+        const float len2 = vx * vx + vy * vy;
+        const float u    = len2 > 0 ? std::min(std::max((wx * vx + wy * vy) / len2, 0.f), 1.f) : 0.f;
+        const float dx   = wx - u * vx;
+        const float dy   = wy - u * vy;
+        const float r    = std::max(p[4], 1.f) / 2;
+        return dx * dx + dy * dy <= r * r ? 255 : 0;
+    }
+    case NVCV_OSD_POLYGON:
+    {
+        if (!(p[0] >= 0 && p[1] >= 3 && p[0] + p[1] <= numPoints))
+        {
+            return -1;
+        }
+        const int    first = static_cast<int>(p[0]), count = static_cast<int>(p[1]);
+        const float *pts   = &scene.points[(sample * numPoints + first) * 2];
+
+        bool inside = false;
+        for (int j = 0, k = count - 1; j < count; k = j++)
+        {
+            const float cx = pts[j * 2], cy = pts[j * 2 + 1];
+            const float qx = pts[k * 2], qy = pts[k * 2 + 1];
+            if ((cy > py) != (qy > py) && px < (qx - cx) * (py - cy) / (qy - cy) + cx)
+            {
+                inside = !inside;
+            }
+        }
+        return inside ? 255 : 0;
+    }
+    case NVCV_OSD_GLYPH:
+    {
+        if (!(p[3] >= 0 && p[3] < kNumGlyphs && p[2] > 0))
+        {
+            return -1;
+        }
+        const float u = std::floor((px - p[0]) / p[2]);
+        const float v = std::floor((py - p[1]) / p[2]);
+        if (u < 0 || v < 0 || u >= kGlyphW || v >= kGlyphH)
+        {
+            return 0;
+        }
+        return scene.glyphs[(static_cast<int>(p[3]) * kGlyphH + static_cast<int>(v)) * kGlyphW + static_cast<int>(u)];
+    }
+    }
+    return -1;
+}
+
+// Elements of all kinds with random colors, some partially outside of the image, not drawn or not counted.
+Scene CreateScene(int numSamples, int numElements, int width, int height, bool withCounts)
+{
+    std::default_random_engine            rng(numSamples * numElements);
+    std::uniform_real_distribution<float> xDist(-0.1f * width, 1.1f * width);
+    std::uniform_real_distribution<float> yDist(-0.1f * height, 1.1f * height);
+    std::uniform_real_distribution<float> sizeDist(1.f, 0.3f * std::max(width, height));
+    std::uniform_real_distribution<float> thicknessDist(-1.f, 4.f);
+    std::uniform_int_distribution<int>    colorDist(0, 255);
+    std::uniform_int_distribution<int>    typeDist(NVCV_OSD_RECT, NVCV_OSD_GLYPH);
+
+    Scene scene;
+    scene.numElements = numElements;
+    scene.elements.resize(numSamples * numElements * kElementSize, 0.f);
+    scene.points.resize(numSamples * numElements * kPointsPerElement * 2);
+    scene.glyphs.resize(kNumGlyphs * kGlyphH * kGlyphW);
+    scene.counts.resize(numSamples);
+
+    std::generate(scene.points.begin(), scene.points.end(), [&]() { return xDist(rng); });
+    std::generate(scene.glyphs.begin(), scene.glyphs.end(),
+                  [&]() { return colorDist(rng) < 128 ? 0 : colorDist(rng); });
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        scene.counts[n] = withCounts ? numElements - n % 3 : numElements;
+
+        for (int i = 0; i < numElements; ++i)
+        {
+            float *e = &scene.elements[(n * numElements + i) * kElementSize];
+            float *p = e + 5;
+
+            e[0] = static_cast<float>(typeDist(rng));
+            for (int c = 1; c <= 4; ++c)
+            {
+                e[c] = static_cast<float>(colorDist(rng));
+            }
+            if (i % 3 == 0)
+            {
+                e[4] = 255.f;
+            }
+            else if (i % 17 == 5)
+            {
+                e[4] = 0.f;
+            }
+
+            const float x = xDist(rng), y = yDist(rng);
+            switch (static_cast<int>(e[0]))
+            {
+            case NVCV_OSD_RECT:
+            case NVCV_OSD_LINE:
+                p[0] = x;
+                p[1] = y;
+                p[2] = x + sizeDist(rng);
+                p[3] = y + sizeDist(rng);
+                p[4] = thicknessDist(rng);
+                break;
+
+            case NVCV_OSD_POLYGON:
+            {
+                // points around (x, y), the last polygon of each sample has a range outside of the points
+                const int count = 3 + i % (kPointsPerElement - 2);
+                p[0]            = static_cast<float>(i == numElements - 1 ? numElements * kPointsPerElement - 2
+                                                                          : i * kPointsPerElement);
+                p[1]            = static_cast<float>(count);
+
+                float *pts = &scene.points[(n * numElements * kPointsPerElement + i * kPointsPerElement) * 2];
+                for (int j = 0; j < kPointsPerElement * 2; j += 2)
+                {
+                    pts[j]     = x + sizeDist(rng) - sizeDist(rng);
+                    pts[j + 1] = y + sizeDist(rng) - sizeDist(rng);
+                }
+                break;
+            }
+
+            case NVCV_OSD_GLYPH:
+                p[0] = x;
+                p[1] = y;
+                p[2] = 0.5f + (i % 4) * 0.75f;
+                p[3] = static_cast<float>(i % (kNumGlyphs + 1));
+                break;
+            }
+        }
+    }
+    return scene;
+}
+
+void CopyRows(void *dst, int dstStride, const void *src, int srcStride, int rowBytes, int rows, cudaMemcpyKind kind)
+{
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(dst, dstStride, src, srcStride, rowBytes, rows, kind));
+}
+
+const nvcv::ITensorDataStridedCuda &StridedData(const nvcv::Tensor &tensor)
+{
+    return dynamic_cast<const nvcv::ITensorDataStridedCuda &>(*tensor.exportData());
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpOSD, test::ValueList<int, int, int, int, int, bool>
+{
+    // numSamples, width, height, channels, numElements, counts
+    {           2,    97,     61,        3,          40,   true},
+    {           1,    64,     48,        4,         300,  false},
+    {           3,    33,     20,        1,          10,   true},
+    {           1,   300,    200,        3,         600,   true}
+});
+
+// clang-format on
+
+TEST_P(OpOSD, correct_output)
+{
+    const int  numSamples  = GetParamValue<0>();
+    const int  width       = GetParamValue<1>();
+    const int  height      = GetParamValue<2>();
+    const int  channels    = GetParamValue<3>();
+    const int  numElements = GetParamValue<4>();
+    const bool withCounts  = GetParamValue<5>();
+    const int  numPoints   = numElements * kPointsPerElement;
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor images({{numSamples, height, width, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor elements({{numSamples, 1, numElements, kElementSize}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor counts({{numSamples, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor points({{numSamples, 1, numPoints, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor glyphs({{kNumGlyphs, kGlyphH, kGlyphW, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    auto access      = nvcv::TensorDataAccessStridedImagePlanar::Create(StridedData(images));
+    auto glyphAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(StridedData(glyphs));
+    ASSERT_TRUE(access && glyphAccess);
+    ASSERT_EQ(access->sampleStride(), access->numRows() * access->rowStride());
+    ASSERT_EQ(glyphAccess->sampleStride(), glyphAccess->numRows() * glyphAccess->rowStride());
+
+    std::default_random_engine         rng(width * height);
+    std::uniform_int_distribution<int> valueDist(0, 255);
+
+    const int            rowBytes = width * channels;
+    std::vector<uint8_t> src(numSamples * height * rowBytes);
+    std::generate(src.begin(), src.end(), [&]() { return static_cast<uint8_t>(valueDist(rng)); });
+
+    Scene scene = CreateScene(numSamples, numElements, width, height, withCounts);
+
+    CopyRows(StridedData(images).basePtr(), access->rowStride(), src.data(), rowBytes, rowBytes, numSamples * height,
+             cudaMemcpyHostToDevice);
+    CopyRows(StridedData(elements).basePtr(), StridedData(elements).stride(0), scene.elements.data(),
+             numElements * kElementSize * sizeof(float), numElements * kElementSize * sizeof(float), numSamples,
+             cudaMemcpyHostToDevice);
+    CopyRows(StridedData(counts).basePtr(), StridedData(counts).stride(0), scene.counts.data(), sizeof(int),
+             sizeof(int), numSamples, cudaMemcpyHostToDevice);
+    CopyRows(StridedData(points).basePtr(), StridedData(points).stride(0), scene.points.data(),
+             numPoints * 2 * sizeof(float), numPoints * 2 * sizeof(float), numSamples, cudaMemcpyHostToDevice);
+    CopyRows(StridedData(glyphs).basePtr(), glyphAccess->rowStride(), scene.glyphs.data(), kGlyphW, kGlyphW,
+             kNumGlyphs * kGlyphH, cudaMemcpyHostToDevice);
+
+    cvcuda::OSD op(numSamples, numElements);
+    EXPECT_NO_THROW(op(stream, images, elements, withCounts ? &counts : nullptr, &points, &glyphs));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<uint8_t> test(src.size());
+    CopyRows(test.data(), rowBytes, StridedData(images).basePtr(), access->rowStride(), rowBytes, numSamples * height,
+             cudaMemcpyDeviceToHost);
+
+    // Pixels whose centers are on the edge of an element, where float rounding may change the coverage, are skipped
+    constexpr float kEps = 1e-3f;
+
+    int numChecked = 0;
+    for (int n = 0; n < numSamples; ++n)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                const float px = x + .5f, py = y + .5f;
+                const int   offset = (n * height + y) * rowBytes + x * channels;
+
+                int  gold[4];
+                bool ambiguous = false;
+                for (int c = 0; c < channels; ++c)
+                {
+                    gold[c] = src[offset + c];
+                }
+
+                for (int i = 0; i < scene.counts[n] && !ambiguous; ++i)
+                {
+                    const float *e = &scene.elements[(n * numElements + i) * kElementSize];
+
+                    const int cov = GoldCoverage(scene, n, e, px, py);
+                    for (float d : {-kEps, kEps})
+                    {
+                        ambiguous = ambiguous || GoldCoverage(scene, n, e, px + d, py + d) != cov
+                                 || GoldCoverage(scene, n, e, px + d, py - d) != cov;
+                    }
+                    if (cov <= 0)
+                    {
+                        continue;
+                    }
+
+                    const int alpha = GoldDivRound255(static_cast<int>(e[4]) * cov);
+                    for (int c = 0; c < std::min(channels, 3); ++c)
+                    {
+                        gold[c] = GoldDivRound255(gold[c] * (255 - alpha) + static_cast<int>(e[1 + c]) * alpha);
+                    }
+                }
+
+                if (ambiguous)
+                {
+                    continue;
+                }
+                ++numChecked;
+
+                for (int c = 0; c < channels; ++c)
+                {
+                    ASSERT_EQ(test[offset + c], gold[c])
+                        << "sample " << n << " pixel (" << x << ", " << y << ") channel " << c;
+                }
+            }
+        }
+    }
+
+    EXPECT_GT(numChecked, numSamples * width * height * 9 / 10);
+}
+
+TEST(OpOSD, invalid_arguments)
+{
+    nvcv::Tensor images({{2, 16, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor imagesF32({{2, 16, 24, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor imagesC2({{2, 16, 24, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor elements({{2, 1, 5, kElementSize}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor elementsC11({{2, 1, 5, 11}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor elementsS32({{2, 1, 5, kElementSize}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor elements3N({{3, 1, 5, kElementSize}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor elementsM9({{2, 1, 9, kElementSize}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor counts({{2, 1, 1, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor countsW2({{2, 1, 2, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor points({{2, 1, 6, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor pointsC3({{2, 1, 6, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor glyphs({{4, 7, 5, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor glyphsC3({{4, 7, 5, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    EXPECT_THROW(cvcuda::OSD(-1, 8), nvcv::Exception);
+    EXPECT_THROW(cvcuda::OSD(2, -1), nvcv::Exception);
+
+    cvcuda::OSD op(2, 8);
+
+    // no element is counted, so valid calls leave the images untouched
+    const nvcv::ITensorDataStridedCuda &countData = StridedData(counts);
+    std::vector<int>                    zeros(2, 0);
+    CopyRows(countData.basePtr(), countData.stride(0), zeros.data(), sizeof(int), sizeof(int), 2,
+             cudaMemcpyHostToDevice);
+    EXPECT_NO_THROW(op(nullptr, images, elements, &counts));
+    EXPECT_NO_THROW(op(nullptr, images, elements, &counts, &points, &glyphs));
+    EXPECT_THROW(op(nullptr, imagesF32, elements, &counts), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, imagesC2, elements, &counts), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, elementsC11, &counts), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, elementsS32, &counts), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, elements3N, &counts), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, elementsM9, &counts), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, elements, &countsW2), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, elements, &counts, &pointsC3), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, images, elements, &counts, &points, &glyphsC3), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -0,0 +1,188 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpPSNR.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace test = nvcv::test;
+
+namespace {
+
+// Scores of each channel of the images, then of all channels together when perChannel is false.
+std::vector<double> PSNR(const std::vector<float> &img, const std::vector<float> &ref, int channels, double maxValue,
+                         bool perChannel)
+{
+    std::vector<double> sse(channels, 0);
+    for (size_t i = 0; i < img.size(); ++i)
+    {
+        const double d = img[i] - ref[i];
+        sse[i % channels] += d * d;
+    }
+
+    double count = img.size() / channels;
+    if (!perChannel)
+    {
+        for (int c = 1; c < channels; ++c)
+        {
+            sse[0] += sse[c];
+        }
+        sse.resize(1);
+        count *= channels;
+    }
+
+    std::vector<double> res;
+    for (double s : sse)
+    {
+        res.push_back(10 * std::log10(maxValue * maxValue * count / s));
+    }
+    return res;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpPSNR, test::ValueList<nvcv::ImageFormat, int, int, int, bool, float>
+{
+    //       format, numSamples, width, height, perChannel, maxValue
+    { nvcv::FMT_U8,           1,    64,     48,      false,        0 },
+    { nvcv::FMT_RGB8,         3,   123,     77,       true,        0 },
+    { nvcv::FMT_RGB8,         2,   640,    480,      false,      255 },
+    { nvcv::FMT_RGBA8,        2,    31,      1,       true,      200 },
+    { nvcv::FMT_U16,          2,    50,     40,      false,    65535 },
+    { nvcv::FMT_S16,          1,    50,     40,       true,        0 },
+    { nvcv::FMT_RGBf32,       2,    50,     40,      false,      255 },
+});
+
+// clang-format on
+
+TEST_P(OpPSNR, correct_output)
+{
+    const nvcv::ImageFormat fmt        = GetParamValue<0>();
+    const int               numSamples = GetParamValue<1>();
+    const nvcv::Size2D      size{GetParamValue<2>(), GetParamValue<3>()};
+    const bool              perChannel = GetParamValue<4>();
+    const float             maxValue   = GetParamValue<5>();
+
+    const int channels = fmt.numChannels();
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    // values are integers in [0, 255] whatever the type, with noise of increasing strength in each sample
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> udist(0, 255);
+
+    std::vector<std::vector<float>> hImg(numSamples), hRef(numSamples);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        std::uniform_int_distribution<int> noise(-4 * (i + 1), 4 * (i + 1));
+        hRef[i].resize(size.w * size.h * channels);
+        hImg[i].resize(hRef[i].size());
+        for (size_t k = 0; k < hRef[i].size(); ++k)
+        {
+            hRef[i][k] = udist(rng);
+            hImg[i][k] = std::clamp(static_cast<int>(hRef[i][k]) + noise(rng), 0, 255);
+        }
+    }
+
+    auto img = test::CreateTensorFromFloats(hImg, size, fmt);
+    auto ref = test::CreateTensorFromFloats(hRef, size, fmt);
+
+    nvcv::Tensor scores({{numSamples, 1, 1, perChannel ? channels : 1}, "NHWC"}, nvcv::TYPE_F32);
+
+    cvcuda::PSNR op;
+    EXPECT_NO_THROW(op(stream, img, ref, scores, maxValue));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    // the default maximum value is the range of the data type
+    const nvcv::DataType type  = fmt.planeDataType(0).channelType(0);
+    const double         range = type == nvcv::TYPE_U8    ? 255
+                               : type == nvcv::TYPE_U16 ? 65535
+                               : type == nvcv::TYPE_S16 ? 32767
+                                                        : 1;
+
+    std::vector<float> result = test::GetFloatsFromTensor(scores);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<double> gold = PSNR(hImg[i], hRef[i], channels, maxValue > 0 ? maxValue : range, perChannel);
+        for (size_t c = 0; c < gold.size(); ++c)
+        {
+            EXPECT_NEAR(gold[c], result[i * gold.size() + c], 1e-3) << "at channel " << c;
+        }
+    }
+}
+
+TEST(OpPSNR, equal_images_have_infinite_scores)
+{
+    std::vector<std::vector<float>> hImg(2, std::vector<float>(32 * 16 * 3, 7));
+    hImg[1][100] = 8;
+
+    auto         img = test::CreateTensorFromFloats(hImg, {32, 16}, nvcv::FMT_RGB8);
+    auto         ref = test::CreateTensorFromFloats({hImg[0], hImg[0]}, {32, 16}, nvcv::FMT_RGB8);
+    nvcv::Tensor scores({{2, 1, 1, 1}, "NHWC"}, nvcv::TYPE_F32);
+
+    cvcuda::PSNR op;
+    EXPECT_NO_THROW(op(nullptr, img, ref, scores));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+
+    std::vector<float> result = test::GetFloatsFromTensor(scores);
+    EXPECT_EQ(std::numeric_limits<float>::infinity(), result[0]);
+    EXPECT_NEAR(10 * std::log10(255.0 * 255 * 32 * 16 * 3), result[1], 1e-3);
+}
+
+TEST(OpPSNR, invalid_arguments)
+{
+    nvcv::Tensor img    = test::CreateTensor(2, 32, 24, nvcv::FMT_RGB8);
+    nvcv::Tensor ref    = test::CreateTensor(2, 32, 24, nvcv::FMT_RGB8);
+    nvcv::Tensor refBig = test::CreateTensor(2, 32, 32, nvcv::FMT_RGB8);
+    nvcv::Tensor refF32 = test::CreateTensor(2, 32, 24, nvcv::FMT_RGBf32);
+    nvcv::Tensor imgS8  = test::CreateTensor(2, 32, 24, nvcv::FMT_S8);
+
+    nvcv::Tensor scores({{2, 1, 1, 3}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor scores2({{2, 1, 1, 2}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor scoresS32({{2, 1, 1, 1}, "NHWC"}, nvcv::TYPE_S32);
+    nvcv::Tensor scores1({{1, 1, 1, 1}, "NHWC"}, nvcv::TYPE_F32);
+
+    cvcuda::PSNR op;
+    EXPECT_NO_THROW(op(nullptr, img, ref, scores));
+    // both inputs have the same shape and type
+    EXPECT_THROW(op(nullptr, img, refBig, scores), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, img, refF32, scores), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, imgS8, imgS8, scores1), nvcv::Exception);
+    // one float score per sample, and per channel or for all channels
+    EXPECT_THROW(op(nullptr, img, ref, scores2), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, img, ref, scoresS32), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, img, ref, scores1), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, img, ref, scores, -1.f), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
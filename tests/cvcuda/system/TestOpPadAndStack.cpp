@@ -27,6 +27,7 @@
 #include <nvcv/alloc/CustomAllocator.hpp>
 #include <nvcv/alloc/CustomResourceAllocator.hpp>
 
+#include <cstring>
 #include <random>
 
 namespace test = nvcv::test;
@@ -235,3 +236,107 @@ TEST_P(OpPadAndStack, correct_output)
 
     EXPECT_EQ(goldVec, testVec);
 }
+
+TEST(OpPadAndStack, normalize_matches_padded_output)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int numBatches = 2, dstWidth = 40, dstHeight = 30, channels = 3;
+
+    const std::vector<int> topVec{3, 0}, leftVec{0, 5};
+
+    nvcv::Tensor inTop(1, {numBatches, 1}, nvcv::FMT_S32);
+    nvcv::Tensor inLeft(1, {numBatches, 1}, nvcv::FMT_S32);
+
+    const auto *inTopData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inTop.exportData());
+    const auto *inLeftData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inLeft.exportData());
+    ASSERT_NE(nullptr, inTopData);
+    ASSERT_NE(nullptr, inLeftData);
+
+    ASSERT_EQ(cudaSuccess,
+              cudaMemcpy(inTopData->basePtr(), topVec.data(), numBatches * sizeof(int), cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess,
+              cudaMemcpy(inLeftData->basePtr(), leftVec.data(), numBatches * sizeof(int), cudaMemcpyHostToDevice));
+
+    std::default_random_engine             randEng{0};
+    std::uniform_int_distribution<uint8_t> srcRand{0u, 255u};
+
+    std::vector<std::unique_ptr<nvcv::IImage>> srcImgVec;
+    for (nvcv::Size2D size : {nvcv::Size2D{33, 21}, nvcv::Size2D{27, 30}})
+    {
+        srcImgVec.emplace_back(std::make_unique<nvcv::Image>(size, nvcv::FMT_RGB8));
+
+        auto *imgSrcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(srcImgVec.back()->exportData());
+        ASSERT_NE(nullptr, imgSrcData);
+
+        std::vector<uint8_t> srcVec(imgSrcData->plane(0).rowStride * size.h);
+        std::generate(srcVec.begin(), srcVec.end(), [&]() { return srcRand(randEng); });
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(imgSrcData->plane(0).basePtr, srcVec.data(), srcVec.size(),
+                                          cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape imgBatchSrc(numBatches);
+    imgBatchSrc.pushBack(srcImgVec.begin(), srcImgVec.end());
+
+    const std::vector<float> baseVec{120.f, 110.f, 100.f};
+    const float              scaleValue = 0.5f, globalScale = 1.f / 64, globalShift = -0.25f, borderValue = 30.f;
+
+    nvcv::Tensor imgBase(1, {1, 1}, nvcv::FMT_RGBf32);
+    nvcv::Tensor imgScale(1, {1, 1}, nvcv::FMT_F32);
+
+    const auto *baseData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgBase.exportData());
+    const auto *scaleData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgScale.exportData());
+    ASSERT_NE(nullptr, baseData);
+    ASSERT_NE(nullptr, scaleData);
+
+    ASSERT_EQ(cudaSuccess,
+              cudaMemcpy(baseData->basePtr(), baseVec.data(), channels * sizeof(float), cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(scaleData->basePtr(), &scaleValue, sizeof(float), cudaMemcpyHostToDevice));
+
+    nvcv::Tensor imgPad(numBatches, {dstWidth, dstHeight}, nvcv::FMT_RGB8);
+    nvcv::Tensor imgDst({{numBatches, channels, dstHeight, dstWidth}, nvcv::TENSOR_NCHW}, nvcv::TYPE_F32);
+
+    cvcuda::PadAndStack padAndStackOp;
+
+    EXPECT_NO_THROW(padAndStackOp(stream, imgBatchSrc, imgPad, inTop, inLeft, NVCV_BORDER_CONSTANT, borderValue));
+    EXPECT_NO_THROW(padAndStackOp(stream, imgBatchSrc, imgDst, inTop, inLeft, NVCV_BORDER_CONSTANT, borderValue,
+                                  imgBase, imgScale, globalScale, globalShift, 0.f));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *padData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgPad.exportData());
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, padData);
+    ASSERT_NE(nullptr, dstData);
+
+    std::vector<uint8_t> padVec(padData->stride(0) * numBatches);
+    std::vector<uint8_t> dstVec(dstData->stride(0) * numBatches);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(padVec.data(), padData->basePtr(), padVec.size(), cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(dstVec.data(), dstData->basePtr(), dstVec.size(), cudaMemcpyDeviceToHost));
+
+    for (int b = 0; b < numBatches; ++b)
+    {
+        for (int y = 0; y < dstHeight; ++y)
+        {
+            for (int x = 0; x < dstWidth; ++x)
+            {
+                for (int c = 0; c < channels; ++c)
+                {
+                    uint8_t padded
+                        = padVec[b * padData->stride(0) + y * padData->stride(1) + x * padData->stride(2) + c];
+                    float gold = (padded - baseVec[c]) * scaleValue * globalScale + globalShift;
+
+                    float test;
+                    std::memcpy(&test,
+                                &dstVec[b * dstData->stride(0) + c * dstData->stride(1) + y * dstData->stride(2)
+                                        + x * dstData->stride(3)],
+                                sizeof(float));
+
+                    ASSERT_NEAR(gold, test, 1e-5f) << "at sample " << b << " (" << x << ", " << y << ", " << c << ")";
+                }
+            }
+        }
+    }
+}
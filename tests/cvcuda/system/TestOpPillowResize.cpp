@@ -819,6 +819,9 @@ NVCV_TEST_SUITE_P(OpPillowResize, test::ValueList<int, int, int, int, NVCVInterp
     {        21,        21,       42,        42,  NVCV_INTERP_LINEAR,           5, nvcv::FMT_RGB8},
     {        42,        42,       21,        21,  NVCV_INTERP_LINEAR,           6, nvcv::FMT_RGBf32},
     {        21,        21,       42,        42,  NVCV_INTERP_LINEAR,           7, nvcv::FMT_RGBf32},
+    // large vertical downscale, intermediate rows don't fit in shared memory
+    {        20,      2000,       10,        40,  NVCV_INTERP_LINEAR,           2, nvcv::FMT_RGB8},
+    {        20,       400,       20,        40,  NVCV_INTERP_LINEAR,           2, nvcv::FMT_RGBf32},
 });
 
 // clang-format on
@@ -1056,3 +1059,146 @@ TEST_P(OpPillowResize, varshape_correct_output)
     else if (nvcv::FMT_RGBf32 == fmt || nvcv::FMT_RGBAf32 == fmt)
         StartVarShapeTest<float>(srcWidth, srcHeight, dstWidth, dstHeight, interpolation, numberOfImages, fmt);
 }
+
+TEST(OpPillowResize, tensor_repeated_sizes_same_output)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::ImageFormat fmt = nvcv::FMT_RGB8;
+    nvcv::Size2D      srcSize{42, 40};
+
+    nvcv::Tensor imgSrc(2, srcSize, fmt);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+
+    std::vector<uint8_t>                   srcVec(srcData->stride(0) * 2);
+    std::default_random_engine             randEng{0};
+    std::uniform_int_distribution<uint8_t> srcRand{0u, 255u};
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return srcRand(randEng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), srcVec.size(), cudaMemcpyHostToDevice));
+
+    auto run = [&](cvcuda::PillowResize &op, nvcv::Size2D dstSize)
+    {
+        nvcv::Tensor imgDst(2, dstSize, fmt);
+        EXPECT_NO_THROW(op(stream, imgSrc, imgDst, NVCV_INTERP_LINEAR));
+
+        const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+
+        std::vector<uint8_t> dstVec(dstData->stride(0) * 2);
+        EXPECT_EQ(cudaSuccess, cudaMemcpyAsync(dstVec.data(), dstData->basePtr(), dstVec.size(),
+                                               cudaMemcpyDeviceToHost, stream));
+        EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        return dstVec;
+    };
+
+    // Sizes alternate, so the second round reuses the coefficients computed in the first one.
+    std::vector<nvcv::Size2D> dstSizes = {{21, 20}, {64, 30}, {42, 80}};
+
+    cvcuda::PillowResize cachedOp(nvcv::Size2D{64, 80}, 2, fmt);
+
+    std::vector<std::vector<uint8_t>> first;
+    for (nvcv::Size2D dstSize : dstSizes)
+    {
+        first.push_back(run(cachedOp, dstSize));
+    }
+
+    for (size_t i = 0; i < dstSizes.size(); ++i)
+    {
+        SCOPED_TRACE(i);
+
+        cvcuda::PillowResize freshOp(nvcv::Size2D{64, 80}, 2, fmt);
+
+        EXPECT_EQ(first[i], run(cachedOp, dstSizes[i]));
+        EXPECT_EQ(first[i], run(freshOp, dstSizes[i]));
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpPillowResize, varshape_repeated_sizes_correct_output)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::ImageFormat fmt = nvcv::FMT_RGB8;
+
+    // Samples share their horizontal coefficients, vertical ones, both or none.
+    std::vector<std::pair<nvcv::Size2D, nvcv::Size2D>> sizes = {
+        {{42, 40}, {21, 20}},
+        {{42, 40}, {21, 20}},
+        {{42, 30}, {21, 60}},
+        {{50, 40}, {25, 20}},
+        {{42, 40}, {21, 20}},
+    };
+    int numberOfImages = sizes.size();
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst;
+    for (auto &[srcSize, dstSize] : sizes)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(srcSize, fmt));
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(dstSize, fmt));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numberOfImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    nvcv::ImageBatchVarShape batchDst(numberOfImages);
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+
+    std::vector<std::vector<uint8_t>> srcVec(numberOfImages);
+    std::default_random_engine        randEng{0};
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(nullptr, srcData);
+
+        int srcRowStride = sizes[i].first.w * fmt.planePixelStrideBytes(0);
+
+        std::uniform_int_distribution<uint8_t> srcRand{0u, 255u};
+        srcVec[i].resize(sizes[i].first.h * srcRowStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return srcRand(randEng); });
+
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec[i].data(), srcRowStride,
+                               srcRowStride, sizes[i].first.h, cudaMemcpyHostToDevice));
+    }
+
+    cvcuda::PillowResize pillowResizeOp(nvcv::Size2D{50, 60}, numberOfImages, fmt);
+    EXPECT_NO_THROW(pillowResizeOp(stream, batchSrc, batchDst, NVCV_INTERP_LINEAR));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        auto [srcSize, dstSize] = sizes[i];
+
+        const auto *dstData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[i]->exportData());
+        ASSERT_NE(nullptr, dstData);
+
+        int dstRowStride = dstSize.w * fmt.planePixelStrideBytes(0);
+
+        std::vector<uint8_t> testVec(dstSize.h * dstRowStride);
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(testVec.data(), dstRowStride, dstData->plane(0).basePtr, dstData->plane(0).rowStride,
+                               dstRowStride, dstSize.h, cudaMemcpyDeviceToHost));
+
+        TestMat<uint8_t> test_in(srcSize.h, srcSize.w, fmt.planePixelStrideBytes(0), nvcv::DataKind::UNSIGNED,
+                                 srcVec[i]);
+        TestMat<uint8_t> test_out = PillowResizeCPU::resize(
+            test_in, dstSize, PillowResizeCPU::getInterpolationMethods(NVCV_INTERP_LINEAR));
+
+        std::vector<int> mae(testVec.size());
+        for (size_t j = 0; j < mae.size(); ++j)
+        {
+            mae[j] = abs(static_cast<int>((test_out.data)[j]) - static_cast<int>(testVec[j]));
+        }
+
+        EXPECT_THAT(mae, t::Each(t::Le(2)));
+    }
+}
@@ -0,0 +1,349 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/OpRandomParams.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/cuda/Philox.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace t = ::testing;
+
+namespace {
+
+constexpr uint64_t kSeed = 0x5EED0123456789ABull;
+
+// Copies the rows of a [N] or [N, K] tensor, K values each, to the host.
+template<typename T>
+std::vector<T> Download(const nvcv::Tensor &tensor, int numValues = 1)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    EXPECT_NE(data, nullptr);
+
+    const int64_t  rows = data->shape(0);
+    std::vector<T> host(rows * numValues);
+    EXPECT_EQ(cudaSuccess, cudaMemcpy2D(host.data(), numValues * sizeof(T), data->basePtr(), data->stride(0),
+                                        numValues * sizeof(T), rows, cudaMemcpyDeviceToHost));
+    return host;
+}
+
+// Sample i of draw d is drawn from this stream by the operator.
+nvcv::cuda::Philox SampleStream(uint64_t seed, int sample, uint32_t draw)
+{
+    return nvcv::cuda::Philox(seed, sample, static_cast<uint64_t>(draw) << 32);
+}
+
+std::vector<int> GoldFlipCodes(int numSamples, float probHoriz, float probVert, uint64_t seed, uint32_t draw)
+{
+    std::vector<int> codes(numSamples);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        nvcv::cuda::Philox rng = SampleStream(seed, i, draw);
+
+        const bool horiz = rng.uniform() < probHoriz;
+        const bool vert  = rng.uniform() < probVert;
+
+        codes[i] = horiz && vert ? -1 : horiz ? 1 : vert ? 0 : 2;
+    }
+    return codes;
+}
+
+// Images of random sizes, kept alive while the batch refers to them.
+std::vector<std::unique_ptr<nvcv::Image>> CreateImages(int numImages, std::vector<nvcv::Size2D> &sizes)
+{
+    std::default_random_engine         randEng(7);
+    std::uniform_int_distribution<int> randSize(1, 300);
+
+    std::vector<std::unique_ptr<nvcv::Image>> images;
+    for (int i = 0; i < numImages; ++i)
+    {
+        sizes.push_back({randSize(randEng), randSize(randEng)});
+        images.emplace_back(std::make_unique<nvcv::Image>(sizes.back(), nvcv::FMT_RGB8));
+    }
+    return images;
+}
+
+} // namespace
+
+TEST(OpRandomParams, flip_codes_match_gold_and_change_every_draw)
+{
+    const int numSamples = 1000;
+
+    nvcv::Tensor flipCode(nvcv::TensorShape({numSamples}, "N"), nvcv::TYPE_S32);
+
+    cvcuda::RandomParams op(kSeed);
+
+    op.flipCode(nullptr, flipCode, 0.3f, 0.6f);
+    std::vector<int> first = Download<int>(flipCode);
+
+    op.flipCode(nullptr, flipCode, 0.3f, 0.6f);
+    std::vector<int> second = Download<int>(flipCode);
+
+    EXPECT_EQ(first, GoldFlipCodes(numSamples, 0.3f, 0.6f, kSeed, 0));
+    EXPECT_EQ(second, GoldFlipCodes(numSamples, 0.3f, 0.6f, kSeed, 1));
+    EXPECT_NE(first, second);
+
+    // both flips are independent, so about 18% of the samples are flipped both ways
+    int numBoth = std::count(first.begin(), first.end(), -1);
+    EXPECT_GT(numBoth, 130);
+    EXPECT_LT(numBoth, 230);
+}
+
+TEST(OpRandomParams, set_seed_restarts_the_draws)
+{
+    nvcv::Tensor flipCode(nvcv::TensorShape({64}, "N"), nvcv::TYPE_S32);
+
+    cvcuda::RandomParams op(kSeed);
+
+    op.flipCode(nullptr, flipCode, 0.5f, 0.5f);
+    std::vector<int> first = Download<int>(flipCode);
+
+    op.flipCode(nullptr, flipCode, 0.5f, 0.5f);
+    op.setSeed(kSeed);
+    op.flipCode(nullptr, flipCode, 0.5f, 0.5f);
+    EXPECT_EQ(first, Download<int>(flipCode));
+
+    op.setSeed(kSeed + 1);
+    op.flipCode(nullptr, flipCode, 0.5f, 0.5f);
+    EXPECT_NE(first, Download<int>(flipCode));
+}
+
+TEST(OpRandomParams, uniform_values_match_gold)
+{
+    const int numSamples = 100, numValues = 3;
+
+    nvcv::Tensor gammas(nvcv::TensorShape({numSamples, numValues}, nvcv::TENSOR_NW), nvcv::TYPE_F32);
+    nvcv::Tensor values(nvcv::TensorShape({numSamples}, "N"), nvcv::TYPE_F64);
+
+    cvcuda::RandomParams op(kSeed);
+
+    op.uniform(nullptr, gammas, 0.5, 2.0);
+    op.uniform(nullptr, values, -3.0, 5.0);
+
+    std::vector<float>  gammasHost = Download<float>(gammas, numValues);
+    std::vector<double> valuesHost = Download<double>(values);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        nvcv::cuda::Philox rngGamma = SampleStream(kSeed, i, 0);
+        for (int k = 0; k < numValues; ++k)
+        {
+            const float gamma = gammasHost[i * numValues + k];
+            EXPECT_NEAR(gamma, 0.5 + 1.5 * rngGamma.uniform(), 1e-6) << "sample " << i << ", value " << k;
+            EXPECT_GE(gamma, 0.5f);
+            EXPECT_LE(gamma, 2.f);
+        }
+
+        nvcv::cuda::Philox rngValue = SampleStream(kSeed, i, 1);
+        EXPECT_NEAR(valuesHost[i], -3.0 + 8.0 * rngValue.uniformDouble(), 1e-12) << "sample " << i;
+    }
+}
+
+TEST(OpRandomParams, rotations_keep_the_image_centers)
+{
+    const int numImages = 50;
+
+    std::vector<nvcv::Size2D> sizes;
+    auto                      images = CreateImages(numImages, sizes);
+
+    nvcv::ImageBatchVarShape batch(numImages);
+    batch.pushBack(images.begin(), images.end());
+
+    nvcv::Tensor angleDeg(nvcv::TensorShape({numImages}, "N"), nvcv::TYPE_F64);
+    nvcv::Tensor shift(nvcv::TensorShape({numImages, 2}, nvcv::TENSOR_NW), nvcv::TYPE_F64);
+
+    cvcuda::RandomParams op(kSeed);
+    op.rotate(nullptr, batch, angleDeg, shift, -30.0, 45.0);
+
+    std::vector<double> angles = Download<double>(angleDeg);
+    std::vector<double> shifts = Download<double>(shift, 2);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        nvcv::cuda::Philox rng = SampleStream(kSeed, i, 0);
+        EXPECT_NEAR(angles[i], -30.0 + 75.0 * rng.uniformDouble(), 1e-10);
+
+        // the center is mapped onto itself by [cos sin; -sin cos] x + shift
+        const double cx = (sizes[i].w - 1) / 2.0, cy = (sizes[i].h - 1) / 2.0;
+        const double c = std::cos(angles[i] * M_PI / 180), s = std::sin(angles[i] * M_PI / 180);
+        EXPECT_NEAR(c * cx + s * cy + shifts[2 * i], cx, 1e-9) << "image " << i;
+        EXPECT_NEAR(-s * cx + c * cy + shifts[2 * i + 1], cy, 1e-9) << "image " << i;
+    }
+}
+
+TEST(OpRandomParams, erasing_areas_are_inside_the_images)
+{
+    const int   numImages   = 200;
+    const float probability = 0.4f;
+
+    std::vector<nvcv::Size2D> sizes;
+    auto                      images = CreateImages(numImages, sizes);
+
+    nvcv::ImageBatchVarShape batch(numImages);
+    batch.pushBack(images.begin(), images.end());
+
+    nvcv::Tensor anchor(nvcv::TensorShape({numImages}, "N"), nvcv::TYPE_2S32);
+    nvcv::Tensor erasing(nvcv::TensorShape({numImages}, "N"), nvcv::TYPE_3S32);
+    nvcv::Tensor imgIdx(nvcv::TensorShape({numImages}, "N"), nvcv::TYPE_S32);
+
+    cvcuda::RandomParams op(kSeed);
+    op.erase(nullptr, batch, anchor, erasing, imgIdx, probability, 0.02f, 0.33f, 0.3f, 3.3f);
+
+    std::vector<int2> anchors = Download<int2>(anchor);
+    std::vector<int3> areas   = Download<int3>(erasing);
+    std::vector<int>  indices = Download<int>(imgIdx);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        EXPECT_EQ(indices[i], i);
+
+        // the first value drawn decides whether the image is erased
+        nvcv::cuda::Philox rng = SampleStream(kSeed, i, 0);
+        if (rng.uniform() < probability)
+        {
+            EXPECT_EQ(areas[i].z, 0xF);
+            EXPECT_GE(areas[i].x, 1);
+            EXPECT_GE(areas[i].y, 1);
+            EXPECT_GE(anchors[i].x, 0);
+            EXPECT_GE(anchors[i].y, 0);
+            EXPECT_LE(anchors[i].x + areas[i].x, sizes[i].w) << "image " << i;
+            EXPECT_LE(anchors[i].y + areas[i].y, sizes[i].h) << "image " << i;
+        }
+        else
+        {
+            EXPECT_EQ(areas[i].x, 0);
+            EXPECT_EQ(areas[i].y, 0);
+            EXPECT_EQ(areas[i].z, 0);
+        }
+    }
+}
+
+TEST(OpRandomParams, crop_boxes_are_inside_the_input)
+{
+    const int numBoxes = 500, width = 640, height = 480;
+
+    nvcv::Tensor boxes(nvcv::TensorShape({numBoxes, 4}, nvcv::TENSOR_NW), nvcv::TYPE_F32);
+
+    cvcuda::RandomParams op(kSeed);
+    op.crop(nullptr, boxes, width, height, 0.08f, 1.f, 3.f / 4, 4.f / 3);
+
+    std::vector<float> boxesHost = Download<float>(boxes, 4);
+
+    for (int i = 0; i < numBoxes; ++i)
+    {
+        const float *box = &boxesHost[4 * i];
+        for (int k = 0; k < 4; ++k)
+        {
+            EXPECT_EQ(box[k], std::floor(box[k]));
+        }
+        EXPECT_GE(box[0], 0);
+        EXPECT_GE(box[1], 0);
+        EXPECT_LE(box[2], width);
+        EXPECT_LE(box[3], height);
+        EXPECT_GE(box[2] - box[0], 1) << "box " << i;
+        EXPECT_GE(box[3] - box[1], 1) << "box " << i;
+
+        // boxes are only clipped in one dimension, by at most a factor given by the aspect ratio range
+        const float area = (box[2] - box[0]) * (box[3] - box[1]);
+        EXPECT_LE(area, width * height);
+        EXPECT_GE(area, 0.08f * width * height * 3 / 4 * 0.95f) << "box " << i;
+    }
+}
+
+TEST(OpRandomParams, varshape_crop_boxes_are_inside_their_images)
+{
+    const int numImages = 200;
+
+    std::vector<nvcv::Size2D> sizes;
+    auto                      images = CreateImages(numImages, sizes);
+
+    nvcv::ImageBatchVarShape batch(numImages);
+    batch.pushBack(images.begin(), images.end());
+
+    nvcv::Tensor boxes(nvcv::TensorShape({numImages, 4}, nvcv::TENSOR_NW), nvcv::TYPE_F32);
+
+    cvcuda::RandomParams op(kSeed);
+    op.crop(nullptr, batch, boxes, 0.08f, 1.f, 3.f / 4, 4.f / 3);
+
+    std::vector<float> boxesHost = Download<float>(boxes, 4);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        const float *box = &boxesHost[4 * i];
+        EXPECT_GE(box[0], 0);
+        EXPECT_GE(box[1], 0);
+        EXPECT_LE(box[2], sizes[i].w) << "box " << i;
+        EXPECT_LE(box[3], sizes[i].h) << "box " << i;
+        EXPECT_GE(box[2] - box[0], 1) << "box " << i;
+        EXPECT_GE(box[3] - box[1], 1) << "box " << i;
+    }
+
+    // a batch of identical images draws the same boxes as the tensor version
+    nvcv::ImageBatchVarShape same(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        same.pushBack(*images[0]);
+    }
+    nvcv::Tensor boxesTensor(nvcv::TensorShape({numImages, 4}, nvcv::TENSOR_NW), nvcv::TYPE_F32);
+
+    cvcuda::RandomParams opVarShape(kSeed), opTensor(kSeed);
+    opVarShape.crop(nullptr, same, boxes, 0.08f, 1.f, 3.f / 4, 4.f / 3);
+    opTensor.crop(nullptr, boxesTensor, sizes[0].w, sizes[0].h, 0.08f, 1.f, 3.f / 4, 4.f / 3);
+    EXPECT_EQ(Download<float>(boxes, 4), Download<float>(boxesTensor, 4));
+}
+
+TEST(OpRandomParams, invalid_arguments)
+{
+    nvcv::Tensor flipCode(nvcv::TensorShape({8}, "N"), nvcv::TYPE_S32);
+    nvcv::Tensor flipCodeU8(nvcv::TensorShape({8}, "N"), nvcv::TYPE_U8);
+    nvcv::Tensor values(nvcv::TensorShape({8}, "N"), nvcv::TYPE_F32);
+    nvcv::Tensor valuesS32(nvcv::TensorShape({8}, "N"), nvcv::TYPE_S32);
+    nvcv::Tensor boxes(nvcv::TensorShape({8, 4}, nvcv::TENSOR_NW), nvcv::TYPE_F32);
+    nvcv::Tensor boxes5(nvcv::TensorShape({8, 5}, nvcv::TENSOR_NW), nvcv::TYPE_F32);
+
+    cvcuda::RandomParams op(kSeed);
+
+    EXPECT_THROW(op.flipCode(nullptr, flipCode, 1.5f, 0.5f), nvcv::Exception);
+    EXPECT_THROW(op.flipCode(nullptr, flipCode, 0.5f, -0.1f), nvcv::Exception);
+    EXPECT_THROW(op.flipCode(nullptr, flipCodeU8, 0.5f, 0.5f), nvcv::Exception);
+    EXPECT_THROW(op.uniform(nullptr, values, 2.0, 1.0), nvcv::Exception);
+    EXPECT_THROW(op.uniform(nullptr, valuesS32, 0.0, 1.0), nvcv::Exception);
+    EXPECT_THROW(op.crop(nullptr, boxes, 0, 10, 0.1f, 1.f, 0.5f, 2.f), nvcv::Exception);
+    EXPECT_THROW(op.crop(nullptr, boxes, 10, 10, 0.f, 1.f, 0.5f, 2.f), nvcv::Exception);
+    EXPECT_THROW(op.crop(nullptr, boxes, 10, 10, 0.5f, 0.1f, 0.5f, 2.f), nvcv::Exception);
+    EXPECT_THROW(op.crop(nullptr, boxes, 10, 10, 0.1f, 1.f, 2.f, 0.5f), nvcv::Exception);
+    EXPECT_THROW(op.crop(nullptr, boxes5, 10, 10, 0.1f, 1.f, 0.5f, 2.f), nvcv::Exception);
+
+    std::vector<nvcv::Size2D> sizes;
+    auto                      images = CreateImages(4, sizes);
+    nvcv::ImageBatchVarShape  batch(4);
+    batch.pushBack(images.begin(), images.end());
+    // one box per image
+    EXPECT_THROW(op.crop(nullptr, batch, boxes, 0.1f, 1.f, 0.5f, 2.f), nvcv::Exception);
+
+    // failed submissions don't consume draws
+    op.flipCode(nullptr, flipCode, 0.5f, 0.5f);
+    EXPECT_EQ(Download<int>(flipCode), GoldFlipCodes(8, 0.5f, 0.5f, kSeed, 0));
+}
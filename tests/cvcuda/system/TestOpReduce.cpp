@@ -0,0 +1,288 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpReduce.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+// Images hold integer values in [0, 255] whatever their type, so that float inputs are reduced exactly like 8-bit
+// ones.  Host images are stored plane after plane, with channels interleaved within each plane.
+std::vector<float> RandomImage(int size, std::default_random_engine &rng)
+{
+    std::uniform_int_distribution<int> udist(0, 255);
+
+    std::vector<float> img(size);
+    std::generate(img.begin(), img.end(), [&]() { return static_cast<float>(udist(rng)); });
+    return img;
+}
+
+std::vector<uint8_t> ToBytes(const std::vector<float> &img, nvcv::ImageFormat fmt)
+{
+    if (fmt.planeDataType(0).channelType(0) == nvcv::TYPE_F32)
+    {
+        std::vector<uint8_t> bytes(img.size() * sizeof(float));
+        std::memcpy(bytes.data(), img.data(), bytes.size());
+        return bytes;
+    }
+    return std::vector<uint8_t>(img.begin(), img.end());
+}
+
+// Copies the host image to the planes at plane0 of the device image, planeStride bytes apart.
+void CopyToDevice(void *plane0, int64_t planeStride, int64_t rowStride, const std::vector<float> &img,
+                  nvcv::Size2D size, nvcv::ImageFormat fmt)
+{
+    const std::vector<uint8_t> bytes    = ToBytes(img, fmt);
+    const int                  rowBytes = size.w * fmt.planePixelStrideBytes(0);
+
+    for (int p = 0; p < fmt.numPlanes(); ++p)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(static_cast<uint8_t *>(plane0) + p * planeStride, rowStride,
+                                            bytes.data() + p * size.h * rowBytes, rowBytes, rowBytes, size.h,
+                                            cudaMemcpyHostToDevice));
+    }
+}
+
+// Reduces each channel of the image, then all channels together when perChannel is false.
+std::vector<double> Reduce(const std::vector<float> &img, int channels, NVCVReduceOp op, bool perChannel)
+{
+    const size_t        numPixels = img.size() / channels;
+    std::vector<double> res(channels, op == NVCV_REDUCE_MIN ? DBL_MAX : (op == NVCV_REDUCE_MAX ? -DBL_MAX : 0));
+
+    // Pixels are reduced regardless of their position, so planar images are read as interleaved ones
+    for (size_t i = 0; i < img.size(); ++i)
+    {
+        double &r = res[i % channels];
+        double  v = img[i];
+
+        r = op == NVCV_REDUCE_MIN ? std::min(r, v) : (op == NVCV_REDUCE_MAX ? std::max(r, v) : r + v);
+    }
+
+    if (!perChannel)
+    {
+        for (int c = 1; c < channels; ++c)
+        {
+            double &r = res[0];
+            double  v = res[c];
+
+            r = op == NVCV_REDUCE_MIN ? std::min(r, v) : (op == NVCV_REDUCE_MAX ? std::max(r, v) : r + v);
+        }
+        res.resize(1);
+    }
+
+    if (op == NVCV_REDUCE_MEAN)
+    {
+        for (double &r : res)
+        {
+            r /= numPixels * (perChannel ? 1 : channels);
+        }
+    }
+    return res;
+}
+
+void ExpectReduced(const std::vector<double> &gold, const float *test)
+{
+    for (size_t c = 0; c < gold.size(); ++c)
+    {
+        EXPECT_NEAR(gold[c], test[c], std::max(1e-5 * std::abs(gold[c]), 1e-3)) << "at channel " << c;
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpReduce, test::ValueList<int, int, int, nvcv::ImageFormat, NVCVReduceOp, bool>
+{
+    // width, height, numImages,           format,                op, perChannel
+    {      33,     17,         1,     nvcv::FMT_U8,   NVCV_REDUCE_SUM,       true },
+    {     160,    120,         3,   nvcv::FMT_RGB8,  NVCV_REDUCE_MEAN,       true },
+    {      97,     33,         4,  nvcv::FMT_RGBA8,   NVCV_REDUCE_MIN,       true },
+    {      64,     48,         2, nvcv::FMT_RGBf32,   NVCV_REDUCE_MAX,       true },
+    {      50,     70,         2,  nvcv::FMT_RGB8p,   NVCV_REDUCE_SUM,       true },
+    {      50,     70,         3,  nvcv::FMT_RGB8p,  NVCV_REDUCE_MEAN,      false },
+    {     160,    120,         2,  nvcv::FMT_RGBA8,   NVCV_REDUCE_SUM,      false },
+    {      23,     11,         5,   nvcv::FMT_RGB8,   NVCV_REDUCE_MAX,      false },
+    // A single large image is reduced by many blocks
+    {    1920,   1080,         1,   nvcv::FMT_RGB8,  NVCV_REDUCE_MEAN,       true },
+    {    1024,   1024,         1,     nvcv::FMT_U8,   NVCV_REDUCE_MIN,       true }
+});
+
+// clang-format on
+
+TEST_P(OpReduce, tensor_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int               width      = GetParamValue<0>();
+    int               height     = GetParamValue<1>();
+    int               numImages  = GetParamValue<2>();
+    nvcv::ImageFormat fmt        = GetParamValue<3>();
+    NVCVReduceOp      op         = GetParamValue<4>();
+    bool              perChannel = GetParamValue<5>();
+
+    int channels    = fmt.numChannels();
+    int outChannels = perChannel ? channels : 1;
+
+    std::default_random_engine rng;
+
+    nvcv::Tensor imgSrc  = test::CreateTensor(numImages, width, height, fmt);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<std::vector<float>> srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        srcVec[i] = RandomImage(width * height * channels, rng);
+        CopyToDevice(srcAccess->sampleData(i), srcAccess->planeStride(), srcAccess->rowStride(), srcVec[i],
+                     {width, height}, fmt);
+    }
+
+    nvcv::Tensor imgDst({{numImages, 1, 1, outChannels}, "NHWC"}, nvcv::TYPE_F32);
+
+    cvcuda::Reduce reduceOp;
+    EXPECT_NO_THROW(reduceOp(stream, imgSrc, imgDst, op));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, dstData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<float> testVec(outChannels);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), dstAccess->sampleData(i), outChannels * sizeof(float),
+                                          cudaMemcpyDeviceToHost));
+
+        ExpectReduced(Reduce(srcVec[i], channels, op, perChannel), testVec.data());
+    }
+}
+
+TEST_P(OpReduce, varshape_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int               width      = GetParamValue<0>();
+    int               height     = GetParamValue<1>();
+    int               numImages  = GetParamValue<2>();
+    nvcv::ImageFormat fmt        = GetParamValue<3>();
+    NVCVReduceOp      op         = GetParamValue<4>();
+    bool              perChannel = GetParamValue<5>();
+
+    if (fmt.numPlanes() > 1)
+    {
+        GTEST_SKIP() << "Varshape images must have a single plane";
+    }
+
+    int channels    = fmt.numChannels();
+    int outChannels = perChannel ? channels : 1;
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> sdist(0, std::min(width, height) / 2);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    std::vector<std::vector<float>>           srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        nvcv::Size2D size{width - sdist(rng), height - sdist(rng)};
+
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(nullptr, srcData);
+
+        srcVec[i] = RandomImage(size.w * size.h * channels, rng);
+        CopyToDevice(srcData->plane(0).basePtr, 0, srcData->plane(0).rowStride, srcVec[i], size, fmt);
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    nvcv::Tensor imgDst({{numImages, 1, 1, outChannels}, "NHWC"}, nvcv::TYPE_F32);
+
+    cvcuda::Reduce reduceOp;
+    EXPECT_NO_THROW(reduceOp(stream, batchSrc, imgDst, op));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, dstData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<float> testVec(outChannels);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), dstAccess->sampleData(i), outChannels * sizeof(float),
+                                          cudaMemcpyDeviceToHost));
+
+        ExpectReduced(Reduce(srcVec[i], channels, op, perChannel), testVec.data());
+    }
+}
+
+TEST(OpReduce, invalid_arguments)
+{
+    nvcv::Tensor imgSrc = test::CreateTensor(2, 64, 48, nvcv::FMT_RGB8);
+
+    nvcv::Tensor out3({{2, 1, 1, 3}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor out1({{2, 1, 1, 1}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor out2({{2, 1, 1, 2}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor outSamples({{3, 1, 1, 3}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor outWide({{2, 1, 4, 3}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor outU8({{2, 1, 1, 3}, "NHWC"}, nvcv::TYPE_U8);
+
+    cvcuda::Reduce reduceOp;
+    EXPECT_NO_THROW(reduceOp(nullptr, imgSrc, out3, NVCV_REDUCE_SUM));
+    EXPECT_NO_THROW(reduceOp(nullptr, imgSrc, out1, NVCV_REDUCE_MEAN));
+    // output channels must be 1 or the input channels
+    EXPECT_THROW(reduceOp(nullptr, imgSrc, out2, NVCV_REDUCE_SUM), nvcv::Exception);
+    EXPECT_THROW(reduceOp(nullptr, imgSrc, outSamples, NVCV_REDUCE_SUM), nvcv::Exception);
+    EXPECT_THROW(reduceOp(nullptr, imgSrc, outWide, NVCV_REDUCE_SUM), nvcv::Exception);
+    EXPECT_THROW(reduceOp(nullptr, imgSrc, outU8, NVCV_REDUCE_SUM), nvcv::Exception);
+    EXPECT_THROW(reduceOp(nullptr, imgSrc, out3, static_cast<NVCVReduceOp>(42)), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -84,7 +84,9 @@ NVCV_TYPED_TEST_SUITE(
                              NVCV_TEST_ROW(56, 49, 2, NVCV_IMAGE_FORMAT_RGBA8p, NVCV_IMAGE_FORMAT_RGBA8, uchar),
                              NVCV_TEST_ROW(56, 49, 3, NVCV_IMAGE_FORMAT_RGB8, NVCV_IMAGE_FORMAT_RGB8p, uchar),
                              NVCV_TEST_ROW(31, 30, 3, NVCV_IMAGE_FORMAT_RGBAf32, NVCV_IMAGE_FORMAT_RGBAf32p, float),
-                             NVCV_TEST_ROW(30, 31, 3, NVCV_IMAGE_FORMAT_RGBf32p, NVCV_IMAGE_FORMAT_RGBf32, float)>);
+                             NVCV_TEST_ROW(30, 31, 3, NVCV_IMAGE_FORMAT_RGBf32p, NVCV_IMAGE_FORMAT_RGBf32, float),
+                             NVCV_TEST_ROW(193, 21, 2, NVCV_IMAGE_FORMAT_RGBA8, NVCV_IMAGE_FORMAT_RGBA8p, uchar),
+                             NVCV_TEST_ROW(130, 17, 2, NVCV_IMAGE_FORMAT_RGBf32p, NVCV_IMAGE_FORMAT_RGBf32, float)>);
 
 #undef NVCV_TEST_ROW
 
@@ -182,3 +184,146 @@ TYPED_TEST(OpReformat, correct_output)
 
     EXPECT_EQ(testVec, goldVec);
 }
+
+TEST(OpReformat, blocked_layout_round_trip)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int batches = 2, height = 5, width = 70, channels = 3, block = 4;
+
+    nvcv::Tensor inTensor({{batches, height, width, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor blockedTensor({{batches, 1, height, width, block}, nvcv::TENSOR_NCHWc}, nvcv::TYPE_U8);
+    nvcv::Tensor outTensor({{batches, channels, height, width}, nvcv::TENSOR_NCHW}, nvcv::TYPE_U8);
+
+    const auto *inData      = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inTensor.exportData());
+    const auto *blockedData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(blockedTensor.exportData());
+    const auto *outData     = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outTensor.exportData());
+    ASSERT_NE(inData, nullptr);
+    ASSERT_NE(blockedData, nullptr);
+    ASSERT_NE(outData, nullptr);
+
+    std::vector<uint8_t> inVec(inData->stride(0) * batches);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), inVec.data(), inVec.size(), cudaMemcpyHostToDevice));
+
+    cvcuda::Reformat reformatOp;
+
+    EXPECT_NO_THROW(reformatOp(stream, inTensor, blockedTensor));
+    EXPECT_NO_THROW(reformatOp(stream, blockedTensor, outTensor));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<uint8_t> blockedVec(blockedData->stride(0) * batches);
+    std::vector<uint8_t> outVec(outData->stride(0) * batches);
+    ASSERT_EQ(cudaSuccess,
+              cudaMemcpy(blockedVec.data(), blockedData->basePtr(), blockedVec.size(), cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(outVec.data(), outData->basePtr(), outVec.size(), cudaMemcpyDeviceToHost));
+
+    for (int b = 0; b < batches; ++b)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                for (int c = 0; c < block; ++c)
+                {
+                    uint8_t gold = c < channels ? inVec[b * inData->stride(0) + y * inData->stride(1)
+                                                        + x * inData->stride(2) + c]
+                                                : 0;
+                    EXPECT_EQ(gold, blockedVec[b * blockedData->stride(0) + y * blockedData->stride(2)
+                                               + x * blockedData->stride(3) + c]);
+
+                    if (c < channels)
+                    {
+                        EXPECT_EQ(gold, outVec[b * outData->stride(0) + c * outData->stride(1)
+                                               + y * outData->stride(2) + x]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(OpReformat, blocked_layout_invalid_channels_are_rejected)
+{
+    nvcv::Tensor inTensor({{1, 4, 4, 9}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor blockedTensor({{1, 2, 4, 4, 4}, nvcv::TENSOR_NCHWc}, nvcv::TYPE_U8);
+
+    cvcuda::Reformat reformatOp;
+    EXPECT_THROW(reformatOp(nullptr, inTensor, blockedTensor), nvcv::Exception);
+}
+
+TEST(OpReformat, channel_order_is_applied)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int batches = 2, height = 5, width = 70, channels = 3;
+
+    nvcv::Tensor inTensor({{batches, height, width, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor planarTensor({{batches, channels, height, width}, nvcv::TENSOR_NCHW}, nvcv::TYPE_U8);
+    nvcv::Tensor copyTensor({{batches, height, width, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    const auto *inData     = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(inTensor.exportData());
+    const auto *planarData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(planarTensor.exportData());
+    const auto *copyData   = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(copyTensor.exportData());
+    ASSERT_NE(inData, nullptr);
+    ASSERT_NE(planarData, nullptr);
+    ASSERT_NE(copyData, nullptr);
+
+    std::vector<uint8_t> inVec(inData->stride(0) * batches);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return rand(randEng); });
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(inData->basePtr(), inVec.data(), inVec.size(), cudaMemcpyHostToDevice));
+
+    cvcuda::Reformat reformatOp;
+
+    EXPECT_NO_THROW(reformatOp(stream, inTensor, planarTensor, NVCV_SWIZZLE_ZYXW));
+    EXPECT_NO_THROW(reformatOp(stream, inTensor, copyTensor, NVCV_SWIZZLE_ZYXW));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<uint8_t> planarVec(planarData->stride(0) * batches);
+    std::vector<uint8_t> copyVec(copyData->stride(0) * batches);
+    ASSERT_EQ(cudaSuccess,
+              cudaMemcpy(planarVec.data(), planarData->basePtr(), planarVec.size(), cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(copyVec.data(), copyData->basePtr(), copyVec.size(), cudaMemcpyDeviceToHost));
+
+    for (int b = 0; b < batches; ++b)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                for (int c = 0; c < channels; ++c)
+                {
+                    uint8_t gold = inVec[b * inData->stride(0) + y * inData->stride(1) + x * inData->stride(2)
+                                         + (channels - 1 - c)];
+                    EXPECT_EQ(gold, planarVec[b * planarData->stride(0) + c * planarData->stride(1)
+                                              + y * planarData->stride(2) + x]);
+                    EXPECT_EQ(gold, copyVec[b * copyData->stride(0) + y * copyData->stride(1)
+                                            + x * copyData->stride(2) + c]);
+                }
+            }
+        }
+    }
+}
+
+TEST(OpReformat, channel_order_out_of_range_is_rejected)
+{
+    nvcv::Tensor inTensor({{1, 4, 4, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor outTensor({{1, 3, 4, 4}, nvcv::TENSOR_NCHW}, nvcv::TYPE_U8);
+
+    cvcuda::Reformat reformatOp;
+    EXPECT_THROW(reformatOp(nullptr, inTensor, outTensor, NVCV_SWIZZLE_WZYX), nvcv::Exception);
+}
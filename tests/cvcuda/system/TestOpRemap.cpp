@@ -0,0 +1,411 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpRemap.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+// Map coordinates are multiples of 1/32 of pixel, so that float and fixed-point maps give the same result.
+constexpr int kFracScale = 32;
+
+// Generates a map of the given size whose source coordinates follow a radial distortion of the source image,
+// going a few pixels out of it in the corners.
+std::vector<float> GenerateMap(nvcv::Size2D mapSize, nvcv::Size2D srcSize, bool relative, int seed)
+{
+    std::default_random_engine            rng(seed);
+    std::uniform_real_distribution<float> kdist(0.05f, 0.2f);
+    const float                           k = kdist(rng);
+
+    std::vector<float> map(mapSize.w * mapSize.h * 2);
+    for (int y = 0; y < mapSize.h; ++y)
+    {
+        for (int x = 0; x < mapSize.w; ++x)
+        {
+            float u  = (x + 0.5f) / mapSize.w * 2 - 1;
+            float v  = (y + 0.5f) / mapSize.h * 2 - 1;
+            float r2 = u * u + v * v;
+
+            float sx = ((u * (1 + k * r2) + 1) * 0.5f) * srcSize.w - 0.5f;
+            float sy = ((v * (1 + k * r2) + 1) * 0.5f) * srcSize.h - 0.5f;
+            if (relative)
+            {
+                sx -= x;
+                sy -= y;
+            }
+
+            map[(y * mapSize.w + x) * 2 + 0] = std::floor(sx * kFracScale) / kFracScale;
+            map[(y * mapSize.w + x) * 2 + 1] = std::floor(sy * kFracScale) / kFracScale;
+        }
+    }
+    return map;
+}
+
+// Creates a map tensor with the given samples, float32 [x, y] or int16 [x, y, frac].
+std::unique_ptr<nvcv::Tensor> CreateMap(const std::vector<std::vector<float>> &hMaps, nvcv::Size2D mapSize,
+                                        bool fixed)
+{
+    const int channels = fixed ? 3 : 2;
+
+    auto map = std::make_unique<nvcv::Tensor>(
+        nvcv::TensorShape{{static_cast<int64_t>(hMaps.size()), mapSize.h, mapSize.w, channels}, nvcv::TENSOR_NHWC},
+        fixed ? nvcv::TYPE_S16 : nvcv::TYPE_F32);
+
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(map->exportData());
+    EXPECT_NE(nullptr, data);
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    EXPECT_TRUE(access);
+
+    for (size_t i = 0; i < hMaps.size(); ++i)
+    {
+        std::vector<uint8_t> bytes;
+        if (fixed)
+        {
+            std::vector<int16_t> values(mapSize.w * mapSize.h * 3);
+            for (int p = 0; p < mapSize.w * mapSize.h; ++p)
+            {
+                int ix = static_cast<int>(std::floor(hMaps[i][p * 2 + 0] * kFracScale));
+                int iy = static_cast<int>(std::floor(hMaps[i][p * 2 + 1] * kFracScale));
+
+                values[p * 3 + 0] = ix >> 5;
+                values[p * 3 + 1] = iy >> 5;
+                values[p * 3 + 2] = ((iy & 31) << 5) | (ix & 31);
+            }
+            bytes.resize(values.size() * sizeof(int16_t));
+            std::memcpy(bytes.data(), values.data(), bytes.size());
+        }
+        else
+        {
+            bytes.resize(hMaps[i].size() * sizeof(float));
+            std::memcpy(bytes.data(), hMaps[i].data(), bytes.size());
+        }
+
+        int rowStride = mapSize.w * access->colStride();
+        EXPECT_EQ(cudaSuccess, cudaMemcpy2D(access->sampleData(i), access->rowStride(), bytes.data(), rowStride,
+                                            rowStride, mapSize.h, cudaMemcpyHostToDevice));
+    }
+
+    return map;
+}
+
+// Remaps a packed HWC sample the same way as cvcuda::Remap, for constant and replicate borders.
+void Remap(std::vector<uint8_t> &hDst, nvcv::Size2D dstSize, const std::vector<uint8_t> &hSrc, nvcv::Size2D srcSize,
+           int channels, const std::vector<float> &map, int mapWidth, bool relative, NVCVInterpolationType interp,
+           NVCVBorderType border, const float4 borderValue)
+{
+    const float bValue[4] = {borderValue.x, borderValue.y, borderValue.z, borderValue.w};
+
+    auto at = [&](int y, int x, int c)
+    {
+        if (border == NVCV_BORDER_REPLICATE)
+        {
+            x = std::clamp(x, 0, srcSize.w - 1);
+            y = std::clamp(y, 0, srcSize.h - 1);
+        }
+        else if (x < 0 || x >= srcSize.w || y < 0 || y >= srcSize.h)
+        {
+            return bValue[c];
+        }
+        return static_cast<float>(hSrc[(y * srcSize.w + x) * channels + c]);
+    };
+
+    hDst.resize(dstSize.w * dstSize.h * channels);
+    for (int y = 0; y < dstSize.h; ++y)
+    {
+        for (int x = 0; x < dstSize.w; ++x)
+        {
+            float sx = map[(y * mapWidth + x) * 2 + 0] + (relative ? x : 0);
+            float sy = map[(y * mapWidth + x) * 2 + 1] + (relative ? y : 0);
+
+            for (int c = 0; c < channels; ++c)
+            {
+                float value;
+                if (interp == NVCV_INTERP_NEAREST)
+                {
+                    value = at(static_cast<int>(std::floor(sy + 0.5f)), static_cast<int>(std::floor(sx + 0.5f)), c);
+                }
+                else
+                {
+                    int   x1 = static_cast<int>(std::floor(sx)), y1 = static_cast<int>(std::floor(sy));
+                    float fx = sx - x1, fy = sy - y1;
+
+                    value = at(y1, x1, c) * (1 - fx) * (1 - fy) + at(y1, x1 + 1, c) * fx * (1 - fy)
+                          + at(y1 + 1, x1, c) * (1 - fx) * fy + at(y1 + 1, x1 + 1, c) * fx * fy;
+                }
+
+                hDst[(y * dstSize.w + x) * channels + c]
+                    = static_cast<uint8_t>(std::clamp(std::rint(value), 0.f, 255.f));
+            }
+        }
+    }
+}
+
+std::vector<uint8_t> RandomImage(int size, std::default_random_engine &rng)
+{
+    std::uniform_int_distribution<int> udist(0, 255);
+
+    std::vector<uint8_t> img(size);
+    std::generate(img.begin(), img.end(), [&]() { return udist(rng); });
+    return img;
+}
+
+void ExpectNear(const std::vector<uint8_t> &gold, const std::vector<uint8_t> &test)
+{
+    ASSERT_EQ(gold.size(), test.size());
+    for (size_t k = 0; k < gold.size(); ++k)
+    {
+        ASSERT_LE(std::abs(static_cast<int>(gold[k]) - static_cast<int>(test[k])), 1) << "at " << k;
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpRemap, test::ValueList<int, int, int, int, int, bool, nvcv::ImageFormat, NVCVInterpolationType, NVCVBorderType, bool, bool>
+{
+    // srcWidth, srcHeight, dstWidth, dstHeight, numImages, mapPerImage,         format,       interpolation,              border, fixedMap, relative
+    {       160,       120,      128,       96,         1,       false,  nvcv::FMT_RGB8,  NVCV_INTERP_LINEAR,  NVCV_BORDER_CONSTANT,    false,    false },
+    {       160,       120,      160,      120,         3,       false, nvcv::FMT_RGBA8,  NVCV_INTERP_LINEAR, NVCV_BORDER_REPLICATE,     true,    false },
+    {        64,        48,       80,       40,         2,        true,    nvcv::FMT_U8, NVCV_INTERP_NEAREST,  NVCV_BORDER_CONSTANT,    false,     true },
+    {        97,        33,       97,       33,         4,        true, nvcv::FMT_RGBA8, NVCV_INTERP_NEAREST, NVCV_BORDER_REPLICATE,     true,     true },
+    {        50,        70,       33,       61,         2,       false,  nvcv::FMT_RGB8,  NVCV_INTERP_LINEAR,  NVCV_BORDER_CONSTANT,     true,     true }
+});
+
+// clang-format on
+
+TEST_P(OpRemap, tensor_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int                   srcWidth    = GetParamValue<0>();
+    int                   srcHeight   = GetParamValue<1>();
+    int                   dstWidth    = GetParamValue<2>();
+    int                   dstHeight   = GetParamValue<3>();
+    int                   numImages   = GetParamValue<4>();
+    bool                  mapPerImage = GetParamValue<5>();
+    nvcv::ImageFormat     fmt         = GetParamValue<6>();
+    NVCVInterpolationType interp      = GetParamValue<7>();
+    NVCVBorderType        border      = GetParamValue<8>();
+    bool                  fixedMap    = GetParamValue<9>();
+    bool                  relative    = GetParamValue<10>();
+
+    const float4 borderValue = {10, 20, 30, 40};
+
+    int channels = fmt.numChannels();
+
+    std::default_random_engine rng;
+
+    nvcv::Tensor imgSrc  = test::CreateTensor(numImages, srcWidth, srcHeight, fmt);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<std::vector<uint8_t>> srcVec(numImages);
+    int                               srcVecRowStride = srcWidth * channels;
+    for (int i = 0; i < numImages; ++i)
+    {
+        srcVec[i] = RandomImage(srcHeight * srcVecRowStride, rng);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(),
+                                            srcVecRowStride, srcVecRowStride, srcHeight, cudaMemcpyHostToDevice));
+    }
+
+    std::vector<std::vector<float>> hMaps(mapPerImage ? numImages : 1);
+    for (size_t i = 0; i < hMaps.size(); ++i)
+    {
+        hMaps[i] = GenerateMap({dstWidth, dstHeight}, {srcWidth, srcHeight}, relative, i);
+    }
+    auto map = CreateMap(hMaps, {dstWidth, dstHeight}, fixedMap);
+
+    nvcv::Tensor imgDst = test::CreateTensor(numImages, dstWidth, dstHeight, fmt);
+
+    cvcuda::Remap op;
+    EXPECT_NO_THROW(op(stream, imgSrc, imgDst, *map, interp, relative ? NVCV_REMAP_RELATIVE : NVCV_REMAP_ABSOLUTE,
+                       border, borderValue));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, dstData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    int dstVecRowStride = dstWidth * channels;
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> testVec(dstHeight * dstVecRowStride);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), dstVecRowStride, dstAccess->sampleData(i),
+                                            dstAccess->rowStride(), dstVecRowStride, dstHeight,
+                                            cudaMemcpyDeviceToHost));
+
+        std::vector<uint8_t> goldVec;
+        Remap(goldVec, {dstWidth, dstHeight}, srcVec[i], {srcWidth, srcHeight}, channels,
+              hMaps[mapPerImage ? i : 0], dstWidth, relative, interp, border, borderValue);
+
+        ExpectNear(goldVec, testVec);
+    }
+}
+
+TEST_P(OpRemap, varshape_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int                   srcWidth    = GetParamValue<0>();
+    int                   srcHeight   = GetParamValue<1>();
+    int                   dstWidth    = GetParamValue<2>();
+    int                   dstHeight   = GetParamValue<3>();
+    int                   numImages   = GetParamValue<4>();
+    bool                  mapPerImage = GetParamValue<5>();
+    nvcv::ImageFormat     fmt         = GetParamValue<6>();
+    NVCVInterpolationType interp      = GetParamValue<7>();
+    NVCVBorderType        border      = GetParamValue<8>();
+    bool                  fixedMap    = GetParamValue<9>();
+    bool                  relative    = GetParamValue<10>();
+
+    const float4 borderValue = {10, 20, 30, 40};
+
+    int channels = fmt.numChannels();
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> sdist(0, 16);
+
+    // Images get smaller than the parameter sizes, the map covers the largest output
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst;
+    std::vector<nvcv::Size2D>                 srcSizes, dstSizes;
+    std::vector<std::vector<uint8_t>>         srcVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        srcSizes.push_back({srcWidth - sdist(rng), srcHeight - sdist(rng)});
+        dstSizes.push_back({i == 0 ? dstWidth : dstWidth - sdist(rng), i == 0 ? dstHeight : dstHeight - sdist(rng)});
+
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(srcSizes[i], fmt));
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(dstSizes[i], fmt));
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(nullptr, srcData);
+
+        int srcStride = srcSizes[i].w * channels;
+        srcVec[i]     = RandomImage(srcSizes[i].h * srcStride, rng);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec[i].data(),
+                                            srcStride, srcStride, srcSizes[i].h, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    nvcv::ImageBatchVarShape batchDst(numImages);
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+
+    std::vector<std::vector<float>> hMaps(mapPerImage ? numImages : 1);
+    for (size_t i = 0; i < hMaps.size(); ++i)
+    {
+        hMaps[i] = GenerateMap({dstWidth, dstHeight}, {srcWidth, srcHeight}, relative, i);
+    }
+    auto map = CreateMap(hMaps, {dstWidth, dstHeight}, fixedMap);
+
+    cvcuda::Remap op;
+    EXPECT_NO_THROW(op(stream, batchSrc, batchDst, *map, interp,
+                       relative ? NVCV_REMAP_RELATIVE : NVCV_REMAP_ABSOLUTE, border, borderValue));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        const auto *dstData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[i]->exportData());
+        ASSERT_NE(nullptr, dstData);
+
+        int                  dstStride = dstSizes[i].w * channels;
+        std::vector<uint8_t> testVec(dstSizes[i].h * dstStride);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), dstStride, dstData->plane(0).basePtr,
+                                            dstData->plane(0).rowStride, dstStride, dstSizes[i].h,
+                                            cudaMemcpyDeviceToHost));
+
+        std::vector<uint8_t> goldVec;
+        Remap(goldVec, dstSizes[i], srcVec[i], srcSizes[i], channels, hMaps[mapPerImage ? i : 0], dstWidth, relative,
+              interp, border, borderValue);
+
+        ExpectNear(goldVec, testVec);
+    }
+}
+
+TEST(OpRemap, invalid_arguments)
+{
+    nvcv::Tensor imgSrc = test::CreateTensor(2, 64, 48, nvcv::FMT_RGB8);
+    nvcv::Tensor imgDst = test::CreateTensor(2, 32, 16, nvcv::FMT_RGB8);
+
+    std::vector<float> hMap(32 * 16 * 2, 0.f);
+
+    auto map1     = CreateMap({hMap}, {32, 16}, false);
+    auto map2     = CreateMap({hMap, hMap}, {32, 16}, true);
+    auto map3     = CreateMap({hMap, hMap, hMap}, {32, 16}, false);
+    auto mapSmall = CreateMap({std::vector<float>(16 * 16 * 2)}, {16, 16}, false);
+
+    nvcv::Tensor mapU8 = test::CreateTensor(1, 32, 16, nvcv::FMT_RGB8);
+    nvcv::Tensor imgF32 = test::CreateTensor(2, 32, 16, nvcv::FMT_RGBf32);
+
+    const float4 bValue = {0, 0, 0, 0};
+
+    cvcuda::Remap op;
+    EXPECT_NO_THROW(op(nullptr, imgSrc, imgDst, *map1, NVCV_INTERP_LINEAR, NVCV_REMAP_ABSOLUTE, NVCV_BORDER_CONSTANT,
+                       bValue));
+    EXPECT_NO_THROW(op(nullptr, imgSrc, imgDst, *map2, NVCV_INTERP_CUBIC, NVCV_REMAP_RELATIVE, NVCV_BORDER_WRAP,
+                       bValue));
+    // map must have one sample or one sample per output sample
+    EXPECT_THROW(op(nullptr, imgSrc, imgDst, *map3, NVCV_INTERP_LINEAR, NVCV_REMAP_ABSOLUTE, NVCV_BORDER_CONSTANT,
+                    bValue),
+                 nvcv::Exception);
+    // map must have the output size
+    EXPECT_THROW(op(nullptr, imgSrc, imgDst, *mapSmall, NVCV_INTERP_LINEAR, NVCV_REMAP_ABSOLUTE,
+                    NVCV_BORDER_CONSTANT, bValue),
+                 nvcv::Exception);
+    EXPECT_THROW(op(nullptr, imgSrc, imgDst, mapU8, NVCV_INTERP_LINEAR, NVCV_REMAP_ABSOLUTE, NVCV_BORDER_CONSTANT,
+                    bValue),
+                 nvcv::Exception);
+    EXPECT_THROW(op(nullptr, imgSrc, imgF32, *map1, NVCV_INTERP_LINEAR, NVCV_REMAP_ABSOLUTE, NVCV_BORDER_CONSTANT,
+                    bValue),
+                 nvcv::Exception);
+    EXPECT_THROW(op(nullptr, imgSrc, imgDst, *map1, NVCV_INTERP_AREA, NVCV_REMAP_ABSOLUTE, NVCV_BORDER_CONSTANT,
+                    bValue),
+                 nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -20,6 +20,7 @@
 #include <common/TensorDataUtils.hpp>
 #include <common/ValueTests.hpp>
 #include <cvcuda/OpResize.hpp>
+#include <cvcuda/Operator.h>
 #include <nvcv/Image.hpp>
 #include <nvcv/ImageBatch.hpp>
 #include <nvcv/Tensor.hpp>
@@ -27,8 +28,13 @@
 #include <nvcv/alloc/CustomAllocator.hpp>
 #include <nvcv/alloc/CustomResourceAllocator.hpp>
 
+#include <cuda_fp16.h>
+
 #include <cmath>
+#include <filesystem>
+#include <fstream>
 #include <random>
+#include <sstream>
 
 namespace test = nvcv::test;
 namespace t    = ::testing;
@@ -151,6 +157,27 @@ static void Resize(std::vector<uint8_t> &hDst, int dstRowStride, nvcv::Size2D ds
                     dstPtr[di * dstRowStride + dj * elementsPerPixel + k] = res < 0 ? 0 : (res > 255 ? 255 : res);
                 }
             }
+            else if (interpolation == NVCV_INTERP_AREA)
+            {
+                // integer downscale factors only, i.e. box average
+                int iFactor = srcSize.h / dstSize.h;
+                int jFactor = srcSize.w / dstSize.w;
+                assert(iFactor * dstSize.h == srcSize.h && jFactor * dstSize.w == srcSize.w);
+
+                for (int k = 0; k < elementsPerPixel; k++)
+                {
+                    double sum = 0;
+                    for (int si = di * iFactor; si < (di + 1) * iFactor; si++)
+                    {
+                        for (int sj = dj * jFactor; sj < (dj + 1) * jFactor; sj++)
+                        {
+                            sum += srcPtr[si * srcRowStride + sj * elementsPerPixel + k];
+                        }
+                    }
+
+                    dstPtr[di * dstRowStride + dj * elementsPerPixel + k] = std::rint(sum / (iFactor * jFactor));
+                }
+            }
         }
     }
 }
@@ -173,6 +200,12 @@ NVCV_TEST_SUITE_P(OpResize, test::ValueList<int, int, int, int, NVCVInterpolatio
     {        420,      420,      420,       420,   NVCV_INTERP_CUBIC,           2},
     {        420,      420,      420,       420,   NVCV_INTERP_CUBIC,           1},
     {        420,      420,       40,        42,   NVCV_INTERP_CUBIC,           1},
+    {        63,        45,       42,        30,  NVCV_INTERP_LINEAR,           2},
+    {        63,        45,       42,        30,   NVCV_INTERP_CUBIC,           2},
+    {        64,        48,      128,        96,  NVCV_INTERP_LINEAR,           3},
+    {       128,        96,       32,        24,  NVCV_INTERP_LINEAR,           2},
+    {        48,        40,       16,        12, NVCV_INTERP_NEAREST,         100},
+    {        24,        24,       56,        56,   NVCV_INTERP_CUBIC,          40},
 });
 
 // clang-format on
@@ -261,6 +294,764 @@ TEST_P(OpResize, tensor_correct_output)
     }
 }
 
+TEST(OpResize, plan_matches_operator)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    nvcv::Tensor::Requirements inReqs  = nvcv::Tensor::CalcRequirements(3, {64, 48}, fmt);
+    nvcv::Tensor::Requirements outReqs = nvcv::Tensor::CalcRequirements(3, {37, 29}, fmt);
+
+    nvcv::Tensor imgSrc(inReqs);
+    nvcv::Tensor imgDst(outReqs);
+    nvcv::Tensor imgGold(outReqs);
+
+    const auto *srcData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    const auto *dstData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    const auto *goldData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgGold.exportData());
+    ASSERT_NE(nullptr, srcData);
+    ASSERT_NE(nullptr, dstData);
+    ASSERT_NE(nullptr, goldData);
+
+    std::vector<uint8_t> srcVec(inReqs.strides[0] * inReqs.shape[0]);
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), srcVec.size(), cudaMemcpyHostToDevice));
+
+    cvcuda::Resize resizeOp;
+
+    for (NVCVInterpolationType interpolation :
+         {NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR, NVCV_INTERP_CUBIC, NVCV_INTERP_AREA})
+    {
+        SCOPED_TRACE(interpolation);
+
+        cvcuda::Resize::Plan plan = resizeOp.plan(inReqs, outReqs, interpolation);
+
+        EXPECT_NO_THROW(plan(stream, imgSrc, imgDst));
+        EXPECT_NO_THROW(resizeOp(stream, imgSrc, imgGold, interpolation));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        std::vector<uint8_t> testVec(outReqs.strides[0] * outReqs.shape[0]), goldVec(testVec.size());
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), dstData->basePtr(), testVec.size(), cudaMemcpyDeviceToHost));
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy(goldVec.data(), goldData->basePtr(), goldVec.size(), cudaMemcpyDeviceToHost));
+
+        EXPECT_EQ(testVec, goldVec);
+
+        // tensors must match the plan
+        EXPECT_THROW(plan(stream, imgSrc, imgSrc), nvcv::Exception);
+    }
+
+    EXPECT_THROW(resizeOp.plan(inReqs, outReqs, NVCV_INTERP_MAX), nvcv::Exception);
+
+    nvcv::Tensor::Requirements hwcReqs = nvcv::Tensor::CalcRequirements(nvcv::TensorShape({29, 37, 4}, "HWC"),
+                                                                        nvcv::TYPE_U8);
+    EXPECT_THROW(resizeOp.plan(inReqs, hwcReqs, NVCV_INTERP_LINEAR), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpResize, tensor_data_submit_matches_operator)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGB8;
+
+    nvcv::Tensor imgSrc(2, {40, 30}, fmt);
+    nvcv::Tensor imgDst(2, {17, 23}, fmt);
+    nvcv::Tensor imgGold(2, {17, 23}, fmt);
+
+    const auto *srcData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    const auto *dstData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    const auto *goldData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgGold.exportData());
+    ASSERT_NE(nullptr, srcData);
+    ASSERT_NE(nullptr, dstData);
+    ASSERT_NE(nullptr, goldData);
+
+    const int64_t srcBytes = srcData->stride(0) * srcData->shape(0);
+    const int64_t dstBytes = dstData->stride(0) * dstData->shape(0);
+
+    std::vector<uint8_t> srcVec(srcBytes);
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), srcBytes, cudaMemcpyHostToDevice));
+
+    cvcuda::Resize resizeOp;
+
+    cvcuda::Resize::Plan plan = resizeOp.plan(nvcv::Tensor::CalcRequirements(2, {40, 30}, fmt),
+                                              nvcv::Tensor::CalcRequirements(2, {17, 23}, fmt), NVCV_INTERP_LINEAR);
+
+    std::vector<uint8_t> testVec(dstBytes), goldVec(dstBytes);
+
+    EXPECT_NO_THROW(resizeOp(stream, imgSrc, imgGold, NVCV_INTERP_LINEAR));
+    ASSERT_EQ(cudaSuccess, cudaMemcpyAsync(goldVec.data(), goldData->basePtr(), dstBytes, cudaMemcpyDeviceToHost,
+                                           stream));
+
+    EXPECT_NO_THROW(resizeOp(stream, *srcData, *dstData, NVCV_INTERP_LINEAR));
+    ASSERT_EQ(cudaSuccess, cudaMemcpyAsync(testVec.data(), dstData->basePtr(), dstBytes, cudaMemcpyDeviceToHost,
+                                           stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(goldVec, testVec);
+
+    ASSERT_EQ(cudaSuccess, cudaMemset(dstData->basePtr(), 0, dstBytes));
+    EXPECT_NO_THROW(plan(stream, *srcData, *dstData));
+    ASSERT_EQ(cudaSuccess, cudaMemcpyAsync(testVec.data(), dstData->basePtr(), dstBytes, cudaMemcpyDeviceToHost,
+                                           stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(goldVec, testVec);
+
+    // tensors must still match the plan
+    EXPECT_THROW(plan(stream, *srcData, *srcData), nvcv::Exception);
+
+    NVCVTensorData hostData = dstData->cdata();
+    hostData.bufferType     = NVCV_TENSOR_BUFFER_NONE;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaResizeDataSubmit(resizeOp.handle(), stream, &srcData->cdata(), &hostData, NVCV_INTERP_LINEAR));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaResizeDataSubmit(resizeOp.handle(), stream, nullptr, &dstData->cdata(), NVCV_INTERP_LINEAR));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaResizePlanDataSubmit(plan.handle(), stream, &srcData->cdata(), nullptr));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpResize, nothrow_variants_return_status)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGB8;
+
+    nvcv::Tensor imgSrc(2, {40, 30}, fmt);
+    nvcv::Tensor imgDst(2, {17, 23}, fmt);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, srcData);
+    ASSERT_NE(nullptr, dstData);
+
+    cvcuda::Resize resizeOp;
+
+    cvcuda::Resize::Plan plan = resizeOp.plan(nvcv::Tensor::CalcRequirements(2, {40, 30}, fmt),
+                                              nvcv::Tensor::CalcRequirements(2, {17, 23}, fmt), NVCV_INTERP_LINEAR);
+
+    EXPECT_EQ(nvcv::Status::SUCCESS, resizeOp(std::nothrow, stream, imgSrc, imgDst, NVCV_INTERP_LINEAR));
+    EXPECT_EQ(nvcv::Status::SUCCESS, resizeOp(std::nothrow, stream, *srcData, *dstData, NVCV_INTERP_LINEAR));
+    EXPECT_EQ(nvcv::Status::SUCCESS, plan(std::nothrow, stream, imgSrc, imgDst));
+    EXPECT_EQ(nvcv::Status::SUCCESS, plan(std::nothrow, stream, *srcData, *dstData));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    // Errors are returned along with the message, the same as the throwing variants report
+    EXPECT_NE(nvcv::Status::SUCCESS,
+              resizeOp(std::nothrow, stream, *srcData, *dstData, static_cast<NVCVInterpolationType>(-1)));
+    char msg[NVCV_MAX_STATUS_MESSAGE_LENGTH];
+    EXPECT_NE(NVCV_SUCCESS, nvcvGetLastErrorMessage(msg, sizeof(msg)));
+    EXPECT_STRNE("", msg);
+
+    EXPECT_EQ(nvcv::Status::ERROR_INVALID_ARGUMENT, plan(std::nothrow, stream, *srcData, *srcData));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvGetLastErrorMessage(msg, sizeof(msg)));
+    EXPECT_THAT(msg, t::HasSubstr("don't match"));
+    EXPECT_EQ(NVCV_SUCCESS, nvcvGetLastError());
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaResizeDataSubmit(nullptr, stream, &srcData->cdata(), &dstData->cdata(), NVCV_INTERP_LINEAR));
+    EXPECT_EQ(NVCV_ERROR_NOT_COMPATIBLE,
+              cvcudaResizePlanDataSubmit(resizeOp.handle(), stream, &srcData->cdata(), &dstData->cdata()));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpResize, autotuned_nearest_matches_heuristic)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    nvcv::Tensor::Requirements inReqs  = nvcv::Tensor::CalcRequirements(2, {96, 40}, fmt);
+    nvcv::Tensor::Requirements outReqs = nvcv::Tensor::CalcRequirements(2, {64, 30}, fmt);
+
+    nvcv::Tensor imgSrc(inReqs);
+    nvcv::Tensor imgDst(outReqs);
+    nvcv::Tensor imgGold(outReqs);
+
+    const auto *srcData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    const auto *dstData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    const auto *goldData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgGold.exportData());
+    ASSERT_NE(nullptr, srcData);
+    ASSERT_NE(nullptr, dstData);
+    ASSERT_NE(nullptr, goldData);
+
+    std::vector<uint8_t> srcVec(inReqs.strides[0] * inReqs.shape[0]);
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), srcVec.size(), cudaMemcpyHostToDevice));
+
+    cvcuda::Resize resizeOp;
+
+    EXPECT_NO_THROW(resizeOp(stream, imgSrc, imgGold, NVCV_INTERP_NEAREST));
+
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetAutotuneEnabled(1));
+    EXPECT_NO_THROW(resizeOp(stream, imgSrc, imgDst, NVCV_INTERP_NEAREST));
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetAutotuneEnabled(0));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    std::vector<uint8_t> testVec(outReqs.strides[0] * outReqs.shape[0]), goldVec(testVec.size());
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), dstData->basePtr(), testVec.size(), cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(goldVec.data(), goldData->basePtr(), goldVec.size(), cudaMemcpyDeviceToHost));
+    EXPECT_EQ(testVec, goldVec);
+
+    // the tuned selection round-trips through a cache file
+    std::string path = (std::filesystem::temp_directory_path() / "cvcuda_test_tuning_cache.txt").string();
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSaveTuningCache(path.c_str()));
+
+    std::ifstream     in(path);
+    std::stringstream cache;
+    cache << in.rdbuf();
+    EXPECT_NE(std::string::npos, cache.str().find("|resize_nn,"));
+
+    EXPECT_EQ(NVCV_SUCCESS, cvcudaLoadTuningCache(path.c_str()));
+    std::filesystem::remove(path);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaLoadTuningCache(path.c_str()));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaLoadTuningCache(nullptr));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpResize, estimate_scales_with_size)
+{
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGB8;
+
+    nvcv::Tensor::Requirements inReqs    = nvcv::Tensor::CalcRequirements(4, {640, 480}, fmt);
+    nvcv::Tensor::Requirements smallReqs = nvcv::Tensor::CalcRequirements(4, {320, 240}, fmt);
+    nvcv::Tensor::Requirements largeReqs = nvcv::Tensor::CalcRequirements(4, {1280, 960}, fmt);
+
+    NVCVOperatorEstimate small = cvcuda::Resize::estimate(inReqs, smallReqs, NVCV_INTERP_LINEAR);
+    NVCVOperatorEstimate large = cvcuda::Resize::estimate(inReqs, largeReqs, NVCV_INTERP_LINEAR);
+
+    EXPECT_EQ(0, small.workspaceBytes);
+    // the whole input is read, and the output written
+    EXPECT_EQ(4 * 640 * 480 * 3 + 4 * 320 * 240 * 3, small.bytesMoved);
+    EXPECT_EQ(4 * 640 * 480 * 3 + 4 * 1280 * 960 * 3, large.bytesMoved);
+    EXPECT_GT(small.gpuTimeMs, 0);
+    EXPECT_GT(large.gpuTimeMs, small.gpuTimeMs);
+
+    // configurations that can't be planned can't be estimated either
+    NVCVOperatorEstimate estimate;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaResizeEstimate(&inReqs, &smallReqs,
+                                                                static_cast<NVCVInterpolationType>(-1), &estimate));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaResizeEstimate(&inReqs, nullptr, NVCV_INTERP_LINEAR, &estimate));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaResizeEstimate(&inReqs, &smallReqs, NVCV_INTERP_LINEAR, nullptr));
+}
+
+TEST(OpResize, area_integer_factor)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    const int srcWidth = 128, srcHeight = 96, numberOfImages = 2;
+
+    nvcv::Tensor imgSrc = test::CreateTensor(numberOfImages, srcWidth, srcHeight, fmt);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    int                  srcVecRowStride = srcWidth * fmt.planePixelStrideBytes(0);
+    std::vector<uint8_t> srcVec(numberOfImages * srcHeight * srcVecRowStride);
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(),
+                                            srcVec.data() + i * srcHeight * srcVecRowStride, srcVecRowStride,
+                                            srcVecRowStride, srcHeight, cudaMemcpyHostToDevice));
+    }
+
+    cvcuda::Resize resizeOp;
+
+    // 2x and 4x have their own kernels, 3x goes through the generic integer path
+    for (int factor : {2, 3, 4})
+    {
+        SCOPED_TRACE(factor);
+
+        const int dstWidth = srcWidth / factor, dstHeight = srcHeight / factor;
+
+        nvcv::Tensor imgDst = test::CreateTensor(numberOfImages, dstWidth, dstHeight, fmt);
+        EXPECT_NO_THROW(resizeOp(stream, imgSrc, imgDst, NVCV_INTERP_AREA));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+        ASSERT_NE(nullptr, dstData);
+        auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+        ASSERT_TRUE(dstAccess);
+
+        int dstVecRowStride = dstWidth * fmt.planePixelStrideBytes(0);
+        for (int i = 0; i < numberOfImages; ++i)
+        {
+            SCOPED_TRACE(i);
+
+            std::vector<uint8_t> testVec(dstHeight * dstVecRowStride);
+            ASSERT_EQ(cudaSuccess,
+                      cudaMemcpy2D(testVec.data(), dstVecRowStride, dstAccess->sampleData(i), dstAccess->rowStride(),
+                                   dstVecRowStride, dstHeight, cudaMemcpyDeviceToHost));
+
+            std::vector<uint8_t> sampleVec(srcVec.begin() + i * srcHeight * srcVecRowStride,
+                                           srcVec.begin() + (i + 1) * srcHeight * srcVecRowStride);
+            std::vector<uint8_t> goldVec(dstHeight * dstVecRowStride);
+            Resize(goldVec, dstVecRowStride, {dstWidth, dstHeight}, sampleVec, srcVecRowStride, {srcWidth, srcHeight},
+                   fmt, NVCV_INTERP_AREA);
+
+            // float accumulation of non power-of-2 boxes may round differently than the gold
+            int maeThreshold = factor == 3 ? 1 : 0;
+            for (size_t k = 0; k < testVec.size(); ++k)
+            {
+                ASSERT_LE(abs(static_cast<int>(goldVec[k]) - static_cast<int>(testVec[k])), maeThreshold) << k;
+            }
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpResize, pyramid_matches_resize)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    nvcv::Tensor imgSrc = test::CreateTensor(2, 160, 120, fmt);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    test::SetTensorToRandomValue<uint8_t>(srcData, 0, 255);
+
+    cvcuda::Resize resizeOp;
+
+    // sizes dividing the input get a single launch with area interpolation, the 3rd level doesn't
+    for (const std::vector<nvcv::Size2D> &sizes :
+         {std::vector<nvcv::Size2D>{{80, 60}, {40, 30}, {20, 15}, {10, 5}},
+          std::vector<nvcv::Size2D>{{80, 60}, {40, 30}, {33, 17}}})
+    {
+        for (NVCVInterpolationType interpolation : {NVCV_INTERP_AREA, NVCV_INTERP_LINEAR})
+        {
+            SCOPED_TRACE(interpolation);
+
+            std::vector<std::unique_ptr<nvcv::Tensor>> levels, golds;
+            std::vector<nvcv::ITensor *>               levelPtrs;
+            for (const nvcv::Size2D &size : sizes)
+            {
+                levels.emplace_back(std::make_unique<nvcv::Tensor>(2, size, fmt));
+                golds.emplace_back(std::make_unique<nvcv::Tensor>(2, size, fmt));
+                levelPtrs.push_back(levels.back().get());
+            }
+
+            EXPECT_NO_THROW(resizeOp.pyramid(stream, imgSrc, levelPtrs.data(), levels.size(), interpolation));
+            for (std::unique_ptr<nvcv::Tensor> &gold : golds)
+            {
+                EXPECT_NO_THROW(resizeOp(stream, imgSrc, *gold, interpolation));
+            }
+            ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+            for (size_t l = 0; l < levels.size(); ++l)
+            {
+                SCOPED_TRACE(l);
+
+                const auto *testData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(levels[l]->exportData());
+                const auto *goldData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(golds[l]->exportData());
+                ASSERT_NE(nullptr, testData);
+                ASSERT_NE(nullptr, goldData);
+
+                std::vector<uint8_t> testVec(testData->stride(0) * testData->shape(0)), goldVec(testVec.size());
+                ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), testData->basePtr(), testVec.size(),
+                                                  cudaMemcpyDeviceToHost));
+                ASSERT_EQ(cudaSuccess, cudaMemcpy(goldVec.data(), goldData->basePtr(), goldVec.size(),
+                                                  cudaMemcpyDeviceToHost));
+                EXPECT_EQ(testVec, goldVec);
+            }
+        }
+    }
+
+    // levels must have the input's data type
+    nvcv::Tensor   imgF32 = test::CreateTensor(2, 80, 60, nvcv::FMT_RGBAf32);
+    nvcv::ITensor *bad[]  = {&imgF32};
+    EXPECT_THROW(resizeOp.pyramid(stream, imgSrc, bad, 1, NVCV_INTERP_AREA), nvcv::Exception);
+    EXPECT_THROW(resizeOp.pyramid(stream, imgSrc, bad, 0, NVCV_INTERP_AREA), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpResize, multi_output_correct_output)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    const int srcWidth = 96, srcHeight = 72, numberOfImages = 2;
+
+    nvcv::Tensor imgSrc = test::CreateTensor(numberOfImages, srcWidth, srcHeight, fmt);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    int                               srcVecRowStride = srcWidth * fmt.planePixelStrideBytes(0);
+    std::vector<std::vector<uint8_t>> srcVec(numberOfImages);
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        srcVec[i].resize(srcHeight * srcVecRowStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return rand(randEng); });
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(),
+                                            srcVecRowStride, srcVecRowStride, srcHeight, cudaMemcpyHostToDevice));
+    }
+
+    // downscale and upscale with every interpolation, area with an integer factor to have a gold result
+    const std::vector<nvcv::Size2D> sizes = {
+        {48, 36},
+        {33, 25},
+        {20, 15},
+        {24, 18},
+        {150, 97}
+    };
+    const std::vector<NVCVInterpolationType> interpolations
+        = {NVCV_INTERP_LINEAR, NVCV_INTERP_CUBIC, NVCV_INTERP_NEAREST, NVCV_INTERP_AREA, NVCV_INTERP_LINEAR};
+
+    std::vector<std::unique_ptr<nvcv::Tensor>> outputs;
+    std::vector<nvcv::ITensor *>               outputPtrs;
+    for (const nvcv::Size2D &size : sizes)
+    {
+        outputs.emplace_back(std::make_unique<nvcv::Tensor>(numberOfImages, size, fmt));
+        outputPtrs.push_back(outputs.back().get());
+    }
+
+    cvcuda::Resize resizeOp;
+    EXPECT_NO_THROW(resizeOp(stream, imgSrc, outputPtrs.data(), interpolations.data(), outputs.size()));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    for (size_t o = 0; o < outputs.size(); ++o)
+    {
+        SCOPED_TRACE(o);
+
+        const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(outputs[o]->exportData());
+        ASSERT_NE(nullptr, dstData);
+        auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+        ASSERT_TRUE(dstAccess);
+
+        const nvcv::Size2D size            = sizes[o];
+        int                dstVecRowStride = size.w * fmt.planePixelStrideBytes(0);
+        for (int i = 0; i < numberOfImages; ++i)
+        {
+            SCOPED_TRACE(i);
+
+            std::vector<uint8_t> testVec(size.h * dstVecRowStride);
+            ASSERT_EQ(cudaSuccess,
+                      cudaMemcpy2D(testVec.data(), dstVecRowStride, dstAccess->sampleData(i), dstAccess->rowStride(),
+                                   dstVecRowStride, size.h, cudaMemcpyDeviceToHost));
+
+            std::vector<uint8_t> goldVec(size.h * dstVecRowStride);
+            Resize(goldVec, dstVecRowStride, size, srcVec[i], srcVecRowStride, {srcWidth, srcHeight}, fmt,
+                   interpolations[o]);
+
+            for (size_t k = 0; k < testVec.size(); ++k)
+            {
+                ASSERT_LE(abs(static_cast<int>(goldVec[k]) - static_cast<int>(testVec[k])), 1) << k;
+            }
+        }
+    }
+
+    // outputs must have the input's data type
+    nvcv::Tensor                imgF32 = test::CreateTensor(numberOfImages, 48, 36, nvcv::FMT_RGBAf32);
+    nvcv::ITensor              *bad[]  = {outputPtrs[0], &imgF32};
+    const NVCVInterpolationType badInterp[] = {NVCV_INTERP_LINEAR, NVCV_INTERP_LINEAR};
+    EXPECT_THROW(resizeOp(stream, imgSrc, bad, badInterp, 2), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpResize, varshape_multi_output_matches_resize)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    const int numberOfImages = 3;
+
+    std::default_random_engine         randEng;
+    std::uniform_int_distribution<int> rndWidth(60, 140);
+    std::uniform_int_distribution<int> rndHeight(40, 100);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{rndWidth(randEng), rndHeight(randEng)}, fmt));
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc.back()->exportData());
+        ASSERT_NE(nullptr, srcData);
+
+        int                  srcRowStride = srcData->plane(0).width * fmt.planePixelStrideBytes(0);
+        std::vector<uint8_t> srcVec(srcData->plane(0).height * srcRowStride);
+
+        std::uniform_int_distribution<uint8_t> rand(0, 255);
+        std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec.data(), srcRowStride,
+                               srcRowStride, srcData->plane(0).height, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numberOfImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    const std::vector<NVCVInterpolationType> interpolations
+        = {NVCV_INTERP_LINEAR, NVCV_INTERP_NEAREST, NVCV_INTERP_CUBIC, NVCV_INTERP_AREA};
+
+    std::vector<std::unique_ptr<nvcv::Image>>              imgDst, imgGold;
+    std::vector<std::unique_ptr<nvcv::ImageBatchVarShape>> batchDst, batchGold;
+    std::vector<nvcv::IImageBatchVarShape *>               batchDstPtrs;
+    for (size_t o = 0; o < interpolations.size(); ++o)
+    {
+        batchDst.emplace_back(std::make_unique<nvcv::ImageBatchVarShape>(numberOfImages));
+        batchGold.emplace_back(std::make_unique<nvcv::ImageBatchVarShape>(numberOfImages));
+        batchDstPtrs.push_back(batchDst.back().get());
+
+        for (int i = 0; i < numberOfImages; ++i)
+        {
+            nvcv::Size2D size{rndWidth(randEng), rndHeight(randEng)};
+            imgDst.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+            imgGold.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+            batchDst.back()->pushBack(*imgDst.back());
+            batchGold.back()->pushBack(*imgGold.back());
+        }
+    }
+
+    cvcuda::Resize resizeOp;
+    EXPECT_NO_THROW(resizeOp(stream, batchSrc, batchDstPtrs.data(), interpolations.data(), batchDstPtrs.size()));
+    for (size_t o = 0; o < interpolations.size(); ++o)
+    {
+        EXPECT_NO_THROW(resizeOp(stream, batchSrc, *batchGold[o], interpolations[o]));
+    }
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    for (size_t k = 0; k < imgDst.size(); ++k)
+    {
+        SCOPED_TRACE(k);
+
+        const auto *testData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[k]->exportData());
+        const auto *goldData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgGold[k]->exportData());
+        ASSERT_NE(nullptr, testData);
+        ASSERT_NE(nullptr, goldData);
+
+        int                  rowStride = testData->plane(0).width * fmt.planePixelStrideBytes(0);
+        std::vector<uint8_t> testVec(testData->plane(0).height * rowStride), goldVec(testVec.size());
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), rowStride, testData->plane(0).basePtr,
+                                            testData->plane(0).rowStride, rowStride, testData->plane(0).height,
+                                            cudaMemcpyDeviceToHost));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(goldVec.data(), rowStride, goldData->plane(0).basePtr,
+                                            goldData->plane(0).rowStride, rowStride, goldData->plane(0).height,
+                                            cudaMemcpyDeviceToHost));
+
+        // the single operator uses the 4 pixel per thread kernels, which sum in a different order
+        for (size_t j = 0; j < testVec.size(); ++j)
+        {
+            ASSERT_LE(abs(static_cast<int>(goldVec[j]) - static_cast<int>(testVec[j])), 1) << j;
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpResize, varshape_sparse_batch_matches_multi_output)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    // one large image next to small ones, the batch covers a small part of the grid of the large one
+    const std::vector<nvcv::Size2D> srcSizes = {{20, 16}, {300, 220}, {18, 14}, {22, 20}};
+    const std::vector<nvcv::Size2D> dstSizes = {{24, 12}, {256, 200}, {12, 30}, {33, 17}};
+
+    std::default_random_engine randEng;
+
+    nvcv::ImageBatchVarShape                  batchSrc(srcSizes.size());
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    for (nvcv::Size2D size : srcSizes)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc.back()->exportData());
+        ASSERT_NE(nullptr, srcData);
+
+        int                  srcRowStride = size.w * fmt.planePixelStrideBytes(0);
+        std::vector<uint8_t> srcVec(size.h * srcRowStride);
+
+        std::uniform_int_distribution<uint8_t> rand(0, 255);
+        std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec.data(),
+                                            srcRowStride, srcRowStride, size.h, cudaMemcpyHostToDevice));
+        batchSrc.pushBack(*imgSrc.back());
+    }
+
+    nvcv::ImageBatchVarShape                  batchDst(dstSizes.size()), batchGold(dstSizes.size());
+    std::vector<std::unique_ptr<nvcv::Image>> imgDst, imgGold;
+    for (nvcv::Size2D size : dstSizes)
+    {
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+        imgGold.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+        batchDst.pushBack(*imgDst.back());
+        batchGold.pushBack(*imgGold.back());
+    }
+
+    cvcuda::Resize resizeOp;
+
+    for (NVCVInterpolationType interpolation :
+         {NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR, NVCV_INTERP_CUBIC, NVCV_INTERP_AREA})
+    {
+        SCOPED_TRACE(interpolation);
+
+        // a single output of the multi-output operator uses the same per-pixel math on a regular grid
+        nvcv::IImageBatchVarShape *goldPtr = &batchGold;
+        EXPECT_NO_THROW(resizeOp(stream, batchSrc, batchDst, interpolation));
+        EXPECT_NO_THROW(resizeOp(stream, batchSrc, &goldPtr, &interpolation, 1));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        for (size_t k = 0; k < imgDst.size(); ++k)
+        {
+            SCOPED_TRACE(k);
+
+            const auto *testData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[k]->exportData());
+            const auto *goldData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgGold[k]->exportData());
+            ASSERT_NE(nullptr, testData);
+            ASSERT_NE(nullptr, goldData);
+
+            int                  rowStride = dstSizes[k].w * fmt.planePixelStrideBytes(0);
+            std::vector<uint8_t> testVec(dstSizes[k].h * rowStride), goldVec(testVec.size());
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), rowStride, testData->plane(0).basePtr,
+                                                testData->plane(0).rowStride, rowStride, dstSizes[k].h,
+                                                cudaMemcpyDeviceToHost));
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(goldVec.data(), rowStride, goldData->plane(0).basePtr,
+                                                goldData->plane(0).rowStride, rowStride, dstSizes[k].h,
+                                                cudaMemcpyDeviceToHost));
+            EXPECT_EQ(testVec, goldVec);
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpResize, varshape_launch_budget_matches_unlimited)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    const std::vector<nvcv::Size2D> srcSizes = {{640, 480}, {300, 220}, {1280, 720}};
+    const std::vector<nvcv::Size2D> dstSizes = {{512, 384}, {256, 200}, {960, 540}};
+
+    std::default_random_engine randEng;
+
+    nvcv::ImageBatchVarShape                  batchSrc(srcSizes.size());
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    for (nvcv::Size2D size : srcSizes)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc.back()->exportData());
+        ASSERT_NE(nullptr, srcData);
+
+        int                  srcRowStride = size.w * fmt.planePixelStrideBytes(0);
+        std::vector<uint8_t> srcVec(size.h * srcRowStride);
+
+        std::uniform_int_distribution<uint8_t> rand(0, 255);
+        std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec.data(),
+                                            srcRowStride, srcRowStride, size.h, cudaMemcpyHostToDevice));
+        batchSrc.pushBack(*imgSrc.back());
+    }
+
+    nvcv::ImageBatchVarShape                  batchDst(dstSizes.size()), batchGold(dstSizes.size());
+    std::vector<std::unique_ptr<nvcv::Image>> imgDst, imgGold;
+    for (nvcv::Size2D size : dstSizes)
+    {
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+        imgGold.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+        batchDst.pushBack(*imgDst.back());
+        batchGold.pushBack(*imgGold.back());
+    }
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaSetLaunchBudget(-1));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaGetLaunchBudget(nullptr));
+
+    cvcuda::Resize resizeOp;
+
+    for (NVCVInterpolationType interpolation : {NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR, NVCV_INTERP_AREA})
+    {
+        SCOPED_TRACE(interpolation);
+
+        // a single SM makes each block of the persistent grid go over many tiles
+        EXPECT_NO_THROW(resizeOp(stream, batchSrc, batchGold, interpolation));
+        ASSERT_EQ(NVCV_SUCCESS, cvcudaSetThreadLaunchBudget(1));
+        EXPECT_NO_THROW(resizeOp(stream, batchSrc, batchDst, interpolation));
+
+        int32_t budget = 0;
+        EXPECT_EQ(NVCV_SUCCESS, cvcudaGetLaunchBudget(&budget));
+        EXPECT_EQ(1, budget);
+
+        ASSERT_EQ(NVCV_SUCCESS, cvcudaSetThreadLaunchBudget(-1));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        for (size_t k = 0; k < imgDst.size(); ++k)
+        {
+            SCOPED_TRACE(k);
+
+            const auto *testData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[k]->exportData());
+            const auto *goldData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgGold[k]->exportData());
+            ASSERT_NE(nullptr, testData);
+            ASSERT_NE(nullptr, goldData);
+
+            int                  rowStride = dstSizes[k].w * fmt.planePixelStrideBytes(0);
+            std::vector<uint8_t> testVec(dstSizes[k].h * rowStride), goldVec(testVec.size());
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), rowStride, testData->plane(0).basePtr,
+                                                testData->plane(0).rowStride, rowStride, dstSizes[k].h,
+                                                cudaMemcpyDeviceToHost));
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(goldVec.data(), rowStride, goldData->plane(0).basePtr,
+                                                goldData->plane(0).rowStride, rowStride, dstSizes[k].h,
+                                                cudaMemcpyDeviceToHost));
+            // the persistent grid uses the generic per-pixel math, which may round differently than the 4 pixels
+            // per thread kernels
+            std::vector<int> mae(testVec.size());
+            for (size_t i = 0; i < mae.size(); ++i)
+            {
+                mae[i] = abs(static_cast<int>(goldVec[i]) - static_cast<int>(testVec[i]));
+            }
+            EXPECT_THAT(mae, t::Each(t::Le(1)));
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
 TEST_P(OpResize, varshape_correct_output)
 {
     cudaStream_t stream;
@@ -380,3 +1171,457 @@ TEST_P(OpResize, varshape_correct_output)
         EXPECT_THAT(mae, t::Each(t::Le(maeThreshold)));
     }
 }
+
+TEST(OpResize, channel_order_matches_reordered_input)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGB8;
+
+    const int srcWidth = 90, srcHeight = 60, dstWidth = 60, dstHeight = 40, numberOfImages = 2;
+
+    int srcVecRowStride = srcWidth * fmt.planePixelStrideBytes(0);
+    int dstVecRowStride = dstWidth * fmt.planePixelStrideBytes(0);
+
+    // BGR input, and the same input already converted to RGB
+    std::vector<uint8_t> bgrVec(numberOfImages * srcHeight * srcVecRowStride);
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+    std::generate(bgrVec.begin(), bgrVec.end(), [&]() { return rand(randEng); });
+
+    std::vector<uint8_t> rgbVec(bgrVec.size());
+    for (size_t k = 0; k < bgrVec.size(); k += 3)
+    {
+        rgbVec[k + 0] = bgrVec[k + 2];
+        rgbVec[k + 1] = bgrVec[k + 1];
+        rgbVec[k + 2] = bgrVec[k + 0];
+    }
+
+    nvcv::Tensor bgrSrc = test::CreateTensor(numberOfImages, srcWidth, srcHeight, fmt);
+    nvcv::Tensor rgbSrc = test::CreateTensor(numberOfImages, srcWidth, srcHeight, fmt);
+
+    for (auto [tensor, vec] : {std::pair{&bgrSrc, &bgrVec}, std::pair{&rgbSrc, &rgbVec}})
+    {
+        const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor->exportData());
+        ASSERT_NE(nullptr, srcData);
+        auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+        ASSERT_TRUE(srcAccess);
+        for (int i = 0; i < numberOfImages; ++i)
+        {
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(),
+                                                vec->data() + i * srcHeight * srcVecRowStride, srcVecRowStride,
+                                                srcVecRowStride, srcHeight, cudaMemcpyHostToDevice));
+        }
+    }
+
+    auto download = [&](nvcv::Tensor &tensor, std::vector<uint8_t> &dst)
+    {
+        const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+        ASSERT_NE(nullptr, dstData);
+        auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+        ASSERT_TRUE(dstAccess);
+        dst.resize(numberOfImages * dstHeight * dstVecRowStride);
+        for (int i = 0; i < numberOfImages; ++i)
+        {
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(dst.data() + i * dstHeight * dstVecRowStride, dstVecRowStride,
+                                                dstAccess->sampleData(i), dstAccess->rowStride(), dstVecRowStride,
+                                                dstHeight, cudaMemcpyDeviceToHost));
+        }
+    };
+
+    cvcuda::Resize resizeOp;
+
+    for (NVCVInterpolationType interp : {NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR, NVCV_INTERP_CUBIC, NVCV_INTERP_AREA})
+    {
+        SCOPED_TRACE(interp);
+
+        nvcv::Tensor testDst = test::CreateTensor(numberOfImages, dstWidth, dstHeight, fmt);
+        nvcv::Tensor goldDst = test::CreateTensor(numberOfImages, dstWidth, dstHeight, fmt);
+
+        EXPECT_NO_THROW(resizeOp(stream, bgrSrc, testDst, interp, NVCV_SWIZZLE_ZYXW));
+        EXPECT_NO_THROW(resizeOp(stream, rgbSrc, goldDst, interp));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        std::vector<uint8_t> testVec, goldVec;
+        download(testDst, testVec);
+        download(goldDst, goldVec);
+
+        // the reordering kernels may accumulate in a different order than the ones picked for the plain resize
+        for (size_t k = 0; k < testVec.size(); ++k)
+        {
+            ASSERT_LE(abs(static_cast<int>(goldVec[k]) - static_cast<int>(testVec[k])), 1) << k;
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpResize, half_output_matches_float_resize)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int srcWidth = 61, srcHeight = 47, numberOfImages = 2, channels = 3;
+
+    // The same input as 8-bit and float, the float resize is the reference of the half output
+    nvcv::Tensor srcU8 = test::CreateTensor(numberOfImages, srcWidth, srcHeight, nvcv::FMT_RGB8);
+    nvcv::Tensor srcF32({{numberOfImages, srcHeight, srcWidth, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+
+    auto srcU8Access  = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcU8.exportData());
+    auto srcF32Access = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcF32.exportData());
+    ASSERT_TRUE(srcU8Access);
+    ASSERT_TRUE(srcF32Access);
+
+    std::default_random_engine         randEng;
+    std::uniform_int_distribution<int> rand(0, 255);
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        std::vector<uint8_t> u8Vec(srcU8Access->sampleStride());
+        std::vector<float>   f32Vec(srcF32Access->sampleStride() / sizeof(float));
+        for (int y = 0; y < srcHeight; ++y)
+        {
+            for (int x = 0; x < srcWidth * channels; ++x)
+            {
+                uint8_t val = rand(randEng);
+                u8Vec[y * srcU8Access->rowStride() + x]                    = val;
+                f32Vec[y * srcF32Access->rowStride() / sizeof(float) + x] = val;
+            }
+        }
+        ASSERT_NO_THROW(test::SetTensorFromVector<uint8_t>(srcU8.exportData(), u8Vec, i));
+        ASSERT_NO_THROW(test::SetTensorFromVector<float>(srcF32.exportData(), f32Vec, i));
+    }
+
+    cvcuda::Resize resizeOp;
+
+    for (nvcv::Size2D dstSize : {nvcv::Size2D{40, 30}, nvcv::Size2D{90, 70}})
+    {
+        for (NVCVInterpolationType interp :
+             {NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR, NVCV_INTERP_CUBIC, NVCV_INTERP_AREA})
+        {
+            SCOPED_TRACE(interp);
+            SCOPED_TRACE(dstSize.w);
+
+            nvcv::TensorShape dstShape({numberOfImages, dstSize.h, dstSize.w, channels}, nvcv::TENSOR_NHWC);
+
+            nvcv::Tensor dstF16(dstShape, nvcv::TYPE_F16);
+            nvcv::Tensor dstF32(dstShape, nvcv::TYPE_F32);
+
+            EXPECT_NO_THROW(resizeOp(stream, srcU8, dstF16, interp));
+            EXPECT_NO_THROW(resizeOp(stream, srcF32, dstF32, interp));
+            ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+            auto f16Access = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstF16.exportData());
+            auto f32Access = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstF32.exportData());
+            ASSERT_TRUE(f16Access);
+            ASSERT_TRUE(f32Access);
+
+            for (int i = 0; i < numberOfImages; ++i)
+            {
+                std::vector<uint16_t> testVec;
+                std::vector<float>    goldVec;
+                ASSERT_NO_THROW(test::GetVectorFromTensor<uint16_t>(dstF16.exportData(), i, testVec));
+                ASSERT_NO_THROW(test::GetVectorFromTensor<float>(dstF32.exportData(), i, goldVec));
+
+                for (int y = 0; y < dstSize.h; ++y)
+                {
+                    for (int x = 0; x < dstSize.w * channels; ++x)
+                    {
+                        float gold = goldVec[y * f32Access->rowStride() / sizeof(float) + x];
+                        float result = __half2float(
+                            __half_raw{testVec[y * f16Access->rowStride() / sizeof(uint16_t) + x]});
+
+                        // the float kernels may accumulate in another order, then rounding to half takes an ULP
+                        ASSERT_NEAR(gold, result, std::abs(gold) / 1024.f + 1e-3f) << "at y " << y << ", x " << x;
+                    }
+                }
+            }
+        }
+    }
+
+    // channels can't be reordered into half outputs
+    nvcv::Tensor dstF16({{numberOfImages, srcHeight, srcWidth, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F16);
+    EXPECT_THROW(resizeOp(stream, srcU8, dstF16, NVCV_INTERP_LINEAR, NVCV_SWIZZLE_ZYXW), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpResize, varshape_per_sample_interpolation_matches_resize)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    std::default_random_engine         randEng;
+    std::uniform_int_distribution<int> rndWidth(80, 140);
+    std::uniform_int_distribution<int> rndHeight(64, 100);
+
+    // upscaled with cubic, downscaled 8x with linear, slightly upscaled with nearest, halved with area
+    const std::vector<NVCVInterpolationType> interpolations
+        = {NVCV_INTERP_CUBIC, NVCV_INTERP_LINEAR, NVCV_INTERP_NEAREST, NVCV_INTERP_AREA};
+    const int numberOfImages = interpolations.size();
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst;
+    nvcv::ImageBatchVarShape                  batchSrc(numberOfImages), batchDst(numberOfImages);
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        nvcv::Size2D srcSize{rndWidth(randEng), rndHeight(randEng)};
+        nvcv::Size2D dstSize[] = {
+            {srcSize.w * 2, srcSize.h * 2},
+            {srcSize.w / 8, srcSize.h / 8},
+            {srcSize.w + 7, srcSize.h + 3},
+            {srcSize.w / 2, srcSize.h / 2}
+        };
+
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(srcSize, fmt));
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(dstSize[i], fmt));
+        batchSrc.pushBack(*imgSrc.back());
+        batchDst.pushBack(*imgDst.back());
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc.back()->exportData());
+        ASSERT_NE(nullptr, srcData);
+
+        int                  srcRowStride = srcSize.w * fmt.planePixelStrideBytes(0);
+        std::vector<uint8_t> srcVec(srcSize.h * srcRowStride);
+
+        std::uniform_int_distribution<uint8_t> rand(0, 255);
+        std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride, srcVec.data(),
+                                            srcRowStride, srcRowStride, srcSize.h, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::Tensor interpTensor({{numberOfImages}, "N"}, nvcv::TYPE_S32);
+    const auto  *interpData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(interpTensor.exportData());
+    ASSERT_NE(nullptr, interpData);
+    std::vector<int32_t> interpVec(interpolations.begin(), interpolations.end());
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(interpData->basePtr(), interpVec.data(), interpVec.size() * sizeof(int32_t),
+                                      cudaMemcpyHostToDevice));
+
+    cvcuda::Resize resizeOp;
+
+    for (bool antialias : {false, true})
+    {
+        SCOPED_TRACE(antialias);
+
+        EXPECT_NO_THROW(resizeOp(stream, batchSrc, batchDst, interpTensor, antialias));
+
+        for (int i = 0; i < numberOfImages; ++i)
+        {
+            SCOPED_TRACE(i);
+
+            // gold resizes the sample alone, antialiasing turns the downscales into area
+            NVCVInterpolationType interp = interpolations[i];
+            if (antialias && (i == 1 || i == 3))
+            {
+                interp = NVCV_INTERP_AREA;
+            }
+
+            nvcv::Image              imgGold(imgDst[i]->size(), fmt);
+            nvcv::ImageBatchVarShape batchOne(1), batchGold(1);
+            batchOne.pushBack(*imgSrc[i]);
+            batchGold.pushBack(imgGold);
+            EXPECT_NO_THROW(resizeOp(stream, batchOne, batchGold, interp));
+            ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+            const auto *testData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[i]->exportData());
+            const auto *goldData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgGold.exportData());
+            ASSERT_NE(nullptr, testData);
+            ASSERT_NE(nullptr, goldData);
+
+            int                  rowStride = testData->plane(0).width * fmt.planePixelStrideBytes(0);
+            std::vector<uint8_t> testVec(testData->plane(0).height * rowStride), goldVec(testVec.size());
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), rowStride, testData->plane(0).basePtr,
+                                                testData->plane(0).rowStride, rowStride, testData->plane(0).height,
+                                                cudaMemcpyDeviceToHost));
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(goldVec.data(), rowStride, goldData->plane(0).basePtr,
+                                                goldData->plane(0).rowStride, rowStride, goldData->plane(0).height,
+                                                cudaMemcpyDeviceToHost));
+
+            // the single operator uses the 4 pixel per thread kernels, which sum in a different order
+            for (size_t j = 0; j < testVec.size(); ++j)
+            {
+                ASSERT_LE(abs(static_cast<int>(goldVec[j]) - static_cast<int>(testVec[j])), 1) << j;
+            }
+        }
+    }
+
+    nvcv::Tensor shortTensor({{numberOfImages - 1}, "N"}, nvcv::TYPE_S32);
+    EXPECT_THROW(resizeOp(stream, batchSrc, batchDst, shortTensor, false), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpResize, varshape_nv12_resizes_planes)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_NV12;
+
+    const std::vector<nvcv::Size2D> srcSizes = {{192, 108}, {64, 48}};
+    const std::vector<nvcv::Size2D> dstSizes = {{64, 36}, {96, 72}};
+
+    const uint8_t chroma[2] = {90, 200};
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+
+    // random luma and a uniform chroma plane, which every interpolation must keep uniform whatever the siting
+    nvcv::ImageBatchVarShape                  batchSrc(srcSizes.size());
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    std::vector<std::vector<uint8_t>>         lumaSrc;
+    for (nvcv::Size2D size : srcSizes)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+
+        const auto *srcData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc.back()->exportData());
+        ASSERT_NE(nullptr, srcData);
+        ASSERT_EQ(2, srcData->numPlanes());
+
+        lumaSrc.emplace_back(size.w * size.h);
+        std::generate(lumaSrc.back().begin(), lumaSrc.back().end(), [&]() { return rand(randEng); });
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(0).basePtr, srcData->plane(0).rowStride,
+                                            lumaSrc.back().data(), size.w, size.w, size.h, cudaMemcpyHostToDevice));
+
+        std::vector<uint8_t> uvVec(size.w * (size.h / 2));
+        for (size_t i = 0; i < uvVec.size(); ++i) uvVec[i] = chroma[i % 2];
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->plane(1).basePtr, srcData->plane(1).rowStride, uvVec.data(),
+                                            size.w, size.w, size.h / 2, cudaMemcpyHostToDevice));
+        batchSrc.pushBack(*imgSrc.back());
+    }
+
+    nvcv::ImageBatchVarShape                  batchDst(dstSizes.size());
+    std::vector<std::unique_ptr<nvcv::Image>> imgDst;
+    for (nvcv::Size2D size : dstSizes)
+    {
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+        batchDst.pushBack(*imgDst.back());
+    }
+
+    cvcuda::Resize resizeOp;
+
+    for (NVCVInterpolationType interpolation : {NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR, NVCV_INTERP_AREA})
+    {
+        SCOPED_TRACE(interpolation);
+
+        EXPECT_NO_THROW(resizeOp(stream, batchSrc, batchDst, interpolation));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        for (size_t k = 0; k < imgDst.size(); ++k)
+        {
+            SCOPED_TRACE(k);
+
+            const nvcv::Size2D dst = dstSizes[k], src = srcSizes[k];
+
+            const auto *testData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[k]->exportData());
+            ASSERT_NE(nullptr, testData);
+
+            std::vector<uint8_t> uvVec(dst.w * (dst.h / 2));
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(uvVec.data(), dst.w, testData->plane(1).basePtr,
+                                                testData->plane(1).rowStride, dst.w, dst.h / 2,
+                                                cudaMemcpyDeviceToHost));
+            for (size_t i = 0; i < uvVec.size(); ++i)
+            {
+                ASSERT_EQ(chroma[i % 2], uvVec[i]) << "at " << i;
+            }
+
+            if (interpolation == NVCV_INTERP_NEAREST)
+            {
+                std::vector<uint8_t> lumaVec(dst.w * dst.h), goldVec(lumaVec.size());
+                ASSERT_EQ(cudaSuccess, cudaMemcpy2D(lumaVec.data(), dst.w, testData->plane(0).basePtr,
+                                                    testData->plane(0).rowStride, dst.w, dst.h,
+                                                    cudaMemcpyDeviceToHost));
+                for (int y = 0; y < dst.h; ++y)
+                {
+                    for (int x = 0; x < dst.w; ++x)
+                    {
+                        int sx = std::min<int>(std::floor(x * ((float)src.w / dst.w)), src.w - 1);
+                        int sy = std::min<int>(std::floor(y * ((float)src.h / dst.h)), src.h - 1);
+
+                        goldVec[y * dst.w + x] = lumaSrc[k][sy * src.w + sx];
+                    }
+                }
+                EXPECT_EQ(goldVec, lumaVec);
+            }
+        }
+    }
+
+    // bicubic isn't supported for multi-plane images
+    EXPECT_THROW(resizeOp(stream, batchSrc, batchDst, NVCV_INTERP_CUBIC), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpResize, varshape_skips_inactive_samples)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const std::vector<nvcv::Size2D> srcSizes = {{64, 48}, {32, 30}, {50, 20}};
+    const std::vector<nvcv::Size2D> dstSizes = {{30, 20}, {64, 60}, {25, 40}};
+
+    auto fill = [](nvcv::Image &img, uint8_t value)
+    {
+        const auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(img.exportData());
+        ASSERT_NE(nullptr, data);
+        ASSERT_EQ(cudaSuccess, cudaMemset2D(data->plane(0).basePtr, data->plane(0).rowStride, value,
+                                            img.size().w * 3, img.size().h));
+    };
+
+    auto isFilledWith = [](nvcv::Image &img, uint8_t value)
+    {
+        const auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(img.exportData());
+        EXPECT_NE(nullptr, data);
+
+        std::vector<uint8_t> vec(img.size().w * 3 * img.size().h);
+        EXPECT_EQ(cudaSuccess, cudaMemcpy2D(vec.data(), img.size().w * 3, data->plane(0).basePtr,
+                                            data->plane(0).rowStride, img.size().w * 3, img.size().h,
+                                            cudaMemcpyDeviceToHost));
+        return std::all_of(vec.begin(), vec.end(), [value](uint8_t v) { return v == value; });
+    };
+
+    nvcv::ImageBatchVarShape                  batchSrc(srcSizes.size()), batchDst(dstSizes.size());
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst;
+    for (size_t i = 0; i < srcSizes.size(); ++i)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(srcSizes[i], nvcv::FMT_RGB8));
+        fill(*imgSrc.back(), 10);
+        batchSrc.pushBack(*imgSrc.back());
+
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(dstSizes[i], nvcv::FMT_RGB8));
+        fill(*imgDst.back(), 77);
+        batchDst.pushBack(*imgDst.back());
+    }
+
+    nvcv::Tensor mask({{(int64_t)dstSizes.size()}, "N"}, nvcv::TYPE_U8);
+    const auto  *maskData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(mask.exportData());
+    ASSERT_NE(nullptr, maskData);
+
+    const uint8_t flags[3] = {1, 0, 1};
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(maskData->basePtr(), flags, sizeof(flags), cudaMemcpyHostToDevice));
+    ASSERT_NO_THROW(batchDst.setActiveMask(&mask));
+
+    cvcuda::Resize resizeOp;
+    EXPECT_NO_THROW(resizeOp(stream, batchSrc, batchDst, NVCV_INTERP_LINEAR));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    EXPECT_TRUE(isFilledWith(*imgDst[0], 10));
+    EXPECT_TRUE(isFilledWith(*imgDst[1], 77));
+    EXPECT_TRUE(isFilledWith(*imgDst[2], 10));
+
+    // flags are read when the operator runs
+    ASSERT_EQ(cudaSuccess, cudaMemset(maskData->basePtr(), 1, sizeof(flags)));
+    EXPECT_NO_THROW(resizeOp(stream, batchSrc, batchDst, NVCV_INTERP_LINEAR));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_TRUE(isFilledWith(*imgDst[1], 10));
+
+    nvcv::Tensor tooSmall({{1}, "N"}, nvcv::TYPE_U8);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeSetActiveMask(batchDst.handle(), tooSmall.handle()));
+
+    ASSERT_NO_THROW(batchDst.setActiveMask(nullptr));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
@@ -0,0 +1,587 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpResizeNormalizeReformat.hpp>
+#include <nvcv/Image.hpp>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+struct HostParams
+{
+    // [numSamples][numChannels], numSamples and numChannels are either 1 or the same as the data.
+    std::vector<std::vector<float>> base, scale;
+};
+
+// Resizes one packed HWC sample the same way as cvcuda::Resize, without rounding,
+// normalizes it, optionally swaps R and B and writes it as planar CHW.
+template<typename T>
+void ResizeNormalizeReformat(std::vector<float> &hDst, nvcv::Size2D dstSize, const std::vector<T> &hSrc,
+                             nvcv::Size2D srcSize, int channels, int sample, const HostParams &params,
+                             NVCVInterpolationType interp, float globalScale, float globalShift, float epsilon,
+                             uint32_t flags)
+{
+    auto at = [&](int y, int x, int c)
+    {
+        return static_cast<float>(hSrc[(y * srcSize.w + x) * channels + c]);
+    };
+
+    const float scaleX = static_cast<float>(srcSize.w) / dstSize.w;
+    const float scaleY = static_cast<float>(srcSize.h) / dstSize.h;
+
+    const bool swapRB = (flags & CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB) != 0;
+
+    for (int y = 0; y < dstSize.h; ++y)
+    {
+        for (int x = 0; x < dstSize.w; ++x)
+        {
+            for (int c = 0; c < channels; ++c)
+            {
+                float value;
+
+                if (interp == NVCV_INTERP_NEAREST)
+                {
+                    int sx = std::min(static_cast<int>(std::floor(x * scaleX)), srcSize.w - 1);
+                    int sy = std::min(static_cast<int>(std::floor(y * scaleY)), srcSize.h - 1);
+                    value  = at(sy, sx, c);
+                }
+                else
+                {
+                    float fy = (y + 0.5f) * scaleY - 0.5f;
+                    int   sy = static_cast<int>(std::floor(fy));
+                    fy -= sy;
+                    fy *= (sy >= 0 && sy < srcSize.h - 1);
+                    sy = std::max(0, std::min(sy, srcSize.h - 2));
+
+                    float fx = (x + 0.5f) * scaleX - 0.5f;
+                    int   sx = static_cast<int>(std::floor(fx));
+                    fx -= sx;
+                    fx *= (sx >= 0 && sx < srcSize.w - 1);
+                    sx = std::max(0, std::min(sx, srcSize.w - 2));
+
+                    int sy1 = std::min(sy + 1, srcSize.h - 1);
+                    int sx1 = std::min(sx + 1, srcSize.w - 1);
+
+                    value = (1.f - fx) * (at(sy, sx, c) * (1.f - fy) + at(sy1, sx, c) * fy)
+                          + fx * (at(sy, sx1, c) * (1.f - fy) + at(sy1, sx1, c) * fy);
+                }
+
+                int dc = (swapRB && c < 3) ? 2 - c : c;
+
+                const auto &base  = params.base[params.base.size() == 1 ? 0 : sample];
+                const auto &scale = params.scale[params.scale.size() == 1 ? 0 : sample];
+
+                float b = base[base.size() == 1 ? 0 : dc];
+                float s = scale[scale.size() == 1 ? 0 : dc];
+
+                if (flags & CVCUDA_NORMALIZE_SCALE_IS_STDDEV)
+                {
+                    s = 1.f / std::sqrt(s * s + epsilon);
+                }
+
+                hDst[(dc * dstSize.h + y) * dstSize.w + x] = (value - b) * s * globalScale + globalShift;
+            }
+        }
+    }
+}
+
+// Converts the ROI of one YUV 4:2:0 semi-planar sample to packed RGB float, with the
+// same BT.601 coefficients as cvcuda::CvtColor, but without rounding.
+template<typename T>
+std::vector<float> YUV420spToRGB(const std::vector<T> &hLuma, const std::vector<T> &hChroma, int width,
+                                 const NVCVRectI &roi, int uidx)
+{
+    const float norm = 1.f / (1 << (8 * (sizeof(T) - 1)));
+
+    std::vector<float> rgb(roi.width * roi.height * 3);
+    for (int y = 0; y < roi.height; ++y)
+    {
+        for (int x = 0; x < roi.width; ++x)
+        {
+            int sx = roi.x + x, sy = roi.y + y;
+
+            const T *uv = &hChroma[(sy / 2) * width + (sx & ~1)];
+
+            float yy = std::max(0.f, hLuma[sy * width + sx] * norm - 16.f) * 1.164f;
+            float uu = uv[uidx] * norm - 128.f;
+            float vv = uv[uidx ^ 1] * norm - 128.f;
+
+            float *out = &rgb[(y * roi.width + x) * 3];
+            out[0]     = std::clamp(yy + 1.596f * vv, 0.f, 255.f);
+            out[1]     = std::clamp(yy - 0.813f * vv - 0.391f * uu, 0.f, 255.f);
+            out[2]     = std::clamp(yy + 2.018f * uu, 0.f, 255.f);
+        }
+    }
+    return rgb;
+}
+
+nvcv::ImageFormat ParamFormat(int channels)
+{
+    return channels == 1 ? nvcv::FMT_F32 : (channels == 3 ? nvcv::FMT_RGBf32 : nvcv::FMT_RGBAf32);
+}
+
+// Fills a [N,1,1,C] float parameter tensor with random values.
+void FillParam(nvcv::Tensor &param, float minValue, float maxValue, std::vector<std::vector<float>> &hParam,
+               std::default_random_engine &rng)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(param.exportData());
+    ASSERT_NE(nullptr, data);
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    ASSERT_TRUE(access);
+
+    int numSamples = access->numSamples();
+    int channels   = access->numChannels();
+
+    std::uniform_real_distribution<float> udist(minValue, maxValue);
+
+    hParam.resize(numSamples);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        hParam[i].resize(channels);
+        std::generate(hParam[i].begin(), hParam[i].end(), [&]() { return udist(rng); });
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(access->sampleData(i), hParam[i].data(), channels * sizeof(float),
+                                          cudaMemcpyHostToDevice));
+    }
+}
+
+void CheckOutput(nvcv::Tensor &imgDst, const std::vector<std::vector<float>> &goldVec)
+{
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, dstData);
+
+    int planeSize = dstData->shape(2) * dstData->shape(3);
+    int channels  = dstData->shape(1);
+
+    for (size_t i = 0; i < goldVec.size(); ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<float> testVec(channels * planeSize);
+
+        for (int c = 0; c < channels; ++c)
+        {
+            ASSERT_EQ(cudaSuccess,
+                      cudaMemcpy2D(testVec.data() + c * planeSize, dstData->shape(3) * sizeof(float),
+                                   dstData->basePtr() + i * dstData->stride(0) + c * dstData->stride(1),
+                                   dstData->stride(2), dstData->shape(3) * sizeof(float), dstData->shape(2),
+                                   cudaMemcpyDeviceToHost));
+        }
+
+        for (size_t k = 0; k < testVec.size(); ++k)
+        {
+            ASSERT_NEAR(goldVec[i][k], testVec[k], 1e-3f * std::max(1.f, std::abs(goldVec[i][k]))) << "at " << k;
+        }
+    }
+}
+
+} // namespace
+
+static uint32_t normalScale   = 0;
+static uint32_t scaleIsStdDev = CVCUDA_NORMALIZE_SCALE_IS_STDDEV;
+static uint32_t swapRB        = CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB;
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpResizeNormalizeReformat, test::ValueList<int, int, int, int, int, nvcv::ImageFormat, NVCVInterpolationType, bool, uint32_t>
+{
+    // srcWidth, srcHeight, dstWidth, dstHeight, numImages,            format,        interpolation, perSample,                  flags
+    {        42,        31,       21,        15,         1,   nvcv::FMT_RGB8,  NVCV_INTERP_NEAREST,     false,            normalScale },
+    {        42,        31,       21,        15,         2,   nvcv::FMT_RGB8,   NVCV_INTERP_LINEAR,     false,            normalScale },
+    {        13,        17,       64,        48,         3,   nvcv::FMT_RGB8,   NVCV_INTERP_LINEAR,      true,                 swapRB },
+    {       128,        96,       32,        32,         2,  nvcv::FMT_RGBA8,   NVCV_INTERP_LINEAR,      true,          scaleIsStdDev },
+    {        77,        33,       77,        33,         4,  nvcv::FMT_RGBA8,  NVCV_INTERP_NEAREST,     false, scaleIsStdDev | swapRB },
+    {        50,        60,       25,        80,         2,     nvcv::FMT_U8,   NVCV_INTERP_LINEAR,      true,            normalScale },
+    {         1,        40,       10,        20,         1,     nvcv::FMT_U8,   NVCV_INTERP_LINEAR,     false,          scaleIsStdDev }
+});
+
+// clang-format on
+
+TEST_P(OpResizeNormalizeReformat, tensor_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int                   srcWidth  = GetParamValue<0>();
+    int                   srcHeight = GetParamValue<1>();
+    int                   dstWidth  = GetParamValue<2>();
+    int                   dstHeight = GetParamValue<3>();
+    int                   numImages = GetParamValue<4>();
+    nvcv::ImageFormat     fmt       = GetParamValue<5>();
+    NVCVInterpolationType interp    = GetParamValue<6>();
+    bool                  perSample = GetParamValue<7>();
+    uint32_t              flags     = GetParamValue<8>();
+
+    const float globalScale = 1.f / 255;
+    const float globalShift = 0.5f;
+    const float epsilon     = 0.01f;
+
+    int channels = fmt.numChannels();
+
+    std::default_random_engine rng;
+
+    // Create input tensor
+    nvcv::Tensor imgSrc  = test::CreateTensor(numImages, srcWidth, srcHeight, fmt);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    std::vector<std::vector<uint8_t>> srcVec(numImages);
+    int                               srcVecRowStride = srcWidth * channels;
+    for (int i = 0; i < numImages; ++i)
+    {
+        std::uniform_int_distribution<int> udist(0, 255);
+
+        srcVec[i].resize(srcHeight * srcVecRowStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return udist(rng); });
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(),
+                                            srcVecRowStride, srcVecRowStride, srcHeight, cudaMemcpyHostToDevice));
+    }
+
+    HostParams   params;
+    nvcv::Tensor imgBase(perSample ? numImages : 1, {1, 1}, ParamFormat(channels));
+    nvcv::Tensor imgScale(perSample ? numImages : 1, {1, 1}, nvcv::FMT_F32);
+    FillParam(imgBase, 0.f, 255.f, params.base, rng);
+    FillParam(imgScale, 0.5f, 2.f, params.scale, rng);
+
+    nvcv::Tensor imgDst({{numImages, channels, dstHeight, dstWidth}, nvcv::TENSOR_NCHW}, nvcv::TYPE_F32);
+
+    cvcuda::ResizeNormalizeReformat op;
+    EXPECT_NO_THROW(op(stream, imgSrc, imgBase, imgScale, imgDst, interp, globalScale, globalShift, epsilon, flags));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<std::vector<float>> goldVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        goldVec[i].resize(channels * dstWidth * dstHeight);
+        ResizeNormalizeReformat(goldVec[i], {dstWidth, dstHeight}, srcVec[i], {srcWidth, srcHeight}, channels, i,
+                                params, interp, globalScale, globalShift, epsilon, flags);
+    }
+
+    CheckOutput(imgDst, goldVec);
+}
+
+TEST_P(OpResizeNormalizeReformat, varshape_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int                   srcWidth  = GetParamValue<0>();
+    int                   srcHeight = GetParamValue<1>();
+    int                   dstWidth  = GetParamValue<2>();
+    int                   dstHeight = GetParamValue<3>();
+    int                   numImages = GetParamValue<4>();
+    nvcv::ImageFormat     fmt       = GetParamValue<5>();
+    NVCVInterpolationType interp    = GetParamValue<6>();
+    bool                  perSample = GetParamValue<7>();
+    uint32_t              flags     = GetParamValue<8>();
+
+    const float globalScale = 1.f / 255;
+    const float globalShift = 0.5f;
+    const float epsilon     = 0.01f;
+
+    int channels = fmt.numChannels();
+
+    std::default_random_engine rng;
+
+    // Create input varshape, each image with its own size
+
+    std::uniform_int_distribution<int> udistWidth(std::max(1, srcWidth / 2), srcWidth * 1.5);
+    std::uniform_int_distribution<int> udistHeight(std::max(1, srcHeight / 2), srcHeight * 1.5);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc;
+    std::vector<std::vector<uint8_t>>         srcVec(numImages);
+
+    for (int i = 0; i < numImages; ++i)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{udistWidth(rng), udistHeight(rng)}, fmt));
+
+        int srcRowStride = imgSrc[i]->size().w * channels;
+
+        std::uniform_int_distribution<int> udist(0, 255);
+
+        srcVec[i].resize(imgSrc[i]->size().h * srcRowStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return udist(rng); });
+
+        auto *imgData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+        ASSERT_NE(nullptr, imgData);
+
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy2D(imgData->plane(0).basePtr, imgData->plane(0).rowStride, srcVec[i].data(), srcRowStride,
+                               srcRowStride, imgSrc[i]->size().h, cudaMemcpyHostToDevice));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(numImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    HostParams   params;
+    nvcv::Tensor imgBase(1, {1, 1}, ParamFormat(channels));
+    nvcv::Tensor imgScale(perSample ? numImages : 1, {1, 1}, ParamFormat(channels));
+    FillParam(imgBase, 0.f, 255.f, params.base, rng);
+    FillParam(imgScale, 0.5f, 2.f, params.scale, rng);
+
+    nvcv::Tensor imgDst({{numImages, channels, dstHeight, dstWidth}, nvcv::TENSOR_NCHW}, nvcv::TYPE_F32);
+
+    cvcuda::ResizeNormalizeReformat op;
+    EXPECT_NO_THROW(op(stream, batchSrc, imgBase, imgScale, imgDst, interp, globalScale, globalShift, epsilon, flags));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<std::vector<float>> goldVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        goldVec[i].resize(channels * dstWidth * dstHeight);
+        ResizeNormalizeReformat(goldVec[i], {dstWidth, dstHeight}, srcVec[i], imgSrc[i]->size(), channels, i, params,
+                                interp, globalScale, globalShift, epsilon, flags);
+    }
+
+    CheckOutput(imgDst, goldVec);
+}
+
+TEST(OpResizeNormalizeReformat, invalid_output_layout_is_rejected)
+{
+    nvcv::Tensor imgSrc(1, {16, 16}, nvcv::FMT_RGB8);
+    nvcv::Tensor imgBase(1, {1, 1}, nvcv::FMT_F32);
+    nvcv::Tensor imgScale(1, {1, 1}, nvcv::FMT_F32);
+    nvcv::Tensor imgDst(1, {8, 8}, nvcv::FMT_RGBf32);
+
+    cvcuda::ResizeNormalizeReformat op;
+    EXPECT_THROW(op(nullptr, imgSrc, imgBase, imgScale, imgDst, NVCV_INTERP_LINEAR, 1.f, 0.f, 0.f), nvcv::Exception);
+}
+
+TEST(OpResizeNormalizeReformat, quantized_output_matches_float_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int numImages = 2, channels = 3, dstWidth = 24, dstHeight = 20;
+
+    // Signed int8 quantization with scale 1/127 and zero point 0, folded into the global scale and shift
+    const float globalScale = 127.f / 255;
+    const float globalShift = -10.f;
+
+    std::default_random_engine rng;
+
+    nvcv::Tensor imgSrc  = test::CreateTensor(numImages, 37, 29, nvcv::FMT_RGB8);
+    const auto  *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+
+    std::vector<uint8_t>               srcVec(srcData->stride(0) * numImages);
+    std::uniform_int_distribution<int> udist(0, 255);
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return udist(rng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), srcVec.size(), cudaMemcpyHostToDevice));
+
+    HostParams   params;
+    nvcv::Tensor imgBase(1, {1, 1}, nvcv::FMT_RGBf32);
+    nvcv::Tensor imgScale(1, {1, 1}, nvcv::FMT_F32);
+    FillParam(imgBase, 0.f, 64.f, params.base, rng);
+    FillParam(imgScale, 0.5f, 1.5f, params.scale, rng);
+
+    nvcv::TensorShape dstShape{{numImages, channels, dstHeight, dstWidth}, nvcv::TENSOR_NCHW};
+    nvcv::Tensor      imgFloat(dstShape, nvcv::TYPE_F32);
+    nvcv::Tensor      imgQuant(dstShape, nvcv::TYPE_S8);
+
+    cvcuda::ResizeNormalizeReformat op;
+    EXPECT_NO_THROW(
+        op(stream, imgSrc, imgBase, imgScale, imgFloat, NVCV_INTERP_LINEAR, globalScale, globalShift, 0.f));
+    EXPECT_NO_THROW(
+        op(stream, imgSrc, imgBase, imgScale, imgQuant, NVCV_INTERP_LINEAR, globalScale, globalShift, 0.f));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    const auto *floatData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgFloat.exportData());
+    const auto *quantData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgQuant.exportData());
+    ASSERT_NE(nullptr, floatData);
+    ASSERT_NE(nullptr, quantData);
+
+    const int rows = numImages * channels * dstHeight;
+
+    std::vector<float>  floatVec(rows * dstWidth);
+    std::vector<int8_t> quantVec(rows * dstWidth);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(floatVec.data(), dstWidth * sizeof(float), floatData->basePtr(),
+                                        floatData->stride(2), dstWidth * sizeof(float), rows, cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(quantVec.data(), dstWidth, quantData->basePtr(), quantData->stride(2),
+                                        dstWidth, rows, cudaMemcpyDeviceToHost));
+
+    for (size_t k = 0; k < floatVec.size(); ++k)
+    {
+        float gold = std::clamp(std::round(floatVec[k]), -128.f, 127.f);
+        ASSERT_NEAR(gold, quantVec[k], 1.f) << "at " << k;
+    }
+}
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpResizeNormalizeReformatNV12, test::ValueList<int, int, int, int, int, nvcv::DataType, bool, NVCVColorConversionCode, NVCVInterpolationType, int, int, int, int, uint32_t>
+{
+    // width, height, dstWidth, dstHeight, numImages,          dtype, packedChroma,                     code,        interpolation, roiX, roiY, roiWidth, roiHeight,                  flags
+    {      64,     32,       32,        32,         2, nvcv::TYPE_U8,        false,  NVCV_COLOR_YUV2RGB_NV12,   NVCV_INTERP_LINEAR,    0,    0,        0,         0,            normalScale },
+    {      42,     30,       64,        48,         1, nvcv::TYPE_U8,         true,  NVCV_COLOR_YUV2BGR_NV12,   NVCV_INTERP_LINEAR,    3,    5,       21,        17,            normalScale },
+    {      40,     40,       13,        11,         3, nvcv::TYPE_U8,        false,  NVCV_COLOR_YUV2RGB_NV21,  NVCV_INTERP_NEAREST,    1,    0,       38,        39,                 swapRB },
+    {      96,     54,       48,        27,         2, nvcv::TYPE_U16,       false,  NVCV_COLOR_YUV2RGB_NV12,   NVCV_INTERP_LINEAR,    0,    0,        0,         0,          scaleIsStdDev },
+    {      24,     16,       30,        20,         1, nvcv::TYPE_U16,        true,  NVCV_COLOR_YUV2BGR_NV21,  NVCV_INTERP_NEAREST,    4,    2,       16,        12, scaleIsStdDev | swapRB }
+});
+
+// clang-format on
+
+TEST_P(OpResizeNormalizeReformatNV12, tensor_correct_output)
+{
+    cudaStream_t stream;
+    EXPECT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int                     width        = GetParamValue<0>();
+    int                     height       = GetParamValue<1>();
+    int                     dstWidth     = GetParamValue<2>();
+    int                     dstHeight    = GetParamValue<3>();
+    int                     numImages    = GetParamValue<4>();
+    nvcv::DataType          dtype        = GetParamValue<5>();
+    bool                    packedChroma = GetParamValue<6>();
+    NVCVColorConversionCode code         = GetParamValue<7>();
+    NVCVInterpolationType   interp       = GetParamValue<8>();
+    uint32_t                flags        = GetParamValue<13>();
+
+    NVCVRectI roi{GetParamValue<9>(), GetParamValue<10>(), GetParamValue<11>(), GetParamValue<12>()};
+
+    const float globalScale = 1.f / 255;
+    const float globalShift = 0.5f;
+    const float epsilon     = 0.01f;
+
+    const bool is16bit = dtype == nvcv::TYPE_U16;
+    const int  uidx    = code == NVCV_COLOR_YUV2RGB_NV21 || code == NVCV_COLOR_YUV2BGR_NV21;
+    const bool bgr     = code == NVCV_COLOR_YUV2BGR_NV12 || code == NVCV_COLOR_YUV2BGR_NV21;
+
+    std::default_random_engine rng;
+
+    // Interleaved chroma is stored either as [N, H/2, W/2, 2] or as [N, H/2, W, 1].
+    nvcv::Tensor imgLuma({{numImages, height, width, 1}, nvcv::TENSOR_NHWC}, dtype);
+    nvcv::Tensor imgChroma = packedChroma
+                               ? nvcv::Tensor({{numImages, height / 2, width, 1}, nvcv::TENSOR_NHWC}, dtype)
+                               : nvcv::Tensor({{numImages, height / 2, width / 2, 2}, nvcv::TENSOR_NHWC}, dtype);
+
+    std::vector<std::vector<uint16_t>> lumaVec(numImages), chromaVec(numImages);
+
+    for (auto [tensor, hostVec, rows] : {std::make_tuple(&imgLuma, &lumaVec, height),
+                                         std::make_tuple(&imgChroma, &chromaVec, height / 2)})
+    {
+        const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor->exportData());
+        ASSERT_NE(nullptr, data);
+
+        std::uniform_int_distribution<int> udist(0, is16bit ? 65535 : 255);
+
+        int rowSize = width * (is16bit ? 2 : 1);
+        for (int i = 0; i < numImages; ++i)
+        {
+            (*hostVec)[i].resize(rows * width);
+            std::generate((*hostVec)[i].begin(), (*hostVec)[i].end(), [&]() { return udist(rng); });
+
+            std::vector<uint8_t> bytes(rows * rowSize);
+            for (size_t k = 0; k < (*hostVec)[i].size(); ++k)
+            {
+                if (is16bit)
+                {
+                    reinterpret_cast<uint16_t *>(bytes.data())[k] = (*hostVec)[i][k];
+                }
+                else
+                {
+                    bytes[k] = static_cast<uint8_t>((*hostVec)[i][k]);
+                }
+            }
+
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(data->basePtr() + i * data->stride(0), data->stride(1), bytes.data(),
+                                                rowSize, rowSize, rows, cudaMemcpyHostToDevice));
+        }
+    }
+
+    HostParams   params;
+    nvcv::Tensor imgBase(numImages, {1, 1}, nvcv::FMT_RGBf32);
+    nvcv::Tensor imgScale(1, {1, 1}, nvcv::FMT_RGBf32);
+    FillParam(imgBase, 0.f, 255.f, params.base, rng);
+    FillParam(imgScale, 0.5f, 2.f, params.scale, rng);
+
+    nvcv::Tensor imgDst({{numImages, 3, dstHeight, dstWidth}, nvcv::TENSOR_NCHW}, nvcv::TYPE_F32);
+
+    cvcuda::ResizeNormalizeReformat op;
+    EXPECT_NO_THROW(op(stream, imgLuma, imgChroma, &roi, imgBase, imgScale, imgDst, code, interp, globalScale,
+                       globalShift, epsilon, flags));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    NVCVRectI fullRoi = roi.width == 0 && roi.height == 0 ? NVCVRectI{0, 0, width, height} : roi;
+
+    std::vector<std::vector<float>> goldVec(numImages);
+    for (int i = 0; i < numImages; ++i)
+    {
+        std::vector<float> rgb
+            = is16bit ? YUV420spToRGB(lumaVec[i], chromaVec[i], width, fullRoi, uidx)
+                      : YUV420spToRGB(std::vector<uint8_t>(lumaVec[i].begin(), lumaVec[i].end()),
+                                      std::vector<uint8_t>(chromaVec[i].begin(), chromaVec[i].end()), width, fullRoi,
+                                      uidx);
+
+        goldVec[i].resize(3 * dstWidth * dstHeight);
+        ResizeNormalizeReformat(goldVec[i], {dstWidth, dstHeight}, rgb, {fullRoi.width, fullRoi.height}, 3, i, params,
+                                interp, globalScale, globalShift, epsilon,
+                                bgr ? flags ^ CVCUDA_RESIZE_NORMALIZE_REFORMAT_SWAP_RB : flags);
+    }
+
+    CheckOutput(imgDst, goldVec);
+}
+
+TEST(OpResizeNormalizeReformatNV12, invalid_arguments_are_rejected)
+{
+    nvcv::Tensor imgLuma({{1, 16, 16, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor imgChroma({{1, 8, 8, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor imgOddChroma({{1, 7, 8, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor imgBase(1, {1, 1}, nvcv::FMT_F32);
+    nvcv::Tensor imgScale(1, {1, 1}, nvcv::FMT_F32);
+    nvcv::Tensor imgDst({{1, 3, 8, 8}, nvcv::TENSOR_NCHW}, nvcv::TYPE_F32);
+
+    NVCVRectI outsideRoi{10, 0, 8, 8};
+
+    cvcuda::ResizeNormalizeReformat op;
+    EXPECT_NO_THROW(op(nullptr, imgLuma, imgChroma, nullptr, imgBase, imgScale, imgDst, NVCV_COLOR_YUV2RGB_NV12,
+                       NVCV_INTERP_LINEAR, 1.f, 0.f, 0.f));
+    EXPECT_THROW(op(nullptr, imgLuma, imgOddChroma, nullptr, imgBase, imgScale, imgDst, NVCV_COLOR_YUV2RGB_NV12,
+                    NVCV_INTERP_LINEAR, 1.f, 0.f, 0.f),
+                 nvcv::Exception);
+    EXPECT_THROW(op(nullptr, imgLuma, imgChroma, &outsideRoi, imgBase, imgScale, imgDst, NVCV_COLOR_YUV2RGB_NV12,
+                    NVCV_INTERP_LINEAR, 1.f, 0.f, 0.f),
+                 nvcv::Exception);
+    EXPECT_THROW(op(nullptr, imgLuma, imgChroma, nullptr, imgBase, imgScale, imgDst, NVCV_COLOR_YUV2RGB_IYUV,
+                    NVCV_INTERP_LINEAR, 1.f, 0.f, 0.f),
+                 nvcv::Exception);
+
+    EXPECT_EQ(cudaSuccess, cudaDeviceSynchronize());
+}
@@ -351,7 +351,7 @@ TEST_P(OpRotate, varshape_correct_output)
     auto shiftTensorDataAccess = nvcv::TensorDataAccessStrided::Create(*shiftTensorData);
     ASSERT_TRUE(shiftTensorDataAccess);
 
-    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst;
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst, imgDstHost;
     std::vector<double>                       angleDegVecs;
     std::vector<double2>                      shiftVecs;
 
@@ -364,6 +364,8 @@ TEST_P(OpRotate, varshape_correct_output)
 
         imgDst.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{tmpWidth, tmpHeight}, fmt));
 
+        imgDstHost.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{tmpWidth, tmpHeight}, fmt));
+
         double2 shift    = {-1, -1};
         double  angleDeg = i == 0 ? angleDegBase : rndAngle(randEng);
         if (i != 0 && interpolation == NVCV_INTERP_CUBIC)
@@ -396,6 +398,9 @@ TEST_P(OpRotate, varshape_correct_output)
     nvcv::ImageBatchVarShape batchDst(numberOfImages);
     batchDst.pushBack(imgDst.begin(), imgDst.end());
 
+    nvcv::ImageBatchVarShape batchDstHost(numberOfImages);
+    batchDstHost.pushBack(imgDstHost.begin(), imgDstHost.end());
+
     std::vector<std::vector<uint8_t>> srcVec(numberOfImages);
     std::vector<int>                  srcVecRowStride(numberOfImages);
 
@@ -430,6 +435,11 @@ TEST_P(OpRotate, varshape_correct_output)
     // Generate test result
     cvcuda::Rotate rotateOp(numberOfImages);
     EXPECT_NO_THROW(rotateOp(stream, batchSrc, batchDst, angleDegTensor, shiftTensor, interpolation));
+    if (numberOfImages <= CVCUDA_MAX_HOST_PARAM_SAMPLES)
+    {
+        EXPECT_NO_THROW(
+            rotateOp(stream, batchSrc, batchDstHost, angleDegVecs.data(), shiftVecs.data(), interpolation));
+    }
 
     // Get test data back
     EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
@@ -470,5 +480,375 @@ TEST_P(OpRotate, varshape_correct_output)
                         fmt, angleDegVecs[i], shiftVecs[i], interpolation);
 
         EXPECT_EQ(goldVec, testVec);
+
+        if (numberOfImages <= CVCUDA_MAX_HOST_PARAM_SAMPLES)
+        {
+            const auto *dstHostData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDstHost[i]->exportData());
+            assert(dstHostData->numPlanes() == 1);
+
+            std::vector<uint8_t> testHostVec(dstHeight * dstRowStride);
+            ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testHostVec.data(), dstRowStride, dstHostData->plane(0).basePtr,
+                                                dstHostData->plane(0).rowStride, dstRowStride, dstHeight,
+                                                cudaMemcpyDeviceToHost));
+
+            EXPECT_EQ(goldVec, testHostVec);
+        }
+    }
+}
+
+TEST(OpRotate_HostParams, batch_over_limit_is_rejected)
+{
+    const int numberOfImages = CVCUDA_MAX_HOST_PARAM_SAMPLES + 1;
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst;
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{8, 8}, nvcv::FMT_U8));
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{8, 8}, nvcv::FMT_U8));
     }
+
+    nvcv::ImageBatchVarShape batchSrc(numberOfImages);
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    nvcv::ImageBatchVarShape batchDst(numberOfImages);
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+
+    std::vector<double>  angleDeg(numberOfImages, 0);
+    std::vector<double2> shift(numberOfImages, double2{0, 0});
+
+    cvcuda::Rotate rotateOp(numberOfImages);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaRotateVarShapeSubmitHostParams(rotateOp.handle(), 0, batchSrc.handle(), batchDst.handle(),
+                                                   angleDeg.data(), shift.data(), NVCV_INTERP_NEAREST));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaRotateVarShapeSubmitHostParams(rotateOp.handle(), 0, batchSrc.handle(), batchDst.handle(), nullptr,
+                                                   shift.data(), NVCV_INTERP_NEAREST));
+}
+
+TEST(OpRotate_Workspace, requirements_cover_varshape_batch)
+{
+    cvcuda::Rotate rotateOpDouble(4, NVCV_COORD_PRECISION_DOUBLE);
+    cvcuda::Rotate rotateOpFloat(4, NVCV_COORD_PRECISION_FLOAT);
+
+    NVCVOperatorWorkspaceRequirements reqs = rotateOpDouble.workspaceRequirements();
+    EXPECT_GE(reqs.cudaMemSize, static_cast<int64_t>(6 * sizeof(double) * 4));
+    EXPECT_GT(reqs.cudaMemAlignment, 0);
+
+    reqs = rotateOpFloat.workspaceRequirements();
+    EXPECT_GE(reqs.cudaMemSize, static_cast<int64_t>(6 * sizeof(float) * 4));
+    EXPECT_GT(reqs.cudaMemAlignment, 0);
+}
+
+TEST(OpRotate_Workspace, too_small_workspace_is_rejected)
+{
+    cvcuda::Rotate rotateOp(4);
+
+    NVCVOperatorWorkspaceRequirements reqs = rotateOp.workspaceRequirements();
+
+    void *workspace = nullptr;
+    ASSERT_EQ(cudaSuccess, cudaMalloc(&workspace, reqs.cudaMemSize));
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcvOperatorSetWorkspace(rotateOp.handle(), workspace, reqs.cudaMemSize - 1));
+    EXPECT_EQ(NVCV_SUCCESS, nvcvOperatorSetWorkspace(rotateOp.handle(), workspace, reqs.cudaMemSize));
+    EXPECT_EQ(NVCV_SUCCESS, nvcvOperatorSetWorkspace(rotateOp.handle(), nullptr, 0));
+
+    EXPECT_EQ(cudaSuccess, cudaFree(workspace));
+}
+
+TEST(OpRotate_Workspace, reserve_before_execution)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::Rotate rotateOp(4);
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvOperatorReserveWorkspace(nullptr, stream));
+    EXPECT_NO_THROW(rotateOp.reserveWorkspace(stream));
+    // Reserving again, or with a workspace set by user, does nothing
+    EXPECT_NO_THROW(rotateOp.reserveWorkspace(stream));
+
+    void *workspace = nullptr;
+    ASSERT_EQ(cudaSuccess, cudaMalloc(&workspace, rotateOp.workspaceRequirements().cudaMemSize));
+    ASSERT_NO_THROW(rotateOp.setWorkspace(workspace, rotateOp.workspaceRequirements().cudaMemSize));
+    EXPECT_NO_THROW(rotateOp.reserveWorkspace(stream));
+    ASSERT_NO_THROW(rotateOp.setWorkspace(nullptr, 0));
+
+    // Operators without workspace accept it too
+    cvcuda::Rotate noWorkspaceOp(0);
+    EXPECT_NO_THROW(noWorkspaceOp.reserveWorkspace(stream));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+    EXPECT_EQ(cudaSuccess, cudaFree(workspace));
+}
+
+TEST(OpRotate_Workspace, shared_workspace_correct_output)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int               width  = 42;
+    const int               height = 31;
+    const nvcv::ImageFormat fmt    = nvcv::FMT_RGB8;
+
+    nvcv::Tensor imgSrc(1, {width, height}, fmt);
+    nvcv::Tensor imgTmp(1, {width, height}, fmt);
+    nvcv::Tensor imgDst(1, {width, height}, fmt);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    int                  rowStride = width * fmt.planePixelStrideBytes(0);
+    std::vector<uint8_t> srcVec(height * rowStride, 0);
+    assignCustomValuesInSrc(srcVec, width, height, rowStride);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(0), srcAccess->rowStride(), srcVec.data(), rowStride,
+                                        rowStride, height, cudaMemcpyHostToDevice));
+
+    cvcuda::Rotate rotateOp1(0), rotateOp2(0);
+
+    int64_t wsSize = std::max(rotateOp1.workspaceRequirements().cudaMemSize,
+                              rotateOp2.workspaceRequirements().cudaMemSize);
+    void   *workspace = nullptr;
+    ASSERT_EQ(cudaSuccess, cudaMalloc(&workspace, wsSize));
+
+    ASSERT_NO_THROW(rotateOp1.setWorkspace(workspace, wsSize));
+    ASSERT_NO_THROW(rotateOp2.setWorkspace(workspace, wsSize));
+
+    double angleDeg = 30, shiftX, shiftY;
+    compute_center_shift((width - 1) / 2, (height - 1) / 2, angleDeg, shiftX, shiftY);
+    double2 shift = {shiftX, shiftY};
+
+    // Operators sharing the workspace must not depend on each other's data.
+    EXPECT_NO_THROW(rotateOp1(stream, imgSrc, imgTmp, 90, double2{0, 0}, NVCV_INTERP_NEAREST));
+    EXPECT_NO_THROW(rotateOp2(stream, imgSrc, imgDst, angleDeg, shift, NVCV_INTERP_NEAREST));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, dstData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    std::vector<uint8_t> testVec(height * rowStride);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), rowStride, dstAccess->sampleData(0), dstAccess->rowStride(),
+                                        rowStride, height, cudaMemcpyDeviceToHost));
+
+    std::vector<uint8_t> goldVec(height * rowStride, 0);
+    Rotate<uint8_t>(goldVec, rowStride, {width, height}, srcVec, rowStride, {width, height}, fmt, angleDeg, shift,
+                    NVCV_INTERP_NEAREST);
+
+    EXPECT_EQ(goldVec, testVec);
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+    EXPECT_EQ(cudaSuccess, cudaFree(workspace));
+}
+
+TEST(OpRotate_Precision, invalid_precision_is_rejected)
+{
+    NVCVOperatorHandle handle;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaRotateCreateWithPrecision(&handle, 0, static_cast<NVCVCoordinatePrecision>(255)));
+}
+
+class OpRotate_Precision : public t::TestWithParam<NVCVInterpolationType>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(_, OpRotate_Precision,
+                         t::Values(NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR, NVCV_INTERP_CUBIC));
+
+TEST_P(OpRotate_Precision, float_matches_double)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const NVCVInterpolationType interpolation = GetParam();
+
+    const int               width = 641, height = 479, numberOfImages = 2;
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGB8;
+
+    nvcv::Tensor imgSrc(numberOfImages, {width, height}, fmt);
+    nvcv::Tensor imgDstFloat(numberOfImages, {width, height}, fmt);
+    nvcv::Tensor imgDstDouble(numberOfImages, {width, height}, fmt);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    ASSERT_NE(nullptr, srcData);
+
+    int64_t                            bufSize = srcData->stride(0) * numberOfImages;
+    std::vector<uint8_t>               srcVec(bufSize);
+    std::default_random_engine         rng(0);
+    std::uniform_int_distribution<int> rand(0, 255);
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(rng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), bufSize, cudaMemcpyHostToDevice));
+
+    const auto *dstFloatData  = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDstFloat.exportData());
+    const auto *dstDoubleData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDstDouble.exportData());
+    ASSERT_NE(nullptr, dstFloatData);
+    ASSERT_NE(nullptr, dstDoubleData);
+    ASSERT_EQ(cudaSuccess, cudaMemset(dstFloatData->basePtr(), 0, bufSize));
+    ASSERT_EQ(cudaSuccess, cudaMemset(dstDoubleData->basePtr(), 0, bufSize));
+
+    double angleDeg = 33.3, shiftX, shiftY;
+    compute_center_shift((width - 1) / 2, (height - 1) / 2, angleDeg, shiftX, shiftY);
+    double2 shift = {shiftX, shiftY};
+
+    cvcuda::Rotate rotateOpFloat(0, NVCV_COORD_PRECISION_FLOAT);
+    cvcuda::Rotate rotateOpDouble(0, NVCV_COORD_PRECISION_DOUBLE);
+
+    EXPECT_NO_THROW(rotateOpFloat(stream, imgSrc, imgDstFloat, angleDeg, shift, interpolation));
+    EXPECT_NO_THROW(rotateOpDouble(stream, imgSrc, imgDstDouble, angleDeg, shift, interpolation));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    std::vector<uint8_t> floatVec(bufSize), doubleVec(bufSize);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(floatVec.data(), dstFloatData->basePtr(), bufSize, cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(doubleVec.data(), dstDoubleData->basePtr(), bufSize, cudaMemcpyDeviceToHost));
+
+    // Coordinates differ by a few float ulps at most, which can only change the
+    // result of pixels falling right on a rounding boundary.
+    int64_t numMismatches = 0;
+    for (int64_t i = 0; i < bufSize; ++i)
+    {
+        numMismatches += std::abs(floatVec[i] - doubleVec[i]) > 1;
+    }
+    EXPECT_LE(numMismatches, bufSize / 1000);
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+class OpRotate_RightAngle : public t::TestWithParam<std::tuple<double, NVCVInterpolationType>>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(_, OpRotate_RightAngle,
+                         t::Combine(t::Values(0.0, 90.0, 180.0, 270.0, -90.0, 450.0),
+                                    t::Values(NVCV_INTERP_NEAREST, NVCV_INTERP_LINEAR, NVCV_INTERP_CUBIC)));
+
+// Right angles with integer shifts are exact whatever the interpolation, a non-square image turned by a quarter
+// turn lands entirely in an output of transposed size
+TEST_P(OpRotate_RightAngle, exact_rotation_of_whole_image)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const double                angleDeg      = std::get<0>(GetParam());
+    const NVCVInterpolationType interpolation = std::get<1>(GetParam());
+
+    const int               srcWidth = 97, srcHeight = 61, numberOfImages = 2;
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGB8;
+
+    const int quarterTurns = static_cast<int>(std::fmod(std::fmod(angleDeg / 90, 4) + 4, 4));
+    const int dstWidth     = quarterTurns % 2 ? srcHeight : srcWidth;
+    const int dstHeight    = quarterTurns % 2 ? srcWidth : srcHeight;
+
+    // shift bringing the rotated image back to the output origin
+    const double2 shifts[4] = {{0, 0}, {0, srcWidth - 1.0}, {srcWidth - 1.0, srcHeight - 1.0}, {srcHeight - 1.0, 0}};
+    const double2 shift = shifts[quarterTurns];
+
+    nvcv::Tensor imgSrc(numberOfImages, {srcWidth, srcHeight}, fmt);
+    nvcv::Tensor imgDst(numberOfImages, {dstWidth, dstHeight}, fmt);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, srcData);
+    ASSERT_NE(nullptr, dstData);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(srcAccess);
+    ASSERT_TRUE(dstAccess);
+
+    const int srcRowStride = srcWidth * 3, dstRowStride = dstWidth * 3;
+
+    std::default_random_engine         rng(0);
+    std::uniform_int_distribution<int> rand(0, 255);
+
+    std::vector<std::vector<uint8_t>> srcVec(numberOfImages, std::vector<uint8_t>(srcHeight * srcRowStride));
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return rand(rng); });
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(),
+                                            srcRowStride, srcRowStride, srcHeight, cudaMemcpyHostToDevice));
+    }
+
+    cvcuda::Rotate rotateOp(0);
+    EXPECT_NO_THROW(rotateOp(stream, imgSrc, imgDst, angleDeg, shift, interpolation));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> testVec(dstHeight * dstRowStride);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), dstRowStride, dstAccess->sampleData(i),
+                                            dstAccess->rowStride(), dstRowStride, dstHeight, cudaMemcpyDeviceToHost));
+
+        std::vector<uint8_t> goldVec(testVec.size());
+        for (int y = 0; y < dstHeight; ++y)
+        {
+            for (int x = 0; x < dstWidth; ++x)
+            {
+                const int dx = x - static_cast<int>(shift.x), dy = y - static_cast<int>(shift.y);
+                const int srcXs[4] = {dx, -dy, -dx, dy};
+                const int srcYs[4] = {dy, dx, -dy, -dx};
+                for (int c = 0; c < 3; ++c)
+                {
+                    goldVec[y * dstRowStride + x * 3 + c]
+                        = srcVec[i][srcYs[quarterTurns] * srcRowStride + srcXs[quarterTurns] * 3 + c];
+                }
+            }
+        }
+
+        EXPECT_EQ(goldVec, testVec);
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+// Pixels whose source falls outside of the input are left untouched, as with any other angle
+TEST(OpRotate_RightAngleBounds, pixels_outside_of_input_are_untouched)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int               width = 40, height = 33;
+    const nvcv::ImageFormat fmt = nvcv::FMT_U8;
+
+    nvcv::Tensor imgSrc(1, {width, height}, fmt);
+    nvcv::Tensor imgDst(1, {width, height}, fmt);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgDst.exportData());
+    ASSERT_NE(nullptr, srcData);
+    ASSERT_NE(nullptr, dstData);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(srcAccess);
+    ASSERT_TRUE(dstAccess);
+
+    ASSERT_EQ(cudaSuccess, cudaMemset2D(srcAccess->sampleData(0), srcAccess->rowStride(), 1, width, height));
+    ASSERT_EQ(cudaSuccess, cudaMemset2D(dstAccess->sampleData(0), dstAccess->rowStride(), 7, width, height));
+
+    // quarter turn shifted by 10 pixels, only x in [10, 10 + height) and y <= 10 have a source
+    cvcuda::Rotate rotateOp(0);
+    EXPECT_NO_THROW(rotateOp(stream, imgSrc, imgDst, 90, double2{10, 10}, NVCV_INTERP_LINEAR));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    std::vector<uint8_t> testVec(width * height);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), width, dstAccess->sampleData(0), dstAccess->rowStride(),
+                                        width, height, cudaMemcpyDeviceToHost));
+
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            // source of (x, y) is (10 - y, x - 10)
+            const bool inside = 10 - y >= 0 && x - 10 >= 0 && x - 10 < height;
+            ASSERT_EQ(inside ? 1 : 7, testVec[y * width + x]) << "at " << x << ", " << y;
+        }
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
 }
@@ -0,0 +1,209 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpSSIM.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace test = nvcv::test;
+
+namespace {
+
+// Mean SSIM of each channel of the packed HWC images over their 11x11 Gaussian windows, then of all channels
+// together when perChannel is false.
+std::vector<double> SSIM(const std::vector<float> &img, const std::vector<float> &ref, nvcv::Size2D size,
+                         int channels, double maxValue, bool perChannel)
+{
+    constexpr int kRadius = 5;
+
+    std::vector<double> w(2 * kRadius + 1);
+    for (int i = -kRadius; i <= kRadius; ++i)
+    {
+        w[i + kRadius] = std::exp(-i * i / (2 * 1.5 * 1.5));
+    }
+    const double wsum = std::accumulate(w.begin(), w.end(), 0.0);
+
+    const double c1 = std::pow(0.01 * maxValue, 2), c2 = std::pow(0.03 * maxValue, 2);
+
+    std::vector<double> res(channels, 0);
+    for (int c = 0; c < channels; ++c)
+    {
+        for (int y = kRadius; y < size.h - kRadius; ++y)
+        {
+            for (int x = kRadius; x < size.w - kRadius; ++x)
+            {
+                double m1 = 0, m2 = 0, m11 = 0, m22 = 0, m12 = 0;
+                for (int dy = -kRadius; dy <= kRadius; ++dy)
+                {
+                    for (int dx = -kRadius; dx <= kRadius; ++dx)
+                    {
+                        const double k = w[dy + kRadius] * w[dx + kRadius] / (wsum * wsum);
+                        const size_t i = ((y + dy) * size.w + x + dx) * channels + c;
+                        const double a = img[i], b = ref[i];
+
+                        m1 += k * a;
+                        m2 += k * b;
+                        m11 += k * a * a;
+                        m22 += k * b * b;
+                        m12 += k * a * b;
+                    }
+                }
+                const double s11 = m11 - m1 * m1, s22 = m22 - m2 * m2, s12 = m12 - m1 * m2;
+
+                res[c] += ((2 * m1 * m2 + c1) * (2 * s12 + c2)) / ((m1 * m1 + m2 * m2 + c1) * (s11 + s22 + c2));
+            }
+        }
+        res[c] /= (size.w - 2 * kRadius) * (size.h - 2 * kRadius);
+    }
+
+    if (!perChannel)
+    {
+        res = {std::accumulate(res.begin(), res.end(), 0.0) / channels};
+    }
+    return res;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpSSIM, test::ValueList<nvcv::ImageFormat, int, int, int, bool, float>
+{
+    //       format, numSamples, width, height, perChannel, maxValue
+    { nvcv::FMT_U8,           1,    11,     11,      false,        0 },
+    { nvcv::FMT_U8,           2,    75,     40,      false,        0 },
+    { nvcv::FMT_RGB8,         3,    64,     48,       true,        0 },
+    { nvcv::FMT_RGB8,         2,   160,    120,      false,      255 },
+    { nvcv::FMT_RGBA8,        2,    43,     27,       true,        0 },
+    { nvcv::FMT_U16,          2,    50,     40,      false,      255 },
+    { nvcv::FMT_S16,          1,    50,     40,       true,      255 },
+    { nvcv::FMT_RGBf32,       2,    50,     40,      false,      255 },
+});
+
+// clang-format on
+
+TEST_P(OpSSIM, correct_output)
+{
+    const nvcv::ImageFormat fmt        = GetParamValue<0>();
+    const int               numSamples = GetParamValue<1>();
+    const nvcv::Size2D      size{GetParamValue<2>(), GetParamValue<3>()};
+    const bool              perChannel = GetParamValue<4>();
+    const float             maxValue   = GetParamValue<5>();
+
+    const int channels = fmt.numChannels();
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    // values are integers in [0, 255] whatever the type, a smooth gradient with noise of increasing strength in
+    // each sample, so that scores cover a large range
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> udist(-20, 20);
+
+    std::vector<std::vector<float>> hImg(numSamples), hRef(numSamples);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        std::uniform_int_distribution<int> noise(-10 * (i + 1), 10 * (i + 1));
+        hRef[i].resize(size.w * size.h * channels);
+        hImg[i].resize(hRef[i].size());
+        for (size_t k = 0; k < hRef[i].size(); ++k)
+        {
+            const int x = k / channels % size.w, y = k / channels / size.w;
+
+            hRef[i][k] = std::clamp(128 + x - y + udist(rng), 0, 255);
+            hImg[i][k] = std::clamp(static_cast<int>(hRef[i][k]) + noise(rng), 0, 255);
+        }
+    }
+
+    auto img = test::CreateTensorFromFloats(hImg, size, fmt);
+    auto ref = test::CreateTensorFromFloats(hRef, size, fmt);
+
+    nvcv::Tensor scores({{numSamples, 1, 1, perChannel ? channels : 1}, "NHWC"}, nvcv::TYPE_F32);
+
+    cvcuda::SSIM op;
+    EXPECT_NO_THROW(op(stream, img, ref, scores, maxValue));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<float> result = test::GetFloatsFromTensor(scores);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        // the default maximum value of the 8-bit formats is 255
+        std::vector<double> gold = SSIM(hImg[i], hRef[i], size, channels, maxValue > 0 ? maxValue : 255, perChannel);
+        for (size_t c = 0; c < gold.size(); ++c)
+        {
+            EXPECT_NEAR(gold[c], result[i * gold.size() + c], 1e-3) << "at channel " << c;
+        }
+    }
+}
+
+TEST(OpSSIM, equal_images_score_one)
+{
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> udist(0, 255);
+
+    std::vector<std::vector<float>> hImg(3, std::vector<float>(1920 * 64 * 3));
+    for (auto &img : hImg)
+    {
+        std::generate(img.begin(), img.end(), [&]() { return udist(rng); });
+    }
+
+    auto         img = test::CreateTensorFromFloats(hImg, {1920, 64}, nvcv::FMT_RGB8);
+    nvcv::Tensor scores({{3, 1, 1, 3}, "NHWC"}, nvcv::TYPE_F32);
+
+    cvcuda::SSIM op;
+    EXPECT_NO_THROW(op(nullptr, img, img, scores));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+
+    for (float score : test::GetFloatsFromTensor(scores))
+    {
+        EXPECT_NEAR(1.f, score, 1e-5);
+    }
+}
+
+TEST(OpSSIM, invalid_arguments)
+{
+    nvcv::Tensor img      = test::CreateTensor(2, 32, 24, nvcv::FMT_RGB8);
+    nvcv::Tensor ref      = test::CreateTensor(2, 32, 24, nvcv::FMT_RGB8);
+    nvcv::Tensor refU8    = test::CreateTensor(2, 32, 24, nvcv::FMT_U8);
+    nvcv::Tensor imgSmall = test::CreateTensor(2, 32, 10, nvcv::FMT_RGB8);
+
+    nvcv::Tensor scores({{2, 1, 1, 1}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor scoresWide({{2, 1, 2, 1}, "NHWC"}, nvcv::TYPE_F32);
+
+    cvcuda::SSIM op;
+    EXPECT_NO_THROW(op(nullptr, img, ref, scores, 255));
+    EXPECT_THROW(op(nullptr, img, refU8, scores), nvcv::Exception);
+    // the windows are 11x11 pixels
+    EXPECT_THROW(op(nullptr, imgSmall, imgSmall, scores), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, img, ref, scoresWide), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, img, ref, scores, -1.f), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/BorderUtils.hpp>
+#include <common/TensorDataUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpSharpness.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace test = nvcv::test;
+
+namespace {
+
+// Variance of the Laplacian of the image, whose values are 0 outside the image with a constant border.
+double LaplacianVariance(const std::vector<float> &img, nvcv::Size2D size, int ksize, NVCVBorderType border)
+{
+    auto pixel = [&](int x, int y) -> double
+    {
+        int2 coord{x, y};
+        return test::IsInside(coord, int2{size.w, size.h}, border) ? img[coord.y * size.w + coord.x] : 0;
+    };
+
+    double sum = 0, sumSq = 0;
+    for (int y = 0; y < size.h; ++y)
+    {
+        for (int x = 0; x < size.w; ++x)
+        {
+            const double cross    = pixel(x, y - 1) + pixel(x - 1, y) + pixel(x + 1, y) + pixel(x, y + 1);
+            const double diagonal
+                = pixel(x - 1, y - 1) + pixel(x + 1, y - 1) + pixel(x - 1, y + 1) + pixel(x + 1, y + 1);
+            const double lap      = ksize == 1 ? cross - 4 * pixel(x, y) : 2 * diagonal - 8 * pixel(x, y);
+            sum += lap;
+            sumSq += lap * lap;
+        }
+    }
+
+    const double count = static_cast<double>(size.w) * size.h;
+    const double mean  = sum / count;
+    return sumSq / count - mean * mean;
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpSharpness, test::ValueList<nvcv::ImageFormat, int, int, int, int, NVCVBorderType>
+{
+    //       format, numSamples, width, height, ksize,                 border
+    { nvcv::FMT_U8,           1,    64,     48,     1, NVCV_BORDER_REFLECT101 },
+    { nvcv::FMT_U8,           3,   123,     77,     3, NVCV_BORDER_REPLICATE  },
+    { nvcv::FMT_U8,           2,   640,    480,     1, NVCV_BORDER_CONSTANT   },
+    { nvcv::FMT_U16,          2,    50,     40,     3, NVCV_BORDER_REFLECT    },
+    { nvcv::FMT_S16,          1,    31,      1,     1, NVCV_BORDER_WRAP       },
+    { nvcv::FMT_F32,          2,   200,    150,     3, NVCV_BORDER_REFLECT101 },
+});
+
+// clang-format on
+
+TEST_P(OpSharpness, correct_output)
+{
+    const nvcv::ImageFormat fmt        = GetParamValue<0>();
+    const int               numSamples = GetParamValue<1>();
+    const nvcv::Size2D      size{GetParamValue<2>(), GetParamValue<3>()};
+    const int               ksize  = GetParamValue<4>();
+    const NVCVBorderType    border = GetParamValue<5>();
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    // values are integers in [0, 255] whatever the type
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> udist(0, 255);
+
+    std::vector<std::vector<float>> hImg(numSamples, std::vector<float>(size.w * size.h));
+    for (auto &img : hImg)
+    {
+        std::generate(img.begin(), img.end(), [&]() { return udist(rng); });
+    }
+
+    auto img = test::CreateTensorFromFloats(hImg, size, fmt);
+
+    nvcv::Tensor scores({{numSamples, 1, 1, 1}, "NHWC"}, nvcv::TYPE_F32);
+
+    cvcuda::Sharpness op;
+    EXPECT_NO_THROW(op(stream, img, scores, ksize, border));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<float> result = test::GetFloatsFromTensor(scores);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        const double gold = LaplacianVariance(hImg[i], size, ksize, border);
+        EXPECT_NEAR(gold, result[i], 1e-4 * gold);
+    }
+}
+
+TEST(OpSharpness, blurred_images_score_lower)
+{
+    const nvcv::Size2D size{96, 64};
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> udist(0, 255);
+
+    // the second image is the first one averaged over 3x3 windows, the third one is flat
+    std::vector<std::vector<float>> hImg(3, std::vector<float>(size.w * size.h, 100));
+    std::generate(hImg[0].begin(), hImg[0].end(), [&]() { return udist(rng); });
+    for (int y = 1; y < size.h - 1; ++y)
+    {
+        for (int x = 1; x < size.w - 1; ++x)
+        {
+            float sum = 0;
+            for (int v = -1; v <= 1; ++v)
+            {
+                for (int u = -1; u <= 1; ++u)
+                {
+                    sum += hImg[0][(y + v) * size.w + x + u];
+                }
+            }
+            hImg[1][y * size.w + x] = std::round(sum / 9);
+        }
+    }
+
+    auto         img = test::CreateTensorFromFloats(hImg, size, nvcv::FMT_U8);
+    nvcv::Tensor scores({{3, 1, 1, 1}, "NHWC"}, nvcv::TYPE_F32);
+
+    cvcuda::Sharpness op;
+    EXPECT_NO_THROW(op(nullptr, img, scores, 1, NVCV_BORDER_REPLICATE));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+
+    std::vector<float> result = test::GetFloatsFromTensor(scores);
+    EXPECT_GT(result[0], 4 * result[1]);
+    EXPECT_EQ(0.f, result[2]);
+}
+
+TEST(OpSharpness, invalid_arguments)
+{
+    nvcv::Tensor img    = test::CreateTensor(2, 32, 24, nvcv::FMT_U8);
+    nvcv::Tensor imgRGB = test::CreateTensor(2, 32, 24, nvcv::FMT_RGB8);
+    nvcv::Tensor imgS8  = test::CreateTensor(2, 32, 24, nvcv::FMT_S8);
+
+    nvcv::Tensor scores({{2, 1, 1, 1}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor scores2({{2, 1, 1, 2}, "NHWC"}, nvcv::TYPE_F32);
+    nvcv::Tensor scoresS32({{2, 1, 1, 1}, "NHWC"}, nvcv::TYPE_S32);
+    nvcv::Tensor scores1({{1, 1, 1, 1}, "NHWC"}, nvcv::TYPE_F32);
+
+    cvcuda::Sharpness op;
+    EXPECT_NO_THROW(op(nullptr, img, scores, 1, NVCV_BORDER_REFLECT101));
+    // single channel images of the supported types
+    EXPECT_THROW(op(nullptr, imgRGB, scores, 1, NVCV_BORDER_REFLECT101), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, imgS8, scores, 1, NVCV_BORDER_REFLECT101), nvcv::Exception);
+    // one float score per sample
+    EXPECT_THROW(op(nullptr, img, scores2, 1, NVCV_BORDER_REFLECT101), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, img, scoresS32, 1, NVCV_BORDER_REFLECT101), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, img, scores1, 1, NVCV_BORDER_REFLECT101), nvcv::Exception);
+    // Laplacian apertures and borders
+    EXPECT_THROW(op(nullptr, img, scores, 5, NVCV_BORDER_REFLECT101), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, img, scores, 1, static_cast<NVCVBorderType>(255)), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -0,0 +1,301 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/BorderUtils.hpp>
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpSobel.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace test = nvcv::test;
+
+namespace {
+
+template<typename T>
+void CopyRows(const nvcv::Tensor &tensor, std::vector<T> &host, cudaMemcpyKind kind)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(data, nullptr);
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    ASSERT_TRUE(access);
+
+    const int rowBytes = access->numCols() * access->numChannels() * sizeof(T);
+    const int rows     = access->numSamples() * access->numRows();
+    ASSERT_EQ(access->sampleStride(), access->numRows() * access->rowStride());
+
+    if (kind == cudaMemcpyHostToDevice)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(data->basePtr(), access->rowStride(), host.data(), rowBytes, rowBytes,
+                                            rows, kind));
+    }
+    else
+    {
+        host.resize(rows * rowBytes / sizeof(T));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(host.data(), rowBytes, data->basePtr(), access->rowStride(), rowBytes,
+                                            rows, kind));
+    }
+}
+
+template<typename T>
+T SaturateToType(double v)
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return v;
+    }
+    else
+    {
+        double r = std::nearbyint(v);
+        return static_cast<T>(std::clamp<double>(r, std::numeric_limits<T>::min(), std::numeric_limits<T>::max()));
+    }
+}
+
+// 1D kernels of the OpenCV Sobel filters, and of the Scharr filters for ksize -1.
+void GoldKernels(int ksize, std::vector<double> &deriv, std::vector<double> &smooth)
+{
+    switch (ksize)
+    {
+    case -1:
+        deriv  = {-1, 0, 1};
+        smooth = {3, 10, 3};
+        break;
+    case 1:
+        deriv  = {-1, 0, 1};
+        smooth = {0, 1, 0};
+        break;
+    case 3:
+        deriv  = {-1, 0, 1};
+        smooth = {1, 2, 1};
+        break;
+    case 5:
+        deriv  = {-1, -2, 0, 2, 1};
+        smooth = {1, 4, 6, 4, 1};
+        break;
+    default:
+        deriv  = {-1, -4, -5, 0, 5, 4, 1};
+        smooth = {1, 6, 15, 20, 15, 6, 1};
+        break;
+    }
+}
+
+template<typename T>
+void GoldSobel(const std::vector<T> &in, std::vector<double> &dx, std::vector<double> &dy, int numSamples,
+               int width, int height, int channels, int ksize, float scale, NVCVBorderType border)
+{
+    std::vector<double> deriv, smooth;
+    GoldKernels(ksize, deriv, smooth);
+
+    const int size   = deriv.size();
+    const int radius = size / 2;
+
+    dx.assign(in.size(), 0);
+    dy.assign(in.size(), 0);
+
+    for (int n = 0; n < numSamples; ++n)
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+                for (int c = 0; c < channels; ++c)
+                {
+                    double gx = 0, gy = 0;
+                    for (int i = 0; i < size; ++i)
+                    {
+                        for (int j = 0; j < size; ++j)
+                        {
+                            int2 coord{x - radius + j, y - radius + i};
+                            if (!test::IsInside(coord, int2{width, height}, border))
+                            {
+                                continue;
+                            }
+
+                            const double v = in[((n * height + coord.y) * width + coord.x) * channels + c];
+
+                            gx += v * smooth[i] * deriv[j];
+                            gy += v * deriv[i] * smooth[j];
+                        }
+                    }
+
+                    const int idx = ((n * height + y) * width + x) * channels + c;
+                    dx[idx]       = gx * scale;
+                    dy[idx]       = gy * scale;
+                }
+}
+
+// The input has integer values, so that the derivatives are exact on the device up to float accumulation.
+template<typename T, typename D>
+void RunSobel(int numSamples, int width, int height, int channels, nvcv::DataType inType, nvcv::DataType outType,
+              int ksize, float scale, NVCVBorderType border)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::TensorShape shape({numSamples, height, width, channels}, nvcv::TENSOR_NHWC);
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> rand(0, 255);
+
+    std::vector<T> inVec(numSamples * height * width * channels);
+    std::generate(inVec.begin(), inVec.end(), [&]() { return static_cast<T>(rand(rng)); });
+
+    nvcv::Tensor in(shape, inType), dx(shape, outType), dy(shape, outType), mag(shape, outType);
+    CopyRows(in, inVec, cudaMemcpyHostToDevice);
+
+    cvcuda::Sobel op;
+    EXPECT_NO_THROW(op(stream, in, &dx, &dy, &mag, ksize, scale, border));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<D> testDx, testDy, testMag;
+    CopyRows(dx, testDx, cudaMemcpyDeviceToHost);
+    CopyRows(dy, testDy, cudaMemcpyDeviceToHost);
+    CopyRows(mag, testMag, cudaMemcpyDeviceToHost);
+
+    std::vector<double> goldDx, goldDy;
+    GoldSobel(inVec, goldDx, goldDy, numSamples, width, height, channels, ksize, scale, border);
+
+    // float outputs differ by the accumulation order, int16 ones by the rounding of the magnitude
+    auto tolerance = [](double gold)
+    {
+        return std::is_floating_point_v<D> ? 1e-5 * std::max(1.0, std::abs(gold)) : 1.0;
+    };
+
+    for (size_t i = 0; i < goldDx.size(); ++i)
+    {
+        const double goldMag = std::sqrt(goldDx[i] * goldDx[i] + goldDy[i] * goldDy[i]);
+
+        ASSERT_NEAR(SaturateToType<D>(goldDx[i]), testDx[i], tolerance(goldDx[i])) << "at " << i;
+        ASSERT_NEAR(SaturateToType<D>(goldDy[i]), testDy[i], tolerance(goldDy[i])) << "at " << i;
+        ASSERT_NEAR(SaturateToType<D>(goldMag), testMag[i], tolerance(goldMag)) << "at " << i;
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpSobel, test::ValueList<int, int, int, int, nvcv::DataType, nvcv::DataType, int, float, NVCVBorderType>
+{
+    // numSamples, width, height, channels,         inType,        outType, ksize, scale,                 border
+    {            1,    64,     48,        1,  nvcv::TYPE_U8, nvcv::TYPE_F32,     3,  1.0f, NVCV_BORDER_REFLECT101},
+    {            2,    37,     21,        3,  nvcv::TYPE_U8, nvcv::TYPE_S16,     3,  0.5f,   NVCV_BORDER_CONSTANT},
+    {            3,    33,     17,        4,  nvcv::TYPE_U8, nvcv::TYPE_F32,     5,  1.0f,  NVCV_BORDER_REPLICATE},
+    {            1,    50,     40,        1, nvcv::TYPE_U16, nvcv::TYPE_S16,     7,  1.0f,    NVCV_BORDER_REFLECT},
+    {            2,    19,     13,        1, nvcv::TYPE_S16, nvcv::TYPE_F32,    -1,  1.0f,       NVCV_BORDER_WRAP},
+    {            1,    40,     10,        3, nvcv::TYPE_F32, nvcv::TYPE_F32,     1,  2.0f, NVCV_BORDER_REFLECT101},
+    {            2,    11,      9,        1, nvcv::TYPE_F32, nvcv::TYPE_S16,     7, 0.25f, NVCV_BORDER_REFLECT101}
+});
+
+// clang-format on
+
+TEST_P(OpSobel, correct_output)
+{
+    int            numSamples = GetParamValue<0>();
+    int            width      = GetParamValue<1>();
+    int            height     = GetParamValue<2>();
+    int            channels   = GetParamValue<3>();
+    nvcv::DataType inType     = GetParamValue<4>();
+    nvcv::DataType outType    = GetParamValue<5>();
+    int            ksize      = GetParamValue<6>();
+    float          scale      = GetParamValue<7>();
+    NVCVBorderType border     = GetParamValue<8>();
+
+    auto run = [&](auto in, auto out)
+    {
+        RunSobel<decltype(in), decltype(out)>(numSamples, width, height, channels, inType, outType, ksize, scale,
+                                              border);
+    };
+
+    auto runOut = [&](auto in)
+    {
+        if (outType == nvcv::TYPE_S16)
+        {
+            run(in, int16_t{});
+        }
+        else
+        {
+            run(in, float{});
+        }
+    };
+
+    if (inType == nvcv::TYPE_U8)
+    {
+        runOut(uint8_t{});
+    }
+    else if (inType == nvcv::TYPE_U16)
+    {
+        runOut(uint16_t{});
+    }
+    else if (inType == nvcv::TYPE_S16)
+    {
+        runOut(int16_t{});
+    }
+    else
+    {
+        runOut(float{});
+    }
+}
+
+TEST(OpSobel, outputs_are_optional)
+{
+    nvcv::TensorShape shape({2, 16, 24, 1}, nvcv::TENSOR_NHWC);
+
+    nvcv::Tensor in(shape, nvcv::TYPE_U8), dx(shape, nvcv::TYPE_F32), mag(shape, nvcv::TYPE_F32);
+
+    nvcv::Tensor magOnly(shape, nvcv::TYPE_F32);
+
+    cvcuda::Sobel op;
+    EXPECT_NO_THROW(op(nullptr, in, &dx, nullptr, &mag, 3));
+    EXPECT_NO_THROW(op(nullptr, in, nullptr, nullptr, &magOnly, 3));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+
+    std::vector<float> magVec, magOnlyVec;
+    CopyRows(mag, magVec, cudaMemcpyDeviceToHost);
+    CopyRows(magOnly, magOnlyVec, cudaMemcpyDeviceToHost);
+    EXPECT_EQ(magVec, magOnlyVec);
+}
+
+TEST(OpSobel, invalid_arguments)
+{
+    nvcv::TensorShape shape({2, 16, 24, 1}, nvcv::TENSOR_NHWC);
+
+    nvcv::Tensor in(shape, nvcv::TYPE_U8), out(shape, nvcv::TYPE_F32), outS16(shape, nvcv::TYPE_S16);
+    nvcv::Tensor outU8(shape, nvcv::TYPE_U8), inS32(shape, nvcv::TYPE_S32);
+    nvcv::Tensor outSmall({{2, 16, 23, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor in2({{2, 16, 24, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor out2({{2, 16, 24, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+
+    cvcuda::Sobel op;
+    EXPECT_NO_THROW(op(nullptr, in, &out, nullptr, nullptr, 3));
+    EXPECT_THROW(op(nullptr, in, nullptr, nullptr, nullptr, 3), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, &out, nullptr, nullptr, 4), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, &out, nullptr, nullptr, 9), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, &out, nullptr, nullptr, 3, 1.f, static_cast<NVCVBorderType>(42)), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, &out, &outS16, nullptr, 3), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, &outU8, nullptr, nullptr, 3), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, inS32, &out, nullptr, nullptr, 3), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, &outSmall, nullptr, nullptr, 3), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in2, &out2, nullptr, nullptr, 3), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -0,0 +1,277 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpTemporalFilter.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+template<typename T>
+void CopyRows(const nvcv::Tensor &tensor, std::vector<T> &host, cudaMemcpyKind kind)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(data, nullptr);
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*data);
+    ASSERT_TRUE(access);
+
+    const int rowBytes = access->numCols() * access->numChannels() * sizeof(T);
+    const int rows     = access->numSamples() * access->numRows();
+    ASSERT_EQ(access->sampleStride(), access->numRows() * access->rowStride());
+
+    if (kind == cudaMemcpyHostToDevice)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(data->basePtr(), access->rowStride(), host.data(), rowBytes, rowBytes,
+                                            rows, kind));
+    }
+    else
+    {
+        host.resize(rows * rowBytes / sizeof(T));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(host.data(), rowBytes, data->basePtr(), access->rowStride(), rowBytes,
+                                            rows, kind));
+    }
+}
+
+template<typename T>
+T SaturateToType(float v)
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return v;
+    }
+    else
+    {
+        float r = std::nearbyint(v);
+        return static_cast<T>(std::clamp<float>(r, std::numeric_limits<T>::min(), std::numeric_limits<T>::max()));
+    }
+}
+
+// Filters frames [begin, end) of every pixel in order, as the operator does.
+template<typename T>
+void GoldFilter(const std::vector<T> &frames, std::vector<float> &state, std::vector<T> &out,
+                std::vector<uint8_t> &mask, int begin, int end, int numPixels, int channels, bool recursive,
+                float alpha, float threshold, bool reset)
+{
+    for (int p = 0; p < numPixels; ++p)
+    {
+        float *s = &state[p * channels];
+        if (reset)
+        {
+            for (int c = 0; c < channels; ++c)
+            {
+                s[c] = frames[(begin * numPixels + p) * channels + c];
+            }
+        }
+
+        for (int n = begin; n < end; ++n)
+        {
+            const T *v = &frames[(n * numPixels + p) * channels];
+
+            float d = 0.f;
+            for (int c = 0; c < channels; ++c)
+            {
+                d = std::max(d, std::abs(static_cast<float>(v[c]) - s[c]));
+            }
+
+            const bool  moving = d > threshold;
+            const float k      = recursive && moving ? 1.f : alpha;
+            for (int c = 0; c < channels; ++c)
+            {
+                s[c] += k * (static_cast<float>(v[c]) - s[c]);
+                out[(n * numPixels + p) * channels + c] = SaturateToType<T>(s[c]);
+            }
+            mask[n * numPixels + p] = moving ? 255 : 0;
+        }
+    }
+}
+
+// Frames are filtered in two calls, the second one continuing from the state left by the first one.  Alpha is a
+// power of two and values are integers so that the running averages are exact, both on the host and the device.
+template<typename T>
+void RunTemporalFilter(int numFrames, int width, int height, int channels, nvcv::DataType dtype,
+                       NVCVTemporalFilterType type, float alpha, float threshold)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int  numPixels = width * height;
+    const int  split     = numFrames / 2;
+    const bool recursive = type == NVCV_TEMPORAL_RECURSIVE;
+
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> base(0, 200);
+    std::uniform_int_distribution<int> noise(-8, 8);
+    std::bernoulli_distribution        motion(0.1);
+    std::vector<T>                     frames(numFrames * numPixels * channels);
+
+    // Noisy static pixels with a few jumps, so that both branches of the recursive filter are taken
+    for (int p = 0; p < numPixels * channels; ++p)
+    {
+        int level = base(rng);
+        for (int n = 0; n < numFrames; ++n)
+        {
+            if (motion(rng))
+            {
+                level = base(rng);
+            }
+            frames[n * numPixels * channels + p] = static_cast<T>(std::max(0, level + noise(rng) + 8));
+        }
+    }
+
+    std::vector<float>   goldState(numPixels * channels);
+    std::vector<T>       goldOut(frames.size());
+    std::vector<uint8_t> goldMask(numFrames * numPixels);
+    GoldFilter(frames, goldState, goldOut, goldMask, 0, split, numPixels, channels, recursive, alpha, threshold,
+               true);
+    GoldFilter(frames, goldState, goldOut, goldMask, split, numFrames, numPixels, channels, recursive, alpha,
+               threshold, false);
+
+    nvcv::Tensor state({{1, height, width, channels}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+
+    cvcuda::TemporalFilter op;
+
+    std::vector<T>       testOut;
+    std::vector<uint8_t> testMask;
+    for (auto [begin, end] : {std::make_pair(0, split), std::make_pair(split, numFrames)})
+    {
+        nvcv::TensorShape chunkShape({end - begin, height, width, channels}, nvcv::TENSOR_NHWC);
+        nvcv::Tensor      in(chunkShape, dtype), out(chunkShape, dtype);
+        nvcv::Tensor      mask({{end - begin, height, width, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+        std::vector<T> chunk(frames.begin() + begin * numPixels * channels,
+                             frames.begin() + end * numPixels * channels);
+        CopyRows(in, chunk, cudaMemcpyHostToDevice);
+
+        EXPECT_NO_THROW(op(stream, in, state, &out, &mask, type, alpha, threshold, begin == 0));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        std::vector<T>       chunkOut;
+        std::vector<uint8_t> chunkMask;
+        CopyRows(out, chunkOut, cudaMemcpyDeviceToHost);
+        CopyRows(mask, chunkMask, cudaMemcpyDeviceToHost);
+        testOut.insert(testOut.end(), chunkOut.begin(), chunkOut.end());
+        testMask.insert(testMask.end(), chunkMask.begin(), chunkMask.end());
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<float> testState;
+    CopyRows(state, testState, cudaMemcpyDeviceToHost);
+
+    EXPECT_EQ(goldState, testState);
+    EXPECT_EQ(goldOut, testOut);
+    EXPECT_EQ(goldMask, testMask);
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpTemporalFilter, test::ValueList<int, int, int, int, nvcv::DataType, NVCVTemporalFilterType, float, float>
+{
+    // numFrames, width, height, channels,          dtype,                          type, alpha, threshold
+    {           8,    64,     48,        1,  nvcv::TYPE_U8, NVCV_TEMPORAL_RUNNING_AVERAGE,  0.5f,     20.f },
+    {          12,    37,     21,        3,  nvcv::TYPE_U8,       NVCV_TEMPORAL_RECURSIVE,  0.5f,     20.f },
+    {           6,    33,     17,        4,  nvcv::TYPE_U8,       NVCV_TEMPORAL_RECURSIVE,  1.0f,     10.f },
+    {           4,    50,     20,        2, nvcv::TYPE_U16, NVCV_TEMPORAL_RUNNING_AVERAGE,  0.5f,      0.f },
+    {          10,    19,     13,        1, nvcv::TYPE_F32,       NVCV_TEMPORAL_RECURSIVE,  0.5f,     30.f },
+    {           2,    40,     10,        3, nvcv::TYPE_F32, NVCV_TEMPORAL_RUNNING_AVERAGE,  0.5f,     15.f }
+});
+
+// clang-format on
+
+TEST_P(OpTemporalFilter, correct_output)
+{
+    int                    numFrames = GetParamValue<0>();
+    int                    width     = GetParamValue<1>();
+    int                    height    = GetParamValue<2>();
+    int                    channels  = GetParamValue<3>();
+    nvcv::DataType         dtype     = GetParamValue<4>();
+    NVCVTemporalFilterType type      = GetParamValue<5>();
+    float                  alpha     = GetParamValue<6>();
+    float                  threshold = GetParamValue<7>();
+
+    if (dtype == nvcv::TYPE_U8)
+    {
+        RunTemporalFilter<uint8_t>(numFrames, width, height, channels, dtype, type, alpha, threshold);
+    }
+    else if (dtype == nvcv::TYPE_U16)
+    {
+        RunTemporalFilter<uint16_t>(numFrames, width, height, channels, dtype, type, alpha, threshold);
+    }
+    else
+    {
+        RunTemporalFilter<float>(numFrames, width, height, channels, dtype, type, alpha, threshold);
+    }
+}
+
+TEST(OpTemporalFilter, outputs_are_optional)
+{
+    nvcv::Tensor in({{3, 8, 8, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor state({{1, 8, 8, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor out({{3, 8, 8, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor mask({{3, 8, 8, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    cvcuda::TemporalFilter op;
+    EXPECT_NO_THROW(op(nullptr, in, state, nullptr, nullptr, NVCV_TEMPORAL_RUNNING_AVERAGE, 0.1f, 10.f, true));
+    EXPECT_NO_THROW(op(nullptr, in, state, &out, nullptr, NVCV_TEMPORAL_RECURSIVE, 0.1f, 10.f));
+    EXPECT_NO_THROW(op(nullptr, in, state, nullptr, &mask, NVCV_TEMPORAL_RECURSIVE, 0.1f, 10.f));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
+
+TEST(OpTemporalFilter, invalid_arguments)
+{
+    nvcv::Tensor in({{3, 8, 8, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor inS16({{3, 8, 8, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S16);
+    nvcv::Tensor state({{1, 8, 8, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor stateU8({{1, 8, 8, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor stateSmall({{1, 8, 7, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor outF32({{3, 8, 8, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor mask3({{3, 8, 8, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor mask2N({{2, 8, 8, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    const auto avg = NVCV_TEMPORAL_RUNNING_AVERAGE;
+
+    cvcuda::TemporalFilter op;
+    EXPECT_NO_THROW(op(nullptr, in, state, nullptr, nullptr, avg, 0.5f, 10.f));
+    EXPECT_THROW(op(nullptr, in, state, nullptr, nullptr, avg, 0.f, 10.f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, state, nullptr, nullptr, avg, 1.5f, 10.f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, state, nullptr, nullptr, avg, 0.5f, -1.f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, state, nullptr, nullptr, static_cast<NVCVTemporalFilterType>(7), 0.5f, 10.f),
+                 nvcv::Exception);
+    EXPECT_THROW(op(nullptr, inS16, state, nullptr, nullptr, avg, 0.5f, 10.f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, stateU8, nullptr, nullptr, avg, 0.5f, 10.f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, stateSmall, nullptr, nullptr, avg, 0.5f, 10.f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, state, &outF32, nullptr, avg, 0.5f, 10.f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, state, nullptr, &mask3, avg, 0.5f, 10.f), nvcv::Exception);
+    EXPECT_THROW(op(nullptr, in, state, nullptr, &mask2N, avg, 0.5f, 10.f), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/ValueTests.hpp>
+#include <cvcuda/OpTopK.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+namespace test = nvcv::test;
+namespace t    = ::testing;
+
+namespace {
+
+void RunTopK(int numSamples, int numClasses, int k, bool softmax, int numDistinct)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor imgSrc({{numSamples, 1, numClasses, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor scores({{numSamples, 1, k, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor indices({{numSamples, 1, k, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    const auto *srcData   = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(imgSrc.exportData());
+    const auto *scoreData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(scores.exportData());
+    const auto *indexData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(indices.exportData());
+    ASSERT_TRUE(srcData && scoreData && indexData);
+
+    // Few distinct values make ties, which go to the lowest index
+    std::default_random_engine         rng;
+    std::uniform_int_distribution<int> udist(0, numDistinct - 1);
+
+    std::vector<float> src(numSamples * numClasses);
+    std::generate(src.begin(), src.end(), [&]() { return udist(rng) * (20.f / numDistinct) - 10.f; });
+
+    const int rowBytes = numClasses * sizeof(float);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->basePtr(), srcData->stride(0), src.data(), rowBytes, rowBytes,
+                                        numSamples, cudaMemcpyHostToDevice));
+
+    cvcuda::TopK topkOp;
+    EXPECT_NO_THROW(topkOp(stream, imgSrc, scores, indices, softmax));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<float> testScores(numSamples * k);
+    std::vector<int>   testIndices(numSamples * k);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testScores.data(), k * sizeof(float), scoreData->basePtr(),
+                                        scoreData->stride(0), k * sizeof(float), numSamples, cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testIndices.data(), k * sizeof(int), indexData->basePtr(),
+                                        indexData->stride(0), k * sizeof(int), numSamples, cudaMemcpyDeviceToHost));
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        const float *row = &src[n * numClasses];
+
+        std::vector<int> gold(numClasses);
+        std::iota(gold.begin(), gold.end(), 0);
+        std::stable_sort(gold.begin(), gold.end(), [row](int a, int b) { return row[a] > row[b]; });
+
+        double expSum = 0;
+        for (int c = 0; c < numClasses; ++c)
+        {
+            expSum += std::exp(row[c] - row[gold[0]]);
+        }
+
+        for (int r = 0; r < k; ++r)
+        {
+            float goldScore = softmax ? std::exp(row[gold[r]] - row[gold[0]]) / expSum : row[gold[r]];
+
+            EXPECT_EQ(gold[r], testIndices[n * k + r]) << "at sample " << n << " rank " << r;
+            EXPECT_NEAR(goldScore, testScores[n * k + r], 1e-5f) << "at sample " << n << " rank " << r;
+        }
+    }
+}
+
+} // namespace
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpTopK, test::ValueList<int, int, int, int>
+{
+    // numSamples, numClasses,  k, numDistinct
+    {            1,       1000,  5,       100000 },
+    {            8,       1000,  5,       100000 },
+    {            3,         10, 10,            4 },
+    {            2,      21841, 20,        1000 },
+    {            4,        100,  1,           3 },
+    {            5,          7,  3,      100000 }
+});
+
+// clang-format on
+
+TEST_P(OpTopK, correct_output)
+{
+    RunTopK(GetParamValue<0>(), GetParamValue<1>(), GetParamValue<2>(), false, GetParamValue<3>());
+}
+
+TEST_P(OpTopK, softmax_correct_output)
+{
+    RunTopK(GetParamValue<0>(), GetParamValue<1>(), GetParamValue<2>(), true, GetParamValue<3>());
+}
+
+TEST(OpTopK, invalid_arguments)
+{
+    nvcv::Tensor src({{2, 1, 100, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor srcRows({{2, 2, 100, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor srcU8({{2, 1, 100, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor scores({{2, 1, 5, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor indices({{2, 1, 5, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor indicesF32({{2, 1, 5, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor indicesK4({{2, 1, 4, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor indices1N({{1, 1, 5, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+    nvcv::Tensor scoresLarge({{2, 1, 101, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_F32);
+    nvcv::Tensor indicesLarge({{2, 1, 101, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_S32);
+
+    cvcuda::TopK topkOp;
+    EXPECT_NO_THROW(topkOp(nullptr, src, scores, indices));
+    EXPECT_THROW(topkOp(nullptr, srcRows, scores, indices), nvcv::Exception);
+    EXPECT_THROW(topkOp(nullptr, srcU8, scores, indices), nvcv::Exception);
+    EXPECT_THROW(topkOp(nullptr, src, scores, indicesF32), nvcv::Exception);
+    EXPECT_THROW(topkOp(nullptr, src, scores, indicesK4), nvcv::Exception);
+    EXPECT_THROW(topkOp(nullptr, src, scores, indices1N), nvcv::Exception);
+    EXPECT_THROW(topkOp(nullptr, src, scoresLarge, indicesLarge), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(nullptr));
+}
@@ -497,7 +497,7 @@ TEST_P(OpWarpAffine, varshape_correct_output)
     std::uniform_int_distribution<int> rndInputDimsIndex(0, mapOfTransformationMatrix.size() - 1);
     std::uniform_int_distribution<int> rndTransformationMatrixIndex(0, 3);
 
-    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst;
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst, imgDstHost;
     std::vector<std::vector<float>>           transMatrixHostVec;
     transMatrixHostVec.resize(numberOfImages);
 
@@ -539,6 +539,8 @@ TEST_P(OpWarpAffine, varshape_correct_output)
 
         imgDst.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{tmpDstWidth, tmpDstHeight}, fmt));
 
+        imgDstHost.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{tmpDstWidth, tmpDstHeight}, fmt));
+
         transMatrixHostVec[i] = tmpTransMatrix;
 
         ASSERT_EQ(cudaSuccess,
@@ -553,6 +555,9 @@ TEST_P(OpWarpAffine, varshape_correct_output)
     nvcv::ImageBatchVarShape batchDst(numberOfImages);
     batchDst.pushBack(imgDst.begin(), imgDst.end());
 
+    nvcv::ImageBatchVarShape batchDstHost(numberOfImages);
+    batchDstHost.pushBack(imgDstHost.begin(), imgDstHost.end());
+
     std::vector<std::vector<uint8_t>> srcVec(numberOfImages);
     std::vector<int>                  srcVecStride(numberOfImages);
 
@@ -585,6 +590,17 @@ TEST_P(OpWarpAffine, varshape_correct_output)
     cvcuda::WarpAffine warpAffineOp(numberOfImages);
     EXPECT_NO_THROW(warpAffineOp(stream, batchSrc, batchDst, transMatrixTensor, flags, borderMode, borderValue));
 
+    const bool useHostParams = numberOfImages <= CVCUDA_MAX_HOST_PARAM_SAMPLES;
+    if (useHostParams)
+    {
+        std::vector<NVCVAffineTransform> xforms(numberOfImages);
+        for (int i = 0; i < numberOfImages; ++i)
+        {
+            std::copy(transMatrixHostVec[i].begin(), transMatrixHostVec[i].end(), xforms[i]);
+        }
+        EXPECT_NO_THROW(warpAffineOp(stream, batchSrc, batchDstHost, xforms.data(), flags, borderMode, borderValue));
+    }
+
     // Get test data back
     EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
     EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
@@ -666,5 +682,19 @@ TEST_P(OpWarpAffine, varshape_correct_output)
 #endif
 
         EXPECT_EQ(goldVec, testVec);
+
+        if (useHostParams)
+        {
+            // Same kernel with the matrices read from its arguments, so the result is bitwise identical
+            const auto *dstHostData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDstHost[i]->exportData());
+            assert(dstHostData->numPlanes() == 1);
+
+            std::vector<uint8_t> testHostVec(dstHeight * dstStride);
+            ASSERT_EQ(cudaSuccess,
+                      cudaMemcpy2D(testHostVec.data(), dstStride, dstHostData->plane(0).basePtr,
+                                   dstHostData->plane(0).rowStride, dstStride, dstHeight, cudaMemcpyDeviceToHost));
+
+            EXPECT_EQ(testVec, testHostVec);
+        }
     }
 }
@@ -764,3 +764,225 @@ TEST_P(OpWarpPerspective, varshape_correct_output)
         EXPECT_EQ(goldVec, testVec);
     }
 }
+
+// Homography from the output pixels of a perspective crop to the quadrilateral, same as the operator
+static void QuadTransformGold(const float *q, int width, int height, NVCVPerspectiveTransform xform)
+{
+    double x0 = q[0], y0 = q[1], x1 = q[2], y1 = q[3], x2 = q[4], y2 = q[5], x3 = q[6], y3 = q[7];
+
+    double sx = x0 - x1 + x2 - x3, sy = y0 - y1 + y2 - y3;
+    double dx1 = x1 - x2, dx2 = x3 - x2, dy1 = y1 - y2, dy2 = y3 - y2;
+    double den = dx1 * dy2 - dx2 * dy1;
+
+    double g = 0, h = 0;
+    if ((sx != 0 || sy != 0) && den != 0)
+    {
+        g = (sx * dy2 - dx2 * sy) / den;
+        h = (dx1 * sy - sx * dy1) / den;
+    }
+
+    xform[0] = (x1 - x0 + g * x1) / width;
+    xform[1] = (x3 - x0 + h * x3) / height;
+    xform[2] = x0;
+    xform[3] = (y1 - y0 + g * y1) / width;
+    xform[4] = (y3 - y0 + h * y3) / height;
+    xform[5] = y0;
+    xform[6] = g / width;
+    xform[7] = h / height;
+    xform[8] = 1;
+}
+
+// Runs a perspective crop of quads, rows of 8 or 9 floats, from random RGBA8 sources into outputs of the given sizes
+static void RunPerspectiveCrop(const std::vector<nvcv::Size2D> &srcSizes, const std::vector<nvcv::Size2D> &dstSizes,
+                               const std::vector<float> &quads, int quadCols, int flags, NVCVBorderType borderMode,
+                               std::vector<std::vector<uint8_t>> &srcVec, std::vector<std::vector<uint8_t>> &dstVec)
+{
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGBA8;
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int numQuads = dstSizes.size();
+
+    nvcv::Tensor quadTensor(nvcv::TensorShape({numQuads, quadCols}, nvcv::TENSOR_NW), nvcv::TYPE_F32);
+    const auto  *quadData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(quadTensor.exportData());
+    ASSERT_NE(nullptr, quadData);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(quadData->basePtr(), quadData->stride(0), quads.data(),
+                                        quadCols * sizeof(float), quadCols * sizeof(float), numQuads,
+                                        cudaMemcpyHostToDevice));
+
+    std::default_random_engine             randEng{0};
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst;
+
+    srcVec.resize(srcSizes.size());
+    for (size_t i = 0; i < srcSizes.size(); ++i)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(srcSizes[i], fmt));
+        const auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgSrc[i]->exportData());
+
+        int rowStride = srcSizes[i].w * 4;
+        srcVec[i].resize(srcSizes[i].h * rowStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return rand(randEng); });
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(data->plane(0).basePtr, data->plane(0).rowStride, srcVec[i].data(),
+                                            rowStride, rowStride, srcSizes[i].h, cudaMemcpyHostToDevice));
+    }
+
+    for (const nvcv::Size2D &size : dstSizes)
+    {
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(size, fmt));
+    }
+
+    nvcv::ImageBatchVarShape batchSrc(imgSrc.size());
+    batchSrc.pushBack(imgSrc.begin(), imgSrc.end());
+
+    nvcv::ImageBatchVarShape batchDst(numQuads);
+    batchDst.pushBack(imgDst.begin(), imgDst.end());
+
+    cvcuda::WarpPerspective op(0);
+    ASSERT_NO_THROW(op.crop(stream, batchSrc, quadTensor, batchDst, flags, borderMode, float4{0, 0, 0, 0}));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    dstVec.resize(numQuads);
+    for (int i = 0; i < numQuads; ++i)
+    {
+        const auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(imgDst[i]->exportData());
+
+        int rowStride = dstSizes[i].w * 4;
+        dstVec[i].resize(dstSizes[i].h * rowStride);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(dstVec[i].data(), rowStride, data->plane(0).basePtr,
+                                            data->plane(0).rowStride, rowStride, dstSizes[i].h,
+                                            cudaMemcpyDeviceToHost));
+    }
+}
+
+TEST(OpWarpPerspective, perspective_crop_matches_homography)
+{
+    // text lines of a page, tilted and in perspective, rectified to different sizes
+    std::vector<nvcv::Size2D> srcSizes{
+        {64, 48}
+    };
+    std::vector<nvcv::Size2D> dstSizes{
+        {32, 8},
+        {24, 6},
+        {40, 10}
+    };
+    std::vector<float> quads{5.f,  4.f,  40.f, 8.f,  39.f, 17.f, 4.f,  13.f, 10.f, 20.f, 50.f, 18.f,
+                             52.f, 27.f, 9.f,  30.f, 2.f,  35.f, 60.f, 33.f, 62.f, 46.f, 1.f,  44.f};
+
+    const NVCVBorderType borderMode = NVCV_BORDER_REPLICATE;
+
+    std::vector<std::vector<uint8_t>> srcVec, dstVec;
+    RunPerspectiveCrop(srcSizes, dstSizes, quads, 8, NVCV_INTERP_LINEAR, borderMode, srcVec, dstVec);
+
+    for (size_t i = 0; i < dstSizes.size(); ++i)
+    {
+        SCOPED_TRACE(i);
+
+        NVCVPerspectiveTransform xform;
+        QuadTransformGold(&quads[i * 8], dstSizes[i].w, dstSizes[i].h, xform);
+
+        std::vector<uint8_t> goldVec(dstVec[i].size());
+        WarpPerspectiveGold(goldVec, dstSizes[i].w * 4, dstSizes[i], srcVec[0], srcSizes[0].w * 4, srcSizes[0],
+                            nvcv::FMT_RGBA8, xform, NVCV_INTERP_LINEAR, borderMode, float4{0, 0, 0, 0});
+
+        // coefficients are computed on device in single precision
+        for (size_t j = 0; j < goldVec.size(); ++j)
+        {
+            ASSERT_NEAR(goldVec[j], dstVec[i][j], 1) << "at byte " << j;
+        }
+    }
+}
+
+TEST(OpWarpPerspective, perspective_crop_axis_aligned_quad_is_a_crop)
+{
+    // quads with the sample index, the last one refers to a missing sample
+    std::vector<nvcv::Size2D> srcSizes{
+        {30, 13},
+        {20, 9 }
+    };
+    std::vector<nvcv::Size2D> dstSizes{
+        {6, 4},
+        {10, 3},
+        {5, 5}
+    };
+    std::vector<float> quads{1.f, 3.f,  2.f, 9.f,  2.f, 9.f,  6.f, 3.f, 6.f, 0.f, 4.f, 5.f, 24.f, 5.f,
+                             24.f, 8.f, 4.f, 8.f, 7.f, 0.f, 0.f, 5.f, 0.f, 5.f, 5.f, 0.f, 5.f};
+
+    std::vector<std::vector<uint8_t>> srcVec, dstVec;
+    RunPerspectiveCrop(srcSizes, dstSizes, quads, 9, NVCV_INTERP_NEAREST, NVCV_BORDER_CONSTANT, srcVec, dstVec);
+
+    // 1:1 crop at (3, 2) of sample 1
+    for (int y = 0; y < dstSizes[0].h; ++y)
+    {
+        for (int x = 0; x < dstSizes[0].w * 4; ++x)
+        {
+            ASSERT_EQ(srcVec[1][(y + 2) * srcSizes[1].w * 4 + 3 * 4 + x], dstVec[0][y * dstSizes[0].w * 4 + x]);
+        }
+    }
+
+    // 2:1 downscaled crop at (4, 5) of sample 0
+    for (int y = 0; y < dstSizes[1].h; ++y)
+    {
+        for (int x = 0; x < dstSizes[1].w; ++x)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                ASSERT_EQ(srcVec[0][(5 + y) * srcSizes[0].w * 4 + (4 + 2 * x) * 4 + c],
+                          dstVec[1][y * dstSizes[1].w * 4 + x * 4 + c]);
+            }
+        }
+    }
+
+    EXPECT_EQ(std::vector<uint8_t>(dstVec[2].size(), 0), dstVec[2]);
+}
+
+TEST(OpWarpPerspective, perspective_crop_invalid_args)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    std::vector<std::unique_ptr<nvcv::Image>> imgSrc, imgDst, imgDstWrongFormat;
+    for (int i = 0; i < 2; ++i)
+    {
+        imgSrc.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{16, 16}, nvcv::FMT_RGB8));
+        imgDst.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{8, 4}, nvcv::FMT_RGB8));
+        imgDstWrongFormat.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{8, 4}, nvcv::FMT_RGBA8));
+    }
+
+    nvcv::ImageBatchVarShape src(2), dst(2), dstWrongFormat(2);
+    src.pushBack(imgSrc.begin(), imgSrc.end());
+    dst.pushBack(imgDst.begin(), imgDst.end());
+    dstWrongFormat.pushBack(imgDstWrongFormat.begin(), imgDstWrongFormat.end());
+
+    nvcv::Tensor quads(nvcv::TensorShape({2, 8}, nvcv::TENSOR_NW), nvcv::TYPE_F32);
+    nvcv::Tensor quadsWrongType(nvcv::TensorShape({2, 8}, nvcv::TENSOR_NW), nvcv::TYPE_S32);
+    nvcv::Tensor quadsWrongShape(nvcv::TensorShape({2, 6}, nvcv::TENSOR_NW), nvcv::TYPE_F32);
+    nvcv::Tensor quadsWrongCount(nvcv::TensorShape({3, 8}, nvcv::TENSOR_NW), nvcv::TYPE_F32);
+
+    cvcuda::WarpPerspective op(0);
+
+    const float4 borderValue{0, 0, 0, 0};
+
+    EXPECT_NO_THROW(op.crop(stream, src, quads, dst, NVCV_INTERP_LINEAR, NVCV_BORDER_CONSTANT, borderValue));
+
+    EXPECT_THROW(op.crop(stream, src, quadsWrongType, dst, NVCV_INTERP_LINEAR, NVCV_BORDER_CONSTANT, borderValue),
+                 nvcv::Exception);
+    EXPECT_THROW(op.crop(stream, src, quadsWrongShape, dst, NVCV_INTERP_LINEAR, NVCV_BORDER_CONSTANT, borderValue),
+                 nvcv::Exception);
+    EXPECT_THROW(op.crop(stream, src, quadsWrongCount, dst, NVCV_INTERP_LINEAR, NVCV_BORDER_CONSTANT, borderValue),
+                 nvcv::Exception);
+    EXPECT_THROW(op.crop(stream, src, quads, dst, NVCV_INTERP_LINEAR | NVCV_WARP_INVERSE_MAP, NVCV_BORDER_CONSTANT,
+                         borderValue),
+                 nvcv::Exception);
+    EXPECT_THROW(op.crop(stream, src, quads, dst, NVCV_INTERP_AREA, NVCV_BORDER_CONSTANT, borderValue),
+                 nvcv::Exception);
+
+    EXPECT_THROW(op.crop(stream, src, quads, dstWrongFormat, NVCV_INTERP_LINEAR, NVCV_BORDER_CONSTANT, borderValue),
+                 nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
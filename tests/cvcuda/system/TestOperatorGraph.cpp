@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <cvcuda/OpFlip.hpp>
+#include <cvcuda/OperatorGraph.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <random>
+#include <stdexcept>
+
+namespace test = nvcv::test;
+
+namespace {
+
+void Randomize(const nvcv::Tensor &tensor, std::default_random_engine &randEng)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(nullptr, data);
+
+    std::vector<uint8_t>                   vec(data->stride(0) * data->shape(0));
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+    std::generate(vec.begin(), vec.end(), [&]() { return rand(randEng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(data->basePtr(), vec.data(), vec.size(), cudaMemcpyHostToDevice));
+}
+
+std::vector<uint8_t> Download(const nvcv::Tensor &tensor)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    EXPECT_NE(nullptr, data);
+
+    std::vector<uint8_t> vec(data->stride(0) * data->shape(0));
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(vec.data(), data->basePtr(), vec.size(), cudaMemcpyDeviceToHost));
+    return vec;
+}
+
+} // namespace
+
+TEST(OperatorGraph, replays_captured_operators)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor in   = test::CreateTensor(1, 224, 224, nvcv::FMT_RGB8);
+    nvcv::Tensor tmp  = test::CreateTensor(1, 224, 224, nvcv::FMT_RGB8);
+    nvcv::Tensor out  = test::CreateTensor(1, 224, 224, nvcv::FMT_RGB8);
+    nvcv::Tensor gold = test::CreateTensor(1, 224, 224, nvcv::FMT_RGB8);
+
+    std::default_random_engine randEng;
+    cvcuda::Flip               flipOp;
+    cvcuda::OperatorGraph      graph;
+
+    EXPECT_FALSE(graph.isCaptured());
+    EXPECT_THROW(graph.launch(stream), nvcv::Exception);
+
+    // flipping horizontally then vertically is flipping both ways
+    auto flipBoth = [&](int first, int second)
+    {
+        return [&, first, second](cudaStream_t s)
+        {
+            flipOp(s, in, tmp, first);
+            flipOp(s, tmp, out, second);
+        };
+    };
+
+    ASSERT_NO_THROW(graph.capture(stream, flipBoth(1, 0)));
+    EXPECT_TRUE(graph.isCaptured());
+
+    // new contents of the input are picked up by each launch
+    for (int i = 0; i < 2; ++i)
+    {
+        SCOPED_TRACE(i);
+        Randomize(in, randEng);
+
+        EXPECT_NO_THROW(graph.launch(stream));
+        EXPECT_NO_THROW(flipOp(stream, in, gold, -1));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        EXPECT_EQ(Download(gold), Download(out));
+    }
+
+    // same kernels with other parameters, the executable graph is updated
+    ASSERT_NO_THROW(graph.capture(stream, flipBoth(0, 1)));
+    Randomize(in, randEng);
+    EXPECT_NO_THROW(graph.launch(stream));
+    EXPECT_NO_THROW(flipOp(stream, in, gold, -1));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(Download(gold), Download(out));
+
+    // a failed capture leaves the stream usable and keeps the previous graph
+    EXPECT_THROW(graph.capture(stream, [](cudaStream_t) { throw std::runtime_error("fail"); }), std::runtime_error);
+    cudaStreamCaptureStatus status;
+    ASSERT_EQ(cudaSuccess, cudaStreamIsCapturing(stream, &status));
+    EXPECT_EQ(cudaStreamCaptureStatusNone, status);
+    EXPECT_TRUE(graph.isCaptured());
+
+    EXPECT_THROW(graph.capture(0, flipBoth(1, 0)), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OperatorNode, updates_instantiated_graph)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor in[2] = {test::CreateTensor(1, 64, 48, nvcv::FMT_RGB8), test::CreateTensor(1, 64, 48, nvcv::FMT_RGB8)};
+    nvcv::Tensor out   = test::CreateTensor(1, 64, 48, nvcv::FMT_RGB8);
+    nvcv::Tensor gold  = test::CreateTensor(1, 64, 48, nvcv::FMT_RGB8);
+
+    std::default_random_engine randEng;
+    Randomize(in[0], randEng);
+    Randomize(in[1], randEng);
+
+    cvcuda::Flip         flipOp;
+    cvcuda::OperatorNode flipNode;
+    EXPECT_EQ(nullptr, flipNode.node());
+
+    cudaGraph_t graph;
+    ASSERT_EQ(cudaSuccess, cudaGraphCreate(&graph, 0));
+
+    cudaGraphNode_t node = nullptr;
+    ASSERT_NO_THROW(node = flipNode.add(graph, nullptr, 0, stream, [&](cudaStream_t s) { flipOp(s, in[0], out, 0); }));
+    EXPECT_EQ(node, flipNode.node());
+
+    cudaGraphExec_t exec;
+    ASSERT_EQ(cudaSuccess, cudaGraphInstantiateWithFlags(&exec, graph, 0));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        SCOPED_TRACE(i);
+        int flipCode = i % 2 ? 1 : 0;
+
+        ASSERT_NO_THROW(flipNode.update(exec, stream, [&](cudaStream_t s) { flipOp(s, in[i % 2], out, flipCode); }));
+        ASSERT_EQ(cudaSuccess, cudaGraphLaunch(exec, stream));
+        EXPECT_NO_THROW(flipOp(stream, in[i % 2], gold, flipCode));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        EXPECT_EQ(Download(gold), Download(out));
+    }
+
+    EXPECT_THROW(cvcuda::OperatorNode{}.update(exec, stream, [&](cudaStream_t s) { flipOp(s, in[0], out, 0); }),
+                 nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaGraphExecDestroy(exec));
+    ASSERT_EQ(cudaSuccess, cudaGraphDestroy(graph));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <cvcuda/OpFlip.hpp>
+#include <cvcuda/Operator.h>
+#include <nvcv/Tensor.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace test = nvcv::test;
+
+static std::vector<NVCVOperatorStats> GetStats()
+{
+    int32_t numStats = 0;
+    EXPECT_EQ(NVCV_SUCCESS, cvcudaGetOperatorStats(nullptr, &numStats));
+
+    std::vector<NVCVOperatorStats> stats(numStats);
+    EXPECT_EQ(NVCV_SUCCESS, cvcudaGetOperatorStats(stats.data(), &numStats));
+    stats.resize(numStats);
+    return stats;
+}
+
+static const NVCVOperatorStats *FindStats(const std::vector<NVCVOperatorStats> &stats, const std::string &name)
+{
+    auto it = std::find_if(stats.begin(), stats.end(), [&](const NVCVOperatorStats &s) { return s.name == name; });
+    return it == stats.end() ? nullptr : &*it;
+}
+
+TEST(OperatorStats, timed_executions_are_counted)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor inTensor  = test::CreateTensor(2, 64, 32, nvcv::FMT_RGB8);
+    nvcv::Tensor outTensor = test::CreateTensor(2, 64, 32, nvcv::FMT_RGB8);
+
+    cvcuda::Flip flipOp;
+
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaResetOperatorStats());
+
+    // Not timed while disabled
+    EXPECT_NO_THROW(flipOp(stream, inTensor, outTensor, 1));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(nullptr, FindStats(GetStats(), "Flip"));
+
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetOperatorTimingEnabled(1));
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_NO_THROW(flipOp(stream, inTensor, outTensor, i - 1));
+    }
+
+    // Failed executions aren't timed
+    nvcv::Tensor badTensor = test::CreateTensor(2, 64, 32, nvcv::FMT_RGBf32);
+    EXPECT_THROW(flipOp(stream, inTensor, badTensor, 1), nvcv::Exception);
+
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetOperatorTimingEnabled(0));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    std::vector<NVCVOperatorStats> stats = GetStats();
+    const NVCVOperatorStats       *flip  = FindStats(stats, "Flip");
+    ASSERT_NE(nullptr, flip);
+
+    EXPECT_EQ(3, flip->count);
+    EXPECT_EQ(3, std::accumulate(std::begin(flip->histogram), std::end(flip->histogram), int64_t{0}));
+    EXPECT_LE(0, flip->minTimeMs);
+    EXPECT_LE(flip->minTimeMs, flip->maxTimeMs);
+    EXPECT_LE(flip->maxTimeMs, flip->totalTimeMs);
+
+    // Capacity smaller than the number of entries
+    int32_t numStats = 0;
+    EXPECT_EQ(NVCV_SUCCESS, cvcudaGetOperatorStats(stats.data(), &numStats));
+    EXPECT_EQ(0, numStats);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaGetOperatorStats(stats.data(), nullptr));
+
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaResetOperatorStats());
+    EXPECT_TRUE(GetStats().empty());
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OperatorStats, sampled_executions_are_counted)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor inTensor  = test::CreateTensor(2, 64, 32, nvcv::FMT_RGB8);
+    nvcv::Tensor outTensor = test::CreateTensor(2, 64, 32, nvcv::FMT_RGB8);
+
+    cvcuda::Flip flipOp;
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaSetOperatorTimingSampling(0));
+
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaResetOperatorStats());
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetOperatorTimingSampling(2));
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetOperatorTimingEnabled(1));
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_NO_THROW(flipOp(stream, inTensor, outTensor, 1));
+    }
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetOperatorTimingEnabled(0));
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetOperatorTimingSampling(1));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    std::vector<NVCVOperatorStats> stats = GetStats();
+    const NVCVOperatorStats       *flip  = FindStats(stats, "Flip");
+    ASSERT_NE(nullptr, flip);
+
+    EXPECT_EQ(2, flip->count);
+    EXPECT_EQ(2, std::accumulate(std::begin(flip->submitHistogram), std::end(flip->submitHistogram), int64_t{0}));
+    EXPECT_LT(0, flip->maxSubmitTimeMs);
+    EXPECT_LE(flip->maxSubmitTimeMs, flip->totalSubmitTimeMs);
+
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaResetOperatorStats());
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+namespace {
+
+struct SinkState
+{
+    std::atomic<int> numCalls{0};
+    std::atomic<int> flipCount{0};
+};
+
+void StatsSink(void *userData, const NVCVOperatorStats *stats, int32_t numStats)
+{
+    auto &state = *static_cast<SinkState *>(userData);
+    for (int32_t i = 0; i < numStats; ++i)
+    {
+        if (std::string(stats[i].name) == "Flip")
+        {
+            state.flipCount = static_cast<int>(stats[i].count);
+        }
+    }
+    ++state.numCalls;
+}
+
+} // namespace
+
+TEST(OperatorStats, sink_is_called_periodically)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor inTensor  = test::CreateTensor(2, 64, 32, nvcv::FMT_RGB8);
+    nvcv::Tensor outTensor = test::CreateTensor(2, 64, 32, nvcv::FMT_RGB8);
+
+    cvcuda::Flip flipOp;
+    SinkState    state;
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaSetOperatorStatsSink(&StatsSink, &state, 0));
+
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaResetOperatorStats());
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetOperatorTimingEnabled(1));
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetOperatorStatsSink(&StatsSink, &state, 10));
+
+    EXPECT_NO_THROW(flipOp(stream, inTensor, outTensor, 0));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    for (int i = 0; i < 1000 && state.flipCount == 0; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetOperatorStatsSink(nullptr, nullptr, 0));
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaSetOperatorTimingEnabled(0));
+
+    EXPECT_EQ(1, state.flipCount);
+
+    // Not called anymore once unset
+    int numCalls = state.numCalls;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(numCalls, state.numCalls);
+
+    ASSERT_EQ(NVCV_SUCCESS, cvcudaResetOperatorStats());
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
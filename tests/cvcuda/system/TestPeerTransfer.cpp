@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <common/TensorDataUtils.hpp>
+#include <cvcuda/PeerTransfer.hpp>
+#include <nvcv/Tensor.hpp>
+
+#include <vector>
+
+namespace test = nvcv::test;
+
+namespace {
+
+const nvcv::ITensorDataStridedCuda &CudaData(const nvcv::ITensor &tensor)
+{
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    EXPECT_NE(data, nullptr);
+    return *data;
+}
+
+// Bytes of every sample of the tensor
+std::vector<std::vector<uint8_t>> SampleBytes(const nvcv::ITensor &tensor)
+{
+    const nvcv::ITensorDataStridedCuda &data = CudaData(tensor);
+
+    std::vector<std::vector<uint8_t>> samples(data.shape(0));
+    for (int64_t i = 0; i < data.shape(0); ++i)
+    {
+        samples[i].resize(data.shape(1) * data.stride(1));
+        EXPECT_EQ(cudaSuccess, cudaMemcpy(samples[i].data(), data.basePtr() + i * data.stride(0), samples[i].size(),
+                                          cudaMemcpyDeviceToHost));
+    }
+    return samples;
+}
+
+} // namespace
+
+TEST(PeerTransfer, gather_and_scatter_round_trip)
+{
+    int device;
+    ASSERT_EQ(cudaSuccess, cudaGetDevice(&device));
+
+    cudaStream_t streams[3];
+    for (cudaStream_t &s : streams)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamCreate(&s));
+    }
+
+    {
+        std::vector<nvcv::Tensor> shards;
+        const int                 numSamples[3] = {2, 1, 3};
+        for (int i = 0; i < 3; ++i)
+        {
+            shards.push_back(test::CreateTensor(numSamples[i], 16, 8, nvcv::FMT_RGB8));
+
+            const nvcv::ITensorDataStridedCuda &data = CudaData(shards.back());
+            ASSERT_EQ(cudaSuccess,
+                      cudaMemsetAsync(data.basePtr(), 0x10 + i, data.shape(0) * data.stride(0), streams[i]));
+        }
+
+        nvcv::Tensor gathered = test::CreateTensor(6, 16, 8, nvcv::FMT_RGB8);
+
+        cvcuda::PeerTransfer peer({device});
+        EXPECT_TRUE(peer.canAccessPeer(device, device));
+
+        peer.gather(streams[0], gathered,
+                    {{&shards[0], streams[0]}, {&shards[1], streams[1]}, {&shards[2], streams[2]}});
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(streams[0]));
+
+        std::vector<std::vector<uint8_t>> samples = SampleBytes(gathered);
+        const uint8_t                     gold[6] = {0x10, 0x10, 0x11, 0x12, 0x12, 0x12};
+        for (int i = 0; i < 6; ++i)
+        {
+            EXPECT_EQ(samples[i], std::vector<uint8_t>(samples[i].size(), gold[i])) << "sample " << i;
+        }
+
+        std::vector<nvcv::Tensor> scattered;
+        for (int i = 0; i < 3; ++i)
+        {
+            scattered.push_back(test::CreateTensor(numSamples[i], 16, 8, nvcv::FMT_RGB8));
+        }
+
+        peer.scatter(streams[0], gathered,
+                     {{&scattered[0], streams[0]}, {&scattered[1], streams[1]}, {&scattered[2], streams[2]}});
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(streams[0]));
+
+        for (int i = 0; i < 3; ++i)
+        {
+            EXPECT_EQ(SampleBytes(scattered[i]), SampleBytes(shards[i])) << "shard " << i;
+        }
+    }
+
+    for (cudaStream_t &s : streams)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamDestroy(s));
+    }
+}
+
+TEST(PeerTransfer, mismatched_shards_throw)
+{
+    int device;
+    ASSERT_EQ(cudaSuccess, cudaGetDevice(&device));
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    {
+        nvcv::Tensor shard    = test::CreateTensor(2, 16, 8, nvcv::FMT_RGB8);
+        nvcv::Tensor narrow   = test::CreateTensor(2, 12, 8, nvcv::FMT_RGB8);
+        nvcv::Tensor gathered = test::CreateTensor(4, 16, 8, nvcv::FMT_RGB8);
+
+        cvcuda::PeerTransfer peer({device});
+
+        // not enough samples
+        EXPECT_THROW(peer.gather(stream, gathered, {{&shard, stream}}), nvcv::Exception);
+
+        // different sample shape
+        EXPECT_THROW(peer.gather(stream, gathered, {{&shard, stream}, {&narrow, stream}}), nvcv::Exception);
+
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
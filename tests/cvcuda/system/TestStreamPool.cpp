@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/StreamPool.hpp>
+
+TEST(StreamPool, streams_follow_the_class_of_the_caller)
+{
+    auto [least, greatest] = cvcuda::StreamPool::PriorityRange();
+    ASSERT_LE(greatest, least);
+
+    cudaStream_t low, high;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithPriority(&low, cudaStreamNonBlocking, least));
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithPriority(&high, cudaStreamNonBlocking, greatest));
+
+    EXPECT_EQ(cvcuda::StreamPriority::LOW, cvcuda::StreamPool::PriorityOf(0));
+    EXPECT_EQ(cvcuda::StreamPriority::LOW, cvcuda::StreamPool::PriorityOf(low));
+    if (greatest < least)
+    {
+        EXPECT_EQ(cvcuda::StreamPriority::HIGH, cvcuda::StreamPool::PriorityOf(high));
+    }
+
+    {
+        cvcuda::StreamPool pool(2);
+        EXPECT_EQ(2, pool.size());
+
+        // streams are created once per class and index
+        cudaStream_t s0 = pool.get(high, 0);
+        EXPECT_EQ(s0, pool.get(high, 0));
+        EXPECT_NE(s0, pool.get(high, 1));
+
+        int priority;
+        ASSERT_EQ(cudaSuccess, cudaStreamGetPriority(s0, &priority));
+        EXPECT_EQ(greatest, priority);
+
+        ASSERT_EQ(cudaSuccess, cudaStreamGetPriority(pool.get(low, 1), &priority));
+        EXPECT_EQ(least, priority);
+        EXPECT_NE(pool.get(low, 1), pool.get(cvcuda::StreamPriority::HIGH, 1));
+
+        unsigned int flags;
+        ASSERT_EQ(cudaSuccess, cudaStreamGetFlags(s0, &flags));
+        EXPECT_EQ(cudaStreamNonBlocking, flags);
+
+        EXPECT_THROW(pool.get(low, 2), nvcv::Exception);
+        EXPECT_THROW(pool.get(low, -1), nvcv::Exception);
+    }
+
+    EXPECT_THROW(cvcuda::StreamPool(0), nvcv::Exception);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(low));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(high));
+}
@@ -0,0 +1,193 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/OpResizeNormalizeReformat.hpp>
+#include <cvcuda/StreamPreprocessor.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+
+#include <random>
+
+namespace {
+
+constexpr int kWidth  = 64;
+constexpr int kHeight = 48;
+
+void FillRandom(nvcv::Tensor &tensor, std::default_random_engine &rng)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(nullptr, data);
+
+    std::uniform_int_distribution<int> udist(0, 255);
+
+    std::vector<uint8_t> bytes(data->stride(0) * data->shape()[0]);
+    std::generate(bytes.begin(), bytes.end(), [&]() { return udist(rng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(data->basePtr(), bytes.data(), bytes.size(), cudaMemcpyHostToDevice));
+}
+
+void FillValue(nvcv::Tensor &tensor, float value)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(nullptr, data);
+
+    std::vector<float> values(data->stride(0) * data->shape()[0] / sizeof(float), value);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(data->basePtr(), values.data(), values.size() * sizeof(float),
+                                      cudaMemcpyHostToDevice));
+}
+
+std::vector<uint8_t> ToHost(const nvcv::ITensor &tensor)
+{
+    const auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    EXPECT_NE(nullptr, data);
+
+    std::vector<uint8_t> bytes(data->stride(0) * data->shape()[0]);
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(bytes.data(), data->basePtr(), bytes.size(), cudaMemcpyDeviceToHost));
+    return bytes;
+}
+
+const void *BasePtr(const nvcv::ITensor &tensor)
+{
+    return dynamic_cast<const nvcv::ITensorDataStridedCuda &>(*tensor.exportData()).basePtr();
+}
+
+} // namespace
+
+TEST(StreamPreprocessor, ring_outputs_match_operator)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    std::default_random_engine rng;
+
+    nvcv::Tensor luma({{1, kHeight, kWidth, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor chroma({{1, kHeight / 2, kWidth / 2, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor base(1, {1, 1}, nvcv::FMT_RGBf32);
+    nvcv::Tensor scale(1, {1, 1}, nvcv::FMT_RGBf32);
+    nvcv::Tensor gold({{1, 3, 24, 32}, nvcv::TENSOR_NCHW}, nvcv::TYPE_F32);
+    FillValue(base, 16.f);
+    FillValue(scale, 2.f);
+
+    NVCVRectI roi{4, 2, 40, 30};
+
+    cvcuda::StreamPreprocessor prep(2, 1, {32, 24}, nvcv::TYPE_F32, base, scale, NVCV_COLOR_YUV2RGB_NV12,
+                                    NVCV_INTERP_LINEAR, 1.f / 255, 0.5f, 0.f, 0, &roi);
+    cvcuda::ResizeNormalizeReformat op;
+
+    EXPECT_EQ(prep.ringDepth(), 2);
+    EXPECT_THROW(prep.current(), nvcv::Exception);
+
+    std::vector<const void *> slots;
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        FillRandom(luma, rng);
+        FillRandom(chroma, rng);
+
+        nvcv::ITensor &out = prep(stream, luma, chroma);
+        op(stream, luma, chroma, &roi, base, scale, gold, NVCV_COLOR_YUV2RGB_NV12, NVCV_INTERP_LINEAR, 1.f / 255,
+           0.5f, 0.f);
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        EXPECT_EQ(&out, &prep.current());
+        EXPECT_EQ(ToHost(out), ToHost(gold));
+        slots.push_back(BasePtr(out));
+    }
+
+    EXPECT_NE(slots[0], slots[1]);
+    EXPECT_EQ(slots[0], slots[2]);
+    EXPECT_EQ(prep.numProcessed(), 3);
+    EXPECT_EQ(prep.numSkipped(), 0);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(StreamPreprocessor, unchanged_crop_reuses_previous_output)
+{
+    std::default_random_engine rng;
+
+    nvcv::Tensor luma({{1, kHeight, kWidth, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor chroma({{1, kHeight / 2, kWidth / 2, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor base(1, {1, 1}, nvcv::FMT_F32);
+    nvcv::Tensor scale(1, {1, 1}, nvcv::FMT_F32);
+    FillRandom(luma, rng);
+    FillRandom(chroma, rng);
+    FillValue(base, 16.f);
+    FillValue(scale, 2.f);
+
+    NVCVRectI roi{0, 0, 32, 32};
+
+    cvcuda::StreamPreprocessor prep(3, 1, {16, 16}, nvcv::TYPE_U8, base, scale, NVCV_COLOR_YUV2BGR_NV12,
+                                    NVCV_INTERP_NEAREST, 1.f, 0.f, 0.f, 0, &roi);
+
+    NVCVRectI none{0, 0, 0, 0};
+    NVCVRectI outside{40, 36, 16, 8};
+    NVCVRectI inside{30, 30, 4, 4};
+
+    // the first frames are always processed
+    nvcv::ITensor *first = &prep(nullptr, luma, chroma, &none);
+    EXPECT_EQ(prep.numProcessed(), 1);
+
+    EXPECT_EQ(&prep(nullptr, luma, chroma, &none), first);
+    EXPECT_EQ(&prep(nullptr, luma, chroma, &outside), first);
+    EXPECT_EQ(prep.numSkipped(), 2);
+
+    nvcv::ITensor *second = &prep(nullptr, luma, chroma, &inside);
+    EXPECT_NE(second, first);
+    EXPECT_EQ(prep.numProcessed(), 2);
+
+    // changing the crop or resetting invalidates the previous output
+    NVCVRectI moved{32, 16, 32, 32};
+    NVCVRectI leftOfMoved{0, 40, 8, 8};
+    prep.setRoi(&moved);
+    nvcv::ITensor *third = &prep(nullptr, luma, chroma, &none);
+    EXPECT_NE(third, second);
+    EXPECT_EQ(&prep(nullptr, luma, chroma, &leftOfMoved), third);
+    EXPECT_EQ(prep.numProcessed(), 3);
+
+    prep.reset();
+    EXPECT_EQ(&prep(nullptr, luma, chroma, &none), first);
+    EXPECT_EQ(prep.numProcessed(), 4);
+    EXPECT_EQ(prep.numSkipped(), 3);
+
+    EXPECT_EQ(cudaSuccess, cudaDeviceSynchronize());
+}
+
+TEST(StreamPreprocessor, invalid_arguments_are_rejected)
+{
+    nvcv::Tensor luma({{1, 16, 16, 1}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor chroma({{1, 8, 8, 2}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    nvcv::Tensor base(1, {1, 1}, nvcv::FMT_F32);
+    nvcv::Tensor scale(1, {1, 1}, nvcv::FMT_F32);
+
+    EXPECT_THROW(cvcuda::StreamPreprocessor(0, 1, {8, 8}, nvcv::TYPE_F32, base, scale, NVCV_COLOR_YUV2RGB_NV12,
+                                            NVCV_INTERP_LINEAR, 1.f, 0.f, 0.f),
+                 nvcv::Exception);
+    EXPECT_THROW(cvcuda::StreamPreprocessor(2, 1, {0, 8}, nvcv::TYPE_F32, base, scale, NVCV_COLOR_YUV2RGB_NV12,
+                                            NVCV_INTERP_LINEAR, 1.f, 0.f, 0.f),
+                 nvcv::Exception);
+
+    // a failed submission doesn't advance the ring
+    NVCVRectI outsideRoi{10, 0, 8, 8};
+    cvcuda::StreamPreprocessor prep(2, 1, {8, 8}, nvcv::TYPE_F32, base, scale, NVCV_COLOR_YUV2RGB_NV12,
+                                    NVCV_INTERP_LINEAR, 1.f, 0.f, 0.f, 0, &outsideRoi);
+    EXPECT_THROW(prep(nullptr, luma, chroma), nvcv::Exception);
+    EXPECT_EQ(prep.numProcessed(), 0);
+    EXPECT_THROW(prep.current(), nvcv::Exception);
+
+    EXPECT_EQ(cudaSuccess, cudaDeviceSynchronize());
+}
@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/OpCvtColor.hpp>
+#include <cvcuda/OpGaussian.hpp>
+#include <cvcuda/OpResize.hpp>
+#include <cvcuda/TiledProcessor.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorData.hpp>
+
+#include <random>
+
+namespace {
+
+const nvcv::Size2D kImageSize{1000, 776};
+const nvcv::Size2D kOutSize{500, 388};
+const nvcv::Size2D kKernelSize{5, 5};
+const double2      kSigma{1.2, 1.2};
+
+void BuildChain(cvcuda::TiledProcessor &tiled)
+{
+    tiled.addGaussian(kKernelSize, kSigma, NVCV_BORDER_REFLECT101)
+        .addCvtColor(NVCV_COLOR_RGB2GRAY, nvcv::FMT_U8)
+        .addResize(kOutSize, NVCV_INTERP_LINEAR);
+}
+
+} // namespace
+
+TEST(TiledProcessor, tiles_cover_output_and_align_to_resize_steps)
+{
+    cvcuda::TiledProcessor tiled(kImageSize, nvcv::FMT_RGB8, {128, 100});
+    BuildChain(tiled);
+
+    EXPECT_EQ(kOutSize, tiled.outSize());
+    EXPECT_EQ(nvcv::FMT_U8, tiled.outFormat());
+
+    std::vector<cvcuda::TiledProcessor::Tile> tiles = tiled.tiles();
+    ASSERT_EQ(4u * 4u, tiles.size());
+
+    int64_t area = 0;
+    for (const cvcuda::TiledProcessor::Tile &tile : tiles)
+    {
+        ASSERT_EQ(3u, tile.in.size());
+        ASSERT_EQ(3u, tile.out.size());
+        area += static_cast<int64_t>(tile.result.width) * tile.result.height;
+
+        // gaussian reads its radius around what the next stages need, clipped to the image
+        EXPECT_LE(0, tile.in[0].x);
+        EXPECT_LE(tile.in[0].x + tile.in[0].width, kImageSize.w);
+        EXPECT_TRUE(tile.in[0].x == 0 || tile.in[0].x <= tile.in[1].x - kKernelSize.w / 2);
+
+        // resize by half reads from even coordinates and covers the result
+        EXPECT_EQ(0, tile.in[2].x % 2);
+        EXPECT_EQ(0, tile.in[2].y % 2);
+        EXPECT_LE(tile.out[2].x, tile.result.x);
+        EXPECT_GE(tile.out[2].x + tile.out[2].width, tile.result.x + tile.result.width);
+    }
+    EXPECT_EQ(static_cast<int64_t>(kOutSize.w) * kOutSize.h, area);
+}
+
+TEST(TiledProcessor, matches_whole_image_processing)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int64_t srcRowStride = kImageSize.w * 3;
+    const int64_t dstRowStride = kOutSize.w;
+
+    std::vector<uint8_t>               srcVec(srcRowStride * kImageSize.h);
+    std::default_random_engine         rng(0);
+    std::uniform_int_distribution<int> rand(0, 255);
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(rng); });
+
+    // whole image on the device
+    nvcv::Tensor src(1, kImageSize, nvcv::FMT_RGB8);
+    nvcv::Tensor blurred(1, kImageSize, nvcv::FMT_RGB8);
+    nvcv::Tensor gray(1, kImageSize, nvcv::FMT_U8);
+    nvcv::Tensor dst(1, kOutSize, nvcv::FMT_U8);
+
+    const auto *srcData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(src.exportData());
+    const auto *dstData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(dst.exportData());
+    ASSERT_NE(nullptr, srcData);
+    ASSERT_NE(nullptr, dstData);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->basePtr(), srcData->stride(1), srcVec.data(), srcRowStride,
+                                        srcRowStride, kImageSize.h, cudaMemcpyHostToDevice));
+
+    cvcuda::Gaussian gaussianOp(kKernelSize, 1);
+    cvcuda::CvtColor cvtColorOp;
+    cvcuda::Resize   resizeOp;
+    EXPECT_NO_THROW(gaussianOp(stream, src, blurred, kKernelSize, kSigma, NVCV_BORDER_REFLECT101));
+    EXPECT_NO_THROW(cvtColorOp(stream, blurred, gray, NVCV_COLOR_RGB2GRAY));
+    EXPECT_NO_THROW(resizeOp(stream, gray, dst, NVCV_INTERP_LINEAR));
+
+    std::vector<uint8_t> goldVec(dstRowStride * kOutSize.h);
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(goldVec.data(), dstRowStride, dstData->basePtr(), dstData->stride(1),
+                                        dstRowStride, kOutSize.h, cudaMemcpyDeviceToHost));
+
+    // tile sizes not dividing the image, so the last tiles are partial
+    cvcuda::TiledProcessor tiled(kImageSize, nvcv::FMT_RGB8, {96, 70});
+    BuildChain(tiled);
+
+    std::vector<uint8_t> testVec(dstRowStride * kOutSize.h, 0);
+    EXPECT_NO_THROW(tiled(stream, srcVec.data(), srcRowStride, testVec.data(), dstRowStride));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    EXPECT_EQ(goldVec, testVec);
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(TiledProcessor, invalid_arguments_are_rejected)
+{
+    EXPECT_THROW(cvcuda::TiledProcessor({0, 10}, nvcv::FMT_RGB8, {8, 8}), nvcv::Exception);
+    EXPECT_THROW(cvcuda::TiledProcessor({10, 10}, nvcv::FMT_NV12, {8, 8}), nvcv::Exception);
+
+    cvcuda::TiledProcessor tiled({10, 10}, nvcv::FMT_RGB8, {8, 8});
+    EXPECT_THROW(tiled.addStage({{10, 10}, nvcv::FMT_RGB8, {-1, 0}, nullptr}), nvcv::Exception);
+}
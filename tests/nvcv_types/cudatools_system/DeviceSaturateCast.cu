@@ -93,4 +93,9 @@ NVCV_TEST_INST(char2, uint2);
 NVCV_TEST_INST(uchar2, ulonglong2);
 NVCV_TEST_INST(char2, long2);
 
+NVCV_TEST_INST(__half, float);
+NVCV_TEST_INST(__half, unsigned char);
+NVCV_TEST_INST(unsigned char, __half);
+NVCV_TEST_INST(short, __half);
+
 #undef NVCV_TEST_INST
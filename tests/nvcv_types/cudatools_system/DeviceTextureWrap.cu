@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeviceTextureWrap.hpp" // to test in the device
+
+#include <gtest/gtest.h>             // for EXPECT_EQ, etc.
+#include <nvcv/cuda/StaticCast.hpp>  // for StaticCast, etc.
+#include <nvcv/cuda/TensorWrap.hpp>  // for Tensor3DWrap, etc.
+#include <nvcv/cuda/TextureWrap.hpp> // the object of this test
+
+namespace cuda = nvcv::cuda;
+
+// ----------------- To allow testing device-side TextureWrap ------------------
+
+template<class DstWrapper, class SrcWrapper>
+__global__ void TextureFetch(DstWrapper dst, SrcWrapper src, int3 dstSize, float2 origin, float2 step)
+{
+    int3 dstCoord = cuda::StaticCast<int>(blockIdx * blockDim + threadIdx);
+
+    if (dstCoord.z >= dstSize.z || dstCoord.y >= dstSize.y || dstCoord.x >= dstSize.x)
+    {
+        return;
+    }
+
+    float3 srcCoord{origin.x + dstCoord.x * step.x, origin.y + dstCoord.y * step.y, static_cast<float>(dstCoord.z)};
+
+    dst[dstCoord] = src[srcCoord];
+}
+
+template<class DstWrapper, class SrcWrapper>
+void DeviceRunTextureFetch(DstWrapper &dstWrap, SrcWrapper &srcWrap, int3 dstSize, float2 origin, float2 step,
+                           cudaStream_t &stream)
+{
+    dim3 block{32, 2, 2};
+    dim3 grid{(dstSize.x + block.x - 1) / block.x, (dstSize.y + block.y - 1) / block.y,
+              (dstSize.z + block.z - 1) / block.z};
+
+    TextureFetch<<<grid, block, 0, stream>>>(dstWrap, srcWrap, dstSize, origin, step);
+}
+
+// Need to instantiate each test on TestTextureWrap
+
+#define NVCV_TEST_INST(DSTWRAPPER, SRCWRAPPER) \
+    template void DeviceRunTextureFetch(DSTWRAPPER &, SRCWRAPPER &, int3, float2, float2, cudaStream_t &)
+
+#define TEX(VALUETYPE, BORDERTYPE, FILTERMODE) cuda::TextureWrap<VALUETYPE, BORDERTYPE, FILTERMODE>
+
+NVCV_TEST_INST(cuda::Tensor3DWrap<float>, TEX(float, NVCV_BORDER_CONSTANT, cudaFilterModePoint));
+NVCV_TEST_INST(cuda::Tensor3DWrap<float>, TEX(unsigned char, NVCV_BORDER_REPLICATE, cudaFilterModePoint));
+NVCV_TEST_INST(cuda::Tensor3DWrap<float>, TEX(float, NVCV_BORDER_CONSTANT, cudaFilterModeLinear));
+NVCV_TEST_INST(cuda::Tensor3DWrap<float>, TEX(unsigned char, NVCV_BORDER_REPLICATE, cudaFilterModeLinear));
+
+#undef TEX
+
+#undef NVCV_TEST_INST
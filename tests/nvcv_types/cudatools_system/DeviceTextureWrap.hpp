@@ -0,0 +1,28 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_TESTS_DEVICE_TEXTURE_WRAP_HPP
+#define NVCV_TESTS_DEVICE_TEXTURE_WRAP_HPP
+
+#include <cuda_runtime.h> // for cudaStream_t, etc.
+
+// Runs dst[x, y, z] = src[float3{origin.x + x * step.x, origin.y + y * step.y, z}] over the dstSize output.
+template<class DstWrapper, class SrcWrapper>
+void DeviceRunTextureFetch(DstWrapper &dstWrap, SrcWrapper &srcWrap, int3 dstSize, float2 origin, float2 step,
+                           cudaStream_t &stream);
+
+#endif // NVCV_TESTS_DEVICE_TEXTURE_WRAP_HPP
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeviceVectorizedAccess.hpp" // to test in the device
+
+#include <gtest/gtest.h>                  // for EXPECT_EQ, etc.
+#include <nvcv/cuda/VectorizedAccess.hpp> // the object of this test
+
+namespace cuda = nvcv::cuda;
+
+// --------------- To allow testing device-side TransformRowVector -------------
+
+template<int N, int NC, typename T>
+__global__ void RunTransformRowVector(T *dst, const T *src, int rowLength)
+{
+    int chunkIdx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    cuda::TransformRowVector<N, NC>(dst, src, rowLength, chunkIdx, [](T v, int c) { return static_cast<T>(v + c); });
+}
+
+template<int N, int NC, typename T>
+std::vector<T> DeviceRunTransformRowVector(const std::vector<T> &src, int offset)
+{
+    int            rowLength = static_cast<int>(src.size());
+    std::vector<T> dst(src.size());
+
+    T *dSrc, *dDst;
+
+    EXPECT_EQ(cudaSuccess, cudaMalloc(&dSrc, (rowLength + offset) * sizeof(T)));
+    EXPECT_EQ(cudaSuccess, cudaMalloc(&dDst, (rowLength + offset) * sizeof(T)));
+
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(dSrc + offset, src.data(), rowLength * sizeof(T), cudaMemcpyHostToDevice));
+
+    int numChunks = (rowLength + N - 1) / N;
+    RunTransformRowVector<N, NC><<<(numChunks + 31) / 32, 32>>>(dDst + offset, dSrc + offset, rowLength);
+
+    EXPECT_EQ(cudaSuccess, cudaDeviceSynchronize());
+    EXPECT_EQ(cudaSuccess, cudaMemcpy(dst.data(), dDst + offset, rowLength * sizeof(T), cudaMemcpyDeviceToHost));
+
+    EXPECT_EQ(cudaSuccess, cudaFree(dSrc));
+    EXPECT_EQ(cudaSuccess, cudaFree(dDst));
+
+    return dst;
+}
+
+#define NVCV_TEST_INST(N, NC, TYPE) \
+    template std::vector<TYPE> DeviceRunTransformRowVector<N, NC, TYPE>(const std::vector<TYPE> &, int)
+
+NVCV_TEST_INST(16, 1, unsigned char);
+NVCV_TEST_INST(48, 3, unsigned char);
+NVCV_TEST_INST(12, 3, float);
+NVCV_TEST_INST(8, 4, short);
+
+#undef NVCV_TEST_INST
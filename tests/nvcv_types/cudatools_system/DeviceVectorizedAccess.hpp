@@ -0,0 +1,28 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_TESTS_DEVICE_VECTORIZED_ACCESS_HPP
+#define NVCV_TESTS_DEVICE_VECTORIZED_ACCESS_HPP
+
+#include <vector>
+
+// Runs TransformRowVector<N, NC> over src with dst[i] = src[i] + channel(i), where the device copies of source and
+// destination are shifted by offset elements from an aligned allocation.
+template<int N, int NC, typename T>
+std::vector<T> DeviceRunTransformRowVector(const std::vector<T> &src, int offset);
+
+#endif // NVCV_TESTS_DEVICE_VECTORIZED_ACCESS_HPP
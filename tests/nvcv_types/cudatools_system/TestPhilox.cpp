@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <nvcv/cuda/Philox.hpp> // the object of this test
+
+#include <set>
+#include <vector>
+
+namespace cuda = nvcv::cuda;
+
+// -------------------------- Testing Philox4x32 -------------------------------
+
+// Known answers of the Random123 reference implementation
+TEST(PhiloxTest, philox4x32_known_answers)
+{
+    struct KnownAnswer
+    {
+        uint4 ctr;
+        uint2 key;
+        uint4 out;
+    };
+
+    const std::vector<KnownAnswer> answers = {
+        {{0, 0, 0, 0}, {0, 0}, {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}},
+        {{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+         {0xffffffff, 0xffffffff},
+         {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}},
+        {{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+         {0xa4093822, 0x299f31d0},
+         {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}},
+    };
+
+    for (const KnownAnswer &a : answers)
+    {
+        const uint4 out = cuda::Philox4x32(a.ctr, a.key);
+        EXPECT_EQ(a.out.x, out.x);
+        EXPECT_EQ(a.out.y, out.y);
+        EXPECT_EQ(a.out.z, out.z);
+        EXPECT_EQ(a.out.w, out.w);
+    }
+}
+
+// ---------------------------- Testing Philox ---------------------------------
+
+TEST(PhiloxTest, stream_is_sequence_of_blocks)
+{
+    const uint64_t seed = 0x299f31d0a4093822ull, subsequence = 0x0370734413198a2eull;
+
+    cuda::Philox rng(seed, subsequence, 0xffffffffull);
+
+    const uint2 key = {0xa4093822, 0x299f31d0};
+    for (uint32_t block = 0; block < 3; ++block)
+    {
+        // the offset carries over to its upper 32 bits
+        const uint64_t offset = 0xffffffffull + block;
+        const uint4    ref    = cuda::Philox4x32(
+            {static_cast<uint32_t>(offset), static_cast<uint32_t>(offset >> 32), 0x13198a2e, 0x03707344}, key);
+
+        EXPECT_EQ(ref.x, rng());
+        EXPECT_EQ(ref.y, rng());
+        EXPECT_EQ(ref.z, rng());
+        EXPECT_EQ(ref.w, rng());
+    }
+}
+
+TEST(PhiloxTest, subsequences_are_independent)
+{
+    std::set<uint32_t> first;
+    for (uint64_t sample = 0; sample < 64; ++sample)
+    {
+        cuda::Philox rng(1234, sample);
+        first.insert(rng());
+    }
+    EXPECT_EQ(64u, first.size());
+
+    cuda::Philox a(1234, 7), b(1234, 7), c(4321, 7);
+    for (int i = 0; i < 10; ++i)
+    {
+        const uint32_t va = a(), vb = b(), vc = c();
+        EXPECT_EQ(va, vb);
+        EXPECT_NE(va, vc);
+    }
+}
+
+TEST(PhiloxTest, uniform_in_range)
+{
+    cuda::Philox rng(42, 0);
+
+    double sum = 0;
+    for (int i = 0; i < 10000; ++i)
+    {
+        const float u = rng.uniform();
+        ASSERT_GE(u, 0.f);
+        ASSERT_LT(u, 1.f);
+
+        const float v = rng.uniform(-3.f, 5.f);
+        ASSERT_GE(v, -3.f);
+        ASSERT_LT(v, 5.f);
+
+        const double d = rng.uniformDouble();
+        ASSERT_GE(d, 0.0);
+        ASSERT_LT(d, 1.0);
+
+        sum += u;
+    }
+    EXPECT_NEAR(0.5, sum / 10000, 0.01);
+}
@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <nvcv/cuda/MathOps.hpp>   // for operator ==, etc.
+#include <nvcv/cuda/Pointwise.hpp> // the object of this test
+
+#include <vector>
+
+namespace cuda = nvcv::cuda;
+
+// -------------------------- Testing Compose ----------------------------------
+
+TEST(PointwiseComposeTest, empty_is_identity)
+{
+    EXPECT_EQ(cuda::Compose()(uchar3{1, 2, 3}), (uchar3{1, 2, 3}));
+}
+
+TEST(PointwiseComposeTest, applies_left_to_right)
+{
+    auto op = cuda::Compose(cuda::ScaleShiftOp<float>{2.f, 1.f}, cuda::ScaleShiftOp<float>{3.f, 0.f});
+
+    EXPECT_EQ(op(2.f), 15.f);
+}
+
+TEST(PointwiseComposeTest, convert_to_saturates_like_convertor)
+{
+    auto op = cuda::Compose(cuda::ScaleShiftOp<float>{2.f, -10.f}, cuda::SaturateOp<unsigned char>{});
+
+    auto res = op(uchar3{3, 100, 200});
+
+    static_assert(std::is_same_v<decltype(res), uchar3>);
+    EXPECT_EQ(res, (uchar3{0, 190, 255}));
+}
+
+TEST(PointwiseComposeTest, convert_gamma_normalize_chain)
+{
+    auto op = cuda::Compose(cuda::ScaleShiftOp<float>{1.f / 255, 0.f}, cuda::GammaOp{2.f, 1.f},
+                            cuda::NormalizeOp<float3>{float3{0.f, 0.25f, 0.5f}, float3{1.f, 2.f, 4.f}});
+
+    auto res = op(uchar3{0, 255, 255});
+
+    static_assert(std::is_same_v<decltype(res), float3>);
+    EXPECT_FLOAT_EQ(res.x, 0.f);
+    EXPECT_FLOAT_EQ(res.y, 1.5f);
+    EXPECT_FLOAT_EQ(res.z, 2.f);
+}
+
+TEST(PointwiseGammaTest, range_of_8bit_values)
+{
+    EXPECT_FLOAT_EQ((cuda::GammaOp{2.f, 255.f}(255.f)), 255.f);
+    EXPECT_FLOAT_EQ((cuda::GammaOp{1.f, 255.f}(static_cast<unsigned char>(51))), 51.f);
+}
+
+// ------------------------- Testing ReorderOp ---------------------------------
+
+TEST(PointwiseReorderTest, swaps_channels)
+{
+    EXPECT_EQ((cuda::ReorderOp<2, 1, 0>{}(uchar3{1, 2, 3})), (uchar3{3, 2, 1}));
+}
+
+TEST(PointwiseReorderTest, changes_channel_count)
+{
+    auto res = cuda::ReorderOp<2, 1, 0, 0>{}(float3{1.f, 2.f, 3.f});
+
+    static_assert(std::is_same_v<decltype(res), float4>);
+    EXPECT_EQ(res, (float4{3.f, 2.f, 1.f, 1.f}));
+}
+
+// ------------------------ Testing PixelChain ---------------------------------
+
+namespace {
+
+// Minimal host wrapper with the same ptr interface as TensorWrap, for a single 3x2 image
+template<typename T>
+struct HostImage
+{
+    std::vector<T> data = std::vector<T>(6);
+
+    T *ptr(int s, int y, int x)
+    {
+        return &data[(s * 2 + y) * 3 + x];
+    }
+
+    const T *ptr(int s, int y, int x) const
+    {
+        return &data[(s * 2 + y) * 3 + x];
+    }
+};
+
+} // namespace
+
+TEST(PointwisePixelChainTest, flip_then_reorder)
+{
+    HostImage<uchar3> src, dst;
+    for (int i = 0; i < 6; ++i)
+    {
+        src.data[i] = uchar3{static_cast<unsigned char>(i), 0, 10};
+    }
+
+    auto chain = cuda::MakePixelChain(cuda::FlipCoordOp{1, int2{3, 2}}, cuda::ReorderOp<2, 1, 0>{});
+
+    for (int y = 0; y < 2; ++y)
+    {
+        for (int x = 0; x < 3; ++x)
+        {
+            chain(dst, src, int3{x, y, 0});
+        }
+    }
+
+    EXPECT_EQ(*dst.ptr(0, 0, 0), (uchar3{10, 0, 2}));
+    EXPECT_EQ(*dst.ptr(0, 1, 2), (uchar3{10, 0, 3}));
+}
+
+TEST(PointwisePixelChainTest, flip_both_axes)
+{
+    cuda::FlipCoordOp flip{-1, int2{3, 2}};
+
+    EXPECT_EQ(flip(int3{0, 0, 5}), (int3{2, 1, 5}));
+    EXPECT_EQ((cuda::FlipCoordOp{0, int2{3, 2}}(int3{0, 0, 0})), (int3{0, 1, 0}));
+}
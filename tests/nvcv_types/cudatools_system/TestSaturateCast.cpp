@@ -21,6 +21,8 @@
 #include <nvcv/cuda/MathOps.hpp>      // for operator == to allow EXPECT_EQ
 #include <nvcv/cuda/SaturateCast.hpp> // the object of this test
 
+#include <cmath> // for std::isinf, etc.
+
 namespace cuda  = nvcv::cuda;
 namespace ttype = nvcv::test::type;
 
@@ -104,3 +106,29 @@ TYPED_TEST(SaturateCastTest, correct_output_in_device)
     EXPECT_TRUE((std::is_same_v<decltype(test), decltype(gold)>));
     EXPECT_EQ(test, gold);
 }
+
+// ------------------- Testing SaturateCast with __half ------------------------
+
+// __half has no host-side comparison operators, results are compared as float
+
+TEST(SaturateCastHalfTest, correct_output_in_host)
+{
+    EXPECT_EQ(-1.5f, __half2float(cuda::SaturateCast<__half>(-1.5f)));
+    EXPECT_EQ(1234.f, __half2float(cuda::SaturateCast<__half>(1234)));
+    EXPECT_EQ(255.f, __half2float(cuda::SaturateCast<__half>(static_cast<unsigned char>(255))));
+    EXPECT_TRUE(std::isinf(__half2float(cuda::SaturateCast<__half>(1e6))));
+
+    EXPECT_EQ(2.5f, cuda::SaturateCast<float>(__float2half(2.5f)));
+    EXPECT_EQ(static_cast<unsigned char>(255), cuda::SaturateCast<unsigned char>(__float2half(300.f)));
+    EXPECT_EQ(static_cast<unsigned char>(0), cuda::SaturateCast<unsigned char>(__float2half(-3.f)));
+    EXPECT_EQ(short{-2}, cuda::SaturateCast<short>(__float2half(-1.75f)));
+}
+
+TEST(SaturateCastHalfTest, correct_output_in_device)
+{
+    EXPECT_EQ(-1.5f, __half2float(DeviceRunSaturateCast<__half>(-1.5f)));
+    EXPECT_EQ(255.f, __half2float(DeviceRunSaturateCast<__half>(static_cast<unsigned char>(255))));
+
+    EXPECT_EQ(static_cast<unsigned char>(255), DeviceRunSaturateCast<unsigned char>(__float2half(300.f)));
+    EXPECT_EQ(short{-2}, DeviceRunSaturateCast<short>(__float2half(-1.75f)));
+}
@@ -1227,3 +1227,36 @@ TEST_P(CreateTensorWrapNHWxTests, correct_properties_in_nhwc)
     EXPECT_EQ(wrap.strides()[1], tensorAccess->rowStride());
     EXPECT_EQ(wrap.strides()[2], tensorAccess->colStride());
 }
+
+// --------------------- Testing TensorWrap with 64-bit strides -----------------
+
+TEST(Tensor3DWrap64Test, offsets_beyond_2GB_dont_overflow)
+{
+    // Pointers are only compared, the wrapped memory is never accessed
+    static unsigned char data[1];
+
+    const int64_t imgStride = int64_t{3} << 30;
+    const int     rowStride = 1 << 16;
+
+    cuda::Tensor3DWrap<const unsigned char, int64_t> wrap(data, imgStride, rowStride);
+
+    static_assert(std::is_same_v<decltype(wrap)::StrideT, int64_t>);
+
+    EXPECT_EQ(wrap.strides()[0], imgStride);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(wrap.ptr(2, 40000, 7)) - reinterpret_cast<uintptr_t>(data),
+              2 * imgStride + int64_t{40000} * rowStride + 7);
+}
+
+TEST(Tensor3DWrap64Test, needs_large_offsets_only_above_2GB)
+{
+    nvcv::Tensor small(nvcv::TensorShape{{4, 64, 32, 3}, "NHWC"}, nvcv::TYPE_U8);
+
+    const auto *dev = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(small.exportData());
+    ASSERT_NE(dev, nullptr);
+
+    EXPECT_FALSE(cuda::NeedsLargeOffsets(*dev));
+
+    auto wrap = cuda::CreateTensorWrapNHW<const unsigned char, int64_t>(*dev);
+    EXPECT_EQ(wrap.ptr(1, 2), reinterpret_cast<const unsigned char *>(dev->basePtr()) + dev->stride(0)
+                                                                                 + 2 * dev->stride(1));
+}
@@ -0,0 +1,189 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeviceTextureWrap.hpp" // to test in the device
+
+#include <common/TensorDataUtils.hpp> // for test::CreateTensor, etc.
+#include <gtest/gtest.h>             // for EXPECT_EQ, etc.
+#include <nvcv/Tensor.hpp>            // for Tensor, etc.
+#include <nvcv/TensorDataAccess.hpp>  // for TensorDataAccessStridedImagePlanar, etc.
+#include <nvcv/cuda/TensorWrap.hpp>   // for Tensor3DWrap, etc.
+#include <nvcv/cuda/TextureWrap.hpp>  // the object of this test
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace cuda = nvcv::cuda;
+namespace test = nvcv::test;
+
+// ---------------------------- Testing TextureWrap ----------------------------
+
+// Reads the single-channel sample z of src, of size.x columns and size.y rows, at (x, y) with the border B.
+template<NVCVBorderType B>
+float GoldPixel(const std::vector<float> &src, int3 size, int x, int y, int z, float borderValue)
+{
+    if (B == NVCV_BORDER_CONSTANT && (x < 0 || x >= size.x || y < 0 || y >= size.y))
+    {
+        return borderValue;
+    }
+
+    x = std::clamp(x, 0, size.x - 1);
+    y = std::clamp(y, 0, size.y - 1);
+
+    return src[(z * size.y + y) * size.x + x];
+}
+
+template<NVCVBorderType B, cudaTextureFilterMode F>
+float GoldFetch(const std::vector<float> &src, int3 size, float x, float y, int z, float borderValue)
+{
+    if (F == cudaFilterModePoint)
+    {
+        return GoldPixel<B>(src, size, std::floor(x + 0.5f), std::floor(y + 0.5f), z, borderValue);
+    }
+
+    int   x0 = std::floor(x), y0 = std::floor(y);
+    float fx = x - x0, fy = y - y0;
+
+    return (1 - fx) * (1 - fy) * GoldPixel<B>(src, size, x0, y0, z, borderValue)
+         + fx * (1 - fy) * GoldPixel<B>(src, size, x0 + 1, y0, z, borderValue)
+         + (1 - fx) * fy * GoldPixel<B>(src, size, x0, y0 + 1, z, borderValue)
+         + fx * fy * GoldPixel<B>(src, size, x0 + 1, y0 + 1, z, borderValue);
+}
+
+// Fetches a single-channel input of type T through the texture wrap at dstSize positions starting at origin and
+// spaced by step, and compares them with the gold fetches.
+template<typename T, NVCVBorderType B, cudaTextureFilterMode F>
+void TestTextureFetch(nvcv::ImageFormat format, int3 srcSize, int3 dstSize, float2 origin, float2 step,
+                      float tolerance)
+{
+    nvcv::Tensor srcTensor = test::CreateTensor(srcSize.z, srcSize.x, srcSize.y, format);
+    nvcv::Tensor dstTensor = test::CreateTensor(dstSize.z, dstSize.x, dstSize.y, nvcv::FMT_F32);
+
+    const auto *srcDev = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(srcTensor.exportData());
+    const auto *dstDev = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(dstTensor.exportData());
+
+    ASSERT_NE(srcDev, nullptr);
+    ASSERT_NE(dstDev, nullptr);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcDev);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstDev);
+
+    ASSERT_TRUE(srcAccess);
+    ASSERT_TRUE(dstAccess);
+
+    // integer values are exact in both 8-bit and float inputs
+    std::vector<float> srcVec(srcSize.x * srcSize.y * srcSize.z);
+
+    std::default_random_engine         randEng{0};
+    std::uniform_int_distribution<int> srcRand{0, 255};
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return srcRand(randEng); });
+
+    std::vector<T> srcHost(srcVec.begin(), srcVec.end());
+
+    for (int z = 0; z < srcSize.z; ++z)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(z), srcAccess->rowStride(),
+                                            srcHost.data() + z * srcSize.x * srcSize.y, srcSize.x * sizeof(T),
+                                            srcSize.x * sizeof(T), srcSize.y, cudaMemcpyHostToDevice));
+    }
+
+    constexpr float kBorderValue = 77;
+
+    auto srcWrap = cuda::CreateTextureWrapNHW<T, B, F>(*srcDev, kBorderValue);
+    auto dstWrap = cuda::CreateTensorWrapNHW<float>(*dstDev);
+
+    ASSERT_TRUE(srcWrap);
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    DeviceRunTextureFetch(dstWrap, *srcWrap, dstSize, origin, step, stream);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<float> test(dstSize.x * dstSize.y * dstSize.z);
+
+    for (int z = 0; z < dstSize.z; ++z)
+    {
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(test.data() + z * dstSize.x * dstSize.y, dstSize.x * sizeof(float),
+                                            dstAccess->sampleData(z), dstAccess->rowStride(),
+                                            dstSize.x * sizeof(float), dstSize.y, cudaMemcpyDeviceToHost));
+    }
+
+    for (int z = 0; z < dstSize.z; ++z)
+    {
+        for (int y = 0; y < dstSize.y; ++y)
+        {
+            for (int x = 0; x < dstSize.x; ++x)
+            {
+                float gold = GoldFetch<B, F>(srcVec, srcSize, origin.x + x * step.x, origin.y + y * step.y, z,
+                                             kBorderValue);
+
+                ASSERT_NEAR(test[(z * dstSize.y + y) * dstSize.x + x], gold, tolerance)
+                    << "at x=" << x << " y=" << y << " z=" << z;
+            }
+        }
+    }
+}
+
+TEST(TextureWrapNHWTest, point_constant_float)
+{
+    TestTextureFetch<float, NVCV_BORDER_CONSTANT, cudaFilterModePoint>(nvcv::FMT_F32, {64, 13, 3}, {70, 19, 3},
+                                                                       {-2.3f, -2.6f}, {1.f, 1.f}, 0.f);
+}
+
+TEST(TextureWrapNHWTest, point_replicate_uchar)
+{
+    TestTextureFetch<unsigned char, NVCV_BORDER_REPLICATE, cudaFilterModePoint>(
+        nvcv::FMT_U8, {64, 20, 2}, {60, 20, 2}, {-4.f, -4.f}, {1.25f, 1.25f}, 0.f);
+}
+
+// the texture units interpolate with 8-bit fixed-point weights, up to 1/256 of the 0..255 input range per axis
+TEST(TextureWrapNHWTest, linear_constant_float)
+{
+    TestTextureFetch<float, NVCV_BORDER_CONSTANT, cudaFilterModeLinear>(nvcv::FMT_F32, {64, 13, 3}, {224, 53, 3},
+                                                                        {-1.5f, -1.5f}, {0.3f, 0.3f}, 2.f);
+}
+
+TEST(TextureWrapNHWTest, linear_replicate_uchar)
+{
+    TestTextureFetch<unsigned char, NVCV_BORDER_REPLICATE, cudaFilterModeLinear>(
+        nvcv::FMT_U8, {64, 20, 2}, {100, 35, 2}, {-2.f, -2.f}, {0.7f, 0.7f}, 2.f);
+}
+
+TEST(TextureWrapNHWTest, texture_is_cached)
+{
+    nvcv::Tensor tensor = test::CreateTensor(2, 64, 16, nvcv::FMT_U8);
+
+    const auto *dev = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(dev, nullptr);
+
+    auto point0 = cuda::CreateTextureWrapNHW<unsigned char, NVCV_BORDER_REPLICATE>(*dev);
+    auto point1 = cuda::CreateTextureWrapNHW<unsigned char, NVCV_BORDER_CONSTANT>(*dev);
+    auto linear = cuda::CreateTextureWrapNHW<unsigned char, NVCV_BORDER_REPLICATE, cudaFilterModeLinear>(*dev);
+
+    ASSERT_TRUE(point0 && point1 && linear);
+
+    // the border is handled by the wrap, only the filter mode changes the texture object
+    EXPECT_EQ(point0->texture(), point1->texture());
+    EXPECT_NE(point0->texture(), linear->texture());
+    EXPECT_EQ(16, point0->numRows());
+    EXPECT_EQ(64, point0->numCols());
+}
@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeviceVectorizedAccess.hpp" // to test in the device
+
+#include <common/TypedTests.hpp>          // for NVCV_TYPED_TEST_SUITE, etc.
+#include <nvcv/Tensor.hpp>                // for Tensor, etc.
+#include <nvcv/cuda/VectorizedAccess.hpp> // the object of this test
+
+#include <numeric>
+
+namespace cuda  = nvcv::cuda;
+namespace ttype = nvcv::test::type;
+
+// -------------------------- Testing VectorWidth ------------------------------
+
+static_assert(cuda::VectorWidth<1, unsigned char> == 16);
+static_assert(cuda::VectorWidth<3, unsigned char> == 48);
+static_assert(cuda::VectorWidth<4, unsigned char> == 16);
+static_assert(cuda::VectorWidth<3, unsigned char, float> == 12);
+static_assert(cuda::VectorWidth<4, float> == 4);
+static_assert(cuda::VectorWidth<3, double> == 6);
+
+static_assert(alignof(cuda::Vector<unsigned char, 16>) == 16);
+static_assert(alignof(cuda::Vector<unsigned char, 12>) == 4);
+static_assert(alignof(cuda::Vector<float, 12>) == 16);
+static_assert(sizeof(cuda::Vector<unsigned char, 48>) == 48);
+
+// ------------------------ Testing IsVectorAligned ----------------------------
+
+TEST(IsVectorAlignedTest, pointer_and_stride)
+{
+    alignas(16) unsigned char buffer[32];
+
+    EXPECT_TRUE((cuda::IsVectorAligned<unsigned char, 16>(buffer)));
+    EXPECT_FALSE((cuda::IsVectorAligned<unsigned char, 16>(buffer + 4)));
+    EXPECT_TRUE((cuda::IsVectorAligned<unsigned char, 4>(buffer + 4)));
+
+    EXPECT_TRUE((cuda::IsVectorAligned<float, 4>(int64_t{64})));
+    EXPECT_FALSE((cuda::IsVectorAligned<float, 4>(int64_t{60})));
+}
+
+TEST(IsVectorAlignedTest, tensor)
+{
+    nvcv::Tensor packed({{2, 17, 32, 3}, "NHWC"}, nvcv::TYPE_U8, nvcv::MemAlignment{}.rowAddr(64));
+    nvcv::Tensor planar({{2, 3, 17, 32}, "NCHW"}, nvcv::TYPE_U8);
+
+    const auto *packedData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(packed.exportData());
+    const auto *planarData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(planar.exportData());
+    ASSERT_NE(packedData, nullptr);
+    ASSERT_NE(planarData, nullptr);
+
+    EXPECT_TRUE((cuda::IsVectorAligned<unsigned char, 48>(*packedData, 3)));
+    EXPECT_FALSE((cuda::IsVectorAligned<unsigned char, 48>(*packedData, 4)));
+    EXPECT_FALSE((cuda::IsVectorAligned<unsigned char, 16>(*planarData, 1)));
+}
+
+// ----------------------- Testing TransformRowVector --------------------------
+
+// clang-format off
+NVCV_TYPED_TEST_SUITE(
+    TransformRowVectorTest, ttype::Types<
+    ttype::Types<unsigned char, ttype::Value<16>, ttype::Value<1>>,
+    ttype::Types<unsigned char, ttype::Value<48>, ttype::Value<3>>,
+    ttype::Types<float, ttype::Value<12>, ttype::Value<3>>,
+    ttype::Types<short, ttype::Value<8>, ttype::Value<4>>
+>);
+
+// clang-format on
+
+TYPED_TEST(TransformRowVectorTest, matches_scalar_with_tail_and_misalignment)
+{
+    using T          = ttype::GetType<TypeParam, 0>;
+    constexpr int N  = ttype::GetValue<TypeParam, 1>;
+    constexpr int NC = ttype::GetValue<TypeParam, 2>;
+
+    for (int rowLength : {NC, N, 5 * N, 5 * N + NC})
+    {
+        std::vector<T> src(rowLength);
+        std::iota(src.begin(), src.end(), T{1});
+
+        std::vector<T> gold(rowLength);
+        for (int i = 0; i < rowLength; ++i)
+        {
+            gold[i] = static_cast<T>(src[i] + i % NC);
+        }
+
+        for (int offset : {0, 1})
+        {
+            std::vector<T> test = DeviceRunTransformRowVector<N, NC>(src, offset);
+
+            EXPECT_EQ(test, gold) << "rowLength " << rowLength << " offset " << offset;
+        }
+    }
+}
@@ -0,0 +1,87 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import nvcv
+import numpy as np
+
+
+def test_allocator_stats_track_tensor_memory():
+    nvcv.clear_cache()
+    nvcv.reset_allocator_stats()
+    stats0 = nvcv.allocator_stats()["cuda"]
+
+    tensor = nvcv.Tensor((32, 48, 3), np.uint8)
+
+    stats = nvcv.allocator_stats()["cuda"]
+    assert stats["num_allocs"] == stats0["num_allocs"] + 1
+    assert stats["bytes_in_use"] >= stats0["bytes_in_use"] + 32 * 48 * 3
+    assert stats["peak_bytes_in_use"] >= stats["bytes_in_use"]
+    assert sum(stats["size_histogram"]) == stats["num_allocs"]
+
+    del tensor
+    nvcv.clear_cache()
+
+    stats = nvcv.allocator_stats()["cuda"]
+    assert stats["num_frees"] == stats0["num_frees"] + 1
+    assert stats["bytes_in_use"] == stats0["bytes_in_use"]
+
+
+def test_allocator_trace():
+    nvcv.clear_cache()
+
+    events = []
+    nvcv.set_allocator_trace(
+        lambda event, mem_type, ptr, size: events.append((event, mem_type, ptr, size))
+    )
+    try:
+        tensor = nvcv.Tensor((32, 48, 3), np.uint8)
+        del tensor
+        nvcv.clear_cache()
+    finally:
+        nvcv.set_allocator_trace(None)
+
+    allocs = [e for e in events if e[0] == "alloc" and e[1] == "cuda"]
+    frees = [e for e in events if e[0] == "free" and e[1] == "cuda"]
+    assert len(allocs) == 1
+    assert len(frees) == 1
+    assert allocs[0][2:] == frees[0][2:]
+
+
+def test_cuda_allocator_from_python():
+    import torch
+
+    calls = []
+
+    def alloc(size, align):
+        ptr = torch.cuda.caching_allocator_alloc(size)
+        calls.append(("alloc", ptr, size))
+        return ptr
+
+    def free(ptr, size):
+        calls.append(("free", ptr, size))
+        torch.cuda.caching_allocator_delete(ptr)
+
+    nvcv.set_cuda_allocator(alloc, free)
+    try:
+        tensor = nvcv.Tensor((32, 48, 3), np.uint8)
+        assert torch.as_tensor(tensor.cuda(), device="cuda").data_ptr() == calls[0][1]
+        del tensor
+        nvcv.clear_cache()
+    finally:
+        nvcv.set_cuda_allocator(None, None)
+
+    assert [c[0] for c in calls] == ["alloc", "free"]
+    assert calls[0][1:] == calls[1][1:]
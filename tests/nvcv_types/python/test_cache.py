@@ -0,0 +1,138 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import nvcv
+import numpy as np
+import threading
+
+
+def test_cache_stats_hits_and_misses():
+    nvcv.clear_cache()
+    stats0 = nvcv.cache_stats()
+
+    tensor = nvcv.Tensor((32, 48, 3), np.uint8)
+    del tensor
+    tensor = nvcv.Tensor((32, 48, 3), np.uint8)
+
+    stats = nvcv.cache_stats()
+    assert stats["misses"] == stats0["misses"] + 1
+    assert stats["hits"] == stats0["hits"] + 1
+    assert stats["num_items"] == 1
+    assert stats["size_bytes"] >= 32 * 48 * 3
+    assert nvcv.current_cache_size_inbytes() == stats["size_bytes"]
+
+    del tensor
+    nvcv.clear_cache()
+    assert nvcv.cache_stats()["num_items"] == 0
+    assert nvcv.current_cache_size_inbytes() == 0
+
+
+def test_cache_limit_evicts_least_recently_used():
+    nvcv.clear_cache()
+    limit0 = nvcv.get_cache_limit_inbytes()
+
+    try:
+        tensor = nvcv.Tensor((64, 64, 4), np.uint8)
+        size = nvcv.current_cache_size_inbytes()
+        del tensor
+
+        nvcv.set_cache_limit_inbytes(2 * size)
+        assert nvcv.get_cache_limit_inbytes() == 2 * size
+
+        evictions0 = nvcv.cache_stats()["evictions"]
+
+        # tensors in use are never evicted, even above the limit
+        tensors = [nvcv.Tensor((64, 64, 4), np.uint8) for i in range(4)]
+        assert nvcv.cache_stats()["evictions"] == evictions0
+        assert nvcv.current_cache_size_inbytes() == 4 * size
+
+        del tensors
+        nvcv.set_cache_limit_inbytes(size)
+        assert nvcv.cache_stats()["evictions"] == evictions0 + 3
+        assert nvcv.current_cache_size_inbytes() == size
+    finally:
+        nvcv.set_cache_limit_inbytes(limit0)
+        nvcv.clear_cache()
+
+
+def test_cache_multithreaded_create():
+    nvcv.clear_cache()
+
+    def create(idx):
+        for i in range(100):
+            tensor = nvcv.Tensor((16 + idx, 16 + i % 4, 3), np.uint8)
+            assert tensor.shape == (16 + idx, 16 + i % 4, 3)
+            del tensor
+
+    threads = [threading.Thread(target=create, args=(idx,)) for idx in range(8)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    assert nvcv.cache_stats()["num_items"] <= 8 * 4
+    nvcv.clear_cache()
+
+
+def test_cache_limit_and_size():
+    nvcv.clear_cache()
+    limit0 = nvcv.cache_limit()
+
+    try:
+        batch = nvcv.ImageBatchVarShape(32)
+        assert nvcv.cache_size() > 0
+        del batch
+
+        assert nvcv.cache_limit(0) == 0
+        assert nvcv.cache_limit() == 0
+        assert nvcv.cache_size() == 0
+
+        # with a zero budget, released objects are evicted when others are added
+        image = nvcv.Image((64, 32), nvcv.Format.RGB8)
+        del image
+        evictions0 = nvcv.cache_stats()["evictions"]
+        image = nvcv.Image((64, 32), nvcv.Format.U8)
+        assert nvcv.cache_stats()["evictions"] == evictions0 + 1
+        assert nvcv.cache_stats()["num_items"] == 1
+        del image
+    finally:
+        nvcv.cache_limit(limit0)
+        nvcv.clear_cache()
+
+
+def test_cache_reserve():
+    nvcv.clear_cache()
+    limit0 = nvcv.cache_limit()
+
+    try:
+        nvcv.reserve((2, 32, 48, 3), np.uint8, "NHWC", count=2)
+        assert nvcv.cache_stats()["num_items"] == 2
+        size = nvcv.cache_size()
+
+        # reserved tensors are reused without allocating
+        misses0 = nvcv.cache_stats()["misses"]
+        tensors = [nvcv.Tensor((2, 32, 48, 3), np.uint8, "NHWC") for i in range(2)]
+        assert nvcv.cache_stats()["misses"] == misses0
+        assert nvcv.cache_size() == size
+        del tensors
+
+        # and never evicted
+        nvcv.cache_limit(0)
+        assert nvcv.cache_stats()["num_items"] == 2
+    finally:
+        nvcv.cache_limit(limit0)
+        nvcv.clear_cache()
+
+    assert nvcv.cache_stats()["num_items"] == 0
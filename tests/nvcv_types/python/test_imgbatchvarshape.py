@@ -14,6 +14,7 @@
 # limitations under the License.
 
 import nvcv
+import pytest
 
 
 def test_imgbatchvarshape_creation_works():
@@ -98,3 +99,24 @@ def test_imgbatchvarshape_several_images():
     assert cnt == 0
 
     assert batch.maxsize == (0, 0)
+
+
+def test_imgbatchvarshape_setitem():
+    batch = nvcv.ImageBatchVarShape(5)
+
+    imgs = [nvcv.Image((m * 2, m), nvcv.Format.U8) for m in range(2, 7)]
+    batch.pushback(imgs)
+
+    other = nvcv.Image((64, 32), nvcv.Format.RGB8)
+    batch[2] = other
+    assert len(batch) == 5
+    assert batch.maxsize == (64, 32)
+    assert batch.uniqueformat is None
+    assert list(batch)[2] is other
+
+    batch[2] = imgs[2]
+    assert batch.maxsize == (12, 6)
+    assert batch.uniqueformat == nvcv.Format.U8
+
+    with pytest.raises(RuntimeError):
+        batch[5] = other
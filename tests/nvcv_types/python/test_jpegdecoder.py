@@ -0,0 +1,73 @@
+# SPDX-FileCopyrightText: Copyright (c) 2022-2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import io
+import nvcv
+import numpy as np
+import pytest as t
+
+PIL = t.importorskip("PIL.Image")
+
+
+def encode_jpeg(width, height, seed):
+    rng = np.random.default_rng(seed)
+    # Smooth content keeps JPEG losses small
+    x = np.linspace(0, 255, width, dtype=np.float32)
+    y = np.linspace(0, 255, height, dtype=np.float32)
+    rgb = np.stack(
+        [
+            np.add.outer(y, x) / 2,
+            np.add.outer(y, 255 - x) / 2,
+            np.full((height, width), rng.integers(0, 256), np.float32),
+        ],
+        axis=-1,
+    ).astype(np.uint8)
+
+    out = io.BytesIO()
+    PIL.fromarray(rgb).save(out, format="JPEG", quality=95)
+    data = out.getvalue()
+    return data, np.asarray(PIL.open(io.BytesIO(data)).convert("RGB"))
+
+
+def test_jpegdecoder_decodes_varshape_batch():
+    sizes = [(64, 48), (33, 17), (128, 96)]
+    files = [encode_jpeg(w, h, i) for i, (w, h) in enumerate(sizes)]
+
+    decoder = nvcv.JpegDecoder(4)
+    assert decoder.max_batch_size == 4
+
+    stream = nvcv.cuda.Stream()
+    batch = decoder.decode([data for data, _ in files], stream=stream)
+    stream.sync()
+
+    assert len(batch) == len(sizes)
+    assert batch.uniqueformat == nvcv.Format.RGB8
+    assert batch.maxsize == (128, 96)
+
+    for img, (w, h), (_, gold) in zip(batch, sizes, files):
+        assert img.size == (w, h)
+        test = img.cpu()
+        assert test.shape == gold.shape
+        # Decoders may differ by their IDCT rounding
+        assert np.abs(test.astype(np.int32) - gold).mean() < 2
+
+
+def test_jpegdecoder_invalid_batch_size():
+    data, _ = encode_jpeg(16, 16, 0)
+    decoder = nvcv.JpegDecoder(2)
+    with t.raises(ValueError):
+        decoder.decode([data, data, data])
+    with t.raises(ValueError):
+        nvcv.JpegDecoder(0)
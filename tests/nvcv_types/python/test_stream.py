@@ -17,6 +17,9 @@ import nvcv
 import torch
 import ctypes
 import pytest as t
+import asyncio
+import threading
+import numpy as np
 
 
 def test_current_stream():
@@ -47,6 +50,24 @@ def test_nested_streams():
         assert stream1 is nvcv.cuda.Stream.current
 
 
+def test_stream_priority():
+    least, greatest = nvcv.cuda.Stream.priority_range
+    assert greatest <= least
+
+    assert nvcv.cuda.Stream().priority == least
+    assert nvcv.cuda.Stream.default.priority == least
+
+    high = nvcv.cuda.Stream(priority=greatest)
+    assert high.priority == greatest
+
+    # out of range priorities are clamped, and streams of other priorities aren't reused
+    assert nvcv.cuda.Stream(priority=greatest - 10).priority == greatest
+    assert nvcv.cuda.Stream(priority=least + 10).priority == least
+
+    torch_high = torch.cuda.Stream(priority=-1)
+    assert nvcv.cuda.as_stream(torch_high).priority == torch_high.priority
+
+
 def test_wrap_stream_voidp():
     stream = torch.cuda.Stream()
 
@@ -112,3 +133,70 @@ def test_wrap_stream_external(stream_type):
 
 def test_stream_default_is_zero():
     assert nvcv.cuda.Stream.default.handle == 0
+
+
+def test_stream_completion():
+    async def run():
+        stream = nvcv.cuda.Stream()
+        tensor = torch.ones(1 << 20, device="cuda")
+        with torch.cuda.stream(torch.cuda.ExternalStream(stream.handle)):
+            for _ in range(8):
+                tensor = tensor * 2
+
+        await stream.completion()
+        assert tensor[0].item() == 256
+
+        # Many pending completions resolve concurrently
+        await asyncio.gather(*[stream.completion() for _ in range(1000)])
+
+    asyncio.run(run())
+
+
+def test_stream_completion_needs_running_loop():
+    with t.raises(RuntimeError):
+        nvcv.cuda.Stream().completion()
+
+
+def test_tensor_ready():
+    async def run():
+        tensor = nvcv.Tensor((16, 32, 4), np.uint8, nvcv.TensorLayout.HWC)
+        await tensor.ready()
+
+    asyncio.run(run())
+
+
+def test_current_stream_is_per_thread():
+    stream = nvcv.cuda.Stream()
+    seen = []
+
+    def worker():
+        seen.append(nvcv.cuda.Stream.current)
+
+    with stream:
+        thread = threading.Thread(target=worker)
+        thread.start()
+        thread.join()
+        assert nvcv.cuda.Stream.current is stream
+
+    assert seen[0] is nvcv.cuda.Stream.default
+
+
+def test_current_stream_concurrent_threads():
+    streams = [nvcv.cuda.Stream() for _ in range(8)]
+    mismatches = []
+
+    def worker(stream):
+        for _ in range(100):
+            with stream:
+                if nvcv.cuda.Stream.current is not stream:
+                    mismatches.append(stream)
+            if nvcv.cuda.Stream.current is not nvcv.cuda.Stream.default:
+                mismatches.append(None)
+
+    threads = [threading.Thread(target=worker, args=(s,)) for s in streams]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    assert not mismatches
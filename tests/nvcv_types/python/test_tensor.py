@@ -171,6 +171,26 @@ def test_wrap_torch_buffer_with_layout(shape, dtype, layout):
     assert tensor.ndim == len(shape)
 
 
+def test_wrap_same_buffer_reuses_wrapper():
+    ttensor = torch.zeros((4, 8, 3), dtype=torch.uint8, device="cuda")
+
+    tensor = nvcv.as_tensor(ttensor, "HWC")
+    wrapper_id = tensor.id
+    del tensor
+
+    # Same memory, shape and layout, even through another torch object
+    tensor = nvcv.as_tensor(ttensor.view(4, 8, 3), "HWC")
+    assert tensor.id == wrapper_id
+
+    # Wrappers in use aren't shared
+    other = nvcv.as_tensor(ttensor, "HWC")
+    assert other.id != tensor.id
+
+    assert nvcv.as_tensor(ttensor, "HWC").layout == "HWC"
+    assert nvcv.as_tensor(ttensor[1:], "HWC").shape == (3, 8, 3)
+    assert nvcv.as_tensor(ttensor.view(32, 3), "WC").shape == (32, 3)
+
+
 @t.mark.parametrize(
     "size, fmt, gold_layout,gold_shape,gold_dtype",
     [
@@ -286,3 +306,172 @@ def test_tensor_is_kept_alive_by_cuda_array_interface():
 
     tensor3 = nvcv.Tensor((480, 640, 3), np.uint8)
     assert tensor3.cuda().__cuda_array_interface__["data"][0] == data_buffer1
+
+
+def test_tensor_dlpack_export():
+    tensor = nvcv.Tensor((3, 5, 7), np.float32, "HWC")
+
+    assert tensor.__dlpack_device__() == (2, 0)  # kDLCUDA, device 0
+
+    stream = torch.cuda.Stream()
+    ttensor = torch.from_dlpack(tensor.__dlpack__(stream=stream.cuda_stream))
+    assert ttensor.shape == (3, 5, 7)
+    assert ttensor.dtype == torch.float32
+    assert ttensor.data_ptr() == tensor.cuda().__cuda_array_interface__["data"][0]
+
+    # torch calls __dlpack__ with its current stream
+    ttensor = torch.from_dlpack(tensor)
+    ttensor.fill_(3)
+    assert torch.all(torch.as_tensor(tensor.cuda(), device="cuda") == 3)
+
+
+def test_tensor_dlpack_export_invalid_stream():
+    tensor = nvcv.Tensor((3, 5, 7), np.float32, "HWC")
+    with t.raises(ValueError):
+        tensor.__dlpack__(stream=0)
+
+
+def test_tensor_performance_row_alignment():
+    nvcv.clear_cache()
+
+    rowalign = nvcv.ROW_ALIGNMENT_PERFORMANCE
+    tensor = nvcv.Tensor((4, 1918, 3), np.uint8, "HWC", rowalign=rowalign)
+    strides = tensor.cuda().__cuda_array_interface__["strides"]
+    assert strides[0] % rowalign == 0
+    assert strides[0] >= 1918 * 3
+
+    batch = nvcv.Tensor(2, (1918, 4), nvcv.Format.RGB8, rowalign=256)
+    strides = batch.cuda().__cuda_array_interface__["strides"]
+    assert strides[1] % 256 == 0
+
+    # Tensors with other alignments aren't reused from cache
+    del tensor
+    tensor = nvcv.Tensor((4, 1918, 3), np.uint8, "HWC", rowalign=1)
+    assert tensor.cuda().__cuda_array_interface__["strides"][0] == 1918 * 3
+
+
+@t.mark.parametrize(
+    "shape,dtype,layout",
+    [
+        ((4, 1917, 3), np.uint8, "HWC"),
+        ((2, 33, 17, 1), np.float32, "NHWC"),
+    ],
+)
+def test_tensor_upload_download(shape, dtype, layout):
+    tensor = nvcv.Tensor(shape, dtype, layout, rowalign=nvcv.ROW_ALIGNMENT_PERFORMANCE)
+
+    src = np.random.default_rng(0).integers(0, 255, shape).astype(dtype)
+    tensor.upload(src)
+    dst = tensor.download()
+
+    assert dst.shape == src.shape
+    assert dst.dtype == src.dtype
+    np.testing.assert_array_equal(dst, src)
+
+    # Non-contiguous arrays, or of the wrong size, are rejected
+    with t.raises(ValueError):
+        tensor.upload(src[:, ::2])
+    with t.raises(RuntimeError):
+        tensor.upload(src[:1])
+
+
+def _download_ipc_tensor(ipc, queue):
+    tensor = nvcv.import_tensor_ipc(ipc)
+    queue.put(tensor.download())
+
+
+def test_tensor_ipc_export_import():
+    import multiprocessing
+
+    tensor = nvcv.Tensor((2, 16, 32, 3), np.uint8, "NHWC")
+    src = np.random.default_rng(0).integers(0, 255, tensor.shape).astype(np.uint8)
+    tensor.upload(src)
+
+    ipc = tensor.export_ipc()
+    assert isinstance(ipc, bytes)
+
+    # CUDA IPC memory can only be imported by another process
+    ctx = multiprocessing.get_context("spawn")
+    queue = ctx.Queue()
+    proc = ctx.Process(target=_download_ipc_tensor, args=(ipc, queue))
+    proc.start()
+    dst = queue.get(timeout=60)
+    proc.join()
+
+    np.testing.assert_array_equal(dst, src)
+
+    with t.raises(ValueError):
+        nvcv.import_tensor_ipc(ipc[:-1])
+
+
+def test_tensor_getitem_views():
+    tensor = nvcv.Tensor((4, 6, 8, 3), np.uint8, "NHWC")
+    ttensor = torch.as_tensor(tensor.cuda(), device="cuda")
+    ttensor.copy_(torch.arange(ttensor.numel(), device="cuda").reshape(ttensor.shape))
+
+    view = tensor[1:3]
+    assert view.shape == (2, 6, 8, 3)
+    assert view.layout == "NHWC"
+
+    view = tensor[-1]
+    assert view.shape == (6, 8, 3)
+    assert view.layout == "HWC"
+
+    view = tensor[..., 2:5, :]
+    assert view.shape == (4, 6, 3, 3)
+    assert torch.equal(
+        torch.as_tensor(view.cuda(), device="cuda"), ttensor[..., 2:5, :]
+    )
+
+    view = tensor[:, ::2]
+    assert view.shape == (4, 3, 8, 3)
+    assert torch.equal(torch.as_tensor(view.cuda(), device="cuda"), ttensor[:, ::2])
+
+    # Views share the memory of the tensor
+    torch.as_tensor(tensor[2, 1:2].cuda(), device="cuda").fill_(7)
+    assert torch.all(ttensor[2, 1] == 7)
+
+    with t.raises(IndexError):
+        tensor[4]
+    with t.raises(IndexError):
+        tensor[0, 0, 0, 0, 0]
+    with t.raises(ValueError):
+        tensor[::-1]
+    with t.raises(ValueError):
+        tensor[2:2]
+    with t.raises(TypeError):
+        tensor["a"]
+
+
+def test_tensor_reshape_views():
+    tensor = nvcv.Tensor((2, 6, 8, 3), np.float32, "NHWC")
+    ttensor = torch.as_tensor(tensor.cuda(), device="cuda")
+
+    view = tensor.reshape((12, 8, 3), "HWC")
+    assert view.shape == (12, 8, 3)
+    assert view.layout == "HWC"
+    assert view.cuda().__cuda_array_interface__["data"][0] == ttensor.data_ptr()
+
+    view = tensor.reshape((2, -1))
+    assert view.shape == (2, 144)
+    assert view.layout is None
+
+    view = tensor.reshape((1, 12, 8, 3))
+    assert view.layout == "NHWC"
+
+    torch.as_tensor(view.cuda(), device="cuda").fill_(5)
+    assert torch.all(ttensor == 5)
+
+    with t.raises(ValueError):
+        tensor.reshape((5, 7))
+
+    # Columns aren't contiguous with the rows anymore
+    with t.raises(ValueError):
+        tensor[:, :, 1:7].reshape((2, -1))
+
+    view = tensor.reinterpret_layout("NDHW")
+    assert view.shape == tensor.shape
+    assert view.layout == "NDHW"
+
+    with t.raises(ValueError):
+        tensor.reinterpret_layout("HWC")
@@ -19,11 +19,18 @@
 
 #include <common/ObjectBag.hpp>
 #include <common/ValueTests.hpp>
+#include <nvcv/Tensor.hpp>
 #include <nvcv/alloc/Allocator.h>
+#include <nvcv/alloc/AllocatorWrapHandle.hpp>
+#include <nvcv/alloc/CompressibleAllocator.hpp>
 #include <nvcv/alloc/CustomAllocator.hpp>
 #include <nvcv/alloc/CustomResourceAllocator.hpp>
+#include <nvcv/alloc/ManagedAllocator.hpp>
+#include <nvcv/alloc/PoolAllocator.hpp>
 
+#include <atomic>
 #include <thread>
+#include <vector>
 
 #include <nvcv/alloc/Fwd.hpp>
 
@@ -301,6 +308,538 @@ TEST(Allocator, wip_test_dali_stream_async)
     cudaStreamDestroy(stream2);
 }
 
+TEST(PoolAllocator, reuses_freed_buffers)
+{
+    nvcv::PoolAllocator alloc;
+
+    void *ptrDev = alloc.cudaMem().alloc(768, 256);
+    ASSERT_NE(nullptr, ptrDev);
+    alloc.cudaMem().free(ptrDev, 768, 256);
+
+    // Freed buffers are handed out again once the work submitted before is done
+    ASSERT_EQ(cudaSuccess, cudaDeviceSynchronize());
+
+    // Buffer with similar size must come from the pool
+    void *ptrDev2 = alloc.cudaMem().alloc(1024, 256);
+    EXPECT_EQ(ptrDev, ptrDev2);
+
+    // Buffer in use can't be handed out again
+    void *ptrDev3 = alloc.cudaMem().alloc(1024, 256);
+    EXPECT_NE(ptrDev2, ptrDev3);
+
+    alloc.cudaMem().free(ptrDev2, 1024, 256);
+    alloc.cudaMem().free(ptrDev3, 1024, 256);
+
+    void *ptrHostPinned = alloc.hostPinnedMem().alloc(144, 16);
+    ASSERT_NE(nullptr, ptrHostPinned);
+    alloc.hostPinnedMem().free(ptrHostPinned, 144, 16);
+    ASSERT_EQ(cudaSuccess, cudaDeviceSynchronize());
+    EXPECT_EQ(ptrHostPinned, alloc.hostPinnedMem().alloc(144, 16));
+    alloc.hostPinnedMem().free(ptrHostPinned, 144, 16);
+
+    void *ptrHost = alloc.hostMem().alloc(160, 16);
+    ASSERT_NE(nullptr, ptrHost);
+    alloc.hostMem().free(ptrHost, 160, 16);
+
+    ASSERT_NO_THROW(alloc.trim());
+}
+
+TEST(PoolAllocator, host_pinned_pools_separated_by_flags)
+{
+    nvcv::PoolAllocator alloc;
+
+    void *ptrCached = alloc.allocHostPinnedMem(144, 16, NVCV_HOST_PINNED_MEM_DEFAULT);
+    ASSERT_NE(nullptr, ptrCached);
+    alloc.freeHostPinnedMem(ptrCached, 144, 16, NVCV_HOST_PINNED_MEM_DEFAULT);
+
+    // Cached buffer can't be handed out as write-combined
+    void *ptrWC = alloc.allocHostPinnedMem(144, 16, NVCV_HOST_PINNED_MEM_WRITE_COMBINED);
+    EXPECT_NE(ptrCached, ptrWC);
+    alloc.freeHostPinnedMem(ptrWC, 144, 16, NVCV_HOST_PINNED_MEM_WRITE_COMBINED);
+
+    ASSERT_EQ(cudaSuccess, cudaDeviceSynchronize());
+    EXPECT_EQ(ptrCached, alloc.allocHostPinnedMem(144, 16, NVCV_HOST_PINNED_MEM_DEFAULT));
+    alloc.freeHostPinnedMem(ptrCached, 144, 16, NVCV_HOST_PINNED_MEM_DEFAULT);
+}
+
+TEST(PoolAllocator, freed_buffer_not_reused_while_work_pending)
+{
+    nvcv::PoolAllocator alloc;
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    // Holds the stream until released, the work queued after it stays pending
+    std::atomic<bool> release = false;
+    ASSERT_EQ(cudaSuccess, cudaLaunchHostFunc(
+                               stream,
+                               [](void *arg)
+                               {
+                                   auto &flag = *static_cast<std::atomic<bool> *>(arg);
+                                   while (!flag)
+                                   {
+                                       std::this_thread::yield();
+                                   }
+                               },
+                               &release));
+
+    void *basePtr;
+    {
+        nvcv::Tensor tensor(nvcv::TensorShape{{1 << 20}, "W"}, nvcv::TYPE_U8, {}, &alloc);
+
+        auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+        ASSERT_NE(nullptr, data);
+        basePtr = data->basePtr();
+
+        ASSERT_EQ(cudaSuccess, cudaMemsetAsync(basePtr, 0xFF, 1 << 20, stream));
+        // Destroyed without a release stream while the memset is pending
+    }
+
+    {
+        nvcv::Tensor tensor(nvcv::TensorShape{{1 << 20}, "W"}, nvcv::TYPE_U8, {}, &alloc);
+
+        auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+        ASSERT_NE(nullptr, data);
+        EXPECT_NE(basePtr, data->basePtr());
+
+        release = true;
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    }
+
+    // Work done, the buffer can be handed out again
+    nvcv::Tensor tensor(nvcv::TensorShape{{1 << 20}, "W"}, nvcv::TYPE_U8, {}, &alloc);
+
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(nullptr, data);
+    EXPECT_EQ(basePtr, data->basePtr());
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(PoolAllocator, release_threshold_respected)
+{
+    // Pool can't cache anything
+    nvcv::PoolAllocator alloc(int64_t{0});
+
+    void *ptrDev = alloc.cudaMem().alloc(1 << 20, 256);
+    ASSERT_NE(nullptr, ptrDev);
+    alloc.cudaMem().free(ptrDev, 1 << 20, 256);
+
+    // Must work as the default allocator,
+    // can't check the pointer as the driver might return the same one.
+    void *ptrDev2 = alloc.cudaMem().alloc(1 << 20, 256);
+    ASSERT_NE(nullptr, ptrDev2);
+    alloc.cudaMem().free(ptrDev2, 1 << 20, 256);
+}
+
+TEST(PoolAllocator, trim_non_pool_allocator_invalid_arg)
+{
+    nvcv::CustomAllocator alloc;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorTrim(alloc.handle()));
+}
+
+TEST(PoolAllocator, device_pool_allocates_on_its_device)
+{
+    int numDevices = 0;
+    ASSERT_EQ(cudaSuccess, cudaGetDeviceCount(&numDevices));
+
+    int curDevice = 0;
+    ASSERT_EQ(cudaSuccess, cudaGetDevice(&curDevice));
+
+    // Last device, so that it differs from the current one when there are several
+    const int32_t device = numDevices - 1;
+
+    NVCVPoolAllocatorParams params;
+    params.releaseThreshold = -1;
+    params.maxBlockSize     = -1;
+
+    nvcv::PoolAllocator alloc(device, params);
+    EXPECT_EQ(device, alloc.device());
+
+    int32_t defaultDevice = 0;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorGetDevice(nullptr, &defaultDevice));
+    EXPECT_EQ(-1, defaultDevice);
+
+    nvcv::Tensor tensor(2, {64, 32}, nvcv::FMT_RGB8, {}, &alloc);
+    EXPECT_EQ(device, tensor.device());
+
+    // Allocating must not change the current device
+    int afterDevice = -1;
+    ASSERT_EQ(cudaSuccess, cudaGetDevice(&afterDevice));
+    EXPECT_EQ(curDevice, afterDevice);
+
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(nullptr, data);
+
+    cudaPointerAttributes attrs;
+    ASSERT_EQ(cudaSuccess, cudaPointerGetAttributes(&attrs, data->basePtr()));
+    EXPECT_EQ(device, attrs.device);
+
+    // Wrapped memory finds out its device from the pointer
+    nvcv::TensorWrapData wrap(*data);
+    EXPECT_EQ(device, wrap.device());
+
+    NVCVAllocatorHandle handle;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructDevicePool(-1, nullptr, &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructDevicePool(numDevices, nullptr, &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructDevicePool(device, nullptr, nullptr));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorGetDevice(alloc.handle(), nullptr));
+}
+
+TEST(PoolAllocator, unbound_host_pinned_pool_guards_current_device)
+{
+    int numDevices = 0;
+    ASSERT_EQ(cudaSuccess, cudaGetDeviceCount(&numDevices));
+    if (numDevices < 2)
+    {
+        GTEST_SKIP() << "Requires at least 2 CUDA devices";
+    }
+
+    int curDevice = 0;
+    ASSERT_EQ(cudaSuccess, cudaGetDevice(&curDevice));
+
+    nvcv::PoolAllocator alloc;
+
+    // Guarded by an event of device 0, idle once the buffer is handed out again
+    ASSERT_EQ(cudaSuccess, cudaSetDevice(0));
+    void *ptr = alloc.hostPinnedMem().alloc(144, 16);
+    ASSERT_NE(nullptr, ptr);
+    alloc.hostPinnedMem().free(ptr, 144, 16);
+    ASSERT_EQ(cudaSuccess, cudaDeviceSynchronize());
+    ASSERT_EQ(ptr, alloc.hostPinnedMem().alloc(144, 16));
+
+    // Returned while device 1 is current, with work pending on it
+    ASSERT_EQ(cudaSuccess, cudaSetDevice(1));
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    std::atomic<bool> release = false;
+    ASSERT_EQ(cudaSuccess, cudaLaunchHostFunc(
+                               stream,
+                               [](void *arg)
+                               {
+                                   auto &flag = *static_cast<std::atomic<bool> *>(arg);
+                                   while (!flag)
+                                   {
+                                       std::this_thread::yield();
+                                   }
+                               },
+                               &release));
+
+    alloc.hostPinnedMem().free(ptr, 144, 16);
+
+    void *ptrPending = alloc.hostPinnedMem().alloc(144, 16);
+    EXPECT_NE(ptr, ptrPending);
+
+    release = true;
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaDeviceSynchronize());
+
+    // Cached on device 1 as well, handed out again once its work is done
+    EXPECT_EQ(ptr, alloc.hostPinnedMem().alloc(144, 16));
+
+    alloc.hostPinnedMem().free(ptr, 144, 16);
+    alloc.hostPinnedMem().free(ptrPending, 144, 16);
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+    ASSERT_EQ(cudaSuccess, cudaSetDevice(curDevice));
+}
+
+class ManagedAllocatorTests : public t::TestWithParam<NVCVManagedMemMode>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(_, ManagedAllocatorTests,
+                         t::Values(NVCV_MANAGED_MEM_AUTO, NVCV_MANAGED_MEM_UNIFIED, NVCV_MANAGED_MEM_MAPPED));
+
+TEST_P(ManagedAllocatorTests, cuda_mem_accessible_by_host)
+{
+    nvcv::ManagedAllocator alloc(GetParam());
+
+    auto *ptr = static_cast<uint8_t *>(alloc.cudaMem().alloc(4096, 256));
+    ASSERT_NE(nullptr, ptr);
+
+    std::fill(ptr, ptr + 4096, 0xAB);
+
+    // Device writes are seen by the host once synchronized
+    ASSERT_EQ(cudaSuccess, cudaMemset(ptr, 0x12, 1024));
+    ASSERT_EQ(cudaSuccess, cudaDeviceSynchronize());
+
+    EXPECT_EQ(0x12, ptr[0]);
+    EXPECT_EQ(0x12, ptr[1023]);
+    EXPECT_EQ(0xAB, ptr[1024]);
+    EXPECT_EQ(0xAB, ptr[4095]);
+
+    alloc.cudaMem().free(ptr, 4096, 256);
+}
+
+TEST(ManagedAllocator, invalid_mode)
+{
+    NVCVManagedAllocatorParams params = {};
+    params.mode                       = static_cast<NVCVManagedMemMode>(-1);
+
+    NVCVAllocatorHandle handle;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructManaged(&params, &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructManaged(nullptr, nullptr));
+}
+
+TEST(CompressibleAllocator, cuda_mem_round_trips)
+{
+    nvcv::CompressibleAllocator alloc;
+
+    // Small allocations come from the default allocator, large ones are mapped
+    for (int64_t size : {int64_t{4096}, int64_t{5} << 20})
+    {
+        auto *ptr = static_cast<uint8_t *>(alloc.cudaMem().alloc(size, 256));
+        ASSERT_NE(nullptr, ptr);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(ptr) % 256);
+
+        ASSERT_EQ(cudaSuccess, cudaMemset(ptr, 0x5A, size));
+
+        std::vector<uint8_t> host(size);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(host.data(), ptr, size, cudaMemcpyDeviceToHost));
+        EXPECT_EQ(0x5A, host.front());
+        EXPECT_EQ(0x5A, host.back());
+
+        alloc.cudaMem().free(ptr, size, 256);
+    }
+}
+
+TEST(CompressibleAllocator, requires_compression_only_when_asked)
+{
+    nvcv::CompressibleAllocator fallback(false);
+
+    NVCVCompressibleAllocatorParams params = {};
+    params.requireCompression              = 1;
+
+    NVCVAllocatorHandle handle;
+    NVCVStatus          status = nvcvAllocatorConstructCompressible(&params, &handle);
+    if (fallback.compressible())
+    {
+        ASSERT_EQ(NVCV_SUCCESS, status);
+        nvcvAllocatorDecRef(handle, nullptr);
+    }
+    else
+    {
+        EXPECT_EQ(NVCV_ERROR_NOT_COMPATIBLE, status);
+    }
+
+    params.minSize = -1;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructCompressible(&params, &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructCompressible(nullptr, nullptr));
+
+    // Other allocators are never compressible
+    nvcv::PoolAllocator pool;
+    int8_t              compressible = 1;
+    EXPECT_EQ(NVCV_SUCCESS, nvcvAllocatorIsCompressible(pool.handle(), &compressible));
+    EXPECT_EQ(0, compressible);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorIsCompressible(pool.handle(), nullptr));
+}
+
+TEST(Allocator, stats_count_allocations)
+{
+    nvcv::PoolAllocator alloc;
+
+    void *ptr1 = alloc.cudaMem().alloc(512, 256);
+    void *ptr2 = alloc.cudaMem().alloc(4096, 256);
+
+    NVCVAllocatorStats stats = alloc.stats(NVCV_RESOURCE_MEM_CUDA);
+    EXPECT_EQ(512 + 4096, stats.bytesInUse);
+    EXPECT_EQ(512 + 4096, stats.peakBytesInUse);
+    EXPECT_EQ(2, stats.numAllocs);
+    EXPECT_EQ(0, stats.numFrees);
+    EXPECT_EQ(1, stats.sizeHistogram[0]);
+    EXPECT_EQ(1, stats.sizeHistogram[3]); // [4 KiB, 8 KiB)
+
+    alloc.cudaMem().free(ptr2, 4096, 256);
+
+    stats = alloc.stats(NVCV_RESOURCE_MEM_CUDA);
+    EXPECT_EQ(512, stats.bytesInUse);
+    EXPECT_EQ(512 + 4096, stats.peakBytesInUse);
+    EXPECT_EQ(1, stats.numFrees);
+
+    // Other resource types aren't affected
+    EXPECT_EQ(0, alloc.stats(NVCV_RESOURCE_MEM_HOST_PINNED).numAllocs);
+
+    alloc.resetStats();
+    stats = alloc.stats(NVCV_RESOURCE_MEM_CUDA);
+    EXPECT_EQ(512, stats.bytesInUse);
+    EXPECT_EQ(512, stats.peakBytesInUse);
+    EXPECT_EQ(0, stats.numAllocs);
+    EXPECT_EQ(0, stats.numFrees);
+    EXPECT_EQ(0, stats.sizeHistogram[0]);
+
+    alloc.cudaMem().free(ptr1, 512, 256);
+    EXPECT_EQ(0, alloc.stats(NVCV_RESOURCE_MEM_CUDA).bytesInUse);
+
+    NVCVAllocatorStats dummy;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorGetStats(alloc.handle(), (NVCVResourceType)-1, &dummy));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorGetStats(alloc.handle(), NVCV_RESOURCE_MEM_CUDA, nullptr));
+}
+
+TEST(Allocator, trace_func_sees_allocations)
+{
+    nvcv::PoolAllocator alloc;
+
+    std::vector<NVCVAllocatorTraceEvent> events;
+    alloc.setTraceFunc(
+        [](void *ctx, NVCVAllocatorHandle, const NVCVAllocatorTraceEvent *ev)
+        { static_cast<std::vector<NVCVAllocatorTraceEvent> *>(ctx)->push_back(*ev); },
+        &events);
+
+    void *ptr = alloc.hostPinnedMem().alloc(256, 16);
+    alloc.hostPinnedMem().free(ptr, 256, 16);
+
+    alloc.setTraceFunc(nullptr, nullptr);
+    alloc.hostMem().free(alloc.hostMem().alloc(64, 16), 64, 16);
+
+    ASSERT_EQ(2, events.size());
+    EXPECT_EQ(NVCV_ALLOCATOR_TRACE_ALLOC, events[0].type);
+    EXPECT_EQ(NVCV_ALLOCATOR_TRACE_FREE, events[1].type);
+    for (const NVCVAllocatorTraceEvent &ev : events)
+    {
+        EXPECT_EQ(NVCV_RESOURCE_MEM_HOST_PINNED, ev.resType);
+        EXPECT_EQ(ptr, ev.ptr);
+        EXPECT_EQ(256, ev.sizeBytes);
+        EXPECT_EQ(16, ev.alignBytes);
+        EXPECT_EQ((uint32_t)NVCV_HOST_PINNED_MEM_STAGING, ev.flags);
+    }
+}
+
+TEST(Allocator, stream_ordered_custom_cuda_mem)
+{
+    struct Call
+    {
+        bool     alloc;
+        void    *ptr;
+        int64_t  size;
+        CUstream stream;
+    };
+
+    std::vector<Call> calls;
+
+    NVCVCustomCudaMemAsyncAllocator cudaAlloc;
+    cudaAlloc.ctx     = &calls;
+    cudaAlloc.fnAlloc = [](void *ctx, int64_t size, int32_t align, CUstream stream) -> void *
+    {
+        void *ptr = nullptr;
+        if (cudaMallocAsync(&ptr, size, stream) != cudaSuccess)
+        {
+            return nullptr;
+        }
+        static_cast<std::vector<Call> *>(ctx)->push_back({true, ptr, size, stream});
+        return ptr;
+    };
+    cudaAlloc.fnFree = [](void *ctx, void *ptr, int64_t size, int32_t align, CUstream stream)
+    {
+        static_cast<std::vector<Call> *>(ctx)->push_back({false, ptr, size, stream});
+        cudaFreeAsync(ptr, stream);
+    };
+
+    NVCVAllocatorHandle halloc;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorConstructCustomAsync(nullptr, 0, &cudaAlloc, &halloc));
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+    void *ptr = nullptr;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorAllocCudaMemoryAsync(halloc, &ptr, 1024, 256, stream));
+    EXPECT_EQ(cudaSuccess, cudaMemsetAsync(ptr, 0, 1024, stream));
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorFreeCudaMemoryAsync(halloc, ptr, 1024, 256, stream));
+
+    {
+        // Objects created without a stream allocate on the NULL stream, and
+        // give their memory back on their release stream.
+        nvcv::AllocatorWrapHandle alloc(halloc);
+        nvcv::Tensor tensor(nvcv::TensorShape{{16, 32}, "HW"}, nvcv::TYPE_U8, nvcv::MemAlignment{}, &alloc);
+        tensor.setReleaseStream(stream);
+    }
+
+    ASSERT_EQ(4, calls.size());
+    EXPECT_TRUE(calls[0].alloc);
+    EXPECT_EQ(ptr, calls[0].ptr);
+    EXPECT_EQ(stream, calls[0].stream);
+    EXPECT_FALSE(calls[1].alloc);
+    EXPECT_EQ(ptr, calls[1].ptr);
+    EXPECT_EQ(stream, calls[1].stream);
+    EXPECT_TRUE(calls[2].alloc);
+    EXPECT_EQ(nullptr, calls[2].stream);
+    EXPECT_FALSE(calls[3].alloc);
+    EXPECT_EQ(calls[2].ptr, calls[3].ptr);
+    EXPECT_EQ(stream, calls[3].stream);
+
+    NVCVAllocatorStats stats;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorGetStats(halloc, NVCV_RESOURCE_MEM_CUDA, &stats));
+    EXPECT_EQ(2, stats.numAllocs);
+    EXPECT_EQ(2, stats.numFrees);
+    EXPECT_EQ(0, stats.bytesInUse);
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+    EXPECT_EQ(NVCV_SUCCESS, nvcvAllocatorDecRef(halloc, nullptr));
+}
+
+TEST(Allocator, stream_ordered_not_supported_frees_when_work_is_done)
+{
+    nvcv::PoolAllocator alloc;
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+    void *ptr = nullptr;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorAllocCudaMemoryAsync(alloc.handle(), &ptr, 1024, 256, stream));
+    EXPECT_EQ(cudaSuccess, cudaMemsetAsync(ptr, 0, 1024, stream));
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorFreeCudaMemoryAsync(alloc.handle(), ptr, 1024, 256, stream));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+    // Given back once the work is found done, e.g. when creating objects
+    EXPECT_EQ(1024, alloc.stats(NVCV_RESOURCE_MEM_CUDA).bytesInUse);
+    nvcv::Tensor tensor(nvcv::TensorShape{{16}, "W"}, nvcv::TYPE_U8);
+    EXPECT_EQ(0, alloc.stats(NVCV_RESOURCE_MEM_CUDA).bytesInUse);
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(Allocator, stream_ordered_custom_invalid_args)
+{
+    auto fnAlloc = [](void *, int64_t, int32_t, CUstream) -> void *
+    {
+        return nullptr;
+    };
+    auto fnFree = [](void *, void *, int64_t, int32_t, CUstream) {
+    };
+
+    NVCVCustomCudaMemAsyncAllocator cudaAlloc = {nullptr, fnAlloc, fnFree};
+    NVCVAllocatorHandle             handle;
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructCustomAsync(nullptr, 0, nullptr, &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructCustomAsync(nullptr, 0, &cudaAlloc, nullptr));
+
+    NVCVCustomCudaMemAsyncAllocator noFree = {nullptr, fnAlloc, nullptr};
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructCustomAsync(nullptr, 0, &noFree, &handle));
+
+    // Cuda memory can't be handled by both
+    NVCVCustomAllocator custom = {};
+    custom.resType             = NVCV_RESOURCE_MEM_CUDA;
+    custom.res.mem.fnAlloc     = [](void *, int64_t, int32_t) -> void *
+    {
+        return nullptr;
+    };
+    custom.res.mem.fnFree = [](void *, void *, int64_t, int32_t) {
+    };
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructCustomAsync(&custom, 1, &cudaAlloc, &handle));
+}
+
+TEST(PoolAllocator, cast)
+{
+    nvcv::PoolAllocator alloc;
+
+    EXPECT_EQ(&alloc, nvcv::StaticCast<nvcv::IAllocator *>(alloc.handle()));
+    EXPECT_EQ(&alloc, nvcv::DynamicCast<nvcv::PoolAllocator *>(alloc.handle()));
+}
+
 TEST(Allocator, wip_double_destroy_invalid_arg)
 {
     NVCVAllocatorHandle handle;
@@ -588,3 +1127,61 @@ TEST_F(MemAllocatorCreateExecTest, handle_filled_in)
 }
 
 #endif
+
+class HostPinnedMemFlagsTest : public t::TestWithParam<uint32_t>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(_, HostPinnedMemFlagsTest,
+                         t::Values(NVCV_HOST_PINNED_MEM_DEFAULT, NVCV_HOST_PINNED_MEM_WRITE_COMBINED,
+                                   NVCV_HOST_PINNED_MEM_PORTABLE, NVCV_HOST_PINNED_MEM_MAPPED,
+                                   NVCV_HOST_PINNED_MEM_NUMA_LOCAL, NVCV_HOST_PINNED_MEM_STAGING));
+
+TEST_P(HostPinnedMemFlagsTest, allocated_memory_has_requested_cuda_flags)
+{
+    const uint32_t flags = GetParam();
+
+    unsigned int cudaFlags = cudaHostAllocDefault;
+    if (flags & NVCV_HOST_PINNED_MEM_WRITE_COMBINED)
+    {
+        cudaFlags |= cudaHostAllocWriteCombined;
+    }
+    if (flags & NVCV_HOST_PINNED_MEM_PORTABLE)
+    {
+        cudaFlags |= cudaHostAllocPortable;
+    }
+    if (flags & NVCV_HOST_PINNED_MEM_MAPPED)
+    {
+        cudaFlags |= cudaHostAllocMapped;
+    }
+
+    nvcv::CustomAllocator customAlloc;
+    nvcv::PoolAllocator   poolAlloc;
+
+    for (nvcv::IAllocator *alloc : std::initializer_list<nvcv::IAllocator *>{&customAlloc, &poolAlloc})
+    {
+        void *ptr = alloc->allocHostPinnedMem(256, 16, flags);
+        ASSERT_NE(nullptr, ptr);
+
+        unsigned int gotFlags;
+        ASSERT_EQ(cudaSuccess, cudaHostGetFlags(&gotFlags, ptr));
+        // Driver might add other flags, such as cudaHostAllocMapped when using unified addressing.
+        EXPECT_EQ(cudaFlags, gotFlags & cudaFlags);
+        EXPECT_EQ((bool)(flags & NVCV_HOST_PINNED_MEM_WRITE_COMBINED), (bool)(gotFlags & cudaHostAllocWriteCombined));
+
+        // Memory must be readable by host
+        memset(ptr, 0x12, 256);
+        EXPECT_EQ(0x12, static_cast<uint8_t *>(ptr)[255]);
+
+        alloc->freeHostPinnedMem(ptr, 256, 16, flags);
+    }
+}
+
+TEST(Allocator, host_pinned_mem_invalid_flags)
+{
+    nvcv::CustomAllocator alloc;
+
+    void *ptr = nullptr;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorAllocHostPinnedMemoryEx(alloc.handle(), &ptr, 256, 16, 1 << 8));
+    EXPECT_EQ(nullptr, ptr);
+}
@@ -123,6 +123,7 @@ NVCV_INSTANTIATE_TEST_SUITE_P(Full, ColorSpecColorRangeTests,
                               test::ValueList{
                                   NVCV_COLOR_SPEC_UNDEFINED, NVCV_COLOR_SPEC_BT601_ER, NVCV_COLOR_SPEC_BT709_ER,
                                   NVCV_COLOR_SPEC_BT2020_ER, NVCV_COLOR_SPEC_BT2020c_ER, NVCV_COLOR_SPEC_BT2020_PQ_ER,
+                                  NVCV_COLOR_SPEC_BT2020_HLG_ER,
                                   NVCV_COLOR_SPEC_sRGB, NVCV_COLOR_SPEC_DISPLAYP3_LINEAR, NVCV_COLOR_SPEC_DISPLAYP3,
                                   NVCV_COLOR_SPEC_sYCC, NVCV_COLOR_SPEC_MPEG2_BT601, NVCV_COLOR_SPEC_MPEG2_BT709,
                                   NVCV_COLOR_SPEC_MPEG2_SMPTE240M}
@@ -132,7 +133,8 @@ NVCV_INSTANTIATE_TEST_SUITE_P(Limited, ColorSpecColorRangeTests,
                               test::ValueList{NVCV_COLOR_SPEC_BT601, NVCV_COLOR_SPEC_BT709,
                                               NVCV_COLOR_SPEC_BT709_LINEAR, NVCV_COLOR_SPEC_BT2020,
                                               NVCV_COLOR_SPEC_BT2020c, NVCV_COLOR_SPEC_BT2020_PQ,
-                                              NVCV_COLOR_SPEC_BT2020_LINEAR, NVCV_COLOR_SPEC_SMPTE240M}
+                                              NVCV_COLOR_SPEC_BT2020_LINEAR, NVCV_COLOR_SPEC_SMPTE240M,
+                                              NVCV_COLOR_SPEC_BT2020_HLG}
                                   * NVCV_COLOR_RANGE_LIMITED);
 
 TEST_P(ColorSpecColorRangeTests, color_range_correct)
@@ -159,6 +161,10 @@ NVCV_INSTANTIATE_TEST_SUITE_P(PQ, ColorSpecColorTransferFunctionTests,
                               test::ValueList{NVCV_COLOR_SPEC_BT2020_PQ, NVCV_COLOR_SPEC_BT2020_PQ_ER}
                                   * NVCV_COLOR_XFER_PQ);
 
+NVCV_INSTANTIATE_TEST_SUITE_P(HLG, ColorSpecColorTransferFunctionTests,
+                              test::ValueList{NVCV_COLOR_SPEC_BT2020_HLG, NVCV_COLOR_SPEC_BT2020_HLG_ER}
+                                  * NVCV_COLOR_XFER_HLG);
+
 NVCV_INSTANTIATE_TEST_SUITE_P(sRGB, ColorSpecColorTransferFunctionTests,
                               test::ValueList{NVCV_COLOR_SPEC_sRGB, NVCV_COLOR_SPEC_DISPLAYP3, NVCV_COLOR_SPEC_sRGB}
                                   * NVCV_COLOR_XFER_sRGB);
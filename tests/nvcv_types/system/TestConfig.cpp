@@ -120,3 +120,54 @@ TYPED_TEST(ConfigTests, cant_change_limits_when_objects_are_alive)
 
     ASSERT_NO_THROW(SetMaxCount<TypeParam>(5));
 }
+
+template<class T>
+NVCVHandleStats GetHandleStats()
+{
+    if constexpr (std::is_same_v<nvcv::IImage, T>)
+    {
+        return nvcv::cfg::GetImageHandleStats();
+    }
+    else if constexpr (std::is_same_v<nvcv::IImageBatch, T>)
+    {
+        return nvcv::cfg::GetImageBatchHandleStats();
+    }
+    else if constexpr (std::is_same_v<nvcv::IAllocator, T>)
+    {
+        return nvcv::cfg::GetAllocatorHandleStats();
+    }
+    else if constexpr (std::is_same_v<nvcv::ITensor, T>)
+    {
+        return nvcv::cfg::GetTensorHandleStats();
+    }
+    else
+    {
+        static_assert(sizeof(T) != 0 && "Invalid core object type");
+    }
+}
+
+TYPED_TEST(ConfigTests, handle_stats_track_live_objects)
+{
+    NVCVHandleStats before = GetHandleStats<TypeParam>();
+
+    std::vector<std::unique_ptr<TypeParam>> objs;
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_NO_THROW(objs.emplace_back(CreateObj<TypeParam>()));
+    }
+
+    NVCVHandleStats stats = GetHandleStats<TypeParam>();
+    EXPECT_EQ(before.inUse + 5, stats.inUse);
+    EXPECT_LE(stats.inUse, stats.capacity);
+    EXPECT_LE(before.globalRefills, stats.globalRefills);
+
+    objs.clear();
+
+    stats = GetHandleStats<TypeParam>();
+    EXPECT_EQ(before.inUse, stats.inUse);
+}
+
+TEST(ConfigTests, get_handle_stats_null_output_fails)
+{
+    NVCV_EXPECT_STATUS(NVCV_ERROR_INVALID_ARGUMENT, nvcvConfigGetTensorHandleStats(nullptr));
+}
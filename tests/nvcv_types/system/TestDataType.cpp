@@ -62,6 +62,8 @@ INSTANTIATE_TEST_SUITE_P(ExplicitTypes, DataTypeTests,
                                    Params{NVCV_DATA_TYPE_2U8, FMT_DATA_PARAMS(UNSIGNED, X8_Y8), 2, 16},
                                    Params{NVCV_DATA_TYPE_3U8, FMT_DATA_PARAMS(UNSIGNED, X8_Y8_Z8), 3, 24},
                                    Params{NVCV_DATA_TYPE_4U8, FMT_DATA_PARAMS(UNSIGNED, X8_Y8_Z8_W8), 4, 32},
+                                   Params{NVCV_DATA_TYPE_F16, FMT_DATA_PARAMS(FLOAT, X16), 1, 16},
+                                   Params{NVCV_DATA_TYPE_3F16, FMT_DATA_PARAMS(FLOAT, X16_Y16_Z16), 3, 48},
                                    Params{NVCV_DATA_TYPE_F32, FMT_DATA_PARAMS(FLOAT, X32), 1, 32},
                                    Params{NVCV_DATA_TYPE_F64, FMT_DATA_PARAMS(FLOAT, X64), 1, 64},
                                    Params{NVCV_DATA_TYPE_C64, FMT_DATA_PARAMS(COMPLEX, X64), 1, 64},
@@ -214,6 +216,7 @@ NVCV_INSTANTIATE_TEST_SUITE_P(
         {MAKE_DATA_TYPE_ABBREV(UNSIGNED, X1),    0, MAKE_DATA_TYPE_ABBREV(UNSIGNED, X1)},
         {MAKE_DATA_TYPE_ABBREV(UNSIGNED, X2),    0, MAKE_DATA_TYPE_ABBREV(UNSIGNED, X2)},
         {NVCV_DATA_TYPE_3S16,                        2, NVCV_DATA_TYPE_S16},
+        {NVCV_DATA_TYPE_4F16,                        3, NVCV_DATA_TYPE_F16},
         {MAKE_DATA_TYPE_ABBREV(SIGNED, X24),     0, MAKE_DATA_TYPE_ABBREV(SIGNED, X24)},
         {NVCV_DATA_TYPE_2F64,                        1, NVCV_DATA_TYPE_F64},
         {MAKE_DATA_TYPE_ABBREV(SIGNED, X96),     0, MAKE_DATA_TYPE_ABBREV(SIGNED, X96)},
@@ -267,6 +270,7 @@ NVCV_INSTANTIATE_TEST_SUITE_P(_,DataTypeStrideTests,
                                 {NVCV_DATA_TYPE_U16, 2},
                                 {NVCV_DATA_TYPE_3S8, 3},
                                 {NVCV_DATA_TYPE_2U16, 4},
+                                {NVCV_DATA_TYPE_3F16, 6},
                                 {MAKE_DATA_TYPE_ABBREV(SIGNED, X256), 32},
                                 {NVCV_DATA_TYPE_2F32, 8},
                                 {NVCV_DATA_TYPE_C64, 8},
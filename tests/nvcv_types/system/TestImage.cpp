@@ -19,8 +19,10 @@
 
 #include <nvcv/Casts.hpp>
 #include <nvcv/Image.hpp>
+#include <nvcv/Ipc.hpp>
 #include <nvcv/alloc/CustomAllocator.hpp>
 #include <nvcv/alloc/CustomResourceAllocator.hpp>
+#include <nvcv/alloc/PoolAllocator.hpp>
 
 #include <nvcv/Fwd.hpp>
 
@@ -140,6 +142,38 @@ TEST(Image, wip_user_pointer)
     ASSERT_EQ(&img, cxxPtr) << "cxx object pointer must always be associated with the corresponding handle";
 }
 
+TEST(Image, release_stream_defers_free)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+    {
+        nvcv::PoolAllocator alloc;
+
+        void *basePtr;
+        {
+            nvcv::Image img({163, 117}, nvcv::FMT_RGBA8, &alloc);
+            ASSERT_NO_THROW(img.setReleaseStream(stream));
+
+            auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(img.exportData());
+            ASSERT_NE(nullptr, data);
+            basePtr = data->plane(0).basePtr;
+
+            ASSERT_EQ(cudaSuccess, cudaMemsetAsync(basePtr, 0, 4096, stream));
+        }
+
+        // Memory is given back once the work on stream is done, and the pool hands it out again
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        nvcv::Image img({163, 117}, nvcv::FMT_RGBA8, &alloc);
+        auto       *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(img.exportData());
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(basePtr, data->plane(0).basePtr);
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
 TEST(Image, wip_create_managed)
 {
     ;
@@ -197,6 +231,30 @@ TEST(Image, wip_create_managed)
     }
 }
 
+TEST(Image, export_ipc_planes_in_same_allocation)
+{
+    nvcv::Image img({64, 32}, nvcv::FMT_NV12);
+
+    NVCVImageIpcHandle ipc;
+    ASSERT_NO_THROW(ipc = nvcv::ExportIpc(img, nullptr));
+
+    auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(img.exportData());
+    ASSERT_NE(nullptr, data);
+    ASSERT_EQ(2, ipc.data.buffer.strided.numPlanes);
+
+    EXPECT_EQ(data->plane(1).basePtr - data->plane(0).basePtr, ipc.planeOffset[1] - ipc.planeOffset[0]);
+    EXPECT_EQ(nullptr, ipc.data.buffer.strided.planes[0].basePtr);
+    EXPECT_EQ(nullptr, ipc.data.buffer.strided.planes[1].basePtr);
+    EXPECT_EQ(data->plane(1).rowStride, ipc.data.buffer.strided.planes[1].rowStride);
+
+    NVCVImageHandle handle;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageExportIpc(img.handle(), nullptr, nullptr));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageImportIpc(nullptr, nullptr, &handle));
+
+    ipc.data.buffer.strided.numPlanes = 0;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageImportIpc(&ipc, nullptr, &handle));
+}
+
 TEST(ImageWrapData, wip_create)
 {
     nvcv::ImageDataStridedCuda::Buffer buf;
@@ -531,3 +589,52 @@ TEST(Image, wip_memcpy_opencv_write)
 }
 
 #endif
+
+TEST(ImageRoi, wip_create)
+{
+    nvcv::ImageRoi                   *roi = nullptr;
+    nvcv::ImagePlaneStrided           goldPlanes[2];
+    const nvcv::IImageDataStridedCuda *origData;
+
+    {
+        nvcv::Image img({164, 118}, nvcv::FMT_NV12);
+
+        origData = dynamic_cast<const nvcv::IImageDataStridedCuda *>(img.exportData());
+        ASSERT_NE(nullptr, origData);
+        ASSERT_EQ(2, origData->numPlanes());
+
+        goldPlanes[0] = origData->plane(0);
+        goldPlanes[0].basePtr += 10 * goldPlanes[0].rowStride + 20;
+        goldPlanes[1] = origData->plane(1);
+        goldPlanes[1].basePtr += 5 * goldPlanes[1].rowStride + 20;
+
+        roi = new nvcv::ImageRoi(img, NVCVRectI{20, 10, 64, 32});
+
+        NVCVImageHandle handle;
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageRoi(img.handle(), nullptr, &handle));
+        NVCVRectI outside = {120, 10, 64, 32};
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageRoi(img.handle(), &outside, &handle));
+        NVCVRectI misaligned = {21, 10, 64, 32};
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageRoi(img.handle(), &misaligned, &handle));
+    }
+    // roi must keep the parent image alive
+
+    EXPECT_EQ(nvcv::Size2D(64, 32), roi->size());
+    EXPECT_EQ(nvcv::FMT_NV12, roi->format());
+
+    auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(roi->exportData());
+    ASSERT_NE(nullptr, data);
+    ASSERT_EQ(2, data->numPlanes());
+
+    EXPECT_EQ(goldPlanes[0].basePtr, data->plane(0).basePtr);
+    EXPECT_EQ(goldPlanes[0].rowStride, data->plane(0).rowStride);
+    EXPECT_EQ(64, data->plane(0).width);
+    EXPECT_EQ(32, data->plane(0).height);
+
+    EXPECT_EQ(goldPlanes[1].basePtr, data->plane(1).basePtr);
+    EXPECT_EQ(goldPlanes[1].rowStride, data->plane(1).rowStride);
+    EXPECT_EQ(32, data->plane(1).width);
+    EXPECT_EQ(16, data->plane(1).height);
+
+    delete roi;
+}
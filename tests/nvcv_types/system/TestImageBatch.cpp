@@ -18,10 +18,15 @@
 #include "Definitions.hpp"
 
 #include <common/ValueTests.hpp>
+#include <nvcv/Image.hpp>
 #include <nvcv/ImageBatch.hpp>
+#include <nvcv/PackedImageBatch.hpp>
 
+#include <atomic>
 #include <list>
+#include <memory>
 #include <random>
+#include <thread>
 
 #include <nvcv/Fwd.hpp>
 
@@ -359,6 +364,166 @@ TEST(ImageBatchVarShape, wip_sync)
     ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
 }
 
+TEST(ImageBatchVarShape, wip_reexport_doesnt_overwrite_previous_data)
+{
+    cudaStream_t stream1, stream2;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream1));
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream2));
+
+    nvcv::ImageBatchVarShape batch(8);
+
+    std::vector<nvcv::Image> vec0, vec1;
+    for (int i = 0; i < batch.capacity(); ++i)
+    {
+        vec0.emplace_back(nvcv::Size2D{32 + i * 2, 16}, nvcv::FMT_U8);
+        vec1.emplace_back(nvcv::Size2D{16, 32 + i * 2}, nvcv::FMT_RGBA8);
+    }
+
+    auto getGold = [](const std::vector<nvcv::Image> &vec)
+    {
+        std::vector<NVCVImageBufferStrided> gold;
+        for (const nvcv::Image &img : vec)
+        {
+            auto *imgdata = dynamic_cast<const nvcv::IImageDataStridedCuda *>(img.exportData());
+            EXPECT_NE(nullptr, imgdata);
+            gold.push_back(imgdata->cdata().buffer.strided);
+        }
+        return gold;
+    };
+
+    batch.pushBack(vec0.begin(), vec0.end());
+
+    auto *devdata = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(batch.exportData(stream1));
+    ASSERT_NE(nullptr, devdata);
+    const NVCVImageBufferStrided *devImages0 = devdata->imageList();
+
+    // Modify the batch while the first upload might still be in flight,
+    // and export it in another stream.
+    batch.clear();
+    batch.pushBack(vec1.begin(), vec1.end());
+
+    devdata = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(batch.exportData(stream2));
+    ASSERT_NE(nullptr, devdata);
+    const NVCVImageBufferStrided *devImages1 = devdata->imageList();
+
+    EXPECT_NE(devImages0, devImages1);
+
+    std::vector<NVCVImageBufferStrided> images0(batch.capacity()), images1(batch.capacity());
+    ASSERT_EQ(cudaSuccess, cudaMemcpyAsync(images0.data(), devImages0, sizeof(images0[0]) * images0.size(),
+                                           cudaMemcpyDeviceToHost, stream1));
+    ASSERT_EQ(cudaSuccess, cudaMemcpyAsync(images1.data(), devImages1, sizeof(images1[0]) * images1.size(),
+                                           cudaMemcpyDeviceToHost, stream2));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream1));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream2));
+
+    EXPECT_THAT(images0, t::ElementsAreArray(getGold(vec0)));
+    EXPECT_THAT(images1, t::ElementsAreArray(getGold(vec1)));
+
+    // Removing images doesn't require a new upload
+    batch.popBack(1);
+    devdata = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(batch.exportData(stream2));
+    ASSERT_NE(nullptr, devdata);
+    EXPECT_EQ(devImages1, devdata->imageList());
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream1));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream2));
+}
+
+// Work submitted to stream afterwards stays pending until release is set.
+static void HoldStream(cudaStream_t stream, std::atomic<bool> &release)
+{
+    ASSERT_EQ(cudaSuccess, cudaLaunchHostFunc(
+                               stream,
+                               [](void *arg)
+                               {
+                                   auto &flag = *static_cast<std::atomic<bool> *>(arg);
+                                   while (!flag)
+                                   {
+                                       std::this_thread::yield();
+                                   }
+                               },
+                               &release));
+}
+
+static std::vector<NVCVImageBufferStrided> GetImageBuffers(const std::vector<nvcv::Image> &images)
+{
+    std::vector<NVCVImageBufferStrided> buffers;
+    for (const nvcv::Image &img : images)
+    {
+        auto *imgdata = dynamic_cast<const nvcv::IImageDataStridedCuda *>(img.exportData());
+        EXPECT_NE(nullptr, imgdata);
+        buffers.push_back(imgdata->cdata().buffer.strided);
+    }
+    return buffers;
+}
+
+TEST(ImageBatchVarShape, ring_not_reused_while_read_by_another_stream)
+{
+    cudaStream_t stream1, stream2;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream1));
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream2));
+
+    nvcv::ImageBatchVarShape batch(4);
+
+    // More image sets than buffers in the ring, all of them get reused.
+    constexpr int kNumSets = 10;
+
+    std::vector<std::vector<nvcv::Image>> sets(kNumSets);
+    for (int s = 0; s < kNumSets; ++s)
+    {
+        for (int i = 0; i < batch.capacity(); ++i)
+        {
+            sets[s].emplace_back(nvcv::Size2D{16 + s, 8 + i}, nvcv::FMT_U8);
+        }
+    }
+
+    // Host-pinned so that reading back doesn't block the host.
+    NVCVImageBufferStrided *readBack;
+    ASSERT_EQ(cudaSuccess, cudaMallocHost(&readBack, 2 * kNumSets * batch.capacity() * sizeof(*readBack)));
+
+    auto exportAndReadBack = [&](cudaStream_t stream, NVCVImageBufferStrided *dst)
+    {
+        auto *devdata = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(batch.exportData(stream));
+        ASSERT_NE(nullptr, devdata);
+        ASSERT_EQ(batch.capacity(), devdata->numImages());
+        ASSERT_EQ(cudaSuccess, cudaMemcpyAsync(dst, devdata->imageList(), batch.capacity() * sizeof(*dst),
+                                               cudaMemcpyDeviceToHost, stream));
+    };
+
+    // stream2 is held while stream1 uploads all the sets, each one is also read
+    // from stream2, whose pending reads must still see their own set.
+    std::atomic<bool> release = false;
+    HoldStream(stream2, release);
+
+    for (int s = 0; s < kNumSets; ++s)
+    {
+        batch.clear();
+        batch.pushBack(sets[s].begin(), sets[s].end());
+
+        exportAndReadBack(stream1, readBack + (2 * s) * batch.capacity());
+        exportAndReadBack(stream2, readBack + (2 * s + 1) * batch.capacity());
+    }
+
+    release = true;
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream1));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream2));
+
+    for (int s = 0; s < kNumSets; ++s)
+    {
+        std::vector<NVCVImageBufferStrided> gold = GetImageBuffers(sets[s]);
+
+        NVCVImageBufferStrided *images1 = readBack + (2 * s) * batch.capacity();
+        NVCVImageBufferStrided *images2 = readBack + (2 * s + 1) * batch.capacity();
+
+        EXPECT_THAT(std::vector(images1, images1 + batch.capacity()), t::ElementsAreArray(gold)) << "set " << s;
+        EXPECT_THAT(std::vector(images2, images2 + batch.capacity()), t::ElementsAreArray(gold)) << "set " << s;
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaFreeHost(readBack));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream1));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream2));
+}
+
 TEST(ImageBatch, wip_user_pointer)
 {
     nvcv::ImageBatchVarShape batch(3);
@@ -428,3 +593,384 @@ TEST(ImageBatch, wip_cast)
     EXPECT_EQ(NVCV_SUCCESS, nvcvImageBatchDecRef(handle, &ref));
     EXPECT_EQ(ref, 0);
 }
+
+TEST(ImageBatchVarShapeSubrange, wip_create)
+{
+    std::vector<std::unique_ptr<nvcv::Image>> images;
+    for (int i = 0; i < 5; ++i)
+    {
+        images.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{32 + i, 16 + i}, nvcv::FMT_U8));
+    }
+
+    nvcv::ImageBatchVarShapeSubrange *subrange = nullptr;
+    {
+        nvcv::ImageBatchVarShape batch(5);
+        for (auto &img : images)
+        {
+            batch.pushBack(*img);
+        }
+
+        subrange = new nvcv::ImageBatchVarShapeSubrange(batch, 1, 3);
+
+        NVCVImageBatchHandle handle;
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeSubrange(batch.handle(), 3, 3, &handle));
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeSubrange(batch.handle(), -1, 2, &handle));
+    }
+    // subrange must keep the parent batch alive
+
+    ASSERT_EQ(3, subrange->numImages());
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(images[i + 1]->handle(), (*subrange)[i].handle());
+    }
+    EXPECT_EQ(nvcv::Size2D(35, 19), subrange->maxSize());
+    EXPECT_EQ(nvcv::FMT_U8, subrange->uniqueFormat());
+
+    ASSERT_EQ(subrange, nvcv::StaticCast<nvcv::ImageBatchVarShapeSubrange *>(subrange->handle()));
+
+    delete subrange;
+}
+
+TEST(PackedImageLayout, offsets_are_aligned_and_dont_overlap)
+{
+    std::vector<nvcv::Size2D> sizes{
+        {17, 5},
+        {64, 32},
+        { 1,  1},
+        {33, 9}
+    };
+
+    nvcv::PackedImageLayout layout = nvcv::CalcPackedImageLayout(sizes, nvcv::FMT_NV12);
+    ASSERT_EQ(sizes.size(), layout.offsets.size());
+    ASSERT_EQ(sizes.size(), layout.reqs.size());
+
+    int64_t end = 0;
+    for (size_t i = 0; i < sizes.size(); ++i)
+    {
+        const nvcv::Image::Requirements reqs = nvcv::Image::CalcRequirements(sizes[i], nvcv::FMT_NV12);
+        EXPECT_EQ(0, layout.offsets[i] % reqs.alignBytes);
+        EXPECT_LE(end, layout.offsets[i]);
+
+        end = layout.offsets[i] + reqs.planeRowStride[0] * sizes[i].h + reqs.planeRowStride[1] * (sizes[i].h / 2);
+    }
+    EXPECT_LE(end, layout.totalSizeBytes);
+    EXPECT_EQ(0, layout.totalSizeBytes % layout.alignBytes);
+
+    EXPECT_EQ(0, nvcv::CalcPackedImageLayout({}, nvcv::FMT_U8).totalSizeBytes);
+}
+
+TEST(PackedImageBatchVarShape, images_are_inside_buffer)
+{
+    std::vector<nvcv::Size2D> sizes{
+        {32, 16},
+        {35, 19},
+        { 7,  3}
+    };
+
+    auto batch = std::make_unique<nvcv::PackedImageBatchVarShape>(sizes, nvcv::FMT_RGB8);
+
+    ASSERT_EQ(3, batch->numImages());
+    EXPECT_EQ(nvcv::Size2D(35, 19), batch->maxSize());
+    EXPECT_EQ(nvcv::FMT_RGB8, batch->uniqueFormat());
+    ASSERT_NE(nullptr, batch->buffer());
+
+    const nvcv::PackedImageLayout &layout = batch->layout();
+    for (int i = 0; i < batch->numImages(); ++i)
+    {
+        auto *imgData = dynamic_cast<const nvcv::IImageDataStridedCuda *>((*batch)[i].exportData());
+        ASSERT_NE(nullptr, imgData);
+
+        EXPECT_EQ(sizes[i], imgData->size());
+        EXPECT_EQ(reinterpret_cast<NVCVByte *>(batch->buffer()) + layout.offsets[i], imgData->plane(0).basePtr);
+        EXPECT_EQ(layout.reqs[i].planeRowStride[0], imgData->plane(0).rowStride);
+    }
+
+    // The whole batch can be cleared with only one call
+    ASSERT_EQ(cudaSuccess, cudaMemset(batch->buffer(), 0xAB, layout.totalSizeBytes));
+
+    auto *imgData = dynamic_cast<const nvcv::IImageDataStridedCuda *>((*batch)[2].exportData());
+    ASSERT_NE(nullptr, imgData);
+    uint8_t pixel[3];
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(pixel, imgData->plane(0).basePtr, sizeof(pixel), cudaMemcpyDeviceToHost));
+    EXPECT_EQ(0xAB, pixel[2]);
+
+    ASSERT_EQ(batch.get(), nvcv::StaticCast<nvcv::PackedImageBatchVarShape *>(batch->handle()));
+
+    ASSERT_NO_THROW(batch.reset());
+}
+
+TEST(ImageBatchVarShape, set_image_uploads_only_replaced_images)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    std::vector<std::unique_ptr<nvcv::Image>> images;
+    for (int i = 0; i < 6; ++i)
+    {
+        images.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{32 + i, 16 + i}, nvcv::FMT_U8));
+    }
+    nvcv::Image other(nvcv::Size2D{64, 48}, nvcv::FMT_RGB8);
+
+    nvcv::ImageBatchVarShape batch(6);
+    for (auto &img : images)
+    {
+        batch.pushBack(*img);
+    }
+
+    auto getDevImages = [&]()
+    {
+        auto *devdata = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(batch.exportData(stream));
+        EXPECT_NE(nullptr, devdata);
+
+        std::vector<NVCVImageBufferStrided> devImages(devdata->numImages());
+        EXPECT_EQ(cudaSuccess, cudaMemcpyAsync(devImages.data(), devdata->imageList(),
+                                               sizeof(devImages[0]) * devImages.size(), cudaMemcpyDeviceToHost,
+                                               stream));
+        EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+        return std::make_pair(devdata->imageList(), devImages);
+    };
+
+    auto getGold = [&]()
+    {
+        std::vector<NVCVImageBufferStrided> gold;
+        for (int i = 0; i < batch.numImages(); ++i)
+        {
+            gold.push_back(batch[i].exportData()->cdata().buffer.strided);
+        }
+        return gold;
+    };
+
+    auto [list0, devImages0] = getDevImages();
+    EXPECT_THAT(devImages0, t::ElementsAreArray(getGold()));
+
+    // Refilling the batch with the same images doesn't upload anything
+    batch.clear();
+    for (auto &img : images)
+    {
+        batch.pushBack(*img);
+    }
+    auto [list1, devImages1] = getDevImages();
+    EXPECT_EQ(list0, list1);
+    EXPECT_THAT(devImages1, t::ElementsAreArray(getGold()));
+
+    // Replacing an image in the middle keeps the other ones
+    batch.setImage(3, other);
+    EXPECT_EQ(other.handle(), batch[3].handle());
+    EXPECT_EQ(nvcv::Size2D(64, 48), batch.maxSize());
+    EXPECT_EQ(nvcv::FMT_NONE, batch.uniqueFormat());
+
+    auto [list2, devImages2] = getDevImages();
+    EXPECT_NE(list1, list2);
+    EXPECT_THAT(devImages2, t::ElementsAreArray(getGold()));
+
+    batch.setImage(3, *images[3]);
+    EXPECT_EQ(nvcv::Size2D(37, 21), batch.maxSize());
+    EXPECT_EQ(nvcv::FMT_U8, batch.uniqueFormat());
+    EXPECT_THAT(getDevImages().second, t::ElementsAreArray(getGold()));
+
+    EXPECT_EQ(NVCV_ERROR_OVERFLOW, nvcvImageBatchVarShapeSetImage(batch.handle(), 6, other.handle()));
+    EXPECT_EQ(NVCV_ERROR_OVERFLOW, nvcvImageBatchVarShapeSetImage(batch.handle(), -1, other.handle()));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeSetImage(batch.handle(), 0, nullptr));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(ImageBatchVarShape, set_image_exported_on_two_streams)
+{
+    cudaStream_t stream1, stream2;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream1));
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream2));
+
+    std::vector<nvcv::Image> images;
+    for (int i = 0; i < 6; ++i)
+    {
+        images.emplace_back(nvcv::Size2D{32 + i, 16 + i}, nvcv::FMT_U8);
+    }
+
+    nvcv::ImageBatchVarShape batch(6);
+    batch.pushBack(images.begin(), images.end());
+
+    NVCVImageBufferStrided *readBack;
+    ASSERT_EQ(cudaSuccess, cudaMallocHost(&readBack, 3 * batch.capacity() * sizeof(*readBack)));
+
+    auto exportAndReadBack = [&](cudaStream_t stream, NVCVImageBufferStrided *dst)
+    {
+        auto *devdata = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(batch.exportData(stream));
+        ASSERT_NE(nullptr, devdata);
+        ASSERT_EQ(cudaSuccess, cudaMemcpyAsync(dst, devdata->imageList(), batch.capacity() * sizeof(*dst),
+                                               cudaMemcpyDeviceToHost, stream));
+    };
+
+    // The first upload stays pending while the batch is modified and exported
+    // on stream2, which takes the images that weren't replaced from it.
+    std::atomic<bool> release = false;
+    HoldStream(stream1, release);
+
+    exportAndReadBack(stream1, readBack);
+    std::vector<NVCVImageBufferStrided> gold0 = GetImageBuffers(images);
+
+    nvcv::Image other(nvcv::Size2D{64, 48}, nvcv::FMT_RGB8);
+    batch.setImage(2, other);
+
+    exportAndReadBack(stream2, readBack + batch.capacity());
+    // Unmodified, read from both streams
+    exportAndReadBack(stream1, readBack + 2 * batch.capacity());
+
+    std::vector<NVCVImageBufferStrided> gold1 = gold0;
+    gold1[2]                                   = other.exportData()->cdata().buffer.strided;
+
+    release = true;
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream1));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream2));
+
+    int32_t n = batch.capacity();
+    EXPECT_THAT(std::vector(readBack, readBack + n), t::ElementsAreArray(gold0));
+    EXPECT_THAT(std::vector(readBack + n, readBack + 2 * n), t::ElementsAreArray(gold1));
+    EXPECT_THAT(std::vector(readBack + 2 * n, readBack + 3 * n), t::ElementsAreArray(gold1));
+
+    ASSERT_EQ(cudaSuccess, cudaFreeHost(readBack));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream1));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream2));
+}
+
+TEST(ImageBatchVarShapeWrapData, wraps_device_descriptors)
+{
+    std::vector<std::unique_ptr<nvcv::Image>> images;
+    std::vector<NVCVImageBufferStrided>       hostImages;
+    for (int i = 0; i < 3; ++i)
+    {
+        images.emplace_back(std::make_unique<nvcv::Image>(nvcv::Size2D{32 + i, 48 - i}, nvcv::FMT_RGB8));
+        hostImages.push_back(images.back()->exportData()->cdata().buffer.strided);
+    }
+    std::vector<NVCVImageFormat> hostFormats(hostImages.size(), NVCV_IMAGE_FORMAT_RGB8);
+
+    // Descriptors as written by some producer on the device
+    NVCVImageBufferStrided *devImages;
+    NVCVImageFormat        *devFormats;
+    ASSERT_EQ(cudaSuccess, cudaMalloc(&devImages, sizeof(*devImages) * hostImages.size()));
+    ASSERT_EQ(cudaSuccess, cudaMalloc(&devFormats, sizeof(*devFormats) * hostFormats.size()));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(devImages, hostImages.data(), sizeof(*devImages) * hostImages.size(),
+                                      cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(devFormats, hostFormats.data(), sizeof(*devFormats) * hostFormats.size(),
+                                      cudaMemcpyHostToDevice));
+
+    nvcv::ImageBatchVarShapeDataStridedCuda::Buffer buf = {};
+    buf.uniqueFormat                                    = NVCV_IMAGE_FORMAT_RGB8;
+    buf.maxWidth                                        = 34;
+    buf.maxHeight                                       = 48;
+    buf.imageList                                       = devImages;
+    buf.formatList                                      = devFormats;
+
+    int numCleanups = 0;
+
+    auto cleanup = [&](const nvcv::IImageBatchData &data)
+    {
+        EXPECT_EQ(devImages, data.cdata().buffer.varShapeStrided.imageList);
+        ++numCleanups;
+    };
+
+    {
+        nvcv::ImageBatchVarShapeWrapData batch(nvcv::ImageBatchVarShapeDataStridedCuda(3, buf), cleanup);
+
+        NVCVTypeImageBatch type;
+        ASSERT_EQ(NVCV_SUCCESS, nvcvImageBatchGetType(batch.handle(), &type));
+        EXPECT_EQ(NVCV_TYPE_IMAGEBATCH_VARSHAPE_WRAPDATA, type);
+
+        EXPECT_EQ(3, batch.numImages());
+        EXPECT_EQ(nvcv::Size2D(34, 48), batch.maxSize());
+        EXPECT_EQ(nvcv::FMT_RGB8, batch.uniqueFormat());
+        EXPECT_EQ(&batch, nvcv::StaticCast<nvcv::IImageBatchVarShape *>(batch.handle()));
+
+        auto *devdata = dynamic_cast<const nvcv::IImageBatchVarShapeDataStridedCuda *>(batch.exportData(0));
+        ASSERT_NE(nullptr, devdata);
+        EXPECT_EQ(3, devdata->numImages());
+        EXPECT_EQ(devImages, devdata->imageList());
+        EXPECT_EQ(devFormats, devdata->formatList());
+
+        // Host format list is made up from the unique format
+        ASSERT_NE(nullptr, devdata->hostFormatList());
+        EXPECT_THAT(std::vector<NVCVImageFormat>(devdata->hostFormatList(), devdata->hostFormatList() + 3),
+                    t::ElementsAreArray(hostFormats));
+
+        NVCVImageHandle img = images[0]->handle();
+        EXPECT_EQ(NVCV_ERROR_INVALID_OPERATION, nvcvImageBatchVarShapePushImages(batch.handle(), &img, 1));
+        EXPECT_EQ(NVCV_ERROR_INVALID_OPERATION, nvcvImageBatchVarShapePopImages(batch.handle(), 1));
+        EXPECT_EQ(NVCV_ERROR_INVALID_OPERATION, nvcvImageBatchVarShapeClear(batch.handle()));
+    }
+    EXPECT_EQ(1, numCleanups);
+
+    const nvcv::ImageBatchVarShapeDataStridedCuda batchData(3, buf);
+
+    NVCVImageBatchData   data = batchData.cdata();
+    NVCVImageBatchHandle handle;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeWrapDataConstruct(nullptr, nullptr, nullptr, &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeWrapDataConstruct(&data, nullptr, nullptr, nullptr));
+
+    data.buffer.varShapeStrided.uniqueFormat = NVCV_IMAGE_FORMAT_NONE;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeWrapDataConstruct(&data, nullptr, nullptr, &handle));
+
+    data.buffer.varShapeStrided.hostFormatList = hostFormats.data();
+    data.buffer.varShapeStrided.maxWidth       = 0;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeWrapDataConstruct(&data, nullptr, nullptr, &handle));
+
+    EXPECT_EQ(cudaSuccess, cudaFree(devImages));
+    EXPECT_EQ(cudaSuccess, cudaFree(devFormats));
+}
+
+TEST(ImageBatchVarShape, construct_images_in_one_allocation)
+{
+    std::vector<nvcv::Size2D> sizes = {
+        {33, 17},
+        {64, 64},
+        { 7,  3},
+        {20, 41}
+    };
+
+    nvcv::ImageBatchVarShape batch(5);
+    nvcv::Image              first({16, 16}, nvcv::FMT_NV12);
+    batch.pushBack(first);
+
+    ASSERT_NO_THROW(batch.constructImages(sizes, nvcv::FMT_NV12));
+    ASSERT_EQ(5, batch.numImages());
+    EXPECT_EQ(nvcv::Size2D(64, 64), batch.maxSize());
+    EXPECT_EQ(nvcv::FMT_NV12, batch.uniqueFormat());
+
+    // Planes of consecutive images follow each other, without overlapping
+    const NVCVByte *end = nullptr;
+    for (int i = 0; i < 4; ++i)
+    {
+        auto *data = dynamic_cast<const nvcv::IImageDataStridedCuda *>(batch[i + 1].exportData());
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(sizes[i], data->size());
+        EXPECT_EQ(nvcv::FMT_NV12, data->format());
+
+        for (int p = 0; p < data->numPlanes(); ++p)
+        {
+            const NVCVImagePlaneStrided &plane = data->plane(p);
+            if (end != nullptr)
+            {
+                EXPECT_LE(end, plane.basePtr);
+            }
+            end = plane.basePtr + static_cast<int64_t>(plane.rowStride) * plane.height;
+        }
+    }
+
+    // Images fetched from the batch outlive it
+    NVCVImageHandle img;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageBatchVarShapeGetImages(batch.handle(), 2, &img, 1));
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageIncRef(img, nullptr));
+    batch.popBack(4);
+
+    int32_t widths[] = {8, 8}, heights[] = {8, 8};
+    EXPECT_EQ(NVCV_ERROR_OVERFLOW,
+              nvcvImageBatchVarShapeConstructImages(batch.handle(), widths, heights, 5, NVCV_IMAGE_FORMAT_U8));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcvImageBatchVarShapeConstructImages(batch.handle(), widths, nullptr, 2, NVCV_IMAGE_FORMAT_U8));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcvImageBatchVarShapeConstructImages(batch.handle(), widths, heights, 0, NVCV_IMAGE_FORMAT_U8));
+    EXPECT_EQ(1, batch.numImages());
+
+    int refCount;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageDecRef(img, &refCount));
+    EXPECT_EQ(1, refCount);
+}
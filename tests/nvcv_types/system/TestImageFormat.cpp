@@ -576,6 +576,48 @@ TEST_P(ImageFormatTests, check_plane_pixel_type)
     EXPECT_EQ(p.planes[3].pixFormat, pix);
 }
 
+TEST_P(ImageFormatTests, cpp_queries_match_c_api)
+{
+    const Params &p = GetParam();
+
+    nvcv::ImageFormat fmt{p.imgFormat};
+
+    // Second pass is served by the cached format descriptor
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        EXPECT_EQ(p.dataKind, static_cast<NVCVDataKind>(fmt.dataKind()));
+        EXPECT_EQ(p.memLayout, static_cast<NVCVMemLayout>(fmt.memLayout()));
+        EXPECT_EQ(p.swizzle, static_cast<NVCVSwizzle>(fmt.swizzle()));
+        EXPECT_EQ(p.planeCount, fmt.numPlanes());
+
+        int numChannels = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(p.planes[i].pixFormat, static_cast<NVCVDataType>(fmt.planeDataType(i))) << "plane " << i;
+            EXPECT_EQ(p.planes[i].channels, fmt.planeNumChannels(i)) << "plane " << i;
+
+            int32_t strideBytes;
+            ASSERT_EQ(NVCV_SUCCESS, nvcvImageFormatGetPlanePixelStrideBytes(p.imgFormat, i, &strideBytes));
+            EXPECT_EQ(strideBytes, fmt.planePixelStrideBytes(i)) << "plane " << i;
+
+            numChannels += p.planes[i].channels;
+        }
+        EXPECT_EQ(numChannels, fmt.numChannels());
+    }
+}
+
+TEST(ImageFormatTests, constexpr_queries)
+{
+    constexpr nvcv::ImageFormat fmt{NVCV_IMAGE_FORMAT_NV12_BL};
+
+    static_assert(fmt.dataKind() == nvcv::DataKind::UNSIGNED, "wrong data kind");
+    static_assert(fmt.memLayout() == nvcv::MemLayout::BLOCK_LINEAR, "wrong memory layout");
+    static_assert(fmt.swizzle() == nvcv::Swizzle::S_XYZ0, "wrong swizzle");
+    static_assert(nvcv::DataType{NVCV_DATA_TYPE_2F32}.dataKind() == nvcv::DataKind::FLOAT, "wrong data kind");
+
+    EXPECT_EQ(nvcv::DataKind::FLOAT, nvcv::ImageFormat{NVCV_IMAGE_FORMAT_BGRf32p}.dataKind());
+}
+
 TEST(ImageFormatTests, invalid_plane_swizzle)
 {
     // purposedly wrong fmt (more packing channels than swizzle channels)
@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/ImagePool.hpp>
+#include <nvcv/alloc/CustomAllocator.hpp>
+#include <nvcv/alloc/CustomResourceAllocator.hpp>
+
+#include <nvcv/Fwd.hpp>
+
+TEST(ImagePool, size_class_holds_size)
+{
+    for (int v : {1, 15, 16, 17, 100, 128, 129, 1000, 1920, 4097})
+    {
+        nvcv::Size2D cls = nvcv::ImagePool::CalcSizeClass({v, v});
+        EXPECT_GE(cls.w, v);
+        EXPECT_EQ(cls.w, cls.h);
+        EXPECT_LE(cls.w, std::max(v + v / 4, 16)) << v;
+        EXPECT_EQ(cls, nvcv::ImagePool::CalcSizeClass(cls));
+    }
+}
+
+TEST(ImagePool, reuses_buffers_of_destroyed_images)
+{
+    int numAllocs = 0;
+
+    nvcv::CustomAllocator<nvcv::CustomCudaMemAllocator> alloc{
+        nvcv::CustomCudaMemAllocator{
+            [&numAllocs](int64_t size, int32_t align)
+            {
+                ++numAllocs;
+                void *ptr = nullptr;
+                EXPECT_EQ(cudaSuccess, cudaMalloc(&ptr, size));
+                return ptr;
+            },
+            [](void *ptr, int64_t size, int32_t align) { EXPECT_EQ(cudaSuccess, cudaFree(ptr)); }}
+    };
+
+    nvcv::ImagePool pool(&alloc);
+
+    auto img0 = pool.acquire({100, 50}, nvcv::FMT_NV12);
+    ASSERT_NE(nullptr, img0);
+    EXPECT_EQ(nvcv::Size2D(100, 50), img0->size());
+    EXPECT_EQ(nvcv::FMT_NV12, img0->format());
+    EXPECT_EQ(1, numAllocs);
+
+    auto *data0 = dynamic_cast<const nvcv::IImageDataStridedCuda *>(img0->exportData());
+    ASSERT_NE(nullptr, data0);
+    void *ptr0 = data0->plane(0).basePtr;
+
+    img0.reset();
+    EXPECT_EQ(1, pool.numBuffers());
+    EXPECT_EQ(1, pool.numFreeBuffers());
+
+    // Another size of the same class gets the same buffer
+    auto img1 = pool.acquire({98, 48}, nvcv::FMT_NV12);
+    auto *data1 = dynamic_cast<const nvcv::IImageDataStridedCuda *>(img1->exportData());
+    ASSERT_NE(nullptr, data1);
+    EXPECT_EQ(ptr0, data1->plane(0).basePtr);
+    EXPECT_EQ(nvcv::Size2D(98, 48), data1->size());
+    EXPECT_EQ(1, numAllocs);
+    EXPECT_EQ(0, pool.numFreeBuffers());
+
+    // But not other formats
+    auto img2 = pool.acquire({98, 48}, nvcv::FMT_U8);
+    EXPECT_EQ(2, numAllocs);
+
+    nvcv::ImageBatchVarShape batch(2);
+    batch.pushBack(*img1);
+    batch.pushBack(*img2);
+    EXPECT_EQ(nvcv::Size2D(98, 48), batch.maxSize());
+    batch.clear();
+
+    img1.reset();
+    img2.reset();
+    EXPECT_EQ(2, pool.numFreeBuffers());
+
+    pool.trim();
+    EXPECT_EQ(0, pool.numBuffers());
+    EXPECT_EQ(0, pool.numFreeBuffers());
+}
+
+TEST(ImagePool, images_can_outlive_pool)
+{
+    std::unique_ptr<nvcv::ImageWrapData> img;
+    {
+        nvcv::ImagePool pool;
+        img = pool.acquire({32, 32}, nvcv::FMT_RGBA8);
+    }
+    ASSERT_NE(nullptr, img);
+    EXPECT_EQ(nvcv::Size2D(32, 32), img->size());
+    EXPECT_NO_THROW(img.reset());
+}
@@ -20,12 +20,20 @@
 #include <common/HashUtils.hpp>
 #include <common/ValueTests.hpp>
 #include <nvcv/Image.hpp>
+#include <nvcv/Ipc.hpp>
 #include <nvcv/Tensor.hpp>
 #include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/Transfer.hpp>
 #include <nvcv/alloc/CustomAllocator.hpp>
 #include <nvcv/alloc/CustomResourceAllocator.hpp>
+#include <nvcv/alloc/ManagedAllocator.hpp>
+#include <nvcv/alloc/PoolAllocator.hpp>
 
+#include <filesystem>
+#include <fstream>
 #include <list>
+#include <memory>
+#include <numeric>
 #include <random>
 #include <vector>
 
@@ -297,6 +305,41 @@ TEST(Tensor, wip_cast)
     EXPECT_EQ(ref, 0);
 }
 
+TEST(Tensor, calc_requirements_reused_are_identical)
+{
+    // More shapes than requirements remembered per thread, so that some are evicted.
+    std::vector<NVCVTensorRequirements> first;
+    for (int i = 0; i < 20; ++i)
+    {
+        first.push_back(nvcv::Tensor::CalcRequirements(i % 3 + 1, {64 + i, 33}, nvcv::FMT_RGB8));
+    }
+
+    for (int round = 0; round < 2; ++round)
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            NVCVTensorRequirements reqs = nvcv::Tensor::CalcRequirements(i % 3 + 1, {64 + i, 33}, nvcv::FMT_RGB8);
+            ASSERT_EQ(first[i].rank, reqs.rank);
+            EXPECT_TRUE(std::equal(reqs.shape, reqs.shape + reqs.rank, first[i].shape));
+            EXPECT_TRUE(std::equal(reqs.strides, reqs.strides + reqs.rank, first[i].strides));
+            EXPECT_EQ(first[i].alignBytes, reqs.alignBytes);
+            EXPECT_EQ(first[i].dtype, reqs.dtype);
+            EXPECT_EQ(nvcv::TensorLayout(first[i].layout), nvcv::TensorLayout(reqs.layout));
+        }
+    }
+}
+
+TEST(Tensor, calc_requirements_performance_row_alignment)
+{
+    NVCVTensorRequirements reqs = nvcv::Tensor::CalcRequirements(
+        2, {1918, 4}, nvcv::FMT_RGB8, nvcv::MemAlignment{}.rowAddr(NVCV_ROW_ALIGNMENT_PERFORMANCE));
+
+    ASSERT_EQ(4, reqs.rank);
+    EXPECT_EQ(0, reqs.strides[1] % NVCV_ROW_ALIGNMENT_PERFORMANCE);
+    EXPECT_LE(1918 * 3, reqs.strides[1]);
+    EXPECT_EQ(0, reqs.alignBytes % NVCV_ROW_ALIGNMENT_PERFORMANCE);
+}
+
 TEST(Tensor, wip_user_pointer)
 {
     nvcv::Tensor tensor(3, {163, 117}, nvcv::FMT_RGBA8);
@@ -319,6 +362,242 @@ TEST(Tensor, wip_user_pointer)
     ASSERT_EQ(&tensor, cxxPtr) << "cxx object pointer must always be associated with the corresponding handle";
 }
 
+TEST(Tensor, release_stream_defers_free)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+    {
+        nvcv::PoolAllocator alloc;
+
+        void *basePtr;
+        {
+            nvcv::Tensor tensor(3, {163, 117}, nvcv::FMT_RGBA8, {}, &alloc);
+            ASSERT_NO_THROW(tensor.setReleaseStream(stream));
+
+            auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+            ASSERT_NE(nullptr, data);
+            basePtr = data->basePtr();
+
+            ASSERT_EQ(cudaSuccess, cudaMemsetAsync(basePtr, 0, 4096, stream));
+        }
+
+        // Memory is given back once the work on stream is done, and the pool hands it out again
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        nvcv::Tensor tensor(3, {163, 117}, nvcv::FMT_RGBA8, {}, &alloc);
+        auto        *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(basePtr, data->basePtr());
+    }
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(Tensor, upload_download_padded_rows)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+    // Odd width so that rows are padded up to the alignment
+    nvcv::Tensor tensor(2, {1917, 5}, nvcv::FMT_RGB8, nvcv::MemAlignment{}.rowAddr(NVCV_ROW_ALIGNMENT_PERFORMANCE));
+
+    std::vector<uint8_t> src(2 * 5 * 1917 * 3);
+    std::iota(src.begin(), src.end(), 0);
+
+    ASSERT_NO_THROW(nvcv::Upload(tensor, src.data(), src.size(), stream));
+
+    std::vector<uint8_t> dst(src.size());
+    ASSERT_NO_THROW(nvcv::Download(tensor, dst.data(), dst.size(), stream));
+    EXPECT_EQ(src, dst);
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(Tensor, upload_download_larger_than_staging)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+    // 24 MiB, goes around the staging ring more than once
+    nvcv::Tensor tensor(1, {2048, 3072}, nvcv::FMT_RGBA8);
+
+    std::vector<uint8_t> src(2048 * 3072 * 4);
+    std::mt19937         rng(123);
+    std::generate(src.begin(), src.end(), [&rng] { return static_cast<uint8_t>(rng()); });
+
+    ASSERT_NO_THROW(nvcv::Upload(tensor, src.data(), src.size(), stream));
+
+    std::vector<uint8_t> dst(src.size());
+    ASSERT_NO_THROW(nvcv::Download(tensor, dst.data(), dst.size(), stream));
+    EXPECT_EQ(src, dst);
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(Tensor, upload_download_invalid_arguments)
+{
+    nvcv::Tensor tensor(1, {16, 8}, nvcv::FMT_U8);
+
+    std::vector<uint8_t> buf(16 * 8);
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorUpload(tensor.handle(), buf.data(), buf.size() - 1, nullptr));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorDownload(tensor.handle(), buf.data(), buf.size() + 1, nullptr));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorUpload(tensor.handle(), nullptr, buf.size(), nullptr));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorDownload(nullptr, buf.data(), buf.size(), nullptr));
+}
+
+TEST(Tensor, save_load_file_padded_rows)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    std::string path = std::filesystem::temp_directory_path() / "nvcv_test_tensor.bin";
+
+    nvcv::Tensor src(2, {1917, 5}, nvcv::FMT_RGB8, nvcv::MemAlignment{}.rowAddr(NVCV_ROW_ALIGNMENT_PERFORMANCE));
+
+    std::vector<uint8_t> data(2 * 5 * 1917 * 3);
+    std::iota(data.begin(), data.end(), 0);
+    ASSERT_NO_THROW(nvcv::Upload(src, data.data(), data.size(), stream));
+
+    ASSERT_NO_THROW(nvcv::SaveFile(src, path.c_str(), stream));
+
+    NVCVTensorFileHeader header;
+    ASSERT_NO_THROW(header = nvcv::ReadTensorFileHeader(path.c_str()));
+    EXPECT_EQ(NVCV_TENSOR_FILE_VERSION, header.version);
+    EXPECT_EQ(nvcv::TENSOR_NHWC, nvcv::TensorLayout{header.layout});
+    EXPECT_EQ(nvcv::DataType{NVCV_DATA_TYPE_U8}, nvcv::DataType{header.dtype});
+    ASSERT_EQ(4, header.rank);
+    EXPECT_EQ(2, header.shape[0]);
+    EXPECT_EQ(5, header.shape[1]);
+    EXPECT_EQ(1917, header.shape[2]);
+    EXPECT_EQ(3, header.shape[3]);
+    EXPECT_EQ(0, header.payloadOffset % NVCV_TENSOR_FILE_ALIGNMENT);
+    EXPECT_EQ(static_cast<int64_t>(data.size()), header.payloadSize);
+
+    // Packed destination this time
+    nvcv::Tensor dst(src.shape(), src.dtype());
+    ASSERT_NO_THROW(nvcv::LoadFile(path.c_str(), dst, stream));
+
+    std::vector<uint8_t> loaded(data.size());
+    ASSERT_NO_THROW(nvcv::Download(dst, loaded.data(), loaded.size(), stream));
+    EXPECT_EQ(data, loaded);
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+    std::filesystem::remove(path);
+}
+
+TEST(Tensor, load_file_invalid_arguments)
+{
+    std::string path = std::filesystem::temp_directory_path() / "nvcv_test_tensor.bin";
+
+    nvcv::Tensor tensor(1, {16, 8}, nvcv::FMT_U8);
+    ASSERT_NO_THROW(nvcv::SaveFile(tensor, path.c_str(), nullptr));
+
+    NVCVTensorFileHeader header;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorFileReadHeader(path.c_str(), nullptr));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorFileReadHeader(nullptr, &header));
+
+    nvcv::Tensor otherShape(1, {8, 16}, nvcv::FMT_U8);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorLoadFile(path.c_str(), otherShape.handle(), nullptr));
+
+    nvcv::Tensor otherType(1, {16, 8}, nvcv::FMT_S8);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorLoadFile(path.c_str(), otherType.handle(), nullptr));
+
+    // Truncated payload
+    std::filesystem::resize_file(path, NVCV_TENSOR_FILE_ALIGNMENT + 16 * 8 - 1);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorFileReadHeader(path.c_str(), &header));
+
+    // Not a tensor file
+    std::ofstream(path) << "not a tensor";
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorLoadFile(path.c_str(), tensor.handle(), nullptr));
+
+    std::filesystem::remove(path);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorLoadFile(path.c_str(), tensor.handle(), nullptr));
+}
+
+TEST(Tensor, managed_memory_written_by_host_and_prefetched)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+    {
+        nvcv::ManagedAllocator alloc(NVCV_MANAGED_MEM_UNIFIED);
+
+        nvcv::Tensor tensor(1, {64, 32}, nvcv::FMT_U8, {}, &alloc);
+
+        auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+        ASSERT_NE(nullptr, data);
+
+        // Host writes to the tensor memory directly
+        auto *ptr = reinterpret_cast<uint8_t *>(data->basePtr());
+        std::fill(ptr, ptr + data->stride(0), 0x5A);
+
+        int dev;
+        ASSERT_EQ(cudaSuccess, cudaGetDevice(&dev));
+        ASSERT_NO_THROW(nvcv::Prefetch(tensor, dev, stream));
+        ASSERT_NO_THROW(nvcv::Prefetch(tensor, NVCV_PREFETCH_TO_HOST, stream));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        EXPECT_EQ(0x5A, ptr[0]);
+        EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorPrefetch(tensor.handle(), -2, stream));
+    }
+
+    // Prefetching regular device memory does nothing
+    nvcv::Tensor tensor(1, {64, 32}, nvcv::FMT_U8);
+    EXPECT_NO_THROW(nvcv::Prefetch(tensor, 0, stream));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(Tensor, export_ipc_describes_slice)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor      tensor(4, {64, 32}, nvcv::FMT_RGBA8);
+    nvcv::TensorSlice slice(tensor, 0, 1, 3);
+
+    NVCVTensorIpcHandle ipcTensor, ipcSlice;
+    ASSERT_NO_THROW(ipcTensor = nvcv::ExportIpc(tensor, stream));
+    ASSERT_NO_THROW(ipcSlice = nvcv::ExportIpc(slice, stream));
+
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor.exportData());
+    ASSERT_NE(nullptr, data);
+
+    // Both are in the same allocation, the slice starts one sample later
+    EXPECT_EQ(0, memcmp(ipcTensor.memHandle, ipcSlice.memHandle, NVCV_IPC_HANDLE_SIZE));
+    EXPECT_EQ(ipcTensor.offset + data->stride(0), ipcSlice.offset);
+
+    EXPECT_EQ(nullptr, ipcSlice.data.buffer.strided.basePtr);
+    EXPECT_EQ(2, ipcSlice.data.shape[0]);
+    EXPECT_EQ(data->stride(1), ipcSlice.data.buffer.strided.strides[1]);
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(Tensor, export_import_ipc_invalid_arguments)
+{
+    nvcv::Tensor        tensor(1, {64, 32}, nvcv::FMT_U8);
+    NVCVTensorIpcHandle ipc;
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorExportIpc(nullptr, nullptr, &ipc));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorExportIpc(tensor.handle(), nullptr, nullptr));
+
+    // Unified memory can't be shared through CUDA IPC
+    nvcv::ManagedAllocator alloc(NVCV_MANAGED_MEM_UNIFIED);
+    nvcv::Tensor           managed(1, {64, 32}, nvcv::FMT_U8, {}, &alloc);
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorExportIpc(managed.handle(), nullptr, &ipc));
+
+    NVCVTensorHandle handle;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvTensorExportIpc(tensor.handle(), nullptr, &ipc));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorImportIpc(nullptr, nullptr, &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorImportIpc(&ipc, nullptr, nullptr));
+
+    ipc.offset = -1;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorImportIpc(&ipc, nullptr, &handle));
+}
+
 TEST(TensorWrapData, wip_create)
 {
     nvcv::ImageFormat fmt
@@ -504,3 +783,106 @@ TEST_P(TensorWrapParamTests, wip_create)
         }
     }
 }
+
+TEST(TensorSlice, wip_create)
+{
+    nvcv::TensorSlice *slice = nullptr;
+    const void        *goldBasePtr;
+    int64_t            goldStride;
+
+    {
+        nvcv::Tensor origTensor(5, {173, 79}, nvcv::FMT_RGBA8);
+
+        auto *origData = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(origTensor.exportData());
+        ASSERT_NE(nullptr, origData);
+
+        goldStride  = origData->stride(0);
+        goldBasePtr = origData->basePtr() + 2 * goldStride;
+
+        slice = new nvcv::TensorSlice(origTensor, 0, 2, 4);
+    }
+    // slice must keep the parent tensor alive
+
+    EXPECT_EQ(nvcv::TensorShape({2, 79, 173, 4}, nvcv::TENSOR_NHWC), slice->shape());
+    EXPECT_EQ(nvcv::TYPE_U8, slice->dtype());
+
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(slice->exportData());
+    ASSERT_NE(nullptr, data);
+    EXPECT_EQ(goldBasePtr, data->basePtr());
+    EXPECT_EQ(goldStride, data->stride(0));
+
+    ASSERT_EQ(slice, nvcv::StaticCast<nvcv::TensorSlice *>(slice->handle()));
+
+    delete slice;
+}
+
+TEST(TensorSlice, wip_invalid_range)
+{
+    nvcv::Tensor    tensor(5, {173, 79}, nvcv::FMT_RGBA8);
+    NVCVTensorHandle handle;
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorSlice(tensor.handle(), 4, 0, 1, &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorSlice(tensor.handle(), 0, 3, 3, &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorSlice(tensor.handle(), 0, 2, 6, &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorSlice(tensor.handle(), 0, -1, 2, &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorSlice(tensor.handle(), 0, 0, 2, nullptr));
+}
+
+TEST(GrowableTensor, grows_in_place)
+{
+    std::unique_ptr<nvcv::GrowableTensor> tensor;
+    try
+    {
+        tensor = std::make_unique<nvcv::GrowableTensor>(nvcv::TensorShape{{2, 16, 16, 3}, nvcv::TENSOR_NHWC},
+                                                        nvcv::TYPE_U8, 64);
+    }
+    catch (const nvcv::Exception &e)
+    {
+        ASSERT_EQ(nvcv::Status::ERROR_NOT_COMPATIBLE, e.code());
+        GTEST_SKIP() << "Device doesn't support virtual memory management";
+    }
+
+    EXPECT_EQ(64, tensor->maxOuterSize());
+    EXPECT_EQ(2, tensor->shape()[0]);
+
+    auto *data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor->exportData());
+    ASSERT_NE(nullptr, data);
+    std::byte *basePtr = data->basePtr();
+    int64_t    stride  = data->stride(0);
+
+    std::vector<uint8_t> gold(2 * stride);
+    std::iota(gold.begin(), gold.end(), 0);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(basePtr, gold.data(), gold.size(), cudaMemcpyHostToDevice));
+
+    tensor->setOuterSize(40);
+    EXPECT_EQ(40, tensor->shape()[0]);
+
+    data = dynamic_cast<const nvcv::ITensorDataStridedCuda *>(tensor->exportData());
+    ASSERT_NE(nullptr, data);
+    EXPECT_EQ(basePtr, data->basePtr());
+    EXPECT_EQ(stride, data->stride(0));
+
+    // whole new range must be accessible, old contents preserved
+    ASSERT_EQ(cudaSuccess, cudaMemset(basePtr + 2 * stride, 0, 38 * stride));
+    std::vector<uint8_t> test(gold.size());
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(test.data(), basePtr, test.size(), cudaMemcpyDeviceToHost));
+    EXPECT_EQ(gold, test);
+
+    tensor->setOuterSize(1);
+    EXPECT_EQ(1, tensor->shape()[0]);
+    EXPECT_EQ(basePtr, dynamic_cast<const nvcv::ITensorDataStridedCuda &>(*tensor->exportData()).basePtr());
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorSetOuterSize(tensor->handle(), 65));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorSetOuterSize(tensor->handle(), -1));
+}
+
+TEST(GrowableTensor, regular_tensor_cant_grow)
+{
+    nvcv::Tensor tensor(5, {173, 79}, nvcv::FMT_RGBA8);
+
+    int64_t maxOuterSize = 0;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvTensorGetMaxOuterSize(tensor.handle(), &maxOuterSize));
+    EXPECT_EQ(5, maxOuterSize);
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorSetOuterSize(tensor.handle(), 3));
+}
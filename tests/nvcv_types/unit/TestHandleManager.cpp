@@ -21,7 +21,9 @@
 #include <nvcv_types/priv/HandleManager.hpp>
 #include <nvcv_types/priv/HandleManagerImpl.hpp>
 
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 namespace priv = nvcv::priv;
 
@@ -181,3 +183,211 @@ TEST(HandleManager, wip_no_handle_leak_if_object_creation_throws)
     ASSERT_NO_THROW(h = mgr.create<Object>(1).first);
     mgr.decRef(h);
 }
+
+TEST(HandleManager, wip_dynamic_size_reuses_cached_handle)
+{
+    priv::HandleManager<IObject, Object> mgr("Object");
+
+    void *h = mgr.create<Object>(0).first;
+    mgr.decRef(h);
+
+    // Resource goes back to the thread cache and is handed out again right away
+    void *newh = mgr.create<Object>(1).first;
+    constexpr uintptr_t kAddrMask = ~(uintptr_t)(priv::kResourceAlignment - 1);
+    EXPECT_EQ((uintptr_t)h & kAddrMask, (uintptr_t)newh & kAddrMask);
+    EXPECT_NE(h, newh);
+
+    priv::HandleManagerStats stats = mgr.stats();
+    EXPECT_EQ(1, stats.inUse);
+    EXPECT_LE(1, stats.capacity);
+    EXPECT_EQ(1, stats.globalRefills);
+
+    mgr.decRef(newh);
+}
+
+TEST(HandleManager, wip_multithreaded_create_destroy)
+{
+    priv::HandleManager<IObject, Object> mgr("Object");
+
+    constexpr int kNumThreads = 8;
+    constexpr int kNumIters   = 1000;
+    constexpr int kNumLive    = 100;
+
+    std::vector<std::thread> threads;
+    std::atomic<int>         numErrors = 0;
+
+    for (int t = 0; t < kNumThreads; ++t)
+    {
+        threads.emplace_back(
+            [&, t]
+            {
+                std::vector<void *> handles;
+                for (int i = 0; i < kNumIters; ++i)
+                {
+                    for (int j = 0; j < kNumLive; ++j)
+                    {
+                        handles.push_back(mgr.create<Object>(t * kNumLive + j).first);
+                    }
+                    for (int j = 0; j < kNumLive; ++j)
+                    {
+                        IObject *obj = mgr.validate(handles[j]);
+                        if (!obj || obj->value() != t * kNumLive + j)
+                        {
+                            ++numErrors;
+                        }
+                    }
+                    for (void *h : handles)
+                    {
+                        mgr.decRef(h);
+                    }
+                    handles.clear();
+                }
+            });
+    }
+
+    for (std::thread &th : threads)
+    {
+        th.join();
+    }
+
+    EXPECT_EQ(0, numErrors);
+
+    // All thread caches were given back when their threads exited, so nothing is
+    // missing from the shared free list nor counted as in use.
+    priv::HandleManagerStats stats = mgr.stats();
+    EXPECT_EQ(0, stats.inUse);
+    EXPECT_GT(stats.cacheHits, stats.globalRefills + stats.globalFlushes);
+
+    std::unordered_set<void *> handles;
+    for (int i = 0; i < stats.capacity; ++i)
+    {
+        EXPECT_TRUE(handles.insert(mgr.create<Object>(i).first).second);
+    }
+    for (void *h : handles)
+    {
+        mgr.decRef(h);
+    }
+}
+
+TEST(HandleManager, wip_fixed_size_not_starved_by_other_thread)
+{
+    priv::HandleManager<IObject, Object> mgr("Object");
+    mgr.setFixedSize(1);
+
+    std::thread([&] { mgr.decRef(mgr.create<Object>(0).first); }).join();
+
+    void *h = nullptr;
+    ASSERT_NO_THROW(h = mgr.create<Object>(1).first);
+    mgr.decRef(h);
+}
+
+TEST(HandleManager, wip_clear_invalidates_thread_cache)
+{
+    priv::HandleManager<IObject, Object> mgr("Object");
+
+    mgr.decRef(mgr.create<Object>(0).first);
+
+    // Releases all resources, including the ones cached by this thread
+    mgr.setFixedSize(2);
+    mgr.setDynamicSize();
+    EXPECT_EQ(0, mgr.stats().capacity);
+
+    void *h = mgr.create<Object>(1).first;
+    ASSERT_NE(nullptr, mgr.validate(h));
+    EXPECT_EQ(1, mgr.stats().inUse);
+    mgr.decRef(h);
+}
+
+TEST(HandleManager, wip_fixed_size_allocates_on_demand)
+{
+    priv::HandleManager<IObject, Object> mgr("Object");
+
+    mgr.setFixedSize(1 << 20);
+    EXPECT_EQ(0, mgr.stats().capacity);
+
+    void *h = mgr.create<Object>(0).first;
+    EXPECT_LT(mgr.stats().capacity, 1 << 20);
+    mgr.decRef(h);
+}
+
+TEST(HandleManager, wip_dynamic_size_grows_in_pools)
+{
+    priv::HandleManager<IObject, Object> mgr("Object");
+    EXPECT_EQ(0, mgr.stats().capacity);
+
+    std::vector<void *> handles;
+    handles.push_back(mgr.create<Object>(0).first);
+
+    const int64_t firstCapacity = mgr.stats().capacity;
+    ASSERT_LT(0, firstCapacity);
+
+    for (int i = 1; i <= firstCapacity; ++i)
+    {
+        handles.push_back(mgr.create<Object>(i).first);
+    }
+
+    // Previous resources stay where they were
+    priv::HandleManagerStats stats = mgr.stats();
+    EXPECT_LT(firstCapacity, stats.capacity);
+    EXPECT_EQ((int64_t)handles.size(), stats.inUse);
+
+    for (int i = 0; i < (int)handles.size(); ++i)
+    {
+        IObject *obj = mgr.validate(handles[i]);
+        ASSERT_NE(nullptr, obj);
+        EXPECT_EQ(i, obj->value());
+    }
+    for (void *h : handles)
+    {
+        mgr.decRef(h);
+    }
+}
+
+TEST(HandleManager, wip_multithreaded_growth_from_empty)
+{
+    priv::HandleManager<IObject, Object> mgr("Object");
+
+    constexpr int kNumThreads = 8;
+    constexpr int kNumLive    = 3000;
+
+    std::vector<std::vector<void *>> handles(kNumThreads);
+    std::vector<std::thread>         threads;
+
+    // All threads start growing the manager at the same time
+    for (int t = 0; t < kNumThreads; ++t)
+    {
+        threads.emplace_back(
+            [&, t]
+            {
+                for (int i = 0; i < kNumLive; ++i)
+                {
+                    handles[t].push_back(mgr.create<Object>(t * kNumLive + i).first);
+                }
+            });
+    }
+    for (std::thread &th : threads)
+    {
+        th.join();
+    }
+
+    std::unordered_set<void *> unique;
+    for (int t = 0; t < kNumThreads; ++t)
+    {
+        for (int i = 0; i < kNumLive; ++i)
+        {
+            IObject *obj = mgr.validate(handles[t][i]);
+            ASSERT_NE(nullptr, obj);
+            EXPECT_EQ(t * kNumLive + i, obj->value());
+            EXPECT_TRUE(unique.insert(handles[t][i]).second);
+        }
+    }
+    EXPECT_EQ(kNumThreads * kNumLive, mgr.stats().inUse);
+
+    for (auto &v : handles)
+    {
+        for (void *h : v)
+        {
+            mgr.decRef(h);
+        }
+    }
+}
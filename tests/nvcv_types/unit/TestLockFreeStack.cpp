@@ -119,3 +119,36 @@ TEST(LockFreeStack, wip_release)
     EXPECT_EQ(nn + 2, nn[1].next);
     EXPECT_EQ(nullptr, nn[2].next);
 }
+
+TEST(LockFreeStack, wip_pop_stack)
+{
+    priv::LockFreeStack<Node> stack;
+
+    int   count = -1;
+    Node *h     = stack.popStack(2, count);
+    EXPECT_EQ(nullptr, h);
+    EXPECT_EQ(0, count);
+
+    Node nn[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        nn[i].value = i;
+        nn[i].next  = i + 1 < 3 ? &nn[i + 1] : nullptr;
+    }
+
+    stack.pushStack(nn, nn + 2);
+
+    h = stack.popStack(2, count);
+    EXPECT_EQ(2, count);
+    EXPECT_EQ(nn + 0, h);
+    EXPECT_EQ(nn + 1, nn[0].next);
+    EXPECT_EQ(nullptr, nn[1].next);
+
+    EXPECT_EQ(nn + 2, stack.top());
+
+    h = stack.popStack(2, count);
+    EXPECT_EQ(1, count);
+    EXPECT_EQ(nn + 2, h);
+    EXPECT_EQ(nullptr, nn[2].next);
+    EXPECT_TRUE(stack.empty());
+}
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <linux/mempolicy.h>
+#include <nvcv_types/priv/NumaNode.hpp>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <climits>
+
+namespace priv = nvcv::priv;
+
+namespace {
+
+int CurrentMemPolicyMode()
+{
+    int           mode = -1;
+    unsigned long mask = 0;
+    if (syscall(SYS_get_mempolicy, &mode, &mask, sizeof(mask) * CHAR_BIT, nullptr, 0) != 0)
+    {
+        return -1;
+    }
+    return mode;
+}
+
+} // namespace
+
+TEST(NumaNode, device_node_is_stable)
+{
+    int node = priv::GetDeviceNumaNode(0);
+    EXPECT_GE(node, -1);
+    EXPECT_EQ(node, priv::GetDeviceNumaNode(0));
+}
+
+TEST(NumaNode, negative_node_leaves_policy_unchanged)
+{
+    int mode = CurrentMemPolicyMode();
+    {
+        priv::NumaNodeScope scope(-1);
+        EXPECT_EQ(mode, CurrentMemPolicyMode());
+    }
+    EXPECT_EQ(mode, CurrentMemPolicyMode());
+}
+
+TEST(NumaNode, scope_restores_previous_policy)
+{
+    int mode = CurrentMemPolicyMode();
+    if (mode < 0)
+    {
+        GTEST_SKIP() << "Kernel without NUMA support";
+    }
+
+    {
+        priv::NumaNodeScope scope(0);
+        EXPECT_EQ(MPOL_PREFERRED, CurrentMemPolicyMode());
+    }
+    EXPECT_EQ(mode, CurrentMemPolicyMode());
+}